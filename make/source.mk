@@ -56,6 +56,7 @@ COMMON_SRC = \
             io/usb_cdc_hid.c \
             io/usb_msc.c \
             msp/msp.c \
+            msp/msp_batch.c \
             msp/msp_box.c \
             msp/msp_serial.c \
             scheduler/scheduler.c \
@@ -75,6 +76,7 @@ COMMON_SRC = \
             drivers/rx/rx_pwm.c \
             drivers/serial_softserial.c \
             fc/core.c \
+            fc/loop_overrun.c \
             fc/rc.c \
             fc/rc_adjustments.c \
             fc/rc_controls.c \
@@ -89,6 +91,7 @@ COMMON_SRC = \
             flight/pid.c \
             flight/servos.c \
             flight/servos_tricopter.c \
+            flight/wing_monitor.c \
             io/serial_4way.c \
             io/serial_4way_avrootloader.c \
             io/serial_4way_stk500v2.c \
@@ -114,6 +117,7 @@ COMMON_SRC = \
             sensors/compass.c \
             sensors/gyro.c \
             sensors/gyroanalyse.c \
+            sensors/gyro_fusion.c \
             sensors/rpm_filter.c \
             sensors/initialisation.c \
             blackbox/blackbox.c \
@@ -223,6 +227,7 @@ SPEED_OPTIMISED_SRC := $(SPEED_OPTIMISED_SRC) \
             drivers/system.c \
             drivers/timer.c \
             fc/core.c \
+            fc/loop_overrun.c \
             fc/tasks.c \
             fc/rc.c \
             fc/rc_controls.c \
@@ -244,6 +249,7 @@ SPEED_OPTIMISED_SRC := $(SPEED_OPTIMISED_SRC) \
             sensors/boardalignment.c \
             sensors/gyro.c \
             sensors/gyroanalyse.c \
+            sensors/gyro_fusion.c \
             sensors/rpm_filter.c \
             $(CMSIS_SRC) \
             $(DEVICE_STDPERIPH_SRC) \
@@ -0,0 +1,4073 @@
+	.file	"blackbox.c"
+	.section	.gnu.lto_.profile.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\025\t\335 "
+	.string	"F\346\220K\200\224R:_~\025\005\263;\033PdB\346\215Q\375n.(Yw7\207\302h\304+\365\266\177\262u\221\r\003\245\372O\271]\273\342\331\032oi\274%X\207\004\376\251\300\276\n\344\031\024\363\335f\307\254\022\330\335\317\332'-\021\031p"
+	.string	"v"
+	.string	"\204"
+	.string	"\377\035\023\357r\027\340\003\274\207\277T\317\251\306\215\256 +\3266\204\315=s\212\325\004\266\355\263\360}\341\001\b[\336\362\340\203.\313\201o\237\337~\345I\225\t\255y\266\222\363y;*oG\236?_\367\177\307g\357;\373\336y\357\357\276\373\372>\213z\306\214\343\332\255\272_}\346Ay\341\220\352\216\227O\265)\265\337\266`S\242\242\332\250\261/\013>T\320\303\003\363\241\314NN\352\226\302\250\244\274G\235\314\302\275\365"
+	.string	"b\004\372)\276\030|\361n_\347\371\302\025\252\262'\017\237\340s\336\317\351\004o{\313\031>\252zxv\212\301\007\211\230x\234\273\307\t\362\221A\223v\350\320\304\300\334\374\006\301\363\177\370\345\300\3736\357\033x\277\246_"
+	.ascii	"\317\020xwc<\3404\357\317\274/\363,\340D\214c\3360/\307\001\255"
+	.ascii	"*\325\306eC\204\320\205\204\236\217\3338\255iZ\b\344\221G\"e"
+	.ascii	",YIA\004\275\346]nWD>\254*\224(\315+\017\035\256K\363R\262\306"
+	.ascii	"\341\375\353s3\"6\266AC\006\f\027,T\240\360\376\305\330\346W"
+	.ascii	"ej\3065A\302\360\320--g\004\b\370\230\3355\243\316\247\007F\315"
+	.ascii	"\316M-Y98\376x"
+	.string	"\343\215F|\274k\274{\244\2625=\tk\240\004\272\013t\334\300%3\313Y\364s\242\317\335\215\227O\265\251\030m4J\003\nF\226V\t\301z\341\336\265\341\201A\277\240.\324\271 Pf-\236\2278%MY\2609\232K\271\025\253\224\315\351\211\264>\263\230\236T\274\177\225W*s\321\031 \255H\224\232\254\245\340\311\2419\343P\364\222\300m19\261\356\256\312tX\2318vR\2049V\342\375\273\366~`E\225H\340!O\211\211\254\351(\371d\237\350\215OtL\224|\262\255\222\372j\216\030\372\320\337\277C\001\200\370\250\301=\251\231\251 )(\025\206\003`\202RDD\253\003\022 \024*\222)\225\241\221\231 )M\241\376\323\001#@\020u\224\207P\033\222\274LC\002\002w\034\244\024\205J\232\0361\207`\305\005\366\023\316\370\025\376P\277\244\301\020\375\360\215\fi\210\240\200\025\227\371\371\035\346\267"
+	.string	"\324\b\343<3/8\261`\227\222B\270\356\035i2\2664\022\335i\372\204-\366\225\2746\031\3662\335\344\333\033\177\317*\270Gf\n\272\267Ga\024\344\021\257\002N&\314tA\271h\231\001\260\2565\230\247\241\ts\236\320ls\224g\230\233J\373\rC\304\264v\260\333q\021\345\226\027>\215\347\347\264*-\230\304\n\230\n*\230r\300b\236\371+\013\001B\350\343\230nK<2\207\r\030OO\237\002\303f\005I\223\204\245\274P<\261z\203\316\204\253\325\350\302t\036\304;\334\307\311\177\310M\371\376m\376Vk\272\002\013\251\324\303mp=\b\303-\314\rO\2762\374\0238\002\276K\355\247\211\260\256\241\367\315\265\025_|\224\025x\235q\034\356\021\255!\236\252\256P3liR:\222\312]"
+	.ascii	"B.\323!c5\310>\227\204*5\347\241\023\001\273\217\324\373[lX0"
+	.ascii	"\025\3270\372\324\233%\311\235\004-\032\356r\367\037\221\244"
+	.ascii	"\335,\233\2645\be\224\326G\345f\336y\331\021<\244\256\244\206"
+	.ascii	"\005\354\006\350\3635\2233\316\002\353sH\fv\305\371n6\334utG"
+	.ascii	",ZY\260\231\017\234\034\216{\361\357\376\236\342\377\342\024"
+	.ascii	"\333\213\323P\244\306\317\300^8\342\234\036l\230\365\007^Y\341"
+	.ascii	"\017;\236wF\202]\367\341B,\327\300\212a\t\205p\314S\350\261R"
+	.ascii	"\365\331cz_4\306\373\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`R\002E\007"
+	.string	"\262\206\025\033@W\032\003\3143T\334F\"\0202\244}\351\213\3410&\234\260\t\"[\312\224\002.\351\034\235\242=\024\320e\262+\t\016\372\254\347\354p\376\215j2\230\313\356\262h\2052\221D\026\342\351h0\026+\022\2128X\260\222\t8\231}\325@`R\277\332\335\032\274GF\250\320\326*\035@\002\246\n\311\r\022"
+	.ascii	"6)Ci\243\230\tf\302\211\023\226\267\265v0\232\250\2726\213\317"
+	.ascii	"L=*.o\022\024X\374$\252Eq\221\230\351J\022\005X\"r0!j\345\217"
+	.ascii	"\bZ3\356\371u\277\235\305\030\r\262u\f\336\271\240R)I\261\311"
+	.ascii	"dTK\332\366y3\212_A6\034\023$\262\271\300\242\246'\022\324(\270"
+	.ascii	"El\227V-\252uW\312\272\277.Y\320\262T\360P\227\326\306J\331~"
+	.ascii	"\372\246\245\033\262\331|z\340\376"
+	.text
+	.section	.gnu.lto_.inline.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`%\022}/"
+	.string	"\346\367\300G\200\236M:)\006\366\227\006\236Y\364r\337\341\021\212\267\304\340c8\t\274\234eL>\213\212\372\0047\226f9G\331\"[O\260wV\225)+\366P\272Y\036y\260\215"
+	.string	":\256\026F\030+\276,\026w#\204l\271S\237"
+	.string	"\247"
+	.string	"\267"
+	.string	"\266\237\335?\262\021p\230\177\323\177\373\277\343\252\245\356\270\305\260\356x\205\225\272\003\322\345p\347\017\300\347\326c\343a\372\177kmB3w\354\342\001\266(\361\262\343\304\227'\002\326\277\366\360\357\373\255)\354Q\312X\305"
+	.ascii	"\327\377C\\\317\257*,\020\242\030X\320-y\322g\205\3350\356\357"
+	.ascii	"\371{\372X\330\335\270_\364\027\355\361o\372\353\373\221OO\236"
+	.ascii	"\317F\334\335m\376F6,\210\325\343\326\376\013q\215R\177]\205"
+	.ascii	"R\205\230\305\377\007\265\211\216)\304-^\276\"\331_\220'5\003"
+	.ascii	"\376\003\317\r\b\265Z_\317\245Y\177K\376\367\331\264\264\264"
+	.ascii	"\240y\250\030ie\026\377V\311\332A\023\023U~-\300\375\224D\300"
+	.ascii	"\377\246\304e0\300L\235I\354\024\f\206!O\266m\336}P\307\342\026"
+	.ascii	"X}\252a\340ZK\256&\377\317\300\225K\315\361\013\021f\216\231"
+	.ascii	"\312\2463\023\0033U\236$d\303\260\243\335G\005g1\363\005\215"
+	.ascii	"n\311r\031\211\\\235\357\371\311\213\222\375\327\337\354\233"
+	.ascii	"\274'o\021\377\374\331\343\256,+*\333k\277r\237\273'\264\235"
+	.ascii	"\375\333g\363\254W\361\353\313<\332G\233\307Q\240\310\252\220"
+	.ascii	"O\373i\367\370\206WQN\3775pMC\013\020\370\361)350\323o\032aQ"
+	.ascii	"\314\217\007\301L\320`\2659\261\316\27249\377\241\274\207\216"
+	.ascii	"\252#\205\307O\323\261\222\343\363\016H\272[A\n\006\353n\004"
+	.ascii	"\347`\r\260Ww\003}C\377 1\260\273m\317pd\273\246<\321\322qa\261"
+	.ascii	"\031\346>\364W33#\234J\306s\314\214qj\021\007B\377\357,\213\224"
+	.ascii	"4\026\222\254\320M\016-\005\277P\227\370\311\214\224\261\006"
+	.ascii	"W\260\223\033\242\330\327\234\302o\203\250\272\177\002\356\204"
+	.ascii	"\037\tg\237t\267\356\026\241\347?\342\253\356\346Qb0\335}\376"
+	.ascii	"\301\177\" O\235\351(V\253%\033UfD\252\322x\0033\377Y9b\\C\206"
+	.ascii	"\244\226\364 \223\340JF6\311\024\"\275\326xj\215\256\261!q8\350"
+	.ascii	"\325\365\253\252a.\212\023\001\3571\310\224\037\266\367\252\f"
+	.ascii	"\341\2161[\307\363\274;fU&X{\321\021\2378\323\335\265\233\370"
+	.ascii	"\021\251\2564\221\300%+\314\t\204\2278\023\357\274\251\252\320"
+	.ascii	"\006\307\021(\006'\211 \033B\216h\005\335\021\225\355\034\251"
+	.ascii	"\220\301m1\301\262$G\212\250I\366j\306\220\r\001'\"S>\200n\210"
+	.ascii	"\312\265kz^\224d\362L\026\325\337_\024\334|\317\227g\373<\237"
+	.ascii	"\350Q\036zFy\351S\037\233\315\030\216\331\316\3519\345\331\226"
+	.ascii	"\201V\305\347\332=K\n\033@\201b\250\241\271\031\231!\222$%I\206"
+	.ascii	"1\261\004\3041\346\034t\352\001\022`\023I\303\302$sH %$\"\242"
+	.ascii	"$I9\005\2254\007\224\340\007\270\2572\235T\344'\231\245\301q"
+	.ascii	"}\3515\202$uQ\332v\315v%e_\020i\n\245\222\361\177\344\376t\321"
+	.ascii	"\017\205!\2229\235\037&y\256:<\305gp\232\317\236\245m\222i\022"
+	.ascii	"\273\256f\245\244\250i=\254\271\003\220\020\024\267b\316\235"
+	.ascii	"\236\0174:E\372@\266&\325\037\034\247D?\031a\352i'lh\257,\360"
+	.ascii	"\0041>\256\016;C\366\201|\033u\035\374\332q#\323HQN\310\200\226"
+	.ascii	"k\030J\266\344\337-Qx^$\211\367Kv\341\206\216\312\327 vlN\001"
+	.ascii	"\360\252gG'\342\332Vi\005\355|vK\270\345\343\251\200\325\246"
+	.ascii	"\326\270H\306xFF\205\260\205\035*w\227T\"\020\333T\026\203S;"
+	.ascii	"\214Gx\212\3322F\270\326\3528\345X\226-\271b\312\353\247 \007"
+	.ascii	"\356\216\233\0133$\326\315\020\362\031\222sX\356kT+Q\247r\216"
+	.ascii	"\250\225\224\343\350\341Sf\f\276\016\256[\323\304\211q\007\351"
+	.ascii	"DGd\024+\006"
+	.string	"\2273\303\310\365\332\211\203\204\303j`&6 P\324*0}2\002\305.\360\327\322\250[d\373D\237\302\313\3753\022\202R(Du\271o\024\201w#z\244X\354p^\n\250\036J?f?\251\0228\t\215\006\205\371\025W\215\327X\237`({\204\200X-\344\224\032\311\207\233\2362\021\341\t\231\364\201\243)\\\264\251\355\031[\370\251\237r\257O\204\245$~\222\343\362\345\373\343S\f\206\033\213\346c\342\272\232\313z\b\322\fZx\271\310%<w\213\217\252T+\345|\225\270L\3478\020\200\241\216s-A\027h\247\"T\326\271\267\004\2314\213\303#\313a\213\235\b\244\245|\360x\264X\026\316o\201\313\210\310Tn\2310\2665=\354\215\216\220\330\354\240!H8p\032Mv4\b\003\300\2215\261\343\",O9$\260\267dc$\222\035<J\352\332\243a\242[\006\3004\346\253\202\t\264\020M\363r"
+	.string	"\033\002\305\250\343\333IP3\325`/\372\317\264\323\233\212\376\026\233)\346\261\353\256\360ws\300\374\032\"\236\243d\210T\0033\323\r\177\034B@\004\254&\030G\207R^\362\227\265\225H\251#M\365\257"
+	.ascii	"l\277\202\300]\207%B\266FZu\375F\004\202\357i\002~\306\350~\313"
+	.ascii	"\326-\221G\\\253\274x\036\004Hemi\036\221C\277F/\374\372,\261"
+	.ascii	"\004\362\033\004C\321-\347U\236\353T\207\"gn\366P4_\031\322D"
+	.ascii	"\310\337\232\273L\211\272*\252\002\234\001QR\rR.\347\200A\021"
+	.ascii	"1JKX\345\201\310\221\030P\267\025\002p\341bv\345_\361"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`X+\025S"
+	.ascii	"*eh\025Bp\360\246\003\365q#R5\317H\272\276\351\375\262\264\311"
+	.ascii	"\013!\257\303\030=h\266*\314\276\265=)m\367\006\266\033\221m"
+	.ascii	"\245!\304+\314Y\262\2704\351\327 \330\322\204\177\317o\377\335"
+	.ascii	"H\322&[\312\224\002L\001I\001=\0017\274\303\006\226\006&\346"
+	.ascii	"\367\260+\265\213aR`D`X\214\f\371\301[\265\033\256\321\302^\356"
+	.ascii	"*\006\253\270\312\030\254\342,$XH\355\306p\217\332\215\371\277"
+	.ascii	"\326B/;\2574/-Y/\"\341\032*\n\373\204p\304\204S\302!d\260\352"
+	.ascii	"zT\273a\"\027\236\332\215\271\334\230\301\252\253\314\026W\024"
+	.ascii	"\327\021\027\020F\177\320`"
+	.string	"\025\334\002\307\200Vj7\004\233\334\365\256j\260\n\032\001y\374n\243Ak\260z\357\264\301\352u\343\006\253\227\313\225r\177\034z\203U\273e\265\354\2258X\265I,\220\273na\365\033\311\301\352\027\252\303\264\256\353\034\254\376\233\332\r\353`\365\303|\326\035\254~\220_\321_\327<XmQ\273\370\243\034\302[\273\007\253'j\227\017V+\324.\266\326\017V\0218\001\302\252\254v\303(\227\363\263\277?\363o\346\003a\325\365\353\357\337'(\264\357?\353#\204\325\257]\320=\352\255\215\305\354\223\375=\331\337\324\007\017\366\367[\377\245D\340\241B\177\250\320>\003w\231c\f\202\356\326\276\317Phm\007\327]\327\033X9\336\345\204\366\177\017j\371\203Z\357n\247\354o\312\376\230\376\355\345`\177\367\337\033\270K\220\273\003[\240\023\037\223\360\201\33459n\223\267-B\353.\027\200\253\344.\361A\001\247\370\262B"
+	.string	"\357\206\302w\335\031:{\357\216\267K\356\263\020\366\177i\351\006yk\237\312\375\367\003A\r\366A\330\217\375\333\354\276\263T\326\325g\270\213\3562\334=\206\203\326\376\303\360\331\354\005\b\326\260\227\206\275\341\202\005.\334\335[0`\360>D,\364\324\256\215\364?\346\331\274}\273\242A\243\301:\210\025\377>+\341c=\226\253p\367\024(\334\375\351\351}X\302"
+	.ascii	"\001v\026gE\270{\b\367\017>u}\274\265\030\304\366\207\301\327"
+	.ascii	"\353\317\234a\303\006\016\034\bt\350\200\034\302pC\204\207p\313"
+	.ascii	"`\375Nh\255,\250\345\332\336\320\335/lm\375\r[\301\335\243&\254"
+	.ascii	"YcA\2465\322\272ba=Tx\037\204\344\353\372\366\007\025\376\230"
+	.ascii	"\267oo\204\007\301\007\363\377\345\177Q\026\216ER\"hi\311\342"
+	.ascii	"\324n\231\332\r\301\310\260\310\236\310\202\324n\222\373\317"
+	.ascii	"\312\324\030\243\332\305>0\346\247vC)k\310\327\305\277\212\373"
+	.ascii	"\274\370\300\330\007\362\256\033\333\263\245\006L,\313\224\330"
+	.ascii	"\221\332\r\337<\226\273\345\201\205\245\243\201\265\261!1\025"
+	.ascii	"\346\b\246\b\006\250\026WJ\356\004\340\211\002\212\346]\325Y"
+	.ascii	"6\271\215\334\222\217\264\250\221\026z\316\226\236\246\223\333"
+	.ascii	"\310\211\267])\263\331\262\322\2713\325\222\353\235\253\306\235"
+	.ascii	"s\".\353\224\\\267\263\230\242\233\274\211\346)\226\331&\236"
+	.ascii	"\373\n7\300\233\274\314=\264\324\246\231s6\321<\3114\227\347"
+	.ascii	"n\353\324$E\333>\340\272L\323s\347RQ\247y\223\371\200o=\222="
+	.ascii	"\253]frk\324\311Gm3\257P\223'j\224\327\344\345i;\323s\357\236"
+	.ascii	"\\\247y\213\272\252\235\270\317\364\3241\271\346\225\271'\352"
+	.ascii	"r$\305\364\314\241c\223\353\361\324\311|\237\346\326\275\023"
+	.ascii	"'Z\235T5l\271\244rrTo^\232\365\r\346\344(i\225E\034\217J\217"
+	.ascii	"\002|\237\251-\337\3043\345e\275\273J\305\255\323\222\274\031"
+	.ascii	"\360\2216\213\032i/Go\2673\345\331D\335#S[N\340\032\227\267\356"
+	.ascii	"e\321j\2138\223\314\245\347\251CE\333.\340\032P\332\314F\233"
+	.ascii	"\215\245&=\314@0y\214\221\366\302\345#\355\272{\316\035ws\267"
+	.ascii	"\216\326W\020\376+\b\355\377\202)\021\226|En\226\317\bh\301\347"
+	.ascii	"\304\207\004\304\360\256+%\365\304\247$\216;\313\331\355\234"
+	.ascii	"\215f\007\231\231u\311!\311\202\204\n\022\244\302\362F\232\273"
+	.ascii	"\204\354\001J\203\232-\271y\222(\331\323\333\311Q\332\f\245\205"
+	.ascii	"\256\333\244\007\235\346q\226\356\234\2423\3349\342\311Q\332"
+	.ascii	"u\255\313\346,\275\345\315!\204lfB\346{f\002\233\244.\311*\353"
+	.ascii	"\222\334\212f%\345\222y\312\333\245\274\022I\376a\302\313u\231"
+	.ascii	"m\250(\363(\036\r\226\226g\257,\265\r\200\363h\327ozc\337'jj"
+	.ascii	"\024\251\251\367\346\331\226\\\353\310tw\236%Lw\232z\024QT\333"
+	.ascii	"\316\275s\362\221\324\341\235Ka\016\363\324$\317]\215\2547\225"
+	.ascii	"\230w)\223\243\266\r\363sg\245E\333\306\216\206\216&\225\347"
+	.ascii	"\3069[J\356`U"
+	.string	"\371\352U\352\236.a>\025\302\004.\353^M\024\230\334F\216i|\362\035o4\311*Q\267uJ*\215\344NL3Uo)\205I\222H7\214\345\231C\365\316\245\004\334$3N\274J\311^\3368\221L\315\354\344$j\346\235\022\200y\232\303\221\272J\034w\256\332\347m\324\372\366\264\3441W\362\252|%\246\244\216,E\035\017\035\311]\023\314G3S\215Y\217bU\016\202L\250\302\002\237\201\322\f\215\210HA\222$\035\322\t\020\bf\221\036\367\260<\022@\022q\006\003)\016\243\224!\204\020D\210!\314\004\"\221\210\314\210\0042\355&\0358\341qF\317\2316J\360k\031;\033\f\345\251\207\223LB\370\3430\315\350\337\302\200 H\367\\\302\\;\352\342\357p\202{g\375J\n\252$.\260\241z\025\026\271\316\n\316\017Q\237\243\001\315!;\306\263#\240w\262\004 vk\334XDgw{z\327"
+	.string	"\252\214\217\257r\313*\b3\377i\337\314$E\bG$\373|\020\275\034k\276\226\177\314\277P\325\263k\274?\306\310\357Y\331\034\370\250\245\366\312\370\003\363\365Hs\315\227\312\345\n\230q[iY\213\240\265\316\240/r\352>\306\256\321\035yJ3\207$_\256 *$\267\037\030\274\013G\272\350\022\320@\023\322\325\3771j\244\356\306\216ry\342\355(\261s\243\034\030\226\326\037\362\211\f\210\026\032W@V\221\3576O\202B\205\227g\261L\246\212\272m\247\301\237\373w\177\004\225\267\236\322 \206\216T\255[U\177\210\023\034\374\212\205\333\316\302\234\335\360"
+	.string	"k\241\216C\036\315\030>.\341T\363@,\321\257\205\2064\213\022F\325`\213\200\356\302B\325\232\035\314\351[U\351\361\261ZQ\335\276\361\235\372\353%\2324c\303\364T\323\234)\315\213\255\335p\271^\307%\f\t\371\177\310\034\316.\243K`\204?\215[\330\267T\226\337a^\277@\357\225\330=\260\242\215\356Y\243T\021\204\374OQ\364$r\223\271~\022a7:\354\314\330\031\207\207\346\354\n\372\375QR\027e\nh\274\201\016\013r"
+	.ascii	"\342\2207\205\236\262@\304\213PGC\223\f`\021dh\236\336Lht\001"
+	.ascii	"\330\265\303\213O\034\2118m\274\341\203\021\350\3450\347\261"
+	.ascii	"\200\033\242\340\360\177\320\302\373\003\032\230\254~\220\220"
+	.ascii	",\004\302\013}\0265\227\346\344X\251\311+?\335_\341$\024\315"
+	.ascii	"\"\222\314\036!Lz\315Fhqp\023\370\312D\303\b\327\360\301q\347"
+	.ascii	"\241\356'\177\370\2153\\/\207\232\233\316&\275\271\306\245\330"
+	.ascii	"Y\322\351Tt<\313\335M\202\234\212\222)S\366\247\234;3(\255$-"
+	.ascii	"\"s}\220\365\243#D\022\371\364\233\372\202q/\363\023\353"
+	.string	"m\0037\322\204\215\225G^\364-w\235K\250KL\261j\033#Cpy\343c\210\277\315\247\002\354\372\375\243\257MB\377B.|\207\257\311\f\313?~H@%\202j\257p:\265\216Qm*\313\353\315\201\034tg\245"
+	.string	"\310\333Q$w7\274"
+	.string	"\252\306\3559_\257\035H\270\340~&\340h\034\220\272\3473\314\300\311\332Y\241D\337\371\302\235=)+4\273d\002\033^\263D\247\376\352\252+\275\2503H\360h\036\005^\276!\371*\225f<\362\fAkD\236\335Supo<\221\345\021t\213L\377\276\225\274\342\322\342\376\365J\302\210m\332\364\310\305\276\327\260\217\323\320\200\323&>\320 ]'\233P\177\334M\345\275\005\022\177\304\324\201\256\220J\372\024.(\347}\356\204/I\270\34565\nGi\345\333\300\320)\263\221\300\344\016!\206\323\006u\201{=\362[f\217]\315\233\271\013\357\343\225U\353,\370\355)\242\f\275\313X\177\337\342\332\342\r\002b\255\370S\200\027W\rC\270\002\207\273s"
+	.string	"\274X7\345N_\034\214E\353\201\207\263\257]:\221\323\274\321D\3107\344\201\327@\265\022\024\372\"tx\334m\255 \264\226\252q4\250\372a\325w&\272\262\350\377\315&-\364\347V\020R\017\211\177\300\312\342\242\324Xp\357\365\220\316\352!]\024\212\362r\206\376\234\017v+\351\315\004\377Z\266[\031\016\244\373\271L\246\306\221\327;\376\217\204X\213\341\344k\215\216\215 \256\263\261\026\016\206\242"
+	.string	"\256K"
+	.string	"\305\335\266\001\025h\261\316\001A\274\340w\214["
+	.string	"\2636s \363\351\035\305f\277\313]j\272\377\332\277\316s\034Zs\342?\275ot\260F\351.\024\314\345\030n\013A\263E\307\025:\313\243\243\205d\344\201d]\233\234|\001PI\241J\033^\227\374D\013\233rP\016v\245t\200\356\0217\246\235\t\276$5V\007\334\t=,>$\200>\213#5c\005K\344\237\343\216\375\237\201@\342\t\006\327\337sY\207\276\305\217\335\022F\273{\254\200D\221YH)\f\004;\360"
+	.ascii	"\231+\272W\005\325\022\372jZ\346\356\227Q\316\236\363PX\302_"
+	.ascii	"C]\274\250\367\335v\271\372\240\344\342\260$7\t\206,U\275H;`"
+	.ascii	"\b\006\204\265\354\212\343s\266<\315%\355\263>*qG\0274\354\240"
+	.ascii	"\023;\201\243\313y\233[d\345~)\206\203&!\301\340\270\274s\340"
+	.ascii	"\233\355\3438\313\250\021\322\005)\2551\215\005"
+	.text
+	.section	.gnu.lto_.pureconst.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375 n\355\002"
+	.string	"\342F\026\037pO\032\003\251\352\t\222\352\360\351\227\241\313q\325\3373\016eE\341#]"
+	.string	"n\235C8\335\001\016r}\\\036\3578\3077\256qe\034\343\027\315\342U\234\342\023M\342\021\207\370\303sx\303\031\276\320\024^\302Cx\0077x\005\215\240\t\034\005\024\001\264I\223\\\r\224R\241"
+	.text
+	.section	.gnu.lto_.ipa_modref.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\256\003\335\016"
+	.string	"\346\02194@\2172\034\3030\f\3030 \226\321u\f\243c\376C\345r\337V^\350?\354\037\250ht\203B3uY\257\224\267\302\334nm\240\272F\225\266Ik\245L\001&"
+	.string	"("
+	.string	"0"
+	.ascii	"\245vR\263\261\315mn\013\275\033(?e\300\330\217\312G\235\b\345"
+	.ascii	"\"\355\237\2712W3?\347\273\215\037L\360\232\227d\252\232\326"
+	.ascii	",\206\013O\276r>\216\352\324\\\202%\220\n\026x\017\346\275\367"
+	.ascii	"T<\225\237z\313I\332G:f*7u\006-\203[Q\212\320,V\273*'^\363yV"
+	.ascii	"\342\023\221\201x\266\260\254\250\244\240\234\230T\005\340\360"
+	.ascii	"\360\236\rL\225\f\377\3725g\2430\347l\264\003{@\036\220\250\343"
+	.ascii	"\326@\242\016\206\255B\006\371\335s\257\037\277G\007\307s\343"
+	.ascii	"\247\306\245\f\227f0\236\275\260\030\265\321&\177i\235\255\200"
+	.ascii	"\200\2501Y\305hH\232\264w`\002\231\262\262\016\021\220\0252\026"
+	.ascii	"\316l\222J\007\344\247B$\355\3426R,\005f\310\037\257\274\316"
+	.ascii	"\"\233\320\222\f\007\2623\340\321\031\325\025;\363\213\274\342"
+	.ascii	"\265\217\351u\361I\343\336#\301\206\211/\210+\343i\035\330\334"
+	.ascii	"\272\222QC\332d\001d\301hF'6\300gY\016St\211\215\0132\036\231"
+	.ascii	"\002$\244u8\022\377\252/HX$\355 \215\240\310\220\026_\026\344"
+	.ascii	"\366\255\314BI\202U\361\355\242CB\334\266^>\373x\200\272\016"
+	.ascii	"\246\321\323Zx\264\241Q6\233\022\271\200b\273D\210-\333\320K"
+	.ascii	"\007\240P\024\2266_2\002\222J)\027\311Z\016\241\204!(\254}\205"
+	.ascii	"\203\355\231\332\037\307\300\223\214\313\347\363E\312\232U(\336"
+	.ascii	"\332\300a\f\2043*D\"\211\264\235p0.\243Hl(\215\261\r\366 T\331"
+	.ascii	"Z\323\354\177\352\003}"
+	.text
+	.section	.gnu.lto_.lto.9f5c58040b7511eb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxConfig_Registry.99.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375 \233U\004"
+	.string	"\224\007b"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\203\334\221\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\374\006us\317\006uq"
+	.string	"\005\001\006'\001\006\205\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\005"
+	.ascii	"\314R0\345z\230\305S\324}\003(\002"
+	.text
+	.section	.gnu.lto_pgResetTemplate_blackboxConfig.101.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375 :\245\001"
+	.string	"\224\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\003\005\001\006'\001 ?\202\210\200(\177}\276\001{\275\001y\274\001w\273\001u\273\001"
+	.string	"\003"
+	.ascii	"@\210\224\241\007P\004"
+	.text
+	.section	.gnu.lto_blackboxHeader.102.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375 b\021\003"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"Q"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"OH Product:Blackbox flight data recorder by Nicholas Sherlock\nH Data version:2\n"
+	.text
+	.section	.gnu.lto_blackboxFieldHeaderNames.103.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\255\006"
+	.string	"t\013\265"
+	.string	""
+	.string	""
+	.string	"P"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\370\236\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'8\206\b{\370\366Qy\276\004\230\366\001}\301\003\330\365\001y\304\002\005\001'C\206\bw\365\001u\307'K\206\bs\330\364\001q\311\001"
+	.string	"?\202\210\2000o3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tencoding"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\npredictor"
+	.string	"\007signed"
+	.string	"\005name"
+	.string	"\013"
+	.string	"\016\253\3044\244\006\226"
+	.ascii	"\302A\246YI\346\323}\\I\341\323\351\006\345\036\006\212"
+	.text
+	.section	.gnu.lto_blackboxMainFields.104.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\224\f\345&"
+	.string	"\206;\333@@\246j\016\307\r4\322\326qC\277P\310_\020_Q]\234\265\361g\324\2102\206w\314>G\3552\367\333\320\311V\323Av\320\316/c\374\313\031d\234\247\0040.Z\0265\247\277\215\021\2332\221\310"
+	.string	"\317"
+	.string	"\304"
+	.ascii	"\376\303\2038\220\365\347\340\"\372B\245}\036\250\340Z\217\362"
+	.ascii	"\317\305\026\376\034\345\247\203/,\362\313O\027cH\224<\266rO"
+	.ascii	"Q\376:\021i\237N\251R\231\325wx\310\326\313\313og.e\250\263C"
+	.ascii	"6\241A\371\357\340v\rK@\310\026\024(\377]\354\033\374\274!;\016"
+	.ascii	".?\036\374H\034\306\366 ;\346\223\037\017\251\303\232\236<\371"
+	.ascii	"\363`\017gh\310\276\223\226?/\016&=\201-\307\310\220mV\226_\017"
+	.ascii	"\016\221\366\231t\276\260\235\276\252:\311\266\262\355dV\203"
+	.ascii	"\035;y\243\345 [L\307\216\016\323\342\332\032\021\226\225\300"
+	.ascii	"\314\334\240\374ii\275\335\325g\017\364\365\264\317\263\025\004"
+	.ascii	"\373D\333\004\320\017\202}\232j\246\311\004'\016\227=0n+i\237"
+	.ascii	"\002\334\372\254\376(n\332\323\266\376\022\036\220gm\375eL@\231"
+	.ascii	"\274\223\266\376X{\245}\026\260SG\352\311b\003dcR_\006\037\230"
+	.ascii	"#&\365e\261\023\030\333J\007SJ=Z\013\364\355\256\264O\004o\226"
+	.ascii	"Y\375\025\007\216\213O{\201\276<\322>\231\022\270\0326k`|Z\034"
+	.ascii	"\003}\257\322>\003(8cf\352\325\340\005c\304L\275Z\314\300\273"
+	.ascii	"|\3612\365l2\320\267F\332\247R\203\276\323\222e\370m2\322>\035"
+	.ascii	"\370\224\252^c[\231t*H\267\342Uf\374\233\212\2760\322>{4=\200"
+	.ascii	"\002\017\037.\206\320\304k\370qp\204N*I2\374\270\230\210\276"
+	.ascii	"+\322>%\030)\262\276\034<\301\207p\255/\027S\bN\374\211Gq)~\305"
+	.ascii	"\261\370\026\347\342`<\214\223\3612\216\306\323x\033w\343_\236"
+	.ascii	"t9\036\346t|\351en\346g\216\346j\216\307\3658\233\363\361\330"
+	.ascii	"\375\370\233\313\371\037\027\344sn\347\203\374\316\361\034\221"
+	.ascii	"'\362\276\020\316\310\0339\240\007\276\217\337\372 \377\376\220"
+	.ascii	"\357z#\177\344\225\200x\257\017Q\301/\266\327\230\374\022\024"
+	.ascii	"\256\247\002}[,\255\373$\217d\206\357\365W\021\"\331\367\342"
+	.ascii	"\177.!\331\371`\244\344\003\371\037\331\371\326\274\326\243\354"
+	.ascii	"}q\360\317Qv?8\351l\221_v\277\230\214\"\276\275\354\177\003<"
+	.ascii	"\357\220^\366\277\230\200\222\0232T(; \334e\251\216.;`\314\024"
+	.ascii	"\bP\366@8@2.\346U[tU#\321\215\302j[+\001&\221-\272\247\311\""
+	.ascii	"\312\304\211c1\207\0324i\\\251,\333B\r\215J\246{Ul\261\\\342"
+	.ascii	"\021\200\253R\341X2\335#\321US\020W\325H\304b\325\246Ue\223L"
+	.ascii	"\327\212DkTK\240f\361x4\236&\224\t\022\255Q\307\212\2326\334"
+	.ascii	"\266e]\f\207\252\222\271\336\240\"\322\b\232\306\326m\331\240"
+	.ascii	"9|\312\321RU\rU+*\341UQe\205C\343Q\370\024\301l\261\210F\241"
+	.ascii	"\333\266F\341\222\331\3420\022\217A\263\3474\235\256\323vZ\255"
+	.ascii	"\3614[\267u\237vk\271\376\323sM\327\205\332P\037jD\315\327}\315"
+	.ascii	"\250\0335`\007\272\017\337\362\327\205x\227\023\361#\216\304"
+	.ascii	"\2278\023\017\200\354\250\201lE\316Z\230\362)d\031\003 #\021"
+	.ascii	"\241\232\016\021@4e\214A\n\0233U\320\302f\225\227\262N\241\376"
+	.ascii	"p\212\352\227z\346\251\300\373\\\200^C\252\025\022\031\260\303"
+	.ascii	"\234\327*"
+	.string	"*\325\342\002\344u\221\236\337I\350xo\300\251K\202\216\016-j\325\3249h\374}\336\254{y\003\343,\273\207\327\200V\271B,fb\274D\224g\247Q\334\210E9C\341\n\205\002\261\236\226\320\344\313\207\216\r7_\326=\337\200\363]\007\335\244\235A%\335\305\340\300\316w\245\b\340\351\276\030\003\216\266\336\355\023\233\b\252>\355\271\347!Lz\317\355\274\310\267\262\343\300\340\027\260;!A\342A\303C\204h\271\257\206s\216\207\363w\0060\3313\274r\020\226\352\204)(S\374\327\001\255X\025\263Q\3379d\370n\031\376\tv\177\306\331W\335\003\252\367~o\031\327\205\242\333\007\016o\376\206\n\376\363\020\336\260\030\216[\324\373\002!\231\203\236\\\372\257\003\261=\313U\f*\345n&\036.u\371 \b\301\244\200\306\241\243F4\025\377\220\305\355B\036V+zj\342\216\261\b`\006\3071[4\247/s\347"
+	.string	"\025\202z\347"
+	.ascii	"-\342f\264\\\336a\260R\334R\343-\022Ur\034`\313\\\n\f0\321`\224"
+	.ascii	"\0229\326Tn\221a\177\355&\267\316\226\233\220\002"
+	.text
+	.section	.gnu.lto_blackboxSlowFields.105.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"}\t"
+	.string	"\304\017!\001"
+	.string	""
+	.string	"\202"
+	.string	"\005\001\006\035\001\007\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\271\232\361\311\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\274\001q\273\001\005\001\006\025\001\004\005\001'E\206\bo\330\316\004m\302\303\003\005\001'W\206\bk\230\316\004i\306\307\002\001\005\001'f\206\bg\230\315\004e\313\314\312r\206\bc\330\314\004a\316\317_3\320\0014\315\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\026rxFlightChannelsValid"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\021rxSignalReceived"
+	.string	"\016failsafePhase"
+	.string	"\013stateFlags"
+	.string	"\020fModeFlags"
+	.string	"\025"
+	.ascii	"\022\007\001\013\253\016l.\003\207\001\363@\346S\226\001#\300"
+	.ascii	"\3506\222Q\246e\300\013`4\310\030xV\225y\302*IA\031\276\330J"
+	.ascii	"i\020\003p"
+	.text
+	.section	.gnu.lto_blackboxMayEditConfig.130.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375 \375\275\006"
+	.string	"\222L.4Pm\222\016\244\034Q\241r\252.Y\027"
+	.string	"\206\020\330\276}\016\374y\177\366\355\337-\ruTp\343\tq\272\315\314\034\321D\2216^\324\2149\324h\255m\"S[\227\211+\303`a4\231\347\260\200ix\026\006\361.\003_\017\n\330\213\270.\354Y\266\354\210\004\037\004\335n\252\"bC\035\240~\024ds5\226\340\270j\245.\247*U\f\250\370\270\322o\036\207\027\337)\321\342w\243sw\022 \225hN2E\245\225$\241F8\376\316[>@\350\234u\313\020uC$\024\242\222\271=\304hV\227\335ztB1I\321F\236:\200\204\314\334i#\212\216\375\013~\203\237\024\n"
+	.ascii	"`\251'3 \f3\205\273\021\312\022\327\304\307\210\274\204\310\341"
+	.ascii	"\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_testBlackboxConditionUncached.132.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\244\t\365/"
+	.string	"ZR\004\022F`\034R:w\324}z\336S\260\274\030+\333\300\214\034\251\f\251Q'K\024\274\301}\330\364\277\241+\330S\302C\215\347k\250\341\213\034#\247\033Y\255\3162\177\221Y\256\027E\270\372\323\370\366\277\375\337H\354\2262\005\016\001\367"
+	.ascii	"\024\001\275\276o\355\367n\177\345\365U\265\317\273\375\313\353"
+	.ascii	"\367\355\263\001\336\003V7\227b\332\266\314\251]\013U\273|\375"
+	.ascii	"\347\3772\376\340\377\356\237\313\030\212\f6\213\3013\266SZK"
+	.ascii	"\266\266Ec\360\006>V\215\030he\225\307?+\253\377\357\340\201"
+	.ascii	"\214\263\214\306\305\354\341xS\252\325\265-\032\3225\302,\013"
+	.ascii	"\005%\201\220?G\037c\2218\024\006\201?_oUy\267\3313\024\013\021"
+	.ascii	"\237d\202:0\335\346\222J\030HI#\223x\365O\362\271v\344\261\331"
+	.ascii	"\261\225I}\306\330\350k\303\034+rT\026\023Y\254*\253\207h\252"
+	.ascii	"\232<#\261*\254\026\0221\223\004\213Ya@ \363\352\367\364u\303"
+	.ascii	"\027bm:\327\363\371\340U\251\362\0224\313\354 Z\315\340\001\235"
+	.ascii	"\321\212\023\264\242\321<>c\265j\016\264LZ$\307\030_$G\256\272"
+	.ascii	"\270\204\004\001\362c\nh%5\266\362\350t\210\341\"U_\303\356%"
+	.ascii	"\265m\373^Z\345\340\003\340\237\353\376G\370}M\001R\263\250+"
+	.ascii	"\374$\336\361\366-pyjJ3\251\236\236o_V\336E\365\364\302\376\233"
+	.ascii	"N4/\371\"\203H\241R\027\352\254\306l\006\255N\016\252\367\034"
+	.ascii	"\205a\251]6\3476@c\300\332!i\316j\220O\350\371\314\243\023\300"
+	.ascii	"\232B~\312\260\031~3\036\353\254\224\215\2119\217)\332Y)\033"
+	.ascii	"k;\207y\264\027\306m\350\345\374\345\321^\333\225\220\355\314"
+	.ascii	"%\210\265v\336\002|/[&\025\030\226s\226G\327\351\325\217\nWa"
+	.ascii	"+\217\372\330\347\333\320F\241ec\355\220\264\363\224G#lq\214"
+	.ascii	"\225U\216\362?JaHSH\333Bq\363\177\264\227-\002V\217\227\317\030"
+	.ascii	"H\206\215\331l\233}\367\243I\365u\376|\247\323i\230\337\255\027"
+	.ascii	"x\237\300\373F\357\013x\277\350}\242\367\207\336\027z?\350\375"
+	.string	"\344\373H6c>\376\372\306_\277\370\353\023\337\037\336\276\360\366\203\357\003}\375_\322*\251\234\317u\242\361\223\330HT\300=\\\300\305\342%*\016\205=\363\020\357V+\375\270mA3$[}WH'\355\315T\347i\322S,YK\371\020(\313\220\201\341'\tY(k\357\026\335u\r\373\244[\026\312\035O\331\263\nJJ+\253=<mR\263.\374\244 O\300E6\317\236\334oO\200\001\332\307\026\326\377\002\206\346\245\321E6\303\240SZ\270\337\260~\327\251a]\257\320-ZS~y\006\306\243\201\341\270\376\267`:\016G\\m\333J\350\300w<\370\332\266\205`\347\305\007\003n\274\\\254\254\256\227\341\272\314\212\323\351T\216\017\254\307\253\336u\215F\363,\307s.\316^\007\021\"\304\375\371\240BvE\206\373M\007\324w\235oU\001\367\272\200\211\327\306O\274\004\326\336u\2369\211U\304\313z\267"
+	.ascii	"(\001\230\006\351\241\362\322z\357u\222\0267\325y\376\213\340"
+	.ascii	"8K\276\266\235\202p~\303pF\234\275X=\223\t\365lbe\365\036\265"
+	.ascii	"M\003*\234\232Z4\225P\341\304\364;S\003\030N$N0\215@A\002IE\323"
+	.ascii	"\210\024HLO,\220\032\f\270\323\n\023OH-\234\234\236\220\202h"
+	.ascii	"Q\314k\357\3269N\217Y\020\362v\230\036\252d\362v\234\364\355"
+	.ascii	"\030t\201L,\312\247\317\320\355\3151\253\36246\223\205sx\250"
+	.ascii	"\212D\367\206\335y\013\026]\256C\007\024p\231H\035\252\237\321"
+	.ascii	"%:\347\266\370\204\356%\203\273\353\021\270G\034v\312\347-`A"
+	.ascii	"\316\233*\317ff\327\341\207\267\257\324Y\n?\211't\235g\341"
+	.string	"E^V~i\036\335C\003K\204\325\322ZY\025\336\236\0219\322\2535\334pL\240P\275'\bH\0017r\001\033\2157\231\f0\205n\007\320\322\032\274-\346\354\034KV\301\033!\016\271\002o\213\245\005\350\006^dV\030t\n\r7\\\026\364\347:\331\256\365w\203\256\n\306H\333`\273\272F/Y$l\022\366\253y\311~\255\254\376\330H\341\370I\307\243\376\331%,\223\346\345\320Ef\361\200J\2711\237\261\207\200\302\250aD\342\240S2$\")HR)t\240\002\221!\262\316\001\021\360D\246,\2320\005I\nm\007\240\243\004~g\333\t\352\030\022\317}gN\244\263NJ\237\023\0327-\363e@\316Q\2005H\341B`2\314\022\212J\261a\360\237fGq\034ir:^M\237\213\366H\002\376\2106\217\227\357#\026\0012\034*\257\007\357`v\266\263i\257\211P\t\247=\203\334Y\331\361\032"
+	.ascii	"<\250\316P\t\0040$0&b\007\005\026\263<\215\3135s\330\344\201"
+	.ascii	"\300\2534\001{\373q\2505a\332\203\260\202:\350\230 \f\216ADa"
+	.ascii	"f\217\374\332T\360\350<zN\331]$\337\215~\305\310\005\326\021"
+	.ascii	"\007\214\276\377K\325]A\f\212 \366\b\234\225\251\025#[\307\247"
+	.ascii	"\027\274\214\261(@\245\253\\Q\242E\361\275\004z0{\303\354|\267"
+	.ascii	"\256<\232o\336F\360\007\b(m\332r\307\020<D\234\261\220|\220\326"
+	.ascii	"m\336\230=\r\312\250\023\036\361\343\211l\220\257\346C\367\346"
+	.ascii	"-\276F\350\361(\267\341\3623OR\267\247(\260\022\216\033Fe<\246"
+	.ascii	"\266}{\"(\364\312f\262\322\317\274\256\351\221\r\247\r\307\007"
+	.ascii	"\317\020\236\004\324\371Y\201\276\215K(W\326\020KtY\200\030!"
+	.ascii	"\035\363T\007\351\320\t\221\024\216\t\2049\352\272\304b\323\202"
+	.ascii	"*\241\334J\366\260\2421\246\337\214&\nb\346\206\n"
+	.text
+	.section	.gnu.lto_blackboxBuildConditionCache.133.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\246\001\315\017"
+	.string	"\266\\fE"
+	.string	"\261&\035\003\303"
+	.string	"?\2311R\343\366\376wxg\3653 \332 \002n(\035\205\237\374\204\017k\223\254\350\265hs\251\022\234t)\":\257v\351\377\377s,\371\231\212\270\371\347\314-d\2731\022\262\367\2262\245R"
+	.string	"N"
+	.string	"T"
+	.string	"33T(^sNmCX\252\351\230\214p\325\344\333\\\300W\203\353N\307\240\272`\201#\352T\020AL\r\315\275kK\207R\371A\343\362\330\341P\324U\200\"sNP\227\322\275w\002_\213\353\\\256\230\2029\247\225\3534\334\331m\247l\037\260\037#\007\221\221\361\362\276\330\241\263n\t\325\021\252!T\357\252U\325\027\205\370\300\240\3203'\206\357g\272b\316\314Y\267?\302\367\f:\211\2270\235\245\222\2352d98/\2369\275\002\217\036e\217\"\007\221\217\360"
+	.string	"\344\343A6\3314\356\211\230X)\340\016\200\361\240\273{\325\016\271\006\256\373\232\357\005\313\017J\277\347\200Qq\002N\220\337\322\315NJ}\374\241r\355\222m\357\375\027tn\270R{\332\235\026\033,\354\256N\244o\3427'\276\214QR\364\334\243\237\"\037\261V\317\013\307\212~\266w\322]\331\001\013L6\0224i$a#q@\032y@\242\2314\030)\321H%\024m\024\342\r\002\203\222\026a\333J\032\310\233\337\027\333\346\231\216\016\327\312\242\260]9\001\027C\353\021\243n\t"
+	.ascii	"\342p\3169\345\256\256\"\345\206\026\343\371Z,\037P\372i\214"
+	.ascii	"\273\342\234\r\270\273q\257\342\020' @\002\243\220\252\033`\352"
+	.ascii	"\305\003{O+\332\036&\325\257\217\271\264\0020\327\342\330\303"
+	.ascii	"\026K\260\240\344\022n\034\262\030\212\235\302\004\203-,!\020"
+	.ascii	"k\317\214>\253\232\r,k\305\213\235\202Z_,\240\215\254\244\026"
+	.ascii	"\032\332B\342\352\364\323Dw\f\205\nQ|\313\246cu\330\264\337\021"
+	.ascii	"\314\023"
+	.text
+	.section	.gnu.lto_writeIntraframe.136.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\233\021EI"
+	.ascii	"\312x8\032=@\346Q\007\360\303\253\002\333&\324\361\320\f\020"
+	.ascii	"G\2704U\n\307\263,\211+\305^\370\222<\367\004\304\t\266\203;"
+	.ascii	"=#\337}\212\363\223m\212v9 \201\004R\320 \333\354\336;\245\224"
+	.ascii	"\002\221\001q\001\244\001\316\301\325\031\310:\377~\316,\353"
+	.ascii	"\274\256"
+	.string	"\316\352\352\374\252\263\253\316\315\203\213.*\225\033\223\347\367\240Wm\272\351\352\255va:\257\273Ow\\w\234V\231\033\020\017\243\317\2726\227\376\370\341\013\314Jj\360x\330\207\371\364e\273}\344\322\030\276G\367^\020\300;:~\354\356\352\360\374\320\365\334$\347\024<\214\230w\034\325\331\232\344\247\345\364\034\346!\007i9\376\265<\227\234m\356\275\303^\231\2030\017{\025\366\233\216\362\220\033\332p\332\2163D\275L\350e#F\227@\241\026\200\2752\024\330m\332M\333qD\274\320\240w\355'}\326i\323\240W\026\003\366\352\325Wl\257jW\261\275r\313\354H\313\310=\2130\206.M\316\245{o\361\265\374~Y\374\255B\233\331o\233kK+\013\353\312\252\212jJ*\212\b\3654\024\006\201?vU\337[\356h\027\210Bw\326\\kzk\r\234k\251@CM\324\250\025\300xV\026\2660\215\365\323"
+	.ascii	"\250\r<\353\332\300]a\013\323W_\332\352\213\027\257\352\322T"
+	.ascii	"]\270\370\324[K\275m\361\250g\023\237N\207\242\322OT\246\370"
+	.ascii	"PJ\013\245D\361 \201+l\315\006\266\241&\315\2166\0012M\230\376"
+	.ascii	"S\245\356\275\304\2654\325\201'YC:+\034\263\354\365I\253*\203"
+	.ascii	"Gz*\021\327\214\250Wj`\224\30354\377\306k\006LJ\321\275;k\313"
+	.ascii	"\366\237\206{/\273r\215\255\271\253\231\035\310\314!\230\245"
+	.ascii	"0\004L\271\350\336\234MH\237\362\372\354w\243\264NR\305_\277"
+	.ascii	"\361\032\270\027e\262\227t\"\373\325G-\\\367\251\237%eBG\271"
+	.ascii	",\340a\375"
+	.string	"\317\334\272i\337\f\253\030a\364C\311\274\241\371\306\200\275\002\357\275\377Y\322%S\345\322\231C'\"\341\023\270\367Z4\017b[\274\fa{\365\327r\364'\256\313\373\231E\214\360ji\037\"\301\355\205M\240@\301\366\332\257\345\250\311\274r\266\323\314\207eV\261\302[\311\013\244g\364\320\376\f\254\t\r\301\220\350\336[\201[P\017b\301\355\245Wn\361\302[\371\202\355\025\303\377\254\314\321s\272\261+\342Sf(\322\337\r\372X\230Ug\243\352\\\246:\357P\235u\250\3169Tg\034\252\363\r\325\331\206\352\\Cu\246\241:\317P\235e\250\316d\252s\f\030\252\363\213\316kv\301:\253\350\270\346\024\252\363\t\325\271\204\352<Bu\376 t\036\3538\315\030:\257\331A\367i.\272\263X\224sX\2243\030\321\271\001\321\231\001\321\371\213\350\274\300\235\025\260\316\tXg\004A\347\003\254\263\001\326\271@\320\231"
+	.string	"\353\354\025t\036"
+	.ascii	"\345,@u\016\360\344\f\340\311\271\353\311\231+\350\274\005t\326"
+	.ascii	"\032:g\r\235\261T\347+\241\263\025\353\\5t\246b\235\247Tg)\241"
+	.ascii	"s\224\320\231(t\206\002:?\251\316\303\240\263\020\030;2\365\275"
+	.ascii	":~\307\032\035\337u\252\262 \244Is4Y\337\325F\305\222rI\225\303"
+	.ascii	"\022\216\317Q\006\307\367\035\254\241\030$\036\006\353\271\332"
+	.ascii	"\250\354)\227SWV\177\365=\327&q/-\024\253\357\272&#LqR7*\371"
+	.ascii	"\265\3617\336l|\343\211\252Z\342Y\252\376A\223\020\034\261F\237"
+	.ascii	"\024\215\257\321F\343\233\016\212\nB\225\033j\376l\327\250\276"
+	.ascii	"\253M"
+	.string	"\n\035\345\362i\006\037P\306\317\230\"\343\273\216\207S\255\023o\266e\236\022\025\247\376A\223\017\2468!\331\"+\f\215\361d\313\030\337v\301.\227\032{\251\251\271\264NE\246\323V\300F\375\330\263\2471\211\017\365Q\277\305))\006\351\323'\316\326B!~\313)\212s5o\322Bi\266RZ)l\257P\317\3065\363\3001\201\357F\251_8S\211\264\220\327\355\005\354\207\177\341J>|\337\365\027\0349,N7L\365\351\b\025Ok\337\236\236\253\215\331\247\\\016\205?\37401Gk\237\024\2648\262}\023~\017j\312\201\263+zX\007\333Z7\277F-=m\337\202\317\325\246\266\007\334\324\2455\001\277\243\255B\252\226G\271\374\275\033\377\362V\030\377\213\274A\027?IX\027\277\343\242\355\367\3363\366\335\212\017\343\243\332\230\020\362\365\313\177a\3321U\372R[\206\310\355\231\266$\341\367\027\230\2250e"
+	.ascii	"\243t\252\357\306$\330\021?E\t\2333I\322Eh\236\211O|\211\037"
+	.ascii	"\361\235\306D\372tR\233\246\304'xc\252\370\023\337\354\203\265"
+	.ascii	"\212\357?\275\222\t@\332G\331\f3\263\037cQ>\312~\030\307\314"
+	.ascii	"\214>\214;\204L&\006\304\030#\007\031\f\0351\212e7`\354(\222"
+	.ascii	"\231\365(\212\r`#\217\031fE\037F\243Yq\b-\322\217\205;\354\251"
+	.ascii	"\303\364\250\310#\271\373\310\307\262C\362HG\276F\307\276>\266"
+	.ascii	"W!Q\350\324L\022\373>Ga"
+	.string	"\317\316\210O\354;i\006\020\013\366ad\032<\3303\370\006\277\305'i\367\365\f^\253Q\322\331J\232\003\261\013\376\353;\031\b\211\350H\txo\221V\262K\375\320\021\022\037%\035)q\037)\261\013>K\372\206\227D\203tB^H\317\211\3107:\312H\n\336\005\r\301\332\022\350\345(#\345\r\001\372\037\005\337d\242\320\201c\256\004>\260 \370\004\337s\007\036\201\357q>GK~\267\366z\340;/\212\034\234\335\226q\nG-{c]\331\367\034\255w\343\340\",\027\377\213\256\300\332A\212w\020H\275\367\336,\007\357\342\253\242O\274\244\363\313\r\024x\2577\360=\227\024C\340\013|\247u\232k\237}\207\247E\366\034\201\357;Ev\003\336\353\273u\372\235\3669\301Nq\3007\240^\363\232\2340\375C\357=\303\022\360)\2769\245u\032s\346\243\246#'o\245\200\177\275=Iz\310?\343.\017"
+	.ascii	"\340\003|Xr\320s=\200\357\244\030\244\234\313\341<\307)\3231"
+	.ascii	"\035\333k\327\007\267\236\353YN\311G`\036\247}J8s8-Rl\353\273"
+	.ascii	"O\323\022\234\335\225\262\265\342\214F\334M\373\246\365]mN<\345"
+	.ascii	"\322*\201`\250q4%\021S\246DDD\222$\311\260\006\261\005\204\030"
+	.ascii	"\306\230\274\016\021\340 s\216!\"\232$)t\372M\002\023~^1\345"
+	.ascii	"\247\224c\356\365D\2475\320\374w\336\250\377\304\003f\360L\366"
+	.ascii	"\342&4\302\201ZP\205p\265\0169\241(\017Q\236\007\240\3343\247"
+	.ascii	"\326\236\267#\t\027(<,HVg\301\032<\226\274\201*u\361\314\354"
+	.ascii	"\024\357Ve\341;\032\356\023y#\241\033\023\330\366\313\n\220\243"
+	.ascii	"\250\357\007\250{\365\261&\316\37731C\006^\264\337\365\032r\t"
+	.ascii	"\013p\020h#\313\364\202\232\240\353o\351\322\271 \021\005\356"
+	.ascii	"\357-\335\025\274\345\265\313\251N2\307\354\370e)M\304?\225\001"
+	.ascii	"\022\023Q~\337\203_\004\204\024\027\252_\224\271.AW3\305\341"
+	.ascii	"\347\316\242\021\373-\002\215\356\306f|\201d\327\221\224\266"
+	.ascii	"\001\312c/#$\263\365\204I'Q\264e\376o.\241\300\350\243\210\244"
+	.ascii	"-\324\347F(Uq\326N\242&r\272\226\344\342@E\203T\371\276}r\362"
+	.ascii	"\211h{\300\350\250?\224\240\\i.\343?\252'\310h\242J\375\211A"
+	.ascii	"Jj\314j<\276!4"
+	.ascii	"EU\001\207|\317\3777\204\ft\250\362\256\333\361P\342\205\240"
+	.ascii	"A\024\207l\005\233\037q\235\217\001\364\270\350\346P\340!E\320"
+	.ascii	"1Q\177\330e\330\371\240\271\310\026\033a@i5:\327C\373\304y\207"
+	.ascii	"_\314r\2146`\224\254\261\017\306\251\374\270\205_#\242PX3!\310"
+	.ascii	"\371\242\373\311\335\373s\221\305d\303\251\027\3311P\307\362"
+	.ascii	"Ob\271b\310\031j\260\035\217\217\327\033\203\350\311\345\307"
+	.ascii	"+3#\254_\206\200f\265\027?\002\317\373\316F\262!'\217#D\"\224"
+	.ascii	"=\274\230\326\210h5Q7S\364 \224\243nw\305\364\367\022\2049\026"
+	.ascii	"Fl\342\340\246\240[qZ!\303M\263\264\001\345T\032\210\bf\035\030"
+	.ascii	">&\237\003M/h\305%\"\277\320\344\001bp\333o\325\312\266\202\203"
+	.ascii	"\315\245\356\235\243\377\264\2212\324oNm\001a6\350Q%0\254B{\211"
+	.ascii	"\013\177\355\034rhW\320\307<`oC|@\375\206q\352\332\301\267O\007"
+	.ascii	"\233\235;\2745\236\203\277\276\244\201\204\251?7G\320f\206\346"
+	.ascii	"\3112k\202(\230S\314\341\271\311o,\355\343\365`\314?\001\315"
+	.ascii	"/vAA\013\003\314&_\372\034:\022pJ\026k\313,\025H\257\224\211"
+	.ascii	"\026\327\310,\025\226\2602\225\017\302\020)\213>f\303,P\346\\"
+	.ascii	"\235^\332\367\007"
+	.text
+	.section	.gnu.lto_blackboxWriteMainStateArrayUsingAveragePredictor.137.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`;\003M\027"
+	.string	"\026\355\230H\320\026Q:\344\345T\"\342R\020N\310\303:7\341\013\213 P\210\3439!\274\030\254Ds\210d\024\033\212\3725"
+	.string	"\262\311\003a\007\272\327\017\256Rk\225\227\003\361\303\265\233\340\342\363KRY\024\377T|B\310&r\247\024\202"
+	.string	"z"
+	.string	"\207"
+	.string	"\265V\003\247f\020\236^d\337\\,\bO\375i\377\305a\274\336\343\235W\25275Y\216Z+\002\273\204\247\005\316\362\235z\017\360\235\372e\0339\305*,\001O\210\r3\230\324ZS+\302`Y\226\345\275\333\355\315\327\251\267\363\345\307\270W#\001D6\203\235z`\314\303\t\322,\346\2758\t\322=\367\2113\263\231\236\n\020\337\347Nk\266#\262\031\210OPA\255\325S6\373p\177\267\215\3016\214\275\253\272\232Y\3327\330\334\035\373/#\234\004yul\324}\356\323o\277"
+	.ascii	"o\272\345=?\313q\267\351\323+\237.\201\323*\3374\351\323\243"
+	.ascii	"O\247\200\323\242o\032\300\247C\340t\370M\203t\372\243\323t\247"
+	.ascii	"\275\235^oz\356\364\007\214N\020\231\335\366S\253\207\362I\r"
+	.ascii	"Bu(\356\363\343\354\317\360\177,\362\321\320A\207\007\205\203"
+	.ascii	"\3602\374\234E\247\266q\336\275~\250\347\300\204\307DP,\216\343"
+	.ascii	"\243=\355\004\"]\244lhG\353A!sD\2332A\344-\200\245J\302\r\355"
+	.ascii	"\277\243a\205%\374\326w\032\356qh-\273\013\206H\026\337\316m"
+	.ascii	"YO2g\336>>\272\337\236\\a3K\233\226\356\177\016#\304V\356\376"
+	.ascii	"\360\210\315\3669\256\3231\357\335\207\332\365\320!\370\r\240"
+	.ascii	"\335'\241\355Z\350Xv\356,\262!J\315,\017\334F\206\260\326\372"
+	.ascii	"\342\323x\r\n~\211S[\020\347e\342w\372=\022\332\216&\001\243"
+	.ascii	"\350R\261 \254F\232\020\353\256\231\013\242\212f\030EW\213\325"
+	.ascii	"`\306\201k\325\212\020\341\3018\306\230\254r\301 \312PP\305T"
+	.ascii	"\220I\315\260b,\244Tc+\345B\300\"\315jL\271DqL\211n\365\253\023"
+	.ascii	"\343\3470dI\220\232\265\241\273\343\020mQ\273C\246\201\233\026"
+	.ascii	"G\300\232\366=\270\0377\323\311\275Zk\365v\307\264\250}\3560"
+	.ascii	"5\333\0212\2074W\326^I\230\227\271\300\315\302|\332\322\256\354"
+	.ascii	"\201\310\024*[\222Q\371\222\326$\204\004\01629 \200\002\231B"
+	.ascii	"\242\007\340\353\305\002\377\356@\353@\345[\253\247\221B\032"
+	.ascii	"\034c\357\037\311\006\326eD\371>Z$5\3575\224\035\315A2\263\331"
+	.ascii	"\020k\274\251\315\347'F[\267\367d.l\375\261\r=Z\254\260\245\372"
+	.ascii	"\005\353\213\202\357\244\350\366\030\331\315\360\325.\374\310"
+	.ascii	"\336?vL\351e\367R\351]\304\304\357\201\032\356\222\310\204\375"
+	.ascii	"\220j\224\306\365u\0311_\007\246\274\367\022Y\344\205\3056\036"
+	.ascii	"0\021\323\325\237"
+	.text
+	.section	.gnu.lto_writeInterframe.138.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375` \027\355`"
+	.string	"\312\236\314\"J0\214[\031\016\357N\257l\266\273\221\031\253\271\330oa\224\335\312\005,\352\231A@\231"
+	.ascii	"\216\226\261\200'=\r\355\201Y\245\037\2110\200\274\347\247\f"
+	.ascii	"\307\364\364\024R@d\333\n\034"
+	.string	"\033\"\324\034d;`\323\020D\b\331{K\231d\n\002\371\001#\002\274K)\257R\312[a\310\233\224\362\"\ty\217\204\274FB^\243\220\267\230\362\026\241\274D\224w\330\274B\2247EyQ\224\367l\336Fy\271y\177,K<\270b\345\353i\205\326\365J\023\321\272\207\336\211y\337\317\367\357\375m?\233?\356w\363\323}\270{\277)\31455{\266\270ghmLO\236u1\326<\3637{<[\3343d&\021\326PO\216\035;t\352@\335\t\243\243wFN\227\021\370\356~\007pYv\273\303\331-\256\223\277\331\376\342\353\262D\263\256k\361\350\256\223\335\342\321\342\325\374\355r\027\341u[\244{2\003)E\207\0315j\353\352\006\301p\356!\250w\363$i\315\263\376\353\317\314\034\340\272\272-0<\272n\3036\207S\037\007\345\\\347N3v\324\016\030\036e)\267\257Q\317\246\2020Bf\362"
+	.string	"\327\325\213\306\360\350\327\244=\232\247Q\337\266x_\301\326K\341[K\003\\\327u\352\350\226\030\036\225:Sz\364\374RzT\335\375\343\264\265f\2450\223\206\013\316\320\272\256U\355\245\273\223\316\363$n\377t\373\246\247z(\fONM\027\230,,)UHB\212:22\026\213\210Ca\212\236\315\352\276\356\035\312\352\262\016\005\3021\200\360\001?\261\335\211\355\f7\211\371\205\347\361\022\023\206\231\300\334\002\230/\274\224v\2454\016\270\302\231d\302/\003N\022\316\330"
+	.string	"\214y\244k1\037\345w\016y\274\320\320\360\321\362FK\f\330\310\005\254\354\305<^e\247T\035\031\027\235\306\2762c\317\3435v\242\020\243\353\373\236s \343\025\306D\016\033\200\211}(\234\261\347\347\332\330\030.`b\027\236I\353\272\036}q\235&\270\353\013\311i\321\030-G\263\374<G"
+	.ascii	"\306A\341\350k\353d\272\022FY\374\212\302}<\03716\370\346\347"
+	.ascii	"\346K\313Y8c]\327e\345\027\3307\303wy\307\3566\331eR \235\324"
+	.ascii	"\367\3035\230t\243\221\372x>\364{\023S(\271Dr\0311\272@\275 "
+	.ascii	"X\203\031u\355\316^\024\243>\302\002v\344\245d\310\306W\214Z"
+	.ascii	"\210\2360\205:0\325=0\3254\252\2328{[\235\265\033\230\352\305"
+	.ascii	"6\366\337\\\256\006\323\337\215\034E\r\270:k\227\247H\23136\212"
+	.ascii	"\247\324\302I%\312\335\035\274\325#\360\030Wl!z\3004\225Z\236"
+	.ascii	"\270\250w\r@@\212\330EM\30558\354\264\211\r\025\230\\\262V\222"
+	.ascii	"a?\020\355\203\2746\371\250\260\017\210\317\035\332\334i\013"
+	.ascii	"\023%\325\220\334\\>\220\364l\264\235\362\222d\220\207$8\373"
+	.ascii	"s\370\b\032\352\276\034\264\004\216\002\220\341\272\256+\366"
+	.ascii	"\201"
+	.string	"\024,0\374\362$=\312\375\002\255m\320\223\241\240\367\353\214\371Y\342\205\363\305Kw\031p\200\257\334\020&d\331\213\322YT\377\363\344\005\323O\003\2155\306\307F\342&<\201\361\267\256k\213=\237\367y`\377\345\350\006\031\302W\016I\2172\320\302-x\210\226i\356\264\270\271\353\206\344>\353+#\006g\273\313.\330\227\327\025+U\250t)\247|\357{)(\357\223\337Jy\241\240\274NP\336&JP\336$VH\214\024Ay#\270\233o\003\247\3732\360\276\357\017\037=x\274\355\273\343m_\035o\373\3468\337\027\307\367\2767\232\327\206\021o\r#\336\002\214\2744\214\2743\214\2742\214\2741\232\027F\363\276Hy\tHy]\020y\007Hy[\020yY\244\274+\212\274*R\336\024)/\212\"^\001R\336\023E\274&R\336\252\224\267D\312K\225\362\222Hy\247\210\274#R^\021D\336\020)o"
+	.string	")/\210\224\367C\312\353!\345\005\240\210\267C\312\313\241\210W*\345\335\220\362j \362fHy\243\210\274P)/\206\224\367\211\310\353\224\3626\021y/\by\231\204\274\026\322L(\336T\213h\022\355\224hG\033\35130\271\034\321Sx\252\331\365FP\263\310\031\321\327\343s\027\242E\360\361\235jv8,\034G\315\002\343/D\337\3578\264\220\361\261]\214\256\357\fR\237\355\243\272\313Y\262P\030\243\"\275\2471G\353P\002Z3T\366\353\034\005\320\200 \372C\007\320OpI5\022\317\321E\372\304K.\221uj\032\210\376\034\264\266\013X\0045\355C_\217,\317\250\317\366C2\360O\221\304\215q\201mES\317\321]S\376\254\333\224\276\235\243araH\243\207>\003\225\202"
+	.ascii	"h\016\355\241\237\002\223j\310\006\240/\027\327\241\257\207\326"
+	.ascii	"&\325\034\032\205\023c8\225lN\252S0\2629lm(\304\350\376\212}"
+	.ascii	"\266\\\366'9\254\212\t[\244\326\207H#\350'\331D\320\327\273\210"
+	.ascii	"5m\272,\323\204iq\363M\305 \016\b\326\220\201\272\366\272\237"
+	.ascii	"\371GM\321\360[\335}\204S\307\321]8\316u]W\"\216\376V#\231\261"
+	.ascii	"\315I.7\274\251iM\255\241\243zC\013\3612\264\206\017T\263\343"
+	.ascii	"\261\32113\364\361\240:jM5c\301\334\302\036\224\200\352\333!"
+	.ascii	"{\303\206\241/\247\246!q\236RP75\206N\363\222jN\375TF5\373\033"
+	.ascii	"&\031\325K\233?\247\376\033\264\273\013\335\324\347\032\024\304"
+	.ascii	"j\252Y\325\031\213Q\275\200\270\320\337s\264\215\254\256\307"
+	.ascii	"\f\377\210\355mYh&4&\323\006h|\026g\241_\367a\036=g\356"
+	.string	"(\265\b\373l\205u\320K\351\356\303S\277\321]moo1\272\2765i\237\335\350Ki$31\200\030}\342%\245\256\320K}?I5$\0275\355y\314-\267\373S\352\347\241\035\tq\006jZ\214U\301\360R\005\263B?\205\261\246\340\235\326\356Q\363*s\002I\223tY\0255k\006\351\351\023\205SX'\335\244\223\364\271\302\220cL\006d\377eU1\352\030\276R\035\223\036m\322 \320\302\240\264\223~\2238\224\276\236\243d\302\332\274\371\305!B\n\022\034\313\212\310\222%Mj a1\t\342\303\bA\312$\b\326\021\"6\260\254\212\\%\301\"\302\344\b\313\252\311U\r\b\216\020)\202\343H\020\253\253\"XI\256\224vH\t\t\256\204\030\031\022\344\210\220*\253\"A\220T\rY\302\244\252\304\206\275JBdI\025\326\325\325\222\252\242\233\326\273\313\346\300\242&\b\250\325\310\255\200\315\271\256\\d"
+	.string	"\2629\006J\267\305z\354\030\3508\350\030\030\230\036\235\240\254\356\f!\033}\201\226\032\275m\001\026\033\375d\007%\244\005t\215~J\224$C\243\013\350\031M\243\237\360\222w2zF;\371I.O\345k'\215\3212\372I;\310\256r<4\\W\255+\267\273\232\312\261\320\356Q\360x\350x(\215\321MzB\220Kz"
+	.ascii	"\243\247H!\321\311\336\202!x\327\203\215|r\201\331ZpJA\315/\372"
+	.ascii	"d\312\344\330\240\bp\321-\232\200~]Rm\200v\201H5\273\035\363"
+	.ascii	"\320\261)\3677@\337\216E\267\340B,\250\232\255\370;&bC\307f\025"
+	.ascii	"\312\242_\247\f\216\355N\213\233\030\372l\301\254p9\301\b}\365"
+	.ascii	"\341\254\350\245#\245\242W4\277\355\221\033\224\301\273*R\335"
+	.ascii	"\342+U\364\363\342"
+	.string	"\232\200\202\200\310\316zz\301\214\346\007\374\347"
+	.string	"\035\332s\352\263\365jf}\365\362s\245\177\327\344\306\030\327\324@\020p\253\2638\354Q\373\272\320\207\313\316\202\222\336s\251G\373\2602\270>Dj\345\357U\372#\274`\252o\033u\212\332\025\250\003\373h\rU"
+	.ascii	"\225\300\224\342\017E\237\350\024\375\004"
+	.string	"\327\243\225\b\320(\372x\004\350\3171\321'\256\360\035\225l\316D\237\370\272\303\\\246\261\320gE\3145;.;%\253\336\263\002\217\356A%\005^\251\364\345,U\365)\321T]\325Nu<\332\252\204\270\022};>mZ_L\302\034\025\252G\346'\250\224\264\243\367<\322\321<\272\006%u\365\351T\350\263%\216!!i\246d\241\301\250\251\377\350\256\373\375^\222\202V\220\214\364\236Q:z\307\217\376\237\323\365\225\321 \251\317~4\222V2\003\241\231\\\236\020\201\325\250a<\005\025S\206FD$I\222Bs\261\005\204\030\307\034;n\021\320$s\216!\032!IR\220\fs\360\201\355\\W\262?\230\372\371\224ux\335\026O\260\313?\213Ui\300\322\310\260\214M\365\017\264\357\266\220\016\222[\262\006^\306*\367\356\211\241\200\033.l\235Z\200\212>Q\177\2510J\202\240\315]4\371\250k\255*\227\254"
+	.string	"S\3114\213\235\312\316\307\025*{\277\313\374:+\345\344\253\305)\336U\251\356*kC\276\300\226\322\322d\346\340\241\201@9\243\334\253\342`l6\250\021(}\t\343\331\254\345]({\330\276C)c\231\301\350\220\231K@E\266|b\036S<\203\3345\240J\322\375\355C\233\035$\025\252\r\363;\321Q\242\\\264X\245\250\345\262oO\222P\216\206\0035+q+\213.\206P..\005\205\272:~E\342\262"
+	.string	",\257\250\361\317\220zZ\202aN \226\361\236\320\270\372DFX\001M{h\2478\211\322\016Q\326\255\331\202\262\3715\202\304c\325\206\306\261"
+	.string	"\256\005\320\300\204\242\237\320I\026z\311\347Z\321s?$\246f\205\205^}ny1?\244\364\036\036\274\274\265\316\267k\341.\023H\035Z\0341\022\262\340:79=KI#\367D\354\202\266ic;\"\274\n\2617c\340\006i\361/\267\312\311\343\327\343j\211\264\023'\353\021\240\304\013-\2203\360\344\373-\212\t\030\360\021Z6\255_\024D?\327M\022\314\277\377"
+	.string	"\217\365\250`W\234\024hJ%\334\224k\207\371\347\270\207\367\035Mv`\204q@\200S\225\372\323\271\221(e5\304\232\036n\332\303\333\205\2449h\272\262\201x`U\313\221Mh\314{\007\252\022rfVF\346\222\213\210[@|#"
+	.string	"\027\034;f\004\017^\r\024M;,s\315\"\205I\265\264\326Pa+E\347\234xi\001+\316C\310\225x\250>\203\034\311\343\264\030p\023\266X\275\341)B\036\b\374\340\324\317_}\221.\262y\314up\206\022&\202\026\261\253\352\341\257\300x\3260\323H\"-2\212!\221\330\354D\216\302`L\227\335\321\372j\277\237\334\354\315!\022C\b\344\233\364\352\316-!\302\200\332\246\324\312\251\251O\220 \241T\2773\017\362\223W\362\022\270\262:\356\n\2255n\336"
+	.string	"\222\321jD\273\t\220 \200l\340R\230+O\375S\275B\021I\262\2350\212\030\375v\304\371\"\351W>\020x\250:\200\034\226\215\310\232$6\306\327 \323\001\262!\2462\354q\3414\234}\325v\320X-\2707FY*\231;#\372\007\221u*)\272&\0225\207\374\210'L\"\347\300\232\232\202\246\005\t\255\346\"\271\231\3223`\251\204e\374\302\006\372\216\331\301\260\365rt\034\205\373\202\267n\016m\213\267\343\032\2223\333\375\264\303\377\217\253\343\305f"
+	.ascii	"E&\331\tL\303S\"\260\274\322\t\372\351\233O\002\030+\006\306"
+	.ascii	"|#al\007\322~\f\257\013`\352\221a>\205\326+$oM\305:\326i7E\307"
+	.ascii	"\204\334T\031\354\201-/D)\230\212Q\371\315\222L\n\1770\364\350"
+	.ascii	"\030>\233\336\234:\030a\024\r\266*\031\301b=\323y\336q\005\305"
+	.ascii	"S\335\177\301\337\037"
+	.text
+	.section	.gnu.lto_writeSlowFrame.139.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\375\001\025\020"
+	.string	"V\235gE\320\026Q:\306\361D\213-\335\026{\236\256\206\3035\344\257\3559 g@\230\037\033fSM\305+8\252\217q\252UkU:\305\260^\301w\342d\372\2418x\024\237\007p\t\262\232]\275\017\\\362\311\336R\246\024P"
+	.string	"L"
+	.string	"X"
+	.string	"\265\350\343\305a\277\375\307\214\342\313\370\f\325a4pw\340\313E\316\256\t\225G\207\272G\327n\200{\004p\002\334\243Uv\222\003$v\305\362Ja\243\323dw=eq\325S\345?v\320\307Z=?\022v\327\371\261N\334z\333\rl\263\330y\023\3211\245\374\367\350\227\270\307k\202 B`5\331\343.\375\343\236q\366\007T\376s\212\215V\033\241+[\266J]a\037\356\356Zql\230\006\305t\007\323\237\230\346`:j\032fZ5\235\231~\001\0010\\\254\347\270\261[\242\307\311\006\261S\220r\267\013\237\001\351x>+\234~\224\233ax\217\031\036\234\246ZF^\260\250\266\035<\346\022"
+	.ascii	"\311\356B\370\355\263A\215\372\f\337\241\003j\252U\204GSUWl\236"
+	.ascii	"\330\032\216c\303N\352sZ\264\327\200\274\332\242\021\003\223"
+	.ascii	"\256\303\241\333\335\007~\215\333\200\361]\017(\322\214\214("
+	.ascii	"\004\347Q(ez\211\031\211d^\274\0160\242\2227:\241\274\320\002"
+	.ascii	"\233<\220N\036\b\223\351\344\241\310\366p\025\247[\202\242V\243"
+	.ascii	"\"L\003wUDPB#{\254r\177\310\211\270\370.Ohi\341\036\177\323:"
+	.ascii	"\022\203\t\202\274\3541\n\nZ|v\005\013)\266[\r\244\264|* \320"
+	.ascii	"\002\221\031\\\007\340\326\033CG\030\330\221<\225Dl\210\334\354"
+	.ascii	"\214\267\003EL#\221\221\277\031\252\223e\"+a&\340\244D\306v\013"
+	.ascii	"\303\204\034\002\366\234\320\313j\314\031\331U\016\223\365~."
+	.ascii	"X d\355\336\304\3054X\201v\375\322\b\b\033\005C\022\177\243\361"
+	.ascii	"\316\351/c\332\002\224y\321f2"
+	.text
+	.section	.gnu.lto_loadSlowState.140.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`H\001E\r"
+	.string	"&\031YC\020q\233\016K-\n\224\3040A\235r\200\353\375\216\332@ \023\201\324!]{\267\001\001S-\020 l\243\272\020\2303Pa\033\302{\263\353c\220\002@\005\030\002\321P\263\200\364&~\276\323!{K\231RE"
+	.string	"A"
+	.string	"H"
+	.string	"~\212\253\320\256Br\315.\tf\306\256\227\300\234\352\321\3367\324cu\002\324\2435\033G\001\016\273-H\211a\302\242cw-%q\355\251\371_\361"
+	.string	"\334h{\002h\260\273Nn\364\341\326\333>`[\201\375\032\001\335=\f\003\202\022\273\242s\217~H/\242\344\242\003\bQ\236loK\035a\037\356\356ZIvLWW\371)\230\2160\r3\255\232\316L_3"
+	.string	"\245\033\275\345\264\353\341\304cM\321\305D\306\366\323\001\252\366\204\267\244\252j\311\244\207&\355\n\235<\227\252/\337\tS\211n\276\332\327a|T\273\313\300\177\221}\004\300t$\\\f\313[|\370\235A@\t\242\036\257\024B\334\330qR\251\277\222\211\370]\3328\371\312Yh\360\003#XH\b\372\342l\300<\240\253\023\342\261,\200tD\254+\013Y\034\003\306.|2+\003\206eV\306\333\303U\222\253\017\205I\244%\216j;\270\013,=\210\n_\276\024\2506\204\313\030Q\032\\\314&\355\b\022\362\034T\315\361\241\004\033"
+	.string	"`\251'\023Z\373\002\303\005\013P\004\300"
+	.ascii	"\203@\210Ze\006\242\302\265E\370\260\204\342\370\032\205b\205"
+	.ascii	"\200\270A\005l\325\360[\215\307U|\226\336\2100V=\030p\t\241Y"
+	.ascii	"M\001wy\321N2"
+	.text
+	.section	.gnu.lto_writeSlowFrameIfNeeded.141.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\342\0025\025"
+	.string	"\226\345\205I\320\362&\035\022\301\025\241b\322\230{\2442\231\nPe\314\265q\274\211\341\342\016,\200\204\361C|\265\3130\332,\231\303\273\350s\3701\371\332\226\"\266\364\fr\324\264\007\205\252\021S\355\334|\266\030\370M[B\b!r\247\024r"
+	.string	"j"
+	.string	"q"
+	.string	"\007o\333\370Hf\375\250fB\226\313\023\n\271(\217P\016:e<\350\005\fl\\;\200CF\231\030\361\320a\002\262[\266T\304k_\215b\b~:k\276\250\002\341\346\324\303\345\310\257\200>\332\350\001:!\321\3633\305\360$\310\347\347`\216\016g~\"9\016W\222\334\315g\262\273G\372\334\311\335\346\024Uv\327\023\227\363\271En\333\203\355\007\366\224\nI\267\023\262\251\253/\235\t\203_d\231\231y\334A\177&<x\035\361\321\343}@\372\261\315*\273$\247\016\331\377VC\330%\337\364\352G\267\250\323\252\323S\247/"
+	.string	"A\213\335\323\222Q\017\355\225\313S\025dy`\323\210+\375G\237\366\355'\371:\263|\023/m\256T\363\315\331\347\244\214\204@\355\3664(_ <8~@\030$9`<\006\215_\244\200hw)\204\007W*\n\311\350\355t8\250CF\271\352l\247\343fR9\300\034\357\031\341w\177\321\344z\315\343T\217cj\003/G\311\335u\261\021\247\373\0305\344\033\231O\372\212\330\270kKq\0255~\321A\267\304b\341A\333\005f\036\347\243\210\372\301\273Qr\356.\251:\244do\307\256\306\315\244\362\324\253\250g\241\0230\232\213\266B#{Y\241\201\305"
+	.ascii	"\200\321b\263\b\025^fd\026dX~\245d\220\261\270\274\\/,\255\230"
+	.ascii	"\230\013\246\365\232\311\264R\022Xv\0016k\321d\262Y\213U\356"
+	.ascii	"\307\277\026\372\023O\343%\272c\273D\317\2332\342\331\364\366"
+	.ascii	"\255\bL[\302\204\251\022\274[\271K\216:\344Z(\352\217\206\033"
+	.ascii	" \242\236T\fk\276\335 \007W\372\241t\263\312+uj\211\031 \332"
+	.ascii	"\265\005? \240\002\031A[\007\240\365>\003\316\260e\030\330\223"
+	.ascii	"\354\246\265\"L\342\226p\0242\344\242D\215\016\270\273%,\016"
+	.ascii	"\317\026\263i\r\\\002\200&\244\3056\224f`M\013\307ytc(\b\243"
+	.ascii	"\241m\334\273\034\210\257\312\305K]\020\013\205&Y\"\231\303@"
+	.ascii	"\305\311\333\242\016\336Z\003qM)\3552x\370\370x\356\341\016\024"
+	.ascii	"\304i\300\202\021\26760e\372c\0057\337\227\032\007z\031\354\030"
+	.ascii	"\017\244^\313-\0305\037\303\0167\362\336\326v="
+	.text
+	.section	.gnu.lto_blackboxValidateConfig.142.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`t"
+	.string	"\205\t"
+	.string	"\246P@: \261\322\001\034\270#\026\002\224K\n\252\026=\361\236\247\252\2026T/m\320\363\200\217\322\302m\3667\336f\204\030`\002\204"
+	.string	"8$d\004\001\001\213s(\343\214\006![\356\224\002-"
+	.string	"."
+	.string	"0"
+	.string	"W]jT\371\247=\30057.\005\346\353*\007r#6\240\331\222\t 3\257\320d\305\b\300\260\273\216\256\371q{\267\335`[\301\266.\253\270\263m\254\2502\373r5f?\372^\b\247c^\306e\327c\327\2638\017\306\304\366AV\3317\267\315\266\200\026\302\321\302\263\273\240\222\0044(9\361E''\242*\323\033|W\202[M+\352l\243\276b\361\331m-\370*\257]\370%\367\234\221\212w\335\363S\337\275\253\006,&\245\026.\2110B\022Di\024A\002'\036F\022`\351\204\002E\007\016)\034N`E\030\236@\220mu\271\032\373\354L\334JYRe\246\357fB\230\355.\313O`\001\021"
+	.ascii	"`\2517\023\032\200\002cx\r\343w\004\321X\t\313@\270I\310\002"
+	.ascii	"\305\343\357\007\001]\303\355C\360\227q\305\245\213\331N\274"
+	.ascii	"0\241"
+	.text
+	.section	.gnu.lto_blackboxStart.144.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\246\001%\020"
+	.string	"\306\333gH\340\262(\035\222<k\001\212\346\035\351<\200\2138\352\016<\357/\033\213\211O\372\\\022\354\365C\231\313\020\257l\311'\227Z.z\226N\017\300P\013A\0011\314\340\016G\"\214Y\027?\304\320\257g\367n\237\354\275wJ\001T"
+	.string	"M"
+	.string	"W"
+	.string	"/\236\225\033\037\273\353M\023G\035\304U:%\312\017\017\n\275\234\033i\361\020k\264\030_^iH\314\210Z7r\240\b`\320V\376\272d\031W\222\212F\227OJ\240\247\004\216nT\321\005\"b\270\004\030E)A\243\335\265d\215\036\356\320m\203\266\031\330\017\022u^vjk\355\324\300R\362f\307D9]\366\351\316\030\233J\327)}\321\006\035-,\343e\334v[n?\226V_\234\260}?vY\312m,j\375\320\244\330Oq\230\312m<\322\332\321\275\332*v\367*;\243l\037\003\253\r\033\004+@l-G(\201\254x\266\246j\340>K\263\033"
+	.string	"\244=\241d\376u\0019=vh\342\f\351t\2318\026\246\0042\273\213s\024\255\0314?RgG\017\314\234\256\371\003\\\235\005f6T\322\346\313l\362\0330\264\253r\340\317\256\342\202?\363\352\023\024y\026\n\367\032\376D2\200%\323G\242P\362*\224\220L\274\357t\342\211\204\030\264 \341\344a"
+	.ascii	"\301\223\327\305R\037\245\246\b\032 m\b\021\344Y\376\353#q\206"
+	.ascii	"\267\301\334p\270\3512\t\347\347\\\207\304\2371\351\373\270\327"
+	.ascii	"\007\037h\324B\244\344\315\205OHf;,\211U\360z\330E\001) P\202"
+	.ascii	"1d\352\001`\352\311\003\326p\\a\347\003\001\2777\241-\025r\240"
+	.ascii	"\005U'\363\030\273\274\330(4\200\003\224\322m\036\355\002{3u"
+	.ascii	"\255$j\223\204\035\302\206\027\213}]\005Y*>.#R\274\023\204\233"
+	.ascii	"\210\321B?D1r\212\310\201a\334F>\356\r\313\217\237\207\363\020"
+	.ascii	"\240\276\027\337\032("
+	.text
+	.section	.gnu.lto_blackboxFinish.145.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`d\001\345\r"
+	.string	"v\030YD\020q\233\016\377\202!,0V%.XV\234\334N\311w\220\021\026\304\307\300[c\022\250!\205\215n\002\373\315V\217\246\007\301=at\3004\002<\002\002\250j\270;)\220\323\006Rs\356\254~o\262wJ\001A"
+	.string	"D"
+	.string	"G"
+	.string	"\257v\211m\275\336r\310&/~X\001\245\320\302\312\313\356^\324\303C\257\023\235!\377\3403\\\247\275j>U\235\206\323\321Fi\276\021D\325U\240\023\343\331]O\256\313pS\267\235\300v\001\3731\002\276\370\021\231\217b\t$\363\334\253OB\275\236\"p!y\245\r\242Y\332\342h\322\016\366iY\2269LO\3549}\f\005\021&\030\272\327(wM\312\035\333R_\204\260}\277\364\260\344*6\340\331H\331]+~x\317F5?\305\355\321&\217\177\343\007\203\332oar3\203\305zF\251\370\212\2630\271\241\301\222\251V~\342(L\336\345\304\343\360\354\031\365:\271\345\274\204m\022\300\256vo\2437\\\250\244,i9\004\266\331\303\001\376t&` \f>\037\r@.\007!\037\"\327\0074ru\006\030{\240"
+	.ascii	"tE\3000\320e\211\242O\013\376\027t\200-\":\362ML5\300\264\027"
+	.ascii	"\204P\022?\370\0032H/8\346\370\215(S5}\021\352\3451\312\017!"
+	.ascii	"\214\314s\001$ `\202Q&\253\007`\324\023\n\005O\304\333\006`\230"
+	.ascii	"\360#\214\211\013\361\270\312\330\355\264\b*\274\336{\227\327"
+	.ascii	"{\231,\336'\244\342\260v\b\354\312h\3644\320\360Jnc\326:\266"
+	.ascii	"\024\244\365\205\206\002~\366\300\020\267+F\323\005\333\3312"
+	.ascii	"\016\257\"\263.\013d"
+	.text
+	.section	.gnu.lto_startInTestMode.147.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`f\001E\017"
+	.string	"\266\334gF"
+	.string	"\221(\035\363\203g_\301/v\020Q\214\201<\237~@\263\216\325X\210\265,"
+	.string	"\376\t\321!\216E\264\377S\013\272c\210\261\0061X\307\206~\253*\025\204\226\374\327^\b\322~\266\223&\276\332\354\004\221M\344N)V"
+	.string	"O"
+	.string	"R"
+	.ascii	"\"\251\r\033\274f-,j\273\353)\211\227\316\315Me\311\017 \206"
+	.ascii	"\347\272\020\237\233\201\226\036&@\304\324\226\240\026\306pD"
+	.ascii	"\026\271m\013X3@|Lm!4F\3148\"J*Gd\331\020\354\356]\227.\342I"
+	.ascii	"\312\017\317\356Z\252\304\017\367\307m\227\330\216"
+	.string	"`\277D\264\024\254\227\b\223\274\261\307\223\324\226\375m\365\305~\354\356TZ\245\364\001p\360\260r\021O\203cwu\303cef\314\211\307n_\205?\376uX\351\261\025\001[c/\316^\265\232\335\221\301\247;\335\247\307\207p\237\335\tp\237\347\270d\323\004Wu\372\361\005jv\344\220Iih\031\251\025\212M[\326\2178UPv\003%m\376b\324\355\242\034\370-\356\342\363a>\215\201D\342>U7\260h:`rwC\325\226U\270+H6\203\2226\366W\\\246\342\3038C\212\274\352\323O\321\273\256@\f(\3407\341\204$a\304\344\001\204\021\021\370\261@\022q\250\243\341\003\225\204>\027@\236\t\311g\344\205@\222\3279\340\357D\004z(\337\007z\234\321t}\261\307\244'n\200\264)|\344U\276\353\236\223\206\207\001\353\020\316\025\256\323\031\322l\310f@\344/\342\276w\f\316\256@\"\003\033"
+	.ascii	"5\263\007K=\231\001\353\034\242\365\022\336\3666C[ \212\304\n"
+	.ascii	"A\210xP8\016\267\317om\033\"{$\310\231`\343,L\b\256\211'\231"
+	.ascii	" \272\260\227U\226\227&\200\273W\205\320-a\\P\341\267\253\224"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_inMotorTestMode.149.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`y\001\235\017"
+	.string	"\326\334hG\340\262(\035\252\252\254\204A\344\220\013,\31699\274\275\023\350\247\362M\271\333\026\346\321\252]\222s\321H\366\343h\355\306\201/N\230\310\001\274n\0033\3140\017#\024\242\301\031\221T\230~>e\3479v\357-eJ\001Z"
+	.string	"L"
+	.string	"V"
+	.string	"v\210\0314h\261\252\300\313Jh\301\214Dk\305\2169i\334\206\270\3522\302U\225\277\272\\\221\361\251E\0072=42r\\\035\016\341\310m'\207H\214\t/\304\345\242\013E\200hj\214\\/p\004\326\303\341\262+\214\253S\025\225\3149\255\236k\303-\272m\024\333\n\354\363\0047\307\251\340\227\260\n\213\336{\364Y\344\343\367\262#\020\002\022\203\335\274X\372\331\264\225\256\215\375\375\276\357\363\326\330V\223V=\262Z\004\325\022\252#TC\250^\253u\325\037p\300\307-\305q\360\314\031\363\375\230?\261\305\t\325\333-\001\266\007\027L&\371\250>\336\215\004\031~\222\273pw\b\003\254\323\317\002\324\216p\242\367v5(\310\213\237nW\266\r\025.b@\225\324\325\0215\032\001\324NA\351=\335\177\230\351vu\335\031\002\232\331\265\361Kr\004"
+	.string	"Fm\206\213\366\360_\222\337\321Z[\257\356\001>\221X@\231\240\234L\022L\270\t'\246\024\356\224R\341H\f\030E\001B\212[A\241R\034m~k\374\240\231\254\245\023I?f1\233\016\374UR\2640\266E\353\022\326vp\3169\245\334\270\244}+\226#\267$\342\305\212K\300\246\003\005\217\333j\300\001\341!\302\365Y<\037"
+	.string	"\263\312\371\256\213\253Nz\260\256A+N\310\315!"
+	.ascii	"\202;\004W\262`\306\202\005\260\2220\315aa\2259\257\314\354\003"
+	.ascii	"\253P\245\334U\013\\\230\\\231\316\257Z\026\245VY\\\030!\306"
+	.ascii	"H\360\366\252\240\0034\222)\227VW\263\254\271\007"
+	.text
+	.section	.gnu.lto_loadMainState.150.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`p\r\315;"
+	.ascii	"*gp\026?P\350J\007\305\205\232k\350\341\346k\300\3544\360KJ\r"
+	.ascii	":\215\247\364\016\253\342Y\302\326v#\344q\220\006\020\251\267"
+	.ascii	"\326\221E\200\032\325\006\342\303\356\350\322\r\246A<7H$d\357"
+	.ascii	"-SJ)T\001<\001V\001N"
+	.string	"y\360\324:H\240\252\026)d\244\3329\367\224\335\354^\323\255\246\033M\267]7\263\333L\247\314\235\367\307&\016\336\2324V\275\333\322\273\313\322g\270\357\270h\307|\211\364\250\244\030\366y\366\230\256\343\"\231.s\333\f\217%\025\217\332i\177zo\202\252\312\364\300\034v\023\312\354\321\252\232\332@\030\351\325\021TU\025\253O\2560\354\223\231\333\231;L\317\335\246\363\301DU\205\202\227\247\252\314\006\354`\330\247T?\241}\332nB\373\274\314\201\004\220\251a\021\364\332\314\352\022\251\252\232\365R\230\207C%km\361\377\207\326Z\224\277-\263\331\242\267\215JIH\305#\3420]BO&\373~\271\353\332&\225 B\246\205\265\321\246dE\2604\036\264&v\202\"\301\275\316ss\245\267N\312k\253\367'\007E\355\255\221\332\330\364\224\026\264%^\234\212Sc\322Gi\0066m\365\342\310AQc\322D6\373"
+	.ascii	"\317\314\207i\20685%\235\266\230\222^\262H|\266,i<h\253\205\300"
+	.ascii	"\206\307\247\323\2209z$\207\244\317!\222f\262Kx\320\246\330\007"
+	.ascii	"~\226\366\303\255\234\221\376\276\3533\211\354C\246\031iO3\250"
+	.ascii	"\252\312\216LSk\006\320\314\355"
+	.string	"\306\314*\230\221\274\002ok\337\340\336\260\020\207&\224\376\320C\013\022\fL\373\226(\240\017\375\347|\024D\003\366\371;\007-\037\021\275\347\337\222\350<x\356\374\367\233\365\315\222\316\277N\211\252?f\023M\007\305\260O\003\215\034\324\357o\t\313\350\244h9\334\324\372\353\322qVDX\375\032\016\013n\341\302\033\351\002\355\263\377\315\3127H'\346\205\337\253\"\301\274\347\007\317\374\242\373\270\206\252\252J\340~s\235tA\255Vx\240}\352X\335,\333\304\274\220A\273\341a\341OU\325\t\334{\335&\006\267\225>Y\306\fod\237\3343\320>\263\036lm.\367\304\274\220\231\031\346\237d\356\t\253\"A\376(\314#:li\300\320\314f\255\246\353~\320f\232\263\272\331\274\240\3274_\265\232f\253F\323\\\325v\315T\251\263\002\242s\202\323y\352t\226\":G\245\316\b\254\363\201\241\263\201\324\271@\352L"
+	.string	"u\036`\235\005X\347"
+	.ascii	"\2513\024\352\374d\235\235R\347&\324\031\200ufJ\235\227\254\263"
+	.ascii	"1uVB\235\223\2543R\352\\D\235\217\2543\361t\036Z\347\364tF\255"
+	.ascii	"\363y:[\353\374\247\263[\347&\021\002\006\274\324X\263\025\261"
+	.ascii	"\323\230\252\212)\b\360\002\264\\p\346Kv\315\274\221\001\276"
+	.ascii	"\353\372\311\017n\213\235\037\037F\374$\247p\322\255\177\300"
+	.ascii	"%\254\266\262\032Z\375V \224\026o\273\312\2525\2103\271kO\017"
+	.ascii	"\365\326\220\323\023\005\267\032r\213x#\235\276\361\372i\f\234"
+	.ascii	"\233\235\261\017K\227\316\016\377\200LX]\365g\314\207V9\033\036"
+	.ascii	"\237\025\255\372\016oL\n\261kz$WY\365\227\346G\356\032\200oz"
+	.ascii	"K\310\004\200\213\253qs\350h\236v\217$\271llh\237L\337i\372\324"
+	.ascii	"\262\352\031\334\363r~\222\233\351\243p\n\347G\374\003:VS\375"
+	.ascii	"Y\203\246\372\246+\0038\346\212\372\016\234\037\246\375$\325"
+	.ascii	"\217xc\022\331W\366\366\303\013y\211\b\023\037r\267\030\177\351"
+	.ascii	"\355\2363nFps\344\235c\360\347@<\310m\362\344\302\301\241}\032"
+	.ascii	"\277\363V:K%/\273J\2525\351dI\257\364v"
+	.string	"\017R\222\213q\363j\225\342aw.B\241\253w\312\255r\257x#\357\025\264O\244\357\266U\316\340^\361\t\257\222J\256\031\335-G_|\013\310\254Q\225\023\237\371z\271K\264\221G/5\366a<\310\315\253\013\246\023\3359\255\365P#\272b\2305l\360Fn@\373$~\0072\032\314F\327\327W\216\rF0\0339\2746|y\201y\3258\302\201\242\253\206\214\023`6\272\276\276rp%1\227\203\035^0fp\275\240\001#\313\206\214\0275\262\270\276pd9\210b\257\033]_Y`^^_YE\246\332\037\205\211qnv\304\376\007+\370\273\253<`\347v\307@\250't2^W\306\315\034\003\321\034\325\250A\373<\233\371\320>\025|\267M9\263\334K\260\306\231?\247\231\340\277O\\\332\224\236\317\275!\344\240c\033\007S\302\227\376\345\310\327w\364\363C\373\234\372V\2622Z\322I\305q/%"
+	.ascii	"\225\250s\274\343\215\224z;\b\027'\352"
+	.string	"\231\217y\234\313q\017\324\032\344\240\020}\216~\274\221QN~p~\306O2\0210\t\303? \022V/\320\372\005r\254\322\202\307\360MuD\354\020\274\334UF\035\001y\226c\340\201G\360vN\031\035,\216\205\233V\374\312Q\020\241\243\241\243!\264\317\003\337y\205\336\256\217,-\311\300k}\023\2325\332r\346\343\340q\2217\322@\323\03581HG\032\376\001\211X}\365g\236\244\257\212W\257\341\215\311!u\312\336\n\374\224\253\214\372;\022\372z\327\354\234,\036w\225Q<y\327\216\2057,\f\355\263\3007\233>\271\254\201\226G\004\0348\224\253\214zr\327\240\006<\201\267|\001\201\005\250A<\004\025sfDdD$I\222B\007\361\005\204\030\347\034\231\007\021 %u\316\314\204\231\024\224\244V\007!\306\245`\215\004 @e\272\303*\254\336\373\025\267R\224\254Z\367\b\002%A\nD_D-"
+	.string	"c\031\300\016O\314\320\233\315\n\302}N\367\340\036\2740\303_\357\221|\024$\034\254\243DR\331\327\267)\305\254\374\005\211\177zx\037\367\363\025;\264\362\036$yr H9T<.-\353\347\206(\341\264\036\223\201\026\013\351WA\270\027\003\263\202\207\306\226\225%`\323\370\334@\254\303"
+	.string	"\177\233\371c\252\222\357\262Y\322\272\205\017t\256Y7\347\315\034\305\2253%(\333\205\304z\f\025\340u\264\025\207-Q&\031\326\230\357;\220j\2517\030\n\245\007\024\035\322\233\340\273%7Db\336\370\232*\206\347\233`\340\016\370"
+	.ascii	"\332\204\013\024\217\003/\334\236\030\017\205\034\201l\264\017"
+	.ascii	"r\004\376\t\336h\302\236i\022[\225\214+rs,\334|\215\273\2415"
+	.ascii	"\233(\b\305|\241FN\240\350\242'0@\223\232\305X`\376u\371\375"
+	.ascii	"V\036]\216\211\303k\006\312Wh\330\311\261\350\327WuWn\334\311"
+	.ascii	"\261\325\343mKTl\334\031\207~Fl\033N\r\351\024\243d\260\275\003"
+	.ascii	">\201\342\327\361>\367\322/\330P\013\031\203c\324\320\325\265"
+	.ascii	"\215\226\332.\302\222\233\301\300\327\337\372\337\254\002\213"
+	.ascii	"\027\204\003\370\224\272I\274\222x%\311\353s\273!\355B\241\301"
+	.ascii	"f\354\037\265\206\216L\\\036\001\272i\021\003\302aS\365\362u"
+	.ascii	"\306VZ\224\225\026e\245%t\027E\251Z\270\364\273u\021r\0178&)"
+	.ascii	"Op=\264`#\0270C\002\004\001~\004N8\232\r\"N\326\254\201\032\260"
+	.ascii	"'\246c\241\002"
+	.text
+	.section	.gnu.lto_sendFieldDefinition.151.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\324\0205U"
+	.string	"\032\222L O0\222\322\032\003[\277\r\004"
+	.string	"\367M\274Js\231\213\016zSnD\207\272\203\013\314\240\373\232%\350_\362\001NTGe\372c\032\365w\305\217\340\352t\316l\007z^\327v\334`<\233M\251\325\364&3C5\021#7F\214F\244\224)\245\024\370\001\274\001\364\001g\257\220j\020/\031\266\rJ\207\351\256\241[\255\233\255\201\336m\335o\335cn1az"
+	.string	"\237P\266\027\316\327]\270\341\030XC\3229\247\305\347\245\2770\003Y\252\273p\017\355\215\314I\366\276/P\212\031\330\3543\377\340^k.\355\326T\006\276q@|\343\336\346\ns\223\252\271\322v\302\230u\366n\375\254\034\261#\263\033c\243Z\302\n\262\200[\226(P5\252\365\355:{\271z@\220\260\221\241h\226\273k\213Z\007a\265tp\344G_\351\264\037\215\205\251|\363\276^sS\276f\215k\357\264Ux\207\035ooMq#SS\301\352\314}\3262\374h4\336\341\207\370fM\237\260\275\357Y\nf\340\254\213m\263\276\336i\245w/\336\233L\004\376\367u\316\300\366\276o\nV\3625\273B\200\037\354\376"
+	.ascii	"\261\342A\205\033\225\245\025\273\367=;~\023\016r\267\213\210"
+	.ascii	"\206\204B\004\001\375\370\364\024yvtr\210Ca\020\007\370\273\361"
+	.ascii	"\365Zv}w\271\255\272\250\267\364sB\275\343\301\213\313\254\211"
+	.ascii	"\244=$-s\241\225\005\020;$\035\327\224"
+	.string	"\2568xK\033\032\254I\346!:\256I\205\232\304\203X\340\032k\240\336\322\217X\373\3045\305\032\254\t\305{\302\\\360\"\317\223\336Y\221\324pa\323q\315\257\265(\304\005f\2035[p\235\365EY\030\264\343\232\321\365\321\322\274\344@\233\bu\342C1m\024\327\024[\215\3025\351\006)F:\256\351\\w\212l\271\241\251J<\350c\215\203\244\201F\277\336\222\027\327\221\276\211k\032)\342\276\2762\353^\027pk\351\355Z\264\202\222;\341\226r5\302\221Y6\\\033\2015\315\234]\221\234`\206t\\\023\311Z,\303$\r\020_\207\364\013\267\260V\343\373\276Mm\327\332\312r\357-\275\357\313\316\334\342j66\263+1w3\013\213\004\255\357\231\336\251Jg\357}\337\013\263\314\023\341\3553\273e\256\2317\263\367\r\304\222\254\267\362\240s\230\341{\337,\002\270q\3504L\253\0025\332f\326h\233m\177"
+	.string	"\264\265)\316\262\266\233\271/\260\366\237\034\300\257?5\035c\243\351\222\276\271\365\033\256W0\320\272;\351\225Wy\230^K\330\177\362O\214\315\257}\242\355\321\"&\306\333>\321\006\360ZJ\375\277cJ\307\314@\333\300\324\036\346\006\332\314\215\242\223\367}]\224\3518\007\270\277\232\345\246\034\336\314f\271s\264\315\376G"
+	.ascii	"\255\023\223^\255\377\034\232\312\221\360-B;\343\377JM\312\024"
+	.ascii	"M\226\343\261\377\222\214\217\361\376!\316 \361\242\354\207\361"
+	.ascii	"}f\231w\345U~\361\007|\177S\233\305\203\3320\225\273\002\003"
+	.ascii	"\226W\231\317\260\374\237\314}\300Rm\213\177\005\346\240\263"
+	.ascii	"S\320\031\203\240\363\005:\3369G\2775\343`\347\246\306\322\335"
+	.ascii	"\300;\333x\347\032\357L\243\311\272\025\350\032\232\231Z\332"
+	.ascii	"=\243\325\232\227ZK\267\214\336\322\035\243\331\232a4Z\367\213"
+	.ascii	"\256\322}\300;\267`g\026\035\246yE\2675\007\020tV\021t>\006\235"
+	.ascii	"\225\3369\305;'\021\235Q\2743\322;\003\360\316'\336\331D\216"
+	.ascii	"s\211\240\363\321;\223\340q\036!t\026\021t6bg\343;\027\2753\021"
+	.ascii	"\321yh\307Yh\3079h\350\f$t\376\t:\373\3508\367\3448\027Yg\236"
+	.ascii	"\241\363\316\320Yg\350\234\363\316\304w\036\276\263\360\235\203"
+	.ascii	"Bg\234\2403\220\350\374{\347\233\240\263o\350\334\023:\267\357"
+	.ascii	"\314\006\235\327w~\034g\307q\356\035Hm\260\314Tq+{\271B\312d"
+	.ascii	"\341q\341I\315\324\226\331%\342\246\340\315d\317\022\005\202"
+	.ascii	"\343H\350\242\302\316?\331Kh\243\227\361\037\210\212\021\353"
+	.ascii	"*Z\262\342\211\276\310I\3647^\3249gY\027\264H\fht\250(\f\277"
+	.ascii	"{\264EL7\035\210:~\305k\361\320C\337^+\206\336\263D\341\310d"
+	.ascii	"\275U\216\320\353`[\2026\350\205\276\201>\350\177\315\017\320"
+	.ascii	"\367\tn\021\357r\301\236\302\b]\334#\034\264\315\376|\303\020"
+	.ascii	"]\023\353$J\306$!:W\373|{M\351\234\310\020\237o1\275\326E\325"
+	.ascii	"\356\244cfR*\303d\353\344bD\230\224\361\301\f\032\f\376\202w"
+	.ascii	"\372^vy\323\267\222I\\%J\332f1\370\022\320\256\034\177\301\367"
+	.ascii	"2\257\347\223:\307\367\227f\301\272\252L\345\256\004Q\374\236"
+	.ascii	"\1777A\207\253\202\357\253\370\255ed\347e<\317\367\316,}\316"
+	.ascii	"\357<\320\032%\030\226\267}\t\222D\330\035\2642\376\321\336\314"
+	.ascii	"\246t:\377\342q|\347\240\234\002\343s^\347\205\316(\301\220>"
+	.ascii	"\247F[\364\312T.-\357\315\340\200\206%\230b\254J\020\234\177"
+	.ascii	"\262\377h<\t-f\322\233\032\337\342\265Zv\246k\271Q.\023&m\263"
+	.ascii	":\240\325\260:\342\007\361\245+\223z\370\304\377"
+	.string	"6\236\345X~5\374\b\240ywR\341s\267\361\267\231=\330\370\340\013\277\225Q\272M\347\365\340\376b\367\3516q\267I\333l\360\213\240](\034\347[|\203i \334\026|\357\253l\246\373\304\247\3549\023.\024\367\005o\246\2157*\337j\005*\3604\3747\343k|\367;\267h\335|'[\340;\013S1Y\216\307\243\177`\203\363/\007m\273\362j\235\017\300\377q\265\226\306Y&m\313\272P\360\375\263y\270\030I\323\373\247+\245\375\375\324\024\315\221\337\304\340\212y3\177od\372\233\357=\235U`'\003\fu\364l\001\324\021\005,\033@ud|:2\032\027\030\"\245pP!\253@\330\201\343\003YU\0255\005\001\022\001)\034TSN<\236\210\031 \241~\n\t\345\204\344\001\204\"\"\241\242\246\252\232\210L\303_\225\217\016\244\230~4\240|H=!\251\212T>\244\242\252\242|De\200L"
+	.ascii	"J\003dT\006D\247*\r\220P\302)'\036L\310\244\323\024\215 ?)} "
+	.ascii	"\265\243\307\223\223\006;\216>\242\234\222\307\247)\252\243R"
+	.ascii	"\021Km\200\234:VIIM\035\201gW\375+\360r\215\250\351\233\354\322"
+	.ascii	"\322z\336\244\033\256o\276\334\320\244\255\261^B\263`\361\274"
+	.ascii	"t\365X'\024\375S\3057\375J]\206\201\201S\361\023D\203 \372'\r"
+	.ascii	"\376\305K7\243?\204\325\035\237\232,:y\353N\266J\177\374_\303"
+	.ascii	"%\351cSz\034Q6wR\027\376\353,-\320\220b\213\333=\332\244O\361"
+	.ascii	"\255tfI\372\020\242k\356\272\324\220Y\016\375\223Q\274\343M\351"
+	.ascii	"\222\032\305\267\320\022f\311\235\232\254\267j\226\006+yB\377"
+	.ascii	"\344&\243\226\260\\\013Bz\366\265\330\377!2&\203\017f\350\262"
+	.ascii	"\034OhHYX\210\177r\003\217\364\356\302\024L\226\343]a\252\317"
+	.ascii	"\234\225\033=sU\220\336\207N\332\275\276\357\373\006\001\200"
+	.ascii	"\306\324\0302\334\200qv\342\001\370\2376.ej\f/\273\001\203\354"
+	.ascii	"\304\021\355-\312\267Y\241b\007dbl\2046$F\250\372\224\235W\342"
+	.ascii	"M\274\3170\305cpU8:a\327\312ap\261\232M\232+\361Gh\333\260Z\255"
+	.ascii	"V;\331\032\375\321?=\237\310)\235X?(\234\304\367\030\227\342"
+	.ascii	"\002)\341d\351S"
+	.string	"\266\035\033\201\274\025\217x\022\017|>Ic,\\\240i|\376\351\266\253\325\216\370\006#\301\241\270Z#~\203\250\334\235\264"
+	.ascii	"\027!\304\335j\372\022\361\035%z\303\220-pkz\214\242P\243\357"
+	.ascii	"yu\371r\226I\213n\313\202\007\3211vuW^\355\264\201H\250\221$"
+	.ascii	"\345\220RJ\221\214\210$I\222\346A\005\304(&)4\017\021@\265SN"
+	.ascii	"\315HL\205\306\213\236$01\f\021"
+	.string	"\34286s\344\220\343\003OM\020\250<\211\2643\225V\272\033\r\236\007\217\242O8\371\331\245\274\372\377\235S\265\374M\267A\370|\261\034\201\223F\353\024\027\030Vp\376NB6\343Z\222ZF\316\301\337\231\226\214\242r+\227(Ge\267\342\210\233G\177\230\030au\311\025\361\227\026\205v>\205w\312\305\354<\023\307\327\233\210\232\314$ \340\350\305\033u\022sb\370j\251\262\t\320\344{\354t\261\250\274\334\213_\312\356\201R1n\021vf)\303w\226\200\016\032\305\330R1\251\273WU\374\205\024\275\200A\"\365O\032\226\253F\261B\303O\241\357m\346\351\020~b\035\034\360\325\256[\353K\230\356\b\263y\rO\361\243y\032wn\030\246\267\301\224z\037\263\032\2373,\301D\030/\367DD\222J\222\311F\023\310\317T\3027\244\233S\245\334\004F`g9\200`y\266\257\247\335\372\3450\202\335O\334"
+	.string	"\351y\342\344\024\334|58v\243)\013\004\247<\234\321\007\f#\3339\323Kn\323\003\2069\306/\264|\352\200\275\232\341\363\373Y\024\210\371\fq?\017\240E"
+	.ascii	"\302.kc\032\363\0359\200\242\203u\302\3339\333A\357~Vp\357\204"
+	.ascii	"L\023\233\2754\303\260y'\254\023\254;\233W\316\342\302\335s\375"
+	.ascii	"\240/\007/?q\312\303\031Kb.\347\037\200:\271\024\004\355O\030"
+	.ascii	"?\305\247r\177\360`\315\374\002\311\n\026T\305\245\342\300<]"
+	.ascii	"g3\212@\246\241$\031\006\274\006L\242\250J\343\211O\002\262w"
+	.ascii	"U\243\372\274`\002\370\215\206$\232\366\356\223\236\021J\304"
+	.ascii	"e\223?\242\r\204,\025\220U%\2546>\350\207\235\304\347\277\237"
+	.ascii	"\032m\277,\005,\363\021\312&<\301\201\276\033\277\022\317\365"
+	.ascii	"\251\251cRP\220=F \025\021\376\306y\232\350\001 \221\023\206"
+	.ascii	"\325p*\2550\234\245\001Td\r\250#&)\311\243\177C\217\n\260\364"
+	.ascii	"\032r\272\270H]c\306\005c\017h\340\221\311D|4\252\316\366\202"
+	.ascii	"\024*\335&\3557x\022\220\320\r\233\225K\375\237\352\203!\357"
+	.ascii	"@,\036Ov\375:\232\027\rav\350\342\037V\037sx=E\304\177\316UE"
+	.ascii	"\027\036eE\253\350\2428q>+\276n_\231\300\260\240\033\366\225"
+	.ascii	"\360\362\315m\307\241\006"
+	.text
+	.section	.gnu.lto_blackboxWriteSysinfo.153.9f5c58040b7511eb,"e",@progbits
+	.ascii	"(\265/\375`\366d\2050\001\032\372%pQ\020 gi\215\001\357\267\351"
+	.ascii	"\236\032P=\266\355\t\214\237\3759\263\\s\251\370@\375\205\302"
+	.ascii	"\241\303q\004\213\322%\343\354N\365\374\342\023\241\223=j\214"
+	.ascii	";\300\036\221\347D\221\201\202u\263\302pi\356\2109Z\222V;;J\376"
+	.ascii	"\274\bA\"\221$\245\224\002\201\006\256\0060\007\334y\256s\253"
+	.ascii	"y\235;\215\353\334h^\347\306s\235\233\312\301\271\357^\347>\343"
+	.ascii	":\267\335\353\334u\256s\233y\235\273\f\321\271\311\274\316MG"
+	.ascii	"t\356\271\327\271\345\\\347\216{\235\033\316u\3561\257s\213q"
+	.ascii	"\235;\314\353\334o\256s\273\275\316\r\306u\356\351\353\334_\\"
+	.ascii	"\347\366\362:w\027\327\271\333^\347\346\342:7\333\353\334k\256"
+	.ascii	"s\253\275\316\275\305u\356\264\327\271\321\\\347>{\235[K\353"
+	.ascii	"\334f\255sK_\347.#:7\331\353\334cD\347\316\362:7\026\242s\213"
+	.ascii	"\275\316\035Ftn\260\327\271\277\210\316}\345un/\242s[y\235\273"
+	.ascii	"\313u\356*\257ss\021\235\233\312\353\334[\256sOy\235[\313un)"
+	.ascii	"\257sGq\235;\353un,\327\271\257^\347\266\":w\325\216sCy\235\373"
+	.ascii	"\t\321\271\243;\316\r}\235\333\t\321\271\233"
+	.string	"\35487\223\327\271\227\020\235[\311\216s'y\235\033\t\321\271\251^\347\236\":\267\324\353\334F\210\316]d\307\271ox\235\233\210\353\334\317\035\347\036\362:\267\rD\347\216\332q\356\032^\347\206\":\267\220\035\347\016\362:7\020\327\271\177\3548\267\217\327\271{\270\316\315c\307\271\237^\347vr\235{\307\216s\323\360:w\223\353\334\316\035\347\326\361:7\023\321\271\227v\234;\307\353\334JD\347n\35683_\347%\321Y\271\343\234\364:\343 :\317\260\343\214\364:\313\340:\337\330q\266\361:\327 :'w\234\217^g\244\353<\201\035g\243\327\371\350:\027\3558\023\275\316C\256\263\004^\347\b\270\316B\2573\r\327y\306\216\263\214\327\331\350:\007\275\316@\256s\214\327\271\350:C`\307\371\347u~\200\353\354\200\327\271\001\2563\003^\347\005\270\316\n\330qN\300\353\034\203\353\214\200\327\031\006\327\371"
+	.string	"\257\363\013\256\263\001v\234\013\360:\273@tn\341u&"
+	.string	"\321\231\205\327y\005\242\363"
+	.ascii	"^g\001\270\316*\274\316\001p\235Sx\235Qp\235Ox\235Mp\235Kx\235"
+	.ascii	"\001\340:\373\274\3160\\\347\027\257\263\013\327\271\305\353"
+	.ascii	"\314\302u&\341u\036\301u\026\341u\016\201\350\274\342uV\341:"
+	.ascii	"\203\360:\177\340:{\360:\247p\235;x\2359p\235Q\274\316'\\\347"
+	.ascii	"\036\016\316&^\347\022\036\2347x\2355\360\340\234\301\007g\f"
+	.ascii	"^\347\013\210\316$^g\013\210\316\025\274\316\024\020\235'x\235"
+	.ascii	"y\210\316\022pp\216\340u\206\300u~\340uv\200\350<\342un\340u"
+	.ascii	"f\200\203\263\210\327y\001\242s\210\327Y\001\2423\210\327y\207"
+	.ascii	"\350\374\341u&zp\366\360:w\360\340\314\241\203\363\333\301\331"
+	.ascii	"\355\340<\354\340,\344\340\334\276\316:\2563;t^\205\316\301\326"
+	.ascii	"\371\205\316\336:\267\23391\0353C\346f\345\357\304\232?\002\347"
+	.ascii	"4\351\326.X\315\326\r\326\235\245\233\254\203\314"
+	.string	"\315\023h){\310\"W\205{\255\331\270\271\260\313\314\255\246<\022\"\247\346\210[\215]\264N;\352-5xr\2105\225\206:\252\210\305\320\366\312\\\206m\326Z\230]\276\321R^\333\314\321I]i6\233n\257\3147\230\335^\237Y\311\035\326c]\306.\031R\260\t\205\341v%\353\204V\254\261(;\013\022O\016\261&\020W\207\027\365J\234fS\254D\257\234\242\355\225\350\334W\372K\331`8x\224\304\232Jl\331\025\272+q\232M %z\345\023m\257\275\246C\260\275F\320 \330^9\005\bJf2\240C\211\r\007n]Meq\232M1\024\357\244\231\315r\034\307p<\206\305p\030~c7\006\303S\376\302^\270\013\2671\027f\3435V\343-\234\306h|\306Z\330\214\245\\\306d<\306Y\030\013\213\275p\321\202\005\t#\210\020\302\n\025 |\340A\212\0168@q\242\307D\211\r4\310"
+	.string	"\203\013HXP\001\005\023\360H\020\001\004\01780\242\001\006D,\020B\001\020;\037\210\036:px\335\241\260\325a\327\340;\223[\251YN\305\325T\311\035Z\020\250\3468\351\223\027\037po\366\324V\035\263&\246\r,\214\327\245\265\275\265\371p\013\003\004S\367\024\2666\r\003\373\242\226\026v\345%L\252K\230\217\266/@._U\266/\27158i_kj_T\266\300y\372\272J\373\222B\333{\372\362q\346U\325r&\315\013\314\314\313\207\264\367\322\272"
+	.string	"\313\342\236\272\326\310\234\355\251\353j\354\356\251K*K\336S\227\017,\\`,\306\325\344\205\232'.\027[\200-\344\236\266\252,H\330j2\302\323\226\224\b\255&m\313G\b\177OZk+\370\236\264\300T\274y\212\262\006\002_Z\024\260\017\2424\361"
+	.string	"N\212\251j\007zOSr\034\254\241p\247\250\234\230\272\352\231\22221\345\243D^\332\021\260\r\272\232v\344J\203\236K+r\225\001 \006yiD\326.\330K#\"E\302\365\322\206T-x\266\247!`\025\370\234\264!\024x\340S\224\334\004_\366\024u\305\243\227\026%%A\224\217\b\354\322\240"
+	.ascii	"!\250K\203\252>\220\006%\347\300\231'\250\265\021\037\246iP`"
+	.ascii	"\r0\020\364@G\034#\017$Y\372\n\276r\232\352Z\n\220*.\342)\b\330"
+	.ascii	"\002;\201OA|\204\b*\240@\022%_\r\"\270\301\23268]\006HU0\304"
+	.ascii	"\217+\247\226\002\004\212\357\2549\375\311}\310s\372\003#\312"
+	.ascii	"\241\375]y\370\263\241\203\234\323\237\017\016nh~\200\357\320"
+	.ascii	"\357\214;u\362\223\033\202q\362[\023\3369\371\201\265\035\207"
+	.ascii	"\346w\245\343S'?)\266\313\332o\260\300\355\255\211\255\206$J"
+	.ascii	"\276z\275\342e\245\253\n\326\225U\025\224'Q\350\224\324\021#"
+	.ascii	"En \362\374\341\243\007\217'\247\0354\004\002\376\315\361\223"
+	.ascii	"\323\027G\257\232\247&\r\032<\352\234\\\034\334\0301a\336\330"
+	.ascii	"\326\324\266"
+	.string	"\244\241\235i\t\003\373\272\342e\245\013\353\312\352I\024:%u\304H\221\033\210\260?Ts\235\004\310\263\311\311\376P\315\r\203\350`\177\250\346\024H\262\004\206\200 Q\tX\177p\003)\270\032:\004a\n\206 \243DM\227\265?\005Yr\327\201\321l6\331\235\202\bi\376if\341\0163{\0023\002\240\002\023|\007F%x\236\367\351T\020\357.H]\"a%K&L\330^%\370.\353\001HU\221u\201\001i\206\021\"\202gfn\005\355\230\\\277F\r\326\265S\233\274n?\202'a\352\224Z\362@w.\177N\005 \370\226\006\3130\243=\007J\307\204\352<(\230\007\036\202\037\341$\030\3473&\b\267\214\266\315f\023\312\322\n\213\355\365\201\367*^3\231\323\006\342\231\334\265\357\370.k\277\212\002Trc\206\247\331\031\260\356\364\276\343\273\351\271\344\026|crEYji\261\275\272\323\267\226\326"
+	.ascii	"\013\331\022\251\257\247\367\330q`\352]\274,\267z\250\\\255\323"
+	.ascii	"\321F\274\003\357\323\256 \227\245W\227Ay\371\025d[\206\275\200"
+	.ascii	"6\233M\025\275rP-\270\266\3042\266,+c{\035\361]\026\005s\352"
+	.ascii	">\303\032C\367\201\201o "
+	.string	"\215\371\243\005\324\307\316\230Lz\250T:\360\033\360\3463\360>m\002l\352>\303r\243#\212\220.\315XP\227g\255\323\263\310\230P=T_\262"
+	.ascii	"g\266n2;S\263\231\243\002\346\245\332\222\315\333I\304\303@\305"
+	.ascii	"\364J\354L\335gXS:\017\013\204}\r\t\361\013\264\005\255t\205"
+	.ascii	"\350s\245\016\np1\243,\266\230Lz\240\356\004\342\025\360\022"
+	.ascii	"\224\222\025\214\262\234\272-\303\204a{\005Q\005\312\233.\300"
+	.ascii	"f\030\034v\256\230Q\025\324\252\345\230e\\\353t\245\017\277\363"
+	.ascii	"\256\266\234\013F\221\202N\202\320%\0313K;;\266\327\017\337e"
+	.ascii	"\215\002\025(z}`~\3150^\"\023%{\036\236Hu\267\314\363\020\347"
+	.ascii	"\313\355\360-\rJ1\243,\232\215\021;\347+1\207\357\360\335\004"
+	.ascii	"\030|\006\211,\361\270\253x\231f\231\347\313<\266W\016{\335g"
+	.ascii	"X^tC\016\332\260\324\363vb\016\202QK6K7\313=o'(f\224E\020&TO"
+	.ascii	"\030!V\025:g\033\241\002\324`\017f\264\311\240OK\276e_\353\354"
+	.ascii	"\262.\353\256\001\315/\253o\215\363\225\270F\260\331L\362\242"
+	.ascii	"\331\272\327d\361@\006\200\001\340\262\244\256\264\264\303\226"
+	.ascii	"\177\313@\246\322\325\223N\307+\261\013\357\266\346\302\324\321"
+	.ascii	"6\233\315v\342fc61wx;qs\351!\032\233\254\2765L\257\304\255\327"
+	.ascii	"\f\243u\377\375\226\006s0\177\264\240\202\005\233L\253\036(\026"
+	.ascii	"O\323\337\323\353\327\303U\263\245#\374\341\267\364\373\230?"
+	.ascii	"z.H\353l(\037\023\252\277@\243Zg\033\331cZ\275\240v\0177\314"
+	.ascii	"!DZ\347\f\301&\221WZS\204\211\204m\247^\207/|~\336W\231G\202"
+	.ascii	"]\305\314)&\022\026\t\333\253\360\025\300k\274\3563,-\366\204"
+	.ascii	"\267\364\3230\2314\231\223\326I\204\307\214\266\240Bi\235B\030"
+	.ascii	"\364\332\322\277cZ\365@\233Mg;1\261Z\347\0020\350\225\231\031"
+	.ascii	"\205\251\345\355\304/P9_\211\373L7V\026\235\222\377=\234>\267"
+	.ascii	"\365\231"
+	.string	"\274\031\376\272/\317\254&\025\035?\031/q>\262\232Tq\374r\\=!}v\021\303?\206\253'\312\332\334\370\337\336\270|\341\237r\365\004\331\223\255\215\277\013W{\002\337\326\326\370\331\270\332\003\370TK\343\337\302\325\236\277\267-\257\205\377,MNV\223\252\214_\372\206\226\205\177\214\253=s\236ga\374boZ\256\360\177q\265\207\357i\326\305o\345MJ\205\237\213\253=p\236eZ\374S\336\310\262\370\243p\265g\3579f\305\177\365\226\345\t?\024\256\366\274\301\342\204\037\312\325\036\275\247\330\022~&\\\355\311{{\201\204?\tW{\324<]H\361Oq\265\347\356\255E\021~#\\\3559\303\342\311O\204\253=vO\022\242\370mx\033A\b?\024W{\352\236\"\374\340\007\362\026\002\017\376\036\\\355\211{\256\330\301\357\304\325\0368\025\357\344o\342j\217\033\b\277\304\317\304\325\036\267\347\007\337\344W\362"
+	.string	"\312\037;`\212'r\330\375:\210\362\261\307\341"
+	.string	"\372\206}\017\205\0216\354mN\024\251\262\353\365\360H\303\256\306\304\023\225\035\257\304\030';\3663\033\004\226a7\243\001\340\034;]\006\177p\354q\030\314\t\303.\346\002?0\354n$\344xa\377bA\037\027\366\266\n\342\250\261\257Q\220\006\215=m\0024f\354Zx\304\220\261\227I\300\206\205=K\004[\300\330\303 8\363b\277\362"
+	.string	"X\025\366.\007\274\266\330\251\214\250\"\205]\253\001+,\366,\006\236T\261[\211\210F\331\237,"
+	.string	"\315jR5aw\022b*\253I\245\204}\211\002RT\354H\270jb\r\304\021v)\256\232X{\356\334\300^\344C\221\254&\325\020\366'WMH\337\2105\260Gy\b\363\224\325\244\n\302.\204\253&\310:\370`\377\301\325\022s\236\034\236\330y\274yYM*\247\201}\207\233\306u\260;\207h\262\232T\236\203}\351M\030\310\336\344j\2117\355\034\356?\256\226\320{\323\351\343\226\303\312\301\341\346[\343\262\232Tn\270\337p\265D\365\031\\\303\315\206\253%\362\336>\217\273\352b\320p\247\3510YM\252;n*W\333fr\261\275vS5\335\336\262\230\333\216\231\253)\256\326\2524\233J-\245d\256\272S\263\331l65\350\265\375\005\304\226\260\034\220\231\231[m\206\311\3256\233M\025\334d\272\f\263\213\351\305\374b~\261\275\266\337"
+	.ascii	"(w}\354\353\274\216]\023 3\303z\316\247m6\231Tp\307\265\\\t\334"
+	.ascii	"U\275\362\t)x;\365\312\235\002\333+\373+\312\310U\221\372\002"
+	.ascii	"\313\341\201\314bK\355m{d\220\004\237\t3w\377\234\035:\276\376"
+	.ascii	"\231\260\n\354\3721\306\3200\271\034\036\341,\326<e\231Yh\301"
+	.ascii	"\333i\375>\303\nB\307\364J\034|o\276\3335\001\346\360@^\300\377"
+	.ascii	"\231a\210\201m\247\340\3630\275\022s{i7f\343\256\342\002\360"
+	.ascii	"\232\267S\257\377-\005\212\\\3373\207\007\262\177\007\276\333"
+	.ascii	"5\001\346\360@^\300\373\231a\210\201m'\177\036\246Wbn/\375\205"
+	.ascii	"\331\270\253X\001\274\346\355\324+7\257\261\275\366wY\227\310"
+	.ascii	"\021\267F\352\353\231\303\003\231\305\226:\330l6\233\376L\230"
+	.ascii	";\330l6\233\374K\23098\273\023\007g\337\321Y\232\275\331d\315"
+	.ascii	"\035\310\316\355\307\301\271\345pp\356\276\327\271\343\274\316"
+	.ascii	"\315\367:7\234\327\271\367\\\347~\363:\267\033\327\271\333\274"
+	.ascii	"\316\315\306u\3565\257s\353\271\316]}=}44\303p\021\345\313\213"
+	.ascii	"K\326w\0246m\025\256\316\002c\345\326\247\243\005\326\0263\272"
+	.ascii	"\242\325\322\221^}c\271i\263|\332\253\026+i/\211/\251/\251\217"
+	.ascii	"\355\265\257\300\254\334\272>G3\f\026V\337\322\266\252}\2423"
+	.ascii	"\245\352\333*\311\257u\262\364\202V\265L\240|\273E\003\273\317"
+	.ascii	"\250\270\221\360\344[\332*i\221\3504\211~?I\372k\245\226^W\321"
+	.ascii	"\326\b\364{\032\2353\035\301\311\267\264\275\201\031e\001m\237"
+	.ascii	"I\201J\255S\247H\223o'Km\324\322kJ\223\026\212\3117\033^_\367"
+	.ascii	"\031\025/\",\371\226\266A\332\037:<\224|/\321\321\362\260\242"
+	.ascii	"\244uJ\362=\305\203\323\026\202\221\357\251o$\337\322\226\206"
+	.ascii	"%T\223Q['\033\247\251\276\221\264KK\257\256RM\2649\224]m\327"
+	.ascii	"*\365\034\325w\025O\352{*p\351\345S\035@e\227\233Q\377\312\240"
+	.ascii	"R\357\323(X\221o#M:~K/\207C\325\221\243\354\362*T\247O\211\246"
+	.ascii	"\f\363;j\221w8x|7\274\337\271\351ZAd\317\r\335\363\233\310\016"
+	.ascii	"\2355J..\317\352\2205\\*lP\203F-\352\333\206'\235;0Qv5|\273\341"
+	.ascii	"\345\021\001\001\312\f3\332R*\031e\017\345\217\326\311n\t\371"
+	.ascii	"\206\n\242#\267\364\202\023\002\027\344[.\212f\310\007@\304\274"
+	.ascii	"\261I~|\003\201\322\231\226\371\341\305\307\267\033\336]\367"
+	.ascii	"\031\225(\017z\264\261\261@x|\367\210\322\331B\345\201\366\364"
+	.ascii	"\355\026\255\013L\341\244\205\031u\001\2252\255z\250\254\322"
+	.ascii	"\216o\247!:c\325\035Xh\370\236\342\221\371\353\240\351[\252\023"
+	.ascii	"\306\214\266\370R\022Q\026i\235\253\033\347w\323\021\035+J\256"
+	.ascii	"7\316*:\276\247r~\0340Q\2312\267\364\3154\245\023E)g\t\253s|"
+	.ascii	"\303E}L\367\231V\037\n%+(l\335\374VB\242\003]z5\273\331\204\371"
+	.ascii	"\r&\372|\353>\323\342;"
+	.ascii	"\261\374\226\352,\321I\262\206)\177\251Dg\312\251<\222\364\r"
+	.ascii	"f\272\327\203\243\210\016\221\265j\206\307\301D\307\006\0363"
+	.ascii	"\324\200\364\355\206\327\305\215\t\031\204Pu\200,\371z\250\353"
+	.ascii	"\363\306\313\340D\247\207\220\033:O6\276\341\242O\266\3563-6"
+	.ascii	"%j|Kuv0\243/\250:M\312\250\022J\353\\\235\311\257a\245\303\264"
+	.ascii	"\364z&ur\034}\273E\237[\272\317\264\3346@~Ku\232,`\320\315\004"
+	.ascii	"\036\211\305\372)\271Z6\311RJ\0316\201\027\366\031}\273\341="
+	.ascii	"\317\272\317\264\246t\032\034\277\245,\0373\252b/M\321\037\333"
+	.ascii	"(\271:\216\325c\331(\273\372\313\232%\312\260^\013\026}\307\345"
+	.ascii	"\021}\257I\2672\240\361\021\370\2414xd$\360Cg\354\352$ \364\021"
+	.ascii	"(C\206N\212\320\214\247!w\202\215Sv\271\035\234\024e\230\317"
+	.ascii	"\315x\327"
+	.string	"\023#\343}nl\n\203\342\003\275\361m\t\245\202\005\023\f\023\364F/J\256\256\203vQv\265\033\265m\032\364]\027\343\201\330\224\\^F]Sv\365\037T\255\341\304x/\203\300\027\323\224\\~\207\246\354r\27131e\230\303A\340\375\316\354\347\035N\214\310\005\013\370\006\374\003\312\226P+\250cK\250\0366\007\374\003\304\224\\}\006\032\246\354j8*\030\030\250\003\276\3170\340\033pE\311\345[\250^\312\256\016\204Z\3519\fx\337\202\247\200_@\025%\227\353q)\273\334\216JeM\031\346sP\005\274\353MI\300\373\\\364\371\325}\246\005E\342\205\207\341c\370\226\262R\330,)\002>\206(\254\225\222\253\355\252\224]\r\007e\212\200o\273\003<\fZlT\311\345fPeW\003:i\276\003\274\233\031\340_\330b\231(\271<o\211\262\313\353\240\254\364b\225(\277Z6\311\022N\031\346q\324f"
+	.string	"\333\253\001\336\363\242`\354\024K\305"
+	.string	"\356*VbQ\216\215\261\275\026\340=\016\357i\345\317\202\025\236"
+	.string	"\357\302\221%T\013\266H\260\253\205w\341\211\324y\324!J\263\026\321\306N\215\rQ-|\347\341\261\360\004`\241\220\034N\210\322\314Ad\261S\303\006a\201\260\360\0167\200_\201\365\201\364f\3202\266\207\322\314%Hb\247\206\345\301>\r\340\337,\312\305W\001\n\037\200\027\300\267\224\335\261\204R\30161\177\364P\203RTx\001\260L>]\007=c\227\204\330\321\2619X%\025\276\353\242)|"
+	.string	"\002}|\013\024P\210\035\335\337\234\024\336\267\234\360(\310\361\3617\324\263\265/\211\035]\034\276\023\336\337\340MaC\001\214\007\300\233\260\267\204Z\001u\023\214\226\360&\254\361i;\252\236\024\273)\325\274\022\276\355|\036"
+	.ascii	"i||\rM\026\273)xT\237\367\265\350\213\207q\306\307\371\322V;"
+	.ascii	"%\233;P\306nJ\235\231\027\357|\321.Q\306L0\302\263x\027\337\322"
+	.ascii	"\225\314\022j\305\324\\0\252\305\2730\261\302\371\364\2311J\266"
+	.ascii	"\026\221EL\230\026\337gHx\026=\253\233\217\263Q\301(\331\374"
+	.ascii	"C\231\351\027\022\336\331\360D\370\021x][\273\370\370\037\264"
+	.ascii	"\331d\n\201Y\251\266\266)\331\034\002!v\320\225\013\2337O\331"
+	.ascii	"^Ex\377\213v\271\232\362\204\260\205\031u\201\246lSzi\235A\035"
+	.ascii	"+>\204\351j\206\324\"\262\330-\221\226\255\370\226\203\342E\002"
+	.ascii	"\025cX\374@x\025n+\230\035\325\327\025\020\240\335gR\332\350"
+	.ascii	"\"\370\300J\0256\036\374\007a\326-\237\016Q\246n\316\024-\017"
+	.ascii	"\276\335\242L\302 H\361-]\2430\243+V\254\247v\360)\306\254U>"
+	.ascii	"\035\242K]\034\251+\315&\223\212\356\302l\264BQ\306\351\314\201"
+	.ascii	"\261=]i6\233!\364\312kt}\242\234#\2434c\307\366\332\3017\030"
+	.ascii	"\274$_\017p\360-]\235\254L\230Cz\250\237\205\3429x\237*\357\326"
+	.ascii	"$>+\325\212D\211\247L\243\314S\346\261\275\242\350R\265\326\347"
+	.ascii	"S\016\234\370\226\256R\314\350\013\350j\344\247z\376\304\373"
+	.ascii	"T\251\267\022\361Y\207\254O%\033\245\033\345\236r\217\355\265"
+	.ascii	"\207K\325Z\027\230\221f\030#L|K\327(ft\305\n\265\204"
+	.string	"\352\241~\024\263\222o\005\262\372X\177(\373\224~\312?\345\037\333\253\211\017\021\005#\302\325\200\006_\342[\272\362`\376h@\352\352\304\264\352\352;7\370\022\312\300\265\311\271\301\273\034^\006\257\301\217\210SZ\231\226Kk\216ui\251\203\233\226;v\260\275f\360\036\310vgt0\320\313\036,\006\337V\306\360\230\\\0163/\237\202\201\313\036\200\030|\227\365j\244J\332\007f\203\210\013\3460\243+\240r\226cz\250\177$\376\0028A\276\245\327\217e\220 l\257$>D\364\t\325}&e\b\335\002<O\301[\360-\r\276YB\275XF\265Nw\323f9\244\207H\353\3642\317W\342\n\336\202\"A\275j\005\337px\023<\005G\202j\322\004l\234QD\032m\024\177d@\032\037@\036\223@E\031?\307d\215b\003\034D\202\307D\020\t\035>\n\301GB2\024\031\230Q$D#y<\022\035\375"
+	.ascii	"!w\370\310\210\254\221,\032e\b\031y,B\032m\034g\374"
+	.string	"\354\314\250\021\303\030\344\262\261\306P\321\306\217q(H\350'y\244q\024\364\301\003\017\035\201\216\311#\322\350\207\350\206\321\017\b&\272a\364\023d\004*B:*\252\361c<\252\361\201\221\306 !\033G\244\321\217\f\310\241\242\020\322x\264\363cL\026m\b%\201\212?\306\240#\021R\2508\202\217\206\214EEE\032@?#\212CG\243\037 \344\007&B\026\177\222GH!\031?E\307\237\241\"\320\0023\212D\034\270\030\243\003\003\001\0259\360\f4~d\030\271;\035x\006\032\037@\360\f4\2102\214\206~\214\310\342\215 d\221\306\316\317\215\"\022\007\016**\306\b*\032\203\204D5\216\202\204\2148\360\220o\024\221~\200\200\212\035\2147@p\321Q()tTTD&\177\202\220\305\033\310\243\214 \243Q\206\210\240\241#\215##\222FR\004\033\203\216D?HI!\033E\344\214\037\241dQq\347"
+	.string	"EB,$}\202\204\214>p\221Pq\306O\220\220Q\0076\252\021T$tC\210\003\313\220qL\326"
+	.string	"\242\001\224<\026y\270QD\362\3003\320\370I\261\223\002\004\317@\343\347\350\250ht\3438\364\341\007iL\016\t\311\370!B\032\223A;3\212DCF\033\306\241\033E$\0356A\005\027h"
+	.string	"%\205\214\204l\202\n.\f\r\035\221-\037%\205\210\204\206^\026\b\331r\020\t\023B>\002B\n9Y$t4\222@\321\210\214\361S4Jz`c\262\210\374)\032%\205|4\222\301\370\203\244\221\024r\220\020\321\017\222F\262e\032'\214CB2\216H\243\037c\262\210\034:\"\223EG \024@2,8:2\002\035\221F?ABF;Lt,2\006\375"
+	.ascii	"\025!\021\215\216\307!!#\217GE\306\027\222EF$\262\006P\007\226"
+	.ascii	"aD&\2131l\264l\242\006\t!\033g\024\223CG\033CCF\240d1\206\rb"
+	.ascii	"\262\030\303\206\3135H<\247\320\301\017\020PQ\207\203H\230\b"
+	.ascii	"\"\301\362\3132\220\220\201\203\225\215CE\240\243\237#\022i\206"
+	.ascii	"+C\221\350e\343P2yD\322H\026\t\021\275|\024J\026\221<.\264.\270"
+	.ascii	"\034D\342y\250h\003iL\026\t\361\250\340\262\221\250X\304\223"
+	.ascii	"\224QD\226\340"
+	.string	"\262\221H(\231D\026\223G<3\216+\200`\226\215\311b\020\2538\361\301\t\016X\241\"d\013.\037\221\340\321\340\210D\006<G$x\216Ht\340\242\243\320\221\220\r#r\207\2234f\b\r\311(*\032\207Jx\371\210\304\263\321\b)\311cD\026o\020!\205P\350\220\f\362d\221\n7\216+|H\026\251@c\206P"
+	.string	"\2225\214\2225Z@\036\223G\242\035\0315b<\003\235\220\341\030C\002@\305\241\030(\212\204\212D(\200\220G(NH\300G##\022E\362xD\242p\231\231\305r\364/\341\256\212;b\306\026\354f\262]\326\355\034\26733\266\347f\262\355\367O\314\334~\3170r\374\022\343"
+	.string	"\353.\353\017]\327\fC\311\377>00\260\206\007\310\3715&\227\007\350P\rMw\337\267\234\377\251Sjik\230\306\344j\207h}\377e\366\250\324"
+	.string	"\317\3049 \216\026\351k\265\252\305)\323}f%\n]\003\340|\363eYn\265\032T\f\207\335]\353|\201\224\340{\236'7\321\3148\322\340\310\363vj8?\327}f\345\b\035\003\334|\357y-\267\332\254\013\316\233\357=\275!\225\2557\337qx`m\276\335\340`3\324\032Ji#"
+	.ascii	" W"
+	.string	"R\270\005\260\371\226\016\263\230\3216\243\016\257p\270\301\261\327:]\2705\337lp\360\r\241\f\237\254\221\273*\013\243\200\274o\275o\351\020\272\334\3522\367\313\260\t\216>\034~\255\323\005k\252~\353\341\370\033*\031&\251~\273\341\201}\347\341\b\034R\r\247\324\2440\347\212\fL\002\322|K\207G\230\3216\033\026IRZj\235.\0234\337it\f\237\303!h\340\256\310\274\304\200\367-\035F\r\241\\!\324o\274\246!\220\341\017j \027\004\334}K\207=\206O.\r0P%\355\030\322\220\3644t\016\233\222z\374H\n\022\204\355\265\357\252X\001\252\301p\346[:d\032\346\330\263\373>\363>M\202\022\006\372\b\001\355\376\372\320\016P7G\316\020\317\314w\235\020\216\220O\311\305]\305IQIC\206\260\275\266\2317\353>\343\332\243{\241\314\2336nd\276\313\020\021\352!U\311\314\351#k\206a"
+	.string	"\272o\251P\215\020\315\320l\356\233\256\210\360\016\251\301\234IR\322_\354\346\304X\315\351\302R"
+	.string	"\271o\251\320\214\220\314P+\356[\356\210P\316\247\341\342\222\2244\030\270\2706V|}`.\300\211y\033\"\031\363\r7%\234\372\264\033\225\223\220\b\277$)\351)\264\331d\312\022z\031#g\305\327\345\325\202\2306f\264\311\204lC\037a\276\3050\021nI\013\003\247\257\n\001\336\316\314\334\270}\2779\021\222\215\271\301\351\332b\001\f\226\260\267\3517\230\250\360\212\327T\312\n_\276\245\302.f\264\267@\271\222\240$Y\265N\341\227\227\357/X\302)Z^\366\260\006\320\345[*\214\"\304\022Bi\373\356\022EX%|\"\204\222\244\265\225\304\305\325\366\246J"
+	.ascii	"\\\276\245B(3\332\322&I]I^\255SX\003\3337\227/\241\022$\302$"
+	.ascii	"IaX\222\306\306\330\326X\275\351\212\252\2606uD\350T"
+	.string	"\373^+\023\336\360\024\022I2;KJKc{m5\275\256&\001\330b\0033\352\002*\254\201/\355{\313\373TM\030\304G\370C\b$\211\255-\311\213\027\266\327N\313S\222\002\332\267T\330C\370\324\342\235}\243\275O\247B\032|\204Mg(\300Y\251\241BA\313\267T\250\203\031e!\\bB\365P\3338\263o-\357S\247\034[k\351\320\322o\263o\247\224%\017\344.\373\226\376\003\177\31659<\220\277\335\332@\244\277\0260)\314\230\244\2708\266\327&C\341\215\325]\337\221\023\260|\217}K[?\346\217&\353k\321\262|\217\315\265p\366\262\264\3307\0262\255\033\2446b)\310\261:s\203\t_\337a\337\322v\r\363\207\013h[eZ\365P[\257\006\373\0163\323\246A\003\366\375\005\357\312\367\227]KE\272\273\222\202\030+\273!%x\331\231i\243V\276\275\356Z\2729+]\254\352j"
+	.ascii	"@W\034uL\033U\345\273\013\257}s\253R\027\244\031\206\017\327"
+	.ascii	"\267\264\235\266^Z&*\337\\iZ.HlT\270X\305\365\371\200\261\245"
+	.ascii	"\226\306f\312\367V^\253\305lJ\\\327S3\214\027Z\337\322\266\254"
+	.ascii	"\035\323\221\223\362\255\225\244\327\212\265aR\276X\301\005\207"
+	.ascii	"\002\250\323\260f\221\200\246\310\2203##\"\222$IZ\003s\033 \b"
+	.ascii	"\007\2224K\241\325\003\023\300C\b(\225a8K\324 4LB\223K\312\003"
+	.ascii	"\21398\t\2258O#\311\215k\304\364ME\350<y\343>S(So\213\376\206"
+	.ascii	"\324\001V\031\315\030\342\207\252\342\360rq\271\006\240a\227"
+	.ascii	"\333\327\206\374"
+	.string	"V\355,\243\234\205\264\234\\y%N\362\210sr\232\f7\204\2136\330\246a\241\333\334tU\264\366B\007t\326\204Dsh\201\373\2601md\310\205TP\026\267\331u\023\021\262\323\301\b\214\233\005\253*C\237\303\323\273\215A\223$\317\201\304e\224E\007H\374\273\016\261\323\005O\364(\332\237\327\004\017\223\231\0034\266\241\224\2018\273\252\222[\267I\\\232\206k\375\373ff&Ly\\]&F\323\257\3743\251\222\305\212\211Vs\240\247#\344_\210\205\276\271t)\215R\r\007\266C\253\230\316\242\206\321\321[\204D7\013]Ly\024\310\375\242\263\270\003\023@vO\247\375\360\017A\347q\3512\366\016b\335e\334^\210\336;\336\007\320\256EC\035\231\367U\036\235\336\325\201\2019\031S6\343\371\311\2604\3357|b\3359Dlr\331c\244\366\254\025\364\227\004\"\216\0321]It\301\342\247\331\030\305{"
+	.string	"\257\244m\351|\3174\035(f\f"
+	.string	"*\355W2\376\301b\244\204Favt\367\351\013,\205\332\331\023+d\346\304z\364Q\242H\314\f2\254\301s\360\214\347\344\236\241\321\300\366\350\027}!Q''w\365\301\356>'P\241\361"
+	.ascii	"\205\223\312\366^2i\362\274}\242\253\025\222a9L`hP\211b\004\366"
+	.ascii	"|\330\322\236\226E{v\n\355\351\037\337*\177O\216\216?io\255\373"
+	.ascii	"\305v\026\257\311\374\211\364\346\266\333\333u,C\337X]j\251\215"
+	.ascii	"\f\323\030\ty\342\205\235\352\265d\213#z@\334\022@o\210+\215"
+	.ascii	"\0270\261\233"
+	.string	"\352\304\001\372]\025\271\242\005{@s\b\241\263jP\006\n\236\255\273\fb\323\305\232x\322\213\006\311\214\b\336\031\237\217\341\016\2124qPm\023A\202\234\034K\277 \202\314\355L\363\021\021\030\240l0<\332o\307l\337QX7\240jJR\177:\317\247\206\276\216\240\023\035\262\376\252\032\276\261c\363\323\3404c\360\303\241\006\033\f\232\321M<-\366\327aR\n\221\276\013u\224n\300\211\354\375\303\030h\253Pu\311/g*\343k\025\256e\253\2406\"Jt\353E*\016\37498\206\t^Vz\230I4F\033\234\335\330\326\2559\262\003\201\243\306\365\365\236\265=v\342\023\024 4\227\345\0345\366\003\254q\n\b\027\304\024\003b\302\246x\236AV =U.\037\226;\204\001P\r.4\276\313\350\2306\244~\t\256\334@I\202\213\234t\002\3250\211\221\261\207\306j\336\t\240m\003\240\3019\207\033~h"
+	.ascii	"r\003\006\314\273a\313\033\273\304^-\243\025\252\"\033\317=U"
+	.ascii	"M\352G\324\360\002\303Y\035"
+	.ascii	"\272\375\3148Y\204\306bh\250\376`\216\354\366\2174|W\025gHG\237"
+	.ascii	"\253}\277+\351\271s\237\255\247Ga[\353\352=pW\005\350\003\215"
+	.ascii	"\351\245I\333-\337whW\302\352\211\342~\020\001\366\"\250U\250"
+	.ascii	"at\001\210\344\322\221[\225\365:\310\337\035\207\027n\300\307"
+	.ascii	";\331s\256\304\320q\336\027\002\211,\030\352c\026\361\002\f\367"
+	.ascii	"\016\226\344\274w\335\322\005Q\222O\377Y\002\307Vi/\r\375\277"
+	.ascii	"\006q\305(:\205a\324\r\0210\313\261[i;\352\304\250\234-!Q\346"
+	.ascii	"\212/++\261i\031\2237\234\270\031\307l-\335P\367\352\003\270"
+	.ascii	"\034\253t\273\313\334<\236t\373\025\327\314p\374MeFfy\222\252"
+	.ascii	"\007\226&\270<\204\344\256\302\370v\267q\315\365JU\035"
+	.string	"L*`\027\347@\256\021f\034\273\321\274q\307+\"\235\227R\315\223\031Ek}\357*a_\315\"X\342k\261\240\312\243|\221\204]\324\025\t\235\022j\350\203\261\035O\260/m\301\031}\362\205\331}v1\3363z[ \340N}\007\0174\375\374\037#6&,a\351\2304(P\205\241\300\3322\231~\276v~^\214\370\331\215Jz\231^ Jl\340\265R\b\340\237\314V\374\331L\221\022\262\250\362G\224\231C\317\203\265.\260\310\352\364!\323O\300\345\316\237L\210\022]\021\272y\235\f~\343\226Jj\355\347e4#NG\344\\\t{\031\336m\343\277\204\b\001\262\347\370\004\353{\256&|\261e\017\244\231#\r\261A`\tE\324d\246\264V\360\300\312N\255]\302\341X!\320\364T\022,\003;\235d\003^0\334(`$+\247\350\211\001\206\3340yYU\2678\002j\207\271j\262\375X\303\013\370"
+	.string	"\230Y\356{\324\2524D\213a\271.\267\365\026H;\212\r\352b\250\346\370\360\341r`\257C\241\215+\223l\261\333\220\211\374\357\230\027y\251B\325\310\217D\357\"U\324\314\251\260l\036\264\035:qy\027\\\335\fC\353\373\0241G"
+	.string	"\231\347F\315\262\226\331:\016\f\320hS\366\024\323\356\223#\2174H\315_\020n\306q\240\310m\226\3071\265h\f\320&\243I\035\235\202\202O\237k\177\201 <\216\251\3305%f\277t\3428\033H\314\376I\216w\2363\367\244\371\231\326qt'\n0\\e\277\311\232L\346\344Xg\031t&\232\027d\016a\306\356\336c\343\313}\304<GK6\215\265\334\t7\243K\037CI\344\335\266Ad\036^\262\035\246\311Ah\006\335\003'\024\375\341m}>\243\266\203\272\351\234\234\"r\006N\215^\003\005\2535_::\205\272\324|/[4\214\227\341\222l\266\344\247n3\3004\201\2739@b\016\312cM\211\343\271[QL\3278\211\270m'\032\266\367\3420H \305l\266l\330\317\355\216\2542\342\257"
+	.string	"\034`[\004*F\325\231B*\217M\321\207k$`\333P\203\0248\277\366\207\201\305n\370&3y\245\364\301BxF\036\210D\031e\311}u\372E\215\257y\213\005\032\236\312\177K\261\220{\207)\216j\334\256\2312\f\311\036b\246\n\347x0\337*\300\225\320\366wa\300\2425\242\257,\306\246Q\306\212C\341\353l\201;qxW\2674,w\270\261\004\004\252\265\233\262\024\353\315(Q8\314\247J\365!9H\367\246\325\237C\341\376\266\327a?\257\346S\276!\307\331\324\027\\\337\357\226\202\032w\264\\\302\203\224h\373\214\3002\307;\256vD\bkzV\237\261HDd\257\343\022\257tBe\347Au\215D%\303 \352\025\211\246\020\317M<c\211\022c\266\n\256dO\205\245\230\204\340\006X\235\317I\255\017\246Ec\027\333\211"
+	.string	"\276\317t\376t4\276>YC\365d\027u\312\2339\310\333\301\361\030\007\353\356\2403\026(\362\203n\022h\342\2159\002f$\be\301\013\267\266\265pa\001\0332"
+	.ascii	"Jyr\261un\251n\257\232>I\363\240\326D\026\036#\"U(f\247\264\312"
+	.ascii	"\r\334\030V(kL\212b2=<\227\201\207>\0216\217\302\232.\313\316"
+	.ascii	";Z\026\"\211\177/%cX \275R7\261\3139t1e\356\224\261\243e\001"
+	.ascii	"&\177+FpQi\264\276q\221\004\030\231^\007\246\357\321[\362\377"
+	.ascii	"\227;\27686\r{&3w^5\003\031\322\240!\317q\354=\027s\221\246_"
+	.ascii	"@l@\363}\251\224\237O\243\276[~\227\035\354|\b\336\365\316b\347"
+	.ascii	"\031\244\243\371\370\262\320`\002K\006\253\343;\250\200\272x"
+	.ascii	"-\021\230"
+	.string	"J\257\243\203\251\374\252\275\300^\026\364\241\256l\234\313g\326\347\353oY\307\257>\353\213\235\313\317\255\333N\373\226\272\215\177\342\266\247\374\213;\030\n\200M\375\347\226\"\266yyh\013F\300\240f\022\271\254Y-\313GZ0\002\026\335\275\344Aj0a\2062K\310\002\215i\031/R\203\t7\224YJ\026j\f\313\360\2204\214\260A\315$rAcZ\206\207\264a\204-j6\221\n\032\306b\272'\004\215\310X+d\242P\005U&\341\230\277$r\007C\263\377i!F&\337\256g\022\302\030\261\031\314\351t\265\363\312C\b?\254\224\250\234\375\274A\300M\336\332Dz\376\220\231\250y]\255\002\026q\255\316\275|\fz\333\026\311\2030\375\345\355\264\n\305\030\345\340(\225\311f\313x(\032\343\032+7\002N\f\340\234\003<\226\245v]\260\365\033|\227\343\t\n\377\307\203,T\001\205_\326\305\262\277d\221"
+	.ascii	"\257\351\274\240\254OxN\f~<\032\203\270*\204\230\345\374\203"
+	.ascii	"\244\201\250\264\351\325\\\202\3360\220\027zk\265Z]QUQ\301\234"
+	.ascii	"]}\237bC\342\253\265\273O4\264M]\371{y\335w^a/jG\244\254\fJ\230"
+	.ascii	"\367\266H\253\r\244\324a\216\220\021\315R\217\311\221%\273\224"
+	.ascii	"\004W4<\323~\326\215\306\251\3248>:~O\350m\030\264`\013\017\021"
+	.ascii	"\210\200<C\017\002 \370\220\217\375S\256\225\017\002\t\302H%"
+	.ascii	"\222\371\200u\250i&\2312\231\363\230\017a\r\263\256o\255J\362"
+	.ascii	"\216n%\364\032\306\346J\226\024\231\345\2527\334/\270:\304h\250"
+	.ascii	"H\002D\376v\326\342_K9\236R\033Qu\321\263\262W,\037\245\257H"
+	.ascii	"\374%\272W\356\352\242g\336]s\035\251y\241k\025\213#\255\")\254"
+	.ascii	"$\265\"Q,\204\2250\322J\221U\ne\"\271\b\251B\251,\205\225\244"
+	.ascii	"R4\232\205\260\022T\212D\261\024\256B\252R\244\225\2272h\206"
+	.ascii	"\212\376\213H\216\323\005"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.154.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"]\f"
+	.string	"6\027TB\020q\224\016\220\230\2015\017"
+	.string	"r@i\023\312\276\201\320@\037pML\210A\243\002\002p\205\363\365\243\206<\321\302\252\026\263\025\314[\t"
+	.string	""
+	.string	" P\210\005\020]\276\360\020\373\351\373\336N\016\331[\312\224\002@"
+	.string	"A"
+	.string	"@"
+	.ascii	"/P\035Z\263o\234#"
+	.string	"YLJE\007\224\216\335\275\264\204\226\332\237\246\346[6\322\2375r}\tPB\240\004l\245\307`\205\n\213w\317\220\315\224\t`\263\273\316\323&r\303\333\216`\033\202},?|\351\324\364-\0045JDn#\306\256\207\270\262*p\306\t\333\277\330N\356/\264\237h\300\020XS\027\362\300:4g=\355\267\270\013\355&\033\034`W\004\f\031\273\234\003k\254\303\005?P\035\276OA\261B\242\317T\251\234\216\206)yx@\2141\3073\3255\365\034@\224\216:\312\005\277\304\242\217\374\351\243:\274\276\373Ka\"\265\343\003HF\233#\245\222\260\2571\306h\035a\377\344\257n\022\330\b\223\360F \017\006\017tG\223!\343P\350`\0258\027h\002\366\271:!\321\245Q\340\314\202't\215\262,t]\270\375\006DKN\003;\222J\301\261\3346x\366\370\333\335}\226\254\024\252\375\311\362'C%\005\026"
+	.ascii	"`\251'3\340\324a\233\205\225\"h1k+0\230\250\006@@\213X$L\344"
+	.ascii	"ICa\230\320\3205\240\030F\003\34175\005\356\005SS\306]n\252="
+	.ascii	"\032\230\332\003"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogArmingBeep.155.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\375\001\375\021"
+	.string	"V\241vG\340\360&\0358\323\316\007\312\003\333= A\354\327\350\315l\254\313\267\"6\225\320\367\376P!T\272\270\255\216\244\237;\017O\261\346p\270\261M\034B\031b\034[pm\236\335\205@\r\363\300\270D\035\203Y\262\211\224)\005a"
+	.string	"Z"
+	.string	"e"
+	.string	"\336c\367\021\357\321\236\261\277\307\177~\331I\003n\226F\001\022P\016\221\323\356\246T\304_\367b\247\371\362?\373\007\030\243\271\007 \346\341\261\303\273\216@Q\017QH\314\2463`\0027\373\355&\265;\251\201\313\t\211\341t&>=O\237=5\304`\231(\007\273\353\004c;7\352\266Wl3\260\023B\250\264a,\344\301\353W\320\214p0\245\261k\260\324\037\373\335\356\256\325\307\3264H\227\3764\255\232NM_D@\222l\3479\030\273\033B\035\213\2132\202^\373\355\373'~\233\371\220\023\004\031}\027\362m\247\035\305\3535\231\357\316\036\224!\215P\332\325A\360\350\024\217\307\223\227\004\235\376\034\305\003\321\325\315\206H\030\206MG\361>\005\321\343|\200eh\337\305_\260Z**\336\343\247\277\275+A\342\350\211\307+\267\261\224"
+	.string	"\355\356\202\220\233\\\023\270\244\312\242#\002\227To;I\f\032\215\347@\204*T\177\234z]\335r\330d\316~\321S\260\3702\267\270\242\357\362\036S\013\340\340\251\311\320\001\252\030\325\203\030\227\326\205\326\207Y)\030\\+\026\226\212\302*\345\262\242jI\261^`R)&vUh\275\244b\\\256\227\324W\253\371\354\317@c\302\325(\314\223\351vC4x\355\267=\200\322P\2063<\200V')I\226\303Q\013\245\255\355\201\307\347\2168\222\037\272-\202'\024d\344\004\372\022<\3776A\225\007\035}\203I\207,( @\002c\030R\036\240\352I\002z\230\223a\345\002\322\261\267\2647\366\272\371u\302X\240\005J\257X\354\255\272\023\354\254J\272\213P\305\230\350\r\303\266\017\347zM\020\317\232\226x\340\210\3059\023\027\207b\274;\020\301O\324\b;!.Wh>\202"
+	.ascii	"wpm\f\344H$\262\310\373l\313N\006x\017"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogFlightMode.156.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`y\002\215\024"
+	.string	"\226d\202J\300\322Q:\212\022\202\207f\336|\274\210\003\210\330\233?\201\332C/\002\373\220\020\020\332Cq\302\235\313\0010>\332\257\217\3219\252\032\025\3604qE\301f\263"
+	.string	""
+	.string	"\222lj\240|\316\367,\310\003\360\312\373\t\213\326\366&[&\031k"
+	.string	"d"
+	.string	"r"
+	.string	"+\226\212\234\272uRNWEu\272\273\233\324S\325\007\324\323\335\232\335\360\364\341\312v\233\n\334\364l\301\222\316\303\220\220\356\026g\212\313^)8Y\266O\261\214\220\266\331\353\312&\3424\304A\360\204\310\304\020\211\315\006L\300\342\007t\337\rO\022\033\016\210\240\273\017t\316\261\325\230S,\335\275L\332n\337\324w\327ew\033\354\262\214\257W=\275\356E0U7\355\344\236\350.\\\366>\247\373\002\243{X\215i\340\223\237\177\021T\376p\346lwW\343\211\333=\330\023\305.\310\033V\336\025\345\255 /O\336\223\020"
+	.string	"bt\373\020\037\335 \312\250\376\321\243\334w\377\356\367-\356\253yoWrL?\335\035^\267\347=\350B\262\357h\336\267\376-G\251\253\031\316\343\224\250%\335\006\205\n-\334ROW\363\276\263\n\245$\244\231\363^\273\222\333\361Tg\r\327\253\004"
+	.string	"\017\236\243\323\230\351\275\300\304\236n\232\205zZg\305E!\345\214\340\271{\341\274\321\244\247\273\031\234\3741c\334\373\360<\357 TN\307\023\017\215K\356\356\331\234\270M\371g\313\327\303\206\2416"
+	.ascii	"\203\337\033\365\272\033\275`<\306\350\n,\031\326\003\031\030"
+	.ascii	"\027\007\327\310\216*\035b\255\227\221\205\241%\302\270\260`"
+	.ascii	"\342\030\263AT9\260\261\f\256\030Q&\026\213\021\303\035\355@"
+	.ascii	"\377\007!\022?\332\254U\032\260\373\204\003\336\0058\365\270"
+	.ascii	"\314\241\352i\235&.\351\035%#\247\336\265\202\3233\021z\302\357"
+	.ascii	"\235\007\241\006\345\230~H\003\217P\367>\t\023\370\344\3229["
+	.ascii	"&\236\";\340\304\035\245\206\263\345\303Q\226e\2208 P\2021t\310"
+	.ascii	"\035`\352\311\003v\370\202\302J\t\370\316^\211]2l-\336\272u\304"
+	.ascii	"\tm\201Y\240\223\210\255\275#\354\324\222\254%G\301\2279\034"
+	.ascii	"\334\253\244;\253\327\220\006\177\240a\375 \204A\204\016a\031"
+	.ascii	"\303\001\210\003t\262\f\201/~R4v\020 r\320\246\221\002\330q\240"
+	.ascii	"\035'\331\201;\235N4]f\033\034\023-\202\330\033A{\343\365a'\210"
+	.ascii	"\203kcb\216\210\260h{\266\324\346\233\333\332\240\007"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogLoopOverrun.157.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\203\005\375 "
+	.string	"v{\317G\200\234Q:\237M\367\332\332\242\001\354\333<\224\202\216\212\017P\027`\r\036\261\273\252\346 W\344\r\225\262\375y\255E\342\200qU\337\262\235\261\262\2151\265)\t5\363\370|\312\344\245\f\327["
+	.string	"~#\215l\"w\222\001\275"
+	.string	"\247"
+	.string	"\303"
+	.ascii	"0n0\371\032cd\336\n\221\304WA_\224!\340\236\271\367\261\371z"
+	.ascii	"s\274\227(\301\274e\242\311\237r*\350\263f\374J\335SY}\3519\336"
+	.ascii	"\333sp\313E\346\355\357m\345\255\200\017(o\031e\026\013\202\272"
+	.ascii	":\b_^6\214w\356\275\2676r\364g\215f\316JKvE\371\272\2373\243"
+	.ascii	"\032\325i\344\201- \306\237\351\361 \027\b\301\260\336u\005N"
+	.ascii	"zT\325\374}FBx\343\243\372\231\336\217<w\210\251\261Q"
+	.string	"K\005B\244z\334\222\r\262\224\031\001\370j\220\005\240\354\260\240*9\365\006\340{\"\205\356\275\347z\215\3629\325:3\272\367r\345\371\244\316>g\346\"3c`\266+\002]\376\003\306\t\216\355jZ\357\275\272\356*\240~#i\231y\252x\230\277\345\\p\374$\234d\242\236w\3137Q\336\276\377\003\212\t\177\273\232\362Y\231Q\250\250\347\001\365\271> lx\005\346\324:f\242S\355*\346\223\267\2110\333\312Df\345\241 \333\267\316@/\236}f\225\317\262rmV\231VV6\313\3123[\271\264\225\255\255L\332\312m+W[\371\013\020\f\301!\365\2620\367\352H\365\\0\353\005\370\254\277\370o\275\231\317\307\362.\346\223\233~\205k\301\363\226\271\211\371\274\375\207\327:\027\237VnD\277\025p>\324\372SA+d\264f\256\360\241\2052\fw\223\201\326\357\005\255\b\315f\326P\353l\370\032\263i"
+	.ascii	"S\262Y3s\370\260C\227\361p4\037f\251\260lf\020\037\342\002X\335"
+	.ascii	"{#T\016\3610\021\346\275O\021\370aJ\2140\223\334\226\035\003"
+	.ascii	"\270\207,\313\366\027o\316\217+\311\266}2M\003X&4\177j\007u\365"
+	.ascii	"\032\312\351\366\"\323\360\346\004H\323\364x\\\t\324\335\006"
+	.ascii	"\240\366\2445~8\325tB\032\326\233\311(m\335\273\364\352\247\326"
+	.ascii	"f&qT\317\2635\0316\364\002{j\235\226\2577G\312\031\344\275B("
+	.ascii	"<\353\017\200cd\307\342\237\004\331!\306\326F\322j\363\245\366"
+	.ascii	"m\214\007\331U\307\225\001LJ-r8\253\324bi)\311Env\304tt\201I"
+	.ascii	")\311E\022\215qE/rH(pG)\220nJ'\216T\334pK,nE\t8\267\"i\351\306"
+	.ascii	"\224\313-\335N\342\356\344m\"l\264k\247\237\347\372\317\261X"
+	.ascii	"\323<\246\325\355q\023\263X%p\247\312h9^\342mp\373ZVsP\177\345"
+	.ascii	"C\024I)%h\274\303\023:\252\244\344w\241@\264I=\217\337u#\250"
+	.ascii	"\326=\271\001\323\243u\025\333\262\2449fA/\022U\306\245\264\265"
+	.ascii	"OG\235AId\347\f\312\241&\242\3631\364\t\032\005\275B\257\312"
+	.ascii	"\333\241~\327I'K\312\220\375N\341\207\026\340`\375x\366}\004"
+	.ascii	"\215\302\254Z3\243T>\354\320[\320\341\003k\250q0\305\0304c#\""
+	.ascii	"\"M\013\205\306\240\002\021)\263y\021p9Td\323\244\334\240\371"
+	.ascii	"R\367\243\t\330\013\336\250Ub\307\007\367(%\354\336,\323\022"
+	.ascii	"O\004\017\267\215\032FN\257\242]\241(\242\344\216 5\332\262~"
+	.ascii	"\373\336>\200$\277\353\223\227\234%\032\324\231kJ}D\271O\345"
+	.ascii	"\367\2772x\f\352\234\252h\034(\356\262Hw\203O\255\266<uO\223"
+	.ascii	"\330\216\034P=\3168\0225\027K\303\361\034\362\003\0026\350\320"
+	.ascii	"jh\241\245\247'=9N\022\002\001\345\326tZ\022\226<\253\001=\310"
+	.ascii	"\211.\270/\007$\362M\024ZCV\035$\217\\\266\035\376&\230\336\262"
+	.ascii	"R\001?B\315\t\003\236\242\037\214\330\r\221 4\031\326\346\251"
+	.ascii	"\345\376\302\274\206\270\342a\025\2649XHn\306\027JyS\214\032"
+	.text
+	.section	.gnu.lto_blackboxGovernorUpdate.162.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`Q\003\355\026"
+	.string	"f'\217K\320\320*\035\332]\204\340W\350\036\350P-\322\346k\2003\227\277\200n^,f\354A>\215\323>\327\n\\{\306h\335\274\363\222Qr\370\251K\307\013\340\213O\251\227\"\260:\214\231\203z\275\r \303\215\f7\023K\b\331r'\031}"
+	.string	"p"
+	.string	"|"
+	.string	"\"\013^X6"
+	.ascii	"fv\3748\202\021\323S\343\336\341\2523\\\366\024\352dBK\247Y\332"
+	.ascii	"\2562\376\354)\323h\243\002h\003\247\346\346(+BB\367\363\242"
+	.ascii	"\234\005\233\372\020C\347\302\203\350\344n\352iw\3239\202\236"
+	.ascii	"\306{\351:9\233z\362b\252Y\341VK\020\234\032\336mQnw\322\331"
+	.ascii	"j\253t0\366\343\336{\341\353\214\256V\3539r\357\345*\243\253"
+	.ascii	"9\253\316\314Ff&an\002\001"
+	.string	"|\020\017\021\343o\340\225\226z\231\227\374\026\363%\332\027\376\200P\n\354\361\354h5\311<\234\325\3661\337\336\316a\356x\020\370\233P\256\\>x\266\266r\265\225\037\340,~4\270\t\307\321\270\227&\231tW\224(8<\3703\277\360\205|b\346`\354\367v]\220\216\214d\334;D\360\222\031t=0\306}o\317(\350\336a\002\016)\275df\016>B\242\013[E\332\223\320N\361\207D\253IS\373\222\2526\245;\240[\257V|\320oG\004Z1\334;+\265\217\317\307\314\332$D\265MT\03423>\342\357\332/\321\0054\234\207\367\336\263\370$\361\205\255\"M\001\307\364\006q\310V\221\345;\332\224\322\030o\275\332m\371\230\211v\023S#\342P\314\354\201\360\016?\034?\244z\357\235u\373X\301c\246\251\273\226\032\211D\266\212\344\256V\204\226\253dIi\261`-\007.\327I\003\224\222\226\n"
+	.string	"f\205\270\274LPX%.\223U\312I\311\203\025\013\266\262\n1\300/\225\026l\305\362z\301V\247\341\275}\347\260\353\310K\201P\277\314\274\360\245\244\343.\005:\361ef\3313\315#\264\256\245l\2478\205|Z\364xvM\341\204\204#T\373\330|\361\0368\017=T\325\252\237\233\034%\264=p\027~lG\333\236afF\333v\327\002M\250aH\006\021b\206,)\243(u\220\"\222\272\363\020hV3M:\240\373\2111?\361\f\017\276|'\034\327\327\376\205\342\225"
+	.string	"d\301\330a\246\300(\245>YL\334;\256T\250\263|\004\021\244\002bj\304\201I\330\214\332\241b\205\377\232@\212\265\261`\311\230p0\311\nMj\013\371Z\262[\203\264-p\241\365@\335\232\377\214K\031\005\341\312\030\030\260\341\262o\t\244\023\222\036%$\002\312\356]Qe\377\344{\360v\025\002C\313\230]s\022L\326`D"
+	.ascii	"\001\213\317{Z\2477\370\322"
+	.text
+	.section	.gnu.lto_blackboxLogFieldDecimation.163.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`0\003\325\030"
+	.string	"\266\356\241H\240\230Q:\301\321\204\203'\261\2066X\370\003\305\001p\006\337\264\351\353\372\242\201\343\261\314\370\2116\257\254\375\327\374W\244\0256\177\341\252\236'\025\327\0059^\214\n/\237\270\255k\335H\337P\272zp\267\226\354-eJ\001\212"
+	.string	"\202"
+	.string	"\216"
+	.string	"\227z\237]~\321\215j?Z\361\271\233\337\t\241\032\232\2323\306\203K\327\264.\375;Mx\331z\200\360\3225\373\312\200\026\263'\002\025\017\247T5\347\214\255\220\365\361wG\255\235\025\312\270Z\363}\217B@Zr\272\236\263h<\214\004\226n(\275t\267\270\240\0275\344H8\225\221\206\310G\217\227\256Et"
+	.string	"|B\362\246\353\013\235Mc\017\031\3377]\n\001A\345t2\256,\013sNkN\267\273[\267]\3036\005{7\004\327a\0224}\216\026^~yzM\254j\370h\320\376\331t\203\354\237\210\311\217\013o\016;\252gXj\231P\r\213\352WT\307D5LT\273^Bu\353L\367J\265F\365\005\030\260r\344\3476\202s\302\br\231Qr\311\2163\375GW\373~\221;\245\270\021\177F\017\370\237\337t\245/\325\316d\240\213**\242\2519\347\204\326e\202\370"
+	.ascii	"a\n\373D\216d\273\254\342?\277\364\234\270.m\025\266+\260\334"
+	.ascii	"\276\354V\321\007\337}a`\270\373\243\244*,t\313\343\234sF\b\337"
+	.ascii	"}\331\003"
+	.string	"8 \250\033\017\266\266y\336dv\200\312\234s\202\035\342>\031\215|\323\345\256\007L\232\342\204\345\2650\b\217\331\327\026x\272]\375\fB\230\215\331\337x\272\256\205\331\337x\3304\350\326\272\366\270\253$W2\273\021!b\357\364\370\303\266\004\204g\264\253\373\246k\230\002\024\005w\345\243\301U\240\016)\253\335\240\265q\356\313\201\r\3159%<\207\345G\376\224\3438\227\355\310.\354\224\270Aq\003\300\263\032\036\232M\316L6\302&V\002GF\"6\3239\021\253A`\232\211\033\235\330\016\215\246\023s\375|\2769\214!H\224\325\224\317\332\274\"\316\211\243\302\217~\337g\246\2204\b%\306\225\326\320|\220TTQ\325\374\315\006\227\327.\254\001\372\337}\031N\363\363\004\204W\224C\360\r\241\217\304\241\203>g\271=v\021\030R\216\302%\237Y\233$(,t\213a\301`P\313\031\2042;\003\365'\036>\200"
+	.string	"\021^\312\354\221\256`\227E\212g$7\310\001> p\002\231*\354\006`\352\215\001\177\034b=F\035!\r\025\2408\2474\002\r\260Vnht\005\273\255Xm\303\027\016\266K\322\226(/\266#\263\230\330\262Zg%xE\370a\345H'HVS\031&\303\006\307"
+	.string	"8Cb\363@\3136\204\200\340%\353\303f\215\006I7Jz\201\005\242T-\004\032G\017\021\273;D\356\365\332\263\332a\363\360\245\305\013\021\212A\215\372\021\024h\344\021J\227/:D\264\203c\302Z\266d\300"
+	.ascii	"\224M\027}\002"
+	.text
+	.section	.gnu.lto_blackboxHoldDecimatedFields.164.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\211\006\225%"
+	.string	"\372B\250\016Fp\250M:\003Y\006\242HbR@\262\211\214\300z\335\350\273\372\236\205\222\250\215\255\317p\006\334\217mc\372\203\372D5\240}uQ\224Q"
+	.string	"\t"
+	.string	"(\240\260\271\006\211\234\3222t\304\214\020\267\256A\b!D\356$\003\326"
+	.string	"\304"
+	.string	"\337"
+	.ascii	"P\206aW\036\206\331\3065\016\206\241\346\334{\357\345d\374/["
+	.ascii	"T\254[\3416\022&\3160\f\213\277\345]\330\306%\253\274^\025\360"
+	.ascii	"\240i\002\342X\236\005\353Z\262\236x\305\313\303\366\323\321"
+	.ascii	"&\314\017\207\364&\221\255\301l\273i_\345cl+j\005\347 \275HH"
+	.ascii	"o\362\303.\246\236x\203\350\276\271\357\"\202$S\273"
+	.string	"\267\270\340&7Hor\361E\347\315\364\003\316\233\2542\247!\341\270[\017\220a\277,~\356\275\271Vr\365\350i\226mU>\200\340\326Q ?K\005je|p\301_Y\264c\t\320gM\037/qA\034\345\323\275\327\026\344\262]*\030\246\351\201\013\366\312\"7F\354|\3546G\360g-Z\341\336\313\026\030\354:\247gf\033\314|\202\371L\022GS\202\377u\223M\2348q\336\264\365\325j\266\036m\331\0367D\232Q\234\357\024W\350pY@\314/s3(\370_\254\243\262\007R\2357\337\037{\371de\263\ny6\311\\\354\331F\302\374N&\223I\356#\314\250e\251\223\235\243P\313\bR\313P\251\345\0037\313\006P\313\005n<?\241\226\235R\313\004R\313M7\313L7\313K7\313J/;'\245\226\221R\313GC\226\215P\313D6\313\270\324\362\355\304\363\320\213g\033j\031M-\237"
+	.string	",\233B\226\313\324r\243\226\355i\371\t\320a .\244X\237\025\357\216\244\240\333\306<29\331_\366\033\177\342_\374\0301\374.\26040#\277\354\307.jR|\242:\251\245~v\004\035\005\325\b\016\364\324\241\f\364\201\376\027\2456\320\017\363\fG-k=\023\327\374:-\204\204uX\270\340\177\261\361\034\316\233\270>\225\b\351\223#\310\275"
+	.ascii	"\251\031K\251\263\200\025\nA\026A\302\251\363\324I]\240\005\234"
+	.ascii	"\351\350\363\023v2\371\254\323\251\237\332\232\021h\247NR\363"
+	.ascii	"k\352"
+	.string	"\251\023\350\336\343\023\304\324M\375\343\315.\260\264\336\324\227\232\251\225\300\370\326\236\340T\352\245\276o\370V\352\217y\206&`r\256\234mA\352\244\266f\277\265\243\2765R\3377\245g\223l\324Gqn\346\341C\210\020\347M\243\026\022\022\365\255\377[\273\233\277\0211\202\004\211\363&Q\377x\006p\264\330\031\212\t\031\234\215\026\005\2575C}\036\253\331\237#\317&\247\236FkB\004\376\2310t1\\\250\330}XQ\245\333e\220q{1CWU^\305X\261\333a]\bp5C\327a\210\251\032\320\260J\361\202J\007#E.\206\013]U\216j7#\327\300\211\255d\254\330\345\256\254\254v9[\221\367\362\366\021\256\300\353^y\357\275(\3328D\364 &\266\227\205\366\247\254|\376\234m\267\324*dT'O^8\373\306U\317J\214\262\347\031\315Y\266\331\314j\024U\212=\220\035\020\361\365\026\363\003\275"
+	.string	"\244\2567\323\356A\300\037~\252\322{\271\016dV\251\274\217*v\263\354%%C\356"
+	.string	"\177\360z\217Z\305\004c\341\310\013\335_\263\242\375!\332\306#\002\002_\255\005\006&/\255\363f\211\006\314\243\341iY\351\275\\\020\370h,6\244\367\336\177\335\350\227Y\321V\"\337\031[#\347l$s\036x\250Q$\310\224b\210\221\221\tDF\222$\215\001\200\002\031\261\253:\022"
+	.string	"V%\fT53)ma\3773`\321?\020\360EboEn\272cfCD\226\337\372\332\303G\315\336$w\210=\241\253X,h\305\006h\370\016\312\230j\223\370Hh\350\222\355\247\324q\322\220hK\237\322\254\334\204\322\211\b\240%kTT:\305$\204t@\360ja\\\304\035\206y\313!\250'b\363d\254K\300\243^\374_x\323\222\030\006c\004E\201zM4\213\310\265vy\273\001\215|\361\366\024\321b\372k\342\320\3214\341"
+	.ascii	"n\201\303\331\026\250\2444\312Y\374\234\031\236@\300\337j\311"
+	.ascii	"\017.p\007\037\324(\037;rr\031\224\361\374\243\317\027Cxo\nQ"
+	.ascii	"\205\001\023\030(\337\b\355\371\351J\002\\\252':X1nn\217#\224"
+	.ascii	"g\034h\233\260J\332\t%]\032\241\202\245\220\201\370C\244\221"
+	.ascii	"\363\025I\352o;\356\275\260\032"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.165.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\001\002\265\017"
+	.string	"\206\232^C"
+	.string	"\221(\035)\276\310x\033\260\037\005\004\363\331\271\333\200XfE\260\023\321\277,\322\211+\241\f\347\321\366r\337SG::\326\215\251n\306\332]U\3755\264\306\224K>\362Y\360\330\022\322\306\275\267\224)\005J"
+	.string	"B"
+	.string	"O"
+	.string	"\273\032b9\366\005\262\214\260\375\315#\233F\200\013KB`\003\307\351ucw9\r\361\321\341\323\034\371\035 \031*E:\314\230\374i)\223+\200T\311+\260\273'\361\314\2202ev\200\354\256\023\225\332p\307\333V`\333\200\235\242\251\307\340\301\364\0227!\342\213\360\bI\036u\350\223\304\303\253\306\202\261T\245\214\331)\244\324\225\375\267zbkZ\243\351\355i\355\245\263\2473\232\216\232\206\231~\231\326\247\363\351{\b"
+	.ascii	"\301\202\303?\270\004$\325\225\246\031\345\250\270\224$\016g"
+	.ascii	"\252\351O\260R\213\273x\260\351t\342a\246\003d\2502\372\225\023"
+	.ascii	",\352\312_\236\b5\246\270\n\017\204\317'\036B=\300\212\305<E"
+	.ascii	"\001\212\252O\345.PH\327\305C\325\004\260\026U\352\211\243j\374"
+	.ascii	"\"\361\032\356|\210:\016\250\263\211\300\341$|6!\\'4\302}\020"
+	.ascii	"p7\301\023\342(t]\210\333R\366o\365$\233\321\341\245\244&\350"
+	.ascii	"\221\366\002\006y\224UI\373t\365\342-\r,\264^(0\032\215\261\342"
+	.ascii	"\233j`8\330T\324r\305\250\356\211,\025Z.\024\230\334\3357 \300"
+	.ascii	"\002\031\271\242\007\340\2527\"t\252\004>\3765q\356\345\262\366"
+	.ascii	"#M\t\204\206\030s\023\305P\2634\314r\252\314\022\360\350\223"
+	.ascii	"\024\343\274lxv\340\006\326\225\307\365\215\020\337\350\302\235"
+	.ascii	"\263p6\356|X\036\206\260\330\2027\344\271\031\026;K\324l|\261"
+	.ascii	"\322\265\244\006\210\030n\220\243\266\370\312\224\331Q\214\262"
+	.ascii	"\270%\246\211\206\242C|\r\026\312\304\001[&\017>\275\265\253"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_blackboxLogIteration.166.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`.\006\r#"
+	.string	"\346:\324I\200\224R:\025\265W4\337\017\203TI\232I\343\032(6\263\302\376\304\215\\\2717#\215\307O\213\265\327-c\335\020\217fa\317,\023\220\035\201\2120\377A\244\350lu\343s\370\023\366\"\234\253\025\336 \b\373\215\304n\231d\271"
+	.string	"\263"
+	.string	"\301"
+	.ascii	"\\(\304>\246\"\r\212\n\346\0379\030\213/\031B\322\n\327\275w"
+	.ascii	"}\312\314\202y}\232\256\314\374f\276\221{\021\377\325\202\177"
+	.ascii	"\367Z\2611\357].`\036\337\323\340\201\352S\336m\324\247Ld\216"
+	.ascii	"\033\260t\213\r\2405\230\306\352\356\275B\213u\342gdbV\230\237"
+	.ascii	"\257\247"
+	.string	"\246<\333D~o\202\362\277#\262\370\031\231\251\307LI\365*\304\351F\303\004\301\256#\304\311F\377n\365Du\237\216\325S\324{QL\255\2729Q\271\350t\306y3\310\245\025\251\324\226\007l\362q\274\233S\r^\0029&[\256|\277@\032\273{\023\356\275\334G\344\323\031\300\231\371\216\231)0\247o\001 \324\032\0335\205U\244{\203S\352.\314or' \370Z\\d\324?\032\251Ok\354\223\374\300\233\230\026*\257\250\244\2162/\215m\257\230o\243\321h\224m\016f_\363\316\2579\370\262s\316\315\3168\276\346\233\237\235\201G;\333\370\232k\376\365\323\370\232W\2659U\233y\275f\2536\267\332\374\003\217\203j\202\021\343Yk\3676E\277\334f\332\344\307\317~\264\277\3547;\217\371hg*a\322\320\202N\341/\371J\276\204W3\244`\221\346\032\337\224L\t>\006\016\210/C\242\271\315\013"
+	.ascii	"\352\013\264K\356\336\245\202\247\334\343C\362$(\276d\006\311"
+	.ascii	"\263Z|\004\210\3744\231\223\213\201\036Rn\257\204j\355\255\302"
+	.ascii	"\234\005:h\231\211]\304\"\375\243\265M\346\204\266\265r\345\003"
+	.ascii	"@\217Y\332\006\355\231"
+	.string	"\356r,\216m\333\003u\261\305\330Q\326if\242\222B\377\230cW\266*\276\333\337\220*X\260\240>\305\261_\362\013w\3116\273)\325G\275\035\2069\031\303\253\370P\271]\221l\353\372\"\320\314\031~\234m\002\232\3062k\340@\346dk*\331b\2204@3w\360\320?\362\341\234jM\243-\362\234\215\242\024\017H\275\221\232\332\201\343c\374\341P\200|\367*=\340?\371Z\020_\353)\017\021\021\251Oo\354\307\336F\266\256Py}\365\332R\023\020\313\001A@-\004\324&8\020\211(\332pb\004\321p\2104$\303C<)\216\204\214\206\202B\b\tG\024\005\211\020\016\rM\byr\370\210\004\321Px\342\350h(\\\227I\2679\370\027G\243\231d\215XgsUvrF[\344\335{\357L\326\017\334\223IS\206\307\323\253\231\336\001\325\216Y\200\326\306\2466\202\032\320\256tU^l\354\231\307"
+	.ascii	"\225\214\263\213\222\251\273\201%\346\315\363\354\255\354|\352"
+	.ascii	"x\366O\311\270\256"
+	.string	"\347\226\362\207q\306\346d'\227\200\252M\306\032\345;N0\376p-@t;\266'\353+\251\243i^\\:`\354\025\247}\265\275\0256G\354a\264\332\203\035\201Q\254\371CF\220\347\323\220\237'\362:\272\3101\177\366\nI}J%\251\324\005\200\202\250a,\t\025R\312D$)HA\223t\200\002\221\241\263\036\02105d\n'L\223\341 \302\271.v\235\002\267O\004\372u@2\030\361\373\335\275\227\243\205\234e\335\020\363\260Ml\006\035\"_h \337\211\030\302-\274\337}+\321\300\342#6\254lu\2626B\222\253\2116R|\217\237k\001\002\371\371@\364g$}F\215\315\022\245\032\233\2573\266\236\fTS4W)QE\272\206\271\223\231\031:n\004,Ss\232PMh\0207,\205\306\0052\006d\312R\240\217\214u\330\355\220L\224r\323n\337)\344\310\233&\242\017~&4Ye\242\341"
+	.ascii	"N\007\264\250\225\236o\302H\b\352\244j\225\316\342\224\253\005"
+	.ascii	"\255\215\224\332\002Z\321\001R\345(Fa\233\3219\305p\323\001\347"
+	.ascii	"|\241Gh\234\330_}\031\250(\361\372\027\365\225*r\261 \177\301"
+	.ascii	"\270\265\362\fA(\342\320\220\317\313v%2\3231E\201\212\002\310"
+	.ascii	"$\274\205\033;k\207\325"
+	.text
+	.section	.gnu.lto_blackboxUpdate.167.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`R\033\375l"
+	.string	"\252\246 %P0\316\322\032\003\216\260\366/\t\br(\b[\3630"
+	.ascii	"V\310\322i\213\232\026\320\\b\255E\361l\312r\336\351\034\232"
+	.ascii	"H\251\220y\\\013\347]\234\343w\266M\254J\234_\004\200n\332\316"
+	.ascii	"\343"
+	.string	"~\033\371\002oG\367\3213i\245\261\312\335D\222\224R\nJ\002\022\002A\002\316\016tn\020\b@s\232\2732\255z2\3157H\225\357}\256jQ\032Lw\333\334\223]\350!\277t\334\216~r\213\345\035\234[\277\271\rF\207\320S\363\235\352\2112K[\356\275\357\221\200`\257\334\f\366\016\273\203\331K\033\257\365;\365v\017\272\251\231\364}_\245^\331E\220\255\205\322\255\213\f\245\231.\265\225\n.Lr\231\326b\271v\366b)\246\353}_-]\026B7\271\277\226v]!0;]\364\265\221\331\331%\215\274\357{\245\305F\350&?\227\350\b\314\rC\207\221\320M^\271\334\351%\227\357\373\332\364\312L\002\263M\25776\314\334\316\334\313f\272\375e\002\013\337\367\352+\355}\233&\370D\260W\241\346a{\375\365\016\333+\273\314\321nf\275\036\246\310(\261\275\367}Q\374\222f\377\232\315Cw\033"
+	.string	"\025)N\230(\241D\"\t\351\310\250h\004\221\210!\241\020A@? >\370x\350\351\300\303ag\203\216\206\034\234\033\242\315P\270\"\bd\327\337\273\313\355_hNsY\244\212\r\200\n0\250\2478\021\006\306M\374x\342\222\330\221H\272\ty\363\022J\277\025<\366\214\020\323D\205\351\255\343\027'\341&\203'\321yay\232\2549\351\253c\335#\325\365Q\035\232\033\265\235y\021\331\b3\"-e.b\353\230\305\207\332\232B!\234\375K\342\343\211\245\203\276\034\b\214\351?`K\007\001\\R`\311\231tI\375"
+	.string	"\\\272\232\252\322>^\355\341\3473\206D\254\345\216]?#\257\247\262\343\274\274\247J\024\357P\245\005\3479\343\360\304w\234\370\2064\035&\256A-gK\356\210\304q\200K]\272\245n\300\2168\361\367ad1\270`v1\351\255c\225\333\374Z!=Z\356h\344W@\261\314\264\275\024\361!p\211\205)\"-\354&\"\275Bh\353X\306\203C[G\244\003\233\255\211|<\227^,\224\257CWSf\375\373\221\220nA\323rG\263\037O\220\026\214\r\326\216\202\324\223\277S\t\245IV2\212\307P\312\211e\271\252\314\372\352h6t\340\322\373\276\354F\251\251\346"
+	.string	"\232\371\327\202\231\021`\356\301\022\316\273\252\347S\360\261\230\375\3373Y\001\303a\326g\177=\003\225tJ\342*\213\350\256\\)#\350VX\277\b\372\305\277o\350\235\n\256\023g\224z\327\r\326\303\263\251\026U\n|,nn1~d\002\244\030\252\221\027\017\305\213\270\312\016Q\234\210+\245\327\252\3573\342\03197\233;\305\245\342m|\361?,rLnW\3116\033\273^>\304U\362d\275\357+"
+	.string	";\225\013q\231\334Oze\027\314"
+	.ascii	"\003\330^[\344\331\236R\263\037]\352\200\004\026X\200\355\265"
+	.ascii	"\004\344Y\227^\223W\201D\203Y\357\361\265b\353\341\030\225\026"
+	.ascii	"\225\305\301\3763\201pf\006\034\3606\37674\n\327v\235\024}{\256"
+	.ascii	"\017D\227=\316\f\201\004\336FnhT\371t\372\242\006\274\266\023"
+	.ascii	"~@l\006\337`\035\304\263R\367\344i\270\033\210\365\317\340\331"
+	.ascii	"\243\220N\316\303\241`\304\2301\203\355\325\377\003\345\231W"
+	.ascii	"C\033'OkOZ\364\276\025Uec\376\261\274\211\335\311FM\217*\373"
+	.ascii	";\274\323\342\343\356\023R\317\264\250\334i\202Y\244\313.4\334"
+	.ascii	"S\240S\272\354\312\343\326\373\301I\271gx\245\031\356\250\267"
+	.ascii	"\325;mA\353\265\252\343.\303\321`\267\005<\200^m\313.:f\216~"
+	.ascii	"TI\261\223n|\223~o\021_\303\334bz\214\005\334O\030\003\032\336"
+	.ascii	"F\032l\257\375\020\270\321%\231\310&\25727\235\374\261\230\373"
+	.ascii	"\253\325*\224_\ts\3209\003\241s\005C\347\031@g\031D\347\0308"
+	.ascii	"\316\024\020\235a\f\235_4\320_\335,\272\2559\t\350\214\004t>"
+	.ascii	"\002:\033\t\235\213\202\316#\204\316DBg\021B\347\241\241\263"
+	.ascii	"\320\3209\304\3209H\350\fDt\376\021:\203\020:\177\020:\373\b"
+	.ascii	"\235=\f\235{\204\316\035\204\316<Bg\016B\347\035\241\363\206"
+	.ascii	"\033g\235\241\263\206\033\347\234\2413\316\320\371f\350L$:\333"
+	.ascii	"\020\235\207Dga\3209h\343\f\034:\263C\347u\350\374\023:\1770"
+	.ascii	"Fz\236\271}k8W\311Cg\304{!?\304U\302\265qql\257=\337p\275N-\243"
+	.ascii	"^H\342\030\256\252\236v\216\245\340\335\222/\024\363\346\240"
+	.ascii	"\177|\251vNLK\306\311\260\275R\360]\326GsW\364:t`\300w\272-\303"
+	.ascii	"2\267f\332;oc\207oh\236\224\347\223\032\264\252'O\365}\300x\343"
+	.ascii	"\f\177B\233\267\200\303\370\336B\276Q\221\017u\326\3031\025\254"
+	.ascii	"8\360|_\235\341yw\346Q=\235v8\264S\016\337P\274"
+	.string	")\036\334\036\332\220\347\006\352\027\323\252k\334\370\322\244:;\236\246\271\335\"\273\356\265}\323\002\262\316\264}y\256\327R[5m_\333\307\366\252\324\314e\347\203\222M\226x`g\320\250\236\032\320D\325\354\324\312\324\251\321\221Q\363)\033\303\225\363X\356\2437,y7=\314\234\313\243\313L\270\234\033\305\032\211\203s\213.\224g\272\330ur0.\217#\272\367}\022\200K\370\233\033\325H\345\231\275^\335\330\024\335t/\356\217\234\254\030\274\255\257d\275/T\263\231\246\257\271?\202\357\013\325Fv.\336\305\355\201\202\373\343G\2323\210+\345m\334\360AG\322\270\275D\356\266\340\251\221\342\344\231\235\240r-\274\326%\213\263\217H\266==O\241\273\013\331\030\333\225.=\034\033\362R\177F\330\232n\226\255\363\275e\005z\201\207\301\240\363E`_\032\326*J;*\361\261\206\2609\3145\\\351\016\t\276\357\323"
+	.string	"\354^^\305U\341W\345\026a\335\"l\2579\357\002\252\326D\345\005\234o1\350W\223W\177\252%-\210\315c1\213*\302\006\036\330d\205R'=\n\314B'\275\3135U\t\245\034\336\274\013\256\262\355\262\270\232\3707\037$F\313U\006\243\020\277\355\230|\225\350\244o\340; \263\274\263y(m\304s\373"
+	.ascii	"v\3706\337M\206\337[J2T\244\n\027>\263\213\304]A\350\351\213"
+	.ascii	"\034|\341\273\231\25059\037\374\366\3222\226,\247Qk\232\274\372"
+	.ascii	"\343\031\2122P\021>\026w\007\275\236<\255x%IX\340\367\225\025"
+	.ascii	"\250\t\347f\363\032\313\354.q\231x\033\201\357\0017p\354\320"
+	.ascii	"q\203\211\325\240uHp\003\207\006\021|\320\301\r&\246\0356n\330"
+	.ascii	"\306\t\021r\324\330\300\006\r\016j\240\350@\003\0328P\330`\322"
+	.ascii	"\201\342D\b\316\341\301\r&\024\037\344\310\301\204\302\246\331"
+	.ascii	"\324\277\367\225p\2174\314g\323;\361\2435/\001\340LS\245s\005"
+	.ascii	"\367E\005\322\367\225\034\322\227\360%F}.\275\305\212*M\361\024"
+	.ascii	"\202\204\254K\317\271\303Z&\215eM\021!\0263y\242\202\257\361"
+	.ascii	"V\301wX\023I\361i\375\bav\2318\252\373r\264\246\204\023\207N"
+	.ascii	"\363\202[\242\230Q2j3\372\026\302\344\363B\222Xk\302F\242\350"
+	.ascii	"\373\nJ\321\273s\n\367[\272\2472<y\255\311\232\223\244.\374k"
+	.ascii	"@}\306Wc?\301\214\326\247"
+	.string	"1s\224\200\262\266\025VO\276\206\231\333(\177\346\362\b\362\227\275Y+\205\271\332)S\330^G\274\220\352N+\311Dz\254,\355\002S\257K\257Z\255V\217\210\276\257\260\020\025QE\371\222\314\2721\261\256V\253}F\"\276\006\025\021\355\003\315\353I\225\222i^*z\237\232\242\307\252\353\260&\353\")cO\222L/4S\210lMP#\206\036\247\312\320\003\271\234\350\261X\350\203\376\243\215%\304\013\375\217\3303]e\263\375\322\225\322kt\257\f\361\315\026\364]\265r\372b\213"
+	.ascii	"\252\341?\314\026\314\333\b\364B \376\347\233\n\f \276\005\263"
+	.ascii	"\214\352\305NBC5\344\314\253\n\201!I+1\206\253*\004\037\327K"
+	.ascii	"q\366p\254\352\245J\203>\374\315W\024\034VZ\262\017\337oL\034"
+	.ascii	"\310\347\177\353\201\264\317\367\fVO_\354\037\017\317d\245\316"
+	.ascii	"\311?\301!\326\222\221\261\275z\370\026\313>/\344\232N\312\203"
+	.ascii	"{\026\275\017D\217S\002\260\326q\346}\371\240\343\367\276W\005"
+	.ascii	"H\303\274\3122\234\205Y\213\006\327\r\004\355\210\025U\372\364"
+	.ascii	"E\026b(\271\212\361=\327JRbo\325\334\321Xv\317\345\336\333\364"
+	.ascii	">\037\030\336\317\206k\271t\217\323\030\276\344\322\210\323\355"
+	.ascii	"\032\313\035\327\306\320zY\277\270\002\201Z\342\341\261\270\033"
+	.ascii	"\211\235\3615\254\200\311\251V\253\323Fbe\374\214*\031\337qM"
+	.ascii	"4u\306.\311D\262\370r\\F\251\001\202E\250\0229%N\242R1$\"\"\222"
+	.ascii	"$I"
+	.string	"\032\003\"\013\020\006CQ\030\367\256\007\022 T5\007t\222)\241\231\221\244 )\265\031`BS\375\326ts\326T\3275\335E\361!=F\252\332m\3052\370\205\207\200\3474+\301\013u\300\305\310\232\257\236\214\340`;\235\201\276\2020\263\032\262\264\240\374\272;\307f\t\034\031\267vOc\221\f\001\322\220\r\210\003gD_V\263>vh\002!\267\321v\261\033<\370\330\201\272F\332\301\266\241\005\332\2216\335\036i\363U{\344\251\346\b\375\327\264f\350\321\013\354=\231\036(OK\316\313\017\346\355\372\241Xt\367\030\2321\023\247\2610\021\276\030I\034H2=\302Q\212\320f\273B\277\255\207z\236\350\023~f{\376w\031F}\212#\255\036\025usJ\347\271\313\224\300\305G\031\335=Z\336\026\375\216\026\355o\344F\262\211\202\305\275\370\350\256\005\350\246\374|\003\246Z\253\343oC\357\244\006D\320\224\363\032"
+	.string	"\031C+cz6y7'\353\004\221U\303f\030{\005L@\326\222]/\340\276ln\331;q\271\265M\271\037vr\001\237\272\265n\fIa1b]\311\250=\203\":\227\310N\317\372i\247\200\n\001\244\3367\016\007\350\021\221\220fc\211\377\373E\303\n=\227\350\250#~Y\001[\256\213\fW\316\315\372\220\337>\322\004\022\004\317\206\304\327\377\247,\006g\224\023\006\274Hy\3417\213\250t\206\225jSV\375\223\t>\bk\231\276\360\007\312\2243\204"
+	.string	"H\203\026\"FB\037O\001\237D\200\037)\216)<\272\321\\\367\310\322`\210k\031iV\344(\255Q\006%*\231O\355X?\235\310\334p/e~&\316\305\204\256\226QH\027\352sO\263\257\315\361F\254\210k\026\t\332\353\324\253\333\347"
+	.string	"2L\324\213\313\303,\300 \267\3423.\002\221v\244\313\252\236\033\311\332\272\216\265\005\327\007_\256?\204\340i\004\235\2650\370\003|\234[\031\266\351+\"\313\257\374\351\262\263'\177\375F\006%3a\271n\2247<\354\314\306\370\262=\320\001\202\322j\327\207\265\367\204X\277f\230\254\362S\023:\241\367\233\213\247\344\220\367\255\214Q7\303\332R\337*E\253\354~\246\213H;\250e\026\353\200x,6\277\227OI\0308\252\301H\200\201\004\002\257lMi\030\237\366R\004=p\2179\360\376\363i\002\345\320V\263T\334\246"
+	.string	"\202G=\371@\272\340\030\2061\252\233(\320\211\222)\221\322l\243\201\234\313\330\024\201\265"
+	.ascii	"S\360\367@\032\332\226\322\017Z\346q\"@\007\341d\024Y(\031\341"
+	.ascii	"2\207\024\366\246\367\230\304\327\245\333U,\304S\3359\201\013"
+	.ascii	"\340\223\n\f\224\246OfCE\232d\304\177\217\177\252|\234\024R7"
+	.ascii	"}\2273\024\"\f\021`&\032R\306e\353\226DI\236\n\205\026E\2504"
+	.ascii	"\216\034\357\271\023\330\221\023\301\002\273\331Ul\361\0243\232"
+	.ascii	"\356\"y\305e3\317\255\241\302\021hi\370\252A1V'b\016\240\035"
+	.ascii	"#8\204\017\307\3745T?\036\356\347CR\375\241vl\331?\220\277\337"
+	.ascii	"\341Aa\rCx\210\t\277\3033\202\002:\2417(\f\271A\321\223\360;"
+	.ascii	".1\032Qw\351\226\312cLm~c\246b\250\026\006}S\211\n\330^Kl\322"
+	.ascii	"Yy\252\315\323X\027TYC\350.y\031\211t\334Do\366x'K\251\214N\216"
+	.ascii	"\006\256lu\345\212J7&%O\225\354\037\317\241K\273\224\313-Y/\230"
+	.ascii	"\350hx\201\303\234\210\204\205\345\260Av\020\367\341&\300Xk\217"
+	.ascii	"\243\325]\001\031`\277\2417\202\247\310\357\360\252\237\320\271"
+	.ascii	"\323K\353|\243\201\313\\N\307\260q\324\207\273\rYr\013b:\311"
+	.ascii	"[\230\343\363\235N|\b#1\225\274'\033zZ\302@\037\022\320\\O\202"
+	.ascii	"\0343\344\006\350\325i\335\310\033\211\352\276\3325\212N\177"
+	.ascii	"\275\277'L\217\234\201\241D\337\037\013\276\24105~\357\272s\323"
+	.ascii	"\236n\347\270\f3\301f\326Y\314{\206FOK+\374 \006\365\314W\003"
+	.ascii	"\310\350\227V&9d\306#W\362d7f\263\035\002"
+	.text
+	.section	.gnu.lto_blackboxCalculatePDenom.168.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\315\t"
+	.string	"\346RC:0\305*\035\236\267O\356\352`1\211\374H\207\273\204\267\027NEr5\\,\016\217\273\214,\203\217\335`\304\343v\321\273X\310\"e\235\252B\031\001%\337\016\240}B6\2212\2452"
+	.string	"1"
+	.string	"/"
+	.string	"vL\013],\002\002.\025L\300\356v\233g\266G\355\003\333\243j\034|\202\376G\316\240\222\251\254X\246'\227\260\273\316\025\253\342\326\333.\260\215`?\023\177|Z\237\316L\337\242\341\b`q\331\311.\305l\300\002\210)\036\266A\033c\207+\007\317\277\034\363e\027\303\004ew\r\314\261<\332\366C.\002\006\232\252\372\324\007*g\276\246^U\340$/!\371\035\226(\345W\245\355\361\252\331\2708\345\314\016M\251\031\366\265\335]k\313~\232{\370o\177\005!O\004R\270\204H\013\240Q\347\343\374\341Lx\036\207O\347\301\323\211\032:\241\356\363Et\034\215=\b\320\327\215<\357\3530\341^[mq\2729)\312\233\252r\032a)\220\030\020"
+	.string	"+!\201\245\236L\350\f\n\\\374b\201\031\314\320S\004\306.v\rlB8`\016d\006F\004\025p"
+	.ascii	"*\217\251\235d"
+	.text
+	.section	.gnu.lto_blackboxGetRateDenom.169.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375 \373\315\006"
+	.string	"r\214.4@o\222\016\323\266\b\250'\033\323\271S5\002\\\002 \222\3170t\025\021\372m\323\261#\n*\224_\277\201ax<\207\346\201m"
+	.string	"@\236s_\246\355o\"SS\233\213\252\343@q\036:/\242\201\003\361(k\342m4W\022\f\326\243\250*\353e\266,\212\020\t@\210q\021\261\331KKjRqG[x\\\265N\327\003\320\251(\320\001r\245\3370\207\037_L\242\350w\243s\027\243\021\031q\224\264\222\251Qj\311\224\te\344\377|f\204\204\317\327@\006\246R\340\022\222\235\260dn\017Az\325]\267$]\310H%-\204\325\005(d\346N\013mt\354o\360\037\374\036\001\n"
+	.ascii	"`\251'\0230\2013\3348T\204\272\3175<e\304[B\220p\347L\355|\002"
+	.text
+	.section	.gnu.lto_blackboxInit.170.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\260\005\245\037"
+	.string	"f4\272H\240\230Q:\242\310\312k\n93\353\007\316u\030O$\345[Q\217\362\025\351%I\344\013Z\257\341q\326\203V\273\375\270>\353\235K\n\300\005\271\334\341\271<i99NB\337\311W\243\277\036\203\3307\326~\262\t\2212\311\247"
+	.string	"\235"
+	.string	"\250"
+	.ascii	"\247\213C-\204S\215S\255\325<\271\353b\327<\331\346\342v\261"
+	.ascii	"\016d\252\004\210\247\321\222\255Z+\255\177\034w\234\033\233"
+	.ascii	"\231\314\214\301^%%\307f\334\376$\006\251\236\360\206\216s\376"
+	.ascii	"\274\033\340G%\031B(\256\036HL\267\331\341\343\031\002Y\271c"
+	.ascii	"E\004S\306\314\3011\035\243N\323\021\016\206\225;=\220\222\376"
+	.ascii	"\332rtc\324\251\265\376\351\b\232\216z\\\3328%\213L\036\f\036"
+	.ascii	"\313\235Zk\214g\343=2\360Y\251a\303#\032\005hQ\262\372\3239\006"
+	.ascii	"O\307\\\356\324Z\227w<\244/\200\357\336\300\356:\330%E\004\266"
+	.ascii	"\367\237\256\240H\226\021\337\257\327\340\373\250K\205\030\321"
+	.ascii	"\323\203#\311\312I\212\317\201\252\251Cy\024\240[R\225S\020\335"
+	.ascii	";\371\223 \022BB\364\344\001/S\257\321\375\2223\251\355\203\254"
+	.ascii	"\t\033\177g\243'\037|\2022XD|Pgr\\\334\005\352\270\227v\337\305"
+	.ascii	"b\261\270\355c\227\362\316(\257l\3445K\336\330\310\013\243\274"
+	.ascii	"/\312[\216\274\224\362\222$\3578\362v\363r\363^'\347\264\242"
+	.ascii	"q1\305Zg\024\325T!)5dw\277W\362`\213Cm\354\344\322b\027(A\253"
+	.ascii	"\367\337\003\325\344\241\264\273\353\217\365\322\226M\366\213"
+	.ascii	" \026\332e\337hM\030\332\016\200\364\306&;\200\021V\023\2435"
+	.ascii	"\260^\342\241U\027\306lq\255u\350\225\201\216\213\341\\2\274"
+	.ascii	"j%\212\260\337r*\r\373 'w\003\007\016\364\344\330\267s\314\221"
+	.ascii	"3\307\305\261\326Z\313na_\331\r\271\273\373\312hM\277\253\276"
+	.ascii	"F\271\0134\271\252R\204D\307\305g\321\375\242\320\321\212\325"
+	.ascii	"\016\207JR\344\2046\223\225\204\243\320h\3411\276\352y\350\276"
+	.ascii	"\312\247x:|\370@O\2568\253\234.d\347\023v/\345\274F\337?A0D\334"
+	.ascii	"\265Sj \002\013\364\200\205\355\247\006\344S\342\207vB\310\307"
+	.ascii	"\004\r\350\226\202\366 gm(\202n4\0256\333\215f\002s\037k\373"
+	.ascii	"\330M\243%\314\265ng\275\217b]\210\247\036&\356\206\\\277T\250"
+	.ascii	"\254g\375\242&\263e\\\315\006E\264\276\370~=\234%2Q\361\204C"
+	.ascii	"L\274\301\375\350~\353\\\270\037.\t\005\n\364\244\207^\027.\035"
+	.ascii	"9.fa\275\230\352Q\345Q\027\234<\3601&7*\027\231!&\332X\240\261"
+	.ascii	"\376\t\206\251p3\026\206\261\276\235Y\\\3478\2035\231\357\206"
+	.ascii	"\257\206u_!\273\354W\017\250\302\312R\204Dw\331\257\316l-\260"
+	.ascii	"\326\200\211\250q<\346\030QjDDF\222$\205t\320\002\021\"\2629"
+	.ascii	"\021\2009\203\306\246\311\262\337\001\340R\222\243[\311\236#"
+	.ascii	"\361\375\216_\213?O\023Y\334{\302M\002RZi\330E\020\326\236\244"
+	.ascii	">c#P\223OJ\032\313\177@,\234\255\247\320\370\227\210\206\252"
+	.ascii	"\213\327$D\036\247\030\215\274\\\355f=\322R\354\200*,\377&\f"
+	.ascii	"\216g\230\214\030\365\230\265\323h\\\326\003\\\246]\177\360$"
+	.ascii	"vs\242f\263\314\242\026\2403r\\\030;\002\3322\005\025\261G\307"
+	.ascii	"\236J\313\341q\224\200\206\030(\343:\fc\037\325\233\222\304*"
+	.ascii	"8rlBE`6\367\335\270\260\365\324\350\343\2048\375\276S\230\021"
+	.ascii	"\254\317i\002\3011\210\007\210m\324\024\241\302)\316\246>b\203"
+	.ascii	"~\375O\237_\350\301\337d\247\326\025,\303\241\2770\b\376\333"
+	.ascii	"\026\264\341\222\034\223]\3562\373P\2160h\311\263j[\230N\312"
+	.ascii	"\242)\314\275\224\311\261\027\331\366)\376\225\254\006"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.part.0.267.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\275\013"
+	.string	"\346TK@ \213*\035H5\002\243\004\020^\002`0y\342z\004"
+	.string	"\304\230j\234\036\021m\001N.\005'\332\252\016\246\f\365\333\030h\357\f\023`\324"
+	.string	"\026\202\303\344\031nc\266\f'\340\360\260do)S\n8"
+	.string	"6"
+	.string	"9"
+	.string	";\322\320\020;}\034vw{\324\005\027\035jF\221/\261L:ot\230\235g\340*\341\231\240\305\356\236\365\034\340\2252'\036%\226\3355\304\201[\273\355\r\333\031\3667\001(R\316RU\326x\270\232\2625\035a\032jZ3\235\231~D\256.*\354\022\230yX\005\221\302\003\373\254\220M\241<>\202\355\220\r{\213\301\026\260\310\206Q\004\b\246\214\031j\324\237d\244\357/\r\207\343\264G\250\030\rP\252\371\235d\251\256\177\3502\374\035\355\232z\001\tJ9\263/\341\255\216\357\300\037P\276{\364A\332\343\225c\365u\b\316TD8\214&s\331`\266\017\217\013g\313x>[\245\302\034H\207g\013\3418\317F\261\235\207\253)O0 \270@\322\022T\225;\332\204\221\325\013\302\006}\356\356HU\345\250\252"
+	.string	"\\\026\002\036"
+	.ascii	"g\325\253\333\030D\004\2634\"\005+\020\002\006\007?$X\2073\006"
+	.ascii	"\232\300\302Yp\347\005\213OC`\261\2458\003U\026\002\242`\230"
+	.ascii	"+\334\035&\b\316\210E\235\013Lw\032\030\256\275\242pijJp\353"
+	.ascii	"\265e\f"
+	.text
+	.section	.gnu.lto_blackboxStart.part.0.333.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`\240\004E\033"
+	.string	"\326\354\240G\220\\Q:\020\330\367\250F*\t\210\004@t\311J;\267\356\327se\210oaCc\002\2036\316 \004g\264E\262\205\232\\G\340\235\204\276\254!\202 b\002\374)?\225\362\365v5/\276\230z\301\302\2617\3312\311\206"
+	.string	"\216"
+	.string	"\217"
+	.string	"\315\26367m~\317\350k\""
+	.string	"w/\216\2549\227\b\325\302\343?]\312\212\3778\300\215\330[\301\3544k\302\335\2237\265\370\217\025\210\261\265\340;9\360\305\177\254\201X\3041\335{_\214|_\ff\036\236\323/1s\ff\253\003\217n\016\266\314V\007\210.\031aiL\221S\361\336\353:\235Hn?{\264\374.k\344\347\233\3366*\332\231)5\035\357\001\037w*\334{\031\300\2163=3S`f\037f\372 \374\035c"
+	.string	"\352\227@\365\264\245\312+\004\315\234A\303l5p\344\004i\223d>\325\024\232\340\315\224\351sT%3FJ\214\317\301|\351\302\357\362!\001\227\r\256-\217\342\320\301\203\007~p-\037\f\034\335{'\360\261<\013\210\020\257W=m\321\310\\){\fu\026\267\272\3009Lu\360\377\016\005k\035\335;D\345UF\360w\247L\002\326/a\265\304\211~\311\367=\300\223o\030g8c\222=s<\307\217w\036a\336i\246"
+	.ascii	"\232\307\235Q@\007\347&\352\031\366G\020{\273\001\271\261\351"
+	.ascii	"\321\206\244\361\362\254\363\253\232,\"\273\245\351\375\324:"
+	.ascii	"?F\200\022Py\311U>\326\345\330\034\022\253\323\325\323\003\317"
+	.ascii	"\240\215\325\022\034S1\311m8+\275\023\377\306\362\224\330$\030"
+	.ascii	"8\250\"\321\362*\377\352n,\017\311&%\325S\0278\250\036\261'_"
+	.ascii	"\370\341\3142\261"
+	.string	"J\267J\365\224N-h\002\267K\225\331\372\254\223~\331\223\016\261\220\2022&\311=\315l\341B?e\t\306\031~\362\253\276\346'\034\004\201ELD\211\240\227\t\021.\024\260\327\tW\220l\346\202\320\303\261\024#d.\025\261\230\314\305\363y\204+\fM\032\3179s\314\334\027\242S\271{\264\017!:BY\226$\221\242\354p>!\374Y\345\013[\307\214f\225\232\336\240\006\005\r\216\211HkD\243S\021\235#\026,\251\3408o\320\260\272VW\331\332\250k\304~\326\310\332\360\301QO\307y#k\204F@\346\344c5\r\233\253Y\335\234*\257$4\263\345a}\364\3139\357\373\207\024\005x\250q4F\231BB$AF\222\024\212\r\220\002\221A\353\034\020H\311\210\n\351\340i!\001\373\301\240\244\203\205\364\030\001\001a\243E\315Gr\013\301\2368\310\006\220\020\265\310\232\230?6\363\214\274mJ\303\277"
+	.ascii	"\350\307\203\304\207\323vQ\225\334\036\273\251\006\347\300I\370"
+	.ascii	"\357\027\266UbFX\257\300\001\013B\245\212\265.\377e\313\206\\"
+	.ascii	"\307\240`(\0047\215f\r\022%\032s\326\255eI\350\3134(It\3425\366"
+	.ascii	"\246\235\305e\n\215{fv\022bE\274\213'\020\022\\}\202\345u\022"
+	.ascii	"Z\363\254\t\200\037A\263\020\030pZ\034\236\342\277\262!\034i"
+	.ascii	"\262Q\035\031}\377\220g\367P\344[\303^\313Qb3\3270t\312\272<"
+	.ascii	"\257$|\f\351f\\\\\263F[\266\253z\r\001@\225$W\006\351\345G\005"
+	.text
+	.section	.gnu.lto_startInTestMode.part.0.335.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`!\001\325\f"
+	.string	"fWUC\020o\225\016\300\002\263\302\020\300tL4\";XU\372\205\242\022\304\224\257c\036\004\206\260\305<a\260\377\277\030K5\337P\200A\365\376\370\003\200R\0212\022\201\253T\210\320P\324\022~t}D6\331;\245<"
+	.string	"A"
+	.string	"H"
+	.string	"\253I?D\331\232vz\021\266Q\366\353\325\265\033\006\355\3276aS\007B\223\n$\342\356r\247\323\303\301O\211\201~\352\323\302\221\3412\3001Jfw]\351\270\351m\033\260\315\300~\204,\213\206\221BK\334\255\334\251\264\357\217\034\304'\261&\202z\210InuY\033\017}\221\372\022\340CL"
+	.string	"\266\305\236\303$\024Ov\353\345\324\230\312\251\353\007d\247\225\013\310N}:\210\t\274P\261\033]v\372\216\326\030\302\205J\216\246H\373{ \257\341\207\377\205\222\025(`\234\254fJ\316\017O\354\330N\017\033\303HX\310h\355b\030c,\007\232\002\304G^\342\022\266\033\252\213E\351\360b1B\\\t\365rri\253\256\376\220\274n\301\350S\320\021!H\320\361x\232\317\267\231\203\201\320m@\034\215\203\r'j\240\tq\034\357\3430\005\334\215<\036G\352:\217\323l\313O\017gTs5\347\307A\231o\342'@\376\007\207:y\215S?\033"
+	.string	"\\\tT\323y\262\350\207s\006~u\0234\326g\002\004D\3010W\270-+\004\004!\211\021\"\005\"J\2058\352p)\003.S'Z\350&\b,\352\006`\272\323"
+	.ascii	"p\355\0017ZD\277\253\214\001"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.part.0.336.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`w\013\275/"
+	.string	"\312N(\021DPdN:\007\336T\333g\302\307Mh\250\266Hs\023\261Y\216\205hj\244\247\247+H\177\214\343\363<N\240`iDT\004\b\020"
+	.string	"\032\301\3200\235T\252\377\204\321\2765We\246\256\266M\032\221\266e\222\001\371"
+	.string	"\342"
+	.ascii	"\t\001l\367[v\217\203\r\257\320\236{o\202\243\fA\225;_N\213\231"
+	.ascii	"Hd\333\217\323z\3362\233\345Z\326o\251\241Tt\275\264\2101P\217"
+	.ascii	"\362S\355\376S\353X\262\200\317\273$\343n\346_9\334z,Y,\274W"
+	.ascii	"-\314\230{\237\013\2162\224z4\371cz\024\370\243\364(\363\337"
+	.ascii	"\230Y\213\214W\346\275?\331\256\022\036\025\260\270A\367\336"
+	.ascii	"\250\243\026\t\367\201\3173\261\327\033\213C\304\241P\r\246("
+	.ascii	"\3206\321\312\357\260\345\326\215$\320\212m\306\206\200G%O\334"
+	.ascii	"\016\207\214\tD`\007F\314\351\336\364\204\354\254\211G\312\320"
+	.ascii	">\244;\020\257\220\233Z\031\332\205@\274AnjS05.\301\200\311{"
+	.ascii	"/q\371\325\350\b5n\300`\005\271\253r\360\304\360Q+c\336\n\tb"
+	.ascii	"\346\005\304\306p\331\225\252"
+	.string	"\367\336\253\2211\3256:Q\260\302\275\227\3175\344\\t\346S`f\f\314C:\001xzi\370j\212wik\234\334\264\2534\303?\303{\352\275[g\362\263R\273\373\264\213\007\306\311\275WI\206\317d~\235\372\274\312\243\267IPr\\\263\366\343b[\233lk\355\345~ \317\034\230\037W\377\361\377\236\225\336\266\345\006\003\322\325\177\\l\216;\333\245\314)T\364\303\370r\177\222\267\245\033/\273\325v\215-\321\201\327\032aF\233\233\324\346d\332\214\03463\241\315Kjs\201\264\231\300\260y@\332,`\330\254\2246'\005@\233\217j3\322\347\316Gi\263Q\332\f m.B\233\211\320f\243\332\\\0246\017\241\315D\265y\2506\013\203\315j\332\034L\233\323\264\031}\334\017D\233-\260\271\377\374\037\241\333\236\254\334;\366W\350\246\241um\237;\337\313\273\360\351\230\310\314\237\323\342\244\327\227o~\204"
+	.string	"\222\364\017\037k\033"
+	.ascii	"\013%\350\256hI\363X\233t\331\332\346\224Wd\245\232\202\360\256"
+	.ascii	"|S\243>5\021\2245\312:\245\307V\347\016\252\247<\"\013\005\310"
+	.ascii	"\314X\264F\261\260\342\037\276\240\201\036\262\314\353\225\025"
+	.ascii	"\213\205\006c1\306\376\242rb\033\262Pz\356\340\270\210vh\211"
+	.ascii	"\366z\367S\251\320\016\255R\337\027\223\371BsM5\350-*\244\320"
+	.ascii	"\336LS\217\323>y\357M\355\032\303HU\213\245\345\216W\023b\346"
+	.ascii	"\f\367\203\341\244\341}TH\252\375Ys\357"
+	.string	"\356\3127'\032\334pB|A\013\245gv\354\224\303\003u8 \017\251\225j\346\341{s\345\233\033\360\330\250e\376\020\202Y\304\373\214\030b&q>UNy\367^\007{fX\361\231\034\345\327H\217\242V\252Y\307\tg\367\277\235\271\331\352>\266\347\347\275\327\3325\346=\376\030= w\370x\222v\332\334\240\303\257\203\234\303\007\207\037\207\351\r\0326\3746\306\234\342\212E\022\305U\322\204\213)\242\212W\311\2502\001\224\341\342\304\214\023([A\321\270*\261\302\252\212E\211(\027*\252ZDYa\305\210\202B\362\325\213\023XQ2\256\256\260\242\210\257\300e\273\370u?\360&x\224\t\375.\r\267\332`\312\273\367\353a+\230\372\025\341i\305\261\212y\201\203r\275+\341\334\212MI\333\244\243\2538\223rN$\223E\216\265\224(L\\\370\226\n\330\245e?\231R\340\266\nY*`\357\244\215\213\223\300"
+	.ascii	"K\200G7\233\f\340\023\240d\005\330\203Y{\264\222\365G\003\266"
+	.ascii	"$J\366e\332\342\234If}\004\255\327V!NIV\252m\013\237\235\303"
+	.ascii	"-\207\354\032\023}\031\006\260\250\022a\202\037Y\261f\376\310"
+	.ascii	"~\357\311Ue\216\250\340G6\200E\332\320S\347\213\331uD\262G\020"
+	.ascii	"\2556%\341\001\363:\244\211\254D\030\260\245\255H\220H\366tG"
+	.ascii	"\0035\375\370\352~\271\252\314\r\213\335\177\013\344\346\330"
+	.ascii	"FE\032m\255\317V$"
+	.string	"FV\252\331\347\234se\200\337\250qD\004\025S#\"\"\"I\222d8\340\002\221\021\242\325\001\021\3404\346\240\241))h\222\3758\240xB<\2472\022Z\276\032\200\251T\366\226\r\315\355\276Qm\267\363\234*\340\314N\246\310\250\036\214\247\213\357\302\341\371\207\244\nFO>$\362\251WD\324_\030*\322#\274p\252\201N^R?\224\240\001\004\205M\222\355-\371>\352\377}\265F\373\240\375\246\335\247\220w\252\"\362\335\331\253\332c\274{\240\334\302:\305\340Xu\346v\323R\017\216/.\307\2664\326\036\302N2D\023Lu\3413\326\005dR\317\326\017j\036\025\232\336\204\007-%\262\301\232o\222\345\245\217\225ri\360\003\340\2370\350\021\243\024[\236\237\235}\210s\257 3\370\267\004o\226\021\252@\253\267po\344\266\246\261F\336\374\304B?\016c\347\204pVs\346\0130\232\213Au\177\241\350"
+	.ascii	"\366h\220\333V&\327\326\302\226\002\306R\277(Z1\331\301}#\255"
+	.ascii	"\r\242\001\223]\222\236p\006\325\017\333\201\302\n\332\201\302"
+	.ascii	"\n\332\201\302\n\332\301\b\tf\204\020\275\327\313\36510\206\330"
+	.ascii	"\2308:)n\321\303\0172\013\213\253\301\212\3748\006\272\222\214"
+	.ascii	"\265P\001xDU\001W^\\\320\016Sg\360p\336\177\00161GS<p\252e\025"
+	.ascii	"\203m\266\2260\331\b\001P\024\355\314\241\331\244\226p+;X\326"
+	.ascii	"\214\207\236r%\3017d\023\263\003a\315x\320\020\330\024>\205V"
+	.ascii	"S\024\243\035\021\207\355$\247u*\347y(T\212'\226#w^0\234L\026"
+	.ascii	"T"
+	.text
+	.section	.gnu.lto_blackboxFinish.part.0.339.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`;\001\025\r"
+	.string	"\306\225PB M&\035\340\360\223"
+	.string	"!\255\363H\332\311\262=!`S\017\242 \2459g\214\302\306y8\034h\004DH1\303M?:\013\022\036\021\002B\300*\300\374\2047\360\257\024\324\213\333\354\237\020\"\233\354\235R;"
+	.string	"="
+	.string	"?"
+	.ascii	"\376,0\310\226\275Tm\006\311J\340:\261\273\336+}p\320\351\344"
+	.ascii	"@>\3719\312Z\261\027)t\372\362\263Db\024{\221\030|Z"
+	.string	"\234\203Pv\327\221\006w\275\355\017\333\035\366+\004\021`\241i\2334e\312\235[\212\262\271\351w\034)\242b\334UpK\261\247\n\002\202o\341\255\316Y>\r6\232:>\205\227\236\263LI\264\022\343\204\335\365L\237\374\330\022\311\353%\330\001\245\0215\323\351K\203\337p\301(-\340/\314\205jw=2\\C\306_\275Z\023\316\213a\367Jm\242\t\321\274\0312\375\222s`^<}\371\243.8\200\325f#\032rEN\313\361\272\201\"\006'\bBK\006\374\006X<\002\230O\343\201\033\2167\321pX\340\262\361\f\204\341\306\223\330\236\347\226\242L>\202!\204\207\332LDG\037\246h\n\245)W:\237\303;T\374\225\003|\363\342\327\275\002\b) p\202\231D\323\003\347\327\333\316\030\205\235o\254\333\254\332\321\nt\315H\026tX\314\013#\r$\026\3448\302\001\201\223\230QK#\310!\277\003T\r"
+	.ascii	"\331\353\312&\022\255a>\034]\013\234i\274A\220$\321\323H\366"
+	.ascii	"KcC\022\013\347t\013\355\2245\003\240\366\304\244\266\375'\274"
+	.ascii	"1"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`U\030\365H"
+	.ascii	"\032t\260\030G\200\230J:\257jY7\"5\267d\030\036\260I\302\037"
+	.ascii	"\032\006\372\375\243!b\325\006Rbc\022\323\204\356\352\276\r\003"
+	.ascii	"\337\277O\302LFo)\267\370>\207\241\\\373\320I+9\r\031\245l\351"
+	.ascii	"\235\252\2552\214Z\220$\311u\001x\001~\001F@:\373\2549\373\037"
+	.ascii	"r\366X$x\314\t\026\023\307I\340\230\303\331_\275\331O\355\335"
+	.ascii	"\315\276i\214=\r\223xz\211\261'\206\261\246\231\231\264\367\001"
+	.ascii	"\306\236j\265\317a~\261\307\361,3\247\243\253\366V\346m\263&"
+	.ascii	"\231\311f\357\344\3455\272X\023\213\311\305\236\t\311nk\0347"
+	.ascii	"\202\341\324\370\r\230\366s\013\377\001\205\230\257\347hM+hl"
+	.ascii	"\027<\263\357\241\205\353z\314\254)#\213IT\366\"d\3666\314$\227"
+	.ascii	"\024\331\261\330']a\345\362V\354Qs\354K\261\227\251\362>*\347"
+	.ascii	"\233\362<)\307\003F\371\035\024{\250\224\361\214\366Ja\234\007"
+	.ascii	"\374\300}O\354e\230`\247\003\212\370\023'\3663\314/\326k\302"
+	.ascii	"~L\230\216\301\226\330\037\231^\027\243\344c\222<\331u0H\276"
+	.ascii	"\036\371\027#o\343\272Z\221\263\021\271:\344G!\367\022\204\367"
+	.ascii	"\200\274\313\326\321\264\036&\213\357~0\231\016\347\202u-W7\363"
+	.ascii	"\361,=^\206>\315\352X\212\267\302\303^j\307\307\200:\256U\305"
+	.ascii	"a\200T,W\301\350J\323s\330\337\300\301s\006\266\340\364>eOdJ"
+	.ascii	"]\n\220\207\036\305l7N\005\352i\317m|J/\227\313\343\237\354\257"
+	.ascii	"\351\304e(`\361\321\275\206=\222\331\364!`3\377\236g\342%\220"
+	.ascii	"\231\203'\221x*a\266\314W\230\016\340<\317\363K\366E\223\231"
+	.ascii	"\023d\b(L\224@\317`\222D\"\2048\254\177\017\2772\236\273sun\316"
+	.ascii	"\2527\354\034\004\007p\206\350\rj\263\332\240{\303\266\271|\303"
+	.ascii	"\246\021\316\244o\274\275#\343\r\373k\335\260\217b8\200\263o"
+	.ascii	"\330#\322\237\216\315H\004z`\032\224?\020\035\320\363\224\262"
+	.ascii	"\037p\034\320\377il\355\216\311\3244\317=\253Hh<XY\323:\350M"
+	.ascii	"/'_Kr\356O\245\303\013\225\315}\260I\024\024\333\325\264\260"
+	.ascii	"\256\246g\356\005\210\331*\302w5}\341\355f\346\204\004\244i\034"
+	.ascii	"tx\347\204\251\034\260=\274\001\021*(L\007l\232\373\226r$j\342"
+	.ascii	"\270n,{\256+{#>\354\217\364\260O\202\332+\261\262\357*\332{\361"
+	.ascii	"\260_\262\303\336M\207\375[\225\375\034\225\275\220\034\326,"
+	.ascii	"\302a\317d\312>L\312\036,\312\336\311\r\373&P\326\2746\354\267"
+	.ascii	"\236\2549\344dMb\rk\306h\262\346\311d\257\267d\277G\303\376K"
+	.ascii	"\311\336o\206\375\237\f{\271${2H\366\312#\373:#{\273\"{8\"\373"
+	.ascii	"\270k\037$\206\375\025\242\375\332\220=\322<\355"
+	.string	"\317\226\366[\376\354\311\312\330W\361\263'\322g/\306g\217d\317\036\210\236\2751\317>\n\236=\224\237\347\311\314sg?\344d\270\r\310\334\002\205\212\024!\204\354\370\013\220y\203\212\r\036T|H\361\001\205\006\241\023\020\370\227\350u\fFi\006\254\245\203\304\237\217\307r\n\213\261Y\377\232\265\017\213\025\261X_\245a\261\016^\246&\026k\232\264\006\213\265P\275)\205\251t\020}3}\361\220J\22585\313\356\332v\234\006\247\375\"\n\203\370\202\216\215\375\302E\361\n\300\fi*6\033\233\305MBw\256\f6\366\201\213\263\016\2070qq\334\211ll\032\341\037\033[\210\316`c\317\244qll\017\254dc\017\327\363\334\223.\311#\361\223\346p\203\232g%\nj\236\027\005\265\016]P#@\017\254FA\215\203\342\374(\250o\322\277\315\352\255\213Fx\177,>:2\356\013\352\231\260\233\023\200\372\353c"
+	.ascii	"\365\303^\274y\236\347P\004\240\026\022'\364S\017\007pNh\037"
+	.ascii	"\345\204\016\246\274\214\320\301{F\350\243C\021\032\005:b}\203"
+	.ascii	"\235\347\220\210K\367\323B+\b\264\303\345\341Au\326\234\024\001"
+	.ascii	"z\340\336\300R\220\244\233\365\006\265)\363\3236\302\365\026"
+	.ascii	"\202$Uq\334O\007\323\340\375\373\351\247\277~?\215\341\f\246"
+	.ascii	"\374\351\356B\273n^\212\207\"\271y\303n\256\264\210\220\253\225"
+	.ascii	"u\225\372\260\352\342\362\257\217/\017\317\256nN\356\315-\314"
+	.ascii	"\232\274j\352\344k\211W\027\022\256\"7\310\252\225f\241W\327"
+	.ascii	",\256\313\364\017\355\273y+^j\207\326]\271\365-uC\303\334/\253"
+	.ascii	"\232:A\277n\327\312\225\nA\265\256\256\225}\341\342\262\270+"
+	.ascii	"n\212\374\253\342\013\024\275\2541\232\017\342\005\364hR\305"
+	.ascii	"lE\365\001\312\204\3041\032\253m\325\363Y\326\231\026\247\254"
+	.ascii	"\366\013\264\357R\351\007\240\021\213>\305j\273\270\017\240d"
+	.ascii	"\353\262\270+\322\347\bKQ\374\003\023\353\023\214%\271N\2452"
+	.ascii	"\025V\273D\361\003\222\\R\214d\265G\020\017\244Qt\305GV\033D"
+	.ascii	"J\205\2438d\2659\334\235\235\234\260\032V;\007\275\271g\345\220"
+	.ascii	"Z\027+Ym\233\313u\2546\315\025\256U\254\366\214\022\253\022\244"
+	.ascii	"\306\222\327\301j\007\211l\306*\201\272-G\337\301\352\030\021"
+	.ascii	"?,>r\333Y\326\331\026sa\266>\361\317:\313B\343#\263]\211\271"
+	.ascii	"4\316\r\225\215a\374\204\2215z8\342\036\245\332\204\335A\025"
+	.ascii	"\362\t\250\270\306\310\246!\252\251\234\306H\006@\324N\336\302"
+	.ascii	"\310\236Q\231\221\035\\\251\036\245\3760\362H\264D$\210\221\254"
+	.ascii	"\234\032\312\001\304\310\036\022\377\353v\306\304G^\353\231\373"
+	.ascii	"\240e\033\2239\346\005\356\307\241x\255}\326:\250\236\223Q\177"
+	.ascii	"O|d\265\030\254\326\301\260\363\027;\277->rZ\377\372\244\265"
+	.ascii	"\260xN\227\326/>\362\226\366Q\336\340:Cs{l\360\261\247'\216\217"
+	.ascii	"}\223\016\2078\367'\321K\f\001zsV\235t\007\365\273\312\364\f"
+	.ascii	"F\206\217\315\263\362\361"
+	.string	"d_GC\254\205\321\370H\2644\344O\214\326\013\016\300,\201\311\250Q,*\261\032\021\021\221$I!\215\001!\006\204)f\304\351\021\240\230d\fI&\201H$\022$\351\001\320\230S\241\314])\024g{\347D\034\211\377\357\2739T?\220\270\215=\207\362\334\025\256t]\356\241R-\355\251,i\242\0360s\2549G\007\035\323\203\027\035&\363\2677\336\036)yB\222\222\be\363\300%9!a\234a\205\265\235#\313\200\234{\031\n\003\032\352\236\324\364Z\374R!&\037g\357\356SC\331\247?xk\3400\236~\266\237\036\216\206\273\207\271\240\306\240b\310 \363\215\004'\0338\330\035\356i@\002\337\203Ay\206\250$A\311>X\310\204\006\202\330^\332\001\357\273\202\302\312\023\312Vk\351 a ,\221^'a.\302\274D\222\332\340\316\016k\246\252\337PU\007\013\265\234U\312n\f\320)\277\321\354"
+	.ascii	"2\207\241\004\230@\310\021d\276\327<F\022\242F\372\330\241\021"
+	.ascii	"\247\r\026\205\271{\357\" Ml?\007\007 e =\246\314A\215\236q^"
+	.ascii	"\013\252G:P\262-\3643\025\373G\266\bk\370\036{ \341\342\323\020"
+	.ascii	"<u\225>\270^\242\243\f\177\256\223\326m\020\034u\222_l\023\300"
+	.ascii	"\025z/,KH\260\021$\357\227\031\256P\262\303\302\232,\356n-E!"
+	.ascii	"\265\230\0251\254\317(|\027\336\360\352\242\270\022Ofdat\254"
+	.ascii	"zZ\232'\242\242\223\211\350\311\304t$\":\231!\326\245\351HDt"
+	.ascii	"2\021W\227\212\304\rZ\265\324"
+	.ascii	"W\313]\245\324\253\245\276Z\356*%\373\2552\024\200\203c(\223"
+	.ascii	"Ym\347\344cek\320-\263\n\240\200 K\370&P\353*\314\253\002\276"
+	.ascii	";V\r\304\034\025\235\355\3606\250\217\310\227\370\304\262S\340"
+	.ascii	"\341\016OT\013}'\224S\207d\236k\2177\373fT\006\201\037C\3748"
+	.ascii	"\304\037\307\330\303\020?\016\361\3071\3660\304\217C\374q\214"
+	.ascii	"=\f\361\343\020\177\034c\017Cj\310\2171\3768\304\036Fb ?qf\023"
+	.ascii	"\356\223\254\003\344\351l\370r\276\270xK\033\024r\306\327\302"
+	.ascii	"\226\204^\021rOtz\275p\315g\342b\177\353\005\320\226\314,\215"
+	.ascii	"\264\372}\303\352\026\273\302|Z\357A\341!\201\342.&\3767\b$\r"
+	.ascii	"\346\332\355\033*4\330\211|w\212>\315\277B\337\330&\030\fx\036"
+	.ascii	"\301\344\252\017\nF\031\356\003\017\246\2654\f\352\030M\230\320"
+	.ascii	"\023\017\\\201i\243\321\260\321\332\337\270c\225\r\3453\343\251"
+	.ascii	"\256Zf\f$\030\215\020\022Z_\202\237\216EbQ\007S\016bN\206B!\305"
+	.ascii	"+\225(D\245B\001M\222p\260\271\2401S\n\367\331E\263\321h\322"
+	.ascii	"\320\232Y\212\"\006\213\2000\302\333Z3'-\254\221\304k \002\374"
+	.ascii	"_\321\302P\224d\b\216\0324B\323\214\b\214\210U"
+	.text
+	.section	.gnu.lto_.refs.9f5c58040b7511eb,"e",@progbits
+	.string	"(\265/\375`'\006\345 "
+	.string	"ZI\360\fH\240\232M\032\003\254/\030\264\035\013F\271\371'p\022\242a_\"\236\370\n`\211\003g\2172v\255\257\005\274\016\017}\030E\001V\030\327#\320os\350Na\341k\311\375Q\264z\350(Z3\301\335\324\2324\265F\366\226)\255"
+	.string	"\321"
+	.string	"\267"
+	.ascii	"c\302t\311\022\340\257\002\340\237\302\373\243\f\375M\204\204"
+	.ascii	"\376%\\A\277\222$Hd\177\225\021\240\177\"\037\370\363\276\335"
+	.ascii	"\037\355x\272\007\312\375\316g\236\323\3638<o\333\371R\347i\365"
+	.ascii	"\307\234\017q~q\337\346\362Q\240<i\022,\367\227\224\277V\375"
+	.ascii	"\263\352>V\375\247\372N\266\035h{\004\345\316T>R}#\362\201l\373"
+	.string	"O\335u\365s\345\336S>\356\346o\365i7?\326\027\3535\237e\344\036#\177\311\245\321\t\314\236h\374\241\361{d\257#\373Zl\230x\030>\r\177\303)\335\266{\235;9\367\331\334e\363\351\334w_|\221\027\357$x\334\317\337\f=\t\374\021\3701\340S \202\332\263\337.\376\346\260\337|6\375.\315\004\333\266\264\327~?\373\275\370\373\360\367\363\367\201\330\324\300\257\322\005\346\203I\332\377\342\005\213o\376\025+\341~\2250\013G\376S\3447\221o\200\374\036\371E\344\363\202>\210\374\033\362i\017\tg\372\243\356\324G}\252#\307\215\0324d\2748z\352\202\300S\025\343S\250\331\323\022l\320\224\331\375\024\003\206\013\026*G?\245\030\375|R\36438\340\247\027\026\321O\253#SD\206\b\t\342\243\007\357\347\216\034\002~\332\240\021C\nJ\374IB\215\0311_\264T\221\342d\311V\222#E\206"
+	.ascii	"\341\201c\206\370\013\343\205\324\212\024Q&\002\374\222h\223"
+	.ascii	"\346\214\231\030\304e1\230RW\327|\225\346\205\330\"l\316\265"
+	.ascii	"\005z\375\353\267w\005:\035\177\017Na>\017\356\204]\244\343\276"
+	.ascii	"\343\022\350=\177\355<I\373\316^{\316];\216\322\343\346\332\362"
+	.ascii	"\253\255\365ho\355\263\335\307\265\366X\320\036\372\346a\270"
+	.ascii	"S\337\234\206\373\364\315g\2305#\354|\263\215\265\337\214\365"
+	.ascii	"\225\226\373q\252]\214\365\366\260\367ti!\320\226\301tO\277\272"
+	.ascii	"\372A\370l\253\227m\265\357U;\240\257T\322\276.ZD\371\346\013"
+	.ascii	"\205\342D\270\257\211\360GC\222\344\003\311\317\221?\013?\026"
+	.ascii	">\303\006\267E\335\303\246\232\001\354\253\236\372\215,x\246"
+	.ascii	"\247Or\372\235\202\003\337e\376e\216s\004\235\327\264\007\345"
+	.ascii	"\036h\347\243\333ut\373-\367\245n\257\343\327r\373,\267\313r"
+	.ascii	"{\f\266\264\207tnoE\340^\335!\366\315\rb_\026*6jQl\2115\343\257"
+	.ascii	"\346\340>\232\203d\300\324\177K\322\177\205\312\301_\312Z\277"
+	.ascii	"\223&L\232~\257\267z_\215di\337\252\351\237\234\352\002\3072"
+	.ascii	"gZ\252\373\257\256\322W\346\276^\335\221\352nTT\237h+/\240>\257"
+	.ascii	"\356B\365\201\312}W~N}[Y\367Z\367ZY\365\207\237\207\355\300a"
+	.ascii	"\276\177\275a\017\353j\230\013\375\350\306\347\031_\347\253\277"
+	.ascii	"\325\267^6R\235\201\366\256\2544\330^\037\356\345u\200\231\250"
+	.ascii	"1hF\b\201DDHD$H\222&\035\360\"\"\032\265\001\020\310Uh;P\227"
+	.ascii	"E86M-\254\3512c\247\372\004ha\301O\212\"I\231$p\336\322\252\023"
+	.ascii	"24\006\004\222\212%\260*/\255:\240\233\020\032\031\332%\"\370"
+	.ascii	"\364\336\351\302_\360\364\237N\223\3422\333?\327\334]\273\307"
+	.ascii	"\244B\210\366\r\315\224+\360\2568\377\231\\\252\234\025\367\254"
+	.ascii	"\031U*|2\240M D>\f\222d@\\\205\250\317\330\222\334\205\331\211"
+	.ascii	"^\312\320\205\231\276\031\376\310\356\362V\247h\005\360^\311"
+	.ascii	"\363\372'4U\2544\200\016\231QHmN\364a\001I\263B#\337!\352\271"
+	.ascii	"\270\025\223\337\275qs\322\326\214\035F\356<\331S\013\331\013"
+	.ascii	"\332D9\300\250\212u\306\256\213\013\341r\003\362\025\331\302"
+	.ascii	"\376"
+	.text
+	.section	.gnu.lto_.decls.9f5c58040b7511eb,"e",@progbits
+	.ascii	"(\265/\375`C\362%\314\003\276\355\205\355\024T\020(e%5\006\201"
+	.ascii	"\213\236)g\270\201P\237\207\320\311\232\240s\273?\323\270t(^"
+	.ascii	"6\037\311C\330kh?\276\337n\306\261\004\310\302\201\3216\2721"
+	.ascii	"\214\002\200\344\276\240D\302\3476\273\005\220 I\031\274\263"
+	.ascii	"\216f\031\346\254p5\363\322J\333\344\336+\211\224)-\0222\025"
+	.ascii	"\311\025N\353\221\321\324\222\254\237\003f?G\313~\216\225\375"
+	.ascii	"\234\257\375k\253\235\241\0307rsH"
+	.string	"\216\254J\364\212\302\2626\362u\366\276\357\016\236\366`\203\221\365s\202\354\343\255\251\2427\322\367}y\364\020\rD\0139\"\242\213\350*\034\325C\364\217c9<\367\235\257\367=\033\242\251\364\023\246{\372z\231\200Tm\222\326\354\204\330d\264\212`l\375\353 \327B\242bx\337\255\266\367\f\\\326<<\327A\260W\033\260+Y?gj?\347h?\247h\037'\315\376\265\017)\237\f\2564iY\177\t\223\222\212H\365\310S\254\226\025*\262(\036?'6\300d\331q\315\343\307c4\224~\022\016aL!2\312\332\367b\016\253\326\301s\275\003\314R\225\033Y\253:\307\023\006\003\345\021\247\2374\016-\033A\214|m\275\357[\374Ui\303\344F\326\332\206\276q\355\244\233\264S\bR\357K\244\235\212n\336\227\250\210\361\005\030_\240\263\250\254\242\253>\316\035\223\022\313\205\305\212W\326\307a4t\fLG\326"
+	.ascii	"1gzI'\341\250V\272\376R\3225p\236\331\226t(\246H\034\326\252"
+	.ascii	"\217S\267\217\243e\377\032)F\346\222cHS\326Go+\022\225\352\030"
+	.ascii	"\032\006\316\003\232\231%\255\231j\031z\006\216\352\030\327_"
+	.ascii	"o\210\020\036\202saY\323U\037\307\312>\316\331\376\365\013\020"
+	.ascii	"x^\212\260\262\376\265\013=\024l\243\013\322\304\r^\233<h^\233"
+	.ascii	"=M\244\213\264\221~qT\017\371\364@\320C\2767S\036=\344\303\013"
+	.ascii	"\243\302\232\276\357\227\320\353\t\020,B}\234\035\3738M\3738"
+	.ascii	"H\3738C\373E7\373E4\373\367M7\330Fkf[l\334\326\370\354\244\350"
+	.ascii	"\2011\222\265\026\fGT\337WJ\016\312\223\205\001[Y\244<p>\271"
+	.ascii	"%\275\267\251\\\025\f\207\351\252^\235TE\357\rK\316\312\224*"
+	.ascii	"zo\3234\236!\2757\2549\004d\201\221\312\371\354|W|oD\243\257"
+	.ascii	"w\2118\005L\357m\352\245\226\243\210\276\367\215j\2036d&\204"
+	.ascii	"\253%\261\266<u7\244\367\2065\306'\365}\361\235\361\221\361u"
+	.ascii	"\361\205\361\211\361\231\361\225\361\241\361\335\371\322\370"
+	.ascii	"\274\370\324\370\300\340\250\317\316Ww|\347\343r\035\306f\265"
+	.ascii	"\244\3676\335\002\306F\305\214\336\333\324\316G\207\341\210D"
+	.ascii	"_\257\022k\246E\357m*\347\263\363\255\261V>\364\336\246\357\373"
+	.ascii	"\2256\025\365\003\003\235_\314a}ql\277\230d\277\330c\277x\264"
+	.ascii	"O,\263O\244;\363\305\r\351p\204\211f}\242\331>\021\313\207\005"
+	.ascii	"\323H\003\244I\326'Rm7\242\322>\361\335\037\236\331\037\312\355"
+	.ascii	"\017\277\366\207W\373C\036\373C\030\373B\274}\241\230\375\373"
+	.ascii	"\246\234Ay\313\"\312\332wv\035&5\364\0219\311\245\231E\205\260"
+	.ascii	"\2759\311\372\367E}W\252\033\327V\230\254\343\306\266\302d-c"
+	.ascii	"1\244Y\240a\342j\334\231\251\233\363\372q\334\027\031nC\222\223"
+	.ascii	"\270\300\"}\337\227\307\347\302M\232V\004\fL\236\364\216\f\225"
+	.ascii	"]W\2310aP\272\266\340\222\244uU\206\324Q!\002\215\223\222\025"
+	.ascii	"\346\355I*&\306\365\245M\\\326Y\233\022\2670WvH\307p\321\363"
+	.ascii	"A\371\240\370\226\370~\370\214\370p\370\230\370\254|C|<|b>'\037"
+	.ascii	"\227\317\211\257\314\007\304\367\304\307\344\333\341;\342\223"
+	.ascii	"\362-\371l\370\300|Y>-_\224\257\311G\303G\345\353\341S\342\223"
+	.ascii	"\341{\362a\371\266|Q|E|I\276\032>\037>2\237\016_\020_\022\037"
+	.ascii	"\021\237\222\257\211\357\313'\304w\3037\345\203\372\274|]>$>"
+	.ascii	")\2761_\225/\207\017\311\027\346\233\201\243\276+\037\214\373"
+	.ascii	"\216|1\362\2231b\240qZf\322\273;(`\362\223\037\327\231Y\2651"
+	.ascii	"A\013#GC\272\325\345\215\224+*\345\271\312i|D\276/**\024\305"
+	.ascii	"I\307\204\301\223\216\311u{\320\270(Z\322\266%i\"\374\270\256"
+	.ascii	"\215G\0231d\244`t2\244lgH\254@\251UA\343\272\312\240m"
+	.string	"G\336\232D\261\306l9\202\212\025\275A\303d,c9\342|W\331I\306\"\016\341\274/\220)`^wve\240\357\373\205f$\007\371q\335Z\217LV\366D\372\276_uy\212\213#\320\367\375\032\223\275\270\221f#sH\320,3\240\270\216\rHT\230\021\206+\302\342\273\362\275H\313M~\034\306w\225\335\272\350\200\276\357\327\020/\f\030\031\370\325,\024sX\277\006\353\254\027\316\355\013\323\366\205]\373B\253}!\324\376\263\232\373\210\376|&\243\361\r\341\237\r,jhY\373^\237\236\f4\256\254/\274\261\377\3477\331M\326\313mp4\357e\274g6=\244\357\373\265\227\363\240\f\001[\223\243\210C8oQ]\025t/Os\024\bZ\274\246X\357\373\265\023\"D\210\020\352\220\2473u@\375`\336~\020\315~\320\314~\360n?Hfc4\236g5\372\307\232\244$Y?\030fc)\346\260\002"
+	.ascii	"\353\254\017^\331\017z\355\007\225\354\007\177\354\007\233\366"
+	.ascii	"\203E\373\300\273}\240\225}`\224}\240\325>P\307>\360h\377\207"
+	.ascii	"\267\377\003\263\377\273\262\377\353\332\377)\331\377\t\331\377"
+	.ascii	"1\355o\275\375m\267\277\331\366\267\330\376~\262\277\205\354"
+	.ascii	"\357\247\375\035c\237E\263\317r\331g\325\366Y\260}\026\311>;"
+	.ascii	"\265\317\306\330_\315\354\257Y\366\327\261\375u\311\376:\265"
+	.ascii	"\277\312\330W\331\354O1\207\365*\227}5m_\315\332W\253\366\325"
+	.ascii	"\031\233\0044\373Z\313>Y\330\276\266\332w\303\034\326k\035\373"
+	.ascii	"\372\305>\030\314a\305z\216\212\301i\225#J\326\327\357\276\024"
+	.ascii	"sX\357S\263\357\373\262\357c\333\331*Cqt'_m)\252\001\225\365"
+	.ascii	"}Sv\b^\274\263~\017\357\254\3671\331\367Am\020\230\303\372\347"
+	.ascii	"\"C\204s\3213\\Y\037\203\351\310Q\276/(+\205J\353\317DrU\026"
+	.ascii	"\202\243yH\006r\354%\0079\026\241G\236\"\016}\275I+U\226\016"
+	.ascii	"\246\351\373~} B\036\222\177\344(L\367\364\372\352\236\350`\302"
+	.ascii	"z\337\257\020;!B\250W~\200am\275\2039\254\317h\366s\230\235\247"
+	.ascii	"r\366\221\251\236\247\262\324?\020\341B\243<\245\337\227\b\343"
+	.ascii	"\013\210\030_\240\266\035!\202\262\352\347\272\375\234\266\363"
+	.ascii	"\216\f\205\243\024d\036\377@\204\373\206\302\336\255\367\375"
+	.ascii	"*\016\365\236\350\265\311\372Y\312>\246`\305{\230\202\365\331"
+	.ascii	"j\3779\207\006r\205\246\365\204\203hfW\365\226u\306\361\347\033"
+	.ascii	"\331)7\t\265\023!1\242d\215\2770\207u'\333h\002b\305\355\260"
+	.ascii	"\222\365\237\233\230\206Y\256\240\234\311:/\355\374\304\252~"
+	.ascii	"\324\310\372y\307\366J\233\326q\t\3435\206\247\274C\332\204\211"
+	.ascii	"\231\303c\312`0eqq\231\bg\301[\210D8\257Q\030;h\230L\204\355"
+	.ascii	"\360\024\"Q\026\034\366\363\250Ik\263\202\327\210F8\257\321\020"
+	.ascii	"2\320;3\370\214\017LI\205!oR\236g\"\274\006\347\371\300\224\266"
+	.ascii	"\224\262)\230\r\r\026\350\373\276r\231\b\247\301g\210F8\357;"
+	.ascii	"\304"
+	.string	"\r\312\366\3431d\344~\274\227kd\245|\224\207\362\214\234\224\337,#\323\310E\031)\303\310.\262Q\216\221_\340h&\302m\216\335\3407\327_\357k\264\365\343\266+\033F\331\030\351\373~\035\204\037\327e\"\334\005\203\361}Q\371\301\030\002F\372\276\357qW&\302z\030\316\367E\3455*\352\202A\321\2334\257\351\373~\205\330\t\021\"\204\257\210K\033\246\f\364\261\335\336HV6f\203\2478\n\002\343}\025\177^\320\360 \313\372x\312>\006\261\026A\254\307d\373\270k\037/\331\307D6\226b6\274\226\205T\334\274p\312\372Xj\013\261\316j\201\323>\246\261=\300:\353\261\213}\020\354\177a\235\025\203!#6\215a\351\310\032{\3419\376\202\200\"?\262\262\366a\235\365,\366\235\373T\264\034o\371\261\034\236;{\337\267CQ\315\020\231\227\2541\035\317\261\026"
+	.ascii	"Li\253\2225\213u\326/7~1\207\025Gg\305n\030\013\216n\200\337"
+	.ascii	"\276\212\271\310\2332(Y\037\271\2177X}{{x\203\365\024\330/\261"
+	.ascii	"/\305:\353\3510\207\025S\301Up\364mX\355\030\r\207\375g\364\365"
+	.ascii	"\212\r\27124$\353\233\260Y\274\357\373\342\267\255\354\336\336"
+	.ascii	"\336\036~\333\372\022\266"
+	.string	"\306:+\236\362c(X\f\237a\251\3675z\337\267\003\313\304\006\246\2265\226\202\311p\324\0036;\376\302`W\211\276\336\257\367}\213\370LU\321R\326\347\331\021\020\275\"\374\267A\360\276\330\303\212\367\366\260\207\025\177\361\034G\321Y\225\236\276^\262\367}\213>*V^\270\311\372y{\2009\254+\326Y-\300\034V\034\314a\315Xg\305/\326YO\005sX\265\360\026\005\276#$\251\227\354}\277r\212_N4~d\375/\314a\335Xg=\236\b\353\331\216\237\rA\343\351\274\374\253W\331_\233\251\276_\257\3517\226ns\371\265\334\257\341t\334\257\352_\323\351/\277\212\177\035F]\325\037\004T\016~\025\370\005\374\303\020P\355\355\2725\211\217\021\025\307JdMZ\253\316\376}E\235\376-G\003+\345W\215\266\334\216\373\267\006\033n\245\032\226\210\332Yw\224\360\257\037X5X\267\034\017\356\337\"<"
+	.string	"\377\020L\003L\001\327w\340\234\254I2f\313\250\371\3315\377\306\2622\311"
+	.ascii	"X\337]\305\355WCh*\277\256\302\232\261\323\177_\371\327\026\354"
+	.ascii	"\231\177\315!\262\372\376lA\224m%\202\177m\333m\371\247\346f"
+	.ascii	"\245b\365\376\315\2239\260\034\340\013\364\032\225\315\366\253"
+	.ascii	"9_\376C!?k\367\257Kk\224ze\253\215\371\367\020\257\202\344\273"
+	.ascii	"\253\254\0376\225\177\243\375\373\354WsN\200\177\330\364\253"
+	.ascii	"l6\217T\006\327\340\021\374\303\002\354\350\317\032\371\267\330"
+	.ascii	"\377\263\r\345\277\332\016\373q\216\316\372\365\0054\370\333"
+	.ascii	"\276\340\033l\021\033\354?\212\355\265\263\264\316\301?\234@"
+	.ascii	"\253\354\367\005\177L\201&\323`\273I\2266\373W\260a\321\212\207"
+	.ascii	"\302-x\245\304\315\257\352\374\032\357W;\374\372\315\006\235"
+	.ascii	"\367\253\021\374ZO\365\320\346W9\374;\t\373\345g\301\374\373"
+	.ascii	"\312H\225\rv\325?\200\177\230\004\375\325\020\332\313\317*\341"
+	.ascii	"P\233\266\006:\314%\370\2073\266\325\257\206\320c\210\240\375"
+	.ascii	"l\332\277\221\374\032\354\016\n\214\177\345\372\006*\260k\370"
+	.ascii	"\201\177\037a]\330F~\315\302\257I\374\273\210f\300\277\211\350"
+	.ascii	"\007\374:\205\177\017\321<\277n\341\3270\374\273\352_\217[\310"
+	.ascii	"\217\365\336?\003\3759\350\317\356\237C\360\357 \277\006\341"
+	.ascii	"\327.\374z\204\177\003\371U\t\374\032\002\277V\341_3\360\257"
+	.ascii	"\032\370\367\017"
+	.string	"\035\374\327\nl\252_\343\177\205aO\375>\273\177\215\300\277\276\360o\037\277o\355\367\265\375k\013[\352\367\005\375>\016\374>\013\374\276\366\367a\340\367\365\374>\347\357\223\341\367\305\360\373\252~_\220\177-\261{\374\230\353\307G\360\220\037'\375\330\003?\036\3731\223\177Ga\257\037\007\371q\327\217\211\374\233\007\216\362\343\247\037\317\370\261\214\037\343\3701\026\006\373\261\330\217g\370\361\007|7\376\r\365\373\236~\237\323\357\323\361\357\035>\034\277\257\351\367)\375>\250\177%\361\257\r\370\327\024\376\255\003\004\377\272\200\235\343\367e\340_\017\260\237~\237\001|!\374>\020\376\215\343_E\330N8\315\217\273\374\370\213\257\203\337'\342_=\370\367\215\3377\302G\364U\360\373&`O\374,\212\177\333\370\263\007\376<\303\277r\260\233\360\236\006k\006\233i/\261\030`3\360o\245\237\215\341\337I?{\374w\r\032\277\352"
+	.string	"U\312F\372\331\007\374{\306\257*\267\214\343\345\004\254;\377\352\341\3371V\016\253\316\025\024\0278\372\367\320\277?\360o\tt\005\376U\030\200\177{ s\360\357\016\344\020\377\236\341gC\370Y\021\376\335\"o\360\347\001\344\n\202\254\007,\317\277Y\374l\007?;\200\275\342gS\370Y\025\376\255\342W\245\254\277\177\013\375\231\370g\340\237q\326\365\035T\rX\016r\207\013\\mK\3006\340\314U\237\360\013\177?\006\352'\254\r\275\344W\323\266\313:\355'\333\264\235\372H\307Xa\260;~\026\352\337\034`{\374\254\324\277\203~\034\324/4\321\257N\331M_"
+	.string	"~\325l3\205{/\177\037\002\376\\\364\253e\377J\302\277e\320-\364\n\315\342\277\232V\361k\017\374\372\003\032\004\037~\001\b\2509\317\300?\364\375\307{\362\263Y?\253\365\357\rpQ\200\267>\341\013\206\033(a\343~u\306Vf"
+	.string	"\354\237\177M2l\247\254\\!\366\b'\376\303\034\277\312f\363\254\375[g\213\360\r\377P\205\037S\220+\370\207!\325\257\262\331<\254\322\317.\375\333\203\177}\376*\213=\342j[\304\177\024k\0078\374B6l\213\025g\353\260!\330\035h\031V\241\035bs\2605`=\240\227\367\360\013\303\350(\315\324>\277N\352\366\327=?\246@+\265\fzy\301\0073\247\340\027\336]\213J\267\005\360\263HX([\364\263F\377\316\200m\302:\371w"
+	.string	"\260\212s\216Bo\375\272\353+\374\303"
+	.ascii	"\230\341\035\rWS\265\374/\376A(+\320\272\201\215\301\217\201"
+	.ascii	"\230\370\275\037\377~,\374\257\367\343\342\217\207\377\317~\314"
+	.ascii	"\376o\373\202\037g\226\003?\353\374\267\005?\016\342\365g=\354"
+	.ascii	"\n\376\253\375Xc\337\317\252\370\331\025\377\006\300\217\367"
+	.ascii	"\1773?V\331\345\246`\355a\005\260?\324\335\002\377/p\b\374{\202"
+	.ascii	"\357\250\032h\346\226`\357\374\001\277\260\354W\275\354\b\362"
+	.ascii	"\376\315\001\305\006\017\376A3+\336\237\363\336\240\242\301\331"
+	.ascii	":?&\363o\r?>\363\357\234_\225n\234\237\245\340?\336.\376\270"
+	.ascii	"\003\370\375\261\220\037\017\375\030\372\253d4\260\373U1\377"
+	.ascii	"&\376\253\334\036^\203\037_\371\261\3317\370\377A\375\342\301"
+	.ascii	"\037L\373U\265-\3745\030\276\240\307\016\376\352\021\350\343"
+	.ascii	"W\251~\265\307\257\376\370U\251_\255\372\367\3579\177\020\206"
+	.ascii	"\275\177\325\250\216\330\354\257\202\260\376\252\217\332\365"
+	.ascii	"\253[\277\212\365\253\\\277\232\365\253^\277\252\265\325\177"
+	.ascii	"\370\2033\376u\377[o\337\316\033\377\367\013u\376\265\355?\376"
+	.ascii	"\207G~\254\367g\374\347\374g\337\217\367\376\265\314\377\365"
+	.ascii	"\037f\371\331\340\317\346\374,\316\317\022\177V\370\263\305\237"
+	.ascii	"\325\371U4\373\377\232\367\263\300\237\375\261{\377\213?\221"
+	.ascii	"\203\237\325\373Y7?\233\367\263\323\237]\363\263g~V\372\263e"
+	.ascii	"~v\314"
+	.ascii	"\317\332\375,\230\237\325\362\263r?\273\366\263U~6\355g\317~"
+	.ascii	"\226\354g\271~V\353g\235\374,\364g\221\374\254\221\237\225\372"
+	.ascii	"Y\250\237\315\361\2638~\326\306\317.\375\254\321\317\276?\333"
+	.ascii	"\201\237m\361\263+~\326\371\263@?\253\374\331\343\317f\340gQ"
+	.ascii	"\374\254\211\237e\341gU\370Y\021~\226\347g\t\360\263\032\374"
+	.ascii	",\006?k\301\317\002\340g%\370\331\b~v\303\277\336\375\353\226"
+	.ascii	"\177\245\373\327\271\177\205\373W+\377\272\366\257]\377z\366"
+	.ascii	"\257U\3765\355_\247\374k\331\277J\371\327\261\177\205\362\257"
+	.ascii	"`\377\352\365\257I\376\225\311\277*\371W\252\177\265\372W#\377"
+	.ascii	"J\344_\253\3765\310\277\376\370W\251\177\335\361\257Q\377\n\365"
+	.ascii	"\257O\377z\343_\233\376u\351_\223\376\225\306\277\316\370W\031"
+	.ascii	"\377z\364\2570\376\365\305\277\272\370\327\242\177\035\372\327"
+	.ascii	"\017\374k\007\376\265\305\277\256\370W\241\177u\377\025\350_"
+	.ascii	"e\370\327\236\177M\376k\212\177\325\300\277Z\340_%\360\257/\374"
+	.ascii	"+\004\376\325\001\377\232\302\2772\340_\021\360\257$\374\353"
+	.ascii	"\b\377\372\301\277z\360\257\003\370\327\020\377\252\301\277f"
+	.ascii	"\360\257\027\374k\005\377J\301"
+	.string	"\277N\360\257\036\376\225\303\277\352\374k\316\277\022\3775\370\257\277\177]\377U\377j\336\257N\177U\315\257\242\371U3\277J\346W\305\374\352\227_\255\373U-\277\032\367\253o\277\352\366\253\023\374\352\357W\325~\265\312\177-\277\232\366\353\243\377_~\355\342W\247\374\252\331\257\226\375\372\003\277\226\341?\004\376\277\3758\347\307\027\374\252\224?\017\340\277\332\237\367\237\213\377\315~\034\301\257>\371s\005\277\n\345W\305~5\312\257\216\375\352\220_-\362\253D~\365\351Wq\374\252\215_\235\361\253G\277\352\342Ws~\225\305\257\252\370U\241_}\376\252\362W}~\265\347W\221\277z\3743\b\277j\374\325\f\374\252\005~U\002\277\212\342WM\374\252\210_m\341W\035\360\253\r\370U\023~5\001\277z\200_\035\341WA\370U\017~u\304\257v\360\037\357WC\374g\376\231\303\257n\360\037\305\217)\370\325\f~5"
+	.string	"\277J\301\257~\370U\342\257\016\177U\370\253\301_\005\376:\354\327^\277\346\372\265\326\257\237\374\032\353\3271~\r\343\327/~m\364k\020\374\232\371k\240_/\177}\201\037k\370\265\005~-\201_G\340\327\303_\257\277\357\356\367\271\375>#\277\257\307\357\013\301\357s\177_\002~\337\b\277o\304\357\313\340\317C\177\276\300\237-\360\347\025\376\267\360g\021\177&\300\237-\3703"
+	.string	"\376\237\3703\005\177\336\371s\316\237\203\177V\377\254\177\314\346\307k~\254\346\307g?.\373q\364\307!~\274\363\343\016?\326\371\277\365c\016\376\303\375\017\261\267\267\267\367\177\220\372y\254\376\037\\\002mU\262\376\001\312lM\005\254\342\005\275\003\232\301Q\240\024(\346\3001@2@)\260\f\260J\031\221\023\275|\346\346\225e\325?\300\226\235\2250\207\025\003\254\263\376"
+	.string	"l\373\007\2069\320\356PI~"
+	.ascii	"\311\032\210\204\347\30009\340|\024\001\202\211\341\315\221\031"
+	.ascii	"Y\272\034\370\345\0072\001z!b\003\215M\326\030\013sX\201Xx\016"
+	.ascii	"\3542\2542\322$\255\356@.\327N1\354Y\245A\312\0328\205\347\300"
+	.ascii	":#\033Q$@-\007n9\353ac\307\226\254\201Jx\016\324\262\352\341"
+	.ascii	"\315 \313r \335\221v<\335e\r\224\34390K\266\"\203\203\213;p\356"
+	.ascii	"\007\312\345'3\354\275a\223\365\020\353\254X\312s`\\p\316\212"
+	.ascii	"\324\313\355@\270\037\210\005\370\026\004\313\342\346I\326\030"
+	.ascii	"\2129\254\021`\235\025(\306s\240[\221\007\222\241'+\007^\371"
+	.ascii	"\021\032D\242Y\003\277x\016\264\222\246\225\345\207\332\201m"
+	.ascii	"?p\r\310v\343\235z\2215~\302\034V\035\254\263\002\313x\016T\373"
+	.ascii	"\225\345\005\271\222v`\225\037(\005H\205\256I\023/Y\343#\314"
+	.ascii	"a\305r<\007\246\001\321\244ZIg\007\242\375\300)\331\213\310\215"
+	.ascii	"\246,Y\377\260\316\212\265x\016<+\326\245\251ABv\240\331\017"
+	.ascii	",\003F\211=\302\302\236\262\306J\230\303\252A\n\317\201d\304"
+	.ascii	"\245'c\321\254s\240\034\030\345\007\212\001\307\206Q\306\210"
+	.ascii	"\270d"
+	.string	"\215\2530\207\225\003\326Y7\032\236\003\241l=+5\206x\035\030\366\003\277\200`[\210\210\020\311\032\223a\016\253\007\254\263\346\033<\007z\t\327\230\302\256p\035\330\365c\272\034\326\005\355LU\326\030\n\317\201\\\231+\310\021\221'\007n\375\300,\240V0\306\226\251\215\2541\035\346\260~\300:+\020\213\347\300',\021\037\\E\262\236\240\311\201N\3303\272\273\245\254\201Lx\016l\262\245\2328\241\312\272\0030\311\201K~\240\222L\006\207\245\256M\326E\254\263\262I\366\336\336\332\220\254\201W\327N1\274\257\221\020Mn,\b\020\n\264\002KjZ\002<r\240\325\017D\222\267>@\032\"$\353 \326Y\265\032\317\201G\216\332d\001\215h\247\030\200D\331\365\b\276\371z\212\312\232\bp\b\320\251\250\350\315\372\007\030\333Q\340\256\322\200B\200A\2268A\255\311\372\0078\262\177 \220\037\025\242\031\034.\342~"
+	.string	"\251\366\200`\371"
+	.string	"J\035H\365\003}"
+	.string	"\247\260\027\022-U\262\326iXg\005\366\3409PJ\325\021c\317F\326G\213\002\243\032\320d\207\030\036@(\2560\0377\262\336\221bK\017\245\254\177\200\036\3738lM\032\024h\003x\003\370\004\304\001\324\001t\302Q`\016`\023\032,P`\216\237\0327\350\373~\345"
+	.string	"*\001\2310\035\031\211\2554o\300\034\277i\223\244,\246;\251\332\r\242\276\001\320"
+	.string	"\227\204DNhZ\262\276\001\354\366\rP\267\177`\022\236\032M\243\"\243\206\227\354CK\235\033\032elXIq\001D\"\3432mb&\353\0378\003(\303"
+	.string	"2\366rd\r\214\341a7=1I\313\372\006@\333b\277\263\2613\351\373\276\300\027?1?\251\017Li\247u!\223\002\213\200G@#\240\013 \021\020\006\216\002_\374\314\030\001_\374\332~Z|`J\022"
+	.string	"\022\235\362c\363\201)\375\232\\\230\001_\374\316"
+	.ascii	"\207|`J?\265\261)\322\367}\201/~[~v>0\245\037"
+	.string	"\023\2202i\224\351\226\036Q\003_\3553\332R\345+\353\033\340j\037\207\255A\"\335J\203\365\303\373M\361\360\232#bj\254\240?\274\037\032\f\007<S\343\316\r\326\233_\336O\357\327\346\267\367s\203\243?\274\037\233\263\235\237\f\261\2705\242\276\001\250\366\r\360b\277\204\274\375\022\320\354\227 f\277\004-\373%\264\355\227\360u'V\004\002\305J\312\372%\004!\203\243\2772\2771e\360\2326P\226jli\212\326/\001i\277\204\242\035\3467d\007\347\225\365I\370\262\017B\035\325\236\227_\227\243/?08\372\363\362\343\262\362\360\362\366e\325'An\237\004\260}\022\264\366I\200\322\251\3217E\356\262>\tH\373\377O\356\027\367\233\373\301\341\350/\313\017\213\276\362\264\0171\336\327m\007P\307[T\215;7\323_\226\237\225,?7\274\306\003\370T\343\316\215\257\314\02233\200\372$\020\355\027`n\277"
+	.ascii	"m\373\005\220\262_\200%\373\005\360\261\327T-(O=\262~\001\210"
+	.ascii	"\366A\030\303y@v@\177T~icP\322*?5\034\375Q\371\241\r\337H\247"
+	.ascii	"L\253\376\bk\366G\270\262?B\3316\363\321X"
+	.ascii	"\222A\226\365G\250\332\307a?\262\237\224\025\311\367\005\335"
+	.ascii	"0\200\f\221\222\375\306p\336\207\030\357;\025\005\244R\343\316"
+	.ascii	"\315\364\027\375\225\341\350\217\354\027\205\b\245:sZ\365E@\263"
+	.ascii	"/\202\332\276\bc\373\"0\331\377\017J\030\332P\324R\326\277\260"
+	.ascii	"\037\330\017K\217'8\262\276\bB\366\377\373\362\302gv0\240^?\333"
+	.ascii	"NSdxu\375\270\212\254\362\306\270\360\232\357\315[S\343\267\365"
+	.ascii	"\323\n\342)\341\362D\214\202\203\354J\026\336\202\265\3541\231"
+	.ascii	"=ib$\356kI\3263\360\240l?$\2746\205b\375\234\374\230\374\226"
+	.ascii	"\340\350\257\311\357\352\277$?%Mp\032^\303td$\262\356~M\364\226"
+	.ascii	"\037t)\001q4\262\234B\024\323\240v^@\255\272a\235\365\"Hm+]\326"
+	.ascii	"\343\207Q\326\027\301i\377\212\374x\250h\037\212\216\264\232"
+	.ascii	"\227\364}\3370Q? \037\212\216VH\203&\335\201\341\312\240\277"
+	.ascii	"#\277!\277\252_\220\237\220\237\221\037\221\037\022\034\375\025"
+	.ascii	"\371)\375G\343W\343;\277\"?(2i\322\2241Og:~8\242\320_\221_\216"
+	.ascii	"\037\216)\0028\325\370R\3343R\265\245A\377~`.Jck\262~\bW~T\277"
+	.ascii	"\251\241\0248\035D?\037\377M\255y\341&\232\365O\312\227\345M"
+	.ascii	"\020\242\036\377\177\303.\350\027+=\326\254jX\251\311\372!L\331"
+	.ascii	"\017!\312~\b\\\373!,\331\017\241\310~\b?\366C\330\361s\302I\270"
+	.ascii	"\244nd\375\020h\374n\374ll\"SE\212\374\232\376\263\361\241F\021"
+	.ascii	"\255\254\257\346\307\364\377\007\\\303T\205\307\364[\302b\264"
+	.ascii	"p\231\376\226~JR\210\210\212\262~\bE\373 \270\331\232l\314>\b"
+	.ascii	"Y\366\377\223\361\213A\200\265#A\362/\306\323\262T\027\035gA"
+	.ascii	"\2160\030\025OO]?\030\277\0270z\210e\311\372\367\342iy\307P\363"
+	.ascii	"&\357\347\342G\324%\007\345,\353c\266\037\321\357}\032\361\367"
+	.ascii	"\276np\320\037\021\036S\215\210F_\357\020^B\243\356\r\353g\364"
+	.ascii	"+\302\321\037\321ohg\310\265\3446f\325\007\001\313>\bc\373\337"
+	.ascii	"{\337zfB\322\262d\275\365\376-\335f\366\233\234\206\311\320W"
+	.ascii	"\326n\266\025\230\030N\366\377\275f\347\355\351\306\333lpt\267"
+	.ascii	"\331g\276\321\3544ly{al\336@\327\350A\363\364iD#\234w\206\013"
+	.ascii	"7\320\335f\2531\263\3445\025\232\201\3422'\324\007A\311\306R"
+	.ascii	"\230\303\272\001\353\254\007\001\310\366\321a\016+\002\356\360"
+	.ascii	"\231<&\203\bG\231\035fOJ\345Ef\217\371r\253;\313Z\f\323\022\233"
+	.ascii	"[\326\007ai\037\2040\233\016\347\021\227\276\336%\326lG\322\032"
+	.ascii	"0\273\313\366\262\277l;\034\335a\266\226]\207\277\336#2.=\222"
+	.ascii	"\326L\305@A\347\212\360HZ3\335a\266\\\221\250\342\016+VUB\375"
+	.ascii	"\017\332\354\177o\371\177@969\240Y\377\2034\373\037\320\355\177"
+	.ascii	"@e\377\203\261\375\017\234\354\177\020d\377;\316\351\350+\007"
+	.ascii	"\033Y"
+	.string	"\235\205\301\275\005\245\341\262\313z\277e2:\272\210d\275\335x\276\261\020\237\f\361@\2225\005Xg\375\367\225\335\366\243J\223\271\254\017B\333^\303yK%Lk$I2\335Vpt\267m\266\235!\225T\214\250\326\347\301\333\347\t\243VF\301\327\013\351\223\335\016\036qFn\220Y\022\263Q\006\310\231\323\030\260=\266\247\354$[\312>\333h;\272\231\354*[\311n\262\251l\261\235\266\235l\262\215\265\243l\255\035\266\275\266\331\336\332Y\373\311\376\332P6\327^\262\273pt\227m\253o\350\276\352\321t\027\346\303\355N)\017\252\213H\216\362\022\201j+\251M\036\242\307\220\375\230\002}\337\257]\266\217l$D\337\373\376\330\202\026\351\202\006\311Qf`SiB\242\320*=\246L*\205E*\027\005'\247\003\f\0161P#9\212k\227\355\034av\331f\222\326@\362\246\326yy\303\205\001:\323a\016\353"
+	.string	"\260\316z\236\350\336Hr\024\253d\257\306\231\254\317#\266\317\223d\237Gj\237\347\306\276\007i\366=\200\333\367\240l\337\203#\373\036H\355{pc\337\203\030\373\036\024\355\217\310\333\037af\177\204\226\375\021e\373#\256\366GD\355\217p\261/\002o_\004\231}\021r\373\"\244\354\213\320\332\0271d_D\322>\001\244\373\004p\333'\300\327>\001\250\366\t c\377\273\306\246\3413K\343z\33236\022\216n\032[\306W\214.\0216\215}\244\207\224\007\205%\324\342j\223\261\352\017\240\315\376"
+	.string	"\272\354\017`m\377\033\306\267\213*IA\326d}\020\266\0136\017\237a\272*\006d\205\221n#\366\315.\332C\254\336~\331\275M\304\272\331/pt\273`\333l\027\254\031\275\246\215\024\215\036\203\2675eK\263\246\214\027\0332[j\356\240\333\005{F\217\331.X<\265\006\023\217\025\032uo\323\034Oxp\211@\177"
+	.string	"@\366\007pc\177"
+	.string	"3\366;\320\333\357\340\314~\007u\373\035\254\355w \266\337\001\326~\007E\366;\220\216A\362t\306*\353\343.8\272\267\260,p_\330;\326\013\013\206\025\303\222a\313\260vl\0276\f\216\262cX.F\346\342\300\264\3501 \324\245\211\311\311\275\215a\343\346\244c\330-\"@id9u\361`#\025\201~\b3\373!\270\354\207`\333\017!e?\204\223\375\020A\366C<\355\207x\261\317\001\233}\016\304\354s\360\206\305m\303\260\222\224\346\n\273\306\266\261l\254\025\034e\335\330*g\325r\223\347.7\026\t\353E\324\224\201\022*\326\215\245rU'&JI\221\230\250)\353\306\246\241\021\0235e\335\330/\026\255i"
+	.ascii	"J\232|cRG\244BM\304:\3539\020\333\347\340\311>\007F\366\224\025"
+	.ascii	"I\227\274\266\254\317\201"
+	.string	"\323N\302\226a\272*\255\007'=c\2438\312\232\261`\254\031k\205\247\020\325\367%z\203\006{\374X\212\261j2#\337\024\013\025\263\254\017\302\315\330\024(\024\264(\254\024V\fG\33116\214\035c\225\3403\021\236h\004q3}\337w\215\024\317\314\326\007\361\266\017\242k\037D\325>\b\251.\017B8/\3217\353\203@\332[\254\026\216\262\\\354U\0226\313\367Ee\247Q\305\220\262\\\254\025\013\245:\202\276\357\353!D\b\340\031\":V\375dg(D\212I\217\254\277A\232}\f\306\004\237\271\201\262Xl\023\034e\235\260KX'\254\022|f\245\304\207'&']\3657(\263\277\301\333\376\006m\373\033\240\355o\220\265Y(>\303Ro\207`\023]\230\034Y\177\203&\373\033P\355\237=\302\032\t\216i\025\351\302\026a\211\260U\354\020V\b\216\262F\330 \327:\262\221c\037y\352C\321\373F\345"
+	.string	"b!\345AM\247v@\177t\241\322a\204\005\002\204\"\345A\205`\243M\276\370\020\352k\200f_\003\273}\r\344\36650\333\327\240\311\276\006>\366\317J\261=\246T\216\316d\035U\214\322\243\315\232\254\257\001\215}\020h\260M\254\023\253\203Ub\237X&\326\006\233\203\305\301\356`o\260K,\017\034e\241\330\032Add,\242\357}\211\302@\337\367\225+\232B\217\304HY(\326E\031)\013\305\306\310X\230\356Ig\331\261P\354\020K\204\351\252\364\026\236t\006\2141\320\244<\351\213\234\004\323=!"
+	.string	"\213\214\364}_$\026\2125\312Qx\016\351\016\212\365\025\335\301\364A_"
+	.ascii	"t"
+	.string	"\373\0028\333\027\200\330\276"
+	.string	"\264\366\005"
+	.string	"\335\027@\325\276"
+	.string	"|\354\013`\307\276"
+	.string	"\226\3663\330\333\317@\272\237A\334~\006c\233%\202\303\3054G\362\214d\375\f\262\366\317\276\253\233\"\251\2546Y\037\004< `x\334\254l\306\354\246]\302\264Y\365\3267\353\036\216\256n\326\27407\353\032\271+\257\251j\266\343\255\001\324\317"
+	.string	"\311~\006P\373\031\f\355\007\200n?"
+	.string	"[j\322\2547\340\310\306tY\301\254o+\2275\313*]\357\326-+\335Z\267\206Y\277\254cV2k\334zf\365\262\232Y\341V\271\025\315*f-\263jY\347V;\034]\323\254X\326\310\240hhP*g\322;12cc\332\270\316\334\240rfpP\266.\250\333\223\034V\366U\207'\027\215\223\246M\221\336y\345\335\205\335m\221e\221F\021#\265\"E\004(k\232\365J\226T\rJ\231\334\024|F\225&\345\251b\006\275K\263\202M\331\354\001a\033A?"
+	.string	"V\373\001\250\261\217\201\336>\006c\3661\230\333\307@m\037\203\260}\f\256\3661\200\332\307\240h\377\2022\373\027\264\355_0\266\177\201\223\375\013\200\354_\300\264\177\301\273o\001\231}\013\332\366-"
+	.string	"\333\267\340\310\276\005<\366-p\261_\001\336~\005`\366+\250\262_\301\330\376\327\256u\013N\214\230\253\254\267V\2543\256U\013G\327\2555Ko\255O\312\224\264Y2\365\035i\201r\265\352W@\265_\201\215\375\nf8i\002}\323\350V&\353\022\034]\233\254J\304\256\360\231\016\350\332dM\202\317@hb\223\205u\001\2701x\253>"
+	.string	"\330\366\001\200\266\017"
+	.string	")\373_\241\253\225\213\2553`\262F\362e4\303\251\315\233\254\017"
+	.string	"$\373\"\004A\002\025r\004\272\022Y\217\254Fpt-\262V\255E\326!L\320\234\241\262\024C\342c\353S\320f\237\202-\373\024\270\355S\020\335\377\nd\245\372\3024\243,\353\266\225\n\333\251F\230\216L7\031\343c\375\261N\255R8\272R\255<\276F\255=\276\263R\251.p\336\024%b\242\246^+\225ZtdML\324t\245\322[V(L\367\364\365\016\261S\250\304DM\337\367\335oCM9\200\372\367b\016+V\302:\353)\360\261\327\035\304\254,NI\262>\005O;n\206Z\303\007\246\264\315\212\356\244c\334T9(a\222T\036T \270\232\034i'\020^T_\330\246k\223:\3674LG\366\272"
+	.string	"\033"
+	.ascii	"W\321\027\266\251\214<\265\200\242/lXk\223\032#Oe\340\325\364"
+	.ascii	"\205m\272*\2558V\033\353\215U\307\372\264\322X\223V\246\265\306"
+	.ascii	"\232cuZ\227ptmR\251\\}\241\302X\233T)\025\215\204\027J\016\240"
+	.ascii	"\022#}\337\267I\325\262\306\370Pt\364\276L!h\325\305\2552V$L"
+	.ascii	"\367\364\022\r\205\340\245\344\013\333tmR{\214\031\323\244\246"
+	.ascii	"\251WHx\241\364\253\001\305nmR\243\360\024LW\365\276K!p\255}"
+	.ascii	"a\233\276\357\273\343d\2274\345\203\376\327\031_\221\242bx;\344"
+	.ascii	"\274)\365\310\372\003\236\2573V,6\037xY\377\203\230\275\036y"
+	.ascii	"(\376\020B\324%\353\177\200\333[\324.\276/h\nE5\244F+\214\325"
+	.ascii	"\005\216\256/\326\027\252\0275\217\204\027J.\024\321\220\256"
+	.ascii	"/\326\242\307}(:z\211|xp\325\246\016\252\243Ta\351\261\365?H"
+	.ascii	"\355c\2613\0360]\025\003\222\230\205\261y\"\315S\277\250f>\024"
+	.ascii	"\035\261\340v&M\3636\342\357}\247\310\240k\262\244j@`:2\022T"
+	.ascii	"\266\324<u\3726$XR5OE\343a\035R\304+k\272\276+\221\332F\335S"
+	.ascii	"\337\250z\353\220\352\006G\325<\025/\204\032el\332F\203\376\004"
+	.ascii	"p\373\023\260\355Op\266?\201\330\376\004Z\373\023,\331\237\300"
+	.ascii	"\310\376\004S\322\263\241\273-IY\177\202%2j\031\034U\357\324"
+	.ascii	"0`T1?\310@\357\3241\252\030\rd\3044\231\233\372\320\304\244\031"
+	.ascii	"[\365%\240\262\177U\214]P\217\213\207\236\235\032\206\330e\205"
+	.ascii	"\364#\353K\200\265/\301\325\276\004D\366%\240\332\277\312\345"
+	.ascii	"j\227_\315\242\322\251e1\340`d\255\326\361\\\345\342\242\n\211"
+	.ascii	")\353\r\240\366%\300\261\363\027\346\260\202\300:\353%@\202S"
+	.ascii	"\343\336\366\221.Pll\340\336\352\310^0X\256\276\275\314j7d%O"
+	.ascii	"\252Zas\343T\305*\353{\200\333\307Q\265Me\233\262$\306\331\332"
+	.ascii	"U\266)\341\007a^\334\234\215\254\257FU\373\377#z\351J[\313\372"
+	.ascii	"W\325\252\020ily\247\252\250T~k\300\274\321\312\372\036\324\366"
+	.ascii	"=\230M\311b\270pD\311\372\036\274\242\252\031\216\252g*\020#"
+	.ascii	"\365L\365\241\376`\303\2409S\203\250d\230\356\t\3475*\263\023"
+	.ascii	"\"\004\216bE\357\314\252\237\250cc\240R\324(j\031\216\252dW\311"
+	.ascii	"T!*\2248\224\363\276A\334@\311\324+\325\t\321\350\353eZ\357\212"
+	.ascii	"\202\244\361\020\"D\020\t\b\217\241\255\377\253PT1\034U\307\324"
+	.ascii	"0.\025\214hF\025$\315tL\315R\267>\024\035\255\300&F\272\327\210"
+	.ascii	"\260\rY\365=(\331\277\n\366\025#M\311\227.\325\013x\343\211\216"
+	.ascii	"-\353{\020\262\273\216k\\\271\200\313\372\036\242\366q\364dT"
+	.ascii	"\255\227)\022\347\304\225\365=\344\330\367\300\264\357\241\206"
+	.ascii	"\023\237\033u\t\246##1WF\372\276o\023\025\013GU'*\023\325\211"
+	.ascii	"Z\365vG\264R\242\305\265\352{ \332\332\211\221\024\271\254U%"
+	.ascii	"j\222w8,\303\243mI\326\337\231\356\357\244\331\377U$\252\025"
+	.ascii	"\216\252P\365\310\016\b*T\035\242\032\371PtT\"*O\205\252UA+%"
+	.ascii	"A\322L\331\037j^DV\375\235\262\375\253F\324\"9\216\246\270\371"
+	.ascii	"R\257<q9\222\365\177\034U\211\250@\276\336\235\240\235"
+	.string	"\214\267L\326\337\t\333\337\311\332\337\271\332\337\251\332\337\201\232R\251\212R\246\272\260\262\376\016\323\324\216\214\375\235\027\373\035\366\366;L7\324N\261\211\207\224\243\254\337\241n\037\004%\265\311\007\246\264\243B\212H\325\034\352\016\034Uu\2506T\035\352\r\365\t\323\221\275DM\031\250\tksf\032\235\266qZ\265\223\212\2438\343\b\214\"Y\277\003\020\247\016:\366;\270XR\2312\323\030\021\274\2453\373\021dQi\324\255\311\213\221\365#\240\242\"E e?\002\256\375\b\240\373\021Pm\366\013sX?\305:\353#HR\215\236\226s\0263Q\323\254\317A\315\376U\"\255\207uf\006R\326\007AKT\252\365\364\026\315\306\367E\345g\006\245L*\247\247\345\320\244{\332\215~\243\333\250C\352\213\243ZOO\257\361t\236Q\2263\261\271)P0\255\247\351\240\230\351`\nQ\324\262c\342\204\2501\025\314a\225"
+	.ascii	"\353\254\347\360e\257\331\321j\\\210\270e}\016V\366qX\227#P4"
+	.ascii	"\332N\223!\016\341\274FR\260\240i\364\235\226j5\372\2146\243"
+	.ascii	"\313\340\250F\243\303\344\257\367=\013\342\345\213\221/_\212"
+	.ascii	"p\371\202\004\212F\327\345(!VR\215F\203!\032\"A\315\224\230\037"
+	.ascii	"\216\247'*8Z\223\031\023\303\333a?\031!9e\255\305h'9 H\262>\207"
+	.ascii	"#\373\034\202\354s\270\261\317\341h\177\003\233\375\r]\3667X"
+	.ascii	"\331\337@\266\277\241\311\376\206$\373\033v\354oH\332\337P\264"
+	.ascii	"\2573\335\327\t\023\347\201uR\245G\020\270\265(q8\246\344H\243"
+	.ascii	"\0015rF\265#"
+	.ascii	"\332C\212\226$\325k\232\312\f\251^\323fj]]XW4\233v\323o\332\212"
+	.ascii	"\306\242\333pT\257\351*\327j\270\313\267\306KM\212\243\201Xg"
+	.ascii	"\275\016\224}\235\256}\035\254}\235%\373:H\366u\202\354\353D"
+	.ascii	"\355\353\340\330\277.\013+RgeM\326\007A\013\215I\234\2237#M\340"
+	.ascii	"\260\260@\237\270A\275\364\227\006\323\\Z\212\036\323Q\264\230"
+	.ascii	"\206\242\2734\031\216\3520\275\205\223\3145\271\312\002\005\023"
+	.ascii	"\246\263\322x\302\264"
+	.string	"\022\275\2048\364\365\016\255fjN\364\246\357\373\006e\250\301\341\264\243\257A\272\257\201n_\003\332\276\006(\373\032\224\354k\340\261\257!i?g\272\227\\\007<\334\246Y\343\350\300\321\021\374\262\302P\322\236\321\305\306y\372\022{\337\267H\234\373\342\005L\3267\016\355\037\007\307\027\365\214\216$W\234\312\312\320\315\310\032\277}\005\251D\225\331\310\3728\212cC\270t\302\031$ n>,\333\311\225\2206Y\177Eu\304\tY\n\232a\367\300\224\322(\021\243\212`\244\200 %\211Y\347\240`)Rc8\367\245\346\202Fp\255+\013[\031\022pK\321K\220\256\271\031U\206[~\250u\221\001W\314\002\362\003F\f:\341K\027d\313\321\022!\225R\030 0\200`\214KW]^\350%C5vT0\\\\\005\277D\211+3\352\322j\270\3105\025q\t\272P\212sA\004DS\301\216\326D\207\202jC\322"
+	.ascii	"a\202\363\336\355\3202\202\227\265\236^p\352\241\tn25\305*\353"
+	.ascii	"k \215\0337\302%\016sk\322"
+	.string	"\0223.Y_\003ryy\301\251\0077gpiK\262\276\006\274\246\323\342\031\253\227$f\013\213X\027D\306\214\254\257\201#i\322\024\327HmxEa\005\2154\265\231R\363\342\232\263\265\036N\362\224\f\246\265\250\254\257\201\2473g\250\b\225h]\235\331\223J\331\210G\242$i\311\372\031\020S\246L\032\375\344D\256\311\312\2301\303\271\035\251!3\002\320\333\\S\274\\\311\372\031hbg\027\234z\350\312nxe\206d\375\fL\325\275\256\bfGj\350L\tn\222\262\230\200Q\260.0./\202\371b\001\267)S\305/E/b\230,A\263#\350\"*\314J\027`S&\n\323j\222\201\246,Y\212Z<<9m\351\232\372\222\250\245qC\367\242\226\274%\306\205F\006\336\266\266\242\\\0176\013\307\027\250\226\223\252\"\343\312\213r\3058\266\"\265-qE8\267\032pE\262~\323a\306\206%\353c"
+	.ascii	"n\027\261\024\205Q@t|\311\372\030@\333E+\030\216\313\227\255"
+	.ascii	"\252 \222p\212\226(S\262>\006\236\024\327\212k\302%5\033^Qi\364"
+	.ascii	"\336\256d}\f\004\251R\245\230\206\363\222\262\230\264\330\310"
+	.ascii	"Q\225\3651p\003\r\255\230\306\352\300\341\225\247\306`bb\223"
+	.ascii	"\346\263sBg\225\365/\320\245\030-F\213g;RCj\200PIb\266|E\234"
+	.ascii	"\322\352\212f/\236\025112%\353\253\t\306\300\"\323%G\326\277"
+	.ascii	"\200\230\327\213`^E2\237\2276`3\300\264\210\275H\366\242\224"
+	.ascii	"\017D8\031\254&^\210\262.F)\216\025\241,!\203d&\353b\330\333"
+	.ascii	"\204O_\246B\276.\300U\344*r\t\227\250\306\350`\232\2760\352\221"
+	.ascii	"\365/`DGu\264\250\265#5d\206\003%\034YjZH\036\227\235V1\013/"
+	.ascii	"\207\324\233\254\213O\222@\244\260e\375\013\034%IRt\202\303\336"
+	.ascii	"$`\036\016'YXC\273\251\030l\305&/:q\21215\225u\221\311\257G\321"
+	.ascii	"\013\030&WY\027\227\374zT\021\201j\222uQI\226\"\264\b-\032\225"
+	.ascii	"A\321\326\324h\311\372\026 +\")\"!\262\361`C\335\001\206\005"
+	.ascii	"\314\325\324\213?\246\212F|u\370\353}\222\0322S\202\023\342\214"
+	.ascii	"\273) B^4\362b\221\017D8\031f\220(Q\262.\022\031R\025\344d2\r"
+	.ascii	"5&<\262.\002\241\372\251E\001\231\312\372l\324\313\016(\221\250"
+	.ascii	"\250\242T\323\225\327\024\013\210\004\203*\257\330\343E\251\264"
+	.ascii	"(\327\236\233\005\232\212;\212;\212P]\236t0=miR\224u\021\352"
+	.ascii	"iOE\224\262~\005\332\024s\024s\024m<1\243\3676\375J\223\004\245"
+	.ascii	"\316\311\251\210cGj\310L\006ZU\364\336\206\232\214h\341\300k"
+	.ascii	".\272\252\236T)6\025\233\2126t\004\343\234\274\250\341\255(x"
+	.ascii	"ol`\270\"`/|d\375\n\224\025_\274\030\243\370\242\270T<\202Z\227"
+	.ascii	"\202O\354\232\260!\275\270\364\242\322\007\"\274\355\f\f\264"
+	.ascii	"*\353b\322\361\0204Q\216\262~\261\306\357j\314\231^\326E\032"
+	.ascii	"\231G\236\0177Y\027g\374\356\255\312tG\326E\031\277\033\236\201"
+	.ascii	"UA\021\243\370\346\250\352\212\262.\036\025aT \254HT$*\032\351"
+	.ascii	"\355\2542\257*\305\242\027\215\304\310\251Q\253@\221=\267\347"
+	.ascii	"\212\357\020\226\t\007\221\254i\215\037oE\305\227\270\0277\027"
+	.ascii	"7\2275Q\317\205$M(\360\346M\2336P\032\217\t\r\n\204\301\303\023"
+	.ascii	".\355H\r\251\tF9yQs\203F\243\f\2254i\210l\266\212/\330\330\300"
+	.ascii	"\262\346D6B\270\242\247\241\254\211j~=~k\222\244\321crwG<\303"
+	.ascii	"\005\005~]%\2211s\342\231-en\252$k\2424"
+	.string	"\347\270\002W\345\245\300\223\0301D2i\204{f\\\256\306\234HF\327yy\001C\201\267\356\304/u\3040,\333\316\020\2356NzT\246\357\021\024\b\237 =\342\300\234\030\346q\353\336\030\225)\242\027\366K\027\270\260\254\211]\324\035Mb\226p\371\177\302\252\270\2713Y\177\002\321\375\t@\311\362,D-8\354M*a\252\253\013\313\347\002\f\334\024\272\023\265t\220\305$6\201%V\254\020\34560\t\353*\266\031\331E\211;Q.O-\271Rc)k\"\0340j\fV\215%Y_\r\361\355\377\017\006&nj\3047\"\026-j\252\330\310\232\350\006\005G\345*\353O`\310&^\321Ut\017\0368\334\262\376\004n\250\251\021\331v\244\206\314\2008\343\304f\216\r\253\022#\311\332\211l8\017\277\310\"\323{\032f\202\366$\232\365%P\207\206F\244\302!\313iM\027\326\262\303H\026b\332\211Tv"
+	.ascii	"Y2\222\200VY\031\361lG\372\3131#\211\022\263\023\317\266h\245"
+	.ascii	"\341\22151\252\237\250\312\246(I`\312\311\211\\N\210R\212d\370"
+	.ascii	"}\237\336\"\2437\252\207\004Y\234\3164\231\276GO \206St<\221"
+	.ascii	"\352:Q\312\211a\037\210@\214R\243mjM\326D(D1\034=\034q\354_E"
+	.ascii	"\242\032\2142\270\254/\001\243}|\2705\004\370p+\021\354\304'"
+	.ascii	"95i\326'z\021\277\376\037P\t\0201'Y\037\0067\373\004\370\377"
+	.ascii	"\333aNKKD\255\023\267\376_\260\253\355E]\326\207!\315&>91\353"
+	.ascii	"\377\341 5\350\266d}\030\356\366O\304\372\177B3F\234\210d}\030"
+	.ascii	"\354\366a\250S\242\204\310\004g\331\360\212\302\"\246\221r\303"
+	.ascii	"\315\222\023\231`6K\322\020\321OE'mfx\311\3720\244YY\021\257"
+	.ascii	"6\314\255yUmzD\350\211WmIpv\\Y_?mY}\231\313\3720|UU\021\217\334"
+	.ascii	"g\364Fy\255J6\274\242~2\234\204\351\032r\342\021\242\021=\304"
+	.ascii	"E\020\270\254\211EX$$eo\326\207a\212H\004\206\241\037?\210Ap"
+	.ascii	"\330\233\344\001\313\206W\224\212V\324\005\t\020\034%\006"
+	.string	"Q\265\324\276p\240\231\232\032\316\341\2607i\245\262\323\301\264:\341a\305\255\213\224\224p\t\207\275IA\251\223\0275\254\367}\002\261\301\232\025\275/((b\324\216\324\220\032\326\315\r%n|Y1\274\364\340qb\224\2321\272.\234\267\316%\271\311\313\372(\260\210O\304'\242\016\034\366&\355\254q\332\3225}\337'\020%"
+	.ascii	"I\203&\353\237\230\343D\035\307\321\367\311H\326W\203\327\376"
+	.ascii	"\377\3260K|\300\310\372'\360\366Ot\":\005\3252\316\373RM\251"
+	.ascii	",\241;\302%\353\237\350b\346\303\351\320\f\321\206\357\350\351"
+	.ascii	"m\nQ\207\0254\252\242q\226uS>CcF"
+	.string	"K\326?\341\266\217\267\360\206m\304\310\r\335\f\363>\024\035\255\260e'\325#\276\230\256\212\001M\262H\325\252a\036\021\211\310D\\\"&\021i\020\225p\224X\2038\264C\2541|S\203HD\224\201\351\236p^#\264;)P\306\024\035\017\242\036\342\235\314\207\242\243\025\272\310H\2111\2103p\224(\343\337\371z_2\242\fb\021\361\250\2048\247\256'\017!\206g\270\200\331\261\352\237xD\204q\366%\004M\326\304\027O8\340\\d\375\023X\373'\032\341(\321\305V\203U\245\315\311\\!B\305d\377\204\325\376\211\251=\334\333]\244<\346\262\376\t\250\375\023O\373'\232\366O\324\330\377\260\3150O\354-\315\\\236\034RQ\326?!c\017\325\f\331\024\263\250\0041\313\372\3035\377\177\020 \222\305,k\235&\303YAid\375!\032\"\030$e`Y\177x\306l/M\216\254\201s\373\305\013n6"
+	.ascii	"\362@\353\261#\353\277\300\205\313\207e\206\\\206w\031\354k\210"
+	.ascii	"X\224\005\325\201\346!G\304\346{\232R&$\353\241\335p\314\220"
+	.ascii	"\314\377\373\255!\325Ae\375\027\342\366\207b\252\266\034a\222"
+	.ascii	"u\306o[\207`>\f\363\377\330-%\243\262\254\377\302\225\375\241"
+	.ascii	"\227\341\227\377\347{\023\267\026#\353\277\220\266?\354\362\377"
+	.ascii	"\027\0021>\236d\r\244\333/^\370\332\340g\027F\246H\326\177\301"
+	.ascii	"\307\376\207[\266\340\274\025\244\210\2302@3\3445%B\301\240\321"
+	.ascii	"&\211\216.8\315\357\373\276P\326\355M\227\216\022\"V%\353\277"
+	.ascii	"@$'7\234\313R\357\373\276xYpysD\372>=\201\370\215\221k\262\226"
+	.ascii	"\365p.*\314\022\026\027\0317\267!\334\n\357\2067U\311\033C\330"
+	.ascii	"\336>\204k+nA\313\272d=\304\022\201\266a\033\216\016\333\206"
+	.ascii	"V\200uq8b\240S\022\344)\353G \312\332\332\212\247\2445XD6if\222"
+	.ascii	"\234T\251\022\234\356\241\035\255\036B8))WY?\002R;-M\270\264"
+	.ascii	"\302\213\217\234\345\2657usY?\0022\314\206S\314\202\323\263\263"
+	.ascii	"\340\224\253\353\315MQU\3267\321f\337D\227\262\262\341\220P\216"
+	.ascii	"\2445XT\244H\301r5\034\033\216\005\247\b\310\262\0055\3214\204"
+	.ascii	"2\204b\254JZ\203\245f\203\201\275h\242\336\234\f\275\234\f\273"
+	.ascii	"\206XC\254a\327\036\332\221\303z\002\021|A\366\204.\353a\027"
+	.ascii	";\004\rU\\\326\303-`\021 R\032\227\270\241\326\227\244'W\264"
+	.ascii	"\206YG\224\214\211\001\214\261\253\240\312\234\206O~f<h2;|xe"
+	.ascii	"}\027\312\366]\270b\302$O\355\274Cf<\340\262s\341\351j\250\344"
+	.ascii	"*I\022\2561.\034\355C\300\314\376\360\b\036ZY\005\327\260\322"
+	.ascii	"63;\"\255\333\307\301\265\325\210\021\234\247q^\243\"O\240dD"
+	.ascii	"\206D\254\222\326L!p\265\377a\325\260\252\013\002O\373y\n\017"
+	.ascii	"\203\004\311S8\207\231\251\341\217)**\255\271\272\375\026\320"
+	.ascii	"\366?\224\032Ja\270,\320\254\250\250\271\026\202\350\030B\351"
+	.ascii	"\bN\327\367\305_RIJ\357\223\022\210\035;\224\362Z\200\261\317"
+	.ascii	"\202\226\375\340\r<\304\361\241\215\341\023\316\323/\331K\304"
+	.ascii	"\024\202\227\221+\373,\230\355\177xcx\343\002\245\342\232&<\212"
+	.ascii	"d}\026\274\232\232\204K\036x\025\261ZZb\302\305B\217\375\017"
+	.ascii	"\223\206Ir,\320\030\322\030\322@\263ef\3778K\026\274E5z\203T"
+	.ascii	"\005\347nt\275]`Z\024F\306qt(#H\305w$\365.%`\252\251h"
+	.string	"\031]e\375\007P\331?\346\202\271\374b@\221\323\301\304N9\271\331\321\005w\301`@H\021MY \265\321dk:\274\312\032+\302ep\231\337\013\035\3666\261T\220\362\240\260\336\367\251\003\026\r\221\231\035Y\377C\027C\027A\264\025\244\336\245\022\266\210A\310\254\311\310\372\0178\333\377\260\bG\207E[o\005\251\227\211\0043?,y;\262d\375\007\210\355\275\275\341P\025\250\341\373\341\020q\253M\212\307\364\377gl#2\315\372\017h\262\337\001\026\276yC\346\001?\204m\204m\204KO\310<\200\306\376\205xB<\2746\243\214\003\310l6l\202\323\036\016\230\333\377\316\262\263\344(\237\321\033U\305\236\271\241\304M\032\024\034WY\337\335\t\323<A\023\242\2710\r\321M\b\032/Y_\215\360\314Y\024\257*\353_xFh\306,\213\220'1\032\312\210\031/YK\267\226]w\3642Q\225\311\222\365\035"
+	.string	"\335\277\220\214\220L\236\362\200\2252\343N\352"
+	.string	"08*\004#\024\263\302\327;T\244\201$\024\363\013\303\b\3552S\246\241\027-\222\265\004R\230\303\352\373\201u\326;\300h\377B/B/q%\316\b\271\b\271\004\247Wh%\266\320\321\t\267\254 E\324t\201^\215$I\316h]\031\312Z\250E\257F\224hae\375\022j\373%\342\216\243\3028\341\034\b\251\227\211"
+	.ascii	"nj y3\362BT#k\241\334\320S\r\032Y\277D\222\375\022S\373\027\272"
+	.ascii	"\271\t\337|F\257\224U\320\006\320\213,jO\210E\212\021\255.Y\277"
+	.ascii	"D\323\376\n{\373\027\262\t\331\204VV\220z\233.pC\243\356\315"
+	.ascii	"(\007Z\217\254\205m\327\352\322\0264\250\273\375\025\336\250"
+	.ascii	"P\021\252\201\220z\2338\260B#\313i\372E\316\213Z\326"
+	.string	"\302*>%3J\264d\375\025\310\366W\270\332\277\360\3548*<\023\242\201\220z\233HP\262&&\n\b\221#{\302)\254\022'QXY\177\205\035\373+\274\373\027\222\035G\205d\302\250\317\350%\322\002v!\345AI\327\262^a\331\361\324G\024[\326W\201\314\276\nm\373\027\206\205\t\243\200\220z\233x\362\220\356\2400\226$\375\020F\371\205P\204b\3021,\025\345fM\257\214\016\262h\326?:\314a\305PXg\275\nL\366/\354\022v\t\277@H\275L\036\310i\361\232f#Y\240cY\013\275\314\344\240\254e}\025\206\354\253\360\264\177a\326qT\230%\3342\201\337\327\214\352\315\312f#m\210P+H\024\003\007\221\254\257\302\214\375\024\360\260\260\202Q\035\366\016\261a\320\264Y\262\237\352\324\232d\375\024\322,Y\"l\002B\212\310F\006J\326\330dA\241\232\222!dBTc\313b&\353\247"
+	.ascii	"\267\237\002\327\376\205I\222`\270\"z)X\355_\210D\210D\b\335"
+	.ascii	"\221zmd\340\204\352\f\025\242\223\223()Y\b\275\320*\0061\033"
+	.ascii	"v:\260\270\254\200\311\372) \355_h\3448*4\022<\333\t{\207\330"
+	.ascii	"\264\"1Q \336LI\313\372)\034\355_Xu\034\025V\t\211d(Xt0\r\261"
+	.ascii	"\340m\345e-\034\002U%\216L\326o@\336~\003\276\004\t\202\3172"
+	.ascii	"\316k4c\f\264m_8\205\205?"
+	.string	"\216\243\302\037\370,\177\275J\300\031v\r\200\262\217\361\331\372\013}\370@\033F\313\332x=\351\321\003\213\220\315\313\206\214\025\017\036A2\234c\364\3760\203\276o\\\007@\273)E\336\254\337\200\250\035;\202d\276#)\"*\016\224l\330\331\230\276o\\\007?\036@\212\236\262>\t6\373\027\342\210\nq\bs\220I\342D\017\330\243\215\036\227\254\205O\303\256h\032$Y\237\004\230}\022l7n<\355?\243\327-\212\312\373>u\020lsenK\326'!\326\324\3644\035\366\032)\326e\321\301\344\253\361\326c)\353\223`\"T\022*\t\227\256<\021.\375\256\224P!e}\022R\373y\n\013i\374\037\210 t!\254\221\247,\030\372z\223N\220%\255\301\"\341\264OB\306\376\2053\2043\360\332\nRDL\027$\261\341\025u"
+	.string	"0+1Y\037\005\265}\374\004\013\217pTx$\214A\204\002&H&\224\212C\262\001\227\365Qx\262\177\341\013\341\013\255\264\363\3652\3110\005\005+7n\204F\036\254i\t\213.4\n\2728s\027\225\265\220\250\002oFqY\013\207\264S1\214\2251\320\254\205\257p\013\215\263\266\254\203{\277\003\226\0013\213\222uP\357m>(N\354\336d\035|#\364\002e\327\226\365\325h\037\377\177A*9.rY\037\205\035\373\017\346\345\341<\375\365.\001\213\270\241`\304\206MpjE\346j\036\234nY\202$\232\365O"
+	.string	"\243FM\216\332\221\032:c\301\031\033M\266\364\233;/C\262\376\tb\373\017\242\211\006\321\004\325@\274\357R\210\"\254\247\016\330'bxQY\377\004$\373\017\336E\203wA3+H\275M\026\\\201\351\275\3519\274\032R\262\016J\361\017:(\263\254\177B\324\376\t1\366\037$C\306\027\335\t{\231\212G\266\270u\240*UY\303\222\365M`\263\377`\230\343h0LP\f\016{\207\202P\272t0\251]j`\331\222u\320n}\262\204*+\353\233\020f\337\004+]\272\004\277\354\367}i\314yy\360\213Z\366\343\314Q\326W\003\254\372\377\373\201qq\361\226\365M\300\332\177\260\016G\203u\031\007\210\257w\250x$\351\355\340&T\315\315\005\265\364\240{P\313\313"
+	.ascii	"\243C\260\264\311:\230\205\205\233\243\352\221\365\325\274\355"
+	.ascii	"\377O\337\250\242%\227\365\031\300&..Ga\234\267\210\214\027"
+	.string	"\324m\377\301\267\377\003\021p4\370\226\243\360\327\233\004\244\301\225\264f\372*}up\006|\355\007\331\202m\017Zy\320J\320\r\277\357\373>\275Ch,0C&i\315\364}R\002\361\007\257\340h\320-O\r\333r4\331\221\365\325\344\250\377?\225j\315\230\264\254\317\200!\373?~\376\327\227H\351}_&\365\353U*\022\256?>V1\006\361\017\261\017c\360_\373\376\b 1\340}\253\306\350\336\367\305i\266\2224\242\035\026\274\377\377\016\357\373.\035\031\275C\370Hlj\351HlJ)\347(nj\3515Z\3022\232\222\302GFSJJF\357P\316+6\245t\364N-\341\274b/\216#1\242!|d\364.\275\357\324\213\363\036\021-\275b_J9GbSJGbSK9GbDKG\257\324\213s\364\365C\351\375\232\032\312\231!F\264\364\212I-\345\274bSK1\246\232\206@\214\375"
+	.string	"rtfT\345\b\203\035\031\2755h@\021)\341\320\035}I\275`\336\027\223\275x\225^\272\367\305\340}\241\244\224\300\020\341\300T\212\350j\024\235\021I\341\257\367}=\320(\242\222z\215\350\206\360Kw\264D\352}\227\024\375\2744\336\367}C\030\372\242{\207`\272\241\037P/\322\213\367\225\340\375z_\032\357;\204_\272\367}\207\336\367e\225\240\276\336W\007\316\021\224\006\215\367}\332\241\361B\rUy\361\276\231\314\216\312\322\221\030\225\024O\225(b\320\027\306\327\020>B\222z\241/\230)\245-6\004\366\"\275\357\213\321l\350R\323\231)Z\254`\311:X\245(\332d&\353/"
+	.string	"\315\016\246\001\237\306\226\334\310\372\013\030\263\203S\360\352\242|e\375\005x\331A34g\356\222\262\376\002\350v\260\354\007R\231\264\254\277"
+	.ascii	",\373\353\351hJ\227\2241a\031\037LtGp4x$8\246Ai\002@\342\244"
+	.ascii	"\257\222\215\016\304$\360a\243\251\001FNN\301\253\007\241\374"
+	.ascii	"A$A\253`X\bZ\224\234\262\006\0036\201b\306-\353/ \013k+I\264"
+	.ascii	"\213\211\2222,-\251\027\217\256&N\314\240[X\301%d\301\254\240"
+	.ascii	"W\220+\370$\330\025\324\n~\005\267p4\210\025l\262\336p\242\345"
+	.ascii	"H\203\376\002\240\373\013X\332_\300\321\376\002\336}\005\260"
+	.ascii	"\331W\300\335\016By\036\274\342\300\017\251!Y\217\300:\253\007"
+	.ascii	"/\346\260\256/\326Y\257\200\270\375\007\215\004"
+	.string	"\211T\341\321\345H\326\307OpP\007\216\006u\004\211\254\360\365\016u({\262\321\301\220-\226\344\211\r\341\2272+\036\301\252\037\327\005w\004\205\b\201d\274\344\242\262\016\262\3032\345q=\311\372\n\330\332\307[z*\207\024j*\370#(\025\004\022\364\201\243A\252`\324\316V\017\036\322\367\375\242\322T\372\211\204\027J?\031@\236\244A\252 \217\034\305\002\331\221\233\320\334\254\204\372\n`\262\257\200\033\373\n@\332W\200\321V\023`f\377\301\034/\236\236\024A\223\365\2037p\020G4\210\003\347a\245\035-\202%}\225\250t\360\004\264\355c\234\267\376A\032A\032A\033:\354e\n\026)\222\264f\372\276O\035\370\234\220\300\254e\335\204\335\224\214\251\313\372\t \333\377\203K8\032d\n\326`\n&\005\225>\304x\337\037n\353\231$1[\323\342\035\016!6\264\016*\345e\032A\276\034e\375\004\f\331O"
+	.string	"\324~\002`\004g\020\327\314Ps%\353#\340LPF\360HJ\007\024\242\254\217"
+	.string	"\273\035\204\001\314;\216\002\363\202.@|\275CD2GA\243\242\030W\333V\326G\300\225}\020\336"
+	.string	"\335\030\231!\005\207\200{5\202D\3017X\204\243\301!\240^p\b\330\006\350\206-B#i\315\332\324\345\305\310\326G\300\331>\002\236\354#"
+	.string	"\nt\223\245\336\227\314\312\251\255L\326G@\220}\004\354\330?p\032\005N\367\230\235\257\227\251H#F\322\232\351\253\244\324\301\021\220\264q\304\360\276Fj\0175Oc\324\034G\201j\200hv\366k\024g&}\337\247\016\204v5\234\004\311\372\007p\263\177`\032 \032/\030gL\262>#\344:\013>\312\036f\023\205\347\207\240\246\373$\226x\266X2]x\226\360i\262\220\\\n5\177N\264B$\236%t\202\204\232N\025.p\252\260\243\004J"
+	.ascii	"\247]\2468\242P\261\266Fg3\b\330\032]p\235\315\240\341\223\331"
+	.ascii	"T\272AM\266u\217/$\205\216)v;\203\362D;\203\362\304v\267S\230"
+	.ascii	"<\266+,\225G\024\256\320\351\232hw\200G\367HB\006\3441\305ry"
+	.ascii	"D\201\205\223\330\236\340\3402\225>f\033\344\202O\223\005\246"
+	.ascii	"\322\247=\341\347\251d\266\313\240\366\205\006H\240\004\n\024"
+	.ascii	"L06\200\204\013-\030Qx\301x\242DN\003Z\244\263\231B\373l.QX."
+	.ascii	"\205Rx*7\230X.\225)\374<\205\226)\264*\020\377#\302}\032\205"
+	.ascii	"'\222\255\363\370s\"\311T\366l`\266A.h\300\371\217\bg\033\324"
+	.ascii	"\266)F4\225M'R"
+	.string	"\331B\013\244D\321\372tx*-p\333'P\013\264\3720\225L\246\320\013\317\326y\304q\215\317\026\376#\342\371\343\036\201>"
+	.ascii	"\301e\226H!t\242\305\321\351<\016G\3409\021\302\t\0228A\202\221"
+	.ascii	"\204\026A'\236BM\245\212\326i\302mUH*\203\"p[\025:H\300m}:\230"
+	.ascii	"\340\266>9\312\347\363\005\267\365a\203\200\220@-\320\372\001"
+	.ascii	"\b'@0~\340sD\361#\2425\026}\230\312g\t\026\316\326i\002\013\347"
+	.ascii	"\316\t\022\030\201\347\303\223\t\303\362\210\374q\217@#\334'"
+	.ascii	"\263\211T\227+\t\267U\001\351:\211\256\021\270<\"\233,\270G "
+	.ascii	"g3\005\035\227Y\242\211\342\331\272-Np\217\315V\205\023H\247"
+	.ascii	"N\313T\262\360\037\021\317\b\\c;\203\362\271.\227BLf\223\311"
+	.ascii	"\256h:\177\334&\223\3559\266K\335:\205\2024\263]:\335\347\352"
+	.ascii	"\303T:\335\023:=.S\3514a|\n\271G\367D\213<\006\235p\266==B'\264"
+	.ascii	"*\234\355\263}\201\204\005n\3533d\341L\266N!\345\363\371\302"
+	.ascii	"S\211\303\376G\204\017S\t\342\004\t\264\bj\242\360\037\021>A"
+	.ascii	"H\246P\nAfOV\237F\237 \241kd\372\004\251L\237 _;\203\362\251"
+	.ascii	"[\0045\221\332\351\006\371>l\341t\237J\237\366\005c\262e\223"
+	.ascii	"\355SH?\331\037\335c\322\350\023$\202hl\335\3432\b\250E\341\023"
+	.ascii	"\004\200\244\322D\216\253d\226\020\266\356\361\005\267U\001\250"
+	.ascii	"\311lI\230 "
+	.string	"*\223\rhql\201\370\363T2\225)\260@\201O\223\205$\323\004\031\220\355\017\n\024\260\220lw\212\314\022\021\264\356S\202\240\266=\301}\036YX.\225)\310plM\230\320`\350:\217\356\211\r%Lx \302u\036\203D<M\020\300\317\003\021-\220\022E0\370lQ8\233n\263\005\246\262\350l\203\232M\026\236ms\205\347\210\246\363\230B\373\034\201|G\367H\"\251\fbO$\333d\333B\240\247D\004\316\026H\211bEsy\202hl\201\224.S\3109\002\331\223<6\227\303g\013tt\246\320\202iB\262\365\361i\262\340\303T\276pt\272\314\022\255\253t\256(\272\033\334\242\253\343np#p%p;<+ps\232\316\026>\332\335\241\240E2[g\333\323\276\200\001\022y\364\271\032L\224\310i\335#\211\026H\211\342\367\202\253T\301u6\177\2368\377\0211\"\271T\nM\320\002\035!"
+	.string	"tu~|\224+\024W4Yp\241\331\303T>[\234\370\361\210H\266-S\351\266>I\241\0236<[\240#\004V\330q\225@,~If\373\324i\177\220G\024\224B'\374G\204\217P\21269\"\271T\n\245h\223\315\026~\034\334\r&r\\\r\311\366\007yD2ap\237\255KA\321\3314\241\302\004\037\246\362\tC\213\243\323iB\353*\235\023\360\340\351\266J\241\b,[\025-\013\035T\210\340H\245\263e\266>\373!\214@\200\021H`\301\236\004\003x`"
+	.string	"\017\326\223`"
+	.string	"\036\036\003\214\300\263?\002\217\317u]\027\371;\272\313\226\004"
+	.string	"J\224`Ml\023\354\223\251<\266\320&\233Hf\273\266\313  e\005\311\226\351\243<\361Tn\027\251L\266\316 \366\271\242\271<\301\302\004.\3229\002\331\343*Sh Wy\002\213f\n\241\f\317c\013\314\246\022\351\334\320\032\235M\023\033Zc\262\004\213f\n\326u\217'\200\204\230\306\023&T"
+	.ascii	">\215\317 \0254\264@\315\037\343\t\023*\354\244\263\331D\032"
+	.ascii	"O\230P\341\367\f\362\001\266p6\335\247r\205\025\315\3453\b\324"
+	.ascii	"\272\317\026'4\270-\320\021\002-\216\313\240\2472\031t\233Ke"
+	.ascii	"\320\220\230d6QH\241\203+\024\324l.G {\366\023\206\026H\351\256"
+	.ascii	"\256\f\317#\n\037\2462\331\"[g\320\360i\374\360\204\001\331\262"
+	.ascii	"h\203O\030Z\367\270\\\331'\f2<\217n\n\241\347\217)\344t\266*"
+	.ascii	"\\\bj6\227A\241\r\356\323\350!\250mO@2[<\267\373<.\177O\343\004"
+	.ascii	"O\237\343\262G\005\272>\307e\n\356\261\271\354\371=\215\001X"
+	.ascii	"\3212\367\261\271LaE\313\0342\205R8jp\231-\220\373\024\332@\322"
+	.ascii	"\004\246R\203\253D\021|\032\001\320\002\t=\333\027|\230J\037"
+	.ascii	"\237\346r\350\376G\304\263\247M\272=\312\237\023ABM\247\017\360"
+	.ascii	"i4\272\314VE\003|\232,X\320\272%|\232K!\220\022\331\222(\266"
+	.ascii	"\356\321=a\3704\256\356\177D\034Slh\335\343R\b\271<\"\177\253"
+	.ascii	"+\264\203\204\266\353\006\t\031w\220\013M\3471\305/H\310\350"
+	.ascii	"\266>k\353\024r[\024\255S\350\371l\235&T\022H\245\3332}\216@"
+	.ascii	":.\220\320\t\337\323xt\217$\236J"
+	.string	"\026&$\225AC7\251\\\036%\220\002\013'\207d+\003\362\030\264>W4\227'\222\315\026\212O\237\3432\205\326=\272O`\373<\376\230h{\216\317\245\362\3303L\266*\224-\262}ayd\372(O\260p\342\374G\304\210\017=\305g\353\024r\217m\n\311v\231\342\310l\213\377\021\301\3029\302'H\207\205\023\030t\004B:Ug\233T\252h:\203\222-\013\347\362\250t\266\317\034\026\3552H\210D\317\362\370\003l\223J'Si\201\321Gh\031\264\343L2\225)\214\356\361i\004\022r\2722\264A\317\t\204\355\362\210\004\272\316V\005S\211t&\225@*S\t\264Y\034\201v\361\211\302\262\031\204tvx\266\255\323\247%\001tDAEP\217\006\023\224\307\035\246\022\331>\205X8\203\313\226\311<\376 \215,\204\216F\026G\240\342\263\005::{\214H\347\223\203\362\371t\006\333\240\026n\216\007"
+	.ascii	"\270BALe\207V\205\322=\252P:\333\344\007g\323E\036{\214>L\345"
+	.ascii	"\217\333l\002=\215H\347\316\221\b\344<\032\335\247S\331cd6\215"
+	.ascii	"\313#\222\003\220\363\370T&s\376#\202\202\3471\b\250\211,2\225"
+	.ascii	"Kd\233\3649\002\375|\216"
+	.string	"@\302 \321\347\bT$\372\034\201\202>G\024n\220\220\323\331\272L\245\260\351l-\340s\004b\377#\242\310|\"\215\312\240\247\260hD~\240\034\266\313 \240\3433\347\251l2\211\313V\205\261\007\031leh:\335\247\261\351<\246\300\3410\303\217\261'h\351\272\306\2366\351\341?\"V\034[\370\236\023<\221J\240#\263\005\t\016Mgk\001$\362\310\272=m\322\350v\370A\272\312 \365\271\\6\235\372\331\n-\217*V!\343\017\322U\232H2MX.\233N\235\025G\247\357\t\244t\242p\266n\013\324\324\360\037\021O\244\363\303\023\351\324\260W\034[\b\223\314c\212\344\261M\346\264>\314\343\017\322\350>\217=\306\344\262\371ct\227\307\r+\216-6\270\377\021\261l:\335\f\332d\263\205c\220\313\266\356\361\005\035\022\222\312\026\234?.KB3\210E\003\234?\356n\335\343\013H'\333\fb\321"
+	.ascii	"\244s}\266\356\321\251\222(a\302\371\203\202\331\"\3713\272="
+	.ascii	"\312\237\247\261}\036\177\202rd8\266\316\024\306c\220Kl\203Z"
+	.ascii	"\270:\021\270G'0\251\f\n>\237-\262\351\f2&\225A9\314\246\322"
+	.ascii	"e\266*Zg\220\004\026\030[\367\330&\215==\315V\206\243klq\\qd"
+	.ascii	"\n9\003\3604\nQ\270\314\026\250U\321l\301\002\240&\263M\032\221"
+	.ascii	"\314\026\317\236\240\245\261u\036W$\235\307\237"
+	.ascii	"a\373\02426\335\031~\2123\374\340\360\360|`\234\341g\303\007"
+	.ascii	"F\267\247\371\334Yqla,\256h.{\234\255\n\027d@\266?\310\241\206"
+	.ascii	"\234\025\307\026\032\204H0S(\227G\024\232\316\026>\035ttZ\037"
+	.ascii	"\346\321Y\374q\223\312\025\0358\020d\266H\342D\300l*\237B=\301"
+	.ascii	"\377\210h:[\3704\235-|\326\026H\351\0065\233,\270\255\217\363"
+	.ascii	"\350\022{\324\346\352\376G\204\263U.\203\224\356R\bh\003\n$N"
+	.ascii	"\354\264\313#\362\351\036S\250\370-\217*T(\223\317\326\371\037"
+	.ascii	"\021\314\246\362\210\301\323\210D\036U\367?\"\004\340l\227Ke"
+	.ascii	"\317\352\026\215\354\177D\270H!\247\373\374\340id\321\272B@9"
+	.ascii	"2 \233K\243\321\310:[\346\212\246\321\310>\235\355S\210i4\356"
+	.ascii	"$S)\203\321\270>\231\312\240\247\321\310.[\243\361\347\032\335"
+	.ascii	"\247r\211\363\037\021\3176\250\205K\200d\353<\376<\t0\342\351"
+	.ascii	"*S\214\020b\372\020\200\205\020S\271$@\b#\030G \201\305\2106"
+	.ascii	")\264D2\225#\234O\241\021%\270,Z\346\362\310t&\217\255\363\307"
+	.ascii	"\r2\032;\250h\235AF\343\352>\225K\243q=\272\307\244\321\270\266"
+	.ascii	"3(\237F\343*\003\262\271\324\310\326i\004\272Jf\tf\n\256\222"
+	.ascii	"\251\\\235\256\t$S(\205\344\261}\001\2114a\303\323\250\242%\201"
+	.ascii	"D\03673\205\344\261u\256\356\323\250\f:\321\323\222h\203Z\240"
+	.ascii	"0\2260q\"\330\"\231G\367\311Tn\327\350B\t\315T\232`>\221\253"
+	.ascii	"2\350\351{\032Q\370\240D\020\205\017J\374\220\037(}\377\021\361"
+	.ascii	"\024J\321\002\216\263u\237G\240\365\371l\235"
+	.string	"\311\344\221mU\034\227'\204\202\200\266\220QE\233|\n\245\330O#\211\247P\212`kl\203Z\240x\n\245\370\265A-\334\247P\n\366)\224\302\247\002\217\021\211<\256+\216/\240@\302\204\325\375\217\b\241  c\323\331\302\007\211<r\320\032_\360@\004\017F\020\n\002\022Z6\237\255\023\3704nh\215'\204\202\200\202\253\273\024z\266/0\233J\027\331\272-\t\241  \r\255\221\351\243\\\036\215D\246\217ri\002\022y\334-\222\307\366\205\243{L\376\234\317\036\343\217\217\362\307\210D\036\205m\262\211\002\263\251|*U\264N\341\362\250\302\331\272\314\022>L\3452\b\350x\002\211<\352\264H\246\013\356\363\330\262\340\232\220l\335c2\b\206\247\322\303\320\375\217\b\240\025A#\236\316V\205\322\231\264\3005\262O\237#\212\246rU\321\222h\335\343\013\302e\023\331t\233N\0238\314\246\362\351lU0K"
+	.string	"\255\310\001Za\"\331\"\231-\236L\030\332\247\020\321}:\205Nh\237B\303\026N\267\005j\227-\n\267\371\363$\321>\205rT\264I_+\264<J\300m\237==.\264\313d\211\345\321U\372(\223\0210\225@A\026G\240 \222\251\004\002\266\313\246\t\342\177D\264@Jw\004\263\t\004\324Dzx\032\335c\322\030t\036\333\026\372\307e6\201\324\026\307\244\357\351\024j\376\250\317\326\025b*\201\330g\222\331D\266O\366\251\\.\225@\353\177D\214@\366t"
+	.string	"j\335g\213'\261\250B\351\"\2179m\262\t\004|\"\225\356S\351\036\335\247Q\206\347\321-\376 ]\345\212\023\317\246\211\021Z\367\350\344 \003\262\271D:[\025M\243P\020r\330\002)Q\264\310\243S\005\037\246\022\310i\002\323\005g\273\242\031\024\201\263U\366(]f\233,\221t\036\233)\2123\374\264\320>\177\326d\353\024B\002[\367\370B;\203\022H\351\006\271\340l\227B\311\366\007\371\344\340:\235G\337\323\310T\366\264$\222\313V\231\202\207\026\350\310l\201\216\020 :\217?H\355l\223\307\366'(\204Y\264If\211\344\262U\366"
+	.ascii	"[ %\n\327yt\237\277\377T\200\323T\272G\2471\210m\221J\025mrE"
+	.ascii	"\"\217\306\244\263\211l\235\3006\331\004\322\316&\323\331\252"
+	.ascii	"h\372\354\377\210\030\361t6\237\314\366I\001\213#S\t\244aE\004"
+	.ascii	".\263}\266\316 \267\311t\217)Tx@\252X\016[\243\206\326\270\241"
+	.ascii	"E:\205\232'\234\255\333\266\3402[\247S\b\251\241\205\253D\036"
+	.ascii	"\203\216)\212\356\361\004\t\264O\241\341\323u\266K\023Ph\237"
+	.ascii	"B\033Z\237\243\017S\311t\036'\300l*\335  \241'\263\211\374\360"
+	.ascii	"T>[g\353>[\374\270\307\024*\210\255\317\321]6U,\227-r\271\024"
+	.ascii	"\352q\231BM\024\226\313\026\205\026\316\326u\217'\264Hg\263\207"
+	.ascii	"\203\212a\262\251t\266&z\202Xp\217)\224\303\247\211\2442H8\303"
+	.ascii	"\217q\305\261\005q\206\037#\316\f??H\267\311t\377#\"\251\f\332"
+	.ascii	"I\001?\215=Ie\320j\002\227\300$pR\031\344s\231\312\246\211 \241"
+	.ascii	"$S9\201\016\301\025\307\n\b\235H*\203\210Le\013\256\tIe\020N"
+	.ascii	"\253\242]\026]d\333\323\243\323&\233@F\327\331\006\261h\215\356"
+	.ascii	"R\351\032\231\315\031\224\316\346\317N\233l\266\320\302U\252"
+	.ascii	"8:UP\272\314c\021E\004L\345Q\005g\323=:\333\r/\2548\266\310Y"
+	.ascii	"\266H\244\t\255{t\022\223>8"
+	.string	"\311e\363\347\331:\177\\\343N\013\244t\201-\216\3136\031\334\320\272G\247Q\347\311l\203\200\232($\225&\334c\n\025:\314\246\322E\221B\262m{8\2548\2660\026\2013\374\030?x>\217A+\232\313\234\026\316VE\023\331:\215D\242\373l6Spp\233\304\244\363\270\302\331\354I\266m\217\321u\036\201\2369mP\013\027G\031\364a\036w\236J\026Gc\007\246\362\350\223\363\0042&\217\355\317Q\206fsit\266L\345\321\351\032\233N\344\321\003Sy\364\301\311q6\235\316\266COO\323\025B\032\221\306g\212\243\2066\250\205k\374\300\331\272Ke\217\206\031~\214L\345\f?F\026G #\220\263u\223\306\236\240\245\221\331\"\271\241M6[0\201\342\203\253\004R\262\320.}\230&t`*\217*\344\270\355\263}\301\331\372\370(\235(V4\227K\023\226M\247\313l\242\360\203d\n\035\227"
+	.string	"0\266O!\r,\216\313\326i\\qlaL\266\356\321\351\323\272L\345\006fS\351\036gP:\217-S\311\202\373\024r\376\270:*Sy\364\001\266H\346QE\362hd*\201\214\311\241+\024\344\n55\254.S\250\2114.\227-\322\330.\225=Mg\220\261\351\n\035;\270J \345\322\330.]\267\351\374q\215.\263U>\231G\247\273\363\037\021#\334\037\037\345\262G\202\247\321G\331\303l\2420l\223\315\026\234-\013%\320o\331l\236`T\223\355\323\331\252h\235\306\347\212c\013\035\327H\202\313T\n\261.\263E:\333 \2431H\271\354\371y\036\235\310\016\356+x3\250u\216p\233M\347\210\240\362\371t\352\247\261u\217\356\t\246\362\330\202\216k\374"
+	.ascii	"\204\026H\351j\023%H\244`$Q\302\304S\311\342\370K2\217@@M\024"
+	.ascii	"\220\316\237\313T6\203\334\366\271Q aB\323\331\302\207E\201\204"
+	.ascii	"\tH\344q\365\021J\321&Ug\323m\002\251M\025\316\366\251\nm\367"
+	.ascii	"\230B\005\320}\266\356\221\205\326\347\350l\203\200\216D\327"
+	.ascii	"\370\001\b.S\311\272K\023\232\316\343\t\254k\034\201\307e*\331"
+	.ascii	"\363\360\240`\001\f\020Pa#E\260h\246\220\001y\\\246\030\301T"
+	.ascii	"\036\201F"
+	.string	" \235\317\021\""
+	.ascii	"\200\002\t\023|\216@\353\377\234.E-\305\037Om\312\262d\311\251"
+	.ascii	"\303J\030\334\235\241\302\312\251\313\331\242\306\343E\262%G"
+	.ascii	"\213\211/.\246\301*@\027{m\240r\350|zLZc\200d}\244\217\375\347"
+	.ascii	"\314\005]\204UI#W$\243\363\332\033\2225\034\\p\272\017\020E\032"
+	.ascii	"\355?\347\255\270\246\370\"\3610\302\302\206\263\352\246\242"
+	.ascii	"\334\316\206f\262\326\030\271\"4\372\241\331\221eeeh%L\027\233"
+	.ascii	"\031Y\347\260\345\260y\311P\263\377\234\265\240\233\234\027i"
+	.ascii	"Tm8\244wf\254\n\025*\302\245\035r9h9h\302\245\025\206\260\244"
+	.ascii	"\330\3129\3139\023.\2550\304\201\032)~\354?'\372\034\2633N>v"
+	.ascii	"d\235C\226S\346\004\032\r\223\365q\364d\312(\031\243\326\225"
+	.ascii	"uN\224\034)U\320\262\265\337]\2524]2\265\033+\032akh\265\t\222"
+	.ascii	"\365\327\373\346e\227\265\320.\232EMX\016X\226\325\026\035Y\347"
+	.ascii	"<\3416TP\267\254s\270r\270r\274~\257\022\226\256\347xM\375\302"
+	.ascii	"D\2614y\n\244\375\347l\375\316\214\272\264d\235\303$\207IN\326"
+	.ascii	"\357\214\005f\242O\236\223\265\327\246\024\225\365\325\344`E"
+	.ascii	"\327\354\354\330\222\324\320\222\343$\247I\f/2\246d\375\343t"
+	.ascii	"\377he\3779K\200CVH^-Yo\265\325HR\004\2636)\262\203\313\325\317"
+	.ascii	"nU\003\303#\007\364'\325\342\005\225&\307*-FT\23169H\200[C7i"
+	.ascii	"\2469G\210T\266\302\326D\031\001\206II\365\370R\004\030\005G"
+	.ascii	"\033\031\021\240\2232Tjn\262\376\332\360\344\244F\325\026\031"
+	.ascii	"g4pd\235\207e\230\330h\023\004x\245(\006\251\013\032\020\341"
+	.ascii	"\034&\263\245d\372C\370\266>\021K\022\205Jh%o\275@\336)\241\032"
+	.ascii	"\024\227*T|\240\341\327\316i\215T4o\2112C\327\003\370\305\247"
+	.ascii	"C\314\225%Q\300\271 c\321\033Y\343\334\300yy^\364\262\326R1\230"
+	.ascii	"i-A\332!\214\342\003\323\003\255\214\016\341\227\257\251JI\224"
+	.ascii	"\034[5\204\270\325\310\253Kb\203C\330\004\013M\nX\216\223"
+	.string	"\020\252\313\fY\342\222s\203\310\226\271\266\306\336\034\033B\"?\220\336\256\232\330<\333\334\320\230\200mKG\270p\311Y\222c\333\204\225!\223\243\204\243\227\223 Y\262#'I\313p+\356IWN\r\240\231\036\033\273R\312\241\021$\363\"u3%\007\th\267\235\\\200\345\310\231q\226c\215\315\207\fa\016\340;\204v%\247\350E9G\327@\364\276E\357\033e\244\204'\033 \376\034\243\347\034\375\037\210\220\003c\310\334\017'90r^P\375\030r\213\372\312\352\322\222\343\202\255\321U\304\352\352\030\266q\366p\366r\206Hh{\223\363>g\b\030U\274;\323\225\006\214\232\222E9\313\372\307!\233\350\2065\346E\372\006h\304\t\330\217\027YK\2610\344\332\334\310Z\027\2755A\3451)J\247j\304\360\256\364\324M\327\217\351\221\214\206\267\224\307F\312J%\311+\312\032a\21401\200\230Q\023\244\202"
+	.string	"\031S\2624E\034Hk\\N\320\330\320"
+	.ascii	"\006\022\2253E(\262\24783E\2512QW\\\244A\264`\331\215\027Q\356"
+	.ascii	"\202gVlGE_K\244`y!C\f\023e\212\3064&\030\205\201\214\313\212"
+	.ascii	"\030-\037\\\032\023'vE9\266\216\007\230\034ap\300\250yq\225\365"
+	.ascii	"\033\021\324\036\214\254\237\340x\221\360B\351\227\004e\2104"
+	.ascii	",\214\007t\fX\024\364\253\207\264\016\347\r\347\212\021):\244"
+	.ascii	"f8h>0\245\035\255C\212\326\340Q\303\261B\302\013\245_SQ\2140"
+	.ascii	"X'C\302\013\245\337\213:\"d9\240@\341\274\341\210\341D!\341\205"
+	.ascii	"\322oF\335\016\234:\2349\234/8\\p\272\340x\301\211\303\201\303"
+	.ascii	"\331\202#\207\203\005\207\016G\013\216\033N\026\034\305y+\272"
+	.ascii	"\375\227\344\247D\016\247\f\312\023\316\233/\017\247J\325\352"
+	.ascii	"\004E\004+\004+$\253\352\215\005\372G+md`c\354t\222/iV8l8kkW"
+	.ascii	"]\f\322\375\030\302\340P)\262\241\221\306K\326\217a\016'\rg\212"
+	.ascii	"p\tS\022\222\254\037\003\025\234\263\030\310\366c\360\332\217"
+	.ascii	"!\311~\f@\366c\200\332?N\024\2341\250U\030\231\314\203\256(\324"
+	.ascii	"\323\252\363\221\365ch\332"
+	.string	"\217\341\305\276\021o\3378f\337\230\005\247\313\305\332ZU\3267F\331\307Q\034.\234\255u\013\327\033E\3538[\305#hZ~d\215\223\205\341\366\320\342\332\214Z\373F#\373\307q2\354r\303\312\242\244D\t\016\023\013\214\322\\!Iq\226\034\207I\031\256$2S\326\354\210H\305d}\343\216\375\343$\tNuY\216*\252\253\342Rq\313\017\"$8Pa\032\030PomY\343\034\301A\362\233\271\007O_R\252\025\351\323\217\254\217of\r\001\276\231\365\3071R|\265$\0255\311\332g\364%%vV\224\245\203H\320F\217\271\033<\262\306\021\342\013\301\336\336\336\236\233\367%\302\021\222q\206\340T\035G\310\213,\030\254#\2425HPK\325\225\036@\214\212g\266\210L\375(:Q\313\264\270\300\243\022\212\0216\211\251\2512\205\341V\034.\332\230\3718\003D\302\223\222FJ\207\217\315\025\265\027=\330"
+	.string	"u\024A\271E\021\311h\2611xox\020\203\020\247o]b@Mq\006\222\003\250\224\245\217\024&d\272$\006\022!\br\2149\244\252h\003\0023\025"
+	.string	"0PD\034\017\311tm\225\r\024\200\013V\302\210zT)\fZ\024DL\231\021"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\n\344\"-\030GN\f\253w\373\332:\261\260\344Z\267Q\034\2561\334"
+	.ascii	"\327/U\024\374\326\261\354\331\207\032\232\262m\206X\177\221"
+	.ascii	"\026\220@ \267\340\023\022\242\\\305m\235\005\272\216P>\300b"
+	.ascii	"\236\277j5\274\022.\217\310\304o00^Q\215\377_\231\204\334\364"
+	.ascii	"t\004\020G\335(\022\t\352\241\023\254\f&V\320TvKj\330\227\233"
+	.ascii	"\352\255\031\203v\351^'h\344\023\f4\225\274\226\020@A\237\034"
+	.ascii	".\336\312\305\237@(D\340\361\261\214\240\022\345\207\301\310"
+	.ascii	"\353\255\035Px\2641e\314_\0300\303\016\3244\026e\330q\243cZ\232"
+	.ascii	"\302\335}\220\354\373\211\021\365M\242\216\r\332\316.\345A\024"
+	.ascii	"\325@b?\256r\260\006\264\bQ\352\237\361XR'\370\332\223HC\340"
+	.ascii	"Q>,-\343\336L\254\357.\021\361j5\003C\216\310\235\344\237\005"
+	.ascii	"B\241\2676\231\207<f\327e\374\250\344\3102\345\352\025\022\377"
+	.ascii	"r\261\253\\g\240Z\322D\0265\r\204\306\324\365\266$\342\245\373"
+	.ascii	"\303\221\027\253$$\013\021\356_\371d\240\224F\024\237\252\031"
+	.ascii	"\f\353o>\277\337BV\335?d\371!s=\336\251\203\231`\375\254\206"
+	.ascii	"\231*\277\005$r\232\205\306\221rO\001\224}\007\001\314R[\031"
+	.ascii	"_e\336\033X\377)\342\337\234#\374\222\3705\366\263\223K\037\256"
+	.ascii	"\223\0049\273S\214\212\372\336\023\331\350\007|\325\201\367/"
+	.ascii	"\3504\004\3149^\267?j]\345\347\nR!\361\340\034\316\362\315\375"
+	.ascii	"\323\310\325!\210.\221\320+\357C\344AN\315cv\325\034h\032H\346"
+	.ascii	"'\327\312\005\211\276\b\336y\356\255:xML\262\246\207\210\226"
+	.ascii	"Mf\002s\334\246b&\036+\034\310Q\241\205w\322\275\267|(\021\006"
+	.ascii	"\277\357\270\253\002\344\266\311\245eXt\242\035\2232\342Z^uF"
+	.ascii	"l\331\204\013\031w\317c\260\255u"
+	.ascii	"\n\244\024(\314\334\234\363v\257s\351 \031%b\345\002?\227\311"
+	.ascii	"\336Q\242;>\n\344t\361\224\\\026\203\232\217\327XP\243\026Q\315"
+	.ascii	"*\f\f\336\374\340O\233\266T\342\0049\255\206-\330\260\035\022"
+	.ascii	"\013\352\371\227\362\013&s\360\242+\303\306\231\277"
+	.string	"\256\003?\347\320\003g)\200\322\b\300\344\377\313\030\024\3531\177\004!\227\350\301\315\027|\264\353\373\303\344;'\225*@\255e98\254H\215J\214F(F\332\372\025k\225\310\007\264\332IN\253\023,\344@\334js<\031\365 \267:Bc{\202\211\277|\243\274\357\360}\206\312\363,\276\315\371\027\343\267\333^\215R\013\242\306?\213h\356\225\035k\347xb\326gW\230\332\336Dnx\377\t\243\003\303I\223\335\024\331\304qXj\333.t{\330+\031C\264\356*R\025\177\236\233}`j\251\374e\360\354)ra\300Y\205\204\366\213\341\240q\212\340\257\376\216\330\263\221\320\034\275\246\020\236\206\324d\237w\321(\216O$\363\347\265\360!\257\205JA\b\003x\240\241\004\211\321\202\251\2735w\321g\206'\271\023\354Y\036\371\346R\264}<\375$\341\316\221D2`\027w\313\366\2045\260v\210r\313n\366\274"
+	.string	"\216$r\261\033\341\300\310\241y\366\350\236\353\230%\337%\022\016J\256m "
+	.ascii	"\360t\245\275\020\240\367\036\336\222\233\032u)&\224\364,X\023"
+	.ascii	"\t\231\314\225u1N\217\362\323\320\213OX\246\363\376~\267\271"
+	.ascii	"\034\263\237\205\241\003\030\216\2574T\324\003CQ\206\002\236"
+	.ascii	"\244\376m1(X$P\306!$.\262\034t\037P\251\b\3022\367\031jo\337"
+	.ascii	"WOY \314#\024\21290\031\303\020\201_\247\374\333Xu/\t\370^\323"
+	.ascii	"'\022\311\020B\215PU\356ji\317\301C\255\022<;E\2449I\311\317"
+	.ascii	"\240?\001\035}\203\370\346\225\260|%E*W6\211\340\026\ffDu\353"
+	.ascii	"B\003\355`Vp\250\\/\300V p;Z\214\271\261\262\327\355\305\212"
+	.ascii	"R\261\244\224\n~\223x\315\330^\326\210\234\3644\204\205\200-"
+	.ascii	"z^\313P\020I\275p\316\264C\323\373(\272b\021\202Ls\226\3344e"
+	.ascii	"\265F~\345,\020\371x\"\202n\217#5\033\247\031\007\333\013q\317"
+	.ascii	"y\026\255B\373kt\022\246\241>/\030Fm\233\036\254\250\263{\376"
+	.string	"\230\005\320\222$\311\2761[\243\247\251\226\b\367\320\315\225f\346\247Qx\223\320\224\335A\333\210$\220\031\254\244\327\2226j\211\035\335\303\326IQG\207?\024\350\036b\276\214\311o\337l*n\031K\007[\211\032\304\347\270\324\024\334j\2667\374&\377\030$\277\333\322\321\027S\"m\323U{\324\261-\212\204:t.\247\257i^\212\025\177\310\311\365\017/\r\254\372\230\235\200Am\302<D\020q\354\036t\370\026q\2374\263\313E\365\247\353\205)V\263\037v \027\357\244Q\272\232\031\005\372\316\3327\033\332\275\007R\371\266\317\331r\262\346Nj\265|z\203\363[\207aS\375SA9_\375!\252\370\235%O\241@lO\351\325Ek\b\3246t\201\323\232\205\201\3616\342\200\214M\3416\315\236\361x\r\253\006\177\315f\212\220g\2004\224H\033@kr\352JVZU#nQ\177\370\255V\305\023\022\026\211"
+	.ascii	"eP\375K\223\214~n70cG\246s\207o\255f\315\272o\026\322\345)\026"
+	.ascii	"\215\005\201\006@9r\301H\"\301\201\017\024\217\241\327\353*\323"
+	.ascii	"G\213/+]\314\226\277-\004l\263\340\\a\202\220\300\204\035V\241"
+	.ascii	"\226\277\300\251\217K/6\361_,\374\364\344\033\177O\367(\241\331"
+	.ascii	"6\237B\233Wq\254\336\210.\217\214\200\224\013;\026\327V\024\352"
+	.ascii	"<\305\021L\204\024\363(\200\246\002k[\007\001Z\300\370\036!c"
+	.ascii	")\336f\344c\013\032\307o\203R\021\202\372\375\035PS\346\263\017"
+	.ascii	"\250<\263\307\366\321O\030\201\351\300\003b\240NB\201B/Q\243"
+	.ascii	"\201\205$G\025\212s\272\214|H>\210\020p\030\352J%#%#\312\312"
+	.ascii	"\256\376\001R\312\312\2307\023\220\201\025dP\"o\005\355\206D"
+	.string	"\334\037\031\r\001\013\333\363\310\260k\216,%\210\214d\315]\2651>s\315\215\243\332\216\254\023\312\330\335\271te\202\206\256\306^\352\273\256\322\235\237\204u\230]z\266%\311[\214\240\030E\2449\206 \306\321;\263\221oR\313\345\006M\237Y\214\231p\007\233[\372^u\360\233\3354\370\254\033\211\244\217\326\017VD\333f\237\237\246\327\t(\324\003\300i\216;\025,=\303E\265>*6\263\344\301\276\363j\232@FMwc\265\312>KgP\324\275\366,\303#7\261V\nD\254\203j\217\234y\034\302\364\204\364s\211E\207\210S2\376-\201\r\355M}.Q5\\\267\370\346Pm\262#!a\242\023\bsE\026d<:\024\035\234y\201\203b\2530\323\347r\326\344\343\317\004\216\362\373@\315\365\177\273\351%\225\304T\177\002r\353\321\360\244\031\340eH\225\022\206\340\020\241\211\022\220\376\005\250\251p\372\234"
+	.string	"x\322,\005\363\272\0170@D\326#\220\024\254i]\317\353\266\312\2047Tp\003]%C_1rwn\305\260\346_C\271\314!\3049\314\353\242\213\023>\220\333 \bM\260\313\377\004\345\2520\231\003\267\350k\305\264+\205\t\371\340\215j\360\033\252\261\210\177n\216\266\336\245\f$\f\327+\321$\332d\331P\336\031\257\300\360#f\017\003\203\236\r9\224\203\327\251\222\261)\216\243\032\244\303\270\233\202\310\3166\227\227\363\374\320Q\203\002\354\355Z\231^&\211T<\371\266\nU4a\241\327\263\305\330\241\344\237\276\006\312.\304\2219t\t\240#| &\256\207\375\350 f\316V=\007R\355 \224\270\362\247\375J\007!c2\366\313~X=1x}"
+	.ascii	"\266\006#\013v\3624y\272\024\006E\033\267\224\332x\264y\326\001"
+	.ascii	"\016\317.x\366\230\034\360\366\341\335\224\220\251*\3677\356"
+	.ascii	"_V\210\202~\272\204\372\210\205[\305\314\346WaCF\310P\224\212"
+	.ascii	"dp\353\225\030\273\"(\246\254\020\335\305\232\235 \333\016\201"
+	.ascii	"\360\232\356Q\351\027\"\355\207\201(\341\002\177\263\271\232"
+	.ascii	"\b({M\310\306FUW</_mN\0270\333^s\355m\222\263m{ \303>@X\b\371"
+	.ascii	"\247\020\323\256\017\027h\272\360\360\026>\371\243\203%\270\326"
+	.ascii	"\252\t\034\343\235c\255\311;{\227'\262\032^\n\360\215\204{y\212"
+	.ascii	"\305de6_!\316\231\201\334#`\266\302\b\255k\322\252\202-RGs\363"
+	.ascii	"\3467\373\304|\262\354\030\316V\367\353\206\367s\220-\370\306"
+	.ascii	"\302\241Y\261\370~\316\261\351\276\313>\2500\032\251\372RF\336"
+	.ascii	"]'\325\340\236I|\305g\364A\376\"]\242\353\177\202\274Z5(\330"
+	.ascii	"N{\202\223(e=A\276\347\321%\307;\372\244_\232\327\030\224\217"
+	.ascii	"\016\023\360\337\216\227\217\323\337#t;\022\370\222\375Q6\200"
+	.ascii	"\202\035*\221'\n\257&\325\037\311_|\355Q\230\352\023h\"\b\261"
+	.ascii	"2\227\275\030)\031{N\341\2643\306\257O\357\204\223n\312\372V"
+	.ascii	"\322\306\303\275\242\350\022C\330\305\257\016\372\311\361\364"
+	.ascii	"\026\326zG\n\022A\025\254_\200\256\021\316>\302\331\322\324\335"
+	.ascii	"m3\241\001\252\377\347\213\313BG!\026\316\220\270\025\013\202"
+	.ascii	"\035\261P)\233\326\261\236T\277\023\275e\314\342\203l1\023n\326"
+	.ascii	"\023'p\253\001\347V\220\234\3428$#\303\277P\264]V"
+	.string	"\222\371\351Yl\256\213\007\306p$?"
+	.string	"\023\345)\353\312Pj\263\3569F\312\303f[\3058\356\245\363c\325n\242@(3\362,\264\373`q\231P\211\335\325\242lQ\330}k\220\2602\232\\\272\251\023H\2166\t\376\211br~\323X\312\313\265%:\214\031\003K[\027n\254%Q\325\201m\313\340~\027<W\216\215o\223~\004\200m\006\374\343\006\023\177K\274\002S\266\275\336\271\bq\367\277RL\326\270I\"\340{v{\301&\320\200 \315\244\251\344\001\357\232\370J\341y\271\032\b\243\255\271$BF5 \364w\226\021\240\313\261\231&\030\314d\267\0026\033@\2627\205\317"
+	.string	"'\341\003\270\367\362zAs\231O\354D\365\342\321\033\326\325\0238\006BG\007k@\367\246\220\331\267\346\242i\360\210\201N\222=\216\346\241\321(\2044\032nL\334\362\276\230\236\306\331?\034\360_\2033\356\313,\322\221gD\237\3059\354[\201\264J\251\332\300l\376V{\312\266\213r\2128"
+	.string	"\344\013\035\211\237\017\016W\230\351b\322\260h+(\2553p\330\214!e\334\332\006\034LA\325E\346Pa\367\341\354\270\023Q|\261\316\371\254\372\245\0017F\337\002\t\241\016i7Jo\252L\317\322\251\215\177\205\201\302\023tj\303\236I\350\2733\344F*\330\340h\262B\272\235\b\016\017m \364\225\033\335\340\027*\322j"
+	.string	"\245\021\211q\n`\230\367\312\235\324Xw\222~[\207\340fI\266\211\227\3318\371\202\370d\324$\007!\342_;\333\244WI0\340\351\273[\232\361<\"\362j\222\221\210L\027\360\364\302\022"
+	.string	"e\2764%\353\f\27608\210J\310\024kW\241\320\255t\252\245\233\037\302\346\250\346\351\004Vk\025\002%B\243\001\247\346\256\320F\326N\232\321_\373\276\257\030p\340\211\305\204\320\336F\206\302\3020\355\274\260\376T\200\301\273\016\204\030I\033\256\241~\265s\302\310\311\n\247L$\303\372a)\213\016\306\3123\372\233\311\034\3711\221#-\340)\237\270e\022|\320\rK\222\221\303\331\215\362J\266\323=zD\\\340Y\314\266~8\2164\267\2773\340\\\3374$!\350(\025/\250\024\f\307O\364\212\240\263"
+	.string	"\241=\2270"
+	.string	"\036X$\030\322\210\334O/\206\216\031\312\277k\202\201\313\265\3620\314\373"
+	.ascii	"?m<5_\325;+\332\260\240\241#8Acp\252\377\3016\276\216\311\254"
+	.ascii	"\bL\312L\200pf\245\013A@2-N\023r\303\214h]]Nxn^y\006r\035\031"
+	.ascii	"\270i\264\266\301\264\232\022\207\214\023\034\221.=\"\300m{\001"
+	.ascii	"c*\020\002\\\326*\201\231\"\030\334f\"*\016\365\025\324\017\211"
+	.ascii	"\354\203\225J\242\036lM\037\272\027q\270\031e(\302\355\025\253"
+	.ascii	"\026\tv\230\330\007\243\021p\327\374\271\276\313\222\004\365"
+	.ascii	"\251y!\274\224\200\3661\274Y\265fu\375\024\323\t\325s\033\264"
+	.ascii	"\274N\364\321\"i\213\202\247\374-O\241\"\242O\230P\007%\304\212"
+	.ascii	"p\322L5\263,D\247r:\275\"\374#2\341sL\242S\216\031\250\210\253"
+	.ascii	"\324\373\234-i\335\233i\337q9\226\375+\007\231<\027\021\363\252"
+	.ascii	"2\030p\241\024\006\340\001\016@ZI+b\376\256}\224\207\221\373"
+	.ascii	"\353\0060\021\277:#\034\372#\211\232\213\213\340\334l\210%\017"
+	.ascii	"\313>.\357\037\367\255\357"
+	.string	"1\f\327G\314\337\n\007g\262\334\371\317\315\217\323\331b\211\324i\370q\367\255\363\244\223\316\255\246\363\327UB!$\304\230\232o\215\236\341`\020\320@\253\256\310\365\224\315\363J9s\344X\327\210\271d\342!\367{\253e\220<\022\321\322\317\2638\177V3\320\036\246\324u\214\241X\213\245\t\224\314[2>l\245#\f\303h\013\256z\n\220\351\224JY\211\342\007\267\270\320;<\022\330\340\311\351<\344R\324\225\262Z\276z\300r\210\242\003~'\336\376oe\002\316s\024\366\236\2665\002\032\244\362\253F\003\f\352\357\253\263\334\271H\221\216o\265\364\224\334\030\b\375\002!]\342\007\231\242*\256<\376\255\262\271\354\253\272\335\312\236\025\310\263vL(\326N\034-\004\305\030\346\207Z\347_XfV\312\342\266\017\255\206p\305O\254x%\237\354\243{\fNt\322\215\201\370\207\2201\312\016pq\344\242\201\242\177z$"
+	.string	"\r~\266z\337ixW\270\236P\304\310\002\303\235R\036yD\2221U\fa\230|)\006;\231\373\267\314\315\332\305\265>+\333y\341\2053\237H+\354"
+	.ascii	"\307\255\002\343+\210\317\220r!j\243\3600Q\204\331Vz\337\321"
+	.ascii	"\357\271\306\276x\217]\030\026\213J\023\255\234l\345g\243\353"
+	.ascii	"\316_\337"
+	.string	"\211]\323\342\300%9\256\205\373K\335\001\272\034\233\013zC\257\263\361O\r\301\002{G\021#f\031\247\240T\321\033\035\236%\256\024\267\334\245\223<9\342\214\317\260\322\206\031E\221\321\344B\310\301e\004\352#\247|\f\350\037\361\021\355\021>\205\t\314\304\360<\226\033\024\335>m\230\273\034<{\266\351X\213\316X\205\230\0203\024\263x8\370\332\200\26367N\246\024uz\356\037\306\353y\373E\340\340K\032l$G?\254\025\007=\215\331\241!s\244\003X[\325\325\374\304<fq\"fd\270\037}\022\3447\310\220T\263\211KO\006\311}\003\341v\264\306\375\341f\2264\207%\312\204\330\243S5\330\330\025\373)\302\243\233#\217\3337:\310\331x\026\017(G\333RA/\331\200\024\243\212\201#\267\241z\361\260\306\321\2361K\373\277\024G\271iH\234v!\270\006\021\177\226\273\363\264#\026J\367\270\340\020"
+	.ascii	"A\302^\317\345*jKd\235\304J1\260\344\027\255\244S\277\317\022"
+	.ascii	"\200\023,\344\374\033X\314s\263BC\227-\3413a\007\237\306\201"
+	.ascii	"\301`I\313\002\026$\023\370\235\376\212\306\260F5}\212\273;\001"
+	.ascii	"R\333\235\327\215f\001\212\277\244\342\212\244\027_\265\ta\177"
+	.ascii	"X(\266\307\344\f\204\314\311\301\213\335@\032\300&\336\367\373"
+	.ascii	"\371T\266l\313\221:}\237\323\005\247\020m\037G\243\234\214\211"
+	.ascii	"\344L\206\250\340\241\261B\337+q\b\360k\235s\353G\321\3762\275"
+	.ascii	"\272\021\316\303(\t\022\261\374\371\004\363\346?\315yO\354\034"
+	.ascii	"\326\301\353\240\226d(M\335nW=V(!\rH\225\337k\f\267\322\347<"
+	.ascii	"\377\306\221=9\207\301J\223'g:2\006\271\036\316\276\245W\267"
+	.ascii	"\251RRT\301\277\b\360C\007\002\201`\236\242\357\203\333P O\261"
+	.ascii	"\2331\020E]H7\242\234\227\f\r\204\325\361\017T\025\211\315\033"
+	.ascii	"\031\315[R!\364\243\341\346\275\250A\200\220\312\325\252\\h`"
+	.ascii	"\365\224\313\252\361}tAX\237\276\205\224\377\222?p\374\b\322"
+	.ascii	"\020\232P\304\374\226o\367\307\234j\257W\356\310\334\027\311"
+	.ascii	"\224\276\ra\203aY\3031m\3144\300w\337tY|\t\310\216q\300\256\216"
+	.ascii	"X\274u\244Ar\350y\275\323\355\352\367\003\323\265\3734\314\243"
+	.ascii	"\031\022omU\306\3551j}\345(\016\225&{\366\003\f\003\252g?\362"
+	.ascii	"\264\342\240\0036\301\301I\317\236\203M5\213#\005\206\315\021"
+	.ascii	"b^8\277\324F\323\374L\024\235\272\256\366=\177\204\250\377\350"
+	.ascii	"Km\374\035\202\346\376a30i\032\262QV\334\301qzgP\026w\216B\335"
+	.ascii	"-\352\305^hR;I\305'=\326\327\316\276\320\214bZE\023\226\354B"
+	.ascii	"5\224_H\245\350\346\320^k\326\321\033Mj\027o\310\234\202\232"
+	.ascii	"\033\306"
+	.string	"\370\177-K\357,\236\301\365\302h\303J\377\006\310\370L\252o\255b\267\007\017\334\222O'\322\345\224\211\034\226\320:d\177j\237\230\207P\230;Da\275\246\230$3Q\336\207\363\366Z\305\360\272\034^\001\312i\220\2324\237B\226\237\226H\364u\306Ot\213\221@\257\202\267\210M:\275\r\370\343\245F~\f\nj\217\312\242f\3247\356T\354\215\031*\352[N5@\304\017\016c\247$l\0358&\2142\242\327W\316\243qx7\037%\327Q\212$\344\226\237.\313\214N\3166RJ0\321\211M\220\216\337H\267\r\271\262\301\232\333R\212!\336>)\246\\\2260\334\233\276ay\324\245I\f\212M\261P\033\357\"\250]\313qKC\022z\373\244#b*<G\373\202\245\n\365\034\226\324\264\027\3278\022\345\340\205hR\0325wG\"\244\006R\027VD|>\335\f\304\025\320$"
+	.string	"[\363\201^d$\232E\317\210\222J\324\247\016W]\354\352a\270H\257\241.\300z'\005\205\275\252\262\025\314:4\036\325\361\265\331%4e\251A\363\377\221\253X\361\365\241zn\025\360j\305a\240\006\265\242\247D\\8\310\305\366\257f\341\364\356 \024\265XF`\\.J\023\230\007\355\335\213\257\251\022C\005\362\260\356\203J\025\372\274\235\006\373\253{\3135<VT\3527!!\267\325\335\23756\033\004\274\"\347\364\232\320\343\255\030\236\260-\030K\\\216\233\221\214*\035\216\027~\375:\223\210\300\227\313e\316X\206\303?;8\3412A\236\335yrJ\343\257(/F\"i\352\213\373\371\t\251>\026\213/\330\016\206x\006%\006\335\303\250\213\3117\024\322\253 \353P\334\273n\254;a\r\027\254\036e\231\n_\221vdM~x\r\225\f,\034 "
+	.string	" \341\036\252p\320\242\346\"\213@\210\234L\323\243\321\374\022p\350\020\355\210,\243\244\244\\\223\314\177\3543\213\200\0245\234\306yC\306@(\304X_\217\027\242\242\034\353d\b\330i\205\344\013h\375\356\343\342\3761<nW\272\326\367\361G\317\354F\363\225\312b\376\020\\G\3171C,\210\235\223u\250\355\225\314e$\360\204\275\260\203\200T(I\200\204$\3779\275\377\235\026\241]\023^\241\024\020\224(c\313@8m\376!\016\223\3502y"
+	.string	"\t\347W\204\270e\361\023\224\221J\227\231\233j\237\005\203\016t\371\241\262\315u\020[\355\224u\244R\037\210\t\006\366\371\356\242\362\275\306/\376\233\366\327\211\003\313\335H(\274\003Q1\266\331\212&\177s\0277m\307\030WC\nN\022\263qA'\340\002\026\274\243\200\004\007\261"
+	.ascii	"l\321\001\202\001\210\224\255\320&ZA;\314\371|n?\033\3777\343"
+	.ascii	"3a\244\020\205v\203\026\336\017W6A\200\362\250A\225\277G@N\327"
+	.ascii	"\307N\354\222\356\265cwX#\251\005\334\333\317\340\0258\r\217"
+	.ascii	"\357\370W\311\274\207\312.\250\367\226\323O\341K2\307\001\363"
+	.ascii	"e\300\343\350\347?\312\365z\206\276SV\333\\\355\\\243+e\n\274"
+	.ascii	"\236\362\307y\220\226\307&\214~\225\314\224\020\344\367\321\031"
+	.ascii	"\204\001\327\254\t\363\006\272\241\344\374d\306\312\336\273N"
+	.ascii	"\270\035\004\201\362\236Y.\033\315?\355\022+\013\314\203<\030"
+	.ascii	"\375\235C\357\025P\005\260d\324+\304\227\321\216\311\005\007"
+	.ascii	"S\346I\211\004\347\336P\242GV\230L\203k\2022}\210)\307\256r\311"
+	.ascii	"\3631\034\313\033\007\302\031\\\313\310\023\241\242\336\tl\375"
+	.ascii	"\331M\021x`\021\255!\331rY"
+	.string	"\215\016\237zd=\024\004\311p\201\317,\325\360)\334\376\241\217\003O\372\t<b\024&\241H\035\360\037:\022b\036\27628\244R\272\316x\214\332\237\210LD\225\273\224\306\351\354!l\243Kc5\201\312\324\036\360\336P7^\3201\026\226\235\002\272p\334]\035\024X\350_\231/\t\376\314\244k\302Hb\f\f\016\307\t\37566\250\242\252\266\300l\240a\031\t\250 \321\251\327eT\0025\321\372\246^\203\321\306\002\037\020\f\361\253\350\f\\\200\230b\366\302\030x\364\370c\020JMA\247zn\225H\036*Qb\372p\227\017G]\373!2\207\330\262d\177\306Iq\210\246\022\004\251\230QB\361X\006\352\300\253\342\207\b?!\033\361\351Z\276\356\325\023%\276\272\350y\215W%\212\001c\fn\034\265\035\274\346%\221'\302\203\323\003==\203\r\326\305\214\271\242\306\347\206\r#c\246?\t\246\\I\242'\352"
+	.string	"\256\b\314F\326bS\216["
+	.string	"\230\360\244\360G,\001-\021\312\214\315\254r==\315B51\\\322\201\303v|\037r\231\350\346\003\206\304\022\277\024P\344\233\3271\313\345\311\026]M$*\253#J\217\261Dz\247\233\006%\2047dX\311t\376"
+	.string	"=y\352h\300\003\242\0364~\322#\b0J\001W\030\360\326\225\321\274O\270\270\025\356\350\275\206"
+	.string	"I\301\366\221\214Ut+\270\334 \266\f}"
+	.string	"\337\301BJ w}\310\215\020\200\346\373\201\253U\313\223\344W\027X\251\030/UH\224\261MV\356\336n\255\\\247\356)\207]\020\260R\305\210\020\355\0174|TW?\350\264-\032Qc\034q\2013\237=\344\350\346+\350K!y\364\322vZ\037v\335J\234\262\371\241\300&\227\210)x\302b\230P\260\365K\360\307\307\360\020\254r\255\277[\272\340k7Y\325KxK\336\220\006"
+	.ascii	"\240HA@\247\370\253\345\251\b\025\230W9PcQ\223\315\364\004\003"
+	.ascii	"\030\027n\034\3452*\304uuI\212\271\341D\027\204\027\030\234\324"
+	.ascii	"\250\0319O\273\354j>\3520\212\341\373I\034;y\266w\020\006\271"
+	.ascii	"4*.a\250\211\356X\303T\236x\003\303h$\031F\331\243\263y\024\032"
+	.ascii	"\313\032\203\236\253\355\254_\001?+\221M\371.M\236\231\342\f"
+	.ascii	"\317b\231s\206\0263&\276@\313\026\2052\264\007\210\022\333\320"
+	.ascii	"\222Xwe\332$-\373\276\302,\211\266ph\007?0\026V\270\255\027%"
+	.ascii	".\030\004\252f\250\323\234j%E\203\213&,\254\0221|\334\310\276"
+	.ascii	"[\262\227\370#w\277\343\232n\310{I\301\354<\006\003\004\016Z"
+	.ascii	"\013\225\0272\021\035\3609T\307\245a Z\346\316\354\376\250n\205"
+	.ascii	"\333 \275\357\375\007kb\030\243T\206\320\367\t\002g\240\002\355"
+	.ascii	"\273+\037\272\362\377mb\214\027mm\023\216H\354\022"
+	.string	"\236\bl\250\263T\301.P*\tV\221\263\267um\224\364\303 \231 b\324\352\005:2\257\314\330\216 )\016\300\306O\232fC\302x}\275\210N\224\330\351w\233x\034\216C\220\2170X\027\036\256\274\2047g\232\327.\0359v\020e\332\003\321\2770\272\323\222\246\354j\235Y$\334q\217\373=y\235\203\"I\0020\035\244\371M\315/D`$\362\0051\314\265[\265\347\006}\200\356\267\217\016\301yK\304\003\241\345\250UT\253\006\357\030\3306\004\"J\247\277\323\244D#\035\340\314eb\306\033\312\035\004\007\363&<\227\211\0302\305\024K\340\223\235o\226\261r\356|\206<\303x\232w\357\360\035<\200yw\344fa\001\013\333\034JR\305o\326\361q\373>W\210Ig\254&3\001\363MG6'\017\324 \033LgO\233\377\300\352a3\321\256\206\226\262[\254\306\333y\361\027+\"\232\031\274\250\004\234"
+	.ascii	"\003\366\233\321UTX\356z\225\203\276\317Ff\f\212\206\232\371"
+	.ascii	"\350\235:\255\324Gh\211\345\230\311\260\333(l\"\335_"
+	.ascii	"(/S\266\261yU\002\227k\001r\207f\216\272y\267\305\315a\374\\"
+	.ascii	"\024\376\220:\tt\213k\f\203\207\306S_@*\202z\300W\251\362}\304"
+	.ascii	"7\322\353\267\374U\034\241O\016\213\235]\303\005?\023g\346\327"
+	.ascii	"\316\013\222e\374\304\001\036\356\252Ff\2253\240\311`=\017\347"
+	.ascii	"h\223*"
+	.string	"s<Y\203SII\360\244o\310\253\330\332\246\211?\3759\240\255\236I\236:i`Q\327\351\375\364p\244\262\356\360L\342\231`\366C\261?\3201R4\b;\254\362D\336\034\204h\245\267\317\231V\355B\3258\030\364\334\253\257cK)7\322\331\030\026\034\322\341\320{K4&\312\232\272.Z\031\344\3113?\326\353\253 \205\276\023\032w)@\347\366Z8\340zz!J\f0u\353\035\262\251YB\243\rh\377R\205\2560\224\210e\231k\200=N\350\270\315\340\261\374D\016\b\360\225{\352\365\215\035Ue\316zzI\f\346`\005\267\032\025=\344\306j\345\214\313\311\203\210\177\030\351?W`\217G\017\211\006\017\rCP~\036\366pAAl\241<\263\224\257i\323v\345\004\2326\016\nXqH\331\026\207\265;\334\022\203\"\3177o\216K\246\347x\370}}\3738{\323y\r\033\321~-\243[3\342\236"
+	.string	"\302\020=/\016\r5\030\030\237\321v\333\216\001d\347\006\t\002\304Y& J\272\307\314\306\274\224f,j\030.\366\241\215*w4#\245\236\312p\005d\230+ \"\227\254\233.\224i\365\242B3\356%r-\256TnE\356>P0\240\225I(\301\200%\031d]z\372N\362?\304J\326\227\"\351\r\345v\372\307P\306\314K\304#m\377n\226C\226t\223\330\255\243J\023\t\207\243\240$W\211\027!\"\365J\275e\346\323\223L[\034\223\327Xi\030+U\241\306\276\371\021\031\024\336\327O\342\201\244f\262B\312\376\3651<\254N!\340\020\377\316\331\347\201`'\215\n\222\332"
+	.string	"\241\032\223\275\365\3510J=?\250"
+	.string	"\3129\232\264\350\266\007;\304l\005\312\236\270CD\004\226~+`\270\\\246_\272\316\221\030'\221\027:H\330Qa\366\226\323\203\024\362\300B\317\217\354fK\314n\273qG\365c\\lG\274\307\301\f\275y\361\261/IQa\341\333\350\276\303,\270\223C'3\236\255\260\301\310&\212\270\023\226\001.\231\235\r7\213\305\367fjs"
+	.string	"\217\030\327\321Y\t\206\216\270\037\254\031\222\370\203\035@R&v\222\211\340\320`,\266\373 \003\tu*2E\b\261\362\271\to\216\366i\274y\264\212~\213\343\265\206a\020\206> \351\260\373\332\212\021\242Q\001\235\034g,\032%\305jP>\307K+s\250<\340\026V"
+	.ascii	"\023\333\0250\356]Z\341d\250T\237\361\272\326\020\203b\2235\236"
+	.ascii	"\362^\307\316\356\030`\035\332\223N\277\3377y\255\352w\2766m"
+	.ascii	"\202\343$\357\244\020\350)F\202g\271\275\350`\264\267YC\016\\"
+	.ascii	"\360\321%}i\202\357\330\305\024\273\316\215\3369\017p\034d\033"
+	.ascii	"\211\234\313\022F24\372\364\003\314 \3334\224t\325<\222>\361"
+	.ascii	"L<\347\377\016{~\b\230\336\3765X\251"
+	.string	"\240\226\347\372\246\016\206\302\220_\320\233\364\227c\247\234z\267\202d#\212E\013#d\312\266D\320\346q\232!\272\3124&\323n\266\t\205S\2114\037wA\336\340#\276\326\277\262\032\271\333.RpN\bT\200\336\324f\254\210[\357\020\207\020\236\351\2353\2274\031\306\013\036\r\177\217\251f\331%\363\177*S\2742Q\364\303\306\353\364\300\034-\300\032\025\275*1\264\344\265\366\207\025>\377\343\313\324\341&\262\332\253]]\372\256\217\304\350\007\003\020\264\250\026\001E\226kU\223=\371\356\274\237\214G\277r\200\372\207\nud\247\257{\365[\r\231s\353\206*}3\031\351{\270\234\265($D\322/hD\005]v<d\001\301\370NA\260?L(\306O%\232\246:6\030\356\332O2l3\n\363\344\351a\366J\272\352\031I\033\353FAd\244h\232hN\244\033\\\177\\H\023\031G\002\344D}\025}\264"
+	.string	"\377]\023\3245\206\001C\237]$D\313\360\377\3507\364D\306\370\245\002O\322\021\272Q\020lD\2011\f!\036BR\tc\007j\005\343\372\274r\242j\n\237\264%\360\311,\004\205\245\213\370\360\363\006'\027\246\364\003\377Rh"
+	.string	"\311\004\244\022\fq\207Bq\020\307T\013\250\257\022K\222\277p\t9m\324\300o\375\002\244bX\344\256W\t\233Z}\255\004\372\216\223\233\220X\002\250\256\bf\265s@\257s\221#\262.h\250\332\224\375/w\340\2372\253\263\371\275L\213\215\273\312\204\265\001H\3279\217\221c\030"
+	.string	"\325\024|\355\231`\302U\024\350\3410JBr:\300\007\243T\227\313\264\355\272\332\006B\316\025\267\321\021\340\270\251A`g\3503\323\357"
+	.string	"\304\240ZQ\325\213h\207\200\262\202\037\032,w\352c\217\333\352\232j\213o3\001\250i\211q\354L\212\013&;\261j3\350\225\235G\210\265\220f#"
+	.string	"\3118I\373\220\355\003w\303\364i\3722\275qn\334\2749:\264{\030L$"
+	.ascii	"\266\2272K\375Y\0017\304\213\314\2433\360\272\323%\254\027Qg"
+	.ascii	"L\\\250S\360\204H,\017\317\253\243@M\304\325s\273B\255X>\321"
+	.ascii	"\300V\310\227\023v\272\347\323\377\005\271\207\201\006\321p\023"
+	.ascii	"\320&\376\3672J\320\362\b2\034\260\223\213N\n]\fi\212p2\0378"
+	.ascii	"\346e!V\360\207h\307bv\226\216\204\030BN\306\261\356\036\036"
+	.ascii	"\326\035\252\276\0249I\330$\2457\2413d\244@\313Hb\320\354\353"
+	.ascii	"]\263\264\243\273\234\231\257\306\231\017\240\200\347\265\202"
+	.ascii	">v\310\335\210\316#\274G|u\255\225\032\313\217\365v\313\313\\"
+	.ascii	"\204AQ\334"
+	.string	"\352\254\301!\344jx\345j\017/(\331\035]\001\334I\266\207\213\361\302|\366\\\027n\031J\215\f\212\226v\314\356\004\240-_@(!\016U\313t\b\017<\356\237\301\235\327/\rQ\217\023\206tZ/^\005\225\007BV\004W?\237%\005 \bxI$6\300\353n\347\276z-o\303\272t\333H\363r\233\"\023\\\350%\0051B\355A\255P[EZP\331l\004\312&{\355\313*\271P\206\020\324\r\351\231\346o\277\200\355X\021^\365\263\330z\257\004@H\357\330~o\202\2704\271~O\017\333\235m`1\361P^/\207\236\237|\032\001\2458\\\221\035i\222\244\304\277n\2736\330\347\313\324\366i\207=\234\231S4\003}\224go\371\356P\376\237\334\247\365N\204\306\252\313\004\300\242!\202~#o\362'V\301\2142\242\364A\332*\337A\316\216\223\346g\302{\230\205\311i\246Ty`\317\n\343"
+	.string	"Y\2662\261\265<\352\236\316\254G?\026\020gU+\362s\240\007W\346\311\314\027\216\007\350\274,\0341=u\230\177=*-R\306n5\267\267x\031\021p\317\211c6\211\230\r\303}8\330O\202\204\325\260\364\324\0057\016\035>\034\354\036\316\224\217\322"
+	.ascii	"\202^^\001\322\242\202O\340\344\033\347\366\021e7\020\360\022"
+	.ascii	"h\033\204S\227ln\256F\347F\335;\312\305\27399\306\256\374>\026"
+	.ascii	"-\326Z\353\270\204\331\340\313\255k\321\221|\372:6\227q\330\377"
+	.ascii	"\021.\340\300\273\273VF3\371\f\314\244\362\351\203\314X\254\377"
+	.ascii	"\3265\321#\3475\365\370\207[<\212\317R\334"
+	.ascii	"\037}>\315\207E\320\253\255\257\302\236\350\377\212q\r\177`\035"
+	.ascii	"\023\343\034}DN5g\301\237\311\327i\332\361\205\314\377 zn\242"
+	.ascii	"\022\3235\361]\350\2751m{\325\243\003#\264\375\r\200\346\177"
+	.ascii	"yf:~\205\356\323\256\334\341f\322h\177+\314\360\236\036Z6t\321"
+	.ascii	"\205\233\344\356\342K\350\030F\037j\314\nv\373W\373\362\374Y"
+	.string	"\021\033@\237\007\320\327(\316K\377\254\t\226i0\037\006\314\022\315\277\003\342\255:\263h\356\210\256\376\310\324\237\234\334\341\266\307\205x\266o\037\233ti\206?ii`\315F\275\031\201\037\205\230\216\321_\264\367Sl\326O\f\\\315\261\237\031\365q\321\226`|\213\331\032I\032o\035\300wF\314\257\305\334^\313\022`\\>\371aOw\361\347F\3707\270\317/\307\340\026w\275\234\020V\020f\026J>\347\362>\346t\356\264=Ap\206\370|\376D\333\326\222~7\276\200u\030.\271BB\231\227\374\227\23122\302\201\276 \250\033^\335\233.b\341\223\277\226&|p,\256a\351\022\206\237o\227m8\262\233\262\205\231x\350=\177%\001N\331\305\207\360y\324v\233\035/IL1\036.\321\034V\230\355\036\003\233\256\267I[\356\317\302?,\265\237M\270\030|\037\206/\374=X]Y\371\234V\317\344\361\005"
+	.ascii	"\272\030s\206\304>J\313\366\377\301I\373\341\376L\313\237p\353"
+	.ascii	"\263j8\324s\" \353\254\375T\367a\372v\217\234\215\212\253\244"
+	.ascii	"a\346\f\314~\373aN\365\027\030\003f\2466\307|\357\327\r\n\315"
+	.ascii	"\016\2763uz\035\343q\002\032\342\306z\234\362\310\207u\034\267"
+	.ascii	"\026\234\333\240\373\375a\022=>c\377r\237\223\217e\017o\241\313"
+	.ascii	"\332\007}\363\360\356\2176\245-\330\353\256\240z\374.\251\226"
+	.ascii	"\366e\324\360\330\270Na\244+[\263df\332\033\270V\334\374\210"
+	.ascii	"\222\307\341\350u\024yY;E\0072b=\343}\221=.\364\277N\246<\246"
+	.ascii	"7K\203_-\347\b\252;\330x\200+\036\364\276S\007\201\253\233\376"
+	.ascii	"\351\202E%\353E\246N\272\275#M\177w\373\232e\233\013`g\355Cu"
+	.ascii	">\025F\317\267b\312\346\311\033\274i\304\t\246\366\231\340\357"
+	.ascii	"\250+\b6P#\237E\346o\215\307T\230y\327\270|-\304+9\246"
+	.string	"\257/\367\350x\217\212dFb4F\352\006\274g\273\343\034\250\277\266_\002qr\331\327(g\213\374\332`\267\327\364\t7\365\237\212\323oN\355\206\377Q\301\331t\276K\252\033\302\177e\340Z\304oi\234\357\307\247r\255\017\241\262\377\212\223El\310S+\341/\310\244\007\275\216\t\346en\377\370J\357\250\366!\331\246\215\032\304m\377\313`\343\3536.H\372\223\337\007\340O]\360(\213\256\322V>\232\210\377R=\217p\363Q3\216\341\227\244\302M(<\016\214L\263\317P\274\227\252_e\212\207\357\001M;\301\234\035\214\024\236\0174\002G^\205\367(\364\224;\335\031\2249\314\341=^L\323K\270\254\r3\037\030\334\310d\033\363]\350\207\257\333\211)\206\275\207\024;\2301\240\272\263\346\316\303\230W\257\315\365+,\366\375\002\343l*\034\210\2337bK\177\314<k_k\357\3430\025\340;\255\017:\276"
+	.ascii	":\337\320,n\362\354\247c\253\312\336\002\367Z$g:R+\207x:7\254"
+	.ascii	"\177\254\027+\330\r\313\261g\361\017\"][43\312\267\t\221s<\357"
+	.ascii	"=>=\300\\\367W\240\263\252}i\325\013\370/\211\036\344\357Df$"
+	.ascii	"\350\211>\003(\370)\330\335\0362\332&p?\363\323\253\353\247]"
+	.ascii	"z\320Y\273\345\353\276\210\343\253r4\367\203\001\354v\t/\033"
+	.ascii	"lV\364\261o\331`\375\300~P\237\347\336\377t\213\272\330\017\330"
+	.ascii	"\313\360\360=<K\301\205\322}\304\261\017\001\260\336\270J\321"
+	.ascii	"\203\242\303\272\016\237X\265a\032b0\370c\222\222O\240\3551\372"
+	.ascii	"P3\257\210>Rh\033\333\360j{\316\346\217\001\036\221\335%\376"
+	.ascii	"O\024-2\346/\340\370\336\314\205(\227\310w\304\345\375$$\375"
+	.ascii	"\f\346pD\333>\377\200S\357\r^C\257\245\347\201\377\275\312G\231"
+	.ascii	"5\273\021\376\001"
+	.text
+	.section	.gnu.lto_.symtab.9f5c58040b7511eb,"e",@progbits
+	.string	"blackboxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\005"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\006"
+	.string	""
+	.string	"blackboxValidateConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\006"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\006"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\006"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\006"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\006"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\006"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\006"
+	.string	""
+	.string	"pgResetTemplate_blackboxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\006"
+	.string	""
+	.string	"blackboxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\007"
+	.string	""
+	.string	"blackboxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\007"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\005"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\005"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\005"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\005"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\006"
+	.string	""
+	.string	"motorOutputLow"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\006"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\006"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\006"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\006"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\006"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\006"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\006"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\005"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\006"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\006"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\006"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\006"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\006"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\006"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\006"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\006"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\006"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\006"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\006"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\006"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\006"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\006"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\006"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\005"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\006"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\006"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\006"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\006"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\006"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\006"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\006"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\006"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\006"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\006"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\007"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\007"
+	.string	""
+	.string	"isRssiConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \007"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\007"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\007"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\007"
+	.string	""
+	.string	"blackboxPrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\007"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\007"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\007"
+	.string	""
+	.string	"rcSmoothingGetValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\007"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\007"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\007"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\007"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\007"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\007"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\007"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\007"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\007"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\007"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\007"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\007"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\007"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\007"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\007"
+	.string	""
+	.string	"mixerGetLoggingThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\007"
+	.string	""
+	.string	"pidGetPreviousSetpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\007"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\007"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\007"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\007"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\007"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\007"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\007"
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\007"
+	.string	""
+	.string	"loopOverrunCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\007"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\007"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\007"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\007"
+	.string	""
+	.string	"loopOverrunGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\007"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\007"
+	.string	""
+	.string	"blackboxDeviceBufferFillPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\007"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\007"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\007"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\007"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\007"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\007"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\007"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\007"
+	.string	""
+	.string	"blackboxOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\007"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9f5c58040b7511eb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
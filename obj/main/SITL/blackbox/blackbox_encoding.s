@@ -0,0 +1,992 @@
+	.file	"blackbox_encoding.c"
+	.section	.gnu.lto_.profile.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`w"
+	.string	"\255\004"
+	.string	"\364\007k\001"
+	.string	"\017"
+	.string	"\342\203\351\365\f"
+	.string	"\001\357\350\332\204\n\002\002"
+	.string	"\002"
+	.string	"\002\346\371\265\305\006\006\002\001"
+	.string	"\002"
+	.string	"\004\363\323\275\211\n"
+	.string	"\005\216\243\313\354\001\002\006\252\212\212\215\003"
+	.string	"\007\242\247\237\212\013\002\b\213\215\316\230\r\002\002\003\002\003\t\353\206\240\252\016"
+	.string	"\n\340\253\276\213\016*\002\013\245\277\256\207\b.\002\f\311\305\223\252\f\026\002\r\253\356\273\246\004\004\002\016\324\230\357\263\006"
+	.string	"\017\274\320\320\213\f"
+	.string	""
+	.string	"\b"
+	.string	" \343"
+	.string	"\223#\230\270"
+	.ascii	"f\004\246\342\354\"\227]\001\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\325\003"
+	.string	"r\004\f\023\240)\035\377sUUU\240\265\362\255\355I\333\335dJ\001\212\034+-\3571\006,\376%\036\004g\374`5\224Ln\264\257\237\326\325R\347q%\" \260\0029\322\035.\002\2563\027\212s\3166\220\007\324b.\231,\247\217m\242 \234A\"\b$\\1\272\262\357\254\200\031\343l*\236\002\016;\233"
+	.ascii	"-\317\347i\270\031\3139\274-W\326\343\037v\204\233\274\274\026"
+	.ascii	"\206"
+	.text
+	.section	.gnu.lto_.inline.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`\016\006\r\025"
+	.string	"\326\335fD\360\224\223\016XK\342\033J\234k\336\201<\bw\325\177\226#\037fp\356\203\327\037\234C+\204\272>/(G\363\347\276\305\366\207\365\177\274\353*\0239\360\f\\\360\177\230\275\023\360\244Ed\307\336\275\333\226I\246J"
+	.string	"X"
+	.string	"X"
+	.string	"\351\"2(Gw\211K=&\326\325\210/\347p0\344\030\265D\325sv7@\312\323\231i\332%\316N?\333$\230N\027\275\261\273YJ\272\304\245\355\321\355\243\276\273\013\355\b\273\313\262o\033\364\314t6\320\021\273\013\262I\016=/2]$\274\003\177s\005\035o ^\302\255\372\223+\b\017\343\020\213\006GOv\036\371\244\273\273\201dz\313\303\353\210\276\202\264Nd=,#\026\362F\245\031x\324\254H\0206yWQ\314\324'\277L)\207\216\006,\203/\212C\"\326\002\305!\316\360\371\371\fR\375\002;\352\377\300\277\b\256\343\346\307\347\345*\370\016\n>4\bp\334\266\005\212\242U\304\2259n\216\033\313exl\020Qq\374:\262\034H\254\006I\346\350\210\272kgH\222\025?\372\321t\236%\035|\240\277F)\315\356\206\374/\214\333\315\t'2b\\g`h\271\202*\031VR\213f)"
+	.string	"F\211O\273\237\346\247\251\036Sa\206\220\025?m\363\323L\252\003S1s\277\315\357\364\356\202\210\234\347\315\250\007!\244] \341\037\244M \341a\3629U\352\372`\303b\200O\234jSB\211N\206x\311\364\200\371\207\263-\372qK\240&Rt\001q\250QM\206D\304$\005)\243\222\306`\002!4t\325\001\022`t5\007q\220!D1B\301HA\312J9I\007\\%\300\255\235i\3269I$\320\301kf\203\233!\362\272\177y:\025\205\344~\317hu8R\026\215\335\020\3240bY\254B\027O\257\211A\020v!\247Q\026_8!\257\261!\3671\222[@^\266\030\354P\003\250.\342I\217\275\217\"z\213]\026\256O@k\324M\211[\365j\275o[\272L`\340\321/\347E\202\227i+\261]>\302\007i\177Y\254\rh\201\252e\301\214"
+	.ascii	"K\242(\257\275\320\227\013\005{|\020/\372\245\334<)\223\023\017"
+	.ascii	"w2\020\034\245/&Q8\374\337\003\314\252HB\322\266\375.)8\266\343"
+	.ascii	"r4sX\316\271y:d\326\220\350\032\2355\"@\362\017{(\304@ Ra\r\255"
+	.ascii	"69\236s\017\201\243\026\263pH\266\311]\307d\r\220Hm\366G\360"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_.jmpfuncs.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`\375\004\305\013"
+	.ascii	"\002O+,pi"
+	.string	"\222\016\3741\240N+\001L\216@\371\2010PUU\347uoF\001\206VU]\216_\271\023\310_\324j\3036\373I\333M&\031$\311\203\n\031(\002[\346\230g\001\024\317\0227|\304\020[\006\2100\334#\227\351\350Rq\250\374\360S\035\376\242\361Z\024I\232a\360T\257=\350\273\340m\212\320Z\353Z2\337\274\364z\035)\036\255\035=\346\215\264X\036\017\b\344\263\027^a\307\231\023\252\355\316\267\344\002\327Nx\204\311\263[\242^By\312\220\005\003\227qO\324OT\347A\235\336\237\257m\3426M\266\3515\312\347K\210MET\2501Q\306hf\232T\206\335P\002!\306\310l\003\022\300\023-\203\201(\312\230\021\030$\2328\n&\032\312PZX\352\356\355\027\262\233\315\237\230\274\207\252p\350\001\035/HzQ\234=\331E\036\256)\3563\365\tj\212\277e(\013.\036F\343\256A\205\036\216o"
+	.ascii	"\017\002\343\r{\316`\351XT@\216\217\207\002\304\202E\2074F\177"
+	.ascii	"\314\262\262\035\310\246k\321\311\333\363Hb\001H\357:\374\177"
+	.ascii	"\005d\215\301Tm6\0340C\221/\331\370\265\253X\032\036\234\367"
+	.ascii	";H(w0\220\256\357|F5\361\322aD\364\003\354K\212\221\341\013&"
+	.ascii	"\220\221d\316\224\217I(\271\321.u\374&sY\002\222\317\231S5\370"
+	.ascii	"\252Iq\002"
+	.text
+	.section	.gnu.lto_.pureconst.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\230\004\001\230\004\002\230\004\004\270\004\005\231\004\006"
+	.ascii	"\230\004\007\231\004\b\231\004\t\230\004\n\231\004\013\231\004"
+	.ascii	"\f\231\004\r\231\004\016\230\004\017\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"\255\003"
+	.string	"\264\003\004\001"
+	.string	""
+	.string	"\006"
+	.string	"\017"
+	.string	"\002\002"
+	.string	"\001"
+	.string	"0\001\002\004\001\200\f\004\002\005\001\024"
+	.string	"\001  "
+	.string	""
+	.string	"\007\002\024\274\006\b\007\t"
+	.string	"\n\013\001T\f\r\002"
+	.string	"\016"
+	.string	"\017"
+	.string	""
+	.string	"\005.cO "
+	.string	"\030"
+	.string	",\202d\020\214\017\264{\212\0269\323\300"
+	.ascii	"\274\320Q+\302`\330n0\235%\270\013 =\006\006\002\020X\b\001'"
+	.ascii	"\265\tR\304\264\360\335\331\334l\0278\f\236\306@\021"
+	.text
+	.section	.gnu.lto_.lto.419ecd61f18e3dd1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto__putc.14.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\265\b"
+	.string	"v\321=70\345(\035\2363Fc\345e\f\2260\363\311r\243AT\022\034\365\f\364F\264\026P%\376-\217\331hG\276lA\241<\250\302M~\t\260\244\310\003m{\322\244L),"
+	.string	","
+	.string	","
+	.string	"\3168\036\3208k\327\302\370\205\034\264\262J\211\371\257%\210;cW\033\305\001\254V\312\270i\370_d\2658\334t\333\203\266\240\266.\001\207e-\"m\335i\233\330&(t~\030\315\277C\345\365\337S\006c\353\022\233t>\351\213\005~\027\311\353\177\236.p\234\365\271@\023(\0134\253\006\032\231\252\023\323\231N\007\226U"
+	.string	"\025\306\332\227\302\364h\235\371\377\246\253\365\2633\261\230\301Z\323\371 \210\375\0331"
+	.string	"\001\233M\356\366\211(\221 \270\2554z\270\340D\022[hB\244\225H!\nm;\241\264\017B9\323\350\244Up\334I\353\274;\363t5\033\201\2512\243\033\304l\003\n"
+	.ascii	"`\251'\023\372\374\002\213\013\316\313\250\340\032\373*\fVP\241"
+	.ascii	"\307\035^\264\223\f"
+	.text
+	.section	.gnu.lto_blackboxPrintf.16.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\315\f"
+	.string	"\366\330YC"
+	.string	"\2216\035\030\366p\265_\030\241\376?"
+	.string	"\276\244FH\335\362\027\020l\2752\276\313\034\357\034\023\241[k`\205=\004\207iMdae#\374\377\337\213\321\006\277\034)\323\214^&\007\237+N\2266\221;\245D"
+	.string	"E"
+	.string	"F"
+	.string	"\002vI\341\313\356\307\300\r\252O\177\225m\237\305K\233MC\302\311\204\342\006\n(\263\273\027\202\023\240>\247\017\240>\365\304\267\313\315?\370\004.:\274\024\356R\323\331]K/\205\304\255\267\255\300\366\003\373\036\0025p\250\215oG3=:\2309#\305Y~\373\276\313C\333r\311[\2542bTJ\273k\225\330\326\347\355\315\007m\331+\207\261\235\305\244#\3720\255\310!\356\216\330|\332A\365\371\002\227\366[\334\305\366\217\303\003"
+	.string	"\344\344\021\243RR}\214\020O\265\333\335\273\356\207\"\037y\217\322\207\217"
+	.string	"\002f\024Q\224s%7\177\313A\f\006Bx\366H\006y\317\027!3\212'\312\331\237H\252\t\373\323*\311\236\244\251\177\277V\007^\354\b\230\006I\362\251\240\3168! \017\005-\003\201L\330\240}\210d\230\205\217\013\344\301>W\026\032\2718\013\254]"
+	.string	"\t]$\232\026\272\254\257\373\264J\262mJ5\243\227Q\354Td\223i\267\004\004qE\3168\200\3042\360s\244b\024;(\347\022"
+	.ascii	"`\251'\023z\342\243\341L`@b\\\220\257\325\351_\355\222`\255\353"
+	.ascii	"\302\310m\263\235\r\006l\312b0\204O\221\203\273=\252\225\216"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_blackboxPrintfHeaderLine.17.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`\340\001\355\020"
+	.string	"\246\237oF\360\322f8`\312\035.\334e\331l\rY\376\300\307\307\313{\017\251=\240\251\005\207B\255%\333\240I\267\020\204\254T9^\312\370\357I\230\\\301&\037Ok]\032\001\327\327\226>s\253Y\020;ro\262\267\224)\005X"
+	.string	"U"
+	.string	"b"
+	.string	"[\203\243\302\203b\334\30519\347\024\323\271\037\020\213<x\332\017\372\215\327\205F|\300n\017\222\216]\361\304\fL\347,\276@\351\234\351$\245s~\331A.\302\330\023\335\330\304\206\354\356\247/\376z\276\374\307\016 \314\231yv)\273\353\fsT\334z\333\nlG\260\023\f\371\320%?K\033I\350\214-\322\244\272\260\277\355\356Z{\354-}\272\370{\027\372\273-\255[:\267\364\t\004\260\261\263\202\347\204\376\0207E\215\bl\306\355\220\361\242\337\276\217\3432\333s\314\215\334\340\206\310N\320\356z1\266w\356\217\331\363\207N\364z\221\314\003\246\260\222\017WJ\347\256\035\013\0364\035X\326\334\345H\t\220\217\201\264p\341\261W"
+	.string	"\322\241\215$\251\301\323\347\300\220\301\264\013{\370\335\227\261\240\362\341I/\273\212\211\031m\264\321\031\013H\223\337\3501\025\202\233\320vY\235~z\320\306\022\016j\214d\2476\013\244\221\2404c\326\245e\367Q\311~\001\021\250\020\t\303\342\240*\026\252\2659\205\342\322Zm"
+	.ascii	"S-\025\213\b\260\245C\n\345\241\345k\255P\254/\345z\371P\026"
+	.ascii	"\030\374\240r}0 \350\372<\021\366m\265\307\022\222f0\245\261"
+	.ascii	"\314\266\333\002\302\213\376q(kVMz($\365\252\252G5>'?i\352\006"
+	.ascii	"\244f\207&k\366}\034i\202\037#' p\202\021d\306\003 \352\215B"
+	.ascii	"\333\033\203\351\305(\020\327<\202\f\025i\216o\25401w\205\241"
+	.ascii	"Q\032\027\216/V\323\027!P\200_^\001\234\275\325 k\223\201\007"
+	.ascii	"\313\265\036\327X\356\n\235\007L\255k\306\230 b\027(H\024\334"
+	.ascii	"\343\230sh\216\2035\"\300\243\200\227\027\355#\003"
+	.text
+	.section	.gnu.lto_blackboxWriteUnsignedVB.18.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`3\001\235\r"
+	.string	"6\332\\C \217\223\016\345\331\362g"
+	.string	"t?\b(s\365\230\340]\366\324\204\001\3376\240\251j\232\304T.b\177\333\326Wa\360\262c\265\231n\240\305@\020\0304\220\363\017\261b ~d\031|\303TD\310\336R\246\024H"
+	.string	"G"
+	.string	"G"
+	.string	"\006\331/\236b\331\267\214\340L\310\330\335L;\030&\350\021j\202\3744\261\350\274\320#\274H)\0366<\022\374P\311\274\034\365D\361F\tA\224\256G\035\206P\211\321y\245\347\245`w\235\235\207\341\266n;\3046\002\373\\N\205\362\203E%c\345`o`Z\203\375\364_?\335Q\323P\323\232\351\314\3647\256\f-\006\270\330M\371f6&\276|\300l?\355\223x\t\320O&\006\260\273\001E\212\335\224\001\037\320x\344\270"
+	.string	"\353\021>\200\365\030j\230\227FE\361w\023+j\207\205\031-+NR\005ww\241\257[\205\025\025\323\004&\227\n\253+Um\222\222|g\216\023\r9U\365'\276'`]S\317\225F\3719\352\225\201\312\307\255D\371\251\013\f\311S]q\235\222\021\316\204h\315\303\201G$d\323<\235\006\0246\220\007\032g\004$\363\210p d\332\207$\363(\340-B\347\223I\330\266O\206\245\366\020F\335,\320\020#\322\221\257\204\032\205z\324;L0\334j\243\032uv0D\371E]\361Q\327\230\021qA\261\031"
+	.string	"`\251\2473\020\216\315\315\276,\206>0\222^\314\353\030mpV\241a/l\r\325\022"
+	.ascii	"\205\031f\243@D\313\035\026\323k\261r\261\226XM\t\356\305-U\252"
+	.ascii	"\226\201z\331$\314'"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVB.19.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\345\007"
+	.string	"\202\21777@s\322\001\030L\3023\242\360F11\020\371u='f\007\240\276\234\032\203\200\302\361Q>\203X\372\220'\200t\254~\364.l9\246\201\255\204\355\335\032\355&eJ\001\230D\311\232\200\276D\f\031iA\2732L\241B\0335\\Vi\0243\222\345\020\257\315\024E\004\326\036\260-Fh\332\026A\337^QN(Iah\206=y\265!Ly\317!\230\2526\205E\336\273f\313HJC;\373\353R?\354svw\255(\373(\277f\372U\207dF\340e\227\343\306fS0F\004d\373i\337\344'\334Q.\374\331\365p\201\331\335\002\033x\016C\017\250\0169\007\250\016\315\3314\377B\366+2\033,5\273\033\025\344\334\223\363\237\362\217w\352\236\035\204\335uz\247\216[o{\300\366\201m\225\n"
+	.ascii	"`\251'\0230\203g\304\005\003g\030\001\243.a\021\253\321\340."
+	.ascii	"/\332I\006"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVBArray.20.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`\307\001\355\020"
+	.string	"V\241qE\360\320&\035\372),q\203=7<\201NO\373\363W-\275~\312s\f\373\277\036\360\241\346{3!\306\r\225\254\337hfG:[\021-\3013\360\f*o\026\344\253\326\031J\222\027._B\255\251\265\275\245L)\\"
+	.string	"\\"
+	.string	"Z"
+	.string	"N\220=\272\373\200\320cv\001\241G\263\354\032\357l\366\261\027.97v\267\244\032,\372\276\357;\354n\230\254G\250\311\362c/"
+	.string	"\203\361\342T\036\241\210\005\206C\007\307\002E\202\200z\356=_8WB\0172\327{?"
+	.ascii	"\363^\234\314S\264`w\235/.\346\016\335\266\005\333\r\354|V\230"
+	.ascii	"N\230~\207HE\f\002\337.\314\207c\177bO\207\353\374\366\375\234"
+	.ascii	"\357\254n\302\312\331x\t\337\263f\035\373d*\0272/&\003hw?\036"
+	.ascii	"\315\300+[{\274f;\273\223`\035\307>\036\355f\240\301\263\273"
+	.ascii	" V\220=z\300\247}\021\037\301\372M\312\003\354\322\260\340\331"
+	.ascii	"\355@\002\t\325\337\331(\344_\232~\347$/\304\317\212\252\330"
+	.ascii	"?\201b\222m\360SBG\3612\323\312\317\251#U}\013\bx\267\b]S\337"
+	.ascii	"\362\301\225\237\243^\357=b\200\245p\311\321\312O\325[\301\302"
+	.ascii	"\251\326\330\235+/b\023\004d\245\261cZ#\375\346\037\035\347\317"
+	.ascii	"\256s\307L\303g\250\237\244*l\247\2702\251T\246\350S\b\204\024"
+	.ascii	"\352\301vJ\2218@\331FJN\246\b#\245\024\312$\241tR\231\224B\f"
+	.ascii	"x\233@\242*\235l\233\252\244u\255+\215\037{\346\255\370i\251"
+	.ascii	"+j\215G3JR\235\221\037\217\372\222i\324\337\304\\\254d\320\341"
+	.ascii	"\356.4\202G%\305\300\274\026\030\200\324P%\371\227=F\001# `\002"
+	.ascii	"!\310\214\007`\365\304\300\276#\353\026}\266\226\313\"9J\306"
+	.ascii	"Qn\234\266\266Q\232\231gnrM\007\314Vf{@\313\366UW\261|a\2635"
+	.ascii	"W\0270\304\b\302]Ia;\342\250{\3310M\244\025\313\322.\343D\246"
+	.ascii	"\031j\343}\211t.\361\004"
+	.text
+	.section	.gnu.lto_blackboxWriteSigned16VBArray.21.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`\326\001=\021"
+	.string	"\366\241sF\360\320&\035\372\205\2618\363\341\345\373\360\356\314#\340!\222^w\222\305\220\177\352\353{\346\302Z3!\306\r\225\354\347\212\325\361\312^\205\221\262\211lB\356\017S\241,x\016\242r\030{\2706\265&\215l\"eJ\001_"
+	.string	"]"
+	.string	"["
+	.string	"\237\207\031l\217\376n@{\334^@{t\313\216\361\357f\037\203\321\242ScwO\332\301\2430\f\303g\337\235e\3531\323l\371\261#\240\001\202y)\217\331h\345\345C"
+	.ascii	"o%\003)\"\3629\370t\361^\231\205\210\271\036\274\202\231\020"
+	.ascii	"\346\305<G\016v\327\t\363`n\355\2663\330\206`\347\200\326,\235"
+	.ascii	"Y\372\002F2\\\034\240\261\373\022\332X\241\350\003\342;\277}"
+	.ascii	"_\347<'Wa\365l\224\330\335\247\360As\336\361\317\226\242a\003"
+	.ascii	"cCD\273\333\361\350\007>\261\271\307s\266\363;\212\326s\374c"
+	.ascii	"\322.\207\241\236\335\365p\203\355\221#{\3327\361\023\255\343"
+	.ascii	"\240\234\300nMP\317n\347!\351\3620\223\236\347%\220\204\220\212"
+	.ascii	"\2468\323\250ga\177\205\211\205\315\203\217\242\335E\306\245"
+	.ascii	"%U=\313\210\274[h\327\324\263\210xehM\257\007\0377\320\200-7"
+	.ascii	"\\\031\252\202@+\236\252\215\375\275\362 7ED\326\032[K\233\270"
+	.ascii	"\343\374\245\347\374\244\357\334Z\246cLg\317\252\227\2540t\251"
+	.ascii	"x\202b\261P\321\251\217\221\225JB\227Z\211D0\351B&\244P\024B"
+	.ascii	"N+\025\212\344\224b]8}$pWA\204u*\351:\326\211\373\\\327\032?"
+	.ascii	"\366\r\234!\344\322WT\033\223d\224S}\221\035\327\324\205\244"
+	.ascii	"\232\036'\026\244\222E\317vw3/\270\246\034\314L\3102\003 M#\252"
+	.ascii	"<\314\034\245\214\352$ `\002!\310\214\007`\365\304\300\276#\353"
+	.ascii	"\026\325\266V\317\"9\n\311\242\b8\035\336Fif\326\334\362m,\263"
+	.ascii	"zpK\300\345\031\367\301VB\256\032\n\310\3034\213i\335\222-[M"
+	.ascii	"vK\304\021\367\302\360\233H#\226\240]\306\211L3\324\306\373\022"
+	.ascii	"\351\\\342\t"
+	.text
+	.section	.gnu.lto_blackboxWriteS16.22.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"E\t"
+	.string	"v\022A90\305*\035"
+	.string	"\231\323i\026i,\243\215\310\n\355p\306\320\341M\213R\006\273&ZC\263%\026f@\303L\013\341\322P\302\031d\225N\034Fs\240b\256]C{\023)S\n."
+	.string	"/"
+	.string	"."
+	.string	"/\200\177y\002\370\347\316^\371+d_\022K\231"
+	.string	"\330\335\250 \357\236\235\177\327\003T+\323\363\302\260\273N\325\212\343\326\333>\260\275`_ 0\323O\323\232\226\326L\247\246\237\311l\250lXv5f\261\205=\024\021\333\327\330\316\264?r\222\356\255\013\277]\017\327\311\356&X\001\3637\020w\n\204\252\272\t\220!C\345\314\227L\265I\245\274\312\006\030j\3625\365P\257\231\216\226\224\354\2243\373eJ\375\260\257\355\356ZY\366[\177\237R\250S\361\274q D\240\007n\023}\034,8O\304\326\ty\242\b\324\221\210\333\210\0249\b\346&>\243H\301q\243\250y\355\225\345\206\025\354\244(_\362i\372T5L\f"
+	.ascii	"`\251'\0230\217g\340\002\277\225\034.o\034\252\367\300\304\253"
+	.ascii	"]\006$VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3S32.23.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`y\022\315Q"
+	.ascii	"\372\213\334\035K \324RI\007\201\377Kb{\370f\202\\\222\007\335"
+	.ascii	"\254\017\206\237\322|\274+\217\324SE|\363q\234\351\264\241\245"
+	.ascii	",\3673G\234\262\270\001\347\261d\267\2161\347\337y\277|/\216"
+	.ascii	"\036\210q\005\345&~F)\327\243\265F\bI2\311\316\001\224\001\322"
+	.ascii	"\001\344\252\022\271\232\364U$r\365\210\\5\"W\213\276\n\374*"
+	.ascii	"\021\271:D\256\262 W\205\276\032\364U\240q\3657\256\372\214\306"
+	.ascii	"\332\033W\313q\225\374\352\350\325\357\352\356\252\235\002\224"
+	.ascii	"\236\264.\304\024~\3676U\310\3633\353\220E\2101\033;\b[\316F"
+	.ascii	"c\247i\003\234c^\332\214\021\202H\0317j5\3525rZ\0275\3666\315"
+	.ascii	"v\254\335i\253B\210\317\344\r\3478\rJ\243uQ\2779\325\270\270"
+	.ascii	"\221\300\367f \300\214F\353|ae>\272*lz\346\234R&\225\001\237"
+	.ascii	"\311\250\321\253\3526\237\001\263\233\227\213\346\234a\b7s\276"
+	.ascii	"Q)\016\237I}sRi\322\347\243\322\244*\230*\236\337\276L\307e\021"
+	.ascii	"\306U1\347\264\272\227\247$\275\3077\353o\004\363\213'\247&\027"
+	.ascii	"LK-\224\222\220\216\214\212\200DC,\204\202\240\200~\276^I\216"
+	.ascii	"_0u\214\037\356\310\314\302\374\302\255\215\230}:c\247<MM\270"
+	.ascii	"@\002\007\246\037^\336\354Q;k\363R\031\037J`\031[\t\234s\232"
+	.ascii	"\031[\264\361\266\325i\363A\355\354\214\225F`\230\321F\332&\365"
+	.ascii	"\256h8\003c\244#\243\033l\330\242\336\225\332\331\232\2015\220"
+	.ascii	")\373\262D0\214QB\030\006\231\262\265\035\352aaA\346\341 \324"
+	.ascii	"\273\212s\017\342\025{\324\316\334\034\004\306P?\274\320\305"
+	.ascii	"je.\224BL\344\200\2460\324\312\334H\240\021\2106\332\330\241"
+	.ascii	"\231\330\376`\320p\306\305\276\336\030\245D\331\026\341\226\273"
+	.ascii	"\305\344\220Yp\214\232s\006\231U\331q\334q\206\255\206!\263\261"
+	.ascii	"\361h\344\354L\246\fm\3575\256\261v\247\315\n\2653.\336\336\325"
+	.ascii	"\234S\227\314\354\314\032e\325\235\252:D\025\350BO\310)\222\026"
+	.ascii	"\274\203\017\221\234\311\335em}S.\362\037\017\022\306.H\205\306"
+	.ascii	"AB\313\231\336\211zw\225\277;\314\376n\026\302\320\005\323\312"
+	.ascii	"\265\326\225En\301\207\200\341\023\244\302;\260}\271\202$rW\351"
+	.ascii	"\363\371.\005L\236`\232\330\342\321C\004\025\343\211\312\303"
+	.ascii	"]e\371(pI\214m\037\215rWI\276\274\203i'\177(\204E5\235\024\022"
+	.ascii	"|"
+	.string	"kj\257{\210\266\327\372\357\240\016\243UN\351\357\035$#\266y\212\344\276\327X\006\231;\270;\271\"\225\315\373\2343\354'\252\276\205\255\275\202\na\254\350gP\315\202eHv\345\253\266\3420O\260/\257)(|\025\312W\237|\325\311\270\332\204\311\270:\302W\227\330\315\326\372\252\b_\3152\033+\226\203\260&\261\234\025\311\021#\037x\3404\326\"Nc\355\340\253\034|u\203\257j\360\325\f\276J\344\253\030xu\310\256\n\331\325 _\005\362\325\013\276j\301W+\370*\005_\375\361\325\t\274*\301\256\372\330\325\036_\215\340\253\020|\365\001\257:\260\253\r\354\352\325Wyx\225\201]]`Ww|U\307Ws\224\253\n\220\253\t\220\2538\306U\004\306\325\003\306U\003\306\325\002\276z\303\253\004\354\252\215]\265\372j\325W\251\276:U\256J\221\2535\310U\032\344\352\214\257\016\360U\001\312U\031\344j"
+	.string	"\344*"
+	.string	"\344j\214\257\302 W\243\276\n\365\325\027_}\"W\235\310\325&r\325\305W\231\276\272D\256\266\b\267\016e\362\202iSI\240\021AtbWi\300\255\0067gl\373t\225\005\334\200\033/\340#\035X\227\0336\256u\002<g\253\333Hr\253\347p\302\310\275n!,C\212:\270;5~\340\264\355 \303P\026>\256\272\263\334\251\242c,\216\363\230C\f\316\243\272\261\\W\270E\314\016\325\335\205\315nJ\352S5.u\203Ms\2254^\203\207\271\312\031\2471\300g\fp\273a\243\233\343\035\302\214\205"
+	.string	"2.@"
+	.string	"\227\001\300\243\036\200\026\261'\034\343"
+	.string	"\300x\214\227w`\274\234\203z\324\3118aQ\t\2778\324\307\272\240\0371;/>E\f\237!\032\320>9\375\311\\e\323\235>\022\231\253t\361&\246\273x\311t\273\021\223g\210&\307\313\306\n!\240]\272\252\223\2555\231F\215=L[|\351\236\023\026\225~\364\026o\372#\324rs\225IWBz\322\237\354\b\213T\356\370\220\376\024g\364\241\037}i\216P\213\220\271\312\242\033\001_\344#Lt\340\233\346\354|\215\031\211\316\004\305\020\215\305\207>\376!\213\302\206\271J\241\263\270\205[\202.t\013\213T\200\036\364\036\024A?b_c\200\356\"\304\330\r\321\f\307R\324\t\333?A'\322\261\367\217\332OM\264\361"
+	.string	"5\376\212\234MN\n\247\262\007\037\326\321*\305\273\2327K6g\022\352:\241\025$\224\312\317\230\031C\034\235R<\337\234a\272d\263\212\025c\346\2344\336\250\323|_f\331|\2334Lz"
+	.string	"\304fO\235\340\026\207@'\352\017\217\217\211\217\2709$\037\352\350\353\340lB\272\225r\221\017\251\214\344V,\364"
+	.ascii	"\207gl\373x\234s\316\337\211\3525\376\335\231\343\326\373q\035"
+	.ascii	"\313\"wR\354\273\021e\313\004%YM\262J\370\225\220\305\325\004"
+	.ascii	"\353\204R\225Ti=Y\022\302\226\222'YH\244l\201\300D\tV\023\020"
+	.ascii	"\254\236,\301rb\245$J\tVU3t\013JV\024+\023\266\266\242X\005\275"
+	.ascii	"M\177\006\005bE\035*\027S\333\225\275\260\301\t\205\2236(I\031"
+	.ascii	"\353C\267\261\025\231\323\224\353\250\324\373\021\254\033\357"
+	.ascii	"\351\310\247\274\027\027,N\031\353(\334:\264\335\005\323\346"
+	.ascii	"\364\354\237ur\322\344N\336[\032\341M^\0269\370\bE*\034\360Y"
+	.ascii	"\262\301\227p\261\006\337 \216\006yD\310\340\"\020y\006q\210"
+	.ascii	"\334ea\360\254\2578\030\b\271\326\207\004\271\220 t\206\036\242"
+	.ascii	"\253k\262\002\344\266\002\274\340@.\270\321\334\344\240Tp({f"
+	.ascii	"\n^\001\036\005yO&\370\023\274\t|\\\353\022\364\270\217\036|"
+	.ascii	"\256x\210\316\214\013\262\bn2\037\004\217\340\344\\\260\b\001"
+	.ascii	"\235+\017\334W\276\372<\320\300\265\356\300\325\033\270\272\321"
+	.ascii	"\316\330\t=D\227\003\323\320\b\036\367\220\n\217\005\256u\006"
+	.ascii	"v|\001\254\357\270\321\332\362\204\305*&\352\262\204E\253\360"
+	.ascii	"\220\251\353\346XQ*8\033T\244)\3642\204\2369u\234\334\242R\371"
+	.ascii	"\310u\334m<\026\333\362\b\267\264H2\362\336\2079\024x\216\004"
+	.ascii	"\256\300\225\271J\034O\340\026j\351\035\007\231\326F\247t\242"
+	.ascii	"\006\365Ar\330\357\313\024a\240|\204\223 }p\307\371\267&E\021"
+	.ascii	"J\312F\366\315\0137\300\341\321\253\260\375c>\304=p\222N\324"
+	.ascii	".5G_\357\242\301\b\354]A\240\347\375\304\024xC^\377\240\312I"
+	.ascii	"\356\260\333\255\214\035\322\211^\377\272\216%\216\274\016\366"
+	.ascii	"\023\314\330\005\265\240\346\b\243\023\265\227\207\3008\021\270"
+	.ascii	"\331\314\320\005\323\212\274\356\371\023\314\310\t\265(\211\311"
+	.ascii	"R\003\360D}\336\001\267\033\334\234y@\201n\250a8%\021S\246FF"
+	.ascii	"R\220\024$\315\001\201\005\304 \b\231\325\r\021@\245b\222\215"
+	.ascii	"\310H\n\n\322\006\026\221\002\321\037k4\241\206\033@TAr\376\326"
+	.ascii	"o\2153-\337\351p\025\205\270\">\346\226\362\350g\350ilc\016"
+	.ascii	"\025\226W\003E\234P3\260\243b\023\361\3141\340\304\001\245\200"
+	.ascii	"\311sV\314\347Z%\317\335\367\250\305^\265\033s\237\241\255\354"
+	.ascii	"\317\324\316\3139\256bg$\254\356\225\217\321\276\t6\030\036\245"
+	.ascii	"\373S\225\246\020\005\027\374,\\\247_\335\320\243\213\353\335"
+	.ascii	"\252\377\243\342\211\026/\310\214\004\r\364\262\357p\342\207"
+	.ascii	"\f\361#\307\fk\240\300\001|Sd\024\020!|\f\306I-\271\306U\222"
+	.ascii	"~\222\215*J?\372\023E#j;\376\257r\235\244\211\353QS\254\371\370"
+	.ascii	"\243R\002l\237_\026\224=\222uO\330\312\242\304\265\222\023\351"
+	.ascii	"\315\317\244\025\252Q\030\214\200\261\027\330/\234}\351V\035"
+	.ascii	"0j\032\243\226AZ\001\231\257\001\243\365\211\033\261~\036K\231"
+	.ascii	"\332\264\315\006\372\034$v\370\305\337\356"
+	.string	"g\265\2562x8g\212}\354\272\230mT\304\026_\201\345A\222\264\226\374q\250r\324\315\347\341X\035\263\371\313\331e{\273i\223\354\264\223\031b\347\222[\302\264\243\027\220bh\333a[\203\306\247\247\016\360,@\034\251\006\"\272\257=6\224\360*\344\025.Rc\223\314\235\237\306_\021\3121\363@\352X\n\252Z\327\212J5\031\273\301@\320\351\233\374\217\024\223<\364\026\001\302\270\251\342G\342C\223n\212\\F\322\234\361+\340\211\327\026\0316\002P\252\231%\311\031a\310\376x\006\027\263d\252s\302\001d\200\203\177o\360\261 b'O<`\243:%\342\307\325\021\373:5N\303B\235\207@\321\356R\025i\331\345\344\b\376\220\2108\026\344\362)\347Vn\200\306d\271>Tw\033\225\224\361/\226 \210RW\342\"A\240\"\0015$R\"&\354\005#\354ex)\320\235\261@\262\326\354\200\035\320\332\024"
+	.string	"i\3373\251\037\274Ah\363\350\234o\300\\\016\266\337.\336]F(\013\264\307\347"
+	.string	"x\213\2779vT\222cI=\370\345#r\225'\306\022q\272\n\205\233\2410\362\314\r"
+	.ascii	"\027p\267\275\252\270\360\322\212\234\374\316\013\351+\006@\211"
+	.ascii	"h\032p\227z\370\205\022\260\031\201\260\272\245\224\337\375\001"
+	.ascii	"\020\021\177{\363\025\023F\313\320;\303\225\362\333lA-\345D-"
+	.ascii	"\364\3632\343V\251\263T\371\001\3722%(\246\306\227\217\242Vs"
+	.ascii	"\013\004\356=\373\\\312z\263O'\034v\327cP\215M\375/9\371\003"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3SVariable.24.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`\023\024\345U"
+	.string	"\372\223\\\037J \324RI\007\201\377\355\275\247\212w\2037\337\266\360\034\323?r\254D\2546\275I3\376Z\036\310\257Q\327\260\205(\223E\205WN\3178rN\375\330\177\316\272x?\374\226X\f\303\365\034\207\374\034jq(\216\326\b\331)I\031\354\001\236\001\367\001U\323J5\255.\246u\312V)[\243\246\025jZ\237\246\325\311\326&[\231\226\246UiZ\223\246\025\311\326\243i5\232\326\242i%\262u\310V\241i\r\232V [\177n\005\336\372[\272U\322\326\321\326y\353o\265\255\273*x\311\301\255"
+	.string	"\206\355w\346\312\266>>e\235q\210\033V\315n\232]\272\3353;U\367.M\2302b6\b];\rJ\343\343\210:<\200;ZU\212n\335\242\321\2403F\245\032\2302br,\235\356U\251\315\225X\276\326d!\267\265\243\336"
+	.ascii	"\356h\325-\263f\244\354\034\n{T\2260\360\265)\3139.\265\001\334"
+	.ascii	"Q\347\200\373\303\312IQ\335\233s2`Y0T\204h\262(\313\322\253j"
+	.ascii	"\227\310\035\347&\221;>\006,\375\316\271\325\254K\331\027XWV"
+	.ascii	"UT.\246\244\262\240\236\234\232\230\226\224\222\220\216\214\212"
+	.ascii	"\210\206\204\202\200~\200\277(r\234\267\024\335\037\330\344a"
+	.ascii	"\216\0366,g\373\002\357\016\bc}q[\263WMX\361U\005\261\301\201"
+	.ascii	"JG\230;*\274\270\335\255\013;3\244\021\261\fiDT3\247\356\326"
+	.ascii	"|x\344z\360\342\266f\245\246\221\334\244A\203\263~`_\334\362"
+	.ascii	"\026\312\352\311\251\007\036\334\364\003\363\342\346\3032\335"
+	.ascii	"`\203\227j\260\363\301J}I?Z\340\200\364\305\246\216\234\026^"
+	.ascii	"\334\360\366\310\016\021\214\221\fEv\210-\020M(\2708Y\326\016"
+	.ascii	"\021nf!\361\002\024CS\006\036!\260X;D\026\346R\233\rl\233\003"
+	.ascii	"q\006\013\255\020\244\002\320\333\317\324\302cB\207\265C\344"
+	.ascii	"2\231t\340\222\267\300\371u\267Gn\355\020\267\314!2S\316\204"
+	.ascii	"\361o\321\3626JH\256\215S\246\332\211\260\244\315\252\262,\027"
+	.ascii	"\315Z\345@\374\301\376\201\225e\251f\303\342\266\ncUM\205\252"
+	.ascii	"\366P=:\023f\336e\016\033\340\343\224j\313\310\337\315\214~_"
+	.ascii	"4;\022\361\364L\"]\n?\217\363\273\267\272GV}\250\336Z\035\267"
+	.ascii	"V\277\265:\311\255]\372Pww\313\262,\243\206\330\021\330E\r\013"
+	.ascii	")\304\216n\200\343\203\340\321\031\032\321\245\320e\224R\372"
+	.ascii	"K]\0345\357Y+5\"\335\324\276eB\316C\321m3\027\205\007\301{3T"
+	.ascii	"\272\024\272\250\375q}[F\376D\352\346\250y\217\272\3342\322\377"
+	.ascii	"w\r.\315}\272\367\277',.\236\031\221\t\220\006]\024\310\035\367"
+	.ascii	"\267B\211\272;k\336\320\334\247:w\346\307\251\356\252\021\351"
+	.ascii	"\250\350aP}\343\262E\313\022\367\314\352\266]\261Re\270lK\305"
+	.ascii	"V3[O\260\325\204[K\270\265\314\326(;\267\033\264\365\211\255"
+	.ascii	"NV\315\352\022\2621%IlEb\353\b\266\036\261U\004[\215\330\032"
+	.ascii	"\302Z\305Hk\021\322\032f+\021[\207\330\n\202\255Bl\375`\255\036"
+	.ascii	"\220\326 \244\265\003[\201\330\372\303V\016\326\272\001i\325"
+	.ascii	"\200\264f`\253\217\265b@Z{\220V\036\266^`\253\005\243\265\202"
+	.ascii	"i\3351\255"
+	.string	"\024\334:\301\255:n\225\340\326\034\266F\260V\bH\353\003\244\325\001[\033\030\255\fL\353\002\323\n6\2558l\2751\255\n\330\232\200\255\b\330z\300h5`Z\013\230V\033\323J\200\255\003\330*\300\264\006`\353\227\2555l\2451Z\275\246\265kZ\271\246u\206\255[\266\312\030\255Z\323\032cZ\001\230V\030\266fM\353\013[\261l\275\262\325j\323\254\006kpM3\366\312\241\300y#\314\222V\247,K&\035\3372urt|\307\300\321[\203K\233+\313\263\245\307\351\366m\031)\301\327K\235\234\315q\t\"x\216\317\274*\"\370>\360\340!\370\256\215I\343#\035\370\003\337\265\034\310\356\300\177l\241\344;\374\332m\326\025l\352\356\004\301\347eY\242)5\300\300\033X\340\f\200]\201/\240}\033$q\034\354\306q\270\271\361\337^\002W\340\207\300\023h\203\300\315\364\364\034`\300\017(\340\006\330x"
+	.ascii	"/ KZ\236%\3406\0068\001\002|\200;\365Y+\246\265\021\340?9_\017"
+	.ascii	"\340d\036Y\343_x5n\2467\005\r\257\323\350\272W\220\344z\327g"
+	.ascii	"\037\034\033$g\234k\3533\366[\337=zw\326\212W\034\215\026,$\311"
+	.ascii	"\320\272\214\030\327\372\002\360\027\217q2\257h\203$\214\003"
+	.ascii	"\220u\030\377]!,\242\271\311\372o\017\353/N\346]\035\353\243"
+	.ascii	"\2345>W7\323K3|\003\262\025\325\255\\\034\352T\273Ar\352.\244"
+	.ascii	">\205\304F]\252\030\365\247(6H>\035\352\263\317\215\r\222N\177"
+	.ascii	"j\272\323\214\3357\365\271\300\247j\264\374\200\004d\246\253"
+	.ascii	"*!\363\262i\225\332\317T\351L\337<a1\351FWzT\037a\226o\220Dz"
+	.ascii	"\322\321\221>\265\204\260\210\346\346\350Sh\212\036t\243;\311"
+	.ascii	"\021f\021\332 I\364\242\241\023\355\336\n}\350QyB\177\212b\370"
+	.ascii	"Fc\203$\320\203\276\302-?\007\372\n\213s\377\363\335\303\206"
+	.ascii	"\316\032\2374\367\251\024@\031JbY\226Z&b\257\316\231\373\350"
+	.ascii	"\342 \346\210\316\216\223\313\234\321\234\325\003\004W,2\333"
+	.ascii	"\242\022\020|\2106O\215-\246\f}\313H\240\201\337\301wg\367\204"
+	.ascii	"P\224-j\025qn\b\372-\023r\374\324\227$V\214\2310@\217\323%^\334"
+	.ascii	"V\227\347\347qZ4\365%Q\026\370\325\204\314I\230X\0221\022~H\020"
+	.ascii	"{\222d\b\024R\303\272\214\214\035)B\0266&&$\n\031\021$aC\222"
+	.ascii	"\020\361\032;2D\211WX\023\022\274\272b(\331\022\261&^N\310\310"
+	.ascii	"\232x\005\315\225\233\2044c\365\b\213k\267\355\303\2663\001\242"
+	.ascii	"\216\026x\320\236\266S\200\330\330\311e\201f\301\316\334\347"
+	.ascii	"\305\3434\310\207\253\245\362q\006\251\255]\362\341\336\255\327"
+	.ascii	"\333\325\262]\247\024\371\261\017\271\244\250s\002k\354\313\366"
+	.ascii	"\337\222/\225\357\016|z\326\340\314\340)\347J\255u\237+\023J"
+	.ascii	"\270\t\3779\225\275\204\223E$/+\242!\371\276\315I\023e\204G\201"
+	.ascii	"\333#\037\341H\337\023\021\376\304\310E\030cD\217\223\020\356"
+	.ascii	"dL\bE\036\274X\330\213\204M\321\266Doz\260\322B\344\253\305h"
+	.ascii	"\310\211\fyc\006\302\315\254e\205\034\004!z'|\360\023\316|\020"
+	.ascii	"\344\301{\320\301\203t\360}\223\223\306\312\022\275i\241\212"
+	.ascii	"\013\220/\027\340\217\003\371\230\267V\3741\305\026\273-\007"
+	.ascii	"\337-m8\320\340\301o\220\3015\310\340\316p\211\336h\241\332\267"
+	.ascii	"\275\333I\204\013\333\347\343\373v\265pK\232\021>z<x\fx\274\307"
+	.ascii	"\222\363\370\276\305\321\023\026Me\233\210.\036\247&jW\234+\272"
+	.ascii	"E\350UQ.5[9\\#\246t\241\3242\233\226\345\331\302Y\251\024\206"
+	.ascii	"\261\303\263\343\005\037]T\256\035\373\005\337\273\235E\276>"
+	.ascii	"\341\226\251\231\245\344\344\207\026Tp\013v\274\202\r\222\024"
+	.ascii	"|\307W\230%\355\024\300\361\321\021\026\321\244\354\226\213\r"
+	.ascii	"j\211\327\250\252\223}\250PI\2563j\351J~\320\220\247\316\t5\357"
+	.ascii	"\331\335\231\3658]2L<m\225/\231 \234\326\312\227\314\027\246"
+	.ascii	"\275\362\215\202\314\025\245\035>\311\207\252]K\366%~\333\034"
+	.ascii	"q\307P\\U\016$\317\323"
+	.string	"\343\366\254\034\n\234;N\217\323_\337\004\263\234\340\313\003\034:\001\201\230\250a4$\221ChFDDD\222$Ic\261\005\304\030\007\235\225\007\021"
+	.ascii	"\245c\220\231\210&\005)\244\0036\321\007\223\024\b\345ps\325"
+	.ascii	"\177\264b]Z\306;V\"\316\200.\216\302\245\350\220\314-\371\326"
+	.ascii	"\n\026Wb\236\323\004E+0\377\007\2551\240\007\341he\271&"
+	.string	"\313W\303\034#\244\\<3I\241\265\026\202\353\177\003:/\336\236\377\370\035\177[s\177_\366\302\t&\366\324\324\342\363\372p\324\0308\027\361\370\331Y;\3509\001m\023=\024\342\003\376\271\354\207;\020 Rj1\247\310\\7\365Y\255\311\360\032\005Y\365}\377\200p\002)^\rC\013\2015\024\256L(!\271\2555\365sC}\214:N\203\366\213*\207\033S/9\347\025/g'\276\030\003\227R\003\036\205\316\322\032.9\264\030\322+\342h&\370\251r\356\251\240\204R9\255!\253\376\315\301b\006\210\310X\265\266E\"\031\332\346|\006\350\321\036_k\336\377\326\205\251\037\356\242\021\022\353\270\2652\337\205\216.fI\021\353\222\021/\364\331\306!\261\355\374\263\313j\316$f+\032\354\313\013\032\276\366\202\325\370\245\0359u\341\341\321H\374\033_;\277F#\234-\0252\037\366\343\303\230\350p;\244@2\200"
+	.string	"\033\225 i\332\330\250\266ed\037\027\212\275\002\036\254*gz;D\340x\021`\2032\350\246\206\0374\220\305\021\265\331\210\211Q\2254V\271\237v\300\310\262\363\352'\224rh\215\0069q\273\021\026!@\315\265q\257\266i\364\020\373;\221\2079\375\331\276\200\377\001\2379\230\267\233\004l\221\307\005\356\254 \032\022\n;\243H\270\334h\216\t\2327\255!\004\250\320\025\236f\r' W\n(\037.q\355\366'\374\363\225\227wDQ\345KA\217\275\352\221EE\361\257\001\276\001C6"
+	.ascii	"\224\006\232\0233\\?Z\\\236{\317\200\201\312\210@\nP\257D\274"
+	.ascii	"d\274\037\257\3754d\007\331\231\311\222\2014\331\360\210\303"
+	.ascii	"\211\017\276\253\340_\215\334\333\230\266\261\305 ?\027\210\237"
+	.ascii	"\336M\244\360\246\355\232\3626\037\222(\233\331\275P\246\317"
+	.ascii	"\303H\034b\214.\330\264\317\234<\203\260\321\r\206\300\205\021"
+	.ascii	".\2550\246\262\201B(=\334\255\236\\\263\215@!\210\223\344\214"
+	.ascii	"\2120E\031\333\032\025\003\311y0\r4Y+\207\346f\025\035\217k\220"
+	.ascii	"\373\375\214D\016.\037E\301\002\346\364\240\355T\236\016\274"
+	.ascii	"\265\007\305\204o\221\016H\n\223\304\363\236\341\310\261\270"
+	.ascii	"\232|\314\272x\341sB\2251Y\007\022\222\335K\333\341\257\b\260"
+	.ascii	"\022\257\\\331\212P,z\201\035)\247\363\272\374\332\315\202\177"
+	.ascii	"\007\274\234\332\251@t\340\211o8\375\356\r\266:S\222*\327\266"
+	.ascii	"%T"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_4S16.25.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`!\r\315>"
+	.ascii	"zm\204\027<@\350I:\201\250\030w\234o9\343\013W\377\256%}_K\376"
+	.ascii	"h\205\216j\233\237e^\013S\241\217FB#\266d\371_\304n\337~\307"
+	.ascii	"\n\354aM\364\345\217\372\237\020Bv\222R\006t\001;\001j\001\275"
+	.ascii	"\177o\277\227_\f\310C\304\"0M\225\frJ\017\225|\276\260\035f:"
+	.ascii	"\314If8\314r\370\274\344\210\251\\\0275y<g\271\316\n\351\354"
+	.ascii	"\335\261C\201r\331\354\206\343\360\336\n\345(QC\337\260\036\034"
+	.ascii	"\303\331>4\356\210\312\351\202fR\232\246i(\227^\365A\0048N\376"
+	.ascii	"@\323\274s\257K\232Ii\232\f\343r5\240\334\273\274\206\331\300"
+	.ascii	"q\233 L\225\246U\360\350I\323\344\330N@\271\334$c\231\\\242l"
+	.ascii	"er\271\013\267+\211\223XR\266\303\211.N\2464M\213\277\262\265"
+	.ascii	"\225k\222\027\352p\334\305\005`K+\013\353\312\252\212\2128%\025"
+	.ascii	"5\024B=\241\247Y\3267\334"
+	.string	"\362\036\027\320\264gdI\034w\251a\256ZF$\023\024NtTS\207\233\350\026\361^\232\006\200\006Jo\235a\255,,/]\372\312\252j\213\226\246\352/L\304\302S_X\252b)\361b\204\023\035\245T\006\223\366\\b>\376\ns\304\353\250,QL\342\221\213I<~\251C>\036S\003\206\n\2233,\254\303?1w\234\350\370\244\226\331\361\375q\035\356#K\2064\324if\205\311\035?}\241g\365Jt\254\243k\3634\243\302\304\216\3139\341\022\"]\245\226\310U\2570G\273>\327\341\262\213\035%*L\356\270O\2634M\267\215,a\302\033\200w\033jwS\354\n\363\002\203|\345\221;\305;L\363\354E\217\020\312;\314\362\346y\016\357\345\271\t &:A!\314\367'\246\256\262\233Y\377\246\007(\327\233vYO\0177\224\313r\220\363\221\273\253\375\347\2711\225W\220\311\357\363\\\030\263\363K"
+	.string	"6\242\023\024\322\203\333\ffjx\213s\035\256~"
+	.string	"\377\314q\032\322\203\267\343\373\003\363#w\223q\375*\177b\354\364\354\253\354\326^\243\2136\266\265\026,V\244\250\275'L\324\336\022$\270\r\263\232\331;\302\354\025Q{C\230\275\037\314^\017l\2077\r\255\303\031\007\246\303k\266AC\206\332\213\301\354\275P{-\324\336\n\265\227B\355\235`\366J8{#\234\275\020joY\355}\300\275\016\336\333\340\275\305\332KV{\307j\257\030\367\206\275\227\301{\027\230\275`\265W\001'y\0230\034^\004,\207\367@\3555`\366\0268{\277\316^\257\332K\240\366\016\340^\001\357\r\360\336\256\332\313\305\275"
+	.ascii	"\336\273\365^\255\332\233e\366b\235\275Wg\257U\355\255\342^\252"
+	.ascii	"\367\022\337;e\366J\325\336(\356\035\276W\370^\250\332\213\226"
+	.ascii	"\275g\331k\226\275e\355\255\034\254'\322\240\325\221\033\202"
+	.ascii	"\371\270\366\231\"\367\270\3553\271\036\242n\b\b\256\255\253"
+	.ascii	"\035\200\326\267\264\316w\221\032\321\t\n\251\n\324\003<\304"
+	.ascii	"CAd\250\270H\035\235A\304#7\013"
+	.string	"\353Y\357;\"\216v\254+KtM\256.\342\333S\214\303\264\372\325\231\256\256\352V7\t\251\250\"^\355TS'N\235\333@\302\364\305(\3578u$\230)u\023\177\2349NQ\227ze\364\"Jx\265\017\031\017C]\230v\250\363\021\222\241\205s\007p\215\324\221\033\306g\007+sE\017\260\020w\035\017\305u\247(E\313~\220\020-\003\ndh\271o%\241i\032\267m$M2'/\235\222. \264\214\207bI\217i2]\300\245\2073\0373\222@\232\016\021i\301=\37707\334\303\317:0\303\n\245\341\007\204\215~wF\215f#\353%\367\270=p\224\201\243A\341\221{:zr\201j\352\203\327cl\366#[\2372\234\367\030\265\264G\260\227\177\230\032\212c\032\3519\222\353M\\\3234M\241\216\\\356+\203\256\235\373\234\234l\347>\227\312\2663\232>\205\336\342\031~d\227\214\315\356\342@"
+	.string	"\363t\230\247\257]\206 \264\331\256\302Q\2362;\276\277\363\310\345A\336a\236\234\236\347:G{sx\346\221,\300l\361\266\253"
+	.ascii	"\034\244k2\244\003=\370\315MG\233\221\2061\007\332\303\350\302"
+	.ascii	"\206\007#\r6\266\0306\204o\306\027/v\260\2319\214;h\254\3610"
+	.ascii	"\267\215\f\206\215\030.\334\332l\030Y\364pc\233\321\266F\203"
+	.ascii	"\255h#\306Z\215b\333[\216\"\031\330\272\3350\276\025u\270\271"
+	.ascii	"\275\025\205\311\224_eW\2009$\344C\2720$8\206\032&\023\246\253"
+	.ascii	"A\225\"qm\241=\301\326\331\021\2101\202\256[c\006\300\221{\006"
+	.ascii	"\322Z\201j\372\323F\030\306iZ\035\376x\021\262\037\243iq`\364"
+	.ascii	"\007O\030\306gaZ\264X|\253\360\3007\244\275H&p\313\257\214\224"
+	.ascii	"\211\023rbE\342[\211h\210\f\tf\245@{\207\037a>.\375\344H\211"
+	.ascii	"\361V\253\263'K~\202\3040\336\254\263o\035\236\235Co8\213\227"
+	.ascii	"}s\202b\234\366\025\367\361\310\320\034\336 \346\356\244u\341"
+	.ascii	"),\374\002\024\013\347c\340`\211\n/\301\221\230\302+@\241\020"
+	.ascii	"8A\302'\2148\332%D\370\b\b\217Pv\b?\t\r\037\274\f\312\203\006"
+	.ascii	"W\273\203\342\033\024\317z\002\re\035\271F\262\033\311\316w\201"
+	.ascii	"{'\034\361\330"
+	.string	"O\240b\037{y\007\016\213\030\203\253=l\301\031,8\337I\032\3042c&\021\017\005\371]\035\311\210\301NB\301\301\024\234\217\222\362\264\201\0027\360\341h/\360\365\017\334\210\275\376E\340^?\373\350\004\205\f8\201\233\214\346\004\321\006\004\270\332\005t=@\327\003\201\b\250q,$\025d\204FD$H\222$i\r\201\005\004\031H\021\332\001\021P%cN\331H\223\322p J\223\0026\220F\212\264lh;2\246Jf\225\264d\367\033\366 \325G6\362\203\265h\265\337\335`U\236\033\235\3229\326\264G\t\340\035\270\356(\367\3550mG\367/\240\005]\021\245\213\324\265\035K\214\244\214^|7,\032\305\035\031\372\036t~,R\330q\251b\374\352\334c#c\t\352|\2226\033\335\216H\2414\307W\243\300\200\352\320rGi\027\005\177<\244\376\223\212\312~H\2133\370P\304)\323\020xa\276P"
+	.string	"C1\362\213~\376o\234Ek\247\310F\013\027\224.\023\020>d\341\265g\037\255\261 \020m\223\001\203\302p\027\325\2767\264S\327\020\t\004\260\371&1\310p\215\220@\354\266B\344`\242{\236\001\261Q\2233\261\220\361\252g\033|H\340\252#\377\220\027\302\302\265|\"\226\315Le32+\234I\032T\224\241p\343\227{_v\347k@I\271I\320^\276\006\376l\346\324m\312\2460I,\321\271bd\002\263\034\257HD\033\222\3225\273\004\366\201"
+	.string	"\360@\301\263\214d\336\314\223\211l+a\245\312\253|\251C4\304,\262}X[\355~7-\331-\372"
+	.ascii	"\020\205\372-N\250`\332\354g\250(E\231\202L\354\270\321\303W"
+	.ascii	"\371G\275S`\036[\2548/\033\025\270|\267\360\346\036\003p\353"
+	.ascii	"\240\322]\177\240\013\r\242\031\300\354,Y}\360\025\225\346\347"
+	.ascii	"\312\211\351\217\315\360ne\357nr\323\236\177\374\302&\025\255"
+	.ascii	"\366\030S\rao\213\252t\0045yP\336\2078\310\301\212]\303\002\350"
+	.ascii	"\361KY\njS\253\242\035R.\253h,\r\275\246\335\032P\311\324c\t"
+	.ascii	"\306\0250"
+	.ascii	"\276\341\027\013\004\334\241\200(:\026\3019x\3326y4\025"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_8SVB.26.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`\016\005\225!"
+	.string	"\226|\325K\240\024R:\243\330\326\006\023\035@\246\036fC\327-W\375\243\217\034\326\316\341\230\340\034\202\236\241\317WI\270cw\370\275\f^\221\3621\366\013A\236\312}yR\3348I\362\262Nk"
+	.string	"\370\213\303\207\363\376\273oI,![\356$\003\307"
+	.string	"\261"
+	.string	"\277"
+	.ascii	"J\367J\245 \222\312\275\227\3277pL[.\227\313\333\3439m\337s\270"
+	.ascii	"\033\213\255\226\242\264\323\264]}|\344]\302~M\252\206?\317!"
+	.ascii	"9\teT\234\r\342\321oW'`\304\365T%\211ht\026{@\314\310\330\275"
+	.ascii	"\204F\266\245hi\350N\302\031\325fu\236rG\022\361\3505K\013*Z"
+	.ascii	"\272\2270\206uP&\226u*\241\232\322 \330 \3028: \211\370\3424"
+	.ascii	"K\343%|ai\356\275\266a\260\236\247\272\004&\343\224$\"\214\233"
+	.ascii	"\007B\272\265\013\202\250\314\300\r\203,KY\320\t\260\266\215"
+	.ascii	"9\332bq\253\017\360\022\"\331\002]4\242\034\371J4\374\325J\203"
+	.ascii	"p\357\345:4$\236ug~\005f\256\300l7\004B~\227\226C\375\273W%\317"
+	.ascii	"9\334\355R\347Z\255\234\2762jV\246\231\225\317Z\331\254\225\355"
+	.ascii	"+\267Y\271\232\225/@\300S\227\n\345\275EK\263\313ef1\275\352"
+	.ascii	"O\376Ro\346\363\253~\305lc\024'\302\246V\024+\032\240\356\002"
+	.ascii	"\231\224M(\230m\237\342S%\031\t\372#D\255\224F\261{/\005\364"
+	.ascii	"f=\222m\n\030\370.\225\002\275M\264$\023\016\261{\21757y\002"
+	.ascii	"s=~\210\357P\214\204\323{\223\300\260\356\275\t\370\001z\223"
+	.ascii	"\306\2762\377\351F\337\205\2548\200{k\024\301\272\367\230\200"
+	.ascii	"\033\2407\371"
+	.string	"\370\226\363&\372\335y\323\307,\345\307K&?\305\211\303`$\273\275\367\336\264\213\374)U\216h1\375.2)'L\337\232(\3272\375$\025\355\342\003\2340\035\323>f\312 \2137\201\002EE\353\"\177\347\264}\247(\260g\371\354\2409\370+\372D1j\273t\367\205z\330\263\222\363]\373BN\271~\2370K\006\317\200\352\222\177\003'\256aZ\204\0252!\263_]vR+hx\332|\327-}\252\333-+aBG\277\272t\240T&f\246\325\245\231{#\352\207\330\366\017\256\250\303\207E\360]\317\030\203D=\231*\242t\243\273\3105\337\365\213\221G\324\022`-c>\376j\027\311\264\\0\341\256\301|V\236\221\211\201yy:\357\311\351p\223\363\341,\301c\242\027\241F\"\307\004\210\233\023'\343\330x\340\321\351\320\303\341\311\321\340\323\343\260\203s\003\202\003\217G\347&\004\017\247\207\004\317\306"
+	.ascii	"\367D\344\364\360J\364z=<\333\021\350\310\243L\214\\@\375\313"
+	.ascii	"u\221m`\267\2276\301j5\3275\021\267\256\177\026\265\205\353\242"
+	.ascii	"\256_j\276\276\242\276\246n\274\2533\0272\350j\332\374\253\033"
+	.ascii	"\234\372\241\231\376\325-\004i\252\"\006\354\037\027Lc-X\272"
+	.ascii	"x\344)OJk\227F\261~6M\327g\337\352v\354J2xf\263)\256k\267j6\263"
+	.ascii	"\007\035\032`\377p\255M\013\304,,x\006T\353\"\337\200\2402\351"
+	.ascii	"\017\262%fK\347\232\210-z\353#\237\356 \013d\250q \302\024D\206"
+	.ascii	"\241@fDd$N:`\002\031\272\262\016\021\340\255Dd\222\264\337\001"
+	.ascii	"\024:\301D\311u\350\313\022^\373\030HE\036P\260\235\276\002\311"
+	.ascii	"\352l\200\304\203\206\023\216r_\243k\266\354\263\003 \271\260"
+	.ascii	"\307\204f\0365\3646S\bs\370^\223\354\217\013a\2623\026\0178\270"
+	.ascii	"K\025\210L\356t\352n\003Tn\340E\266\031~f\216\307S\324\2742g"
+	.ascii	"(\267\204G\244@}\253\200#\201x\337\257\007\300`\0025\372\bs\215"
+	.ascii	"C\352\245\027\340\316$\377^\205@\341B;W'\347'/$\260\301\364\024"
+	.ascii	"L+\270\032\207Z\037L\234\373\205Y\305a\335\264\346g\375\217\253"
+	.ascii	"\314\272\351\375\033\222\2168\262q\350\363~H$\251\244\277\207"
+	.ascii	"\236\236\0353W\236Ex\"\177M\0325"
+	.text
+	.section	.gnu.lto_blackboxWriteU32.27.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"}\013"
+	.string	"\246\325L=0M\225\016p\300 \366\270\306;\254\030\007j\3616S\311>\3471\023\360\020\025.jDDTk\263!\3652\323J\270a`\220\rR\026C\351\255\244,\316*\261\255cm\334\233H\231R9"
+	.string	"6"
+	.string	"="
+	.string	"\026X v\267\342\002\216C\3127\342av\215x\350\316>\361V\206\375\007\023&\017*vWS\f\357\236\235\177\326\037'\224\367\2648\260\273\316\023*u\353m\013\260m\300\276\204\027\354g\273\273V\225\235\351I\246%\231\216|\365\307LCMg\232\326Lg\246\217\021`\004\211\b\256\335\t\261\025\013\203!4@l?\355o8\207\356\253\220\037\273\001\252\372\324\227\302\364\211&\035\236:\311H\375|($\004*\\%\216[D\214z\375|%J_\314\210\332\240\007\371\223\317\372\305\313\005#\251\347\307\036\212Q#\3524Q\030e\314ny\251\001\032\020\007\343"
+	.string	"z\263$\350l\020p[Gs\201\300e\024l\030NF\353l0\013\264\315\323@\263\f0\307@\343\321>\034\347\321 \255\275\252|y\301D:rLH!\251\347L\241V"
+	.string	"\250f\372\3227\n\027"
+	.ascii	"`\251'\0230\373\315\300\203g\231\202A\347\266!x\314@p\335\254"
+	.ascii	"\222\202\302\300x\200\020\\q\364j\002\3150tUjK\205R\200\t\227"
+	.ascii	"\020\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_blackboxWriteFloat.28.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\215\b"
+	.string	"\246\320<8@\305(\035\225J1\2362V,\370$\313\363-\363\363r\n\027\007\363\374\021\370\237#n\007:6\343\031\"\001Ir\024\305M9\027+aA\300\260;\rFK\b\2212\245*"
+	.string	"-"
+	.string	"*"
+	.string	"\002\3311{\266\311Q\035\373\024k\024r\262\273P9\356==\377\247k\037)\364\254(\354\256\363#e\334z\333\006\266\023l\253\002\2774\235\231~\245\200U\342\221\354b\264"
+	.string	"\354\nSyXl?\355\177\034\304\273\311)k\273#'\221\335\305\030!\340\330\345\003\331\261\353\001Z\246\332\021\"\377\371rM\305\214\002\210\262\345,/\265A\024\371\357J\240\201\262\272\320\220\215\n\245n\330\277vw\255%\373\246\007\035\250\263M`\3462\f\036\316B\344<\235\246\"n\032\270\255\263\201\036\316\346"
+	.string	"\271O\004\314\0348>t\037(\021\343\007ZP\373k\265dM\312J\244\026\016\n"
+	.ascii	"`\251'\023\332\372\002\307\005\333P\341\025L\271\004\333\254"
+	.ascii	"\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_8SVB.part.0.44.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`8\002\365\021"
+	.string	"\206\037oH\340\320(\035\360s\b\030\200L\351\005\331\256\023\177\373\233\214\bF\202 \344\316\r[iSu`\266\343\251X\264\206\224T\032\223Ca\321\016}\352%\240\261\200u\373\245<+\2268b\300%\256D\217\260h\223O6\331;\245T"
+	.string	"W"
+	.string	"\\"
+	.string	"\217\371\t\3622\251w\354\272\260\250\355\226\007^-\362\275\272\374"
+	.string	"\357\365\273"
+	.string	"\357\325>\214\355\261e\322\356y\351\332\323\\\032h|v7|\245$N\236\316\216\364c\367\220\241:\375\354\035=+0b-\036>\003\274\003-\330]\177\037\356z\333\nl?\260\247\210\237\331\240Q\227\031t\333\331]\020e\352\317\214\376\315c\006m\220\220\3616\343l\260+\020\265\335\355\246}\232\253 _c\333[\037\017\315\205\333\335\221\3575\324=\205\301W\203\204\220G\201\341[\030\250\346U\002\267[\032xu\202\317s\276\034/\223\"Pn\207\226\347\264\003&\374\224\367:)\202\031\271\r!V37\351\213i\367n\251\213\355M\323nz\276\374\017\362\020q\261\313!WcG\324\234\327o~\234\337\366\333\274\263\277ss\275\305\360\261\265\320\321\t\261"
+	.string	",\353E\203\341\\\346\347\324F\207X\345\266\264f\374\232A\232m\237\252\365\311h1\016\276\"\245\253\230P\"\203\215\023\251DD\222\340\245\220P'\"\013\236G\037&\246R\21182\221\"\\\020I&\214D'$\241\251$B\tG\247\224\360\243\200E\n\244S\250\"\212\247\020|\354#4^\374\340Vt\205\322\027\333\034\223\232\224\346Y\034\332\230\223\3723\024q\236\205\322\317\016\001\006\366\203cQ\225}\236\f\025\3749 \200\002\031\033\255\003\207\210\001\276\242\025\005sxGaC\f\250\"\2352\2144\001\222(\f\363\013\367%\205v\020\273N\351\n8Nb\260\255\260\003\366-\240pNY\250\262U7w\307R\332\252l\341\304V(\005\030\224PP"
+	.string	"\203\270\335E\300\211V?T9\230\366\006\262\032\"\254\tY*\304K\274O`6@\264-p\007\342\365r\"i\r\333\230\262\306"
+	.ascii	"\250\275\220\310\006IKOxc"
+	.text
+	.section	.gnu.lto_.symbol_nodes.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`]\004=\022"
+	.string	"\306\032eG\360\222(\035\324\225\017S\252\326\245\250"
+	.string	"[\177e\325!\202Xx\255@\207\020\253j6\020\013\362\334\\ZX\bj\311\373\323\307\037*\233\310Z\341\271TF\346n\300\177\302\264Um\345[\353V\322\210\rYB\266$i\007W"
+	.string	"K"
+	.string	"Q"
+	.string	"Mb\352\022\344Q\303\"\203\244I\320\306L\013\214R\217\234\266^\024H-\362\025\013!&\214\364H\244E\243\366D\035\362\0324Y,j\"\324\003N\024\360\340#\007\250?\247\217I\346i\017\306\232\031dKm\262X*J@\330\020\276h=\3169'\327\035\006!\314\016\004 \374W\334\360\253\267a\003Q\3634Vy\031\257b\306\332\225\221Y\324H\270 #k\277\030\337b\374\212\361i\bcUJb\214\3429\253>\347\024\350\214\0029@\013H\365\311I\243L\332\204\352\357\324%\237sB\370\375\370\372\364\222\327\205\236\003\355z8C\205\376\033\247\330\005\224W\364\320 7\376*\351\036\266\300\200Bn\f\272\277\b\031\271\361c.\314\213\213\375\206\216pU P\007\365\"W\205\017\222\303\r(\202\272\262_\351\216*\310\336t#\005\215\344\360/"
+	.string	">\215\b\302\267^p\3658\347\234]\b\247D!\274\321\350\253\352qv\334\275b\207\273\372\263\270v\254x\035\346tx\365\256\003\b\022Y\207\037\324\207b\350\300!9Nap\025\320\004_%\331\023hqaCr,\262G\325\220iI\2167+9>\315\235\031\341\26210/\001a\250A$\221j&QI\245\\\f\360\002\251\241\316\001\021`\020\212y\311(LZ\244B\007F\273\277z3?c|\2362\362B\016\035d=Q\r\337\025\210\331$\037k90=\343l\217\b(\254a\327\016\361Z__1\030\300\007\346\203\336F\302\366f\332I\205\222^\002\321\300\007"
+	.ascii	"\255\230|\005\366\313@\204h]\337`\f\354R\256Rs\260\002\312\320"
+	.ascii	"k\001\204\267V\241Q4?T\376T\345\354\311D\226\323\366\220\333"
+	.ascii	"\022\345>\205\3513\327\236\013\274\243\t\245%\230\244\2340uV"
+	.ascii	"M.\354\021-\350c\316\355dSd\267\311\002\234K\350\240V\001"
+	.text
+	.section	.gnu.lto_.refs.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375 \031\311"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	"\001\001\002"
+	.string	"\002"
+	.string	"\003\002\002"
+	.string	"\006"
+	.string	""
+	.string	"\003\t"
+	.string	"\001\003\f"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.419ecd61f18e3dd1,"e",@progbits
+	.string	"(\265/\375`\225\024\345\\"
+	.ascii	"\352\224$!Q0RJ\032\016\372\372\273\246\252\273\357\272\373\253"
+	.ascii	"^\277\253\273CD\276?\036m\317e\236\345\3304Q\223uD\017DOkX\017"
+	.ascii	"P%\273\321\210!C\204\026U\005TYD\021U\021Y\004@\310\2353\027"
+	.ascii	"Aa\t\242,-53\377_l#\261\211\224)"
+	.string	"\260\001\364\001\023\002Yz\260h\300a\t\257Y8du=\004\341t\255\360b\260\263\302\213e\257|\255|\355\361\275]-\221\275t\203X!\276f[v\030\r\234w\354\352,\263\030\316n\344\232\365\330u#{v\017\330= \005B\212*\254\227~\002\262\261\364\206*1,NW\312NY.\024K\345+\266U~\203\\{=\223C\262\311\251\317\226\350\361\003*\f\335\213\242\267ww\213\"\f\214\251\226\250\322p\272\320\215\262\\7[\257\357\327F\217\243\\\033:u\3458\305\351\212-\321K\201\324\026|{3(\333\305[\376p\256#n\322\320\311i\261\326rm\327\277\353>\271\232\216\263[\331\335&D\2105\t\321\201\323=\261$\266.@W7pV\177\277\257\326\277X\233E\242\307tZ;\332\335=\313U\367\344\n\247_\267DO]\022\275\375\227\2678\376\365\200\350\"~\206 \352\373\331\201\273\275\361"
+	.ascii	"\376\255\333\004\256\3633\220\t\027\321\265\361\234\237Y\234"
+	.ascii	"`\003\252\234\030;\317\317&\242$|\347\347\235\377r[\343\337\r"
+	.ascii	"\202\307\371\031\207E\031\260\305 \205\001\376e\373\027\b\370"
+	.ascii	"/\004(\374K\301\tk\302\210\177\263\374\253@\212\"\365\337\257"
+	.ascii	"\177?\370\227\203\1773\370\267\202\177#\3707\306\277,\3765\340"
+	.ascii	"_\002\376\263\371\027\305\277&\376%\361o\317\2779\377\366\376"
+	.ascii	"M\377\375\377\271\377h\376\017\361_\314\177\016\376\277\375\367"
+	.ascii	"\362\237\355\177\332\377,\377\213\376\233\375\257\362\037\204"
+	.ascii	"\377B\374\217\376\037\373\017\366\237\306\377\256\377\n\374G"
+	.ascii	"\373\357swww\367\247:?/\350\347\231 dXZ\252\250\347\2524ivN\355"
+	.ascii	"\306\302\241A\311\223,r\337\271\224\215\313\355\rLO\215\311\216"
+	.ascii	"\211\240\371r-\232\005K\273\272\331A\026\2464\272n\247\005\036"
+	.ascii	"xB\025\206\013\0312;\204\332k\037\327fZ(?x\321%\246%f\276C\220"
+	.ascii	"Q\273`\305\035\341t\313\350H\201QaFU8\270\025\263\275\354vj\036"
+	.ascii	"\\\230\244'\272vr\372\021\341E\252lM\230\257\030\263\036\023"
+	.ascii	"\032\234\326\331N\026\325\0275'\352\272\355\227\345\372\331\267"
+	.ascii	"\036\03474G\242O\365\373\323\353\371ickB\303\214q\372U\333-\337"
+	.ascii	"5\256][\266\373tw\262\373\351\b\211\256\257\2579\272vb\376\374"
+	.ascii	"\333\205\214NwVw\247\330\271\353\"S\206\323\345\3621\"\302(\251"
+	.ascii	"\001\213\323\247Y3&\223fE\212\323\357P\317\177\257\221\314\356"
+	.ascii	"\006r\26363\251\323\333\233\335\237\177gy\213\300\377\264yf\272"
+	.ascii	"\227\236qj\223*\310\"\274\242\257\272\217#zm\346\022\032u\\F"
+	.ascii	"\351\322\034\2616\224\211\206\"\351\345\032\325L\235\315\275"
+	.ascii	"\366\2662\252\271\302ru2\227\253\363\350\323J\347\261{m\372,"
+	.ascii	"\243\310\343.\241Q\315%\324\331\034\321\312>6\024\t\245*\235"
+	.ascii	"\315e\232\263\351\263\204\"\233KeTs\204\322SJk\031\006Y\303\036"
+	.ascii	"\227\312^R2\202d\372\254-Wg\277uo\024\251\231\bt\033q2\337\220"
+	.ascii	"Cv,\271\266\224\234\202t\356\332\335(\224\222R\316V\256-\255"
+	.ascii	"\234\335VI\034\255\024\343\270\256\365\324\256\035\221\030\351"
+	.ascii	"\037H\335\003\364\332\255\324}\334^\353\356cw\373\230F\326\356"
+	.ascii	"\032|\226O%\245n\247\023Jm\344H\206\324\315Q\270\261\346\022"
+	.ascii	"*\345\374\221yA\237\335c=\356\263\337\242\230*\364\370\244\177"
+	.ascii	"\240Q\237\315\2463Z\322r\350\250|\351E\313!b\303\331\030N\177"
+	.ascii	"\301Y\034f6g\025\247d\317z~\250\233\301M\254\353\f\355b\257\233"
+	.ascii	"-\236\020/\2653\216r\366\342\201;sLrJ\265\205d\013\247\f\005"
+	.ascii	"\313\207\337\007^\267\253\231\002\320z\302\265\241\353\211I\372"
+	.ascii	"x\002q^\317\\_L.NZ\274\205T\205\005\345\2442\026g!\201\241\272"
+	.ascii	"\272\001\302\002'\b\"c\356\236uKx\340\224\235|\214r\213\353\b"
+	.ascii	"\247|\265mA\250%q\341\224\177\3303U\371\344\266u\323C\235:\357"
+	.ascii	"0\305V7Z\335\311\027k\362\255\227N?>\271\270$mM\316V9K\037\274"
+	.ascii	"~`\022\205\fM\216\tW\351p\221\241\315\022\247U\314\003?\377\237"
+	.ascii	"\3101\303t\327\244\372qr\306\220\230i\"\247>}SY\207\363\222\262"
+	.ascii	"\247\033\242\326\224\3748\2760\267\"O4\365i\230\312PP\234d\273"
+	.ascii	"\nHcJ\273\352v\372\271\021K\266\361\200\3039\311\rV\331:\204"
+	.ascii	"o\270\221\222\023S\205S\216b\251\345R\301Hv\3328iS\327\245~U"
+	.ascii	"\364\366nU\364\236Z\0359\3026\254yJ5i\303\362t\266\201\263\240"
+	.ascii	"^\224\252l\017bN\302\240\212\024ae\0310O5\20707\"\234>e\022!"
+	.ascii	"\302M"
+	.string	"R\354\222\236\350x\344\342\256\352\324p\020\016\302C\246|$=\321\371\346\344\222\234B\316C\314|\315\252\035\230i\315&7\265)\3418\307lQ\002rn\212\242\244\304Lv)\2568E\227\316L=e\306\222\210\3311\236g\334\222\243\325r\3113\214y\372p\200\363\302\344\244\363\f\352\227\032]\023N\331\307\222\245W\320\310\2327\004\ti\331\250>\235dS{\246KR\246\326\354TF2\222\225lXp\332\222p\365\340\344Y\271a\355\264d\301z`\254\240z\270\251j\266\215\032\356^\367\256N&\346\335\271\303hIS\026\266\365\374b\205\3235k\226\3156\263L\016IOW;\\X\274\234\330}\331\350\240%\235\216\234n\335\206\341\3101\211ks\2634H'\374J\370\241p\303\243\307H\304\300\b\204#\241\321\205\031\306\243\340\020\211\343P!\244\200(\370\002\321\360\005\035\"\342\260h\244A\302X\f\032\217"
+	.string	"8\216\026:\\\020\215r\3440\032\"\340\350H84\024\354\235\360+\001\b\205\033c0G\321\350\006P\307\r\243\210\025\303\032A \217#\027\216|\210\202F p\207\005\243\"\016\243\021\321w#(,Jm\020\205\300 \017 qh,\032\356\250\001\004\372\030\201B\276\035c\320\250\250\002"
+	.string	"`"
+	.string	"\205\340\023\364\243\021\003($,\252\021\034\026\203\"\244\200\001D\003\b\b#\350\347\023\364K\341B\260X\224`"
+	.ascii	"\032%\004x\321\302X\f\352h1C\004\032B@!\242 \b*f\210`CH$\032"
+	.ascii	"\036\021C\020\032\207\305\021L\034G\013\243!\002F!\221\215\035"
+	.ascii	"3\002\020\022\207\032\024\2056\202\302\013N\3340\022\207\305"
+	.ascii	"\016xv\250\377\271\221\016a\321\205\321\310\250\350\"g\310\270"
+	.ascii	"C\007\360\346C\303\242\220($R\037#\210\201 \241\026|\027\222"
+	.ascii	"\361B\306\213\336\205d\374~2\202~\352\203~<\343\321\260\b\030"
+	.ascii	"\344\341+\006q\f\245F`\320\317\b\204\001d$\016}\377\375&X\021"
+	.ascii	"\002\007\026\250C-\210\210C\033FCD!\260\005\243\032*\f\005\213"
+	.ascii	"j\270 \016\2039\\\f\025\217\\\264`\001\206\225\274\271+eHoe\254"
+	.ascii	"\225\025\245\277\364\231,%Q\234r\033{a\267s\033\357\270r[\317"
+	.ascii	"\036\300M\2464\265\351\261\355\\\n\025\243\206M\0271\035-B\316"
+	.ascii	"\200p\t\3531C\227\006\272f\245\262=5\361\262e\035"
+	.ascii	"\022\247\003\233\232W\017\252\251\016\214S6c3NS\217-\224\226"
+	.ascii	"\364\304W\316ig4\0364in\351\214\267\252\246\246\236p\312X8\213"
+	.ascii	"\017J\024\224\226^\025\013\236,K5YVzPB$\341\241;k\363\301\351"
+	.ascii	"\330\030\227\235\247\354''O_\027\231\017&d\347\262E\002\"\332"
+	.ascii	"\246\2474e\n\213\365\276\234e\266\350d|\221\202\206\312"
+	.string	"Yl\301\3444e-a\323%\032\345\260\355*@\013S\332\025O\334W\020;\260\007\201\261\250\2418\205\224D#\"\"\"\222$I\206\003a\005\204\030&)<\017\022`E)\023\"e\204jFFIAIRcY\003k\304\200E\266\271*\313\005\264\251\354\230\215\362\216\243\323\2632_[\217u\345\353X\226\350\254\313\246\362\324l\275r\215\225\275\344\365\224z\2131\312\343:\b\004\216\224\326\262\243\214\243\206+\026\303@Q\311\366\312\016\"\313\213hH-Fg\013\024S\035\003\355$\tD\243\312d\223\242\214\252u\3220P\223\323\222\344C\221\253EY\221\f\250N\277\003'b\245\027Y\221\345\304\240N\226N\224\377u\237\215\213\246\007R\341k,\227\363\t\225\001\351\257\006LH\321\2266j_\243\311E\0326rE\302\355%dP/\313u\222$a|\272\270\332\035Y\035\276\355\333\236\236\221^\204O\256\242"
+	.ascii	"\013aZD\252\037\304\217c\332iUb\244O)\004\323\304\207\331!\274"
+	.ascii	"J*\246\371@\035\310\333B\201X\254P\246\fT\351 \022C\240\255\355"
+	.ascii	"\273r\001\264BKp\003\351\327\222\211]\237_\252\311\032\350\240"
+	.ascii	"\324\250P\250?X0\364E9\274|\227C\025\324\025\222\363v\201\204"
+	.ascii	"\241\340\224\347\253t2\275|\3769\361P\251x\267\247\255N\302f"
+	.ascii	"\275\324\f\217\206\004\300\346\213\223\031!\177\005O\305\231"
+	.ascii	"_\316+\257\220\272&\364\274\372\252\227\245\t\3540o\376\345\320"
+	.ascii	"9\371\3034\210[\f\224s09\334!\004\243\265\212\370\214\342L\217"
+	.ascii	"\006\026\366\333\351Q\fK\265$\205\327\235A\341\177\203+\270O"
+	.ascii	"\246\375\302.\251\2474\"\210\277\226"
+	.string	"\250S\006\243\367\025\264[\212!\034\020up\315\372&\371G{\033\\-7\215\354I\216u\233\210*h\221'\3261\301\300X%g\205\002\203\201\235{\310\037\t\177\330\243(\341\\\263\023A(P\304\thHD\346\340\340\256\316\200\334\035\241\366\232z\222M\351\":\231\216\247\232\342H?JH\037\032r{\332\344`z\352\254jp\210C\277\225\357\343R\255\276\034\222\241\202\355\r\212]\225U\266\376o\247\3710\016q%k\211\363\257qH\307^C\321I\354%)\224\2408\272'\002\242.\331i{\310q\177\252\356\334O\314W\024l\033\223\2641Gn8-\"\3457\323\311&\272\205Y\030o4)6\253\371\tob\367K\214-\367k\277\252=\226K\247\247\230\332\336\212\271\be\303\204\222\205\347\373\336\361,\272\023\020\311g\314d\360\217S\306\005\277O\033\310\337\257\267\226\234\350_Zn\267\366\350\364\306\306"
+	.string	"\303\0358\266\237\215\334\327_\212sGy\340\n\373\364\216=\312\336\211\201%\203\357|\361\253x\205\323\266\363\214\255q\374\226V\270\007\363\\\267\003\266O\223:y\346\356\304\233\201\027\370\351\237\272\261!\371\323\305U\341\217\\\306\373\323\335~\f~"
+	.ascii	"\377o\260\335\003\376\025\222\275:\331_\333`\020\007\177N^\366"
+	.ascii	"\306\353\016\336V\363\234\265\235\352W}j\265\003\362l_\353\370"
+	.ascii	"\262\307|\276\274\330\311\035\334'a\247j\017\242\245\360P\315"
+	.ascii	"\033\267\223l\001\033jl\025'\301.$\375\316\331E.\325\233\233"
+	.ascii	"\013K\025"
+	.text
+	.section	.gnu.lto_.symtab.419ecd61f18e3dd1,"e",@progbits
+	.string	"blackboxPrintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361"
+	.string	""
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"blackboxWriteS16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"blackboxWriteTag2_3SVariable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"blackboxWriteU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"zigzagEncode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.419ecd61f18e3dd1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
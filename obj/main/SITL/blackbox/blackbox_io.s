@@ -0,0 +1,1078 @@
+	.file	"blackbox_io.c"
+	.section	.gnu.lto_.profile.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"]\007"
+	.string	"$\013\027\001"
+	.string	"\026"
+	.string	"\226\223\225\252\r\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\376\201\211\336\n\006\001\002\001\003\240\342\234\212\n\004\342\326\223\246\n\004\002\002\003\005\311\231\247\372\017"
+	.string	"\006\360\340\271\300\013\007\373\327\252b\004\002\004\b\274\205\242\255\006"
+	.string	"\t\222\345\311\225\006\002\002\005\002\006\013\233\312\344\255\f\022\002\005\002\007\002\002\002\b\002\t\002\007\005\002\005\002\005\002\005\r\017\214\371\233\377\006\002\020\307\276\344\257\003"
+	.string	"\021\330\370\241\354\t"
+	.string	"\022\222\252\354\340\007"
+	.string	"\023\246\227\274\312\003\004\024\025\266\310\363\237\013\n\002\n\026\027\365\210\347\377\b\006\030\327\316\273\360\002\004\002\005\002\006"
+	.string	"\027"
+	.string	"G\303\240&@\253"
+	.string	"\020\246\205{\363A)\204"
+	.ascii	"\210\345\314\0218\002C\205\243\032\246\016Gp#Xtfa\001.\313\r"
+	.ascii	"Em\bm\301)\233;\020M;\n\340\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375 \202-\003"
+	.string	"\364\003v"
+	.string	"\022"
+	.string	""
+	.string	"\003"
+	.string	"\002\002"
+	.string	"\001\004\001\003\005"
+	.string	""
+	.string	"\006\001\001\002\007\001\003"
+	.string	"\001\b"
+	.string	"\001\t\013"
+	.string	"\003"
+	.string	""
+	.string	"\017\020"
+	.string	"\003\021\001\003\022"
+	.string	"\003\023"
+	.string	"\003\024"
+	.string	"\003\025\027\030"
+	.string	"\003\001\001"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\017"
+	.ascii	"=C\234\212\313U\244\242\202T\025\003\250\030Z\205\001\201.\027"
+	.ascii	"n\332\210i\343\305\360N\3039{6\200\005"
+	.text
+	.section	.gnu.lto_.inline.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`1\002E\n"
+	.string	"\322\316570q\323\030\200\303\252jO.\355\3351\356\277\275\367\357~\233\351P\364o\236y<\360Y\244\006\006\304D\034\006\23000 \230\022\025#\232{\274\330n\"\214\265-w\n\257\216V\027\242\251-\032\037\322\334"
+	.string	"\224\252\r\224\325\301\004\007\013\350\271\340\323\016Q\004M\347\223\"\030!&\316\236NJ\302\342C\363T\306\244\244\302&\340\0068%''\230k\201\377.\274~.\213\031)\245\024N\246\032P\302\333Re\264\222\202\235A\354.\370r,N\351\240/\250\020\350A3(P$\363\353.\274\0135\0367\037`Y3\025+\217m\200\251\037=\231m\375kqSOI\273\253\351\307\006%\201|B\333z\027\306\177\312\177]\0316\277\240\273\273\252\037?\351\262\273\327sK\2040 \260\"\221\242\364^lec\264p|?\305\026\270\206}\252"
+	.ascii	"\320Lp\336\311\033\261k\255\023\362\034I&\t\"\213\304\300\216"
+	.ascii	"{\225\r!\332\240?\002\017v|t\320\333z\214\344\365\\\003\027\253"
+	.ascii	"<\321\265\351\006#\032\001X0\306\274\030`Q\341\332b\\\260/\306"
+	.ascii	"\307\276\232\006\322\002\337\307\325>\030+5K8\317p!\305\007\335"
+	.ascii	"Qp7"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`\270"
+	.string	"\315\005"
+	.string	"\022\211\032\"\240'\351\377\217\375\240\375\365\377\357\r\\C,"
+	.string	" \212\022\343\264{\373\273\331\226;\355\377\376\273I\231\002\257\224uI \016o\370\302?N\237t\236\3607\020\266\214nFW\266\345\342z\263\326ZT\260\357\230\f\305\274\362\017^\300E\350H\350J&0\027M\271g\343\272D\211G\256\006X\252\022\322V\265i\332\304\357\377\314G\037"
+	.string	"\0133\252X\327\321 \f%\212 \r\262l\224\035\362\345\224L,\244\230 J\344\317\002\231\001P\245\312\232"
+	.ascii	"p\215\302\020\360p/\2605\260\267(\2410D\250\260\304_\311\354"
+	.ascii	"\002\240\0315\3601\250\332\310\023\021\232r\211)@\001\334"
+	.text
+	.section	.gnu.lto_.pureconst.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\230\004\002\230\004\004\205\004\005\230\004\006\230\004\007"
+	.ascii	"\271\004\b\200\004\t\230\004\013\231\004\017\230\004\020\200"
+	.ascii	"\004\021\200\004\022\200\004\023\204\004\024\200\004\025\230"
+	.ascii	"\004\027\231\004\030\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\205\004"
+	.string	"\242\004\021\035\2605\303\001\f\305\361P,)MR\\\222\024\0035\262\367\356!\234\310.i{')\003<0x"
+	.ascii	"\222\350u9\212\272Tnv\221\243\315&\237\202\356\022\223M\323 "
+	.ascii	"\264K\226\004E]\227\353?\227\006\313\004# \300\002\n\312z\023"
+	.ascii	"\001\246\023,\324R,\034V\202\343\bF \236\036\226!\230\016\326"
+	.ascii	"\222\2028\316\300\302\022n\355\344\r@2E\\\007\0167nX\335j\207"
+	.ascii	"\311$f`A\303\353\310G\307*:\007^\215\235\030\003.\346\020"
+	.text
+	.section	.gnu.lto_.lto.cd385431779b1b19,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxOpen.38.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"\365\n"
+	.string	"\026\324LD\020\311*\035"
+	.string	"\216\300\232V\234B\347y\r'\254\254H\234\206\026P\202\037\270[]\001\321M1\214i\264\036\026\343+[\rjPM\236\266\271\253:Z*\2476"
+	.string	"\250\322\001)\321!OJ\236\033#d\357\235R8"
+	.string	"9"
+	.string	"8"
+	.string	"\227\tPI`aw;\n\340\341+\235\241\377\3307\342\250z\2159\255\023\264\007\005\036FV\365\310\314,x\354se\\\315\331`\261\273\236\342\bso\267\255a{\303\376\fw\345\270Z\004\t\b\273.\0310l\2711 p\330o\3771s\374\003G\020\036\226\372\266^6\"m@m\227\244\370\346\n\3157\223\217\340\276i\016\301}shS8\031`\003\363\242\035\0248(Ys\224\3002\243\364\345\024Wi\247\305\200l\002k^\3606\177\022\356{7\340l\223\223y\261\322\2565+S\250\312&U\223\276\354\327\335]S\227}X\250\317\3538\201\034#\323\005\306\210\364\201>\300\216E\037\257\344Q\342\205@D\240\220Pg*\201D:\321\007v\037\217\275\023\351\353P\236\367u\034r_\227\2722*\224(tU5\263R{\004\f\017"
+	.ascii	"8\263\002K\275\231\320\b4\260\327[c\330\333h[@\270\3238\340B"
+	.ascii	"\227\321_]\026\260E\\\346\251\232\234\242\251="
+	.text
+	.section	.gnu.lto_blackboxWrite.39.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"]\b"
+	.string	"\026\020;8@\305(\035\365\311\013\2614Z*\255\277\271@\303\336\361nyL\006\023\370\247z\322"
+	.string	"\002\376\215\207\t*M-I\340e\340\f\363\t /\271\357J\226\355\332\361\t\2212\245("
+	.string	"+"
+	.string	"*"
+	.string	"\307\334\331,\217 \373\023\022\023\nkw\241~\274{v\376K\236\371N\244g\300\302\356:\277\223\306\255\267]`;\301\266*(\373\251\377\322tf\372\027\205\310j\021X\331\315h\001\330\025\246\022\261}\215\355L\233\203\320=ua\335\355H\251\354F\003\037`\002\266D(\377y"
+	.string	"CI\366M\036-\374\020\213F\371\357\230?\272\034K\315l\\z\345p\244\230\002x\331\262c)\325\303\376\265\032\036\021(\243\300\254m\266OC\305\326q\3202P\007B|\262\007\250q!\270!\360\026\341\341\340\304\266qP\023\275+\212ad\345i\311\230\274\246\006\n"
+	.ascii	"`\2517\023\260\2063\252\365\016\202i\227k\270\005&<\225\032\007"
+	.ascii	"\356\334\242\235O"
+	.text
+	.section	.gnu.lto_blackboxWriteString.40.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`\230\0015\020"
+	.string	"\246\036mG\360\320&\035\362\277\030r2\345~V\232\367t\016\026#\212\037\217\205\222[\233\314\363\241\316\305Ei\302\333Q\353\323\324c\263\021\370\006\334\007\265tItq\242\333j\272G\021\307\313\002/H\371lmK\006\331[\312\224\002W"
+	.string	"Y"
+	.string	"V"
+	.string	"\016\267\227\270\211\225\335\023\303\032\36021\\`@sN\356\343\003\264\313x\001\332\345zp\324\325e\\]\371\245\017\261\017d]\306\016\327\013\b\017\320\025KA2\236\303\256/\320\323(\"\346{\330#N\315\354\003c\256\035\r\346\234\326\017\314pk\267=\3016\003\3734\002\017\377\220\246\251\245T\307\250\336U\353s\356\003\200"
+	.ascii	"\003d\203@l\316\227\031\216\351#yB<\347\327Y\371(\016\363\310"
+	.ascii	"\327q\317\306\202\331R\310\314\220\3159\025\344\260|\266\300"
+	.ascii	"\204^\336\217l\316\360\300\245\023l\227j\037\347'V\017/<\300"
+	.ascii	"\2343,\\\314\031\"p\310v\031\376\n\324i\273\361Y4\0037^\033\342"
+	.ascii	"\234s\306\245\261\035rmI\373\300\246E\313\bOg\036\251\356\256"
+	.ascii	"m\202\242\377\374\341Z\226\375\330UT\360o\334\255\350\277K\177"
+	.ascii	"eC\032\342\352.\260\211\271\344h\351lc0\\\340.\215\035zZ\252"
+	.ascii	"\t\222ygl\322unQ\024T\247\024\222\023-\325\251l\3526\201t%\022"
+	.ascii	",t#&&\221\223\021.\245D\004\2053\241R\034H\001w*$(N\325u(n\024"
+	.ascii	"\266\036\243\266\027\255\307\267\343\323Z\317rE\253\260\320~"
+	.ascii	"\345F\260\221\321B\302\323\231\\\032\277\303\013\016KZ\325N\r"
+	.ascii	"\r\255\266/\373\244\305u\360\203A\203\034  `\002\221\202\307"
+	.ascii	"\003\240\365<\005\372\230\376\366\034l\240\355\261BC5>\304*^"
+	.ascii	"\350\301\002\005\240\311|4\034\202BGo\023\225\034qxbQX\302\""
+	.ascii	"\024\016XU\rB\030\200)\265\240\341\337\245v\340\023\3531\230"
+	.ascii	"\034\026\016\234\210\351\nO"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlush.41.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375 \310-\005"
+	.string	"\202\t#*pm:\240}C\021\340!\210Z\271\004k\252$r\313jC\234\375\025\030\034C\337V\372\377\326o\260\214\312\252\206\263Q\357-S\246T\275\026\224j5h\345\260&\344\252\036\223b\222I\025\\#\flNj\305\346\364i+=\202&7\373\333\242\314\330\013\370\177K\317\216\212\207\243\303\347\277\224H\017\005@\034\333;9\263E\373m\276`\307\002\206\377\247\324l\2661\363\256g\007\\W\331(H\374w\344:\314Z\256m\203m\204\355+\b"
+	.ascii	"`\25173\340\234\031\002\276\274.\343_\306\005\227n\321\316'"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.42.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"E\n"
+	.string	"v\023G< \345*\035\340!P\202T\331\021\204\001\020\004\225\362\007\346~^g\261B73\217\346\f\333\260\225\002W\232\b\264\240;\004\202\300 \3422pN\357(\030\b'\260=G\237l)e\n6"
+	.string	"3"
+	.string	"7"
+	.string	"\241\216\262\227\306ZZ(\271\356q\362\210\206*y\303+GL\251$P\226\001\272\226\313'\256\344\202F\016D@d\355j<\335\375u\211\036zO\377;\374O\370u \327SF\275e\235\351\322>`!\264\232jw\377\270Z\216\375*\233a\377\367\362{\336\375jH\267\\L\307\326\375\332\001\350\233\267R\362\037\365\177W`@=\377\b\\u13\247`6\262\356\350n\204\217\345\226\332"
+	.string	"\307\251\324D\230c\254\006\231\345\202\223\027\326\352\376\223\324\304\264\351f5\\iZ\273\270\222\250w\214\323\252K\275\017u@\021D\006\b\222\b}&@\223B\364\031\315P\3114;\007\007+\"J\323\002\004K\363\033U\312\260\353L\037p\034\266\224\275\206\2313\263\344\215\377\222\357Q\361Jr6\017"
+	.ascii	"`\325{B\300z:\236a\366\322\252\025_@\311\260V\321\"\2410\"\272"
+	.ascii	"\206\263\217x`\b2\356\\K\323oa\226\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceOpen.43.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`\307\005\305&"
+	.string	"\nG\250\017Gp\234U:\353C$\365\304\325\262\372\033\027\213Ih{\003"
+	.string	"\254E5\325W\336\343\224\223\367\311\006X\321\006LT6\236\275\253U\220A\224{\317\320\250y\177&\213M\036K\225i\3621\003\216"
+	.string	"\225\r\244mB\366N2\350"
+	.string	"\322"
+	.string	"\346"
+	.string	"\314~\327\2610\335\213\306[a\221\006eu\025B\251>\227\257\324\030beP\237~\353\\LW.\251ME\265K\263\b\236\266U>x\332\023\324\247\b> ?E\237\3137\272\327\247\357f\352^\233\202\005\246f\257\274\332q\253 C,}\332V\251\303Vg\217\273\331\326\032M\235\345\024\305\227\3557\035\027"
+	.string	"+G\236)(\344oY\276\330jNg\204a\316)\250\343\327 (\202\332\331\024\201|=\001\223\342\361\322f\032\230G\301\270\372d9\247\240\204\\eR\214B\021\264m{6\305\037w\346\343\031u\200\f\343\2013\n\321\001k\250\350\fo\372\037\362(\n!\352K\fgtBsM(Tg\376>\031\203\027\2436?C7\253\021\210Vp\352s\304\031\203\367\3164\264m\333\227h\204z\003x\367\323\356N\352N=\004\314b\222\024'\217\245H\271\023\006=\215\234\303DB\232\b\270o\217\"w\247PqO\314\3413\177%:\300\214\005q\223\035\365\252-\266m\333"
+	.string	"\2275\326t\001u\363\313\226\024\306\311\306\037\312\307AK9\301\353\247\273W\234\313Nm\333\340\205\276\226o)\352\037y\332F/\356\211O\373/\362\323\343W\371\325:\226!\265\266~\367\331\255\004^\234\354>\332\342\252\356\276=\264\336\026Ro\027\370\225w\320\275\336\271\276\215\273\362}\313\267m\353\355U\275]So\323\324\333j\355\366\214v;\253\267\323|\033\235\335\306\371\366\0170\250B\036\255\216\270\251lw<\377\264c)\230\222+\377+\277\327q\367\373Z\377\272\361,\315\253\252Bf\265m\373\254\276\225/\0374\234T\376C\356\323y\235\017V,\026V~z[>\245\224\375\356\323\367,:\361,h\223\305\207\212\223\275D$\367\227\362\313\234:\322\373\245|\303OD\271"
+	.ascii	"P\f\300\363\371,;Q\016\302\005p_!\022x\237=\303}7\177\023\203"
+	.ascii	"5\302\"a\221\344\247x\f\221\214\350\336\360=\273$\247X\367>\333"
+	.ascii	"$\037\3143\356f\237\260Q\356\2113\214\266@\330)W\303V9pu!N\306"
+	.ascii	"\263%\034\347\f'uB\200:2\256j\034\216\366\254VN\361\247\232\304"
+	.ascii	"\303X-\f\3753G\303r\241\0338d\016\371i\212gTbN0\024\007a,6\f"
+	.ascii	"\324\035^\346\303\205~\230\023 \324\266mQL\323\023\346\334\302"
+	.ascii	"\270?\346dB\364\217\264\210\021#\270\020\311\b\334\203y\016w"
+	.ascii	"\2270qO\304\370\036\341\323:\3618\341&f\rC\302\f\030\276\035"
+	.ascii	"\222\216\327CB\352\025\031xq\344\202\327\343P\263a\324\202\007"
+	.ascii	"\302\310\267#\321\202\306\216\305m\006\257w\344K\032\341S\352"
+	.ascii	"%\255]$\241w\264\302F\217E\214\242\235\f\026:\336\321\016IW\244"
+	.ascii	"4C'AA\367\222\214\224t\276^OI\267\376\216\266\270\252\003`\345"
+	.ascii	"\030z\271\205h\"azA\373l\306\341'\334\032~\030\210\303\311\307"
+	.ascii	"\3103<\324\200\207\327\262\311\024\003\274\341d\247 \262\256"
+	.ascii	"8\205\260\326\312\367\230\374\257\323\244\314\214\315\361B\203"
+	.ascii	"p!\374\324m\303|N$\023\302\266\b]]\313&\323\2666\245\334\254"
+	.ascii	"D\271\206\207zp-\323\004\257\037\002]\2540k8\331\017\276\342"
+	.ascii	"\177\375F\365p\002DO\03395\274\342\274g\030\350WF\3035,\204E"
+	.ascii	"H\005xvHV1\r_\310\004\370<'c\207P\261\311$\266\340\244\313\031"
+	.ascii	"\365\273O\251\266\001\016\3148\026f\250Q\034$\221Q\210134\"\305"
+	.ascii	"\211\306@\002B\0202\274\003\021\2609DU\223,k\213\322\264\202"
+	.ascii	"\004R\352C\211\267\020\325\354\215\340#\357>\300\273\271\333"
+	.ascii	"\022+i\371?\f\343V\0268Mo\003\020\316\00527\220E\225=3\371\325"
+	.ascii	"\337%H\273\333Q\272\341\361U\251\tg\366\035SA\021G\027/V\230"
+	.ascii	"\337\353\324<\335\3565\210\233%\300\311\024\300$\331D\245\247"
+	.ascii	"\036i'\356)\231\007\266\323\354\025a{\202~\030\352 q\304\334"
+	.ascii	"\232K\350V \263\224\277C!\007'{\370X\212R\250\024\035\001L\231"
+	.ascii	"\263\266\204HX\230\361U\013+((\263E\037\310Z\201+\221\302\013"
+	.ascii	"\314\272\031\212<\3555\356\2744\260\256\267\267\2110Cz\t\r\202"
+	.ascii	"A\340\214\322\325\rWr+\006\025\327x\311\244lAL\262y\030I\304"
+	.ascii	"\323\207\305_\025"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.44.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\375\t"
+	.string	"\366QD= \345*\035\300#\245\370\021\001\313\030\220A\004\206Z\236N\321Y\256\2545"
+	.string	"\260\220\237\276|\373d\243\002\3570A-\251\335B\020\030\200|\244\246\243\252\bc~\350z\021|#D\356\224\0021"
+	.string	"2"
+	.string	"1"
+	.string	"\345\356~:\362\323;\235'\377(\337\210c\370\316\340\332\r\334V6\316\230\352\024<\312\020\202Q5\247\200\303\356z\212\343\307\355\335v\203\355\004\373\005\001\246\314\275+\203\314&2\243\241f\316\256\245\246\302\354w\253/\373\323\367~\322*\005@\260\354\262r\003\226\364^Hl\237\343\223\r\340\265\330\276\205\265Z\t\242UCMl[\273\353\351\224\220\341\304\031\306\205\346R\205\351\0172\327\216J\214j\336l\227\236\242\241\331U-\370\263\3236|\331=w\230\346\305{~\026}\300Q\004\007\030\232\020\201(B\237\305\bT\361\211H\245\357\203`\360B\202\364e\200 \351\343\324P\357V_\017 $JS\256\365\334\204,\003\204\023\327m\246\rb\314\007\020"
+	.ascii	"`\2517\023\272\202\002\263\370*[\221\037\314\262Y\333g\262\250"
+	.ascii	"\242\020\006\376p\217k\242{\b\371e\bq\351b\266\363\026f\031"
+	.text
+	.section	.gnu.lto_blackboxDeviceBeginLog.45.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375 \317\335\005"
+	.string	"\004\nl"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\243\347\367#\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\276\257\001\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\377{\361\370\220\373\001\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\203\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001"
+	.string	"\244\003\001\202\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\t"
+	.ascii	"`\325\263B\300<\207h\025\274kx^\304`B\344p\347^\355|\002"
+	.text
+	.section	.gnu.lto_blackboxDeviceEndLog.46.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375 \364\315\006"
+	.string	"RL/5Po\322\030 \254\321So\300}(\334D\327f\353g\363\\\263\307\301C\355k\351\243\265\207\213:\301\016\3013\313\250K\021\354\327\341\023Mb\370\240F\310\3362\005\017\260\301\203Y\237N\024\370\332@\314\241\002r .+\202\363<\230%\361\256H\3616\005\303\211N|\037\b\343\323\314\220\272\322*3\004!'\372)j\016\344\225ZW\372\226\341\360\310\\,TvG10\273R\241\230~\320k\376\326\364$\007\364%;\245\354\316\203\021\002\264\372OP"
+	.string	"-u\212\214\324\324\222Q\222\355\316\347BTj\223\253\216(E\322q\362\301bB\272\320\006\300\260\2737\r\322\206\356\3647\370\027~\214\t"
+	.ascii	"`\325\213C\300<\207h\025\274kxy\3048CH\341y\033\326N="
+	.text
+	.section	.gnu.lto_isBlackboxDeviceFull.47.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375 \307e\005"
+	.string	"B\311#-pe\322\001J\257\337u\375\277\236\361\2363\366\207\004\354\025\006}\273\265\037\366\3054\334\n\311\320\177}\336\213\232\266]\360\311\002\241-e\n\307\254\2315*S>\260K\2231\222]\220\210m\223h!>%\216-R\346\334bU/K\007\f\273\277v\f?\377\006\032z~\226"
+	.string	"\336\346\333\314\251\333\013H\265IP\022\375\347\376\352\212\005w\2725\344\031F\035\f\t\325]#\004-]\246\337\302gY&0\272\373\254\3718{\270\377\017\377\023\377\265\n"
+	.ascii	"`\251'3 \0306*lV\341\270\206{E\f\"D\016w\356\266\305\t"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceWorking.48.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\235\013"
+	.string	"\246\025PA Q\224\016<0\241\341\240M2\276qJ~r\020\262w\031\270\262\210\345\016( \304D\371s_}\022\213k\334gWonk\fd\021\bB\221\005\2055\240\351@\240\254\313\r\246Edo)S\n@"
+	.string	"7"
+	.string	"@"
+	.string	"\332?\021\223"
+	.string	"\022\024$\0238v\277KA\\;\324\324|\321\341Q\207'\236IjF\212\356\343\n\007\304\370`\243\322q\020\001\b\214\017"
+	.string	"\335(\323\343\262\273\316R\347\341\216\267\355\300v\002\373\r\002\371\322\243\377\261\036\257G==\031/J\266\\\331\037\227z\262\017WCl\247\243\323\252\351\314\364-\314\205\211C\367\r-vM+\035\253\212+D\330\016\331\025+X\020r\334S/\001\362G\274\341p\254\307T\f\236I\016o\313\325\r\212\310v\330\335\003\230\247\022\345\216\207(\201\250TO\372\002\326\225@\212\306(Olg'A\201\262;b\340\217x\211\307\037y\264\205O\306,\231\346\301\205,\263\3010\0212\227\004\r\206sa\035\317e1\340l\002\204\316U!\313:W\345\333\016WC\234\201\244\306\t\025\351k\326Q\017\240QU5\250/\233rPO\006Y\251QOb\021\022"
+	.ascii	"`\325\213#\364\245\215VG(,[\2625\206\212Z/\r\251\270\005R6u\212"
+	.ascii	"\213\202\303\264\350B.\210Yi\203\345q\315Q\245CQ\253\240"
+	.text
+	.section	.gnu.lto_blackboxGetLogNumber.49.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375 \334-\006"
+	.string	"\224\nz"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\337\217\203G\001\275\001\001"
+	.string	"\177\002\001\177\001\247\003\005\001\006\023\001\004\005\001\006\025\001 /\300\200\200\370\305\207\356\2618\221\202\205H("
+	.string	"\177\274\001\273\001"
+	.string	"\013"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\377\216\001\221\214\277\f\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006(\001\200\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\n"
+	.ascii	"`\251'3 \030>*lV\001\271\206\267F\214,D\036\356\212\251\235d"
+	.text
+	.section	.gnu.lto_blackboxReplenishHeaderBudget.50.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`\013\002\265\022"
+	.string	"\306\244\200I\320\322(\035RT6X8)\264\263\233\\\025\340k\273a\201\342\t\242\307\353\315\332\r\026\220"
+	.string	"\207\002Y\200\250O\323{C\354\231\350\017\nl\227o\026\fPo\006\037r\004\006F"
+	.string	"=\320/W\344a(\254\255\221M\244L)j"
+	.string	"b"
+	.string	"m"
+	.string	"\227\377\216E?\347:\261\353^>g\346?$\345@\360\230s\222\\z\301\351r\344\003\302K\360\002\302K\307\354\035\337\335\314\002\271\032\255\3477\347Tm\212\307\016\256\306|\2451\032}?6\230\203\3379\330\202\246\307\363\375\330F|A\224\022\r\207h\033A\023\017?\023)\333L\325\364`\316i\255\331fny\333\020l;\260uC\265K\337%\274\374\232\206z.p::\231.\331\273Q\327\306>8\347\234\336\032[\252SR-r\236\033%^w\233\244:\224j\251j\020T\357\252U\325\017`\300h\274\021#'\263\276\335\f\261\364c\"I\"\026\347\371uW\373\366a\370<\036\027\201s\306\224\221(\341\225\370\345\374\032\234.\355\357l1\033r\003W\356iA\036t!\n\025V\253=\357\362h\b(\007\247s\003\327f\305\325#Z\020"
+	.ascii	"\252k\263Z"
+	.string	"\372\332\356\310la\354\323x\257\203\217c\013.Wx\251;\201\246\367\342&\323\245\323\315\0241\347T\240\202C\202Q \366\t\351P\354\332x\177 \374\022\340\351\230\251\222\355\225\373\260\234\346\2341\360{.\343\345\343\\:\203\213>)+m\261PZ\"\264Z0\225\020\263J^\256\025\207W\312\n\013\345B\212\n\203\013\205E\305\202\271\250J\020\370\325\322\202\2514\274^0\225\270\223\035\234[c\223\0254\037%\371qr7Z\320\212kZ\231S\216\036H\262\035\235Z\033\337\371O\250\320y\027\205\"\233\332\357\236@\306\007jM+\262/@1I\243.9\\\271\250])\212\301\215D\257\361\"\341\344$\274\f\003  `\2021\223r\036`\365\214\b\215Q\242\225,\320\340FqA}[\305q\320\371\205[\234G\263\214\270\242\t\210!Y\346ZT\347\271\366\330^\007']V\2024%\351\261\300\330\223q\362"
+	.ascii	"\202Hw\352k\252o#r[D3\213\255+\022\016\024"
+	.text
+	.section	.gnu.lto_blackboxDeviceBufferFillPercent.51.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`\317\002\315\027"
+	.string	"6/\245G\260XQ:p\023\235\370t\260\335\004\0348W\220q\261\254\242\221,\342Yq\301\377\023\244\031\347\275g\252Q\216\021E\026\005+4\244<\355\022gO\177\312\027\212\007\237$\t=\363\214\033\206P\313l4B\366\336r\247\024\226"
+	.string	"~"
+	.string	"\227"
+	.string	"\367\231\325\013\222\325\310\005^\222\245\n\341\247/\344LBo\nzuQ\257\202\fOI\230Z\253\203OC\b?\021|"
+	.string	"\375\224\327\241\237\216 A\310C\005R\020\211Q\300;\202#r\246\326\236km|\350 \235r\343\220Ot\020\254%U\311\351b\234JW\213$8pt7\t"
+	.ascii	"\314\016'3\214q)\037\31082\205\243K!u\252z\320\270\357\321Hg"
+	.ascii	"\213+\007X\241\321\205\245\253\311\006;*/pt\266\030A\013\265"
+	.ascii	"V\307\234\316\305\035\3366\n\333\032\354\350%\023\374\250\027"
+	.ascii	"\t\341+}Z6\213\317}\3723\372\371\275\357\013\2340\361\261cj*"
+	.ascii	"\212?\273W\213\213d\177\177\277\337\317[\303vt\2007\3359\357"
+	.ascii	"\335-G\337\320h\026\215\266\241\321+0:\244\321 \030M\301\350"
+	.ascii	"I\243\345\214^\031}\035\003Q\265+P<$[\325\253,~i*\325|\202\343"
+	.ascii	"M\177\357\321\276\377t(\233e\023w\362\372\240(\355\204\324ZY"
+	.ascii	"\237\266\t\233\365y[\310\037\022\255ZR\225\333RM\212\023\f\035"
+	.ascii	"4\210\266\266\300\212\237\2251W\246\302\315\3318% \356\332\031"
+	.ascii	"6\304\347\302\215Z\252\202P\331\226\310t[\3732\2705\255\363\320"
+	.ascii	"\271t\347\324mW3\2077\341\231\340K\001\275\302Z\353\\\240\243"
+	.ascii	"/?|\346H\214\323\\\244\257\r&.L\344\"\271\004\335\245]\311\227"
+	.ascii	"\224\360\225\f\213\305\350\347.\205\243.?d\024\305\237\277\204"
+	.ascii	"I\265E\255\225\301\207\035\025QT\363\033\271\035\325.\222\367"
+	.ascii	"\007\350\227\300\323\026[Dc\373\303\215\364\204\265\332\002\006"
+	.ascii	"\261\363\003\202\304K\346\0321\223\311f0\003\261\023=?2\006{"
+	.ascii	"\371`\210\305h\036V\206\355\314zx\200f\035B\300^\":\270F\364"
+	.ascii	"\274d.\030\355\307\265\223\3003\237\030\315Eb6\243\271X\275\242"
+	.ascii	"\313\2725\354\303\303\b'EWK\274)8)\351\017\321\2335\262}\263"
+	.ascii	"\266P\2645Yk\255 \270\001\366\276K\0373\210<U\025qp\271\340:"
+	.ascii	"\336\314\034\312Y+\367P\227@\224\316\344\300E\221\251\255\315"
+	.ascii	"\262\366Yn@\260\334Q\350jmv.\271\351\250\305\237s\266\265\253"
+	.ascii	"\r' @\002\204\310Y\017\252L\003\255\227\243\320\031\305A\346"
+	.ascii	"\r\032\234'\252\220C3\013\203M\232\320\226\275W,\366`xvB\261"
+	.ascii	"\030?\034\327n$\257\205\356@\250C\331\331\342\363\001ueh\356"
+	.ascii	"\354\245\236J\r\364_\253*\341\202\206C\261\003\211\030Y\234Y"
+	.ascii	"\266\"\330H\tu2\232\030}bT\314\230\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.52.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`)\001\r\016"
+	.string	"f[bE\360\260(\035X\030n%\266:\235*\231\034\207\235\305)\255*\213\003*\236\027\265\241\265\027\022\267]M\375\366\277\002\230\353\250Z\266LK\377U\016\321\206h\217\314\030\375\301\207\205\0130\177\026\rn6\356\275\245L)P"
+	.string	"I"
+	.string	"Q"
+	.string	"\fB\210\270\200\223c\227\266\211<\024\017\337\007\304C\355\360\324\341\323L\371 \235\3520\364\367\n\3040\310"
+	.string	"u\255'\002\003\207\006\247K\347J}\thb\310"
+	.ascii	"\350X/T\253\251\361\331\263\245"
+	.string	"se~\224\354\256\363\325e\270\343m;\260Mb?&\260U\366\3304Vj\314\376\333\335\265r\260/\373#L?\247\365\245S\323\377@\201\275\270t\377\240b\367\245\207\307\356\300\026 l\257\330 \333\231\227\251<\001\333\252\201\255\330]\005^\3609\264\355\2178\211\025\247\032\270V1\001&\230\035U\366xl\246\226\363\364\004bj\310\r\rCx\212\322g\267E\342\2438\216\311\2679\364\t\307\305\303T\0133::d\311\342Fm\203j\314Q\257\242\033\235V\356\260o\342'T|\033O@\345_\207>*\036^?\373\001\033.f\320\224\b(RJ\005\021\364h\204+=\240\300\211L#\223\b\242\r\245dr\262\215N\250m\304\2009\t\244\323\226\302q\247\rD[\375\275\247!,/x4\237\212\237\3752,9\262\364SQ\265E]\262R\026\f\220Q\355\021)\377z\372T\305\363\361\2600\273\213 \024"
+	.ascii	"`\325\333B@\030V\303F\256\"@\246Y\201\253^|\001n\203\025\032"
+	.ascii	"\204\302I\234\0208\210<\215 Y$\023\366\272f\223L\220\304\317"
+	.ascii	"\214-M\217*\2503"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.part.0.70.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\365\013"
+	.string	"\346\025O?\020Q\225\016\\\3110\005\024r\204\334\340\225\017C\207\bA\323\372U\357T\360\302\256\277\030\235\334\377\034J'\036\212\310\267L&@\036\001"
+	.string	"\266"
+	.string	"\305\350(NGx\374\333\223\212\306\266\211\224)\005;"
+	.string	"B"
+	.string	";"
+	.string	"'\\\261t)\333\256XD\036\035l\241\316\222q\241E\270\013n\217\032\342\243kf#?O*\322\365\337\013x\260\022\r\227\212\303s\362\254\343\262\273\216t\270\343m'\260\255\300\376&\032<>\354\242b8\026D|\221X\321\031t)a\260\220\271F\204(\3025\201\b\300\253\b\031\024"
+	.string	"lmXP\342\306\313\340\001@\036#\377\200\374\016=\205\365e#\334]\355\376\327\331\232-\262\265\307\007:\300\244$\373.\376\202\202/\302\022>\371\323\243\377\321\350\301Lx\3602\306\302vW#\322\332\324\356\036x\374w\t\214\0303H\231#\225e\315\236\255\256l\247\325\351\214\351C\f\004n@\021`\r\205\3430\250\300e\034h0\0172\033\004\016\246\263i<\237\215B\300\\\204\215g\233\300q\236M{\266\272\362\277O2U5\203mU_<-\251\262lK\362jw\270\374)\003\031"
+	.ascii	"F1\003V\275\234\305\230\267\241\321\016*?\0139\207\3605\315\360"
+	.ascii	"\bm\3462@\024\fs\205\233h\"\377\f\221\347\226\005\233\372\320"
+	.ascii	"\223\216\267\016\347\252\232x\251\323\276\244\246\250y\377\265"
+	.ascii	"e\f"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.part.0.74.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`\236\001\335\016"
+	.string	"\266\031_F"
+	.string	"\223\223\016\230\306\364\357\2145b=P\2250~\347\377\221R\375lTS7U8\331\220\245\211\001\376\206\355\337\273\372pa\n\302Z\301\323B\313L\244\213\002R\004Z\204\025\365\271\244w\316&\"\237D\262\267\224)\005H"
+	.string	"K"
+	.string	"K"
+	.string	"+l\223:\270d\0079X3o\003\346%F8\347\324.w\304K\217\253\262\344_u"
+	.string	"^\312\364\250^\n\3047.p\tE\214\244PQ\300\316K\217\253\256\034R'\325\002\227\"'sNc1\367u\333\rl;\260\257\0233\266TkT\0373\2411@fN\230\236!\363\223+\023.H^99mp\2117;B\026\341D\201&\340[\260x\345"
+	.ascii	"X\343\341A\212\326*\234\023\324.\r\236\344\272\304n\340\272\274"
+	.ascii	"}\263\334\306\253\343&\273\257\"\331Yv\371\366o\034'$\201\343"
+	.ascii	"\256K]\006%N\310\250\256r\325\220>p\250\320\t\240_;\245\323{"
+	.ascii	"N\200Z\223}\031\237\241\342\2230\206\221\336\273\364G\27318\255"
+	.ascii	"\020-\332\003\3036\251\004+\271$A\361\265\204\230\224G\227\306"
+	.ascii	"+\037\347\006\236\360A\340\355\323q\0214t(\0246P\005\024\315"
+	.ascii	"\002\007J\3216\321H\373(pw!$\3222t\235H\313\342\334\031C\370"
+	.ascii	"\300j\331\323\352\3734\207\207\025\t\250\r\332\364\236Grx\260"
+	.ascii	"Nk\362\336?r\330|\2734\326\207.]\321\013 (\335\t( p\202\031\263"
+	.ascii	"\363\346\230\001\257g\377\303\375\3310e\225u\343\030#\302f$n"
+	.ascii	"\274\210\023\207\202\031p\365\354)f\036\\\007\326\265\260\227"
+	.ascii	"\313N{\323\332\306\307I\273\031\2201G\036\214\360c\034%\3067"
+	.ascii	"D\376\226\027u\t\260dY\2346@[\312\212\201P{3\342\320j\334\273"
+	.ascii	"\360\030"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.part.0.81.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`\354\001\205\021"
+	.string	"\366 tG\300\226M:t4\364>\221\263&\236e\017\276"
+	.string	"\377CU\372\321\245(\273\2733\177-\024\026$%\024\205G\252c}R\214\325\234\257\325\\o\367M\232&\266Q\024\253\333w\302&\225}n\240\002s$\215\354-eJ\001a"
+	.string	"a"
+	.string	"Y"
+	.ascii	"3\370\335< \333>\215\033\331xVA\007\247\004\005\0313x\222\236"
+	.ascii	"v\277\325#\313\013p\217\360\004\270Gu\361\331#\324\344f~\366"
+	.ascii	"x7\217\030jM9M<\274\023\207\020\302\317\222\r\300\223\026L*\217"
+	.ascii	"\226\032\300\323\201,\273\373\243\247\217\227\2239\340\\\312"
+	.ascii	"ew\335\241\270S\267\315\262}\301N\005\001\251tr\351\247`\321"
+	.ascii	"\317J\212]\022QQVE\034\002#\207\3143p\205\276[\320\212\222\027"
+	.ascii	"\237\321\323\322>\006I\307A\343\231\003\337-\310B\021\224\021"
+	.ascii	"\177\335\355\233\346H\236P;\362\264\273\252\373G2[e\333\330*"
+	.ascii	"k\376\223}\353\001Y\3637j\240\200\245\261\020\n\262\273\016\036"
+	.ascii	"\375\240{\264_C\346\372\334\335\033U\233m\027\227\nCbBK(\266"
+	.ascii	"[\007\342\352v7\202\377#\204\006\237(\306=\246\252\330x\217\373"
+	.ascii	"\210\371D\206\211\311\367<\3721\n\253-\201\022\302\311\250\035"
+	.ascii	"\266eN\335m\201vw\301\343\217\376[\023\017\311MJI\265Y\271\303"
+	.ascii	"\325![%\035\377\375\260Kk\336\320\202 \346\222\251aE\267Z^0\031"
+	.ascii	"@\274X1\255\027\016\254\225\007\230\227\016\253\026,\266jI\340"
+	.ascii	"\327\007\027l%\363z\301V*\333y\270:d\003;KN0?\343R/\344&v\230"
+	.ascii	"F\344?\343\242\372\330\216j\027\034\315\261\306\006\"b\020\321"
+	.ascii	"\261\272\302z\tJ5'PmPU3\tR\221TUN\211gJ' `\002!\347\350\034\354"
+	.ascii	"\354\237\252\3363\305B\2740\322\214\360s\301\216\3137&\267_+"
+	.ascii	"\353\304\213/\225\300dH?\341K\230\261\b\206\334F\242\036f\034"
+	.ascii	".\030\n\035\016\321\277\020\363\2462p\210\2601]\336\266g\213"
+	.ascii	"\354\222u\215l\3358%\022/lG\003k\256VMv\003O\300x"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`\246\002\335\013"
+	.string	"\304\020\242\003"
+	.string	""
+	.string	""
+	.string	"\002\306"
+	.string	"\177\027\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005$\030\200\204\001"
+	.string	""
+	.string	"\003\002\312"
+	.string	"\177\031%\032\321"
+	.string	"\177\033\002&\177\034\272\200\202\002'\177\035(\177\036\360\372\2508)\177\037*\177 \0058!\002+\177\"<#\005\"$\005>%,\177&\002-\177'\002.\177(/\177)0\177*1\177+2\177,\005#-\201"
+	.string	"\0023\177.\377\377\377\377\0034\177/\0019\1770\037"
+	.string	""
+	.string	"\200\200\200\001?\1771\300"
+	.string	"\17726\17735\1774\3777\1775=\1776;\1777:\1778\301"
+	.string	"\1779\003"
+	.string	"d\003\002\033\240\276\320\347"
+	.string	"\001\344\001\003\002\032\005$\003\005\034\331\214\342\221\002\001d\003\006\036\007\036\221\205\327\307\003\001d\003\t"
+	.string	"\202\001\003\013!\204\001\003\013 \256\220\307\307"
+	.string	"\001\304\001\003\013\037\007\003\017\002\025\"\244\001\003\027\"\302\361\231\370"
+	.string	"\001\244\006\003\030\004\327\341\232\245\001\001\302\001"
+	.string	"2 \340\002\021:n\003\f\374\026\202\347e\r\rx$a\020=\225|a&\325\333\254#[F\202\0038"
+	.string	"Gp 0#"
+	.ascii	"G\233\340\\\342\007\204RK\357\020\346\260\323\200\004=d\004\021"
+	.ascii	"\337\001I\017\337\370\r\374\306\376#\2124\201\016\031b\240\317"
+	.ascii	"x\200\305<I\322\032\212\364\340\217\f\002(%\314\346\017\037\026"
+	.ascii	"\t>HE\314\260O\355\313"
+	.text
+	.section	.gnu.lto_.refs.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375 \211\335\002"
+	.string	"b\205\017\026\220\265\351\377\377\377\377\377\340\022\263\006\324M\326\366\377~k{\313\024\177\371]\037f\330g\365\\/\230UI\206:\300tu>\231\216\332\263x\274\022x\363\001\003\322\313=i\355\266~\377@\013"
+	.ascii	"9I[\002\314\004\0328\002\b\354Q1@,8\226\322DLA\tJ\022"
+	.text
+	.section	.gnu.lto_.decls.cd385431779b1b19,"e",@progbits
+	.string	"(\265/\375`\252$\375\231"
+	.string	"\n\353\2204O0PR\352}\207\266\221\n"
+	.ascii	"~\233\374\327\235D\363\343m\373eE@\200\005\004\303\337\344\367"
+	.ascii	"\254L\350\253\352Y\021\024\036\225Xm\021\301\316\243\257\346"
+	.ascii	"\271"
+	.string	"\2259\354\206\245\312\301l]\016\206\234>\"<\226(]1\375e\214N\2407\371[\246\224\002\317\002'\003V\003Xvw\016g\363\304\311\317)\246\255\b\344\236\b}\212S\241\200FT\306\310\316\351\351\207\017\375\031O\343k\370\027/\374\"7t/\337|\247w\371\354T't\301\366-\316\245u\336\234\2379\347\3665+\016\207\303\242\255\023\261\245\277\234\337v%\335<N\350X\334\017\207E\363\223\252\211\200\2251\266\300k\316/\003:\f0\020\023\304\313\352K\210\032\303$\206\204Y-\314+\345\177\264\200da|W^\366\206<4--\376\367f\035\342\022;+\271g\373\243m\277\r>\357\273\031D\022\3043\344\353\342{E\256\034IYX\\\257Y\352\264\006;\225\350\320\354\332v\271\266=J\333\376\2668HZ+\314\226\026\265\357Y\247\363:\247\036\3409\340&\325zS4\374\262\373\361l\273V\333~"
+	.string	"\321\017\375"
+	.string	"b{U\033\302\231\332\366\243\266mh\275\315\335\234\272\343o\355j\276\3262\3177We\360\002\241\310\236\355\030m\373\016\361\306w\210}lC\270\007\"\353\001\020MX\335\003\321\243\2603\330\330\254\236\355\025m;\365\313\2258\024\f=\232f\262\234\337\034b\025\260<\346O \230\240\375\2129+\3119\033pC\344\214\n\220g]\314\313\016\317\246\270=\353Uo\342\324\021>\326\356\304\311\032\306\371\3467\347\367\346\205|)\023{\026\307=\020\377\203\266}\004\021\037\036\372\bbo\221\241\201\303\232\252{\266\273\303\032\0045O\320\006\264\235\323\366\267\375\246\275\356\201\330z"
+	.ascii	"D7\203\233\356w\243\222\n,\366\344t?\223n\177\002t-\335\236%"
+	.ascii	"h\317]\240\356\306\351~\266\3762b\356\001=\264\274\366\320\215"
+	.ascii	"\023\300 \216\360\007\017\270\033\347|7n\001\257g\272\037\314"
+	.ascii	"\312\235\203\331u\373\211nw\240\333g\350v\032\252t\273\004M\254"
+	.ascii	"\335\016%\207\026\ft\367\210n/\326u\367\234\211\356\337\322\355"
+	.ascii	"(\270u{\2106\232\356'\322\336\375}\335~\323,t\267\001]\323\375"
+	.ascii	"{\335n\204\255[P\351\366\253\265n\317Rk\231\356\217\353\366\264"
+	.ascii	"n7\353\366\261n_\322\355\\\335\256\325\355X\335N\325\355S\335"
+	.ascii	"\016\325\355\307nW\352v\035\335.\355\366\244n?\352\366\033\335"
+	.ascii	"\016\355\366g\267\273\320\355\316n\317\335^C\267\313\320\355"
+	.ascii	"2\272=\205n\217\321\355\314n'\352v\241n\177\241\333\215\335\336"
+	.ascii	"\323\355+t\273\n\335^A\267\257\350\356\267n\227\351\366\022\272"
+	.ascii	"]\204\356\356\353\356(\335\016B\267\247\350\366\f\272{\260\273"
+	.ascii	"Yt;\006\335~A\267\243\350v\021\335\236\323\3558\335>\323\355"
+	.ascii	"6\335^\323\3554\335\215\242\273\347\272;\200\303\303\303\303"
+	.ascii	"n"
+	.string	"\366\332M\254\352\376P\030\357\366om3\347\016s\177\200^\256yii\207H\346\026\026\326[\372\337\336L\246\210\221\251\243g\233\370l\033\346\256\355vbvFs\3169`\336\034-*\022\035\306}\247\273\306\261#\320\335l\316\005\264\360\346&\335\020\301\326\b\232\323)Dn\030k\316O\251\246\006R\322\247T\017hU*7\237Y\315\234h\226jB\2539\347\344\347\263\331\3014\347@\253Y\232gT\221z~\245\232\3719\3159\371\231\235!\240O))\264\352\224\346@\253R\322\\\225\3128\371\351\214\332x\346hN\256Ji\311\325\251\024\007Z\235J\241U)'7\202\372uI\247\f\231\322r-\320g\306\201\364\344\214\342X\241\3574\353\345\354d4r\024\201\234\237\246Q=g\017O+\262\342(2sN\375\003R\321\3244?\255P\256i\316\\EA\031I\202\346k\315Wnm\002y\312G4r&"
+	.string	")\347\246gk\316\271\231s\216\211>\27597\341@\267\220\220r^\322A\312OM5\0329?\331\2254)\264:5\345Q\033\253n\345\032o\323\267\262\236T\264\2556\303\362Q`\273%\325\001\370l\032.z\242CK\026\322\237\021\357\256\324\256L\3337\373\207\362Q\372\315\376I\361\371fl\316Nw\0216\356\"`\334\2108\305\232\312\310\276vT\r\221Q#<\302\343\331o\362c\375N\276\232\337\211\004\323\234\235\357\344\2460g\347\215\273\bw\021\254\327\224\326\023\"\3330<\236j\303\305h\013\334\263\r\223\333\260v{&\371\306\257\340\232W\327\266\373\227\364\013q\223\366i\001S\362gI\272\276\236m%\r\367\323\350"
+	.ascii	"D+iO\272\257\367j\002\204\n{6I\\\364/\357\331f\255\2648\374\221"
+	.ascii	"7\3627<\222\347r\352w\275V\377\226\2435\313\363]>\370D\320\212"
+	.ascii	"\370\376~\252\310u\013\bU\226\256\317\3622\374\246\2655\304\260"
+	.ascii	"\374}U\020\234\\d\347\267\325\365V\030\244\341yu\345\374\352"
+	.ascii	"\334\340\r\222\305\331\260\315\036i\213\254T\333,\217\037\342"
+	.ascii	"U'W\204\31766l\377\352\261\234\372Br\r\rU\032\231\363Y\0311\355"
+	.ascii	"Fl\314\3276\226k\233\f\213\265\235&\025E\343f\255\302\201\254"
+	.ascii	"G\227-\036J~\265\3019Gy\331r,~u\353\322\005^\204O\357\343\247"
+	.ascii	"\377\343\241\234\372Q\317\324\337\364N\375\021|\324/y\231[\255"
+	.ascii	"4Pr}\035\335<\037\365;\374j\323|s\022\212B'\245\"\223$TqE\326"
+	.ascii	"\204{ \022q\216\266\361\215\266qQ\333\177mu>K\273\323\237\343"
+	.ascii	"\200\233W\t\t\2104\212o\200\t\242\375[LJ\0222M\332\251\351\202"
+	.ascii	"W\324\205\343\221\304\344\274\234\317>\322\221Q+\330\326\344"
+	.ascii	"|\243\277\341z[h\024y\366m8\237\016kTi\227\274~\226$v\365\267"
+	.ascii	"\026\007\265\225&%j\213\315\307\037\230\023\372\240_\361\273"
+	.ascii	"\025\343djH\225&\236<\277\362\304\356\b\017\307\037O\026\017"
+	.ascii	"\324Qdc\t\223\356\243a\027T>\376j\260xd\325(kl\206\241\f\032"
+	.ascii	"\251\341Ay\302N13\262Be\030\227%\354}\361\030\nS<\257\256\f\220"
+	.ascii	"\3345i\322x\354\321Z'VI\362\236\305a\270\nc\344\217\n\255*\006"
+	.ascii	"c\225S\222J\362\201LNJ}\255\002\372\240Q\206\340\200\003^\002"
+	.ascii	"\267\205\227pa\253\003k\274\004+\311\321\221g\261\222'\0223\b"
+	.ascii	"$\207\257\027\243i\002\344\314\310\263\330\313\317\256\256xA"
+	.ascii	"\237\305I\272\217}\002)2\367,\356r8%Qkq\317b$\356\347\204ix6"
+	.ascii	"\256\340\261++K\240\212\024\301\\M\214\224\232\256\354 \225\""
+	.ascii	"iF\032s\265V\256\2056\236\3057\340\037/\244\255\207\221\242t"
+	.ascii	"\310\020\254\2453mj\271\340+\215\245\233\252\335\310j\254\205"
+	.ascii	"\177\260mEkU\236\305D\274\354.O\211\325\213E\2412\026\2450H\020"
+	.ascii	"\214\3458\257M\223\317\b\310Uc,vo\206\r\035V3xW\b\255VL13\274"
+	.ascii	"\310U\247PQ}\035\006j_\206]L\b\355\242\254|\370\300S:q/\236\027"
+	.ascii	"V\303:\364\202\245\032O\315T95\225\374\220\261r\341B\366c\212"
+	.ascii	"\245\340\230\023\3026Ai\243Yj{\251\2270\224Ss\222SA)5\355\320"
+	.ascii	"\350\2355\261zj\fU\223\246\204u\206\235\336f\366s\302M2\200|"
+	.ascii	"X\236o\303\246\310i+\bfr\301b\024"
+	.ascii	"US^!\017\036X\251M\322\372\255\251Q)]i\366\244]`St`\035\377\022"
+	.ascii	"\211X\227\032(\352M\031R9\221J\277\356\267b\244\030\271\361w"
+	.ascii	"w]\002\274\302\201\003'5N\216\"B}a\223#+\234\264\003\306\025"
+	.ascii	"\350\367l\317\354\300G\370\350\337@ 2E\001\275tQ!B\b-\274q\343"
+	.ascii	"\337\210:^\232\261*\322\036y4h`\250\177\231\002z\351\272a\262"
+	.ascii	"\n\214\3035\032C\337\214\315\007\2227+\336\310\301\026\265\206"
+	.ascii	"\237\370\371o\036\006\255 \2545\f\277\234\330\351p L\2359\024"
+	.ascii	"\bl\n\331q\315YJ\0036O5\220dp\246\342\354W\177s\322\f\322V\333"
+	.ascii	"WX\370\206 Ls\216\013\214\274x^\327\234\237\032h\253f\354\201"
+	.ascii	"\375\027\037{\305\332\236}\253\035\226\220\340\260\363\342\345"
+	.ascii	"\337\002\267,\220Z{\323\256\355\324\277\276\332SsSy\270\324\200"
+	.ascii	"\314\234\016\245;/.\\\276N\007.?\355\270\224+\255\250\252\026"
+	.ascii	"\020\360\005\333\374\245@\224\226\037\201\375\202n>\310%\210"
+	.ascii	"\365e7H\b\215\360r\264~~\377\327\346\234\275\266`\302\276\350"
+	.ascii	"\002\2638\365\377\276\326\336\036~\205\231\342\302\327>[>\276"
+	.ascii	"\257k\263\316\221i\325\331\0136\330\332\375\025\273\337[\340"
+	.ascii	"\256\357~\257=\352\314\271(\347(&D\270<\303W\264t\303[\351\337"
+	.ascii	"\323c\257fT\315=\213\367y1GYe9\356\361\266\374K\334\343\372Q"
+	.ascii	"\343\331\216\351j;&\332R\237\312\243\261o\226\322\240E\013\333"
+	.ascii	")\237\303\224\257\243\243\373\272\017Ef\254\204X=\353`\252pe"
+	.ascii	"=\321k\233\030\245\355\227\342/"
+	.string	"G}\2717\322ys\016\032\264\034}\033h\342\333\266\277\021\261\355\341\332\376\215\230\263\277\323\244h^\212\356\364\257=[\277\0335@\307\027\310$\0076n\317L\007\221X\0061\215C%\220\311\241\241\244\017\001\310\243Q\311\\\"\223>2\256\253T!\243E\216\213<\016)]\246\373\323\001\351\022%mh~\334\037\344\361E\207\237\027!,\215\256\220{\002\210\036\242\345\320\322e\032}\222BB\033\020-\207\004`\341s\023\003\223h\310\003\346qh\2114*[\260X\036\013`\"]\037\245\273BH\350\250\002\004\323\005\372\201\021\264<\"]!\"\367\004\245\353b\bF\t@\311\021\230\356\007\310#\f\312\244\n\003\b\t\301P\221by\374Az\320\001(9\002\362\b\344\246\3709\022\225`\006\001\035\205^\350\270C\311\021~\216+\230.\220\322\310\314A\272\314\020\224\356\212\245\313\214!\205\322\225a$\001\201\245\f"
+	.string	"C.s\031\003\013\017L\026\314\243R\205\032\244Kd\202\333\263\204\30142Y\034\020\302H\304\302\215\241t\227\356\t#V\004\260L\nq@@\261\021\3201A\202\2514\022\221p}\224I\025AK\030B*:"
+	.string	"\321>G\245\213t\201\332\226\340\304\003'(\220\021\323\024\2400\201\302\004\261)@\301\303\203\342\004O\333'x0\323\355\001B\036\225\306 \026B\311d\212\036\030\2451\310\207u{Tt\210a\002\220<\016\020\203\222\351\016\271B.s"
+	.string	""
+	.string	"`X\032I\360A\302xQt{B\020\200h9\264$\002\312\221\341\376 Cp\231Fe\217"
+	.string	"\035D\002\304\262\007\350\370\002\231\344"
+	.string	"'yd\032\225=D1\256\3171\206\373C\364\3611\366\374(\223>\256rF\231D*\335\030I\240\226\331A$J,\225n\214\243\362\307\200N\022\271\312\022\314dRY\202F\351\036_\034\231H\367\3478\263\354)\246\300T&W\340\270B.\214-b\020\335\036\367'I\302\214\373\223\034b\335\036\023\230\312$Q\315\022\231<2\211\2221.\323x\302\017\f\243\213\326\225\341\310\242e\366P\020\303l\225\305\037\243\013\002\263\007\202\b\204\216\306\026J\367\305\013\030)d0\213J\346\n7\306\321\365qO\0202\036\225\356R\207\331s\202\207\211<\302h\233\207\207\203\020(\224\360A\353C\"y\354\221\221t\001\203\217Q\310E\t\344\3218T\302G\271,AB\304\214\221i\354"
+	.ascii	"\006\037\243\013!!#\0072\2246\202xj\206\312o\312V \206j\273\270"
+	.ascii	"\355\350\002\250\305\351kH\227w)JY\220g1\026\214\005g\221Q:t"
+	.ascii	"R\312\202\375\326\240r"
+	.string	"\226\037\356[\2217\343\23263\343\220\360\t\363=S\216/\276\245+{]\244^\366\376\325\302\241\265E\017\247-}\311\242{6\357\353\3302&\253)<\270\266\314\317jd\305\257oGwTt\207\227\300\204\355\240s\332\031\026\243\256f\340Uy\264\256\266\350\032\025<\326^\211yU\255fN\256L\230\236\305u4}B\324j\2200\035\034\236\363h4\347\245\334\004t \256H^\3335/\355\330\351\306r\215\347`h\360\t\306\265[KX\306\344\356Y,\245\335\346\352\246|\264\033\313C\355\213N\357\355-\005\340\021\225\333\253\315\\\tR\035i\343\262\331\022\205\244\352Y6,\022\242\322\002\327\264\354\240\364\230\236=;\303i\304&HD\272)\033P\320\032\2479\\\221\312n\310T\361\215\254\311\260\231\t\3175\240\004\203/\250b\361<\311\362\312\220\241\031\221\031I\222\2441\362\n\020\004ca\030(\323\003\022"
+	.string	"\0249Rs\222\231\231\021I\222\244N\233\001TA\241\3058g\3132\276-2\ba\034\217\002\222\260\322\202;\207\004\260#\330?;\322Wt\210\352YW\334\234zc\377\212\254\217\376\3041Z\0219H\331"
+	.ascii	"\231\377\212*q\\\206\361\242QF\2428\227\366\211E\247\345T\256"
+	.ascii	"\027\0314\230\034*\267\020\220N1\350^\267h\332\327\344\210\021"
+	.ascii	"\270{\207\002\224\240}\004@\205\361\254\b\177\013;dz\353\237"
+	.ascii	"\307q\221\210\235\205\276\nG\f\231\344\034\b])\324/\310\344\260"
+	.ascii	"\213\240\301\2751\314\273\310\215\252\307\367\231L^\036\247l"
+	.ascii	"\203\363E\354\004\030\254a\013bH\360\275>3N\322\323\303Q\214"
+	.ascii	"S\266^\3669\360\360\343,\343\336\3406\n\027\023\300i\344Il`i"
+	.ascii	"\253%#"
+	.string	"\037\\\241\367\221\365\r\360n\220\037\215\036\350[&u\013\353\333R4\304\343\327\020^n\231<A\214\337\245A\"\213;\323)\027\017\343#\203\\\362=\300\016\021\0204\207\252\265\224i\203+\314\211\346m2\366\311\342\273\315$\205\261_E\002\370y\264\337\211'Q\211\246;\302\021\357\212/PwzW\037\356\221\035\202\205\002\2008\022S\310\026\235:Q\227\002\220\205\302\205\204c\353<s\307\027\352\244\350@\256\345`\270c[T\265\265:\007\274\306*\272)_\223?\355\03496\235\r\026 \330\320I'\037f\350\260\236\203\236_\323\3258\375\031\3705yR\226\224\2420\005\364.9\304\230a\315rd#\031\021\270\211s\372\333\232\367\364\372\222\nAI\037|\212\305 \327\b{\364\211\275\007\337\255\253\356\372\212\007\334\220\3051L\350\016s\314\365\223W\267\277C\347\003\337\360\300x\026\350\350\\\315\203\330&+\304"
+	.ascii	"}\304\3751\256\364Y\020\377\\\266se\223tKE\365w\272oc?\333x\005"
+	.ascii	"E\344E\206:>\262\271K\302\036\023\346\004B\fGw2w\246\334\265"
+	.ascii	"\357\251\246\030\201\177Go\345y^\371h\344\364\026\035\362\361"
+	.ascii	"{\034\357\365\025\033O\322\r//\335\033\307\342^'\027+\250\\\316"
+	.ascii	".\276\\\342\330K'ZjF.\223:\321\024\227H\352\217`\030q,W\204\023"
+	.ascii	"}\022E\025mp"
+	.string	"\372U\037\325 g\3717L\207\340\031\"\220\030\240`\371Z\246\275\006\3279-\347MW\272\001};Dr+\306\214\312\305{\356N\337\314\365\321\024s\225\37146\313\317bd\307)\270\323\b\211\253j#\206\021\253i\232d\035\211\033+q\345\214\262\021I\243\303\026Z\003\001\315\037\301\\\223\250# \264\230:\316\024x\325\024\220\3033\253\205V5Y\256\330%<\230\221"
+	.ascii	"\352\025v\345\300\037\034\254\305`>\b\312h!\0344)*L$\315\240"
+	.ascii	"\251\267\360HW\354\331\200\324\3145\215y\266\375\260\244\265"
+	.ascii	"lii\222\255-\331\324\365\205l_\371*\036H\002\270q&\304F\206\351"
+	.ascii	"c\315\204 \332\347\317\335\037\304\r\273\237\340T\217o\2771r"
+	.ascii	"@\252\376\001\240\214\214R\364\362`n\241\025;\317S\025u;K\250"
+	.ascii	"\b\203\245\213\246\353\3662\215\250\201\351\005B\365O\333\302"
+	.ascii	"\315<$\350b*\033\211=\342a\242\005!X\272\271\274GR\302\365\244"
+	.ascii	"Z'\002\355;-\340\2151qF{d\027\2244\262\304E\335=\247\322\226"
+	.ascii	"\206B.\004\262\3758e<'5t\037\220\321\004\232\f"
+	.string	"\254\364\235\244s\315\301k\307g)\246\007\023\232\215\311\2312*'\333\337\343\032\001\264'?\007\233\270\034\374\372\033\347]Ap\203\201\023_P\354'\n\364\224-\001\266\251\370\035\032\257\006\227R\037\\\362\337\2279\207\230`\017\177\026& \361S^\344\305\330\206\017\202O\031\354\270\3239\003*2\025}\256\362\265\217M\021\027L\245\303\006\227H\205\275\300W\205V\216\302:\025\304\034Q\211\306m\301-\304\315T\234]u\177\t\004,Tl\200\007\304C\261\026\320HI\373\214[f\346\366\333\224A\027d\2760Z\364\355\314u\251\033\022\177\342T\216a]\252\275\261\270\342Z\271\354?\371&\313\374\350\265\357p\364\006\030\231\333\236}\362\r\201\362U[\202,\360\225f\275i1a\263h\002gUi\215\005\316A\370J\035\030u\204]\364\204k\3573)\265\236\244\352\265f\330\204\356D\037Z\032Z \021\330\230=\023"
+	.string	"GkO\263n\016\035\016w\332I\314\311\344\311e"
+	.string	"\260\351\366\340wA\027\025\20543\tY\r"
+	.ascii	"\235U>\331V&\240W\334\200z\024\021\206\322\366\230\223\315\246"
+	.ascii	"\332\271\252\007g\034\351a\013@\005\237\246\376\311<6@\302\007"
+	.ascii	"@\262r|/B\305T\2703\020\264y\017\234\025\212\233U\242XE\247="
+	.string	"\001\210\320>\377\036\244;\027\323\201q\211|\211i\252\224%\322\311\017\205\371j\274\240\302\335\3212\354\264\377\030\321\221\264o\n\213:\320C\315nn\030\365\321\373\370\347\013\332\023\370\260$n\336\003\356\215\342\361\001/D\374T\316m\240\313\311\377\307\277\3570?\252\375\322\316m\300\024\371\200\244M\343\037\220g2]\363\300\277\370\350,\224t\226\214\251m\220\036\356\007\364\214\351H\303\003\311\2076,HsU\366EbX\257B\017\366\304A\264=\333\216>\276\"\356\331\350Ze\2531\320\220\250\037\2413\204\031\204\r\371\004\303\366\3445@K\n\230=y\357\0353\336\254/\234\353t0\346\021\304p\020\361\366\366\305a\373\367\3747|\2328k\3501\361\376r\2636\210\261/8N\375\n\230\220\206\314\326\315k\353j\312N\241}<\177\315\305\352'\005\2650\202\265\317\315\260\241\207\213sLo\235\022\246\216\227\360~"
+	.ascii	"\357GW\363\274\354\203\321'\363'X\003\311\n\203\327\260\025"
+	.text
+	.section	.gnu.lto_.symtab.cd385431779b1b19,"e",@progbits
+	.string	"blackboxOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"isBlackboxDeviceWorking"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"blackboxGetLogNumber"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"blackboxDeviceBufferFillPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cd385431779b1b19,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,242 @@
+	.file	"debug.c"
+	.section	.gnu.lto_.profile.b5a4f4d430c39f27,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b5a4f4d430c39f27,"e",@progbits
+	.string	"(\265/\375 &\375"
+	.string	""
+	.string	"\270\032"
+	.string	"\004"
+	.string	"\256\265\340\342\n\001\240\342\234\212\n\002\003\240\342\234\212\n"
+	.string	"\002"
+	.string	")Bm"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.b5a4f4d430c39f27,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.b5a4f4d430c39f27,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b5a4f4d430c39f27,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.b5a4f4d430c39f27,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.b5a4f4d430c39f27,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.b5a4f4d430c39f27,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_debugModeNames.6.b5a4f4d430c39f27,"e",@progbits
+	.string	"(\265/\375`\227\b\r-"
+	.string	"\312R(\022;0\252i\01603\323\231\350\254\022\253\304333K\231\313\204\002"
+	.string	"@\007\240v\256\020\004P\032]\023\"\273\t\225\020\364\267\355b\353"
+	.ascii	"\230\332\rFl\216\267\223\304\031+[\223I\006\016\001!\001\023"
+	.ascii	"\001m\377\026k\342\277\035\350\036*\036\016\326\206\370\357\007"
+	.ascii	"\332m\355\341t \376\033\302\251\343\307\351=\374w\004R8>.\326"
+	.ascii	"j\370o\t\241\320\227+#_=\301S\361\345bM\205\377\246\260i\370"
+	.ascii	"sP\370\357\n\230\316~.\326D\370o\013\225\206O\007\257\344\253"
+	.ascii	"_\376\233Kj{\272\370G\361\337\027\036\035\277\016\256\304\177"
+	.ascii	"c`t\374\272\370\020\377\235!Q\361\355`\226|\237\216\377\326\260"
+	.ascii	"g|\273\330\214|_\016\377\275\201\320\361\357`\024\344\373d\370"
+	.ascii	"o\016y)\376\316%\337\337\302\177{\r\302\361x\360/\341\277\201"
+	.ascii	"\200T<^\314\202|\333\370\357\016tg\237\007\273 \3375\376\333"
+	.ascii	"\203\037\264\317\213a\220\357\013\376\373\203\\\332\353\301j"
+	.ascii	"\344\213\202\377\006\361\266\366zq\r\362-\362\337_y\330~\017"
+	.ascii	"\276A\276B\376\033\314\016\216\337\213s\220/\030\377\035\366"
+	.ascii	"\005\252~\347\237\323v5\005\020\250+\246\334"
+	.string	"\334\336\037\362[\007\371j\376;\353B9W\245\t\332\213\006\243\303\3501\232\2146\243\317\3504Z\215f\243\333\3507\032\216\226\243\347\350:\332\216\306\243\363\350=\372M\307\201i>\272\217\376\243\347t\235\266\323\201\264 }\247\361\264\236\216u\241/\275\007\302\254\022\345\026\204G\211\254\r\241\026\340\215\307\t\261Y\210\267\037\376[\347\245\340p\036\376\3337(\215\307?@i\033\366\246K\261aK\341\277\253\374\264q\200\267\021\376\033\200\334\311!\376\225\342pl^Vz\316\274~\216\370\357\253;l@\370G\210\377\306\242\203\006\214\177\202\370\357\2548\305/X\017\377\255\345\246\370\025\377\266\326\254\201\201\341\277\271\320\f\301\342_W\231\26508\n\377\035@\314ZX\374C\302\177\013\370r\f\001\377v\360\337\003\270\034C\304\276N\3747\201,k\"`\337$\376\273\200\0256\021\261\017\021\377m`J\332\b\237\035\377}"
+	.string	"6\216\360\321\341\277\0218)\222\200\023,)\222\360)@r\226\200\307\310\3277\204\377^P\004-\021\373|\360\337\f\264\020\264\177\203\365)\376\273\301\033m\331\311\332u\035\262\256\331\005\344c\213\232(\373\230\213\266j\251\225\205\304\324U\217A2\243D\326\035\032{[v\022Y\367D\357\312\307\336\236\3033=[\267]\311\330 \201\334\3176E\205\356\220\330\261\262\212\016\335`\225y\366\276\232\256Yn\345\276\366~\272fi\225\307J\326]M\364\223\275\312\352\212\266e7\266%\353\216\251\250YWf\341\345\202m\305Y\013`\213\030hl+\2002\320T\244\001Y\320\250\001\364J\220\325f\234\321"
+	.ascii	"\332PS\243\001\304\312\352\212\262F\241\273\366\343XV~:_\347"
+	.ascii	"\357<\236\327\363{\036\356\343\236\317\367\371??\367uo\367\201"
+	.ascii	"^\320\337=\336\353}\374\205\336\320\037zD\257\350\027}\243w\364"
+	.ascii	"\220>\322OzJo\351/}\246\327\364\234\276\323\177zP/\352G}\251"
+	.ascii	"7\365\250>\225\336\241yh\037\372\207\006\242\203\350!\232\210"
+	.ascii	"6\242\217\350$Z\211f\242\233\350'\032\212\216\242\245h*\272\212"
+	.ascii	"\276\242\261h-z\213\356\022\371TWu\237\251y4\257\362\261\237"
+	.ascii	"m[\212\2219xn\235\303\265\237\351i\232\345V&\256k\032D\211d\016"
+	.ascii	"\236ii\262e\272\022{\2003\035S\313\253\214\225\373\231\032\203"
+	.ascii	"'\231\311^\3452\263l\331\252<$v\342\260uM\366\344\312g\320\330"
+	.ascii	"\242mZZ\345V(\374\345s\210\266\305\263\013\335V(\264:\226\261"
+	.ascii	"]\310\262dB-\253|\225\315\312\276\225O\025\025\033\256\246\200"
+	.ascii	",\024\242A7-\215A\256\314\225\313\31455\303\300\276B\234(\207"
+	.ascii	"\0012k\024cwn\373J\024V\345\254\2644\026\335~\006UTx\216\251"
+	.ascii	"e'\220\205\255\333\313 \232Z\345"
+	.string	"\264T\373\331\252\250k\006\205\353YV\266\356\2614+Uc\357bw\356+\253\236\254\333\252g\357F\223+\213\261\306_^\321\240\261l{9d\2612Y\333\177\371D\231\236\335\035\366\263E\263r?U\264\354\255\273v\263\324\312Z\231e\327\324MKu\f\345\312g\200\226\250A\034\2420\214\rQRRP\220B\2411\260\"\261\031*\017\020(C\232\210\325\001j\233S\204\272L.\030G]rT\305D\337t\022#\326\006-@\236\325\250\2108\225\312\251A\244\365\227r7\244\0026\3462\002s'\232e\237\313u\016*\t\271_\307\244\360\334@i\b\224p\001\2529\325\337\"C\330\337\022H\225\316W\320 X\360\363.\245\034\346\262\027\300\260\217c1\311\347K9\"\341\024`\243\013\360'\317\271\t<\304e8\001\235\n\026\374\267\343\331\327\341\370(\213\361\022\346\202\316\347o\353\020\251\177zi\236\036\245\202"
+	.ascii	"\355\tgw\247\200\361\373\006\327\376\256\263\220P>\374\202B\320"
+	.ascii	"I`\230\313,mg0\354\3227\035\035Xh\322z\335]\332\240\277\037\270"
+	.ascii	"\376\242\244\030\363\221o\274\203\025\033\202\334\321\356\201"
+	.ascii	"\3351\333,\243\341\307\216\3567\037\037\272t\363\271?\301?\250"
+	.ascii	"\247]\243}P\021M\253\207\325\245\256+\346\032y\252\033x:\013"
+	.ascii	"\024"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b5a4f4d430c39f27,"e",@progbits
+	.string	"(\265/\375 *\025\001"
+	.string	"\300&"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006"
+	.string	"\201\204\001\005\001\004\002\003\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" c\220\230V\361\002"
+	.text
+	.section	.gnu.lto_.refs.b5a4f4d430c39f27,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b5a4f4d430c39f27,"e",@progbits
+	.string	"(\265/\375`\265\b\345,"
+	.string	"*S\204\021Dp\232Nc\377\3666\332\"\242\344\332\t\234\222b\345qn\367\240\\\\\215$\205\376v\221\317\037\037\207_6\232\017\244D\335\346!4\276%\177\262\033\234\213\215\352Q]\035\367G \346\020\034\241\247\255\255\2542\245\335"
+	.ascii	"\006\001\f\001gr(8\313u=\256\353j\240\246\006\331\263\315^\373"
+	.ascii	"P\376\254A&\227\316\235\241\330S\326\020\347\230\220\315\357"
+	.ascii	"\b\224\275?\373\023\037\355N\f\224\30151\314\326\261u]\217\206"
+	.ascii	"a\271\256IG\033\376\255k\322\360o\3607\270K\256\272\322\322\353"
+	.ascii	"\013\301;U\277\211\375\262\233\021S\245\224s}\256\353:\274H\302"
+	.ascii	"\244T\331\353\340\211\251\206\023S\237\314\005\314\326\f\336"
+	.ascii	"\t&p\276\230\326\204\235\230\332\006mG\261\017d_\265_\301>\005"
+	.ascii	"\373\022\354G\260\357c\037\202\375\007\366\035\330W`\277\307"
+	.ascii	">\002\373<\366\013\330/\332\027`\177h\037\307\376\215\375\324"
+	.ascii	"\276\215}\333\376\263\355g{\317\266\236m<\333fl/\260?e{\214m"
+	.ascii	":\333p\266\325l_\333n\266m4\032\215\332^\332v\262\203G\001E\002"
+	.ascii	"tac\036\307\210\371r]\237:NgaT\366\336\356_\336\344\371\235\017"
+	.ascii	"\346al\223\344\\\235\307\323\222\321d\257\200\027S\373d\020\306"
+	.ascii	"\272"
+	.string	"\236'}4z\236\324\237\021g\003ex\363q\247;\300\341k\f\272*\333&\244u]zb\366^\356^\336\354\371\\N\240\222@?{\r#\350\367\244\217\276'\2651h\177\255\371\265\303\t\221\027\254\t]\225R\023D4\225\260\354\365\341\354O9\225\277Y\333\227,\013\264\327\177\263\177\345X\356f\227\353\252\226&\301b\344\313\336g\271\2267}\336\346o9\027\013\217\316\325\311\272:\207B\2733=\236\3662x1\275*\202\276O:\274Oz\001'\246\257\242\372V8\ba.\261\267\346\304\024H\365\331\322\260+V}\366\332\365\305\224\301\210\240\257\344\027k^\354jB\344\272\346P\243\222^f\370V%\217\tw\351\207\021f\224\261&\346\020\347\215\024R\n\231\275~\232\375\261\366\311B\351p\301\322\202\303\336/_L\t\344Pm\235n\242\270\001v\331KlR\22619\201\331k\253\264O\3062\001%\203"
+	.string	"\261\327miT[\034aH\277%7\2229za\256h\330k\233\264\255\r\273\204<\376"
+	.string	"\263\327\302\213i\212Tmk\324\3345\261A\331kCc\006\316*\2275g\257\355\f\333\036\255\222M\356\220*c\257\241/\246:'\2466I\265\225a\273\236nn\366\346\330\030v\265)C\356\245\331k\273\332\347{\024g\013\312)\316^?_L_\246\372\201C\272)z\\\200\1777J\3127%{\375?\373i\356\027\355\312K\332k*/\246\001\370T\277\357\346\370\224\306e\257\020\315\236]\026Y\027{\375=5a\325\323\2169{\237\247\372zi`\337\322\323\336\341\031\274`\224R\331\224\275>\236}\350\315\034\215\304\272\036sx|1\345^Lq\310\250~\031\233)7+!\366\336\234X\327|\335\307|g]\231b\001\306 \r\252\261\210\b\200\2151h\003"
+	.ascii	"\2411\b\350\202\261\210\310E\020i\210\005Q\210\"#\"\243\320\020"
+	.ascii	"\022\216yl\324b\350\350\307hdt\364ssT\"\205\320\265\252v` \002"
+	.ascii	"\204\207\240P\205\237\023+\210\\\230\370)\"*\301\342G\350\b\351"
+	.ascii	"\247\302\001\244!\026%@\f\2350\372\200\302\205\211\241\023:F"
+	.ascii	"\276\346\230U\354\227m\227\326K\016\t\022;{\217\274\242\332\026"
+	.ascii	"\t\260\006\025c\352\342\372\362\344\r\212\275\266\\\266EZ\"8"
+	.ascii	"kp"
+	.string	"gY\366\372lQm\2070\367\230\276\204l\r\251\254\260l\330-;Y\323\332\202\006\321\272R\202\261Z\366\363,\020\267-t|G\3256+\030\215Z\t\202\305\274gg^J{m\231\266\375a\257t\252\314\314\244\354\275\362\305t\300R\265\265\322iRr\226f\357N\225\365\221u\226\006e\257\255\017\333&\331\036/\242\200h\354\365\035T\265\345\321%\013\264\271\203*\250\311\253\316^[*4\022\200D\226\342\354\265R\252\355\224\002)X\330\354\005\240#J\347\216\n,\317^\333(;\200\226\250A8d\020$\210\013Df\244\240\240Ic\200\002\t\344\030\221\033\021p!\223D\2602\262u\003\205m\340\nu\3634k\251\214\345%R6\023\234\2263\340\320\213\253\037>`\b\320K\364\353\373\270d_\357\346\342\373A\265\376\231\250\221\361u\233\001\202\0015\240\332\013\345\0013\261C\016\326\260\001\"Y\\6\3108"
+	.string	"s\237\351\317n\373o\343)\tB\025<e>\336\226!1\0208\324\203\345\302K0\\\243Z{\3535GrwW\"\335\330\235\323c\207\351\363u\024\317\231\003~\263\204\325u\024\200\345\205\366K=\262\364>\2302\327R3s#a\217\034\345\206\016\303\221k\204\016@a\004X\212\264\306d\331H\201\nV\226\020\225"
+	.ascii	"\337j\262\347`\310\315\265\3714H~*e_\311\004!{y\237P\004\207"
+	.ascii	"\n\"b\324\317H\006\311C\263\272u\300\365#\361$\337d^\224M\002"
+	.ascii	"\177\032\001\037r\312\270IDarq\306\252\337\364JLw\007:\305\b"
+	.ascii	"\rO\367\210\024\301]\350v\354\3605\365\013F\tO\315Se\213\005"
+	.ascii	"\272i\225UT\251\244\256I\225\f\\\256\002"
+	.text
+	.section	.gnu.lto_.symtab.b5a4f4d430c39f27,"e",@progbits
+	.string	"debugModeNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"sectionTimes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"debug"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b5a4f4d430c39f27,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
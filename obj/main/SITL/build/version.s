@@ -0,0 +1,237 @@
+	.file	"version.c"
+	.section	.gnu.lto_.profile.e3e4be3998a0c84,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e3e4be3998a0c84,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\340\032"
+	.string	"\004"
+	.string	"\240\247\372\263\001\001\205\307\277\326\t\002\353\222\302\363\004\003\353\221\235\221\r"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.e3e4be3998a0c84,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.e3e4be3998a0c84,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e3e4be3998a0c84,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.e3e4be3998a0c84,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.e3e4be3998a0c84,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.e3e4be3998a0c84,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_shortGitRevision.4.e3e4be3998a0c84,"e",@progbits
+	.string	"(\265/\375 T\241\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\233\336\320\363\t}\273\001"
+	.string	""
+	.string	"\b0b682c3"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_buildDate.5.e3e4be3998a0c84,"e",@progbits
+	.string	"(\265/\375 X\301\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\237\366\330\203\t}\273\001"
+	.string	""
+	.string	"\fOct 18 2026"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_buildTime.6.e3e4be3998a0c84,"e",@progbits
+	.string	"(\265/\375 U\251\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\234\360\340\203\t}\273\001"
+	.string	""
+	.string	"\t10:46:14"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e3e4be3998a0c84,"e",@progbits
+	.string	"(\265/\375 *\025\001"
+	.string	"\300&"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006"
+	.string	"\201\204\001\005\001\004\002\003\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" c\220\230V\361\002"
+	.text
+	.section	.gnu.lto_.refs.e3e4be3998a0c84,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e3e4be3998a0c84,"e",@progbits
+	.string	"(\265/\375`\325\002u\024"
+	.string	"\266\344\205I\260\022Vc\314W\317\371'iF\261'(}@%\365F\220o\256\234\237\200\031|\002\275h\n\030\016f\034\346\3218\306i\022N\030\031\331{C\314/\361\210.\372p\247\364\020U\207\201\363\bEvwQ\334\335\315\255\3642\245]"
+	.string	"u"
+	.string	"v"
+	.string	"G\362\177O\315\340\304 \035\220\256\357\336\373_\203\236{u\377\305~\334\253\213\375#\377\210%B\301BXZ\233\230~\221eV\367\3040\323\351g\245yY\351j\332>\332\266\022a\333h[\352\306v\224m(\333\325~\216\355'\333B\333A\333@\333D\3336\231L&m\253\330\336\331uGRI?\325*\370\254l]V\236F\315W\222\2256:\351\rZ\036\326\b\241j\355e\245PHd\207~Cd\265v\t\006\017\274\310\275\274^\213\020^j\024\252\326\023L\177\350\357\031\275w \310\356\352N\230 k|\210\310kS$)\205W@\272\364\245\263S*\252\326~\222}\337c\\\006\310\256\246\347\006\357MEb=\234\237\2404\346j\362\001#\247\332\037\005\366\213\227\022\300#\304\363\251\326T\237\2250\0345\237\330\332!\232"
+	.string	"\252\366\345\337\210\242p\343BG\265~T0$KE\210\251jo\243\346C\035P\252\321T-"
+	.string	"\247\377\351)hxm\212$&N\325\213\252j\315\301\364\233\356\224\302\203\274\227\346 \\Y\351q\3504|]\001\2133\252\375\320\244\331\220`\001\017\237Q\265\376\320\376\322\231\376\253p\257\207{/\001\330R'\214m%w\272\240\266\\"
+	.ascii	"\253\260\244Dh\335fN\b\271\033J\016\305\275\310\f8s\266\007\006"
+	.ascii	"\214\313p\242\264\034\016\207\322^\250\355\245\305\272Vs\200"
+	.ascii	"@\302\n\212\331R\022\203\273\311\240\347\f\215\026s\263\301\320"
+	.ascii	"ZP\031ZI\201\023\346\306r\001\303M\203\005W\216c\353h\207%\254"
+	.ascii	"\326?\332\257\272\025,E\016\211\251j\035\374\254t\371j>U\354"
+	.ascii	"\310\324c\305\224\321,\361\341h\247Z\337\0304 \320\002\0211\353"
+	.ascii	"\006\255\303z\311@1\264\017\n\351k\303=\263\022\033Y\033\277"
+	.ascii	"\037K\227\231\n\020\214,\322,g`\271\205\335\2570K\177\034\356"
+	.ascii	"ecw3\0053f\250\213\321\276L\\\277\213\323\274\bz\271\262\316"
+	.ascii	"\247\2359\346@p\277\300\210\315\270\251\232o\214\026\362nw|\325"
+	.ascii	"\2058\207\225!\033\270\220\366\347\227\001\006A+\201\030!\313"
+	.ascii	"\214H\302\254\205\007"
+	.text
+	.section	.gnu.lto_.symtab.e3e4be3998a0c84,"e",@progbits
+	.string	"buildTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310"
+	.string	""
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312"
+	.string	""
+	.string	""
+	.string	"targetName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e3e4be3998a0c84,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
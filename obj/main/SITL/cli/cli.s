@@ -0,0 +1,8091 @@
+	.file	"cli.c"
+	.section	.gnu.lto_.profile.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375 \tI"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\276\001"
+	.text
+	.section	.gnu.lto_.icf.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\225\r5;"
+	.string	"\372V\b\024< \234\233\016\240\006)rT\234\225]\262\3266\324t\265\361\345%\025s\320\316N\352\f8\f @A@`R\302\344\005\203\305SC\t?re\230\2503\331{\357v\243M\233$)\0031\001+\0015\001v\214kJ\004\036\373\262U\3538\032\226\304\245^\222r \364\177\240\037\360\003\376\207n\353\332u=\340\265\347\330\026\363\210\177\031\\X\320\001W\340F\0266\342ug\347c\224\354\354Y\346)\247\301\317\317\317\327/\340\353\367\251\315\016\343\330,\370\3176j\366\212\002<\366{\276\007\300\323_O\377>=\003\025\360\360\315\215\201\021\305\243k\264gC\324\263\355h\232\004\234^\3342C\207`\272\215\343\362\023\302~u\336\033T\354\002\304cN\265\257\346"
+	.string	"\251\224/\250\332O\327\232\324d\"@\266\022*\312\231\342c}\253\034\307\306\007\031\340i\264\260\026\262g\347w\376\253Yo\216^"
+	.ascii	"\270\\\331\245\005\363`\257\037K\0371\307\030\356\334\365\367"
+	.ascii	"\241)\344\272\336\266\365l\221N\263\266\337\376\247\326}~\307"
+	.ascii	"\35084L\023\267\331Z\235\177\376\264=\271Fj\375\365\377o~\301"
+	.ascii	"\345\311\263\027\233\345\333\264:\006\216\2367\246\237\376\371"
+	.ascii	"\347\217gm\233B*R\353[\377\247\\\27190U\252<\215\201\254f\276"
+	.ascii	"\316t\351K\277\377\177\177\376<t\350b\245\037\357d\374\356\n"
+	.ascii	"TJ\314\257g\225\323;u\256\256\"\334\t\023\363\317\027\376~\231"
+	.ascii	"F\333\334z\251,<\366+|\205\257\322\240t\237a$\246\232\276\251"
+	.ascii	"\351\233\230~\3519\323\327\277\364K/d\345\322b\016J\375\365{"
+	.ascii	"\005\3747\342\216\203\314\f\213\240\360\365\204\347\357\023\242"
+	.ascii	"q\0162\004\277\271\204\277_\350\216{B)\006\"\302\337_\235\303"
+	.ascii	"\272\200\341\017J\257\244\364I/4\r\223\246\361\215\007:\311N"
+	.ascii	":z\373\203z\231B1_\242\036@@z\244\372\353\007/\375\243?r\360"
+	.ascii	"\016\036\352\252\325\005\313m\310~\226\333\331\354\363\267\337"
+	.ascii	"\350\215>+\0332fB\201\212?n\360\374\2533x\256RT\303\275\250\025"
+	.ascii	"d\223\241\016{\253c\303\260\3409\203\307\376\202\347?_\327\266"
+	.ascii	"\236iNE_T4D\323C\217}\005\317\177\350\211~\350\347O\360\374\263"
+	.ascii	"\362\250Z\035;\013w\177\231\212\231\251\345\223\t\213\340\205"
+	.ascii	"n\353\341\335\033\226\245\376X\003\177\340\r<\177\272\027\255"
+	.ascii	"p\273P(\360\005\376\251fn\340+\023\202>\350\177\232\271&\224"
+	.ascii	"+\201S\341\354\"%#\\\237\004\317\177\305c}nD.Y\224\276%\025U"
+	.ascii	"t\373\352Z*>\305\333\017te\353[\263\353XU(\276\352\371\2117\361"
+	.ascii	"B\037\316\204-;\023+\347\337\035h\277Z\242$\t\177^\342\353\237"
+	.ascii	"\247d\266\202\\$\001\036K?\275#\303)\223Bx\204\317Z``/#TOS\375"
+	.ascii	"M\365\374I<"
+	.string	"\375<\375\016\362\nh\221\237\343\025S#\"5\365\\\352\353\227\2322\346\0252\016\031\361#\276\376\321n8KH\220\210'\372\037[\320\214\016_\020\244\017\361D_\275\0079\035\017\201p\271\213\3452\364\007\247\253\244\201A\364\321C\276\273\234Y\232\360\220\353\262\324p\355`z&\020\377\341=\274\207\357\241\347\350\315%\352\340t\250\340\350X\016\034\364\323\265}\245\006\360\360\006\377\254\304:y6\236\376\211Z\031\007S\263F\024\217\212\372\373\243~\303\027\305xhk[V\034\376\356\360\364sx\376\034~\303g\253\213\212\201\2272\356M\255a\234\030\035\313\n\247\037\214\027_\343\345U\341\262@\360B\324\266Hp\330\n\336\271\204\217}*P =A}\206\327\360\031\236~\f\377\364=\001\234\327u_;\321\356\245sI\360\234g\017\323\004v\302\247\177\262A?\355\364N5\036\3735\240z\334\227Mo\037\354\217\265"
+	.ascii	"\341n\224\273\023\353\202\366\333\267m\031\371\331\326\267\314"
+	.ascii	"W\257\227I\267\007\306\3351.\213d\007\234\252\211vB\366\277\273"
+	.ascii	"\363\362\260\260\373\36581\360k\253\367\361\361\3474\236F\365"
+	.ascii	"\022\215\345Y\327\302\343\256+\314o\337\343\317\255\254\336\352"
+	.ascii	"\253hK\256\317\307\256\327\345,\023\355z\026.OJ\202!\366<n\257"
+	.ascii	"y\353\270\035\217K\315\312\316\302\375\316~\243\267_\304\023"
+	.ascii	"\021\321z\224\225Y\275\215\277\341\235\230\226\036\3451r\353"
+	.ascii	"\252\263q\351\327\222K\331\241\360\330\263\f][_\343\264\037\330"
+	.ascii	"\266KW\213e.\026\270?\341\325p'\340Ww\302\255\203\223n\034{\332"
+	.ascii	"\327xnF\305t\264\251\347S\317yfo\345\241^\337\362\231\016\344"
+	.ascii	"\244\225~6\343\343\331\314\217\021\261\227\311\262\027,\272\277"
+	.ascii	"N&U\004\203f\256\217u\261\305/\242\335\353J\345\353nK\327\312"
+	.ascii	"x\031\037\343c<\214\307\376\375\342\353w\361.\276\305\037x\026"
+	.ascii	"\001\2014\250a-Q\306\320\210\b\211H\222$\351\361\004R2\207\210"
+	.ascii	"\354\016\022`\344\031\013dD)32\"\"IRP\250,s\361\214-\212\005"
+	.ascii	"\250\370\251p\r\236"
+	.string	"\374s\230\256\304)y\2424\\\212\177\004\226\321\337D#\360T\243p\220\2509\263 m}\330\027V+\202\326\216S\210\201\242\337\351z(\204`\366}\007-\301\330\216\276\344\355D4\200\336\2411\325\017~\312\007\277_bFE\232X\3625\350\374Z\362\343o\312r|YK\326\341p\301t\004\036\202$\272{\376\315\270\334W\201\363\220\360J\314:$\320?\262[\001oU_\203\223\345\177gu\315\244[\316\223\317\207\343c\304\234u\301\223\302\371J\277\262:\213;\234\273\211\351]\227\240@\"\205G\323h\026\214\365\004\204\372z\337/\0201\366\037\261\244\346\237<B\211Z\217\004\002\362\336\372\350\344lR\f\201\357hL[\344j\275L\317\n\204\270?\034\372c\032U\r\365x\027\327\203\243&\315\215Q\027K\332\321\346\342!A\337\253\211\303\304\353}w\352.\352>heDsT%+\314\356\254\203LN\254"
+	.ascii	"\253\253\201\255\317\"\261\375p\304\0307\201\024\300\357\374"
+	.ascii	"\265\266N\017u\323\3750\3338#\200\016,\263^\246x\023\225\026"
+	.ascii	"[\340%\242\347'0\327\237\370\323\321\026\2119\313\311h\003\372"
+	.ascii	"\317\\Rz\023\306Y>b\023\031\376u\267\244\003\332\223\2509vu\f"
+	.ascii	"\263\330qr\316\373w?o\212\n\t\202\026+\273\303\030\333\302\251"
+	.ascii	"7\357\023\255\330\016\002A\243,\356/\204#\207\352n\377f\2758"
+	.ascii	"\203\323\017Q\260\204\341\315\200\375\013\252L\335_\rC\345\241"
+	.ascii	"\367\033\200\362\274\272\022>z\226\016\360\340\327S]\031tl\342"
+	.ascii	"5Kz0\343D\257 \027\373\231TL\362=\030\b6\205\215\344\212\270"
+	.ascii	"\307\265\245H\330hDH\361\3104\013j\253\037\220\024W\241\200\316"
+	.ascii	"F\020N\224N\254\236zkR\036U\247\310X{\344/0\373i\201\351\247"
+	.ascii	"\036\035\317w\307\021\235\274\213{\344JL\031mj, g4\034\231]\031"
+	.ascii	"\335}\347\005\203X\227\332\234\214 \212o%\003u\345o\300\306'"
+	.ascii	"h\242$\371 \265\335\226nE\226\362\253\245>F\266\306&~\355\001"
+	.ascii	"\021`"
+	.text
+	.section	.gnu.lto_.ipa_sra.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`2\023u&"
+	.string	"f\232N/\300\262$\215\001\374\314\363u\025\345g9\006\3417\n9\310\376"
+	.string	"\331z>6\"\246\021\377'\007w\030\263|DG\257\244\265\275[kD\312\224\0029"
+	.string	"B"
+	.string	"C"
+	.string	"/\275@\301\bv\017,Go\240\300\004\374\232U\022ms\006,\235F\353$\222V\217J\2431o\001"
+	.ascii	"\314\023t\366YO\347n\273e\0262\273W\322WZ\310>yX\323 )\324Q\330"
+	.ascii	"\211"
+	.string	"ML%:\223p\304\331\342\210\270\020\n\332\017\304}Pv\036\364\276\003\007\333\240\252\341\313\260a\370\202\205\nK\247`7a-a\251]\204}\b\017t\340w<\222Z\022d6\354\030\254\001?R+\365\021\r\021\022d\371\003\371\261\217{\230\251\222\207\271C\207\226C\351\244\036\20776\241\032;\215\031KF\f\030/8\272\242Q*\201\335\330f\001\314\306n\027-\324Rmjz\336\354Y,W\250\260\356Q\371g\336\214eT\232\354\206\375d\224c8\212\t3\030\245/v\034/]\226\313m\321\242V\026,W\226\025\373\253P\231\"%\312P\236\354\244\311\316\344%\222\222\325Y.U\222i\215d\035\331\310Et\"\246\237\201\340\250\001\316\032I\n\222\351\321\004H1&\031t\346\001\022\200\022Q\216hA\246\2203hFF$\020\t\222\224\221\202d9\235 \004\314k\003N\315#\\XR\275\342\025\0309"
+	.string	"\252q\334\027*\332{\210\031\317\333"
+	.ascii	"r\266\315)ptZ!\027\325\245\327\023\022Y\032{\327&\301\007\006"
+	.ascii	"*\212;\315R\221,\236\210\377(\204\367\240,1\375SqO\277\265\317"
+	.ascii	"u\320]^\250\376\366=\351$w\270\317\344\375G:\355\263\210\032"
+	.ascii	"\265\"O\313sC\261\267\307\275C:\321\033R\031\003E\304\337\377"
+	.ascii	"\234 ?\034\272\022a\243\326\0211\265\251>El\332\312G\030i\224"
+	.ascii	"\352\353\035\342\342\277\213h#\370\307\342\334\022\252rT\336"
+	.ascii	"\\:\264\353\207\241\231\347_\311/\351\242\003\232\337@w?L\231"
+	.ascii	"\267\243\321\246\024\207\035\323\237\375k\227\221\026\244$b\031"
+	.ascii	"\314\210\177\267\207\253({\314\254\002\235F\372G!3T\207\003~"
+	.ascii	"\263\350\224\222\177\270\227\312b#\003\217\303\377#\320=\311"
+	.ascii	"\212\233O\363T\357 u\227n\330$\002\307lP\313\036\034qr$E\256"
+	.ascii	"\242\004Q\373\321?Y\343\252\263(y\246\035X\f\373 \306\376\f\023"
+	.ascii	":{\352\002\206o\312\211\214\300Lm.B\226)\203\263\251\263u\265"
+	.ascii	"\\)\360\225\246\227\246X\225\021\326\330D\271\264\340*\322b\006"
+	.ascii	"{\315\347\367`\363\250\032\001#J4l\002B\224\263\346\033\360\354"
+	.ascii	"\001q\334\300 \352"
+	.string	"\"\321\001\370\222\215\367O>:\336\007\244g\23582\216\034\326\005\264\345\004$\270\326\016\254e|\213\025\234\2121:c\177\307uGX|#-/l\257\036cH|\262,\266\363\003\204\301\204\353\031\203\251\\R\223\211\027q\035\344\203\255\301\266EoI\276\377\315\253\361V\373\016\224`]\251Q\261\224e\272\3042\2450\317N\311Sd\2449\214\001\004\260|\242\2362\376hY\203\375#)a\300\304\345g>I\023\024!'pw?\217\005\360\023-\177\3029\223\250\221\324\361\017\207\251\237\254\303\255\337\370\336J\261\324\203\333\315\316\f\347\362\301n\275\016\271;B\034\201{!b\223\276E\373]c4\304\035T\027\306F\217\214\351\362\303d\n\254\316\250X\364\374\030\315\312\216\350S\336\354\377W7\222\225D\350\220=\027T\300!d\302\315\f\252\340\f\002mP\320\232\005\002xOE\270\214!\331:V\277\314\303\231"
+	.string	"<\365f}\316\257\351\363/\206\321\255\242$_[(NH\247\210\270\261\301\252NHXA\330\030p\315\020q<\254\373 G\036\303/\037\260\303\250\305\316\200|H\007<\374Q?\232+csp\"r"
+	.string	"d<\217\370A\270P\270Ij\006Z\221\377x\r\254\231RD\321C\362Q\0036'*Q\226\3203I\226\362z\004\345\337\313\241\331\343\270[\342\363\031M\005A2\031\213\326\0316\366\213T\204\2720O\244gd\241\362\226,A\007#\035\347\274g\254\023U\3268[\357\337{\032\220\362b\316\265E\223PD\325\005LF\350\276\201\264\334\256\233"
+	.string	"0P&\2469\346JZ\210t\037\317\240*\t\210Z\036\376%\tc8U\350h*u\3570F\375\242.\f\317-\375\002\233n\324\362\347\255\246 \214\342\024\346\322\237\004^3\237\303{v\244\272\0218\342\330\300\372\354V\306\250\211\305\037\036\334E\353\235"
+	.ascii	"N@\024\315\2407\251Up\006"
+	.text
+	.section	.gnu.lto_.inline.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\260>-\246"
+	.string	":\251D$M \222RI\007,\3530\363\024\346\377/\024\275\337\203\377\\]\253\210\377\206c\237\202\252g\022\374S\302=\004\264\332\311\335]\033\304\356\250\210\277\222rA\310\020*3\203\230\253\314\3146!\361\304\315\245\242\023\030\267s\234f\021F\332\336R\246\372\001,\002I\002_gTC\261\221Q\234\207j%\376\031\305y\243\243n\177\246V\n\366\235\211(q\202\351\005\364\2240\376\037\321\323\303\311\276E\356\275B\027 ,\200\022\310%\333\275\027\350"
+	.string	"\250\301S\003+\242a\341\271\001\235\210\213\225\f\236\032X\217S\203a\341\271\371\234D\333h\376\020\237\303\356\275\304\022#\212\365\377i43\237\227jS\b\271\374\217\\\332\377@\303#\227|\246zw\357->ES\243\343\215\2161\354\217-T=71M\276\345+\243\312\371\355\030\344\033\241\367FH\335l##\364(j\357Q\324\"\245v\306="
+	.ascii	"o$\026\361\246z\030\232\377\034\365LL\307OM\325\222\261\024\331"
+	.ascii	"\371$\307)\027\235r(\027\235%\270\350d\352*\245\225\346\211\007"
+	.ascii	"\375\370t=\253\027f\017]\320\373\214\005\226m\351\241\362\236"
+	.ascii	"\341y\232\332+\260lKS?\t,\333\302\363\363?\332?'\373\314\275"
+	.ascii	"\227\347\025=\036M\252\315{\251\206o\364\370F\217\232\357\254"
+	.ascii	"\013\217o\274\222\035\276\320L|=K19i4\024\034\023;\212\237Nb"
+	.ascii	"C}xN\326\252\263./\350\373Oz\361\362\323\247K\255#\260\314\307"
+	.ascii	"\320\2157&\253\331\233 3\375\361G\276\347\233\254czp\322F\350"
+	.ascii	"w\251\2130\255\310\210\216\242\367(RSi\225q\3257\212\266E\357"
+	.ascii	"\333\316\3502B\332\352\370\366\276\251\343\340a\021s\300\333"
+	.ascii	"\336\244ZXX\270u\376L5I\331\034\220\363'i\271\350\254lk\\t\256"
+	.ascii	"\2511\223\311?\323$\236iT/YYn\267;\247\306\367}\247\306\342\273"
+	.ascii	"\370.\"\325{\257\216\372.\362}\027\217\232\177\274R\rz\037\337"
+	.ascii	"H\374~+\365\275\367\236\277\324\275W\371\027k\204P\317\324\374"
+	.ascii	"\037\353\223\315l\254\306N\035u^\343\346\242\363N\255\304\307"
+	.ascii	"z.:\235\032\352<\347\245n\336{G\3749\256A\222?\217\3509\377\330"
+	.ascii	"\240\036``a\210\260\220\376k\215\n\307\216\016!X\371\246\005"
+	.ascii	"7\241\345\310\245\026?\351e\217~\251\202)\337\276l\217\363l,"
+	.ascii	"\320m\b\307\326\211\243\241\376u\247m\215\350\023\3244M\323N"
+	.ascii	"\337i\214J\370\207\367\227\324Z]]\370\210Im\177|\262\357\356"
+	.ascii	"U\026o4J\031\274\367\376\240\314u<\024\323\353\322g\301%\340"
+	.ascii	"\372\343E\321\273\3002<\027\311\0162D_\234\372\342\225Q\343\264"
+	.ascii	"\322@\341\037/\013m\326\244N\b\307\260G{F#\001\323["
+	.string	"\016]\250\\\352\262\354\330\336{cTf\025!\033k\274GuN\037\033\266b\337{d\221\332\r\241\225\030\240\243F\353*\222d\330\350EB\177\257\214!|4=\246\35115\032\215F\243\361\230\036\217\351\275\214\262\355\033\243\302\321\205\361\343\243\235\354:B\332\314R\274\357\025,\240m\320\200c\206f\226\241\231;\252\231vL\265\267&\233[\024Q\2265yY\\\205FP\227E\027,\305\247\005\004=\274\344\374kT5J\352\220\t\360T\251\260\201\255\t\340\016\324\313\302\366\255\377\017\3734zF\221\313\324\230\242\366\2427\275\226\233\315M\276}c4\020\036rf|k\274\267I<\204\230\032\356\017\314R\200\243JUn\207\037\240\360M\217\367G\031\265\253\013\237\033\337h\274XC0\230`\304\220|{cf\033\323\310\024qn\252A\370\200\003\366,g\340\310\345\337\212\005l\333[\333\313\2172f\304\253H\241"
+	.ascii	"\337\362\265\216\324\262J\315w\245\354\31365\2237'hD\034=S\207"
+	.ascii	"M\345\301\351d\275Sy\200<F\246\346\3500\202\250\271_\234D\035"
+	.ascii	"\325}\205-k\314\310\230@\221X\005p\366\347d\2075!\2243\264\267"
+	.ascii	"N"
+	.string	"\225\007\341\022$%\234\275\324\314}\256\321Z\276\214\361\273\334\017h\224\257P3W\216c\032\035\305\265i\304\037\032\032\372P\021\26374\366\306\313[\230\271p\312Z\370\206\224:3]A%\f\370-\212\032o\223\032o\016\0321\373T\031\325|\243Y*<HqR\\\243\002\004\021\023\177\372\225M6\325\367e\364'\247,\213\213\327\340f\323d\212 R\337\236\0213\337\253ML\377Re\342\203K\314\330/\242\003p\013\001O\262\222E\225l\375\253\230{o\372\244\363T\026\337\023-\034\265j\007Y\232\303)\036\r\020F\274=P\035\361K\2755dl\314\331T\215\354\005R\031u\336\225\225\026\313\324h\232\254}\371\031\033k\243\327\200\007R\202\247\007=\224,\t;\336e\3048^\027\252\224\315\301A\373zXxp\304\257\300)\022\337\372\246\246\3645\3540\216\\\032mz{\324Ha\366\351\231\343O\255\224"
+	.string	"\333\3209\324\3209\364Up\216\276\302B;AW\341\310%73\017\021\271\224\242\344\343\332aC\337\312\025\033?\016CS`\344R\317\207\237\033\2564\f\3300s5\005\316\370\027\277\177@\203AG\341\310eR\255o{\376Lw?\201\317g\252\312w\207\255\315\203\352\345\356"
+	.ascii	"<\231"
+	.string	"\2731A\216jN\023\240>\334\016#\203@/\241x\346\374Y\027tnu\026:M\272\t\372\013\355KV\006\037\301\376\025o\333\256\3703\321\217Sm\316\365y1q\364Mu/\212\026;{\013\233\240\t9\321\202\353lQ\347I\024\274\307]\004\243\270\363v\204\334\371s\312\263T\275v\b\022X|c\367\n\013\377\200 \350:!XS\310Eu\300Cx\334\334\0179|\373D\334\250\001;\231\"\b\267b\304[4\"\226\374Lgx\213\302\354\314\341\321w\320\tC_\265\231\332bQ\243B\231rk\223>}S\337\251\274;\264yL\345\331\031W4\337\361\212\206Rr\256\350\250\256g\033\335\365D\216\333\323\374\003\344\222\212\373ZS^cVzI\233\270(\203<\207E\007\177\275\025\022\342sK\306\347g\022EB\270\345\035\242\243h{e\254Sc\325\331{3\252h\356\034\234\234*^h\036V\354\260d"
+	.ascii	"\304\001w\025\232\032\301\236;X\350\370\231\330:R\007'\200op"
+	.ascii	"\252S\207\262\271\301\"\215\016\3025V\347\347G\"\0271\256\376"
+	.ascii	"\r\264<\177\032\265L\225\271\302\005j\324\2538@4\016\034\203"
+	.ascii	"Wj\206;r\371\022g\267\356\376\261\312\272\363\177\252q\270h\321"
+	.ascii	"\352\013C\035\304\242#\306igf\223@\245\311\266\234a2\224Q\301"
+	.ascii	"\310\235\345\261\016$Y\362\2160\025\373\327\223I\301RQj\241Z"
+	.ascii	"\0303\334D\271\355\304\035\264\276\202|\261k\321\247\0034b\206"
+	.ascii	"\2023\033\226\022f\022\2365tJ\214\220\310\022\227\325u\342\274"
+	.ascii	"\306jQX\216\252U\036U\021\241\247_\026\357\232\020\276\351\371"
+	.ascii	"\227z\355\212\023%\n\303\177\f/5\024\237\235K^ZeY\237;_\261\026"
+	.ascii	"\3106\r\235\255\244\375\374c'\r\356l\n\240\030\031\326bFS\252"
+	.ascii	"\321\345U\001\235\253\240I\215U7\347\f/\233\351fM\t_1\237\261"
+	.ascii	"\321\021G\tt\247J\2229\2423\025\236r)l\366\237\217\n\373\250"
+	.ascii	"r\207\240\325\033\036\263\314\375\352\324]\276P\231k\253\363"
+	.ascii	"\221\0063\362\3455d)\261\323F?\275\327\364\334\302\240\347\256"
+	.ascii	"#"
+	.string	"\227J\366r\021\252;\364\215\325\2222\022g\256\237\211\334%X\177Xz\262$Q#\022t\036r~"
+	.string	"\b.*\255\327\235\205@\201\243\323C\243\344Q\001!:o\375\226\021S\347\016\001?2(\205\017\234\201\334?^*;\f\033\254\253\364\212\232\025\037"
+	.string	"g-\356\237<\314l\313<$7\372edO\3140\027\n\256b\252\363UV\340w\357\305\340\254\243\307J\317\355\260\256\347\347!\2376\373\242\006\314\250\233@\274\354\fi\275A@\253\024/\244\364\316\027vi\200I\016\346\254\344bUV!\266\246\242\fAI\003\202\311"
+	.ascii	"\347&\017\034P7"
+	.string	"=\243\003\177\360\r\321c]>\200\341IC\302v\265\302\334\0345\"\377\3417\234\261\341<?\213\270m{ub(\272\274\270\320\270`\221\343G\027\276*Cw>\370\320T\234\206\236:\302\264K\373\240?v\204pN\003\342\fT<\316\254\251\264?\030i\374\270\fq\301\307`I\204\241\267Z|\240?\364g\241\216\023\027\306\n\001wSeX\266\007\0331\256@\"\022\244\326\234$\324\027:P\254\215y\274\005\2428l\313\2357k\027t\330\027\232\340\351\320\033\311\032\344\256\253P(\354\007\276\300\001n\203}\004\205v\250\223\030{\216\223L:5#ISH\007\303\022@\340\230@\036\224\214\207\343\360\003\023\200Mg\222\020}\032e)\305\224Q\306\020\"2\"\"\"\"\"\"M\222t\306\235\021}\203y\245\337C3,\221\n\370\212R\371\034\210\260Fg~\245\370\235A\002\370\035\252&\020G\351\257\331\001\363"
+	.ascii	"2De)(\223\375\216\031\224O\360\205\322t\251\020\345(a\306uH\225"
+	.ascii	"~\026\020\274.~\307\360\321\036\250\212Z\352\3663\005\215C\247"
+	.ascii	"\376ca\322\215j\371&@\\f\326u\343\036r)\302g\324\022x\231\027"
+	.ascii	"\034oEy\356\201\224I\337^=mk\003\225\036\033\001\261]G\275\023"
+	.ascii	"\216\370\023q\f8I"
+	.string	"]*J]\013'\344\214s\202D\232\304HH\321\266\\\316\345\021R\332\237S\303\013\204\367k-\267m\241\320N\307\242\202\031\b\334\3421\233Si9\264KOf\3673Zg\007F\006\3536O\002k\035?\310\267\025\016k\036\227\304 \244\030l#D\205+)\006PY\205\370\377fn3\262\351\006]\005\254\315\324t\033\001\3349\341z\206\261\003\332,\323\365 \362T\021\r\032g*\260h\364\367k\263\373\322\3628\254\232\222\001V7\240{9\302\033\226\317<\2327)&\376\240\204\217L\226\313R\260W\2541CC\032X1.\323\270\350\342\"j\304O=\372\343\004\273UxV\251\3158\"\0279D\203\215\356\031\257\024$\007\351\033}\201\2177\344\233\016<\372\003\202\303|\310\356\247\241d\257\232es\017\f\023g\250\304o\227\276SrP-\215\361\354\356\266\363Maep\020\215O\201\005m\034\375\212d"
+	.ascii	"\321\033WCz.\364\205A\b\004\311\326\211\311\302\204\371\216\217"
+	.ascii	"\270\355\237\212\344\007hb(%B\236\331\331z%\2769\207\334\247"
+	.ascii	"W\271\034\351\300\266\312\257\354N\t\037\201t\211:s\356\363E"
+	.ascii	"\005\374\365\362~\250\373\030\031\034ukg\265"
+	.string	"\341\3029\bx\350a5M\323\355\nr9*Y)\364n\356\200\316\365+5\242U\325\2204\024\327MDJ\307\324\005\223\254\016\254V\371\361\336i_\244\316\005m\363HY\036\370\371\331/\237\2164\030\306\302\255\261\2204\201)\330\360\204\001\345\220\313XK\251~\272\353\310\235\b4;|\300\221Z\370\246\230N(\302\220\210\226\033\365\225\343GwC\207+\033i\242\357\234\350\270V\204\030\310\320K\2322\320\0026<\251L$T{\304C\274,\241/\252\340\370\3649\305|\245\324\305\305\353\346\252\276\257B\f\373<\255\313]\336dkK\244_lU\005\326\301v\276Jh \037\322\343\250\360\311QM\311!\311\301M@\367e>J\341\326~\375O\313,t\365'>\332\223q\267T#\317\355\243K\266\nch\024\225\235\332\357\330\352);\242\210\201\022ae\256C\240k\322F\177\234\235$\303u\233\345lj\376"
+	.string	"$\256\321\346\324\332\370\217\307\002%J>\300GIG\017\035\n\0034\223\300\372K\337\215\353.$\334\\\027F'\200\0017\351\3430W\255\363\323 o\376\221\016S\235+\3755:\337\035;y7\247\331R4\2461\210@6\220\021\027\020Z\345\233\312\301Y?\365\312on\037Um\b\225\262[\310P\023>L9\twn\305K,\330\2204\3053\230\026:\372\257`\243\366\347\n\020"
+	.string	"\224\263]u\244\3570iMy\017\232\022\243VV\320\353\026\266/#\364\343\304z\2221\313\343o\313\273A>\352 \245w\354\210\336V\262\f\344\002\317\314\224\235yc\215M3n/\2144\302\361,n\376\213X\342\323\373\256~\345\342d\303\213\206\305'\234\311\376\306\315\241\233\007\224&"
+	.string	"\210\264Vf\223zr\234\203_\235\305\213$R\021\321\3261i\207@\357l\b\b\353\237I\250\fkL\250\tv\320\036q\363?\251\300\320\030\3202\334/\013x\377\354\250WX\364\307\270\277\024\340\023kh*\005}\247z\337~\202\244\335\022\322\332y\bA\244\344S>C\007'\241\0019\255\205%\260\331c\023$\367\201x\372\333_0$\352\324>\027\303\314\257p\206\037\217U]\0352m\243\231>\236\210YX\330\n?%7\217(\210x\316\bL\252?\232U\203X\356\234\213w\007\274s)\241L\227\211\243)\356\356\253z\233\345\301\241\007\232\217\333[\257%\364\326\237O\363u\005\202F\325\345\235yH\3668N\373\350\344ADT8f\231\024[]\205\356R\270\335"
+	.string	"\225\020P\366?\031I\272h\362\354:\365\320\300\245U\370@\227\355G\366\343\242\237.\322\351p\316\\}\n?\225\3755e\243\263J\232'\366\324\261\344\230\223\314\245\030\256\340\333H\244\221\230$\241\022)\200\275\3007\001\325z%Tt\315E_\343\256D\211\216I\31125^W\024&RI\3237\b\251p\3250<O\233s0\022\324v\340\223A\3701\243V 5i\226\344g-\360\224\304\342\302\332\b\277\263\262\006\321\214p\244\357\265Q\306\n\002\336o\360\324\220\344Cf\nXl\343Wk<\233p\322x\213\256\343C\371\311\230\002F_\346\260\367@8tAd\"s\340\217\003#2dF\002\213\377W\253B\016\031l\340\215\f\330u\206@\330"
+	.string	"\260\270A\300Y\023\021\242q\026\273I\353}LJ\363\372\343\307\356\217\007\237\204q\334\244\323\222\250\246\b\357\033s\001\255\024vch[\024\331{\207\026\025\245\311\200\376\2065\353M\024\021\022\307\361\252\355\325Q\326\203\207p\202\001}e\t\n_\201\017\342\302\225\001\345\271\032\273gH\264\302\244\342\026Ehji`\0254=\263\024\336\320\033&?\343\352\353\207q\312\334\267\317\200Y\233H\304\210f\210{pF\362\204i\357\330\242\367\235\212Epg\203\211\324\301o8\371$V\364\277\272\034\265\013\271\330\264O5\252\341z0\302q\220$\201\020\016QH\373\224a\307\231K2 F\003\232\316\222\311\276\017\251Q\215M)$3\324\363\342\307\317\367I\263qt\236\340"
+	.ascii	"\206X\273z'\b\004\201\275\205\357l\264I\220a\312-\257\216:X\002"
+	.ascii	" \256\032x5\357\027D\222\323W\306>\353\005o\326a\377"
+	.ascii	"F\351\260\261\372Z\336\375\363e\003\271\3516;W6\272\242\334H"
+	.ascii	"\361\001M\367\211\336\343%\rh\376\265\351\005t\277\365V\306\f"
+	.ascii	"\201d\t\rv\211\013\034\211\034\301\332V\344\037t\360}\2154\032"
+	.ascii	"\027G]\by\323\326\353\335#W\005\203\255A\n31\013\265\216\262"
+	.ascii	":\370\240\231\034\f\013\220\322E^l\005y\002\306\275\263\247!"
+	.ascii	"\300\026\326\300\237\033\342f\201>\327\344\270\352v\3306\360"
+	.ascii	"\361\302\232\\75M5\212F\211G\316"
+	.string	"\321\343F\037K\300\311\246\023\250\ffm\215\206_\314\312P\320X\340Y\336L\361\372q\315\245+Y\3077\236\200\224\317\227aZfBR\234=_\255\242k\227PP\264Z+V\032j\272\3262e\341\312\355\310\207\254l\3614\037\335\201\230\306\244\003\033\256\350t\241\315\022\\\2643I|\3714\"\251qR\025\017=\267\243\271\320k\336\356\267\273\200\255\377\001\300\264\307\017G\336{x\322\342\024\202\353\023_?t\213=w\307@gF\256\031C\312j\213|\b%_\352>}\366eu\265\355\006\343\260o\024rkH\262/\300\3362CM\325wf\007\264\f\304\250\366_v\037\265\214b\204\263\344,\342\233\223F\377\352\016\301\3041\245\264\277`\370R\257i\302,\273fe\264Q\346\343h(ma\222\250\312\r\237\n\022~\0208\302C\370,\341\373h\306?\340\026\261\001\355T\320\004\253\376\244\217\030\256l^t"
+	.string	"\r\347\021\002\036\217\007\3746\273\r\330\376\326Q/\342k\225&\021\321*/\bG \272\213!A0'+\003\226nEup\211\262\205\316G5\002\362\202\260\021\301u\234\332o\225[\204\022\224%\211\013\233 J\276\271o9,\3632\222xZz\240\307KJ\007\251\204o\266\027\277'\237 <\013X\020\355\"\253\216Z\333\211]\275\326\2736#\005Y\024\002:\363f\260\235\372\246\331Y\022\247\035,\243\032\231\354C\026\240\b\205\244I\237\300\361\271\200\207&\212\331\377\007R\337vw\t\031\252(o\334\030(H\340{\304v1\305\365\254\253\356\333\355\230\005z`!\251\005su\017\214\375&\340\376\311\213\021\347\215\222iU>"
+	.string	"]\247\020\362\004\037\177\177\235\327\266a\207\326\177\001\035\317t}\017\253=\210\001H\b"
+	.string	"\336\326\376\377.\361\312cC[\353\256\352E\352\f\324A\354\333S\013:\356\312Y\2512\361el\365Z\311\020\017\201Q"
+	.string	"\372Z\351\363\302_\266RZs\245lin\276x5ug\007\2407R%\"\234\223\322\300\310o\367\2400\266\235\326@\276\250\263\211\301\2161\210\232\320wfC\316T-\210\206\342\262\356\365\361\317\001z\324\237\356K\274m\310\201\002\265\366l\346\204;\244\205\031%]\332\277K\243\343#\346\326N\\G(\261\030/\250\3771\005"
+	.string	"\032$\242\b\370\271D\n\276\370\301bs(\362\357\342HL\240\020\207aw\300M\032\201\023\262=A\315\265\350<];\366&\361\030\022LH\025\n\305\203,\034\211\207\323\354\177\005<@k\266\016$\\\270l&\216\237\b\367\0011L-f\007\003,\374\256C\321\325\213\205\2263\325b\334\250\225Rl\221\310X\341\243\316\n#\035\006H\020\307\262\277a6\246\314}\2547\370\210\030U\376\350\032\305%\253!\243\362\216\370\205\375\002\327\306\244\323\212\207D"
+	.string	"}`\316Z\202\303Z\016\037?b\b3%$\006\272&\030\207\034\032-\313\337\035\205\262N\321\206\317\343\275l\001s\024Gs\266UX`\211\023F\327\357q\260\036k\264.\252SPK\311\305@\321.ZqZ\034Z\245\016L\234X\236\233\221n\254Fb\030\361\322H\224m+\364\275\350>\342uh\341|\274\375MZ\315\342\236\376\332\032\n\n\372\b\344\240\034\036W\216\027<\266?\004\020G=jf[\"\210\312B\t\375\375Aj\231\004u\243\304\231\375\234\217\0228\302\tSp4Hd\"\267&:V\324\352\314\273\ro\200\270\263[a\274c\007\351\300\026\353\312MF\304~r.\300\002\235\016"
+	.ascii	"\245UB\030S\034&\261\2370j\031\326\212\330\354\270\261i\004E"
+	.ascii	"\233\232-\032\260\301%1\315\2579\256\243M`\265H\2047\246.\365"
+	.ascii	"\022-\3561WA\226n\002R?\fd?B\355e!r?\266\242'\202tD\201\330\244"
+	.ascii	"\324\351\240\013,=N!\031u\347\330\307\212\f\205bI\360\311\246"
+	.ascii	"\006\261s4j\345\245\261\236\201\235\214\b\343m`KI\001\312\335"
+	.ascii	"?\365\242\336_\034\262v{\326\252\201\324V\202+\312@\252x\021"
+	.ascii	"Z!A\177\2647\020\266\306\212\260\025\235\312\257n\253\242\004"
+	.ascii	"\031?$\304b\274\2244\323\345\001w%\272F\237]\006\243\212\271"
+	.ascii	"\031n\255S\242}\364w@\344\035\246\305\033^b\304\220\030x\250"
+	.ascii	"k\\\3378\350\241\016\213\320\t\004\217H\003\242@l\216\r\350D"
+	.ascii	"\376@\367K\bIF\347\203\354\267\254\343\373J\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\275nU\347"
+	.string	"\352\032\331:Z V\252\232\016\274\335\007\370\300N"
+	.ascii	"\227\330K\332\371#\035\364\201*\315\001x\200\364\301\017\373"
+	.ascii	"\2628&\377\250\301\305\260\350\226\355\330\366\353z)\200>\376"
+	.ascii	"\355;-\002\300\221\323' \t\033n\300`\370\020\343f\306"
+	.string	"\264\256M]>6\217Q\034\301\320qms\227\330nIvJ)\005g\003\261\003\237\0039NBA\273\267\013\264{6\016\2758\364\2720\267K\212\224\223Q\340\341<\027T\247L\234//\274K\224y\300\374B\367d#<\234\007\304\377R\317\002\325\221\360p'.\252\323]\252\336\375,\347\370\024E\365\316\247{\223`\030NQ\352\311\003\211\363\224\004\252\205>[\350\020\200B\301\300\303\bf\030x\234(@\303B\237,\260\272\356\204\002>1-\243\246V\350s\005#C \245\200\311\n\332\t7\335s\027\246H*5\004\323\037T\230\021\260/\363\362h\201\207\2439\250\216\372\321\347\017SO\255\211\2407L^\300D\211}\3017\351\003\264M\246\031\254\021\214\300K\205\212\240\235v\035\224\352}\303R\241\236\222\222\222\022/\025\352\254\203\252\240z\307\204\t\332HT\357\345\301\224\b\027\246CT\357\250\020\325\273\245"
+	.string	"7\245=T\277A\361pt\207\352\273\265f\322\004m\032\003\017G1P\275w\347t\352\b0\3478\3073\360p\246#\314\254\217>}\364I\244\353\263G\237+}\252\370"
+	.string	"\273\247\251\213\352]\347\300\335\204\233M[T7-\231\246T\357\266\006\036\316$\203\352}\362R\241\314K\205\322\324\020'<\\\247\204\3528\360p]\225\352=\006\263\022\270\231\007\263\031\334L\236\240\275\003\017\327UQ\235G\024\036\256s\242:]\317\361\310\345\230\007\036\256\013Au\230=\273 \252wRx\270\256\002\325)\f\333\320e\033\332\314\203}\311\303y\225\352\036W\341\341\374IuT\001j\315G}\322`\356\027\326s\336\002G\242\372\t\2527\255\365\311\335\2710\267\013\314\271\323}p\263\347r\274K4II\211on\206\250\336HM\203\300\377'\273\223\352\356\001\276\302\303y\223\352\224d!\335\222\026P(\266\241\335"
+	.string	"\026V\330={\t\325\273\026\243z\2679\rF\020*\036\256\251\250\336\255\347r\236\313\355\311Yx\270\216R\235\026Q\275Mpv\217\240z\267\313Zx\270\336\241\372\026\036\216\313\250\3368?\366\344=\231\013\017\307ZT\367\2264/iN5\247\300\314~\023\004\017\307%\250\336>8\220B\217$#(\037 \326\314S\272\360p\274\303L\2373]\243`!x8~@\205\202\225\304\364\306\364\326\2723"
+	.string	"3\373\267{v\025\017W\253\276\354\222\313\345r\354\301\364YC\241\246\246\246\233\354\263\326'\020fv\001t\363.\321\336\033n0<\\\r\325\275"
+	.string	"\354\027\301\303\tU\017\303\303\265\252\333\200\235`\"\306r\021\313$\tL\306h\236"
+	.ascii	"\233N\274`P6\371\356I\244z\031\036n\246:\314\246z\2279\007\023"
+	.ascii	"<\034L"
+	.string	"\365\336\305Ac\206\207\243\325\233\317\256\317\234\207\343\352\215\324}\203\233`\216\302\315=\3039\336A\231w\320\346\025\033\3139\036ev\331\007w\307P\230\237\360\236]wrR\023\312\234\324\2046\357m\245\271\231c\226s\334\305\372\2745\26707\f\237\335\356\311{v''9\2002'9\2006o\022\223vo\367\354N\312r'\205w\033\251y\245\031\305\334/\273\313\275\316\354\262\273,\273K#\325g\252O\027\346F\355\236R\224\310W\372t\346\306\241O\034\330\373\364>\271\027\006f\366\275-K\026\273\340\024\001\035=\243\353\"\207\0249hP\275\327\344\314\fe\027\312\223\316QD\365\216\333\235\231\231X\317\345\030\006\314d\237\334\335\302\334\374\002\242%\270\333\231Y\t\037\250\013v\354\240\331\356#\230\322\026\\AY\020\023s\276\f\201\233s\274\002Js\214 \207\016*H\001\337$\321!\221\003\327\004\034c\340"
+	.string	"\003G\027\025\207\017\272&\334\215\243\0068\226\250\336Ox8\034\027\250\3364gT\357-\242\3354dT\357\363\212.\214\352m\006wQ}\231\246\212\352\313V\320L\251\216TE;M\r\2527\215\022\325\227O*\216X\232\202\210\352-\205\223\352H=\240\361"
+	.ascii	"R\026HZ EA\263C\022\027HAH\322\001\215\004\252'=A\323\244z\237"
+	.ascii	"U\220\300\330\027\374\006\3557\312\250\33644\274K\264\243\342"
+	.ascii	"7\226\034\b\354T\360\351\206\021\325\373\006\0207x\250\336@`"
+	.ascii	"\317\20071\323\204\352=\023F\365^\222\205\b\302\363x\227\350"
+	.ascii	"\214\027\036\230\301\242z\327\274\203\372\0227{\007f\244p\200"
+	.ascii	"\201\350%\270\273\231\025\360\370\303\214\b\252w&\336A\367\304"
+	.ascii	"\354\303L\016\033\260Q\245z\257\r.\252\267\215)\252w\0176\236"
+	.ascii	"\250n\203\006\325\333F\024\033\034\340\2333\252\267\f\022\252"
+	.ascii	"\313|Q\275e\240\250\336\311(Q\275\367\224\2239\242:\225\021A"
+	.ascii	"\365\226\201@\365~\202\273cr\254"
+	.string	"\001 h'!\205\201$\306\276\300\303\017^\036\251\f\304\220\021\263E\365f\f\304\360\240z\307<9\245`o\367\030%\252\363\005\026\206\230\"\252\307\374P\235.\214\030JJJJ07\250N\027&\0060O\252w9\206qR\275;at\250\336-\027\301\375\004\355\356\034'\301\303\325\260A\365\324\326\020\242\272W\303\002\325\273\2271\2527\343^\252 \215\341\341^\260\340\007\354\236\\\206\207{\201\301\213\017\325\351\022\262\250\216Zgv\221\3029\b\301\f\203\013\t\252/\313\004\365\031\304M\272\247p\247X\211\t\036\256\345\214\352H-b\264\020\241z\267_p\313\026\316\003\267TQ\275\221b\320\336\331\320\316\0017\267@\201\303\356\356\222\335\226\017T\247H9\017\307\342E\365\032J`\201\242zK\352\366\005\263@a!\242\372\r`\260\217\263\211\366\216\243\264\333\\\211M \340\356\202\340\216\302\375\003wIB@z"
+	.ascii	"\023"
+	.string	"\b\354\013\247S\b\312&t,:T\177\211\241\317\030\310\316e\212\313\224\223\027^\260\340\252S\227)\\\351\311\013\256\264\331%\227\"\243:\335MyQ\275\333\332\231\242\242z\227\222A\365^\tx\270T\007\252wd\237\251\221\b\251\037\252\2774\t\322B`\242\205\016L(\340\364|A\227jo\346\331)\227\3135\351%\276)))\345\220r@\365>i|Q\275\243AE\333\200B\371\200\371\013\346*\334|\362\271D{\347\355Y\243\006\215\035T\247)\243#\252w\027\321\270@\365\246\001\201\352-\366n\210ZBurh\f\332HJ\364\3119\214\200\256\004\f\356\311M\002n*\030\013\030\236>y\220( \00144\024\356'\034\200#\313\247\\.w\006\357\022\275))\035\365y\353s\206\266\242:j\212\352k\006\017\036\016\225\203\352\335\236\314=\320\266\241\354\265\006\302>\320\336e h\357\331\302\202\352\215\332"
+	.string	"Ji\005\213\352]\007<\334\212\224 <\334\212\0236\243z\022g;\361p\336\025\347\021\355[k\202{\b\332\251\356f\206-\347\236\320\261\317\225 f\202\031\006E\264\247\200\333\327s\00171\244\305\236\034\211\306\326L\370}H\263\215\345\027\321bJ@\031\220\215\365Y\265Z*#;\336\212\3418{R\f\301Qf\216c\222\247\305H\320,E\022"
+	.ascii	"[W2\250\202\352\267VF`\037t\204\325\003\200-\242\305\216\300"
+	.string	"\362\264E\264\2309\216I\304\027\212%\2652\031\030#\305r\307\336H\337\233\351\373\341\367&9\002\255,N(\212I\336\034i\037\312l\343\220\rSf\003\211\304p\307\242XB\221&\326F\033E\264\230i\212e\315\262\240pB\033\230\344ohbm|%!(\2222P\307\242Xp\302\357G\363\303\357g#I\364a8\376"
+	.ascii	"`qBQ\226\004\244\211O$H\350I\361h|\261\210\006\032\r}h\003\211"
+	.ascii	"\324,\216\031\273\211?\232\345\367\242lH\311\320\223\342\rc\355"
+	.ascii	"o\212h\261\220\004o \307\236\232\355\021~\257\003tdec\004V\244"
+	.ascii	"\265\362\021\300\016}\257\303\323\022r\365\374k\005\333Q\275"
+	.ascii	"TFvN\330\325K\b\246j\025a\005\241\266\226_}\235\225\220\217J"
+	.ascii	"\206\207\265V\257\227\320\316\343\360\254\212\264TFv\276\245"
+	.ascii	"\332\371\362K\201V\024+Y\366\246B\220\317\264\341\367/;$\213"
+	.ascii	"\201D7\222e\031\020\202(\254\355{\333\215\254\261\266\357\307"
+	.ascii	"#R,i\226\264\261\246X\212$\335\020\034e\246-\277\017\305\020"
+	.ascii	"\034}P[\366\206_l\305\264\341\347\373_~+t\305\222\024\217D\322"
+	.ascii	"\333\357\345\r\277\277\305f\345\016R\274\305~P\246\325\021eI"
+	.ascii	"@Y\f<Ru\273\372Q\265\236\207\345\243\222\241\305b\331r\006D\006"
+	.ascii	"\232\243Yt\004~\b\216\262\0338\373\322\006\244\350\b\374/m@n"
+	.ascii	"\340\354\177\211\021\020\321\004\311\217a\3152&{\033J\020\206"
+	.ascii	"\332\357Q\256\360\001)sb6T!\310\347\262!\001B\027\204|(l(\344"
+	.ascii	"\3536\024\362}\217\262\205\234\317\346\177\374\377\313\206.|"
+	.ascii	"\037\022 \347{\332\0303\207h\266\236\267aH4\332\371#\257"
+	.string	"_\026\276\377\2760\347\303\t[P\341\373\036>*\326k\025\364E\264Xh\223\r\335D\233\227\201\346\b\303\251\241\373\246X\232\366\207|\267\037\344\273m\271|{z\\\335\206\337\017\371\362{\235\"\254\236\226k\347yV0 \241\327\313\265\223c\313\357\177<\335\362[A\261\320\375\032\024\213im\337\377\370 3\033~\377\343\303\357u\304\"\032H\336\330\032\3737\276\345\347\033~\257cd\026\321D\331+\001IRUc[\256\277\351\351q\275N)\332d\340\321\207\342\r\243L\246\242\331\360{\236\226\352\303\357[\253\325\f\260\025\221\207\271Z_~8\266H\213%\324b\301Z\256\235_\275\\=+\"?\303\212%\303\352\365\253 \325\312\007\350\177<\317\n\266\263\202\255x~\365Z\315\360A.\354\257\202^*\240\324\226\337\327\300\331i\313\357G\212\264\231\240H$\316@\232\267\267\027\202|\037\306\220\330\206f2K"
+	.string	"\026prL+\004\207\005\234 tM\243\242\230\214(F#]4\266\374^\207\005\244z\240\240\237\362\373\036\345g\363\345\367@\276\374\276\306\307\242X|_\347\345z\275V5554\266\246\246\246[\036\031$\371\240\335\n+x\227h\026\355\3362\353(\301+)1\222\023\264{\367"
+	.ascii	"M\374\331D\207\223\352++\255\243\007\356.\007\031\325{\001T\332"
+	.ascii	"\351\346\020\243z\357\031\274\203\376\3468J\016-\2527\017\031"
+	.ascii	"\262\005;\241\035[k2\321\250>9\376\r\215\264\231\"\371\243\371"
+	.ascii	"\325\214\335\304\372bM\211\371C\212&m\205b\021\2621\324\240\203"
+	.ascii	"\305\264Fr\n\220S\203\016\004\250P\203\016\032[\201|VF\352\323"
+	.ascii	"\360\202\375\rOK\365\363\343\332\371\326\f\256V\f-\241\023\326"
+	.ascii	"{\257\333\327\211\331\037\3157\305\362\313\217F\313\322}\035"
+	.ascii	"\236\227\323\2263[\212&H\322\025I\360\206\220\004\215VV&\003"
+	.ascii	"\273]Y\221\004\223\230\2266\306JR<\362hR[\216\346\333\214\264"
+	.ascii	"\227\025g \315\264t\313\357I\361\026\233\255\314P,.K\367\026"
+	.ascii	"\233=jQ,\246X\262\254\2675p\326\355io6\260\333\225\365\366\264"
+	.ascii	"\244h\226\340\354T3$\312\304\362_\006\322bE1r|\221\034\315R$"
+	.ascii	"+H\332\216\3002f\305#\2604\355\320\213F\346\2074qfQ\353\321\320"
+	.ascii	"\261\251\r\277\027e1\242\221\254\211&H\272l\002\302\017\007'"
+	.ascii	"H\r\337\343\372\025\017+\b&\344\372\225\017\253\307\365\002\372"
+	.ascii	"\025L\365z\330\027\321bF\3468\316\202~\347\36553\273j\261|\200"
+	.ascii	"\202N\333r\261`*\037\027\320k\005k\261Z<\272=\210\210F\323\332"
+	.ascii	"\2045\340Q\214\354!\003m4pf\263\262=F\323\006\332\234\366\227"
+	.ascii	"\030\205\337\353\020\021\215\246m(\366\342Q\314\034R}\315\216"
+	.ascii	"}\035\261\246\304|R4e1\2427m5\032\353kf\266\234\205\037N\370"
+	.ascii	"y\353\363\256\026j\305\031H\022\375\221\327\207\2429$\232\"\317"
+	.ascii	"\327\350\330\327\n\346\303\3529-\335P\234Y\332\0303k\343\207"
+	.ascii	"1\031xDc\271l(\2064\361\215\206L0\311\2074p6\033wd6\244\211\335"
+	.ascii	"\276\\0\225\217\320\017+\b\265K\214\374\204\337\020\033\206F"
+	.ascii	"\331\316\227\337\013\355\374\304\354\355\273\005y\235\262\024"
+	.ascii	"\3110\004m\030\002\315 \024\206\376o\340\317\222X\371E1\"\332"
+	.ascii	"\270\223\302\226\337\220\362\243;\364\341t[\206\264qH,\277&\224"
+	.ascii	"cK\330\2334\221$m;\177\023\2633\321,\225\004\035y\271^4\024\371"
+	.ascii	"\233Y\314\274\371\276\360\323\021\002\332\351\331\036JH\3214"
+	.ascii	"\301$\037\024~6/CN\020\234 \237\002h\312F\031*I\256~G\005\226"
+	.ascii	"\313\352\224E\240\214\350\303W\315 \341y\251\\D\220\204$8&i\331"
+	.ascii	"P\214\311j5\360K\036\026\320\223\242Y\033\215\314\030\215\034"
+	.ascii	"\003\260(\226\"1|QVD\003\221\2304\3338C2\036\221b)\200\367\361"
+	.ascii	"q\275\214\354\300X@',\212%\374tz>\374tx>\374tX\037~:@\377?\203"
+	.ascii	"\212\206\023\366f\003q\254Y\216\262/C\361\b,i\266\277a\371\354"
+	.ascii	"\274(\253\373:\250\375"
+	.string	"\362\353\026\244\331R[\306xVv\345mi\013\277\027g1\2636\216\262\277\261}\257SD\213\315H\360\305!Z\254\374\222f#k\343\350\203\263\244h\022\201_\332\200$\261\225oC\t\232Il\345\377\277h\202\262/m@\206\304\233\370\345\f\2108\213\t\331\362{\233\220\357K\025r\\\370\336\226\223\363\341X\036\026\222\327\352%\004\333Q\365\b\265T?/[\222\"i3\207@\"\033\r\234\305\354\221\025O\213E\267\234\311,\335\220\245$Gs\234\275L\006\272,N\370}\215\305)M[\315\264\215/\223\201_D\213\225B1\213\023\256\212\264T\257\307y\255\210\374\b\265\036&\004\004\023r\r`\177\364\362\264\204\\A_\244\305\242A\345\003\3642\033~\037\206\b\250\223\027\253\224\305A\205FfDDF\222$\035s\022@@\210L2\226\314F\343h\017\023\300\300\n\004\301\210P\036\214\306S$\007Q\030\204"
+	.string	"\035B\306\030#T2#M\322\034\210\205\177\321v\236\fd\212\357d\t2\313\327['o\303\227Ndp\020\207\333\013\333\250J"
+	.string	"u\221L\006'\246\204/\331_)\351\177<\027|\201\260\236\362\0246\345\377\321\r\343\267\235\321\362\266\364H\305\340Ox\230\026q\247x\220-zEX\365IhNF\300|x\032\013\334\336kB\313\221\304shG\007\360\331t}\260\256\254_\217\037\212\034\346D\306\377\0027@2\361\272\006\226b\3350\332\177\274}]o\353f\227\206\2266\264\354\334\306\202\023C\210\371"
+	.ascii	"\f\301\030\277\252e\374\235/\"W"
+	.string	"?\321\033ZR\\\021\020\024mH"
+	.ascii	"Ob<\250,\264\233\341]\311\251v\320x\240\035MX\272\316\001*E\215"
+	.ascii	"U\274\034\225\212j\177\212\365\323s\277\274D\005\004V\326\210"
+	.ascii	"\310}\202\300\223D\263\017\230\354L\221yc\367\331\2574\021\216"
+	.ascii	"\027I\\b\344\270\353\302G\233\251\272\256A\211n\310\377\320/"
+	.ascii	"-\326\322PS\b=k\035\021\250\216\217_npU\212a\255\343\272\026"
+	.ascii	"]c]\214n\212~\205\314\210\320o\277\212\256R\253\364s\002\224"
+	.ascii	"\032Z\302\312Q\365\243.<l\016\bd>Q{0{\324\370\3058\003\225\210"
+	.ascii	"V\304\\\236O\251\346U\361[\321\n\024\212\244UL+\354\312\205\235"
+	.ascii	"\316\221\355\220\bY\365\277`\206\352\027\307a\t+3\001f\327\023"
+	.ascii	"_\336\022\246\227j\317\222\202\350\003\315\027\257\007#\335\360"
+	.ascii	"$\310\266\323(5j\b\310\336\316.\262~\342\251,B;\350\362\342\213"
+	.ascii	"\216T\203\256\375\347\302\035\001\260;[u\244\006Eo\357\270\241"
+	.ascii	"\231\0364\226w\221\231\202;;\333\264<ban~c\n\254\335~\366\373"
+	.ascii	"\017\256\254+5#"
+	.string	"e\371[\364\202rQ\331\374\001\212d:\377\371\217\3332 \020\002\030\236\377r\224pJRt\261\355\314=\222~\034\021J\247X\271\334\303A,T\254$\034/\0227-\350\223\244h\310\253\005\t\027\246\007\341\202\365>\373\310\3178\230\340sCJ\030\016{\2769\301\317\3516\311\026\265\312*\204\031p$s\372\031\";zK\032\337Z\266\030\361\373\245\266G\246\016\244n\330\332\270#\251e\022<$UE\200\300\250x\222\202\315R\263\377\345\212\253\352\370\005\013jq\340st\254\335\251\007\303o\343QM\345%\322\317\250e\320}\254\207\207\201\024\214P\313Y\276\200@\260#\025\227\334\3207\007v\023!\211D\227\272B\006\314\345\004\200\211\b\2518\210\013n\021\231k\200\266\030\275v\372%\034\005A\341\330\366\340\334\031\336\007\370\034\335\227\305\306A\346\220\356\0320\243b\346\304\257\236!\026\232\2767\277\300\032\317]"
+	.string	"\346\200\317\252\n9\007n\210Vv\034y\032\234\255\371\356\364\202\375\377sr\f\254P\373q]Q\234\267.\363EW\264\360\220\b\241\325\314"
+	.string	"\036/\342\351N\002\202\207\205\360\016\340\370\305\3712\325\025\323\022\024\233\356\202`i(\b\233\243\"U\325Lh\237\3018H\243\360\037\301\210\213\266Zj\210\355\034\233|\nt\037J\210\037\311@\316\340\202\037z\340\363\370\252\214\362\214\300l\352\235\036\264O\351\251\026\303\223\342\243\335O\001\016\304\003,d\276\307\205\211\243@\201\237,\317\222\203|\002>\nh{ @hT\334\025\374\305I@\023\020k;\352\256\246\344\300Z\354wSf\212\t\365\352:\364+\25777\304h\355\234\275\224\035\251]\230\211\257d\243\342+n\031\016T\267\261 T\310\\,Fz$P\343\373\025"
+	.string	"\207\375{\2244\001\343]\336\301i\343\032B6\024\252\312n\366\357PtV\361\375\006\177\271|\204\262<u\360r\263\304\374\031ID"
+	.string	"\367(\311\n,\316\f\005<\244Be:\2507\327r#^\254\2346-a\3675Ks\251\371\334,Y\352/\\"
+	.string	"\234\242z\034ma\252y\343\250\256V\320\346\253\274\310\253\325\224\343\333\311\246\374"
+	.string	"{\033=]\314CP\213\310b\231Q\n\205\262W\357\240\327k\2123lY\361\237"
+	.string	"\220ot\310X%^'\n\376e\237\007I\253\207?\307\330\254\241s\212zzL\036\301\f\005OW&\256\300\313'\231MF\037\216\237q]\223L\317rR\263\027se1\t4\036\037\220\25367C\365-@8\313\033<\312\337a\036\266\316Z\226R\027{\212/\031W9T)\362\214\233n\303`\200H\306J\004\260\254\b\020\320/\267=\021\351\242\025\271\315\016\225E$%\r~\271@V\262\330EGC\212\266\344\2603\017\351B\002\235\324\337\255<\233\254\377\252\347SKk\2327\233\270\350\023\234\"T=\272\263\357\"\314"
+	.string	"-\033\214\023\277\264\207C\313\231\311\220\242\213\251B\367k\r\302\227\0214\257"
+	.ascii	"\224\274\"\n68C\244\337\357\3265\252]x^\370O\212\035]\031\322"
+	.ascii	"\004\031\340\200\300\024L\330\261\254\344\377\037@\355\034P6"
+	.ascii	"\336\006\212\260\251\255f\354M9]i\306\205L\2725\302\021m)\020"
+	.ascii	"\006\254\0029\374\367k\345n\254\352\200yW\344\310\224b\032\032"
+	.ascii	"\326H\036\330\342,\236<\326\320\304I\252\250/\210\220\330J\267"
+	.ascii	"\270k\r[B[\216qd\274A\353\326\305\215sR\212\315\337z\235\030"
+	.ascii	"\023U|\252+\214\365z\202E\327\354J\017l\373{\242\333X\305QA\335"
+	.ascii	"Z\244|\016\266\316\035\356\301\264\nD|&)m\264_\266\314\n\242"
+	.ascii	"\354\267\323\2101\234\322\004b\233)U\253\031\357\210\177\220"
+	.ascii	"\231\3736\323\020\b\323F\362\036\233c\t\024\317F\342\357\245"
+	.ascii	"\255/\244\005\311\277\030~_\214\225\202SS_\2464\212\211U\221"
+	.ascii	"\035L\267\253\220&\3357\260$\203\027\373\330K\002\371\275&:\262"
+	.ascii	"J.s\303\330P.\312o_f#\177_\267Z\020h\265@Y\2539\330\006M\324"
+	.ascii	"K\337A\354\254\205\354\3626\337K\363\321\"(>.b\304\307}>wt\023"
+	.ascii	"\336\236P<\364\346\251.HS>V\027/\2539\300\f{m\236\177E\005\211"
+	.ascii	"\345A\337\2762\307M1\230\341~\315\360\367\230\244\253H\344\375"
+	.ascii	"\243\212\342\341s\001\024\307\277Ha\347\005\374PE\025\377\005"
+	.ascii	"\356\024\004\241C\264\353\272q\205\270\373\342\354\257\365\264"
+	.ascii	"\371Q]LT\254\251#\350\222H\265\264\024x\357\240\213\347\177\027"
+	.ascii	"A#\220\376\204g\376O\325e\271\357\377e\365\344\323\210\263\317"
+	.ascii	"H0A\243\323\307U\271\216Y\242\343\311\361\335\264\276\272\314"
+	.ascii	"o\223\254\226\004NoN\221VB\210\332\350_\362\275\024.\206\375"
+	.ascii	"QxTU\351\215\276C),SUp\201\203\202\027l\357V\215 q\250<\321\274"
+	.ascii	"x\313\264`QQM\332I\303\241\346[\227\275\304\334\322\200\341\342"
+	.ascii	";\273\007\370>5\243\224\003\304\210\311\321>\230:\370U_+y<\375"
+	.ascii	"\2120dW\230\265a\031\270m\336\035\220\311\216\201 ~\250\262)"
+	.ascii	"\251\2539\202\360*\302\320d\234\277\341\240a\021\316\252\260"
+	.ascii	"\004'\263\246/L'\303\201\205:\261Y\031n\327<\b\303\tI\300\177"
+	.ascii	"\335\r.\t\302\234 \263v\336\026\362V!b\353\034wg\255]y\276\250"
+	.ascii	"!\271W(x\236\242KZ'-9\302#x\265$\361\332\373\234\322\351\234"
+	.ascii	"nT\303C\370}\242\375M\237\r:\326z\376\227\327eo\2303\345Vt\035"
+	.ascii	"\277\323\024\024\236|\320\373\363\307\210\262\2571\331\263B\214"
+	.ascii	"V\221\024\005\ra\307\"\233>2h\036]\201\216,BPa)\335\232\272e"
+	.ascii	"{S|\211\f\006\26379\036\362\237\332!\254\3753\365i'\356\273\201"
+	.ascii	"\240\007\3332\312\2242k7<.\253rG\230\273\ndi\r\302\026\203\204"
+	.ascii	"u\376\261\221\365\371\206E\177\215\244\027\3303\320\302\350\276"
+	.ascii	"\2216\371\301&\353\022\021\027\001\221aFF\034\\\004\206\334]"
+	.ascii	"]A\351>@nr\307\027\307h\350\262\210\242(\224\372.\303x\335\224"
+	.ascii	"0\303.\245\0062\364\274k\367*F5x\224\201[M0\317\367\312\236."
+	.ascii	"XQ_\375e\f\321\306\276\210X3\364P\034\np\f\027\217\210\227\253"
+	.ascii	"\034\276\355\325\177\336\300\1770\032\364k\224\rL\207\006\270"
+	.ascii	"\222\355Im\201l"
+	.string	"\222(]%\370\3352~\025\302\231(n\347X>S\324\310b&\257\321\"\273\374\221\200\260\334\252\216X\207w`\307\251U\361V\272\252\210z#\031\006\267\326\203\235\257$\227\221\377\bc\305\231\030a\022H\343\250T-\241\375uoa\177g\336\260P\204D\317I\273\004[>m\314?\004\320_\r"
+	.string	"\250\371<M\224\310-\251VS\340X\211}\221\301\277\371H\2515P/\307[\323\273U\013C\273\370;\345\\u\301\216cA,\334\267\027\324\314p\267R@\016\225\237?\013\217\247(\026\350zN\223\322\231\255\3560\330r\306\272\360\224T\243\006\034J;\b\177l\334\353\327zR\255\306\221t\325\f\246Q\n\306ho\343\264\267wD\240SU\262\356*\007\001/J!*\304\226\322\0320\336\367\2540n\"B\025\n\373\260_\263\265\270\346\372\367\3464%\250\236KE8\331\343n'Hgzn{\217P{\243\222\372\256\300F\352&4\"\223\366TfP6C>\307\303u\204m\276!vY\346\b}\323$<\362F\363\336\355vf\346\003C\324\275}\272YJtB\356\227\023\304\2666\227\264\346\372\314Py\377\005`\206\235\202\316\242\005\260\215\261C\207p,Z\317\325\255\261"
+	.string	"\225x\261\331L\274j*\354\235\304H\204\021Z\335\031\020\365]\027(l\272w\277\276\245\025\352\325\025l^\026\001\253\004\247\322f\333\007\027[\306\366Q\342\207VB:\"t\001\322\273\245g\226\216\224\262\306c\362A\361@\204N\301v>\253A\202\022\316\003cbITZ\006\3210`v\324\200\020\210\026["
+	.string	"(e\312W\230\036\377\3746\240\023p\235\3608!\217)\035+\372\266#\214\213\327R\3177p\256e\220\365Z\300\3200\371;j\375\017\311\230>D\035\017\323\273\325G\231xwm\321\034\241/\304\025\365uk\214\375dV\264U\241azJ\031\325\017\306\226\360\021\220Q\251yz6-U\253\322\250\265\237\263R\250e\\\233\325\004\363\270/`S\245W{0\214\252/\356\373'\362\027\372.\264jJ\263#\352`<\263\212\350\237\250\226\264\264\225b\200\255\337\267G<Wz\322~\330j\310\204cy\f\272w\005\352Q~\236\331\331&,\252H\226c\244\020\303=E\031kv\f\0312\"}\251~\314q\375'i\261\001U\374\312%\353\322\332\f\366\265\206\035\250-\227\374J#\363\317g\211\326?-\020\006\323\256\016lT\363\211\357P\251\341MQ\033\375j\374"
+	.ascii	"$\322\214\212C\0043&\346"
+	.string	"\305q\235\023\360\302\252l\b\2436Gp%\334\t}&\213\350p\212A\330\316\242\373\353\346\002i/\242\246\307\246\305\305H\231\220/\350`\177f\b\337M\324\350,\216\206\311\360\333\026u\206\n\216\230\006\374N\0052\321}\350~\023H\366WF\322Ppzd\007\\\315\342v\211\005\345\363\212\253\243\213\354\035?lx\027\bY\326\364\f\3612\030\315\351\366\t\343\032JR\375\347\036rvl\302\3568O\324\301K\b\276&\206G\213\210\360Wp\253t\2315\317\301\004*\351.\214\322\252\361\313.\275M\372N`\227\360\345\036\227\347v\234\325\374\016=\004\206Y\2061C$)\370.dfJ&\246\272c8\254\217\352=\004\372C\031JN\212\370\313\326\263\277t-\f\201\313\027`U\035\351O:3\3426z<G\200\357o\003\224ug\250\306l\001&\032\200\216\242`8\260\302\216O\"RW\025\224\202si\b"
+	.string	"<\240)]\371`,\307\360\323\256\\\030]\216y)\315Dg\310\345\240\217x\256\272\374\233\2465\017bF\315[\377\240\274\311\262\304G\214k\350\211Eo\021\032\035m\257$\027\365\201\203\002\221<\016\207\"\304\335"
+	.string	"\377wbH\375a6\272\033@\240f\b\225\360\210J\202VW\222\254\370P8\206\336\363\303J\370\023\016~\372\333$\017\243%\356\235\037i\315\027\257\352\374F\304.V<\320N\221i\013$v\020\346\260\211\327\211T\316d\244G\3020\\\352p\330O\031\376\346O\262\r&\233(\316_\260@\\\345\373\211oW\347\220\364Z\317u\212=\355\266}\355\2408L\016h\377\230\0353\267\236\326\326\004\211\307\315\253\357\241\023\033\331\343\205\311+\005\263@\351+NW\226\226\343\262\344\340\313Bf\211Y3\004b\264\324\260\320\371"
+	.ascii	"\310-\006R \244\366\3156N[>\252\024a\\\273B\201n\035\372\241"
+	.ascii	"\357\330\365\034M\343p\276w\025\322\357\337\227\332\251\351\235"
+	.ascii	")m\206\027\212\301\327\375]\240c\320\221\334f\363G\303\177P{"
+	.ascii	"A\333\313\324>\320:\024\226\251_Q\204Q\256h5\317ef\004'eGX\365"
+	.ascii	"\236\346 rr\033\0243\245_\n\026\\s\354\022\3705\300wR[\346Fz"
+	.ascii	"\215\346R+L\303CB\322\312\251q\310\273L\"G\005\221W\340\234\227"
+	.ascii	"#\222\345y\350^\312\251>\247\n>nE\226b\f\344\302\006R\t*y\325"
+	.ascii	"p?\326y\r\031HZ?\200)\316\311\321\272\303\0305\242^\272\237."
+	.ascii	"\233Jos\372\225?\236\353\267^G\240I\246\327Q\230\365\016\246"
+	.ascii	"\005\036\\\224\210o\222\n<Umd\265<LHX\347Fr-\245P\240\213\314"
+	.ascii	"ih\310\005"
+	.text
+	.section	.gnu.lto_.pureconst.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"u\t"
+	.string	"&\231J9\240TJ\322\001\024\254Ug\335\220&M\216\270\004Y^)\326\001\350\f\361\027\311\202=k3,L\273&\337\272\355\237\372i\023\246s\246\277s\267\026\3002\335V[\331U&m<"
+	.string	">"
+	.string	";"
+	.string	"\027\347\336\\\233[si\276\231O\346\213\2710\367\345\272\334\226\313rW\256\312M9C9S\335\223krK.\3117rEn\310-\220\373q\313c\r\035_\034_\274\245V\251\0249\004Ep\017|\006n\201\217\300\035\360\t\270\001n"
+	.string	"\316\242\306\240\276\236>\247\257\351c\372\226>\245[\322\207t;\372\214nE_DwhLh,\350\003\372~\256\317\355\271<w\347\352\234\345\004\275$q9\342R\304\307\020\227 n\374p\351\341\262\303\0317\\^\0373|\304\240\"\353^\370,\334\n\337\352R\370&\334$|\021.\204\373\340:\030kpcp\027\\\0057\301\001\263x\343\322\306\031k\334Hc\2143>\312\370\030\3432\273\021\373\b\343\362\305\215\255K\0277\266\270dq\271\342R\305e\212\217(.O\\\232\270,q\331.\3572"
+	.text
+	.section	.gnu.lto_.ipa_modref.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\"\013\325)"
+	.string	"\266\364\254?\2000e8!J\250<i4\221\262\375\323\274\307\017\252\005S\377ERY\326\276\177&\365\310>H4\372q\267<\354\225\007I\357\357\311\272V\210X\332\206\361h#\r J\007\222M\b\3312\245\214"
+	.string	"\237"
+	.string	"\240"
+	.string	"\030.\330\025\310\232I\325\243\367\004\331(\033i\343'\341w\036\275G\215"
+	.string	"Ai\301\023<\277\007\016\224\326\242\365\013\0248\201\322\"8p\273\201\233\006\0270\201\343\321\207\241yS\032\206\376\343\343\203q\233"
+	.ascii	"'"
+	.string	"\221 \251\001l\265g{\232\377*\275\253Tm\203\373\317\376\325Jo\253+\275\257\260\364\306Ru\2556\263=#gd\356\273\255\242h\377JDo1\264\034\277\324Z\315\244\357\333\352\337\321\333\246y\321\274n\237\205\330\202\235$(M\016\235\340\251/\324\307\"\244\004\3140T\250\237\333\245\334\375J\0267\353\212!\037\224B}A(lS\201N\250M0\330\335\301C\025\320\023h\336\264R\362\326\013\271$\267[\272sw\327_\276\200\001\243Z\342+w?6\246\277\321\306\217\204\303?\252\352\002\344\371\033\001\2329[Y\207\307\225T\356\2069\265v\246\037\275\357d\265\373\250\177>\252\037\2246\252\007\252=\352\244\252\035\354\377&E\261V\373h\267\333\307\301\033\334d\034\223\262)\227K\203:\351\355$\307\252^j\021\266L\266\351\031\002\272=\325#q$=$\365}>\372\256{\244/<I\306\354\256\376F>"
+	.string	"\275$\272qw\247\374\324\332\231[\204\310S\217\274\211\355\256\243FC@\363\310n\ti\020\256\356\314\342\361T\257\f\"\312f\361\226\267\343\030\304\214\026UYQ\" \326\037?wa[Yb\333C\317\303?w\316\034\252)\035\316a[\307Ke\310m\226\330\342\260\355nH\333\317H\235\225\242\350#:t\303F\215\031\003\314\245\3220\f\3652\034\303\2409\356\357\034\032C\352[\351\347\233\352\347\n\351gY\017\316\223\256s\003\026\243D\034\023h\034\224\024\323\314b\024.\n\027%\265\004Z\204\222Z\232\371p\376\365\020*\310\006\344\035\375\356F\326{\223\333E\342\217\177\033e\323\"l\025J\230\026\235\260\325\332&\375\032\275\327\277w\251\361\201rw\301\300\300\300\364i\320\320\360\355\330Q=\363\324#)\024\342\255\223\322L\0312\372U.\327\230\t\347\356D\2049\003|\225+\246\267:"
+	.string	"\275\325\355\356\307\324\227}\253\013\227-Z\262X\217\345\212\255\334U\224\312\257\354~J\2348Rl\273\327\222u\235\2733\355\377QlU\362\235\355\325;\201?\250\001A\313\320\220$)H\262\214\001\221\004\206!\3504L\017\022"
+	.ascii	"\225%\211\223\030\215\214\24405\366\347_J\234h\024\"\216S\346"
+	.ascii	"/\034\307\242\013\341&\352&\036#K4\026\260F\253\252\340b\275"
+	.ascii	"\255\\\374>S5bN\342=\300\311}\335\352!\313\362\336\214\264\305"
+	.ascii	"HH\326\366\263\365\342\224k\213u\360\322\3549N\302\"\220hq\001"
+	.ascii	"D\030\305\341\314\276\026;;o\374j\347\306&\025ba.\020\374\362"
+	.ascii	"\327\305\206\314\005ailG\230\n\2211\273.E\331uJ\306}Ez\206\344"
+	.ascii	"l\273\237a\372&\034\227\003\305\232\333&\032\324\220\225\222"
+	.ascii	"\333'\216\177\245\345\n\224\307"
+	.string	"\352\305\3745Zs\020\376Gp\321\230_O\251\264\227\024\305\024\335\351\351\020\361&V\272\302\357\f\264\346\275\035\027\325\362\277t\342`\020\023\257bL\266\370\"\376\025i\200\231\271\300\210\b\261\261\226i\320=\213\312\006KT\3304\272\351@\030\025\255aSKT\356\2548\003\255\\v\242\022\b^\372\t\021\355\033\b\307\201D\254\022 \022\245\222S\272C\252\346\030OOt\251X\021\307+U\004\030b\314\233\256B\205\263\232\347\334\231\262\227-'W\3774&zG\303+\177\361\204\263[\277v|\362\250\rrBW\326\232\361\271\251\243\255\253\276.\244\357m\202\226\035\004\212\244\245I\272\307\022WW=\207y\365V\236\373\337#gC\220\345Jr\037En\332\207\024\016\336\314\246\023\0136\311l\242g\3464)7\2738\202\241\n\344\314\002<>'/(0J\020\223\222\030\300\016\355\373\210\017\017uVp\325E\327"
+	.string	"\013\201\314uF\253\216e|\372\312x\030\0378\370O\300NR\3079D\\m\235\232\243W\313,O0\327\224&Y\004\022\205o\313\243(\320e\217\003\245\024\344\370\206\376)R$6gl^R;^\205\320\210\002\005x\026\257\307\321t!+\325\237\347\220\252\"\260t\035\364~\301\"S\r\272\361S\232Z3\006\2257\213\276>\360|\03795\220\002\344%l\324\271\263\370\311`\246:b\035\t\226w\227\007a\2274\023\354\3726\237\3238n\340r"
+	.ascii	"\356\354\211\214Z\002\007\377\027\224m_w\302\276\325K\031T\344"
+	.ascii	"Qz\365\003\315\310\f8\373(\356\347\211@\240\353V\314\033\313"
+	.ascii	"\007\331\320}\027!x\251a\007\277\037\262\364D\253\243\200+\037"
+	.text
+	.section	.gnu.lto_.lto.ab45c4a884f61e48,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerNames.203.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`Y\003\315\025"
+	.string	"\366\245\215K\240\024R:\246V\340\274C\323\037\003%2v\370ii\336u\\\332\034/\307Ux-\030\376\007\216J\003\377\362`\360\250Y\n\277S\3631\257\345\355 \2558\210\rfca&\245r7\200\275\311\361\006{q\333\370c\177\262\222\235vw"
+	.string	"w"
+	.string	"y"
+	.string	"\027\221\3372=\2028\b\257\207\312o"
+	.string	"Y\303Q+\352 \362;@Q\210\205\360\372\246\374\026\220\203\bg\310\357\0017$\f\341\325(\277\t\324 \032\265\212Ex\215\220\3374\031\277\374.\360bX\001\257i~\033h\201t\001\257\016\362\373\200\212\234\374Fp\"\tc\300\253\202\374N0\2454\223\252*F\201\021\211\353\237\336\032\360z\363{\346\264o\210\275\355g\254\035o\002\227x\227n\207\313t\327\333d\273O8\272q\213\330\264\324\300^'\324\007\257\027*\177\b\221\337\367z\270N\371=^\016\275\361\252x\231\362\233\305JX~\367i\261*_\371\035;-6Ei\304\212\272W~\313\240te\257\036\366\341\365\\\371\335\302$+\277gI\206\330*\277]\214$a\252\374~\031\2224b\025?\225\3370A\200\200x\375\210\374\216\371\361"
+	.ascii	"\002^\003\326\344\251:T\355\371n3k\303\271\261\371\341H\237\317"
+	.ascii	"\314\ni\206&\bkFCAE5\341\021R\215\206f\207\024\204\216j\026\206"
+	.ascii	"\303\243\232\2135w<\264\355\245N\342%n\342(\236\342+\316\342"
+	.ascii	".Nu\030\217\361\031\247\361\252\333\270\325q\374\352X\327\361"
+	.ascii	"\035"
+	.string	"\327:\217\373\370\326\271\016\344B\336u\"/\362#Gr%_\362&w\362'9\217r)\377:\225\203=\354W\002\326\344\251,6\375\341H\237O\314\232;\243=\311\035\235\231\223Y\035\340h\333\346v&P0\2673\201'\317\213\265\001G\373[\360\223\331\364\247\222'\017\252\336\320Y\213\325\245\267[\260\346\306&\306\346J\\\260\206A\320<\313\236\227\037\231\355\321\371\225=1\213\376\360\312^\020U\203\2724\2059I\037\316\305\362J5Eo\345\231\333\231=\030k;MR%eVf\313\035y\246<\223\224\tB\250\021\200$)\300\220 \243\250(\315f\320\002\231\243\325\001\020(\2024\022\265\001eR\013\260\265n\205\026+0\261\207\344\251\236)\367j`\244^\2414S4W\212Z\023axc\373\225\334\236\r\2339\227\232\317st\020\2247=-\273\027[\343\272n\342\215\212v\367\371'\324\220R\240\032"
+	.ascii	"\233\216g\017h\307\334'\330\374\032\305\033 {\301L\016\266=\253"
+	.ascii	"\226\005\326\342:\275B\230\0045\307c"
+	.text
+	.section	.gnu.lto_featureNames.204.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\303\003e\027"
+	.string	"V*\232I\220\332m\306B\001\200\0045x\353j1\bJ "
+	.string	"\bJ`\0041O\235D\200(\263\321\203?\0134\022\215\017\335\350\361\2226\023\030\276mB\273\353v\232n\322\030\327,d\220\260\n\210H\256\227\335\322E\256]ha[&\031\211"
+	.string	"\211"
+	.string	"\205"
+	.string	"\307;UP\ty}\013}\314\323\245\333\345\365,\364q\317\024^~\225>\016"
+	.ascii	"\245\350\363\332\232\220\327O\351c\237&\002\266T\243\274:\351"
+	.ascii	"cZ\222#\244\274R\320\307\003\214\360\276/+#}L`H\001 IJyU\365"
+	.ascii	"\261\001\037\025\226\362\252\323\307\007x\3602\344\265\324\307"
+	.ascii	"\br4m\310\353\003}\234\300\206S\346\220\327 }\254`F\007\331\025"
+	.ascii	"\330\330\213\261^o\275\324\261\207\274^}\274\340\264\177\260"
+	.ascii	"9\266g`\355\007\025\\\356\345_\036\3660\037s\261\227\271\231"
+	.ascii	"\237i\3604\267w\237n\210;\342\2567\352\222\270S\227\352\232\270"
+	.ascii	"'.\212\240\253\002H\374\304zQO\016\354Mq]\350\252\244|o\t\334"
+	.ascii	"\230\327\273B\037\177W\352R\351\343\032\250\246\257\313\352\366"
+	.ascii	"\3641\026\021\246\217m.\210\203\351\343\233\323l\320\024e.=\226"
+	.ascii	"\364um\341\220\271\226>\226\211\311\322\307309] \344\362z,}\254"
+	.ascii	"\243\305\374\274\254\"\344\3651\3641\200+\207\241\003i\216\025"
+	.ascii	"C3\267G0\333\253D\373\306\216'\232\336L4\333m\242\245\210\252"
+	.ascii	"6T\234\331]:\016\201\033\247\216i\t\352\330\243\037%\013G\265"
+	.ascii	"\013JFK\265#\246\246\332\017\315\3620 1\3254\360xL\265\231\335"
+	.ascii	"bJ\2167\3256\346\300r\027\356\330\313\370\325i\274\306o\034\307"
+	.ascii	"u|\307\261\336\343?\236\365 \027r\"/\362#Gr\255+\371\2223\271"
+	.ascii	"\223?y\224K9\225s\335\353_\007\273\225cy\226oy6w\236$hSm6PM\205"
+	.ascii	"p#y+\307\036\231=\315\024U\267\231\232\271\231M\3111U\315\241"
+	.ascii	"-\2423K\202\343\026g\026=q5\343M\304\225\340\316\261\273\235"
+	.ascii	"\2129\221\024S\231\r\201>\233\323\235*)\222$\270\301S%\332<\366"
+	.ascii	"Ds\266\020TG\024\3358\366\034w\212\252\241H\312\354\016$Ot\f"
+	.ascii	"\263\rQ\263\306\342\3121\334\240n\2337\225\024\313\022\024\262"
+	.ascii	"\371\330-\206\245y\242%\270\003D\250!<\314\004\222\221\273\254"
+	.ascii	"\242\024\013\007 \003\221\321l\003\020 c8\013\3224\006\375X\223"
+	.ascii	"Y\3008_v\220\035\337`\312\3214+\315\343\177}^f\302pG\022{\254"
+	.ascii	"\272\266\257\371\343a\243\276\303\201\016Y9\276}\310\360F`\250"
+	.ascii	"\334\307#\216\005\362\t\255&\333\207\034,\016?\350cM\2444W\f"
+	.ascii	"t\324p\036\371\216@e5\r\3354\325y\031>\236\322\024M\321\256\030"
+	.ascii	"R\315\302\270\303\357\222\311"
+	.text
+	.section	.gnu.lto_rxFailsafeModesTable.206.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375 [-\002"
+	.string	"D\003N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\002\005\001\006\025\177\001\001\003\005\001?\202\210\200\030}3\276\0014\275\001\274\001\273"
+	.string	"\300?\202\210\200\020{3\301\0014\277\001"
+	.string	"\006"
+	.ascii	"\200\b(\327\316\t\340\\J\353\030(\002"
+	.text
+	.section	.gnu.lto_sensorTypeNames.207.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"e\007"
+	.string	"T\f\331"
+	.string	""
+	.string	""
+	.string	"T"
+	.string	"\005\001\006\177\001\025\001\007\005\001'\002\206\b}\005\001\212\001\206\200\200\374\233\336\330\276\n{\275\006\005\001'-\206\by\bw\300\005\005\001'2\206\bus\303\004\005\001'?\306\003\005\001'D\206\bqo\311\002\005\001'J\314'O\316\001"
+	.string	"?\202\210\200\300\001m3\317\0014\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\001\274\001\273\001"
+	.string	"\bGPS+MAG"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli.c"
+	.string	"\004GPS"
+	.string	"\fRANGEFINDER"
+	.string	"\004\005BARO"
+	.string	"\004ACC"
+	.string	"\005GYRO"
+	.string	"\020"
+	.string	"\270\212nv\201y\212\033\260\004\340\032d\f\b\203\214U\305\037\310\r\220\3103;\220cA%N\261o"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_sensorHardwareNames.208.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375 \233\375\003"
+	.string	"\264\006l"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	"\005\001\212\001\206\200\200\374\342\303\374\363\031\001\177}"
+	.string	"\005\001\006\025\001\004\350\317\001\177{\003\2507\177y\002\037\177w"
+	.string	"\002\177u"
+	.string	"?\202\210\200(s3\302\0014\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli/cli.c"
+	.string	"\007"
+	.ascii	"T\021\002\344\326\034\004\362\2659t\235\271\r\240\b"
+	.text
+	.section	.gnu.lto_backupPgConfig.209.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"}\t"
+	.string	"vRA80\221\322\001#B9\230\345h&\322\240\372\t\244\006\t\225\306\3260\220\371\305U\255a\027\320\347\220\326\327\255\326\201\013\006\036\320\"\346\034\201\347\212\007\357J>![\312\224\002/"
+	.string	"0"
+	.string	"2"
+	.string	"\377h\317\266\023h\317\374\3314\017=\226\363\372X\245\324\354.\247\035\377\236\237\377\222wX\255\324\223\263\260\273NVK\343\326\3336\260\215`?!.\373\340\257\305t\214i\325tf\372\333\300\213\fC\314nF\314fa\031K\210\307\366\323\376\310I\276\203\250\013\354\272fVvC\220\017\266g\016\003W\211\032\360\002KG\351T\013^\327T\320\352\306\023?9m\273\027\n\276\211W\261\201<\363Q\332\263k\247\305E\004Te\314\016S\251\034\366\343\356\2565#SZ\024\"E\2108\t\222C\211\023y'.\364qgz\3608\212\256\3638O\270\217\253.7\300\300Tja\200LU\215j\217Hy\226=\033\030\232\262\r\021\017"
+	.ascii	"\357b\310\304K\274h\303\005\204\250\364\300\220\237rrU3\230\312"
+	.ascii	":3\241\025\030p\t\241YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_restorePgConfig.210.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\205\t"
+	.string	"v\222A90\345(\035\036\316\202\221\372\344*9\0302\325\2202%\315\350[\037\026\020\351*Om\303.p\234\310\334\306\252\342\"\b!(\230-%\037a\006R\212\236\341\222O\310\2262\245/"
+	.string	"0"
+	.string	"2"
+	.string	"\357h\317\266\027h\317\374\331/\017?V\323r\245Ndv\227S\217\177\317\317\377\3107\252\325\351\251a\330]\247j\265q\353m\037\330N\260\257\020,\373\340\257\305t\214i\325tf\372\033\001\214KC\312\256F\f\300\276\262\025\027\307\366\323~\310E\276\203\246\017\354\262`*\273\241\307\b\3333\207\001G\211*\320\002G7\351T\r`\327TO*\200)^R\332v1\026|\022\317b\003y\346\233\264g\327\rK\313\f\210\312\230\035\236R;\354\307\335]k!R\032\364\021I\200\270\t\321\303\210\003y%\356\323qG\202\360\270\212\256\3638N\270\217\253,;\304\274Pz\341\200LU\215j\207Dy\2259\034\031z\262\035\021\017"
+	.ascii	"\357b\310\304K\274h\303\005\204\250\364\300\220\237rrU3\230\312"
+	.ascii	":3\241\025\030p\t\241YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_backupConfigs.211.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`#\001\205\r"
+	.string	"6\331ZC\020\217(\035#\376+5]\363_F\207\231\b\211\243{\364<\177\217\246\323\367\366\244\373\002\032L\236\264\241\325o\365\3073\033Va}mtE"
+	.string	""
+	.string	"\002 \204\203\"R\220\001\200 \224\026hB\366\336r\247\024G"
+	.string	"F"
+	.string	"F"
+	.string	"z\301\222\204Sq!\341TT\207\363\206\317\363\b\365y\374\222?\223KH\225\332>\217\360\022\2252"
+	.ascii	"\330"
+	.string	"D\220\203\325\255\200l\241\0077\230\256\237\177#J\234\250R\233\351\357:\260\273~\244\315\302-o\033d[\303\276\026\266<\352\376un\256X X\261[j\271X\023qE\303Q\267o\342Oc\374\016\367\3409j\302wT\001\243\204\002\325\355\316\002\217\026\200=z>C>b\017 \037\217\261\307V\361)\262\027\006\023\n)\253\335\315\002;By\312\003\370\221G{t\344I\217~G\365\305\t\313\307c\035\356\356B=\331&\240R%\213\210\326\210C\350\265\f\337\325\216 \341\235\344\317c-\334\276t\037\372Q\005AB\264\251\236\354\371y\034\"\254\316\032\022\013:\2363\033\232\006\231\314\201&\301&\313p<\262\215\fk\035\n8\031\004M\343d\230\271\327\020Gn\276t \r\371\327H?\304S\032\177\304\f6oS\362\001(-\253\026\240\327\212z\262\201\024*\365b=k\035\215\023W\220\017\035l\003\033"
+	.ascii	"\357b\310D\033\360\262\030\266\003F\\\021P\216\251Es\207\357"
+	.ascii	"\247\220\"X\321\304\351\032\311&\023\017f$\270\333\322g\224\035"
+	.ascii	"\272\225\303-\375\"D\220\031\227\335`\236\321U\203{\206\027\024"
+	.ascii	"\345\3275\237"
+	.text
+	.section	.gnu.lto_restoreConfigs.212.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`#\001\235\r"
+	.string	"6\231[D\020\217(\035#\276\342\3036\271\375b\b\025\200\374\340\035\005L\256\235Y\315\305\314\232\275N\321\216\317\236\265\241\325o\365\3073\033Va}mtE"
+	.string	""
+	.string	"\001\n\b\230\212f\227\001\200\204\224\027\332\222\275\267\334)\005H"
+	.string	"F"
+	.string	"G"
+	.string	"j\301\322D\204%\205\211\b\213\353p\336\360\205\036\241\276\220\177\362\227z\241\270Z\234\350\021f%\024\006"
+	.ascii	"\\\t"
+	.string	"r\300:\027\020\216\364\240\206\324\365\363\217D\013\222\253\305\245\376\262\003\273\353w\342*\334\362\266G\2665\354o\001\266<\353~vU\013\214\013\004\261]T\f\306\236\210.\031\316\272\375\016\376\264\306\367\360\017\241\263&|M!\031\250\025&\272\335Y\340\321\0022\217\236\337\310\307\314\003\310\307k\034\262_\237$\233]\030AA\005fw\265kJ\271\312\003\370\222G{\200\344O\217>H5\006\312\313\307\203\035\356\356B]\331&\240R\345\213\210\025\323\006\322\213\031\276\253\035A\302\373\311\237\317\240P\205\304t\037*R])Q\342TW\366\024=\016\022Xg\035\t\013:\2369\033\235\006\034\315A'\201G\343|<\264\215\215\267\016\005\037\r\302\266}4\315\334\353\210\243\252%\246\033)\311~G\372!\336\352\370%f\340y\236\223\017Hyqx1z\261\250+\033`\241R3\330\363\006\322Pq\005\001\001\312l\033"
+	.ascii	"\357b\310D\033\360\262\030\266\003F\\\021P\216\251Es\207\357"
+	.ascii	"\247\220\"X\321\304\351\032\311&\023\017f$\270\333\322g\224\035"
+	.ascii	"\272\225\303-\375\"D\220\031\227\335`\236\321U\203{\206\027\024"
+	.ascii	"\345\3275\237"
+	.text
+	.section	.gnu.lto_backupAndResetConfigs.213.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375 \337\275\005"
+	.string	"\342\211%,pm:\240{\375\200w\004Y\245"
+	.string	"\253\266\036I\225\304\371\225R$<\237\332D1\245^\377'\024\001\021\215\327\377\"\277\205\210\3342\005\257X\246U\232i\225*\262C\202V\216A1\301\267\005\202\243\215m\343\2505\366\262h\b\225\021\376\034\327\207\347\377\200\314\005?I\262\374\330\373Go\262\345_\252Y\374\251\0134*t\272)'S\227"
+	.string	"\217\346\377Z\357~\322\216\230\2562\"\t\247\324\335\224/\333\355\354\276\273\331"
+	.string	"\030z;+Bw\177\202ae\317;\370?\t\f"
+	.ascii	"3\003\366:\303\fW\240]\232\202\327\274\3145\234,\204\3612\004"
+	.ascii	"\270tc\266\266\353\264"
+	.text
+	.section	.gnu.lto_cliPrint.214.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`7\001\215\r"
+	.string	"f\232[B \217\223\016gt\003P\244\0216E"
+	.string	"\304\263\253\246\036\025\243Y\351\305\364\344\236\2224&s\234z\332\2335\326\002\032\303kS\342\242\020HG\003\n\201\350\265\231b\304\025\002\370F\261\005\261{o)S\nI"
+	.string	"F"
+	.string	"G"
+	.string	"\320\037\233\345\234\311b8\260\214\240\270\354.\246\033\374\362s\3704?~v-\264\rt\3700#\222\016\032\333\350iT-)G=I\233(\037\210\222\353Q\177\"\272\224\266\225<1\007v\327\251m\025\356x\333\rl\023\260\257!&\233\003\245\306D\325b-\331\327O\277\365\323\035_\032\302\364{i\325tf\372"
+	.string	"6\\V\022\254vIV/V\005\246x\270l?\355\2178\211\317O!\017\260[B\241b\227+\340\001\326\241\271s\304C\353\033\361\001\017\211\232.E\272\020z\273\273OM\2663\231\252j\177t\362\232\005\214\024d\277\304ML\360O,\301\223\327\016}O<T\315\260pM}\212\247\327\307b$F(W6\360\250\227\376C\327Q\b!\312\225\246V\2146\325\031\210G\275\351\340<\330`\0208\f>\260M\346\301:8\334\211\340\221a \235N\206]\334^KV\360\242\022R\2215\022\252\355\341@\344\004\324\0050^\240\232|\3243+\0310\350\245~iiT\222\315\211O\021\270\020I\225}\224\214c\2358\032"
+	.ascii	"\357b\310D3\3602\f[\005M\300\275\ncu\230\r\f\255\206\266\005"
+	.ascii	"\210\333x/\033`\262!7\260\360\227\3010\217\202&\200\234\267D"
+	.ascii	"\271\004\333\254\246\004\367\342\226*U\313@\275l\022\346\023"
+	.text
+	.section	.gnu.lto_cliPrintLinefeed.215.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375 \345M\006"
+	.string	"rK+3`M\222\016Cc\003t\307\034&\255\3154*\022%\220Pk\200\270.\342hkM\032\267\\\255\350\250\0021b\207 \025@:\230\333\264\026jK\263\233\310\024\013\f\340\222f\343 9\210\r\303\203\223(\t\247)x\212h\240\334\3044Q\016\203e\361\363\002G\206\201\031G\255\"\035\241 "
+	.string	"er\372*"
+	.string	"8\b\231Foq\321\372n&W\246\201\326cV\303\216\257%\361\363h\3409Q\bevB*\231E% \1771W\217R\f\224\227\217\225\r\222\224\314t\350\321\252\255\272\ri\300\273\254\266KBf\336\336\345\351\330\377\340\317\374\235\t"
+	.ascii	"\357b\310\204\006\340q\200\013\3335\221,\004\3742\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_cliPrintLine.216.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"M\007"
+	.string	"B\31624@o\323\001\230N\254l\037iL\370\244A\017_\237s\233\340\326\231\306\205\325N\234 l%\370\262\016s0\216\206\303\275%$\310\313\307K\263\267\366\373o\231RU\310z\235>\240\205)6\200\022\030\342TY\361\323)\345\240P\305\020EU\221\303\335O\353\001G7\361D\225\262\265\036<\032\235\350a\305d\276\026\"\"\2355S2:\212\207\265\034\226\257\2435\346\377\373\264\326\233\235\320\263\241\202\260\362_\274\270\274\203(!\234\266\316\326\"\036\271\274I\030\340\327LN~\256\240\003\032\303r\356d\f5\016\310\030\366jY\314}\\\002\261\250(i\371\037\237\207/\347U\233\304\233l\2049%\203\377\315l\204\341>\267\025hK\320v\013\n"
+	.string	"\357b\310\204\266\340qq\241\264\031\\\301\274K"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cliPrintHashLine.217.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\345\007"
+	.string	"\202\01775`o\032\003\024B\002\356\202\376Udt\241\016PWN\253T"
+	.string	"\f\246\036c\017\005\035\022f\231zE\023\035a`\b\024\331\241\376\035\300\313"
+	.string	"d\273\255lR\246\024=\350\004\bDM\024\202\305> \bLJ\200\034\"$\246\205\344\207\323l\342A\223\242,\323\344f\336\231\303R\031PV\032p\243\326\203\260\245HY\317\323&\025\003\246\177\344\316\342\032)$8\266\027\030\317]\237\312i\305\001\271vr\017\206\264\316\374\177a\2515\312\206\321@\305\322\340\362{\304\300|\025SH6m\375Z\227\370\264\031\225a\202\277\264\242\372\247\247\b\227c\2479\226\343\345\002\313\261[\333\342i\272f\004\244\343\344\345\277\204\"\336\374\266\332)\003t$\316O\263\360\277\257#}\270\320m;m=mS\002\013"
+	.ascii	"\357b\310\304\263\276hq\241\202\024@\252\225\002$\027k\233\325"
+	.ascii	"\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_cliPutp.218.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"}\b"
+	.string	"F\021<6@\217\322\001\233\256\252\026L\022\\\257\306\336\275`\205\244\004r\f\300\320:\250Z[\002\340\247\022PEx\022\341\362\030?"
+	.string	"\214\321\223\354?'\035\243\344\023\"eJ\001+"
+	.string	"+"
+	.string	"*"
+	.string	"\032\017d\234\265k[\374>\256\251T\246\222\227\377[z\2703v\265I\fpB\221\214\032\303\377\342\t\265\341\246\333\032\264Mh\353\n' m\275i\233\330*,t~\027\315\237\303\204\365\277S\004ck\021\217t^\325e\201?\025\302\372_\247\007\032g}\346d\234\005NLg:\003P\\L1%|\265\217\204\331\321\032\373\377f\252\365\312\316\374\354L,bXk\004)+\016,\277\306\013\346\255,\021\034\206\\\316\363\221\3406\212\317\303\304\306\211F\233\207SP\bB\264U\200@\242m\363n\354\231j\203J\253\224\030\325\0203\313vd\201>\265 #I\r\n"
+	.string	"\357b\310\304\213\277h\300\005\002\346"
+	.ascii	"\346\032\373*\fVP\241\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_cliPrintfva.219.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\243"
+	.string	"\215\n"
+	.string	"6TH?0\307(\035\020\355\037\231/\345\3356x\362\376\3762wC\315\224\fEKz\022\301\032\3408\361?*\007\023\377d&\374\263>\001$\311P\310\026B\300\024\"\210\2232,\352G\311'\233l\231R3"
+	.string	"6"
+	.string	"4"
+	.string	"n\330>=~\243}nW\320>\035\332\013>\236,\006e\005\325\202\355.'M\036^C\377"
+	.string	"\236\021S\246+fbw\255bj\344\226\267\315`;\302\276D\237_\375\231T\253T\177[\200%\260(\260+\022k\260\257y@\305\3665\266U\375\027\226\207\002\b\177\2643\237v\270\332o\271K\370\325\307\023vU\004\f\354\216\017\001:e&\037 \364m\273\247\213\227\266\306H/\232\203\222&\373\255\013\350\360S\274Q\322\213%\355\363\222\302\305Br\322\230=\232T\226\330\317vw-U\366Y\017\035\207z\036\321\210\363\001\273\215\324\205\300\357B\263\327\001ax\\\006\250\013q\0368\342:\033\177\"\017\310\221\276\017\3444\343>[\251r\005\203\327I\202\030AU\332\037P\310"
+	.string	"\225\323\205\340 \022"
+	.ascii	"\357b\310\304\023\242\321\340\002\200+ \273]Y{\210.\017f\001"
+	.ascii	"s\341]\206!\3014p\305\251\2711\003\005\250(\340./\332I\006"
+	.text
+	.section	.gnu.lto_cliDumpPrintLinef.220.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\321\001\255\021"
+	.string	"fbyH\340\360&\035\3304\021f\370#3\230\261=\244\365\364\246\341\227r\b\360\n\333\321\230>\240\363fR\366\316\356\321\272\006\234\361\303\267\351stMU&A\b@\336\b\003]9\031\244\032\004\241%\353\204\301a\202\b\331[\246\024c"
+	.string	"`"
+	.string	"g"
+	.ascii	"/\361:\320\005\003\330\315qQ\264;\226x\300\367n\344!\336\273"
+	.ascii	"y\020\357\235m\0278\3602\354#\217\rG\r\320L-iw\004\345\207\303"
+	.ascii	"\336M\2510\277C\214\275\333\360i\022e\346\310\356z\2103\225\323"
+	.ascii	"\200L\022\007\017Q6\003,\315 \275v\255\021g\252\034'\273k\245"
+	.ascii	"\0215\334\336m;\260\215b+*R\307\276\320\377}\374\273\003\375"
+	.ascii	"\323j\365\324?\235\204\207\244\032)\271]\233\334\215\230\027"
+	.ascii	"\035\213\236\023\335\376\t\377f\223o\373\320\353D\256/\206\033"
+	.ascii	"\006 \210p\273"
+	.string	"7\250wV\360\275\373(r\373e\233l\317\240\323^\027\262 \362\2613Z\210\"\004\343'\365#L\3446\206~\214J\276wV\265\377\023a*\364\031R\302\315d\314'\215\361I[\302\212\312GD\207\242~\024\277\255\004d\330\335\323\330,\027=\215\177\373w\344\303\243\204\223\2211\353\210\030\035\304\t\363:\251B\2331\323\245{\214]\342\364\2308\222r\307$\336%\004\232\214\231.\371\343$\336\224\227\257\235@\013$\031\f\033\216Ls\366\030S\271c\177\356\356:a\005\205\tW-\226\212\007\303\342\nUT(/,\241\313Eu\232\360\0226hY\271\"|N\231\254\260\244@\n+\341\nL\265^@\223\020\263ZT-\020\206\305j\201\246q?W\352\370\265\243\214l6\371\024\377\355\013h\250\260\255\230?\314SYc[\245Ob\244\354\235k\356\346$\300\005i\316 j\247<(R\302\311d\314\037\032\037"
+	.string	"\3571\270\026/,\013zm%nv\005c\255\037b8E\020L\024s\200\314\250\206D-W\244\220"
+	.ascii	"\013\tZ0\3710\b\273\314\326\205\024\027\031N\344\321\336\021"
+	.ascii	"\226\0029\245\202\301\025F\f.\302\035\004\264\231 \210wU\271"
+	.ascii	"\336U\366"
+	.text
+	.section	.gnu.lto_cliWrite.221.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\255\007"
+	.string	"\202\21754@\217\n\035\2335B\213I\350\035X\2373S\346/\016\327Dp\302\007_\264?b\355\324M&\177\243\202\3038:\203\346\201\343%_\"\031c\377\227\374\275e\n\017\241;\004\022A\2044\tQC\204\026\"\2254P\300\243\t\007\222V1\032\221\264\317\226\325$\266^\200\305R\230q\347\212\207OQ\272\256\036\320@\324\027\326\355\342\216la\272\256\232]\323\246\331\241\247\003\261\b\260\362\242\222I\335\314o\250\303\217\257&\261\365u\265\210\367\335\335\215\300\213\205\301%sc&&cY\n\311\337\317\177\367\b\t\247\2720\306L\217\327I\346vpA\247\331\247o\351\026\222\034\021\025\225\tLfj\b\322S\357t[R\317\212\205\352q\0242\363[\2618:\366'\370\r~\224\n"
+	.string	"\357b\310\304\253\276h\206\213\rf"
+	.ascii	"\256\211\r\230@Tj2\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cliWriteString.222.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\007\001\315\f"
+	.string	"\346XWB\020\2176\035c&q\304\3130\253\302\344&\315\f\020>\262\037\2002\250.<\356\033#\310\372\347D\314\377\277v<\365\024\324\311m\371\334H"
+	.string	"\200\202P\224\347\300R\026\240\213\241\324\314\372I\333[\312\224\002E"
+	.string	"B"
+	.string	"C"
+	.ascii	"\367F\226\322\240\342\243\344\305\356Z\232\3010\267G\250\271"
+	.ascii	"\371\251\202"
+	.string	"\302u\235GH\201@6dt \250)\265\234\234\364\fu\237\204\036B\256'\035\202H\371\270.\344I!\330]'\327Y\270\247\333n`\273\200\375\216\245\026\253\310\256>\372\251\217\356\030\323\020\246U\323\231\351g\004\260`Y\340b\027\344\203\261+\361\204C\306\366\323~\210\213\330>\3628\200]\321\t\023\273\236\001\023\270<\332\273\306\364xy\200\351\321\233\275\"\273\273\320\230LU\2659\260<\347\001 \355\330\037q\022\022|\022G\320\362\334\243\257M\217\252\325\205k\352K@\275B\024\0371<\371\371\300\243V\372\016*&\024>|\362S\023\024P\247*b{\235\324\214\004\031GSo6\256\007\033\013\302\305\200\303\332d\232\265\241a\254\303Afq0,\2632\336^EV\320b\305\243\237\250\">\351\030\026R\005\255\3240)\215\032\262\257\tj\202\024\023\262d\277\204s]H|\217I\223\362\2050x`\027"
+	.ascii	"\357b\310\214\246\3632S[\030Z\ri\013\320\266\361VV\200\220\360"
+	.ascii	"l0\r,\374e0\314\243\240\t g-Q.\3016\253)\301\275\270\245J\325"
+	.ascii	"2P/\233\204\371\004"
+	.text
+	.section	.gnu.lto_cliWriteInt.223.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\275\t"
+	.string	"F\322B;0\345(\035\236\301\017\013.\003ahat\345\306v\245\222\3232\01330{\212\002\324J\210\036\344EU`\375\351\276\264\213\b\n\020\316\270\323\326\332\302\325\243\375Ib\311&{\247\024."
+	.string	"0"
+	.string	"2"
+	.string	"\235\355T\273\300v\352\317\246\271\310\332\215\211\f\204\005\300\356\326Y\362\357\362\363\017{\027\242\300\313M\303\356Z\206\250\324=o\033\301\266\307~A'\177\375\366\0173\307\026\257\362\375u\342\026\305\241%@lWd\341\324\n\334\251\307\200K\373)o}w\031\306\335\256\252\345\262\273\036'p\247\007\017\250\321c\202\336\344W\0163\r\260B9m\215\r\371\3202f6~L\320\026A9I\354k\273\273\236+\373\256_n\006\251\031\210\232\335\220\231lG\372\022\022\246\210)2\221@\031\324\241\317\210\024\252\024#\320D\r\225.\352\247c\257BT\252\030\236W\252\034q\257\355\\\371ad\344\230\035>i\273*\206\330K\316\334\021\330\236\205L\020"
+	.ascii	"\357b\314\304[0\334\314\307\307C(0nPC\f\275ejl\243k\312\031\016"
+	.ascii	"\336\224a\320D\236z\005\234\344\3055\311"
+	.text
+	.section	.gnu.lto_cliWriteUnsigned.224.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\365\t"
+	.string	"\206RD= \345*\035 !\360\001A\034\r\322\b\003,X<U\341\3452\361y1D(8\331\300<aB2\3150\301!\2155\177\002A\202\f\002\024\373\344\204\017\300=\002\360\214,\331d\357\224\002/"
+	.string	"2"
+	.string	"2"
+	.string	"\377t\247\334\005\272S\177v\315\305\330nJ8Z,"
+	.string	"v\267N\222\177\227\237\377\332;\241\013\274\334(\354\256e\350\002\271\347m\033\330\036\331\007\005#\20519\355\267\377\232=\266x\225\3574\026ge\013-\035\266\335\017\321\251\0218\247\216\361\\\332Gy\312\367Y\310\235\335\227\313\313\2568\362\001\347\264 \033\023t'\277\362\332\n\024\013E\017x\250\223\323\276\300\220\017-eB\306\326\004m\021\224s\304>\267\273\353\t\263?\373eG \233y\240\331\365\270\005\330\016\253\206yZ\245J\026\324&\022*e\252\021\250\022D5\251(*\351cO\342\244\252\025\236\247\252\036q\317\355\204\231\341d\314\230\032fq\273\257\004\033M\336\334\031\260\275\t\2211\020"
+	.ascii	"\357b\314\304[0\334\317\307\367C(0nP\203H:\025\254\t\231\256"
+	.ascii	"\321f8xS\206A\023p\352\025p\222\027\327$\003"
+	.text
+	.section	.gnu.lto_cliDefaultPrintLinef.225.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\356\001\215\022"
+	.string	"\346\343\177I\260\324Q:\264D\341\337\276\326\026<k\332\032\223\215\277\241\006c\257p\261\353\335\004\311\213w\210\211\311*\241\327\375\355)\215:\270T\3031\033#\270\360\355\217}\316zq\202"
+	.string	")\356]t\316\033m\223\315\377YM\310\3362\245l"
+	.string	"e"
+	.string	"m"
+	.string	"G\177Q;\222\006\257j\r\342\321T+\371b\002\252\203+w\205\007\351S\302\203\266m\340@\315\266\223D?&\036Fp\340I\325J\212\023\305m\007\351\\\233\017`w;\030\342\224\266\374\234\220\260v<\324\365S\244k\355r;\251+\352\304\220\326\216\207\266\220\330\001\342\274o\317\016\267k\022Sk\365\352v\037\356\360\266!\330\226\261\227A\237eY\226\236B\366\227\376\325\311\037<\322O\275\336p\375\326qT)#1\037\265\376\224Kv\240\300\033Fg\272\375\030\276\317,\277w\031\2653\321^7"
+	.ascii	"5PQ\342W+\220\313A+P\035<\251r\273f\263l\323\244+\325\276\224"
+	.ascii	"A\005\245\346\224\214\232\020\220\252\271'm*O\002u\224"
+	.string	"\343Eu\320\273\366\003\022&\020M\375P6\310j\332\343\013\366\004t\262.\377\214\373,\b\360\251\265^g\307h\306\247\016S?\236y\363j\007\334O\241-\303\331\353|\337\357\243\303\005Tn\336\354\"0z\374\240s\310\267\205\340\\\0267y\373:\035\21121\347\220Y\302O\nJBr\253\304+g\t\351\374<\357\005Z\324\300\001\351\211\300mi\223\267\235Cv#\206\325\031mf\262\231P\247\2066\316\300drjF\032\016\354\204&gtpcC\253\240\362\013&V\363\022/\304F\033\3615\313\021a\\\226\335\300f\242\216L6\023Yd=\255S\310\273\274\277\024\365z\3634~\337\027\020I\321\263A\177[\270\263\307\366N\307\354L\334i\255\265\2024ZkP\202_\322\226\016\260\366\203\b+\246~\270ys\312\006\" \200\202\031\301\365\237\030x\211\027\243x\265A\024\020\266\017\302d\347\300 \225\255"
+	.ascii	"\035\210m\2170\271\202\035\310\031\306m<a\234\316\b7E\036\361"
+	.ascii	"c\333@#\216\024\336\335|{\307\227\"\247\016\346\025\006\203\013"
+	.ascii	"\356 @3A\342\025\267\240Q"
+	.text
+	.section	.gnu.lto_cliPrintf.226.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"U\n"
+	.string	"F\323E:0\257\322\001\204\3569\3668H\211\361\261\206v\204b|\226v[\\#\344?\020\207yD\260=\302[\030\345Xs\2713\"\222I\202f\020\302\320\216\026u\274\355od\223\275S\n1"
+	.string	"4"
+	.string	"5"
+	.string	"\325\344;\335k\346\001\335\253C\273\345$\310bZ\"\031&\265\335\365\350\307\303\317\320\177\354\232q%~b\016v\327s\\q\334\364\266\013l\177\354\207\002\273q{I\321jJ\310a\277\375\307\274\261\311\223\204\207\241\276\030*\204\226\253\334Uy^\355\311\274^\340\323\276\353#\341_\024\347\354\262NPv\311\217\r2\017\2425s\200\205R\373s\350\310h\335\364\374%\217A\020h\214\266\304\304\374h\216L\305V^P\321&\305I=\354s\273\273\246,\373\257\237b>\333\232Kie\003\242\210y\022\231\300O\241\363\bDZ\030y\f$\221\311\033\201\017\036\250\343\257!\001\364N\337\007z\033r\317-e\271\316\326V\246h\205Q\334nG\250\204\315\233\001&\251T\263\225\0264\023"
+	.ascii	"\357b\314\304\2131\\\340G\355\230`\203\304E\300\003\0326J\n\b"
+	.ascii	"\203\350\370U\023\230]S\320pp\247,\006C\344)*\340./\332I\006"
+	.text
+	.section	.gnu.lto_cliPrintLinef.227.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"\355\n"
+	.string	"\026\024J@ \305j: \325`o\002lU2n\036\3638\001x\"\226P\027\025\375\003\336+B?J\367R\3376\372U\352W\353*9-T&`\n\321}"
+	.string	"\256\t\033\246\215g0H\004\244\215\r\355\235R4"
+	.string	"9"
+	.string	"8"
+	.string	"f\360\316\331|\247;\347\375\240;\347\321>p3e3\255"
+	.string	" "
+	.string	"j\273\373U\224\217\247\243\177\3305\345\212<\3158\354\256i\271\"\271\353m/\330\376\330\207\b\227\225\324\020\220\f\354\216\334\022\240f\\\001\225\277~\373\207yc\233w\031\377:}?T\017-\001\347\256\312s\316\036\357\334\021N\355\263\274e\274\213\343\234]\326"
+	.string	"\002\273\346'\244\013\350hB\026b;;*i\rM\240\325j\207\026\235\330\331Q\317\377r\030\206\202Hikl\320\227\346\304h\266\323\243\222\266I\322zb\037\263\273\353\312\262\357\372\253\027\241\fj\n\225\304P\2423\b\032\221\300\217b\024*}\240x\361\201:\016+D\342g\nC\361\333\230{\314V\226#Vf\250\232\362\t\263k\322p\276\350\315\006\324\006E2\225\355L\325\024"
+	.ascii	"\357b\314\304\023|\270Q\213\017\263\360C\270\020H\\\004A\340"
+	.ascii	"\260Q]\300\032D\321\257\032\313\354\232\202\206\203;e1\030\""
+	.ascii	"OQ\001wy\321N2"
+	.text
+	.section	.gnu.lto_cliPrintErrorVa.228.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`P\001U\016"
+	.string	"\346\231^E\360\222(\035\260bq[\241d\352\030\\\316\273\3559\323\220\370F\311\305\377}4o\214\212yn\365\261\221\244&g\234^\231Gj\373\260\005\256\325v\200L\325;:\234\272a\034\270\\\340\026\322 \215l\"eJ\001H"
+	.string	"D"
+	.string	"P"
+	.string	"\273\272Ac7,`\001\332\243\303s\262G\355\001\262G\227l\035\017Yvs\002\007\207\027\255\335\355\264\304K\3074K\376\206\004$\245\002\217\211\270\206\250NXgw\017\363\364\240R\311\334\220\354\2563\245\nq\307{\201\375\226)sbX.\232\223\202v\b\246\256\330\307vw\255+\373/\177v\227?j\372\333g\266\305#\264c\367\303\353\307\262\242\r\024\266\277\331\316\364[\274dp\031\360C\033\344\321\004\236\366U|E\351.\032.\262\001\240\232\224]!\300\3448\245\017\3732>\203\344\233\260\203\222|\252${\274\352\210\232\024$L\371\212\361\300\323P\t82 B2S\033d\"\"\323a\313L\243\332\022B\031\303\202\265AAky\027\207Q\001"
+	.ascii	"\313.\352\251\221\206:0\300\002\206|\3468\016s\007\201\207\201"
+	.ascii	"\307\243\200\343\270\315\273\220\037\020\312\250c\362yZ\212\027"
+	.ascii	"\372D\0212\177FN&|:\n'^\250\373|\243n\204c\021\n\350\353RD\242"
+	.ascii	"\257\333\302=\266\272r\234Y\027\215IU0]9)\253\321`\323R\323\352"
+	.ascii	"a\312W\356n\" \240\202\031\302\362\357\030\263\342y'\\\222\020"
+	.ascii	"\317\256\233\232\333\304v7\310\325\245\353^\311\335\261\337R"
+	.ascii	"a\214L\024\tb\007>\2740\376\203F\214\001\217`\311\035\273|\310"
+	.ascii	"\247y\305\325\3340P\300E\001^\302\200\345\312=\272\371\341\301"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_cliPrintError.229.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"\305\t"
+	.string	"f\222B90\257\322\001"
+	.string	"\3229\320\345` s\304\200\r\204\303Z\320hT\372\260\242\037E\2574\213\355\021\336\302\350\376t\373\217'\205\f3\260`^\335\276)u][\324\310&{\247\024/"
+	.string	"1"
+	.string	"3"
+	.string	"\347l\237\230\003l\237\356l\225\177\036{a\265\\\220\304v\227\312\216w\217\235\377\3273\236\352\364x)\330]GO\245q\313\333\026\260\375\261\337\t\363\344\343\256\337\376_\326\330\337E\272\273L_\213\224\001K\026\356\246<\237\366`>\037\360h\037\344!\335[\023\337\354\256JLv\277\217\0070\237\376\002\256\r\034\020\266E\317?\362\327C\007\303\263#$\342=o@\024\226\260B\236\354\357\024%\207}mw\327re\277\365\313\355`\030[\251\340n\306L\206\202\005!\210X\n\221\270\232\260Y\004\032)\210\350\302(D\242\"\316\201\2028\256\f\b\034-\325\312Q\315\267\327V\256|0\203\241$\205M\332\356\006A\350\2123gb\212\224\016\021"
+	.ascii	"\357b\314\304\2030\334\317\307\367C00\327\250+\300\016\242\343"
+	.ascii	"WM`vMA\303\301\235\262\030\f\221\247\250\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_cliPrintErrorLinef.230.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"U\n"
+	.string	"FSF<0\345(\035"
+	.string	">{2\"\013\354@\030^p\341\306Zp\322\212\274K\232\300\337\2012\372[\2021\004\3326,\334FS\235&\r\215\026\207\201`SD\022\247\215;s\355'\233\354\235R1"
+	.string	"4"
+	.string	"4"
+	.string	"\325\343?\334\353\346\002\334\253A{\346\343\311j\\\035\034,\264\335\355\250\311\301O\320\177\354\034\221\025~j\022v\327Sd\205\334\364\266\013l\207\354\037\004\013R\013\220\232U\027\327a\277\375\307\334\261\307\253\200\207\241\276\033+\005\227\007\271\273\002\275\032\264y\375\300\247}\224\247\200\177e\334\263\333\202\221\355\216!\033l\03644g\312Pj{\022\237R\306M\320\277\362\030\005\301\207h[`\314\213\366\224-"
+	.string	"H\r\032\332c8i\211\375mw\327\264e\377\365S\315K\222V^\274l\243\212y\032\231>\257\2013ITz u\020\245\221\251#}\023\235\350c/\202\341\353N\236\367u\235q\277-myad\226\242*\243\266]\022\004\0226k\016\230v\311a\306\210\314T\001\022"
+	.ascii	"\357b\314\304\0231\334\330\307\207Xx\"\004\004s\215\272\002\354"
+	.ascii	" :~\325\004f\327\0244\034\334)\213\301\020y\212\n\270\313\213"
+	.ascii	"v\222\001"
+	.text
+	.section	.gnu.lto_getMinMax.231.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\023\003%\023"
+	.string	"\246\240rG\320\224M:\353\202d\244\377\b\225\bD\200\253%\036d\247\266\r\224f]?\234\307/$\037\033\377\225\306\3060\215\017Z+h\272g\231Z\215\025\0044\203\334\216\322\216\001-\310Zk\025\f\"\334S\033!do)S\n["
+	.string	"W"
+	.string	"a"
+	.string	"i\277\305]\270^{\371\200]\032\034>\273\266\024\033\360\036m\273\t\367\350\375\304=\332e\037\335V\263\235M\211\330\016\221\335\375\224v\327#\324t\371i\004\206l\366z\f!\004^\347pE\221\036\331l\3045\006\026\330]"
+	.string	"3Xf\327`w\235\262\231\210\233\273m\007\266?[a\001\2730\006\376\216\205\r\236\212\027\356\361\032c6\220j0\271d\333^\207\253(\354\303U\032[\323\247\347\374\002n\373\003\274\366\227\304\264\211K{1\335qi.\246#L\303\230V\230NM\237"
+	.string	"\312\217\"\020C\2732KG\366\026\177ll\237\304\316IZ\2206\003\371@\360\037\"\013\222\252\372\230\022\f\352?\251\224\032\267\374\306\205\023#\325}0<\232\030\245\222\320zp>\343(,n\257L\312\335}\251y|\324\361\020\345O8\032~\215h\342f\327\276\f\333G\336\356\353'\234\262\225Iq\2633\233\340\361\244\327\271\202\031X*\271\373\tw=\2513F\"\306\253\277`y\001\037P+uQ\255\264\205\362\240N\251\2502\244>\027\025j\365\245Z\034>\025\023\2634\264\264\276\016,V\353#\261\355\341*\215'"
+	.string	"\271\301hL4yjz\360\036E+7OM4!\234\216\205\323\016\302wD8 \341:Vrpj\242\005!\305x\362\b\202\261\002\324H\341DCB\020\251\246\352\003\2618\250\3047\020\367\030H\250QP\005\025rf&HAAAA\2321\300\002\221\251\272\r\0210A\246L\025MR\2509\337\374\254\252'\033\267$"
+	.string	"e \037&5\266\314\335\203\016\027\224\377\237\367\007\250X\237\245\321/igY\310\262\316)\273\222F_,A\001\031A\365c\262_~\336"
+	.ascii	"`Qp\\d\034\206 \004\004\231\034\373\032R9\303\262\367:w\207\256"
+	.ascii	"\370B\004\330\033\263~\314\3212\261=\232v\003='\373\326\362\316"
+	.ascii	"C\\44\362k\001yu\332\004\353==-\315@\224]C\251"
+	.text
+	.section	.gnu.lto_printValuePointer.232.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`p\022\235R"
+	.string	"\232\210L\036Q0\220\312I\007/@\334\315\335\307\023\266^[\206f\270\232x\033\304l\247J0O\275\320jXW\332l\211\332w\257\355\270\036\027\251\324\246\355\362y\214\024"
+	.string	"\224\252\213or\354\376\243\257$&\273\234\30593v\367\037T\177_MSk\t!R&\031\314\001\237\001\336\001'\3571x[\230W\0221\263\036\243\254C\366\332\324\345\031'v\267\377\355\337\362k\271\271\373\335\267\355o8\334\006\337V\316\254k\007\214]\251R+\222\306\357\247\333\312\021\257\224\225+\350D\210\362\314\210Z\221\006\260m\360\347\026-bl`\354k\330\257m\020\313\263\244\327\262r?#\362\267\345\r\355\256\326\332\364s\245~?\211&\007w\327\344\335(\001\322\3230\302\225F]\3133/\002\260r\317"
+	.ascii	"\351\324+\265#\212\363\356\317\216\226>\215\204\357\324\372\204"
+	.ascii	"\f\\\255J\025[\374\375\\\345\177\320\237\277\367\240?7\3355s"
+	.ascii	"eX\365\211\311\240\205\305\210Z+T\257\260\337\273\251\374\006"
+	.ascii	"9}Q)\t\211xdTD4$\024\004T\202\304\217O\017\317\216\3160\007G"
+	.ascii	"\030\004\336\374|\350i\366\022\247{\337\224\332\223\216`\261"
+	.ascii	"\032\263\205\313\370\242R\022\322\026\033\230x\304\306v\205\215"
+	.ascii	"\212|SDCgf,$\003\032\007\261\035\250\f\316\n\227h;\2116*\374"
+	.ascii	"c\022\351\220SL\"\031\222\215}\304\330X\340\236\2654T\347\013"
+	.ascii	")\245\315\344\t\333I\242\223\034\262\0202\226\303\366_\2321 "
+	.ascii	"C|\021\211r\034(aK\274\376\205T\202\002\345\242\310-\322\027"
+	.ascii	"2\n*4}XC\250\234\016\331f\266`s\027\367\265\363\026\227\025\007"
+	.ascii	"U \202\344@\244/\"]\2771S\334qQs:d\227\3713\204\312\361d\310"
+	.ascii	"#\374+\343\003\203\016\275\214\235_\273\031\327\306\313\031\336"
+	.ascii	"\027\221\344M\255,,T\247\326\n\344\2722\373UH\276d\246\360\372"
+	.ascii	"r\302\351\220I\314\237\036\234\004q\265#\221!\335\230}S\265\326"
+	.ascii	"\345#\027\221\257\211\3572\230\335\375\261\253\363\023\031(\260"
+	.ascii	"\003\375\231#l\251\306\341/\017h\260\205\375,\262`?L\336\230"
+	.ascii	"0\317\231{\001\005\3364\320\256\007\003>\320\2377\276\226\352"
+	.ascii	"\237\257\277C"
+	.string	"\233=\036\2363\207\344\334 F{\327\206\003\374\343\022\257\332\270g\243\315nZzU\377!\004\b\366\035\240?\317\376VW\267T\233\375,\027\254xoYt\367\277\264\351\242\245w\035n\244\2674r\336\016QD\017O\314\006\243\333\327\365\334\334~\311;|\331\203\371\351V\2452\251L;\354\256\231_\255\306{-\037\353\220\312\364\263\206i\306\004\213\365\326\367\"\224\273F\027\356\257\375\204\326\\Yk\351\202\305\325\r\266\177\21306wK\312\027\241.\372j\377\321\251\221\271b6\273\313\027\241o\027\275\254\225\264Z\t\216\303\215_\255W\003\354\343R\023*\370\261@\002\372\363]\204v\347\205\226V\305{\273J#7\330\356\017\026G\246\312\366\223\335\tN\336\032\247\341\247q\362N\311  \006\214\027W\376R'\257\213\247\375-\276\345\033u-_\026<\274+L^(\223\367\311\344Uq\362:\361\3606\355\360\246"
+	.string	"\3622\001yQ\354\360\2360yM\234\274K:\274E\223W\311\344M\032\362\"\ry\211C\336\243!\257Q\016o\221\220\227\350\206w\350\344\0252y\203N^ \223\267\204\311K\342\344\3751y}rx{pxy\200\274;@^\035\223w(\344\315\t\362\342"
+	.ascii	"y\205@\336\240\311"
+	.string	"\013\274\341\275\371\361\376P^\237\311\213\236\274\247\217\327Dy\373\344\345\274$mb\"\254\326\254\037S'\277\254\005N\244`\351\nlG\267\34654\361\201D\203\355\b(\215~!\204\312\fh\352\312\304\205y\373i\260%\366Q\237\f\n#I\245\b0\203\273T\020\3739$\277\224\2451\361Q\357\246b\351XT\0375\320\311q\357\006\f\315\313\347S}\032\261\230\251\221a\256\013\263\030\201\303\273\033\212b\366\326\323`\213\026\021\263\363\242\321\"*\350\300h\224K\3140F\243\\*\344\020\320\237\262g\006GF\373\304\330h\275\t\233\036\325[)\354\345L\260;\263r\302\262\021\"V\227pwf\205\310~o\n#\371\350\242\205Y\214(\361\356\260\216\3709\357\214\307\250_\260\t\3511m!}\001\375i\264&\313l\247\250a\234I\217\t\024u\320I\220.W-\350\020u\214 \322\243\002Dk\252\220\f\207\232"
+	.string	"\273\364\310\300P\007\235"
+	.string	"\351\262\325UU\3775\272\"9B-\243\031Lz\204\340'\324\026\354\255\331\352\312\373\021\033\236$+\314\341\260\3262\020S\t\326\276\356\210\325~Y\002\033\317\244\216\005\321\333\357m^\225Z\333\354/\254\"\253r\252\317\366\013\231\303[j\261\336\336\313\337SB@1\243\0246\330\016\217\300\t\372\214\262\324t\026\275\025\3247\003\324Aln@\341\025\340dD\021\250\241\240\334\254\265\326\240\323Y\364\004\375\273#\3160\260\310N_9t7-K\315|\346\300,\257\332x\024\304\324\030\271i\260e\321%\372_ja\236N\242K\364YD\226\327O\223\350\243=\315\215\023\273\351\225\243)\240\0306\343D \360\223(\354\247o\306\250\301\373\371\364\264\317\031\013\022\320\201\376\354\331i\251\346y\231\353\364\216N\377\213\336[\017\317\231\273\342\033\346\3640\210\233\301\0221\006\321\203%\242T\002\n\320\250ac\006\361"
+	.string	"\004\"h@\202\007\036\2601Chi\320\260an\r\033\275\304\025D\263\307\216\rZ\004\034\033\364\271\343<x\200\240\201\371C\307\007=v\370h@\007\b<p\204 \374\201#\204\336\034O;x\344\200\352\261\003\307\006P9~x"
+	.ascii	"\365\364\263>8\320\361\003\352\003\037>~@\005\353\373\211\332"
+	.ascii	"\017D\214\221eU[-\017\371N\0319oJ\221\001\216\352\025\3756\316"
+	.ascii	"\201\n\210\";!~Y\024P\235\241\032\342\005\223\2546\242a.\251"
+	.ascii	"qE_Mr\017/\r\001\336\245ZC\205w\273\272\274\245U1\255\254\214"
+	.ascii	"\322\ri\223\"\004h\222\330\250\216(R\345\375\262l\254\325\315"
+	.ascii	"\341\310)\261Cj:T\031\247?5T_+\251\242\243\372\251\331-K\317"
+	.ascii	"\251U\364"
+	.string	"\251\366x\355\206\223\235\226\242S\237,\271\246\f\205\013\263(\201\303\273#\256\340\246^\256!\215\222\032\261\320\237M\315nL}\242S\374P4ST\243h!9+\236!\305\272\233\2352\r\362\024v\345D\2430$\323\224\245U\035\231Xj\023Z\214v\343Y\302`\340\2634\210\t\273Z\257Z\310\300f\351\226\271i\t\307t\b\372s\251\237\005\n\027[I\213\3000\3021\244)\004`\007C\261\177\227<\203\227V\344g\373\316Z\035\332\322\250\250\253\226^\210\224\\`)'\013\342\244*E&\326-IKK3\324`\234\344-\2303,i\023Rj\246\242\366\305\355J\375D&\031\344&g\326\372%\343o\377\035\r\274wSu\345\bPT'\375\355I-BRLY2\210\243r\240\260\004\200\317\3457\234\313\3416\207c\013$\251\222\303\235g\255\256\3102\213\347Jo\254\004\023#]\300\344\252\215_\251\224"
+	.ascii	"\354\2328\331!\365\343\222aV\360\333\002\201w\250q8\003\231S"
+	.ascii	"fFDDA\222$i\r\301\005\304\030\346T\245\007\022`DA\t\224\316\021"
+	.ascii	"*IA*\365\243\003\234\"\375\204\216j\205"
+	.string	"iE\032\365o\317k\025\343\347\364m\261^\211?\263\325\312\362)}\252\225\3067\34503\321v\366T`\240YPt\370q\211\360\210\201A\241/\353\315Z/]\030\24513\322\266m\275my)\241\310\327a\203\034\"UUEp\276R\3658*f\2327\330\247J\374\313\253\345\356\206\246\362\256t*\237\362j\201\2667\232\266aw\221n\270W\337\344\nn\36168\221\0047\024\225\027\310\007\236\\\246\260>\223Z=u\242\261\210\366\374\317\037g\226\215\343T\302\232\301\005P2k\030LN\250-f[\257\271\265\255q\326R\261_\021(\250u`\033\276\260\346\244\242.(\345c\253x\265\365\377\306\212\224\374\242pY!\357j\305\240\331\241\347\230\201N\320\213`\320\317BJ\026\\\346\203/\315^"
+	.ascii	"J\fQ#^\204U\210\252\n\026\211\367#\017\341\356\023\037\312r\231"
+	.ascii	"\206&\272\260=K\t\301\320\373\365\211\3742\237\204KF4`1k\374"
+	.ascii	"\036\271p$\211R\330/#\221%\031\265\344\263\246@\322<\021\272"
+	.ascii	">\317\353\375x\225\240\232@\030\333%\260\276F\345\236'\240\032"
+	.ascii	"\254\n\013\234~\037\031\376\314\177\271iw\r\034\256\372\261f"
+	.ascii	"\016/T\372#\232\261\231\322\270\341\376#6\272\3166|\r\232Z\216"
+	.ascii	"\202\371\f\354\257\261\235\215?\350\200\006\023\322>\033\334"
+	.ascii	"ZZ4H\301K\372\235]#\366\254yH)c!\036\200\231\223\204\202\344"
+	.ascii	"\352T\231\365\330\330\271\034;\263\363\202\02222\n\363\217.9"
+	.ascii	"\002Y\026\226\025\212\236\220y\201\267\237\372\347\t[&\0275!"
+	.ascii	"\343b^\326\032\240/\313GI\300\274`\213\357+R\267}\227\206}\257"
+	.ascii	"\002\212\230\314^\314\2705<\333\374c\025\351\241\207I7\364E\350"
+	.ascii	"\230m\337\024\262\232G\3716\362\255\002'bj\207B\264Qbg\265e\035"
+	.ascii	"\303\230v\303jS\213\344\254gB\n\374\340\033\201f XM5@\236\372"
+	.ascii	"`n\276\351\271\373\334\264\201\367\341C.f\362\025\027\345\303"
+	.ascii	"\272\227p8Z\300\376/\001\t\002\345S\357\002\371\351\207\337\234"
+	.ascii	"\332\246\246D\235\215\2324.\017\013\265\300\357\021R\3151\255"
+	.ascii	"\256Pw\310\017\030&\347\210z\353)g`\004\206\205N\243{\363\275"
+	.ascii	"\322\nh\2202\343\261\006@\001\r\335\335(RP\272\363\2424\254\214"
+	.ascii	"\226\326\361\2748/Vh\333\037\271\240U0\203\002\2230m~\001\324"
+	.ascii	"\260\257ie\262\250\001"
+	.text
+	.section	.gnu.lto_valuePtrEqualsDefault.233.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`G\f\3559"
+	.ascii	"\212e(\026AP\246N\007\227oWU_U\204\\\360\221\367\243Q\371\210"
+	.ascii	"\345,-\016t\252?|\200\370\332*\244<\341?\201o#\001M\023\021\321"
+	.ascii	"\253\036\250{\204\035^2A!\226/\265\237\232\320&r\357\224R\n["
+	.ascii	"\001/\001L\001\334^\310\322\353v\377\215\033\240\035\225{\237"
+	.ascii	"\033\364\030\332\227\355\366\r8N\267\277{o\204\265U-\275e\254"
+	.ascii	"\363hD\235=\357Z\020\357M\317\316\252U~\260\266\032"
+	.string	"\225fa\262\374'\357i2\272gx9\250\334\231\333\256\261\214\365]\215>\336+\207'\314\275\317\003<`m\225\237\255d[]\033\311\266\252\240\301\030\2235\241\225\361A\340\314\301\334\002x\357\023\353\215pG;}6+\235\254\241\224OI'd\023\323\222R\022\322\321\321\250\310HT$\016\205k\320\252\351;\031w\220k\2575\230\001\211\342X+k\2504\210\266\203I\273i\336\245Y\201\177c\272\217\351\312\"lX\372i/y\245\235\254\\q\244\225*\336\244\307\324\244\227\2304q%&K<\t\013R\222>B\222\304\217H\216\270Q\352\254\362\244HH\033\353\232B\234\b.\210\027\327?\316%|\342\330\354\232\310Rql?zX\327\374\341B7M\037i\224T]\363\315W*J\350\200t\\\323\315\016\241H\240,\025\327\264\263\301 \327\275\267\373Z\204\363\b\23786,m\333ZMC\363\264G\177j"
+	.ascii	".M\017\343\332Y\252\324\206\b\236\336kW[3s\017r\335{\331q\254"
+	.ascii	"\2615\003hf_\301\314 \230\207g\001J:\376]\367\326W\005\211\007"
+	.ascii	"\232\241\177\266\3222\370\336\353\325\r^\2353\017d\366k\245\355"
+	.ascii	"g\360\354L73&\321bJ\254\367\2369\340\016C\3264\261*i\225\273"
+	.ascii	"\206m\265_\353\215o\320\235\r\2172?\313\374\347\230;\213.\260"
+	.ascii	"\020\277\034\263\205\n\\\024&H\210\320Y\272\267\372\331\255\005"
+	.ascii	"!\253\357\272\037\250\316\rTg\006\326y\201uV`\235\023Xg\004\326"
+	.ascii	"\031\253\371\232\257:\257\371@\3535/\255\332K\263\001\241s\225"
+	.ascii	"\320\231J\350\\\340\350L@\350<ut\036Pt\026Pt\016`\344,U\344\034"
+	.ascii	"e\344\f\240\310\031\252\350\254,:?\t\235\223Bg'\2433\322\350"
+	.ascii	"\334D\344\314dt^\"rV*:'\025\235\221\210\316GC\347#\321\331h\350"
+	.ascii	"\\\024t6\n\235\211\204\316E\325\231\250:\017Wg\241\352\274\256"
+	.ascii	"\316\301\240\263\265\316\252uNU\347W\235]u\356\013H<fo\2648u"
+	.ascii	"\374\234\347\335\021-t\375\3241M\232\257;\257[\257\333K\247\314"
+	.ascii	"\315\334_\270\373\230\310\307P\037zv\200\037\326V\233y\214\233"
+	.ascii	"Kw\351=&\006'4\034m\375\361\221q\376\244\320\320\302\266jd|\255"
+	.ascii	"/2\276j\210\350\347\364\364\0337\335zr\330\024\177\216}h\325"
+	.ascii	"\3013\302eca}\205\3678\226\370siV\340\237\230\341\3131\rK\364"
+	.ascii	"\035\b\257\316\201/>\3217\323\215\370\305o\346\241\341\257O\374"
+	.ascii	"`\036f\333\327p\353\205\237\334\222\006\245\377`lX\271\301l\253"
+	.ascii	"\353\267\232\017\033\036e\373Z\037\374N\203r\365\366-_O\025\332"
+	.ascii	"S\023\222Y\253\017\212\341s\342\331i6\275\202\214_\231\033\342"
+	.ascii	"\275Amm\353\3171\036\356<i\227:\334v\376N\016\367\034\277\362"
+	.ascii	"\206\033N7qr\207\370q\267a=\353\275e\r\307\255\264c"
+	.string	"C\2563\211\223{oU\257af=\335p\254g\245\273\315\373\274U\2556\370\356\353\243\236\034\250\037\323\017q\260\301s)\203\266\026\3749\266\316@*\204\267\316\266\264(\032\215F\233\312\036x5\266\352C\370\006\224\376\262\325whZ!3\217\362\177\372\315\241\317\224\030@g\346\211\356\277\233o`\006\251?\307Li\316\276\317\372b\236S\207/{\371j=\246\031\374\227}!\224\372g\275\003b\036\262\321\241\313\224X\322a\017M\006\304\024\235\020\r\035\321j,Z\354KF\f\2570+\366B\006\330\005\261\027^.\274\276\274\212-bt\271H\305\276dt\255\360\302\020&\006c\030&\006\343\303\272f<\253\270b\361\245\002\353\005\213.\027X*\302b`])1\030\f\2570,10\2600,\342\355Ti\365\021\"\034\375\346\b\361\263\361f\177P?\307D\034O\026\036\320y\204\t\306Z\365\325\253q\372d"
+	.string	"\216s\007\023\214m\265\253_\276\312\207\317\b\336\2323\017\354\364\336{\225U\212$%\274\235\022\210i\302\333)yH\024\336NI+\342\352\266\264(}\304\n\317i\320\352\r,\373\352-\374\222\231\0170ipj\272\335\220\243=9!\227\275`\301KH:UQ}U\201\237z\252:\032\005\266\236\300'\241Q2)4P\330V\247\004\274\326\017H\003\274\200"
+	.string	"\310\276$w\272\365\346\360hZRZ\266\002\005?\201iI\352\001\020\"\273\273 \265\365Q\217\004D\310\302\205.\333*"
+	.ascii	"\345k=T\007\352\247W>\275\335\242\024\245c(\351\350\270\354\004"
+	.ascii	"\t\236\002\322\321\313\365\351\244\323'\221\357\324\364K\217"
+	.ascii	"\374  \300\017\031\232\266\236\351\223P@\021\031\274l\253KI\257"
+	.ascii	"\365J\336\214\306\"}\322wZ\035\322[\350\321O\034AFF\242e#@\360"
+	.ascii	"\\E?\227R8\353B\305\370r|\364F\001\200\367\250QH#\231R##\"A$"
+	.ascii	"I\2224\006\340\002\021!*\352\021 %cZ\325\202\246\320"
+	.string	"\030\277\340\356\342\321\221S\021\244\f\211\324%\372\244\262\275z\351\007o\t\374\221\265Q\330\235;Q:\231'\343\323/B\2248\254\243\315\001@\024\351\301s\337\"\356=\257s` \227\325\205\035-\374[\017O\221G\370\267\037\300B\265\024Wh\036t\272\365\b\374Y4\317\262\311\b\206+\020\314\360K\220arR\003\243\242\266\276_\320u\246\266K\306A\275\022'x\341\336N\261_\032U\b\f\335\006\310\351\001\254\257\262\201\034TC[~\357\221\262\314\237d\2109\336\363\371v\231\177\241\376oU\007^\261\313\230\371\024\340\246\033\265\366\374\245\034\251SY\016\334\202Wi\2337\206voe\233\254\336\234\270\267\336\206\267.B\026el\210Q\327\335W`\357\324u\356\245j\017*\232\217s\210Yy!\026\013\353\221\303\370\233:\326wB\360j\020\2179u\340g\343O\266<X\236\217\037\365[\005`\362\002\346\033"
+	.string	"\347\307]%\310\214\320~y\353\3031g\313\0363\310\002\006\261\246\333I:mc\252|\303\237\312\0234\313\320K\213y\250W\350\365f\313.\260M[\217K\263B+\346\276\264AYi\030\265\2664"
+	.ascii	"\304\206\203\202-\002\216\377\316\204U[\243\377\317\320\372&"
+	.ascii	"\251\2543\302\213\221\001)N\276z\326H`\t\217\034d\027\344\342"
+	.ascii	"\200\331\b>Y2 \033\001\227\300\372QYA\244\240\334\3638\3502\t"
+	.ascii	"\025Q\220\025\001\217W\210\251d\r\210L1\241\032"
+	.text
+	.section	.gnu.lto_getPidProfileIndexToUse.234.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"E\n"
+	.string	"\246\023G90\315\244\003K\020\031\365BV\366B\034\314\013\225\303\340!dP\321\3221\205\276\344\221\264F\362\357p\333\267\324g\300C\030\n1\202\271v\313X\033t\321\373k\322\366\226R\2466"
+	.string	"5"
+	.string	"8"
+	.string	"\013\356\224\315\340wgk\031\271`\335\3041\334\251Z\t0\252\266\345\301)g\0210\232$F\207\"\331\331rj,1{\t\265\326\2638R\354+\373_\341\377\300\277\034\177-\344~\375+k\273\376\363\275\363\347\371\314\374\265`N`\343\262@j\235\330\241\324\220\371\021\373?\372/7@\030\035\314\234B\023\215\314\206\352\310\325Z\243\215\021;\356UlCDZ\370\207"
+	.string	"\361\212^\257\254U\352p\177\363\240\265\272_\340\206*\333\230\f\016\234\211u\377j,-\364\205]B\304+\356\374\212*;\267\tp+\022\357\002\3776\234\316G9\235\217:p\026\032\350\367\001\321\215\300=\017\f\037\032\341\361|\350\245VW\326v\275\300&g_*\332k\356\324\177n\r\251Kr\366\253ggJP)$\016\017"
+	.ascii	"s\2046a\303\360\243\\\313\304\004\001\021=+\204\305\340C\333"
+	.ascii	".\214\351\230\351=X\006\256=A\211\377T\215\032\227\202\002"
+	.text
+	.section	.gnu.lto_getRateProfileIndexToUse.235.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"]\n"
+	.string	"\226\023H?0\211*\035\364\210p\315Dc\\tA\302\243T\252\364R\243hH\306\376\035\353\3207i\201\f\364\355\223\254B\370=\246\030\3434nT\006\006\030J\371\326*\215\364Y\034\017 q\362\367\2262\2454"
+	.string	"6"
+	.string	"7"
+	.string	"\357.\343j\347\277uI\f\206Z\360\201\336\245\351\221\0014}\343e$\013i"
+	.string	"E\221\022\222\"\274u-\201!U\255b\316i\375@\220;r\333\026\266#\354k\366\313\323]\331\217sU\266\325\232\325\322jU\365%\224P\001xT\2029?f\026\346\003\331\200e\373cO<A\361q\3670\362(T\b8 !\220\315\371\332\026@3\335\023\353"
+	.string	"\204(Q\233\203\243\377\264}\201Th\275;\306\300\225\332]u\357D\276\224\020&A\244\241}\003wu\374\001\366\360\350\277K\337\023\271\374J\0048\201t\026\346,\230\f\267a2\334\246\201\271\310\330\270\rg\2638X\263\201\261\331:4\232\3156y\315\307\271*_&D\271\023\001\253\255n\311\266n\005\264\241(\277r!*\220.\2004\017"
+	.ascii	"s\2046a\303\360C\t\237\227\200\025D;\b\261b\360Al\327\304t,\364"
+	.ascii	"\036\"\003wOP\355?\245\243F\253\240"
+	.text
+	.section	.gnu.lto_getValueOffset.236.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\337\003m\030"
+	.string	"\246n\235H\260XQ:E\034\302h>^1\214\032\240\313\204\320\277\367k+/\365\233e\302\277\320\370\006\235\254\2464\376\325\3768s\3519\207XSz\352\237\322\237\326\035\306\353\201\203\360\233\3134P\f\342\321G\377'\204\220-eJ\001\213"
+	.string	"{"
+	.string	"\217"
+	.ascii	"J \020\025\266y\354\224mU\373E7\3429O\303]\346\034r\342cN\236"
+	.ascii	"\001\323\214\007\315\033m\3731.\203\307\263\232\r==4\273'?5\230"
+	.ascii	"\346\344\301X\207\t\017\352_\302\203{\342\263\217b\b\312\325"
+	.ascii	"\231O\373\210\240\003\013\221i\367\013\357b\327\003\025\305\316"
+	.ascii	"J\224\022\"\200.\245\202\244\331c\205\333 \305\026?\026?\272"
+	.ascii	"z\300\371\350\376\330P\270Z\310\232s\276D\b \251\342\2029\247"
+	.ascii	"\365\206\023q\237n;\3106\001[\262\002:\333Kz\233\004\016\316"
+	.ascii	"\024\020\262\251\3172\027"
+	.string	"\020~g\326\372\003Ts\205\323\2600\316\351\223\300\237a\203aLq\320\327\020\036\374\376\350RH\216JSQ\217\376l\036\355r.\221}9w\310^\365\214\325/\253c\254vY\335:\357\007`u\213T\257\244Z\265j\026\251NI5J\252O\253\036\245Z\224\352P\252\301UK\251^\251\326U?\200\312\304\007\334uT\346\004\361\2732\003\342\332\344~M:^\303\244\027\032\331\211Y\233\234\317Q\202h:0\334\335\327\312!6\335\313g!\270\341\312$\331Z\324\364g\271\340\376\307\267R;\007\202\376&7$!T[\232m\235\023\331\331\225\345zM\253%>%r\211,M<\026\352\312f4\361\321*\266%<HL\227A\256\007\3437\016\001\212\022M{_#y\351u\245\310\234\264\367\360}\260^p\330\341'\215\276\025S\b\207\237\303K\343\234\264\353\f\n\315\035\323\212\333\260\275\364\0079\030\"\334d"
+	.string	"\215s@'\002\016l\202\316\215\004\030\216\314\002\354"
+	.string	"\214c\024rd\260\013\261\230\f\226\262m\336\374\016ye\373Q\244\376,\f\177\214\020[;\300f\344\013]\353B2B\002\306\354\217~\"\233Q\221|m\313z\260\335\262\2725\037\351^ \307\325\246\2665\363Y\250\332\325\212KXV\325R\273\201\003\375\215e\337SJ\255M\020\r\036\257q\202\023Q+\256kW\212\247|\026\236\026\265\341\223qO.j?\270\321\337\306}\222#;\001F\250Q<\304\020TdfD(\211$i\332\300\002\221!\263\003\0210=d\254&.v\003\271H\335\304\367g\264v\3716\327\362\374i\224\267\302;\256Y"
+	.string	"\t\246\225Y\241\333\367v\343\0200\370\212\230\275\032k\366\362\317\221=\030\302\026B\2558\034\2038\354\206q\310\013\007Q\260\204\022)E|\376\030\222)\1777\3053\345"
+	.string	"\324\025"
+	.string	"\b\221"
+	.ascii	"\334<\355\222\377\tB^\0325\205\b\356z\351\332{\205\037!\304\013"
+	.ascii	"\232\r>\324R\001\025eX\224\345w\002\223)\025"
+	.text
+	.section	.gnu.lto_cliGetValuePointer.237.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\350\001\245\020"
+	.string	"\346\037nF\360\262&\035\330\343CYz\206\346\307\256\245B\225\b\231\332\003\236\350N\"\203\\\375:\247l\372p\2536FX\213X\203\351l\225i*\335\266@\033\314\020\26085aG\240r\220g\273\252A\233%do\"eJ\001Y"
+	.string	"R"
+	.string	"^"
+	.string	"</'\355\332\334\240\261\373\235\270"
+	.ascii	"wh\333W\361\025-\273\307\200\017\207\206\300N\007\231\026?v\277"
+	.ascii	"\316\337K\342!\367R<\324\233\267\0165\315\226\357:\324\034\035"
+	.ascii	"\232HD\216\r\230\367\341:\342\2754\223\335}\317s\306\213\311"
+	.ascii	"\334Rv\327\t\363h\356x\333*\266O\354t\020\251#\354k\25366\227"
+	.ascii	".qi\322\277\233\344<\377\210K\213\266tH\323\\Lo["
+	.string	":j\032\306\264\006\323\252\245S\323\0170\272\221y\307\231\355z\230\tY\034\260F\211\177\277\335\362{,b\373s\001\2609\366\336\216\235\032\037\273\337\201C\033\340\016\363\001P\017\"\204\335\340\262\0071$@p\211-\261\237\334]\227\232\025U'\370\360xe\020\373/\016\203\345\3538\202)\0173)\202\230\fH\315H\246\332\250\ny\030\211\232\274\324\345k\252\016\221\tr\352,,p\273\257\004\276\017\005\026N\347\320\177\211\207\327\367\034\242\210\311R\360\300\344\314\376\\\001'\324JQ\254\025\323\006\350\023Jj\345\324]H\231X\272\323*C\207Rb\025\006\324\252\323\240R\255:\221o\257\255\3328\002\271\320H\n\200HhIE:c[\244N\201\321\030\030\322MI\234\2068\275\211\005\237\261iKL\206\026U\323\222\346\017\207\023193\324\250\227\t\022\220#\265U\030\344a\001$ p\002\031*\253\007o\f"
+	.string	"\343i-b.\202\225j\005\233N\033K\204l\210M\224f\321\366\005\310\002\237\005\351\234B\320\370`n"
+	.string	"\035\261\320b;\024V\330l\213\016\326"
+	.string	"\021p\316\007lL\2644\030q\271p\036Q\017\2053\376\371"
+	.ascii	"/\007?\0275q\262\235M\300e"
+	.text
+	.section	.gnu.lto_cliGetDefaultPointer.238.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"-\f"
+	.string	"\346WTA\020S\233\016\324\r\361\204"
+	.string	"\017"
+	.string	"\242\257\372\215g\235\247\210I\376\334\277\306CB\346 \366TDk\266(:\307V\020\253\336\377\356vU\013"
+	.string	"$@B\324-\021\255"
+	.string	"yC\367\272\255\033m\"eJ\001@"
+	.string	"@"
+	.string	"C"
+	.ascii	"\273Q\343\001\327\241m_\305W"
+	.string	"t\266\016\325\200A\364\341\200\311\210\221\013\036\2731s<\246:\274~\251\016U\304\273g\347\377\344\013@\224jx_\350i)\330]\247\367u\270\365\266\t\330\326\330\277\020\330\343]\271\351\267\2524\3244\005\323J\245S\323\007`!\261\341{I\306.\207\223\217\265\001i\230x\374\355\316?1f;\206\004\330\033\373\017\207Ii\307n4p\350\002\317\233D.`\227\224cF08/>Z\210&(A\351a\311T\373\201'\357U4C\242!_S\365\307(\305\020\336\002t\355\222 \360Y\200lW\211C_\244:\274\036E\tJ\n\223(Ov\f\245\206\260O\355\356ZI\266\225\016Z\207\323\016\205\017\247\002\264\266\361|\264,\202\207\003\3124NB\266\301x\003\351p\331\204m\3432,\356\251U\022\246\031\221\216\030\252*\246\032#\303\211\221<\231R\250\037\245\\\322R\233A\203\274G\251\005\017\266\203\007\022"
+	.string	"\357b\310\304\303|4\020V\344_E\365*@\310N\211\025\034k\332%\264\241\251"
+	.ascii	"\332&`\3055\261c\302q\024aB\r$~\3461\265\223\f"
+	.text
+	.section	.gnu.lto_dumpPgValue.239.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\342\004}\035"
+	.string	"v4\272H\220\236M\007\f\2415\n\017Y\205\220\300"
+	.string	":\350\330b\007u\241?\b\366(\337\250M\013\346\017\037\327n\242\304%\260\221\341\200\326\244?\220\020\240\310\004F\376\250\202\216\303 \273N:\212\352b\320~\267-\367\226;\245\224\002\241"
+	.string	"\231"
+	.string	"\246"
+	.string	"m\025\243\304\245\027I\024\343\204\345\304\353\336TAWv\300\354i?1\033\312\f\036\357\375\361&\201\355Z\202\355\314\355\244\247\314\246\242\321"
+	.string	"\356e\312\302ro\272\200\017\330\256\2346O\330\325v\200\260+\233\314]3\033\027\367@\311\323.\212\327\275\227\366A\332l+\206\025|7\271\305\237\021\345\341\332\212??\222z-\356\350\020L\360\313\262\206\344\355@\036\244'T\306;\275\356H\236\r\007\221\350\350\351\374e\274\034X\336{[J\373\r\236\316]\374\271\367\262\243\274\244\346\261\231\031\0073\223`\006\177\001\376\314&j\336\250\200/u\217\343~\377W\263{\303@M\305f\357\325E\340\2362B\205u\242\021v\355'}t\361-MQ\325\360/\346\024\347\337\304\334\340}&\346\206\322=\240\255\232g}\325,\240\251\272wFg\035\3219\207t\226\215\3161\321\031\207t&a\3160\230\3638:[\321Y\034\235C\353\\Eg\260:\177\350\354\325\271\017\004iA\312\301k\"_\367\"}\265\271\276\252\345H[u_u\224\226\302$3_\301"
+	.ascii	"o/\275I2 E\322\n\266+7\200`\006S\344w\222\022\031\251\322\033"
+	.ascii	"\253\277T( \344\336\263Q\013\366\274\340\203!\2037\312\255\305"
+	.ascii	"\305\203\302\023\272\024~S\227\236\2753\351\364\336[\277\211"
+	.ascii	"K\303\276\250j\253\204=Y\345D\346\301\030\341\354}I\325\226\316"
+	.ascii	"\331\264\337{q\337\b\302\361OT\225\3219\033\326i\004\341\200"
+	.ascii	"\037\237\3149\201\331\365\bx\370\366w\236Y\303\006ot\366\345"
+	.ascii	"\3718\256/\276\375wsB\3458t\026\361)\f\251\017~\370}B\345\374"
+	.ascii	"\213\377\353\277\033\017}\005\204\225\017\"`<\2040^\230v|\347"
+	.ascii	"\231I\224\360F\377_\213\213\347\003\340\001\\\032\331n\225a\261"
+	.ascii	"\347rB\trid\273\031\bU\020\271\221\320Q-\205\355\302M\250v\344"
+	.ascii	"\302\026\013\272\3256"
+	.string	"\020\2618BamGB\265\027\225\201\030\254\020\002\242\265XQcA\003*\272\321\030\360\360\020\221\255\210f44TD#\323\333\317d\271\266\370j|\316\2461\215\364\374tr^\347\273\312/\347\273\247\204\246\313\214\352a\"s\260%{\031J]RZ\346\220\236\"\366\f\321X\\Q\276\027\307\230F\216\330\263C\230\245\303\353\347\343\n:f&1\225\340|\354\373\314\t\225\013\203\363\315E\311\f\0303\312\224\262\247\006\237\256AK\276\322\311\227\320C\367\270&\235e\006^\250\2018\342\240c\210D\202\2244\205\205\306\300\002\021\"\223\007\021P)\204\214\214A\235,\007\337\250\321\310\233I\"\371\307CD(\034q2\2107\236M\250\037%6\330\221\021h\224U rwK\267?\226{ae\001:S&Zc\312t@M\325\035\351sz\207\303\301\3025\205Z\307LR0\311RB\030\3762\301\242PT\356i"
+	.ascii	"\\i#\3320y]\224\306\004\303\004\\\266\261\227\242\226\246b\217"
+	.ascii	"\016\035\\\0170zs\342\321m\n\304\030Y\"\345@\353Ja\203\310\233"
+	.ascii	"!\230\267\275\004Tk\205D\363\364\t\204J\345\322G$\306\234\023"
+	.ascii	"ip*\351\377\031\341\177vNa\227jcx\316K\337m\036U\003"
+	.text
+	.section	.gnu.lto_dumpAllValues.240.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`F\003\225\031"
+	.string	"\006\260\250H\240\230Q:\020|x?\321\240|\317\312%\003\270\236\223\307\325\013R\t\3754\305\006\272\306\033]AT\365\345\237z\260\231\311\020\254|\263\346\311t\036\213\247-})\236~7\246\rq\024\230x\335\332k?!d\023)\223\f\226"
+	.string	"\210"
+	.string	"\226"
+	.string	"K,tv\347x2\245;\310@\021\220\237\002\216#~\356o\304O\315\251Z\021\340\265\020\004%\252^SVw\317\270\207\222\233\273\213\034\305\031\362\346\364L\017\217\200\210\361\225Bw\205#\017F\322\275\304\260\021\352h]E\335ihI\036EF\037k\\\f\025\340\220\232\201\323\345\250\f\254$\332)+{aNw\303J\336\206\341\003^\326\rY\271\013\001h\365\300\034\352\353\242$Z\276\3239(U\235\321Qd\364\035)t\267\256\257,\272\276\256\252AT\265\202*_\b\252A\241\325\361\241e\245\274C\325\346J\376"
+	.string	"_\372e\177\272\306\304\325\327\233\256\243kU$W\347\270\032\356*\357\352\212\253\037\020C\362\242|\222\230n\030[izjF\001\371\323\337t\3253\321C)\254\311\235\344\376\204\023\320^\372e\031%\253\t\344\247\006\311\337\210_\242wR\330\247\2526\251x\027\365["
+	.string	"\225\252\256\272\203\013>U\002\371y\230\252r\360IrW\262B]\335:\3268 ?s\302]\325\033\371\221\334\003\"F\354}\3721Tg\246x,\244?]\013\240\310HW\376\342\330\322^I\212\214\220y\026\242\2149\310\227\212HTU\310\313ALdv\253\2452f\016\303\274xo\254\364\326\020\270\001\361\374b\335\236\321\220\322n\245\346\341\207\225\325\275\213P\305v#?\254!Q\247\202\023?\317\036~Xh\226t\273\245\372)\270\004c\272w\367\251*\320\245\330f>\272w:P\036\245Dx\340\247\336x\304\373>\365<\342g\214\017\365\f_\222\260|4t\273\305L\260\360Jf\2446\\\017-\305\274\235\347\004\r\003\220\017\216\004i\342\347\206\242f\333\261\341zh)"
+	.string	"h\255\301\255\24763q\243\371\314jA'f\rp\364\007\310\0264C\361\363\0234\203\005\373\274\203\n\315\224\216\207\264\300\212\254\212AC\316\356\\>\345\243\007\352\206\235\335\021?E>\323\025\374\324\240\271r1\222\306\262\2146<\213\254\272\030y\262\205-!O~o\215\226Ku\b\017\324\017 @\360\201\037F\272\335z\330\335M2\322U\210#\333\360\235\036\342(\311\f\021\216\241\335Z\031\343\200\r\3001V\r= p\002\231*\254\007\257\030q\264\250^wh\246\n\033\315X\240\271\346/\017\001.\244\022\357Nj%Zkjv\340\004\311k&\306\257f\234;\313f$\374\320\265\220f\302Z_l\t-"
+	.string	"Z\366\312]\024\324\002\030eX\342\031\027\202\270\212\357P|\342k$\306\203\342\2531\036\360\022\332m\344\222u\030\020A\372"
+	.ascii	"\035\202\242^6l\302\205F\370\275\332\317\321^\006\346\350\356"
+	.ascii	"^h\203\327\203\017\216\362x\332*\226\205\334r\304\324\0322"
+	.text
+	.section	.gnu.lto_cliPrintVar.241.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\272"
+	.string	"u\013"
+	.string	"\226\226O> Q\\8\344 >&\300\003\217C\013\322#\326IX8\030\372\275\f\300\006{5\274\243\377\265O\177\263\253\261\034s\314\212"
+	.string	"\002\b\006\321\303\213\305H\336N\277\031kZ#\021\021\"eJ\001="
+	.string	"@"
+	.string	";"
+	.string	"\003v\303\030,v\305\212\021\\\247,~R\235\272N\240:\345\316&Q4\254\327\300D\b\350\003dw1%\361\356\331\371\3678\307\007zO\353\301\356:?\360\303\255\267}\300\366\002\373\020\002\351\324\364#"
+	.string	"ft"
+	.string	"\037*\355z(\335\330\221j\021\372\350\267\177\017Kl\217LC\300\312\330\203\341\t\0165vE\005\247\\\2714m\006\016\272\213\026(\2671\212^$x\332\027=E\367\216\013\017\0370@D\362Z\251f\313\1776\260A=[z\275\b\024.@!\237,\331\312Im\216'\377U\232 $p\314\240\236-z\251#\354O\273\273\326\320\276\370[\037\335\325;\376i\n\\g\243\231\214'\302\304](\2503\213\226\311\260\t\332E\203e\034\007\263L\274m0\034\326\3316\016\223\210\373i5\364E\n1~\024\203\003d\252\235a\256\342+*\370%,A\313\177Zu*\265@\021"
+	.string	"\357b\314\304\373\242p\230/ \353Y]\264\352\232EFm\021\241\026"
+	.ascii	".<x\264M\210\327$A\026\334\rPV\300\265\274\020&\031"
+	.text
+	.section	.gnu.lto_valueTableNameIndexCompare.243.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\023\001\235\f"
+	.string	"f\227SC\020q\224\016+\004@\361A\322B%\355\3430\324\340q\n\270\022\020\347C[\220\020h\262"
+	.string	"\203\001\374ot\202\257\275\215f[\320\227\254\252\252\236\200\220\333{\017\367t\255h4\351;\331L\006\331[\312\224\002?"
+	.string	"?"
+	.string	"A"
+	.string	"\n\274\271\036\375]\266}\021\037\301\331)\0218T\336\002\020\031:Lf\354.\246y\306z\2047`=*\207sO\316\177\311!\254DZt^\352\t\340\301\356:;\017\303\255\267\315\261\235\300~\210\377\376"
+	.string	"'\371/\230\2664\0353\raZ5\235\231>F\300\013\031\336EPv/\264\320X\027\221\305\007\333\234\215\261I\314r\200\300n\224t\234\247\375\221\223\340\376\231\345\005vAb\254\330\375\002\023\216B\273\n\003\333\026~\"\364\024\035v7\032\224\270\211\021|\310\243\267\222\365\256\244W\3610rM}G\215\233\220NW\210_\301z\274\"8\361\370Pe\213\375\245R7\330\207\273\273V\020[\323\227\022\376\271\263\216&\3120\222\366\031a\231\351\204u2\336(\200L\030j\333L\030\346\333\333\027\325\250t\345\001\251j\251\235\201\362\335E\035h\340\320\024\212\346YA]Eh\263rb\251\007\006\324(\202\nS<>\034\033"
+	.string	"\357b\310\f\rFt\267pZ\\\262\205\\\260].H\002\304\200\271cdqB\0331\267\266\331Z\373\025"
+	.ascii	"kuR\313\370\210\006\177\201\027\327\230\221\t\020\030\tF\034"
+	.ascii	"T8\270\373\244Z1\t\223\f"
+	.text
+	.section	.gnu.lto_buildValueTableNameIndex.244.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\247\001]\020"
+	.string	"&`oE\340\322&\035R}\332q\024\207\021i\375\346\031\005\303Z\305{\r\026\246\354\301\315\245Y\361\300\343\322\373\226\225Yc\364\306\324\254\341\0354J.\307\030ct^\fG\2308\214\001@e\020\301\031J\005\332{K\231R]"
+	.string	"Y"
+	.string	"Z"
+	.string	"F"
+	.ascii	"\340\260\344#\361\360\235@<<\311*[G\001\327\256\030\344\204x"
+	.ascii	"\2610\332]MG\370\245\352\360i\252|\236\037\210\315h\025\005m"
+	.ascii	"\253\303\027\342\212)!`s=\224\243\331\320\271'\314\326\312wb"
+	.ascii	"\346z\356\nbB?EA\333\3143\244\301\356:a\233\314\035o{\202\355"
+	.ascii	"\004v\226\002\260\035\254\354\034\365z\356\360C,F\253\b(\b+;"
+	.ascii	"U \""
+	.string	"\327\246zcs\253D\3019\232Ym\354\322}\356\250i\370\364\313\264>\235O_\244\205F\214\207\355:>vc: \213\003\016\231\270\317\355\367\370\234I>\212\247P\335\307\344+\263\357 \313\241\231\355r\013\016\003P\317sX\263C\364\202zc\221\032ZR\270\223\206\211\252\352\340\306\206<r\252\352_A|\240\267\240\360.3\013*\242\342a*\t\t\020\254\354\376vw\237\336\334$F-\251\201\032\235\216\203\210Vv\276\332N}\305\005\022\234\335E\361U\374\307\305\227\035:\303K\036v\350\277\004\247\333tr\252`\322ZN\021X4S\312E;\0311\312\302JJ\303\200B\2454\022\267W\033\237{\200Y\016\315K\350\245\276\007=\270\0373\226\266\374\247D\037\306\207R|\231!\250\244J<\324\020\223a\304c@\276\307\264\222y\333\210P\337\363\027/\"9vY\207\271\260\204S\036\346\222\227\256\3744\036"
+	.string	"\357b\004\025-\\ \310\006F\331H*\204\335\346\004\b\0048\353\321\231\265\216V/\305\261\004k\340\034\366\253b\276\031\301-h\001\203\231\0300\203\202\023-}"
+	.ascii	"e\241n\317p\253\274\b\021d\206\333IW\215\027\024\221\3275\237"
+	.text
+	.section	.gnu.lto_cliFindValueByName.245.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`f\005\315$"
+	.string	"JD\364\016Ep\236U\007q V\032\037\341\337\346S2\013\200e\027zeN\262\003\234gR\264\305m|\321\376\021\322!\226\346!\371\302OuI\274\016\305I\343\317M\367\234\032)\223\272\314qj\b\357\373\273\233\2242\311\224\002\340"
+	.string	"\321"
+	.string	"\333"
+	.ascii	"d\236\215\331w\250I\202\315\3119'\371m\b\251\337\003\326\005"
+	.ascii	"`[\273#H\260\362\245\r\017\312\3004,\006\265\272\327\r\007\220"
+	.ascii	"\263V\364K\316\313\007\255 \365\353]\256\264\352\337\357\310"
+	.ascii	"\201C\311\202d\025\035[\366\344\274\364\365\322{\330o\352\002"
+	.ascii	"\260\337_\322\272\372\363\235.\207\273\2456|\355\327_\373\225"
+	.ascii	"\357\034-\313\2103G\325ac\021\317!\300%1\036\375f\221\316\224"
+	.ascii	"\300q\264,\"\266\350\310\231\037\316\2255\244\246\266%(I3t\222"
+	.ascii	"\030\215\270\315\276\026g\031\257\250\303Z\270B\245\211se\t\251"
+	.ascii	"\030-K\210=\360\364J,\n\353u\247sHS\202)\243I\214E\334\376\360"
+	.ascii	"\267\r\346\200\311\223+\006m\017\313\311\320\235^}\024\201\265"
+	.ascii	"\332\226r\316]\207E\2437\317\273\273Nws\350\276\t\002q\242i\200"
+	.ascii	"\177\265+[\322\371Gv\f\354\277\202\351&X\371t\373\027\007\023"
+	.ascii	"\243}\253\243\\T\037\372mw\201\375\372\273\323-\327\321,*\004"
+	.ascii	"G]\353^^\325Gv;\203\256.P\372\265\272\217\214\212<\314\233\310"
+	.ascii	"\275\334\t\370\322}\300\220\217y\367\204\272v\020\020\357V{W"
+	.ascii	"k\353\\\314;\347_\336\270Z\373\226\326Nmm\233\2556\266\265\257"
+	.ascii	"\255mm\265\337\233\336\025\327\366\002Uc\260|\024\275\253,g\254"
+	.ascii	"5?9\315\r\363\304\303\334\305\334\307\334\277\334\233\336\355"
+	.ascii	"`\355\\\274\213?\307f\360\330Jr\311\220\212\375\2022Z\366\"\234"
+	.ascii	"\244\330\234\234\227\027\302\356$\307*\244~\275\333\252}\213"
+	.ascii	";;\327l2\233\3014$\261@\221\240\305\231V\376\325\001\357V\330"
+	.ascii	"\264\300\220n\265\177\300~w\357D\"\272\267j\302)\300\272\346"
+	.ascii	"N\007\317\231\026~d'9\321\177\026h\027\263\215\201\232\376\355"
+	.ascii	"\t|\367\206\016\325\207Do\002\211\260=\270\332\007\237r\\\263"
+	.ascii	"'\347\340\0045 \\yT\333\203\346i?\354\367\366\017\232x\r\370"
+	.ascii	"\364qiJ9i~Hlr\016\372\260\273_8\032\020>&9\007)\23094\204\025"
+	.ascii	"1\002\217\300~\207\376\315\206A\360\333H\270\231\022i\316\231"
+	.ascii	"B;\031/c\242}\313o\237@QQ`\277\370\361\217\243Z4L\365&\303\367"
+	.ascii	"{_\315\204V\200\236\367\367\375\351!\230\312\262O{\243%\354*"
+	.ascii	"\271}\241\3671\341\021`]\353\177\373\256\343\217\223\271\230"
+	.ascii	"\024\326\267Z\005\023fz'rTS\305\362j\267\323S\365a;X,\242\246"
+	.ascii	"\336i\206\024\023\215\373b\252\351kTI=\324S\024\224\205\222\361"
+	.ascii	"D\345$\205\235\246\230\250l7)EI5\371\250\242\230\246|M0b\370"
+	.ascii	"\224z]\365\302\t\206OFU\025\f_n\231\375\265\332\235\236\302I"
+	.ascii	"\276qz\321\371\231\373\323\335H3\352e\313}P\320\367\022\216\007"
+	.ascii	"r\355\036\331Q\241\025\372\2669\334\003=\321\235\356=\232z\376"
+	.ascii	"\330$o\233\253\317k\244+\350\022\246\231\273\3159g\235\305\001"
+	.ascii	"}O\330\007z;z\334\023\375\351\001pF\337\366\306\373\3529\007"
+	.ascii	"\336{\243\307)\271\262V\201<\317\204\270\336\037=\216yE\216/"
+	.ascii	"\361\204\341r{d\367\232Q\350%z\241f\364\017V\362\242'\026\375"
+	.ascii	"\215\002\265\303<\023\254|\304|I\371\222>\262\0134\243^x\350"
+	.ascii	"sO\354%>\370\330\036\331\216\001\357\002_\250Q0\244\020B\b\021"
+	.ascii	"\"$22#\322pP\0021\346\240\325\001\020`X\242\244\320\030O\203"
+	.ascii	".\254\016y\332\265\225\224f\026\t \332 \007f\372\232l\247\345"
+	.ascii	"\210\3548\2200\025hZ]\035\264]\247\200q4$Mv\331\022\300n0\206"
+	.ascii	"@\n\230\244\361\023\276\270\211\354\263kjh\264 \243\2717B\006"
+	.ascii	"R\211\001s\305.\333z\006\200@\024#\031\035k\374\030x\340\360"
+	.ascii	"\362\337\224\243(\222\331\026E\345\2311D\215\3013\204\270\253"
+	.ascii	"n}\3323\330\033I\245j\215\220\331Y%@\256\261R\2154\020%\327/"
+	.ascii	"j|%\301\211\3760&0\025\237\r\327O$ z\263\213@\024\374i\026.\363"
+	.ascii	"\301\306'\215\236K7\0319\036\343|{}\013\017e\357\251dD\210?\372"
+	.ascii	"\024K\325"
+	.text
+	.section	.gnu.lto_cliPrintVarRange.246.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`P\nm5"
+	.string	"\312[@\024A@\344Q:K\246j\264\377\276KT\213k\371R\373\030\343\377\3372\324\nk\220?\027\255?\250\237\3667\333\2762e\357\200\035"
+	.ascii	"\267g\323\247\377\377k\225\017\2644gP\251\032\354[\311'\204\354"
+	.ascii	"\235d0\001 \0015\001\2153\356+\b\020\210\353\217[\032\242,\350"
+	.ascii	"\371\202M!\275tk\234._\363\267\245\351C\335\256\306\375\032+"
+	.ascii	"b\327\363\r\013\376\201\313\203\320~%\252wb\377\354\243\351\340"
+	.ascii	"\327~ \301}\033\021\242\361\371\202\371\320\340\244ky\357\373"
+	.ascii	"T\360\265\255\332\257\017v\367q\367\327~\306\275\263\310\207"
+	.ascii	"\357K%:\367\276O\006m\240\375\332\317?\261_\333;\261_\333\355"
+	.ascii	"\276\223:\276\306\biwI5y\357\373^e+\235\204\335\017\231\226\224"
+	.ascii	"\222\204A\340\257\365\261\253\232\261\333\247\212\023\344\025"
+	.ascii	"f\374\220\r\223siEk3\267\246\247\244\372\216`\\^\247\\\252\025"
+	.ascii	"\034I\343\034z\002`\224OpR\025\261(\027\236\211\225=H\340L\214"
+	.ascii	"\354@5\201\024\016\243\203Q\222\251O`\\\274^\247\204\202\177"
+	.ascii	"\252\323X\\\240\327)\313\324\005`\224c\270\205>\004\032\\^\224"
+	.ascii	"\373\300X\013__\326\263]\004\032\233tM\357L\354\312\325\256#"
+	.ascii	"\373\204\205N\026`\0302\347\246\224$0\214\213\025\006\n\003\345"
+	.ascii	"g\312++\366qx\337\267\261W\230\330\273\351\335W\321\335\315\356"
+	.ascii	"\037\211S\321\367E\336\213E\213\224P\325\302\005\276Wc0;fcw\277"
+	.ascii	"8 \030\033\242\035\343vX_)Dq\376\036\331\236\232s\213\356\304"
+	.ascii	"\246\272=\246\352\247_\247>\352\323w\001\334\236\340O\261{\372"
+	.ascii	"si\323<\335\0048\274vjI\244\257\031\025\207#\336k\037\325\337"
+	.ascii	"\234\235*\363\244F\034\251B\323\321]\316\314;\37586:\375:\317"
+	.ascii	"cnsg\215L\234\276\034\242\032\231\227\327L\256?\327w\355\373"
+	.ascii	"\032\277\354O\231\275iz^\336\367E\340\246\273\357\376e\333|\225"
+	.ascii	"\357\363E\360\265@>\333\025\230!\361^7\335\247\330\347\002\271"
+	.ascii	"q\362\tW\3178\233\254\366}\273&\364\341<\330h\265|\355\027a\277"
+	.ascii	">\257\306>t\3133\316-<\355~\032qf\216\305\005Zv\246\322]\225"
+	.ascii	"qSe\334\005\356\374\005|\315[*\352mo(\026\367S\306\r@\305\355"
+	.ascii	"\224q7\005q\017\203\270\231~\270\227\200\270\225\200\270\223"
+	.ascii	"~\270\205-\356 \213\033\350\303\375cq\267>\334>\0267\273\342"
+	.ascii	"^Y\334\352\212;\2538\3017,\346.\031\300\244E\002\301Q<:=h\212"
+	.ascii	"\232E\300\314\354\023a\243\362\332\006\310\nvBb\024\375ef\273"
+	.ascii	"NX\246\374\2634\204\272\260\243n\254D\206\353\244\355\273d\354"
+	.ascii	"W\246\374/(JY\230\227\362\221b\332w\0366)+\345#\301H\345\244"
+	.ascii	"\254\356\031\303^.\231o\255o`$n\224%8v\322\345\332\373vU\370"
+	.ascii	"\3328\211\217\270R\324v\247\270h\354\275\\&\373U\230\017}\325"
+	.ascii	"\027@f\031j\347\250l\027\340\247\301G\367\312S\323\315\322\""
+	.ascii	"iT\271[\334.\177\3033C\327\225\215_\360\226\033\346s\232c\260"
+	.ascii	"\321M{\\\024\277n\301|4\0171W\366F\r\316\255\360\322\350|m\006"
+	.ascii	"\356\3752P\355\217\3343\207:\352\240\367\313\207\372r\353\232"
+	.ascii	"y#\367\314\373\270lg\324\341z\026\315\361ev\257l\r\236\377\r"
+	.ascii	"o\214U3\233\350\003\210\026i\202\210\314\306^3+\342\322\022\227"
+	.ascii	"C\224\342nw\031\232k\276\334 g\316j\376\241\344\336\326\210\033"
+	.ascii	"*qD'^(\305\355\232\204\256\247\231\263\317Y\346\246\247\347\177"
+	.ascii	"C4\245[;\n\343\374\347\243+\002\215\"\005qA\210\020)\244.\334"
+	.ascii	"\360aCG\226\026Q\bV\261\330a\330=\016\344&.\310M\274\320#\353"
+	.ascii	"\207\026\026\220a\323\240q \252\177\034 2 : ^\310\262\241\003"
+	.ascii	"\253H\244\221\025d\207\226V\007(\034\027R\364\241\003\204\217"
+	.ascii	"\036E\0345\200E, \271g4\300\2415\343J\007\016\254\034W3\212="
+	.ascii	"\256\032<\365\016\036Y\305+\037;v\024\257\202\317\367\231J\267"
+	.ascii	"\211\306\350\2662W?\356\307\221\260\f\377\304M#\323\250\250\261"
+	.ascii	"E^\231(\354vn\2057ez\312\177b\246{%*j\004@~\312w\303\205\317"
+	.ascii	"\2624\034\361\0247I\001\233]\001\310\317+\343\243\346\374\234"
+	.ascii	"\237\355o\3425Z\302\200\273\335/W\t\232?\t\324\311\253'\345\312"
+	.ascii	"F\251Rf\366R\031a\325oMMJR\316\327_\255\n\241\362\321\274U\244"
+	.ascii	"\266L\312\371\376%\225\2352>K\303\247);\345\203a\262\254`\233"
+	.ascii	"\035$(cM\371d\312\344\364\256\276\357\373&ef\037\372/\223L\370"
+	.ascii	"\0041\330[m\2432T\376\352\376\255X\251\\\225\005\374\201\233"
+	.ascii	"\"\227\\x\212\205\303\3747\334\304]2\025\035\022v\314\306a\006"
+	.ascii	"\242\261\021\024\200\301\250a,\245\030r\206\241\021\tD$i\222"
+	.ascii	"\016\240\002\221\031\252\363\021\3200\350\234\242\021\222$\311"
+	.ascii	"\260\033\260\360\263\311\304v\006S;\376\177>d\030\3331i\017\347"
+	.ascii	"C.R\030&+\003\214c\222}\320\263\245\302\216(\260\333)\235\302"
+	.ascii	"}Tm\324\351\350`S\200\205^\364v\245\202t\\\202\026\016\2074\301"
+	.ascii	"\004\237\300\363\245\367\234@\027\3062b1F\322\036\322\321\030"
+	.ascii	"\026\007N\304o\323X\374Rc\340\001\r\303\350\264!+\276e\274\334"
+	.ascii	"]B dN\005\316\b5\363c\260\035\371\260\273\367\002a<\377g\232"
+	.ascii	"V\235X\235\231\341\020\345\374d\252\233RRH(\271\322i%\205\230"
+	.ascii	"\325CW#;Ce9\212\255\361\r\na\353:\217\240\022\302\230\255\316"
+	.ascii	"\205L\353\221\206|\224\307\335\026nI\223\272u\204L\004\256\247"
+	.ascii	"Z\340\336\273l\\\006z\302\003{\350\0077~G\f\205\342\006\315\026"
+	.ascii	"\261\2733\022\365\273\307\020f\nC\t\271>\317\024]\224y\254\362"
+	.ascii	"\233\202*^T\214sD\037\221i\2651lMZ6\"\002{m\035\357~\227\"s\037"
+	.ascii	"P\267\356\200\337\"\3001+:=\022)\002\334\217\233\361=\242\222"
+	.ascii	"~V\036\016\f\033m\352\306\205~)nN\305\332n\225\017\346g\365\244"
+	.ascii	"\031\266l \f0/A\300x|\266(\0216\355\313,`\332\274\377\300\035"
+	.ascii	"^\016h\236X\035/\222\001D|\274}}\361\257\276\232\320M@\2064\365"
+	.ascii	"~\320\322\372\241[\002&\314\304h\f3;5\3545\177"
+	.text
+	.section	.gnu.lto_cliSetVar.247.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\204\nu0"
+	.string	"\232Q\344\021E`\234N\007v\222J)\027\365\343\344\340\344\001yb\037\006dt\017\361\224\231\335\261"
+	.string	"\365O\023\221\345\245=J\332\303M\346\374\200\330\341\203\372\232XL\2256j\376\244\220\34300H\0043D\204\354-wJ)\005\022\001\355"
+	.ascii	"\f\001\314N.s\274v\267\265\362\232sf&8i\221^'\205f\026\263\007"
+	.ascii	"m-\372r\335\226\361\327\2443s\357\032\203\266\\\304\354k\315"
+	.ascii	"D\331M\\\260\360\336\261@)\367\266\021q\202`\333\240\264\235"
+	.ascii	"\271\223\264\022e\253\301h\344\275<\262H\271w\215\210\017\004"
+	.ascii	"\333\362Z'\325\266\301\326Q\333\262\222Y\317\347\352N!5\243,"
+	.ascii	"\335\376\356\275F\337\243\225\315\223\334\321\311A\036\215E\234"
+	.ascii	"\033\342P\030\\U\233\276+\271\rl\271\303\332\232j\036\270\244"
+	.ascii	"\222\235\246\016\223\220\034\037H!A\200\374\3501-\037\352P\356"
+	.ascii	"\207\234z\3642\026\305\032'\f\314o\3224\031g\304\265i\2706q\345"
+	.ascii	"h\241\235\226W\032TD\013\207\007\327\246`\232\246\336\2311\256"
+	.ascii	"!\275\336hum\272\321\266\270\025#\r\272\367^y\372\325cZ]\303"
+	.ascii	"-+\365X`LkH\372\351\202\260-5\332N\253,M\3261\363\032\256=k\253"
+	.ascii	"\312}m\272\367\262cmq5\3674s\367`\346&f\341V\274.\365\020\254"
+	.ascii	"\260\347?\031w\224Vz;61V\276\206\371\331?j\277\322\263/\273\252"
+	.ascii	"<\312\314N\r\345)x\257U\022\367\023%\022\250`\220\266\3340\324"
+	.ascii	"\266\375K_zM5*\217\362\215\033xf\021#\274\261\020\274;\371\316"
+	.ascii	"\236V?\305\2746\345O\306\334\351}\036\314\326Y\202ufJ\235\227"
+	.ascii	"R\347\b\251\263R\022\004$\007\r\216\212\210\272\255y\250\233"
+	.ascii	"t\013\265\263\031A\253u\033\b\"\320N\232\201\204\316?\253\363"
+	.ascii	"\200\240\263\200\3249\200\352\f@u\366Q\235{\2543\217uN\246\316"
+	.ascii	";\253\263\216\352\234\243:#W\347\243\352l\\\235\213\326\031\307"
+	.ascii	":\337\244\316\304\324"
+	.string	"y\250:\013U\347`\352\274\252\316j\352l\255sj\235?u\366\324\271'\024\371fl\365\223\350\2754\242m\356\323R!\322m\335N\272\235\375\314\335n\375\326pL\344O\340u\336\310\026\027%\346<\362\033\034}\316\253nK\257\343#\217{\303\2437\276\203\342\033\305(\3214lP\333\026\337\310\214\023>\231\227&\303\364G\037\305y\246\233\037j\034\342\337\204\001Cl\003\250&\327\355\344;\023|2^\301\216\250\020\376\347\r,\314&=\320g1\017\277\210\207\205\006\350\207{\253\360\203\017\341\237\013\322\013\337\006.\327\017\256^T\244W?\351\237\313\262\206}\265\353\224h\035\202\334\036\324\266\366\215\314(qY^T\036M\3261\363,\267\013U\350\355\324\035\223m\214\204G\372\206\353\034\271%4\332,\247\246/\341\177\250\323\367\300\030m\374\377{\t\245\372\320\\\236\204\360\030Do\t\321\026\b\317\277\275\276\366"
+	.ascii	"\233J\243H\362\234\362@\006M\336\346\322,\334ti\032\326\025n"
+	.ascii	",\376gvuT\341\266\302z\301{\247:\214m\263\213\331\275WAO\341"
+	.ascii	"\260n\0357-\314\354\256]\005m\227\220N\276\264\347\225C\003R"
+	.ascii	")N<\224\n\022N\034FHE\261\020\216@\341T\"\205RA\302i\205\225"
+	.ascii	"rZ\361\374T$\202\304\223\221\t\021N%\214\236\244P\030\025%9\352"
+	.ascii	"\004\224\224Q\212\250()#\342\332\355\347\301A?\034O\252\257\342"
+	.ascii	"\226\322\375\321h\324\217G\350K\363\013\032M\376<\373\225\022"
+	.ascii	"\255\202\005\265\355\317\033\231Z\356\330\370\355\f\030\360F"
+	.ascii	"6-o\200^t\004<;\225\022\355B\021\017\203\332V\300\033\253\350"
+	.ascii	"\356\226\320>"
+	.string	",9\001\204>\300\033\231toKh\232^\241\246T\266F\017\031\345\246[\322\206;\360\323\326pc!\342\307\375\327i@\324\244\211E\350S\362\\:\224;\256\373#\370\0245u;\216g}E\242\377y;\353\202S\364AA_\304{\001\366\004\260\313\b\340}\236h\350\001\370D\213C\337\363Ef\224h-2\250m{\336\310\234\333\303\3113\302\363C\357rKh\362\207\232\347]\315\316'\365\236\204\312\312\224\355|w\201\271\315u;\373l\334\210]\0316\370\237715\241\203'\360Y\314:\001\200\334\250aH\345\230BR3\222\024$\205Jc\320\002\031\241Z7\021\3408\250\234\"\221!)H\032\003O\241\311\365\270\213\025MpH\371p\216D\347H\3145P\240\273\336\bc\201N\030\234Y\240A\275)\354\3051\023[e\033\244c\350\b\361\317\211\2203\207/\n\321\333H\017WG\013ga;\347?"
+	.string	"\250\336\r\264pp\n\354'L\003W\002\231\224\341\233T;8\351\334\276\361&\250\003\2641\327\007j\350\211\357\265\023\243c\350\351E\227\306\002\f\344\263^\230\320\230|(\377\3672\367\023\263\267\366\3307\262_T[\330\322\365[\177N\257\005~\204\bD\365\177\324zcc*\226\247\230\023\207SwE(\367(3\305\267V!\n\2675X\n>]\320\275E\322\3106\t]\027\257xp\212:.\320Z9\241\217\204\f|V9\321\235wV\220\331\b\361\226\334\334\211\305\342\345\331\303\353\"\337\211\\\347Xxc@l\034\331\261\366\310\214\326\004\r\242f\357\354\037>;H\343-\007z \t\022\207=\207\232\367\253\r\265d\200\337\255\266\373_\200\273\367\252SU\221\006:\357\245\355\302\300\301Z\006r\305D\234\022\323\205'\312C/w\340"
+	.ascii	"\271\224\t\354\f\214\264\343\017\020\355\030;\236\004E}'\204"
+	.ascii	"(\2732a\354\016:n\270\262/\3638\247f\001b\235\307?\032P\277!"
+	.ascii	"\016\017\007\031K\261\261H&\212\331\022\326['\035\b{Ga\2474g"
+	.ascii	"\002\250\006"
+	.text
+	.section	.gnu.lto_cliPrompt.248.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375 \352\215\006"
+	.string	"\002\f.5@o\222\016P\016:P\274BH\366\211{\356\336Rr\320\360\334HLa\215X\033\245\245VP\b\363\030\246(\212k\364\005\315\273Z\237\016\241=X\251\375Md\n#t\004\006\246)\317'\202z\023\237\007\211GY\025\317cpE\001a=\213\252\262\036\207\224E\321\233\322\312\266\201\034O\256%5\271(\030\311\0045\303\330\200\022\024:}\206\206k\366BIe\353@\354I\230\303\220\257&3s\024=\022\304\270heA\311\004\231\221\311mJ!\371\313\371\372\227\003\217\304\032F-\037'0\231\371P\244W\335u;j@\246au"
+	.string	"\016\231\271\313\264P\307\376\235\237\341\017\005\b"
+	.ascii	"\357b\310\204\026\340q\201\013\333.\203\274\f\001.\335\242\235"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_cliShowParseError.249.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375 \361\365\006"
+	.string	"4\f\222"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\355\2734\201\200\205\030\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\367\336\001\221\214\376\016\003"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\201\003\204\340\337\367("
+	.string	"\212\001\002}{"
+	.string	""
+	.string	"\005\001'$\206\by\212\001\206\200\200\250\034w\276\001\274\001\002\005"
+	.string	"\203\003\202\340\361\367\b"
+	.string	"\244\003\001\200\300\013/root/repo"
+	.string	"\025./src/main/cli.c"
+	.string	"\fPARSE ERROR"
+	.string	"\t"
+	.ascii	"\357b\310\204\026\340q\201\013\3335\321-\004\3742\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_cliShowArgumentRangeError.250.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\305\n"
+	.string	"fTLB \307*\035"
+	.string	"w\367\324\310\300,\270(\264\022\270\354\365S\360\254\304\347G\r"
+	.string	"\b\006\001\t?\225\021\364\322/u\2630\024\330\201(\\\n9\334\202(13)\271QH\200\202]\254\246l\210\220\275S\n6"
+	.string	":"
+	.string	"6"
+	.string	" ;\200\377|\276\223\371\007^!\363\317\244}`\301d\313\211\230\005\257Z\202\335\025k\313\311S\322\177\355\033\023V\236j(v\327\324\204\245\334\365\266\033lc\330\367\004\273\027\330q\270]\224]\203\315}\005`l\237c\323|\363\020\266d\345\004D\317\013 ?\363\315\233]\025\004\266\335\0059\002\374\027z\247\366\001<"
+	.string	"y\231\310\023vc\006l\273g\225\304\032\352\325Zi\375\200\023h1\270\354\272nz\200.\211\207\177\366G\b\275i\b\235\202\334\253\226\366Y\322\312b\337\333\335u\215\331\247\375\336g\177\275\354\247\231\203>}\302\213QEx\372\204#\221H\203$\262\bI\031\243\260\365\361\200\224\306\252J\215\0255\226T\236M\241\324\206IT\245J\243hb\265\304P\307+\016\024K\354X\255X\"\347\334\327\230A\035\203\334H\016"
+	.ascii	"\357b\310\204v\340q\207\013\273\\c\007\314p\300\310\240#J\210"
+	.ascii	"\033\210\001\256HSS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_nextArg.251.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`Y\001\275\016"
+	.string	"F[bD"
+	.string	"\221(\035x3\022\032~\370\352\356\301\004\227\357\013\035\342\204!l\3439D&\253\310F\220\0178w\036\024\2765\364\215s\213\030\321\005\204\223\252\252*\321\250 \235\021\324\"\177\347$\375=\200?!{K\231RK"
+	.string	"M"
+	.string	"O"
+	.ascii	"\007\311\0367\037\220=\252\210.\341w\303\354\236E\250\331\371"
+	.ascii	"\332\350\225\243\344\205\236q\274QF\2500+\326\207\207\002\031"
+	.ascii	"\274\244\030q\325\323\344\221\022\236P\271^\365\007\256\027\253"
+	.ascii	"\344\251<\265\006\273\353"
+	.string	",y\034n\355\266E\266\025\330\367\020?\374wg\246\277\001\020\302\206\367\327jwCl\307\266\342\013\023\377~\373\304W\231c\373\353\002l\315\336;\275h\270\261\373\031x\364\226Ou\027\260{\242q\261\373\035p\201\315\343]\256\342\304\235f \211X\020\270\304Rdt\354~\233\277\037)3)\315\224\300j\006DFM5\271\313Rc\bGK\f\r\f\t\203\273\2730\301S3\325F/\031((F\031S\026+'\032u\314\220\033F\006\325\256`!_\212\232:`\035Z$\r\331_(\025e\177AM\f\022\326\223\255e\361\251\034\310D#p\016@%#\034G\241\343\341\216\b\211\204\316VB\002a\302\326\341>\233\b\210=&#\334\006\362x\270\215\363\355\365\244\206\360+\256i\372\026l\245%\322QK\246(\207\374\223]\317\0223\3432\027>\233\022W\017\327\213e\372 \312\330]5`ZDE9\036"
+	.ascii	"\357bd\025M\3519\231Y$\243\365\231y\002\3133!\032\355\306\227"
+	.ascii	"\212\033\355\246} \205PW\233j8S+o\221\nBP\342\276\025\017o\302"
+	.ascii	"q\024a\241\362\3753C\235\262\204#V*C\021Zy\315\203\201\242l\272"
+	.ascii	"\346\023"
+	.text
+	.section	.gnu.lto_processChannelRangeArgs.252.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\001\004\215\034"
+	.string	"\2064\271K\260\224U:\370\277a\300\263E\244\334\241M<\037\277\302\344M\230N\303\235 \346\2355'\340\306\255\236J\202\001\266\366\341\3364\030\177\374\237f\233.\355?\326\356\345\202sg}3\0366 \225\0267\f\307'\374F\b\331[\356$\003\245"
+	.string	"\231"
+	.string	"\246"
+	.ascii	"\364\304\334]\367\006!\203\334[l\300\b\316\333\3578\217\034\316"
+	.ascii	"\365\t\035\035\220\203\241\217\211\037\310{\2132.>V\336\236\207"
+	.ascii	"\225\267\r\203\351k\361\254\242\271\257T\247Y\332\3324\3077~"
+	.ascii	"\302\256I\022\337\257\304W5&\303F\215+Q\361S\0254%-\375x\272"
+	.ascii	"\363\333Q\325\013\240\317O `\317M\026/W?\026\2675ARJ\b\200_\257"
+	.ascii	"\n\320\341\231\301\372\351\320Za>HL\216\364\003JT\364T\006Ln"
+	.ascii	"\374\260~<\332?\376\302\260E\024 \240\317\251\t\341\336\313\324"
+	.ascii	"\367\003\236Yg\346!f\256a\356\243-d.\356\350e0\2558\301\035\304"
+	.ascii	"\f\363\241?\300\213?\354\365\243\263\253UR~9\361wi\271\321\371"
+	.ascii	"<\361l\232\224K\223\2625)W\223r\227\224iI\371\003^h\244\370\035"
+	.ascii	"\212\310\275<SX\256\223\025B\343G\277\321)\363\371?\256\024\342"
+	.ascii	"I\234!\270\204\274\367\262\200\360\221\216\270)h\030\224\272"
+	.ascii	"\367V8\357\203\177d\242\027\345\334\b\347\027x\217Bh\330B\352"
+	.ascii	"\336\342\202[\216p\336\032\250\207\225!\230Y\267g\316af1s\017"
+	.ascii	"\215\030\306\320\"\t\230\326\345\031]$\b\265\2317\374Hm\330."
+	.ascii	"\352\251\247\212\r(e\013\233\231\303\215\314\316{\357\003~\021"
+	.ascii	"\f2\005b\b\335\362I\224\267\367Iyu7\314\030E\304D\026\035\235"
+	.ascii	"\342!:$%\213S\236m{P\201a\204\032\360~5M\352\351\020\201\345"
+	.ascii	"\245o\211\301%\343\023Q\320\344\321~i\246\275*-\034\347\246\322"
+	.ascii	"\325\264\257\364\252C\by\343\211h\312\216N\261\013m53\215\r\275"
+	.ascii	"\317\325G\372\013\231\034\376\trjX[\310\271\262\325\335c\212"
+	.ascii	"\025c\024\217&yE\315f\246\331\350}\255\376\361"
+	.string	".d2\207\023\257K\320&!'W:\\\023\363\241\0067\243\311j6\032\315F\340f\006\242E\314t\250Q\240\271\315N\\\r\307&\001W\233\241\341\320\334\"t\260\271\231\201x\315\320\324f7{\303yh\226\211\261\271\221\221\325lf4\231\314\355\203,&\3066\01737\031\316f\273\311XE\335\253\312\354\226\226\276\361.\247\244\025']\357V-d\227\344\t\323\261\"&\"\375\220\237\275\363\343\317S\304\244t\266\232+ui\263wh\324\353\275\367\252Z\b\243a\tT\222\036M\236e\307b\334'\345\237\225\266\313\256TzA>\022\013\263\223?\242\274\265\2752FY\331\371\321\321)3M\250A0\210\214BH\021\022\232h&H\352bp\002\241:b\007\020X\311\244I\2265\036\306\352\313\256\253\330,\"zb\026\234BFy{ \207uhq\260\343\256\037\277h}\2443\241\305\224\266Y+\325P\350"
+	.string	"V{W\026\316a\255@2\246\"\023\256a(B\346\266\364\005\007\240z%\277\253\325!\373)@\252\325\255\334Q\373\217\206`\036\344Cs;\017\020d\r\037\211\236B\\\335\232\261:\b\204\340f\206\2100\020I\336\354\314v\260T\246\201\221\002\257\361\333\225\235\202\374"
+	.ascii	"\250h}\362\345\214\226K/[\321\233:\365\003"
+	.text
+	.section	.gnu.lto_isEmpty.253.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"U\013"
+	.string	"\266\025O?\020Q\225\016\033\002\234v"
+	.string	"q\026"
+	.string	"\375@U\306\203\020[\2035XUPR\361W\017\253\323\241\242\255\272\237\322\237\261&\331\200\005"
+	.string	""
+	.string	""
+	.string	"\tP\036\034\320"
+	.string	"\245\345Gh@\312\304\357\275\245L)="
+	.string	">"
+	.string	"="
+	.string	"\207O3\344\237u\250\202C\213\020/Jh\242\303k\303\237D3\275\312\356F\264R\352\263t+\016\211Fz\023UHw\326\023\245\2252\0014\330]\347\005-\303\035o\373\201\355\003\366\007\004\233j\331\330\0250\305\007\333 ;b;\323>\210{\200\376\361y\200\335\215\304\211].\201\r\\\207\346N\211\207\327'\361\320\266\0270"
+	.string	"9$\300$\222\241\300\203u\022Ac\227\303\264\303C\001O7O\274\022"
+	.string	"\231\301\342 \026<\227\207k\001\222\013\023\034\243lev+\025\n\365'\252:\200Q\312\0326'J\355\260\377vw\255\233\341?~}\351\324\364\343GC\n\203\366\030#6\0224\231\254\303\211\306\\2\0230\230&\003\201\002\206\3118\330\205\342M\205\b\031\326\331l2,\302\355us*\202\347\263<\025e\033je\244$\247B\375\351\306([\021j\207\377\f\351V\252\020"
+	.ascii	"\3571\226\020\032\241\0162\fEe\225\271\325\321I\023\tD\001\215"
+	.ascii	"\313\t\341s\031U\252\361\023\313\302D\302UU\r\351]\005\n"
+	.text
+	.section	.gnu.lto_printRxFailsafe.254.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\367\006e&"
+	.string	"\252E\034\017Bp\236J:iY;\351\222\340\003k\342?\024gn<\025\235\370d\250W\374\004\177\314\331\261\360\177\f&:\3143x\304Y\260\201U\027\025\224rYPH>\271L[7j\3548\243`\t\331\204\310\235R\337"
+	.string	"\310"
+	.string	"\335"
+	.ascii	"g\305\323\354h\r\317\r\213\237\033\022(x\375m\306x\236\235\373"
+	.ascii	"\006o\016K\025,\363\\|7\377N\332n\253\361\323\354<\017'jrx\316"
+	.ascii	"\263\370\340\244\253\314\223\364goa;\"E\213\317\342u-]@\242S"
+	.ascii	"l\315\t\224y\322E\363\324>\226\253y\235\210\303A\347\251\304"
+	.ascii	"\314\334y\026\241\314d\236\\\272Q=9\236@=i/;\017\250\343\374"
+	.ascii	"\232\240\0067\306\346\347<\317\250m\342\242\217\305\273\244^"
+	.ascii	"7\313J\216K\275|\266/8\302%\314\356\255\354\353\346\270O\366"
+	.ascii	"\370\270\233 g\343\0050>\370\334-\214\226R\210\274\0169\t\240"
+	.ascii	"l\310\307\321\3010\215\220\2412\035\243Q\033\264\273\313\235"
+	.ascii	"\366(\023\243{\267;\030\332\255\331\275\225\0219-1\234\347iJ"
+	.ascii	"Vfv\007\335\366\022\333_\354j#\244\030\341\024z\243\251_\272"
+	.ascii	"\027\246\205\321@V\332\357\345.\2457\274\013\263k\353\003\243"
+	.ascii	"\2016\316\016\273$\273L\354\342\027M\332;[\343]bC\235\3707\370"
+	.ascii	"\333\375t\270\333\351[\376\246\307\335L\327\3623x\333\255T\251"
+	.ascii	"\025\230\324\t*5\202\222\372@\245N\252\324H&5\260R\033(\251\217"
+	.ascii	"*\265\221I]\240R\023(\251\213*\365\200JMT\251\005\224\324C\225"
+	.ascii	"Z\250R\0070\251\177\225\032@I\035T\251\315J]V\352ZR\223%\365"
+	.ascii	"X\251\227\244\246$\365#\3448\003\362\243\354ww\316\023H @g\035"
+	.ascii	"I\007\345o?\334\037\367\267}\264?\367.\276\227\177\271\234\177"
+	.ascii	"q]\030\302vlP+\023\245\210\r\3275\236\001'\332\001[\242\345\261"
+	.ascii	"\371\231\013X\242\241\025 \207\312\320>\314p\317\n\021H\315\r"
+	.ascii	"\260J\353\303\001q!\303<?\347)<\231\bSx(O'\205\266\301\332#H"
+	.ascii	"\320\223y<\213\354\227\237V\350\267\001\334\342mLX\360\331\274"
+	.ascii	"\356\304h\024)\352\311R\324\223\277\205@\207.h\001\250\t\332"
+	.ascii	"jd\310\307\n\021,\257\\sK4\274=\341\020\351\026S\353\226\273"
+	.ascii	"j\204i\344\326\375X\237\035\274\2314r?wR\317\220\017\037\361"
+	.ascii	"K\364\316\366\214\313\204\236\252\216\273Y\364\366\254\321\021"
+	.ascii	"\243\177lO}\f\225y\236b\025|1^TV\230NN\372]+\224G\357n\250F|"
+	.ascii	"\360\335\247\245j\306\350~\364twZ\246\265]\274\240'\333u\032"
+	.ascii	"C\203\204\017\217p\277L\267i\235v\361\274,\203e\332\026\262\212"
+	.ascii	"\246\245\251\246%\256\246\245+\253`\025\r-\242)#\004\032\266"
+	.ascii	"\256\202\\1\250\204\246\312\0202\256\270\202UT*\224\266VXUae"
+	.ascii	"e\270\242\302\302\n\262\310@U\025\334\272\262\nJ\321\320\002"
+	.ascii	"\272\330\nz\200\361\202K\205\351\251\bVWSQXV\301\027QSZ[Q\021"
+	.ascii	"\214\234\005\203J+JFV\226V\324\257"
+	.string	"x\326\235\355f[\236\"\037\036\260\r\2533\227\211\205\316T\250%\257P\367\260\355\"\352f\255\216\030\375\363\361<\317\263\374kT\245\205\332\273\235<\303e\030F\003\321\252\300C\202U\260'\365?|\t\016,\202\275\003\373\276#[\220\372p\270\220!\240\016\246\360\305\247\223IgI\300E\332\022\355\016\231\017\327\223\007x\264\006\356\244\035\355\301\\\312\310\260\317\n\221\026\315\342\236\220\006\322\001k\344\241\300\032\225\270\235:\005\212\226\300\234\242}\337P\217\217\b\206&|\250q0\005\tqD\251\031\031\t\222\3024\215\001\240\002\031\2622\035\0210\255S\216\325L+\325jHHr\337\305f\377\3073\233C\210\005\224Pb\017\330\377\307@vM\215`\f\373r\210\214\355\026H_H0\0235\251\343\345\027h\f\037\321(\\\376\242N\275E\311\314f\241\221\346Cr\367\200\013o\354\244\\4HS\027\316\243\332<\202"
+	.ascii	"*S\n\026\206G!\355\237\rV\033\227\256\307\316z\"\231\266\243"
+	.ascii	"\361\373(h\375\355\314\252\"\342\350_\037c\3524\340\350\263X"
+	.ascii	"\374(\365\331}\356C\340\200\321\240\203m\036\361(\202\030\034"
+	.ascii	"zC0\037tN\310\221\326$\025\244Z\233^9\020\205\030\232\225\002"
+	.ascii	"\236\217\265\361g\\S\rUEj|\252\207R\323\3314$\207\207\255Y\255"
+	.ascii	"t\020\340\334lj\t\277h\253\264-P\261O\303J\n\260\377\003)\277"
+	.ascii	"\0308=\342x\316\035\251\242`\236G2_\262\240\002"
+	.text
+	.section	.gnu.lto_cliRxFailsafe.255.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`8\f\315C"
+	.ascii	"\332v\\\032@@\244N\007W/Z@\370\373\023h\253\354\213[\002\305"
+	.ascii	"\211\321\214\023\301\244\232\346\225\205\030q\350PjI>\266Z\231"
+	.ascii	"=\341-}F\377\317\331\b\221\031\313\330\230f\206\031\266\227F"
+	.ascii	"B\366\336I\246\024\226\001n\001\225\001\307</\317f\331\241}\246"
+	.ascii	"p*\322\270\232\327\361f@\215QsY\022[!u\216\320D\321Y\250\325"
+	.ascii	"\223\33234\302\232L\267x(:[\246\006\024\223\232\205\030\355z"
+	.ascii	"P\347$\270\230\3661}\274\263q\224\377\262\227Y\231\272A(:\373"
+	.ascii	"N\347v}\354\005\r^\257\013\2731hz\026\23035A\321\301\274\036"
+	.ascii	"&\207gg.\346\231\242\005\346\034\245r\266\253\212\3166\275\343"
+	.ascii	"n\237s/\257\177\321\341\311\234\233\220\301\313\231j\325\006"
+	.ascii	"\212\3166\325\225\255\263EOj\235\355\267\033\260\211Gf2\230\006"
+	.ascii	"y\332\021\346\234\227\377\244\221|\245z\257\370u\246%\245R\022"
+	.ascii	"R\362\310\250\b\351\036\215DEb\313\256\337\204\337\3662\2463"
+	.ascii	"-\331\301\271R)\211ha\315l\212#\375E\243\254PzPpr\300\232\231"
+	.ascii	"\233\037\025\032\255\020\320d5\376\027m[\211r\3258\227\213\252"
+	.ascii	"\341\2425\2636G\332\231\316q\377\242J\372\222\340c\232\\\024"
+	.ascii	"\t6\022-X\231\246\001\264f\366\346D\353\2022ei\374/zdE^\001\224"
+	.ascii	"s"
+	.string	"\271(\032.\256-\333\232'\376\027E[#\364\275\361\371\336\031&\256Ihg\356\370_\324m\255\272S\345\210\353=q\273*\205\274A\375/*e\235\n\\C\310\30781\273\376\233\240\037\376\027\235\262JX\363c\220\3339&+k\342\325\030G\304\277H\304\233\212\312x\254P9g\267\363\001rQ-\030\023-\344\234\033C\313\314\274\235\274\333\251\335}\327m\224\006\006\336\307\270\207:\206\366\234V\232\270\312\276\264\221\320\227\360\354\236\246&\303o\276\346\234\363\372R\017k\235^\302?5\013\375q\2465q\265\231\360\177\367K\002;\264\241\224\330\350\335\246u1Ng\242\b\305\337}\"\005v\350?\224\363\231\355\364\370\211l\205\006\237\207b\270\372\t\346\nM\371\227\266\373\323\340\231_\3237i\032\255?\013\272=c\330P'1\201\357^\201\205\035\352\357v\356?\356\004Q)\0248\366\314nj\023\277\264\333\033"
+	.ascii	"\306Q\373\233tK\3602\336\017\\\334\n\226W\216\347m\345|\336U"
+	.ascii	"\356\306\233j\n\201\213\373\200\347yKE\371\235\267\001\027w\001"
+	.ascii	"\377\342N\300\317x?y\235\267\223\213\273\311\305\315\344\342"
+	.ascii	"^rq+]\334JH\334I.n$$\356$\022\367\021\022\267\221\213\273\310"
+	.ascii	"\305\215tq\273.\356c\021n\243\213\233\210\305]D\342&\266\270"
+	.ascii	"[\0277\353\342^\035\367\273\270q\213\333)\034\330k\326\251\233"
+	.ascii	"\ny<\324,\244z(\373\261yp\316\347\356\306\275\214\373\031w<\367"
+	.ascii	"<\367;\3670\356uN\324\355\355}.\247\373\330\\\036\247w\250\t"
+	.ascii	"j\3119\367\221\253\373\370\246\035\016\337\013\034R\246\323,"
+	.ascii	"6\355{nl\254\371\214\232\315\214\330\n\363\314\021bu9\233n\243"
+	.ascii	"jn\216\335N\246\335\214\243\3615\256\327\001H\226\220\232`\023"
+	.ascii	"\217\2304\026P\301\037\370\306NB\3112\336m\332\365\025\274\313"
+	.ascii	"\361\225\213\024\3025{b\0065\253\356\257K\367\327\300\252\336"
+	.ascii	"\232\204\213\031\344\217\251z\301P\2641\027\217\271\325{\237"
+	.ascii	"K1\017\007['zj\216\313g\301\034N-\037\023V\263\\\275\021\235"
+	.ascii	"\241\232g\036Q~k3\276\024w\277J^5\354\320\306y\252H\374\232\317"
+	.ascii	"|<84D/\355\367\031\255U\024\230\303*tz\306\260\241-\314|\231"
+	.ascii	"<\240\202\363\313\306\240-\3471\b\207^}\245O^7\267\326Y\253\017"
+	.ascii	"\340\226W\365\307\007@w\350\316\370U\277\3069\364\306\025\013"
+	.ascii	"\251\336\370\016\307S\260\025V\235X\216rQ\301\342K\0059\325\263"
+	.ascii	"`\f\013\2470\321\373\033/\364\306U\265\345\354th\373\240\023"
+	.ascii	"\276S\326\027\016\372\306\265o\225\367\nv(\325C\361xf\027\237"
+	.ascii	"\350W\037\364By\263H)\276\357y\361\217\256\360\017\331\0211\027"
+	.ascii	"/\216 \321F;\365,\323P\020\335\236\002\330@\227\327\013v\350"
+	.ascii	"\324\3437\207\203~\330\303Z\342#\370\021j}tx\356\362\232\270"
+	.ascii	":\365\3000O\226\031\372\2459\3606\335\257\026\377s\241u\242#"
+	.ascii	"\330\3243\227s\206\340\307\0011\264Kq\2663l`\333;\264\316\022"
+	.ascii	"\2775S\353\333\362\245}\251g\343|\373\256\347E@:C\325\347\234"
+	.ascii	"W\331/\360\215\237gH<\324<i_\232\364\2606\352\037\214!\034]\034"
+	.ascii	"\366\243\036\243\351'\020\"\260C\331W\340\004>\375!C\210\020"
+	.ascii	"\0278`(6\262[DAeEA\325\210\202\202\301\205\345\342\306\327Qo"
+	.ascii	"]\321\330\002\303\352Z\306\360\352\352\362\312z\352\255\253\033"
+	.ascii	"_\313\033_IZ-\274@\264\320\002\243\241\205\224\341Z2\302\300"
+	.ascii	"\326U\253\006\f\254\022Z_\\5fh}\271_Z`YX_X[\030\264Zxu!\277\300"
+	.ascii	"d<\f\255\0301\260\266\262\210.j\260x\255\030\\0Zte\021;\353\212"
+	.ascii	"\013F\3262\006\027V\3272\353\213\306\362J\331^2\264\276\226`"
+	.ascii	"^^_\313#U\314-\210}\363\231P\250\341\331\322\212\325\211-\345"
+	.ascii	"Xs^\253`\347\311\3000\270\352K>~\276(+\340$\225;\031\354\366"
+	.ascii	"6\245x\024\235>}\276>\360\030O\352Y\333\363s>\263\b\210\314\026"
+	.ascii	"\245&'/\031\220\242\323\343\234Mo\224\372\370\363<L\202\200\227"
+	.ascii	"\236\351\013\274\263\301lo\231\200<\357\220\242\323\227H\025"
+	.ascii	"y\215<\237\331\017\236\tC]\371Ko\224\366\250:\323\360\017Wz\345"
+	.ascii	"\277\241S.\351\225\226\204!\377\352\362\250\245%\261}mh\266|"
+	.ascii	"i\231vyH{\356j\317\302\264\243\253W\272\033Lk\021\374\323\223"
+	.ascii	"\371\371\323\263bu]\350\366\240\300I\336,\023|\020#y\360J\267"
+	.ascii	"<\261Gz\177\036\242\205\271R\254n\311\231\221\244\006\274\266"
+	.ascii	":\267I&M\036Mq\2210\":\325AD\206X\375\3213\261U\377<\017\305"
+	.ascii	"\3324h\202\216\004\245\n\343\214\244\342\252"
+	.string	"x\370\340\360\025\031\241\341h\330\221I\025\013\301A\034\032\250\350\215\376\211\255z\367<tB~\3217\265qr\301av\340\003\200\352\250q(\245\230SH\311\210\210\210&I\322\030\200\002\021\2422n\003\021\220\275C6\222$\205\f\007!\243\324\275\177&T\354\344\371\253~\366\370\310\226\350\336\255\345+\025\217\022\306jYH\032k\200\343]\372)0X\342\306\352SJ.\314\213.\023\203\304=\"\230{\2372\226\316c\271\017\327E'\246\374\260\004\021\247r-\265\235\364\317\375\034\333\313\334\037\350v\224&\325\241\313\326M\327\244\260t\326\344\350\254\210\t\375\374\325?a\217\001\373\300\250\362\234\260\2370Q\030\235\262PJ\362<J\360<h?\0071`\344[\262<\355Qv\260\236\350\325D\254>\270\374\354\331\351\255?\332Cn\027\217\352\320\330J\303\217\361\277\253\220\264;u\204\337y\030\315\037\271,\247V\241j"
+	.ascii	"\222\2706\026[\233}\213\231\276d\230\017\021J\277\254\020\273"
+	.ascii	"!u\271\244\177\030\373!\364\024\367S\323\222L\025h\243\223b}"
+	.ascii	"Y\201Pm\201_Z\302\370\273\372v(\032\241),a='v\362F\225wE\244"
+	.ascii	"\376,j\277w\375|\370/O\333\262\346\202Q"
+	.ascii	"\314\224m\332i\325\354n\017\275\245\251C\324h\3450l\004\266+"
+	.ascii	"\003n\f\242\022\034\343\220\326\316\234z%\005|\037x\324_\304"
+	.ascii	"\273\252Z|\337\036\023-\201\373+j\236\332\025\264\221\025\235"
+	.ascii	"c\362\223\006\021\227\302#I\207\207\361Y\030\020\016\3118rN\363"
+	.ascii	"\362Z\2309\275G1\bgV\332\236\323R\037\323\345{\241\231&\352\016"
+	.ascii	"\342v2\013i\353\031\345Y\233\347\376% \214\031\201\"+ ,\360\241"
+	.ascii	"W\236\203\021\265(.;a\234\021C\013i\032\036@\306\205\260T\305"
+	.ascii	"8\334\350/\354\206\020\235\355|8\205F\203\327#\277\354=\356\325"
+	.ascii	"\357\215\264!\2367\032\377\001"
+	.text
+	.section	.gnu.lto_printAux.256.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`=\n\2654"
+	.string	":_\264\024@@\246N\007\205\302J]\350\r'K\031\324\013\323D\343f\330\335`\233yt^(\034rhX\006\200<~\222\036\325(\312\236\200_P\033\203\3557v%\0043\300%2\304\204\354\335\275IJ)\005<\001\032\001>\001p\232\256\243\\\254\023\""
+	.ascii	"j\326\327\312\t\026\222\035'\354I\354y\225\250N\263\2777\300"
+	.ascii	"\2607?\260\224FJD\373\272\354`\236\373!\274i\317\333,B\223\310"
+	.ascii	"\275\001\332X\233\r\267\034\027;e\346\270 }\233\267\217l\211"
+	.ascii	"\276\375\335\373\264\352\224i\254\235v\221y\r4m\204?\033M\262"
+	.ascii	"\323\biJ\272K5R\036\254\235\362smg\356\2676\223l\270!\314\336"
+	.ascii	"\3136Ww\357\363\001O\255\235>5\323\260Sa+\r;\345$\263_S\221+"
+	.ascii	"V!:\206\t\005\274\367^}\026^j\341\263\371\350\311F:\032\217\212"
+	.ascii	"DvU\207\251\360=\311\r\355\250vP\3117\207&\326H\302/\002\250"
+	.ascii	"\326{gS\204\033\0261\367\264\234\322\217X\232km\204bkJ\351#\265"
+	.ascii	".\252\265\235Eq\242\224hC\265\235Aq\266I\257\315\326Lk\265\367"
+	.ascii	"\316\322\032\217\351\303\036{\322\251P\351\311\233>G\264\"B\007"
+	.ascii	"}\274@)\242\221\271Px@O\036\230\306k\250\275\263'\302(\265*n"
+	.ascii	":\332n\206\266\364o\271N\235fzo\201l\315\265v\025\353\336\313"
+	.ascii	"^\206\326lNj\346\256bf-\314l\214K_\304\376\021^\302\247wd_\224"
+	.ascii	">hg\330\357\337dmJ\037\344\252\357\357h\217hk\363\324\360\305"
+	.ascii	"5\032\363\301\347\253\203\253\362\357d~\212y\023\0274y\374W\230"
+	.ascii	";\256\371\203\352\214\325s\315\035\372M3\207\206\353\326\240"
+	.ascii	":gh\273f\f-\247\371B\3375S\3505\335\023\272\256YB\247\351\216"
+	.ascii	"\240:[\251\316\r:N3\203\216k\256R\235\251T"
+	.string	"\347\005\254\263\002\325y\212u\226R\235\243Tg(\325\371\211uN\240:#P\235\017\250\316\006X\347\002Dg\002\254\263\323\352\334\264:\017P\235\005\260\316L\252\363\022\353\254\244:\007P\235\001\250\316I\2543\222\352|T\235\215\252\363\021\353\\$:\023Ygvu^WgUu\036\246\316i\352\374Cg\037:7\210\252A\245\2365Q\267\347{^%\203\202W/\265\343\322v\335r\272\357\272\347\272\337t\307\351\256\353\216\353\225\331\216[N\317i<.\336\tI\272{\267\233\200Q\271?\346\\\227#\024\t\2357\3006\334n:Q8L:5\3037x3f)o\360\304?~\200_z\001_\365\334\206\222eT6h\337\332\333\275d]\2264\263\222u\223\252\323\341kx\346\344\031\017\336e,\274R^\214\231^\300_\223\005\323\353h\371~\tD\373e)=\2216\220\033\334\230\237\006\360\001\272\257\223\036"
+	.string	"\322'\211\350@\200\220\002\005\302\251K\343\037\311\326\234\232\357\206Go\374gD\326V\374\243o\022\315\227e\241e\023\335\347D\247\017\372\212\337sZAnp(zO\n\342\023i\005\005\nW\3663<\321\211d\020\263\021\263\212\336\313\312\223L\302\202\375\356\322\3725\017\346\311\302\246\3525\206O\233l\304\250\3510h\374"
+	.ascii	"\207\357L\177\f/|:\306\306\213\032%_1|Gi\321y\353\267`\313'P"
+	.ascii	"\311\325g~\001\303\273\354\3027\032\225\345\2131\263\214\266"
+	.ascii	"\203\\\357]^\340\256\223L\323Z\267t\252~\027j\371\270\301\245"
+	.ascii	"?\374f6\372O\277\0051\241\030\235\302Kx\346\032]\336e\377O\310"
+	.ascii	"\312\022\275\"/\306\376\023\236\3027^\267\200\"\211#\373\242"
+	.ascii	"\364e\036\2224\341;\271\205\f'\274\001&\\\362\030\322\363'\034"
+	.ascii	"\246\340\tH\030\322I\013\351E\324Bz}\210\0368\220a;\270\214@"
+	.ascii	"\276f\374\327\212-\256\0339\272p\254]\215\002\fG\030\222\006"
+	.ascii	"\327V\202\036][9\276@\344\370\352\002C\372\350\002\323\362\300"
+	.ascii	"\265\365\345\325t\243\007\022\205\016\257\260\255\225\265 t\341"
+	.ascii	"\320\272\312\321\205\364\272\322\342\321\343\n\002\023\177\351"
+	.ascii	"\340\342q\005\366\365\305\343\252\370\274\375W\270\241\275\316"
+	.ascii	"M\321\013\374\033{\245\036\322;\231%c\374\360)\031g\346\245."
+	.ascii	"\324\302{\357=\006\031V\375\207w\322\346)\371\330\254)}\320\215"
+	.ascii	"D\253\006\213\002b\322\025\261\336\312\352\t<\202\217\372\251"
+	.ascii	"_@%\206\301S)\370\005nd\251\340]\264\211\244~\312\311\262\244"
+	.ascii	"\336E\253\310\r\352\243\236\036*\301?\211\360\2452\201\242\300"
+	.ascii	"\003\217\300\300\037\370\277S\340\r\270X\026U\237\337\251\266"
+	.ascii	"\300\367Z+\330H\215\300\273h\005\217\234\036\353Ug\022<\202\327"
+	.ascii	"\351;\255e\324~\200e\314b\007)\2738.~\247\005\n\205\370Nn\274"
+	.ascii	"f\003E\3330\351\322\364\301\242pL\272\347\016\0332x3\016\377"
+	.ascii	"i\342\2644u\370^\002\250\326\364\215\327\036\032\300\341\203"
+	.ascii	" R\323\032\360\035\355\364\255=\344\006\307\276\223}h\325}%\200"
+	.ascii	"\261\250Q((\021\202\204FfDAA\222$\215\001\240\002\221\261\242"
+	.ascii	"\325\001\021\340\250d\320\031\005II\322\030~\016\341\234\370"
+	.ascii	"\004\035\271\0224\245\377\233\220\005\203\276\034\223Ju\353\233"
+	.ascii	"a\023`\021\336\264\034\331\240\240\262\300neSy\270\"\333\b\326"
+	.ascii	"\312\016\311\324\207\033\021\016\353\263\243$^\202\260E\372\347"
+	.ascii	"e\025\321 \201\301\222\252\"\223+;\221@\273\2620\235\312J\221"
+	.ascii	"\244\337U\330\255\351M@\267\241\036\024-\021\306]M`\212\237p"
+	.ascii	"\021\362'\2410'\356\\\217\204\255:\367tU6\024e\240\n(\250\300"
+	.ascii	"\321e\277z\267r\003]yq\311\253\221L\314\225u|\343$\201|:\317"
+	.ascii	"\335\2150\005\361\022\305\265\277\341n\270\275\261|\244\362y"
+	.ascii	"hp\202\277\023\030\027M\312\212(\352}\201\273\204\314\220\036"
+	.ascii	"2\200\r\307\037\030P\306\320\020\033\003\253}\026\3419\013\267"
+	.ascii	"\217\346\177\242\336\330m\036\367\016\002\031\265\252O \b\376"
+	.ascii	"G\b=4\337/\216:\225\273F\261\351\226\375\376\004Z! \230P\027"
+	.ascii	"\001\350\bg\254\204P\2768\020j\031\"\363\263\212\r}9\204C\333"
+	.ascii	"&\365\264\277\206\352k\031\b\343\270\rV\001\fPU\313\003;\344"
+	.ascii	"\004\013\355{\246\206=)J\375t\f\314\213J\366\035\212\313>1\327"
+	.ascii	"\210\027M\341\207\025\235\n"
+	.text
+	.section	.gnu.lto_cliAux.257.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\t\001}\r"
+	.string	"\206Y]E"
+	.string	"\223\223\016X\332\023\004\177\t\267\263LSP\270\362"
+	.string	"\036\252V\247\373Q\025\020S\251\231l7\376\213\266fT\211\350"
+	.string	"v\022\024\305\307\t\224\326\372;'K\240\264B(\n\204\332\246\326\035\353h\333\366\336{\247\024I"
+	.string	"F"
+	.string	"J"
+	.string	"\027\251\247\016\331=\b\250\254hA\216\020 f"
+	.string	"\331]K\246x\350t\312\030\362\377\362N\367\211N9,\237!\037\313\345<\260\232\371\021\340+\315\217\327\242\373\313\243\210\217\024\343\246\301\356:v\337\312]o\033\202m\007\366K\002\006IQ\236\260/\3030\f-M\366]~*\243\277\371\212\022\336\210\225\223\270\261\353\205AVEq\234\334\341\240\025\250\210y\261\273\236{l?\332G=F\350.\036>`\327\004#\265\013&\260\001\316\251\301\177\352)'-\273\243w\207\261\021\274\006\3269y\250\035\250\335e@\3431\026|\026\247\316L\250oRO\177\255\332\033\206\370\316\227AaB\365\341-5\253\2244\207zIA\006\217R\254q\215T\332\0326\304w\227"
+	.string	"l\270H\321\254JR\344.\001\245`$\2336\341\342\254\253B\001\f%;!\321\256\215/PvrY(\331\210f]\\\212\005\372x\273\200qV\206m\343,\0178\372\\i\362\203\031\025\315j$Isw\227\212D\220\020\337yF\035*\336i\n\210\376H=\314e.\351#\026"
+	.ascii	"AYz\027C&\336\033\215\206\013\t\016\nm\242b\204\201,=C?\233M"
+	.ascii	"%x\r\340\020\353\212~a\275\272`\271\323T\263je\234\344\235W6"
+	.ascii	"5\271\306\245\240"
+	.text
+	.section	.gnu.lto_printSerial.258.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\265\tU,"
+	.string	"\032M\004\021D`^N:3\301\264\207\202\0011P<\315\371\252\333\035\376\006.P\017\313\035e\313}\n~z\347\367:}\370a\276\303\261\177E\237\324\311*\"\r\320\020\366\255\330\377\317\300\307K\027\256}B\b!d\313$\003\365"
+	.string	"\345"
+	.ascii	"\007\001\314\007\303\237c K\240@\274\\\016\246\342\362\212\245"
+	.ascii	"I5?l~N\250\207\343\177a\340Of\216\323\361;v\357\003\212]\021"
+	.ascii	"\276{\227\016~r\t\365\347\201\314oj.\364\362[\210\347\262#)\300"
+	.ascii	"5v\371\001A\375\311K\365\315|\266\267\021\357\306\203\327{\321"
+	.ascii	"\304\220\271w\t\201\235\324\237L?B\177\2327B\1772\221\031OR\327"
+	.ascii	"-N\331\225}y\361s\357\rZ'\254\336\\\236\327&^hUS\3644m\023\371"
+	.ascii	"^\336\244\314\343\322\223C\026/d\246a@\362.\007\b\021\323B_\036"
+	.ascii	"\"\377\362\006Cr\365\332d\314\354j:\344\250\271\204\367\306J"
+	.ascii	"\021\362\313l2\242d\016\210\364\352S\313\356H\037\332X\331M\263"
+	.ascii	"\001_\231>@d\227y$\026\345\370\271w\030\322\330\366_~&\325\322"
+	.ascii	"\260\371\241\215\231\275\323\r\367^\356#r\354\f<3\203a\346\035"
+	.ascii	"\314+Um\261\272\3201\366\0376\352[\346\025,\372\307\266\030\222"
+	.ascii	"\030m\221\231]\234\214\360oiUN7\314\260w\257\321\002\325\307"
+	.ascii	"\304P\3575V\020Cl"
+	.string	"R5\225v\357=\224\035\350\317\333\317\335\244\262u\206\357\254\315m\253\377l\\\230_\031k\223\314\313b[\350\363\232\302\226\t\363\204\273\375\021\202\177\373\245\316\345\177p\271s\324\343\316Pi\363\323\331\354\22463\020jnZ\233\027\244\315Lj\263\202\2659A\332\274\2446+\255\315\b\322\346\003j\263\201\2659)m.\2406#\245\315Gg3\201\264\331H\250y\300\332, m\016\2406\003X\233\213\322f\"\265yhm\006\246\315Bj\363\2726\253is\2526\243i\363\2116\233h\2635\233\373l\376T\203<.\2747;3\253\267\274b\177\201n\234\263N\312\345\376\270\334F\242\225\024\355\314\336\031\333\275^?\022\257\250^-\242~\036\331\b\226\231\270F\314\322?\262y\215\330\"\007\355\221\213.\n\373\376\021\260\033`\215l\232T\242!\266]\020QK\205@\303)@P\003\354\323(\357\326Z\334\317\217"
+	.string	""
+	.string	"6"
+	.ascii	"\207\367\341\263\007\300\235\337\213\353\351+\032\262D\035\236"
+	.ascii	"\007\317\235\2415\031\257C\007\270Z\241\017\337\323\313[\321"
+	.ascii	"\370\271m\365\237\215\317\001\241\362\345\034/\204\311#H\240"
+	.ascii	"?\222@\177\252vI\255\016\265\251\375\327 6\3618(4\300\031bx\023"
+	.ascii	"D\355\003)\333\254\2719\370i\203\326\272\371\252\343\352?F\352"
+	.ascii	"\2413\033\324Z\3232\247P\321?\236\226G\022\257\257\311\202\332"
+	.ascii	"S3\324\220\206\202i\315;G\262\337e\035.\355^\343\217v\303\347"
+	.ascii	"\235A\253z\033k\207]J\272#\331\227t\341\301\2416\031\346R\366"
+	.ascii	"HY\354\303\353)}\366\342N\363\354Z\264\237\254\f\tf\332$?\007"
+	.ascii	"\032l\365\342\211i)\313J\210\343\006\025Q\325\265\254p\baPy0"
+	.ascii	"\212Q\005\243\306U\007+a\025\026U\326\320\214,!\t\0334p\274P"
+	.ascii	"y(Ue5\f\326\250\022\322\b\016\261\262\202RG|e"
+	.string	"\203\n+\250uu\205\025\004.\357\275\\\225S\263\364\343\333\262\\B6\311\253R\235`O,\315`\327c\336{\357j\223\327\201B\331\t6\210RL\027=\2703\256\376k3\252M\362\355\330\251}\321\241A\253e\207\344\213\356|\335\243,X\222E`\023\330\005\226\201uz\242\022e\237\322\204N\2328\2555Y\006\026M>\201\323L\210Z\036,\031F\241)\3555\331WQ\276!\272u\022$\013\024X&\016}\304H\021\005k\036\332\254,\201\222]\352\320dB\202(\301\361\023\321cH\004\006\354\201\017-\026\366\303\200\375\235r\316\211\006\353c\222-\200d\013t\017\024\024\366\372k8\225\326^O{\367^$KT\345\216\311Y[\n\325\252\005\332\"+\300\032Y\0026\200\260\250Q@E\rR\206FF$I\322$\215\001\360\002\221\031\332\266\001\021\320,f\240qj\254\202\324\035\213\250\220S\0226@\217"
+	.string	"\347_\366h\227\327\\\266\3140sny:Kb\222\001\250\237\265;\340\272'\205\356\206l\322\333\211\301#0d\311AC+\250R.\264\242;F\324\013n\376\241\355\374\3605\355\311\221D\r\b\263N\311P\022p\216\221\346\016L\3155\210r\026\316=X\315\221I\372\004h_\374\033\013\257\372W#\332\013Xp\006>\240t\330C\373+\202j\350\321\264\252\034\254\220q/\236\3435y\347\253??#a\005\336\021\252g\231(\223M\336\001J\3176i\031\223'}C=\027E\374\004\304\202\347e\244O\357\246F\207ER\016,\356]\377\361\306\260t\025y\331\201\340\260\025r\304R\345\360<T\361\017\330\260\316\221\375\212]W\210\344\342_v\312\n\013\005\217K@\353\310\263\337\341UB\023fYE\300\235\356\263\007w\177\233W\360o\241"
+	.string	"+\354\245\273\002}\234\023\221z\331\317\372\030@@\023\034n\n\241\002X\376\034\212\260"
+	.ascii	"\231\350\230wr\302\240\331\257D\033\033\372O%\205i\360\017"
+	.text
+	.section	.gnu.lto_cliSerial.259.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\201\r\325D"
+	.ascii	"*v<\032=@\342\316\030\307\256;\310SY9\206\272n\210(i\364t%\227"
+	.ascii	"\346C\314\334\026\306\263\205\224\314\207%\035\246\f\265\263"
+	.ascii	"\266N\364\253y\030v:\306\366"
+	.string	"y\022\f:\013\\Z\332$\211L)\245\233\001y\001\224\001Y\0253z\220\037\356\214\243\234\336\373\276Oo\277\376\322a\372\257\005\371\t\330c\246\035H\326/\334\333\314\036\262y|\337\352\210,\264\217\\15\336\034:bX\320`\332`\312\372]{m\3449\234\303\300\013\016\242\227\361\355\267\272C:\217\357\333\227\200\331\327\\\246\335\205\017\243\322\372\3367\327\212}\324\233j%S1[\031\325\2663\267^\357M\233/G\027\275o\335^\231\367\355C\300\002\230\255\344\276\216\272\255d\366\221\333J\2362\327QR{\315\030\034\016\262}\351\363\276\257\3257\341\266\333\276f&\237\266\024\352\311\251\211iI)\t)\n\340\310\250\210hH(\b\372t6\231KW\331\276O\271\235of-\205\242\203\333\322O\\\210r \235\232\261\272\247\347M-\224\261\232\327^\021\3069\023\0238-\275\244\224&i\020\311\016\353\3211"
+	.ascii	"\304\034E\271\272\321^\221\026\242'U\252N|h\f\321\016\222\016"
+	.ascii	"\356\256\205\226Yu\210Q \351\340\360:\250=\360H\270\247\031\253"
+	.ascii	"rm\324\rKmC$\016\2052\347\022\275\357\333t\325#.QUJ\3734\342"
+	.ascii	"l%\030\nqk\303\226b\254\026i\375*\007\262\t[\252J5\317\233\256"
+	.ascii	"\245\231RtpDz\331\214U\"l\356\nie{\024\027\bG\350m\255\245\202"
+	.ascii	"c\245\310\363M\315[\327*\005\215^$\035\034_\177{@.\021\210\320"
+	.ascii	"[Z\033m\263\204N\013\266\267\275\241\271/\263\336\367e\247\276"
+	.ascii	"\3015G5\263s`f+\3633-\256\323\267\341p\257\376\020\360*,\323"
+	.ascii	",\336\324\253\3574\327?\3314\027\257\005\247yQ\307\367}\035\350"
+	.ascii	"\200\002(\222\310\231O&\326A9\242\254\341*\370?Ct#\345V\317<"
+	.ascii	"\335R\301\233\252\340]\316u1\013u\001\2037\325\352\243\0244\325"
+	.ascii	"W\375\262\021\313g\355\n\232Or\223C\233\327\270S\335\203-XC\310"
+	.ascii	"\t\225yC\007\007\\\223\215|l\2649\331\307V\311\271A\270M\246"
+	.ascii	"\023Kx\264\320\213\237\243\336\373\236\251\3515\"\270\243\224"
+	.ascii	"Pr\227p[\331m\302e>\221\302\233\312\375w\305\222]c?=lJ\376\255"
+	.ascii	",\303\355_\3417'\315\3750\221S=\263\326\2267\265\277\005[\303"
+	.ascii	"\232j\237\307\2647c\356C\363\2672w\207Yt|\343\257c\316\242\320"
+	.ascii	"f\232\261 <p\300\340\252\3054+\350.\315VU\315\327M\345t>\020"
+	.ascii	"@*J\n\325^\232\237\234\202\234\233\236\316LL\347\245\246\263"
+	.ascii	"\322\3239\t\352\214\324t\216>\235\001@\235\217\232\316FO\347"
+	.ascii	"\"\2503Q\323y\350\351,\004u\016\202:?\241\316N\250s\263\3014"
+	.ascii	"3\233\316\313\247\263\353tV6\235\333.\323\374Lg_:7\206\251I?"
+	.ascii	"7^\016\311|\234\276\327m\022\320\233U\026\332\265\231\3562\335"
+	.ascii	"]\272\275t\203\351\026\323\035\330K\346f\356BnC~\232)\253C<\262"
+	.ascii	"\242\007\271\t\371Yf\371\345.K\322\247\360B\215{q\244\262\336"
+	.ascii	"7\210O\036\337\276\327@\267\344\2324$Jq|W:IHA]\346>%\237\237"
+	.ascii	"\244\246g\307O\367\237]\\\324H\231k#\200\243\267b\275\362\214"
+	.ascii	"\315$\237@FH\024\213\210\224]\346:\0015\326;\037\2511\217\214"
+	.ascii	"\236\356?,\344\020"
+	.string	"\326\\\013\226%]\271\"\342Q8\323\206M\350\255r\357\323\265\024\013\206M\320[\371\331en\363\233\316O1\315\375\224\271X\337|\244F-\213krhx\272\261\206Y3\017\304\274\250\326\344\r\364\017W\005\366\341\216\364\346C\267\225|{\030\301\335\2247\311k \0173\327a\276\257Y\313u'y\021\241Ly\337\327@+\245\276\377\260f\262j.\351\200\202\314U\237o\345\345\267/&\326w\246J\230\357\233\006\201\373\261!\247K\332\251u\332\304\2356q[\271\374f\341\201w7|\301\263\323\223\375\302U\376\201gg#\242|\254wA6\311)o\257S)\336T\345GA\370\366\215\254xq\036@\370\216\304b\241\n\342\351\343|+\234~\360\337%1\317ON\324\203o\303.\212\304\032\371\270@8T\232oe'\354v\243B\016.\247\372\277\315\335\253\366\001\270\250\270\274\372\247o\343\326uz_:\370"
+	.ascii	"\337\306\315|\253c;\275\203\027j\274#\263&\347v-8\245\322\324"
+	.ascii	";\f\336\337\310z\027\206M\022\312\257\030|G^'\263io\266|+?\001"
+	.ascii	".b\225\335e\256\020 \033l\313]\026\374\3055 \352\211]T}iy\211"
+	.ascii	"u\315\260\n\363J\262\321\305\005\226\241kL+\004\027\231\326\212"
+	.ascii	" \257\026\013\213\341l\341\305\002LL\214l+h\f\214,\314\302\030"
+	.ascii	"X\027\f\262\026b\025\270\274\276\264h\030\211\215\305\370/-\032"
+	.ascii	"\337\005\346\365\305\005ck\311[U^_[V`^Z0\254\266\304fXUE9,F\227"
+	.ascii	"\230\325XX\230\230\325\263\357\354Gg\235=Z\377\220>\334\031:"
+	.ascii	"r{\375\250\250\207\006\212\254}_:\n"
+	.string	"\035\330\375\330\305'y\202\017\275\321G_\351\231\276\351\331\347\246jK\2723\331\265\246N\331\230k\275\243@+\247\232\247<\246m\211nr\357\2217\343\246WVY\324\223\333\343[z\246w^\371\240\305\t#\271\364$\256\200\360>x\034\021%\244O\232C\372\033W@\221$<\b\220\350\321\003@r\204\207\302\337\252FD_d\204\350o\\\003E\256p\037\336c\350\243O\n\203^\350\233M\222\031\364\313\302\305G\271=\2763\237\344\b\336\331\247\246*p\233\276yS\331\200]\232\354\332\233!\232]\363\236\0348\3634\310t\210\013v\321\237\035a\026\355\315\250\344`\311\342\304$}v6\245\317\3746f\2003\305I?6i\356\347N\323[y\216\n9\270\224\365/\365mn\200\220\212K\017\236\231O\037\365m\274\004\365\3342\003\274\364\333Xj\300\235D+\335\335\276\357\3732\035I\237\221\244\317m\220\264\221"
+	.ascii	"\376"
+	.string	"\031T\242\360\334\022I\037\352\333\230\251Z\352\263\276\t\333\303\227\2738\036\201\020\250aD\342\020cdfDDD\222&i\fa\005\004)\007\2413\017\021P\255S\322\324\244)\fs\037\223\367\256\005\346r\3641>\037$\375\277\276\334\301\362\177\324\355<\r\354F\361My\250o@\013@\247\360S\235\237\240W\245\033\306\231e\026\233\024\022\n\304\270\363m\351\247R\017\365\353\252\265\366=\324\257\332\264\204=~ujF\223\323\361\202@\364 \324\265\321\341HzG\270\027\260\214\177\265\362\271\024\216v\t\352=\036\351\032t\210\240\360\226z,v\020\371u\037S\202$\324\340\210\274\203\257\250\270\001K;&\244L\204\336\271u\270\234`\211\374\036\343\204*\373\247\330-!\346}k+\344\252e\022\203\304\371\207\370\f?6\207\367\3734O:{&\252\237\332\021\240\367\224\217p?\353'\202\3366\016\202\017!z>%"
+	.ascii	"\371\377\246\r3#\322P\3165\345o\241\262\232i\352\362I0\007}\305"
+	.ascii	"<\376AOc\220\234\311J\266&\220\362\362\307\277\372\244\247\301"
+	.ascii	")\026\r\200\t\247d\233dt\237x\274\213\245\277\275\214J/t?\352"
+	.ascii	"\2000\261\227\312\364\004"
+	.ascii	"\277\313Y>\271\242\035\006\330\330\024\024s=lt\304\224r\317k"
+	.ascii	"Ort\310[a\226r\375C\032\026V\327Y\365Vn|\300A\221Rs<\f#\024_"
+	.ascii	"C\177\304\003\234.\341N\r\362\3746D\2614\302\366\002\233\314"
+	.ascii	"\325m\202\314pIB\355\263H\006=V0!\310\312\273\240\006|\307%\033"
+	.ascii	"e\204\r\311%9\236\340\273\247$gk\217\320\343\303N\334\226L\254"
+	.ascii	"\244.\337zM\376\250Ox\025Uj\355\241\310\373\277@q\217\207\356"
+	.ascii	"W0B\226\003\351\252\\?\021\347~xA\211\212\323}m\205\275\331\301"
+	.ascii	"Bgo\006=\321c\013\245Z\rNbP\367n\262Ioj\001%\016\223p\304\366"
+	.ascii	"\346Rj3\224.\221{n\350\304\020F\2510\274\205<\212~\323\001\252"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_cbCtrlLine.260.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\266\001=\020"
+	.string	"F^jE"
+	.string	"\221(\035\373\346\224\221\277\270\235\364\177B\332\361\037\200\360\037\033\304=\340\341\340\327\254{(\202\312\r\325o\r\035#7\202*\364<\373\353\357\252j\375\023&\r#m\243y3F\331\177\263Z?!d\023)S\nT"
+	.string	"T"
+	.string	"T"
+	.string	"F\340=Zv\020\367\350\235"
+	.ascii	"\367h\320\216a`\265\250\0061-\226K\215\335\3754\345\340\271\270"
+	.ascii	"i\202\376g\337\264B\3249\224G\023N\270\312\r@\250\341\272%\240"
+	.ascii	"AA\343\023\226l\240\223\017\255\317\236\030BUf\367`w\235\255"
+	.ascii	"\320uw\267=\262\355\300N/?\247i\325tn\351\007(\220\362\302u\332"
+	.ascii	"\212\335\223\232\215\225\211)@\374\345\267\377\2319~\211\273"
+	.ascii	"\200\177\261\212\257k\177a&&\003\315\356z<\232\201\367\310\261"
+	.ascii	"\251\354$\300\263\2208\356v`\241\300{\024\220O\373!.\002|\314"
+	.ascii	"0>`\367\025\203\331\225-\b\037M\375\354\020`\264\032\353F\252"
+	.ascii	"\203\353\350G;\024U\326\374\223p\033\355\250\223\265Au\01754"
+	.ascii	"0\2520{\274SM\315\254\264\270(\311\032_;\375\tN\257\237\025M"
+	.ascii	"\006\353F*k\266\f\225\n\263\277\355\356Z_vL\177b\332\023\323"
+	.ascii	"\235\263\374\233\277\304\002\243\n\244\217\b\035\222\351$\332"
+	.ascii	"N\026F'\221\222\250\263(\004B\022}\" \037!\237\3104\362\205@"
+	.ascii	".M\030\231\276S\251d\3728\262\375\266\372\332\250\214\220I\251"
+	.ascii	"\212\343\244-!\344&TVdT\212\212\ns\007\3479\220\232\231\321\322"
+	.ascii	"\202\366\215z6/SUm\n#\371\2269V\212rHo\302!% P\002\"\205\327"
+	.ascii	"\r\301\271~6\006\333\203\2205\217\266B\206I \207\020)\275\263"
+	.ascii	"\210fH\213\362\340U\f\241\201\2570\315\240\227\020_\252P\f\276"
+	.ascii	"\224\"\265w\274\001\346\030\222\034\205\246\330e \373\332e=\313"
+	.ascii	"\262~\023*\215\311\0355\270\221\027!\003\024\327\024o\3235\204"
+	.ascii	"\005\005"
+	.text
+	.section	.gnu.lto_cliSerialPassthrough.261.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\002\024\345d"
+	.string	"\032\252\020&P0\220J\352+\227\204\020\003\n\346;\367\200u!\243\372F\256P~\267L[\363\330:\027\b\257~k'\024\2132J@\215\224{cN\316\237\310\242\006"
+	.ascii	"a\252\272\2429\232\355\271\240\310}\270\t\236\f\215\357\017I"
+	.ascii	"\252K\013\322\270\355\336;\311\224\002S\002-\002F\002\356X\334"
+	.ascii	"\345\334\265\270oq\347\342\356\305\203\335\356,x\233Sq+\376\346"
+	.ascii	"q.\365,\356\202\317y\027\237v\216\227\236\0233E\253\346\234\277"
+	.ascii	"\270\\\375\250\274\271\371\330rc\315@\362\337\275\311EA\320\322"
+	.ascii	"skv\313+\364\315\213\032Z\316\331\263\353l\003pb\351r7^\254h"
+	.ascii	"\336j\241oT56WX\226<{e\377\200\315t\255\232s\264\312\205\323"
+	.ascii	"\221b\307\007\rL\245\224\345,G\303\275\242\203Ko\272B\265\330"
+	.ascii	"\202WY\272[\317\275<\242\271\253\205\302e\013\\g\337\325}\332"
+	.ascii	")9x\262]\366.&u\"T[\260u\240\243\345\205\rTT\307\232\201D\263"
+	.ascii	"W{\207\027Uc\223s\224\204\263\315\324\355\270\333\325|m\351R"
+	.ascii	"txO\316b^\344r\216\226h$\327\331\216\372\260u\326u\237\326\331"
+	.ascii	"^v\237\001\322\312X\001L\2234\251\260\3119;=\222\376\365\365"
+	.ascii	"\365\365\371\032\365\336\301Kwj*\301Db\204\210%\245\020IHG \214"
+	.ascii	"\336\"\242!\241\240\017\036\200\210\035\206?>\034zxvt\204\301"
+	.ascii	"\034 \216\373k\331\365\361\262\035\330\205\345NM\277\024a^1x"
+	.ascii	"\211\027\234\351\205/\230D\235\217\250\243\303\"\246\276\264"
+	.ascii	"\216\250f\261\301\355\270\246\353p\213\314\351\005+a\251\207"
+	.ascii	"\200\363$\317\222:\022\\\034>"
+	.string	"zs\020\353[Gm\026\211\021\331s3\256+\330\350\315\n~\213\334\234h\005)xH\350\227\"\314\013\213\007\251E\301\037X:6jP<\254P_\310\246n\307\225\266\266G\262 \201\202\201\320\234\210v\002\356@\346C\262&\370g\315\307\216k\t\023\314A\211\367(1\343J\202y\326\237\326\026\231\333q\215\255(\332T\265h\341\235_\n\023\274\210\270\216\320\216k\310\372\346\234\301p0\007l\352Ff\\_\030h\024\346%\304qV\237 pc\334\216K\310\312d\306\025\004\273\024L\235\374|\352\f@\341\252`\336\226\340a\\@\232\300.f\033\034s&\244\215\302\270\300X\366\016N\216\210\257-\364\n\236\332^\230\027\f\376\353\b\260/=t\272x\254C0G\364|\352\370\331\265\003\343_\212\234scg\227\227\267\t\357\376\r\272=\255{\347-\337\353o\21036\215kJ[\027\337+;\374\237\177z"
+	.ascii	"\306\244\017\002W\003\306d\331\244\205\361\276w\366\206\312\344"
+	.ascii	"G\377\342\177T\244h\230`\016\306\035\2771\242\263\342\211\236"
+	.ascii	"C\252%\334\350\270\204\017m\022\336\346-a\366\235\316\333,\235"
+	.ascii	",\317\\\246"
+	.string	"'Qr6\205\345\023\354\316\366_\346c\365\3212\312r\r\273\223\355B\345Qf.\350K-\321\263x6\316M\316C\373\307\363\013\013\216\003\337\253\373>\321?g\360\265\006\350\272F\325z,\340C}\251}\337\201\317\241\022G\246\331c\007\3563\340N\314\025\234\207\266\353h\377=\354\255\252p\021p\231nD\311Y\005\030\300\356\374\307V\316\236P\265\310\244\340\342o\361x\256\311\227\205\373\360c0gN\356\334\255\234\021\371\005a\020\337\275\202\005v\247\213\307Y\316\276\250\036\306\375\f\b\025\013\277\351\272.\024\212\264\0175\323Me\360\332\363\260\367\\\353,\335\230.!-\313E\3044S\237qs\306r\260\"y\nW\226s\026\341v\335}\306\035\314\035\313\\9\232E8{\364\301\267 e{U&\346\373*]\264\272X \354t\036\367\300\017\236\323\351<\006\b\222\360rf\2723\206\313t0%g'\240"
+	.ascii	"\273\363\304\377\274\375\250\356U\231(\306\332PW\016\270\273"
+	.ascii	"\202\013\260;\333\255\230M\251;\206\260\350\314\376\241\3557"
+	.ascii	"Z\177\031mex\3406\275\203\235\276[\312\210\335\351\357S\367\020"
+	.ascii	"\336H(\333\253\362x\254\356(\026~\350\234\222\271\021\372\305"
+	.ascii	"\272a\274p\321\202\205\003+T@9\2337\212\023O.'\305\335\311\243"
+	.ascii	"\336I>\305\033\311\335\274\217\374\2127\b\243\267\310\261x\023"
+	.ascii	"\r\271\234\267P\320\007\337\342\355\001\210\330a\350^\274\177"
+	.ascii	"\036\267\317\343\346\020\304\335\223\203\233g\305\275\263\342"
+	.ascii	"\326q-\336\302\307\035\004\342\316q.\336@\034\3348.n\367q\377"
+	.ascii	"Z\334\355\0177\353\270W\307\375-n\274\342\366\030\236\246eK\004"
+	.ascii	"/\277\322%\347\255\276\0332\225\325r\202G\335\331\334\247\270"
+	.ascii	"\273\271_q\207\013h^\367\210R\006%\032\227\211\307^\255V\316"
+	.ascii	"\200\213\\\351\340\205P\245L\343U\306\334/\241\027\244H\001\f"
+	.ascii	"\374\337w+\327(\367\206P\265\200C\224n\224o\\&\346\361\344K8"
+	.ascii	"\006\b\037\321C\373\331\316\234\265\005\3019y3$d\251E\304;\343"
+	.ascii	"F\250\t\003\375P\366\021\261\\\246\313\345\251\260&\270\267\267"
+	.ascii	"\026\364\320g\223\301L\233\20744\264\371\320\005`\247\303=\226"
+	.ascii	"ZCcM\227\351i ,\237:o)P1\336\334\236\207\207v\035\221\246\224"
+	.ascii	"\370\276\324\366\332\341\351\215\236\256\342\205|\230\201\302"
+	.ascii	"\355\313\255\326\350\201\336\311\333\227]m\373r\204\026\212\204"
+	.ascii	"\345\017\354N\025?\200\2172_"
+	.string	"\262\220\307\002\"\276X\223\360<\2232|\266\354Wm\257?\300\007\332\341O\217\365\366\332\362:<T\207L,m\370bB>\306\030\021\372\342\246\346'G\373{\347k\013\202\2359\004h\f\302R\204\345\227\233sv&\316\376^h\247G\005[\223\222\205\373\\I\2050<\037\264:gS\332\203\261\2748MkJy\274\316=\374\263;hQ\374g\351\205i{\302PD\226F\260;Q<\273\247\002\221&\f\365N\207\231K\350\016\036\022\227\351eJ\313$\313%S\007\2769\221\333\253j=\026\207\207\n\365XC\353\331y\377i\350M\004\275\360\237\275C|\340\316\360\241\376\331Y\016| \037vF\322\204\311\343\201\333Ty\036\3328\246o\232R\235\027_\234\272\035\375\323\203)_S\252\003\243\307\333\017\276\365\304\203(b3]kJ\327\026z\265f\225\325\353|\350\203+f\032\245)]IxP\207\337z\376"
+	.ascii	"[\333\257Z\342?{\325\371\371\342\024\255)]\233|\b\342\307|\230"
+	.ascii	"\261\220&\314\232s\316;\301\367\033H\364\275\n\337\347\313a\361"
+	.ascii	"\375{\277\333\367\375\242\177\372\324\327\251^\263J\320\375F"
+	.ascii	"\333\300\241o\341\320w\316\320\367o\350\273\035\372f\207^(\350"
+	.ascii	"{\005\006U\247h\232R\341\212\357\234\240\357_\320w\033\364\315"
+	.ascii	"\006\375\007\3427\220\370-$~\2579\304\025_\314_\213\357\226\370"
+	.ascii	"\315\022\277\303?;8\374\006\016\277\205\303\357\234a\375\302"
+	.ascii	"\210 \201\267\352\210,\276\310\243\260\275\233\222S8\214\357"
+	.ascii	"1i\225\364\032kH\345\220z\221\306\033\307\252\227i\006\325T\021"
+	.ascii	"\031u\003y\\\340\250\233\212\357\001\020\304x\221F\016\216o2"
+	.ascii	"\n\371\036\035\2236\216\310\f\336\242q\006U\024\r\251\327X<\262"
+	.ascii	" \nj!p\006\325T2i\264z\231r\024\243\214\310\032QG\303\006\n\233"
+	.ascii	"\212I/\001\357\233\254q\025\225\201\261\3702\ruS\321He\254:\276"
+	.ascii	"F\031o\362H\365\026k\\\035\245\206\375\026\223^\234n\033G\362"
+	.ascii	"\033\007\362\373\305\305)\\\274\212\222\261\312@"
+	.string	"\240x\025u\200\261\206\214(*c\020\231L\3408E5U\345\"\223\tP\271"
+	.string	"\032\213G\033+2Ye\344 \312\352\247\3011\3718\214E\252)v'F\022y|Ac\306\325\021I#\002+\253\250\252\037\343\214(++#\213\244\321\312\210\f\032\251\246j\024mH\375Z\252i\252\206\224\023\325T\224\r')\244\225S\323\260\217UF\244S\362xD:\345D\263\247\310\372\035~\304\351\275\356P"
+	.ascii	"[\363\2422eL\232t\2549\207\031Pe\303}]\304x\212\267+\241\264"
+	.ascii	"H\357\023E\271\326d\363y \331\026(%0\300=,(\3338PQV\221\302\341"
+	.ascii	"q\200\360|\317{\234\360y\276\350.\017\r\323C\233-3\242\261\232"
+	.ascii	"\322J\025\031\2257\227\371M\224\234\3754\021\215\323\224qI\262"
+	.ascii	")hR\227\371K\224\234M\372\347\316\n&^\347w\336\233=H\270\360"
+	.ascii	"u\276\205\346I\233[v\340\276n\302IhJ7C\274o*\263,\227\210H\373"
+	.ascii	"\"\361\320\017T\257(#^\254M\374g\251A\"B\002\214\364N\347\346"
+	.ascii	"\234\345\316\340\234\262\013\023\233\341\263\034\355LZ9U\326"
+	.ascii	"aw*\353Zg\203\017@\023\276= Y\270\257L\351\2068\026\346I\r\324"
+	.ascii	"\036\027\326\320-\211\251skJ\221~\357z"
+	.string	"uJ\232\322\020*\036\351\237Yh\310\234\210\212\255Q\n\361\320&\313.\"7kb\003\232\232,\334\3473\306\345G\322C\221\360\226\347<\362\005\274d\331\225\3638\232\324\260w\364\002?\201Q\206Y{z\2341\345\035\031\227\211\247@\2412\333\030\306\326@<\264\237\036\347]I\036\206*\315\2708\037\"\211\033=\264\003\201\224\250q$d\021S\206fDDd$I\322\030Q\005\304((\031\362\006\02109d\254F\022e\231\003w\257\234\231\253vpTC\242\240\337(\016\246\337\351#\347M\016\202\020J\323\256\303\227^Z\374\356\037\246l\340\r\316\377g\275t\252M\243\337\204\365T16k\371\001HZ\023#\214\252F\333\003\022\b\361(L\020\321\366\361\300B\030\023\247\237n \2307\355\213\311\202\327.\352*\200\345\315\b\225\3429\3362\263\001\353YW\211\203\366\335\212\354\216a\354\323\226-\223\235\020\270"
+	.string	"8\321*\214@RJ\367\311\034\305\360\002\027\216\276)\240l\223\242\343.^\341\031@\326g\210\217j\215\240\216\360p\232\"\310\366wb\305\332^ \n\251\3356y\211\301\311\354\353\021-\322\362\363\352\231\"&\006x\027\034*\354uG-\250\347"
+	.string	"~\220\340\263HmT\212o\f\017<\225\210bdA!\026\027\266\310pEB\354>\270*\210\260\367\310\"\305d\244-\005\242\212&\345\325a\221O~x"
+	.string	"\335\016<\205\355|\031i\203R\031~\326\260\202\323< VFe\272\332i\336\037\227J\034\242l\030\320q\3179\376\230IP\232\262:B;\362-2\035\345\352\023B\346"
+	.string	"\256\033h\250\177\242*\345\327-o\261\025\237G\354\034\234\313\036n\331N\210\353\3107\271\352\217\ts\021i]\314\231\245\236\246\b_D?\022G\310\313,\324\033\216\006\n\253\273\033!\206\360\271\243\354\026D\205 \250~\002ZI\251\"\034\372,\344\r\354\316&\264\320\375\265\357\270\346\243\211\312\026\355\233)\223\b+\351\017GJo\225d@\372\315\201n\315\316%&\250|\375Y\317h\271\302\na90\310s\001\266i\001\0372\fO(=\236`R\312\236\202\204\205\2531iD2\3043DW\365?\254h\375\362\363\3329ac"
+	.ascii	"\004\240\203f5\227LB\365\301\241s\201f\326\352*^\242\222\205"
+	.ascii	"\376\351)\032\251\242\003\305BC\264\007\220\367{TA\201\340\344"
+	.ascii	"E\016\212\241\221\024\202\226M\345\362 {\277~\223_o\216V\240"
+	.ascii	"\004 \004Y!\251+\255-q\243\231\353\332\203M3\3576\t\204\237^"
+	.ascii	"y\002\0317\205Ap*\371\243\370\274:L\315\034\344\3268\245\263"
+	.ascii	"\225\034\002\261\22292\f\231\200b6\34359\027\023\n\272\354$V"
+	.ascii	"\200V[\314@\r\346v\3150N\222q\374\221\362\236\305\321XiN\023"
+	.ascii	"\367\177\r\370\264\317\253\220\244i\350\207\354\335\201\036\211"
+	.ascii	"\222\332\373\244\232\310X\223\003A\346\341|^\037\275Vi\344\036"
+	.ascii	"\022]\327J>.\237+\013\321O\243\334%,?1\331\322w\367d6\354\317"
+	.ascii	"\242x2\252\276W\212\221Y\207\344v\350\240\270\221:+\205\272\322"
+	.ascii	"\317\205\274\340\272\260 \032\257\202\3166\2234\234e\260?2\362"
+	.ascii	"b\204\361\244\236\313\007L\006\035\321\0204-o$M\227;\313\253"
+	.ascii	"\323\217M1\250\006"
+	.text
+	.section	.gnu.lto_printAdjustmentRange.262.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`:\b\035*"
+	.string	"\312L\204\020Ep\234J:?\253\340\372T\234O\002\221\037\220\275\301L\333\304U\247\003?\362\307r\231\336r\001\255F\215\013f\211 \240|\306\243\321#fi\226\271N\260G\253+\215\314\316\204Z\337\224hkDB6!R\312\024\362"
+	.string	"\325"
+	.string	"\373"
+	.ascii	"\273t[\376\373\357\224o\336\201xAs}z[P\276Q\366\356\300K\211"
+	.ascii	"Q\246:\216)\032\320\\_\235\tt\3157\230\n[\273\027I\304cz\343"
+	.ascii	"d\353\313\203\203#\002\335'\337\272\003\327\374O\007cS\264tk"
+	.ascii	"\264!\223\244I\323#\324\232\007\201\256\271\300_n\216\025\037"
+	.ascii	"\227I\3306\211A\364\223\2229\021\022\205\256\371#\272\374/\334"
+	.ascii	".\t\3338\031\337IS\037\\\362\322\364\030u&t\315\244\025\252k"
+	.ascii	"\226\033T\327|\330\177\206hFJ\224B\266\225\315\301I\323T\330"
+	.ascii	"@\216\264\345q_9l\317j\226\315a\337\271U2\372\021\367,\231\306"
+	.ascii	"\035\321\347\254\254\224\340g\344o\353\306\270\362\024I[3\307"
+	.ascii	"\226\345\321\036\027$>g3J\245\035=\242\354\335\262\21532\356"
+	.ascii	"\255\333'\343\2261>\273\263\264\345sB\232\246g\2633\264=\272"
+	.ascii	"\377u\374W\373\317\277R]^)\036\341\331k\251\333\334[42\306\177"
+	.ascii	"\017\366\366\336\255\231\306\270\305\t\037]\0351\376k4J\324\222"
+	.ascii	"\335l\377\221\310?"
+	.string	"rch\274\177\374\0206n\367A\325\342\355\251Vnwj\245\354\245\266\311\256\203\265\333\013\227n\037\254\374\250\312g\200\362\241*\377\t\345/\250|\005\225\357T\371\tP~S\3453U\376R\345+\241|\004\225\237\204\362\017T>\022\312?\252|\243\223o\240\362\013\234\374\242\312'\252\374!\224O\240\362\205P\376\200\312\017\252|\240\312\027\200\362\177*?@\345\373T~\017\312\007P\371@\224\317S\371;(\037\255\374\363\344\327\3127O~Y\371m\362\331\344o\204\240\337\330\236\034rH\363\035\323\033\177sR=\263\n\221\305\333\265\333\225\022\177l\036\261\331g\3574\260\003tP\013\365P\007\373K\346\302\351\303M\2225\2704-\256\031\006\264\350\345\264&Q?\350?\203\006^\263\227)\217&\276\252\211z\313\352\020\350\241\r\313G`@\013q\3300W\003\372\313\b&\031'\246\267@\035\264]V@\003\375\264"
+	.string	"\017\273\367\345\307-\356$\363\351"
+	.string	"\305\265\242\375\225\332\323>\335\310\242\021"
+	.ascii	"\335\323\373a\271\\\005\307<\304\"G\254\351\024\004@\357\233"
+	.ascii	"1L\222\247\201$V\013\217\033\332;%6\313\025\332_F1\311\332\347"
+	.ascii	"p\261T\267\270\262\315>\331\372\374\312\352\374X{E\013MS2\252"
+	.ascii	"\257\2250\264\023h\333\232e\177\031\371\222qP\333]\325\215,\253"
+	.ascii	"\002\344\245\262T-\325\177\n.^\263\356V\363&G\257\330\304sO5"
+	.ascii	"Uo\336z\230\353\343+\036\031c\032o\326\362\312\215Q\247\332H"
+	.ascii	"\315\350\205\315\036\0312\216sn\007\035\007kJ\352B\2215d\352"
+	.ascii	"\032\356t\r\331\202\227\212!\230\013\255\236\255\245\360\245"
+	.ascii	"\002lhB+k\310K\353\304\212a\207\257\025Z\\_"
+	.string	"^`(\262\206?)\274\206\032Zp\201e\241\307\nn\251\300\022\256\330\032r\t\261\272\274\204A\241\263h\241\325%\374b\301\242K\b<\246\333?\346\026\215\202\324K\246\021\353\261\263\331\276\363fBh\363\215o\203\341\324\214\304-\3234Mk\263}\363v\247\frI\031^Y\205\266A\276\225\341\365\367E\025\266\215\177\027F\r6\204\336\272\355\020\246\217\256\2706\306\005\332\250\221:\251\231ZA?5\203\250\n\302\216\202j\006s\240\026\364S\234\253\005me<\223tj\005\t\332\251\231NS'\200\343\327\344\266\324LJ\275\324L\007A+\271\271j\n\322\346h\f\202^\034F4\311\003\235\264\346\200\333Q#\245\271:j+c\233\244\2016:\223f\240\255\214n\212\272@W63X\312h\245\025-\255\361k[[\022'\306\001\200\223\250q8f\215bDdD$i\n\0133\214\001\340\002\221)\332<\021"
+	.string	"9\210\020+\322\202\222\266r.\024\364\b\271<\\\331\336L\372\305\003-\250M\216J3\021K\241\305\\>\231\320\327\030\321\242\364\353\250\214\304dK]Zp\020C\017!\b\216 \031\026\\\337\001\312!\241\375\304\036w\314\274\177\"\3710\252\245\030U\2729\337H\322\017\327\337\311\375MD\330|\215\231s\312Q\223w/\314\340\246\211\022L\254j\036V\315\305\2746Q\365-\374\b\326\b\257\t\360@\310\342\2463_\r_\be\350h)%\273r\220\013\020\277\3253\305,kY\356\217L9cX\334\366%\355K\236on\376\036\314\273\254.w\204@i\204\213$\317*\037\003o\247\356\206\351-\301\373B\3573Y1p\325\232\232,\005UH\253\256u\214"
+	.ascii	"\f#\337T\326|\253P\310\f\261\201D\342\340\324\260\326Y\032\251"
+	.ascii	"\003\373\037\fU(x\361p3\037\f\026\377\300`\255\b\020\321\\\252"
+	.ascii	"\200\357\300\272\367|\311\220\n"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.263.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\f\001m\r"
+	.string	"&\031\\E\020\221\223\0168\221\354t\0304|n\242\007=K\0218\262\b#\fA\373w"
+	.string	"\244\2725\206\324]\2645\213\254o\302\212gR>\316\214\344\264\261\002"
+	.string	"\317@\241`A\220\022U\004}\253C\203k\311\336{\357\224\002G"
+	.string	"G"
+	.string	"H"
+	.ascii	"\234z\232\371\246\236\332\263k\020\020Y\321\202\0300\036Z`v\367"
+	.ascii	"\222\"\356\235N\031=_t\232)\371\004p*\271"
+	.string	"\234\007V,n\0048\225&\307\204\362=\365\370\341D\212\321\352\330]\307\357Dr\327\333v`\273\201}-2T8V%)\262AR\224!\354\3130\fCK\224\375\225\177\312\350[\237\361\3024Br\033+vMa\216U\321\026)\336p\320\nPB\3155\266\037\355\253\234\204\367\025\016\037\260\213R\361\262\013&\260\201\314\251\301\007\230l1\331\035\375;\213\215\340(2+5r\002Cew\031\230\370\t\n\376\311\251\265\017\352\177\324\323\177\2536\207!\376\363]F\204\252\0167\211Y\275Hk\250\227\022J\320(\305\030\3278\245\035\222!\376\273|\352\007\221\"\256\320\001\205>\331\026\002\205X\360\360D\300\272\013\233P \373h \036\033f\031\353h \330\365\321<\333\205u\240\253\3031w!\353\256\020\307u\227\006\034]\242\3341\222\244\271\273K7\017 \304\177\236\321\205\210)e\n\210\276\247\236\345.\001\027"
+	.ascii	"AYz\027cfh:\307\341\356\201\006\205\212\250\230k K\317\320\317"
+	.ascii	"fS\t^\0038\344\272\"cX\245.\250w,:\330Z\263jz\234\3107\263kj"
+	.ascii	"r\215KA\001"
+	.text
+	.section	.gnu.lto_printMotorMix.264.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`g\b\325,"
+	.string	"*P\240\021G`\232N:;\\\225\212\007\314n\351%\035\r\363+\242\215\247\232C\366\310>;\006\267\321\221\375*Lo\203\023\213\251\204\2501/\2770\b\f\224\211\357`\220\304`\376\005\033\202\266\361\372b\226F\333\2104B\310\336I\006\003\001\356"
+	.string	"\022\001HW{\005{\365o\373\333\343\016\355!\225'MpPJ\270Q\245\371+\215\232\225\211`\257\366\247|\255\352lT\317\312\314\372E\243"
+	.string	"\346\314\205t\265?\320\r;\315\256\302u^J\325\321`"
+	.ascii	"\355d\254g\215$\366j;\331\337\356\233=J\325\317bt\233s\030\264"
+	.ascii	"J\316\316\244>\300^%\376g\275\232\276g\275\332U\335e\200\262"
+	.ascii	"\262U\204(\222\245\032\233\234s\021\2175\373\324\371\026\336"
+	.ascii	"\252\017\205-\033\\\325\024\337\252>\364\005\232p\236}n]V\037"
+	.ascii	"\246A\033\\<\322\tQ3`\237\273\272B!^`o\203\027\302\274v\234="
+	.ascii	"\n\363\372zP\t\327\327]u\272\226)1\357w\253Ky\325\264g\007\034"
+	.ascii	"\337\363\270v\244\013\370\226\200\r\273\262n\232R\210\322\034"
+	.ascii	"\362\272_\033]X)F[\323r%\\<.\376\334\325\261-@\2636a^`\277\301"
+	.ascii	"\0139\347\276Z]^\357\234w\267^w\237u\007\237\0046\332\310a\314"
+	.ascii	"\354vZ],&\227f\006Xc\261\356\244\237\375\tn\367>z\2277\361wo"
+	.ascii	"\243\343\275\213\236\366\023\375\312{\350Y\336B\247{\007\035"
+	.ascii	"\355' \274\375s\271\267O{\273\247\275-\240\275\315\323\336\336"
+	.ascii	"io\007ho\353\264\267\001\264\267s\330\333C\366\266\220\275\335"
+	.ascii	"\262\267Y\366v\220\275\275\336\333j\360vzo\343\365\366]o\377"
+	.ascii	"\301\0048O\275\264h\023\3679\363\215\3007\371\213:\207\344v\177"
+	.ascii	"\227\377\356\307\373\257\374Y~\272_\356g\373\335~\270\237\312"
+	.ascii	"s\272\337\375-}.\367\362/\317\353!\036\024\310\035\035\016\266"
+	.ascii	"K\335\225vI\"\2263\027\321\031\253Q\305\214\r\f+},\327\362\272"
+	.ascii	"\036\322\271\271`\263$\323\314\366\262\350[Y\316\031\212\275"
+	.ascii	"\222\274xL\242p\2009g\247W\351\317\365Pn\352\331+\177F\221\350"
+	.ascii	"\031`\316\316#H\334k\345\340\377\351A\371\222\205\255V\035,f"
+	.ascii	"\246x{^\222\004\261\230\232\0171\006!n\361\020\023\305-\277\216"
+	.ascii	"\360\020\026\342\"\265\345\034\021\013\341\026\013\305-\377\034"
+	.ascii	"\317\277\267\0253\373\270\262X\207\357\031\304+fq0n\371e\204"
+	.ascii	"\203p\020\003\305-\213p\212W\374&M2\317\276\265\271\253\033\230"
+	.ascii	"\346\b#\233d\320$\257F\346G\214&\237\346g\301\b#\233c\234\234"
+	.ascii	"\311\270\201f\222O\2232V(\302C\177DX\305\317;\2111\032\201J&"
+	.ascii	"W\327\310\322J\016\0253\373`N\204\207z,\221\202F/\314\322\311"
+	.ascii	"$\213IC8D\223\317\t\323\305$#\220\371\t\265\351n\372_\262\350"
+	.ascii	"\307\200,\b\207h\35699;\242\245f/\305\314Nv\3675\220b\344\363"
+	.ascii	"\017\353\272\351\356\024\347K\036 \313\031KB\177\357\205\261"
+	.ascii	"\310\257\b\f|"
+	.string	"`\310\331\305\0040\306W2\331y\333\255\307\027_\251\344\352\006\266\017>~\335S7\315\273g\337Z\034\0317\020\257\005\035\205\200x\002\001\361\205\361\351\311\007\251BJ8\314\3110\265D%tr:\"S\025LRF(uj\211\n\033\337\300\301\003\b(\222&R\fRN\311%\024M'\006 \233^\030\225\220G\251\243\322\323Q**\311\264\303\"jI\t\352)y\202m&\006F'\246b\013\343\322S\221\t\031Ud\360\323G\250&dQ\352xD\026\207\316|,\326\032\200\224\265\001\224\201\257\330\334\250\322\234\303,\234\312\017=\017 \332\r\3641\304\314n\211\264IX}r{\353g\322\234s\026b\346\247V\037\234\204?w\016k[k\224?\200\356\016\346\301\002p\017\322\225\240iO\\\220\2007!\236-o\033\332\341i\323\253\273|-f\366\r\"]\007L\324n\t]\027\374\007ou\003\335\034\f"
+	.string	"\353\340"
+	.string	"\330\007\367\265\332\020\f\242\006\346\207Y\316\312ku`\225'\242\340\352\017N\200\273=\200\270\327\3524\363\200\026\005\2103\322y#\002\300\304,l\325=\367zo\023\301j\035\341\356\200\242\250QTe\2202fjDD\264 )H:\260\002\031\252\352\034\020@\206\314$\205\264\006\332\267\251\372\002\370\033\2049w\007\276fF\337\320+L\337\373\214'\307T.L-\356\024Ah\024\201\225\203\204B\036\323\263\322)"
+	.string	"\0046\220\003\367\315Q\335\304u\212\224\347]\3226\215Q\024\027\035X\330\272=\2535\013y\224<\355\214\004\225\360\2232\226WG\361\004\200:\243\020\220i\t\211\214\212f\031\255\204*\177\203\346\3461\004_\361\276\250H\362\022j\342q\315\"l\231\330\314do,a'\034*\315\2426\245|\272\250\337=3\260\016\230\344\3256!>\267"
+	.ascii	"\362[\254\031\337#\254\215\347\216\002\331\226\336\333\316X\t"
+	.ascii	"\263\3165z\nkcNU\253O}3\333\341\317Am\342w\306m\215y\325\365"
+	.ascii	"\022t\202\200y\230y\220\bI\225\006!\256%\007\341\257\261\202"
+	.ascii	"@x\t3Z\032\361j\210(<B|\212\240\3001\203h\231\324\3000*6\351"
+	.ascii	"m\2001j\t,W\360\023+\262\f\235\023\370\356-\354U+\025\223\305"
+	.ascii	"x(\273\366\303\214\240\002"
+	.text
+	.section	.gnu.lto_cliMotorMix.265.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\240\f%A"
+	.string	"\232o\b\031@@dN:\257[,\324J\243\200\002\324~\320\265\350\016\335\020\200\2125_\241\216\253\376%=\020\355c+\353\315\177\207\240\013\305\351\327\217Q}\360\370\2020h\201\344\306\252\177\246[\223F\b\331;\311z\001h\001\201\001u\344\034Q\020\362\273\266\260\207\326^\315\355\272\330_s:\367u\335\367\367\354\275\221?\201\312\351\373\276\021\332\257T\352\217\254s\210\323\353\367\336\214-0\311\364}\235\016\276\366U\367q\367\345>\347\036\r\221?\275/[\0327\357\353|\320\t\332\257\355<\222\375\332\376\310~u\273\rI\215\275_\022\020M*\263s\364\276/Vn\3537\356n\331\036p\325\371&\252\356\t\f\020\020@\n@\024\022\352h|rjbZR*\022\207\255\220]\247\324\214\013\270}\273W\231\251\243\223\2661\373:\201\001\002\002\250\310>W\b\335oiFm\300\314\323$\016K\301\035"
+	.string	"\034\030\034\365\345\310/^0T\227\037\273@\271`\343\226?\251S~\366\274\335o\271E\255\222RE\357nK-\330IE.\371\222\274\337\362\214\332`\372\206\321\241YpSYZ\0359A,gig\022\252\341I\2129\373\022\323m\271\206\225\212mi\200r\202E\025\303\034\234\226\373-\245\250y\r\036\235\357\251ab\332\207{?\340\267\224s[F\301\255\337r\312\355~\300m\211\206\205\252P\311\362\357~K9\265\002\242Ci\317\033\303,Q\314\223\257\355\223O\225\271-\347\260z+gr\317j\006=?[\230\314\304\324\223\2212\347v\307J\2630\214\215/ \324\360\276o\037\260r\206\346m\340\335xDw\177u\023\357\002`x0\023\333\320\250\254g\233\312\231\312l\355\3408\027\241\013T"
+	.ascii	"\257\367\300\376\356~>\264 Z2\024\n\276\206\030\201\237\304\031"
+	.ascii	"J\311\230\245\326\335\335S\315\315\356\226\302\375\022\354\361"
+	.ascii	"\316\347\004V\004\370\276`O\036\257\373\352{P\b\231H\"=\222{"
+	.ascii	"\337\267B\236\353Q\321\357\362\265Y\264X\373-\330\257\377\013"
+	.ascii	"\266\033F\f\374d\337\356G\362\034\363\nN\311\236E\217L\336\273"
+	.ascii	"\325\235\245\363\275\316\326\220\t\037 S\356}\311\236\344j\311"
+	.ascii	"*(\370\332j\001\t\331@V\366`\237e\320\t\022\303\217Z\t\033\310"
+	.ascii	"\335]7\360\223\317JO1S\301\251X\376\352v\206\375\302\241\263"
+	.ascii	"/\234\233\375\002\007\250(R\322\231\255[k\302\321\374\022\262"
+	.ascii	"\"<\270b\260\300\352\316w\325\237o\252\267\270\247\242\316\346"
+	.ascii	"\215\204:\032_\367~\032\342v\032\342n\032\342f\032\342^\022\342"
+	.ascii	"V\272\336\273(\304M\024\342\036b\334-\306\315\266\270W!nU\210"
+	.ascii	";\013qc\026\3671h\325\321\371\251C4\230\245\316w\311`\2447\272"
+	.ascii	"\302\001\363\347\257\367\263\371\235\177\335\377\352\024B;T\347"
+	.ascii	"\307\335\264\005FhB\356\246M\304I\202\203f\t\314\343\3535\016"
+	.ascii	"_\224)\267w\204P\340\226\037o\323ZqO\270\356\337\365\363\272"
+	.ascii	"\370\225\r\020*1\347kV\224F\tccN\302\003a\251r\246{r\241\323"
+	.ascii	"\223\2512\356\263\200\r,q\315\360\223J\371\320\037\212\222\270"
+	.ascii	"\245\340T\254\n\025/M\2719\350Qy\302\211\2664:d\314\2745\266"
+	.ascii	">&U)*\027\263\362\221\002\271\224A\225\330\334fe\233\317\207"
+	.ascii	"\307\\&V\200NZ2\036P\312,\005\247Y\370O\fvB\005\364\354\276\302"
+	.ascii	"_y\360KTs\327\250\306\362W\02731\027\333\324\360\004<\327\002"
+	.ascii	"\227\206\371nS\231\315YCc\240?>Q\262\374\325\037|\343a\327<\225"
+	.ascii	"\033\227\241\205e?\203\326\260Q\212\200\317wHn\225\253,WZ2\031"
+	.ascii	"\n\334\246\333\026\365|s\nN\305\b4\231\203+\336a\232\220\247"
+	.ascii	"\236o_\206/\364\250\254\f<\233\357f\342\216\\-\355\373\212U\350"
+	.ascii	"3z#\227\213\352zq\301\260.\030\366+\233\277wuR\\\237 \0340<\250"
+	.ascii	"\276\np\326\030\367\r?\271fl\347/NT\214\202\037\236-\303!lV\316"
+	.ascii	"t|W\022\270q\356\031\374dV\376\037\232h\205\367m\257\315MU\235"
+	.ascii	"\272sn\232\226\314\205\232ow\243\232\277\271\250\205*}\217\204"
+	.ascii	"\271\331CA\253V^\037M\265\022[yq\317\210\"67\017\204Ef\255|\304"
+	.ascii	"\213\302\207\214\031\206\007\273\241\b\2727<PC\207\201{S&\205"
+	.ascii	"\353u\0079 \212\242\221\277"
+	.string	"KO\260_'dq\004\206\007\033\231s~\336?\264E\221\226M\n\275\302C\007\022 \330\356aE5\203kF\214\035\"\210\355a\304\006\022T\035@\210\330\220\202\004\210\245\236\021c\007\216\265}p\365\340\362b\333\006\004/\256 ]9\260|\330\250\321\205\203\206\200~\327olq\331\330Z\275|\360\310\\:\272p\314\310\261%\354-\b]8\266\260tt\305\310\201\265\345\325\003\013\002\262w\360\340\362\302\362\261c\207\027V\321\t\366\314f\367\037\021\304$\n\226\303\226\020\360\200\205\016~7X\313\007\005\200C\2124*\"\210\237l\246g\0327\202\323\tjZ\006<\372\277\301XN`Eo\232(\204L\266\337\271TQ\002=S\001\034pw\021IE\006\361\223\215\363\244\210\242axmN\002\354\001\020!\267\032u\314PY\251\276\373X\2504R\307\034\341\220\323\027\236\002\r\003\207\271\306\367\300)\263v\244v"
+	.ascii	"\314)A^\345V\241\214\371\370 \257aP0\f\036\364E\031\363U.\342"
+	.ascii	"1\361\232\302p\224Hq\320\240\350a\320\224\331@\3224\310\334\354"
+	.ascii	"3h\216\013r\253\306\247l\314J\006\220\254\030\234\201\312\315"
+	.ascii	"~\312\013r\021o\215i\f3\001\224sf\326g\305\224\331>\322\267#"
+	.ascii	"\364C\270\300g\031\364\351\352\267{\373'PY\006ur\360\247\254"
+	.ascii	"\264\222VY\2111.\345\356\r8IC\213c\236d\372\272i`$\177X\311."
+	.ascii	"J&\302\200\253\216\270J\374\344R\026\252\221\252E\305\374\304"
+	.ascii	"<\345fW\3455\3549\246*c;R(Q\261\374\325\204\002\200\373\250A"
+	.ascii	"@\003\025SfddF\244I\222\306\300\002\021!*n\003\021P\255s\216"
+	.ascii	"J\222$\303\034>Q\372\335\024\313\370\375\tN\2377\260H\210\316"
+	.ascii	"p\344\311\303g!\233\305\206\271+\n\264\324\303\211\222\220\317"
+	.ascii	"bx\204\364"
+	.string	"\202\251\267K\274\3218\222\372_\003@\244\265\306\212\311\367\302\002\035{\255\027\323\257)\027#\240B(\253\277\022\310\262\247\365 \262L\177\245\272 \342\3420\221\253\376$\345\241\3105[\215\264\370\207u\001\020\321\206\373w\326\323Q<\246\220\037]\223\"]\205\236\013\361M1Q\223\212\022\t=\372\023{#\335\2671\267KR0L\030\326\2059g)\033\025=\274^\330\013\261D\346*\230\246\373\027V\302\001]\242\025\017\332W#H\035B\357ag$4B:\200\305dFK\352\276\336\006\315\246%F\213BX\221\274\3759x\0068\001\\\200\025\265\017x\317\230\200\004\237\314=\274\242\2602\222F6\343(\b:\200\345\266\370D\006\376s.\003&\027@\270\002\216\317\277V\023/\204\335\365#\276\377\244:.\206\273yn6\013=*\263\003B\313\302Gg\355\266S\003'n\312\2575e\263+;\022\0139\317\377"
+	.ascii	"Y\320\266\204\346\362\220\376W\356J\242\242\f\022\264\330Z\315"
+	.ascii	"\002\017%HE\032\243F\230+sz\360%\363i!\215\030\2510\334\346["
+	.ascii	"\205\352<+\275\326\331Z \036\007\007"
+	.ascii	"G\330#\030\321\377\005\260:j\232\200\252\201\300\t\364r\221\201"
+	.ascii	"\227w\213\322\341\nd\345\213l:\016\r\253\t\260J|V\330;\3331\230"
+	.ascii	"\313n\320\251i\374\274K\306o\205C\205G\210\251\036\260\366\177"
+	.ascii	"\357luDI\321\\\227z\013k\334#\355g\251\217\322#\t.5@\026\210"
+	.ascii	"\210j3\245\002"
+	.text
+	.section	.gnu.lto_printRxRange.266.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`G\004E\035"
+	.string	"\326\266\277G\240\226J:\304\247"
+	.string	"|\303\323\360\016m}\347\250eG\346F\252\202\241_=\217O\316Mq\307\201\241\f\325\356<Re\273\003\361\210\303\n1N\236\2470\357\270\n/\0209\200\367\374Z\204U\2465\033\t!\204H\231R\252"
+	.string	"\236"
+	.string	"\250"
+	.string	"9\332VP\231\023\250\340\2425\224\027\217\263\277\300RLP\340\203,]\310\t\034\232\351\344U\345S^4\260\274\332\347:\220\245w)\331e\316\032egs\002}l\240\274\310s"
+	.ascii	"\343\305\360\271\361\242\227\354)8(f\317A\033\324\017\314m\316"
+	.ascii	"\251[,\207\017\201\367\250K'G1\\]\362\301N`K\255w2\204a\353\001"
+	.ascii	"CF\352\0276\240*\302\366\260&\035_vL]t\3610\024\260\266\304\207"
+	.ascii	"\214\024\212\220@\f\032c\037\273BI9\351>\354\t\266\202MM\304"
+	.ascii	"\244\246\256\244\2049\247\365I\252\305]\336\366\013\333Jvx G"
+	.ascii	"\334\302\275\362O\2148\373\261\027\3602\262\346\005\305I\263"
+	.ascii	",U\021\266\035\273W6\260\247k\305\326\203\352\314ke\357\274\353"
+	.ascii	"\017\240s!\177\316\277~\234\213\3357\017\336\271Qm3\252kH5\315"
+	.ascii	"\250\236!\3252\252\216\021\3250\242\0327\252_F\265\013\251.G"
+	.ascii	"5I\252\307Q-\252:T\365\212j\025\325\037\020A\255i\355\253M\305"
+	.ascii	"6\001\316\2507-\223\211\210\246\343b\177\320>\021\177\31483x"
+	.ascii	"\260t1\022<=\340\214\"\261\262\334\270\3348\224\037\342\207"
+	.string	"\031w\321v\320\304g\213\371\024\001=O`6gc\366>\255\223\035\2670\270=\213\2554\257&A\025sJ\256\313\346\326O\313@\3320\242U\3055\247\357O\033J\337\020\202\213/\033`\355\016;\375\223\303I\265=\353\354\313\376\267\245\\\227\237\243\225?\272\306%\227\304\272\241\366\333b\363~\026\244\313\232\323\t\202OVB\310\307I\216\213\343\236k\253\fK\027\223\276Y\301\305\325\331U\362C{\321\223}7\\\233\310H\377$\256\322\f\337\366\254\233\263\341\206Rtqv\227l\363i\205w\222\361\253{\037\217&}sn\277EX7\314~[\230\364\355Iz\001N\352\341I\352\341I\352\3419*qTS\001ih\227$\202\027#t\n#\206\222v\036x@:HAB\036\212\214(\360\202\212v\027\206xEE\273\017?9\020H;\013!\210\222\200J\377,\020\032\372\321\025\t\355\210t?GH\272\005"
+	.ascii	"l\024\202w\244\033"
+	.string	"adt\244\303\001\347\327\n\354eY\032\023,T\230\266\211\334+\273\340\020wV\334RC)\227\f\033A\252\254=\234s\316q\257\374(mT?\263P\247\264\322\026\3653[\237\304x\263P\366ob\314\355\316>\354\027\202YW|U:\26356\030n\326\206fk\220\320\354\247\266\322dvfG,\034A\265\240\036'@B\006\262d6K\250Q0\004\221A\204($3\321\220\004\022\347\220\002\231:\342\016\021\200AE2\265 \345j}\3224\2178\375?\210\024\020Hc\315\212\353\223l\323\360e\013&\030\302;\"{a\227`\310f\231\177V}z\025-$\266\256{\272\0234\020\264\364\004x\3276,\270\261\253\027\234&Ds:\342*H\001B*\351\2050\250\2477\265\022\202\364|\310\246q<\240(\305\005vi7\213\347\360\240-\242`\036\f\002^\320\0262u\250\377I,`\024p\366o\006\304"
+	.ascii	"#\252\"\301\306X[\250Kr\370[}\267\365WG\247"
+	.text
+	.section	.gnu.lto_cliRxRange.267.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\327\001E\021"
+	.string	"v\237rH\320\224M:D\305A\t\313\253\310\032\363\276\001\334\203\002\003\032O\211\257\242X\202\323\256\201\352\206\270\204(Y\217\272\315\254\325?\025\232sX\253s\024\2440P\"\245\n\\\342\223f\332\f \227\340c\n\2074\262\311\226)\005Z"
+	.string	"Y"
+	.string	"`"
+	.ascii	"\342\003+\350>-\336\204\373\354^\302}\232e+\035pm\013\002\221"
+	.ascii	"\031(j\030\331]O\2668\353'nnRY\376}N\002\206\255\237\272\233"
+	.ascii	"s\363\205\n]\272\001\bo.7\006cQ\221\001\241\315f\022\203\001"
+	.ascii	"\336\347\252\"\254Q=\245\354\256\025\fW\334\335m\277\330\226"
+	.ascii	"`\353I6\332\344N7i\213\210\321\203\227\001\206\216"
+	.string	"hL\243\215l\331b\215J\035\373\262V\253\325,g\366{\376m\252uS\237\344J91\230\354.r\354\306jG\2266\215b\230\304\216#98.q\321R\306c\226\303\263\273(E\331\276\332\3479\r\326{L\234\300\356\254\207h7ACN\364\342\2070t\273\257\203\031\272W\312\202O\r\033\364\240J\003\260\036\3134\272\364\310\025\223\261\025P\237\003w\240\343P\221?vvi\016\036\310vp\241\025\222\0241 >\"\330\370\215\224\377\342\323*\226\351\263p\237\377\212\263A\270\350A_\b\251F{}\247i$\222\036\301]v\bB\n\226Q\305\250>\316\037Pf>o\346+Q\275\254Z<\270\244NN\241\254ZR\336\313j\305\305K}1\036\212\211aB\250>O\006\006\346\363P\"\315\267\2253\013K#\323H#k\266\335\335S\002\235@A\017z{\220$\230\214C\240\377\271\016\225)\344\307hE"
+	.ascii	"\254\310\025.$\311h^b\321\302\231R\307\r\256\362D' \220\202\221"
+	.ascii	"\262\362\030\341,\375c\314\212\007\242h\022/\272A\261\264Ka+"
+	.ascii	"KF;\375\266R\362\025\321\007\3131\302\023?8\327\203\341\020T"
+	.ascii	"\262\340\274\177\210\275\266M%\254!\207\370+:\216\365\302\"\\"
+	.ascii	"6\0345Bj\253\271Z\t\020r{e\322H\013S\212_\3235\204\003\005"
+	.text
+	.section	.gnu.lto_printServo.268.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\260\f}="
+	.string	"\nm\334\027@@\242J:{\346\224\331\347\305\365x4YK\311&\007\217\221\373\276R\373\347\274W\03460p;\310\262PJ\202'\203\037\335\257G\\\231\f\300\"\007.\007B\023"
+	.string	""
+	.ascii	"\2431B\b!D\356\264\003t\001N\001k\001f\360\317\340\344\240\022"
+	.ascii	"\036\224\r\0131\370d^\006'\261\240\216\364\235{\276rGx\320'\212"
+	.ascii	"\366*F\260 \355cnP\251=\337 ,\0364\220O\220\207\366a\360\003"
+	.ascii	"q\0220\307_\271\367?\244\020\032l|\337\247\326U\314\241\275\332"
+	.ascii	"I\214\301\220q\220\237\367\222\366/:\236\220\3366?7\256\366*"
+	.ascii	"~\266\317\030\237\357}iw\356\300\356\373\326\t\236y\337'\027"
+	.ascii	"&\320^\245z\323z5\375\322z\025\3434\214\365<\365x\325\024\020"
+	.ascii	"\"\323\374\023\364\276\357\262\361\214\224J\245\022\023n\237"
+	.string	">\217W5\355MLKJIHGFED\311!\267ub\225\253\232vN\303\377\273\225s\215\332\233\246\02063\223\0239)_\202.\311JyO\202r$(\320'\371(\315s\2464/\007.J\372\205\204\360\321H6r\"G\367\"%'R\202\230$'\253\352\344\220|(\315jD\003\350r\340\220\244MA\250\270\035\013\334\221\354\"\036\f\217\261\221\357\261N\216\356m\336\235\322%#\202U\322\255:Y\216\\\315\253\260\300\315e\366kR\256LY pu.\007\216J\332\200\317\236#\017d\313\353\320\025\"W\207<M\247\024\335l1\212\353\221Z%aB\346e\236\337\342\332r?\360Y}\213~\213c\342\210<\263\023\336\367\305\331-N\356\370\351\030\277\020\306\330\211\361\020cw\332\362 \234\373A\203u\347aj!:F\\\337\271\317\304\302\226#\361V\277_\346\352a\037\036\266E\300Bk9R"
+	.string	"\243`\217\356;\214\237j\271\243kEp\333a\314!\354\203\307\032.x\f\226\341\207\307\030\276\346\270\302\023\217)\334\371Kx\341q\204\203\371\277nx\f\341_\376\007O<\366\372\341\361\362h\216\273>\346\230\353\200\307[n\306Zn\306Yk\306\007\334\214\r\254\031c\271\031\027p3\276Z3&\340f<\300\315\330\312\315\270j\315\230\312\315X\200\233q"
+	.string	"7\343)7c)5\343(5c"
+	.string	"k\306Pk\306Om\306Nk\306\3126\343\2465c\2466\343\2455c%6\343\2445c$6\343\2435c\2435\343\2426c\2425\343d\233\361\320\232\261\333f\334\256\031\263l\306\353\232\261\312f\234\256\031\267\232qV3~\207\bk\374\024\301\020\022\354\305\347\033$\022\362\205\243\022Vy\342\177\370\257\371\013\177\303\037\315?\370\217\371\005\177\300\017a|h\372\006^\210>\261\322\006\037\021'\017\361D\201\334G\273\006\237\rN\016\34112\362\tJ\203ox5\023\330|h\210\272Y)\324\201\364\312y\037\347\030}k\274A\030\365\021`\217\fKcJ\365\021\257\345\347\310G\327\347l;\320\"b\334\276\303\312:\306.m\333\341\337\375S\034tj\2737\377\352\366s\314\342\027\325_\035\241YF\304\250~\320\020\356\346"
+	.ascii	":\252\253\001\364\325\\=t\3765Ye\333a7O\345\320\352^\306om\346"
+	.ascii	"\243\363\023\347\003\350\230I\262\366\035\376\231\273x\b%6"
+	.string	"\007\323\260\326\221P\233\346`\343\337X\271\372\r\343?\307\272\325\034\372\201\027\001\230\030\311\244\203\312H\255\324L\255\354'\250\r\\\r\345\324O\201\234\364\232Z\371\247\251Q\364A>.5\223\237\024KzI\255\304'\251Q\364E\037\217\032\251W<7\201\3664\036])\356i\244\353\313*TV\233m\267\223]\324[\215\237\347\003\333DO\027:\276\367e\336-D\313<\034\326U\243\226\320\030\217 \221\357\206\3237I\253\341\2606\3527\013\021uQ\211\337!\332\3638\324I\023g\034\322k\333=\361:)Z\307\307\265Y\025\237\263\3529\323V\233\305\203\356i\026\302X\354r\306\332\367mc\200\017\207\207\036\262\366}\337K\271\232\366\345\372\376<:\265\336\035\326\rm\022\346\273\271\206\006k\214\313\\\344\273u7\237@zp\230\255\206s\177\265\206\376\231\213\300\203\276ajaKR3\223'\275\216\365\253\245\350"
+	.ascii	"y\361\243\030\370\214\f\355\214\314\006\331\031\025\2162\030"
+	.ascii	"hMx\305\025U\215+\252\247\027d1b\210\265\030c\221X\3040\263\340"
+	.ascii	"^@{!Vc\006YQ\331G\320xQC\214\005\331\n%4\030bgb \314l\234\221"
+	.ascii	"\241%]\240\211u\220\001\243\306\212\026\217u\225\275\030[\306"
+	.ascii	"(\023\203\261\034;C[v5a3\031dgK\032ffg\313\344\363\375\337\333"
+	.ascii	"A\303\306\307\306\265fk\352;\354\346-ehuO\371\350\273\372\rC"
+	.ascii	"\276\253\337\307O\tSWg\350\023^\025\342\004\263\224D\241\331"
+	.ascii	"="
+	.string	"\247G\357\225\177\334\353\210\\\362\030*y5\205\302$\257\255o\340Z\222\227\210\377\230\3609\"ie\265\201\326\352\365\357@gy\365\326\017\364\232\207\t\371f\240\017}\n\351,|t\242\341\343\306<\352;\234\340\260\bC\263{\355\243_\366[\216u\331]\347\227\276\357\373\032\365\335\240/\033C\257{N@\266\3050tl92\027am\300Z$*p\325U]\240\327\277\346\034\223y\325\355\210\207NIr\331]\215s\233\005V\321\321\016C\313<\024\254\253\004\346Z\rWh\002\235\304\2633\330,t&f\200\f\031\352\273\001},U=\325\003:j\321\016`s.z\253\256\320\035m\026V\265\200\266j)hs\216\252\253\226\275u\252\236\372cB\006h\001\235\226i\036\231j\251\016\320\354\237&\021\266\254\2666\325/\204\342\f\200\345\250aD\004\215Qf\206FD$I\n\323\032\320\002\221\241)\316\001\021"
+	.string	"1D\216\221\310HA\322Jc-\026\226\272\2342\337\315\\\004\322\266 \244<y.\371b\"\352i\037\311\301}\314%\002\235Z\356\236\0046\2769H}"
+	.ascii	"q!kr\227;U\337\005$\344\224O\303\304_\353*\377\222l\343r\351"
+	.ascii	"\001\357X\177\305\322\266z\004\231\261\236\212Io\202\250\003"
+	.ascii	"A\226<\3144\213\001\272\007h\240\336\2500\344\352\224\321R\f"
+	.ascii	"e\315\257|)\2177\007\003\021\300\005\226\247\221\017\037bY\315"
+	.ascii	"\250e\235\264K\033\244\357^?\214\321\214\301\340\301\337\310"
+	.ascii	", \362\250\240\034\275\022\322\01392Vy\275\325\354\313\324\007"
+	.ascii	"\314:\2320o\256$7p\253\340\210\222|g\345=VV\262\267\301J\007"
+	.ascii	"\331\2447\272\016\251\213r\312Q3\365n\321\017\332\250\334mQH"
+	.ascii	"-\253\254\\\235\360\255(\300\352\305\357\222\001\022\374\205"
+	.ascii	"\271c\205 \207#\254s\316\323Q\377N\266Bppl\310\302\035\251\016"
+	.ascii	"z)2=\002\361g\255\252-\221m^\223\233\376qa\2670\026:l'\321\236"
+	.ascii	"\244R\256y\3671\t\323.!M72\330\255S\2257\213P\200M\231u\210k"
+	.ascii	"\323\021\022\225np\327\030M\217Q]U\"]\261\t1\344\265\241\016"
+	.ascii	"O\307S=X\226\232\345?\003\fz\022\\\230Dk\003\232\330~\017\370"
+	.ascii	"8f<\307\212\007\232xX\212\254\354\313\004\242\216\347\2312\332"
+	.ascii	"/#\211\334\031H1\324\274\342\225\217d\250.\006\034\326$\342\002"
+	.ascii	"\337\020E\324\024x&4}\316v\367\364\257X\244\001"
+	.text
+	.section	.gnu.lto_cliServo.269.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\304\013\205?"
+	.string	"\272n\220\030A@dR\007\251\032\300\026 |\204H\201\201\001`\034\001"
+	.string	"g=\316u\301\317\367\265\2717j\241_\013\216\020\253\260\020\330!\354\020v \327[\315\370\307?\207P?\"`\376\271\326\332\275\367\336I\246\024{\001U\001y\0019\274L'\210\323\343\227\375\213\213qi\017\307\370\234\322\311\350p\270\t\277\205\252p\t\362\210\016\306\243J\017\323v\016\227\301\316\003OU\332\007\303\360\201\327\331\344\352I-t\307\021\254\007\373s\257Z\246\017\206\241V\316v\201n\317\335\376\346pJ\217\333\341F\030V{K\003\303P\003M\365:\333P?\266\316\276\236\324:\333\312\356@H1\370kA\325-\026\343\007\3030\326\263\365\333E\257t\250'\247&&\344\022\200\243R\022\222\361\310\250XD\034\n\203R\257\333\262\353Gee\273\220\354\313\241\236\340\334\251I9\245\n\323*\245\246\344\317\365\236]\326\344\234\274\030\311ei\n"
+	.ascii	")\307(JP\222\236 9q\313F\257@#Gk\325\031\035!\256\367l\262\036"
+	.ascii	"\355\244\355\031\255\n\304\374\314\\\357\251d%Nc<n\345\331\226"
+	.ascii	"\213ga\271(\211\023\325\252\200\202\206hef.t\275'\222#9\310,"
+	.ascii	"+\342R\253+6&\305\365\236fk\326\264o\215\323\371\224\225\247"
+	.ascii	"\\~\247\320\312\212\270;d\013\224\346\355\017\255\354\315\333"
+	.ascii	"UB\233!cE\262x\315O\372\b\032\22213\273^\321\021"
+	.string	"\002\347zO#\2531\355O\324\351\304\362\352R\237B+\363\342\357`I<j\255\352Ss\310\365\236q\353qLJ\323\245\236\235d\313\234\335\n0\fwn\222\225y'\275;g\350\356ewp/\277\326\276\243\261\237\277}\217\205\004\275\253]\237}\217\273x\032\357j\377\327w\346\031\361\377=\006\004\313\201m\300e\264\304\317\357t\276N\343\370\242{\346\326,s\240\303\001SD\313\332\310\334\356\241u3\376\006D\316\323\006\303`\336t3\335\005\334M\210,\205\346&\252\344\r\206\341\2546n'\242\035\212\263=\202\004\333N\242u\326\335D\333}\002E\366f\273\224\212$\217\351N\2110\377\327\332\375(\b\222+Q\257\3266Z\377\024Q?ay\332\305\\\365\335,\\do\372\273\324\335G]\034\350__\330\177uC\227\371\327\272\035\371\303\212[\277Z7\204\254\006\f<\214\267\225\307\271WQ\tp\250w"
+	.ascii	"7\367\224\233;\351\346\226rsG\271\271\241\206\271\237\206\271"
+	.ascii	"\235\336\334Mon&\244\237\361^zs\037\337\334J\302\334I\302\334"
+	.ascii	"Hon#\233\373\210\315m\304\346.\276\271\213\202\271\211m\356a"
+	.ascii	"\233[\030\314\035|s\277nn\227\315\335\262\271\3316\367\332\346"
+	.ascii	"~6wfs\373\004\n\200\226w\302T\273\374\036(<\026\230\b\316c\327"
+	.ascii	"L\3613\356P\3670\356d|\355\366\306\341h\372\203\034\032.\335"
+	.ascii	"^\246\235\256\207g\332.\031\006\205\311\\\266=\2777\277\b\001"
+	.ascii	"t\034F\233\364\037MD\355\237\2269\214\026\351\223\214\217\364"
+	.ascii	"\253\235\001\343\227\220"
+	.string	"\253\373[\235,\3712z\037\300*?\250\356\357\350\327\332\265z\037L\274\235\323;dTD\365\310w\036=W\324\350\213\177\364\256\230X\210\225[\275\321\273\200b.-\362\213\217\024\373\005\306m\212\336\352\375.\006\224j\275E_Bn\214\333\032\260\327\214oZ\244\363\016q\016EYy\257\304\245\247z'\220\2729gQU\337+\021\302\013xg[\340B\324\020\003B\224\207\307\203J\321*\244\372\253\272\273:o\203_z'\2001\2748!\203\177\032\303\003\362f=\204wv\273{\0323{U\242\224Je\361x\351\033\"p\001\317\340\2071\037\036\023K\021\264A?\204\277\326I\226\020\242?\321>~\026G\251\006\177\255\335\177\356\215\330S\352\325\332\351\334\315\306\360\200He}\257\256\200\017\360\3169>|\013w.\307\205?\f\276\360WC1`\273\035%\020\031/\224\366\035\255\263\301/\316\361\3259\217 \360"
+	.ascii	"\237\365\305\230o\216\211e\231\003}\205a\030~\177\355\265\270"
+	.ascii	"T\013\252\2559\310\375\367[\272\002N\365\r\236\005\304<\213\312"
+	.ascii	"\002\276\373\002\206\354M\367\3338\3249yaYm\323>\327)wo\340\220"
+	.ascii	"\373P\331\344-\377+\223\361I\333_k\326\333\256\245z6\212(-Z'"
+	.ascii	",O\037t\361\343\306\006\275b@\322\306\200$\262_\\u\321\270\301"
+	.ascii	"\305\242\013\313\353\205\213\255\030-\234\274f\330\240aAk\305"
+	.ascii	"V\f\0247\220\272\274f\260\220a\303\005\027\212\340\226sy\325"
+	.ascii	"x\0263\266b\254\220\241\302m\025W[1T`\315\330B!\003K\005W\027"
+	.ascii	"\326\325\261i\324`\301\205\345E\203\006\027\326\020\n\346\025"
+	.ascii	"\300~\351P,\033Dmgp~\364\025\205\311\223\216\025\206\321(8\031"
+	.ascii	"w\251\033\373\300\344\300\327\207X\020\247\252\f\365Q/\365\311"
+	.ascii	"\237z\253\357L\246\214\342\246\031\332;{\203a\2467\225S^&\f\002"
+	.ascii	"\316Zy+\253(\257do\366\n\233\375W\033\177*\371.\025\365\016\365"
+	.ascii	"-[\242\271\247,\371\207\237\017g\323?=\322\036*\242\030\320i"
+	.ascii	"K\356\241t\373;\325B<bgz\247\037\262Q\371b\300\243\227,\326\027"
+	.ascii	"\226\227{\250{\224\340\362\327^\206\003\361\232\203\300\272\225"
+	.ascii	"r^\325\372;U>g\r\274\256[\331\346\211B\254LS\247\202h\235\035"
+	.ascii	"\306\3247\315A\306@?\232\356\326\"U\n1\375\232\321\265\332\246"
+	.ascii	"7bs\327\364%\344\334\270Q\205I\204l<\301huJ\264\216\003)mKJ3"
+	.ascii	"\327j\231\236\301\262\372$J\207\320\312\364%\344\354\330\364"
+	.ascii	"\355\001P\372\242e\225-J\247\003\235\177\307_\353\343\033\337"
+	.ascii	"\350\312\325\361\317\035J\346\212\222\261L0\255\232\226\246\307"
+	.ascii	"#\t\220k\265Jot%Q`\364.,O\003eg\225\276\204\\\233.<\374\220\206"
+	.ascii	"\001\200\353\250q4\304\224b\204dDDf$I\2321\240\002\021\252*n"
+	.ascii	"\021P\275S8#I\222\326>\330\232>b\035Jh\351\277\2116\271B\260"
+	.ascii	"'*}t-\013\027\256\243n\006\301\266\377\007N\316\376p\220Z\"x"
+	.ascii	"fj\262\310c\365\004\372\300\251\250\257\032Y\b\277\345)"
+	.string	"\253Q\364w\221!\213\200\247\364\217\031`\362\202AM\206\232\304\002?\344\307n\227W\325V\230\320P\341\273Y\0311Q=\004\233\306\263s<\020XC\024\371:\3071$\002\376\0173k\235[*+\317\322\303\031gkb\334F\031\204.\357\223\200\331b&\222\311g\316\2279\005}4\203\f\033T\tu\026/'\364\316H\245B\353!\212\365\346\353\022%\"\342s\255\211\"\\=\"\363\262\251\376\311\331\264\362\222\330\264.R\354\377LG)R\255\362\325\314\223_Y\337)\217\257&\025\273\236\313\375\n%l\034\300\f\025H\324z\246\275\303\026\241^\246\266\232\303\201\026\346\035$\3758\306\361\340\301\234 \266\246B\224\357\321\247\256\345U\2742\007\311\267\263\036<\013\201(#w\351\320\311\033\206\340\335\227\217e\275\356\313e\350\323\313\224\224\250\207O\275\251\3152\2111)h\2317+\2551\230[\377h\214G\366\213"
+	.string	"\352"
+	.ascii	"W}Y\371{\306\313\247\265\032\342\273G\2146\203!\354\233&o\001"
+	.ascii	"\0305D\363E`\035\331'\364\347\367+\rss\276\320tb\007\362Z?\215"
+	.ascii	"\t[\034\026PLZ\225\374\240\377W\363G\377\221\376\365\027\f"
+	.ascii	"\257}b\206\336\020\262\363\315\367\232\n\f\373|\300#2I\022\324"
+	.ascii	"\3105\354\201\2523\220\203\215\320-'\312\343w7\221\334\212\b"
+	.ascii	"\325"
+	.text
+	.section	.gnu.lto_printServoMix.270.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\037\007\025)"
+	.string	"\372Kx\020Ep\336Q\007\320:\\\260\233\274\361\023\357\310_LR\324\017F\217 \334\224G-\242\3161\270\253)O\005u\333\242\025\016\007\002\323\024ba\212\210\3633\211\356\231b\227\360\360zq\350\261\n\262w\223\275wJ)\005\364"
+	.string	"\336"
+	.string	"\366"
+	.ascii	"a\270Z\244}N\300\361\003\b\277V\243\261\004<\336\037\270\260"
+	.ascii	"\245\0371?'\322\346\302\215\344\\\237\314\234f\243o\327m\036"
+	.ascii	"OZ:n\367\036\031\364\311%\322>;\307|\246\246\202\037[\313\257"
+	.ascii	"\315n\034\351\256\326\226\036\016\322>\371\230\2663\267X\217"
+	.ascii	"\375\232\f\007\253\367~\261a\356=:\340\246\264\317\245.B\373"
+	.ascii	"4\233\b\355\223\177\314w\216t\\ T\313f\210\346\347\336\273\373"
+	.ascii	"0\326\265ylN\375\327j\212CO\363\375\307\215\326L\3102\3016\265"
+	.ascii	"\"\260U\363\337\234\371j8\\CL\n^al\032\331\276U\fz\372\3255\244"
+	.ascii	"qL\272\2044\032\244O3)\016\233+AE\241\311d$\211\227\\Q\207\233"
+	.ascii	"&\2051,N\232m\367Q\3242\337,\315\f\373Vq\350\337\310>\303\226"
+	.ascii	"H1\345W\227\220v\234\205{/;\261\330\325\27463ca\346(\314(\224"
+	.ascii	"D\374\027\374\177\013\255\340\232\323\240\375\376-\254\022\364"
+	.ascii	"\226\233\276\277\331\316\300U\326'\330\226"
+	.string	"\266\314\341\355\277\3213\226\347\037\214\371\b\364\tk\3029\374K\230\241\232\254{\367\324g\335\r\332\254{A\2535;uZs\223\352\234@ufZ\235\021\250\316K\253\263\222\352|@uNZ\235\r\250\316\005Rg$\325\231@\352|\244:\033\255\316\003T\347\"\325Y\300\352L\244:\007X\235\207Tg]\352,\244:\007\255\316@\2523\200\3249\247:\257\251\263\252:\247\2533NuF\335\371L\235Mw~\234\263\343\234[\302\2062\3018gm\233o;\336\037\355\237\353\346LJi\266n\265\356\265\356\2646\231\233\271\303p'9\307\326\003\006\245\265H.\033]\270\2754\373\245\301\374z\315\007\024\032.\003\335nf\336r\222\247\277>\200\017z\335\007x\001\337\364\334r4\340\224\264H\274\304\356\0256\221C*\354\242\202>\213~\367\314\035<x\023\331\274^\017\344\247/\372\036.\211^\300\007\"\343\320\007"
+	.ascii	"\321\311\024C\337S\312Z\245\320\353\222&\204\214@\037\024\242"
+	.ascii	"\223)\200\316\224\271\007 \"gT\177%\321I\023*\232\222,\307\247"
+	.ascii	"\217\013k\333\206KF\321\311\024\351\2757\002\356{\n\222\213\221"
+	.ascii	"\214A\243\377\364\277f\230\324y\213\351\026\323I\251\224\330"
+	.ascii	"b\232\275\321D\346)*o\"\372\237\247\355\343F\370@,_\2575[?\231"
+	.ascii	"\006\177~';m\033\266\254\320J\260\367\224\261\0259\037lL7x\245"
+	.ascii	"%0O\234:Z\376\226FE9\304|0\346\241\346_m\241\243\345o\314\314"
+	.ascii	"\242Y^z\257V\004\363\263\312\372(\311\270\311\324\360\365Y\223"
+	.ascii	"'\3347\320>{\255_\316V\254\302i\251\006\257\252\227d\244\303"
+	.ascii	"\320{!\345\223A\005\304\353(\254\027>\251\025T*\216zWT5x\036"
+	.ascii	"\254f\\Q\205\250\262\302\352\371\246\206\\\364\244<\304\250\362"
+	.ascii	"\251Hy\352\211\367bj\007\203'U\265\233\272\352\355\236\212\330"
+	.ascii	"*\006\325\325\016\313\312\352j\227;\336\376%\274~\241q\223\343"
+	.ascii	"\203\314\344\314\277\261_Y\243\365\232\0042E\351\026|`\233\372"
+	.ascii	"`\234#\242P\177fq\336r\261#oI\366\230\367\336\233\262=\344f\206"
+	.ascii	"t<3\203{0\356d\253v\332\267!{>\245|Z<C\326\344\246\201:\375\026"
+	.ascii	"s\267\r\264\351\241\276\221=b\270d\205^\2765\243'\360\005>\351"
+	.ascii	"\017\374\3223%\270\340\364\t\020<\023\033\205\340\263\220_\224"
+	.ascii	"J\277\004B\351\263\220`\214d\346\0370\360Il\224\001#\322\027"
+	.ascii	"\020\201\364Y\3105\345\321\0238\372,$k\034\360F\217"
+	.string	":\331\321\262Q\003\024\2149\373\3435\326h\317\274\367\253B\263\005\200\207\250qD\345\020bdDDDDS\220f8\340\002\221\251!7\021`Qgj\266\3002\254\001\256\236q9\341\337\367\007RO9\347\323\337F\260iic\276\236-6\354J$\262`3S\223\363\232\303\207y}3I\\5\3636*\365H\221Z!\345\254\274G\375\016K\2511\361\023\005\301\026\"<1\277\210\370=\2502\326\306\342LSR\343\347\226\333\232\341\304\243\003\271Q\252\020]\316\226a7\017Q\274\312\005\261Q\353`\237\254\336MiH\254\025\236\200>\336\021r\245\023\241\003\035\272V}\275\245\225[\200\326\337.\224\241\035 \231\304o^\202\222\2047\205'2T\362\341&[I4k\255\311)\304\001\270\242\341\024\235\002S\263\255\371\243\301\031\216\267,\270`\006R\236\341m\350\233-\264S\017\373#l0\f\274\275\255\331\263"
+	.ascii	"\213?h\260\342BEc\207\222\305L\f\t\313\f?L\204\177"
+	.text
+	.section	.gnu.lto_cliServoMix.271.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`q\037\275\221"
+	.string	"z\356h5J \016\323\032\003\303\260\207i\277\235\021\227\022\\I\026\030\367e\022\277\020J\3318\3252x(\300\333\030\331\030\204I4\205\242\205\343gh\\\240\216\350\324y=\346^\007\020"
+	.string	"\314\247\375e\024\002TU\331>\310\"w\t\221)\245\024O\003\375\002D\003u5\252\206%\274\257U\2014\334~\214\354[\272\t#sul\342U_\331V\247a\"\231\235\240\031\034\232\336\013\022\343\031}]l\221A8-g\202\270o\231\365\0253\2729B\306\252\315p\3471r\205j\026\217\221e6"
+	.ascii	"z\377\336\256b\251\216\031t\261\325Y^Q\027x\207[\f\367\035#\355"
+	.ascii	"\2000\273\254o\025\351f\210\025\356\316\373ZYt\320b\370\311\344"
+	.ascii	"\006\371\203\026\303\304.9<fp?}m\271\3062r\256\351\234]\007\002"
+	.ascii	"\263\347}\205\034!Cul\242\277MT\034*\306\201\255U\265\2208Z\033"
+	.ascii	"\214\263\303\260^\277boG\333T\337\006\337\367}j\"C\035\233\310"
+	.ascii	"t\333\231\033\256\2738\333K\220\016z\337\264/d\336\327:\202?"
+	.ascii	"\034\233\310\326&*6\361\330C\305&:\231\343\034y\275\\S\325*P"
+	.ascii	"\271;\357\373J=\024n\376\343QI)Y\244t\314PD\344\316\344c\273"
+	.ascii	"\326f\251\036g3\035\317\261\034\307\361\225\3030\030\266\302"
+	.ascii	"x\341\242\005\213\025*\252RPM\2418a\242\004\t\251\250\021PON"
+	.ascii	"\"B4\201`\372\340\241\003\007\346\006\r\031\226\224\222\220\216"
+	.ascii	"\214\212\2100\f\t\005\001\375,\225I\244O\317\321X$\272\357Nn"
+	.ascii	"\237*W3\335\\X\263\334\226\343\256=%BtHs\230\242\263\247\324"
+	.ascii	"\031L\321\331\023\314\331Zt\366\214:\214C\177a\350.\362x\013"
+	.ascii	"<\316\342\005_Q\350*\b\275\352\216\247\220\343Tq|j\005G\341&"
+	.ascii	"\231\365\2211\301\361\023Kg\317\351V\0057Q\342\215\033'\341\032"
+	.ascii	"\275\302\252\364\037U\320\255*\034\304\353-\n.\265\246\243\266"
+	.ascii	"ws\316\304\326\364\210\"\r\205m\367\2118\346\245\315I\304\231"
+	.ascii	"\230\232\016\361GM\343F\335\363\246\254\203p\211\330\240\301"
+	.ascii	"q2\353#k7\352\2353\271@r\256\224\221\242\236\300\326nT;\377\360"
+	.ascii	"G\345s\243\216q\017\3065$u}\335\301=\341uGI\377QOp\223\205\320"
+	.ascii	"\300v\243\212q\016.\221\024\267\266\376\243b]'=\273l\357}"
+	.string	"qf]o\330\353c\2361$s\316\304\352ZC\377Q\373\264l\236\241K/\301\375iq%c\214'b\\:iK#\271L\352\233\313t\243n\361\243\277\356Q\033\213\3169\023\343\322F\332&V\r\333\316\304\272t\221\353\201T\240\375G\255\342\272H\202G\330~S\234\210Jc\360\353\033kad\250\364\220\213\302\204\250]\377Q\275\270H\254\035+\275G\202\013\271DaU\244\375G\365s\235\006\313\270\320X)\036\204\004#b\205#|\"\246\244\201z\212\\\245mc\375\023\305\215\312\304\227>U\345\203f\311\224n\213.Z\326\372\217j\346~\030:4\235\267\304\223gbJ\032\231\327\256\222\263'\021\274$\356\363G]\3036\0077*\022\357q\215E\250),\235=\211\270Us\344 \351;\250\0379<\021+kc\337\265\215\265!V8\3023\261\262.\366\037\365\b\262\372\345D\fghD\332u_\234"
+	.ascii	"(eY\365r\373\212\2223\215m\237V\273\374\207\332\2151\336\367"
+	.ascii	"e\227V\305\232\001hf\"\035f\3062#E\t\357\373\276I\3427\330{G"
+	.ascii	"\211\357|hK\264T\177j\244 7(v\364?n.\013O\271\021\347\221\350"
+	.ascii	"7^\017\361\241\035\321vU\275X\306\370\270\256\023q&Yr\374j/W"
+	.ascii	"(\f\232\021\025N\364\n{^\215{\336\030\233\372\304\302\242G{\306"
+	.ascii	"O\375\354\372\246\313\013\0339&J\347\370j\r\2448\343\233\372"
+	.ascii	"C\330!t_fO?dn Ef'\023\207\002\351I\233K3\243j2\314\036\370\227"
+	.ascii	"\323\211\213tv\306\273\334\313\211\346TsB\361\226:\327\212M\244"
+	.ascii	"\212Bg\306\377\367]\273[\352\002\257[\272\367\201R\326\304\350"
+	.ascii	"\344<\330\254\246\370\324}\202s]\025\225\312\b\251\343/;\251"
+	.ascii	"8\331\304\234\035j\323\006\363\212\257\306\376\315&'\266\323"
+	.ascii	"J\261\3054\036'\226\2433\313\361\253\331\324D\347\233"
+	.string	"\223\213\267\324\037\203\230\0212+\346\346\356\210\257\306\314\034\234\333\371\245\330c\372\216\325\307Ey_!-\3551\314Pmg\306\033\2619\274\212\201{\337\267\252N\273P\203{J\023\371\306\025\221\373\252\330\304n\001\212\314\004\030\340-\345!xF\254\204\203_\035\345\204+n^3\361\375\264^\317A\240\207l\016\317WK\0238~M\320\324Dv]\202\317\361Sf\346\247n\340\277KN\316\325M\227\027r\177\003\337vPC!~\310D\236\343\231\031h\300[\332\337\330\3560<#T\302\301\256\347b\266>\233\205\0341\256\1775n\347\320\204N\021\3764\346\246\266\264\301\272LsG\333\253\237\315\025\302\007B\316Z\033d\371\270\240\275tK\320\201\315\020<\320a\232\033h/\3159\3329\200n\323|\325l\3264\337\350\276f\033\215\246\271\006\215\266k\236!\303\n\3109F\2203\214 \347\027@\316.\202\234["
+	.string	"9\263"
+	.ascii	"r^\221tV\221t\256j4\315)\222\316Tm\246y*\351\214"
+	.string	"\242\343\232O$\235Mt\\s\211\2443\211\245\263T\3229\352\307y\304\322\031j\351\374dtvZ:\213X:\207X:7%\235A(\235\231\224\316\037\222\316\036\222\316\035\224\316\034\224\316L\245\363\206\244\263\006\245s\206\245\363\322\322Yi\351\234\224tF\372q>J:\033-\235\213\226\316DKg\fK\347\241\245\263\320\3229(\351\f\244t\376Q:/\223\316J\245s2\351\214L:\373$\235{\222\316G\244\263\321\350\\D:\023\223\316n\322\371\223\316\216t\356\036\013`\356\n(We\373\255\365\r;\304\363j\211xl\035\330\335\246;\205n6\335k\272\373\272\317t\243\3516\323]\246\333\256;Lw\\w]/\231{\357\260l\317\260l\357*\317\005-\310\237\227\rl\323)\364\366\314\325\330\230\022\336\227L\031%\202v\031\370\254\231Y\337\254\006\344\276\202\215c\303\375\327\227g,:\250ed\023\327"
+	.string	"q\337U\244\200 Bz7\341\352'b\013\035\023\322\367\223\353\232./\034\201\364\032`\317\020\342U=\221~x56\266\216\342\321k]\375\214\376\350\277\016\324\321\350q`\317\360\234\030>\017t]\004\017\313K8\370|.\016\242\223\327\201Y\343S\374\224]\246\325\227\370\251\327u\321\033\271X"
+	.ascii	"$z\f_\364/\007%\363\022O\364\037\256m\350\362R<\206\307\201\315"
+	.ascii	"^\267txO?\344@eL\t4\273!\204\0172v\004\232\325\260\301\327\370"
+	.ascii	"i\357uO\227\261$\320\354\206\017z\326\252Z\240Y\rOm\365\323\035"
+	.ascii	"\305\241\237!\364A?\364/\364 \236m\350\266xZ\327\370\240\317"
+	.ascii	"\201\265{n\351\362\034\f\314\027fO1\2332\327\334z\232\331\024"
+	.ascii	"l1\204w\276'oZ\240\307\323X\326\303 \370~R\026\034\360\032v\315"
+	.ascii	"\254\267\024\350Ah\002\325V\377\301G\200\265\273n\347\314\236"
+	.ascii	"\335&\204\272\201\001\3574\215\246i\346GP\332i\374Ks\253\201"
+	.ascii	"\256\251\211YzM4\336\322\r\202\n\237X\321~\355}a\323\360j\\\202"
+	.string	"o\251\271\336\270\245\310\243}\343\247,\355\033\377[\232\255\016\224\f7\276\271~\307Z\230\235'F\264\317\347\362%\276\244~\276\261\320\310\243\r\300OIh"
+	.string	"\376'n\f\232K\331\310)\275\032\023\371\220\330\2714\267MG0\256\251\211D\276#\366\267\346\326h\0026\356\016\230\246&\006\360S"
+	.string	"\276\237\237\265VF\027\3007\240gqb\331 \330[\230^\317\345&\275\232+\263\224\025\"E\373\347\333\204\353\233\345'\377\347\223\374\240e\312_~C\r\001x\250V\276\222\334\027\236+\3154\035D6\246\213\252\003\231-p+N'\276\241\315\335\232j\212ML~\307\271\361r\343\221\337\177\275"
+	.string	"\266,\033\247\215\316\321\253\361\215o6\316\326\364k\2569~\265\t\332C\255\227\022\2662F\0068s\023\260\331f\257\203\336\240\021j\237E\257\306)\220`h\2577n\031\362h\333\370)\220\242\215\377\277~0j~D6\276\275\336\307Z\030\232\027n\343\033\005\227\342L\222A\260\204\366k!1hv\236\212\026\212!\215Cin\215\334\034\277\232\212\nK<&Crg\206\202\024\263\376\343\350"
+	.ascii	"\257\234\331"
+	.string	"\254W\314!\2479\307[\232\365\275\327Bo\320\374\264^\f\307\313K\310\307\330\244\331\302\261\316\361\253\323|\310\304\226X\t\007\2354\241\022\364j`M\343[\372\235\327\t\254\r9\3742{b\227\244\351\001\271K\032?\365\323\316S\335\203f\227\305w\372\251\323\267\236/i\332a\022l\022\036\277\372HS\363\005\347\324\321\340\264^\317\305V\336\363\314\315C'\027s\352{\344@\223\356\226\264\360s\374v3~\361;z|\346\327sq\203\275\361\221kD\266P\303\007T!L\335\362\205\267\236\2279\275\240\242@\217_=m\002sN\213\360\222,\221u\321\242\344\003j\351g\300;b\210\364h\323\370)\265\213\337nM\027\\\004'\221\343\373vU\261\2179\2313\314\255:\307\212c\305&\026\337\260\016\316\033\236\020?t\003\314t\366\341\254\345\314dn1\365\024\231\007\3233\017\246\036=D\336r\306\332\322\302\342"
+	.string	"K\353\310[LL\036X<td\r\340\3035\b\260*\200I\343j"
+	.ascii	"\253\005\n\270R2\017\035Y\030\020\371\007\326\026\226V\221-\210"
+	.ascii	"\332\222\372aA\005=0\240@\211\333\003,\036>\256\2628\320\302"
+	.ascii	"\332\362\301\332\241\005$"
+	.string	"+\201\037@4\360\321\003\251\365C\003,\016tl\031\265~h\360=z\253\002-\035\356\005;\260,\330A\364\201\205\301c\371\350\201\001\217\fv\030yGT\017\fvH\371\350\241#\003\251\035Z[RQD\234\245\001\226\226\324\217\254,-)\244UH\177\032\307\020\362\317\"[\237\324\033 \324\031\003\265El\200P\327\215\355 &\034\031W\215&\322\220\"\002\230\031\202\237\206\300\222\340\033)Um\214\266w\202GN\023&*>\306!\f+\277\344N\034%I\252\036\206\235\027X\376\b\235\025\312\214P\375\2137\3022\221\343\"\313\2130\b\207l\f\305\273\370$0&\333\026o_mrAve\341\250@\r3\361-\336\310\r\2235,\272<\021\3017C\246$\236\305+a\231\240\201\032\256\370\362`M0\310\256l\240\033\346\346\334Gg\020\211\234\374\327C\255\212Q\277\3425\2001\311B\r\221d\274\032\253"
+	.string	"d;+\025\177\202,\373\245\005\025\217\003\213\307\205\304x5\256z\252\377\263k_\227\027z\027\214\252/n\364E\325+\273\262\\\376Y\254z\034X;,\270\300\323To\214\313rQ\006\266\240\372\037:\331,\317El\326{\"YV\213Y\027\243*,^\215\373\020E\226\253_T\337\n\024\257\314\313Z1t\233\210\202\263e*8\260\247+k\245\315\332\252\224\230\370\022iY\266(\023\217\003\353\302\233\303\375\245\270k\022o\f\314\262\271\204W*\022\257\274\222%A\f\t\302c\033\340\224\263\320Qo\244\223%\201\201"
+	.ascii	"\347PD}\317\225,\224\250\307\201\255\363\326KY\352\234\370i\035"
+	.ascii	"\305\021\020\374\210G\202\231e\227\004!x\034X:NZ\370L\244\320"
+	.ascii	"Wq\322l\271X}\376\356JH\311\370\023?\355\266\261;hV\252\351\245"
+	.ascii	"\240\244\376\351\241\216'\376\351[\f\273\302\225\304\0364\033"
+	.ascii	"\345\343\033\313\230\0354;\342\201\277\372io\263\320l\324\005"
+	.ascii	"#\236Z\206\210\020\337\364\"\2142>\304\3257}\016\354\026\220"
+	.ascii	"MTj\320\343\332\307;\037\2246\020\205W d\374\005\037\001v\373"
+	.ascii	"U\344\264Q\202\275m\232)\022\024\3647\315m\223\340\003\337\333"
+	.ascii	"\356\021\360\336\310\020\016N%Y\033\361yc\256\230u\3514y\254"
+	.ascii	"PA\334\367=\2031\030\306\0179\2026\315\026\212\004\233rP\306"
+	.ascii	"\264]\317\365Oo\236\274\200\342:\202\023\023\033A>\355\232\017"
+	.ascii	"\317\341\231\312<\374\207\016\357\341\217V\200\"\351\360Hv~\202"
+	.ascii	"|}j8\374\225\337\021/\310:Y\021\314O\263\207\246\245,l\370\f"
+	.ascii	"\317\374#=(\231\206\337\200\364P\255\341\217\362|\341\321\003"
+	.ascii	"\242\354\262\323\252a>\300\363\314d\370&\203\355{\363\"\304\017"
+	.ascii	"\213U\027B\220i\255'v\331}\271\272\021\202\3125\275\032/\275"
+	.ascii	"Q\372\244_\372\206\222\305Q\372f\241\037(j}\322\273vP\274\247"
+	.ascii	"\2539\251\017\034\247h=r\r\211\235)\022\245\202\207\250\342\b"
+	.ascii	"\035\315\242\244s\b\315\310\210\214$I\032\003\342\n\020\006$"
+	.ascii	"i\036\267\330\003\022 \225=*-#\231\221"
+	.string	"(i\rB\" \\X\264\177n\300\2328\023\226\233p\324\331G\201F\352],\273l\005|;\363\256t^\345\267B\374\301M\307\360\234\246\346!\321\264\360~8\315\fj[\221K\013\362<\204\345\303[\222a\267\207\332#\f\222*\021\306\235\362\220{\206A\315\"\313\233\240C\bC\2325lx\377a'\025S3L\241\253BxU\321\371\233\251\231O\311\034-\363\277\037\021*\003\321\252\\\032\357\361\235m\333\337\330_\270h\302\355\357\325\3468\221\234\366\241\346\335\0139\246\354)\373\235\240\246c\344~\017\227\026\255\023\210\024\013\347|\355\341\204}%\257\343V%\317\034R\304\245\317\341\340\002\356\3143&\232\326;\321\315\325\3016\371\032Y\0245\346\267@/\314\337\216\326\227W\320ZC;y\261\365J\023 \r\330\"\232\b*\367\244\212\242\325)\321\353h\006G=\030\250\305\374/=`\344p\004\3043;\322"
+	.string	"#\235\374\024\361\300P\372\313j=A\f\275\262\272\220E\214\234\261\303\220T\253\335aD\020\211\220\001\334\016U%T\206\031(\216)W'\247q\376C\013\355\251\037\316\001$\365wP,\006\241tB\210@!\200e4\004\203\303|?\207\340{P7"
+	.ascii	"\005~\204^#\215tz\341|Le\034g\231p#mr\322R m\016M\0016\321+\342"
+	.ascii	"\263\316\247\225Eg\306\350\267\214\303Q\271\215\2129wM\354\244"
+	.ascii	"\305M\302\270e\3362Q\332p\002\004\307\002\265W60\3232\255%\020"
+	.ascii	"M\316\370#\t\330\2701\361\304\353\233\004\333\34740A\3707e\356"
+	.ascii	"\322\260\357\360\311\313\367\357\336\307t\353n\333\336\362\031"
+	.ascii	"\253Q\206'~\027\244V0\275\265YY\f\357\034S\217J\331\303bM\360"
+	.ascii	"\332\"t\220\035\264\200\245\fBB@d\\\236\177\214\220\304Y\020"
+	.ascii	"\326\354\340'\2221,J#\006\201N\263M\177\227\034\207\335n\231"
+	.ascii	"\342\232A$\334}\234\205\344t\233f\343\375\210"
+	.string	"\240\233\004\024\251\270\324\032\337\306j\225\007\365i1\031\027\024b0\026\237\352\273gY\337\233\004\331\b\204w_\352\032\026\264*\302\306\202\255\323\34621;X\351\241\216be\233\200\312\001\262'\231<\204\224\210\024d\2709\343,\007Jb\301\251\032\022"
+	.ascii	"\277+v\356\345E\366\310n\260\213<l\222ay\013V\314\237\002\bZ"
+	.ascii	"\234,\246P\335r\"\300gw^EH4I6\250x\263\214\357\261~,\353\347"
+	.ascii	"k\274\t\265{\027\330\3173\021QV|;\273F\2000\nw\242\342\311\210"
+	.ascii	"B\246\213B+\266\034m-\203\246H\325#\250\240kn\204DnZ\273\311"
+	.ascii	"\264+\320t\333/\365\346*\255\030\371\033\312\333S3\257H9h\215"
+	.ascii	"'\253\362\303\263\352~\261BQ\253\346\260\214\317\200\234\254"
+	.ascii	"\023\305\301N\324\b\357M9\237\344\017H\351s\024\240\020\344I"
+	.ascii	"\201\033\233\177\306k#r\001Y\371\205!\201\326`&\206y\367\317"
+	.ascii	"\256Y\261\2003\354S\317R\343\331\210\326\211jW\351Z\177k\234"
+	.ascii	"XYW\n\252\"\240\321\246\207\031\365_\021\"\336\355\264c\231\210"
+	.ascii	"\360Y\233(\302\376II\tFoL{\222\271\020b\223F3x9\271 \362\312"
+	.ascii	"\254\350\243\250\021\355\240\272\221\216\226\006<S\016\231\204"
+	.ascii	"\275hc\007\242\021\264:\274mf\304gP\350\301Fj+J\257d\270\314"
+	.ascii	"\244&\232\024\241|\203\336\001W\2311\247`\272\326\363\316\353"
+	.ascii	"\016\314[\f\bo\275l\314\375\260\231\210tl!\257Kd\300gY+\367u"
+	.ascii	"i\257\300\002\230\260\3370`\002\bh\242\251\2624\260\202\337\206"
+	.ascii	"m\017\224I\213c\342\362\270=\347\334\fy\271|\302\353\\#\357@"
+	.ascii	"\013\234 ~\372\261\022\361s8\325\022\2613}\3013\006\266\343\023"
+	.ascii	"\202\355u\370N\360p\t\333\320S\366,\373$F\226\255\037\221y\033"
+	.ascii	"\r\337\276\005\361\315yk}\321\264\313\327j\324\b\377\317\320"
+	.ascii	"O+\224\242\352\274\267V(\346x\302\235\033\364\037\307\260\263"
+	.ascii	"\306\233=\250k}B A&\214h\306\321\272\314\370)/O\312\310\0049"
+	.ascii	"y:\254!\b\013\205m\205:\342@\260\342r\250\240\232\210\267_P1"
+	.ascii	"\271\327 \356\375\323\001Y\270BC)|\354<\353\030\303\211\314\232"
+	.ascii	"\f\t\203\002\350\337QB\003\001]B\335\270\313\326_f/7\033Q\254"
+	.ascii	"\376\213P\3459\25166\221\367n \315X\021\310\342\251\356\034\253"
+	.ascii	"\016\257\252)\0336\303\345\b\263\234\353-\322\204Z\300\001`\207"
+	.ascii	"\020TG\253\366\034\001"
+	.text
+	.section	.gnu.lto_printName.272.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\252\001%\021"
+	.string	"v\241vF\360\320h8\032\317\330\f\322J\314\262\350hj_\177\177\274\303\001Kv\"\036>\352\326\3470\270I\213l%\326p5\370\2515\375nKl*\017\243?\252\202\215EV\320L]\034#\"\262\2071~\223\275\267\224)\005\\"
+	.string	"]"
+	.string	"c"
+	.ascii	"5\036\321\024\376\363\030>\355\347\334D\354:\033\354\261+\202"
+	.ascii	"\305\317\356hr\201\360_\351 \340?\357\004\300\177\216\3317B8"
+	.ascii	"\254\254\004Gc\313\025\355\356Io\036\273\247\031\363"
+	.string	"G&\036\342Mv\317\3035\300\215\346\225v\367\271\247\314\255\22692\331]\247x\353p\177\267}b{\202\235_\377\256'\222\001\003\247\233\345\316\036e\2516\366\275\335]k\215}\235?\004\323\243\367\334\340w\376\017L\353\227N/\375\217\013@\264\0319\\\b\2451\356\314.\307\006}\272\022\357\371\355?g\222\023\224\304\336\243\241$\033wfd\303g\314)\332\035\017\3743\003;\307\237\210}\007&D\300\006\2731\027Qa\314\211\310\277\324P\355\224*/\272dS\231AM5\331v\314r\347yj\343\"\3451\206vk\027[\254.\2043\322\213\037f\271\313\334]\231\252\215\357\363+\005\241\033\236\032\265\304a_\005\274\202z\0356\035-w\b\276B\245\301\320\356.\260[W\341\nwk\nR\300ZH\206H\300\200\0016\245_\006J\252\026j%\204\261^P(\252\007/\026\352\245E\005 e\205\262\342r"
+	.string	"s\261V,$\225\027\n\002K\353%C\350\324\310\212\225:\255\254P\255S\312\345u\032\001\261\213E\345r\202\271\\.'\322\270\367Vk\234:R\020\334\b\333\213\364u\025\"\200\310A\223c!\214\221 \362OU\346\203\b(h\2464\017H\325\243\370\017\006\022\234\034"
+	.ascii	"\357bT\215goB$\275\276\017\263\220e5\210p\b,L\006\037c\344a\203"
+	.ascii	"\235\210\232\2531\306bLk\310X\337\263VqM,\230#\342l\be.\260\277"
+	.ascii	"\251)p/\230\232\002\334%`\300\242\312mW\321\003"
+	.text
+	.section	.gnu.lto_cliName.273.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\036\002\275\022"
+	.string	"\026$~H\320TQ:8!\362W\213\334\333\204R\2706\311\232n\265V\200\355\322>\320\222s\031\351\326\276k\315\332\342\177\177\027,\355\325\342\033\332+<h=\030I\016I\031K\255F\207)&\214\270\245f\256\2202\333\310&R\246\024g"
+	.string	"c"
+	.string	"l"
+	.string	"\322\013J\227'\337\325~\317Y\300\356#\342%s\336\254\030\232\023\247\342\003\245K\343~\002/K'"
+	.ascii	"^\032f\3730\241\315\030\003\236\234\031\335\2209\247\270'\016"
+	.ascii	"\273\374Va\376s7\331n\261K\233\177\341MF\367C\341\301\020\"\340"
+	.ascii	"F\373N4:\266\347\256$n3U\222\2039\247\325v\253\271\301\333\276"
+	.ascii	"`;\202\255\255\253\2339\"\323\321&\005\327vy\320\333\276\333"
+	.ascii	"\353\341\330\311l\314\306\315tq\354\177s\316\351\275\261?u\b"
+	.ascii	"\252M\377\271I\367\371\301O\275R\255\237\372\001P;/l\036d4'\315"
+	.string	"hd\356d\214\235\377\334>\220\035:\304\201\f\340F\216P\237sh\343\356\002\366\237\230\317\232\371\021:xtxs\342R\036)\204\204h\324\202\314tl\2603R\361-\216S\256\373:i\270\007\372\020Ki\316\332m\026J\265\025\004\227\0302\350m\272\317\275\244\250\007dW\333\230\007\214\3438~\303\265\316\230\230\351h\022-\271\211\300\224\373B-+\017J\3719\227V\255\244\315\342\240\267\371A\275\037\273\332Q\034\361\206\3261 i\227\266\243E\256HF\217\374%m\336\200Z\261\\Z\256\224\230r)`\025m\251^V\325b\275h\200I\221\234B\261^Rb\213\325\002#\246^\037D\324\311\256\016\252\227\b\302\345z\211!N\366o\356\215YJ\354\210\360d;\263\001\275\356D+\005G9<z\346\224\325\270\215\007_\201\227?\004\320\2260\001\245WdG\223&\272\013\256?C\006\205\n'\246\335\036$O"
+	.ascii	"\222\326\264\327\335\024% P\202\"5\310\033\221,|\002\217\211"
+	.ascii	"W\247p\344\"\260\305\202lY~p\254\332\310l\256&w\005\355\210\033"
+	.ascii	"\202\301\204\003{E\207Y}\206m\221\3214\"\214\22190\033\264\303"
+	.ascii	"PKh`b\244\326\302`\314)\243\372GK\0370D\206+\362De\272\\\\\223"
+	.ascii	"W\232\253:\314\036"
+	.text
+	.section	.gnu.lto_cliBoardName.274.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`!\003\265\030"
+	.string	"\246-\243I\260XQ:\360U\024\007\301\363%\246a\212\324\345\351\224%\265\265\306\022\nF-KDbY\bJ\373\264\325\227\376\360\364Nz\247\353\2534\221\272\232A\201_\377o\317wZ\262\263\201\201@\207]\342=\376\225\264\275\211\224I\006\217"
+	.string	"\201"
+	.string	"\214"
+	.string	"\313\200\374,\307\363\356\201<\b\357BP\034@\255KH\240j\0256X\005\344\347\nOC?\311\007\240\237\313\333\3352\200\250\366\036\374x*2\362\245\326*\353\033\347\235%C\32296\363\366+\234\004Q^|W\222\004{g\255pd\020\3240B:Is(\021\002\251\252a$\343t\2164RJY\\A\242q\001\215\250\027\255\340\217\307\030\255\340\020w\025\027HcYk\275\323yE\320\307\274\302\251\265.\003\203F\337\326wwiwM\354r\230\007rwH\362u\357\\k\355\365\236\240\257n\"+C\234\246\206\030\314\276_\335F\212\306\244\340\342\222\354\352]\022;>\360}"
+	.ascii	"\006\322\260\212j\250{\273\302\0367\323\356\307\332K\273\315"
+	.ascii	"\013{\323\367u!\277\353\274\344yW\223\227\236w6\357x\336\036"
+	.ascii	"y\271yO\200\211P-X\034\375\211K\255-\212a\352p6\331\361\246\177"
+	.ascii	"\367w\332\326\256\360Dxo:\361jT\257B\352\307\022\252Z\2056\237"
+	.ascii	"\001[|x)@\301\302\247\210=\206GRJY\310\001\274\352\027y\023\f"
+	.ascii	"\177\302\222\201\374y\210}\276\310\241v\f\340\250\365w \007\362"
+	.ascii	"\347 \366\271\333\301\003\037\270\345\252\237\204\310c\270S4"
+	.ascii	"\242^P\233\323\236\001\003\200a\355\352\331\273<7>\2206u\222"
+	.ascii	"\364\233M\211m\323tD\312l\246\205\365\330\334\205\344\036\373"
+	.ascii	"T\222\\\274\233\013\301\007v\337\351S\314\276\212\305b\361;\205"
+	.ascii	"\276a\275\\\024\303\307E\376(D\271o\243\305\273\"t\034\273\253"
+	.ascii	")s\272\333\017\017\210\240\033\320\007\327\326,\314l<\022tf\027"
+	.ascii	"\"\2646\266\253\211\225\020j;\025f\033J\r\266\232\216\316\016"
+	.ascii	"\255\274\221P\313\261\315&\320\312Z\204R\303\005\233mF+w5\013"
+	.ascii	"~r>\235\373\351\361\001\241\303\255\026w\323\343\203\223\375"
+	.ascii	"\364\334t2\\\320NvC\263@#rA\262\022@@A\262\226\260~\254\275\264"
+	.ascii	",\"\223a\212\366\261\310)\274!\002\260\314\310_\b\032\021\331"
+	.ascii	"3Qf\f\253\250\372HJI\213L3]\210\356\237\034\212\320^\307\326"
+	.ascii	"r\346>\207~^FT: \200\002\021\232\344\r\237\030\363\342\035\314"
+	.ascii	"p\b2l\20163EE\323l\204\270\006\206\212\307\223Q\274\264Q;.\036"
+	.ascii	"\202\305y\315\301\276*\263\177\232&U\322\254\3531>{\020@9\224"
+	.ascii	"r\231<\260B&D\273Q\314h\r\310\030\036I\013\035\013\342h\342n"
+	.ascii	"\tln\201\353\003\fx\020\202\2426@c\270\361\023'\375`Y\326&\362"
+	.ascii	"\326+%Az\207D\305\372\203p\231\"\362\345h\022VY\300\023\366\204"
+	.ascii	"\036\007\\\006"
+	.text
+	.section	.gnu.lto_cliManufacturerId.275.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`+\003\365\030"
+	.string	"\346m\244H\260\226Q:\352\321#g\013\006\276\315<\343\275\305\323\263\016\005\361\334\273\006\r\272\343\215f\363z\357?\250\371S\377$\224J`\207\365\363?L\023\f>\211\277f\376\207y<\305\346\323\207\\\371\346\257\260\376\021\2737\2212\311\217"
+	.string	"\202"
+	.string	"\215"
+	.string	"\237\373@\374\034\303\363\356\215\374\310\356HX|@\255NP\244\324JB\330\006\342\347\222\257\241\237\342\t\320\317\335\375b"
+	.string	"\251\362$\024\251Jb\"\246\326\032\353\036\337\3355#\322\0316\357\366\255\035\006Re\217\213\023 \357\256\326\316\314\202\035J6.\322\037Q\256\214`\355P\272q:\303\032\252&+\030\020)t\220Cj\306\013\350\343\260\306\013x\304\275E\206\215p\254\265>\352\374\002\330cn\355\324Z\227\177@\245\357\353\273\353\264\273\273]\316\n&\206\370?\356\020L\275\346\235k\255\274\336\025\224\246\033\211\313\220\250\252#\036\263o\232n&IeZp\271\"\303z\027\205\216\377{+\240\201\203\304\272:j\336.\311\343~\332}X\333i\267ym\016\365\2459\222\037v^\361\274\255\311K\317;\2337<o\207\274\334\274?\300\301\254\0300\226\036EK\2551\312\254:5\247\b9\324\277\373G\355k\227\274\222\335\241V\274*\325\273\240*buU+\231\023{\036\372\371\033Rd\210\204A\220a\303\253\202\301\251%\252&+\321"
+	.ascii	"\267\372K>\245\303\237t\361 \372D\340|~\311\245\330\022\370\250"
+	.ascii	"\325\367\037\b\321\027\001'\204\b\376o\307V\337I0\313\324V\345"
+	.ascii	"\220\232AsN;@\220\001l\323\260\236\275\373\003\304\377\321\246"
+	.ascii	"Y\230|\263i\347@5\2712\373im:l\006#r\207}-L0\336\305\225\340"
+	.ascii	"\377\272\037\365Ifi\312\262,\277X\350\333\246\227\223j\364\270"
+	.ascii	"\344\207F\224\373<^\274\033\253\273\031G\004\375\344p9\025)n"
+	.ascii	"@$T\020\001\r\021\330\n\030~zh=6\237\231\314\202\255&\333 `q"
+	.ascii	"t78\343\004\232M\203\354\303\350S\243\365\364\330f\243N\005\032"
+	.ascii	"OMva6\322(\214>\034j5\331l\324\3358 \302\t5\216(Hh\304\320\255"
+	.ascii	"\2657\235 \241[\214(\bh(v\313\351b:5[t\002\227\213\245(*\312"
+	.ascii	"\305^d}X\333i]A2S-\272\347\022\261\354\222\024\350\"\023}B3$"
+	.ascii	"\261\001X\321Ab]\365\022U\223\227\231~\272\021\335Sy\025\243"
+	.ascii	"=\220\245\361\314; p\002\021\232\\\017\257\030\203\343\035L8"
+	.ascii	"\204\035\266@\233\235\242r\3235\2328\006\206\202\307SP\274\304"
+	.ascii	"\250\035\025\217`q^s\260\257\312\354\377\246I\220\204\341\r\177"
+	.ascii	"\254\315|\366(\200B(\3442q`\205<\210\373F_\3432 xx$-t,\210\243"
+	.ascii	"\213\273/\260I\005\256\035P\300\343\020\024m\001\272\341\306"
+	.ascii	"\2178(;X\226\247\t\276\276\022\341\230\364\016\211\212\365\007"
+	.ascii	"\3412E\344\313\021IX\2620O\230\021z\034B\031"
+	.text
+	.section	.gnu.lto_writeSignature.276.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\317\001\005\021"
+	.string	"\226`qF\340\322&\035Sw\303\332in\364)\312\312\373\257\302\225\231\264vtl\306aO\315_\313yx\356x\313\3537\326|\357.\240\307\n\232\206\030\214 \206\365\331X\037FN\346K\306\242%\321\032\372\"ido)S\n\\"
+	.string	"X"
+	.string	"["
+	.ascii	"\005\270G\177'\331\036\271\017\330\036\315\262{\020\220\331\026"
+	.ascii	"\203\235\031\227\314hw;=\341\222\303\357\206\311z\204\232,\277"
+	.ascii	"\347\020\207\006\344\025k=\302\033\215 :\305d\340\003W\216\017"
+	.ascii	"\237=a\261\230\204+j\256\237=\342\320\202^\261\232'\t\302\356"
+	.ascii	":_1\232{\273\355\225\355\bv\002\b/]vsO\2234\275m\351\030\323"
+	.ascii	"\020\2465\323\251\351\217\240\340\370\001q\232\215]\017\265!"
+	.ascii	"+\024k\250\270\354\366_\3703\227|\237\303`]f\362\245\331\317"
+	.ascii	"\244\330\201\025\355~\b\036\335\200{,\201/\331\316\357%\210\202"
+	.ascii	"\247\375\026w\301:\017\207\007\330\265\231Ac\367;q6K*\377r\211"
+	.ascii	"\247-ojR\222\036\310\313\211\272\351\363&\033\247Q!\221\307B"
+	.ascii	"\025\352\201\\G\276\214\r\0308\024\376\313\366\250z\230\b\230"
+	.ascii	"\254\371Z\322\324{91Y3\247\327\317>\001F\323\341:\202\311\232"
+	.ascii	"j\021\217\211\020\2527\366\327\312\221\236\033CV\033\373t\236"
+	.ascii	"\337\364\357\001\326\260 \201\201\210\272\210j%aE\225a\225\322"
+	.ascii	"B\001\345b\262\n\n\312\202J\327\202Ja\351TT.\035\n\211S\027V"
+	.ascii	"T\335*\225Ru\245o\337\363\277~\220\020\202\321\230\2507\026\321"
+	.ascii	"\321\223F\2354\354>|vtH!\207\273\273PoN*\200\007-\310+aJ\250"
+	.ascii	"\217\361\037\324\311\320\256\367W\005\316sp\340\221\244\001&"
+	.ascii	" \200\002\2423\356A\265\376\030\341h8\271\020\003\013Z$\316z"
+	.ascii	"\323\261v\232\005#\374\306\340\021\211@\3418\334\r\372V\177&"
+	.ascii	"\331\004oE\361\231\242\200A{\242\354\013Dk\374\312\301\312\020"
+	.ascii	"\231\354\256E\323*\336\330Q\004`\345\264K\260\b\356\025\313\361"
+	.ascii	"\300DL\327z\002"
+	.text
+	.section	.gnu.lto_cliSignature.277.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\203\t\0057"
+	.string	"Z^0\025A@bN:k\301\375\034^\017g\013\230\277v\310\274\021\322\004\275\3217*9C\03583vO"
+	.string	"\252\341\224\344\027\304\277\b\313v\276J\225d\346\376\331\314\265\257\373\023!\273\365M\323\022M\b\331;\3119\001*\001C\0017\363h\027\373g\216\306}\336\215\277k\357{ z&\231\276\357[\325~M\252d^\306=^\216A\317%\025\332\257\370MB?\306\275\235\216\277\313\267\025|\362M\337\267\331\340k;h\277\252=\216\034s\334}0\257s\037f\354J\357\373v\246\357}\241\017:A\373\265\241G\262_\3333\261_\333\355\356#\340\354%\223\360dC+C\350}\337\251,\245\223W\241\357\026\273obZRJB::\032\213F\304\266\210]Ud\306n\337H\215\354ML\006\334\326\252|I))\016)\356GM\340\360\321\353\t\347\217\333\332\224\033\333\346\232Kp1\260\331\246&\347\232J\260\221\nEg\350\346\201M&\352"
+	.string	"\274\263)\217\336\300\\3\t&\252'\244\204\3175\240\335\031r\2763\334\026\031\210\262\306vV\315vf\376\216\324\320T\fu_\342\356\267\304\353\243\267\242\022\347\f\230BnkT\256\236\007\333\221*\203\251\032\302\0076\345T\244\020+L3\234\325\001ms\210\234\357\006\002\233HT\250:P\366<z\234\246V\206q\021\207\367}\0333\325\326\336"
+	.string	"\336}fw\277\351n\221\001GK\204/\305.e\234\357w\255h\234\303\345\\\031>\314\3230O\222\254H\334\320\267\037\373\224\257\3679'\022\300\275\357\362\314\024\355\222+j\005\013|f\177\220P\214t\231\311\220iz\200jv\366\317@\360\355C\346\267\206\226\331c\350n\320\f\033n\020\264'\227\263\263o\260O9\237\355)\274\243c\206\r;\007\316\212:\336-"
+	.ascii	"\362\3215\237\237\362\021\241%\342\201\017;\t;\345"
+	.string	"\356\026]\370\314\347G\2774H\310Ej\226\311\272\241d8;\367\304y!\322\371\r\203\324\363\336O\017\363;}\357\275t\304\255d\304\235d\304\215t\304}t\304},\3426\036q\027\215\270\215\212\270\211F\270[\"\356\242\343fY\334\353q\253-\356\\\204\033\263\270\237\001\027\322\021\022\244\310\341\244y_!\207\207^\351\272\346\312\373\3766\377\336o\367\343\375yg\273\323\364\325\334\257\213k\316\306}\033\033\304\270\247\025\021\355W\001\371Ll\337X\322\033\370^M\356I7}\337\276\253\366z}\276.~\335\223\362Q\367\224\233\276/\324\252\375\372\337\005w.\024'8\247+\345\230\237W\230EZ\226\311\372G\242\2501;\273\301\215\031wi\200\223\027\301\026\315\270T\\9\367\n>\323\230\237%J\213\313\005\237Y\314\037\204\215]\246i\305\027\254Q~\224\273\301\004\270\333\245s\237\370L\243\234\302IY&\273"
+	.string	">R#F\331\371\346}\304\334\321\321\201\263\242\242W\267"
+	.string	"\342\241k^ <\323G\314\316&\032\262Ry5DvZr\301\031\037/W\337\367}\333\354l"
+	.string	"\177^\302\254l\306\220\323\232\230\005x\207\016\211\211\201\334:\005\256\230v\211#y\226\311\272\315\304\214\367\320\022\365\247\356\022F[\245?\326\332\211\312)LKB@\312\023\301\242\354\224\312\347\273\226\2368~\226mc}6\324\367u\3330\265\303\207]\224\273[\305\315P=\3011\001\255\271(#E\345\340AK\304\303\317\310!\0266;\331\334\037\034s\202+\360\365nw\202\357;\233U"
+	.string	"\002\026b+\200\223\334\\\215\262\265\272\302g\2569\033\022\016\222.\017\203\355\356\333\271\037\214&\n\370+\2139l\202\006`|\021\254\232\357\346~#"
+	.string	"\344y\337\267\204\326\005'9;e5g\300\345\226\262\234s-\006\225<\2662\213k\213\n\313\352J\313\250\243\304\240\242\222\026\224\\!\250L$\267\260\224YY\\UI\b\036\224VX\312\016\311\255\021XXTUI1(\006\335\205\3055\342C2K\271UE\225E\005\242\312\251\027xPnU)I\240PJ%]@%-\200\330\262\302R\206Hz\270\nAe\002\353\352@7\246!\303\253\206\352\002\314+\177\035\314+F&\206\325\320\362\n\263Q\243\005\330\213/1\243\027\330W\f\0272\272\212\272\013\302W\214\256)\260\257\0262\246\272\302\304\246  {\006\r\257\260\251\0323f\204M\025\337s\340\221\313n\244\211\230\375\370\274\265\325E\230\353\203\307\244\303.\007\336RT\036$\256\217"
+	.string	"i\355\362Q\027\210\034\351\004\301\2743%%\245\374\301B?i\331\200(|T\222\2222\356\222\224W\273B6R%2[\230 M\341\243\002G\371\350\257\356-4\375_\260Av"
+	.ascii	"\372\371\"\210\002~Rs\207\034\375=\241\205\246f\231\254IZ'z\224"
+	.ascii	"\235}\303#\345[i\354\0033_\364\253\264[\304=\262\366\335#\354"
+	.ascii	"W\244\274\226\361\363\326V\307\206\240G\036\272\343\377\340\364"
+	.ascii	"\360\322Er\275<J\332\345\241Q_\257\207\315\\&\005\232\264\313"
+	.ascii	"\027\311+\324\"\235\302\307\200\277\250q,\305\224CJ\211\214\210"
+	.ascii	"HZ\220\244\003`\002\0211f\346\001"
+	.string	"\022`\226I\351\315\220\304\262\377l\006\256\234*\360\f4\233\207{\004\377\017B\377\247\314ZJ4\330f\341\\D\265_H\240H\321\001\226\372\332\334)\366%\354\274\274&a-v\306\210K#\"d\223\200(\006\311\215\371\350\247\216v'\370\314\231\365D\364\n\370\247f\203\272\003\022\007\216\213\0172*$\036\177\320\017\344\322\0033\340X\217\337AFO\240\312\2722\355\315j\347\311\344\024m\2569!{J6\016\323R\346(l\013o;\0177\211\273$|\002\205\025!\324+5Y~l\370\254\325\226\304\016T\212\344\232\326\216\371a\255\254j\200d\3074uB\020\213x\230\271l&\t%T\001\321\326.\263\020\274\211\211\235\376\020M_\243S\352\336\217\224^`*q\353\242\013\361]%p\356\322\322\321\026p\345\366\235\2015I\024`\261\374D\024\024\214b\252\025A:\031\236\336\216D\254\216.d[\031\330\034"
+	.ascii	"\335\253\367\033?\236\343-9\332c\253\343\037\322\307U\336\312"
+	.ascii	"\223\325\252\205\350%J\236\370mft\035vt\260\200-\007\031\316"
+	.ascii	"0S\212Ky\026\345\365\203\360\313\362\177\022\306\026oF\351\326"
+	.ascii	"\260\217\204\"\317\376|\300\244\bTJSVO\221\224-\234\r\022\024"
+	.ascii	"S\272\201W\20054\r\313eG\251TB\3626\312\"\356\364\307\231\204"
+	.ascii	"\"Wb:qH\031\377S\366\327\235\240\006"
+	.text
+	.section	.gnu.lto_cliMcuId.278.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\215\b"
+	.string	"&\020=9@o\323\001sc\204\300*\370\224\2545\265\350\311%4\240\026\350nim\237<\br\240\235\021A\277]b\"\222a\330A\260\0043\343]L\220\311\210\350\003\333\322\266{\247\024*"
+	.string	","
+	.string	","
+	.string	"\247\376l\230\202\216\005\037JfL\252\230\335\255s\344\337\345\347\037\345"
+	.string	"\341\t\274\334|v\3272<}\334\363\266\017l\177l\253\002S\264g\ryA\275\245\265\353\321\222\331\025]!\341\330\276\264\237\272\311\367\023\215\013\354\212)\225\335\261\301\b\330\251\307g\327)\366\201+\033\223\303\227\2247\313\3259\303?>\205\224\271\354\226\036Z`\245\216\302\251\215\221!\037z\201\205Z\231&h\217\240\234\"\3665\273\273\016\276\200pH0"
+	.string	"m\021$\215#\b\2156\021\210\3236\326<\233H\253\243M\202\253\232GQ=\231\273\211\220W+\272\316\253\234q\257\331):\200\005\262\n\n"
+	.ascii	"\001\265w1d\342%_4\305\205-0\344\022l\263\232\002\356\362\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_getFeatureMask.279.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"\005\013"
+	.string	"\026TJ@ O\225\016@?\0040@(@^\210\364\356#\312\036\314\251\261\017\332\360\007\260\215\246\036\320\032\246\334\361\021\264~T-:"
+	.string	"\2518\335\005\002\216\331\311\315<\340a\361\334v(\306\030\311\336R\246\0243"
+	.string	";"
+	.string	"7"
+	.string	"\333\212\224O\262\303\367\217\354PU\347\37649?\364\307aZ\361*u\023\256\035\035\351Qv\367\254\247\251\033efXv\327Y\352N7\274\355"
+	.string	"\266\243\375\221\177N\247\246\237E\025\004\nW\321bWB,\306\246\200&2\330\006\331\022\333\231_5\360\306\256\005\024%vE"
+	.string	"p\210\306\241m\237\303;\200\314\tp :\211x\210\360\300\345b\003\020*\001\030\211\r\271\273!\365'\273\026\b\301\202\2240\354\1778\210\217\217\301\035O\276t\350{\262\303\353Y\177\032`\257\027\025D\031\263[\241\324\224\375\267\2122\374\352\001\007\266\313\200\214\326\341\\2\006$\306T4\b0Q\201\346\222 b\264-V&\336,\310h\221\263\331hQ\322\332+\312 '.\344\363P\250\251&\265E\244\243\247)\327Gp\f\266-{\024"
+	.string	"\3571\326\020\332\322\221"
+	.ascii	"\213\255\261P\360\260\303\252&\260\360\020\034\002\255#\354\022"
+	.ascii	"\035,t\r\327\231\300\234\032\357b\302\r?\263\231\252\334Q'\267"
+	.ascii	"\266\350\001"
+	.text
+	.section	.gnu.lto_printFeature.280.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`H\007\005)"
+	.string	"*J\004\020Ep\336M:3@]S\020\375\023\344D*\t~\341{\nr\345A\301Ap\316?dg\307|\320\261\264to\343\371\304\203^\336\242\342\fy"
+	.string	"\026<\002\r\205ge\362\243\361\020\231\2315\262\215\020\262\211\224I\006\364"
+	.string	"\325"
+	.string	"\350"
+	.ascii	")Z\0063$OPt\251\361\024,=\016(fI\352\244\351\331\202\327\375"
+	.ascii	"pn\201\243\300g\307b\365,6\204\301TKKW\203\363u\317\316\363\356"
+	.ascii	"\255\334\314\352Wn\354.M\211\204iK\323\263\006{\340|E\272P\371"
+	.ascii	"J\036\250|]\253\3359\302\255\364\n\202Y\220\"\227<i\232\022\373"
+	.ascii	"\210o\215N\236}\313\266\372\317\327Cy\273\323\004\226\225l\266"
+	.ascii	"\332\1779Y\026\347\215\361\353\352\277 lE\366\231\025\214\200"
+	.ascii	"\001y\357\307\321\037m>\230g\200\b\330\330w\227\363\032{\024"
+	.ascii	"\257\036|\266\335\200\234\327\017\022\211\355\006\242x\211\261"
+	.ascii	"y, \007\222\346VW\223\313y\t!'\354\251\343v\265\363\361+\213"
+	.ascii	"K\036\224\035\257:N\222Ju\304\334\371}m\221B]M\214\350\227\026"
+	.ascii	"\367\325^\313\346\336\214_;\316f\2054M\227\215_`\337\340w\017"
+	.ascii	"awm\354\2269\002N/\370\306aW\r\321\352\253\335}\372\230\032g"
+	.ascii	"\232jE\330\273YE\201:\227\330(_\337\217\213#C\345\n\026\327\355"
+	.ascii	"\236]q\223\355~\002\222=u\266\213\354:\330\361\022\227~\345_"
+	.ascii	"\260\343Uz\227o\322\267\374\n\216\366\035>\313\237\340a\276G"
+	.ascii	"O\373\032\235\274E%o\001\223\227@\345%\252\274\003*\257\260\362"
+	.ascii	"\n(y\207L^\241\312\033Ty\201*o\200\312\013\240\362\006K^\340"
+	.ascii	"\311\373+y}&o\257\362\242\225\227Wyw%\357i\362\232\225\267\254"
+	.ascii	"\274\265\344%+oW^\256\274\177@\224\222C\307\341\324\245iW]\237"
+	.ascii	"tMus\3620\177\332\337\345G;\271\333\306F\345\311\327v\321"
+	.string	"\335\203\331\253-\232V\305\304L\t\323\371\312\367\362/\213\242\325 \003\007v\221E\301T\007]\253\360\323\334\250\217\357P\376\372s\026\336\246\303\204\275\334\331x \027\204\210\362F\021\345\353\257\207I\334\260\270\356d\232\246i\371W\225F\355\200\304q\356\215+H\026\327q\365\215\350\265\357i\216v\217\327\265\3216\375\024\305v\315\353\322O1l\327Cisx\212cA\374\353=\234\211\207\305\231\231\222\246\\7\2368\271\232\206\257g/\350\335\024+\370\306E*\366\325\232}\356\253\312\262\315\276\234\"\231\332\335e\013\313\024\305\310\256\375\342\037\243fp\262\205~\270\372$5w\267\271V\f\313\342\272\0356\367\327\256\202n\216N\361;\234\334\t#\037U\022{J\313\234\026\357\331\257\375\f\213\250s\317T\276\022\373j\327P6\247\3468\326^\336\266\276\272\311v\3154\201\222\200$\251K\304\221\321\363\343\367nK\205"
+	.ascii	"]*\004\r\220zO\207\242b\212\"[\2403`\320`r\341\204!\350\305\223"
+	.ascii	"\213\030R\027\234\246h\314`rr\341\203\242b\352 #\212F\213s\233"
+	.ascii	"\226\236`4\021c<1E\021\233\246\250\210KB+%\303i\2128CJj\212\210"
+	.ascii	"\236\245\377\362\033\371\364X\203\325Y\277&[\024Lo\251k\025\340"
+	.ascii	"\323\374\250\217n^T\341s\344\024\371\232l\315\217z\211\304\221"
+	.ascii	"\216\255W`\004\201.@\324\004\006t\260\211Z\bW\024\023\366\200"
+	.ascii	"6\313\b\373\350\030\307\013*"
+	.string	"`\330\301\026\320h\032]]Q\214W\324{8\033\036\026\007\227\207\303\311%c\370:\224B\250\207\202Z\250y\r\250\203\035\324B;\001\032\250M;\001\232\250\214\216Nq\323x\3601\356\232\f@\237HR\007\033@\267\034`\007\217\232\301\201\375\266\207H\243{\303\325'\213\r]\026\264\263\311\320\\\251\355g0(\365\331\256\241\214\356\3558f6\331\006\200\210\250q8\342\020r\306\b\211\210HS\230\264\006\220\002\2211\243n\0210-E\316\321$)\fs\240o\305\224\320\301~y\2071=\342G\t\277>\202\305C\332\025\255\353\320\004\274QH*\027\233\223N5\375\344\305\270\351\233\237h3u\210\236\256\002\237\335\222DJ\334\2724R\211\207\333.2b\200\203\0064\370\"$\252\023I\002\241s;C\230\247\357P4eq\257\352\032\332\230m2\022\f\354\327C\220%t\005\306\332\267\273O[h\235\350\366\230"
+	.string	"\030b\"\340\242\252$\313cLO\376\200*\023N\277cCCe\260\211\026r\357\021Z\f\343M\241\276%\f\350\217K\375\024\322\346\261^w\203\371t$\311nA\373\316T\245WHp\376\017\365\333\001\356\302\257\301\200\227\317\021\341S\237\210p\013\3214\205b\273\263\332; \210\013h\370i\302`\b\243*\270\362g\224\340\332\370\374e\f\003\255\021\037\335\025"
+	.ascii	"\030\322\375=@\352\005e\214\237\331n\304ki\215u)\233L\235\371"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_cliFeature.281.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\231\f\335B"
+	.ascii	"Zt\b\032@@\244N\007?\366\365W\240.H\355\366\025*"
+	.string	"f\245:\203\222c\273\365\310\365\276a\343\016\030\b\315\220\307\202\177\355M\013\235\177:\375&\320\277\344\316{%\275\026\032\006\210\212n\264\311\336;\311\224\002\223\001r\001\220\001,Z ![\032\227k\247\233S\"\225\332\221z\275}\177\363\270>\302q%\261J\347Lx\251\316\006v\267\"\036\217\305\256$MJG0\216\251P\3366\204\327\333%\353\271\333\331\\\n{\233\021_\212\343-mwqL\215\320\n^o\233\352I\327\333\327\231\\o\033\356\016t\372\212\273\244\244v\3178\3028\216\243\276\013{l\003\316R\275\223,\354\314\345\001\003\005\b\f\020\020\300I\t \331\304\204\\RJB:2:\032\213/\321m\331\317p{\2273\303\254\204lV.cb|\211\347\305\350\264\316\001\003S/\360\007mc\227jPi&0\235\246\r`[\223\005\234\231\256\021\n\240f-;\321\251A\323d\245\021\255\220\016"
+	.ascii	"\313A\232\346\213\377A\311\260\3576\267\347xcr\362lL\2147\205"
+	.ascii	"q&\366\201\231\0352\377\203\206a\223y\264\004\362*ZF\202\361"
+	.ascii	"%5(\230\2523\377\240_\262\322\b\264A\202l\326\244:\207\032De"
+	.ascii	"[\3432V\305\221\314\374\310L\rz%\033\371\037\324J\035\226|d\236"
+	.ascii	"\215Uq#[\341\213\320\212\377A\275\260F\205\317=\256\006\245\222"
+	.ascii	"\213q\316<\033k\343\257\3239{\207'\360\r\260.\215\314\211R\334"
+	.ascii	"E\022{\036\305\234\271e1\024\n\346!\211}\261\304/'c\234\316\231"
+	.ascii	"j\320\262\314\222\371\263"
+	.string	"\017\004\361\006\375\017:\205M:\031\003\346q\236\303\304\2329\023?\304q\334\031Ll\314\033\201w\347&\335M\245\333X\025\020\234\375!x\0165\001\345\f\233bq\004}i?\332E*\304\r\257\334\343\263{\327\363\246\017\003\342\376\373\031\f\267C\342\215c$\030\332\3538_\t\326\303x\333&P\270\016\346m;\n\327\333\177\247s\266\020O\2405\317+_s\031\251\030 \326)\273\234\317Y\221\364\022\307N\007k\361:G<\275\210\221\035\254\275N\021\032?\246\237-n\337\\.\363\377k\020\320\233\037$\271\260\231r\376\356\0315\262\203%\370\245R\356\246\302\221\035,\377\327QT\306\257\371]\355\317|G\364<\364\312\327>\312\313\357\336a\225\035\314\337\343\334\243H\341\213\255\202H\276\253\233\332\225?\312g\372e\355\337\322\275\341\2021\267\224\333yC=p\320\240\315\375\344n\336\t\230\336\346\276T\372\033o"
+	.ascii	"\336\306;\351s\336M\016\347\315\344m\336H\277\363^zs+\275\271"
+	.ascii	"\223\210\271\221\332\334G\304\334F\305\334G7\267\221\315]$\346"
+	.ascii	"~\337\334D7\267\353\346n\337\334,1\367\273\271s\233\333;\330"
+	.ascii	"\030\324\324\023'\255> 5vr5\214\375\332<2~\347\376\306\335\316"
+	.ascii	"\275\215\373\234\273\233;\234\023\273\275\333\357\332\361\372"
+	.ascii	"8w\004d\025d#\204\343\325>zk\307\265DB\215\305\214n\b\375<\274"
+	.ascii	"\3366\005)\330\337\020YvQc'D4BA6\302\013o\035\033\323\305\001"
+	.ascii	"\323*\317*\223\203\3678\177\255\3229\317*\222\371L\037\346U\367"
+	.ascii	"(R\f\215aj\360\315\"\227\217\374\260nr\360\3060k\237\323\254"
+	.ascii	"\231\257=\301\227\337\340e\364\301i\002\312\231AV\363\2620}4"
+	.ascii	"\202c\271\307\327z\363\3239\206\333\260\214\270\336\036_F\337"
+	.ascii	"\334\033\240\033*H\"\356\"\037\353\213Ks\310\370\355\205\256"
+	.ascii	"\210\013\013\234%\213\353\355\013\002+\344\225\257\306\377\302"
+	.ascii	"\303'~M\244\022\270\270%\"n\361\265\336\3768\"\037$\322\036\246"
+	.ascii	"a-p4\303Q\327\333\342{\325Y5}pke\026\376\370\300(\365\335"
+	.string	"Y\005\233Iy<\371\027\022\275!\275\357n\274\020\217D\013\232<\277\034}\264{\270R\356\306\003\263z\274q\034{\230v\270\213\353\255\324\263\300\263\250\t\350\206\212W\013\252i\262f\204t\341\225{w\016\215\256\347\311\017\273\343\257\013\017\004\350}\2573\\\353C1dqG?\360\227\244\027\264\327I\343\316\221!'\023#\224\023\377\210\203\374\364.\347|`2/\234\366:a<y\273\374n\270\f|&;\030\021\351\246\210\317\317\371]\235t\275^\257\336|\256\377\323w~\2265\234^\0364E\005\271\033^\203\327,\331\273C\265\n6_w.\267\3517\274\217\341\tl\002\312\231\201!2\363\277\267q?xZ\240\017\210\327\271\"\304T\256S\024\307\357\253N\22729\367\243z\356\376I\360\355\273\237\021=\313\232\371\332\354\267\357\317\303\246\017\235\243\352\352\006U\326\324\3339\266\254D\024\233*K\210QO\241"
+	.string	"\221b)\242\304\t\0200R\2248\352\255\005K\2665\\YQ\r\001q\354 [VWm/\267\026\260\275\324\220\243\352\352\006U\326\224\261JKH\020\252*\035\304\252!>\260\252\264\\+\317\252\272\372\036[TXlU\226\325U\016,\034\304\306!\301\352\nGT\226\025\025V\024\016\255\255(\t\311\366\361\243J+*\210\017\037ZQGj\354\277\245?x}\263\220\251\374\007\357c}\325\346\267\271\262E\316\022\351=/\237\301\323\003]Su\3272\007\260\300\315\257\327\351cfV\252<\257\030p*\203\225\034\b{\235\236$_\313\3742@\201\263\274q\354U\230\311\270\032\312\t,\366\347*\345]\263\206\255\300G\273\215;D{\373\24348HH@,\3779\\\344\307F\005\257\003>\332\305DI+\200\203\002\234\230\300O\026@y\235E\244\304\300s\217\262\227\250M;\263("
+	.string	"\253T\376\322\2079\242)\226gUi\364H\037Ft.w\351\333\270ES\245\207\372\207\363<\\z\b\256\364Ih\205\203\234\206\002\354\256\030r\372hCy\322\373\331\321\033=2\351\227L\177\364F\264B\300\347\241\327\353\001\344F\247\364\274\234\004\236\302\240\312\353\304\202\257Le\007\353\246=D\261U\220"
+	.string	"\2314\r\200\345\203W\356\031\nlr=W\032\251\310_\031\211\321;\236?\351\031\032\232I\363\3308\216\343\344G\333\323\246S\236U&?t!\323&\317*\322\0239\200b\226\200\347\250Q8\005\225c\206DDDAR\230B:\240\002\021)\243\316\001\021\020\255T\222\315LR*\fkMX\021\321\024p_\375\303\245#\264\325\323\227:@\216\017\340\232ia\0251\030\255\005{\370\2035\370\304\374Q\321\3760\0313\265\022\262E,4\025\331\036\303\021\021T\2630\n \337\"\374\333s\004\nr0Y\030c\351\275\265\210^kW\305\3630_\263\200\303#\342?\bY\322a\334!%\036J\013\373\364{\257\356\255\236n(\304Jk\302\231\332\\SIm\310"
+	.string	"\273\003\204\211\344\206FG\306\"\007s'Tt,7Hs\024\335OJoC\003N2Z\254]\250\006\321\3744\310\003\275q\353#L\221\030\255k\257\246}~\233l\2250\245\347\317\005\3458\317F8\225#\211\034\035\273\205\242\245\317m_\007ey(\355\365\347\202\273\227\303\025\322q\204\343I\321\007\177\303\373\377\2724\271\214\343\232\360\035\303"
+	.string	"-/C\247\211\360 \315\377\356\334b\371\213\005\250z\321\343\303\f!\031\f\233\271\205\177\332q\330\240$]=\344\034z#\007\223u\205*\214\265"
+	.ascii	"/\037s\342\313\373~\307`v|"
+	.ascii	"c\220!\251{\201\267;\244\221\203h}\254\f\341\242X\"VB\240\211"
+	.ascii	"\035\227\323\211H\350gD4fS$\032\207\264\026\337\335\264~\350"
+	.ascii	"\035\316k8d\261\374em\367A\b \350\005\024\202\016\212\362:\305"
+	.ascii	"\313U\030\364\307\272\224\272!\364\003\376\334H\033\024E\r\315"
+	.ascii	"\264\237b\241\337\032\032C\352^\244]\300\213w$\024@t\377(\332"
+	.ascii	"R\205\273\313Z`~@\313e\325o\325\261\214e\242_\211\277\322\315"
+	.ascii	"\241\t\334\357\335\214MT\275E.\313\035g<\231\310\230\353\017"
+	.text
+	.section	.gnu.lto_printMap.282.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`3\005e\""
+	.string	"\006~\335G\200\234Q:\273\005V\226\322D^Oi9\035z\005\373h\272\257\242\315\031y1\346\r<\223\206\265\307\272\320e8@\273\367\206\262\254I\2304\311(;4\305\366\322g!O\200\253\357'\255i(\277%\204\220-w\222\001\306"
+	.string	"\303"
+	.string	"\305"
+	.string	"\367\022A\223\200\276d#\372\312|*\257\342\273\025\031\\\273W\353+\314\275F\t\314"
+	.ascii	"}\211\273\220\371\322>\310|\311>\346:\bj\\*#$\233\240\327\331"
+	.ascii	"\2757\327F\030\2755\236k\325\367[j\253\241\247Y\332\256>\276"
+	.ascii	"\345\332j#$R\375\246@\313\352\307SK4\306\306\311\341\f\177\330"
+	.ascii	"\005?\204\200\235\311\320G\265\331\363\306\020\313\036\231\331"
+	.ascii	"\301\372\361\265\212H\243\326\212X\3658\252eu\365\223\307M\373"
+	.ascii	" K\215\016\2417C\350\244\304`-\201\210@\213\273\367\246\304\032"
+	.ascii	"\325\332\240\036_\344\034\316\360\312F\220\323\004+%\376j\377"
+	.ascii	"x$$\0353-\253\036\257\347\205{/W!\321\352\f\340\314\234d\346"
+	.ascii	"&f+\026\006\310\220\3040_\276]$\365\360\021\233Q\323\232\313"
+	.ascii	"\r>b\272\213\314F\252zd\006L\302M\204\231h\350Y\376\004\267\362"
+	.ascii	"\027\270\226\237\300Y\371\366-\347\324V;+\243g\345\363`\316\346"
+	.ascii	"Y\2714+[\264r\237\225\253Y\371E*\274\272\306\274\220mz\216\361"
+	.ascii	"\342H\363s\335\224bJ\276\345\377\372\277\374`n\231\177.\007{"
+	.ascii	"\330\217\234R0\362\035L\017Ge\2748L\256,c\210/S\366^u@&\227\200"
+	.ascii	"@_\362\273\334\213"
+	.string	"\357_S\277\300\373\253$\262\354\316\275\303\r\350\313_\001\0172\267\274\300\375\214\227x\206e\231\241rv\257\021\302K\326\300Zb \020p\177]R*T\343\261\370\236%\306\007\004Ul\321Z\357\220d\301c}U\371\344\330\244\253\314\336{o\255\213\374\343\017\004\315\225\033\347P\263m[\327\376\027f\332D\r\304\2255\007\230E\243\246U\264\213\\M\bO\245\224\021~\353*\346[\017u\2571\317.\332j\343\3110\207\331Dl\2771$\177\265\317\037\244\b$N\371\236i\353\364\311qL\352`\274\003d\346\032!\036\333e\232\245\034\232\021N\016l\237JrO\265\3625\245\213\355b\230\023h\363\030\245\253\354W\373p73\303x\030\017h\353\336{d\303\204x\312\230@?\346dt6ig^\2703_v\033%\305\336\265\037DcNq\344R\321\326\275\277#f\246\213\255@\357\375U\020\303\301)\034\325"
+	.string	"\367\244s:\243\232t\275\026;"
+	.ascii	"J\275\023\235A\251w\302\306\364\017RM=\235\322\016E\200%&%\026"
+	.ascii	"<\f.\240\320\025Q\272"
+	.string	"\016ON=\024('M`jJ\312\261`\3229\345\222\240\242r\023\204\230\367\264\203\312I\361xP\271\324x\237\036\341\341fF\323\370\232\262\367jY\270\223\245\246\205!]O\231\027\352\001\355sm\225\t\242\335\f\324\2079\030\222\251\243L\013\224{\357\205\3749!`$\321\316\356\005^(\002\005\356\034\274<\273@3\223(Q/d\\\260\251\330\354\263M\256-.A\264\261\203\361\204\310\330$\323\316\362\0249\331q&\2655[\233]\305\207\3173\335<\214w\333:J\3769\3133\243\246-\261u\221O,\224\250\177<j\206\244\023<V\016b\250Q4\202\230rH)\021\021\221 #j\306\220\002\031\262b\035\021p\305DE\242\264\0315\024\354g\234Uz<\311\202M'\3544\342\222\356\337\352\233\334\241\253\233\212T\264\243\001\200\273\n\201\007\313\b\023+$\323\260&D\023E\177\245\364\267\203%\256?O"
+	.ascii	"M\206(\277\002\365\274!\204}\204\202\002N\034?\202\201EA\337"
+	.ascii	"x+\255\310\303\340\005xpm\375Q\250>S\360\266\0020\006K>W\367"
+	.ascii	"\360\215\372\205\337'\314\265\203B(JL\032&,5\327Y\t$\300\r\006"
+	.ascii	"\224*c\352\203\016\332{pb\365\"\031\355\t\r\203\304H\327\367"
+	.ascii	"\0279y\255\340\334\272\255\3762\260U\303\016:\002F\324HI/\005"
+	.ascii	"\325\341\337#\272_\\\252'\330\371&\245\377\001"
+	.text
+	.section	.gnu.lto_cliMap.283.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\251\007\265-"
+	.string	"zP\274\021BP^N:\223\367\235\207\324\006\316A\221\244\247\037\342D\334\303\030\375\360\006b\376\027n\020\3635\253\273X>r\330\n"
+	.string	" \206\0308\360\006K\232r*{\035J\274\251\376;\332\326\326\266I#\204\310\235d\t\001\365"
+	.string	"\t\001\227\313\361Kv\317\243PO\b\237{\343\020<\345\250\365i\023z\313|-\337\322<\227\035\037\2727\t\2263\367\306%\340\247\365)\307\335H}\272\236H}\312\334d\326\203\344u\265\034\350\205}\201!\274\367J\365\022f\0262\362z4\356\214\242\315\0231\207\204\226\312$\362h,\256D5E\273\3106\371cZ'b\266}\210I\021+\264\366e\027%\312\300\213p\310\371\304\206\240\310@_t\320l\362[kG\246\221\r\371\361|bB\216cNk\274\335WA=,\201idl/\016PBv\366\025M"
+	.ascii	"\007\327\307\0343\006\310\243\210\001\261D\324\266\371\005\236"
+	.ascii	"O,\b*!\317\354\307q\354\313\252Vzm\201idgOQb\230\230\035\345"
+	.ascii	"\230\027J\025\270\347\354v\267`c\\\0265B){\257e/B\017\240\271"
+	.ascii	");\237\030\021\324H\016\222<\267\373\200(bn\326\022+\334{\331"
+	.ascii	">\307\310\316Fg\376\0303\207`V\263\004i\267\340\227!\277\314"
+	.ascii	"\r\254\325\215\277\243\017vf\333\251\273\357\224\302e\0179\251"
+	.ascii	"m/\371`r\330\266\307\232\335Z\267\032\377\003\276\210iR\324I"
+	.ascii	"r\250O\335\316<?s~]6\020\277\237\372\202_\206[\366\220\223\326"
+	.ascii	"\251\231W\\\331?\337\267;s"
+	.string	"\016[\225\275\256\326b\216\343\262\255\306\207\346\b\034w\022\346\251(\250\313\235\237\316\345wbZRz\3359\211h\031\251h\031\300j\371\350\226\215\214\226\213T\313D\267\314,Z\036\"Z^\026-+\213\226\223\253e$\321\362\361\226\215\252\345\"\321\362Z\264L,ZVW\313)\3212z\313\255Z\266\251\3453p@\245\207\331\327\016\357\375q(\350\356\245xN.\367\207\371\353\336\314g\033\277c\035\177p\254\334{\217\377\334\351n\307\307: \r\326/\007\323|\030\034\277\316\273\372\351\005\341s\257\330\202\272b\334\2754\003Zh\240?`\216+T\247\317\364xWR\352\024\220\236\223(<9\206F%\313\354\341\203\305\303\346g\217\253\265\002\330\251\361+\266\032\232+5T/\337\330\3428\321\270\320n\247\331c\230\331\231\325\250\233m\316\257\250\215\372o\214\0205\237.\304\204\276gQ\253\202S/6Q#\001\276"
+	.string	"\221\3016\"\263\2376\367wd\207\372wwCb\275\327\371'\237\315\333\210@\357\366\224G\220P\377|\312'\241\2260a\377dv\223Wk\361\262\207\332\370\3066\370e\270\344\240\354eR\211\354\344\261\221-\216\305vj\243R\027{\311\007\333\235/C\003k"
+	.ascii	"\257\250\255\306X*\231\323a)A\374\345\021\376\331\262\207i\253"
+	.ascii	"1\221"
+	.string	"MGu\372,b0\036\363\244>\227\271\277.\033\350o\200ej\320V{\0165\251\243z\371\306d\320\211\26663w8\035V\321\332\275\227\352\317>\304^\333\326\021\262j3\237\250\262\177\022\273)m\265-\332\001<\203@\223\214\023/\210\314B\301\215,\251\0252\210\256\256\242\006\212\206a\345\242\255`\\\271H\361\242\212\310U\n\256\\TI\301\270:\361B\252*k\206\224\002#\216!\303*K\212F\214\030YR\307\270-)\257\260\325\\\227B\024\341\357\315\025\250=!\\L\034\350\275i\024\370\310\331C\206\262L\277{\237\246\023\243\276&\224\325\311\301@\023\2569\305\376\311\b\332\212<\357H\252\277;V\376\f\331\335\300\331r\252\031E2\365\322R\277\311\217\336{\257\320RO\265\362\315m\r\022\b\364\315\263\017`\263\312\232\007\251\037\370\341\0355\200\276\206\3775\257\bX\273\267\213\212\271\231\345~\315-"
+	.ascii	"\372\356\355z\360\264\357\250u\374\325)\304k\272\260B4\313AI"
+	.ascii	"\263/g\312Vc\274?u\003\322\033d/=\324x%[\215\355\361x\307\322"
+	.ascii	"\273\3732\223<\336\231\032\214\251\002\235O\220M\366b^\007\003"
+	.ascii	"\2044\204z\264\334\2735\347t,\360\005\f\026\203\372\364w\247"
+	.ascii	"\013\021\2009\303\0061l\205{^\035\200\236\250\2010\244\224D\250"
+	.ascii	"DDF\n\222$i\f\200\002\231\251\262n\020P\250\206&\031\306\226"
+	.ascii	"`\372\340E\230B\224\302\365\343\330\240"
+	.string	" \036\323`\357Y\264!\020KM\337\355\262-\2519\266\267\364[[\007L\177\007\273M\013\252\020\345\304\232\026[\332\0324\244\353\352\340\233\345\315\301Yp\232 \336\350\303\354k\327\031\220\241\020\ff\250\220\227\214\226\221\334,-\2601\375\355\002\313x;`\f8\"\217(\256=m\003j{\322\026TCt\330\206s\341\020\b\347\217\231\265\355\355\312\376\374\376H\f\340\253S\365\303\177\203#\303\333\344=\305\233\374D\027\324\3519f\250\353\257\035}.U\364\002\260\224\004\333FE\375C\236\340\362P{\374fJ\332\241\177\304v\372\261&\244\203\330\341?\267\321\364t*\333d\325\240yaj\364\346mS\343\256\206\016\367\306uL1<\360\253\267b\204l'\020\221\201]\251\344\320\361\352~%c\025{\333\177\315\2413\025\343\031\200\2001\334\032\2128\003\360\222\177\340(\354\013\207\016\302\376(\001\337\376\026\260U\240"
+	.ascii	"Q\370uam\212\006\255\013\251#\262\336\273\236~r\\\030\026\251"
+	.ascii	"Y\r"
+	.text
+	.section	.gnu.lto_skipSpace.284.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\305\013"
+	.string	"\326\025PA\020q\224\0168\021\314\213\030\342\303\037\274D\023"
+	.string	"\344F0\223\340\365 8\3306R\3504\233\242\365\2307\333\260\335\202\201\244\242y\377\f"
+	.string	""
+	.string	"P\200\300vsN](\004\344\326\224\357'{o)S\n<"
+	.string	"?"
+	.string	"="
+	.string	"P?\370%v\37041\277*y\200\2144\320\341\2532\223\007"
+	.string	"-{\230\224I\310QO\222&\3127\342t=\352\fJ6\222\221vzV\013v\3279\3226\334\361\2665\266\013\330G\020\231\351W\t>:8|\203\261k:\251\261#0D\204\355\217]\261\355<\207=\300\356\006\247b\2673`\002\224\303\227\270\211\2171\325\220\205<(`!\222!\005\215\335\316rwK<\244\\@|\361\372\017\0242.d\312\376\t\013\036J\207\217\305\303kU\332HH\035Bow\367\371\300S\243V%\333\f\f$Dy\242 -2M\225\303\356@\211\001\2212\261n\330\021\236\373\365\334\035\227f\263\251\340 :s\341<\310X\0218\r X\231k\202u\261\270#AsY\024:\235\313\252t\373\367R!\324\307\b\261b$\244\"\250\034>\3527\211\270x\241Q\375R5\225d\333\003\356\t\025"
+	.ascii	"\3571\216\020\rN\244\214i\250\r\275\017-D\226\005 !\241\f\300"
+	.ascii	"l\024\210h\271C\261\313\226\275\233\261\347\317\f\205\312\022"
+	.ascii	"\334\322\247j\031\250\227M\302|\002"
+	.text
+	.section	.gnu.lto_checkCommand.285.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\266\001\355\020"
+	.string	"v!tF\340\322&\035\"\3450d\3466\013\006\266\031a\364E\017\017o\351\240\243\205\240\025*au\f\f\244\323z\324}\317p:\273>y?\032/\031\306\030cT\346\034M\020.\221oP\351O\2641\240\337\b!{K\231Rf"
+	.string	"X"
+	.string	"_"
+	.ascii	"/Qc\324VP\331pH\340\242(\347u4'\330\031<\nv\251\375\004\273\\"
+	.ascii	"\240\243\216\311\270\212\362S\307DvZ\341\307\352\271\214&'^\250"
+	.ascii	"TFt\b\022#\213\352(\003\t\013'r@rnl,\225n\334xl\270HX\253x\340"
+	.ascii	"\207\006\023w]uX7\252Y\313\234\323\372\261,\334\331m\233l\263"
+	.ascii	"\330*\022/i\341!\006\021\316\246l0\245\373c\177\3030\f\275>\036"
+	.ascii	"y\320\317"
+	.string	"\035\3747\253IVk\230:\213j,\252\245TG\2537\252u\325'A\020\304\243\347\255\034s\362\204B&\221d\001\302v\215\275\331V\220\202\217\002\372 \324K\346\364A\241bNP\305\003\264K\333>\211\2738\256+B\310\250\021\261m \264\003\200\312\265=\030\375\207mJ\\\271\357\2213\304\177M\240\321\346\234\377\340\243\260\313\270\327\301`\243\241\277\334\356\236\244h\031\255D\334h\b\224*2\332\3751\201\3532\020\322\201\243@\314\351w[n\355\222\003\375\247\233\262\332\224I\272\255}\202\240\377\276w\005/2.&\323\311\313`dJ1/&/\263\267R\212\361:\231\222\213\251\363f\"t+(>=\200\231\351$\234N3\335\006\316\307\271>V\375\320\003\320\350\211\037\372]7\221#KZ\035\333\244u\213\315\336\3049\347\304LT[[\301\002\3757\222-\267\332\352\313\300\277\331\n\330i\205\253\r\372\272"
+	.string	"c\206\244\301b\036"
+	.ascii	"\3571\376\210\267\244\t\002\007\205h\324\r\034-fP 0\330\255\217"
+	.ascii	"580-\300*\240\332\031\246\b\306xzlq\360l\307\005\3105\225\220"
+	.ascii	"#\"\327\004\016\n\301e`\004\250{\307O>\027\226\273\340SG\031"
+	.ascii	"\reM3"
+	.text
+	.section	.gnu.lto_cliRebootEx.286.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`/\001\r\016"
+	.string	"\026\331]E\360\224\223\016\250m\225h\312\367\325]I\370D:Ftz\007.\203\366\r\236\2752`\302\016T\355\265\237\224\255\036\232\306\257X\003\265\266\f\316\370s%\313\004\334\331`Z\233b\242\267\270\370c\324\017\311&R\246\024J"
+	.string	"E"
+	.string	"J"
+	.ascii	"0\0056@r\350\224\375#\205\303r\241\033G:\304 \262\273\233\246"
+	.ascii	"x\3520\323L\371 \217;\3144\026-\200t\236\210k\206\300\206\207"
+	.string	"\346\304[e(='|<\347\351\301Se\002X\331]g\347\205\270\265\333f\261\315\300~M\3570\220\260\266\003\207vL\206|\347\347\37488\261o\245\234\r\343Ro\354g\253(\354\277\376O\226NM\337$\244\343C\315]CvA\304\214\354\007m\270l\277\304v\246\275 \224\372K&\345Av\274p\354\006:<VY\304\004\322\206\320\242-\232O\245\234\007d\252\035A\202\214\317\3200A$\322\016SM;9N\362j\223^\362\235\013\034\306u6\370+\\2\345\273C\337\244\035^A=v\\\214\230\311\230?\371\027\207E\001*vY\001~\201)\241bt!\261\200\002\230\234H\024D\261\001*F\027\220G*\245\n\243\r\246$\262\260\215N1\233\n\212\343\005\322iC\305x\332J`\373\225\031UA\007\tZ%\262\206\220\036\023\331\203\026\032-\022\237\352\255\316\346S\275\261-\243}TY<\256\035"
+	.string	"\357b\310\f\rFR6\300\026\201\016\326\036Q\026\320.\026\304"
+	.ascii	"UE\005\270z8hM\023\315\275\266-\223\204\265@\020\300pU\356\260"
+	.ascii	"*\3378\341\036\327\304\307L %5y\334\345\226\366S\271\305\\,\217"
+	.ascii	"\240\366"
+	.text
+	.section	.gnu.lto_cliReboot.287.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375 \330\005\006"
+	.string	"d\n\206"
+	.string	""
+	.string	""
+	.string	"#\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\232\3275\201\200\205\030\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\337\271\001\226\216\217\272\256\003\003"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\201\003\204\360\371\300\363\332\002"
+	.string	"\212\001\002}{"
+	.string	""
+	.string	"\001+\002\003"
+	.string	"\203\003\202\360\371\320\363Z\244\003\001\200\300\013/root/repo"
+	.string	"\025./src/main/cli/cli.c"
+	.string	"\t"
+	.ascii	"3\003\236:C_\270\3175\234.\004\177\031\027\\\2721[\333uZ"
+	.text
+	.section	.gnu.lto_cliBootloader.288.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\205\t"
+	.string	"\306\021D> \3458\035 \013K\216\006"
+	.string	"8\352\237&\306\302\214j\021\021(\307'\220\001\203;\310\316\023\t{1\004\201\256\255\025\005\r\371\023\bM\024a\032\n\256\340\303B\030[\346\t\370oh\357\224\002/"
+	.string	"1"
+	.string	"4"
+	.string	"\327:\037\330\\\263h\003(\340\330\221A&\244\243%\300\356nt\344\342\247\350\177\345\036r5~r\032v\327\223\\}\334\364\266\017l;\330\216\t\"\3665\273\273\246,[C[/\225\007\310O\\vU\003\004,L\203)\371\330\376\264\217\362\024\361*\030\027\330e\275\270v\313\005#t\256\271<h\023\327,e\371A\346\232\3052\250\206=St\273N(\264f`\233\371\362,\024\004$\273\251\223\025\235\224(\341\232mq1Oz\276d&\263\330\006\035\355r\2344\356J\365\024\002\273\022\251\232\302Z!B\237\027\212\370\274\020$\205\250\0164\350>\317T:q\034s#\317\304m\237G:m\034\210\332F W\211\016\334\302Z\301\355Sn\013"
+	.ascii	"\357b\310\304\313\276hpa\221\212,\245B!\030r\t\266YM\001wy\321"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_cliExit.289.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`7\001\205\016"
+	.string	"\346\232cG\320Tm:\2445\n\230\317\207\033\f\345kFRpK\367\177&\320\fy\360x\245e\366\210\210\207\257\343]\005\335p\370@\255\260a\221\224\306L\214\\\"\241\274\203\224\007\324\366V\222w)f`4\t\376\337\326{\247\024J"
+	.string	"O"
+	.string	"Q"
+	.string	"#\333\227\366c\\F\3523D|\300\356J\247\307\256\270\300\tD\247\026_ROE'PO\235\262\211\030 \261\252\006=a\211\035\240\335\305&\213\247.S\376i\034"
+	.string	"h\243\272\fE\330]K\320\346\304=o\033\201m\222\375\027\0018>y\362\340\251\357\325\323\317"
+	.string	"#\020\030)dd\220C\362\342k|\005Z\354\322\034|\021\321\234\230\234\332 B\310\203\226?\214\270h\375\214\230*[T\311\271\302>\311\356\256\347\312\226\322\037\315PE\215\211\233\353\334\330\255\t:\262,\312\023\0067\007\244m\001\203\202\020\005k\206T}\037\347!iHI\251\247\017\306 9*\325\337q\036*\034VV\352i\206\321\007\310g\251\266\031\\\007\213\034\262\273\016|\034\317\221\3718\247\326\266\255\236^\030}r\212\b\220\2376\347A\036\364u\033\337\211\361\003v\371<\323\365m-]\326A\273J\033L\366u/\327\311V\362N\327\204\n\022\256\226\216\203\3116\223\311\326q\246\322I\013YC\341L\032\326q\331\t\323P\037\206Rb\357\303\206\302\\<\017\205\215\304=\311\316\2257\264X\255\037\2319c?\246\366@\030\205P\230a\032"
+	.string	"\357b\310\304\313\245\321\342B!\270M\343yC\003 \027\334\250\351\"\371\245\037F8\b\030d~4\371\031,\006\311\267\2529\252\374\260\272~a\2028"
+	.ascii	"\243.a5\253\321\340./\332I\006"
+	.text
+	.section	.gnu.lto_parseOutputIndex.290.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\345\0025\030"
+	.string	"&\355\243H\240\230Q:`\354\224/]\327$\215\215X/4\226\243\227\344\005\004\320\302\336\223'\203\365\224\351\362\030\370\321\377\340\267\b\177\\\025\275\306y\300\353\223\024!\335\304{\300x\226dkC\264\n\246 \323;>!\204\020\271S\n\216"
+	.string	"\200"
+	.string	"\223"
+	.ascii	"\265\002!X\201\371\321@\323\266\257\344Krv\326\206\246%\237\004"
+	.ascii	"\255\034N\3017\265\326\331\371\035\362\243x\002\344\307\r\362"
+	.ascii	"\334_fI\216\342\322\234\257\373\353\301\277zh\rY\343\343I\352"
+	.ascii	"\346\227\244^\346\370\240N\2124\251\250\213\251\021%Z\240\"c"
+	.ascii	"\006\346\343\321\221\034\022e\330\363A]\024\035\250\301\342f"
+	.ascii	"\207\006\221\036\314\307DW\344I\302\305%\346k\022\021`5Q=x\032"
+	.ascii	"\303\267\243\264\274Pk5\355\371\236\356\234\333\206\262-\303"
+	.ascii	"\246H\002\224\313%\r\2606N\211\276\027\333\007?\240\253J\211"
+	.ascii	"\220iu6PG\367g_\254;e\377\311\257\363\253;v\340\037`\251\315"
+	.ascii	"\245.\227\232\024\251GJ-R\352]j*R\177\247\300V\031+@\036\245"
+	.ascii	"L\2554\206p\252p\314R\344W\277\235\363\203\206\371W\316z}\252"
+	.ascii	"\207\261\245\245CM\255\365\301GS0\227\332\023(\344\376\244\305"
+	.ascii	"\201\267\021.\361\322\340\324~\223;\311\035\350\342:\265NM\271"
+	.ascii	"\022h\252\272\bwT~\\\231\373\373v\035\371\302\244<\326\255\234"
+	.ascii	"@a\362BhA\"\204M\017r\177~\013R\334\027VgtvW\334M\343\024\365"
+	.ascii	"\341\235E\306v\327\200\f)P\234\262\354\350p\223\264\271\2615"
+	.ascii	"\n\240\261=\326\245\324\f\230\251\225\367\336\220\311\353a@T"
+	.ascii	"D\337\363\247T9\0216\255\316\306\352\235\311!\356\31716V`\230"
+	.ascii	"(\227\277t\357\024g\211\016\235Cm\0257\372\336\367Lx\354V\367"
+	.ascii	"o1Bue\367\347\007\217\355\362\306tY\205a\n\226\t\361\234\020"
+	.ascii	"\316\bg\005\037\r@= N\031\b\037\f\035h@\247\b\332\007\0214\017"
+	.ascii	"g\206\037\016=#\200~\026X\206\263\331\202\bX&\304s\236DFE8\232"
+	.ascii	"\016\213!!\243\237$\245\243$\245\033\fW\303\371\330l=+n6[\020"
+	.ascii	"\200\024\265\243uMVd\253\315\214\212\202T\314jH\270\231l\307"
+	.ascii	"\267\243!\244Y\322\355\2064\203\001\353\305\272S\216\341\200"
+	.ascii	"\232Q\336\006\216\033`L\331\315\215a\333\\_X\332\335\253\324"
+	.ascii	"B\"\201\220\022&\217\310\304);\271\345\276\no\307\270\344\270"
+	.ascii	"\007\0021 \200\002\021\262+\017i\036\032\345\325\347}b\204Q<"
+	.ascii	"f\211X\263\3676\266\345\274\033a#\310\221q\f\035\353\017[\343"
+	.ascii	"\356\311[\364\005y\031\034\247\347\222>96,\fBN\363\234\213^W"
+	.ascii	"@`\315\273\265d\265\317$\027&x\330\333\320\370\b\266\030\023"
+	.ascii	"\031\216E\244Y0\327\253I\272e_\001\313/\327\322\027\372\252\001"
+	.ascii	"\340~p\243\377\257\311j\225\265>("
+	.text
+	.section	.gnu.lto_cliMixer.291.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\006\325&"
+	.string	"\272F\240\017B`\250Q\007q`%\240\257\031\263\312\352\267\001^\211\320\303\263\337\273\025#\213\001x\234h\020\036:\210\033\350\324\b"
+	.string	"\334\227q\273\375z\273\027u\320\275Wg\267oY\r\341\337H\337\004\355\275\245L2\245\346"
+	.string	"\326"
+	.string	"\354"
+	.ascii	"C\366\264\2159s\316\016\034\367\003\3251\323u\333\355F?\256>"
+	.ascii	"\026\304\221r\0063\252\311\031\t\241\025\250\216\033\351>\324"
+	.ascii	"\261\352\001P\307kw \001X9h\241\315\230\245L\224s\376\275\225"
+	.ascii	"\366\376\264\013\370Ez\343\356\352\274\235\356(\2073RS\264\207"
+	.ascii	"\357\333\265=\350\2743\027\261E<3>\253x9\361\335\026$\256#r\341"
+	.ascii	"\372\262G\251\0301N\356n8\202\301\342x\270\240\334'[\302\361"
+	.ascii	"\263'\026\347I\017!\366\305f\264\365\265\034nY\342\352\305\240"
+	.ascii	"\310\251\346x\270\230\334\024kK\213\2339\002.\\Ml\212\353Z\342"
+	.ascii	"\250W9\361\236\343\341\272\222\353\022Z\214\212AY3>\247xE\361"
+	.ascii	"{9\264Q\262\265\353\302\2726\214\317 O\272\325\352\272\262\037"
+	.ascii	"\300m\352!\347\334v\330\345\345\215\344\335N\242\273\237\272"
+	.ascii	"q\210\304\343X\225}\263I\304\310\271_\3549:/\3633\300o\246\371"
+	.ascii	"C4\346,\364\341\rU8\201\201\343\276\366\350}\257\345\300\223"
+	.ascii	"\376\263\322\302\222|\256\254\242\366OzG\223\345Ve\337\332\310"
+	.ascii	"\372\276[j\207\365\241\277'\335\2150\303\344\247\363\352\203"
+	.ascii	"\335H+\327\020,\203\366_l\267L]\250\270\351\007\353^R"
+	.string	"r2\357$\037\363\366\371R\351\335\273\266y\327\366\016\333\326\371\230\373\221/\275s\250m\034j[\305\266\323\267\215\242\2661\266}\261\355\277\266\355\333\366\003?\334\254\362(\333\216\337D\346\255\267Ey\r\253\211\371\322]\351N\346\337\355gLW\310\334\205\023DD\032\023yY\273\231\022\b\221c[\032g\316H\t\252c\353\311\316u#\275\314\352d\355\306\263W\366\357^\317f\262i6\300\252\357K\327\263vQb\363\242\nS|Y\261c\216\221\362tb}\260\327\007\021\232\372\3056r\242.\275\0223\214\033\332\016\004\355\265S\241\352\373\024\031n\207\251\276\233\371=\364\374\023F\r\200!*G\322\004\326\313\274\316:\306we=\252B\020+\231&\353\303\3663\315\2575;\fS\242\027\360\320\t\353=X\247/\304\200E\345\200PE\250\302\016\f\034\217 a}\230>\223\360\203\235\364\350\343\266\240\b\312r\303"
+	.string	"H\350\304_\354\356\001\026\277\227\371\033\024Jl)Ta\205V\261\302\372\260)H\301\372`\017g\323\002C\373\032Wsq_\304@c\240\216\361\377\260\250E\360\377\373\003\224B\242\225}k\373\377\236\345\3263<\215\223\232\363\325\205v4\236\366\324\236\305qC\331\300\3556P\307\366y\313\264,\001\r\302D\323\t\246\017#J4\26181Bw;\003T\024\r\247(\240S\217\246\\\363\240\002F\341\246Z\300\224a\n\312\007\320\004\256\035\3509\240\242\036*\0070\252\006\216\247\264\237\""
+	.ascii	"\243\236~9\200N8~OST\277\b\276\226\322\0015\365\343!%5\365\313"
+	.ascii	"!\253\374\301\332C\325[\301\341}q"
+	.string	"\217#\275\222\242g!\253\246\031\332\027\330\233\335=B\372\334ku\363\276{\206\017Z\213\n\330r\316N\fhH\250\312\276\265\373ZDw\317{\317\375\356\t\210\021\021e\271\021H\373j\323}Q\367S\270\327\275\373i\322Y\023~\036?df\216\034\315\377\254V\024\\\301\242\nY\204\035\245,%9\202\311}\261\3239;\245\3671\217Gz~\307\221^\253\327\034\367S0\234\017\033\356\375\314/\363Y\350\251vs\003\333\275\212\255[\222\356E\230c\220O\247\225\321\027\227\002l\250Q\034\345\0344\206\231\231\221HD\333\244\003p\002\221\271\262n\021 Q\213lS\320\314\001\241\217z\035\343\365\374\263\027\237&\321'\r\036\260|\243\274]x-\225f9h\267\347\2546d\211\t\302\002\377$\374\345rk\313\0073N>j\300\234\265=\332\343\311\330\034WP\235\265\234\2244\3536u\274\227\341\2260d\315-Z"
+	.ascii	"\361\017\3639<4\230W\360.0\007=T\242\223dT\350\204\337\2278\217"
+	.ascii	"\"\276K\254\212\036\353 \350h\372\256?sd\217V\020\214S\022\320"
+	.ascii	"\311\370@\rZ~n\2571\3674%\304\270\202\254Q\3623\310k~}T\271\231"
+	.ascii	"ZMi\246\213r\366CORu\254\220\234\030\362\376\1777\020~\367\352"
+	.ascii	"(\031\b\370=5\272\216a\261\337?z\265\363\226\023p\263\00161\262"
+	.ascii	"\254\241\036\030\243\226\001\223\362\264)!\r"
+	.text
+	.section	.gnu.lto_cliMotor.292.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\365\bE6"
+	.string	"\252_T\025DPdR\007\223\253;\356\350\362\344\263\206\021\250hW\360\334\241\331\275\211L\310\223n\244\350\304\354\023\315h\261\016\206H\006\327+q\b!"
+	.string	"\210\250\363\006E\367\343U\254p\321A\026\331\232\021\262\367\336[\312\224\002B\0012\001E\001\373C\032\027\2062U\032\224=>X\223X\331\233\215\302\230*\342\216\333\357\324cUR\335;*\001\216\276\230\370\315\374\355\367\326\376\036v\254K\252{\357\343\267\216\204\2775\262\237\335\237\354\313\342\007S\365C{G!c\333;\n\301\031\300\337z\364\213\356\267\360\023\271\337\306\356{\214\260vr\302\335\225I&\320\336[I{\3010\321\337\353\365z}6\372\336\323\361\027\003\020\001\030\"\016\205EA\340\317\327\203_\267eu\216\375}Z\311/\006\220Ry\""
+	.string	"C\354\213%\244\312\3079\247\260\025\004U\323|[\223L\374\372\241\360\255\276\276(\316Ye\355\231\203\257\206\256\255\260\007\3069\231\260\306\275\367cq.\311?6A\224&x\037\347\004c\215p\250\314\307\342T\222}q\316$X\271\247@\312\026\222\207\337\261\2604\256\177\331\013e]\246|\234\223\213\325fhl^\372\n\2608\305\262\313\364i-\335\"\330[\230+\350rr\3516\312\312\204O\327\026\222g\335\261/*\031^\327\226\330k\366\3013\016\021\241\326\025[\244\003%\317K?gi)s~5\354\275=7\265\266\336\005\274\373kq\367 \356\257WP8\207\2005\004\253\222u\331N\3428\322\367\300{'\377\351$im\202\364\306\335\367\374?\341\257\355\334\321\215\364\355P\003\341\334\250x\325\253\234\247\345\352\314\314\264D\371\321<Z\212"
+	.string	"s\315G\363lT\034\315\355\275\374&\013x\351\242\301\267F\332}\211)\177\323\200\316R:.\324\345\221\262\217\025\033\314\356.\236\3627\375\245tE\250J\"\037t\306h\r\365\034\356\353\026gtWY\220\373\262\221v\217\222\312\337|\375\322\377\037pmN\274\352\225N\272G\223YC\335\277\002\020\2672\256\243\270'!\217H\f^\355\335x\300"
+	.string	"\2017\373\200\007\363o\364l\357\3047{\037\376\230wa\360\323\336\201?\337\233\275\347f\207\333\354o\233\335m\263\267\177\346\235e\263k6{\326\331?\202\216?J92\326\036\372Nt\013\271\022\332\3246\315\330\263\375\253\375\233\375\217\371/\363\237\366\177\346_\367\251\177\233\377\330|\340\261\276qz4\376k\376\373Vm\207\361*\272\265~S\2616d\201J\300\337\376\237=\231G{3/\365\337\031\177cwZ\007\253\020+{\007\013\362"
+	.ascii	"\355\036\227\305a\3627[\375k_\224\326\035!\240\007h\317\315>"
+	.ascii	"V\371\032L\220\207l\357\334\243\371<\034\032t\200\2270\032x\370"
+	.ascii	"PW7\344E\342\305\004j\350\334\337p\265\236:\203\033^\257\201"
+	.ascii	"\270\376\206\233\265\326O@g\021vbh\314<\253|\025bY\003\362\353"
+	.ascii	"\r\365\001\235\345\275\240&\320\373i6\277\277\271\007\264Q\331"
+	.ascii	"\030\235;9<\006\210\224u\361i\250\347\260~aNa\244v\262.aN\331"
+	.ascii	"\343\017uV\225\225\2149\205\223\236\b\234\033\030\326\200\026"
+	.ascii	"\302\300\025nK\366\370A\330\247\201pmy\354\361\177:\253\312\025"
+	.ascii	"j\007e^O\356\344\330\275\367\356i\250\277\364[\353\030\023\355"
+	.ascii	"E\322\356\006\265\267A\r\324Y\316\276\277\036\036\353\027s\352"
+	.ascii	"\036\265\263\355O\373t\026\217\247X\035\025\357\347)\346\017"
+	.ascii	"\302M\322?\210\016\217\272\324IG\376P#\365;\r\233\263|*\363\325"
+	.ascii	"\337\315\277~C(H\022\036\220E\214\310\337D\232C\275\222\363/"
+	.ascii	"\245\223C}5\324\223\376\250\035\224\201=\271\223\303S\224\221"
+	.ascii	"/\324\356&P\344o\036\265v\243k\243b\351\244?\234G\340V\rTM\346"
+	.ascii	"B\377\004J\035\031W\007\336td\264@\303\b\005\2654\364\246#\243"
+	.ascii	"\205\246#c\320;\230\b\261\341\204\353\306\374\364T5dP\325\020"
+	.ascii	"A\374\340T\003j\351\304\224\024\225T\224o\212J"
+	.string	"\206\223\215%\032\357\013&\031\032\207SS\214\247\326)\306\023TS\024\323\353LIOPLJ1\236\226\242\224\230\246h(%\025]J\206\323\224\022\225\224\324\224\322/\272\325^\203\225Vf\217&\325\212\257\032+O&\005\360\214\024\tP\305\356\335\225\241j\226\257O\364C\322\2727\252R'=H\307.\f@^\374\004\n\274\214\177\355\001H\353\312\250X:9\244\241\036\0244d\240_\260\242\343\023u\026Q\367t\256r\006\007\353\236~f\036\204\354\036{\305S\3627a\375J\234(u\362\025xA;BD>Q3\320\005\354\250\260yW\274 \237\036\341\275\372\333\236\204\035\2259\313\252U\276\352\003qg\354\206\017\262Q\263\372\247\017(\246\222 \036\203\2273\342+q\226,\255\273\342jw\267\361~|\232`n\357]\301\277\317\337\305[\374\305\276\365\230K\354%\1773\366\342~\373\315>F\355j\001B\304"
+	.ascii	"-\253\332\fl\216\360\365\032B_E:\312\225\325-s\r\2273\272V\033"
+	.ascii	"u\266.\341\002\200\260\250q \244\224SF\231\031\031\231\t\222"
+	.ascii	"D\035`\002\031\272\252n\021\260\265T4\232$\303\030e\020\020\340"
+	.ascii	"\335r,\215\001V\374?P\250x1\226\231\210\b\2732J\302`1\216\311"
+	.ascii	"Q\354%\376\223\344s5\321\200\223\307\237\320H\232\027\225\020"
+	.ascii	"\360\205.\204\013\024\266\211\023\235\237\233\217GL\004\211\375"
+	.ascii	"\277%L\316\004\307u\216"
+	.string	"\320\034\257\366~\004\262%\201\025\211/\311\222\207\037\271\016a\306\024a\250\335\317[9\360}\333;\371\224\031\300\222p\201\224R\223\265gm\005\237\022'\241\362)\370\022\334\235\314\356O\363pM\266ZO\315\203\225\315\203b\027\224\237\rVL\"S\371\017\346\272\304\326\371\312\272\313_}\307--\365\005\363 \216\326\215\372\265\330\354\205\275\b\257\213\244\310\235\b\320|\202\232\\\263\231\314VA\3152\374\350\307\001\335D\312\274\207;\340\375om@\263\030y\363\274t\250\240\334\312 \fD+\361\253\215\262k\210_\220\266\330\210\0377S\030E\354\222\372 j\240P~~6B\006AZU(\254\325a\374\022\001B\333\035\313\023\177\375\254\303X\237\177\026f\247\251{\"\261\017\004\236\013Y/4\035 \220\366\375AH\340\301dJ\032nxI\022X\300\026@\263UT\254\364\341\232\341\017\fY\265,\365\201\353\246L"
+	.ascii	"\370\246d\251\001"
+	.text
+	.section	.gnu.lto_cliPlaySound.293.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\354\004\r\""
+	.string	"v\274\333Ip\332U:\021\311\227\314\333\231\271\251D\230\200\230z\263\341\334c\310E\314_\006\266"
+	.string	"\321z\026x\231\t\323\255)\375\311\304n\301/6\311\b\205\022\231\301\347G\356k|\323g\005\202\371-F:\246d\263O\202\b!{'\031\304"
+	.string	"\270"
+	.string	"\314"
+	.string	"\315\242\253m\324\375\333\375&\347\022\336I\213\003\310\031+\212\225\234\233\007\272"
+	.ascii	"{\265\233\007Z\257\262\377Y\257\266\260\033\032\240*\017\027"
+	.ascii	"D\327\030\277\336\344\234{\330G\247W\370\035\235[\313\342l\253"
+	.ascii	"\232\362\340+\354\337\224\303\357\f\351\330\262\266ni\0030D\274"
+	.ascii	"\254=\256\370\270V\022\307mmG\027\262\226\274i\242\306\303J\307"
+	.ascii	"\331\234\221\031\307\335,y\245\225\264qm\351\003\256%@pJc\212"
+	.ascii	"\273\302\270\374\353CZ\311\034w\245"
+	.string	"q\025\247,V\335\224\235q\236\324\250\314\021\0347K\346H\177nP)s\255\344\362b\263\344\215\224\227s\376\327/RI\274\327v\224s\356{TZ\275{\336\375\265\273\245\272S\022\001A\370\222\235\255=\215~\261\016?L\361\212x\261K\351-}!=\325Z\324~kY\257^,\005gm\313\206\213\273\366$bUd0f\266\212\365x\2043\r\325\205\323\355\355\301\335@\024\367\307\343\177\3750\312\304XQC\243\302\303\356\346\360b\246\032+\344\224\306X\335B\273 \235O\356N\376\2367\337\267\226\275\327\333\266\336^\325\333\252z;Uoc\365\366Mo\177\bC\301\310\210Q\343Ya9\313X\223\223\237*\226,|\337\374\275\216\273\177(\377j\235~\327\235\302{\365\226g\253\374\027d\242jh9\347\004\354U^\372\237\265\311\"\227\315\362\225\314(\034\264\234\003g2\260\305\nI\270\2626O5\264*"
+	.string	"n\232In\230\331>8\350D\223\363\301\227\f\312d\267\241\303\3751\207\177\006\335ju\367`\317\362\301\350G\316\305\037A\260E\005\006B\210\270?\366=\203.\237Tx(Te\331\206\305bK,.8\214\325,V\321\030=\305*\276\225\024\267i`\220\\q\3411g]Rl\230\331\27326D\324\242\017`C#\335a\026#\251\\(\r+\264,cSd\305\314\233s\036\252)\216\305P\3219\3061\036\035\266a\344\016c|-g\230\236\333\315\344t\177\304xj\007\321\206w\330C\034/\247\031\260+b\232s\316)f\366\317\300\214,\b\017\306b\261\006\341\240\023\315\316\325\341n\237\211\373c\035E\304s\320DT\342\347\233Zz\322"
+	.string	"\324MD\274\025NM?\037/\b$\301k\372\245"
+	.string	"F\361\200HA-\001\251C\322\006\036\005$\013\037 `\320\300SJRR\232\240\363\335\tj\351\227:\375|OMPL\266fB\340{b\352\375|KP=\246`T\017\001P\003O8\005{R@`\260\247\323\314?r\201\211Tv\242k\3060\034\204?$mi\034k}\360\325\244!\215c\253\020\276a$\326\261\3214\035\306\2616\207;]Y\334bd7\321]\225\b\267x\004n\213\273\205\\\302'\367\307\025\027A\311t\367\206\3332\b@\021\330\242\b\f\355\362,\342a\013\270\335\024,\024A\271<\211x\330-\376\302!\316\226\333\034\033\322C'\207\017\366.\027\004\004b\250A,\003\225B\310 B\"#\001\215\250\230\003\200\002\221\2423\017\020pY\223\264\006\306\033\353\303\213}u\"%\023%\264\233\f\r\301f\252\020/\360\336\266"
+	.ascii	"c\264\207Q\346\231\330S@\227\033\312\020H&\242\315[\007\330\306"
+	.ascii	"j\201\324\002\344\271\334\273n\346d\222f-\034{\335\243(\311l"
+	.ascii	"\252\272\352\367\203\213\260\231`\356F\261t\313\030S\330a_\241"
+	.ascii	"\210H\f&\304\374\371\225^}\300\255\333\364R\232\037\215\231\275"
+	.ascii	"\324\233\227\034\0244\340\005\237p\204ho,\256DF\n\213\221\"\327"
+	.ascii	"\004\006\007V\016-\370\216B\021\235%\005pTN<\355\252L\22646\240"
+	.ascii	"\303b\fa\245\365B}\212C\332\3723z3\272\006\n|\\\031x\005\215"
+	.ascii	"\021\377\001"
+	.text
+	.section	.gnu.lto_cliProfile.294.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\r\002\315\022"
+	.string	"\246\243}H\300VQ:\025\034l|\2548\337\022,\277\245x\351\372\364\265g\333P\022g\306\374\376\261\373\365\211+\255\n\372\373\230\177k\023\005\204\350\267\220\301\022\f\222\240X(X\332\336\324s\n@`B\300\311\200\326H#\233H\231Rh"
+	.string	"`"
+	.string	"l"
+	.ascii	"<\346\32450\202\360\322\272\257\200\227\341U\300K\307\354\036"
+	.ascii	"\201\234){\2604C\247\250\311"
+	.string	"\234s\265,|\257\306\036\236@\371\255\306\374\232\354\341g??\245d\370\034T\325t\316\243\251l-\335\224\254\350\371\371\367I\270\t\265P\325r\276%2:z\356\272S\303\321U\271\236^\346\234\326\261\326s\243n\373\204\355\b\266R\b+\263u\262\177s\316\271\033\344+\004!@\\xm\366wwJ\252Q\307\335\341q\277\004\325\237T\357\247\326U\037\300\004\245#*N\343hN\236\246(\023I\366\210\361\335\355\353|^\215\023\305\276+\361\3313\217\002\306R.\311\234s\301\245\031\204\227-\337E\333W\373C\277\305\2163\361\2249m\270\027{L;$\211\b\207\334 \333*\272{\335sl\030P\204CHs\340\0160\372\321-9+\263\356\356u\3500\315\264\311*\265[ \364\243\006H\3529A\272aIq\023\372x?\360\003|\321m\270j\240\020\021\232\223\3661DHsQp\351O\345\206\273c\223"
+	.string	"\277\036vFp\364\211Q\032\256\375\022\241\037\277\317]\3541A\302\t\216I\320\322\222q}x\301jD\337\365\026\215K&f\206u2\313\305%\303Z\321\270`fV,\230\315\312e\305\257\232\026l5\342\365\202\255D\335\374\332\3742\333\233\027!\213\332\025,\344\376b`\007\220\322\251\200\242\326\276\200\341\274\247$!\361I-j\255\343\222\2316\335"
+	.string	"\262\371"
+	.ascii	"7\310z\033\360[\330.Hj\277\025y\206\214\004d\320\240\037S{^*"
+	.ascii	" \200\202\031\272\353\237\030B\321r\317Q\177\255\225j\341\021"
+	.ascii	")\345w<!\255\347x\303\314\004\250\371c\344\265\363\303\262\326"
+	.ascii	"\260\277_\314j<\"\r{\234l\331HMN\366\3028\003h,\250I\2640L\200"
+	.ascii	"\016\347\235\275\261\346D\347+\202\244\342#k\032=>\375\252\215"
+	.ascii	"_\2601>~\256\265\317\t"
+	.text
+	.section	.gnu.lto_cliRateProfile.295.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\021\002\365\022"
+	.string	"\346\343~H\300VQ:\024\235\304\032\r\361\220\222\025\377\267@\fF\007?\252\327S B\216\350\357\361?\177\331\225V\005\375}\314\255\342S\025\212\223O1\211\006I0\210\202'\242}P\006\033\242zhF\245\307\324l\311'\233H\231Ri"
+	.string	"b"
+	.string	"l"
+	.ascii	"I>\346\32450\202\360\322\272\267\200\227\341Y\300K\313\354%\004"
+	.ascii	"x\346\354\201\223\220\236\243(sNq[\370^\225=D\201\362[\225\371"
+	.ascii	"\266\331\303\323\202\216R\315Hq\220e\3539\257\246\322\345\264"
+	.ascii	"\324\204\005P\320\277"
+	.string	"/\002\216\310\005\313\306\363\255\021\222\322\213\256>\266\035]\226+*f\316i\035m@w\352\266O\330\246`\353\204L;;\263u\263\177s\316\271;\344+\004#D^xo\366w\267J\252S\317\335\341s\277\004\325\237T\357\247\326U?\200\204)JV\034\2474\347\317\023\225\311$\177\310\370\356\366u>\357\306\215d\337\225\370\004\232G\021\303\251\b\2239\347\202K3\b/_\276\257l_\355\3338N\366\234\211\257\314y\013{\336W\275\334\036i2J\222;d\233Ew\257\373\216\r\003\220p\bk\016\334AF?\372\205gg\326\335=\217\236*4}2Km\027\b\375\250-:z5\230t\\T\340\210>\336\017\f\001\177t\034\257\021S\240\020\315Y\373\030\"\254\301(\270\364\247r\303\365\261I\200_\017\273$;*\305)\r\327\206\211\320\217\337\027}\325\243\021\236I\360\342\242y}\200\305n\\921"
+	.ascii	"\376\353.\233\027\315LM\013\345\026\314\213\246%\332\274dj\304"
+	.ascii	"V\fG\204i1\354\306\025\023s`\260\230\270\322\315\357\3151\264"
+	.ascii	"\325\201\021\272\250]\301B\321c\f\364\020z\202*\240\251\265/"
+	.ascii	"`8\357+M= \252M\255utB\323\247\034B\267 \340\016Y\036\007\374"
+	.ascii	"6\266[R\355\267\253\237\034\222\200\f\032\364\243** \200\202"
+	.ascii	"\031\272\353\237\030B\321r\317Q\177\255\225j\341\021)\345w<!"
+	.ascii	"\255\347x\303\314\004\250\371c\344\265\363\303\262\326\260\277"
+	.ascii	"_\314j<\"\r{\234l\331HMN\366\3028\003h,\250I\2640L\200\016\347"
+	.ascii	"\235\275\261\346D\347+\202\244\342#k\032=>\375\252\215_\2601"
+	.ascii	">~\256\265\317\t"
+	.text
+	.section	.gnu.lto_cliDumpPidProfile.296.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\355\n"
+	.string	"6\224K@\020Q\234\016;\240\030\300\003"
+	.string	"T\031a\217\244-,\331\002(@/@5h\004\341\360\223\r\370\t\373\266\330\240\031a\237\333\303W\325p)\342\204\001\3745\253\241\253)\252\313\201_#![\312\224\0029"
+	.string	"8"
+	.string	"6"
+	.string	"\245\365*2<\276\0233v7\323\021\357\0365;\037"
+	.string	"\350=b\034\256\361"
+	.string	"\352\203G"
+	.string	"p\024'-:\276\253\236\031@R&\304\262\273N\023\270\341\266n\373\201\355\006\366\t\0044\266\303ZA\302\366#\2665\355\2278G\367\020C\034\260\244\020'\006\330\255\311%\327\255\370\002\327-g\332\013*\3357B\326]\017)T\354\206\n\234"
+	.string	"\273\345\316\206a \276Fu~5D\271\372\007\210\025\n\325\224\363\241\353z\325\021|/b\230pA\312\017;\364RS\366\343*\312\316t|\370\3537\376C\034\2108u8\007\213]\r\253\024>\227\b\036\016(\203]\320d:\0204\033m\302\306I\310h\036\001\306P\264\r&\353h\027N\206\341>\031E\342\315\243\341\262\n\333\306e\221po\021\351(^\251\006Y\310\233|\325-%\365\002\021"
+	.ascii	"\357b\310\f\rF\364\b\220D ,\354\245\252\2077\3278Jb\\\020\256"
+	.ascii	"\211XY\320\2460\304\224\032-\356rS\355\321\300\324\036"
+	.text
+	.section	.gnu.lto_cliDumpRateProfile.297.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"\365\n"
+	.string	"F\324K@\020Q\234\016;\240V\240"
+	.string	"\025\242ca\004+\312\001["
+	.string	"\035\302s\344:\355\004\365\360y\006\374\204}[\032\242\031a\2176\262\272\253a!dl \264\b\214\254[C\241\025\3674!![\312\224\0029"
+	.string	"8"
+	.string	"7"
+	.string	"\247\365,\036\033\276\0233v7S\020\357\0365;\037"
+	.string	"\350=b\031\256\261@\252\203G"
+	.string	"\260\024)-:\276\253\236\025@S&\344\262\273N\024\210\341\266n\233\201m\005\366\005\0044\266\303Z1\302\366#\2665\355\223x\211\356!\205(Y\323\007\013\026\354\026\345\223\353V\374\200\353\2263\355\004\226\356\034#\353.\007\026*vC\004>\200\335rg\307 \020\276Fu~5H\271\372\207\207\025\n\325\r[\037]\327\253n\340\203!\303\204\013S~\330\241\227\272a?\256\246\354L\307\207\277\236\343?d\201\210\020\032\236\342\305\356\205U\021@\030\007\237\216H\203M\3204\236\006\032g\003a\343\036h!\f'q\246\262\341d2\317\006\323\3112\034(\253L\274}4.\013m\033\227E\302\375\205\244\245x\245Z$!\217\362U\277\234\324\013\021"
+	.ascii	"\357b\310\f\rF\364\b\220D ,\354\245\252\2077\3278Jb\\\020\256"
+	.ascii	"\211XY\320\2460\304\224\032-\356rS\355\321\300\324\036"
+	.text
+	.section	.gnu.lto_cliPrintCommandBatchWarning.298.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"\005\f"
+	.string	"\026\026UB\360T\234\016h\270\332\220B=l\333NF\232?N\212N\032\321\354C`\021\035\273%\243\236\374hD\244\357\302\302\334\310\311d\265\322\344om\241\\X5H0u\225\271\374\036\205\254r\360\330\310\336;\245@"
+	.string	"="
+	.string	"F"
+	.string	"\237\r\204\200\210\005\031\020)!\2511dw\267\331\342\337\351\224\237\377\223\003\bE\360\364\304'5\300CG\214"
+	.string	"\342\212\036P\261\302\365\223\313\021\242J\312\312\203\335\265\fE\0237v\333\035\333\235\375,\366\b\312\311\302>\335\335\365l\3317\371i\346"
+	.string	"\206\215\024w\005\331-\221bd_\030\216\027\027\333\227\366K.\343\273I\352\002v[?n\354\216\031#\260\034\363xLv\314\362\001\3311\007\336\326\341t\362\266\313\270\247;[\276\240\240x\205\230*\232I:\357B\021\245\270\203D\216\351TF\347$\351\221B\303\307J\026q&?~\206\207\002.vY\017Q\026\326\202\004\307\354\017 \344C+\020r\344\265\232`\356|<\025>\036\321\007\264\321*\007\222P#h\243\352\261P9\255\206 \324\t\024\264\214\306\251\242M\025U\216V\271:\322B\034\210\343j\003\f\246\222\311#\241*\3564\245\f\335f*\2214l\235\307a\323`|\332p!\020"
+	.string	"\357b\314\304c\240\341\276\206m\303\262\243-+\341\021\320J\302\256\251\301\302\203y\227"
+	.ascii	"\232\325\024q\227\247jr\212\246\366"
+	.text
+	.section	.gnu.lto_resetCommandBatch.299.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\345\006"
+	.string	"\342\013.4@O\324\001\270\275\353\262\225\274\016\344\265\342} \004\002\352:\255\336\201\206\212\210@\f\245\331#O\023\024:\3361\f\004\253\307\313jO\267\333\320\272\355\336)\005\256\322DU:Q\225*L\007\t\264Z\fT\np\265\200`\321\206\252\262ht\331K\320\240b5(\233\204\360C.\3420W2\341\257\307\3778\310\345g\370\001\213\357>}\354\371\204\270L\207E\250\262\305\215}\321\242\274\260\357\254\004mG\246lx\022\024\307\234\354z\233\226-\231$\032\266\0379\263M\004\"V#\320`\270\021\226\335\245\022\343\331c\346\337\343"
+	.string	"\335\247=B\005\273\353\330}\023\267\374\200m\216\r"
+	.ascii	"3\001\2138\303\361.\201\035hl(\234\221\024)\256\211t!\344\227"
+	.ascii	"!\300\245\033\263\265]\247\005"
+	.text
+	.section	.gnu.lto_cliBatch.300.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\233\001\315\017"
+	.string	"\306\\hF"
+	.string	"\221(\035`\\\n[\240\357 t\007F^\t\017\261\362\210\210B\373r\314ZU\nH\275\210\235E\373\177u[p\022\305\376\203\267\261%X\317U\325k\241\274E@\304\034\331\225<@\b\266?\021!{\223-S\nP"
+	.string	"Q"
+	.string	"W"
+	.string	"\007\241\237\332\003\320O\227l\230\002'\325\264\300\025\003C\313L\255u\223\"^zF'&\267\344g\234\01604=\323V\247\031\007\fW\237\034\216i\302\223\324J"
+	.ascii	"\241\n\333\324Z\217\342\233!D"
+	.string	"\355f\234Z\253\027\f7\334\332m\177\266\035\330w\t\340HS!\b\371\244\322\256`a\017^z\274x\020]1*i\262E\324\312\226}9\216\343h\311\262\277\362S\271\336]_#o\314\240hX\335\305K\255(\343\253\312\230.%4\266\277\366U~\242\364\225\013\377\250\225\245\002\243V1\201\rh\237\026\003\356<{\320\036/\037R\\1)i\232\262\265\342-\"d8f\274@\250\310\374$\312\342)/\033&dj\255\025;\211\256\364Xj\370-WA\362I\370S2\375\022\372\271\222\301\013\306\325\341\264\343\245l\371\300/IXh\2446\207;v^D/>\005\005\255V\325\003\356x>\217\373F\033\t\335\307\221l:!\016\004\0225\030\340\317\343\276\021\365\204>&\035P\227\271\023\371\230t[\350\303\201\266\316\033m\" \026M\360x\333'\022y\233F<\035\273d\215\204\020]1'\211\3022\001\373"
+	.ascii	"\302\0364&MK?\366\342_\214\020\030\301i*\005!\237\016' \260\202"
+	.ascii	"!\261\365obL\221\035\343\367\261\315ZBT\301\b\305\341\316 c\231"
+	.ascii	"Mb]\201!\254\233\262\326d\355\016\320\210\032\311\272</,\035"
+	.ascii	"F8x\360H\247c\031\356^a\203\311\302\370\200\031B3O\031.\341\200"
+	.ascii	"\317\001\237\337e\271\321uU\272\255]z"
+	.text
+	.section	.gnu.lto_cliSave.301.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`=\003-\026"
+	.string	"\206\344\211L\240\324U:\246\3406\362\026^\006\351\356\030\217s\353?\315\037K\035K\311K\300\206\023\207\227\036S{\211=\327\331\377\350\223\216\007\033tcx\032o\"\227\177L\354\232\362\202\367\f\242\230)P\351\361\247\236XVZ%\204l\262\245L\001s"
+	.string	"h"
+	.string	"x"
+	.string	"\262z\202w\214\342J['\350i\332\262\366\356\334\032\362\030\305\225\236.G\304\"nM\001\021\225\261{\357P\237\250\034\021\213\214N\001\025\331\310*J@B}\006\261\371\032\002\323\341\257\355\215\211p\311\021\321\210\313r\201\257\252\310u\005$\222\016\177\272\2260!\213\340k\350+\017(yJ\262\221\273\304\260\327}\272\334{\337\301!\221\377\342\377B\376\323\376j\003\254\342#v\232\203l\317;&[\256X7\212B>\235\365\037y]\223~.oE\372k\337\354\276\355~\331\375\332\375\356>\013h\220\344H\020\007\301q\2570\253\311EZ\037-\322\377\334?\313\340\031;\246\321\303"
+	.string	"\356E\212\321\343\336\243\202\027@\331\376\3100\223-\312\001L\266\337\375H\b\370.\217\201U\026\260\251\352\336\033\265\262\366\374(\236\260\3761h0\"{L\374\231"
+	.ascii	"\232\265\3260\355\330Pk\013\026\217\027:8\f@\321\001\375\305"
+	.ascii	"\320 H.U\030NE\240\354\253\377\033\316\b\331\253\274\247\315"
+	.ascii	"Gv\372`\300\310\275?\016\336\240\277\004+l\177]\210\346\3409"
+	.ascii	"G\222\b\371SyoZ\032ZQ\326$&\356\352\240I\247kJ\n\356(\237\320"
+	.ascii	"E=\217\311\265\206\211\352\247\257~\256\3016x\036\307\341\344"
+	.ascii	"H\320\350\234_\231]x\251\255\304&\314\"X\210\325h34\332,\226"
+	.ascii	"\001\346AlV{\231I\240\220r\303\311\331x\270\261\235\267\261\344"
+	.ascii	"ll2\234\034\315\215\314\226\243#c\201]\007\342\226#\023\241\323"
+	.ascii	"\345\310\322\343e\027\237\332C\331\031qX\310\236\353\005W\223"
+	.ascii	"\3114\245\315\372\317 4\007\037c \034\005\023##c\2625k\013\226"
+	.ascii	"\224\325\020$%\252\226\205\232\261\265G\352\244B\024Z>\005P\250"
+	.ascii	"\201P#\031\263`$\005)\247\260\r\300\002\231\261\352\006\020P"
+	.ascii	"\350\246-\f\007\337\274\004\315\357\223r/\361-i\226\306\243Z"
+	.ascii	"\204\247c\370\345\311\025\341\275\332x\363\317*\231V\252\250"
+	.ascii	"-ooU\f3\273H\302\226m\335\001zj\220\203\027\342\251\220\272a"
+	.ascii	"\366Q\277\351Y\024P\253@,\\P\201[YB\237OXs\223+\373\016ecw\352"
+	.ascii	"#e&u\023\356\256\365&\240\231\241N\223\230\275f\200\303#1$o\203"
+	.ascii	"\203\3466}\033\234\2604\177\345\3514\332>\331\237\262B\256\002"
+	.text
+	.section	.gnu.lto_cliDefaults.302.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\313\001e\022"
+	.string	"\006\343~I\320\360(\035k\177L\374k\244\306]\200`u\363B{ $\b#n\240\222\265\243\330&r\336?\211\340\313?\352\016N_}Q\242\314\255E\214`\257"
+	.string	"\bZ<z\002\232\355^\n\341\003~\311\035>4=\223F6\3312\245i"
+	.string	"b"
+	.string	"m"
+	.ascii	"\265\336\370\020\325Z\"\260\001\361\324\345U\341\251x\001\341"
+	.ascii	"\251i6\016\221\231ZC\361\271\240\tj\252\265\256\346\210\323\036"
+	.ascii	"Rp.\315\007\260\253=\024?\234\342R\273\231\005A\025\r\233\033"
+	.ascii	"\037;\034X\002\302\310Cjw\333\t\226\364b\350\370\330\331@\225"
+	.ascii	".'\367\237o\315\356\266\213J\251\265zs\273\0167\352\266[l?\260"
+	.ascii	"w\003\267\335\341p\351\264a2\354s\237\377\3719\034\355\0209\365"
+	.ascii	"n\263f\227\265\2358\366\347\357\367\373y\336\330\357\371\351"
+	.ascii	"\313{\316\365\356\372\251\230'[R\220Oh\326(\253\356\307\243\""
+	.ascii	"Q\031:/\177\373\377q\312"
+	.string	"\tPh/g#\265\262\352B\035\243\"\236\246ZK\223S\037\020\277\366y\276\202\366\236\230\203\004J\347\335\177\361\241\231_\302\016T\250\257\022\236J\350\301\224\"\207\314\376\034\2626\204\b&L>H\266Y3\310\036\350B\023\b\220`\211\270\024\222S\2735\356s\336#\02559K\033\300\211c\223\357\324\300\263\021`\303\273\302\003\235E\005\261V\334s/\"N\001\311)ya\237\333\031\022b\247\347\324\303\355\214\031\235\211\351Y\370I\201\247\024\216\311\\`X,\343\312\b)\033iy\271d\26216\302\006\230|\241b-.\226\027\271`\304\300\212\245\306\227\313e\345\245\205r\353\304\345\322Z\275\\\254\227U\013\026[\235\250LZ\030a+\031I\302V\251\262>Ef\332\300Zk\r\013\254\315\240\301\274\f\217\315\t:q|_\021M\213y\336\217\3027D\003c\377Y8g\215\3559Ez\236D,%\005\037"
+	.ascii	"\306\214\361.\260\314\320tF\260(@\203\203\300\025\232u\261\261"
+	.ascii	"\356.\306\337\314\036;n\365{+\"]@\022\202-\030\336`\034'\330"
+	.ascii	"\210\225U \213\253\335t\214-\355\232\315\205\313\343l\344\251"
+	.ascii	"\246\201\013\211\342\276#\214\004\311\216\323\252("
+	.text
+	.section	.gnu.lto_cliOrnithopterDefaults.303.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\332\t\355."
+	.string	":S\214\022@@\346Q\007\204?\317\016W\376\363'\303\305LV\302\311\366\305\250\2753&[\373\217\b\374\031Px\320\356\313\370v\300\030\013\353\032\206;D?\377\342\276\302i\203\n\022(\242\310\234m{o\231R\n\371"
+	.string	"\023\001!\001W\353\367"
+	.string	"\365\333j\375\256R\277\251\326\357)\365[j\375\216b\277\005\254\337P\352w\200\365\373I\375vZ\277\233\324o\246\365{\211\375\006\260~\007\325o\245\365;I\375\006\256\337?\365\233]\277W\366[]\277\357\372\375\352\267k]\220\302\243\315\243v9\373\210\364(\347\255n\342|\316\275\333\333\353\234Lw\260\317\234\256gL\203\276v\237u\007}u\037\323A\007\020\260\317\321\360\314\3142\fAj\026\3129/\360\265\031"
+	.string	"\375\273\375\213\203\301\036\306\206?\345\354V\207M\316s[}"
+	.ascii	"\350k\317y\024\353+\320\241X_\033w\363Q\341\310K\b\216\"\255"
+	.ascii	"\225a\224s\026^8\307\316\252\367q\373\017CR\223m\351,\021WU+"
+	.ascii	"%w\2040\261\251\251Y{\236\354\005\331\230\177\231\330\230j\233"
+	.ascii	"s\3661\376;\330\322\376\177\030r\316\375M6 \336?\357\356\024"
+	.ascii	"\335~\242;\t+\030\352\177\242\270\213\337\301r>\245'\335S\362"
+	.ascii	"%\347\034\301W;^Ii\210H\t}\241\343u`\260\276\252\367\347ez\327"
+	.ascii	"(L\201\277\242\3639XLS4\003\220\231\324\300aA_\222<\346]^\366"
+	.ascii	"\276}G\373\n\261Q\257\033\034\307\272Mz\322>uy\324\276\357s\316"
+	.ascii	"\313\3334X\254\353%\225\253\023\244\366}}\365N\347o\270\246\234"
+	.ascii	"93\275\371\001\310\354\322\n!\342\366\035\311S\273\313\236\372"
+	.ascii	"{\333\333M\302\304{\263[\034w\331X\367^\037\343\n\246f\322\364"
+	.ascii	"\354\246d\034\017\206z\347l\316\3605^\352\037g\316y\202\032\277"
+	.ascii	"C\241b\305{s\005"
+	.string	"\353k{\235\214\257A\234\360\335-JC\304\357\337;hm\352\364\335\303\257\313\326\365\265\345\245\335ew7\003GS\254\020\315YmB7\230\2371j9sV\213`\306\355^\264S\361\265\303\220\357M_\333\221\254\257Xw\302\264L\0277h\037\251{.\355\357[\267\253\371\272u\377\276[\237\363\306\362\357T\267jQ\023\374\224\020e\202\241B\347\022,\027lS\222\204\352z\036\251;\025\367H\360\323\3418\217`\250\333\275\0218\351\243\"mR\227e3\305\023p\243\026e\371!x\213\357\375\217\027\202\241\356\307\371A\240\322G\017\344\331\336;\016\353\253\200\373\3032\305[\272M\367\351B]\247\373\036X\002\\\250)\277\003?\0178\233\257#\307Z\200\353?\234\356S\225\307\201\237\026\242\257\206\241\017\234\237\206\345\202\320G\373\245\323uEL\267)\022~\372\034\347\024C\375\016\222\236T\372\310\021\323e\357L\327"
+	.string	"\270Kz\215\360\026\227n9#\fu=\347\",\347UmR\251\242D"
+	.ascii	"\356\317\315t\315z\1777\351\006\021a\270\246(\216\002d\372\020"
+	.ascii	"5\027\271\313V\272\301)^\b?\t\020\302P)>,\267\256\r\332S\272"
+	.ascii	"7\2007\251\212\013\302\317\n\2010T\030\305rA8=@\300\353\207\330"
+	.ascii	"\373\213s?\370\351q\372`\250\253\341\203\345\374\311nO\036{Y"
+	.ascii	"9\352]\257\307\005\232\263\226\305\363\340-\316\027\305\023\035"
+	.ascii	"cx\326\212\031\rt\214\341Y{4\016\225m\321\314HF6\034;\026\217"
+	.ascii	"\307a"
+	.string	"r8\206\325\311\"\221X\226\334\002\033&\211-\261H\226,\232\025\223\255\220\314\247%n\021\223\303\030\3122$\202\266\365\312\200\302\203\206\022\\]\304,\n\0356p\265\304,\n]m\013\002\204\210\021W\255\264\224\200,\013A\013V$\266\304\254\326B[<\202\211\rY\260@\232%\213d\006\232X4\036\307\306\206-\231\362X6lQ$\266\033\270\272\332dQ9\206t\2414\212%\221\005\332E\003\242qL\250t\001f<\266\240*\036\301\3042(\305\312\220aJE1\343\221\030\366\365\353\257\006\306\343\227P\3148\f\023~%\311\204\r\242\0329VL\n\225HdR\030\234Cs5_\267n\022t\373\257`1\312\251\032.\257E\313\327\327\323\206\357\373\255\340%fS\273&@\346\017\321\362\365\302\2227=\324~*\370\211\331T\r\2437 \323\367\264|\275\272;\202}m\362\320nZ\027\370\250;u\253\356"
+	.string	")xVw"
+	.string	"\034~\022pBys{bukL\361\002\200\233\250A,\345\230s\250&\020\221 \222\244@\215\001\320\002\021\031[=\021"
+	.string	"\235\"\314 eDI\271s\301\fPJ\235&@s\006P\311\032\340\201\217\330}{\006\324\f\216>\337y\242\205N\315\2433)\222\027\203\362\220\334\207\331\337Si %"
+	.string	"\rto_\034&\003\260B\307d\203\300\0315\200\217;*'\203E\016\026\321\253>\326Y\005j\207\027pp\007\023\001\270\220\n<%P\223\035\"X\201\020\211\365\r\370[\206m\321\352"
+	.ascii	"w\020d \205m\037o\322\342\027\301__f3b\005\3502_1\206QI\326\355"
+	.ascii	"N\026\300*\006\322\227\372\314J\222\002\002\002f\0022\260\303"
+	.ascii	"e\002,\274)\264\216\325\357dm\255$\354\370\2665\214[|wX\231\344"
+	.ascii	"o\001 \264\013s\227\377)\310\364\335\267\345\223`\361\007\230"
+	.ascii	"\007\330\025\212\302 \223q\200\032Cc\2602\226\252\352\271\007"
+	.ascii	"\241\241\351\327\t\r2\005<\3347\017m\301I\373/\225\032\250\273"
+	.ascii	"\244}\024\375z\345\275\257\264\246\236\206\245\232\b\362&KxU"
+	.ascii	"\225\277iE\202s1\345A\377\3002\220\375B\350\267b\375\001"
+	.text
+	.section	.gnu.lto_cliPrintVarDefault.304.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\303\002m\026"
+	.string	"\326*\227I\300VQ:\026(%\213\220\363\225L8\300m\036\023\226\255\210)\335\030\211\200]\276K\260\375\222\314_\371\250\0352\212@\022\234J\314\261<u\027\203cl\211\2638q!\376\t\212\n~\""
+	.string	"\222\277z\210\337H#\233H)S\200"
+	.string	"y"
+	.string	"\206"
+	.ascii	"UJ]\263\212\323\016\246ZO\233\245\257\021\227\377\335-\217\\"
+	.ascii	"\243\025\033\240\326\"(Jj=o\236@\\\372sg\302\245\342\n\b\227"
+	.ascii	"\236\374\265\354y\243\3228\345\020Bj\252\265\276:\267\344R\260"
+	.ascii	"\231\374noS8\263\\*cA\260\206i\211\227\321\f\002g\206x\340V\246"
+	.ascii	"\215\033,0%\212\217=Z\206a\006\201"
+	.string	"\007f\3248\262\275e\027f\215\031\025\241\326z\306\2311\366\341\376\337\371\257\363\367*;\004\204\bQ\307\322\357\212p\351\366\230\373\351\210xF-\370\351?Kn\033\377\202\265\326\372.\372\327\267o\355\271g\255\321\356J\344\217!_\225\342\247D\276\030\362Q\"?D\361i\310\007A~S>\203\374%\300\202Jm\n\222\223\216\266r\326\241'1u\2112\351\261\276\335\363_!\337\243\217g\320\200\\_\nWy\326!\325\026,EvM7\342\322\335\336\307\377\247\nVLtR\275?\306(}\371\223\034]j\200)\302V7\221\037\026\032\016[l\f\031xq\255v\335\272<mT\213\r*\335t5\r\233\004\325\213\204\2036\330a\357MW\343\247w\323\006\2256,\022\016Fv:<\310\375\250\264x\325\277\207\017\274\270\356=\332\001G\300pY\262u\311\246\224\027N\372*BV\267\320/\210\357\212\215\301\034"
+	.string	"s\3771\031/\216\325.[\227\337\346\356\237\320\230\363,\221\036\261V\233\203\007wA\220\321f0\024.\326\211\031\r\026BF\301\304\fF+!\223\341\371a\031m\006CA\037\303\351\231\305^$z`#^1 \023/\234\231\373\374\310\200^'||\200^\343Y\027\254]\324\333u\021\306\\j\3215\252\200\177\322\007\t\304@\222\222&\246Z\227G\3006;\222AH\236\252\307\336,7]-I\3252\271\037\023\021\317\305\251\3766\221\220J\372\355\210v\265\336\0267A\274\345,X\372W\260\300\213{\016\215\240.\377_\330- p\202\221\251\263\003\017s\274\032\026\355\211\313\266LF\227k\331\036u\354.\245\273P\307"
+	.string	"r\347s>\372&@ \356\347[$\332\226\235lE\001\270\305\205\007\237r\240h\275\2067\365"
+	.string	"7@\262\363"
+	.ascii	"\036@\332@0\234\303\206\255W\240$\253p\013\310\306\006L\032\023"
+	.ascii	"A\356\240\r\256\371:\332\375\214X\336^\231ZN d\262\013\032\005"
+	.text
+	.section	.gnu.lto_cliGet.305.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\335\006\315)"
+	.string	"JJ\\\020C`^N:\373.\215\317\366F\361N\360\026+\326\341\210I\244\r`Q/\034\334zEl]>\332%\202Q$\003k@|\345\240\r\226?E\207q\340\246A\353\005$K\344\037T\260\273[\223F\b\221;\311\363"
+	.string	"\340"
+	.string	"\370"
+	.ascii	"?nY\222\271\273W-\203\252\366.\353\2750\334\357\327\375\016;"
+	.ascii	"\3132w\367\336\244\243\034A=jt\3362_\313\267\254O\313q\001\367"
+	.ascii	"\236aAs\257\232\004f\240\036e\265\023\245G\325\017\323\243\274"
+	.ascii	"2'\t\024/\261\302R\314\026\333\240{\257R#a\240]?$\f\002\177>"
+	.ascii	"\265\227\242g\333\225\377;\022?Dv\341YtF\204\320\351\274\206"
+	.ascii	"\234Fq\346\266\316v\005R\274\310l\360\354\025\273\236\234\316"
+	.ascii	"K\310y!\357\356\355n\267\\G,\013<\3625\366\237\002\263/\261\373"
+	.ascii	"\226\313(\252\017\271$\344\307\354+\354=\260\337q+%Z\002\307"
+	.ascii	"\344f^a\235\0029z\036]\311c3t\324:\013\200).\001\036\213\366"
+	.ascii	"<\207ad\356\234\316K\354\214pg\212\030\360\230e\373n?\261\224"
+	.ascii	"\343\307\354k\354\266\267t\357ek<~\235\001\234\371)3\253`N\255"
+	.ascii	"\002\215\241\254\310\"\016G\242A\236{\263,03\324\327\2248Jro"
+	.ascii	"\326\205\267\2531q\276\311Q>\221\"M\221\036E\373nG\305\230IB"
+	.ascii	"iW\266\331mm\212_\315C\313\274\202\205\275\221\223\224T\3163"
+	.ascii	"-zN\367\351\324\335v\312(\266\371cN\346\211\337\204\243\\\240"
+	.ascii	"|\027\351\321\2063\376y\333\376\026\363\3126\031h\231aL\331\033"
+	.ascii	"\337g\373\220\216\222\310\034V\023\231\325\210\266\221\314\277"
+	.ascii	"\220$\257\216\373\214\031\351\301\277\234\213\236\366'8-\017"
+	.ascii	"\337v\026\006\201\252\345_\317\262\357\264\254\336\313\271w\313"
+	.ascii	"ij\031E-\237\247\345F-\333\323\362!l\250\333\023\344{\344\356"
+	.ascii	"\355j\026\272s\350\033\332\333~/\377\22773\030\276\033\003\333"
+	.ascii	"l\360p\262\224\263\244\036\375\327\316\306@f\376r#\300\245\273"
+	.ascii	"\001n\027`\307\374\221\347\274D\264\313\244/\320\252\204\001"
+	.ascii	"R\020\237\337N\031H\215`\037\346\177V%\t\2220Q\265\232\034\254"
+	.ascii	"NV4\271\271\254&\362\353\336J9sD\273\344:%o\310^#\223\374>\001"
+	.ascii	"\362\240\3342;\376\036N\252\352\021\244G\3772\3422\t\345z\230"
+	.ascii	"9\251\243\tv/\361d\326x\221\216\016\317,eY\226\311\004\216 U"
+	.ascii	"{\330l\267\300\260l\223\231\327(\277\263N\231\301\304\033d\247"
+	.ascii	"\004\016f\037+t^\347F\317`\342\265\322\315\221MzQ3\257U\326+"
+	.ascii	"m\026X\264\037\346r\353\226\001y\356\325\272q\345\242jup\300"
+	.ascii	"\201\351vJ\270\271b\023\323\017v\2142\315\263\220\330iA\033\311"
+	.ascii	"I\0176\272\205\327\\\213\343\307\271At#\234\022Eo\212\372\207"
+	.ascii	"\306G\220\021\210M+\204\247\347l$\347H\323\256Z\253\313\262y"
+	.ascii	"|\300&h\264\231\233@\330\033\323\374A\004\207\021F\036\232Bp"
+	.ascii	"@1\242I\310g#\rFVG\251\324c8\325h+(\031NSSTLPQ/\236h8M\001\210"
+	.ascii	"\222!\025\003j\352\251\307O\023\244b<)\311\220r\232Rz\252\262"
+	.ascii	"R\232@\304T3\242\252\224hPQU)\001\325\356\373\214y\351\252\261"
+	.ascii	"\206\026\330\203\261\305\265\353\300Q\325\002\341\203\t\316\300"
+	.ascii	"Z\034\033\341\t\fv\257\271z\335[\205\224ku\366\236?\306^\265"
+	.ascii	"\250\3214ce\375S\332\244\321,3\b\320\225m\256?\2300\247\334\005"
+	.ascii	"\033\311B8?\244\377\220\213c\3062\027\237?`\237\355\357!\367"
+	.ascii	"&\316&=\310,\354_3\371\372\307\317\273r\rr\276\t\257a\353\330"
+	.ascii	":\226\036\365\265\216d\030\330\225m\376\0046\362dD\374\304\371"
+	.ascii	"\0364\237\035l`s1\3776Ra#\265\0014>xl\220\337\203\375\240\001"
+	.ascii	"t\r\352\243E\206e\233CV#L \024l\221\325H\200\202\2501$\307\230"
+	.ascii	"R\b\231\021\221\031\221\2216\035`\002\021*+\363\021@Eh\254h\013"
+	.ascii	"\205\326?02\345\213&\\m\331\001\226\315?\177\307\030\256@\233"
+	.ascii	"S\004\r^G_\244\334\303\017.NX\022\251\3417\315\210\243\032\f"
+	.ascii	"\263H\330\300d\364\200\207\207\312\004\261>\365&\240\206Q\333"
+	.ascii	"\022\267\255\230\260\254\242\230Au\220\341V\023R\377\327\272"
+	.ascii	"\331\360\026N4{3ITz\021\221\331\221\b<\320\243~\020*\263\270"
+	.ascii	"0\244\241\373}\324\220\241\336\263\001\255@yv\f0\347@Y\352\354"
+	.ascii	"\237f\227\214\260\203\f\221\315$\031!\275\343\304pd\327\241\260"
+	.ascii	"Y\003\022U\210\352\357\223\315e\362-\340N\315)\006M\202(\203"
+	.ascii	"A-\377#\364\347C\326\250\245:\303\340\320\252\240\353{\216N\357"
+	.ascii	"\322\327\030CV\006\202\016EjU\252\034h\366=\304\205\020.\353"
+	.ascii	"\210I\257\223w\260&\207tXx\r\025\311\201\220\256<\344\371\317"
+	.ascii	"\365d\337\262\360\005\362U=\277\301,\360T\311\304|(\330\246*"
+	.ascii	"Q\210o\262_\032"
+	.text
+	.section	.gnu.lto_getWordLength.306.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\026\001=\r"
+	.string	"&\231ZC\020\217(\035\203\341\310.\020j@\016\252h!\304\261g\363\b\204\276\213M\"\260Jdpk\247\264\2765l\321r\370\364l\017\236\356\217"
+	.string	""
+	.string	"\b\275\206\341\341*\037\304&\t\007\251\224\326\032!do)S\nH"
+	.string	"D"
+	.string	"F"
+	.ascii	"\001J\"\030\002>\017'(b\354r\231n0L\355\021jj~\246[\251L\233"
+	.ascii	"\350\021^%\324\007\215"
+	.string	"\255\004A<\227\226\247\236\247\215\2240\004\312\365\251/\350\274\317\264\241</\004\273\3534m\030n\353\2669\266\013\330\007\005\330W\376\353\334\037!L\253\246\363\334\375\314\201\316B\206{/\273\250O\306\262\210- l\207l\215\315\275\360\310\264O\342%B_)9\200\335\224\024*v9\017\017\300\036\315\235\303z\304\276a=\0220\020\262\026\212Q\303\214\n\365d\333\035'\261R\357\302D\213\n\351\331?A\201\004\353\240\275\304zL\275P\336w\3220\202\273\273\320\3327,\250\030\275\272\025\213\211\bR~\312\262\242\264\251\252\330\234(A8x.\326\024\033\343t\r<\nDFB,O\307\001'\201\310H\b\346\315G\347\301&\363t\030@\3106 \t\331\007\207?\0218\240l\302\347\003\3124\334\036B\250\307\264c\244$\253b\372\223\031\243\374|\351U5\323\255T&#H\371EU\361S?J\365r!\030"
+	.string	"\3571\274\020\rN\b\315t\216h\357\177h\261\264,"
+	.ascii	"\t\021e\026f\243@D\313\0356\255\016\306H\364Y\b\214\200q`X@\350"
+	.ascii	"@\205\213[\372T-\003\365\262I\230O"
+	.text
+	.section	.gnu.lto_cliSet.307.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\246\030\205y"
+	.ascii	"\372\313t-K \322\322\031\016\325k\027\017?h1ea\237\371~\255\""
+	.ascii	"\204w\344-\203\373Kn\370\212\227U\356\347\300&\343\360jAG\314"
+	.ascii	"3M\274\036\231\013DU5\r\2018\331\023\021\341\223H\237\224\317"
+	.ascii	"\236\037\347\211S\233Y\023![\312$\003\321\002\177\002\307\002"
+	.ascii	"\257\373\351~\271\037\372\333\360\344\356\353P5\305^\020\004"
+	.ascii	"\201K\234\330\024:k\224CdK\234\230\227`\234\375\016k\224S\004"
+	.ascii	"Jk\311\232\344\311\"\255\211\0326<f:\034\316\001\327\370gDh\215"
+	.ascii	"\256\307g\034\030\237\no\220\360\352e\266\"\247\304\201\2619"
+	.ascii	"\0239\2464&\202lxp\330\373\255Q\212\245\202SZW\024\211\233G\327"
+	.ascii	"\330\267yO\316(\333\227u]\255\212m\262\3540\245u\251\201~\240"
+	.ascii	"\346{\347[c\032/\030\326umZ\263y\305\254\257b\034X\n0\254\353"
+	.ascii	"\227\220\342\205z\233\247\256sk\022\261\031iK\360|q\200f\237"
+	.ascii	"\227\006K\271\005]\301\220v\323\277\013\212w{\2743G\324ul\355"
+	.ascii	"\300)\224\355\313\0173\267\223A\203\371:\021\2766W\254\347\264"
+	.ascii	"\317\200\342\205\352:\006]\303\202\002\007\005\331\360\214\331"
+	.ascii	"\223Y#\035\t`}\246v\002\024\037\267\237[\343\205rXm\323\272\032"
+	.ascii	"\305\013\213\247\341pk\254\341o\314\333p\302\327\260\365(\244"
+	.ascii	"M\347d\024/T\252'\032B\221\b\255\322\365_s\246c\004\327\025\332"
+	.ascii	"t\341:\025/\344\335\263\275\215y7$\037Z\327\026\300\334\255+"
+	.ascii	"\364\3052\025/\\\350\223\303\013\213'\032^\270\314]:HJ\326,\032"
+	.ascii	"S7.8<\353\272\306\350+K\334\244\375\364*\364\213Be\276\311E\013"
+	.ascii	"\026+T\244`Bq\302\204\262\004\211%\245\021I\"\220\216\214\222"
+	.ascii	"ED\310!\241cP\b \343\017\210\"q(T\233\231\373\037\260\2547\271"
+	.ascii	"hA\204\032\232\221V\026\345;\213\025j\256B\211W\307)\244]\276"
+	.ascii	"\332\230\t\260\f\243 B\235\205\221\371\2110&\264(\207bdi%f\244"
+	.ascii	"\215A\351Nb\314\234\0307u\t\360DNiL\360\220\271R\027\351\327"
+	.ascii	"\013<B\355\032\344\364.\3752\243\032\320\366%\313\375\302p\322"
+	.ascii	"Y\030\230\213X;\322\332\027>Z\353\362\205\306FD(\277#g\244uE"
+	.ascii	"\331\362T\t\003\363$\227\027m\211ra\"$\021*\314\356CBY\272|a"
+	.ascii	"\341\243\252\224~i"
+	.string	"Q\225|T8\210\b\025V\367\020\227~\331\345Ma\240\262\343Ia#\233\013C\241*_Q\206B&\252|\331\251?*\322\214Z\363\322\2575\352\213.tzn\007\205A\250Dde\336\\\372\265\247:\275\211\001\312\341n\242\313\027\031\027U\242\222&/\\\372\305\247\n\240G\020\357sM&\246=\371\360sW\273L\341h\301\241\003{r\241\022VU\027elT\270\364kLM\342`e\007#\330\026\267\352B\360\314\017A`Zj\262\311\013\316\303\235\273\300\2240\023\241\326u]v\202\205}\235\276\333Fv\367o7\031\025\202\003h\271\201\016\304\017\277\321\313\26786\370\200o\3360J\214\351\204\357\274ADf\272\026=c\007\260K\261\237{\2042\264j\241\036\341v\305hb\337p3l\242\0273a>Q\277e\231d\314(Q\206\027\016\233)\313X\022\236^]\327u%\366\023k\030\243\255\372s\317"
+	.string	"\215\317\235f\331\023\3572\2510Y\350\251\fQ\255\316Z\030,\354\252\336e>\231W\224j\013\373\\\203\357\341\n\264\332D\264>v\\i\264x\272M\334\3752\314\305t\341\350\217\311\245\330\374\032\023\215\231V\200\231\222\316\212\201\267\230j0j\260\026\323\313\013N\322}0\323\035\326\334\226W\022T\374\255\353\326\235f\2372\275\314\300\262\256[\002\364\371 sM\375\226\013\227\031\306\311l\033^X\325'\363\037\201|\246\316\025\222\360\264[NO\t\330P\311\217\373\236\250#,\353\332\274\363F\261\371\347\n\0349\370\316=\231)YT"
+	.string	",z\004\205\375\\\027\237\032r\177p\177g\311g\252\270e\217dx!\267\320L\027\224$<\345\022nj,\250\277\226/\233:'LzO\030*\320\3155\210\366\006\270\305z\366\255@\263\016\\\203Ix\272#8\252ww\364\340;\337\207\373\247P\311\263\346\021\334\352\254]h\026\367s\367wJ\311\241\312v\013\273X\227\373Z\235\356[\3654_!\337\373Jm\220\001\006\027\\\316\327\202\317\371R\360\300o\004\347\341\353\300\017$\257\217\377}{ yy yw\274\314WG\016\006^\367\305q\350\367\306m\370*p\267?\3529|m\374\315\267\306\245_\032o\363\235\361\276o"
+	.string	"2~\346\373\3643_"
+	.string	".\367\215\021\304\013\343\310\373\342\274NH\274MG^\027@\274-\200xY$yW\b\361\2528\362\246"
+	.string	"\342e\002\342E\221\344=q\304k\342\310\2534\342-\221\344%\201\344]:\362*\031\361\216H\362&!yE\f\361\"!y\217\206x\215\216\274\311 \336\242\"^\" ^$\020\357P\021\257\020\021\357q\2107\350\310\033\342\310\0134\304k\004\342\375A\362\2028\362\026\207x\211B\274\303#\257p\310\253\006\361v\b^\006\342\275\t\215B\2377?\270\251\230\206\003]\233L\371\254Q!\036\332y\370\003\3779\277\234?\207\377\315\377\367K\3776\177\337\257\367\257\371\367\3764\377\231\277\314\003\254\247\327\300\351\333\033\321\317M`O\304\006\177\306\201\261\245p\032X\227\022\007\026f\206\b"
+	.string	"@<\247x\270\354\222<\367\247\356\242\321H\035t\366\346\346\250\221\372b\270\214\221$\24418A2tG\r\202\326\0227kn\333\267\005g0\251\237\313F<wFb\271\337\357Es\322'n\216\366G\206X\335\265\252\321S\362NJ\346\206\364\037\031\256z\364\324"
+	.string	"\260\3634z\203>\366\220\326\005\207E\030\321h#/=g\035\"3af@jz\022P\003\316\321EoK8\2763\331C\265\027 \203\027=G\375\3343\325\206E\r\344\366\026\207\337*`\252-\307\f/,\352wAA\266P\023\365\2332\024\277|\303\241F\366\233]h\364P\017\347\3101t9F\230\3046\306b\226dD \307\340\376\312\330\270\215\335\226f\324]\332-\317\f\357\\\242\031^(\324\367\273\020\314\030\\\017\233&\260\r\317\250\237\313\301\223fQ\006\315\201\2237DM\017\240\2736y\354\fZ\315\3430K=\003\260\254a0K\276\031\177k\307&\241\265\204MQ?\227\237|G?zUp\f\316\313\033 O\371\361>\364'ub\226\207\b\311T\330\354\r\351\255U\022\020\254\201\247\273\203\203\244:\250\337C\032\n}\\\203g\302G\203P\210\3468o}z\017\3214"
+	.ascii	"\233\313\227(G\251\006j\263\346@\215\364[bfm\314\001>\233\253"
+	.ascii	"9\233\357m\032g\337\022\207\001\274\252\244\371\340\034:,\341"
+	.ascii	"\360\235R}\276\027\375I\301\240y\004\267\206{\2023\004\355`!"
+	.ascii	"\255C\316r\316\001^U\300\242J\036\226E\026BH\033\373u\336\372"
+	.ascii	"\266XO \273p\302\214\277]\362\300Z\226v\212\027:\375\031;\304"
+	.ascii	"\223)\237\2626\267\237\026\322j\036\327 \016\376\331/\357\fs"
+	.ascii	"\364\3562\317r\017\337\371\323\317{\022\315tO\264\331Y\013f\315"
+	.ascii	"\007\240~\256\372\245\241\017;o\200D\037\f\345%\2460\340\021"
+	.ascii	"\314\342>?N\264l1\216-\035$"
+	.ascii	"\270-eR\226YX\256\002eR\266LEY\304\262>9\357\330\276\254fQ\226"
+	.ascii	"\245,\235\342\272f\275l\277d\2265\335\003\003\223\355.\235\277"
+	.ascii	"\214\235k\213\013w\250a\314\232<\270\033\375\322\020D\357\350"
+	.ascii	"e\2561\255]\366\341\025\214\024\331\311r\007\246\227\342\272"
+	.ascii	"\256 \372x_\3015\375+ksc\221\227\345\205\037\022\206:\272\345"
+	.ascii	"\246b\240\270\330QYL-\276SG+qt\261\221h\203w\016`\006\270\230"
+	.ascii	"(\360\2359\232\311L\365\236~\243\031h\242\335\240^S\006\002\370"
+	.ascii	"F3a6\341;q\364\355\376+T\366\b\346\t\213\243G\224\217\020\213"
+	.ascii	"C\002\036Q\023(\027\320\301#j\002\037:\202VY\344Jy$\205q\225"
+	.ascii	"\007(\217\244\030\256\222\200#\035TQ]]M\035Q^UMYY\211p\203H\352"
+	.ascii	"J*\210\212%ee%e\264\272j`\210\324\b\303\t\216%L\005\251\322q"
+	.ascii	"\365\023d\312\003 WRD\210UTD\272\004)\"-\f2\325A\225\224\007"
+	.ascii	"7\246D\030\"5\002\220\007W\035TM\361\230\"\"\345cj\b\007RTVR"
+	.ascii	"# \207H\215\320T\257\232\032\322VW!\030\231\022NUQ\r\tB\004\b"
+	.ascii	"q\201\300\240\032\002$F\025\225\024\221\030@\254\216\304\200"
+	.ascii	"\221\334\"!LY\305\270*R\304*\206\021\272Z9T\222\326\272\225&"
+	.ascii	",\216j\262\004\203\263\2034&\354\317\305\035O\227b$\234\024\233"
+	.ascii	"\347\263;\223y]i#\224\307EJ\0134\026W\274$[FA\023\335:\032\336"
+	.ascii	"\263\234\242\002\013\225b\363eV,Y`\246\341\375^W\356\306\276"
+	.ascii	"PJfU\262\254\200\301M\327\321\302\353J[\264\211a\364\321\360"
+	.ascii	"\235\245\225\245\345\263\330<\024\202\036\230j0\204_\306\352"
+	.ascii	"\200\324\270\232*\324\244'$\n\226\373\252#\236\272DS\254\216"
+	.ascii	"\313\216\211\345.\243\273d\2640\313\206;Yv\374\342\020\321\246"
+	.ascii	"wlxV\350\332\342x\207\312\342>EZ\322\250IQ\243\2154\330\340\005"
+	.ascii	"\007;~g\352\347.5\305\306p\331\235\300\240\225\342\300\334p\331"
+	.ascii	")5\335Fw15\305\304p\331\235\270\240[\2154J\235R\216\256a\243"
+	.ascii	"_4\327\351\321/\372"
+	.string	"\370\266$\360\r\216\334 \n\247\333h\f\372\177iR\354\356\324\027\264\n7\204\235\276y\303\037Y\226.\360\235NM\347u6\215*9\321\317^\016\\\262Yr\241r\321M.\372\003\2573\036Z\364\212v\200\377\316\242[\260X\321\257s\326\206\215\236\t\025\275,gy\303\022\r\204\024\255\"E\203\340u&\206\251Ot\004-l\303(\232\tE'\371p\242/x\036\364:\013\263FMi\242\227\337,\357\226iD\224mB\331T^gSJ4\211\246\240\205fJtR\036\211>\235\263\036\2573\262\033~\300\363\232\327\231X\211\245^\226.\351D`\372+\322\307YG\251\227Zh\306\007\377P\352\017\274\254\354\031\321ImA\013\363l\364\210N\022\302:\324\226^\370\316\244\376\016g>^V\356D9\315\201\254\270\211fq\237d\224@5\022m\226\335\264\013{\313|\fEoY\315\2774\274\260hm\212\241"
+	.string	"C\336\256\252\202R\034X\240 \017(%<\270\334\302E4\0174\"\232Hk\311\2355\267\032?Z\275\223N\371\312#\270\264\306wF\016\027\206\355\226m\b`\251\253\201e]\327\036}\300?\340\267dN\036\267$fQ\314\362(\305\331\n\201\344\250a8\304\224S\210DDDD\222$Ic!\005\304 G\2413\333\022\300e1\210)*\241\221$I*{\035\345\366KjJq6<K+G\f\233K\f\234\377\257\021\023\227\356\376[C\250\272{\343\360\033\305s\035"
+	.string	"0F2\204\362\231,>Z\2173\032~\366\2259./\344\320\250\002\207\357[\371\255\001\237&Y\337\300\202I\"UB\204\034 KC\251S]\\\t\335\030\246\273\306,\345w\301r@\357\301Jd0(\244?G+\206\273\034\211\315\302\023\333,\223\255\027\231\020\215\233}<\240\356\025\2139\237F\023\271F\244\360\205Jq"
+	.string	"\200\252g\225\020\177\211\351\257\222\324\001\322\005\201\"\245\212$\020\304\007\274\311y\371.\f\271\220>\333\205\365\272\310h\002\210J\346-\037/\301\226\030\227&\002\270\364\232\352~(\202\252olm6\005\0167\017~\3700L\240\221\035\343\374\220\325\255H\220\250\301\365\270\001\327\311+\246\243\300\355\"\371)\361\024\371\2619L\r\"\225K'5Y\"\\D\304\251>\314\227R\255>B0\354|\233p\337mF\020IXO\203\374\027\bN\303\242I\356\226\306P\033\006\212\r/4'/\331m\n\203\342#\265a\232\032??%l\243\254}`wn\320\374\227\216\324\217>\253\2403sA\211\346&\037.rU\"\362qX7\347\3233\230\353\344&\rY\307S\005WX\206\345.\327\347/R\276+)\r\235\033\t$\027\267}\034\327\214\244z\264\371"
+	.string	"\030\327\2142\377\366\353h\020\342\360\203H;h\234@\376k\316\305cB\375c"
+	.string	"\236T\211\361xD\350V\244\327\2106\025\332\021[#\331\317<T\034H\324\254 \003\004\026\360"
+	.string	"-\253\227\312\221\0170\241\212\021\345\326\262Qn\352\001\337\342\001\323\304\347\260QR\252W\240\006\246sKK\302"
+	.string	"\322\334\217G\304v\033 .\367\247\351\207\267\203\263\035\242\276q:\330\211\026\203\323F\332\316-:\215\365T1b-\205{\217\314vE\267.\f\342\225\317[N\207\202\361J\364V\203H\365\030J\337\275w\333\356Hg\034._\344\036\333#\026\325\231t\305\020\026\320\230\350;97t\317\320\356\266\320\002!_0\004$\302\233Eb\322Lt\244\246\240\001qk\301\323>\321\357_\016\354ef\3065U\266\007\3629\242=\226\213pJt\354\327]\250/\210\323\257\255p"
+	.ascii	"\214\335baA$\r>\364\246\007\345I\032\214+\264\273E\362\336*\204"
+	.ascii	"Q\016\275\307\240=\313"
+	.string	"I&^\212\373\240\230\207d\222\305dh\026\242\237\303\231\321\353*\263^S[\346\375\200AH\260E\201T\312\372\334\0164\202\375\337+\306%\376\346V\343\345\306~M\272\222:\361\242\034\007\206\206k\355\031\265\364\223\345\260\203[\225\343\235\202\032\0239\360_\021(\226\347O\376;\300\370\362\375Y\221\3773\375_\027I\007\305\345E\327`\317+I\3764\360\337\310\211h\250\235\215\371\310-Y$)\232o\336\242\033\353\314\371\332\342\305\310!\212S\201N\177\n\304m\250\214\367\342\252Q\224\002g\037CaR\252\331\301\266:\354s1F_\347bi\250\214\225s\314\235r\353L\274\341~\332^\273\322C\217\021\033Wn\235\2269\002\340\2379B\225\366\233j\241\035\023x\213\243\367ue>\244\315j\204\t\260 \261':\317=\r\004q\202G\202\023\215\347\257\230\251\365\025v!Un-\377\201hii\f\227\202a"
+	.ascii	"\303\024\022\013\fc\246[\330\224\234\003\357\360\243>=\020\025"
+	.ascii	"F\245#\342<;\221\202 2Lx\250\001"
+	.text
+	.section	.gnu.lto_cliStatus.308.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\031\020\215X"
+	.string	"J\233\224\"P0\322\322\032\003\024\254\213q\0227\b\374@\370\021\342\203\223\216m\362\215\bF&cK\340\021#t\326\321\017\243\324\260Ry\2671]<\004\004\005\344\001\271~\357\225\230\210\364\317\243\025\243\001\213\265\360\206\251\334\370\274\354\2628\211\230$\"IJ)\005\016\002\363\001\026\002\252\363\217\217\263\317\217\263\372\343\334\363q\346\361\234{T\347t\347\274S\235\321\236\363\311s\326\361\234\237\347\354<\347~\n"
+	.string	"\214\031-W\320\270\362\374\0323\267\310\334\035\227y\266\215\365\231n\267\356\267\356\266\356\265n.\335h\335a\272\307t\017s\243\341\336\031\037G\3304]\327\0052\0037\rm\206{,\300"
+	.ascii	"m\277I\371\226\240\031y\343\224\272\375pW\351\304\rR\202f\344"
+	.ascii	"\207f\0162\334e\270\327g\033\327J\266d.\245\255\306\315\306\275"
+	.ascii	"\265#P\225\023\367g\004\315\b\233\246\215\264O\357\263\376\322"
+	.ascii	"b:\215{c<\330\212AVeN\001\251\f\r\246\3550@\200\\\246\333%\274"
+	.ascii	"G\274\006H\373\354\246\211.\355\245m4!@TN\3346\341=\242\244\351"
+	.ascii	"\272Y\002\260\361\314:\206\266\271\204\240sep\253\270Z\220\225"
+	.ascii	"5\265\314q]\263\243>Y\230\366\271\352\332\231[K\227\265\275E"
+	.ascii	"\204\376\271n\22426\3275Cb\025i\237l\326@\264\317\264\205\320"
+	.ascii	">\271e~\363.\233\273\004\345\302s\345e\216\353\272I/\205\207"
+	.ascii	"\370\334\265\316\254\371\277m\242!`\b\241\240\037\220\357\307"
+	.ascii	"G\355\361z\322\035z\352\336[\356\024\312\264\2635a\264\250\232"
+	.ascii	"H\267\033Rd\331pYc:\031u\232m\235V\305\207P\330Z6PHV6G\013\235"
+	.ascii	"'[\313\016!\326Bba\036D\245\177pYTt\253\225\254)\016\364d\013"
+	.ascii	"\254}`M\374\207I\3730I[\342\352N\001\266\276\001%)\007\271&\f"
+	.ascii	"\031W\367\274\232\347\325V\262\222x\217\356\005\023\033Lh`\016"
+	.ascii	"P|h3H<E\361d\253\253w\272\027M2A4\\V\227\016Xd\231\354i]9\212"
+	.ascii	"\245\365\372\331f\032\005\\\226\227nu]\267\2475\304u\272\001"
+	.ascii	"\250X!\3532\355D\264\254t<\267\264\265fk\024V\262\224\370\363"
+	.ascii	"\264\270\332w\n\270\256\313\236\324\332j.j\346Ncn4f\037\020\002"
+	.ascii	"yz\256\3452\322\0369\202\366\311\373\023P\222rt\332\252|\356"
+	.ascii	"N\213\244\273\200\271\256+\203\273N\333i\275xI\333\304\233\240"
+	.ascii	"}\322\3706\323\024\250I\312aic42+\037\320\243V\342\2659\221\276"
+	.ascii	"\322\263w+\341Hx;\377K\256{\336x\326\246\201g\340{\336\301\310"
+	.ascii	"\226?\\u!}\216\323o\340\337\213\360\205\235\3368K\006\201\\\203"
+	.ascii	"v\007\211\244\013\327\230\356\277xw\246\027\3017[\007\231\201"
+	.ascii	"KC\304\271\217\250\360\261~\240\2737\236\361`\345uZ\024:\256"
+	.ascii	"=!u]+\031\334qZN\013E\327b}r\373\325JA[)h\237\273\3572\275\204"
+	.ascii	"L\312\241\323\346d\334\020i\362S\030x\r\224a00]\267\331\rE\177"
+	.ascii	"h\303\200U\322\267\271\264c\347\243\217t\225\207\205\n-\013\336"
+	.ascii	"\311\363\177\004e\030\013\2472\354\b\363_\327\246u\301\327bI"
+	.ascii	"\337^\362\202"
+	.string	"\356W\024\316\334\302\260\200w\362_\245\222\207i\302\231i8\320\002\356\315\t\235&\362\251\330\310\375[\255u\220`\205\215\364\355-\026}\266Z\303-\371\330\270\356\333I\013\322\227e\201\203\311;\311\353\373T\214\200\225Y\037\321~\377~\263 ;M\337p\344\026c\f2\360N\366\311\235\001\332g?\257k\0061&e]U>\307l\206\364\377bn\031`u\232\374Q\230y\364\231\346\035M\252\263\016\325\231Iu\316\321k\315\021\264[s\215~k\246\321m\315\r\250\316J=\246\231\001\3259\206\352\234\244:\303h.\315H\275\326,\3349\037\361\234_\250\316.T\347\026\2523\013\325yE\3179\250:\253\brN\261s\006@uF\321s^U\347\023?g\023?\347\022\2523\t\325\331\350\347<\342\347,\242\347\\\364s&\3729\017\251\316@\3259\004\220\263\020\3179\210\347\374S\235\201|\316\276l\f\336I"
+	.ascii	"\3600\2211>\351a\374\211g\221\205=c\275\244\257\213\251p\221"
+	.ascii	"\350\200\342Y<\373+g}\024\337-|a\323|\375\236\256\023\177*\227"
+	.ascii	"qB\230x\035_\224\246\204\211\037\021G\342K\274Q\032Y\223\370"
+	.ascii	"\227A\b\350\250\321&\\\\\236\037\323'=\026X\033\275\272d\243"
+	.ascii	"?@\271\204\303\264z\252\240\021\317\364h\234\210\021/\"\255\350"
+	.ascii	"E\274\332$\3132\3676I\230Pv\345\367_\354?G]\304\006\027\367\306"
+	.ascii	"\227\343a\260`\320\242\377,b^\205\005\303\212a\323\3304\264\317"
+	.ascii	"\242'\202\202\365FG\007D\3649\276\310\355\275a\350y\255\345l"
+	.ascii	"q\013+\327\255JA\364#\334\274g\200?\364F^\336f\225\317Ii\340"
+	.ascii	"\243sN\254\236"
+	.string	"\252}\354\032\032\342U*gm0po\266\f\312\314\272\261o\336\311\020?C\271L\303\264Z\2721\177\204\016e\t\350]\352r\013\016\225M\253\265\030\026\215\t6iX\034D(\227e\314!O\025\024\246\216\026\037\016P\241oZ\362V\353/\254\2324\311\314\356\300\256\361N\n\275\b\345\362\005\246U\320\267\232'ay\360\365\220\276\215g\307\246Y7\350\357\203\036\351\315\362\2003\263p\3308\336\311\337o\240\\\222uZ7\030\034\234\024\324\377ZBc\222B\317\310\201\270\330\270\022\254\\\372\366\234!O\305\276\007\372\216B6&w\225g\007\004\033$\274\377\342!\352{\267\302,\035/2Lbf\3558\021\026\017\022\001}\262+\275\004v\216\252E\"\321>}\2374eK\225\317\265\034\tTz\376\213]\356\214\007#\257\361\273\357\032\234\204v\b\321U\3726\234\022\31209\346\373T\251\001\3365\370\333b\225"
+	.string	"+!}\333M\221V\313\2052,\016\323\352\251\230H\t\236\034v\302\257\240\353M\315Y\033G\022\333\023\272\013\230\030w\021\355\263\306\177\032V\022\365y\357\363\375\256\320\214\006\355\275\372\375Z\241\361\275/\362r\225\307\335b\032|\f\256:\236q|\"\256<\242\236|\030\027\030\342\243Q\312h\244\261*\t"
+	.ascii	"\201\217]\034\203+\322*\304X\234\232\0326\2558\210\301\026\353"
+	.ascii	"\005\001\304\200\021c}\261\362\030NAI]\300\202u\334X\205\304"
+	.ascii	"\251\241q]\272\221\201\003\253p-B9\tqZ\205\301 18\203\251\002"
+	.ascii	"\245\032|\314\261NE\025\215F\017\224V\241\020\037\211QRN\305"
+	.ascii	"\343\352\343i\252\003\246\325Gq\352(\004\307\bv\n\302\320\361"
+	.ascii	"1\210\3001\210\362*|vZ\213PMC\250\247\341\007\3035\310\320\006"
+	.ascii	"\217\247\035QRJ/8H0H\214u\306\361X4\022\211\303UH\f\2563\212"
+	.ascii	" <\035\327\036N\303)\034*\370\306R\216\005&`\262\001\001\016"
+	.ascii	"\036\203\360\200\rb\020\201\036NRPJ\3531\2702)\331\020:Ju0\365"
+	.ascii	"\324\204\006)\022\243 \020*\032\207@\210\306\341\003\307\237"
+	.ascii	"\036\307\241\017\335S\3678\016m\034\215R\307\250\"\016bq\312"
+	.ascii	"\2518U$\n\355\360\240\351\247\210~\3441\204\332q\026\243\236"
+	.ascii	"\240\210>\234v\354\004\343\t\312))\352i\350#\311\311xL\202\001"
+	.ascii	"d\251\016\212\306\244)))cR\317\254\252?\n\247j\270R\240\323\254"
+	.ascii	"z$\013A\003\242s\335'\t"
+	.string	"4\271\370\034P9V\003\321\177q\243\351\337\0348<L\200<^\307\006g\347M\210\246G\n\001E\372Nk\335\225\256\033\346tCG\3376\370\032\033\007|.\254\025\037\363\303\303\270\030\366\b\213\204\365\362B\373<z\024\nV\034\2266\244\177\361<\276\361\\u\271\370\027-\336\305\273\333U\222\035/\354\026\337W\310\266\254\275w~~\307{\232$\020?\034\351\231\331&\354\th'\177\276\321\264kQ\216\221\371/oC\264\200AG]d\006N\216\210\220\216\217\361X\314Q_\254\024\357d\323G\240\034+c\"\237J\315\321\330)>6,}?\354\250[\315\317\330*c\351\373^cM\230C"
+	.string	"x\025\277\302\214%cUH_\217s\365T\034\374\025,\013\301o;)^\005\021\013\373\202w2\305\243nN\2060\004\201$\250q\030\345\224cF\241\021\031\021I\232\2445\001\005\304(\b)\264\033\0210\255tRi\222\2449\221\027\340\022t\212\\^\310\006\272\303\340&\013\365\271#\375\273\327\0349<@H\344'l\317c\266\022\213Sf\244\276\270\270\037\255\356\034\225\232\034W\331j\211f\236J\016!\373\2015h\343n\363\3567\320\270\361\303&\261\035cl\312M\005q\263\356\246\f\371W$\205\361g"
+	.string	"y\371\036\036 \204\353y\340\371;\235\360\b\b\200\261\034\036\321\246s\341s\233\037\276\217\201\374A\205x\300?\354\231~+\220hY\305\216\257<\243.1q\347\223X~\034^\025\262S\241*\226\025/\243\261\222T.\335\263c\254\252Sq\361\323\302\346T\337i\201bA\n\274!\331~\251\253h.\212A\200l'-\306\326\003\216\203\003"
+	.string	"\331\277\003h\231\366\b\315\313\342\216=\231\351mU:\243\177`\210\261\211l\341e<\304Q\024\370\324L\255\252<\257\233\347\205@<#\003/\307e\2241\272\366\321cP\333V\273\242\347\251yC\266\370\004\351T%\0205\342\245]\202P\357\350\257$\201#\335\250N7{\007{\250\305)\300\rr\260\301 \357:C\325y\027\242bM\244\005U\321\003\302:\214\313\343X"
+	.ascii	"\256\367\320\026\334`\356\313~\342$\253Y\234#\023\314IN\334\""
+	.ascii	"\366\033Y\336\"Z\310U`5\t\204\314P$\031\332j\203\252\337\256"
+	.ascii	"%*\214h9p.\260`\362\254F\255\301y\236\234\311\002\201\017v\233"
+	.ascii	"wQ\302>\205\2616\336@\254\363\263\2152\321\001\3074\345\203\f"
+	.ascii	"\016\247\020f\275\210B\252\253:-\035\262\016\260\225\202\233"
+	.ascii	"\334\273E\364uJ\216H%\371\342\316r\227\024U~\036S\210\245\030"
+	.ascii	"\25537yA\2703\020\260\357\235\361\311\340}\037\240F\334\031\202"
+	.ascii	"t\261+\024\f\2775\240L\024I\f\\\331\024(\234\320\332\242\311"
+	.ascii	"\310\221\255\016\017\3458H\220,c\243\303\26697(x3\013\b\001\\"
+	.ascii	"\200\230\201\fM\013~!EO\t8R\316C^\374\215` \245\234\r\0335y\006"
+	.ascii	"hO\025\342J\370\372\255\331+\346G8\031 D\375\236L\270\037)\346"
+	.ascii	"\244\346z\2741S\240\325\002,1\366\342\331\001\256\351\036\211"
+	.ascii	"d\207\3777\206\323"
+	.text
+	.section	.gnu.lto_cliTasks.309.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\025\020\245R"
+	.ascii	"\352\213(\037P0T\322\032\003\203\236g\2759\2340&\361\375\257"
+	.ascii	"\027f\231\275V\257\216\016%_\356G\372\354\372h>\302QjG6*\371"
+	.ascii	"F\316p\206\317\254\321\002E^\t\002\256\017\n\037\237\317!R\231"
+	.ascii	"\274\3101`\261\322D\270\"\006\201(+W\022\231RJ\001\334\001\274"
+	.ascii	"\001\342\001\316)\317y\327j\315(\317\371Sg\3379\367\004=G\b\241"
+	.ascii	"&\326U\352\\7H\035\024.\334\356\315Io\351v\353\316\322\255C7"
+	.ascii	"\225n\265n\034\232\307\334\\\330\307Cki{\013\007\300\"lD\222"
+	.ascii	"[j\357\372\346\n7\226~\313b\303\016\267!l\3146\035j\025ng[\351"
+	.ascii	"\034\332\326\241\003w\225G\334>\341eF\221s\335e\r\265w\357\266"
+	.ascii	"h`\332l\334m\354\353\035\025\037&\2601k\220s\3354\003\324\336"
+	.ascii	"yO\3515\366\341\300ZT\256\245\312\306\\\002C\f5\255oh[\215\265"
+	.ascii	"\334t\035qq\224lL&r\256\353*\365\216W\250\275c\321v\346\216\322"
+	.ascii	"R\332F\373\240q\\\027I\024,\256\233\306\202S\250\275\343\264"
+	.ascii	"\016\246\275S\033\230\366\216[f2\357bq\213\244\314\261\2575'"
+	.ascii	"\\\327%~\022.\362\266\211\330\241\242 \240\037\037a\017\317N"
+	.ascii	"P\007\230\203sc\363\253\241\361\255=\225\227\242B\357-7\217F"
+	.ascii	"\017,\214\253\211\2524\213\252\220\313\322D\307-\253\240\301"
+	.ascii	" M\300z\255\315\207P\236W\220&\035\267\264\001\205:#\367\326"
+	.ascii	"m\257\027\261 \304J\007Ii\240(\375\203\016\317\316l\361a\363"
+	.ascii	"b\322f\313\032\334'\n\024\027\366\2345\017\rN|\247I\007\343\226"
+	.ascii	"M\314\226/\270\216\013\rt\241\005\317a\3228L\226\370\215\215"
+	.ascii	"\221\376\031\031\363\032\"\032%\355C}\306~\030\322q\313\024\320"
+	.ascii	"\241\020dG\264\331\222\210\257(t\017\005\263%\323U\224\311\355"
+	.ascii	"H\024\035\267,\202\376`\370\202\354\267&2[\2129\017e\343\226"
+	.ascii	"R\234_\236\242\335e\245\205x4V\020\202\326\377\013\003\202\262"
+	.ascii	"\256\353\366Z{2\f\351\316\243\341\272.;X\230\220f\243f\366\001"
+	.ascii	"\230\033\004\346\032\032\001dZ\033\006 \200\200\037z*\301\314"
+	.ascii	"\241+\357m|\277A\244\317{T\313+\267\373\364}\306\274A\374\263"
+	.ascii	"[/!\204\221\200\270n\227\321\356\201"
+	.string	"\230x\275 \275\256\205:\250}\351\271\031\375;\223\002\332\311n\377<H%\230\263&\246\027\232\372Mo\037\351\323\367[\243X\304\302$\231B\004\020?\323O#\324\332xY\251?\326\001\355\314R]\327u\362\367\221)\277\234\375x_ig\002*\330\3233\327\260\341|\002\316\353\251p\361\nK\237\013\340P\337vc*\315\220@\277\311\376\r\327\335\3269b\236'\240\241\334>R\035c\t,\240J\275~\322_\251\273\355Y\302\030\252\324\001|\222[(\350\315\326_\034\340Q\342\272o\203A\240\276\215<\212`\002o0\026*\315\200\200\003\362\\@C\244\314\360\337\344b\332_\301\224\"\200\370\031f\246\240}(\252\256\013\304\211\273\207\366b\344v\241w<\265\303\033\254w\334;\322\336\365\373\236\312-sh]^\307\234\206\364o27\224\2223d\370\2210K\240\243\001\237s\016\2373\216\033\252\263\r\325\271F"
+	.ascii	">\347\031>g\031\252s\f\325Y\252\335\232\243:K3\324\223\023\214"
+	.ascii	"\027M.\230T\347\026\2523Qu^R\235Y\254\316+Vg\245\325Y\305\352"
+	.ascii	"\234\264sF\3529\037\355\234\001P\235\207\252s\n\325\331Hu.Z\235"
+	.ascii	"\211Vgv\347<\264:\013\255\316A\2533\320\352\374\263:\013W\347"
+	.ascii	"\236\325\231gu\336Y\235\203M\245Ygu\006\366\234sx\3168<\347\233"
+	.ascii	"\306\241\331fu\376\365\234kz\3164=g\337\252:\367v\316*\317\231"
+	.ascii	"\247\006\317\325\363M&\372\2427\372\024?|\341\003\037j\204\226"
+	.ascii	"H\021\365m:#\250\233\302s\r\277_(2>E\262g\274\321\367\332\254"
+	.ascii	"%\235\361E\337\357\033\222}\242o$eW\312\250\300\276\025\231\322"
+	.ascii	"\314\034\3177\271\337Z'\355Y\244IP\207\323\277\370d\2775\020"
+	.ascii	"\356Yd,\330\3003\252\323\364L\237\354\037z\350{\005\017\301A"
+	.ascii	"\030z\233\247\262\2113\336\231\361N\257\343\375H\331\025.\357"
+	.ascii	"\230\214o\372\006\276\345\312\256\270\275c\310`\216{\265\020"
+	.ascii	"\356I\204\016\230\343g|2\275!6\004\231\216\320\347x!\262\203"
+	.ascii	"^\350\221\306xW\003}\320\017\215\371y\341\003\375\374o\2112g"
+	.ascii	"\035\360\233\3547\334T)\031\034\034/C\3704I\220\t\237\207LYf"
+	.ascii	".\247\347q|\017\230/:\236\030\236\357\371\241\265\027\312\021"
+	.ascii	"\b;\317"
+	.string	"\363Bk\357X\360\201\277\363\375\232A}\360\177G\312\234f\276\350\220`B\b$8\337d\237\324{\333\2239\202\r\215\324G}\322\310\224\301w\343\337\211'\0214\233\030\217vy2\351h\244\036\352\223O4\260\t,svS\243\324=pO\"h\277\032\037\343\2239\377\364\275\203\273\355\223\240\234_\311\224d\316P\033\234\257\361=`np\336'\212\327\313\357o\376\207\273,\031[\373\265K\322\337\323\230\265I\332\331.\371\375\016\231r\314\\\303\360&\005\254\206\346k\346\332\026^P\337.\342\313I;\253j\276Gs\304\031\353\320}\351Bs\344\276o1\335;\364\022\355\223!1m\f\352\333^\332\031\3323\366}\256\032\332Y\345\013#\204B3\214OUj\024\313\223\331\244g\343\245>\331]L\325\177@,\314\223)A\364^\352o\374G\361BAz\035\253\337\373\376\242\353\362:)]fL\007\234\244\300"
+	.string	"\b0P"
+	.string	"\016v\207\025\325q\213\207\261\307\024\022\233c\211\2170\\D1\rY\253+*-\226"
+	.string	"\366\001\006X\226\275\341\243\323\020\345c\324pxd\032.\035_<\r\331\243\3230E\323\220\230\305\004d6)\013\006\323\020\211e\301\036]\264\030\332\360\312YUD\036E\255+\255c\361\212G\217b\325\216\r\212,\233\265E\354Q\254bY\017. Ni\025\261X\255,*\036l\002F\253-\00300N]`\324\252\351\300h5\265\245\301\024\226\001\030d\025sT\260\225use\201\225zD"
+	.ascii	"\203\254\242V\332\243X\265Vm\341"
+	.string	"8\026\257\024\230\332Q\304\232\332\240\370\233\262\242\342q\2542\362\330\270D\305\303H\264\242*V\021\215XY\304\245 _e0\205E\324\272\272\302\"\372\322\272\372\221\360Z\343(e(\203\353z$\3217\231\231\00395\026\277\364\304o\301\344\207\031\236\037s\352\353^\304\236\253\205\315\023\227\320g\361\307\262.f\3367W\361J\277\342\273\213'\371\361\004\317\217(\324\327\317\214\374\250[\301\245\364=\264\256\244W\361\355D6\227\244o\026\236\"\260\315\360\356\322\\\332/\3466\2046\311E\006f\216\2253Q\330\"\247G?\311hQ\323\333 }\005F\306\220\276\327:\201\247\bkgrCmM\264\022$\301\263\220\316?\301x\026Z\337\351\223\034\344\342\031\025\n\340\233>\231\263\306u7Z\364Mf\240\027\317\251\323\303\370$\0031=\243i\323\273\370\244\217\364\351%\370nk\237\\Y\016_\336\261\016P\327]A"
+	.string	"g\343\310\251y\235\007Ey\033\244\r\013R>\251\003\372&G\375\221XK\302P\t\352\353J\21489\242;\013\2161\221\370\221k"
+	.string	"\336\343|\210\223"
+	.ascii	"\300?-\361\371&\213\3512S\210\020\206\265'0\325\327"
+	.string	"\311\222\224O\224\200\363\n\201E\250q(\345\224S\n\215\210\210H\222\244\220\0161\005\0041\350 4\017\022\240u9\2475\243\341dc\377\r-\007\212\321\230\351\333\220/G\312\344dd\237\333\357\036\357\367\236\034\320\030\372\347\242\306E\020ic\207\207X5\305pO)f\243\253\271\346\244\357<Dx\213\336:"
+	.string	"q\353}\350\235\2556\3274\033fHt\331l\370\307\0072\365c\270\314$J y\032\223\223\251|R\367\243B\362\003\254\326&\205\235\255\301\261\241\244\001\024\r\261\007U;\026\375\205\210m\331\264{W3f\223\003\246(\r.\322\354\030g\013\036\254\227\366\005\225\267\244\311\347\235\220O\336\200\227\3621N\004\254\n\336K\036\320\365N'\237p\0046i6%\371\336\234O\270\021\023C/'\224RJ\263;!c\230\356\002L'G,c\371\307\347\377\276\341\316\327\244\343MWN\234\334I\335\353\372\026b\fySf1\243(\024\034\304\341\356\0233"
+	.string	"J\301c\361\210\0232\006\355\002\244<\023\b\321k\021\361\3006\341\357\321\004\335N\351\210!\006\372!\0032r\032oU\215I\301\003+\241(\330\346&\251t*\360.\250\233\n\227\252\312\320z\306\177[,o\f\312\373o\216\253\376\017IF]\003\356cj\360\264|5\r\313\207\302\365\206>"
+	.string	"\032\026\235\331"
+	.ascii	"BYz\235\3606J\302f\230\204\035a\236\262\326?,p\254\351\311m "
+	.ascii	"\255A\353\325\355\344\276\347\271$NA\202C\311\323\230\230\002"
+	.ascii	"\213\361\217[\326\276\341\205\t\360\273F$0 @q\005\032\251sD\206"
+	.ascii	"\336\340X\375\217jO\203\001L\222\304\357\206\247nn\235h9\246"
+	.ascii	"\367\352f\"\233\213/[$D\021\261\023\t\017\330\035}\261 \017\013"
+	.ascii	"\373\375\342\372\236\316\357n\022\306\\\360-\274\321(\036\207"
+	.ascii	"\352\307m\213\377\336\033\021\013#=\213\312\372{,\231\332 \244"
+	.ascii	"%\017\001%.\tTIlj\021\375\030\326O\001\241\2054F<S\007\206\323"
+	.ascii	"\231:Us|.k:\212[>\271F\205\013\224\364\217\204\206\275H\226\326"
+	.ascii	"\f\310\025\b7\320,\317)\300\231\204E\366\301\360\344\376\350"
+	.ascii	"\302\003\370\n\340\347\364B\336\202^\310\3559\206\214\274\177"
+	.ascii	"\373\360\0224\263>9\316I\035\330\331\274\n\251D\244\242-\244"
+	.ascii	"=\312$m\303p\377\263B\031\244\307\021i\226Lx\307\2575\317\331"
+	.ascii	"\27746W6\356A\005"
+	.text
+	.section	.gnu.lto_cliLoopOverruns.310.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\350\006U+"
+	.string	"\332O\244\021Gp\334Q:\351\004\200n!^\267$\321\364OB\n\020@\264tQ\030\240\025%\220,R\b|\324\021\232^\376\355\213\265\224rl\212a\226\243\0355\322\245b\223\315\341\255\215kh\317c\223\242\272h\277\344\023B\366N2\004\001\362"
+	.ascii	"\022\001)\316\021>\244^\351c\271\226\346eI\366X6\245\200\350"
+	.ascii	"5\0307S\371\310B8\320\232S\234\026\216\326Wk^\232\214\033h\315"
+	.ascii	"\260\n\353\323\337\354g\315\263\322\264:]\255hM\"K&\254d\257"
+	.ascii	"\322\276\254)\350\311G\356\341X6\2438s&k\360\264\035\254OY\364"
+	.ascii	"\267\373T.\326~l\306{9wa\351\2223\331\203V\260>m\262\023\251"
+	.ascii	"O\327\017\251O\273\355\216\203s\227\314\2456\233Rgq9\347\037"
+	.ascii	"\026\322@\317\347\363y\224\354\255\273\355w\2725\247\246(\276"
+	.ascii	"m\337\351;4\027e\225\344"
+	.string	"j\256t\240\025\3628\331\256\266\274\272 Y[_\021\374\310\322z\356j\256\264\264H]\365j\337\2415\303\346\374\310\332z\212\036\350\352\201\347\007+\ne\333\334\244~v\004L\256t\\\324\3061\312\300\351\005\356\007\013\n%\262J\302\374\331\357\024\226\362\336\\\206\234s_&V\326\233\367\356\006\323\335o\272\325\003\001g6\273l\017o\223\261\346\234\221\372d^\346C\377\310\323\0161\"\355\217P\237^| Ua\302\306\236\356\263\007\334n\022&\356\231E\370\002\025\330\0277%\032\340v\237@q\317\354\002T`bnJ\243\247;N0\366j\360\343\025fo\240n\236\356\335\243=\214\2125\347\345\231\300u\231\342\350)\001\334\035\024\3363\217\267\250\300\246\270Ea\247n2\247\213\275\350\354\350\212j\334\325m\224\340Y\336\354\313\336\006n\345]\364\261\237\300\327\336BO{\367\326\333A\353m\240\334\355\037\336m"
+	.string	"\271\333>\274\333<\364\366\316\347\266Nw{\315\335\316\361n\253\273\333\251\3566\272\336\306\353\355\233\273\375#\002q\236\224i\235\214\233\234\255\236z\262[\312\246\344^\376\265?\313\237\366\227\375V\256v\277\373[\372l\315\343\362.\355\275\034\317\265l\2129s\276*\261>_C\263\016\354\324\271\267\2674T \034\264\224\242\234z\\[\005\204y"
+	.string	"\360\217\325\341"
+	.ascii	"\340\001J\036\366\301z\235\226\213\207W\230U\265\tC\272\272\033"
+	.ascii	"m\216{\346\016\263P\330\251W\254\333\372\234\326\310\212\207"
+	.ascii	"\224*\316\341\244/3\\\232\227\323r\251(\326T\265\301s\327#\232"
+	.ascii	"\363\017\f\316\262\373\354q6\030\016\336\022`\2405Ui\360\214"
+	.ascii	"\375\356\277\234\255\005\302L\275Z!(N\361\331\276\326\371j\273"
+	.ascii	"#\265\347\351>\217C\t\334\215\034\366\352\336[#*\212\215fg\272"
+	.ascii	"[\"\177k\215\2549C!\365\335\264c-\222\365HR}\212b\236\262\n\315"
+	.ascii	"\202\333\303\335\355W\333\344\236\311\342k\371\035C\005f\007"
+	.ascii	"\247\211\211\302R\261\227\363M*\306\006\360m\263\344\021\204"
+	.ascii	"1^\362\325\226\266\204S\336g\373\324\264P\210\206\264a\353\362"
+	.ascii	"5\332)\255XJ\005v\306\r\252\302\220<\316"
+	.string	"\264I-\302\021\264\340(a\357\305E\370hG\243\201\350m\303\272L:\342\320\341\006\315A\304\b\021i\037}l\022\311\307\036'H\240\340c\223\022$\370\n\264Q\210d\001\\\221<\n\221@%\366\230\374\005\2051\204\354q\351\307\262,\213\324\307d\222\217\025.\r\221L\305\242\022\353 \351c-\264 \016\227\214@V\030$\016\217\354\221e*\026A@h\244\360(4\252E\026D\017.\216@\344JL\032\215\302\027\305\234p\t(\302\305\021X\242\005q\230$\f\n\215L\275\341\221\304d1\230\"\217\306!\213TH\034*%-\005s\035\2040T\n\376\210C\340\322/h<\376 \020u\221Ih\374!\213E\343\217G\226\217\273\2723<a\345\016{5\257\310j\204S)\251\001\334\303SE\270\207\257\366\364J\013\216\03333P7\317\321\234s\326a\257>\333\207\342\326@\331\223K\340+\243\366\237\255\223"
+	.ascii	" Ug\342\224\353\362"
+	.string	"l\216\236\n\341\251\356_\206\332\303F\370\355\253\215\013{\205p\016\357\260\017\376\301A\370[\256\247\215\032\360&\265.\003t\250Q\030\344\230SF\021\021\031\021\032\231i\322\001\200\002\221\251\263y\021\2409TD\222\264n1\307?\023\006a2\225 \f\225\313\335O\300J}\350b\237Z\033m\266\263T\360 3\2034\214f^8\361\205)Ge\255-\024\347SBO)\312\207d\245\324\345\374\226\211\356\326\274$\237\013\024Y\n\227\033.\2263pj\032\324@\253>\244BY\263NQ\330\252\266\354(\271\337W\027\264\304DiW\354\2102v\016\177\027\354\302\355\370\221y\342T\312&mT\257\243G\341?\260\245^\300\035\033\244\024L\205\2504\020\272\030\251#\026\2028\373\0211\266\202l\3111\005m\323\206\315\2235d\033\341U\347\002\254!\037!X\261\376\256>;&\032^\341\"H\356\346pq\266\206j/"
+	.ascii	"|c\210\313\2328 \237\271\220\307(\276Bx!qP\036\2662\302&\336"
+	.ascii	"a\036_d\3155\235r\212?"
+	.text
+	.section	.gnu.lto_cliVersion.311.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`V\001\245\016"
+	.string	"FZbG\360\262&\035\220\233&\243H\376R\"\315%\364\371\222h\212\336\017\020\032\344\237v\257[(\224\024\246\335Z\260\3529\360h[\305(\272\315\334\305\242j!\320\236\201@-cp\225m\267\233\331q\307h\bb\311&[\246\024G"
+	.string	"J"
+	.string	"Q"
+	.ascii	"W\373+\316Bu\033\020\017\260Kc\003\333\035\027\330\300\366\351"
+	.ascii	"\361\"\332\347v\001\332\247U\366\216\\\330\232\320H\340\204\200"
+	.ascii	"\341cw;\211\342\252\253\312\177\213\207\2101\253\353'\302\356"
+	.ascii	"Z\305\230\021\267\274\355\021\333-\366_\001r5\003\225\305\350"
+	.ascii	" _\200*C\356\3427\036\262\327\370\303\213v\361\323\177\321>/"
+	.ascii	"?\343\322\371!\303\322 \366\330Ry\302~\266\273kIc\253:S\265T"
+	.ascii	"\265\252\372\033\001\036\03672\327!cWD\020 \033\2337R\200l\007"
+	.ascii	"\257\036\261\226\\y\200~|\016\024\351\352\311\241\260\205,#\225"
+	.ascii	"\022G\005\351\342\311\271\260\205*\267\201\3418\207e\360k>\255"
+	.ascii	"!E?\267\216\366\3615<m\306\265\243\202\264\205\026F\237\037O"
+	.ascii	"c\005\300\216\335\360\342\267\205\nF\2376\213I/:\333\022\001"
+	.ascii	"~@\3025\230v\300\221p\f4\273pX\371J\033\276S\312\004dP\024\202"
+	.ascii	"0\341DB\350\004\245\004\001(:\320\205@Qh$\001\351\364\225TL\336"
+	.ascii	"\307\036\367\225\274\356\364\245\230:/\005v\234\210Q-\244T\347"
+	.ascii	"\202B\245:\320\310:\314\253'\306\222-\027P\273\304d\302\004!"
+	.ascii	" \320\202\241\242n\363\003\203  \021~\201Eh<R#\001`)\024\303"
+	.ascii	"\301.;\255]\033\273\025M\272\303\363\253\f[\335|\241\233\362"
+	.ascii	"\356n\f\026v\\vH\273^\306>\\\315A\306\263\316\260\232gt\354\362"
+	.ascii	"\242ed"
+	.text
+	.section	.gnu.lto_cliRcSmoothing.312.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\230\001U\020"
+	.string	"F]oI\340\322&\035P\235(\235+\330\342\0260\244 \312\377\002\206k\240\360\356\230\220o\217\300A\200}\354~\023\371\250<\270i+\244\226\311\307\262\244\205\215\365\224\007\215\022\242\201KOn\231q\004>\247A\233\370\320\204\220M\366N)W"
+	.string	"S"
+	.string	"["
+	.ascii	"\266\017\272H\233\242\343\021\222s\304\264\273 \375\271\354^"
+	.ascii	"W9:e\376\207.B\2265\367h\357FJ\332+\247@\005\016\023\247r\306"
+	.ascii	"\241\222z\224p&\367\321N\271\0068L(N\345\310\001h\312\331\361"
+	.ascii	"\241O\020\345\315\234^\204\335\365$K\022\367w\3333\266]\354\017"
+	.ascii	"\005\337lA\202W\333\003\315<\351\252\363\242\274\215\264\306"
+	.ascii	"\266\335L\312\302>\267\273k\352c\277\366\3239=E\n,\271 \332y"
+	.ascii	"\216\037\273#\206\004\331[\275\021Db\373\323>\214\307\220\275"
+	.ascii	"\366\341\001v}h"
+	.string	" \355\332\030\030\301\367j\333Q\335\353w\001\335\253e\001\026\276\331\311\005\032\003:B%n\343I%\240\237:!\354,\365\320\235 \031I\\\311\264[.j\036H\265\025\364a7i\206\242\036\343l\262\375\362\031\341\267;:\360\215~\304\301o\361\352\2278O\276\372b\367:\351\210\016\021F@j6s\210\275y\333\211dJ\200vg';\004^\251\250X\022RTVXPX+\325\311(+U\312J\213\347\324\003W\f\r+\365\002\0137\314\210\342\253%u\302\222:0\300\005\013a4\274Z\236[&!L\013\204\205\030^`+&\003\232\240,\306\270b\340\214(\306@\022\233\315\271\245>:B<7\033z\343\331\240\340\362\315&\320n\343\fQtB\250\253Q\201@! \320\002\0211\355Oc\210\304CNh\305\035\373\341fvS\226q9\366\262] \036\037R\333a\243-r5op#\237\200\256"
+	.ascii	"w\311\327\325\353\266\205\322c\031>T\317\256\3463Zp\244{\223"
+	.ascii	"Ou4[\354h\fu\017"
+	.text
+	.section	.gnu.lto_printConfig.313.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`E\037\275\206"
+	.ascii	"\352\325\3140O0P\332\351Z^\213x\223i\006\247\237\334MS&\232\371"
+	.ascii	"Q\213\2417\363?\254\3667\357E\023MqY~\037\332\344E\fm\b\272%"
+	.ascii	"\365\311\271\207\357\236\371\343u\354N*U\037\240*L\227\243q+"
+	.ascii	"I\250\377\215\355\345\246\303\276Mv\222)\005\336\002\364\002"
+	.ascii	"\370\002\022\370\232{\004\305\334\0178\240\242\001\006\026p5"
+	.ascii	"w\005\212\271\021\360<\357\024~'\203w\221\033\361&\032B\341n"
+	.ascii	"\336'>\267\tcn\241b\356\240\317]\302\230\033\250\230\373\347"
+	.ascii	"s\2230\346\036\361\271E\030s#sr\037\215\271C|n\237\234\334=\306"
+	.ascii	"\334\037>7O1\367\316\347\326\311\271"
+	.string	"=\344\344\316\371\334\035rn\234\016\271\2158\271\213\237\373\346s\333\030s\327|n\032\234\3343\237[\346s\307\030s\303\030s\273\305\334/\305\334m17\261\230\233-\346~\317\235=\267\273\324\200\034nhdH\362\002\337o-\256\272\346\020[\211L\302<\317\375\316\375\315]\006w#\356n\336v;\224\274\020\334\247\225\213\204\020/H\323u\"\336]\b]H\b\317\006\217\222\016\327=F\006\271\264\216\256w\312.W-\2565pi-\255\334\275p\270\376\320\305\312\245\245\244w\307dwE\202\303\365\2079\271k:\\\277x\205\305\311t\273\222\366%-\363\026\303\006\005\306\f\007;p\2358\343l~\304\223\264\214#\3616\247\273\231p\003\245#.\252\200$\257\312\340\005\256\023\221\254\343\264F^\025P\024b\250\026\206\306h\370\213@\206\023\330\370*~\022\376\214QqC3\214\3435\024Nl\001\\'\346\356"
+	.ascii	"\bp\372\332\t;^hE\273\033\362\334\355h\236\346t\265\327\213q"
+	.ascii	"\314\243:\027\307kD\375\343:\261\327<\247u\242\3538\255\023\235"
+	.ascii	"\335\202\037\317\305[m\036\025\351\021\3038\216\215\276G\333"
+	.ascii	"\266#\372\235]\363\366y\247\023\r\2418aB(\250\004\320\017\211"
+	.ascii	"\021\"\220\307\020> \212z>\360\354\350x\310\351\200c,\336\330"
+	.ascii	"\324\320\314\310\304\300\270/-\221\375\354lg\275\312\234\260"
+	.ascii	"\371)\251\361t\242!(\031\305\t\275\031\262\t!\274\273\034T\002"
+	.ascii	"H\317\177\340\226d\022,\214\r\272\"\316g\365\306\026`\005H\325"
+	.ascii	"\241$\311#\\\260\241\304E\274\250\200\342\306\037*\225\033\332"
+	.ascii	"\341\016\033J\034\351\346G\267j\016\301\336\250\261)\360\320"
+	.ascii	"\262\217\0136\322\034D\232\027\361Y\305\r\261\242!\367\344\371"
+	.ascii	"\2073\263\314S\346;edY'\314=\204\001\3119?\274\303\017\037\031"
+	.ascii	"\007\314\215\016\005\203\027Y\001\242\f\265\234\317\n\214\235"
+	.ascii	"\331\"\255\301\207X\275\220o`\030b\365\225m\330\023\203tY\234"
+	.ascii	"\317J\216\315\251\002\"\325\225kh\270\266\362\314\213\212\035"
+	.ascii	"6\270\\\306\371\254\264\262rL\016\207\341\263\312\301\"\3438"
+	.ascii	"\306\312\256\210\0356\256\374\205\305\301Z2\245\246\206\224\035"
+	.ascii	"\232\"\326F\211Q\254\214gen\bN\251\251\001e\007\250R#\207'q\021"
+	.ascii	"C\254\256r~Q\021\307qg\251\0326\274\215"
+	.string	"\274\373\235\2723a7\317\\\207m\322.0\357\376\007\237\271H\231@\203\300\201n\034\313\b\203\261X\201\265\300\274\327\201u\303W\362\017\230\320\215\343\270\200\3160d\0370\226BX\213\226w\032r\344@\306\225\246\006\225\257p\031\f\202\343W\236.\361\274E\245\226\265\363E\354\370\242`\351\323\201\300\005\370\372\363\027\307P.\325\231G\236\3028\264\373pb\303\\\340kv)\370\332:q\350\273\235O'\364\314\316\032\325\202\223z\374\312]guD<\274x\374\362n\035\023\224\243\313\331rN\371D\275\310\2333\224:\301\376\002\363\202\034\016\216\300\362\302\322\341\247}\214\352\235I\345\212\356'\2643H\364\300\244r6n\305\213~\312u\241\266\315(\264\237}\214Y\261\223\256\340\234\362\371\233q\326Et\3039\245C\345F\363V\225\023\214\346L\253\206s\354,\313\n\305\251r\3368\342p\2439\205\263\032)8Y"
+	.string	"\302r\243\336g\202\312\354*\303c\355\005\343O\213?\355<\303\211\357;\330"
+	.string	"w\210_\323\007d\017\212\2023\313g\313\215\372\223\256\302(g\013\307//7\352i>TfX\2542\376i\200\365\212\330\315O\2738\373L6@\307\301\207\236\375\032(\020;\242\354V\357v\366p\202\361P\231\345YOdW\222\237+|\276\210\0049\1778\303\334-\260n\355pP\306?\375k\313\340\234\215\033\330$\006\232\t\276\331\031\024\237\023\325\303\222\312\311\254\370\241\237\022j\037\306\205\332\241\3777\262\001\251c\363k\273\n\312\335N1\347Xv\251&R\231\245Y\24159\236"
+	.string	"p\217\001\264(\n4?\355\374\360\026'\325-s\243\016$\277\020\225\331\330\f\322\205Z\024\277\342\t"
+	.string	"|{\027\242\314\220\223\371i{\0227\316\005\322\321"
+	.ascii	"#\3017\353\236x\024?\345/B\026g\325\345\021\344D\"\177\036*3"
+	.ascii	"!17.\324\236x\t\336\277\306\376\256HU\200\346\253\303\374\264"
+	.ascii	"\263[ \035\327\213\002\377\242:\245u\340_T\221\020U\374\213\252"
+	.ascii	"\013l\003\377w\201U\032\317\200`^\340\211~*\273\005\246\305\275"
+	.ascii	"\270\240\277\250fi\335'D\177\306\300\262nB\373\242\272\302g7"
+	.ascii	"\241\315s\201i]\262\273\t\355\211\237:\241\215\340S\344\270A"
+	.ascii	"\314\375\251\321\306\336\313\363p\240\212\363\314\231\346F\275"
+	.ascii	"\313\001.\n\250\241\265*\036\006tV\035p\243\216C\305a\316\223"
+	.ascii	"\001\204\330\300\024\b$p\243N\243\201B\2336((\373S\2533\360p"
+	.ascii	"\337\212\001\376*p\243\036\305\300'@E%\2646\036W\226 \377\323"
+	.ascii	"~\333\005^\0046*2\362\226\376\220]\211\357a@\364\025\307Q\227"
+	.ascii	"\312\300\215\276ANT\340\2737\340 \273\324\002\237\255\201i\326"
+	.ascii	"\303\301\250\177v\257A\363O\273\375\257\327\353\265\237G\267"
+	.ascii	"Cy\354o\336\037\254\230 S\017\2415z\207z\032+uj/\312e\226\207"
+	.ascii	"\236\207\352\255\212\372g?\360<\357x\016C\204:\345g\364\017|"
+	.ascii	"g)\033\240\362\365\301\374\236U@\370\001pq\\\321\363\330\241"
+	.ascii	"r\345C\277\363\376G\235\262C\341|\203=\324<\364;\336um\367{\343"
+	.ascii	"\305\241\347$\215\354\353\303\001YG\250o\004\003\237\242\233"
+	.ascii	" \2165\236\237\022\311n\367E^\254/\264[{\263,\b\3015W}\273\266"
+	.ascii	"^\257\264\327+\350\354\321\336\256\026^/\257\351\333\203\257"
+	.ascii	"\214\214\345\023\274\021\004\206\354O~\354\205\341\367\236\020"
+	.ascii	"y\177Pp\323\345&\306%\366\n\t{\307^\310;\366a\037\344\025\362"
+	.ascii	"\212\275c\357\330K}\313\252\327\367\301\036\261\356\310^\367"
+	.ascii	"`o\332\037\251\373z\253\t\204\320\272\023\002\327\343e+\362\266"
+	.ascii	"M\337\266\"\257\347\361\262\035y\333\332\222\274o\207:\234\325"
+	.ascii	"\343\027\233\025\004+\273\223\337z\345\276\320I\367\320k\275"
+	.ascii	"t\026\204\3402\0242#\353\255k\362\342a\275x,\374\325[g\367\342"
+	.ascii	"\341\345\275zX^\205\034\256\261U\366&_\343\365\3139L\214\310"
+	.ascii	"-A\263z\373\242\274~4^?\240\277\024\236\352\355\223\362\372\371"
+	.ascii	"\001\276\201\324\237\201\301\361\241\340\240cFv&\037}\013\237"
+	.ascii	"K\265\352\n-\352%\274\362\026>\364-\374\371\347C\275\204/\226"
+	.ascii	"\267\360-|\265\274\207U!]\234g\307\257g;\034t\250\354t\031\007"
+	.ascii	"\030J<\253\302\305\241my\257/\027\030j\bCKd\311Z\336\353\023"
+	.ascii	"\206B"
+	.ascii	"\243`\251\026,+\216\277\245E\307\t\331\347\362 <\365F\346\256"
+	.ascii	"\300T\257\023\345*\bWu\025\330\213J\016\204\253j\300^^7`\034"
+	.ascii	"z~0\013\016\207\345F\277*\310\211:\036^\247\035\336js\336CV\356"
+	.ascii	"\203\267\242d>\270\253\005\330k\332:1\347\217^aO\016\367\340"
+	.ascii	"\036G07\3722\202\214\220].C\201\177d)_rypX>\356x\362v7\003,&"
+	.ascii	"\004\246\336\301T\240\257'\331\016\026\033\203\251\3242\370\254"
+	.ascii	"\2115\372\317&Q\n\343\303d\366\270<\007W\363\r\036\327=\224\345"
+	.ascii	"\340\"\217\023E\356\215\006Z\034\307\00781\016fk\207\313K`\273"
+	.ascii	"\022J\362\033\314\326G\354Z'\266\301I\324\316\254\033\264\301"
+	.ascii	"o\356\344\013\206s\2439\206 'v@F\377\3318\337\001\246#a|\234"
+	.ascii	"w+r\231\r\246+\222e\200\233\324\301vx\255\023\215\177\204\206"
+	.ascii	"\301\025\363\022\320!\375'\b9\r\255\370.\007h\3637\357\243W\363"
+	.ascii	"6\357\322.fe\2055\317\204\206-9T\333 \317|g\252\263\212\323\027"
+	.ascii	"\326f\230}\0049\221\346\341=8\nR\372\317\376\340i\336\255H\273"
+	.ascii	"@\265\213L\004\356;\240\363\220,\006Ka\375`\300\026\260u\342"
+	.ascii	"\f\223\"\217y\231\367\221\022\345\202\306|\215\216\261\215\264"
+	.ascii	"\244\214AZRzhb\343\004\365\2212I\331D\"\223\222K\313\026K&\023"
+	.ascii	"R\311djj*\231$:i\231d\341\304tb\34281\335\246%\245RS3\306\bH"
+	.ascii	"\311c+[,%\231# %a\224HLJ!\0341\215\216X\360\264S\214dRr\311\264"
+	.ascii	"\324\351\244\344\222\251l\276\264\213\"'\246Q\013\0308\r#\251"
+	.ascii	"\304\266\213\"#\020\255d\306hJ*Y\270M\232vZ*!c\332EQ\263\247"
+	.ascii	"\231J`*\233m\273(2jr\321b\231\304\342C\307\320 \235\226JJ146"
+	.ascii	"\335\004B\3024S\351\264"
+	.string	"Tj[\251\224\\\"\266\267\262\204d\223i\ty\323\315\026K\313\246&e\023\211djB&\2311Z,Y,1\035!\233\224M%S\250\2213\215DZJ*)1\035!\225.\232\220M\314dSs\247\227\230\226M\246\262\004W\004b7\221`:))\311\266\222\2314\001\211\231t\001\323\315\266a\270\315T65\223J/MI&\214\223\022i\251\002e\322\222\005\023S\003\244%\f\233\246\244\030I\026\312\b\232I\311\030$(i^4\223\030\300P\212\201\3446\227\230\226M0\230^\220\224I\"$\227$P\"1a\340\342\250))\302\r\013\026\313\b\230\220Z\345\3222\tI\351\350\245\217\212\226IGFK\313\244\222\321\021\263iT\224\323L0\224L\243&&&\246\221\314\032\224\2631\325\224&V\250\207>\355M\241c\3438\216\211X)\270\207\016\321\257\213\312J\237\242\370\364\271Q\342\334\2241+"
+	.string	"o\204\201C?\355\024YK\374|\005\036P:\024&\204\336\304;\013e\241\204^\307\253\f\311[\225\036Z'\202\330 ?\227\022H\343\206\211\022@_\342\275\013\027\240\327\201\226\0359Tk\302\034O-\241\237\207\177\336k\240^\331I\257\262]TU\220 \022#\236\304g\270C\303\021\337\343Ev=T\203\022\201|\021\237\341\no@~\017\224\254\313\241Z\317 u\206\0226\270@Yn\304\001\345\371\240se\265U\341B\273\001*__\220\250D\2123,/\360\311\017\320\215\022c\300\373sN\225\b\254\223\362d\345\212\033%\322\240\373\271\036\371\b\337'\313%\304\037\237\260\274u/\004\033\231\340\241\032\211\2376"
+	.ascii	"TDx\374/[\220\377\346)~*\2046\305?\337\2470\005hd\304O\223x\212"
+	.ascii	"\367\370g\310\250Tr>\337\375T\210\300\373\274C\241\262K\361\b"
+	.ascii	"\344&j\177YD\374\324\237\270\2643\340\260\221\371\031\336\200"
+	.ascii	"\374;\347\324\317\223\026'\030\326\327=\035\006=\341\340FY*D"
+	.string	"T}8\214O\254\304G\017\262\220\364`\003\354\371~\272g\362\304\245\335G?]\337\347\263P\312\206\017\337\363B_\356\341>\356\215\222\2763f\264N\374\360\236\304A\360\"\333;\f\361\3236@\n\204C\375\313\226\242\236\352\231!\316G\004\312\314\347\003\202\217\250\342\3300\223\342\234B\210HDDF\222$\035\222\013\020\210\202Q\";\272\001\022`3E\321\223\020*\2226\035 \030\205\244^\017\264Z%\312\267\255\235(\230\230#\214L\366T>\276\211\317w\214\013\r\346\207\007\210{i~\306\345p\366\361\313\337\312\313\n\376\300\222-\006t\243\326\201\272\210{\226\227\255\236G\330\t\030\035\t\024-\3545\321Y\300~u\020\314!w\341cn\354\371\231\370{\277\210u\257\325=\332GO\016S\207g1GMWe\033\\\271\023h\350\203\t\177\030]\337\3779R\013\241\334\217\235h\223\020\2419a{k\tJ"
+	.string	"\fT\033\266\305\210\333\331\023\232>\350\265\310`\034n\331\221\317\342\271\023\204<<\326o\037_R\"%\277w\327\243\331\273\363\316N\363S\031M\273S\277\251AG"
+	.string	"r\3669\332}\371\005Q\024"
+	.string	"\275\033D=\356\216)\"\377\347\302\243%\353\306F\270G\261\336`\247O\313\030\271}\rI\326\351\"\004\304\254bYP>!\247\f\"\235\030\275\242Hi\224\270`o\266\032\247\224g#Z\020\005\233\221\300\231^\027\222R\201\230\264\2470<{#y\f\363\271c6\002\271\226\267\251\311\337"
+	.string	"Q\213\271Bj\002t'y\272\037_\247\212&\300C\r\240\224\241\350\341"
+	.ascii	"-N*\314\273\312:\312\2029\301\347\221\2256\232\224\304\375o\200"
+	.ascii	"\254\202\276\202\223\274A?j\3505\016{\002\275\252_\264\023\023"
+	.ascii	"\026k\241\363\221\235\231\322\203\236\371\241-\017\207\036a\203"
+	.ascii	"\212T\364\023\013\334\317\373\177A\250r\021\005\020\314\001t"
+	.ascii	"\202)4\220\262\310\252\232L\264RY\"\202>\314;\017R*\200\3306"
+	.ascii	"s\246\352m`#\370\224\370\357_E\213>Q\277Q\234\316j\304F\206T"
+	.ascii	"?h\002\253Q\255"
+	.string	"\020\224@\333\315e\261W\332\324\3140*\244\256\340hD2u\036\227*\312cL8f\274\311\272_\361\364A\227\335\256\305Mc\220L\300f{\002\351o\t\333\247\302\f\262Ue\236\267\222\031ZL\333 c\265\005\250J+\375\021\250\337=\217B\022&X6\033\360`:\231\026\244_I\035z v$\315\362;.\365\263x \205P\267-J\235\312\356\013\311\227\330\210\251\2727;ZL\n\262=cP\242\300*\321\303\034\316\031\002\376\241\331\n\331\005\017\217\364\225\002\375\343\005\325\0270z\177K\013\302\013\211\265\b\230\314\233\262\236\031e\364\211\035G\331\321\203\235M\3110\237\366\240\006f\235LV\252\226\355\221H\177-\027\f\noH\036\3402\227\304\366V0\311\264mX\001a\251#f\231\361\220\331\242\fL\364\242\226\237\3733\2643:\032\2076\367R\223\211\344\263\302P] |\026\"tU\242~\212\321"
+	.ascii	"\020]\026Xb\344\360\311\017\2222\240\324[sD\303l2\350\363\222"
+	.ascii	"\001\261\232\256\340\356\002\376\274\355t\360w\357\221 H=6\020"
+	.ascii	"\317WF\026\007F\017\346\021\342\306\006\326\311\">\274\371#\344"
+	.ascii	"\351\202\360\363\254\233\320\301\264\311;\341\261_x\271\342\250"
+	.ascii	"\314\206\024K\024la)|ma\205\001\006\021\025{\033\350\022R\363"
+	.ascii	"\013T\026\315\371\327\017P\201D\350'\253\330\336\034\356]"
+	.string	"\344\334\026\205u\276o\003\274e2(\373\026\307\243\305\363\302[M\354~3\333U\361\335\320'\211\227uB\265\225@\237^M\305?V\227O\212D\216\260\327T\245\0014}\334E\034\341\275\277\342\376\302\213\357\272\344#\337\310\251\220\016[!\323J\353\013\365\321&\304eX\224R\007]\257\004D\232\177Q%\0324\345-\263\26620\230\201E\232\342:\260\217\323\250\220\3015\034/cW\253N\b\203\3004G2\244\301Rlc\322-\007\236\341\364\264\243C\226\027\202\336\024d"
+	.ascii	"\251\377\037\352<\354G\356:\nb\375\273\013\372?t\026\202\362"
+	.ascii	"\t\004\302e\233\366\333\2522\360\370\361\300\001\312\210\316"
+	.ascii	"\312\364\351\300\035\300\223\370\0012\264\036\355\334\210\253"
+	.ascii	"q\240!ULg!}\354mQ\224\246\253\365\007\300\235\007R\034\270\314"
+	.ascii	"m\350\230\254\037\360\266s\025\217Y\201t\361\227\274\304_\271"
+	.ascii	"\262\2354\341\303\215\2572\2726s\340331\220\351RC5\022\206\352"
+	.ascii	"\367\277h\020\310\312`\374;&\273\247\201O\317\336D\220\241wB"
+	.ascii	"\252\223\005\b,\332P\031\221\302\310\331H\034<j\004\361Qls@\252"
+	.ascii	"\3111\315i\344@s\b"
+	.text
+	.section	.gnu.lto_cliDump.314.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"u\007"
+	.string	"\242\31645`m3\006"
+	.string	"\022q\013{\002\021\033\301\272\240\253\203\242T\3408\036\311\025\226\200\232\360q\377*\326P\007\333\b\202\330 `A\221\036x\rQ\236\355%[\312\224\002\234\017\326I\360\\\227^\033\254s\315\017\206\340\231\227\26607\231f\n\034m2d\23161\337=]z\265\302\320\250D\202\220\021\235\242\306Q\266\r\016\321]\013\302\020X\"IH\256\375\270(3ZO\377_\351\265\026\331qr\t\212H\212\311\205-N~\212\026\226\217(\022\016L[\307\326\037\006\331,zp\300\357y\200\377gP\002\313T?g*S\226\005*S\335\332P\036<F\245\26211\262\362\177J\ro\216[\355\020\003t \316\361r\360\277\261\003U\270\322m\007\332j\332v\004\t"
+	.ascii	"\357b\310\304\363\275h\306\005\"0\352\022V\263\032\035\356\362"
+	.ascii	"\242\235d"
+	.text
+	.section	.gnu.lto_cliDiff.315.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"u\007"
+	.string	"\242\31645Po3\006 YvO\260\021-\2432A:\236a\026\224j\033\334\252\252Ca\244\304\364\003\306\032;k\003\314\314\020\261\002y\2209\265\317\343\030\"\"D\312\224\002\033O\306Y\350`V1M\306\301\246'S\350Llk\230\232L5\206\3156\0354m\233\030\360\236.\277^a\250\243D\222\220\023\235\342\201\243l\037 \242\275\026\204\241\214\022\211Bv-\330E\251\321z\372\377\312\257\265\310\216\223O\302\224\025\025\220A%\277\305\213\313Q(\023\016L[\307\326!\026\341,\212p\300\377\201\214~\020\241\004\227\251\202\316T\246.\013T\246\312\265\241\374\350\030\025\213G\005I\313\377)7\3149r\265G\f\340}:G+\341\177\243\367\271p\245\333\016\2645h\373\021\t"
+	.ascii	"\357b\310\304\363\275h\306\005\"0\352\022V\263\032\035\356\362"
+	.ascii	"\242\235d"
+	.text
+	.section	.gnu.lto_cmdTable.316.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\337\023=U"
+	.ascii	"\272\204\f\036R@\230\326t{\025\f\005X\221p\023\ry\363V\205\024"
+	.ascii	"\255"
+	.string	"||\342H^%\342`\266ip^m^\276gc\350\371\020*\266\275\250&Wj\027l$l\304\2066\007\373\200\360.r\362\347\326\200\275\343y\007\235}\330\374\024\267\205\370\366\362mQ&)\003\351\001\353\001\267\001\266|]\215V\314\211\321D\277\024\216\366\366;)b\274#\364\024\225\303\226/,Dh\360A4\221@M<:\002\004\241_\b\334G\355\037B\311\213\352\223\274\226 y\201\234\321\304\253\3035@\017\372\213\340\036j\277\221\037j\330\227\017>\2200\330\030l\371\362\021#\242\301\377^:z\220\b@\361\354\310\320a\207\375<\274\023\317\233\230\0202\211\320S\024\217\225\017+\246\b\370\032\336\206\3758\374\r<T1 \344\017\241\247\250\032l\311C\304\006\222\372xw\270\nx\036/\303\376\031\336\007O\220X\017\022\007\241\247\250 \266\254T\b\231\232\361M\377\302~\030\276\254r\336\205\272\345d\305"
+	.string	";W\354g\272S\313XA\016\351\301\226\325W\344\n\327\001Sh:\007G\353l\332\305EB\031\261eeB\207<\202\304\226\365\207\0342\311\377\224\330\362\327,!o4\365\266\320\200\"\212M\341\274y4nH\236\320ST\227&^\020\330\322T\r\216\256\331\224\315\217\224rb\313\317\342\004\371\304B\261\345C\211\245!y\244\024[\376\021\222\212\234\261\325\273\272Khj\006G\317l\212FK\003\313\304Tn`\313\347!\226\325\201\007\266\244\\ej\374\257\315\007\344\255\251\207\225\300\027M\301\340(\326\246b\302\200 \202-\251\232\253\032\226\216\211)1\302\377J\260%\322\t$\225\202\352\205\341R"
+	.string	"\211-\233v\341\202B\n\266TAK\r\231-O\230e-\340\253\332\324\352\212\021\266e\bVh\331\226\027\334H\352\353\235\231bb\322\301"
+	.string	"\215\001\243/\312\323\264\207\243S6\245\302W\270L;td@\025\332\235-'\220rC\350)\212\211\251\304aK\006b\3645)\0130\372\232-\220\260\332K\343k\302\016\023\223\016\312\203\276&,\307\234-L\b2\fp\302\202\363\324\253T\216\330\325\212o\2042bK \255Z\005\310\352\b\024<Ot\205\202\253\274]\245\364\306;\026\210\027eD\222\304\226@7\304\246n\374\017\250TB\332\200\212\342\206\3535\204\256Lp\225\210]\213\220\032\245\254\235&\343\022\333\304\226?gbKF\251\3779\261\345\317\325\023\362\310\027E\316\024\254\036\251HvM\"\304\b\305\362l\3713%\026\304(E\350)\212\312\226?3T!\251/\312\234\236']\211\340\252\017\273\376"
+	.string	"\365\263\243\310\350\253\262\245\217V\017V$\r\031Nb\230\324\034t\325\001Ww\330\225\007'\020,\031!>U\261 c\226\377i\261\245\017\r\\H\276\305\253\232\362\2515T\033*\020\037\036^\254\270~\352\016]y\340\252\f\273\316\340#\264>9z\214q\254\233X\fc\234\377\221\371B\312\240\341d\006\315S\017\350\216\2569p\265i\327\027\252\013\366J\307\030\307Z*\225\t\205\377\331)0d\001P<\254 *4\355\331\251\002\004\241\247(K\004V\026\2138\372\247\300\375\234\375u\350\214]\326B\311\031\305\220\261eO\227\024=p\312\2206|<\255\251\026?\375O\340\036\212\375Q\270\351\321j3fi\331\262G\212M\017\221\221\t\2627\361\322"
+	.string	"\360Z\372\231\300\375\326~5\237\246\307\251\211q\313\252\261%\354\016\232\360\1770:k\324\270\030\263\304~3e`Q\220\031\331\264\261%\f\214\0335\001x\321\377\005\367`\366c]mQ\202fa\274X\022c\327\377`QoH\032>\236\023/\260 \261\177\213\026\030\020Y\3068S\330\022\006d\316\032.\030O\245\277\n\356}\373\253\336\n\254\307\021c\227\265\023\243BB\375\357\305f\254C\322\200\342\271\341\022\232\212\262\277\307{mA\031\273\306*\0028t1\007\230/\246\330\271\356r\361b\021\327n\016\353\236\303\213t\333\361\216$\206!\326\3359\213\305\226\270\006\265\356v\261&\273\263\\\343[vg\265\035>\222\335\242\232&\212M\330\fyR\357\273\233\266\201\234\026\300\024s\3103o\240\026\363\r\304H4"
+	.ascii	"\346\254(\357r8\211\b\203\242\2741H$\013\340g\336\254\303!\336"
+	.ascii	"Z\307\374\350f$\361\2129\274CW\314\267\005\346,\367\235\210\301"
+	.ascii	"\233\016eASI\357\3605o\320\004\227z\356Y\251\206y\316\347\207"
+	.ascii	"\205\230\303\334}~X\024)\361#\242[\244\204A\275\211nQ-g](\342"
+	.ascii	"N\353;\316\223z\016\211nQ\316\355:\021\357\231\341.h\206\260"
+	.ascii	"\031\212X\f/.\304\242\013;A\256\303\236\223\356\r\216\024\262"
+	.ascii	"\2304\tt\2166\004j\274\207h=\034\222 \306\344\272\334\207D\316"
+	.ascii	"\373\020\320\244U\350\021\024\013\315B\275\320$\350\030J\206"
+	.string	"2A\233\240O\32064\016\225\202RA\253\370\034\257\343w|\f\377\343i\370\034>\310\017\371\247\007\342\217\374\222g\362F\374\223\227\362S\376\312[=\227\357\362a^\314g\375\231w\342\327\374\233\207\363\\\337\365V\374\025\265\2540\324\037\225\206zC\305\241\016\261\240\032\251@\324\250\252\244:\251F\324)\225\252V\325+\265K\365R\305TP\263(\030\203\360\374\352\230%v5S&\210\253\222\t*#\304\fW\022\272*\201\253W\273\206\301\n\n\003&\250*\366e\314\372_\220\020'\322\206/J\326\324W+]\263\340\252\226]\271\324-A@bH\214C\340`\251\361?\240\255\"d3\337@\334m\324\260\317\026\303\235\215\032V\332a\236\031\346\032\247\351\033\317\201\231\350\026)\3550\321-\"\202`\302fX\003\361\336\234\206D\023\361\321\305\267\363\004f\r\314w\351\212\035\213a\320\314\035\325\331\363\345\"\250\357"
+	.string	"\323\bh\346\032\220\261\230>\007\314\031\007e>\323(\306\024\301\334\373\216v;\267\335Pw{\026u\034I\324`\347\027GN\247\303C\323f\323\265\327\274\233w\333\r\363\315\201\371\232W\267w5\030\263\205\334\361\321R(\346v\330\226k,\334Y.\207\227r\3077j\035#-\205KK=\213!\336\262\n\246\250\225\362k\332\031f[Q\004K\020\300\230b\276\361\314\233sGXw\234\004c\316d=S\227\313H\257i\324bw|3\r\324\341\r\301]\3579\211_\035\347\271\313\301\007$\f\361\216\343\366\300\234\271\230\020\314YM\337N\303\266\035\210\267\354\305\324\341\3153{\256uN\3533\346\254H\2077\221\314\316\2326\332\321v\317\3549\227\343]\0049\215w\232\3367#\2115]"
+	.ascii	"\314\305\fu\256\305\336\\\fw4\030\260\331\271\310\267\230o-d"
+	.ascii	"\367\305|M\321\206;\355\332\370m1k\340\216\207F8pN\007d\203f"
+	.ascii	"\316i\033\357\272{\363Mh\316\212\224r\r\324D\262\237\311m\240"
+	.ascii	"6z\221\303 \327\"\356Y\307\357\r\324H\"\347;4\242\365\033\233"
+	.ascii	"J\275g\2066\034\3464\266]\245>Dc*u;\303~s\031\274J\335\200\371"
+	.ascii	"\232\"\347G\271\337\032\210oN\n\201\306\250a(\2151\246F\204D"
+	.ascii	"R\220\024$\255\001\261\005\3040\004\031\332\006\021\300<\246"
+	.ascii	"\240)+M\322\030\020\354\310}\310P\016\r\251\t\233\304'\333\204"
+	.ascii	"{\027\367\317t\243\375#\"cCW\204"
+	.string	"\232\277\364g%\315;\013\376\033\324\020\037y\225g\242\241\333OV5\277\222\t!J\3071\027{-\240\002\334\267\234\312\254\003\030bm,\343\005A7\315 H0m6\2441B\377K\274^\271x`\300`\366"
+	.string	"\340\026w\007,!c|\216C\002\032+L\244\203\234\003\344&Y\216\321\377\271\350\266\277\366\366\250d\364\223\213\025\317\270EFO<d\371\"\353t\315\032\361\216\370\300\037@\330\"\247\032\344\210\372v\200\334EF\377\210\214"
+	.ascii	"T\376\224\356Ud\343\370\351\270\311\306\273\032\211\324\315\263"
+	.ascii	"y{\201g\205\030\026\334D\202\334\f\337\320\f\211\242\306r\027"
+	.ascii	"\317E\205\033:\256\315\210U0JNM\316\251\232\241\302\317`\033"
+	.ascii	"\223\232k8F+\306Z\254\376\230\t?\"\277\337Tq%\246\3170b\005#"
+	.ascii	"\304q\264Dj\200Vu\n$\234\206\316\";uy\327\243\303\376\254\312"
+	.ascii	"\367|\255\276\220n"
+	.string	"\212m\326\263\306Jgf\367\035\302:9Y\307\312b\247:\331\005\217\366V=8RDn|s\250\336B\344z\334\266\2649\206\254\\\303\006\346\377\242\233\270I\237\351\004 l\272>6\264\240\245d]f\006\372@\341\212\332\316\343\352t\255\005\221\035\2759\353JB\006{\001\006/\327\325\312D\211\003\210J\354q\221\334\023B\242}\021\313\220Z|&\325opG\350\246_\251\277\242\350\0251\273[\303\004\341\273j\021h<\204\302\013\365\016\313\342\3357\242\377\n\f{E2M\256\242e\215\366713\244P\203|\035\341ys\335\225\233\361\201\360\267\214\335=\255k\r\003\027\210\033\317rPr\262,\n\303\353\372\311gf\243\215+\371\346\266\036\212^\236|\246\373\350u\t\223\226\340\235\232s\235\273\205,\310\270I\214\013\017J\374\204m\2551\324I\360Y\021\315\312\n\017^Ed\243H\003\246V\212\234y\327"
+	.string	"\177"
+	.ascii	"\027\r\022\217H\204\f\017\002*\347tX\316\032\004\341\356\216"
+	.ascii	"\322s\330\265\f\241,\367\205\021\322\025\235v\250\371\322\004"
+	.ascii	"UF9\223o\303\203\036\016#\375h\304\372\211\311X\227s=\234\357"
+	.ascii	"rl\026\312\376hn\255\236\276%\304kl\376b=c\252z\006\344\303\367"
+	.ascii	"\316\017\250_\364\204\r\356?v-\370;t\314\"\353\201\300\332\241"
+	.ascii	"\230\275,\232\r\331\261=\337G\3011\256@f\327\252\202\262\256"
+	.ascii	"\f\215\210&Sd\264\347\306O\3141 \331r\017\227\2655.\312\266\022"
+	.ascii	"\026\256\340\r\334'\n\353\302\361\222\t1\235\223\220\341Q8\202"
+	.ascii	"T\330\364\021'fi\271\252\256r\206\302\325\301\373\357\202\265"
+	.ascii	"p\310\255\244\3124\3061\200\300\321z\016\273\357Ewg\b=\342\234"
+	.ascii	"\331G\274\227\3124\3614\255\323\266\021P\032L\343\354\t"
+	.text
+	.section	.gnu.lto_cliHelp.317.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\313\002\365\024"
+	.string	"v%\210J\240\024R:\202\315i\2356\334.\255:S\365\245\354S\352o\213\037*\274e\034\271\362\343\300\013W\331\252\333\277\254\366G\217\320\272\310=\277~\342\327\340\035X\207\367i\324\002\364\240\365\251dK\240*\253\345\243b\311'\204\310\235Rt"
+	.string	"m"
+	.string	"t"
+	.string	"\306\331@\266R\325\023\246\361j\247\311H\255U\266-\034;\t\274O\212\373\353t\231%\271\024\347/}B\321T\221\236/\367\027y+\243\341y\210 AF\030\032\036\351\350\311\302\007\350\256\0217w.<\345\361\361h\371s\222d\351q%\003\305\247C\"0\221\342\311\304\267\243{\341K\206\306,!*|\200N]\022j\255\246=\237\317]r\333F\266!\330\364)F\245\034z\\-a\214\252\335\237\r\314Q\030\022\324\013\257\220\r{\360&\227z\227\232.\365Q\n\37002\225x\324\261\326\020\307\255J,\253`<x\373@_H\343L\270\007q"
+	.string	"\344\004\325\224\237\2411+H\255\300\005/\315\340|\331B\336\304\366\251\375\244\317\300]\t\304Sj\025B\242\252\025\350\342\004\347K\003\257b\276</\300|\031[Fe"
+	.string	"J\367M\257\3020"
+	.ascii	"\253V\336{\031N\336\213\202\227v\314\214\245\247\270\203\250"
+	.ascii	"\2639\332sRJB\356\317v\315\244k\013f\355\350\021\3332\227\252"
+	.ascii	"\031\030\212\262Y\301\202\242\213\242K\"rB\2776m\003}\3170A\273"
+	.ascii	"\315\331\246\271\215\332\001\254Zw\016l\177\270\223\r\313P\255"
+	.ascii	"\273\007\303\327\270\221w\361\322\036n\314\367^\3727{\341)\254"
+	.ascii	"H\032\022\276\305^%0\323\267X\213K\213I\273L\rmF\003\315\314"
+	.ascii	"\345\331\013mf&\253\241\305\320\310f\266\233\354E\3055\01626"
+	.ascii	"Y\207Z\315&3\001V\242/=\245\247\210\204\230\263:\242\327\376"
+	.ascii	"\fs\344\202myD\315\023\273\326\r\314\235\254\265\326s\177\307"
+	.ascii	"1\311\205\355\311\217\")+\036\n\035=z\205\332\025,\020\350)\032"
+	.ascii	"\211\272\315Q\327\352hP4\3677\365\275\360\0348nl8 \320\002\231"
+	.ascii	"1\352\006O1\242h%ZA\302.\032\020\362%\365\356\0345\006\246\265"
+	.ascii	"\033\"\037\200\305@\036\244\"\347\261\214!\220od9\340\3616\270"
+	.ascii	"s0\210\220\234\305\363%[S0\254\210\260\277yfk\227\374\306\036"
+	.ascii	"\225p\030\242f\260\273c\366\241\226%\267r\007\020V\244-n\241"
+	.ascii	"\315ig+\254\371i\263\t\b\213\330f\255\307\2005\234c\274\213+"
+	.ascii	"Ei;\347){\265\360\t"
+	.text
+	.section	.gnu.lto_cliProcess.318.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`1\030mw"
+	.string	"z\300\204+K \220\342\031\003\233\240\232\365\3500\307r\303"
+	.string	"\320\035\240\205\200`\035\036&,\301\330(I\342B\201\003i\232\007\310|\024`X\n\212\027(\005\265\232\013\240\306L\336*\325\377\271i\245\bS)w\200F\343Bwy\311\312-SJ)\255\002n\002\255\002\316\316\023\241\304\263\306+\366#i\nX\230\244l$\337)[\307\355\273^\342l&2\332W\357\025C\273\232\002&\332-\036)\033\331l\036\267\221m\353\270\215dn;n+3\033)%\302\331\325\031\033\336\301\367&G\236\243\216\304\367\275cj$\027)\033\351L'\363\227\237\261\027\352:\326 s\262\370\276/\324\003q\357\240|}\230\331\206\306\250\333\273\346'Nb.\245\263\371\216\213\304\226V\326\b\254+\253*\021TSRQ!\240\236\234\232\230\226\224\222\220\216\214\212\210\206@4?x\020\n\352"
+	.string	"\304\341\307\247\207gG'\007g\303\215\r/\251\241a\316,\225I\027\331\276;\271\303\232\357\202\332\2365\250\355f8h8\227\213\226m\022[ES\304;;F\25525xV\031G\037a\327\350Xv\214~ee\207\365\252v\211-0G_\243\213-O\fn^Z.\372\305E$K\370PM\005\023\037\233\312K\337T\227\226\212:\354\020\327\250\241\\\264\320\241\264\374\005\372\223`;e\321\342M\177\235S45\034\024l\246.rQ\030|I.*\305\225\256\321\027\372"
+	.ascii	"=\tK#a\351\243\2766\272F\373\372\370\274\b1\212\023!\356\371"
+	.ascii	"P\033\232]\203h\247\306\026w\3645\n\245\245i$\223\241\345\242"
+	.ascii	"-x3Y\242\020[e\313\321\346V\243?\264[.\234p\303\341\f\025[.\252"
+	.ascii	"\304=\350\265M\253\325\205\036;\310.\211w\2406\220S\233C]\377"
+	.ascii	"\264\311\261\033q}\215\322\265W\215\211\177q\356\363\003"
+	.string	"\255H\367\354\3449\366)\266\241\025i\236\272\235\266\nG\037]_\243C\332\345\027#z-\027%\342:PG:\305\037hl\235\023\224\347hUlC\203k\034!r\321 \276AH\333\224\213\276\371M\253U\245\013\322\327h\n\3553yr\245\367\032\204\\\024\316mZ\214\255yI;D\204\032\245\257Q\270V\350\257\311\\O\333\323\206\327\264}\245.\257\257Q\036-\211\267\274$\275\007u\232d\211\037h;\232\tb\246m\232\341\210\216\276F\327Z\035\265(3\264\\T\207/{\362\034\203(\266\241\255\265\262]J\364\033\303s#\256\254\345\242i\236l\233\327\250Z\333|\337\227\211\203\314\335\275\306\241\232\002.\356hd\373\024\230\243\332\327h\265\305q\353\202\327\326v3\034c\336v\323\024P\317\216\261\r-\333\3376\245\265\220\305\006\307\263\325\341\202\304\255\251\335\236\320\366\254\341\236,\361\276/{\031\016\264\346"
+	.ascii	"\232\031\231\305\314\0370\353|\020\276\234\312I\304\262\320\247"
+	.ascii	"\304\372\2537\343vi\2453\210e\301:3\365\334*\255\276\352\315"
+	.ascii	"\230\233\255\343N=\214\267y\233\002f\241sO\317:\025\346K\271"
+	.ascii	"\006\305Wq\346}\020\266\025\034\236\341\367p#re\331\262\275\337"
+	.ascii	"\346\374\247\302X\243\222\251\227\357?\214<\371\312\357(}\350"
+	.ascii	"\244*\337W\254\313\270\013\333\3209eg\235\223\352]\346\244:\253"
+	.ascii	"N%\336e\313\357\265\036P\006\240\267\230P\276/\215*n\031\234"
+	.ascii	"i\003(\207\210\3406R\371\\\206V\257O~\213H\366(\346\331n\306"
+	.ascii	"6\265\302\244\f\327\353!XCt{0M\216\370\271/\035\354\030d\024"
+	.ascii	"p\300\001n#\275\276\367\272\r\\\363\262\310V\255\241F\211C\276"
+	.ascii	"p\335\207\201w\210\374\366\335\3672d9\270\220\377[\226=\303\355"
+	.ascii	"\372\366G\230\002j!\373{z\226\201\374\237y\201.\357\262\256o"
+	.ascii	"6`\277\340\001\003\r4\3406\362\277\255\235\200[\225\257.\n\213"
+	.ascii	"e\332\362x?\363\212\b\274\313\030y6&\205A\032\037\346\177fE\376"
+	.ascii	"\245\374\201\333\177\001\236!\rodn\027\272\312\007\334C\230\305"
+	.ascii	"\004\336e\215\344\236\300md\277\334\232\2277\266j\232\230g\231"
+	.ascii	"\357\302\374\245\314\375\206S\226\360\373`\216\001\343\305\227"
+	.ascii	"\327\n\025\315\327\234\242\253\315]\np\221\330\322\312j&\315"
+	.ascii	"#\260\256\254Z\257\271\252\2474\213h(\315T\r\245y\212\351,\345"
+	.ascii	":G\3158\207\250q\206b:?\3318;1\235\233l\234\23168/-\235\225\332"
+	.ascii	"\2579\251\363\232\221j\234\217\230\316FL\347\"\2463Q\3535\017"
+	.ascii	"1\235A0\235\2337\316\037\222\316\036\222\316BI\347 \2463\020"
+	.ascii	"\323\231\303\214\363\217\215\263O\215s\317\322\231\207\351\274"
+	.ascii	"\303t\326"
+	.string	"a:\347\3248\343,\2357,\235oj\234m\226\31654\3164Lg\346\322yf\306y\271tV*\235\223Ig7\351\214L:\267\256\363#\235\033\004+\304B;\272<G\033\317\345\356\275\221\255\341\035D\376\025\351)\335~\335|\335L\272\363\272\365\272\241tW[\311\334\314-\205\333\257\377\374%\241\307\233\343#\257\314\024\255\251\341\210>f\362\205\320\3264\325\202\345J\251\204\033\257\237t\013\275\307L(\"4\303p\336\327Gu\n\225\236\373\300b\207\305I\331\244\235\004\331'\227<$\335d\006*F!\270)\036\305\032\226\214\226\023y\021'\225IX-\263\030g\303i\346]\226\342\225\316\3100\016\216}\330\231s\315\373\332y\234\221Qt54\277\"\301\366\360\336&\364A\357\341\221b\310r\324\b\275\233\205\354o&\350[16=\246\205DT\274\303\240;\254\337\020\f\203O \316\033>8\224P\003"
+	.ascii	"\223<\026\375@\320\250X\303\302\021\t\026\2665\253\274\225\270"
+	.ascii	"\233\223\332S\330fB\005Bgd\374\270\212\033\227\017\2069:\240"
+	.ascii	"c\036\200\276\343\360\f\331\200\236U,cZ\321\034\t6\204\032*\254"
+	.ascii	"-,H\351\020\350\305s\313!\306\217\030\361\034\336\204\340\016"
+	.ascii	"\016\357\023\244\273\271\221\0052.\035F\374\213w\272i\026,\224"
+	.ascii	"\355\347\233>\377\363\316\327\363>\337d\217e\256\346\245L\353"
+	.ascii	"\371\034\302*\266\356O\314\263\316^\030\251S ,X\252\365\247\257"
+	.ascii	"\355\211\330#_v\274>\306\233qsx\2513;\325\234k,\f>\177\366\332"
+	.ascii	"\tJ\317\327s\3133\364ToF\365H\357W<-\314\344\260\206\013>/\355"
+	.ascii	"\322T\377\365\277\3024\220\ft.\312\227\315U\\fg\nN\025j\310\254"
+	.ascii	"0\370\344<\317\242\007\215\017s\264\023x>\307\255\312\205\361"
+	.ascii	"\263\2527\214\364<yG\361\250S*\344\004\242\204\006\200\024\304"
+	.ascii	"\t\247tFf-9\204\321\215\347\245\214\364C\337\215x\207L#\217\204"
+	.ascii	";\327\336\371n;\333\371\031\267\352\026F\035\0357\253\241\231"
+	.ascii	"\257\363>7}!k\363\314\234\201\333\360\372P\303\023\247\201O\312"
+	.ascii	"\300\344\021\266p\226\363Rn\013\261\323\02260\277H\002\037\243"
+	.ascii	"\001\364\254\n.6\333\313E\342a^Fo\357\373^q\027\372+\342-L\316"
+	.ascii	"?v\031\230n\031n\321\347\274/Na\340\002e{z\366E!\t\316K\313\264"
+	.ascii	"\f\227\371/\207\227\245\310H\242\217\rN\"\256\315w@4\324#\034"
+	.ascii	"|r\363R\234\267\371\276\342Q\200s\363\033\376\307\tt\356\271"
+	.ascii	"\270\302\315o\005\261\366\030\f\234D\270M\270\215\264\3716\323"
+	.ascii	"A\3633_\363\r\235c>\315w\030\346\037\031\202I2\323EX\r\254\263"
+	.ascii	"\212y\226/l\221j\363R\356v\331\212\304\001@\203"
+	.string	"\365H4V?\364fCFa\202]\226\320@\270BM\313\274\362C\262=,f\325\033\3459\362 \223\2024\303\022\302\204\361\310\303\240\267\2517\213\322X\347\021\252\302\367\205\"\366\027g\221\326\210\363\210\362}\241\313\036\315\210n#\247\276w\254y\311\342\005\322\360\306\226\346\245\034\254l*[FB\241\300"
+	.string	"\006 5#H\341@\263I\200\023"
+	.string	",\260@\227\211\346\211\025]'\0228\361@\020\033\020\225\025\305\242\003\002R,:09\001\026\035j\220\036t\360\245A\f\027_I\027\215\001\007->\006\f\013bx\340\302\305\240\003/\027\255\006\335\242\271\305\223\006\033\264\200\352@\003\0138\200j\001\303\003\250'\036\376r\341\005\003*\306\327\027\f(\346\335\333\357\343\237MJ\274\002\317-\t\021\317%\365&Px\3243\203\305"
+	.string	"F\350]&\345b\242\350\326\274\310\300V\235\272\352\b\303EE\342\271\r\342z\021o\026\025\275\341\204D\224\207\350\372\020\037c\212x\205\354\021\n\001\007\343\345\243\330\365P\217OX\240\177z\177\233\"J\201\262=\007\203\224m\355\021\001\242\365\322\246a\230\037W\262\224\264pV\214\214\020\354\031\256\323\233\310\322\203N\237,\243\2742\344\2125\206\212\227\005'\016\320\311\225!\330\026!0.J\350\013\2453G\265\037>\303\026e\230\246'DV)\003\343\324\006\372\246o/S/Z\240l\316\210\310h\205bm\f\234\222\361I\255z)g[+kc\334\200\200\004fE\2505fK@\304\243\222\332zn\227\270\236\304\233\365\f\227\351\273\315\263\270\340\f0C\260.`]\334F2\375\214\233U\260.\355"
+	.ascii	"\367\267\031\006\227\251[\212\277\340\244\366\274\001\202a\301"
+	.ascii	"\024\033i\030\204~\330\324K\255\334\270Y\257\320\205\021\363"
+	.ascii	"\254\024\001\336T\334\00501F`d\224P\007\220\300\030\301\034\033"
+	.ascii	"\261p\200\316Em=/=X\031\367\003\313\306-}\377\365\211\247\265"
+	.ascii	"J\235\024\342c\210\247\254\347\246\254Oz\322\372/*V\232T\374"
+	.ascii	"\226\024\347\221\243\267>g\221\266\207ta\322C\260&\006\b\324"
+	.ascii	"_\357\fb\251\b:\271\221\346\226\211\353\265\336\f\353\320i\305"
+	.ascii	"'\2050y\310\242\342{\316#U\016%\353\375\020/0\211\204/\313S\326"
+	.ascii	"\257x\033\272\251!\027\367\020\020\316\351\245\354FZ\005\227"
+	.ascii	"+}Sq='\225\252\360\311\3239\346]\246\342[\255\307X\223\032J\377"
+	.ascii	"\201\320\332\307hM\362\340\343kz)\264\355\234\211\227\320\333"
+	.ascii	"\222\376k\025Ok\024\2720{a\344\230\224\210\276\275\303\372\305"
+	.ascii	"%q'\271 \336\f\304\243X\013\243\344o\351\245b}\364.7\347V\257"
+	.ascii	"\253\352\321S\005\371\273\311f\263\331\226\341\022\275\321'\021"
+	.ascii	"\241l:G\242\244)\021\275\313%!\372\234\247\325I]\332N\023\264"
+	.ascii	"\267$#\247K\234\026j\311\021\222\265\202t\324|$\217X\006\346"
+	.ascii	"\3037\377\313\220=\212\371\234\223\252<\222\342?\274\317\263"
+	.ascii	"\032\201\374\250\201$\344\030ThfDD$)H\222\306\021\005\204 \347"
+	.ascii	"\240t\347\001\021 1T\220\215&I\n\215\001\017M\330\341\210\343"
+	.ascii	"\306\377\252A\201\036\241*6\016\307\022\376LCOu\032\240\313\367"
+	.ascii	"\332\347\244\3379\020\331\214\256#\203\341\311\320*\232\322Z"
+	.ascii	"\231\352\177\023\013\265\3254\252\316h\223D5\262\3771\363JX\030"
+	.ascii	"\344\314\033\215\212\214\r\320Fi\214\355d6/\250\265\317GQ#\270"
+	.ascii	"\330\32091\316\025m\251\315\276x\024\361\204\n\300\206>s\356"
+	.ascii	"\006\2724`>v\2066\313\022p\315\235\332\025\363\377D\211\207}"
+	.ascii	"\314j\004"
+	.string	"\235\nzM\345\002\203\020\037\336\262W_W:\004\177_d\366*\350\331\375\223\205d\372\201\033\346\356\f\237C_\033&\371\377\027\317\253i\224VqKn\230P\026\332j\305\0279C\001\231\206\324\013)\213\255\264\306\325<\031\n\301T<\016\257\245q\3305;\200>\211\206r\243\242\352[\312\017W\357\031\303\")L@G-Sk\201z\241\345|\224L\n\302o\265\201\324\221\004@z\177\t-\004\215\374D\241]H\032:\250\345o\315\n\322i\261\246O\024}\330\")9\370t\342\r\355\016WQ9G\037;\001%\r1\312\b\350\030\330$6\223\233\363\225)\020\362\265\236\242\027\224Y\032\337b\203\365\n5\363x\\\356\017D\320!\t#\210p7\007\231)\326c_\210\213\352\344\272\346\370X\346\003\0322&w\001\302\365\002\330G\\\311t\230;[4\242Q\271\357\240\245R\364\303\005\253w!)\334L\013"
+	.string	"\013\371\20400\247\016\027\360\312\0058\310r\243\205\277\314\026D~\232\263\262+O\f\325V%\317\210\266@}\317\327mr\377\207\220\300\333o\263\225\217\2517f\317\225\022\363\202L\322\r\027\033b1"
+	.string	"\234B\r##\306Z>`=Gi\3154b\276\214\250\243\020i\343\230\251+ml#\215"
+	.string	"\f\371\035v?\352\321~6\350\211\231\0262\273\313\224\212t\235h\302\325\202\267c`'\34064P\251\276\241(\262\322\326jmS\237\020\036\370\310\305\211\351\225\324\236\336\310\230\304\036\340\271\236\216.mM;\210\300\224\035l-\300v\207\336\337\244J.M\360\037\374\340G\275_\211C\356\206S\274\300\345\311\361L\337\277-\337\313\312\214/\027!\372y1\207\r\003\276\304\300\315\370\336SB\037LL\201O\206\224\006\336\363\271\f\334n\r\207\026\024'\016\0056\315\344\341:\233\323!\004-\327\243\267\303I\322\030[\023_\t*\022\037\274\305bf\321%\221\252p1\026\323\270ra\314\254\363\035\256S\201\303\210\272CM\"\360G\236S\033\261\n\001\"\257\b\210\033\2153g\033\005\023\242\375"
+	.ascii	"\350V\200\t\207\213\240\202a\314*\212"
+	.string	"\364\360\232h.\314E\310\233\323\026'm\001\344\343\025p:#V\321\020\350\2630\027RW\327\213Y35\246\020\266\2342\223\360T\324A\375,+\032\207 82S\216\026k\177\333\314\315pUT\317\350\2043\213|\241_g\227\346'\32054\261\274\375\355\353#\221FA\3273T\204\r\201\303\002\352\203\207\270#G)g\037r\b\274\207\025\013\005\b\365bd\311\n\315\021\263'O\263Nm\216\221\316\201_\342!z\341\236\311\235g\334tt\343\003?\266,\235\306i\226\020\226\230^\232\177`O\246F\026\337\367\210\005Ji\006}\327\237\223_hd\"Z\r\275\333\332\01766P\246\336\331oi\211\365}\233\021%^\372\354/j\337\234\212fo\360\336\367\343s\013?\235\3519O\241\231\247v \277\n\217\353\335\021\t~X$\302\241Q!\312\225J8 (\"\327\263 \341\365L\027\326\232\307l\030p"
+	.ascii	"_E\340\243 \202\3122\334\006DI\300y\246it\270\301\345\247^\363"
+	.ascii	"\361\007"
+	.text
+	.section	.gnu.lto_cliEnter.319.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\320\001\375\021"
+	.string	"\326\241yI\360\320&\035\235\375D~ [\351Hv\314\255\346SDK\252\341\233E\336\2230V(\231\032\202Z\356j\326\202\263\236@\304?>\261\007I]5\234:C"
+	.string	"\021\222&x\275\320\373\271\r\240\rwKW\036g\033\355\266wJ\001^"
+	.string	"`"
+	.string	"i"
+	.string	"\224N\3179}\220\220$\036\240\017/r\261\313a)iku\206\211\017\333\237\366U\334g<m\346 \2739>B\273%\211EP\257.\257\342^Q\017\300\275z\264\213\004l\330\032N)\307,\biw=\252\363\361s\364\377s"
+	.ascii	"\344\r\354\363\224`w=\311\233\0167\275m\002\266?{\"\b\244\377"
+	.ascii	"\3420\"\370;\257\226\320\322\342\302\242\006ll7j3\nsj\236\250"
+	.ascii	"\375\322\232']ml5j4\024\346\023\365\203\336b\246BL\f\367Ji:p"
+	.ascii	"@\374 \347\2578\020\350\357\330\302k\236|\365_\334\353)\004"
+	.string	"\355\b\351(6\227\354R6\251\b\373\246\335]\323\034\373\264\377T\247M\246\351\343\211\021\205Md\276<\216\261G5b\267\346\344\230\002U\343\255^\355\321g\374I\331\214j\003\246\211\332'(\035\245&\372\331-\366\024nRJIfC2+8Q\nj\227\306\304\247\361\241\005*++\334\353\244!,h;zh\324\027\272\f\r\016XX\270\327+\221F\252y\242/\037@\260q\023q/\037\243\005\265\033{^\311\300|\024V]\bv#\256\360\202\370\205\035(v+\261\205\341[u\237L\006\261\033\371&\200*]\n\203\223\356\305\325\n?\321\205\342\2212\021C\260\001\214K+\374^\036f\225\264`X\236\253\345\022\343\261\302\227W\2422(\363\205\236\b\202\241\367Q\306ns\303\251\305\250L\347\346\341\300\264G\022c\211[MFa.0\273\375\310\303\331\001# `\002\221cv\007\277\030Rh7b\233"
+	.string	"\336\013\346qI|o\3341\314\007\312\033\273\335q\t\265\234lY\363\033\305\235\364Y"
+	.ascii	"%n\310\244\245z\237\276\360P\347\004\026\227\350|\300\335\364"
+	.ascii	"\005\037k\274\002>\311\0034[\020\314Za5\213\321\260\313\2136"
+	.ascii	"\220\001"
+	.text
+	.section	.gnu.lto_cliInit.320.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375 \364\245\006"
+	.string	"\202L.2`o\032\003\340Z\fR@@\351\026\003\370c^3\007\272^\331\323X\"\263[\335\021\325r\020\373G\021(05]\334\311\017\036G\365\036\223H\312\224\002\020\360\241\023\0358\032(7\236\201R\031\310\241^\007j\"\036%=/\203i\224\330\3107\021\243|\027\353nU\021*\232Ek}X\373h\r\360\377mU\313\016F,&\036\026]\377\3065\372\212S\t\271\2645k-\342\221i\022\n\023\374\025J\312o-Ta\262\253e\214d7\271@\262\353l[\f.\216!]\032\031'\242\377\257\201x\232\315\332%\026"
+	.string	"\205>f\001\r\377\313@!\016\267\271mB[\206\266\035\001\t"
+	.ascii	"\357b\310\f\215\250q\270 \007\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_cliBatch.part.0.499.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\303\002=\027"
+	.string	"\346\352\233H\260XUcbY^LW\3478(\256\b\020$\3118G\334\235\3635\030\217\306\206Y\351\202\355\325\201\210Rx@\310\233\376<rb\037\026\302h-\363\265v\230\217\253W9\024\034\003\023}\004D%\267\037k\177o)S\n\202"
+	.string	"\177"
+	.string	"\214"
+	.string	"8\347M\007o\243\272y\236Fu\323~\017\333G\266\226\007\243.\223w\266\226\033\245\313cp|r\202\370\345\336\353\272im|\367\230s\2452K[Y;\277\"\303\360\036s\n\177\240\306\n\027_\325\037\260\351\252\023_\221SzR\212"
+	.string	"\233n\312"
+	.string	"}-\240R-e\200\276\0260\251\332\322f)\307\357Q\230\234J\004F%^.|E\001\354\325*\340\254\325\203{\257\217\364\342n\335\366\r\333)\354\312\013V\222*\030\267\252\275\007\325\207'r;\357\365\375\227;}\nrn\336\332 B\324\377\252\255\231\021\203\306\321\350\263\274j\241lY\267\311d2i\373d\233\325\245Ym\313\352\372\340\177"
+	.string	"\346\0219#\343\336\245$\362\3220\227\350\260}_\310\211$>\264mBe\207\f\037\367^\022\367\205Gv\253\345Z\037<z\220\0227\301\273\202\311\265\332\377q \273\007)\361"
+	.ascii	"\367>\371HroP\347\246\003\217\002cLr\016\250\366\204\nRS[\212"
+	.ascii	"=\313\343\261\272\251\037\236\311\205\002@\247\317\226s\323\026"
+	.ascii	"\032\022\376*\240\304\250(\234\252\264P\321\324\017\371\222\f"
+	.ascii	"\004\2424\234\276\0059\304\r\262\372\237O<\013JS\361hL\262<\333"
+	.ascii	"[*\213\r\030\246\205:\362\322\276\220\314J\213s\343S\260\250"
+	.ascii	"`Q^\204\312Z\335\360\212/u#\"|\034\256\021\325\377n\372D\252"
+	.ascii	"\233\326:@v9:!\325\244\355k\023\245\245\035\326B9\301\25351\f"
+	.ascii	"\306\345lF\037r(\315V$\033\201\203\315\230V\243\341jh\207\231"
+	.ascii	"\221\214\003J\303\311n\267\334\253\306=>0!\037X\220\317\317\013"
+	.ascii	"Mc?\022\322\b\350P\n\303\220\306\320\024\bBJ\301\002\252\203"
+	.ascii	"\362\244A\2574(\345A\323X:\204\002\305~b\261\264\201i\270ZY\303"
+	.ascii	"\331\212h\267\331\312\263\035[\321\314\205\263\311n\256\231."
+	.ascii	"\204k\307\306\271\0175\235\313(\227\323\271Z/\257}rk\352XD\262"
+	.ascii	"=\333\227\367\336\033C\343$5\320s\372L\330).\3055 \260\002\031"
+	.ascii	";[\fob@H\341Ze8[\003<\201\035\036\252\350\002\207\2034e\373\025"
+	.ascii	"\313\315\224u8\301w\307\363o\331\251\362\342\235\236Z\253\263"
+	.ascii	"\034\026\253\305\272\"7HY\301\0066\316\357\255 \354\206\274\037"
+	.ascii	"Qf@\344\370\305\261\271E\364\"\220\206Nw\370\006{,\030\333\013"
+	.ascii	"\375\261\2579B\334n\007s\262S@\334\357l\243\025]\273\201IsL\240"
+	.ascii	"N"
+	.text
+	.section	.gnu.lto_cliRxRange.part.0.516.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\013\b=-"
+	.string	"\352O\254\021H`ZR:\375\315\336\224\213\377\003\204le_V\275w.\nv\007\356\257\375UH\277m\255k\267\252\366e\232\251\232\264\252\375\375\003AQ(W\020wn\360\225Y\270I\211\b\256-\fL-\326\315\331\2144B\310\336I\006\377"
+	.string	"\376"
+	.string	"\t\001\311ci\264g\253|\032\321:\260h\316\331\001{\365'=q=\225g\214\013\364\214\261\223\341\362\233Yua\321\234\235@W;\210\275\332\366\275w:]\312\214"
+	.ascii	"\316l\305\354{\273\037\345b\311K\231q\236\234\263\304\2409;\031"
+	.ascii	"\\\355\003\354\325v\336g\275\312\236\270^\355>Xw;u\323\335\311"
+	.ascii	"\225\231\235\354\246\0130\225\237\036\3249QV\271\3139\027\257"
+	.ascii	"\342\255'\037\314i\201?\326\267\252)\276\302d\037z\003`W\236"
+	.ascii	"rY\232O\017\346\024h\201[^wax@\037?8\346\225\022f\217\313~\210"
+	.ascii	"\025\220\373R\2377\"i\016\307\344\221.\300\n\203\243m*\357\232"
+	.ascii	"\2667\350\312\b\233\312\364A\232&\325U\357\262\231\343iJ\274"
+	.ascii	"\"+#lN\245Ae\226\364x\233\324\305\251O\225\327\362p\314\037\351"
+	.ascii	"\202\350\231\335\241\2775\232Q\367\016/\364Q\3109\367\241\260"
+	.ascii	"\336:\357n\273\356\016\322\355c\021\335\300\333=\300\333D\340"
+	.ascii	"\355!\3606\317\357\366\316\357\266\016{[\310\336\016\262\267"
+	.ascii	"s\330\333-\360\367\2617\373\265\267o=\333[=\225w\312\336\306"
+	.ascii	"'{\337;\377\017H\335T\351`\345\\\265\247\227\205\250\\\276n\366"
+	.ascii	"\223\375c?\225\237\355_\373\341\216\306\005S\273\030\"a\314\r"
+	.ascii	"\340\344\262b\312\265R\232y8\271\254|[G\234awY\312\t\004\243"
+	.ascii	"\2250\215)\250,\tO<%\227\273\234\235\305\253\300\356\307\221"
+	.ascii	"\351\t\\jw\353\217\351\026\356M\351M\311\212L\035\036\n\366\313"
+	.ascii	"\317\372a\336\326-\233\0301F\2409\347\021k`\3004\332p\253+\032"
+	.ascii	"v\307\201\375\322\335NA\273\027&4=\254\037L\335\347\362.\335"
+	.ascii	"m\303\370Y\343\033^\262\260\302r\316-\f\334\237\342\324\257\362"
+	.ascii	",\337rh\267feeP,\220i\321\322h?\277\234\207\\A\205\330\253cN"
+	.ascii	"\375#\345\314Mf\316\331\312\257\004$\266\276\322|\264\304\342"
+	.ascii	"\332\266\326\362\004f\007ts!\026\272\335\203X\350\303A, \316"
+	.ascii	"\371T\306\371a\2556\314\217k\016\276\330\223Mgo/\317\352\307"
+	.ascii	"\265\3059\370TXQw\257\201\270\305D9/7\370\355V$o\215\355\271"
+	.ascii	"\335%L\334/\373\216\315\255\271E\331\261\341@\363a\2556\377a"
+	.ascii	"5*m\311\023M\320;\310x\242\233~\370:\240\264\301\313\223Z}\370"
+	.ascii	"sP\037A\336\220\254X\253\t\330X\363JU\334S\246F\207U\2727\332"
+	.ascii	"\n\3045\336v`W\335\232\322,\r\372\241g\243u`J3\ft\026\327\240"
+	.ascii	"\373\272\227\256\370\252\315EQ\2037U1~\233c\362(3\311\2164\306"
+	.ascii	"\232b5\312\213\334\023\315\316\020\321\3752\305o\373Pm.\211\333"
+	.ascii	"M\233\252J\202\261V\343\037W\214\221O1R7\257/\306\270Uv\251"
+	.string	"Q\306\201\272{\035\274\307\335FG\367\313\213\205ejN\274\250\024~\272X\253\261\360i\306Y\001\315\301\202\007\017\0250\b\261\315\204\340\247\t\311\323+\0324!\213MH\242\321\221\n\343Q(\004R\221\3218\264\202hh<j\032\352Pdd\034B\262KCI\310\243\212\365\350KF\246\243\320\222\261(\211\311\bY!\305\021\322\320\213!r\251\005.2\036!\245H\"\3625Q\203#$\242\242\361h(\251H\204T*6\360\351c\213\"dq\351xD\026\357qV\377\350\202\270A\341\250`\202\313\340@\377\331\245\221d\242\300L\262\tK\365\035\n\236$\301\016\375m\224\255q\342E\251\270\362\242\320\234\002w\210{\360\305}\247\222R|D\320\314P}Y\201\245\372\224\202\253@\357\013\255\335\026.\334/;\315W\370\251\211\270\347G\304}y\360P\303\326\227\034\017\356\273d\263\203\2733\334\24747\357\355`"
+	.string	"[_m\3128:\270{\303\341t\370-I3\203\005\341q\3352\256\367a\345y\323{\236\211\220\3677 \372]W[\304\210\373\245\322z\365K6P:\370c\036\200\235\250a@\303\224RfdFDd$Mr\220\002\021\"\254:\021`9\204P\222\324\250\321\030\"\310\353\025\363\361\320\320\304G9\336\362\305\242=a\022\027V\032\2042\311\b]m\317\200\213\232\326\264\r^Ye\272@\341\021\035\333G\320/"
+	.ascii	"K0\rEi_\214\004X:\212\332\315\\$yY7\206U\016F\245\245$\f\362"
+	.ascii	",?\333\346\200\245+P\254z\233\245\307\"\206)\302\255\t\276\332"
+	.ascii	"\211\001aB\036\260w\342\251(\\\245\270tn\357y\367\232\203;b\303"
+	.ascii	"\235c^e\260\264\306\212\004\313\t\254\016\323\365\213\320\201"
+	.ascii	"|\356\005\236\305{\225\225\237M\201\351(+%\300\301AxL\262D\033"
+	.ascii	"\216c\364\277l\331\323\315x\370!\351\275\316\257X\352HK\036\261"
+	.ascii	"\254\223\221b$\004\303\365\3760\237\251\267\347\200!\210\214"
+	.ascii	"\321b\004\233\350h$\265\221\247\216f\244\213}\214\357_\022\200"
+	.ascii	"\203\210\331i\237\214\327N\031\003\242]p\362@\276\266\2636\020"
+	.ascii	"T;2\353D\346I\327\030\b\354'\017\221\306;a\232\3342\273\257\031"
+	.ascii	"@\271b\366\021\362\333\205\t*\031\222\330]\245\373\f|i"
+	.text
+	.section	.gnu.lto_cliRcSmoothing.part.0.524.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\226\t\2550"
+	.ascii	"\272QD\022E`^R\007\363`9\254\240\024)\340\003KL\241L\236i\030"
+	.ascii	"X?\235\021\347\201\274\032\253\366\207\232\266\341\330z.\302"
+	.ascii	"\023\267l\334\002\215\301\220\243\377\205\316\024\376\214\243"
+	.ascii	"\300\267q\376\003\245\347Zk\233\354&2\245\024\t\001\004\001\r"
+	.ascii	"\001N.\2753g\234\2119\347\030\270\376\2359\3210\361*\376\326"
+	.ascii	"\256%\013\227cY\321m\3274?\237V\374\212\353XV\b-}d!\033\257\231"
+	.ascii	"X\335\001\326U\241\367\242\325\237\254g\316)v\275\345o\375\363"
+	.ascii	"r\256a\322k\177\302\325\356\326@)\\>u\321.\315\f\270\332\377"
+	.ascii	"\335\016\305\243\270>u\341C9\243e\361\222\363\024\201\253-\200"
+	.ascii	"u\265\247>\\]e\275hu\025\350\252\267u7Ww\034\237F\363\263\335"
+	.ascii	"\35688{\311fk\231\2370*v9g\242\253X\210\273.\004\n\002\177>\266"
+	.ascii	"\267\252<\374An{/\312\315}L\350\322\205@A3^\313\366\334\361@"
+	.ascii	"\036\376s5\3172&\266\247\216\3671\261\275( 3\310\274\247\346"
+	.ascii	"\231#\354\327gBo\270\372\203\336p\236\020\n\306ks\316@\350\327"
+	.ascii	"c^\201\272/x\204\320\2277\034;\302t-\376bP\257\177\"\017\352"
+	.ascii	"E\345\234\333\273zx\013yw\327u;S7\273\025l*,I\261/\n\343SS\332"
+	.ascii	"\243\303<a\022\345\255X\037o\310a\247\355\315\315\327\357Qc\001"
+	.ascii	"\003\373~\320\240\324\224\226a\367\350\236:/\030\247u7\212\025"
+	.ascii	"\343\344\333\233\257\337\323H\337\335\341\303;\023c\245\246\224"
+	.ascii	"L\316\013/\333\361\343\027\023\366\247\353\357\332\350\337[\314"
+	.ascii	"\332-b\304;\323\261TS\212c\350\035\316\315\220@\212\346\374:"
+	.ascii	"\263\310\276\030\006\030\217\357\314&kJm\310}\341\345\343\264"
+	.ascii	"\306A\316\313\030\255\373\367\235\364\373FZ\277\217\202\337C"
+	.ascii	"\337\267\021\360\273\b\370M\364\373\036\362}\013\375\276\203"
+	.ascii	"\326oa\360\033\310\367\035\004~\003\201\337\277\337\267\317\367"
+	.ascii	"\315\256\337=\366{]\277U\366\233\327\373\306\277~{\202&\247\002"
+	.ascii	"'9\217\335\365\311>T0j\236\305\377"
+	.string	"\t\246\265\242\274`\200u\375X\260\226\206\316\211]\376\232\032\350\356\255\326J\232Fg8\210\233C\307.\347)\321U\227\342\276n\357\202|\013\017u\325\334\n\335;\377\371c\255\0206\3169\307|\323\302\320\341\312\370b\2706\224\2428\330\327\335\304\260\377\222Pr\351\227\3179/{n\332\032\204\223d\337\365\313 \f\234sv\321\003\205\351\205wn\331\220\316\214}}\307\200\036`x\331Fo\300\2058(u\"\307\364@\270}\017\322\375\321^\244\335U[]\005\302\276EL\007\020\2638\210\375M\302z\233Y\177\030\210\001ly\331|\370\207=\354\317\231\347q\323X\277\343x\\!=\304%\362DVW}\330\307\f\351v\215x\035W\315\251Ds\376b \307\351\270kNt9\1775\250\3639.\022\236\027q\265]%LW\333\335%\253\253K\256\262\270\304\233\223\213\036(]\177\007\307m2t\333\330\327\301"
+	.string	"4\245MV\246Wq\017;\234\277q\243,\321A`\337\027\021&\2743\273}\361\262W\334\3636\376x\305\376JyX\305\336\243\363\001\353c\036v\26457]^0^\177\247\006\375TU\324\272*Z\261k?!\221Xj\023\230j*\252\240J>U\025\265\256\212V\004|\375\204\245\324*\022\350u\333\342\304\224S\373"
+	.ascii	"\211\304Rj\031\251\332\243\n*\245\021B\333\244\224\265\245l\223"
+	.ascii	"Ge\025\025\262Uje]I\265MG\235\302j\312\tj\312\211\355\013\020"
+	.ascii	"2T\220\352\320j\310\360\353\366\301QYL\266\3106\004\207v\352"
+	.ascii	"\2504\036\225G\tmS\200\3460\301\303\005)\n\275>\001\305\"I4\221"
+	.ascii	"U\224\002\303\321\252\230\244\300\202\203\t\025\305\340\361\212"
+	.ascii	"\252j\312\312\330k#\024U\225\221xEU\264\"\032\223)\210P\303\306"
+	.ascii	"\312:&\211J,\254$\021\350\274\214\321\334|\250\331V&\327\205"
+	.ascii	"\275\204C\334(K\321'\343\003\024\304\005[\nc\337\237\221\207"
+	.ascii	"\210\233\0252\301$\354@b\374\031\220$"
+	.string	",\234s\242i\022\0076\266\006\364\341\212\311`\337o\316\371y9\222\331\016\244\270#\354p\257\303\035\203\262\257\323\0358\302A\351\231!\210a\021\026\302Fn\347D\270\b\003\270\363\262\ra\"\3544\276\006\215!\354g\334\004\200\274\250\221$\304 TfD&\030\221$I\322\001\220\002\221)\233\252\003\022`\205A\251\031D4\246\206\375\3773\332\205(WMJ\227x8\337\311[?)\210\375N~T\255TN\364\037s\214\256\031\021\302\344n\257\343\205x\265Bd\357\345\337JI\321\036\fqq]\204\001\203\0131\200\234\016&0\256\004\376RY1\202,%\024P\335\n\364O\240\323\337c79\334\207@\032\260<\003y\263\321\327r\270\326\221\321f\222\202\341\023\302\3553\036Q\347\016\261Q=\276\326\271%\241\355\373<eb\271d\373\346\245\327\202\221\235\355\372\244\216s\324}\263`\353\"\261\306\"<\\\240"
+	.ascii	"\276\036\201\202\327\"\322|D\222(\236\007Y2\323\t\004\256\303"
+	.ascii	"\0042\232\334 `\363n8\237l\020\305\352\023<\031vg\317\360\356"
+	.ascii	"\260\304e\356\220\031\301\263l\230\035\342\205l\021\225(\236"
+	.ascii	"\253\"e_\352k\343;ZO\375D\374\b\201t\263\332E\321\037\t\363\321"
+	.ascii	"\223\240\324M\373\030c\247\203\217g\367\3418\202\273\272]_\327"
+	.ascii	"V\232\003\215o\270`\240\301U\375\345Q\342@\364T\017\334K\\]\200"
+	.ascii	"p\264\300;\305\b\364\020\372h\364s\n\336y\304`\242\226Q\277\024"
+	.ascii	"\230\036b\331\273\374\222:\355\310\335\255\201\217\262\204\340"
+	.ascii	"\367\251b\032t\016\337\213\243\300\037_\273\261x\205_\216Oo\345"
+	.ascii	"`qb\250\246\275[\212]^\032"
+	.text
+	.section	.gnu.lto_cliRateProfile.part.0.525.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\002\001\005\r"
+	.string	"FWVE\020q\224\016\200\026\251p\thr\b\255\234\"\"\002\240C\225"
+	.string	"XUg\234\213\344;\260\352\274\252\236 \331\366\237\232W{\217\330&\003A\377\032\177c\326~\224J\006\001\303zW@\024\177* \321\332M\366N)="
+	.string	"A"
+	.string	"D"
+	.string	"\227S\355\001.\247\333\351Q\330\006\355\225\217!\353\341\320^\021\340ZQ\001\213J\007\222\033\273\333\235\316\022\017?e\026\372\342g\307G\210K"
+	.string	"\3170\234\335\265&\342\246\267\235\300\366\003\373\253\225\303\270\037\036\027\361MZ\234$|\t\353\013b\357\301\004\213\f\033\273k@;\255\331}\021\320_\341m\004\374\330\252\342\210\002\247\226\322~\212\253\b?\266\236\331\215\245\274\330\035\017\234z\243\235z\274&\364\216qy\312]\\\330\204\354\276\016Si/\216@\206\225<\314Gy\206F\r\225\031\256)\312\t\342\231=\333\031\263\247\304\261\240e\367C\216\226%Aa\234\370\311?ri\337?9\013\037\305\233\t\370\022\226\003\2460\032\300q\b&T\017\250v\032|\"\210$\200j\307\301\307\003\nA\250\035\021\203P\375N:}\245\221\311\303\330\343\276\222\327\235\276\n\246\316K\251:Nc\224\005R\252\303\200B\245\272\315\266\374\214\231\243an\230\023\304\266&\003\035"
+	.string	"\357\202\3039\003w\265^\311\275CX\200(\030\346\n\367\232\025d\251\020H\235/e\301eua&\310*\230V\241p\254\212n*,\346S \b\361\236Q\212:\027\230\3564"
+	.ascii	"\\{\300\215\026\321\357*c"
+	.text
+	.section	.gnu.lto_cliDumpRateProfile.part.0.526.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`j\001\275\016"
+	.string	"\006[aF"
+	.string	"\223\223\016cf\205\030\252\356\354\363\355}\275\317\372\220\250\037\260\223\274I\003{\262\016\340\317\277\370\217\b\322\203\353\240\b\226\276\236'm\343Z\233w\377\002\222\0021\206\203E\223\002\331\355\340\230\250H\020\331D\312\224\002H"
+	.string	"H"
+	.string	"R"
+	.string	".\031}\307a\261\356\222\330ac7T\360\350\003\333\243\375\025\266W6\317\303\233\235\361g\363\220\300,8\0222\"\306\025dw\271G=\361\357\232\331\347\203W"
+	.string	"4!\236#\317DLv\327\233\210;\336\366\002\333\017\354\373\b\366u~\215\351|\316\377O\306D,vezb[\"\336Ha\373\366]+\373\363q\226\327Y\205K\223\245\375\360-\276\273\360\220\201\366\305\004\210\321\366h\340!\3551\373"
+	.string	"\355\321\232\317q\311hu\034\226\207+3cM\007v\005\013=^.\nz\204\306\005\002\0306\226\003R\211\207\200\374\213\317\320P\340f\227\365\326ic1@\200\202\312\267\234"
+	.string	"\246\343\365\242\240S}\030\217\321\371(\274A\225o=\372*\355\361-\3305\365\256G\370!\243F\314\220\226\354I\265\261f\331jM\276S\001PT$\b)\024\207\223\355\203\351D\245\201)\345\224\241\363$\230VH\036\310%\321)\245\304\251\234H(\256\344\2518Q\310]\312\344q+]\347q\037\333y\255\261I\213\272\250\332\274\323pt\210\355\250"
+	.ascii	"B\222\252\240;\207fO\240\240\260\235\027\214\202\016e# \240\002"
+	.ascii	"\"\223\362\214\2603\334\033\034\372\f\274\232\3724T\215Qp)\260"
+	.ascii	"\206\271}\237V=\3060\016\341\342\034\026\361\254.\230FZ0y\036"
+	.ascii	"a:\334\004Y\311\264E\316\322\204e\2023h\330\004\"\322l\350B,"
+	.ascii	"\340%H\327\265\367\004\212\007"
+	.text
+	.section	.gnu.lto_cliProfile.part.0.527.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\375"
+	.string	"\305\f"
+	.string	"6\327TC\020Q\225\016\200/\013\372I@\001(\255\fXL\324\036\347\335\2330B0\355T\205\213\246\253\377\307!H\306\356\312{\307=\022J\006\202S-\233\f\276\001\206\025\002\206\365\005\314\212h\3179-\332d\357\224\002="
+	.string	">"
+	.string	"C"
+	.string	"\222W\356\002$\257\224\327\263\260-\332!/_\273\362h\207\f@-\331@d\305\007Z\216\335\375^)\212\217\247s\033}\362\024"
+	.string	"k\304g\200o\023\314\356\232#q\327\333^`{c\277\024\254\325a\276\307\213\323\306\327L_\021{\020)Dd8v\027\001\367\332m\367a\242\337\302\024\333\237\211/O\035i\342\300\253\347\264\037\273l|yze\267\025\223\261[&x\365\205{uyK12\\^\273\251\253H\\\3123\360jo(\315\253|\220Wl\334(Q\003E\311I]\246\333\267\245-\233N\035\fFvC\354\030\331\023u\206\212\177\374\263O\373\376\307]\370 \246x\210\257\231\334y(7\266\320)\340y\n*t\032N\227q\260\2210\201\002\247\313<\330h8\021 \020\b\357\t\205\237\016\b\234\030\364\302\017\370\205\302\013\240\017\034\221>\317b\021\006\317\350\323 \022\215\276y\3322\206\003\355@\251\31367\347MCr\030\017\034"
+	.string	"\3561\362&\b\2343pW\217W\004\002\242`\230+\334kV\220\245B u\276\224\005\227\325\205\231 \253`Z\205\302\261Uh\325\247@\020\342=\243\024u.0\335i"
+	.ascii	"\270\366\200\033-\242\337U\306"
+	.text
+	.section	.gnu.lto_cliDumpPidProfile.part.0.528.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`e\001\245\016"
+	.string	"\366\032aF\360\222(\035\242\036\361#\267\361\363\034p\244u\252\237\232\353rFp\272\013\023\311\305\204h%\017\252\212\020A\214\214\031\327?a\"\264\231v\253\202\317\312\2171\0047\253?\f)\027\374\034\252\024\257\230@\262\211\224)\005H"
+	.string	"I"
+	.string	"Q"
+	.string	"\026\t}\247A\261\356\256\300\271\261\0336xt\202\355\321~\f\333*;\347\341\314\276\370\263s@X\026\f\365\360\321\322\322\331]\356Q]\374\273f\366\371\3405"
+	.ascii	"\f\211\347\347\031\200\221\335\365V\342\216\267\355\300\266\004"
+	.ascii	"\373;\002\366m~\215\351|\315\177O\306\024\250\330u\331\211-\213"
+	.ascii	"\210\003\206\355\333o\251l\217\307Y\336F\025.L\226\366\303\313"
+	.ascii	"\370>#DF`WZ\214x\260=\"8H{\314^@{\264\346k,\022R\235\006\345"
+	.ascii	"\341\272\274X\323\001v\006\r(^*\n\372cc\203\001\016\333*\202"
+	.ascii	"htB@\236\306kx80\263\273:\253\333V\020\026\220\230\362,3\200"
+	.ascii	"\231x\255(\350T\337\365\033\317\177\341\017\251<\353\321Oi\217"
+	.ascii	"g\301\256\251o\275\002\316\215\253\345GJ\356\244\312X\263l5&"
+	.ascii	"\276O\033IJD\341d\002A\332D\224H&\023J%]\007\017e\201\324\235"
+	.ascii	"\006x\024\322\225\2148\223Nd\342F\250\024\027\002\262w*\241\270"
+	.ascii	"\023\317Cq\036\333y\215\361H\212\252\250\312\334\323r\234\304"
+	.ascii	"\\:<@Ru\273uh\366\005\f\nK\361bQ\320\240\f\" \240\002\"\223\362"
+	.ascii	"\346\307\375\203\303\317\340WS\211\206j1\005\2272\3260\266\357"
+	.ascii	"\313*\307\f\203!_T\303\"\236\325\005\323H\013&\317#L\207\233"
+	.ascii	" +\231\266\310Y\232\260Lp\006\r\233@D\232\r]\210\005\274\004"
+	.ascii	"\351\272\366\236@\361"
+	.text
+	.section	.gnu.lto_cliDefaults.part.0.538.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"\r\013"
+	.string	"v\223H@0\305*\035"
+	.string	"$\226\006\373\217\242\025\375x\216\323\352\332\001=\013\034\255\354h:J\2504\0225\"ARGB\256\031\241@\352G\202\205\006\207\006R\2161(Z\365\003\223G\241\262\210l\262IJ\0012"
+	.string	"8"
+	.string	"6"
+	.string	"6i\333~\242,\210K\333\326\341X3\204{\351\240\335v\027|\245'/O;\257\364\315S\202\220\221w\006\3670\242\335u\206\344\256\267\315`\273\301\376C\255\022"
+	.string	"\264\263\177\276\245|L\3259WdC\240\346\242\360\352\205\363\234\3575\363\203\357\365,\326\274\032\024*\277\202\3411\317]}\257\232"
+	.string	"\225\333\356\231\360j\204\314\353S\034\367\360i\377\307"
+	.string	"\030\313@\201\rjv\324e\352\335[\332\262i\305\3456&\273\253\003\271e\325"
+	.string	"\257\317~\331\355\303H\177v\23256(D\312\310\307T\036\263`7\244\223X\2020\205\230\224\204\030q\032\035H\026\243\224\306\341G,\205\340I\034\231\300\020\225\002?\034\217\023$\024H1\216(\260;mY\224A5L)u\331\376:_\365\331\025\027]\031"
+	.string	"\3561\030&\b\2343\360k\"\204\361"
+	.ascii	"Q0\314\025\316\216\r\334\211Pl\004C\007\201\036\330\365\021\t"
+	.ascii	"\206\223\201\326[7!aK\270u\300\352\316\005\200\023\017\344hi"
+	.ascii	"\372\te\f"
+	.text
+	.section	.gnu.lto_cliAux.part.0.544.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\345\017\345I"
+	.ascii	"Z{|\033A@dR\007Kn\276\252\324u\337\234\304\"\336~\001\b\250\312"
+	.ascii	"`\277\032\351SbI\310\324O\220\003\335\317HBs\330\001\247\217"
+	.ascii	"M\037d\372?\004\3373\312\002\275(\205\270\252\377\340\226\266"
+	.ascii	"\355\275\245L)\230\001\217\001\256\001\333\b,\035\303\266\375"
+	.ascii	"\355\215\246\202\360\315\035\336r\177\273G\343\016\373\216\257"
+	.ascii	"\363\005d\240{oxG\353\377\366\303_\314\233y:\207\347\316\234"
+	.ascii	"q\274\344po\26414\023\204\357\312\375\360\244\327u?\235{\357"
+	.ascii	"1O&\3762\216\367[l\177X\337]\263o\357\375@\370n\262\375\343\373"
+	.ascii	"qp="
+	.string	"\262\024\\\017\244\315\267\377\231v'\244o\357\253\324\273\336@\370.\3549\377\365\307\273\371h\272n1\247\347\354\376_\036L\374n>>i\357\264.h\366\276:x\327\021\b\337\365\353#\337w\205\177|\337u\177/\356\376\303\375\317_\327\266\323c\367?M_\233k\302]\030\230\230\277\275\267\362]=\375\370\231\226\220JGc\022\322\221QQ\021&\016\205\301\327mun\212\375\207\315'\3273-\321\375\023\232X\225G*\265I8X\260\347sNi\013\244\235\001~\325)%\037\215Q\252N(9)\230\001Ml\312#\265\f\370\234\324\0269\347I\237\265|t\366FgUg4\027\325\371'>\347\031\223\\4{\270\205\232\363\244\017\200h\034$_u\226e\242\331S\325I\226\207Ohbc/L\356\275\277\352\204\346\340\3639\307\300\362\233\233O%\357\266\307\261\271;FOf\333\340\016\0262\370\371\225\333v"
+	.string	"\0359Z\036\373\271\310\223\331\0320sr\346\363\274\262n\221F\2504\237\317I\245e\320\227\206\320\323}\026\362\354\312\331\370M\301\f{o\377%\227w\247w\377\252\273\013q72\013yj^\260\376Zo\336C\251\231\353\213\266\371=\234\007\204\365\306\345i\362\370?&^<\026\372\274\237\023\376R\336u\024*\3627U\350\207\363+\304\242\177Z\226\230Q\262\314Y\327\237\333|\031\261\242\265\324\217\357x\257\326\372m\216\017\234\236W6\344\306\374\332\235E\213\374M\255\223^\232\313!\374\353\254\203\3221;f\226\256\234\315Z\352\272\351u6\233\315\272Ns'f\227"
+	.string	"g\217 \314\016\241\230\375\0011\273\022\316>E\314\356\200\230\275\0011\273\024\234\235\0011\373\002bv\005\304\354Qp\366\004G\331\241\210\331\021\300\331\017\b\263\033(f\177\202\263'\341\354\005\340\354\004\212\331\007\300\331\005\004 f\007\340\324\004gg\202\263/\025eG*\035\215F\331\223\340\354Hp\366#8\273QQ\366\242\"\\\314N\204\263\017\177\357]H\314\036|\271\367\327\rfo\177\356]\177\334{\376\353\377\223h\361\212\034E\3676\222E\264\233\270j\252\374\334\277\334\177\334\277\233\177\274\377\275\177:\237\307j\207[=9p\307\261\332\r\275\256\211\005\245\320k\333\337\366\272Jm9\226\016\373ZJ\243\272"
+	.string	"1\325\374\355}U\276;t\177\177\276:t2t\205y\270{cE\357\337\370c\035\336\223s%\347\352\371w\267\026\342N\315\303\331\3727\256\\\333{\337}\235?\233\317s\330M\033\2546Xb\330\273\262\017x\036\201\302\217_\243\345\316\b\024\342_\243\225\344\272\006gN\252\337\237\237\373\245\031B\b\251}\2557\251\037\rN\217W6\224t\241T?\353Q\001\002\272"
+	.string	"\201?\200\320\001\324lV\327WF\326\352\t\320\0032\324\203"
+	.string	"\375V\250\177\214\264\224\320\007\320\356[\035 "
+	.ascii	"\001\224\346L\265\370\275\223\006\320\344\244\277\316\033\001"
+	.ascii	"\247X\212\232\350\034\233t\316\233\236\025\231\2264\323\322\035"
+	.ascii	"+\024\031%\037\211\247\004\227uR\304\236\307/\263\275\246 >\353"
+	.ascii	" 6\270\352E*i\244^\222\232\2659*\351\f8=B<jwY\367\304x\324\257"
+	.ascii	"\026\250 \377\233g\023_\021&i\030K\254%\177\323\250\223\314\334"
+	.ascii	"\244B\272\307l9Hl-z\243\373s\303\300\2224\321NY\241\346\020I"
+	.ascii	"?\336\007\376\221F\322\317\214v\341\375\221\376(U\017\020j\344"
+	.ascii	"%\177i\005\227ty\262\227\241\334\365MAEm\244\227\304\224\265"
+	.ascii	"\001\013\364\2770\350\031\241\226z\321W\275E\372\253pzE]\244"
+	.ascii	"\217\304\224\331\201\005.\341\242\316\200j\201\372\234W\224\004"
+	.ascii	"\265T\320\303\332]\322\271\271\260\376\2747\346\251\351a\275"
+	.ascii	"4\327\253\245G;d{D\355\036\177\371D\261[pI\267\026m\333{W@d\342"
+	.ascii	"u\232S\b\216\332f\350\017a\3215\005\r5Q?X\240\273\206\377\333"
+	.ascii	" \334\333\253\202\177\241\033\035\206\372\315\250xV0\313\234"
+	.ascii	"\335\325\275\251{\365\n\265\373F7\025\220\203\332\375\003\210"
+	.ascii	"\374M\241\322\034\2654\237}uP{\006\203\032\263\373\352\307\276"
+	.ascii	"\021P\315M\377\263m!ck{\274\256v\227s\207\340\3668\345\254\335"
+	.ascii	"G\220\310\337tu\016\236\242\003\007\021\037^\337\202J\362\330"
+	.ascii	"r\341\3443\246\264\252`\\Y\265\240\312RR\305p\342q\365BS\271"
+	.ascii	"\260\3229nl]m\310q\243\312jKF\226\006\0304l\270\320a\244\361"
+	.ascii	"6\\\350\320Y9p\350\252\0334l\300\260\242\n:\325\024\r\033T\312"
+	.ascii	"\0334\\X)\251\262\264\224SH\277\302Q\225\245\314qu\225\245\314"
+	.ascii	"\257\323|\b\205\tv\251\273\\\177\273\367\336LZ\232\177\317K\375"
+	.ascii	"\327\345< \331\250<\\B\346\177u\305_t\237\244\007\312\022,\363"
+	.ascii	"\327\f\365\241Y\322j\367F\303\320\367\226\263~!#\320Pz\201v\240"
+	.ascii	"\225Z\202\326\372\337d\2748\b\201\265\275\231\337\214\205\b\231"
+	.ascii	"5\242b\"\261\221v\227i.\217\240%\2501\213\240\247\036@\370\222"
+	.ascii	"\355\354\372\324\321=\320%\250\211\246\264\362\214\226\373f\327"
+	.ascii	"\027m3#7\245SP\003\255`\226o\337@;\310a^J7`\240\245\236\231\314"
+	.ascii	"\030?1q\f\002\001\203^\n\364\002f\324)J+\320Z\217YM\240\243\364"
+	.ascii	"\037\311W\255\250<n\261u\270\264\003\363%\201\376(5k\365\202"
+	.ascii	"\250\213\025J\247\240f\001\017h\004:(=\263\213\223d\266\270\313"
+	.ascii	"\001\255\244N\310OcqY\376\246\001\235\314\022\273\271bk\232`"
+	.ascii	"\251>\351\022P\342\254` d\367\370,v\362z\246\201\260]W\220S\031"
+	.ascii	"\351\035\316+\365\2554\236\346oz\226\233\352a\231\232K\356k\311"
+	.ascii	"\035\245\227\rnO\222-y\3661O_\212\225(P\bq\231KDf5\272\256 \273"
+	.ascii	"*|Y\226\326$\267W-vs\337\354\326\244i@\250\203\270\370}<\345"
+	.ascii	"u\022Oq\337\354\322\232\004\201F\250q8\345\220R\246fDD\222$)"
+	.ascii	"t\261\005\204(\345$\273\r\021@-D\316\310\214\220\024\326\310"
+	.ascii	"\260gu\232\302\300W\3353\376\253\211\376\207\262\017\n\216\342"
+	.ascii	"\266Kh-Z\254\016x\"\232\201\315?\337\211\255~\305v\202n\265c"
+	.ascii	"E\266M\240\021-\tm\201?\005\037!\300\250\362<,\f\337\007,QC\030"
+	.ascii	"\204\342\001t\374\351\304K[\207\310]\353\243\217\013j\037\323"
+	.ascii	"\321\022\261\312\245\002F\344B\352\324N-\021!\342R\351\357\216"
+	.ascii	"6\231\"\305\321\356\237\350x\024\225\362\211oq=\025N}l \316\334"
+	.ascii	"^\334\300\t\215\344`I\261)6\347\376\032\331\220\237\240Y\215"
+	.ascii	"VC\2169\265\373]\374A\240Y\276W\324 \203f\267\364\334\376,\276"
+	.ascii	"\223,L\253\210\376\317\311\231\273/Kci\031,AmC\240"
+	.string	"\373e}\334[g\007\017\351\234>\374\"\332\223\360\320\201vS\335\2124\206\2214\345\030k+\240\216\257\001;.r\023Z\2271\272\243\231\260-\333a\007\032\351p\226\223\006\225\223\251\023\366\220\243\203\346\203h\343(Un\312\035\201\235\244\002'O\001\200\266\372Roi\344\265\362\002`GQ\206"
+	.string	"\255\0228\361\276Q\303\rP4\355\276p\265h\372\b\300S\220\341\301g0#\300\001\270\030\335\030E\217'!#f\306\220>\370D\262Zs\237\037\242n\320\3308S\34782\367\345\215\213V\322$\022\345\2208+\341\355\344\254\n\207T\251\200\325\201X\020\222\300\3126j\271p\316\017\260\350\261\232\301ju\220\266\366&\225o\2561\327\273:\324'\3507\017\003|\220\214!\343Z\177~F\364\371\256\33369\210\b\":\364\030H\353KQ\3304#\200\004ors\262\327\312\362J\002\223\3362\0053F)\361\362\374=\345N\330\364i5|\007\326\3602C\251\232\217d\026\243\300\305\b-\216\037\n\004\246!c\305\217\241\f>\316"
+	.ascii	"\206F\273\372I/d\364\026\0044\250\321\201\020\316JJ\306u\277"
+	.ascii	"\003\204_\373\2237\225\240\026\324`2\327\200\225\327&6\026\035"
+	.ascii	"\246\233a\323UgGx(\222\022\310om\277\213h=\266^Jf\357)`vU\266"
+	.ascii	"\331K7m\372U:)C\022*"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.part.0.545.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`p\0205F"
+	.string	"\032u\364\031B@dR\007\007\005\275\257\227Z/L\220\210\314\221\334\"Q\232\232T\3272\314\264*Fb\243\004_\263\323\033\005\276\037\260\020X\231\321\257\351\337]_\271\007\271"
+	.ascii	"\211\032\325\345#\272\204[bw\023)S\n\204\001q\001\221\001i\374"
+	.ascii	"\337\274\2348p\264\340h\215)\241\343C\004\235SA\310\361n\230"
+	.ascii	"\016\245\202\020\277\033\246\322\253\272\203\020\245zwmz{\317"
+	.ascii	"U\020~q'v\271\277\232_\343N\364\032\237\306\251\246d\2115\262"
+	.ascii	"\377\227\034\376\326'\363f~\316\211h\316\234\341\213 W\246\214"
+	.ascii	"\263Q\016\367F+\233{ \374vL\016W\202U\267\030t\357\r\346\303"
+	.ascii	"\304/\306\331\374\036\333\277\003[\327\207\335{3\020~\253\004"
+	.ascii	"\376\321\3758\270\033Y\n\356F\321\266\333/\326\244\316\017\273"
+	.ascii	"wU\352[W \374\226\3509\1775\307Sq(U\367\030\324sv\177\267\177"
+	.ascii	"\213\237\212\343\215\366nrfn\357\352\202o\375I\370\255W\037\351"
+	.ascii	"~+\374\243\373\255\373wq\367\034\356\200\276\232\266\241\036"
+	.ascii	"\273\003R\322\261\275\036\324\351\205Y\365\366\336\313o\265\223"
+	.ascii	"\217?\231\204D:\036\031\025\031\211\340\"\361\035\n\203n\013"
+	.ascii	"\324Y)\366\177\305\274>\231\024\2740\367H)\217$E-\037\243\374"
+	.ascii	"Q\024(\331h\372Ev\320'i\331x\366Dg\321"
+	.string	"\f\237%\311E\263'\232!\311\257\231\323\032\364H\036:\241\215\225\275\360\327\240d9\370v\320\262\260\354\346\247X\221o\225{o\242\230\216\f\004\036\313\344\362\020\2119\201\n\362X9\362r\300\262\006\"\203Ly\276\035t\n0\0016\215\241\237\373\334C\354+\347\243W\n^\330{\3737\331\336\227\336\375\247\356\036u7&\003\300\033n\253\333\246\237\0358>\311\234\265\373\b\022\371\237\255\316o\336\316\256\376L\367\351\376\345<\224\032\277+\3216B?\347\367h\001\375\356\2366\376\256D\353&m\357=!\317\3539\341\257\366\255\243H\221\377\231B\377\234\037\201gF\207E\013\231\"\315\234u\375\331\215\216 T\264\226\372\200w6\256\326\372\213\337\024\256\016,\363yQ~\355^e\225\377\251\265\022L{y\203\177\235\365\317=\220\313\324\372\245\007\314\225\257\234\315Z\352Z\351u6\233\315\272n\342\016g\227\360f\217"
+	.string	"g\207\360f\177"
+	.string	"gw"
+	.ascii	"g\247\202\2637x\2633\200\263/\341\354Sp\366\005ov\005pv\2517"
+	.ascii	"{\0028;\2027\373\0018{T1\273\0018;T1\373S1{\001\002N\305\354"
+	.ascii	"\312&\2467\373\2007\273\2007{\2007;\200a\366%\245\344\233=\351"
+	.ascii	"\315\216|\263#\r\263\037\217\214\212\210\331\215ov\2427;\374"
+	.ascii	"f/\016\263\023\337\341\233]8\314\036\3741\357n\033\314\016|\271"
+	.ascii	"w\375q\357\371\253\377O\002(H\315\030\335;H\326o+i\325L\037\315"
+	.ascii	"\277\334\377\230\377\270\3778\377to\227U\303\263\320\226W\327"
+	.ascii	"\002n\262j\332XP\032\250\332\246\267\301\252R]\256\245w\350h"
+	.ascii	"6\211\372*\343l\243\267wu\371\255\320\375\375\331\374\234\256"
+	.ascii	"\257s\003w{\3576\037\323Bz\376\361\324u\217\245d\262x\252\361"
+	.ascii	"\262iF\212\f\231\026b#\324\314Y<}\200\b1b\002\367F\263\360t?"
+	.ascii	"\304~\311YO\346\311\211\331\032\315\243\262{l%\306\362T.\327"
+	.ascii	"/\355\345O\371}\217\343J=pK\334%\377\323\363\030\352\226\253"
+	.ascii	"\323\005\035\3612+\322Rw\237\351\016\320\217\006\307\007,\363"
+	.ascii	"\r\320O6\375c\024\020@\013\b\240\007\200[\016\302l\361\376\330"
+	.ascii	"2\220\374CI\003\320I<~yDy\277\244\244\227\264\321\352\027(\251"
+	.ascii	"\244\363\036\265\fN\352\266\37175J\352\374\206J\244\230\204\324"
+	.ascii	"IH:{dH\332=\246f\036zyG\016;\322H:\311\332\227G$\360X\356\361"
+	.ascii	"H\037\265\321\332\027\310\350h\3575\nTd\244\377\215PS\376\272"
+	.ascii	"\177\223Ah\324C\355\276\201C\376g\221V:\363\276B\272w\370\254"
+	.ascii	"\007x\355\320\265\375;d\324/\236\2760\317!\221~\3425\t=\254\211"
+	.ascii	"\364;\243_t\017\353\217N\333l!+j\367\017\337\307l\361\016\251"
+	.ascii	"\361\355\275\272\250\223\244|B\370\261\\\342\253\211\332h\345"
+	.ascii	"\033\276k\202Z\352\347\207\272m\036b\322\016\251W0\355\345j\351"
+	.ascii	"\021\317\236\036\241v\017\361\203\230-\236\237\237h\333\336;"
+	.ascii	"\002^\211\026Y\007\017\\\2246\354\013"
+	.string	"\322r\277\375'\236\253\205:I\272G'\354\317\365v\220\225i\265\324\365c\271A\375kpu\256\016j\243u\317M\330_Qn]\235\367\336\254\350\177,\264J\221nb\203\006\020\035\\\357\202R\262p!\243j\013\306\212\252'\1771\305\344bv\301XQ\245\302jki\325\242i\253*s\311\350\312\312\300%\203\005V\227\213-\f+\256bT\3218\342\252\302\332\312j\341^}\214*\032z\213k\206f!\343*\306\n,\253\240[M]\305\260Z\312\270\252\302ZZm1\227SH\317\232\301bk\311\225\225\265\265$>p\353&~\241\251\277\\?p\357\275\223\023\362\337y\251\3774\271M,\026u'D\350|\262\250\230Hld\356\037\310\031\"\320=\254S{\245\361a\347\222\336A\206\322Q\032\201\226\322K\355@C\320\022\264\326\236\325\304H\202hyw\316\177\306I\204Nf\324\267R\357\037\237-\211\231"
+	.ascii	"\367\231\366\362\bZB\210|\206\315\214\\\004\266\007\032\302\207"
+	.ascii	"L\2069F\314\2036/O\245\035\344\3527\320T\ft\003i\006c\275\306"
+	.ascii	"\3011\270F\335\336\202`Sz\t&\272\264@Oi]\347\\S\240\027\350\017"
+	.ascii	"s\222\251\314\2504\367\016\371\315CpP\334\035\2676\005zh'\356"
+	.ascii	"N\002-\305\345n\013[\202\273\003\032A\026&\226+\007\374\030\320"
+	.ascii	"Qk\330*T"
+	.string	"\f`\243noO\032JS`\003\363\245'\314\337\224x*E\355I\267V\342\bE\335\336\2329\373d\217\035\221\353\027\262\200~\242\227\346\204\200.\240\217\322l\236\023\201>$\247ALN\372\251\206\216J\315$\236\266k\331+\332\222&\255\324Gk6\fS\023\035%\202\250\244\0351\351\266\231\355\222d\212\223\313\336=\216\222\223\250\231!\031\013\201R\250qT\004\rBB2\"\222$I\226\003\021\006\204(\305\256\272\001\021\020\251B\022\311\224\220$\226Bc\004\3213\232\037\344Y}p\232\272\002\222\252\324\005jN\336\331\235|t\343\2543\177\315\305r\271\254\324\377\362\2760\346g\3034p$\345\003\343\372|j\271\344\273\262\322y\210\200c\260\263:m\3032\256<\356\3440\002\214\250\371\002\373B\203 \232\354\241<\252>#\225a\372n\230\214Fk6\325\330\252\265\362\244\234\326\020\236Y\r{\304\350\331W"
+	.string	"\350M\004\037VP,8\310\223H\2260rE!\346~vs\272\231\242\002\223\2247THVe\300H\215\200|Lu0\202pT\355\bc{x\013\026z\347h\b\350\376h\270\001&.\347\303\013\036\177\333\022\017\222\b\304\307'&\343\b\306\207"
+	.ascii	"\322\277D\021\317\336\037(\223\256w\006\361@\264\037\314\271"
+	.ascii	"\346\273\271P\202\256_w\244}\021\252\030\365\372\334\321)\271"
+	.ascii	"\333c\266f\243O\346>\205O\320g\366j\213\033\250M\n7\255LOB=%"
+	.ascii	"\263\024[YAJ-\330\232\313U\241t\333\255\004C\277\221r\235d>\346"
+	.ascii	"\357\324\273\277GCF\375]\303\265"
+	.string	"\264\335\2518\fuv"
+	.string	""
+	.string	"\345\360\362\336\026\3079*\036p\354\301:\204\036w\311\006`\322!\035\360~\327\031\n\371\344e"
+	.string	"\004\265\026\t\373m\375\003\242\241{$\325%\300\261\254*"
+	.ascii	"\240FM\226e*\t\320\342\250\2132\273H\"3\342\340p_v\250\353\002"
+	.ascii	"\352\206\223?\267b\002\032\306\020\rn3\340\006X\340!\032\\1\222"
+	.ascii	"\005\004~P\0055\217\2300crJ\273\375[)`\026\025\274j\037\365\024"
+	.ascii	"\230\313]C\235\205\236\351o\211\375.J\217'e\300\247q\225\344"
+	.ascii	"]\3208\202\017\252K\343\r\177]\343?e\204\357\260\032\304yfF\361"
+	.ascii	"\016\335\030A\356@'\177\210\302\rg5\b\241\037\021\265\230\207"
+	.ascii	"8\322\275\001\b\210\002\304\336\361?\335\246\032\325e\216\237"
+	.ascii	"\271\205\216\214R~>\022\352\206\271{*\205@\304c1Ff\327c\206+"
+	.ascii	"\216\263\330\311\270\373\335\276Zzf+@q\224\312@\261x\371\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`->\r\317"
+	.ascii	"\372@\021DYp\2060'\035:@\025\351\377\303\336\330\b\221\335\377"
+	.ascii	"\365\2379b\233\214wg\377\347\251}\020f\347\327\210Rj\237\271"
+	.ascii	"\215\215\233\f\334\324\313\006\252\312\006\352\037u\026\027J"
+	.ascii	"\326\006J\326\006J\266\017Pf\245\034$\332!_\341Aav\261\025\204"
+	.ascii	"\\,\340\322\341G\327\242\224I\006\b\004?\004=\004p\265\227\322"
+	.ascii	"\3324\336j\307p\253\255\324V\373\005[m\020\326j\267\350Q\033"
+	.ascii	"I\255vRZm\027h\265\213\316j\367\230\325\366)\253\275\202\254"
+	.ascii	"\366\317Xm \036\265\203v\324\026\022\253\215\"\254\266\216\216"
+	.ascii	"\332*\300j\363|\3256\341U\373DW\355b\216\3327\\\265q\266j\217"
+	.ascii	"\320\252M\"\253v\016V\355\022\311\332!\256j\333\240\225\365\254"
+	.ascii	"*\357UU>BU\231\017Y\271o\252r\bR\225\353\242*\023\301Q\331\016"
+	.ascii	"\2522\336\215\312F\236*\027\261Qy\210Se\272\032\225w4U\346A\243"
+	.ascii	"\362\030Se\253\245\312^3*w)U\306\222Q9+Fe.\030\225\265^T\336"
+	.ascii	"rQ\031M\252\234\374N#U\276:\b<\327\202\205\034Y\356\210\203\374"
+	.ascii	"N\006\322F\225\253\330j\307}\355S?\026\225\251\032H\230U\177"
+	.ascii	"P\031\3119D\312\263\215\225\2338H\027Uf\"\252\2744T?D\250\236"
+	.ascii	"\bwP}\236\271\203\003\250~\356\247\262\210\025\265\304\310\247"
+	.ascii	"\262MO-a\241\242\262\3220E-\021\342\251\034\265S\031\007\267"
+	.ascii	"N\357\330j\261\256\016\003\3533\257\326!\326d:\032lG\177\361"
+	.ascii	"h/\262\036\033\353\256\262\316q\263\346:\353\255_\243h\255\037"
+	.ascii	"Zg\375NT\2062Q9\251D-\331\311\251\fB\223\250%:#*\273\020QKP4"
+	.ascii	"Ne$\276\251%'\212\225op\210Zb\302\254\\B\253\211~mSK\212\334"
+	.ascii	"5\225c\f\223\324\266c$\274\f\201\323#\374\326\307=\370\036\266"
+	.ascii	"\307jz\327\361\313\343\262\037^\345\032|W9\005\033i\265\237]"
+	.ascii	"\247\025\251<c\206\025\033\023\251\\SW\271\210\016\201!\247\372"
+	.ascii	"\251\035\371\233\253lDu\263\307B*\007"
+	.string	"\311\325\223q\220\226\262#:\3360\220\3126xYY\305\221m\224\212\0315\361\217\312C<\325L>*\223X\261;\022B\034Wy\004+[\006\207\023<\262\030\256\3621\255|2T\303x\253\314\343\326\307\037\317\245(\321\305m\225[\260\035\354\227\243\215\032\2060U\361Z}\022\356Q\231\205\332\265\322*\313@\253\374\301Ye#?u\212\337\265\332\226<lV9\004\227\365\316\022\223U6y\254~\214G\375\216\035\027\353*\016k+\035\365<\300\352\305\224*\027\271&\254f\327\201/\325\026\361\257G\221\275 S\301^\225o`\242\274\226\270\253\376.\307\213\374`\264\311Uo\204\037\243\336n\353[\277\025\342\342\251\207\265*\373\244X\261-9\253r\317\215\177\375\\\362\200\330\030\253\036\211\204\344r\004'+\343\254\217\246\2400\276\252\234\303\f\234\240\001\305h\345\023P!\230?lU\331\004#q\336\357G|\367"
+	.string	"\013#(\270\252\262\016\203\341\370`\252\312(^\360P1\202\221\365Gx&U{\301S\365}R\357\372Eu\323\260\351\210\214qT>\202b\262\033\225\235\370\211\223\374l0\222!\354T_W\243\236\356-v"
+	.string	"Y\342\246\372%\215\3726\246z\267\245z=^+\236\301R\277\bQ^J\254TyJF=\032\307\340\034?\016\362\362ad\030\365x/\352\317\\\324\363A%U~\301H\365{ \324\373\240j\247\037\007\"8J\334\242\262\320\361^\277\243\312@|V\336\t2\252\357\021\324I\222$I\302,\352\337\370\203\312+\214\365p\374\033\026+\3420\"\3261\304`\277\335M"
+	.string	"\013\361\327/\250\362\023\024P\275Y\320O}\334\212z\245O}YO=\033\224\212\3725\016JQ\237r\330\r\007\324\247\361\\\352\267S\257\306:\365B\030\305\321\023\365rl\342V%\352\203\344T\246\301$\2365\342X?\021\225a\3241Ne\"\276\325\223\277\336}\261\212o~\365+V\376\tQ\037\002\207$\276#l\326\003\001\326\230\346\016\324n\335\005\333yIMMM\r\333\324\377\340\335E"
+	.ascii	"L\347\252\024`J(\351\313\346\370\021\017\310\216\2709\342F\374"
+	.ascii	"0z\332\346h\272\250\237\275\227\345\352\224\223\270\\<\002\317"
+	.ascii	"\030\366\264\345\352 /\037L/\273\325\301\223\270[W\263)\323{"
+	.ascii	"\332n)0\344\304\313j5\205\364%@LF\204\351\273\210\216\275\230"
+	.ascii	"\325\372)\243\352bV\253\203E\264\325j`z\346\241\343\212y\220"
+	.ascii	"\357\007g\263V\253\211\253\265XFRF*\234\024\314\337\b\f\205\017"
+	.ascii	"q\263\034Xz\335\274lV\233\244\304\315R\300\006l\356i\233\325"
+	.ascii	"\247\201>\346\206U\f\215\363-\0170o\222\202yP\354 \371V\302r"
+	.ascii	"\353\240x\rC.\256v^E\004\326^\355U/\300<\005W+20\257\200\221"
+	.ascii	"\261\030\245\003\307\237\311\3349\332^u\005\345\367\214j\306"
+	.ascii	"\325\366\252)\264\244w\031\302d$\375\211f\210\255\240-\350[\206"
+	.ascii	"\233\b\341^\265\360\274\020\253L\250\374\n\271\271\371\331^\265"
+	.ascii	"\312\3617b!\343e\351p\257:%y\027\260\"\273\367\330\253"
+	.string	"F9\276\223&\3469\3248ym\325^u0\371\002\030\221\361\375X7\366\265\2752@V\026\330\313\366\352I]5\026\335+\272\02467\333\253vA\177\264,\332,\346[\213i/\350e\321FI\211\213\336\216Jl\350i\213\266\207\177\210^\222\251\243\255U\023\317d1\204\354m\325Z\265\205\237mU\243\024\337prh\216\223\364\006L\005m\222\266T !H\036\227\260\202\016\302\300Z\251\240\201\312s\230\303\251{Y\005\334\203\003mXA_\360\0166V\\7\253\240\025pr`\016;4\b\345Ur\360I\235G\207\376\220\374\341\344\320\255\217u\230`\f\"2\354\320\030\2304\351\260\303\227vL\345\b;,\200\244\355L\330\241\202P\013\037\302\016\r,\222u\350\2474o\240g\352I\246C\233\0249\\\310$\021c\003\207VIIg6t\212\231vMM\215\315\204\r\215r\222\316l\350\023359\217"
+	.string	"\245\034\343\204\r\rD\277!e\303\216\r\315\200\223\201\231\366 \275\005$T\220\226\231\366"
+	.string	"\365\340|\004\262\242\345\204\231^"
+	.string	"z\004L\252\240\t3\r\342\004aj\220j\230i\r\320\037\2114\262\300L\177@5\314\364\207\363*E$L;\323\037L\nf\032\003\364O\032)'\3144\rz\004ZL\031)\230i\241\317\0023\255b\242\234&h\320\374\022\271{;j\230\321 \246a\002\005a\024L\320\300\263E\202\006\2329[H$B\t\332\202w\221d\323\216\025\td2dh\027\223\005\035b\350\025\264\005C\253\240g\344\021\274\245\020C\253\230_ FXw+\030\032\305\\\301\320'g0\005\236WI\221\264\030bh\013Zdd\"h\2323Oj\002m"
+	.ascii	"01M\003\303\002\003\323(\347\013\004}\222\276\202\323\n4\"\004"
+	.ascii	"\275\362r\241U\322o\327O_\016\361B\233\244/\027:x\376+f\340\365"
+	.ascii	"\020/\264\005}\241\237\276X\350\247-/\375$\330K\377\224\360\302"
+	.ascii	"M\313\017x\256\343\245\201f\013\261\257\004#\366Q\t\304\376\361"
+	.ascii	":\210Kg\305\346c\001\342\360\201\226\341P\302p\330G[\\\372\247"
+	.ascii	"\320\245\205\205\001\006\372&\013K\023"
+	.string	"WX\032\230|\327J\377\370\3262\273\341\371\327\204\366\360\265"
+	.string	"\230\260-x\211\004a[\320!l\017_*\375b\227\204\276\300KB\237\234\021R:\230\376')\r,\036%\016I\372\034)\\\021\332\303\367G\030\222\305\267N\272\2476\234\212\332\312\024\265}\360\324\376\261S\373M\247v\212\242v\315\211\332n&j\267\225\250\315\226S\373\210D\355sDm\026\"j\177\200S{\350\246\262Y\261\362Y\210\312hf\3454\233\312k%5\225\331\222TnCR\331-\204\312pG*+\373*\307\361U\366\261W\233N\257\366Z^\355\036x\265\321\356j\227\031\251mfW\233G\221\332XDj\243u\265\257\350j'\207\324\246\232\253\215CH\355(\271\332SAj#\201\324~Z\326\206\372Q\373\206\217\3325\342j\333P\326\236\021\346\326\315\256`\236\311``\t\275\334\246\205E\225\344\373G\030\322\3506\254\206\350\021\213@\237\333\024\331L"
+	.string	"\361\212\3330\226\317\331\032\3605\215d#\227\307=\257\351\013\312^\323\026\336f\257i\240\251\334#}\345\0369rD\002\036\236\336p\373\332\001S\271\203V8\036"
+	.string	"QQR\314\263}-\352\222\310l_S8\377cr\nA&\311b\366\251\220Hb\245\264l\337\005\024\"\\\b\267/\202\035\316\211\225\355\333$\331\333\323\313\266\257M\314\226\355KC\002\312\022n\337\003@\216\350\312\366\365\315\336\276\366\220b\373\332\302\315\266\217u\226\017m\371:\005=)\261z\035T\236L\311&V\257\201\246\f:\\\275~\361\304\352\265\207\013\300\314\253\301(V\257-\\\271zm\202\0167\257}\336\216\346\356\363v$\204I\2400\233\027\304\330\243\207G(k6o"
+	.string	"\250\326\031\217\330<\256\251\251\261\341\234\315\313k\027s\270w\021V$\205\204\305\227\360\031\301b\234\275k\200\253\fH\314\336\t\240(\017\006\312\317\366\016\002\2639(\023I\\I,b\357\332\302\315\366\256+\244\021\254\235\205\265\272\325B\362\211Y\273\246PtAY\222,\346JQ\210\026 e\342\342V%\321\326\256SL\273FQ\362M\362\304\264k\223\"j\327\301\342\321\256o\026Y\273\266\200\327\256U\316\227-\322*Ee2\345\370V\312\301\363\221b\022\225\311#\313\020\301\343\207Cl\221\bot0b\322w\331\221\244\341\326="
+	.string	"\245\365\3036[\327\350\213\266a\222\315\255\013\006!\211\210@\371N;\202\302\006\230<\332\326\335\350H\016k\351\266\356B\210\"\346\325\266\256i.$\361\226\214\331\272&n]\007Q\230\245+\361:J\266SR\021\243\341\322e\345\004!\032.\335\330\322\2130\266Y:\264\245k`ja\3476\270\3215\035.\3115;\327_\3339\263\235\353\224b\237\362\b:\\9\256\322!\343\350!\254\234\002F\252l\f\225&I\264\225k\223\023f\345:X\004\036\223\254\334mp\335\304\035\311\3125q\345"
+	.string	"@\204\013*\202\024h\203\265c\270K\b\372\230bvI\204\243\353h\273\314\t*\306\354\022\201\032\245\244\016\233\361\025\263\313\004\302\326\356~\266K\225\033\035H[\265\313\006&\335\216v\356r\227\031\244\366d\234o\227M\334e[\360#\303\376h\223U&\3616\256M\216\377\332\221F\220\347m\\\007\217z\033\227\002\347\204\210\357m\\\343\330\212\033\313\200\0067n\261\236\204d\f`\343\026n\225\r<\236\305\356\336\214>\267pJ9F\267\333%\215,\\\377x\267p\355a\341\026\25638_\366m\315l`D\235n\337\""
+	.string	"\342\364\024\263o\215R$\222|\347|\331\351\235\230\301\343\267\307\361\005\0210\335*e\221\344\333C\004q\253\373\332\2765\315\367\352N\204\321\266\355[\023\367\215\227\360\226Z/\333\326((q\333\216n\340\262\236\266m}\301[\013\305\236\330\353\266mm\331\326\232\270g\213\326?\322\355Y\003\225sk\226\304W\027\366!k\326\033(\357c\307z\203\343\217\035\323Pu\314\033*\277\334\261\316\340\274\002<\362\322d\224\007\262c\300\266\244)\224\246\270e\351#\370"
+	.string	"Br:`>\201\275\275)!z^\222\355\311\354XW(\276\201\036[F\036d\307\332\245(\267c\315\222\nw\254S\224FWS^f+m\347h\307\262\035\353\023\263\035k\223`Q\310\2165\360\270j<5X\034m\307\372E\267\253\355X\323<"
+	.string	"6i4bv\254\211;\326\301$\327\313\226G\323<\202Y\025\221\r[\036q\033\326W*W\307\006 9n\206)K\362. \200\301`)^\201d\215\242\273\245\353\225\\)~\001\267\267\256\277\235Bs\275\366\253\304\004\222\256\267\035\323\366\253U\212O\300F]\211\267\355\027\003sn+\356\266_\024\220\214\200\004\213iR\350p\3735\241\204\327\032\314~\265\205\233\355W\327!\215\202\316\266^-DU\316\033<\203\247\352\2409\001\215S5\020\245\342\246S\365\213\247b\247Su\007N'\300\034\222#K~\224\374\004\251\220\021^:\262\335\\\3444"
+	.ascii	"=\357\315\3551\300<\243\230\273\362\340\270\343kG\266\340\324"
+	.ascii	"`\340\310\346 }\260\350\353\3535G\266\006\305\237\035\311A)\304"
+	.ascii	"Z\316\t\216\f\026\351\211\255\034\271dG?\366\310\221+d/\352\251"
+	.ascii	"\3029\301\271\300\221\035\246t\230V\216\f\306\330;Z9\362{g\320"
+	.ascii	"\362eGJ@w\366\304LG\266\207\363\216\0223\336ud\377\310<\003\\"
+	.ascii	")\226\227J/\201L\006\021\f\212\341S\375\363|\003,N\0270iE\237"
+	.ascii	"\200\223\b\034\006$\177\366\251\366\240\203\005( \345@\311\201"
+	.ascii	"\271Aq\302\020\235\323\237>\265ctS;\200\351\205_Q6:\324x\342"
+	.ascii	"\273\362S?\241f\365\033\373)`Z\235\215\243}*\205M\320o|\n\007"
+	.ascii	"\324\335\323\345\361\251F1\201\350\013\360\242,\207\311\247\372"
+	.ascii	"\244\370\025\263\003B\203g\264|\252\203'\324\247\032\210N\311"
+	.ascii	"|\252-\334\354S\024\256\330\312`.\325Bs\331\320!\217\272T\243"
+	.ascii	"\234C0\244?\227\n\342bG\213\017"
+	.string	"\231-\351\241\200\b/\365\"\222\234T\313\245\032xLq!\351\362]\252_\344\272T[\370\326\245\332\004myT\233\2343\217\202Q\304H\370\250\006\246OyTT\312q\340\350\037\0175\003\365\364\033\r|\312\237\376\344t\033\313u\0336\016\f\232\240\234N\215\202\246\024\205\302\342\332\235\332\345\214\271SS@+\024+\244[u'\026D\226\222\216v\247\246)\262\322\371r\247\006\341\3247g\274\3515n\363\0325\216\002\213\300\244\tJje\246\2548\332\271Uoj\241\362ho\372\223\r\241'\216\361\246\345\272\371\361\361\265\243\2147u\005\345\207$\373\f\337\324\0314\231RGMgR\262\316it\t%;\022\031N\243=\224\235\006\215\215;\323\322\215\237\321\177\301\226\312\240\227\240\213\210\\\006$\363AG\351\213\320\232\236B\335S\332\213\320\225\363\001\246\261\033\2202\017\344\022\357A\251\261;@\257R6W\243"
+	.ascii	"\364w\361\303F\310\213N\0168\240b\033\234\233\343\306\336\300"
+	.ascii	"\004\221n\201\340\272\261Ahp\033T\203\263\355\306\326\300\314"
+	.ascii	"\220B\200fp^\270\26130?\244\350\215\375\001\305\340\314\272\261"
+	.ascii	"10i\266\210\003\350\313\215]\201xc\273\234\031R\01376\013Z#C"
+	.ascii	"\272_7\366\nzb\320\221\335\003\351\346\24177\266\360lIen<9V\275"
+	.ascii	"\310\220\312\334"
+	.ascii	"\330)h\206\324\345\306F\311p\343\362\245&\346\001\220RjE\245"
+	.ascii	"\024-3\004"
+	.string	"\232\021o\35157\022\275\210h\350DDDB\037\202\361\241\241\241\223\017\r\t5\315\317g\224d\353@\017j\032\240\377\234\007\352\243\034\016\324\301\257\370Os\025\035\317\370\205\022\r\035\376\247\037\341?\374\237\257\340\023WAQ2\367\311\021\222\204$s\237\276\331s\237&\372\\\360\342{\372(\320\224y\317\216M\335H\032\276\247\203\350\311y\222<AQ\322\024s\345=\255\222\016\213\357i\241\271\222\036\006\252u&\363\23689\024*\316s\025KD\310\206\210\221\256\242_\\\272\362*\232f\267\256\242\211Wq\263n\207\351g\253\316\303C\037\274\3118\332y\216\307\326C\026s\236\355\262\211\302\2139\317\204\026\310\270\227\363tJ\032\301yt\276#\263\323\026t\372B\220\210`\256\303%\200\226=2\3271\273\321a\n^\247\201(\314uz\003\024D\252AQH9\204\256\234\031\230I\242\343\364\207b\221\322x\234\306"
+	.ascii	"\245I:p\254\240t"
+	.string	")&?8YL\241\222Y\034\215\216\323+\2460y\036\247\205g\260\3102\210\251(Dx\034\026\242\020\336V\216\303G\351\360x\234\006>M\26682\b\307\351\267\034\247i\216\363\233\240\337\374\3467@\277\371\315oZ\210\246\234'\246\360f\206\233\375\344\003\204\311\250\363\241\322\251\354&H!tJD\233$\035\023\026@\260\2718\322\0035s\355\001\023@\221\t\364\250L\217!\343\204\304\020B\br>\220\217\303\351\025\276\232\332\212tX).\t\320-}B'\273\036k\300\273\272\263\303\366\270\375\204u\315\313\365\274ih\261\230\362b}\275(\343\004y5\031s\330\236/S\260\346\"\262`\020!'\251\325\341\2439\235\275TD\302\032A9L\024\t\007\304\2629\373\266x\004\31367\277\240/\336IoX\f\322}\320C\235|\214\022\255\255\364(2;\224\357\265\2446\017\343\"\037+\016G\310V\264\034\315"
+	.string	"\277\265+\241\235H6 \026%\265P\276\237@k\033\344M)V\311c\337\034\300\334\277H\316\353B\376\336\247\361=\240\224*\306\361\363\330n\245\223s\"U:F%\037s%l+\025\005\350\245\335,Ht\223{\344\230\343\251\020\027\002USz\245\302\271K\355\246\006\032\210\3037M\333$5\360\311_I\336/xB\331i\320\r\312e\241p\022\204\222\362ycn\356&\033\b\375\253\237\352\357\320\2307\324\2738\031\251\225\302U\036l\2645\2507\230\244\206\205\301\037\267D\246d\001\310'\210\032\006$xj\265\212\270\374\355\022\301\301c\002?V)Z\336\3173\017\340\251\373\301\305e\371\276\0368p\213\206\267\330%)1\317\370\036\241\023\351\372q\304<\321\016\342\355h\221\224\026\226\021\354\r \036\341v\276?y\250\361W"
+	.string	"\233\201\235\226\362<{\320\020'\316$\006\270UFdE\013d8H\313\202\263\201\321h\377\222\330e\241\260\271T\357R\240\007\212\200\217\002f`W\203\270\364\001k\026.v=\033\244\321\003\037\253# \311\013h\353F^\266b\032\347\376m\316d'P\340\251\026~\245\316\340\021\225\034R\334G\016_F\n\2158z\"\007e#\235\024,;?\350\220m\323j\264\303\203\273\304\250)\2558\367,\"\t\237\013\217s\261\017\337\nV\347\202[\220\350!t\374v\204Y\370\246\270h\322E\020:\255&pI\332=C\027\031t\370b\rBH#\363\224\223\312N\301\013\036&\364"
+	.string	"\376\360\323\366\373\fn,\305\004:\363+\"\037\347\347G\306\306\335\033\007\246B\177\267\026a\376\243\327\354?\276\342\3113\261g\200\256!\311\337\300\373\017\227\361\334\240\334H\006\023\3126\353\363+\253\230'\177\332\330Qk\230!\t?\262{\340\330\312\376\b>~\214m\360\347\371$\005rBL\221$\322\306\360u\212\026\244\237\265\351\207;\227\300X\366y\360ohfG\342\016\320\326\342\217\362\025$ed\277Yz\323g\020\345\336`\030\030\243\3166\375O\236j\223\334\352k\366L!%^\273<S\237\243\240\031\035-\001\370\370JUK\034\030\326\325\252\267\313G\356W\246\211\036x\356\244p\bk\352=\370\243\332\232\227%<h\327X\205\314\263\200~\023}6\306\246\203\243J\267\336\360J\206\321A)\326\252\313\371*#\253\001"
+	.ascii	"\276\214\024\257o\203\225>\317\220\252\037\364&{\002\262)%|Q"
+	.ascii	"\305\343f,\002\251\256\326\201\354\332\252\2665,\036\204\257"
+	.ascii	"\0019\202\206G'&\271\232\232\207h$\265\016\355\025T\354\2519"
+	.ascii	"T\263\002\261<\215\236\350Gw\320G\037\356\202\365\272\306UZ\013"
+	.ascii	"\n\331\264\034\343xPFS;$\267\275\320\314\372{\272\243;\032\035"
+	.ascii	"\035\177\273n\004\007\314\377\024\236~\377\223\346K\372\025="
+	.ascii	"\260u\215=/\224\212b\214V\334\216\020\352\203\316Y7\025\344"
+	.string	"\2504i;n\270\f\303mX\335\206\316)\003\374\201\027T/K{6R\t?h\322\013N\003\247\227\251S\215X.\031\362\366`\234n@+\203!R\245\005\324z\355\221|\353\276\323\333`\332\236\304\227\260\307x|2\007\323\020\347\261\357\333,\202\340\247\001D\262\224\260dI\r\231\333q\374\316\345\376>\221Q\313\025\023i#\360u\020\270\202q\227X\n\354\230\210b\241's9D\201~\3747\204\301\005\337&\241\267\223\001y\013c\323\026\243j`\220\007\313p(w\303\333\222@\254\035\340\247\260\001\365\242&c\005Sz\240?L\013\304\231\2405\307\221\200e\312\033m\367\200F\304\332\256tv\352\025\215\3058\177\331\244Q\247\3409Y\250l/\255\265@N\001-\374\216\233OL0'Xh\203\216#u\022\344\257\207\263\247H(\320G\213\370\213\020t\024\227\223\266n\241\020\030\303\234\202\373\244\004\321\304y"
+	.string	"y\217\256\371'\2328\365\316\221\325\214"
+	.string	"\354\332s\2430\270\234z\256\206\305\316\261\"\266\033\357:o\305\210<\337F\265\340\306\335\022\301\355Lc"
+	.string	"\367\030\3673\351\005m3\315\332*\373|\354\273=\005\226\237\316\236\\\361%\023\347\370\274\250F\314\206\222\013]\272\302\346r\016h\352%\232\366\355P#4D\322\322n\302\336y\335uB2\236\377\270*[\026\216\250\030\371\375e\372\177\272'\310p\352\212\201\250\002</'\265\377\306\324\342\313X2\027N\206\253\370\234\354\215\214\342\255\017\274\272\337s\250\250\006\375\376\254\205Bsm\357\367\266\313\311\317\277]9B\216\272\243\232_>\346\231\3220\244~^C\212K\3574\032Q\357\361\247\242.\213\243\360_utzj\324\236\317\020\245\235\375DD\243\327\003\335\027\266\030k\231IU\256"
+	.ascii	"\344~\032\235(i\345z\303(\344t\020q\264\307\003U1\242\207\354"
+	.ascii	"\3728\367\326\031\350\252(\2266\354d\372\323\002\032\003E\314"
+	.ascii	"Pt\265\\:\325\364\226Eh\244I\215\273\335\230\355\367l\200c\005"
+	.ascii	"B\216\215\366]\331\217Af\365e\251-\005\003z\336\366\260\321^"
+	.ascii	"\225\025^_\226\365\201\250J\006\353\244M\"N\224\272/\263L\267"
+	.ascii	"\263\235Xs\204\304\372\003\031\004S\217\021<\212q\222\246\345"
+	.ascii	"\\T_o\177\372\227!_\240\236\307\257\320\345j\375\257\243X\321"
+	.ascii	"97\025\r\356\3509jq\227\245?\f\332i\231H\033-\336nZ\300\237Y"
+	.ascii	"\243\035\037\315\323<\37388r\034\230"
+	.ascii	"\216\312\006\323\032\032\323\345\002E\240\220~\017_\241H(\220"
+	.ascii	"\"\340MR\352\023\333A\tl\\\330\224\374\274\227\317\253\021\252"
+	.ascii	"\274n\004\242b+\\\026\317\360K:b\250\363\331;\214\274\215\335"
+	.ascii	"\343\350\323\320\037Zm\200\357>v\007x\347q\177\210v\234\273\303"
+	.ascii	"x\347\2613F;\237\273C\244\373\330=F;\017\375!\272\373\330\035"
+	.ascii	"\340\235\307\375!\332q\356\016\343\235\307\316\030\355|\356\016"
+	.ascii	"\221\356c\367\030\355<\364\207\350\356cw\200w\036\367\207h\307"
+	.ascii	"\271;l<\370\253J<\373\nt\300hg\036\206^\244\232\310y\241?\026"
+	.ascii	"\221\3227\037mi\222)}{\204\343R\234\005L\325_\210\253\352\343"
+	.ascii	"\323\267:U\361\253\001\354\335\215\361\301,\371\356\222O\324"
+	.ascii	"F&\003\252<|$\036\003\333\311%\006\217\241\203e\334|%r>&r~L0"
+	.ascii	"\270z\002\247\246\365j \276\306\2475\033\314K\321\345\250\261"
+	.ascii	"\223l]\244\3325\260\367\251\310\360\307\034H\270M\b\346\375\226"
+	.ascii	"\267}\021\344\r\276\267\035\232\220\247\002\362\327\334\2770"
+	.ascii	"\261@\273\026\273\347\317\036\344\360\342-*\227\361\333(\336"
+	.ascii	" \212\323\206\267\313tB7\f\370by\337\265&\361\224\236i4P\025"
+	.ascii	"\336\315\301KN\003a\247w\265\361\240\023\177AC\214j\311\025\r"
+	.ascii	"\300\203+\310\211\357\260\342\250;\020\326\302\213\262\007JA"
+	.ascii	"\303\031w8,\325A\223\236\223\230\"\270\235X\240\253\304L&F\037"
+	.ascii	"\b\254K\277\231\rPu\005\036O`\352{i\231\372]\020W\267\322J\271"
+	.ascii	"\365\253\223?\314e\270\255\034\nJP\036\032\300\007\202U\307\034"
+	.ascii	"\204o\225\275\201#\n\306\220\213w\316\2508a~\244\256\344\275"
+	.ascii	"\f\334@!N0\023|\256\256r\t\265l\374\243^\334\331/\024\225\307"
+	.ascii	"+\236tEu}\347\365\251C\nju\253\200o\002\361[E\376\241\270\270"
+	.ascii	"\260\006-\023\013\365F@f\353\273f%\324\334\274\343Wd\252\241"
+	.ascii	"\243D\331\330\006L\370\376\245%\001\034\316z\360J>S\304/\210"
+	.ascii	"\260\221\275e?\220\021\005\304\333z\255G@3y\374\212\035\022\233"
+	.ascii	"*\032&\310\020\210I\313p\233A\206\205!z\370\364\306'OUV\247\t"
+	.ascii	"\236\314\351\314{\202B\261\364\223\220<y\341\261\207\211(\223"
+	.ascii	"\022\024\221\252\034r\033\204C\223\356!f\331e\036\005\037\211"
+	.ascii	":*\306\207\234\037p\254\033"
+	.text
+	.section	.gnu.lto_.refs.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375`\243\006\r$"
+	.string	"\352O8\016@\200jM\241\003\034I\200\376\377\377\272\333\fd[5\321\213\207i\367\326C\032\243\353\033\360\247\304\3153\326$\177\202Z\2303\270d\277EI>\200r}\004H\214\237e\321h\244i\323F,\3312\005\305"
+	.string	"\326"
+	.string	"\321"
+	.string	"?\t\237I\3709\341\217aW\030_\255\352/C\341\301\252^"
+	.ascii	"\205o\325`\343L\275\337\005?\201_`N\270\375\036\337\217\307w"
+	.ascii	"\204,\220`Y\031\271Y\236&\013&G\313\337\344{\362?"
+	.string	"Y\037\271\240,\220\254\220l\221\274P~(O\224/\312\ny\2253\312\035\345\217\262A\366K\036)\227\224\265\222\275\222}\221\305\222\025\313\003eyd\265d\271\344/k\334\357\305\337\367w\003\361-\337K\371\376\312E\256\267\372\227\326Ci\235\225\217U\371\215\352\305\251\317\003_\003\027\030W\322\36517\201\\\327\033*\277\365~\352\331{@\027{\237Ny{7\211\227w\200\336\335K=u\275\271*\345\342\370\275-\346+!\t(tg\255\250#XQO\344K#B\204(M\210Gm\250\3636d\350\022\342\017~\f\036\364_^\017\352\006&\364QP\243\311\233\0364\t\335M\343\363n\277\264\232\317\r\350E\3357\367\b\334\267\354-\"\337L\031\263\307\034\020\347\223!poa]Q=9\255G\317\357\3263\210\334\007\361q;u\362\333t\322\203\370tV;N\276\234\325\3765\303\311W\263\332\035\306\003"
+	.string	"\177\t\230\353N\373[\360{\2339\214/\335\246\003xM\016\340\264|<\255\033\306q\300\027\201k\310\273V\323\265Vs\206\034\213Jj4\3174\2321\334\016\243\020\004N\020\037\346\005\334Mr\304\b\221!A\372\343\263~\037<\337y\330\237\263\340\341"
+	.ascii	"\036\366\334g\371\370YZhz*\254\001\237\345\243)\223|\264\317"
+	.ascii	"\376\341\303\374a\227\344Z*\311\205\257}\005\341\007%\b\337A"
+	.ascii	"\330\377\232\344}E\222=\262\265\322\256\347\2565\222+\361z\362"
+	.ascii	"\332!y\336\350\002\351]ZTS\276\217jb\362\335\037J\343:\226\213"
+	.ascii	"\035\223\352X'\320\261\266G\216+\017\361Q\367b\356\356\310\242"
+	.ascii	"e\313d\207\331\263\254Y\326\306\370p\252\2439\036Bq\334\260\361"
+	.ascii	"P\255A\343\333\031WF\256b\035\013\201\025\225\001)\002ONM\274"
+	.ascii	"]c\374\2551\362\026\306}\301[\327\353\270'\365\3616\266\266\030"
+	.ascii	"\007\033s\340\230{i\375\325\255[\215}\352vNk\026\271\307!\275"
+	.ascii	"\2427\r\250*\272\027\327s\335\250Q.\305\225)n\007!\370\272\260"
+	.ascii	"^[\313\235\204k\375\366Z\006\217\253\372\261G&\277u\214Z\357"
+	.ascii	"\223Z1\270+\266Z\333mk\210\236\364\037*\024\210\217\237_~\236"
+	.ascii	";\317\031\216\332\233\333\260\231-\331\332\300f{\337m\377\245"
+	.ascii	" \301l\335k"
+	.string	"\266\3365\365\364\313\243~9o\266\266\033\006\353\317\370>\350\373^\360u\300\317\001\263`\306\265x=k\327\255\202\337\313\001\037\307\353\342\256\375\222\253\027;\267K\027\271\364\335\244\2451\20364\233L\313^\030\204\360\300\313*j\300\256ee\331-N\213Z\372f\320J&\f+\031\331Gx\340`\301U\001(^\311\372\255d\331,L\347t-\226^\033bu\301&)\022#^\177\221!A\273>\240V\371\347<(\177N\251\034\247S\312\362\325*\205,\337M\243\314'?\255Pn\224\277\246O\234\344\247i\223\200\234\2501xe\214\031\032\221\t\"%I\2224\006\300\"\234\031\267\001\020\270\035\366\f\220\344\210\023\362\274\300\211\3057\354HUs?d&\256gr\023\n3\236\231#x+\2475R\033d\\\262\n\234\035\244\227\342\312\333\352]u \255\3414Q*\217\344\200\314\252L>\324\303\234S\302\340\257"
+	.string	"\333@1\200\314)\2414\216\f\273\016\"\303@V\200\355\016\356"
+	.ascii	"\372\241\234\2612\330L-H\327\312\356\325\203\320\254\365\034"
+	.ascii	"\230)\033\324!O\220\023\027\"R\001\351%\317\262\034\244K\203"
+	.ascii	"d\331\343\264@8\212\272-\002\316\277\353\034\342z\036vy|\242"
+	.ascii	"\244\364\3238\3073H\366\251\246\\\243\024\226|\336\313\n\263"
+	.ascii	"al\006\211\376Z\3460\2150z\032\024\017Q\206!\271c\002\351\257"
+	.ascii	"\377\207F\f\330\017yh\246\212<{\372\355\325\020o\nn\005Dt5"
+	.text
+	.section	.gnu.lto_.decls.ab45c4a884f61e48,"e",@progbits
+	.string	"(\265/\375\240oi\001"
+	.string	"Mj\005n \b\347\034T\020(\006-5\006V\233\216\n\207\312\\"
+	.string	"V\221\317)X\260,\200\023J\b\343\177ULqd\263\211Q(m\250\375v\315+#X\203\263\243\252\201\207Q"
+	.string	""
+	.string	"\017\"\340\227\np\3603{\210\300\r\246\320\240%tj\t\r\204B\230\021\262\233\262\333$\221;\005\327\030\320\034h\036\331\"\\\361G;\367\362M\251x3\374"
+	.string	"\tC\351G\013W\377=\262\377\302\355\277\350\243\310\326\227\225\322\226\365\365\310\247m,\353\277k\373/\366(\252\365\325\030+\202}Q\355\317[\305\264\f\204C\034\373`z\201d$\3536n]\334\"\332\207\027\261\356\024(-\324\262f\266M\367/\236\025y\370A\2211\224\365\377\027y"
+	.string	"\3410\264\363\372\252\260\262\376\213f\3052x\n\215\013I\326W\270I\013\255\255\254\377\222m\301\234\370\227\267\212=E\256\266\212)\210\344(\207L\256\234@\271\022\314P"
+	.ascii	"\257\212A>\244\344\2506\357(\005\257%\331\242UQ\253\bVl*\352"
+	.ascii	"(~\025\303\212^E\250\"Y\321\251H\2438V\314*\212\025\243\212\\"
+	.ascii	"\305\032\305\255\242\215\342U\021GqG\221\2528U\224*\346(b\025"
+	.ascii	"\253\212O\305\033-\266\330ULzQ\251\270\364\334\206\371\f\271"
+	.ascii	"\212\343k\026\314O\002\331X\b\311f\301\334$\312\026\212\273\301"
+	.ascii	"\377\003\f\262\237\026\356\307U\226\251\205;\314\331\377\303"
+	.ascii	"\213\242\013\265\253-\240\266\253bW\361\250\210\264,\3061\215"
+	.ascii	"\260+\2431\035\241\026\216\255\205[6\216\257\037\212CkWq|\375"
+	.ascii	"@Tt\321\303\360\317[+\352z\250\260\313\306\3615o\355\370e\304"
+	.ascii	")-\334\262\030\307KJ\256>\024cd\301bW1\316Fm\336\224\002\302"
+	.ascii	"\222d\301bW&\264\322\321\3422\214\343k\314\007\306\275>\304#"
+	.ascii	"\n\320\177\213v\316k]\334\020T\354\"\022\0161\314Q+1h0\353\242"
+	.ascii	"\214\017/\316\250\240m\016.\353c\333t\377\352\354#\003\367\221"
+	.ascii	"w\373\310\270}$V\261H\033\335E\345\310\372H\033\373\310\241\375"
+	.ascii	"=e\177\033\331\337s\373"
+	.string	"{m\177\217\355o\257\375m\265\277k\354o\243\375\343\224\375c\337\376\021\310\376\361k?/\307~\266uq\177|\332?\026\355\273RvLv\337-\262;8\333$Dm\024Z\027\367.\320\276\221p\337(d\377\255uq/\020\222\003\001\333\304\277\242>%\317\200\177^\222\231d!\327I\210\223\266\254\231\327\326\305m\r\333\246\233\377><+\201\021}\f\356d]A\022?\237\353\n<g\026\310$g$\373G\213l\3267\256\365\361\025\335\020\241\254e}$\006i4\205X\225\365\215_\373%\030\311z\355\224e\3175&:\272]\377\242\030\356\265\330l$\347\351\030%T\323\2125\255o\004\332\327\210\373\317xE\230\214\006\303\262\276\273\032\233L)\321\312\372:p\257\310s\177\036\222\211\264\330l\227\203<\323e!o\355r]\236[\352\\c\035\267G\334W\304\360\203\354C\b\031\236\253\257\331v\036j]\\"
+	.ascii	"\264M\367Zl\377Y\316E~\221\201\226y\\\\}Y\347\255\017\317r\357"
+	.ascii	"\217,\230\020\020\241\326\357J\211H\034\234\221\320\260P\354"
+	.ascii	"\255\305f\270\027I6\275?\\\030Ue\375\341\303\363[KvXF\347\366"
+	.ascii	"C\253iiI\375h+{\222\352\221\265\217\230l\204\017\206X\326\327"
+	.ascii	"X\373%xe\262\tx|`x\003\273\3769-\363\310h\313b\034\357\220]\225"
+	.ascii	"\300\325\302\265yG)|\211\205\245\345\2563\231\200\307\007\006"
+	.ascii	"\256\260\265\214\315=\262Zfk\2619-_\237\313\262\331c\256q|\302"
+	.ascii	"\237\267\322\262\216\026n\251s\215\205\216RyF\336\f\343\370\372"
+	.ascii	"\301\007\037|\020\363\201\222\020l\211[Rg48\034\342\270'\216"
+	.ascii	"c\030\244\335\217;\032Y\377\303\363Y\323\035:\272\306jq\0343"
+	.ascii	"_) 3\224d}\335b\267\327\326\305\215i\233\356\213\211y\f\271E"
+	.ascii	"\206\342)\353\027\235\354\267\330,\026\246\206\244\250-\353\034"
+	.ascii	"v\300d<\201.R\006\205+\353\374\265m\3540b\221u\336q&+tX\264\310"
+	.ascii	"\372\204\237\373\217\3240\340\300\356\262~\221\311~1\311~1o\277"
+	.ascii	"x\267U\2648\350\001\302\026\226\025\243D\312]\221\254\337b3\026"
+	.ascii	"P\013\\HJ\256:PB\351\343\361\262\302q\004\013\002\245\226u\306"
+	.ascii	"\221\363\215\234\343\031G\256:\210\023\236\354\3118t\034\357"
+	.ascii	"\264-\006\313\266\305\3008\207c\207\207\253_\244\333\177\246"
+	.ascii	"j\247\354\036\200y-lL\351(\254\037`Y\017N\361\020Ie#7\006\212"
+	.ascii	"C\266\032Qn\226\236\241\213\254\363S\206j\2611\231\006\2635\302"
+	.ascii	"\023\224\224\365\213o\373\003q\033\343>\261\215q\377\354\324"
+	.ascii	"\302\345\275\273\037\236\246x\331E\343h,\353?3-\325\350{\302"
+	.ascii	"\312ZI\255'\005"
+	.string	"\032BP\262~\021m\277\r\313H\331\347\270\206\204)\233\217\262\214<#'\345\030-6#\345\241\\\224]\344\027o\257\261OO\034\307o{ \265>\262\212\342\331\325vS1\225-k\315Z\265\024H\250\332\261\214\224ad\243\342\331\325V\221V\225\215\343+R^\221\205\212gWH\026RK\3318\276~\020\363\301\007\037|P\364*\324\241\221\324Dr\025b\017\036Y\2778\266[\237\326\305]i\233\356\237\211~\344{\367D\306U\326/v\355\027o\354?\013\345 \260\0275n\304L$\334\241\016\030Y\347\026\371\347\031(\263\2103\220\tMq\274\223\201\230R\342x\207\331\266\030\264-\006\372\013\312j\315\325/J\355\027\237\366\213J;\247\270\236\305q\f\001\262\f\t\320E\326/\376\354\270\266\256x\275:\272\2518\342k\003\213\327\267\315\206$(\033\307\261\224vJ\261lh\247\245\315\310\306\3615\333\036\252"
+	.ascii	"\312\306q\234\343\266\255\205+^\257\216iR2\262q|\375\237y\262"
+	.ascii	"NF\321&\346\236\274\323bs\374\034\267C\332#\305\353\333vC\"\224"
+	.ascii	"\375\340\203\017 \370\200\231\344#\227\267\324\035\264\210\310"
+	.ascii	"\236+\023\331\327DI-\353\027y\366\263\224(:yF\204\243G\326\317"
+	.ascii	"|\206-\266\205\322\n\352\026J;\330>)\226\rm74"
+	.string	"Df\027\221\260\030Z\267\205\327\366k\360E6\353\347\270\3356i\235\264\330\226\360\332\254)>\213\343\253\262\270ct\347\226\365\333\016\\fbbbb\333\201\373\234\266\237\257\366\263\215\r\3104\022K\201\230\365s\214\375\022\354\332$J\256\342\270\347\355UI\213\327&)^\3376\013\276%\3318\356Y\3222i\261\255\222\366\357\203\017b^1\271\256\026\256~F\261\333\276\026I\213\205\240\365\213\231\313({BO\262~\213\270=\020\307-\004n\233\230\330B\340\276-\334\353\241\025d)\353\267D\366\3776\257\325k\261\255\221\266\310\333\265\226\355\371\032\307gq\034\277\004\273\366n\271\243\022\367\2400\274\212\343\263\267\327\377\303[#-^{W\274\276\355\026(\240d\343\370,\346\203\017\224\201<cM\256~+d\277\035\333D\256\360\333R\217\027Y\277\325\261\337b\355\267O[H\214\216\322$$J\326o[\354\227"
+	.string	"\342\2046H+\327\316\025\257W1\017\237\026"
+	.ascii	"\234\234\250\220a\030\307g\377[\272\026\333\006i\201\034\304"
+	.ascii	"\to\257q\034\026\307\361\0071\307!((sZ_\223BBUMY\377\002\373"
+	.ascii	".\354+`\267?Z\267\026KA\373v\020'\274"
+	.string	"\250c\026\207\305\361\225\251\234\262c\312a\326Ga\277\245\300m\023[\n\334\177\330\377`_\320\272\270\272m\272Wk]\334\226G{\326b9h\323\336\222\265\327\033w\256\3615\216\257\314\315\227U*\222\3653\330o\321\2764\022\237pw\277\345\300-&&\266\034\270\317\373~\255\213\253\322\272\270\271m\2727l]\334\277\025\373[\2606\214\202\242\317OS\254\026\307\327\025\346\325\b\210F\326\277\266.\356n\233\2561\206\314\325\272d\255\254C\227\t\020~\270"
+	.string	"[\001<4~\\\212G\305\241\377\350\301\337^\220\324\340/\032\025g\024]\374\305\250w\305\377\262\370\223\031\024\203\340\r\024\227\214\007H\006\340\207_\016\360\025~\225\r\374m\221\026o\017\240\212\201\211\275A\0036\006/\024\331.\035\240@\345"
+	.string	"-\t\333Ee\204\2556\253\335\341\032}\271K;?\034\024\377\360\324'\330\240-\203\007Y\216\200_E\003\267+\006\032\255K\013o\200\204\235\224\240%a\357\346\206\376\317\277J\332\357\322\274O\277kB\222\202\343\321\377F\3750\216\267\352w\r\340\242\360\273\004\370\223\023\374\357\215?)\301\377^\375/\326\237\214\340o\355\f\333\371_\204_\205\354\177g\374/\322\237\204"
+	.ascii	"\351\222\214\371\217v.\215\266\210;\363b\225\357\322\3772\375"
+	.ascii	"I\230W\200\003\026\243\now\300\257\322\345\302p\221\362\214\n"
+	.ascii	"p"
+	.string	"\233\374\311\227\277]\272Y\275\337\035\334)\354\355t\314\356\001$]\376d\313\177D\222T\371\223\314\177\203p\263\177\362\375\223\310\377\330\343\230vD\2139r\035\2556\006[\345\buTJ\272\177\322xT\300\236\300qD\262\370'\363\177<\3418\330\356\375\355\221\277\325\373\333\274\337\250\200v\251Db\202\364\337 \300\210 T\242\377Q\305\322v\311\001\330\030d\0216\t\277\321\271\3011\tK\371\217\024(\312\340\302\260\022>\334*?\374\200\243\003\334\0268\205\343\021W\0028\346(d\034\002g\020\304\b\bS\375.\335\017G\371\335\265\f`(\277\313\366\303\206\377\021\204\353A^\221Y\034\017`\324\202\245\307\253+B\361Y\204\026e\216\021\274m\017?|e\334;\2168\246\2714\334\032G;\370\311\177\230%\007\205?,\002~\201\007\1778\360\207\253\360\n!\374\207\373U&\260W\340%\177\013\366_\356\023\250`"
+	.string	"+\371\215#\376~\243\005\334\251v\351\326P\316P\354\300\017'\371\213:\177\321\003\377\273\362\277,?\354\367\0279\360\027?\360\277\270\201\377ro\f\214\244\3577\026\342\374.\0130\337\004?\314\364V\340\302\2534\276\270\241\330\363\267\313\036.~\370\b\274\367\033}\376L\201?[\340\317\027\370\267\326\017\033\371\367\326\017\353\375\273\353\337^?\234\227[\370\263\f\177v\341\3173\374\031D~\341wad\006\374Y\002\307\227\037\306\3733\013\177\016\361\357\353\017\027\201\357`\"\277Q){\200\201s`\367\303C~\243Q\313\377\026\376\245\007\2771"
+	.string	"\3776\276\r\200\353\376\327\206\377\025\361\303B^\b\274\022x)\360\277\025\370a\272\037\016\262\213\273\315\005\370_\f\274\316\037\236\373\337\231\227\346\207\345\3767\207\037\006\362\2775?\034\367\336\374\357\364\177q~\030\316\250\362\033!\370\215.\377q\312\177L\374\341\267\343\341\2579p\342?Bi\327\216O~\330\355\177\251\017\370_\353\017\377xK\230\370a\246\243\223\277\365\240\r\341\2067\273lkIx\316\317\344\373\333\"-^\035\037\322\205\035\003\354\343o\363\261\006fsq\340\265\377}\361\2770~\270\307k&h\227\024\b\241\202=\201\377;\374*ZmR\003\377\337\366\216*\\?X\255-\322\342m\032\3404$\013w\346\305n\3539\200i+\210\300\177\002\374*V7\357\336\003T\252`\354\257\361t"
+	.string	"~\275\301\2573\320\032h\017~\355\200_\177\200\366\033\247\274!\376\227\205\037>\373\265\365?2\371\217\200?\314\2438\344\207\315~\027\006\270\354\033\300\327\277\315"
+	.string	"\311\377\017?\323\355\337(\374\233"
+	.string	"?\034\366\27353/\366\206="
+	.string	"\225\351\177D\002\373\221a?\f\366\037\361(s=2\2713/\366\256\rA\311"
+	.string	"\310\277\305sk\366VY\371\335\232\277\r\301\245I\302}\375\306\351\235\022\254\002\n\f\360\357\t\376\315\301\017\357\370\2151\354\rTf\370\367\013\354\325\343\002\302\277\001\360\357"
+	.string	"\374p\327\233\342\177\201\300\033\300\340?\005\277J\210\037\351\343G\266\3750\327\217|\203u"
+	.ascii	"\371_,\262\356G\016\371\341\255\037\031\004\326B\252\035qP1\037"
+	.ascii	"p\364B\036\201\263~\327\210\261\206\026\214E\003\327\177\022"
+	.ascii	"~\246\315\377\267\034\375/w\214\340\207\257(p\017\377\362\303"
+	.ascii	"\017[\271uH\275\377-\362\t\266\230\322\377\210\364\202\360\277"
+	.ascii	"\330#\335\337^p\224\373[\017\212+\212,\340\034\277\361p\0068"
+	.ascii	"&\224\213\364\366p\n\361\037\217`\034\377\021\351\277\376\231"
+	.ascii	"\003@f!\2670\360#\271~\370F\221\345\020\374\314\022~W\006\256"
+	.ascii	"\"\341-\271lI`\356p\243I6%2\312o\004\204\251`\033\233\257\375"
+	.ascii	"\337\374\303SK\026\251\277(%\341\037\374\314\026j"
+	.string	"\202\360S\325\017;\375\3555\255\214Ni\365\273W\257\006\031\374/\007?\334\304WG\263\337^\t`\246\231\033\334\230\3325\367\307\017/\271\030\200\225\376v\304\337\312\374\355L\b\034D\331\2241~\243\241\373\374[\017\306\020GL\222e)\243\031\374H\r~8\351?\312\374\255\207\243\363\317s0\222\017\n~d\005?<\003\211\001,\3437\356\200\217\376\254\004\277\370\341\237\354\006\273\370\215a,\371Gf\373\263\334\210\377)\374K\264\037\031\001\\t\016pX\226!\215iBG\246w\377/\f?L\364\2730\340\241\337\330\265\337^\r\013\375\310\013\376\027\376\341 \nd\377c\3603\365~\267\3547\352\301@?\374\363#\r\360\303>\377~\303C\272\030\215\374\306=\270\347h\305t\302;?\254\323V\340\207\343e\213\001\263\024\271'\376\300\337\2145\362\f\327\310\225\362\006\311/\362\021\b\246\034\360\007`\017\034\006\336"
+	.string	"\007\360\016?\234\363\303\025\200\237\325\037\236\376\031\351oI8\315\277\314\341r;\177\376\300\237Q\374\271\347\317<)\376\277e\246\034\377p\004\016\223\227\376\274\202E\t\377\003\360/g\262P\233A.j98\200\326o\334\372a)L\003\317\374m\022\206>\177\270\002\177vR\300\177\020\376\245N~\361\033C\270\370s\321\237a\344\241?\013\375p\004\376,\203\203\031\b\350\200\362\355\300\377z\340\207!\360#]8\302`4\300\021~"
+	.string	"|\203\210\037n@R\005\202\032\177\2461e#\206\245\213\3375\202d\0023\300\311\217$\374\341\005\264kG\n~8\206\342\323Xu\274\222P\002\303"
+	.string	"\277"
+	.string	"\273"
+	.string	"\257\360\267\313#\217\377.\374L\025\b\370\2153\310$\310\277\037>\300_\304\300_\274\300_t\376\305\347_\204\266!\234\002G,\312\2241yTp\2001\001-p\n\260\001\n\240"
+	.ascii	"\035\001\374\306\237\334\365g\257\274#k\3759K\307\237\271\300"
+	.ascii	"\276A\016\263a\031\365#+\360\033\325\340\023~\344\b\244\363G"
+	.ascii	"B\177\330\004\244\024.\341?j\240\310\374\2217?r\372\303 ~c\007"
+	.ascii	"\305\303\037\212\333(\367\033\347~$\211\037&\3417\276\301#\270"
+	.ascii	"|H\023\310\023?\354\341/^\200\374\300\217\214\177X\004\327\310"
+	.ascii	"X\343\337o{"
+	.string	"\b\034\302\217d\001\203\260\341\017~\243\324\217D\376\260\0075\331\310\237)\320\206\320\222\360\350\277\304C\002!\211\340\016*\340\322\006#\301m\021\005\023\220S?\322\306\017s\320\272\024-\370\221V\360\006H\227\037\371\362\303\032\374G\241!p\006p"
+	.string	"\212\024 \243\376s"
+	.string	"\003\340/\246\360\303\026\034a\374O\300\317\004\001\256\3407\322\020@\321\204\277x\302_D\341X\364\037]\3740\005\177q"
+	.string	"\377\345\220N\360\004\177\221"
+	.string	"0\004\177\261\205\037\226\340/\276"
+	.string	"G\360\027)@4\306\360\016~&\006\373"
+	.string	"\307#\007\220"
+	.string	"\216\201a\340\227\235\302\211\342\214?W\213F?\314\362\027c\374\256\013\177\221\306\177\271\342\321\377\n\340\177\007\360\303+\177\021\3515"
+	.ascii	"\254\362\027\203\212-\2126\212K|\3775\370\231l\277k\004f\346"
+	.ascii	"2\327.\352(\005/\377\315\247\314W\030V\376\305\031\332\"\177"
+	.ascii	"\213\367#\321\376\354\006'\177\227\0020\374\277\002\257\024\370"
+	.ascii	"\375a\375\027m\370\333\020~\034\241\376+\340g\276\320\005\267"
+	.ascii	"F\"\360\377\\\366\347\353\177\271}\370o)\377\233\370\267\311"
+	.ascii	"w/\243\035+\260\354\372[e\273lCHv\375\331\372\347\352\377\267"
+	.ascii	"\r\370\357\300\377\235\362\037/x\021_)\177{\301\361\203\277]"
+	.ascii	".\037\300\367\357\276\377-\374\333d\273\\\206x\t\177c\3657\270"
+	.ascii	"{in\235k\327E\250\244\003\r\\\336\016\303\2011\304\002T`\374"
+	.ascii	"\257\223\337X\3025j\201|\311\333\3447\356\2007\370\033=\360\022"
+	.ascii	"\241@\314\004m\005W\341W\002y\3737\334\377\n\2723/\266M\276\331"
+	.ascii	"\243\315\005\377\322\216\006y\0032\206\037\371\200\377\005l]"
+	.ascii	"\214c\247\300\006o\376\313\266\037\351\302\313\344D\332\245\221"
+	.ascii	"\007\254\342]\362\372\265!4@\205\351\310r<\276H\216\314\267\357"
+	.ascii	"\034\030cp\271\004\377R\202c~\371\332\265\f\201\013\201\367\310"
+	.ascii	"\237\225\347\340\335\373\2151\354\377!\374\313\025\370F\204\212"
+	.ascii	"\224\033\277F\376\254T\331U\377\276\361\277z\024\234\245\ra\267"
+	.ascii	"\240\322\342wwx\363~\327\372\342\225\200ic~c\013:w\371\225Ek"
+	.ascii	"\0076\360\344\337\032\3707\365\177\213\230\370[\r\334\234\377"
+	.ascii	"oI%\367\340\034\034\321\215\200\005\177\322\352wa\374\357\335"
+	.ascii	"o\334y\211\374\355K\373\326\355\307\337\306\375\256\222\327\356"
+	.ascii	"\377\223\366\177\207\374n\ro\335\357\"\265\3315|\205\264\036"
+	.ascii	"\004\371[\375\277t\255\213+\345\r\362\377\255]\336\311\177\016"
+	.ascii	"\332\0166\200a\271\341\346X\374/\303\277<\376W\362\177I[\374"
+	.ascii	"\337\271\377x\377\363>\345\177\345\376\026\002\t\376\313=f\003"
+	.ascii	"\021\256\003\376\277\374I\250\246:\255\246\247\026Z\017.\322"
+	.ascii	"\222\020\232T\270\372\257\362+\237W\376J\021\214h/\020/\230_"
+	.ascii	"\251\201\247\277e\362\306\375\355\022\027J\223\244-\265\247\376"
+	.ascii	"\027\356o\263.\242\3620II\200\267#\177\345\207\r\343}\373]\241"
+	.ascii	"\327\355\337H\377\373\343\337I\377\333\366\372\270\301\375j\371"
+	.ascii	"\2259\333g\353\374{\305\377\256\031\0270\244\304\340\023\264"
+	.ascii	"I\243\003^($\300;\227\206\213\304\367\177\377J\266\337Ez{(c\370"
+	.ascii	"7\007\376\335\201\377U\333@\377\016\372\337\264\337-\372[\032"
+	.ascii	"\332\031&p\227\3763\177\345\001\376\367\202\337\235y\261\377"
+	.ascii	"\261\355\277"
+	.string	"\361g\"\241P\301d\036y\216:\377\321\003\377\361\003\377\213\366\037ux\317\236\374\227\204Y\211\202\t\377/\217\037\271\364\277b\177V\376\031\316\310\254B\201\377\033\034M\374_\376K\301_o\340\33739\374\333\346\r\373\177\374\231O\376c\341\3733\003\377\243\324\177\254\361\027i\370_\374\231\016\370\335\266\377\005\373\333\033\322\336\257\337\350\342\335\361\033\243\274~#\315+\370\225J\377q\202\264\037\322\377\355j\005%\360g\b\376\226\311\337.\371_\256\337\330\364\277:~c\006\376w\3537\n\375\257\326o<\372\337\254\337\b\375\333\345\377\b\376\245\001\376\027\353\177o\374o\324\377B\375/\323\377\"\375/\214\377\r\372\337\237\377e\361\277)\376\267\347\177w\3767\376_\017\374\257\211\377-\361\277\326\377\245\376/\316\377\326\374/\315\377:\377\267\002\377+\201\377\205\300\377\212\370\337\032\376\027\206\377u\341\177Y\370\337\024\376w"
+	.ascii	"\377K\302\377\202\360\277\036\374/\007\377\253\301\377^\360\277"
+	.ascii	"\025\374\357\004\377\013\301\377\262\374/\374\277\310\3775\376"
+	.ascii	"o\376\221\207?\222\360G\002\376\310\277\037\311\367#\365~$\336"
+	.ascii	"\217\034\362#\351~$\220\037\t\367#\333~$\366G^\177\344\330\217"
+	.ascii	"\f\373\221^?\222\353Gn\375\310\254\037y\365#m\374\310\247\037"
+	.ascii	"\271\364#\213~$\320\217l\361#\343\037y\342GN\177d\006~$\364G"
+	.ascii	"Z\340G>\340G\276\360#\r\360#G\370\221\032\374H\f~d\005?R\202"
+	.ascii	"\037\371\362#\341\037\211\374\267\224\177\007\376\273\357\337"
+	.ascii	"v\377\206\373w\331\277\275\376\275\365\357\033\377\236\3727\324"
+	.ascii	"\277\223\376m\364\357\240\177\257\370w\007\376]\342\337\326\177"
+	.ascii	"S\377=\375\267\315\277s\370\267\364\3373\377\206\376\333\371"
+	.ascii	"\357\n\374{\002\377\216\300\277\037\360o\021\377n\300\277\027"
+	.ascii	"\360\357\026\376\255\200\177\253\360\357\024\376}\200\177\017"
+	.ascii	"\340\337\004\370\267\t\377\006\361o\022\376\355\341\337!\374"
+	.ascii	"{\203\177s\360o\f\376\035\200\177S\360\357\n\376\355\362o\230"
+	.ascii	"\177\253\374\233\345\337\311\177+\377\275\377\215\374\267\361"
+	.ascii	"\337\305\177\267\3771\361?\036\376G(\377\361\311\177t\362\037"
+	.ascii	"\007\377c\366?\002\376\307$\377\021\311\177\344\373\217D\376"
+	.ascii	"#\335\177\224\373\217p\377\321\355?\266\375G\266\377\330\343"
+	.ascii	"?\246\375G\264\377\310\343?\226\375G\257\377\310\365\037\267"
+	.ascii	"\376\243\325\177\304\361\037\251\376\343\324\177\204\372\217"
+	.ascii	"N\377\221\351?*\375G\244\377(\343?\302\370\217.\376\343\320\177"
+	.ascii	"T\361\037Q\374G\236\377\250\363\037?\360\037w\370\217&\376\243"
+	.ascii	"\006\376\343\364?\332\374G\232\377H\342?\312\374\307\021\377"
+	.ascii	"\021\207\377X\201\377h\303\177\214\341?*\340?\"\340?\236\360"
+	.ascii	"\037K\370\217\037\374G\f\376#\005\3771\202\377\030\363\037_\376"
+	.ascii	"c\313\177d\371\217*\377Q\371\037\367\177,\376.\342\357B\371]"
+	.ascii	"\302\337m\362\273\331\337\005\374\335%\277\233\344w\371~w\357"
+	.ascii	"w\357~\327\356w\353~\227\356w\177\374.\333\357\232\375\356\327"
+	.ascii	"\357z\375n\326\357^\375n\216\337\275\361\273T\277;\365\2735~"
+	.ascii	"\227\306\357>\375n\323\357.\375n\322\357\036\375\256\321\357"
+	.ascii	"\026\375\356\320\357\352\374n\007~w\003\277k\342ws~W\003\277"
+	.ascii	"[\363\273\031\370]\232\337\215\376\356\363w\235\277[\201\337"
+	.ascii	"\215\300\357:\340\327\326\337\205\341/N\375\256\013\277\333\302"
+	.ascii	"_T\372\213<\277\313\302o\004\374\335\025\376\"\364?\r\177\021"
+	.ascii	"\002\277\253\200\277\370\302\237\013\377\342\312_\324\340\317"
+	.ascii	"C\376|\366g\260?O\375Y\306\237W\374Y\207\337M\300\357\036\340"
+	.ascii	"7b\340\317*\177{\375\333\013\374\355\f\177\353\376-\005\277k"
+	.ascii	"\200\337%\300\357\232\360\273\037~\215\367\273#\374\256\b\277"
+	.ascii	"\013\302\357z\360\273\034\374\256\006\277\013\200\337\275\340"
+	.ascii	"w+\370\215)\374\356\004\277\013\363\033\021\360\273.\277\253"
+	.ascii	"\362\273\313\277(\303\357&\177w\377\306\002\374\256\361w\377"
+	.ascii	"\033\247\374\306\303\337h\370\033\013\177\343\340o\f\374\215"
+	.ascii	"K\376b\3647\372\375\306\275\337h\3447\342\375F\273\277(\375s"
+	.ascii	"\223?\037\371\2130\277Q\310o\344\3407\316\375\306\267\337\330"
+	.ascii	"\366\033\325~#\217\3378\366"
+	.ascii	"\033\303~\343\216\337\330\365\033\267\376\034\3437b\375y\351"
+	.ascii	"7Z\375\306\252\337(\365\033k\374\306\250\337H\34376\375F\245"
+	.ascii	"\337x\364\033\215~\243\213\337(\364\033\177\3766\3557\372\374"
+	.ascii	"F\025\277q\3477z\3407\356\360\2677\374\306\022\277\261\372\033"
+	.ascii	"\247\2771\003\177\233\375\2154\277q\3467B\377\f\301o\034\361"
+	.ascii	"\033\237\277\321\371\033-\360\347\037\177\273\344\317i\277Q\002"
+	.ascii	"\2771\002\277\321\001\277q\001\377o\376\337\360\277\002\377k"
+	.ascii	"\3766\203\277u\371[\016\376#\376/\374\333\020\376s\360\033c\370"
+	.ascii	"\377\366\033[\370\277\301\337*\377\373\375\237\340o\223\277\221"
+	.ascii	"\205\377D~c\210\377r\277q\205\337\250\302oL\300o<\300o4\300o"
+	.ascii	"$\300o\354\3407f\360\033+\370[\266_s\340\327;\374\332\304\257"
+	.ascii	"s\376\"\336_\244\372\2136\376\342\322_\374\371\213,\376b\317"
+	.ascii	"_\254\376\305\034\376b\006\376\"\211\277(\363\027#\360\027\037"
+	.ascii	"\360\027\033\360\027g\370\213\f\370\213\013\370\2130\374E\017"
+	.ascii	"\376b\007\177\221\203\277\310\362\0277\370\213\315\277]\373\263"
+	.ascii	"\335\237\353\376\034\344\317s\177v\373\263\217?\253\375\031\355"
+	.ascii	"\317a\177\266\361\347\247?7\375\231\351\317J\177N\372\363\214"
+	.ascii	"?\037\375\231\305\237U\374\331\304\237\247\177\226\376\331\371"
+	.ascii	"\347\t\374\237\341\3174\374\331\303\237W\376\266\360o\t\377\326"
+	.ascii	"\311\337\n\376-\223\277\365\373[\271\277\005\362\267j\177\313"
+	.ascii	"\343o\313\376\366\346oi\3766\372\267\030\370[\033\376\326\001"
+	.ascii	"\177K\303\337\202\370\333\017\177K\302\337\216\360\267\036\376"
+	.ascii	"v\371\267\036\374m\007\177\273\301\337j\360\267\027\374\027\361"
+	.ascii	"\267\026\374m\005\377\303\376\354\362\337\356\377\007\022\023"
+	.ascii	"\023\023\377\0278\360\227\220\342\007\274@\205\273\205\334\221"
+	.ascii	"\277\254\213W\255\213\013;\371p\230\360\375\242\023\234\222\365"
+	.ascii	"\t\202\202\360`k\026\353\234`\006\366\345\025\307I \024\201X"
+	.ascii	"A)\312A0\330\020\237\272\254\177\302\224\375\303\200o\2610 \034"
+	.ascii	"\030\250\247\305\265{\372v\202t\216\202\200\262\376\t\200\373"
+	.ascii	"\207\377Z,\374\007/\201\241).2Ak\220*\314\260-\202\245\263b\311"
+	.ascii	"\277\247\300J\334\276\334\364\002\212\361\275e\275O\200\333p"
+	.ascii	"\222\037F\002\373\265=\271\262\312:_\265.\356\006m\323\205\371"
+	.ascii	">\034\356\273\313\261\303\224\265\006\360\021\330\b\231\n\037"
+	.ascii	":\262n\261\260\036l\244G\362/\250\253FR\314\307\034\\\326?al"
+	.ascii	"\037\276ka<,\214\007\337\305\304;E!\034\022}e\r\343\241\027 "
+	.ascii	"\374\204\250\r\337\355\024'4q\220S\310u-\tR\2529)\022\227u\213"
+	.ascii	"\205\207\300v04\305E)\300\271\200\212;>)\323\0234*\362\024%\353"
+	.ascii	"\237\360\263\177\230N+\201\205d \034\234\336\256mY\267BZ\027"
+	.ascii	"\027\326\371p\230\256\211\337\331\0168.\016\236k\315b\241\030"
+	.ascii	" EG\035$\205\300]\333\262\206\347\262@z\204e\r\003q\223\376#"
+	.ascii	"\217nE\206,\231\362\037\351\026\021\222\022%\353\233\020e\303"
+	.ascii	"p?\314\002~\313@:XtaY\347\243\326\305\315t\037\016\273\241\t"
+	.ascii	"\336\305kkp\333U\3428\206\211\234\276\262\206p[V\212[\364d\r"
+	.ascii	"\263\031m\024\35141\"\323:\252\221\365M\b\334?\334\003V\253\313"
+	.ascii	"\006\tf\r\247\351\036(L\310\333?\214\326ba,\240\021,\356\032"
+	.ascii	"\243\2053B\025.q\203\257W\230\307\333\2418\216y\342x)\311m\242"
+	.ascii	"\363\2255\204\315\016\363\370\034\222\013\255)E\326p\031s\206"
+	.ascii	"\031\030_\240\221\355\n\250/\353\233\200\266\177x\f\0363\332"
+	.ascii	"e\263X\347\225\002S\361\306\004,;$\313\372&`mX\354n`a.\262\206"
+	.ascii	"\301>\034\0163\376\3755\331\313\032\003\275\004~\202w\300+\214"
+	.ascii	"\030\276\310\272\315\353:\354u \0331\200d\rs}8\334\305\242\251"
+	.ascii	"GZ\326\036h\265XX\013\336\322*\3278\n\307U\034\037\201`<\232"
+	.ascii	"s\333\313\032\3362\036\345&\"|ED\262\276\t2\366\377:\275R`\254"
+	.ascii	"\f\204\203\022\213\266s$\353v\n\306\321ba\034\260ULS\\d\002\331"
+	.ascii	"\240V\226\215\037gt\260\325\177\324\203s\030\231p\320SgC\334"
+	.ascii	"\262>\226p\270a\0330U\213\275\035\\\365+s\031\247\242\207]\326"
+	.ascii	"/\301\311~{;\367\003\355\355\\x\352Z\206cn(\347\205\345\230\312"
+	.ascii	"o\207kd "
+	.string	"\034`L\364\360$\302P\207\243\376\267\006Lc\206_\220S\326\255_\353\342\302O\037\016C\031\271\214d\340\310z\002&\270\251-\333!\021\361I\326\312\266\351\026\263\037\0163\025\t\222%\313\032^\372\341$X\311O+\252,k-\244uq\317\3266]x\306\207\303HG\266pTe\375\265\243\3032\236h\345\344'k7\311\207\303G=/\326rd\r\033\3510H5$\353\227\220d\3030\212^>\330E\006\202\021?\245\310\272=j]\\\230\350\303\341\"d\217(5\350\262f\021*\242\265cvu{\207Y\303A\037\016\013\355\304D 6\262^\266(\006\201\1772\020\0160\214\024\032f\235\233Z\027\027f\361\341p\013\025>Q\206\262\016@\333t\341\025E)H\372\240`\024\207}~8\005\254\"i\n\221)\353\234m]\\\017m\323\205{>\034F\241\365\327\342,k\021\332\246\013\363\374\260\016\274\223q"
+	.ascii	"Q\255e\335\276\265.n\004m\323}\007?\034\216\221n`x4\020_\303"
+	.ascii	"w\n\\\206'eG\326\355\225\224\017\177\021\231J9t\216\262v\201"
+	.ascii	"\362\367\360\177\t\337(T/~<\311\272\365j]\334\327\360\303_(\312"
+	.ascii	"\251\033\\nY\277\264M\367}\342#/\220(\353\227\360\303\337\302"
+	.ascii	"\335\304\325\005\2255\214\340;\3706\311@8\354PQe\335\252\265"
+	.ascii	"..\004m\323\315e\037\376\n\002)2\243c\362\002\276\201\031\b\207"
+	.ascii	"\262kO\212\254\213^\255\213;\200\266\351\276"
+	.string	"K>\374e\242\271\274\332\230\262\026\300\373\367W\311_\224\221\013\371~\fNe\255\215>\374\375\313b5|\250^\240%\"\216\026xY\277~\377\333\364\"\311@8\f\211\242\013\312\272mj]\334\227\357\303\337>6;D\253\254\233m\323}\217\374\270C\253\221u\320\023=\241\"\275\026\373\352\275x\255Y\254\0033\271\352+b\030\307G \274L\207S\216d\375\022\346\366\377\346\341\305:?\350\262~\213\264ckNrd\375\022\260\373\177\207\274v/\221\f\204C\237\024\256\031Yg!\255\213\013B\333t\217l\037\376\016yJ\341\243\253N\317 \374\203R!\204\256j\253\020\233\365KwD\003B|\221\365;\227|R\361dJ\326/\220W\356?R\231\030%\361L\256\235c!\346\304\355\365\361\266\375\375\361\367\307\013\267\3438\326\271\306B\255\016\254\257\254W|4\324\301\013\247L4\003\f\314\372u{\225P\315"
+	.string	"\003\372\217\314\200D\202@e\375\022\306\366\377\366\371w\343\235\2418\216\213\214\327x\210'\351\376\355[c\333v\360+\333b\013\200\377\372\004"
+	.ascii	"\244\211\343\244B'q\034\267N\266\226\333\016\322\005\361\377"
+	.ascii	"w\020\307:m\034\307C>gO:+>g;\261\017Z\036\321\212\317\331\023"
+	.ascii	"\221\3175v\202\211\317h\304>\327&\035\335\244\023\307\261N\216"
+	.ascii	"\257q\317\023Q\334\323\244\203\343s\215\207\342k\223\216J\334"
+	.ascii	"C\244\342s\335\321\3619{\"j}\316\232\210|\316\232\210V\342\236"
+	.ascii	"X'\356\331q\332=MD>D\232\210T|\316v\210|z\236\210\332kS"
+	.string	"\334\352\001\271>\351\244\210\317v\224q\034\377\\\257t\222q\2743\024\353\030\311@\361S\026(^\212\333\274\035W\032q\034\353\250\371A5!\257<q\236\317V\023M\2128\366\213\201L\320iu\256q\034\253\210yt\3328Nq\035\212c\236&\034\216\3428\216\233\332#*\206be\334\263\363\303\003\325\224L\301\323\244\"\336rj\3438\216\211|\316\240\232>\300a\317\256b\236\253N\353\363\323\024_\305~OC\373L\247m\242<\253:\372a{\221)X:\234\262\356\261\301"
+	.ascii	"\243\324\262~\tN\257\332\233\206\303\b\214\235\254_\002\2144"
+	.ascii	"#\016\250\304'Nn\021*\"w\371\332r\324\025\304\243\230\027\330"
+	.ascii	"c\225\302\354"
+	.string	"oY\342\\\026\351\272\311\246\314\351]_\262\245\330\224\033\207q\217\022\256\207\353m\354\025k\201\330\307#k%\267\317\320\353,\f,\310\306\220\300\254\247\306\230\222\244x\277\336,-,\221\030Y\277e\303!\343\312\n\350*\312\r\244,\025\023b\016\241\254\367\252E\366C\326[\325\302)\271_A]\205\\\257\326\333\365\356xu\274^\357V\213}\263^\254b!Y\\VE\037D\340>\210\277}\020G\366A\344\355\203\030\262\017\"n\037\304\332>\b\036\373\177mL\3418\021\373\223\372;\225\201p`2c\214*\353\267\306\207\277R\313\035:J9\262\246 \352\245\321\246\243\264\225\365\377:\375\245\361\277O/T\026JJ\220\303\b\213\254\337\251\266\351\276M\037\376:\355)A\202ld\335\3622\275JH\212Z\364\310\372\250\367*!\343\027\351]z\223\336\031-\366Uzc\374=ze\034\365^%\244N;\205"
+	.string	"A\202\264\206\f\367\224Wi'j0$Hk\310\360U:\216\275F\023\360\370\3041\021\001\344\202\264\206\366\020\035\0272^\215\034j\233\356A\314\330/\214\345\027\236QV\326\007A\264U Y\024\313\2066\033O`v\0169\204G\222\026H\0314\276\216Dtz2\320\214\243\223\027\biw\267\tV\304\261\020\244\343[\220\025\227a\212\214#\033d\305\345U\366\002!Qd\034\023\360\304\361\222\214\343`\220\025\227\341\313\342%z\203^\241\367\305[\364\252xW\274?\257\317\353\342\035z[\264\330\027\b\331v\344\016\222\347\005B*!\331PH1\264"
+	.string	"(%@H\"o\317\016\216c\330\213\342M1\001O\0347)\035\013\203\254\270\f\215w/\0202iI\366\005B\372@\312\361\370{\201\2203\220H\023\240\210\343\035\245\343\220 +.\3038\216\225F\177Bm\023\274)\336\302\341"
+	.ascii	"\2632d\210)\353\1778\262_\036\b\2304\244v\370\262\376\007\271"
+	.ascii	"}\207\314+^\257\\\340\t\312&\276;o\334b_\235\236W\007\251\207"
+	.ascii	"$D!\305P\003x\200\262\257\016r\312\211\024\257XqL#\311e\n\252"
+	.ascii	"*\322\330\251:\246\255\377A\306~6d\002A\2337\245\200,\266\301"
+	.ascii	"\035HB\244\021\344\222\tx|d\020\342#\360sj\202_\331l\007m\236"
+	.ascii	"\032\013oaY$!\262\311\347rxe\221\204H@\b4\200\021$\225dx\210"
+	.ascii	"DD\026\"\243 \r\221P\220R\220OZ,\222\020\351\304\210E3<d\321"
+	.ascii	"'An\237\204\266}\022\320\366I\020\333'ak\237\004\034\373$D\355"
+	.ascii	"\223\200\244\304\207N\240\021\241\254O\002\013?d\222\026\213"
+	.ascii	"\374C\036\331C\3661\271\372C\"A\366\321\020\341\016h\312\233"
+	.ascii	"a\361\207\022'h\256\376\b=\366\217\354\343\203\247\210)M\341"
+	.ascii	"C\036Y\216Y\375\320\310\372#`\355\217@\265?\002\324\376\bI\033"
+	.ascii	"\231g\354\261\302NE\326\310\"\037\216\304C1\365S\2245\007m\323"
+	.ascii	"\375\b0\366G\030\332\037\001\205\020d\035\335\306\301\227$\227"
+	.ascii	"\025\202\244S\213\375\262F\322\271\177:A\242$A\002\201\223b\004"
+	.ascii	"g\225\365=\310\355\267Xd\034\022\256mk\205\2177\020'd\034\311"
+	.ascii	"(D\212\274\310\372\204H\267\377\310e\337\230\033\220\254\177"
+	.ascii	"\244\333\217%\220\221\370\351\007\262\rY\350\207\b\226\365=\260"
+	.ascii	"\355{8[S\"\026\003\233\365=x\245!\325Z,\262\007\262\007r\t\351"
+	.ascii	"Dt\200\245\036H($\032 b6\216\343\230\017>h\261A\246\f\272\232"
+	.ascii	"\013i\266\344\352\f\311\003\211m\261H\264#\321\2204\2207jH\271"
+	.ascii	"BC\342@n9\211\220\215?\200\340\203\017\340\237(%\235\255\257"
+	.ascii	"\310\262\026\2134C\222}!\307\240<\330\002\002\36424Cv!wL\300"
+	.ascii	"\343\003\203\234\222\354\006B%g\303\325\367pc\377\3101\244\330"
+	.ascii	"\n7-$`\310\260\027\306Q\236\\\326\367\320\264\301\336\006a\241"
+	.ascii	"\260\313\372\036b\354\267\3303Az\035\260\212\210\221X\326\367"
+	.ascii	"P\264\357\241\305\276\007\025\033\271\205\314\201\304*\242\205"
+	.ascii	"\324\321b\221[\310\254\255\024\206\004f\227VZ`b\256\276\b\207"
+	.ascii	"[w\365\244\335e\344\025\322J\t\2504\267\225\365E\020\334\027"
+	.ascii	"\341o_\204>$\025\262\252\305\"o m o \243\220S\023\360\370\304"
+	.ascii	"\260\024\005y\243\030e\360\204B \300#\21582*W_\004\260\375#\247"
+	.ascii	"\220R2|\332\244\030\351\216\216\340@\326@>\301\177,b\300\254"
+	.ascii	"/\302\326\276\bU\373\"<\355\213`\304\204lb\246=\215ye}\021~\230"
+	.ascii	"D\350\331\027!\336\017\001\312F\"M\265\307\"\271\262\270\254"
+	.ascii	"\037\302\340>r\241\224\346\223\365C\270\333/\341\007)$U\205\204"
+	.ascii	"\201\214\321b\221F\310!56\244\021\222\b\371b\202\025q\374\264"
+	.ascii	"c)\004h/\210r\315\360\320\310\325EH\027\314\0268TTe\375\020\230"
+	.ascii	"\212Bx\261\017B\"\0202(\027\241Q5\001Z\262\017B\035rE\273W\030"
+	.ascii	"eE\326\007a\r\351\003B\331>\b]\373 P\355\203\240\264\217\206"
+	.ascii	"m\323=\b+\366A\330\331\377\300o\267\361F\224\262\305\306\242"
+	.ascii	"\210Iy\321\007T\214&\267\303\035\345/\352\007\212\254\243\374"
+	.ascii	"\372(Gi\341\212\350\236\2546\224m\b\326\367"
+	.string	"G\226\367~\222\205\222K0\030*v\262\326\337\205\233\360\206\332\223\254\235|c\355,f6m'.\353\177`\267\335\252l\330\025\\\013\264\0253\340v\212\240+\244\"WK\324\214\324es\b1\336A\251\312\352\262\242(1\376\262\202GI\262n\325\021p\f\005\232\320\335\241\215\273(TWq|\035\374\202\333=G\331@1\242C\267\312\317\307QoO\210\021n\353 euY\320\224\354\306n&\273\310\376\261\203\354\262\215\267\3536\220\235\266\001\367u#\331z\273\311v\333{;l\243m\272\275\266\301\366\330V\262\217l\276\255\266\305v\327n\333=\366\335\336\332f\333\310\356\333\331=\267wl\257\315\266\007\367\331~\333D\266\334\376\332y\373o\303m\262\355c\017\331I\266\337\026\262\005w\340\216\333<6\327^\262u\264\330m\267\257\276\261v\326\263\221\222+\267\352\230\204M\206\237\361\216\320\212\357\207\021n\253"
+	.ascii	"\312\ne\377\354\266\322\256*^\337^\340!\222\215\343\330\005P"
+	.ascii	"\342\325Q\020\354\250w\304\315xwLT\202\301\202E\266\220/\307"
+	.ascii	"\216\223\330\244L]\271UG%=\256\216zZC\256\234x\351\262\375\343"
+	.ascii	"sc\310\225\021\216\007M\206[\265\355\216}G$K\035\2258\216j\273"
+	.ascii	"r\253\230\220e\301\027\2067\214wGD\246\261&;\214w\307'\331\b"
+	.ascii	"\207.\033\342!\305\347\347jE\213+\343\335q\312\022\216\272m\267"
+	.ascii	"\255\334\262F\270m\267wf\\"
+	.string	"\305\361U\t%\211\037\2136\326\377\300l\037\257Z\027\367\205m\323\375\007:\366?\250\261\377\001\214\375\017R\354{\320d\377{)\377\355\244M\365\242.\356G\3266\246\260\370!\226\365=X\262\377\357\032;jKm\032-vO\355\247&(\246\017{jC\331`\232\272\332S\333\251\004#Pq^F\033G\203{\257\276\007\177\373\036\354\355{\240\267\357\001\336\276\007w\273]\373\360\275\244i\024\nee}\017\352v\353A\332\276\007V\373\036@\355{\360b\337\003\236\375\016\232\354w\200\267\337\001v\277\003\256\375\016\230\366;`\261\317\201\341>\007I\3669\020\262\317A\332>\0079\3669\200\332\347 \306>\007;\373\033"
+	.string	"\356o0d\177\203\263\375\r\266\3667\260\261\277A\214\375\r|\3665\200\262\257\301\336\276\006r\373\032\230\355k\200\265\257\301\322\276\006E\373\031@\331\317@o?\003\267\375\ft\354g@c?\203\242\375"
+	.string	"D\331\017"
+	.string	"\222\375"
+	.string	"\310\355\007\200l?"
+	.string	"T\373\0018\332\007\300\341>"
+	.string	"\366\366\001"
+	.string	"\267\017\200\254}"
+	.string	"0\355\003\200\305>\006\205\373\210\244\205\243Z\311\300f}\f\262\373\030\360\355c@\267\217\301\331>\0067\366\263yG9%&>#Y\377\004->6\254\266\260\257,\227\332\325\227X\366F\221\253\2555\266\035cY1\264\035WB\256\004\263|d\207\034\341\216m\307\270c\220c\221\343\334\021\357Xw\004r$rt;\n9\332\035\337\216wG\272\343\217\026{\224;\256\375\310v\364q\224;\352\350\221\215bUW\210\343\016\fL\356\330u\364*^\257v\032\n\262\354Q\3568v\354Q\274\2761"
+	.string	"\315+\033\307\361Q\356\230\303\356I+\3130\216\257p\027W\214\260\rt~k]\334\017\332\246{\f\226\266Zn\t\253\260\246d}\f\200\366K\270\246\265e\321\216fG\036\305\353\025R\205\224\333\021{<;\246\265\330#\332\261,\243\035\311\262\321\004(\342\270i\211\231\364#\345e\034R\342+\262\365\221G\321\305>\352\3711\312\372\027\360\355_ \267\177\001\217\375\013\270\366/\310\332\277\200i\377\002\240}\013\226\354[0d\337\002\264}\364\212\302!\216\317\254\332\370\330\262\276\005Y\373\026,\355[\360\263_\301\223\375\n\374\366+\220\333\257"
+	.ascii	"m\277\202\033\373\025\304\330\257`g\237\202\276}\n|\354\377X"
+	.ascii	"u\024\242:\3328[\002\226\226\365\224r\b\342\213\243\254O\001"
+	.ascii	"v\377?F\035i\034k\264\330\243\324\361\311\251\235\373\272\212"
+	.ascii	"\343\263\243\324\021\252\235k\363\216R\b\022\226\r;J\035\233"
+	.ascii	"\244\264\224x)\363d\200!m}\n\232\366)\230\261O\301\213}\n~\366"
+	.ascii	"\177dZ\222\322\300\332\221\265\322\273\244\356\313*\353O0\270"
+	.ascii	"_B\321\361\205\337\325q\206\361j\357(\343xt\214qD:&\265\330\343"
+	.ascii	"\214#\f\243\343\013\250%\307\031\307\240#\021\224\222l\224\031"
+	.ascii	"F+m\330\346\035\305;;$\210=\345\330ry \355\265%\365'H\262?\201"
+	.ascii	"\333\317\321\005\262i\006\217\235\254?A\332\376\004\327\343P"
+	.ascii	"\226\202\207\004+\353O\260\265\205&\240\332\377\021\350\370s"
+	.ascii	"\3749\2668\262\310\312cs\222\365\221\305\177\3649\256\310@8\f"
+	.ascii	"\035\t\274\221\265J\334\272\2709n\233\3561\305\207\037U$Y\260"
+	.ascii	"\300r\222u\233xDq\354\0213s\202\221\365\221g\204\021\246\241"
+	.ascii	"\254?A\322~\313f\350v\025\307W).\3421v\023\217;\356\224\026{"
+	.ascii	"\324q\243\024\326\035u\334'\331hi\214\343&!WG\035\027\312\217"
+	.ascii	"\354 \341\220\017G\035\367\260J\213LJ`6\016\306R_\202\354\276"
+	.ascii	"\004F\366%\260\333\227\300m_\002\265}\t\306\366%\340\332\277"
+	.ascii	"\353\304\035\264S\242\004+\353\017\203.\023\027\260\315S\323"
+	.ascii	"\\>\232\270\202-\326\035t\263\356\240\033\330C\353\253\320\260"
+	.ascii	"\350\243\307\003\313\325\227\340\305\276\004(6\340\3352\236\340"
+	.ascii	"\222a\326\217@\312\376\335%\024\\Sd"
+	.string	"\225\270\177e>\205k~w\377~7I\333#\003\341@\005\303\005^\326\310\266\351\266`\037\356\3721\367\334\bs \351C\3661y\241B\3175I\203\302wd\213\215\220+\353=}\214\003\222\005\312\372\021\004\356\227`'\343\n\317-\342\346\271FZ\254\253\347\022\0312\243\310sw\267e\217J\334\202'\351J\317\255\273[\233\247\026\243(\013A+\213*\354\203\017\362\335\214\"?\257~\004J\366#(\262\037\301\334~\004o\373\021\254\355\337\025B'\002\020\0345\\:\267\334\024\317\360Q#\310\\\021\037\252;\270\273s\256\\~A$\325\303\225\273\013d\355\311\034\242\033\247\244B\202\207\224\365#\310\332 >\334\205\223s\202\362\346\272\271n\356\017\267\255\250#h\360\017F\021uf\304\207\013\306b);\307\346\256\345\037;\274\300\334\265)\271i\210\357\255\347\256\207\253F\210#\315.\3534\346\016T\017V\326\217"
+	.ascii	"j\243\2719\334\261b\331\020\r<Rx\270g.\266\305\272h.\331\335"
+	.ascii	"\253[\346V\241\2717\020\335*4\327l\312\373\267\027\245\306\326"
+	.ascii	"\217\240h\273M\255\213\373#m\323}\004<\333\035\373\335*\027\207"
+	.ascii	"+\2265\210B|\222uX\335P\026I\326\207 \273\377\273;\\/\227\313"
+	.ascii	"\325\341~\271]-\326\005s\265\300\226d\267\f\257\254\002]07KI"
+	.ascii	"\266\007\340\025\230\213\305$\033\307\327\030f\337\023\265\272"
+	.ascii	"\245>\004B\366!@\333\207\300k\037\202\032\373\020\274\330\217"
+	.ascii	"A\334\217\021\334n\214\335~\236K\345.\3519\"&\2026\366\212P\320"
+	.ascii	"\222\264\246\by\f\371\332q\245\334\032P\302\214\b\311:\nf#\024"
+	.ascii	"\242\312\3721=\366\213<\261\333\3043\304\245\341>\271N-\326\205"
+	.ascii	"r\225\236\267\212i>>@\2710\334\243\037<\352\240\\\031n\322\004"
+	.ascii	"<>\361\316S\b`<Pq\314\024D\260N\266v\231\332\2634\033\207Y?f"
+	.ascii	"\206\273\024+\341\2507\265\235\254\037\343\263\1777\311E\022"
+	.ascii	"\022dW\345\022\3053\330\344\352\334\031F\304\344R\324\f$\210"
+	.ascii	"n\214ea\013B\272\254\017\343\347\032\301\340\355\337}\341\272"
+	.ascii	"p\"7c\307u\341\026\021\246\300\312\332%rw\222\022Ud}\230\270"
+	.ascii	"\r\207g\344C!\305\020R\210\207\215,\233\237\322\225.C\262t\245"
+	.ascii	"\313\372\230\214w.\217\033\337`2#+htR,\033\332k{?\331lP\326\320"
+	.ascii	"(\005\205\024CH\027<+\214pE\316d\217\n\260\235\262\354Q\211{"
+	.ascii	"\240d\350\262$I.\217\361\317\270\004\205\024C\310\026{H\356\217"
+	.ascii	"\253\302\035r\201\334 W\310E\341\366\270-\334\024\356\216\273"
+	.ascii	"\302e\341\352\270>-\326\3451\"\3368\305\230\030\310\343\310\345"
+	.ascii	"1\216\031\237\264yj\361N\321\005XY\207C\f\343\370*\3655\205x"
+	.ascii	"\201>\f\3256^[\027\367B\332\246{\030\245\375\033\245\034\252"
+	.ascii	"\225-\371\273\306YH\334\254Z\2541\212\021\3125\216q\307\366\246"
+	.ascii	"\206d}\230\237}\030\024\233\320X\310|\002\344\244/\n\241\261"
+	.ascii	"I\234\334*\022\312\221\365_\226\030\007_\216\354\277\330\355"
+	.ascii	"\277\374\330\177)\333\177\361Z\242\344\312\312\214I\326y\314"
+	.ascii	"\344\024\260=\247\254\377b\265\377\362\264\377\002c\377\305g"
+	.ascii	"\337\345\320x\304\b\n @\214\354\267X\343\236\321\210\021\261"
+	.ascii	"\030\233\265\321\b\023\307\017=\032Y\033\363\262Q\342\017\"s"
+	.ascii	".t\373.j\373oD\3546(\333Q2\332\031\265MCCzh\r\251\033"
+	.ascii	"\3626\250\226u\335\377\033\205\3400\244W\204+,k\245\230\0225"
+	.ascii	"\214\264\240k\357\220WBmA\202\314%}\262\260q\234\021\210Q\256"
+	.ascii	"\255\213w\004e\255}Z\027\367em\3235\302}\2701\0169\226G\310\226"
+	.ascii	"\365\257oF\267\2562\032)~\334\350v\035\265\364\307\224uK\366"
+	.ascii	"\341\306\037oARHi\363\201\274\013{\003d\273\321\307{\224>\250"
+	.ascii	"\306hdm\\\373p#\233R\210T6k\013\214=\214j3\234\242X\244\335\250"
+	.ascii	"\3663\344\217)\252l\326\232\357\303\215i)T\321\3702b\215h^y;"
+	.ascii	"M\262>\273*\255\262BSY\337%\207\321\314X\326b\215<\214dW<\036"
+	.ascii	"\30610#`_L\247,>\030\256\276\213\215}\027\241}\027\026\3737\212"
+	.ascii	"\031\303\366\232\260Y\203\351@\274 EY\277\305p\377\004+mX\274"
+	.ascii	"^\355\026<VW9n\214e\263\262\021\217\332U\034_u\030\253\262\021"
+	.ascii	"\017\262.#\227\321\313\250e\3342~\031w\264X\243\016#\326\213"
+	.ascii	"\177y\360\0311\307\327\225Q\207\021GV_\3260\231E\203,KE\277E"
+	.ascii	"m\277\205k\277\245\306~K\323~\213\320~\023\312~3\311~S\310\376"
+	.ascii	"\215TF\033<\n\311\222\262\236\312\035\340\310\301$\3537\313\366"
+	.ascii	"K\260\313F<L\256\242\214R-\326X\303H\303X\243\305\213wtP\020"
+	.ascii	"3\002\366\2254Z[:t\365\233F\3737B=\221\305Iaem|\232j\233z\206"
+	.ascii	"b$9A\320\005\307T\243\211i\273\355\344\371(\006\032q\t\031\227"
+	.ascii	"\260\220\260OK\224\214IP~qT\326\306\244\317\345\2468\206I\032"
+	.ascii	"\231\262\305\2074c\004X\274\366\326\355\245x\221\365o\224q\224"
+	.ascii	"5:\"\230u\f\343\034\332\214\024Y\277\271b\277\r3\376L\031\213"
+	.ascii	"\214@hJvyj\311\320X\324\342\345\251(&\343\220\221\310hdta|a\204"
+	.ascii	"\321b\215E\306\240\236A-%G\331\270\312\331\"\243\020\n\252\343"
+	.ascii	"\030\221\023\275\245>K\341>K\222}\226\272}\226\270\375\033[\030"
+	.ascii	"Y\274\355L\241\310\332\270\"yd\206\023\270\254\317\202\266\177"
+	.ascii	"\243\217qG\317\251\220*\353g\303(R\016\241d\355rT\224\253\034"
+	.ascii	"\245\305;\314N\0014\2520\366\030Q\030S\030u\214\261\221\247\305"
+	.ascii	"\032wt\342\2132r\341\333\253\224\034\305c\2305\356"
+	.string	"h\304\003\fjey\305\361\025\031\204\266\303\243\242\317\222\264\317\022\264\317\262\263\277\202\270\277\362d\177\245\311\3765\024mx\b\327\242*\353'Ff\202FY\177\345\310\376\257\t\265\223\026\253\013\365\340\265\311\036\221+]\250\005[8\003d\345\330\3622\362\360r\221\350\352\257\230\355\257h\355\257\330\330\277\316\352@?*\2742\275\344:\360\327L4`\026b\016\236\305\005e\275\214[\027\267\315k\233\256V\362\341z\311\221\312I\254*k\t\364\237\366+\2626(\226\365\333\253\036\024X\022\215D\367\265X\355\247\217\\\363e\304\267F2\216\f\272\236\250\302\374\364^W\021U\230\241\221\216F\231\327\326\305\266\351~%\336W)\334W1\262\257\262\266\177\235\247\361\256Di_\232\210\276\323E\264]\213\325x\327\3278\366\241\303\356j\213\b\336\335\025\236\346bs\212\222\034K|r}\365\257\207\004\341i\372:\314\372%"
+	.ascii	"\211\362\313\006\321p\331\250x}\333*\320\376\262q-\334RG%\346"
+	.ascii	"\341K2\247\205h:]\327bu\020-\367\314\026D\277\305:\202&\334e"
+	.ascii	"A]\215lHq\320\253\257\022\265\257\342b\237i\270\317\244\333g"
+	.ascii	"j\355_\273\321\251\300\232e-\210\025EpKk\021E\2113\274\022E\211"
+	.ascii	"3D\323?t\233\306\3524\275\246y\350\036\372L\253i\037-V\263\375"
+	.ascii	"\272L\233ui\2606O\215\2058\300\023\304p\224E\2113d\323dY\350"
+	.ascii	"ms\212\022g\310\245\265\226\3108~\n\274\322\241\265\332<5\026"
+	.ascii	"\302\f\263\202Wwk\363\324\332+\256\303l\034\307lz,\343P\222\267"
+	.ascii	"4\233\016\323`/\016\270(q1\310\271\026b\331\030]\214[\027\227"
+	.ascii	"\204\266\351\236\351\263\277\224\262\277\034\334_\356\355/\347"
+	.ascii	"\266\366\322;Z\354\347\364W\314d\322\0212\275e\375e\217m\"\216"
+	.ascii	"\343\270\375\234{\374\234\373\345\216\375\345\324\376\022\306"
+	.ascii	"\3762\336:+\271c\364C/\353+\237\354+\373\366\225n\373\327Vz\252"
+	.ascii	"j/Ha\326/\301\tI)J\222\335\325R\335\225IH\224\256\241\2454\224"
+	.ascii	"\306\241\253\364\rM\245mh\032:G\213\325S\372\251-\203Q\344\005"
+	.ascii	"\236\013\277\023\364\224nr\313~\320S:\206\236\301\366\326W\304"
+	.ascii	"\020fA\030\303(F_y\335W^\355+\227\366\225.\366\225<\373I&\373"
+	.ascii	"I\274\375\244\332\376\265\214\353\031\2776\312\206\031\b\007"
+	.ascii	"\237\236\247\255\254\365\321\207k\031E?\"8\030Y\033\275\266\333"
+	.ascii	"6\335'\261\366\2235\366\223C\373\327E\327D\330\253W\221\254\365"
+	.ascii	"P\366\321DP/\353'y\366\3330\303\342\023%Y(\331i\002\036\037\030"
+	.ascii	"\302\376\262\255Y\253\326\346M)\200\013/JvZ\352\254\3041\215"
+	.ascii	"$W+\264\220\016\322?\232\205\006j\261\272EQ\312\213\210\305)"
+	.ascii	"\272E\361\260E1Q\253h\363\216T\342\236\037\201/\213\247<\245"
+	.ascii	"\245.\032\2161\321)\264O\213\325*\036s\215\265\n\035k\024m\336"
+	.ascii	"\3215.\202\333\364\310\306 \370@9x\304\017\311\325\277F\241{"
+	.ascii	"|\\\245\232d\255y\216G1\354Pd}xo\377Z\247\305\352\235M\350\005"
+	.ascii	"w\230\365\ta:*\250\"Y\037\316\333\207\207\354|m]\334\016\332"
+	.ascii	"\246{\270m\037V\333\207\257\3730\330>\334\265\377\342\223\354"
+	.ascii	"d<\033\342\244H\241\217w\355.&+\022\026\235\354\271\351\231e"
+	.ascii	"\355\244I\262i\b\r\356\nJ\326q1E\024)t\310\006\005\267\021\212"
+	.ascii	"2\031\201/\n\376\305l\221G\231\224E#*\353\344\222\017/\006\032"
+	.ascii	"e\3309U\0012I\226\t\271\330R\362\"\223\277\270$gA\374\330\220"
+	.ascii	"\312\032n\233n\361\357\303\213J\274|\016\277\262~\223\024\375"
+	.ascii	"\334A\243\032AE\272\027\375\376\242\220b]\021I&\232\302W\224"
+	.ascii	"u\261o'Q"
+	.string	"\361`\263>\234c\277\204!Y\350\005\226\320g\353\256\230\207\363\323\024\263\004\245 dQ<R\344+\032)\352\265\330\342\336\237\005\213D\036S\264C\246h\222x\025\307\327\275\274\"\013\241\220b(\356A#\362@\006\367\225\215\371\340\203\314\344\265D\360\325\1771\257\210\247\265Z`\365\212E^\304\333;\240\204\261e}\302\214\365\037\2314T\303\372\310\372\260\213\235\343\326\305=\254b\037\336\331_\213[\027\027\331\3246\335b\220\017/\322\371\260\360\271\221u\006m\323}\377\246\252\236\310\001\201A\024\004)\353\270\253\017\304D,\302\254\377\006\356\377E\267\342[\213-\302\025\333\036s\205+\256\025}\240\220b\b\031\024\305\024q\206KD\372\220\264\024y\013\236\006\203\227\366r\204a\240i\310\220\026\273%\267PO\t*\r\332\315\375\3740\314\372\030`!D\210\312 \224\220\354\316\035\242\215\302\271\271\226 3\2163b"
+	.string	"f\221Jk2\340\202T\225\245\300\266\304\265\304\265"
+	.ascii	"\311\341f\301\320\232bX\374\201!\267\005$\251\003\260\b\336\220"
+	.ascii	"\254\177\201\253\226\265\267\374hYky\323zI\035\350\035M2d\270"
+	.ascii	"\275\345mN\0275\235\305-mG$|vfY\267\3700\"\271P\262\305\366#"
+	.ascii	"\223SD\212\ff\375\013P\355"
+	.ascii	"_ \251E\255E\255eE\024\243\2757C\344W\021)\247\254\177\001\241"
+	.string	"\026l\013\266\005\305\004\203\310\261\037\026dY\377\002;-c-c-g\020\2700\2331\244t\305\343-gkYCL\262n!k1;\366HT\343i1k)s\221\004m\316Il\264q\350\302\307u_\025\207\340\020\322$G]m\264p\312\372\026\350\333\261\243%\fHQ\216\255\366oH\013\f\354-aP\242 \222e\335\362e\001\263\254\254\226\256\036.\224x\031&\331\fu\350\264h\275\245\253\205\253\307\241\240\026\327[t\024\031\266\3201\225S`\tIm\035\237\216;N\207\177Y\237\360\370\342?R\351\305\204OF\326\267\200V\013\216\267\\\265\340h\331\321OaI\0301Z\217\254[\254ZrX\240\252\245\252\245*\351GfF\025f\330\346hs\373Qd\303FK\022\tm\254\002\313\003(\313\244-.\353[ E\213T\213TKT~k\032\213\202\362\364\324\022\325\232\305B\037\262\177Q\274\210\374"
+	.ascii	"\373i\241\361\226\250)lW\246\254[\240\332)>RM:T\377\221\0208"
+	.ascii	"R\005\330\322\324\322TB\266\257\210\327\021\212\022\231\n\275"
+	.ascii	"\245\245\244_\253r\345Yr\230\315A\224\225\343\r\t\251%)f\307"
+	.ascii	"a[\210Y\245\336\013\031SI\355\224\277\256<+\262\027\177\321\""
+	.ascii	"#f\307aD\246d\327\312\306\312`\274EF\313\021\005\204\264=\265"
+	.ascii	"\034\265\304@*\321\261\325\344\310\263d\026\244\305\310\215\262"
+	.ascii	"c\006\306U\201+ \240\226\242\243U\0232)\357\234\336\023\f\242"
+	.ascii	"\267\024\t5 K\255e\350E\236\217!Y\267\b\t\272ye\375\n<\265\004"
+	.ascii	"U\240\250\245EK\213\022\256\222\254?\251\254O\001)-*ZT\264\254"
+	.ascii	"\220b\264\367\266$\023{R\324\342\363\226\025b6\206\256\376Zz"
+	.ascii	"ZzZP81\332{3<\376\310\na\321\202\002\353E\214\"\206Y\237\002"
+	.ascii	"B\232\210o\211\233\210-;Z\312E.\006\327\021\023\312\210\bJ\213"
+	.ascii	"\316[v\220\242\210z\232\211S\302\236<i\036\266f\261P\005\214"
+	.ascii	"\200}y)\203\354P\201\025\345\315\303l\330DF\225u\023J\026:\002"
+	.ascii	"1\335(2\344Y\002\324e\250\204\343)\022%)\353S\340F3\333\3146"
+	.ascii	"\t\305\214P\205\031\302o\2101\225\2237\t\001\233\222\b\241d\335"
+	.ascii	"l\362\271@.\240\265\301\377\310&W\227Os\260)x\234\241E$P\207"
+	.ascii	"F\013;\246%\177sI\023\220\354\252\r[*b\362&`_\240\f%\n\304h\""
+	.ascii	"i\"i\376q\240x\306\025X\226\344\315\277\"\021\265\024\211Y7\375"
+	.ascii	"\356\306t\312\026\315\240@\321\336\277\327\344k\315b\241\t\340"
+	.ascii	"\262\250\302\f\333\356\244Di\036y\223\317\255\256\316\r\307\004"
+	.ascii	"\016\365\364T\0063\020{\242\n\353R\n\"$\353O\200\t\2217\361\210"
+	.ascii	"\254\3001\345\3328>Jz\023\315\224\3508\313\272Y\244y\307WW\327"
+	.ascii	"\034\022\263c1\250\272,2\376\311\202j\016\231\323\361'\206\345"
+	.ascii	"67\327\244\203\022bt\362k\222\025\344M:\276\252\260. @\222~1"
+	.ascii	";\026\343\321#\213=\f\302\225\365'`\303\315\255\tGB\033\253H"
+	.ascii	"\343\361#\013\0172\261\322\321|{\023\256\311\226\304\214\206"
+	.ascii	"\317\004\210\324\324\232m1M:\205\307\241\030R\2033\232\024\241"
+	.ascii	"j\372x\263\355\235\222B\260\311\366\037I\302_U\216\254\233k9"
+	.ascii	"F\213\254\242\254/\201%\315\036\022\340k\2325\315\232\330\326"
+	.ascii	",\026\242\340\205\221U\030\004(\236\370\241\275\2115A\354\253"
+	.ascii	"*\353\346\331\3472TQ\322U\326M\036\031k\273q]!^\002y\315k\363"
+	.ascii	"\352\001\032XE|Y_\002j\315\261\346\330\fx\310\034\335_\326\227"
+	.ascii	"@W\363\253\371\325\f\223\322\201;\037J`o\206\355\221\365\371"
+	.ascii	"I\200\311\313+\351\027\323T\f\274\352+\222\224\363\341R\312\372"
+	.ascii	"\022p\301\305\245\2027\201=\250\270=\003\r\017\313dk\313\001"
+	.ascii	"ETa^eFvd\263~\004\210de\311m\"P|\262\262~\004\316\232U\315\252"
+	.ascii	"\346\025\020 Pq\206\232\211\231 a\363\306\233WM\253+\032\206"
+	.ascii	"*\232V\315\034D|\264\340\013KFM\251\013l\342p\265$`\342\323\026"
+	.ascii	"\201\251&\215&\215\246\215\230&\035A\022\354x\240\342\332\234"
+	.ascii	"h]5\243\336\264\321\234\362QC\312\214\254\233R0\223*\270\250"
+	.ascii	"\254\037\001\245f\215\b\254h65\233\232O\255Y,\324\002$\313\370"
+	.ascii	"\321\363\327tz\363\351\354\b\016\035\b4i\276x\323\250\371\242"
+	.ascii	"\271T\334\353Z\266\b|\212\222\361\346\322\233J N8\223\233\032"
+	.ascii	"Xl\326\315\244&RsF\363\350L2P\234\016\245\254\2331\2320 \260"
+	.ascii	"\244)\324\024j\026\025\276\301{M\376\204\232Do\026%\375(\314"
+	.ascii	"\2729\364\271V\007\034\325\2224\240\037(\351\327\232\305B\020"
+	.ascii	"\304\0315\3312\344\031\"\245+\353C`\251\271\363&\212\346N\263"
+	.ascii	"\005\024\273%\251\301\254\377\246\2127[\274\311\002\304\t\031"
+	.ascii	"k\013Gb^\326o\256h\3724S4{\232<\020pq\370\303fLB\033\253`C\221"
+	.ascii	"#\013g\226\"+\345\315\370\007q\002K\342\340X\024<\226D\226)g"
+	.ascii	"2\246\364\210\212sZ\236\f\031,\210\256\222\217\037K_Y\237p\005"
+	.ascii	"\205\216U\326\177@\023AA\026(1M:\202)\320iA\305\025\307\n\201"
+	.ascii	"\024a1<\013\0247\211j\307\217\216\254Y\236\270"
+	.string	"MOh\340ie\315R\350\036\301h4~he\315Bh\344c\332\370\373\362\311\232\305\311\231\364\320\300\262\313\232\245I;%l)\256.k\226A\343\223\366\360\255o\205\223\"\326\006\337\330\221%KX\002g\\\031m\254\355xc\001<K\240\326Aq\207\2305\013\0237I\t\320\225\f\343\223c\021\335\033Q\020>>\226\277V\345\312\303\227t\325\003\033\224\344,\177K(\266\300\253\254Y\374\216}?B\234\262f\351cA\002\345E\013\"H>\227\325s\204\302\254H\021\226\275\326,\026\022\221u8\304\213\311\307c\t\020#g\331K\241W%\2275\213\236\233\364\242\361`\221\2305\013\036K\036\334\304E`\023K\036\3346\243\252\260\356\0016\350\350X\210\330\355A\305\031*_\360\3101\305bw\026\"(j\\\227\262f\031\342&YM\271e\263f\251s\223\2149\356\002\231\262f\021\002\367p{\366\320\352z"
+	.string	"\271{\332\021\243\307\337\203e\356$\\y\366\340\004@g4V$\207\216'\303\267\263\314\235E\016\304\t\007\\\266@\241#\006\220%\"(DY\263\304\211\020\203\352\257*\353\263\320@\205\307\226\265n?\347\262\270\235I\313\002\321I\216\254Y~(\307\310VTe\315\322\006\337\310\342!t\341\203\005\330\234\216\254Y\330\002s\244\001e\375\007\254\330o\261,k0\217\246*#zY\377\001<,bg\271\262\210\261\2441\247\352\214\276\206,\275\342`\030\231\235%\355,X\020'|\356\330#\t\213%Y\263\240\235\361(\313B\260\r4 G,d,c\206Xg\321\302b\001c\n\211y\341\214\300\204\030*\237"
+	.ascii	"\311\026\261p\235\005\354,_ N\310XL\262\035N\210\262f\331\301"
+	.ascii	"\342\305\322\305\242#c\031\365\230\240z\262f\331\312\312\262"
+	.ascii	"H\235\305\006\213\024\213\325\027lg4V\244/)G\215\033g\261:K\016"
+	.ascii	"\020'\334\016\b\305\227\f\034U,<<F0\262f\241b\321Ib\245\030b"
+	.ascii	"\3102\345\007\005\305\022\325\036\031"
+	.ascii	"\355\275y\265|=\202C,4\316\022%\346U\370\302\256\251\211\305"
+	.ascii	"\2515\213\205\\^l/\253\264$'\034H,-\250\037\037JJ,K1M:\202\""
+	.ascii	"\024\031\355\275\265J\\WOY\263,9\235\231\351\re\375\033\240X"
+	.ascii	"\216X\216X\220\342\212j0\236\022g\234\005\351\327+\274\342\322"
+	.ascii	"\262f\221\221\261\274Z\2545\211\001t\026! \026\243b_{\215\217"
+	.ascii	"\232t\004\tp\b\227\265(\323c):\213\321Y`\2008\341L\266\027W\337"
+	.ascii	"N\326,/X\\\260\020\235I\336b\362#\2305\313\320\347\222GH\f\245"
+	.ascii	"X\202n\030bi\301\322B\211\210\027\247\225\305\374\261\002\314"
+	.ascii	"i\312\224\263\304SXV,\301\210\265Y)\033m,(\316\262\342,> N\310"
+	.ascii	"XL)\203nQ\262>"
+	.string	"\213\212\242\232\034\340\217\254YR\254\260\355\374\3308\313\372\036\020\247|\270\310\232\245\007\226\252\032\262B(k\226\035\026\236\343\021\324\037S\026\nz\375f\250`\321\261\252Bd1\344\007v(\224\365J\"\241\340W\234\b\256H)\032Q@\374\023\353\230\305B.\221\021\230\020/x\307\037\227\334\223\257H\371\312a\353\303\357j*\353\225(PV\fW\n\0378\004\316\020)\353\025\302\007\226M%5\031\004\364\373\212\022\277\225\300\267q\034k\031\215\025I\376\254\310\333\261\344+\201_\001\004q\302\347\276\360z\002\231\374)\t\005\271\236\262^I\202,Ra\365\346\002\n\305[\334\335W\362\356V\372\230WK\314\273\343\331\241\023\031F\276\322\367\025>\020'd\254\243\324\021\266\261\254W\216\354\255\350e!>\263;\037+xE\330\200|%\b\220\025;\246\032S\004xF`B\224m3v4\321}\305\356+C@\234"
+	.string	"\337\b\232{*\314z\245\356\313\243\273\270l\326_\021\362jE\235ue}\021\266\231\021\021\321\312\234\034\016\036_I\343\261\002\307\364\321\306\361Q\314\323\023/%\035\005\215\276\206\030\306>G\035\274m;g:k_\201\373\312\033\210\023>\2474\305\002,\353\025\267\2676\232`}\262\376J\333\312\217\037\211\304Z\342cJ\326\027\001\264W|\210\240\024\305IJ\326_a\2332\202CG\326\271\375\234\273\322#\013\365H\313\222\221\365\212Z\026*\n\355"
+	.ascii	"\n\3027\212@\355\361d\275\202\375\212\213\037\t\217\315\245\330"
+	.ascii	"\313z\005\255\255\021\224g\344\354G&\005o\030Qe}\021>\3736H\371"
+	.ascii	"\372Z)\273\200\036\323(\na\332\365+etF\262\214d\275B\006\307"
+	.ascii	"p\341\"m\311\312X\2147\264\262\261\257\2109yS\002\266\262TC\344"
+	.ascii	"i\222\365m\b\\\331\343\342Z\361r\302E\211\313\202\177Ug]_\361"
+	.ascii	"rR\224\243-\353\023\3021\376#a\022\253Td}\033\2569r\254l\305"
+	.ascii	"\334\301E\211K\242a\307~\264\276\262E\330\324\307\224\365\tW"
+	.ascii	"\262\376##8\222\242\313Z\301\312*\243\222\221\365\312UQP\251"
+	.ascii	"./\353\333\220c\305\312\006\245\025\252\025\252\225\0331M:\203"
+	.ascii	"&\340\351\221\215\255u\3455\251\372\312\215e!S\222\322T\253\346"
+	.ascii	"F!\203\001f\024\025\2652\365bO\274\024v\025\3473D\352+Ss\205"
+	.ascii	"OBY\257\324\260\241h\351_Z\201j\315b\241\022FVa^q|\324\301\r"
+	.ascii	"\331'\246\247\257@\001f\001qa\225\365\212S\007>r\300\031f\275"
+	.ascii	"\322\324\301q\311\b\226'\353\025&\2359\266\274$G_\231q\264\222"
+	.ascii	"d\034+\032a\213\fA\372J\322\337\240\016O\326\207\255\306h\340"
+	.ascii	"e\275\"#\310\320W^\f\255\030\031\305\342\230\207\204+\217_\354"
+	.ascii	"s\324\301\261\320\211\024\337\n\214\257\030\371pa\273V\212\276"
+	.ascii	"\342\342G\"\343\226\242\236\262\276\003~\354\177\205\350G\036"
+	.ascii	"\327\372\220\256\262\276\003z\354;\300k\245\305J\213\225\240"
+	.ascii	"\030Iv\204\007\337\n\320W\202r\331\037]S\326+?*\207p\026\022"
+	.ascii	"\254\f\007L%&\256\254\210i\322!<\0061\242\362r\227\360\254\270"
+	.ascii	"\352\371\312\212\257\370\2008\341siCzGY\177E\2052\350G\266)\260"
+	.ascii	"\300\234\262^A\261\222b\247Hb\345\345\200\024\034 \201\310`\222"
+	.ascii	"\270\302s&=cdJY\257\350\254\354\274@\212\260\320[\331y\341\210"
+	.ascii	"\316\224\274e\275\022\327p\250b\250b\250\202\330\262\r\031y{"
+	.ascii	"gd\355LI\271\n\"L%CHV\326'T9$\022\205\247"
+	.string	"J\345P%\n\f\235\036\037\261\022\352O(H\005J\276\252\250\202Q\266\244\260Pe\2605\213\205Z9\243\032F^F\032P}OSN\234\250\f\266*W\236\275\243+2\267\276\246\254_C\n\025A\025A\225\301\230&\035\301\f\260\232\372\212(\t\262\002/\353\301$D^bK\002\003\353\216]Ic>\332\2300\371\261\314:\"\367\204K\211\022\266\226\311-\252F\326o\300\322\376U\222\250$QA\"\245v,\253:B\314\372\rP\261\177\025>\025>\025$1f\261\316\022\311\230\2127$\325RvE\221-H\227\033\013\225\276,\224D\374\013r\030\250\247\247\262\227\3438\216\257\216\330\304\240\253\370(\251\003\375#\bW\230\221\253\354\345\244\005:\321\200\344\356Ne\004;\301\257\254\227\216\367^\374(r\025\274\032H:aY\237\320M\312+,T\313\3724\024\261\263K\372\351\215\200\245#\035\023J\312\3724"
+	.string	"Q\251S\251K\034\273\362AGW\304\263\240\316\211\006\264\2719e\222B\013\346\260\222{SaAY\237\206,\0258\0258\025 :_Y\257b\023\037I\244\304]\005H\240\253\364f\304\005\rJ*>T|\250\270\341\351\375\270\212\033\374\244G5\227\265J[\322-\355\320\f\n\rD*i*i*kG\031z*=\256\262Vl\213\002\0051k\025\265\244\033\031O\225\034\r*x\360PA{\342\302\035u"
+	.string	"O\tlb$\353_\345\354*hL`\036M\310\304fpB\246RFv\275\302xz\3733\244\201\251\210\201\025\361\302\302^,\235\257\254\327\f\327\375\031\262\270T\274\270Tv\354P\351R\351*\342\355 \252\261?\203\213\255\255\"\236\207.\235\031Z\250d\251dy\320\2015\003\317\376U\256T\256^\274\230\246\230\b"
+	.string	"m0U]\227S\326\227Ap\377*9Tr\304H\241ky#j\3115\353\313\220\247bC\305\206\312\r\020\304\234\276\262^*7"
+	.string	"\333\256'KG\262V\241\222A.JE*\252F\r\025%(f\3732\330hRyjR\201\202rr*\342=\331q%\303\322\276\f?2T\226d\250(\315\230\241\242\324\306Cq|t"
+	.string	"(3\256T\222\256\242\004\267\340\341$\227\265\nR\013'\347v\344\220\001P\366\031\200\367B\305\350\205J\214\0300`TpH\364\266\317\200/!\025\"!\225\242\253\024\251\f\251\f\r\221\301U\3553"
+	.string	"F\013\025\240\026*?*?E\274%\235\016\003X\354/\300p\253PY\241\242\210\347\306q{m\022\032\212\217\206:P\361Q\361\331\261"
+	.string	"\311i\001\201\373\013\300\333\277\n\212\026\253\202\342\245\361\241'\336\271\341\036\301\320\232\022\206\344d\311\024\017O6\312f\361\320\005\260\242\304y\305\261\020\020\264\221>!1\262\376\002\204\366\257\242\243\242\223\215:h\332\331\311`\n\f\253\302W\f/Fb\326\217\241o\377L\304\267X&\"\223\210"
+	.ascii	"\331#\020:@ls\313\2329\345\357\321+\243\311`\240P\326\217!o?"
+	.ascii	"\006\"\207o\261\314"
+	.ascii	"\303-\305\005\t\211:1\250\355\237\t\005\313\204\262\243\3044"
+	.ascii	"\305E\030\024\301\250\332\242\033\304*\222\365c\230Q\330b\231"
+	.ascii	"\205\314'\210NE\266d\223\026\237\330O\326\217\201\305\376\231"
+	.ascii	"N\234\264S\220=\361\223\215W\016\206T\226a\034\013\001\001~\372"
+	.ascii	"y\262\225\365a\250\033\034,\342\001\200\f\316-\233\225Q\006\203"
+	.ascii	"\331\376\231JZ,S\t\023\260\003\2738\250\270\035 ivY3\001\177"
+	.ascii	"\346\022&\223M\330\302\220\222\3040\353\227\241\326\305\315F"
+	.ascii	"\332\246{\030\250\366\317L\322b\231I\222=:h\212\213P\270+\322"
+	.ascii	"\312z\252\3339\222\365a\210\201\004\211\005d\2020\304E\2120\371"
+	.ascii	"\336\030:G\316\344\333A-\344\230\262f\356\271n}D\236d\3154\302"
+	.ascii	"\324[\272(\234r"
+	.string	"C\357\215\022\243\250J/\257\235\221\306\265\246\324F\321\251(b\342\035a\f=q\301\227\365_x\302\254c\3261\211\334a1\355\316$\362\352\225\361\320e\315\034\222\261\342xl\360\205\277}\346\\\313\244\243k\341\332k,\344\332 \022\002\302\322/0\310E\326\177\301\310~\333\302\271g\306\265L9\246\034\236\316\013A\366\333v\212\013\007\027\001\241\340\0177\267\"\036L\335\013<\332\332\222~H/\340\330?\223\215\311\226D\323f\261\3161I\223\257\302\243\2758\256\254\377\302\024\263\007\263\207\026\326QZ\032\214\222\323\013)\320\320\"\200K\344\301c\311\344B\223\257/f\331\022\206\340W\326\360zf\231\253u(\304\2265\223\254nF\335Z\326\3141\246\230&b\304I\r\261b\r-\0351\230b\314\260\270)\203\202{\356\326\324 \0200\227Hv\221\304\006`\326w\201o\377L\257\026\313\364r\351`h\212\211P"
+	.ascii	"KJ5q#\n\302\305U\001\231`\033\026\026s\353*\022\270(cj\235\271"
+	.ascii	"5\227\034\344\201\364\22653K\373]\005\366\271\020fe\005\003\243"
+	.ascii	"lk\337C\313\274\301\254b\342\370\\\033\027\305\355\n'\302\303"
+	.ascii	"\254\013R\373.\034QQUp'\350B\013fT\213eF1\247\214>q\374\002\205"
+	.ascii	"C,\246T\276\203\262\366\204Yc\207\361(\003sc8A\273\312\372-\024"
+	.ascii	"2\241\230PE\274\035\307GA\275\026\374\230NL\247\"^\223\026\206"
+	.ascii	"015!j\301LI\251\210g\001\223\340\027\022R\322\257\211S\013W1"
+	.ascii	"b0eD\200\007wt\246\214\333X\002CI\0134\2300\2300\336:\275\026"
+	.ascii	"f\354\237YT\304t\001CS\\\224\202\026\017\250\270]\003E\022\261"
+	.ascii	"\367,\267\330+\017\271\254\337\302\020s\005s\005s\350\005\242"
+	.ascii	"\303\034b\261\244\206\217\254\231A\357Z\321\017\300\254\231@"
+	.ascii	";zY:Y\237\220\371\243$0\306\021\346\017\263\305\021<\245\260"
+	.ascii	"\264=\265%$\203\311\302%"
+	.string	"S\032\245\370J\313\372-\3640U0U$\375d\350}e\275\b\231(\230(\004Y\340c\3620y\360\202\354\237\251s\246\31621F\345\032C\311\270\212\343$\020\224o8\314\256Y\237\005\263\375/\245HY&\026}\232b\027!h9\221\215e\037\237\262%\232(\331$eo9e\211h\203O\260\251\350\305\026U\227\365Y\270ZFYFI\372%\t\273b\341i\331d\331di\b\303\351+k\370\344KC7\277\263'\205\307\272& \243BBx\205\215\301\254\023=T(\304\013\210\223\242\024\3024%LY\237\005\027\373_\n.\005]\027(\3309}e\rYh\021\030X\304\203a\020\025\376\375-\231|\271O\210\276\262\206\313%_2I\272M\3358\363\221\365RI\026\3722\"\265\024bo\377K?\277\214\303\215Md\273\202\262k}}I?\267\t\\\b\254\345\221\345\221&X!\232\214\030)\342\035"
+	.ascii	"\354\350*\204\213\273\273e\036\f\026\021\336\227y.\213\0369p"
+	.ascii	"d\275,\222\261\212\366\210\274B\364,\345\226rK\273\272\262\257"
+	.ascii	"\254\327\220/\355\222q\205.\276\262^\326)\247H\001+\314z)dI\307"
+	.ascii	"\\\373IR\204\256\335\233\3639\242\013b\366\343\364uf\203H\023"
+	.ascii	"\266\345\234\221\354"
+	.string	"I[^b\326_\301\t\033\3332\016\236+\373\312z-\341\276\214c6!\023\324\312z\371\246T1\346dJ\326K\267\345\217.\026[b\313\037H\256\336\n\227?\226mA\322\232\210\200!\335v\244\230|\030\261\212\206r|UY\177\005\274\245\331\322l\331c\t\207\265T\373\262G\246\363\361Q\221\3652\355]s\235@i\002\312z\211]\242\r2\351 -\321\214TOo|K\264\345Y\021Oa<\305\334\003L\342\202\207\221\306\333\204j\360E\334\365\312\244#\352\321\325\265\034c\356\300\372\312z\211}9V\374a\"\372\313z\031\226\277v\020}e\275\004[~\3518\037\302\245/&\231\234\022\332\327\016\035\246:\303\030\371\306[\020\267\245\2271\310\312\nE\326_al\251c\251\243\210\307\002Co\205\254\0337\226Z\314C\275\257\254a\326\227ZM\244\364\324\262^b\275ka;B\022\263^^-\255\006}"
+	.string	"\275\310\372\204K\253\241\255\030\207K\253e\016)J,\274\214+\2205j \211q\350D\375C(\266\221\365W\240\261\204ZB-\251R\020\223qe\343K\252\226$MyY/\247\262\320\240 \024\250\254\2274\226RPr\374,\245\2265\004{\262\262\236`\200)\261/\353(=\370\030\2510v2\013#$\313\372+\374,\231\226LK\247\3378\222\t~e\r\227M_:e!\343P\223\025?V\350Y&\265\330e\322R\211\260\254\310\226l\002\2223\202\227\365U\200\262\377\345\214\267\330\345\214\3445\246).B\241\313\bU\030_P\235\221\254\257B\337\362hyT\304\253\240\253\354n\377K\243\267\330\245Qr\254\203\246\270\210\204;#Pq\371\006\336\025\232\217\027/\212x-\t1\317\036\\"
+	.ascii	"\\\350\251\300c\377\313\"\354\262\250\275\253\241\215}Z \361"
+	.ascii	"\312\3061\021\020Z,/-\240\254\257\302Rh)\264\034j\315b\235\245"
+	.ascii	"\324\327\322\206Q\326\331\222>\022f\324\006\305\202\305\022\350"
+	.ascii	"\016\353\347K \246\224\0233\302\254\227-\262\221\233cE\0139\030"
+	.ascii	"K\024K\024K\037wNO\305\227>\331I\025\333V\326\313\024H\035<p"
+	.ascii	"\250e}\302wm\356*\310\226\365UX\221\230\270\344i\2378-w\276\344"
+	.ascii	"\261\201\304\311_\326K\235\244\033Y a\224\254\227\361\003]\240"
+	.ascii	"@r\224q\260(\002\262\224\365\025\360\344\360P\211(\345J\312\225"
+	.ascii	"\210\207\205k:\224<y\242\204\002\207\365\225\3652\274\022\312"
+	.ascii	"\220\235$G\262>a\007,\260\205<Y_\001C\b\t\223~G1\235\267\301"
+	.ascii	"\026\253\034T6a\031\212\343(\035\017t:I 0\265\252\230z\274e\311"
+	.ascii	"&%\254\025TY_\001i\331l\021o\004$=2@@e\222V\231\002r\354_\251"
+	.ascii	"D\251D\271$\306,\326a\221\262J\002!\205k\323\265\b$\251D\362"
+	.ascii	"\342\020F\326W\200\323V\"Q\"Q&A\324\373\312z\371]\231$\307\365"
+	.ascii	"\206\002\206\370\370\224I;n\261\260\024\300\203\207\247\334#"
+	.ascii	"s\372\312z\031\271ro\271D\316KH\326J\275\214\005\345\207\307"
+	.ascii	"]\326\312\274\317\331\025\201bJ@\222\273;e\322\326\211-\210Q"
+	.ascii	"\226\2006;\273\243\030\034X]\235\322H\220(\001SooJ\272\b\300"
+	.ascii	"\364\276\262\206A\256\244\353AR\230#k\345\034\\\307$P+k\245\234"
+	.ascii	"\022\b\212&LB\200L\345\025\322P"
+	.string	"\002Q\306uu\351\355]c\314\264\226\224p\305\244&?'~Y?\001L\373\355\216V\331\326b\225m\312\037H\2378v\021\302\023\301\"[\262\251\210 \033V\326O@\321\331\231\222\r\210\336W\326k\355J\266]\250\205\255\312Z\331\243-\362\363\303\225\265RM\231F\006&\325\226\246\327\262\260s\3124%6,\005S\320\221W\206\030\223\013\264\234\227Bk\nZ\326O"
+	.string	"\ne\2302Li\006\343B\257\354J\263\024VO\262V^\241X/P\220\t\031\023[S\222)\307RdkT\335\265Nz\260\240\313Z,\007y\222#k?Y\037\001\207__J\257\035_\273\364\020\220dkK\351\365\001HW\213Uz\301\\AnHe\255\344z\327\262\\n2\262V\352\3108\b\003\003o @.+\253\210\007C\246\207"
+	.string	"\266\253\253:,\004\210\345\310\241\206T\212\3429\312\272q\343\207r\255\307!\331\024\025U\221\255]\351\211i\324]\3051\021\020\222O\342'L\262>\002\226\246\246\212lE\237\246\035(\017\214\204\006_\030\3061\021\020\336\277\266\2528\353\037@\260F\215\"^"
+	.string	"v\b\366\321\240\221\364\333q\314\2447\367\364\2444\302sJkjR\016\355\370jW\326\265\264\244LR\322\3131c\2062i\307q\254\243\022\363(ar\205te\322\236\222\204\251\360"
+	.ascii	"L\312#"
+	.string	"\345\021\214\335-X\331\001\214^\274P\032\265\261\017\235\023\214+\215\364\232\222\b\311\372Y(\314\nI\221\254\177\200\237\375+\213\260\312\242\374\243\350\023\357<\231pWv\200\035%\217\222G9\324\245\303\342\312\241+\205@\234p@=\0258|\262\276\022H\031\364#3\226\r\033\207[\331B\371\303\343\311\351.\353\347\024\b9X\326\371@\t;\362\275:\274\221#k\345\212,\324\263\3247\226\365\t\225>hpv\205Y\377J\037\245\n=\024S\202\256T\241\354Q\246\310\n%\022e\215\204\337hd\265\262~\nG\366S\b\262\237\302Zb\242R\347*6\\1e|\245N6j\245\354\034\305I7\"LNX`\210\210z)D\355(Q\222\207Wq\301\004\277\262\206)\374\354'\013\333\244\241a\216J\001\017.\006\341\006x\262?\320\346(7\331$\331$I\350\2029\035\361\213*\313\332\t\324\223\212\035Y\337"
+	.ascii	"x\200\200I\301v\312\002B\270\257\254a\366I\301\026n\027\211\335"
+	.ascii	"rd\235\f\314X4\344P,\301-Y\222q\264\327XH\003p_Y/\262\277\277"
+	.ascii	"2\003\334@\202$\351w\025%\013d\224\235\260\305&\375\214"
+	.string	"l\345X\313\372\006\230\261\267\227\344k\227\"\260s:\362$_\306b\006\016\216\271\031`h?\343h\223z\330\244^\306\021\023\353\b\222 \250s\005\341\005\220rw\227\304{;d\003\006\016.Y\344I\274vJ\017\031\205/\n\300d'\353\222uI;\030\216t\202\311!O\332\035YS\242\224\205\230]\207-\370v\022H\022H\222\016\013.\310\223tgRqwY'\347\222E\235 M}Y'\345\n\340\266\223k_K\302\035\305:\202'4!J\276=\t7\370\342\205Q\326I\037I\267\2660\245\032I\267\344\017@(P\222(\251\305oI\330\204d\335\226\207r\321\037Ce\271Pd\235d\273\234\017!<\252\344h \372`\263~\001\320vR\355\210\024w\267\227\365\013\320\025vD'J\326K\034A6\224\262N\236\321\370\001t\313\372\005\270\332\177\213\275[\322\254\354*\216c\225\344\237\2236\265\254_"
+	.string	"\252}=\226\005\276\311e\235$\333\261\005\365\225\365\013\220\264\223blw<\200d\375\002\f\355$X\022\354\245\233{\202\r\007\227\334\262>\001\020\367\237\344\302&\271\222;X\206\026\200\202I\366I\257'w\274\205\303\301gl)\353d\327\207'\275\236x\024&f}\272\266\351\236"
+	.string	"\200\311\255=(QvY\237"
+	.string	"uI\255$V\213Mb\035Y }\342\230\310\204;\301!\020N"
+	.string	"\267\375'\255\222V\026$\331W\033\177uY\237"
+	.string	"c\373O\342H\342\200\227\310\350@k\220*\314o.)H\326'"
+	.string	"\324\376\223U\311*x\213\305g\357E\341\310\022J\361\203\313\372\004"
+	.string	"\332\177\322F\322\006lU\354\211wfd@6\250\225eh\304z#\334\021\224\222JF\035\331\023?y\275\r\202\321\351d}\024\210\354?I#I#\031\005C\323\016Q"
+	.string	"\254\262\177Q\210\216\220Qi\367\206\026\230W\326G\241\307\376\223O\311'\t\334\230~2\244\314e}\024\300\366\237lJ6\301v\310\236x\347\250\203%\020B7&6\226\226\222IG2\275\354\210d\263>\n=\373O\312h\261I\031\311$dO\274\243d\202\330`\216-C7\303B\253d\322\237\234\221Dz\305\3621\006\022\034uY\267\304W\275\0301\2220n\354\211w\276\336\342\370\b\004%\221,\033I\262\376"
+	.string	"\316\366\237,j\261\311\242$\fcO\2743\303\204\035Y}Yd\214>A\241$\214?\351\"\371\342%k\233\200\230\220\265e\315\222\327\272\270\371F\333t?"
+	.string	"\033CCI\237\327\247=\032\334\203\222\225\321\344\005\224\254?\200\025AA\311\237\027{\342\235\265\2672\303$\237\254/\200#\373O\262h\261I\026\311\037\327g?\201\372\313\306\361\021\b\272\255\312HQ\326\177\262\305\223?n\033\016\201*\256\372\262\316.><\331\202h\007\332Z\326\027@\331\376\223*\222*\222>\0354\355h\245@V\004\366U|\341E\025\225\364y\301\332&\030\005\260\321\260\312\372\002`\332\177\222\347\311\024\177\262'\211B\217\305RR\326\032\3336\335\344\316\207'y\202\254\226\354d}\264d\374\244\316\017\007\025u~\220\216\002\263\206\233><\031g+5;;\304\303\211?\f\006O9\2420\314&f\235}Z\0277\013~8\214\270\313\210"
+	.string	"\351\211\202,\002\037\306\235\225\251\310:{\265..\214\344\303\341(c\\d1\f\r\333)0\304;E\031\b\276\201p\001\b\355\037&|\227\300\001\321\232\021Ok\316\f\026l%\013l\275\221&c\216+0,\260\313\0040*\325dL\316\fU\013N\343\241Jc}\332\334H\237T\244\365FZ<\222\210V\233V\351M\fJ\0219T\2377\324<CX\243\"d\236Q\033fn\244V\3513\002\325\250\365\304\n&l\240\322@\251\326j4\202jt\207\0235\317\233\247\0055\264\250\214"
+	.string	"%\221\001\r4&j}\326\344@k\236!\246\326\034\025b\250\315\252\r55*d`\023\235\201fF\nC\016\320\247\325\271\203TD\315\323:\275!\007\350\323Z]\236\306\203\315\224\212\023\215:\243;HEX\2433\315\034\252\317\031\252Vgu\006\026\254\321\027\240V\352\322\352|k\236\320\251\f.4U\\jj\242!FDg\236\326\232)\004NP\243V\353s\005ktf\245\252\2025:\343b\255\336L\241\306\035\254Pe5i\215\316$e\244'jpp\236\022\310D\2519Ui"
+	.string	"db01]\341\304\n&\246+\310\334HI,\243\320'N\265*=VY\210\201\251\317hM\bkT\0045\251b\215\276\260\214:E\340L\2475L\227\352\2125:\263r\032\017Q\234\023Vh\024\007'gj=Vm`&]"
+	.ascii	"\241\202\265\372$q|N\255$\364\364\006\023-X_\2423J\034\033\027"
+	.ascii	"\233'\rQ\350M\264F*By"
+	.ascii	"\003u\352\002\314i<$\251Q\234ht\204\373\234Z\245z\005\230\252"
+	.ascii	"\264J\215\342\250\320X\245\021\200\231\241\0016\324"
+	.string	"\320B\013\260\324\206\246*\275\221\2720\275\201:u\301*}\352\240A\265\246F\005\033\035j\300\231Z\253*\323\033`\25095\310\334H]\220 \352|\233\321\232\021\317\032\351\263\204\nV\352\264\206j\f5O)\016\324&j\215\212\230Jo\2448\3734\036`\252\265zb\005\231\033)\t\013D\334Dq\246\313\250\314t\006\345\210\020\315\021!\242\326\247UD\214\325yC\302\tu:\225V\352\264\252\001#\325Z}O\340\034kr\216\325\2445*\242\032\303\3624\036\246$n\244\316\021\240$\254\321\231d\325\211C\302\n[\243U\233\250\215kB:\203\314s*\303\n\325\231\303\324J\265V7\216\r\324&j3BZ##\235Z\237\232J\003}\271\211\326P\255U\3674\036\252U\230\232\232\234\233\233\351\3151J\315\301\32186\320h\365\t\275\241Z\253\260\3259%q\223\234\222\270\211a\006\236!\207\352\363\006"
+	.string	"X\235$\240+S\02271@or\\\310\001\032U\221\271\221\2720\203\343>AH\2137Sh\024\347\2045"
+	.ascii	"O\020"
+	.string	"\322\034\315\242\303\224Jc\235\336\034I<\2435Z\346&\352|\226p\336H\2555\322\234\021N\247\212\314M\024\007G\005\346i<\220\220\340\002\037*P\002\006\214N\034\022\326\227\246\232S\343\302\3624\036:\260Fg\"\300 \2045:\003\0015*s#%Q\301\314s\206\347\n0P\250\n/S\352\211\027`\254\322\233\030\2445\320#5j\275iAZ\003\335\257\353>!\320B}B\200\372\204\200\365\005i\r\224EZ\003\205\3005\221\243\202\264\006\252\204\253,$HH\217'p\246!VN\340LC\250\304\254\260@\260\024\001\265AZ\003uyW6\t\036\254\324'\216\007i\r\224\351\214\332H\25579/2\317\251\f1\247\361\020\265>m\240\251F\251$\2426\230\260\301z\023\245Rs\240-V(\364Y\244>u\220\241>ah\236\306CU\204LT\206Y\3059q\003\3634\036d\270!\006\021#\344"
+	.ascii	"\235\326\204\210R\247!\230\325\034\353\323*\302\346I\203\f\365"
+	.ascii	"\231\204a\2516@Z\003}1\221\243B\016\320(\r4\031\2259\216\200"
+	.ascii	"\255R\023-Hk\240Gi\r\364\225\271Q\301eJ=1\243\253L\231\030\250"
+	.ascii	"Qj\216\025\372$\221s\363\304y\272U\251\314\222:\265N\033\020"
+	.ascii	"\255R\2378*Q\233'\r\322\032\3501I\202\007\02321X\253\317\232"
+	.ascii	"\245\314M\316T\304\211gM5*3\235\241EZ\003UR\2432\317i\215u:]"
+	.ascii	"AZ\003U\332P\247$n`\242%\236\"\2445\320#\322D\0136Hk\240\260"
+	.ascii	"\bd\315S\nW\227Q\352\324Z\215R\231'p\246!nb\250\306\260\264R"
+	.ascii	"\237\326jS\346&Ju\316\3408\235+U\345L\r899@\237#\226V\352\224"
+	.ascii	"f&gJ\245\261V\253\317\032j\236\322\226\250\315\223\206\023+\334"
+	.ascii	"H]\220\326@Y\2545\322\234\025b \020SU\221\326@\22373R\021Q\253"
+	.ascii	"\224\252\303\322\006\246\n-&l\330\257\264\006\n+\2533T\025`f"
+	.ascii	"\250*XMDo\216/\0135jB\252R\315\241\372\274AZ\003\335-55*\340"
+	.ascii	"\330\344\310(gj\300\261\311\221\201\251\321\025\353M\f0\216\315"
+	.ascii	"T\306\006\272qj\2420Hk\240\307\350\215T\006\232\352\023\206j"
+	.ascii	"\222\372\204@\364F*C2g\206\252\002\00437\322\033\3523\002\022"
+	.ascii	"D\253\324g\r:LiD\260\340<g\330\325\250\315\223\206d\362FJ\305"
+	.ascii	"A\342\330\344\260 \255\201\256Hk\240-21\344@g\220\326@w\324\346"
+	.ascii	"I\303\033"
+	.string	"\265>Y\210\332Ho@\236\306C\211\021dj\2449#l\260J_\260R\2474U\225\233\251\264J\215B@Z\003}e\242Q\022\321\033\251\f*\312'\004\230{\346FJ\265\212\330H*\262Z\215B\241O\367\002\037*\360\001\003\306\013\244#\236\316\022\325\023U\225\231\347\263\204\323\251|\226 a\275\221Rk\220\326@\341\006X\2433Kkt&\246%Z}\300\364\206\032\254\321\031\030\031\3524\002\326\350\214\222:\245R[X\211BYh\240\326\347\n27O\033\233i\210\225(\364\211#\002G\232C\025)\023\225\342LCTch\272`\215\316,OXqlZ\250J\217\326\232\234'\211(\013\325\232g\216\006Z\240Zkp\261Fg\220V\353sZC\302h\265JiDHk\240\313h\315\210gU\312\302\263EZ\003E\236\300\231\206P\211\300E\202\226\0238\323\020,'p\246!\224'p\246!V2"
+	.string	"\300\004\021X\220\301\t\234i\bg\025"
+	.string	"T\fN\340LC\344P}\316P\245F\255\326\250\fP\252\ns\206\tX\252!\2422\323\031b^\245y\352\346\n\326\250\210\350\215T\206\032\2525\304\b\350K\215\332\344T\243\324'\216\3154D\0046O\032\2320U\0216Sk5\007J\201\325\031\335AZu\243N\231\030r\250>o \001}E4\2558\326\234\032\2445\320\343\241Rj\364&:\263o\202"
+	.string	"D\020"
+	.string	"\n&\216\326\250\263:\363\254q\001\307&G\006>\215\207\250\215\324:\302\315\324\306f\n\265>e\2340\365\031=\241i\2547S\033\343\211\247L\261J\315\231\322\030\253Qk\316\215\324\346X\225\271\231B\243\325cUZS#\265qO\343\341f*}\002\240\352\204B\237F\353i<h@\215\326\324HI\270V\246\363x\032\017Vh\016\325Z\005Qu\232\210ZslVr\200Nk\234N\327y\244Fot\230:\235\307*5Z\315\271q:\267\314\2154\007\247\323\255\336Hq\252N\347\261&\352t\"\255NkUZ\243\202s\302*\202L\224\372\244\251\2120B\325*\0351B\316\315\214\b&rn\2445\"\230 "
+	.string	"\247"
+	.string	"P01BT&\247\006z#\035\201Z\315\031\201"
+	.string	"V\023\321\233\232\347\rU\346\031\245\322Xq\234N\030\247k\255Jk\234N\367i}\3128\235nt\007i\325\351ts\200Nk44Ju\276V\351M\f7.X\2457R\227j\255\001z\223\343\202\3143j\003\024\252BK\325Y\"\312\002\024\372\3347.\310<\243T\327ZuJqD\220\210\262\020\3059q\2033\206\032D\300Q\350\315\323Z\275\221n\253\263\0011\350\033i\r7U\250+\305\251\026\253\316\020 b\200C\200\210\001\351BAH\213\247\361P\315\031Qu\316 \243B\215Z\253O\0337Z\342Y#\"\007\307f\3478KDe\2529#v\325\031\205JKDY\250\346\214\200\243\316(\316\211\033\2529#\220Q\234\023\326j\316\210c5gD\361\205\017N(\364\351\352\360\264!\004\013*\270\326\323x\310\301\261qN\251'f\240\320\247\007Q\247\r$\234@\202"
+	.string	"rpl\2325\323j\224\372V\235-Q\247\210\034\034\033\330\265\326\344T\2436D\255Q\026rplX\242\316\233\031i\315\323\271\274\231\221\326\250"
+	.ascii	"\205>\367\t\231g\324\206\247\365)\203\244VI8if\2444N(\364\231"
+	.ascii	"\214\312T\245%\242\324d\315\263\304\314\215\b(\364\331\f\301"
+	.ascii	"\202\nP\350\323\215Bo\032`\255>\2432XU\220y@U\n\2015j\215\251"
+	.ascii	":\223;\320\350\360<\261\334\201\306\251\262\003\r\r\324:\275"
+	.string	"\261\272\320V\235$d\2448n\rm\f-\013\255\214\024\247h\275\221Nk\300\311\221\271\221F"
+	.ascii	"\006\326\3419\201\034\0212R\234\345\215t\006\253\n2R\034\225"
+	.ascii	"h\211h\r\323\n\215\222 \321\264R\2438&\242Nk\215\324\352\274"
+	.ascii	"\231\356 \245Nib\2422\323\031NX\245%\236\324\027\244\326\233"
+	.ascii	"'\363\345F\372|\201:\265>\251\321\026\033tx\236X\251\211B\241"
+	.ascii	"*D\255O\352RfF\305\352\264\336H\2478\326h5&j#\265\276pK\263z"
+	.ascii	"\023\305\261\231\206\220\221\326`}\216(\321\254\336<\2517\270"
+	.ascii	" \023\215\222p\321\341y\302\311|w\240q\202X9A\215\226\230B\243"
+	.ascii	"T\347rY\235NG8]\254\323\245L4J\302i\245>m\252+Q\234\023V\025"
+	.ascii	")\034\003s#}\316\254Tm\2342\317(\3153\207\351\264\306I\215\336"
+	.ascii	"H\237T\253sJ\205>!\270\221>gTV`\240\316\352\210'\013\bj\324Z"
+	.ascii	"#%\301\262\003\215\363F\272\003\215\r5j\225q\222\300\251q\336"
+	.ascii	"\234\220i\211\312Lg\250\341\206\t\254R\033\251\f07\322\347\013"
+	.ascii	"+\324\350\314\214\224z\203\016\323\232\032\025j\246T\353\315"
+	.ascii	"4\004\r\364&\347YS\2013Z\315a1\361\254\211R\235:<O8e\242\326"
+	.ascii	"'u&j\275\221\266\354 \245>\2437R\031\254\325\034*\215\265i\274"
+	.ascii	"\221>g\336(\364\346YB\346\351\274\221\3328e\224V\251\215\264"
+	.ascii	"\306\tu\326\324D\2410J\353i<Xsp\2549S\247\215\0168U\267D\224"
+	.ascii	"\205jMN\r\323\022\326\247\r6:\324\220,\021\225)V\253O\034\035"
+	.ascii	"\2465N\026\247L\324"
+	.string	"\206\372\274\311qJ\251\326\025\347\314\215\324yA\264f\346\346\351\264\336\344LmHHi\252\316h\365I\203\343\234\271\221\342\340<kH\264\334Hg\244\324\251s\346F\252\003K\264\372\034\321\254:g\2422P\034\347\215\324\246\204\263\245j\343\254\211B\241\317e\r\216\215\263\031\225\311\261Jof\2366N\234g\r\211e\314\215\324\304\323\306\251\201(\225D\213\004&\24227R'\216\223\032\265\342Li\254\322\033\352\024\002\353i<\230\230\216\200S\265\221\211\301z\023\275y\332P\2438p\325ib:\302h\214\332<i01\035q\264No\220\211\346p#\255\331U\347\315Tj\225\312\334LC\334L\2456\020D\23521\230\230\2168\312\304\020\225\231\332\270Q'\f\225\316Le\210\312Lm\220\326\323x\270\311\241\342L\2475#@IP\220C\365y\303\314\215T&\n\215Rq\224U\347M\016\225\032-\321"
+	.ascii	"\234\351\264F\351V\037\020\205\253\017\210Z\2375n\365\001\310"
+	.ascii	"\034\252O\353\210\234\352\3614\036\246\324\0233#T\251\323\352"
+	.ascii	"M\264:\245\236\230q\2436R+\316t*\303\222D\b\026T\230RO\314l\253"
+	.ascii	"\016\317\023\305\344\256\251\231R5\r\324*\3051\302X\251Q+\364"
+	.ascii	"I}\322@\235\326\351tD\224\252\262\264\236\240Z\2436\321\232\250"
+	.ascii	"\025\206%\207\352s\206$N\325\246\2123\263b}Rer\236#\234&\246"
+	.ascii	"#r\200>kF\274T\251S\034x\007\032g\324\372\244:\243\326\247\f"
+	.ascii	"N\216\323\305\2722\225:_\252\316\350\314\263\372\200\2257\352"
+	.ascii	"t"
+	.string	"\241\345f*\265BorHl\253S\372V\235I\bX\251\323\032TJ\270QgTf:\203\225:\305y\243\316\006X\251S\034euz\214Z\2376\310\344<G\354\350\016R\021\321\035\244\"\266uS\2232\317(\f5\322\347\r\324(\t\0229+\230\260&\251\326\032\242%\244Qh\324\206\230\367i}\262\220\003\3649\242\246\346\031\302\004ui\305\211Z\253:J\342Y\255\221>]0A\205 *3\265\321\326\323x\250Z\020\255yBE\254\344<\231\321\231\233'\325h\"\347\351\302\244F\2557\321\020\326\233\250\215\265\232\223\001\231\247\212\325\004\265\031\302\004\365\305j3\245\272 C}\352@\235\222`\251:m\236\324g\rUf\264FFFj\343ZO\343\241*A\325I\215\232\220\3160-A\215V\223\326\350\f\365iUF\241\324\234\251\b8j}R\265L4\212S5\232\230\216(ZO\343\241\n\245\216"
+	.string	"\205"
+	.string	"'j\025!s\023=V\235\321\231\233\247\rK\234\250U\204\225\372\264V\221\247\361\020\2012jBj\203\224\211V\251\321\022Q\252\263\252\303\363D\323z\023\205R\2438N\352\324:\265q\342HkH\320T\237T(\314i<\310HqF\260\322\314HkH\304\310Hq`\233\351MT\306Y\255F\241S*\216SF\212\263r3\225Zo\242%\242T\234\bN<k\2422\027Dk\254\326)\225\306\352\214Z\237Q\031'\t\022\323h\016O\253\363\304S\207\347M\0165"
+	.ascii	"\247\361\200\201uGm\2364\344P}\3360\"\247\n\267P\225\"OX\245"
+	.ascii	"\324\251\224Z\003t)3\225R\2435\310D\251\322jTFiu\302\326j\324"
+	.ascii	"\372\254a\232x\332\250\324<\255S+K\324Fz\303\315Tj\315\201FM"
+	.ascii	"\264\320buV\037\020\265\221Z\367\323Z\023e\341\251R\003=\021"
+	.ascii	"\":\363\244FK\2500s#-1\265y\261\211Z\253'\252K\031)\016\263\204"
+	.ascii	"\324\n}\256De\2466o\025*\265V\245\326\247\265\352\314\241\372"
+	.ascii	"\2642i\240V\251\016\"\252\323\032\004\020\255\221\222\230Rk\210"
+	.ascii	"Z\237T\227\034\240\323\032h\016\016T\031\265\221\336\020\205"
+	.ascii	">\251/\314\334Hm\250*\3344\200\032\325a\212\363B\215JIH\2557"
+	.ascii	"Q\231\030d\250\317\351\b"
+	.string	"\346\01643D\2534\256L\224\232\363F\255O\033\242;Hm\244V\234\006P\243592Q\032h\325\305z\032\01738\320\233\034\027\254\321j\324\206\031\034\370\206D6V\2453Q\033fp\222\321\035\244U]\255F\25122\317\343\t\234)TS\2558E\253S\306\006*\255\201\356\273@orH\350\233\251\324\212#\245B\253Q\031\270:C}j\253\365&g\032\342\255:OP\2557-T]\353i<\230\240\2160\203\323\244N\255\320'\t\347\324\232\363\2141A}q\2366P\252\221\032\225\221\226\230Rqd\242&\2505O)5Z]1\021\255\301\311a\201D\315\223\346\215\312H\251\324h\211\251\363Fz\201\325y\234y\3360\225:grjpbV\254\321j\224:\265\346<\23527\322\021N\353\263\352\264\311\241Zs\210\342T%HFk\236\320\327J\215\226\270\221B\2512R\033\343\215\324f\347"
+	.ascii	"\215\322@M<m6\263\032\242\346Y\342f*\265>k\2468\324\250\365&"
+	.ascii	"\006(\025\246\032\215Rg\242,DkfnT\260y\206(\201C\202E\246fJS"
+	.ascii	"\215Rin\210Z\237%\244V\250\nQ\231\351\fT\3513\346F\n\215Vs\234"
+	.ascii	"&\2366N\023T\270&zs\363\244\201:M\344<\235&\2366\314*uJ\245F"
+	.ascii	"\235Q\233'\225\204\023J\255\2728\245\325*\025\216\342\234\260"
+	.ascii	"\256@@\202\304\324\232\003\255\240*5\361t\316\344\214\210\312"
+	.ascii	"Xspn\2440Q\234\023Vg\264\204\324\372,!\245Fe\23437R\032\353t"
+	.ascii	"jSuB\251\023P\2374\320\013r\224\326\323x\030a\202\252\0132\321"
+	.ascii	"\232\021\317\233(\263J\315\261>\243$\230\326\323x\030\001J\002"
+	.ascii	"&j\363\244\341\304\263\006\247*\225\201\255\323\032)\216\322"
+	.ascii	"z\032\017N\0229#F\250R\243%\244T\231\013\236"
+	.string	"\326\247\214\256:\251\260\325\031\265J\251\021 \2213\342\245F\255R\252\016\356\f\365Y<a\225B\2378O\350\266>s\315t\272\202\323\265Z\243U\022$\246\256L4\007\350\023\307\255:\24395\317\022\322\032\350K}\322@u\324\346y\243\2438'\254\332\232S\363\204\200\264\006\252bu\202(\301\304s\006\020%\344\270\326\250\263\206\305DT\346&\206h\315\210\247\365\215\326\214x\336 \203\264\006\372\202\223\223\303tZ\343ZW\216\256\325\304\323\2468\303\215t\006i\r\024\002\253S"
+	.ascii	"\037\2547\322\234}#\265)\312Dof\244\325\233\007\230x\332\334"
+	.ascii	"Hm\226\326\323x\250\316\334H\255\326h5\202Oq\242\324\021\254"
+	.ascii	"\323)u\004\270\306\255:C\320Xgn\2422\234xR\251*Hk\240/'\236T"
+	.ascii	"\352\323hu\242`\275\221\346\034\253S\034\253t\204;#%q3\205\272"
+	.ascii	"V\347\315\f\216\361\037>\204\270\340\0014\274\260\241\036\244"
+	.ascii	"5\320\021\2445\320\021n\244O\233\021\240\324\352\b\036Znfp\212"
+	.ascii	"\217\221\212\221\212\251\3521\365\230\252\030*\025hApP\305\330"
+	.ascii	"hQ\230\205\305\376\300\314\002\367\037ScI\225\204Be\304,&\312"
+	.ascii	"\205EKG&\0030\206)\206)\006\252.\246\3511P1Oh_\2011O1NJ\262\034"
+	.ascii	"pv{wSjn\373\217Yr\201Z\262\245Xs\022\243\224\334\241\3541\374"
+	.ascii	"3\213Ir\271\261\373j\224\3051HX3,\2755\211\231\341\202t\204\230"
+	.string	"\343._\333`\300\035\2710\201\350\273\002\212\241lr\002K\257-\306(\006\306Q_\023)E\217\201\361\307\270\210y\221\201p\b\002\025w\227u6l]\334\021\332\246\013\247\370\360\230\"\265\247*l\fQ\314P\320X\037_\f\320c\206\376\230\240\030\241\f\304\243S\343.\353bS\353\342\232\3206\335\230\237\017\217\001\212\nr\222u\t1-X\370\310\241\026\350\363\030\026?\314\025\263\"\003A\321!\327\225uVk]\334\"\342\207\307\370p\271\035\351\212Q\021\223\002\rk(&\305\017\023\305\240X2\231\231\035e\335\016\305\364\304\360\2648l4-\211\211\037\303\363\307\350\304\354$2\375xe\355\032\266.\356\003\333\246\013\223\370\3411\261\361\352\t\351G\326\007\204\231\242r\003\356\372j\303C\\\002\211\305\220\222\262\2643\214\267`\016\351\\\004%FIFi\026>\200b@Q\262em\020\302\0302\211,\351z"
+	.ascii	"\t\201q\002\343\004\246\320\213\3600\205K\272\263\247\025u\\"
+	.ascii	"\202\2020\203%X\351iq\r*\201\204\335@B\312\372$pl@@\230@\301"
+	.ascii	"\004\270e\377\242\004*\323\346\226\222\23411)Z\362\3561\361\314"
+	.ascii	"\020\005\225\274wY#e;Y\207\315\005%i)*\326\345Q\265\360k\221"
+	.ascii	"\341rU!\035A\002?Y:A\032C\352K\242=@M,\b\237\017\334\304\203"
+	.ascii	"\003\311\021xE\313\226\227U\333\203!\342>\305xWF\2666\322\221"
+	.ascii	"5=\275\025\257\345R\224\275\273\274\344X\321\305\224\026\026"
+	.ascii	"\006\017\306N\257x\241\003\bSd\245\314\016\320\357\016^r\217"
+	.ascii	"r\2009Y\271\322\260\214'qwY\257\204\351\230\232\261c\310\233"
+	.ascii	"\225\260\257\255\256\005\310\221\b\214k\226\220\026\273\2558"
+	.ascii	"\211.\005V\310-H\013\036\332\222\030\340\\\213\337\361\320\f"
+	.ascii	"\220\211\034\314\217\234\225c\013\tH\313\022e\030\221\035cq-"
+	.ascii	"\331\242\235\233\216.8f\242\321J\316\207\347\215\371\344\370"
+	.ascii	"\004%E\f\267\226 \033\250\370y\313\272e\317\013\255/\333\266"
+	.ascii	"\226L\373\242\003\362\261d\222\244\252Q\305\306\226\024\334>"
+	.ascii	"\326j\340Xs\201\261dr\306\304\257\2072\311\273B\206\221$jn\360"
+	.ascii	"W\322\232\2214d\236_\236\024\026Nt\177\226\370@\201\326r\346"
+	.ascii	"\326eFx\006\250\003\255\256/\353\027!8\304\361YX\017\024]f=v"
+	.ascii	"\024\345\305\310\032f\ff\f\346\032\326\001\f\331a\256-fq6\022"
+	.ascii	"\223\220\370\331?\214\330\216\260f\230>[\002\005\021\354\315"
+	.ascii	"*\307h$Q\362\245\264D\201\344u\267#\206\227\n\024LW\263\355\305"
+	.ascii	"v)Q\203\341j\302!\177\364`\231`t4\2070\241r\210\271\301l\321"
+	.ascii	"1\005q$\026\301h5\3714\234\221\024+`\262\230[H\2674@6\030\254"
+	.ascii	"\344\265\b\217\272*\230\253$\255Q\216=&"
+	.string	"\030+X\n\013>\240\034L\031\371F\f&L8T\360\336(@\"W7\370\266]\032\r\255*8\260e\022\246eH\325<LB\226\370\304F\313N2\314\254p\211\006\r\030\251A\001\004\352iqI\301\324\320:\"\245\016\246\006LT\361\350\310[\326\325\\\227\224\375\303@\301\203N8\272\236\262\236s\001\311\005\020\247\226(%\f Qt4\265$\255X\002<\204aR\3760\274\342XJ\342\3013\304\322\002\225X\242\212@\212\002\261I\313\274\327.\233(\204\304\262\304\314\036\266)\315\370\222\342\304\020\n\314\321ad`\337\210\230e\r\023#\013\271\340Z\341\2275\214\221q)pj\350\b\f\026\253|W'\345\357\005,\246\203@A2s\301\202TD\322\345w\005S\324\262b\363\025\351\241\200!\202\275\332\251\246\246<\230\241\026\024\032\252\307\024\027\214\020\213\323\n\203?Q0AJ3)5)9\230\237\303"
+	.string	"\275\207r{G\262\206i\001KA\371\310\313\313\032\206\005\013\017\366i\305\033\314\n0\271\246(>Y\303\244\200I\001\243\242\035\0322\300\212\253\276\"\2060*\224dE\210k\204Y?\232\3350=\033\214M\207Z\326\217\356\355\037\206\007F\247:'\344G\326\327&C\026>\262\016\302\201\211\360h\tL\f[\3718\013D\222\270\324Z:\023K\312\372EJ\361\003\211\211\211\211R\342x\347EJ~\231\362\202\370\027)g\036\375\274|v\\\375\344\311K\224$Ao/\206\177\211\002\245\004\215\036\031P^r\030\032}\255\275\020\2666\350tld\375\250\331\026\024|i\262c\360/M\254\222A\204\364\260\212^)Q\362\022\230AO\034\247\210wH\344I\314\006\276"
+	.ascii	"\n\261\222\332y\001|a\342\203\356\205\311"
+	.string	"\377\277,\301\001\351\246\006\307B\207\241\216\254\037=\332\377\313\037\274UeU\325\223d9\026\266\002\357I\326/}/H\376\342\367\353\213_~\361+&&\272bG\322\\\375r$\277\354\275\360\375\345\310\257qX\034__\216X \205\331\266\0300g\260\t\311r\357\356^\364\326\336\212\374E\357%\257\252F\r)/y/xK\300\271\235'{E\017&\242(\212]W\367b7\225\301\\\234V\326\220\277,\277\376\274\300\236\240l\236!.\222\350Z\246$\217P\250\225\005I\372\324\020\266\3263\267\354\241\005\347\022\371\340\340^\200\360)y\213\373\013\220%Z\2362e\356jo\277\264\275\264\275\270\375\350\340\307_\334Z\244(k\224\251\241a\367\377\342\243\t\b\307\020\233q\364\302\326$\024\364\232\321\367\262\266T\202\221\256\236\024y\351\001/\331uvIo/j\314\262\277\252\030:Y\277\234\275\234\275`\221:H"
+	.ascii	"\337\320\376\202m\016j\034]I\232\344\330\327\353\213\231\215"
+	.ascii	"\020\264\006\251\302\312\376b\306\024s\367\262J,\224\366\377"
+	.ascii	"B\366\372-\375fl9\031k\376\315\351\024\242\020\203\241\344;\342"
+	.ascii	"C\022\266\214\313bk)\340\274\274^\276\252H\330\221\325\227\335"
+	.ascii	"\361\227\257\345\017%\r\277\246\0352?\373\177\351\202\201\230"
+	.ascii	"^Qe"
+	.string	"\\/\\,D\320\222\240t\260\354\301eD?p[,\177\312?!\302C-\226@\345\217\245,\251,\270.\243\bL\374\302\202\341\216\256Pr\\\301YK\257\030sjV,P\312^\334\355\344\210u \366\307\027\216\025\2737!2\354\215f\213e\320\030\217\217*x\312M\003\302\343\212\212e\005\214C\020l\312F\021\222,!\334T\323\306{\270\343+Q\252y\305d\"\263\321V\203\305(\217,\321F\024l\227\233\314\244\240\2401\264L\002\330\027;9\275<1e"
+	.ascii	"\347\002*\356\345\351\307\016\354\372$\353C\023\367\377\322\344"
+	.ascii	"\212\315\030T*c\202\243j\3541\355xYb\272X\262\201\242O\251\371"
+	.ascii	"\004'\245$I\326/3\262\340\322\325\307\013\322\313\214x(O\253"
+	.ascii	"E\273:\374\222\221L\202\023\253\234\3608b\362\035\r\303j$\275"
+	.ascii	"x\361b\344E\202\330`\216-\030\1771b\352\021\221\r\312\365\355"
+	.ascii	"k\230\016U\216\242\256\"\021B=)\242\226\260\247\271\027hC\312"
+	.ascii	"=\354\226\340\335\213\020s\352m\006\232\327KP\362\207g\214\b"
+	.ascii	"P\023\273\223c\356\347\345'i\347\276\340\032\232zI\361\222\342"
+	.ascii	"\205E\035\tbO`_/*\376\302\342e\305\021$:\260\227\025/>\255\020"
+	.ascii	"\236[\017\027C\376\316\260/=We\n\037\257\276\254\017\315\361"
+	.ascii	"\302\363\262\243\364\332yr/\344^t\340;\343_\032\021\261\227x"
+	.ascii	"E\212\021\032;9\022W\002sH\002%\305\224\245\323\335X`\326.\206"
+	.ascii	".\206.R\316\262S\005\033%}\0051\214\217^t\360\273\034\336E\312"
+	.ascii	"\2341\305\022'F\262v\211\362\271}\330\203\354H\326.P\240+\366"
+	.ascii	"\357\362d\245\217\206\217\024x\205\257\223&&$.\204\357\023\250"
+	.ascii	"8)N\336\303\342\f%t[M^\346W\024\r\025\203+pMR\212\272\262v\311"
+	.ascii	"\026A\322\347\227\365\241(\366\357\0228\267\002\004\t\024 K\332"
+	.ascii	"Y\016\0332\\\226\334\205\t\020\0308\232\270(\031\314\036-)q\371"
+	.ascii	"\273\312\256\031QC\312\022I\242\202\326E\004\210\232\337\322"
+	.ascii	"g\331\"\311O\036\222\345P\361l\310\215\030}K\236\"\331\020\236"
+	.ascii	"'|I\272\023z\200\326\262\276\206\305\361u\351r\335P\001\267\247"
+	.ascii	"\324\321MRwiFVn\030\213\f\241@\323;\314K\022\272[,\276\200\360"
+	.ascii	"T\006s\\\343P\024\201y\224\374\360\375\270S\032\271{(\350\226"
+	.ascii	"\210(\227\2709A\314Z3\203\214\224\001\rI\302\031\201\231\201"
+	.ascii	"\271\324)\241\0049\002\364\221\265\220k\230\336\027\026K\207"
+	.ascii	"h\225\306\204\227unB(\305\227\365\2361\261K,\205\034\214]\032"
+	.ascii	"\016\341[\001\004\312\330\004K\210G\334\312\324\216\221\365\027"
+	.ascii	"\007\267b\264\367\226\264\216\274)\207\322\004\377\230\\\334"
+	.ascii	"\\\332`\3036$\261\313\217\225$\327\311\305a\017\027\0372\230"
+	.ascii	"\2060\311\372#\020\367\357\302\266\262\"\206\223\252=\2275e\322"
+	.ascii	"\322[_\017D\270/l\205\241\332J\320\222\241--\227\264\244_\017"
+	.ascii	"\031SP\330eb\224;\303>\264\245!\r\257-D\027\036w9c\016\0329!"
+	.ascii	"e\355R\346b\326u\265\226$k@\255%qcY\273\220\271\\\231SW=\200"
+	.ascii	"<\360Y\246\341\226\341\337Xs)\b\354\260\206\230\n\022\031\211"
+	.string	"Y.\302\362\234\322\b\2158>0\370\205K\204\343\310\221\257\032\314\"\266\277\034;\336$N\",>\257\244N2\316\253a\244\013v\202k\240\255\301\340z\225h\302#w.t\f%\241\206\222Dm\3012P\f\021A\341\242\365\036A\202%\322#k\227\034.9\\\260\210\030Qy\031n$oV7\\\256\356\202\245\223\240X\341\302\252\357\3570\317\305\312\235\201\"\312\220\263\254?\"\211\224\224\313\215\254\2217f\233\023\276\030Uw\271\241r\210\006\265v\225\265\013Uv\202\312\"\032\222\265\213\215\317\215\245\301\370\313\332e*\223A\035\265(\032a\027\025\305\224\341\304\212\022\207$\314\276\350\313\372#\274\234\234\\\240\222`hM1r\025\301\241\271<\335\005\252M\324C#\222\324\241\365\204\242I\326\037Q\303E\311E\311\205)J([,\024\332\212\341\262t\027\246\027uf5F \305\370c\270 \3054\351\bv"
+	.string	"gv8\304\020\t\344T6\303e\306]\220\242\366n@e}B\027\031W\235\030P\206\313\021rp\211\222\236%\017\322\225T\326\037\221\302\245\310\305\205\013\214\342\222\241\026\312\234\224\022\027\030wy\001\342\204\214\005\347c-\353?\367\270#\024\313\372O\302\355B\3442\024\024t"
+	.ascii	"#}Y/$JK\224\262\376s\310v\371q\371I\372=\345\3302\332%\352\320"
+	.ascii	"\313\372\317/\027\037\027\037\027\026Pyh\356\310\311e\305]X("
+	.ascii	"\031\024#|F\271\244pI\001c\257\372\212\350\024P:\216\262\376"
+	.ascii	"\363\205K\217K\017\214\215i\322)t_$I\215m73 oY\037\207"
+	.string	" .;.;,Na0\254\n\275z\254\200\350\262>\016b.\261K\334\262\343\362\005\303\252P\017\351\006\236\215(QZ\246\264f\261P\f\336 \330\227\241\362G \342\022\342[\246,\343\2328\235\265H)\362\021\005\241j\221\322r\310\034:\262cH\212#HY\037\207\236\026\303\026\303\226$\345\325\213$\277\254\357|RX\330\222T\"\306\224!\"\250p\022\313\372Nl\213\223\026'-A\206b\034\0329%\272\200\313\372N\241\301\017\266$\265f\261\320[\004Ck\212\227\223\301\261\253\254\357\344\331TT-\331\230&\035A\017\206b<\271\222\212\"\366\227m\t\204\"\243\t1\353\026@\231\2504\271\254\217\001\274\277\277\226%/\202\272\n\275\212(\374\354\332\224\274e\t\b_Eg\030x\323\323k\361\213i\322!t\205\004u\0252\347z\376\260H\336\342\267E\027D\224uK_\306Z\342\025\264\305\367\037\371"
+	.string	"\035B\342\370\216\270z\204p/\214\264\354%\331\275ae}\f\240\355\026#/\026\223R\f!Y\037\003Xww-x1M:\202&\340\021E\t\234\r\250d\245\215\231&\245\262 \007\363$\345\034bj\206\266\001\t\323\025"
+	.string	"0@0\032\216\210T]\227\263\003\024"
+	.string	"\021T\272\200\200:)\216\224(\211\224CD"
+	.string	"D"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\nf}\264\362 \266\351\301?\236S\242<T\231.B)\025f\003\224\033a&\370\b\224\255\032+\022\007d\344\024[;\355\240X\266lk\233\004BTl+\226\353N\300{\261\374x"
+	.string	"x"
+	.string	"l\357\216\231G2\242}E!H-"
+	.string	" \217f\227Hky\225\226\0232\023BEm\3033[$\360G\230(d\275\\"
+	.string	"T\\\202\211\321,\260X\214\220'l\241\354e5\033\372N\366wuy*\370\215\331j\013)u\006\202\301\266}\370\037\225\030i\342$\200\326\033!\322\251\263\253S(\007\377\257`.\017B~\245wMG)Ohv\310\224\016\2571\240,\301O\r\236\361\305\f\35133\0213\024\3428`\267%6\370\t'G\b:\210"
+	.ascii	"\227tgh\b\001\235\241o\264\276\n\032_U6 j\320\341\324\032\"\r"
+	.ascii	"\251\237\217\3279B\023W\361\327\017\231\300a\353\340\321.>p&"
+	.ascii	"\367\250s\372\026+\212\034\030\243\243O\034\0235\271\020\201"
+	.ascii	"\340\r\351\250\233\222\357\220\221\027\340_\360\237J\261\242"
+	.ascii	"b\267\2612,\315\374\323v+o\004\211\253y\333\227!\317E\003\272"
+	.ascii	"\034'\001\302\002\020\031d\227\257\257\323\020\315{\216\377["
+	.ascii	"\235"
+	.string	"Sc\257\322\201eD\241:\3229\034\210\314F\232\314\007\350\307\035C\330\223)=\224\352\n\375\013;\024(16xVUB\265\272\017\366f=\205_\243\326Z\231\tav[\267\0042\221\371\341\212\276\013\031F\241\274w\274\263\316T\344\304\017$\305\360q\225\007]D\345"
+	.string	"':\007@\356\261\241\224\022=:\202\350u\304\"!\0029\336\315\217Vd\001\035\247[\022\213\374\376\363\016Iugd\331L\260\024\360^\276w<\260\270\3439z\356dc\035\037\212\206\334\357\375tm-A\355\214Q\020\301\36120f(\006\212\362\230\265\201\332\361'x7\207\235Xn\312\375\n$\370;\224\247\344\231D])\360\b\027/\210\037\236\231A\021\310\223K\334\375E&\324\367\020\210\304\317\276@s\213\230l\031\322\355\f3\333\207\225~"
+	.string	"\346\345>\375\306\345\242\245\023\360j\300\245O\245\303\236).y1X\310\355B\370\230\201\263\327\325\240\374\320\361\274;\370=\225\216z\005\207I\244D\003\364m\213b\263\264\013\201b\330\252\231\230\227\222e\255\330\362\277\333\353\340ot\263\260L\242\256\327\244\273\302~du9#s\241\306Ot=\2367\230\311zz\201:8x\007z\327/\032\373\235\201\265p\227V\324"
+	.string	"J\333"
+	.string	"\306\353\345\304\203'.x\262\203w\346\350\223\022\364\025B\250\324\323\343\310Z\344\326\355#\272\004\030\207\255\357\0079_\300\205\325\252\220\241r'\314|@{\354<\303\231\027\t\272\371\001\324\352\324\272\225l\244\302\242\355e\2003r\202\351$j\3054\367;\246l^\314\007u\255\350\003\t\220BZdP\034(\260\204\2775U\275iQ\333K\362\240m17L\031#\263q\022\277\032bj\032N\260\247t-\023b\303\272~*JZ\001@\361\325H*\300\210kG\315\001lm\fJ\323\224q\207\324\3451\265\211\331-\252X\007\356\036\030\272pc\316\177pRh\277\233<\006G\374yK\213\327\204\250\344\204M\017\237\213\277%"
+	.string	"\2104\3654\337W\212\316s\2504\312\274\364\344\233\222\241x\245X8\0160\274*\277\375\250+\203\245\177\264\327\261\221\207\003\376\031\263<\214\326c\203\333q\356r\322\021E\362\003\324\260\336\233\341\312]\201o\032_"
+	.string	"Z\226\314\013oT@!\220a\030\307\033\276/\020\367\371\302\266%\003=\254\271\322x\230U~D1l\025r\300h\346DR\220qh{hR\033\224\374\311\225\305\016\223n\261\364\303Ga\321\302\263\201|\2647GUi\365\215\262\360\233\375jy~\355\3473=\341\240\320&\257a`Zv\345\035\f\302\344\326(\224\311\363\033,D;\226\307\342\200\013\235\020\bQ\253\252\266'\224|`(9nv\353\206\022\221\311a\0265\004\252?Ur\372\225\271\313j 3\334u\300\273\245\341\262\322+(\241e\n\030\330\177\310\232\371\334\006\260\301\312{y2b\233\026\334\225`\350+\t\t\263\330\260\354\316"
+	.string	"<j\205<\264\210\273\324\213 \346r\306\204\r\247\222\270\210\266@\226G/\373\270{U\314\220s\273\233\243\316~\"\366wzH\021\220\337\330U\301p\365\363\036\033\364\246\303\267*\034\n\343\310P6$D\221\331\211\223 \373\3715\376\244_\344Nl+\233\020@\376\224\320\257\374\020\324\207F\313\226\315\330\351\001Or`Q]\306i\373;\005\260\\\bT\036\251!\201\261\231\003\311$\020(\312"
+	.ascii	"\255\352\362Si\264?\004%r\325\036\233)\223\325\243O\023\211G"
+	.ascii	"\266\236\332\370-e\n\346k\235\270\241\026^\373\f\363DA\300\343"
+	.ascii	"u(\323>\374\007,$B\r0\201\212\313\326\232\200\177\254\025(\213"
+	.ascii	"u\032\272\024\036\255\263!\330u\020uz?\"\256\034h\241\361\376"
+	.ascii	"\001T\210\3718D[\020Q\217\207\246hny\231\005\325\346,\330\235"
+	.ascii	"\215\375\005\252\037\210\026[\260&\f\245W\374\351\311\262\371"
+	.ascii	"\317R\356?\351\032qZ\027\370:\311\372jW\005\"\021\344\036xF\223"
+	.ascii	"\35584\330\013\251\031\350\353\315f\313"
+	.string	"\030\232\232\030B\214'\264 `r\200\223r\375/\004\270\ni\331\264\f\301\351\023<\354\3001\377!\327\032\242\226&\372\242-\"-\275\\\222$h\f\371\021\354(\263\335\231\342\241\374\341\234\304\210\277\312\375\270\226EG\\\\\231j\234\202\326*\035\236{\340\203\235`\272K\023\361\027;\003\031\243!\362q/\305\233\324\036P>\016$\371,{\247!:\327\200Pd'\200+\032t \274\210\304#I\3224L\336\036w\226Ya\362\016\242\225o~YM\272\013\rj6\226(8\221\315\340\321OC\034\007)\257\221\361\320\032\321c\366\023\237\206\343\214\336\377\300\231\"O\224\353\224\242\271\016J\364X.\2662i\331\327\261\327\236\005\254\016\372\307\230O\224\327r0\300\367Q\303h'X\272H\246\352\371\353\2219q\257e\250\325m\261l\032\327\215j?$\270{|m<z\024\256\263\251W?\314\326\200\234\337\tY"
+	.ascii	"A\025\330\032\373h\345g\2715\360\237\256\201\215e\353\371H%$"
+	.ascii	"\215\266Y\230z\240\024\347\004Cov\2437\270f\217\374\032\363\304"
+	.ascii	"W2m$]\221\203\322E\017GS\317\307 \225\274im\305ZY\356\213 \207"
+	.ascii	"X)\\\223\003\206\0231\277\f\346w\233\267\nv(\235\346\364\352"
+	.ascii	"r\235\366\253\"\001\020\252 \fp\343)\2636\0164\207!\323\025\211"
+	.ascii	"\254\\&j\266y57C0\003\016c\222hY\230\342\224o\316\362\260>\016"
+	.ascii	"\003\033\334\354N|1\271\037\234\222K\224\250\303\235\032N\373"
+	.ascii	"\302\300\360,S\336\f\202\244)S\323\375Y)\240Z{\250w\342\212\275"
+	.ascii	"\375Q\320J<\367\354O]\212\317\310YAt:=\362A\nP\304\364\206\016"
+	.ascii	"\003\305\002 S\204C\017u\017\037\273jA89)\272\006v\031\264\351"
+	.ascii	"z\211\213\362\352h\261\016\327Y\2156\0229'\262G\350\266\276;"
+	.ascii	"\302\324\013\237W\211\340K\202\006\031\203\354'B\362\002\244"
+	.ascii	"\025_-j.\265\221\244\303\325\230\016\324\320\352\351\241\224"
+	.ascii	"\005\367\213\260\235\264y\363\315\315B\200\305\366.3\304\f\300"
+	.ascii	"\3754G\360(\251"
+	.string	"\030X\027\332\376\245Y\315KF!M\322\023\t\366\310\034U\314+q\243 \205\214\251u\372\\\327!IS[\036\203\205\342\271\023J\203z\356\277Bp\207\211D\352F\335q\310?\314\367<\3349\3067Wd\036\205\262{\361\200X|+\324Q\016x\375io\212\350t\340T\017.\212\033]\271\017.V\377e0\"\373\251\f\215\204;(\233\007%\222\230p\216QT\324\241^\364\270\306\322\035\b\0362u\004]\257v\302\326\200\253\240y\324\347Jck-\3529\352\205)\372\r\2603`\271\031\237\244\t\3370\227&\337\257\227\215\266\377\004\306\270\362\265\222\243y\031\352!\362\214*\313\355\001\206#\006\371F\247\"\300D\317[\251\035\204\023\351i\243[:\"\274\251l\r\223\230c\322\027r\356\313\321\215\210+\261\006{X\206\200\343\202\352\333(&3i\331\216d\347\357Y\3032\fx\bd\203N\333\272=\317\323"
+	.string	";H\357\2066\275\306\232\355q\306\200p%p\263"
+	.string	"\004U\032\003\300IQ\327<9\227\017\252\374\372"
+	.ascii	"\317)\020\320\3010UyZ?+\243\352|\301Gin\220\t\233z\031\257\210"
+	.ascii	"\216]p\373HG+>7\267\030JM\325\300\204\221\204\025\371\327\267"
+	.ascii	"\307\240\225\037u\\!c"
+	.ascii	"\334\b\374m[@%\361\246j\342\212\200\336\353\005g\231\200\313"
+	.ascii	"\354,\b\226\376B\314\331\035m*\030Y\022\246\024\377!\272|\246"
+	.ascii	"P\214\333\266\n{\276I\024\321\247\242\202\001\272\215C\347\256"
+	.ascii	"\253\307s\345NK\362\354Z\370\247\f-*\241/\027\337\026\003\303"
+	.ascii	"}(\354L;\256\361E\255\006\313\272\374\346\031d\273\334k\344\337"
+	.ascii	"\365>\200\216H\364\302\314Y\266\307\207\306q\312/\001]\227K\016"
+	.ascii	"/'\210\360&\334\333\211h\235W\275\353\253\316f\326z\206#\202"
+	.ascii	"H\257\001\306\312R\367\303-\322Wa\301\301\234\351G\361\225\247"
+	.ascii	"\347\256\301\216V\n\250S'\005\252\267\240\036\263\264\027M\366"
+	.ascii	">^P\327\352\036!\0012\3034\242\205\304\372\256\237\3354\020\310"
+	.ascii	"\372\301\301\017\342\342\227\254b\210\346\231\213\304\024\363"
+	.ascii	":\330v\355\207\200\025\310I\323\243\202D\2001)\fQ\001\036U\337"
+	.ascii	"\340\226\334[6\377z\345'Zw\036]Z\217\231\246\322{3\201\327S+"
+	.ascii	"<\321K\037\030G\206vK\327H\"$;\220[82\325\005\277(\344\305\032"
+	.ascii	"k\017\262\006\206\213\310\245\223\034\257\350\360\206\244\274"
+	.ascii	"\224G\312\256\034\001\307\024\376\344A\371\220H\333\247\206\212"
+	.ascii	"\362\032\220\222\310\215\370\372\327\034aJq\00265~\302\367m\312"
+	.ascii	"}B\bn\261u\354x=\006\326 \216\353\272\370u\214^\337\343*\360"
+	.ascii	"Ia\365\251>\300\004_\333\337\216\002X5\3560\025$G\234.\340\b"
+	.ascii	"x\345]\324\365?;\326\030'\216\315T7\206\3015\017\373G\253a`9"
+	.ascii	"\353\210\016\022\277\001B\346I\270}3\364\303PX\020\303q\351\353"
+	.ascii	"\264`\211\307\350=\300"
+	.string	"*\271\016r\202\\\245\302\2164\354<\2003pz\\l\022]0\021'o\246G\216q\340\213\002O)\340\313\217no\004\033/\374\375\244\f\003\035\222\354\332G\257/o\327s\2626r\352l\031\277\215\307\244\032\254\275\202W@\277]\373\353\372\244:\261\241\340\024-\r\233\275R\200m{\353\177]\t\263e\034\017A\027\t\360g,@/@\027o\203\027\255nC\2720\"\006 \022Q\333v\357\256\r:\245\036\315\003(\276\t\260$\366M\323\351\034\344\201\036\302\236=\225x3d\035\265\216N\372;\\\276\\\302@\242N\241|Q\222\334\240,i\223\312\032\316dP2\351\236=\307\231\\\fA\007!\233%\017\220\364\272\226\242h\234\210\364\322\313\225X\037I\215\303\276\346[=PV<\331Q\371\016\006\017',\237\001c\250\260|B@\365\367\221!\303\342\201]{\225\337=\233\250\224\027\027\355B\267S\032\307"
+	.string	"'\316\243\336\257\262P\221]\034Vr\230g\031\252\251\357\327\330\372\177\013N\327L\306amGY5\021\375\300\200\263\253\212g8>\374\245\243\220\"-\272@\211U\303\231\306\035\237+\341e\027\305"
+	.string	"\307,\004\003\235\341Y\220\016W\320aE\221\235\261\353\333J/k&\266\253\346vO\033!O\223\263w\277+d!\3558\252\034\224AF\261\003\033\203\313l\302\213\355\\\336Su\245\r\262X\316\225x'p\375\316G\372\351\262\016o\rc\245X\355}\250\024PLJXs\205\002\006Kv3\n\2468\316\343h(\006\304\301\373\233c\227\353&\207B1}#\361\375^\301\031dt.\341\252\fV\3353\032c)\360\350\363\321\270k\232\327\025\377F\273e\207\357\024\3765\205r7j>Z\275\375\345\234N,\210\326\342\210\363\3522\016\352=\366\016\365\233=\354c\262\216\363A\301x\201\032\357\351y\317\307d\333\024\210\345\225\322\214\005\371\202\327a\224\315\260\250\3345\354\2619b%\002\007KEWVb&\344LwW"
+	.string	"?\372m\316f\004\364C\002~\272\214U.v2\r\337>\253X\021\261\335\017\300z\022P&\003tZ-X\316X\037p\205\242\347\b\272\3776\346C\\\320t\313\262dM\256u\216d\036\312\b\214\345\304qt8x\335\216\034g\217\017f"
+	.string	"J\177\214\234\311p\035\265\320f\2000\255}\377\270\315\364\340\3776+\365\"\023d\330\321\033I(};\212^\234\322<Y{\226#\001\304"
+	.ascii	"\360h\332\277\360\333~\343xZ8J\002\3659\346\341h\373\331\355"
+	.ascii	"\205\327\021\260P\362\334\250\217\022\357\344\360A\301J\013s"
+	.ascii	"\335;\337\204tf\344\f\275\370\373\251\207\266\331m}\177+\230"
+	.ascii	"\211F\332_>qe\335\311Y\257\364\274P\214.<\226\306\370\372\266"
+	.ascii	"\213\t\254\307Sq\220\267\345>\027\303\366\344\307\207\232'\037"
+	.ascii	"\031\203\202\027 \223\\\346\232s\333nA\367\037\023"
+	.string	"'f\255\256diy\256\201pff-FtV\362f\334T\230\031\312k\210\257SVm\372}\303\233G\371\2732\350\347\344\374\320\312\216\364!\0017\031\322)\360Z\232\002\273H\274NC\006\200+\242.\310\226\336\371\b\017}\336|\350P>\305\330N\212\274\320\373\230\017\002)\346\t1V\254\355\320\365\025=H\234<\225I\007\333\327\306\341}&\0047\022\272&\177/\302\274u\213rhB9D<\346\211-1\346\201s\246\307\367\216\025E\260\357\027\030\315!\030V\300\024\312\311\2470\376\003\334\3046\254\317Z}\232\202\020\357F\265\346sr\242\270\215\345\032\334x3\275\256[\324$\177N\305\214\343\233\342\261\277%t\357K\374\237\333_\217K\241`\262\032\017_\341M\327*\236\035t\243\213\344A\216m#1!~)L\376\345y\330gg\224\233\273\225i\360\005\363=N\252ka\260)\017\270m\276\006\307"
+	.string	"w\247\356\372\031\036Z\346L\013R\202\034\226\017\200\364\204/\244\255/\026@\235\201\265d\310\226\331\002\263\274F\003p\324\257\304\013\340E}\024!\252b{\227|\201O\b/$\033%B\315\245\231\300\020\2122\333\274\306\374%\016\032\236\006\236i\205"
+	.string	".a\263d\202\276\003\247\243\326\237s\231\360g\365\b\204\213%\331*\213\314\246~\221]\215\b\317\272\032\333"
+	.string	"\217\316\264e\345"
+	.string	"\035\310\254\230\3318\3754\007|\362\0246\253\"w\025\246\224\371\224}\305\\zf\304\001\334\244\233+2\270s\020\377ukkmX\021\374\216\b\002P4\300\002\246\370\300\337\241&\004r\362]\345Y\215G\b\034y\030M\265[F{\363\265\007z3\346O!\005\"\266\214\345Pfs\273S\232\376J0Wp\f\ban\320\035\3333F\312`m\341(3v\262\n\206\271-\002\243v\n\260\343\342V\203v\351\024\340U\353=v\005]&\265SM\2163\234\254\f5W\017\221;\340%\\\244\341\231K\217P\276o\031\204\017\347p\035\375\277\270>\336\352\231W\305H\306\370\0204~\177<\026AHC.\315"
+	.ascii	"A\023\230\b\252M+$\303\214\2008/\343\343\367\307\021\376n8\232"
+	.ascii	"]\201k%\354\305P\327\3178\032tD\213\005\244z\353\371\374\347"
+	.ascii	"\270V0\2557\214\312n\326:\037\320\352zkgh\342\"\021\364\266\314"
+	.ascii	"\305n\013U\035\005\360,\034\0160A@Y1\027?\b\030\326\342\217\326"
+	.ascii	"\227j\311\200rTC:\007bB\024\034`\220\243\344\371\322\211\242"
+	.ascii	"\241\3610B0\301\264'\333\232C\236\355\272\022\324XT\322\225\221"
+	.ascii	"E\232\312\013\354s0\311\230Xz\201\316:\373J\253!y\247D\377\326"
+	.ascii	"\325\354[\210\030\204\250r\373\240\272\335F\206\245\234.\246"
+	.ascii	"'\367\265\247\215\222Xm?\236B\200\341\371\320\311\03210 \030"
+	.ascii	"\032\301\346\271m\300\221"
+	.string	"\247\240\361\037\002\b,\322p\314\334\036E)\267\322\237\322\210\255Jr\372\202uLIa\332\263UV\354\271.\233\203\225\r\204l\035\3549\255\220\231=\334\3360\2107\375m\016\340\331\004\330Q\031-\033z8\"W\236$t\024\001\335-\204D\001\254"
+	.ascii	"rE\342\357\210\205\226\315A:>\254YZ\374\220\357&\340d\3568\273"
+	.ascii	"\375x\b\364\364\356T\001\327w\270\316\231J\250'u\314!;\336\365"
+	.ascii	"^\303\321g\376/\324\224`YW\214\212;\007\312p\357\025\322\371"
+	.ascii	"\330\214T\277I\347\221\216\t\245\223\204\277\226\005@Q\232 \202"
+	.ascii	")\020\333\265m\330\032\2757[X\334\f\257\267\035\361\356\257V"
+	.ascii	"zB\274\"j\234\254\362\353\316\r\307\177\025\031\005\306\231\360"
+	.ascii	"\263L\001\373#_j_\305{\f\316\3003\376VOL\333\310p\321b\320%\002"
+	.ascii	"\247\272H\0318\242\205+\217}\371j\023\031\027P\023\206r\334\201"
+	.ascii	"cj\236\n\327\273\004)\270\245Z\024\367\323\231\005\\\277\250"
+	.ascii	"u]B`\310\306\016\204\214\036=l\373\\\372%\231\231\024\366%n\315"
+	.ascii	"+\f]?\241=w\255\225qf\t\362;\237\245#Xd\354\205\336s\363\210"
+	.ascii	"r\245B\023\230\252i~$\352d\024-\257\021\016\314\357<M\310qo|"
+	.ascii	"$S\2725b\232\254\003\315\371\234\351\257\251\006\202\275\340"
+	.ascii	"/*\312\203\2438\241\207\250\266+\363A\017|\261\ff\355*-\313$"
+	.ascii	"\\\336\242\316\365^$\225\364`I\bBv&q\312\244\323\267\343\314"
+	.ascii	"W\3601P\374;\225\351X\244-2\265\030\251C\2129\rad\321\327\300"
+	.ascii	"\"\347\277\316K<\325\\\317\b\226Dv\262P\211\274\3115`\n\202\026"
+	.ascii	"qe\212\025\220\263\007\317\n\241\313\241\002\233\251\234\363"
+	.ascii	"\222 [yZH\310C(\002l\276et\276c'|\375%\224\355\022\277\367t\021"
+	.ascii	"i}9Kq\033_:b\004\333\2575\363\267N#Q9\343Lp-\027\363\330X\251"
+	.ascii	"\204P\007\3431\362\277Y&\b|\323\314O.E\220\373\373\215\330\362"
+	.ascii	"\304pz\033\026g\274\001se0diX\212F\233\340\372\035\343\326,u"
+	.ascii	"\343\273\317\215=lo\357\013\204\214>\370\207\t\\\025f\224\207"
+	.ascii	"\213\276\342F\226\274\345\214\267p\023\213\264\227!\034x4\t\310"
+	.ascii	"\n\3243\342h\223\350X*: \220\310G\320\377\301\033\306\353\305"
+	.ascii	"\251\331D\324\025\254\003\223\016\215#7Vjm'&\323C\303K\"\234"
+	.ascii	"\003\276\256\266z\346\262\377\327\323J\333\320\034\274\361\241"
+	.ascii	"\277Iq\360%?})\354uw\275[\222PiL.(\230\274\203L\352O\021\013"
+	.ascii	"\001\345\251\tz\276\324\365[\301\202\220\234\003\311K\007\210"
+	.ascii	"{f\333\351\230wI3\342!\202\007\026V\034ds\017hj\301\272f\210"
+	.ascii	"\203./\n5!b\0231\362\347\242\264\345\322\245\3605\023!L\316\300"
+	.ascii	"<\370\034\013\323}\344\t\241\033&\357\275\004\306\361*\361g#"
+	.ascii	"\222\331\222\203$b\272\307b28\372\277\"$\325\322%\251p\030\352"
+	.ascii	"n\234TJ\271Q\327jh\252\241\354\272\310\371\204\310\335%\234x"
+	.ascii	"\227\304\272k\343$\321\372E\022V\0047O\022\335\371\026f|\373"
+	.ascii	"\r\274G\360\n"
+	.string	"i\356\034\220\030\005@f\321LE/`\327 P\350m\324\264\0160w\025\266,\003\\\351\025\024|\t\fE\016\2773\312:\033V\250\224.3K$\353\0268\306m\372\n2\003\240\032\325f\035\336W\334\361\200bX\216\234\007[\373\b\211\376\021=]) %pC\021\3619\0058*z*hQ\236UN\202z\370\271U\026\261\212\226\364\025\231\341\232\305\2069\366\223F\276p\016\371D\356]It\276\226\3668\b[\270\220%\216\274x\270\230\263\317+\207\212 \213\331^\277N\316\002\307\033w\3438\214F\336 \373\311\201\240\361T\"G\261Dj\003.\207\326u\0217\216\356\227\210|\241>^\221=\324\023P\222v?\357\016\244\312\026\247\031\032\261\212\237\246\252\312\006#\034\032\270\225\365\034R3b\303;\265X\365\363\232\016\003\311oC\371\232o\036\177\3306\355\\Op\337.\033\200\374z\207^J\235_"
+	.string	"\366\002\003\377\334\220\214\317n:\214v\r\216\256\266\204o\362\031\213\256\007\305bU0\r\320'\350\005\203\001?w#\275\316n+"
+	.string	"\214\346\200\214+\315"
+	.string	"\254Oy\237x\326U\335\270\215\232A$\241/[\004L'W\211=\315\r\313\026\230r\302\254kbd\257\200\034o\316\022&.\266\020\026\004\203\034.(\202+\027\245\316%\345:\307\305\2273r\335[wR\035\331\341\250C\320_\373I\366\226\275\340\006\275f[\211\224\r\233$\350{\224\253\226~+\017\036P%E\216]\266\252\232\214{\022\323 |\212\211^5!8\271\301\262z\016\214[\313\325\303\230Lt\b\310\225\017\236\177\320w\243\354\177P@>S\033\025q"
+	.ascii	"Q\372"
+	.string	"bN\276\013\243N>\365*u\325\237\033\200u\006\32356Y\354\b\241M<\302J\035\003\307\225#$\247\335\016`\r0H\324\306\b\210^\310\233a.\342\245\212\241\362\325OL\327\311\306\254(\202\201\274\336\330\343X(&~\247\177\211\021\331\322\352\224f\022=\f\370kO<\232f\222\230\002\324\031\2458n\230\370o\033\034\213\036(d;\250(\213q1\272$\036\251\230\235\307\0214z\311\202g\027\201rV\215\325Hwn\242\203\365P\352hS\273[3\220\376\022GQ\251\264\201\370ye\023\277\246:!R\t[5.\1778|2\332(f=\001}\326\331q2\016Q\254\026\216*\214Su\243W\200\002/\035\030q\205`\301\331\262\233\320\3004\037\264\2223\261X\203G\006\325\027\317%z\274o\352\t\242|x\265\306@\013s\344?=\341\0365d>^.\276N\276G\366\222\033O\250b\361\244\275H"
+	.string	"\304\363\003\2504\200\364\034\0343\002"
+	.string	"\326\254;\352"
+	.string	"\352\272T+\274R\337\003A\023FD\020\376\225\221\302\206\037\260=\t\214F\027\213{?\206\27442\020\221b\036\201\377tU\354.\263\266\361\230b\355\332:U\253T;\221\347\241%"
+	.string	"\023}ddH}\034U\320\3210\364E\357\tp\330\342\035\252\t2\003\r:\236\312\200\320E\034!\234w\206\211\305\274\244\251Of\244b\312%S\r\205\262li;\035\261\b\315\261\364\354\f\3149\032\366U\233\202\3338)"
+	.string	"\261\230\370\353\267\031AM\255r\340\321[\257\330\372\351\310\266\365E1\207\202\027\001\017\251cNge\251\031\337\037+W\242\203+\r\376\272\310a\330\017A\343\036\b=X\374\276\224\225\035\343-1$I\225r\267\271l\005!P\001\371\370)\213fs\205\033Ibf\253n\035\265\245f$\003\246\035($\327\017\357\312@\250\243\200@GEllp<\214\020\307\214\300\363\232\034\240E<\227n\340\256\243 \r\236\250\241\t:L\003U\340d"
+	.string	"*\021\020\263\365\220\331?\257\210\007"
+	.string	"\232\264+\030MUH\304.f]\267T@\326a\t\004\245Q\227\352\271|\354\232F\253\353rh\023`\352\200Fd\026H\252\200K\302n\270.\263\256\276\330\354\310\340"
+	.string	"8K\267\213\f\220\261\001\026\025JBp\007i\317\001\347\326Y\303'\301\300\317\340{ v} \277\223\256\251M\200\364\314\207~"
+	.ascii	"\346\262p\266\215\316@5\b\210U\342S\312\257pEY\322\25326\326"
+	.ascii	"\313\3022/\242\361\263&:\301g\227\267\336"
+	.ascii	"5A\023\255\301\022&\274\2603\253\177\274\371<\203\251\235\207"
+	.ascii	"\005o\273p\324\324Y\by\257Q<\210\246Jl\355FXg\352\032\023I\275"
+	.ascii	"\227\023Y}5\026\267`6\247\220\005\300<\013\231\203xf\205Fp3\243"
+	.ascii	"\324\245\371\307\361m^;\215\304(\342bGB\n~\237\376\326`DN\233"
+	.ascii	"\347NH\026\347B\254\344\214\ti!\367.6\t?\n\240\365\264\023w8"
+	.ascii	"\215\217\303\204\204K\301\343\253}\035\356\356]\200\367\203\313"
+	.ascii	"A\224\307\034\033\211\252\350\342b{\352ZJ\270\235\214\374\264"
+	.ascii	"2\307\r\236\334\256\032a\267\320G\331g\370\177M\020\2001\344"
+	.ascii	"1\351\215\243C\250\b\"Hj\273\353\207\025\253\277\247\203\312"
+	.ascii	"\023A\276x3\024\246\307\231V\177\216u\242~\302n1\254\364\203"
+	.ascii	"\331\243\235>\253\220$\241k\020\302\333Cz[\310$\275\004Qd\220"
+	.ascii	"\375[\323\352pxr\213\334\251]\360\303_\227\213\345\223\240\336"
+	.ascii	"W\3411\177\262\224Dug\313\b\272_]\316B\354>tml=\307\222\270\353"
+	.ascii	"z\016\0342E\264\312\200S(Z\360\246\225\003\342\r\226\310\230"
+	.ascii	"\245_\262\355\314\235'\250\245\355\254p&V\334\207\351\220'w7"
+	.ascii	"'\224\266P\257\344H0=\255\310\t\n\361^]\203t\372>\230\2156R\323"
+	.ascii	"\036\036\031$<\265\016\226\017\337p\331*?\204sz|\271\300\306"
+	.ascii	"P|\326{\237\303\205\006\203\351\312|\233\346\026f\243:\200oj"
+	.ascii	"\255\347N\r\225\320\025\017\324\363\330\360c"
+	.string	"5\001\211\"\021'\026\356\343<Ok\273hH\247\323 \004C\266\265\254\256\007F\235\006.\370h\023\347\320\232\007|\311\237,\030\337\265^\350$v\350w\230W\341(\tu\32282\020Z\212B\236\007\026^\034\t\032\332\245w$\312\3735\217\336\267\336\202\223\317\341\005\220\313qf=\032\215\274\201\205;\025aWE\rc\243\204\357\310'\037\216\254GN^\276\\\322'\022\244\210\341\223\343\215\2236\216\326Z\022\361\251V\344\2778\34745D\373~\365\326\324,\242\033\023\277w\024\326a\267\241\275\226E\224h\025v\223\351\353g\202\332\315\313%\355}\\!\270\037\213\026A\244\204\350\270\"\0348\300\013\324`\367\301\332\375\317\356\256_\207\303\237]\214\253\t\260\203\244{gI9\375\370<B?\250q\362\025\n:\006+R\335\201[+\273T\231\374\r\337|R\"\273\256\237u\032=\f&\002v\330\362\203)S"
+	.string	"\241\204lH\204\031[\f\027]\007\025\200!\351<-|\303/\265\361\3211\333\307)M\260G\023Tv<\306\350\306\236.\003\2016\023\366\252\371\020\274\312\3328X\"\352\\(\376\370\327uJ\363\021]5\265\212@\313j\324^\027\376\r"
+	.ascii	"\210~\302D\t\237\353>\024\314\201\207,b\242\035\214\335\001,"
+	.string	"\215fK\250\300\240\302s\r\324\274J\222\336\n\236 \313\200\340G\020\361D<&\320\357\031 K[\245\313Z\206\017p\206$\330\321\276_\265;:fq\2666\331Y\327\225v\237\275c\360\3225\035\t\220\301\214\034\245\215\350'\003i#\353\214\334\306\300\366}tovC\263\345g\t\300\235tT\034\255}\346\273\274;\027\370\362{c^\214\267A\251\322\305\202 (|\234t.\206\262\232c\310J0f\333i\033\332\302i2R\275Ig\021\331\376\227\2044\3371E\322\376\254\306\004\023\252B\260\036\022\353\205\350!P35\332\241\223(\377D\326^\213N<\201%\0019,g[w\350\354{\245\356\311WA\2122d\361\265&7\341\312\335P\006+K\252\302O!k\324\250\342\374K\247z\327\203\355<\2239\265\215\345\030\246T \336\326\245\256\n\bj\233T\207\003\225_\023\233*0\bN0\222\220\324\215"
+	.ascii	"\350\367\312\366X\230\333\005\220GQ\200\033=v\250\303\301\016"
+	.ascii	"\307\235'\377Ow^ca\\\332\224\fR(\032,b\361\224\324\274Ya\336"
+	.ascii	"r6\235\330f\200\327\330\0359\321\354\222\342\030\341\272\240"
+	.ascii	"E\333\247\255kLP\027G\244\333\336\026\372\214\315\\c\340\020"
+	.ascii	"zR\"\257\370\270P\371\273\252\020\"L\006\260^\312\371\024f\231"
+	.ascii	"@\226\375 \371\024\354\261\323W\217m\344\033\003\311\212\254"
+	.ascii	"s\030\346c\003T[*\325\362\307\3662\210\353_\032\266M\247\205"
+	.ascii	"0\346\263~u\2150g\356\344k\356\275\261\177u\234\354\270\256e"
+	.ascii	"#\"2\b\262f\020\334,=\251\230y\n2]z\276\023|)\202\261\362.\267"
+	.ascii	"\374r\201&\357B"
+	.string	".\024\3475\377\205?\357\3522\263\t\366C\377\215+\007\205i(*\201\370b{n\031\022r\354`\266\372\212\016\203Wc0\230~\204-\002\214\247x\361\002!8\346\300L\345\323\227$\215iX\022o4 z\271~n\234TY[\002\241\216\311\377Z?B\f4#\303/\353\3615\024\214\353x\261\345/\244\240\361\222\022\335\261\016\"L\033\235\232\365}\211\273\253\263\031\n\312\257\235\0351e.\035\033\222\026\024\207z\277!\301\327\262\204G\365\353Q\376&\"\276\231\357J8\030\314\036\342\340\005\226\240X!\353\324\212\f\206\370*B?R\233\352d;\001\231\330\321\2610\306/\333\332\314\354\264\204/J\216E\266\022\265\r_\221\227(\0323\312\026D=\353GC\350\374C\ny:\022\213T\024\276\245!\210\016+\326#\340>\231\025\002\003\342\357\267t\001\025\367\236\361@\234\262\034%*xl\204\307\252]\272\367"
+	.string	"\375qQ\341\273\220\327\202\00202 ]\215\007\260\201\031VB-8\231\034\342fcm\313\346\350\253T\302\331\210v \370h7\021\266Lq\251\"_+\211\007\351\377\2123\264/\322[\223zzS\017!\376\3004\204\243\303Y\261\253\276\352\324\200\336\212_\272.\321~E\312\224Yb\306\205\356\267,lOZ\203\0255\300\025\nZ\310\037\234\303d\360\305/ypQ\031\202fm\243KoL;\312\2535$J\013\031\206+\022\243~\b\253\006\331?R\377\307\350t\346\254\340&\n\002\223\367\305U}\303\232V\325\rpH\235\330[\b$,\023\227\265\367\253P\2057T\336]\377A\376\220\271\262E\205\265\372P\276\005\007y.8\357h\277\t\0071*\033/m0\030\024~\250\322\263\222\306v\377\206\366f7&\206\f\025FNe\023t_]0\310\247H\252"
+	.ascii	"\364\332vb7\217\234s\210\236b2\241&T!D\253\345Y\225\036m\241"
+	.ascii	"\346\330\367\016\366L\274\032\320\264\036\356\022\225\256\333"
+	.ascii	"\f\211\003H\323E\312\025\001<\316\2547\r\004\251J$\240\bo\252"
+	.ascii	"\311\334\244\306\030\340\367R\017z\236(_\310\303\345&PT\313\250"
+	.ascii	"\215}\313\360\023\237r0\303\227h\340W\033\230\241\352\200bn\321"
+	.ascii	"M\225\206d\301^}\322\355\250\221\347\243\016\200\265\030\202"
+	.ascii	"~\3728\3738\361\225\306\003\330x\320}`\341\017\314\261\235\212"
+	.ascii	"rZM\236\332?\336c\215\370\210\3212\261+\177\316\243\325H\016"
+	.ascii	"dG\r\253\275\230\320\350<\031\331\333@9);\023\271~\353,\221\001"
+	.ascii	"-\365\353\315\220rS\333\315jDZF\210\013\264t|\022U\004#i\214"
+	.ascii	"\324A\311\004\231\360\021\271\306\376\300'\324a\377\252\340\354"
+	.ascii	"\213H\217O\314\310\201v0\261)$\350F \341:X\262\020\253\364\365"
+	.ascii	"\246u\207\226\226\367\3515\371\rP\276B\302\002\361\217*f=\331"
+	.ascii	"\354G\026\221\223\322\035\341`\020\276\263\345\205\211\272=\266"
+	.ascii	"q\005\315x\342"
+	.ascii	"\332\251\034Jf\272\200\031|\ti\252\237%^\325\362\213`\202\030"
+	.ascii	"\367Y\261\006E\036q\251\370\300\255L\001\"\334&i5|{\327\336\267"
+	.ascii	"\354S\371,%&R\372ue\275Iq\360\212.!\031\313 \277\331\304\210"
+	.ascii	"/\270\370n\306\364{\364\322bf>\223\234\023\217m\307>\206\340"
+	.ascii	"J#\365,\215F\271X\264\344\304\314\224\356\002a\t7\342\b\214Y"
+	.ascii	"Zm\205A\n\235C\227\302R|\333\331\253\267\305V\324D\2744\003^"
+	.ascii	"\343f\003Bb*8\034\002gC\320t}"
+	.string	"\003#\305\2131\366}\373\306\202\026\226\244\272\016\022P\217\034\033\372\226\216\215\f\352\233\205\332\335r\"u\344\202SDn\020]\360\367\200C\006()\350\233Rfb\224\3600Qf\0248\322\235\032\216\350\233h\3641\035\030:\302\320\255\f\302~\262\356\304\226\351\377\001\246\002\224M.\222t\24200-\322\364\325\002\331x\274,\204'\035Q\343\310FE\017\312\b\t\203\251\272T\024\364\0261\265\203+\266\241\245\325*\004\001 \223s~\004\201@\324:\264\242'\245hP;\240vv\005\340w\n\214\325\333Tr\204X\220\030\335a5oh\177\221\253\357\2577\254\316\205'}\203\251%\036k\335\327\024;\031\304\307=\355#\334$\226;\224\305\304\321\263\nj\3724\365\0352\r`\223&\261\350\017\017\235\247\262\004\315\277\nL\335Tp\202\033=\250\351f\036w\026\320r\265\272\247\203\013T\326\327Xi*Ep_"
+	.string	"y#\r\224\215\365Y\231\306\263O\r\032\252\006 \337F'\"`\256n\177\276\323\363\310C[\313\277\nV\323\306\315u\373\b\236\341\367\241\037QI\036u\"#\345V\354\213\356\\\231\0301\244\023i\031\221\242\321\211\246\032_\024\222\235\273\272\205&\371\017\217\360\006lZ\326'k\322p\263\270\361tFU\366\351\264\306\252\236(5\240'\326\237\022a\260-g\201\3552\350\204\004^e+\263\223n\354Dn\365\\U\271RH\275\242\363\3145\033\0344\201\362S\371\311<\226\257 \231\330(\037\226\221\205\031\266,\373\"\021\215\200i\340\307r\350;{\315vI\356t\032\277-L\032aqw\366"
+	.string	"\004{\361\226\252\231\214=\312\2009{I&\341\251\235H.\331\357Q\315\260\024\364\270\232l\247w\376L;en\t\316bH\034C(\240y\017\017\031\2240n\323c\037z(L;x\334\rsR/\224C\365\326\322\273\377\212<C\243\256\335\206\241R\360\325g\332\3222)\337n]\025\226\261\330P\321\354\262\250\003\324a\356\345\255\320z\253\332hoS\376?\nf\272\326\336\026jiP\312.\201\225\330G\204\331)rJ\361\352`E\366\201\222|\261\254\203\377:\211\271\373X#d>\266\371\272\244n\361\017\370\347[\252\022fw\f]\200e\025"
+	.string	"&\210\306\257$n\354[|n\200\272X\240\320K.e\306%\255(D\322\247\213\376\0277\345\242\2300E*4\2241\213]\024\360\r\354\313\221\301T\0132\214\350CK\243\031\341c\026g\370\326q\331\232\327\312\210oi"
+	.string	"\252/\357q\215\"%\257t\247`>\223(\013R\223\375\327\t\006\352%\217k9\355i\273]\237,wG\207\327\270\377\306\362\374\336k\353\032\376\227UN\343\240\312\374n\316\224}J\235\347\277\246\254\364\254\366\027-P\031b\021\244mY\367\036\033\346\315\001g\336\225\374\325V\272-+g1\232V\340\237\316f\223\030;d\036\212\332\260\376\007\311#:O."
+	.ascii	">>\004^\013\341C\302G\263\341\355v\t\r\f\301\264\006\215\203"
+	.ascii	"\324C\324\n/\\Nv\307(t\245W\3364\r2\220\317P\274\264\225\342"
+	.ascii	"\267\330R\017\276\313\337:\210\3230 \215j\004|\227\22268>\022"
+	.ascii	"\246\bF\2327\004e\240)4'HR\2264\337\024N`1\250\311\221=\376\243"
+	.ascii	";\226p\360\342\373\375\246\335\213\303\347\252\037Z\304\341\354"
+	.ascii	"w\224\177\307h\270)\276\026\317DB\313\270\210\n\n\277N\202\032"
+	.ascii	"\266p\330\377Ty(,lK}\257\b6\364\334~g\225(q\262\020\237\275\375"
+	.ascii	"/\020\360\247>n\b\260\364\242f \373\356\034\351\034b\235_\023"
+	.ascii	"i$\253\360\310\204\3451\353|\335SC\023\250\312\006\2468\244\300"
+	.ascii	"\337#\334\201BP\363Z\362\203\033\304\231e\261\312\370\264\346"
+	.ascii	"D\367\236\310\270\207O\244\354\305\260\207\326D\211\354\230l"
+	.ascii	"o\203A)\3245\201\315\364\341\356\270\nb\r\256g\203\022\337\314"
+	.ascii	"\365`\f\354\327\265n\350__\026\230,\214)\251D\3350\322\266B\217"
+	.ascii	"\"\220\b}\331\252"
+	.string	"\354\317\275\032\246\377P\033\252\360\303v\2134jzI\317p\207\016<\275\324\374C\235\203\323\025\177\303}6\b\342\f\3569S\b\3603\305+\237\254\235\2050\344\0238&d\344\236\373\025N\225_w\262\345aK\322\315\fpi\217\031\220~%\007\247eh6\214\002\257'K\330\361\344\2019\340\177J\221\333r\022c\177\022\330\374ns\300k78\205\230\207x\241\"\326\315\024\030\212\346%^w\031\257\255\320\307\b\316\345(k#\262\342\264j\001\034`ohI\324\2339\207\022\331\310\230\n\004\257n\262\364x\024W\337\201\221\3708\355Yw\203Ga\214\334r\3520\201\20068\234\207\271\016\260,\0056\253\313\0371pl\031\202&\243\237i\322 \311>\"\320\204\013+n\255\b<\256\013\342iK\023\206A\bD\001%0L\2039\332X\337\021\013\331\324\337*\204C!\017\223\261\255\274\216\006\0370\3422&"
+	.ascii	"\267Y5\220k\301u/\b\234lU\230\252\274\222\376`$\371\013\251H"
+	.ascii	"\374.a\2025\330\270\035\224\211\262\003\027d\350\367oX\033\037"
+	.ascii	"\016\nf\003\n\033\320\301\231\255\020~Y\262v\027\271\225\374"
+	.ascii	"P\004GL\t\233P\312\277\336\035-\275\\u\235\0328\347\n\341\013"
+	.ascii	"\"\223\177\323T:<\247\276\254\013\024K\"XT\374\305tf\326\232"
+	.ascii	"\024\005~\\\303\251\024\250\\\3119\220\267Q\231\323\332\233X"
+	.ascii	"\225?\233\250\270WC|\311w=\200:\376\037\333Z\210\237V`\341\323"
+	.ascii	"8\211\351\212l\311\3732\2154\252\367\341\003\2255\351h'\003\356"
+	.ascii	"(G\347|f\007\205\377=\030\232\303\254\231h\035(\240C\275\220"
+	.ascii	"\225\025\340\205\361"
+	.string	"\304Mhw*\206J\264=;\2258%\034\327\302\363\201\244\331\320\034\362z[\r\257K88\237tEC~\323\001R\267)U\261\021\037\241\267uH&\374e\271\307\260s\335<UcWzh\274\007;\272\262\342\252f\221\374\006C\030w\230\234\222+e2\322\032\241\313\306\335\004\304\315U}\307\301#B\020\300S\372\327/\306\307T|\326A\344\344N5\353\321M\336_u\220\222zv\210\222\214\325\231\227\315\177-J\317\201\203\211\211\032\313]@\255\233\336\237\217&\204\311N\020\267\242\001\277b\325\371\215s\362\f\256\242\2414\357$\242\265\375A\233\026\251X\311i\262\374\3358f\361^\222\362\232\346&\205\223\027\362[\257'h\030\354\254\023\257\203\005\302\236\317\223$\032~/\251\020jUW\032\301\372\272\220I+\r\266\260Z\277\301\306\007\264\235\222bI\236A\241i\261\020\360\274\016qu\037\"\211%\362w"
+	.ascii	"\377H\343\374!\031D?\020\205\316\277>\244\214\307\277\240ij\204"
+	.ascii	"\373\236\331\246\340\0162\020aa\006\302\3473M\013}\251\307\226"
+	.ascii	"l^T\030y\277\245\373\253\247;"
+	.string	"\263W*=\312UT\243M\335\343\206\344[\235l\347\377\337\262/=SOQ\207\037\213\f\365\310\006\027\266PPl\307+\263/\362\370B\362e\310\034\360\215k\013K\317\224g0\205\255x\336V\344b6\220\317\211`R[\177'\001\221\355\212\343p8\236\030\204\324\230\231\212\277\267\333u\237\023(\205+?\345\310\3763b\256\356\321\212\005H\273=\355\340&r\351\227\3240p\341=\t)o\344\356\362*\264\221A\177\247\177\277a\321\031\305\037\261;:"
+	.string	"%\257\226x\330D\002\330\246\n\350\034\302{\320$\273\r\211\215\313W\221\201#e,:\2478\237\265\376f\304\035\242$\265\251\353\321\316\375}\315\375\210\233N;{~M\272\363S\243\346\327\370\322h$\177a\362\311\205| >\211_\243S\254b\210q\240\202\2770\243\342\bk|8i*(\305\027pXZ@\363\323\254\0353\346v<\220\377\223\033\256\204(\277D\260,o\016\031\361\340\315w\020\\0"
+	.ascii	"\366\024`\273Y\223_((\301\345\345kZ\036b\023\313\21191\250@\220"
+	.ascii	"\363\234/-\2005\232o\243\312\220U\346\300\317\277U]\013\241#"
+	.ascii	"E\310\356\026#\313j\024Y\251o:\236m\025\256\t`\213\274\002\235"
+	.ascii	"\035\020\276\250o\302RF#d\346ss\033\205A\f\235\250\177#\235Y"
+	.ascii	"V\0344,iE\206$\220\2472\311\004\304\177\r\b\242tg\243h\202D]"
+	.ascii	"=B*\354;\027_Fkq\355\207o\364I\025\255\320t\006\220\361#F)%g"
+	.ascii	"\260\007\206\371\3502\342\203$\233\307a\373\035\341,\263s\013"
+	.ascii	"\230\354#\377o\206\327\024\345w\026\211\311\346\350\001\250\271"
+	.ascii	"\222\214<>\344\200P9\254\240z\264\264\262l5\205\2759\n\343\013"
+	.ascii	"dE\343L\333\326\022\237p\235\325\326\212x\241\020\224k\250\365"
+	.ascii	"\023\256\257\344\256\320\260g\301m\037\236\232\3201^Z\017m\310"
+	.ascii	"G;\344\211\202-\226\022\370\n\3002#\004p3H\301^+\317\253\251"
+	.ascii	"\331\342W?\2734dBM\347\351\226\035\346>s\306\250\237\007j+\373"
+	.ascii	"/\372I\313g\341\313\215\240\020\311:\332\325b\300Qa,.\"\342T"
+	.ascii	"\240\335\231r\020\233f^\210\370\327@\324\270\316\032\027\224"
+	.ascii	"A&\310\264\002\371\210J\201\312\367\375\361\"s\240vi\f\001\256"
+	.ascii	"\221R\016\f_\220\235\242B\352\375\335 \323!\022(\276!\341Gg\001"
+	.ascii	"5\205\265|\3570\371HG~\235\232\206_\305G\243a\244\266\202\200"
+	.ascii	"C\210@\251\241@0G\305\203;"
+	.string	"t\335\016\231\n(\312\217\276\376\177\220\200\310-\025\355\224\323\212\310\222WdA\t\321m\b\354k\307\367K\354\255\240 \241\361N\310\256N\254 \240\260f\007g\264L}\215\325-}0\275k\t\222\033\262\362\267}c\315J\352*\201\212\323\327\361=y'\036nQ\\\233\207$\225\375\255\311hU6\351\266\321\231\307\351\374\265tY\267\032\327}\220\005\233\250\370\3448\373~\366\313|NE\321Xh)\314\3363\036[1\344\240X\236\204\241\322W\223/\202\2108'+\013\324\373\301u\260U\3545\262\007R\2611\021\371\322\302;\310\256\330\357\261*\213\237(\rJ\273\322\177O\007\003>\207-\327\222q\332\252}Ygcn\330\340\271\324;\331\026\034Glp\261\n\t+\233nb\375H\245\217\367\016\243L?\030\333\376S\3356\322r\222\350-\341\216\343^9\241\357\230\\\310\327R\360\376a\250\flU\277m"
+	.string	"\310\363\214\223\226\f`\376L\204p\320h"
+	.string	"\365\253I\301\341\2565\230\364r\3606\335\337\216\037\f-\322\225\372\247\374\206\325M\020po\244'\302d\312\335T\213\212\304\n=\357\246\327_\334\304\375\214\377\022~\367[\300Sd\270u"
+	.string	".\006\364\003\256\373\340\317v\233 \372Y\335\327\032\3501\035\344\277\365\327\222\016W\351\244nx\216B\261"
+	.string	"\203?\325\334\ba\370\025\t>\001\334\002\207\017\221"
+	.string	"/$\351U\026y6\206\347I\231\f\213\256\215f\372\233f\3145\332\024f\203\020\3373\343\335<F\367N\334\357\231I\236f|\364\221\244\3570Q~\250\333\264S]u\240\335\0173n\027\250\326}y\267`\323\276\327\236\234\341\177\324\370\304^\0012CwY\362q!\317%6\026\374\351\303\242CVh\223\313\331\377t\231\215\026\203g7\273\037-u6\231\300\243\323%K%\352\307\303Y\317"
+	.ascii	"j\3539\334W\344\232\322\227\372\2616=xqS\230[\352z\231v\251\366"
+	.ascii	"\024G\347S\3218O*\365\215\0339\235H\344\223\326\236i\345\271"
+	.ascii	"\"\274B\230C\037t\236I\325\256\005\343\002\265cn\366\341\316"
+	.ascii	"|a\277c='Z6Ypv\225\312\347K\320\235\367h*\320]\030\301\334Qa"
+	.ascii	"\242\371\372\016\253\303\271\033"
+	.string	"\006\362\033\252_\t\276\017\205\300\203\0256!\342[\006\021?\200\364H\246\364<\356\304G^\034\027\350\365\371\302\370\275\023\326\377!\343D\212\375\007~1\203\004\245\025\370\316\254\211\317\321\243\206\244\325\215\314\037 \340\214\361\345|\374\n7\204\363\357N\373O\262b\247\366\267\253O+\357#\337\316\0334\3645\274mc\202c\366\365\361D=\302\373\266\343\376.\334\345\f\362\312\262\375\310\257\263\250\274\247\3731R\320N\037j?\254\277'\332\237\205K;O\303\267B\362\254\2759G5W\316\344\333T\343\211\347i.\213\375\355@\006t0>td\302\357\366\032\216\004\177\204\322)\376\266p4)\247\335\006h.\234\360#\223\320\335H}t\325\237\020\213\243\230y!T=\376\264\225+\3517\266\256u\352C\by\005H\273\273\231\333t\003\224~b\356\t>\276\204\370m\350\032\034$\276\2717\316\036s\316\346K\232\315"
+	.string	"\201:\242\317\013\252\253\"\337\313{^\rjM\326Ly\335[\322\277\022\271K\331\205d\236\222v\216h\260j\240\227\336\035\267mC\361\n8\007\363\007\270\365\351).\367\013\345\341g\376E\360\226_\247R\277`\330\213"
+	.ascii	"\230.\225\265\331\356\263\326;\345\205b\371\230XK\2173\333\311"
+	.ascii	"\3424w\221\001q\310\002\027\271\f\007\376-\367\316:\224T\350"
+	.ascii	"'\233b]0\257\006\201.\2621\247\201\203-\024|\217\205\335\306"
+	.ascii	"V\361\032\363a(;XJQ\273B8\240\b\216\344\210%P\257\351\2137\345"
+	.ascii	"7\206g_\323F\036\363{\317\314\366\370\373\253\316w\312\233V\004"
+	.ascii	"\301\356\f\265#\237\333\302\031\205\215\303{\263\272\226/\215"
+	.ascii	"5k\333\037\341\0160\273\261\377\356\315?\225\340n\004\337\233"
+	.ascii	"\034\233\277W\312^\206x\003\317\026\224zUc\312y\333\213\372\215"
+	.ascii	"\267\356\021\256\301\317o:\256V\320\001\3743\3114]?\376\227\234"
+	.ascii	"\370\177\002`W\003p\036Do\351|\223\367\373\323y' \020l\334\t"
+	.ascii	"O\203\262nD\222\314O\362\314\265\033\213fxt\214\016\236\276\264"
+	.ascii	"\203\352\345\267D\366\241\372\305;v\273N\361\363\217g\365\353"
+	.ascii	"\360\025\002\355\r\241\207\332>\024O\003\373\025\251q\321\t\366"
+	.ascii	"\226\3640\245\230&\024\267\320@\035Q\273z\314\254>\036\223\325"
+	.ascii	"\212\242\316\275\201q\203\347+A\327\241\376\255\271\013#\334"
+	.ascii	"g\222\373\304\203S\231\177\201\034\361AE_\206\226\247\231A\037"
+	.ascii	"=\332w=\342\252\222\256Dao\213\326[\356,\231\277?\262\356k=_"
+	.ascii	"7\217\370#1\214\240\367\337\311\t\377\213\307\335\251\354W\""
+	.ascii	"\223\340,.Q\252\356s\243\276-\303\214;\317\364\265\2359"
+	.string	"V\305\243\345`\336\"\023o\023\313\267T\244<2\237\213w\253o\340q\007\205\276\333\225\342\253\375\007\253\357u9V\353\335F\241\375\263\216L\365\237\213\343\376\326\301b\373M<\037\205\374\340\263\276\316\364\375\221\334\260\302\366uL\322\212\275\305\361\026\211\367\276\013w\346+\375|\\\213\324\032\016\375\357\3577\361\375g+g\327g\327\034\251\374nh\355\013\376\001\330\375\237a\366\327\231\205\225l\357&\275\354}\377\324\224\177"
+	.ascii	"\344\323\225\344f>\036\031\322\353|\226\375\224\227k\363E\314"
+	.ascii	"0{\263oM\226]\013O\347p\215\036\217\205\031\332\234\276\322\243"
+	.ascii	"\336`\325?\327\360\247\\\277A2\226!\372\316\307u\346v\2211]\316"
+	.ascii	"\\\354U\301A\367\255}\253/\\\373\003$\3604\230\326q`\270\257"
+	.ascii	"\02357\003\027\371\204\216\237b\270n\035v\026\177lsY\370\224"
+	.ascii	"\013\3662\370m\255\363\017\343\223\177g\\\037\377\201]&p\271"
+	.ascii	"\254{5\271\022?o\300\374\373j\340!\202\301\022O|\334\024P\362"
+	.ascii	"3\330\262\264\006f\037\324\333&A\266w\203\253\274\r\343\263\326"
+	.ascii	"\302\213\025{\232Kt_\300.\335\324\203\363\231\344.\037\351l\377"
+	.ascii	"x\354\036\345\020\223\341\370\310\3367\335\276\200\333F.\363"
+	.ascii	"a\357f\270\036.\265\200\033\363\200u\253\270\r\315\352\303\367"
+	.ascii	"\273P\347\221\335\251\330\236\002F\372\001\034\276\202\357\333"
+	.ascii	"\004\304\345\325\303F\302=\370'\267\371h9\326d\315\357\370\035"
+	.ascii	"\271xn\2309\304\017\317:u\001G\3761\032\013b\361cP\177=\350\007"
+	.ascii	"\261\335\363R+\236b$\346-\261\313\371]o\302J\223f\346{\016\277"
+	.ascii	"\322@\277\230\252'X2\351\327\370\364\322\031\323TG(\337e\365"
+	.ascii	"\356\320\006`v\223\230b\225\n\374S~,\256\335%\275.\3309g\013"
+	.ascii	"\325eN|\330?\177`4\346\b\236R\325+\362\037e\334+\263|9\364-\177"
+	.ascii	"\235\021X:\304\244\3713\034\301\304'\304;\262\236\336\3671\214"
+	.ascii	"\247z\203\252P\357\210w\260\220\375yD\244\3372E\036\245rv\265"
+	.ascii	"~\242\267\205#\364=\362\336\017\341\327\317\021mB\271o\272\312"
+	.ascii	"\027\231\365r\354\035k}-\335<\n\\\023\312_O\257\232\336O\345"
+	.ascii	"\315\013b\346\267.3s\203wrb{q\317\331W\177\231\240'\003_\272"
+	.ascii	"\013w\016\335\310O_\374\355\356\322\302IG\277v\352' X\270\310"
+	.ascii	">\024\250_Q\022C&\226\353:\201\345\016\245O3\375\213\314^\261"
+	.ascii	"\262\003\244_\240d\372\223yW\361a\200\254\243\302k\2439#NvE\017"
+	.ascii	"\037A\006\035\260\321\212\243t\356\350\336\340\326\0168\250\325"
+	.ascii	"\311\263\273\243\037\213\265-\2011\270\214\212\025CU[\332\315"
+	.ascii	"\201\345/$u\250C\007Y1\204\"F\2711N\200\250?\"\301'\337\375h"
+	.ascii	"\315\356\3467\003\027\023\320s\372\263\216\226\345\017\374,\016"
+	.ascii	"\276\243\236\006/\313\303|L\372\005\306q6\372[VF\353\371\251"
+	.ascii	"\320"
+	.string	"\277k\213#\340\200U\261>z\276\305N\214\032\312\330[\207\006o>\207Phd3\346\231\333\3265\231[\tI\373\336;\243\353\364\342\003\372\005\037\227\206\233\204\3665\020\343yP:{ \223\223\204c\361\343p\374\032:b\227\273\340v\223\372\251\372\345\013{\034\337\353fOv\342\324\245\337ar\232\244\235{\037\203\002d<\n\265_\346\337<\037?\270\234\2457;|:\205m\374\231\304\265k\316\316k\262}\264\272E\177\264\361\3001\313\374\317\367d\033n\307\315\r8\036\304\035\273yiz>G\314uM\216\007\b\001\303J\254\002z5\234\377$\376\342S\247\335\372\334\321a\b\250\237\360\376\250\177\300\364X\036\r\365\221\331N\202\031\223\330\276\034\277>\220\356\303\260\301\370\336\376\274{z\375\355\344\353:\272\241\201\360\372\271\333\227\316\005\321\275\243Y\242k\3615\274\022\332\254Vv\200\252k\274\235\036 \350\367"
+	.string	"\3755+\245\025\344 \276\177fET\377\001\001v\200u\367\231\336\327s0\345\261\324\237\006\324\024\250\362R\334\023\277^\317\013]57N\022f]j\331\037\373\214.m\3656\262(=t\3245\365\372/\022\005)\027\200`\251\355\225\331\257J\307\003n\265\276"
+	.ascii	"C\357x\342\026$\217e\037\344\210*\037\031\036\001\367G4\211\205"
+	.ascii	"\023:(\262kd-\377X\206x\177P\337!\204g\024\2572\263=\346R\224"
+	.ascii	"W\\6\343\b\244\35413\3705^:\334\221.\376\220\35375\273\323u\324"
+	.ascii	"\337\317]O\375\311\310\216\354\222v\215\261\376\006\375I+^\032"
+	.ascii	"\366\272\310\272\372\267g\352\357\227S\223X_\262\227\370R\340"
+	.ascii	"\335\016\217Fq\306\235m\355\276+\1770\362,\"K\232\n~\345\373"
+	.ascii	"m\321\371\3559_\261\317Z\374z\331\005Nwf~\226\224\243W/\033\354"
+	.ascii	"RNx\337\234\275^\365L\007W\212\303R\215\373b\016\227>\310\027"
+	.ascii	"~3\315\351X\345\354jU\247\371]\f\177\341|E\276\366\276\277\005"
+	.ascii	"M\003\332[\2357_-\2733\207\226\367\035\242;\350k7\214bo)\316"
+	.ascii	"\330\354\2014\237\037\313w}\363\356\2278\241X\027r\371?\213T"
+	.ascii	"\377\030v)\356\370\223\003\212r\307\223|6Yo\026\035P{\035tws"
+	.ascii	"=\031\021\203S\377\252&\376\t\360\235\036k&\353\216\226\225\027"
+	.ascii	"\tym\277\332\205\354\220\352\226)nV7\2713\024\360\334y]\221\372"
+	.ascii	"\307\206[\366?{x\203,$>=\225\223\330\306[\037\027\267\n\321\275"
+	.ascii	"\343\343\270\314\372\341\256\365t\370\243n\001\373\327\035\277"
+	.ascii	"G\317Gp\245\334w\320hE''F\026\233\300\201\177\035\330\333\230"
+	.ascii	"\342\342F\235\373,9y\306\026\272\377\275\365\256\227\271\272"
+	.ascii	"\213#\275\021\356\313\323I\304\246;\276\354\376\224\r\372\341"
+	.ascii	"\342^\242K\371S+\217\207u\274\272-\257\206\226\017\240\217\225"
+	.ascii	"\n\272Q\245\\\211\307\305\234\016\363>pW\335\301kW\307\354\004"
+	.ascii	"\265\373N\307\373\344\376&U\277\233\367\362M\375\2134_\233\273"
+	.ascii	"\364\264'\267?j\323D\265]\370\260\330+\310\366\332\373dj\376"
+	.ascii	".p\004eG\215\033\233\276\r\372ej\377\334\332\2514\257\264\331"
+	.ascii	"\263\264\336\313S\304\031\310?\212\265\210-\332\232x\376]\362"
+	.ascii	"\311t\341\025\002\262\273)<\020\031\377>\367\377\035\262\234"
+	.ascii	"\347\270\355\t\356\313qk\245w|]\3103{\364h\254\333-4\351\312"
+	.ascii	"\300#\003\252\301 \215?m|Z\032c4\345\302\212\374K{\023\213\213"
+	.ascii	"%\345\0354?\252Q\r-\344\233\321\331\303f'\277\353\307%\214\326"
+	.ascii	"x\267\023\317\236\374\331$\036\355\303\300\017\363\376;V\213"
+	.ascii	"\301\275\375c\206\373%\255\267ti\237\224\303\3139\313d~L\325"
+	.ascii	"&h\255FcF\2743\365\035\363#\300\037\327\001\031\330v\275\036"
+	.ascii	"s4?Z\364\372\177;\025\371\177~\337\200\350x$\036\242\221\355"
+	.ascii	"\314\016J\306\275P\220\355\207)\220\237\230R\237\217\361\354"
+	.ascii	"\3245w\374\260\221gz\017W\376\371\361\252\251aY\204f\007}\200"
+	.ascii	"\3673_>l/\267\n\2077\034\370\342\001\357)\311\360\247\354{;C"
+	.ascii	"\006Z\0337\307\013\215}\271{.\033\016bp\230\2369\226#|\020\304"
+	.ascii	"\250\300\304[pq^\300\277l\205{q;\t\371\347\223\027\265<.\352"
+	.ascii	"aKs\234\331\344\367\037#;\316\t\b\327\332\007l\271\375\030_\360"
+	.ascii	"\327\267\332\326\271<\241\3770\373\027\313\232\216\327<'\350"
+	.ascii	"7Vh\246\332\027\"\3759~\317P\306\367\224;\324\277\017\275\032"
+	.string	"'\257\007UO\027k\375\257\343\370H\271\207\244z\022\031o\b\375\215\354\313\220\310)X\216Y\354\211?k\371\313\256\226\327\327 :\367i\363p]\236|K;\223\315\t[\304\312\351Q\374\323\242\274p\304\267\252\347v8\356\211\316\213>\332\243\223M\370\263\267\233(\377]=\007j\203\355\371\255V&.q\305\274\241\300\030\353\320\243\"l\2420\237\326\357hZ\376|~\211\372SC\340\030\ni\200<P\210AF\207\315eY\220\374Yb\346\377\337?6+\307h;B\341"
+	.string	"%\276\316\246\200/\335\377\002\342\335H\027Qcl\305\272g\256T\257\017XdB\362aV[\315\223atq\233n\032\215\017w.x\031\325s\257nG\263o\306\233kn\375\225\270\036\360\254U\307\034aF\355\036E\237(\331\013\215\347\255\256yL]\353l\265\333\215W3kUh\337\f\221\023\270\303\006\033g\f\333U<M(x\256\325\311\371\270\367'\362\251\211-\006\232\366\223\377\231h;G\333i?k\355\311*-\233}u\023rcFM<\272\034\276\217\237\233\343\265h\006\030<\335"
+	.ascii	"k\006C\275\315+q\023\201/\332\244\177\b~\330r\003\373\025\367"
+	.ascii	"g\275z\271pP\373\031 \367I\316t\333f%\353\266\332\203\340\255"
+	.ascii	"\3201\274U\264~~\333\353?\355\275\333d]=\261x\023\324\t\377"
+	.text
+	.section	.gnu.lto_.symtab.ab45c4a884f61e48,"e",@progbits
+	.string	"cmdTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\006"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\007"
+	.string	""
+	.string	"cliGetValuePointer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\b"
+	.string	""
+	.string	"cliGetDefaultPointer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\b"
+	.string	""
+	.string	"cliPrintVarDefault"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\b"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\b"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\b"
+	.string	""
+	.string	"cliInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\b"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\006"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\006"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\006"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\006"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\005"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\005"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\006"
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\007"
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\007"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\007"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\007"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\005"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\005"
+	.string	""
+	.string	"valueTableNameIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\005"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\005"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\007"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\007"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\007"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\005"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\006"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\005"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\007"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\005"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\005"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\007"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\007"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\007"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\007"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\007"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\007"
+	.string	""
+	.string	"currentRxRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\b"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\b"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\b"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\006"
+	.string	""
+	.string	"pilotConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\006"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\b"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\006"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\006"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\006"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\006"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\006"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\006"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \006"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\006"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\006"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\006"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\006"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\006"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\006"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\b"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\006"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\b"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\b"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\b"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\b"
+	.string	""
+	.string	"lookupTableRangefinderHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\b"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\b"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\b"
+	.string	""
+	.string	"getOrnithopterProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\b"
+	.string	""
+	.string	"bufWriterFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\b"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\b"
+	.string	""
+	.string	"bufWriterAppend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\b"
+	.string	""
+	.string	"ui2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\b"
+	.string	""
+	.string	"i2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\b"
+	.string	""
+	.string	"pgFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\b"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\b"
+	.string	""
+	.string	"schedulerResetTaskMaxExecutionTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\b"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\b"
+	.string	""
+	.string	"atoi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\b"
+	.string	""
+	.string	"strtok_r"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\t"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\t"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\t"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\t"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\t"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\t"
+	.string	""
+	.string	"strtoul"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\t"
+	.string	""
+	.string	"qsort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\t"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\t"
+	.string	""
+	.string	"serialSetCtrlLineStateCb"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\t"
+	.string	""
+	.string	"serialSetBaudRateCb"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\t"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\t"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\t"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\t"
+	.string	""
+	.string	"strcasestr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\t"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\t"
+	.string	""
+	.string	"pinioSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\t"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\t"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\t"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\t"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\t"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\t"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\t"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\t"
+	.string	""
+	.string	"writeEEPROMWithFeatures"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\t"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\t"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\t"
+	.string	""
+	.string	"itoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\t"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\t"
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\t"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\t"
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\t"
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\t"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\t"
+	.string	""
+	.string	"convertExternalToMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\t"
+	.string	""
+	.string	"ftoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\t"
+	.string	""
+	.string	"fastA2F"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\t"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\t"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\t"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\n"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\n"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\n"
+	.string	""
+	.string	"loopSubtaskName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\n"
+	.string	""
+	.string	"loopOverrunGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\n"
+	.string	""
+	.string	"loopOverrunCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\n"
+	.string	""
+	.string	"loopOverrunReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\n"
+	.string	""
+	.string	"resetConfigs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \n"
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\n"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\n"
+	.string	""
+	.string	"featureMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\n"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\n"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\n"
+	.string	""
+	.string	"isModeActivationConditionConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\n"
+	.string	""
+	.string	"applyOrnithopterPidDefaults"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\n"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\n"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\n"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\n"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\n"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\n"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\n"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\n"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\n"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\n"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\n"
+	.string	""
+	.string	"sensorsMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\n"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\n"
+	.string	""
+	.string	"stackTotalSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\n"
+	.string	""
+	.string	"stackHighMem"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\n"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\n"
+	.string	""
+	.string	"rcSmoothingGetValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\n"
+	.string	""
+	.string	"rcSmoothingAutoCalculate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\n"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\n"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\n"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\n"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\n"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\n"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\n"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\n"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\n"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\n"
+	.string	""
+	.string	"bufWriterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\n"
+	.string	""
+	.string	"setPrintfSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\n"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ab45c4a884f61e48,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,13444 @@
+# 0 "./src/main/cli/settings.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "./src/main/cli/settings.c"
+# 21 "./src/main/cli/settings.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 22 "./src/main/cli/settings.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 23 "./src/main/cli/settings.c" 2
+
+# 1 "./src/main/platform.h" 1
+# 21 "./src/main/platform.h"
+       
+# 147 "./src/main/platform.h"
+# 1 "./src/main/target/common_pre.h" 1
+# 21 "./src/main/target/common_pre.h"
+       
+
+
+
+
+
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+# 148 "./src/main/platform.h" 2
+# 1 "./src/main/target/SITL/target.h" 1
+# 23 "./src/main/target/SITL/target.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 27 "./src/main/target/SITL/target.h" 2
+
+# 1 "./src/main/common/utils.h" 1
+# 21 "./src/main/common/utils.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "./src/main/common/utils.h" 2
+# 100 "./src/main/common/utils.h"
+
+# 100 "./src/main/common/utils.h"
+static inline int16_t cmp16(uint16_t a, uint16_t b) { return (int16_t)(a-b); }
+static inline int32_t cmp32(uint32_t a, uint32_t b) { return (int32_t)(a-b); }
+
+
+
+
+
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 120 "/usr/include/string.h" 3 4
+extern void *rawmemchr (const void *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 133 "/usr/include/string.h" 3 4
+extern void *memrchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)))
+      __attribute__ ((__access__ (__read_only__, 1, 3)));
+
+
+
+
+
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 286 "/usr/include/string.h" 3 4
+extern char *strchrnul (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 380 "/usr/include/string.h" 3 4
+extern char *strcasestr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+
+extern void *memmem (const void *__haystack, size_t __haystacklen,
+       const void *__needle, size_t __needlelen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 3)))
+    __attribute__ ((__access__ (__read_only__, 1, 2)))
+    __attribute__ ((__access__ (__read_only__, 3, 4)));
+
+
+
+extern void *__mempcpy (void *__restrict __dest,
+   const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern void *mempcpy (void *__restrict __dest,
+        const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 444 "/usr/include/string.h" 3 4
+extern char *strerror_r (int __errnum, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+extern const char *strerrordesc_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+extern const char *strerrorname_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern const char *sigabbrev_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern const char *sigdescr_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int strverscmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strfry (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void *memfrob (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__read_write__, 1, 2)));
+# 527 "/usr/include/string.h" 3 4
+extern char *basename (const char *__filename) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 539 "/usr/include/string.h" 3 4
+
+# 108 "./src/main/common/utils.h" 2
+
+# 108 "./src/main/common/utils.h"
+static inline void memcpy_fn ( void * destination, const void * source, size_t num ) { memcpy(destination, source, num); }
+# 29 "./src/main/target/SITL/target.h" 2
+# 146 "./src/main/target/SITL/target.h"
+extern uint32_t SystemCoreClock;
+
+
+extern uint8_t eepromData[32768];
+
+
+
+
+
+
+
+typedef enum
+{
+    Mode_TEST = 0x0,
+    Mode_Out_PP = 0x10
+} GPIO_Mode;
+
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+typedef enum {TEST_IRQ = 0 } IRQn_Type;
+typedef enum {
+    EXTI_Trigger_Rising = 0x08,
+    EXTI_Trigger_Falling = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef struct
+{
+  uint32_t IDR;
+  uint32_t ODR;
+  uint32_t BSRR;
+  uint32_t BRR;
+} GPIO_TypeDef;
+
+
+
+typedef struct
+{
+    void* test;
+} TIM_TypeDef;
+
+typedef struct
+{
+    void* test;
+} TIM_OCInitTypeDef;
+
+typedef struct {
+    void* test;
+} DMA_TypeDef;
+
+typedef struct {
+    void* test;
+} DMA_Channel_TypeDef;
+
+uint8_t DMA_GetFlagStatus(void *);
+void DMA_Cmd(DMA_Channel_TypeDef*, FunctionalState );
+void DMA_ClearFlag(uint32_t);
+
+typedef struct
+{
+    void* test;
+} SPI_TypeDef;
+
+typedef struct
+{
+    void* test;
+} USART_TypeDef;
+# 228 "./src/main/target/SITL/target.h"
+typedef struct
+{
+    void* test;
+} I2C_TypeDef;
+
+typedef enum
+{
+  FLASH_BUSY = 1,
+  FLASH_ERROR_PG,
+  FLASH_ERROR_WRP,
+  FLASH_COMPLETE,
+  FLASH_TIMEOUT
+} FLASH_Status;
+
+typedef struct {
+    double timestamp;
+    double imu_angular_velocity_rpy[3];
+    double imu_linear_acceleration_xyz[3];
+    double imu_orientation_quat[4];
+    double velocity_xyz[3];
+    double position_xyz[3];
+} fdm_packet;
+typedef struct {
+    float motor_speed[4];
+} servo_packet;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t Page_Address);
+FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t Data);
+
+uint64_t nanos64_real(void);
+uint64_t micros64_real(void);
+uint64_t millis64_real(void);
+void delayMicroseconds_real(uint32_t us);
+uint64_t micros64(void);
+uint64_t millis64(void);
+
+int lockMainPID(void);
+void simulatorLoopYield(void);
+# 149 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_post.h" 1
+# 23 "./src/main/target/common_post.h"
+       
+
+# 1 "./src/main/build/version.h" 1
+# 21 "./src/main/build/version.h"
+       
+# 32 "./src/main/build/version.h"
+extern const char* const targetName;
+
+
+extern const char* const shortGitRevision;
+
+
+extern const char* const buildDate;
+
+
+extern const char* const buildTime;
+# 26 "./src/main/target/common_post.h" 2
+# 150 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_defaults_post.h" 1
+# 151 "./src/main/platform.h" 2
+# 25 "./src/main/cli/settings.c" 2
+
+# 1 "./src/main/build/debug.h" 1
+# 21 "./src/main/build/debug.h"
+       
+
+
+extern int16_t debug[4];
+extern uint8_t debugMode;
+
+
+
+
+
+
+extern uint32_t sectionTimes[2][4];
+# 51 "./src/main/build/debug.h"
+typedef enum {
+    DEBUG_NONE,
+    DEBUG_CYCLETIME,
+    DEBUG_BATTERY,
+    DEBUG_GYRO_FILTERED,
+    DEBUG_ACCELEROMETER,
+    DEBUG_PIDLOOP,
+    DEBUG_GYRO_SCALED,
+    DEBUG_RC_INTERPOLATION,
+    DEBUG_ANGLERATE,
+    DEBUG_ESC_SENSOR,
+    DEBUG_SCHEDULER,
+    DEBUG_STACK,
+    DEBUG_ESC_SENSOR_RPM,
+    DEBUG_ESC_SENSOR_TMP,
+    DEBUG_ALTITUDE,
+    DEBUG_FFT,
+    DEBUG_FFT_TIME,
+    DEBUG_FFT_FREQ,
+    DEBUG_RX_FRSKY_SPI,
+    DEBUG_RX_SFHSS_SPI,
+    DEBUG_GYRO_RAW,
+    DEBUG_DUAL_GYRO,
+    DEBUG_DUAL_GYRO_RAW,
+    DEBUG_DUAL_GYRO_COMBINE,
+    DEBUG_DUAL_GYRO_DIFF,
+    DEBUG_MAX7456_SIGNAL,
+    DEBUG_MAX7456_SPICLOCK,
+    DEBUG_SBUS,
+    DEBUG_FPORT,
+    DEBUG_RANGEFINDER,
+    DEBUG_RANGEFINDER_QUALITY,
+    DEBUG_LIDAR_TF,
+    DEBUG_ADC_INTERNAL,
+    DEBUG_RUNAWAY_TAKEOFF,
+    DEBUG_SDIO,
+    DEBUG_CURRENT_SENSOR,
+    DEBUG_USB,
+    DEBUG_SMARTAUDIO,
+    DEBUG_RTH,
+    DEBUG_ITERM_RELAX,
+    DEBUG_ACRO_TRAINER,
+    DEBUG_RC_SMOOTHING,
+    DEBUG_RX_SIGNAL_LOSS,
+    DEBUG_RC_SMOOTHING_RATE,
+    DEBUG_ANTI_GRAVITY,
+    DEBUG_DYN_LPF,
+    DEBUG_RX_SPEKTRUM_SPI,
+    DEBUG_DSHOT_RPM_TELEMETRY,
+    DEBUG_RPM_FILTER,
+    DEBUG_D_MIN,
+    DEBUG_AC_CORRECTION,
+    DEBUG_AC_ERROR,
+    DEBUG_SERVO_SAG,
+    DEBUG_WING_SATURATION,
+    DEBUG_GYRO_FUSION,
+    DEBUG_COUNT
+} debugType_e;
+
+extern const char * const debugModeNames[DEBUG_COUNT];
+# 27 "./src/main/cli/settings.c" 2
+
+# 1 "./src/main/blackbox/blackbox.h" 1
+# 21 "./src/main/blackbox/blackbox.h"
+       
+
+
+# 1 "./src/main/build/build_config.h" 1
+# 21 "./src/main/build/build_config.h"
+       
+# 25 "./src/main/blackbox/blackbox.h" 2
+# 1 "./src/main/common/time.h" 1
+# 21 "./src/main/common/time.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/pg/pg.h" 1
+# 21 "./src/main/pg/pg.h"
+       
+
+
+
+
+
+
+typedef uint16_t pgn_t;
+
+
+typedef enum {
+    PGRF_NONE = 0,
+    PGRF_CLASSIFICATON_BIT = (1 << 0)
+} pgRegistryFlags_e;
+
+typedef enum {
+    PGR_PGN_MASK = 0x0fff,
+    PGR_PGN_VERSION_MASK = 0xf000,
+    PGR_SIZE_MASK = 0x0fff,
+    PGR_SIZE_SYSTEM_FLAG = 0x0000
+} pgRegistryInternal_e;
+
+
+typedef void (pgResetFunc)(void * );
+
+typedef struct pgRegistry_s {
+    pgn_t pgn;
+    uint16_t size;
+    uint8_t *address;
+    uint8_t *copy;
+    uint8_t **ptr;
+    union {
+        void *ptr;
+        pgResetFunc *fn;
+    } reset;
+} pgRegistry_t;
+
+static inline uint16_t pgN(const pgRegistry_t* reg) {return reg->pgn & PGR_PGN_MASK;}
+static inline uint8_t pgVersion(const pgRegistry_t* reg) {return (uint8_t)(reg->pgn >> 12);}
+static inline uint16_t pgSize(const pgRegistry_t* reg) {return reg->size & PGR_SIZE_MASK;}
+# 73 "./src/main/pg/pg.h"
+extern const pgRegistry_t __pg_registry_start[];
+extern const pgRegistry_t __pg_registry_end[];
+
+
+extern const uint8_t __pg_resetdata_start[];
+extern const uint8_t __pg_resetdata_end[];
+# 190 "./src/main/pg/pg.h"
+const pgRegistry_t* pgFind(pgn_t pgn);
+
+
+# 192 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 192 "./src/main/pg/pg.h"
+    pgLoad(const pgRegistry_t* reg, const void *from, int size, int version);
+int pgStore(const pgRegistry_t* reg, void *to, int size);
+void pgResetAll(void);
+void pgResetInstance(const pgRegistry_t *reg, uint8_t *base);
+
+# 196 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 196 "./src/main/pg/pg.h"
+    pgResetCopy(void *copy, pgn_t pgn);
+void pgReset(const pgRegistry_t* reg);
+# 29 "./src/main/common/time.h" 2
+
+
+typedef int32_t timeDelta_t;
+
+typedef uint32_t timeMs_t ;
+
+
+
+
+
+typedef uint32_t timeUs_t;
+
+
+
+
+
+
+static inline timeDelta_t cmpTimeUs(timeUs_t a, timeUs_t b) { return (timeDelta_t)(a - b); }
+
+
+
+
+
+typedef struct timeConfig_s {
+    int16_t tz_offsetMinutes;
+} timeConfig_t;
+
+extern timeConfig_t timeConfig_System; extern timeConfig_t timeConfig_Copy; static inline const timeConfig_t* timeConfig(void) { return &timeConfig_System; } static inline timeConfig_t* timeConfigMutable(void) { return &timeConfig_System; } struct _dummy;
+
+
+typedef int64_t rtcTime_t;
+
+rtcTime_t rtcTimeMake(int32_t secs, uint16_t millis);
+int32_t rtcTimeGetSeconds(rtcTime_t *t);
+uint16_t rtcTimeGetMillis(rtcTime_t *t);
+
+typedef struct _dateTime_s {
+
+    uint16_t year;
+
+    uint8_t month;
+
+    uint8_t day;
+
+    uint8_t hours;
+
+    uint8_t minutes;
+
+    uint8_t seconds;
+
+    uint16_t millis;
+} dateTime_t;
+
+
+
+# 83 "./src/main/common/time.h" 3 4
+_Bool 
+# 83 "./src/main/common/time.h"
+    dateTimeFormatUTC(char *buf, dateTime_t *dt);
+
+# 84 "./src/main/common/time.h" 3 4
+_Bool 
+# 84 "./src/main/common/time.h"
+    dateTimeFormatLocal(char *buf, dateTime_t *dt);
+
+# 85 "./src/main/common/time.h" 3 4
+_Bool 
+# 85 "./src/main/common/time.h"
+    dateTimeFormatLocalShort(char *buf, dateTime_t *dt);
+
+void dateTimeUTCToLocal(dateTime_t *utcDateTime, dateTime_t *localDateTime);
+
+
+
+
+# 91 "./src/main/common/time.h" 3 4
+_Bool 
+# 91 "./src/main/common/time.h"
+    dateTimeSplitFormatted(char *formatted, char **date, char **time);
+
+
+# 93 "./src/main/common/time.h" 3 4
+_Bool 
+# 93 "./src/main/common/time.h"
+    rtcHasTime(void);
+
+
+# 95 "./src/main/common/time.h" 3 4
+_Bool 
+# 95 "./src/main/common/time.h"
+    rtcGet(rtcTime_t *t);
+
+# 96 "./src/main/common/time.h" 3 4
+_Bool 
+# 96 "./src/main/common/time.h"
+    rtcSet(rtcTime_t *t);
+
+
+# 98 "./src/main/common/time.h" 3 4
+_Bool 
+# 98 "./src/main/common/time.h"
+    rtcGetDateTime(dateTime_t *dt);
+
+# 99 "./src/main/common/time.h" 3 4
+_Bool 
+# 99 "./src/main/common/time.h"
+    rtcSetDateTime(dateTime_t *dt);
+
+void rtcPersistWrite(int16_t offsetMinutes);
+
+# 102 "./src/main/common/time.h" 3 4
+_Bool 
+# 102 "./src/main/common/time.h"
+    rtcPersistRead(rtcTime_t *t);
+# 26 "./src/main/blackbox/blackbox.h" 2
+
+
+typedef enum BlackboxDevice {
+    BLACKBOX_DEVICE_NONE = 0,
+
+
+
+
+
+
+    BLACKBOX_DEVICE_SERIAL = 3
+} BlackboxDevice_e;
+
+typedef enum BlackboxMode {
+    BLACKBOX_MODE_NORMAL = 0,
+    BLACKBOX_MODE_MOTOR_TEST,
+    BLACKBOX_MODE_ALWAYS_ON
+} BlackboxMode;
+
+typedef enum FlightLogEvent {
+    FLIGHT_LOG_EVENT_SYNC_BEEP = 0,
+    FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT = 13,
+    FLIGHT_LOG_EVENT_LOGGING_RESUME = 14,
+    FLIGHT_LOG_EVENT_FLIGHTMODE = 30,
+    FLIGHT_LOG_EVENT_FIELD_DECIMATION = 31,
+    FLIGHT_LOG_EVENT_LOOP_OVERRUN = 32,
+    FLIGHT_LOG_EVENT_LOG_END = 255
+} FlightLogEvent;
+
+typedef struct blackboxConfig_s {
+    uint16_t p_ratio;
+    uint8_t device;
+    uint8_t record_acc;
+    uint8_t mode;
+    uint8_t governor;
+} blackboxConfig_t;
+
+extern blackboxConfig_t blackboxConfig_System; extern blackboxConfig_t blackboxConfig_Copy; static inline const blackboxConfig_t* blackboxConfig(void) { return &blackboxConfig_System; } static inline blackboxConfig_t* blackboxConfigMutable(void) { return &blackboxConfig_System; } struct _dummy;
+
+union flightLogEventData_u;
+void blackboxLogEvent(FlightLogEvent event, union flightLogEventData_u *data);
+
+void blackboxInit(void);
+void blackboxUpdate(timeUs_t currentTimeUs);
+void blackboxSetStartDateTime(const char *dateTime, timeMs_t timeNowMs);
+int blackboxCalculatePDenom(int rateNum, int rateDenom);
+uint8_t blackboxGetRateDenom(void);
+void blackboxValidateConfig(void);
+void blackboxFinish(void);
+
+# 75 "./src/main/blackbox/blackbox.h" 3 4
+_Bool 
+# 75 "./src/main/blackbox/blackbox.h"
+    blackboxMayEditConfig(void);
+# 29 "./src/main/cli/settings.c" 2
+
+# 1 "./src/main/cms/cms.h" 1
+# 21 "./src/main/cms/cms.h"
+       
+
+# 1 "./src/main/drivers/display.h" 1
+# 21 "./src/main/drivers/display.h"
+       
+
+struct displayPortVTable_s;
+
+typedef struct displayPort_s {
+    const struct displayPortVTable_s *vTable;
+    void *device;
+    uint8_t rows;
+    uint8_t cols;
+    uint8_t posX;
+    uint8_t posY;
+
+
+    
+# 34 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 34 "./src/main/drivers/display.h"
+        useFullscreen;
+    
+# 35 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 35 "./src/main/drivers/display.h"
+        cleared;
+    int8_t cursorRow;
+    int8_t grabCount;
+} displayPort_t;
+
+
+
+typedef struct displayPortVTable_s {
+    int (*grab)(displayPort_t *displayPort);
+    int (*release)(displayPort_t *displayPort);
+    int (*clearScreen)(displayPort_t *displayPort);
+    int (*drawScreen)(displayPort_t *displayPort);
+    int (*screenSize)(const displayPort_t *displayPort);
+    int (*writeString)(displayPort_t *displayPort, uint8_t x, uint8_t y, const char *text);
+    int (*writeChar)(displayPort_t *displayPort, uint8_t x, uint8_t y, uint8_t c);
+    
+# 50 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 50 "./src/main/drivers/display.h"
+        (*isTransferInProgress)(const displayPort_t *displayPort);
+    int (*heartbeat)(displayPort_t *displayPort);
+    void (*resync)(displayPort_t *displayPort);
+    
+# 53 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 53 "./src/main/drivers/display.h"
+        (*isSynced)(const displayPort_t *displayPort);
+    uint32_t (*txBytesFree)(const displayPort_t *displayPort);
+} displayPortVTable_t;
+
+typedef struct displayPortProfile_s {
+    int8_t colAdjust;
+    int8_t rowAdjust;
+    
+# 60 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 60 "./src/main/drivers/display.h"
+        invert;
+    uint8_t blackBrightness;
+    uint8_t whiteBrightness;
+} displayPortProfile_t;
+
+
+
+void displayGrab(displayPort_t *instance);
+void displayRelease(displayPort_t *instance);
+void displayReleaseAll(displayPort_t *instance);
+
+# 70 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 70 "./src/main/drivers/display.h"
+    displayIsGrabbed(const displayPort_t *instance);
+void displayClearScreen(displayPort_t *instance);
+void displayDrawScreen(displayPort_t *instance);
+int displayScreenSize(const displayPort_t *instance);
+void displaySetXY(displayPort_t *instance, uint8_t x, uint8_t y);
+int displayWrite(displayPort_t *instance, uint8_t x, uint8_t y, const char *s);
+int displayWriteChar(displayPort_t *instance, uint8_t x, uint8_t y, uint8_t c);
+
+# 77 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 77 "./src/main/drivers/display.h"
+    displayIsTransferInProgress(const displayPort_t *instance);
+void displayHeartbeat(displayPort_t *instance);
+void displayResync(displayPort_t *instance);
+
+# 80 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 80 "./src/main/drivers/display.h"
+    displayIsSynced(const displayPort_t *instance);
+uint16_t displayTxBytesFree(const displayPort_t *instance);
+void displayInit(displayPort_t *instance, const displayPortVTable_t *vTable);
+# 24 "./src/main/cms/cms.h" 2
+
+
+
+typedef enum {
+    CMS_KEY_NONE,
+    CMS_KEY_UP,
+    CMS_KEY_DOWN,
+    CMS_KEY_LEFT,
+    CMS_KEY_RIGHT,
+    CMS_KEY_ESC,
+    CMS_KEY_MENU,
+    CMS_KEY_SAVEMENU,
+} cms_key_e;
+
+extern 
+# 38 "./src/main/cms/cms.h" 3 4
+      _Bool 
+# 38 "./src/main/cms/cms.h"
+           cmsInMenu;
+
+
+
+# 41 "./src/main/cms/cms.h" 3 4
+_Bool 
+# 41 "./src/main/cms/cms.h"
+    cmsDisplayPortRegister(displayPort_t *pDisplay);
+
+extern displayPort_t *pCurrentDisplay;
+
+
+void cmsInit(void);
+void cmsHandler(timeUs_t currentTimeUs);
+
+
+# 49 "./src/main/cms/cms.h" 3 4
+_Bool 
+# 49 "./src/main/cms/cms.h"
+    cmsDisplayPortSelect(displayPort_t *instance);
+void cmsMenuOpen(void);
+long cmsMenuChange(displayPort_t *pPort, const void *ptr);
+long cmsMenuExit(displayPort_t *pPort, const void *ptr);
+void cmsUpdate(uint32_t currentTimeUs);
+void cmsSetExternKey(cms_key_e extKey);
+# 31 "./src/main/cli/settings.c" 2
+
+
+
+
+# 1 "./src/main/drivers/adc.h" 1
+# 21 "./src/main/drivers/adc.h"
+       
+
+
+
+# 1 "./src/main/drivers/io_types.h" 1
+# 21 "./src/main/drivers/io_types.h"
+       
+
+
+
+
+
+typedef uint8_t ioTag_t;
+typedef void* IO_t;
+# 48 "./src/main/drivers/io_types.h"
+typedef uint8_t ioConfig_t;
+# 26 "./src/main/drivers/adc.h" 2
+# 1 "./src/main/drivers/time.h" 1
+# 21 "./src/main/drivers/time.h"
+       
+
+
+
+
+
+void delayMicroseconds(timeUs_t us);
+void delay(timeMs_t ms);
+
+timeUs_t micros(void);
+timeUs_t microsISR(void);
+timeMs_t millis(void);
+
+uint32_t ticks(void);
+timeDelta_t ticks_diff_us(uint32_t begin, uint32_t end);
+# 27 "./src/main/drivers/adc.h" 2
+# 46 "./src/main/drivers/adc.h"
+typedef enum ADCDevice {
+    ADCINVALID = -1,
+    ADCDEV_1 = 0,
+
+
+
+
+
+
+
+    ADCDEV_COUNT
+} ADCDevice;
+
+
+
+
+typedef enum {
+    ADC_BATTERY = 0,
+    ADC_CURRENT = 1,
+    ADC_EXTERNAL1 = 2,
+    ADC_RSSI = 3,
+    ADC_CHANNEL_COUNT
+} AdcChannel;
+
+typedef struct adcOperatingConfig_s {
+    ioTag_t tag;
+    uint8_t adcChannel;
+    uint8_t dmaIndex;
+    
+# 74 "./src/main/drivers/adc.h" 3 4
+   _Bool 
+# 74 "./src/main/drivers/adc.h"
+        enabled;
+    uint8_t sampleTime;
+} adcOperatingConfig_t;
+
+struct adcConfig_s;
+void adcInit(const struct adcConfig_s *config);
+uint16_t adcGetChannel(uint8_t channel);
+# 36 "./src/main/cli/settings.c" 2
+# 1 "./src/main/drivers/bus_i2c.h" 1
+# 21 "./src/main/drivers/bus_i2c.h"
+       
+
+
+
+
+# 1 "./src/main/drivers/rcc_types.h" 1
+# 21 "./src/main/drivers/rcc_types.h"
+       
+
+typedef uint8_t rccPeriphTag_t;
+# 27 "./src/main/drivers/bus_i2c.h" 2
+
+
+
+
+
+typedef enum I2CDevice {
+    I2CINVALID = -1,
+    I2CDEV_1 = 0,
+    I2CDEV_2,
+    I2CDEV_3,
+    I2CDEV_4,
+} I2CDevice;
+# 58 "./src/main/drivers/bus_i2c.h"
+struct i2cConfig_s;
+void i2cHardwareConfigure(const struct i2cConfig_s *i2cConfig);
+void i2cInit(I2CDevice device);
+
+# 61 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 61 "./src/main/drivers/bus_i2c.h"
+    i2cWriteBuffer(I2CDevice device, uint8_t addr_, uint8_t reg_, uint8_t len_, uint8_t *data);
+
+# 62 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 62 "./src/main/drivers/bus_i2c.h"
+    i2cWrite(I2CDevice device, uint8_t addr_, uint8_t reg, uint8_t data);
+
+# 63 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 63 "./src/main/drivers/bus_i2c.h"
+    i2cRead(I2CDevice device, uint8_t addr_, uint8_t reg, uint8_t len, uint8_t* buf);
+
+uint16_t i2cGetErrorCounter(void);
+# 37 "./src/main/cli/settings.c" 2
+# 1 "./src/main/drivers/bus_spi.h" 1
+# 21 "./src/main/drivers/bus_spi.h"
+       
+
+# 1 "./src/main/drivers/bus.h" 1
+# 21 "./src/main/drivers/bus.h"
+       
+
+
+
+
+
+
+typedef enum {
+    BUSTYPE_NONE = 0,
+    BUSTYPE_I2C,
+    BUSTYPE_SPI,
+    BUSTYPE_MPU_SLAVE,
+    BUSTYPE_GYRO_AUTO
+} busType_e;
+
+struct spiDevice_s;
+
+typedef struct busDevice_s {
+    busType_e bustype;
+    union {
+        struct deviceSpi_s {
+            SPI_TypeDef *instance;
+# 51 "./src/main/drivers/bus.h"
+            IO_t csnPin;
+        } spi;
+        struct deviceI2C_s {
+            I2CDevice device;
+            uint8_t address;
+        } i2c;
+        struct deviceMpuSlave_s {
+            const struct busDevice_s *master;
+            uint8_t address;
+        } mpuSlave;
+    } busdev_u;
+} busDevice_t;
+
+
+
+
+
+
+# 68 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 68 "./src/main/drivers/bus.h"
+    busWriteRegister(const busDevice_t *bus, uint8_t reg, uint8_t data);
+
+# 69 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 69 "./src/main/drivers/bus.h"
+    busReadRegisterBuffer(const busDevice_t *bus, uint8_t reg, uint8_t *data, uint8_t length);
+uint8_t busReadRegister(const busDevice_t *bus, uint8_t reg);
+# 24 "./src/main/drivers/bus_spi.h" 2
+
+
+
+
+
+# 1 "./src/main/pg/pg_ids.h" 1
+# 21 "./src/main/pg/pg_ids.h"
+       
+# 30 "./src/main/drivers/bus_spi.h" 2
+# 52 "./src/main/drivers/bus_spi.h"
+typedef enum {
+    SPI_CLOCK_INITIALIZATION = 256,
+# 65 "./src/main/drivers/bus_spi.h"
+    SPI_CLOCK_SLOW = 128,
+    SPI_CLOCK_STANDARD = 4,
+    SPI_CLOCK_FAST = 2,
+    SPI_CLOCK_ULTRAFAST = 2
+
+} SPIClockDivider_e;
+# 80 "./src/main/drivers/bus_spi.h"
+typedef enum {
+    SPI_MODE0_POL_LOW_EDGE_1ST = 0,
+    SPI_MODE1_POL_LOW_EDGE_2ND,
+    SPI_MODE2_POL_HIGH_EDGE_1ST,
+    SPI_MODE3_POL_HIGH_EDGE_2ND
+} SPIMode_e;
+
+typedef enum SPIDevice {
+    SPIINVALID = -1,
+    SPIDEV_1 = 0,
+    SPIDEV_2,
+    SPIDEV_3,
+    SPIDEV_4
+} SPIDevice;
+# 110 "./src/main/drivers/bus_spi.h"
+void spiPreinit(void);
+void spiPreinitRegister(ioTag_t iotag, uint8_t iocfg, uint8_t init);
+void spiPreinitByIO(IO_t io);
+void spiPreinitByTag(ioTag_t tag);
+
+
+# 115 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 115 "./src/main/drivers/bus_spi.h"
+    spiInit(SPIDevice device);
+void spiSetDivisor(SPI_TypeDef *instance, uint16_t divisor);
+uint8_t spiTransferByte(SPI_TypeDef *instance, uint8_t data);
+
+# 118 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 118 "./src/main/drivers/bus_spi.h"
+    spiIsBusBusy(SPI_TypeDef *instance);
+
+
+# 120 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 120 "./src/main/drivers/bus_spi.h"
+    spiTransfer(SPI_TypeDef *instance, const uint8_t *txData, uint8_t *rxData, int len);
+
+uint16_t spiGetErrorCounter(SPI_TypeDef *instance);
+void spiResetErrorCounter(SPI_TypeDef *instance);
+SPIDevice spiDeviceByInstance(SPI_TypeDef *instance);
+SPI_TypeDef *spiInstanceByDevice(SPIDevice device);
+
+
+# 127 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 127 "./src/main/drivers/bus_spi.h"
+    spiBusIsBusBusy(const busDevice_t *bus);
+
+
+# 129 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 129 "./src/main/drivers/bus_spi.h"
+    spiBusTransfer(const busDevice_t *bus, const uint8_t *txData, uint8_t *rxData, int length);
+
+uint8_t spiBusTransferByte(const busDevice_t *bus, uint8_t data);
+void spiBusWriteByte(const busDevice_t *bus, uint8_t data);
+
+# 133 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 133 "./src/main/drivers/bus_spi.h"
+    spiBusRawTransfer(const busDevice_t *bus, const uint8_t *txData, uint8_t *rxData, int len);
+
+
+# 135 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 135 "./src/main/drivers/bus_spi.h"
+    spiBusWriteRegister(const busDevice_t *bus, uint8_t reg, uint8_t data);
+
+# 136 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 136 "./src/main/drivers/bus_spi.h"
+    spiBusRawReadRegisterBuffer(const busDevice_t *bus, uint8_t reg, uint8_t *data, uint8_t length);
+
+# 137 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 137 "./src/main/drivers/bus_spi.h"
+    spiBusReadRegisterBuffer(const busDevice_t *bus, uint8_t reg, uint8_t *data, uint8_t length);
+void spiBusWriteRegisterBuffer(const busDevice_t *bus, uint8_t reg, const uint8_t *data, uint8_t length);
+uint8_t spiBusRawReadRegister(const busDevice_t *bus, uint8_t reg);
+uint8_t spiBusReadRegister(const busDevice_t *bus, uint8_t reg);
+void spiBusSetInstance(busDevice_t *bus, SPI_TypeDef *instance);
+void spiBusSetDivisor(busDevice_t *bus, SPIClockDivider_e divider);
+
+void spiBusTransactionInit(busDevice_t *bus, SPIMode_e mode, SPIClockDivider_e divider);
+void spiBusTransactionSetup(const busDevice_t *bus);
+void spiBusTransactionBegin(const busDevice_t *bus);
+void spiBusTransactionEnd(const busDevice_t *bus);
+
+# 148 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 148 "./src/main/drivers/bus_spi.h"
+    spiBusTransactionWriteRegister(const busDevice_t *bus, uint8_t reg, uint8_t data);
+uint8_t spiBusTransactionReadRegister(const busDevice_t *bus, uint8_t reg);
+
+# 150 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 150 "./src/main/drivers/bus_spi.h"
+    spiBusTransactionReadRegisterBuffer(const busDevice_t *bus, uint8_t reg, uint8_t *data, uint8_t length);
+
+# 151 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 151 "./src/main/drivers/bus_spi.h"
+    spiBusTransactionTransfer(const busDevice_t *bus, const uint8_t *txData, uint8_t *rxData, int length);
+
+struct spiPinConfig_s;
+void spiPinConfigure(const struct spiPinConfig_s *pConfig);
+# 38 "./src/main/cli/settings.c" 2
+# 1 "./src/main/drivers/camera_control.h" 1
+# 21 "./src/main/drivers/camera_control.h"
+       
+
+
+
+
+typedef enum {
+    CAMERA_CONTROL_KEY_ENTER,
+    CAMERA_CONTROL_KEY_LEFT,
+    CAMERA_CONTROL_KEY_UP,
+    CAMERA_CONTROL_KEY_RIGHT,
+    CAMERA_CONTROL_KEY_DOWN,
+    CAMERA_CONTROL_KEYS_COUNT
+} cameraControlKey_e;
+
+typedef enum {
+    CAMERA_CONTROL_MODE_HARDWARE_PWM,
+    CAMERA_CONTROL_MODE_SOFTWARE_PWM,
+    CAMERA_CONTROL_MODE_DAC,
+    CAMERA_CONTROL_MODES_COUNT
+} cameraControlMode_e;
+
+typedef struct cameraControlConfig_s {
+    cameraControlMode_e mode;
+
+    uint16_t refVoltage;
+    uint16_t keyDelayMs;
+
+    uint16_t internalResistance;
+
+    ioTag_t ioTag;
+    uint8_t inverted;
+} cameraControlConfig_t;
+
+extern cameraControlConfig_t cameraControlConfig_System; extern cameraControlConfig_t cameraControlConfig_Copy; static inline const cameraControlConfig_t* cameraControlConfig(void) { return &cameraControlConfig_System; } static inline cameraControlConfig_t* cameraControlConfigMutable(void) { return &cameraControlConfig_System; } struct _dummy;
+
+void cameraControlInit(void);
+
+void cameraControlProcess(uint32_t currentTimeUs);
+void cameraControlKeyPress(cameraControlKey_e key, uint32_t holdDurationMs);
+# 39 "./src/main/cli/settings.c" 2
+# 1 "./src/main/drivers/light_led.h" 1
+# 21 "./src/main/drivers/light_led.h"
+       
+
+
+
+
+
+
+
+typedef struct statusLedConfig_s {
+    ioTag_t ioTags[3];
+    uint8_t inversion;
+} statusLedConfig_t;
+
+extern statusLedConfig_t statusLedConfig_System; extern statusLedConfig_t statusLedConfig_Copy; static inline const statusLedConfig_t* statusLedConfig(void) { return &statusLedConfig_System; } static inline statusLedConfig_t* statusLedConfigMutable(void) { return &statusLedConfig_System; } struct _dummy;
+# 40 "./src/main/cli/settings.c" 2
+# 1 "./src/main/drivers/pinio.h" 1
+# 21 "./src/main/drivers/pinio.h"
+       
+# 33 "./src/main/drivers/pinio.h"
+struct pinioConfig_s;
+
+void pinioInit(const struct pinioConfig_s *pinioConfig);
+void pinioSet(int index, 
+# 36 "./src/main/drivers/pinio.h" 3 4
+                        _Bool 
+# 36 "./src/main/drivers/pinio.h"
+                             on);
+# 41 "./src/main/cli/settings.c" 2
+# 1 "./src/main/drivers/vtx_common.h" 1
+# 23 "./src/main/drivers/vtx_common.h"
+       
+# 73 "./src/main/drivers/vtx_common.h"
+typedef enum {
+    VTXDEV_UNSUPPORTED = 0,
+    VTXDEV_RTC6705 = 1,
+
+    VTXDEV_SMARTAUDIO = 3,
+    VTXDEV_TRAMP = 4,
+    VTXDEV_UNKNOWN = 0xFF,
+} vtxDevType_e;
+# 111 "./src/main/drivers/vtx_common.h"
+typedef struct vtxDeviceCapability_s {
+    uint8_t bandCount;
+    uint8_t channelCount;
+    uint8_t powerCount;
+    uint8_t filler;
+} vtxDeviceCapability_t;
+
+struct vtxVTable_s;
+typedef struct vtxDevice_s {
+    const struct vtxVTable_s * const vTable;
+
+    vtxDeviceCapability_t capability;
+
+    const uint16_t *frequencyTable;
+    const char **bandNames;
+    const char **channelNames;
+    const char *bandLetters;
+    const uint16_t *powerValues;
+    const char **powerNames;
+
+    uint16_t frequency;
+    uint8_t band;
+    uint8_t channel;
+    uint8_t powerIndex;
+    uint8_t pitMode;
+} vtxDevice_t;
+
+
+
+
+
+
+typedef struct vtxVTable_s {
+    void (*process)(vtxDevice_t *vtxDevice, timeUs_t currentTimeUs);
+    vtxDevType_e (*getDeviceType)(const vtxDevice_t *vtxDevice);
+    
+# 146 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 146 "./src/main/drivers/vtx_common.h"
+        (*isReady)(const vtxDevice_t *vtxDevice);
+
+    void (*setBandAndChannel)(vtxDevice_t *vtxDevice, uint8_t band, uint8_t channel);
+    void (*setPowerByIndex)(vtxDevice_t *vtxDevice, uint8_t level);
+    void (*setPitMode)(vtxDevice_t *vtxDevice, uint8_t onoff);
+    void (*setFrequency)(vtxDevice_t *vtxDevice, uint16_t freq);
+
+    
+# 153 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 153 "./src/main/drivers/vtx_common.h"
+        (*getBandAndChannel)(const vtxDevice_t *vtxDevice, uint8_t *pBand, uint8_t *pChannel);
+    
+# 154 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 154 "./src/main/drivers/vtx_common.h"
+        (*getPowerIndex)(const vtxDevice_t *vtxDevice, uint8_t *pIndex);
+    
+# 155 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 155 "./src/main/drivers/vtx_common.h"
+        (*getPitMode)(const vtxDevice_t *vtxDevice, uint8_t *pOnOff);
+    
+# 156 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 156 "./src/main/drivers/vtx_common.h"
+        (*getFrequency)(const vtxDevice_t *vtxDevice, uint16_t *pFreq);
+} vtxVTable_t;
+
+
+
+
+
+
+void vtxCommonInit(void);
+void vtxCommonSetDevice(vtxDevice_t *vtxDevice);
+vtxDevice_t *vtxCommonDevice(void);
+
+
+void vtxCommonProcess(vtxDevice_t *vtxDevice, timeUs_t currentTimeUs);
+vtxDevType_e vtxCommonGetDeviceType(const vtxDevice_t *vtxDevice);
+
+# 171 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 171 "./src/main/drivers/vtx_common.h"
+    vtxCommonDeviceIsReady(const vtxDevice_t *vtxDevice);
+void vtxCommonSetBandAndChannel(vtxDevice_t *vtxDevice, uint8_t band, uint8_t channel);
+void vtxCommonSetPowerByIndex(vtxDevice_t *vtxDevice, uint8_t level);
+void vtxCommonSetPitMode(vtxDevice_t *vtxDevice, uint8_t onoff);
+void vtxCommonSetFrequency(vtxDevice_t *vtxDevice, uint16_t freq);
+
+# 176 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 176 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetBandAndChannel(const vtxDevice_t *vtxDevice, uint8_t *pBand, uint8_t *pChannel);
+
+# 177 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 177 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetPowerIndex(const vtxDevice_t *vtxDevice, uint8_t *pIndex);
+
+# 178 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 178 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetPitMode(const vtxDevice_t *vtxDevice, uint8_t *pOnOff);
+
+# 179 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 179 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetFrequency(const vtxDevice_t *vtxDevice, uint16_t *pFreq);
+
+# 180 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 180 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetDeviceCapability(const vtxDevice_t *vtxDevice, vtxDeviceCapability_t *pDeviceCapability);
+const char *vtxCommonLookupBandName(const vtxDevice_t *vtxDevice, int band);
+char vtxCommonLookupBandLetter(const vtxDevice_t *vtxDevice, int band);
+char vtxCommonGetBandLetter(const vtxDevice_t *vtxDevice, int band);
+const char *vtxCommonLookupChannelName(const vtxDevice_t *vtxDevice, int channel);
+uint16_t vtxCommonLookupFrequency(const vtxDevice_t *vtxDevice, int band, int channel);
+
+# 186 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 186 "./src/main/drivers/vtx_common.h"
+    vtxCommonLookupBandChan(const vtxDevice_t *vtxDevice, uint16_t freq, uint8_t *pBand, uint8_t *pChannel);
+const char *vtxCommonLookupPowerName(const vtxDevice_t *vtxDevice, int index);
+uint16_t vtxCommonLookupPowerValue(const vtxDevice_t *vtxDevice, int index);
+# 42 "./src/main/cli/settings.c" 2
+
+# 1 "./src/main/fc/config.h" 1
+# 21 "./src/main/fc/config.h"
+       
+# 30 "./src/main/fc/config.h"
+typedef struct pilotConfig_s {
+    char name[16u + 1];
+    char displayName[16u + 1];
+} pilotConfig_t;
+
+extern pilotConfig_t pilotConfig_System; extern pilotConfig_t pilotConfig_Copy; static inline const pilotConfig_t* pilotConfig(void) { return &pilotConfig_System; } static inline pilotConfig_t* pilotConfigMutable(void) { return &pilotConfig_System; } struct _dummy;
+
+typedef struct systemConfig_s {
+    uint8_t pidProfileIndex;
+    uint8_t activeRateProfile;
+    uint8_t debug_mode;
+    uint8_t task_statistics;
+    uint8_t rateProfile6PosSwitch;
+    uint8_t cpu_overclock;
+    uint8_t powerOnArmingGraceTime;
+    char boardIdentifier[sizeof("SITL") + 1];
+    uint8_t hseMhz;
+    uint8_t configured;
+    uint8_t schedulerOptimizeRate;
+} systemConfig_t;
+
+extern systemConfig_t systemConfig_System; extern systemConfig_t systemConfig_Copy; static inline const systemConfig_t* systemConfig(void) { return &systemConfig_System; } static inline systemConfig_t* systemConfigMutable(void) { return &systemConfig_System; } struct _dummy;
+
+struct pidProfile_s;
+extern struct pidProfile_s *currentPidProfile;
+
+void initEEPROM(void);
+void resetEEPROM(void);
+
+# 58 "./src/main/fc/config.h" 3 4
+_Bool 
+# 58 "./src/main/fc/config.h"
+    readEEPROM(void);
+void writeEEPROM(void);
+void writeEEPROMWithFeatures(uint32_t features);
+void ensureEEPROMStructureIsValid(void);
+
+void saveConfigAndNotify(void);
+void validateAndFixGyroConfig(void);
+
+uint8_t getCurrentPidProfileIndex(void);
+void changePidProfile(uint8_t pidProfileIndex);
+void changePidProfileFromCellCount(uint8_t cellCount);
+struct pidProfile_s;
+void resetPidProfile(struct pidProfile_s *profile);
+
+uint8_t getCurrentControlRateProfileIndex(void);
+void changeControlRateProfile(uint8_t profileIndex);
+
+
+# 75 "./src/main/fc/config.h" 3 4
+_Bool 
+# 75 "./src/main/fc/config.h"
+    canSoftwareSerialBeUsed(void);
+
+uint16_t getCurrentMinthrottle(void);
+
+void resetConfigs(void);
+void targetConfiguration(void);
+void targetValidateConfiguration(void);
+
+
+# 83 "./src/main/fc/config.h" 3 4
+_Bool 
+# 83 "./src/main/fc/config.h"
+    isSystemConfigured(void);
+# 44 "./src/main/cli/settings.c" 2
+# 1 "./src/main/fc/controlrate_profile.h" 1
+# 21 "./src/main/fc/controlrate_profile.h"
+       
+
+
+
+
+
+typedef enum {
+    RATES_TYPE_BETAFLIGHT = 0,
+    RATES_TYPE_RACEFLIGHT,
+} ratesType_e;
+
+typedef enum {
+    THROTTLE_LIMIT_TYPE_OFF = 0,
+    THROTTLE_LIMIT_TYPE_SCALE,
+    THROTTLE_LIMIT_TYPE_CLIP,
+    THROTTLE_LIMIT_TYPE_COUNT
+} throttleLimitType_e;
+
+
+typedef enum {
+    TPA_MODE_PD,
+    TPA_MODE_D
+} tpaMode_e;
+
+typedef struct controlRateConfig_s {
+    uint8_t thrMid8;
+    uint8_t thrExpo8;
+    uint8_t rates_type;
+    uint8_t rcRates[3];
+    uint8_t rcExpo[3];
+    uint8_t rates[3];
+    uint8_t dynThrPID;
+    int8_t phase_shift_scale;
+    uint16_t tpa_breakpoint;
+    uint8_t throttle_limit_type;
+    uint8_t throttle_limit_percent;
+    uint16_t rate_limit[3];
+    uint8_t tpaMode;
+} controlRateConfig_t;
+
+extern controlRateConfig_t controlRateProfiles_SystemArray[6]; extern controlRateConfig_t controlRateProfiles_CopyArray[6]; static inline const controlRateConfig_t* controlRateProfiles(int _index) { return &controlRateProfiles_SystemArray[_index]; } static inline controlRateConfig_t* controlRateProfilesMutable(int _index) { return &controlRateProfiles_SystemArray[_index]; } static inline controlRateConfig_t (* controlRateProfiles_array(void))[6] { return &controlRateProfiles_SystemArray; } struct _dummy;
+
+extern controlRateConfig_t *currentControlRateProfile;
+
+void loadControlRateProfile(void);
+void changeControlRateProfile(uint8_t controlRateProfileIndex);
+
+void copyControlRateProfile(const uint8_t dstControlRateProfileIndex, const uint8_t srcControlRateProfileIndex);
+# 45 "./src/main/cli/settings.c" 2
+# 1 "./src/main/fc/core.h" 1
+# 21 "./src/main/fc/core.h"
+       
+
+
+
+
+
+extern int16_t magHold;
+
+
+extern 
+# 30 "./src/main/fc/core.h" 3 4
+      _Bool 
+# 30 "./src/main/fc/core.h"
+           isRXDataNew;
+
+typedef struct throttleCorrectionConfig_s {
+    uint16_t throttle_correction_angle;
+    uint8_t throttle_correction_value;
+} throttleCorrectionConfig_t;
+
+typedef enum {
+    LAUNCH_CONTROL_DISABLED = 0,
+    LAUNCH_CONTROL_ACTIVE,
+    LAUNCH_CONTROL_TRIGGERED,
+} launchControlState_e;
+
+typedef enum {
+    LAUNCH_CONTROL_MODE_NORMAL = 0,
+    LAUNCH_CONTROL_MODE_PITCHONLY,
+    LAUNCH_CONTROL_MODE_FULL,
+    LAUNCH_CONTROL_MODE_COUNT
+} launchControlMode_e;
+
+
+
+
+
+
+extern throttleCorrectionConfig_t throttleCorrectionConfig_System; extern throttleCorrectionConfig_t throttleCorrectionConfig_Copy; static inline const throttleCorrectionConfig_t* throttleCorrectionConfig(void) { return &throttleCorrectionConfig_System; } static inline throttleCorrectionConfig_t* throttleCorrectionConfigMutable(void) { return &throttleCorrectionConfig_System; } struct _dummy;
+
+union rollAndPitchTrims_u;
+void handleInflightCalibrationStickPosition(void);
+
+void resetArmingDisabled(void);
+
+void disarm(void);
+void tryArm(void);
+
+
+# 65 "./src/main/fc/core.h" 3 4
+_Bool 
+# 65 "./src/main/fc/core.h"
+    processRx(timeUs_t currentTimeUs);
+void updateArmingStatus(void);
+
+void taskMainPidLoop(timeUs_t currentTimeUs);
+
+
+# 70 "./src/main/fc/core.h" 3 4
+_Bool 
+# 70 "./src/main/fc/core.h"
+    isFlipOverAfterCrashActive(void);
+int8_t calculateThrottlePercent(void);
+uint8_t calculateThrottlePercentAbs(void);
+void runawayTakeoffTemporaryDisable(uint8_t disableFlag);
+
+# 74 "./src/main/fc/core.h" 3 4
+_Bool 
+# 74 "./src/main/fc/core.h"
+    isAirmodeActivated();
+timeUs_t getLastDisarmTimeUs(void);
+
+# 76 "./src/main/fc/core.h" 3 4
+_Bool 
+# 76 "./src/main/fc/core.h"
+    isTryingToArm();
+void resetTryingToArm();
+
+void subTaskTelemetryPollSensors(timeUs_t currentTimeUs);
+
+
+# 81 "./src/main/fc/core.h" 3 4
+_Bool 
+# 81 "./src/main/fc/core.h"
+    isLaunchControlActive(void);
+# 46 "./src/main/cli/settings.c" 2
+# 1 "./src/main/fc/rc_adjustments.h" 1
+# 21 "./src/main/fc/rc_adjustments.h"
+       
+
+
+
+# 1 "./src/main/fc/rc_modes.h" 1
+# 21 "./src/main/fc/rc_modes.h"
+       
+
+
+
+
+
+
+
+typedef enum {
+
+    BOXARM = 0,
+
+    BOXANGLE,
+    BOXHORIZON,
+    BOXMAG,
+    BOXHEADFREE,
+    BOXPASSTHRU,
+    BOXFAILSAFE,
+    BOXGPSRESCUE,
+    BOXID_FLIGHTMODE_LAST = BOXGPSRESCUE,
+
+
+
+
+    BOXANTIGRAVITY,
+    BOXHEADADJ,
+    BOXCAMSTAB,
+    BOXBEEPERON,
+    BOXLEDLOW,
+    BOXCALIB,
+    BOXOSD,
+    BOXTELEMETRY,
+    BOXSERVO1,
+    BOXSERVO2,
+    BOXSERVO3,
+    BOXBLACKBOX,
+    BOXAIRMODE,
+    BOX3D,
+    BOXFPVANGLEMIX,
+    BOXBLACKBOXERASE,
+    BOXCAMERA1,
+    BOXCAMERA2,
+    BOXCAMERA3,
+    BOXFLIPOVERAFTERCRASH,
+    BOXPREARM,
+    BOXBEEPGPSCOUNT,
+    BOXVTXPITMODE,
+    BOXPARALYZE,
+    BOXUSER1,
+    BOXUSER2,
+    BOXUSER3,
+    BOXUSER4,
+    BOXPIDAUDIO,
+    BOXACROTRAINER,
+    BOXVTXCONTROLDISABLE,
+    BOXLAUNCHCONTROL,
+    BOXORNITHOPTERINDEPENDENT,
+    BOXORNITHOPTERGLIDE,
+    BOXORNITHOPTERPROFILE,
+    CHECKBOX_ITEM_COUNT
+} boxId_e;
+
+typedef enum {
+    MODELOGIC_OR = 0,
+    MODELOGIC_AND
+} modeLogic_e;
+
+
+typedef struct boxBitmask_s { uint32_t bits[(CHECKBOX_ITEM_COUNT + 31) / 32]; } boxBitmask_t;
+# 106 "./src/main/fc/rc_modes.h"
+typedef struct channelRange_s {
+    uint8_t startStep;
+    uint8_t endStep;
+} channelRange_t;
+
+typedef struct modeActivationCondition_s {
+    boxId_e modeId;
+    uint8_t auxChannelIndex;
+    channelRange_t range;
+    modeLogic_e modeLogic;
+    boxId_e linkedTo;
+} modeActivationCondition_t;
+
+extern modeActivationCondition_t modeActivationConditions_SystemArray[20]; extern modeActivationCondition_t modeActivationConditions_CopyArray[20]; static inline const modeActivationCondition_t* modeActivationConditions(int _index) { return &modeActivationConditions_SystemArray[_index]; } static inline modeActivationCondition_t* modeActivationConditionsMutable(int _index) { return &modeActivationConditions_SystemArray[_index]; } static inline modeActivationCondition_t (* modeActivationConditions_array(void))[20] { return &modeActivationConditions_SystemArray; } struct _dummy;
+
+typedef struct modeActivationProfile_s {
+    modeActivationCondition_t modeActivationConditions[20];
+} modeActivationProfile_t;
+
+
+
+
+# 127 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 127 "./src/main/fc/rc_modes.h"
+    IS_RC_MODE_ACTIVE(boxId_e boxId);
+void rcModeUpdate(boxBitmask_t *newState);
+
+
+# 130 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 130 "./src/main/fc/rc_modes.h"
+    airmodeIsEnabled(void);
+
+
+# 132 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 132 "./src/main/fc/rc_modes.h"
+    isRangeActive(uint8_t auxChannelIndex, const channelRange_t *range);
+void updateActivatedModes(void);
+
+# 134 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 134 "./src/main/fc/rc_modes.h"
+    isModeActivationConditionPresent(boxId_e modeId);
+
+# 135 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 135 "./src/main/fc/rc_modes.h"
+    isModeActivationConditionLinked(boxId_e modeId);
+void removeModeActivationCondition(boxId_e modeId);
+
+# 137 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 137 "./src/main/fc/rc_modes.h"
+    isModeActivationConditionConfigured(const modeActivationCondition_t *mac, const modeActivationCondition_t *emptyMac);
+void analyzeModeActivationConditions(void);
+# 26 "./src/main/fc/rc_adjustments.h" 2
+
+typedef enum {
+    ADJUSTMENT_NONE = 0,
+    ADJUSTMENT_RC_RATE,
+    ADJUSTMENT_RC_EXPO,
+    ADJUSTMENT_THROTTLE_EXPO,
+    ADJUSTMENT_PITCH_ROLL_RATE,
+    ADJUSTMENT_YAW_RATE,
+    ADJUSTMENT_PITCH_ROLL_P,
+    ADJUSTMENT_PITCH_ROLL_I,
+    ADJUSTMENT_PITCH_ROLL_D,
+    ADJUSTMENT_YAW_P,
+    ADJUSTMENT_YAW_I,
+    ADJUSTMENT_YAW_D,
+    ADJUSTMENT_RATE_PROFILE,
+    ADJUSTMENT_PITCH_RATE,
+    ADJUSTMENT_ROLL_RATE,
+    ADJUSTMENT_PITCH_P,
+    ADJUSTMENT_PITCH_I,
+    ADJUSTMENT_PITCH_D,
+    ADJUSTMENT_ROLL_P,
+    ADJUSTMENT_ROLL_I,
+    ADJUSTMENT_ROLL_D,
+    ADJUSTMENT_RC_RATE_YAW,
+    ADJUSTMENT_PITCH_ROLL_F,
+    ADJUSTMENT_FEEDFORWARD_TRANSITION,
+    ADJUSTMENT_HORIZON_STRENGTH,
+    ADJUSTMENT_ROLL_RC_RATE,
+    ADJUSTMENT_PITCH_RC_RATE,
+    ADJUSTMENT_ROLL_RC_EXPO,
+    ADJUSTMENT_PITCH_RC_EXPO,
+    ADJUSTMENT_PID_AUDIO,
+    ADJUSTMENT_PITCH_F,
+    ADJUSTMENT_ROLL_F,
+    ADJUSTMENT_YAW_F,
+    ADJUSTMENT_OSD_PROFILE,
+    ADJUSTMENT_LED_PROFILE,
+    ADJUSTMENT_FUNCTION_COUNT,
+} adjustmentFunction_e;
+
+typedef enum {
+    ADJUSTMENT_MODE_STEP,
+    ADJUSTMENT_MODE_SELECT
+} adjustmentMode_e;
+
+typedef union adjustmentConfig_u {
+    uint8_t step;
+    uint8_t switchPositions;
+} adjustmentData_t;
+
+typedef struct adjustmentConfig_s {
+    adjustmentFunction_e adjustmentFunction;
+    adjustmentMode_e mode;
+    adjustmentData_t data;
+} adjustmentConfig_t;
+
+
+
+typedef struct adjustmentRange_s {
+
+    uint8_t auxChannelIndex;
+    channelRange_t range;
+
+
+    uint8_t adjustmentConfig;
+    uint8_t auxSwitchChannelIndex;
+
+
+    uint8_t adjustmentIndex;
+    uint16_t adjustmentCenter;
+    uint16_t adjustmentScale;
+} adjustmentRange_t;
+
+extern adjustmentRange_t adjustmentRanges_SystemArray[30]; extern adjustmentRange_t adjustmentRanges_CopyArray[30]; static inline const adjustmentRange_t* adjustmentRanges(int _index) { return &adjustmentRanges_SystemArray[_index]; } static inline adjustmentRange_t* adjustmentRangesMutable(int _index) { return &adjustmentRanges_SystemArray[_index]; } static inline adjustmentRange_t (* adjustmentRanges_array(void))[30] { return &adjustmentRanges_SystemArray; } struct _dummy;
+
+
+
+typedef struct adjustmentState_s {
+    uint8_t auxChannelIndex;
+    const adjustmentConfig_t *config;
+    uint32_t timeoutAt;
+} adjustmentState_t;
+
+
+
+
+
+void resetAdjustmentStates(void);
+struct controlRateConfig_s;
+void processRcAdjustments(struct controlRateConfig_s *controlRateConfig);
+const char *getAdjustmentsRangeName(void);
+int getAdjustmentsRangeValue(void);
+void activeAdjustmentRangeReset(void);
+# 47 "./src/main/cli/settings.c" 2
+# 1 "./src/main/fc/rc_controls.h" 1
+# 21 "./src/main/fc/rc_controls.h"
+       
+
+
+
+# 1 "./src/main/common/filter.h" 1
+# 21 "./src/main/common/filter.h"
+       
+
+
+struct filter_s;
+typedef struct filter_s filter_t;
+
+typedef struct pt1Filter_s {
+    float state;
+    float k;
+} pt1Filter_t;
+
+typedef struct slewFilter_s {
+    float state;
+    float slewLimit;
+    float threshold;
+} slewFilter_t;
+
+
+typedef struct biquadFilter_s {
+    float b0, b1, b2, a1, a2;
+    float x1, x2, y1, y2;
+} biquadFilter_t;
+
+
+typedef struct hermiteSpline_s {
+    float a, b, c, d;
+    float duration;
+    float lastSample;
+    float endSlope;
+    float value;
+    float derivative;
+} hermiteSpline_t;
+
+
+typedef struct trajectoryLimiter_s {
+    float position;
+    float velocity;
+} trajectoryLimiter_t;
+
+typedef struct laggedMovingAverage_s {
+    uint16_t movingWindowIndex;
+    uint16_t windowSize;
+    float movingSum;
+    float *buf;
+    
+# 65 "./src/main/common/filter.h" 3 4
+   _Bool 
+# 65 "./src/main/common/filter.h"
+        primed;
+} laggedMovingAverage_t;
+
+typedef enum {
+    FILTER_PT1 = 0,
+    FILTER_BIQUAD,
+} lowpassFilterType_e;
+
+typedef enum {
+    FILTER_LPF,
+    FILTER_NOTCH,
+    FILTER_BPF,
+} biquadFilterType_e;
+
+typedef float (*filterApplyFnPtr)(filter_t *filter, float input);
+
+float nullFilterApply(filter_t *filter, float input);
+
+void biquadFilterInitLPF(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate);
+void biquadFilterInit(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilterUpdate(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilterUpdateLPF(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate);
+
+float biquadFilterApplyDF1(biquadFilter_t *filter, float input);
+float biquadFilterApply(biquadFilter_t *filter, float input);
+float filterGetNotchQ(float centerFreq, float cutoffFreq);
+
+void laggedMovingAverageInit(laggedMovingAverage_t *filter, uint16_t windowSize, float *buf);
+float laggedMovingAverageUpdate(laggedMovingAverage_t *filter, float input);
+
+float pt1FilterGain(float f_cut, float dT);
+void pt1FilterInit(pt1Filter_t *filter, float k);
+void pt1FilterUpdateCutoff(pt1Filter_t *filter, float k);
+float pt1FilterApply(pt1Filter_t *filter, float input);
+
+void slewFilterInit(slewFilter_t *filter, float slewLimit, float threshold);
+float slewFilterApply(slewFilter_t *filter, float input);
+
+void hermiteSplineInit(hermiteSpline_t *spline, float sample);
+void hermiteSplineUpdate(hermiteSpline_t *spline, float sample, float sampleIntervalS);
+void hermiteSplineEvaluate(hermiteSpline_t *spline, float t);
+
+void trajectoryLimiterInit(trajectoryLimiter_t *limiter, float position);
+float trajectoryLimiterApply(trajectoryLimiter_t *limiter, float target, float maxVelocity, float maxAcceleration, float dT);
+# 26 "./src/main/fc/rc_controls.h" 2
+
+
+typedef enum rc_alias {
+    ROLL = 0,
+    PITCH,
+    YAW,
+    THROTTLE,
+    AUX1,
+    AUX2,
+    AUX3,
+    AUX4,
+    AUX5,
+    AUX6,
+    AUX7,
+    AUX8
+} rc_alias_e;
+
+
+
+typedef enum {
+    THROTTLE_LOW = 0,
+    THROTTLE_HIGH
+} throttleStatus_e;
+
+
+
+typedef enum {
+    NOT_CENTERED = 0,
+    CENTERED
+} rollPitchStatus_e;
+
+typedef enum {
+    RC_SMOOTHING_OFF = 0,
+    RC_SMOOTHING_DEFAULT,
+    RC_SMOOTHING_AUTO,
+    RC_SMOOTHING_MANUAL
+} rcSmoothing_t;
+
+typedef enum {
+    RC_SMOOTHING_TYPE_INTERPOLATION,
+    RC_SMOOTHING_TYPE_FILTER,
+    RC_SMOOTHING_TYPE_SPLINE
+} rcSmoothingType_e;
+
+typedef enum {
+    RC_SMOOTHING_INPUT_PT1,
+    RC_SMOOTHING_INPUT_BIQUAD
+} rcSmoothingInputFilter_e;
+
+typedef enum {
+    RC_SMOOTHING_DERIVATIVE_OFF,
+    RC_SMOOTHING_DERIVATIVE_PT1,
+    RC_SMOOTHING_DERIVATIVE_BIQUAD
+} rcSmoothingDerivativeFilter_e;
+
+typedef enum {
+    RC_SMOOTHING_VALUE_INPUT_ACTIVE,
+    RC_SMOOTHING_VALUE_DERIVATIVE_ACTIVE,
+    RC_SMOOTHING_VALUE_AVERAGE_FRAME
+} rcSmoothingInfoType_e;
+# 112 "./src/main/fc/rc_controls.h"
+extern float rcCommand[4];
+
+typedef struct rcSmoothingFilterTraining_s {
+    float sum;
+    int count;
+    uint16_t min;
+    uint16_t max;
+} rcSmoothingFilterTraining_t;
+
+typedef union rcSmoothingFilterTypes_u {
+    pt1Filter_t pt1Filter;
+    biquadFilter_t biquadFilter;
+} rcSmoothingFilterTypes_t;
+
+typedef struct rcSmoothingFilter_s {
+    
+# 127 "./src/main/fc/rc_controls.h" 3 4
+   _Bool 
+# 127 "./src/main/fc/rc_controls.h"
+        filterInitialized;
+    rcSmoothingFilterTypes_t filter[4];
+    uint16_t inputCutoffFrequency;
+    uint16_t derivativeCutoffFrequency;
+    int averageFrameTimeUs;
+    rcSmoothingFilterTraining_t training;
+} rcSmoothingFilter_t;
+
+typedef struct rcControlsConfig_s {
+    uint8_t deadband;
+    uint8_t yaw_deadband;
+    uint8_t alt_hold_deadband;
+    uint8_t alt_hold_fast_change;
+    
+# 140 "./src/main/fc/rc_controls.h" 3 4
+   _Bool 
+# 140 "./src/main/fc/rc_controls.h"
+        yaw_control_reversed;
+} rcControlsConfig_t;
+
+extern rcControlsConfig_t rcControlsConfig_System; extern rcControlsConfig_t rcControlsConfig_Copy; static inline const rcControlsConfig_t* rcControlsConfig(void) { return &rcControlsConfig_System; } static inline rcControlsConfig_t* rcControlsConfigMutable(void) { return &rcControlsConfig_System; } struct _dummy;
+
+typedef struct flight3DConfig_s {
+    uint16_t deadband3d_low;
+    uint16_t deadband3d_high;
+    uint16_t neutral3d;
+    uint16_t deadband3d_throttle;
+    uint16_t limit3d_low;
+    uint16_t limit3d_high;
+    uint8_t switched_mode3d;
+} flight3DConfig_t;
+
+extern flight3DConfig_t flight3DConfig_System; extern flight3DConfig_t flight3DConfig_Copy; static inline const flight3DConfig_t* flight3DConfig(void) { return &flight3DConfig_System; } static inline flight3DConfig_t* flight3DConfigMutable(void) { return &flight3DConfig_System; } struct _dummy;
+
+typedef struct armingConfig_s {
+    uint8_t gyro_cal_on_first_arm;
+    uint8_t auto_disarm_delay;
+} armingConfig_t;
+
+extern armingConfig_t armingConfig_System; extern armingConfig_t armingConfig_Copy; static inline const armingConfig_t* armingConfig(void) { return &armingConfig_System; } static inline armingConfig_t* armingConfigMutable(void) { return &armingConfig_System; } struct _dummy;
+
+
+# 164 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 164 "./src/main/fc/rc_controls.h"
+    areUsingSticksToArm(void);
+
+
+# 166 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 166 "./src/main/fc/rc_controls.h"
+    areSticksInApModePosition(uint16_t ap_mode);
+throttleStatus_e calculateThrottleStatus(void);
+void processRcStickPositions();
+
+
+# 170 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 170 "./src/main/fc/rc_controls.h"
+    isUsingSticksForArming(void);
+
+int32_t getRcStickDeflection(int32_t axis, uint16_t midrc);
+void rcControlsInit(void);
+# 48 "./src/main/cli/settings.c" 2
+
+# 1 "./src/main/flight/failsafe.h" 1
+# 21 "./src/main/flight/failsafe.h"
+       
+# 35 "./src/main/flight/failsafe.h"
+typedef struct failsafeConfig_s {
+    uint16_t failsafe_throttle;
+    uint16_t failsafe_throttle_low_delay;
+    uint8_t failsafe_delay;
+    uint8_t failsafe_off_delay;
+    uint8_t failsafe_switch_mode;
+    uint8_t failsafe_procedure;
+} failsafeConfig_t;
+
+extern failsafeConfig_t failsafeConfig_System; extern failsafeConfig_t failsafeConfig_Copy; static inline const failsafeConfig_t* failsafeConfig(void) { return &failsafeConfig_System; } static inline failsafeConfig_t* failsafeConfigMutable(void) { return &failsafeConfig_System; } struct _dummy;
+
+typedef enum {
+    FAILSAFE_IDLE = 0,
+    FAILSAFE_RX_LOSS_DETECTED,
+    FAILSAFE_LANDING,
+    FAILSAFE_LANDED,
+    FAILSAFE_RX_LOSS_MONITORING,
+    FAILSAFE_RX_LOSS_RECOVERED,
+    FAILSAFE_GPS_RESCUE
+} failsafePhase_e;
+
+typedef enum {
+    FAILSAFE_RXLINK_DOWN = 0,
+    FAILSAFE_RXLINK_UP
+} failsafeRxLinkState_e;
+
+typedef enum {
+    FAILSAFE_PROCEDURE_AUTO_LANDING = 0,
+    FAILSAFE_PROCEDURE_DROP_IT,
+    FAILSAFE_PROCEDURE_GPS_RESCUE,
+    FAILSAFE_PROCEDURE_COUNT
+} failsafeProcedure_e;
+
+extern const char * const failsafeProcedureNames[FAILSAFE_PROCEDURE_COUNT];
+
+typedef enum {
+    FAILSAFE_SWITCH_MODE_STAGE1 = 0,
+    FAILSAFE_SWITCH_MODE_KILL,
+    FAILSAFE_SWITCH_MODE_STAGE2
+} failsafeSwitchMode_e;
+
+typedef struct failsafeState_s {
+    int16_t events;
+    
+# 78 "./src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 78 "./src/main/flight/failsafe.h"
+        monitoring;
+    
+# 79 "./src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 79 "./src/main/flight/failsafe.h"
+        active;
+    uint32_t rxDataFailurePeriod;
+    uint32_t validRxDataReceivedAt;
+    uint32_t validRxDataFailedAt;
+    uint32_t throttleLowPeriod;
+    uint32_t landingShouldBeFinishedAt;
+    uint32_t receivingRxDataPeriod;
+    uint32_t receivingRxDataPeriodPreset;
+    failsafePhase_e phase;
+    failsafeRxLinkState_e rxLinkState;
+} failsafeState_t;
+
+void failsafeInit(void);
+void failsafeReset(void);
+
+void failsafeStartMonitoring(void);
+void failsafeUpdateState(void);
+
+failsafePhase_e failsafePhase(void);
+
+# 98 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 98 "./src/main/flight/failsafe.h"
+    failsafeIsMonitoring(void);
+
+# 99 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 99 "./src/main/flight/failsafe.h"
+    failsafeIsActive(void);
+
+# 100 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 100 "./src/main/flight/failsafe.h"
+    failsafeIsReceivingRxData(void);
+void failsafeOnRxSuspend(uint32_t suspendPeriod);
+void failsafeOnRxResume(void);
+
+void failsafeOnValidDataReceived(void);
+void failsafeOnValidDataFailed(void);
+# 50 "./src/main/cli/settings.c" 2
+# 1 "./src/main/flight/gps_rescue.h" 1
+# 18 "./src/main/flight/gps_rescue.h"
+       
+
+# 1 "./src/main/common/axis.h" 1
+# 21 "./src/main/common/axis.h"
+       
+
+typedef enum {
+    X = 0,
+    Y,
+    Z
+} axis_e;
+
+
+
+
+typedef enum {
+    FD_ROLL = 0,
+    FD_PITCH,
+    FD_YAW
+} flight_dynamics_index_t;
+
+
+
+typedef enum {
+    AI_ROLL = 0,
+    AI_PITCH
+} angle_index_t;
+# 21 "./src/main/flight/gps_rescue.h" 2
+
+
+
+typedef struct gpsRescue_s {
+    uint16_t angle;
+    uint16_t initialAltitudeM;
+    uint16_t descentDistanceM;
+    uint16_t rescueGroundspeed;
+    uint16_t throttleP, throttleI, throttleD;
+    uint16_t yawP;
+    uint16_t throttleMin;
+    uint16_t throttleMax;
+    uint16_t throttleHover;
+    uint16_t velP, velI, velD;
+    uint8_t minSats;
+    uint16_t minRescueDth;
+    uint8_t sanityChecks;
+    uint8_t allowArmingWithoutFix;
+    uint8_t useMag;
+} gpsRescueConfig_t;
+
+extern gpsRescueConfig_t gpsRescueConfig_System; extern gpsRescueConfig_t gpsRescueConfig_Copy; static inline const gpsRescueConfig_t* gpsRescueConfig(void) { return &gpsRescueConfig_System; } static inline gpsRescueConfig_t* gpsRescueConfigMutable(void) { return &gpsRescueConfig_System; } struct _dummy;
+
+extern int32_t gpsRescueAngle[2];
+
+void updateGPSRescueState(void);
+void rescueNewGpsData(void);
+
+float gpsRescueGetYawRate(void);
+float gpsRescueGetThrottle(void);
+
+# 51 "./src/main/flight/gps_rescue.h" 3 4
+_Bool 
+# 51 "./src/main/flight/gps_rescue.h"
+    gpsRescueIsConfigured(void);
+
+# 52 "./src/main/flight/gps_rescue.h" 3 4
+_Bool 
+# 52 "./src/main/flight/gps_rescue.h"
+    gpsRescueIsAvailable(void);
+
+# 53 "./src/main/flight/gps_rescue.h" 3 4
+_Bool 
+# 53 "./src/main/flight/gps_rescue.h"
+    gpsRescueIsDisabled(void);
+
+# 54 "./src/main/flight/gps_rescue.h" 3 4
+_Bool 
+# 54 "./src/main/flight/gps_rescue.h"
+    gpsRescueDisableMag(void);
+# 51 "./src/main/cli/settings.c" 2
+# 1 "./src/main/flight/imu.h" 1
+# 21 "./src/main/flight/imu.h"
+       
+
+
+
+# 1 "./src/main/common/maths.h" 1
+# 21 "./src/main/common/maths.h"
+       
+# 71 "./src/main/common/maths.h"
+typedef int32_t fix12_t;
+
+typedef struct stdev_s
+{
+    float m_oldM, m_newM, m_oldS, m_newS;
+    int m_n;
+} stdev_t;
+
+
+typedef struct fp_vector {
+    float X;
+    float Y;
+    float Z;
+} t_fp_vector_def;
+
+typedef union u_fp_vector {
+    float A[3];
+    t_fp_vector_def V;
+} t_fp_vector;
+
+
+
+typedef struct fp_angles {
+    float roll;
+    float pitch;
+    float yaw;
+} fp_angles_def;
+
+typedef union {
+    float raw[3];
+    fp_angles_def angles;
+} fp_angles_t;
+
+int gcd(int num, int denom);
+float powerf(float base, int exp);
+int32_t applyDeadband(int32_t value, int32_t deadband);
+float fapplyDeadband(float value, float deadband);
+
+void devClear(stdev_t *dev);
+void devPush(stdev_t *dev, float x);
+float devVariance(stdev_t *dev);
+float devStandardDeviation(stdev_t *dev);
+float degreesToRadians(int16_t degrees);
+
+int scaleRange(int x, int srcFrom, int srcTo, int destFrom, int destTo);
+float scaleRangef(float x, float srcFrom, float srcTo, float destFrom, float destTo);
+
+void normalizeV(struct fp_vector *src, struct fp_vector *dest);
+
+void rotateV(struct fp_vector *v, fp_angles_t *delta);
+void buildRotationMatrix(fp_angles_t *delta, float matrix[3][3]);
+
+int32_t quickMedianFilter3(int32_t * v);
+int32_t quickMedianFilter5(int32_t * v);
+int32_t quickMedianFilter7(int32_t * v);
+int32_t quickMedianFilter9(int32_t * v);
+
+float quickMedianFilter3f(float * v);
+float quickMedianFilter5f(float * v);
+float quickMedianFilter7f(float * v);
+float quickMedianFilter9f(float * v);
+
+
+float sin_approx(float x);
+float cos_approx(float x);
+float atan2_approx(float y, float x);
+float acos_approx(float x);
+
+float exp_approx(float val);
+float log_approx(float val);
+float pow_approx(float a, float b);
+# 153 "./src/main/common/maths.h"
+float wrap_2pi(float x);
+void sincos_approx(float x, float *sinOut, float *cosOut);
+void sincos_ramp_approx(float x, float *sinOut, float *cosOut);
+
+void arraySubInt32(int32_t *dest, int32_t *array1, int32_t *array2, int count);
+
+int16_t qPercent(fix12_t q);
+int16_t qMultiply(fix12_t q, int16_t input);
+fix12_t qConstruct(int16_t num, int16_t den);
+
+static inline int constrain(int amt, int low, int high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+
+static inline float constrainf(float amt, float low, float high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+# 26 "./src/main/flight/imu.h" 2
+
+
+
+extern uint32_t accTimeSum;
+extern int accSumCount;
+extern int32_t accSum[3];
+extern 
+# 32 "./src/main/flight/imu.h" 3 4
+      _Bool 
+# 32 "./src/main/flight/imu.h"
+           canUseGPSHeading;
+extern float accAverage[3];
+
+typedef struct {
+    float w,x,y,z;
+} quaternion;
+
+
+typedef struct {
+    float ww,wx,wy,wz,xx,xy,xz,yy,yz,zz;
+} quaternionProducts;
+
+
+typedef union {
+    int16_t raw[3];
+    struct {
+
+        int16_t roll;
+        int16_t pitch;
+        int16_t yaw;
+    } values;
+} attitudeEulerAngles_t;
+
+
+extern attitudeEulerAngles_t attitude;
+
+typedef struct imuConfig_s {
+    uint16_t dcm_kp;
+    uint16_t dcm_ki;
+    uint8_t small_angle;
+    uint8_t stroke_sync;
+    uint8_t fast_attitude;
+} imuConfig_t;
+
+extern imuConfig_t imuConfig_System; extern imuConfig_t imuConfig_Copy; static inline const imuConfig_t* imuConfig(void) { return &imuConfig_System; } static inline imuConfig_t* imuConfigMutable(void) { return &imuConfig_System; } struct _dummy;
+
+typedef struct imuRuntimeConfig_s {
+    float dcm_ki;
+    float dcm_kp;
+} imuRuntimeConfig_t;
+
+void imuConfigure(uint16_t throttle_correction_angle, uint8_t throttle_correction_value);
+
+float getCosTiltAngle(void);
+void getQuaternion(quaternion * q);
+void imuUpdateAttitude(timeUs_t currentTimeUs);
+void imuStrokeBoundary(timeUs_t currentTimeUs);
+void imuPropagateAttitude(const float *gyroRate, float dt);
+
+void imuResetAccelerationSum(void);
+void imuInit(void);
+
+
+void imuSetAttitudeRPY(float roll, float pitch, float yaw);
+void imuSetAttitudeQuat(float w, float x, float y, float z);
+
+
+
+
+
+void imuQuaternionComputeProducts(quaternion *quat, quaternionProducts *quatProd);
+
+# 93 "./src/main/flight/imu.h" 3 4
+_Bool 
+# 93 "./src/main/flight/imu.h"
+    imuQuaternionHeadfreeOffsetSet(void);
+void imuQuaternionHeadfreeTransformVectorEarthToBody(t_fp_vector_def * v);
+void imuComputeQuaternionFromRPY(quaternionProducts *qP, int16_t initialRoll, int16_t initialPitch, int16_t initialYaw);
+
+# 96 "./src/main/flight/imu.h" 3 4
+_Bool 
+# 96 "./src/main/flight/imu.h"
+    shouldInitializeGPSHeading(void);
+# 52 "./src/main/cli/settings.c" 2
+# 1 "./src/main/flight/mixer.h" 1
+# 21 "./src/main/flight/mixer.h"
+       
+
+
+
+
+
+# 1 "./src/main/drivers/pwm_output_counts.h" 1
+# 21 "./src/main/drivers/pwm_output_counts.h"
+       
+# 28 "./src/main/flight/mixer.h" 2
+
+# 1 "./src/main/drivers/pwm_output.h" 1
+# 21 "./src/main/drivers/pwm_output.h"
+       
+
+
+
+
+
+
+
+# 1 "./src/main/drivers/timer.h" 1
+# 21 "./src/main/drivers/timer.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/drivers/timer_def.h" 1
+# 21 "./src/main/drivers/timer_def.h"
+       
+# 29 "./src/main/drivers/timer.h" 2
+
+# 1 "./src/main/pg/timerio.h" 1
+# 21 "./src/main/pg/timerio.h"
+       
+
+
+
+
+# 1 "./src/main/drivers/io.h" 1
+# 21 "./src/main/drivers/io.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/drivers/resource.h" 1
+# 21 "./src/main/drivers/resource.h"
+       
+
+typedef enum {
+    OWNER_FREE = 0,
+    OWNER_PWMINPUT,
+    OWNER_PPMINPUT,
+    OWNER_MOTOR,
+    OWNER_SERVO,
+    OWNER_LED,
+    OWNER_ADC,
+    OWNER_ADC_BATT,
+    OWNER_ADC_CURR,
+    OWNER_ADC_EXT,
+    OWNER_ADC_RSSI,
+    OWNER_SERIAL_TX,
+    OWNER_SERIAL_RX,
+    OWNER_PINDEBUG,
+    OWNER_TIMER,
+    OWNER_SONAR_TRIGGER,
+    OWNER_SONAR_ECHO,
+    OWNER_SYSTEM,
+    OWNER_SPI_SCK,
+    OWNER_SPI_MISO,
+    OWNER_SPI_MOSI,
+    OWNER_I2C_SCL,
+    OWNER_I2C_SDA,
+    OWNER_SDCARD,
+    OWNER_SDCARD_CS,
+    OWNER_SDCARD_DETECT,
+    OWNER_FLASH_CS,
+    OWNER_BARO_CS,
+    OWNER_GYRO_CS,
+    OWNER_OSD_CS,
+    OWNER_RX_SPI_CS,
+    OWNER_SPI_CS,
+    OWNER_GYRO_EXTI,
+    OWNER_BARO_EXTI,
+    OWNER_COMPASS_EXTI,
+    OWNER_USB,
+    OWNER_USB_DETECT,
+    OWNER_BEEPER,
+    OWNER_OSD,
+    OWNER_RX_BIND,
+    OWNER_INVERTER,
+    OWNER_LED_STRIP,
+    OWNER_TRANSPONDER,
+    OWNER_VTX,
+    OWNER_COMPASS_CS,
+    OWNER_RX_BIND_PLUG,
+    OWNER_ESCSERIAL,
+    OWNER_CAMERA_CONTROL,
+    OWNER_TIMUP,
+    OWNER_RANGEFINDER,
+    OWNER_RX_SPI,
+    OWNER_PINIO,
+    OWNER_USB_MSC_PIN,
+    OWNER_MCO,
+    OWNER_RX_SPI_BIND,
+    OWNER_RX_SPI_LED,
+    OWNER_PREINIT,
+    OWNER_RX_SPI_EXTI,
+    OWNER_RX_SPI_CC2500_TX_EN,
+    OWNER_RX_SPI_CC2500_LNA_EN,
+    OWNER_RX_SPI_CC2500_ANT_SEL,
+    OWNER_TOTAL_COUNT
+} resourceOwner_e;
+
+extern const char * const ownerNames[OWNER_TOTAL_COUNT];
+# 29 "./src/main/drivers/io.h" 2
+# 110 "./src/main/drivers/io.h"
+# 1 "./src/main/drivers/io_def.h" 1
+# 21 "./src/main/drivers/io_def.h"
+       
+# 54 "./src/main/drivers/io_def.h"
+# 1 "./src/main/drivers/io_def_generated.h" 1
+# 21 "./src/main/drivers/io_def_generated.h"
+       
+# 55 "./src/main/drivers/io_def.h" 2
+# 111 "./src/main/drivers/io.h" 2
+
+
+# 112 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 112 "./src/main/drivers/io.h"
+    IORead(IO_t io);
+void IOWrite(IO_t io, 
+# 113 "./src/main/drivers/io.h" 3 4
+                     _Bool 
+# 113 "./src/main/drivers/io.h"
+                          value);
+void IOHi(IO_t io);
+void IOLo(IO_t io);
+void IOToggle(IO_t io);
+
+void IOInit(IO_t io, resourceOwner_e owner, uint8_t index);
+void IORelease(IO_t io);
+resourceOwner_e IOGetOwner(IO_t io);
+
+# 121 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 121 "./src/main/drivers/io.h"
+    IOIsFreeOrPreinit(IO_t io);
+IO_t IOGetByTag(ioTag_t tag);
+
+void IOConfigGPIO(IO_t io, ioConfig_t cfg);
+
+
+
+
+void IOInitGlobal(void);
+# 27 "./src/main/pg/timerio.h" 2
+# 31 "./src/main/drivers/timer.h" 2
+
+
+
+
+
+typedef uint16_t captureCompare_t;
+# 59 "./src/main/drivers/timer.h"
+typedef uint32_t timCCR_t;
+typedef uint32_t timCCER_t;
+typedef uint32_t timSR_t;
+typedef uint32_t timCNT_t;
+
+
+
+
+typedef enum {
+    TIM_USE_ANY = 0x0,
+    TIM_USE_NONE = 0x0,
+    TIM_USE_PPM = 0x1,
+    TIM_USE_PWM = 0x2,
+    TIM_USE_MOTOR = 0x4,
+    TIM_USE_SERVO = 0x8,
+    TIM_USE_LED = 0x10,
+    TIM_USE_TRANSPONDER = 0x20,
+    TIM_USE_BEEPER = 0x40,
+    TIM_USE_CAMERA_CONTROL = 0x80,
+} timerUsageFlag_e;
+
+
+struct timerCCHandlerRec_s;
+struct timerOvrHandlerRec_s;
+typedef void timerCCHandlerCallback(struct timerCCHandlerRec_s* self, uint16_t capture);
+typedef void timerOvrHandlerCallback(struct timerOvrHandlerRec_s* self, uint16_t capture);
+
+typedef struct timerCCHandlerRec_s {
+    timerCCHandlerCallback* fn;
+} timerCCHandlerRec_t;
+
+typedef struct timerOvrHandlerRec_s {
+    timerOvrHandlerCallback* fn;
+    struct timerOvrHandlerRec_s* next;
+} timerOvrHandlerRec_t;
+
+typedef struct timerDef_s {
+    TIM_TypeDef *TIMx;
+    rccPeriphTag_t rcc;
+    uint8_t inputIrq;
+} timerDef_t;
+
+typedef struct timerHardware_s {
+    TIM_TypeDef *tim;
+    ioTag_t tag;
+    uint8_t channel;
+    timerUsageFlag_e usageFlags;
+    uint8_t output;
+# 137 "./src/main/drivers/timer.h"
+} timerHardware_t;
+
+typedef enum {
+    TIMER_OUTPUT_NONE = 0,
+    TIMER_OUTPUT_INVERTED = (1 << 0),
+    TIMER_OUTPUT_N_CHANNEL = (1 << 1),
+} timerFlag_e;
+# 166 "./src/main/drivers/timer.h"
+extern const timerHardware_t timerHardware[];
+# 208 "./src/main/drivers/timer.h"
+extern const timerDef_t timerDefinitions[];
+
+typedef enum {
+    TYPE_FREE,
+    TYPE_PWMINPUT,
+    TYPE_PPMINPUT,
+    TYPE_PWMOUTPUT_MOTOR,
+    TYPE_PWMOUTPUT_FAST,
+    TYPE_PWMOUTPUT_SERVO,
+    TYPE_SOFTSERIAL_RX,
+    TYPE_SOFTSERIAL_TX,
+    TYPE_SOFTSERIAL_RXTX,
+    TYPE_SOFTSERIAL_AUXTIMER,
+    TYPE_ADC,
+    TYPE_SERIAL_RX,
+    TYPE_SERIAL_TX,
+    TYPE_SERIAL_RXTX,
+    TYPE_TIMER
+} channelType_t;
+
+void timerConfigure(const timerHardware_t *timHw, uint16_t period, uint32_t hz);
+
+void timerChConfigIC(const timerHardware_t *timHw, 
+# 230 "./src/main/drivers/timer.h" 3 4
+                                                  _Bool 
+# 230 "./src/main/drivers/timer.h"
+                                                       polarityRising, unsigned inputFilterSamples);
+void timerChConfigICDual(const timerHardware_t* timHw, 
+# 231 "./src/main/drivers/timer.h" 3 4
+                                                      _Bool 
+# 231 "./src/main/drivers/timer.h"
+                                                           polarityRising, unsigned inputFilterSamples);
+void timerChICPolarity(const timerHardware_t *timHw, 
+# 232 "./src/main/drivers/timer.h" 3 4
+                                                    _Bool 
+# 232 "./src/main/drivers/timer.h"
+                                                         polarityRising);
+volatile timCCR_t* timerChCCR(const timerHardware_t* timHw);
+volatile timCCR_t* timerChCCRLo(const timerHardware_t* timHw);
+volatile timCCR_t* timerChCCRHi(const timerHardware_t* timHw);
+void timerChConfigOC(const timerHardware_t* timHw, 
+# 236 "./src/main/drivers/timer.h" 3 4
+                                                  _Bool 
+# 236 "./src/main/drivers/timer.h"
+                                                       outEnable, 
+# 236 "./src/main/drivers/timer.h" 3 4
+                                                                  _Bool 
+# 236 "./src/main/drivers/timer.h"
+                                                                       stateHigh);
+void timerChConfigGPIO(const timerHardware_t* timHw, ioConfig_t mode);
+
+void timerChCCHandlerInit(timerCCHandlerRec_t *self, timerCCHandlerCallback *fn);
+void timerChOvrHandlerInit(timerOvrHandlerRec_t *self, timerOvrHandlerCallback *fn);
+void timerChConfigCallbacks(const timerHardware_t *channel, timerCCHandlerRec_t *edgeCallback, timerOvrHandlerRec_t *overflowCallback);
+void timerChConfigCallbacksDual(const timerHardware_t *channel, timerCCHandlerRec_t *edgeCallbackLo, timerCCHandlerRec_t *edgeCallbackHi, timerOvrHandlerRec_t *overflowCallback);
+void timerChITConfigDualLo(const timerHardware_t* timHw, FunctionalState newState);
+void timerChITConfig(const timerHardware_t* timHw, FunctionalState newState);
+void timerChClearCCFlag(const timerHardware_t* timHw);
+
+void timerChInit(const timerHardware_t *timHw, channelType_t type, int irqPriority, uint8_t irq);
+
+void timerInit(void);
+void timerStart(void);
+void timerForceOverflow(TIM_TypeDef *tim);
+
+uint32_t timerClock(TIM_TypeDef *tim);
+
+void configTimeBase(TIM_TypeDef *tim, uint16_t period, uint32_t hz);
+
+rccPeriphTag_t timerRCC(TIM_TypeDef *tim);
+uint8_t timerInputIrq(TIM_TypeDef *tim);
+
+
+
+
+const timerHardware_t *timerGetByTag(ioTag_t ioTag);
+const timerHardware_t *timerGetByTagAndIndex(ioTag_t ioTag, unsigned timerIndex);
+ioTag_t timerioTagGetByUsage(timerUsageFlag_e usageFlag, uint8_t index);
+
+
+
+
+
+
+
+void timerOCInit(TIM_TypeDef *tim, uint8_t channel, TIM_OCInitTypeDef *init);
+void timerOCPreloadConfig(TIM_TypeDef *tim, uint8_t channel, uint16_t preload);
+
+
+volatile timCCR_t *timerCCR(TIM_TypeDef *tim, uint8_t channel);
+uint16_t timerDmaSource(uint8_t channel);
+
+uint16_t timerGetPrescalerByDesiredHertz(TIM_TypeDef *tim, uint32_t hz);
+uint16_t timerGetPrescalerByDesiredMhz(TIM_TypeDef *tim, uint16_t mhz);
+uint16_t timerGetPeriodByPrescaler(TIM_TypeDef *tim, uint16_t prescaler, uint32_t hz);
+
+int8_t timerGetTIMNumber(const TIM_TypeDef *tim);
+uint8_t timerLookupChannelIndex(const uint16_t channel);
+# 30 "./src/main/drivers/pwm_output.h" 2
+# 49 "./src/main/drivers/pwm_output.h"
+typedef enum {
+    DSHOT_CMD_MOTOR_STOP = 0,
+    DSHOT_CMD_BEACON1,
+    DSHOT_CMD_BEACON2,
+    DSHOT_CMD_BEACON3,
+    DSHOT_CMD_BEACON4,
+    DSHOT_CMD_BEACON5,
+    DSHOT_CMD_ESC_INFO,
+    DSHOT_CMD_SPIN_DIRECTION_1,
+    DSHOT_CMD_SPIN_DIRECTION_2,
+    DSHOT_CMD_3D_MODE_OFF,
+    DSHOT_CMD_3D_MODE_ON,
+    DSHOT_CMD_SETTINGS_REQUEST,
+    DSHOT_CMD_SAVE_SETTINGS,
+    DSHOT_CMD_SPIN_DIRECTION_NORMAL = 20,
+    DSHOT_CMD_SPIN_DIRECTION_REVERSED = 21,
+    DSHOT_CMD_LED0_ON,
+    DSHOT_CMD_LED1_ON,
+    DSHOT_CMD_LED2_ON,
+    DSHOT_CMD_LED3_ON,
+    DSHOT_CMD_LED0_OFF,
+    DSHOT_CMD_LED1_OFF,
+    DSHOT_CMD_LED2_OFF,
+    DSHOT_CMD_LED3_OFF,
+    DSHOT_CMD_AUDIO_STREAM_MODE_ON_OFF = 30,
+    DSHOT_CMD_SILENT_MODE_ON_OFF = 31,
+    DSHOT_CMD_SIGNAL_LINE_TELEMETRY_DISABLE = 32,
+    DSHOT_CMD_SIGNAL_LINE_CONTINUOUS_ERPM_TELEMETRY = 33,
+    DSHOT_CMD_MAX = 47
+} dshotCommands_e;
+
+
+
+
+typedef enum {
+    PWM_TYPE_STANDARD = 0,
+    PWM_TYPE_ONESHOT125,
+    PWM_TYPE_ONESHOT42,
+    PWM_TYPE_MULTISHOT,
+    PWM_TYPE_BRUSHED,
+
+
+
+
+
+
+
+    PWM_TYPE_MAX
+} motorPwmProtocolTypes_e;
+# 125 "./src/main/drivers/pwm_output.h"
+typedef struct {
+    TIM_TypeDef *timer;
+# 137 "./src/main/drivers/pwm_output.h"
+    uint16_t timerDmaSources;
+} motorDmaTimer_t;
+
+typedef struct {
+    ioTag_t ioTag;
+    const timerHardware_t *timerHardware;
+    uint16_t value;
+# 174 "./src/main/drivers/pwm_output.h"
+    motorDmaTimer_t *timer;
+    volatile 
+# 175 "./src/main/drivers/pwm_output.h" 3 4
+            _Bool 
+# 175 "./src/main/drivers/pwm_output.h"
+                 requestTelemetry;
+
+
+
+
+
+
+    uint8_t dmaBuffer[18];
+
+
+} motorDmaOutput_t;
+
+motorDmaOutput_t *getMotorDmaOutput(uint8_t index);
+
+struct timerHardware_s;
+typedef void pwmWriteFn(uint8_t index, float value);
+typedef void pwmCompleteWriteFn(uint8_t motorCount);
+typedef 
+# 192 "./src/main/drivers/pwm_output.h" 3 4
+       _Bool 
+# 192 "./src/main/drivers/pwm_output.h"
+            pwmStartWriteFn(uint8_t motorCount);
+
+typedef struct {
+    volatile timCCR_t *ccr;
+    TIM_TypeDef *tim;
+} timerChannel_t;
+
+typedef struct {
+    timerChannel_t channel;
+    float pulseScale;
+    float pulseOffset;
+    
+# 203 "./src/main/drivers/pwm_output.h" 3 4
+   _Bool 
+# 203 "./src/main/drivers/pwm_output.h"
+        forceOverflow;
+    
+# 204 "./src/main/drivers/pwm_output.h" 3 4
+   _Bool 
+# 204 "./src/main/drivers/pwm_output.h"
+        enabled;
+    IO_t io;
+} pwmOutputPort_t;
+
+
+typedef struct motorDevConfig_s {
+    uint16_t motorPwmRate;
+    uint8_t motorPwmProtocol;
+    uint8_t motorPwmInversion;
+    uint8_t useUnsyncedPwm;
+    uint8_t useBurstDshot;
+    uint8_t useDshotTelemetry;
+    ioTag_t ioTags[8];
+} motorDevConfig_t;
+
+extern 
+# 219 "./src/main/drivers/pwm_output.h" 3 4
+      _Bool 
+# 219 "./src/main/drivers/pwm_output.h"
+           useBurstDshot;
+
+
+
+
+
+void motorDevInit(const motorDevConfig_t *motorDevConfig, uint16_t idlePulse, uint8_t motorCount);
+
+typedef struct servoDevConfig_s {
+
+    uint16_t servoCenterPulse;
+    uint16_t servoPwmRate;
+    ioTag_t ioTags[8];
+} servoDevConfig_t;
+
+void servoDevInit(const servoDevConfig_t *servoDevConfig);
+
+void pwmServoConfig(const struct timerHardware_s *timerHardware, uint8_t servoIndex, uint16_t servoPwmRate, uint16_t servoCenterPulse);
+
+
+# 238 "./src/main/drivers/pwm_output.h" 3 4
+_Bool 
+# 238 "./src/main/drivers/pwm_output.h"
+    isMotorProtocolDshot(void);
+# 272 "./src/main/drivers/pwm_output.h"
+void pwmOutConfig(timerChannel_t *channel, const timerHardware_t *timerHardware, uint32_t hz, uint16_t period, uint16_t value, uint8_t inversion);
+
+void pwmWriteMotor(uint8_t index, float value);
+void pwmShutdownPulsesForAllMotors(uint8_t motorCount);
+void pwmCompleteMotorUpdate(uint8_t motorCount);
+
+# 277 "./src/main/drivers/pwm_output.h" 3 4
+_Bool 
+# 277 "./src/main/drivers/pwm_output.h"
+    pwmStartMotorUpdate(uint8_t motorCount);
+
+void pwmWriteServo(uint8_t index, float value);
+
+pwmOutputPort_t *pwmGetMotors(void);
+
+# 282 "./src/main/drivers/pwm_output.h" 3 4
+_Bool 
+# 282 "./src/main/drivers/pwm_output.h"
+    pwmIsSynced(void);
+void pwmDisableMotors(void);
+void pwmEnableMotors(void);
+
+# 285 "./src/main/drivers/pwm_output.h" 3 4
+_Bool 
+# 285 "./src/main/drivers/pwm_output.h"
+    pwmAreMotorsEnabled(void);
+# 30 "./src/main/flight/mixer.h" 2
+# 40 "./src/main/flight/mixer.h"
+typedef enum mixerMode
+{
+    MIXER_TRI = 1,
+    MIXER_QUADP = 2,
+    MIXER_QUADX = 3,
+    MIXER_BICOPTER = 4,
+    MIXER_GIMBAL = 5,
+    MIXER_Y6 = 6,
+    MIXER_HEX6 = 7,
+    MIXER_FLYING_WING = 8,
+    MIXER_Y4 = 9,
+    MIXER_HEX6X = 10,
+    MIXER_OCTOX8 = 11,
+    MIXER_OCTOFLATP = 12,
+    MIXER_OCTOFLATX = 13,
+    MIXER_AIRPLANE = 14,
+    MIXER_HELI_120_CCPM = 15,
+    MIXER_HELI_90_DEG = 16,
+    MIXER_VTAIL4 = 17,
+    MIXER_HEX6H = 18,
+    MIXER_PPM_TO_SERVO = 19,
+    MIXER_DUALCOPTER = 20,
+    MIXER_SINGLECOPTER = 21,
+    MIXER_ATAIL4 = 22,
+    MIXER_CUSTOM = 23,
+    MIXER_CUSTOM_AIRPLANE = 24,
+    MIXER_CUSTOM_TRI = 25,
+    MIXER_QUADX_1234 = 26,
+    MIXER_SERVO_ORNITHOPTER = 27
+} mixerMode_e;
+
+
+typedef struct motorMixer_s {
+    float throttle;
+    float roll;
+    float pitch;
+    float yaw;
+} motorMixer_t;
+
+extern motorMixer_t customMotorMixer_SystemArray[8]; extern motorMixer_t customMotorMixer_CopyArray[8]; static inline const motorMixer_t* customMotorMixer(int _index) { return &customMotorMixer_SystemArray[_index]; } static inline motorMixer_t* customMotorMixerMutable(int _index) { return &customMotorMixer_SystemArray[_index]; } static inline motorMixer_t (* customMotorMixer_array(void))[8] { return &customMotorMixer_SystemArray; } struct _dummy;
+
+
+typedef struct mixer_s {
+    uint8_t motorCount;
+    uint8_t useServo;
+    const motorMixer_t *motor;
+} mixer_t;
+
+typedef struct mixerConfig_s {
+    uint8_t mixerMode;
+    
+# 90 "./src/main/flight/mixer.h" 3 4
+   _Bool 
+# 90 "./src/main/flight/mixer.h"
+        yaw_motors_reversed;
+    uint8_t crashflip_motor_percent;
+} mixerConfig_t;
+
+extern mixerConfig_t mixerConfig_System; extern mixerConfig_t mixerConfig_Copy; static inline const mixerConfig_t* mixerConfig(void) { return &mixerConfig_System; } static inline mixerConfig_t* mixerConfigMutable(void) { return &mixerConfig_System; } struct _dummy;
+
+typedef struct motorConfig_s {
+    motorDevConfig_t dev;
+    uint16_t digitalIdleOffsetValue;
+    uint16_t minthrottle;
+    uint16_t maxthrottle;
+    uint16_t mincommand;
+    uint8_t motorPoleCount;
+} motorConfig_t;
+
+extern motorConfig_t motorConfig_System; extern motorConfig_t motorConfig_Copy; static inline const motorConfig_t* motorConfig(void) { return &motorConfig_System; } static inline motorConfig_t* motorConfigMutable(void) { return &motorConfig_System; } struct _dummy;
+
+
+
+extern float motor[8];
+extern float motor_disarmed[8];
+extern float motorOutputHigh, motorOutputLow;
+struct rxConfig_s;
+
+uint8_t getMotorCount(void);
+float getMotorMixRange(void);
+
+# 116 "./src/main/flight/mixer.h" 3 4
+_Bool 
+# 116 "./src/main/flight/mixer.h"
+    areMotorsRunning(void);
+
+void mixerLoadMix(int index, motorMixer_t *customMixers);
+void initEscEndpoints(void);
+void mixerInit(mixerMode_e mixerMode);
+
+void mixerConfigureOutput(void);
+
+void mixerResetDisarmedMotors(void);
+void mixTable(timeUs_t currentTimeUs, uint8_t vbatPidCompensation);
+void syncMotors(
+# 126 "./src/main/flight/mixer.h" 3 4
+               _Bool 
+# 126 "./src/main/flight/mixer.h"
+                    enabled);
+void writeMotors(void);
+void stopMotors(void);
+void stopPwmAllMotors(void);
+
+float convertExternalToMotor(uint16_t externalValue);
+uint16_t convertMotorToExternal(float motorValue);
+
+# 133 "./src/main/flight/mixer.h" 3 4
+_Bool 
+# 133 "./src/main/flight/mixer.h"
+    mixerIsTricopter(void);
+
+void mixerSetThrottleAngleCorrection(int correctionValue);
+float mixerGetLoggingThrottle(void);
+# 53 "./src/main/cli/settings.c" 2
+# 1 "./src/main/flight/pid.h" 1
+# 21 "./src/main/flight/pid.h"
+       
+# 51 "./src/main/flight/pid.h"
+typedef enum {
+    PID_ROLL,
+    PID_PITCH,
+    PID_YAW,
+    PID_LEVEL,
+    PID_MAG,
+    PID_ITEM_COUNT
+} pidIndex_e;
+
+typedef enum {
+    SUPEREXPO_YAW_OFF = 0,
+    SUPEREXPO_YAW_ON,
+    SUPEREXPO_YAW_ALWAYS
+} pidSuperExpoYaw_e;
+
+typedef enum {
+    PID_STABILISATION_OFF = 0,
+    PID_STABILISATION_ON
+} pidStabilisationState_e;
+
+typedef enum {
+    PID_CRASH_RECOVERY_OFF = 0,
+    PID_CRASH_RECOVERY_ON,
+    PID_CRASH_RECOVERY_BEEP
+} pidCrashRecovery_e;
+
+typedef struct pidf_s {
+    uint8_t P;
+    uint8_t I;
+    uint8_t D;
+    uint16_t F;
+} pidf_t;
+
+typedef enum {
+    ANTI_GRAVITY_SMOOTH,
+    ANTI_GRAVITY_STEP
+} antiGravityMode_e;
+
+typedef enum {
+    ITERM_RELAX_OFF,
+    ITERM_RELAX_RP,
+    ITERM_RELAX_RPY,
+    ITERM_RELAX_RP_INC,
+    ITERM_RELAX_RPY_INC
+} itermRelax_e;
+
+typedef enum {
+    ITERM_RELAX_GYRO,
+    ITERM_RELAX_SETPOINT
+} itermRelaxType_e;
+
+typedef struct pidProfile_s {
+    uint16_t yaw_lowpass_hz;
+    uint16_t dterm_lowpass_hz;
+    uint16_t dterm_notch_hz;
+    uint16_t dterm_notch_cutoff;
+
+    pidf_t pid[PID_ITEM_COUNT];
+
+    uint8_t dterm_filter_type;
+    uint8_t itermWindupPointPercent;
+    uint16_t pidSumLimit;
+    uint16_t pidSumLimitYaw;
+    uint8_t pidAtMinThrottle;
+    uint8_t levelAngleLimit;
+
+    uint8_t horizon_tilt_effect;
+    uint8_t horizon_tilt_expert_mode;
+
+
+    uint8_t antiGravityMode;
+    uint16_t itermThrottleThreshold;
+    uint16_t itermAcceleratorGain;
+    uint16_t yawRateAccelLimit;
+    uint16_t rateAccelLimit;
+    uint16_t crash_dthreshold;
+    uint16_t crash_gthreshold;
+    uint16_t crash_setpoint_threshold;
+    uint16_t crash_time;
+    uint16_t crash_delay;
+    uint8_t crash_recovery_angle;
+    uint8_t crash_recovery_rate;
+    uint8_t vbatPidCompensation;
+    uint8_t feedForwardTransition;
+    uint16_t crash_limit_yaw;
+    uint16_t itermLimit;
+    uint16_t dterm_lowpass2_hz;
+    uint8_t crash_recovery;
+    uint8_t throttle_boost;
+    uint8_t throttle_boost_cutoff;
+    uint8_t iterm_rotation;
+    uint8_t smart_feedforward;
+    uint8_t iterm_relax_type;
+    uint8_t iterm_relax_cutoff;
+    uint8_t iterm_relax;
+    uint8_t acro_trainer_angle_limit;
+    uint8_t acro_trainer_debug_axis;
+    uint8_t acro_trainer_gain;
+    uint16_t acro_trainer_lookahead_ms;
+    uint8_t abs_control_gain;
+    uint8_t abs_control_limit;
+    uint8_t abs_control_error_limit;
+    uint8_t abs_control_cutoff;
+    uint8_t dterm_filter2_type;
+    uint16_t dyn_lpf_dterm_min_hz;
+    uint16_t dyn_lpf_dterm_max_hz;
+    uint8_t launchControlMode;
+    uint8_t launchControlThrottlePercent;
+    uint8_t launchControlAngleLimit;
+    uint8_t launchControlGain;
+    uint8_t launchControlAllowTriggerReset;
+    uint8_t use_integrated_yaw;
+    uint8_t integrated_yaw_relax;
+    uint8_t thrustLinearization;
+    uint8_t d_min[3];
+    uint8_t d_min_gain;
+    uint8_t d_min_advance;
+    uint8_t motor_output_limit;
+    int8_t auto_profile_cell_count;
+    uint8_t transient_throttle_limit;
+} pidProfile_t;
+
+extern pidProfile_t pidProfiles_SystemArray[3]; extern pidProfile_t pidProfiles_CopyArray[3]; static inline const pidProfile_t* pidProfiles(int _index) { return &pidProfiles_SystemArray[_index]; } static inline pidProfile_t* pidProfilesMutable(int _index) { return &pidProfiles_SystemArray[_index]; } static inline pidProfile_t (* pidProfiles_array(void))[3] { return &pidProfiles_SystemArray; } struct _dummy;
+
+typedef struct pidConfig_s {
+    uint8_t pid_process_denom;
+    uint8_t runaway_takeoff_prevention;
+    uint16_t runaway_takeoff_deactivate_delay;
+    uint8_t runaway_takeoff_deactivate_throttle;
+} pidConfig_t;
+
+extern pidConfig_t pidConfig_System; extern pidConfig_t pidConfig_Copy; static inline const pidConfig_t* pidConfig(void) { return &pidConfig_System; } static inline pidConfig_t* pidConfigMutable(void) { return &pidConfig_System; } struct _dummy;
+
+union rollAndPitchTrims_u;
+void pidController(const pidProfile_t *pidProfile, timeUs_t currentTimeUs);
+
+typedef struct pidAxisData_s {
+    float P;
+    float I;
+    float D;
+    float F;
+
+    float Sum;
+} pidAxisData_t;
+
+extern const char pidNames[];
+
+extern pidAxisData_t pidData[3];
+
+extern uint32_t targetPidLooptime;
+
+extern float throttleBoost;
+extern pt1Filter_t throttleLpf;
+
+extern float ornithopterFlapping;
+extern float flappingAmplitude;
+extern float shapedFlappingSinusoidLeft[];
+extern float shapedFlappingSinusoidRight[];
+extern float throttle_;
+
+
+typedef struct ornithopterWingState_s {
+    float theta;
+    float omega;
+    float amplitude;
+    float flapping;
+    float phaseModulation;
+    float ferocityModulation;
+    float ferocityDifferentialRoll;
+    float ferocityDifferentialYaw;
+    float asymmetryBias;
+} ornithopterWingState_t;
+
+void getOrnithopterWingState(ornithopterWingState_t *state);
+float getServoSpeedScale(void);
+float getFlappingSinusoid(void);
+
+void pidResetIterm(void);
+void pidStabilisationState(pidStabilisationState_e pidControllerState);
+void pidSetItermAccelerator(float newItermAccelerator);
+void pidInitFilters(const pidProfile_t *pidProfile);
+void pidInitConfig(const pidProfile_t *pidProfile);
+void pidInit(const pidProfile_t *pidProfile);
+void pidCopyProfile(uint8_t dstPidProfileIndex, uint8_t srcPidProfileIndex);
+
+# 235 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 235 "./src/main/flight/pid.h"
+    crashRecoveryModeActive(void);
+void pidAcroTrainerInit(void);
+void pidSetAcroTrainerState(
+# 237 "./src/main/flight/pid.h" 3 4
+                           _Bool 
+# 237 "./src/main/flight/pid.h"
+                                newState);
+void pidInitSetpointDerivativeLpf(uint16_t filterCutoff, uint8_t debugAxis, uint8_t filterType);
+void pidUpdateSetpointDerivativeLpf(uint16_t filterCutoff);
+void pidUpdateThrottle(float throttle);
+
+# 241 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 241 "./src/main/flight/pid.h"
+    pidOsdAntiGravityActive(void);
+
+# 242 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 242 "./src/main/flight/pid.h"
+    pidOsdAntiGravityMode(void);
+void pidSetAntiGravityState(
+# 243 "./src/main/flight/pid.h" 3 4
+                           _Bool 
+# 243 "./src/main/flight/pid.h"
+                                newState);
+
+# 244 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 244 "./src/main/flight/pid.h"
+    pidAntiGravityEnabled(void);
+# 265 "./src/main/flight/pid.h"
+void dynLpfDTermUpdate(float throttle);
+void pidSetItermReset(
+# 266 "./src/main/flight/pid.h" 3 4
+                     _Bool 
+# 266 "./src/main/flight/pid.h"
+                          enabled);
+float pidGetPreviousSetpoint(int axis);
+void applyOrnithopterPidDefaults(pidProfile_t *pidProfile, int8_t servoMountAngle);
+
+
+static inline float ferocityParamToFloat(int8_t param) {
+    return ((float)(param - 1) * 8.0f / 99.0f);
+}
+# 54 "./src/main/cli/settings.c" 2
+# 1 "./src/main/flight/position.h" 1
+# 21 "./src/main/flight/position.h"
+       
+
+
+
+
+# 25 "./src/main/flight/position.h" 3 4
+_Bool 
+# 25 "./src/main/flight/position.h"
+    isAltitudeOffset(void);
+void calculateEstimatedAltitude(timeUs_t currentTimeUs);
+void positionStrokeBoundary(timeUs_t currentTimeUs);
+int32_t getEstimatedAltitudeCm(void);
+int16_t getEstimatedVario(void);
+# 55 "./src/main/cli/settings.c" 2
+# 1 "./src/main/flight/servos.h" 1
+# 21 "./src/main/flight/servos.h"
+       
+
+
+
+
+# 1 "./src/main/flight/ornithopter_profile.h" 1
+
+
+
+
+
+
+       
+
+
+
+
+
+
+typedef struct ornithopterProfile_s {
+
+    int8_t ferocity_downstroke;
+    int8_t ferocity_upstroke;
+
+
+    int8_t glide_angle;
+
+
+    int8_t cadence_gain;
+    int8_t ferocity_d_gain;
+    int8_t ferocity_p_gain;
+    int8_t balance_gain;
+    int8_t warp_gain;
+    int8_t warp_yaw_gain;
+    int8_t ferocity_roll_gain;
+    int8_t ferocity_yaw_gain;
+
+
+    int8_t anchor_gain;
+
+
+    int8_t resonance_gain;
+    int8_t prescience_gain;
+    int8_t espelho_gain;
+    int8_t saudade_gain;
+    int8_t ssff_gain;
+
+
+    int8_t aeroelastic_glide_coefficient;
+    int8_t aeroelastic_flap_coefficient;
+} ornithopterProfile_t;
+
+extern ornithopterProfile_t ornithopterProfiles_SystemArray[4]; extern ornithopterProfile_t ornithopterProfiles_CopyArray[4]; static inline const ornithopterProfile_t* ornithopterProfiles(int _index) { return &ornithopterProfiles_SystemArray[_index]; } static inline ornithopterProfile_t* ornithopterProfilesMutable(int _index) { return &ornithopterProfiles_SystemArray[_index]; } static inline ornithopterProfile_t (* ornithopterProfiles_array(void))[4] { return &ornithopterProfiles_SystemArray; } struct _dummy;
+
+
+uint8_t getOrnithopterProfileIndex(void);
+const ornithopterProfile_t *currentOrnithopterProfile(void);
+ornithopterProfile_t *currentOrnithopterProfileMutable(void);
+void updateOrnithopterProfileFromBox(void);
+uint8_t getOrnithopterProfileIndexMSP(void);
+void setOrnithopterProfileIndexMSP(uint8_t index);
+# 27 "./src/main/flight/servos.h" 2
+
+
+enum {
+    INPUT_STABILIZED_ROLL = 0,
+    INPUT_STABILIZED_PITCH,
+    INPUT_STABILIZED_YAW,
+    INPUT_STABILIZED_THROTTLE,
+    INPUT_RC_ROLL,
+    INPUT_RC_PITCH,
+    INPUT_RC_YAW,
+    INPUT_RC_THROTTLE,
+    INPUT_RC_AUX1,
+    INPUT_RC_AUX2,
+    INPUT_RC_AUX3,
+    INPUT_RC_AUX4,
+    INPUT_GIMBAL_PITCH,
+    INPUT_GIMBAL_ROLL,
+    INPUT_STABILIZED_FLAPPING_0,
+    INPUT_STABILIZED_FLAPPING_1,
+    INPUT_STABILIZED_FLAPPING_2,
+    INPUT_STABILIZED_FLAPPING_3,
+    INPUT_STABILIZED_FLAPPING_4,
+    INPUT_STABILIZED_FLAPPING_5,
+    INPUT_STABILIZED_FLAPPING_6,
+    INPUT_STABILIZED_FLAPPING_7,
+    INPUT_SOURCE_COUNT
+};
+
+
+
+
+
+
+typedef enum {
+    SERVO_GIMBAL_PITCH = 0,
+    SERVO_GIMBAL_ROLL = 1,
+    SERVO_FLAPS = 2,
+    SERVO_FLAPPERON_1 = 3,
+    SERVO_FLAPPERON_2 = 4,
+    SERVO_RUDDER = 5,
+    SERVO_ELEVATOR = 6,
+    SERVO_THROTTLE = 7,
+
+    SERVO_BICOPTER_LEFT = 4,
+    SERVO_BICOPTER_RIGHT = 5,
+
+    SERVO_DUALCOPTER_LEFT = 4,
+    SERVO_DUALCOPTER_RIGHT = 5,
+
+    SERVO_SINGLECOPTER_1 = 3,
+    SERVO_SINGLECOPTER_2 = 4,
+    SERVO_SINGLECOPTER_3 = 5,
+    SERVO_SINGLECOPTER_4 = 6,
+
+    SERVO_HELI_LEFT = 0,
+    SERVO_HELI_RIGHT = 1,
+    SERVO_HELI_TOP = 2,
+    SERVO_HELI_RUD = 3,
+
+    SERVO_ORNITHOPTER_1 = 0,
+    SERVO_ORNITHOPTER_2 = 1,
+    SERVO_ORNITHOPTER_3 = 2,
+    SERVO_ORNITHOPTER_4 = 3,
+    SERVO_ORNITHOPTER_5 = 4,
+    SERVO_ORNITHOPTER_6 = 5,
+    SERVO_ORNITHOPTER_7 = 6,
+    SERVO_ORNITHOPTER_8 = 7,
+
+} servoIndex_e;
+# 117 "./src/main/flight/servos.h"
+typedef struct servoMixer_s {
+    uint8_t targetChannel;
+    uint8_t inputSource;
+    int8_t rate;
+    uint8_t speed;
+    int8_t min;
+    int8_t max;
+    uint8_t box;
+} servoMixer_t;
+
+extern servoMixer_t customServoMixers_SystemArray[(2 * 8)]; extern servoMixer_t customServoMixers_CopyArray[(2 * 8)]; static inline const servoMixer_t* customServoMixers(int _index) { return &customServoMixers_SystemArray[_index]; } static inline servoMixer_t* customServoMixersMutable(int _index) { return &customServoMixers_SystemArray[_index]; } static inline servoMixer_t (* customServoMixers_array(void))[(2 * 8)] { return &customServoMixers_SystemArray; } struct _dummy;
+
+
+
+
+
+typedef struct mixerRules_s {
+    uint8_t servoRuleCount;
+    const servoMixer_t *rule;
+} mixerRules_t;
+
+extern const mixerRules_t servoMixers[];
+
+typedef struct servoParam_s {
+    uint32_t reversedSources;
+    int16_t min;
+    int16_t max;
+    int16_t middle;
+    int8_t rate;
+    int8_t forwardFromChannel;
+} servoParam_t;
+
+extern servoParam_t servoParams_SystemArray[8]; extern servoParam_t servoParams_CopyArray[8]; static inline const servoParam_t* servoParams(int _index) { return &servoParams_SystemArray[_index]; } static inline servoParam_t* servoParamsMutable(int _index) { return &servoParams_SystemArray[_index]; } static inline servoParam_t (* servoParams_array(void))[8] { return &servoParams_SystemArray; } struct _dummy;
+
+typedef struct servoConfig_s {
+    servoDevConfig_t dev;
+    uint16_t servo_lowpass_freq;
+    uint8_t tri_unarmed_servo;
+    uint8_t channel_forwarding_start_channel;
+
+    int8_t servo_mount_angle[4];
+    int8_t flapping_phase_shift[4];
+    int8_t wing_origin_offset[4];
+    int8_t flap_base_amplitude;
+    uint16_t servo_speed_deg_s;
+    uint8_t servo_speed_vmin_pct;
+    uint8_t servo_accel_ms;
+    uint8_t servo_max_amplitude;
+    uint8_t flap_magnitude;
+
+
+    uint8_t ornithopter_freq_channel;
+    uint8_t ornithopter_freq_min;
+    uint8_t ornithopter_freq_max;
+
+
+    uint8_t ornithopter_profile_channel;
+    uint8_t ornithopter_profile_index;
+} servoConfig_t;
+
+extern servoConfig_t servoConfig_System; extern servoConfig_t servoConfig_Copy; static inline const servoConfig_t* servoConfig(void) { return &servoConfig_System; } static inline servoConfig_t* servoConfigMutable(void) { return &servoConfig_System; } struct _dummy;
+
+typedef struct servoProfile_s {
+    servoParam_t servoConf[8];
+} servoProfile_t;
+
+extern int16_t servo[8];
+
+
+# 185 "./src/main/flight/servos.h" 3 4
+_Bool 
+# 185 "./src/main/flight/servos.h"
+    isMixerUsingServos(void);
+float getServoTrackingError(int pair);
+float getServoTrackingDelay(int pair);
+void writeServos(void);
+void servoMixerLoadMix(int index);
+void loadCustomServoMixer(void);
+int servoDirection(int servoIndex, int fromChannel);
+void servoConfigureOutput(void);
+void servosInit(void);
+void servosFilterInit(void);
+void servoMixer(void);
+
+void servosTricopterInit(void);
+void servosTricopterMixer(void);
+
+# 199 "./src/main/flight/servos.h" 3 4
+_Bool 
+# 199 "./src/main/flight/servos.h"
+    servosTricopterIsEnabledServoUnarmed(void);
+# 56 "./src/main/cli/settings.c" 2
+
+# 1 "./src/main/io/beeper.h" 1
+# 21 "./src/main/io/beeper.h"
+       
+# 32 "./src/main/io/beeper.h"
+typedef enum {
+
+    BEEPER_SILENCE = 0,
+
+    BEEPER_GYRO_CALIBRATED,
+    BEEPER_RX_LOST,
+    BEEPER_RX_LOST_LANDING,
+    BEEPER_DISARMING,
+    BEEPER_ARMING,
+    BEEPER_ARMING_GPS_FIX,
+    BEEPER_BAT_CRIT_LOW,
+    BEEPER_BAT_LOW,
+    BEEPER_GPS_STATUS,
+    BEEPER_RX_SET,
+    BEEPER_ACC_CALIBRATION,
+    BEEPER_ACC_CALIBRATION_FAIL,
+    BEEPER_READY_BEEP,
+    BEEPER_MULTI_BEEPS,
+    BEEPER_DISARM_REPEAT,
+    BEEPER_ARMED,
+    BEEPER_SYSTEM_INIT,
+    BEEPER_USB,
+    BEEPER_BLACKBOX_ERASE,
+    BEEPER_CRASH_FLIP_MODE,
+    BEEPER_CAM_CONNECTION_OPEN,
+    BEEPER_CAM_CONNECTION_CLOSE,
+    BEEPER_RC_SMOOTHING_INIT_FAIL,
+    BEEPER_ARMING_GPS_NO_FIX,
+    BEEPER_ALL,
+
+} beeperMode_e;
+# 96 "./src/main/io/beeper.h"
+void beeper(beeperMode_e mode);
+void beeperSilence(void);
+void beeperUpdate(timeUs_t currentTimeUs);
+void beeperConfirmationBeeps(uint8_t beepCount);
+void beeperWarningBeeps(uint8_t beepCount);
+uint32_t getArmingBeepTimeMicros(void);
+beeperMode_e beeperModeForTableIndex(int idx);
+uint32_t beeperModeMaskForTableIndex(int idx);
+const char *beeperNameForTableIndex(int idx);
+int beeperTableEntryCount(void);
+
+# 106 "./src/main/io/beeper.h" 3 4
+_Bool 
+# 106 "./src/main/io/beeper.h"
+    isBeeperOn(void);
+timeUs_t getLastDshotBeaconCommandTimeUs(void);
+# 58 "./src/main/cli/settings.c" 2
+# 1 "./src/main/io/dashboard.h" 1
+# 21 "./src/main/io/dashboard.h"
+       
+# 39 "./src/main/io/dashboard.h"
+typedef enum {
+    PAGE_WELCOME,
+    PAGE_ARMED,
+    PAGE_BATTERY,
+    PAGE_SENSORS,
+    PAGE_RX,
+    PAGE_PROFILE,
+    PAGE_RPROF,
+
+    PAGE_TASKS,
+
+
+
+
+
+    PAGE_DEBUG,
+
+
+    PAGE_COUNT
+} pageId_e;
+
+void dashboardInit(void);
+void dashboardUpdate(timeUs_t currentTimeUs);
+
+void dashboardShowFixedPage(pageId_e pageId);
+
+void dashboardEnablePageCycling(void);
+void dashboardDisablePageCycling(void);
+void dashboardResetPageCycling(void);
+void dashboardSetNextPageChangeAt(timeUs_t futureMicros);
+# 59 "./src/main/cli/settings.c" 2
+# 1 "./src/main/io/gimbal.h" 1
+# 21 "./src/main/io/gimbal.h"
+       
+
+
+
+typedef enum {
+    GIMBAL_MODE_NORMAL = 0,
+    GIMBAL_MODE_MIXTILT = 1
+} gimbalMode_e;
+
+
+
+typedef struct gimbalConfig_s {
+    uint8_t mode;
+} gimbalConfig_t;
+
+extern gimbalConfig_t gimbalConfig_System; extern gimbalConfig_t gimbalConfig_Copy; static inline const gimbalConfig_t* gimbalConfig(void) { return &gimbalConfig_System; } static inline gimbalConfig_t* gimbalConfigMutable(void) { return &gimbalConfig_System; } struct _dummy;
+# 60 "./src/main/cli/settings.c" 2
+# 1 "./src/main/io/gps.h" 1
+# 21 "./src/main/io/gps.h"
+       
+# 35 "./src/main/io/gps.h"
+typedef enum {
+    GPS_NMEA = 0,
+    GPS_UBLOX,
+    GPS_MSP
+} gpsProvider_e;
+
+typedef enum {
+    SBAS_AUTO = 0,
+    SBAS_EGNOS,
+    SBAS_WAAS,
+    SBAS_MSAS,
+    SBAS_GAGAN
+} sbasMode_e;
+
+
+
+typedef enum {
+    GPS_BAUDRATE_115200 = 0,
+    GPS_BAUDRATE_57600,
+    GPS_BAUDRATE_38400,
+    GPS_BAUDRATE_19200,
+    GPS_BAUDRATE_9600,
+    GPS_BAUDRATE_230400
+} gpsBaudRate_e;
+
+typedef enum {
+    GPS_AUTOCONFIG_OFF = 0,
+    GPS_AUTOCONFIG_ON
+} gpsAutoConfig_e;
+
+typedef enum {
+    GPS_AUTOBAUD_OFF = 0,
+    GPS_AUTOBAUD_ON
+} gpsAutoBaud_e;
+
+
+
+
+
+
+typedef struct gpsConfig_s {
+    gpsProvider_e provider;
+    sbasMode_e sbasMode;
+    gpsAutoConfig_e autoConfig;
+    gpsAutoBaud_e autoBaud;
+    uint8_t gps_ublox_use_galileo;
+    uint8_t gps_set_home_point_once;
+    uint8_t gps_ublox_use_pvt;
+    uint8_t gps_update_rate_hz;
+} gpsConfig_t;
+
+extern gpsConfig_t gpsConfig_System; extern gpsConfig_t gpsConfig_Copy; static inline const gpsConfig_t* gpsConfig(void) { return &gpsConfig_System; } static inline gpsConfig_t* gpsConfigMutable(void) { return &gpsConfig_System; } struct _dummy;
+
+typedef struct gpsCoordinateDDDMMmmmm_s {
+    int16_t dddmm;
+    int16_t mmmm;
+} gpsCoordinateDDDMMmmmm_t;
+
+
+typedef struct gpsLocation_s {
+    int32_t lat;
+    int32_t lon;
+    int32_t altCm;
+} gpsLocation_t;
+
+typedef struct gpsSolutionData_s {
+    gpsLocation_t llh;
+    uint16_t groundSpeed;
+    uint16_t groundCourse;
+    uint16_t hdop;
+    uint8_t numSat;
+} gpsSolutionData_t;
+
+typedef enum {
+    GPS_MESSAGE_STATE_IDLE = 0,
+    GPS_MESSAGE_STATE_INIT,
+    GPS_MESSAGE_STATE_SBAS,
+    GPS_MESSAGE_STATE_GALILEO,
+    GPS_MESSAGE_STATE_PVT,
+    GPS_MESSAGE_STATE_RATE,
+    GPS_MESSAGE_STATE_ENTRY_COUNT
+} gpsMessageState_e;
+
+typedef struct gpsData_s {
+    uint32_t errors;
+    uint32_t timeouts;
+    uint32_t lastMessage;
+    uint32_t lastLastMessage;
+
+    uint32_t state_position;
+    uint32_t state_ts;
+    uint8_t state;
+    uint8_t baudrateIndex;
+    gpsMessageState_e messageState;
+} gpsData_t;
+
+
+extern char gpsPacketLog[21];
+
+extern int32_t GPS_home[2];
+extern uint16_t GPS_distanceToHome;
+extern int16_t GPS_directionToHome;
+extern uint32_t GPS_distanceFlownInCm;
+extern int16_t GPS_verticalSpeedInCmS;
+extern int16_t GPS_angle[2];
+extern float dTnav;
+extern float GPS_scaleLonDown;
+extern int16_t nav_takeoff_bearing;
+
+typedef enum {
+    NAV_MODE_NONE = 0,
+    NAV_MODE_POSHOLD,
+    NAV_MODE_WP
+} navigationMode_e;
+extern navigationMode_e nav_mode;
+
+typedef enum {
+    GPS_DIRECT_TICK = 1 << 0,
+    GPS_MSP_UPDATE = 1 << 1
+} gpsUpdateToggle_e;
+
+extern gpsData_t gpsData;
+extern gpsSolutionData_t gpsSol;
+
+extern uint8_t GPS_update;
+extern uint32_t GPS_packetCount;
+extern uint32_t GPS_svInfoReceivedCount;
+extern uint8_t GPS_numCh;
+extern uint8_t GPS_svinfo_chn[16];
+extern uint8_t GPS_svinfo_svid[16];
+extern uint8_t GPS_svinfo_quality[16];
+extern uint8_t GPS_svinfo_cno[16];
+
+
+
+
+void gpsInit(void);
+void gpsUpdate(timeUs_t currentTimeUs);
+
+# 173 "./src/main/io/gps.h" 3 4
+_Bool 
+# 173 "./src/main/io/gps.h"
+    gpsNewFrame(uint8_t c);
+
+# 174 "./src/main/io/gps.h" 3 4
+_Bool 
+# 174 "./src/main/io/gps.h"
+    gpsIsHealthy(void);
+struct serialPort_s;
+void gpsEnablePassthrough(struct serialPort_s *gpsPassthroughPort);
+void onGpsNewData(void);
+void GPS_reset_home_position(void);
+void GPS_calc_longitude_scaling(int32_t lat);
+void GPS_distance_cm_bearing(int32_t *currentLat1, int32_t *currentLon1, int32_t *destinationLat2, int32_t *destinationLon2, uint32_t *dist, int32_t *bearing);
+# 61 "./src/main/cli/settings.c" 2
+# 1 "./src/main/io/ledstrip.h" 1
+# 21 "./src/main/io/ledstrip.h"
+       
+
+# 1 "./src/main/common/color.h" 1
+# 21 "./src/main/common/color.h"
+       
+
+
+typedef enum {
+    RGB_RED = 0,
+    RGB_GREEN,
+    RGB_BLUE
+} colorComponent_e;
+
+
+
+struct rgbColor24bpp_s {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+};
+
+typedef union {
+    struct rgbColor24bpp_s rgb;
+    uint8_t raw[(RGB_BLUE + 1)];
+} rgbColor24bpp_t;
+
+
+
+
+
+typedef enum {
+    HSV_HUE = 0,
+    HSV_SATURATION,
+    HSV_VALUE
+} hsvColorComponent_e;
+
+
+
+typedef struct hsvColor_s {
+    uint16_t h;
+    uint8_t s;
+    uint8_t v;
+} hsvColor_t;
+# 24 "./src/main/io/ledstrip.h" 2
+
+
+
+# 1 "./src/main/drivers/light_ws2811strip.h" 1
+# 21 "./src/main/drivers/light_ws2811strip.h"
+       
+# 48 "./src/main/drivers/light_ws2811strip.h"
+typedef enum {
+    LED_GRB,
+    LED_RGB
+} ledStripFormatRGB_e;
+
+void ws2811LedStripInit(ioTag_t ioTag);
+void ws2811LedStripEnable(void);
+
+
+# 56 "./src/main/drivers/light_ws2811strip.h" 3 4
+_Bool 
+# 56 "./src/main/drivers/light_ws2811strip.h"
+    ws2811LedStripHardwareInit(ioTag_t ioTag);
+void ws2811LedStripDMAEnable(void);
+
+void ws2811UpdateStrip(ledStripFormatRGB_e ledFormat);
+
+void setLedHsv(uint16_t index, const hsvColor_t *color);
+void getLedHsv(uint16_t index, hsvColor_t *color);
+
+void scaleLedValue(uint16_t index, const uint8_t scalePercent);
+void setLedValue(uint16_t index, const uint8_t value);
+
+void setStripColor(const hsvColor_t *color);
+void setStripColors(const hsvColor_t *colors);
+
+
+# 70 "./src/main/drivers/light_ws2811strip.h" 3 4
+_Bool 
+# 70 "./src/main/drivers/light_ws2811strip.h"
+    isWS2811LedStripReady(void);
+
+
+
+
+extern uint32_t ledStripDMABuffer[(32 * 24 + 42)];
+
+extern volatile 
+# 77 "./src/main/drivers/light_ws2811strip.h" 3 4
+               _Bool 
+# 77 "./src/main/drivers/light_ws2811strip.h"
+                    ws2811LedDataTransferInProgress;
+
+extern uint16_t BIT_COMPARE_1;
+extern uint16_t BIT_COMPARE_0;
+# 28 "./src/main/io/ledstrip.h" 2
+# 80 "./src/main/io/ledstrip.h"
+typedef enum {
+    COLOR_BLACK = 0,
+    COLOR_WHITE,
+    COLOR_RED,
+    COLOR_ORANGE,
+    COLOR_YELLOW,
+    COLOR_LIME_GREEN,
+    COLOR_GREEN,
+    COLOR_MINT_GREEN,
+    COLOR_CYAN,
+    COLOR_LIGHT_BLUE,
+    COLOR_BLUE,
+    COLOR_DARK_VIOLET,
+    COLOR_MAGENTA,
+    COLOR_DEEP_PINK,
+    COLOR_COUNT
+} colorId_e;
+
+typedef enum {
+    LED_MODE_ORIENTATION = 0,
+    LED_MODE_HEADFREE,
+    LED_MODE_HORIZON,
+    LED_MODE_ANGLE,
+    LED_MODE_MAG,
+    LED_MODE_BARO,
+    LED_SPECIAL,
+    LED_AUX_CHANNEL
+} ledModeIndex_e;
+
+typedef enum {
+    LED_SCOLOR_DISARMED = 0,
+    LED_SCOLOR_ARMED,
+    LED_SCOLOR_ANIMATION,
+    LED_SCOLOR_BACKGROUND,
+    LED_SCOLOR_BLINKBACKGROUND,
+    LED_SCOLOR_GPSNOSATS,
+    LED_SCOLOR_GPSNOLOCK,
+    LED_SCOLOR_GPSLOCKED
+} ledSpecialColorIds_e;
+
+typedef enum {
+    LED_DIRECTION_NORTH = 0,
+    LED_DIRECTION_EAST,
+    LED_DIRECTION_SOUTH,
+    LED_DIRECTION_WEST,
+    LED_DIRECTION_UP,
+    LED_DIRECTION_DOWN
+} ledDirectionId_e;
+
+typedef enum {
+    LED_FUNCTION_COLOR,
+    LED_FUNCTION_FLIGHT_MODE,
+    LED_FUNCTION_ARM_STATE,
+    LED_FUNCTION_BATTERY,
+    LED_FUNCTION_RSSI,
+    LED_FUNCTION_GPS,
+    LED_FUNCTION_THRUST_RING,
+    LED_FUNCTION_WING_PHASE
+} ledBaseFunctionId_e;
+
+typedef enum {
+    LED_OVERLAY_THROTTLE,
+    LED_OVERLAY_LARSON_SCANNER,
+    LED_OVERLAY_BLINK,
+    LED_OVERLAY_VTX,
+    LED_OVERLAY_INDICATOR,
+    LED_OVERLAY_WARNING
+} ledOverlayId_e;
+
+typedef enum {
+    LED_PROFILE_RACE = 0,
+    LED_PROFILE_BEACON,
+
+
+
+    LED_PROFILE_COUNT
+} ledProfile_e;
+
+typedef struct modeColorIndexes_s {
+    uint8_t color[6];
+} modeColorIndexes_t;
+
+typedef struct specialColorIndexes_s {
+    uint8_t color[11];
+} specialColorIndexes_t;
+
+typedef uint32_t ledConfig_t;
+
+typedef struct ledCounts_s {
+    uint8_t count;
+    uint8_t ring;
+    uint8_t larson;
+    uint8_t ringSeqLen;
+} ledCounts_t;
+
+typedef struct ledStripConfig_s {
+    uint8_t ledstrip_visual_beeper;
+    ioTag_t ioTag;
+    ledStripFormatRGB_e ledstrip_grb_rgb;
+    ledProfile_e ledstrip_profile;
+    colorId_e ledstrip_race_color;
+    colorId_e ledstrip_beacon_color;
+    uint16_t ledstrip_beacon_period_ms;
+    uint8_t ledstrip_beacon_percent;
+    uint8_t ledstrip_beacon_armed_only;
+    colorId_e ledstrip_visual_beeper_color;
+} ledStripConfig_t;
+
+extern ledStripConfig_t ledStripConfig_System; extern ledStripConfig_t ledStripConfig_Copy; static inline const ledStripConfig_t* ledStripConfig(void) { return &ledStripConfig_System; } static inline ledStripConfig_t* ledStripConfigMutable(void) { return &ledStripConfig_System; } struct _dummy;
+# 207 "./src/main/io/ledstrip.h"
+static inline uint8_t ledGetXY(const ledConfig_t *lcfg) { return ((*lcfg >> 0) & ((1 << (8)) - 1)); }
+static inline uint8_t ledGetX(const ledConfig_t *lcfg) { return ((*lcfg >> (0 + 4)) & 0x0F); }
+static inline uint8_t ledGetY(const ledConfig_t *lcfg) { return ((*lcfg >> (0 + 0)) & 0x0F); }
+static inline uint8_t ledGetFunction(const ledConfig_t *lcfg) { return ((*lcfg >> 8) & ((1 << (4)) - 1)); }
+static inline uint8_t ledGetOverlay(const ledConfig_t *lcfg) { return ((*lcfg >> 12) & ((1 << (6)) - 1)); }
+static inline uint8_t ledGetColor(const ledConfig_t *lcfg) { return ((*lcfg >> 18) & ((1 << (4)) - 1)); }
+static inline uint8_t ledGetDirection(const ledConfig_t *lcfg) { return ((*lcfg >> 22) & ((1 << (6)) - 1)); }
+static inline uint8_t ledGetParams(const ledConfig_t *lcfg) { return ((*lcfg >> 28) & ((1 << (4)) - 1)); }
+
+static inline 
+# 216 "./src/main/io/ledstrip.h" 3 4
+             _Bool 
+# 216 "./src/main/io/ledstrip.h"
+                  ledGetOverlayBit(const ledConfig_t *lcfg, int id) { return ((ledGetOverlay(lcfg) >> id) & 1); }
+static inline 
+# 217 "./src/main/io/ledstrip.h" 3 4
+             _Bool 
+# 217 "./src/main/io/ledstrip.h"
+                  ledGetDirectionBit(const ledConfig_t *lcfg, int id) { return ((ledGetDirection(lcfg) >> id) & 1); }
+
+
+# 219 "./src/main/io/ledstrip.h" 3 4
+_Bool 
+# 219 "./src/main/io/ledstrip.h"
+    parseColor(int index, const char *colorConfig);
+
+
+# 221 "./src/main/io/ledstrip.h" 3 4
+_Bool 
+# 221 "./src/main/io/ledstrip.h"
+    parseLedStripConfig(int ledIndex, const char *config);
+void generateLedConfig(ledConfig_t *ledConfig, char *ledConfigBuffer, size_t bufferSize);
+void reevaluateLedConfig(void);
+
+void ledStripInit(void);
+void ledStripEnable(void);
+void ledStripDisable(void);
+void ledStripUpdate(timeUs_t currentTimeUs);
+
+
+# 230 "./src/main/io/ledstrip.h" 3 4
+_Bool 
+# 230 "./src/main/io/ledstrip.h"
+    setModeColor(ledModeIndex_e modeIndex, int modeColorIndex, int colorIndex);
+
+void applyDefaultLedStripConfig(ledConfig_t *ledConfig);
+void applyDefaultColors(hsvColor_t *colors);
+void applyDefaultModeColors(modeColorIndexes_t *modeColors);
+void applyDefaultSpecialColors(specialColorIndexes_t *specialColors);
+
+void updateRequiredOverlay(void);
+
+uint8_t getLedProfile(void);
+void setLedProfile(uint8_t profile);
+# 62 "./src/main/cli/settings.c" 2
+# 1 "./src/main/io/vtx.h" 1
+# 21 "./src/main/io/vtx.h"
+       
+
+
+
+
+
+
+
+typedef enum {
+     VTX_LOW_POWER_DISARM_OFF = 0,
+     VTX_LOW_POWER_DISARM_ALWAYS,
+     VTX_LOW_POWER_DISARM_UNTIL_FIRST_ARM,
+} vtxLowerPowerDisarm_e;
+
+typedef struct vtxSettingsConfig_s {
+    uint8_t band;
+    uint8_t channel;
+    uint8_t power;
+    uint16_t freq;
+    uint16_t pitModeFreq;
+    uint8_t lowPowerDisarm;
+} vtxSettingsConfig_t;
+
+extern vtxSettingsConfig_t vtxSettingsConfig_System; extern vtxSettingsConfig_t vtxSettingsConfig_Copy; static inline const vtxSettingsConfig_t* vtxSettingsConfig(void) { return &vtxSettingsConfig_System; } static inline vtxSettingsConfig_t* vtxSettingsConfigMutable(void) { return &vtxSettingsConfig_System; } struct _dummy;
+
+void vtxInit(void);
+void vtxUpdate(timeUs_t currentTimeUs);
+# 63 "./src/main/cli/settings.c" 2
+# 1 "./src/main/io/vtx_control.h" 1
+# 21 "./src/main/io/vtx_control.h"
+       
+# 33 "./src/main/io/vtx_control.h"
+typedef struct vtxChannelActivationCondition_s {
+    uint8_t auxChannelIndex;
+    uint8_t band;
+    uint8_t channel;
+    channelRange_t range;
+} vtxChannelActivationCondition_t;
+
+typedef struct vtxConfig_s {
+    vtxChannelActivationCondition_t vtxChannelActivationConditions[10];
+    uint8_t halfDuplex;
+} vtxConfig_t;
+
+extern vtxConfig_t vtxConfig_System; extern vtxConfig_t vtxConfig_Copy; static inline const vtxConfig_t* vtxConfig(void) { return &vtxConfig_System; } static inline vtxConfig_t* vtxConfigMutable(void) { return &vtxConfig_System; } struct _dummy;
+
+void vtxControlInit(void);
+void vtxControlInputPoll(void);
+
+void vtxIncrementBand(void);
+void vtxDecrementBand(void);
+void vtxIncrementChannel(void);
+void vtxDecrementChannel(void);
+
+void vtxCyclePower(const uint8_t powerStep);
+void vtxCycleBandOrChannel(const uint8_t bandStep, const uint8_t channelStep);
+
+void vtxUpdateActivatedChannel(void);
+
+void handleVTXControlButton(void);
+# 64 "./src/main/cli/settings.c" 2
+# 1 "./src/main/io/vtx_rtc6705.h" 1
+# 21 "./src/main/io/vtx_rtc6705.h"
+       
+
+
+
+
+
+
+
+# 28 "./src/main/io/vtx_rtc6705.h" 3 4
+_Bool 
+# 28 "./src/main/io/vtx_rtc6705.h"
+    vtxRTC6705CanUpdate(void);
+
+# 29 "./src/main/io/vtx_rtc6705.h" 3 4
+_Bool 
+# 29 "./src/main/io/vtx_rtc6705.h"
+    vtxRTC6705Init(void);
+# 65 "./src/main/cli/settings.c" 2
+
+# 1 "./src/main/osd/osd.h" 1
+# 21 "./src/main/osd/osd.h"
+       
+
+
+
+
+
+# 1 "./src/main/sensors/esc_sensor.h" 1
+# 21 "./src/main/sensors/esc_sensor.h"
+       
+
+
+
+typedef struct escSensorConfig_s {
+    uint8_t halfDuplex;
+    uint16_t offset;
+
+} escSensorConfig_t;
+
+extern escSensorConfig_t escSensorConfig_System; extern escSensorConfig_t escSensorConfig_Copy; static inline const escSensorConfig_t* escSensorConfig(void) { return &escSensorConfig_System; } static inline escSensorConfig_t* escSensorConfigMutable(void) { return &escSensorConfig_System; } struct _dummy;
+
+typedef struct {
+    uint8_t dataAge;
+    int8_t temperature;
+    int16_t voltage;
+    int32_t current;
+    int32_t consumption;
+    int16_t rpm;
+} escSensorData_t;
+
+
+
+
+
+
+# 46 "./src/main/sensors/esc_sensor.h" 3 4
+_Bool 
+# 46 "./src/main/sensors/esc_sensor.h"
+    escSensorInit(void);
+void escSensorProcess(timeUs_t currentTime);
+
+
+
+escSensorData_t *getEscSensorData(uint8_t motorNumber);
+
+void startEscDataRead(uint8_t *frameBuffer, uint8_t frameLength);
+uint8_t getNumberEscBytesRead(void);
+
+uint8_t calculateCrc8(const uint8_t *Buf, const uint8_t BufLen);
+
+int calcEscRpm(int erpm);
+# 28 "./src/main/osd/osd.h" 2
+
+
+extern const char * const osdTimerSourceNames[3];
+# 76 "./src/main/osd/osd.h"
+typedef enum {
+    OSD_RSSI_VALUE,
+    OSD_MAIN_BATT_VOLTAGE,
+    OSD_CROSSHAIRS,
+    OSD_ARTIFICIAL_HORIZON,
+    OSD_HORIZON_SIDEBARS,
+    OSD_ITEM_TIMER_1,
+    OSD_ITEM_TIMER_2,
+    OSD_FLYMODE,
+    OSD_CRAFT_NAME,
+    OSD_THROTTLE_POS,
+    OSD_VTX_CHANNEL,
+    OSD_CURRENT_DRAW,
+    OSD_MAH_DRAWN,
+    OSD_GPS_SPEED,
+    OSD_GPS_SATS,
+    OSD_ALTITUDE,
+    OSD_ROLL_PIDS,
+    OSD_PITCH_PIDS,
+    OSD_YAW_PIDS,
+    OSD_POWER,
+    OSD_PIDRATE_PROFILE,
+    OSD_WARNINGS,
+    OSD_AVG_CELL_VOLTAGE,
+    OSD_GPS_LON,
+    OSD_GPS_LAT,
+    OSD_DEBUG,
+    OSD_PITCH_ANGLE,
+    OSD_ROLL_ANGLE,
+    OSD_MAIN_BATT_USAGE,
+    OSD_DISARMED,
+    OSD_HOME_DIR,
+    OSD_HOME_DIST,
+    OSD_NUMERICAL_HEADING,
+    OSD_NUMERICAL_VARIO,
+    OSD_COMPASS_BAR,
+    OSD_ESC_TMP,
+    OSD_ESC_RPM,
+    OSD_REMAINING_TIME_ESTIMATE,
+    OSD_RTC_DATETIME,
+    OSD_ADJUSTMENT_RANGE,
+    OSD_CORE_TEMPERATURE,
+    OSD_ANTI_GRAVITY,
+    OSD_G_FORCE,
+    OSD_MOTOR_DIAG,
+    OSD_LOG_STATUS,
+    OSD_FLIP_ARROW,
+    OSD_LINK_QUALITY,
+    OSD_FLIGHT_DIST,
+    OSD_STICK_OVERLAY_LEFT,
+    OSD_STICK_OVERLAY_RIGHT,
+    OSD_DISPLAY_NAME,
+    OSD_ESC_RPM_FREQ,
+    OSD_WING_SATURATION,
+    OSD_ITEM_COUNT
+} osd_items_e;
+# 142 "./src/main/osd/osd.h"
+typedef enum {
+    OSD_STAT_RTC_DATE_TIME,
+    OSD_STAT_TIMER_1,
+    OSD_STAT_TIMER_2,
+    OSD_STAT_MAX_SPEED,
+    OSD_STAT_MAX_DISTANCE,
+    OSD_STAT_MIN_BATTERY,
+    OSD_STAT_END_BATTERY,
+    OSD_STAT_BATTERY,
+    OSD_STAT_MIN_RSSI,
+    OSD_STAT_MAX_CURRENT,
+    OSD_STAT_USED_MAH,
+    OSD_STAT_MAX_ALTITUDE,
+    OSD_STAT_BLACKBOX,
+    OSD_STAT_BLACKBOX_NUMBER,
+    OSD_STAT_MAX_G_FORCE,
+    OSD_STAT_MAX_ESC_TEMP,
+    OSD_STAT_MAX_ESC_RPM,
+    OSD_STAT_MIN_LINK_QUALITY,
+    OSD_STAT_FLIGHT_DISTANCE,
+    OSD_STAT_MAX_FFT,
+    OSD_STAT_COUNT
+} osd_stats_e;
+
+
+_Static_assert((OSD_STAT_COUNT <= 32), "osdstats_overflow");
+
+typedef enum {
+    OSD_UNIT_IMPERIAL,
+    OSD_UNIT_METRIC
+} osd_unit_e;
+
+typedef enum {
+    OSD_TIMER_1,
+    OSD_TIMER_2,
+    OSD_TIMER_COUNT
+} osd_timer_e;
+
+typedef enum {
+    OSD_TIMER_SRC_ON,
+    OSD_TIMER_SRC_TOTAL_ARMED,
+    OSD_TIMER_SRC_LAST_ARMED,
+    OSD_TIMER_SRC_COUNT
+} osd_timer_source_e;
+
+typedef enum {
+    OSD_TIMER_PREC_SECOND,
+    OSD_TIMER_PREC_HUNDREDTHS,
+    OSD_TIMER_PREC_COUNT
+} osd_timer_precision_e;
+
+typedef enum {
+    OSD_WARNING_ARMING_DISABLE,
+    OSD_WARNING_BATTERY_NOT_FULL,
+    OSD_WARNING_BATTERY_WARNING,
+    OSD_WARNING_BATTERY_CRITICAL,
+    OSD_WARNING_VISUAL_BEEPER,
+    OSD_WARNING_CRASH_FLIP,
+    OSD_WARNING_ESC_FAIL,
+    OSD_WARNING_CORE_TEMPERATURE,
+    OSD_WARNING_RC_SMOOTHING,
+    OSD_WARNING_FAIL_SAFE,
+    OSD_WARNING_LAUNCH_CONTROL,
+    OSD_WARNING_GPS_RESCUE_UNAVAILABLE,
+    OSD_WARNING_GPS_RESCUE_DISABLED,
+    OSD_WARNING_COUNT
+} osdWarningsFlags_e;
+
+
+_Static_assert((OSD_WARNING_COUNT <= 32), "osdwarnings_overflow");
+
+
+
+
+
+
+
+extern const uint16_t osdTimerDefault[OSD_TIMER_COUNT];
+
+typedef struct osdConfig_s {
+    uint16_t item_pos[OSD_ITEM_COUNT];
+
+
+    uint16_t cap_alarm;
+    uint16_t alt_alarm;
+    uint8_t rssi_alarm;
+
+    osd_unit_e units;
+
+    uint16_t timers[OSD_TIMER_COUNT];
+    uint32_t enabledWarnings;
+
+    uint8_t ahMaxPitch;
+    uint8_t ahMaxRoll;
+    uint32_t enabled_stats;
+    int8_t esc_temp_alarm;
+    int16_t esc_rpm_alarm;
+    int16_t esc_current_alarm;
+    uint8_t core_temp_alarm;
+    uint8_t ahInvert;
+    uint8_t osdProfileIndex;
+    uint8_t overlay_radio_mode;
+} osdConfig_t;
+
+extern osdConfig_t osdConfig_System; extern osdConfig_t osdConfig_Copy; static inline const osdConfig_t* osdConfig(void) { return &osdConfig_System; } static inline osdConfig_t* osdConfigMutable(void) { return &osdConfig_System; } struct _dummy;
+
+typedef struct statistic_s {
+    timeUs_t armed_time;
+    int16_t max_speed;
+    int16_t min_voltage;
+    int16_t max_current;
+    uint8_t min_rssi;
+    int32_t max_altitude;
+    int16_t max_distance;
+    float max_g_force;
+    int16_t max_esc_temp;
+    int32_t max_esc_rpm;
+    uint8_t min_link_quality;
+} statistic_t;
+
+extern timeUs_t resumeRefreshAt;
+extern timeUs_t osdFlyTime;
+
+extern float osdGForce;
+
+
+
+
+
+
+struct displayPort_s;
+void osdInit(struct displayPort_s *osdDisplayPort);
+
+# 274 "./src/main/osd/osd.h" 3 4
+_Bool 
+# 274 "./src/main/osd/osd.h"
+    osdInitialized(void);
+void osdUpdate(timeUs_t currentTimeUs);
+void osdStatSetState(uint8_t statIndex, 
+# 276 "./src/main/osd/osd.h" 3 4
+                                       _Bool 
+# 276 "./src/main/osd/osd.h"
+                                            enabled);
+
+# 277 "./src/main/osd/osd.h" 3 4
+_Bool 
+# 277 "./src/main/osd/osd.h"
+    osdStatGetState(uint8_t statIndex);
+void osdWarnSetState(uint8_t warningIndex, 
+# 278 "./src/main/osd/osd.h" 3 4
+                                          _Bool 
+# 278 "./src/main/osd/osd.h"
+                                               enabled);
+
+# 279 "./src/main/osd/osd.h" 3 4
+_Bool 
+# 279 "./src/main/osd/osd.h"
+    osdWarnGetState(uint8_t warningIndex);
+void osdSuppressStats(
+# 280 "./src/main/osd/osd.h" 3 4
+                     _Bool 
+# 280 "./src/main/osd/osd.h"
+                          flag);
+
+uint8_t getCurrentOsdProfileIndex(void);
+void changeOsdProfileIndex(uint8_t profileIndex);
+
+# 284 "./src/main/osd/osd.h" 3 4
+_Bool 
+# 284 "./src/main/osd/osd.h"
+    osdElementVisible(uint16_t value);
+
+# 285 "./src/main/osd/osd.h" 3 4
+_Bool 
+# 285 "./src/main/osd/osd.h"
+    osdGetVisualBeeperState(void);
+statistic_t *osdGetStats(void);
+# 67 "./src/main/cli/settings.c" 2
+
+# 1 "./src/main/pg/adc.h" 1
+# 21 "./src/main/pg/adc.h"
+       
+
+
+
+
+
+
+
+typedef struct adcChannelConfig_t {
+    
+# 30 "./src/main/pg/adc.h" 3 4
+   _Bool 
+# 30 "./src/main/pg/adc.h"
+        enabled;
+    ioTag_t ioTag;
+} adcChannelConfig_t;
+
+typedef struct adcConfig_s {
+    adcChannelConfig_t vbat;
+    adcChannelConfig_t rssi;
+    adcChannelConfig_t current;
+    adcChannelConfig_t external1;
+    int8_t device;
+
+    uint16_t vrefIntCalibration;
+    uint16_t tempSensorCalibration1;
+    uint16_t tempSensorCalibration2;
+
+    uint8_t dmaopt[3];
+} adcConfig_t;
+
+extern adcConfig_t adcConfig_System; extern adcConfig_t adcConfig_Copy; static inline const adcConfig_t* adcConfig(void) { return &adcConfig_System; } static inline adcConfig_t* adcConfigMutable(void) { return &adcConfig_System; } struct _dummy;
+# 69 "./src/main/cli/settings.c" 2
+# 1 "./src/main/pg/beeper.h" 1
+# 21 "./src/main/pg/beeper.h"
+       
+
+
+
+
+typedef struct beeperConfig_s {
+    uint32_t beeper_off_flags;
+    uint8_t dshotBeaconTone;
+    uint32_t dshotBeaconOffFlags;
+} beeperConfig_t;
+
+extern beeperConfig_t beeperConfig_System; extern beeperConfig_t beeperConfig_Copy; static inline const beeperConfig_t* beeperConfig(void) { return &beeperConfig_System; } static inline beeperConfig_t* beeperConfigMutable(void) { return &beeperConfig_System; } struct _dummy;
+# 70 "./src/main/cli/settings.c" 2
+# 1 "./src/main/pg/beeper_dev.h" 1
+# 21 "./src/main/pg/beeper_dev.h"
+       
+
+
+
+
+
+
+typedef struct beeperDevConfig_s {
+    ioTag_t ioTag;
+    uint8_t isInverted;
+    uint8_t isOpenDrain;
+    uint16_t frequency;
+} beeperDevConfig_t;
+
+extern beeperDevConfig_t beeperDevConfig_System; extern beeperDevConfig_t beeperDevConfig_Copy; static inline const beeperDevConfig_t* beeperDevConfig(void) { return &beeperDevConfig_System; } static inline beeperDevConfig_t* beeperDevConfigMutable(void) { return &beeperDevConfig_System; } struct _dummy;
+# 71 "./src/main/cli/settings.c" 2
+# 1 "./src/main/pg/bus_i2c.h" 1
+# 21 "./src/main/pg/bus_i2c.h"
+       
+
+
+
+
+
+
+
+typedef struct i2cConfig_s {
+    ioTag_t ioTagScl;
+    ioTag_t ioTagSda;
+    
+# 32 "./src/main/pg/bus_i2c.h" 3 4
+   _Bool 
+# 32 "./src/main/pg/bus_i2c.h"
+        overClock;
+    
+# 33 "./src/main/pg/bus_i2c.h" 3 4
+   _Bool 
+# 33 "./src/main/pg/bus_i2c.h"
+        pullUp;
+} i2cConfig_t;
+
+extern i2cConfig_t i2cConfig_SystemArray[4]; extern i2cConfig_t i2cConfig_CopyArray[4]; static inline const i2cConfig_t* i2cConfig(int _index) { return &i2cConfig_SystemArray[_index]; } static inline i2cConfig_t* i2cConfigMutable(int _index) { return &i2cConfig_SystemArray[_index]; } static inline i2cConfig_t (* i2cConfig_array(void))[4] { return &i2cConfig_SystemArray; } struct _dummy;
+# 72 "./src/main/cli/settings.c" 2
+# 1 "./src/main/pg/dashboard.h" 1
+# 21 "./src/main/pg/dashboard.h"
+typedef struct dashboardConfig_s {
+    I2CDevice device;
+    uint8_t address;
+} dashboardConfig_t;
+
+extern dashboardConfig_t dashboardConfig_System; extern dashboardConfig_t dashboardConfig_Copy; static inline const dashboardConfig_t* dashboardConfig(void) { return &dashboardConfig_System; } static inline dashboardConfig_t* dashboardConfigMutable(void) { return &dashboardConfig_System; } struct _dummy;
+# 73 "./src/main/cli/settings.c" 2
+# 1 "./src/main/pg/flash.h" 1
+# 21 "./src/main/pg/flash.h"
+       
+
+
+
+
+
+
+
+typedef struct flashConfig_s {
+    ioTag_t csTag;
+    uint8_t spiDevice;
+} flashConfig_t;
+
+extern flashConfig_t flashConfig_System; extern flashConfig_t flashConfig_Copy; static inline const flashConfig_t* flashConfig(void) { return &flashConfig_System; } static inline flashConfig_t* flashConfigMutable(void) { return &flashConfig_System; } struct _dummy;
+# 74 "./src/main/cli/settings.c" 2
+# 1 "./src/main/pg/gyrodev.h" 1
+# 21 "./src/main/pg/gyrodev.h"
+       
+
+
+
+
+
+
+
+typedef struct gyroDeviceConfig_s {
+    int8_t index;
+    uint8_t bustype;
+    uint8_t spiBus;
+    ioTag_t csnTag;
+    uint8_t i2cBus;
+    uint8_t i2cAddress;
+    ioTag_t extiTag;
+    uint8_t align;
+} gyroDeviceConfig_t;
+
+extern gyroDeviceConfig_t gyroDeviceConfig_SystemArray[1]; extern gyroDeviceConfig_t gyroDeviceConfig_CopyArray[1]; static inline const gyroDeviceConfig_t* gyroDeviceConfig(int _index) { return &gyroDeviceConfig_SystemArray[_index]; } static inline gyroDeviceConfig_t* gyroDeviceConfigMutable(int _index) { return &gyroDeviceConfig_SystemArray[_index]; } static inline gyroDeviceConfig_t (* gyroDeviceConfig_array(void))[1] { return &gyroDeviceConfig_SystemArray; } struct _dummy;
+# 75 "./src/main/cli/settings.c" 2
+# 1 "./src/main/pg/max7456.h" 1
+# 21 "./src/main/pg/max7456.h"
+       
+
+
+
+
+typedef struct max7456Config_s {
+    uint8_t clockConfig;
+    ioTag_t csTag;
+    uint8_t spiDevice;
+    
+# 30 "./src/main/pg/max7456.h" 3 4
+   _Bool 
+# 30 "./src/main/pg/max7456.h"
+        preInitOPU;
+} max7456Config_t;
+
+
+
+
+
+
+extern max7456Config_t max7456Config_System; extern max7456Config_t max7456Config_Copy; static inline const max7456Config_t* max7456Config(void) { return &max7456Config_System; } static inline max7456Config_t* max7456ConfigMutable(void) { return &max7456Config_System; } struct _dummy;
+# 76 "./src/main/cli/settings.c" 2
+# 1 "./src/main/pg/mco.h" 1
+# 21 "./src/main/pg/mco.h"
+       
+
+
+
+
+
+
+
+typedef struct mcoConfig_s {
+    uint8_t enabled[2];
+} mcoConfig_t;
+
+extern mcoConfig_t mcoConfig_System; extern mcoConfig_t mcoConfig_Copy; static inline const mcoConfig_t* mcoConfig(void) { return &mcoConfig_System; } static inline mcoConfig_t* mcoConfigMutable(void) { return &mcoConfig_System; } struct _dummy;
+# 77 "./src/main/cli/settings.c" 2
+
+
+# 1 "./src/main/pg/pinio.h" 1
+# 21 "./src/main/pg/pinio.h"
+       
+
+
+
+
+
+typedef struct pinioConfig_s {
+    ioTag_t ioTag[4];
+    uint8_t config[4];
+} pinioConfig_t;
+
+extern pinioConfig_t pinioConfig_System; extern pinioConfig_t pinioConfig_Copy; static inline const pinioConfig_t* pinioConfig(void) { return &pinioConfig_System; } static inline pinioConfig_t* pinioConfigMutable(void) { return &pinioConfig_System; } struct _dummy;
+# 80 "./src/main/cli/settings.c" 2
+# 1 "./src/main/pg/piniobox.h" 1
+# 21 "./src/main/pg/piniobox.h"
+       
+
+
+
+
+
+typedef struct pinioBoxConfig_s {
+    uint8_t permanentId[4];
+} pinioBoxConfig_t;
+
+extern pinioBoxConfig_t pinioBoxConfig_System; extern pinioBoxConfig_t pinioBoxConfig_Copy; static inline const pinioBoxConfig_t* pinioBoxConfig(void) { return &pinioBoxConfig_System; } static inline pinioBoxConfig_t* pinioBoxConfigMutable(void) { return &pinioBoxConfig_System; } struct _dummy;
+# 81 "./src/main/cli/settings.c" 2
+# 1 "./src/main/pg/rx.h" 1
+# 21 "./src/main/pg/rx.h"
+       
+
+
+
+
+
+typedef struct rxConfig_s {
+    uint8_t rcmap[8];
+    uint8_t serialrx_provider;
+    uint8_t serialrx_inverted;
+    uint8_t halfDuplex;
+    ioTag_t spektrum_bind_pin_override_ioTag;
+    ioTag_t spektrum_bind_plug_ioTag;
+    uint8_t spektrum_sat_bind;
+    uint8_t spektrum_sat_bind_autoreset;
+    uint8_t rssi_channel;
+    uint8_t rssi_scale;
+    uint8_t rssi_invert;
+    uint16_t midrc;
+    uint16_t mincheck;
+    uint16_t maxcheck;
+    uint8_t rcInterpolation;
+    uint8_t rcInterpolationChannels;
+    uint8_t rcInterpolationInterval;
+    uint8_t fpvCamAngleDegrees;
+    uint8_t airModeActivateThreshold;
+
+    uint16_t rx_min_usec;
+    uint16_t rx_max_usec;
+    uint8_t max_aux_channel;
+    uint8_t rssi_src_frame_errors;
+    int8_t rssi_offset;
+    uint8_t rc_smoothing_type;
+    uint8_t rc_smoothing_input_cutoff;
+    uint8_t rc_smoothing_derivative_cutoff;
+    uint8_t rc_smoothing_debug_axis;
+    uint8_t rc_smoothing_input_type;
+    uint8_t rc_smoothing_derivative_type;
+    uint8_t rc_smoothing_auto_factor;
+} rxConfig_t;
+
+extern rxConfig_t rxConfig_System; extern rxConfig_t rxConfig_Copy; static inline const rxConfig_t* rxConfig(void) { return &rxConfig_System; } static inline rxConfig_t* rxConfigMutable(void) { return &rxConfig_System; } struct _dummy;
+# 82 "./src/main/cli/settings.c" 2
+# 1 "./src/main/pg/rx_pwm.h" 1
+# 21 "./src/main/pg/rx_pwm.h"
+       
+
+
+# 1 "./src/main/drivers/rx/rx_pwm.h" 1
+# 21 "./src/main/drivers/rx/rx_pwm.h"
+       
+
+typedef enum {
+    INPUT_FILTERING_DISABLED = 0,
+    INPUT_FILTERING_ENABLED
+} inputFilteringMode_e;
+
+
+
+
+struct ppmConfig_s;
+void ppmRxInit(const struct ppmConfig_s *ppmConfig);
+struct pwmConfig_s;
+void pwmRxInit(const struct pwmConfig_s *pwmConfig);
+
+uint16_t pwmRead(uint8_t channel);
+uint16_t ppmRead(uint8_t channel);
+
+
+# 39 "./src/main/drivers/rx/rx_pwm.h" 3 4
+_Bool 
+# 39 "./src/main/drivers/rx/rx_pwm.h"
+    isPPMDataBeingReceived(void);
+void resetPPMDataReceivedState(void);
+
+
+# 42 "./src/main/drivers/rx/rx_pwm.h" 3 4
+_Bool 
+# 42 "./src/main/drivers/rx/rx_pwm.h"
+    isPWMDataBeingReceived(void);
+# 25 "./src/main/pg/rx_pwm.h" 2
+
+
+
+typedef struct ppmConfig_s {
+    ioTag_t ioTag;
+} ppmConfig_t;
+
+extern ppmConfig_t ppmConfig_System; extern ppmConfig_t ppmConfig_Copy; static inline const ppmConfig_t* ppmConfig(void) { return &ppmConfig_System; } static inline ppmConfig_t* ppmConfigMutable(void) { return &ppmConfig_System; } struct _dummy;
+
+typedef struct pwmConfig_s {
+    ioTag_t ioTags[8];
+    inputFilteringMode_e inputFilteringMode;
+} pwmConfig_t;
+
+extern pwmConfig_t pwmConfig_System; extern pwmConfig_t pwmConfig_Copy; static inline const pwmConfig_t* pwmConfig(void) { return &pwmConfig_System; } static inline pwmConfig_t* pwmConfigMutable(void) { return &pwmConfig_System; } struct _dummy;
+# 83 "./src/main/cli/settings.c" 2
+# 1 "./src/main/pg/rx_spi.h" 1
+# 21 "./src/main/pg/rx_spi.h"
+       
+
+
+
+
+
+typedef struct rxSpiConfig_s {
+
+    uint8_t rx_spi_protocol;
+
+    uint32_t rx_spi_id;
+    uint8_t rx_spi_rf_channel_count;
+
+
+    ioTag_t csnTag;
+    uint8_t spibus;
+
+    ioTag_t bindIoTag;
+    ioTag_t ledIoTag;
+    uint8_t ledInversion;
+
+    ioTag_t extiIoTag;
+} rxSpiConfig_t;
+
+extern rxSpiConfig_t rxSpiConfig_System; extern rxSpiConfig_t rxSpiConfig_Copy; static inline const rxSpiConfig_t* rxSpiConfig(void) { return &rxSpiConfig_System; } static inline rxSpiConfig_t* rxSpiConfigMutable(void) { return &rxSpiConfig_System; } struct _dummy;
+# 84 "./src/main/cli/settings.c" 2
+# 1 "./src/main/pg/rx_spi_cc2500.h" 1
+# 21 "./src/main/pg/rx_spi_cc2500.h"
+       
+
+
+
+
+
+typedef enum {
+  FRSKY_SPI_A1_SOURCE_VBAT = 0,
+  FRSKY_SPI_A1_SOURCE_EXTADC,
+  FRSKY_SPI_A1_SOURCE_CONST
+} frSkySpiA1Source_e;
+
+typedef struct rxCc2500SpiConfig_s {
+    uint8_t autoBind;
+    uint8_t bindTxId[2];
+    int8_t bindOffset;
+    uint8_t bindHopData[50];
+    uint8_t rxNum;
+    uint8_t a1Source;
+    uint8_t chipDetectEnabled;
+    ioTag_t txEnIoTag;
+    ioTag_t lnaEnIoTag;
+    ioTag_t antSelIoTag;
+} rxCc2500SpiConfig_t;
+
+extern rxCc2500SpiConfig_t rxCc2500SpiConfig_System; extern rxCc2500SpiConfig_t rxCc2500SpiConfig_Copy; static inline const rxCc2500SpiConfig_t* rxCc2500SpiConfig(void) { return &rxCc2500SpiConfig_System; } static inline rxCc2500SpiConfig_t* rxCc2500SpiConfigMutable(void) { return &rxCc2500SpiConfig_System; } struct _dummy;
+# 85 "./src/main/cli/settings.c" 2
+# 1 "./src/main/pg/sdcard.h" 1
+# 21 "./src/main/pg/sdcard.h"
+       
+
+
+
+
+typedef enum {
+    SDCARD_MODE_NONE = 0,
+    SDCARD_MODE_SPI,
+    SDCARD_MODE_SDIO
+} sdcardMode_e;
+
+typedef struct sdcardConfig_s {
+    uint8_t useDma;
+    int8_t device;
+    ioTag_t cardDetectTag;
+    ioTag_t chipSelectTag;
+    uint8_t cardDetectInverted;
+
+    uint8_t dmaIdentifier;
+    uint8_t dmaChannel;
+
+    sdcardMode_e mode;
+} sdcardConfig_t;
+
+extern sdcardConfig_t sdcardConfig_System; extern sdcardConfig_t sdcardConfig_Copy; static inline const sdcardConfig_t* sdcardConfig(void) { return &sdcardConfig_System; } static inline sdcardConfig_t* sdcardConfigMutable(void) { return &sdcardConfig_System; } struct _dummy;
+# 86 "./src/main/cli/settings.c" 2
+# 1 "./src/main/pg/vcd.h" 1
+# 21 "./src/main/pg/vcd.h"
+       
+
+
+
+
+
+enum VIDEO_SYSTEMS {
+    VIDEO_SYSTEM_AUTO = 0,
+    VIDEO_SYSTEM_PAL,
+    VIDEO_SYSTEM_NTSC
+};
+
+typedef struct vcdProfile_s {
+    uint8_t video_system;
+    int8_t h_offset;
+    int8_t v_offset;
+} vcdProfile_t;
+
+extern vcdProfile_t vcdProfile_System; extern vcdProfile_t vcdProfile_Copy; static inline const vcdProfile_t* vcdProfile(void) { return &vcdProfile_System; } static inline vcdProfile_t* vcdProfileMutable(void) { return &vcdProfile_System; } struct _dummy;
+# 87 "./src/main/cli/settings.c" 2
+# 1 "./src/main/pg/usb.h" 1
+# 21 "./src/main/pg/usb.h"
+       
+
+
+
+
+
+enum USB_DEV {
+    DEFAULT,
+    COMPOSITE
+};
+
+typedef struct usbDev_s {
+    uint8_t type;
+    ioTag_t mscButtonPin;
+    uint8_t mscButtonUsePullup;
+    ioTag_t detectPin;
+} usbDev_t;
+
+extern usbDev_t usbDevConfig_System; extern usbDev_t usbDevConfig_Copy; static inline const usbDev_t* usbDevConfig(void) { return &usbDevConfig_System; } static inline usbDev_t* usbDevConfigMutable(void) { return &usbDevConfig_System; } struct _dummy;
+# 88 "./src/main/cli/settings.c" 2
+# 1 "./src/main/pg/sdio.h" 1
+# 21 "./src/main/pg/sdio.h"
+       
+
+
+
+typedef struct sdioConfig_s {
+    uint8_t clockBypass;
+    uint8_t useCache;
+    uint8_t use4BitWidth;
+    int8_t dmaopt;
+} sdioConfig_t;
+
+extern sdioConfig_t sdioConfig_System; extern sdioConfig_t sdioConfig_Copy; static inline const sdioConfig_t* sdioConfig(void) { return &sdioConfig_System; } static inline sdioConfig_t* sdioConfigMutable(void) { return &sdioConfig_System; } struct _dummy;
+# 89 "./src/main/cli/settings.c" 2
+# 1 "./src/main/pg/rcdevice.h" 1
+# 21 "./src/main/pg/rcdevice.h"
+       
+
+
+
+
+typedef struct rcdeviceConfig_s {
+    uint8_t initDeviceAttempts;
+    timeMs_t initDeviceAttemptInterval;
+
+
+    uint32_t feature;
+    uint8_t protocolVersion;
+} rcdeviceConfig_t;
+
+extern rcdeviceConfig_t rcdeviceConfig_System; extern rcdeviceConfig_t rcdeviceConfig_Copy; static inline const rcdeviceConfig_t* rcdeviceConfig(void) { return &rcdeviceConfig_System; } static inline rcdeviceConfig_t* rcdeviceConfigMutable(void) { return &rcdeviceConfig_System; } struct _dummy;
+# 90 "./src/main/cli/settings.c" 2
+
+# 1 "./src/main/rx/rx.h" 1
+# 21 "./src/main/rx/rx.h"
+       
+# 47 "./src/main/rx/rx.h"
+typedef enum {
+    RX_FRAME_PENDING = 0,
+    RX_FRAME_COMPLETE = (1 << 0),
+    RX_FRAME_FAILSAFE = (1 << 1),
+    RX_FRAME_PROCESSING_REQUIRED = (1 << 2),
+    RX_FRAME_DROPPED = (1 << 3)
+} rxFrameState_e;
+
+typedef enum {
+    SERIALRX_SPEKTRUM1024 = 0,
+    SERIALRX_SPEKTRUM2048 = 1,
+    SERIALRX_SBUS = 2,
+    SERIALRX_SUMD = 3,
+    SERIALRX_SUMH = 4,
+    SERIALRX_XBUS_MODE_B = 5,
+    SERIALRX_XBUS_MODE_B_RJ01 = 6,
+    SERIALRX_IBUS = 7,
+    SERIALRX_JETIEXBUS = 8,
+    SERIALRX_CRSF = 9,
+    SERIALRX_SRXL = 10,
+    SERIALRX_TARGET_CUSTOM = 11,
+    SERIALRX_FPORT = 12,
+} SerialRXType;
+# 84 "./src/main/rx/rx.h"
+extern const char rcChannelLetters[];
+
+extern int16_t rcData[18];
+
+
+
+
+
+
+typedef enum {
+    RX_FAILSAFE_MODE_AUTO = 0,
+    RX_FAILSAFE_MODE_HOLD,
+    RX_FAILSAFE_MODE_SET,
+    RX_FAILSAFE_MODE_INVALID
+} rxFailsafeChannelMode_e;
+
+
+
+typedef enum {
+    RX_FAILSAFE_TYPE_FLIGHT = 0,
+    RX_FAILSAFE_TYPE_AUX
+} rxFailsafeChannelType_e;
+
+
+
+typedef struct rxFailsafeChannelConfig_s {
+    uint8_t mode;
+    uint8_t step;
+} rxFailsafeChannelConfig_t;
+
+extern rxFailsafeChannelConfig_t rxFailsafeChannelConfigs_SystemArray[18]; extern rxFailsafeChannelConfig_t rxFailsafeChannelConfigs_CopyArray[18]; static inline const rxFailsafeChannelConfig_t* rxFailsafeChannelConfigs(int _index) { return &rxFailsafeChannelConfigs_SystemArray[_index]; } static inline rxFailsafeChannelConfig_t* rxFailsafeChannelConfigsMutable(int _index) { return &rxFailsafeChannelConfigs_SystemArray[_index]; } static inline rxFailsafeChannelConfig_t (* rxFailsafeChannelConfigs_array(void))[18] { return &rxFailsafeChannelConfigs_SystemArray; } struct _dummy;
+
+typedef struct rxChannelRangeConfig_s {
+    uint16_t min;
+    uint16_t max;
+} rxChannelRangeConfig_t;
+
+extern rxChannelRangeConfig_t rxChannelRangeConfigs_SystemArray[4]; extern rxChannelRangeConfig_t rxChannelRangeConfigs_CopyArray[4]; static inline const rxChannelRangeConfig_t* rxChannelRangeConfigs(int _index) { return &rxChannelRangeConfigs_SystemArray[_index]; } static inline rxChannelRangeConfig_t* rxChannelRangeConfigsMutable(int _index) { return &rxChannelRangeConfigs_SystemArray[_index]; } static inline rxChannelRangeConfig_t (* rxChannelRangeConfigs_array(void))[4] { return &rxChannelRangeConfigs_SystemArray; } struct _dummy;
+
+struct rxRuntimeConfig_s;
+typedef uint16_t (*rcReadRawDataFnPtr)(const struct rxRuntimeConfig_s *rxRuntimeConfig, uint8_t chan);
+typedef uint8_t (*rcFrameStatusFnPtr)(struct rxRuntimeConfig_s *rxRuntimeConfig);
+typedef 
+# 126 "./src/main/rx/rx.h" 3 4
+       _Bool 
+# 126 "./src/main/rx/rx.h"
+            (*rcProcessFrameFnPtr)(const struct rxRuntimeConfig_s *rxRuntimeConfig);
+typedef timeUs_t (*rcGetFrameTimeUsFnPtr)(const struct rxRuntimeConfig_s *rxRuntimeConfig);
+
+typedef struct rxRuntimeConfig_s {
+    uint8_t channelCount;
+    uint16_t rxRefreshRate;
+    rcReadRawDataFnPtr rcReadRawFn;
+    rcFrameStatusFnPtr rcFrameStatusFn;
+    rcProcessFrameFnPtr rcProcessFrameFn;
+    rcGetFrameTimeUsFnPtr rcFrameTimeUsFn;
+    uint16_t *channelData;
+    void *frameData;
+} rxRuntimeConfig_t;
+
+typedef enum {
+    RSSI_SOURCE_NONE = 0,
+    RSSI_SOURCE_ADC,
+    RSSI_SOURCE_RX_CHANNEL,
+    RSSI_SOURCE_RX_PROTOCOL,
+    RSSI_SOURCE_MSP,
+    RSSI_SOURCE_FRAME_ERRORS,
+} rssiSource_e;
+
+extern rssiSource_e rssiSource;
+
+
+
+typedef struct rxTimingStats_s {
+    uint32_t frameCount;
+    uint16_t averageFrameIntervalUs;
+    uint16_t maxLatencyUs;
+    uint16_t maxJitterUs;
+    uint16_t latency[8];
+    uint16_t jitter[8];
+} rxTimingStats_t;
+
+extern rxRuntimeConfig_t rxRuntimeConfig;
+
+void rxInit(void);
+
+# 165 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 165 "./src/main/rx/rx.h"
+    rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTimeUs);
+
+# 166 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 166 "./src/main/rx/rx.h"
+    rxIsReceivingSignal(void);
+
+# 167 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 167 "./src/main/rx/rx.h"
+    rxAreFlightChannelsValid(void);
+
+# 168 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 168 "./src/main/rx/rx.h"
+    calculateRxChannelsAndUpdateFailsafe(timeUs_t currentTimeUs);
+timeDelta_t rxGetFrameDelta(void);
+const rxTimingStats_t *rxGetTimingStats(void);
+
+struct rxConfig_s;
+
+void parseRcChannels(const char *input, struct rxConfig_s *rxConfig);
+
+
+
+void setRssiDirect(uint16_t newRssi, rssiSource_e source);
+void setRssi(uint16_t rssiValue, rssiSource_e source);
+void setRssiMsp(uint8_t newMspRssi);
+void updateRSSI(timeUs_t currentTimeUs);
+uint16_t getRssi(void);
+uint8_t getRssiPercent(void);
+
+# 184 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 184 "./src/main/rx/rx.h"
+    isRssiConfigured(void);
+
+
+
+uint8_t rxGetLinkQuality(void);
+uint8_t rxGetLinkQualityPercent(void);
+
+void resetAllRxChannelRangeConfigurations(rxChannelRangeConfig_t *rxChannelRangeConfig);
+
+void suspendRxPwmPpmSignal(void);
+void resumeRxPwmPpmSignal(void);
+
+uint16_t rxGetRefreshRate(void);
+# 92 "./src/main/cli/settings.c" 2
+# 1 "./src/main/rx/cc2500_frsky_common.h" 1
+# 21 "./src/main/rx/cc2500_frsky_common.h"
+       
+
+# 1 "./src/main/rx/rx_spi.h" 1
+# 21 "./src/main/rx/rx_spi.h"
+       
+
+
+
+
+
+
+typedef enum {
+    RX_SPI_NRF24_V202_250K = 0,
+    RX_SPI_NRF24_V202_1M,
+    RX_SPI_NRF24_SYMA_X,
+    RX_SPI_NRF24_SYMA_X5C,
+    RX_SPI_NRF24_CX10,
+    RX_SPI_NRF24_CX10A,
+    RX_SPI_NRF24_H8_3D,
+    RX_SPI_NRF24_INAV,
+    RX_SPI_FRSKY_D,
+    RX_SPI_FRSKY_X,
+    RX_SPI_A7105_FLYSKY,
+    RX_SPI_A7105_FLYSKY_2A,
+    RX_SPI_NRF24_KN,
+    RX_SPI_SFHSS,
+    RX_SPI_CYRF6936_DSM,
+    RX_SPI_FRSKY_X_LBT,
+    RX_SPI_PROTOCOL_COUNT
+} rx_spi_protocol_e;
+
+typedef enum {
+    RX_SPI_RECEIVED_NONE = 0,
+    RX_SPI_RECEIVED_BIND = (1 << 0),
+    RX_SPI_RECEIVED_DATA = (1 << 1),
+    RX_SPI_ROCESSING_REQUIRED = (1 << 2),
+} rx_spi_received_e;
+
+
+typedef enum {
+    RC_SPI_ROLL = 0,
+    RC_SPI_PITCH,
+    RC_SPI_THROTTLE,
+    RC_SPI_YAW,
+    RC_SPI_AUX1,
+    RC_SPI_AUX2,
+    RC_SPI_AUX3,
+    RC_SPI_AUX4,
+    RC_SPI_AUX5,
+    RC_SPI_AUX6,
+    RC_SPI_AUX7,
+    RC_SPI_AUX8,
+    RC_SPI_AUX9,
+    RC_SPI_AUX10,
+    RC_SPI_AUX11,
+    RC_SPI_AUX12,
+    RC_SPI_AUX13,
+    RC_SPI_AUX14
+} rc_spi_aetr_e;
+# 85 "./src/main/rx/rx_spi.h"
+
+# 85 "./src/main/rx/rx_spi.h" 3 4
+_Bool 
+# 85 "./src/main/rx/rx_spi.h"
+    rxSpiInit(const rxSpiConfig_t *rxSpiConfig, rxRuntimeConfig_t *rxRuntimeConfig);
+# 24 "./src/main/rx/cc2500_frsky_common.h" 2
+
+
+# 25 "./src/main/rx/cc2500_frsky_common.h" 3 4
+_Bool 
+# 25 "./src/main/rx/cc2500_frsky_common.h"
+    frSkySpiInit(const rxSpiConfig_t *rxSpiConfig, rxRuntimeConfig_t *rxRuntimeConfig);
+rx_spi_received_e frSkySpiDataReceived(uint8_t *packet);
+rx_spi_received_e frSkySpiProcessFrame(uint8_t *packet);
+void frSkySpiSetRcData(uint16_t *rcData, const uint8_t *payload);
+# 93 "./src/main/cli/settings.c" 2
+# 1 "./src/main/rx/cc2500_sfhss.h" 1
+# 21 "./src/main/rx/cc2500_sfhss.h"
+       
+# 44 "./src/main/rx/cc2500_sfhss.h"
+typedef struct rxSfhssSpiConfig_s {
+    uint8_t bindTxId[2];
+    int8_t bindOffset;
+} rxSfhssSpiConfig_t;
+
+extern rxSfhssSpiConfig_t rxSfhssSpiConfig_System; extern rxSfhssSpiConfig_t rxSfhssSpiConfig_Copy; static inline const rxSfhssSpiConfig_t* rxSfhssSpiConfig(void) { return &rxSfhssSpiConfig_System; } static inline rxSfhssSpiConfig_t* rxSfhssSpiConfigMutable(void) { return &rxSfhssSpiConfig_System; } struct _dummy;
+
+
+# 51 "./src/main/rx/cc2500_sfhss.h" 3 4
+_Bool 
+# 51 "./src/main/rx/cc2500_sfhss.h"
+    sfhssSpiInit(const rxSpiConfig_t *rxSpiConfig, rxRuntimeConfig_t *rxRuntimeConfig);
+rx_spi_received_e sfhssSpiDataReceived(uint8_t *packet);
+void sfhssSpiSetRcData(uint16_t *rcData, const uint8_t *payload);
+
+void sfhssSpiBind(void);
+# 94 "./src/main/cli/settings.c" 2
+# 1 "./src/main/rx/spektrum.h" 1
+# 21 "./src/main/rx/spektrum.h"
+       
+# 45 "./src/main/rx/spektrum.h"
+extern uint32_t spekChannelData[12];
+
+extern 
+# 47 "./src/main/rx/spektrum.h" 3 4
+      _Bool 
+# 47 "./src/main/rx/spektrum.h"
+           srxlEnabled;
+extern int32_t resolution;
+extern uint8_t rssi_channel;
+
+void spektrumBind(rxConfig_t *rxConfig);
+
+# 52 "./src/main/rx/spektrum.h" 3 4
+_Bool 
+# 52 "./src/main/rx/spektrum.h"
+    spektrumInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig);
+
+
+# 54 "./src/main/rx/spektrum.h" 3 4
+_Bool 
+# 54 "./src/main/rx/spektrum.h"
+    srxlTelemetryBufferEmpty();
+void srxlRxWriteTelemetryData(const void *data, int len);
+
+# 56 "./src/main/rx/spektrum.h" 3 4
+_Bool 
+# 56 "./src/main/rx/spektrum.h"
+    srxlRxIsActive(void);
+# 95 "./src/main/cli/settings.c" 2
+# 1 "./src/main/rx/cyrf6936_spektrum.h" 1
+# 21 "./src/main/rx/cyrf6936_spektrum.h"
+       
+# 43 "./src/main/rx/cyrf6936_spektrum.h"
+typedef struct spektrumConfig_s {
+    uint8_t protocol;
+    uint8_t mfgId[4];
+    uint8_t numChannels;
+} spektrumConfig_t;
+
+extern spektrumConfig_t spektrumConfig_System; extern spektrumConfig_t spektrumConfig_Copy; static inline const spektrumConfig_t* spektrumConfig(void) { return &spektrumConfig_System; } static inline spektrumConfig_t* spektrumConfigMutable(void) { return &spektrumConfig_System; } struct _dummy;
+
+
+# 51 "./src/main/rx/cyrf6936_spektrum.h" 3 4
+_Bool 
+# 51 "./src/main/rx/cyrf6936_spektrum.h"
+    spektrumSpiInit(const struct rxSpiConfig_s *rxConfig, struct rxRuntimeConfig_s *rxRuntimeConfig);
+void spektrumSpiSetRcDataFromPayload(uint16_t *rcData, const uint8_t *payload);
+rx_spi_received_e spektrumSpiDataReceived(uint8_t *payload);
+# 96 "./src/main/cli/settings.c" 2
+# 1 "./src/main/rx/a7105_flysky.h" 1
+# 21 "./src/main/rx/a7105_flysky.h"
+       
+
+
+
+
+typedef struct flySkyConfig_s {
+    uint32_t txId;
+    uint8_t rfChannelMap[16];
+} flySkyConfig_t;
+
+extern flySkyConfig_t flySkyConfig_System; extern flySkyConfig_t flySkyConfig_Copy; static inline const flySkyConfig_t* flySkyConfig(void) { return &flySkyConfig_System; } static inline flySkyConfig_t* flySkyConfigMutable(void) { return &flySkyConfig_System; } struct _dummy;
+
+struct rxSpiConfig_s;
+struct rxRuntimeConfig_s;
+
+# 35 "./src/main/rx/a7105_flysky.h" 3 4
+_Bool 
+# 35 "./src/main/rx/a7105_flysky.h"
+    flySkyInit(const struct rxSpiConfig_s *rxConfig, struct rxRuntimeConfig_s *rxRuntimeConfig);
+void flySkySetRcDataFromPayload(uint16_t *rcData, const uint8_t *payload);
+rx_spi_received_e flySkyDataReceived(uint8_t *payload);
+# 97 "./src/main/cli/settings.c" 2
+
+# 1 "./src/main/sensors/acceleration.h" 1
+# 21 "./src/main/sensors/acceleration.h"
+       
+
+
+
+# 1 "./src/main/drivers/accgyro/accgyro.h" 1
+# 21 "./src/main/drivers/accgyro/accgyro.h"
+       
+
+
+
+
+# 1 "./src/main/drivers/exti.h" 1
+# 21 "./src/main/drivers/exti.h"
+       
+
+
+
+
+
+typedef enum {
+    EXTI_TRIGGER_RISING = 0,
+    EXTI_TRIGGER_FALLING = 1,
+    EXTI_TRIGGER_BOTH = 2
+} extiTrigger_t;
+
+typedef struct extiCallbackRec_s extiCallbackRec_t;
+typedef void extiHandlerCallback(extiCallbackRec_t *self);
+
+struct extiCallbackRec_s {
+    extiHandlerCallback *fn;
+};
+
+void EXTIInit(void);
+
+void EXTIHandlerInit(extiCallbackRec_t *cb, extiHandlerCallback *fn);
+void EXTIConfig(IO_t io, extiCallbackRec_t *cb, int irqPriority, ioConfig_t config, extiTrigger_t trigger);
+void EXTIRelease(IO_t io);
+void EXTIEnable(IO_t io, 
+# 45 "./src/main/drivers/exti.h" 3 4
+                        _Bool 
+# 45 "./src/main/drivers/exti.h"
+                             enable);
+# 27 "./src/main/drivers/accgyro/accgyro.h" 2
+
+# 1 "./src/main/drivers/sensor.h" 1
+# 21 "./src/main/drivers/sensor.h"
+       
+
+
+
+
+typedef enum {
+    ALIGN_DEFAULT = 0,
+    CW0_DEG = 1,
+    CW90_DEG = 2,
+    CW180_DEG = 3,
+    CW270_DEG = 4,
+    CW0_DEG_FLIP = 5,
+    CW90_DEG_FLIP = 6,
+    CW180_DEG_FLIP = 7,
+    CW270_DEG_FLIP = 8
+} sensor_align_e;
+
+typedef 
+# 38 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 38 "./src/main/drivers/sensor.h"
+            (*sensorInterruptFuncPtr)(void);
+struct magDev_s;
+typedef 
+# 40 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 40 "./src/main/drivers/sensor.h"
+            (*sensorMagInitFuncPtr)(struct magDev_s *magdev);
+typedef 
+# 41 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 41 "./src/main/drivers/sensor.h"
+            (*sensorMagReadFuncPtr)(struct magDev_s *magdev, int16_t *data);
+struct accDev_s;
+typedef void (*sensorAccInitFuncPtr)(struct accDev_s *acc);
+typedef 
+# 44 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 44 "./src/main/drivers/sensor.h"
+            (*sensorAccReadFuncPtr)(struct accDev_s *acc);
+struct gyroDev_s;
+typedef void (*sensorGyroInitFuncPtr)(struct gyroDev_s *gyro);
+typedef 
+# 47 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 47 "./src/main/drivers/sensor.h"
+            (*sensorGyroReadFuncPtr)(struct gyroDev_s *gyro);
+typedef 
+# 48 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 48 "./src/main/drivers/sensor.h"
+            (*sensorGyroReadDataFuncPtr)(struct gyroDev_s *gyro, int16_t *data);
+# 29 "./src/main/drivers/accgyro/accgyro.h" 2
+# 1 "./src/main/drivers/accgyro/accgyro_mpu.h" 1
+# 21 "./src/main/drivers/accgyro/accgyro_mpu.h"
+       
+# 143 "./src/main/drivers/accgyro/accgyro_mpu.h"
+enum gyro_fsr_e {
+    INV_FSR_250DPS = 0,
+    INV_FSR_500DPS,
+    INV_FSR_1000DPS,
+    INV_FSR_2000DPS,
+    NUM_GYRO_FSR
+};
+
+enum icm_high_range_gyro_fsr_e {
+    ICM_HIGH_RANGE_FSR_500DPS = 0,
+    ICM_HIGH_RANGE_FSR_1000DPS,
+    ICM_HIGH_RANGE_FSR_2000DPS,
+    ICM_HIGH_RANGE_FSR_4000DPS,
+    NUM_ICM_HIGH_RANGE_GYRO_FSR
+};
+
+enum clock_sel_e {
+    INV_CLK_INTERNAL = 0,
+    INV_CLK_PLL,
+    NUM_CLK
+};
+
+enum accel_fsr_e {
+    INV_FSR_2G = 0,
+    INV_FSR_4G,
+    INV_FSR_8G,
+    INV_FSR_16G,
+    NUM_ACCEL_FSR
+};
+
+enum icm_high_range_accel_fsr_e {
+    ICM_HIGH_RANGE_FSR_4G = 0,
+    ICM_HIGH_RANGE_FSR_8G,
+    ICM_HIGH_RANGE_FSR_16G,
+    ICM_HIGH_RANGE_FSR_32G,
+    NUM_ICM_HIGH_RANGE_ACCEL_FSR
+};
+
+typedef enum {
+    GYRO_OVERFLOW_NONE = 0x00,
+    GYRO_OVERFLOW_X = 0x01,
+    GYRO_OVERFLOW_Y = 0x02,
+    GYRO_OVERFLOW_Z = 0x04
+} gyroOverflow_e;
+
+typedef enum {
+    MPU_NONE,
+    MPU_3050,
+    MPU_60x0,
+    MPU_60x0_SPI,
+    MPU_65xx_I2C,
+    MPU_65xx_SPI,
+    MPU_9250_SPI,
+    ICM_20601_SPI,
+    ICM_20602_SPI,
+    ICM_20608_SPI,
+    ICM_20649_SPI,
+    ICM_20689_SPI,
+    BMI_160_SPI,
+    L3GD20_SPI,
+} mpuSensor_e;
+
+typedef enum {
+    MPU_HALF_RESOLUTION,
+    MPU_FULL_RESOLUTION
+} mpu6050Resolution_e;
+
+typedef struct mpuDetectionResult_s {
+    mpuSensor_e sensor;
+    mpu6050Resolution_e resolution;
+} mpuDetectionResult_t;
+
+struct gyroDev_s;
+struct gyroDeviceConfig_s;
+void mpuGyroInit(struct gyroDev_s *gyro);
+
+# 218 "./src/main/drivers/accgyro/accgyro_mpu.h" 3 4
+_Bool 
+# 218 "./src/main/drivers/accgyro/accgyro_mpu.h"
+    mpuGyroRead(struct gyroDev_s *gyro);
+
+# 219 "./src/main/drivers/accgyro/accgyro_mpu.h" 3 4
+_Bool 
+# 219 "./src/main/drivers/accgyro/accgyro_mpu.h"
+    mpuGyroReadSPI(struct gyroDev_s *gyro);
+void mpuPreInit(const struct gyroDeviceConfig_s *config);
+
+# 221 "./src/main/drivers/accgyro/accgyro_mpu.h" 3 4
+_Bool 
+# 221 "./src/main/drivers/accgyro/accgyro_mpu.h"
+    mpuDetect(struct gyroDev_s *gyro, const struct gyroDeviceConfig_s *config);
+uint8_t mpuGyroDLPF(struct gyroDev_s *gyro);
+uint8_t mpuGyroReadRegister(const busDevice_t *bus, uint8_t reg);
+
+struct accDev_s;
+
+# 226 "./src/main/drivers/accgyro/accgyro_mpu.h" 3 4
+_Bool 
+# 226 "./src/main/drivers/accgyro/accgyro_mpu.h"
+    mpuAccRead(struct accDev_s *acc);
+# 30 "./src/main/drivers/accgyro/accgyro.h" 2
+
+#pragma GCC diagnostic push
+
+# 1 "/usr/include/pthread.h" 1 3 4
+# 22 "/usr/include/pthread.h" 3 4
+# 1 "/usr/include/sched.h" 1 3 4
+# 29 "/usr/include/sched.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/sched.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 32 "/usr/include/sched.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 7 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 2 3 4
+
+
+
+
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 33 "/usr/include/sched.h" 2 3 4
+
+
+
+
+
+typedef __pid_t pid_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/sched.h" 1 3 4
+# 80 "/usr/include/x86_64-linux-gnu/bits/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 3 4
+struct sched_param
+{
+  int sched_priority;
+};
+# 81 "/usr/include/x86_64-linux-gnu/bits/sched.h" 2 3 4
+
+
+
+
+
+extern int clone (int (*__fn) (void *__arg), void *__child_stack,
+    int __flags, void *__arg, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int unshare (int __flags) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getcpu (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int getcpu (unsigned int *, unsigned int *) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setns (int __fd, int __nstype) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 44 "/usr/include/sched.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+typedef unsigned long int __cpu_mask;
+
+
+
+
+
+
+typedef struct
+{
+  __cpu_mask __bits[1024 / (8 * sizeof (__cpu_mask))];
+} cpu_set_t;
+# 115 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+
+
+extern int __sched_cpucount (size_t __setsize, const cpu_set_t *__setp)
+     __attribute__ ((__nothrow__ , __leaf__));
+extern cpu_set_t *__sched_cpualloc (size_t __count) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern void __sched_cpufree (cpu_set_t *__set) __attribute__ ((__nothrow__ , __leaf__));
+
+
+# 45 "/usr/include/sched.h" 2 3 4
+
+
+
+
+
+
+
+
+
+extern int sched_setparam (__pid_t __pid, const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getparam (__pid_t __pid, struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_setscheduler (__pid_t __pid, int __policy,
+          const struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getscheduler (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_yield (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_max (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_min (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int sched_rr_get_interval (__pid_t __pid, struct timespec *__t) __attribute__ ((__nothrow__ , __leaf__));
+# 130 "/usr/include/sched.h" 3 4
+extern int sched_setaffinity (__pid_t __pid, size_t __cpusetsize,
+         const cpu_set_t *__cpuset) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getaffinity (__pid_t __pid, size_t __cpusetsize,
+         cpu_set_t *__cpuset) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 23 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/time.h" 1 3 4
+# 29 "/usr/include/time.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/time.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/time.h" 1 3 4
+# 73 "/usr/include/x86_64-linux-gnu/bits/time.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/timex.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 23 "/usr/include/x86_64-linux-gnu/bits/timex.h" 2 3 4
+
+
+
+struct timex
+{
+# 58 "/usr/include/x86_64-linux-gnu/bits/timex.h" 3 4
+  unsigned int modes;
+  __syscall_slong_t offset;
+  __syscall_slong_t freq;
+  __syscall_slong_t maxerror;
+  __syscall_slong_t esterror;
+  int status;
+  __syscall_slong_t constant;
+  __syscall_slong_t precision;
+  __syscall_slong_t tolerance;
+  struct timeval time;
+  __syscall_slong_t tick;
+  __syscall_slong_t ppsfreq;
+  __syscall_slong_t jitter;
+  int shift;
+  __syscall_slong_t stabil;
+  __syscall_slong_t jitcnt;
+  __syscall_slong_t calcnt;
+  __syscall_slong_t errcnt;
+  __syscall_slong_t stbcnt;
+
+  int tai;
+
+
+  int :32; int :32; int :32; int :32;
+  int :32; int :32; int :32; int :32;
+  int :32; int :32; int :32;
+
+};
+# 74 "/usr/include/x86_64-linux-gnu/bits/time.h" 2 3 4
+
+
+
+
+extern int clock_adjtime (__clockid_t __clock_id, struct timex *__utx) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 90 "/usr/include/x86_64-linux-gnu/bits/time.h" 3 4
+
+# 34 "/usr/include/time.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 38 "/usr/include/time.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h" 1 3 4
+
+
+
+
+
+
+struct tm
+{
+  int tm_sec;
+  int tm_min;
+  int tm_hour;
+  int tm_mday;
+  int tm_mon;
+  int tm_year;
+  int tm_wday;
+  int tm_yday;
+  int tm_isdst;
+
+
+  long int tm_gmtoff;
+  const char *tm_zone;
+
+
+
+
+};
+# 40 "/usr/include/time.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 47 "/usr/include/time.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 48 "/usr/include/time.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h" 1 3 4
+
+
+
+
+
+
+
+struct itimerspec
+  {
+    struct timespec it_interval;
+    struct timespec it_value;
+  };
+# 49 "/usr/include/time.h" 2 3 4
+struct sigevent;
+# 68 "/usr/include/time.h" 3 4
+
+
+
+
+extern clock_t clock (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern time_t time (time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double difftime (time_t __time1, time_t __time0)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern time_t mktime (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 100 "/usr/include/time.h" 3 4
+extern size_t strftime (char *__restrict __s, size_t __maxsize,
+   const char *__restrict __format,
+   const struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern char *strptime (const char *__restrict __s,
+         const char *__restrict __fmt, struct tm *__tp)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern size_t strftime_l (char *__restrict __s, size_t __maxsize,
+     const char *__restrict __format,
+     const struct tm *__restrict __tp,
+     locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *strptime_l (const char *__restrict __s,
+    const char *__restrict __fmt, struct tm *__tp,
+    locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern struct tm *gmtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 154 "/usr/include/time.h" 3 4
+extern struct tm *gmtime_r (const time_t *__restrict __timer,
+       struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime_r (const time_t *__restrict __timer,
+          struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+# 179 "/usr/include/time.h" 3 4
+extern char *asctime (const struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 197 "/usr/include/time.h" 3 4
+extern char *asctime_r (const struct tm *__restrict __tp,
+   char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime_r (const time_t *__restrict __timer,
+        char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+# 217 "/usr/include/time.h" 3 4
+extern char *__tzname[2];
+extern int __daylight;
+extern long int __timezone;
+
+
+
+
+extern char *tzname[2];
+
+
+
+extern void tzset (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int daylight;
+extern long int timezone;
+# 246 "/usr/include/time.h" 3 4
+extern time_t timegm (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 263 "/usr/include/time.h" 3 4
+extern time_t timelocal (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int dysize (int __year) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+# 281 "/usr/include/time.h" 3 4
+extern int nanosleep (const struct timespec *__requested_time,
+        struct timespec *__remaining);
+
+
+extern int clock_getres (clockid_t __clock_id, struct timespec *__res) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int clock_gettime (clockid_t __clock_id, struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int clock_settime (clockid_t __clock_id, const struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 323 "/usr/include/time.h" 3 4
+extern int clock_nanosleep (clockid_t __clock_id, int __flags,
+       const struct timespec *__req,
+       struct timespec *__rem);
+# 338 "/usr/include/time.h" 3 4
+extern int clock_getcpuclockid (pid_t __pid, clockid_t *__clock_id) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int timer_create (clockid_t __clock_id,
+    struct sigevent *__restrict __evp,
+    timer_t *__restrict __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_delete (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int timer_settime (timer_t __timerid, int __flags,
+     const struct itimerspec *__restrict __value,
+     struct itimerspec *__restrict __ovalue) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_gettime (timer_t __timerid, struct itimerspec *__value)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 376 "/usr/include/time.h" 3 4
+extern int timer_getoverrun (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int timespec_get (struct timespec *__ts, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 399 "/usr/include/time.h" 3 4
+extern int timespec_getres (struct timespec *__ts, int __base)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 425 "/usr/include/time.h" 3 4
+extern int getdate_err;
+# 434 "/usr/include/time.h" 3 4
+extern struct tm *getdate (const char *__string);
+# 448 "/usr/include/time.h" 3 4
+extern int getdate_r (const char *__restrict __string,
+        struct tm *__restrict __resbufp);
+
+
+
+# 24 "/usr/include/pthread.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 27 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 2 3 4
+
+
+
+
+typedef long int __jmp_buf[8];
+# 28 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 29 "/usr/include/pthread.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 31 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 3 4
+struct __jmp_buf_tag
+  {
+
+
+
+
+    __jmp_buf __jmpbuf;
+    int __mask_was_saved;
+    __sigset_t __saved_mask;
+  };
+# 32 "/usr/include/pthread.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 3 4
+
+extern long int __sysconf (int __name) __attribute__ ((__nothrow__ , __leaf__));
+
+# 34 "/usr/include/pthread.h" 2 3 4
+
+
+
+enum
+{
+  PTHREAD_CREATE_JOINABLE,
+
+  PTHREAD_CREATE_DETACHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_ADAPTIVE_NP
+
+  ,
+  PTHREAD_MUTEX_NORMAL = PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE = PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK = PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_DEFAULT = PTHREAD_MUTEX_NORMAL
+
+
+
+  , PTHREAD_MUTEX_FAST_NP = PTHREAD_MUTEX_TIMED_NP
+
+};
+
+
+
+
+enum
+{
+  PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_STALLED_NP = PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_ROBUST,
+  PTHREAD_MUTEX_ROBUST_NP = PTHREAD_MUTEX_ROBUST
+};
+
+
+
+
+
+enum
+{
+  PTHREAD_PRIO_NONE,
+  PTHREAD_PRIO_INHERIT,
+  PTHREAD_PRIO_PROTECT
+};
+# 104 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_RWLOCK_PREFER_READER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP,
+  PTHREAD_RWLOCK_DEFAULT_NP = PTHREAD_RWLOCK_PREFER_READER_NP
+};
+# 124 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_INHERIT_SCHED,
+
+  PTHREAD_EXPLICIT_SCHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_SCOPE_SYSTEM,
+
+  PTHREAD_SCOPE_PROCESS
+
+};
+
+
+
+enum
+{
+  PTHREAD_PROCESS_PRIVATE,
+
+  PTHREAD_PROCESS_SHARED
+
+};
+# 159 "/usr/include/pthread.h" 3 4
+struct _pthread_cleanup_buffer
+{
+  void (*__routine) (void *);
+  void *__arg;
+  int __canceltype;
+  struct _pthread_cleanup_buffer *__prev;
+};
+
+
+enum
+{
+  PTHREAD_CANCEL_ENABLE,
+
+  PTHREAD_CANCEL_DISABLE
+
+};
+enum
+{
+  PTHREAD_CANCEL_DEFERRED,
+
+  PTHREAD_CANCEL_ASYNCHRONOUS
+
+};
+# 197 "/usr/include/pthread.h" 3 4
+
+
+
+
+
+extern int pthread_create (pthread_t *__restrict __newthread,
+      const pthread_attr_t *__restrict __attr,
+      void *(*__start_routine) (void *),
+      void *__restrict __arg) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+
+extern void pthread_exit (void *__retval) __attribute__ ((__noreturn__));
+
+
+
+
+
+
+
+extern int pthread_join (pthread_t __th, void **__thread_return);
+
+
+
+
+extern int pthread_tryjoin_np (pthread_t __th, void **__thread_return) __attribute__ ((__nothrow__ , __leaf__));
+# 233 "/usr/include/pthread.h" 3 4
+extern int pthread_timedjoin_np (pthread_t __th, void **__thread_return,
+     const struct timespec *__abstime);
+# 243 "/usr/include/pthread.h" 3 4
+extern int pthread_clockjoin_np (pthread_t __th, void **__thread_return,
+                                 clockid_t __clockid,
+     const struct timespec *__abstime);
+# 269 "/usr/include/pthread.h" 3 4
+extern int pthread_detach (pthread_t __th) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern pthread_t pthread_self (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern int pthread_equal (pthread_t __thread1, pthread_t __thread2)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+
+
+extern int pthread_attr_init (pthread_attr_t *__attr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_destroy (pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getdetachstate (const pthread_attr_t *__attr,
+     int *__detachstate)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setdetachstate (pthread_attr_t *__attr,
+     int __detachstate)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getguardsize (const pthread_attr_t *__attr,
+          size_t *__guardsize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setguardsize (pthread_attr_t *__attr,
+          size_t __guardsize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getschedparam (const pthread_attr_t *__restrict __attr,
+           struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedparam (pthread_attr_t *__restrict __attr,
+           const struct sched_param *__restrict
+           __param) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_getschedpolicy (const pthread_attr_t *__restrict
+     __attr, int *__restrict __policy)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedpolicy (pthread_attr_t *__attr, int __policy)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getinheritsched (const pthread_attr_t *__restrict
+      __attr, int *__restrict __inherit)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setinheritsched (pthread_attr_t *__attr,
+      int __inherit)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getscope (const pthread_attr_t *__restrict __attr,
+      int *__restrict __scope)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setscope (pthread_attr_t *__attr, int __scope)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getstackaddr (const pthread_attr_t *__restrict
+          __attr, void **__restrict __stackaddr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__deprecated__));
+
+
+
+
+
+extern int pthread_attr_setstackaddr (pthread_attr_t *__attr,
+          void *__stackaddr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__deprecated__));
+
+
+extern int pthread_attr_getstacksize (const pthread_attr_t *__restrict
+          __attr, size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_attr_setstacksize (pthread_attr_t *__attr,
+          size_t __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getstack (const pthread_attr_t *__restrict __attr,
+      void **__restrict __stackaddr,
+      size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+
+extern int pthread_attr_setstack (pthread_attr_t *__attr, void *__stackaddr,
+      size_t __stacksize) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int pthread_attr_setaffinity_np (pthread_attr_t *__attr,
+     size_t __cpusetsize,
+     const cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern int pthread_attr_getaffinity_np (const pthread_attr_t *__attr,
+     size_t __cpusetsize,
+     cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+extern int pthread_getattr_default_np (pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_setsigmask_np (pthread_attr_t *__attr,
+           const __sigset_t *sigmask);
+
+
+
+
+extern int pthread_attr_getsigmask_np (const pthread_attr_t *__attr,
+           __sigset_t *sigmask);
+
+
+
+
+
+
+
+extern int pthread_setattr_default_np (const pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_getattr_np (pthread_t __th, pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+
+
+extern int pthread_setschedparam (pthread_t __target_thread, int __policy,
+      const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+extern int pthread_getschedparam (pthread_t __target_thread,
+      int *__restrict __policy,
+      struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+
+extern int pthread_setschedprio (pthread_t __target_thread, int __prio)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int pthread_getname_np (pthread_t __target_thread, char *__buf,
+          size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int pthread_setname_np (pthread_t __target_thread, const char *__name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+extern int pthread_getconcurrency (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int pthread_setconcurrency (int __level) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int pthread_yield (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int pthread_yield (void) __asm__ ("" "sched_yield") __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__deprecated__ ("pthread_yield is deprecated, use sched_yield instead")))
+                                                      ;
+
+
+
+
+
+
+
+extern int pthread_setaffinity_np (pthread_t __th, size_t __cpusetsize,
+       const cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+extern int pthread_getaffinity_np (pthread_t __th, size_t __cpusetsize,
+       cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+# 509 "/usr/include/pthread.h" 3 4
+extern int pthread_once (pthread_once_t *__once_control,
+    void (*__init_routine) (void)) __attribute__ ((__nonnull__ (1, 2)));
+# 521 "/usr/include/pthread.h" 3 4
+extern int pthread_setcancelstate (int __state, int *__oldstate);
+
+
+
+extern int pthread_setcanceltype (int __type, int *__oldtype);
+
+
+extern int pthread_cancel (pthread_t __th);
+
+
+
+
+extern void pthread_testcancel (void);
+
+
+
+
+struct __cancel_jmp_buf_tag
+{
+  __jmp_buf __cancel_jmp_buf;
+  int __mask_was_saved;
+};
+
+typedef struct
+{
+  struct __cancel_jmp_buf_tag __cancel_jmp_buf[1];
+  void *__pad[4];
+} __pthread_unwind_buf_t __attribute__ ((__aligned__));
+# 557 "/usr/include/pthread.h" 3 4
+struct __pthread_cleanup_frame
+{
+  void (*__cancel_routine) (void *);
+  void *__cancel_arg;
+  int __do_it;
+  int __cancel_type;
+};
+# 697 "/usr/include/pthread.h" 3 4
+extern void __pthread_register_cancel (__pthread_unwind_buf_t *__buf)
+     ;
+# 709 "/usr/include/pthread.h" 3 4
+extern void __pthread_unregister_cancel (__pthread_unwind_buf_t *__buf)
+  ;
+# 732 "/usr/include/pthread.h" 3 4
+extern void __pthread_register_cancel_defer (__pthread_unwind_buf_t *__buf)
+     ;
+# 745 "/usr/include/pthread.h" 3 4
+extern void __pthread_unregister_cancel_restore (__pthread_unwind_buf_t *__buf)
+  ;
+
+
+
+extern void __pthread_unwind_next (__pthread_unwind_buf_t *__buf)
+     __attribute__ ((__noreturn__))
+
+     __attribute__ ((__weak__))
+
+     ;
+# 766 "/usr/include/pthread.h" 3 4
+extern int __sigsetjmp_cancel (struct __cancel_jmp_buf_tag __env[1], int __savemask) __asm__ ("" "__sigsetjmp") __attribute__ ((__nothrow__))
+
+
+                     __attribute__ ((__returns_twice__));
+# 781 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_init (pthread_mutex_t *__mutex,
+          const pthread_mutexattr_t *__mutexattr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_destroy (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_trylock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_lock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_mutex_timedlock (pthread_mutex_t *__restrict __mutex,
+        const struct timespec *__restrict
+        __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 817 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_clocklock (pthread_mutex_t *__restrict __mutex,
+        clockid_t __clockid,
+        const struct timespec *__restrict
+        __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+# 835 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_unlock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutex_getprioceiling (const pthread_mutex_t *
+      __restrict __mutex,
+      int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutex_setprioceiling (pthread_mutex_t *__restrict __mutex,
+      int __prioceiling,
+      int *__restrict __old_ceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+extern int pthread_mutex_consistent (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_consistent_np (pthread_mutex_t *) __asm__ ("" "pthread_mutex_consistent") __attribute__ ((__nothrow__ , __leaf__))
+                                __attribute__ ((__nonnull__ (1)))
+  __attribute__ ((__deprecated__ ("pthread_mutex_consistent_np is deprecated, use pthread_mutex_consistent")))
+                                                                         ;
+# 874 "/usr/include/pthread.h" 3 4
+extern int pthread_mutexattr_init (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_destroy (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getpshared (const pthread_mutexattr_t *
+      __restrict __attr,
+      int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setpshared (pthread_mutexattr_t *__attr,
+      int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_gettype (const pthread_mutexattr_t *__restrict
+          __attr, int *__restrict __kind)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_mutexattr_settype (pthread_mutexattr_t *__attr, int __kind)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getprotocol (const pthread_mutexattr_t *
+       __restrict __attr,
+       int *__restrict __protocol)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutexattr_setprotocol (pthread_mutexattr_t *__attr,
+       int __protocol)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getprioceiling (const pthread_mutexattr_t *
+          __restrict __attr,
+          int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setprioceiling (pthread_mutexattr_t *__attr,
+          int __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getrobust (const pthread_mutexattr_t *__attr,
+     int *__robustness)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_getrobust_np (pthread_mutexattr_t *, int *) __asm__ ("" "pthread_mutexattr_getrobust") __attribute__ ((__nothrow__ , __leaf__))
+
+                                   __attribute__ ((__nonnull__ (1)))
+  __attribute__ ((__deprecated__ ("pthread_mutexattr_getrobust_np is deprecated, use pthread_mutexattr_getrobust")))
+                                                                               ;
+
+
+
+
+
+
+extern int pthread_mutexattr_setrobust (pthread_mutexattr_t *__attr,
+     int __robustness)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_setrobust_np (pthread_mutexattr_t *, int) __asm__ ("" "pthread_mutexattr_setrobust") __attribute__ ((__nothrow__ , __leaf__))
+
+                                   __attribute__ ((__nonnull__ (1)))
+  __attribute__ ((__deprecated__ ("pthread_mutexattr_setrobust_np is deprecated, use pthread_mutexattr_setrobust")))
+                                                                               ;
+# 967 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_init (pthread_rwlock_t *__restrict __rwlock,
+    const pthread_rwlockattr_t *__restrict
+    __attr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_destroy (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_rdlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_tryrdlock (pthread_rwlock_t *__rwlock)
+  __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedrdlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1004 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_clockrdlock (pthread_rwlock_t *__restrict __rwlock,
+           clockid_t __clockid,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+# 1023 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_wrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_trywrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedwrlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1051 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_clockwrlock (pthread_rwlock_t *__restrict __rwlock,
+           clockid_t __clockid,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+# 1071 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_unlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int pthread_rwlockattr_init (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_destroy (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getpshared (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setpshared (pthread_rwlockattr_t *__attr,
+       int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getkind_np (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pref)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setkind_np (pthread_rwlockattr_t *__attr,
+       int __pref) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int pthread_cond_init (pthread_cond_t *__restrict __cond,
+         const pthread_condattr_t *__restrict __cond_attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_destroy (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_signal (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_broadcast (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_cond_wait (pthread_cond_t *__restrict __cond,
+         pthread_mutex_t *__restrict __mutex)
+     __attribute__ ((__nonnull__ (1, 2)));
+# 1145 "/usr/include/pthread.h" 3 4
+extern int pthread_cond_timedwait (pthread_cond_t *__restrict __cond,
+       pthread_mutex_t *__restrict __mutex,
+       const struct timespec *__restrict __abstime)
+     __attribute__ ((__nonnull__ (1, 2, 3)));
+# 1171 "/usr/include/pthread.h" 3 4
+extern int pthread_cond_clockwait (pthread_cond_t *__restrict __cond,
+       pthread_mutex_t *__restrict __mutex,
+       __clockid_t __clock_id,
+       const struct timespec *__restrict __abstime)
+     __attribute__ ((__nonnull__ (1, 2, 4)));
+# 1194 "/usr/include/pthread.h" 3 4
+extern int pthread_condattr_init (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_destroy (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_getpshared (const pthread_condattr_t *
+     __restrict __attr,
+     int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setpshared (pthread_condattr_t *__attr,
+     int __pshared) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_condattr_getclock (const pthread_condattr_t *
+          __restrict __attr,
+          __clockid_t *__restrict __clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setclock (pthread_condattr_t *__attr,
+          __clockid_t __clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1230 "/usr/include/pthread.h" 3 4
+extern int pthread_spin_init (pthread_spinlock_t *__lock, int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_destroy (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_lock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_trylock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_unlock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_barrier_init (pthread_barrier_t *__restrict __barrier,
+     const pthread_barrierattr_t *__restrict
+     __attr, unsigned int __count)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_destroy (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_wait (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_barrierattr_init (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_destroy (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_getpshared (const pthread_barrierattr_t *
+        __restrict __attr,
+        int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_barrierattr_setpshared (pthread_barrierattr_t *__attr,
+        int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1297 "/usr/include/pthread.h" 3 4
+extern int pthread_key_create (pthread_key_t *__key,
+          void (*__destr_function) (void *))
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_key_delete (pthread_key_t __key) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void *pthread_getspecific (pthread_key_t __key) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int pthread_setspecific (pthread_key_t __key,
+    const void *__pointer)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__access__ (__none__, 2)));
+
+
+
+
+extern int pthread_getcpuclockid (pthread_t __thread_id,
+      __clockid_t *__clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 1332 "/usr/include/pthread.h" 3 4
+extern int pthread_atfork (void (*__prepare) (void),
+      void (*__parent) (void),
+      void (*__child) (void)) __attribute__ ((__nothrow__ , __leaf__));
+# 1346 "/usr/include/pthread.h" 3 4
+
+# 34 "./src/main/drivers/accgyro/accgyro.h" 2
+
+
+
+
+
+# 38 "./src/main/drivers/accgyro/accgyro.h"
+typedef enum {
+    GYRO_NONE = 0,
+    GYRO_DEFAULT,
+    GYRO_MPU6050,
+    GYRO_L3G4200D,
+    GYRO_MPU3050,
+    GYRO_L3GD20,
+    GYRO_MPU6000,
+    GYRO_MPU6500,
+    GYRO_MPU9250,
+    GYRO_ICM20601,
+    GYRO_ICM20602,
+    GYRO_ICM20608G,
+    GYRO_ICM20649,
+    GYRO_ICM20689,
+    GYRO_BMI160,
+    GYRO_FAKE
+} gyroHardware_e;
+
+typedef enum {
+    GYRO_HARDWARE_LPF_NORMAL,
+    GYRO_HARDWARE_LPF_1KHZ_SAMPLE,
+
+
+
+} gyroHardwareLpf_e;
+
+typedef enum {
+    GYRO_32KHZ_HARDWARE_LPF_NORMAL,
+    GYRO_32KHZ_HARDWARE_LPF_EXPERIMENTAL
+} gyro32khzHardwareLpf;
+
+typedef enum {
+    GYRO_RATE_1_kHz,
+    GYRO_RATE_1100_Hz,
+    GYRO_RATE_3200_Hz,
+    GYRO_RATE_8_kHz,
+    GYRO_RATE_9_kHz,
+    GYRO_RATE_32_kHz,
+} gyroRateKHz_e;
+
+typedef struct gyroDev_s {
+
+    pthread_mutex_t lock;
+
+    sensorGyroInitFuncPtr initFn;
+    sensorGyroReadFuncPtr readFn;
+    sensorGyroReadDataFuncPtr temperatureFn;
+    extiCallbackRec_t exti;
+    busDevice_t bus;
+    float scale;
+    float gyroZero[3];
+    float gyroADC[3];
+    float gyroADCf[3];
+    int32_t gyroADCRawPrevious[3];
+    int16_t gyroADCRaw[3];
+    int16_t temperature;
+    mpuDetectionResult_t mpuDetectionResult;
+    sensor_align_e gyroAlign;
+    gyroRateKHz_e gyroRateKHz;
+    
+# 98 "./src/main/drivers/accgyro/accgyro.h" 3 4
+   _Bool 
+# 98 "./src/main/drivers/accgyro/accgyro.h"
+        dataReady;
+    
+# 99 "./src/main/drivers/accgyro/accgyro.h" 3 4
+   _Bool 
+# 99 "./src/main/drivers/accgyro/accgyro.h"
+        gyro_high_fsr;
+    uint8_t hardware_lpf;
+    uint8_t hardware_32khz_lpf;
+    uint8_t mpuDividerDrops;
+    ioTag_t mpuIntExtiTag;
+    uint8_t gyroHasOverflowProtection;
+    gyroHardware_e gyroHardware;
+} gyroDev_t;
+
+typedef struct accDev_s {
+
+    pthread_mutex_t lock;
+
+    float acc_1G_rec;
+    sensorAccInitFuncPtr initFn;
+    sensorAccReadFuncPtr readFn;
+    busDevice_t bus;
+    uint16_t acc_1G;
+    int16_t ADCRaw[3];
+    mpuDetectionResult_t mpuDetectionResult;
+    sensor_align_e accAlign;
+    
+# 120 "./src/main/drivers/accgyro/accgyro.h" 3 4
+   _Bool 
+# 120 "./src/main/drivers/accgyro/accgyro.h"
+        dataReady;
+    
+# 121 "./src/main/drivers/accgyro/accgyro.h" 3 4
+   _Bool 
+# 121 "./src/main/drivers/accgyro/accgyro.h"
+        acc_high_fsr;
+    char revisionCode;
+    uint8_t filler[2];
+} accDev_t;
+
+static inline void accDevLock(accDev_t *acc)
+{
+
+    pthread_mutex_lock(&acc->lock);
+
+
+
+}
+
+static inline void accDevUnLock(accDev_t *acc)
+{
+
+    pthread_mutex_unlock(&acc->lock);
+
+
+
+}
+
+static inline void gyroDevLock(gyroDev_t *gyro)
+{
+
+    pthread_mutex_lock(&gyro->lock);
+
+
+
+}
+
+static inline void gyroDevUnLock(gyroDev_t *gyro)
+{
+
+    pthread_mutex_unlock(&gyro->lock);
+
+
+
+}
+#pragma GCC diagnostic pop
+# 26 "./src/main/sensors/acceleration.h" 2
+# 1 "./src/main/sensors/sensors.h" 1
+# 21 "./src/main/sensors/sensors.h"
+       
+
+typedef enum {
+    SENSOR_INDEX_GYRO = 0,
+    SENSOR_INDEX_ACC,
+    SENSOR_INDEX_BARO,
+    SENSOR_INDEX_MAG,
+    SENSOR_INDEX_RANGEFINDER,
+    SENSOR_INDEX_COUNT
+} sensorIndex_e;
+
+extern uint8_t requestedSensors[SENSOR_INDEX_COUNT];
+extern uint8_t detectedSensors[SENSOR_INDEX_COUNT];
+
+typedef struct int16_flightDynamicsTrims_s {
+    int16_t roll;
+    int16_t pitch;
+    int16_t yaw;
+} flightDynamicsTrims_def_t;
+
+typedef union flightDynamicsTrims_u {
+    int16_t raw[3];
+    flightDynamicsTrims_def_t values;
+} flightDynamicsTrims_t;
+
+
+
+
+typedef enum {
+    SENSOR_GYRO = 1 << 0,
+    SENSOR_ACC = 1 << 1,
+    SENSOR_BARO = 1 << 2,
+    SENSOR_MAG = 1 << 3,
+    SENSOR_SONAR = 1 << 4,
+    SENSOR_RANGEFINDER = 1 << 4,
+    SENSOR_GPS = 1 << 5,
+    SENSOR_GPSMAG = 1 << 6
+} sensors_e;
+# 27 "./src/main/sensors/acceleration.h" 2
+
+
+typedef enum {
+    ACC_DEFAULT,
+    ACC_NONE,
+    ACC_ADXL345,
+    ACC_MPU6050,
+    ACC_MMA8452,
+    ACC_BMA280,
+    ACC_LSM303DLHC,
+    ACC_MPU6000,
+    ACC_MPU6500,
+    ACC_MPU9250,
+    ACC_ICM20601,
+    ACC_ICM20602,
+    ACC_ICM20608G,
+    ACC_ICM20649,
+    ACC_ICM20689,
+    ACC_BMI160,
+    ACC_FAKE
+} accelerationSensor_e;
+
+typedef struct acc_s {
+    accDev_t dev;
+    uint32_t accSamplingInterval;
+    float accADC[3];
+    
+# 53 "./src/main/sensors/acceleration.h" 3 4
+   _Bool 
+# 53 "./src/main/sensors/acceleration.h"
+        isAccelUpdatedAtLeastOnce;
+} acc_t;
+
+extern acc_t acc;
+
+typedef struct rollAndPitchTrims_s {
+    int16_t roll;
+    int16_t pitch;
+} rollAndPitchTrims_t_def;
+
+typedef union rollAndPitchTrims_u {
+    int16_t raw[2];
+    rollAndPitchTrims_t_def values;
+} rollAndPitchTrims_t;
+
+
+typedef struct accelerometerConfig_s {
+    uint16_t acc_lpf_hz;
+    uint8_t acc_hardware;
+    
+# 72 "./src/main/sensors/acceleration.h" 3 4
+   _Bool 
+# 72 "./src/main/sensors/acceleration.h"
+        acc_high_fsr;
+    flightDynamicsTrims_t accZero;
+    rollAndPitchTrims_t accelerometerTrims;
+} accelerometerConfig_t;
+
+extern accelerometerConfig_t accelerometerConfig_System; extern accelerometerConfig_t accelerometerConfig_Copy; static inline const accelerometerConfig_t* accelerometerConfig(void) { return &accelerometerConfig_System; } static inline accelerometerConfig_t* accelerometerConfigMutable(void) { return &accelerometerConfig_System; } struct _dummy;
+
+
+
+# 80 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 80 "./src/main/sensors/acceleration.h"
+    accInit(uint32_t gyroTargetLooptime);
+
+# 81 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 81 "./src/main/sensors/acceleration.h"
+    accIsCalibrationComplete(void);
+void accSetCalibrationCycles(uint16_t calibrationCyclesRequired);
+void resetRollAndPitchTrims(rollAndPitchTrims_t *rollAndPitchTrims);
+void accUpdate(timeUs_t currentTimeUs, rollAndPitchTrims_t *rollAndPitchTrims);
+
+# 85 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 85 "./src/main/sensors/acceleration.h"
+    accGetAccumulationAverage(float *accumulation);
+union flightDynamicsTrims_u;
+void setAccelerationTrims(union flightDynamicsTrims_u *accelerationTrimsToUse);
+void accInitFilters(void);
+void applyAccelerometerTrimsDelta(union rollAndPitchTrims_u *rollAndPitchTrimsDelta);
+# 99 "./src/main/cli/settings.c" 2
+# 1 "./src/main/sensors/barometer.h" 1
+# 21 "./src/main/sensors/barometer.h"
+       
+
+
+# 1 "./src/main/drivers/barometer/barometer.h" 1
+# 21 "./src/main/drivers/barometer/barometer.h"
+       
+
+
+
+struct baroDev_s;
+
+typedef void (*baroOpFuncPtr)(struct baroDev_s *baro);
+typedef void (*baroCalculateFuncPtr)(int32_t *pressure, int32_t *temperature);
+
+typedef struct baroDev_s {
+    busDevice_t busdev;
+    uint16_t ut_delay;
+    uint16_t up_delay;
+    baroOpFuncPtr start_ut;
+    baroOpFuncPtr get_ut;
+    baroOpFuncPtr start_up;
+    baroOpFuncPtr get_up;
+    baroCalculateFuncPtr calculate;
+} baroDev_t;
+# 25 "./src/main/sensors/barometer.h" 2
+
+typedef enum {
+    BARO_DEFAULT = 0,
+    BARO_NONE = 1,
+    BARO_BMP085 = 2,
+    BARO_MS5611 = 3,
+    BARO_BMP280 = 4,
+    BARO_LPS = 5,
+    BARO_QMP6988 = 6
+} baroSensor_e;
+
+
+
+typedef struct barometerConfig_s {
+    uint8_t baro_bustype;
+    uint8_t baro_spi_device;
+    ioTag_t baro_spi_csn;
+    uint8_t baro_i2c_device;
+    uint8_t baro_i2c_address;
+    uint8_t baro_hardware;
+    uint8_t baro_sample_count;
+    uint16_t baro_noise_lpf;
+    uint16_t baro_cf_vel;
+    uint8_t baro_stroke_sync;
+} barometerConfig_t;
+
+extern barometerConfig_t barometerConfig_System; extern barometerConfig_t barometerConfig_Copy; static inline const barometerConfig_t* barometerConfig(void) { return &barometerConfig_System; } static inline barometerConfig_t* barometerConfigMutable(void) { return &barometerConfig_System; } struct _dummy;
+
+typedef struct baro_s {
+    baroDev_t dev;
+    int32_t BaroAlt;
+    int32_t baroTemperature;
+    int32_t baroPressure;
+} baro_t;
+
+extern baro_t baro;
+
+void baroPreInit(void);
+
+# 63 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 63 "./src/main/sensors/barometer.h"
+    baroDetect(baroDev_t *dev, baroSensor_e baroHardwareToUse);
+
+# 64 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 64 "./src/main/sensors/barometer.h"
+    isBaroCalibrationComplete(void);
+void baroSetCalibrationCycles(uint16_t calibrationCyclesRequired);
+uint32_t baroUpdate(void);
+
+# 67 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 67 "./src/main/sensors/barometer.h"
+    isBaroReady(void);
+int32_t baroCalculateAltitude(void);
+
+# 69 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 69 "./src/main/sensors/barometer.h"
+    baroStrokeBoundary(
+# 69 "./src/main/sensors/barometer.h" 3 4
+                       _Bool 
+# 69 "./src/main/sensors/barometer.h"
+                            wholeStroke, int32_t *strokeAltitudeCm);
+void performBaroCalibrationCycle(void);
+# 100 "./src/main/cli/settings.c" 2
+# 1 "./src/main/sensors/battery.h" 1
+# 21 "./src/main/sensors/battery.h"
+       
+
+
+
+
+
+# 1 "./src/main/sensors/current.h" 1
+# 21 "./src/main/sensors/current.h"
+       
+
+
+# 1 "./src/main/sensors/current_ids.h" 1
+# 21 "./src/main/sensors/current_ids.h"
+       
+
+
+
+
+
+typedef enum {
+    CURRENT_METER_ID_NONE = 0,
+
+    CURRENT_METER_ID_BATTERY_1 = 10,
+    CURRENT_METER_ID_BATTERY_2,
+
+    CURRENT_METER_ID_BATTERY_10 = 19,
+
+    CURRENT_METER_ID_5V_1 = 20,
+    CURRENT_METER_ID_5V_2,
+
+    CURRENT_METER_ID_5V_10 = 29,
+
+    CURRENT_METER_ID_9V_1 = 30,
+    CURRENT_METER_ID_9V_2,
+
+    CURRENT_METER_ID_9V_10 = 39,
+
+    CURRENT_METER_ID_12V_1 = 40,
+    CURRENT_METER_ID_12V_2,
+
+    CURRENT_METER_ID_12V_10 = 49,
+
+    CURRENT_METER_ID_ESC_COMBINED_1 = 50,
+
+    CURRENT_METER_ID_ESC_COMBINED_10 = 59,
+
+    CURRENT_METER_ID_ESC_MOTOR_1 = 60,
+    CURRENT_METER_ID_ESC_MOTOR_2,
+    CURRENT_METER_ID_ESC_MOTOR_3,
+    CURRENT_METER_ID_ESC_MOTOR_4,
+    CURRENT_METER_ID_ESC_MOTOR_5,
+    CURRENT_METER_ID_ESC_MOTOR_6,
+    CURRENT_METER_ID_ESC_MOTOR_7,
+    CURRENT_METER_ID_ESC_MOTOR_8,
+    CURRENT_METER_ID_ESC_MOTOR_9,
+    CURRENT_METER_ID_ESC_MOTOR_10,
+    CURRENT_METER_ID_ESC_MOTOR_11,
+    CURRENT_METER_ID_ESC_MOTOR_12,
+
+    CURRENT_METER_ID_ESC_MOTOR_20 = 79,
+
+    CURRENT_METER_ID_VIRTUAL_1 = 80,
+    CURRENT_METER_ID_VIRTUAL_2,
+
+    CURRENT_METER_ID_MSP_1 = 90,
+    CURRENT_METER_ID_MSP_2,
+
+} currentMeterId_e;
+# 25 "./src/main/sensors/current.h" 2
+
+typedef enum {
+    CURRENT_METER_NONE = 0,
+    CURRENT_METER_ADC,
+    CURRENT_METER_VIRTUAL,
+    CURRENT_METER_ESC,
+    CURRENT_METER_MSP,
+    CURRENT_METER_COUNT
+} currentMeterSource_e;
+
+extern const char * const currentMeterSourceNames[CURRENT_METER_COUNT];
+
+typedef struct currentMeter_s {
+    int32_t amperage;
+    int32_t amperageLatest;
+    int32_t mAhDrawn;
+} currentMeter_t;
+
+
+
+typedef struct currentMeterMAhDrawnState_s {
+    int32_t mAhDrawn;
+    float mAhDrawnF;
+} currentMeterMAhDrawnState_t;
+
+
+
+
+
+typedef enum {
+    CURRENT_SENSOR_VIRTUAL = 0,
+    CURRENT_SENSOR_ADC,
+    CURRENT_SENSOR_ESC,
+    CURRENT_SENSOR_MSP
+} currentSensor_e;
+
+
+
+
+
+
+typedef struct currentMeterADCState_s {
+    currentMeterMAhDrawnState_t mahDrawnState;
+    int32_t amperage;
+    int32_t amperageLatest;
+} currentMeterADCState_t;
+
+typedef struct currentSensorADCConfig_s {
+    int16_t scale;
+    int16_t offset;
+} currentSensorADCConfig_t;
+
+extern currentSensorADCConfig_t currentSensorADCConfig_System; extern currentSensorADCConfig_t currentSensorADCConfig_Copy; static inline const currentSensorADCConfig_t* currentSensorADCConfig(void) { return &currentSensorADCConfig_System; } static inline currentSensorADCConfig_t* currentSensorADCConfigMutable(void) { return &currentSensorADCConfig_System; } struct _dummy;
+
+
+
+
+
+typedef struct currentMeterVirtualState_s {
+    currentMeterMAhDrawnState_t mahDrawnState;
+    int32_t amperage;
+} currentSensorVirtualState_t;
+
+typedef struct currentSensorVirtualConfig_s {
+    int16_t scale;
+    uint16_t offset;
+} currentSensorVirtualConfig_t;
+
+extern currentSensorVirtualConfig_t currentSensorVirtualConfig_System; extern currentSensorVirtualConfig_t currentSensorVirtualConfig_Copy; static inline const currentSensorVirtualConfig_t* currentSensorVirtualConfig(void) { return &currentSensorVirtualConfig_System; } static inline currentSensorVirtualConfig_t* currentSensorVirtualConfigMutable(void) { return &currentSensorVirtualConfig_System; } struct _dummy;
+
+
+
+
+
+typedef struct currentMeterESCState_s {
+    int32_t mAhDrawn;
+    int32_t amperage;
+} currentMeterESCState_t;
+
+
+
+
+
+
+typedef struct currentMeterMSPState_s {
+    int32_t mAhDrawn;
+    int32_t amperage;
+} currentMeterMSPState_t;
+
+
+
+
+
+
+void currentMeterReset(currentMeter_t *meter);
+
+void currentMeterADCInit(void);
+void currentMeterADCRefresh(int32_t lastUpdateAt);
+void currentMeterADCRead(currentMeter_t *meter);
+
+void currentMeterVirtualInit(void);
+void currentMeterVirtualRefresh(int32_t lastUpdateAt, 
+# 126 "./src/main/sensors/current.h" 3 4
+                                                     _Bool 
+# 126 "./src/main/sensors/current.h"
+                                                          armed, 
+# 126 "./src/main/sensors/current.h" 3 4
+                                                                 _Bool 
+# 126 "./src/main/sensors/current.h"
+                                                                      throttleLowAndMotorStop, int32_t throttleOffset);
+void currentMeterVirtualRead(currentMeter_t *meter);
+
+void currentMeterESCInit(void);
+void currentMeterESCRefresh(int32_t lastUpdateAt);
+void currentMeterESCReadCombined(currentMeter_t *meter);
+void currentMeterESCReadMotor(uint8_t motorNumber, currentMeter_t *meter);
+
+void currentMeterMSPInit(void);
+void currentMeterMSPRefresh(timeUs_t currentTimeUs);
+void currentMeterMSPRead(currentMeter_t *meter);
+void currentMeterMSPSet(uint16_t amperage, uint16_t mAhDrawn);
+
+
+
+
+extern const uint8_t supportedCurrentMeterCount;
+extern const uint8_t currentMeterIds[];
+void currentMeterRead(currentMeterId_e id, currentMeter_t *currentMeter);
+# 28 "./src/main/sensors/battery.h" 2
+# 1 "./src/main/sensors/voltage.h" 1
+# 21 "./src/main/sensors/voltage.h"
+       
+
+# 1 "./src/main/sensors/voltage_ids.h" 1
+# 21 "./src/main/sensors/voltage_ids.h"
+       
+
+
+
+
+
+typedef enum {
+    VOLTAGE_METER_ID_NONE = 0,
+
+    VOLTAGE_METER_ID_BATTERY_1 = 10,
+    VOLTAGE_METER_ID_BATTERY_2,
+
+    VOLTAGE_METER_ID_BATTERY_10 = 19,
+
+    VOLTAGE_METER_ID_5V_1 = 20,
+    VOLTAGE_METER_ID_5V_2,
+
+    VOLTAGE_METER_ID_5V_10 = 29,
+
+    VOLTAGE_METER_ID_9V_1 = 30,
+    VOLTAGE_METER_ID_9V_2,
+
+    VOLTAGE_METER_ID_9V_10 = 39,
+
+    VOLTAGE_METER_ID_12V_1 = 40,
+    VOLTAGE_METER_ID_12V_2,
+
+    VOLTAGE_METER_ID_12V_10 = 49,
+
+    VOLTAGE_METER_ID_ESC_COMBINED_1 = 50,
+
+    VOLTAGE_METER_ID_ESC_COMBINED_10 = 59,
+
+    VOLTAGE_METER_ID_ESC_MOTOR_1 = 60,
+    VOLTAGE_METER_ID_ESC_MOTOR_2,
+    VOLTAGE_METER_ID_ESC_MOTOR_3,
+    VOLTAGE_METER_ID_ESC_MOTOR_4,
+    VOLTAGE_METER_ID_ESC_MOTOR_5,
+    VOLTAGE_METER_ID_ESC_MOTOR_6,
+    VOLTAGE_METER_ID_ESC_MOTOR_7,
+    VOLTAGE_METER_ID_ESC_MOTOR_8,
+    VOLTAGE_METER_ID_ESC_MOTOR_9,
+    VOLTAGE_METER_ID_ESC_MOTOR_10,
+    VOLTAGE_METER_ID_ESC_MOTOR_11,
+    VOLTAGE_METER_ID_ESC_MOTOR_12,
+
+    VOLTAGE_METER_ID_ESC_MOTOR_20 = 79,
+
+    VOLTAGE_METER_ID_CELL_1 = 80,
+    VOLTAGE_METER_ID_CELL_2,
+
+    VOLTAGE_METER_ID_CELL_40 = 119,
+
+} voltageMeterId_e;
+# 24 "./src/main/sensors/voltage.h" 2
+
+
+
+
+
+typedef enum {
+    VOLTAGE_METER_NONE = 0,
+    VOLTAGE_METER_ADC,
+    VOLTAGE_METER_ESC,
+    VOLTAGE_METER_COUNT
+} voltageMeterSource_e;
+
+extern const char * const voltageMeterSourceNames[VOLTAGE_METER_COUNT];
+
+
+
+typedef struct voltageMeter_s {
+    uint16_t filtered;
+    uint16_t unfiltered;
+    
+# 43 "./src/main/sensors/voltage.h" 3 4
+   _Bool 
+# 43 "./src/main/sensors/voltage.h"
+        lowVoltageCutoff;
+} voltageMeter_t;
+
+
+
+
+
+
+typedef enum {
+    VOLTAGE_SENSOR_TYPE_ADC_RESISTOR_DIVIDER = 0,
+    VOLTAGE_SENSOR_TYPE_ESC
+} voltageSensorType_e;
+# 76 "./src/main/sensors/voltage.h"
+typedef enum {
+    VOLTAGE_SENSOR_ADC_VBAT = 0,
+    VOLTAGE_SENSOR_ADC_12V = 1,
+    VOLTAGE_SENSOR_ADC_9V = 2,
+    VOLTAGE_SENSOR_ADC_5V = 3
+} voltageSensorADC_e;
+
+
+typedef struct voltageSensorADCConfig_s {
+    uint8_t vbatscale;
+    uint8_t vbatresdivval;
+    uint8_t vbatresdivmultiplier;
+} voltageSensorADCConfig_t;
+
+extern voltageSensorADCConfig_t voltageSensorADCConfig_SystemArray[1]; extern voltageSensorADCConfig_t voltageSensorADCConfig_CopyArray[1]; static inline const voltageSensorADCConfig_t* voltageSensorADCConfig(int _index) { return &voltageSensorADCConfig_SystemArray[_index]; } static inline voltageSensorADCConfig_t* voltageSensorADCConfigMutable(int _index) { return &voltageSensorADCConfig_SystemArray[_index]; } static inline voltageSensorADCConfig_t (* voltageSensorADCConfig_array(void))[1] { return &voltageSensorADCConfig_SystemArray; } struct _dummy;
+
+
+
+
+void voltageMeterReset(voltageMeter_t *voltageMeter);
+
+void voltageMeterADCInit(void);
+void voltageMeterADCRefresh(void);
+void voltageMeterADCRead(voltageSensorADC_e adcChannel, voltageMeter_t *voltageMeter);
+
+void voltageMeterESCInit(void);
+void voltageMeterESCRefresh(void);
+void voltageMeterESCReadCombined(voltageMeter_t *voltageMeter);
+void voltageMeterESCReadMotor(uint8_t motor, voltageMeter_t *voltageMeter);
+
+
+
+
+
+extern const uint8_t voltageMeterADCtoIDMap[1];
+
+extern const uint8_t supportedVoltageMeterCount;
+extern const uint8_t voltageMeterIds[];
+void voltageMeterRead(voltageMeterId_e id, voltageMeter_t *voltageMeter);
+# 29 "./src/main/sensors/battery.h" 2
+# 37 "./src/main/sensors/battery.h"
+enum {
+    AUTO_PROFILE_CELL_COUNT_STAY = 0,
+    AUTO_PROFILE_CELL_COUNT_CHANGE = -1,
+};
+
+typedef struct batteryConfig_s {
+
+    uint16_t vbatmaxcellvoltage;
+    uint16_t vbatmincellvoltage;
+    uint16_t vbatwarningcellvoltage;
+    uint16_t vbatnotpresentcellvoltage;
+    uint8_t lvcPercentage;
+    voltageMeterSource_e voltageMeterSource;
+
+
+    currentMeterSource_e currentMeterSource;
+    uint16_t batteryCapacity;
+
+
+    
+# 56 "./src/main/sensors/battery.h" 3 4
+   _Bool 
+# 56 "./src/main/sensors/battery.h"
+        useVBatAlerts;
+    
+# 57 "./src/main/sensors/battery.h" 3 4
+   _Bool 
+# 57 "./src/main/sensors/battery.h"
+        useConsumptionAlerts;
+    uint8_t consumptionWarningPercentage;
+    uint8_t vbathysteresis;
+
+    uint16_t vbatfullcellvoltage;
+
+    uint8_t forceBatteryCellCount;
+    uint8_t vbatLpfPeriod;
+    uint8_t ibatLpfPeriod;
+} batteryConfig_t;
+
+extern batteryConfig_t batteryConfig_System; extern batteryConfig_t batteryConfig_Copy; static inline const batteryConfig_t* batteryConfig(void) { return &batteryConfig_System; } static inline batteryConfig_t* batteryConfigMutable(void) { return &batteryConfig_System; } struct _dummy;
+
+typedef struct lowVoltageCutoff_s {
+    
+# 71 "./src/main/sensors/battery.h" 3 4
+   _Bool 
+# 71 "./src/main/sensors/battery.h"
+        enabled;
+    uint8_t percentage;
+    timeUs_t startTime;
+} lowVoltageCutoff_t;
+
+typedef enum {
+    BATTERY_OK = 0,
+    BATTERY_WARNING,
+    BATTERY_CRITICAL,
+    BATTERY_NOT_PRESENT,
+    BATTERY_INIT
+} batteryState_e;
+
+void batteryInit(void);
+void batteryUpdateVoltage(timeUs_t currentTimeUs);
+void batteryUpdatePresence(void);
+
+batteryState_e getBatteryState(void);
+batteryState_e getVoltageState(void);
+batteryState_e getConsumptionState(void);
+const char * getBatteryStateString(void);
+
+void batteryUpdateStates(timeUs_t currentTimeUs);
+void batteryUpdateAlarms(void);
+
+struct rxConfig_s;
+
+float calculateVbatPidCompensation(void);
+uint8_t calculateBatteryPercentageRemaining(void);
+
+# 100 "./src/main/sensors/battery.h" 3 4
+_Bool 
+# 100 "./src/main/sensors/battery.h"
+    isBatteryVoltageConfigured(void);
+uint16_t getBatteryVoltage(void);
+uint16_t getLegacyBatteryVoltage(void);
+uint16_t getBatteryVoltageLatest(void);
+uint8_t getBatteryCellCount(void);
+uint16_t getBatteryAverageCellVoltage(void);
+
+
+# 107 "./src/main/sensors/battery.h" 3 4
+_Bool 
+# 107 "./src/main/sensors/battery.h"
+    isAmperageConfigured(void);
+int32_t getAmperage(void);
+int32_t getAmperageLatest(void);
+int32_t getMAhDrawn(void);
+
+void batteryUpdateCurrentMeter(timeUs_t currentTimeUs);
+
+const lowVoltageCutoff_t *getLowVoltageCutoff(void);
+# 101 "./src/main/cli/settings.c" 2
+# 1 "./src/main/sensors/boardalignment.h" 1
+# 21 "./src/main/sensors/boardalignment.h"
+       
+
+
+
+typedef struct boardAlignment_s {
+    int32_t rollDegrees;
+    int32_t pitchDegrees;
+    int32_t yawDegrees;
+} boardAlignment_t;
+
+extern boardAlignment_t boardAlignment_System; extern boardAlignment_t boardAlignment_Copy; static inline const boardAlignment_t* boardAlignment(void) { return &boardAlignment_System; } static inline boardAlignment_t* boardAlignmentMutable(void) { return &boardAlignment_System; } struct _dummy;
+
+void alignSensors(float *dest, uint8_t rotation);
+void initBoardAlignment(const boardAlignment_t *boardAlignment);
+# 102 "./src/main/cli/settings.c" 2
+# 1 "./src/main/sensors/compass.h" 1
+# 21 "./src/main/sensors/compass.h"
+       
+# 31 "./src/main/sensors/compass.h"
+typedef enum {
+    MAG_DEFAULT = 0,
+    MAG_NONE = 1,
+    MAG_HMC5883 = 2,
+    MAG_AK8975 = 3,
+    MAG_AK8963 = 4,
+    MAG_QMC5883 = 5,
+    MAG_LIS3MDL = 6
+} magSensor_e;
+
+typedef struct mag_s {
+    float magADC[3];
+    float magneticDeclination;
+} mag_t;
+
+extern mag_t mag;
+
+typedef struct compassConfig_s {
+    int16_t mag_declination;
+
+    sensor_align_e mag_align;
+    uint8_t mag_hardware;
+    uint8_t mag_bustype;
+    uint8_t mag_i2c_device;
+    uint8_t mag_i2c_address;
+    uint8_t mag_spi_device;
+    ioTag_t mag_spi_csn;
+    ioTag_t interruptTag;
+    flightDynamicsTrims_t magZero;
+} compassConfig_t;
+
+extern compassConfig_t compassConfig_System; extern compassConfig_t compassConfig_Copy; static inline const compassConfig_t* compassConfig(void) { return &compassConfig_System; } static inline compassConfig_t* compassConfigMutable(void) { return &compassConfig_System; } struct _dummy;
+
+
+# 64 "./src/main/sensors/compass.h" 3 4
+_Bool 
+# 64 "./src/main/sensors/compass.h"
+    compassIsHealthy(void);
+void compassUpdate(timeUs_t currentTime);
+
+# 66 "./src/main/sensors/compass.h" 3 4
+_Bool 
+# 66 "./src/main/sensors/compass.h"
+    compassInit(void);
+void compassPreInit(void);
+# 103 "./src/main/cli/settings.c" 2
+
+# 1 "./src/main/sensors/gyro.h" 1
+# 21 "./src/main/sensors/gyro.h"
+       
+# 34 "./src/main/sensors/gyro.h"
+typedef struct gyro_s {
+    uint32_t targetLooptime;
+    float gyroADCf[3];
+} gyro_t;
+
+extern gyro_t gyro;
+
+enum {
+    GYRO_OVERFLOW_CHECK_NONE = 0,
+    GYRO_OVERFLOW_CHECK_YAW,
+    GYRO_OVERFLOW_CHECK_ALL_AXES
+};
+
+enum {
+    DYN_NOTCH_RANGE_HIGH = 0,
+    DYN_NOTCH_RANGE_MEDIUM,
+    DYN_NOTCH_RANGE_LOW,
+    DYN_NOTCH_RANGE_AUTO
+};
+
+
+
+
+
+enum {
+    DYN_LPF_NONE = 0,
+    DYN_LPF_PT1,
+    DYN_LPF_BIQUAD
+};
+
+
+
+
+
+enum {
+    GYRO_FUSION_AVERAGE = 0,
+    GYRO_FUSION_NOISE_WEIGHTED
+};
+
+enum {
+    FILTER_LOWPASS = 0,
+    FILTER_LOWPASS2
+};
+
+typedef enum gyroDetectionFlags_e {
+    NO_GYROS_DETECTED = 0,
+    DETECTED_GYRO_1 = (1 << 0),
+
+
+
+
+
+} gyroDetectionFlags_t;
+
+typedef struct gyroConfig_s {
+    uint8_t gyroMovementCalibrationThreshold;
+    uint8_t gyro_sync_denom;
+    uint8_t gyro_hardware_lpf;
+
+    uint8_t gyro_high_fsr;
+    uint8_t gyro_to_use;
+
+    uint16_t gyro_lowpass_hz;
+    uint16_t gyro_lowpass2_hz;
+
+    uint16_t gyro_soft_notch_hz_1;
+    uint16_t gyro_soft_notch_cutoff_1;
+    uint16_t gyro_soft_notch_hz_2;
+    uint16_t gyro_soft_notch_cutoff_2;
+    int16_t gyro_offset_yaw;
+    uint8_t checkOverflow;
+
+
+    uint8_t gyro_lowpass_type;
+    uint8_t gyro_lowpass2_type;
+
+    uint8_t yaw_spin_recovery;
+    int16_t yaw_spin_threshold;
+
+    uint16_t gyroCalibrationDuration;
+
+    uint16_t dyn_lpf_gyro_min_hz;
+    uint16_t dyn_lpf_gyro_max_hz;
+    uint8_t dyn_notch_range;
+    uint8_t dyn_notch_width_percent;
+    uint16_t dyn_notch_q;
+    uint16_t dyn_notch_min_hz;
+    uint8_t gyro_filter_debug_axis;
+    uint8_t gyro_fusion;
+} gyroConfig_t;
+
+extern gyroConfig_t gyroConfig_System; extern gyroConfig_t gyroConfig_Copy; static inline const gyroConfig_t* gyroConfig(void) { return &gyroConfig_System; } static inline gyroConfig_t* gyroConfigMutable(void) { return &gyroConfig_System; } struct _dummy;
+
+void gyroPreInit(void);
+
+# 128 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 128 "./src/main/sensors/gyro.h"
+    gyroInit(void);
+
+void gyroInitFilters(void);
+void gyroUpdate(timeUs_t currentTimeUs);
+
+# 132 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 132 "./src/main/sensors/gyro.h"
+    gyroGetAccumulationAverage(float *accumulation);
+const busDevice_t *gyroSensorBus(void);
+struct mpuDetectionResult_s;
+const struct mpuDetectionResult_s *gyroMpuDetectionResult(void);
+void gyroStartCalibration(
+# 136 "./src/main/sensors/gyro.h" 3 4
+                         _Bool 
+# 136 "./src/main/sensors/gyro.h"
+                              isFirstArmingCalibration);
+
+# 137 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 137 "./src/main/sensors/gyro.h"
+    isFirstArmingGyroCalibrationRunning(void);
+
+# 138 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 138 "./src/main/sensors/gyro.h"
+    isGyroCalibrationComplete(void);
+void gyroReadTemperature(void);
+int16_t gyroGetTemperature(void);
+int16_t gyroRateDps(int axis);
+
+# 142 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 142 "./src/main/sensors/gyro.h"
+    gyroOverflowDetected(void);
+
+# 143 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 143 "./src/main/sensors/gyro.h"
+    gyroYawSpinDetected(void);
+uint16_t gyroAbsRateDps(int axis);
+uint8_t gyroReadRegister(uint8_t whichSensor, uint8_t reg);
+gyroDetectionFlags_t getGyroDetectionFlags(void);
+# 105 "./src/main/cli/settings.c" 2
+# 1 "./src/main/sensors/rangefinder.h" 1
+# 21 "./src/main/sensors/rangefinder.h"
+       
+
+
+
+# 1 "./src/main/drivers/rangefinder/rangefinder.h" 1
+# 21 "./src/main/drivers/rangefinder/rangefinder.h"
+       
+# 30 "./src/main/drivers/rangefinder/rangefinder.h"
+typedef struct rangefinderHardwarePins_s {
+    ioTag_t triggerTag;
+    ioTag_t echoTag;
+} rangefinderHardwarePins_t;
+
+struct rangefinderDev_s;
+typedef void (*rangefinderOpInitFuncPtr)(struct rangefinderDev_s * dev);
+typedef void (*rangefinderOpStartFuncPtr)(struct rangefinderDev_s * dev);
+typedef int32_t (*rangefinderOpReadFuncPtr)(struct rangefinderDev_s * dev);
+
+typedef struct rangefinderDev_s {
+    timeMs_t delayMs;
+    int16_t maxRangeCm;
+
+
+    int16_t detectionConeDeciDegrees;
+    int16_t detectionConeExtendedDeciDegrees;
+
+
+    rangefinderOpInitFuncPtr init;
+    rangefinderOpStartFuncPtr update;
+    rangefinderOpReadFuncPtr read;
+} rangefinderDev_t;
+
+extern int16_t rangefinderMaxRangeCm;
+extern int16_t rangefinderMaxAltWithTiltCm;
+extern int16_t rangefinderCfAltCm;
+# 26 "./src/main/sensors/rangefinder.h" 2
+
+
+
+typedef enum {
+    RANGEFINDER_NONE = 0,
+    RANGEFINDER_HCSR04 = 1,
+    RANGEFINDER_TFMINI = 2,
+    RANGEFINDER_TF02 = 3,
+
+    RANGEFINDER_SRF10 = 4,
+    RANGEFINDER_HCSR04I2C = 5,
+    RANGEFINDER_VL53L0X = 6,
+    RANGEFINDER_UIB = 7,
+} rangefinderType_e;
+
+typedef struct rangefinderConfig_s {
+    uint8_t rangefinder_hardware;
+} rangefinderConfig_t;
+
+extern rangefinderConfig_t rangefinderConfig_System; extern rangefinderConfig_t rangefinderConfig_Copy; static inline const rangefinderConfig_t* rangefinderConfig(void) { return &rangefinderConfig_System; } static inline rangefinderConfig_t* rangefinderConfigMutable(void) { return &rangefinderConfig_System; } struct _dummy;
+
+typedef struct rangefinder_s {
+    rangefinderDev_t dev;
+    float maxTiltCos;
+    int32_t rawAltitude;
+    int32_t calculatedAltitude;
+    timeMs_t lastValidResponseTimeMs;
+
+    
+# 54 "./src/main/sensors/rangefinder.h" 3 4
+   _Bool 
+# 54 "./src/main/sensors/rangefinder.h"
+        snrThresholdReached;
+    int32_t dynamicDistanceThreshold;
+    int16_t snr;
+} rangefinder_t;
+
+extern rangefinder_t rangefinder;
+
+void rangefinderResetDynamicThreshold(void);
+
+# 62 "./src/main/sensors/rangefinder.h" 3 4
+_Bool 
+# 62 "./src/main/sensors/rangefinder.h"
+    rangefinderInit(void);
+
+int32_t rangefinderGetLatestAltitude(void);
+int32_t rangefinderGetLatestRawAltitude(void);
+
+void rangefinderUpdate(timeUs_t currentTimeUs);
+
+# 68 "./src/main/sensors/rangefinder.h" 3 4
+_Bool 
+# 68 "./src/main/sensors/rangefinder.h"
+    rangefinderProcess(float cosTiltAngle);
+
+# 69 "./src/main/sensors/rangefinder.h" 3 4
+_Bool 
+# 69 "./src/main/sensors/rangefinder.h"
+    rangefinderIsHealthy(void);
+# 106 "./src/main/cli/settings.c" 2
+# 1 "./src/main/sensors/rpm_filter.h" 1
+# 21 "./src/main/sensors/rpm_filter.h"
+       
+
+
+
+
+typedef struct rpmFilterConfig_s
+{
+    uint8_t gyro_rpm_notch_harmonics;
+    uint8_t gyro_rpm_notch_min;
+    uint16_t gyro_rpm_notch_q;
+
+    uint8_t dterm_rpm_notch_harmonics;
+    uint8_t dterm_rpm_notch_min;
+    uint16_t dterm_rpm_notch_q;
+
+    uint16_t rpm_lpf;
+} rpmFilterConfig_t;
+
+extern rpmFilterConfig_t rpmFilterConfig_System; extern rpmFilterConfig_t rpmFilterConfig_Copy; static inline const rpmFilterConfig_t* rpmFilterConfig(void) { return &rpmFilterConfig_System; } static inline rpmFilterConfig_t* rpmFilterConfigMutable(void) { return &rpmFilterConfig_System; } struct _dummy;
+
+void rpmFilterInit(const rpmFilterConfig_t *config);
+float rpmFilterGyro(int axis, float values);
+float rpmFilterDterm(int axis, float values);
+void rpmFilterUpdate();
+
+# 45 "./src/main/sensors/rpm_filter.h" 3 4
+_Bool 
+# 45 "./src/main/sensors/rpm_filter.h"
+    isRpmFilterEnabled(void);
+# 107 "./src/main/cli/settings.c" 2
+
+# 1 "./src/main/telemetry/frsky_hub.h" 1
+# 21 "./src/main/telemetry/frsky_hub.h"
+       
+
+
+
+typedef enum {
+    FRSKY_VFAS_PRECISION_LOW = 0,
+    FRSKY_VFAS_PRECISION_HIGH
+} frskyVFasPrecision_e;
+
+typedef void frSkyHubWriteByteFn(const char data);
+
+void handleFrSkyHubTelemetry(timeUs_t currentTimeUs);
+void checkFrSkyHubTelemetryState(void);
+
+
+# 35 "./src/main/telemetry/frsky_hub.h" 3 4
+_Bool 
+# 35 "./src/main/telemetry/frsky_hub.h"
+    initFrSkyHubTelemetry(void);
+
+# 36 "./src/main/telemetry/frsky_hub.h" 3 4
+_Bool 
+# 36 "./src/main/telemetry/frsky_hub.h"
+    initFrSkyHubTelemetryExternal(frSkyHubWriteByteFn *frSkyWriteFrameExternal);
+
+void processFrSkyHubTelemetry(timeUs_t currentTimeUs);
+# 109 "./src/main/cli/settings.c" 2
+# 1 "./src/main/telemetry/ibus_shared.h" 1
+# 29 "./src/main/telemetry/ibus_shared.h"
+       
+
+
+# 1 "./src/main/drivers/serial.h" 1
+# 21 "./src/main/drivers/serial.h"
+       
+
+
+
+
+
+
+
+typedef enum {
+    MODE_RX = 1 << 0,
+    MODE_TX = 1 << 1,
+    MODE_RXTX = MODE_RX | MODE_TX
+} portMode_e;
+
+typedef enum {
+    SERIAL_NOT_INVERTED = 0 << 0,
+    SERIAL_INVERTED = 1 << 0,
+    SERIAL_STOPBITS_1 = 0 << 1,
+    SERIAL_STOPBITS_2 = 1 << 1,
+    SERIAL_PARITY_NO = 0 << 2,
+    SERIAL_PARITY_EVEN = 1 << 2,
+    SERIAL_UNIDIR = 0 << 3,
+    SERIAL_BIDIR = 1 << 3,
+# 52 "./src/main/drivers/serial.h"
+    SERIAL_BIDIR_OD = 0 << 4,
+    SERIAL_BIDIR_PP = 1 << 4,
+    SERIAL_BIDIR_NOPULL = 1 << 5,
+} portOptions_e;
+
+
+
+
+
+typedef void (*serialReceiveCallbackPtr)(uint16_t data, void *rxCallbackData);
+
+typedef struct serialPort_s {
+
+    const struct serialPortVTable *vTable;
+
+    portMode_e mode;
+    portOptions_e options;
+
+    uint32_t baudRate;
+
+    uint32_t rxBufferSize;
+    uint32_t txBufferSize;
+    volatile uint8_t *rxBuffer;
+    volatile uint8_t *txBuffer;
+    uint32_t rxBufferHead;
+    uint32_t rxBufferTail;
+    uint32_t txBufferHead;
+    uint32_t txBufferTail;
+
+    serialReceiveCallbackPtr rxCallback;
+    void *rxCallbackData;
+
+    uint8_t identifier;
+} serialPort_t;
+# 97 "./src/main/drivers/serial.h"
+typedef struct serialPinConfig_s {
+    ioTag_t ioTagTx[10];
+    ioTag_t ioTagRx[10];
+    ioTag_t ioTagInverter[10];
+} serialPinConfig_t;
+
+extern serialPinConfig_t serialPinConfig_System; extern serialPinConfig_t serialPinConfig_Copy; static inline const serialPinConfig_t* serialPinConfig(void) { return &serialPinConfig_System; } static inline serialPinConfig_t* serialPinConfigMutable(void) { return &serialPinConfig_System; } struct _dummy;
+
+struct serialPortVTable {
+    void (*serialWrite)(serialPort_t *instance, uint8_t ch);
+
+    uint32_t (*serialTotalRxWaiting)(const serialPort_t *instance);
+    uint32_t (*serialTotalTxFree)(const serialPort_t *instance);
+
+    uint8_t (*serialRead)(serialPort_t *instance);
+
+
+    void (*serialSetBaudRate)(serialPort_t *instance, uint32_t baudRate);
+
+    
+# 116 "./src/main/drivers/serial.h" 3 4
+   _Bool 
+# 116 "./src/main/drivers/serial.h"
+        (*isSerialTransmitBufferEmpty)(const serialPort_t *instance);
+
+    void (*setMode)(serialPort_t *instance, portMode_e mode);
+    void (*setCtrlLineStateCb)(serialPort_t *instance, void (*cb)(void *instance, uint16_t ctrlLineState), void *context);
+    void (*setBaudRateCb)(serialPort_t *instance, void (*cb)(serialPort_t *context, uint32_t baud), serialPort_t *context);
+
+    void (*writeBuf)(serialPort_t *instance, const void *data, int count);
+
+    void (*beginWrite)(serialPort_t *instance);
+    void (*endWrite)(serialPort_t *instance);
+
+
+    uint32_t (*readBuf)(serialPort_t *instance, uint8_t *data, uint32_t count);
+};
+
+void serialWrite(serialPort_t *instance, uint8_t ch);
+uint32_t serialRxBytesWaiting(const serialPort_t *instance);
+uint32_t serialTxBytesFree(const serialPort_t *instance);
+void serialWriteBuf(serialPort_t *instance, const uint8_t *data, int count);
+uint8_t serialRead(serialPort_t *instance);
+uint32_t serialReadBuf(serialPort_t *instance, uint8_t *data, uint32_t count);
+void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate);
+void serialSetMode(serialPort_t *instance, portMode_e mode);
+void serialSetCtrlLineStateCb(serialPort_t *instance, void (*cb)(void *context, uint16_t ctrlLineState), void *context);
+void serialSetBaudRateCb(serialPort_t *instance, void (*cb)(serialPort_t *context, uint32_t baud), serialPort_t *context);
+
+# 141 "./src/main/drivers/serial.h" 3 4
+_Bool 
+# 141 "./src/main/drivers/serial.h"
+    isSerialTransmitBufferEmpty(const serialPort_t *instance);
+void serialPrint(serialPort_t *instance, const char *str);
+uint32_t serialGetBaudRate(serialPort_t *instance);
+
+
+void serialWriteBufShim(void *instance, const uint8_t *data, int count);
+void serialBeginWrite(serialPort_t *instance);
+void serialEndWrite(serialPort_t *instance);
+# 33 "./src/main/telemetry/ibus_shared.h" 2
+
+
+
+
+typedef enum {
+    IBUS_SENSOR_TYPE_NONE = 0x00,
+    IBUS_SENSOR_TYPE_TEMPERATURE = 0x01,
+    IBUS_SENSOR_TYPE_RPM_FLYSKY = 0x02,
+    IBUS_SENSOR_TYPE_EXTERNAL_VOLTAGE = 0x03,
+    IBUS_SENSOR_TYPE_CELL = 0x04,
+    IBUS_SENSOR_TYPE_BAT_CURR = 0x05,
+    IBUS_SENSOR_TYPE_FUEL = 0x06,
+    IBUS_SENSOR_TYPE_RPM = 0x07,
+    IBUS_SENSOR_TYPE_CMP_HEAD = 0x08,
+    IBUS_SENSOR_TYPE_CLIMB_RATE = 0x09,
+    IBUS_SENSOR_TYPE_COG = 0x0a,
+    IBUS_SENSOR_TYPE_GPS_STATUS = 0x0b,
+    IBUS_SENSOR_TYPE_ACC_X = 0x0c,
+    IBUS_SENSOR_TYPE_ACC_Y = 0x0d,
+    IBUS_SENSOR_TYPE_ACC_Z = 0x0e,
+    IBUS_SENSOR_TYPE_ROLL = 0x0f,
+    IBUS_SENSOR_TYPE_PITCH = 0x10,
+    IBUS_SENSOR_TYPE_YAW = 0x11,
+    IBUS_SENSOR_TYPE_VERTICAL_SPEED = 0x12,
+    IBUS_SENSOR_TYPE_GROUND_SPEED = 0x13,
+    IBUS_SENSOR_TYPE_GPS_DIST = 0x14,
+    IBUS_SENSOR_TYPE_ARMED = 0x15,
+    IBUS_SENSOR_TYPE_FLIGHT_MODE = 0x16,
+    IBUS_SENSOR_TYPE_PRES = 0x41,
+    IBUS_SENSOR_TYPE_ODO1 = 0x7c,
+    IBUS_SENSOR_TYPE_ODO2 = 0x7d,
+    IBUS_SENSOR_TYPE_SPE = 0x7e,
+
+    IBUS_SENSOR_TYPE_GPS_LAT = 0x80,
+    IBUS_SENSOR_TYPE_GPS_LON = 0x81,
+    IBUS_SENSOR_TYPE_GPS_ALT = 0x82,
+    IBUS_SENSOR_TYPE_ALT = 0x83,
+    IBUS_SENSOR_TYPE_ALT_MAX = 0x84,
+
+    IBUS_SENSOR_TYPE_ALT_FLYSKY = 0xf9,
+
+
+
+
+
+    IBUS_SENSOR_TYPE_UNKNOWN = 0xff
+} ibusSensorType_e;
+# 89 "./src/main/telemetry/ibus_shared.h"
+
+# 89 "./src/main/telemetry/ibus_shared.h" 3 4
+_Bool 
+# 89 "./src/main/telemetry/ibus_shared.h"
+    isChecksumOkIa6b(const uint8_t *ibusPacket, const uint8_t length);
+# 110 "./src/main/cli/settings.c" 2
+# 1 "./src/main/telemetry/telemetry.h" 1
+# 28 "./src/main/telemetry/telemetry.h"
+       
+
+
+# 1 "./src/main/io/serial.h" 1
+# 21 "./src/main/io/serial.h"
+       
+
+
+
+
+
+
+
+typedef enum {
+    PORTSHARING_UNUSED = 0,
+    PORTSHARING_NOT_SHARED,
+    PORTSHARING_SHARED
+} portSharing_e;
+
+typedef enum {
+    FUNCTION_NONE = 0,
+    FUNCTION_MSP = (1 << 0),
+    FUNCTION_GPS = (1 << 1),
+    FUNCTION_TELEMETRY_FRSKY_HUB = (1 << 2),
+    FUNCTION_TELEMETRY_HOTT = (1 << 3),
+    FUNCTION_TELEMETRY_LTM = (1 << 4),
+    FUNCTION_TELEMETRY_SMARTPORT = (1 << 5),
+    FUNCTION_RX_SERIAL = (1 << 6),
+    FUNCTION_BLACKBOX = (1 << 7),
+    FUNCTION_TELEMETRY_MAVLINK = (1 << 9),
+    FUNCTION_ESC_SENSOR = (1 << 10),
+    FUNCTION_VTX_SMARTAUDIO = (1 << 11),
+    FUNCTION_TELEMETRY_IBUS = (1 << 12),
+    FUNCTION_VTX_TRAMP = (1 << 13),
+    FUNCTION_RCDEVICE = (1 << 14),
+    FUNCTION_LIDAR_TF = (1 << 15),
+} serialPortFunction_e;
+
+
+
+
+typedef enum {
+    BAUD_AUTO = 0,
+    BAUD_9600,
+    BAUD_19200,
+    BAUD_38400,
+    BAUD_57600,
+    BAUD_115200,
+    BAUD_230400,
+    BAUD_250000,
+    BAUD_400000,
+    BAUD_460800,
+    BAUD_500000,
+    BAUD_921600,
+    BAUD_1000000,
+    BAUD_1500000,
+    BAUD_2000000,
+    BAUD_2470000
+} baudRate_e;
+
+extern const uint32_t baudRates[];
+
+
+typedef enum {
+    SERIAL_PORT_NONE = -1,
+    SERIAL_PORT_USART1 = 0,
+    SERIAL_PORT_USART2,
+    SERIAL_PORT_USART3,
+    SERIAL_PORT_UART4,
+    SERIAL_PORT_UART5,
+    SERIAL_PORT_USART6,
+    SERIAL_PORT_USART7,
+    SERIAL_PORT_USART8,
+    SERIAL_PORT_USB_VCP = 20,
+    SERIAL_PORT_SOFTSERIAL1 = 30,
+    SERIAL_PORT_SOFTSERIAL2
+} serialPortIdentifier_e;
+
+extern const serialPortIdentifier_e serialPortIdentifiers[8];
+# 103 "./src/main/io/serial.h"
+typedef struct serialPortUsage_s {
+    serialPort_t *serialPort;
+    serialPortFunction_e function;
+    serialPortIdentifier_e identifier;
+} serialPortUsage_t;
+
+serialPort_t *findSharedSerialPort(uint16_t functionMask, serialPortFunction_e sharedWithFunction);
+
+
+
+
+typedef struct serialPortConfig_s {
+    uint16_t functionMask;
+    serialPortIdentifier_e identifier;
+    uint8_t msp_baudrateIndex;
+    uint8_t gps_baudrateIndex;
+    uint8_t blackbox_baudrateIndex;
+    uint8_t telemetry_baudrateIndex;
+} serialPortConfig_t;
+
+typedef struct serialConfig_s {
+    serialPortConfig_t portConfigs[8];
+    uint16_t serial_update_rate_hz;
+    uint8_t reboot_character;
+} serialConfig_t;
+
+extern serialConfig_t serialConfig_System; extern serialConfig_t serialConfig_Copy; static inline const serialConfig_t* serialConfig(void) { return &serialConfig_System; } static inline serialConfig_t* serialConfigMutable(void) { return &serialConfig_System; } struct _dummy;
+
+typedef void serialConsumer(uint8_t);
+
+
+
+
+void serialInit(
+# 136 "./src/main/io/serial.h" 3 4
+               _Bool 
+# 136 "./src/main/io/serial.h"
+                    softserialEnabled, serialPortIdentifier_e serialPortToDisable);
+void serialRemovePort(serialPortIdentifier_e identifier);
+uint8_t serialGetAvailablePortCount(void);
+
+# 139 "./src/main/io/serial.h" 3 4
+_Bool 
+# 139 "./src/main/io/serial.h"
+    serialIsPortAvailable(serialPortIdentifier_e identifier);
+
+# 140 "./src/main/io/serial.h" 3 4
+_Bool 
+# 140 "./src/main/io/serial.h"
+    isSerialConfigValid(const serialConfig_t *serialConfig);
+serialPortConfig_t *serialFindPortConfiguration(serialPortIdentifier_e identifier);
+
+# 142 "./src/main/io/serial.h" 3 4
+_Bool 
+# 142 "./src/main/io/serial.h"
+    doesConfigurationUsePort(serialPortIdentifier_e portIdentifier);
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e function);
+serialPortConfig_t *findNextSerialPortConfig(serialPortFunction_e function);
+
+portSharing_e determinePortSharing(const serialPortConfig_t *portConfig, serialPortFunction_e function);
+
+# 147 "./src/main/io/serial.h" 3 4
+_Bool 
+# 147 "./src/main/io/serial.h"
+    isSerialPortShared(const serialPortConfig_t *portConfig, uint16_t functionMask, serialPortFunction_e sharedWithFunction);
+
+void pgResetFn_serialConfig(serialConfig_t *serialConfig);
+serialPortUsage_t *findSerialPortUsageByIdentifier(serialPortIdentifier_e identifier);
+int findSerialPortIndexByIdentifier(serialPortIdentifier_e identifier);
+
+
+
+serialPort_t *openSerialPort(
+    serialPortIdentifier_e identifier,
+    serialPortFunction_e function,
+    serialReceiveCallbackPtr rxCallback,
+    void *rxCallbackData,
+    uint32_t baudrate,
+    portMode_e mode,
+    portOptions_e options
+);
+void closeSerialPort(serialPort_t *serialPort);
+
+void waitForSerialPortToFinishTransmitting(serialPort_t *serialPort);
+
+baudRate_e lookupBaudRateIndex(uint32_t baudRate);
+
+
+
+
+
+void serialPassthrough(serialPort_t *left, serialPort_t *right, serialConsumer *leftC, serialConsumer *rightC);
+# 32 "./src/main/telemetry/telemetry.h" 2
+
+
+typedef enum {
+    FRSKY_FORMAT_DMS = 0,
+    FRSKY_FORMAT_NMEA
+} frskyGpsCoordFormat_e;
+
+typedef enum {
+    FRSKY_UNIT_METRICS = 0,
+    FRSKY_UNIT_IMPERIALS
+} frskyUnit_e;
+
+typedef enum {
+    SENSOR_VOLTAGE = 1 << 0,
+    SENSOR_CURRENT = 1 << 1,
+    SENSOR_FUEL = 1 << 2,
+    SENSOR_MODE = 1 << 3,
+    SENSOR_ACC_X = 1 << 4,
+    SENSOR_ACC_Y = 1 << 5,
+    SENSOR_ACC_Z = 1 << 6,
+    SENSOR_PITCH = 1 << 7,
+    SENSOR_ROLL = 1 << 8,
+    SENSOR_HEADING = 1 << 9,
+    SENSOR_ALTITUDE = 1 << 10,
+    SENSOR_VARIO = 1 << 11,
+    SENSOR_LAT_LONG = 1 << 12,
+    SENSOR_GROUND_SPEED = 1 << 13,
+    SENSOR_DISTANCE = 1 << 14,
+    ESC_SENSOR_CURRENT = 1 << 15,
+    ESC_SENSOR_VOLTAGE = 1 << 16,
+    ESC_SENSOR_RPM = 1 << 17,
+    ESC_SENSOR_TEMPERATURE = 1 << 18,
+    ESC_SENSOR_ALL = ESC_SENSOR_CURRENT
+                            | ESC_SENSOR_VOLTAGE
+                            | ESC_SENSOR_RPM
+                            | ESC_SENSOR_TEMPERATURE,
+    SENSOR_TEMPERATURE = 1 << 19,
+    SENSOR_ALL = (1 << 20) - 1,
+} sensor_e;
+
+typedef struct telemetryConfig_s {
+    int16_t gpsNoFixLatitude;
+    int16_t gpsNoFixLongitude;
+    uint8_t telemetry_inverted;
+    uint8_t halfDuplex;
+    frskyGpsCoordFormat_e frsky_coordinate_format;
+    frskyUnit_e frsky_unit;
+    uint8_t frsky_vfas_precision;
+    uint8_t hottAlarmSoundInterval;
+    uint8_t pidValuesAsTelemetry;
+    uint8_t report_cell_voltage;
+    uint8_t flysky_sensors[15];
+    uint16_t mavlink_mah_as_heading_divisor;
+    uint32_t disabledSensors;
+} telemetryConfig_t;
+
+extern telemetryConfig_t telemetryConfig_System; extern telemetryConfig_t telemetryConfig_Copy; static inline const telemetryConfig_t* telemetryConfig(void) { return &telemetryConfig_System; } static inline telemetryConfig_t* telemetryConfigMutable(void) { return &telemetryConfig_System; } struct _dummy;
+
+extern serialPort_t *telemetrySharedPort;
+
+void telemetryInit(void);
+
+# 93 "./src/main/telemetry/telemetry.h" 3 4
+_Bool 
+# 93 "./src/main/telemetry/telemetry.h"
+    telemetryCheckRxPortShared(const serialPortConfig_t *portConfig);
+
+void telemetryCheckState(void);
+void telemetryProcess(uint32_t currentTime);
+
+
+# 98 "./src/main/telemetry/telemetry.h" 3 4
+_Bool 
+# 98 "./src/main/telemetry/telemetry.h"
+    telemetryDetermineEnabledState(portSharing_e portSharing);
+
+
+# 100 "./src/main/telemetry/telemetry.h" 3 4
+_Bool 
+# 100 "./src/main/telemetry/telemetry.h"
+    telemetryIsSensorEnabled(sensor_e sensor);
+# 111 "./src/main/cli/settings.c" 2
+
+# 1 "./src/main/cli/settings.h" 1
+# 21 "./src/main/cli/settings.h"
+       
+
+
+
+
+
+
+typedef enum {
+    TABLE_OFF_ON = 0,
+    TABLE_UNIT,
+    TABLE_ALIGNMENT,
+# 40 "./src/main/cli/settings.h"
+    TABLE_BLACKBOX_DEVICE,
+    TABLE_BLACKBOX_MODE,
+
+    TABLE_CURRENT_METER,
+    TABLE_VOLTAGE_METER,
+
+    TABLE_GIMBAL_MODE,
+
+
+
+
+
+
+
+    TABLE_GYRO_HARDWARE_LPF,
+    TABLE_ACC_HARDWARE,
+
+    TABLE_BARO_HARDWARE,
+
+
+    TABLE_MAG_HARDWARE,
+
+    TABLE_DEBUG,
+    TABLE_MOTOR_PWM_PROTOCOL,
+    TABLE_RC_INTERPOLATION,
+    TABLE_RC_INTERPOLATION_CHANNELS,
+    TABLE_LOWPASS_TYPE,
+    TABLE_DTERM_LOWPASS_TYPE,
+    TABLE_ANTI_GRAVITY_MODE,
+    TABLE_FAILSAFE,
+    TABLE_FAILSAFE_SWITCH_MODE,
+    TABLE_CRASH_RECOVERY,
+
+
+
+    TABLE_BUS_TYPE,
+# 86 "./src/main/cli/settings.h"
+    TABLE_GYRO_OVERFLOW_CHECK,
+
+    TABLE_RATES_TYPE,
+# 99 "./src/main/cli/settings.h"
+    TABLE_THROTTLE_LIMIT_TYPE,
+
+
+
+
+    TABLE_ITERM_RELAX,
+    TABLE_ITERM_RELAX_TYPE,
+
+
+    TABLE_ACRO_TRAINER_DEBUG,
+
+
+    TABLE_RC_SMOOTHING_TYPE,
+    TABLE_RC_SMOOTHING_DEBUG,
+    TABLE_RC_SMOOTHING_INPUT_TYPE,
+    TABLE_RC_SMOOTHING_DERIVATIVE_TYPE,
+
+
+
+
+
+
+
+    TABLE_GYRO_HARDWARE,
+# 136 "./src/main/cli/settings.h"
+    TABLE_GYRO_FILTER_DEBUG,
+
+
+    LOOKUP_TABLE_COUNT
+} lookupTableIndex_e;
+
+typedef struct lookupTableEntry_s {
+    const char * const *values;
+    const uint8_t valueCount;
+} lookupTableEntry_t;
+
+
+
+
+
+
+typedef enum {
+
+    VAR_UINT8 = (0 << 0),
+    VAR_INT8 = (1 << 0),
+    VAR_UINT16 = (2 << 0),
+    VAR_INT16 = (3 << 0),
+    VAR_UINT32 = (4 << 0),
+
+
+    MASTER_VALUE = (0 << 3),
+    PROFILE_VALUE = (1 << 3),
+    PROFILE_RATE_VALUE = (2 << 3),
+    HARDWARE_VALUE = (3 << 3),
+
+
+    MODE_DIRECT = (0 << 5),
+    MODE_LOOKUP = (1 << 5),
+    MODE_ARRAY = (2 << 5),
+    MODE_BITSET = (3 << 5)
+} cliValueFlag_e;
+
+
+
+
+
+
+typedef struct cliMinMaxConfig_s {
+    const int16_t min;
+    const int16_t max;
+} cliMinMaxConfig_t;
+
+typedef struct cliMinMaxUnsignedConfig_s {
+    const uint16_t min;
+    const uint16_t max;
+} cliMinMaxUnsignedConfig_t;
+
+typedef struct cliLookupTableConfig_s {
+    const lookupTableIndex_e tableIndex;
+} cliLookupTableConfig_t;
+
+typedef struct cliArrayLengthConfig_s {
+    const uint8_t length;
+} cliArrayLengthConfig_t;
+
+typedef union {
+    cliLookupTableConfig_t lookup;
+    cliMinMaxConfig_t minmax;
+    cliMinMaxUnsignedConfig_t minmaxUnsigned;
+    cliArrayLengthConfig_t array;
+    uint8_t bitpos;
+    uint32_t u32Max;
+} cliValueConfig_t;
+
+typedef struct clivalue_s {
+    const char *name;
+    const uint8_t type;
+    const cliValueConfig_t config;
+
+    pgn_t pgn;
+    uint16_t offset;
+} __attribute__((packed)) clivalue_t;
+
+
+extern const lookupTableEntry_t lookupTables[];
+extern const uint16_t valueTableEntryCount;
+
+extern const clivalue_t valueTable[];
+extern uint16_t valueTableNameIndex[];
+
+
+extern const char * const lookupTableGyroHardware[];
+
+extern const char * const lookupTableAccHardware[];
+
+
+extern const char * const lookupTableBaroHardware[];
+
+
+extern const char * const lookupTableMagHardware[];
+
+
+extern const char * const lookupTableRangefinderHardware[];
+
+extern const char * const lookupTableLedstripColors[];
+# 113 "./src/main/cli/settings.c" 2
+
+
+
+
+const char * const lookupTableAccHardware[] = {
+    "AUTO", "NONE", "ADXL345", "MPU6050", "MMA8452", "BMA280", "LSM303DLHC",
+    "MPU6000", "MPU6500", "MPU9250", "ICM20601", "ICM20602", "ICM20608G", "ICM20649", "ICM20689",
+    "BMI160", "FAKE"
+};
+
+
+const char * const lookupTableGyroHardware[] = {
+    "AUTO", "NONE", "MPU6050", "L3G4200D", "MPU3050", "L3GD20",
+    "MPU6000", "MPU6500", "MPU9250", "ICM20601", "ICM20602", "ICM20608G", "ICM20649", "ICM20689",
+    "BMI160", "FAKE"
+};
+
+
+
+const char * const lookupTableBaroHardware[] = {
+    "AUTO", "NONE", "BMP085", "MS5611", "BMP280", "LPS", "QMP6988"
+};
+
+
+
+const char * const lookupTableMagHardware[] = {
+    "AUTO", "NONE", "HMC5883", "AK8975", "AK8963", "QMC5883", "LIS3MDL"
+};
+
+
+const char * const lookupTableRangefinderHardware[] = {
+    "NONE", "HCSR04", "TFMINI", "TF02"
+};
+
+
+static const char * const lookupTableOffOn[] = {
+    "OFF", "ON"
+};
+
+static const char * const lookupTableCrashRecovery[] = {
+    "OFF", "ON" ,"BEEP"
+};
+
+static const char * const lookupTableUnit[] = {
+    "IMPERIAL", "METRIC"
+};
+
+static const char * const lookupTableAlignment[] = {
+    "DEFAULT",
+    "CW0",
+    "CW90",
+    "CW180",
+    "CW270",
+    "CW0FLIP",
+    "CW90FLIP",
+    "CW180FLIP",
+    "CW270FLIP"
+};
+# 193 "./src/main/cli/settings.c"
+static const char * const lookupTableGimbalMode[] = {
+    "NORMAL", "MIXTILT"
+};
+
+
+
+static const char * const lookupTableBlackboxDevice[] = {
+    "NONE", "SPIFLASH", "SDCARD", "SERIAL"
+};
+
+static const char * const lookupTableBlackboxMode[] = {
+    "NORMAL", "MOTOR_TEST", "ALWAYS"
+};
+# 248 "./src/main/cli/settings.c"
+static const char * const lookupTableGyroHardwareLpf[] = {
+    "NORMAL",
+    "1KHZ_SAMPLING",
+
+
+
+};
+# 264 "./src/main/cli/settings.c"
+static const char * const lookupTablePwmProtocol[] = {
+    "OFF", "ONESHOT125", "ONESHOT42", "MULTISHOT", "BRUSHED",
+
+
+
+};
+
+static const char * const lookupTableRcInterpolation[] = {
+    "OFF", "PRESET", "AUTO", "MANUAL"
+};
+
+static const char * const lookupTableRcInterpolationChannels[] = {
+    "RP", "RPY", "RPYT", "T", "RPT",
+};
+
+static const char * const lookupTableLowpassType[] = {
+    "PT1",
+    "BIQUAD",
+};
+
+static const char * const lookupTableDtermLowpassType[] = {
+    "PT1",
+    "BIQUAD",
+};
+
+static const char * const lookupTableAntiGravityMode[] = {
+    "SMOOTH",
+    "STEP",
+};
+
+static const char * const lookupTableFailsafe[] = {
+    "AUTO-LAND", "DROP", "GPS-RESCUE"
+};
+
+static const char * const lookupTableFailsafeSwitchMode[] = {
+    "STAGE1", "KILL", "STAGE2"
+};
+
+static const char * const lookupTableBusType[] = {
+    "NONE", "I2C", "SPI", "SLAVE",
+
+
+
+};
+# 322 "./src/main/cli/settings.c"
+static const char * const lookupTableGyroOverflowCheck[] = {
+    "OFF", "YAW", "ALL"
+};
+
+
+static const char * const lookupTableRatesType[] = {
+    "BETAFLIGHT", "RACEFLIGHT"
+};
+# 350 "./src/main/cli/settings.c"
+static const char * const lookupTableThrottleLimitType[] = {
+    "OFF", "SCALE", "CLIP"
+};
+# 368 "./src/main/cli/settings.c"
+static const char * const lookupTableItermRelax[] = {
+    "OFF", "RP", "RPY", "RP_INC", "RPY_INC"
+};
+static const char * const lookupTableItermRelaxType[] = {
+    "GYRO", "SETPOINT"
+};
+
+
+
+static const char * const lookupTableAcroTrainerDebug[] = {
+    "ROLL", "PITCH"
+};
+
+
+
+static const char * const lookupTableRcSmoothingType[] = {
+    "INTERPOLATION", "FILTER", "SPLINE"
+};
+static const char * const lookupTableRcSmoothingDebug[] = {
+    "ROLL", "PITCH", "YAW", "THROTTLE"
+};
+static const char * const lookupTableRcSmoothingInputType[] = {
+    "PT1", "BIQUAD"
+};
+static const char * const lookupTableRcSmoothingDerivativeType[] = {
+    "OFF", "PT1", "BIQUAD"
+};
+# 439 "./src/main/cli/settings.c"
+const char * const lookupTableLedstripColors[COLOR_COUNT] = {
+    "BLACK",
+    "WHITE",
+    "RED",
+    "ORANGE",
+    "YELLOW",
+    "LIME_GREEN",
+    "GREEN",
+    "MINT_GREEN",
+    "CYAN",
+    "LIGHT_BLUE",
+    "BLUE",
+    "DARK_VIOLET",
+    "MAGENTA",
+    "DEEP_PINK"
+};
+
+static const char * const lookupTableGyroFilterDebug[] = {
+    "ROLL", "PITCH", "YAW"
+};
+
+
+
+const lookupTableEntry_t lookupTables[] = {
+    { lookupTableOffOn, (sizeof(lookupTableOffOn) / sizeof((lookupTableOffOn)[0])) },
+    { lookupTableUnit, (sizeof(lookupTableUnit) / sizeof((lookupTableUnit)[0])) },
+    { lookupTableAlignment, (sizeof(lookupTableAlignment) / sizeof((lookupTableAlignment)[0])) },
+# 474 "./src/main/cli/settings.c"
+    { lookupTableBlackboxDevice, (sizeof(lookupTableBlackboxDevice) / sizeof((lookupTableBlackboxDevice)[0])) },
+    { lookupTableBlackboxMode, (sizeof(lookupTableBlackboxMode) / sizeof((lookupTableBlackboxMode)[0])) },
+
+    { currentMeterSourceNames, (sizeof(currentMeterSourceNames) / sizeof((currentMeterSourceNames)[0])) },
+    { voltageMeterSourceNames, (sizeof(voltageMeterSourceNames) / sizeof((voltageMeterSourceNames)[0])) },
+
+    { lookupTableGimbalMode, (sizeof(lookupTableGimbalMode) / sizeof((lookupTableGimbalMode)[0])) },
+
+
+
+
+
+
+
+    { lookupTableGyroHardwareLpf, (sizeof(lookupTableGyroHardwareLpf) / sizeof((lookupTableGyroHardwareLpf)[0])) },
+    { lookupTableAccHardware, (sizeof(lookupTableAccHardware) / sizeof((lookupTableAccHardware)[0])) },
+
+    { lookupTableBaroHardware, (sizeof(lookupTableBaroHardware) / sizeof((lookupTableBaroHardware)[0])) },
+
+
+    { lookupTableMagHardware, (sizeof(lookupTableMagHardware) / sizeof((lookupTableMagHardware)[0])) },
+
+    { debugModeNames, (sizeof(debugModeNames) / sizeof((debugModeNames)[0])) },
+    { lookupTablePwmProtocol, (sizeof(lookupTablePwmProtocol) / sizeof((lookupTablePwmProtocol)[0])) },
+    { lookupTableRcInterpolation, (sizeof(lookupTableRcInterpolation) / sizeof((lookupTableRcInterpolation)[0])) },
+    { lookupTableRcInterpolationChannels, (sizeof(lookupTableRcInterpolationChannels) / sizeof((lookupTableRcInterpolationChannels)[0])) },
+    { lookupTableLowpassType, (sizeof(lookupTableLowpassType) / sizeof((lookupTableLowpassType)[0])) },
+    { lookupTableDtermLowpassType, (sizeof(lookupTableDtermLowpassType) / sizeof((lookupTableDtermLowpassType)[0])) },
+    { lookupTableAntiGravityMode, (sizeof(lookupTableAntiGravityMode) / sizeof((lookupTableAntiGravityMode)[0])) },
+    { lookupTableFailsafe, (sizeof(lookupTableFailsafe) / sizeof((lookupTableFailsafe)[0])) },
+    { lookupTableFailsafeSwitchMode, (sizeof(lookupTableFailsafeSwitchMode) / sizeof((lookupTableFailsafeSwitchMode)[0])) },
+    { lookupTableCrashRecovery, (sizeof(lookupTableCrashRecovery) / sizeof((lookupTableCrashRecovery)[0])) },
+
+
+
+    { lookupTableBusType, (sizeof(lookupTableBusType) / sizeof((lookupTableBusType)[0])) },
+# 520 "./src/main/cli/settings.c"
+    { lookupTableGyroOverflowCheck, (sizeof(lookupTableGyroOverflowCheck) / sizeof((lookupTableGyroOverflowCheck)[0])) },
+
+    { lookupTableRatesType, (sizeof(lookupTableRatesType) / sizeof((lookupTableRatesType)[0])) },
+# 533 "./src/main/cli/settings.c"
+    { lookupTableThrottleLimitType, (sizeof(lookupTableThrottleLimitType) / sizeof((lookupTableThrottleLimitType)[0])) },
+
+
+
+
+    { lookupTableItermRelax, (sizeof(lookupTableItermRelax) / sizeof((lookupTableItermRelax)[0])) },
+    { lookupTableItermRelaxType, (sizeof(lookupTableItermRelaxType) / sizeof((lookupTableItermRelaxType)[0])) },
+
+
+    { lookupTableAcroTrainerDebug, (sizeof(lookupTableAcroTrainerDebug) / sizeof((lookupTableAcroTrainerDebug)[0])) },
+
+
+    { lookupTableRcSmoothingType, (sizeof(lookupTableRcSmoothingType) / sizeof((lookupTableRcSmoothingType)[0])) },
+    { lookupTableRcSmoothingDebug, (sizeof(lookupTableRcSmoothingDebug) / sizeof((lookupTableRcSmoothingDebug)[0])) },
+    { lookupTableRcSmoothingInputType, (sizeof(lookupTableRcSmoothingInputType) / sizeof((lookupTableRcSmoothingInputType)[0])) },
+    { lookupTableRcSmoothingDerivativeType, (sizeof(lookupTableRcSmoothingDerivativeType) / sizeof((lookupTableRcSmoothingDerivativeType)[0])) },
+
+
+
+
+
+
+
+    { lookupTableGyroHardware, (sizeof(lookupTableGyroHardware) / sizeof((lookupTableGyroHardware)[0])) },
+# 571 "./src/main/cli/settings.c"
+    { lookupTableGyroFilterDebug, (sizeof(lookupTableGyroFilterDebug) / sizeof((lookupTableGyroFilterDebug)[0])) },
+};
+
+
+
+const clivalue_t valueTable[] = {
+
+    { "gyro_hardware_lpf", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GYRO_HARDWARE_LPF }, 10, 
+# 578 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          __builtin_offsetof (
+# 578 "./src/main/cli/settings.c"
+                                                                                                                                          gyroConfig_t
+# 578 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          , 
+# 578 "./src/main/cli/settings.c"
+                                                                                                                                          gyro_hardware_lpf
+# 578 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          ) 
+# 578 "./src/main/cli/settings.c"
+                                                                                                                                                                                    },
+
+
+
+    { "gyro_sync_denom", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 1, 32 }, 10, 
+# 582 "./src/main/cli/settings.c" 3 4
+                                                                                                                  __builtin_offsetof (
+# 582 "./src/main/cli/settings.c"
+                                                                                                                  gyroConfig_t
+# 582 "./src/main/cli/settings.c" 3 4
+                                                                                                                  , 
+# 582 "./src/main/cli/settings.c"
+                                                                                                                  gyro_sync_denom
+# 582 "./src/main/cli/settings.c" 3 4
+                                                                                                                  ) 
+# 582 "./src/main/cli/settings.c"
+                                                                                                                                                          },
+
+    { "gyro_lowpass_type", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_LOWPASS_TYPE }, 10, 
+# 584 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 584 "./src/main/cli/settings.c"
+                                                                                                                                     gyroConfig_t
+# 584 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     , 
+# 584 "./src/main/cli/settings.c"
+                                                                                                                                     gyro_lowpass_type
+# 584 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     ) 
+# 584 "./src/main/cli/settings.c"
+                                                                                                                                                                               },
+    { "gyro_lowpass_hz", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 4000 }, 10, 
+# 585 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 585 "./src/main/cli/settings.c"
+                                                                                                                                    gyroConfig_t
+# 585 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    , 
+# 585 "./src/main/cli/settings.c"
+                                                                                                                                    gyro_lowpass_hz
+# 585 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    ) 
+# 585 "./src/main/cli/settings.c"
+                                                                                                                                                                            },
+
+    { "gyro_lowpass2_type", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_LOWPASS_TYPE }, 10, 
+# 587 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 587 "./src/main/cli/settings.c"
+                                                                                                                                     gyroConfig_t
+# 587 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     , 
+# 587 "./src/main/cli/settings.c"
+                                                                                                                                     gyro_lowpass2_type
+# 587 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     ) 
+# 587 "./src/main/cli/settings.c"
+                                                                                                                                                                                },
+    { "gyro_lowpass2_hz", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 4000 }, 10, 
+# 588 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 588 "./src/main/cli/settings.c"
+                                                                                                                                     gyroConfig_t
+# 588 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     , 
+# 588 "./src/main/cli/settings.c"
+                                                                                                                                     gyro_lowpass2_hz
+# 588 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     ) 
+# 588 "./src/main/cli/settings.c"
+                                                                                                                                                                              },
+
+    { "gyro_notch1_hz", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 4000 }, 10, 
+# 590 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 590 "./src/main/cli/settings.c"
+                                                                                                                                    gyroConfig_t
+# 590 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    , 
+# 590 "./src/main/cli/settings.c"
+                                                                                                                                    gyro_soft_notch_hz_1
+# 590 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    ) 
+# 590 "./src/main/cli/settings.c"
+                                                                                                                                                                                 },
+    { "gyro_notch1_cutoff", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 4000 }, 10, 
+# 591 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 591 "./src/main/cli/settings.c"
+                                                                                                                                    gyroConfig_t
+# 591 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    , 
+# 591 "./src/main/cli/settings.c"
+                                                                                                                                    gyro_soft_notch_cutoff_1
+# 591 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    ) 
+# 591 "./src/main/cli/settings.c"
+                                                                                                                                                                                     },
+    { "gyro_notch2_hz", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 4000 }, 10, 
+# 592 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 592 "./src/main/cli/settings.c"
+                                                                                                                                    gyroConfig_t
+# 592 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    , 
+# 592 "./src/main/cli/settings.c"
+                                                                                                                                    gyro_soft_notch_hz_2
+# 592 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    ) 
+# 592 "./src/main/cli/settings.c"
+                                                                                                                                                                                 },
+    { "gyro_notch2_cutoff", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 4000 }, 10, 
+# 593 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 593 "./src/main/cli/settings.c"
+                                                                                                                                    gyroConfig_t
+# 593 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    , 
+# 593 "./src/main/cli/settings.c"
+                                                                                                                                    gyro_soft_notch_cutoff_2
+# 593 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    ) 
+# 593 "./src/main/cli/settings.c"
+                                                                                                                                                                                     },
+
+    { "gyro_calib_duration", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 50, 3000 }, 10, 
+# 595 "./src/main/cli/settings.c" 3 4
+                                                                                                                      __builtin_offsetof (
+# 595 "./src/main/cli/settings.c"
+                                                                                                                      gyroConfig_t
+# 595 "./src/main/cli/settings.c" 3 4
+                                                                                                                      , 
+# 595 "./src/main/cli/settings.c"
+                                                                                                                      gyroCalibrationDuration
+# 595 "./src/main/cli/settings.c" 3 4
+                                                                                                                      ) 
+# 595 "./src/main/cli/settings.c"
+                                                                                                                                                                      },
+    { "gyro_calib_noise_limit", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 200 }, 10, 
+# 596 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 596 "./src/main/cli/settings.c"
+                                                                                                                    gyroConfig_t
+# 596 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 596 "./src/main/cli/settings.c"
+                                                                                                                    gyroMovementCalibrationThreshold
+# 596 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 596 "./src/main/cli/settings.c"
+                                                                                                                                                                             },
+    { "gyro_offset_yaw", VAR_INT16 | MASTER_VALUE, .config.minmax = { -1000, 1000 }, 10, 
+# 597 "./src/main/cli/settings.c" 3 4
+                                                                                                                __builtin_offsetof (
+# 597 "./src/main/cli/settings.c"
+                                                                                                                gyroConfig_t
+# 597 "./src/main/cli/settings.c" 3 4
+                                                                                                                , 
+# 597 "./src/main/cli/settings.c"
+                                                                                                                gyro_offset_yaw
+# 597 "./src/main/cli/settings.c" 3 4
+                                                                                                                ) 
+# 597 "./src/main/cli/settings.c"
+                                                                                                                                                        },
+
+    { "gyro_overflow_detect", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GYRO_OVERFLOW_CHECK }, 10, 
+# 599 "./src/main/cli/settings.c" 3 4
+                                                                                                                                            __builtin_offsetof (
+# 599 "./src/main/cli/settings.c"
+                                                                                                                                            gyroConfig_t
+# 599 "./src/main/cli/settings.c" 3 4
+                                                                                                                                            , 
+# 599 "./src/main/cli/settings.c"
+                                                                                                                                            checkOverflow
+# 599 "./src/main/cli/settings.c" 3 4
+                                                                                                                                            ) 
+# 599 "./src/main/cli/settings.c"
+                                                                                                                                                                                  },
+# 622 "./src/main/cli/settings.c"
+    { "gyro_filter_debug_axis", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GYRO_FILTER_DEBUG }, 10, 
+# 622 "./src/main/cli/settings.c" 3 4
+                                                                                                                                         __builtin_offsetof (
+# 622 "./src/main/cli/settings.c"
+                                                                                                                                         gyroConfig_t
+# 622 "./src/main/cli/settings.c" 3 4
+                                                                                                                                         , 
+# 622 "./src/main/cli/settings.c"
+                                                                                                                                         gyro_filter_debug_axis
+# 622 "./src/main/cli/settings.c" 3 4
+                                                                                                                                         ) 
+# 622 "./src/main/cli/settings.c"
+                                                                                                                                                                                        },
+
+
+
+    { "acc_hardware", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ACC_HARDWARE }, 35, 
+# 626 "./src/main/cli/settings.c" 3 4
+                                                                                                                                              __builtin_offsetof (
+# 626 "./src/main/cli/settings.c"
+                                                                                                                                              accelerometerConfig_t
+# 626 "./src/main/cli/settings.c" 3 4
+                                                                                                                                              , 
+# 626 "./src/main/cli/settings.c"
+                                                                                                                                              acc_hardware
+# 626 "./src/main/cli/settings.c" 3 4
+                                                                                                                                              ) 
+# 626 "./src/main/cli/settings.c"
+                                                                                                                                                                                            },
+
+
+
+    { "acc_lpf_hz", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 400 }, 35, 
+# 630 "./src/main/cli/settings.c" 3 4
+                                                                                                                            __builtin_offsetof (
+# 630 "./src/main/cli/settings.c"
+                                                                                                                            accelerometerConfig_t
+# 630 "./src/main/cli/settings.c" 3 4
+                                                                                                                            , 
+# 630 "./src/main/cli/settings.c"
+                                                                                                                            acc_lpf_hz
+# 630 "./src/main/cli/settings.c" 3 4
+                                                                                                                            ) 
+# 630 "./src/main/cli/settings.c"
+                                                                                                                                                                        },
+    { "acc_trim_pitch", VAR_INT16 | MASTER_VALUE, .config.minmax = { -300, 300 }, 35, 
+# 631 "./src/main/cli/settings.c" 3 4
+                                                                                                                       __builtin_offsetof (
+# 631 "./src/main/cli/settings.c"
+                                                                                                                       accelerometerConfig_t
+# 631 "./src/main/cli/settings.c" 3 4
+                                                                                                                       , 
+# 631 "./src/main/cli/settings.c"
+                                                                                                                       accelerometerTrims.values.pitch
+# 631 "./src/main/cli/settings.c" 3 4
+                                                                                                                       ) 
+# 631 "./src/main/cli/settings.c"
+                                                                                                                                                                                        },
+    { "acc_trim_roll", VAR_INT16 | MASTER_VALUE, .config.minmax = { -300, 300 }, 35, 
+# 632 "./src/main/cli/settings.c" 3 4
+                                                                                                                       __builtin_offsetof (
+# 632 "./src/main/cli/settings.c"
+                                                                                                                       accelerometerConfig_t
+# 632 "./src/main/cli/settings.c" 3 4
+                                                                                                                       , 
+# 632 "./src/main/cli/settings.c"
+                                                                                                                       accelerometerTrims.values.roll
+# 632 "./src/main/cli/settings.c" 3 4
+                                                                                                                       ) 
+# 632 "./src/main/cli/settings.c"
+                                                                                                                                                                                       },
+    { "acc_calibration", VAR_INT16 | MASTER_VALUE | MODE_ARRAY, .config.array.length = 3, 35, 
+# 633 "./src/main/cli/settings.c" 3 4
+                                                                                                                                           __builtin_offsetof (
+# 633 "./src/main/cli/settings.c"
+                                                                                                                                           accelerometerConfig_t
+# 633 "./src/main/cli/settings.c" 3 4
+                                                                                                                                           , 
+# 633 "./src/main/cli/settings.c"
+                                                                                                                                           accZero.raw
+# 633 "./src/main/cli/settings.c" 3 4
+                                                                                                                                           ) 
+# 633 "./src/main/cli/settings.c"
+                                                                                                                                                                                        },
+
+
+
+
+    { "align_mag", VAR_UINT8 | HARDWARE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, 40, 
+# 638 "./src/main/cli/settings.c" 3 4
+                                                                                                                                       __builtin_offsetof (
+# 638 "./src/main/cli/settings.c"
+                                                                                                                                       compassConfig_t
+# 638 "./src/main/cli/settings.c" 3 4
+                                                                                                                                       , 
+# 638 "./src/main/cli/settings.c"
+                                                                                                                                       mag_align
+# 638 "./src/main/cli/settings.c" 3 4
+                                                                                                                                       ) 
+# 638 "./src/main/cli/settings.c"
+                                                                                                                                                                            },
+    { "mag_bustype", VAR_UINT8 | HARDWARE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BUS_TYPE }, 40, 
+# 639 "./src/main/cli/settings.c" 3 4
+                                                                                                                                      __builtin_offsetof (
+# 639 "./src/main/cli/settings.c"
+                                                                                                                                      compassConfig_t
+# 639 "./src/main/cli/settings.c" 3 4
+                                                                                                                                      , 
+# 639 "./src/main/cli/settings.c"
+                                                                                                                                      mag_bustype
+# 639 "./src/main/cli/settings.c" 3 4
+                                                                                                                                      ) 
+# 639 "./src/main/cli/settings.c"
+                                                                                                                                                                             },
+    { "mag_i2c_device", VAR_UINT8 | HARDWARE_VALUE, .config.minmaxUnsigned = { 0, 4 }, 40, 
+# 640 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 __builtin_offsetof (
+# 640 "./src/main/cli/settings.c"
+                                                                                                                                 compassConfig_t
+# 640 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 , 
+# 640 "./src/main/cli/settings.c"
+                                                                                                                                 mag_i2c_device
+# 640 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 ) 
+# 640 "./src/main/cli/settings.c"
+                                                                                                                                                                           },
+    { "mag_i2c_address", VAR_UINT8 | HARDWARE_VALUE, .config.minmaxUnsigned = { 0, 119 }, 40, 
+# 641 "./src/main/cli/settings.c" 3 4
+                                                                                                                                  __builtin_offsetof (
+# 641 "./src/main/cli/settings.c"
+                                                                                                                                  compassConfig_t
+# 641 "./src/main/cli/settings.c" 3 4
+                                                                                                                                  , 
+# 641 "./src/main/cli/settings.c"
+                                                                                                                                  mag_i2c_address
+# 641 "./src/main/cli/settings.c" 3 4
+                                                                                                                                  ) 
+# 641 "./src/main/cli/settings.c"
+                                                                                                                                                                             },
+    { "mag_spi_device", VAR_UINT8 | HARDWARE_VALUE, .config.minmaxUnsigned = { 0, 4 }, 40, 
+# 642 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 __builtin_offsetof (
+# 642 "./src/main/cli/settings.c"
+                                                                                                                                 compassConfig_t
+# 642 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 , 
+# 642 "./src/main/cli/settings.c"
+                                                                                                                                 mag_spi_device
+# 642 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 ) 
+# 642 "./src/main/cli/settings.c"
+                                                                                                                                                                           },
+    { "mag_hardware", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_MAG_HARDWARE }, 40, 
+# 643 "./src/main/cli/settings.c" 3 4
+                                                                                                                                        __builtin_offsetof (
+# 643 "./src/main/cli/settings.c"
+                                                                                                                                        compassConfig_t
+# 643 "./src/main/cli/settings.c" 3 4
+                                                                                                                                        , 
+# 643 "./src/main/cli/settings.c"
+                                                                                                                                        mag_hardware
+# 643 "./src/main/cli/settings.c" 3 4
+                                                                                                                                        ) 
+# 643 "./src/main/cli/settings.c"
+                                                                                                                                                                                },
+    { "mag_declination", VAR_INT16 | MASTER_VALUE, .config.minmax = { -18000, 18000 }, 40, 
+# 644 "./src/main/cli/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 644 "./src/main/cli/settings.c"
+                                                                                                                     compassConfig_t
+# 644 "./src/main/cli/settings.c" 3 4
+                                                                                                                     , 
+# 644 "./src/main/cli/settings.c"
+                                                                                                                     mag_declination
+# 644 "./src/main/cli/settings.c" 3 4
+                                                                                                                     ) 
+# 644 "./src/main/cli/settings.c"
+                                                                                                                                                                },
+    { "mag_calibration", VAR_INT16 | MASTER_VALUE | MODE_ARRAY, .config.array.length = 3, 40, 
+# 645 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 645 "./src/main/cli/settings.c"
+                                                                                                                                     compassConfig_t
+# 645 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     , 
+# 645 "./src/main/cli/settings.c"
+                                                                                                                                     magZero.raw
+# 645 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     ) 
+# 645 "./src/main/cli/settings.c"
+                                                                                                                                                                            },
+
+
+
+
+    { "baro_bustype", VAR_UINT8 | HARDWARE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BUS_TYPE }, 38, 
+# 650 "./src/main/cli/settings.c" 3 4
+                                                                                                                                        __builtin_offsetof (
+# 650 "./src/main/cli/settings.c"
+                                                                                                                                        barometerConfig_t
+# 650 "./src/main/cli/settings.c" 3 4
+                                                                                                                                        , 
+# 650 "./src/main/cli/settings.c"
+                                                                                                                                        baro_bustype
+# 650 "./src/main/cli/settings.c" 3 4
+                                                                                                                                        ) 
+# 650 "./src/main/cli/settings.c"
+                                                                                                                                                                                  },
+    { "baro_spi_device", VAR_UINT8 | HARDWARE_VALUE, .config.minmaxUnsigned = { 0, 5 }, 38, 
+# 651 "./src/main/cli/settings.c" 3 4
+                                                                                                                        __builtin_offsetof (
+# 651 "./src/main/cli/settings.c"
+                                                                                                                        barometerConfig_t
+# 651 "./src/main/cli/settings.c" 3 4
+                                                                                                                        , 
+# 651 "./src/main/cli/settings.c"
+                                                                                                                        baro_spi_device
+# 651 "./src/main/cli/settings.c" 3 4
+                                                                                                                        ) 
+# 651 "./src/main/cli/settings.c"
+                                                                                                                                                                     },
+    { "baro_i2c_device", VAR_UINT8 | HARDWARE_VALUE, .config.minmaxUnsigned = { 0, 5 }, 38, 
+# 652 "./src/main/cli/settings.c" 3 4
+                                                                                                                        __builtin_offsetof (
+# 652 "./src/main/cli/settings.c"
+                                                                                                                        barometerConfig_t
+# 652 "./src/main/cli/settings.c" 3 4
+                                                                                                                        , 
+# 652 "./src/main/cli/settings.c"
+                                                                                                                        baro_i2c_device
+# 652 "./src/main/cli/settings.c" 3 4
+                                                                                                                        ) 
+# 652 "./src/main/cli/settings.c"
+                                                                                                                                                                     },
+    { "baro_i2c_address", VAR_UINT8 | HARDWARE_VALUE, .config.minmaxUnsigned = { 0, 119 }, 38, 
+# 653 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 653 "./src/main/cli/settings.c"
+                                                                                                                                    barometerConfig_t
+# 653 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    , 
+# 653 "./src/main/cli/settings.c"
+                                                                                                                                    baro_i2c_address
+# 653 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    ) 
+# 653 "./src/main/cli/settings.c"
+                                                                                                                                                                                  },
+    { "baro_hardware", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BARO_HARDWARE }, 38, 
+# 654 "./src/main/cli/settings.c" 3 4
+                                                                                                                                           __builtin_offsetof (
+# 654 "./src/main/cli/settings.c"
+                                                                                                                                           barometerConfig_t
+# 654 "./src/main/cli/settings.c" 3 4
+                                                                                                                                           , 
+# 654 "./src/main/cli/settings.c"
+                                                                                                                                           baro_hardware
+# 654 "./src/main/cli/settings.c" 3 4
+                                                                                                                                           ) 
+# 654 "./src/main/cli/settings.c"
+                                                                                                                                                                                      },
+    { "baro_tab_size", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 48 }, 38, 
+# 655 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          __builtin_offsetof (
+# 655 "./src/main/cli/settings.c"
+                                                                                                                                          barometerConfig_t
+# 655 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          , 
+# 655 "./src/main/cli/settings.c"
+                                                                                                                                          baro_sample_count
+# 655 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          ) 
+# 655 "./src/main/cli/settings.c"
+                                                                                                                                                                                         },
+    { "baro_noise_lpf", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 1000 }, 38, 
+# 656 "./src/main/cli/settings.c" 3 4
+                                                                                                                          __builtin_offsetof (
+# 656 "./src/main/cli/settings.c"
+                                                                                                                          barometerConfig_t
+# 656 "./src/main/cli/settings.c" 3 4
+                                                                                                                          , 
+# 656 "./src/main/cli/settings.c"
+                                                                                                                          baro_noise_lpf
+# 656 "./src/main/cli/settings.c" 3 4
+                                                                                                                          ) 
+# 656 "./src/main/cli/settings.c"
+                                                                                                                                                                      },
+    { "baro_cf_vel", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 1000 }, 38, 
+# 657 "./src/main/cli/settings.c" 3 4
+                                                                                                                          __builtin_offsetof (
+# 657 "./src/main/cli/settings.c"
+                                                                                                                          barometerConfig_t
+# 657 "./src/main/cli/settings.c" 3 4
+                                                                                                                          , 
+# 657 "./src/main/cli/settings.c"
+                                                                                                                          baro_cf_vel
+# 657 "./src/main/cli/settings.c" 3 4
+                                                                                                                          ) 
+# 657 "./src/main/cli/settings.c"
+                                                                                                                                                                   },
+    { "baro_stroke_sync", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 38, 
+# 658 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 658 "./src/main/cli/settings.c"
+                                                                                                                                    barometerConfig_t
+# 658 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    , 
+# 658 "./src/main/cli/settings.c"
+                                                                                                                                    baro_stroke_sync
+# 658 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    ) 
+# 658 "./src/main/cli/settings.c"
+                                                                                                                                                                                  },
+
+
+
+    { "mid_rc", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 1200, 1700 }, 24, 
+# 662 "./src/main/cli/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 662 "./src/main/cli/settings.c"
+                                                                                                                     rxConfig_t
+# 662 "./src/main/cli/settings.c" 3 4
+                                                                                                                     , 
+# 662 "./src/main/cli/settings.c"
+                                                                                                                     midrc
+# 662 "./src/main/cli/settings.c" 3 4
+                                                                                                                     ) 
+# 662 "./src/main/cli/settings.c"
+                                                                                                                                                 },
+    { "min_check", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 750, 2250 }, 24, 
+# 663 "./src/main/cli/settings.c" 3 4
+                                                                                                                                       __builtin_offsetof (
+# 663 "./src/main/cli/settings.c"
+                                                                                                                                       rxConfig_t
+# 663 "./src/main/cli/settings.c" 3 4
+                                                                                                                                       , 
+# 663 "./src/main/cli/settings.c"
+                                                                                                                                       mincheck
+# 663 "./src/main/cli/settings.c" 3 4
+                                                                                                                                       ) 
+# 663 "./src/main/cli/settings.c"
+                                                                                                                                                                      },
+    { "max_check", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 750, 2250 }, 24, 
+# 664 "./src/main/cli/settings.c" 3 4
+                                                                                                                                       __builtin_offsetof (
+# 664 "./src/main/cli/settings.c"
+                                                                                                                                       rxConfig_t
+# 664 "./src/main/cli/settings.c" 3 4
+                                                                                                                                       , 
+# 664 "./src/main/cli/settings.c"
+                                                                                                                                       maxcheck
+# 664 "./src/main/cli/settings.c" 3 4
+                                                                                                                                       ) 
+# 664 "./src/main/cli/settings.c"
+                                                                                                                                                                      },
+    { "rssi_channel", VAR_INT8 | MASTER_VALUE, .config.minmax = { 0, 18 }, 24, 
+# 665 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 665 "./src/main/cli/settings.c"
+                                                                                                                                    rxConfig_t
+# 665 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    , 
+# 665 "./src/main/cli/settings.c"
+                                                                                                                                    rssi_channel
+# 665 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    ) 
+# 665 "./src/main/cli/settings.c"
+                                                                                                                                                                       },
+    { "rssi_src_frame_errors", VAR_INT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 24, 
+# 666 "./src/main/cli/settings.c" 3 4
+                                                                                                                             __builtin_offsetof (
+# 666 "./src/main/cli/settings.c"
+                                                                                                                             rxConfig_t
+# 666 "./src/main/cli/settings.c" 3 4
+                                                                                                                             , 
+# 666 "./src/main/cli/settings.c"
+                                                                                                                             rssi_src_frame_errors
+# 666 "./src/main/cli/settings.c" 3 4
+                                                                                                                             ) 
+# 666 "./src/main/cli/settings.c"
+                                                                                                                                                                         },
+    { "rssi_scale", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 1, 255 }, 24, 
+# 667 "./src/main/cli/settings.c" 3 4
+                                                                                                                                         __builtin_offsetof (
+# 667 "./src/main/cli/settings.c"
+                                                                                                                                         rxConfig_t
+# 667 "./src/main/cli/settings.c" 3 4
+                                                                                                                                         , 
+# 667 "./src/main/cli/settings.c"
+                                                                                                                                         rssi_scale
+# 667 "./src/main/cli/settings.c" 3 4
+                                                                                                                                         ) 
+# 667 "./src/main/cli/settings.c"
+                                                                                                                                                                          },
+    { "rssi_offset", VAR_INT8 | MASTER_VALUE, .config.minmax = { -100, 100 }, 24, 
+# 668 "./src/main/cli/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 668 "./src/main/cli/settings.c"
+                                                                                                            rxConfig_t
+# 668 "./src/main/cli/settings.c" 3 4
+                                                                                                            , 
+# 668 "./src/main/cli/settings.c"
+                                                                                                            rssi_offset
+# 668 "./src/main/cli/settings.c" 3 4
+                                                                                                            ) 
+# 668 "./src/main/cli/settings.c"
+                                                                                                                                              },
+    { "rssi_invert", VAR_INT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 24, 
+# 669 "./src/main/cli/settings.c" 3 4
+                                                                                                                             __builtin_offsetof (
+# 669 "./src/main/cli/settings.c"
+                                                                                                                             rxConfig_t
+# 669 "./src/main/cli/settings.c" 3 4
+                                                                                                                             , 
+# 669 "./src/main/cli/settings.c"
+                                                                                                                             rssi_invert
+# 669 "./src/main/cli/settings.c" 3 4
+                                                                                                                             ) 
+# 669 "./src/main/cli/settings.c"
+                                                                                                                                                               },
+    { "rc_interp", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RC_INTERPOLATION }, 24, 
+# 670 "./src/main/cli/settings.c" 3 4
+                                                                                                                                       __builtin_offsetof (
+# 670 "./src/main/cli/settings.c"
+                                                                                                                                       rxConfig_t
+# 670 "./src/main/cli/settings.c" 3 4
+                                                                                                                                       , 
+# 670 "./src/main/cli/settings.c"
+                                                                                                                                       rcInterpolation
+# 670 "./src/main/cli/settings.c" 3 4
+                                                                                                                                       ) 
+# 670 "./src/main/cli/settings.c"
+                                                                                                                                                                             },
+    { "rc_interp_ch", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RC_INTERPOLATION_CHANNELS }, 24, 
+# 671 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                __builtin_offsetof (
+# 671 "./src/main/cli/settings.c"
+                                                                                                                                                rxConfig_t
+# 671 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                , 
+# 671 "./src/main/cli/settings.c"
+                                                                                                                                                rcInterpolationChannels
+# 671 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                ) 
+# 671 "./src/main/cli/settings.c"
+                                                                                                                                                                                              },
+    { "rc_interp_int", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 1, 50 }, 24, 
+# 672 "./src/main/cli/settings.c" 3 4
+                                                                                                                __builtin_offsetof (
+# 672 "./src/main/cli/settings.c"
+                                                                                                                rxConfig_t
+# 672 "./src/main/cli/settings.c" 3 4
+                                                                                                                , 
+# 672 "./src/main/cli/settings.c"
+                                                                                                                rcInterpolationInterval
+# 672 "./src/main/cli/settings.c" 3 4
+                                                                                                                ) 
+# 672 "./src/main/cli/settings.c"
+                                                                                                                                                              },
+
+
+    { "rc_smoothing_type", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RC_SMOOTHING_TYPE }, 24, 
+# 675 "./src/main/cli/settings.c" 3 4
+                                                                                                                                        __builtin_offsetof (
+# 675 "./src/main/cli/settings.c"
+                                                                                                                                        rxConfig_t
+# 675 "./src/main/cli/settings.c" 3 4
+                                                                                                                                        , 
+# 675 "./src/main/cli/settings.c"
+                                                                                                                                        rc_smoothing_type
+# 675 "./src/main/cli/settings.c" 3 4
+                                                                                                                                        ) 
+# 675 "./src/main/cli/settings.c"
+                                                                                                                                                                                },
+    { "rc_smoothing_input_hz", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 
+# 676 "./src/main/cli/settings.c" 3 4
+                                                                                            (255) 
+# 676 "./src/main/cli/settings.c"
+                                                                                                      }, 24, 
+# 676 "./src/main/cli/settings.c" 3 4
+                                                                                                                       __builtin_offsetof (
+# 676 "./src/main/cli/settings.c"
+                                                                                                                       rxConfig_t
+# 676 "./src/main/cli/settings.c" 3 4
+                                                                                                                       , 
+# 676 "./src/main/cli/settings.c"
+                                                                                                                       rc_smoothing_input_cutoff
+# 676 "./src/main/cli/settings.c" 3 4
+                                                                                                                       ) 
+# 676 "./src/main/cli/settings.c"
+                                                                                                                                                                       },
+    { "rc_smoothing_derivative_hz", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 
+# 677 "./src/main/cli/settings.c" 3 4
+                                                                                            (255) 
+# 677 "./src/main/cli/settings.c"
+                                                                                                      }, 24, 
+# 677 "./src/main/cli/settings.c" 3 4
+                                                                                                                       __builtin_offsetof (
+# 677 "./src/main/cli/settings.c"
+                                                                                                                       rxConfig_t
+# 677 "./src/main/cli/settings.c" 3 4
+                                                                                                                       , 
+# 677 "./src/main/cli/settings.c"
+                                                                                                                       rc_smoothing_derivative_cutoff
+# 677 "./src/main/cli/settings.c" 3 4
+                                                                                                                       ) 
+# 677 "./src/main/cli/settings.c"
+                                                                                                                                                                            },
+    { "rc_smoothing_debug_axis", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RC_SMOOTHING_DEBUG }, 24, 
+# 678 "./src/main/cli/settings.c" 3 4
+                                                                                                                                         __builtin_offsetof (
+# 678 "./src/main/cli/settings.c"
+                                                                                                                                         rxConfig_t
+# 678 "./src/main/cli/settings.c" 3 4
+                                                                                                                                         , 
+# 678 "./src/main/cli/settings.c"
+                                                                                                                                         rc_smoothing_debug_axis
+# 678 "./src/main/cli/settings.c" 3 4
+                                                                                                                                         ) 
+# 678 "./src/main/cli/settings.c"
+                                                                                                                                                                                       },
+    { "rc_smoothing_input_type", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RC_SMOOTHING_INPUT_TYPE }, 24, 
+# 679 "./src/main/cli/settings.c" 3 4
+                                                                                                                                              __builtin_offsetof (
+# 679 "./src/main/cli/settings.c"
+                                                                                                                                              rxConfig_t
+# 679 "./src/main/cli/settings.c" 3 4
+                                                                                                                                              , 
+# 679 "./src/main/cli/settings.c"
+                                                                                                                                              rc_smoothing_input_type
+# 679 "./src/main/cli/settings.c" 3 4
+                                                                                                                                              ) 
+# 679 "./src/main/cli/settings.c"
+                                                                                                                                                                                            },
+    { "rc_smoothing_derivative_type",VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RC_SMOOTHING_DERIVATIVE_TYPE }, 24, 
+# 680 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                    __builtin_offsetof (
+# 680 "./src/main/cli/settings.c"
+                                                                                                                                                    rxConfig_t
+# 680 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                    , 
+# 680 "./src/main/cli/settings.c"
+                                                                                                                                                    rc_smoothing_derivative_type
+# 680 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                    ) 
+# 680 "./src/main/cli/settings.c"
+                                                                                                                                                                                                       },
+    { "rc_smoothing_auto_smoothness",VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 50 }, 24, 
+# 681 "./src/main/cli/settings.c" 3 4
+                                                                                                                 __builtin_offsetof (
+# 681 "./src/main/cli/settings.c"
+                                                                                                                 rxConfig_t
+# 681 "./src/main/cli/settings.c" 3 4
+                                                                                                                 , 
+# 681 "./src/main/cli/settings.c"
+                                                                                                                 rc_smoothing_auto_factor
+# 681 "./src/main/cli/settings.c" 3 4
+                                                                                                                 ) 
+# 681 "./src/main/cli/settings.c"
+                                                                                                                                                                },
+
+
+    { "fpv_mix_degrees", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 90 }, 24, 
+# 684 "./src/main/cli/settings.c" 3 4
+                                                                                                                __builtin_offsetof (
+# 684 "./src/main/cli/settings.c"
+                                                                                                                rxConfig_t
+# 684 "./src/main/cli/settings.c" 3 4
+                                                                                                                , 
+# 684 "./src/main/cli/settings.c"
+                                                                                                                fpvCamAngleDegrees
+# 684 "./src/main/cli/settings.c" 3 4
+                                                                                                                ) 
+# 684 "./src/main/cli/settings.c"
+                                                                                                                                                         },
+    { "max_aux_channels", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, (18 - 4) }, 24, 
+# 685 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   __builtin_offsetof (
+# 685 "./src/main/cli/settings.c"
+                                                                                                                                   rxConfig_t
+# 685 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   , 
+# 685 "./src/main/cli/settings.c"
+                                                                                                                                   max_aux_channel
+# 685 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   ) 
+# 685 "./src/main/cli/settings.c"
+                                                                                                                                                                         },
+# 694 "./src/main/cli/settings.c"
+    { "airmode_start_throttle_percent", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 100 }, 24, 
+# 694 "./src/main/cli/settings.c" 3 4
+                                                                                                                        __builtin_offsetof (
+# 694 "./src/main/cli/settings.c"
+                                                                                                                        rxConfig_t
+# 694 "./src/main/cli/settings.c" 3 4
+                                                                                                                        , 
+# 694 "./src/main/cli/settings.c"
+                                                                                                                        airModeActivateThreshold
+# 694 "./src/main/cli/settings.c" 3 4
+                                                                                                                        ) 
+# 694 "./src/main/cli/settings.c"
+                                                                                                                                                                       },
+    { "rx_min_usec", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 750, 2250 }, 24, 
+# 695 "./src/main/cli/settings.c" 3 4
+                                                                                                                                       __builtin_offsetof (
+# 695 "./src/main/cli/settings.c"
+                                                                                                                                       rxConfig_t
+# 695 "./src/main/cli/settings.c" 3 4
+                                                                                                                                       , 
+# 695 "./src/main/cli/settings.c"
+                                                                                                                                       rx_min_usec
+# 695 "./src/main/cli/settings.c" 3 4
+                                                                                                                                       ) 
+# 695 "./src/main/cli/settings.c"
+                                                                                                                                                                         },
+    { "rx_max_usec", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 750, 2250 }, 24, 
+# 696 "./src/main/cli/settings.c" 3 4
+                                                                                                                                       __builtin_offsetof (
+# 696 "./src/main/cli/settings.c"
+                                                                                                                                       rxConfig_t
+# 696 "./src/main/cli/settings.c" 3 4
+                                                                                                                                       , 
+# 696 "./src/main/cli/settings.c"
+                                                                                                                                       rx_max_usec
+# 696 "./src/main/cli/settings.c" 3 4
+                                                                                                                                       ) 
+# 696 "./src/main/cli/settings.c"
+                                                                                                                                                                         },
+    { "serialrx_halfduplex", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 24, 
+# 697 "./src/main/cli/settings.c" 3 4
+                                                                                                                             __builtin_offsetof (
+# 697 "./src/main/cli/settings.c"
+                                                                                                                             rxConfig_t
+# 697 "./src/main/cli/settings.c" 3 4
+                                                                                                                             , 
+# 697 "./src/main/cli/settings.c"
+                                                                                                                             halfDuplex
+# 697 "./src/main/cli/settings.c" 3 4
+                                                                                                                             ) 
+# 697 "./src/main/cli/settings.c"
+                                                                                                                                                              },
+# 719 "./src/main/cli/settings.c"
+    { "blackbox_p_ratio", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 
+# 719 "./src/main/cli/settings.c" 3 4
+                                                                                            (32767) 
+# 719 "./src/main/cli/settings.c"
+                                                                                                      }, 5, 
+# 719 "./src/main/cli/settings.c" 3 4
+                                                                                                                             __builtin_offsetof (
+# 719 "./src/main/cli/settings.c"
+                                                                                                                             blackboxConfig_t
+# 719 "./src/main/cli/settings.c" 3 4
+                                                                                                                             , 
+# 719 "./src/main/cli/settings.c"
+                                                                                                                             p_ratio
+# 719 "./src/main/cli/settings.c" 3 4
+                                                                                                                             ) 
+# 719 "./src/main/cli/settings.c"
+                                                                                                                                                                 },
+    { "blackbox_device", VAR_UINT8 | HARDWARE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_DEVICE }, 5, 
+# 720 "./src/main/cli/settings.c" 3 4
+                                                                                                                                              __builtin_offsetof (
+# 720 "./src/main/cli/settings.c"
+                                                                                                                                              blackboxConfig_t
+# 720 "./src/main/cli/settings.c" 3 4
+                                                                                                                                              , 
+# 720 "./src/main/cli/settings.c"
+                                                                                                                                              device
+# 720 "./src/main/cli/settings.c" 3 4
+                                                                                                                                              ) 
+# 720 "./src/main/cli/settings.c"
+                                                                                                                                                                                 },
+    { "blackbox_record_acc", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 5, 
+# 721 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   __builtin_offsetof (
+# 721 "./src/main/cli/settings.c"
+                                                                                                                                   blackboxConfig_t
+# 721 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   , 
+# 721 "./src/main/cli/settings.c"
+                                                                                                                                   record_acc
+# 721 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   ) 
+# 721 "./src/main/cli/settings.c"
+                                                                                                                                                                          },
+    { "blackbox_mode", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_MODE }, 5, 
+# 722 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          __builtin_offsetof (
+# 722 "./src/main/cli/settings.c"
+                                                                                                                                          blackboxConfig_t
+# 722 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          , 
+# 722 "./src/main/cli/settings.c"
+                                                                                                                                          mode
+# 722 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          ) 
+# 722 "./src/main/cli/settings.c"
+                                                                                                                                                                           },
+    { "blackbox_governor", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 5, 
+# 723 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   __builtin_offsetof (
+# 723 "./src/main/cli/settings.c"
+                                                                                                                                   blackboxConfig_t
+# 723 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   , 
+# 723 "./src/main/cli/settings.c"
+                                                                                                                                   governor
+# 723 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   ) 
+# 723 "./src/main/cli/settings.c"
+                                                                                                                                                                        },
+
+
+
+    { "min_throttle", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 750, 2250 }, 6, 
+# 727 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          __builtin_offsetof (
+# 727 "./src/main/cli/settings.c"
+                                                                                                                                          motorConfig_t
+# 727 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          , 
+# 727 "./src/main/cli/settings.c"
+                                                                                                                                          minthrottle
+# 727 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          ) 
+# 727 "./src/main/cli/settings.c"
+                                                                                                                                                                               },
+    { "max_throttle", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 750, 2250 }, 6, 
+# 728 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          __builtin_offsetof (
+# 728 "./src/main/cli/settings.c"
+                                                                                                                                          motorConfig_t
+# 728 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          , 
+# 728 "./src/main/cli/settings.c"
+                                                                                                                                          maxthrottle
+# 728 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          ) 
+# 728 "./src/main/cli/settings.c"
+                                                                                                                                                                               },
+    { "min_command", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 750, 2250 }, 6, 
+# 729 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          __builtin_offsetof (
+# 729 "./src/main/cli/settings.c"
+                                                                                                                                          motorConfig_t
+# 729 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          , 
+# 729 "./src/main/cli/settings.c"
+                                                                                                                                          mincommand
+# 729 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          ) 
+# 729 "./src/main/cli/settings.c"
+                                                                                                                                                                              },
+# 739 "./src/main/cli/settings.c"
+    { "use_unsynced_pwm", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 6, 
+# 739 "./src/main/cli/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 739 "./src/main/cli/settings.c"
+                                                                                                                                motorConfig_t
+# 739 "./src/main/cli/settings.c" 3 4
+                                                                                                                                , 
+# 739 "./src/main/cli/settings.c"
+                                                                                                                                dev.useUnsyncedPwm
+# 739 "./src/main/cli/settings.c" 3 4
+                                                                                                                                ) 
+# 739 "./src/main/cli/settings.c"
+                                                                                                                                                                            },
+    { "motor_pwm_protocol", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_MOTOR_PWM_PROTOCOL }, 6, 
+# 740 "./src/main/cli/settings.c" 3 4
+                                                                                                                                            __builtin_offsetof (
+# 740 "./src/main/cli/settings.c"
+                                                                                                                                            motorConfig_t
+# 740 "./src/main/cli/settings.c" 3 4
+                                                                                                                                            , 
+# 740 "./src/main/cli/settings.c"
+                                                                                                                                            dev.motorPwmProtocol
+# 740 "./src/main/cli/settings.c" 3 4
+                                                                                                                                            ) 
+# 740 "./src/main/cli/settings.c"
+                                                                                                                                                                                          },
+    { "motor_pwm_rate", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 200, 32000 }, 6, 
+# 741 "./src/main/cli/settings.c" 3 4
+                                                                                                                        __builtin_offsetof (
+# 741 "./src/main/cli/settings.c"
+                                                                                                                        motorConfig_t
+# 741 "./src/main/cli/settings.c" 3 4
+                                                                                                                        , 
+# 741 "./src/main/cli/settings.c"
+                                                                                                                        dev.motorPwmRate
+# 741 "./src/main/cli/settings.c" 3 4
+                                                                                                                        ) 
+# 741 "./src/main/cli/settings.c"
+                                                                                                                                                                  },
+    { "motor_pwm_inversion", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 6, 
+# 742 "./src/main/cli/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 742 "./src/main/cli/settings.c"
+                                                                                                                                motorConfig_t
+# 742 "./src/main/cli/settings.c" 3 4
+                                                                                                                                , 
+# 742 "./src/main/cli/settings.c"
+                                                                                                                                dev.motorPwmInversion
+# 742 "./src/main/cli/settings.c" 3 4
+                                                                                                                                ) 
+# 742 "./src/main/cli/settings.c"
+                                                                                                                                                                               },
+    { "motor_poles", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 4, 
+# 743 "./src/main/cli/settings.c" 3 4
+                                                                                           (255) 
+# 743 "./src/main/cli/settings.c"
+                                                                                                     }, 6, 
+# 743 "./src/main/cli/settings.c" 3 4
+                                                                                                                         __builtin_offsetof (
+# 743 "./src/main/cli/settings.c"
+                                                                                                                         motorConfig_t
+# 743 "./src/main/cli/settings.c" 3 4
+                                                                                                                         , 
+# 743 "./src/main/cli/settings.c"
+                                                                                                                         motorPoleCount
+# 743 "./src/main/cli/settings.c" 3 4
+                                                                                                                         ) 
+# 743 "./src/main/cli/settings.c"
+                                                                                                                                                                 },
+
+
+    { "thr_corr_value", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 150 }, 39, 
+# 746 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   __builtin_offsetof (
+# 746 "./src/main/cli/settings.c"
+                                                                                                                                   throttleCorrectionConfig_t
+# 746 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   , 
+# 746 "./src/main/cli/settings.c"
+                                                                                                                                   throttle_correction_value
+# 746 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   ) 
+# 746 "./src/main/cli/settings.c"
+                                                                                                                                                                                                   },
+    { "thr_corr_angle", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 1, 900 }, 39, 
+# 747 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   __builtin_offsetof (
+# 747 "./src/main/cli/settings.c"
+                                                                                                                                   throttleCorrectionConfig_t
+# 747 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   , 
+# 747 "./src/main/cli/settings.c"
+                                                                                                                                   throttle_correction_angle
+# 747 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   ) 
+# 747 "./src/main/cli/settings.c"
+                                                                                                                                                                                                   },
+
+
+    { "failsafe_delay", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 200 }, 1, 
+# 750 "./src/main/cli/settings.c" 3 4
+                                                                                                                       __builtin_offsetof (
+# 750 "./src/main/cli/settings.c"
+                                                                                                                       failsafeConfig_t
+# 750 "./src/main/cli/settings.c" 3 4
+                                                                                                                       , 
+# 750 "./src/main/cli/settings.c"
+                                                                                                                       failsafe_delay
+# 750 "./src/main/cli/settings.c" 3 4
+                                                                                                                       ) 
+# 750 "./src/main/cli/settings.c"
+                                                                                                                                                                  },
+    { "failsafe_off_delay", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 200 }, 1, 
+# 751 "./src/main/cli/settings.c" 3 4
+                                                                                                                       __builtin_offsetof (
+# 751 "./src/main/cli/settings.c"
+                                                                                                                       failsafeConfig_t
+# 751 "./src/main/cli/settings.c" 3 4
+                                                                                                                       , 
+# 751 "./src/main/cli/settings.c"
+                                                                                                                       failsafe_off_delay
+# 751 "./src/main/cli/settings.c" 3 4
+                                                                                                                       ) 
+# 751 "./src/main/cli/settings.c"
+                                                                                                                                                                      },
+    { "failsafe_throttle", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 750, 2250 }, 1, 
+# 752 "./src/main/cli/settings.c" 3 4
+                                                                                                                                             __builtin_offsetof (
+# 752 "./src/main/cli/settings.c"
+                                                                                                                                             failsafeConfig_t
+# 752 "./src/main/cli/settings.c" 3 4
+                                                                                                                                             , 
+# 752 "./src/main/cli/settings.c"
+                                                                                                                                             failsafe_throttle
+# 752 "./src/main/cli/settings.c" 3 4
+                                                                                                                                             ) 
+# 752 "./src/main/cli/settings.c"
+                                                                                                                                                                                           },
+    { "failsafe_switch_mode", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FAILSAFE_SWITCH_MODE }, 1, 
+# 753 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                 __builtin_offsetof (
+# 753 "./src/main/cli/settings.c"
+                                                                                                                                                 failsafeConfig_t
+# 753 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                 , 
+# 753 "./src/main/cli/settings.c"
+                                                                                                                                                 failsafe_switch_mode
+# 753 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                 ) 
+# 753 "./src/main/cli/settings.c"
+                                                                                                                                                                                                  },
+    { "failsafe_throttle_low_delay",VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 300 }, 1, 
+# 754 "./src/main/cli/settings.c" 3 4
+                                                                                                                       __builtin_offsetof (
+# 754 "./src/main/cli/settings.c"
+                                                                                                                       failsafeConfig_t
+# 754 "./src/main/cli/settings.c" 3 4
+                                                                                                                       , 
+# 754 "./src/main/cli/settings.c"
+                                                                                                                       failsafe_throttle_low_delay
+# 754 "./src/main/cli/settings.c" 3 4
+                                                                                                                       ) 
+# 754 "./src/main/cli/settings.c"
+                                                                                                                                                                               },
+    { "failsafe_procedure", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FAILSAFE }, 1, 
+# 755 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 755 "./src/main/cli/settings.c"
+                                                                                                                                     failsafeConfig_t
+# 755 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     , 
+# 755 "./src/main/cli/settings.c"
+                                                                                                                                     failsafe_procedure
+# 755 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     ) 
+# 755 "./src/main/cli/settings.c"
+                                                                                                                                                                                    },
+
+
+    { "align_board_roll", VAR_INT16 | MASTER_VALUE, .config.minmax = { -180, 360 }, 2, 
+# 758 "./src/main/cli/settings.c" 3 4
+                                                                                                                  __builtin_offsetof (
+# 758 "./src/main/cli/settings.c"
+                                                                                                                  boardAlignment_t
+# 758 "./src/main/cli/settings.c" 3 4
+                                                                                                                  , 
+# 758 "./src/main/cli/settings.c"
+                                                                                                                  rollDegrees
+# 758 "./src/main/cli/settings.c" 3 4
+                                                                                                                  ) 
+# 758 "./src/main/cli/settings.c"
+                                                                                                                                                          },
+    { "align_board_pitch", VAR_INT16 | MASTER_VALUE, .config.minmax = { -180, 360 }, 2, 
+# 759 "./src/main/cli/settings.c" 3 4
+                                                                                                                  __builtin_offsetof (
+# 759 "./src/main/cli/settings.c"
+                                                                                                                  boardAlignment_t
+# 759 "./src/main/cli/settings.c" 3 4
+                                                                                                                  , 
+# 759 "./src/main/cli/settings.c"
+                                                                                                                  pitchDegrees
+# 759 "./src/main/cli/settings.c" 3 4
+                                                                                                                  ) 
+# 759 "./src/main/cli/settings.c"
+                                                                                                                                                           },
+    { "align_board_yaw", VAR_INT16 | MASTER_VALUE, .config.minmax = { -180, 360 }, 2, 
+# 760 "./src/main/cli/settings.c" 3 4
+                                                                                                                  __builtin_offsetof (
+# 760 "./src/main/cli/settings.c"
+                                                                                                                  boardAlignment_t
+# 760 "./src/main/cli/settings.c" 3 4
+                                                                                                                  , 
+# 760 "./src/main/cli/settings.c"
+                                                                                                                  yawDegrees
+# 760 "./src/main/cli/settings.c" 3 4
+                                                                                                                  ) 
+# 760 "./src/main/cli/settings.c"
+                                                                                                                                                         },
+
+
+
+    { "gimbal_mode", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GIMBAL_MODE }, 3, 
+# 764 "./src/main/cli/settings.c" 3 4
+                                                                                                                                      __builtin_offsetof (
+# 764 "./src/main/cli/settings.c"
+                                                                                                                                      gimbalConfig_t
+# 764 "./src/main/cli/settings.c" 3 4
+                                                                                                                                      , 
+# 764 "./src/main/cli/settings.c"
+                                                                                                                                      mode
+# 764 "./src/main/cli/settings.c" 3 4
+                                                                                                                                      ) 
+# 764 "./src/main/cli/settings.c"
+                                                                                                                                                                     },
+
+
+
+    { "bat_capacity", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 20000 }, 11, 
+# 768 "./src/main/cli/settings.c" 3 4
+                                                                                                                        __builtin_offsetof (
+# 768 "./src/main/cli/settings.c"
+                                                                                                                        batteryConfig_t
+# 768 "./src/main/cli/settings.c" 3 4
+                                                                                                                        , 
+# 768 "./src/main/cli/settings.c"
+                                                                                                                        batteryCapacity
+# 768 "./src/main/cli/settings.c" 3 4
+                                                                                                                        ) 
+# 768 "./src/main/cli/settings.c"
+                                                                                                                                                                   },
+    { "vbat_max_cell_voltage", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 100, 500 }, 11, 
+# 769 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                       __builtin_offsetof (
+# 769 "./src/main/cli/settings.c"
+                                                                                                                                                                       batteryConfig_t
+# 769 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                       , 
+# 769 "./src/main/cli/settings.c"
+                                                                                                                                                                       vbatmaxcellvoltage
+# 769 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                       ) 
+# 769 "./src/main/cli/settings.c"
+                                                                                                                                                                                                                     },
+    { "vbat_full_cell_voltage", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 100, 500 }, 11, 
+# 770 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                       __builtin_offsetof (
+# 770 "./src/main/cli/settings.c"
+                                                                                                                                                                       batteryConfig_t
+# 770 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                       , 
+# 770 "./src/main/cli/settings.c"
+                                                                                                                                                                       vbatfullcellvoltage
+# 770 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                       ) 
+# 770 "./src/main/cli/settings.c"
+                                                                                                                                                                                                                      },
+    { "vbat_min_cell_voltage", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 100, 500 }, 11, 
+# 771 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                       __builtin_offsetof (
+# 771 "./src/main/cli/settings.c"
+                                                                                                                                                                       batteryConfig_t
+# 771 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                       , 
+# 771 "./src/main/cli/settings.c"
+                                                                                                                                                                       vbatmincellvoltage
+# 771 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                       ) 
+# 771 "./src/main/cli/settings.c"
+                                                                                                                                                                                                                     },
+    { "vbat_warning_cell_voltage", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 100, 500 }, 11, 
+# 772 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                       __builtin_offsetof (
+# 772 "./src/main/cli/settings.c"
+                                                                                                                                                                       batteryConfig_t
+# 772 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                       , 
+# 772 "./src/main/cli/settings.c"
+                                                                                                                                                                       vbatwarningcellvoltage
+# 772 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                       ) 
+# 772 "./src/main/cli/settings.c"
+                                                                                                                                                                                                                         },
+    { "vbat_hysteresis", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 250 }, 11, 
+# 773 "./src/main/cli/settings.c" 3 4
+                                                                                                                      __builtin_offsetof (
+# 773 "./src/main/cli/settings.c"
+                                                                                                                      batteryConfig_t
+# 773 "./src/main/cli/settings.c" 3 4
+                                                                                                                      , 
+# 773 "./src/main/cli/settings.c"
+                                                                                                                      vbathysteresis
+# 773 "./src/main/cli/settings.c" 3 4
+                                                                                                                      ) 
+# 773 "./src/main/cli/settings.c"
+                                                                                                                                                                },
+    { "current_meter", VAR_UINT8 | HARDWARE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_CURRENT_METER }, 11, 
+# 774 "./src/main/cli/settings.c" 3 4
+                                                                                                                                           __builtin_offsetof (
+# 774 "./src/main/cli/settings.c"
+                                                                                                                                           batteryConfig_t
+# 774 "./src/main/cli/settings.c" 3 4
+                                                                                                                                           , 
+# 774 "./src/main/cli/settings.c"
+                                                                                                                                           currentMeterSource
+# 774 "./src/main/cli/settings.c" 3 4
+                                                                                                                                           ) 
+# 774 "./src/main/cli/settings.c"
+                                                                                                                                                                                         },
+    { "battery_meter", VAR_UINT8 | HARDWARE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_VOLTAGE_METER }, 11, 
+# 775 "./src/main/cli/settings.c" 3 4
+                                                                                                                                           __builtin_offsetof (
+# 775 "./src/main/cli/settings.c"
+                                                                                                                                           batteryConfig_t
+# 775 "./src/main/cli/settings.c" 3 4
+                                                                                                                                           , 
+# 775 "./src/main/cli/settings.c"
+                                                                                                                                           voltageMeterSource
+# 775 "./src/main/cli/settings.c" 3 4
+                                                                                                                                           ) 
+# 775 "./src/main/cli/settings.c"
+                                                                                                                                                                                         },
+    { "vbat_detect_cell_voltage", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 2000 }, 11, 
+# 776 "./src/main/cli/settings.c" 3 4
+                                                                                                                        __builtin_offsetof (
+# 776 "./src/main/cli/settings.c"
+                                                                                                                        batteryConfig_t
+# 776 "./src/main/cli/settings.c" 3 4
+                                                                                                                        , 
+# 776 "./src/main/cli/settings.c"
+                                                                                                                        vbatnotpresentcellvoltage
+# 776 "./src/main/cli/settings.c" 3 4
+                                                                                                                        ) 
+# 776 "./src/main/cli/settings.c"
+                                                                                                                                                                             },
+    { "use_vbat_alerts", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 11, 
+# 777 "./src/main/cli/settings.c" 3 4
+                                                                                                                                  __builtin_offsetof (
+# 777 "./src/main/cli/settings.c"
+                                                                                                                                  batteryConfig_t
+# 777 "./src/main/cli/settings.c" 3 4
+                                                                                                                                  , 
+# 777 "./src/main/cli/settings.c"
+                                                                                                                                  useVBatAlerts
+# 777 "./src/main/cli/settings.c" 3 4
+                                                                                                                                  ) 
+# 777 "./src/main/cli/settings.c"
+                                                                                                                                                                           },
+    { "use_cbat_alerts", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 11, 
+# 778 "./src/main/cli/settings.c" 3 4
+                                                                                                                                  __builtin_offsetof (
+# 778 "./src/main/cli/settings.c"
+                                                                                                                                  batteryConfig_t
+# 778 "./src/main/cli/settings.c" 3 4
+                                                                                                                                  , 
+# 778 "./src/main/cli/settings.c"
+                                                                                                                                  useConsumptionAlerts
+# 778 "./src/main/cli/settings.c" 3 4
+                                                                                                                                  ) 
+# 778 "./src/main/cli/settings.c"
+                                                                                                                                                                                  },
+    { "cbat_alert_percent", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 100 }, 11, 
+# 779 "./src/main/cli/settings.c" 3 4
+                                                                                                                      __builtin_offsetof (
+# 779 "./src/main/cli/settings.c"
+                                                                                                                      batteryConfig_t
+# 779 "./src/main/cli/settings.c" 3 4
+                                                                                                                      , 
+# 779 "./src/main/cli/settings.c"
+                                                                                                                      consumptionWarningPercentage
+# 779 "./src/main/cli/settings.c" 3 4
+                                                                                                                      ) 
+# 779 "./src/main/cli/settings.c"
+                                                                                                                                                                              },
+    { "vbat_cutoff_percent", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 100 }, 11, 
+# 780 "./src/main/cli/settings.c" 3 4
+                                                                                                                      __builtin_offsetof (
+# 780 "./src/main/cli/settings.c"
+                                                                                                                      batteryConfig_t
+# 780 "./src/main/cli/settings.c" 3 4
+                                                                                                                      , 
+# 780 "./src/main/cli/settings.c"
+                                                                                                                      lvcPercentage
+# 780 "./src/main/cli/settings.c" 3 4
+                                                                                                                      ) 
+# 780 "./src/main/cli/settings.c"
+                                                                                                                                                               },
+    { "force_battery_cell_count", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 24 }, 11, 
+# 781 "./src/main/cli/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 781 "./src/main/cli/settings.c"
+                                                                                                                     batteryConfig_t
+# 781 "./src/main/cli/settings.c" 3 4
+                                                                                                                     , 
+# 781 "./src/main/cli/settings.c"
+                                                                                                                     forceBatteryCellCount
+# 781 "./src/main/cli/settings.c" 3 4
+                                                                                                                     ) 
+# 781 "./src/main/cli/settings.c"
+                                                                                                                                                                      },
+    { "vbat_lpf_period", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 
+# 782 "./src/main/cli/settings.c" 3 4
+                                                                                            (255) 
+# 782 "./src/main/cli/settings.c"
+                                                                                                      }, 11, 
+# 782 "./src/main/cli/settings.c" 3 4
+                                                                                                                            __builtin_offsetof (
+# 782 "./src/main/cli/settings.c"
+                                                                                                                            batteryConfig_t
+# 782 "./src/main/cli/settings.c" 3 4
+                                                                                                                            , 
+# 782 "./src/main/cli/settings.c"
+                                                                                                                            vbatLpfPeriod
+# 782 "./src/main/cli/settings.c" 3 4
+                                                                                                                            ) 
+# 782 "./src/main/cli/settings.c"
+                                                                                                                                                                     },
+    { "ibat_lpf_period", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 
+# 783 "./src/main/cli/settings.c" 3 4
+                                                                                            (255) 
+# 783 "./src/main/cli/settings.c"
+                                                                                                      }, 11, 
+# 783 "./src/main/cli/settings.c" 3 4
+                                                                                                                            __builtin_offsetof (
+# 783 "./src/main/cli/settings.c"
+                                                                                                                            batteryConfig_t
+# 783 "./src/main/cli/settings.c" 3 4
+                                                                                                                            , 
+# 783 "./src/main/cli/settings.c"
+                                                                                                                            ibatLpfPeriod
+# 783 "./src/main/cli/settings.c" 3 4
+                                                                                                                            ) 
+# 783 "./src/main/cli/settings.c"
+                                                                                                                                                                     },
+
+
+    { "vbat_scale", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 255 }, 258, 
+# 786 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 786 "./src/main/cli/settings.c"
+                                                                                                                                                         voltageSensorADCConfig_t
+# 786 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 786 "./src/main/cli/settings.c"
+                                                                                                                                                         vbatscale
+# 786 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         ) 
+# 786 "./src/main/cli/settings.c"
+                                                                                                                                                                                                       },
+    { "vbat_divider", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 1, 255 }, 258, 
+# 787 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                             __builtin_offsetof (
+# 787 "./src/main/cli/settings.c"
+                                                                                                                                                             voltageSensorADCConfig_t
+# 787 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                             , 
+# 787 "./src/main/cli/settings.c"
+                                                                                                                                                             vbatresdivval
+# 787 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                             ) 
+# 787 "./src/main/cli/settings.c"
+                                                                                                                                                                                                               },
+    { "vbat_multiplier", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 1, 255 }, 258, 
+# 788 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                   __builtin_offsetof (
+# 788 "./src/main/cli/settings.c"
+                                                                                                                                                                   voltageSensorADCConfig_t
+# 788 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                   , 
+# 788 "./src/main/cli/settings.c"
+                                                                                                                                                                   vbatresdivmultiplier
+# 788 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                   ) 
+# 788 "./src/main/cli/settings.c"
+                                                                                                                                                                                                                            },
+
+
+    { "ibata_scale", VAR_INT16 | HARDWARE_VALUE, .config.minmax = { -16000, 16000 }, 256, 
+# 791 "./src/main/cli/settings.c" 3 4
+                                                                                                                                  __builtin_offsetof (
+# 791 "./src/main/cli/settings.c"
+                                                                                                                                  currentSensorADCConfig_t
+# 791 "./src/main/cli/settings.c" 3 4
+                                                                                                                                  , 
+# 791 "./src/main/cli/settings.c"
+                                                                                                                                  scale
+# 791 "./src/main/cli/settings.c" 3 4
+                                                                                                                                  ) 
+# 791 "./src/main/cli/settings.c"
+                                                                                                                                                                            },
+    { "ibata_offset", VAR_INT16 | MASTER_VALUE, .config.minmax = { -32000, 32000 }, 256, 
+# 792 "./src/main/cli/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 792 "./src/main/cli/settings.c"
+                                                                                                                                currentSensorADCConfig_t
+# 792 "./src/main/cli/settings.c" 3 4
+                                                                                                                                , 
+# 792 "./src/main/cli/settings.c"
+                                                                                                                                offset
+# 792 "./src/main/cli/settings.c" 3 4
+                                                                                                                                ) 
+# 792 "./src/main/cli/settings.c"
+                                                                                                                                                                           },
+# 812 "./src/main/cli/settings.c"
+    { "yaw_motors_reversed", VAR_INT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 20, 
+# 812 "./src/main/cli/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 812 "./src/main/cli/settings.c"
+                                                                                                                                mixerConfig_t
+# 812 "./src/main/cli/settings.c" 3 4
+                                                                                                                                , 
+# 812 "./src/main/cli/settings.c"
+                                                                                                                                yaw_motors_reversed
+# 812 "./src/main/cli/settings.c" 3 4
+                                                                                                                                ) 
+# 812 "./src/main/cli/settings.c"
+                                                                                                                                                                             },
+    { "crashflip_motor_percent", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 100 }, 20, 
+# 813 "./src/main/cli/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 813 "./src/main/cli/settings.c"
+                                                                                                                     mixerConfig_t
+# 813 "./src/main/cli/settings.c" 3 4
+                                                                                                                     , 
+# 813 "./src/main/cli/settings.c"
+                                                                                                                     crashflip_motor_percent
+# 813 "./src/main/cli/settings.c" 3 4
+                                                                                                                     ) 
+# 813 "./src/main/cli/settings.c"
+                                                                                                                                                                      },
+
+
+    { "3d_deadband_low", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 750, (1000 + ((2000 - 1000) / 2)) }, 26, 
+# 816 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                __builtin_offsetof (
+# 816 "./src/main/cli/settings.c"
+                                                                                                                                                flight3DConfig_t
+# 816 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                , 
+# 816 "./src/main/cli/settings.c"
+                                                                                                                                                deadband3d_low
+# 816 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                ) 
+# 816 "./src/main/cli/settings.c"
+                                                                                                                                                                                           },
+    { "3d_deadband_high", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { (1000 + ((2000 - 1000) / 2)), 2250 }, 26, 
+# 817 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                __builtin_offsetof (
+# 817 "./src/main/cli/settings.c"
+                                                                                                                                                flight3DConfig_t
+# 817 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                , 
+# 817 "./src/main/cli/settings.c"
+                                                                                                                                                deadband3d_high
+# 817 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                ) 
+# 817 "./src/main/cli/settings.c"
+                                                                                                                                                                                            },
+    { "3d_neutral", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 750, 2250 }, 26, 
+# 818 "./src/main/cli/settings.c" 3 4
+                                                                                                                                             __builtin_offsetof (
+# 818 "./src/main/cli/settings.c"
+                                                                                                                                             flight3DConfig_t
+# 818 "./src/main/cli/settings.c" 3 4
+                                                                                                                                             , 
+# 818 "./src/main/cli/settings.c"
+                                                                                                                                             neutral3d
+# 818 "./src/main/cli/settings.c" 3 4
+                                                                                                                                             ) 
+# 818 "./src/main/cli/settings.c"
+                                                                                                                                                                                   },
+    { "3d_deadband_throttle", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 1, 100 }, 26, 
+# 819 "./src/main/cli/settings.c" 3 4
+                                                                                                                       __builtin_offsetof (
+# 819 "./src/main/cli/settings.c"
+                                                                                                                       flight3DConfig_t
+# 819 "./src/main/cli/settings.c" 3 4
+                                                                                                                       , 
+# 819 "./src/main/cli/settings.c"
+                                                                                                                       deadband3d_throttle
+# 819 "./src/main/cli/settings.c" 3 4
+                                                                                                                       ) 
+# 819 "./src/main/cli/settings.c"
+                                                                                                                                                                       },
+    { "3d_limit_low", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 750, (1000 + ((2000 - 1000) / 2)) }, 26, 
+# 820 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                __builtin_offsetof (
+# 820 "./src/main/cli/settings.c"
+                                                                                                                                                flight3DConfig_t
+# 820 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                , 
+# 820 "./src/main/cli/settings.c"
+                                                                                                                                                limit3d_low
+# 820 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                ) 
+# 820 "./src/main/cli/settings.c"
+                                                                                                                                                                                        },
+    { "3d_limit_high", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { (1000 + ((2000 - 1000) / 2)), 2250 }, 26, 
+# 821 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                __builtin_offsetof (
+# 821 "./src/main/cli/settings.c"
+                                                                                                                                                flight3DConfig_t
+# 821 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                , 
+# 821 "./src/main/cli/settings.c"
+                                                                                                                                                limit3d_high
+# 821 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                ) 
+# 821 "./src/main/cli/settings.c"
+                                                                                                                                                                                         },
+    { "3d_switched_mode", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 26, 
+# 822 "./src/main/cli/settings.c" 3 4
+                                                                                                                                  __builtin_offsetof (
+# 822 "./src/main/cli/settings.c"
+                                                                                                                                  flight3DConfig_t
+# 822 "./src/main/cli/settings.c" 3 4
+                                                                                                                                  , 
+# 822 "./src/main/cli/settings.c"
+                                                                                                                                  switched_mode3d
+# 822 "./src/main/cli/settings.c" 3 4
+                                                                                                                                  ) 
+# 822 "./src/main/cli/settings.c"
+                                                                                                                                                                              },
+
+
+
+    { "servo_center_pulse", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 750, 2250 }, 52, 
+# 826 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          __builtin_offsetof (
+# 826 "./src/main/cli/settings.c"
+                                                                                                                                          servoConfig_t
+# 826 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          , 
+# 826 "./src/main/cli/settings.c"
+                                                                                                                                          dev.servoCenterPulse
+# 826 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          ) 
+# 826 "./src/main/cli/settings.c"
+                                                                                                                                                                                        },
+    { "servo_pwm_rate", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 50, 498 }, 52, 
+# 827 "./src/main/cli/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 827 "./src/main/cli/settings.c"
+                                                                                                                     servoConfig_t
+# 827 "./src/main/cli/settings.c" 3 4
+                                                                                                                     , 
+# 827 "./src/main/cli/settings.c"
+                                                                                                                     dev.servoPwmRate
+# 827 "./src/main/cli/settings.c" 3 4
+                                                                                                                     ) 
+# 827 "./src/main/cli/settings.c"
+                                                                                                                                                               },
+    { "servo_lowpass_hz", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 400}, 52, 
+# 828 "./src/main/cli/settings.c" 3 4
+                                                                                                                   __builtin_offsetof (
+# 828 "./src/main/cli/settings.c"
+                                                                                                                   servoConfig_t
+# 828 "./src/main/cli/settings.c" 3 4
+                                                                                                                   , 
+# 828 "./src/main/cli/settings.c"
+                                                                                                                   servo_lowpass_freq
+# 828 "./src/main/cli/settings.c" 3 4
+                                                                                                                   ) 
+# 828 "./src/main/cli/settings.c"
+                                                                                                                                                               },
+    { "tri_unarmed_servo", VAR_INT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 52, 
+# 829 "./src/main/cli/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 829 "./src/main/cli/settings.c"
+                                                                                                                                servoConfig_t
+# 829 "./src/main/cli/settings.c" 3 4
+                                                                                                                                , 
+# 829 "./src/main/cli/settings.c"
+                                                                                                                                tri_unarmed_servo
+# 829 "./src/main/cli/settings.c" 3 4
+                                                                                                                                ) 
+# 829 "./src/main/cli/settings.c"
+                                                                                                                                                                           },
+    { "channel_forwarding_start", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { AUX1, 18 }, 52, 
+# 830 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                  __builtin_offsetof (
+# 830 "./src/main/cli/settings.c"
+                                                                                                                                                  servoConfig_t
+# 830 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                  , 
+# 830 "./src/main/cli/settings.c"
+                                                                                                                                                  channel_forwarding_start_channel
+# 830 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                  ) 
+# 830 "./src/main/cli/settings.c"
+                                                                                                                                                                                                            },
+
+
+
+    { "thr_mid", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmaxUnsigned = { 0, 100 }, 12, 
+# 834 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   __builtin_offsetof (
+# 834 "./src/main/cli/settings.c"
+                                                                                                                                   controlRateConfig_t
+# 834 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   , 
+# 834 "./src/main/cli/settings.c"
+                                                                                                                                   thrMid8
+# 834 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   ) 
+# 834 "./src/main/cli/settings.c"
+                                                                                                                                                                          },
+    { "thr_expo", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmaxUnsigned = { 0, 100 }, 12, 
+# 835 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   __builtin_offsetof (
+# 835 "./src/main/cli/settings.c"
+                                                                                                                                   controlRateConfig_t
+# 835 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   , 
+# 835 "./src/main/cli/settings.c"
+                                                                                                                                   thrExpo8
+# 835 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   ) 
+# 835 "./src/main/cli/settings.c"
+                                                                                                                                                                           },
+    { "rates_type", VAR_UINT8 | PROFILE_RATE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RATES_TYPE }, 12, 
+# 836 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                   __builtin_offsetof (
+# 836 "./src/main/cli/settings.c"
+                                                                                                                                                   controlRateConfig_t
+# 836 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                   , 
+# 836 "./src/main/cli/settings.c"
+                                                                                                                                                   rates_type
+# 836 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                   ) 
+# 836 "./src/main/cli/settings.c"
+                                                                                                                                                                                             },
+    { "roll_rc_rate", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmaxUnsigned = { 1, 255 }, 12, 
+# 837 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                __builtin_offsetof (
+# 837 "./src/main/cli/settings.c"
+                                                                                                                                                                controlRateConfig_t
+# 837 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                , 
+# 837 "./src/main/cli/settings.c"
+                                                                                                                                                                rcRates[FD_ROLL]
+# 837 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                ) 
+# 837 "./src/main/cli/settings.c"
+                                                                                                                                                                                                                },
+    { "pitch_rc_rate", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmaxUnsigned = { 1, 255 }, 12, 
+# 838 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                __builtin_offsetof (
+# 838 "./src/main/cli/settings.c"
+                                                                                                                                                                controlRateConfig_t
+# 838 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                , 
+# 838 "./src/main/cli/settings.c"
+                                                                                                                                                                rcRates[FD_PITCH]
+# 838 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                ) 
+# 838 "./src/main/cli/settings.c"
+                                                                                                                                                                                                                 },
+    { "yaw_rc_rate", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmaxUnsigned = { 1, 255 }, 12, 
+# 839 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                __builtin_offsetof (
+# 839 "./src/main/cli/settings.c"
+                                                                                                                                                                controlRateConfig_t
+# 839 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                , 
+# 839 "./src/main/cli/settings.c"
+                                                                                                                                                                rcRates[FD_YAW]
+# 839 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                ) 
+# 839 "./src/main/cli/settings.c"
+                                                                                                                                                                                                               },
+    { "roll_expo", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmaxUnsigned = { 0, 100 }, 12, 
+# 840 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                               __builtin_offsetof (
+# 840 "./src/main/cli/settings.c"
+                                                                                                                                                               controlRateConfig_t
+# 840 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                               , 
+# 840 "./src/main/cli/settings.c"
+                                                                                                                                                               rcExpo[FD_ROLL]
+# 840 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                               ) 
+# 840 "./src/main/cli/settings.c"
+                                                                                                                                                                                                              },
+    { "pitch_expo", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmaxUnsigned = { 0, 100 }, 12, 
+# 841 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                               __builtin_offsetof (
+# 841 "./src/main/cli/settings.c"
+                                                                                                                                                               controlRateConfig_t
+# 841 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                               , 
+# 841 "./src/main/cli/settings.c"
+                                                                                                                                                               rcExpo[FD_PITCH]
+# 841 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                               ) 
+# 841 "./src/main/cli/settings.c"
+                                                                                                                                                                                                               },
+    { "yaw_expo", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmaxUnsigned = { 0, 100 }, 12, 
+# 842 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                               __builtin_offsetof (
+# 842 "./src/main/cli/settings.c"
+                                                                                                                                                               controlRateConfig_t
+# 842 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                               , 
+# 842 "./src/main/cli/settings.c"
+                                                                                                                                                               rcExpo[FD_YAW]
+# 842 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                               ) 
+# 842 "./src/main/cli/settings.c"
+                                                                                                                                                                                                             },
+    { "roll_srate", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmaxUnsigned = { 0, 255 }, 12, 
+# 843 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                            __builtin_offsetof (
+# 843 "./src/main/cli/settings.c"
+                                                                                                                                                            controlRateConfig_t
+# 843 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                            , 
+# 843 "./src/main/cli/settings.c"
+                                                                                                                                                            rates[FD_ROLL]
+# 843 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                            ) 
+# 843 "./src/main/cli/settings.c"
+                                                                                                                                                                                                          },
+    { "pitch_srate", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmaxUnsigned = { 0, 255 }, 12, 
+# 844 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                            __builtin_offsetof (
+# 844 "./src/main/cli/settings.c"
+                                                                                                                                                            controlRateConfig_t
+# 844 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                            , 
+# 844 "./src/main/cli/settings.c"
+                                                                                                                                                            rates[FD_PITCH]
+# 844 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                            ) 
+# 844 "./src/main/cli/settings.c"
+                                                                                                                                                                                                           },
+    { "yaw_srate", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmaxUnsigned = { 0, 255 }, 12, 
+# 845 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                            __builtin_offsetof (
+# 845 "./src/main/cli/settings.c"
+                                                                                                                                                            controlRateConfig_t
+# 845 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                            , 
+# 845 "./src/main/cli/settings.c"
+                                                                                                                                                            rates[FD_YAW]
+# 845 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                            ) 
+# 845 "./src/main/cli/settings.c"
+                                                                                                                                                                                                         },
+    { "tpa_rate", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmaxUnsigned = { 0, 100}, 12, 
+# 846 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                          __builtin_offsetof (
+# 846 "./src/main/cli/settings.c"
+                                                                                                                                                          controlRateConfig_t
+# 846 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                          , 
+# 846 "./src/main/cli/settings.c"
+                                                                                                                                                          dynThrPID
+# 846 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                          ) 
+# 846 "./src/main/cli/settings.c"
+                                                                                                                                                                                                   },
+    { "tpa_breakpoint", VAR_UINT16 | PROFILE_RATE_VALUE, .config.minmaxUnsigned = { 750, 2250 }, 12, 
+# 847 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 847 "./src/main/cli/settings.c"
+                                                                                                                                                         controlRateConfig_t
+# 847 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 847 "./src/main/cli/settings.c"
+                                                                                                                                                         tpa_breakpoint
+# 847 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         ) 
+# 847 "./src/main/cli/settings.c"
+                                                                                                                                                                                                       },
+
+
+
+    { "phase_shift_scale", VAR_INT8 | PROFILE_RATE_VALUE, .config.minmaxUnsigned = { 
+# 851 "./src/main/cli/settings.c" 3 4
+                                                                                               (-128)
+# 851 "./src/main/cli/settings.c"
+                                                                                                       , 
+# 851 "./src/main/cli/settings.c" 3 4
+                                                                                                         (127) 
+# 851 "./src/main/cli/settings.c"
+                                                                                                                  }, 12, 
+# 851 "./src/main/cli/settings.c" 3 4
+                                                                                                                                               __builtin_offsetof (
+# 851 "./src/main/cli/settings.c"
+                                                                                                                                               controlRateConfig_t
+# 851 "./src/main/cli/settings.c" 3 4
+                                                                                                                                               , 
+# 851 "./src/main/cli/settings.c"
+                                                                                                                                               phase_shift_scale
+# 851 "./src/main/cli/settings.c" 3 4
+                                                                                                                                               ) 
+# 851 "./src/main/cli/settings.c"
+                                                                                                                                                                                                },
+    { "throttle_limit_type", VAR_UINT8 | PROFILE_RATE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_THROTTLE_LIMIT_TYPE }, 12, 
+# 852 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                            __builtin_offsetof (
+# 852 "./src/main/cli/settings.c"
+                                                                                                                                                            controlRateConfig_t
+# 852 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                            , 
+# 852 "./src/main/cli/settings.c"
+                                                                                                                                                            throttle_limit_type
+# 852 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                            ) 
+# 852 "./src/main/cli/settings.c"
+                                                                                                                                                                                                               },
+    { "throttle_limit_percent", VAR_UINT8 | PROFILE_RATE_VALUE, .config.minmaxUnsigned = { 25, 100 }, 12, 
+# 853 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 853 "./src/main/cli/settings.c"
+                                                                                                                                    controlRateConfig_t
+# 853 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    , 
+# 853 "./src/main/cli/settings.c"
+                                                                                                                                    throttle_limit_percent
+# 853 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    ) 
+# 853 "./src/main/cli/settings.c"
+                                                                                                                                                                                          },
+    { "roll_rate_limit", VAR_UINT16 | PROFILE_RATE_VALUE, .config.minmaxUnsigned = { 200, 1998 }, 12, 
+# 854 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                                                   __builtin_offsetof (
+# 854 "./src/main/cli/settings.c"
+                                                                                                                                                                                                   controlRateConfig_t
+# 854 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                                                   , 
+# 854 "./src/main/cli/settings.c"
+                                                                                                                                                                                                   rate_limit[FD_ROLL]
+# 854 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                                                   ) 
+# 854 "./src/main/cli/settings.c"
+                                                                                                                                                                                                                                                      },
+    { "pitch_rate_limit", VAR_UINT16 | PROFILE_RATE_VALUE, .config.minmaxUnsigned = { 200, 1998 }, 12, 
+# 855 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                                                   __builtin_offsetof (
+# 855 "./src/main/cli/settings.c"
+                                                                                                                                                                                                   controlRateConfig_t
+# 855 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                                                   , 
+# 855 "./src/main/cli/settings.c"
+                                                                                                                                                                                                   rate_limit[FD_PITCH]
+# 855 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                                                   ) 
+# 855 "./src/main/cli/settings.c"
+                                                                                                                                                                                                                                                       },
+    { "yaw_rate_limit", VAR_UINT16 | PROFILE_RATE_VALUE, .config.minmaxUnsigned = { 200, 1998 }, 12, 
+# 856 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                                                   __builtin_offsetof (
+# 856 "./src/main/cli/settings.c"
+                                                                                                                                                                                                   controlRateConfig_t
+# 856 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                                                   , 
+# 856 "./src/main/cli/settings.c"
+                                                                                                                                                                                                   rate_limit[FD_YAW]
+# 856 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                                                   ) 
+# 856 "./src/main/cli/settings.c"
+                                                                                                                                                                                                                                                     },
+
+
+    { "reboot_character", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 48, 126 }, 13, 
+# 859 "./src/main/cli/settings.c" 3 4
+                                                                                                                      __builtin_offsetof (
+# 859 "./src/main/cli/settings.c"
+                                                                                                                      serialConfig_t
+# 859 "./src/main/cli/settings.c" 3 4
+                                                                                                                      , 
+# 859 "./src/main/cli/settings.c"
+                                                                                                                      reboot_character
+# 859 "./src/main/cli/settings.c" 3 4
+                                                                                                                      ) 
+# 859 "./src/main/cli/settings.c"
+                                                                                                                                                                 },
+    { "serial_update_rate_hz", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 100, 2000 }, 13, 
+# 860 "./src/main/cli/settings.c" 3 4
+                                                                                                                        __builtin_offsetof (
+# 860 "./src/main/cli/settings.c"
+                                                                                                                        serialConfig_t
+# 860 "./src/main/cli/settings.c" 3 4
+                                                                                                                        , 
+# 860 "./src/main/cli/settings.c"
+                                                                                                                        serial_update_rate_hz
+# 860 "./src/main/cli/settings.c" 3 4
+                                                                                                                        ) 
+# 860 "./src/main/cli/settings.c"
+                                                                                                                                                                        },
+
+
+    { "imu_dcm_kp", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 32000 }, 22, 
+# 863 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 863 "./src/main/cli/settings.c"
+                                                                                                                    imuConfig_t
+# 863 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 863 "./src/main/cli/settings.c"
+                                                                                                                    dcm_kp
+# 863 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 863 "./src/main/cli/settings.c"
+                                                                                                                                                  },
+    { "imu_dcm_ki", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 32000 }, 22, 
+# 864 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 864 "./src/main/cli/settings.c"
+                                                                                                                    imuConfig_t
+# 864 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 864 "./src/main/cli/settings.c"
+                                                                                                                    dcm_ki
+# 864 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 864 "./src/main/cli/settings.c"
+                                                                                                                                                  },
+    { "small_angle", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 180 }, 22, 
+# 865 "./src/main/cli/settings.c" 3 4
+                                                                                                                  __builtin_offsetof (
+# 865 "./src/main/cli/settings.c"
+                                                                                                                  imuConfig_t
+# 865 "./src/main/cli/settings.c" 3 4
+                                                                                                                  , 
+# 865 "./src/main/cli/settings.c"
+                                                                                                                  small_angle
+# 865 "./src/main/cli/settings.c" 3 4
+                                                                                                                  ) 
+# 865 "./src/main/cli/settings.c"
+                                                                                                                                                     },
+    { "imu_stroke_sync", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 22, 
+# 866 "./src/main/cli/settings.c" 3 4
+                                                                                                                              __builtin_offsetof (
+# 866 "./src/main/cli/settings.c"
+                                                                                                                              imuConfig_t
+# 866 "./src/main/cli/settings.c" 3 4
+                                                                                                                              , 
+# 866 "./src/main/cli/settings.c"
+                                                                                                                              stroke_sync
+# 866 "./src/main/cli/settings.c" 3 4
+                                                                                                                              ) 
+# 866 "./src/main/cli/settings.c"
+                                                                                                                                                                 },
+    { "imu_fast_attitude", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 22, 
+# 867 "./src/main/cli/settings.c" 3 4
+                                                                                                                              __builtin_offsetof (
+# 867 "./src/main/cli/settings.c"
+                                                                                                                              imuConfig_t
+# 867 "./src/main/cli/settings.c" 3 4
+                                                                                                                              , 
+# 867 "./src/main/cli/settings.c"
+                                                                                                                              fast_attitude
+# 867 "./src/main/cli/settings.c" 3 4
+                                                                                                                              ) 
+# 867 "./src/main/cli/settings.c"
+                                                                                                                                                                   },
+
+
+    { "auto_disarm_delay", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 60 }, 16, 
+# 870 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 870 "./src/main/cli/settings.c"
+                                                                                                                    armingConfig_t
+# 870 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 870 "./src/main/cli/settings.c"
+                                                                                                                    auto_disarm_delay
+# 870 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 870 "./src/main/cli/settings.c"
+                                                                                                                                                                },
+    { "gyro_cal_on_first_arm", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 16, 
+# 871 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 __builtin_offsetof (
+# 871 "./src/main/cli/settings.c"
+                                                                                                                                 armingConfig_t
+# 871 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 , 
+# 871 "./src/main/cli/settings.c"
+                                                                                                                                 gyro_cal_on_first_arm
+# 871 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 ) 
+# 871 "./src/main/cli/settings.c"
+                                                                                                                                                                                 },
+# 912 "./src/main/cli/settings.c"
+    { "deadband", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 32 }, 25, 
+# 912 "./src/main/cli/settings.c" 3 4
+                                                                                                                         __builtin_offsetof (
+# 912 "./src/main/cli/settings.c"
+                                                                                                                         rcControlsConfig_t
+# 912 "./src/main/cli/settings.c" 3 4
+                                                                                                                         , 
+# 912 "./src/main/cli/settings.c"
+                                                                                                                         deadband
+# 912 "./src/main/cli/settings.c" 3 4
+                                                                                                                         ) 
+# 912 "./src/main/cli/settings.c"
+                                                                                                                                                                },
+    { "yaw_deadband", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 100 }, 25, 
+# 913 "./src/main/cli/settings.c" 3 4
+                                                                                                                          __builtin_offsetof (
+# 913 "./src/main/cli/settings.c"
+                                                                                                                          rcControlsConfig_t
+# 913 "./src/main/cli/settings.c" 3 4
+                                                                                                                          , 
+# 913 "./src/main/cli/settings.c"
+                                                                                                                          yaw_deadband
+# 913 "./src/main/cli/settings.c" 3 4
+                                                                                                                          ) 
+# 913 "./src/main/cli/settings.c"
+                                                                                                                                                                     },
+    { "yaw_control_reversed", VAR_INT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 25, 
+# 914 "./src/main/cli/settings.c" 3 4
+                                                                                                                                      __builtin_offsetof (
+# 914 "./src/main/cli/settings.c"
+                                                                                                                                      rcControlsConfig_t
+# 914 "./src/main/cli/settings.c" 3 4
+                                                                                                                                      , 
+# 914 "./src/main/cli/settings.c"
+                                                                                                                                      yaw_control_reversed
+# 914 "./src/main/cli/settings.c" 3 4
+                                                                                                                                      ) 
+# 914 "./src/main/cli/settings.c"
+                                                                                                                                                                                         },
+
+
+    { "pid_process_denom", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 1, 16 }, 504, 
+# 917 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 917 "./src/main/cli/settings.c"
+                                                                                                                                     pidConfig_t
+# 917 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     , 
+# 917 "./src/main/cli/settings.c"
+                                                                                                                                     pid_process_denom
+# 917 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     ) 
+# 917 "./src/main/cli/settings.c"
+                                                                                                                                                                              },
+
+
+
+
+
+
+
+    { "dterm_lowpass_type", VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DTERM_LOWPASS_TYPE }, 14, 
+# 925 "./src/main/cli/settings.c" 3 4
+                                                                                                                                            __builtin_offsetof (
+# 925 "./src/main/cli/settings.c"
+                                                                                                                                            pidProfile_t
+# 925 "./src/main/cli/settings.c" 3 4
+                                                                                                                                            , 
+# 925 "./src/main/cli/settings.c"
+                                                                                                                                            dterm_filter_type
+# 925 "./src/main/cli/settings.c" 3 4
+                                                                                                                                            ) 
+# 925 "./src/main/cli/settings.c"
+                                                                                                                                                                                      },
+    { "dterm_lowpass_hz", VAR_INT16 | PROFILE_VALUE, .config.minmax = { 0, 4000 }, 14, 
+# 926 "./src/main/cli/settings.c" 3 4
+                                                                                                                             __builtin_offsetof (
+# 926 "./src/main/cli/settings.c"
+                                                                                                                             pidProfile_t
+# 926 "./src/main/cli/settings.c" 3 4
+                                                                                                                             , 
+# 926 "./src/main/cli/settings.c"
+                                                                                                                             dterm_lowpass_hz
+# 926 "./src/main/cli/settings.c" 3 4
+                                                                                                                             ) 
+# 926 "./src/main/cli/settings.c"
+                                                                                                                                                                      },
+    { "dterm_lowpass2_type", VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DTERM_LOWPASS_TYPE }, 14, 
+# 927 "./src/main/cli/settings.c" 3 4
+                                                                                                                                            __builtin_offsetof (
+# 927 "./src/main/cli/settings.c"
+                                                                                                                                            pidProfile_t
+# 927 "./src/main/cli/settings.c" 3 4
+                                                                                                                                            , 
+# 927 "./src/main/cli/settings.c"
+                                                                                                                                            dterm_filter2_type
+# 927 "./src/main/cli/settings.c" 3 4
+                                                                                                                                            ) 
+# 927 "./src/main/cli/settings.c"
+                                                                                                                                                                                       },
+    { "dterm_lowpass2_hz", VAR_INT16 | PROFILE_VALUE, .config.minmax = { 0, 4000 }, 14, 
+# 928 "./src/main/cli/settings.c" 3 4
+                                                                                                                             __builtin_offsetof (
+# 928 "./src/main/cli/settings.c"
+                                                                                                                             pidProfile_t
+# 928 "./src/main/cli/settings.c" 3 4
+                                                                                                                             , 
+# 928 "./src/main/cli/settings.c"
+                                                                                                                             dterm_lowpass2_hz
+# 928 "./src/main/cli/settings.c" 3 4
+                                                                                                                             ) 
+# 928 "./src/main/cli/settings.c"
+                                                                                                                                                                       },
+    { "dterm_notch_hz", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 4000 }, 14, 
+# 929 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 929 "./src/main/cli/settings.c"
+                                                                                                                                     pidProfile_t
+# 929 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     , 
+# 929 "./src/main/cli/settings.c"
+                                                                                                                                     dterm_notch_hz
+# 929 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     ) 
+# 929 "./src/main/cli/settings.c"
+                                                                                                                                                                            },
+    { "dterm_notch_cutoff", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 4000 }, 14, 
+# 930 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 930 "./src/main/cli/settings.c"
+                                                                                                                                     pidProfile_t
+# 930 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     , 
+# 930 "./src/main/cli/settings.c"
+                                                                                                                                     dterm_notch_cutoff
+# 930 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     ) 
+# 930 "./src/main/cli/settings.c"
+                                                                                                                                                                                },
+    { "vbat_pid_gain", VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 14, 
+# 931 "./src/main/cli/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 931 "./src/main/cli/settings.c"
+                                                                                                                                pidProfile_t
+# 931 "./src/main/cli/settings.c" 3 4
+                                                                                                                                , 
+# 931 "./src/main/cli/settings.c"
+                                                                                                                                vbatPidCompensation
+# 931 "./src/main/cli/settings.c" 3 4
+                                                                                                                                ) 
+# 931 "./src/main/cli/settings.c"
+                                                                                                                                                                            },
+    { "pid_at_min_throttle", VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 14, 
+# 932 "./src/main/cli/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 932 "./src/main/cli/settings.c"
+                                                                                                                                pidProfile_t
+# 932 "./src/main/cli/settings.c" 3 4
+                                                                                                                                , 
+# 932 "./src/main/cli/settings.c"
+                                                                                                                                pidAtMinThrottle
+# 932 "./src/main/cli/settings.c" 3 4
+                                                                                                                                ) 
+# 932 "./src/main/cli/settings.c"
+                                                                                                                                                                         },
+    { "anti_gravity_mode", VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ANTI_GRAVITY_MODE }, 14, 
+# 933 "./src/main/cli/settings.c" 3 4
+                                                                                                                                           __builtin_offsetof (
+# 933 "./src/main/cli/settings.c"
+                                                                                                                                           pidProfile_t
+# 933 "./src/main/cli/settings.c" 3 4
+                                                                                                                                           , 
+# 933 "./src/main/cli/settings.c"
+                                                                                                                                           antiGravityMode
+# 933 "./src/main/cli/settings.c" 3 4
+                                                                                                                                           ) 
+# 933 "./src/main/cli/settings.c"
+                                                                                                                                                                                   },
+    { "anti_gravity_threshold", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 20, 1000 }, 14, 
+# 934 "./src/main/cli/settings.c" 3 4
+                                                                                                                      __builtin_offsetof (
+# 934 "./src/main/cli/settings.c"
+                                                                                                                      pidProfile_t
+# 934 "./src/main/cli/settings.c" 3 4
+                                                                                                                      , 
+# 934 "./src/main/cli/settings.c"
+                                                                                                                      itermThrottleThreshold
+# 934 "./src/main/cli/settings.c" 3 4
+                                                                                                                      ) 
+# 934 "./src/main/cli/settings.c"
+                                                                                                                                                                     },
+    { "anti_gravity_gain", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 1000, 30000 }, 14, 
+# 935 "./src/main/cli/settings.c" 3 4
+                                                                                                                         __builtin_offsetof (
+# 935 "./src/main/cli/settings.c"
+                                                                                                                         pidProfile_t
+# 935 "./src/main/cli/settings.c" 3 4
+                                                                                                                         , 
+# 935 "./src/main/cli/settings.c"
+                                                                                                                         itermAcceleratorGain
+# 935 "./src/main/cli/settings.c" 3 4
+                                                                                                                         ) 
+# 935 "./src/main/cli/settings.c"
+                                                                                                                                                                      },
+    { "feedforward_transition", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 100 }, 14, 
+# 936 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 936 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 936 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 936 "./src/main/cli/settings.c"
+                                                                                                                    feedForwardTransition
+# 936 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 936 "./src/main/cli/settings.c"
+                                                                                                                                                                  },
+    { "acc_limit_yaw", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 500 }, 14, 
+# 937 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 937 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 937 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 937 "./src/main/cli/settings.c"
+                                                                                                                    yawRateAccelLimit
+# 937 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 937 "./src/main/cli/settings.c"
+                                                                                                                                                              },
+    { "acc_limit", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 500 }, 14, 
+# 938 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 938 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 938 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 938 "./src/main/cli/settings.c"
+                                                                                                                    rateAccelLimit
+# 938 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 938 "./src/main/cli/settings.c"
+                                                                                                                                                           },
+    { "crash_dthreshold", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 2000 }, 14, 
+# 939 "./src/main/cli/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 939 "./src/main/cli/settings.c"
+                                                                                                                     pidProfile_t
+# 939 "./src/main/cli/settings.c" 3 4
+                                                                                                                     , 
+# 939 "./src/main/cli/settings.c"
+                                                                                                                     crash_dthreshold
+# 939 "./src/main/cli/settings.c" 3 4
+                                                                                                                     ) 
+# 939 "./src/main/cli/settings.c"
+                                                                                                                                                              },
+    { "crash_gthreshold", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 2000 }, 14, 
+# 940 "./src/main/cli/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 940 "./src/main/cli/settings.c"
+                                                                                                                     pidProfile_t
+# 940 "./src/main/cli/settings.c" 3 4
+                                                                                                                     , 
+# 940 "./src/main/cli/settings.c"
+                                                                                                                     crash_gthreshold
+# 940 "./src/main/cli/settings.c" 3 4
+                                                                                                                     ) 
+# 940 "./src/main/cli/settings.c"
+                                                                                                                                                              },
+    { "crash_setpoint_threshold", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 2000 }, 14, 
+# 941 "./src/main/cli/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 941 "./src/main/cli/settings.c"
+                                                                                                                     pidProfile_t
+# 941 "./src/main/cli/settings.c" 3 4
+                                                                                                                     , 
+# 941 "./src/main/cli/settings.c"
+                                                                                                                     crash_setpoint_threshold
+# 941 "./src/main/cli/settings.c" 3 4
+                                                                                                                     ) 
+# 941 "./src/main/cli/settings.c"
+                                                                                                                                                                      },
+    { "crash_time", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 5000 }, 14, 
+# 942 "./src/main/cli/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 942 "./src/main/cli/settings.c"
+                                                                                                                     pidProfile_t
+# 942 "./src/main/cli/settings.c" 3 4
+                                                                                                                     , 
+# 942 "./src/main/cli/settings.c"
+                                                                                                                     crash_time
+# 942 "./src/main/cli/settings.c" 3 4
+                                                                                                                     ) 
+# 942 "./src/main/cli/settings.c"
+                                                                                                                                                        },
+    { "crash_delay", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 500 }, 14, 
+# 943 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 943 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 943 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 943 "./src/main/cli/settings.c"
+                                                                                                                    crash_delay
+# 943 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 943 "./src/main/cli/settings.c"
+                                                                                                                                                        },
+    { "crash_recovery_angle", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 30 }, 14, 
+# 944 "./src/main/cli/settings.c" 3 4
+                                                                                                                   __builtin_offsetof (
+# 944 "./src/main/cli/settings.c"
+                                                                                                                   pidProfile_t
+# 944 "./src/main/cli/settings.c" 3 4
+                                                                                                                   , 
+# 944 "./src/main/cli/settings.c"
+                                                                                                                   crash_recovery_angle
+# 944 "./src/main/cli/settings.c" 3 4
+                                                                                                                   ) 
+# 944 "./src/main/cli/settings.c"
+                                                                                                                                                                },
+    { "crash_recovery_rate", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 255 }, 14, 
+# 945 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 945 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 945 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 945 "./src/main/cli/settings.c"
+                                                                                                                    crash_recovery_rate
+# 945 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 945 "./src/main/cli/settings.c"
+                                                                                                                                                                },
+    { "crash_limit_yaw", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 1000 }, 14, 
+# 946 "./src/main/cli/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 946 "./src/main/cli/settings.c"
+                                                                                                                     pidProfile_t
+# 946 "./src/main/cli/settings.c" 3 4
+                                                                                                                     , 
+# 946 "./src/main/cli/settings.c"
+                                                                                                                     crash_limit_yaw
+# 946 "./src/main/cli/settings.c" 3 4
+                                                                                                                     ) 
+# 946 "./src/main/cli/settings.c"
+                                                                                                                                                             },
+    { "crash_recovery", VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_CRASH_RECOVERY }, 14, 
+# 947 "./src/main/cli/settings.c" 3 4
+                                                                                                                                        __builtin_offsetof (
+# 947 "./src/main/cli/settings.c"
+                                                                                                                                        pidProfile_t
+# 947 "./src/main/cli/settings.c" 3 4
+                                                                                                                                        , 
+# 947 "./src/main/cli/settings.c"
+                                                                                                                                        crash_recovery
+# 947 "./src/main/cli/settings.c" 3 4
+                                                                                                                                        ) 
+# 947 "./src/main/cli/settings.c"
+                                                                                                                                                                               },
+
+    { "iterm_rotation", VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 14, 
+# 949 "./src/main/cli/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 949 "./src/main/cli/settings.c"
+                                                                                                                                pidProfile_t
+# 949 "./src/main/cli/settings.c" 3 4
+                                                                                                                                , 
+# 949 "./src/main/cli/settings.c"
+                                                                                                                                iterm_rotation
+# 949 "./src/main/cli/settings.c" 3 4
+                                                                                                                                ) 
+# 949 "./src/main/cli/settings.c"
+                                                                                                                                                                       },
+
+
+
+
+    { "iterm_relax", VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ITERM_RELAX }, 14, 
+# 954 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     __builtin_offsetof (
+# 954 "./src/main/cli/settings.c"
+                                                                                                                                     pidProfile_t
+# 954 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     , 
+# 954 "./src/main/cli/settings.c"
+                                                                                                                                     iterm_relax
+# 954 "./src/main/cli/settings.c" 3 4
+                                                                                                                                     ) 
+# 954 "./src/main/cli/settings.c"
+                                                                                                                                                                         },
+    { "iterm_relax_type", VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ITERM_RELAX_TYPE }, 14, 
+# 955 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          __builtin_offsetof (
+# 955 "./src/main/cli/settings.c"
+                                                                                                                                          pidProfile_t
+# 955 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          , 
+# 955 "./src/main/cli/settings.c"
+                                                                                                                                          iterm_relax_type
+# 955 "./src/main/cli/settings.c" 3 4
+                                                                                                                                          ) 
+# 955 "./src/main/cli/settings.c"
+                                                                                                                                                                                   },
+    { "iterm_relax_cutoff", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 1, 100 }, 14, 
+# 956 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 956 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 956 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 956 "./src/main/cli/settings.c"
+                                                                                                                    iterm_relax_cutoff
+# 956 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 956 "./src/main/cli/settings.c"
+                                                                                                                                                               },
+
+    { "iterm_windup", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 30, 100 }, 14, 
+# 958 "./src/main/cli/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 958 "./src/main/cli/settings.c"
+                                                                                                                     pidProfile_t
+# 958 "./src/main/cli/settings.c" 3 4
+                                                                                                                     , 
+# 958 "./src/main/cli/settings.c"
+                                                                                                                     itermWindupPointPercent
+# 958 "./src/main/cli/settings.c" 3 4
+                                                                                                                     ) 
+# 958 "./src/main/cli/settings.c"
+                                                                                                                                                                     },
+    { "iterm_limit", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 500 }, 14, 
+# 959 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 959 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 959 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 959 "./src/main/cli/settings.c"
+                                                                                                                    itermLimit
+# 959 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 959 "./src/main/cli/settings.c"
+                                                                                                                                                       },
+    { "pidsum_limit", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 100, 1000 }, 14, 
+# 960 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                __builtin_offsetof (
+# 960 "./src/main/cli/settings.c"
+                                                                                                                                                pidProfile_t
+# 960 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                , 
+# 960 "./src/main/cli/settings.c"
+                                                                                                                                                pidSumLimit
+# 960 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                ) 
+# 960 "./src/main/cli/settings.c"
+                                                                                                                                                                                    },
+    { "pidsum_limit_yaw", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 100, 1000 }, 14, 
+# 961 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                __builtin_offsetof (
+# 961 "./src/main/cli/settings.c"
+                                                                                                                                                pidProfile_t
+# 961 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                , 
+# 961 "./src/main/cli/settings.c"
+                                                                                                                                                pidSumLimitYaw
+# 961 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                ) 
+# 961 "./src/main/cli/settings.c"
+                                                                                                                                                                                       },
+    { "yaw_lowpass_hz", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 500 }, 14, 
+# 962 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 962 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 962 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 962 "./src/main/cli/settings.c"
+                                                                                                                    yaw_lowpass_hz
+# 962 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 962 "./src/main/cli/settings.c"
+                                                                                                                                                           },
+
+
+
+
+
+
+
+    { "acro_trainer_angle_limit", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 10, 80 }, 14, 
+# 970 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 970 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 970 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 970 "./src/main/cli/settings.c"
+                                                                                                                    acro_trainer_angle_limit
+# 970 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 970 "./src/main/cli/settings.c"
+                                                                                                                                                                     },
+    { "acro_trainer_lookahead_ms", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 10, 200 }, 14, 
+# 971 "./src/main/cli/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 971 "./src/main/cli/settings.c"
+                                                                                                                     pidProfile_t
+# 971 "./src/main/cli/settings.c" 3 4
+                                                                                                                     , 
+# 971 "./src/main/cli/settings.c"
+                                                                                                                     acro_trainer_lookahead_ms
+# 971 "./src/main/cli/settings.c" 3 4
+                                                                                                                     ) 
+# 971 "./src/main/cli/settings.c"
+                                                                                                                                                                       },
+    { "acro_trainer_debug_axis", VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ACRO_TRAINER_DEBUG }, 14, 
+# 972 "./src/main/cli/settings.c" 3 4
+                                                                                                                                            __builtin_offsetof (
+# 972 "./src/main/cli/settings.c"
+                                                                                                                                            pidProfile_t
+# 972 "./src/main/cli/settings.c" 3 4
+                                                                                                                                            , 
+# 972 "./src/main/cli/settings.c"
+                                                                                                                                            acro_trainer_debug_axis
+# 972 "./src/main/cli/settings.c" 3 4
+                                                                                                                                            ) 
+# 972 "./src/main/cli/settings.c"
+                                                                                                                                                                                            },
+    { "acro_trainer_gain", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 25, 255 }, 14, 
+# 973 "./src/main/cli/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 973 "./src/main/cli/settings.c"
+                                                                                                                     pidProfile_t
+# 973 "./src/main/cli/settings.c" 3 4
+                                                                                                                     , 
+# 973 "./src/main/cli/settings.c"
+                                                                                                                     acro_trainer_gain
+# 973 "./src/main/cli/settings.c" 3 4
+                                                                                                                     ) 
+# 973 "./src/main/cli/settings.c"
+                                                                                                                                                               },
+
+
+    { "p_pitch", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 200 }, 14, 
+# 976 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 976 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 976 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 976 "./src/main/cli/settings.c"
+                                                                                                                    pid[PID_PITCH].P
+# 976 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 976 "./src/main/cli/settings.c"
+                                                                                                                                                             },
+    { "i_pitch", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 200 }, 14, 
+# 977 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 977 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 977 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 977 "./src/main/cli/settings.c"
+                                                                                                                    pid[PID_PITCH].I
+# 977 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 977 "./src/main/cli/settings.c"
+                                                                                                                                                             },
+    { "d_pitch", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 200 }, 14, 
+# 978 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 978 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 978 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 978 "./src/main/cli/settings.c"
+                                                                                                                    pid[PID_PITCH].D
+# 978 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 978 "./src/main/cli/settings.c"
+                                                                                                                                                             },
+    { "f_pitch", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 2000 },14, 
+# 979 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 979 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 979 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 979 "./src/main/cli/settings.c"
+                                                                                                                    pid[PID_PITCH].F
+# 979 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 979 "./src/main/cli/settings.c"
+                                                                                                                                                             },
+    { "p_roll", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 200 }, 14, 
+# 980 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 980 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 980 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 980 "./src/main/cli/settings.c"
+                                                                                                                    pid[PID_ROLL].P
+# 980 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 980 "./src/main/cli/settings.c"
+                                                                                                                                                            },
+    { "i_roll", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 200 }, 14, 
+# 981 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 981 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 981 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 981 "./src/main/cli/settings.c"
+                                                                                                                    pid[PID_ROLL].I
+# 981 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 981 "./src/main/cli/settings.c"
+                                                                                                                                                            },
+    { "d_roll", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 200 }, 14, 
+# 982 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 982 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 982 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 982 "./src/main/cli/settings.c"
+                                                                                                                    pid[PID_ROLL].D
+# 982 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 982 "./src/main/cli/settings.c"
+                                                                                                                                                            },
+    { "f_roll", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 2000 },14, 
+# 983 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 983 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 983 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 983 "./src/main/cli/settings.c"
+                                                                                                                    pid[PID_ROLL].F
+# 983 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 983 "./src/main/cli/settings.c"
+                                                                                                                                                            },
+    { "p_yaw", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 200 }, 14, 
+# 984 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 984 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 984 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 984 "./src/main/cli/settings.c"
+                                                                                                                    pid[PID_YAW].P
+# 984 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 984 "./src/main/cli/settings.c"
+                                                                                                                                                           },
+    { "i_yaw", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 200 }, 14, 
+# 985 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 985 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 985 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 985 "./src/main/cli/settings.c"
+                                                                                                                    pid[PID_YAW].I
+# 985 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 985 "./src/main/cli/settings.c"
+                                                                                                                                                           },
+    { "d_yaw", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 200 }, 14, 
+# 986 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 986 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 986 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 986 "./src/main/cli/settings.c"
+                                                                                                                    pid[PID_YAW].D
+# 986 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 986 "./src/main/cli/settings.c"
+                                                                                                                                                           },
+    { "f_yaw", VAR_UINT16 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 2000 },14, 
+# 987 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 987 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 987 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 987 "./src/main/cli/settings.c"
+                                                                                                                    pid[PID_YAW].F
+# 987 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 987 "./src/main/cli/settings.c"
+                                                                                                                                                           },
+
+    { "angle_level_strength", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 200 }, 14, 
+# 989 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 989 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 989 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 989 "./src/main/cli/settings.c"
+                                                                                                                    pid[PID_LEVEL].P
+# 989 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 989 "./src/main/cli/settings.c"
+                                                                                                                                                             },
+    { "horizon_level_strength", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 200 }, 14, 
+# 990 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 990 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 990 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 990 "./src/main/cli/settings.c"
+                                                                                                                    pid[PID_LEVEL].I
+# 990 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 990 "./src/main/cli/settings.c"
+                                                                                                                                                             },
+    { "horizon_transition", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 200 }, 14, 
+# 991 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 991 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 991 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 991 "./src/main/cli/settings.c"
+                                                                                                                    pid[PID_LEVEL].D
+# 991 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 991 "./src/main/cli/settings.c"
+                                                                                                                                                             },
+
+    { "level_limit", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 10, 90 }, 14, 
+# 993 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 993 "./src/main/cli/settings.c"
+                                                                                                                    pidProfile_t
+# 993 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 993 "./src/main/cli/settings.c"
+                                                                                                                    levelAngleLimit
+# 993 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 993 "./src/main/cli/settings.c"
+                                                                                                                                                            },
+
+    { "horizon_tilt_effect", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 0, 250 }, 14, 
+# 995 "./src/main/cli/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 995 "./src/main/cli/settings.c"
+                                                                                                                     pidProfile_t
+# 995 "./src/main/cli/settings.c" 3 4
+                                                                                                                     , 
+# 995 "./src/main/cli/settings.c"
+                                                                                                                     horizon_tilt_effect
+# 995 "./src/main/cli/settings.c" 3 4
+                                                                                                                     ) 
+# 995 "./src/main/cli/settings.c"
+                                                                                                                                                                 },
+    { "horizon_tilt_expert_mode", VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 14, 
+# 996 "./src/main/cli/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 996 "./src/main/cli/settings.c"
+                                                                                                                                pidProfile_t
+# 996 "./src/main/cli/settings.c" 3 4
+                                                                                                                                , 
+# 996 "./src/main/cli/settings.c"
+                                                                                                                                horizon_tilt_expert_mode
+# 996 "./src/main/cli/settings.c" 3 4
+                                                                                                                                ) 
+# 996 "./src/main/cli/settings.c"
+                                                                                                                                                                                 },
+# 1018 "./src/main/cli/settings.c"
+    { "motor_output_limit", VAR_UINT8 | PROFILE_VALUE, .config.minmaxUnsigned = { 1, 100 }, 14, 
+# 1018 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                            __builtin_offsetof (
+# 1018 "./src/main/cli/settings.c"
+                                                                                                                                                                            pidProfile_t
+# 1018 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                            , 
+# 1018 "./src/main/cli/settings.c"
+                                                                                                                                                                            motor_output_limit
+# 1018 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                                            ) 
+# 1018 "./src/main/cli/settings.c"
+                                                                                                                                                                                                                       },
+    { "auto_profile_cell_count", VAR_INT8 | PROFILE_VALUE, .config.minmax = { AUTO_PROFILE_CELL_COUNT_CHANGE, 8 }, 14, 
+# 1019 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                               __builtin_offsetof (
+# 1019 "./src/main/cli/settings.c"
+                                                                                                                                                               pidProfile_t
+# 1019 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                               , 
+# 1019 "./src/main/cli/settings.c"
+                                                                                                                                                               auto_profile_cell_count
+# 1019 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                               ) 
+# 1019 "./src/main/cli/settings.c"
+                                                                                                                                                                                                               },
+# 1038 "./src/main/cli/settings.c"
+    { "tlm_inverted", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 31, 
+# 1038 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 1038 "./src/main/cli/settings.c"
+                                                                                                                                    telemetryConfig_t
+# 1038 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    , 
+# 1038 "./src/main/cli/settings.c"
+                                                                                                                                    telemetry_inverted
+# 1038 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    ) 
+# 1038 "./src/main/cli/settings.c"
+                                                                                                                                                                                    },
+    { "tlm_halfduplex", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 31, 
+# 1039 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 1039 "./src/main/cli/settings.c"
+                                                                                                                                    telemetryConfig_t
+# 1039 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    , 
+# 1039 "./src/main/cli/settings.c"
+                                                                                                                                    halfDuplex
+# 1039 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    ) 
+# 1039 "./src/main/cli/settings.c"
+                                                                                                                                                                            },
+# 1049 "./src/main/cli/settings.c"
+    { "hott_alarm_int", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 120 }, 31, 
+# 1049 "./src/main/cli/settings.c" 3 4
+                                                                                                                        __builtin_offsetof (
+# 1049 "./src/main/cli/settings.c"
+                                                                                                                        telemetryConfig_t
+# 1049 "./src/main/cli/settings.c" 3 4
+                                                                                                                        , 
+# 1049 "./src/main/cli/settings.c"
+                                                                                                                        hottAlarmSoundInterval
+# 1049 "./src/main/cli/settings.c" 3 4
+                                                                                                                        ) 
+# 1049 "./src/main/cli/settings.c"
+                                                                                                                                                                            },
+    { "pid_in_tlm", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = {TABLE_OFF_ON }, 31, 
+# 1050 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   __builtin_offsetof (
+# 1050 "./src/main/cli/settings.c"
+                                                                                                                                   telemetryConfig_t
+# 1050 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   , 
+# 1050 "./src/main/cli/settings.c"
+                                                                                                                                   pidValuesAsTelemetry
+# 1050 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   ) 
+# 1050 "./src/main/cli/settings.c"
+                                                                                                                                                                                     },
+    { "report_cell_voltage", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 31, 
+# 1051 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 1051 "./src/main/cli/settings.c"
+                                                                                                                                    telemetryConfig_t
+# 1051 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    , 
+# 1051 "./src/main/cli/settings.c"
+                                                                                                                                    report_cell_voltage
+# 1051 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    ) 
+# 1051 "./src/main/cli/settings.c"
+                                                                                                                                                                                     },
+# 1062 "./src/main/cli/settings.c"
+    { "telemetry_disabled_voltage", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((SENSOR_VOLTAGE)/2L>>31 > 0) + (16*(((SENSOR_VOLTAGE)*1L >>16*((SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((SENSOR_VOLTAGE)/2L>>31 > 0))>65535L) + (8*((((SENSOR_VOLTAGE)*1L >>16*((SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((SENSOR_VOLTAGE)/2L>>31 > 0))*1L >>16*(((SENSOR_VOLTAGE)*1L >>16*((SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((SENSOR_VOLTAGE)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((SENSOR_VOLTAGE)*1L >>16*((SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((SENSOR_VOLTAGE)/2L>>31 > 0))*1L >>16*(((SENSOR_VOLTAGE)*1L >>16*((SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((SENSOR_VOLTAGE)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_VOLTAGE)*1L >>16*((SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((SENSOR_VOLTAGE)/2L>>31 > 0))*1L >>16*(((SENSOR_VOLTAGE)*1L >>16*((SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((SENSOR_VOLTAGE)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((SENSOR_VOLTAGE)*1L >>16*((SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((SENSOR_VOLTAGE)/2L>>31 > 0))*1L >>16*(((SENSOR_VOLTAGE)*1L >>16*((SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((SENSOR_VOLTAGE)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_VOLTAGE)*1L >>16*((SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((SENSOR_VOLTAGE)/2L>>31 > 0))*1L >>16*(((SENSOR_VOLTAGE)*1L >>16*((SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((SENSOR_VOLTAGE)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1062 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1062 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1062 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1062 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1062 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1062 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_current", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((SENSOR_CURRENT)/2L>>31 > 0) + (16*(((SENSOR_CURRENT)*1L >>16*((SENSOR_CURRENT)/2L>>31 > 0) >>16*((SENSOR_CURRENT)/2L>>31 > 0))>65535L) + (8*((((SENSOR_CURRENT)*1L >>16*((SENSOR_CURRENT)/2L>>31 > 0) >>16*((SENSOR_CURRENT)/2L>>31 > 0))*1L >>16*(((SENSOR_CURRENT)*1L >>16*((SENSOR_CURRENT)/2L>>31 > 0) >>16*((SENSOR_CURRENT)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((SENSOR_CURRENT)*1L >>16*((SENSOR_CURRENT)/2L>>31 > 0) >>16*((SENSOR_CURRENT)/2L>>31 > 0))*1L >>16*(((SENSOR_CURRENT)*1L >>16*((SENSOR_CURRENT)/2L>>31 > 0) >>16*((SENSOR_CURRENT)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_CURRENT)*1L >>16*((SENSOR_CURRENT)/2L>>31 > 0) >>16*((SENSOR_CURRENT)/2L>>31 > 0))*1L >>16*(((SENSOR_CURRENT)*1L >>16*((SENSOR_CURRENT)/2L>>31 > 0) >>16*((SENSOR_CURRENT)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((SENSOR_CURRENT)*1L >>16*((SENSOR_CURRENT)/2L>>31 > 0) >>16*((SENSOR_CURRENT)/2L>>31 > 0))*1L >>16*(((SENSOR_CURRENT)*1L >>16*((SENSOR_CURRENT)/2L>>31 > 0) >>16*((SENSOR_CURRENT)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_CURRENT)*1L >>16*((SENSOR_CURRENT)/2L>>31 > 0) >>16*((SENSOR_CURRENT)/2L>>31 > 0))*1L >>16*(((SENSOR_CURRENT)*1L >>16*((SENSOR_CURRENT)/2L>>31 > 0) >>16*((SENSOR_CURRENT)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1063 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1063 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1063 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1063 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1063 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1063 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_fuel", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((SENSOR_FUEL)/2L>>31 > 0) + (16*(((SENSOR_FUEL)*1L >>16*((SENSOR_FUEL)/2L>>31 > 0) >>16*((SENSOR_FUEL)/2L>>31 > 0))>65535L) + (8*((((SENSOR_FUEL)*1L >>16*((SENSOR_FUEL)/2L>>31 > 0) >>16*((SENSOR_FUEL)/2L>>31 > 0))*1L >>16*(((SENSOR_FUEL)*1L >>16*((SENSOR_FUEL)/2L>>31 > 0) >>16*((SENSOR_FUEL)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((SENSOR_FUEL)*1L >>16*((SENSOR_FUEL)/2L>>31 > 0) >>16*((SENSOR_FUEL)/2L>>31 > 0))*1L >>16*(((SENSOR_FUEL)*1L >>16*((SENSOR_FUEL)/2L>>31 > 0) >>16*((SENSOR_FUEL)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_FUEL)*1L >>16*((SENSOR_FUEL)/2L>>31 > 0) >>16*((SENSOR_FUEL)/2L>>31 > 0))*1L >>16*(((SENSOR_FUEL)*1L >>16*((SENSOR_FUEL)/2L>>31 > 0) >>16*((SENSOR_FUEL)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((SENSOR_FUEL)*1L >>16*((SENSOR_FUEL)/2L>>31 > 0) >>16*((SENSOR_FUEL)/2L>>31 > 0))*1L >>16*(((SENSOR_FUEL)*1L >>16*((SENSOR_FUEL)/2L>>31 > 0) >>16*((SENSOR_FUEL)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_FUEL)*1L >>16*((SENSOR_FUEL)/2L>>31 > 0) >>16*((SENSOR_FUEL)/2L>>31 > 0))*1L >>16*(((SENSOR_FUEL)*1L >>16*((SENSOR_FUEL)/2L>>31 > 0) >>16*((SENSOR_FUEL)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1064 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1064 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1064 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1064 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1064 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1064 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_mode", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((SENSOR_MODE)/2L>>31 > 0) + (16*(((SENSOR_MODE)*1L >>16*((SENSOR_MODE)/2L>>31 > 0) >>16*((SENSOR_MODE)/2L>>31 > 0))>65535L) + (8*((((SENSOR_MODE)*1L >>16*((SENSOR_MODE)/2L>>31 > 0) >>16*((SENSOR_MODE)/2L>>31 > 0))*1L >>16*(((SENSOR_MODE)*1L >>16*((SENSOR_MODE)/2L>>31 > 0) >>16*((SENSOR_MODE)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((SENSOR_MODE)*1L >>16*((SENSOR_MODE)/2L>>31 > 0) >>16*((SENSOR_MODE)/2L>>31 > 0))*1L >>16*(((SENSOR_MODE)*1L >>16*((SENSOR_MODE)/2L>>31 > 0) >>16*((SENSOR_MODE)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_MODE)*1L >>16*((SENSOR_MODE)/2L>>31 > 0) >>16*((SENSOR_MODE)/2L>>31 > 0))*1L >>16*(((SENSOR_MODE)*1L >>16*((SENSOR_MODE)/2L>>31 > 0) >>16*((SENSOR_MODE)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((SENSOR_MODE)*1L >>16*((SENSOR_MODE)/2L>>31 > 0) >>16*((SENSOR_MODE)/2L>>31 > 0))*1L >>16*(((SENSOR_MODE)*1L >>16*((SENSOR_MODE)/2L>>31 > 0) >>16*((SENSOR_MODE)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_MODE)*1L >>16*((SENSOR_MODE)/2L>>31 > 0) >>16*((SENSOR_MODE)/2L>>31 > 0))*1L >>16*(((SENSOR_MODE)*1L >>16*((SENSOR_MODE)/2L>>31 > 0) >>16*((SENSOR_MODE)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1065 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1065 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1065 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1065 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1065 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1065 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_acc_x", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((SENSOR_ACC_X)/2L>>31 > 0) + (16*(((SENSOR_ACC_X)*1L >>16*((SENSOR_ACC_X)/2L>>31 > 0) >>16*((SENSOR_ACC_X)/2L>>31 > 0))>65535L) + (8*((((SENSOR_ACC_X)*1L >>16*((SENSOR_ACC_X)/2L>>31 > 0) >>16*((SENSOR_ACC_X)/2L>>31 > 0))*1L >>16*(((SENSOR_ACC_X)*1L >>16*((SENSOR_ACC_X)/2L>>31 > 0) >>16*((SENSOR_ACC_X)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((SENSOR_ACC_X)*1L >>16*((SENSOR_ACC_X)/2L>>31 > 0) >>16*((SENSOR_ACC_X)/2L>>31 > 0))*1L >>16*(((SENSOR_ACC_X)*1L >>16*((SENSOR_ACC_X)/2L>>31 > 0) >>16*((SENSOR_ACC_X)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_ACC_X)*1L >>16*((SENSOR_ACC_X)/2L>>31 > 0) >>16*((SENSOR_ACC_X)/2L>>31 > 0))*1L >>16*(((SENSOR_ACC_X)*1L >>16*((SENSOR_ACC_X)/2L>>31 > 0) >>16*((SENSOR_ACC_X)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((SENSOR_ACC_X)*1L >>16*((SENSOR_ACC_X)/2L>>31 > 0) >>16*((SENSOR_ACC_X)/2L>>31 > 0))*1L >>16*(((SENSOR_ACC_X)*1L >>16*((SENSOR_ACC_X)/2L>>31 > 0) >>16*((SENSOR_ACC_X)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_ACC_X)*1L >>16*((SENSOR_ACC_X)/2L>>31 > 0) >>16*((SENSOR_ACC_X)/2L>>31 > 0))*1L >>16*(((SENSOR_ACC_X)*1L >>16*((SENSOR_ACC_X)/2L>>31 > 0) >>16*((SENSOR_ACC_X)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1066 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1066 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1066 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1066 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1066 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1066 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_acc_y", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((SENSOR_ACC_Y)/2L>>31 > 0) + (16*(((SENSOR_ACC_Y)*1L >>16*((SENSOR_ACC_Y)/2L>>31 > 0) >>16*((SENSOR_ACC_Y)/2L>>31 > 0))>65535L) + (8*((((SENSOR_ACC_Y)*1L >>16*((SENSOR_ACC_Y)/2L>>31 > 0) >>16*((SENSOR_ACC_Y)/2L>>31 > 0))*1L >>16*(((SENSOR_ACC_Y)*1L >>16*((SENSOR_ACC_Y)/2L>>31 > 0) >>16*((SENSOR_ACC_Y)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((SENSOR_ACC_Y)*1L >>16*((SENSOR_ACC_Y)/2L>>31 > 0) >>16*((SENSOR_ACC_Y)/2L>>31 > 0))*1L >>16*(((SENSOR_ACC_Y)*1L >>16*((SENSOR_ACC_Y)/2L>>31 > 0) >>16*((SENSOR_ACC_Y)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_ACC_Y)*1L >>16*((SENSOR_ACC_Y)/2L>>31 > 0) >>16*((SENSOR_ACC_Y)/2L>>31 > 0))*1L >>16*(((SENSOR_ACC_Y)*1L >>16*((SENSOR_ACC_Y)/2L>>31 > 0) >>16*((SENSOR_ACC_Y)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((SENSOR_ACC_Y)*1L >>16*((SENSOR_ACC_Y)/2L>>31 > 0) >>16*((SENSOR_ACC_Y)/2L>>31 > 0))*1L >>16*(((SENSOR_ACC_Y)*1L >>16*((SENSOR_ACC_Y)/2L>>31 > 0) >>16*((SENSOR_ACC_Y)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_ACC_Y)*1L >>16*((SENSOR_ACC_Y)/2L>>31 > 0) >>16*((SENSOR_ACC_Y)/2L>>31 > 0))*1L >>16*(((SENSOR_ACC_Y)*1L >>16*((SENSOR_ACC_Y)/2L>>31 > 0) >>16*((SENSOR_ACC_Y)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1067 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1067 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1067 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1067 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1067 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1067 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_acc_z", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((SENSOR_ACC_Z)/2L>>31 > 0) + (16*(((SENSOR_ACC_Z)*1L >>16*((SENSOR_ACC_Z)/2L>>31 > 0) >>16*((SENSOR_ACC_Z)/2L>>31 > 0))>65535L) + (8*((((SENSOR_ACC_Z)*1L >>16*((SENSOR_ACC_Z)/2L>>31 > 0) >>16*((SENSOR_ACC_Z)/2L>>31 > 0))*1L >>16*(((SENSOR_ACC_Z)*1L >>16*((SENSOR_ACC_Z)/2L>>31 > 0) >>16*((SENSOR_ACC_Z)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((SENSOR_ACC_Z)*1L >>16*((SENSOR_ACC_Z)/2L>>31 > 0) >>16*((SENSOR_ACC_Z)/2L>>31 > 0))*1L >>16*(((SENSOR_ACC_Z)*1L >>16*((SENSOR_ACC_Z)/2L>>31 > 0) >>16*((SENSOR_ACC_Z)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_ACC_Z)*1L >>16*((SENSOR_ACC_Z)/2L>>31 > 0) >>16*((SENSOR_ACC_Z)/2L>>31 > 0))*1L >>16*(((SENSOR_ACC_Z)*1L >>16*((SENSOR_ACC_Z)/2L>>31 > 0) >>16*((SENSOR_ACC_Z)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((SENSOR_ACC_Z)*1L >>16*((SENSOR_ACC_Z)/2L>>31 > 0) >>16*((SENSOR_ACC_Z)/2L>>31 > 0))*1L >>16*(((SENSOR_ACC_Z)*1L >>16*((SENSOR_ACC_Z)/2L>>31 > 0) >>16*((SENSOR_ACC_Z)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_ACC_Z)*1L >>16*((SENSOR_ACC_Z)/2L>>31 > 0) >>16*((SENSOR_ACC_Z)/2L>>31 > 0))*1L >>16*(((SENSOR_ACC_Z)*1L >>16*((SENSOR_ACC_Z)/2L>>31 > 0) >>16*((SENSOR_ACC_Z)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1068 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1068 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1068 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1068 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1068 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1068 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_pitch", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((SENSOR_PITCH)/2L>>31 > 0) + (16*(((SENSOR_PITCH)*1L >>16*((SENSOR_PITCH)/2L>>31 > 0) >>16*((SENSOR_PITCH)/2L>>31 > 0))>65535L) + (8*((((SENSOR_PITCH)*1L >>16*((SENSOR_PITCH)/2L>>31 > 0) >>16*((SENSOR_PITCH)/2L>>31 > 0))*1L >>16*(((SENSOR_PITCH)*1L >>16*((SENSOR_PITCH)/2L>>31 > 0) >>16*((SENSOR_PITCH)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((SENSOR_PITCH)*1L >>16*((SENSOR_PITCH)/2L>>31 > 0) >>16*((SENSOR_PITCH)/2L>>31 > 0))*1L >>16*(((SENSOR_PITCH)*1L >>16*((SENSOR_PITCH)/2L>>31 > 0) >>16*((SENSOR_PITCH)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_PITCH)*1L >>16*((SENSOR_PITCH)/2L>>31 > 0) >>16*((SENSOR_PITCH)/2L>>31 > 0))*1L >>16*(((SENSOR_PITCH)*1L >>16*((SENSOR_PITCH)/2L>>31 > 0) >>16*((SENSOR_PITCH)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((SENSOR_PITCH)*1L >>16*((SENSOR_PITCH)/2L>>31 > 0) >>16*((SENSOR_PITCH)/2L>>31 > 0))*1L >>16*(((SENSOR_PITCH)*1L >>16*((SENSOR_PITCH)/2L>>31 > 0) >>16*((SENSOR_PITCH)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_PITCH)*1L >>16*((SENSOR_PITCH)/2L>>31 > 0) >>16*((SENSOR_PITCH)/2L>>31 > 0))*1L >>16*(((SENSOR_PITCH)*1L >>16*((SENSOR_PITCH)/2L>>31 > 0) >>16*((SENSOR_PITCH)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1069 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1069 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1069 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1069 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1069 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1069 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_roll", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((SENSOR_ROLL)/2L>>31 > 0) + (16*(((SENSOR_ROLL)*1L >>16*((SENSOR_ROLL)/2L>>31 > 0) >>16*((SENSOR_ROLL)/2L>>31 > 0))>65535L) + (8*((((SENSOR_ROLL)*1L >>16*((SENSOR_ROLL)/2L>>31 > 0) >>16*((SENSOR_ROLL)/2L>>31 > 0))*1L >>16*(((SENSOR_ROLL)*1L >>16*((SENSOR_ROLL)/2L>>31 > 0) >>16*((SENSOR_ROLL)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((SENSOR_ROLL)*1L >>16*((SENSOR_ROLL)/2L>>31 > 0) >>16*((SENSOR_ROLL)/2L>>31 > 0))*1L >>16*(((SENSOR_ROLL)*1L >>16*((SENSOR_ROLL)/2L>>31 > 0) >>16*((SENSOR_ROLL)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_ROLL)*1L >>16*((SENSOR_ROLL)/2L>>31 > 0) >>16*((SENSOR_ROLL)/2L>>31 > 0))*1L >>16*(((SENSOR_ROLL)*1L >>16*((SENSOR_ROLL)/2L>>31 > 0) >>16*((SENSOR_ROLL)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((SENSOR_ROLL)*1L >>16*((SENSOR_ROLL)/2L>>31 > 0) >>16*((SENSOR_ROLL)/2L>>31 > 0))*1L >>16*(((SENSOR_ROLL)*1L >>16*((SENSOR_ROLL)/2L>>31 > 0) >>16*((SENSOR_ROLL)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_ROLL)*1L >>16*((SENSOR_ROLL)/2L>>31 > 0) >>16*((SENSOR_ROLL)/2L>>31 > 0))*1L >>16*(((SENSOR_ROLL)*1L >>16*((SENSOR_ROLL)/2L>>31 > 0) >>16*((SENSOR_ROLL)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1070 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1070 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1070 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1070 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1070 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1070 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_heading", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((SENSOR_HEADING)/2L>>31 > 0) + (16*(((SENSOR_HEADING)*1L >>16*((SENSOR_HEADING)/2L>>31 > 0) >>16*((SENSOR_HEADING)/2L>>31 > 0))>65535L) + (8*((((SENSOR_HEADING)*1L >>16*((SENSOR_HEADING)/2L>>31 > 0) >>16*((SENSOR_HEADING)/2L>>31 > 0))*1L >>16*(((SENSOR_HEADING)*1L >>16*((SENSOR_HEADING)/2L>>31 > 0) >>16*((SENSOR_HEADING)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((SENSOR_HEADING)*1L >>16*((SENSOR_HEADING)/2L>>31 > 0) >>16*((SENSOR_HEADING)/2L>>31 > 0))*1L >>16*(((SENSOR_HEADING)*1L >>16*((SENSOR_HEADING)/2L>>31 > 0) >>16*((SENSOR_HEADING)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_HEADING)*1L >>16*((SENSOR_HEADING)/2L>>31 > 0) >>16*((SENSOR_HEADING)/2L>>31 > 0))*1L >>16*(((SENSOR_HEADING)*1L >>16*((SENSOR_HEADING)/2L>>31 > 0) >>16*((SENSOR_HEADING)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((SENSOR_HEADING)*1L >>16*((SENSOR_HEADING)/2L>>31 > 0) >>16*((SENSOR_HEADING)/2L>>31 > 0))*1L >>16*(((SENSOR_HEADING)*1L >>16*((SENSOR_HEADING)/2L>>31 > 0) >>16*((SENSOR_HEADING)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_HEADING)*1L >>16*((SENSOR_HEADING)/2L>>31 > 0) >>16*((SENSOR_HEADING)/2L>>31 > 0))*1L >>16*(((SENSOR_HEADING)*1L >>16*((SENSOR_HEADING)/2L>>31 > 0) >>16*((SENSOR_HEADING)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1071 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1071 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1071 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1071 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1071 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1071 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_altitude", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((SENSOR_ALTITUDE)/2L>>31 > 0) + (16*(((SENSOR_ALTITUDE)*1L >>16*((SENSOR_ALTITUDE)/2L>>31 > 0) >>16*((SENSOR_ALTITUDE)/2L>>31 > 0))>65535L) + (8*((((SENSOR_ALTITUDE)*1L >>16*((SENSOR_ALTITUDE)/2L>>31 > 0) >>16*((SENSOR_ALTITUDE)/2L>>31 > 0))*1L >>16*(((SENSOR_ALTITUDE)*1L >>16*((SENSOR_ALTITUDE)/2L>>31 > 0) >>16*((SENSOR_ALTITUDE)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((SENSOR_ALTITUDE)*1L >>16*((SENSOR_ALTITUDE)/2L>>31 > 0) >>16*((SENSOR_ALTITUDE)/2L>>31 > 0))*1L >>16*(((SENSOR_ALTITUDE)*1L >>16*((SENSOR_ALTITUDE)/2L>>31 > 0) >>16*((SENSOR_ALTITUDE)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_ALTITUDE)*1L >>16*((SENSOR_ALTITUDE)/2L>>31 > 0) >>16*((SENSOR_ALTITUDE)/2L>>31 > 0))*1L >>16*(((SENSOR_ALTITUDE)*1L >>16*((SENSOR_ALTITUDE)/2L>>31 > 0) >>16*((SENSOR_ALTITUDE)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((SENSOR_ALTITUDE)*1L >>16*((SENSOR_ALTITUDE)/2L>>31 > 0) >>16*((SENSOR_ALTITUDE)/2L>>31 > 0))*1L >>16*(((SENSOR_ALTITUDE)*1L >>16*((SENSOR_ALTITUDE)/2L>>31 > 0) >>16*((SENSOR_ALTITUDE)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_ALTITUDE)*1L >>16*((SENSOR_ALTITUDE)/2L>>31 > 0) >>16*((SENSOR_ALTITUDE)/2L>>31 > 0))*1L >>16*(((SENSOR_ALTITUDE)*1L >>16*((SENSOR_ALTITUDE)/2L>>31 > 0) >>16*((SENSOR_ALTITUDE)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1072 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1072 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1072 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1072 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1072 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1072 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_vario", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((SENSOR_VARIO)/2L>>31 > 0) + (16*(((SENSOR_VARIO)*1L >>16*((SENSOR_VARIO)/2L>>31 > 0) >>16*((SENSOR_VARIO)/2L>>31 > 0))>65535L) + (8*((((SENSOR_VARIO)*1L >>16*((SENSOR_VARIO)/2L>>31 > 0) >>16*((SENSOR_VARIO)/2L>>31 > 0))*1L >>16*(((SENSOR_VARIO)*1L >>16*((SENSOR_VARIO)/2L>>31 > 0) >>16*((SENSOR_VARIO)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((SENSOR_VARIO)*1L >>16*((SENSOR_VARIO)/2L>>31 > 0) >>16*((SENSOR_VARIO)/2L>>31 > 0))*1L >>16*(((SENSOR_VARIO)*1L >>16*((SENSOR_VARIO)/2L>>31 > 0) >>16*((SENSOR_VARIO)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_VARIO)*1L >>16*((SENSOR_VARIO)/2L>>31 > 0) >>16*((SENSOR_VARIO)/2L>>31 > 0))*1L >>16*(((SENSOR_VARIO)*1L >>16*((SENSOR_VARIO)/2L>>31 > 0) >>16*((SENSOR_VARIO)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((SENSOR_VARIO)*1L >>16*((SENSOR_VARIO)/2L>>31 > 0) >>16*((SENSOR_VARIO)/2L>>31 > 0))*1L >>16*(((SENSOR_VARIO)*1L >>16*((SENSOR_VARIO)/2L>>31 > 0) >>16*((SENSOR_VARIO)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_VARIO)*1L >>16*((SENSOR_VARIO)/2L>>31 > 0) >>16*((SENSOR_VARIO)/2L>>31 > 0))*1L >>16*(((SENSOR_VARIO)*1L >>16*((SENSOR_VARIO)/2L>>31 > 0) >>16*((SENSOR_VARIO)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1073 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1073 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1073 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1073 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1073 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1073 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_lat_long", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((SENSOR_LAT_LONG)/2L>>31 > 0) + (16*(((SENSOR_LAT_LONG)*1L >>16*((SENSOR_LAT_LONG)/2L>>31 > 0) >>16*((SENSOR_LAT_LONG)/2L>>31 > 0))>65535L) + (8*((((SENSOR_LAT_LONG)*1L >>16*((SENSOR_LAT_LONG)/2L>>31 > 0) >>16*((SENSOR_LAT_LONG)/2L>>31 > 0))*1L >>16*(((SENSOR_LAT_LONG)*1L >>16*((SENSOR_LAT_LONG)/2L>>31 > 0) >>16*((SENSOR_LAT_LONG)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((SENSOR_LAT_LONG)*1L >>16*((SENSOR_LAT_LONG)/2L>>31 > 0) >>16*((SENSOR_LAT_LONG)/2L>>31 > 0))*1L >>16*(((SENSOR_LAT_LONG)*1L >>16*((SENSOR_LAT_LONG)/2L>>31 > 0) >>16*((SENSOR_LAT_LONG)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_LAT_LONG)*1L >>16*((SENSOR_LAT_LONG)/2L>>31 > 0) >>16*((SENSOR_LAT_LONG)/2L>>31 > 0))*1L >>16*(((SENSOR_LAT_LONG)*1L >>16*((SENSOR_LAT_LONG)/2L>>31 > 0) >>16*((SENSOR_LAT_LONG)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((SENSOR_LAT_LONG)*1L >>16*((SENSOR_LAT_LONG)/2L>>31 > 0) >>16*((SENSOR_LAT_LONG)/2L>>31 > 0))*1L >>16*(((SENSOR_LAT_LONG)*1L >>16*((SENSOR_LAT_LONG)/2L>>31 > 0) >>16*((SENSOR_LAT_LONG)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_LAT_LONG)*1L >>16*((SENSOR_LAT_LONG)/2L>>31 > 0) >>16*((SENSOR_LAT_LONG)/2L>>31 > 0))*1L >>16*(((SENSOR_LAT_LONG)*1L >>16*((SENSOR_LAT_LONG)/2L>>31 > 0) >>16*((SENSOR_LAT_LONG)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1074 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1074 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1074 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1074 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1074 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1074 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_ground_speed", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((SENSOR_GROUND_SPEED)/2L>>31 > 0) + (16*(((SENSOR_GROUND_SPEED)*1L >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0) >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0))>65535L) + (8*((((SENSOR_GROUND_SPEED)*1L >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0) >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0))*1L >>16*(((SENSOR_GROUND_SPEED)*1L >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0) >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((SENSOR_GROUND_SPEED)*1L >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0) >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0))*1L >>16*(((SENSOR_GROUND_SPEED)*1L >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0) >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_GROUND_SPEED)*1L >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0) >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0))*1L >>16*(((SENSOR_GROUND_SPEED)*1L >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0) >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((SENSOR_GROUND_SPEED)*1L >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0) >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0))*1L >>16*(((SENSOR_GROUND_SPEED)*1L >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0) >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_GROUND_SPEED)*1L >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0) >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0))*1L >>16*(((SENSOR_GROUND_SPEED)*1L >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0) >>16*((SENSOR_GROUND_SPEED)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1075 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1075 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1075 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1075 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1075 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1075 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_distance", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((SENSOR_DISTANCE)/2L>>31 > 0) + (16*(((SENSOR_DISTANCE)*1L >>16*((SENSOR_DISTANCE)/2L>>31 > 0) >>16*((SENSOR_DISTANCE)/2L>>31 > 0))>65535L) + (8*((((SENSOR_DISTANCE)*1L >>16*((SENSOR_DISTANCE)/2L>>31 > 0) >>16*((SENSOR_DISTANCE)/2L>>31 > 0))*1L >>16*(((SENSOR_DISTANCE)*1L >>16*((SENSOR_DISTANCE)/2L>>31 > 0) >>16*((SENSOR_DISTANCE)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((SENSOR_DISTANCE)*1L >>16*((SENSOR_DISTANCE)/2L>>31 > 0) >>16*((SENSOR_DISTANCE)/2L>>31 > 0))*1L >>16*(((SENSOR_DISTANCE)*1L >>16*((SENSOR_DISTANCE)/2L>>31 > 0) >>16*((SENSOR_DISTANCE)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_DISTANCE)*1L >>16*((SENSOR_DISTANCE)/2L>>31 > 0) >>16*((SENSOR_DISTANCE)/2L>>31 > 0))*1L >>16*(((SENSOR_DISTANCE)*1L >>16*((SENSOR_DISTANCE)/2L>>31 > 0) >>16*((SENSOR_DISTANCE)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((SENSOR_DISTANCE)*1L >>16*((SENSOR_DISTANCE)/2L>>31 > 0) >>16*((SENSOR_DISTANCE)/2L>>31 > 0))*1L >>16*(((SENSOR_DISTANCE)*1L >>16*((SENSOR_DISTANCE)/2L>>31 > 0) >>16*((SENSOR_DISTANCE)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_DISTANCE)*1L >>16*((SENSOR_DISTANCE)/2L>>31 > 0) >>16*((SENSOR_DISTANCE)/2L>>31 > 0))*1L >>16*(((SENSOR_DISTANCE)*1L >>16*((SENSOR_DISTANCE)/2L>>31 > 0) >>16*((SENSOR_DISTANCE)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1076 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1076 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1076 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1076 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1076 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1076 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_esc_current", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((ESC_SENSOR_CURRENT)/2L>>31 > 0) + (16*(((ESC_SENSOR_CURRENT)*1L >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0) >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0))>65535L) + (8*((((ESC_SENSOR_CURRENT)*1L >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0) >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_CURRENT)*1L >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0) >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((ESC_SENSOR_CURRENT)*1L >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0) >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_CURRENT)*1L >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0) >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0))>65535L)) >>8*((((ESC_SENSOR_CURRENT)*1L >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0) >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_CURRENT)*1L >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0) >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((ESC_SENSOR_CURRENT)*1L >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0) >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_CURRENT)*1L >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0) >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0))>65535L)) >>8*((((ESC_SENSOR_CURRENT)*1L >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0) >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_CURRENT)*1L >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0) >>16*((ESC_SENSOR_CURRENT)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1077 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1077 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1077 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1077 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1077 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1077 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_esc_voltage", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0) + (16*(((ESC_SENSOR_VOLTAGE)*1L >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0))>65535L) + (8*((((ESC_SENSOR_VOLTAGE)*1L >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_VOLTAGE)*1L >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((ESC_SENSOR_VOLTAGE)*1L >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_VOLTAGE)*1L >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0))>65535L)) >>8*((((ESC_SENSOR_VOLTAGE)*1L >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_VOLTAGE)*1L >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((ESC_SENSOR_VOLTAGE)*1L >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_VOLTAGE)*1L >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0))>65535L)) >>8*((((ESC_SENSOR_VOLTAGE)*1L >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_VOLTAGE)*1L >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0) >>16*((ESC_SENSOR_VOLTAGE)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1078 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1078 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1078 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1078 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1078 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1078 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_esc_rpm", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((ESC_SENSOR_RPM)/2L>>31 > 0) + (16*(((ESC_SENSOR_RPM)*1L >>16*((ESC_SENSOR_RPM)/2L>>31 > 0) >>16*((ESC_SENSOR_RPM)/2L>>31 > 0))>65535L) + (8*((((ESC_SENSOR_RPM)*1L >>16*((ESC_SENSOR_RPM)/2L>>31 > 0) >>16*((ESC_SENSOR_RPM)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_RPM)*1L >>16*((ESC_SENSOR_RPM)/2L>>31 > 0) >>16*((ESC_SENSOR_RPM)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((ESC_SENSOR_RPM)*1L >>16*((ESC_SENSOR_RPM)/2L>>31 > 0) >>16*((ESC_SENSOR_RPM)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_RPM)*1L >>16*((ESC_SENSOR_RPM)/2L>>31 > 0) >>16*((ESC_SENSOR_RPM)/2L>>31 > 0))>65535L)) >>8*((((ESC_SENSOR_RPM)*1L >>16*((ESC_SENSOR_RPM)/2L>>31 > 0) >>16*((ESC_SENSOR_RPM)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_RPM)*1L >>16*((ESC_SENSOR_RPM)/2L>>31 > 0) >>16*((ESC_SENSOR_RPM)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((ESC_SENSOR_RPM)*1L >>16*((ESC_SENSOR_RPM)/2L>>31 > 0) >>16*((ESC_SENSOR_RPM)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_RPM)*1L >>16*((ESC_SENSOR_RPM)/2L>>31 > 0) >>16*((ESC_SENSOR_RPM)/2L>>31 > 0))>65535L)) >>8*((((ESC_SENSOR_RPM)*1L >>16*((ESC_SENSOR_RPM)/2L>>31 > 0) >>16*((ESC_SENSOR_RPM)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_RPM)*1L >>16*((ESC_SENSOR_RPM)/2L>>31 > 0) >>16*((ESC_SENSOR_RPM)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1079 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1079 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1079 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1079 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1079 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1079 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_esc_temperature", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0) + (16*(((ESC_SENSOR_TEMPERATURE)*1L >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0))>65535L) + (8*((((ESC_SENSOR_TEMPERATURE)*1L >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_TEMPERATURE)*1L >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((ESC_SENSOR_TEMPERATURE)*1L >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_TEMPERATURE)*1L >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0))>65535L)) >>8*((((ESC_SENSOR_TEMPERATURE)*1L >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_TEMPERATURE)*1L >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((ESC_SENSOR_TEMPERATURE)*1L >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_TEMPERATURE)*1L >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0))>65535L)) >>8*((((ESC_SENSOR_TEMPERATURE)*1L >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0))*1L >>16*(((ESC_SENSOR_TEMPERATURE)*1L >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((ESC_SENSOR_TEMPERATURE)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1080 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1080 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1080 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1080 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1080 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1080 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+    { "telemetry_disabled_temperature", VAR_UINT32 | MASTER_VALUE | MODE_BITSET, .config.bitpos = (32*((SENSOR_TEMPERATURE)/2L>>31 > 0) + (16*(((SENSOR_TEMPERATURE)*1L >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0))>65535L) + (8*((((SENSOR_TEMPERATURE)*1L >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0))*1L >>16*(((SENSOR_TEMPERATURE)*1L >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0))>65535L))>255) + (8 - 90/((((((SENSOR_TEMPERATURE)*1L >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0))*1L >>16*(((SENSOR_TEMPERATURE)*1L >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_TEMPERATURE)*1L >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0))*1L >>16*(((SENSOR_TEMPERATURE)*1L >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0))>65535L))>255))/4+14)|1) - 2/(((((SENSOR_TEMPERATURE)*1L >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0))*1L >>16*(((SENSOR_TEMPERATURE)*1L >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0))>65535L)) >>8*((((SENSOR_TEMPERATURE)*1L >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0))*1L >>16*(((SENSOR_TEMPERATURE)*1L >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0) >>16*((SENSOR_TEMPERATURE)/2L>>31 > 0))>65535L))>255))/2+1))))), 31, 
+# 1081 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         __builtin_offsetof (
+# 1081 "./src/main/cli/settings.c"
+                                                                                                                                                         telemetryConfig_t
+# 1081 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         , 
+# 1081 "./src/main/cli/settings.c"
+                                                                                                                                                         disabledSensors
+# 1081 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                         )
+# 1081 "./src/main/cli/settings.c"
+                                                                                                                                                                                                     },
+# 1261 "./src/main/cli/settings.c"
+    { "task_statistics", VAR_INT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 18, 
+# 1261 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 __builtin_offsetof (
+# 1261 "./src/main/cli/settings.c"
+                                                                                                                                 systemConfig_t
+# 1261 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 , 
+# 1261 "./src/main/cli/settings.c"
+                                                                                                                                 task_statistics
+# 1261 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 ) 
+# 1261 "./src/main/cli/settings.c"
+                                                                                                                                                                           },
+
+    { "debug_mode", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DEBUG }, 18, 
+# 1263 "./src/main/cli/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 1263 "./src/main/cli/settings.c"
+                                                                                                                                systemConfig_t
+# 1263 "./src/main/cli/settings.c" 3 4
+                                                                                                                                , 
+# 1263 "./src/main/cli/settings.c"
+                                                                                                                                debug_mode
+# 1263 "./src/main/cli/settings.c" 3 4
+                                                                                                                                ) 
+# 1263 "./src/main/cli/settings.c"
+                                                                                                                                                                     },
+    { "rate_6pos_switch", VAR_INT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 18, 
+# 1264 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 __builtin_offsetof (
+# 1264 "./src/main/cli/settings.c"
+                                                                                                                                 systemConfig_t
+# 1264 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 , 
+# 1264 "./src/main/cli/settings.c"
+                                                                                                                                 rateProfile6PosSwitch
+# 1264 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 ) 
+# 1264 "./src/main/cli/settings.c"
+                                                                                                                                                                                 },
+
+
+
+    { "pwr_on_arm_grace", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 30 }, 18, 
+# 1268 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 1268 "./src/main/cli/settings.c"
+                                                                                                                    systemConfig_t
+# 1268 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 1268 "./src/main/cli/settings.c"
+                                                                                                                    powerOnArmingGraceTime
+# 1268 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 1268 "./src/main/cli/settings.c"
+                                                                                                                                                                     },
+    { "scheduler_optimize_rate", VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 18, 
+# 1269 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 __builtin_offsetof (
+# 1269 "./src/main/cli/settings.c"
+                                                                                                                                 systemConfig_t
+# 1269 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 , 
+# 1269 "./src/main/cli/settings.c"
+                                                                                                                                 schedulerOptimizeRate
+# 1269 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 ) 
+# 1269 "./src/main/cli/settings.c"
+                                                                                                                                                                                 },
+# 1304 "./src/main/cli/settings.c"
+    { "displayport_msp_col_adjust", VAR_INT8 | MASTER_VALUE, .config.minmax = { -6, 0 }, 512, 
+# 1304 "./src/main/cli/settings.c" 3 4
+                                                                                                                       __builtin_offsetof (
+# 1304 "./src/main/cli/settings.c"
+                                                                                                                       displayPortProfile_t
+# 1304 "./src/main/cli/settings.c" 3 4
+                                                                                                                       , 
+# 1304 "./src/main/cli/settings.c"
+                                                                                                                       colAdjust
+# 1304 "./src/main/cli/settings.c" 3 4
+                                                                                                                       ) 
+# 1304 "./src/main/cli/settings.c"
+                                                                                                                                                                 },
+    { "displayport_msp_row_adjust", VAR_INT8 | MASTER_VALUE, .config.minmax = { -3, 0 }, 512, 
+# 1305 "./src/main/cli/settings.c" 3 4
+                                                                                                                       __builtin_offsetof (
+# 1305 "./src/main/cli/settings.c"
+                                                                                                                       displayPortProfile_t
+# 1305 "./src/main/cli/settings.c" 3 4
+                                                                                                                       , 
+# 1305 "./src/main/cli/settings.c"
+                                                                                                                       rowAdjust
+# 1305 "./src/main/cli/settings.c" 3 4
+                                                                                                                       ) 
+# 1305 "./src/main/cli/settings.c"
+                                                                                                                                                                 },
+# 1331 "./src/main/cli/settings.c"
+    { "led_inversion", VAR_UINT8 | HARDWARE_VALUE, .config.minmaxUnsigned = { 0, ((1 << 3) - 1) }, 505, 
+# 1331 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                          __builtin_offsetof (
+# 1331 "./src/main/cli/settings.c"
+                                                                                                                                                          statusLedConfig_t
+# 1331 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                          , 
+# 1331 "./src/main/cli/settings.c"
+                                                                                                                                                          inversion
+# 1331 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                          ) 
+# 1331 "./src/main/cli/settings.c"
+                                                                                                                                                                                                 },
+# 1353 "./src/main/cli/settings.c"
+    { "pinio_config", VAR_UINT8 | MASTER_VALUE | MODE_ARRAY, .config.array.length = 4, 529, 
+# 1353 "./src/main/cli/settings.c" 3 4
+                                                                                                                 __builtin_offsetof (
+# 1353 "./src/main/cli/settings.c"
+                                                                                                                 pinioConfig_t
+# 1353 "./src/main/cli/settings.c" 3 4
+                                                                                                                 , 
+# 1353 "./src/main/cli/settings.c"
+                                                                                                                 config
+# 1353 "./src/main/cli/settings.c" 3 4
+                                                                                                                 ) 
+# 1353 "./src/main/cli/settings.c"
+                                                                                                                                                 },
+
+    { "pinio_box", VAR_UINT8 | MASTER_VALUE | MODE_ARRAY, .config.array.length = 4, 530, 
+# 1355 "./src/main/cli/settings.c" 3 4
+                                                                                                                 __builtin_offsetof (
+# 1355 "./src/main/cli/settings.c"
+                                                                                                                 pinioBoxConfig_t
+# 1355 "./src/main/cli/settings.c" 3 4
+                                                                                                                 , 
+# 1355 "./src/main/cli/settings.c"
+                                                                                                                 permanentId
+# 1355 "./src/main/cli/settings.c" 3 4
+                                                                                                                 ) 
+# 1355 "./src/main/cli/settings.c"
+                                                                                                                                                         },
+# 1372 "./src/main/cli/settings.c"
+    { "rcdevice_init_dev_attempts", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 10 }, 539, 
+# 1372 "./src/main/cli/settings.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 1372 "./src/main/cli/settings.c"
+                                                                                                                     rcdeviceConfig_t
+# 1372 "./src/main/cli/settings.c" 3 4
+                                                                                                                     , 
+# 1372 "./src/main/cli/settings.c"
+                                                                                                                     initDeviceAttempts
+# 1372 "./src/main/cli/settings.c" 3 4
+                                                                                                                     ) 
+# 1372 "./src/main/cli/settings.c"
+                                                                                                                                                                    },
+    { "rcdevice_init_dev_attempt_interval", VAR_UINT32 | MASTER_VALUE, .config.u32Max = 5000, 539, 
+# 1373 "./src/main/cli/settings.c" 3 4
+                                                                                                                 __builtin_offsetof (
+# 1373 "./src/main/cli/settings.c"
+                                                                                                                 rcdeviceConfig_t
+# 1373 "./src/main/cli/settings.c" 3 4
+                                                                                                                 , 
+# 1373 "./src/main/cli/settings.c"
+                                                                                                                 initDeviceAttemptInterval
+# 1373 "./src/main/cli/settings.c" 3 4
+                                                                                                                 ) 
+# 1373 "./src/main/cli/settings.c"
+                                                                                                                                                                       },
+    { "rcdevice_protocol_version", VAR_UINT8 | MASTER_VALUE, .config.minmax = { 0, 1 }, 539, 
+# 1374 "./src/main/cli/settings.c" 3 4
+                                                                                                           __builtin_offsetof (
+# 1374 "./src/main/cli/settings.c"
+                                                                                                           rcdeviceConfig_t
+# 1374 "./src/main/cli/settings.c" 3 4
+                                                                                                           , 
+# 1374 "./src/main/cli/settings.c"
+                                                                                                           protocolVersion
+# 1374 "./src/main/cli/settings.c" 3 4
+                                                                                                           ) 
+# 1374 "./src/main/cli/settings.c"
+                                                                                                                                                       },
+    { "rcdevice_feature", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = {0, 65535}, 539, 
+# 1375 "./src/main/cli/settings.c" 3 4
+                                                                                                             __builtin_offsetof (
+# 1375 "./src/main/cli/settings.c"
+                                                                                                             rcdeviceConfig_t
+# 1375 "./src/main/cli/settings.c" 3 4
+                                                                                                             , 
+# 1375 "./src/main/cli/settings.c"
+                                                                                                             feature
+# 1375 "./src/main/cli/settings.c" 3 4
+                                                                                                             ) 
+# 1375 "./src/main/cli/settings.c"
+                                                                                                                                                 },
+
+
+
+    { "gyro_1_bustype", VAR_UINT8 | HARDWARE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BUS_TYPE }, 540, (0 * sizeof(gyroDeviceConfig_t) + 
+# 1379 "./src/main/cli/settings.c" 3 4
+                                                                                                                             __builtin_offsetof (
+# 1379 "./src/main/cli/settings.c"
+                                                                                                                             gyroDeviceConfig_t
+# 1379 "./src/main/cli/settings.c" 3 4
+                                                                                                                             , 
+# 1379 "./src/main/cli/settings.c"
+                                                                                                                             bustype
+# 1379 "./src/main/cli/settings.c" 3 4
+                                                                                                                             )
+# 1379 "./src/main/cli/settings.c"
+                                                                                                                             ) },
+    { "gyro_1_spibus", VAR_UINT8 | HARDWARE_VALUE, .config.minmaxUnsigned = { 0, 4 }, 540, (0 * sizeof(gyroDeviceConfig_t) + 
+# 1380 "./src/main/cli/settings.c" 3 4
+                                                                                                                        __builtin_offsetof (
+# 1380 "./src/main/cli/settings.c"
+                                                                                                                        gyroDeviceConfig_t
+# 1380 "./src/main/cli/settings.c" 3 4
+                                                                                                                        , 
+# 1380 "./src/main/cli/settings.c"
+                                                                                                                        spiBus
+# 1380 "./src/main/cli/settings.c" 3 4
+                                                                                                                        )
+# 1380 "./src/main/cli/settings.c"
+                                                                                                                        ) },
+    { "gyro_1_i2cBus", VAR_UINT8 | HARDWARE_VALUE, .config.minmaxUnsigned = { 0, 4 }, 540, (0 * sizeof(gyroDeviceConfig_t) + 
+# 1381 "./src/main/cli/settings.c" 3 4
+                                                                                                                        __builtin_offsetof (
+# 1381 "./src/main/cli/settings.c"
+                                                                                                                        gyroDeviceConfig_t
+# 1381 "./src/main/cli/settings.c" 3 4
+                                                                                                                        , 
+# 1381 "./src/main/cli/settings.c"
+                                                                                                                        i2cBus
+# 1381 "./src/main/cli/settings.c" 3 4
+                                                                                                                        )
+# 1381 "./src/main/cli/settings.c"
+                                                                                                                        ) },
+    { "gyro_1_i2c_address", VAR_UINT8 | HARDWARE_VALUE, .config.minmaxUnsigned = { 0, 119 }, 540, (0 * sizeof(gyroDeviceConfig_t) + 
+# 1382 "./src/main/cli/settings.c" 3 4
+                                                                                                                              __builtin_offsetof (
+# 1382 "./src/main/cli/settings.c"
+                                                                                                                              gyroDeviceConfig_t
+# 1382 "./src/main/cli/settings.c" 3 4
+                                                                                                                              , 
+# 1382 "./src/main/cli/settings.c"
+                                                                                                                              i2cAddress
+# 1382 "./src/main/cli/settings.c" 3 4
+                                                                                                                              )
+# 1382 "./src/main/cli/settings.c"
+                                                                                                                              ) },
+    { "gyro_1_sensor_align", VAR_UINT8 | HARDWARE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, 540, (0 * sizeof(gyroDeviceConfig_t) + 
+# 1383 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 1383 "./src/main/cli/settings.c"
+                                                                                                                                    gyroDeviceConfig_t
+# 1383 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    , 
+# 1383 "./src/main/cli/settings.c"
+                                                                                                                                    align
+# 1383 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    )
+# 1383 "./src/main/cli/settings.c"
+                                                                                                                                    ) },
+# 1420 "./src/main/cli/settings.c"
+    { "timezone_offset_minutes", VAR_INT16 | MASTER_VALUE, .config.minmax = { -780, 780 }, 526, 
+# 1420 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                          __builtin_offsetof (
+# 1420 "./src/main/cli/settings.c"
+                                                                                                                                                          timeConfig_t
+# 1420 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                          , 
+# 1420 "./src/main/cli/settings.c"
+                                                                                                                                                          tz_offsetMinutes
+# 1420 "./src/main/cli/settings.c" 3 4
+                                                                                                                                                          ) 
+# 1420 "./src/main/cli/settings.c"
+                                                                                                                                                                                                   },
+# 1438 "./src/main/cli/settings.c"
+    { "servo_mount_angle", VAR_INT8 | MASTER_VALUE | MODE_ARRAY, .config.array.length = 4, 52, 
+# 1438 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    __builtin_offsetof (
+# 1438 "./src/main/cli/settings.c"
+                                                                                                                                    servoConfig_t
+# 1438 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    , 
+# 1438 "./src/main/cli/settings.c"
+                                                                                                                                    servo_mount_angle
+# 1438 "./src/main/cli/settings.c" 3 4
+                                                                                                                                    ) 
+# 1438 "./src/main/cli/settings.c"
+                                                                                                                                                                               },
+    { "flapping_phase_shift", VAR_INT8 | MASTER_VALUE | MODE_ARRAY, .config.array.length = 4, 52, 
+# 1439 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   __builtin_offsetof (
+# 1439 "./src/main/cli/settings.c"
+                                                                                                                                   servoConfig_t
+# 1439 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   , 
+# 1439 "./src/main/cli/settings.c"
+                                                                                                                                   flapping_phase_shift
+# 1439 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   ) 
+# 1439 "./src/main/cli/settings.c"
+                                                                                                                                                                                 },
+    { "flap_base_amplitude", VAR_INT8 | MASTER_VALUE, .config.minmax = { -128, 127 }, 52, 
+# 1440 "./src/main/cli/settings.c" 3 4
+                                                                                                        __builtin_offsetof (
+# 1440 "./src/main/cli/settings.c"
+                                                                                                        servoConfig_t
+# 1440 "./src/main/cli/settings.c" 3 4
+                                                                                                        , 
+# 1440 "./src/main/cli/settings.c"
+                                                                                                        flap_base_amplitude
+# 1440 "./src/main/cli/settings.c" 3 4
+                                                                                                        ) 
+# 1440 "./src/main/cli/settings.c"
+                                                                                                                                                     },
+    { "servo_speed_deg_s", VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 100, 2000 }, 52, 
+# 1441 "./src/main/cli/settings.c" 3 4
+                                                                                                                   __builtin_offsetof (
+# 1441 "./src/main/cli/settings.c"
+                                                                                                                   servoConfig_t
+# 1441 "./src/main/cli/settings.c" 3 4
+                                                                                                                   , 
+# 1441 "./src/main/cli/settings.c"
+                                                                                                                   servo_speed_deg_s
+# 1441 "./src/main/cli/settings.c" 3 4
+                                                                                                                   ) 
+# 1441 "./src/main/cli/settings.c"
+                                                                                                                                                              },
+    { "servo_speed_vmin_pct", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 10, 100 }, 52, 
+# 1442 "./src/main/cli/settings.c" 3 4
+                                                                                                                 __builtin_offsetof (
+# 1442 "./src/main/cli/settings.c"
+                                                                                                                 servoConfig_t
+# 1442 "./src/main/cli/settings.c" 3 4
+                                                                                                                 , 
+# 1442 "./src/main/cli/settings.c"
+                                                                                                                 servo_speed_vmin_pct
+# 1442 "./src/main/cli/settings.c" 3 4
+                                                                                                                 ) 
+# 1442 "./src/main/cli/settings.c"
+                                                                                                                                                               },
+    { "servo_accel_ms", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 200 }, 52, 
+# 1443 "./src/main/cli/settings.c" 3 4
+                                                                                                                __builtin_offsetof (
+# 1443 "./src/main/cli/settings.c"
+                                                                                                                servoConfig_t
+# 1443 "./src/main/cli/settings.c" 3 4
+                                                                                                                , 
+# 1443 "./src/main/cli/settings.c"
+                                                                                                                servo_accel_ms
+# 1443 "./src/main/cli/settings.c" 3 4
+                                                                                                                ) 
+# 1443 "./src/main/cli/settings.c"
+                                                                                                                                                        },
+    { "servo_max_amplitude", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 20, 90 }, 52, 
+# 1444 "./src/main/cli/settings.c" 3 4
+                                                                                                                __builtin_offsetof (
+# 1444 "./src/main/cli/settings.c"
+                                                                                                                servoConfig_t
+# 1444 "./src/main/cli/settings.c" 3 4
+                                                                                                                , 
+# 1444 "./src/main/cli/settings.c"
+                                                                                                                servo_max_amplitude
+# 1444 "./src/main/cli/settings.c" 3 4
+                                                                                                                ) 
+# 1444 "./src/main/cli/settings.c"
+                                                                                                                                                             },
+    { "flap_magnitude", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 1, 20 }, 52, 
+# 1445 "./src/main/cli/settings.c" 3 4
+                                                                                                               __builtin_offsetof (
+# 1445 "./src/main/cli/settings.c"
+                                                                                                               servoConfig_t
+# 1445 "./src/main/cli/settings.c" 3 4
+                                                                                                               , 
+# 1445 "./src/main/cli/settings.c"
+                                                                                                               flap_magnitude
+# 1445 "./src/main/cli/settings.c" 3 4
+                                                                                                               ) 
+# 1445 "./src/main/cli/settings.c"
+                                                                                                                                                       },
+    { "wing_origin_offset", VAR_INT8 | MASTER_VALUE | MODE_ARRAY, .config.array.length = 4, 52, 
+# 1446 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   __builtin_offsetof (
+# 1446 "./src/main/cli/settings.c"
+                                                                                                                                   servoConfig_t
+# 1446 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   , 
+# 1446 "./src/main/cli/settings.c"
+                                                                                                                                   wing_origin_offset
+# 1446 "./src/main/cli/settings.c" 3 4
+                                                                                                                                   ) 
+# 1446 "./src/main/cli/settings.c"
+                                                                                                                                                                               },
+
+    { "ornithopter_freq_channel", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 13 }, 52, 
+# 1448 "./src/main/cli/settings.c" 3 4
+                                                                                                                 __builtin_offsetof (
+# 1448 "./src/main/cli/settings.c"
+                                                                                                                 servoConfig_t
+# 1448 "./src/main/cli/settings.c" 3 4
+                                                                                                                 , 
+# 1448 "./src/main/cli/settings.c"
+                                                                                                                 ornithopter_freq_channel
+# 1448 "./src/main/cli/settings.c" 3 4
+                                                                                                                 ) 
+# 1448 "./src/main/cli/settings.c"
+                                                                                                                                                                   },
+    { "ornithopter_freq_min", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 1, 50 }, 52, 
+# 1449 "./src/main/cli/settings.c" 3 4
+                                                                                                               __builtin_offsetof (
+# 1449 "./src/main/cli/settings.c"
+                                                                                                               servoConfig_t
+# 1449 "./src/main/cli/settings.c" 3 4
+                                                                                                               , 
+# 1449 "./src/main/cli/settings.c"
+                                                                                                               ornithopter_freq_min
+# 1449 "./src/main/cli/settings.c" 3 4
+                                                                                                               ) 
+# 1449 "./src/main/cli/settings.c"
+                                                                                                                                                             },
+    { "ornithopter_freq_max", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 1, 50 }, 52, 
+# 1450 "./src/main/cli/settings.c" 3 4
+                                                                                                               __builtin_offsetof (
+# 1450 "./src/main/cli/settings.c"
+                                                                                                               servoConfig_t
+# 1450 "./src/main/cli/settings.c" 3 4
+                                                                                                               , 
+# 1450 "./src/main/cli/settings.c"
+                                                                                                               ornithopter_freq_max
+# 1450 "./src/main/cli/settings.c" 3 4
+                                                                                                               ) 
+# 1450 "./src/main/cli/settings.c"
+                                                                                                                                                             },
+
+    { "ornithopter_profile_channel", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 13 }, 52, 
+# 1452 "./src/main/cli/settings.c" 3 4
+                                                                                                                    __builtin_offsetof (
+# 1452 "./src/main/cli/settings.c"
+                                                                                                                    servoConfig_t
+# 1452 "./src/main/cli/settings.c" 3 4
+                                                                                                                    , 
+# 1452 "./src/main/cli/settings.c"
+                                                                                                                    ornithopter_profile_channel
+# 1452 "./src/main/cli/settings.c" 3 4
+                                                                                                                    ) 
+# 1452 "./src/main/cli/settings.c"
+                                                                                                                                                                         },
+    { "ornithopter_profile_index", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 3 }, 52, 
+# 1453 "./src/main/cli/settings.c" 3 4
+                                                                                                                   __builtin_offsetof (
+# 1453 "./src/main/cli/settings.c"
+                                                                                                                   servoConfig_t
+# 1453 "./src/main/cli/settings.c" 3 4
+                                                                                                                   , 
+# 1453 "./src/main/cli/settings.c"
+                                                                                                                   ornithopter_profile_index
+# 1453 "./src/main/cli/settings.c" 3 4
+                                                                                                                   ) 
+# 1453 "./src/main/cli/settings.c"
+                                                                                                                                                                      },
+
+    { "ferocity_downstroke", VAR_INT8 | MASTER_VALUE, .config.minmax = { 1, 100 }, 547, 
+# 1455 "./src/main/cli/settings.c" 3 4
+                                                                                                           __builtin_offsetof (
+# 1455 "./src/main/cli/settings.c"
+                                                                                                           ornithopterProfile_t
+# 1455 "./src/main/cli/settings.c" 3 4
+                                                                                                           , 
+# 1455 "./src/main/cli/settings.c"
+                                                                                                           ferocity_downstroke
+# 1455 "./src/main/cli/settings.c" 3 4
+                                                                                                           ) 
+# 1455 "./src/main/cli/settings.c"
+                                                                                                                                                               },
+    { "ferocity_upstroke", VAR_INT8 | MASTER_VALUE, .config.minmax = { 1, 100 }, 547, 
+# 1456 "./src/main/cli/settings.c" 3 4
+                                                                                                           __builtin_offsetof (
+# 1456 "./src/main/cli/settings.c"
+                                                                                                           ornithopterProfile_t
+# 1456 "./src/main/cli/settings.c" 3 4
+                                                                                                           , 
+# 1456 "./src/main/cli/settings.c"
+                                                                                                           ferocity_upstroke
+# 1456 "./src/main/cli/settings.c" 3 4
+                                                                                                           ) 
+# 1456 "./src/main/cli/settings.c"
+                                                                                                                                                             },
+    { "glide_angle", VAR_INT8 | MASTER_VALUE, .config.minmax = { -90, 90 }, 547, 
+# 1457 "./src/main/cli/settings.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 1457 "./src/main/cli/settings.c"
+                                                                                                            ornithopterProfile_t
+# 1457 "./src/main/cli/settings.c" 3 4
+                                                                                                            , 
+# 1457 "./src/main/cli/settings.c"
+                                                                                                            glide_angle
+# 1457 "./src/main/cli/settings.c" 3 4
+                                                                                                            ) 
+# 1457 "./src/main/cli/settings.c"
+                                                                                                                                                        },
+    { "cadence_gain", VAR_INT8 | MASTER_VALUE, .config.minmax = { -100, 100 }, 547, 
+# 1458 "./src/main/cli/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 1458 "./src/main/cli/settings.c"
+                                                                                                              ornithopterProfile_t
+# 1458 "./src/main/cli/settings.c" 3 4
+                                                                                                              , 
+# 1458 "./src/main/cli/settings.c"
+                                                                                                              cadence_gain
+# 1458 "./src/main/cli/settings.c" 3 4
+                                                                                                              ) 
+# 1458 "./src/main/cli/settings.c"
+                                                                                                                                                           },
+    { "ferocity_d_gain", VAR_INT8 | MASTER_VALUE, .config.minmax = { -100, 100 }, 547, 
+# 1459 "./src/main/cli/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 1459 "./src/main/cli/settings.c"
+                                                                                                              ornithopterProfile_t
+# 1459 "./src/main/cli/settings.c" 3 4
+                                                                                                              , 
+# 1459 "./src/main/cli/settings.c"
+                                                                                                              ferocity_d_gain
+# 1459 "./src/main/cli/settings.c" 3 4
+                                                                                                              ) 
+# 1459 "./src/main/cli/settings.c"
+                                                                                                                                                              },
+    { "ferocity_p_gain", VAR_INT8 | MASTER_VALUE, .config.minmax = { 0, 100 }, 547, 
+# 1460 "./src/main/cli/settings.c" 3 4
+                                                                                                           __builtin_offsetof (
+# 1460 "./src/main/cli/settings.c"
+                                                                                                           ornithopterProfile_t
+# 1460 "./src/main/cli/settings.c" 3 4
+                                                                                                           , 
+# 1460 "./src/main/cli/settings.c"
+                                                                                                           ferocity_p_gain
+# 1460 "./src/main/cli/settings.c" 3 4
+                                                                                                           ) 
+# 1460 "./src/main/cli/settings.c"
+                                                                                                                                                           },
+    { "balance_gain", VAR_INT8 | MASTER_VALUE, .config.minmax = { -100, 100 }, 547, 
+# 1461 "./src/main/cli/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 1461 "./src/main/cli/settings.c"
+                                                                                                              ornithopterProfile_t
+# 1461 "./src/main/cli/settings.c" 3 4
+                                                                                                              , 
+# 1461 "./src/main/cli/settings.c"
+                                                                                                              balance_gain
+# 1461 "./src/main/cli/settings.c" 3 4
+                                                                                                              ) 
+# 1461 "./src/main/cli/settings.c"
+                                                                                                                                                           },
+    { "warp_gain", VAR_INT8 | MASTER_VALUE, .config.minmax = { -100, 100 }, 547, 
+# 1462 "./src/main/cli/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 1462 "./src/main/cli/settings.c"
+                                                                                                              ornithopterProfile_t
+# 1462 "./src/main/cli/settings.c" 3 4
+                                                                                                              , 
+# 1462 "./src/main/cli/settings.c"
+                                                                                                              warp_gain
+# 1462 "./src/main/cli/settings.c" 3 4
+                                                                                                              ) 
+# 1462 "./src/main/cli/settings.c"
+                                                                                                                                                        },
+    { "warp_yaw_gain", VAR_INT8 | MASTER_VALUE, .config.minmax = { -100, 100 }, 547, 
+# 1463 "./src/main/cli/settings.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 1463 "./src/main/cli/settings.c"
+                                                                                                              ornithopterProfile_t
+# 1463 "./src/main/cli/settings.c" 3 4
+                                                                                                              , 
+# 1463 "./src/main/cli/settings.c"
+                                                                                                              warp_yaw_gain
+# 1463 "./src/main/cli/settings.c" 3 4
+                                                                                                              ) 
+# 1463 "./src/main/cli/settings.c"
+                                                                                                                                                            },
+    { "ferocity_roll_gain", VAR_INT8 | MASTER_VALUE, .config.minmax = { 0, 100 }, 547, 
+# 1464 "./src/main/cli/settings.c" 3 4
+                                                                                                           __builtin_offsetof (
+# 1464 "./src/main/cli/settings.c"
+                                                                                                           ornithopterProfile_t
+# 1464 "./src/main/cli/settings.c" 3 4
+                                                                                                           , 
+# 1464 "./src/main/cli/settings.c"
+                                                                                                           ferocity_roll_gain
+# 1464 "./src/main/cli/settings.c" 3 4
+                                                                                                           ) 
+# 1464 "./src/main/cli/settings.c"
+                                                                                                                                                              },
+    { "ferocity_yaw_gain", VAR_INT8 | MASTER_VALUE, .config.minmax = { 0, 100 }, 547, 
+# 1465 "./src/main/cli/settings.c" 3 4
+                                                                                                           __builtin_offsetof (
+# 1465 "./src/main/cli/settings.c"
+                                                                                                           ornithopterProfile_t
+# 1465 "./src/main/cli/settings.c" 3 4
+                                                                                                           , 
+# 1465 "./src/main/cli/settings.c"
+                                                                                                           ferocity_yaw_gain
+# 1465 "./src/main/cli/settings.c" 3 4
+                                                                                                           ) 
+# 1465 "./src/main/cli/settings.c"
+                                                                                                                                                             },
+    { "anchor_gain", VAR_INT8 | MASTER_VALUE, .config.minmax = { 0, 100 }, 547, 
+# 1466 "./src/main/cli/settings.c" 3 4
+                                                                                                           __builtin_offsetof (
+# 1466 "./src/main/cli/settings.c"
+                                                                                                           ornithopterProfile_t
+# 1466 "./src/main/cli/settings.c" 3 4
+                                                                                                           , 
+# 1466 "./src/main/cli/settings.c"
+                                                                                                           anchor_gain
+# 1466 "./src/main/cli/settings.c" 3 4
+                                                                                                           ) 
+# 1466 "./src/main/cli/settings.c"
+                                                                                                                                                       },
+    { "resonance_gain", VAR_INT8 | MASTER_VALUE, .config.minmax = { 0, 100 }, 547, 
+# 1467 "./src/main/cli/settings.c" 3 4
+                                                                                                           __builtin_offsetof (
+# 1467 "./src/main/cli/settings.c"
+                                                                                                           ornithopterProfile_t
+# 1467 "./src/main/cli/settings.c" 3 4
+                                                                                                           , 
+# 1467 "./src/main/cli/settings.c"
+                                                                                                           resonance_gain
+# 1467 "./src/main/cli/settings.c" 3 4
+                                                                                                           ) 
+# 1467 "./src/main/cli/settings.c"
+                                                                                                                                                          },
+    { "prescience_gain", VAR_INT8 | MASTER_VALUE, .config.minmax = { 0, 100 }, 547, 
+# 1468 "./src/main/cli/settings.c" 3 4
+                                                                                                           __builtin_offsetof (
+# 1468 "./src/main/cli/settings.c"
+                                                                                                           ornithopterProfile_t
+# 1468 "./src/main/cli/settings.c" 3 4
+                                                                                                           , 
+# 1468 "./src/main/cli/settings.c"
+                                                                                                           prescience_gain
+# 1468 "./src/main/cli/settings.c" 3 4
+                                                                                                           ) 
+# 1468 "./src/main/cli/settings.c"
+                                                                                                                                                           },
+    { "espelho_gain", VAR_INT8 | MASTER_VALUE, .config.minmax = { 0, 100 }, 547, 
+# 1469 "./src/main/cli/settings.c" 3 4
+                                                                                                           __builtin_offsetof (
+# 1469 "./src/main/cli/settings.c"
+                                                                                                           ornithopterProfile_t
+# 1469 "./src/main/cli/settings.c" 3 4
+                                                                                                           , 
+# 1469 "./src/main/cli/settings.c"
+                                                                                                           espelho_gain
+# 1469 "./src/main/cli/settings.c" 3 4
+                                                                                                           ) 
+# 1469 "./src/main/cli/settings.c"
+                                                                                                                                                        },
+    { "saudade_gain", VAR_INT8 | MASTER_VALUE, .config.minmax = { 0, 100 }, 547, 
+# 1470 "./src/main/cli/settings.c" 3 4
+                                                                                                           __builtin_offsetof (
+# 1470 "./src/main/cli/settings.c"
+                                                                                                           ornithopterProfile_t
+# 1470 "./src/main/cli/settings.c" 3 4
+                                                                                                           , 
+# 1470 "./src/main/cli/settings.c"
+                                                                                                           saudade_gain
+# 1470 "./src/main/cli/settings.c" 3 4
+                                                                                                           ) 
+# 1470 "./src/main/cli/settings.c"
+                                                                                                                                                        },
+    { "ssff_gain", VAR_INT8 | MASTER_VALUE, .config.minmax = { 0, 100 }, 547, 
+# 1471 "./src/main/cli/settings.c" 3 4
+                                                                                                           __builtin_offsetof (
+# 1471 "./src/main/cli/settings.c"
+                                                                                                           ornithopterProfile_t
+# 1471 "./src/main/cli/settings.c" 3 4
+                                                                                                           , 
+# 1471 "./src/main/cli/settings.c"
+                                                                                                           ssff_gain
+# 1471 "./src/main/cli/settings.c" 3 4
+                                                                                                           ) 
+# 1471 "./src/main/cli/settings.c"
+                                                                                                                                                     },
+    { "aeroelastic_glide_coefficient", VAR_INT8 | MASTER_VALUE, .config.minmax = { 
+# 1472 "./src/main/cli/settings.c" 3 4
+                                                                                  (-128)
+# 1472 "./src/main/cli/settings.c"
+                                                                                          , 
+# 1472 "./src/main/cli/settings.c" 3 4
+                                                                                            (127) 
+# 1472 "./src/main/cli/settings.c"
+                                                                                                     }, 547, 
+# 1472 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 __builtin_offsetof (
+# 1472 "./src/main/cli/settings.c"
+                                                                                                                                 ornithopterProfile_t
+# 1472 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 , 
+# 1472 "./src/main/cli/settings.c"
+                                                                                                                                 aeroelastic_glide_coefficient
+# 1472 "./src/main/cli/settings.c" 3 4
+                                                                                                                                 ) 
+# 1472 "./src/main/cli/settings.c"
+                                                                                                                                                                                               },
+    { "aeroelastic_flap_coefficient", VAR_INT8 | MASTER_VALUE, .config.minmax = { 
+# 1473 "./src/main/cli/settings.c" 3 4
+                                                                                 (-128)
+# 1473 "./src/main/cli/settings.c"
+                                                                                         , 
+# 1473 "./src/main/cli/settings.c" 3 4
+                                                                                           (127) 
+# 1473 "./src/main/cli/settings.c"
+                                                                                                    }, 547, 
+# 1473 "./src/main/cli/settings.c" 3 4
+                                                                                                                                __builtin_offsetof (
+# 1473 "./src/main/cli/settings.c"
+                                                                                                                                ornithopterProfile_t
+# 1473 "./src/main/cli/settings.c" 3 4
+                                                                                                                                , 
+# 1473 "./src/main/cli/settings.c"
+                                                                                                                                aeroelastic_flap_coefficient
+# 1473 "./src/main/cli/settings.c" 3 4
+                                                                                                                                ) 
+# 1473 "./src/main/cli/settings.c"
+                                                                                                                                                                                             },
+};
+
+const uint16_t valueTableEntryCount = (sizeof(valueTable) / sizeof((valueTable)[0]));
+
+
+uint16_t valueTableNameIndex[(sizeof(valueTable) / sizeof((valueTable)[0]))];
+
+void settingsBuildCheck() {
+    _Static_assert((LOOKUP_TABLE_COUNT == (sizeof(lookupTables) / sizeof((lookupTables)[0]))), "LOOKUP_TABLE_COUNT_incorrect");
+}
@@ -0,0 +1,1414 @@
+	.file	"settings.c"
+	.section	.gnu.lto_.profile.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \367\205\007"
+	.string	"4\016\353"
+	.string	"'"
+	.string	"\233\364\343\336\006"
+	.string	"\001\240\342\234\212\n\002\221\323\370\317\001\003\261\236\244\225\f\004\214\207\217\333\001\005\376\367\260\205\006\006\323\347\261\306\003\007\330\264\373\207\t\b\367\316\327\257\017\t\243\224\377\222\t\f\216\307\310\264\005\r\261\372\336\256\016\016\336\337\356!\017\336\361\204\276\002\020\206\345\347\303\n\022\355\316\316\363\b\023\327\222\361\365\013\024\342\263\312\237\001\025\302\223\266\246\003\026\027\257\267\254\261\f\030\214\266\217\340\001\031\320\205\256\202\b\032\263\374\313\376\005\033\345\220\314\235\r\034\375\275\346\323\005\035\330\201\352\215\017\036\206\255\214\227\017\037\317\234\246\263\t \342\335\275\264\003!\363\225\213\300\006\"\310\363\275\244\f#\234\260\325\254\r$%\211\301\261\026&\373\344\335\202\007'\347\205\360\261\n(\201\304\320\300\016)\220\207\307\322\003"
+	.string	"\003"
+	.ascii	"\317\025$\350\224{6\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\001"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\334\034c\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.8b7e33151d312ab4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lookupTableAccHardware.181.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375`\274\001%\016"
+	.string	"&\227ZD\300\230j:8\305u]\270V\200x\255"
+	.string	"lg\246$\262,\253 \240\202C\\^\221\204P\321V_\002%\203\332V0\311\272x\314\232k\332\017Q0\260vt\223\340\2748\222 (\302"
+	.string	"#lf\227\007I2G"
+	.string	"G"
+	.string	"I"
+	.string	"\025\372\354\311!\243\023\372,\340\306\006j\322\363\324\347\0014dT\3543\201\030\262\313\3248\3203A\237\013\274p\2010\243\242\003=\271>\033\370\001\315y\317\342e3A\253\301\314\314f\347G\234?\320s\353\363\306\354>K\237r*\267\362\035\213\347\332h3\021 \024\354\257\254\350*/\364)\372\274IA\321g"
+	.string	"ON\3649"
+	.string	"\223\227\3503'q\241'\321gM\215\274\f\f\006z>D\2377D<\264\020\263\317\234\037\257\222\236\027\372\334\341\021\261\226\311\221\031X\\\013i\341\305\261`&\367A\260\245\206\026\214\213\225%\214\363l\351$2\340}\213\273x\314a\\\306g\274\306m\234v\034\327\361\035\357q\037\007\362 \037\002\276\310\215\374\310\221\\\311\227\274\311\235\034\312\243\004\253\222\260\022yK)U\212\027\374<\024\005\222\330\201_(\216a'\216\034\240H^\365\306\b(\317\326Z+\030\252`'Z=\030\351\202\272\332 \254\235\025}\2420T\273qd\342l\r\201L\343\202\315\262>\246\253\205\214\005* \020\2431r\003["
+	.ascii	"\316\222\302\206\222\255\222\216\327z\327\030\221\321\203(\n"
+	.ascii	"B\036\017\2576\214\302\273d\367Q3\326\316\313LL\304\313E\362"
+	.ascii	"\370\337%\263\036\317\227\331}\030Y,\177rK\242L\3005k\036\020"
+	.ascii	"[\263<:\363+\017[\317\332\314]\263n\220\337`\212"
+	.text
+	.section	.gnu.lto_lookupTableGyroHardware.182.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375`\223\001\235\r"
+	.string	"\024\026\323\001"
+	.string	""
+	.string	"\264"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\300\250\002}\273\001"
+	.string	"\005\001\006\025\001\017\005\001'/\206\b{\370\377Qy\276\016\005\001'7\206\bw\230\377\001u\301\r\005\001'A\bu\304\f\005\001'K\206\bs\bq\307\013\005\001'V\bu\312\n\005\001'`\315\t\005\001'j\206\bom\320's\322\006\025\001\007\005\001'|\325\006\005\001'\205\001\330\376\001y\330\005\005\001'\215\001\333\004\005\001'\226\001\336\003\005\001'\240\341\002\005\001'\251\001\b}\344'\257\346\001"
+	.string	"?\202\210\200\300\002k3\347\0014\345\001\343\001\342\001\340\001\337\001\335\001\334\001\332\001\331\001\327\001\326\001\324\001\323\0015\321\001\317\001\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005FAKE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007BMI160"
+	.string	"\tICM2068949"
+	.string	"\n08G021"
+	.string	"\bMPU9250650000"
+	.string	"\007L3GD23050"
+	.string	"\tL3G4200D50"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.ascii	"& \360\"B\312\003\207\254\372@\227\203j\250h\214\222\201A\f\205"
+	.ascii	"\220\247\207\313$\214\265\273\234\335\373\321d,\206C\314D\306"
+	.ascii	"\213\263\036\277\213\354r\346-f\271\265-\022g\"\256\231\345\001"
+	.ascii	"\2655\317\2033\277\362\260\265\254\231\271/\353\006\371\r\275"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_lookupTableBaroHardware.183.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"e\007"
+	.string	"\264\f\312"
+	.string	""
+	.string	""
+	.string	"Z"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\360\250\002}\273\001"
+	.string	"\005\001\006\025\001\006\005\001'2\206\b{\370\306Ry\276\005\005\001'7\206\bw\bu\301\004\005\001'?\304\003\005\001'G\307\002\005\001'O\206\bsq\312'U\314\001"
+	.string	"?\202\210\2008o3\315\0014\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bQMP6988"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004LPS"
+	.string	"\007BMP280"
+	.string	"\007MS5611085"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"\r"
+	.string	"\350L!\332d\f,\006\204A\306"
+	.ascii	"\177 \023\200k\236y\200\314}f\335\240\362\033@\021"
+	.text
+	.section	.gnu.lto_lookupTableMagHardware.184.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"U\007"
+	.string	"d\f\312"
+	.string	""
+	.string	""
+	.string	"_"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\340\251\002}\273\001"
+	.string	"\005\001\006\025\001\006\005\001'2\370\315R}\276\005\005\001';\206\b{\by\301\004\005\001'C\304\003\005\001'K\b}\307\002\005\001'T\206\bwu\312'Z\314\001"
+	.string	"?\202\210\2008s3\315\0014\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bLIS3MDL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\bQMC5883"
+	.string	"\007AK89675"
+	.string	"\bH\005NONE"
+	.string	"\005AUTO"
+	.string	"\016"
+	.string	"<\263\216+\331\261\311\r\330\006H\254\232\035\024\366\003\231"
+	.string	"\\\363\314\003d\3563k\005\265\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableRangefinderHardware.185.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \303U\005"
+	.string	"t\ts"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\310\252\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'/\206\b{\270\324Ry\276\002\005\001'7\by\301'?\b}\303\001"
+	.string	"?\202\210\200 w3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005TF02"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007TFMINI"
+	.string	"\007HCSR04"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"OX\314\323\016\260\265\317\254\033T~\003(\002"
+	.text
+	.section	.gnu.lto_lookupTableOffOn.186.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 u}\003"
+	.string	"D\0068"
+	.string	""
+	.string	""
+	.string	"1"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\246\205\327\022}\273\001-\206\b{\370\326Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\003ON"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004OFF"
+	.string	"\003"
+	.ascii	" \t\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableCrashRecovery.187.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \231}\004"
+	.string	"\024\bV"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\320\253\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\334Ry\276'3\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005BEEP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableUnit.188.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \177\315\003"
+	.string	"\344\0069"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\253\002}\273\0011\206\b{\370\336Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007METRIC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\tIMPERIAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAlignment.189.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375`\213"
+	.string	"e\t"
+	.string	"d\017\f\001"
+	.string	""
+	.string	"s"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\235\362\320\255\002}\273\0014\270\354R}\275\001"
+	.string	"\005\001\006\025\001\007\005\001'?\206\b{\330\347\002y\300\006\005\001'I\206\bw\230\347\002u\303\005\005\001'R\206\bs\330\346\002q\306\004\005\001'Y\230\346\002q\311\003\005\001'`\206\bo\330\345\002m\314\002\005\001'f\206\bk\230\345\002i\317'k\330\344\002u\321\001"
+	.string	"?\202\210\200\310\001g3\322\0014\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\0015\274\001"
+	.string	"\nCW270FLIP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c18\tCW9\bCW\006180"
+	.string	"\005"
+	.string	"\004CW0"
+	.string	"\bDEFAULT"
+	.string	"\027"
+	.ascii	"D\205\252\"\246p/\313\030_\r\002\006\303\252\341\020\3146`\037"
+	.ascii	"\310\021\344\007r\004\371\201\375@~ G\220\037\310\321g~\254\312"
+	.ascii	"\027\254\270\323\266\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableGimbalMode.190.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 ~\305\003"
+	.string	"\324\0069"
+	.string	""
+	.string	""
+	.string	"9"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\330\270\002}\273\0012\206\b{\270\305Sy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\bMIXTILT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007NORMAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxDevice.191.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \307\205\005"
+	.string	"\344\ts"
+	.string	""
+	.string	""
+	.string	"H"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\310\271\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'1\270\314S}\276\002\005\001'9\206\b{\by\301\001C\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007SERIAL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SDCARD"
+	.string	"\tSPIFLASH"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"\220\344\t\226\200\314}f\255\240\366\033@\021"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxMode.192.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \246\315\004"
+	.string	"\264\bV"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\350\271\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\206\b{\270\316Sy\276'=\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007ALWAYS"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\013MOTOR_TEST"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.string	"V-\366iu\203\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableGyroHardwareLpf.193.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \204\365\003"
+	.string	"4\0079"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\251\372\320\277\n}\273\0018\206\b{\330\374\003y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\0161KHZ_SAMPLING"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007NORMAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTablePwmProtocol.194.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \362=\006"
+	.string	"\304\n\216"
+	.string	""
+	.string	""
+	.string	"X"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\310\311\n}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\by\276\003\005\001'=\301\002\005\001'H\206\bwu\304'T\206\bsq\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bBRUSHED"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nMULTISHOT"
+	.string	"\nONE42"
+	.string	"\013125"
+	.string	"\004OFF"
+	.string	"\n"
+	.string	".I\034\313\032$\320\003\241\001\022A&"
+	.ascii	"\327<\363hP\371\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolation.195.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \302e\005"
+	.string	"\224\ts"
+	.string	""
+	.string	""
+	.string	"C"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\310\312\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'1\206\b{\270\324Ty\276\002\005\001'7\b}\301'?\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007MANUAL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005AUTO"
+	.string	"\007PRESET"
+	.string	"\004OFF"
+	.string	"\006"
+	.ascii	"Q\245\346i\007W[\373\314\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolationChannels.196.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \330\255\005"
+	.string	"\264\t\215"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\326T}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'.\206\b{\by\276\003\005\001'1\206\bwu\301\002\005\001'7\b}\304'<\206\bsq\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004RPT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\002T"
+	.string	"\005RPYTY"
+	.string	"\003RP"
+	.string	"\t"
+	.string	"\021\326\020\221@\272j\030R\330\032d\f\b\347\231\007\201\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableLowpassType.197.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\310\313\n}\273\0011\206\b{\230\334\004y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableDtermLowpassType.198.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\313\n}\273\0011\206\b{\330\336\004y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAntiGravityMode.199.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 {\255\003"
+	.string	"\244\0069"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\330\314\n}\273\001/\206\b{\230\345\004y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\005STEP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SMOOTH"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableFailsafe.200.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \247\355\004"
+	.string	"\364\bV"
+	.string	""
+	.string	""
+	.string	"E"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\300\315\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'5\206\b{\370\347Ty\276';\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\013GPS-RESCUE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005DROP"
+	.string	"\nAUTO-LAND"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableFailsafeSwitchMode.201.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \240\205\004"
+	.string	"\344\007V"
+	.string	""
+	.string	""
+	.string	">"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\340\315\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\206\b{\370\355Ty\276'7\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007STAGE2"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005KILL1"
+	.string	"\005"
+	.ascii	"\nV9Z\265\330\247\325\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableBusType.202.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \274\025\005"
+	.string	"\004\tq"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\370\315\n}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'0\206\b{\by\276\002\005\001'5\301':\206\bwu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006SLAVE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004SPI"
+	.string	"\004I2C"
+	.string	"\005NONE"
+	.string	"\006"
+	.string	"O\221\202\200\001\376xf\327\2402\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_lookupTableGyroOverflowCheck.203.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \230E\004"
+	.string	"\244\007U"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\306\025}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\370\305U}\276'3\b}\300\001"
+	.string	"?\202\210\200\030{3\301\0014\277\001\275\001\274\001"
+	.string	"\004ALL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004YAW"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8\027\373\264:@\3557\200\""
+	.text
+	.section	.gnu.lto_lookupTableRatesType.204.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \205\365\003"
+	.string	"T\0079"
+	.string	""
+	.string	""
+	.string	"@"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\310\331\002}\273\001"
+	.string	"\005\001'5\270\314U}\275\001"
+	.string	"?\202\210\200\020{3\276\0014\274\001"
+	.string	"\013RACEFLIGHT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\013BETAFLIGHT"
+	.string	"\002"
+	.string	"\354\334n"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableThrottleLimitType.205.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \234\225\004"
+	.string	"D\bV"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\300\334\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\337Uy\276'6\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005CLIP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006SCALE"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableItermRelax.206.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \343\365\005"
+	.string	"D\n\220"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\320\336\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\370\364Uy\276\003\005\001':\206\bw\bu\301\002\005\001'?\206\bsq\304'C\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bRPY_INC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007RP\004RPY"
+	.string	"\003RP"
+	.string	"\004OFF"
+	.string	"\t"
+	.ascii	"\217TB|\2121\260\030\020\3163\017\220\271\317\254\033T~\003("
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_lookupTableItermRelaxType.207.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 }\275\003"
+	.string	"\304\0069"
+	.string	""
+	.string	""
+	.string	"8"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\350\336\002}\273\0013\206\b{\270\366Uy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\tSETPOINT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005GYRO"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAcroTrainerDebug.208.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\330\337\002}\273\0010\206\b{\270\375Uy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\006PITCH"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005ROLL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingType.209.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \251\345\004"
+	.string	"\344\bV"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\310\350\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\270\304V}\276'9\206\b{\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007SPLINE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007FILTER"
+	.string	"\016INTERPOLATION"
+	.string	"\004"
+	.string	"V\245\366i\265\202\332o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingDebug.210.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \303\205\005"
+	.string	"\324\ts"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\340\350\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'3\206\b{\370\305Vy\276\002\005\001'8\206\bw\bu\301'?\206\bs\bq\303\001"
+	.string	"?\202\210\200 o3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tTHROTTLE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004YAW"
+	.string	"\006PITCH"
+	.string	"\005ROLL"
+	.string	"\006"
+	.ascii	"Q\245\346i\007\310\334g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingInputType.211.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 z\265\003"
+	.string	"\324\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\370\350\002}\273\001"
+	.string	"\005\001'1\206\b{\270\307Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\002"
+	.string	"\357\314n"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingDerivativeType.212.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\bV"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\351\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\206\b{\370\314Vy\276'6\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8\027\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableLedstripColors.213.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375`[\001\375\r"
+	.string	"V\330^F"
+	.string	"s\233\016\bZN\375\377"
+	.string	"U\232\230\251\252\252\032\257\252*V\365*! =\323\275\261\366\226m\215\260?\374O\3201E\021/\250\223 0\353\347\257\021]\213\305\001\220`\351\362\372\257\250\377\214\240\333d\215\372\223\fM"
+	.string	"L"
+	.string	"M"
+	.string	"\f\352\n\027+\265\240\276\003\240 \255T9\242\027T\337#)\027K\205*\321\213\240\276\257\022/\226\252\204@\257\201\372&\021\021!\024\343A\002\275'\365-\340%\363\315\3770a3DF\b\314\352t\272\317\360\246@\357\246\276\231\003\363;\004?N\036\204"
+	.string	"x\231\323\005\013\007\370@\306\271B\301T\037\343\\\225\337P\337\233\035,s\006\025\322{\r\365\r\240\024\347L\211\241\276El\210\223\006\325B\357+\324w\317 '\315K}\317\227L\030\343\254i@\257\250\276\255\026\344\254\t\241I\251E4\232Lb\t\033\035\204\230hd!\261\220T\302L\006\360\350\201H\302L\243\021\t\273\270\323m \020d-g\204\017\342!>\342$n\342'\256z\314S\\\305Y\024\270\213\277x\214\3138\215\327\370\215\343x\216\3538\217\367x\334I\3118\224\311\366\333TB\2239\326\023a\253u\231\367\2618\364\3418\273bY\317\306]\223;k=\r\374\272\315sq\227\255\2444\370\251h\033w\261M\300\2414\177\226\373l\n\300\216\227qH8\373:\253e\036\312\001\035"
+	.string	"6\263\2562!\363rQNk\020\236\303l\b\362\003Y\202\374~\232\007\371YM\226 \347\254\214\203@"
+	.ascii	"\341 \223\251\f\203@\2622\032d\r2\007Y\203\314A\326 s\237Y7\250"
+	.ascii	"\374\006P\004"
+	.text
+	.section	.gnu.lto_lookupTableGyroFilterDebug.214.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \233\215\004"
+	.string	"4\bU"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\315\027}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\206\b{\370\314Wy\276'5\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\004YAW"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006PITCH"
+	.string	"\005ROLL"
+	.string	"\004"
+	.ascii	"8S\373\264\232@\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTables.215.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375`\205\004\235\024"
+	.string	"$\037Q\005"
+	.string	""
+	.string	"("
+	.string	"\005\001\006\035\001\003\005\001\212\001\206\200\200\374\342\303\375\230\016\177}"
+	.ascii	"\005\001?\202\210\200\020{y\274\001w\273\001\005\001\006\025"
+	.ascii	"\001\"\020\234\236\360\306\001us\300\001w\277!\230\346\030\177"
+	.ascii	"q\303 \002\330\345\030om\307\001w\306\037\004\230\345\030ki\313"
+	.ascii	"\001w\312\036\330\344\030\177g\316\035\337\030oe\321\034\335"
+	.ascii	"\030oc\324\033\005\230\335\030a_\330\001w\327\032\326\030\177"
+	.ascii	"]\333\031\350\304\001o[\336\030\314\030\177Y\341\027\364?kW\344"
+	.ascii	"\026\374\007\177U\347\025\374\007\177S\352\024\330\367\007\177"
+	.ascii	"Q\355\023\230\367\007oO\360\022\330\366\007oM\363\021\230\366"
+	.ascii	"\007oK\366\020\330\365\007aI\371\017\230\365\007kG\374\016\364"
+	.ascii	"\007a"
+	.string	"E\377\r7\364\007CA\203\002w\202\002\f\007\357\007\277\177\275\177\207\002w\206\002\013\330\355\007\277\177\273\212\n\021\330\354\007\271\177\267\216\002w\215\t\230\354\007o\265\221\002\344\007o\263\223\006\025\337\007\177\261\226\002\006\330\336\007a\257\231\002\005\335\007\177\255\234\004\230\335\007k\253\237\002\003\t\234\236\244=\251\177\247\243\002w\242\002\002\324\007o\245\246\330\317\007o\243\250\330\004\241\1773\251\0024\247\002\245\002\244\002\241\002\240\002\236\002\235\002\233\002\232\002\230\002\227\002\225\002\224\0025\222\002\220\002\217\002\214\002\213\002\211\002\210\002\205\002\204\002\201\002\200\002\376\001\375\001\373\001\372\001\370\001\367\001\365\001\364\001\362\001\361\001\357\001\356\001\354\001\353\001\351\001\350\001\346\001\345\001\343\001\342\001\340\001\337\001\335\001\334\001\332\001\331\001\326\001\325\001\323\001\322\001\320\001\317\001\315\001\314\001\311\001\310\001\305\001\304\001\302\001\301\001\276\001\275\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.ascii	"o\250!\220$X<\373w\020C\241b\035\020\020d\230:>\253\004\220\212"
+	.ascii	"\271\354\354\336\364)w\371\333\f\355&>\226\227\232\321d-\204"
+	.ascii	"\243\034\322+\346(\265\206Q\206y\230\370\t\031 a\345\224\266"
+	.ascii	"\301\022\361T\034\233!\220;Ck\324\203\204I\332t\321=\324BZJ\\"
+	.ascii	"\034$04YMR\312v\"\017f\213\317\325\221\3070E\261b\364CN\207\201"
+	.ascii	"];\002m\361}\323R\312\240\311s?Lx\277P\2618{\342rU\256\036\222"
+	.ascii	"\363q\324\344t\023N~Pev\330 wj\275\316B\005"
+	.text
+	.section	.gnu.lto_valueTable.216.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375`\327x\245y\001\272\027\202zX0\312\254\334\0342\262\335\241\025\r\332a\210B\373\360D=\360H\250e\021\364X\206\372\310\315)\365Hr\017\033\224Py\237L\323\326[\363\274V\333\205\001"
+	.ascii	"\030\n\303!\004\024`8D\212`Y\226eY\226\253\272.\017\212HT\304"
+	.ascii	"\340\030\202\227\255\355\356\332Z\223\275%\355\234\007\272\007"
+	.ascii	"\312\007N@*x\t\331\301C\330\2254\217\251\307=\364p\312\031\240"
+	.ascii	"\367;o\211\247d\241\n\024\357\006\017\007O\007/G\206"
+	.string	"\207[\373\261\275\337yH]C\252\320\020\366 \232W\303\250\303\303\305\231\275\337yEg\021\021\036\321\213\030<\030\033\036n\371\273\362~\347\271\210\362ET\260\340\255\350\360K\244_\224\024Q\274\022<\240\023\274\240{\350\227\310_\324\373\235\367\3033\201&\200\177\245\352\204\350\222\346\215\340\365p\370\345\322o\351\375\276+\263\243k3\342\0267\267\223\273\225~\211\366\333\301\355\336n\251\227\223\362\365\357Ibm\314N\314-\344\227J\227-\314\313Q\355\316v_\204]I\357\224;0\367\321/\327\\\260\367\373\316\313\016\3556\262rd'\266%\271\343\242\341\227m\356U\331n\354\226\332\221Q\270\202$\fK\0260$$W\252\276\252xu!\207PI\242\245\305\265\265\324\224\245\344\n\312\023\021^\236\256\tL\372\343\352pBc\t\220\022\253%NFI\254\246\216PA\2710\302\344k\206\024!\022\205\002J\250\311\327"
+	.ascii	"\t\342$\"\355\351\250\302\244?\256\317\217w\302\203\251\007\331"
+	.ascii	"rI\350\n\207\216$d\322-G\315\023\0325l\034\241\251\031\tEx(0"
+	.ascii	"\204\350\222\336\311\210!B\314\323)\331\322\037\337\331\013\032"
+	.ascii	"QT\260\030\332\265\270\231\236\256\3157eE\005\254\335O\220\320"
+	.ascii	"\356\204\b\267\247\213\203K\177|R@\026\262v#v>;\022\031\236n"
+	.ascii	"\351Kz\277\357z\264\344\310\320\365\345\206/\343\233\361~\357"
+	.ascii	"s/W\200-1monw\325\227i\362\371\260\3651\267\024\267\3729\003"
+	.ascii	"py\001#\354J\272\253\245\335J_\306\251\365\362~\337\240\177\341"
+	.ascii	"@\312\226\244\260\007\321\275K7\313\360uh\255\327\373\275s\341"
+	.ascii	"SlS:\026\234\017\233{\230\260\223\240\373\230\330}\364u\312\226"
+	.ascii	"\352\375\336\265t\260\020=K\033\225\256\257\356\325\2013\211"
+	.ascii	"k\177\274\337{\225*[R\2708p&K\033Z]N\236\b\371\026\335\243t("
+	.ascii	"\034x\223d\273\342\375\336\257\272\223\270\367R\322\255\372\222"
+	.ascii	"\333\2077AkI$\371\352RSB4\211\356G:\325]\305\233(\331\264\367"
+	.ascii	"{7b\005\212\310\220\250)\357w\276u\005H\020'*v\310\373\375\225"
+	.ascii	"`\351\321\304DV\343\b,IiG\222\365y\277\237F\262 \345\300\201"
+	.ascii	"\346\345\035\301\243\305\350\250\206\222\213F\017\203!#\306\332"
+	.ascii	"\220\367{\177\261\023\353,\372Poq+q'm\253\321\n\336\330\t\024"
+	.ascii	"]\350>\342N\342V\022\357\367\036\224\222u\237n\242\227\270\201"
+	.ascii	"\270\223\245\332\345\375\336I\364\312\350\352\312 AY\252[\340"
+	.ascii	"\344\320\270[\211_!U o+\0271lc\226T\24256\t&M)B\216_5\221I\177"
+	.ascii	"zb\276\264ffgh\227\033\b\277r\352u%}]\306\312\310\240\240\304"
+	.ascii	"\3343,Y\300\242z/\256\374\320\252xu\335@\374\212*\215\2432\343"
+	.ascii	"E\213\013\335\272Q\360+\262\264\353\375\216f\321|A\231\314\250"
+	.ascii	"\023!zE\243P\236\210\240\343WI\021u\351O\n\365~7\223h\223{\304"
+	.ascii	"\003\n\376\005\303T\245\004Mb\303\305\332R\035\357w\024\211R"
+	.ascii	"j\n5r\373p\261\245\211\364'\225\361~G\243\212\260i\310 B\364"
+	.ascii	"\211F\241\204 \245&\336\357\0268\2511\t\371\026\215\372@\233"
+	.ascii	"\356!>\346\304c\353q\026\205\231\232Q\244\020M\242Q%t\307}\304"
+	.ascii	"\307\240x`\357\367\n\376\002\232\3436Z\263:\272a\203\fI\r\243"
+	.ascii	"\016\236\202\030\324\305\214\306\020\276\022\032\235\201\312"
+	.ascii	"\270\201\270Y\222\227\343\375\216\302x\256\020\350\213\021\364"
+	.ascii	"\374\213\246\230\321\025h\013\224\005\006~\326\304s\361~GU\260"
+	.ascii	"8\345\330P\0233\nt\002\r\352\300\225I\236\211\367;\3723\324F"
+	.ascii	"7\237uB\264\207FI\240#`\256T\356\346\222\234e\210\336-nN\356"
+	.ascii	"\006\342ik'\322\237\235\030\334\313\275!\307\b\271\030\372lc"
+	.ascii	"\273Q\360\2646\025\351\317\316\310\373\375\024s\263x\203~\203"
+	.ascii	"\335\367\207S\236jg\332-\204\247\305\355n\274\337O0;T!\236k\004"
+	.ascii	"w\334\311e>\273\240\235\335C<m\351\"\375\331\2510;\223g]\035"
+	.ascii	"j$7%F6\306\201\253u\272\367\373\031\246%\302\317=Y\301r\005\003"
+	.ascii	"WsR\373\"\203"
+	.string	"\234R\345\244\202\201\253A\3651)\034\271<\212\"<\261\350S\353\314\312\300\325:\326\373}\002\224'\267\024\267\202{\272\263j>\227\bO+\372l\302\344\256\342jT\235\310\373\375\001Jn\030g\222[\306]\364\267\321\356;Z\343\313\234C\346SJx\032\241O\252s\352>\342m7\322\237~\364~?\317\250\223H\210\263\bO\333.\305\212\257sz\n\242\201\273\305u! =|\256\207\220\267\321g\023\323\315\304\335\226m\357\367\223\307\210\034H\341+\241\317\035IHc\357\367S\207\004$\212j\b\317#\372\274q\332\320\300\337\220h\326\373\235\237F4n\251\223\350\236\272\217H\231\300\347\034:_\2341N\030K(\021\027D\267\324\313%+(q\2368S\234+N\025\034\370[\323\216\367\373\211\342\024zb\201\211s\004\016\307\232\317\022B\276E\237?\247\t't\350\375~\372\234$n)>wO\335G\300"
+	.string	"\360#\267,\303\3518\3607(t\004\2319\b\027"
+	.string	"\255\261\ty\033\315\337\3342\360\267\2503\355\375n*\031s\343\020s\353\270\223\322\tA^\300\244)o%\376F\306#\3759\253|\301\340\304\226d\027\263\344\021.\031\b\201\205\215\211\335L\374\r\315G\372s*i\341Yn)>\225"
+	.ascii	"\rPT\361\262\362u\003\341okA\322\237\263\353\223o\212(8\034k"
+	.ascii	"\346ZB\276Es)\\\267\020\376\326v\017I\177x\230\367\273\311\263"
+	.ascii	"\356\"L\267\024\267\272\247\356#\277\005l\240\302\252\311\225"
+	.ascii	"\223\273\212\277-/\220\376p0&\346\n>\305\221\360$\274J\003\207"
+	.ascii	"C\342WG\250\376Y\360'N\204G\361\"\0338\034\222\033\031\302\205"
+	.ascii	"\204\340P;\300x\013&\037@~t\340pK\274\251\351\034B\356XR\262"
+	.ascii	"\341pMFI(\321\327\360\033\034\007G\262\341pN\\\350\375\316mt"
+	.ascii	"\027_\303gp\032\274\250\003\207\203\372\245\214\335\013\316\202"
+	.ascii	"\017q\027\234\b\346pQ/\246\005\017\006\007\342B<\005G\201\201"
+	.ascii	"\303Qe \375\371-\357w~\202\007\325Hc\360\036N\202\227\340>\031"
+	.ascii	"8\034\231\006\322\237\337z\277\363\021=\031rd\350\226\0328\\"
+	.ascii	"\222\003\351\317O\315\2513\306\264\275\271m\340ph\035H\177\376"
+	.ascii	"\007\333Z\004&-\214\032\007\016\247\364@\372\3636\224,\215d\027"
+	.ascii	"\2643\033\016\267\366\201\364\347U\230\265Faced\0358\\\333-\346"
+	.ascii	"\253\361u\005\fK\007\016\027\007\202\364G\004V\334#\255)U\250"
+	.ascii	"\300\034n\031\247?7R\266B<\227\231\374\331p\362$\n\024 _\"i\251"
+	.ascii	"!\247?\031\336\357\1775\303o|\315\356\373O\341<\325\374I\204"
+	.ascii	"\257\204~\253\242\b60\177\311\261\367"
+	.ascii	"8(QO\226==?/\364]'\375\341\357\367\377\013\273\357_\265\303\223"
+	.ascii	"\376\221\020\217d\004\367\257"
+	.string	"'\210\204\005\276\337=f\335S\330}Gu\320\374\273\373nB\2702M\031\r\355\021\206\017[\252\340\353\375\336\032\2654P%Gs\333\312hch\370\260\246\n\254\336\357\355\013\026C-:|\030\325\220\025V'Z\024\255P\207\017#\253@\351\375\336\0061\331\321h}\204\347\021\335\232hKl\370\260d\0054\336\357-\211&H\272\2722\367\320\2135U\020\364~g\227N\236\340\344\3422\274\230\023\005mo7\f\267[\306]t\033]\255\215\021\303\341\305\240\222\357w6\314)\364\204\351\213\222\005sW\275X\024\005\\\357w\326\013\024\036cf\223]\3146\274\030\025\005K\336\357,\027\344\223\030\331\030\207\027C{\n\323\202Uef\255`\271\302\341\305\2249\336\357\354\027\353\305+\361/R\n\025v\n\207\027\213\243\200\210K\353(\212\220o\321l\026V\206\027[\226y\277\263P\266\254\2308i\242\341\307\220&"
+	.ascii	"\363~g\255\270\220$a\253n\246\037CN\340u\204\3526\222\362TD\212"
+	.ascii	"\215\272\201\374\330\322\004Q\357w\226\b;\2047\231S\370\324\314"
+	.ascii	":=\261A2\374X\323\004@\330\037\017\250X\361`"
+	.string	"b{\334C?\0265\001\321R\025\244\216$\026\251\341\307\250.\324\345\340O3{$<\215\320\354\r\326\206\315\217\221]P{\277\2635X\032!X\243,\216\366\024\2748\323\314\302\020\242I4+\203\215\261\341\307\326.\224\275\270a\270\270e\334E\177\033}\315\255h\301\262\350\360I\244\013U\336\357\254\n6\005\222\025+\026\210=\301\006!\251~\314+cfv\204\360<\242Y\037\226\204\b\267O.]@\276\337\331\036,dV\272u)\242\354\223M\027T\314!\335\340\326\267[\310'\235$\030\363~_\333N\242,;\2620b\326l>\tU\366~_\325\264hy\001\363\005\303'\243\250\240\235\3352\356\242\277\215\302\266\bO+zM\256\\0|\222J\002\253\367\373Z\266\222\355\304\262\b\317#z\r\323B&\001\217\367\373\n\306\255\3141/+_6\237L\316\350\"\323\342\022\242I\364:E\212\315'\321$"
+	.string	"\332\222P\266\366$\312\n%\303'\225\026\330\256\266,abuW}\322\202\330\373}U\302%\007\325\212d=r+}\262\315\002\223\367\373:\305\327n)n\265B\021\211*b\363\3118!\357\367u\310\005\323\354\307\314+\220 N6\237\\Z\310\361\243\213\025\017\246\265\307\355\363f\026b,Y\235M\351HBvx\263&\013A9\320V\243y=\272\261\332\260y3'\270\367\373Z\343\365b\005C\270\306\240\327\031\253\214\roV\341\313\373\335\302\372b%\n\261\272\360\241\353\371\262\236\230W\025\302\323\b\275\262XWtx3\262\nZ\336\357k\212U(\304\212B\304O\317S\330Q"
+	.string	"\303\347\346\265\204\020}\242\327\237\325\304]\365]\326*\\\275\337W\037\345\334\254\226\021\362-z\355Q\353\356\243\357\322V\341\307\373]\245K\263\212\233S\345l\376\f\251\302\021\234\332\323\23066d\005\024b\302 \225ji\267\317\237-Q\250\003\263\026\243\013\232zv3\375Y\023\005/fS\246\030\262-e\035\376\314\211B\2261\365\312-\325\3232F\016LK\026\f\177\006E!\013\213ze\325\302\266S1\253U\204h\022\255zuE\031\241\322f\245\305\245ne\37034\n;\336\357j\226\333\025\024\365\t\207?SR\210\341\244\311-\305\263\214y\003\223Dx\036\321\352\022U\311=\364gk\024J\274\337\325*\025\311-\305\255Z\300\205I\t\321'Z\235R\215h\370\263\266\tb\336\357j\024\307\232U!B\276E\253CT\250[\351\317\342&Xy\372\251[\212#\345\254|"
+	.string	"Q\177\210\360\362\312\245\t[M\346\334\224\252\244\362P\227\232&0\331a\222y\302!\354m\321\252\216\034N\023\242\336\357*\222zc\302\222\211F\r\325\250\303+\241&\364(\242C\276\210\241\302\300\360\312\250\tF.\324\025j\013\225\305\206WRMX\361~WUL\231uj\220*\244\236\200_I6\301\347\375\256\002\365\260PI\250%T\237$\334\373]\035A4bY\206\016-\355\375\336#CD\342-\016\356\366y\245RB\231\233\217\334\332\0301\033^\271&\241+L\2111_\224=0\360+\333$@y\277\367\274\230"
+	.string	"\223\354\3223\023a\366\3128\tU\\\270\325\217\030\331\030\207W.%"
+	.string	"\t\313rK\365\264\334S\367\021\265\231(@\311/!J\205\356]\261\242\341\323$\324x\277\367\274zUn\251^W\317\277o\220\226\226\260\267E\367ziN\022\200\336\357\007\350e\365\260(\234p\"D\257\320\275'\275+\021n\237\006\025!\314\373\275\327dG&\3645I\226(\261\371\264\250\bbU(\214PMQeI\245"
+	.ascii	"3\367\240\204h\026\335#\322\033\302\341\323\310\"P\275\337{B"
+	.ascii	"zO\267\324)\264\245\242\327\303\007\220\336\217{\350\323\224"
+	.ascii	"\021z\274\337{M=\246[*E2\313lY\221\234{IJ\275\035\"\312>m-\202"
+	.ascii	"\213\367{\017\311\302\352\006\016\244\333\347\323\226\021\200"
+	.ascii	"l\264x*\022\236Gt\317\250G\343\366y5\244\0322\357\367\336\214"
+	.ascii	"\236\214\236!$\321\213\236\213\r\257\206\254Q{\277\367\206z-"
+	.ascii	"n)n\365PDG(T\364R\330\274ZM\230\320\216\306\3343!D\223\350\036"
+	.ascii	"\320\217\206Wk\212\362~\357\225x1U\327\033\321\353\321\360jQ"
+	.string	"5E\312\360\326`\274\326\234\312\t\321$:%3'\242\354\325\250\270\244?5H\357\3674.\206\025\233[\332&\302\354\335\220\316\322\237\232\030c\206dL\245\205I\325:\274\033\262&H9cG6\247gB\364\211N\275\244h7\323\273-A\030\363~O\273\024\245csZ&\344[t\312e\213\206w\203\032{\277\247d\267\024\237\212{\032`Z\262dx\2676\bXX\214\272\276R\257{\350\335\342 HU\251\201\265%\205\353\256z\267%\004\344\373=\325J\263f\310\216\254\234\b\3217:}r\245\341\337\220 \f\275\337\323&)\223,\033H$I\322*\016\377\206\2040\342\310\215\030QFR\251\f\377\266\364 \255HJ\204\002$$ A\204<a\370\267\246\007b\357\367\324\311\t\216\245\036M)\323]\365oN\017\240\274\337S\036\004\310\221\"\351\020v%\235&!5\374\033\024\221\367{\232#\305As"
+	.string	"\035Y\214\216jD=\260\361~Oi\314!9\026\f\031i\f\r\377F\365"
+	.ascii	"\305\373=}\221\272\270\245x&\2768%\245)\322\025i\213\224\205"
+	.ascii	"\b\267\177#\243a{\277\247*\210\256v\244&\200N\244A\030\376-I"
+	.ascii	"\223|\277\247?\rP\342\225\301\371\2609\355\021\242K:MG\300\377"
+	.ascii	"\206F\203\245\356\001Kprd\346\224Wq\021\340\2616\246\215\355"
+	.ascii	"\036\372\2675\232!b&\320\303\013\2304\236\362V\372\2676\032\243"
+	.ascii	"\367;\357K\005\230\312\222]xf\267\317\277\305\321\260x\277\363"
+	.ascii	"\270\360\266\334R\334*I\023\230\026\261\260\r\377\266\244!\221"
+	.ascii	"\205n\211\017^\025\236\027\317\n\357\353fz8\244\031\345\373\235"
+	.ascii	"\327\305\344\007/\213\267\305\223\302\343\272\253\036\0169c\345"
+	.ascii	"\375\316\323j\002\244\311\025\024\336\023\233\207[\232q\342\344"
+	.ascii	"\211\323\221$K\224px\270&\"U"
+	.ascii	"Hj\266\202\020\2112\"\305\341\341\240fv\274\337yE\246<\375\b"
+	.ascii	"\"\354J\232'\344i\303\303\241\315\024\005?N!'\324y\344Dr:9\257"
+	.ascii	"\316\255\223\353\354:\275N\2603\313Yvn9\275\234_\3160\347\332"
+	.ascii	"\351v\276\235d\316%\352\203\226@\205P\024\350\020J\204\026\241"
+	.ascii	"4P$\024\007\272\204\362@\177\240@\320!(\021\224\n=\202.A\255"
+	.ascii	"\320((\026*\005\235\202~\241VP-h\030\272\005\345\202\242\241"
+	.ascii	"^P54\f\332\206\272\241s(\231\336\323G\364\237\016\324St\025\235"
+	.ascii	"\250\273\3503zQ\267\321ot\035\035\331\227:\217\356\243\377\350"
+	.ascii	"O]H/\322\243:\222^\325\231\364&\035\253g\365)\235J\267\322\257"
+	.ascii	"t\262^\326\317:Z\017\323\327:\\\217\353ez\335\256\304\316\304"
+	.ascii	"\016\305.\305\216h\347b7cW\264\273\261C\332\355\330)\355\232"
+	.ascii	"v>vO;!\273\250\235\324\016\311\256j\307d\327d\027e\207\265\223"
+	.ascii	"\262\233\262\373\332Y\331i\331\205\355\314v]vi;\265\035\333\256"
+	.ascii	"mGf\267\344\221\340\371\360\204x(x-xC<\031\274\031\274#\236\r"
+	.ascii	"\036\222\227\304k\342\371\340A\361\206\360\246xT<+\036\023^\024"
+	.ascii	"\036\026o\n\217\n\357\n\017\013o\214G\306;\343\241\361\324xa"
+	.ascii	"xn\2747\336\222G\227\372\244%R\241\024E:\224\022\2453\322\242"
+	.ascii	"\324Fz#\335\221*\245>\322\037)T:$\235J\251R%\351\222\024J\032"
+	.ascii	"%\235\222RI\255\244W\322\260T,M\246f\351\227\024L\272\226\212"
+	.ascii	"I\337R\270t\231\322\365H\364|zA\275\023\275\025=\026=\030\275"
+	.ascii	"\030\275\032\275\243^\216\236\216\336R\217G\317\251\027\244W"
+	.ascii	"\244\027\325;\322C\322\263\3521\351A\351E\351M\351Q\351a\351"
+	.ascii	"\201\365\312z[zg=\264^ZO\255\307\326k\353\311\365\346zuj\217"
+	.ascii	"jB\375QQ\250)\324!\225H\225\241\316P\217T\033*RMR{\250L\252\223"
+	.ascii	"\032D%\242\026Q\251\324#\252\225\312D\215\242b\251R\324)\352"
+	.ascii	"\227jE\rS\305T.jR\365\242~Q\303\250k\252\233\372\246\222Q\227"
+	.ascii	"\353\210\225\304\n\264\006\255-\326\241\265h\245\261\"\2558\326"
+	.ascii	"\035\253\322\332\264\372X\237V!\253\324jd\255Z\223\254MV'+\326"
+	.ascii	"\232\265RY\253\254WV,\253\330:\266\232\255]V\345\232\266\216"
+	.ascii	"Y\331\326\270Un-\263\326\261%X\023\254\020\213\202\035b\211\330"
+	.ascii	"\031l\021\213\304\342`w\260Jl\023\353\203\025\302B\261F\330)"
+	.ascii	"V\t\273\204\275b\237\260Z\354\026[\205\355b\301\330,l\031\273"
+	.ascii	"\205=c\321\3304V\215ec\333\3309\226L\333\323\216h\177Z\2406E"
+	.ascii	"\253\242%j]\2643\332\242\366F\213\324&\265;\332\246\326G+\244"
+	.ascii	"\205j\245Z#mU\233\244m\322:i\261\332\254vJK\245\265\322^i\305"
+	.ascii	"\332\261"
+	.string	"\326\254\355\322\246\265jm[\353\326\316\265d|=\276\021> _\220O\205o\205\357\205\017\206\317\310W\303\207\303\227\303\247\344[\362\371\360\375\360\t\361A\371\214\370\246|I|J|N|W\276-\037\227\257\313\347\345\003\363e\361\221\371\312|]|g\2764\237\232\217\315\327\346\223\363\315\371\352\334\036\327\204\373\343\246pU\270/\\\030\256\221[\303\305\341\346p\225\334%\327\207\373\303\025\342B\271R\256\021\267\312M\342^\271O\\-w\313\255\342v\271`n\026\267\314\335\342\242\271^\3345W\214\373\346\302\271tn\231\237\317\257\304\357\004\003~+~,~/~0~4~F?\034\277\034?\245\337\322\317\307\357\307O\310\002~R\n\0201\266\201$=A$,\300\237\210D\025\321\360YKC\206@\3352\356\242\277\215\246\234\204|\213\376=\005\261\371\254(\344\373\375\007\204\357p\364\3705\375\2304|\026Y"
+	.string	"\206x\304@\356\370%\331|V2"
+	.string	"=:P\033B4\211\376!\335\310\360YJ\345\373\375w\364\253\361\3532\212~3\356\241\317Z\333"
+	.string	",\306n\310\005\021\207\317\212\213\322\202\007\006\205\212\024\031>kI\344\375\376\023\372\t\372\001qx-\244\rv\274\337\177&\344\346_\217\360<\242\177$~#2\274\026r\003\242\367\273[7\267t\311\334U\257\325\364\322\275\337]97\356\226\342Y$D\255VlB\276E\273nm\"\334^\313\311\354\375\356\216a\323\302\250\331\274\026\324\333\245\374\022\302\005\003b\006\017\255\2353s\317\334.7\323kQ\275H\222\\$\370\344fW\214\314\035\023\341\366[q\357\2160-"
+	.ascii	"p\237\254`\271\322\341\271\226\336\031_^\275\237\024\341yD\273"
+	.ascii	"T\334)\267\317sE\275)"
+	.string	"\336\357.\327L\224,,\016\317E\265\204B\303\304\211\333\004\303s\221i\220\366~w\255\\%!\334%#\350jz 7\273TH\216\330<WR\313\373\335\235\202\200$\022\345\026\201\237+N\203)\357wwH\215\323\223\033d\303s-5`\002$\202\\\217&&\016\337\205\004\305C\302\030\344\216$\233\357Bj\240\343\375\356\352\230`Cxb\321.\222{\203\303w-i\340\342\375\356\036\001\315\020\242I\264K\243\250\303w5i`\342\375\356\312pc\254\025\206\\\027.\221\315w9e\320\366~w[\270+B\270,\330\234RH\261\020ev\203\204\356\t\332E\341\n\331|\027\024\227\367\273i\345\002\3358t\334I\022\200\315.\t\341iE\273%\\\237\016\337\205\226\201\327\373\335\035qajY\206\316\346\273\224L\310L\300\364\026\347\203\263\371\256\f\204\274\337}n\374hMxb\321\2761b\356\241\357j\313"
+	.string	"\307\373\335\027\246\202/J0\030\276+\216\310\013\232jA\f.fI\f\337\265\314\300gK\212\004"
+	.string	"\016\024\346\033\363\211qx/$\f\330\264\\ g\005\313\225\r\357\205\304\240\313\373\335\367\0056\373\246T\361Q\271\207\336k\t\203.)\031`i\371\262D\244\275W\024\006Y\357w_\224\273\310\223[\312\007\345\236\272\2178\265H\253&L\340\367\242R\262\344\210\360<\242}UH\340\367\"\303\200\310\373\335G\265A\021\251\250\016\357\225\304`\211\210oH\210\347\242\t"
+	.string	"\227sz\362\005\021Q\366^h\030\f\001\021@\017_\223\217\351\366y/%\006&\336\357>\036S\276\035I\033\336k-\356\375\356\323A"
+	.string	"\237\r!\372D\373\220|76\274W\333\005`\336\357\276\243\002\314\240\341+\202\337+\356\0022\0311|\006\030r\341#\352\360^\313\013\250\264`\341r $\344[\264/\205\017\005\206\377B\272\300\352\375\356;q\200\265\331W\302\367\3433\241\341\277.pz\277\373||$. "
+	.string	"\214\256\256-#\242\354\277\234.(z\277\267K8\2716\356\006\372/("
+	.string	"\320\275\337\3337\005\210a\033\023\225\\\0133\301\002\332\263/\312\026\314}\364_T"
+	.string	"\300\362\202FA"
+	.string	"\030\260%\311\345\370_d>\312\310*h@\213%K\230\226\343\177%\265\324"
+	.string	""
+	.string	"\213\367{\013f5"
+	.ascii	"\007t}y\331\374\327\232\005e\336\357m\225\007\214\330\222\302"
+	.ascii	"u\017\375W\233R\353\303n)n\005\201\034O\204|\213n\243\264PD\320"
+	.ascii	"\275\225(\013\262\"P\264\204\211\325\206\267BU\245D\002TH\216"
+	.ascii	"lx+d\026<M\361\265\271%\022U\344\256z+I\013\216\206P\300\312"
+	.ascii	"\351\251\rr\017\275\226\245\005(\336\357-\220\366G]]\005\236"
+	.ascii	"x\bO+\272ej{\330"
+	.string	"|\030R\005s\357\367v\251U:-\220\243E\266:\356\252\017CV`\206#\t\262\206\215\346\215q\b\003\211<\307\337\f\002\020\320AN\002t\202\020vb\036\370g\332@\331\276\251\345\017\305\032{8\337H"
+	.ascii	"\002\343\326\354 \007\2761\256.=\3276\020\030\377L\234\230Vq"
+	.ascii	"b\232uqb\332m\211\363\020(\007\211\036\346a\f\204qb\372\327\316"
+	.ascii	"\306\343O\256\343\235`\035\347\310\035\314G\330Cl\373\314\033"
+	.ascii	"\343\020\226\217s\221\350\232C\371\003|\003,\326\261\207\031"
+	.ascii	"\023X\303\301\231\346\251\246\020(\347\250\255y\254\213u-\303"
+	.ascii	"2\035\32770\260\216\260\316\307c\315\232\252\231\003l\215\300"
+	.ascii	"\332Gcv\220\023\301\354 \307\202\255c$\316\023\344\017\263\035"
+	.ascii	"\177\230k9x\224\2110\016q\316\261\213E\372\b\003\353\013\346"
+	.ascii	"Q\226k\0349\b\203\230i\370\203\361\346g\036A\350\314\310\301"
+	.ascii	"\"]\3171\005\304\031(\037u@\324,\210z\030\317\305\331\216k\330"
+	.ascii	"8c\376L 0\206\203u\021(\327>\263.\022k\371C\021\007\006Q\364"
+	.ascii	" \004\306C\0174-\210\230n\315 1\246\351\"k\322;F8(\003\211<G"
+	.ascii	"\242\016,\037uf\314\007.\275\003\301<\312\303\"k\312:\303\370"
+	.ascii	"C]\027\201p\235c\273\356\315M\221\246f\2478\204%0\345Z'(\337"
+	.ascii	"\304\307\341\034\337<\2301i\352\270\350\001\376\rc\017\364\214"
+	.ascii	"\303\232<\366\f\214\2151\020\266c\017-\210\230\2160\034\352\334"
+	.ascii	"H \316t\004\034\342L\254\343\235\n\346q>\312\265l\037yr|f-\333"
+	.ascii	"2\355\003\312\266\034\244\360\341\b\313G\235\237]\313\303\030"
+	.ascii	"\266c\017\300\007\020xj\331\266c\017\260\f\254\2137\024\202\305"
+	.ascii	"\271\226\215\360\215q8\257f-\007\347\017s\2605ky\036\032g{\250"
+	.ascii	"C\377\330\330\216=\314\307\235\230\0076\316\303\233\t\346Nq\370"
+	.ascii	"\033\306\265\255#\023\341\240\002\326\240\002j\314\235\342\260"
+	.ascii	"5sp\346\234\240\002|A9\250\200\031S>\016u\2102\360\001\275c\234"
+	.ascii	"1\341\240L\3271Q\007\236k\233\306\264\353\330>\3028\304\031\246"
+	.ascii	"`\006g\032\256s\354\264\316\261{G\331\216\353\265\365\001Yu5"
+	.ascii	"\213F\0202\274\023\363\364V\366\b\357\304<\252\031\033\355\236"
+	.ascii	")\214\345\332\003\034\033m\327\224\2071\360\bC0m\242\f\254e#"
+	.ascii	","
+	.string	"\3417c\326\262\r\214\3538\007\b\333\305\242\007\271\266\343\240Q\007\036\306s-\037#\230\306Y\b\323\300 \254C\317\353p\030\323G\326\004\022y\2160\254C\317?;\206\355c|\003\353\3203\r]\307\3079Hc\322u\f\333\307z\276\201\211Ex\030\003#\364\314 1\366\020\214\345 \274\023\363\264fP>\326\362\007\271\206\207\305\332&\026\201\360N\314Sc\322E\242\034\204\217G\031X\254\215pp6\322<\b\316@0;\310\201\023@cv\220\023ts\200v\221\030|0\033a;\366\360\301g\312C\333.\32696\034\303\301\331\bA\002\217=\177\210k\034x\266\2111M\260\216w\352\342MP\226o$\370L 0V\20383fpX\3149\312u\216\r\333\304\271h\264\345#\005S\246g{5y\342\241\034d\315\032\b?\223\247\226?\024\201r\r\347\034\343\032\350\306v\3215\331\031\363\346\246h\353"
+	.string	"a\020\361P\256\037\230F\235 q\336i\315Z\266g\326li\235cp6\316\230\035\344\300\307cl\334)\016\341\235\230\307\245`\036i8\030\3139\261\260X\034V0\2173\210x\202L\234\343\332\206\21350\2461\316iz\223\032\347 \357\206g\234\203;s'\346\201ov5f\216\215C\224k\373(\301$\026g{>\022\343\372\301P\376 \017Y\323\006\31277\020\354Z6\202\220a{8\3330\261\330\301\\\027s(\230\366L\317C\330\3261\332:E\270.\332E\372\201i\023u\212\300\242\255\023O0\203\262M\017\355\326\004!\017\215:\301\233a\234\003\323C\3335m\342\f\323u<\214a\333.\346\270&=\264a\342\f\007g\343:\034\312@\271\206`a(\353\334\200\340\351"
+	.string	"\006\002c\343pX\254'\2308\3049\030\3139\3660.\316u\374\201\202\211C,\016a;\036\006\211:\305\032\247\002S\006\022c\3738\007%0m\242\\\327:@\031'\266\207\305\0170\360(\323\306\332\002\360(_P\313FZ\266\341\240<\364\020\037\347 \314S\3332-\017e\233\002\363\b\234\355\343l\307\366\021\026\036c\373g\312\301\"\r\343\350x\220\203\253\231\003\264\347\235#|,\032\033"
+	.string	"\313v\\\317\23020\256q`\272\216ab\021\256w\2143\246l\3075,w0\323\263m,\302\265<\324\t\3129\300\343\204a\021h\037uB\020\214\341\235b\r\033\2174l\327E#O<4\036\347\240\005\342\f\007\345\241\317\304\231o\210E`k\202(z\200\2133q6\252\346\321\2029\214?\324\262M\234a\333H\313\266\035\303\037\344 l\317\304\371\002\223X\234\217\265\374\001\036\026\201E\273X\033+\230r\255c\307\362\r,\003\347\017r\020X\317\230\262\221\307>\352xp\315\243\216\207\331x\324\301\200\317<\036\345:\030\214a`\002\346\007&\021g\036\306p]<\022\345#\214"
+	.ascii	"\270X\363\340@0\217\262\255C\234iX&\026;\220\351\331\236`\023"
+	.ascii	"u\212\364\315\234s\204\345c\234c\204q\210\263\321\030\017oj\344"
+	.ascii	"c\354\001\202y\204q\344 \215i\003\2150q\246?\300AY6\036k\314"
+	.ascii	"#\r\017e 0v\207F:\206A\3044\\\374P\313G\b\246\034\324\261g\""
+	.ascii	"NL\303\306xx\343\232\266|\274\271)\302\304\031g\256\2130\016"
+	.ascii	"q\336y@\301$\316 b\032\026\201\\\337\324\230C\231H\214s\200\022"
+	.ascii	"\230 \344 q\206\345\341|S\254\215p-\333\306b\216=\023\353b\005"
+	.ascii	"\342N1\b\301\224\205\305\332>\032u\344!\0161\206\345\340<\304"
+	.ascii	"a\2031\260\r\376\206\261\207V5\326\361\216o8"
+	.string	",\326\017vb\036\230\307\236\201\305Z\276\241\251\2139@b\314\306\304\342Q\256] Q\236\201G\2716\376\2129C\331x\224\345`\034\324\211\217\255I\234c\034\370\346\346xT\345\340<\304\201\201\263}\214\207r\261\226\343\tL\240\001\2168\304\331\266\345#\007\363\020\310\001q\216i\016\200\365\221\003\003T0\213F\271\346\300.\026k\016V\323&\3123p\276\271\221\213@\330\030\017o`\340l\037\343\241\\\254\345\370\202\371L\276\311c}\326w\275\327gy-\277\345\271\274\227\377\362k/\346\341>\356\313|\0357\301\177\270\n\276\202\277\3400\270\021\257\301sp\035\234\007\357\301\235x\020.\305\215p%|\t\177\302\241\360)\234\n\277\302\261p2^\306\3178\032W\343a8\034\217\343ug\317\tt\006\235,\316\026\247\214s\306\211t\3428\225\316\245\323\307\031\212;\250$d\336\016\"\241\031\255\204\230\032\021\b"
+	.string	""
+	.string	"\220"
+	.ascii	"\263\0304(\n\213y \347\324\003\024\200\031{\2128$,2\257\325\266"
+	.ascii	"\f#\020\221@C\330\001!1\327j\244v;\023\266\350,\271\375\017\006"
+	.ascii	"0\322-@;\352.\351\345\241\367\204S\002\327\fE\224'\244 \245\030"
+	.ascii	"F\b-\253\207S\210\262\247\207\201F\024\226\350\331\257\t\317"
+	.ascii	"\201\020\326\336\227\363:\t\221nY@+Z\253\217\353\2126\331\302"
+	.ascii	"q\006q=|\022!v\3528\215r\325\211h\302\314"
+	.string	"\201\216\212\234X\3636\211D\276\263\240r\366\023\037?O$\346\201e\321\355\372\022\177\310<Q\232\3129\256@\366\232.\177\357[\267'*\270\360\316#\023\374#TX\336Wr,A\227\035"
+	.string	"\342\003\224\013Z\0051l\013\344\315jA\235\367\251xUR=\243\037\363\0379U\275\212\2711\347\023c\230}\364F\241u\312\204\322H+\"h\216\312\211+\261}X\350\006J\306K\265\361\254\037 \353\357Y\326\201\330<Z\006 V&Mn\035\247E(\3744Z\302\214+4Q\235\234\245\033\213\2724\233\355\233\026#\fG\222\024Q\006"
+	.string	"'\033e\304\020\016\351\022\252\245\201c\016 \272slmY\331\007\240T\251\235\023\370\204:\262\300O\260\350\243t\315\304@x\331\032\214y\344\020\2247Nk\341\372\332\022'\3665+-\355\036<*\344$S\315\273\340l7r\341\271\006d\304\337\254\304G\002\366O\026~\241\226\234\262\337\370sV\037\367O\r\303+\242F\226\377AN\256|\216v\202\356\2347\272,\025v:\266u\274\206U\033\245\207Oe\346M\370\023] \013jRd0ua\222\330\031s\336\313\314\241e\026\203\225A\261\250\210\235m_\244L|\2439\t%\214\362$?\2024bc\035\362\316N1q\360\320J\t\"\223B\374\222\331A\252*\325\374\265\3072\357\245\031\344p\317\006\033\201\352bz\362Y\030\267\005/Y\257H\312"
+	.string	"\004\320\227%}[\302\363\372\210\246(\t)&\217\323\3639\212\300\301pq\327z\023T7k\365\1770:\377j\224\f\2170\275b\310\227\f\306?I\342\205\240\0036\350\ti+\203\026"
+	.ascii	"\311\243l\002K\243;\32349\273k\231\350sp\325l\r1|n\262`\330\260"
+	.ascii	"%'\255|\266\265!\033\202\366"
+	.string	"\246\nD\026Z\272}7\n\2744\325\200\254\217\354\373:d/\347\216\263$B\236\037*H\312\202\314Z<Z\017\330\221\005\372\225\352\261\276\241\007\255\027\252\007\336]\024W\035\261\225\bI\3264\bI\223\273\344>[\231\206\351\030\031\345\225\310k\347h\0069\240*\372\024X\005\346\317\371\234\3421\345\1773\217S\330\023\366)Bn\331\207\342#Kgr\264\032\001K\031\236\324\276\021xDuG\333\303d\365\303k\021\232\t\030Ha)\377\020\036\304o\b&\370\320?3\377o@\250\0224\337\037zD\346\306\201\370\320\300\325k\037\234\222\331\301\037\322\264\177\004f\026+37\006\372/\307\037\266\250N\331\342\250X\247q\022\373\205\031\343\357\337\277j\254\327\036_\275\237\357\367\363,\375_k\277\346\322\352\342\316\337\030s\352\303\020;\353\212M\201\327G\272\t\373\307\311\006=\324\321@\006\317>I\325\354\304\341l\370"
+	.ascii	"\312\210\211x\263\216\355\220\220\373\361K\177\230IIe\013y\244"
+	.ascii	"\323\374\304\2064B\0323\245\322\301\0075\006\367\0379\234\254"
+	.ascii	"\007B^P\346P\360\377Mb\313y\\\322\013O\242cs\031\323d\b^F\312"
+	.ascii	"\r,Rld\303\343\266\333.|\263\2436\232\215nT,T$\212q\007\244l"
+	.ascii	"\301l7\357\307\231q\032\224\221\276\355 T\311\353\315P\362\203"
+	.ascii	"ka\350\204\237\215~\362K\275q\026\023\226P%\323Pm\236\226\242"
+	.ascii	"\377\211Q\271^I\277\246\343\035}\331\360%\265\3731\254?v\013"
+	.ascii	"\214\2538\206BN\324:\274\301\220\330\037BNL\247\005\316\036\037"
+	.ascii	"\033\374\3233\016U\b\353\263\376\005&\351\204IA\365mlMN\013\346"
+	.ascii	";F\217kE\300\254\032\276U)^\226z\367\242\370\f\3219wk\274>\360"
+	.ascii	"\232\020\fw\322\031\243t\016\367\235\301\0216#*\001\367o:T\352"
+	.ascii	"5\354"
+	.string	"4*0R\207\337\016\320#\215\254\371\222\334\337\227\222\334\255\032\331\261\2353g!\2654\362\242\215%\320\004\366\303j;=D\360\242\242\024\2027\024$\233\216F\241\307\312\370\247\336|\"\271iG\206\253\376\t#\341\032\361f\374\323\346\233_\225z%Z\343?j]\201\335o\252NrR\351g\032s\321\025\302+#b\023\276\26702?\242|\220\r\r\303\353\265\3651\343\205)\n\341Qc\222\033\267q,A?\276\200\302\346\366)i\002\224\232\254\305Z\256J\365\036\2722\321\303\301\237\326\373\r\005\341\301\254\252\335:\340@\326\300\321\216Wv\224;P\313:\235\n\242\356z4iT'\343Y\353^N0(`cx\271q Y5\354\352nd\177\027\001\036*\3558\261<\210\340A\243\252X*o\244Q\374\205V\3213\211\231\036n\234\255\265\363v\300L13l\245e\305<\350\026e\374\356\200==a"
+	.string	"\264\fQ7\357\334\2503\243\325\367\362[A\316\327\272z\327\037[\b_\266\237\366Mg\254\036]\336\317[\377\322p{\272\272c'\367&\272\207\311y\377\275:\251\322(u\033o\016\002\202\360\270\362='\344\363\024\203\b@\347\1770\"\212AQ\202\207\177\202\213z9\310\232n\333\fp\004o\337\326W(\345F*E(7\361vlq\251\222v\356\231\204\261A\335<\241\002\242\365\246\213O\023\250\372lYL\025\244\301\207\206"
+	.ascii	"I\231\350g\375\036\\\216,\334]ti\310\244#\200\333\270\020M\215"
+	.ascii	"&1P\307\020\365uD\257\273a\036\207K\r\223\3667v\031!\377\274"
+	.ascii	"t#$c5"
+	.string	"\225\221;\003A#\237\n\306l8\253 M\364y\016\2302{at+\262So\0161\231\3404\371l\034A\013\210\330~N\027\236\347\350QeeR\373?$!\252\220_0\251\343\315\2220x\366\032\271_\317\366a\210!R\347Q4\235\333\302\320\232\202\221'\375\234\242F\345\210\341\027\372\325H\020\017^\241aJ\370b\235\320\252\376\341b \235\237\017\310\364\233\363\3577\033Q\345\223\277\007\212%4\bv\305e:K\304\375%\227\232\024x\0057\353\266@\212\352,\225\325\243L)\225\344\340g\222\262\357\241pZ\356\227B\320\016M\300\234\0039\261\007\036\373\023\314Q\265\3606\"\253Z\021ZW\201\022t\336\365\220O\376\013\272\022\320\316\301\003\366\225Q\251\253\237\272\302\320\276\212\263\374\bK\304\035Vr\203\277R\335\227~zGp\326n\252Ls\312C\365#6~\325\234\256Sx\260\247\212,\237\374\263\340"
+	.string	"\r+d\t\024 \347\004\332\330\377$\306\035\351\215\224p'G7\325\332\223\326\n2(6\360\356%:\033WWM\310\240\030\\\307+\353\375)\275=\271\264\252\362\217\205u\321\tF\344\323\006\221"
+	.ascii	"\260\216\3502\324\256X\273:\317ts\255'\217\221\342>\002\005z"
+	.ascii	"\331\357\001\375.\bh\261c6\274M\330\f\021\221\314'+\231@SE\275"
+	.ascii	"\264\0077\0044(S\360\363\251\026\222\3206T\372h\001\266`\243"
+	.ascii	"&\021\233\373\300U\002\267]L\3532i\216\262M\371\245\327\337\020"
+	.ascii	"\237\252j\301]\"\303\355Y)\334 \346\305c\372i2\0016%~&\307\363"
+	.ascii	"\364\323uD\267\324[{\212aF\354+\341F\017G\362\240F\261D2\353"
+	.ascii	"Y[\355\022\263\333;\216\315\303\326Bt\236\303\276B\234\241\024"
+	.ascii	"\201\316\311L6\353:\222}\257\371o*SEg'\202*/\2168\021\235\305"
+	.ascii	"\367,7\026\211kk\225o\213\272\210\025\024\230*t\206\023\022\212"
+	.ascii	"\244\267Q\221X\003K[\034\271,\236\307\305g%\263\337\365\016\241"
+	.ascii	"\322\356,\347\367\034\253O\301*~t\233\240\364E\324\034}\355\242"
+	.ascii	"\202"
+	.ascii	"\215%mm\241\036\261\225\025\323u\027\264\307\247K\342\270\316"
+	.ascii	"^\322\323\304\305\326\030u\362\003\203\200}0KM\276\234\375\333"
+	.ascii	"\263}0\026\362\200:\326\332\247\251\330\332\373\235\212jd,\002"
+	.ascii	"O\333\217\267\233\342\233\205\342c-\355O\005\312fZ\024\321\261"
+	.ascii	"\013\2161\030|\2129(\333\261\250\315\337]\344*\310UA\b\f\204"
+	.ascii	"q\007\035XVs\345\3527\002\240E\035\313\312&\007\033L\r\025\310"
+	.ascii	"g\273\017\336\233\\\255\220\212\204\007\315\264\250\300\323\033"
+	.ascii	"\377r\252\222\264:\326w\f{\315Zk"
+	.string	"\212\277V0\342\023#\300\330p\251)\215\034k4\032\\\337\017P\270D\2055+WL`\273P\243\260\016\251[v\325\310\026l\255\244\\[\304\311\351\322X\300\231\370l\rm\024K$\324\220)\374\360[Nw\300}\035\251IJ\243'I\276e?q\003;\261\031J\252Q\254&C\244;k\225g^\374\374\375C\342\374z\3140\037=\354\2662\344\202\335^\374\362%\316\300\255\313)\312\231()\303g2;\3448\335CN@\354\310\227EB\356\215Ts\2728+\356[\316k\203f\005\325\267\244\340-]\261x;P\235\270?\255Qg\315-\241B\002\365\232r\036K\231\317\322B'\032<I\304\266S[\211w\360\331\216\030\031\210]s\362|x\267\214\221\367\033\253\343\007\334j\263\021\370\345L\347+`\312\304x\322\216V\235v\374\033\317\030\rNf\257rA\234\3641)\253\206O\241J\252\\\374:X"
+	.string	"\306\233O\\\256d\234\317D\002\245\251\352\203\225\026#\216mV\033\005'9O\303\001|\003`\0302o\226bk\325.;\230b\365\316W2\336\023}\023c\004\0326\302Z\221i\231\261\364\324\030\274\372\322\332\f#<\254\210\344!\n\323\004kk\250\312U\264t\247;\"Q\370\021e\342\326\362>\300*\031\301\264\031CGI\301\204\232\230g\034t[\253K~\313\025Z\361t\006\305j\334\353e\002M\242\223\3560\301\231\244\001\213\264\236\3758\210\247\252\326\363\300Ir\320\314\323\272\334\364\037T\235I\016\324\312\354A_\357T"
+	.ascii	"i\247\314e\221X46s\303>\234\316\263.\236\016\271t'l\277a\034"
+	.ascii	"U\377u\234\356Gky\250\001+\035\247\204\210\337\302\255\352\313"
+	.ascii	"\335\002\261\255t\006\232;\240\251\231\216\005\262K\031\026@"
+	.ascii	"X\177\254\2117IQ\344\2732\200\f\310\325\004\001K$\f\366\b:\250"
+	.ascii	"z\361\340\330T\367\341\277'fO\236\033QC\003g\366-\237\217@\341"
+	.ascii	"\332([\321\354\250\322+|\353\227n\r\2532\236n\r\277t\240\013"
+	.ascii	"\234K\233Yc\331\005\222\255@\346\233\315\260y\267\023\240\355"
+	.ascii	"\032\345[^\332\n\221&r\337\034,\367\370\307\202](\003f\254KD"
+	.ascii	"\273\325\342\233\016@\367\316\261\022\f\n\027\234\371P\034N\253"
+	.ascii	"\"\253~S}s\271\373\224\317I\314qLl\233\300\305o\203\220\251D"
+	.ascii	"\002\335\234%\270F?Q\020\234\021\306\373E\275\313\274\206D\n"
+	.ascii	"\363\360\24336Q\273@w\336H\0233\333\354^\326'\013\242?\306z\253"
+	.ascii	"4\253\005\005\331\255\205p\344\223^g\303\361\3628\314\207\366"
+	.ascii	"4\252j\305\331\355,\373D\342\222\3452\225q|\300\301\006\221\312"
+	.ascii	">\217\257\2768\307\245lZ\377\362\234YK\222\003\202\243\316\222"
+	.ascii	"\215\006\213\263Y\353\215\226#\001Q\035|\002%v\263Ue\004'\276"
+	.ascii	"\247\345nP\304\361jUA\230\021\371\311|(\204\225\337\214S\340"
+	.ascii	"\217\204:\254\032\312r\002\254wJ\347\305\237\373S\034\tx\267"
+	.ascii	"\274\341\344xo\026\013\224\355\202\354\035\333w\027\007p\224"
+	.ascii	"\036,\004\t\247dx\206\202@wQf\3506#\207\274\025]\272\023\"\317"
+	.ascii	"p\364\tU{\323`\034\210\351S\256\205\003)3\036\220I\2704\353\020"
+	.ascii	"\017;\333\206\b\302\002\371\214l\372\370\\\332\b\266\365\221"
+	.ascii	"\217i\341\254\222=EQ\253\367\232eu\235\331\210\n*\021\307\201"
+	.ascii	"\327V\330\032k\006\356\222\354\341\320|LS\360\342\177\325\263"
+	.ascii	"\002\261\372\371[|\026w\213\267H\315ov\250\312\307\231\271\257"
+	.ascii	" \366W\336\025(\216P\276\313\215E/\020\324\327\342,\361\224\017"
+	.ascii	"0\230\223\362\271\241\365\202\347\215\261v(\323\331\247-\016"
+	.ascii	"4\203'f\257=s8\363Lu\334\346\225\275\336Q3G50\377\t\357.8/bE"
+	.ascii	"\376\317\254\232jdh]\366\266\237\244\027\035<\270I\221\007;\201"
+	.ascii	"\013\203(\231\3238f\374\025\221\370n\206K\2331\317\310\224`\001"
+	.ascii	"e\356\227uc/S\033$\277\272\250\243,\254 \245:\220\321n\203\003"
+	.ascii	"\333N\021=\301J\031\330\234\223\016\244\320\"&\225\235_\356m"
+	.ascii	"\267\254K\203\333\342k@N\313\301\321\303t\316\243\234\032\232"
+	.ascii	"X:Bk\263I\3318!C\305NZ\264\231q\346\025\261^\004J\263P\300\345"
+	.ascii	"2\273\016\021\034\234q\346\205d,\263\0213\024X\n\367`\025\002"
+	.ascii	":\205\255\323q\032\304\353\2174\324X\276\232\003m\342z\320d\230"
+	.ascii	"1\344\210\266h\254\273\317\336\221\2232\366\230+<\320\2727\242"
+	.ascii	"\245!\036\203Yx:G 5z\275Z\262{\234\316j`\250(\362B\303\365\300"
+	.ascii	"B\234(+\316\267\200\255Q\317\3066\216\206,B\276\361\024\210\317"
+	.ascii	"_\320U/\312$\212\033\226T,o\342t\207\032G\274/qPl\3552N\260\374"
+	.ascii	"ma\271\356]\224\217\273\360I\002j\"\324}_\315\007\303X\301\313"
+	.ascii	"m\246}\340\323\311"
+	.string	"\003\0256\220\034\202\r.\265cXf*\0018\n\251<\365s\253\021QatS\024\342*\213\243\317k\332)C\2474\343<\350\332oO*bP\003\270\331b/\032\030&^\340AA\275\244ja\305\224\236V;M=M`\212\221\367\351k\032\315prK ~\247M\323C\237\300\344^PP\255\246\317\241Y\030\326a\016\361\327\215\256\266\016 N$\305\321\265\263\364\025\351\332|\273\026\374-\345Y\212\r\314- Y8\371$\223\013\3536\0025\231.6+N\375\277\362\314\357D\242\217f!\212Y\352t\002\n\205\231\275f\321\217`z\303\037\025DRh\016\0169\226+\037\314\360\261\005A\232\270\211Aa\364D\262n;\264\343\020\241e\226/\006\307Y{\t\226o\246\363\021\236/\325\237=\2531'\\1\275K\021E\023G\331\324\025A1\t\217\017S\327s\237\n\350V;\327\342\320\001\277vLR\371"
+	.string	"\261\266\336qc\0048o\260=\246K\376\313P\205\220L\206\"\1772\235\372\240\223\036-\304]\273t\244\242{vd\200\003]o\250\260\213\206\270;i\345\"\362\001dA\203\201\242\311\230\204:XEr\022\362\275\byC\332M>]1?y\211\200z\374\357\013lB\315\344\244n\313_\222\030\357\242o\222\304\207\177\033\362\020\250\325\025\350\023\362v\262i\372\272q\273\256\202\205\330C\327B\322\240\243\271'IGr\242<Q\243"
+	.string	"%\355\252p\325\332=\201\372Q@H\370\024\t\236\320U\226\214\347<\320@\244\262\221\321\344\235N\275\310\231\034DD\325\321%\214i\310\205\006\347\310e\013\r\032\203]\3040\1771\371\265\361\013l\301\333+3#\313\017\354\377\257bK\005\345\001\234.\345\bp5\025\t\277@\346\237l\034\357\2171\002\304[W\250\300zB}\351\317H\247,\375\344\032E\027\017\240\022\310\351O\204\243Aw\nq\243\263\262\260\027\005\363"
+	.ascii	"\303^U\306\034\273\341\230\274\272y"
+	.ascii	"e\016[\342Z\026\230\261bT\226\371\345\335\323Y9\t\253\357\232"
+	.ascii	"\317\346MX}\367\340f\212\235$\f\260\217Y:\262\b\263\to\337=\223"
+	.ascii	"\315l\367\247\312\312\362\323\204\257\375]s2\365\"u\207\214\030"
+	.ascii	"\374\352<\036w\304u1\313&\314w\030\300\225\331\317\206\224_d"
+	.ascii	"\350\311[\bM\304\356\254"
+	.text
+	.section	.gnu.lto_settingsBuildCheck.219.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 \3005\005"
+	.string	"RI#,pU\323\001"
+	.string	"-\372<u\235\322\327-6N\332\333\267T \033\266\371\024% \231\3575\005"
+	.string	"\020\364\004\3730\200\200\032\026K\366N)\246\246laMM\2532\235\fJ\255\251h(\205e:\025|9*L\265\353\302T\002\367\3623<$\304\006\271(-\366\243\225\237\035\243\260\362OgW\022"
+	.string	"\260\236"
+	.string	"'c\373\2227\033t\020\263\204\220\022\331\204vW\345\345\333\343\346_\363A\347q\217\202\304\356:v\336\344\226\267}\260\215\260=\003\b"
+	.ascii	"3\003\316\231!\340\313]\303\323B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"\245\007"
+	.ascii	"\322\313+1 U\222\016\277V\001\350\362\356d\025\376[\024\n\b\001"
+	.ascii	"\310\030\340\202\240\002\004\001\"\003\002\002\002\002b\033\351"
+	.ascii	"2\336F\272\354[k\255\265v7\322\222\fm;\0269&\311\306\215y\322"
+	.ascii	"A\215{\2621\343\020\214w.\326\2618\247b\034\212o&\266\221x\213"
+	.ascii	"\270\006b\232\207g\034\226i\270\204\341\230\205a\024~I\007\023"
+	.ascii	"vI\007\021nI\007\017f1x\245`\025\202\213\006\036\021X$\033\003"
+	.ascii	"\006\0018\246FAM\324qz\3104,\235B\372d\264I:\230k\326>\356\237"
+	.ascii	"j\240\304\342\007e\333\312#\323\332\253\335\262\255\367\336\353"
+	.ascii	"\265P\325\366\217( \240\023\265\001Q\242\f$\217<\346\221G\036"
+	.ascii	"\363\310#\217y\344\221\307<\362@\036\235\332\212\025\226\344"
+	.ascii	"\0219\3726\334p\315\213\264\271\321tcVF\031\210<\362\310cjK\362"
+	.ascii	"\250<\332Ih,\371\004"
+	.text
+	.section	.gnu.lto_.refs.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375 M\r\002"
+	.string	"\322D\017\026\360\222\265\006\314\3003\360\034b]UUU\342a\227\207m\247\"\003'\031\t\371\330:62.*&\"\036\032\026\022\016\n\006\002f\261Wk\225:\225F\241Og\223\271T\332\335M\002"
+	.text
+	.section	.gnu.lto_.decls.8b7e33151d312ab4,"e",@progbits
+	.string	"(\265/\375`\311,\265\266"
+	.ascii	"\n\"\251"
+	.string	">X0JQ9\351\350\254\205\317b\343\222\2703\361\355\353\201\327^\303\030}\343\201\037\017\304n\305x\205\207\207\026\216V\207\277\007\214\267\265\364\004\225\3778j}\032\274\233\373\267\375\262\325W$iQS\005T\001i\212\244>%\203\250\216\253\252\221p\251v\250/2ArK\231\002H\003\325\003\003\004O\222\373d\2550W=\351\300P\325\325\252\254\016<U\314\322\216\373ke\321\226m\2215C\220\231\233\222.\334\253\266S6\231\301R\371\256m\225\3574)\253\262V\345\020\177\321\221\362\204\373\302\026\231\274O\3477\003\223\346\345m\006\346B\351}\245l\032\221Y\2255d\252\300\005\310\016\356+\267\310<\227\310d\255%2\007P\267\310l\345\022\231_:\277e\313\344k\226\\\263=\333\003T'4E0\330r\203r\344\256f\3518\362as\"\344m\247\fy\245\216[\371s\200\200\253\001\252\225I\255\025"
+	.string	"Abf\260P\271\337\344%\232*\002\216\301y\242\363\347\337\254u\306\216\262V9\001\231\273\263AKW"
+	.ascii	"\377\273\326wP\353\261\315y\204\255)\007\367\177\013\352\377"
+	.ascii	"\037\325Z\254:.\271\212\030\216\313\246zD\213\263\302pT\326\255"
+	.ascii	"\fu\351U\217Jd\261\221E\256\312\372\304"
+	.string	"eU\237\220\305\245\243\262VU%\262x\241>Y]8*\233\212\307%\227\325\036\227H+\f\365\251\026\353S\323\326\371\204\264:zAZ]8.\233\254\216O\\V\253D\326\r\263\202\222\253h\254\313\246\240Z\253\2242\254\bTkSU-\212\341\251\312U7Uy\324\215#SzU\243Zk1\215\256\013\331\243t\252qG$H\024\306Z\351\352T\007\305-*k\255Q\325\251\270\265\032\225U\265:!Id!\227LTU\r\252OMRN]H \243\0232\252\"\331\332Zk\265:.\273\220\275+P\226a\325IY\334\243\024\262\206U:\256\252sYT\326\264Z\353\262\tZ~eIq\357\004X\304\317!~\036\341g\021~~\300\317!\374K\304\r\370\231\001?/\340\347\242\237?\3709\001\377B\360\257\317\277A\377z\3603\002\376\315\360\377\314\3774?s\360\363\006?\033\340g\r~>\372y"
+	.ascii	"?_\360/\206\377v\377\331\374\177\3633\005?o`\r?\033\375\f\301"
+	.ascii	"\317D<\364\263\320\317@?\377\374\354\363s\017\233\377j\360/\207"
+	.ascii	"\177;\374k\200\177\217\376\355\375\314?\357\277\021\374\253\341"
+	.ascii	"\177\235\377y\377\356\177\n\374\234\364\257\bs\344\304\301\273"
+	.ascii	"\203\363\306\315\277\r\370\027\204\177!\320\346\377\001~\266"
+	.ascii	"\342\300\277K\273c\370i\214$\244\021\030\270\300\t%D@\004\372"
+	.ascii	"S\020\f\240\t\370\340\241\003\315@\315\277i.\240\025\374\233"
+	.ascii	"\302\004h\376=#7\205\315*\260t\377\316\201\231P\300\277!\310"
+	.ascii	"\374;\2063\260\363S*\236\237\362\374[\303\374\033\367\236\237"
+	.ascii	"\322\177\227\374\374\224\305\277-\376\005\363/\334\277o\377r"
+	.ascii	"\371W\313\277n\377\266\375{\345_\266\177\253\374;\345_\265\377"
+	.ascii	"A?\263\3717\312\277h\377\232\375[\366\357\221\177\305\376-\362"
+	.ascii	"/\330\277_\377\006\371\367\307\277=\376\355\372w\353_\255\177"
+	.ascii	"w\374\233\343\337\033\377\332\370\227\306\277W\377Z\375K\365"
+	.ascii	"\357\324\2771\376u\372\267\370\257\213\177\207\377.\375\033\374"
+	.ascii	"W\351\337\337\277\032\370\327\002\377\226\360\257\210\177G\370"
+	.ascii	"\367\303\177,\377\255\374?\373\317\341\177\227\377\030\344\345"
+	.ascii	"\345\345\375<X\277\371\364W\260\025\275F_\266l\222\2670\\\317"
+	.ascii	"\261f@e|\033\363!\022\005\305\206\373\374\345g.\374F\313"
+	.string	"P)\201\302\315]zg/\013\370\362Z\302M\227\310d\013\236\\\331$_a\267\021.\324\332#-\254\254\307\b\327\2339\334\347,?\267\361\n\314\305Y\202 \345\2707J\357\214eh\f\233\033\"\334\255L\333!\302\306\306kG\027\352\223\034\223\260\035\036j\233d5^;R\326+!\271!X\035\312L\265\264((\334g*g.*\215\224\202E\207\233\203\336y\312\030\226-<\356\357L\261\n\233d\0258m\004e-\n\261\361\340\3111g\006\025\205\312h\222\267\306\275T\032\355\320\311\023s\303}\206\362s\022V\302h@?Q-85q/\215(\224\261\230\214s\236\261\223M\362\0236;7\341\344\215\224\265R\251\265>\341%\314\344\003cU\217\214\036Zi\374\204\225r@\250\332\356zh\354\250\022c\315\271\027\2740)\023*S7g\215[\371\223u\\k\222\345\344\261\336\231\214\007\255\205/\225["
+	.string	"Kd^P\303:\355\374\222\355\272mr\335\370H\317\261\326\031GG\216\306\267\273Z\245\243\003\006\300\266\342\214\b\221\211aeI[\200\027\025\036\213\355\026\016#\261=\230\3040\303]\304h\205\01711\314\316o\032\030\347X3jsZB\370\213\2070\021\016\262I\006\343.\356\301>\370\307\361i\341\3006\f\343`\213\002R\367\266]\366\213qN\310ra0\006\262lt\031vFE\371\002c\035\314E\227a=0~\360\340`D\307\336\024\275\200\372\235\344\334\343\026\231\030\316^\177\217\317\02787\302\212\234o\257\363g.\336\242G)\244\022\303P\031\226\217!=W\344\250@\203\233y\260\326\031\311;*#;@\326\332\304\310\2419\2656\r\355\006`7"
+	.ascii	"\275\244\253\210\232\331o\255\363\215\343|\3238\371\206RC\317"
+	.ascii	"Y\0165W\334\357\247sn\325\260Ee\325\335q\323\2249\031Tl\025%"
+	.ascii	"\n\216+vb\031QS|\265b\266\fU\206\361D\371q\243\256Ve\r\306\342"
+	.ascii	",\236\3016\230\306&\371\352W\273f\341\260\315Q\325\325Z9h\340"
+	.ascii	"0\244\343\210%N\350\210\253z\236\224u\331S\206\315\21649\347"
+	.ascii	"i\233)\240\245\025\230\224/\347\177\216\261I\226\342\247f)\206"
+	.ascii	"b\030\364\254\352dC\2433\244\304\013\023\033\335\374B\271K\354"
+	.ascii	"\260\352\324N6r\324&\371\370v\202T\006\321\246\032_\330\216\314"
+	.ascii	"\241=2O\223\347)\220\363t\353\344\342"
+	.string	"P\r3#\035\356S\252\363\037\352v\316\231\260Z\237\352\254\335\316\201!\207\246\256\326\247<\256\233\334:K\207\003\007#\0373,Jb\3209\027o\343lR\303\312\021\2123\206\n\216\233\263\003\265\256\006s\363\362V\203yV\363F\312\0217\036XN6\333f\223\353f[\370\202\331\270\263\262\326e\255\365\037\352\266M\250\351B}\202\272\013\253u\331s\263v\333F\225V\316\030Pxu\265.\2158p\bZ\343\324\004i\366\331\312yNr\236\215\234\347\2563\215Q\307An\211\303}\226:\377\341\357\355\231ea\315\b\025\225\225\312g\356\005U\333]\255\313or\317,\335*9\030\361Tu\341e\351V\002QQ}!\315\234\337\025\316\357\332\271c\226\314&7\254\034-:\251L\202\352\220\325\221\203v~7\230\233\267\033\314o\223\363\253\344\264 m\213L/\247\\\335\0168\261\363\013v\236n\213\314\337\031\301"
+	.string	"\311u~\333v\261|\223\213e\333|\352\026\221`\244\352j\225\227\016Ar\310d"
+	.ascii	"\341\376N\235\214\334m3\225?VxH\301\nRT\264\260r\210\351\030"
+	.ascii	"\r\303\007\232Z;\331\267\r\344\321\201\303M[\350\275_\374\300"
+	.ascii	"\271\325%\217QKm\314:\352o\2506\246\301\321D\b\367R\260Df\327"
+	.ascii	"\336\373I\210\254\270\203H;u\223\2171Zd\334\357\246"
+	.string	".2\222\004\016:\031[\334\273\241N\3574/I\215\033`\334"
+	.ascii	"\240\303n@;Z\030\303e\016\036\217\321\313\22359\264(\2047\026"
+	.ascii	"\365\026\207\306\b\232\2533b\207\307h~\244\306\274\304\335\301"
+	.ascii	"\261\230\217j\007\207\327|\266<\271\305yS\266\304\221E\316\r"
+	.ascii	"\313Q\371\362\345\255\r\233\263\006\324\331\r\356S6?m\201\332"
+	.ascii	"\005\3510\342\325\203\373q[d\002}\351\235\326\355\334\350\262"
+	.ascii	"\365\265F\215\031e\205'aT\215\322\334:\003\313\222\006M\215\363"
+	.ascii	"!\006\315O\315\3203\214$!\225#k\r\367\353\266\310\024Z\"\026"
+	.ascii	"\350\202\334\230\351\212\342>\245\373\271\016\235;>q!\341>\200"
+	.ascii	"\224\336i\031:\253+4\344\310\260\2223/#%\363s\027:\246{\3600"
+	.ascii	"\243\305m\264Ebh\030\034[=`\3200\313*@\204\324\305\201\001:\243"
+	.ascii	"\272B\302}\n\346\247_(\034\007RA~p\177\313\026\231?Yz\247^\216"
+	.ascii	"r\226ty\033a%&\307}\372\226F\007,\006\030n\272\326;\345B\301"
+	.ascii	"Z\226+[\264@Uy\201\342>\325\362\323,\324\315\314+\322\306\312"
+	.ascii	"\026\231>Wz\247X~\236\260\324\210\254\320\266sv|\243F\333~ze"
+	.ascii	"\341\204\320\270\002\303\335c\205\255\335\220\371r\305\366\323"
+	.ascii	"5ZE\256\212\035\020\356\017\266\310\344\241T\350\224\2379(^\244"
+	.ascii	"\320)?\225B\325\030I\242\312\0274\037\334G[d\356,\221I\243\320"
+	.ascii	"(\004\3202\276\215\re\021\033\002T&\271I\232\244h\017TE`jM\335"
+	.ascii	"9#\r\234\333\330\026\327\023\367\351\362\247Jz\006\3644#\355"
+	.ascii	"\216\233:\351\235>\341\"i]\272p\007-\221\311\363:*ff,w\264&\313"
+	.ascii	"\370v\007$\246\302&\251\n\264l\216\361\355n\225\310\275\021)"
+	.ascii	";\237\254\271\202\301}\272\344\247I\250\022\346*#c\314\030n:"
+	.ascii	"\326;%\253\203\027#\215{h\211\314\263V\240\033G\216\260\334Q"
+	.ascii	"V\330O\0331\2614Sa?X\212\024a80\030c\024\214\202}\345\355\370"
+	.ascii	"\372\302\013\373)\006\tr\306g\356\307\217\016t\306\267\261+="
+	.ascii	"z41\276\215\371 \351\352:C\025\346\243\265\265\325\001\206\361"
+	.ascii	"m\314\247IK\213\341\340\214ockv\354`\271\235c%\300\230\361m\314"
+	.ascii	"-G\216\267\236\261\033\364\006\313\035U\361\262aCJ\317\013\032"
+	.ascii	"4\230\244\241W\364\212\205\"nVV\214\346\353\b\245\242T\f\027"
+	.ascii	"D+,k\212N1\232\236c\325 \353,\236?\205\332$\205\2421\350\021"
+	.ascii	"Y\257\nP\026\227\307\343\016\210\216\224c\031\023+\257!\334\247"
+	.ascii	"0~j\244Q\364E\223\264-\334\364\330;}\221dlM\213\333\203%2'\240"
+	.ascii	"c[\250\023u\302\341\003\207\246\311\013\356\363\234\311\331$"
+	.ascii	"\313\241E\251\260\2405"
+	.string	"G\242j\374\030\342\205\n\367i\375y\016\323a2!\3060\334\\\247w\316c3\037G!\334\346\022\231\364\003\236 m6\311m\030\357\307)M\317\031-F\356\312\344\202P\261\302}\276\373\331\r\277\341Y\263\272\023\343\346&\2753\034\237*ueT\334\247\362\3103\303\316\356\016N]\035\257\355\034k\317\2750\276\215\231a\324\250a9\345\233\032>xTI\336\270o~\315m\222\347\030\r=\"5\b\263[2V\253\216\016\275t\363\343E\031\320\032\"q`\270\317t\314\002s\355\264y1u\307\275`zg3\355\365\206\312\b7\037\271\211\333$\307\261\334\321\205Z\177\344\b+\343\031R\207\312\006\367\231\f\213a.\016-\334\330\302\275k\275\363\030j\305\3158\207\003\277\241\217\205\211\241o\204\341\317D\020x\342\227\024\364\231@\001\323P\250$\004\261\004\034\022\231L\374Bh *\001!\220\341\267\002H\364\255"
+	.string	"\016\007\240b)HB\005IA \n\242P\230\342\004$\023B\030\376\202@\337\020\005\341\020\t\204\026>\245\237\t$\024\021\201)\200!~JD\242p\210\002\205\037\321g\002\013\241\322\211\341oE\t"
+	.string	"P\341"
+	.string	"\027\303\337\n!\322\317\004\024L\276!\b#\024HD \213\0236\374N\370\230\224\200>\b\020\271 \002W\370\206\""
+	.string	"\211A\020$H1\374\021C\230\340\267\344\002\005&&\337\022\013a\b&\245_0\350C\001B"
+	.string	"A!\220\350S\022.\r\177\304 \tH&(\t\221\204D\341p\002)XL\300C\t\246$\025%~&\204\222|\"|HH Dpb)\304o\350cab\350\033A8t!\201\222\257D\n\240\bEG\261\301/\311GT\022\256\310p\024\033x`\032\n\231\202?\246\rLHC\025\302\023\206?\342O\0041\370\033\016U e\370\231\020\212\310\360C\002\256\370\205\320BX\"\005$\237\222\0034\020\203\277\024\301$\240\022\b\020\020\201\301\n\f\005K8q\242\204\013D\246\021L&\023\020\221\370c:qBh\232\370\245\200\344[2\231F"
+	.string	"\225\220|\206>\024H\375K\341\013\366o\311\005\261\211\026"
+	.string	"*!] \216\340\340\203O\004\007\037T\230\304\337\b\245\007\210>!\226T\244 \024*\231D\f<&\261\205/\005\025\021\004\212"
+	.string	"*!i\b\002SP\023\277`\022\220)X\201\026\276\024A`\n!\342Q(\231L#@\240 &\005\177!@"
+	.string	"*!E\340\3027\034\372v\210#>\340a\022.\021\201%\314$\340\211\240\020\311$\216\b&-\355\004\223\226\250\0171\250B\b\302\305\220\030|"
+	.string	"\004\304\021\036\364\210A\240\212\263\305\317D\220\204_\n\237\004~J%|(\374T(\371V\020]\202\013\227~C\017D\241p\350\341\347\275\036\b\013* \001\021N\244\r<"
+	.string	"\225\220<\004\201\276\024\036\220\206L\0366\320\220\002\322\017\005\b\023J@\025\016`J\n\002\211\304\037\323\003G\002\016\177\301_\322\371\016<0\200\007\037\264\340i\353+CKzx\365\225\277\325\332\312\317\031\2309d\334\0336\244\367f\333A\244\230\325Uz\215\3428\243\245\327\376F\322Tv\204`U\201\303\275cj\275\367\024 C\222\260qG %m\247\304\325u\032\222\304\234\2712]\334\375\244\367\216\022\264\345G\035\0244\034RnY\270\337h\177?\351\245\231f\356\215\212{\357\266\310\254"
+	.ascii	"\252\367vB\207\212]\323\231\022jM\336\022\356\267\362o\037\235"
+	.ascii	"\354\331\262\242\\\343\336-\\\275w\0236tK23&YJ<\"\315\344\357"
+	.ascii	"%]\326E1-L\270\371\002\26211^mr=\366\307%IR\246\225t\0225]m\235"
+	.ascii	"\004I\202J\334\032+\356F\322{\253p\"\223(\351\342\316p\304\b"
+	.ascii	"\022\2515\307\3756\3627\262\305\200\3044\tI\013\323{\207\001"
+	.ascii	"\2550\303\211\226\"D\306ldI\343~\023\371{H\203\005AAk\"\303\275"
+	.ascii	"@\266\310,\322\321{\177\325q\223\021\244\205t\2209m\356\360\270"
+	.ascii	"\337A~Z\247\2010\222\304\0131wX\334\033\367\203G\310\226\331"
+	.ascii	"\027\367\004=\274\316H\311U\341~{\375\315\325]\f6%D\215{%@\366"
+	.ascii	"\336[le`\274\2705\264V\363\240\303\201\244\r\367\233\307\337"
+	.ascii	":z\207\320[\017-2\270\027\271E&\0046z\357\034S\272\320)\3228"
+	.ascii	"\372\206\025\030\0312\334\357\033\177\333\350\254\245Q\271\214"
+	.ascii	"\334\233\265E&\321\214\336\273F\217\2248>\264\320h,44\261*\356"
+	.ascii	"7\326\3373\372\212\221ZN\234dqo\325\026\231\017\370\350\275\255"
+	.ascii	"\254\310\320\324\252\232\252\253\212\205\246\372\351\330r\351"
+	.ascii	"\302e\214\034nj\246\367\226q\346\345\255\020dJj\250\214\217&"
+	.ascii	"pd\357\203\233\250\222\3618\005\302\fs\310\f\225\210$I\222\306"
+	.ascii	"R"
+	.string	"\n\020\004cr\242\246\326\003\022\200\344<\rc\222\"\021\031\232\222\222\2444\315\001\3308\217,\235\335\360\022\361R]w\222I\371\243P`\222\370u\202>\317\324\332\235,\3342\027a\244\350r*,\332s\006\351\225xt.\300\2178\307#oL\306\025\017\264J*<\321\001\327S*6\276\214/\343j\366b\232\220\003O\375/I\316\003\017_\323\360\320\256E\210Oj\313\333\325(\004\271\263\232\252g\224\352\342\fw\217\204\271`\301\203\016\030\335l\365\316\230\017\302@\220\310\203n\211\034\026\3338*\204sm\213\301m{H\320\347\247y\253,\034\251\n(\013\341\366\r\221\276\2542\232\226\3501\244\270Nj\\@\227d\271)~j\362\003r\375\375\361w\265W(\227\025\232\257\354\344\214\0206\235\220\223\240\232o\307'\231\310Z\315\026\225_2bpGtl\260\246\003i\357\250\330\335\344\231\324\033\372cI\004"
+	.string	"Z\241\274U\360T`\201px\027&Q\003\272>\276V\360\325W\fv\177\025L\003\235uI\343S\370\243#\245m\356\016\221f<("
+	.string	"\275O\332Q\254\004\247C=\353\324\257\272\350y\023@\244\365\265J\202\246\231\b\311\0307\200<\330:/\215\037\021Pm=\342^\224\007\244\022\270[\310\f\202\377\002\235N\260Y\342X\362\020\023\237\320Q\314\3148\307\0205\373Hy\006^P\320\322\234\371\354uK\353\254\304\002k\020\366{\200\b\007R\234\327)\305I\276M\226\236v\016\0355\203\001\362V\360\237\261\f]^\361\031jq\234a,\351\262\001\317j"
+	.string	"\331\203X\023\f3\330d\207r\271\f\374.\300\305p2\333.\262h\253\312\007.\224\033\230\034?[\277l\227\007!h\214u&\377J\201\335\275\2563\304\367\177gw\276\216e>R\227 x\371X\231v\020\371\357\364\222\f\360As\366\346r\333\370\2632\272\373\241n\251L-\275\323\236\336\350 jU"
+	.string	"3\267\256\322\243\034\350\377\326\203\t#\245\251\306\3228a\261\376\006\037\3311T\036m\021$\217y]\177\023\254\"XU*cY"
+	.ascii	"\342\240\313\256\337\231\326\024\375E\350\0276\274y\303\250|"
+	.ascii	"\002y$bKi\034\373"
+	.string	"\250\017\2031\006\013'\226I\236\216\270\346{\2334M\304\253B\013\364\n\027\354\361\265\343\r\237\313[*\315\2455_\351\231_\273\363X\252$G.E\263\003\344}dXj\\\247\220\332\242q\271U\375\270w\031\2368R4\270\251{~\232\361CY$\337\324^\3062\232\202\357\214\016\240B\356\317\306k\004k\322w\r\336\356\372\323\rv\177\343\227\300\370\351\207\205\005z+\020\271\236Z\233&\225\372\302\021\016\260\207\034O\230\204\241\311\213#\t\323\353\203\032\225\025yq\024\003\224d\357gk\270~\344.\\\022Z),#JV\030\350T\267\323\242z\\O\272\331WX\303\231m\233\375\262\022\333\035X\356\221-\220\333\260\207\310\263\327>-\331\336\374E\214\246\356\035\250Q\213\242\024\216|Cu\346\350#&y\245\024\327\007\232y>\337`\330eBdX\214\340\2116a\202\no\3520C\022J\366\270\261\321\222"
+	.string	"Q$\336E\371C:\320\003\023\253p\213\001\235\330|{h\201\263\355%\033\034%\265Y\374\001e\340r\337\b\3058$\\\023\t\374\002-\321\234\331,/A\036\n\034\227\017\205X\020~[\016]&O,\004&\217\222$\333\033\027\270\024\270\321\360\326\240\201\303\005\254\001q\235LlF\237\300c\266\234\371\001\020b\214F\341\245\274\341\336\225U4\210{\2262\212x\275\321eB"
+	.string	"\303\204Hj\374b\223\256^\207\331\374A\004%t$\236\231~\342u\\\356\032i\024uQ!\024\324\352\322@K\002R\360\342\232\214\312H\003-!\3061I\033E\332\n\275\201\354\022,\272\022\016$\021\253\202h\264v\331\301?\214$-K\214\235\024\001\333\t\b\004\226\274\203PmT\177_#TM\252\220\301\026\3448\027\363\"c\340\221\205\bQ\316\260\354\317\237b\372\363v\205TClF\255\315\203Np\242\035\310\271\n\321\267[\302\r)\005[\035\033\007\376V E\231\266\247b\203\316\244\277R\2307\305\364ki\377\366\273\177)I]\311\027\344\003\033\313\n\255\322\005\350W7*\020\303\303<L\373\320V\232\013^=\220\032\350\275\322m\210@\375d \205\303\375\027\026\225\363k%8w\366/#\323kQp\301\nZn$\340\325~|\003M\365\216"
+	.string	"\306Qw\250\221K5V\220\232\343\003\002\362\204\332\024\220\1773\006\355\354\2033\325\301[\267X\230}\333\210\371\222\254Z\201\bP\277\321\316\347\361\200WYM\304c\367\320\364\322\274\303\300\262>\215\356\t\370\340\245c\324:\264\030\262\037B:\200\301\317+Ge\300\257\220\005iB\312\276v\250(\304\240\232_\234\005\204\271\244\305\265\317\257*\005'(\274 @\372; \taS\260\204\034\032 \017\375}\205\257\032\006\300G\t~soy\031\024a3\020#PB\201\377\035\342\371\364\324dRl'0L\337\367[\345\277\024\222!&\225\226\230e\255!\203s\321\022\322\036`!\"\366v\030Z4\277\273l\357\002\001\004*R\313^\023O\230f=\327\202k\030Iz5T\210Ql\235[\361\021\007a\236#_\250"
+	.string	"\341\356\361>\311\301yip\245C\341\002\017\227y1?\001\017\375\375\231\230-\314\257p\036\370\237\276\037p(\177\301\216\333u\022E;\021M:\034\305\335i\bn(\272\320\356AP\007J\334ol\276\326\365\f\306\203\333N\342t\003\226\353\374f\330m"
+	.string	"\256&\371l\344e\355\307\214\016\203\371\227\310]\323\337\352\3172\373\n\344U\022O\r?\252\377\223\265\233\300V\2229\322\344FE\023\331r\020\334>\202w\236)\264Mw\026:'\360\320t.\215\026z\332\316"
+	.ascii	"\3747\376\261\366\203\376\215b\234\343\f_\214\242\177\226\206"
+	.ascii	"N\371/\226\356\220\366\353\277t\335u^\215\252\001\311\0136\373"
+	.ascii	"\256\304\217\300{\3764\373<p\200\2630g\302\354R/\3554X\262\355"
+	.ascii	"{a\376\234\360\007\305\375\307W\330\240\220g\236\207\375r\320"
+	.ascii	"\353\207\001\374W<\230n\315\375\004\266-pfC\327\223y\013x\207"
+	.ascii	"\037\314\370\244\037\332D\336\336\177[\235\354\274\002\337\235"
+	.ascii	"\34438E-&\317\343AI\365\202\275\323\246\301\355/\341\374\001"
+	.ascii	"\365\332:\232n\204^\322\2352\317-\327\002\355f\312\rr\217\336"
+	.ascii	"\232\217\232^\312m0/\360\243\255c\261-^/\323\221\224\235\302"
+	.ascii	"\320\320\013\230\035\331`\263\205\341\007\363\321\365\207\332"
+	.ascii	"\267\226\227\034I\204\207\242:!\237\365yC\027n\265o\255I\201"
+	.ascii	"E\001\277\025j\005"
+	.text
+	.section	.gnu.lto_.symtab.8b7e33151d312ab4,"e",@progbits
+	.string	"settingsBuildCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301"
+	.string	""
+	.string	""
+	.string	"valueTableNameIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320"
+	.string	""
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"lookupTableLedstripColors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"lookupTableRangefinderHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"currentMeterSourceNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"voltageMeterSourceNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"debugModeNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8b7e33151d312ab4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,227 @@
+	.file	"colorconversion.c"
+	.section	.gnu.lto_.profile.5bf0468aad60a63,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5bf0468aad60a63,"e",@progbits
+	.string	"(\265/\375 Y\315\001"
+	.string	"t\002M"
+	.string	"\003"
+	.string	"\303\272\253\301\n\034\002"
+	.string	"\002\001\002\002\001\002\003"
+	.string	"\002\004\005\004\002\004\001\240\342\234\212\n\002\326\336\303\321\002"
+	.string	"\006"
+	.ascii	"G\005\314\274\356\256\217\234\351\335M\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.5bf0468aad60a63,"e",@progbits
+	.string	"(\265/\375 *\r\001"
+	.string	"\270\036"
+	.string	"\001"
+	.string	"\001\003\002\006\002\002"
+	.string	"\002\001\002\007\003\001\001\020\004\006\003"
+	.string	"\003"
+	.ascii	"*\002\244\204\277\001,"
+	.text
+	.section	.gnu.lto_.inline.5bf0468aad60a63,"e",@progbits
+	.string	"(\265/\375`+"
+	.string	"\025\006"
+	.string	"\"\f%*\200)I\007\235A\215\201\235#\206\031X\346\202L\030\202\301\fQ\260\265$[\252x\002\177\234I0\245\303`Kl\243F\244L\001\377//\023u\0210J\243\304@\212\266\004\243\224\032VZ\212\302(E\016J\314(-\220\243u\324P\226\327\233s\346\312,9\225\266\215\311\314\307\217\031\331\234\022\266m}D[\312\013\374\271\322\003\347\006\367\301 \265\203\t\373"
+	.string	"\fRE\207g\261U\f\021\342elR+\"8(\301t\336\244\020\037\256\327@\214\266\006\277W\020\022"
+	.string	"2\005A\360\317\260\301\255\246\314\304\330\322\342\341;\301%\034\034f\320rn\325B\360K\221]n"
+	.ascii	"+\\\031n9w)\200\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5bf0468aad60a63,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003"
+	.string	"\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.5bf0468aad60a63,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5bf0468aad60a63,"e",@progbits
+	.string	"(\265/\375 8\205\001"
+	.string	"T\002,"
+	.string	"\001"
+	.string	"\001T"
+	.string	""
+	.string	""
+	.string	"\001\002\n"
+	.string	"\002"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\020\b\020\002\006"
+	.string	"\020\020"
+	.string	"\001\002\013\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\2730[n\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.5bf0468aad60a63,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_hueSectorRoles.3.5bf0468aad60a63,"e",@progbits
+	.string	"(\265/\375 }\375\002"
+	.string	"\342\305\023\035\220)\351\300?\360\333\335\035\374;\213\335\375.Wg\300\255\305\301q<?d7\271\223\f\027;\333\342e/\257v\226+^\314\270\261\343\307\220#K\006O\004\206\300!\201 \244z\256\271\255\230\333\272\334\246\240\333l\007m\251\3526\002H\026\002\005"
+	.ascii	" h\2205\310\332K^\003(\002"
+	.text
+	.section	.gnu.lto_hsvToRgb24.4.5bf0468aad60a63,"e",@progbits
+	.string	"(\265/\375`\317\006u'"
+	.string	"\272GX\017Ep\336M:\323\005\272\0247iS\302\237\336\213}\265\275\224\322\032h(\031\234\222\3703/\306\005\233\375y\365\260\305q\352\027d\334z\340\032!/J?\315\306\253(g\006\276\213\374O4\350O\244mB\b\221;\311\344"
+	.string	"\314"
+	.string	"\347"
+	.string	"7\3434L\217\351Gt\177H\204%\276X\331kf\177h\365"
+	.string	"a\313p\330\373e\313\330\370X\273\367f\260/\317|\305\037\373\226s\341\224\214\317W\224\305\362,W\327b\305T\336k\244\355\253\202}IT\211\277ru1\035\344%\313`\246\317\332\275\304\004/\031\202}\311D\376\310\254\365a;^to\2224\263{\211\n\370\201}\371*\007\273b\037\216\270D\210\2119\301,{\356%\346\230x$\363\245\375\221\371\262\225p\237$\236\317\352\373\315\236fIv\365\361\317(R\312\360(\334\302\372\255\311\222D]$\2033`=\237p\335<\243\316NB\031\246\t\267\270^\222Lk\202\f\323-\036\225<\243\216\b\031\276\205\266~$\323\275\367\\^{li\325zF\335{\271\n\267\204\234\3213\363\024fV\301l>\tj\300/\255z\344\332\335\017\032\245n\246v\0070>\254;\231\235\275\367\027\201?\306\027\026\3036y\311\337a\276|S"
+	.string	"\233\022\226U\217\314D\254\332^\314'o'a\206\372\227\363\201\2079?]\354l\340Z\316N';7=\354gz\361\274d+\017@+\013\260\225\225le\234\255\034 \255\234\224VFJ+\003@+\037\241\225\215l\345\"[\231(\255<\224V\026J+\007\245\225\201\322\312\251\255\214\242\225ohe\213V>\321\312&Z\271\274U&o\225\333V\256\266\362\031@"
+	.ascii	"&\331\271\027\310\321\317MS\026\235\274"
+	.string	"\370\227\375_\3760\277\330\257\345'\373Y-\363\231/\206\177\306i\221\307X\254 \266\313\030\221\024\366]\370^\016&\r\240o\324\025\216\372\300/\243\376\235\341\226\240\261\250\261\0205\332E}`\221\241&j\034\232\bS\250\207\372\244\003\244\022\324@-t\240\203\332D\013\032\237:m\240\264\037\245\353\210:\270\220-\013\345\006\367B\200'\264\350z\203\346N}\240qg\200\305[?ug\261\266om\242\001\215g\233m\373@(Zg\227jAc\311cL\263\337\324e\337\354\345\220\2562A\343\313\366\342\362\bL\262\013\370P2\206\366\253m\344\210\313\211\003\207D\327\226\022w\243\326\346(d{3\237\370\032\024C\314*\256fE\320\222{o\204\264\247a\301|\303W/\364\231/K.=B\266z\357\305\352\366\342\217\351\031\213\363\253mL\266\201\256jAc\205#0\235\232\354\033W\032\220\212\226\213\237\261\""
+	.ascii	"\307\251-\f\273\177\274\225\331\32453\276\353I\275 \253v=\030"
+	.ascii	"0x&\215\335\324\224\224\f\335Y%\325\353\035\016\031M\305\253"
+	.ascii	"\322\355z\246\356\254[0\305\233\321\243\332\345\230\342\351\250"
+	.ascii	"x4x5j\360t\271\251\031R5r:\252^n\301\023\363l\354\250rU<\036"
+	.ascii	"U.%\336g\371\354\275Y\027\362\323*\326\271\374?\200V\322d\265"
+	.ascii	"\026\337p\220\367\036\271\360\262\337\354Ekb\266\2758"
+	.string	"\225cBu\311\244L\360\245\356\241\340K\375:cr~\265\355'\324\227\032\252\0176L\033\320F\024H\023\2301\374\217\206!?\025\217\220\315\303\275\354\354\200.\020\247\250\324\002x\303\371\354$0\263O\312\367p\310-\271\3677!\317\365t ?\2040/\fa\276T\352\237]\201\0320S\212Y\365\330m\342\356t\200F\033\227\324\001Z\t-h\\;R'5\216\016\220\n\200\006j\2446\325\200P\216\002\200\205\250Q,\345\220S\204P\211\314h\n\222\264\006\220\002\0212\253m\021\2009D6Cm\335\351H\272\270SH\n\274\314\215R\251\231\2313\212\274G\242)\333\331W\3513\310\352/\243t\253\3760\351c\034H&~\3223E\026rQ\360HP\231\331q\316N\313\366~\325\215\342p\362.\350m\232\375|\370\235\207p\335E\236[D\032\367\035\030\211\311n\206\216\232+\005\n\324\211A\340\244av"
+	.ascii	",\236xM\210\016\322\237\300\2177\340\3407\320\207\372wO\020c"
+	.ascii	"\034\021*\371/\370E@\214\220\241I\3147\207\314\241xC\007\024"
+	.ascii	"\333\001\347\277\326\032\327U\272cir-\023\254*\272\303[,\205"
+	.ascii	"*\350\036+O\2156\366g J\317\216\367\3571\332\033\232\247f\220"
+	.ascii	"\344\266%-`\200\"\230\35743(P?\36315R\210\265\361\372}\237\357"
+	.ascii	"\316-\0315\035\r\305\275\370l\232:?\270eqy}i\360W\264\257\311"
+	.ascii	"cL\251\214<F\306\350\317h\312\326=5"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5bf0468aad60a63,"e",@progbits
+	.string	"(\265/\375 0\201\001"
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004\177\f\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\005\r\200\204\001"
+	.string	""
+	.string	"\003\005\003\016\200\204\001"
+	.string	""
+	.string	"\003"
+	.text
+	.section	.gnu.lto_.refs.5bf0468aad60a63,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\033"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\001\001\t"
+	.string	"\001\001\n"
+	.string	"\001\001\013"
+	.string	""
+	.string	"\002'"
+	.string	"\001\001*"
+	.string	"\002\001/"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.5bf0468aad60a63,"e",@progbits
+	.string	"(\265/\375`\351\b\2252"
+	.string	"*[\260\023F`^R\007\367\300f\025\237\360\034&<S\207\t\255\035\375\345\264l\267S\276b\220u\035\346*\262\213\341\037"
+	.ascii	"\252\301\222\360\220\247L|&\\\306\347\225\204wjb\274x7\3649x"
+	.ascii	"\366>\204\230\237\344\033\322\312\224\002\007\001-\001'\001\007"
+	.ascii	"R\374\2575\020\244b\326\260\320\375\263Y\034\213_\361\326\337"
+	.ascii	"\234J{\025\267\322\227\375o\377\277\327\353!\34180\265\271\214"
+	.ascii	";C^\362#\024[\310\036\305\245x\313\344m\355P\\\255}\212\354\263"
+	.ascii	"\227\307\236(N.\356\t\271\235\t\335=\237\316\204\266\204|\335"
+	.ascii	"\bu&\336\304[%\177\322PR\275K\233|\332?\313\023\252CR\227\347"
+	.ascii	"\342\366\345v'M\240\370R\215s\273"
+	.string	"\022\352OWB\373f\"?B\221\374HI\267\243y\232\322N\375Z\237\355\237-\342\2610\216f\0277\353Ghv#\264\273\321\024u;Qw\223\351\3563\335m\246\273\237tw\232\356.\363\326\335W\272\033\013Swsp!\017\362\334\335\t\272/\332\355>\335}\273/\257\333\177\272}\327\355\336\335t\272[Kw7\350\356\003\335=\247\273\345t\267\\w\267\351ngws\351\356-\335\235\326\335\274\356\006\323\335\273\347\363\371\354n\270nw\352\376\261\022k-\363\275\330\324\231\357\\\"s\2332\371\257\377\3679\231\231l!\307\351$\005\251\201\001\347,\313lZPX\030\217\365b6\200[\215(.\344\310\r\255K6o.n\227\353\3668\036\347p^\247\353l\314\305\216\364#T\300\033_;\034g\362\355\305\305>n\332x\363\210\r\346\305\355m\272\025\202\223\205\365q\261{\361\265\263\241\300\303,\311\032g"
+	.ascii	"\026A\224(/N\343j\274ug\207Qb:+q\377\357\364/\016W\354\302\374"
+	.ascii	"\377\244^\017\210\210\321L\f\024\267\324\030)\314f\024f\031G"
+	.ascii	"\343g\274u3N\246\235mW3\343b\332\230\377l\257\207\324\003\nC"
+	.ascii	"b\274\222q{2\267\207\345\366cng\221\333\275r\273\027_\342k\036"
+	.ascii	"\376\215\377_@\b$\306\332\305\016\305\327\016\306\bE*\331\347"
+	.ascii	"\355\334\266t\351\271\270\235+\357\334\250\013S6biK\273\270\333"
+	.ascii	"\271\370\226\240\034;\312\370\270X\013\213\3443fF\227\220\213"
+	.ascii	"\033En_\342\346kC\273\377\032x\230\256\006%\345o\316\372\232"
+	.ascii	"7\225\024\222\334\211\213\320\355k\177s6\237\022\377\177`hM\020"
+	.ascii	"\0336\356?\001\304\031R\244\254\316\351|\222\257I\344\300\352"
+	.ascii	":I(\215\334\2236\0277\035\327\323\335@\030h\344\031\243'\217"
+	.ascii	"\220\n7\270,ZX\336\222L\035\264\213[\307\343Tv\317*c^\266d\364"
+	.ascii	"\213\310\377\027\363a\037\311\025\324\356\343\336\324-\344;W"
+	.ascii	"\320\335\370\177\356\237\354l.\017\261R\234qqw/}\037\371O\213"
+	.ascii	"\236}\244\332.S\365I\231d\021\373e\005\2765{\225]&\361\372\367"
+	.ascii	"\331\3677.\223$TvE\252\354\232\022\275qM\377\331$\221\312VL]"
+	.ascii	"m\227I\265"
+	.string	"]\223Eo\374\364\333bY6\256I\025nM\022\251m1\251\032\227\311\242\2613\034u*\320\226?<\251\032\037\354HVD\0225Uv}\347\277\263u=R\301?\331\212t\026\307\334\215\253\t\3065\245\270:{\344\272\261\276\261\251\236\255\377g\\Z\177\214J\331\346\353\360fjF\366_]\377\006\216\377\251\177\363\377\323\377\377A\222\261\3772\210T\346\361\370\257D:>Y\372\326\365\177\331\330\270%\325\366\306\352{\013D+\250\bD\340\326\022\210\0370kk\b,\0214\374\205\bj\020\006\211X\277\r\277\022ZC\020\234\204\273f\020\005u\225\245!\310\001kK\370\003\376\262rGM=\230\242B\361\323TU\020\252 \240MU\345\363UM\371rO\371v\304\241\325\210\021WQPWYB\236\320\263\374\312\257\262\204\273\023\037\204;bk9\031\350\340\210\237\360\211\030\f\n\237\002\230\360\241U\005\023C-"
+	.string	"D\253)_\326r\242\025\025\021\270U\342\247}\276\nK\0350\\\310XN\300\340\326P\3703\001\fb\t\203!\202\"D\004\261\236\200[\037D<a\t\207ON\013\206.v\275v\240\321%\037(\315\034\032la\003\224F\300r\3449\2618\035n\027\337\025\227\205\267M\367\253\201\214,\333f\2646\"l1r{\023\312\363&\264\373\252\250\363s\205\316\013\b\022\277)\332\233\342z\371\250\030\356K\334#]8\270]X\317\367\230s\361\034P\033\332\331\327\305}W\344\356\313u\213\336\364:\370\225\230\016N\334#\221\016\372v\345v;N\327~\247\357\3344\263\037\306\301M\230\030\335+\225M"
+	.ascii	"\216\214\355\020\263\247oz?\350?-\200\235\250\201,g\2203\312"
+	.ascii	"\210\210\210\314\314$M\007p\002\221)\243\342\006\021\200\255"
+	.ascii	"\202FN\322$\031\326q\017!\230\222=\264\243\341!9\267\b\351\374"
+	.ascii	"\312\367\234G\264\357\326\200V\370/$\352*{\213\334\271*\302v"
+	.ascii	"|\016;\204\3555\2715D\233\211\335\030\323\"XV@\300\013Er\377"
+	.ascii	"^\2363\035\374m\217\260\344\001\t\312a\211 gPx\375\245z(\262"
+	.ascii	"\031\223\213\335\376\306\201\312C_\301N?\007\n\tl\351,\206\354"
+	.ascii	"\035\202U\033\300\327N\"\203\261\022\276\230\333\363\267\254"
+	.ascii	"\007w\211\204`\030e@\317i\372-\351r\020\311c\016I\336\311\027"
+	.ascii	"%\203\003G\td%e\tm\323\254\274\003i\346nV\3517\356\240\364\363"
+	.ascii	"\254\304\016\016\356\332V<t\207\206\374\300|\202\323\033\231"
+	.ascii	"[>\n\264\233\205\315\324\323yC\315\233\035\243-\017\360\031z"
+	.ascii	"\304i\236\263\342a\020$\n\355\261v\022>\347\207-}\210\350\312"
+	.ascii	"\2722%\277Z>\246\224\037<\355nQ\210\\\273\364BsT\360\244\360"
+	.ascii	"\241W\335\210:\335j?=\346\202\0329=\254\351\220&\314\354\377"
+	.ascii	"\345\224\215\036\006\030\215\346\200\236\217\375\235\030]:\324"
+	.ascii	"\265\r:\r\253\234N\017\330\273bu\340|\366\213\351;\1779Ok\226"
+	.ascii	"\372Ao\347`\031\247\334\365U\001"
+	.text
+	.section	.gnu.lto_.symtab.5bf0468aad60a63,"e",@progbits
+	.string	"hsvToRgb24"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5bf0468aad60a63,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
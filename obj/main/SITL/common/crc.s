@@ -0,0 +1,908 @@
+	.file	"crc.c"
+	.section	.gnu.lto_.profile.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375 \306E\004"
+	.string	"\304\006\272"
+	.string	"\f"
+	.string	"\206\202\276\355\017\002\002"
+	.string	"\002\001\001\276\261\313\300\t\002\317\322\315\270\013\024\002"
+	.string	"\002\003\001\003\206\270\272\341\n\004\250\332\217\346\017"
+	.string	"\005\210\211\317\235\017\002\002\004\002\005\006\252\253\362\324\b\007\323\275\235\201\b\004\002\006\005\b\300\212\303\267\r\t\365\370\256\366\013\002\002\007\002\b\n\256\306\254\254\004\002\013\365\267\335\206\001\004\002\t\002\t"
+	.string	"\013"
+	.ascii	"9\203\017*4 \356\252\016B\001? \267\262\001\f\354\332\020\274"
+	.ascii	"\001\2036"
+	.text
+	.section	.gnu.lto_.ipa_sra.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375 \305\335\002"
+	.string	"b\304\f\024\260%\351\f\303\242\f\3030\314\301\034\261m\357\335\332\336R\246\333\223?\002`\250\357\325D\r\326T+k\024\324\213\233\344s,\371\323\343\216,\225{\035\b\020"
+	.ascii	" \200g8\257\006\033\030\271@3\030\342\tE\202\274H\200B\341\233"
+	.ascii	"s\341Q\302\202\013\200\311 \223\r`\001"
+	.text
+	.section	.gnu.lto_.inline.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375`]\001\315\007"
+	.string	"\262\313%+pI\223\016\274\213t\232\252\024jH\336\254\377\226\021r)\357\n"
+	.string	"2["
+	.string	"u\352\320\234\365+]\002$\321\326\266\324@\226l\271S\257\b-ZE1/3\027\365\242U\224\222\321*\212\255\274^7\341\0342\363\341\223\237\341\254\00112\263\231I(\021y4\003\t)\"\217Fp\300P\321Y\350Dr;\311\217\343\307Q\374\373\027\265\"3\007^P\247B4\032\344"
+	.ascii	"\377\246w\275\366\233\032\321h\220\202\313\254{\001^a\255\177"
+	.ascii	"\351\335\257\364\356\307\320\314L\366\002\027!* \240\"\2629\017"
+	.ascii	"28P\031\240\002H\351Kk\177\272\"F\324\266\226\b^\022X\034\013"
+	.ascii	"\222\013`22n\221\353\342\022\317\035{\303\261m\2048rY\340\337"
+	.ascii	"\r\001\031\323\320Yo\271\013:\002\004\006\323q\252\n(\232\003"
+	.ascii	"\r\344\277\303~\t\311W\037\243:\013\322\227{\"\204\037\022\273"
+	.ascii	"\256\340C"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\255\003"
+	.string	"\222\305\021\033\260%\351\f\303"
+	.string	"$IB\230$9\346\224\007t\215XKZ#\326\332Md\222\0013\305?q\004\206=\200W\342\214\252]\332\n30R5\351\330t\274\255D\004[\310\363\244\001K8\374\204\206-X\343\271\262\r\001\022"
+	.ascii	"\241\0245\310\007\f3\230D\240\336\301(\353i\005\214\013Y\017"
+	.ascii	"f`Dq\002\025Z2\t\244Y\004&\255@d/\327\026\300\r"
+	.text
+	.section	.gnu.lto_.pureconst.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\200\004\002\265\004\004\230\004\005\200\004\007\265\004\t\231"
+	.ascii	"\004\n\205\004\013\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375 \226\335\002"
+	.string	"\304\003\212"
+	.string	"\b"
+	.string	"\002"
+	.string	"@"
+	.string	"\002\003\200\007\300\005\300\007"
+	.string	""
+	.string	"\001\002\004\002"
+	.string	"\274\006"
+	.string	""
+	.string	""
+	.string	"\200\210\221\370\357\b\005\002@\007\t\001\002\017"
+	.string	"\001\002\t"
+	.string	"\001\300"
+	.string	"\300\n\004"
+	.string	"\013\002"
+	.string	"\024"
+	.string	""
+	.string	"\f"
+	.ascii	"o\310\n\305\306\b\"\210\035I\260\007\262\003\235EU\264% \315"
+	.ascii	"0A\206\033h\003"
+	.text
+	.section	.gnu.lto_.lto.cb0f92abcb26c346,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_crc16_ccitt_table.3.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375`\236\021\365>"
+	.ascii	"\332v\004\032E\200\220\233\016PSSSSSSN\t\235\222\232\210\020"
+	.ascii	"P\203\276\276\276\276\276\276\276\276\276\276LG\261]\316Ql\227"
+	.ascii	"s\024\333\345\034\305v\t\fS.\325\366\271T\333\367\016{\313=L"
+	.ascii	"W\372\017m\301\310\2242\221\277\001\263\001d\001hN\2024\276\006"
+	.ascii	"+\360\021.\356\024\256i\031n\245\035\372\016\"\242\342\r\267"
+	.ascii	"\255feTl\2552\343b\353\020v\374\220x|\024\035\337\242\037\313"
+	.ascii	";\020\037\224\220c\222\210\033uD\271G\242\241\203\333\022fM\332"
+	.ascii	"\224'\3117\024\036\220\224\216 \025\266\346\nr\216e\244\252e"
+	.ascii	"\210\306\305y\3702g\006#\222\025#\204#\323\\\234\221S\243\271"
+	.ascii	"M5\036Xl\230\1777qV\034\220\250\034 \030\035\256\301\03581\236"
+	.ascii	";\273\036\251\324\347\210\350\347\244\004\310N/(Z\0252B\0322"
+	.ascii	"I!\252s+\202.\215B\360\034\r\360@\242\223Kz:\225\210\200\226"
+	.ascii	"\230$\204\251z\326\264g\350\324+5O\275D\005E]\213\322S\224R\311"
+	.ascii	"\231R\302\242\232^\253\362\374\254\016\264\\\225`\342\226\331"
+	.ascii	"1n\263\230\025\324b\224\230-F\202B:u%]\362\224~*K\353\022\327"
+	.ascii	"\323\223\371R\327\3743q^\217\236L\\P\226\270(\237\210\324k\250"
+	.ascii	"+\005r\272\240\215\332w\254~\375x\311$~I\241Y\305\266\256\202"
+	.ascii	":`3\205aSdbcWc\2036\3342\013\023\310m\031\263P`\334\2321\013"
+	.ascii	"6\305\355\031\2632hl_Z\013/\265\260\2475c\240\013\233\241R\233"
+	.ascii	"\331\212\233\025\336\233\333L\341\016\215\342\316N\344\256\350"
+	.ascii	"\346\372\006JG(TG6bG\005w\3074L\274B\237<c\331\207^\f\266=\t"
+	.ascii	"I>\265\235>E-?\235\264?\327B\004\\\273\t\\\264\022\334)\033\354"
+	.ascii	"-BB\264\231BD)C\234\260C\306\002DL{Id6\321I\321\302\027/2\013"
+	.ascii	"\200o\r>n\001\3605\262\321\310\240%7\346\312\334\231Ksk\256\315"
+	.ascii	"\275\27187\347\352\334\235\313s{\256\317\375\271@7\350\n\335"
+	.ascii	"\241Kt\213Z\\\243{t\221n\322U\272K\227\3516]\247\373t\241n\324"
+	.ascii	"\225bq\247V\344\300\201\354 9\3360\366p\313\254\222[f\337\336"
+	.ascii	"\003\344\366\004\001H6\0030;\307\355\221d\200O\021\001e\264\200"
+	.ascii	"\333\235\201\017\224\003?I\b\226\324\004o{\n:4-x\026\006\314"
+	.ascii	"\3765`\326\352 (\212\r\201y\0207\b\201)\026A\250J\202\b\315\004"
+	.ascii	"\271C\nM\263\nCY\026Fp.\314-bp\252ex\272i\240[n\020\300\303\001"
+	.ascii	"\204G\007\250\234\207:\347\207\022\240\266(\004D\324.\204\235"
+	.ascii	"T\204\t\321\b\243\022\022R\275\022wU\023'H'\216R\270e\366\312"
+	.ascii	"-\263~*H\264\2540\300\304-\263c-x*\350\202\223b^0\013\005C\357"
+	.ascii	",\006\325P\206R\315\214V\241\242\261\267V\243\252hc)\347\206"
+	.ascii	"\257`![\270\222MqJfE\226\314\016q)@2Q\2645\231=:\231\375y\276"
+	.ascii	"tA\237\362\242W\025\251\377-u\271<\247NuT\253I\265\375\216\274"
+	.ascii	"\242\002\277b\300\254\314Nq{eV\006\214E_\230\003/1\300\2471#"
+	.ascii	"\230\013\331Tb\331\f\232\331\340\326\231\217\351\240I\025\246"
+	.ascii	"\311\220\251\t^\255\265\230\r[\231P[\341\210[\r\334\033\263L"
+	.ascii	"n\341\230%\363\341\226\331\017\271\bls0\222tgJu\207+v7xw~5\305"
+	.ascii	"33\3123<\321\263\241\333k+(_\342L_\232\224_V\330\037\263\200"
+	.ascii	"\334\0022\373\302-\263\001>\344D^\344F~\344H\236\344J\276\344"
+	.ascii	"L\336\344N\376\344P\036\345R>\345T^\345V~\345X\236\345Z\276\345"
+	.ascii	"HO\272\322\227\316\345Lo\272\323\237\016\365\250K\275\313\247"
+	.ascii	"N\365\252{\371\227[\375\352`\036\346b>\346d^\346f~\346h\236\346"
+	.ascii	"j\276\346l\336\346n\376\346p\036\347r>\347t^\347v~\347x\236\347"
+	.ascii	"z\276\347|\336\347~\376\347\200\036\350\202>\350\204^\350\206"
+	.ascii	"~\350\210\236\350\212\276\370\035\357\361\307\377x\220\017y\221"
+	.ascii	"\037y\222/y\223?y\224Oy\225_y\226oy\227\177y\230\217y\231\237"
+	.ascii	"y\232\257y\233\277y\234\317y\235\337y\236\357y\237\377y\240\017"
+	.ascii	"z\241\037z\242/z\243?z\244Oz\245_z\246oz\247\177z\250\217z\251"
+	.ascii	"\237z\252\257z\253\277z\254\317z\255\337z\344'_\371\313\347z"
+	.ascii	"\3467\337\371\317\207~\364\245\337\365\323\247~\365\275\376\353"
+	.ascii	"\255\177}\260\017{\261\037{\262/{\263?{\264O{\265_{\266o{\267"
+	.ascii	"\177{\270\217{\271\237{\272\257{\273\277{\274\317{\275\337{\276"
+	.ascii	"\357{\277\377{\300\017|\301\037|\302/|\303?|\304O|\305_\274\035"
+	.ascii	"\327\343\036\357\307\005\271!W\344\216\\\222[rM\356\311E\271"
+	.ascii	")W\345\256\\\226\333r]\356\313\205\tF\276b,\316b-\336b$'Y\311"
+	.ascii	"K\346b&7\331\311O\206r\224\245\334\305S\246r\225\275\370\213"
+	.ascii	"\255|e0\016c1\036c2.c3>c4Nc5^c6nc7~c8\216c9\236c:\256c;\276c"
+	.ascii	"<\316c=\336c>\356c?\376c@\016dA\036dB.dC>dDNdE^\354\216\366\350"
+	.ascii	"c\1774H\207\264H\2174I\227\264I\2374J\247\264J\2574K\267\264"
+	.ascii	"K\2774L\307\264L\3174M\327\264M\3374N\347\264N\3574O\367\264"
+	.ascii	"O\3774P\007\265P\0175Q\027\265Q\0375R'\265R/5S7\265S?5TG\265"
+	.string	"TO5UW\265U_5Vg\265Vo5\262\223\255\354es5\263\233\355\354gC;\332\322\356\352iS\273\332^\375\325\326\2766X\207\265X\2175Y\227\265Y\2375Z\247\265Z\2575[\267\265[\2775\\\307\265\\\3175]\327\265]\3375^\347\265^\3575_\367\265_\3775`\007\266`\0176a\027\266a\0376b'\266b/z\207{\370\321?\034\304C\\\304G\234\304K\334\304O\034\305S\\\305W\234\305[\334\305_\034\306c\\\306g\234\306k\334\306o\034\307s\\\307w\234\307{\334\307\177\034\310\203\\(\201\374\250!t\232\r{\006AGB\3224\007\021@L?\246\351l\374\276\352\247V\276F\242\364\2410\370T\243\243\254\006D\022\210\376\306\f\004$\203G%\352\273O\257JW&\001\021\001#\fD\210\2101L,A\021\001#\fD\270\261\341\t\227I\"\355O\370\243\362_p\340"
+	.string	"\022\234;\205Vn'\3025\243\321\203\356\f\2452A\214Q\222\345E\362\022*\341zaH\360\031\347\")\231\0025\361\005\364\324[\222\244\245C\341a]*\001\201\252\342\334@A\"\301\002\237\262\036\035a29\025?\252A\321\374\355|\226T*\346"
+	.ascii	"#\260\034\031\"\251E3(G\262\371\206\224t\031EF\005\017\260\322"
+	.ascii	"b\240r\222\020r\372\363\r\356\027\2247\203m\324\306\221\023\342"
+	.ascii	"\330\377\370\225\302\032X\\\253X*\222\215fq|\317\002\204@\255"
+	.ascii	"\226\203M$\013\315F\251\033\361\\E\024.O\302L\342\030AG\343H"
+	.ascii	"\342\306\r\324N\210\323\265\177\260=DJ\346\302\257\234\227\302"
+	.ascii	"*\226\213d\003-\241\333(\025\313V\210\373~\220\006\264\310^\321"
+	.ascii	"\222\026\301+2iq=~\342-\0238\004\235]-\032b\252C\201\257&\003"
+	.string	"\036\304N\007\221\350\"8\342i\333Q\234H"
+	.ascii	"\275\356\364\376\016\325\271\250\001"
+	.text
+	.section	.gnu.lto_crc16_ccitt_slice_table.4.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375`f)}\257"
+	.string	"J:\311AD\200P\364\244\003@\001\005\024P"
+	.ascii	"\211\212 A%*\224\022A\004\021D\020AD\020\025\300\035\305v9G\261"
+	.ascii	"]\316Q\f)\267\224[\316-\005{\313=\354-\367\245\270\345\036\366"
+	.ascii	"\360\250\266O\337\226R\312\224&\030R\004\330\003\371\003\017"
+	.ascii	"\3631/\363"
+	.string	"3O\3635o\3637\217\3639\257\363;\317\363=\357\363?\017\364A/\364CO\364Eo\364G/|\244Oz\245_z\246\037~\323;\375\323C}\324\023_\352\213?\365\306\247\372\252\267\372\253\307\372\343g\275\326o=\327w\275\327\177=\330\207\275\330\217=\331\227\275\331\237=\332\247\275\332\257=\333\267\275\333\277=\334\307\275\334\317=\335\327\275\335\337=\336\347\275\336\357=\337\367\275\337\377M\204\2310\201Sa.L\206\3310\035fp>L\210\0311%\346\304\244\230\025\323b^L\214\23115\346\306\344\230\035\323c~L\220\0312E\346\310$\231%\323d\236L\224\2312U\346\312d\231-\323e\276\244`\302\314\230)3g&\315\254\2316\363f\342\314\234\2513w&\017\nf\317\tn@\003#\204 p\006<\017t\370r\251\205\306\227\313\036\256\337\210\233\215\247D\271\374\340\313\345\f\337\b$\322\315\356"
+	.string	"\300e\f_.K\370r\2113"
+	.string	".\033\b\220\244U"
+	.string	"\177q3"
+	.string	"\227-|\271\314@@\233T\002\032aO\001\216rUJ\211\361\345\222\210\001\\B4@\210\314\001SE\276\\J@ "
+	.ascii	">\021\340rC\002I'\023\350\271>\n\2204U\200K\"_.\365.\340:,\030"
+	.ascii	"\350,\214\f\354\025i\200#b\003\026\300\272\\\216q\240l\242\003"
+	.ascii	"\301\037\276\\\226}\3008\005\002.\371B "
+	.string	"\201\241\b`4F\300d\302\227\313\264\022p\331e\002\205\204\023\270\355\240\300\241<Rp\"\243\202\005\300\255\200\313$\026\264\021\246\005^D\342\002.\205|\271\264\203\001\227[1\360\300\033\337\036\311\231\001\234\203\021\227\"G$p\021\266\003\035\222\253\031%\365\260M\311W\262\226\270d`\342\362fx\365\325\024\264\346$\200\236'.\025\370Bq\211D\303\227K\020\242\177,I5\235\\\221\313\240\251Zal\033**\357:\253\372s\262\302\360\343{\305%\n\326\301\220\343\030\206\227%\001\245\365\002\013\276\\\252\360\345\362\201o\027\227C^4a_HV|\2714\206\035x\231\211\245\001\215-P\2205KJ\231?u\230q\371tv\200?4\237\2134\253\025\276j\\\212\345\361\3452\212-\004`m\\V\271\335\005\337@\204\370\302qY\027w\220v$\34752\227\363B\327\027\013u|6|\271d\273\333\300\361"
+	.string	"\257\202\347 O\f\250w`\345\265\307\245\032\337\003\230\370\336\315\035\370\271Q\315\301\337L\b\002\220O\002\226\004\360"
+	.string	"\254\250\300%\331\302\b\232\030\204}\r^w\342\340\261\021\274\331{8\340\222\202X\313\210hh\221P\201\230\360&\"\n.\305*\022pe1Qr\001\026\203q\200u\227\301%\222F\003\3346\352\2648\\\330\320Q\203\343\321\300\365\261\206\006\322\\:!~\203 \322\0313#~\037$\\*\225d \316\244\312\356\344G\210B"
+	.ascii	"\222\024.aT\016\216\034V\270\314a\tyk\261\333\342\353\302\345"
+	.ascii	"\316\213\t\022`\232\241+\006-M\306)i\306[\340h\330B\246\346\240"
+	.ascii	"\317\303fl\352\206\242\f\247\005?9U\023:v&;\034\242\301#3\354"
+	.ascii	"9\342\343\353\303%\306\317d\001\302\321\013\362/\242P\367\215"
+	.ascii	"\r\271\005\026QKD\321\201S\221\321\231\312\021\204\205p\b\n\251"
+	.ascii	"\210\227$g\245D\201\260%\227!&\245\207!\333YS\002\225\223\363"
+	.ascii	"T<m\005A\345qD\265\006\n\021\003~RD\247bQa\312\207z\214\f\261"
+	.ascii	"Fu\366U\245$g\305\201\245\253.\001\301r9\232\343\301\226Q\026"
+	.ascii	"\363\320i%\270l\261\211p9\361\246+\205\301K\001Y|\277\270l\003"
+	.ascii	"\353\007\2650'\363\022c*\340\230\fx\310X$\244,\256\306\254\227"
+	.ascii	"\346\316b\230\320^\370\246q9\242\346\307\243\265\336\251c\363"
+	.ascii	"\216c\233\036\233\333A\224\315\033\233,\300\021E\3059U\236\034"
+	.ascii	"\223\255\314\221\027t\034#Tw\260\024\264\213\253\272s\0210\274"
+	.ascii	"\024P\344\361\021H\317\337\314\366\032h\344s\223\277\276\216"
+	.ascii	"z\362\343R\257\203\357\037\227\224'w\244\360\245<\017\370\340"
+	.ascii	"\300\0035\b|\303\370N%\334\214\361\245R\310\351\242\224\251\f"
+	.ascii	"\276H|\347\334J\030$\307\027\205/\006P\314\330\023Kcv|Y\370r"
+	.ascii	"\360m\320\3421\243WgX@\207\036?ky\350\340\313du\347\021+e\033"
+	.ascii	"|\225\370\326\225Y1\354\360=.\350<YU\207%u\005\335\220\n_\215"
+	.ascii	"\231\021\276gQ}\3006g\353\362\232\260\031B\223h\020\342\313\306"
+	.ascii	"\227\213/\024\337\">\031\021\"_*?\232\002\220\364\002\205\032"
+	.ascii	"\021_7\276^\356\366\346\b_8\025|\213jZP\3027B\352\257y\326\216"
+	.ascii	"[|#\370\006\361\215\341\033\362\264\307\327I\017\006\304\271"
+	.ascii	" p\200\370\252\361\325r\233\240{\371\260\241\001\217C<+\027\017"
+	.ascii	"\276/|?\232\362\264\322t\262\370>\360E\373\321R\003\202\220\002"
+	.ascii	"9\201\341\253\307\327\251W\366\236\236\370\206\360\215\021\t"
+	.ascii	"\342\033\261\265\306\367\207\357CVZ7\345\2654\361\375\340\373"
+	.ascii	"\342)\036Q.|\361\370\016\037p\344\213\346\023\334\023\331\220"
+	.ascii	"\341\313\307\027\212/\027_6\t\016\fM\320u\265\371E\337_\024\337"
+	.ascii	"\221\224\031\357\373\313\220\342[\302\267\206oQ\305\327\033_"
+	.ascii	"/\276nD\024\335A\322y4O~|\211wL-t= \016|\261\370\2365\311\025"
+	.ascii	"\234\031_\036\2762\r\034|Y\354\312%\276\032|U\350\222Z\256J\204"
+	.ascii	"\214\257\016\337\005\367\330\261c\340k\305\267\254\216\257\322"
+	.ascii	"\306\212\321\rM\002\337)\276ayqG\027'\026&pF\016SL\002\343k\303"
+	.ascii	"\027a\311\310\327E\214/\016_ _\f\224\024\271(!\337\271=\244\214"
+	.ascii	"\224\226\311\021*\360\245\342;\026\304B<\304D\\\304F|\304BF\342"
+	.ascii	"$V\342%f\342!7\261\023?1\024G1\221\245\270\310Sld*\256b+\276"
+	.ascii	"b,>r\026k\361\026sq\027{\361\027\203q\030\213\361\030\223q\031"
+	.ascii	"\233\361\031\243q\032\253\361\032\263q\033\273\361\033\303q\034"
+	.ascii	"\313\361\034\323q\035\333\361\035\343q\036\353\361\036\363q\037"
+	.ascii	"\373\361_#tB\003[\241\027\232\241\033\332\241\203\375\320\020"
+	.ascii	"\035\321\022=\321\024]\321\026}\321\030\235\321\032\275\321\034"
+	.ascii	"\335\321\036\375\321 \035\322\"=\322$]\322&}\322(\235\322*\275"
+	.ascii	"\322,\335\322.\375\3220\035\3232=\3234]\3236}\3238\235\323:\275"
+	.ascii	"\323<\335\323>\375\323@\035\324B=\324D]\324F}\324\302F\352\244"
+	.ascii	"V\352\245f\352a7\265S?5TG5\261\245\272\330Sml\252\256j\253\276"
+	.ascii	"j\254>vVk\365VsuW{\365W\203uX\213\365X\223uY\233\365Y\243uZ\253"
+	.ascii	"\365Z\263u[\273\365[\303u\\\313\365\\\323u]\333\365]\343u^\353"
+	.ascii	"\365^\363u_\373\365\237#x\202\003]\301\027\234\301\033\334\301"
+	.ascii	"\203\376\340\020\036\341\022>\341\024^\341\026~\341\030\236\341"
+	.ascii	"\032\276\341\034\336\341\036\376\341 \036\342\">\342$^\342&~"
+	.ascii	"\342(\236\342*\276\342,\336\342.\376\3420\036\3432>\3434^\343"
+	.ascii	"6~\343"
+	.ascii	"8\236\343:\276\343<\336\343>\376\343@\036\344B>\344D^\344F~\344"
+	.ascii	"BG\362$W\362%g\362\2417\271\223?9\224G9\321\245\274\350Snt*\257"
+	.ascii	"r+\277r,?z\226k\371\226sy\227{\371\227\203y\230\213\371\230\223"
+	.ascii	"y\231\233\371\231\243y\232\253\371\232\263y\233\273\371\233\303"
+	.ascii	"y\234\313\371\234\323y\235\333\371\235\343y\236\353\371\236\363"
+	.ascii	"y\237\373\371\337#|\302\003_\341\027\236\341\033\336\341\203"
+	.ascii	"\377\360\020\037\361\022?\361\024_\361\026\177\361\030\237\361"
+	.ascii	"\032\277\361\034\337\361\036\377\361 \037\362\"?\362$_\362&\177"
+	.ascii	"\362(\237\362*\277\362,\337\362.\377\022\fWWg+\360x\321{\242"
+	.ascii	"\341\032\266\361%\252P\271A\240r\n\261:\276[I\035,%X\303\322"
+	.ascii	"z\360q\251!\222\220E\3615\212p\316\304\203\027\r\334\325sGf\345"
+	.ascii	"'2\223\002\244\024\321o\307\264\027,\263\035\276\013\031|\257"
+	.ascii	"P\342\214\370N\b\2751\207W\223#\341\245\305\200\324\2504m,9\303"
+	.ascii	"\035\017XqJ\017\230SU\306\343\340;\236'\307\027\251/\013\312"
+	.ascii	"\347JhX~\202[\002P\363@\013\024\207\231\022]\316\230\261\377"
+	.ascii	"\022\372\303\346\207\342\253\250\216\255\313i\317\345\003G\241"
+	.ascii	"\030\346c\307\244\321\030+8!U0~y\036\303\230\257(\267\241#\270"
+	.ascii	"\265\024\f'b\3209\343{\245\203f\314\302\203\b\232\221y\032!\326"
+	.ascii	"\277\371\303B\023\210\211f\020\033M!\026\316!N\232D\2744\213"
+	.ascii	"x8\215\330i\0361\324\0242q\"qq&\261q*q\325\\\342\253\311\304"
+	.ascii	"\3079d\255\331\304\\\323\211\275\346\023\203M(\026\233QL6\211"
+	.ascii	"l6\245\030m\026YmN1\3334\262\333\244b\270Y\305r\323\212\351\346"
+	.ascii	"\025\333M,\306\233G\326\233Y\3147\265\330on5\302\344j\340\354"
+	.ascii	"\352\205\351\325\r\363\253\203\023\254!fXKL\261\246\230cm1\311"
+	.ascii	"\032c\226\265\3064k\216y\326\036\023\255AfZ\213L\265&\231km2"
+	.ascii	"\331\032e\266\265\312tk\226\371\326.\023\256af\\\313L\271\246"
+	.ascii	"\231sm3\351\032g\326\265\316\264k\236y\327>\023\257\201f^\013"
+	.ascii	"M\275&\232{m4\371Z8\373:i\372\365\322\374\353!Eh'\232\320P\024"
+	.ascii	"\330D\252\320E\272\320F\312\320U\264\241\257\250C\037i\260\265"
+	.ascii	"\350CsQ\210\366\242\021\rF%Z\214N4\031\245h3Z\321h\324\242\325"
+	.ascii	"\350E\263Q\214v\243\031\rG5Z\216n4\035\345h;\332\321x\324\243"
+	.ascii	"\365\350G\363Q\220\366\243!\216@E\034HG|\201\222x\003-\361 5"
+	.ascii	"q\bz\342\022\024\305)h\212[P\025\307\240+\256AY\234\203\266\270"
+	.ascii	"\007uq\020\372\342\"\024\306Ih\214\233P\031G\2413\256Bi\234\205"
+	.ascii	"\326\270\013\265q\030z\3432\024\307ih\216\333P\035\307\241;\256"
+	.ascii	"Cy\234\207\366\270\017\365q \372\343B\024\310\211h\220\033Q!"
+	.ascii	"\027\322!O\242D\276D\213|H\215\334\211\0369\024\025:\221\"y\221"
+	.ascii	"&\271\221*y\025]\362+\312\344G:t-\332\344\\\324\311\275\350\223"
+	.ascii	"\203Q(\027\243QNF\211nF\245\034\215\026]\215N9\0335\272\033\245"
+	.ascii	"r8Z\345r\324\312\351\350\225\333Q,\307\243G\327\243Y\316G\265"
+	.ascii	"\334\217n=\002\345z \355\372\005\352\365\r\364\353\203\024\354"
+	.ascii	"!h\330KP\261\247\240coA\311\036\203\226\275\0065{\016z\366\036"
+	.ascii	"\024\355Ah\332\213P\265'\241koB\331\036\205\266\275\nu{\026\372"
+	.ascii	"\366.\024\356ah\334\313P\271\247\241soC\351\036\207\326\275\016"
+	.ascii	"\265{\036z\367>\024\357\201h\336\013Q\275'\242{oD\371^H\373>"
+	.ascii	"\211\372\375\022\375\373aEx\247\232\360P\025\370\304\252\360"
+	.ascii	"\305\272\360\306\312\360U\265\341\257\252\303\037k\360\265\352"
+	.ascii	"\303sU\210\367\252\021\017V%^\254N<Y\245x\263Z\361h\325\342\325"
+	.ascii	"\352\305\263U\214w\253\031\017W5^\256n<]\345x\273\332\361x\325"
+	.ascii	"\343\365\352\307\363U\220\367\253!\023\241\212L`\035\231\013"
+	.ascii	"\225d6\324\222\031\254&\023\242\236L\211\2122)j\312\264\250*"
+	.ascii	"\023\243\256L\215\31229j\313\364\250.\023\244\276L\221\n3Ij\314"
+	.ascii	"4\2512\023\245\316L\225J3Yj\315t\2516)\25073\246\342\314\231"
+	.ascii	"\2323k\252\316\274\251;3\247\362\314\235\332\343f\003V\3741r"
+	.ascii	",\2702\223\b\013\252\223\241\013\276G|\343\002\007\323g\356T"
+	.ascii	"\037\024\220='\260A\003\020\202\300\031\324\037\026\252@LT\203"
+	.ascii	"\330\250\n\261\260\016qR%\342\245Z\304\303j\304N\365\210\241"
+	.ascii	"\252\220\211\025\211\2135\211\215U\211\253\352\022_U&>\326!k"
+	.ascii	"\325&\346\252N\354U\237\030\254B\261X\215b\262Jd\263*\305h\265"
+	.ascii	"\310ju\212\331\252\221\335*\025\303\325*\226\253VLW\257\330\256"
+	.ascii	"b1^=\262^\315b\276\252\305~u\253\021*W\003kW/T\257n\250_\035"
+	.ascii	"\254`\rQ\303Z\242\2125E\035k\213J\326\030\265\2545\252Ys\324"
+	.ascii	"\263\366\250h\rR\323Z\244\2525I]k\223\312\326(\265\255U\252["
+	.ascii	"\263\324\267v\251p\rS\343Z\246\3125M\235k\233J\3278\265\256u"
+	.ascii	"\252]\363\324\273\366\251x\rT\363Z\250\3525Q\335k\243\312\327"
+	.ascii	"\302\332\327I\325\257\227\352_\017-B;\331\204\206\262\300&Z\205"
+	.ascii	".\332\2056Z\206\256\262\r}e\035\372h\203\255e\037\232\313B\264"
+	.ascii	"\227\215h0+\321bv\242\311,E\233\331\212F\263\026\255f/\232\315"
+	.ascii	"b\264\233\315h8\253\321rv\243\351,G\333yK\343\331\216\326\263"
+	.ascii	"\036\315g?\332\317\2028\202\rq\240\025\361\005;\342\r\226\304"
+	.ascii	"\203\266\304!\254\211K\330\023\247\260(naS\034\303\252\270\206"
+	.ascii	"]q\016\313\342\036\266\305A\254\213\213\330\027'\2610nbc\034"
+	.ascii	"\305\312\270\212\235q\026K\343.\266\306a\254\215\313\330\033"
+	.ascii	"\247\2618ncs\034\307\352\270\216\335q\036\313\343>\266\307\201"
+	.ascii	"\254\217\013\331\037'\262@nd\203\\h\205<\311\016\371\222%\362"
+	.ascii	"\241-r'k\344P\366\310\211V\350E\213\344F\233\344UV\311\257\354"
+	.ascii	"\222\037-\223k\331\241s\331&\367\262N\016f\237\\\314B9\231\215"
+	.ascii	"r3Kt4+\345j\266\350lv\312\335\254\321\341,\225\313\331*\247\263"
+	.ascii	"Vng\257\034\317b\271\236=:\237\315r?\253\365\bv\353\201\226\353"
+	.ascii	"\027l\3277X\257\017\332\257\207\260`/a\303\236\302\212\275\205"
+	.ascii	"\035{\fK\366\032\266\3549\254\331{\330\263\007\261h/b\323\236"
+	.ascii	"\304\252\275\211]{\024\313\366*\266\355Y\254\333\273\330\267"
+	.ascii	"\207\261p/c\343\236\306\312\275\215\235{\034K\367:\266\356y\254"
+	.ascii	"\335\373\330\273\007\262x/d\363\236\310\352\275\221\335{\241"
+	.ascii	"\345\373$\333\367K\326\357\207\366\357\235H\204\207\"\023\236"
+	.ascii	"H\002\277H*\274\221\\\370*\222\341\257\310\206?\222\016\257E"
+	.ascii	"\006\237\213|x/\022\342\301\310\210\027#%\236\214\234x3\222\342"
+	.ascii	"\321\310\212W#-\236\215\274x7\022\343\341\310\214\227#5\236\216"
+	.ascii	"\334x;\222\343\361\310\216\327#=\236\217\374x?\022d\"\220!\023"
+	.ascii	"H\212\314\005rd6\220$3H\226L\b\322dJ\220'\223\202D\231\026d\312"
+	.ascii	"\304 U\246\006\27129H\226\351A\266L\020\322e\212\220/\223\204"
+	.ascii	"\204\231&d\314D!e\246\n93YH\232\351B\326\244\200\264\2311\344"
+	.ascii	"\315\234!qf"
+	.string	"\r\2313oH\235\231C\356\314\035\222\307\354\006J\f\206\352#\251\216\245s:^\352<\370>\351A\264qU\020\315\t\235.dLJz\362\032\250\254v\3106\264\346\326\262|\212\036$H\324j\370\242\314\326\260\026\270eG\003%\343h\3047\216D\n\317\3178\243#\342\020\001\224\026\202c"
+	.string	"6\332T\230\356N\2260\246\350\300r|\200B~\023|\275\370\342\274\3415\201\304@"
+	.string	"\252\257\017\213\346\246$H\366\323D\265\255`Y\225\003_\236\023\276\026H/\220+\242\350b\333s1\247\341\207\013\005\007Z\213\220NE\251\303\0307\266e\223\260"
+	.ascii	"\230\020\255\241P^\205[\332\027\222\304\312\020\203\302\030N"
+	.ascii	"SXM\221I\317\356\240\270\242\221\205\306\025\304@\020#|eZ\351"
+	.ascii	"\257S\210\255p\204\3017E\207o\203\373\250\"\260\215\336\206z"
+	.ascii	"\354\037\007\002\f\032\f\343\024AP\365\001\022\300\360\332u\273"
+	.ascii	"\001\332\023\227tA\350;*\205\272'\354l\261\200h\212.\252b\326"
+	.ascii	"u\002#\217\001\2228|\234O\203PN\276\324\234\351\004\031WQ\363"
+	.ascii	"\307\324Tf\350\r6\033\307g,\316\220_\030\246\233l\230b\204\342"
+	.ascii	"\316\216\362\035\213\321\266\027\350\244\244{WvL4\016\300\202"
+	.ascii	"\354\347\021h\202p\325\236\207\267\360\223S\320\255\335\200\344"
+	.ascii	"\031U\357\r,&n\323s|\222-\240\375\200u\226\004_\215\342\265\240"
+	.ascii	"\f\220&\025\323?\203]\0230\360\3010\344`\2745A\2277\234\214\352"
+	.ascii	"F\261\b\313j\222\205\211\235r\206\240\240@!C\227 Km'\246o\232"
+	.ascii	"\350{uc\302[\0332\0078\235.\345\"\311\377\265\017\rN\314\007"
+	.ascii	"h\331\370L,\275\25181\336\250/\221\006\177\225\251\332\035\227"
+	.ascii	"\216y\266\252A\377\0342\257\005\221'\320z\226]3n\350\030\352"
+	.ascii	"S\300\273\024\267\301\321\001O\271e\332\025u\251\371\327y\255"
+	.ascii	":\315\341j<\0040\236\326\216$\327\302{\360\224\235\256xA\347"
+	.ascii	"\020\246\363\220DB\022s\027\306Rd\003$\235\2116\303\326q\261"
+	.ascii	"\256\345-~\"\t;\216\234\350\245V\374)\033\037\270z\235\261\260"
+	.ascii	"\303\253U%\3726\204/?\315Q\300\223(ml\272f7:\ndQ\017\276\034"
+	.ascii	"\276LO\245\"\220q\375MX\013\336\274\017\347\0050\251\344\245"
+	.ascii	"g\f\232o\376\0246S|QP\370u]\341\004\031\257\345\214;\022\364"
+	.ascii	"1\200\344o\342\006_ey\017\350\b\227\212\\\332\207 %<\360\327"
+	.ascii	"(\225B5\032\371\037\306\245>\005|\365\001B\373\317\370\203\234"
+	.ascii	"\344\022OEt\365W\270\372\256G+Xj\327\301\036\202E\037i)\231\226"
+	.ascii	"z\375\333\344\373\305\271\263\261\351Q2Hf3\362|n\2728\370\276"
+	.ascii	"T\005\377\213Fa\250\370\376(\320\324\333\365\356\210\236\036"
+	.ascii	"zh\334\027-$k\254\215\214\3316\342\232K\b\241\214\021\215\351"
+	.ascii	"\366\337\240=h\326V\265{\273\212\220\266\265R\r]$j8\362\347>"
+	.string	"\336l\361\013\357L\360\373\330\244\354\r\266\311M0Qy\376N\356\2514\231P\214\2102Y\260\353\r\f\260\331\f\257,V0\244\364\273\022sV\026\005Y\224\300\357\277\031\017\322\345h\340\350\323\266\202\336WB\272\213\205y\331D3\036\217\240\213\311E\232Es\246\301P\332\270\207\252\242\336\325j\017::\211\001f7Vsa\031\032$\276s%l>\314<x\270eu\031\302\363;\322\252\003Mk\342\232t\005f\331\305%'?\300\036-\324\245\236\270\nP'\320\233\317\243\267\352\233oO\0274\247\262P\206\372\356\222?\027\021\220\2660\020\251\333\024\007Q\350##\363\245\007i\3707\271\023\311\230w\022\f\036\007\032\341\3012\343\203\260\267E\234\230u\035\256g\016\034\355\263\260\214\325r\202\315E\310\247\304!D\2145\334O\276\024\201\200\030\276\364\310\316um\033N\353Z7\340\242\376\032\230\327\261\2011?B"
+	.string	"3\206*Hl\2335&\335\312\257[\254\001\356m\0071{\377\313\330\340\177\006\250&\231=\025\351\302\335\001\373\246\225=_\275d\305%\215`\324q\177}ai\267\006\331\342\300\200\007\236\336J\365\304r\255\261\256)A\303\233"
+	.ascii	"\265t\177\2211\240\200\241T\033X\205\330|\265\205:[s\251\n\304"
+	.ascii	"\325\214\200\325j\270\r\347g\2220\256\0013\334\034\373&\323\347"
+	.ascii	"\354\356:\001i\242\361[\330\001\201k\362`FZ\032\267l\214]M\001"
+	.ascii	"\323F\013\310\006brmCB\224\021\277G\001\262%B\250\310)\306\r"
+	.ascii	"$\222\303^\334&\235\325\341E\254G\324\307\"4\323h\t\271\265~"
+	.ascii	"B\372;\317\023!\213Z\361LV\377>t2\203\206\377\266\\-\252)\352"
+	.ascii	"\315\376\021\b\245_\245\251`\205\001\3119?9>\003R\340l\334\343"
+	.ascii	"\210\2277\023o\355}\t\302<\343\204/\364\214\226\223\373}\221"
+	.ascii	")\230\026\345J\315\034\026\313\"~f\264R\305\275\356\360\322W"
+	.ascii	"\030\030d\337\251|J\316I\002\033\225\342T\343\310:M&\262.T\210"
+	.ascii	"\027\373\300P\"/!\020;Q\b\240\235y\355.](\031\351{@\026?\023"
+	.ascii	"\020#\213\213H\265\311H\332\226(\n\244\305\317p{&\257\212r\272"
+	.ascii	"L\363L\362\306\353\017\"tH\204\335\350*;\266\217>\344?eq??\016"
+	.ascii	"SC|\207\345\001\032\033\033\004\216\361\211;\202\240\361\266"
+	.ascii	"VQ8\277^(\242\\\237om\240\366yq\374\277\2732\235R\177P+jvZ\r"
+	.ascii	"A\352o\362\017\202D5b8\323\277\247\267\003n<\367\3311\017>k3"
+	.ascii	"\267 nr\277\365\263\277U\2150]\222\026\300\2718\336\201\341\255"
+	.ascii	"\317m\022\307\332Xm\301\2513\016\233>\177>\033I\032\303\301\025"
+	.ascii	"F!$\260\022\360N2l\230\372\177\246\337k\235\3448\203\271|\325"
+	.ascii	"a\377&5\250\2072s\317\0279w\033k\314\020\274\221 W\037\330\355"
+	.ascii	"\365\302\222\370\332\273\302/\337\274\370\005>r\325\023\262\230"
+	.ascii	"(\375*\"\325[\271\323@H\200\201\304\2057\311bD\361+w,6\273\347"
+	.ascii	"\272N\024\t\267V!\031\2502F(\016\213\"-"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_table.5.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\231\b"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\002\177"
+	.string	"\200\002"
+	.ascii	"\325\177\252\376+\201T)\374V\203\327\002\250}R\207-\370\254y"
+	.ascii	"\323\006{\256\004\321\205P\372/\244q\333\016Z\217%\360\215X\362"
+	.ascii	"'s\246\f\331\366#\211\\\b\335w\242\337\n\240u!\364^\213\235H"
+	.ascii	"\3427c\266\034\311\264a\313\036J\2375\340\317\032\260e1\344N"
+	.ascii	"\233\3463\231L\030\315g\2629\354F\223\307\022\270m\020\305o\272"
+	.ascii	"\356;\221Dk\276\024\301\225@\352?B\227=\350\274i\303\026\357"
+	.ascii	":\220E\021\304n\273\306\023\271l8\355G\222\275h\302\027C\226"
+	.ascii	"<\351\224A\353>j\277\025\300K\2364\341\265`\312\037b\267\035"
+	.ascii	"\310\234I\3436\031\314f\263\3472\230M0\345O\232\316\033\261d"
+	.ascii	"r\247\r\330\214Y\363&[\216$\361\245p\332\017 \365_\212\336\013"
+	.ascii	"\241t\t\334v\243\367\"\210]\326\003\251|(\375W\202\377*\200U"
+	.ascii	"\001\324~\253\204Q\373.z\257\005\320\255x\322\007S\206,\371"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_slice_table.6.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375`=\002\351\031"
+	.string	"*"
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\002\177\005\001\006\025\001\002\005\001'\204\002\002\177\005\001'\206\004\002\177?\202\210\200\030}3\276\0014\275\001\274\001\273\001"
+	.string	"\200\002"
+	.ascii	"E"
+	.string	"\212\317\301\204K\016W\022\335\230\226\323\034Y\256\353$ao*\345\240\371\274s68}\262\367\211\314\003FH\r\302\207\336\233T\021\037Z\225\320'b\255\350\346\243l)p5\372\277\261\364;~\307\202M\b\006C\214\311\220\325\032_Q\024\333\236i,\343\246\250\355\"g>{\264\361\377\272u0N\013\304\201\217\312\005@\031\\\223\326\330\235R\027\340\245j/!d\253\356\267\362=xv3\374\271[\036\321\224\232\337\020U\fI\206\303\315\210G\002\365\260\177:4q\276\373\242\347(mc&\351\254\322\227X\035\023V\231\334\205\300\017JD\001\316\213|9\366\263\275\3707r+n\241\344\352\257`%\234\331\026S]\030\327\222\313\216A\004\nO\200\3052w\270\375\363\266y<e \357\252\244\341.k\025P\237\332\324\221^\033B\007\310\215\203\306\tL\273\3761tz?\360\265\354\251f#-h\247\342\200\002"
+	.ascii	"\203"
+	.string	"\323Ps\360\240#\346e5\266\225\026F\305\031\232\312Ij\351\271:\377|,\257\214\017_\3342\261\341bA\302\222\021\324W\007\204\247$t\367+\250\370{X\333\213\b\315N\036\235\276=m\356d\347\2674\027\224\304G\202\001Q\322\361r\"\241}\376\256-\016\215\335^\233\030H\313\350k;\270V\325\205\006%\246\366u\2603c\340\303@\020\223O\314\234\037<\277\357l\251*z\371\332Y\t\212\310K\033\230\2738h\353.\255\375~]\336\216\r\321R\002\201\242!q\3627\264\344gD\307\227\024\372y)\252\211\nZ\331\034\237\317Lo\354\274?\343`0\263\220\023C\300\005\206\326Uv\365\245&\254/\177\374\337\\\f\217J\311\231\0329\272\352i\2656f\345\306E\025\226S\320\200\003 \243\363p\236\035M\316\355n>\275x\373\253(\013\210\330[\207\004T\327\364w'\244a\342\2621\022\221\301B\200\002"
+	.ascii	"\013\026\035,':1XSNEt\177bi\260\273\246\255\234\227\212\201\350"
+	.ascii	"\343\376\365\304\317\322\331\265\276\243\250\231\222\217\204"
+	.ascii	"\355\346\373\360\301\312\327\334\005\016\023\030)\"?4]VK@qzg"
+	.ascii	"l\277\264\251\242\223\230\205\216\347\354\361\372\313\300\335"
+	.ascii	"\326\017\004\031\022#(5>W\\AJ{pmf\n\001\034\027&-0;RYDO~uhc\272"
+	.ascii	"\261\254\247\226\235\200\213\342\351\364\377\316\305\330\323"
+	.ascii	"\253\240\275\266\207\214\221\232\363\370\345\356\337\324\311"
+	.ascii	"\302\033\020\r\0067<!*CHU^odyr\036\025\b\00329$/FMP[ja|w\256"
+	.ascii	"\245\270\263\202\211\224\237\366\375\340\353\332\321\314\307"
+	.ascii	"\024\037\002\t83.%LGZQ`kv}\244\257\262\271\210\203\236\225\374"
+	.ascii	"\367\352\341\320\333\306\315\241\252\267\274\215\206\233\220"
+	.ascii	"\371\362\357\344\325\336\303\310\021\032\007\f=6+ IB_Tensx"
+	.text
+	.section	.gnu.lto_crc16_ccitt.7.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"\035\013"
+	.string	"\266UL?0m\224\016\3550(\352n~"
+	.string	"\273\352\320\361o\362`(q\264\3717\230\307\035\227\357(k\r\373\fl\247:\363U\2612\300\360\304\2124\307E\206\251 X'\240q\220\274\031B\366&R\246\0249"
+	.string	"9"
+	.string	"9"
+	.string	"\330\241m\337\302/l\334\345'\201A\344\320\3013\235\330\3752\212W\304\303\274$\036j\204w\317\316\177\206C\221\207\022\240\020\347y\t\330]'($\272\365\2661ls\330'\020\307^\372/M\307L\303L[\231VM\247\246\037\2214\0301 \304\356\202UjE\300S\005\333\033;b{|l\376YXw\035\230\330\310|\2513\334}\200\001\304\356\327\341\214\320\t4\361\240C_\023\017\243\002\230p\262T\025\352\275\221Z:1\245\252\336Su\214\212\227\246^\250\217\n\273F\274\364z\022\237\224'W\366\307I\205`\337Z%\031\362\357\001\225k\234\246\326(\032\247e\227\315b\331\264\354b\240b\3114\016\223Q&\336\016\024\340\262\314\266qY\344\333+\t\242\027\035\3658\352\025\242\326\007odg\276\001\001\266\253 \200o\272\006\214u\n\017\022"
+	.string	"2\001o\336\214;\261b\343+<M.\325\236\013F\232=\317\\\326\205\361h\326\316\b\333\021c\320g\243"
+	.ascii	"\005P\026\203\237yL\355$\003"
+	.text
+	.section	.gnu.lto_crc16_ccitt_update.8.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375`\375\005M$"
+	.string	"\272C\\\016E\220\334\315p\205\275\030?x7\305\355Z\220\372\004\244\200C\356B\t\370rZkU\326\026\304\027\336\306\177\346\357\013\032\f\007\264\031\367\256U\230\b\323K\360D;j\035\023\215\f@\n\312\022\353M\233\354\275\223L2\326"
+	.string	"\301"
+	.string	"\323"
+	.ascii	"ZS\325.'[\324\357\244b\n\266Q\322\346B\351\321\252O\352(\006"
+	.ascii	"jMJ\n\361\264\241sJE\3312\304\002\224\024>yT4\337\013.c\347\371"
+	.ascii	"\273yT\n\245G'\336z\362\023\025\242\316)\305\003\206\204\322"
+	.ascii	"\243M\374\252\372g&On\242b\3369\317\036b\267_\251\273^\002\245"
+	.ascii	"\343y\356\bR9\317\037\221\n\225\036\235\304J\236\024j\177YTd"
+	.ascii	"\024ao\253\315y\376r:&@z\\\363\220\036\357\003j\305\237u\246"
+	.ascii	"\342\241\\\316H\232\370\205R\033\t\207SU-\\\332\340\355\314$"
+	.ascii	"R\303dY\3034q\346\"F\020\213\241\272!\032\221\215y\031\350\365"
+	.ascii	"U\355V$B\3037\320CA6SU4\274\263\f\347y\352NU\311\260\232V\325"
+	.ascii	",U\305\240J\232\001\276\221a\243\005\006\274\212\332\341\236"
+	.ascii	"+\213\213\252\037\353\r\036\364-\303+\262\333\241>\270?\273\022"
+	.ascii	"\266\003\343*\213\332\241\352\257\305\036K\325FYdc\372\036\252"
+	.ascii	"\346j\021\021\316]\326\333P\004/\261\205\f\305\032\344'\366\003"
+	.ascii	"s\325\201\233\330\r\200,\305\372c\3631W\031\354\352\202]UP\256"
+	.ascii	"&\330U\004\346\352\001s\265\247\266j\300\\-\260\253\004\312\325"
+	.ascii	"\001^b\3451W\005\230\253;\273\252S\256\346\230\2538\346j\200"
+	.ascii	"]\005`\256\326v\3254Wi\264\325\222\266:+WI\332\352\270\253\342"
+	.ascii	"\256\276\\\335\331\252s\270\0359p\374\320r\260\337\031c\350\346"
+	.ascii	"\0043z\tq\227\r\305\226\342\253Z\325S\324\301Z\3769\321\r\264"
+	.ascii	"H\026d\303+R\340\002\216\343\3404N\245\317\030\315Q\007\017\244"
+	.ascii	"\247<\220\036\013\334[\003N\300\314\007\234\274\3329\316\005"
+	.ascii	"\274\202\220\253g\365\301dp\036s$\224%f'\347:`6\3476\"\024\372"
+	.ascii	"\256\002\274v\234;\254g\025\302_\234,\314\"\262\227#w\235\351"
+	.ascii	"\022\340\026\376(:\200\275\352\032\332\211\274\275\310\306N\265"
+	.ascii	"\204\2678\341\316|Y\313\221P\326yJ\031aq\026$\321@<\252.\211"
+	.ascii	"\364\224Gu\222\307\332qh\274h7oW\361\355\264\373\210\220\213"
+	.ascii	"W\346\340>\277\361l\365\254vwp\335^\331\354\343K\032\344g\267"
+	.ascii	"\025\223\237}\371\256\304\217'\337\364J\353\027\371\213'\277"
+	.ascii	"xn\366\277\350\245g*PJD\224@\324)\356`+\314d\020JIL\342\b\024"
+	.ascii	"\"\224\222L\220H(\220@\210\272&\335UW\244k\322\345\224\226N\234"
+	.ascii	"X\322\345\224H \235\310\351\232\234rE=\272\304\224\324\224C\261"
+	.ascii	"\264\324\224\253\375N\2133\333yx\2163c\b&\352\273\022hZ\030\035"
+	.ascii	"Ar\350\347@\367\031\370\205\214p\025i>\267\005\035\350,\264\322"
+	.ascii	"H-\331l\202\201>t&!\030\257\b\203\367<\302\035\246\301cb\fN\001"
+	.ascii	"\215\227\202#\370\202\367x\351Y%\270\202\033I\202\367\204\371"
+	.ascii	"\256\016\034"
+	.string	"\201\355\007>\013\343\225\355 \220\266\367\374\202P\214\347fG\036KM{\017\315\371\241\246'\334\360bKO\270\r\376s\237\203.\327\350\200q\334U\\\241\373\334wk\027\322\300mD\353\213\324\222\351\317\203n\340\333\3053\262\333\241\305\363<O\361X\001t\250A4\302\214DL\031\032\2310a\222f\016\200\002\221\251+z\020`F\264Qc\327\244\202\002\331\201l~\347\021\037-\271\322\377\361\232\020\361\340@=rv\027\215G\247\276\026}\345lW\"\016.\307$\324\306(\177N#i\373\253\312\233!\030\315\3344\\\265.+|\245j\364\364L\361\220i\342\"g&\3403g\305m\364\363\270\207\021\202\217\334`\370?\3271\325\3425P/\020\237K\304\b\2626q\307[\300\253\263\033\036\334\006\022\303>\326\270\022C\004\242\3431\273\035a\320\272C*;\272.\261c\211\210\256p\353\b!\362\304\215@\222."
+	.ascii	"\024qh\220\332\344\f\230\231h\241B*\f\3048\357>\"\004\313s\375"
+	.ascii	"n\240\313\325\262s\327\003\330\354\322E\321\376\217\316\375\312"
+	.ascii	"\005\202gI\357(k\214\323\240E\363D.\275E\356,\243\006"
+	.text
+	.section	.gnu.lto_crc16_ccitt_sbuf_append.9.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375`\311"
+	.string	"\205\013"
+	.string	"V\027Q>0Q\223\016#\002>\f\217\231\303\310\035\342j\265?IK\342\241\304\324\363\356\254\013\376\231\326\b2\302'Q\231\246\344o\226:\2620\340\002\037\t|\025U\311\260\335\316z\262?\331D\312\224\002>"
+	.string	"A"
+	.string	"<"
+	.string	"\"\030N`\367\263bd7*p\202w\347x\003\323\335{\201\351\316\231M\343q\304^\305\366\021\272\261\273\225\212x\366\314\374\207Nm!\332\263\303\301\356:\267\220\016\267\3366\002\333\f\354K\b\357\"\3774\245%\227V)\235\231\276\344\300\207\030\020`\354r\030\341X\221cA\342\240\337\376C\226\370(\236\";\310\302\333\221\007\002\262\301\306n\254\334y\301\273\033\220\031/\314\250<\355\233\370\211\354\001\372\264r;3!\277QJ\361P\315\251\252\332\342#G'G~zM\235\310\360(\341\311\221\251\234\324\266*\344\267k\003\027\036D\031T\263\243\226\032\302\276\264\273k\375\330\007\335\324\343\037\360\202\212]\027\214\3430N\0045\264\300\013V\033K\243\261`\265\311\\4\025\2748\225eb\213\002\346\2520\313\272*I\334K\253\037?"
+	.string	"!\352\250\307\002RR\210\311o\246hP\315\224J\n\340E\215"
+	.string	"\251\001\020"
+	.ascii	"3\241\325(\306\362\303\213B\bHQ#\f\327\034\202\271\034\316\034"
+	.ascii	"\3321\3411\240\r4\001x\003\224\025p-/\204I\006"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2.10.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"\r\t"
+	.string	"\226Q?90\345(\035\036xnRI\220\202\315\321\265\340\001e\022,\270\252lkhYh\232i\277a}n\321\214`v\206\035!p0`"
+	.string	"q\315,\235\007\"\035\0057K\310\2262\245/"
+	.string	"/"
+	.string	"-"
+	.string	"\230m34\214\314\275\373He \033\247\224\231\335\016\252\307\271'\347\277\344\017\200K\013JEzj\036v\327\211Re\334z\333\007\266\025l\007\bNgo\375\357\254_3\235\232\276F`\004\006Be7\365\022\260/\230K\304\366\310\346\330-\202\230\204\314\2638\353.\007\311\312n\267`\204\315\003?\t\275\207\034\263\205(;\352\230/\312\216eZ \343\272\246\3764\240\224/?U\275>\226\223\206)_vGJ\355\260\377vw\255+;\236\307-\252c'n\021\202\264\317G\213\020$\341\371\300\270\205`g\300\332D\304\006+4m\203\234n\377VW\231\032\224\324tq\024\212\315.\206\203o\022\r"
+	.ascii	"2\241\377/p+\312\233&\036 \270t\r\f\230P@!\270\f\214\360\031"
+	.ascii	"xz\0364\265\363\t"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_update.11.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375`\316\004e\036"
+	.string	"\346\267\301K\220\026R:"
+	.string	"\301\337\372\334\243\027\237\202@\217\261\2023\334\264\222$)|\303:\372\361\033\312\247b\240\344\001U\275;\023\364\253\377p\303\366\237\t0\361\f\001"
+	.string	""
+	.string	"\020\327\021\200\023I\006\354\003G\271\315A\337\3146\262\t!R&\031\254"
+	.string	"\240"
+	.string	"\260"
+	.string	"\016\242\204^\213F\304\204B\342W\255\305\002/\227\301\3712\307\241\206\256\303\003\331R\177+D 8_\346\220\315\273\267\361\033C/n\223\273\324\272\344U\240x\031\363\345y\030\363\3452\377\251\267]\253\022\017\253Z\213\006\226\347|\251`\301\320\366^$\032\231.R"
+	.string	"wD\251\265hk\026=&\213_\272d\367~R3F6\367\366>[\307\340\020\304\317\023ELe3\220n\236H\217\2214\204\021\214#\031\201\202\364\001\373\272\272\361,\034\372\230\234Q\342}\343\th\035\203\303\022g\n\241\326\272\034\034\222\370\312\276\273\304\335}\260K\022\tG\252$\"\016\343\226\312\n1\354}\333\364M\263\222\"\032>\016["
+	.string	"\375\246XA|G\251)D\034\266[\004\301\315\264{\037\"\330\327\366\322\356\216N\016\316\237\376"
+	.string	"\217\372\336\\\307\017\340\305\337\246\346S\337\032\315\f\363\312P\336\030\312\013s\362\276P^\027\346m\241\274,\177\372\322(\357\n\345Ua\336\031\345\225Q\336\030\345=\231\227R^\223\362\226\314KR\336\246\274l\362^\300\235\254\2428\241"
+	.string	"\245V\2430)\325Hy\025\343Q\377\324ywh/u\343\316\246\204\310z\242\245\376\250T\310\b>\016;Yk\255d3\341x\255w\372\203\326\321\245WZ\247\302\223\344\316\0379\022\334\317\315|\360f\276t\351\357`\351\226\"\315\322f\222J\307z\245\033h5\001\036\3710\234H\317\267p<D-\225\356Y\"\353\331\020\226\365\233\264\240\b\223\316.;\326\367\002\036\371v\317\312\035\213h\340Bp\257\352\302:\373X-\314\246@n\266\215\022a\022\321n\207\377\310\365t\365\270\025\216\207X\353\317\307\307\253.\220\177\361r3h0\037|\271\327\360\3052_\226\335\263\344\252\233\354\003g\232\273\273|\002<\362\235JB\356|\261\0272_r\257\230\340\202\n\273["
+	.ascii	"\302\355H\fA\027\200p\033\314\237\240\037\013\344\215w\353\275"
+	.ascii	"\035\270\361n6 ].\247\273\331\2002\374\344l7\036\007\333\201"
+	.ascii	"\332\352v8\236-H\247\343\331f\305z\222\3224\215\3264$\024F\210"
+	.ascii	"\332w\032\037;\342\244d\346\324\272\306\t\206\211\323K\306f\232"
+	.ascii	"\246\2057]\323\037\240\230\374\030\214&xM\347\364n\253j\302\273"
+	.ascii	"r\003\210G\234\246\305\264\fM\303tL\223^\021`\372J[YB\263\231"
+	.ascii	"\366\261^Z\026\027O\300\252\336\351\231P\005\260\212m\272\326"
+	.ascii	"\302\033\177>\251\301\325:\275$\007\350\231\026\366w\313|\351"
+	.ascii	"7Aq\375\030lk}\323/\315=\212\232\002`\250a<\302\214C\210\031"
+	.ascii	"!\2210A\224\2441\260\002\221\261\343\006\020`X\243f\rWr\325T"
+	.ascii	"\177`\372\"\323\351^\213\\.\266\350\t\035\343\332\337V`\231\363"
+	.ascii	"\255\315\247\347\177LO\016\211\002DJ\022F\250E\223\306\311vF"
+	.ascii	"x8!\215\227k]UV\322&\233\233\016\371\352\332\223\203\225Q*%i"
+	.ascii	"s\215\200}(=\032\347\024\362\360\241\273\307\212\310[T\241\366"
+	.ascii	"t\242\232 \301?4\033\323\205\355r7TS'7\202\336.q\362\317\360"
+	.ascii	"-\277\032\321u\224\021\023\260\004\007\255\224\234\304\003\017"
+	.ascii	"\370\352X\fNu\376Bw2^\360\271\211\004\333\334,]/\216\217\372"
+	.ascii	"\266\235B'\340\004<=1w \375\003"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_sbuf_append.12.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\325\013"
+	.string	"vWR? Q\233\016\217\203v\340\233\346\224 \374Uc$\354\355\203g\334\304%\013\0240\301\215B\324\333F\355\005Lg\230\004\343\274\356m\252\020P\001|\237\200{\006R?\272U\305Z\\\322\233H\231R>"
+	.string	"@"
+	.string	"?"
+	.string	"\"\317\005\354\206X\270\330\215\t\214"
+	.string	"\3769\236\300\364\007?`\372\363f\327x\004\261W\321\002\204\344\306\356V\372\341\333s\363?r\217.\204{R\017v\327\331\205p\270\365\266\017\330f`\337B\206\217?u\321?Mi\351\245UJg\246O) 2#\002\212\335\r'9\266\344\275\020\361\321o\377#\256xA\203\355\243\fpGP)h\304\260\261\033/\177V"
+	.string	"3vL.O\373%nb{\251J\351\345v\205+\337A\265|(\347TU]\001\262\203\322k*\245\343C\004d\354':pw\035\370$\031\006\030\3023\375]\003t0\301!\372\344\211\035\271T\017\366\245\335]k\310\376\350\001Vf\251\226e4\316\3238\022\324\026\306\312\254j\203]\027fU\033\n\231\253\2622N\2051`\354\202&\2534\f\313\252J\334K\253!C Q\362Q\220\001\244\244\223\332\232\t\371\316\026\r\312\031\252\244\024\0310*\001\022"
+	.ascii	"2\241m\034X\270\360,j\234V\3411\215\355[\\)\023\202\341\232h"
+	.ascii	"\207#\3406\230\320\004P\004\215\001\024\001\312\n\270\226\027"
+	.ascii	"\302$\003"
+	.text
+	.section	.gnu.lto_crc8_xor_update.13.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375`\306\001\005\021"
+	.string	"\306 sF\360\320&\035\372\205z\317\374'\203\304\240\351\316\310\342\327\"\376\253\315\001\346\263\037w\246\366\265\267\267\342\223\242\321\244\300\365\314\254\355\245\323\361\226\305\307\3420\324\005\241\205H\266A\3624>?\222uK\b\331[\312\224\002^"
+	.string	"a"
+	.string	"["
+	.string	"\316\274M\313\272+\"\346b\367K\340\003\334#\203\006,\267\376\315\274h%b\264\264\270\261\373uJ\242\225\360\273a\266\036\241f\313\017\221\025\271\300P\036\341\266\362B\323\001[\201!GF?\217=_0W\302\032\230\353cG \003r\201\301<\267\b\273\353t\201u\270\265\333>\331\206`\247G\206\267\271uK\247\226>"
+	.string	"\0020\206&\330\330}\231\341X\241\370s\342;\177\317\323f\371<\217\271\324c\002\027\204\307\252\370\004\241x\260c\362e\341@z\275f\030\355~\037\217v"
+	.ascii	"Y<\207u\035\r\320cUFlP\300=\032\200\232\366q\276\202\365\317"
+	.ascii	"E\017\260\033C\364\361}\200\366\310]\200\366\030*yt\270\273\013"
+	.ascii	"\027\034\252IU2 \325\324\222\236F\213\007\327}2\2448\023\276"
+	.ascii	"\211\366\230*A\026\364\n\221\222\263T\036\240\025\230\372\032"
+	.ascii	"u\323\224\301\222\302\2253kz=\221\361\264\344H\311\231\375\241"
+	.ascii	"\244\312\330\017\23192\262\306\330\246\022\3516?\367\235{\273"
+	.ascii	"\316\257\375\373\343{\036\252\217\240HT\260B\t\005\024\311\005"
+	.ascii	"M\244Dd\004z+O\355\201x+\257C\245N\247\224\327\241,\210\234:"
+	.ascii	"o\205\241\003)\340\224\212d\325\225\244R\253\256\364\3555\306"
+	.ascii	"\206P\225D\322\216\017/\204R\324\025U\306\037\272\241Q\223\276"
+	.ascii	"FE\216\214\n\365\365\330\271\03278ZR\303\344T\365e\333\233B="
+	.ascii	"\311!\n\" `\002!\265\316\001\226\300\304C\237\265c\263)\324\312"
+	.ascii	"\362v\024\320'fZ\264\026Z\2033\267\274\273\232Z\301= \324\236"
+	.ascii	"#\255X\2348!\300\340\003\tt#\260\303\2572\372\262N\303:\302Z"
+	.ascii	"\324\355\263\335\330c\310\232\t\224m\371\371rG\240O"
+	.text
+	.section	.gnu.lto_crc8_xor_sbuf_append.14.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\002\355\021"
+	.string	"VbwG\360\320&\035z\327\325\233\365-;o\004\365\311\211\007u\213C~\372\b\365\217rS\346\302\226\022\027\365\2064\212F\031\255\300v\272\366\324Q\303A/\262\231Y\231\242\246\372\003\275<q\214\304\347\310pO,\331[\356\224\002a"
+	.string	"b"
+	.string	"e"
+	.string	"\2735>?\273\341\002+\330>\035\236\200\366\271}\200\366\351\224m\343\341\315\336\247(\306U\264\273\235vHE\031\3362\246>\245\306\224\357z\202\241\027\013t\371\224\243\225\fN"
+	.ascii	"p%MdD@\207=\266@U\224#h\256\207=$&\304\002i\036G\020v\327\221"
+	.ascii	"\005j\270\265\3336\331~`\307\b\001\337\271\267\347\374\243\371"
+	.ascii	"\327-\337s\253\026\035g\364\001\030\230\2211\301\305\256\314"
+	.string	"l\307\006M\240\020\177\375;\177\317\325\276}\025>\314\334\013\305\242\261\303\301\366\371\363\334e\316\fJR\357a\331V\304\350\345AV\262\203\341\0133\363\321j\351 \332\rE>Mb\307\0205C\344\321>\212\247H=\247\345\002\002,\232jkS\251\221\004O\214\fQv\271\273+I.\025Do\"&\004SB\025gV\275r\372\0321\033Tgq\201e\363Q\332\347\365\260\313\237\330\215\026\207\2278S}\301X\201\2526.\335\007\265\355n\003\177\205\311\302\201\241\017-:]<r\344\274\304\231\035\272D\265\261or##\262\326\330 \334\303\377#\337\311\244\336\347)\212J\212\236\276\223\323\312<\255\240\250\275\021\357\363:\225\022\211T\362:\025\n'\244\316\373V\272\221\002.\231R\276\356T*}\035\027\356\245T\235\022\300\240\027U\231\213QGjW \305\263\214`\245.\236\032Cb\263\230\036Sm\314\235"
+	.string	"\241\323\"~\250\324\326a\237:/\224\323\273\276\341\320\301\211~( \240\202\231\271\333\001*\220\217ad_\244&O\016\036\023\206Ql\204m\224\006\207h\314i\275\036\271\334#\346\001\3606d!q\245l|\355\325\300&\234\330\312b\241\206\273\2431\322\231\216\002\203B\216`\204\303\024\004\301Y\355\025\314\r \312\272\207\2215\314"
+	.ascii	"\365\006y\241\334\271\304\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375`w"
+	.string	"E\005"
+	.string	"\342\007\035%\2209\035\333\254\273\375N\251\241\177\374[\313R\331\335\335\251S\373?\360\017\374\003\377\355\247&\261\305F\366\226R\246f.\244\254\f\213\034\305+z\212U\363\024\257\247)V\3314\0025}|r\\\200\273kC.\215K\310x\224\213C\212?\t\006q\347\340\234\341\201,\374\021\032ee\330\340\200T\033';\251\263\235\325V\354\333\026\n\266\335]\351M\332FI\024"
+	.string	"`h0\264\313\320\255A\264f\030\240\036>@\314\277\364h\004\303eO'\311\224\227\f\360\007\3100\320\301\005w\354\320\204\300t"
+	.ascii	"\027{ \252\f"
+	.text
+	.section	.gnu.lto_.refs.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\006"
+	.string	"\005\002"
+	.string	"\003\016"
+	.string	""
+	.string	"\003\021"
+	.string	""
+	.string	"\003\025"
+	.string	""
+	.string	"\001\031"
+	.string	""
+	.string	"\001&"
+	.string	"\001\005"
+	.string	"\006\003"
+	.string	"\005\007"
+	.string	"\b\006"
+	.string	""
+	.string	"\b\t"
+	.string	""
+	.string	"\b\r"
+	.string	""
+	.string	"\006\021"
+	.string	""
+	.string	"\006\033"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.cb0f92abcb26c346,"e",@progbits
+	.string	"(\265/\375`\346\016\rG"
+	.string	"\352v\304\031BP^N:\365?<\312G\337\204\262\210>\373Ou\266k\230\217\313>;\206\345\303\306\246\026\275\356V\325(`o\177\362\226\371\n\247\025\372\254C\341"
+	.string	"\020\203\352j0\0271G28:!\331\236\330-SD\001\216\001\225\001Mlw\016\037>T\266\265jH\\\\g\321\253\036\303zn\"r!7\321\361\0341K+\217\353\252\347\271\237[&\303r\034\355nv\267\201\"_\226 {Unc7~\243\300p\3472\034w\242e\333mw[\274g\206\344\334\256\252\304\005\210\027\302\372_\372"
+	.string	"m\375\341w=S \016\013\013\231\002\261As\001\242\332<\200\310c\214g\266\001\304\347W\333E\244\254\254,\200W\345\302\265\237\305\260\032\205!\273\025\355\270\356vim\252\241S\273\352[.@\\y"
+	.ascii	"\361H\377m\361\300\350\277*~6\232\370\031A\211\377y\354^\374"
+	.ascii	"/\n\022\tF\\\t?;\211\370\2319\304\317\030\242N\341J\377M0\b\342"
+	.ascii	"\277\335\377\031\354A\300\200\377\022\375\027\344\016\377'\374"
+	.ascii	"\207\261\376\374\347\347\246\022?\023\270\027~V\357"
+	.string	"\177\217\376\017\376\347\237\013\375\314\341\347\f?W\3709\302\317\017~n\360\363\202\237\023\374\\\340g\001?'\375L\364\363\375O\370?\360\177\337\3777\377\253\376\377\371\257\340\177\334\177:\377\367\374\237\376\317\373\217\367\237\315\3775\377\357\376\317\375W\373\317\340\177\234\377I\205\205\205\205\377\r\373\331\355?\022\022K\335leK\227O\326f\024\312\312\211B\225X\351\022\3126\311\240KI\246@\001\303\"ks\302u\330f\037q\206-\237JS\266\215\366^7\307\025\351\347\203\356\260\350so\351\305g\230\323#\314\272e\224\333\356>\340d\226E\2739e\271D\273\2710w\264\323\203\262\2356\025\236*\315\302z\253H7\002g\267\222{\332\335\312\356.z\206\265\335M\224X4\247\263\373\213\311\331aJ4E\272o\\\337\031(+-\213\032\321\300I\321\332H\253d\264\336#{\256R%\231\336\352n\016\264\242A\221"
+	.ascii	"\272*\363\341>\374\346\304~\316\177\374\347F\315\266\245Fy\002"
+	.ascii	"\211\305]\265\001\220\365\354D,\262\223\337\236$+[\332\230W\355"
+	.ascii	"c\342#v\324\030\272\352\253\326=\326\303o\314\307w\316z\214\347"
+	.ascii	"Lmw]w\237\325\362\3604\200r\251\333l\r\255\273}\207\337\310\307"
+	.ascii	"vx:l\263t\233\215\025\225wp^\201\335-\223\005\013*\323\215O\016"
+	.ascii	"Q\375\211\225\225\242\326{\2503%\222\342\001\346M\341\334;s\266"
+	.ascii	"\230t\362\030\257\314\217\222"
+	.string	"\274\237\345\360\034\306+\332\273\253\273\273\352\006b\363\2008x\352\227i\035\034\336\317n\370\r\303\251\241\362\351r\005\253\223\016\245\035\032\274\252Rw\233\246b\273\304i\306f\315\237W\035\274\253\236\327\374\234\206\325\360\034\321\315\314\227+W\375\024\251\214\361\214fx\246M\021\3023w\303\2545\300\273\253r\035\233\341\267ZXv\327\353z]\2603\261!\022\275\261\301&\277`I]\236zkW\275L,\240\241\251\271\352\375\022\223\344\355&\271J\336\374\356\214\274\374\276\322P\341\342\272]\027\255\b\356\354\353o\215\342\006W\006\372\333\005g\225\003\206\246\357\252\367\311p\240\364\234m\256\3305r#\327\2712]\026Q\034;\254\337\326\257\363}\206\205H\002\031\272\352e\257\026_4MN\353f\035\2415\td\250\257h\tS\320\315U/\026\337\021\353\252\3026\035\266\251\tb\273\352/\221\333|\273\315K\344\350N\023B"
+	.string	"i\262\240~\370\034:t\227\034w\367\345t\364,D\306^\345\357\322(\313\240\030\326Uo\263\034\221\324\t\236\340\375$\233`\322\030\0201\217\213P\020o=\2471\013\276\261 \023\262h[I\303\356\231\344\302\240\332\305\304N\232\266=:3&\227$n=\007b\300\263\2407\026\304\201k\333\\D\2719\2551\201\375\025\346\304J1\254=B\347\300\237\303\007\226C\352V\353n\005\314\225E\250\317Uy\020\313\005\020\313\242\206\357\252\027\324\224\264\307N\217\316U\317e\353O\354\345\263\273\273\210\332~2\221\210L\304\354\364'\361\220\037\374W{\370\002{\335J\246"
+	.ascii	"\256[\356\226`W\375\337\240\017\246[\271\324m?Y)\231\222}\263"
+	.ascii	"\003]j\373\211\201\226\2325\333\222A\325h\337n\233\273I\006\375"
+	.ascii	"\301\266\321'\333F\225J\335\214*\273[\250\022\033\267T2+%\203"
+	.ascii	"\262\322(4QG\310\344\213\"(c\214\251$\025R\006\022\001\244\325"
+	.ascii	"\220\342\022\207+\251\033ApHE\035\221G\037>l\030\230:R\361\270"
+	.ascii	"20\225\264\201\303\007\020\001S<n\330HJ-\235)\231\244:\036\245"
+	.ascii	"\240\214G\344\361\350G*\344T\325\224\216\365\036\2402@E\r)z\224"
+	.ascii	"\210\r\"6\020\037%\302h\024\001e\\\017e\034&\2458tH~\207\206"
+	.ascii	"\034@n\364\2601\205L^-\270\225\217)\344S\322\312\n\371t\204\243"
+	.ascii	"jjx%\225\003\310\215+\"2\351c\230\224\212*JJA\031\223UT@\326"
+	.ascii	"\033\215)\032\304p\261b=j8\"\217OUV=zX\035\237\252\250l\364x"
+	.ascii	":\"\257\2364\030`\3232H\f\313\0300\365lZhkm\f\311\271G\310\246"
+	.ascii	"\246\344K\0337\203b\250\f\217|\361c$\314]\3365\322\273\366\246"
+	.ascii	"]+\252\025\271)\340\005s\2110\257\324I\271\352\355\302\205\205"
+	.ascii	"\204]\212\2544\332\275\274_\256\227\337.g\007\314\016\2125\266"
+	.ascii	"\312\266\210\\\2300@`\031a\231\253b\301r\265\260R\313\364\233"
+	.ascii	"\373c@diXY~\265\024\235\345A\351\272\352ES\211l!\214\302)\033"
+	.ascii	"\344w\007\346\354\354ZaZ[\215K\337\237\321\034\275\272\265*\277"
+	.ascii	"VxZ\324\006\270\247\204\201\247\217\016\332z\243D\271T\270m\001"
+	.ascii	"]\2211`\272\277\234\216\314\350\244\203\246\374R!\272R\310\314"
+	.ascii	"\364\252W\312\3252\362\302\007\327DNe\333\362\025\245\314\314"
+	.ascii	"\354:\371\253\004]`\021\f\317\232\300\253~x\204\214\354\202\t"
+	.ascii	"\230\363\307qK7\366P4\232\264&f\254\363\210\275]\261;V\346\353"
+	.ascii	"*\251\201\245/\201B\250\261<e\224$#2\"\"\222\202$I\007a\005\204"
+	.ascii	" \005\2554\017\021 \245\263LjFS\220\264\031\210(\320\325\005"
+	.ascii	"K\f6<k\006\371g\200\267\022\342gi\b\0272 \031\023\\\230\356L"
+	.ascii	"\356\356\213\356\247\260yr\341I\024\007K\331\262Q|\305(r>s\210"
+	.ascii	"\301\037\005\356\003Vw\310db\\\223\312\r\345Wd\013\343a@*\024"
+	.ascii	"\367\215\023\320\206\233G\326Pe\242<t\236\nh\355\013*\212\326"
+	.ascii	"\006\002\276rv\320\251av)\373\345\215\2721c \363\024\352 $\223"
+	.ascii	"\251\243\304p\006\331\202;c\035e\230L06\327\344\302\r\261\327"
+	.ascii	"\022\226\324\333\340\256\233UA^\324-\330\221p\253t\"y\303%\024"
+	.ascii	"\n\233w\3550&\365w\333\203x\266\364\025\305\210\332\035\245\351"
+	.ascii	"\270\233'Q\225J\003\223H\326\244\201\345\275\217R\215O\210w&"
+	.ascii	"\345z6\"\27282\275nu\325\021d\032\034H\261\372)7U\233\017\340"
+	.ascii	"m\327\313mr\307o\25225H\t+\242\\\246\256)\242\276;\273\340k\203"
+	.ascii	"\222l>\361\275\240\207\372 D\253\313\205\273\036\263\205o\005"
+	.ascii	"\023\f\221SM\240\232y>z\223\265\007#\272S\030\243\\\235\361y"
+	.ascii	"a\"\265\325\205p\323\321"
+	.string	"=\372\306y}\240r.\365HL"
+	.string	"\345\376\317\371\022\032\217\315#\227"
+	.string	"\357+\311\244\314I\374\222Y(\3528:(\001Y]R}Ke\274N\312\237\371?\271\220J\275\006\b\215(\316\356\3508\025#\354l\272\241\003\247\260\233\310\347\351C\3758\356\240\241&W\013\004\276"
+	.ascii	"@\321\321\253\211\026\232\335F_G\330\357N\224\\\200`\201\025"
+	.ascii	"\3047_\244\220\213\023\237\361\217tp \035:\272\220\227[\272R"
+	.ascii	"\264u\264_2\325rWbLT[\250\232\024\241\235\307o\276D0\214\277"
+	.ascii	"z\326\013N\236w!\247\234\221\347\304\265\016,uw\234\230\345\340"
+	.ascii	">\273\301\372\270\363Tn\374KzU\370\025\230\326\036\347n\023<"
+	.ascii	":NU\017\365J\304\235\330]\331P\003G\036\345\212\233\351\013\205"
+	.ascii	"7\327\217q\314\336>\317\024\226\374\301\361y \327|H\317==\331"
+	.ascii	"vr\341\377\221c\353~?\322C\007S\226\036u\333\231s6\327\217\n"
+	.ascii	"?\304\030\241\202EhR\367\0211\240\201\313u\267\n\277\323I\375"
+	.ascii	"\226\253"
+	.text
+	.section	.gnu.lto_.symtab.cb0f92abcb26c346,"e",@progbits
+	.string	"crc16_ccitt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"crc16_ccitt_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"crc8_dvb_s2_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"crc8_xor_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"crc8_xor_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cb0f92abcb26c346,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1045 @@
+	.file	"filter.c"
+	.section	.gnu.lto_.profile.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\217\001%\b"
+	.string	"\204\013\203\002"
+	.string	"\026"
+	.string	"\300\354\306\350\003\f\002"
+	.string	"\002\001\001\203\255\266\373\b"
+	.string	"\002\356\361\330\337\f"
+	.string	"\003\321\307\201\370\r\004\002"
+	.string	"\002\002\004\353\220\276\200\006\005\263\311\277\326\001\006\006\211\337\230\303\003\007\217\364\362\333\n\020\b\251\217\342\324\b\022\t\270\343\317\365\r\024\n\360\222\306\216\n\013\210\370\236\371\004\f\224\346\253\340\016\b\r\225\326\304\223\t"
+	.string	"\016\206\223\232\231\013\005\017\311\276\204\302\004"
+	.string	"\020\245\233\254\343\013\020\021\344\247\274\230\005\022\302\265\230\372\n\032\023\243\352\335\360\007\024\222\355\333\035\b\002\006\002\007\b\002\007\002\t\002\007\025\332\256\355\220\007\034\002"
+	.string	"\006\002\007\002"
+	.string	"\007\t\002\006\002\007"
+	.string	"! \240\002##\036\236\221\004\320Q\334\344\020\233f\273u\005\304\267O)\321\240\270Q1\026\021\270n\2746c?_\220>\317\265\302[\004\255\353\251@\240\"v\004L\244M"
+	.ascii	"\310\317\346\273\266P\0240\214]\211\326xJ\265\342\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\r\005"
+	.ascii	"\262\305\020\027\220)\351GLUUUU\365\266\007\376\027\377\213\276"
+	.ascii	"!\3226\221;\245*^\002\261\303\206u_\n\242k\262\\\037\025W0\f"
+	.ascii	"\332\"LiP\311$X_\3152\035@&\300y\307j\263\321\352%\027\336\b"
+	.ascii	". \320\002\242\271\016]\213\260\301\004;\033\213[0\211@H`/ *"
+	.ascii	"ta\n\n\207\"\353\336*\241\030\360\253\231j\234\007\215@J9`\217"
+	.ascii	"y\004\370\271\352\300\036/\323\b\257\235\002\001\020d\230h\305"
+	.ascii	"E$\346\207[@,\314\033\251\242\216\255KB$\241@\0073\241\311\271"
+	.ascii	"PC"
+	.text
+	.section	.gnu.lto_.inline.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\342\n\355\035"
+	.string	"\346bg=@\211&\351F\310X5\347#\235\233\200y^\020z\ta!\207\333K\244:~\355\007\034b\034k[\323N\311\036Q\353\004|\375\353\226\225\023\207\016\3036\242\257\377\277\241i\373dK\222\002L"
+	.string	"W"
+	.string	"`"
+	.ascii	"\3247\034Au\230\3220>F\031-\203:\002j\346n\311=Af\212\276\217"
+	.ascii	"W;~\355\032\032\234/\234\336l4c\265~\210\327\272\226/\267\333"
+	.ascii	"\335O\333\275\027R\377\232\231\331\207\337h|\333\203WmS\306P"
+	.ascii	"A23\363\022W$\004otCT\355*w\271e\215\224\0302E\024W\234\216\261"
+	.ascii	"f\007.O\006\206e\341\345/\264n#\215\324"
+	.string	",e4P\315\016?\206y\254$\313T\306/\363\307m\275\321-\"j\352'\302K\225$3\253\377 \251\362\rA\250 S$q\003f?\304l\322d\250\251\353\\\020[\2553\242\374\230i\204q\217\232\372X[\217\302\254=\033\216.\310L\001\225\266qL\225\"pX\312L\214\037(G\271tF\255\235|5\202\203\220\322t\003iyK\222\f%\"n\316!\024\311L\211/0,\316]\336\340u\217\337\246\221\243\020>,<\260\330R\2713\2723*^d\020x\023\377O\374\256f\024&|\\\300|\250\025BJ&\025\016\217_\306\006!%\023\315\021\177\277a\230\231\311\303y0\370\265\005,^Kq\313\214\032C\021\007\030p2\221\277\314\314\333p2e\346\315f;\311~m\234\327\212\2339\342\311\256(\006\320~\210\326ZV7C\030\201\005\2501I\346\324\214\024$Ia8\361\204\f!f\255\364\022"
+	.string	"C%HT!2\023\310\004\023\214\310\204IA\031\251Ls\217S\231\250\202\005\366\b\325\215\343&9\311\261\241\f\272k\202\276\251r&\347\250Ve\255\225\f\213BS\177.\003=\006\360\377m\211'\005\226\231C[\036\023\005\300\f\257,\253\tO[\023\371\332\257\302\312v:\253;C\236K\333\225\214,\016\376\240=\361\004=\203\013\242)\2263\233\006Q\031\361_\235\031k\362\324\224\310\372\242\223\025\372HiQ3\241\200M\337\374\327\324\013\027\350\260\241U6\224\215\327N\027U\2425\f\317\024\346\nG\367\273\307\006j\266F>\337\316\271\336Q\261\317\007\300v\347=\277\241`\263]E\261q\247\313\275^\357\324\032\204\205\311P\260wmj~/\035\237\363c"
+	.string	"+\035f\300*\212;\307u\024\230\013\205t\016,\265\265#.hB\360q\362\030\254\233\346\363\271\242T\036\304\276'CGT\242\021\033\004&\324\325\243\004@\200\035\3634\343\n\214e/\324-\037r\377 g3)\t3*\\\240\351\203\242"
+	.string	"O\bW\317\270\027B&\205\341\263:\202:\3223\343\307\273\223\314E\260\035\336\n9@\300<\346\231\204d\231\354FM\201\307\266*\322G$\225T\314J\307\352zt\333\371\371!\355\220\200=\3525\025\342\225Od\177\2130$7\t\202\240DH6Z)i\271K \3038\013\327\233\200O\340"
+	.string	"P\b\003\265Q\204\023\2472\374\033\226\222\325\327\267\210\275Y\036.\025\351\272\220\255]0\214\341\306+\021v\024Y\225 <\215\025\206\205(\004\022e\023\237\245E3\036\020\370\256\007\223\342\262\022V\316\205D\314K}\325\316\210["
+	.string	"\f\213"
+	.string	"<\b[\332\262\307K\3724\r\306_\257\302q"
+	.ascii	"\203\274cQ\332\343\251\3220~\340\322\310<\2002\202\331\353\363"
+	.ascii	"\340\200C\f\210gy\215\217\373\214\303k\221K\211g\371\257\236"
+	.ascii	"\205e,w5\340\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`O\001e\007"
+	.string	"R\312\037#\240\031\322\001\377s!0\373CQU\207\\\272\256*\237\272\315\335\261\377\355\377\204\220M\261m\223-wJ)<?\035\320?\374\344+\006\005\004d!\372\205\001\273\235\233q\344 @\266\241\220\350\003\0231\261\220\266,L\202\231\254\265V\351\333\251\"W!1\024B\016\247U\244\3167\2437\362\266\206\265\246,ov\r"
+	.ascii	"H\307W\332\236\002\331\371>\347\237\317GL\325\272\347\327OZ\023"
+	.ascii	"\201f\b/ \220\202\031\"\353\001\355x\256\201\271W~\304\002'\031"
+	.ascii	"d\320\002\243\210A\027\037\216-\327\035\035\255\241\035sQ\204"
+	.ascii	"\323d\0308\206\303\216\214\273\340\2656\276\204\360\302wX\037"
+	.ascii	"-&\224\344r\031d\313\354\275\215\227\337L\324Ad0\017\006<W\b"
+	.ascii	"\301A\200\307y0\224,_\355\20560\356d\234\373\352\326\366\320"
+	.ascii	"\344c\024\305\r"
+	.text
+	.section	.gnu.lto_.pureconst.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375 G\315\001"
+	.string	"rD\r\025\220Mc\376\261\356\356.13s\376\026\376\026\3766\362\311\226\001.y\344\220?\356xc\305\370\342)\2368\342\207\033^8\341\203\013\256\007\036\340-\267\311\314\250"
+	.text
+	.section	.gnu.lto_.ipa_modref.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\247\002%\n"
+	.string	"R\315%$\240%I\007\363*\326{\257\373\254\306@*\003\252\352T\325x\305\303\326H\263\244\375\366\177\373\315\332\326\210\224)\217\320\207\320\311!\322$w\305L\333|\342\304l\036\007U\323\331=t\3223S~\030.\266\324\225\226t\230\212\212+q%d \202\004\246\326\301Q\276+\031\003/lA\030\002K@;*d66\266\273\343\232="
+	.ascii	"wuu\335\312\361W \324\360\355\326\016\345\247\360\335\210\032"
+	.ascii	"\337\335\335\025\317f\f\225\005\203\236\313\216\215\352\236s"
+	.ascii	"\244\\)Qg>\005\001T\250AI\306nh\323n\200\242\241;v\021\240<g"
+	.ascii	"\224$8\243-g?\003x\300L\350\277\274\\\321\350\007D\005F\215e"
+	.ascii	"\325\345\205\321\355\274^\264\215\300\342T\341JY(\352\220\230"
+	.ascii	"\364;(\307f]I\334\377V\375\267x\326\364g\313\357\376\236-\021"
+	.ascii	"\022\214\241,\312`\2203)\264H\305\271\306\260\004\212L}\354*"
+	.ascii	"\177\275\037\202\247\261\370\f#\267\370y\275hW\354#.\2663p\t"
+	.ascii	"JD+!k\021t2\"t\226h\321k\273 \\\024\023Mfl1Ga\016J\340'J\001"
+	.ascii	"\240'=\003\327\377\003gG\246\276(S\306"
+	.text
+	.section	.gnu.lto_.lto.c5cbf2533cfd47d8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_nullFilterApply.5.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\265\007"
+	.string	"2O56Pm\222\016$\243\210\"YZ\257\315\203/%\247\264\024\231b\262\026T\230\231\335\220\311ja}\326\227\03573S$=Bb\025X\343\026\306\251mck\215\020\231\002 \211\217\207c]k2\332\006\004\301y\200\236\254\323\3114\320\303q\350@\215\026\0013\006g\237\215\006AY\246A\354?f\253|\244\337\205\342U|\f\271\227\361\255\362\221\276\245\266\017\323 He^\244V\022\3052\361\370\267\307~\347Z\372t@\346I\n*31/\324}C*\2625NT \223D\202\312\214\230\023,\265\216\226\377~\024d\373S\0259:\024J,L*\231\t/-\270jU\035\270j\275\215nu\333\355H\017L'\321(T\007\320\220\231;\321\b\243\277\376\b?\303_\n\013"
+	.string	"\322\032h41\264\n\3075|\232\305"
+	.ascii	"Y\220\225\220@\240,\203&\214\224\224\3165\311"
+	.text
+	.section	.gnu.lto_pt1FilterGain.6.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"=\n"
+	.string	"F\223E< \345*\035H9\002H\005\355\030V\002A\201\230\177\002\274\266&u#"
+	.string	"Q\220\357\331\\Q\343 Fq\245-\366\b*@\233(\\\306(\t\310Z\346\023\205\213\250\346\210\332&r\247\0244"
+	.string	"3"
+	.string	"1"
+	.string	"\255\247\200\2668\341\261\001\201\371P\021\260\273\034\347\006\231\317\355\005\231O59x\t\372\207\275\023 \226R\225.5\021\273k\231R\211\334z\333\t\266\037\354{\002\254\203\225\335\220\261\266\264\351r\362\327o\203>\314\033\333/\213\333\262\034\205\025\003`w\027>\355\020\312\032.\357\262\350\201]Y\253ew\031\254 \360i\333\017\252z\235/1\324\210T\213'\251\321hk\210q\254u\354\232:\252\312\022Q\263\223\034\355\260$\265\304\376\266\272\262/=\037\376\333_\256_^\372\032\202\022\024\262\002C\2228:\013\320t\347\371>\244\214\020\210\033y\"\221\327q\243\320\205\210\353\276\r\316\203`O\343\363q$\317\373\270M\270\337\256\253\251\034\223\236|\335t\352\007\240f[\022"
+	.ascii	"2\203l\215\321cb\311\f\177T \232\272\3035\361\327\242F\265\310"
+	.ascii	"6\0132\021dA\270\013\030\001\371\300\260\240B\013\200\312\330"
+	.ascii	"i\347\023"
+	.text
+	.section	.gnu.lto_pt1FilterInit.7.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\245\t"
+	.string	"V\022C;0\345\2521\200C\336\346\307\257?\004\346\201\216\210\323\326k\372\324HX\210\026\b#\025\220vyC}\023X\037\306\210\030\030\0300l\311\274W\022f\330QS@{[\357\275\245L)0"
+	.string	"1"
+	.string	"2"
+	.string	"\\G't\346<#t\346*\266\002\030>\b\002\200\274h\377\277ib\321R\254\335\342LJu\262\034\250\370_\231R\211\270\323m7m'Z/\004\n\004\376\220Z\201\317\270\027\224\266\326\264\225\243YD\273\032k\346\207\211\221\375\347T\3023\367\260Y\266fyEt\313\344\203\177\005\223\375#\247\020\236\003\016,\025\222X[\271i7\354\322\230\367\237\242~up\024"
+	.string	"81u\346\"Rh4\224\254\265\343I\316\222\326\333\377w\256Z\273\354\315-[v\006#\001\027\016?%Q\b\324\325\323\t?%Q\b\364\221\300\321\b\364|\244\220\305\350\363\204\031_\247\241 \306'\374J \030~\232\361\336>W\345\006\314P\323\243\333l5\f\013\016"
+	.ascii	"2\241'\034\030.\250L}Nj\217\245\255\240\207U\353\302z\f\363\002"
+	.ascii	"\201\301\025ijJ\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_pt1FilterUpdateCutoff.8.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\375\b"
+	.string	"fQ?9@\345\2501\240\256\327_\317\341\036\341\341\303qo6~\300\341\005P\0312,N \366\242\200 \343X#Ns\363*\212\216\203\300*{f{\227\341Q\261\264\377J\"eJ\001-"
+	.string	"-"
+	.string	"/"
+	.string	"\b\232\345\346\003\315\262^+S\340\030\b\320\341\212\371?\243\210=C\2576\2125)\325\311P`\342\177aJ\365\341F\267uh\033\321V\0261\251B\322\326\233\266\360\363\211\347V_\325\374+0\260\377\234Bl\226\r\031\303\326%6\361\3142\331\340_\261\300\376\217\323\207\315\262\237\003\030N\351k\373/Q\27342\b^FL\232%\003\013"
+	.string	"\b\n\316\332\357\004cH\353\314\3777\256Z\267\354h\226\reAK\202\313\3571\023\360\025\356>%Q\b\244\325\323\351>%Q\b4I\334h\304y&)D1\232\236\356bv\026\312Y|\272Y\342\270nn\276;\363\270\252\034\020C\305\215\306\330\006\f"
+	.ascii	"2C+\025\003\b_Z\\z\b\265\256\241\3070/\020\030\\\221\246\246"
+	.ascii	"\204;\274h'\031"
+	.text
+	.section	.gnu.lto_pt1FilterApply.9.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"}\013"
+	.string	"\266\326N= O\234\016$\232\002\027\\\364\346`\306\313V\b\032\372\204"
+	.string	"\037 \003,hm\373"
+	.string	"\324E\374\246\037\257\001\361\254\224\255\rT\003"
+	.string	"C"
+	.string	"\260k=\023*0\356W*\342\240F\366\2262\245<"
+	.string	";"
+	.string	";"
+	.string	"\325\243\271\312\266\017\342!2\333\203\234\206\321\244M\220\320\305\330]\313\300!\323#\374\200\351Q3<{f\376G\034\246\b\255\370\200:OJ\301\356:?\240\n\267\336\366\001\333\023\373\021\002T\246c\246a\2465\323\231\351\003\230B,\bx\273\024>\031\333\021Ql\260\235\331\017\333\231/\331\263\306\256\212\027\033\273\033q\202\247}\322Ed\3478\027\260+:\261\261\313E\214 q\306\346A\313\317\327JU\251n\343\240m^\"5\342\302\017N\302\336\304\3572\020\252\335\375\350\321\347L\217W\252C\367\201\344\311\317\346:\251\030\354\303\335]\253\310~\351\257\316\375\001\232M\006c\211\223)\022\254\242i`a`a\256\313\345\242X\030\313\202\213E\301\034X\222\002\2762\025\314\322\\\027f=\270\275\035\025\262Y\350\360\250\346\250&\002\264\340\370\300\360\344g\250\327\250\220c\273\240\232\n5\023"
+	.ascii	"i\231\"34\030AhB!\270qp\334\t\264\212\031\003\\\256(\232\233"
+	.ascii	"\302\242\026\373\201k\214\310\202\254\204\004\002e\0314\361\244"
+	.ascii	"\244\230\256I\006"
+	.text
+	.section	.gnu.lto_slewFilterInit.10.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"U\013"
+	.string	"\346TMC \2138\035H\261\3302\bq*\242Z\220\341\276l\305\204\333vX\"I\257l\020\264[p\030\032\350\365\245\265\231\306\b\202\221\020\312\026@\202\303&\247n\251\361\236\303\322\300dj\3135>)\322&{\247\0246"
+	.string	"<"
+	.string	":"
+	.string	"KZ\234\221\275\232|\005\366\232\235\002{\365hs8\211`?\201"
+	.string	"\200\023kw7z\340\343\347\350\377t-$\362|Bt\354\256gH4\340\246\267]\261\355a\237\013\244\177f\230\203\f\026\345\256\200\326\207]\325\013\nl\237b\233\\^\022\033"
+	.string	"\024\342\230\344%\214/\271\264\266\213a\203jw-\326\310^1\256O\373\020\036a<\251\363\211\335\021J\265\001)\013\r.j\227\034U;\244<\024(m\317\212\315y\005\227\331\356n\370\024NL\"4$\350`\257uA\212\001\3533[6\351\231\324\200\375kw\327td\337\364c/\375\327\003\"\232/\023r`F\324\304\316\353@8\234&\3240c. 'j\272\221m\363y\336\207\3316]\210\267a\300p\273\\\370#\341\300M\374>p\243\220\373k\351\310\037\017V\037\n2F\355\360\001\024"
+	.ascii	"i\231\"\023/\307\321\342\202\njCJ\330M\275nj\217\271\255\360"
+	.ascii	"1k\215\013\303\200\031\003\230\013:\247\204`\201\300\340\212"
+	.ascii	"45\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_slewFilterApply.11.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\274\002U\021"
+	.string	"\026\036jF\360\260(\035x\337?\350\316u\263\030jn\261NF1V\004\271\376\b+C}\314e\037\234\022\325\365\031C\032\337\206\343\353K0\312\255\023Wl\"\233\310\336\213\217U\322\370%\353\240V\271\351\346\260d\357\275\245\224)X"
+	.string	"N"
+	.string	"X"
+	.string	"\360\003\301\"Q\033R^pt7\367Q\017\251\021\352"
+	.string	"\251\221?\250I;\332\224\021\362\232\256\023\004g\030f\250\250N\332\231 m\246\254\264\220\332h\240\303jEa\214\n+\233\ne\031\200J\002\374t\267\302t'\250P\273\023\324\335_\025\325J\337\241\377=\374\017\371w&\372\251v\354~\356^\356>\356\036\356\236w\277\273\327"
+	.string	"\022\007\006\201\024\335\024rr\364\213\030#\342\277\351\337\376\357\252\313c\357t\267\250!\353\356\217'\320\375\365\245'L\372\231\250\200n\026\214\254\373\3738\002M\343?\355\377\265\204\2320\375\261\221[,<hL\02227\031\024n\f\331\203\3210+C\2062R#P$\272\202yk\221qmw\237\230[_V^"
+	.string	"\253AY\234\377%\252b\371@\210?P\024\217i\335\035r}i"
+	.string	"Ac1\221\032\225\331fv\363:\331\234\377;-\267~\205\315,\217\272\250n\001\245\222\021\222(\312\207@<\221\222\003\021\003\216\324\215F]\210#\211\024\214\270\220G\302\201\024x7\"\342q\245\256\363\270\355k\205\312,\017\177N\0305\363p\344\340\302\325\211\361D\033\032\227&\233\371\327\335s\262\007\253\221\254<5\300H\336Zf\\/\031Y9\302rd]]\260\221\272\021: \300\002\0311\363\351\232\"\"?\006\235\242\216s\335\034\321\325\\\0361\303\305\t\032'O\314\254\002,\252f\252e\020\3425m\316}\326!\006T\340&{ \353\312\340\3701\253\304r\007\2414\321\346\313\264c"
+	.ascii	"-\353P\236Z\253\224\222\r\270\373\332%!\033\274\023I\022M\227"
+	.ascii	"\271\375\021++'\020d\331&0Y@\236\343\355\210\302p\032,\0339\023"
+	.ascii	"\021\231\201\375(.3\272\247\267v\225\001"
+	.text
+	.section	.gnu.lto_hermiteSplineInit.12.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\237\0015\f"
+	.string	"\006\325NC\020mj:\b-D=xt\352\370\253x\335\363\273%w\3502}\322\216\2210\207\025X\223ANF\257\357nA\264\0272|\177\030\n"
+	.string	""
+	.string	"\254\350\002\006\036\f\2109\001\034\362\300\030\005\004L\226\033\355\235R6"
+	.string	"9"
+	.string	"?"
+	.ascii	"K^\314\261\275\232<\206\366\272\375B{\365h\313N>\330\2476(P\225"
+	.ascii	"\273\313Q\007\037?G\377\251OD#\320\247$dw=E#\0067\275m\213\355"
+	.ascii	"\017{\202\004%\373\250\237\376\364\317\212\204\302K\203\304\356"
+	.ascii	"\202\331\212u\325\017\021l\237b{\222\3070\036\345\225'\273\""
+	.ascii	"P\260v\367\342\216\355u#\362i\337\302/\214?}n\261[j\2616\007"
+	.ascii	"!\001\301T\220\300{\250/\230\211\300;\224\3429\2300\225+\213"
+	.ascii	"]\340\032\312\222R\333\3003x\265\355\256\207\257Bp\240r\002\302"
+	.ascii	"G{\245)JL \205\346\314&A\2236\260\037\331\3355\r\335\246\363"
+	.ascii	"eD\255\343x\233\216\250Y\203\t;\317\306\013\300q\300\357\003"
+	.ascii	"5\034\307\313|\234&\0249L\206\301N\027r\036\020\f9\n\271\217"
+	.ascii	",-\031@\005W\210&\020\360\0212\357\255*!6\340!b\246/  \360\202"
+	.ascii	"\021)\353r\241\34120\022\314G\266\271\325\013\036\276\301nHV"
+	.ascii	"1\2246|\3721|\004y\202\267\362\264\t\214\301\376.\205V\241\t"
+	.ascii	"|\270\2331\264v\361\310.\033\243\214\3475p\257H\363)\220//\332"
+	.ascii	"C\006"
+	.text
+	.section	.gnu.lto_hermiteSplineUpdate.13.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\342\003\245\027"
+	.string	"&\352\222J\260\322U:\363\256\374\321\306\210\273\n}'\370/\314\263\003\313\245\236?f\t\277\336\27656N\025\026"
+	.string	"\342\255\355\351\267\332\215\366\275\376\362\240\037\032#\341\205\2357.\354Ow\273\2363\004\3756[Io\244\243\244\021B\344N)~"
+	.string	"q"
+	.string	"\201"
+	.string	"9\034\b\311\234\320\350"
+	.string	"6"
+	.string	"\2221y\035`?\020L;j\255\004Nz\201\177L\034Yu\203\317\346"
+	.ascii	"\025\376\304\356>&:U\253\213 E\265\326\024\257\230'O\306S\373"
+	.ascii	"%nb\367\340\314\001\324\252\023\243\250Va\212\007\230'-\374\253"
+	.ascii	"<i\276U\236\364\316f\272p\247~\306\r\r(\200\324Zc+\342\273\323"
+	.ascii	"\235\377\341S\277\032\336)*A\255\325\364W\343\341\336\333F\261"
+	.ascii	"\035\301\036%\004\224\246\326\036\nk\037\340$\2350|\264h\013"
+	.ascii	"ytC\330\037\353\352\330\007\272a\027\272_\367\371]\037\272[\017"
+	.ascii	"\376\001Nt\263\376\363\227Pj\022J\275\242\324#\224ZE\251E(u\212"
+	.ascii	"R\233\224\032E\251KJMR\352\221R/\245\246\224\372&\250\247%\223"
+	.ascii	"\243Z9\024\205T%\222\005\211\003\375B\377\320O\364\321\376\203"
+	.ascii	"\236\342*>\264\212\b\007\313PG\032\362k27\265\345\360\344y-j"
+	.ascii	"\315%\221N`\271\344\242v\207\234\300\332\332r\307\036'\017\361"
+	.ascii	"\302\021\266\344N\3109j\255]\373\013\036B\234lz\366\355G+\033"
+	.ascii	"\br\202~M\343\302v];\3568\274p\243]U\315\217\036\326\322}-\035"
+	.ascii	"\236<_\327\322\335\036'\320\247{\013\363\233Z\362\341\024\354"
+	.ascii	"\031\303W\230h\326Z\r\370E-"
+	.string	"\031LvF\314\224'[{\037\037\202=Zt\311\232x\007,1\266\331X\240FWjT\206\273\321t$\004\232KLN\006ccP\"\243\341j.\272Rf\233\321p\272\322/*9\031\fmF!f\273\325j\267\227\230m\346R\213\275\344t1\025\001\276\341d\271\030\314\355\226\213\251\204\365c]\035+(*\365\326\347\327\332\262\327(\366\330\270\226\006\212\367\344t\343\n\227A.=\365\334\220\254=\273\322jIFv\265\244\221jEvd\327\350\004V\325\216\255\025\331\226\234\244\023'\265\266\205I\250a8\005\r3JMIT \005I:\300\002\0211\253\007\021\020\255\204\316\310L\240\240\240\240\205=\003'\232\312\022\332$8\002.\247\231\351\227\035:\254(\"\276\324\227\324[\264\001\030\310\213c\204\031\201\340%1}\242\244\355\232\335\361\337\217\tR\364F\207v\005#\234k\260\263\201\017\262c\366\262\237!"
+	.ascii	"s\220[5\334y\037\016\267\035\002h\316p|D\3709\f\365\273\f%Bz"
+	.ascii	"P\301\214\211\347\327e+\301\335\250\224+\202\373%`\264\030\367"
+	.ascii	"A`\350\030\207x\n\017E\207\340\203H;\374\2413]\034\213\n"
+	.text
+	.section	.gnu.lto_hermiteSplineEvaluate.14.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\321\002\r\022"
+	.string	"\026\241pD"
+	.string	"\317&\035\224T\330\326{\033m\002\301\277\212\230\2213\342\317\214\017\344\031\252yM\224\025\fc}\350\321\352\024\277\032+\320\361"
+	.string	"\031O\322\377\353\216\357\370\n\345\201\013;6*\234\333\316\215\255\221M\366\2262\245["
+	.string	"R"
+	.string	"a"
+	.string	"\253\303\224<\300nJ\216\315n\267\341\003\332\241\273cd\207\332\005d\207^\331+\336\255\354w.X\230\351\331\335M9|\365\230\301\247\271\362\243G\350\005c=\242<\023\301P\016]\025\362i(W"
+	.string	"\260\223\227\261\273\227yb\200\2652\243\307\356:_0\r\267v\333*\333\tl-\020v\307JU\261\377vw\255)\366c~\323a\376R\246I\231\036eZ\224\351P\246\265L\307Lg\231\206\231~\231\326L\037C\344\222\302"
+	.string	"\212\335\fA?\253\003o<\330\376\205\355\354.b\365\030\307\034\332\305\371\261\331\335\r#\320\0163\336\323\276\313_\002;\256\r\231B\215\032\201\256&\315t\300\216\353C\013u\032\250\035,\346N\342i\344\241\tq\250J!v\277\223]\023\215\253jj\205\205\253\245\225A\254\027\323\244%\265I \344_\206\312JU\025\233\364\332@&\347$[\330\216\360\021\216i\273\333\341\317,\230\240u(\311\016\257\260e\306\007\306$\203\002\252\203\210\234BFH2\177p\244@T!'\007\233\b\207Bq\037\233\310\211\001j\373H\221l\034\004\314\215\200\2446\025\307\245\266\213n\377VS\254\340E\307D[/\3064pbL\r\210\036\322\211\221\206\224$\322\353H#\220\253\305\204\350&\244\221\247\204O\006\325>\335F\002KLS\373\301kJ*\022\350\305\023\365\251\2460: "
+	.ascii	"\203\021!\352\006\343C\243H1\324(wa\031\272\03494N\300\376k\262"
+	.ascii	"\275\273\332+A\300\304\245YN\234\256e\313\213 \202A\373\343\360"
+	.ascii	"`\036\204c\007Ifm(l9\345\361\270F!%\313b$T\252S\006\344\006\366"
+	.ascii	"\342B\315&\315\236,\002\252%\016\270E\242;$\327\237\266\227\352"
+	.ascii	"\257\240\3718\216G7\006]\2216S\206Kf\300G9\367\315bf\214:d\273"
+	.ascii	"N\031"
+	.text
+	.section	.gnu.lto_trajectoryLimiterInit.15.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\r\n"
+	.string	"\346\222E=@\305(\035\340\335\255/\337\372D\f?\246f\223\232mn\364\212"
+	.string	"\232\202\270\f3\375\200\267}D\177"
+	.string	"HR#\335\255\353\321\216\207\211\003\246\371\352\270ak\022\337\271z\304\222M\366N)0"
+	.string	"5"
+	.string	"4"
+	.string	"\036\237\260\235rG\330N-\332\002>\256\366.\020\f\227lw\353\374\270x)\372?\371"
+	.string	"*U\272\304@\354\256%*\305q\317\333\326\330~\260\277\020/\033"
+	.string	"\273\033\263\002\033\243*\"\266\237\261-\307\233\210o\371\245\031\254\306)\003\266\273\0347p\247\f\332\245}\222\227\210g\221~\260\253\n"
+	.string	"\333\0359\336p\247\001\032\233\342),#\2629\355\212\243\370\305\355\256\203\357\272\260(X\205\220\266S:`\205@\207I\316\354\261$\247\207}mw\327Se\277\365\317\263~\271\021\264\004\241\257\013\273\321'\342\300O\330y\035\bcO\007\374\204\240n\242\206>\317\373<5\324Ix\325\003\216jG\301\237\350\003\326\360\373\300\232\031\367\332N\225#\\b\246y\262_\001\020"
+	.string	"2\241)\034\030\017D1A!\225"
+	.ascii	"\304\3504\030jq\361!,\273F\031\303\274@`pE\232\232\002\356\362"
+	.ascii	"\242\235d"
+	.text
+	.section	.gnu.lto_trajectoryLimiterApply.16.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\310\005M\""
+	.string	"\272@\314\rH\240VN:\320K\\\355\\WxL\216\210\035[\235c'\013\202\026Z#\256\267W+\270\306\022\f\260T\373Q\365\335\313\354\336\332\264}\027\357\025[\360j\354\002_\215\224)\b\340[\034\252\371x\213)-\263\226\020)S\n\321"
+	.string	"\250"
+	.string	"\313"
+	.string	"?\362\342\221<\311\305\214S\262Ck\316\251$\f\343A\002\314\210\357\013\312\210\ngZ\231\340\322\302\340\005U\205\325u\201\313\305\233T\n"
+	.string	"\345\231\227\2269\247\322IW\270\025\t3a\210\227\203 5\024\250\376\207\213#\316\264\022Z\201\3159\013\370\300\325~\217\373\210:\261\304s\346\214\201\0066'\261\200\t\334N\232x\263\355\3578\217(\2738\022id\325L\3508!\304\313\2343g\364\236\332\311\361;\265\223;\343Q\257\221\343j\224\177\261\217KlD\251\272\222z\215\305\311\221\300\220l\205\315\225\211\261\307\f\006\332\307J\035g\256V|G\001f0\320l\256\250F\240!\331\212\213]\255\256\204\252\266\005sNk\325\225\212\333v\333\035l\303\260\311\033\001\376\023\b ns\316g\225\250\235\374\342T\224}\3511\245i6Q\250\213e\177\234\033\303I\252FR\365\321\203\374F\347\272\213\356u\023\375\353\036:\330-\364\"\177\320\207\374@\017\273\177\256\344\366\371\217?\300\211?"
+	.string	"U\363\250zG\325:\252\316Q5\216\252oTm\243\352\032U\323\250\032\247\352\031U\313\250\372\246j\233\252k\252&U=\252zU\255\252\376"
+	.ascii	"\\\0163%&s\242H\0233\245\220a7\316\365{\375_?\330\037\366+y\315"
+	.ascii	"\276\375%g\3621\033g\021_b\233\n\264\034sN\234\b\033wR\355(\277"
+	.ascii	"+\n&g_j\335,\316\356\221r\330{\225\233M0\005M\3078\036-\322\276"
+	.ascii	"\3342\245i?\222."
+	.string	"f.v\261\fe[\223|6\f\213\035@\310\250\024\214\215\266h\217\366M\376`KV\226\222\213\315\336\266h_V\016k\326f\203\316J'4;\2645[;\303-\315~fo\213\333\237.D;\263@e\345\220h\205\366\266KT\312-\333\332\036\210\306\332\332V\261\220[[ ,\245\226\214\216k\377>\324^E\256\021\325J\351\356\270\343Y9\024Z\335]\037,\245\223\342}\243\232s*ihuO\226\025\245\334\372\331\241]JR:\tZ\240\025\332\245\256rK\250i\366\331\237U\242Rz\371\006X\237\325#\245\226\320O's\021A\346`\340\211CP\347\003\002\376\200@\036\231\341\346\304\013F\bA\303\3335\351\202O\275\006N\274\340\023\215\207g\340\361\234\236H\t\031\264\351\327\013\352\200<&\336n\307`\204\316w\003\025\354\355~L<\n#t>\\\220\267\001\250\013\326\200\274`\317\327c\262yg"
+	.ascii	"\310\0132\3654\344\232~>\337o\227k\352\351|\271\035\360)g \310"
+	.ascii	"?'\0360\027\374\375\2009\034q\352\343\334\030\266 \203\224\331"
+	.ascii	"\217]\306E\231\224\214\033c"
+	.string	"\316&\255\225\355\235\355\351\302!ej\205\336\331+:\373\335Y\035S\016\203Vg\237\303F\261\334JZ+64\240\330 R\265eJ\323\\\303Y\236\225Yk\311E\221t1{A.\226U\217\366b\277p\366u\242\270H\313\263V<c\327\026,\304\324\350\242\002\205*d\250\201L\204\004\b\221#%\"i$M\n\035\260\002\021\252\252m\021\220\251\204H\202(\224\202\024:\376xsdZ\212\224\326,\316\267\351\265\327\204\032\212\366G>\0311\030#\037\335\027\333US\006HV\020\006\331%a\200)P\bX\325#:2\177\336\306Q;\203\364\336\247\t\311\2254L\211\t\002=\303\020lDZ\336\035b\250\310Y\224J\211\360\345\213\243\250\024\304Wu\206\254%\305\212@\355\361w0~\0335\306\335\300\207\0321\350\206\335\262L\273I\247]\3568\335Rt\024v\225U\017<\346\331\221\f\022\215%!\360&"
+	.ascii	"\354\b\325\210#\334%\020\027\200\365\311\225<?/!\nqQ8\334\263"
+	.ascii	"\262\274`\243\264I\306O\205\351%\3205\350\363\007"
+	.text
+	.section	.gnu.lto_filterGetNotchQ.17.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"\335\t"
+	.string	"\006\023D<@\305(\035\340\245\037P\357:\373u\261N\306%K\207Y\220%\377\007(v\271\355V\261;>W\023\002\276\262\354\320\004\370\030\266\354\244\345"
+	.string	",\261oK\374\356\332?\b\331[\312\224\0022"
+	.string	"1"
+	.string	"/"
+	.string	"6\n~\036\037O\031\300@A\260\273X\346\007\326#\274\201\365\250\035\367\236\236\377\223\307\r\020\024\251\024z^\021\273\353$\2254n\275m\006\333\020\366\021\002\361i\370\264>\235O\337\262p\340\005\004\354f\254\022,\201\250\022b\333\2631\3667\340\341\371\223Q\266\354\0020I\331]\0077\024<\332\366I^\342\005P\257\227\302\324(\200j*\324K5\022\261T5!\0255j\252\265bi\324k\252F#\242\\\331_(\225\303>\\5\331O_\377~\353\247? \215\333p8[g\221]@\032\267\341\264\356\243e\027g\032N\353&:\034\354\263y<[\206}:\022\036,\343*0\215\2027\n\215\303\272m\3430\314\267\207\253\246K3\027*r\020"
+	.string	"2\2417(p\362\213\005\002\3729\n\030|\314\261\\\303\213h\001-&\0240\0072\003#\202\n8"
+	.ascii	"\225\307\324N2"
+	.text
+	.section	.gnu.lto_biquadFilterInitLPF.18.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"=\n"
+	.string	"\246\323F<@\305\2521X\267\205X\327?\203\317u\305Z8o\315p\344\f2\3017\177f\340\323S\355\037\025b\204i\256Itw\371\341\f\204\003\321\321\247I\250\233$8\023\343\333\337{K\231R2"
+	.string	"6"
+	.string	"3"
+	.string	"\030o\035\235\300y\303\030\201\363V\261-\340\021\345v\021"
+	.string	"q\311\376{\363\304\242\245X\333\345\314\tU\262\274D\374\257<\241D\334\351\266\232\266\023\255\025\002\017I0{l\003\220\322\326]\333\331\342\320\f\376QB\002!G\267\210f\365\325\314\037@\006\373\277\351\003\306\033\203f\331Ze\026\321\253\016\037\374)\001\260\177\334\324!#\256/\253\230T\261W\373M\032m\316)g\253\261!}j\303\312\354#\263\324\216%9MZk\377\337\231j\335\2625\263\354\351\225-\271\316\300"
+	.string	"\016\202\007\037\251Sa1\372\302\317\027v\031_(Q\300\325\303\t?\322\005\350\343\211\300P\b\364x\"P'\344y\302\221\307Y(\210\361\205\036\t\004C\257\033o\3553U\212\0031\323\364\350E\326\001\020"
+	.string	"*C\244e\212L\274\016\032\r.\304T\335<\256\261\001f<\240J\204\021%\304\r\304"
+	.ascii	"W\244\251)\340./\332I\006"
+	.text
+	.section	.gnu.lto_biquadFilterInit.19.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\305\bm'"
+	.string	"jE\360\016D\200\236M:[\340Q-\2062^\r\336HO#\331\232h\013)X\027"
+	.string	"*}>\321\262\033-\245\030O\252\245\327\333n\271)\323\316>\b\261H\356\b\226]\274L\341\004\2775a<\346\342\036\264A\b\221;\245\337"
+	.string	"\305"
+	.string	"\340"
+	.ascii	"\017\3631/\236\314\313\374\314\321<\315\315\276\30675\203\252"
+	.ascii	"\312\326\204;\262\236\323\017\251\006\265\216\302\251\261\036"
+	.ascii	"p\311\216=/\314\024i!\326$g\264\242\202\030\006\205\030\027\235"
+	.ascii	"\314\214&l0.\332\256\202\020\340\232\003\334Sk\215\360\322%l"
+	.ascii	"\362\213/\rD\230\213$R\rf]\371\260\\p\220H\365\207\204k\003"
+	.string	"\035^\213\325\267\270\350\241Z\311\360\030k\255\022\\\301\366\322\211<\265\017\366+V\307\222\343\001j\365*\032k\035J0\004\333K\017\237d\276\264}\200\371\322Vv\236\017\231\324w\t\244\243\313\237Z+n\227\334\352fI.\265\362\351\2253\340\326\325M\250R\203\032\3715'\277\250\370\001n\r\371j\375\262L\244Z+\321\326IR\241\016\265VS\340\226\220[\350\266k\330\276a\333\214\001eY\364H&\355\356\215)^\246\224\366\266f\243\002\326\256QE\017LZ\245\340 \264\337^\331\305\213\331\341\201V\315\341xd\363\253\025\353\211\256\200\245c\002\354\227\356\317\257,z4\322~M.(z\316=X\364h\017\257N\326Mb\237\254\353e\037\313\357\240\001\203\247\005\n\234\022 8\320\304\364/\277\201\217\335K\017\373\013\234\354Vz\331\235t5\267\200o\371\003\234\313\217t0\367\321\305\334F'\336E7\336"
+	.string	".v\337n\346&\242\324C\224\332F\251\205(\265I\251KJMR\352\245\324\224R\237\302Q\2246\270\263Z\201\034\005U\264R\f\312\301\374b~\342o\374\305~3\377\330O\366\227\375jNd?~lkK\321j\264\266\215\002\323#\264\266\356k"
+	.ascii	"Vh\243\300\346\230k\277\270\240\333\232\033\005vv\226\225k\307"
+	.ascii	"x \027m\265\326\013> \253/\031Et\234\3440_\322.\300\242%\332"
+	.ascii	"r\243\300\320\234en~\322D\260Pi\247\360\300B\2759\277\232\026"
+	.ascii	"\312\354\354ZZ\246\305`\005\315\331\007\313\316)\361\254T\260"
+	.ascii	"\032\322N\241\323j0;\273\022,\206*\305\363k\316)1\013"
+	.string	"\271\264\r6C\332)\364RZ\006\233\341\315\322>m\006\263\263k\301>\316\371\245\264\364G\356\b*^N\341\341\334\210\013\355\212\016\332M\342\247\371w(\024:~\235\033\021\326#q|9\316c\253\365\352]\276\317|i\n\254:|\bk\255\017\376\306\357\2621\251A\352\260>xi`)\221\b\232\026]s\201\335]\n\271\027\272)\252\222F\025\255\222\2429\030\273\031\271\222\002\013Z\201\005\265\300\202R\310\321\n9j!Gu;\034$D\\g#7\002F\225\216\347B\307\273\325\320\361<\020\231\226\232\300\323\331\230\021\303\005\216\006\325\324\024\225\024\216F\214\334\024N\212W\205\233\300d\252\235\216\207\263AE\305\303\335\206\365d]/\373\306J\004\333\033#\025\354N\215\3156\330ur\264A_Xy`{a\304e\260\324h\203\276(e\323\366\242\220N\273S\303\262OK\2136\350SR2mO\311\223;"
+	.string	"6\350\033R\366\206\220\tv\247\326\265\344\336\311m\203\276\263\\\332\336I\356\324~\354\202\235\301\347\t%\332`\b)hX\233e\n\274}\202\366@Ay\340\231B\265n\247\240:\\\264M\237\354\025\364\327\304D\250\314\235?\177\206\326\316Q\254\243\035\332(\260\200\232\250QPf\020R\314\314\210(H\222$\255\001\300\002\221)\2536\022\340\024-\023\032\206\b\241b\346\222\024\030\025n\006X\024\321\302R\242\352v\371gn\n\327\334Y\026\023`2\027+g=A\307ct\346\234\260E}\322<\020\235X\267\264\365.\242vy\336\302\fv\376\031qHt@C\0074t\210s\375\266\335Af\237\201\246\230\300|\2544\307"
+	.ascii	"~DP\340n\260!*\240\242\216(s\303\215\370\242\r~\305s'^6z\366"
+	.ascii	"Jx\270\016\206\032J2\026\204\200\210\357_\260\241\\\222\363\330"
+	.ascii	"\261\353\335\335[\201\212\214%\002\246j\227Z\325)\026\253\275"
+	.ascii	"\017Z\316\330N~\337\013\221bozK\017\006f\r\325\303!!:\001\030"
+	.ascii	"jJR\326\007\326\377(\b\333\313\027\0252\263\227\323Od\254\256"
+	.ascii	"7Y\347\003*\020N2K\371\364\243\202\370/\360\020!1\2425F\245\357"
+	.ascii	"\246\252U\276\256\006\251\361\340\202\307N:\354n\250\250K\246"
+	.ascii	"K\006\241\227\247\203\020p?\024\272qV,\r^\005\315\317)D\321'"
+	.ascii	"\244\331\260\224\303\225up\372\007"
+	.text
+	.section	.gnu.lto_biquadFilterUpdate.20.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\264\002\325\021"
+	.string	"\366\336oI\340\322&\035\250\224\304\232\3138\031k}\005\002\321\340k@\247\341'\214\\:\214\223b\300P\273\241\206\206:\2666\275)ne\234\n\3237\321.C\326\001C\206h\030\024\324\206'\305z\006\266M;+\335\2324B\210\334)\005S"
+	.string	"b"
+	.string	"U"
+	.string	".m\332\005B\262\355\356\210U\337;\021\356\323\276\315_\304~\303\362\001\2733A\266]r\304\f\276w&_\300{\367\235\200\367\3161\373\350$\315\276H\350%\006\322\356\202\272\342\261\317\230\377\237\233h1\262\317R\204\335\365\244\305\234\270\365\266\023\330\356`\253\2027w\333\315?S\002\220\210 "
+	.string	"\331-1$i\207:\032-\316\363\367\374>\277\355\234\375\313\370\214\227\3771\312f\304\301G\307\206\036\227\".\251\205y\331\341B\203\315\343\362\223\2310@\242\210G\217\335m\360\316\031lnG\304\021\005\035\227\\jaf;\0234\007\306\245\326%\005\212\007\223<\214\330q\002Sm\326\207y\232\027\004\261Y\031\225\331n=\310\273\211\007\352Tk~\324T~\203\273\331u\033.\277\335u\340\327\030\021\342"
+	.ascii	"\r\013\026\357\235\252\326\370\250\335\264\314!6)\233\252\302"
+	.ascii	">\267\273k\235\261\277\363\237\256\363\233\236\363\177\307\371"
+	.ascii	"K\347\271\275\367\334\335}\002\252\225Y\2622U\260Y\002\233a\n"
+	.ascii	"\f\203\205\207/\223\013\036\\\341x\022\216(\225p\224p\362\274"
+	.ascii	"\"\031\303\027\b\326\t\210\"\266Z\342\nDa\231\264\300\325\350"
+	.ascii	"\002I\020XL\tG\360%\212#\210\"\367\334\352\214+\334\206ZtfOs"
+	.ascii	"\334:%\022R\343\024\307MU(\200\321,\251&\003`\236\324\244\237"
+	.ascii	"\22649 \360\002\031\261\321\003\370r\020\f\221\346)\363xG2\034"
+	.ascii	"\214\204\214\035H\340\"\025\214\r\330jC\224\026;\220\300E*\030"
+	.ascii	"\033\260\341\355\f\312q\f\376\037\226\311\334\017\2259\364E{"
+	.ascii	"9\237P\316\020\"%\204r\316f)\203\034\271\215a\210$\216d\237x"
+	.ascii	"/\245\223\316x\265a\274\355.W[Mb7y^\274,\003\226\b#\212\270\211"
+	.ascii	"\301+\322\330\024\020\227\027\355!\003"
+	.text
+	.section	.gnu.lto_biquadFilterUpdateLPF.21.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\007\003\375\022"
+	.string	"\266\341vH\320\3624\035\212)\001\222\313\263\"\373\234\272\2157\214\207%N\240\230\247\022\201\314Gu\034\006\246"
+	.string	"aV3nY$\3439H\321V\035\222p9\214\374\207\366\005\365#\031\217\275+bb\003Q\377\371\031\201\330\2266\331;\245\\"
+	.string	"e"
+	.string	"]"
+	.string	"6%z\032\314\361.\304\007\231\264\310.\r\251rwM\314\342^K\264O\373?o!\036h\346\002vy\232\312\335\321\304\n\270W\217/\260\275r'\260\275Z\264{|\354\331?\r\271\031\002\262\273\036=q\361S\364?t\021\234\034\232O\325\203\335\365\304\311\321\271\351m\257l[\260\351\207:7\034L\355\212\230\n\262N5\226\342K\177\354W\372\313k\366}\362\245\257\364\330\227\316\344.\tIvd\004U$\236H\204\371\013_\020b\261\273\035\214O\364\242\037=\311\035\222\214\202\021\324\204\030&KlH6\304\315\016\025\022l\230\3030\311\321\2140"
+	.string	"\342\211\207\217\335]\360\352\b\334\353;\333THF#\331~\271\242a\036\307\t\244~v\207\322\270\336\304\315\300\333PQ\352\363\003\326\362\032\033\245>Q\263\227v\371\f\223\007zv\227\201/\303C\007\037\305\253?\263\275Vz\246\257|\242`@\2579e\2175\223\232\260\257-\345\261_\336\334\225n\325c\367\366\245\273^\350\327\036\364\323\003\3753\300\200\254\230\211\0223Y2\023Ef~/)\0252\270|\241\312\027v-_\b\001\300\346\326I\370\275lXQ\361X@\227\013ly,+).\257\025\272x'\b\fr\370B\357\005\004C\257\033_\037:\027#\341\364\2425\346\250l\246\242:\204\3006\232cV)\016\223#\262Z\023\004\26632}\f\233\311\257x\3758\255\265\335\327J\243\224N\032> \360\002\021\261\235\003\312C\244y\212\b\355\216\354\311"
+	.string	"\b\212\354}\035\317L[\353\021\204(6\013\366^l/\314\r\367,h\r\242q\314\024J\342\004\323\217e\020\256\207\021\316\330\341\037k\332\031\343\365\241\005\313d\201\\\303f\0219\320\230\227p\314\320\303@H\303\n\f\2049\355\001}$r\tV\212w_F9\311\271P\262pm\034"
+	.ascii	"\267\007\352\270#\312\270\215\321+\322\330\024\020\227\027-$"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_biquadFilterApplyDF1.22.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\374\002\025\023"
+	.string	"\266#{F\340\322h8H5\200u\313\207\355\004\200\326\t\225\220\035\343\301\302\207Q\252\332\224\003\r!\345CA\353\242v\332\232\345\312\021;~\262\303\020c\216\343\214B\244\037\031\033(\016*\245(\364"
+	.string	"o\242\3266\331{K\231Ra"
+	.string	"["
+	.string	"m"
+	.string	"\273\n\356\231\001\230y\035\347l\332\025\352\361\263\273&^\360\264\177;\n\331G\230\257vmf\374\354\216&N"
+	.string	"\336\363\b\332\366M\374\204\314\316u\243\b\234/\203\006\f8\036\273\033\0328\353\273\327}\344\273\247!.{\312\374\343\336\225\350\311\331hb\236%\007\273\353\264\321\324\334z\333\007l7\260uC\231d\2171\251 \354w\2536\366wn\326u~\222\217\377H\246W\231\026\311tH\246U\231Ne\032$\323\250L\2372m\3124\230\351R\246\277L{\231\3562\255\231\316L\277\004@\020\215\0079vg\222|,\221\0074\342;\277-\363qF\331\336\271"
+	.string	"\306p\b`\273\231\321\261\0015\022 \212\322\224\026\330\341z\020\210\376\250\302\201Pz\034&\375\364\244\002~\200ZR\223\226\324\250\345\320^\377\001\365C7\267\231x\026%}\316\323\324O\275\242\332\007Z&\271SUOK.j9\264\226\257\350\364\270\233\333\314\345=\252(7H\364\232\332\025\325rh~y\n\347\300\335E\361y\"X"
+	.ascii	"q`\276{W\223\f\017\322m\0261\225\027\227\026\354\213\275\260"
+	.ascii	"\254\270\274\317)'\260VL\3055!\\\021_/1%\\qIx\205)0\227\360d"
+	.ascii	"\200E\226\026,\214\211\",D\215\373n\325\206\245\252\232\026D"
+	.ascii	"3\245\231\245\266\353D9\244\016\263\241#\233\221\335r\031\236"
+	.ascii	"\214\017\222\207Y\214\224\r\b*`\330\214V\252R\226\246\210\206"
+	.ascii	"\350J\021\340Z\027\022\321\f\242\360\027!\232\270\224\236T\245"
+	.ascii	"\004|\0023 \320\"\221+z)\235\"+\236\224\024-\274\004\240aM\361"
+	.ascii	"K0\020\334\206uP\207i\344/\2565\030l\275\273\343\270\340\324"
+	.ascii	"\255\231y\304@\311\357@\tDX\236\030)\351\035(\031\346e\343\271"
+	.ascii	"\206\201\032\bC\030%\221q\330:#\335\nc\226\222\255\370\r\261"
+	.ascii	"B\022\027\030\205`NlU$\"\221p\226Pht[E\t\004-\257\211'!\305t"
+	.ascii	"-2"
+	.text
+	.section	.gnu.lto_biquadFilterApply.23.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`b\002\275\020"
+	.string	"v\037lD\020\2214\034\210\226\234\257\335B\354\353 h\340\231\221\243\034]\254\r\2011o\235'\0050\210\r\337[\364\033\376\365!k\375%\231\227\022\020"
+	.string	"P\001\222\211\307\361bV\241\032\350\2478\2625K\366\336{K\231RW"
+	.string	"P"
+	.string	"Z"
+	.string	"\0133\323\262\273\0366\360\264\257r\020\256\217\"\347\330\225\255h\331\035=L\340;\347\361\263\355{\370\007\227\315\262\215\030P\272\t\032$\324fv\027\024p"
+	.ascii	"\335\271\355\243\356\234^\270\353\351\362_\373\306\201\304K\254"
+	.ascii	"\344\365\364\022\354\2563Vbr\353m\017\260\215\300\316\031\001"
+	.ascii	"\027}\37492\035\3124(\323\237L{2\335\3114'\323\233L\177\231\366"
+	.ascii	"2\335e\232\313\364\226i\315tf\372\035\242\032.\024\330\330\245"
+	.ascii	"Pscc8\227\224\323~\333\345\327\334\261M\213\360\275*t\3042\244"
+	.ascii	"\304\330\335\002\347|\340\313\374\212Y\274\331\272\311\210\033"
+	.ascii	"`Y\343\221v\352i\227B\234\205?\321)iSNUF\234=x\211M=\022\026"
+	.ascii	"\035TSG\232&\304\223\325G\250~\300\020\3515u\223\021g0\267.\302"
+	.ascii	",\337\356~\370!\026@\370PD\272s\327\r\311\013\215\312H\326\330"
+	.ascii	"\343+\325\202\375mUf\237v\217\276\362,\220\326\312\244\352X\255"
+	.ascii	"\220\324\211\353\\\"\251L,\220S\0030\025\242Pa\tL\235\030\240"
+	.ascii	"\300\222j\005\222\0028\f1\251@V\030\252\300\316\270\337Ve#\005"
+	.ascii	"\231\320\210\031Q\230C\n\003R\217\206>\n:]\305\247\243\036\007"
+	.ascii	"G\321\241\341\250\313\347E\326b26\372)G\275\026\342\t\352-\033"
+	.ascii	"}\315SN\277, \300\"\231\253ziO\021\212\007L\242YI\320c\003\271"
+	.ascii	"\264@\320\232\301\030\351\005\207\361\200\016\t\3060J\2436\020"
+	.ascii	"\004\343XN\262E\035\206<J\b\342\361\340@]\371\3051W\245\220\350"
+	.ascii	"\034\306\234\222]\361\233bu\024\027\326\206\340\236X\2120\"\221"
+	.ascii	"p\226Pht[E\t\004-\277\211'\221b\272\026\031"
+	.text
+	.section	.gnu.lto_laggedMovingAverageInit.24.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\370"
+	.string	"\315\013"
+	.string	"\206\025O?\020O&\035"
+	.string	"\342\037\302\007\\E"
+	.string	"2\323'\236\177\304\2567\310O\3134=\311_\263r\207\243\210\337\017\001A\005\t0\032\037\003\240\"\004Tt$\230\300D\0045\303\274\260\036\004\355M\366N)8"
+	.string	">"
+	.string	"<"
+	.string	"*v\307\004F\300\235z<\201z\312}@=\265h\303\370\350ao\202u\001F\333\335nv\270x)\372\207\3751\"}.\035\rv\327rD\322p\317\333>`{b\177\024\365\256\177{\353\227\217\227R4\031\016f\354f\330\320X\026t\005\b\333\207\330\336^\216\025\210\254h\204\212\301\034/B\274\253##+\naP\300\235F\344\245\375\325Y\342[\236\013\330=\275\b\263:m\360(\034\243\033d5\3236m\013?\341\020\311T\246w\252\215y\211\016\267\273\013|\022\034M"
+	.string	"\027\037<\365t\202\322\340\260\232\201\344\206=~\344D\331\337vw=O\366_\177\026M\204Y\341x\0176\240\204\213\267\001PM\221\204\225\f\005\317\322]\300\357\003)\335\305\203\360u\224\020\323I\f\030\254P\t\273\f\b\206\035d\334o;O\246\245T-\006h\206\354\177\325\236\360\024\337\253E\210\027"
+	.ascii	"i\231\"\023\217\363\242\301\005\027PF\212=GSS!0IQ\035\252p\335"
+	.ascii	"\342\016\231\260\3125 \300\206VB9\230KB\260 |\246F\301eij4\270"
+	.ascii	"\313\213v\222\001"
+	.text
+	.section	.gnu.lto_laggedMovingAverageUpdate.25.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\207\003\375\026"
+	.string	"&\351\215J\300\360*\035\352\030\034\351i\247\031F\330t\260\305@d\273\327\347E\376\277\204G\351D\310\335Y\332\333\244\"\346\342\353K\b\236\202\377\323\240\376\001BY\024E\202PP\224\n'\252\275\"\243';R\004\264mk\204l\262\245\224)w"
+	.string	"n"
+	.string	"~"
+	.string	"=\265V\220\017X\376\367\267\037n\013DY"
+	.ascii	"\265\302 \365\324\n\004\371\007\271\342\201\344\377o\207\305"
+	.ascii	"\271\375\302\t\234\251\241\017xVv\216j\255\245\307\266\350\212"
+	.ascii	"s7\350\212-\263\267\245\342l\276}\307\221\231\024\024\356z)K"
+	.ascii	"%\254\250\3529\230\036\265V\035\317\226\355\371\341C\321\242"
+	.ascii	"\352\251\314\226P\005\242\325Y\346\365r\314\343H\255\365\274"
+	.ascii	"\353E\330\217\373\177\366_\344\357\237\n6\304\205d\255U\344\273"
+	.ascii	"s@F\326\240\320\025\267]\026p|\036~8\036\376\300\024\356\230"
+	.ascii	"\177gm\230\016\222\357\332\234\335\326\002w7H>\213\371\253\221"
+	.ascii	"\257\242\374\324\344\243&\377\304|\023\363K\314'\231?6\237\212"
+	.ascii	"|Q\344\317\311\357\3463\3637\300\272\274\034\3010 \243V\226a"
+	.ascii	"R\r\022}0\374\277\375\247\377\314\233s\341dU^\216%E\033\214\366"
+	.ascii	"\302\316\027\324\035sT\237\032\201\016\013\025\236\361\377\265"
+	.ascii	"&`\250.i~\247\376\201q\354\354\302h\367\251\t\360\250\320\371"
+	.ascii	"L%Jm\362\345|.,u\337\020!\375Z"
+	.string	"\3151s\002A\304\201\002\331\302\324\320\356b\214\275M6\323\320e\310-O\355\302\357\203t\305\261\2277Aln\332\253\273\231{ :[\354\351Bg\223\343\341\273g\357J\215\222\035\001\353\016\211\255\210\007\271\005\320<'\fLf1\221\376\025R+9Y\020KP\316h2\031\355U\316b$\262\362U\263\225!\256\323LJj\345\t\215V+O\300\272\2636\314Yt\365jp\2010Q\315j\336\377\216\366\300u\356\2536uG\257\356\204\252W\275\272\027\254Vu\203\240p\245\006\216\207\223\256X\0223\256.1\327ZSD\033M\365\332\350\264\020\262\245\272\200\314\313\354\230\265\321\237dS\330F\225\242##\034\214\002\301VC7\001G\250Q(*\0213C\025\210L\"%I\332`\"\221d\327\001\021\240\245TT#E\005\333\f\351\022\207\013\315]\3322\234\033y\007\246`\341\205.\020jpH\321:\2240"
+	.ascii	"\225\265\262\207}\203H&R\201N\226pX\244\307\006;\361\210\327"
+	.ascii	"\342\356+\n\247P\032\bc7^J\233\334\212\022\032\272\257+\027\206"
+	.ascii	"\036\377 +\263\325\244\354\203MQ\013\335;\027\232\2337\265C\272"
+	.ascii	"\306\250\022\222\307\330\3124>\224\257\235\371\b\257\275h\344"
+	.ascii	"\265\223U\2205\226z\200J\365\002\324\206UZ\217d\025\001\272\331"
+	.ascii	"E\232b\n5"
+	.text
+	.section	.gnu.lto_hermiteSplineEvaluate.part.0.30.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`d\002\265\021"
+	.string	"\206\242qD\360\320&\035\024\377\224\307\306o\f\306\352\231\255\232T1}\350&f\220eV\313\374\234\032\215\025\033\033J\006\303\335Ss\223}\017~\221M\244F\302a\216=#CH\021f\243\344\235bn\335\244\221M\222L)["
+	.string	"U"
+	.string	"b"
+	.string	"\350n\345\036\027\221.id\212\330z\307<,\367\270\370\224i\303\002\226\331\031\360k\201\315\257\235C4\277\315"
+	.ascii	"4\277\326\037\332\256d\312"
+	.string	"ja\270\303I\307,Tp\325\310L\316\357\033\314\3621c\32513\023|\373\030cf0\030A\234\215\024df\267\f\356s\333\222\266\bZ\224\021\316\3626=\035\373q\254\351X\217c;\216\3458\266t\354\306\261\244c\267cG\307j\307\276c3\273\354\037\213\356l\207\200\020X\221y\241h(5\274\237\016m\335\332g\325\226J=\332\265\312\272\314\221\351A8\004\313\"\372*)S\305\020,3\017l~\0022\f18\336\242\374\323\227\311\005\022\305\314(}\343\034\037\tJ\031V\272\201\204H\3777.B\264}t\322G@\017\214b\273]\034\264\377\243k4\336\263k\177'Z5,6\361\236@\350\370\354\331\213\226\016\f\026\265\205\340\022}m\231YR\223\220\020\241\316\361\253]4?<\211f\204\007\236\027,\302\337\364Y->QAIYa\321jB\242:iIAi\300\251\244P\250\224\t\247\202\302"
+	.string	"\305\231\250X8\222"
+	.ascii	"M\255\234\250\270\226TJ\305\225\332\242\263\274M\027\354\264"
+	.ascii	"x9L\357\354\277i{z\353\300)\036\373\370\366\323Gb\255\032\323"
+	.ascii	"\377\217\217\270<\336q\323\265X\253&\337=>\nj\351\274\3345\243"
+	.ascii	"\220\3712 {\307\r\303\t0 \240\202\031#\253\003\37020\206\307"
+	.ascii	"\037\374{\f\361\2408\360\351\201\227\335A\344\324\334`\f\210"
+	.ascii	"Q\253\034cs\205dT\214\367\016S#\370\203\213\030\337\251Op\317"
+	.ascii	"@\035\006\254I\006\203aDa\230i8,\205\353\f\216`\371\030C{n\241"
+	.ascii	"\256f,f`Cq=\nadH~\2076\026l\311+f\201\265g\242\216k\347\tt\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\332\001\025\007"
+	.string	"R\t$.`U\324\0010\f\303\0327\204\303\001H%\230\b\260Q\016\202\020"
+	.string	""
+	.string	""
+	.string	"x\341\271\376\377\177~i\245\225V\006\032$\335P\375 \021\244\2252j\361r*\026'\305[f\223\227\234\034\221\023C\345\304\232}Z\342\314;\314\275\313\267\355nUp\300rn+\327(\317&\307$\277\"_@\256x\034\341x\242qK|\3058\025~\202?|\237\274\033\272K\334\013\333\t\332\243\354\320\330"
+	.ascii	"\330\007a\217#\331Q\275j\300f\005\335\335\327\277GU\037\201&"
+	.ascii	" @\003\031\222\202\016\236B:yxC\257\342\320V\230I%f\002\207d"
+	.ascii	"\361XX=\f\016\217@\374\2734C\022\214\331K\273\317\375\334\317"
+	.ascii	"\371\334\347~\316\347|\356s?\347s>\367\271\237\3639\237\373\334"
+	.ascii	"}_\204\r7\352k\320\r:@N"
+	.text
+	.section	.gnu.lto_.refs.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c5cbf2533cfd47d8,"e",@progbits
+	.string	"(\265/\375`\231\036m\201"
+	.string	"\n\317\220-R0\020RJ\007\264\366\342Cb\026\351\"q+\b\362\202"
+	.string	"\243\f\b\370\361\261u\314\346\251kO\016\306F6"
+	.ascii	"$\343Z\333\371x\365\374B\364\344\237\022\240F\206\341\316e&\253"
+	.ascii	"B\303tq\236\254t\037\212\367X\323=aZ\252\330"
+	.string	"\001\314\230\255'D\312\024W\002\272\002\353\002}~\314\345/\n\202\004\315\233s\007\215 \373\206j\317c\332s_u\007\246\342\313\242\321,\337\032\035\023(\306\356\256\311^Zt\217\365\324\262\360\026\326\302j\274\307x\347<\226\322\224\261\033\363\325\262g\271\026\207\327\332\363\324\016\313\r\227\024\252\276f\257\200H\001ol\nI{&\323A\f\250\216\347\302\254p\025V\343:\246C\003Q\363\245\003\311R\220={\265\347\037\355yG\016?'\3410\226[\231M\317\213v\257\264'\370\004\207\024\277f\251\200\240\031\262&6\327\354Y\252=K\315\274\366\230@\241\253\206\235\351E\247yQ1j\226\350\275w\n\307\361\033\2731\033Ca8n\343(\254\306R\330\311\371\t\257\235\225\336\273L\263\222.9U\247\346^8 l\367^ \264S\271\016\215\243at\325{\357!\030c2\226\302JN\r1\343^8\253\001\252"
+	.ascii	"2}\375\335{I\200 A\202\004\t\033\262%\220#\001\260\027\266\375"
+	.ascii	"\344\017A\005Nh\317MN\224t#x\211\366\016\264o\240\375\210\366"
+	.ascii	"\013\264\017\321\276\247}\333\276[\236:\376\020\024\301\037\202"
+	.ascii	",{\b\212\220\362\207`\313\036\202m\003\001\n0\333Y\370\317\300"
+	.ascii	"y\376U\370s\002>?3\360\363\b\024~\363\257*@;xfPe\265J\320\332"
+	.ascii	"\254\020\374\034\374\271\375\371\346g\233\237g~\256\371\031\347"
+	.ascii	"\347\365g\232\257\007\360\257\t\374\334\244\276\375\327\237\245"
+	.ascii	"5g\355\t;Y\2565\377\375\376w\t\303\033,\341\340?\316\3373\340"
+	.ascii	"\224\\\347o\275\377R\376\303\375w\373?\345?\365\177\333\377\267"
+	.ascii	"\377l\377\241<\347\357\271b\334\377\275\377Z\376g9\315\337\324"
+	.ascii	"\026\304>\3637\221\377U\376\327=\3707\327\373o\254\257\177\327"
+	.ascii	"\370\371\354\347\262\237\311~\006\3739\372\363\326\317\320\237"
+	.ascii	"\237?[\375\\\365\363\324\317\316\237\227~^\376<\303\317\034\374"
+	.ascii	"\234\374\331\370s\361g\027?\267\360\363\n?\253\360s\t?\207\360"
+	.ascii	"s\007?\037\3603\211\237u\376\203\371\317\367\377\312\177*?O\360"
+	.ascii	"3\001?\247\370\031\305\177\022~.\361\363\003?;\3603\317\317;"
+	.ascii	"\377\377\376\357\360\037\313\b\377O\374\227\373?@```\340\317"
+	.ascii	"J\371Y\032~\001T\0043\234\303+#\360\237\275\367 Z\270W\251$\352"
+	.ascii	"\245%BM\262\272\210\373\327\335\273\204*1\200:\227\320)\346\024"
+	.ascii	"z\225K!\312\236\346\205*\231\323{{\356r\251\344\340y{\230\323"
+	.ascii	"\353\2745Xq\362\225B\225w\371\274=wy\223D0\227P's\232\344\354"
+	.ascii	"aN\241\316;\205^\236\273Lj\316X\336f\317\235B\271\334\351\323"
+	.ascii	"\311\303\234>\235\314)\224\212\233\230V\300\234\323h\026\223"
+	.ascii	"\225\314\345}r\272Jj\362\3241\245\317\233w/\243-\335&\002\367"
+	.ascii	"^=\233yIS\314\246T\367\244\344$\351I\200\223R\326\363.\353\230"
+	.ascii	"E\236\367\026Qzq\235R(\245uW\213\353\224;\256n\323\322\275\005"
+	.ascii	"8\335\253\344[w\357U\336{i\232W\322{o\3600\243NN\367R\201p\272"
+	.ascii	"W\312\266\245{\033m\217\315\311\234f=\201\332\226L\243\227I\252"
+	.ascii	"\344\350\315\2036\333\251\262\3546\335{\271K\033uF\365\201}\325"
+	.ascii	"|\231R\2015\213\344\346H\030\024)0\255Z\037i\257K\357\2758LZ"
+	.ascii	"n^|>]\244f)\335\251\271\353\202\003\315\256\207p\311R\225\005"
+	.ascii	"\245m\256\216\262Zw\2355{\336\351\275\322\2345\311\306\034\325"
+	.ascii	"'\270\023\030\030\030\310>B\032J\223\304-\013-\310\327\202Pb"
+	.ascii	"\177w@z\013\254\314\024\262f\177\004\277\272\260\3004\3735\254"
+	.ascii	"G\337\360\265\025K\315\032&%f\025\002\253\276\2413s\357\223L"
+	.ascii	"\264\245\272G\333\350\033\\\347\003\203\2602\325{\245;Z\253y"
+	.ascii	"4\016\355\203\325\272G_\275qt\216\203 \353\321Q\247\352,\245"
+	.ascii	"\027\210\212@\246\352\037\212\b\272Gc5TG)\275P\301\254\031L\325"
+	.ascii	"\277{\2458`\346\242N\034\266\241\335::\353\r\355\347QDp\234\345"
+	.ascii	"\r\273W\332P\366\336$\346\003t\230\017\230\231\022$\351,\310"
+	.ascii	"~\365j\277r\265\fb\255j\2772\265=\325T\2546\242\253\3365Z\352"
+	.ascii	"3I\322+\275W\272\323[d\322\316\312\264\347\021\30150\220G\004"
+	.ascii	"\337]\332f\017A\036\376\020|\353\265o\273\366o\347\210v\031E"
+	.ascii	"-\254\331\277\233\r\305\206!\363\346\325\354\323\262}\362#\353"
+	.ascii	"\210[\013\024\bW%\003\3441cq@e\340Z\211.\256\252\204\253\262"
+	.ascii	"\224\305\270\305U\313\230L\022\266fj\033\272\251\227\232F;\365"
+	.ascii	"\262\231\254\3265t\022Y\327\320w\f\256zC\305\306\314\013\200"
+	.ascii	"}Gi\337\323\366]\326\276\307\332w\222\366\215\244}\033i\337C"
+	.ascii	"\3327W\373\006\022\346/G\311\235\263j\026\f\332M\027\020\032"
+	.ascii	"y\315\276\251\272\204\371\302^X\215\3758O\264V\037[T4\232?\260"
+	.ascii	"\004y\362\201C_\305\250\253\3325\273\362\350\033\314.Qrk]n3\274"
+	.ascii	"\302V\350\n]\237zA\2426x]_z\374Xq\2548\326\347\214\246j\363\370"
+	.ascii	"\252\252\201\365\365I\305a&\371\2115\273\346X\241\262\322\364"
+	.ascii	"l\320\324\260\262\302+\203e\317I`UU\023o\216F\331c\352L\313\032"
+	.ascii	"\265F\255Sv[\242;\322?,Z\253\215\257SfMT\3024\273\326X\241v\336"
+	.ascii	"f\220I\261pfO\252m$H\007\005(\006ne\256\314\325)\006\017P\317"
+	.ascii	"\312\332\374\352\344\303\221c\252\245\331\265i\205\252`)g\007"
+	.ascii	"\265>\265\355\360\221\364\004h\325\207\267:u\322Z\004\nV\327"
+	.ascii	"\354j\303\2519uR\033N\315\2564\332\210\016\020\036c6\232]g\234"
+	.ascii	"J\203\325\004\320\257\211L\255$\251c\262.\255KM\265\313\343."
+	.ascii	".\036fG\312\224Y\2275|\265iaQa\253\322\327%\325\211\225\344\255"
+	.ascii	"\3315\251\3054\334\365+\322\354\252<\025\211\036\224L\263\353"
+	.ascii	"=\265\214G\233\225f;\360\371\345K\003*\331b\273\306\374\242\214"
+	.ascii	"y\003\006\323\326\334\310\232m0-\246]\352\002\245'&\314\016\313"
+	.ascii	"*o`l\266\262\226L\371\343\276\231(\017\245)A\032\325j{\271\242"
+	.ascii	"\227\263E\345\217\256\313\333K{%\265\366\245\331\356k\263\031"
+	.ascii	"8\245*\255f\233\313\027>\276\2366y\002\234\343\303\242\247\327"
+	.ascii	"Z\260\252+\023\347\0303\313[\313j\303\224[U\263\275\327v8meM"
+	.ascii	"8H\251\253k\274\013\316\250\202rg]D\356\336x7Ow`n\263m\245\355"
+	.ascii	"\344\300\\Q\331a\331\211K\303\321\304G\023V\203\314\327\025\306"
+	.ascii	"\3432cgg\315v\025%rrM\327Q\232%JL\2351\322\256\273\2717\035\325"
+	.ascii	"F\t \017-\315v\016^qq\375\326\336{\327{s\214\211\326x5\261\204"
+	.ascii	"<\333\332\372M\313\226j\016\340R\0167\334\336o;H\312\250\325"
+	.ascii	"h\266\241\364\024\234(\035\177S\244\254]A\236\246\256\370%\341"
+	.ascii	"S\212\302t\275\345i\007\300\033\2348ij\313s\225\370th\313\216"
+	.ascii	"\350pc\355Meu\344U\341\320l?9u\255,okf\311\344L\272\tSY\020]"
+	.ascii	"\253"
+	.string	"^\252+\237\232?\256,i\357&\324\2340\272(f\263\215\326`IY\310\324\360\322\212\265\022\261\236\006\357e\351\023\252y\251\232>\357$\035\366\036\373XO[\345\275J\351\205\n\321\326\274\253\376]**\237\031\2466+\312\263\367\364|8\367\206\335{C\260{Q\266\2305\333dm\266C\243\017\013\325\254\f\007\013\310\225\034\225\235/\246\034D\244\354$g\214\257\251\332\354\375j\330\310\332W\223f\317\232\265gy\264\377\317\301\233\324\274\367\3360#\275M%\234sDF\242\020i\223\024\036\213D3F\342\221M\214#\322\310H\030tt\024\262!J\"a8\232\371\013\023G\305\242P\350ERX\364s\224$\266\370A2\272(\021\003\311H,\226H\241\"H\305\212\030?\303!\244\242\220\221\370\203<B\372\371\211\341\210|\221<\032i\210\204\303\"\233<2\036\205f\210\220\307c\221(H\300"
+	.string	"=@\036p\020\200\007&\210\340\201\t\"x\3409\341\205P\362HBr\370\301\216"
+	.string	"\037<\364\354\350\350\020\021\035\223H\033\f\223\302!\243\024>$\211F\020\214D\341\00792\212FF\031\024\213H\306\235\013}8a\"\211\024\032\231\030&\205\035\204\270\020\02194\016]\264O\241\242\204\212\0251h\276\202\202\023\024\234\b~\005\005@@\024\250"
+	.string	"j\257\002hM\036\005\265\311 \024\020\004\r\215d\240"
+	.string	"@\262x<j\020434,\"\"\215\202GAC\027B\344\020F\006#\f\r]\270\020\026?\304\030\016\031AP\241'\031\244\002(i$\"\265C\031\210,b8\016\031\2111\330\024!\261pa$\3028\026\325\020!\265X\223(d\364\220\020\t\006b\013\235\023-\032\250E\243h\321@\302F!l\240\030\215\"F\003\311\350\244\214$Q\350X\034\302h\217\202\220C\031\310cRh\350\202\020\231\364@<:\032\265\311\241\342\361\305\321\020\371\"Y\203\223$\026\021E\210aX<\252I\276\300GA\036"
+	.ascii	"%\215n\206Ia\362h&\371\302\200\037\215\206\310\237\344\361\210"
+	.ascii	"\374\271\031\302 &\2050\210\310\341\220\315Q\320\320H,\032\261"
+	.ascii	"\030&\211E\310\341\213\235\003\001m \"\005\022>h\205L \207\311"
+	.ascii	"\"\221\350\307x,*:\n\375\030\211\302\242\037!\344\321\217\211"
+	.ascii	"\002\204\334\202\205x\210\215GbR\210D\032j\207E\243\"!\213\344"
+	.ascii	"\221\260h34:\026Y\f\031\207\355\020\251(\2041s\351\r[\2164)6"
+	.ascii	"\247N\026\264\356N\332^\364\270\264\326V0\233\264@.Z\232EC[\235"
+	.ascii	"p\263\331\227B\256\215J\312\347_\325\276:\361:\333\322\326\354"
+	.ascii	"\332dMk\375\230\3644O\312\354J\263\247\256J\312xp\366\274<A\333"
+	.ascii	"\341\354l\005\343\247\350\nfB\260\224\375e+\030\233q\3511\344"
+	.ascii	"\357^*\237VY&Ud,\354+Y\330\n\326U\234\253\344\221*\331aEg\266"
+	.ascii	"\250\214\325hv\035[\305Z$\355\207|E2d\005\033\262\364R=\225\\"
+	.ascii	"V\304\305A\243\177\227y\345\023\324\361\367\205\314\327W0f\262"
+	.ascii	"We\365\372z\004\317N\316\254\331\267\267]\213|5b\025\225\245"
+	.ascii	"\310\030\">r\240\353\363kO\303\027$\310\032\275J.\007T\261\335"
+	.ascii	"U\377ht<\243\356\270\276Fu\346\300r\3705\273\nY\265j\346\310"
+	.ascii	"\264\242\320HYw\254;\326\2554\261\365\007\324\022\250\365\307"
+	.ascii	"\327\255\234%\247\034\\\315\256=V-1Z7\002\202\203\250\242\001"
+	.ascii	"5\007\303\312\220\241\222\021\221$I\322\001\342\n\020\004\303"
+	.ascii	"i\036\310\316\003\022\340\0245\221*\247T\221H[P(\264\031\003"
+	.ascii	"\344\323\371\312\246 \374\355\203M\262\337]\337o\333\003\224"
+	.ascii	"C1r\226\2442\343\254%\356\035:C5\365wQ\207\247\231)\314Z\361"
+	.ascii	"3\332.\262\036\202\316\013\313V\330.\235\"\302+\241{\3648\"\341"
+	.ascii	"^>\203\235p\330\370\347\323\034\343\t\307\253\305`\203F|\342"
+	.ascii	"\224?\b\252\221U\022\225\341"
+	.string	"?.\314\214\202f4;\363gx:T\222\201]n\b\330\026\240\236\355:\353\370H\023\254\nCX\244\330.\030{gq\247\303A\001\002~\316z8\315.\363\202a\222\004\331%\232\212\317\250\323A\na\213\310rM\365k\306\331'\"\026\277\024\232O\224)\303\373\255\322Di\244/\n\352im\263 :\fZi\307\200B6\227z\327f\322\005\026b0\306]\037\362\350\240>\270\177YC\313W\222%p\262\214\230\205R6\230\260^\360a\0327|\203k\033H\251({_\236\017\b3yq\021\017\216\030\351\274x\225\025\251\b\025Am~\t'\3711\006^\201\t}\023\241\177\266\3353\256\231~G\264\374ui-\247\fxd\256\226\"\374\357\310\234\322\201C\214oN\326\344\274`9*\\i\016\330\024A\352\027gb\352NpF\223\346Z\270\200&]\263Oe\316\216\031z\257\337\033m\302<{)!"
+	.string	"\335\304&\256\\\2601:\321e4\0051\221s\027V\034\204\231\227\202\222\303\211Q\312l\025\222\361\f\307g\\E\251+d\304\200b\226\316\374\305\r\031\365<\021\253|\277\353?\251@\272`\\\213\222\233\203\357Z\361\024t\021$\255\224,\027\345/\0045\375*\245\2313H\331\032\030\235\273\343\027\r\240L\347\326o\177|g\233~A\335W\026\333\250R\267\t6\333"
+	.string	""
+	.ascii	"P\251\305P \267\1771\022\245"
+	.string	"A\005$\256_\327\273\203\022.#\"\254\317\260\241\274\253\220\2017U\210\361\307\b&\303z\006`\260\251\355>~e%w\332\274.G\350<\030\345X\030\2643\f\352\337\36634!\353-\300\246\3706\342d\020\nv^\232\266\244\035\360DoZH\\\r\003y\032\001\247Q\231\367\017\\\245\322\024/\023\"\036\271\272C\027\3241\332{\223\257\357\341\264\020\t{`\241~.\031\317\342\211\264{N\326\222P\241\365\220-\306z\330;\213\321\207\300\336r\253\313\301\274(\310\305\372\r\252\264\266\212\016d\253\300$\207\025\336\364\344d\306sY\242\267\245\342\316B\261\243T{\027\006j\247\255\361\330\312;\2166\366\177\005\201\026\204kA%\314\330\271\362\364\207\366eH\320\352\333A\0304\027\363\r\3462\007\273\b\275\024\212\247\321&X\031\302|\300v\035=@\267\b\272\033\343\037\253R\231\211l[=:\376\210b\252\214"
+	.string	"\350\371a\035\362\200\334\222\2051\224\t_\223o\304\216\036\201\226Y\007_\251B\320\325\200Y\276K\222\306\226@\360\374\324\247j4hLt\007\201\361X\312'n\026O\240\352\376\305\266\341I\321AA\212\031\220\243\353VT\223r\204\262\f\272\247\262\027^T\340r\177c.F\034\202\306\372\212\027\321(r\206\315\036\022j\337\177\020\030&7\244\222s{\311\005\300+\300\345\336Hr\363\324\202d\334{/x0\321\022\020_\363\b\335\254nh\275\244\306o\230\272^"
+	.ascii	"\245U\263\001\007e;9\326Ni\220\242\001e{\367\034\363CDh.0\311"
+	.ascii	".\321\365\266{yX\002\224wY\274w\241\364\362\351\326(\227C\343"
+	.ascii	"G\324yP\372\261\355\305\370\207\314\203\331\271\304\271\204\330"
+	.ascii	"$\362\376\250\205\306I\302`U;0\345\006\336\306\030\257:^*X\035"
+	.ascii	"\210\347S\316\2478\203\305}\310\005\314o/\344\027.\303\341\373"
+	.ascii	"\226\f\214\377\264a\376wPq\370~,\227W\267\353\261\367P\017\025"
+	.ascii	"\007y\371\241\317kh\303\fW\274\262\305\017\377"
+	.ascii	"y\277\220q3\364\276\263\243\006o\373K\215&\177Ffe\033\302\271"
+	.ascii	"\341\366r\356\342\340\374\245\200#I\233xfxZ4X\021>\215\301\006"
+	.ascii	"\023\266\341\347]\360\255q:8\013\261\031\310 \211\215\267\300"
+	.ascii	"\344\355\332\201\035n\373\030\345w\202\347\363\213\364'S\006"
+	.ascii	"\301b\033\237\201\t\034\204G\323~\310@S\2201\263\245\361\271"
+	.ascii	"\243\r\341\302\034\260\302\345\241'\330\177\203\241\304lk\003"
+	.ascii	"\366Q|v\307\2518\215\354D\316\272\026\316E\342\270\371o\267B"
+	.ascii	"_:L\337\033]\253w\324\216"
+	.text
+	.section	.gnu.lto_.symtab.c5cbf2533cfd47d8,"e",@progbits
+	.string	"nullFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"slewFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"slewFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"hermiteSplineInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"hermiteSplineUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"hermiteSplineEvaluate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"trajectoryLimiterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"trajectoryLimiterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"biquadFilterUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"laggedMovingAverageInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"laggedMovingAverageUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"floorf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c5cbf2533cfd47d8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1591 @@
+	.file	"maths.c"
+	.section	.gnu.lto_.profile.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`%\006]\f"
+	.string	"d\022\031\007"
+	.string	"$"
+	.string	"\304\314\325\305\n\020\002"
+	.string	"\001\341\333\245\345\002"
+	.string	"\002\272\325\343\203\007"
+	.string	"\003\337\352\303g"
+	.string	"\004\203\270\227\357\001"
+	.string	"\005\264\245\347\210\r"
+	.string	"\006\346\353\250\236\002"
+	.string	"\007\246\275\205\302\005"
+	.string	"\b\331\342\325\255\b\004\t\350\362\353\335\005"
+	.string	"\n\246\240\335\225\r"
+	.string	"\013\347\231\311\265\t"
+	.string	"\f\267\332\206\371\013"
+	.string	"\r\271\225\217\236\002"
+	.string	"\016\352\222\314\276\016\002\002\001\002\002\017\223\242\326\261\005\026"
+	.string	"\020\326\331\347\361\r\004\021\350\355\231\037\022\231\274\327\315\004"
+	.string	"\023\202\362\202\320\006"
+	.string	"\024\326\360\230_"
+	.string	"\025\244\330\372\372\n\f\002"
+	.string	"\002\003\026\360\232\325\316\b\030\002\004"
+	.string	"\002\005\027\257\324\327\335\f \006\003\006\002\006\030\356\322\327\356\017\034\002\007\002\007\002\001\002\b\b\002\b\031\242\333\255\257\0038\t\t\002\t\032\333\332\376\205\007d\n\n\002\n\033\234\341\340\262\001\220\001\013\013\002\013\034\005\002\005\035"
+	.string	"\002\f\002\f\036"
+	.string	"\002\r\r\002\r\037"
+	.string	"\002\016\016\002\016 \244\246\246\251\f\006!\275\305\343\240\f"
+	.string	"\"\354\261\352\343\013"
+	.string	"#\364\207\213\233\001"
+	.string	""
+	.ascii	"' @\002jfl\341\006$\270n\213$V\235(\013\300\372%\272G\203c\001"
+	.ascii	"\2543\3721\200r\r\201m\200%\031\r\034`\222\f(\"\f`\235\221\304"
+	.ascii	"\243\3564\327u\2132}\326\342&&\344v\376f\214\334\334\3067w\006"
+	.ascii	"\253\354\366\340\321\361y\245.Dky\302\364\333.\224g\341Y\tX\013"
+	.ascii	"\244\201!"
+	.text
+	.section	.gnu.lto_.ipa_sra.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`;\001]\007"
+	.ascii	"2\211\032\032pO:\374\377\377\377\377\371\275\343\252\277\376"
+	.ascii	"\372[\023\310CmoBH\222)\245\264\230+\224~\"\211@\036\216\206"
+	.ascii	"\225a\013\345><\005\323\377\004Yg]\237\336\323\2148Xc0\026\\"
+	.ascii	"\2029\351\372\253\317\375\242!\273W\250\035\bV\300\fP\344ZQ\257"
+	.ascii	"ZK\217\351\230\233\333L\221\317\224|\364\207\307\2224[[\236\027"
+	.ascii	"\032\023? \260\002\242\252n\266\270\005Y\ft\300\342\260\305\203"
+	.ascii	"=\3448\006\363\020j\260c$\036\322\026\036\244\351\342\210ZD\203"
+	.ascii	"\274t\260\231\002\344\0022\230G\024\036\221\330\312\\-\306\324"
+	.ascii	"`(\n\226\207\002D\222\300\257\200ES\261\324\246m\267\314\276"
+	.ascii	"\326\"X\220\025\2756\034\203\260.\200\022/\3008*\334\274\034"
+	.ascii	"3c \035D\004\006\030\314\250\325\330Y\206=Vt%\237`\232\247\254"
+	.ascii	"a'\005\030\002"
+	.text
+	.section	.gnu.lto_.inline.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\262\f\215("
+	.string	"\226w\262G\260\230M:\fHFp\241 p\325\360Pu\335\007Z\035\273\265\001\214\356\327a\033\266\034F\347\023\214\311\251?m\314\21203\033\032\373\330\241\276\211}\224\247\034\030Vs\321P\350\210\205\231\265\360\033\355[\211\335;\311\024\217"
+	.string	"\245"
+	.string	"\244"
+	.ascii	"\241R\360\374z\316\353!\\\227\020\355\235R\360\276g\360\035q"
+	.ascii	"\221i)i\212\345h\035#i;fe\035\243V\224\306\201Q\035}\216\264"
+	.ascii	"\2730\337\366\317s,tS\013n\307\237\227`\241\233\n`\r\035\206"
+	.ascii	"~\030\316\034JK\351\313\231\247\347\364\247\017\372 \317\r\316"
+	.ascii	"\f\322\244u}\373\3133\343\342nwi|\337v\317\006\261\2739\373\263"
+	.ascii	"\355\272\252\355\357j\275\241\256k\270\372\210w\343@\r\336\246"
+	.ascii	"n\240\256wP\317\261'\356\356*\260m\f\023#O9\017v\345\241\260"
+	.ascii	"c\320\t\036\354\033,\255\267\250C\311\021\023\313-\273v\251>"
+	.ascii	"O\021\245\024d\202W\325E)\005q1\200Xt[\177\342\221\222\217+\236"
+	.ascii	"Y1\244\227\350i\303H\233v!&k\343\006W\272C\277WP\333I\023|\327"
+	.ascii	"\340X44#I\313\323@\024(!\0240\273L\334e\322_\321\004%\364\262"
+	.ascii	"g;\302\250\262cw\343\330\347$vs\f\034\202\266E\317E\235l\277"
+	.ascii	"\346;\006\225D\232\240\206B\257X9\324N\nd(\213\223\265/b\027"
+	.ascii	"\250\306\337s\244\025\207.YJ\322\002\300RN\337f/6\r(\262<\013"
+	.ascii	"\243c\217] \231e\276\357\373\276\030\373\260\023\001\247\345"
+	.ascii	"\332\177u\264\345\312\332s\243\335}1L\346\366}\021)9\332\301"
+	.ascii	"\3305cy\273\226!Sl\274&-A_\202JD.\236\330\276\362\347\356\250"
+	.ascii	"XJ\252b\031D\241\244Xtu\375\351\232Nzr\360\304=E\023T\320\364"
+	.ascii	"\004w<i\367\f\375\031>I=y\241\240g\361\323\215\036|\223\243\272"
+	.ascii	"\361F\301w\360\251<IA\231q\261iW[\214\211\305zh,\026ap"
+	.string	",y\342\211&5\244\356\211\343\311s\025EDBlO\242\302\022\266\355\226q\337).\"\325\264\364\td\212\300\312\356\b\3315jwD\214\303\003\321@,\020i.\\HU\025\225N\271p\247\252**g\261! ewU\027\255\354\256\215\320\f\370\214-&\202,\274\306\026\023A\017b\002l\377\330\335\007>G\322\232Q[\307\350\006M\273\322\256\264k\334\271'\266\330]\b\323\306&\200\234`8\323\365b\266\265\254\2354\246\224k\334\213\354\256\214\377\275}\366\355H\255\331,\f\225I\243\342xq\374\2112\210\\$1\021\313h\334\003\3242\250\265\030i\265\030}\351d7\027\201\023\250\361D\306\324\f\211HR\220$\215\001\021\005D)\344\230\243|\022\300c=\306\002\rBFHDdDDA\322r\222\2351\272\254\370\ta\335T\255\006\261\b\013\267`\203\377\211\255%B\370\246`k6\371/g("
+	.ascii	"\016\350;F\373\001\237\371\206\"\262f1\221\225\020/ve\244\020"
+	.ascii	"\311\240\234\326\273t\224\201\353\372\341+\022g\370\023}o\226"
+	.ascii	"\325\330\007-\013"
+	.string	"qx\262U\016!(\366\212]\201\246\022W\b\231\245\024m4f:I\031\356A\036\347\362\350yZcQ \231\301\344\250\237s\242\245g\263\001\214=\213\317\372\301\354M\321\242>\362\217\307\001$`\337(\230v\332\212\340\333!\253\357\234\250\353\350\355\237\227\210\246\330<\370w\304\005{\254-\206d#\312jG8\365\310\316\212\035\307G\0278\356\342T\255_\3101\245\215\244VDW\357Fc6\225\377fKM\013\237wIaV5yZ\333 \026\301\226\025\213&\030!F\232\007\351lT-*\233zU(\221\267'\264\203f\264'\350\373\007\037\262\203Q\316\f\302\200\267\255\325\0053'}\363\013\257\007\244\250$\350\356$\370\277\214N\225\346\266\r\200\006\304E\001x0m\204\007\fo\347\363)`C\213?/\246O\221\226\200\016y\236\030\263-\211\244\001\227\324W\177\236\327\\\266dep?y\235\244?\257"
+	.ascii	"\236\376\223\256G\301\204\364\372f\262\327/\200\256s\273\212"
+	.ascii	"\035\275X\324<\3606`\264.[SF4$#\345\177\320\rp\026\202\366 \016"
+	.ascii	".y\305q\243\353\312aq@\264\347\270\230\355\275\2159\217\371K"
+	.ascii	"\201X\330w@\223\256\021o\335\270w\025\025\360\004|\216f,\037"
+	.ascii	"\361\021[\203D\324\340pT\215\261\204nb\215\374\007\b\27148Z\373"
+	.ascii	"\031\303\302\t\200\362\362\252Ng\013\220\027\006\032\203S\024"
+	.ascii	"\234C\337\020\f\307\301\020\273-\323\3549u\274\242\243\243\337"
+	.ascii	"\026Z4\260\377rY\032\225\200\316\360\001\273\324\032Y\013<\344"
+	.ascii	"1M\200!=\364\371x]qK\356\373\362\013L\027\270\027\004G\271\005"
+	.ascii	"\206\263\357\362\013k\224\2104YazGR\336\325\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\255\001\265\t"
+	.string	"\002N,-\200K\322\001\320\fz\234\204\300 \0038ev\266u\005!\003s\30702\300]\307\266m\333ZBHP\333\376\337~kd\023\271SJ\001\214\374\210\022\371\222\017!=4\307\241\201a\201\n\t\b\007\216\301kY\255e\271\254\360\235\253|I\353\202\306?I\371\312\214\030\344d\332<\021\301\304\246j\033\363\315<"
+	.string	"\371\220\300\343?\001M\322\374\006\340\262cU\352\252\310\222\2008\213\261\326\315\006\206\207/&~\312?\362n\177|\357\302\336\245\204\220\243\032\037\030\314D\3364YP(\316t\3512\277\322V\231\371\252-}\372\023\237\371\315\264\3551\202\316\b; \200\202!\242j\007vL\f\201\021\276h ,NE\034\367`O\343\025\306u0=\2552^\325\266"
+	.string	"pC\022.\320\245\341\\\245WXY'r\266\262\305\024\360\215\031\236\306|\247\325\026d\234"
+	.ascii	"\203k^\315C\333\201W\024\0055\260hx'\355b\254|\211\265\320\244"
+	.ascii	"\023~\204\370\216\005\313\336#\375\001@\022\233l\232n\224~$}"
+	.ascii	"\261\210f\240\205\r\213delt6\231\224\2077c[X\360!"
+	.text
+	.section	.gnu.lto_.pureconst.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375 q\365\002"
+	.string	"\022\207\026\036pO\206\003\374\237l\375\002\256\377WUUUu\004\244\372\353\257\277\376\372\353\257\275\246\311\016\017\364>\317s;\22337S33\0233/\3232+\227r'W\362\"\017\362\036\3231\033\227q\027O\361\022\017\361\016O\206[x\2047x\202\327\257\300\023\340\221tUH)%\n"
+	.text
+	.section	.gnu.lto_.ipa_modref.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\275\001\025\b"
+	.string	"\202\312!'\220\031f8U\377\304w\207\"\3277}{\317\372\220>\226\231\231\351\350\354\3705\340\277\2334\303i!\324n\334M\312\024\377\263\263\212\302\246\345\024\022\020\220\003\003\247\371\204)\305\213\244\337\357\205\326\345+9M\301|L\251\224\340a\362\277U\261\021b5\277/e+\262s\204\346\274\225/\034\370\271\002\253\002\343!\242a\021U\001\345"
+	.ascii	"\007\0332\030$\032\027\020\016\320S\214\372h\371\207s\317\026"
+	.ascii	")g\023\233~\315\334\2119 \300\202\031\261\262\003\221M0K\340"
+	.ascii	"\313\253\240\017\315\246\222\200\360\371d\fZ\024}14Gcp\361\245"
+	.ascii	"Y\3426 v1/\213|\320.f\216\322B\026\212]\304\3360\240\031\276"
+	.ascii	"^\203\316\201zZ\312q\246 T\021h\341/.\2475\036\244\273\"6\f\233"
+	.ascii	"&\020\210\215(\2152,\373\246\303\246\270\335E\0036\244\036\222"
+	.ascii	"\026P\360>$6\361hD\216O\217\013is\b"
+	.text
+	.section	.gnu.lto_.lto.3e6a1d117945e410,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sin_approx.5.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"\035\f"
+	.string	"6\027SA q\223\016\037D\226\020\002\322\017<\270\300\027|h\222\261@\341\364\203\005\003\003\216*X\311\307mX\366\f\225\266f\021\306+\264\364\020\300\322\301-\244\266c\323\025!b\031\003ml\215\354\275\245L)A"
+	.string	"?"
+	.string	"B"
+	.string	"\0260\027h\210\240\270\261\273Q\363\f\374s\027"
+	.string	"\377\324\003\206)v\247\211\371\035Y\351\316Rru\006L`\224"
+	.string	"\310L.3c\203\215\243\236$\031Hf\225`w\235#Y\206\373\335\266\002\333\321~\203\252\351\324\364/\001:\f\330v1\244p\254\214\307B\304\265\337\306|\2241\2665\nnU, QCew9\177\346X\376\362'o\276\354\276\030\261bw\017\270\200\345\317\266_\342&0{c\020Z:\202\017+*\252\375\003\246:8\221\002\222+\326\374\003^S\037bb\312\224\241^_\212\030\"9\236B=\352\233\026.BR*d\312\326J\251\034P@\240\204\260\236T\327n\370\323\377\236v?\335\001\244\020\310\303y\334\237\316\b\002\311c\305\320eY\327'\206@\036+~D\243\330!\340+\302\003Q$]\227(b\366zRq4\2447\333\271qv\232jr.\237\252\222\3300\237\332\022&\300\217T\352\002\024"
+	.string	"f\020\302\251\031\235\270\202\027>h\250:\354U\251\215&\354\2350\333\213\261w\246\r\256qB\304\2161\016\322\214="
+	.ascii	"1Q\341\n\240\362\264\264G\003S{"
+	.text
+	.section	.gnu.lto_cos_approx.6.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`:\001\275\r"
+	.string	"\226Z]C"
+	.string	"\221(\035\233\270+)\256\317\373\300e:\315>\372\027\205\276\377\004z}\361'P#W\303\r\206\372%\032%>\004?W\f\256\001M\250W\225Q\023U5!\327\240\"\313\271D\0273\215\220\275\267\224)\005K"
+	.string	"I"
+	.string	"I"
+	.string	"\366A<\004g\267\026P\320T\210)\261l\354\256\346\361\216x\370. \036\352\206s\177\232\234\377\3247$j\230N%\177(\327w \245\005\n\200\323\350u\274d\200q\326\363\344D\312\304\022\354\256\323t\272p\303\333f`[\263\357!\250?\237~&"
+	.string	"\314\200\030\273\026^1\353\202):|\365\333\367[\276\362Y,\234\350*\027H\255\354\256\310g\261\346\320\242\213\230\360\266\204\202\017/d\354\356\307\241?\262s\266&\217r\313\231]\026+'v\027\201\rd\207v4^0\250\352#1\252\203\026\027R\336\260\307G\"\324\370\024*\034\341\242\224\243\313\227\257O\317\372F\305\n\023\227\256u\023%\030\327:I\273\335&\365z\223\224Q\276l\325(U\203\375\267\252\222=\215\275t|i\370\325\375\036!\217\b\311#\2719  \b\241\220\216\346\331:\235\215\243yDB:\032\347\003\322@\bx\213\360\340\243\205\266\355\243i\272\253\212\375\024k\300\001\225n\331\316M\246'\2663}\352\331\f\034\256NG\017\313\253\277\002I\2107a\372\264$Q\004\030"
+	.string	"h\020\302\352\360\b\026\334a\366&\252-\220j#\200\227\025\230_\321\020*v\245.s\r/\331\300\331\261\013\\\030\006.Q\325D-q\"A\fc\202\210\n7"
+	.ascii	"\225\247\2526\247hj\017"
+	.text
+	.section	.gnu.lto_atan2_approx.7.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\254\004\365\033"
+	.string	"\366\361\255I\260\226Q:4\204\202\013\234R\352\371\212#\275Z\311\346`\035\322\354}o\307\235\202`I}\231i,\270\3616\302\275;\305\257\362\214\rt\3068wJ\177N*\350\340\245\334\025\032\335N\361\321##^\376\267\377\223-eJ\001\233"
+	.string	"\206"
+	.string	"\235"
+	.string	"8\022(Yh\203\373\315\025\023JL\3118p\321\b~6\016\\\237d\241[s\366\200\201c\316\211\300\006X\027m\3731.\303\307\026\312\337\321\212\013\311\005\001\247\346\2345\233\313T\027\345aT\027W\305}\356j\261V*Q\256\372\370\253\007\362\205\t\241\007\335\317]\273\267v\003z!J(k"
+	.string	"\n\021C_\311\002@R y\220\020C\222\306\3631\"HU$.\216/]\007\225.\335\210oL\207\2236s\316\007\257B\272\233\352\352\301\234\323\352A'\342~\335v\317v\003[\266\b/+\333\3238\004\336\216\307\b\345\246C\303l\314\322l\270\354\313*\330\005\307) \035\332\277\037]#\373rn\221]C\243\231\315\\-s\265\354Jw\314\223~\2303\335/\377\375.-,\2617\335\260\253W\256~]\355\272\272u5\353\352\325\325\252\253\305\253\345\325{\265^\375"
+	.string	"\260\"\274\023)>,\221\337\0041\2342\245D\035,\256\3643\375M_\373\366i\330/\265}\374\245\003\037\364\253\311\304\002&\013m\216\002P\212{\355\3126H\342\332\3272\240\222cG\324Z\327\326\200#\257\210\312\220\326\336<\215\275\243%F\244v\340V\313\332G\251v\265\002\242\306\336p\250\223\342\252\026\300\023\271\342\002"
+	.string	"\216=\022TP\314)\273ri\200#\017\266\272\273\263\247\261\367\265\360<\250)\251*\272b\324\210t\023\336\t\347D4\355`8\234\302\315\tD"
+	.string	"\266\337\357vK\306\336M\312Vfg\366\301\277<\215P7\035\312\354k\\y\300\321\311M\207\3279\347\317\256\221\205\266\225\200l\207r,\226\216\340T\212c6<\026v6\202\004\036\n8r\3039\33497<\027zptj\031l::\266\234Z\006\f8:\265\234\035\236\332\r\3156\r\026vj=6\333N\355\365\233\227\337\"\027\037Z5k\311b\331\226\226\215\215M\244\200\366\346b\331\232\255Y\032\231"
+	.ascii	"\265\202o!\371\252\254hk\251\212-\013\314\316rBX1I\333\b\273"
+	.ascii	"\341\210\364\034O\200\020\255\326\310/\342S\"\322l\005\337\017"
+	.ascii	"9\333\330\n\271\354,7C5\253\021\004E\212f{vQF$q\215\274\301\347"
+	.ascii	"\244?\362%\355\314\302V\310\366,\027c\311\307\312\262v\266\277"
+	.ascii	"1\006a\250a8\304\224R\210\221\210\210\244\260 I\007\320\002\221"
+	.ascii	")\243\007\020PFE\232d8\200\321\233\345\243\230CQM\005\342\327"
+	.ascii	"\351\223!\320@\354\023V'1\321\304@$\355\020\3222\233\366\273"
+	.ascii	"{\223\021~tc7\366\212\271\220\327\261v\301\006\001Hg\020\302"
+	.ascii	"\346\367hL6\023a\330\023\366\257y\344\016\336\314!\f\251\240"
+	.ascii	"\326_<\036\255\357D\332+\200V\342\343VkkOG\024ME{\336\317B=\264"
+	.ascii	"Rm\362( \324\036\323\274W\013t\365\3129p^XX\252\224M\315^5\320"
+	.ascii	"\322\233)\340\314\271\032\032\"\271\340\243\032s\027\276\270"
+	.ascii	"\001\257R(4\222\272\301,\022\340\005\002\304^8'u\234*\333[\177"
+	.text
+	.section	.gnu.lto_acos_approx.8.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\374\001m\021"
+	.string	"6atF\340\322&\035\222"
+	.string	"\002\206\"\331_\310%"
+	.string	"=\314\355\326\317\361\214\3221\3166kj\220*\374J\027\227#\203}c\324J\217\005\373\266 aZ\031c\234#=FE\0207\312\307\202\t\036E\2266a\267F\310\2262\245]"
+	.string	"W"
+	.string	"g"
+	.string	"\246ky\036\207>\355\342\330\231\261\273\r\314\300t\315\266\277\342,Xv\030e%L\234\310\305\314\317\321\356v%/\260]\213'\260]S\022g=j\262\374\326\343\301X\021\r\254\346\032\027\f\215\350\001"
+	.string	"\346E\022\033\240\232\373<_0Wf)ew\23540\017\267v\333\021l?\260\023&\226\265Rs\354\307\335]+\216\310e7\352=7w\236?\344\351\323\323\246\247KOoOkO\307\247\365\351|\372\001J\340P\202p\227\303,i\205\264\032'.\373{\2366\313oq\037s=\016K<\001\373r\301"
+	.ascii	"\035\310\034\232Z\035\f|D1|\354\356\3115\237\004/>\036%5\351"
+	.ascii	"\026\364\331lZ\322\322\317\247\223#\204\210$O\323MG\200| \247"
+	.ascii	"Q5=\260\343"
+	.string	"\323\371\360\312 \204\344\251FE`\343\263q\205\007\241B\003\204\331\314\b\207SU\0052>\235\230W\373\002\206\3554\251%\236\266\314\251\303;\275]\031\223\253\204\230\216\017t\345\314!\312\351}\036S\304n|G29s*1\371R\001\306\205e\265\305\334+(.\023^TR]\213*\225R\255t-\024TR\335\312\312\245C!\261\312\002\313\252{Q\251V\035'\333\307U\034\377f'H\242\006\250\210\236\364e\373\244N\221QWD\351\214\221P\024\321\203\261\242\017t\235\306\217\241\033\325\034\207\266\323$DG6\240\360\001\362\022\311&ME\351\203\002& \200\202\221\200Q=\355\b}(qZmX'{i5\246\266\306\nwm\025\247c\223\013m\304i\347U\366\313\251\203\233\207\206'\370u@eb\261q;j\2535\244\357\340mF\303\001\357\325\036\037\265!\265\315\267\025\217s'`\300@M\204+"
+	.ascii	"\371\314\345\362\\y\017"
+	.text
+	.section	.gnu.lto_wrap_2pi.9.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\236\002\205\023"
+	.string	"6c}G\340\360&\035@\030\254"
+	.string	"%?\222\364wrTd\203\035P\323w\213\343\324ow\305\317\330\340=\350A\272\230\213\266m_SnMm\363V\207\201\300\031c\fkY&o>\034\317\204\210}0aO\266\021B\366\226;\245i"
+	.string	"_"
+	.string	"k"
+	.string	">\211\227p\3317I\343\340\341H\027`N\324\330\335T\310\005t\237\362\001\272O\335p\327?\257\233R\243\313\267]\216\350I\212\221\275\376\025\360\376b\346\006\224\301\304\316C\311\241\271\371\364\220\2052dw'DYs\225\006\216tbx\310^$\b\016Q\315m\2172\262X\214\036\312\356:\306\310h\356\323mW\260}\300\216A\001Qg\366\345\352\216\335\301\001\242^\373\371\277\323n\357\265\273{\364|\264|\264>:>\372"
+	.string	"PDG#+v-\344\232\0267\203@\234\366\327\036m\227o\3426\2035\227\3575\363\241\230a(\241\371\366\275f\006\204H\031\224v\227\344\323$\337g\374\217o>\355\262\370"
+	.ascii	"\264\273%\036\371>m\007\240~\330\350\330\214\246J\005\365.B\237"
+	.ascii	"\330\215!\n\264\031S\347\222\352\247R\343P\350\023K\261\273]"
+	.ascii	"T\325w\032\265\305\223\013\225`Rgw\351N\212R\004<I!\316U,\035"
+	.ascii	"iP\235\371f;\212|\372QC\303F\364\022m\370z\322\313\b\213`\267"
+	.ascii	"\3474\341p\353\004\271\\\323\313.L\344\323+\003\036\2430D,\346"
+	.ascii	"l\332+,+,\t\255\311z\313\255b\302\342\240\225\242J\255\254T\252"
+	.ascii	"\225Jj\345A\212*\245\302bI\231\200x\025\241\001+\325Z\255X)\220"
+	.ascii	"\266\227\253;^ \302\343P\005L\035\250\020\206pf\207z\236z\304"
+	.ascii	"\264\300\3014\366q\350I\217\221a\330P\002\362@%`\323\241\323"
+	.ascii	"Y\207\236\364\334B\237\270\273\257\2513\267\b\025)J[B?\361\244"
+	.ascii	"\235\312\330\206a\302\0053 p\002!\301\253\007R\024\032\267\004"
+	.ascii	"{\365\036\314\266k\0214\341R\251 \2120\263\r\202\313\334\214"
+	.ascii	"\006/\027\362v\254\3409\350\365}\243\231\300\207\337 \177y\003"
+	.ascii	"hz\020\206l\363\310\336&\213\021\037o\034l\373\262\r\007c\205"
+	.ascii	",a\f\317\344l\027\267\261ak\260\004\313\307\346N\216\021\230"
+	.ascii	"\251\311\341\022@>3c\226\214\004\306\035>\"\3046\346\245\267"
+	.ascii	"\340\034cJ!\240"
+	.text
+	.section	.gnu.lto_sincosKernel.10.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\026\005\335\033"
+	.string	"Vq\254J\240\326Q:\202\350}\256\274\365\326I(#\245#J\r\216;`\376B\023=\266\347\244\275\336\0161 i\215T\327\337\234\237\331|8\250\265\360+\200\243d\264c\205\004/N{\352\035>\001\263\300\024|X\275a\t!D\356\224\002\225"
+	.string	"\205"
+	.string	"\235"
+	.string	"\255\334\b\030\036\021R\222\335\225\371\350\006\306\341\246"
+	.string	"\257\325%\225P\2405\236\204\273\r7\035\300\356P\326\216]\340\214\023"
+	.ascii	"[\023\330\341\204\020\231\326G\177\332\227\361\031\270#\331\311"
+	.ascii	"(\273?\224v\330@\353\343\200\307\310\217\342a\344G\343l\253\003"
+	.ascii	"SlI\004\343\303\r&\273+S\024\307\275$GQ'\316\237+\240x?\271\227"
+	.ascii	"4Id\221q&I\274\360\342\317\250\212\367C\342\352\243\353!_\273"
+	.ascii	"\233\362\263\023g\311`w=y?@w\353\266=\330\206`\217\016\002:5"
+	.ascii	"&\n\246.z\335P\204\304E]\024\246\023\212\252v\277\2369\264\201"
+	.ascii	"\271\213\253D\366\305\325!\3738\376\230\333\370\003\034\370\303"
+	.ascii	"\\\351\216}\351~y\360\206\035\351w\371\364\353\323-\237f\371"
+	.ascii	"\364\3128\255\362i\327\247S>\215\362\351\326\247\313O\223\237"
+	.ascii	"\036?-~Z?=?}\002\256\036Dd\244vE\f\263vj\344\301\342J\377\322"
+	.ascii	"\037\274\332\277\2163]hWP\306\203%\016\003t\257\r\3413\303\347"
+	.ascii	"@\211C\252D\376\020?j\336O\344G A<#\364m\357\207\017\350\360"
+	.ascii	"\355\332\367a\333\252\265\233\273\220'o}\242|\333[\003\037U\324"
+	.ascii	"\325\363\231O<s\030UQ\nF9>\004M\235Kc)\352Ru2\034b\365\236\240"
+	.ascii	"h\212\222T-E\321R\250\302\351\212I\251-\025p\344gbE\317\252T"
+	.ascii	"\262G\021\026\251/:\205;\241Q\257\244\2127v?\025O)6"
+	.string	"K'\352\250\344\221\235OU\324\362i\367\003A\303\005P\211n\252\252\200%;!\247\007]\004\247\326\013\206C#C\273<\005`\001\bj\323\366\331o;\022l\264\031y\333\221\240\203\301F\336tpj\025pv4\264j\367\214\306v\341\206\223#\323\241\345\344\320f2\035\f89\262Y\315&\243\2111-\203\205\232\354F\243\325d.\340^\\\035r\204\247)\036\355\021\313\227\032$M\202^/\2759\302z\372d\212A\266\324\304\264Eo\216\244v,6,zs\004\265\273\022\362\311\324b\\\251\231B\336\325\212\336\030\rwW<shS\005\344\223\251\204\030\253\031\201\250\232\274\250/ec'\025#F\276\233\310\217#\020\325\213 \2369\364\241\356\002\232\312M'\001l\250Q`\245\230\251)\231\240\240 )\024\313\001\340\002\221)\333\034\0210\271\203\250\212i\n\303\034\003\206j+\274k\265\354\226\362w\314\301"
+	.string	"\201\0323z9\025\270s\247\220\200\t\252`(\263U\370y\2056oP\337\246\036\347\323(\230\005ATO[HQ\0071\206\226e\345\362d\210\220\246g\264\027\"6\b!\345\373\313\3324hEt\357\220\324lG\214\016y\323\336O\035GLc/uHEvV*\270FD6iHHl\211QS\004_\340\324\273\351\004\013\322*\330\206\262\217\023\311\037\263\305=\006\017c\023D\345\313\253\331\242r\036 T\321\205\241\226\337\031ve2\036"
+	.string	"n.A"
+	.ascii	"\261%bPv\215\370\003"
+	.text
+	.section	.gnu.lto_sincos_approx.11.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`@\001]\r"
+	.string	"\366\330XB \255&\035\030\221#\270Z"
+	.string	"\327qQ\222W\233\233u\002\267#S.3\244\037n\274\004\021\245\314\033[\343JK\264VJ\230\233'\221"
+	.string	"k"
+	.string	"D_\024'\341\307\256=\341\f\311D\fb\367\336R\246\024E"
+	.string	"F"
+	.string	"B"
+	.string	"\002\342\2417;\305;\f{\024\n\022\224jw/\275\360\355\360in\376\005\007:\264J\376:N/#\256\344\372\n\224*\250\310\340DO\203\305\205\344\250\247\004n$3\343\261\273\316\021G\272\343mol'\260\257!7\371\337\323\277\310\240PB\363\262;a\265b]\340\210\223\355c\330(':\262;\210\355'Vy\200\335\222\210\225\335\216\303\b\254Cw\326\323\276\207\177\330n\342\224-vItX\331]\016\037\260\0165> \036\276\007vn\370)\035\247"
+	.string	"\230\330\335g\360\255\022\017!)fCBhY\016\252&\247n\003\242\335\320\306UA\210\026Q\302\370\351\365\250\347\211%\202*\224+\273\003\245\232\354\277\335]k\311>\312\237\371\311\037\003\037\221\215G\303\342Gd\303\001\361D\0077\246\3610\370|d\027G\3132\r\2738 \037\331\205u<\227\206\200\265\220\005\235\353\243i\235\013\243\333{\204t\004\032fF\243>\265\033<\310\217\034\025t\030\013\253\224\247\246\f\201\244\030U\312\001\035"
+	.string	"2\003\302\360\330\302bL \330+h\306<\246e\030\026\003\033X\f\250\316\2261\\\020\212\203\033\\\003\303J\274s\r(0c\2009\220\031\030\t*\256N\305"
+	.ascii	"W\244\251)\343.\337l\017*\314hZ\005\005"
+	.text
+	.section	.gnu.lto_sincos_ramp_approx.12.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\366\001\255\020"
+	.string	"v pE"
+	.string	"\261h8\257\243\361\253\346\320\356\254:\340\204\366\bL\377\354\277\350~\354\323\004\252\301\260\003^\317\\-1\034Xbk\364eC!\207\376\177GP\225\371=\376\274[\225\315\275\341\037\200\221\264\335d\357-eJ\001W"
+	.string	"Y"
+	.string	"^"
+	.string	"\027\261z\214m\036`w\206\002gw\004\361\307\367\316\343\367\264\357\362\020\253\277\370\306\340\356\t\030\234\335\005\261\202\357]\202\023\360\336q\037\340\275\363\312~\361\321\303~\346\0046b\306\356\206\272\362\325s\345\277v0\206\302zz\034\354\2563\206\222r\353m{\330~`\247I2\177\307c~\216\323n\321i\356\320_~\320\323\237\247\301\247\277\247=O{Ow^\232\353\322\352\245\263K_"
+	.ascii	"\200\234\025\"3\273'\267\032k\353r>\234\366\323<\355\177\346"
+	.ascii	"5\203h*|,\331G\202\205\006\006\264\013\037KV \266\242\262\263"
+	.ascii	"\273\037\357,b\231\031\013r\f\352\231x\261\270l\340l\203\333"
+	.ascii	"\255\305\247\036\027\236\202\324\243Z\363bq\325v\263SO\377\002"
+	.ascii	"\021\322N\237\241E\306k\247\2257s\232\032\322T\361RQ\3450\350"
+	.ascii	"\320X\023U\0035\327\324\303n\264n^\203\305\260\255\271\335\226"
+	.ascii	"\007H\257Oi\201\001sq\345\315\036Y\251\035\354s\273\273\326\231"
+	.ascii	"\375)\323\350\024a\244*\371NO\251FP\"\311K\251FL$(\317\302M\n"
+	.ascii	"AMH\215J\241I,\225DRh\"\031\225B\322\t\025\206\034\260HA\302"
+	.ascii	")L\211\342)\004\215{nuf\b%l-u\031\314\016\345\320\220\212\324"
+	.ascii	"\026K\3621\247\r\214\r\246,\177\024T\221f\r\007Y\212\r9\037E"
+	.ascii	"\240\363\251G\301& \340\202\021\331\032\003\002C#\312\300B(J"
+	.ascii	"\262\231\234\251\303c\f=B\342L\340\303\037c\272\311\236Aa\203"
+	.ascii	"u\230t\021\326\030\371\035N\f\223\305\333\253\363\030\243\013"
+	.ascii	"32\021\017\300\235\302\030\004s3s$\214\253;\306+\322|\n\254\313"
+	.ascii	"\213\026\222\001"
+	.text
+	.section	.gnu.lto_gcd.13.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"%\013"
+	.string	"f\325J:@-T:\264-\002\375%\377\017"
+	.string	"\355\374j\030Co\351\354\007\023Y\272\f\031P\255mf\271\272P7\310\256\007\325\3061\314\266\2406@\260k\\Zl\013\356odo)S\n8"
+	.string	"<"
+	.string	"6"
+	.string	"\220\353QI\2765\271G\250\311\371\377\0169\234B|4Px\334\034\302\tk\225zt\036\270\360\204L\377\236\240\256\223\ny.(\273\353\374t\023\356\353\266\025\330F`\377@\316\247\277x\240(\221\300\304n\250\265bI\304T\006\333\234\355\260=S\344y\224Un\354Z\020\211\330\335\210\0130\036\177z\007\316VA\257\324\235\204A\302\007\025\273\213\021x\200\353\021>#\377;\200\370KSA\377\316X\245\250\020S\r3\252*\310\300S\005\2106x8\321I\226\355m\016wwUG~NJ\254\225\365\202}\357\277\216\372\343Q\267\336{\331\246]\026\304\354\201\246\266H2\f4\225\f\323\266,\333,\230\326\240\222a\026L\006\223\f\360\346\340\202\3014\333\206\301\034\336\336\251\252\327\177oDHq\262\245 Fx\272\250#5\005\202r\240\006\026"
+	.ascii	"i\b\204c\030\306\300N\213\017$\020`,\013__c\355\323\263\001\232"
+	.ascii	"\240\226\300\247\t\005\314\201\314\300\210\240\002\006T2?e\037"
+	.ascii	"\216\222U7\325T\215v\225<"
+	.text
+	.section	.gnu.lto_powerf.14.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`t\001\255\016"
+	.string	"\366[bC\020o\225\0161 xX\203P\245\361\252\270\360\272"
+	.string	"\024m\212\306\3738\201$]\236\0210\271ct\320\300\3650\277\237\004\372\206\326\370\332\005"
+	.string	""
+	.string	""
+	.string	"\032W\237\200r<\203\210J]\027\341\032\t\332[\356\224\002M"
+	.string	"M"
+	.string	"M"
+	.string	"\313\021x"
+	.string	"\312\247<"
+	.string	"\312\247v\260\026\206\341\311\345w\313\b\372\224\032A>\353R$\345*y\241O\251\215N\0362\274\221\324\230\305F\016>\232<Q\224 <\256\007o"
+	.string	"%+y\036\217\232\203\335u,y\031n\312mO\260\335\300\276\210\037\336\372W\217\366\355\227\360\301\226I\266P\307\346r\251\026l\237\267A>\313\026\333+\277\266P\207"
+	.ascii	"\022\214Dlw\017|ZA\374L\262Auy\274\312/WvS\204\234\330\335\004"
+	.ascii	".\260}\036\365\024\310~\311\017$\344\260\324\205\026\214\335"
+	.ascii	"\032\365'\254\022\013qv\271\273+\215\340Q7\235*H\032D1\264\352"
+	.ascii	"U\323\203\237%(\031)\204(\206\252.\024#O\365\303\376BQ\003d\026"
+	.ascii	"\263r\2607m\376\373\345U\277\276u\307\257\356W*/R&\030\300vO"
+	.ascii	"a\2145\231#\001\037\016G\227\231\037\t\034\036M\207\262AA\243"
+	.ascii	"\032\017\346\201t\346\342\201\360\301l8N\267\331t\031\216\023"
+	.ascii	"\001\263\3412\035\017w\031\340nC\323\341>]\327\341,\337^\312"
+	.ascii	"\353\234\307p\362L*\250h\352\207-#tSe\021M\007o\021\221\271`"
+	.ascii	"}k![\021M\266-\003  \200\002!\333\016\033\201z\354\025{D-\344"
+	.ascii	"-\016H\223\237\361\201\231\325\266X\321\254=\330\322\355\026"
+	.ascii	"rLq0\330]\203\355t\255d%LB\340\020\254A\300\303\202\241\001\345"
+	.ascii	"%C\226\220,\362\302b\037\357K\244s\321'"
+	.text
+	.section	.gnu.lto_applyDeadband.15.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\031\0015\r"
+	.string	"\006\231YB\020\257&\035\300\324.\345U\257\023\355#\231W\t\367?\203\217)\312\004\327\\\004\002\324%G\233\373\353\250\\?\356\270\356\344/Z\313\222T\004"
+	.string	"H\032A(\356\326\031$\245+\371\366\007\261{o)S\nE"
+	.string	"D"
+	.string	"H"
+	.string	"\273q\3003\340\237\273"
+	.string	"\370\247+\037\035>\2479\362E\016O\3760\260\223;\247A\342\b\240Rh8X)\325\031\310d*"
+	.string	"\300H.\003\225B\363\227\247\tf\312\334p\354\256\263\004\243pon\333\262\215\300\376GN\277k\277sZ\357\362\247\323\257\002d@%\230\331\235\260\265\330\022O\004\213}\030\233s;\304\346\330Z*f\336\005\304\027\273\026>\200\330-\035p\201\352\317\266\257\341-!\0369\355\002\006W<H\330P\263\001\244\334\262\204\003\311\351\351)\025\352M\030H\271\375\035XF\244\034\bL]\220\315\304\220(e*C\250@\241\250\236\354^^\231\210\221)e\312\251\252\207\271\202\254%\205\251f$7[\023I=\331\327m\3336\253\212\3554\f\236\220\305\300c}<\325\347\343\201\025\341\271\263\321\321\300\303\002\305\320\005\002]\235\030r`\201bG\324\02174|A\370\210\242\307u\211\"G\333\253\212\323A\315\023,\262\367.PV\240H\177\004\257&6\307\210\222\354vw\341\323\233\262\031"
+	.ascii	"|\bX\325Q\024\026_d\242\200P@\235\2373\001n\017V\r\025\2000\221"
+	.ascii	"\250\336\341\214]eZ\247\256\201\244\020\026\230\003\203\201\021"
+	.ascii	"@\005,~\346\223\223]\200\313Uu{\253\235P"
+	.text
+	.section	.gnu.lto_fapplyDeadband.16.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\025\001-\r"
+	.string	"\326\230YB\020\221\223\016\177[\006\314\025'\346\323A\370^-\036*\333\2160\316\003\337\324GH\"\232\f\367\327Q\373\250k\324\221`\021\261Wt[I\005"
+	.string	""
+	.string	"\220\245\"x\267\007QR\002v\302\034m\333{K\231RF"
+	.string	"D"
+	.string	"G"
+	.string	"\273\221\300=\340\237\373"
+	.string	"\370\247\032>:|Ns\344\227\034\252\374\001\300T\356\334\307\2113\200j\241\351`\245T\207`\345\204!"
+	.string	"Fr\036\250\026\232\307<S0S\346&dw\235(\330\205{s\333\225m\005\366#\004v\246a\246\337\265\337\035\346\327Lg\246\317\021\260\002\265`\306\256\205\355\306\276x*^l\217\354\216\255\311\210\317\303Pp\307.\213\023(vK\t|\200\363g\333\017q\021#{\306i\033:\034\306\251\002\211\232\r\271%J\211\223\354i\246\n\365\246\017\244\334~\023/-RN3\317\330\316\002\252\f2p\220qQ\312T\246\240\201bQ\315\354\364*\"s*e\312\252\327\307\334\201\030Q\303Tc\222\233\255\225\244f\366u\333\266\315\352\022\237P%\362\251@\037\016H\302\203j\302\263\007d\244\001Ie\305\320eY\227'\206\034TV\364\210F\"\310\207/\b Q$\271.Q\354h{uq:\250\031\003\207\207\367:Xl\344\310\324\024u\210\211\222\354vw\341\323\233VH\001\030"
+	.ascii	"\177\b\030\326Q\033\013:\214\034Y0\003l\001u~\316\020\270\275"
+	.ascii	"Q\353(J\026\324;\267\214u\355\032\3704\241\20090\030\030\001"
+	.ascii	"T@\343g>9\331\005\270\\U\267\267\332\t\005"
+	.text
+	.section	.gnu.lto_devClear.17.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\255\007"
+	.string	"R\21765`o\032\003T\365\326\\s\r\006d\016\325o\372Bn&\310\017E8\326\206\220\325\377\367\266\213{\354!w\225"
+	.string	"4Ja\021\213Fp\201\330\325o\264\345\2262\245\025\236\210\330\214\003\222\bu\264\371\3314m\313\346g\242\243\315\214\003M\316A7\n\0177C\333\306\315\315w[\217^!dR\244\230Q\005\267\0266)\013\366\277\241.\271\300\0208}X\326\242\3132\272\250V3$X\323~#\030;Z[\377\337\350\265F\331\320\032\210iqP\375\03354O\311\025\220M[\303\326\"\036\351\214\022\231\340\367BT\376\217\241\t\230e?\033\\\226\230\013.\313v-\214\277\323\235\362\242\201\262\372?\243\207;\303\2566\211\003J\246\221!\300\303\377\302\222\211\303\215n\213\320v\241\355I\t"
+	.ascii	"3C+\0258\b7d\002+\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_devPush.18.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\302\002m\022"
+	.string	"\006\341rF\340\322&\035R\313|\346v\363}\353n\006d\312"
+	.string	"?\353\312t\304au\023&\312\200:\2002\005\240\327\004\017\324&\304\216\233\236+\213p\2710\2161\3069a\330\230\267\216Q\246I)s\314\222F\b!{K\231R]"
+	.string	"P"
+	.string	"g"
+	.string	"'\216\002\365\327\313\003\354\272nzva$V\300=\032v\021\355\221\373"
+	.string	"\355\321({\307a6{\026>2\304\216v\367\323\020G=BM\224\177\235w+\026\314\343\314!\2115s\205\013Z5:\204\260d\240\310\020\b\035\327yj`\2452\267\006\273\353\\\2618\334\332m\237\330.\261\325$9\263a0\2515\366\341\356\256\325e?\347/\375\365\207d\332\3134)\323]\246\271Lo\231\3262\0353\r3\255\232NM\237\200"
+	.string	"\232!\006A\273\033f?V(\276\270\261}\317v\302\236\002\365\034\313\334\355\306\340\351\331]\022\223p\217\b\340\323~@T<TK\n5\306T$|,S\335\\*z\274\322\307h\350\003\224%\260Ow\021\177fGG\024\336\"$\211Jj\267\234\3072\003\235\211\031\016\315G\254ZB\2525\036y\352\001#\235\0342\351\303\251;"
+	.string	"l\276*\032\3715\365D\252V\312\025\276\302@\334\356\232\370\261\007\0278\021/\332\343USAp^1\001\030nA\005\202:\245\244%\202\013\212\351[9\231L\247\224oE\002\212\351Kai\371J\n\3704A\205\345s9\235X>\017\266\207\253.\237x\020\212\321T\364\224\006\216UQ\214\f\007;A\253\"Om\323a\220\224S\257S\250\244\022\251\222v\272\335"
+	.string	"\342ts\305p^\333\217\246\252\233B\033\252VT\250\232^5#5\252\0267 \220\002\221\271:\017cB\377H\f\261\035\252H\366.\2551\323\312Pj\242\226\2107\270+\277\3362\273\272\256j"
+	.string	"\206+\255\206\240\303\272"
+	.ascii	"\311\316\256\213\300rz\035\232O\267\234E.\020\275\216{\336H\252"
+	.ascii	"\240s\255\b\n\342k\211\221\337C\202\321\306m\337\242D\357\225"
+	.ascii	"8\210\372@H9\216\347\3304\277\3116@v\251\220\r\232?\342\310\350"
+	.ascii	"\214\321\025ip\312\340\345n\223ou5Z\270\007"
+	.text
+	.section	.gnu.lto_devVariance.19.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"%\f"
+	.string	"FXTA Q\224\016\f\301\260]\244i?\213\370"
+	.string	"\025>P\021hN\314\203\211\211\243!\n4T\246Q\365l\026\333v\267UO2\322\246\013\t"
+	.string	"F\b`"
+	.string	"\244:\211\033f\247\310D; \237\354-eJ\001E"
+	.string	"="
+	.string	"A"
+	.string	"\035@^\242\341B\211\032\273{Yn\240z\204'P=*\207k\207\232\232\177\032'T\2308\321!"
+	.string	"\316\343\n+'\026\036\0018\022L\220\332"
+	.string	"\343#\236\035\334\2269i\260\273N\023\227\341\216\267\355\300\366\305\376\204\326\273\177\242\351\250i\230i\325tf\372\034\003@\244\036x\273\030\276\033\373\"\246\370`[\263)\266\237\366E.B{\027\272\200]T\b\212\335n\201\025X\217\356,\333~\210\207h\266\007\273\306h5\243t\332\374\271\t{\251\b\236\036L\247\224\352\207/\277j\214\021\027\244\264a\233\302I\230\304\332]\006\376H\307\202\005\362\350\207\252\307k\201\022\221Q~v'J\375\260\017ww\255([\323\001\0256\020\324\032\314'\002(\203]\234\f\3032\315\305\221\220\301.\215\347sa*\316:\033\317\005\3122\317E\351\366\212r\246=\333y j\207\355\250\226\221n\020BM\265t\322\242\264b\313\317\252P#II\306(\277\022"
+	.ascii	"\022\0230\245\346+\032>d\305\346\3420\021\006\325\260\240\020"
+	.ascii	"\334A\013$,\037_7i\026\003.4\035\031#\240\211HJ`\314;5Z\005\005"
+	.text
+	.section	.gnu.lto_devStandardDeviation.20.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`/\001\335\r"
+	.string	"F[_D\020\2176\035\200I\006\372n\034\362\223\220\357-\026w\246\216R\036\203M#\374\343G\003\373%\351Ga\377\374\261\025*"
+	.string	"\274oTe\325\037#"
+	.string	""
+	.string	"\206\002\250(`\314\026\207PiR\347o\263ndo)S\nM"
+	.string	"G"
+	.string	"N"
+	.string	"\036\376\201\263O\021\334p\362\031\f\024B\274\230sf\032\037P]\306\013\250.W\303\271\307U\316?\313#\007\227\224\367\215<n>\3227rJ&H\031\237(n\2402\244xx%\371:U+\301\234\323\352}%\267\274m\005\2669\354\247\004&;\2525Q}E\265\265\352*\252eT\307U\357\301_7\001`P\013\\\314i!\025c\312H\022)~\313\303\220\203\360\206',\304\306\316\331\230\332W\371\nwP\344"
+	.string	"\3464\275\300\314\t\036\260\201\353\322\340e\333\017{\255ubT\242Zke\314\210E\347\273\325V-F\245NS\020\356\342\223\334\0023\212\342\225P\273&\346\370\356\256hA!R\030~h\320G8\346\232s\"\360EL\210\340\237\\\372\"\373\360\033\244\227\016*!M\331`\247kb?\316\r\022<\030\254=\035P\003\220\016-\373\3304m\363d\037\016:\264\314\363\001e\035\216\267\007\036\237\fd\333>\031f\333`\350k\262\356\205\251\270\200\242>\331V\002\232%\261\035W#\264\2357\252Y[\333\252{q\317\362W(Y\221\021\355H\264V\006\027"
+	.ascii	"I\214\211\245\005\020\3312-t\357Y.\307\373a\325@t\262\204\342"
+	.ascii	"\307\343\271\232\260\\\303\313n\0026\025:h\230\026\342z\r]2A"
+	.ascii	"\202*\034\334\215\244\032\244)\251\306\245\240"
+	.text
+	.section	.gnu.lto_degreesToRadians.21.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\215\b"
+	.string	"\306\320<8@\345&\035\340\253 \016\347Y\331\365\002L\200\221Z\261\243;J\271\200:\025\245\370\266\r\276\271F\017B\245\236\244\303ee\321F\357\017\001s\324\377\206\240Ok\233H\231R,"
+	.string	","
+	.string	"*"
+	.string	"\037\026(5\273\033=/\330\034Z'\330\034j\307\273g\347\377\344V\213J\314\t5zr\032v\327yBi\334z\333\b\266\027l\257\002\233\361\001\330\027\310\022b\273\263;\2663\355\227\334\244\273Ga\270\233JY\331]\005'\004\034\n\244m\177\344$\235\255\262<\017\220\313\004f\370>\232\212]\322\301U\365&\221R~N\275\3364C\312\317\366F\251\034\366\255\325\r[\323z\357OM\037\016\254`\034\\6\034\206m\020\330\003\307\327\207\213\020\201\262\030\322\262L\273bH\002\224\305k\343\342\307\300\332\004\266E\221\246m\261\343\355mU\017IK\266\352\030\001.R\033\n"
+	.ascii	"2\003\302\260R\b0\254.qM$\310\202p`\202\200\023O\252\025\223"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_scaleRange.22.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\357\001\035\020"
+	.string	"f\336iF\360\260(\035\352>\352\031\344\354\345\271\232\375\366V-\216\210\377`\352kYd\0056P\027\017=\270\227\304\220\210\243v\004\211B\267\315\201\005\013i\234r\f\226s\211D\326-\243O\240\206\002\300\377F\b![\312\224\002W"
+	.string	"S"
+	.string	"R"
+	.ascii	"\240e\361`\001\301L\214\00227\004B\230\222\347c,sg\267\303\b"
+	.ascii	"\027\273;\300\002\272k\266}\230\243H\331\262\030\206`]"
+	.string	"\304\313J\205\215\335\365H.\262]\213\027m\327\024\304S\317\224\377\232\307\033\230M\013+\345\311\035\330]g\013+\303\255\267\035\300v\003;)\004\232\366h\272\223\351.\323\\\246\267Lk\231\216\231\326Lg\246/r\227\031)6,\230\355^\230\335X\030\332\213\227\277\376\330\323N\371\260\327\370\0233N\\\r\240eq\225h1`qW\352/\343|U\030:+\227\t\032\273[r\315\n\302\356\242\215\306\262\030\260\026\233\252\202\3645T$4\215\272\351H\016\210j:R\343C\243r\251W\325(C\325Z\311\231=45\342\350\320\253\003\330\212U\016\225\234\331aJ\252\213\375\270\273k\375`\321_w\3502\177\310c7\350\341\017\362\230\377\3433\277\307i\376\016M\177\002\244?\3707\332P\247\023\b\3357*\201'\315\364\201\tJ\340\211\253p\227LN\021P$\223\207\362\231L_\311C\221@2y%\360\344\231"
+	.ascii	"\3607\341\004\364P\337\007z\237po\213\224DEW\374Q\221G;\372\321"
+	.ascii	"\2538x\364\235v4sB\n\322N\r\300lT'8\r\265B\224\323Q* \340\242"
+	.ascii	"1\013\036\024\202\025P\006\374\260,\201\256\2114\330p\337\200"
+	.ascii	"\3551\331q\f\341\rfaP\034x\322Q\276\241\365\231\001\037\213w"
+	.ascii	"\352\232\224\021\213\006\336d\363\n-\224\244\207\342K\004-\264"
+	.ascii	"\031\300\346\fG\262N\300\256d\234\304\016\311:\021o\220\305\001"
+	.ascii	"0\217\251=d"
+	.text
+	.section	.gnu.lto_scaleRangef.23.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`b\001U\r"
+	.string	"\366\030YC\020q\233\016s1\312\034k\340< @$a\273E\024\"\275c\240A^|\030R\200XL\256>\201\325\367F\352K\324~}\320T\337\241\356\375.\bQ\252\230\034\034\244\250\\\022\217\353\267n\264\211\334)\005D"
+	.string	"L"
+	.string	"?"
+	.string	"\230]\227\022,v\327\200\013X\227\266}\023?\321\331\341\364\201\b\361\022\n\f*6v\027\333<"
+	.string	"u9\035"
+	.ascii	"u\251'\357\036;\377\244O.-,#%\237\307J\301\356:\216\224p\270"
+	.ascii	"\365\266\t\330v`?F\217\216\217~\307?\234\250\020\301\231\261"
+	.ascii	"\253\341\005\307\302\220-"
+	.string	"F|\364\203\217v\347\2578\311\027\350psA\263$\031D!\316\310\241\365\331 \300+\245\240\261\273\036\227n\260\342p\322,\t\310dAJ\016\004(\245\003\037\350\361x\221C\007.0\232Q\316\r/\024\365j\351_x$*\2454\252T\221:\351\365\001\251\206\027\002\305\027\373\373D\365`\177\332\335\265v\360\365\321\2359\312\2179x[\377\376\352\242\237z\312/\277\362O\217\326\235C\370\004\241<\\H\004k\202d\033'\265\2711\3106\256\252pg\037\234\004OG\303D\246\246\315\f\023\231\320\321\260l\343\260\217\001\236\024B6\3143\347\206]\337\336\276tcAA\226\252zi\224\341\231d\324R\325\004-,^   #9j\003\034\202\r(\003\272a\367\302\212\303|\023\215\036\n\234\260\021\372\246.\032\031\321f\340\215'3\261a{\226b\363\332\346\016W\262N`G2'\260#\031'\2007\300\342"
+	.ascii	"\236\307\32422"
+	.text
+	.section	.gnu.lto_normalizeV.24.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`:\002\335\020"
+	.string	"6\240nF"
+	.string	"\223\223\016\234\364Q\2672\020\206M\300\321\213\240\247*\320\025\023\355\rx\276\222\270\376\211\212\341}\371\r\031\243\214\300\3112\220\313(\rc/]w#\232\264Z\003X\033`\210!\233*\007\321\254%\204\354-eJ\001W"
+	.string	"R"
+	.string	"^"
+	.ascii	"\360\343\031y\332w\371\313\3520)\017\260\313\362\302f\367\033"
+	.ascii	"1\202\355\321\337\007d\217\333E\262G\257\354\035\377L\354[\320"
+	.ascii	"p\230\t\262\273\234\226\370\352Ps\345k%\237\027\214u\030\342"
+	.ascii	"*\202\255@\322\356~\346\331\001\326\312\324Jv\327\371\202\201"
+	.ascii	"\270\343m?\260\335\300\316\226\366\341\356\256\225\305\376\367"
+	.ascii	"\003\270\314=:\314/\312t(\323\240L\1772\275eZ\313t\226\351\230"
+	.ascii	"i\230i\315tf\372\002D\\j@\340\261\353\241G\310\346\304\233\226"
+	.ascii	"\313\374\366?\343\220\257\3421\253\313\270fc} \340\332\201\321"
+	.ascii	"cw\023<z\301\366H\nZ\200\204N\f\216\225\344\361'7\265\273\f\331"
+	.ascii	"_#%\255(\313\232F\335\364@2\315TSm\210\3524\231:\200\232\032"
+	.ascii	"\025\332p\211he\217UU\241F\035\032\356BU\301\316\365\232\252"
+	.ascii	"3\\(Z\336p\026\256\331v\227\201\277b\002\312v\"%{\274\306\037"
+	.ascii	"9R\300\250d\217\375\261RG\004'^\005\224\351B\346\251L\024`)\245"
+	.ascii	"R\227HT'\236\311\211Cu\247SW\342P\026LN\\)\245\342H\f\270\303"
+	.ascii	"`Jq^\327\245\270\320\267\207\253,\216\360\222\243\242-\030\322"
+	.ascii	"\030\231\206\324\213\351\200\364F\025\244^\214\206\013\347\243"
+	.ascii	"6\022PD72\366\3621\322\353G\275\230\f\027N+w\227\2455\266\363"
+	.ascii	"\300\026) \240\202\031\261\341\003\263\320\216\307\020j(\312"
+	.ascii	"\366\256h\\\263\262\332\266\r\332\0250K\313[\321\fb\316&B\222"
+	.ascii	"\024\260\251,\366\fLJ[\0341\341\220:AX\230pS\232w\304o\020\313"
+	.ascii	"T\\T\fA4\023\013vD6\257v\f.\212\0073\214\b\200(\340K\032\260"
+	.ascii	"x\271\355\352z"
+	.text
+	.section	.gnu.lto_buildRotationMatrix.25.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\005\013\r/"
+	.string	"\nT\254\021Ep\234J:\177I__\323M\257E\254\036Y\242\240\271\"\377A\317Z-\277m\371\013\272\261\325*\006\r}E\344\215x\241\005\345S\222L\367b\202=\"P\231f\3414\265U\206G\267\326Zk\204lB\244L2\017\001\346"
+	.string	"\t\001I\216lX>\267\247\333\240\034\030\005%eL|\3136\234cZ\226k)\361+[\004\304\310\221-M\323\022\273A\023{\271\r\2328\022E\231\302\245e\017:968W\350\315z)\237\362*\217\333\240\225\034\032\250\f\271"
+	.ascii	"\267H\243_\232&\231\310U@\017\345Q\300\376\266H\224\305\f\240"
+	.ascii	"\033A\314\254I\323t\351\346N\2417\215J\346}\023'*\316D\355\335"
+	.ascii	"v\1777\267x\336=\333\227\200\275m\305{\322\324\007R.M\335\232"
+	.ascii	"6\t\275\271n\377\2517"
+	.string	"\321\007\2507\027l7\315\335\324\322O\331#\213\002'M\323b\0039\330\211Ca\020\370C\317j\226\315`\373\307\375Wf\306\342\304\343\207:\370\216,L{0\307\2304\006\242\375w03p\344\2411Z\200\007\215\263\237dw/\2606\343\214\353\215\233-\352\214\\\332x\227JG/6\210fb\345O^\2173\247;\2770\033c>\251\3224].3\243\361\345\371\356\332\331\335\017\273@\033\001a|g\327M\214\373\307\356\313\264}\354V\336\252\312+\341\344\245:y\247>\367\215Py\245*/\204\312\373\340\344up\3626x\362\033Uy\241*/\203\223w\301\311\253\340v\337\004\225\367\251\362\"\250\274\007N\336\342\311\353t\274oS\345e\252\274K'\257\322\311\233t1_\003\225\027\351N\376\001\177\373\026\035\356Kt*\337\241[\371\n}\357\033t\362\n8y\201*\357O\345\365y\333\037\240\362\366T^"
+	.ascii	"\225\227\247\362\022+\357\260\362\n+o\260\362\002+\357\257\362"
+	.ascii	"\242\225\367\254\274\265\362\232\225\267\254\274]y\271\362~\202"
+	.ascii	"\031w\026\204\257\311\270\2452\356\320I\361\314,D>\367'\177\273"
+	.ascii	"\037\357\027\363\357\375o?\334O\345\267r\340\356\367\366|{b\366"
+	.ascii	"c\364\302\350\341\355\363\360\354\366w^\272\260%\367u`\001h\300"
+	.ascii	"\367\235\tH@\003\005\265\200\356\240>\237\020\251\367b\226\372"
+	.ascii	"c\202\277%4\364}G\240\224\324J\006:\t\251\r\364\307t#\365\303"
+	.ascii	"p\370\0349\255w\\\322\006\344\336\343\035\350\347\375\316%\264"
+	.ascii	"\372\276C\025\235\272\330\324N\334M\375<\364\251\367v\f\372w"
+	.ascii	"\247\271\204V\276\357\020\026(\350\005\tZ\301S'\350\337=\315"
+	.ascii	"\271\237\372]\254\356\246\r\367\343\316i@\330\216K\332\352{\237"
+	.ascii	"|@"
+	.string	"5f\226-a\t\215\027yT\325/v\315\035\\\315\033\264\203\250n\360\216\352\327\225D\226\352\375\034\326\207\3722\t]6\013\306\322&oG\367\217u;\211J\325\035\236\334\215\261\2345:\211:\325T}c\204\236j\363\355\013\231\035\251\216\320\247\373\021\035\027\343]\030\362S\310\334\340\245\313ci\032v\364\226\352k\371\231\210\205y;\212m\326\321,\222\250\266\033\342g\264\3204M\031\230\311\300E@M\310\315\375\212z\363\335P\334\304i\013_[Y'J/\256+/\256+\364\304V\226W\212\255,/\364DV\327\227\225V\275\302\032\341e\364\241\313\n\265\372\022\201\345\301\334+'/\020_VZ\305-.--\256\253\342V\226\225V\361\252\313\253\3504\264\\#\260\272\212_\\\\]\305`\330\313\241\271f\206\f)|\337}\372\005\206#xa-\266=5bT5T\367tW\035\022\200Y\f\242\346i"
+	.string	"\307\241\346\351#\251\223B\224\021#h\330EM\354\256c,\"\324\303>\222\344\035!\214`\013\273\347\202\235!\371\306\330\007,\373\265P\003\213\024\365O\215q\ru\301d\302\253\250C}6\332\215\306x$\352\263\277\226$\203\240\227[|\347\352M\363G\2248g\265\211\303|\332\354\332=g\\\0233;C\222\213\261\354\335e\342t\221<ji\232F\355\357P\3300\334SQo\362\\Y\037T3u\331]I\244O\027\265\2059\020\232\251\211\332\002\033\237\036j\013f\214kU\315\324BGzv\304\310\274\255\211\021\273\367{?}\276ap)\200\321\250a@#\225R\246fDRP\220\202B\032\003\020\003\021\231\252\016\022`SM\013\203\2229'\213R\330k3"
+	.ascii	"\020\312\207Ux\024\276\322\364&M\343n\311N\271\222\254\306wd"
+	.ascii	"fd\331mvA\233DI\3253\303\241a\300\233r\362\304\240@\332\336\256"
+	.ascii	"b(\3606\036h\253\006\\\243\337{z\022\036\331I-;.\306\244\251"
+	.ascii	"\377sd}d\2736%\257u\0201\376\250\b\224\020\363\032\376\325\362"
+	.ascii	"\024\222\332\267\331\304\t\r\037\305+\273I@]\216\267S\001K\316"
+	.ascii	"\337a\005\234\316]\372\264\027s\0015\0378\353\371R\300\3114."
+	.ascii	"\030B\374\264\024\230\305L\013\013\374\344\244\256&\310\304\353"
+	.ascii	"SN>\033\035\254\371\303YM\253\242\205\231|ZO\215\023\276jN\357"
+	.ascii	"\331\330\302\0359\005\201'Pv\327'VI\333\261j\334E \013_\f\233"
+	.ascii	"=,\241\210\325\262o \363\005\330c\\\"\326\231\342\303\231I\037"
+	.ascii	"8\374\367\036R\335g\235$\236+\200\355r\265N!\210W\272\\\245C"
+	.ascii	"\231\360\215\207\303\266\326\203t.f\211\360\361\362\331\345H"
+	.ascii	"\f\307u\363\333\317\215my=n\017\326L#=\265\274_\275QUf\331O\006"
+	.ascii	"\313\033\374\206P\270\020i\347\033Z\240\322\261\345\360\243\200"
+	.ascii	"j\n`\252\217\230HF\233\210\"\3766\234\253\266\032\310\212\331"
+	.ascii	"\227 \023\006\231\"f\177"
+	.text
+	.section	.gnu.lto_rotateV.26.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\004\005=\032"
+	.string	"\306\356\240H\300XM:\3401\303Q\240\003!"
+	.string	"x:\222 \2625.\355\263*\212\254\363\024\330\304mp\310&\201\007\373\230\353\326\232M\265\270\353\263\342\370\212\260\250\300\356\202\344*\232\013\250\271\272#\275\335\327\277M\333M\310&r\247\024\207"
+	.string	"\200"
+	.string	"\217"
+	.string	"\025\310\017\350'\201o\304\223xt\320\247\221\037\261\035I\tz;\242\260d\203Wkm"
+	.string	"\325\272\322?\373\327\231\365!'b\273\322\tz;\222\240e\007\257\326#\240O3\240\237\362\306\217\024QH\001]\332\017r!\266'\245\270\253V\244#Lj\025\025\030\001\375\264\370\034\360\223\376\005~\332fs\271\230\253_\242\341B'\246\326\032[\035\267]\332\374\353\276\302\301\270]\206\021j\255\2268\0301\356\275m\037\333\026\354Y\003u\221\354\357~\003o\372\013\234\351\377\371\356\366y\323\335s\246\233\347\342\037\340I?"
+	.ascii	"*\r\243\322;TZ\207J\347Pi\034*\375\242\3227T\332E\245m\250t\r"
+	.ascii	"\225\246\241\3223T\272E\245Y"
+	.string	"TZ\206J\257\2504\245\322!\225\006\251\364\244\322\037\225^*-\251\364\017\350\360\250d\bS\353\213\2521\025j6\351\341dWA\004\223&\t\324h\311\276\222/\261\235\311\243\t\310\020o\3608\252\267Q>\013n\270\260\236\025\217\337\275\312u\262\2179y?\001?\301\375\016\313\267r\347~RZ\324\350\331\335o\347\024\025\217\016r\n\256\223\005I\355:\330\301\263_\2712\252\205\217\025\262\312S<\016\220\262\235\340:\231\200\\\255\265\301\3477\3549Q5i\311\027\271\216\350\007\027`m\0173y\234\245\323\023\024\213\2759\212G\006?|\240xd\345\350y\3628g8\005\371N\023J\f\310\361H\001~\362\354\214\032\251\222T\310*[\274\311\315a\377\013\0322`\370\tC\314j\033HL\023DE5\241\031(T\373 \3430I\334C\013\214:\324\204f1\020\264\331\2146\024\003A$4\213\r\025\031\305\026"
+	.string	"0-\204\254(V\243\321\212b,\261\376\253\213\344\013]\240T\354\n\237\370j\305\001\341J?o\210\2542l\301\354l\316\302tvga\275/:8{\2639\257\305\3319\345\345\345\332\033\236\213\312f\271\324\354\314\332\320l\315\302z[hZ+\2633\254m\355\234\312\302Z\255\214\324j\303\336\023\020\272W<\322\375\023\234\227p\347\322\r\003\\\250QPe\020d\304D\202\004\005)H\223\306\300\002\021\251\262\016\021P53J\221-(\247\324\262\006@\310\350\221\016\255Yo\267H\023\264\217\346\266\212h\305\024Q\250\231<\333\204\351$\343M3T\327 \364\252\034\240\340\020\325\312\212\022G\224U\227d\337\272\t\276\03122\376\232\355\270-\240\026\177\322j\360\313C\335\022\302\033\004\367&\360\035\305\376\022 ~\305\227\305\217\225\r\006.\024\n"
+	.ascii	"-\365\220\227cU\004^\362\033E\310\032\246\310k\021\227\354\275"
+	.ascii	"mRr$H\217\316NYo<\335;\230F\020\036j\302\354b>\177\276-C<B\260"
+	.ascii	"\n\274\326\204\331\365|\256\005\234\177\350\370\013oQ\001"
+	.text
+	.section	.gnu.lto_quickMedianFilter3.27.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\312\003\305\027"
+	.string	"\006\352\217J\3200'\035Z@\323\r\002Vn\244p\256\357D{\217&5\342\223\300\362e@I\355d\340\270\317X4\311\373\263m\222\204\365X\275\227\\|A8\214R/O\331\304i\304\356\263>0R\314\226\261u!i\204\020\262\267\334I\006}"
+	.string	"t"
+	.string	"z"
+	.ascii	"\341\353\226\341?\034\204lIZ^\300}AH5:\034\335\375j}\365\275"
+	.ascii	"\322\203|\257la\371\264\374\322I~T\211!\370U\312\223\334\203"
+	.ascii	"'\324C\013\0246\334\354#\317U<;S\034\351\271\321y\330t\323\031"
+	.ascii	"\021\272\345L\220\302?\332\252\241-]mV*\240\273\003\340$P\004"
+	.ascii	"\323\00673\351\006\234\363\217NU,I\331p8\237\340Iw\357\264\341"
+	.ascii	"n\276\036\337\335\246\3355\331\345\f\001\357\356^\366\331\ry"
+	.ascii	"\371\263v\356\352\273\357X\347\252\352\\\261\316\r\353\\\260"
+	.ascii	"\316\375\352\334Z\347\3229\227\351\334I\347^\2045\364\242A\214"
+	.ascii	"\356\t=\035\315T\2234|\367\033\375#\366G;\356wd8\273\205;\032"
+	.ascii	"<W\370Jwe{\335\216K\364\"\331\215b\302\331\215A\320\t\250\356"
+	.ascii	"&y]\022&\2179w\037\342\"d/e\376\321\355\303K\321]\272\366@\373"
+	.ascii	"q\345\007E.h\346\224\353c\002?%\327\221!_\367\002JO\035\222h"
+	.ascii	"\263W9\267\"\020\2070h\233$\037\331\346QE3h\346\324iw7\345\334"
+	.ascii	"\311o\344\020\246J\265\n\274\273*\327\221\006\234\272[AU\262"
+	.ascii	"\331\330\363\"\220!\206\275\f\337f\2076{;\231\305\314\257\r\321"
+	.ascii	"/\213\357<\3715\241\231\331\333\221\317?z"
+	.string	"\345\260$U\263\2036{\314\335=c\316\355\226\263\031+o9\204o\212\311\213\n\f\n\354\305\022\203\301b)/\226\025\024\330+\305\345\345e\"\262\261\026\007./\230X\314\3455\226\3757\373\254\270E\343\231\215\241\335=\013n\364C\021\271V9v\024\271\006\322A\242@\025\347V\305\"\263\200T<w\224\210\003\242>1\234&J|\376\334\240!\3476d\220\001L\255\230_\245\3575\344?\201|\335?`\310`\260\362w\274\237\234\217\0238\235\304Y[v\367\307\271Z\250qL\247\234\251\200dDR\220\202\244\325\200\002\231\252\253\007\021p\2714y3\354\006b\214\211@\266\302Pa\204\302\313\305l\224\027\325\255\351\023%\344 b?U\304\356\362%\bS\001\342jLy\367\305\357\267\n\200\331\341/\362\255\354\301&d\3750\244S\216l\030r\373\035\f\002]o\223\002Aw\355AQ\215\353\346Y\207\340\365"
+	.ascii	"\020K\340C9\300\013\37249,\027\317\t\312\220\037\300L6\216\232"
+	.ascii	"\350\372\214\255>\360P\006\235\271\256\247\205Tl\363\t\245H\331"
+	.ascii	")q\t\246\205\2312\366\202\252\267\361\353\005\234\200\226\260"
+	.ascii	"\303x\206\303\222\221f\016\2400\331\364\017"
+	.text
+	.section	.gnu.lto_quickMedianFilter5.28.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\252\006\035\037"
+	.string	"\366s\262H\260XQ:\360\230\360\021\240\031$\2436\3440\301\177t\271]\341^rZ\207$\003\320\367+ZF'Zi\275\332\330\203\t\013\363ge\373\302\237\362\235\307\275\303\021s;\34162\276B\256}\373\337\376O\b\331D\312\224\002\243"
+	.string	"\216"
+	.string	"\234"
+	.string	"\322\274\3617Nt\343\033\310s\221\013\205\220\360\364\260\3149m/\017\020^\202\227\205\227\333\302\362 \357\006\365vY\f\366r\265X+U\n5\212\241\004Wo\276\270"
+	.string	"\264\301\324\204\313\341\\&\364\230P\220\302v\177\355\\\250K\305[*R(\013\305W(N\250\312\304S&J(\212"
+	.string	"\013\020$>2\361!A`\310\347G\305\021\017[9\036\360\245\267\243\022L\371\200\004i\345:\200\007\202\206b\034\351\332\223\323Q0\206\210\357\221\016\022Y\372\341r\"\256\342\2029\247\025\227\003q\003\270}\f\266k\266|\n\272@\276\027R\260x\201\354\331y\177\214\3250?\272eR\035\223j\230T\277\244\332%\325-\251fI\365J\252UR\235\222j\224T\217R-Ju(\325R\252AU/\250VP}\031\027#K\034L\231\363\303O\313T\"\225`\374\3507\372w\370HV\371G\267\021\307g<\212\222\2046^\216\366\215\337\263\312:^ts#\r#\216\017\003!&*s\316\331\245g\343\345W"
+	.ascii	"P\265\217\3439n\316\333p\330\234@IB\346\344\321\0343>\227\343"
+	.ascii	"^JM\334\367\016k\362d\305\325\355\217\222v?\341\"pr\036w1Pd\006"
+	.ascii	"Q\270:\207+wB\021\023\007}\242\205+`'\363\336m\334\367^\300g"
+	.ascii	"%\213R\216\376\344\352\214\n\332\331\2128\235]\266=\362NEP8\350"
+	.ascii	"\323\3019\347\004W\367[(\333\331\202\276\235\024k\273\301{7\030"
+	.ascii	"'s\316\004\322\207\253\342+e\270\215/\374\r\373\236\0229\372"
+	.ascii	"\263n\314\356~G\006x\037\t\277\272\337\031\322\321\237e\373="
+	.ascii	"\322%\215\245\037\317\226\034\375\355\006\r\t\341aWg\363p\002"
+	.ascii	"\022^\341\030\356\231\232\205\b\027\036\320\330(\324\320\320"
+	.ascii	"\324\314\330(Hx@c\233\261\261`\253\rpM\005\b6\266\0135566\025"
+	.ascii	"o~\201`\366%gu\254\001\234\223\205\202\033"
+	.string	"\375Tt\350\3170N5d\260\rrX\322\356'\026[XS\f\226\305\260\3251%]\211|\270*\257\327\272^.\027\253\251E\003\322j-\253I[4\326\262VG\373\261Z\235W\253\332\t+\232\352J\r\253P;\305\307eNb*\265\250u\t\252\245V\267\310\240bN!J\334%'\332d\3673\256\376\350q\335]\001\307\325y\\qYOH\300\333\027\006\200\233\250\221PF\221\220\214\210\024\024\244 i5\320\002\221\251\252\007\022`\204=\007\305\350HJZh\375\357\"D\207.X\371][\035\013\222\263c8\037l9\367\001\211\257\374\244\341\252GB\b\226\207\032\372\026\032\360@\202KH\032E\310\025\033IVj7\031\333g\225\242\237\226~\006\201[\354\336\306\031u\325\346w\241\bv\264\201XM\r\333q\355\206F\240\266\246\236}\t0\223\235\262\374\370\032 \264\365\022o+\023\032\223-t-u"
+	.string	"9\360\3429\273\005\3567\027\340o\310y\301\327\002G\251S\230\303N\325\322L\265\354Z\177\277\220\220\223i\b\270\243\234\326-~\344:U\252\003\"\227\f\214\t\274{\0359\005\323\264\320\364\242\363\225F\031\361\0071y1\202&jCV\2036B+\300\311\034\224\374\202\372\265\n\315|c)\352`\252Vh\310\301\256bS"
+	.string	"\372\341\242"
+	.ascii	"\271~\227d\334`\303P3\236\3604\316y\013\246X\024\334f\202X\231"
+	.ascii	"%\340:\2234\253\001"
+	.text
+	.section	.gnu.lto_quickMedianFilter7.29.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\027\013\205("
+	.string	"\212@\264\rJ\260\224U:x\261{^u\242Z.B\bV\264"
+	.string	"pm^\326G4\2636\301\211\240\213.R\030l\302h\210e\313\367\252H\206\305G\311\203~\247?\241\304\322\337\312\316`Y\322O\304\006\264m\333\266m\333\266\222F6\2212\311\320"
+	.string	"\262"
+	.string	"\303"
+	.string	"\346\351\026\315+}\tg\211d\361DPy\024\245\307X\245\326:t9\256<%o+O\333\304\256N\026\277$\023\017la\371\371z\274\235.\207\273\331j\264\231,\006{\271Z,sUR\262\231\270_\301\220/\230\360\360\t\3129\220\351-L1\230\005\306\1770\226\330\247\364\236\322\013\346%}\227\344\202uH\317!\251`\\\212\337R\240`\333\321kGFL+\372\254\350\004\313H<Fb\004\303D\374%\"\004\273@\274\005\342\003\263"
+	.string	"\224\340\340\341\246\022 \017"
+	.string	"X"
+	.string	"\r\361\252\303K\322\245\207t1\3620%\315Zk,(\003i\200\177\202v\230\\!\364~\215\223A\216\f\361\t\022:\257`j\255\313>A\034\276.\337e\005\273+\334ei\b9\335\347n1\207\233\250\330D\2732/\376\b\2267\346N_ \345m\241\274,\224\367Gy}\224\267Gyy\224wGyu\2247Gyq\224\367Fym\224\267Fyi\224wFye\2247Fya\224\367Ey]\224\267EyY\224\327\244\274+\312[R^JyI\346m\222\227I\336'\350\t%Y\340T\353\206*+\025\t\375\201t\247\277\351\247\261\257\261\256\275\023\321\314\0012\235\236P\005\315\323\330.\316\336\270\256\225\361\0318o\262`\346"
+	.ascii	"\311\034MI\251\265\276\234\356\213yz$?\346\335\3078\023\316\213"
+	.ascii	"\027N\253\225hG\217Z\213\301\035\020QZ\252\325\375\204\343\274"
+	.ascii	"t\\\265\372\334V\263Zg\004U\266\232\257\004Y5\251\222\325\247"
+	.ascii	"\320\b/19\307\215s\021\025\322\354s\315^5\214Jh\366\241\254\372"
+	.ascii	"\306\323\2264\351\025\355;\355(\032*\273\300m\\W\366\271e\323"
+	.ascii	"\246\231\361\204\201\251\366\351{,O\313\316\025\021\270\221h"
+	.ascii	"\366\215\017p\274\222\364C\207\253h\237\3132j\231^\371\360\313"
+	.ascii	"\201\375s\251\031N00\325\311Zk%\373<\261\004\266L\223G\236\021"
+	.ascii	"\275\27307\022\0050\251\265\032\240G\237){\"\025\210&\212\375"
+	.ascii	"\205\376\317\007\035\256Zn\004\335}\236\026\344\267H\371\346"
+	.ascii	">\017\213\035\256Z`\277_\343\324\305\221!=Wt\270\252\273Xk\017"
+	.ascii	"\036\341\024\2763B\t\016&0\250\031B\260\251\251\261\231\031B"
+	.ascii	"x\300\240f8s#a(\354\255M\204\0067\303\t667CW\261~\213M\024\323"
+	.ascii	".:\275\263\026\310ZK\034x\323/EF\314\324\002\373<^w|K\237\333"
+	.ascii	"\322,M\323\3229\026!MI\313\342\013r\233\324\352\367k_\353\214"
+	.ascii	"~\276\322\307\353^\020\b\331\353s{\315k\030U/\310k^\237Q?v\273"
+	.ascii	"\326=\355\242tS\253\353\323G.\3278\250\034\016g\023\366\270\335"
+	.ascii	"\332v\353C\261\331hP\265\346q\335k}n\255iM\003U{B\253J\242\311"
+	.ascii	"\236f\302\035\263>w\326\262\326\031\315\204\262R\006\013\032"
+	.ascii	"\321\361\332\222\242\241X\254a\301\030\f\346\212zu\216\327\253"
+	.ascii	"]Q\344\353\t\273\246\326\305\352\201\002\250\221\\E\221P \"\222"
+	.ascii	"\024\244$i\r1\006\204 tf\035\022\300\203)\210\305"
+	.string	"J*\221$\226\373\377\031\302\320\265[\235\375\321\305\233\313do\335\23205 \037\211yP\274\002\004I<\313\027\2278\374\256>\274\306\235`\031\346\272\200\353\2718\315\227\200>\341\007\307_R\377s\t{A\035\255\307\237\024\261\306\t\324\306\213\224\227\353\354\332\231\035\342\351\270{\225?\307\006\356\004^X\252\275\243\020\356\034\217b\212Y\233\f\363\264\022'\001HD\303\351[\251/\347\232$a]G1\221oeV9\362<<o\303gX\360\235\347\262\361\242\322\223c\034#\320\221av\313jOF\205\023\003\"\206\232\032\272u\r\253d\250\030'\212Y2\332\374\274\306$V#Na9\357\022\346F\351&}\3277\273(\332z\035\205\2763\203\f\263\371,\351\3148\313\034\261D\2637+\254U\227p\203z\255\023\222\374\3401&N\251\261\344\255\036}.\231\023\371>/R\211+;S\355t\261\277\301\t\300"
+	.string	"65\351\260\345\277\361b6\253\005\301\3655\255Tg_\033\257"
+	.string	"\252\031`\314\347\343)p}K\240\305\315'\370O\031\346\007\221\345\240,\372\030\247\237N\260\022\371\217La"
+	.ascii	"#\314A\304/\f\272\266\352\207\357RC8v\252\271\261\221V\304\253"
+	.ascii	"\252\221\312\037Z'\2109\200\026\363\2505AH\203\350\231C)S\304"
+	.ascii	"\034@\213y\324\222\311\fb\317A0\324\245Wb\225\270c)\2427\013"
+	.ascii	"`,7%\230?"
+	.text
+	.section	.gnu.lto_quickMedianFilter9.30.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\210\017\3252"
+	.string	"zO\030\021K\240\226\231\016+H5\257#\237}4\257\270\025\371\210h3\264\260\322Js\334\253\377\025\363HOH\366\021\217\261\343v\032\362\033\346\022\272\214\227\343\345x)m\310\273\356\344\222\374\026p\265|\027\344\271\200\277\205\377\266\367\226;\311\224\002\f\001\346"
+	.string	"\367"
+	.string	"\253\347V\256n\303o\3444\022U\256\370I\2076d(\272\322\266\355\321\347\266\3243\352\264\324\363\253h\225\243Jo\024#\335\bS|!\016\205A\240\313\317\327k\341\355t9\034\013{\263\325h3Y\f\366r\265X+\325\252\246\031}\214lW\r\2405\234F=?:ndr\030&%\270\230\304_\222 \301D%\037*%a!\222\007\221\226\030\030\304]\202"
+	.string	"\301\277\037\356\373q\204{:\274EG\016\314\303\341;\0347\260\316\206\347l\324\3008\"g!\242\201\331\027~{\341\002\333\206\2746\324\002\323X\370\214\205\020\226%=\226\\\201a&\374e\242\004v\221\360\026\211\021\230%\302W\"B`\325\017\205\207 _\237\370\004\375b\370"
+	.ascii	"a\025\204\247\257\237\f\250\257\210\007g4\225\021\204\364\372"
+	.ascii	"\301\200\022XB\221\341G\2165\374X\300(\214\017\376~\344h\221"
+	.ascii	"w\252\347\347\203c\325@\333\266\215{~<x\307x\367\003\350\356"
+	.ascii	"\231n\327.\031\244v\360\324\377\022\212\214\240\177\267[\251"
+	.ascii	"\203\003\004-\337\376\024\3355\256t\247i\334\b\334\310\333\230"
+	.ascii	"q\303d\334\305\214\373%\343&f\334\303\214[\230q\0073n`\306\355"
+	.ascii	"\222q\3772n_\306\335\313\270[2n^\306\275\313\270u\031w.\343\306"
+	.ascii	"e\334,\0317\233q\3372n[\306]\313\270i\031\367,\343\226e\334\261"
+	.ascii	"\214\033\226q\2772nW\306\335\312\270Y\031\367*\343Ve\334k\306"
+	.ascii	"\255f\334i\306\2353n\024\343~\0247Fq{\202\334\222\223\005T\332"
+	.ascii	"\266\303TT\333$/\275p#\367\036\356>\332\217\232\325n\204\\u|"
+	.ascii	"V\243)\035dV\317\265\356\234\366\242f\365\016\347\221\343=(\254"
+	.ascii	":>\007\20684\265mk\364\334\306\3253>\021\304\270\333s\270\216"
+	.ascii	"\034WVpY\333\246H\022\322\266J\231.\006Ij,\366\260g\205\236\261"
+	.ascii	"\250\024\006s\275\257Gz\275\336\365\276f\\\357b}+f\351,\323["
+	.ascii	"\357v\353Yo#\323\212a!\0215\353\335&*\357\264\372g\022\304\361"
+	.ascii	"\r\246\272Z\275\352Y\241\246u\365X\352\251\252fN\251Ju.y\233"
+	.ascii	"I\240\365\361\022\210\343\244\025t}\267\327W\337\005\345\364"
+	.ascii	"f\276KyQ\365\275\310e\315(\257\346w\243\244$P\372\002^\377\341"
+	.ascii	",n\teF\372n\247\237\337\206\007\223\013\030\252\233\330\233\231"
+	.ascii	"zN\377\226\224\361\"\344\372^\344@#\313\247\245\035<\225\337"
+	.ascii	"m\225\320\327\274\332\203\215n|\r\356\304\303y\001C9\332\266"
+	.ascii	"m\213\276\353\310\324\3705\2172yJ|w#Wx\021\222\370\266m; 3{\252"
+	.ascii	"\2643\231\200\\[\264Wx\327\020b\007O5~\232\377w\236\031\2507"
+	.ascii	"S\352\217\337ybX\300Sm|\177?\362L\343\235\n\f\334\201K\360\256"
+	.ascii	"\231\201\260 \002\315\315\261\001\316\315\rN\315\261\001\003"
+	.ascii	"\232\233c\315\003\b\307\231\\\3438P\360\340\030\001\007\347\301"
+	.ascii	"\221\245l\375S x\337\316[h\nh\333\242(\340=\334\233v (B"
+	.string	"\324\306w\231\234e:\314\273\r\363\305\267i\302\374\255\250\364T$\276J\234\346\224\004zyy\342\263B\357\313c\251(\"Q\330\034&A\207\357\366\360\205\357\202j\016\337\245\b_\370.\222\340\273\035|\340\333<\203\177\003*\0215\360\335\346\021\027\227\3779]\232\277\364\327[b\304gM\324\367n\373\276\367.(\337\273\224^\217\367\314\226\226\347E\265\314\360\236x\272\347\356-\262\333\275\356\271{u\251\356]'\221\\\356qM9\034\216\375%\227%%\201X\336m\226g\337f\206%\206M\"bmM\267\347\020\365v{\333\263BM\267\307RO\233\215\346\254\275\220Z\355i\316\332K\243\311fJ\263\331\313f2\262'\031\354\031\213\n\201d\250\201`e\221P \")(HI2\214\001\201\006\"CV\266\001\022`\262I\016N\031&&\222\032K\373\177\007a\034\266\370\226BJ\326\353\370\200\210\272W\315\366"
+	.string	"\2368S\270+\304\0332*\022\021\303\316&\361~\317w\305\247\264\322\346\001\251\242\201yUhM=\200\274\350\216\246d~,\315]7\300\303w~\033\243\261\230\247pm\271\263f\340\333\207\254\213\2735\230\313o\202\357\215\314\354\211\337\367\026^+\240 l<\n\376\253\313\310K4P=\203)\373&"
+	.string	"t\254%\373@\254\241KM\246@_\341\006\n\260.U\342\332\222\224G9\233\212\337\311\273\277w\314\372\2330v\352\326\256Yx\333\302\363\260\317`\366\210i{[J\020\313\257\373\002E1\206\332b\311'\224l\351k3\337\353\220{\307\276\313\370\231\032\200)Z\360\207\022nZ\321Atz.\346\355\264M\310[\251\264\337\254rE\277\002\206X\354\275\230i?\332wL?\313\032c\201\324\360\223\372\3568H\212/o\313;\221>\207y\340]\215eeo\bh\200\312\221\3012\312\314\006\303T\220\221\304\226\331\304?\324\310|\320\274\343%\224Mp%\212\025\206\353\312\216e\323&,kt\356\272(\006\021\273e\007E\203"
+	.string	"\003\001\023L^\237\220\310<\321\327\311\247-\351\016$\027\rX\326\226\360\bH\037\230\252\207\325\226\232\214\325>\375\026\023"
+	.string	"\302\310%bC\370\007\352\021\013\317\267\\\255}\335\321\214},\360\211\004\321\021\nR*@\372v\001_\024}\030\312)\343\372\003\003\224\025\3137cV\367\3114@x-bD\003\336\271\036\272\366\236\206\257\234@\231\300\324\323\323\220,\201M\345\263\371G\376D\310e\341\247\216\235$\376v\340K\204\\\026~\352\330I\342o\007\276D\310e\341\247\216\235$\376v\340KC\f\311\365J"
+	.ascii	"1\\.\306\366\235\3415\037\212\322O\200\364\230\226\343\037"
+	.text
+	.section	.gnu.lto_quickMedianFilter3f.31.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\332\003\315\027"
+	.string	"\366i\217H\320\224M:\330\306n\263!"
+	.string	"E\023T\002\332\332\020\3352\t\t\020\220`\344\264@\225Ti\344\320\302\232\210\255\237\223F\360R\027\252\210\340\007Wx\301%\035G\227\254\215\316\362@A\034\361:\255\002\2515B\310\336R\246\024|"
+	.string	"s"
+	.string	"z"
+	.ascii	"\227\016\277\233\370\t\230\255\024\303\f\034\336\264\341\007"
+	.ascii	"gd\316\331Z]\325]\306\237t\227\213\301\373\030\336Qa\007S\250"
+	.ascii	"\317\353d\\\205\371\036L,\361C\211f\213\035\254\360T\005\n\212"
+	.ascii	"b\271\0204\341\337\216\332\004\226\0205\t\352Ex\027W?q\205\233"
+	.ascii	"\251\214\002\346\234\001l\017\342\001\005\262\365h\004!\364="
+	.ascii	"\322\243\f\246\"4\233\320\325\203\231sZi\266\240\273\344\266"
+	.ascii	"w\330~\261\027E1\375\334![\345\341\237\"\325\252\037\335\240"
+	.ascii	"T\247\244\032%\325\237T{R\335I\265\224\352x\365F\265F\365WV\206"
+	.ascii	"\350\250\3411'\204\034\222\231C\306\370\360\243\337\350+|$\203"
+	.ascii	"\376\321\316\027\253}GM\036X\337e\264a>\316\240\255\342E\260"
+	.ascii	"\033\361|\261\332\202\246\016B\346\234-\227n\311Qr\265\217\342"
+	.ascii	")`\017\235t\2239\207\\\300\2303d\331\300\027{s\267rk\212n\370"
+	.ascii	"\350\023\253[\024\"\227o\217;\201\0316H\304\220iN\356\315(\r"
+	.ascii	"\253\262\036M[\016.\320"
+	.string	"\211\0241\371\350\323\343\234s\306\275}\247\003We\343\322\314\302\332\2369\316J\005z\3149\023\310%\232\223\237\344\300J\037\007\337I{ \n2\315Y7ew?\023\021\357\032\335W\367\263\020=\2323\270\337#]\216`*\362\223D\246\271\3359gl\367f\207\0014\277y\203[\346%gF'\306\325\262y\271\\/\231\226\rM\214\253%\203\223\323zY\361\353\206\001NK\347\365\302i\201\341\374\347\016\251v%\333\036\363\3049/(\270\321/D\005Ku\304 j\201\270\370I\020/\2657\247\026\265(O\251U$.\250\001C:\324\247-\256DK\361\333\233\277\365\026\200\023\r\275\227\366<\274=\356&8|\254'Y_\361\202HB\267\bz\234\305Sp4'\231\346\034\3169\273]\250aX\246\230!!\031\221\202\244 i5\240\002\231*\243\007\021\2009$\305\263l\006\"\314\214T\276!|\374\216\304"
+	.ascii	"\323\332\360\343\275\217=8\215*\224\370\350\306\336\356AgG\205"
+	.ascii	"r-\307\205\357\315\207\200C8.Ol\222#\306\243\275\211o A\226~"
+	.ascii	"\035\240\204\034\244\0274y\330\207J\316\025\237\035\347\225\r"
+	.ascii	"\354\346\271gAn\022\340\026\202\201x\230O\250\351\363\233\345"
+	.ascii	"q\235@\031\376\201\354\333\356\r\205a\202\226\2173d\027}H\260"
+	.ascii	"D\253\364Z\024;\303p\001\225\356\342:\230oZ\220)\243\366P$\032"
+	.ascii	"<\360\220N\373\226'\230\304)\260\034\244\327\tp0}\364\017"
+	.text
+	.section	.gnu.lto_quickMedianFilter5f.32.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\310\006M\037"
+	.string	"6t\263H\260XQ:pq\367\215\341\213T\210\253\021V\272\255\256h\241cz\201\0216r_\240\266_\3212:\321J\3539C\217\027\212\210\236\215\215\265\037\364\031\234\267\026~\337\355\204\333\310`\3432k\377\333\377\215\020\262\211\224)\005\243"
+	.string	"\216"
+	.string	"\237"
+	.string	"\322\275\3618>\204\263\225\300\336\213\240C\r\351\370\256\3149o.\017\020^\202\237\205\227\353\302\362`\357\006\025\367\231,\006{\271Z\254\225*5\212\241\004Wq\276\330"
+	.string	"\274\361\324\224\323\331|\006\3432\030@\032\343\035\306{\241\257\025w\255P\241\255\024g\245@\241\253\023W\235\360\321\324\201\026\"L|d\302c\342\200\020O\217\212%\036\272t:\240\213/G%\250bBRr\351>\200\n\200\204d\374\350\272\243\303QP\006\211\357\217\016\016\221\362\313\351H\\\305\006sNkN'\342\006p\373\032l\333\354\220@\272?LAOW\274?6\355\275\037F\252_nt\317\244Z&\3251\251\206I\365K\252]R\335\222j\226T\257\244Z%\325)\251\036\245Z\224\352P\252\245T\203W/\250VP\375\030\003>K*L\2313\304O\313T\"\227b\334\350/:\017\377\310+\337\210\303h\3033\032A\351\250\215\227\243\215\363}^\331;N\204{Q\207\321\206\307\001T\016*sN\332\245i\343\345Y"
+	.string	"\270\332\317q\035\270\367\234\364\330\234??\202\314\331\253\031f|M6q\357{,\t\224\025wW;\017$^O\270\n\234\336\343\003|\271\250\033\375% Bc(\334\235\303\225K\201\b\211\007\315R\013W"
+	.string	"/f\334\373\216\200H\023,K7\372\223\273s\nhi+\346\224\366\331\356\310[!\212\342A\263\034\234sNpw\347\020\316\226\266 S\216\212\265\375\340>+\2758\3159\027H\246\\\224\277\264\301Jc\220\357\244\375\216\317\215\376\254\013\263\273\317\231\001\336F\302\257\356s\204p\364\347\331~\177tYC\312Og\313\215\376v\201\204\214"
+	.ascii	"\261\273\263{6\001\023~\341\032n\031\033\006\t\031 \314\334,"
+	.ascii	"\320\314\314\320\310\334,L\2000s\223\251\301p\263\0250\315\205"
+	.ascii	"\b5\267\f445\267Uo~\177^\326\345fq\334\001\234\263\005\203\027"
+	.ascii	"\375Tv\274<\2611\213\255\322cH\274\036\231lcM\262\030\026\307"
+	.ascii	"vW$\351\212\303I.\n\006\333\027\354\365j5\271jH.\327\266\232"
+	.ascii	"\324Ukmkw5 \037\340;kwf\355j)\260j+'6\274J\355\323\217\317\246"
+	.ascii	"\210"
+	.string	"*\325\246V@\026\233jUKLJV%L\211[\304I\221\360zF\233\372\270\362\230\300qw\036W\334V\324\021\360f\332\007\200\237\250\201`E\221\214\214HJ\222\222\264\032\340\002\221)\252\007\022\240\2045\006c\315\225\024\245\230\375\337\002\310g29s\3741\252\035\367\374\\>\326\306\035j\325{\0351\271\220\330a\006]\274'\005<\322\217\013\354\n\375\254\0357\204a|I)\267\t\016\320B\371\261\203\243\366c\250Q\031\222\267\035\034[S\347\201\303\270\004\036@`s\275\364\336\346~Ko\345M\276A\316\260\230wqU\256\200{\336\200_QsaX\245\301V\244s \330\005n$\303\325\340\007V\013^\322\n\211\364\333\354\251]R\024\372\3138[\233\3633h\223\025[\235}\231\247\277+!=\235=\353\322\261I\372=\223\222\203\340\030\0020\361v)1\372\017\357\367\244\217\225f&S!G-\266"
+	.ascii	"\343\331@\253\261\036#\221\245\210\b\250s\021\364\246\356\306"
+	.ascii	"0A\221>\340:\223%\233@T\261\3040\225\323\200\273\202}\bF)E\""
+	.ascii	"\243\346\023^\374R\013\345*\026\r'\234\027V\242\022(\237I\232"
+	.ascii	"\325"
+	.text
+	.section	.gnu.lto_quickMedianFilter7f.33.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`K\013\325("
+	.string	"*A\304\rJ\260\224U:\370\236;\340\212y\337\321a^\300\2562\343\272?\233\302]i\343\210\217\240\213.\022.\006s5\303x\317\317=\350\260\370(\335)\355?%\002\301:}\370Z-K\372\211X\321\266m\333\266m\333V\322\310&R&\031\321"
+	.string	"\263"
+	.string	"\306"
+	.string	";\300<\335\242\371\243\307\270\331u\"\213'\210~t\3421R\251\265\022[\216+O\311\333\312\3236\261\253\223\305/\3117\017\262"
+	.string	"\177\276\036o\247\313\341n\266\032m&\213\301^\256\026\313\\\225\224l\276\331\257^H\030O\234z\200p\036L:K\222\f\006\"\375\207\024\203}G\357\035\301`\236\321wF/XW\364\\\321\n\306\251\370M\005\021\333R\274\226\002\005\323\206>\033:\3012\022\217\221\030\3010\021\177\211\b\301.\020o\201\370\300,"
+	.ascii	"%6x\270\211\344\307\003\200\026?A\274\352\360\222l\341![\214"
+	.ascii	";LI\263\326\032\003\312@\032`\037 \035&Ypx\277\351\344\217#T"
+	.ascii	"\017\020\207\363\352\245\326\272\334\003\264\341\333\362]^\260"
+	.ascii	"\273\303]\026R]\254\025\247\373\334-\342p\013\025[h7\346\305"
+	.ascii	"\037\001\345\2059"
+	.string	"\3237HyY(/\220\362\376(\257\217\362\366(/\217\362\356(\257\216\362\346(/\216\362\336(\257\215\362\326(/\215\362\316(\257\214\362\306(/\214\362\276(\257\213\362\266(/\213\362\232\224wEyK\312K)/y\336&y\231\344\275\002\337\217#4L\265j\250\262R\215\320\036Eg\372\227Nc\337\264\256=\223\005\023\347\307d:\016\021\232\247\261\335\233\275q]\2733\256t\363\245\013&\316O\202\243\220(\265V\227\323u1Oo\344w\336\275\214'\335\274\270:N\253U\350\306\216Z\213\302N\032JK\330P7\316GIV\255>\267\325\254\316QI\225\255f+BVMJ\311\352\263\031\212\243\314f\033\347\241'\322\354s\315^5ljh\366\245V}\343iE\226\364\212\366i\344\030\n*\t\024x\215\353\214=S9\\U\366\271e\323\236Q\212\302\300T\033\365}*O\313\316\r\0210\373\306\007"
+	.ascii	"\362\304\250G\016W\321>\227\205\242cz\325\303.\017\266\317\247"
+	.ascii	"(1\301\300T'k\255\225\354\363\026\312`\3074\371\2643\242w\367"
+	.ascii	"\345\306u\022\240\244\326j\200>\365L\355\203TX'\223h\277:\372"
+	.ascii	">\037r\270j\271\021t\367w\\\220_\"\345\233\373;-t\270j\203\375"
+	.ascii	"~\323\351\213#\024\317\225\034\256\352\017\036\341\024\2762C"
+	.ascii	"\t\016&0\240!B\250\241\241\251\221!Bx\300\200\206(c#\2018\354"
+	.ascii	"mM\204\0066\304\t556DW\261~\213-\004\323-9\255\263\027\310ZK"
+	.string	"\034\370\322\037e\006L\225\r\366\371t\235\361,}.K\003{\206\245s@)F\013\364\375\270\r\312\352\367k_\347\250~\276\322\307\353\236\320\007\331\353s{\315k\330TO\310k^\237\307\036\273]\353\242vG]\225\325\365\311#\227k\234T\016\207\263\rw\334nm\273\365\245l6\232T\255\235\2563\276\326\347\326\232\3263R\265&4(F4Y\324l\250c\326\347\316Z\3269\252\331PV\312`\315P\257E\r\005\305b\r\023\306`0\327\361\3258^\257v\035\311W\023vUY\027\253;\201\006\250\221\\E\221\214\210\210\244 )IZ\003A\006\204 eV\035\022\300\203%\310b\021e\"A\323\302\326\377;\322P\316\253\272\373#\237\372\347\224\307\354\2068\020\320p,\3520l\334\007\311\367G\035\315\317\026QA\354\277\231\227\"\305d\377\032\001\235\366\305\233\276\277,s\344+\212\261\337\241\354\246\256\251"
+	.string	"\274[\200\206\r\211Qn\210%\377\332\343\246\304\032\270\210\r\260D\266$z\016h\252P\364\023a\327qxJ\334\321\314\241\037\0277s\026\353T\220\206\254\001[\264\267\207\034o\031\270\227cm\277\345\006=Fj{\t\030\264\017\2417\335\260O\260@\f\325F\236\344\341\350\335\255y\330p\b\312\013\034EIj\b\n\004;\016/f\212\026e\245\361\353`b\024!4\t8\020\213\221Os\032f6\252\221VQ\361(:\226\235d;&\346-\312c\336\347J,\317\250\323!\255U\313\251\b\313\267\376\346&%\271w\362\235TK]\303\005=\230\333\204\334x\213\224p\211i\233\213\007\357\353\3058\210\265o\352\347\215\323p\r0Ho\"AY\377\307*(\355]\223\343\021@n\022NS\0329\023"
+	.string	"\377\317\275\313\243_\360\2352\375\017\"\312\264\214y\216?\037N\324\022\371\236LL"
+	.ascii	"\031\223\300\346W\216\336\266\346c(\255%\224\345\312i\302\240"
+	.ascii	"\025\314\252*\306\355[/\215q*\330\217\336ri\rg\301v\366\254K"
+	.ascii	"c<\025\266\243o\271\242\031;\366\364*\271B\361JL\242\016\226"
+	.ascii	"\267{w\025\340?&\265\370\007"
+	.text
+	.section	.gnu.lto_quickMedianFilter9f.34.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\322\017\3751"
+	.string	"\272N\354\020J\240\326U\007\002c\301\313\332\221\237\214\207\260\\\016\ry\335~4]\376!nQw\216\002\307x\355\300\344\210\317-x\344\022\002\225x\274\016\257\303\353\260\036\353\365K\002\225YYpl\333\266=\3234M\3234\261{o\271SJ)\t\001\334"
+	.string	"\366"
+	.string	"\313\265\215\372\006\017\263\023\272T\321\242\245D\321\300\254\302\262\254\315\260si_\264oi\337O\301\255F\227\315\250\3634R&\006\346\370\342b,\266\020\207\302 \360\347\353\361Xv\272\034\356f\253\321f\262\030\354\345j\255jz\321w\036n\325"
+	.ascii	"j\243\n\022\220PO#\243Z&\n\211\307\034i\230#F\374\350\324/NM"
+	.ascii	"\356\302\324F\246%/*u\213\322\017'\372\350\241\217$\027\352\350"
+	.ascii	"\240\216\034\016\304\321?\0347\334g\324=#\033\316+j\226\242\032"
+	.ascii	"\276\203\321:\030/<\347\242q.Z\370\215E\333X\254\360\232\262"
+	.ascii	"iJ\025>+\321\262\022$<6\242a#D\370+D\273B\200\360\026\361D\007"
+	.ascii	"\242^\231\004\021\021e\004\r\271\372\241S\231\220\006t\310\374"
+	.ascii	"\361\213\2463\210\230dB\031P\002KNftR\373\006\241\013\216\306"
+	.ascii	"\360\320\337I\215\022i>\201\204<\264\253\006X\226e\007\022\352"
+	.ascii	"\320<\323\314\017\200\231k\230c\013\002Nf\020\375'\231\227=\036"
+	.ascii	"\200h\251\345G\301\214\323\313\356\233\353\214\240\221\232\221"
+	.ascii	"\327Y\346:\307\\g\230\353|\274\316/\327\331\345:\033\257s\361"
+	.ascii	":\267\\g\342u\036^g\341u\016^g\340u\376]g\337u\356]g\336uf\271"
+	.ascii	"\316\273\353\254\273\316\271\353\214\273\316\267\353l\273\316"
+	.ascii	"\265\353L\273\316\263\353,\273\316\261\353\f\273\316\257\353"
+	.ascii	"\354\272\316\255\353\274^g\365:\247\327\371^g\264\235\037uv\324"
+	.ascii	"\271\023\004;,qP\305\262\034\236NV\311\025\002\243\221\272\217"
+	.ascii	"\272\007w\022\277\270\221*\254=A+\222\224*\232\265/\216\231\207"
+	.ascii	"\233\311/\346\035\315\203\247\217,\254=A\007\2444\255X\226E\366"
+	.ascii	"e\344\332\327M\030\333\231;G\353\340\351%7u\215eQ(\001a\331%"
+	.ascii	"\r\307\254}9\261V\366L2\331\307ZYM,\366z\330\314R\357\230\r\373"
+	.ascii	"$\303\376\36594\260\231\227\225\"~\265\254>\312W\271\232\017"
+	.ascii	"\245\324n\324Du\271\276\365\272,\253\325\365\356l\252-\333\224"
+	.ascii	"\264\245RA\265R\312\241\265\365\037\355\312't\375$\257\257~\354"
+	.ascii	"\212\252\371\351\373I\213\252\337\314\256%\201\362\352\375\356"
+	.ascii	"\301\244\034J_@\333>z\307\004\272\362\361'o\311\t\215\364\223"
+	.ascii	"\234\376\375\034\036R\030<\213\247\274\371)\355\233\276NI\263"
+	.ascii	"~3\273X\304\211%\304\307\237\367\223\334Z\3618\257\0029\262\221"
+	.ascii	"\277\241\251\360\240\302\340Y\215\262,\313\242\237\354\n)\362"
+	.ascii	"q\036}\372!\361\314\314\243\242\231\354tlY\226\035p\237\200\256"
+	.ascii	"\270\245(\260\323\332\202\233\233\2767\200\360\361'\373\337\374"
+	.ascii	"\177\377\320@\233\243\322~\377\376\221q\301\237\214\374\376N"
+	.ascii	"\352[\243\371\324p\305\307\237\377K\001\r\372AOh\306\251\211"
+	.ascii	"\300@\302\215\216\215\203\035\035\235\035\034\033\007\rntlp "
+	.ascii	"D\260\251\351\361\316\003\005\020l$\354\354@\260y-\331~\024\b"
+	.ascii	"~\350\363\027\330\002\312\262'\n\364Q\267\325\016\004PGE\214"
+	.ascii	"\224\211\222\371$\313|\314\347L\311\274.\346\211\025sl\221\364"
+	.ascii	"\255J9\004\003\363\307\026\306y<\272L\275\264G^^\336e\352\245"
+	.ascii	"uy\227O\0321~\222\215_\374\234\246\361u\305g\021\027?9\005\325"
+	.ascii	"\322\362D\252\226)bJ\024B\025i\233\024:\374$\017_\370\261\253"
+	.ascii	"\341\367\023\241\020\370O\301\340\003\235\301\032 \026\320\327"
+	.ascii	"\374\265D~\277\3675\177\255/\365}\222jH\257\367<\253\036\217"
+	.ascii	"\267{!]cR\016\261|\222Y~\36795,"
+	.string	"3\273+E\273\234\225\256\031D\325\351>\367\272,+\335\273\263\231\313\335\250p\017\004\207\373\033\025\256\275\335j6'\233\355k6\232\032Vm\326\2449\233T\032\355g\257\313j\322\234\351l\026\201a\250qhd\215\214\210\210\224$)H\2061q\006\"CU\306\r\022@\222I\216\307*\312\\ 2c\033\373\377\0061\274<\304\277\276\302\367^\335\2559(b\273\360\007^W\231\260\tn\371\300\235\201\371?1\276\223\206\206s\373\233}T\273\204\204c\nl\321\305=N\037\237$\025\f\004\366\367\036)\317br7u\334\333\232\251\305G\255\200]\316\2675\030\201d\211\364\307-\030\305@\212O<\274\304?\301UV\260\255\017\250w\203\323\212\\'cI7JbtQ\256\\\376\242\250F\277q(\374\344X\224\277Y>N\241-\243f\242\f8d\240\361A\0277\032[h\n\315\243\247s\376\351\305&\2649"
+	.string	"\223\305M\325.\005\275\300\b,\201r\206W\320`\032 \337[!k\217\275_\214A\2323\351\021\237\233\206b\013\366\3622\314\334 \244\376\f\255\344\017\316\263L\267a\214\226Q\307'\0208\224CZ;\017\257\237\361\267\251\337\361yR\310S\3002\362\024\235\346\271\230\350\377\\\367\257\320\rb\202j\202\335c\305\2516\261\304\351X\373\211\340U]}:\240\023`_\322?\331\262.#(\361\252\200m\352\"\324\003\344{\034{\272\n\306\024\235\321>)D\341\3743\317.\221!\252\265\332\340\024\323D\325\200 \202\001\036\207\305\372\245"
+	.string	"\225\366r]^\0207_\356YW"
+	.string	"n\347\343\370P\256\240\306\202\244=3.\243"
+	.ascii	" 7\013\\\346\n\342\251\200\363\177d\017F\322\217\361\240\031"
+	.ascii	"\254\037\320\367\327\246\210\031\323\272\367\301\002\324\024"
+	.ascii	"`o\022\002\370\225\327\337Xh\030*\256\023\t\300\345\334\210\035"
+	.ascii	"I\364\251|\232`\330\276=\257\234\256\027U3N?F\325\312\242\327"
+	.ascii	"\314\277%jy\275/\326'\222t\254\332\226\343\317\220z[lC\337\320"
+	.ascii	"_\257\354\262\353\n\025X\t\263\206\223\354(q\023p&M\233\361\017"
+	.text
+	.section	.gnu.lto_arraySubInt32.35.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\032\002\305\021"
+	.string	"6\"vF\360\356&\035\202\323\302\317Q\t\277\273\263o\032.\261\343\211r\326n~X/\274\333g4u\376\272\365\346c\317d\315\202\236\2755\246\321\260\315\370\f<\207\037bp\035\345\343\332\362\240x\334=\326`\304\022\262\245L)`"
+	.string	"`"
+	.string	"^"
+	.string	"\013\202\370\200w\316\340\005t\347\274{t\347\374\262[\034\264\331\003\315^xn\273\373)\007\227\3020\f\037\301;\346\353\\\324|\371\265\033\200Q\223\321V\316\305\222\013\214\207\023\315%\212$!\t\335\366\234\321`\031qd\256\267\035\301\355HF\223y\226\034\354\256SF\213\271\273\333\256`\033\202\235\021\002O\2272\335=\315e:>\255\232NM?"
+	.string	"\201\233\024)*va\302\030[\304\t}\270\317\355\227\360m>\036\362V0x5\240\013H\273\373q\316\017\274s\327\260\235$\316\363z\217\207\"\200m\331\220!hwA\334\300;W \336\243\333\221\301"
+	.ascii	"$\ny\332\027\361\234\327uT\216\332\245\311\t\332.:\215\352\251"
+	.ascii	"\032\305n`\035Z\322\273\272\223r\032\215\374\237\024\024\257"
+	.ascii	"\203\257\322}6\303\222\241S9T\365\261\020\361>\321]S\037\003"
+	.ascii	"\001\313\320&\275\336\366\350\342\366\342e\006K\206\2525\023"
+	.ascii	".4\325\032\033\\I\021\233$$+\215\215\272\316\337\361\235\377"
+	.ascii	"t\360\347x\317\277q\237\333\224i/$w\225P`\251\270\005\n,\244"
+	.ascii	"Z\255T\347:\031\221\020\255\n9\231\340J\255\276\022\326j\305"
+	.ascii	"R}%$\251\325\247j\235|!\003\3142\031i}.\026\253\365i\200{\245"
+	.ascii	"\361k\367P\340\024\261(\214\323\032\233f\024\245\312\"?n\322"
+	.ascii	"\331\206\232\364:#\210Z2\351qw7:\301M\212\322\307\334\216b\032"
+	.ascii	"<\365\177LPN+\362G\026* \240\202\031\313m#\016\224\003{G\226"
+	.ascii	"[\224\276\265\240\214\244Q\370(\376U\034\331\221\231y\233\006"
+	.ascii	"Y\301\211\005,*\260\004\213i\256\262\225\331\036d9\355\266r\r"
+	.ascii	"o\030\215]\334\2601\265\016\247\003\033gmv\230!\f\267dbin\300"
+	.ascii	"(\371^>\213\2440T\215\367#\322\271\304\023"
+	.text
+	.section	.gnu.lto_qPercent.36.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"e\b"
+	.string	"F\320:8@\345&\035\355\275i \217\230\300JI\232\t\341\220\300H'\330\r\341\344\211_\325\255!\350\214\232\031A\250\226\3210G\321\031\307\300\252.\270\003\326\313~D\233l)S\n*"
+	.string	"+"
+	.string	"("
+	.string	"$1\273\033\013~"
+	.string	"_\345\r\340+\335\370\366\334\374\217\374\245"
+	.string	"X1\235B\317\200\206\335u\232N\025\267\336v\202\355\005\333*\001\001\226\245:A\331\326\354\214\355L\373!\027\321\316\201<\260\213\341a\262\273\fV\020x\245y\266\375\217\203h\336\222\343\240\200(\213RF\201\327\324\204!\245\\\016\202\252\327,!u\214\262\263\271P\252\206\375\267\232\341w\356WM\247\246\017\343\305[^v'\272\022\267\265\361<|8W\354`\327\205Y\261\003\301\271\242\225y\342\006\301X\204C\026?\030\226\305\f\267\367S\215HGN}\372RJ\224\235\t\036\013"
+	.ascii	"2\003\3020H\341H\232\315\2720\216\2145E5B\2011\002\2320RRL\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_qMultiply.37.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"%\t"
+	.string	"fR?6P\215\322\001%\320\nD\311\231\236\".\r\312|\306\\\330\002\020\030\306j\036\325~4\351\350\237\225\234\347\250ff\206\310\362\261\374\305\267\001"
+	.string	"m\303\216\275\211\224)\0050"
+	.string	"0"
+	.string	","
+	.string	"[r\252\t\270\2528\271Rv7\016\274"
+	.string	"\376\345\t\340\237j|{n\376?\216\241\250t\250\324\350\t\300\260\273NT\212\342\326\333>\260\275`\377\022\022\335\312\226<\221\225m\221}\261\255\371\326\346\267k\001\222`\371s\246\375\216{\210\316E8`\367\202\025\262\273\nF\260\374a0\333>\353\034\"\007\3522\275\236\336\264Q\312\316\230^\223\344\364\"egs\243\324\f\373\330*\206\3554<\367\277\267~L\323\252\351\324\364-Qu\223\223\335!\bO\207\363\036\356M\006\344\020\322d\261\243e\231\266\211\035\216&\213\233\017(f\f\254y\032>1\244i\237x\341\366\206\212!i\311\252P/p\217\300T\325\016"
+	.ascii	"2\003\302\260Z\270_S\363 X\230A\270&F\322b\177,H$d)\240\206\200"
+	.ascii	"\023F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_qConstruct.38.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\r\t"
+	.string	"\306Q>7@\305(\035\325\026\361\006/\232G\212z\315Fh\305\372{\224\234\034\202\t\356\211\332^\3356m\351 ;\232\355\346(\212\341\300\215=H\034k\273<KD\357\275\245L)/"
+	.string	"/"
+	.string	")"
+	.string	"\027'\210\302(\255Rv7Z^"
+	.string	"\377\334\t\340\237Z\034\364\004\371\367\270;\001@b:\205\236\001\n\273\3534\235$n\275\355\003\333\t\366+\001&(\273\021-\326\226\274\020\224\355\217]\261U#\227\353\317\232\3669\336\361\371\006\341\267;\221\002\331\335\213\021\256\277\201\264\355o<\3651\310m\001\026\201\327\324\223X\243l\331\3515?J\001D\331\262\267Pj\205}\267Ja;\r\257\372\337\267\337iZ5\235\232\376\0253\036\331fA\261\207L\255\301t\030<\031,f\032\206i\232\2305d\260\250\341t\"\306\300\232\303\206\023=\232\306\211\225mo\250\026\221\216\024\352I\032OUu%\360\017"
+	.ascii	"2\003\3020-n\213\301\n\260\345\237\303\271\206G\322\002~L(`\016"
+	.ascii	"\f&\240\206\200\023F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_sin_approx.part.0.41.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`F\004\345\030"
+	.string	"\366\352\226K\300\020)\035\346P\236c}\250\346\374\005oe\375z\334o\327\227R7z q\216\206AC9\223ZQ"
+	.string	"\241\3775\272^\363\226\253\t\024\b\022A\223 H|v\353k*@k\232@\376\327l\037*\332\2364B\b![J\231\002\203"
+	.string	"w"
+	.string	"\200"
+	.ascii	"A\273=Z\244\332/t\220;-H\321,Q\325Za+\226l\200q"
+	.string	"E\272#\343\212\375\363\376\330\265m\235,\263$G\2216\273j_\256\341Q\330\026\031\013.E\342q\243\007g\303\236\007X;\032\330$c=8;[\272\330e\240%\265\326\035\332\3510I\223\3431g\3052g)%s7\037^<\034U\251\232r\332\340\262\r\317\306\315\nqayd]d\254\326\372\265q\330\277\366?\214\377)?5\t\314\017a>\b\363?\230\377b\276\213\371-\346\237\314g-\323\336,\311Q\244\315\373\333/\2005\360T\353\315\320\252\362\210N \266i\227i\371\337\177K\320\276M\033\374\t\2441\321^\202[\272\220\326\340\n\021Q)\250}\201?IL\2405\310\300H\306T\255\365d\305\237\234y\177\253T\203vg^\245\013o\326\312\242(E\2555\301\212GP\256\370o\022\355\027\322\037Pf\267\210&\335\320\215\207'\331\343\325\253\246\367\304j\337}f(\001\237p\\e^\354Q"
+	.string	"\212\002\030\222\212J:v\213\214\023{\201Gd\373~B\244}J\267\273mN}f\200Oc7e\262\241\353\211\224\272D\3724b\356m\233\323\031`\013\034W\275\227v\373\204k\202fGT\375G\\\2556\223m\356\r\356\tQ\f\235\320\215\207\357\355\246\0259\036\267\357\355R\001\252\232z\373\374\373\333\025\t)2\034\343\322\"Ce\366,(0\021bVd0\227\231L6c\201\271\264\254\310`,/00\024\222\317$@x\201\305\314f/\260s\333\247\201\260w\202t\310C\3721[\337Z\017h\364`\221}j\212M\342\241F9v\371\321e\203\364\352\320\365^\315\352\217\346\253\016*r<V\256~\265\b\245\023j\265\331\256\036\227tC\025t|Q9pg\267z"
+	.string	"\224\256w\343\341\b\034/~\013\206C)\263\317&\260dv\331\254\026\177\204e\227\035a\250aL\345\0303BB\nR\220\024$\035\260\002\231\301\342\006\021\200\255\223JhAI\n\255\031\257\003\360\221\377\343\3051\224\3424\236{\301xJ\027\nb\357#&g\320\317\356\243r\227]d\335\310\316\251\013\224j?L@\342\344c\362\354u\277\221\03106D\023\002\035\370U\306\030\337\230\246\206\230m\254\242\244%*\334\315\300\033(\260P;\214d\022\221\310B\263\335i\373\366G\372M\240\372\t\236I\270N\247\354\372)\004R\261\\\223%,I\230\202\374a\377\256\031\271"
+	.ascii	"\257D\fKq\355\212E\030\236\237\031\312\003\204R\275h\030\002"
+	.ascii	"\021\227\230\344\2604\361\232\266\202V&Ku\230\327\251"
+	.text
+	.section	.gnu.lto_sincos_approx.part.0.43.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\215\002\245\022"
+	.string	"\346bvE\360\260(\035\222\r\360\376N\325\345T\366\356\207*\3104}\214\007[\377x]\316.\274\340\262\253\315\263\203\370\312V\033k\217D\346\314g7\231\3102L\225\006\265\202'\223\227\247j\262\236\r\330\333\222O\366\2262\245["
+	.string	"f"
+	.string	"_"
+	.string	"\273_\b\367\350\217\313\374\307\202\337\202\2009\323~\211\233h\375\204g\016\355\266\030A\333\335\004\217F\300=~|\300\366\b\357\261=\332'a\233\005s\313\246\361\357\303>\326\263\022\253\261\273\335\243\312\274uM\330\362]WQ\213\206\247\200C\320\310\356\232\333p\307\333V`\373\201\255\035\001\006ez\313t\374\354\206[Z3\235\377\376\003\360"
+	.ascii	"\361\260\213\241\366\263.q'\304g\277\354i\337\376\r\313\3179"
+	.ascii	"\315\243\231\316\252Eg\305\271`\334M\f\013\r\270\313pN\374\241"
+	.ascii	"\202s\302\271`\004Xd.\370\354n\310\243\031p\217#\233\232\232"
+	.ascii	"\031\0134\037c\025\3706\003\314\212\342)ZWa\235\007\330\205\221"
+	.ascii	"\321\002\265\232\fNA=\257\231M\257 \325\234\227\210\224\254\255"
+	.ascii	"\330\335T\211\272\351\241F}\007\232\331\313G\025j\276X\271\201"
+	.ascii	"\2225\265=\223\355,\252\037*\352\262g\177\371\341\341Y\303]\024"
+	.ascii	"\220k\352i\207?45\257\231\224\254\245\306X!\\\205\261o\363w<"
+	.ascii	"\366s\\v\2172-\312t(\323\\f\252\023\t\005\201\2642\341PW\255"
+	.ascii	"HR^iS\255HN%\251\255\302]\022IIP\221L\335\3113\231\274Rw*!\231"
+	.ascii	"\272\022*\325\211\030\260G!\002\252Sy\036\252\313+\214GP4\305"
+	.ascii	"z\250\032c\233#;\224C\241\216\324.\231\220gq\352p\340YQ\227E"
+	.ascii	"\032\322\221f\316\013\314\205\313\216H\017\300\340\024\244!\335"
+	.ascii	"X\330\2409\b: \320\002\031\243\252\003\240\n\002\341\fx\007\256"
+	.ascii	"\266,i3r>\370\013\246ZH<\213\310~-q\220\270\211\325\223\r\372"
+	.ascii	"\302\217#\032\3746D{\230\327\265\020@\213-\233M+\320\037?a\317"
+	.ascii	"\213\213L%\326\302o\260\330@\341>6S\3168\202p2\266\022\371Dl"
+	.ascii	"\033\3311\265=\316\232\230E\030|\023\207H\365\325\254&\356\002"
+	.ascii	"\203\363\302e\001\342E\216J\323O\020c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`I\003\325\013"
+	.ascii	"\262\317;9 \261\322\001\264\220\302\nh\0018s\322\022R\025\255"
+	.ascii	"\305\201\003\272\001\350\333\316\013\020\242   $\343\347\350"
+	.ascii	"\356\346\026\013\356\333y\274\357\373\3561\322\275{cE\355J\344"
+	.ascii	"\2262\272\323#\261\007\212@\271\017\007\334\234\307\222d\304"
+	.ascii	"\322\366\205\230\003zx\301\335\233[\330\022;\034\362\311\bS\023"
+	.ascii	"s\333\216\227e\231?\"\313\334v\035\331\343\260\355n\325T\307"
+	.ascii	"c\313\361\327\306?\215\2732\336\3028\353\342\253\332U\026O\321"
+	.ascii	"F\\d*\216\322\225\356\246\370\te\306f\342\246\245\275$q\205\210"
+	.ascii	"'@\034\341\341$\207{\r\0371\374`v\203\205\213d\017\305^\300a"
+	.ascii	"\030\206\260\023\274\016\372>\340\272@\353\037\326=\253wT\347"
+	.ascii	"\244.\343l\025\305\231\340NP\0078}\246\3529m\265\222\033\032"
+	.ascii	"\323e\262\347\354\024\325\253\276\210l\327\335]z@T\325\016$?"
+	.ascii	" \320\002\231\242u\003{C\025f7\212\250\215-\005\023\221\211g"
+	.ascii	"\202C\023\224\225\352\007{\201X}\211\261\244A\265\260g\221\214"
+	.ascii	"b\332\265\302PX\024\006\004=\364\0338\364\r|\364H\217\276a\337"
+	.ascii	"\020\343\0332b\034\341\021z5\336\301\360\r\276\321oL|\343o\374"
+	.ascii	"\206o\360\215~#\216o,\374\221C@\003\t\256\247#\301\013\274\271"
+	.ascii	"\3017|\343o\370\206\376,\020\240\316\r\247@@\270_\004K\006\231"
+	.ascii	"f\253\241-\357\004"
+	.text
+	.section	.gnu.lto_.refs.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.3e6a1d117945e410,"e",@progbits
+	.string	"(\265/\375`\237\037\375\207"
+	.ascii	"\232\331<0O R\322I\007|YV\021\335\214\253.?\325\204&\315 \301"
+	.ascii	"G\363\353}\232\021%\0210\375\374\265\260b\376o\374F\213\003L"
+	.ascii	"n\232\241t\013!\241\246\346\356nF\005\251\252\252\020UU\026O"
+	.ascii	"\001\210\204\243\020\205\310\312\254<c\2215K\266\224){\002\350"
+	.ascii	"\002\037"
+	.string	"\003^\030\314\315\262r\206\367X\312z7\261BI\363\364\034\252yD,k\2260\241\353W\214)##\243\006\265c1P\360\370\216\313\260\224\355\270\216\007\317\344\221\255\352\331\310z\306Z\317V\3539j=;\3273\230O\3739@\177A\003\004\260U\376\002t\246#1tJE\257\b\333\006\307$\330j\353\350\302E\365\022\306\205M\253g(o]P8\256-<\307r,e.\254\345\034\307Q.\234\345\323\236%\237\233C\251\b\364\336+\")\353\b\327\252\356p\322z\276\353\201X\357\303:\306d|\3056u<\257\332\275\321\021D:/X\376Zu# GP)\215\222V\277\\\277\002\215\252\rJ\024\001p\210\241zB\345o\326\314\271J\263\252\370\310\316>\355\301\2717n\254\215\253\360\032O\271\215\245l\205\245\234\325x\312\325\350\275K\367\336s\364\007\372\271\214\241\260\0256\373\324\2329o\216\033J\034"
+	.ascii	"3'\035\003\274\367\242@\201\002\005\001(\210@\302\304\265\355"
+	.ascii	"\250?a\345'\227\030\006\360\301zN;\002I\267\202#\260~\200\365"
+	.ascii	">\353q\326\367z:.1L\200K\fU&1\364\211r\211\341\312$\206\f\367"
+	.ascii	"v\236\277]D \003Y\215\260\244\2275\"\2617\364l\255\260\243\225"
+	.ascii	"\002\347\224\020\302j\245\001\013\251,\030\234ZQ\303\177A\373"
+	.ascii	"\303MY\376\336\363\333\007\356\376\333\035\357\377\336\377\274"
+	.ascii	"\003\360\333\003\342\270X\373gC]\001o\327\371{M\205)\377\251"
+	.ascii	"\374\267\362\177\372\237\315\354\377\332\325\277\303^\340\n\202"
+	.ascii	"\002T\216\237\031`,\377\335\236\3637\020\233\n\343\360\357\024"
+	.ascii	"n\377\376\341\347\265\237\253\\\370w\215\367\337H_\377\346\341"
+	.ascii	"g\b\254\250"
+	.string	"p\342\3370\374\\\345g\351\317d?\207\375\354\3653\222\237\267~\326\3729\353\347\253\237\255~\246\372y\352\347\250\237{\374\274\343g\346\317=\374\254\374y\207\237\211~\036\3729\207\237m\370\371\205\237W\370\031\205\237G\370\331\203\237U\374\334\301\317\033\374\234\301\317\025\374\214\342\347\025?G\360s\003\377\351\376\363\375\337\362\337\355g\003~.\340\347\022?\223\370\331\347\177\233\377/\374W\341g\021?\363\374\254\3633\316\317\303\237\377\337\315\377\300\377j\376\367\375G\363\177\356\377\225\377.\374o\361\377\203\377r\377\033\030\034\034\034\374\205\320\3376\377\001d\bxU\266hi\265\223\330\255\357+[]d\253\273H\270\227\243O'\347\225\032\342\004\021\"\3355\342:\357\225\272v\357\256\352\304\216\323\231\256&\255v\327\224\245\224\001\203e\312`lM\250HY\337`\353\033H\007y?\377~\266\326\032\275ND-'<\374"
+	.ascii	"\257\224\363\304\337B\336Z\277\212\n\276\267s/\331\275\327\200"
+	.ascii	"\325\331\225U\327jg}*\314\222k\342\245\325\306\342@.;\333\222"
+	.ascii	"\327j_\251M\316\326T\265\372\277\263\375\307Y\225\300\335`\322"
+	.ascii	"\352\273i\375\317\303\233\344\274\367\362\020F\257Si\207\205"
+	.ascii	"\314'~\036\266\274\300\275\f@\357\r\302\347\267.\231&Q=\201{"
+	.ascii	"\261{\231#n\364:\233hX\314fZ\230\247\021\321{5\300E\023r\233"
+	.ascii	"Q\254'\365y\373F/\337%\254\247\030\315\350\323\331\214>\231>"
+	.ascii	"w\351\311\2747\372\344\323TKbr\023\r\353\251\211"
+	.string	"\366|\032q\227.\363\242%]\255K\317\247\346\334\363\311\247\211\226\364\324\\\302z\032\001\204oK\357\306\232\244'\314l.\335\035MUIN\037\272f\364y\357\356e5\246\353\\\340\336\252\247\363.)\212\333\224\350v(YIzr\264I)\353y\227\350\232_\317{\277\224^\334&\n\230Q\272\313\305tL!UW\007\323\275\005\334\350\275M\3672\371\322\335{\231\367^\242\263*z\357\017\237&\264\251\351^)\002\232n\025\323\215\351\336V+\323\366\324D\313z\002\271I\321\240\327F\224\311\320{\207\345\\\321\230fWG\232\025\372\324\243\257\253l\035\324\020K\350\326\216j)\226\232\350\251\363\227\376qaR\364F\373\210(=\265\352\303%\206\347\270\025\210{\331\304\220\007\007\331\204\364\323\206R\317\236f>;e\374\326\324\256\254Q\264\2352T\276\374\265\332O6\b\301{\223\372\251\273G\363x?=\312\254"
+	.string	"\263\002\"\210wb\315\244\241\323iXv\331p8\r\315\322\232]v4u\224\016\034MS/&\203:r\340\\q\n\013\233\362\304\r\021\033\303q#G\252\352*J\253\357\033h\222`\031\323*\217\001\275\233\"\304L\377\220\330`\332\221\003{j\246\277\227Z\b\021US?\251V\331"
+	.ascii	"&1\354$\240\267R?\031\322\354ju\310$\206}\247\3101\321\322\352"
+	.ascii	"\373\236\003Wf3\216\251U.\003:\017\252B\3248y\275q\223\206#)"
+	.ascii	"\252U7\201;m\202L>\004\003;\311\216$\177\2552 \263a\351\337\270"
+	.ascii	"\315q\226\242\027\215\271\2640\271\250\2544\210\374\2675jx\210"
+	.ascii	"\fF\317ZU\363\263\037\3771\030\2346<\036`\2556\003L\"\r\230\262"
+	.ascii	"\246\251"
+	.string	"f\253?\367\241\321\251\323\223rj\225\371L\360,\3319\231\225\255a\330\2145s\242 f\215\217\3658\252-\302\202\226HW\025\223Vm\027\013\342\250\361\362{3\264\261\265e\006\312<\322d/\215\226\226\275\232B\211a\324\2309\373\222\225e\257\310\204>\2600\021\251b\203\330 \366\nG\257\b_O\03190J\236\267WS\033jT\206\b\263\262\322\323a&\226\305\215\020**\033e\302\031\350\n$\320N\37045e\243L\230\373\273\222B\365f\265P\026\312F\231p\207E\252\360\360\003\264\341\314\023.\353\3436*\005\351\021&\013\362\224A\355\340\362\234N\333#\317\n'\315\330[\023\313\343\266\307\236M\263\223*\265j\237\372\215p\351lO\311\332\020\343\302\222\212\261JV\311\356\270\203\016\373\340\242\300\264jw\3346\355\360\r\031\222\243\325\333\034V\207\031.rb\346V{\303\342 \343c\215\226\n\367"
+	.string	"\316 soM\0164\320\b\222V\355\222\265\221\363\303\215\225\026k\3032\221"
+	.string	"lbc\276\036*--\034\255Z!N\006MZ\036\247\351\251\213Zk;\023\024\264\314)V\324\334\242P\366\3362y\204\350\023\342I\253=\330op\332\3020\345\275\261|L=\226\336\270\261_rLaq\303Z\254\f\326\361\205\371\371u\033\274'=u\345\367\206\315\273\3154G\n\267\306\246\325\006\374t\265S\373\361\246\325^\363\251\030\036\226\233V[\215\231\226[\230V\373O-b\306L\367q%\341\023~\271\241\262\207\346\335\367F\364\302c\036i\265\371\376f\237\322\351T\253}\346o:?\266zTi\265\367\376\0268\005\312\230V[\357yw\327e\326.\350\2226F\214\340\275\3130\224\236\025\023U\017\324\317\b\263\325\253Nd\310\364\030\023\360\254z\315\207\236\2206a\302\364\030\234\353\304\223\322\261\333\342\341%\346=f\212s\006\f\212d\257K\227\246\263k\003\025Fs\244\221\372\362\246\333\023q\371\352"
+	.ascii	"[m/\275\245\307\304\342\240\310\300\301\265\234\036"
+	.string	"G\265\201\342\301\345-\267\327\203\226\205-Joi6i\202>\266\304\235aA\271\271\355\320A\305\314Z\325\302R\376\367\305\305\257\213\233[g\231\343[\363\232^;\260\274\263\\a\263b\245\247\r%J\267\252\354"
+	.ascii	"\246mAc{O9\260\227\300\236\364Z\3555\016\034:E\373\3708p\210"
+	.ascii	"\367ue#*EJS\261#\263Lm\364\006[m*\323\036\265!m\334Zm\265O\355"
+	.ascii	"\224: UM\316\316:m\253\b_\373\260\253BC{\247\275\211 \203N\211"
+	.ascii	"\3627\242\234\227\254 oPnc]\300\242\321\366\342"
+	.string	"@\212\023\237\212v\003\315\tVYY\335\2240\215\254\tj\212\214\254\273\370^1j<\374\3048\b\240\222\260\246\260\260v\342s\225\3044A\207k\256\336\2344y;\231\252WwS[\255\266\330\247\"\330\314\356\212\330\273\202\201\t\366XE\371R\372;\322K\216\264\327\020\t\222\366Z\231\234\246'ub\207\354k\r\210\222\267\327\236\020\355K\2105\2556\364\323\234E\311$\bAB\242\2452\306\221\360/R\034\025\025\025\205\216\226G\035~\220\220.$\240\201\204<\026I@\001\213 \026\027\320\3701\016!\025\t!\217?\312#\244\237\237\031I\345\213e\022I$*\032\213T!!\321\022yT\026\r\227BH\312\345\0212\031B\214\234\032EF\307e\021R\213\0308K\244QHid!\306z\202\016H.\324(*\225E\036\"\f,\250\200h\005\t\f,\250`\205\322\270,:\222`l\301\203\320\021)\006"
+	.string	"1\030\225\304\243#\243\220Pqx\303\n\033\200p\020\3228*\227\305\026\313d\013CEG$\035H\304`\354\341XT\204\241L\"s\210t\214.\220\305\026\214EE\241\243\234#d\3618Tl!\371\302\221\321\250ta\034\362A&\217\313\342Q\206Q\204!eq\bY\\\272 \3038\024\200Q\bY<*\2131\3100\016\351\2748BbA\206q\210\250,\032\213B\220a\034Z\211z\206\220E\035\206\212F\021j\024\031\031\025y\210\224\306\031I\243\341\220\220\013k\004\243\250\004\340h\244\"\310\250\250\234\261\026uT \213\313\342N\016O"
+	.string	"9\023\244X*\213F)h$\225FF\305 \344\361h\304\205\212\214H\2451\205\243\244\020\362x\264s\241\243\322\2104\272XO\001\013\tX\\@\203\370\0132\230 \203\t\206\277 \003 \240\fX"
+	.ascii	"\255g\001d\227A*\200h\034\211\210\313 \026@\305d\021\221p\031"
+	.ascii	"\244b\305\022y$.u\210\214CA<3\2125lQQR\251\276\020Z\036\215\204"
+	.ascii	"G\306\"\027\310\342pFQi\225\311\245\220QF\220\021\021\316\fL"
+	.ascii	"\003\327\300\313\027\005<idT\376,\223I\345\217\0162\b\206=\n"
+	.ascii	"\222a\034Z\036\021\017\004\024B\0020\250P\302*\224\342\350\305"
+	.ascii	"\262\b\343\007\231\204\001#)\364\203<\026a\374\b)\217~R\230h"
+	.ascii	"\321b\206\0219T\224\f\2021ta\206\021\031\004c\3709\373%E\214"
+	.ascii	"\f\234\224(\005d\343\361fw\b\331\2201\r\221Ek]\203\002%\260U"
+	.ascii	"{\245\255\233\305r{\305\266\355,E\355\025\365\336$f\005z\230"
+	.ascii	"\025\020\276\035I\2122TOT\232\266\027Z\225\324+\352\207\227\204"
+	.ascii	"\313\256uM\031Dc\246U\265\333*j\335\325|h.\300\002(,\302\245"
+	.ascii	"\f\252UK\305Nq\263\276\354\026\255\314J\371\217\243W\352\311"
+	.ascii	"\354k H\234\032'\200\267Yu\302\305\220 si\267\322\317\r\007\323"
+	.ascii	"\332\260\354\331m\024\273:\271\263\264\325Fo"
+	.string	"\315\250z\344}E\327\337B\371qv\210\314y\351s\262~\270\244I\023K\326\265\303\304\206\353n\354\226\314\212\230\344/z\327\252u\322T8f_\246\306\210|}\331\2603@\240<vQ\273<&\267a:yh\306\304\264j\301\332\352\313\225\234\221!\020\013\265P\353\225\344\307\237\323\331T\311\255WS\t\371\221\004\256\255r\342\364\230\300AqqY$<\315\301\307\263\304\325\224b\217\334\"\361q\003\013\253Uk\204\005E\220\271\003S\322\001\202\300\250b\3714H\003\231\031\231\022\021\221$I\322\030\202\013\020\004#Q\036\366\314\003\022 %-\224#\246Ff\244I\241\320\0010\224\034Nd\030I\323\035_'\356N*\356\362\0351\277\334\244\330\017W\022$^y\214$\332%\266\245\370~`x\203\202\267\003\224\305\0337 Cd\320\255,*N\254\203\225*\031\356\207\307\364\001\231\005P\274=\370\343\250Lx"
+	.string	"5H\205=\273\230\273 A@\003\301\027\007?B\022\264"
+	.string	"\205\362\227\304 \325\276\264K$e\316\013\r\035\222\216\021\f\3230\003\323\366\340\336E\035\201Q\f\217\006\322m\272~$\303`\367e\274L\340%\326\327\320\211\031Y\314\027\251\250\264\n;\025d\001\002\251\367\017J\031\366>\277\346KL\244\214{\264\274.LA\343\033\261C\200\003J\303i\017\214\263\350\023\025\264\341\337\025\241\202}\035z\260\241HT\360\312\315\346\242\221\353\001\325V\345\201V\366\261\034m\257\2412\3701\205\336\224\017\206_\320D\203Mbd\201N&\231D.\314\224K\361Y\374eg\024<e\260\026\227O\336\356\303+\343\222\027R\244\r~\260_\253\225\023!\243\246\016)\037\2316U\016\366\365\267\306\305U,\274\272\275\270\223\177\240D\027J\203\341E,\212\257\217\310w\267\001\275\222\342\204;aZ9`2\302\357d\367Mpr\301\365\223&h\340\023\001\252+R/\n\356*\321Z\232="
+	.ascii	"\021ab[N\n\232\032p\363*\274\250\213\204\342\271\no\316x,:2\251"
+	.ascii	"}\024\"\260\365d\350\213zQ\331\013\b\313\032kG\355:s\364\204"
+	.ascii	"J\330\0054\241\212*DY\"\202f\202\204\352\372\027\030p0e\276G"
+	.ascii	"K\024a\203\003V\201Y \350\\E8\340\244\332\035\214\232-mX*\032"
+	.ascii	"\205-T\300\251\274\313[<Yt2\001\357\252\367\217S\227R\340i@D"
+	.ascii	"-\354\312\302\337\234\341k\300\207\342\375\340}\353 .\240X\241"
+	.ascii	"\\~d\227\275\305X3z\314\202\361s\354H\321\227\024K-`Mi\005I"
+	.string	"3p\323 \003&\307\201\024\275\345\374\232\013\227\227H\327!D\340z\276\022\321u\313\301B~\326\211\214]\201\210u\316\002\340\315`\317\361\307\025O\332\236\362\320\270\312\235_9\360@y\272\377\034\030\232\234\005\272\354!\256\213\323{_cQyr\350G\223\365\255O\037*\347M\250\004r\260ahx\362\304\241\275$\324Z\206MUJA3K\360)X?S\216\f\2423\t1Y\217\262\332\216Ph\002HK\"VJxR#\202\223x\250\007t7e{\275\275w\007`2:j\3776R\024\305\371}P\023E\214\374\020\"b\240\210x\343Dq(VR\253\233i\377\034\212\210|\257\352k\372\304\234<\201\027\200\031\326\022\374\237V\343\277n\376\334\241#\017o\005\r\320\021t&u '\221\272H\005\3074:\234h/\377`\212\204\261|\301\361\007ecB\270\021\202\330\317\317\026i\002\222\377\334b\034\314"
+	.ascii	"\241\244\024\227N\236\265b/\023,\001\366\216\372\274}Djo\270"
+	.ascii	"-\374#Tf\332\023}\024|\233'\352\223\237M\365\017D\331W8Vi\016"
+	.ascii	"(\206NB\303\030}\356\353+\004\236*L/\350`4\223\373\024@\001M"
+	.ascii	"\001z\266\013\312\232\245\210\315\226\026\036\251^D\302s"
+	.string	"b5\245x\216\303\"\007R\b\313\224\3061\020\266\314:\262\301\273+@\270\316S\354\272\216\221\t\314\326\276\037\032w\362\261\373\022\021\024\017b\233\353L\230\320E}\325"
+	.string	"\213@"
+	.ascii	"\260\3005@\004\3710)<*\305\317T\330S\335!\346\235N\371\222\336"
+	.ascii	";2\3709\271\201j\177\016\2761\226y~{\362\357\024\033\327\031"
+	.ascii	"!\374\272\036\007\210a\n\033\024\375+u\320\364\357\256>\243\037"
+	.ascii	"\327\362\032\311\240\302\257\357\207\342v\336`u\333\017@=\360"
+	.ascii	"\027\373&\331\315O\254\320\226\266-CY\334k\204-\377\034o\374"
+	.ascii	"ru0\374\213\216\006\247\226?\331H\332\216\345\001\376\353yz\207"
+	.ascii	"3\36478\305d\344\342\220\311\300\337?\004G\302[ueTN\217\207O"
+	.ascii	"\315\214\203{\227/\335wZ\364u>`\326X\372x\234v\356\320\\y`\235"
+	.ascii	"3\241C\254F\3609\367}\256\214\367\271p\202\325i\377\024qH\236"
+	.ascii	"\246\363\317\364\344\374\243\215\035\304K\365\370\346\302\035"
+	.ascii	"`p\312\232f\273^\361\367R\254\331\323}i\037]\037\017\211\271"
+	.ascii	" y\352w\337fT<\302\247\346??\373\031\206eK\n\023\337\257\004"
+	.ascii	"\377\003h\254\337\312\266.N\247?W_B\227@j\3757\363&f\267\316"
+	.ascii	"\264/\266\256m\211\357\355G^O.\272qfy\231\346D&\027\340\243\025"
+	.text
+	.section	.gnu.lto_.symtab.3e6a1d117945e410,"e",@progbits
+	.string	"sin_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"wrap_2pi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"sincos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.string	"sincos_ramp_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"gcd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"powerf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"fapplyDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"devVariance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"scaleRangef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"normalizeV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"rotateV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"quickMedianFilter5"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"quickMedianFilter7"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"quickMedianFilter9"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"quickMedianFilter3f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"quickMedianFilter5f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"quickMedianFilter7f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"quickMedianFilter9f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"qPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3e6a1d117945e410,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
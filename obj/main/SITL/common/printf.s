@@ -0,0 +1,626 @@
+	.file	"printf.c"
+	.section	.gnu.lto_.profile.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375 \362\325\004"
+	.string	"\324\006\346"
+	.string	"\f"
+	.string	"\343\214\373\264\003\004\002"
+	.string	"\001\312\334\346\233\004\006\002\001\254\277\363\246\017\002\003\240\342\234\212\n\004\261\316\222\345\017&\002\003\002\003\002\004\002\004\002\005\002\005\004\006\002\006\005\306\261\236\222\002\004\002\007\002\007\002\b\002\b\006\007\b\376\220\273\353\017\b\002\t\002\t\t\252\335\206\331\006"
+	.string	"\002"
+	.string	"\n\206\273\306\320\013\226\266\306,\002\002\002\002\002"
+	.string	"\022"
+	.string	"HXmc\007\353\007\025&"
+	.ascii	"\237d\251\273\327\320\361\3252\340r\016l\250\025//h\345\006."
+	.ascii	"@gX \313\334\350\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\335\002"
+	.string	"\344\002\002\001"
+	.string	"\007"
+	.string	"\005"
+	.string	""
+	.string	"\003\002\001\200\004"
+	.string	""
+	.string	"\001\001\001\002"
+	.string	"\001\002\005\001\001\004\003\005"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\005\n"
+	.string	"\001\013\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\022"
+	.string	"A\263\211K\201\2251\360|\236\244\263\206\374\200 \n\204\0022\251B\303\271\302\305b\220\204\263\3402`\0270\270\260\273\272"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.inline.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375`\352\0015\n"
+	.string	"R\016.0Pm\222\016p\361\"P\n\370\246Q&3B\303\003\205\025s[&PT\274L\306\354\373\231\332UUUSA\303\200u\233\277Q[K\b\331[\246W\223G\256\344\275g\311@_Zo\t\222\303SA\342\360\013\017\204\016\200\fe\203l\026yzi\255\344\372Z\330T\365\247\212}\245\311\317A\214\f\205\217\233X\320\200\350C\034\211\bIh%\255\251\302\277\222\377k\330^N\202\274\2462\3075\016\3643\225\353\363\261\367nrr\247jh\003\277\030\366\324R\247\374\3268j\360\275w\320\276"
+	.string	"\031$D,\004\",\376\016\233\177;\315\241A\346\355d\203\003\305C\300C\343G< P\002A\212\354<\fbG\270\200x!\031A\233t+\224\310pw\001\2020G\200\320"
+	.ascii	"\356\001j<\200cL\301\013\026\032\356T\375X`\331\313:\310\n\001"
+	.ascii	"\241\300\210A@<+\341\n\034\274\020\306\034\351B8\201\202\216"
+	.ascii	"\024Y\b\301\200&\032\354\001\021\035\346\212\206\261\002+J\177"
+	.ascii	"\201;2\225s\f\303|\030-q\020\n^\203\202\372\204\205\"7\331\301"
+	.ascii	"\301\325]\206\270,\303\276\327Zw5Z]\234\272\256\360\272)\260"
+	.ascii	"\236v\207"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375`2\004\005\013"
+	.string	"\222\216)*\220'I\007\313\374\037\373\001\276\037\177\273\273;^\\\231\225\260\325?\307\005\315*\177\302\260\367\243\266\310\266Flk\244m+\223\f\024\350%\236!\327\375P\377P\bh\202=\346\2530\362\232\364\376\342$\215F\002\364d\372d\204*\202\301\221z\341~\360\202X\326Z\266\206gx\351\376\360\016w^\013\206v\234\tT\311\230\246iz\271!\352!\252\037)\376\320\345}\266"
+	.string	"z\211\322T9b\306'c\363\355\3525=\306\367g\307\221z\216Tw<\363\256I\334\244I\236\031{\253\307\364\026m\323*\221\023*\230\f\004M\250\261A\241*I\013\264op\"\241\262\234\007\022\340\3610\002\216\310:\001\223\006\031q$\230\231`\202\t'\r\267\032.c\337(F\b\261\2227\236A\370Qh\"tM^+3\305\216%\330fh5C0\227\314X\265\2429\034\364\344\235hs\316\034\367\025\244\266"
+	.string	"\022g\325\201\331\347G\017\214MG\314$\274f\003\"\327\343x7v\002q\266C]DLd\246\201\370\202\236q\031\250\f\007\372\370\307T`_\232\0220)\343s\230 n7}\205SNBTm\257\310\2051j\236[\257_\212B\231p\314K\246\233"
+	.ascii	"\254\023HZV\211]\200=\277\320\277\274\200\023"
+	.text
+	.section	.gnu.lto_.pureconst.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\231\004\001\232\004\002\230\004\004\272\004\005\230\004\b\270"
+	.ascii	"\004\t\232\004\n\230\004\013\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375 \341\325\003"
+	.string	"\322\204\021\036\260%\351\300%\017\2255\f\013\032\320N\312C\266\352\330!N \3046\3226!\244I\231\002\013\n\207A\001\034\204\203\020\205\201\312Qg*OeslB\246*Wm\347\353U\006\312\371\206k\327\216]>\233?\021\025"
+	.string	"\b#"
+	.string	"\354Ub\261\017\021\214\206y\202\001"
+	.string	"og\260O\305;\025\341%F\251\003-V^l9j\020\227U\2356\354\022\257\330"
+	.string	"l\035"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_.lto.ba8fb212c652f0cf,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_putchw.24.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375`\335\004\225\036"
+	.string	"\2267\301K\240\326Q:\005\026\337u\256\272\"#\270\312#\271\216%\250a\3353\255E\037/kX\331rJ\005\260\251P\241\376\273\344\331~\3322\013\270^\217\327\202\327a\253\360\3709\005,\247\227\006\021(\007\227u\214f\255\021B\b\331r'\031\257"
+	.string	"\246"
+	.string	"\253"
+	.string	"<\345/\367>\345\330\272\267x\200\013\234'\271x^\307w\364\230\271l1*\330\023\206T\205\345\336k\313y\255<i\017S\236\354\025\263\030\233\307\343\361x[<\227\266w\332L\226\306\320\323,I\333\265\307\357a\362J\n\372N;Q\242\316\240\226L\\f\342\2515\217B\304x\023%'\333\003\3665\204\251\306\004@-5\035=\252\347\211\232n\332\226\372a$\r\"Y\b<p\260\270\361\002h(\tkI$q\322\364\2617\204^IA\022\267#\336i\260\310\346\334{o|\005\006\215j5}\356\275\\\223\202K\347\2263\237\0023O`\266\022\002765/\3764\227\372g\236u\226\251\305\300\274\234\352w\371\325\337\222\336\352\247\331\312\261c\235\321\363Zg\363W\347\222<\325\331v\345\356\312\325V~"
+	.string	"\005Ef\216\367\2068f\271K\310!2\216\365g\375Zo\3463s\217\037\344Bnd\0313k1\327\351S:\255T|\360\311\342\235w\206i5\225\364u\357\215\2005\364\373SB\177N\200_\367\026uN\362\203\223\274\032\242q\271FS\037zx\030\364n\305\343\276\327\211J\203\256\247b.F\357M\241d\353\336{\200\027T)\017Bl\257\314\357q\037\275\027\003G\2440\"\035\"\216\262\240=\324\271\355\033\217BMu\031U\260\267\023)RX\347\251s.u\216\323@>m\263-m\247\rd\027f\017\231\003Q\213|i\r\304\036\266\245\321\006\336\370\023\n\261\213\204i\266\326\245m\003\267\376>\324\211h\340\235/\370C\345\311\367\237"
+	.string	"\233\210\352\221\023\034\355\227\206 \364\372\331\260\367\336[\362\316m\3034\215\224\237SQ=r\0039\361t\204\354!\327\3169\257\254\025\301ye\254\201l\271\350\263=\254"
+	.string	"\2100\270\232W\322\272\006\304\212\251(F\025\214\271\350\253=d~\203&IZp?1\343\0047\f\273]\220\216gf\370\251\271\003]\250\035~;Pn7\224\263\374\263\003\264\273\005\351r\266\033NH\b\367c\273\005Y\020\262\375\3506\330v"
+	.string	"0.\207Ag\333\341p:\233\254xogg\337\334t\372\313\261\204\250\213h=\254\021CVc\366I"
+	.string	"\211\254\326l\323\226.eZ\247\343\325\242d\272V\225]\353\nL\306\331\3315-\323\335<LFd=\344\247\375\3047>\206\202\030\206\332\340\2649"
+	.string	"\t\032\323l\315\264\311\006\222\375\024S];';\246\035\b\257\374]\305\n\223\250\230\201\233m\323\266\252\254\265i\232g\232s\216\332\307\261\256\315#\f_\250a8\343\020R\006\031\031\231\200(H\242\016\200\002\231\301\272\r\021`5FhA2\354o\305\024\377f\211\030\"\371\377\3236\223\271S!\217\237\252"
+	.string	"\315\255\037\335\302\347\006\nuy\356x|F:\242X\022\375&\301H\251\fe\226\241k\037\3364\212\251\263\351<|G\323p\344@\035\245\227X\332\t\251\350\353\t@@+\n\316cK\261g;p\226\3471\026\212E\363\375\001\274\317\013\370\0274\227t@U\207\30710+L4\020k1\267\243\234\262\326\273\362z\247`\304\177,:G\bn\364\255C\016\023\372u\343\354\253\342MM\350\312\341\255G\224\201\317\374W}\254g\314\225\357\351<\222c\002\007\270"
+	.ascii	"\311)\347cS\236\032"
+	.text
+	.section	.gnu.lto_tfp_format.25.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375`h\017}J"
+	.string	"j|\200\033;0&k\f\364\222\232\2428bC\2210\372\217\037vDW.\226\277\221f\367\341\315\310\226\275Y\373\335mb\177"
+	.string	"\236\323\274\2602\330\326\273\237\004\360kk\"\331[J\271eJ)\005\256\001\213\001\243\001\177+\334DB:1)\334^63\224\033M\253\351\302Fd#6l6\320>\364\341\276|\033\004\257D\276\357\333\t\306\243^\303\211n\364\3155C\227\027\031B\001\003h\2479{F\251\257\333\002(\214\177\224\275\344\017~\rmB\206\354\327\363(\377\b\364\2225\360\352\334\325A RJo\021\301#\027\3346\303\314\354%\207=\031!~\f\337\327\320"
+	.string	"/\360@\"\204`\355\314-\246\307@\233\312\177z\351}\353\366\f\337\227j\200\275\334^2\325\3550\375\007eN\\\251wpMw'-C\371\276/\330\263\237\330^\256\335\304\366\362\255\360\323\241\255\365\314\302\272\262\252\242\232\222\212\202zrjbZRJr\"\035\0315\231n\313.\327w(w\230^\225\r.\332Z\353\007V\025\267\306H\336y;\263J"
+	.ascii	"\354\303k\3044\177\256\305\rv\026V\243\211\351\253\257A\300\266"
+	.ascii	"Z\356i\251zC\345E\375\363\233:\304{\3743$\025\325\327PY\366\374"
+	.ascii	"\311\357\f\377\374\234\232\364\232)o}ny\273\342K\213\275.N\241"
+	.ascii	"\212i\245\244\273v\336y\233\262>\337\367\235:\322\231>\222\002"
+	.ascii	"\346\017\317\017K\0309\266M\"\347\327so\200L\243(\335\354;oQ"
+	.ascii	"\2408Sk.\356I\273\253W$\033B}\347\355\311\372\344\266\307\326"
+	.ascii	"\213\255\265\345\315\211\267M\232u\302I{\261\275\rn\315\227s"
+	.ascii	"qc"
+	.string	"z]\237\354\320\371q\302\251\255^S9K\214\340\212\3707b\257^\240D\376\031\232\213\033lo-\274\357\313\316\006\027\327\f\240\231\335\214\231c0#\031\t\354\327\2675\237\337\224\235\360\016\b-#|\327\2671\223\261\355\367\234\340\234\"~\210\214e\277\375^\233v=\373?\344\364H\027\265A`DMxw\\\376\362\177\310\025\256qIsP\250.\217E\320gl\204\357JB'\270\247\351@\271\300x\272\323\343\026\302\3662\302{\2316(\377M\246\233-\220w\023+\340\377_D\251\\\343\362\325\213\275\005W\247OP\327Q\343\340Y\026h\256\307\361\253\343\3324\315+9\311\3739<wx~\252}\224\303\276\037B\224\252t\021\232W\372\230+y\034\327\267\343\255>c\303>\207\035\311F>E\374\3207\366\t<\363o\307L\215\372\201\276$r\370\353\230\307p\320\220\321:\213\261H\321:\243\030\321:\213"
+	.string	"\321:\177\350\300\356\016M\355\346\320\203\335\030.T\230\020!\254\025\233\0134\234\346//\002\235\246\271\213k\300;o\275\263"
+	.string	"\247s"
+	.string	""
+	.ascii	"\255\263\026\222\363\263u\316Z:c\265\316W\255\263U\353\\\325"
+	.ascii	"t\246j\235\247\216\234\245\230\316Q\2553\324\221\363S\353\354"
+	.ascii	"\324:7\265\316LF\316KLg\245\3269\251uv6\235\221\230\316G\275"
+	.ascii	"\246\331\350\235\233\357\314l\235]\327\271u\235\331w^\276\363"
+	.ascii	"\267\316\235C\305\033\245$U\341\373\272U&z\031\327\303,\235\330"
+	.ascii	"\255\330\r\247;M\367\232\356\303f\231\233\271\333p\273\3517\275"
+	.ascii	"\310Fp\316\236Q\2457\255\021\f\337\013\3053\367\345k\t\005\003"
+	.ascii	"\377`\t]S\200\310\251\336\3223C\303@\001\275\331\224~\351\255"
+	.ascii	"\004\035\253.m\245\377\307\312*\223\215L\223\202|(\333Y\035\264"
+	.ascii	"\364\341\271\036\304\377\237\265\351\323u~\322w\340\013\031\274"
+	.ascii	"\331>\374\372:I\354\244g:A{\347\367\333\264R\351\352)\235\255"
+	.ascii	"\221\236\231\203\0077\322\334 \220\376\201[\230\244)\304\021"
+	.ascii	"G|S\275\257nv\027{\364\314%Lx\263q\333q\003a\271O\260\030\236"
+	.ascii	"\371\350\037\270e\0214\262\366Q&\334c\033\347\333q\230[\236 "
+	.ascii	"\037\217v\222*\033\244\325\210\353\001|\033\277\357\\\205Nlf"
+	.ascii	"d\340`\241Dg\336\237\343\206lg\025\2201\352\212\230\350\330\334"
+	.ascii	"\035q\t\263\327l\307\356\273/k\230\215\247\013|[/6\21048\322"
+	.ascii	"\302\346\205\347\225I\340\275\\\215!\235\370\246r\224}\306:\032"
+	.ascii	"{\332\240)\265\222\375\235\034L\304\255\b\362\n\245!\356Cx\246"
+	.ascii	"\030\022\342.\304\220n#\036\225InA\f\351f\336\274Y\336Ir\313"
+	.ascii	"\271\302\370\327\367R\001\304\355\310\220\256K\342\225\022\371"
+	.ascii	"\327\367\207\231!\237\036\247r\357\033\355)C:\333\373z}?\026"
+	.ascii	"\372{\243\370\"#\035\027\336\035\233\t\232\371\315\3575.M\246"
+	.ascii	"\231\337j\361cH\016\255\271\330\314>?:n\205\347\265\355z\002"
+	.ascii	"\337\346\247\317X\002\337\225\244\221\351\344\035\247\335p\233"
+	.ascii	"fs\"\333q\272\214\n\227\315}f\026.\274\331*\374S\372Q\356z\367"
+	.ascii	"[\310\001jP\027g\216\373v\334|~{l\367\031\333w_\366\226\334g"
+	.ascii	"\001Ct\370\r\036:\036H\333\220\341<j\230\231\215\225\001iq\314"
+	.ascii	"p\26322\031bK\261\037>\243F\017\037\317\033eb\256\331\016\033"
+	.ascii	"o\243\207\331Y\217\225g\034\260a\306c\254\254\007\030\017\262"
+	.ascii	"\035;\310f\200\361\030\023\333\0016\243\314\007\330\201*&\353"
+	.ascii	"Q\243\f\314\214\214\254\f\314\210\3722\366\223\353y=\002\360"
+	.ascii	"c<\366\31668F\264Oc\037\207\335\221\201\204\275*F\032\212\214"
+	.ascii	"\272\"F-\304v\361t\021\343_\315k\226\321s}[\330\227\t\362\361"
+	.ascii	"\002\343)\354\275\314\226\200\337\022\260%\251\350'\327\353\023"
+	.ascii	"k\3007b\233H\353\223\026\2568\336\250\373\331T%\353\262\256\270"
+	.ascii	"\036J\r\213\264\260\212\3067\236\304=\252\021\237e7EZ8\305\342"
+	.ascii	"\235vr\322B)\031\277<\"\255:\245\370$:@\322B%\020?`\311\025\305"
+	.ascii	"Ia\243b\265\237f\013\335\002\252s\206W\\\317\276\004\332\307"
+	.ascii	"\211]7\325\323\363\273)\226,\001\336\317\354E'\033\021\265\223"
+	.ascii	"\260\216\025\215_\226\331r\"\214\303\250\026\331f\211TC\221U"
+	.ascii	"\"\236\353G\374\253y\376Wk\211\320\202ja\237/\201I\236\340\242"
+	.ascii	"v\022\"R\261x\n\202\216f\262\260>\353]\215\364\352\261\036+\315"
+	.ascii	"\261\252\344\352W8V\354L6\032Y\033\324NB\300)\261\347z\031\377"
+	.ascii	"j\252\336J\314\252\352\203\340\351\221\232z\177\322TH\250\244"
+	.ascii	"~J"
+	.string	"\352W\340\325\211z\204z\245\356b\243\242>\303\323C}K\027\241M\266\327?\375\n\274\252\3640\315+\241\n,\031\023\250\235\204O\236P<\327\247hz'\024NM\337ow\205R\247\001.\210\251\013\364\213\032\267a\n\201E\250q8\345\2203C##\"\222$I\032\003\201\005\304 \346$3\017\021 5TL\315\f\245\222\341\005<\204/\226\222PM\307\r\026\257\227\226I\351\250\210\243H\255\327(\261\255\\^SOD\370\004\236|\013\277\006\3050\366\251\353s\004,e\225)\303\240t_\312\303\372M\237\331(\017\031\233\247c\3603g\227\373\240\b\272n\202\310V\353P\317c\352\226C\261\252\027$\r\252\211\354\201\333>Q\340\262\272j-[\343Y3\t\256\212\364U\0239z\377\001\3212\300\3066\001V,\266EI\376u\350\366\321\372\035*\216%\201\277g\"\233]g\004\242|\374E\203b\240\310"
+	.ascii	"\007\332U\244\034\031\301\037I\367\303\036\260\222\244\326D\026"
+	.ascii	"\036\204%\245at\301K\333\355%\035m@\3225[\013\020C\r"
+	.string	"\200\251\364\340\201*\335\341E=7\326=B\273\254D\234/\344iTo`\n\213(\270\347vF\307\251\250XN&#jL\177\232\203\317Y7\356\341o\302\341\324`(K\\\224\371\205\2021\250\317\266\215\272d\372\001\273@\237]\256\262V\n\235\366\231\241\230(J\254\376\346\374\272;h\2427\016\271/\371\272G\3430\001\024\2313\026\b\004J\314<\033T~\247\016S7\316_m\t\304\261\026\242*"
+	.string	"G\235\351C\004\224\306\022\241\027\244Qy\277\272\301\241\277\352\006b\020\177\226\373\033\362\353ea\347\311;\355\007\337G\354\327}\354\177K\257\006z\025\242+W\354\264\234?\257q\016\233\272\360\357\223\301\261\371\343s\356\325\210\025\217\025C\020\303\241?\226\276\316\345\241\334\300\242\004\024\023\361M\340\233F\b5\216P\261\3606\214Hk\001\317\310F2\360\252\n\177`\320cQ@\027c\037\255\023\213\350\020\323\230\274\270\354^\253\376w\024P\245\200y\344\f+\305\226\261\332[\235\215\275\027\031\245<\332\252D?\244\006"
+	.string	"4>\213\203\302+i\213\257^\024\350\375&\345\341\034\3715B\025\254\322\300\t\372Z\342i@5\237\031\264\030\351\210\232\373\371\301\200&\305$\357"
+	.ascii	"\350\336\3370u\330\340\2406\030\352\311\316\017\035=R\371\330"
+	.ascii	"\204\222\360O\262%\215<5\036\217q\f\316\230y19\217\224l*Hx++"
+	.ascii	"\021\330\346\331\373\004\232\tfx\177"
+	.text
+	.section	.gnu.lto_init_printf.26.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"\375\b"
+	.string	"F\221=7Po\322\001\240X\300q_\231\026\006\204\364\323b\250\324 \300\375j\241\373\266,\267&p\357-\201DB&u\315g\306\325\214\006\330r\210m\345\274\210\264A\366\336;\245+"
+	.string	"."
+	.string	"-"
+	.string	"\230\017T\237\376l\226\327\215}\311d\242\324\262\2734j\374;\374\374\207<"
+	.string	"\024\362\034\002,\354\256!($\272\343m\033\330V\260\357\365\207\225u\241\202p\332\245H\275\254i\246t\330\276e\033\326\210\023zh\377\343 \337IF]`w\344\201\262[\023|\200\371t=A\365\031$/1\352\241\353\252Ox\252\200\321\027\371\b\307\3470D\007\036\324\251>\247h\305\305\342\003Sv\365\300\230a_\356\356:\216\354\223~\371\032\217\263\311\315\343l\322WF\343e\033n\243\231\206a\332E\263M\003F/\256\243\231\002k\233\003G=M\343\250U\367r\343\310\f\030\246O\224\260\214~\017"
+	.ascii	"2\241\th\340\270X `\242\322,\332\313\033\326\262\013\227+\214"
+	.ascii	"\007T5p\005\314UPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_tfp_printf.27.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375`\337\001M\021"
+	.string	"v\340rG\360\320&\035PY\2279\373\235X\271\301\321\3114\336N-L\026\216)\257\335\024e \345/vM\346k\r[\336\2734Y }\020\033\361,\270C\004m`\376@\334j\274\035-=\352\3756~\253\225 \262\267\224)\005\\"
+	.string	"]"
+	.string	"^"
+	.string	"<s\206!N\260]:\334~\3427,\333'\2064\340gd\260\344\b\3159\271\322?\264\313\370\001\332\345\206\360*\353Q\256\262|\0236\261\017l=z\220x\271\214\034\257\026\033\022\350\212&\"YO\007\370\322}\354\261D\315\354\003_\256\034\017\346\234\326\017\364pk\267\335\3316\331j\n3\366M4D2\257\214}\330=z\370o\232:J\365F\265\256\372\035$.B6B~\346l\231\025\255"
+	.string	"\311\236\021\207\375:,\037\3471\223V<\207u\035\2258c\302\331bP\023\303e\301vy\002\207\331\247\344\n'\250\240&\350\006\344\322\"\333\245\332Oq\025\254\207\033\036`N\231\233r\367"
+	.string	"L\321\343\234s\256?t\002\205\240!\231k[\026\240\r\202\266\375\352\332$\025\364\337hK,w\361\027\256Q\322u\332\245."
+	.ascii	"\237\305[\230\370\"l\341\244\377.\375\223v\371\005\201\271\361"
+	.ascii	"\001E\314\212\316<R\220\177\3471\024\202\016\237\355]\320\177"
+	.ascii	"\366\230\2613${m\313\016[\272\001%\0314e\262Z\235T\0328V\250"
+	.ascii	"\223u'r\262J\235T(\\\312C\241\274\216K\235JP\\\247J\341D\f\330"
+	.ascii	"C1Qq+\317Sq\244p~\264$\036\240\225\345`\2258'\b\007\327\371e"
+	.ascii	"0\235\305\235\361\277\261\237\027(\235\242\305U\341\320p)\221"
+	.ascii	"\013\350\256\r!\202\376\213[r\371\034\006\006\t##\332\003' \240"
+	.ascii	"\002\021\301\343\001\321@\345e\353\207\240`\321\t\206\260\224"
+	.ascii	"\030v\227\2658\371,6\367\326(\266\203q\022'\302S\303\325\310"
+	.ascii	":Ga\300\30246\357\262\213\254\373U6M,\fC\344\200B\314\2032Xb"
+	.ascii	"X\221\352C\004\017\022\356]\242\003_^\217aJ\363qM3]\375\t"
+	.text
+	.section	.gnu.lto_putcp.28.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\315\t"
+	.string	"\026\223C90%i8\200\213o2\377a*B+\204F\345N;\017W\276\001cBlj:\2615\237\240\230\275\227\033\214\354\230\031A\340Fh\246\325E\233\200\306\320xm\262\367\2262\2451"
+	.string	"3"
+	.string	"2"
+	.string	"\233\307\027p\337\272\023p\337,\3324\037?\226\343\222\271H\001\260\273\236z\\|\212\376O\036\260b\241\236\234\206\335u\256X\032\267\336\366\201\355\217}O~\327iy\001\301\354f\314\002llc\021\261\375\216mM{\201A\374x\262\356v\254\300v\367\343\204\247\375\222\233\210\177y\346\003\273-\022\330\356\3701B\367\034\251*\373\312F\341\327\324\274\261\030Q\035\205\302\324\201\370\023\334\267\253@H\r\306F*g\366\210Ju\331\327vw\255-\373\343\317\375\365kZ:\265\f\337I\367\007\212(\215B!\311\033\201\"\021\370y\243\320\203\310\373B\t\017d`\220\004\021z%\020\f\275\316\270\327V[vp\211\245TeN}\225\212S\312L\3347OL\017"
+	.ascii	"2\2413\0348.,\257\322\3404LT\303C\311h*\374O\350\312\027\230"
+	.ascii	"\271\006\274\n3\024Thp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_tfp_sprintf.29.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375`t\001]\017"
+	.string	"\246\335hF\020\217(\035\200\371;<\310\204\370@\240\213#\360\037\\\375c\037\027\242\261\323S\355\250\337\205}!\220,\2425\234\033kn\325\177\0020x\224\254"
+	.string	"\210"
+	.string	" -Q@9\211\252,\344?\024E\r\305\304h7\331;\245O"
+	.string	"W"
+	.string	"V"
+	.string	"\037Vpi\177\304I\210\257%\327\330-\235\\\273\256\017'\330N]7\333\276\210\243D[F\253+\244\233b(.\261\335\355:\276\2419\325>@s:C\\\274\024\375\263\256\265\264\274\214$\321e\306\203\335\265\034I\034\356y\333\bl\207\330r\013\237"
+	.ascii	"8J*)&\331"
+	.string	"\234\251\253a\026c\264\202\2468]\365\257|\230\307\330\234Co\231v\210\251\240v\227\013\331\334\351m\321w9\313\334\211\277\210_\221h\353\241\256(\344\344\332\320`;=\201\253,\323qR\227\304\340\304\002\025\333]\217S/\330d\352\002\n\327n\r\224\243E\312\353\267\371\230\313\0270L\314\300|\030\311\231\003\310n\316\267B\0226X\354\216>\276\365\022\234\003+\023>\371\221\316\263\274\\2\030\312\024y\223\036\177\353,\n\0062\214\366\247\202\374h\001\257\225\f\206a\212\354j\"\247\311\276\266\273\353Y\362v\325M\237z\033\013\022\024\001\2018\236P\006\350\033\231\237\333\003\031\001\201\034O\247\003\303\357\013\275\016\344l\276\316\363|:\220\002\016;\"\236\016\024\206\236\216\253\243\333tv\\\254\f6\232&&\321vA8\370\352\207\245\344\314\0322\302\346\254Cx\305d\260\223{\032_\005\350\371,~\211\346\001\034"
+	.string	"2\003\3020\303&\310 \255a,)\314\3366\327\375J\b<\007\303h\272U\3132\256\251cZ\020&;\321\b\026"
+	.ascii	"\003@\210\251\202\302\3407\206\355F5\023\356\005\205\301q\201"
+	.ascii	"2\007\355>))\246k\222\001"
+	.text
+	.section	.gnu.lto__putc.30.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"U\t"
+	.string	"6SB90\345(\035\2363\230Y\320\3650\016\005\352&jN\344-\317D\205\312\312\360\001\325\032\211\200\355DF\002\231F,\f\030\262@\343x}DT|\217\306\366m\237\020\"eJ\0010"
+	.string	"4"
+	.string	"/"
+	.string	"\230\343\t\262c\232\017d\307\354\331/\217\035\233Q]\234Tbv\027\252\352\336\323\363\177\362\315\207*=3\r\273\353\374P\031\267\336\366\201m\217\375N~&"
+	.string	"\244\205\001f\027\243\005`Y\030\313\207\355wlk\332\n\013\336#\205uwce\265\273\036'<\355\223\274\304\273\211].\260\233\032Y\355F\217\0214\017%\373(O\231\360=,1\312\177\243\354\230\352F\343\232\372K\257\034\221\326)\200)[v,\245r\330\277vw\255)\373\361\277\260\264j:\257\f\332E\267\366\211 \205@\235\b\206\270m\3434\030\002=lP\353F\360S`N\004\321A\022\307u\260\023\367\327j\312\016!,\223V\230\223\251\252\366\306\345?\033Xh\013"
+	.ascii	"2\241\037h`\341Q\026&\242Kx`\016P\256\261\257\302`\005\025\032"
+	.ascii	"\334\345E;\311"
+	.text
+	.section	.gnu.lto_printfSupportInit.31.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"5\b"
+	.string	"\242O88@\215\323\001\374\344\021\007\361\370\013\025xt.\326\254\342\260\312\346x\206\231.\312\205\tm\220\341k6\326\376^h\003|\224\206\002N]\216\2430\272<5X\333m\357\224\002\306.\t\033\r\263e\250V\263\254bT\303\034d\024\3338z\tp\315 ltS\353F\257\320;\351\005%(\223\224'=\246\3677~\262H\325h(\237\026\320\350 \2470C)\021\270\353\375\363\303k,\370\027f\340\304\177\237>\207\362y\323\243\005(CT\nyqe\207\236('\354[+%l\213C\251H\006>v\037V'\0132=0l\337/\335\3249h\203\216\321\356^\237v\307\276>\177\271\263G\036V\3549\"\034N\252\335\245\222\342\335c\347\237t\200\357\323\360X!\330]\307\357\003q\313\333\026\260m\261\035\022\r"
+	.string	"2\003\302\260\300\302\232\230` `\251\2621\2532t\r\027\017\341"
+	.ascii	"\025\375r/\270t\213v>\001"
+	.text
+	.section	.gnu.lto_setPrintfSerialPort.32.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\305\007"
+	.string	"\202\31777Po\322\001 [\256\242nN\314p\025\2617\002\2442\t\321\226\224\276\034\212[C\255\373#W\330\315\334dI7\225JQOSK\254m\345x\264n\031\331d\357\224\002\032\235\017\021\235\213z@\002\2668\020Zv\321\217\314&\206MKfW\007\223\026\005I\316\201\347\307C\2456'\225\233\272\247\026vv\3008\221\340\204\037\364I^\"\362;,\021z\347\036\375P\365\030]^>2Ho\306\256\243\0075\354S\273\273\206\235}\323\377\250\201\213\026\206\224\335\212\031\231=\305\025\217\215\355?\373!\027\331n\022\235`\267cQ\331\255\nN\320<\272\336\240z\324\274\240z\364f\303\274r\354OP(LbvW\302\215o\177\233\377\221\007p\245\321\037@\303\356\372q%\213\033\3366\202\355\005\333 \001\b"
+	.ascii	"2\241\177/pq\241\024\f\271\004\333\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375`\336\001\225\n"
+	.string	"R\317:7@\217s\020>V\235\374\f\360\207\370\032r\220t\266\225,\001\340o\310\371\355g\236\016\022rG\321\360\r\201{\360\177\333\377\335n\322l\267\227YCu\006F\222\222L)\272\244\226\261Cg,n\031o\231\301xI\r\343\035\033cq\303X\002\342\324=\261\323c\245\222\322\035\221z"
+	.string	"\tK\260\374F\217<h\356J\204f.\265\231\214\021\2256k!\005\315\232i\263\213\025\022\203f\201rKd\353\004\323\274&\202\311\003\247"
+	.ascii	"\215\345\016\f\n\027m\222\223F\236 \272\202\310A!\027A>\372x"
+	.ascii	"(t\321\376\277j\370\002\372\302z\3743;\036N\324\347\036T\203"
+	.ascii	"\252\205\305\363or\272k\303]\235{\343s0\260*L8\347LV]\323k4\327"
+	.ascii	"\346\340\007\253\377\3771\336\001\370q\374\rUW\025\261\330\022"
+	.ascii	"Jk\245\371f\252\352,\t. \300\002\271\252:\f\322\0071\035\232"
+	.ascii	"\246\321\3654W#\374\tB\022\266\371\376%\301\b>\301_\004\207\023"
+	.ascii	"\356O\273[\255K\340\220\306+D_\217\301\021\034\202\0038\004\007"
+	.ascii	"\300\341\003\310IKO+\030\315\336\232\316\334\224`\3673\315\227"
+	.ascii	"\200pb\214\2551\353\f\\\273\001\357\216\177bQ\203\004\267\211"
+	.ascii	"\317\201\037\003"
+	.text
+	.section	.gnu.lto_.refs.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	"\003\003"
+	.string	"\002\005\001\006\001"
+	.string	"\001\007\002"
+	.string	"\003\b"
+	.string	"\006\002"
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"\003\006"
+	.string	"\001\t\002\001\002"
+	.string	"\003\n\001\006\001"
+	.string	"\002\002\001"
+	.string	"\001\007\002"
+	.string	"\001\013\001\003\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.ba8fb212c652f0cf,"e",@progbits
+	.string	"(\265/\375`\013\031er"
+	.string	"\n\274\260)R0\022\322I\007\275\036!\332\327\"C3[\310y\375\016\325L\242\343\330\230\021\201\267\327\353>+\242\333U,"
+	.string	"\246\240\376\346\343\317\2354\305$dt\226Hb\034\b\031a\025UDE"
+	.string	"@\004\302\340\361fw\254\230\321\235a\314y\236\216\2705\262\245L\0011\002\204\002\226\0024]B\274\316\210\310\001\344\001\320\214\0175\270\316\265\0162~mhw_\326t\314\356-l\f\367\255\267Gx\226\305KJ\247o&\365M#\f\357\351\214Y\022\303\345/\314\030\366\001\247\354F\323\017/\234\3674\355\231c\225PT\336\256\250\3479\365\354\246\236\317\324\035 \352\317v\347\022\204\206\245\341u\312YX\013G\021\340-u:8\200C\262`\201\251g\004\204\034\310\b\b\317[\252\b\216R\317I\352qPY\nO\341\250\017\323\235\241\360\334k\226\353]\253\341\262g\325\326\351\221\352\331G\250\303>\302\307\240\212`\001\204)\363\b)\250c\001\204\334$.\235\321\244\211W\247\037Ae\022'\304B\344\262u\3723\3349\356y8\367"
+	.string	"\035\260%W\266:e$\374\026\270\204N\256SN\302n\034\035\301J\316=\360\222\007\225\353]\357]u\372\353\f\022\265NwX"
+	.string	"as\240\236G\bm` \217\020\236\357x7PzhU\351\364*\324K\240~\205\3435\265\034*\266\254\273N\317Q&\302g\234f\2316\236\267\355\3365\004\007A\250\300t\312+\243\235\323\270\310M\234\270M\246\335\350\275\227\323,x\336\253\3444\235\277{\225:\314\0130/\220\n\321\nK\"L\377\200\372\225\005\020\252\314#<\017\271N\326=\361V\237\376\375\226b\305k\376\226\001\310\001\277\371{\006\022\007\340\357!\027\376\375T\306Ud?\2030\226%\006\301\r\370[\fz\365o\254\237\3038\207\037?\037\201\375|\302\307\317\307\257\237{\374l\003\217\237\275~N\352\372\031"
+	.string	"\276\361\237\205\025~\346\372\337s\b\376\216\372\371\200\323\374\035\343g\255\237\255~\306\361\263\322\317\313\237u\370\371\206\237\213~\026\3729\206\237a\370\331\205\237U\370\231\305\317%\374\274\342\347\020~V\361s\212\237Q\374\274\3633\211\237\021\3709\202\237G\374\374\300\177\241\377,\376\243\375\354\300\317\n\374\234\300\317\004\374\314\363s"
+	.ascii	"\377M\3709\304\177\265\377i\377G\374\237\362\337&000\360\357"
+	.ascii	"\277\337\002\360\363\340\005U~W\252\351s\373T\337\277\360*\233"
+	.ascii	"\367\336\033\301\3656\217p\316Af\237?\207-3p\355\211\350\275"
+	.ascii	"e\177bT\2627%\225\210{\263{\223!\356z\233\314\265\254$\323\b"
+	.ascii	"\026g\210\365b\rp\327\266.s\315r\246\317\333w\275|\227Y\316\031"
+	.ascii	"\230\353\263\311\\\237\311\235\273|&\357]\235;\3146e\222\231"
+	.ascii	"kYN\346\332\323\031\342.o\362\256)\261\324\345\323\311\244{:"
+	.ascii	"w\230kJ's\231\345\f\021\366\007&\225\024\210\305\n\2131\227\227"
+	.ascii	"i\251J\331\334\251c\256\317\333\345^nC\272M\006\356\255z6\273"
+	.ascii	"(\243\030\356\250\216\351H\211\362\311\004,\035i=\357\262\216"
+	.ascii	"Y\366\274\267\354\b\306]\262 \271\326]\036\\\227\334\252\272"
+	.ascii	"6\220\356-`\351\336$\337\272{o\362\336K\323\254Z\357\235\332"
+	.ascii	"aB\227\226\356\225\352Y\272U\3118\244{\273\355\013\234\223\271"
+	.ascii	"\246\365\374\211c[\203^\032k\222\241\267KVS]K\242]\033{*\324"
+	.ascii	"\351\024\346\253\307\215_\017v\267y\334\344\320!\005o\317\353"
+	.ascii	"U,\240\030\020\254\336a\325\347D\365\005\217k\213\317\257\217"
+	.ascii	"H\247\034\355\255\277\263Z\353Up\2366K\234\240\276:\345\036\346"
+	.ascii	"\021\376\374\274\261\270\210\0314(\317\343u\022m\207(:\372*x"
+	.ascii	"qH\241\352\253\266J\235k`\340\272\352m\225\023\230\226\347C\247"
+	.ascii	"Mu<\0330=\246\206tz>N\353<\272'ZS9\240f\240\345\350\364\235\343"
+	.ascii	"o)\226\3434\030\006\310\251\032\333\342\352\024\207y\204\r\365"
+	.ascii	"\363\216\342\0216\245\326\333\026\3141\005\353\253\323\033\346"
+	.ascii	"\301\361\004\265\242{r\322\031\362\264\303\307\252S\023g\006"
+	.ascii	"\b\216\033NU\214\223)e;\273\311]\370\220\304:\355&eU \215:\225"
+	.ascii	"\255\215\2354\251\361\320\233\263b\005}R\345\n\032E\207\236\221"
+	.ascii	"N\362\031\006\264+\224\346\210\226\217.S,\367\377\340\261^\222"
+	.ascii	",6\356\230\364~\370\230\214\323Q\r\266#\307C\312\322\343\013"
+	.ascii	"S\001\261\334\271K\255\034\320\n~~RW\305W:\311X\330.\005R\263"
+	.ascii	"F)\013\325\337I=\243\231Z\251m\364R\037\265\262k\364\262o\323"
+	.ascii	"h&\0076\022G;\311e\316f\370\357=\353\275\313{\357y\356g/`\230"
+	.ascii	"\212Ek\252G\324\244\364\356]\317g\377O'\371\007\026c\321\232"
+	.ascii	"w\311\225d`\213\221&V\374\356]#\350\211 \202V\211\310M\264\257"
+	.ascii	"\311\313&\335*q\232\221@9\265Nm\rNk\036\242\\H\235Zf\343X\333"
+	.ascii	"\013k\322\251\245q\271\340\017\3218&wB\263u\206\311\026\265I"
+	.ascii	"\233\264K!\302.M:\246=\272]\246R\270\364\226:\265\312\323\335"
+	.ascii	"\254\221\231\331\341\357\257\003\243\301-&L)\r\370\016\224\353"
+	.ascii	"\313j\352\264\317\220\361\361u\231\333\345\275\342\001j\023\275"
+	.ascii	"\002e\t\231w\231\274$p}Y\235\266\337\247\b\241\210iI\352\264"
+	.ascii	"\307\364\201\345\345\365^\317\323\332A\277\214\261\320\313\322"
+	.ascii	"\021\346\275\227\2073\326\304)\254\323\376\301G\311\2178\277"
+	.ascii	"N[\317\207\346\n\013\333Q\247\355\303\345h\222rnu\301\245\352"
+	.ascii	"\345^\372\256\347i\267(AA\231\335+\345\223\216\271\"\006\007"
+	.ascii	"\346}\247n\361\373\253\321i\177\351-\375\345$\212\214\001\265"
+	.ascii	"\372\356\336\374\260`i;\276\327\256\215\252\312\354\206\255\212"
+	.ascii	"\222\262\346\362\266\263\331A\225\214n\251\251\353\353k\333\242"
+	.ascii	"\305\3161M\371\352\246t\312\315I"
+	.string	"\224N\263p\231\343\\qM\331i\261b\245\353\370\310\024U\225_\312\345k\t\346|\357\272\274 \226\262\037I\230H\221\322T\3702\357\225\272v\213\037U\225\331UR\023\335\233\212\\Z\303\214\311\221N{\n\253\321\230)%\331c{\362\244\347\324\273rE\311\201\376\240\025\005\345=\367\013\233\246|!\362\224\023\r\263\2532\304\211\223\343q\210{\267\312@\303\2300\351\256\013\310\244Z=\364\320pl\304\215\252\312O\207/\312\363\252\033\016\356\217n\257\323^r<\0333*\347\362*\312\334\223\220\250h\264\335X\n\003-/\275+%\345\003\342\206\227\271*#o\267w\222#\315+Rm\215\344\257a$\261!X\235>m\252\315\326G\220\274\204\231\245I#j\232\344\300\013\264\201\232\361\361\243\323^;\036\316\362\254\210U\247\255\326W6M\252$]\351\264\323\372iy\305\345\254\321\202F\342\246\364\241\2558Wf"
+	.string	"2u\372\265\211t\221\033\275\246@\347\031\334\226\036\031\031\365\026\214z['$\332B\332\331\263\336\033-\3345W\tn\337\314\314\332J\275]6\220@\241\035D\275)"
+	.string	"\337@\336A\344f0E\357:\355\262\343\325\024\031\003\364\352\264\311\272\353\246\310\0300\245N{\354rg\234q\316N[\214\323\324uJ\371D\r\307\257\215MI\247\267i\352\333G\203\275\177\374\377\321Vj\362\336\344z\233h\270\300P\005\310\343\020Y\004"
+	.ascii	"\r\306#\f\244q\210\346\305\220(\224\272\030\"\016\025\221BE\243"
+	.ascii	"\026@@"
+	.string	";BFc\006@A\033\220D18@\026c\024\r\r\217,\212\212\006\024M\f\323\241\211\242\035\232(\n\031\005\017\203\304\220\2618d\f\"\022\331\200l`h\242h\224\022\221\305c\n7+\220\304\"\036dq\350\003\"#\023B\024\021!\215\214.\220E7@\310\342P\361\246\250\210\030\0244\024\272\360\303B\005/\004E\024[\f\201d\024\331P\264\023\303\020\t\004\004\224\203\034\3068\032_"
+	.ascii	"\021\275@\332\230\260\003\024\244\001\206\360\006\020=\250x$"
+	.ascii	"\016\021cPo\001\212\tP\244\250\201\346)TP\240\202\002\341S\250"
+	.ascii	"\370\371Q\201\342G=\212\037\213,*\n\001\re\320\274\bB\032\021"
+	.ascii	"\005\221\207A\242D\321\221(\243xtq\300\215D\304c\t\244\321x,"
+	.ascii	"qs$\026_\024\221CD\027E\233\" \034\024\220G\343\212\035\242P"
+	.ascii	"\213!\013\031B\"\020\321\205Q\004\033\242\013c\214\224\bD\002"
+	.ascii	"\362h$\312)\0322\026\221DF\032\"rX\202\013\243a\013\225xC\321"
+	.ascii	"\004\025\t\224\202\006\251\036q\\\f\211\036 \201LT T\034\262"
+	.ascii	"8\022_\2740\312\240\006$\316\021\271\202(\243H\f\"\226 4,\036"
+	.ascii	"\211E=H \024?\310\241\242\221j3D\0167\220!h\330BHh\250A\rG\020"
+	.ascii	"\307!\214\240\364??\032\2108a\204\016\324 \022/\220C\305#Q\211"
+	.ascii	"!c\214\030\306\240\022C\305a\214\022A\307\242\022$\n\b\322w "
+	.ascii	"\370\256v\330\001\004\007\031\271'2e\326J\315rE\246\205\254\335"
+	.ascii	"\242\304|e\031\263ZXNf\220X\261\2560r\\7\240w\322E|@\362\025"
+	.ascii	"\026\250F\215}a\362\303.\333\240\260\201\005\001\301\025f\354"
+	.ascii	"\315G\357\005\367\304\232\324\354\227O\016\031.Gf=\272\214\316"
+	.ascii	"\330\017US<>e"
+	.string	"Ln\211e\275\254R\2257\264\035\235\332\035m\271l\327\355\216\257;\024\370\323\231r\233\033\023\246:n\261tX\255\340\231\205b\253\"%\353V\013\304\2270\311\243N\177\023v\266e\245S\373\024\336\250[\252(k\025$r\357\021\005\353Q\227\313\224\362\241\351\023\323\265\305V\335Z\3350\203\260\355`s\334N1\271\342\312\362S\177+\225\204\013\025tO}\020\313\322\222\305\301iVPP~]\226\030\361\262\315[\034\326\t\252\307\222N\255S\333\033\366\351\326\311:o\342\304q\226\253uJy\001\020\314\013\004\345\300\224j\302\364A:\365|\266\tgM\336<\333d\231j\302\334\201Y\2028\242\202v\255\026\311\"\005\202\027\250\362\b9\2072\2351\246JDf$I!\035R\013\020\006\"y$\227\347\001\022 UEM2\307fd$I\n[\273\001\303\022\026@\241\0342\006\347u\246\bT9\033\363wI"
+	.ascii	"k\363\213\230\341\364\302k\245}\033iO\016u-\217\2051$[\301\255"
+	.ascii	"\275'\024\247\3615\346=b\372u:\017&\247Gv\320\021\033\260h\261"
+	.ascii	"%\232\244\210z\377ph\033:\366\213\006\371Y\212\350\341 _a\272"
+	.ascii	"mD\004\326\204\241\025%&\223\201\302\"\350]\312ZJ\363\006\272"
+	.ascii	"\256ok\036a\361|[\r\204>\266J\370\216 \r+d@\343\357}x\223\241"
+	.ascii	"\272\377\030\255\246\334:g\323\214\322^M\323{\243\3044\300\373"
+	.ascii	"3F/\336\027\256~\343\320\353Q\305\254K\260\b\370\357\361\034"
+	.ascii	"Y\240eB\236\347\037M4\023\343\271\347TW\367A\020:R\361\n1P\235"
+	.ascii	"9\316\335*CBb\037\037 \260:0 {kUg?\253\260>\355OZB\261`i \261"
+	.ascii	"K\2507q\373\266?\201n"
+	.string	"\025@\nc\231I\370\236\301f\017\205h\237\0255>'\226g\267\321Y\361\266S\b\205\257\374p`\r^\236\30086\220\035\332_q\277\030\266k ^\002\031\\\003\272R\013\350\335\351i\244\316S\314\2643Z@\316\245?\232\271M\213\374PX\201f\212n\336\201l\270\320\203\025\254\261\375\201\234s\007F\301o`I\016b\253\227C\3505\002c\230\263p7\306r\332\2508w\001\005\024)\253\333\254\335\017\004\315Z\332\203St\306\212J\221\207*\232\341\035\003I\352\177\201\302\214V\3123\235\312\260\233\035-dV\323j!!\234\310\203\3173\235\274\275|\023\244J_h!\356l\264\267\356\260/\203\026Dm\256\342Rn\311(}\216\302F\360\254.\271-\335~\021\263\222h\343\n;$\242\352*,E>A\217\227\337\316k\266/\3467\253\204\2738?\n\251\001*\270N\221\253\227\322g\246\320\006\323\021\244"
+	.string	"&\315\311'\205\f\037\273\035\201\247-)*\314\374oC\\3\2610\255\366\247\360\205.\307B\217\215w[0\216\004\267\f\r\300:\031f\006\272|]\2218\031\355\332\031\330N\254 \333\366\313\272\033r\345\004\201n\260]\217\340\267\276\036\023\277_\355\"\3026\"\033pK\246\t|G\231\343^\335\231\325\200\354}\276\326\004\254w"
+	.ascii	"\360\204\256\222\316\022\217+P\220\364\201\363\311\240\220\016"
+	.ascii	"\246e\303\246\300\002*M\317B4\007\240\202wu\231\240%0ik@\031"
+	.ascii	"A\r,[\215\246\331uCC\327\255>\203V\n~\353\006\240\275%\235\352"
+	.ascii	"\2268\031a\255D98\321|@\004\302\027\314\004\221&!\331t\264V\367"
+	.ascii	"\003\240\240\335\374\264\r\217\002E|\f\305\352S\315,\301\237"
+	.ascii	"\020\206\305\226\021dLM\374\0019\245W\265\344\246\272\314n]R"
+	.ascii	"\360\206\317\2715\006\32771(f\256tb9\353\021\241\310\253\227"
+	.ascii	"\f@\347\355\202BX\233\220aS\023^\251\\\366\027P\206>\273G\236"
+	.ascii	"\017\225\241i\352\t\346\232 \247\347\303x\370})\037t\004\200"
+	.ascii	"\313'\307\277i\314\221\364:\303;\250G\364\017\351{!\315\t\335"
+	.ascii	"\331\017\317\273\230\241\225\007,Sd\340}F\336{\266/\340\003^"
+	.ascii	"\033;W\267c\212\031A\312\374\361\212\3613\3453m\356\364\264\340"
+	.ascii	"\367i[Q\027\375x\361;\224}\002\376#,\\\357\265\271\247\210\335"
+	.ascii	"l\274\204\337\334]1\236\244\372\271y\231f\343\2261\306\255f\313"
+	.ascii	"\334\373\321\372uM\254\314\223\324\301\310\207\374\222\207w<"
+	.ascii	"\364{1`c\241\214\332\303K\237h\316\021;\263\007\222\203'\373"
+	.ascii	"b\362m\005e+"
+	.text
+	.section	.gnu.lto_.symtab.ba8fb212c652f0cf,"e",@progbits
+	.string	"tfp_format"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"init_printf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"tfp_printf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"printfSupportInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"setPrintfSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"ui2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"uli2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"i2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"li2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"a2i"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ba8fb212c652f0cf,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
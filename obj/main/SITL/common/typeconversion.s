@@ -0,0 +1,664 @@
+	.file	"typeconversion.c"
+	.section	.gnu.lto_.profile.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375 \354\r\004"
+	.string	"\264\005\340"
+	.string	"\n"
+	.string	"\232\317\241\374\t\002\002"
+	.string	"\002"
+	.string	"\001\201\351\223\225\002\004\364\223\222\365\n\006"
+	.string	"\002"
+	.string	"\003\303\224\212\270\b\004\004\344\300\270\257\t\006\005\251\243\200\233\007"
+	.string	"\006\331\327\376\320\001\b\002\001\002\001\002\003\002\003\007\221\334\215\370\004\n\b\376\242\274\376\b\030\002\004\t\241\221\303\212\f\f\002"
+	.string	"\020"
+	.string	"\270\3129\211\240\002\3301 \030q\260\001\025\026W\f\304Y"
+	.ascii	"k\0011\200 \231U\271\003]l\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375 \274\225\002"
+	.string	"\364\002\260"
+	.string	"\n"
+	.string	"\003"
+	.string	"\003"
+	.string	""
+	.string	"\001\004"
+	.string	"\001\002\002"
+	.string	"\001\003\004\005\001\003\006\004\003\007"
+	.string	""
+	.string	"\b\002\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003\001\001\t\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\017"
+	.ascii	"T\331\200{\273\t]\005\002\004Q\003B\220\003\250\001\002\202\215"
+	.ascii	"\005\345\033\3102\350\005\030\262\001,"
+	.text
+	.section	.gnu.lto_.inline.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375`\276\003\005\023"
+	.string	"\226\036gC\020\221\324\0307oW81r\005g\027\343\270\256\254\352Uh\016\310\037J\255\271\264\355rBk^\373\0075\304\b\214\304H\366\023\361\320"
+	.string	"\300 \024("
+	.string	"\200\006\t\246\353\271\254l\024\211]I\331\244L)\005U"
+	.string	"Q"
+	.string	"W"
+	.string	"\375\214\013\025\213\216N;\267\333\305\316\027\36447H\324\006\364\\M\177P\203E\006Oo%V\003\243#\272M\340\370\006\177\365\351y\220\t\241\"\240.\211\365\332\2028"
+	.string	"Zr\b1ZZ\236\276\217\355\310\347\234\023\276\267\345\334}]\362V]\312K\250\365\024~\b\"\237\3052\270\304J\317J\221wc\206\214M\254gG\036Jl\035\3149QZy\327.\243\342\b\030\025\216_l\021\226O\325+\214\212\335\376\261\375\344\335\214\212\362\250\306\332\364\0164\"\264B\345\024\312\277\036\366\020\304\205\034\224\205\245\267B\203\231xe.W\316\364\026\257\030\031\250#\321v\006\241Z\255\226\303\247X\317?<?y\r\370\024\343S\2176-\255\024\036\355\204\270\357)\310\326\3447\260N\205"
+	.string	"\266\257\277\355\332\3448`\235\252@\243ga\351]\nL\314+9\016\344\241\220\255d\037\225\236\213\205\t\252W\212D\001m{!6\243y\365\366\235\216!6\243\365D\267\326\365k\223X.\211e\022+"
+	.string	"\364C\316RA\303\213\312\327\313\225\344\275\346\234 \323\333"
+	.string	"\342f\346\300\347\206\371s\224\n\217\317S}}\n^\215\204U\327\022\004\244\344\344\310%I\236\f\0166hB\275\354\245+S\250\341<f\020\031\242\tfd\0244-\034`\002!&U<\022\300\224U\203,\223\210h\371]v\261v\317\263\362\373\242j\035FN/$\007\357[K\324\266\275\342c\022\rPI\313\027j\264Q\251\335D]\031\205\003\314\314\2009\241\035\226\265u\254f\302*O\306S\252\245:\243\nJ\343\236(\307G;\340\327'.\177q\226\334\360\307\324\215\036"
+	.string	"\353\006\236(M\364\031\342\210;\n\217B\211(kp!/\214\255\202_j\345\252gz\tR\314hU@t/\0323\030\275\3558\307W\t\001\361\240\3151<\036\265\316)'\224\213\274u\315\037F\334i\366\332\255\274\351,\211\2043\337\245\363'"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375`E\002\035\t"
+	.string	"\342\215&'\200)I\0073\260\314\210\327\f\21700\003\317u\025\\P\031x\234X\367\267f\035\003*\300\242\330,i\273m\"\223\f<(\273H\222\222\302\fl"
+	.string	"\365\b\240>q\021n\260\021\352\263\252'\236\266\262\235\025V\006\344p\301\271y\211\373W\305\036"
+	.string	":\342!\356\313\335\260oXOx\241\212a\030f\305~\270#\004\313Q\214+\326\217\031r\356!C\275\363G\035\207=\244\307\370\226=\013\350\235\376\353^\221\327\277\"#\245\224\256\206W3iG\217\275\243\267\374\207\t\017y\024\002< `\"1\254\352\257\222\b\244wx\263\300*t\n"
+	.string	"#\001H\006\337\322"
+	.ascii	"\332\251\371\205\002\240\321\335F\2113\034hV\333\253)!\354\345"
+	.ascii	"\201\006D/:\206V:\230\275\227\306\234\n(!\200\023\007$\344\202"
+	.ascii	"!\202\203\361\027\224d\325\006Ea\365\330\002\002\357\211\326"
+	.ascii	"\226\025N6P\356\206\274\315\005\261[\032\260\332\301\303\301"
+	.ascii	"\"\336\026\327\261\317\215}\352\032\221\023\305\355\020\037\267"
+	.ascii	"0\242\005\026\257i\206v-\362\206[\004"
+	.text
+	.section	.gnu.lto_.pureconst.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\200\004\006\232\004\007\232\004\b\232\004\t\265\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375 \335\235\004"
+	.string	"\222\307\033&\220+\215\001+\007\034H\254\253w\325=D\037N\214\347S\215{q\235\r\006Q2\3164<\365$v\373\357-e\noB*"
+	.string	"\216\\tX\267\n\311\265\365\025\023\"\304I=\215\243\0019\235\205 \363\370\274\310ds10$\020\212\347a\246O\270\006\232\276\373\251r\246\307\343g\346\252\331<#^l\251U\225Af\371\225\177\016=\370+\001\r"
+	.ascii	"+\001\351\253yU\205\021S\b\215\353\334\205\245Ua\200;\240:\203"
+	.ascii	"\271\363\314L\240a\f\024\001"
+	.text
+	.section	.gnu.lto_.lto.9e7dd3b09c772327,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_uli2a.5.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375`\334\003\355\032"
+	.string	"\366q\254I\240\230Q:\020\r\276\313\344\006\347\330@8\211\001w\303F\217\035\236\021B\300\235\r\252~\001P\360\033\253\\Kw\n\236]\265\345@Z\013\257\005\257\303\253\\b\005n\013\265@\226\364\205\245 b\350\254\205hB6!i'\031\234"
+	.string	"\221"
+	.string	"\221"
+	.string	"\373R\353\013(\017F\207\005@\317]\353\360\216\232\223\026\211]\265\352\222\242j\345)X\007\243\303\345Y\206:\034\035\200:\334\332n\225\001@\254^\320\217-\265\326\327cl\271\340kf\225\344(\322\026\370Y[\3174\t\345J\230\325\3426K\221\002\f\"\026&\r\274 *\362\250\002\307P\321\024\233\f\025\201\005\240\202&\265\215\205[\240\bt\242\206\233\f\271"
+	.string	"#\374\254\244\354\363\304\345|&x#\205o\237\017\034U\t\345Rx\212\024j\255;\205rD^\030\357\356\221\335\275\260\373\033\001E\200r\377n\227WbF\220\361\263\332\353voljh\354\303\236\361\223W\306L6"
+	.ascii	"+\331.'\3311\341\\\230\226{^V\351$/i&\357"
+	.string	"\013\235;\206s\305p.\365\334\320sA\317\275\347N\3175\201\326M\200\220ZO\\q\251KB)\033~\262{\336\265\323\032\352i\247\220\214X\325ZsF\207\266o\313\335\355\341\200\265g\201\210\223U\255\274\004\016\267\302\350\220i\304\200\230\372\263db\302}\354\324/\252\326\252`%L\236{\324\254\204\023\216\3620\233Ph\254GP\207N\"\204E\374\370\t\244\201\313\323\334?nG0\247\027\357\233Qxz\217(\310\357\300\275\242\205\211n\274.\201g\236#\345g\376l'S\224z\342w\373\342\235\2422\237NUKT\341en*\340\311\207\255\2037\224\021hi\n\352b\243\337\255[\327-\215B\365\233\223\276\032\323\306\241\254\343\376\371\034%?\363\267\256\377\363\211\037\363y\337\220X\367\303\237\252\240.6\260\326Z\301u\235\365\233\377\310\312\r\207\317\274zS=\0356|\2039h\2300\332\324\231e\320"
+	.ascii	"\356\320b_\330\202\230\354\303\214GGDL\006\323\tA\242\347\025"
+	.ascii	"\223\355\354\310`\257\330\207\f;/\030\317\354\265\340\300\312"
+	.string	"B\350\360\274zd2\236W\311\253\006\313\362/\307\205C\226\330\356\263\353\031]G\201XacK\026\333\274b}\267S\250H\033\326[\027pF$\r\200\227\307\031\312\030f\004!k\276`+\346\344q\306\241\255\333g\027\026\036K\345w;E\b\246\321I\031\230F\311\031F\343\0261\215\302\034\327\272\315\237\303\312\r\311\247\346\237\252\272I\215\337P\25010\202\214d\314($3\301hS\230\306p\002\241\302\352\006\020pW\242\244\003*\237\227\"\004\025\340\267\346\026O\300\310\325\260\211\270C\245/^\361\275Z\220\255\3044\367\332[\026\340!S\017\177\367\022:`\261\216\365\037'|\376X\032J\270\003\"q\337\375\344\377c\342\"]c8\337\267\006\222\303\367 \2150\2768\333\365\t\341\023\240\240.\017\313\254\316j\370\271V\020\321\317`\235\365>\350b \b\352\225\022\026\273\211u W)\234\336\221\007\321\226"
+	.ascii	"D:\365\265\271\326x6\375\236\350/\324\220\322\245\247\267\216"
+	.ascii	"\240\177"
+	.text
+	.section	.gnu.lto_li2a.6.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375`\376\004\345\037"
+	.string	"\266y\307I\240TN:\305\263\016x\374q\033\337\020\377\350~g\356\267\243\037\003_\320\244\253\207\304+\340C\356h\215\254\331\273\223\020\204E\245\311\3469iv\2748I\243\006{\003\356\252\336!G\215\372\377\377\276Z#\313FB\210\334)\005\264"
+	.string	"\247"
+	.string	"\261"
+	.string	"Vp{\231C\376\264M\215E7\276j5\356\030\301\251}\034\317\361\373\224\311\336R\353S\213\257Z\353\216\017\334^\332\370\030\363\345\355/\346K\377\354&4G\2723$+)\265\326\336\262\260\351s\177\327\2359\334mg\226\344\322\237?\302+\211\350\341\272\023M\364Ti\260b\311\304s"
+	.string	"R,\2258\316\210R\t2\347x"
+	.ascii	"PJ$\350\355@\023\337"
+	.string	"\221*G!b\334\210\022\n2\301Z\332\361_G\324\234\301\364\362_\017\020e\226Dd:)\342K\n(\242b\311\n\321\210\264q\"\023q\252\323!1H\251J\203Z\253i\022q\351^\271\355%\266\031\330dV6\316\215ImSCSR\317\224\3242%u\314\301n\030\222\372\345\\\267\013I\335\302{\327\315BR\257\220\324;\335\275\356\023w\273\3617?\365\2277\336\373\251\233\222\324\317aa\222\031Rk\210\266)\225Hy\224q\257\037\354\347\372\273N\332\367\267\016\346\037}j\375\216u/\377\313W?\242\357\360{\334G\211\303F\255\365\354\242\306\"S\t'l\342\032#k\023\257\032\3658#\211>\345\261\375 aJV\332\261|\255,\207I\005I\253\265.\270\021\371W>_\372U\347At+\035\262f9\370\261\225V\253q\300\313\373\3440\023f\351\226\331\313\302\354\231\264\254\313\276\360\266e\177\274"
+	.string	"(\267\335>\331LRV\3526\247\025\203\374\020w\217\231+{\250\252\262\335~W\366B\251sw[\032\231!\261\221\265\326j\346\256c\236\253[4!Tp\261\304\216\210\345\026\r\242\311\342\314\335\035\236\352\021`\224\355mM\322r\351\016m\272_\nXHl@\332F\356<\310\364\303\200\202tH^\370E\346K\026$O\200\264\315\006n.n\367*\2120*H\333\\\356m\027\b\232P\rH\333f\206@N\354\026\311\314r_E\243\212\314\210\256\331\306 \335\242\375\004-\326\322\274O\001B\0320,\206g\270@}\206~\326<\004~|\033\202\200z:\374\370xz8\020\t\365~|>>>\236\336\317\006\013>=\036\240\240\036\201"
+	.ascii	"\366q\350\001\352\t\371|@\275\323"
+	.string	"\b<y\322,\313\016\251\376\300\t\021\340\006\355\n$dHy\242\333\242\225\224\345p\316\345A\030:\345jviv\370\343#\270\360\221\273Y\223\273\257\213\216\311\333\177\275EMG\325\231\021];\267h\212\263\330\207\314\234\013\247[\201\017\2312\027;oqvk\240\t\245\2027\273af\302\243\315\372a\023\202\374\027\027\222\2446\2636K\273\220\330h\266fo%\214\222\331\230\235\331\013\235^6f\237\333\342\217(\331\221\205\013h\250\201$\203\024CJ1B\201\bI\013\222tp\002\231\271\2639\020hG\263)T\032\003\377\264\303!\031\226\364\374\016\024]m\310\224\352\320q{t=B>L\2310Q\334\314F\315\306\013\211\366\223\366\270\200\221\002\232\2523\265\267\"\237\243oO\326W\201M\221\300 .\023\330\316\207\007\271\321\312J6B\207\312\2508\310\244%?\024\231<\272\251\372\250\234zxi?\004C"
+	.ascii	";\254\264\314\370\227\bB\274\200\264\276A\345\021\302\251\213"
+	.ascii	"\003\"\243\316B\247wS,T\305\365XZ\354/\310c\243\311C\003mc\017"
+	.ascii	"\265j \\\336lo\377\231l\013\337G\023\247\266\257n\002\272\304"
+	.ascii	"(\324_\271\317\006\307\032S\240J\r\344\304\3046z;\342,B\377\273"
+	.ascii	"}\023L\304\213\254$h\312\027j"
+	.text
+	.section	.gnu.lto_ui2a.7.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375`\270\003]\032"
+	.string	"\366\360\251I\260\326M:d\344V8<\337\204!\364\bf$\251\361\200\373\364e\037\211\223Z\033N\315\344\275C\257=\311\322x\276O\017\002\254\215\r\r\342\277\323\237\323\337k\037\215\235\034+\252}\374\n\027\374\237\356n\215\220M\266\334)\005\226"
+	.string	"\213"
+	.string	"\224"
+	.ascii	"\021~?f\306\207\276\264o\3437po\222\361\253\326\0254\254j\375"
+	.ascii	"!0\203\361\341\200\007\240\017\347[\350C\343\354\255\030 \031"
+	.ascii	"\225 ()\265V\332\272p\314sq\227\305`\243Hgs%\316\227EL\204v="
+	.ascii	"\227\245\310\311\2308\241\005\021\212\303\b\254 2\372\310S"
+	.string	"\0322\222b\221!\2439\200*H\322\373\240\370l\212@%\220^dH\305|\320\305uu\251K\335\356G\316\244\023\337K}\316\340U\t\355N\\\212\023j\255\226B;\242{\345\266\201\330\276`\257.\233#\013h\267\353\263\177=\362\301\213..o\317\216\201y\323\375\342\322r\247\037\300\247n\226G\375+\377\375\2637\375\262)\r{\035x\217\217\272\3057\3354\224\016\247\364\234\322{iy\351\013h\340\003&J\255%\202S\252Vx\025\343S?\320\276\016\237j\312Xc\317\320\230\203\005\t\256Zk\205\361\341/\345\230m\240\314\254@\013=\202\\\265\376\016<4\005{q\034\n\367(\236\263\324\332\253\"\3417J'c)\261\252\265\"p\020\212\252rW\341\372V6:\362\b\f\237\207>|\020!'s\303\225;\026\\\\\227=TN\006lw\347>w$w\367\243\t\330\372\246\233@!\322\033\267w\340"
+	.ascii	"\266\002\022\021\262\3537\222\304\t(\256\317\257\033\213\262"
+	.ascii	"\254\201\0215\236\204\310e\331/\t\252\342#\203~-]\271\247\372"
+	.ascii	"\024\302c\222c\242\353\363g\3333\210$\244\215YXU\025\371\313"
+	.ascii	"\320qu\376^\351i\210\b\331\345qe\373\305\300\253\3121\315Zk\235"
+	.ascii	"\236\355\2701;\303\313\312)\375\310"
+	.string	"`9\0368,\207w\330 k:\222\006G\303\206Y\243c[\327\022\330n\037pnhB\330n5\032\033\236\034\232\355VSs\253\321l\0374\324\320j78\264\004\005|\263\241\271\241\345\334n7\264\330\257~\306\304mY\235kh\371\354\217}\035\352[e\270\324\013\354x\320x\342#\203\262\365Y\311\022\022\ff\334\227V\322\026\314ee\305\325\235\352\343\223\245#\330\313z\316dKWw\031\372\332\243\021KO\261\365Y\212\016\276C%U\360\035\372^\322\326\350\254\357P\330\352^\013\2633EY9\246\237\227\rJ\250! \242\020UH)4##2\232\250\003\200\002!:\253\016\020pW\242d8\004\200\272\017$\301\212`\363\232\315\312\033K\260\362Uq\3741R}\177\326@F[\032\230\363\332\177>\264{\222\256\247\257\0346\267\305\330s\355\270\254\217\243\n\363\376\254\305\r\205\016u\321\215\311\367\2022"
+	.ascii	"\224\215:1F\235\241\345\253\024\302(!\247\266\332R\320G\225\216"
+	.ascii	"\f1B\327\271lKO\351\366\227z\030\216m\201(y^\021\214p\027 B<"
+	.ascii	"7\225A\255\345\310\266;O\276\005\036\n\226\200\\\230\004\375"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_i2a.8.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375`\346\004\r "
+	.string	"F\272\312J\220\026R:\005\301+\0304^\301\002\377\245\207\360\234:\204\301\017.FS\372\213\267_,E\351`\257e\313\271m\034\031\004\356\240\361\357\003E\""
+	.string	"\230O\342\322\2534G\033:cD\034G"
+	.string	"Jz\320k+\277\304\023B\344N)\266"
+	.string	"\252"
+	.string	"\264"
+	.ascii	"oIS'\034\\i:\3041\203\363\245\207\347\253}\035\337\261;\225\277"
+	.ascii	"LK\323\026M\\i\232\342x\301\3712\300c\314\227\344_\314\227\336"
+	.ascii	"\331M>\214\221\236\310\342\310*J\232\246\271\205a\323\350\356"
+	.ascii	"nCk\264\363f\226\344\326\235O\374\200 \024$\240\210\333T,UTE"
+	.ascii	"\347\205R\212\327\004\264P\n\236f$)H\0060^@T\022S=\317K\361\033"
+	.ascii	"\251bd\342\351F\222V\2209eG\343\271\214\252\t\205\342\345\271"
+	.ascii	"N\332X*\"\001Q\234<\361%\013\024q\261d\005XD\3324\211\2358\361"
+	.ascii	"\365\007\354\325\252\242\223\246\251+\022P\351^\271m&\266!\330"
+	.ascii	"\344\214f\365\214\314\267\356\230\262\032\246\254~)\253]\336"
+	.ascii	"u\267\220\325,\270k\335+d\365\315\366\342\215\322\316W\375\346"
+	.ascii	"\251\376\362U\367\236\352\256d\365\001\230bEl\260\322\324\304"
+	.ascii	"\231\224t\2544\316x\361\357\372\265\376\255\223\366\375\037\357"
+	.ascii	"\362\215F}\354\216\365\242\317e\364j\350=| \017r\001\f\335\322"
+	.ascii	"\351\215\2400\364*\242\035AA\212\257%\201\310\202\254T7\023\""
+	.ascii	"\034\247\034\217\345\373\310\362\327)\"\351\304rQ\342\230\246"
+	.ascii	"\351\203s\310\2772\372\322\366\320\255n\3104+\202\327\3311M\207"
+	.ascii	"\007^\272\301\371\362\250\355:<\217\335"
+	.string	"\253\210\002N\366\227\331\262\006H\344`\331\226=\023\334\256,\313\336xr\310\222\023\337\324y['\177\200z*m[+\232\221\377\321~c\336\366Q\304!\350~oka\251\350\233\"\3234M\315\332oLtm\033\346\213\352-V\230\021\260\\\241\2175\250\226f\356\356\357\304\237d5\236\366\\\223\265\334\272?\273\356\267\026trd\306\253g$\316\201L\337\353\007\310\206D\206Od\276\304!!\343\3253+\270\271\264\315\t\022\361\321\350\3253\227{\256\203`\230\357\t\257\236\315\374\300T\354\n}\340\345\322\224\200A\024+\252e\366\260WWh?'F\331\321\353d\333\324\320\004A\0356\354\206s\320P{\204|\326;\b|t\036\200~xB\370\350vx@\f\005\345|t==\272\235\234\217\207\f=\271\235\037\240\034\002\002\326\201\340\371\311\005\351t?9t\310;\211\306\254\315\225\2201\336\366\354\n\\'"
+	.string	"\fr\203\314\266B/\221z\252\325\240\213\033\203jR\223\331\215\331\337\215?\311\244\232j4k\362\366]\2711q\333DB\212\230\244\250\226\241+t\2459\354B\346\235\240\232\234\t.d\276\034\354\270\255Y\006La\276\251\036\315:`*\372\2143\353{a"
+	.string	"\362e\\\b\322\023\230\235\331\272ud\026\2632{+\037\215\227uY\230\275\257\211e]\366Gf\274\332\n\177DIU\026m\003a\250q(\203\220C\306!\032\021\031\211RH\007p\002\231A\253:\021\260\2555V\f\031\346*\371}\225\001l\375\313D\007\020\364\314\300\335\006\227b\373^j\275\nT2\201\211\335\036\3334E\260!\004\037hG\351D\004X\013U\020\275\320\030n<\202\271\355\017q\362\0073;1F{<\321\026}2\265>\304f\271S\370\200HK\341i\r\245.\363\312?\310\rZ\372i\244\271\037\230\350\201R\274G\337\021\303\251\231}\023\247\244>B\232\211^\344\334\246y)\356(\376\026\335:\262V\343\036\354\033W"
+	.ascii	"\032\202\235x\264\235\253\206\t\330\324W\272\217\235\304\243"
+	.ascii	"\2634\366c\247\233\"Z\024&\304\236\024Q\254*E\234\"\370\253\333"
+	.ascii	"G8#\030\207=\241)\022T\003"
+	.text
+	.section	.gnu.lto_a2d.9.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375`\322\001\235\020"
+	.string	"v\337oG\360\260(\035:\206\205\363J{0\204R\260\211\030\330\356>k/J\0362\211Z;\351\026\247\235\013l\235{\244l[\016\017Ai\214-\004v\246g\322\362\301\353e&\215\r\r\026%\373\300\315B\371-!{o)e\n^"
+	.string	"Q"
+	.string	"^"
+	.ascii	"\037h\324Z9\001\313Aw\312\005@wv\205=\255\226\321)\233O\337\221"
+	.ascii	"\325\032\266!\223\313j\341\262)$\244\310\0043+\327\006\252\230"
+	.ascii	"~X\256\231\332\300\022\226\035\025-0(\240\244lK\002\342\314\352"
+	.ascii	"\003\222H\016\033\226\213\205-\237\200\037s\346Qk=\233\200({"
+	.ascii	"\316\376?\371o\340\347,=\216\343\370^\3610\177c~g_\273\034\346"
+	.ascii	"k\314\317\232O\231?\233/\231\337\315\347\346\357'[\331\004\020"
+	.ascii	"Qk\204\321F\255\2311\032\376\237\376\355?\363\337q\340\264/\b"
+	.ascii	"\357ZE\021\246\326Z\340\035\332\316\377\337\226\365p\372ed\314"
+	.ascii	"\002\270,\016\252\341\214\224\370\321|\256\020\264[\027fo\263"
+	.ascii	"\275\360\305onX1s\256\211\312\026\231 \273\024\262H\211\037\217"
+	.ascii	"\210a\243\"\027\354eh\267\247\233AH\263\031L\304\232\356\326"
+	.ascii	"9k\242\334\016\\N\220p\215/\314\232\3506\367\246\304\217\307"
+	.ascii	"sz{a+I\204%T7P<\376\261\021\356\326\277\001\017B\374\020\210"
+	.ascii	"\324}\200x\"\021R\027\022\225L!\034\251\033\215\272\020G\372"
+	.ascii	"h0\342B\036\b\007\032\360\256$\362\270\220\256\363\270-V\267"
+	.ascii	"W\276*\035D\nZ\0042\262N\357\n\026\024s\353\205-\007\003\313"
+	.ascii	"\253=\255\265\326\367@\365'k\255US\220u'k/\034U7P&@\274\224d"
+	.ascii	"/Ka\264K\001$ \340\"\t\354\272\001\366\001o\347yj\206yU\337\256"
+	.ascii	"\261\003\271_\245l0\262\246zA4\316\350\267\016{[#\324`\301Y\356"
+	.ascii	"~\004\177\226w\343\336P\013\200\023\267\306 \217\032Hmci\275"
+	.ascii	"\342\274\216\201\036\b\027+\343\336\223\r\333\313#\344="
+	.text
+	.section	.gnu.lto_a2i.10.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375`\217\004\365\037"
+	.string	"&\373\317K\220\026R:\300S\220\344-\307h!7\344$\217\236\245\335\267X\b\023*p\242\035T\247\354s]9\205\312\333\361\355\253lj\375+\177\215\027$]\361\253D\360\315\315\237O\240\333\3405\214c\224\375\220\301b\371\326\032![\356$\003\276"
+	.string	"\257"
+	.string	"\277"
+	.ascii	"\247zU\320\231@\007p/\023V\327\275L\003\254\200y\031\364\247"
+	.ascii	"\3550\350O\256\365RB\334\367&Ut\335{\rp\002\333\317\004\n\202"
+	.ascii	"X\350L\027Go\356(\312Q\345\336\313\353\026|V\241\347R\334\315"
+	.ascii	"VCO\333U\210\317 \311et\004\361\334\265\2065\355*'\234\275RI"
+	.ascii	"\363C\214I\366\201X\211\251?\031S\324\233N9e\373\020#\212'#R"
+	.ascii	"\255\341\210D=Y\"\201<j\013$\305J\350\216EV\306L\271\344[\257"
+	.ascii	"\305#\261\236N&n\255\203\257\023G\272#\221\2551\222<\371\223"
+	.ascii	"1\251\366\265nk(q\031\035M\274\326 \334{\271\032\035I\234]\316"
+	.ascii	"\314G\230y\002\263\275\020| \364\347\255-$Q)\246\030\252i\314"
+	.ascii	"\314a\355%\363\tP\221\221\205\233\211w\2652\316M\255\262M\255"
+	.ascii	"\\CS\253<S+\313\324*\307\324*\303\374\352\007\360\242s\271\325"
+	.ascii	"\237K/\365\343ng\376\266c\235\317g\235\355\245\316]+\327Z\371"
+	.ascii	"\001j_f;\264{\217\322\262\334\262\263\307\214c\375Y\347\363\370"
+	.ascii	"\026s\312\302\357\340\323kI*dN\177\2369\210\257\343Z\2342s\226"
+	.ascii	"\317/\321x3Rn9\271\227)\001\213\301l \214\266+"
+	.string	"%\227\223{o\316O\216`\257\370k\311\003\033\2167\203n\305`|\273w\tH\003\333O\001\266+s5\035D\2421\024(J\037\266^\362y\036t\246\177T\3144\020yFLV/)fK\265\ng0\264\266\f\0311y\031F\3112\264\227\334\023\265e]\272\003\324\226\232\363\263\213_\0215fu}&\250&\365\326\266\213\327\272\315I\324\230}i\266\025\327\335\305\333y\320\230\346\320\024\362\256\363\2400\035\323'&\2070\375\255\333\037\310\260\356\332\031\224\270\212\266\f\3254{\357\275g\217\237\337\213\013\037\364\347K\337\b\202\333\326u\005%4\"\215]\277]\372L\210\311\\\237\375\306\240tF|\032\326\2640\021^!l/y\327\271\336\215P\322\024#\252W\032\t\026\030'\272\227\357\362\371\314 i\n\300\357\370\370\032\270\343\343\263:\302\r\034l/(l\017\275\312\275\003\276\337\007aP\347\307\367\353\351"
+	.string	"\201zx\276\337\316\316\257\307\363}\330\260\303\353\005\205\274\003\003\370\007\324\t\362z~\277 /e\016i\371\355lN\317\346>\233\3066\247\266\271m\337t\221o\335\234v\263\355\3564m]\221\217\262\241\0362M\363\205h`\260\312_\350\317v\212\002\205t\323\025\311\275\367M\327\372"
+	.string	"\026hV\220\264\344z\311\013\246\340p\372El\214\331jnM6\250P\231\336u1\347\273\246\032q\326$#\252W\032K\016\342\215\224\002N\007\221iA\260\254\210\270^r\330m\252l\032\210\244r\262\341\324\326M\350EX\250A(\245\210c\204)##$B\2244\006p\002\221:\344\006\020h\2526\035\253\020#\255\304\263`4q\245\363\020\371\270\277\036dEFH\016\265\363br\370\334w\262B=Fn\261\311\301\016t\364\253X\312\250\261\025\005\260\227\""
+	.string	"N\375\366\350\262x\261-F4\325\242k\300\225\376~p\036\346\225\004f\351!l\001\374'\216m~%\251o\004\006\313\003\256\220\\\001\367J\001}#\250R\351\t"
+	.ascii	"\006C\347\250qFFH\004/i\334\322\007G!\272\302\232Z\n\360\007"
+	.ascii	"5Sk\306~\0172\236h\037\"T\n'1B\224Z3\234-\034`V.\t\315\033\346"
+	.ascii	"\377<\251I\0305"
+	.text
+	.section	.gnu.lto__i2a.11.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375`t\001-\020"
+	.string	"\206\336oH\320TQ:\230\2204\331\354A2@\246S\321\344\200\031\362P\273b\r[x\001\274\300\202\336\330uc\032\361?\017\205\272\034\\Ya\224a\035$\230w'\301<\b\204\240\003\235\2644\211y\020\f\f\231\362\370-\331R\246\024V"
+	.string	"T"
+	.string	"["
+	.string	"3D\340\025\357\035J\332\366{\35633\355$\334\271)\2110^\210G\346\f?\2077!\275\363>\200\364ne\234v\271J\363/^\372\344\204n8\231K\234\257<`Dd\244\004G#Mlh\334.^kp5\325R\2049\247\365\206\273\271\273\333v\261\275\302\376O{\202\323\203\303\007\215\036\331\241\214\256\216}97\307'\323\201~\357A\177\351\341O:\320-W\275\252VU\277$"
+	.string	"\017\020\224!s\332\214H\346\217\256\250\206\355\231m\262\203\204\260xz \332\005\314\231\303#\345\275\263\252\375\237\337\230=D1\2009c\370\f\315\366iQ3[\263\312\345\236\026BN\310\306\263\353\357\210\221i\220\031>\215\364\356\342\215\310\214\216.\256C\346\315I\323\022\363l\017\f\274\333M\345\212ft\324}\217\\\016[QMG\331ii\275\375\332\263\026\372\233iQ\266\225\371:\330\031m6j:~\347\310hhW\307\245%\005V\221\002\305\t\023%H\214\020\021\002\304\007\017\0358lp\321\220\001\303\005\013\025(L\220\320\240\205\001\313\202\224\202\025\225\004\005X1\025\013\251z\353^\245\274\300V\f\306\212y\201+\326\213\f\346{\201.\027\270\372^-\225\353[\301b_\n\001\203/,\330\007\003\202\260\317\024\316\313\2719\276x\257\bQ\2225\255\245z+\267\306\001\032"
+	.ascii	"Y\b-\257Q\226\b9qC\001\207\030X\357\254\302\212W56\224\240\240"
+	.ascii	"\216\307\331\345\032\256\2611g\210K7\001\303/\0240\327\325`@"
+	.ascii	"\247%\021\004\022\362\021P\363\340n$\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_itoa.12.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375`\223\004}\036"
+	.string	"\0068\305H\200\332Q:\253H\231ud=\333\"\022\n@\316!\230k:\376\007wl\324\b\321\346\f,"
+	.string	"\257\265?\255f\256J\273)\363\035\317\221\242(@\346 s2cAz?\n\246\023\313N\313\357\271xk%\237\354-w\222\001\257"
+	.string	"\242"
+	.string	"\260"
+	.string	"\017p\257U\023,\367\032\203X\310\274eJ\231\037\345R\234nd2\266\335[\205\205\345\336\033\304\017\314[\237\312\314\374'\207\342\304@\036#\226\324\307\f!\036\335\334k\344\261\361\273\362\326\274Ny\333H\016<\356f3k\245\255M\201\374\312\245\205\246\030e\343\270\333O\225T\220\333\036\006*\b\362?[P@\250Y\033\372\251\222\022\362\232\217\227uA\03216\272(b\335\361PR|\330\220\332\212"
+	.ascii	"\355\210\231\207\201\372Q{\250\314\246n\320:\365\326E=U\237{"
+	.ascii	"\357\217\2479\242\204\224\326\206\356\275L\213QR\347\334\231"
+	.ascii	"y\n3\303`\256F\001\345\233\366\207TBz2\256\337-\262\332\020\223"
+	.ascii	"Az2\033\205\264\257\230\337\347y\236\334V\314\005J\312=\2262"
+	.ascii	"\201\203\235y,\345\235\001%\345\235\245,\340V\316:\226r\316\273"
+	.ascii	"~\335\215\177\356_?\356_g\233\245lZ\3125K\271\264\224-S\256\226"
+	.ascii	"rW\312\264R\276\201\233\031\232\0024\367\3628\341\3343;"
+	.string	"\266\344`\277\225\207]\351*\262S9\362\367)\374*]U\306u\357\305\035lH\210\343\303\230!@\277w\001K([\217+\035i\3565\006\375\230q\267\224\331\211\031\307\374\005&\301\244\357\002\006O\362cQ\315\303\230W\274\314g\336\373Da\311\034^Hp\273k\241\254\261 =\005\364\313\262\250\f\307\204Ej&\355\256\235\323\374\260\237\f\372\242N\373\f\333\006w\227\235\323\026\260\316\241\023!\037\217\004\263\224}\305ew\377\230z\342\365\305v\331'\033\252\311\265mztp]\327\376\220\211\220\236l\353n!\255-\304d\320}%\177\354\310\227+\223\204\017\354\322\342&-HO\2615hDl_\361\2177\335dI\366\355LVr\245\270\266u\016\240\347zg\304\313\354\211\276\251}\365n+6\360\032%\355#/0O\364\r\0038\3173\371\032\001\374\302E\013\026+T\244@Qt\302D\t\022#D\204"
+	.string	"\361\201\310C\007\016\0334d\300P\201\302\004\t\021\204 <p\320"
+	.ascii	"A\222\317\350\250\032]\351\214\304\200\251\247\344kJ\242\301"
+	.ascii	"\324CJ\212\361\233\301c\352--\365\220xLJFK<\244&\037\217\301"
+	.ascii	"\001\356\305Hj\342\315\350\365\232x8c\360\365\266\225\256\177"
+	.ascii	"\374w\024\275\234\005[X/\322\306\323\\M]\027x\227\363\271\020"
+	.ascii	"\035\237`\253\254\207\b\311,\242\207\300\255\326\272\336i>\222"
+	.ascii	"\247\326f\357\210\331r&\216\r\231k\263OL\006k\315D\213\f1I\225"
+	.ascii	"\024\251\316\314\260\233ib\311R\247\271\332\332\003\270\024\375"
+	.ascii	"\307\003m\221q\245\355\232?V\344\343U\250q,f\230R\306\224L 3"
+	.ascii	"\263\2400i\003\240\"\231\253\333\022\200\226E\b\241\271-\326"
+	.ascii	"\3773b\344\202Xi\026\013\257lX\205N\035\363\372xK\266\340\270"
+	.ascii	"2w\2165\326vH\314\366\\\302\3027\301\337\337\021\370V%H\374\255"
+	.ascii	"*\332\026\212\301\020 @\334n\255\004\001\300dqV\3716\254\346"
+	.ascii	"<q\201\366\301~\203\336\377/ZH\300\232Ev\035\002K\250\331\364"
+	.ascii	"?'\346\016\\\202\337\035\305\317\225\236\003\365*\023\232\352"
+	.ascii	".\"\254\001\027\330L~\033\034\263F\276\236`\355\317\224\341\220"
+	.ascii	"\344\"\013\246\263\n\007\343[\305\200\256d\002\344\365\201{\036"
+	.ascii	"\370J\026qyK<*"
+	.text
+	.section	.gnu.lto_ftoa.13.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375`\307\006}%"
+	.string	"\nAx\016Hp\234U:\377\223^\245\035 \034\203\b[S\362- \003\225g[\376\361\347+\\`(\021\357|\245\266\273\016\315\237\370\f\341;\366H\226\210\230\177\307,\316b\210\244\324\213\021\253e\353Y\273n]\327\215\244\021B\366N2\320"
+	.string	"\307"
+	.string	"\336"
+	.string	"Om^\312\270\224]c97\213\276\366\204\366>J\324{r\366\301\004K\316M\243v\320~\355{\273\257\365'Po\366\225\346\311\371K\020,9g\243Fj\277\352\324\356\3563y\023\250\216\002j\002\241\372\231%S[\322\234\233\273n\376\207\375\332\036"
+	.string	"\373\025\377x\324q7[\2156\343ie\354\252\342\033\325\007\273\312dN\217\311\341q7\233\232\300J\314\214\227AZ\251?Y\310\035\267F\323\221\205\314qg<\316\2436p!\325\3612H\034jm\316\224\231\203\335@\026\262\352\266\006d\307\242\272qv\312xW\032WgI\032\307\252"
+	.string	"+13nI)\365"
+	.ascii	"\264\307\232\203\375\302H\026\357\225M\3109\367=&\251\336\271"
+	.ascii	"w\267\264\273\223\272\331\020\001\313\342\263\304\201^\251X\371"
+	.ascii	"\342\213\034\317\334\022\246\3235R9\023\205l\030\207!\fq\032"
+	.ascii	"\255\212\267\310\321\n\212\257\b\3310P\r!R\310H\3359\355tQ\f"
+	.ascii	"\275\353\030\313\251\004I\274\323\356\346\360be\367\325\214}"
+	.ascii	"\020\261\267\207\036\345\327}\312;h\275\335s+\357\034\356\366"
+	.ascii	"\346o{\363\335\266\267e}\233eo\257\262\333*{\033\263\267\357"
+	.ascii	"\275}\004\267%\264\310\231\263\214i\235\374\\\265\030\371\224"
+	.ascii	"\277\353\257\362[\271\332\375\356\207u\323\336\r\325\337\272"
+	.ascii	"\327\277\016\326\264\356\266\322\324\016\221-\227\262\311X\316"
+	.ascii	"\231W\305I7\314\345\254t\262\314\031\t\342T\316\005\365.\247"
+	.ascii	"6/-li\215\345\214\314\360\2545\322\003\250O\twr\027\343\237\030"
+	.ascii	"I\034\235w\251\303%v\223c\247\215\263\352\210\r\243\271[a\240"
+	.ascii	"8jo\344\310aj\331\362\344\242\335 \033I\360\r#P\2403\237\002"
+	.ascii	"\017\273\327\317\007\210\210\021\265/0O\027xx\024G\032}\276\314"
+	.ascii	"]W8q\230\321\005FQi\224\330h\260h]\361`\345I\260\027\227\220"
+	.ascii	"\222&w\333n^\357\376xq\355+\313S\n\017[#7\314(Q\246\273\217\355"
+	.ascii	"n\005\367\362\375\210\345\234#\254p\3320\243D\026+[D\027\365"
+	.ascii	"\206\223\300ha\034n1\214&6\207\201j\270\221\342\254\335\331\233"
+	.ascii	"\013\373\260\177\375\316E\354\330\203\273U(\335\037\373`/\272"
+	.ascii	"2\342a\347p\017~\330-,\211\\1J\217s\370c\214d\210w:'\347\354"
+	.ascii	"\323\342c\341\220\2511\253\270\336\260\0025\306}t\273\257\257"
+	.ascii	")\211\307be\200\004\374\315\200\301\037\023\257\027\324\260d"
+	.ascii	"b\206\002\370\0232y`\342\005\223N\320Z\274{G\300\340o\205\320"
+	.ascii	"\307\002\030\354\371\226\236\230v\300\240\222R\260\267\003\376"
+	.ascii	"xJ\273\236p\305\356H\250\203K>\341\216)\030\024\356h\315|5c\037"
+	.ascii	"\215o1x<\211\270\330\345\244\346\214%\341U\376\261(w\332>W\206"
+	.ascii	"u\230v\265\342\276\327o\200\230\f\317\230n\202\356}\207a\373"
+	.ascii	"f\n2,\2474g\343\217\025Zc\212\241\257D\270\373\002\206!\254\303"
+	.ascii	"D\370\002\356\006\016\367\307!|\303\252NG\350\363\0012\244\037"
+	.ascii	"\305~- \026]\261\016\263\270\003\323iD\022\340\256\230\200\016"
+	.ascii	"w{\370\240\013\302+\2361\275L\335\261\363'V\305A\370na\254b\225"
+	.ascii	"\315T~\250aD\205\214b\246dF$\210$M\212\r\220\242\221\262\343"
+	.ascii	"\001\022`\205A\2179f\024HI\352G=\007~\024\030\364\002\257\305"
+	.ascii	"=w\333\277T+\026\215F\222\031NKXG\323P\030i\002\216\004\\\226"
+	.ascii	"2\316\026\2531\365v\033\260QJ\357J\341VM\336\366x\250\272+\322"
+	.ascii	"2u\030 8\300\n7\376\233Mj\235\211\203\fM\214u\251\377\340\005"
+	.ascii	"\265\314\316\0162\320\276(\023\f\272\353@X'\177t\355(J\240\314"
+	.ascii	"\261\203\375\320\313)SN\016\023\2415\031\341\036n(\210\254`\202"
+	.ascii	"b\206^\023u\241~\243\361\325`\246\233d\343@\324\376#\265\303"
+	.ascii	"\003\017|8\345\364\007\205\313\233\255q\033rv\035;\375\214\355"
+	.ascii	"&\206\376b)\341\026F\352\246\037iX;\021\364x\f\260O\305\372\250"
+	.ascii	"\215\021\261\261\342\272\266\251\017\005*:\2033\222\200\006\347"
+	.ascii	"\264(\357\355\3535\376\0254\323lp\205Q(.\243\236\3134\034l$\036"
+	.ascii	"m\276\346kT\273\032"
+	.text
+	.section	.gnu.lto_fastA2F.14.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375`\331\fmB"
+	.string	"*r\374\030AP^N:\177PI#\032\005\354`\323\363P\371\210\302\307\2209\016J\213\3305\320;_e\035\214\005>\001\373R\b\005"
+	.ascii	"\314L\303B\256\2673,\213\037GU\251\376\357\372\252\232\233\265"
+	.ascii	"\204\354\264\245\f\212\001d\001x\001\335|\25527\024\220\351\267"
+	.ascii	"\027\025\\W=\262>\303\375\307F\277\266\300?\033\210\235Zf5\356"
+	.ascii	"1]\246\367\272\217\215|\334\206x\343\215h\306I\025A\013f\214"
+	.ascii	"\210\221a\250\262\270\256p\240\244\001k1\f%\336xsrk\343\"\270"
+	.ascii	"\256kV\247\274\200\330\251e\356\274\006\243\326z6Zi]\347\356"
+	.ascii	"\322\254\253\236\026' v\312z\304\276k<5f\350\325{2\245\003\251"
+	.ascii	"\264\2259\264\256+\227\262\233\324No'\325N\357d8\244\032\320"
+	.ascii	"W\257Y\212\237\030\311F\276C\265V^YUQM-\245\242\240\236\234\232"
+	.ascii	"\230\222KJI\310#\322\221\321"
+	.string	"\250H\034\252\351\275U\343^\363\367\206\007\334\215V^\361\265U\236\255\272\304<o_\356\327\272\256w\226\n\257\247\360z\331\327\305J5\211\363\322Q\275\346\245\241\270@\353\354S\225v\032\212\025\220\273\262$\256J71Q\231b\223TzIJ\024\253\004\005s\225\353\272B\261IO\376\344,2I\037\207\201\202\n-\211K\322H\177\275\314\363\366\004\211=\352<oG\226X\336\212X\343\262I\234\2216\" \347\312\2228#]\\\022;\317\033\221\306\3626\304\016\227\304\021i\365\032\220\233\363\343\b\327v\233\3600\td\204s\332\364\016s\364\250;\302\345\270_\211\004\327t_\333'\034\233\275W~\364\273\257\257\226;;<\340~\264\035\212\255\353\312\226\007\\\\3\200f\266G\230y\004\263\321\234X\007\376D\304\207\350\340|\207\303\317\320\242>\270\200?\271\350\340^x\203Gj\340d!\236\216\263\256\344\266\b"
+	.string	"b\350\320p\370\007\307\263\223\364\221\343\220zo\200\017\377\2241\230w\373\327\352\246\372C\3119\031\343\007\207M\224\236\216\273\257\211\201\006\001\377\341|\355\327\003\374\311<CMO\341\017\016\233\210\357\355\323w\333\217\342}+\273\251\366\355\217\246mM\253Q\323\322$N\341\266\241v\332\177pg\347Yd\355\256\353\272^\356\352"
+	.ascii	"\377p\257\273@\247\035\233\215~\357M\216\267\237\216Y\357\206"
+	.ascii	"\375z\222H\220?\307L\366\301C\207k\231\303\265<v-o\320\220\001"
+	.ascii	"\303\005\013\025(L\220 \026!\f\302\003\007`\255\327\375\325\340"
+	.ascii	"Z\366b\260\240\001\233\025\264_s\202\256\026\323\214\200kK\253"
+	.ascii	"\3154\037h\276\346,\003\005\230\004\006\b\b\240Z\306R-\003\260"
+	.ascii	"\226\227C\313\312\241\345\253\241e+k\271\352\226\251nyjhY\352"
+	.ascii	"\226\243\254e(\325\362\223j\331\311Zn\272\226\231\256\345djy"
+	.ascii	")\265\254\324d\232\223\220\252\345\243j\031\311Z>\272\226\215"
+	.ascii	"\251e\243\324r\361Z&\266^\363\320ZVo9\275\345k-\377\226\255\265"
+	.ascii	"\334 \222A\360\200\r\256k\217\350\242\365N\272\246J\003v\373"
+	.ascii	"u\213\351&\323m&O\002\025ar\323U\317\232\323\263t&\021^\362t"
+	.ascii	"\235T\231\247\3600\276b\237\230EK\247\3436]u\264\016T\253\353"
+	.ascii	"\252\203\361\005v5\363\022\336\320\276Z\370\366\250~|\341\242"
+	.ascii	"\204\334:\037%\235\353OF\0228\337#\344\231\315\246\251nb\314"
+	.ascii	"\324\243NUf\212\367tS\205z\324\255\240\2665luP\267\0033\2304"
+	.ascii	"\205\260\360\030\3415\b\353\220\236\375\327\305)\204\203\216"
+	.ascii	"a\347\213\224\364\255?kD\335\216b_A\230\207\004\341\004\376\244"
+	.ascii	"\323Os\332\351Oo\247_\220\225\246\213\310#\324u<\344\360 \t\\"
+	.ascii	"\354a`\366\234vl\t\036\341a\212\234X\266\316\364\260[:\t\236"
+	.ascii	"<\323\333\031g\351\311_4\035\247\225\276\364\267i\272\322I\344"
+	.ascii	"\r\266\025\256u\221\301!}\216\310Cx\377\365\325\222\207d\324"
+	.ascii	"z\322\237|\215\003\216\374S\206\242<\343\321\325?\267\272\251"
+	.ascii	"\252\207J\342\344\350t\\C\021\240Q\207\323hRd(3[,\255?\025\325"
+	.ascii	"1\362p\276E\001\037\360g\261\323\324\343)\320\3514\235\246\""
+	.ascii	"\375\370F*\\\303r\364\007_\214\003\356\341^_\b9\355\214'\276"
+	.ascii	"\303\233\320\350\306\237\320)\270f\243L\326\334F-\336\350W\220"
+	.ascii	"S\356\350\305\3376m\205k\320VB\324:\361$\276\004:\261\304\031"
+	.ascii	"\235\216-\261\341t\nDnC\0342\020\325\251\fm\266s\353\272\026"
+	.ascii	"g\315\0262\314R\004]1\232-\322\262\022h'\356\031\n\025i\327\354"
+	.ascii	"\305\212\0220R\263\025%\312\322\322\026\315e[gM\025ihf0"
+	.string	"\316\232ef-f\270\340:k\262`\321,\343:SQ\202\005W\031Z\032\327\026\0267[\230\241q\271h6\321\270\214zk\177\216\355\325\206\033\275X\215\335\213\303\225kgc\257\0378\207\207\370{s\225\321:I]\250\371V\221\035\f\354\\\337\360\266Wd\347\372X\261\217<\344\346XQu\235\354\317\254\313i\"\245\352tn\246,,8\003\300\251\n\347\273D\360\256?\0035\203o\321\021\032\363\247\3610\001\024\206*\332L\225\301-|\f\220S\256\353\025>\246\247L\217\272\035S\313\317qC;\025\022$\n\203\324\027\024\251\bq\213\272p\276P\3669\334\242\0033\246\216\324\241f\252\013\216\341c~N9\266\274::\274p\254\353\032\026\202_p\343\267\027\365\244\340\r\254]3\325\006\227\372\327\2317NCl6\nE\305G\241S\206\267\0177M\374lh\023\t\201\2709i8\337\246\0027\200\005\340X"
+	.ascii	"\242,/\242o\320\256\353z\343\311\3005<\354\314\236\323\016\031"
+	.ascii	"\215F\3234SU>\303\325\255\256\\\376\352\267L[\241Q3U\005\267"
+	.ascii	":\214\276h\353\001$\246\317\211)\253g\300\345%\263\272\241\300"
+	.ascii	"\325Y:\320Y\177\332\360!\3074\341,\340\334\222\022\336p|\226"
+	.ascii	"(\274\300\237\334t\272>\315\374\204\207\365A\325\201\013\250"
+	.ascii	"QD\003\rS\206hDD\222$IcA\005\304(\b%4\017\021 1dP\225$Ii8\027"
+	.ascii	"sP\347)\366,\336\b]\227eL\341\016\t\250`\245\fI\275\252\274\021"
+	.ascii	"\336\354\003\253\003\241&5YY\023\242\256'\211\217B:\311\007B"
+	.ascii	"\251\324\357\221\210\270\016\3612?;\231A\345\325\250\244\226"
+	.ascii	"?f\002QP\262\016WV\3248\025\243'\027\276\033\255\271\006\253"
+	.ascii	"B\307p\036\275\3066~\304}E\276\031\216\016\226XE6\237\340\264"
+	.ascii	"\"\311\216\262\223\263\270.n\222\341\271\026\0333\200s\343\200"
+	.ascii	"C\263bbw\244R\3508\177,p\204\255\347\370\013b\217\031%\363\026"
+	.ascii	"`\210\333\323\210g\221\370,C\261oz\\\270\215\332\236\316e\373"
+	.ascii	"9\335\344\361Q\r\363\366H\020@;@\312\250\036b\200\236\270\241"
+	.ascii	"1\227s,\217Eq\003\210P\216\322\027W#H\262\247\333\003\360l\272"
+	.ascii	"\361~F\317\363\352\r\337@\245\255O\214y\220\271\242=o\r=:\250"
+	.ascii	"\177\253=\242\252Rb\344\004r\"\323\243\371\371\251u\350\202\242"
+	.ascii	"G{\221\f\021+\024\001M\345\nD\213\177\f\f-t&u\005\211+\363\365"
+	.ascii	"\201\324\035\211\352\225\356\244\331\223\322I74\013J\207\236"
+	.ascii	"><\330\364\006b\233\360K\320\"YoR9\016\022\260\245\023\334\244"
+	.ascii	"$\352\217\240U/I\256\215\245|\324tl\265\236~\271\0309mf\231\202"
+	.ascii	"a\001\350\225\003\330\200"
+	.ascii	"bR\246*\220\020bY.\327O\327\001\3351Yk\222SpD\211-\3418\003s"
+	.ascii	"<r\222\021\034\360\261\374`p/U\001]?\035\274vc\337b\f\231\317"
+	.ascii	"G\340\003\004+\001Y\027\3410/)L\327H;+\333Z\267\030\314\t\253"
+	.ascii	"\303#\253\360E\027\016y\fA\022<!\220\257.Wd8u\3125\377\334!%"
+	.ascii	"f\263_\033-)~ze\233\254n\316\375\275w\226\017\261:\204E\250\301"
+	.ascii	"f*h\n\320>\3231\377\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375`\022\001\035\b"
+	.string	"\222\214/3`m\322\001\320\377\344o\025\215\216\306\215\375\252[T\231W\f\366\032\360\207b\0028\b\002\032\004\001\021\020\215\0023\355C\311\232\245m\226\375\345(\266l2\005\266\234\246\325@if\260\212f%\262h>\321\303\0205J\237\020\247\371:\350\021\216\207\t\247Ia\350\214P\307\307i:\f\r\002\262\200p\232\255\2439q\232&\345\201\376\330\020)q\313\306A_D\\!\267d@\364\220F ;\021^\035\034cpM\3017\270\273v\302\346\027\324\374\021\3342\360\212\002\211DI\340.\263,\313\254\007d\256\230\267\313\247k+\026<\244Qu\200i\257k)\354\333\030\016H\331\335}\247&\266'/\033"
+	.string	" \353\234C\303\320P\030\332ZK\001\335\234\2075\303\003\365"
+	.string	"\340"
+	.string	"\340\360\001\222\375\245}\020\306\303*! \220\346d\004"
+	.ascii	"\232cH\365\r@\f\030\020\016\350\001\350\241\223\016\252\304\340"
+	.ascii	"I\206\016\246\023"
+	.text
+	.section	.gnu.lto_.refs.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.9e7dd3b09c772327,"e",@progbits
+	.string	"(\265/\375`\230\020\315R"
+	.ascii	"j\215\334\036T@P\312I\007\352\311\270\330\215h\022\277\213\364"
+	.ascii	"@e\327\357n\276m\253\212\b\261j\347\266\020\372\036\316d\214"
+	.ascii	"2\2229F\270[2\200>\b\373\200UU^\272\037\325\324\203\003\373\214"
+	.ascii	"\200>P\255~\004\310\254J,Wr\3131\207\262\313\003X\007\"\321m"
+	.ascii	"\245L\001\241\001\322\001\344\001b\305t\031e\344\031\343ZVu\022"
+	.ascii	"2\270U\335v$\242\313\240V+\205A\253\2126\344\270~}\370\327\312"
+	.ascii	"^A\236>\264\250\230\\Gl\211\2237\347\354\341\3712O%U|\220\341"
+	.ascii	"\272d\274\033\356\356\356\356\310x\253,\225/\331\277b;\366\020"
+	.ascii	"G\310^.\212^\233\222Tx\326\023[\342\254Sx\3016\354;\345H\344"
+	.ascii	"NI\240\314\242\300q\222\342\203\325\371%\005\315!CK\007\327\257"
+	.ascii	"\224\177\243\254\327&W\350>\352\356\001n\236\254~Hq}sK\2346\233"
+	.ascii	"s.\024\236oW\316IlBv\027\215\2162\037B\270\326l\016\327\326\266"
+	.ascii	"UA\231\361\326\022\247\311\215\035\206 qB\214\331\365\200\203"
+	.ascii	"\353\027k\225\377:\331\254M\362R%cwu#Il\200d\207\027\256\213"
+	.ascii	"\\\255or\237\274g\305y\301dcu\367&U\030\273\205\233\304)\323"
+	.ascii	"-\304\331E\261\213\2422\211*\342u\326\247@\217\334\022'\2729"
+	.ascii	"\347\267\311s\216\275\342\214\376\026\370\367\201\177c\200\341"
+	.ascii	"\337\t|\377\276h\341_ \025\376\245\340_\017R\330\036\n\b\254"
+	.ascii	"\327\277$\234\370\371\2001\021?\243\375\013\302\223\377\312\020"
+	.ascii	"?\323\324\177\351\034\240\203;\377]K^1\241\367/\330\277\037\374"
+	.ascii	"\253\301\277*\376\205\340\337\023\377\222\370\367\346_\364_\376"
+	.ascii	"o\367\237\356\277\334\177/\377\331\376g\371\177\345\277\t\377"
+	.ascii	"A\370?\366\037\354\277\326\377\023\376\213\360\337\201\377R\376"
+	.ascii	"\207\360\177\371\177\353\177\362\277\211\377e\377k\356\356\356"
+	.ascii	"\356~.\341\337\016\376\033.\001=\330\005\361\265c.\303\332\246"
+	.ascii	"\222\374ff%\312\207\0301K\207\216\350\241Z\217\020\305\2440I"
+	.ascii	"s_:\032\346\334\221\211\353\216\201rs[94h\206\307dMH\0170_9\033"
+	.ascii	"+*6\212p\3358\235\233/\"cu\\\027\356\255\251\255m\275\240\335"
+	.ascii	"\315\353\346\321\245\212\243,\201\203\353\362\365\202E*n\211"
+	.ascii	"\353r\271Y\315\362\312\316\206\026-\313\266M\354nj\336\227\256"
+	.ascii	"$\253\272nj\322I\301\254x\206\353\262\375\255z\211\315\035\271"
+	.ascii	"\356\226\227\235W\214l\231\301u\325z<\322\270\206\\7\355\314"
+	.ascii	"^\220)\245\271J\233\272.\256\257%\364\373\303b\371\226m\226="
+	.ascii	"\321]\325C\265\264\005\202_\270\354\352\272\211\250\363/\332"
+	.ascii	"7\313\337\263b\2256\335\b\240df^E\256{\246S3\005\245\210\025"
+	.ascii	"\3275[\245\bb2\210\306\365ctpfp\315\r\271\276\004\224\377\263"
+	.ascii	"\205\304\356\256A\203l\342\320\346K\263\253\363\337,o\025\350"
+	.ascii	"\376\317\263)\323\255\204%\006\275\n"
+	.string	"\023\356\340\3324\315F\227\302n\344\261xt\324\201D\272lN\315\204Eb\037\203$\322\356\"\232\n\273\227\306.\246\313.\326,\217\301F\036\203(\262\213}\324B#\211\364\350XL\227\307\342\246\313&\366\221\220\030@\332\306b/\217`6E\036\211\351\322X$\221n\241\025\2272\320r\254\221\364\250i,=\t\211#\232)\322\330m\335\333\205\324D\005\272\237\214\3046\241\016+6l\322\030~\t\215\213\354\356\002\226\206Q\306>j\246G\214\335G\206/zIE\020\331\354 \333\f\376xj%\244n\003\226\272\203\333\315\356\016vw\217\370\204\354v\032\221V--u7\021\260\324O\3011\244n\356\352\022K\336\234M\007G \207k@\252\350\250\304\325xr^\236\2258O\226\210)r\345\244\026#\263VI\243\245G\324\021Wv\262[<&\341\033\030\306\342\241E\251\r\271\362\022f\262X/\343&G\342"
+	.ascii	"@\226\024\245L\b\372\033\366e''\341\250!\347*#|\204'Gd\033^O"
+	.ascii	"\254\254\316G\316W=+^\2263\365\344\3065P.r\316\221\305DR\343"
+	.ascii	"\312D\3167v\240\321L\243\0023$\307\324\022zF:\236\177H\361\024"
+	.ascii	"O\255{(\001r\330\326i\252\203s\206\303\233\031\220\363\3249H"
+	.ascii	"\317\212\273\211\370\032\"e@E9\033\343\204+\363p\267o\311rBr"
+	.ascii	"\345\035\016\007\300\226\253\271\261\254\256!?\306\240\034\365"
+	.ascii	"\206\262\215\263\0166\330\310\363b\323\301d3\365\266\250\246"
+	.ascii	"\240\325u\332\244s\003G\025\327D\307\331x\356\301e"
+	.string	"\330C\tW\346\361\r\022\206+}b(#_\276\316\204\241\274#\002\250 |\224\341zv\002\222F\325\003W\3363OnZ\345\273\263\344\030\3079\307\037\"\004\031\017\251#\024\364\347\033^l;\252\222\350\267\t31\023\027\013\350\006\202*\311J\t\316\033sX\306\304s1\fe\203\323\001\265\205\223\304.\007\266+\236\3013xi\215I\025\215\225b\273)\235\227xf]Hw\\9\207\207\341\370\210\253\341D\204\217\370\210Sd3\355\332S\222U\235\r\2161I\301\244s\252T\341\204\211\020\256\214t&G\325x\252\342\3122V\211\206!\2512\303\2548\306\232\234\0051c\206\205\333\255\374\212Cu\f\225\302p\360,\334\344\326\035S\311\225{\223\274\004K\n\211\353\336-\3272L\021*\\\367\314\2314`\260\306\310^\245\367\303L\312%E\206\314\332U\020\245$\256\233\236tj\256\300\004BCC\030\370\320"
+	.string	"}z&"
+	.string	"\376|=\240O\013\340\317g\324\003\372\004\331\340+:k\210\001\364#\002\026\365\202\210\214b\324_\220\220\317\317\007\024\362\031\261\340\3433\242\206\030@0\202`\234\177\221\342\205\237\217\bX\264\023\324\202\221\020\320\317\267CTd\264#\200\220\220\321\3577\364\353\3150D\364\0028\364\353\271\360\023$T\201?@D\300\242\223\203\236\013\200E?.\364~\206\200.\324\237!\240\257\372z~x-\364\374\360~z|F\365\247\307'dD\363\005>\024#\210h\00784D\264S\363\323\343\363\251\007\362\021\005\375\202^@\257\202E\004,Z\320\320{\013\027\022\270\220\340|\013\027<<.X\360\240g\301\303#\372y\001T\317\303\223\301\211\021@\350"
+	.string	"\005J\361\033\362\025\021\005\311\360\033\002\n\212Q\003p\3477\004\003\306\020\320\316\317\367\003c\007\210\250h'\205\002\374\306qg8v\2639b\270\n\300.\n\032&\225Py\326s\362\313\372"
+	.string	"\205\212\262\312\313\224\t=\222\236\272\034\2519\003\222\324v\346rV\332UQ\333\302\225\201\3404\021Q_\315&Wf\343&\016\327\021\007\261\265e\025c\020\251\332yKX\224N\302\225\265p\332\321\222[7\222\334\304\"\002\244y)$X\210\020E\2649%\321e1\322\220![\023\202\006v\2121=\341:\343TH\204\251\304\225\177`,\213u&\227m\220+\301 LP\032zL\266\262X&\370\312\315\231%g\354\254\320\257\211s\357\326\304y\256\3623\031S1\322\312\002\262%\316\0066\347d1\236\363\230\210tF:\204+\003\233s\376\034\226\205\346\314\235\035\026\327\256!\f\306\223\263\240\225\334\212LA\253\273\001sZb\214r\006;\177\365\254`\254\033\032\314\343\034W\226r\206j:#\213\363b\250+\251e\022\256\217"
+	.ascii	"M\346(\026\241p!9+A\302\001\201Y\250\2410E\030523#"
+	.string	"\"R\220$I\007q\005\204\030\346\240e\035\021p\255\202HfD$IAI)\303\034\211\005"
+	.string	"i\207\r\340\021R\313\013h\227\243\252]\255C\263\251v\224\254\203T\262\244{_~\261T\227\\\\\037\006\214\333\024$2\025p6\f\026\314q\031&\304\341\324\322ab(\344\340\270.@\033\307\214\n^\275/[\022\247+\327\375\357\340\311[c\024:\272@\360\207\242\335uX\\5rU\3570l\253\341\263\204\003\350\272S!\374K\331\254\253\300\237\335\224\314R&/VA6\371.\337\037q\202\t0\265\254\365\023\231\224\307U\257\232\220\251\266,\3103\241h`\375\200\nO\376\031#\354\361('\367W2DD\211rHt\364"
+	.string	"\r\262f\372x%\016\t\207\241\216.\tA\213\331\361\255S\257"
+	.string	"\210\326r3\371\\\323S\f\360\3358\034\"^[\330\263\"\017\\\026\364Rv\323\251v\033\230a\026>\360{\013\301\351a\250\344!\022\310\024\217P\034w\341\031\253c\242\202M\332a\215O]\260B\210\303\n\210\270\020\211\221W\202\203$p\2115\025-i>\344\356\372\274\026\330\030\207\022<\364\241\351c\347\\\300U\231\262<\r\035\031\374\204\327sJ)H\266\017\233\n+\245<\224\334\320\030\004\303T5\200cha\357\200\246\224\b"
+	.ascii	"7\016)\335\321%qM\371\337P\344\252O\356B\251\224P\324\223\025"
+	.ascii	"\177\034>\006<O\370r\3408\354\313\366\355\033j\262\352\270\243"
+	.ascii	"j\372{~]\363p\035\342\304p|P\340\343W\314\322\366\026]\271\036"
+	.ascii	"\246H,\217\025RKi\013b\007\322\250$J\353d\235 1\362EC(E\002|"
+	.ascii	"\032R\241\362\361\bJ\270Y\340\2109O}T\b\216gQ\240\324%\3037\247"
+	.ascii	"\357!\244d\353O\226]\032\210\212pFy\\\317,\316P\324PeJ\230\031"
+	.ascii	"\210i>\220\263`\006\340\333J:\016\03095\334\360\214\252\220p"
+	.ascii	"\f\360\242\267{\313\203\276\r\261\273Z\013\264\013\005s\204/"
+	.ascii	"&'x\037w\257\377\034\204\205\177\234\344\325\350\317\224\r\036"
+	.ascii	"i\276\305\351\357\177\273\336\005\333\235\267\310oz\377\005\236"
+	.ascii	"\312\036=\225\217t\302\217\020\231\363=\004l=\237\220q\334X\376"
+	.ascii	"\023\275\244\227\300[}\211<\331W8\355\3405|\200\337H\354%\356"
+	.ascii	"\303\177\322>\322/1\376\035\337\036\210\3360?(\357\020az-\216"
+	.ascii	"#\203\207t\223\276\371\007\352fZ\253\fwX\005"
+	.text
+	.section	.gnu.lto_.symtab.9e7dd3b09c772327,"e",@progbits
+	.string	"uli2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"li2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"ui2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"i2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"a2d"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"a2i"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"itoa"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"ftoa"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"fastA2F"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9e7dd3b09c772327,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
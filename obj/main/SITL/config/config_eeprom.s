@@ -0,0 +1,944 @@
+	.file	"config_eeprom.c"
+	.section	.gnu.lto_.profile.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375`\314"
+	.string	"\035\b"
+	.string	"\222\212(1pMZ\r\366|\2526zY+\022\255\204\234\223*J\276H\244\201\"(Dm\333r\377\377\377\377\357\376o\017\355\265\326H\223\024Z\331K+{s\313\214Y\r\200\022\221JD\250\020\330\240T\b\205\t\n\251^\347\215\216\376~3\203`\024t&\221\335\376\356\245\"\034\252\013\r\337&0\214\\\226\305\216\217k\202\350ry\275N\247\373\201\363\345p\314l\230\246\207\351~(\f\271\220\250\344\023\337;^b\300\201\001\007:\272\031\360 xo\370\373\335\337n[\244\265\220A56{\311a\241!a\022kV* `\202a\312\326\003\224\251\302u\013\346\335\303\021\223\205\211\200\264\335\263\323y\335\274\367"
+	.string	"\200A\256ii\266s\352\003d\351m\017\331k\214\330*\214\375\232"
+	.ascii	"1+\337\245F%\200=m\263\320k\200\370\264\240\035\207\260\305\020"
+	.ascii	"\002<\337$\201\007Y\b\212i\222\266V\347\316\t\033\356+\334\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375 \321\035\003"
+	.string	"\222\305\016\027\260%i\f\f\303p\226$I\222\202\333\326\260\025\260\265\314\222-e\n\377\205c\032g1\ts\240\204\252\356\024\234\030\264\247\224\300\216i\333\214\215\312\022`\310\332\255\230\246\271\304C\020"
+	.string	"P\t\301\025!\220AV"
+	.string	""
+	.ascii	"$\\\003B\t\271\353\233k\004\326`j}\237^Tv\270\271\024p\004\006"
+	.ascii	"X"
+	.text
+	.section	.gnu.lto_.inline.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375`c\003\365\020"
+	.string	"\006WTD"
+	.string	"\261$\351\023\206\365\303\300O\254\254\360\277\213'P\375\216\322\377S\235B\356\266\306M\216\363\250\253\225]\242\354\021\376\377)td\341\353\016\202\232\373\277\255?S\356[\277#|\240\325\021]\356\006\232m[\356\024:"
+	.string	"E"
+	.string	">"
+	.string	"\327\265\356(chN\246^\317\322\0244Np\007\254\317\265\3428\262\244)H\306\214\311\370)\357\f\357U\351{\357\345\372R\326\330\360\254\262^\304\216\245\334\261\341Y}|\266\205 \305\256\202\234\021b\303\n\267N)Ju\203!\027Tu\023\223\302QE\350\234rH\260Q\362\021-\027)\236#\2517~~p\006\214m\335\030\022!_"
+	.string	"\251\202P\372\330R\0304\034P&\207&\025D\217\036\023\001!*9*\t\221\203\367\236\313\347\331\326\215\270\310\302\004)\236\345+\347\002\206\005\201\006m1A\347\302+N>\360\267\256\277\310\302\255\313_\273\332MP\237\234\017886\203zH\341\250\021:\377\343\203\353IYS\002\350E\200\rS\f\256\344"
+	.string	""
+	.ascii	".\220\256T\006&\205\202\244\245\032T\350\330)y\244i-\262u\210"
+	.ascii	"\230\245\013\007a\307\b\244\220\035x\234r\240\004\003\332\343"
+	.ascii	"\326\225\212\222\351\2319Y\251O\205\f\026\n\034`\250\321%d\022"
+	.ascii	"H\005\005IIR\030\016p\002\031\252\262\036\021\020\2454\316!\032"
+	.ascii	"M\324\376\033`)\216\302 P\007s8\023*%\277l\265\204\340.\266\356"
+	.ascii	"TEh\306\b\036\321c\223\202d\200n\234\212\0221\005\361\002\234"
+	.ascii	"g\225\340;!\242\340\330~\033\217\031\231V\331l1\224\320/W\207"
+	.ascii	"\306\264ShG[\214\346\216.H\361/\365\201>\270\327[&TG\346\267"
+	.ascii	"\317H\356\3028\216\367\376ld\222=C\361\004\321tW\024\006\231"
+	.ascii	"\245@D|KO\200\316)\233p\315\204Q\266\345`\2264\207\327\021\362"
+	.ascii	"\2163\373\033\030\036C\342^\313\207y\030g\241y\237\240\300\016"
+	.ascii	">\2541\275\213\224!tIM\212P\003\373\312\241\362\221\227\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375`\235\006m\017"
+	.string	"\326\2214.`k\222\016\300\316 \310\246\225\001\257\375\3577"
+	.string	"*\b\021$p+\b\222$L+NQT\225\336\366\300\374\365b\037\250h\355n\204\310$\003&"
+	.string	"%"
+	.string	"*"
+	.string	"=\375CE\016C\006\031\262\356\270{Ui\270\322(\315Lw\363\302j\354J\377H\272R9\273\330\025\371\022B\307C\220q(\301\246A\237of{\3050v\346%.-\t@\316`\235K)\312qv\254S\326\026{\213u\256Z\n\367\262\313\300AS:[\002d"
+	.ascii	"\ti\0245\212\326\263\323\315\231\307\244Cp\322\033q\215\203`"
+	.ascii	"C\223\276\331\025\273\342)\246\334\001$I>\317\013\326\222\022"
+	.ascii	"\362\211{\n\3673\032^\257G\001I@\252\245,\224\272b\306\301Dn"
+	.ascii	"\3434\016c\310\322\221\273\013\200\200\250\301\2751\242i*\255"
+	.ascii	"\035`\242AVV\017\022\200\322$\002\0219E!\201\0228#(U4A\031\n"
+	.ascii	"\n+\305\006T\211\2448\"\204\322\246\265P\223\320\373\237A\332"
+	.ascii	"\257\032\207\252\377\304\234=,\353\256\005\034&%\024%\275\312"
+	.ascii	"\\H5q\324\254]s\022,k\307X\313v\023\302\346R\267\222\353\003"
+	.ascii	"b\366\315\264tJ\356Z\b\2416U\326L\266\245Q\301\002/\240\230\271"
+	.ascii	"\353;2\245\374c\242y\301[^\361\311\333\222\230Cy\017\023\021"
+	.ascii	"\030D\272\004EVi{\342]_\"\033\"c\030\350\301\303\204Q&\033\027"
+	.ascii	"\026c\300x\367I\\\337\353%3\267A\3249\237<\330V7\335\3235\310"
+	.ascii	"\250v6c\022\270\314\006.\361\025\213\307\223\303\206V^\305Uw"
+	.ascii	"\177\203(E{T8\030\267\337\234x\203\265\310V\242Tq\023*\352\334"
+	.ascii	"#\311\321\235\013\223\356?5B\340\266\331!\202\321\030q\023$R"
+	.ascii	"\307\211\003\330!\310<\240If\025B\260 #.\2730w\352jA/\200\f"
+	.text
+	.section	.gnu.lto_.pureconst.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\205\004\001\265\004\005\271\004\b\225\004\t\231\004\f\200\004"
+	.ascii	"\r\205\004\016\271\004\020\231\004\021\204\004\022\231\004\023"
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375`_"
+	.string	"}\005"
+	.string	"\262G\025\033\2207\351\377\377\377\377\017oE\332m\373\254\027\"F\363\333\302\177|6\026\221$S6N\343,\020G\301%jB\265K\003\b\2077P\223]-\220P\237\344\252J\310\345\237!\273\314Ny*\273\3644\214\214\231\253f=\227\235OG\316\351\361\030\317\nDt\212' @\002\343T\232\007t\200\013\310P2l\323w\003aG6\352\005\306\004h\343\215\036&E:\240\021\251\001,\031\017\242\b\306!\201\211\343\240\310\tBU\"$w\203\246qc\310\253\256\270`T\020\3273h/\207"
+	.ascii	"\005\237'D\242-.#\265!(\005\254\037\\\021"
+	.text
+	.section	.gnu.lto_.lto.a11aacb3fe302128,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_initEEPROM.15.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375 \310M\005"
+	.string	"b\211#-pU\323\001"
+	.string	"\355\325\301\257\317z\212|\261Z\214\177\215c\304\004j\276\"kz\003\026\221\375\372\377\345\362\301\3066\026\020B`\377\336)\005\236RE\3535M\214\007\345\260\350\224\026\325\250\344\254\020)\035L\257\251\312\b\245UF\335>r\006I\234\330]\006\343\305~`#gC\305z"
+	.string	"\205o\267\362\005,H\360\321\330~d\314\016\275\313\3549\036J\307\333]\0311\307\0161\377\233\023\264-;\034,v\327P\333,w\274m\204\355\204m*\t"
+	.ascii	"\252\244\233iq\316\f\001_\356\032\236\026\302x\031\002\\\272"
+	.ascii	"E;\237"
+	.text
+	.section	.gnu.lto_isConfigLogEntryBlank.17.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375`<\001\375\r"
+	.string	"\366\331]D\020\221\223\016\270A\312D=@I\257\277|.Wy&tg_\301k\240z\350*\007\301\340\236-t\327\276M\033S$C\253\371\273Ck`\001*(\202\026\204\245?\032\302\035\220voYW#{o)S\nJ"
+	.string	"H"
+	.string	"L"
+	.string	" N\256\222\016\f+f\244\234\330~\330\364\315\033\352\366\b\337\352\346\223\036;\334\t\305\225\024\232@\371{\fVP\204\350p\246\267,\254\027\016w\322\375\352\352\242\246\213i\341P\256W\210\224\322\252\201\333p_\267M\262\rb\377B?\274\352\177V\357U\267\256\372\033\007\036fr\024x\221\362\244\265C\322\200/J\330\036\331\034{\212\b"
+	.string	"\220\246\016\245@\325\276\212\257\214\256\022=\200\224\251\033-\244\234\b\374\2619\364\374\200x\270\271\200x\230`\301\310\333g(\333\206\253[\322\3110)\315\237\224R\302\217\353^\373 e\306\351D\211E\207\024\214\327:I\374j\235\214Ii\354w%$\033\022\276(\036~\277\372K\221\022\203\342`\242\255\205\301\301\322\262\253bO\222\202\324\210!\302\233\262\257\232\001\022@\237\r\335\036\217\221L\013}>\020(\210L"
+	.string	"e\036\f$\022a\004\363h\0250\017\003\316B\037\r\263\220e\032\306\231\362\233r\264\221\201\345\002\377-~\365\00605,\227\365\267\270\273\0161\331\322\210\270*\376\352\007d\336\265~\372V7\034"
+	.ascii	"\252\322M\3010T5\247T\030b\f=\020%\250\233\200T\210\b\013\026"
+	.ascii	"\241\317\212\013\363(h\242%^\030\033\245m\002\004&\202\021\001"
+	.ascii	"*J\237\341pdIe[\205rM\235\367l\373\324\322\246z\355%\314'"
+	.text
+	.section	.gnu.lto_scanConfigLog.18.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375`D\005- "
+	.string	"\3469\311H\220XN:\204\352\007\306c!\330\2526\037\027rL\310\026\217\234H"
+	.string	"/\260\314\327;\367\022\035.\333{5\234\333Lk\264u\r\004M\341]=A\"\032\n\031\300\263\277\t\214f\271\376A\240\272\3227k\304\022B\344N)\261"
+	.string	"\252"
+	.string	"\276"
+	.ascii	",\276\345-3~\350\027\235\313:\021\351Z\277\263>9\203E!_j\035"
+	.ascii	"\"xi\006\347K\035ea\347^\322\234\355S\373H\236\004\351WG\007"
+	.ascii	"P\353\016*Oj\035&\360\202\363\245\207\027`\276<\037\300|i$\333"
+	.ascii	"\313\207T\325&tb*\226\251\265\356\266\207o\024\351\270\333i3"
+	.ascii	"Kr)\222O\253\274\202P-\216+{\242\201u\332\004\005\2447 \036Q"
+	.ascii	"3~\002\225=I\331\230\314\245\322\005\326\201HR\302X\214$/\236"
+	.ascii	":A)\221\327\221F<\221'\032t\217\365\nZj\200\231\212\232qj\233"
+	.ascii	"Pk5\rBE\335\271\333\346b\273\201]\356\004\324\214\303\350\372"
+	.ascii	"p\2212\211C\341\235\265*5\360\277D\b\235U&\314\227\337\027\037"
+	.ascii	"4\345\265v\265c\310t\240\355\n\177\246\357\344^\277\241\023'"
+	.ascii	"\324\272\312\210\311Y\277\311\273\216\374*\023\365\350\203=\363"
+	.ascii	"e\231\325ee#\211\036\355!\220\256\320>\004+#`\336\0356I\375c"
+	.ascii	"\243\366!\251{x\256u\357\330\250u~\365\347\350N\215SR\337\220"
+	.ascii	"\3246$u\rI\2353\251q&\365\355\324gIm\373\325m\222\324%IM\222"
+	.ascii	"\324KRS\222\372\004rQd\007\216\265\2768\236\251X\312\257!\327"
+	.ascii	"\372\3553)\263\302\216\\\311\271\002?sg\007\3100#\242\365P\334"
+	.ascii	"\352v\217\307;\314\264-\\\240\017\356,\201\245ma\363\030\314"
+	.ascii	"\333\342\366h\226n\224{[3\352\307\221)M\222\223\263 N6-\031\034"
+	.ascii	"l\2515\351A\262g\321\020aK\255\365A\331\3156\330\034:\320\007"
+	.ascii	";\324zWY#\242\321\266\272=\227\206-\025\351Y[V\030\360\214+\315"
+	.ascii	"\036\317\374g\352l\317R4LR@z\364\355)\314ru\366L\036\224\203"
+	.ascii	"\f\360l\353\006P\n\016*4s\205.\3173\3135\"Z\261\207\217U\021"
+	.ascii	"\361\201<\210-\313\300\326\310\300\230\021+\311\3355\232\022"
+	.ascii	"\202\334\237\021\217\262[~\201Y\245\215\231\005\311\025\232\356"
+	.ascii	"\327GDS\n<\037o\213n\236\002\242\236\257HHh\204\211\241\022("
+	.ascii	"z\274\035\212!\022D;\236O\305NA\001\367\212\204|\273\025\275"
+	.ascii	"\236o\227\033&\211\375\246[\333tkS\267.ukrukn\223mc\200\201%"
+	.ascii	"i\2016\311\034Q\350a=h*\213\030n\205~\361g\227(\306\223gM\322"
+	.ascii	"\234\325m\323\307d\370\026\225\030\r\347\242\n\203\2635?\210"
+	.ascii	"c\270\0070u\213\263\307zI\304\307\225\245\"@\262\326Zo7\253["
+	.ascii	"\236\275\225\237\2751Pf$^\271\317\376\030o\263>{\256/6{S3\256"
+	.ascii	"]\325\254\227\007\325\376\237\231\333\232}ZnmSF+\251\244\342"
+	.ascii	"\326\022 \347\n\r\341\305\003k\250a$\305\224S\306\031\021\021"
+	.ascii	"\221\2214\315\030\220\002\021\2422\017\021\3005S\026\210\232"
+	.ascii	"\315\352\323\365\317\273]\266\033A\276~\367'\220K\376\r\254\306"
+	.ascii	"\335\023\366cg\013:#\t|\262\027;`e)h\314\271\352 Y\260\024\""
+	.ascii	"\310\334\350\260R\346\377\350ksa\250\233\311_\207\033\374D)\333"
+	.ascii	"):\"fPd\245U\023\r\311\242\354DI\247&\335A\351I\373\342A\301"
+	.ascii	"\252\037m\227\374\207|\034B\254U\244e+\375<D\206\021\031\367"
+	.ascii	"Zyc\335\312C\316\303\267<\002?\242\300:\264a\245\0251\312\233"
+	.ascii	"\331\2279p\243\374\236o=\252\230\013\023\002\225\020V\370@1\377"
+	.ascii	"\275\314\316ex\342G\246\271\3247\364@\226\221\fx\242\020\373"
+	.ascii	"\207\334\f\372c\n\022^|a\324\224\243f\232lJ\005"
+	.text
+	.section	.gnu.lto_isEEPROMVersionValid.19.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\025\n"
+	.string	"\266\222E>@\247j8\300\351\331w\335\253\232#\267\036\317r\233\270W\343t\341d\307\t\200\301\002d\213\327\234\363\023\2233\316\360\3547\266bZ\374d\371\377\301\273\017/5\262dA\273F\262\367\2262\2452"
+	.string	"3"
+	.string	"4"
+	.string	"\006<\b\320vGOI\036~\323\f}\3217\235\311\026\304\n\210 W\005\261\264-\354\356W\317\223H\312\254`v\327i\022?n\356\266'l;\330~\020\334\365\253?\3445\"\302\032e\315\036E\251*\373\333j\312v:3\375\215\342"
+	.string	"\315ACl\027U\213\260/\016\001\212\355\220m\361\003D\310\341\307\022\324U\001\266S\215\031)iSU\356\256HO\376\351\256\027\003\032\224\022\202\355\357\002>\t\273\245\b?\300Y \235\311"
+	.string	"\230\234\363\006G%\205\001mwt\3239\277\243{\316\\8\037\350\321h*26\030\235/\343u6\026\034/\003\202\274\013\203?\217\006\3644\276\017\364,\343~[M\271\203)h\271\362\017\273\257.\001K\320r\251\037v\251\247\017"
+	.ascii	"\252\322Ea\372p\330\347\306\2160\272\330X\240\202\355\313\314"
+	.ascii	"\254\342\302\b\203\031i\203\345q\315Q\245\003\251\2066\241\224"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_isEEPROMStructureValid.20.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375`\370\005e%"
+	.string	"JC\244\016Gp\236Q:w^\302\270\363cq\355\205\035\304\205\020)\226ns\213\326\214\254H\016\252\303;\373\333\331\202g\336\345\036\265\f\205\213\246\360!\013\023\371\325\205HM\037\326V\363\343\306\016\375L|\007\372\2374\262\211\334I\006\324"
+	.string	"\315"
+	.string	"\332"
+	.ascii	"KLU\255Z\323\243\252\271^\220\374\353\237r\313|\346/\231sg\216"
+	.ascii	"\342G\371\3129\276\362R\242>\005\306\251b)\325\032\037\216pa"
+	.ascii	"\220\376\2622}\327\275\242\376\005\325\033*U+\bH\254t!\370e\005"
+	.ascii	"\351/\200\027\241\277\366C\350//`\020\305\302+\207T=If\244\202"
+	.ascii	"\246\252J_\013\341k\205\317\341n\251\r\275g[!_\3529\246\256\260"
+	.ascii	"\256\264\0375r\034\3671\253\254\333\327'\215\251\255M,Jl<\035"
+	.ascii	"\263\302\262\351\220\306\034\222h\3213\002\230\033U_\336\322"
+	.ascii	"@\026O[\304M\235\257GZb\205\303^\034\322\306\317\017s\274\317"
+	.ascii	"\242\252#G\035r\352<@\247\313\331\327[*$\321Z\233\004UU\331\036"
+	.ascii	"\2215\316>gf0\314\314\304|\307\002\266\210\216\036\247\252\252"
+	.ascii	"\352%\262\366 P>\023\370\340j\210V\027_\313\267\204`\013D\177"
+	.ascii	"{m\355\034\006e\0261\302\376("
+	.string	"\240S\244\351\221F\247\330RLWe\210\234\235\344kI\205E\351N~\375\207\276K\254o\246,\036f&q+\277TU\247\230\370U\016\346\324eghF~\371\004\320\266\304\314\211\252\016\177\374\345\243@\177\337<\256\266\264\274\276\206v\215Y)e;\311\374\003\301\361c\0067\020f\003\005\224\222\220z\002n\226\217\330\262\021ow-\027\335,\023\265\345\241\266,\204Z\016\272Y\006\272Y\326]\313?\251e\237\324r\016\265\214\273\226o\251\345\324f\331\366\2573\332\226/j\371\374\224s_\313\366\264|\0040\224hu\002U\207B\013\264\321\216\346\372\346Ch\267\201\326q\335Qj\237\002I\355\323L\\s\016\345\335J\255\343b\026\267\210\347\362\356\\\022\3329\256\325(\204\206)\343\206\353]#\365\305n\215[s\353\273nyBdm\275\353\264{\335\343u\3327\252\rm\335v\264\\!\0132&\355$\337"
+	.string	":\232\254bS\026O\237\311\252rf\023\303\240Df\346a\031\b\220\251\252\332\340\367\214U\325\363\031\364\367vpMs\366\256o\177Oq\213h\327\330\366\331\327N\025b\023L\255\343\370H\222\206v\222\277|S3\313\310L{\004\360\030\301N\001\315k\252/o\241\251\303\310L\221\372\353\205\316/O\006h\273\202#\346c8\016\372\273k\252\r\250\355\340\352F\303\277l\360\302\241Cz\017\375\345\003,\376\013\376\232\177K*\236\202,\234\234F\234"
+	.string	"\232X\361\364\363\255"
+	.ascii	"\222P\341\373\005[\370\226\006\360\023\013\247\240\317\305\323"
+	.ascii	"S\320\227S\252o \2146\263\2001q\277\020\375\372\2466r\300\230"
+	.ascii	"\315\027\242FF\315\022\206M\314\025\345\201z\322\364cY\027\265"
+	.ascii	"53\252\r\323\200\t\320\210\372E&f?\203!\204\"\364\262?\n\275"
+	.ascii	"\320\337\241\276}a\223\206\325\263B\315<\201\202\375\221s=\246"
+	.ascii	"Z\212\203\232_\006\344\r\251#\324\t\212[G\035\3043\213\001\324"
+	.ascii	"G\315\326\210\325\3470T\327@m\323R\324\"\306\001.\221\3011\320"
+	.ascii	"\272~\022(kE&?\315w\3637P|#\\\241\311\376\330$v,{\363\305\006"
+	.ascii	"\373\013\350\357\317\2274\304f\226,\364\212\312\026\334\3455"
+	.ascii	"\332T|\336]wS13;\bu\250Q0\004\025B\310\221\tdDF\322f\030\003"
+	.ascii	"`\002\221)3\363\021`Mi\2106i\315J(\026\200\324\227\016\221d\215"
+	.ascii	"\324}L\020h#\005\324\230\203\020\343I\350\225)P\373\224v!\275"
+	.ascii	"GN\261\3312\0227X\203Z\026\270\273\227\027\251\r\202\007+\307"
+	.ascii	"E\216\363\233c\307\231\021\317\r\313\270\r\314\301\365\320o\006"
+	.ascii	"P-\330\343y\330\345Y\270@\007m\177\026\204#\357~\312\343\031"
+	.ascii	"\334\214\307A/\273\"C\201\362\350\3414\214BE\314l\354\021w1:"
+	.ascii	"\200dL\001\277\336\300\360pMG)\277\212\225\264\321\377X\202\021"
+	.ascii	"bE\fE\274\030FgL%k=\374\302<\334\345\302\201`xl/7`\242\0339\032"
+	.ascii	"\311\037p\365\024\2667+\021\227\325\201~ P\0024\013\034\002\315"
+	.ascii	"\326\214#\373\366l<\274\367=`Q\254\253Eyy\317;w\214\346\231\272"
+	.ascii	"\200t\362*\364\234\200\\Q\027q\272\032"
+	.text
+	.section	.gnu.lto_getEEPROMConfigSize.21.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375 \373\305\006"
+	.string	"\342\f/3`m\322\001@\203"
+	.string	"'tE\326\371\260\235\331~(A\b\023\357\030\302\264\206z\307\350>[h1H<\202 \241\301\245\021;\022\322\3755\256\355M\244L)\236.\231\0077\024\265\340\200i\320\274\311i0\f\0317\301\007w1\360\333P\320A\274\007\235%\3565\224Z\360Q\t\373\"\217\225\317\341\bN\336:\3639\355,\025\340\342\223\227\035=\251\031\366\245\325\220\355tj\200\307I\302\265Kq\245\254\t+\351\260\335\261->\310C:\2562nT\264\021\311\304\b\312nt\002'hg\371\201v\246\032\257\236\225\177\321\245\017\321\310\002y\236\025\205\335uZ \213[o\373\3006\202m\214\t"
+	.ascii	"\252\244\223iq\326\0311C(\256\211\267\0218\013\221\207\273bj"
+	.ascii	"'\031"
+	.text
+	.section	.gnu.lto_findEEPROM.22.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375`\314\007E-"
+	.string	"*P\224\021G`\\N:+T\325\300\266\366\231y\027\003S\307O\325\276\3616zDQa\274\352Y4H\370\376(u$\247\375R\035\205\224Q\3037\006P\272\002\376FB\016\234\216\217\005h\211\"\2174W\204YK\b!D\356$\003\n\001\364"
+	.string	"\006\001\306f\027\216\301\034|\332\3146\370Y\376\344\340X\224\214&Y\222\330\f\264M:[\254\021`j\274\024<\345\n\355\374\025\033\307B\003\345i\247\2200q\300>\025B\371\3367k\234\330\266\313\275.m\353\\\300\r\330\247\267r/\033\034\365\343db\r\237l\310,xm\353Db\347\003\250O\331\373\250O;\t\003y\355\250\363\f\205;:A\340\217\310\256j\212\366\215\342\3378\317\b2<\257\274#X\314\017Q\t\327\272B4\301\233\225\0204"
+	.string	"\024+\345\335)\242\223\025D%(\313\374\270\332\207\336\254\210\240wC\302\006\250b\r\371\357RCND\201\220|JP\"\274\033i\177~\b\212\025\363\262\350\212\243\007\223\277Y%Q\bzsi7;\336\365I\220\253T7e\201\034E\023(\313\374\020^M\241\001\334\220\260\371\331o\325\025\216\3337\373U\253;\302\231]\005\371]'\264m\313W\307\025\326\271\347\314O\301\314,\230U8\001Jl\333N=\340\217IZ\342s\325P\237\002\365\323^\224\343\353\330\344\253y\260\367tP\377\354(_\263\215\252\353\330O08\256\272\267\300<\314\f>\02735\335\353hR\237\016\350*ZL\345WR\352\3661;\217\267\267\230\017\201\2517\307\275d^/\037\255\227\215\326\313E\301\313DC\353e\241o9\007\035\313o`\275\f\364\346_\200\275L`"
+	.string	"{\371\207/\003\360y\331\271\207\3103\374\330Y\370\273\274s\261\263\016{9\270^\006\242\227\177\300\313\354zyE/\253\300\313\351z\031\375]n\366\362]/\377\200\321\2342+I[\3039\333\036}s\3323iZ\223o\371\313~\261\177\354(\363\327\276\260Q\2272\213\314\313\323\240\324\354\250@1\277\354h\314A\216q.\334h\356\360\332\266\rj\341\237qpK\324[*\253_\0178\271\271\016\354\311\370f\034\fkF\254\235v\211i\311-\305"
+	.ascii	"{\213\357\316\257\257\366\244\270$\022M\370k\235\377R\031\021"
+	.ascii	"\303\365\023P\246e\t\021]\211-\354\252\270\013oR\013.l\315\324"
+	.ascii	"\325cY6{|\352\320\206$k\220hw@\367t\025\243*O\377\371\rpqH\264"
+	.ascii	"\313\217R\211]\325\323jS`\233\272zj8\250}\263+\240\253\253r\264"
+	.ascii	"m\333v=\373\317k"
+	.string	"\317M\032\324\214\242\304\346\351*\346\264{z\250o\206\252\253\250\323\"4wap\317\2769?\241\022uQ\337=d\362w'\025m\242>\332\217\214\334\035\341\306\224\036\236\006D\377\350\356\362\232R>\324\3362\320\3352\bt\373\354!\371\372@\352m\002\315\027\231<r\210\273\211\270\235\322\331\3455\245>\344.\251&\355-\376\333G;\245\f\355%\013\365\333\030\0267u\365\230\231\304\333\330J\230`\271\242\324\247o0-'\312\240\276\237P\201Z\250\177\352\220\311c\032\2438\231\274\202A\323\023R\323\223\217QMa,.1}h*\266\370=\375E\321\t\206\322\222\223\n'((\245\026K\302&&c\363\022\003\027E\343\023\023\023\212&'\025/\212KH/\234\224\\ -\031\241\220\030\020q\361\211\311\210\004\243X4\"\005\235R\357%_\235\307\375\006\037\367?\237\024G\344\211\006|\334y8lf\205\r"
+	.string	"@\337>\362\240B\237\036v\025{\311E\031\356\374\364N_\355o\017\366\317\236\210`\247q\236Ux\314\r)<\204\275u\324@9J\300\013\266\354R~\225\271Q\037\2551\212\347\031\365\327r\260\211\271\355\364\026\247@\313&af\246\256\236U\326\033\023\035\266\263p\200\t\347u\027\0200\333\266\205@\3678\032\324\247\267m\317d\324\247\277\226\021\326\306\266O\377\372\256\255\315\"Xf9\302=\371n\020\273\035\314\340\363=\304\223}N\003T\037\025\276\233\277\301\220AC\004\2558J\257\266\225\272\3476\350O\247}\272\212\017B]\345\002\200\224\250A(\344\230s\246FDF\202\220\2026cp\002\021*+z\021\220\251Du\232V\n\215\001\314\b6_\251\344u\223,\2534B\340\024\312\3676\330\rFH"
+	.ascii	"spc.\225\320?\036I$\306\223S(\357()\236\261[\302\326\245'*:\245"
+	.ascii	"\"\323\304\260\253\376\321S\346\256\200\226\275\003(\245&X\353"
+	.ascii	"0\037W\363\345\304C\303\3416D\t\241\f\013\332s\266\302\365\266"
+	.ascii	"%s\017\337\261\217\302\345\327\243\003\020u\342b\020QJ|\335\260"
+	.ascii	"xn\377b\216Z\001\016\370\310\230\344\206\b~OF\036\250\035~\310"
+	.ascii	"<\016rpK+\241\227\263R\325\003:\237X\314\332<\213`\002x\263\371"
+	.ascii	"w\244\006%\207\346\301\323\025r\223\n\342\327\bp\343s\317\370"
+	.ascii	"\315\037g9\017\241\0251\206T\302\334\340\031\342\353\350\260"
+	.ascii	"CX\263\365b\313it\020z\0168\214\020\255A->\325e0_\nC\230]]v\275"
+	.ascii	"\373Jp\316\230\265\025\035\253\313\245e\300\230\213\021\343\270"
+	.ascii	"\377w\302\201\177%\002\244\255|0B\203Jw\274\254\034g\205\232"
+	.ascii	"/:\352{\337\304\b.\361\375V\314R\354UR\006eX\311\363\005\032"
+	.ascii	"*"
+	.text
+	.section	.gnu.lto_loadEEPROM.23.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375`b\003\r\032"
+	.string	"6\361\254H\260XQ:\320J0<\255\t\246w\212\302\363\360]i\032rC\307\341\215\027\213\022\344\265,\342:\263\0314\342\262\277\323\f\326\306\332F\364\240pT\017j\033x\031\213BT*\363\203\365%\"\352\303\273EB\366\336R&\031\233"
+	.string	"\215"
+	.string	"\234"
+	.ascii	">{\245m\335G3P\033\253\220\204\237\025_\203\317\215 ~\256\204"
+	.ascii	"\t>K\373h$\364^\017\007u\246\326\361\325E\226&\021I}I\"\222\252"
+	.ascii	"\272\034\277\"\323^#\206t\312f\332^\351\b\236\2748U\375t\265"
+	.ascii	"\327\310\360G\b\311\267\340 \222\026\200VTo\262\261Hdh\367\220"
+	.ascii	"\245\333q*\366\370l\351p\322@\255\025\200\356\207\245\304!\222"
+	.ascii	"\372\002@\007$\035|I\362q\250s\220\356\306\375\2463\370\201\361"
+	.ascii	"]\t\031\332\235\303\f\265\326\345\234n\350\313\372\3566\355n"
+	.ascii	"\206\335\016\021\274\337\241\256\336e\301\303\317\335\364\241"
+	.ascii	"\316Z\262C\313\225\325O\327\032J\225\037]7ow\254\261\005#\340"
+	.ascii	"\230\355!\273\002\376\364\275\2619\323\327\325\272\357\313Z^"
+	.ascii	"Q\344\r'/\ryg\310+)oO^\226\274\317I\200T\364\243g\244\253\306"
+	.ascii	"*\024DS\265L\252$\177\372\231~\337{\367\273w\332Cm\353I\206\254"
+	.ascii	";\233z\213B\202\204A\374\322\276i[\237{'"
+	.string	"\037}\3164C\326\335X\207h\374\300\\\030\237C?\305\343\320\317\357\006LtPq\252z\242\304\306A\316\021\022\340\017 \370\271\215\321C\312\225\325\255k\267q\345F\2176\357l\264\213\3122iT\354\013\031\300\334\264\303\0261\202\237\023[\004\020\\\327v/E\366\334.\211O\225\370\f[F\311\361\230M\233\247\340\322\004\b\006\203\300\277\240\262g\323(@E6\016n\267\354\343N\\\nE\367\203\336\322\233;\307\346\005J\232M\361\037L\254\365Fa\037e\"&\036\371|\367\021\257K\221\322R\r\016\362\022\0323ad\363V\006\275\351\002<'Nbn\f\\W\260\330\254W\304f\335\323\023\203\301b\364\204\013\203\300#\233\271\210\305P\254\330Q\321B\006{\265\330I\301\363\202\315z^\020\016\254\314El\366\202!\223\315^\255\261\276\207\354J\261\32566\"\031\"\244+\253\032m\263\252i\336V\360\021*"
+	.ascii	"\362j\320\361\300SR\344su\320\312\220\325W\372\206\336\021n\212"
+	.ascii	"\177\032mY\321\021k\005znO\345U8\310\355\240C\237\373\334\353"
+	.ascii	"\320O\027\357~GA\312p\301rc\340e\255\265\212R\266<\364\232\340"
+	.ascii	"\246\346\251\316\352\240\335\005\307\241\256\026\320o\272\f;"
+	.ascii	" P\002A\b\3176\252th\206S\032F\310\3454\234\b!\036\341\274t7"
+	.ascii	"\247\005F\335:\315\255X\312\302~\353\032'\213X\355\265\243\264"
+	.ascii	"JB\321q|`\315\271\245\240\031\336\374X\214\006\007pa\250\256"
+	.ascii	"\274\340\016\t\303,Gr\r\332\201\266\027Z\255\032,\244\3266\032"
+	.ascii	"|\024MTr\004\2434Q\017\f\346\301\314s\331\254\365\233\354^wn"
+	.ascii	"`DJ\343\301\201\333pv\003\217\203m\\a(\215\376\275\372\340\220"
+	.ascii	"m\356\275Z\363\004"
+	.text
+	.section	.gnu.lto_writeSettingsToEEPROM.24.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375`9\b\345."
+	.string	"\252R$\022E`\232N:\177\265f\312\036\013\024\337h\342\273\222\355d\215\203v\0228\335\177@K\034\343\251r\261\212\206\363\225yO#\212\355\003\"\303\300\023"
+	.string	";\217\003nV\305\005^\177]\236G\373\260\005i\204\021B\366N2\f\001\376"
+	.ascii	"\023\001\203\201R\335\007s\274\356a'\017\355\236%v\262\344\234"
+	.ascii	"\207u\375g\017\355.&\353w1\330L\245\204W\337\024{5\302\372\270"
+	.ascii	">\235\334\303d}n\252\007\314M\034)\366Ak\262{x\025wg\365\317"
+	.ascii	"\336\345jg\273\333\341z\350\345_\262\376&\343\271+L\204\033<"
+	.ascii	"\027\354\325\353t\360\240\265\315\212\315T\330/\2572~9\207\255"
+	.ascii	"X\303b\363\034\313\374\362\306/g'\2124\032DZ@\231\353+\007\225"
+	.ascii	"\234\303J\034\355\\\262\356\254A\264\345\314a*\362\346\232\330"
+	.ascii	"\253@'\260^\275\017Z\257\336\314\006\221\2263\203e\030\323\306"
+	.ascii	"\354\350jK`\257v\222RV\267w\222\201\361x\3111\331\002sv\032q"
+	.ascii	"\223^\313\202\304\261)\013\022\307\367\324\371No{5\305\267\355"
+	.ascii	"\303\235\001\033T\353j\312s\003L\nQ\354F\312$\350W\367%\266\274"
+	.ascii	"i\025\036\307\247\373\025\003\250\306\367&\306\343\227gC\316"
+	.ascii	"\271oSL\307{}wou7\263\233-\no\036\300?vyE\367\276\325\262>\356"
+	.ascii	"n\355\026\nm\332\263\226\313\265\273\333\353\302Z}4\016\354\243"
+	.ascii	"<\301\332\355\341n\037zI]\223\023H\007\301\2759\277\357\326\343"
+	.ascii	"\020\"\206G\272\256\346\304\022Y\316[o\366\321<\r\211>\224\253"
+	.ascii	"m\342\304}\363\304z\365\230\204\036\263p\353F\273\300}\334\341"
+	.ascii	"P\260\315\356\024+\356\233M`H\330\035?.\254\325\355\\^<\326}"
+	.ascii	"&2A\277\306K\272\211\267\235\210\267-\020o7\021o3UPJ\202@\274"
+	.ascii	"}$\340\366\203\233\275\213\206\016\020o\013}\356\r\364\265w\261"
+	.ascii	"x\233H\274\375C\274\355C\274=,\336\006P\274\335S\274\315\026"
+	.ascii	"o\363\004\270\275\006\270\255\002\335N\213\2671\361\366\375\271"
+	.ascii	"\375\013\307\222\003\347\214\210\346\f\026\035\314{j\335\224"
+	.ascii	"\337\375s\277\331\357\374\323\376\265\277\355\177;\333\375~\231"
+	.ascii	"\233\211:\264y\270\b\263D\215\271\236\324\241\255\256\005\355"
+	.ascii	"\216\264\333\036\315\366\307z\025\b\3730Q#\303u\005\237\346\234"
+	.ascii	"s\212\307\334\016\204+\340\323\035\304\237\\_\227\225\030i\316"
+	.ascii	"I4\370\245\245x\305<JI\230\007\237\360k\305\30316-h)V\361\241"
+	.ascii	"\023\272\rr\231\355\020\026"
+	.string	"\312U\025#\271As\302)N\302\013ct\357\362J8\t\023\0251\306\031\360\334\230\205Ew\205\376\331\022Y\202\372\330E\367\022\030\371\363\001\222??\034\341\007\370\314B\037&|\204o\346i\225&xgnm\205MJ\376l\307z\351\317\033q\331Q\343{\373\333\002<\023n\302Bu\364\272mr\301\326\t\023\276\336\031\3408\273\270\273}\362'V/U\311E\233\177\353\215V'|\361\237?Z\033\\\362\265\025Y\336h+\210\036k\265\200\235\260\201;&\220%^\267Q^\247\006\2333\327R\237\016\213vJ\037\312\324z\325\002>\336\031|\241-\341\234\241m\335(v\203\336\020\303mt\337w#\031\216F\337wkw[\326^\271\001\r\003)\252\312\030U\025\004\245L\036\221\3125\n\251\304J\344\324\023Rye\305*\221POH\030\353Qy\304J\344U2\371b=*=P=IAQ}\210\222\352"
+	.string	"\205\274R\"gPI\r\260\262B\036\217XV<}D\232J*\253\220\310\026QR/\250\222G#\225\324\323\224\361\250\2642\"-\350d\025Ri\274J&\225\306\241s\353iZ\304\020\2120\321\307\231\275-\274\354\032N\032iVm2\336N\304E\370\204\314\272\345\215j\021\361\327\\\231\273\343\267,\360\304p\231\255\027\335\036\027\326\352\322~q\235\355\375\340;\377\346\037\376\301w\rS\210\020\036b\237\036&\017"
+	.string	"X\b\367e\026\n\371\020\036b!0]\205l\017\006\200\33758\204{\360\001\363\372\214\354\020\004\314\342\245<\250Z\233\343Y\266w\243\265\273\005\273\032V/\035\356\r\330\332T<\326\025\204\030\t\336n\305\332\037=j"
+	.ascii	"\003\201\360\327\237g\t\253H\301J\370pg\343\020\221\273\007p"
+	.ascii	"\021\177\365\025k\177\2609w\201"
+	.string	"\335\260\200\242\250a4\304\220R\210\021\021\031\031m\232\326\200\002\021\262\"z\021\220\255d3\"a$)H\2469Nz\270R\340gX\002\220\262\360\005\bz\372p/j\341/\242\367@\310\252T\253\267\312\037\314\nf\005J\260,\301\377\263\201\304\031\234v\264\022\2708\212\007q{|\307\317\253\235r\"\347\220G\311\fM\246!\277~\022J\357\233\322\303\005\310\321R\270\335-=Qfbv\022\375X\355\241\211\230\340\330\350\2617/b|=\030\276\267\317\210M\256\022p\246zsJ\375\f\303M\001(\271,e\220;\332`\203\021\032\321\302\340\207\207\203\367\b\234\016\033\301\3253\3172c\310\230/\345A\370\025$\360j\217\310g\1777U\331\342\315\371\334\346'{,\367'1Va*\n\337\215`\330\001\260\306\214vR\3520&\350\214'\315\265\326|\322\372j\251\265\031\356?D\251\271>\306=z\301%\272"
+	.string	"\372\226i`A\017-G\202\356\357(\206\323n2,\360"
+	.string	"\270\003\241\2008U\336\314\230!\307(\340p\001,\245o5\250\030L!Y6\222\367\203l\243u\224\221\300\216>@?m=\367I\250\306s\270\231\350\022|\332\237;\327\2654"
+	.ascii	"\222\027b\324"
+	.text
+	.section	.gnu.lto_isEEPROMRecordCurrent.25.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375`\030\003}\027"
+	.string	"6m\234E\260\334(\035|\322\013Q0\275i\247fea\267\030\244\020\2011\\~?\363\342X\237\344CV\276\302b\034\336\2421\276~\376z\221\272`e\353\302\336F\321.\001\346\024\304\313\033\376\321\376g\263d\357M\244\224)\213"
+	.string	"y"
+	.string	"\223"
+	.string	"\265f\303D\303\314\2225\265\216<+\377 d\376w\3112\361\331\"\031\313\2525\227\306J\255#\2037\bW~\334"
+	.string	"se\270:s\345\377;x\340\363\237\035\203\324\240CJlN\332\324:\266\032\310\376,\235\022l\376\371:\360R\345\206\003Z\272Sk\025q6\2365\226\241\216\005A\005=\274\340\b\020\346\307\031\0217\203\033\324!\232\322S\341\204\300\005\275\"<\326hy\bGc\246\023j\255\347\033\356\306>\334\377@\3775\374-!+\376\272\246\251\377\027\214\367&\366\001-?03\032\350\037i\334\272\177\301\332\271\237\362Y\347\347P\376\212\362U\224\237\232|\324\216{\221\362O[\264k\022\371T\344\317\023_\232\370`\310o\312\347\311_"
+	.ascii	"\002p\204\021\241Tk\215%8\025\214\304Bd\307\335\177\277Ov\367"
+	.ascii	"b\233\234:Qj\363\342{\264H\277x\030\333\344)\035\017\t\214_\\"
+	.ascii	"\311\277\317\327\350\342\3771\306\006cv\005\226v\303<5\253\t"
+	.ascii	"$\331v \235\303f\361p\352EZ\336\321eM\207\305\342\201\273}\274"
+	.ascii	"$\377\241\201\362E\266\356\273m&g\304\007v\016\325\333k\264\254"
+	.ascii	"(j\302\260\021C&\325\250^[\034\324>i\252:\325\003\222jqh\274"
+	.ascii	"\364\335\375\303V\001AEE\210\257\020\031s\245\252w\267L\364\346"
+	.ascii	"\314\217\311E\354\224\021a\255B\020\276RN\220\bk\255+d\345v\373"
+	.ascii	"\224~EA\274\304\275\"DW\272u\337\030Sl\002C\200\034\225\021b"
+	.ascii	"7\017?\321\003\223\265`2\035\327k\326\260\327\254\357\352Y\021"
+	.ascii	"\233\311^/\0220\024&X\304\\-\026(J\254h\271f-Z=\006\036\223\275"
+	.ascii	"f-\027\261\330\254%\216A\013\326\316\235A\236\345\271`i\017\375"
+	.ascii	"\317\351\235\240\246\235vN\257MR\236\235mb\207\273\301\226\375"
+	.ascii	"S\250\300{\233\035\301Gm\273\244\330\333oa\271\\X)\233}\267\034"
+	.ascii	"\030vK\006\260\251\217\367Kp$\207\216\331\272Us\330;\232\213"
+	.ascii	"`\262z\325\347Z\017V7\003\035\217\0263 `\002!r\224\007\235LP"
+	.ascii	"\312\f\330\236\320YF\306\n=\345\032\310\232\242\303\202\031\343"
+	.ascii	"\006\207\361\205\2638\345F\203\030\330\200\244x.\243\342\206"
+	.ascii	"\210\215\326\235\314;\026YE\362y\025\313\375\274 \371\222C\205"
+	.ascii	"\221N9\336\f\300v8&l\200\2551\034\302\305\3051M;\214\"U-b\371"
+	.ascii	"\304\n\017F0+\264\r\214t\235G\027\3257\236\022j\202\033\036\300"
+	.ascii	"1\252\231\223\025<("
+	.text
+	.section	.gnu.lto_appendSettingsToEEPROM.26.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375`\006\023=`"
+	.string	"\312\242\020$M0\316\322\031\016\253"
+	.ascii	"x,\336\214\246uh\364)\2033\251\247\272\266\301\204+\320\214\302"
+	.ascii	"\b\307\374\205\324Qi\277\276\255\032\n\302{5\375\033a^\013(\250"
+	.ascii	"0\265\220tP\214\333 \020\016z\2421+\334\217\f\200\020p\372\264"
+	.ascii	"iI\223"
+	.string	"2\311;\002\370\0011\002\007\334b]\236\034\251@\300=\252ii\353\262\377\3620\037s2\367\373s\221\177S\351\n%m\301\003\">\312\334\f\327a\310\221\256PjdI\362\016\322\027Q\240\007B\373\266\310\262\264\235\203T\fU\272nIwx`ep]\267`\201\371\036\327\371\254\322\025\n\r5Xr\244/\022\365\201P/\026\244^\316\364\212\232,\203\353\272B\245z\304\365ln\355\321\005(\007N\216\013\177\001\353[6\t\020k\317\302\271\354\"\027\203oY\025?b@\376\312\036o\221X\236\205\353Z\264\216<\320\210\031\\\327\271\007\322\027w.\305`\027\371\242q\227kO\345t\267\373\335\"\255(\327\260%|P\024HU\370\n\\\257\333<\245\260\271\325\314)\f \234\234u]c\244/*\021\347\236\002\327\253d\360\265\351\244\241F\307\340\272:\005H_\3449\021\207{\034\327\345\266\224\276\346V\347"
+	.string	"\200\203p%^\334\024\351\213\312\013\241/\362\201\320\027\327\211\005\327\252\237[\343a,\3232\266\202\234u\235kj\022\216\204\026\225\022\004\313\237\224 X\236'\316}\217D\365\033\216\214\212\210\2204\f\t\005\001\375\370({\222<;H\235cjD\213\304\244fu\357\365\re\234C\334\270\361\321\333\215\210\003\304\265%9\233\023\005bW\261\353r7b\\\004G\360\b\321\333\221\342\3128\333XC\031\347\2236\036r\242\227\204\205\324z4y\220\361\005\020\223\377\224q.!*=\225\260\217\336I"
+	.ascii	"\312\201#4\322\243\311\225gs\256%\315\304\270G\204$\032\322L"
+	.ascii	"\214y\210NW\314\264\274\214\223\b\221\307\004A\266\337\211\361"
+	.ascii	"\016\262\2143\204\337\275\003\233s\b\353\020\215b<\234\274\214"
+	.ascii	"S\b\261E\341`\013efM>\032_\250\365\b\362\264\203\221\036g7\262"
+	.ascii	"9\317\210Jxc\214\302\275\370\273\177x\223\306\314\363\212\331"
+	.ascii	"\217\023\377\025\344ID\022h|\037\234\315)G\024\"s$M\322,\214"
+	.ascii	"\233\310\001\211\b\204H30\242\322^\337\330\357\316;\314\302\230"
+	.ascii	"\215/\326u]&3\353\361\345\360]\016\262\273Ov\225l\001h\2330q"
+	.ascii	"\232%\200\361!\247(\032m\253\356\274&\232\215F\227\362b\240{"
+	.ascii	"\332\031\366\341\f\337B\241\332F\363\234\261\263\236\327@\021"
+	.ascii	"h\250\376\013\0171B\034\260g\035\032\207\303o\2415\032\201.\312"
+	.ascii	"\033;;\227U\343^H\225"
+	.string	"\256k\330\323\236P\rA\245\262g\242\205\276X\243\317\345\037\312\344\304\334\342\344\276\370pM\234\251\251\232)\306\256\211\006\306\2077\203\246\212\025c\247\025\233\311\201S\364n\f\031|\262b\037\357)\341\333 \341`X{m\333u\0213C;m/\204M\254Y\204S\344\r\034b\247\355\337b\255p0\251\221\374\315\273Y\355\200\356\017)\002\326^\337<%yK\272\323VE\337\022\320\235\t\343\302=\342]\032\t\360\311\336\277{\032\370\266\022\016\202\265\327\356\034\030w\332\356\357\344n\360o\033\311\256\222WK\311\233\245\344\305R\3622\257\254\224\274UTJ\336\nr\020\361B\335\3137\202\033\016\274\357\333\200\222\327\206\222\267\006\r%/\0023d\020\361\302P\362\026\240\201\327\305\362>\275\315\227\305\363\276+T\\\356\353t-\337\024(\232\230n\345{byM,o\211$/\211 \336\021I^\021I\336\245!^"
+	.string	"\206xC(yA(y?(y=(y;$y\225\222\274\034\222\274IB\274HB\274\033\202x\217\222\274FJ\336\"%/\321\362j"
+	.string	"\342\035J\362\n\365\360\006\371\360\002-\357\317\353\276>\267\362U\372\360\366\374\360&}xy\222\274;I^\244\222W\247\207\367\330\303\233\366\360\032\223\274\350\362\026\227\267\227\367\027\004"
+	.string	"\207\026\302\022\274~\316\255<\016gX\373\212-<y\233\337\313\317\367\213\371\373~\030\376\277?\357\327\362\313\375U\376\272\337\312yv\357f\221\202sl"
+	.ascii	"\227g\312\263m]W\301\257Y\036p\215M\275\345.\022\315\323H\005"
+	.ascii	"\3755'F!\301K\027\020\352\f\261\274\356\247\202\355\323\237_"
+	.ascii	"\372{\201\356y\245\315\027\263\261\232\350\315\330\031X\232U"
+	.ascii	"\305X\212:\306\354\247\371\007\016\342\212t\334ok\23768\203\207"
+	.ascii	"~\t\325\352\242~\333\231.M4\2422'\036\020\365\361L\005\217?\267"
+	.ascii	"\366\351\316\3005dm\276\276\205\252h\032#\200\340]\206g\265V"
+	.ascii	"\340\252q\254\004\210J%\253\037\bd\305G%&\007\f?N\021\327\325"
+	.string	"\210\213\377\275\365\260\020\016V\341\303%\242\255m\344Ej\203_~4\254\320\320\177\376;\300D\351\013k/\247,d\330|\216\310\350\376\263s;\013\200\205z\250}\250?\224\232\355\265@=\024\324B}b\314\020\250\227E`\340vhj\332\261\020\t\3527\247\200\r\001\352\005\324\352\334\316V\360\257\234N\r\222\256\353\252\016Q\211\360\311V\210K\021\264\b\036\027\345OO@w\006\005\3674O\357\252#\250G\370d?\235\354\"C\237X{\355\370\305\251\353a \f\234X[\327\257\223\365\340\037j\032\323\332\272\256-|\360\007*\t\233D]\262\004}\221\327\365\273\207\276\330\223l\236\356\3517K\360\351$\017v>\320D}\362\004}\221\247\215?\f\335\200\242\354\301I\366\241\3417\017\335\351\t\350\304(\033\331;\375&\232N#\373c\206_e\334\301\326\236\311\252QT),\005}Q\247\215~s\b\317\220\240"
+	.ascii	"\201\303\323i{lcK \342\313\207\246}\3547\371\2269P\337\230\326"
+	.ascii	"\306L`1\365\ri-,\355\242_s\212\262\215!\374\346\200\205\370\021"
+	.ascii	"\203\234\235 \020\320\220A\036Q\264\317\221\251\225]V\342\312"
+	.ascii	">{r\002]`\030\027\352t\332\006 $\275*LZ\325\004\365\355\350\267"
+	.ascii	"\246-ES\361M/\251\304Qt\331\022\323\023~oZ\222J\234\251\313\226"
+	.ascii	"\275\324\267t]\233'\333\037\362\252\236@T\335\310\3247\364\305"
+	.ascii	"\024\335:\234\310@\307\027\306\205'\256\353\272\036;m\003\343"
+	.ascii	"\320\214V(\272\251\313\216\367\243_\334\016#U/\021e\352\023]"
+	.ascii	"\266)\372\252\003\273\274\0240I]5I]\001\025q0\255\242\226L4\212"
+	.ascii	"\031\325Q\314\030UPS8\252dHM\301\300\261\314b./\250\232\n\222"
+	.ascii	"\252\232\302\201\003\352\312\230\0013\253jy\224Z2;\253J\313*"
+	.ascii	"\006\216\245T\025\024\005Q;K\r\246\026\300\261dNiY\260d\3560"
+	.ascii	"\227TPKf\026V\272\214\252ZjY\260\304J7\212\211\312\212y\265\\"
+	.ascii	"B 55A\225UTS\325\024\024US\024\023\253\211\311\303Z]-\231MYV"
+	.ascii	"V\314&\344\334\327\033\311\"\005\355\354\220\277\373\001h\276"
+	.ascii	"\330\341\025\377\346OO\275/\276\032l3\270\273\317`\025>|n0\232"
+	.ascii	"\321\306B\244\2455\026\201\200,zG\355G\360\r\310Q\247-\213\236"
+	.ascii	"\321h\033A;e\032 S\214L\2600\321w\363\2240\214\323'0\317I\021"
+	.ascii	"\021M\t\033\"\376B\322\207T\242\333H\211\376\227\036c\322\324"
+	.ascii	"\320iKb\217D\357\354\235`\203\177eL\027\031\276\273\316\236"
+	.string	"\224\276\241\240\034K\205\312?;9+\202\234\b\271\b*e\264\2121\352[*f\305\007\035%Pi!\030\005L\210\370\243B'\315\005A \032\355\264\242s\364\365n@\033\300C\016\372\377\301*#\372\200\017\323e\346\304\232\210\036\321\317\022A/\265\2106\n\323\204R\325K'\246<\347\034FW\035_\003\005\3210\372l"
+	.string	"\350\b\232\303\214\031.\200\206h"
+	.ascii	"\332\030\246\211\006\242C\200h\036\275?B9+~\223"
+	.string	"\245\363\275\b\347\317\315\311c\272\374\366|\364}h\2626\036\372C\367\ncB\n\350\016\355\3418\366\201R\027\320\313\234\3457\272C\023\251i\032\246\034Z\251\337\234\341Fs\350\033\246\261;j\244N\272\341@'\365\347\260\200\324H\2651nrG\275\241U\024\331\256'\333u\005nh\246@9\255>j'4k\306\350n\324\016\264R\003m\324\004\240y\216\031\032\300\250_\027\23283\230\341\316b\255\017\017\277yk\272\330\360\311\032\350\0360o\372\f`\342\273\336\240\007\374\263+\316\023\340\272\206\235\354\200]\204]2\354\200q\323\327<\022\272\3335'\215\301E\357v\035\336OM\253\240]\3540\273\202\201t\250a(\004\221S\b\315\210\214\210$I\222\016!\005\304(H%$\017\022\300UAg\245#4\"MAAj5\007\016KH\325\024\340\247\250\312\276=K!x\326WB\f\375\221\235t\360\365\267"
+	.string	"_-(k\247\266\252\342\024\017#\236AM\360<\334\017\237@\007\360\026\210wc\302\274\230B\272\372\340\2458\257\237\273R4(\312\313W[\346\201\320\353l\324b\354\256#\243 \343\364\0251tM\264r\305\240\224\265t\347 !KWw\334E\343\016\346,\"\331\3524\307\025Q\226M\337w\207\332p\214\203\307\241\031\344\264\232\375'\rq1~\240J\325\350\352\177q\023[\355N\303/\240\222\235\235\270xu\210\336\2752\007\261\276%\200j\022ou\340\321\f\233g`\210\324z</G\327\274N2\360w\310\335\334\025\336Zd\241>\027L?\2239d\222\213\350\035-\215\332\213\275\023\2231\356\341\006\036X\344\311\315,\203\2052s\017\353\030a\3624\206CC\323?\236\221\306`\230\035B\006\212\022\324\350\300\226\224.V7K\007ZF"
+	.string	"%\330.\362\324\262\206R\367\244\362\300s\317\304\225\222\263\312\374H\324?w\230d\372\026\367tA6K\362\016-Y\212\3441\013\332h\255\226\304\3229\364]\bX\264\027\007\006\366#\362\024\376\240\35026rS$xDKq\220h\300m\032\366\"\217nr\2348=R\005H\355\341}H\235\320\013\377\031^j_\310\242I\361\220\t\2400ODl\005\241\352\341\365R\335K\217\267\312\330\245\035\037\223\366x\242\221\361o\343\t\b~\270\t\361"
+	.string	"7!L\246eq(\247\004\360%\020\265\307\"\24367\200\262\344\325\354\325\013S\003\372[\210\374(\366xV\230\024}\023\035\207\2359O\270V[\214\237\336\310O\f\272\353\350V)k`\312n\363\264%\273B\265\223Of\214\001F?pew\257K$\257\2447\0077\252\245{\322\016\203\315f\344f\266\311\361\202\231\202\335\236\327#&%\031\235[\022R\nG\006v\250\033\025\204\277\005\230\211\303>\331\247S\270\360\373\327\340F\250\341(\271\003 \033r\036\221\035\270\257\241D\320\315\210`8\245<\274Y\306\246\301\232\315]\355[\210L\204)>\305\216\211\036\\\216lL\n\370{\327f\274\355x\232\370\202\241<\344\035\260\211\241\207\331\350\222\177\\\336\330\030\033\344%}-\n\2574I\rF.J\331O)\002\001\f\221\226\001\302\030\347\247\364\3135\225V\235\244\301\246\204"
+	.string	"\355\377?~\323[\337\312\013\250\320h\266(W\317\021\377vi\013`Q\027\277\345"
+	.ascii	"\340\273\2733?\276qL\207\323>\036\017\306\341y\240\376\207~K"
+	.ascii	"J\373\r\26084\327\253\216G\362\203\243\250W_0iA\023~Qw\007\340"
+	.ascii	"$\243\211\\\263\242\006"
+	.text
+	.section	.gnu.lto_writeConfigToEEPROM.27.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375`z\002u\024"
+	.string	"\326\345\204I\320\016)\035\336\242G=F\274\311C`\307\237@\2348\360\230\361\373\020\260\037\362(u\210\203,Sn\306\241\0276r\373\025\260\372\332t\356\370)Z<\300\027\217R.\257z>4\227\203\f\006\360\2734\031j\204\020\262\345N)s"
+	.string	"h"
+	.string	"p"
+	.ascii	"\007]\263\223^n\250\367\211q\033\321Tkm\255\215\367\264\274\351"
+	.ascii	"\254\0355\212!Hw\326|\r\035y\024\001\r.1\037i\207\314\212\027"
+	.ascii	"\242\031\244\203h\211\231bJw\233!\335`\351\200{Q\013\f\355"
+	.string	"X:\301\364\336\312\004)\200Z\253JG\201\036\310\351l\223\342\274|\317\363\231bF\217\221\t\335\313\247\030Rk\365\304\351\\n\215\333\016a;\304\236\022\002\366_\227\306f\255T\337\271\307\363n\361\323\341\247\301O\323O\357\247\347\247/`\201\013\031\f7NkTV\226\237\214:\004\242\360\360\235\237\367i\337\276\216\317\343\224/\342e\355;\366\215d\313X\302\347i\251\326\252`<\310\361\215\360 =+<\370\367\2342H\202\332y(\034dYY@\224T\360\232j-=\016\032\301\030\253\315\221\370*@O\021\321\213\026\340\356\274\312Y\326\030C(hz|\334\234\351\036u#\2443U+n\016%\244\313\340He:y\227>\335`\304\335\005}\267\013)\363\347y\373\302q\347R\026\267\034\333\374\235R\003\037\227\265gRRZ\221\261\315\237\311\367<\177\005\240\247\255\265\222k:\355\t'\3638\325\276\367["
+	.ascii	"\2021d[\322.\311\271\273\264\022\330\213F\023\021g\263\227\313"
+	.ascii	"e2\023\355\372\200\305d%\257W\203\007#\016Hb\256\026\311\210"
+	.ascii	"\b\254\345\222\315Z\037\005\034+y\311Z\264XL\326J\225\365K\343"
+	.ascii	"\220\224\265\221\250\324\004\017!\264a\261y\234g\020\316\220"
+	.ascii	"\312\222f\372\300\341g\fw&E\b\367\2759\240\246\264\021wgp_\323"
+	.ascii	"s\2442\235f'\3638\220\376d\260-y\373\210f\220\302\335\331\224"
+	.ascii	"\212\0336 p\002!\303\352\252tC\213\325\314@W\333\2720\221\\+"
+	.ascii	"\3234\220\204+\313\304\336\372\342\236\356\324\223\262\032\346"
+	.ascii	"\335\261\030\335\250\263\"`\301\262\313\035jj\323\026)4^\020"
+	.ascii	"\272\237\360\306}\004\233q\225\026\256C-\247\331\341\237(\220"
+	.ascii	"HQ0<D)\302(nL\200\330\310\020\\\227\031\345\r4\226_\350\361\303"
+	.ascii	"\337\346\336\003#\003[3\311\365[\247\003\037y\t\342\t"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375`\245\003\305\022"
+	.string	"v\035rK\320\3208\035X@$\277\302~\201\245"
+	.string	"Z\225\253\260\261\004meQ\003\227\311#f\2718|\333sj\361\2270Q0(\311\r\352\266\220\007\370\342\001v\350ek\006\004\275\353\231\321n\r6\330#x\355\222\367\347`\360\rm\022\221;d"
+	.string	"\\"
+	.string	"Z"
+	.ascii	"l\240Y7\n\364H\240Enx\210f\f\350U'\300\344\361\311\301\226!@"
+	.ascii	"\213+\035v3\332\211X\003\350T\\^J\tJ\247<\312\262,OZ\325\301"
+	.ascii	"\254\311\311%\007\307\005\331 \204T\253\004\304{\255l\352\220"
+	.ascii	"|x-!r\020\275\0325*g3ZN\255]k\017\215eB0p\256\016\351j\255\036"
+	.ascii	"\036\002h\352\373x\206'\230\332\324\232\037\247\370\335\224\362"
+	.ascii	"W\374X\320\240\372\316\251\370\235Q\325\367\230\325w\030\353"
+	.ascii	"\273\311\344\030\316\206\232H\351$\227nB\371=4H\324\210\336\035"
+	.ascii	"4\331\240_.M\302\240a-m\262\240c\262>Q\320(\tz\005A\247\260\264"
+	.ascii	"\n\227\264\262\326\327\216\003=\302\001\246x\377\222\262\352"
+	.ascii	"F\004\244\272\037m\314\302\"\310D\351\036\225\266\356C\224G\035"
+	.ascii	"|Z\260\356\303\031\203\310\300\241\242\336\263\255t\377\3025"
+	.ascii	"\207\313\215\260\367\344\351\036\334\341Q-E\217goM0\206\017\215"
+	.ascii	"hOB\371<5n?\242}\f\313j@8\321~e\242\276\217\351\370}\f\325dr"
+	.ascii	"-*a\003\364\nO\332\341\326M\007\204\rO\232q\315\005}\260q\n\377"
+	.ascii	"\200_\226e\205/<\311|\303\223Lf\232\0275\"F\300\217P\356P\350"
+	.ascii	"(\032r\201'\031\374\214\020\207\f\345nJ\36736>\006\233\013\366"
+	.ascii	"^&E\335\313\240\251{\n\346\204S\302\031\001MaN\230C\250A\020"
+	.ascii	"\215tP0#I\201\244\350\001\360\002!\032\326\001\021\2008\250\244"
+	.ascii	"\"\022H0\201L4\322\003\332\n\224\313H\237\236a\203\235\337\006"
+	.ascii	"\376}z\nT\201d\262\226\f\305\247\251\265\231%\221lO\037\177`"
+	.ascii	"\033I\307\227\277[\314\026\236\271V2\302\204\210\302S4E\241i"
+	.ascii	"*\332\315\340f\326\357\016\376\353\233\026Z\273U\262\365y\311"
+	.ascii	" \t\210\260\343'\241\264\345\034\f\020\002G)P\201>\213\376\362"
+	.ascii	"5e5u\233\320w\016;[\354\017"
+	.text
+	.section	.gnu.lto_.refs.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375 \315\255\004"
+	.string	"\302\013!&\2205I\007\227\376\314\307\231\231\231\231\231\231\031\261\347\234\371\261\225\365\333\212\337?\335lkb\007\331\f\021\273\211\334)\257\260\276d\r\375\332\313=AA\366\005X\177 ;\300\372\210z\b\366G\372\b;\224\376Q\357\260\356dgXo\262J\333\321\356\006\366(=\003\373\254;\261#\366\204-$\341^\260\016e/6IC\351V`?\250\273Q\337\260\257\365\250\276\352\276\336 9\201\035\201\235I\177\375\360\017\b\004"
+	.ascii	"K+\242+\\MYc\030+D\001"
+	.text
+	.section	.gnu.lto_.decls.a11aacb3fe302128,"e",@progbits
+	.string	"(\265/\375`J'U\251"
+	.string	"\352\376p8P R\322I\007\275\325\025\322\f\234H\336;A+Q"
+	.string	"\301\031h\376\367\312Lk3\"\030K\232\033u\371{\355\241\023[\034\020\321M/\224xh\360@\"\207\020UYUUUUU\b\020\242*-\300\305\b@DE\265\277$\350H5F\266\224)\001\003o\003\217\003z\374\307i\230\217\375x\345\275\263\031^\202\355\316\353e.\201]t__8\251\016\367\016\020d;k\323\352\364+\316z=@\250\251u\347\346GZ\0160`*\220{\200\301\233\2663TN&\352\331\210\252"
+	.string	"s\251?\214\0028\001\243\030#&(\266>\335:\r\263.\357\275>\035\245\f\036\\\247\347\246z\366\"c(`\306\242\260\231W\235\032_I\262e\205\0246\323Q\236\270W\353\213\263\013\203\341:\246c/\374\205W\236c,\347,\274\266\3443\236\343)\034\3457 \037x\321\261\330\034\263\261\034\277M\361\334\345\231\335\335\275\027\b\b\b\310\007\b\350\246\t\353\255J'%\273\230\024J\314\023\276\304\334\335\273\3061\027^Y\356>\353\275\257\340_!\307Z\030\316\256D\356\325\3522"
+	.string	"\354\254)J\357\336\025\210"
+	.string	"\240\0342\\\350t"
+	.string	"\341\336t\242\254?\312t\312[l\246\244\330`t\372d\033\257\354\36618\367\246P\315<\251\230\271\030\023W\204d\365\240\236\007\265\177r\260\242v\271\253r\353\3646\250\227Ae*\\\205W\b8\355\214\306g\257IZ\357\332[i\312TP\317\020"
+	.string	"\355\337\037C"
+	.string	"|\tjs\017\220\207Q"
+	.string	"\337\201z\r\240\230\325@\327\362\334\314\312Z\256\315I\351\346\370)\361\343\353\364\027\250<\334\003T@\t\b\324e\032\024/h\030\320\217\352I\030\023\366b0\313tj^\262{\327\023\266\251I\036Z\247\334\204\277x=\200\237\234\202\013n\225`\253\327\275\353\016\016\r\032[\315N/\201\372\337\311{\222\356\005|"
+	.string	"\220\377\370"
+	.string	"\340WF\001T\271\007\370\263[\243\2705\216\363\333\n:"
+	.string	"V\247\260\260{\206h"
+	.ascii	"\214\350\02374\317\337;,~\353\300\317E\332\204\n)\210X\340o>"
+	.ascii	"%}\323\301\237\007\370\\\253}\267\362.am\323\300\262\256\221"
+	.ascii	"\322\351\r\177\333?\277\237_\370\271\217\017\315\007\277\345"
+	.ascii	"\245\336\317ig~^[\342?\337\317f\372\330(\357\3472?\333\331\240"
+	.ascii	"\036\356\267G\007@\n\036\203\300\337lO\177\033A\262\216\007\207"
+	.ascii	"\37724\360\333\003~>\021\374-\001V_^\30650\335\3774\352\3176"
+	.ascii	"s\354\345?\004\377\001\370\377\200\334\023\370\033\314\377'\377"
+	.ascii	"S\034\360\277\346o%,\212\237\267\374\314\366s\364\347)?\237\375"
+	.ascii	"\f\375\371\353g\257\237\227\374l\344\347\253\237\251~\226\372"
+	.ascii	"\371\210\237k\374\f\365\363\323\317N?7\375\314\3643\214\237\357"
+	.ascii	"\317D\374\034\304\317?\374\214\364s\017?\033\177~\361\363\016"
+	.ascii	"?\203\360\263\211\377a~\306\341g\033\376\223\375O\373\371\347"
+	.ascii	"g\030~n\341g\025~\026\341\347\024~F\341g\022~\036\341\347\020"
+	.ascii	"~\366\340g\002~\016\340\347\236\377f?\343\374\334?\363\1771\377"
+	.ascii	"\241\377\303\376\203\375\347\340?\333\377\234\277\277\277\277"
+	.ascii	"\037\b\344\257\t\376)b\004W)\366\314S\215\240%\351\270\002\367"
+	.ascii	"\347^%\024\023\212\245<\301\204&]\246\022oQ'\230\353\3451\300"
+	.ascii	"\205j]\346\332T\246Me\337\365.\261\242\356\262\251<b\256\027"
+	.ascii	"\352\256M%\317]F\3610\327$%\023\212\025\305Lh3\352\304]^\345"
+	.ascii	"]&\361P\227\315(\246\226f\024\017\023\232\024\305\\bE\361]\233"
+	.ascii	"\227\341\322V,\345\322\205&\345\334{\235V\247\022\347\336$\250"
+	.ascii	"\253\214\353\031\027\353n\306\265\272\374\246d\325\272\367\336"
+	.ascii	"\253$\243\313j\006W\245\373\306<\322t\261t/\335\235a\201\222"
+	.ascii	"\225LWI\311\367.\255P\367*5u\230j2\027&\250\233s\227INJYM\234"
+	.ascii	"%\245&\323=\302\203\243\230\320\254\346\n*bP\347UZ\225\354\274"
+	.ascii	"tXP*T\311er\240[SN\235\2565\333\215\331\334\215\257N\237N\255"
+	.ascii	"\245\255\235\326X\030\354*o`p]\271\351\335;\025\001\016\0246"
+	.ascii	"\274\306"
+	.string	"\362w\264\325t\212\240\361rv\332VV\274\257\004\201\240\305\210\353\224\377\376\356e\024\300\276\327\206\251B%\2506\204\316n\212O\021PJ\204\254\365\031\216\0260U^\304Z\nXs\315\261I8\332\320V\240\233\020-mVj\270\262\376\316\230\225\345x\241\215Y;}\227\375\275\325dG$\250\304:\365a\024@F[\361\036\263S\254,\365\2115\025m\224\201u\332P'\r)V:]W\023S\254\312n\204\201\355h\365X\002\211~B\266\352\310\320ZBF\022\253\023\270\032eB:]\322\317\366\352$\272I3i%\375\305k;\351$,\245\221|}\335\261\227Vw\351,y\356\262+\212\030\217\263;'M\244\221\360\333\324zkt@&\025\325\273\323\201E*\372\344)W\323Y\256\f8\221\212>\3118\351f[\351(W\004\320\244\242\317\306r\322YW\3437\262\021\212H\271\003\002\002\222\241\f\223,"
+	.string	"\322\333\036j\027i#\274\236\255\217<\225q\006\211\226Nou\2507\202\317\006\274\225R\2054\027\277M\215P\305\354\256\273\272G\007\321Y\2567J\006(RQ$\332\311kw=]\357\205\022\020\224\"\223\201\007L\337\\?4gLt\345\352\264\267V\274\207l\260\245\265\244S\333wj\373\350\037\274\3764\220\007\227\353\205\006\275\224\251\"\233S\317?\300\035\376\001\276\273\250o7\365\315\246\376\255\257\250\3573\265\255\272\253\372\352m\325;p\226\267\255\322{\223\230\027\320a^\240F\215+)\214L}?\311A\225&\321DL\333\024\257M\365\226\242j\034[9;f\374\260K\223\034\261\227F\021\251r\273\3216\340|X\031\3534\252k\360\3326\336P+\r\346\005m\243\237b\2009\351\375"
+	.string	"\246\215\245\276\251f8=w\004\361\353\264e@\271\314.j\245\3237\263c4\223\327nz\303\350%&\003e\342\250N\024\317]*1qvS/\227\370"
+	.ascii	"\001\3314\303\224C\200\351\373\252\351\031\365o\245\003vV\034"
+	.ascii	"3\264:\251\225&\304\b\251\352\353\264/\231M\230\225 @\350\324"
+	.ascii	"\363\035\036\227\331\325i3\226\265c\317B\235*S\030\r2\377\n\336"
+	.ascii	"\3432\\\246\243\344\271JrTN\273=>\303h\354\3524!\313\352nO'j"
+	.ascii	"\275P@\271\251\247\034\001dn\267[L\\Q\202\006Xk\261sQC\230\370"
+	.ascii	"\260b\305\262\361\017f\323S\357\003\246'|k\267lM;'[\2476K\323"
+	.ascii	"q\3459\233tj\261\334\216\345\326\264rtj\257\\\315\206\315-\353"
+	.ascii	"*xU\245\212\215\3724\355\334\214\246\347s\347G\025\245\274\264"
+	.ascii	"\333(\243\321A\317\004\245\246L\261fn\316{ed\335\213\022\305"
+	.ascii	"\236\2619ml\340\200\342\223r{6\346\006\r\226&f\02711k\306<\253"
+	.ascii	"R\230\266;\336q\227UUvk6&]\342\322\345\327\251%\263O;\026\205"
+	.ascii	"\"\351\324\2165\022UG\016&\032j\351\021T\230\264\241\255\253"
+	.ascii	"\205nq\002\363\356\020\260\260[h\016\235\331\335U\247\026\314"
+	.ascii	">w\236\276l\215\351\324>9\023\245N\311\327\027]\360\251\t\323"
+	.ascii	"\226,//\273\344vy\255\352\234&\326\224\374\242:\275\312Dr$v\211"
+	.ascii	"O\323\326\201\221\212\356\314)\341\362\224"
+	.ascii	"\334"
+	.string	".Q\023\343\272\262|\246\265\311\230a\2376\211\267(e\327\224\233\003\306\227um\222N\242F\221\350\262\201\307\343\366\007\017k\304\306\251SM%\336\004D\230~yz\2279\365cBI]\222\350\220[#\267E(\270\340jQ\350\234@:\265Dn\235A\312\2101\221\260\316?\030$\022&\212_\025\325vI\320U{<\372\270\016$\216\013I\247\315W\003\332\255\333}\215\212\236\216N\255\220\333Ey\002d\207\rb\335\262\344\224:\265@t\2520\225\261AQm\217[\037_jKra\252\315\272\325\372\203\354\343\351-\356\013\013o\b\016!J\324\333\024Qu\350\260W\f\326\334#\363S\243\367'\347\303Z\335^\361U\305\350\324Vq\264\006z\265\266\327\251\335q\273\344\362\251$\b\320\215F\337^\247\267Y\242\242\222\202\346)\207\236\212\343\t\336\r2RR\366\252A\202\330\276\032R\332\346n\334\260G\234"
+	.string	"\034\243\333\313\362\354\364\b\216\336l=Y\342\221V\243\206\275\352\031\320\013\312Bi\001n\331'\373\324\205\356)\3073X\005F\223\037\235\036x\303\311\311\336\023z@\231\372\331\321!5\227\304\237\215ac\330&\225\303\316v\374"
+	.ascii	"\247\234J\300t\312\253m\212;\322e\226\307\304da\370\360\2547"
+	.ascii	"\213\312\2313\205\013l}S\177\233d\223,\f\037\260\253\324\221"
+	.ascii	"\313\321\364\324\273wG\004\315d>\t\303b:\252\331'\327\351\362"
+	.ascii	"J8M\250\273\f\322\005\257i\237Pzd9\373\373\263\227\247\256\375"
+	.ascii	"r\366\224\343y3\267\227\210\221,\247'\037_\247a2\031K\372\336"
+	.ascii	"i\332*8v\307\304,Ks\006\216N_\203\205\006\rG_so\023\214\363\306"
+	.ascii	"\231\265\317p\264\327\013\025C]MR\2312mF\355\361\224\3676c\271"
+	.ascii	"\306\264\276\362\360\3608\214\347\354\326\266\3430\237\365\326"
+	.ascii	"\310\201\016j\215\340)\026.\347\322b\230lg\314\355\313[L\230"
+	.ascii	"\2329\274\0338\302\200\271\331\361T&\244/\233!s\003\"\266D]M"
+	.ascii	"\224\030\021+\235v\227\246\263\221\221\245\211\017\272\271\030"
+	.ascii	"A\310\334\205\371\022X\236i\235za,f\306\300\\5Z\216\325\221%"
+	.ascii	"\226R\324w[\273\275\267\254\275\245\343NX/\r\033%4SP?\177\303"
+	.ascii	"\275\343\332\212\375\272x\304\350\264\3378\f\307\313\216:5\016"
+	.ascii	"\313j\343\322\226\204\372\376\201\367\326\250Y/\224\022\016\220"
+	.ascii	"k8\207-3p\357\177\373\337\307x\003\311\"\321\036\005\205\216"
+	.ascii	"\303\244\321XB\013EG\026\200\273P\361"
+	.string	"b\230D\006\201\f\"\036\211R\230 \022\032W(:\002\332\b\245\b\300\005\022\311\250\005\n#\2420)4D\n\217\303\002\\ \211Eb\013\001\212\304c\022\0314$B2\032*\022\203\216H\244 \001\214\214\220\212Ec\321&)\004\374\301xt\2214\026mZ\b\207F\351\360\210t\224\036\275\030z1|\001\274\013\025C\307\241\240\242\361\305\013\343\220\3170)$:B\022J&\211CCB\030\254\030:\016\001\320#4\032\335\f\213z\004\030\nAd\3013<\"%\207\220\216I\026\002\020\021\215\2044\004\220$\026\2117\310\036\242\342\360(Tt$$t\302(\003\262\250HL&\207,\206I\342\361\007\024\311\342\360xD\022\001ID\021B\016\213\023E\341\0202\207\250H\002N\362(L\262\320a\301\205\030^ \201\004\242\"\261\305\r\017E\241Q\b\" \211(>D<\016\213\303\"\365\026` \001\006\031"
+	.ascii	"a3\024\032\022\031Y\030\036\221\214\210\302\0269w\241b\005\031"
+	.ascii	"P`\021\224\034\026\035\205I\005\204I\341\b7\311\241P\t=I\241"
+	.ascii	"\343\220H8<\001)t\")tL\036\005\211\212C{\027*\216\303\027\302"
+	.ascii	"\3411\211l`\007N\nQP\301\017|\034\266h\201\264\0030)\354\343"
+	.ascii	"qh\215FE$\325\310h\fA\250\206\2508<:\022\002\217\306\244\260"
+	.ascii	"H|q\034&oh\020\241g\270\203\320\020\261H\370BM\026I(2\256\300"
+	.ascii	"3t\024a\210\024\356`3\034*\016\221z\030\"\325\244\020\321\321"
+	.ascii	"84\214A\347\f\024\0355\321\220\207!\341\021\260h$\"\217C\037"
+	.ascii	"l\220EB\243\0265\311\273PQt\024Tt\324s\343\321\360\030\2244\032"
+	.ascii	"\217A&\206\212H%$\207H\023\305\026\235\034\"\207\307\032\244"
+	.ascii	"P\020\307$\222X4\214\241\350\b')T,:\252)\026a\260B\035\nAD\246"
+	.ascii	"H\344\360HD$\264\t\342\3108\224\036\223G6)\224A\262HD\262\371"
+	.ascii	"\212\025\"(0C\013&\250C*^\030\217G\303\241P\021\261E\3218\024"
+	.ascii	"T$\n_\004\r\035\221A*\026\300a\267\324\200\211cB\344\2104J\215"
+	.ascii	"\222\005\206\362F\034\360\214\226\272.\033\235\306\246\341\013"
+	.ascii	"#\253qC \343\324\003\f\n\223#N\235\2463\322'^\257\226\322X\241"
+	.ascii	":ns^\350:\375\315\222\n\204\315\337\337\337\337\237:\031\331"
+	.ascii	"\211\323J\352"
+	.string	"Je,I\227}X0\322\246\276*k7\264\322\030\351\005\276\245}qJ\231ir\256$Y\202K\231\240>\340\266\204\244Kf\3014|`MR\030gXa\276\252Re\252L\225\202PP\367Nm\340\306w\227&=U*\313!\222\004\304\256O\365\271\031\373\261Fi??{\257U\2373hFU\251\266\262TY>\037\034\257\035s\267\323\007\275\250:\300$C\230\250\240\201a\263\327\246\347E\317F\265\236G\322\234ac\313r\227\326\253M\225+xOf\304\330\272\347\322U\236-\203\223FE\r\253\301\354\332\224\030Htj\357\254\021\177\177\366\256-\031\213w{\367\035\033\272'3\t\230\206\tc\307\240\240<\332kz\212\271\035c\263\344`*\022\007\306\214\0243*\266\316^E\241h\253\375\202\305\3042m)e\351\242R0\370\240tj\273X/\267s\267sm\347\354\337_\337\275I;\314\0130/"
+	.string	"l\302e\f\230\302\301Y9Uy\223Uw\343\347\267q\267r65\324\316\2508\232:12\345\003\255\255\315n\201\002\267\025-\300\311\031\203\206\250\242\351<\205\362\0302D$\"\"I\222\244\003R\n\020\004#I&\253\255\035\022"
+	.string	"\365@\222*\307\214\314\210$I\n\031\306\323\251-\233\254\310\221&~\344\225\357\032(H\207\200\231c\360\037)\324\204\272W\243\035\271\2041B\005\364\302\350\260\315\277v\022N\374\256\2768\275\226\223\206c\026\325q\0341fX\351k\347\225\217\330\023\240\003\345\360\316E\033\232\016a\212\277Q\030xm-\204\321\303==\270Q\232A\260LU(v\316\277f\301\257\037[0\235Q!\366R`}\247+8]$\335<%\375\3334\303\206?\024\342a\023\200\305\234(.Z\270C\332\252D3\240\230\233\202\365\205\315\214\017\375\016s\326\367\275\210Vav\f\203p\214lw\254Q| o|/\256$\032\252rb\026q(B<\007\372,\373\007\251\346\354\300\023\224\373\315"
+	.string	"6\364\f\220\r\354\317\257\fuh\034\317\005\017xQj\t*A\273p\225\363#.\330\211x\227\\\361b\251\243\0177\264\352\312j \263a\020\263\241^\036\r2x\232\330"
+	.string	"\351\034\003\371\023.c\257\275\200\254\324[\255z\354\314\254\237\256\304\200\311CH\364\ngK\201\020\\\323\226\320\326h\311\351r\354Mf\220\316\332"
+	.ascii	"|v\226\364\033}rv(\244w\021\315:&\023\013\030\006\251\275\027"
+	.ascii	"\361\023\fe\021\225nH"
+	.string	"kI[\002\231\256Fa\351u\301\236\327)\032\336\225V^$ \344Am\313\236S\246b\326\260\002\rw\r\222h\006w^\374\024\274\274\026'\3334wM\206\314\027\225\365p:\374f\3123\230\024!Y`\023U+b\301)\315@4\266a\035\3004Y\261\016\242p\246"
+	.string	"\002\"\262\245\313\352\317\235U\034C\273\236\317\350\300\352\224\271.\233\346\230bbm\003\245\\f\330\n9\345\336\240\2773\347\034\020\377\373\013\312A\022\311\"\376\347 e\314\210\177\211\311d\245$\277\177/\265\265z7\b\355\322j\212\215]\374\307t\020\365\205UpN\303d\345\035h\bA^\2040\336\303N]\004\336;\331"
+	.string	"\027\351\245\207)\022\312[\305\003\363m\206\034\b\026\227\224\222\245W\025#\240\354\204\203$;B\351\n\340zu\211\245A\027\373\223\306?S+4Jj\226\304\365\013\266\240\352\226.\220\245\n\367)\007\317G\017X\301e\303h\260t\340\256\344\tVc\3218j\305 \366\261+\265\356\243\2129\315\246\2339\030\201\251s:\352\026\207\346\233\230\352\352\372*2fL\247\347\247\370\020>\2651\034\304h\244\345\007\207\253n~\310\251\231-\233\210\365\313kW\037\315\234 `\252\323$\035H\365\036\332\346\321\002\360^\361\236y^\275\232n\004A\2119\272\241\345\302\340\352k\254By(\247C\260.L \225\232\337\262\350\226\031\2778\230\004}T[\034\"\367\277@=\371\271\312\302\236\007\205H\250\356\340\254\247\213O\336\236\254$\254\236D\227\204\001\265L$\330\343pE\334l\017\023Y\246\350"
+	.ascii	"\235\310\247+\252\377!X^4\260\301HQ\3760y0}\350/\236\003\231"
+	.ascii	"\n\256\277\006\020`0[\331L\252\307,\257\341\360\344+6\365|H["
+	.ascii	"\304\225Y\327\223\261\032\r\316\034\025\335p\277H$\241\217\\"
+	.ascii	"W\374Q\022VN_-\221I{\024m\270\335\212\203_1\035h\242\267\354"
+	.ascii	"\311\"\371\017\007\001\337\241\213V\322\302\205\244\302,\\\351"
+	.ascii	"h\353\341\235\317\236w_\241\307G\341(\347\221>(\030Y\236\177"
+	.ascii	"\n\003l\024\264]1\230g\301F[\002\364\317\036\332\023\035b\332"
+	.ascii	"\236p_8\223\362<\330\204_F\217\2015-Ww\320\242C\220\003$eJ4\300"
+	.ascii	"\274I\227x\223S\375\271\257\224fdY\227\222yU\276\303+\366e\320"
+	.ascii	"ng\324\326L\204\336\201\366\251\247q\3512\275roW\223\216\300"
+	.ascii	"L\207\233\254\322a\f\211\234\241_K%\234}\030\302\344z%3\235_"
+	.ascii	"?\261\022\030\327a^\026\361\263\377\210q\223\345\003\252M&\325"
+	.ascii	"\211c79_!\357r\355CMT\335G\306\230\205)s\004H\245"
+	.string	"\213\337\245F\017\374\323\363\005v\033\247\016\f\337\302\b$\327\311\n\2627\016B\337\217\272g3h\313\316\231\333\255\331\372\350\256Zd\371\365m\360\336X\nV\215\234VS\304\375pC\201y6\262\367A\357;\301\344uzN\324\036K\025\250|\360hR\321\252S4n\032U\330\215Z\376\3544L\333\354\353\0061]\347\035\001\304\005Pkgn{/\235\225\352\026\261\270\006EA78\303\303\365U\325\251H\266\024\300|w\025d\240\273\374F\217\371FIz|\363\016\341\344\364G\260\246q\324\265@]\222\215U\250\245C\227\203\b\"=&\177\251<S\234k\r\337>2\222!\253\216!\200m\013\324L\f\213\334\232\003-\203\231\242\246\226n\214\250\371\177\313\362\312\271\030\273\243\231Q\320\327w\323\005jq`uR\020c\275\034(U\350r,\251\337\240\222\270\250\001,\352\351\224V\330\223\325\366nx\007\326\355"
+	.string	"\262\fr\rj\256\251y\234\355\0270\223\250\211\221\360\bA\310\004]-u\266\204&g\\%\262\230\361Ag\340\021\205G\251c\362\362\037a\364\222%O\200\0034\344#\352\211A\034\250<y\335<\345]\261\244\007\231L\3437\243\246\2435\373;1\276\007{K\362\327\250\302p\376\216o\230z\232\tv\r\304\037>y\233\342\366f\223\357\340\200\315\344\001j_\321\3116\303wL|F'\237\302\337\225\375\037\326o\372\334&c\207\345\351|\312\307\323\323-\3502\362g\205_\353l:\274\246\232c\036\017\200\341\341\354\f\276F\002\036B\f\201vv\2679\264\216T\\\020\312\017\276\376\322\262o'{k\371\275\032\275\275\373\377\027\217\027\364oGym\305h\016\355\200\020\326)\034\200\355\374Fw\216c\377w\215\371\377\341"
+	.string	"r\363\207fB\347\037n@\334\341\362\242&\366\255\305q\336\353\357\256Cx\027\305W\031G[\027\242\371\\\254\241{\0320\257\320\254\3276\247\256M\371\007\013o\230\260\222\331{\341f\243\360\234\3727\235\023\304Y\323\300\350\223\356\277\377\201\364s\270\315p\377\305\377\225}M\376\234\007q\256\304gN\356l\367\r\343\310a\320\352\003l\332#\353\231\217\335\030&y\263\370\366\347\202\327\362\265\273\330\303|"
+	.ascii	"\272u\207\271\327\304?\346cs\t?\355\017\201\363\245a\267\234"
+	.ascii	"S\334\241\37627\217\370\265}\212`0\017u\037\341\001\255\021c"
+	.ascii	"\203~\nlG\362\312\326>\254\362\345\213\3666\266\261[\033?+\307"
+	.ascii	"\365\245\214\f!m\261\337&\362\271Lhp\271c3\3449\324n\035\006"
+	.ascii	"\255\001\354\242Z\001"
+	.text
+	.section	.gnu.lto_.symtab.a11aacb3fe302128,"e",@progbits
+	.string	"initEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"isEEPROMVersionValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"isEEPROMStructureValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"config_streamer_erase_tail"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"config_streamer_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"config_streamer_start_append"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a11aacb3fe302128,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,541 @@
+	.file	"config_streamer.c"
+	.section	.gnu.lto_.profile.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375 \352\275\004"
+	.string	"\324\006\336"
+	.string	"\013"
+	.string	"\255\245\304\212\017\006\002"
+	.string	"\002\001\001\305\323\254.\006\002\002\002\003\002\001\002\271\270\224\330\n\b\002\002\001\003\206\360\244\357\013"
+	.string	"\004\377\271\251\270\001\016\002\005\302\207\257\226\t\002\002\003\002\001\006\265\314\320\350\017\020\002\002\001\002\004\002\004\002\005\002\001\002\007\271\204\236\317\007\002\b\356\313\211\217\005\n\t\334\260\361\323\003\n\221\345\201\305\005\006"
+	.string	"\021"
+	.string	"}`\003\332J\n\201K\030\233\301\300\336]\363z\212\2602\262\013\300*"
+	.ascii	"\203:\253\223\200\314\353c\016\276#i\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375 \345\245\003"
+	.string	"B\006\020\026\260%\351\f\3030\2340\f\303\024\350\251cmk\204\020\273\245L)N\020\017[6\246Ltc\325\017\3307\203\202\342M,>\335R\351\024k\243O\230\212\236\201DtQ\rM\253\277\225\001\013\001\024"
+	.string	"C\023+\246e<\307\275H\336\341\321\343\256\005J\345\204"
+	.string	"1\017\267\262\201&!\334"
+	.ascii	"0\2101J\r!\364\3140\b*^\313\305`\220\r`\001"
+	.text
+	.section	.gnu.lto_.inline.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375`\207\003m\022"
+	.string	"F\034\\B\020\215(\351\306\220\362\207\026\022r\003L\323\342$\3559\222C1u\250\356v7\221\2079\234\243^A#Nb\302\254\340\332\"\364k\327\b`\005"
+	.string	""
+	.string	""
+	.string	"\021\001\006I\301\221\257\307\370\215\264\375M\344N\001F"
+	.string	"I"
+	.string	"L"
+	.string	"\330\001\261\212\276Z \2075\326\fo#\207\2055\364}\215"
+	.ascii	"^\r\355T*P\234\0300\3361\3351\365\337\344y\r\364\275\367\360"
+	.ascii	"\336\254/*\224\213\373\254\271\250\220\254\270\374\266U\034G"
+	.ascii	"PGJ\022@6\177q2\b\232\226\247\343x\272!\205\304(O\367)\205\021"
+	.ascii	"\t\002&\235F\373\220\342\301\n<\263j()u\\7\373nzJ\302\202r\001"
+	.ascii	"\307wV\221\367\036\346\342\263\276\301{o\364\230+\376UD\017\350"
+	.ascii	"*\372\242\332\270\300r\r\215!\030*,0\266D@n\314\031L\215\222"
+	.ascii	"\260\240\234p\016\347f\374iO\357\275\213\257{\302\357=\245\211"
+	.ascii	"\217\225\n\300\371\370\035S{}\334"
+	.string	"h'\357\275\353\206\243\246\035h&%)\013\330#h\036\244\221\324FAGtL(\021\340\3361\341\001\243%j\352c\305\001;s>\251\025T\250\026l\f;\246l\252\2643#\335\351\351\316\271\037OD7RI)\202\200]f-\277\n\230l\362?'\256y\243\030V@B\024T\217\325K\310\346\023\024D\206\224\026\214V\314\024[\007\"\002\\\250Q\265b\252\202\tF\222$),c@\002b\214T\336\001\022\300\205)H5$$A\024\244\366\330;-(\274\220\316v\003\246\310\240Z\247\235\252\303\030\347\234sw\340tX- \356\306\267\377\263Rg\362j\245\013hM\352\331\246\327\307B\305\023~\201g\\\221,\250\326DF\031Erkk7t\f\213p\202\360sh\246\032\247o\363\321\337E\227_B`\240^n\344\017A\312\315T\002h~U|\271,\354\360B~\2274H-\004\354\215\216\226\333"
+	.string	"*\243X\256\020d*4'\021}Ph\232\"\364C\034iw\037\207\236\242Re\211\246Q?\256\323}\336\276\032.\373\204\314\254"
+	.ascii	"\0329L\231\332\215\315\004\241\006EB\332\0163\3746\255\216.\314"
+	.ascii	"w\246\217\326\t0\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\225\005"
+	.string	"b\n\032\036\260%\205\016,h\241+"
+	.string	"\362aXQ\"'IN+\365\003\204C\210md\267\275e\222\001\333\354<1\017p\301\364\222\232\376\016\212\257\254\331\371\302\334\374P\252\365\322\300\353\370\207\260\201-vV\340\0372\214\227\024\267\217\271\365\225j\316\237m\200`v\236\\\351\027PJ)_\332JB6!oD\360\331\342\271b\033\004\034"
+	.ascii	"VC\340d\005\237\364\210\264\221\213b8\004\355\222:\224aax\272"
+	.ascii	"\001\260%,\305&\013[\024\303\n\250q@\212I(\2154\270K\263\035"
+	.ascii	"\231\257\340\251\027N\303\210:N\252\032\204\322\003\346>\025"
+	.ascii	"x3\213+\300\020"
+	.text
+	.section	.gnu.lto_.pureconst.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\232\004\001\231\004\002\232\004\003\230\004\004\232\004\005"
+	.ascii	"\232\004\006\232\004\007\205\004\b\232\004\t\231\004\n\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375`\024\0015\007"
+	.string	"\362\310\034%\2205I\007\240n\317]\027\233\325ISz2SJw\272c\025qW6/Z\316\252t[\273\ti\215\310\235\002\037\020\n\003\362\327\307\006\210]J\240\254\357OS\217g\251\364Ds\252\006\022\013J\005\201\\\3145\b\331\331\231pe\016\361Dwe\356\243A\307\001\360\254E#\300P\315\326=\265\326\2732\256\210]\252(\317\267\355T;\251-=9}\0332 p\"B\205==\tp\r\016\260\344\227\336f\356\310\335\221|\231\201\233\237Z\350\004\330`A`\nD\212I\334"
+	.string	"\334\262\363\204\365\220\267\326\201o\371\360Qe\301\3041\002>!\225.\351\032\325\356\254\247\275+"
+	.ascii	"\256\271\320\367\302\266}\212\004\321\371\322-\022\002\234b\303"
+	.ascii	"\033(\225\303\367b\214\213\034\002\306a\3226;\002[@\231\026e"
+	.ascii	"\004\273E"
+	.text
+	.section	.gnu.lto_.lto.ed8f292310574970,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_config_streamer_init.3.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"e\007"
+	.string	"\242N45@o\323\001\230NL7\\cB\2528\033\3171\326\336\245L\001\230o\273b\2358\3406\322\216\267\203\210\265\216Rv\361s\030\364S\323\307t74\353F\266L)\226ku\262\013\344\271\262\221\310\001\342\363\020\302\254\030\372x@\321\312D\261cP,\342\312\342\b\303\262\310\361\356\351\260k\303\310W\001-:\345\201\333R!8a+1\221\346\232)!\337\005\334ZoK\310\321z\372\377\302\256u\311\316\251\022y!P\3713fd\376Q,\037\234\266\316\326$.\321\\\242p\300\337\271\254\374^B\0256\246\352y\2402\265\261@e\252Z\013c\317\343>\331\300@\211\371\037a\2075\247V\333\304"
+	.string	"\034isj\030\37679\222\206\013\335\266\240\355B[\220\t"
+	.ascii	"\252\244\2231\215{\206\215\263\257`\336%\200f5\005\334\345E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_config_streamer_start.4.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375`\352\001M\020"
+	.string	"v\235iG\360\220*\035\022\035\200\367#\227\324ye!~\202\334\216\027~\022\261yI\376\016\336\337O\250\341K-L\013\303\250\"~\017\035\245\225\277\203\353\314d\311\342c\232\215kN\321h\256\310U\363\213\203\305-i\204l\271S\nR"
+	.string	"O"
+	.string	"Z"
+	.string	""
+	.string	"vc3\266\335Q\304\t\300{\036\037\362\335\003\037\340\273\347\224}\343\243lO\373\240R\323\355n\250\"\236\372T\231\362_\273\247\365R}r\270\316\003\271[\216\317\2135CVH\264^\273t\275VRv\036\354\256e\353\265\341\366n\033\202m\007\266\224\0209\366\250\222\312b\177\356\356Zc\366a~\317\307\277\363\331\377y\322:\245\345\224>H\203\026]\215"
+	.string	"\035\273+98K\343\305\224\260\375\217mMqZ\3520\306M\220e\205p\331vW\304\f\300{\004\246\034Q8\n.\355\273\374%\365\031\312\003.\031\311\267\354\241b\206f\245\252\313nr6\365\351S%\241\325`\311\033\333\025\376\342\004\252\232\300\355fRm\322]\240N\243\205\343*\365\031`\253k\204\0162*;<j\227\336\3028\275\305\330u\324\276p\026(pw\027\370+D\223\312F\240|\367\fh"
+	.string	"\001{\361\220\"\003\"\f#\323\024\231@$3t\207FD\021\t$\022OL\023JF\024LJ\241\320d\004\"\205!\321\024\216\024p\311\202H\fOJ%1\374\214\373\271\032\363D\321\262\313\245\350\312\207q\033t\031\325\032\033'\020\334\016\035g\234\016p\315\200\271\330Le\371\351\2139}x7\031:\233\017\351) \220\002\2219\354\001\352\323\215M\203\311F\227v7W\"^\367\266o\026Q0\274\321(Fu@6\323\241\327*\200\017Fk\342\301\354*\276\3579\025s\300\203\022\021t8\364\f\332:\007I8\035\013\310n\226\265\013\370\303"
+	.ascii	"\232\227\201\273\2420\256\205]\326\210\200\025Epy\336\344\024"
+	.ascii	"\r\356\001"
+	.text
+	.section	.gnu.lto_config_streamer_start_append.5.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"\345\n"
+	.string	"\006\325LB0\247*\035\020\376\314[oX0Ot{\206\267\337k\036\347SJ\261c\331\351pP\032WeC\232\305(\036\307'\307\210\200,\021\001\245\240\240\326fNaL\300\3066Z\315,\231\206XB\366\336)\0056"
+	.string	"="
+	.string	"8"
+	.string	"[fL\321}s\371\006\356[\367\005\356\233I\033\366\022\265g50q\315v\327\243\002N~\222\376]O(\231D\237\026\215\335\365,\231Tnz\333\021\2663\354O\004\237\026\214\324L\366\200`\027\245\026a\035l\013\b\330\376\3056=p\026\371\226\031T\314\222"
+	.string	"\254\274v7\343\213\356\033D\235\345\210\003fI\254\223\212O\373\006\256\"\277\n]a\367\004{mk\341'"
+	.string	"\201P\324\356~@\210\373Fe\020\n<\030\315\232\271Y)\245\223\332!\"\363%3\250Rh\261\022*\262K\321\244\001\354\327\335]\323\223\375\326__\376\364\253\007 \2103Vp\334p\324\357\3764\"\330\331\200\342g\334\360\340tx\302\317\363p6\035\357\023GO#\341\360\003\024\275O\030\212\336\245\334\327\245'WU\212\026\033Q\022\377!gw\256 \354v\003\017"
+	.string	"\252\244\223i\272)\303\305\355\005gl!\327\330"
+	.ascii	"3/\020\030\256(a\\P\030\f\013P\241\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_write_word.6.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375`E\002}\023"
+	.string	"\226e\203I\320\360(\035\360o\242\351\017\274\201\371\375\203,S\021\"3#\206\260\034\224e\355\227n\202\227\365`\340T\256:\320_\265\344aO\264\233\007\275\365\275\214RoZ\334\331a$\205|7\304\245\035\222\355\211#\375\204\220-eJ\001q"
+	.string	"g"
+	.string	"q"
+	.ascii	"(\016D\263\227\3448B\fmlp\274\2509\347\252"
+	.string	"\344$\340?y\001\340\277\025q\332C\360\223\2534\377C\254=Lm8(\0270\345\004\211\2107\371\235\032;\225\210\323\357D\267]\215JI\202C\"w\242k\006\361&Mp$A\251D\233\2564\321a\312\021\021i$\211\323\216\215\357\2567\"N5T\231sZs\242\206;u\3337\333\fl\215\005\366\207\376\220\363n\220\217\377\207T\207R\375\201j\371\251\367S\253T?\200\201'\035\017=\271\2251N\234^\217\331\364)\2258\357\366U\370D\274\230\022\3338E\013FO@Qs\216'\377\254 \365\3576\315V\331V\375\320\005\003\230\023\304\215\224\253}\241\247\240}\224\371\310\234<-\220\346\034\017\030A\352\237\307\224m?v\265\350s {\242?\204\022\217&\333\326l\026.~\346'\003\345*\224\313\217drSz\376\027?3'\344_\340.\313nF\330\373\013\324\335\325\0308\0164\216p\243\227\356"
+	.ascii	"\035\fM\312\341\364aW\347\223\177Yv4l\272\3036\354+\274\224\300"
+	.ascii	"/\202@!5\347\274\217\f\370\357\333\201\307G'HhF{\366X\323\325"
+	.ascii	"\331\337^\257\327\363\362\0042\230\031k&\003]0\022X\025\276\326"
+	.ascii	"\335B\211\271^,Wl&[iqy\360\002k\255^\\X\257U+&[\241\0240l\202"
+	.ascii	"+\266\232\301`\261\225j\234\227S\202\237\003\233\"\334\321\207"
+	.ascii	"\362\357\336\240\007\003\356H\277\341\336\330\016\327*3Kc9\347"
+	.ascii	"\234\341\210\206\354\307\332+,}\356\333\357\256R\2635$\023B:"
+	.ascii	"\300\325Y>\006\004Y\002\272\236\210\352:) \200\002\031\261\355"
+	.ascii	"\352t\356\231N\245\205\300lD\337^\255\020\261\265'\310eO\333"
+	.ascii	"\031\003\034\\\340d\"O8m\027++\003\033GaJnib\257\235\330A\262"
+	.ascii	"\bEP\342\006\034%\341\033\3439\026\313r\303\034\344%\344\333"
+	.ascii	"\\\301\341\276KI\203\257B+1-\355pkY\031I\"0f"
+	.text
+	.section	.gnu.lto_config_streamer_write.7.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375`%\003=\027"
+	.string	"\246*\225I\260XQ:\3608\257C\313\371\003`7\236I\260$\266\237K:\207\357\034)\234\2679\234\302&\373AZ\326\376\233\236\022\024X_\232M\212\335\303\362\200\377Q\376\363\210\036\231\037\261"
+	.string	"\304\355\3735\311\360AB\020B\366\2262\311\177"
+	.string	"{"
+	.string	"\202"
+	.string	"&>\240\326[\257H\255\245\203\215 \236n)~\307y\300vy\263\304\221\2371d\313!\325ZS1G\201\247\363.\340i\367\300x\226_\220a\017A:\233a\373\334\247\216!\276\221\314y8C\332N\r\023i\2332IEB\337\235uH\031\203\001n\2648e\3619#\320\220^\230H\332\024\220d#*\2213\356\357\276 \3107\222-\316\341\205Z\353\362H\252\370\212\337\335\235\335\265\260\333\030\002U~b\374k\235\022\032\331\315\263[\346\260\f.\251h\373\266\213\232\274\247\227\277\351?~\226\373\370K\327}E\2217\fy\301\311KA\336Iy{\362\362\344\375\213K\257I\206)\265\356\374\254T&T\310\306u\337=\220\375N\207\363ZK\001"
+	.string	"\305\214^Q\255%\203\323\255 \236~\027\266[\332\335\346\377\0301[\352L\306\013\n\354\003\247@K\235\001\235\220p\336\375\317{\300^\006'v2\032\021\340\331\246\336\335\300\201?\322\216\241u\316\356v\270\222\0210I\024<\231M\211\216r\354\020\f\034\267\331<;\277<\220\333@O\017\020\224\031'm\367\356\226\370\021\017/\270Z\253\314\256\352B+\024\216u#!NY\372h4\212\235\bMK\334\343\364\314\351\270\340\016\202\301}4j\3607w\363j1d\374\333]\021\027\262<\261\326:a\037\344\303\214H\343to\002<}\177\367\004DS\0027\252\232f\221h\331\314\232\257\276\253\007/\326\214\212\365\272\261\361\020\242\005\202\306\265J\321\264T3\251\325\313&\365"
+	.ascii	"\301\272jX\257\324\215\313\365J\225\312\372\276\235:&\326\262"
+	.ascii	"\355\235\372\271\037@\342\313\361\023\343_\330<\013a\244\250"
+	.ascii	"\016]p\251\305\326\021;l\326\001\024\005\354R\207\375\232\017"
+	.ascii	"K\203\rJ\261]\211\361\357\263\326ZA\b\027\033\325`\212 _\315"
+	.ascii	"G\306?^A\031|\210\372\034!Q\241\275\253\341K\226'\006? p\002"
+	.ascii	"\021B\253\003*\351\342\206\201{8Z\013~\275\254K\377t\352\262"
+	.ascii	"\303\270>v\362\262\264\025\242m\355\365\341P\004{\n\030\342\337"
+	.ascii	"\211u\326\302\355\252\362\344\242\327\224\2101`\235v:\303\356"
+	.ascii	"K\276\251A\200\260\252\r2\177\350\306\204\377=Z\257)\216\323"
+	.ascii	"x&\321\n\204\234\343H\016\370\330SWk\200\226Ens\207\3543\243"
+	.ascii	"\266\013-\350\344{\346\356\304\243e\225\370\bA\302\273Kw`\203"
+	.ascii	"\353Q\017L.D\022\222e{\343\365v\332G\006"
+	.text
+	.section	.gnu.lto_config_streamer_status.8.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\r\b"
+	.string	"\322\217770\217\222\016\204\364\214\b%x2\246#\213\271/\374\bj\354\\\030\f\243n\334\242\375\373\351\357z=P\321:\r#\006V1\254(\312/=\034\233"
+	.string	"U\366[#D\246[\3376]\347\303\351t\242\020\203\203\247\001\304m\032\310\303\371h[\027\3226\004s\017\235N\023q\\\247a\276\354\307\250)\305\211\037\242#\253\262\314L\270\"\022\021\331F\261;\212\001\251\022l\375G\202\361\342{eD=\204\307~-\2742\254\225\205\224\314\212VK\252`(\034\277\367\230\277\360\233*\210\327oT\201L\324\312$\3633\370 +\366\227\375\327\243\037\336\253\256/\343T\r\026\n\022Vfj\232\016\\\212]\315\\\212E\214z\205\336mH\257\216\222\225\351D*\004P\310\314\241\351d\321c\377\202\037\341?\t\f"
+	.ascii	"\252\244\223i\021\206\315D`\231\005\324\230\320]\303\321\261"
+	.ascii	"x%\230xp\367I\265b\022&\031"
+	.text
+	.section	.gnu.lto_config_streamer_flush.9.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375`\330\001m\020"
+	.string	"V\036jF\360\222(\035x\026?\375uP\224\337\377\025\\\221\356j\275\260\367Y\332eom\0232\277\214>F\374a\272?ab\004g\354\265\250-\n\374\340\371\236\364Lf\316\n\367)?\017Ww\027\341\211@,\331[\312\224\002V"
+	.string	"Q"
+	.string	"W"
+	.string	"!\002'\330.\035n\266\375\024WQ\262c1d\245.\"\307\305\2053\347\344B\007i\227\361\004\264\313\r\361\322\343j\311\177\314#\212\232\034`\312\364\350\341\033\017\334\310\350\021 \325\022A/$\300\307\\9\244N\252\035\006sN+\230\352p\313\333n`[\201\255\016\002\013|\031\013\031\266\021\227\376\212v\371\335\325\fL\213Egvh\322]\331\217sU\266\252=\017\177\020Uw4\265&\3252\252\343\252w\325\252\352\013("
+	.string	"\342\306\203\331\234/\263\037\323\206\244)a\273d\207\250\375\326W\224\036\256|\300\234\252\032\2609\003\"\332\312\225\013\246\345\321\335\221\313\265;\221\036t\b\265\246\225\373\027\352\304\351/4|X\240}r\027#\0036\027\336\202t\371\261\211\253.\360\203n\274ih\273\177\241L\234t\346\257\356e51\\r\316\222\335\300vW\036\371\227\202\f\216\026\225\331\366>\343\3306\347\f\335\335\221|\"\222\211\350SI)9\031U@\361:\016edB\342\272/\205#\021\261\207A\364q*\236\367q!\341|\234\253\362l\210eO\236\341\331\215\261\360\021wE\263<\\8;:kC8\314\261\r"
+	.string	"K]\240\216\217j\013\262v\004\tz\260\263\241\rk\262=\341\257\022\020\013F( @\002B\214\243v\212\323\311L\377c\230+\263n\353\206\211.g\2213\202"
+	.string	"\313\202\213|}h\230c\300\206\215\235\220X\037}\001\353yX9m\244`\217\203\233\034\032\021q\260"
+	.ascii	"\022\005!\037\026m8\314\313(k$\347\243\264\371\364/ab\344\256"
+	.ascii	"m\243b9\030s\333\215T\201\326\233\246\024\024\n"
+	.text
+	.section	.gnu.lto_config_streamer_erase_tail.10.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"-\013"
+	.string	"\226\225M>\020Q\225\016;B"
+	.string	"\370\0318\024\007\344[\021S}1\360B\341\361k\3000\262T0v\277k\033\326\234\374\323\311\032\202\235A\n"
+	.string	""
+	.string	"\260\002:\355 d\352\002 [\2168\240E{K\231R<"
+	.string	";"
+	.string	"<"
+	.string	"\253\032\273\213\031\370\004\362\bO"
+	.string	"\362\250\036\270\344\01659?@\007:\274LW\230\200C\013\223\200N\004'\035\035h<\365,u\243\314\310ew\235\244N\303\035o\273\201m\006\366)\001\207\231\316L\377*\340\321\341\340\305n\206\017\033\013#\266F\330\346l\211\355\247}\324Qp\377>\037\260{\232\261b\367\243x\301\365\350\357\262\355\233\370\t\316\346\200\337\207\356!6`\bQ\241\202,1X\200P\365\254\340W\b*\031\243\364\260m\341)\314a\361U\025.\\\273{\021\217\376\007\362x}\352\007<\025%P\241\374\260?P\252\327\272\341\255\254';\323\361\337\003\331\235U\266\314\006\223\331<\235\007\0224\0218Z\206q4\230\r\226m\035\254\202\300\332\204\314\206y4m\303$\337\262\0165\002\360H\270\310kj\311v\252/!\025\261`$\241\332\035\nyR\021"
+	.ascii	"\252\322m\30104\006\331\016w,\266\006\305\204\266\265\0041q\021"
+	.ascii	"\332\022\210\313\270J\r]\220\t\002NHR\r\266\bMcPP"
+	.text
+	.section	.gnu.lto_config_streamer_finish.11.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375`\355"
+	.string	"\345\013"
+	.string	"\006VPA O\225\016P\305*\026\342"
+	.string	"W\025\306C5\251\2522\254\003\223?@\231*\241\035\"\021\026\307o\030S\361\rt\311f\371g\360\0060\272\251&\223\201I\221|j\216D\201\213\311MB\310\336{\247\024<"
+	.string	";"
+	.string	">"
+	.string	"\313I\036\311^\351;\262\327\251\341\340\351\224\240\177\324\251\207\024%B\261sZ\341\223\006p\231\200\261!\202h$D\n\217\272\234 ~\244\324\f\354\256e(R\270\353m\037\260M\300~\027TJ\177{\t\303\313\005\002\021\273\241X\214m\325\023\035l\2036\304\366\245}\323O\340G\3169vE*V\273\243"
+	.string	"\017\330^=n\266\375\322?\2006\213\216#\361\033N\022T\257\335\2413PXh}f\347#\230k5\275\311>\025\244Z\200$\314\366\203\207\330l\273[\300OA\210\260qx\3659\331\353\247\007It\001\204\311#c\366\330\2213\203}\272SdOi\355\343\037\335\335M\276\312\205R\3714\231\004\f,\0130^\307a,\224\013\327}\031n\002\300^\203\312\307i<\357\343 \343\336\326\246\3043?\266/'a\2266?H+\350U\037\2411\252,\026\257\027\233\264\035d\344\003\026"
+	.string	"\252\244\223i\021\206\301Z"
+	.ascii	"\026\346\275\210\241H\302\r\330[\205\301T\244\336\005[\320\265"
+	.ascii	"\304^\350X\207\317\254\341\302\350\243\031)\312\030\001MDR\002"
+	.ascii	"\255\272iJ\241\240"
+	.text
+	.section	.gnu.lto_write_word.part.0.17.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375`P\002\225\022"
+	.string	"\026#zH\320\362&\035P\203\3743\333\002\310%\235i\360\322\350\331\362\001oI~\353\315Wp\243\257\013\001l\275\204\260?_\217\032P\263\347\030\303\2757%\3410\222\253Y\234\017\272\215V\203jV@OTU\202O\354\336[\312\224\002c"
+	.string	"f"
+	.string	"_"
+	.ascii	"Ls~\t\036\255\240{\364\327\331\027\222\301\261\355\263x\020\315"
+	.ascii	"n\202\337\217\227\262\261\351p\203\232s\262\036W7 \037\341\t"
+	.ascii	"\310\307Eq\332#\\\2254_m\336\314#\003\245%\b!\327\303\346\201"
+	.ascii	"\370B\007O9B\001\274\032<\217\216\242\343\2567^\215\352\200\313"
+	.ascii	"\024\312\234\323]\210;u\333\021l?\260\365'Cf\211(C\305\223~\245"
+	.ascii	"\253}_\351/|\030\271\037\3719\253\272\031\234n\311F\310\307\375"
+	.ascii	"#\031\037g\225\355'!\275xUCzY\325\276\351\261\344\234\202\240"
+	.ascii	"\346\374J\036\335\240\243\331*\257\376v#\030\370Mo\365F0\026"
+	.ascii	"\231s\207\307\002\325\023\311|(\206\344\233\037p\254j\337\305"
+	.ascii	"?\332\207b.`\316\236\031\001sw\274\007\240\363$b\327\307\360"
+	.ascii	"/\022.\311\t\240\242\0345\025\342\021\335\325\265S,\350mpW\033"
+	.ascii	"v\306\266\312c\300\2729\347\211\317\224\241\305O\361\350\307"
+	.ascii	"\310G\335\343\216 \347F\220\0264\032\245\353\343\225\207s{l\251"
+	.ascii	"NE\265\214\352\370\244\033\376\366oT\353\211\376\217\0248y\232"
+	.ascii	"\323CT2\227Yk&\223/\227\013-\f\321u\273Lb/\225\326+6\223I\250"
+	.ascii	"\220Ba\005\346b\255\244\264TX\256\230\214er\3000\226W\2145\203"
+	.ascii	"\301b,\325\267\307-$t`\311\217\273\210\211\0215V\303\335$S{c"
+	.ascii	";\265F\241\331\032o\224\353\004\333\237\333~\300\233\206\214"
+	.ascii	"+Wo\034tj4\252)\356\204\035+\026\210\r\036\034P\211\200\202\220"
+	.ascii	"\002- p\002\231:\336*\3221\262\300O\306\227\235\373\341\341\213"
+	.ascii	",\002\225a\316v\341\246 =3\0134\035\030\\\361O\001\231\203\271"
+	.ascii	"\2014\033\017\314\001\334\203\316\025\216\252\224\217`\006`\321"
+	.ascii	"4\320\260gc\211\337\322;\330d\006\326\311w\272YA\322w\262\332"
+	.ascii	"\337n\200\320\357!\223Uc\367\301@\236\203\232\320\\sO\bc"
+	.text
+	.section	.gnu.lto_config_streamer_erase_tail.part.0.18.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375`\177\002%\024"
+	.string	"\206\345\202I\320\360(\035\330\251~\344\217\021\372t\002\330\263\226sY\245\312\301\335\230\233\355\301\364\322\374\033!ur\030\217\301\272\361\307B\250V*\332\250\324\001\025^p\205\227:\033\300\204\026\333E\227\017\006D\021\363\267F\b\331D\312\224\002n"
+	.string	"i"
+	.string	"n"
+	.string	"\265\233\370O\314\346}8\235\361<\033f\272\2479\347\352\362\300A\300\313\357\003\300\313\005aPc\027CP~\253\250\230?\276\\T\375\364x\240\261y\3501\316\276\273\316\2140\n*\255\247\346\022\302\322\2166j\370\367E"
+	.string	"\"\261\3431b\3706\267KR\2151\272\337]\201\222\023m\254\271~\034\025\222\3149}\331\315\235\272\355\033\333\017l\315\t0\226BxmN\201j\324\247\026C\251\006\345w\242{?\265>\367?"
+	.string	"\310\352g\316\f=\035\263\203L1\342D\267\217\302\305\337Ye\373D:\230\206\350`\23725\324\254\211\207\306\234\270\220K;\020c\266\312\252\317\271\\\250\245"
+	.ascii	"n\322\324\254j\377\304q\261\013\265\\\300\234\266&\2449q\013"
+	.ascii	".\315@\2744N\264\017\344\022H\346\001\320\221\272\244'\0332\355"
+	.ascii	"yo\340\b\247\306\2677\1777\001\301}\r\315\210\321\034V\251\\"
+	.ascii	"\233\002\212\236\006"
+	.string	"\256\307\n\027/b\366\305\373\215\321\2243\332\275\331\2660\017\003w\277m\240$cf\023\366\016\003uw\277C\206\003\214\366l\273n\004\023\347\234#~\321\205\n\276\210K\277\005\274\324\375\356\tn\360p\004\311\264\247{\363\242>\022-\223\022\225\217u\263D^-\224\222\326\213eE\202\311\311\204\024\027k\225rR\202\262b\275VV\"\b\354Ri\275V,.\327k\245_\233\277\373G\210\332TjM\"[\030\221g\036j\227\307T\202'\334\2335\307\207I\206{\342s\244\337\312\235\361\312\375\207\241\0266\353*`\242\270\004v\202d\337\234s\202\342<\f\224\033\356kJNE86\026R\344v\353\0013 P\002A\n\223\007)\351\335\332\025i\251Z\030</g\207\215\353h\276\027#m\323`f\201e$\312\222\024c\367\022;\210_:J\360\003\225\320\007\343\235\324\265\357\236Et\202\213$P<\264\301"
+	.ascii	"\025\244\f\0259\273\003\022\306\005\n%\266\202 \b\235\277\223"
+	.ascii	"\275}\355\006\024\352=trk\326q\331\007\3565\021\351\343\3326"
+	.ascii	"\324\342\030LQ\360\306`\233L\by"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375`\027\001-\b"
+	.string	"\362\013.3`m\322\001U\013\245\264\017\216\320\370\305V\021\r\303 \036\025r\037V\263\013\007\301\006\r\"\003C"
+	.string	"%n\003\274\024af-!D\335\232\264M\266\334I\006\031a_Z\206U\026\205p\025\205\024\216\324$S\2440:C&0*\fu\341A\276\264\f\243\2362\250\232c\035)\351x$\247\260c\207it\230\244\025r\234\236O\306J\326\207K*\3021\007\237\f.\025\234\362Z\233\231@\360\312\003\277$\310\211\205\207\300-\001\257"
+	.string	"<r\270\264ls\212\346P\346/Z\034\230\253D\203\310\347\242\272\006\352\266m\033u\250\2601Z\033\231\317\374\260\374vw\247g\\f\272M\037"
+	.string	"\314Kh\227\241\r\035u\b\323\234\006I\340\315$j\006\007j\007@\007@\347\003\271\370K\377 \214\207\255\233\200"
+	.string	"z"
+	.string	"\302\365\360\r\360G*\001d \f\370\263\223"
+	.ascii	"p\003\215k@\341\f \327\2522\020\\p\234\016\246\023"
+	.text
+	.section	.gnu.lto_.refs.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.ed8f292310574970,"e",@progbits
+	.string	"(\265/\375`\006\021\005Q"
+	.ascii	"z\207\244\035Q0TJ\032\016*\3065\007e(OV\333\377\226\220FX\036"
+	.ascii	"\376\375u\234\372Y\374\370\3650\263$p7d\2763k\364-\206\002\200"
+	.ascii	"\027h\3665\314!j\242\326\303\031=\317\005`\340\355x96i\262\013"
+	.ascii	"^\355b\037\244\203\247\353\360\330F~\023)S\204\001\303\001\322"
+	.ascii	"\001ck\366su\300\201\001v>\300\230\332t\3477\313\367\b\030\272"
+	.ascii	"\005\340\255]Y\257\370\334\"\326\210\035c\261XrD\257\346\342"
+	.ascii	"\245Q\222\006\216\317\273\200>nY\350\366\n\214o\231\n\3351\271"
+	.ascii	"\266\216\006VC\226\360\231k\001\335)Ke\307~\266\312\027\312\256"
+	.ascii	"\337\031\327fv\257:\2734\267 `|>\005\364+v!\252\226q\027\350"
+	.ascii	"\367G\247\263?\272\037\200\336\007}\017\272\323\344A\317U\241"
+	.ascii	"[&\357\327>\3712\327\3531d\034\307\330\\\335\3532\317\356\342"
+	.ascii	"\256\213\234]\0275eW\305/\335y\024\350\031m\261=\272\026"
+	.string	"\253B\367\263=\272\177\231\374\273\265\\7\313\251M\312\006\353^y\316\2542\343\024\237_\267G\207\256\n\035\003\273\200\316\317?)\360~\266\001a\314\227\213\020\376\265A\341\350\317<U\324\214\376\245q@\007,2`,\377\265\374?\342\377Z\023\377\325N8\003\377W<\200\237-\370ww\306\277\020\224\260$<\305\3175\233b\204\337\374\374\300\1770\377\303\374\333\201\b\377\275\374g\342\377\227\377b\276\334\276\3633\003\377j\020\302k~\006\341_\017\376\335\340\337\b\376m\340_\027\377\242\377\036\360/\213\177\013\370\267\347_\025\377\362\376\335\375\313\377\346\376g\371?\346\177\225\377/\374\377\372\277\302\377-\377\313\374w\342?\231\3775\376\273\375\347\372\317\342\277\331\177\234\270\270\270\270?\347\363\263\222\037g\201\2353@\331\035\244I\006=\"V\224z\213\376\377\237n\342QeR\021yTf\261\325'M$\217\272\366\224"
+	.string	"\315\034\322\352\252$\236J\"\367\332F*d\033\225D\034\352\332\307^\225\304\2356\"w\324\265HT\231T\310U\231J$O\033\233\330\306\342\024jT\"U-J\344\216\312,\"U#\025r{U\366n\261\262R\021\223\232Y\344uw\323\272$\342t\027\217MDc\247\246bsj\035z\233J\326!\335\335M\004S\253R\356V\244n\252H\224EI\335j\355D\001q\211kw+5\022q\273\223\326c7\222\022\206\244r\225P:6\257\215\305&\244*%N\022\222R\251\221L-ReV)aT\201\302\\6\322J\334e\253Q\035Q&q\335xL\253d\323\333r\355\200\225\244\214\023\271\035L\310\210\255\\8OOV\312&\2306[ET\2011\231u\333\225\371\240&\206\31715\034\225\364"
+	.ascii	"\005eb\277\354\332zY1\033f\301"
+	.string	",\333\216m\333.\361M\333.\367Y\273\215J,\332\n$uF\223&lD\254Y\216q\247\215XR\272\206\240\262m\213\304\242m3\2716\024\007`JK\336\232\250a\341\372apyY\216qE\240Ki\211\326\256\377v\3751dl\333:Yf\016q5@Li\211\326\202\375\033\245m\303^\266M0\021\262\246\3708\260\202\333VU\212\363\333\205\362\317^\241_\"\350W\211n\022\333\334\261\233\355\226\237Le\222h\341\363\333\003\275\r{3\335\027\n\265\262Y\266\231\024\201,\214\255\273?\301\017\303l\245,\331\212\245n\252\036RlY\033\"\352\255{\325\262g\033a\232\332\370\344 ^\226\354\362\306\003'\311!Q\305\005\211OF\222C\246\024\305l\re \316Y\377nG\246\003\021\252\264\345\277\263\tK\223ZnA\177f\261\262\342\253\335Y\221\274\250K\024zt\031\343\303\371*\251\366Fd\321j\230"
+	.ascii	"\203:\"\214\253\252\330\210\217\222\330\206\001\362\310%\353"
+	.ascii	"\255;\371\243[\325&ID\316F\270\b\2170'I>\231\007]\362G\2212@"
+	.ascii	"x\007/\345\312\313\025{\234\211\361\311C\026\215\261\216H\231"
+	.ascii	"\235;\246\246\300t\335\274}9\001\304M\210\020V\3214\313\235r"
+	.ascii	"C\177\235\005\t\302\352\f/O,wIK[E(>|\260\224\021-P@\336\322\300"
+	.ascii	"\240-\361\343,U\306S\013c\023\302'\347\240s\203\027\2535>9\271"
+	.ascii	"ep\322\312H\371\262\344\301\203\243:\3319.I@\001\321\342%(4["
+	.ascii	"|>\027\365\364'\216Bw\032\211K\220e\016\315\315\f\016P\347\250"
+	.ascii	"\2653I\t\2544|2r\210+\314$|\362q\321P\251\037JO/;yT\331:C\203"
+	.ascii	"21\261\023\332_I\024K[geMg\247\265\233'\260\354P\325X\007/\261"
+	.ascii	"\016V9\211\223X]\253\037\311\037T\311\214T\021\245\263\212B\271"
+	.ascii	"2\302\310V\316\230\234\370<OA\317V("
+	.string	"\034#\301qQ\327\275\253\362\351\270O\254\231\357\231\237\341\"J\354&\256\375d\263\264\004\005\344\255\223\307\237\237\211\347\342\313p\272W\354\226mph\370\\4\3349\034\272\312\316p\307\3354\221D\2541</\270\252\346sl\323\354\022k\243W~\300\212\342\363M,\331\377\235\016\211\2473f\340\320\257\027\364\347_\327\rU\263\366\021\t\347[\263\373\363\3636\267\b\374?\003i\257H\250\305\220\017H\364\023\002\217x2\b\005i\334\260\360\242\027D\300_:\024\002\371\206\216\214\204\200?\240Tx\004\024\200\221\321\021\020\030\004\332\f\203t9\202i\3210\b\264\261\321\363\031\235C\237\360\206\357\206\316G\324Sa\004\235\027\275\240\261\202\t5\200\206>\242\2647lQ\003g(\r\266p\243\227\022\005S\025\202f\324\370\200\006\t<E\302\037\360g\243HxddCx4\f\240'h\3050\355\r\205=\303\037\360\007"
+	.string	"\001F\277\3360\310'\354\245>\027\027\272\221\340\3050\355\341x1\224\006s\004\371\206\2774\007\317\205~\251\017\350#BOA\005\021Tp\301\f6\303!\240\017\007\216\236N\030\304#\024\372\322\241\241\236\215\217\206\237\360\034\006\245C\034\273!\240/\367\"\005\036\304\341K\201\206\301`\n\204b\030t\201M\f;\f\2121\301\020\370;B\017\003F\b-XH\241\004T\350E\352\273\321\363\245Ca\020\321\317\0060(\004\004\374\365n"
+	.ascii	"\t\245B\240\027\t\344\330\324g\303\306Q\f\272a\217\323\324\227"
+	.ascii	"3\n\006A\b\252\031\362\311 \0244\002\036\241bFx:\234~X\241\242"
+	.ascii	"\032\317P\351\340)Y\266\251%d\311R\230\b4\213X1\212\303P*Ll>"
+	.ascii	"D\341\342\321\007\331\023\260+\0353Y;\226+\016\226'MF\206\302"
+	.ascii	"Qh\340\274\230\360\023^\243\344P\244\212\311Lr\232]qF\370\364"
+	.ascii	"\362\342\265K\334\222\247d\243\362e\252\353\357\342u\275\372"
+	.ascii	"\311'\256\311%\353m\327\303U\026\032>w\214\327\0324$Xa|\276\006"
+	.ascii	"\207\037\316G~`&\271\264];\251\314\211\301\322\305\214V\253\311"
+	.ascii	"\037\024N\230\234l\321:39s\305\220\3610ZA\244\025\371\344\255"
+	.ascii	"\347$\317\310\330\224\360\222\177ws\204\bS\210&\320G\340\325"
+	.ascii	"\003\211\344\223\205x\030F\022\201`\250\241(g\0344#3#\022D\222"
+	.ascii	"$I\007A\005\204 g\245\264\r\022\240\365<\025*\246FDFRP\220\302"
+	.ascii	"\036\007\232\372&\363fOi\321?\214CF\004\177\n\230\270y8p\225"
+	.ascii	"f\254\004\350\312,7d\225\372\267IA\3479\305\026\340\362N\351"
+	.ascii	"R\031+(\336\303"
+	.string	")\rk\335\"q+\344~\022\360\331\361\200\2360w\032\242\207Sf\262\264Ql\334M\355'\302fx\021\201\355\034T\203\350\364\005\204y\365\244%\023"
+	.string	"\342V\357Li+\250\344oR\025N\320\366R'\212[\245\355\206D_"
+	.string	"v\300s\262\020\305D\033\276)X\373\3265\321\b5\224$\311\247S\"UP"
+	.string	"\305\227\003/\323\212\255\002\350\262\335\037\257\334;\216\201\263\031(E\223Y\307.N\305\013\030\355\t\224\305\303\177\t\324\2751\304r\f\rl?\3179\025x\326\373\314~O\2505'by&PK\016W\034\247/[\307\037$\300\330\026\217{\2766\317\212\002\031U\276j@\244$\201\262"
+	.string	"\217\005\"{\252\254O`\3623U\344\017\003\214~\222\232\004D\252\322\375\323\312sB\005\240;!c\177j\333\262\232>\354\244\337\306+\027\222o\032\311\273\265C\325x\345y\004\200M\022\361y\322\267\264r\206\213g\006\332~\202\274\301xpnF'M\200\253\200\377N\336\001h]\016\036i\200\341\373((K\250M\221\324\331\243\237W&\001\221\346\207u"
+	.string	"\276\322\335W\036a\316\021\222JD^D\b\307\2642P\247\211\251.\321\252\030\257\233\232\351M\273="
+	.string	"T2\260J\034\272/&g\324\330h\263V"
+	.ascii	"\252\006\275\315\334\343\013\207^\2159\\\274~\207\323O\300~n"
+	.ascii	"F\232\237\346\201\200[\331/c\253 \261\320\310S\241\345\371\377"
+	.ascii	"\216\335\031\370\034\325\023Bv\246\3556\"\027M\020^f\331\204"
+	.ascii	"\324\331Y~\275\312\006<%\271\"I\240\337\222a\316a\233I\003\212"
+	.ascii	"\027\351\325Ab\336 \324G\327\257\036Z8\001\305\204\272g\214\034"
+	.ascii	"Dz\334z\202\377\006#n\245\331\177\227M\303=\347&\300\027\234"
+	.ascii	"\353\336c\360\037\334\375\254\032\n\343b\177\251\311a\203\273"
+	.ascii	"\357\372\233L\017w\334\200\273\305\316\365\305\257\320\217\201"
+	.ascii	"~\326\274\333\177\374x\230\343\377\246oN\211\0339\306\021\342"
+	.ascii	"\360Q}\275}e2\326e!\3449:\001\327q\213}\312\302\305_>~\214\213"
+	.ascii	"7\376\341\366\021\034E\376\0339`\234K1\333\022L\336e\374\201"
+	.ascii	"2\353\263\205\023l\216\364\333\207\034\b]T\357\"4\336\377\356"
+	.ascii	"\377\303\306*\322U"
+	.text
+	.section	.gnu.lto_.symtab.ed8f292310574970,"e",@progbits
+	.string	"config_streamer_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"config_streamer_start_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"config_streamer_status"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"config_streamer_erase_tail"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ed8f292310574970,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
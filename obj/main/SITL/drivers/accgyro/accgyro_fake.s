@@ -0,0 +1,566 @@
+	.file	"accgyro_fake.c"
+	.section	.gnu.lto_.profile.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375 \367\035\005"
+	.string	"b\210\037(\200M:\270\035\2026Dm\031\332\265\020\201\306\274t\001z\267I\312#A\0234A\023t\035EB\310\336\222\310-w\2222\271\257\276\247\276\237\316\0212\331\\\200e\321fYT\372x=\274\276\257\227\336;j|\020\224>]C\207\206\003\232\"\237a\362\343\260\205Zz\177?\314d\226\306\331\221N\305z\273\273\333\227\002Fq\221\240\320\030\277\373\365y\001'.\f\243Ye\003\203$\003\351\t\017"
+	.ascii	"\210\n\037\356\305B\032\320\bp\374N\t\3406\220\005\344\003\023"
+	.ascii	"\273\273PY~%\365\335\r\033h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375 \307\205\002"
+	.string	"4\002\273"
+	.string	"\013"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\001\001\001\003\005"
+	.string	"\001"
+	.string	"\001\006\002\b\t\013\004\f\r\016\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\023"
+	.string	"I\t\001\354\326p\"G@Q\004\356\274"
+	.string	"w2\215qf\240\231e\355Tk\361$"
+	.ascii	"\354\245pV\031\2533\306.\230\r`\001"
+	.text
+	.section	.gnu.lto_.inline.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375`P\001}\006"
+	.string	"\022\211\036)\200EI\007C\\\005\fx\260\200\001!\252`)\207\n\001W\030V\241\3375\0274\t\232"
+	.ascii	"\nk\r\221\366\377\326\310\336;\005;\257\310\304\312\260 \351"
+	.ascii	"\371\206\013\377\244l\341\333\240j\313f\313!\334G\023\264\376"
+	.ascii	"\237\226H\271D(v\363\213|\264efVF\023\303\004(\b\230\260\227"
+	.ascii	"P\200\222X\016\370\037\336\3671\222`\240\002A|\217\3157\332:"
+	.ascii	"\036\377\032\266m>\033\023\001! p\242RU\347\001\366,p\206.\030"
+	.ascii	"Y\2575\250\025o\036Y\3112\234\340E[\301\345\027[\2117EV`n\312"
+	.ascii	"\355\375\322aa\236e\306\212A\357\327mnb\367B\330\305\021\361"
+	.ascii	"\001\314\no</\261\314\210l3\241\325\205\2105\b\256c\024\305\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\r\006"
+	.string	"\242\211!,\200\265I\00730\003+{b\234\031(3\003 q\021\t\017\376 \314\232\261\037\024\214\211TU|Y\324\030\253}[\311\222\336m'\031\323$)\332p\225s\224\0230U\002N\345\n"
+	.string	"\034\212@\242\\d\321l\022\361\001\023\370\306\367\302\1772+\234\206\023\036\341+\352#i\026\243\265\003OXv\366\206\330C\f\177|\020\365\221\232\265\343E\301vI\345\366a^=\257\333\266\341\370\224\277\301\216\355c\231B\332\r\002\027"
+	.string	";\317\200g:h\0170\f\b\332\240\025\214E@a\346\245c\212\n\334@\336*\\\006<\277B&\260\r4\3468C\360\336 \007\200#]\t\0078F\232\237\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_.pureconst.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\004\001\232\004\003\232\004\005\230\005\006\230\004\b\230"
+	.ascii	"\005\t\230\004\013\232\004\f\232\004\r\232\004\016\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"\005\006"
+	.ascii	"\202\307\030\"\240'\351g]/\276\250\337\277\252\257\377\377\277"
+	.ascii	"y\261\301\354\377?};\237\337~\373\215\264\335\032\2212\005\317"
+	.ascii	"\310$3\026M\257\301J\335-\301\215\215\242c\212\226H\f\321\333"
+	.ascii	"\255\355P\205\2310p\035\245\274Y\261\374\226\005r\353V\233\276"
+	.ascii	"Ah\034O\207\312\347Sn\250R\200\310\234\027\312\241\366\266;\363"
+	.ascii	"\021- \360\202\221\232\3354M\304\036pd\227\2701\210\002s\200"
+	.ascii	"\320\266\222Yl\242\007\302\304\004\313\243.;\362\273@\303\306"
+	.ascii	"\205wC\024\003MM\207\275\261{\007Rr\033\376\n{Ap\321'\216X\330"
+	.ascii	"\213\001\207\350\260\367\302\232\331\204\317\365\272\243\210"
+	.ascii	"fF{\345\262\357\006pE\013C"
+	.text
+	.section	.gnu.lto_.lto.ecdf96f49bc7bd46,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeGyroInit.22.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"U\f"
+	.string	"v\027UC\020\221\223\0168\221\354tx\201B P\224~\020C\211\032\200\270\235\3576+\210\\n0\005\001\350\023\264\025s\006F\205\005\\\376\311\244\001"
+	.string	"\020A\245d7"
+	.string	"\332/\261"
+	.string	"D6\275\364\215T\262\267\224)\005A"
+	.string	">"
+	.string	"C"
+	.string	"\004\246Ckv\214w)\253\240E\211K\314\356V\n\342\332\237\246\346\277\345\232\310m\177T\207\353\363\224V\314\b\300\221\274\216I\210\370\226\347\006n$\023"
+	.string	"\203\335uF\216\303\ro\273\201\355\005\366\035\004\036Dr\306\356\266T\024\373ow\327J\262\317\362?Mg\246\257\231P\362\322\221\261k2Sc]@\026\"6\266\237\366G|E;\313\350\003vI*`v\273\217\023P\207\356\336\231\016\251\007\n\301\004\f\222\2241'\375\320t\265;<\3621\265\200\006\335\354\243\310\300\2116v\027\013\324\356\"8\361!2\360Be4\035^\365\344%\236<\365I\274\304\310W1\006\220|<\364A\246\303L\021\363a%X\026\302\361lm\\\035 \t\017\260,\204\303\262@\225(\273>BY\204\212B\b\344QY\231\250\332\360\030\253pe\325\005\f\313\252M\267\177\253$\177:\032%\021\035y\002\322\266\256|\264\352\366\024\231\022\214*\212\017<\003\024"
+	.string	"_\2417\023z\3051\260\n\203"
+	.ascii	"73\027\320\373\017\323\374\270\365xJ\212\t}\276`G\305\264Q\201"
+	.ascii	"\024\214\272\204\325\254F\207\273\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_fakeGyroSet.23.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375`\005\002\315\020"
+	.string	"\206\235jI\340\262(\035`e@U\003D\317\256.\"\201\265\025j\2561\244lH\201R\344\020\257\210\241}p\212.4\333\210\255>\306\020\301f\017\212Eb6\3041\314\260~\216\321\301;\337\342\221\203\203t\207\263\312\277Y\356\261wJ\001O"
+	.string	"S"
+	.string	"V"
+	.ascii	"uW\206\247\266\273%?\b\275\222\314O\3735\217\215\227\261\\\300"
+	.ascii	"\356L\254\266K\226\354 \364j\362\006\270\327\320\tp\257\036\355"
+	.ascii	"\333\201\017\243\033\210\030>\273\353\321\024\037?G\377\263\003"
+	.ascii	"x\275\264|\202Lv\327\363\365R\342\246\267\255\300v\312\236\252"
+	.ascii	"k:cs\323\242\343\374\240\337\374\3656?\275\354\237\001(\234\020"
+	.ascii	"\342#\b\005B\356\210\"D\266G\265\321\302\366\375\031\247\241"
+	.ascii	"<\307#\231\030\030\024"
+	.string	"\273\223\3612\3459\25654\273\333\275\332)v\367:;\033\2075I\326\305\025\002\302\315\315\204\222\2071\336\206\345?\224\332&\035\007\253\200\212\335m\340\337\270\016\352\003\347_ \367\372\331\007\374\260\305\304`FSD\3752u2\377r\002\027\332\342\227\257\261\232\266\327K\253^\013\021\330v\227\001\215\225\r>\013\026\356UD_\276d\305\016lV\232h\315\"6\351\232\024\205\375\221\335\r\306`Z\260r\225{\370\210?\023x\202\262p\nE\225\013\337\207\362V\"\330!%V\3602\244P*\357\023W\236\251\304\241\006P\3648\204\241\350ud\353\263G\200\221\370\351iQ\027M\302i\027\225>\"`=?q\366\204\3638\205F\245\0274C@\224\347;tX\207{%\311\\\324\322s\354\220b\001/ \220\002\2319\263\003Y\334 \205\363==!\340\f#%\354t@$\236\272\235%\004\253\004\\\177\247\254\205"
+	.string	"F>5,\222\235\214\243\300\0015\343\232\265\034\261h\313\021G\260*\243\r\214\037\264\030\343$T\037\345?\241\007;F \304 \345\206c"
+	.ascii	"F\343x\307\206\035\230R\302\0070,!\004\314\030\274\"\355L\t<"
+	.ascii	"\274h;\031"
+	.text
+	.section	.gnu.lto_fakeGyroRead.24.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375`\032\003\225\024"
+	.string	"f\343~I\300\224Q:d\2022\302\315\305c\211c7\247T\353\036\261$c\244D\221~\250\336\r$\007W8\017\315\266\346o\333\206\237\001\240\355\371\njO\177\342S<l\027LC\377\006\023Z&>\024\031\343\376\035\006\366\220M\244L)g"
+	.string	"d"
+	.string	"n"
+	.string	"V\265\237\373\020\317\211v\2562\247\320O\307\234c\213\033\250.=~%\274T]@xi\333\n^x\034\373\230\342'\300\314\247\003\r\2519GqQ<v\t\256\306\374\236\313\027K>p\243p\004=%\335D|A\026\\S\210\325\215\006\256\364\202\216\274\350\372\3416S\005"
+	.string	"3\347\264\326n \356\360\266%\330n\331\013!I/\003\2779\347\002\0337\032\374\025;\341e\312^w\3451\355\236\222F\310t\312\036g\272'\354\203s\205\354P\235r\242_e\265\224jP\252W\252\257\362\002$\025E\340i\316\237\251&\323I\362\\\330\276_\343\272\034\033\214\034\033\251\200-\367\0317\322\371h\351\001\b\227\233s\256t\354\325\345\332<\366\312\0169jHd:\225\340<b\030\370Kg\222\261gX\372\032+\274\324}`\203\302\r\361\276;\017\345\307\302\366\303\345\222\310tJw(\351\231"
+	.string	"\221ZGz\204\036GK\240h\333\363\0265\234\323:\026~)\034\031\241)\023\333\256+\305T\2529\347\367E\327\022\266\030\270!\"\024MY_GS\243\257\371"
+	.string	"m{|\335o\340\350k\327\331\346\001\306\340\202"
+	.ascii	"t\313\305U\303\2620\363\202\351\\h\265X\"\016\314\305\201\006"
+	.ascii	"VA\274\241a\331\210-\030\216\350\302\342W\006\027L\334\360z\301"
+	.ascii	"\304\325(;8W\310\241O\205n\007\276\350\016|$t\273\375\356r}l"
+	.ascii	"\3135\214lg\322\310\b\334\"D\336\273o\210\336L\341Io'cWH\220"
+	.ascii	"\2267\001\331=\351)-\341\351\376\210\031\360\363\204\373\220"
+	.ascii	"QmA\250Q<\347\234afFd\024\024\024D\031\016\200\002\231\271\253"
+	.ascii	"\007\021\320\251R3V\211\375\357\006S\n4\r}\377\243\366\275\317"
+	.ascii	"\033h\331\323(r\236Y\036&\312\371\316\241\017O3\231+\225\366"
+	.ascii	"\211\315\025%\250\315\334oT\227'\tR\352\017j\200-M\200j\3459"
+	.ascii	"\260\366\270=\357\260$^\256\330-\370\232!9\3217\320\002\030g"
+	.ascii	"{q\267\201R,\200\270\037VzMN/\362\327\266\354S\205\310\313fc"
+	.ascii	">\350Y/\002N\316;;TsO\232K\321w\324"
+	.text
+	.section	.gnu.lto_fakeGyroReadTemperature.25.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"\r\b"
+	.string	"2\31777@s\322\001\033\262w\335\337\257f?\3568\355j)<m\341\260\002\210\2736\004\374U&\267HS\365\263\223K\026\302\345A$\016\217\036\355F\314\223q\263\204\220\275S\nR\223\021\223fh\222NQhj\001\225\261\317\274\220\025\023\031%Y`\230\214#:5@\224\"b\200d(bt\024?\t\316D\223F-\313ht\335W\013;\237\273\f8\240\311\256\245\007E\354W\273\273\206\235\375\032>R6\0055\273\247\234\233\235\261`Llo6\200mXI8\017\357\331O\271\312\366\225\215\013\354v2/\273U\301\016\236[\256'\270ny>p\335\262\355\005\206\315\334+\311\251c*\351hI\355\326\bG\316\375q\376Y~p\022\023B\343\202*\375u v\327\317\003\005r\303\333F\260-a\033%\f"
+	.string	"8\303\361\212\036\025Ql&FV\301\3235ob\002\007\205\34020\222"
+	.ascii	"\025\346uM2"
+	.text
+	.section	.gnu.lto_fakeGyroDetect.26.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"-\013"
+	.string	"\266\024NC m\225\016$<\n\202\214\223\205\020\312B\206i\316\314\203\017f'\314\255\233\210\353\220\251\302\237 \214u\271=\336!\307\252\333\b\222&\026\001!\236\274\351\3562\255\256-&\020\206\326\336\3455\313\215\310N)8"
+	.string	"7"
+	.string	"@"
+	.string	"\3433\266S\3121\266S\333\006\t\0219\374\230*}\202\206\007,rw\344\264\n\017?C\377\253[0\2340\021k\231F\237\223"
+	.string	"\273\353I2A\270\265\333\356\260=b_\023\263\264\307\321\324(\330\227\354\356ZC\331W\375s\202y\221)6b\273\245r\305\276\350\210\013\266Ev\305\366\234\3667\234\203\350\252\320/vQ+\021\273\343\2071\224S\007\244\203]\321bg\036\302.j\202\221d\347q\310\276\203\330\324S\311\351x\316\002\005\234T\220\016|4R\273\342Iv\202{X@\331]\021\277\003\003\220\205\314\302\251\037\332N\251\204\022\037b\255\bb`\005m$\366._\247\033\220\001+h\343y\035\367\251\237\002N\325p\0058\235\207\363\352\207\273x\0304\360U\016\001\bV\2562\356\355?\334\bd 1C!j\rl\327g/\330\256\001\224e\021"
+	.ascii	"_\241'3 \f\033\267\020\243\346\002 \037\270\031d\004\244\001"
+	.ascii	"2\006\005y*\221\257\31682A\3045\032\262C\304\3275\237"
+	.text
+	.section	.gnu.lto_fakeAccInit.29.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"e\f"
+	.string	"\246\227UB\020\221\232\0168\221\314\223\203"
+	.string	"\036"
+	.string	"\277\240\256\254\031c\\5l\217v\343\003R\214\333\f\354\361\210\337H\373&4\230W\037\221~OH"
+	.string	" B\021\266\222\n!\177\245 @"
+	.string	"Qd4jK\366\2262\245B"
+	.string	"?"
+	.string	"E"
+	.string	"\002\244Ckv\215s\242\335\220\220\361"
+	.string	"3\263\273\224\226\270\366\247\251\371\177yG\004m\177S\210\353\023\351`\334"
+	.string	"\001\251\274\220\217\211\370\227\347\007PJ\346\306\301\356:#\b\304\ro\373\201m\006\366!\004#P\262\306\346\266T\026\373ow\327\032\262\357\362?Mg\246\337\321\240\233\2611\300\305\356\247&\307\312\2001Nx\330~\332G\361\221v\027\317\003\354\206^\304\354r\b\274`:4\367\020\351pz*a\005\r\225\244\361G\372\034\351j\223\224\344c*\201\016\272\331o\301\341cF\264\261\303`\230vW\001\013\223N\001Q\213G:\274&X\221\211\"\236\372)\256\302\343\267X\303I>\036\372'\322\241\201Ohe\024\226U\251\255\221\213\244\242\020\001\3136T\260\254\212\352d\227\t'\233@Y\340T%\224\225u\250\021\021c\027\256\214\312\200a\031\345\301\355\337j\310o\324\341\350P4\345\001H\333\272\362\321\252\333E4]\214*\213\017<\003\024"
+	.ascii	"_\2417\023\232\3051\262\n\206\02073\027\320\373\017\323\034\270"
+	.ascii	"-<\227\306\354\213\276\025G\255\267Q\353\031`\271X\333\254\246"
+	.ascii	"\210\273\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_fakeAccSet.30.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375`\f\002\255\020"
+	.string	"&\335hH\340\224(\035\250\332\201\211\313\036\226\\\025\236\345\234\243L\360o\3111JT\325\252\340Pz\326c\224\340\367\324\206\260(\322\361}\0344\302[!\t$f,BX\264\b4\370\314-\274\323"
+	.string	"a\334\314\b\252o\331b\357\224\002O"
+	.string	"Q"
+	.string	"W"
+	.string	"9\264\335\035\371\001\350u\300\374\264\037\3433\343iZN`W\006\006m\227\034\331\001\350\325\344\rl\257\240\027\330^=\332CN\266\3662j!f\360\354nGQ|\374\034\375\307\036@\025\343\362\371\211\260\273\236\252\230\0217\275\355\004\266M\354\211\n"
+	.string	"vwMe\354m:t\233\377s\330_\377\372\351i\376)@\264\202\2652A\204\002!\027\246\247\310\376\2507T\330\276_\3433\324e\026\271X+\224\315\321x\231r\231)\030\341^\355\024\233{\235\234msD\002L\b\004J\276f\374\213\305u\267D\327\221Skz^Pj{\301s\260\210\032\3708\216\343}\340\274\n\334^\037\373t\301\354\260fV$3D\375\322t2\2572\002\020\324\305/\177s\232AT/\215rZx\240\265\273\fl\254p\360]-\333k\210\276|IK\306\302EI\"5{l\362e\322\023\366\0036!)X\271\312?\374\373<\352\217\004\236x\030J\241\250\222\341\373\274\356$\202\036L\342\205N\203\311C\351>\361\324\221J\034n"
+	.string	"\305\256C\030\212\035G\246\036\373\204\033\262\246\223\242/\263\n\237=T\266\020\221B\347\245\315\266p\037%\020I}\301xv>t\307{\360\2307\316V\253\2431 \240\002\0319\273\001\261\270\360\031\"Bh>\302\224"
+	.string	"\324\200\230\370J;\317\tf\t\330\356\216\217\005\002\246C5l\242\035\215[\223\2720O\264\003\343\272%\311\020T1\030\353\321\210\206\n\342\030\3532T\215\022`\241\tw\2148\304"
+	.string	"\312\rb"
+	.ascii	"D\331\021\211\343\035\3155\230A\2207\314\200#I\343\302\304\340"
+	.ascii	"\025ig\n\274\313\213\226\222\001"
+	.text
+	.section	.gnu.lto_fakeAccRead.31.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375`\031\003u\024"
+	.string	"\026d\200I\300\322Q:@\260\0218\324\340\254i \326P7O\271\3338\310\241\372w\212V\225\330\371\221\301\t\332\035\254c\371z4{NkTC\246\365\211D\206\355\353R\034\025'\237\347\244x1\013\321\231\200\035%"
+	.string	"2\310&R\246\024i"
+	.string	"e"
+	.string	"o"
+	.ascii	"*\333\252\366\201\036ts!\233\227\314\371\303+\2323\207\342\006"
+	.ascii	"\342\245s7\t/\305\007\b/m;\201\202\033\303\236\273\355\210t\320"
+	.ascii	"\361\300Bj\316\334\270%\016\273\004Wa>\316%\n$\037p\237`0\365"
+	.ascii	"\340\321z\276\340\211-\251\246\242\311@\223%\237\037\037\272"
+	.ascii	"\352\320rTET\346\234\326\031\215\347\016o{\202m\027{!\004\263"
+	.ascii	"\357\034s\236\213\300m\316\271\300\205\214\006\037g\023^\222"
+	.ascii	"\354wW\237\256G\203\007\"\246?;\227\243K\302>8\367\307\016\325"
+	.ascii	"$\027\372E\253\245T\203R\275R\375\022\tERA\016\374\346\334\371"
+	.ascii	"MM%\351;a\373~\213\357hjJ4\266n@\315\351*NT\363\234e\017\316"
+	.ascii	"\0064\347T\325\330\252\313\265o\354\3324{\212\351\017\301\221"
+	.ascii	"V\3049'\003\337\350G,v\313J?[\205\227\272\017jS\266 \337{\367"
+	.ascii	"\215\334p5(\033\020TL\177*#ji\004\250c]\367\b"
+	.string	"3|\242\200\310\026\347&f6\2455,\374\272\254\360!\323!\266[\217\001\023E\334\345\367CW\021\265\035\266 \241\021%Y\177\367\002\243\237\271\200lq\374\335_\314\250\323\234\363\001\306\220b\200\305Z\255Y)-\230\225\205\026\327\253\346\002\213\265\032g^-\016/\257\n\243\314\313*fd\275f\306\224\023\2732\264^\343\006\227\3535\252r\261\203s\177\0346\341v=\360Cw\320\024b\327\333\367.\367\203m\271V\211m\216$\"\002\227G\323\227\316\244C\357\243\360\022\024\262\233\003\007\312\223n\354\002\3401J\341\323\265\261\"\340f\n\257\301\"\006> \220\002\031\301\243\007R\334\377L/JB\3573\020\3202\f\032m\311\\2\313s7\332\2203\356\260A\302\327Lx\214}K\233_\311\270\214\001\276\037b*\fO\013\221\272\365\240\001`\023c\"\257\354[\264mj\354l]\370\210/\036b\327Yj\031"
+	.ascii	"\023\2134_)\213\305\345,bQX\303\261\023V\007\215\351\332`\216"
+	.ascii	"Y\341O\264e\007.\"\037\342\200w{\316w\222\261-B\030\317\371\303"
+	.ascii	"\031*\316\215\223\236P\324\n("
+	.text
+	.section	.gnu.lto_fakeAccDetect.32.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\025\n"
+	.string	"f\323G>\020\005+\035"
+	.string	"p/\265\200m\037\243\302\212\316\013\033\342\320\250"
+	.string	"\351S\033\200\n\335\005\235\216\020\306U\332\347\f\030t\331&I\030*\212"
+	.string	"P\270\364\234\340\210}"
+	.string	"\200\020\334\320\341Fd\247\0244"
+	.string	"2"
+	.string	":"
+	.string	"\265\363\202\357\325\266\031\032N6\177\302V\177\305Bh\272\335\023\364Hn\236\232\376Snp\0223\222\263\261P\247\001\021\273k\252b\265n\357\266\021lC\330?\b\273k\317e\177\366\323o\342\246\253Qh\331]\355\002\254Lu\211\331\276\355\223-`\233R\373(\227\235>3\235`\327%\273\355\236\013~\350\274\372\274\347{\036_\003U\033\030\335MH4:\215\224(\301\2514H\236\231\335\324U6\307W<:\273\353\340\253|\224\006`&\257\276\351{\255\255\027\226\234M$Ew\366\211\242\336\313>g\003\242\030z\026?\243(\264\240 \313\022H\024C\220T\216\035\241\262\002\304\b\205#P,I\340'\301d\306X\202\033$Y\202>\367\234\365\\\276\371]\340j"
+	.string	"hR\036\210}\320\347\f"
+	.ascii	"^\321\033[\024\204\305\2004A\003\251\301\305\240 O%\362\325\031"
+	.ascii	"G&\210\336e\342\353\232O"
+	.text
+	.section	.gnu.lto_fakeGyroInit.part.0.43.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\255\n"
+	.string	"&\023F<\020%)\035"
+	.string	"#\020 \002\026\005\033\005D\327\202d@\020/|\017\300\242$\035rd\261\3557\2745\023\317\006\223 Q\004\001"
+	.string	"\244\bk\001\244\251\245*!\307~\266\306j7\331;\2452"
+	.string	"2"
+	.string	"7"
+	.string	"\266U)\026m\237\2170+\301s\"\373\331\335\356t\276\\\374\224\232\350?v\001Vk\3659\320R\271\024]\013\240\330]o+7\275\355\007\333\026\366E\001\207\335\376\214\312\2179d\3730\325\307\024\267ba8\265\224\366i^#~L\275`\327u\203\263;:\234:b;\365\370\003\320\351v\003\320i\350\3642\001tg62I\346|\331\336\244o\363a7\\f2\304)\310f2\241pj\213\240\344Y\006uf%s%\347\313S\273\266\323eO\331C\320\262\213\022"
+	.string	"\300\272\320\234\230N\250a\255 W\372\302\r\216\003O\036X+\0204\177#\260\344e\\\204\025\245\361}^g\252`\b\251bt\035$\217\243\373\252\251\033-8\364"
+	.string	"kw\n\303\332\311k;]\016\030"
+	.ascii	"/\301q\206\343\025\275\212\005\321X\201q\301hEi\236\301\001\242"
+	.ascii	"`\230+\234\253\tQ\027\325\347A`\342=\255\024\325N\347\2026]t"
+	.ascii	".0N\\\314;-M?\241\214\001"
+	.text
+	.section	.gnu.lto_fakeAccInit.part.0.44.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\365\n"
+	.string	"\246\223IB \347(\035\220\b\026\023\310\366\224\2003K\360\344\264\246{\002\210\021\350j\207!\001\354\271\rj\214\206m]X\277ih\354\211 7L\220\204\205M\346\262)\234\003*Hh\260\240\220\206\262\331M\366N)4"
+	.string	"4"
+	.string	":"
+	.string	"\005l\237j\f\332\017\036\016XO"
+	.string	"\330\314+\302\356r\237R\300\301\313\230\201\376]WH\251P\227\013*\233\307\207g\236\217\335\265vs\317\333\336\260-b?\"\263\001\201\267n\337\300\311w\371c\373\255\323C\323\206\302\301\370t\214\366\017\034\001\370\320t\207\335\325\002\006\273\241\306\247;\264O\207\227\350|j\207\350|~>\037+W\016\201\305^$\214\224,\333Z\364\023\254\330\031\177\215\314\361\311\242\311xX|\332.\245\370\224\031\0248\210\305HT\224,\313\354\331\312\225-+ 4\344\354\322L\220\260"
+	.string	"\002\246\250_\255\336&\242\337\311Fi\267y\244\316\253 \023\224v\322\024\344\211\272\222\221\257\226L(\355\270Q\365ZB\225\204K\tu(\034\255#\016t\341O\305\253\034\351\373*\027\237\005\026"
+	.ascii	"^\321\263X\020\216\025\030\027\314V\224\3003<@\024\fs\205\203"
+	.ascii	"5!\352\242\372<\bL\274\247\225\242\332\351\\\320\246\313\316"
+	.ascii	"\005\200\223\027\363NK\323O(c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375`T\001\345\007"
+	.string	"\344\nP\002"
+	.string	""
+	.string	""
+	.string	"\002\031\177\037\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006\030\177 \005\024!\200\204\001"
+	.string	""
+	.string	"\003\002\037\177\"\005\033#+\177$\271\200\202\202\200 \026\177%\025&\201"
+	.string	"\002,\177'\035\177(\034)\027\177*\272\200\202\002\032\177+\036\177, \177-\001\"\177.\377\037"
+	.string	""
+	.string	"\200\200\200\001!\177/$\1770#\1771\003\001\020D\003\001\017\340\236\212\256\001\001\244\001\003\001\017\241\341\365\321\002\001\244\007\003\003\003\003\005\021$\003\006\022d\003\006\005\320\360\372\250\001\001\242\001\003\b\t\t\b\013\020D\003\013\017\344\001\003\r\r"
+	.string	"%  \003\t\212\034\003(\002\0272\210\201\025\244\302\n\024\325\030d\340\315p\213\006\226\261vpk\027\320\371\220\315]\032$\005c\366\320\016\3377a\271\261\017\3103f\370u"
+	.string	"08=\030\2501b\313\234a\220\r"
+	.ascii	"\345G\007\035\f'"
+	.text
+	.section	.gnu.lto_.refs.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375 a\335\001"
+	.string	"\022\306\r\020\260%\351\f\303\260R\326ZB0idK\231R\252\311\211\004R\314\316\354\346\300\234R\313\005\001\246\320\216v\272\314\207\311>\026\266\214\222\3211n\026)\221\016\371\324A"
+	.text
+	.section	.gnu.lto_.decls.ecdf96f49bc7bd46,"e",@progbits
+	.string	"(\265/\375`\\-\245\301"
+	.string	"J.YCW0\nQ:\035\275\344\375\"|8u\325xX\017\252\256K\363'&\003\217op\344\276C\275 \340hG\007OCH\230:\326hM\204\021\366Q\2646\3106\374\317\334]\242\002D\323\214\211Y\225l7(-E\246\306lA[e\206\231\223a\r\021\021%{H\231R\n\261\003%\0046\004@\315\016\242\334E1\224\252(T\351\355\030(#\375Elb\240\021\301B\344\263fh0\301E\241\201\211\264\033a\301p#\302\355\320\336\362W\235w\177TY\372\372\3331B\270c2\356\373\207\373\202\007\362=\236\312\341\310P\\\311\213\346\234\177|\020\207>\220\257\002\342pL\nh\343\022\275\261\"\322\365\025\305W\213\311\304\312O\275\217lc\223\347\264\226U\207\373\276\341\276n\270\273?\352\245\034\372;\036\252\177\306+u\206g\316f\027t\353\354x\247\177\332"
+	.ascii	"\324\364 G\237{\211 \361;\276\311\315n\224\317|DcuU\227\224\301"
+	.ascii	"\203\207\340\216'`U\351\355{\205\273\377\351uX\033M'\177\317"
+	.ascii	"\030)L'\004\371\013\375\034o\203F\213\214\234\367\267/\025\356"
+	.ascii	"\013\205\3732\341\276G\270/\320\327\300a\022\205\344\b\230_\262"
+	.ascii	"z\330\263cH+l\301\236\341\211\005\267\275\202\033\316\262a\031"
+	.ascii	"\215\366oz9\370\234\340\216\276P\367+}\312\007}M\332_\320\322"
+	.ascii	"\337\007z\246C{\355a\3100\237y\314\251\244(\251\224\340\027\301"
+	.ascii	"^K\333\016\3015\331\003\273\335\317\377\274\317\237rf\346\234"
+	.ascii	"!\b&E\t{\362\327\367t\332\001;'u2=3\231Mc\013\372\363\201C8\206"
+	.ascii	"4M\301\371\034\252\301\301\264\357\271\222\216Y>\3633\347\214"
+	.ascii	"\343]\246\200\220\376\266\325\201;\220\263kH=0\3205\244mg\340"
+	.ascii	"Os\fi\227\f83\234\2304\001q_P\347Yl\230\023C}\374\210\346\374"
+	.ascii	"l\327s\250G]K\337g\316\355b\335:\036\365;\317\263a\316\314\364"
+	.ascii	"1\243\002\030lKX|9?=d\360`\003\345\363[J/\236o\301\031\n\"\364"
+	.ascii	"#\013\217\n\367+a,n\367IJ\252\276\211\345\225\270=\017\273\323"
+	.ascii	"s\3228\227"
+	.string	"\363\271/}1\336\342\326\374\312\363\214\212\034\023\354n^\305\241n\245\333\307\\\254\257\330S\036\313\371ic\227KV\320\376\266wHq\274C\332\336\205\333\261p\303I\341\266[\302\035u \354O\236\2236\337\361\354.Y\341!\344o\263\300}\001\354L\234\314\241\021x\023\253\024\303\261\001\334\002\364\373\333$\340\366\262^\261\314$z\002\334\036A\352\201\036A\332\030Wp\f\351\365\234\324\257<'\345\340\030\322n\017s/\007\263M\242\247L\226\363\323B\260\213M\212\354\257\203\275#\361g;\230\177\265\b\022]\303\314^9?\035\354\346\274t\227\340\306]\202\230\265 \313$\351\355\307\375t\f)\366\234\364\256\002\335?BR\246\373r\320\355t\335\216Dv{\225c\267c\271\351\276\312nw\3330\367\246\345\207\304\334\2067-\306\356\377\271\343@\367WP|\273#\241\333\263\276E\267\377\350\351\366)\026\335^\205"
+	.string	"\013\335\327\347\346v\337\b\272\375Hgx\240\373\026\300\203|\0044\360\304\356_\3219\335\227E\367O\260v\277p\247\333{t\273\215\036\241\373\207]\241\373\236\350\376\024\335OB\367\177\320\375\022\350\376\f\272\237\001\335\217\200\356'\321\375\037\272\337C\367\037\240\373\013\320\375\022t\377"
+	.string	"\272\177C\367\007\240\373\037\350\376\013\335\177\323\355h\335\036\245\273)\320\355\027\350\366a\267k\240\333\265t7`w#\351v\256\356\006\323\3751\335\357\335\316\327\355_\272=\205n\037\241\333Q\350\366.\335\256\327\335\023\350\366h\267s\351\366\274n\337\322\355x\335~\327\355_\335\356\325\355]\335\375\354n\021\335\355\326\3355\201\201\201\201\335\366Hw0\251{"
+	.string	"\037Er9\312Bm\231\314\027\2730]o\330*\261K\034J\201e\362?\302\224%a\303\355\024\24460\320)H{\006\r\367\f\031\356\264\0310\3343Cp\317\360\300\335\026I{\240\323\024\276/\rA-5\035=\254W\333\256\033\"I"
+	.string	"\325\376Z\256!X\224\254\376\366\f\016\334.f\253<\214\007*\021\220vv\245d\211\233\215\350R\026\275\214,\265uE\364F\215\006#\354"
+	.ascii	"Z\312(k\0252\320\234\331\025\t'\2166bKoJ\214\256h\233\277\315"
+	.ascii	"\225E\2378"
+	.string	"\234\317\3310'n\002D\346\245\312\277x\237\303M\345\245r\204\326\024*PVm\236\244\312:\331\247\244\020]HVm|Q\376\312\321\\\220(]\335\337%\371q\225\3633\210\325\262D\354\021\333\303fY)+\304b\331+\013e\255\354\226\345a\207\330)k\304\026\261Qv\207\005b\251\354\017\353\303\241\266\352\245\264\305a\233\240\274\375\t&\202\2342Fs@\232C/\303\20697\230\343\252\372<{#'\215(\202\244\006%\001jVmG\262\255\372\345\013\3310'\007R^GU?\366O\242\024P$\316\252\215\217\255\333\237\330*\227\342`\016\307\224\225z\004\330\302\262j\343;j[\365I\237\304D\220\023\002RV~B\225\3239\n\016G\226\227R\035\264\364\254\332\370<\\%\277\263 \021\327\352\300\201\023\302vVgs\310P\3014~\304sRkC\003\316\016\037K\272\277-S\206\271\374\027\373\274\332"
+	.string	"\310(J\3032\331%\207\332\032L[\343S\260C&\202\234\037"
+	.string	"\025EkX\245\256\262\001\250\231\227P!\260\300TU\271K\246\250\350\300\267e\214p\373\037\220\006\207\233\312`H\023\261\346V\324\016=\237]n"
+	.ascii	"jJ`\212Y\024F\257\335\310\344\034Ev\345%\304\025\235\022\324"
+	.ascii	"!\315\313\016\331\030\275v\303\254\220\231B\216D\333\016Y\246"
+	.ascii	"\206\233\3453;S*\252\036_\370,\222\235a\211\254\323\032\331#"
+	.ascii	"\233d\213\034j\207\254\f\017\031b\226(\341\363\273p\033\227\341"
+	.ascii	"\306b\2701\027n<\0047\246\302\215\243p\343\033\270\261\323*_"
+	.ascii	"\311E\356(\020\003~\240Cm\376>0\377\267c\313\225\315\037\346"
+	.ascii	"\377.l\261\003\274a\317\356\274(A"
+	.string	"\362\347G\003\370\345\004\350\367}7H\254\210v\374\355`\017\334A\035\270\203L\270\203H\270\377K\367\343\375\226\337\313@LY\f7\241\277\217\302{\351\337\373.\371\367F<\345\274\374=\234\277\234\2278\356\022\270Kp\271\244\254\240\351\355 \021\376\250N\277\036\214)\242\244\277\024\004a\340\016f\374\035<'\315\362Z\354\214E\362\240\264d\261\263U\321,WX\372\355\224wM\260\314a\016\236\223\312\375\\\234L\021\032exN\344\342d\352\274\316\276\300\365\307\331\275\034=\202Pq0&\032hK\336\212[\226\037\ni@p\225wc\202\021\273\322\326\357\346`\336\2257\227\302\337g{*\370\352H\t\203\312O\301\231\342\006x\343\357\224\227\222rq\001rF\341\336\3735\031=\272\267\2515\357\343\201u\326\365\267S%\034\302sR\262\f\226\ts\353o\232C_\355\225\220\251\375\222G+K\343\322\205\257&\307"
+	.ascii	"\243v\321\316\334\310(\332\374\373Nd\252(\321\240B\327\304\241"
+	.ascii	"o\326y59{\345\2347t\200\"\222\364\267\367\036\372>\350\270\364"
+	.ascii	"=\264\277\314\231\231\330\370K\026\314C\222\023\203\202\231\274"
+	.ascii	"\022\250\345\tHi\270c\220\340\216\331\022\373\273\257\032K\202"
+	.ascii	"`\260"
+	.string	"\177:\364\303\336F\277\363\221:\3033\354i<\023R0K4\354o\374\227\3031U\310\314\2740Q\017\036|\t\033`\227\364\ny.\274+\257\357z$\016\375\257\376\257\307\361;n\224\026r\356\361w\365\365<\036\310\r\363\231\223R.9{\320\340\301\003\r\021\017'%\276G~\313\241\317\365ZC\336\210\3031=s\322M\223\247\272$>\256\267z\254\r\001I\276\350\315\375U\322\032l\352\364\224\334%9\222\202\221\326\207\333\206\356\371\2747\326\364n\210l|\221\222\262\265u\221d"
+	.ascii	"C\362)\036MC_}\221\244CN]\322\376^\257\313d\303\345\210\206\225"
+	.ascii	"\277\267\213\313LK\353&=\240\205eS\344\317O\356\013_]\335\"8"
+	.ascii	"\273\2238\246\0161hWS:\262\372\0261[\266i\375\275D.\021\315\021"
+	.ascii	"]\235\325\337;\304\373\354\030\r+N\177/\226\367\205\275\331\350"
+	.ascii	"\362\276+/@\224XB\204X\274\324)\0234g%X\243\013\207S\017\037"
+	.ascii	"\367\207\217\013\004\310TO\335*\317\316\234\365\250\372V]\245"
+	.ascii	"\020(l67p\333\b\361\200^\036\326\3136;8\322\026\315\316)\025"
+	.ascii	"\304\244a5E\361\313q\243r\\\2514g\177>\0359{\257\257T\214\\\226"
+	.ascii	"\020\350_\035:.\024V\346\034\374\021\366\324\027j\206\251h\311"
+	.ascii	"W\036\356\232\266\246&\017\354\220s\022\207\256\260\263\245\245"
+	.ascii	"{C-\316F\337\033?4#{\271LbE\200^.\323\255\341vQ0SZ\360\334\350"
+	.ascii	"\272\304p\367U\202^%\017\374gV\316\f!9s\005]c\304\351\274I(p"
+	.ascii	"\300\302r\"\365M\022\200\331\322\225K\204g<o\324\b\335f\337\030"
+	.ascii	"}c\\#\017Q$\f\354\217/3)u\350\276E}\215\316\224\234 \364\367"
+	.ascii	"\312\270D\027\314\226,\267Kt\207,\331S\255i\271l\\\026\016)\177"
+	.ascii	"\353p\367w\247y\351\3149'\305<\263\023\250\246=\306\275C\267"
+	.ascii	"\215[\237\240\033\004\006\236y\031&\313\013&\202\266\304\361"
+	.ascii	"\034r\307\300\345\314\214Rf\020\205\304\214\252\321"
+	.string	"\034\213\312J\246\020\245\005g\216R6\307r\266\220\231L%\212\247l\2419\226\2212\f9$\317\317(ef>e\013\231\231\227\034\232\314(\244\346\330\022\311Bs,\n)\217E\345\n\231\271t\306`f\247\205<\026\245\227\307\236\220*4\307\236\220\232cQV^\024\003\211W\322_\026\017>Gj2\263QQ\323\322Y\001\256\371|\312v9;YPvN\220s\323\223\323nY\303\323\200\340\214\200\314\226O\376,\002\222z\312L\270f\326S\316Y@<\271h\204\362\t\227\251\034N\271\243)\023\005\345\034\200\242\234\225\236\341r\316\312\234s\320\331\364\314\371F\205\346UQQ\316L\031\212r\223R-(\347'\323\222\206\324\034\223z\322Q[2v\225\205\236J\277\312vQN<\246\f\313D(\340+\244\031]\376\366\r\352\266{\027\206M!\205\223\262\346_?\342\030\322\013\244\323\227i3\005\304\b\332_"
+	.string	"\334\345U\246N\330v\360\370{\363s\314\363\234\374\326\202\340\276"
+	.string	"\320*5\t\264a\034j\001\307"
+	.ascii	"\237\213\375CJcP\325@s\b\t\245\267\355\337\230\314\331TU\364"
+	.ascii	"\257\355\323i\353\247\200\037;\270\376Z\013\306\246\320\245\324"
+	.ascii	"\003\310\337\266|)\3340a\232\254=\275d\324\374\212\320\370k\367"
+	.ascii	"t\332~\301OF\264\244\376B\3409\251\227\337{\200\021\034w(\234"
+	.ascii	"}\332\235\234X\027\013%h\025\205mM\257\312\215\034\036\027\224"
+	.ascii	"\250\334\375#\233K\302\345\263\3044\035\305\025\345\341\325\330"
+	.ascii	"\b\234\252\261\305+\306\256\307\237\225\307\263w@[\202\306\376"
+	.ascii	"j\271\341z[\032\262\003\023\205q\251\263kY\344\276\342\300~\257"
+	.ascii	"\003\030\224\234e\373R\3129\025\007k\200\322\252\355\b\233\234"
+	.ascii	"}\202\275\331:;gO\260Y,\026[\305^\261q\326\212\265\263t\026\316"
+	.ascii	"\241V\316\226\265\225b\247\310\335\311u\305Q\261n\016\307\004"
+	.ascii	"\206\345%g\307,\231}\246a\241$xQ\271\177\263iI\264X19\233d\001"
+	.ascii	"6KZ\216\234l\270m\335\334,\0039?-\2649u\374\025\241\323\266-"
+	.ascii	"=\022\005\n\314\337\246q\302\301'\037M\022\206b\243<\301A\350"
+	.ascii	"\232\242\204\261P\354\223\237#\313vV\255\355\223T\213\222\255"
+	.ascii	"\317\2429\371[R\263\262\263g\326\311;\311\212af\315\332:\251"
+	.ascii	"\351\253"
+	.string	"rE\3116\271\251C\202\006\245\211\205\336\004E\022\\\254(X\f}$\340bE\241B\270\366\\\265HD\366\020\223)T\365\346\210L\376\334\013\315\363\001\202\236\236d\261\350S\f\226\340c\344A\372\024\203\305\244\372\200\rr\025\341\006\271\212\240\301\f\315\005\027+\212\020\037\220F\341\317\207\234\023(4\240\251i\017#@\320C\242q-\256+p\217(aA\t\023/\202m\002\203\020\030\204H\333\004\006::\030\224\320\301]B\307\"U#\022)\314A\032\327\236\036\242\212t\270\032\325\231\341P\203\0070\007:i:\034\n\361p(\254Yw|N\324 \233\347C\001V\365\246\203\032$\216\032l\236\017\310a\322\210<\2128\252/Vd\262\205\205b\322g\250\252A\343Z,\301GU\203G\343zL\026U\025\357\024\211,T5=\026\211?GU\r\026}\210Gb\317\252\2522H\265\202\005;\253Q\310s\264"
+	.string	"\304\021IL\001\"Y\\a\301\213d\221\330c\301\210\022j\t\023/@\254;\311\236a\221\b\302xL\202H"
+	.ascii	"\362\305Z\354\021\026\215+\262HTy\220?\252\n\201\213\325\370"
+	.ascii	"\243\252)\362H\354Q\325TUS\243\220gx\327\r\020\217\252\232\262"
+	.ascii	"\030\372\364\\\017\220\304\"\021Cq\203\035\341jL\215H\020\206"
+	.ascii	"\305\344\006B\244\020\305\216p\345@\303Qu\261\242(n`\323<\037"
+	.ascii	"\002`\\{v\212\302\016r\220E\025\177T\207k\b,\206\302\024==\302"
+	.ascii	"\023\026\210\310\027\353E\036U\342\217\b*V\024\252\007 \210@"
+	.ascii	"\263\016\213B\344\261H\304H\365\003\017n\221\bB\3618L\211?G{"
+	.ascii	"TO\210\360\200\346\204\b\017d\322\241\b\242m\236\017\307d\n\r"
+	.ascii	"Gu\002;\025\214+"
+	.string	"\362(l\221\036\217\253qgG\030\\]\b{pRu\261\356\034\223)\360Q]\207D\027+\212c2\005\315\252\256?&\214pL\246\220Y\177L@\036\223)\202\307d\n\273\366\b\207\307\030\037\343j\201\240\n\214TE\\pL\372\020]\254F\020.\224 \f\341\004\212\031\244ZB\007Y$\006Wc\022)4\256?-V$\r\262y>$\177Z\264\317\317j\004\201\364\3611\202\240Y\325\020B\220\bQ\"\371\323\"'\331\343s\\\2153G\365\201U\204\344O\013\232\024\331\223<\256!\254\027VU\250\032}\216\305\365xS\\A\354\321@fUm6\320A\004V\2440\004\032\023v\204k\bB\244pG\306xT\241\362\254 \362\2506*~zjT\374\364\250\033\340a!\342\002u5\nK\3301\ny.\034\177|\214(\214\353\016\321\005\021E\362\247\005\016R]!\034\301\207\030\\!\034\201\210|\361"
+	.string	"d\321\203\344O\013\033\244j\002Y$&\203\255\243s\202\003\t\024\340"
+	.ascii	"\017?\254,\204*\324\341P\b\342h\\]\020\215; \212Da\013\020C\343"
+	.ascii	"\021\304\007\003\024}\210\310\341\212\3641\202P\202O\217\n\343"
+	.ascii	"\352\342\203\243\260\003\037\243\t+4\364\370\3708@\215\371r\327"
+	.ascii	"l\236MlO\356"
+	.string	"\336\275\201\275X\001B]/\267*O),\360o\227.tG8A8\032\275Us\200W~\\\200\344\031\305\304U\271I\331r\223\224\302\214\350]\274\013\025C\305\204\225\357\3355#\2221\246\225%\313\205\222\251\220\201\350\266\256\266`\301r\241\334\351\354\022bMi\325\306w\023Ww\245n\231\215)\251Kw\345h\340E\271rO\270\321\303\357\013\350\257\224\276mR\256\\\006\234\275\266\234\256p\332z\230\005\276\365\225\353\033\347R\224FP\270{\3452\301i\242\362\207\303JW\216\253-\327\312]\306}m\271\335\374\f\2029\re\267;\245/\225$!\253\264*\270L\255\373\311]\273C9\003\205x\002\331\345\314\324\001"
+	.string	"O\370\304\240\364]\353\033%\003@1\256/\263\262\367e\301\340h\371\r\325q\341\276)r\326\027\355\354\232\271X>\n\326\240\352\222u\004'\210[\026\247\233(\334b}\307\304\256Y[f\316\321\024\304\332\352\222\305\227\233L\035~\257K\306\022\262\276f}\233\210 \321k8T\302\206p\224]h\267\314\f\021\036cZ\177\373f\211\333\002,\266\204\204t\2318\301 \3411\271Kr\3600\2626b\002\203\265\250r\321@\212\002\02533##2\222\024$\035\302\n\020\204\202a\230\347\326\035\022@\004ANB\350\020\315\210\210\244$)(\224\332\r\013\270\022g\376\263\037\0357\200I5}\177t\2517L\276|Q\002$W\306\356w\210\320\np\307%~\242\225W$\336\327\211\324\306\266\312\030\235\270\037\2664h\272\367\320|\202\373"
+	.string	"\362\367K\365\214\3618\376r\333\201\235\310\320i\f\316\337\275,\206\\\341\002\330\205\334H\332>\317\027=\222\323\240C\005 \342/"
+	.ascii	"\t|H[\374x\033b\273\003\022\324\001nA\033\203\r\215X$\004\027"
+	.ascii	"\276\265\346\341_\244\326h\224\377\373\035zu1\321\340\247\006"
+	.ascii	"\2525\225\212\027E_Bk\016U\243\2032\325\033p\307\n\030\023\274"
+	.ascii	"\234$\216\177\352\356\002!\013\b\024Z\2701\350B+W1\2104\260\b"
+	.ascii	"\310\200A\246\335\254x\r\2249\021\302+\017\262\353\253\310\\"
+	.ascii	"\205\365\001/=Py\253\032\312\311\006\"\017\335g\276\013\031\233"
+	.ascii	"\302\357\017gp[\3216\2010\201=\241\337\226\270\200M0\252v\266"
+	.ascii	"[\023\032\327\004M\nz\025\357:\r\367\020X\026s\207\362\347_\200"
+	.ascii	"dC\220|\342\302"
+	.string	"v\3502\215J\006y\215\374\334Ls+\001\233\375\206\265\261\255\364\222k\342fK!R\005\376\347N\217\342\311\2244N\335\324\025#d9},k\003\322d\233M\357\254\007\233%[\020\304\247\326M\244w\262D.b\275\312m{\352\223b(\323\360\361\353\235\004\350-\360k\246x\324\231\004r\334\237\037\225\207aR\264\223|\246\363:mLo\227\274\266a\254>\256\t\264#\225'E2\323bZ\306\304\224t!\377\366\236\277\r\353\222\307\253\335j*\026\224\313y\242J\246\250M\322w\f\204\2651\f\357\262\232\337\007\f~^\237\005\343Ph\314\224\372U\r\330)w\001Z\224\001\375\363]\350\374\327R\325u_9\206B\237\344\2572\251\242\023\353\362\321x@\206\034\004\225ra\214y\232\204<\365@\264\256\221V\210\267\nJ\034/\2037\310\256\"\001\353\376P\305\211]#\004 ]\2732\rtP\220\024h"
+	.string	"j\006)?\r\344\253\3531=\353U\035l\263\360\307%\315;\366\215\376F\371-O\223\245w\360\305\317~[\2312`\302Y\275t\365\330"
+	.string	"i\007\242\2016\245S\017\343@5\371\357Cf\227}\232\005\033\306-\3025\"@f\002\365\276\263\242'\0017\205\333u\025\342#\240KX\303$\032\201\363<R%z\232\260\343\\A\316\333\273l-s\257\032\020\370\016\25485p\315\034"
+	.string	"\242l\365\222\334H\326Y\254G8\2363hI\n\tt\177\213D@_a\256\224|d\341A\335\251\026\237-\304\264\226$\230\t\3445\\y\"\306\036\305\307N\262\334\305\221\244\201V\031\232\264\220\300\324\270\352\251i\312'sI\2764Fk\2121\260\3571T\220n\336\216\365\340\333\310\204&k<\f;\001\207\351Bj\016\231\320\311~\326\336\260\267\021\2542r\305\234\232\016\030\226KR\007F\217|\031ZN\210-C\206Z\036\374\262\247\200E\007\021\022~|\277\356v\344\025\206L\017\237\023"
+	.string	"Z"
+	.string	"u{\221r\016n\351p2^\240\306\034\267\337\021\332\240\317h\315\221\222\364S\325\261\354\027\271B\n\302\021\013\017\372\003\270\n\275\0179\226~\030#\345\200\024\024I\230\324T:\026\007\335\322\322\322U\311\202\262\315\202\225\002B\037\353\373\367#\337l\034P|\270\013\360m\253\363\242B\204\233f\323<1\202\3009\\\013\033U8\262\017\007\315\317\240\374\312\250\353\366\377>q(5\227\214\003!-{)7\007\fh\241(\322\0034v_K\353\327\341q\024\353a\r\374\362<\0203@\272\32733j\200\323\337I\001d\342\212w\371Z\355\214{\035\001`\223Aj\365b\272\022\3215\335\210cB`\217\211\027\032\206\363\025\037\303}"
+	.string	"\013_\330N\257'\037\342!FR\200ym\236\\LM\343Mz\326Ip\351`\243\324\201\024\275*\237B&Q=\357\237"
+	.string	"\303j\034\017\3038\353[\265q\033\325\356m\242\233hj\224\303\002\253\237\257\342\314p\206\275\262\3067S\333=\206H\303"
+	.string	"\260\177\242\371L\b\304\250\023\326\321A\320\377e\276\227\031}\203x\217\233P\037\257\337t\372g\362\034\025\f\377\210N\363\200<\024\364na\333/\\\025\317\245\314B\025?\2429\301}\210<E(\021\020\200\241\340\307}\206f\026\374`\037R\243N\342\020\001\331\264\n\351\325\325\204\340\263\rOS!\"\2327z\325\021j\n$9:p\321\231&(\263\230\203\367\205\320,\311h\261\224\253"
+	.string	"\t\274\327f:\t\025\267\212{\223\306\220\037 \245W\354MsL\031\360K\364\r\252` \322\177\222\244\017\204I\365\333y\275\025\247\ri\024\026\332"
+	.string	"5\233F\214+\204\372\342\"\260\221\225\003U7\376\036\304\332\346\020Q9\230D\325\365`\341q\024\222 {\342\247f\300\306\313O\311\3748x\360Q;\2733!+\037\353\266}SQ\246-\267z\317|\266\233\215\315\311\233\242\244\007\341*\302:\373\220\265OLb\363\355\237BCZ\335\357\310\206\300\037I\254?\363\006\234\336\200\320\227\031_Ef\3420=\365]\226\236\236?<vG\222\304\334mB\213\b\021;\226\227"
+	.string	"\200q\344\\\317\260\254tf\026\264\241\240\253\023\031\222\377Y\375\244\220\203\204\244>\260\206\277\037\b(\bY\331\256\367\320L>q\0233\021\"\367w6u\270\351\352\374\020\006\335R\202<\354\t\241#{3\366\207xX\026\310z\0362\307L\364l\004A\355\351E\306`)\223T\371\020c\262\356\3051\241\266\232\257\244]\223$\227\253\025\rK\372\230\"?\262e\353\2014`H\204\234\250\304\031%Z\177\361\n\350\341\025~\246\364\201\242\246\340\001\\^z\335y\377\022S\336\213\2175\266\206\261@\347\301\207\327\217{,u\355\001^\204*\255\022\353\327\202\222g\352\222\225\026Q\2261"
+	.ascii	"\\9\311\316Q\330#a\203\002\b\261\004\331\216\017\0272Cf\276>"
+	.ascii	">qo\244\320\252\350l\223\333o\036\206\3535\024\177\270I\321\204"
+	.ascii	"\323\355\035\3558k\nP"
+	.ascii	"\276\312\3634\002&\375\005vTj\212\035]8;6l\270\213\267\b\"\211"
+	.ascii	"J\264\357r\202tL\332\272\243\321V\rf4Q\230\271<)?5\206O?/z\314"
+	.ascii	"\307\333\357\233\232^E\347\033\247\215\314G\212\rK\036s\360&"
+	.ascii	"\336\256\350\305~\023~c\206\031Lf\033\036\335\022y$n\364C\f\276"
+	.ascii	"Mf\350\301\257\264\2454\214\223-\263\343\262\362l\341\307\r7"
+	.ascii	"\237#n\265E]\314r+\202\237w\243\006\026?/k;k,\n\336f\177Y\215"
+	.ascii	"\233O<\262-_\020\374\ty8t\370\"\370d\337(\3638_c\253\352\201"
+	.ascii	"\323>\332\223\301P\231E}<0\263\305\231S\312\245\027\315\022\356"
+	.ascii	"\224[\204\271\301\227\373'I\236mS=L\375\253\211V"
+	.text
+	.section	.gnu.lto_.symtab.ecdf96f49bc7bd46,"e",@progbits
+	.string	"fakeGyroDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ecdf96f49bc7bd46,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,301 @@
+	.file	"compass_fake.c"
+	.section	.gnu.lto_.profile.ec990af55f5413a9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ec990af55f5413a9,"e",@progbits
+	.string	"(\265/\375 h\035\002"
+	.string	"\024\003\\"
+	.string	"\005"
+	.string	"\347\253\347\265\001\006\002"
+	.string	"\002\001\001\240\342\234\212\n\002\277\233\265\223\002\f\003\245\240\323\225\006\004\257\305\206\210\002\004\002\003\002\004\002\005\002\004"
+	.string	"\006"
+	.string	"[\035\265\322\2003"
+	.ascii	"g\373\273\227`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.ec990af55f5413a9,"e",@progbits
+	.string	"(\265/\375 6=\001"
+	.string	"\330*"
+	.string	"\004"
+	.string	"\001"
+	.string	"\b"
+	.string	"\007\003\002\002\003\003\003"
+	.string	""
+	.string	""
+	.string	"\001\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004"
+	.ascii	"A\325\350\f\240\022\320\006\260"
+	.text
+	.section	.gnu.lto_.inline.ec990af55f5413a9,"e",@progbits
+	.string	"(\265/\375 \236\315\002"
+	.string	"\264\003\222"
+	.string	"\004"
+	.string	""
+	.string	"\006\200\200\200\300\002e\001"
+	.string	""
+	.string	"\002\200\003d\200\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\t\200\200\200\200\002f\001"
+	.string	""
+	.string	"\002\240\002e"
+	.string	"\300\003\003\004"
+	.string	"\005\002\002c"
+	.string	""
+	.string	"\b"
+	.string	"\f"
+	.string	"\240"
+	.ascii	"\b\005\301\340,\264c\t\344\036\365\360M!]B\2739\203KP\033\300"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ec990af55f5413a9,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"d\002*"
+	.string	"\004"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\004\002\002\001\001\f"
+	.string	"\002\004\177\002\002\003\003\001\001\001?\177\002\006\004\001\001\003\177\002\004"
+	.string	"\002"
+	.string	"\350\206\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.ec990af55f5413a9,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\232\004\003\230\004\004\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ec990af55f5413a9,"e",@progbits
+	.string	"(\265/\375 \215m\002"
+	.string	"BD\f\025\300%\035\377\357\276\252\334\343\377\377\177}\001\323Z#\213\020\231R\372\371X\302,Kw\203M`\353\304!\021\r\372e\233b\233z\331\232\355\226H\004\n"
+	.ascii	"-\".\001\276\034\353\252\305^\241V\271e7\f6o\201\2407\200\005"
+	.text
+	.section	.gnu.lto_.lto.ec990af55f5413a9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeMagInit.4.ec990af55f5413a9,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\365\t"
+	.string	"\366\322D: \261\322\001\244\n\022\005\303\203\0042|\\\332~\246\224\300G\224F@\320\033\250\004\332\206\031\352\007\303"
+	.string	"#\233\365\037"
+	.string	"\001\004\t\325\203M\261\264\222\001\340\037\b\355\331\376{\247\0242"
+	.string	"1"
+	.string	"5"
+	.string	"\236\017\324S\333NPPY\374({\215\\Z)\270\335\261\233\037\027/E\377%\227\0343\232\032\033lu\t\320\260\273\226.\330\306=o\333\3006\203}\204\323\303~gw\3273fS\211V\355S\333}\345rV\206\302\314l\253\354"
+	.string	"\333R\332\247}Du\222\214\013\354\306l/\273c\310\013\236S\217\377\324\323-,\362\216\251\247\240\231H\3505\025P\b\256`\037V\333\240\243\204\004\262\335\035\371&?\261\360AN\215\221\222w\235\372\251z*gn\035\264\033\226\314\331\343J\006\021\336i\232$*Mx\020\016\241\207:}\244.\004K\027&\360\241\2430y\247\216\004\206\235\350\300\037\252\004v\025\337\007v\036\367\235\2351_\254\325\006\207scM\r\177\345\266\007\017"
+	.string	"]\325[[\224\227\025\203M\324\336\013\016\030\302\252D2`"
+	.string	"\306"
+	.ascii	"\343B%\007b%\340\\\363O\035\302\274\256I\006"
+	.text
+	.section	.gnu.lto_fakeMagSet.5.ec990af55f5413a9,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"M\n"
+	.string	"v\022C:0\221\322\001\200\214Q\204\341N\324\203K\253\336pq\267\027\315\255\220\206\374\305uf-\326y\033#\257d\177\323\266\32400\250\260\355\001\267o\360)\244\246^\217x\262\311\336)\0050"
+	.string	"1"
+	.string	"2"
+	.string	"\247\004?\350N\345\013\272S\213\366MB\207\200\215\307,gw\353$\271x)\372gy@\313\265\272\004\210\330]\313\226\013\344\236\267\255`\033\302\376(\276\354\357>\376\334c\277\364\006p\020j\273\037\267\235\265Q\232\023\333\367\330\262\332\303Hs\360N-\245}\225\257\210\217\251LwE`3\273\013r\203\027)0\016t\230\027\0359m\177\356\2422(\331]\006\177\366\226\013\337\344\324\031)\371\326\251\237\352N?(\260\020\226\274\331\343J\316\021\373\334\356\256\347\313\001\033O]\343\026\205H\024\337\204\004\352;\231@QE\205$\214R8\252\025\245\317TE!\252\206\026\f\236Ha\265"
+	.string	"\301\260z\306\375|\231\326l\254\311\341n\322.\023\343\232\031"
+	.ascii	"^\251'\023\260\354\315\300\003\021M\030`\034U\016\rk\270\013"
+	.ascii	"\206\240\031X\016\304\322\024\003\260;S5(.\f\3450\006\230\003"
+	.ascii	"\203\201A\200<\200Y\201\032\035\356\360\242\235d"
+	.text
+	.section	.gnu.lto_fakeMagRead.6.ec990af55f5413a9,"e",@progbits
+	.string	"(\265/\375`\034\001\375\013"
+	.string	"\226\026Q@ O\225\016\240\275\301\n\f\004\223`\211\321U\214\357\330\342\213\201\222\347\3608S\220\032DRn\263\bS\032\376\006+D,c\314F\030"
+	.string	"\330(\225-j@\273 U\352\001\221u\220%\233H\231R="
+	.string	";"
+	.string	"?"
+	.string	"\033+^09t\374"
+	.string	"\354pr\001\330\241m'P \362\367\270q\272\264J*\030\2731S\016\377\236\237\377\020/\320\001\262A\305\n5zJ\030\354\256\323\204\312p\353m\033\260\235\261\257\0219b\307Q\252\206\375kw\327\232\262\037\177x\245\365J\347\225~\206b(\205\020@\261{\032\211\261) \253\203m\221M\261\2551\264\002\223i\377\303=D\007Q\341\001vS+\221\r\367\t\354P\025\363\321J\365Id\345\253\021\251\230\017\017W?\344\303\001\330\340\360C\330a\252L.l\004Wq\223\335\275\370\"\0162\301\3478\264\007\312\233\016}\020vxU\026/4x\260H\001\332G\313p\264M\302\3216\265\306\262\201\240=h\340i\236\215\323d^\267\241\320\351\034d\022:\332\226i:/\263\0340\347\331t\331\207\343\272\214\022\367\327j\352\037\026\241\343B\253\005I-X\325g]/q\021\023\001\027"
+	.ascii	"^\325\203\232\320C\005\376\324](n\305 \202\355>\241=h\n4\006"
+	.ascii	"\220\203M !5\024r\356&\374Pua\271\006JL\340\240\020\\\006F\020"
+	.ascii	"\240\302\274\256I\006"
+	.text
+	.section	.gnu.lto_fakeMagDetect.7.ec990af55f5413a9,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\205\t"
+	.string	"vRD< \005)\035'5\317v\215\261\017\220\260\033\263jN.TL\2419\211F\363Ry\246\277a\273\351\206\207Lb\266X\327\217"
+	.string	"\001\001\2134)\002\235\343i\242 \267\205,\343\266{\247\0241"
+	.string	"1"
+	.string	"4"
+	.string	"\334\251m7<\234,~t\255\216B2\"\263\355\216u\252\\\274\024\375\273<\3415sC\233\261P\227\001\024\273k\251b\225\334\363\266\025lK\330\016\020\217\375\222:\254\255\206@\333]\335"
+	.string	"\254\r\255a\261}\333'[\300\266\224\366[\016;=f:\301n\013F\263;28\342s\352\361\007\334\351\347\005\001\336e\337\304\211\216j#4\300\331M]ew\034\346\343\263\273\020\376K\b\310\200k\345\3247q\247\263&\023C\233\231\244\344\315\036Qr\246\330\367\354\356z\266\354\030\2357\035\002\211H\335EE\330\225\274/TCP\3441\002-\252\306\250\363j\b\f+h\301_I\004V\216\357\003\253\307\275gg\313\027\271\214\227m''5E\354\021)\n"
+	.ascii	"]\325\353Y\0241b\020\231PA\221\237J\344\2533\216L\020\275\313"
+	.ascii	"\304\3275\237"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ec990af55f5413a9,"e",@progbits
+	.string	"(\265/\375 su\002"
+	.string	"\364\003o"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\003\f\300\204\001"
+	.string	""
+	.string	"\003\002\006\177\r\002\005\177\016\272\220\202\002\007\177\017\272\220\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"p\003\013\001\351y\020\032E\225\001"
+	.text
+	.section	.gnu.lto_.refs.ec990af55f5413a9,"e",@progbits
+	.string	"(\265/\375 9\225\001"
+	.string	"\224\0025"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\001\001\001"
+	.string	"\001\001\002"
+	.string	"\001\001\003"
+	.string	"\003"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\001\005"
+	.string	"\003\003\002\004\002"
+	.string	"\001"
+	.string	"\002\002\002"
+	.string	""
+	.string	"\002"
+	.ascii	"?\331\227U\302"
+	.text
+	.section	.gnu.lto_.decls.ec990af55f5413a9,"e",@progbits
+	.string	"(\265/\375`\243\017UO"
+	.string	"\352\205\230\035TPR\036u\246\206G\364h\0171\333\212\b\005v\301\323E\372\340\311K\300\317V*\242\303]\005F.\254N\274o\212?\266\266.\227\236\3035\306!\322\214\355\244wzkHIe\202n\311\260\247 \264\244\025\252\1770\350\252\035f\203\344!z\262\375\222\244\224\002\240\001\302\001\304\001\227\373F\353\020b\213\252\311\022\2470\352\3557\341\266O\367\234;\335s\366\226\336\362\203\031'\267L\302\355\262\276\241\225\255\205\271\261\364\030['\306O\376\257\267\0320\212\f\f\350\f\321@'\023][\245\255\264\262D_\251\251NB\330(\262 /\270\345\017.w\211\263\323\272\304\311\031\334\001Z\304\271\200\224\346\220/\254\246\333\246\330\r\023\314\230/`\334b\314'P43\347\237D\355\230\005J\031\267\315\364\016\353(\334\314\206\302'Pp\216\360\257\376\327f\332\177`7\001:\335\004\3244\215"
+	.ascii	"k8-Wp\331\207\376\312\301rLa\352\313\353jq\342\362r\253l\257"
+	.ascii	"\266\201\371}n]dhe\3342\004\227\271\273\2266\b\222/&O\232\313"
+	.ascii	"\307c\f\315-7\027s\257\235\325\3136\376\013\377\177\204\rJ,\213"
+	.ascii	"\351\266\235t\r\255\374i-\356&\275\3055\300\365\327\036S\025"
+	.ascii	",\272\335i\021'\243\270\334I\036\001|\024\354\367\204\377\376"
+	.ascii	"9;-\255\177\316\005Z\304yv\317\331M\204\270\261zN\242\324\372"
+	.ascii	"!jP\2444\241q\353H\346f\322W?\265\341\223\361\227\377+\217m\206"
+	.ascii	"0\037B\334\362\332\"\316\333=g\b\314\035\001\b\314\355\300\007"
+	.ascii	"9\314\036\203O\013\033f\017\302/\370dv$\034\306\3146fW\201\271"
+	.ascii	"?`n\017\230\273\005s\263`n\f\230[\210\271\033`n\t\230y\311\314"
+	.ascii	"[\314\255\202\271'`\346&3?af.f\276b\346\035f\266\302\3145iii"
+	.ascii	"i\314L\206\331W`\276\331-\264\322\211x\217%\021\367\341U^;\314"
+	.ascii	"\344\274\023\020a\266jH\327\250q6t\353Bl\256\340\310A\305-\327"
+	.ascii	"\234\200\264\322\203\260\031\320T\022(\267\354\203\377\360!]"
+	.ascii	"x0\343?\330\251\210\277\245\303\355\224\315\254\250\305I\231"
+	.ascii	"\353F\3571\005\344R$s\331\265\\v2_\301\303 U\320\n\273R\256\243"
+	.ascii	"\225\276\243\315\270\275\364\027\366Ywt\016\275C1\002\260\035"
+	.ascii	"\315\203Gu\231\324\316\013\315\2028\303\341ZKJ\2321\247\365\031"
+	.ascii	"~C\207\343\377\347p\034\256B+=\212=\252\317\372\214\216\312\363"
+	.ascii	"/\004\3151\252\3218\223\216p}\250\024h\217\373\301\341p\236\202"
+	.ascii	"\360P\257-:T+\375\206\023Sp\033]&\265>TZ\305\306\0164\277\341"
+	.ascii	"CG\201Dpx\201X\230\263\033\205\210X\013\312\313\3546\330k\334"
+	.ascii	"\234\300\222|q\3534nr"
+	.string	"H\225\211Y]\177\342\256\201\204\311\312\361r+y\007wb\263\"W\242\220E.;\220\313n\274\316\324A8\260\313\226+\260\230\2351\273\320\233Z\351L\036d\273\376/{\314\231\272L\352\201*<\340|p:G\2220A\236\226\035\307\2653\b\267\310\334v\232Nk\245\253\376\177\273\231\361h*q\313\216\302\225a\343\346\311\036\274\334i\027\2106\323\312>\323h\334]\032\007\366Y\377m\370\177f\200Y\350L\223\3512$\202\303\241\036f\316\376W\356+f\2413-\246{ \021\374\357aD\200-^\276z@\373_}p8\033\020&\026\221\323r/\313\374P\3231\364B\263\326L\221\342b\304\2076\303\311\001\2057\313\272cni\254\322\234\261\272\334H.w\325\345\366\021b\234k\304\225\030,\347\362\345\211EE\206*\236e3c\b\025\016%\227\331\231\317\177\250\232\365\211\301\034\356\232n \346[\327\272"
+	.ascii	"f\2665\244\365U-\027\310\334$`\300\025\006x\240\177\2258LR\251"
+	.ascii	"<\303$\360\207\312\262\"\317p\375\251\021\237\004\362\303\325"
+	.ascii	"\250Z\243\352\277\276\220\252\370B\243\2524\\\237\370\253Q\335"
+	.ascii	"yaqg\270\002\325a\222\252\330\303\244\261\310\363\302W_\b\234"
+	.ascii	"\272Bcqx\305X\334\031&\201\305\241\220\252\330\277\032\277o\210"
+	.ascii	"\262R\251M\237\004\336\376\377i=\2529\377@\342\253Z\234\306S"
+	.ascii	"\235\321\370\036\337eV+\220\367\371\177u\t\346\207\321f\r~\331"
+	.ascii	"P\211\021F\323?\230\247\321\200\332\352\214\017\252\375\337\264"
+	.ascii	"\022\377\203F\021\244\214\315e\006\361o/\004>\005\177\030s\232"
+	.ascii	"\202\306\031\257d\252\213\303\344\017\243P\230V\362\370\301U"
+	.ascii	"\355\343\203\241\"\336\244\272\376\262\207[\262\210\324S\362"
+	.ascii	"\330T"
+	.string	"8\020i\326\300Nln`\312\341\212[\317\3629\255X\261at\313v\307e\006\220\235\245\271\214-]p\030\310 \317\030\340\341E\2604\241\301\231\370\352W\336\304\261\334\252\225\216l\033\330e\360\031\256\330\221\r\306Y \021\034Z&\326\031\262\2514\231N\355\277\007\3271\213\271\2478\322\2274W\227UY\032\236\234!=\211\307`\300\225\217\261%8\234\017\016\207\303\271\016+Nd;\226k:\\\273v\317\351Jn`\b\")d\312\345\032\323\221\034\321i\341\205\261)\344=\372\021\234fU\026\016\177\201\375\310\315\250E\206-\267n\244\277\240\264\312\206\335e#\246K\226\252%w\252\266%\264r\033\351\016M\321[\212\272\270\321\245\272\025\270\224\307\002\207w<\037\332C\215.7\220B\201\024\016\310\260\245\f\303\304\001=\236\316\002#\035\222-\345\365\206R^\217g})\007\273\336R\005E:\264\205\221\216\005"
+	.string	"E:\324g\031\206\211"
+	.ascii	"|\350QQOwAO\332\033\301\177\271\035\332\202\204\235\216\350\350"
+	.ascii	"H\247\202\207\227\312"
+	.string	"@m\372\313\361\224\\\214\200\256\310\rq\340\002\007\335\365t\351\257\307\273in\203!\333\343q\320\373\355N\236\322\257\366\313\25181\204\243\342\304\220\315\271;\301\2531\f\023\277%\242\037NRB}AiR\222/\b\347\227cQ\264\343C\323\237\016\351Ls\016\244=\336\222\355\367C}EE:\033\032Cw\344bI\t\351.\345\356/\207\356x1\320\025\277%\"\0344\207*\225\360\342\267Dd\203*\225\220\376\226\210l1\320\242\337\022\321\211\346t9_\322\257\207\376tzF\274#\t\214t/\222x6#\335\013^*\203\202\2647d\244C\272\035%%M\220\253\371\345b\240+\214tH7\315\245\020J{<\033\013\t\251\030\240\003\r,\270;\023(\t\272\021r?\235\022R\322.\350\347Cc\360|EA=\236\016)h\347\373\005\231@\200\214\031b\245\262\204\272\322\225\323\354\362\243\213\333*U\274\013"
+	.ascii	"$\307\323\310\0270\306\032bb>\326^F)\240\233\344\224//S\330\307"
+	.ascii	"|\213\216\246\320\255K\251%s\220\361p\353\315^fe\321\301\244"
+	.ascii	"\227:G2.\250n\271&\b\006\346L\033\3040vf\215IXY\232[\207\342"
+	.ascii	"\\6\242\230(Bl\031/\245{5\227\257\257\3368A!~\002l\303\\v\245"
+	.ascii	"k\261o1\363\226w\335\365m\330\234\316\274\020\321^\212\b\304"
+	.ascii	"\354O\330\273rp\260\332!\201/\250\221\034\250\2244HFFdd$I\322"
+	.ascii	"\001\021\005\204 \353$\264\033\0210\245\203\312\224\310h\222"
+	.ascii	"$\323\276\001\346\232%\331\215f\237\263\006\035\244my\330\337"
+	.ascii	"#V\202\274\301;T\257=\323H\316\321\233\332\253lT\200\336\231"
+	.ascii	"\023\371T[\020\306\037Lhp\2734\037\2439H\264\353"
+	.ascii	"\256\351\253\350\346\205S'X'\024P\373!0\027u^u\303w\370<po\337"
+	.ascii	"d\366\332\301\246=zy\264k\311?\264\206\377uD\224\013\215\305"
+	.ascii	"\360\302\034\""
+	.string	"\235\305$\n\355z\234\0024\365\220\356\277\270\020E\n\361L$$\326!\3537rF\003\370\213\346\235\037\270\237\362\232.\236RT\242f\314\237\353\227\250B\"sR\343\221;)\017V\337\200\001$\253B\247xsO\305\233\222\370%G\3209\374\271\222\367\233\250cHQ\346\347N Kg\017\323Pt\036\231\246\3413\017h\316\350\037\314I\177\202@\345\257\021=\032\257%j\322\264\332\320\b|\376\013\025E\235a0\250\307\325\340d\306\205\224\226\304\217%\002\263t\262:\306z`\245\203\206En\306w\374\252k\262\272\016t'\347!=)\315\323\305\22723[\254\207\317|\034\324\002)\247\260\2031\031\202\267%\236Pi\325H\322\317\307_\b\376\362h\364d\342\200\236\003\007\002O\"f\306\266\217\245\255 \350\376\031]\213*?`s;s\177\303\314x%<#25\321_\025\323^\242Q\023\352\3713X`"
+	.string	"\361d\315\373l\345\016\357\305$\240R\004\352\022\331\026j\222\333\0314\003\376Qt\204 d\300\205"
+	.ascii	"d-zG,\250I\002ci\253\312\252C\335t\374H\006%\032\242\236&\002"
+	.ascii	"\265,\023\251\030\032s\272\225]\233\021\300@\356n\300\177\211"
+	.ascii	"$\300.\277\022%[s\220:\214\307I\207sq\245\206\016\242k:\325\211"
+	.ascii	"\246[\263\b\340\332\321\371(\016`^\030\353`dV\306\313\021^\262"
+	.ascii	"\2372^\231\231\031\321\203\216\256 O@66\355e\244\223\020_;\276"
+	.ascii	">\217\230\007\020;;\363\020q\320\222a\363C>}\\\206VDU\206\321"
+	.ascii	"\3455#\2601\311\213\245\031\207\340,\001^\317\3475g\027\201{"
+	.ascii	"\236\037e\203\345\036$4\034\342\021\332\244\234\335Y!tj\261\341"
+	.ascii	"\371\377\200W\365d-\270\303\240N\257\311\355-Z\354\017\320\242"
+	.ascii	"11\f!`\016/\251\002"
+	.text
+	.section	.gnu.lto_.symtab.ec990af55f5413a9,"e",@progbits
+	.string	"fakeMagSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"fakeMagDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ec990af55f5413a9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,683 @@
+	.file	"display.c"
+	.section	.gnu.lto_.profile.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016"
+	.string	""
+	.string	"\001"
+	.string	"\002"
+	.string	"\003"
+	.string	""
+	.string	"\004"
+	.string	"\005"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.string	"\016"
+	.string	"\017"
+	.text
+	.section	.gnu.lto_.icf.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\265\006"
+	.string	"\222\312(1\200K\322\001\361q\373\347\357\344\202\310m\b\026\206\250+\032rvD!\005m\260\265B\343\300\300\f\314"
+	.string	"\020\003\240\373F\332\336\233\220M\266\3342\311\035l\337\337\267\b/\250\214\n\361\345\335cy\220\240x\360#TA\021.\262\275\211\203\352\212|(7\0308,\310\207w,\t\324\206\207\377D\020T\n\016\337yrf\350\300\333\277\267\256\024\212\321\270\367\0371\021\025\271};i M"
+	.string	"\335\221\311\202C\353('\304U\300\374\346.\240\243&\264\306\322\240\323\356\373\373v\376\277g\177nV\246\005\203\260\225\004\024"
+	.string	"\027K\006\320T\002\341\310\034\005\020\004\343c&8:\315%nA\346\233vk"
+	.ascii	"\2750\230\025\373\001a\310\n\001AU\222y\311:\213+\300\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`B"
+	.string	"\265\003"
+	.string	"\022\206\017\024\240'\351\340\377\377\177\253\352\207|\373~\373w\023\273\267L)\256\372+\030\204b \230\316\317\032\230\322\261n*-\216\037\302\"\325C\f\001\320\316\306\330o\245\303O\252\\\272\331\277[\334\020\026"
+	.ascii	"\021#P\b4\303\241\305\373\350\303\241\331\347\321\007\\S\n\313"
+	.ascii	"Q\211\003\013W\020\022`\302-(\003\r\270\307B\230\013qV\221\006"
+	.ascii	"\206\b'9\230\027\027`\b"
+	.text
+	.section	.gnu.lto_.inline.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`\025\004\325\013"
+	.string	"\206\32151`g\223t\300\b\203\275\331\211U\f\034@\007\b\020 U\353\020|s\266\001\177o\335X"
+	.string	"\0258@\020(\002\017\374\330f\377\377w\263\215\220-w\n\""
+	.string	","
+	.string	")"
+	.string	"\315G\314\264}\266%\024\373!\245V\263\2016\247t\316Kl[\245\376>\332\266M\270\240\355\342\241\327\023|0`\r!\f@\3230\342\265MG\340RA\340\334$>\272[\327\240-c\365DK\333\347\034x\240-\344;X\216\004m\025\223\001E\330\371\317\341\333\264NDV\321e\332\001k\252\310T\fdp\251(\260\025\226T\200\266\002~A\264\206\366\206\271m\241y\004O\264H\314\250\2557\204f\326\370\341h0\026t(\234\351Lu\304uj\233\\\201\266\320\317\022\212\372\023\034\306\321x\2306D\250\341T\345L\0054\223\224$\323\001\240\002!\t\252\314\003\022"
+	.ascii	"t1\b\303Bc\240h\342\177\007\203\251\364\177I\321m\342\b\251\337"
+	.ascii	"\216q\212\341\310t\317\271;\311t\317\221\211Ef~L\201?\366/\033"
+	.ascii	"\307\263v\335\245s 3i\365c_\37007\376\266\365\372e\361\036\335"
+	.ascii	"\344\205\236\311\356tz'\210\201Y\235\274\270\207md\300\270L\253"
+	.ascii	"\306\336,\232\037\331^\036U\336\210\b\327Elo\bG4\233lm\242\311"
+	.ascii	"\334\250\301\033E\204\351K\305l\001\326\n\007\221\002\316\267"
+	.ascii	"o\332\004}\267\340\016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`%\001\335\004"
+	.string	"\202\206\024\036\240'\351\377\377\017\300\252\252\242HUU\201\363\277_\023\2764\353\267\377\377\355\311\337[&\031\333\301\230\212\344\231\234\203\341\002a\260\264\021,\275\031\031\265\230 \177\374\027\242\260\n;\333\370)p\316\200\032\035N\377\322\255,f\027\363^\213\263\364C\214\213! \360\302\252\363\033A\f\375R\311^b\271\311xI\303\345\022\265\343*\200r\001\250"
+	.ascii	"\362\033\004o\031a|\004P\016\244\006\030\"\267*\316!\324\270"
+	.ascii	"/A^\230\333\r\276\2612\261K\026\201E\036/\206\366Iq\335"
+	.text
+	.section	.gnu.lto_.pureconst.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\232\004\001\231\004\002\231\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\205\004\007\232\004\b\232\004\t\232\004\n\231\004"
+	.ascii	"\013\231\004\f\231\004\r\231\004\016\231\004\017\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`\370\001\245\007"
+	.string	"\342\210\034&\200\265I\00730\225\001\037\220\001\201p\210\321\205\372\310\b\223U\273@\303\307\307\013\355\242\241\341\307Ek\237H\231\002?\002\003\001\311?\017\245y\357\214\322\"4\311\231"
+	.ascii	"`\"\210\237\213sp\fC\n\013\364\240}\307\350\214\021\265\b\254"
+	.ascii	"\2500\031L3R]\323\301\2247z\307\311\214\004\233qb\2647\345SQ"
+	.ascii	"\276\350\325\325s\276\312\233\366[\371\026\0049 \260\"\0313v"
+	.ascii	"e\"\030\nu\312\001V\345\216\251/d\212\265\354\334\201i\2204\205"
+	.ascii	"\343\203\267\201\201`S%-\362\233\260\016\302\212\002\370<0\305"
+	.ascii	"\354\226-6\354\3219\240\274;!\304/\356T\322\002\005% \321\002"
+	.ascii	"4\322@\"\200\006\013\340\333\355\263f?\302\374D\260\022\313\036"
+	.ascii	"@l{c\023\234\204\017q~\017&\374\f\360\311\272`\003\310\nE\031"
+	.ascii	"\330\203\274\034\244v:M?\027\306@\021"
+	.text
+	.section	.gnu.lto_.lto.74be6c90fbfa39f1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayClearScreen.3.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"\305\n"
+	.string	"V\324JA0\211*\035\310\270\210\\\217Y?\256\"\250\234\366\245ao\n\375\r\304\032\022\342\221\371g\335>\016\332\277\306FF\260a3*!\314\b\326\002\322\001\313\266\326G\r\003\213\263\242\350%\232l\262wJ\0016"
+	.string	"7"
+	.string	":"
+	.string	"\273#\206/\266S\217\227\320N\267Ch\247\016m\n\024\003\032X\243\226\205\335\255\023\301\303\313\320?\353\021R\tt\311\240\261\273\226\244R\201{\336\266\205\355\f\373\033\001\363\023D\223j\025\2221{\004\311y\262\237\355\356z\212\366W\1776\245\245\224\376\3061rE\270v\t\304.,\214>H \261}i?uU\370\325\347\017\273\"\004\007\001\246\324\237\321\354\356\256\214C\204zRP!\"\263i9-9 \232 \333\336[\037\333\256\210\3427\b"
+	.string	"z\264S9'$\030\344\f<\333\356R\374\005\235\220\ru\352\177\264\323\007\234ES\341\200\232n\263e\002\240\322\261\001\273K\005?\256\323}\227\252\351*\036\325\362\201uRao\303}\225\343y_\225\214\373l\247hj"
+	.string	"\026\232\002\034\036\243\331\334_\230\371B\005\020"
+	.ascii	"2\241O/0\\\020\224\312\207\364\366,l\0345\211b\260N\251\3155"
+	.ascii	"\235E\312\204Q0\352\022V\263\032\035\356\360\242\235d"
+	.text
+	.section	.gnu.lto_displayDrawScreen.4.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"E\t"
+	.string	"6\322A:@\305(\035\240.L\2744\242\222\304\316\t\2114\322\224\215\021\226\252\301\004\267ch\037e\365\244\350Cm\024\264\325o\355\030f\206\034\203+\262\216\007\216\377"
+	.string	"\203\t\"\233l\231R/"
+	.string	"."
+	.string	"2"
+	.string	"\016o\220]j'\310.\r\332,\b\026\002'\027\255\226\335\235\261\343\340\025\364?\362\013*U\272\0064\354\256\025\225\312\270\343m'\330f\260\r \366\261\335]G\225}\326\217E\265\252\372\331\246Q\360\332\305x\005X\227T\361\330l_\355\207\\\004<\213\364\201]\025J\312n\270`\005\3552\321\333\306)\226lwoAh\273'\215oB\361\215\262K\215\007+\216x\311H\333]\215O\"\222\320V\227>)\273|\304\254@X&}\331aI#G\036\316g\023\372>\234fNfb\343"
+	.string	"\372\270\316\374<\217\210\363:\363\303m\036&\307\373f\006\343\016\344\361f\250\353\274\271\205{l\243\312\362\303e\212\025\276(\026\255\001\013"
+	.ascii	"2\2417\034\330\270\360\224\332\334\322YL&4\202)\227`\233\325"
+	.ascii	"\224p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_displayScreenSize.5.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\225\t"
+	.string	"\246RC<0\345(\035\200\213\307\326)\374\365\210\034R3\247\227\256\320\303\211\203\255\001\224\276\371\317\366q\237k\261\301h\314FQ\323?#\202\004\201$d\312\t\334vi\007\001\001b\367&[\246\0242"
+	.string	"/"
+	.string	"2"
+	.string	"&\240\375\022\241\201\211\300l\270\b\354\356\266\271f^b/\230\227\021\344\340\025\364\217\362\004\327"
+	.string	"\325\352t\315@\354\256U\265\352\270\343m+\330n\260?\020\341\217E\265\252\372\031-\200F\300.\307\253\300\002\220.$\266A[\263}\265\337\372\t\370\320t\202]VL\313n\310\340\205\354\322af\333/y\036\251x\262-q\226\320\nFw1/5\"\230\342*_\266\233r\360SJ\025\331\310\245o\232\227\217\006!-\224\276\354\360\244\361\303>\266\221ec\352\371 \217\250C\372D\\f\017\307\24231\372\270\317\366y\240\022\347}6\021\327\tm\036\357\3338\007\356F o#u\235\267i\341\336\236q\203\212\031\326\024\213\3268\343C\r"
+	.ascii	"2\003\3020\005&d\220\035\330\233\322\\q\3062\327\360\207,^\003"
+	.ascii	"&\036\334\355Q\255t\204I\006"
+	.text
+	.section	.gnu.lto_displayGrab.6.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`/\001\225\f"
+	.string	"v\327SA\020q\233\016\300\207T\201\262"
+	.string	"\233\003u9\200\317\221-\242\225`EpV"
+	.string	"\270\f\360\373\004F\323#\342\2570*l1lA#vUUU\276C\372\274\345\0325\3103\377\343\232l\355\266\273I\231R@"
+	.string	":"
+	.string	"E"
+	.string	"$\270\213D^`7\244\342b\267\323xA\374s\367\003\360/\336"
+	.string	"\3743g\317@\200!"
+	.string	"\313'\245\306\356V\372\341\334\223\363_\342"
+	.string	"@&\236\347\324`w\235 \223\r\267\336\266\002\333\f\354\257\b\177\327\314\t\212h$Gv\347I\365`_\332\335\265\206\354\213\376\213\224\216/=\2754\224\322O\323R\246U\323\231\351\017\020"
+	.string	"\003\323bW\303\350\306\256\274\027!(\333O\373#\036$9\362S\250\232O\213u\025\327\323\004\"P$\007W\251\220I)T3'6\250\274\250SMu(Q\217m\bO\361\210\273%\034>\212\013Y\b\374K\305\310\260\204\237\b\211\273\313\341\233x\260E\020\177\276\b\f\227\325\341\200l\035,\332\332X\340D\370\330\260\216j\323.\n\230\326Qu0\216Gei[\265\3118\373\270\264\n$\313\264\212\352\366\322j\310/\306\312\210\2228*\213\213"
+	.string	"\313A4&\215\372O\313?\001B\235\364\0318\004\032"
+	.string	"2\241+h`<\020\022\001gl\343;\344p\231\0011\266\201\201"
+	.ascii	"\257`3\330\216\n\245\021E\b\360\323\202\tSI\013\206\353\224\332"
+	.ascii	"\334\322Y|&4\001\306\\\202mVS\302\035^\264\223\f"
+	.text
+	.section	.gnu.lto_displayRelease.7.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`\327"
+	.string	"u\013"
+	.string	"&VN>@O\223\016\367\3060f\362\266S\022\202\337PO\254M;\033<\230h\0058\357W\324\377\277E\366\022<\032\024\033Q\235x\244%\035\303\304\234c\206\234\374\013\367\030\312.+\356\2777\2212\245<"
+	.string	"8"
+	.string	">"
+	.string	"\027\260+2qb\227\243XA\3743w\002\360/~"
+	.string	"\374\363f\2578P!"
+	.string	"\013\020\310\213\335\245\224\303\267\347\346?\304\001\204:>\317\f\006\273\353\fu`\270\365\266\023\330^`\237\023\327\211\007\214\221Fv6\367I\335`_\332\335\265\212\354\217\376(\245\341K\277\227\226\244\264j:3\375I\362\301@\310\356\205.\306\212<\024\036&\333O\373\036\377\330>\362\004\372\364\0262ldgUI)\240\221\352!\rT\021|\200\2302\252S=i\340\320\217m\007\007\321\304]\016\213O\202\002\326\201\177\251\005T\030\302Gt\342\356Z|\021\227\026;\374\371\036\370\027\025\346\272p\264\313\212\306T&\\\036l4+CiY%\301\3122\324e]4\024&\323\250\312\304\330\246\312(\016\206e\324\304\355\245U\221\237\013\021\r\3350\324\022\222\024\017\265x\n\365\240\221w\217"
+	.string	"\245\024"
+	.ascii	"2\241\213/0.\020\302M\302`$\344p\231\t\004\333`\220\0266\230"
+	.ascii	"JZ0\\\247\324\346\226\316b3\2411\030p\t\241YM\twx\321N2"
+	.text
+	.section	.gnu.lto_displayReleaseAll.8.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\025\n"
+	.string	"F\223F= \345*\035`!\316B\020\\]\b"
+	.string	"\b\3124?\002\377PX\305\001\300Z\036@\356\2625\034jboa\005\225M"
+	.string	"\275"
+	.string	"\3000F7a\306Y\200p\201\324#\346\273\223O6\331;\2452"
+	.string	"2"
+	.string	"7"
+	.string	"\r\335\251\307\037p\247\335\r\270S\213v\214\302\306@\001\216\231\200\335\255s\344\342\245\350?vM\313\245\272\314D\354\256e\313\345q\317\333f\260\ra\177!5{T\311)b\177\333\335\365|\331\207\375\333\224\226R\372\231\007\220\204"
+	.string	"\273\0355\002K\243.%\033\333\227\366O\216\"\036\226z\301\356\213\245ewtp/\031\227\314\004\200Fn\323rz\023\302\232*\333\337g\025\335.\313\343\3132B\024w*'\002\214-\256\202\352v\327\343\247\234.:\222S?\305\235~rb\003`+\031\"\020\351c\nI^gP\007\3433Q\n\275P\rA\321\311\003C\225\344}(*\b\fk\207\343\257$\002\253\351\373\300\272\031\367\333\316\227%>h\253\251a\177\304\331\336WF\004\001\016"
+	.ascii	"2\241\003/0<\004-\354&5\237`\260Y\251\035-\035\300d\202 \030"
+	.ascii	"u\t\253Y\215\016wx\321N2"
+	.text
+	.section	.gnu.lto_displayIsGrabbed.9.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\335\013"
+	.string	"\326\026SA\020q\224\016\033,\222\366a\235M\030y\024q\bT&/\250\005\b_<k\017\353\225\342\340\324\262\266\327\277\213y\013i\357"
+	.string	"\221\355\252"
+	.string	""
+	.string	""
+	.string	"\315 \365\"\030\007\355#mO\230\027\023\270\367\2262\245C"
+	.string	"?"
+	.string	"@"
+	.string	"\333a\032\342\243\303\2479\362_\362\207\362\241F\007G:\364\360\367\n\200\240tP\220\0222\243\302mH}\226\017\025\254"
+	.string	"\334\351]X$ ^\362Lq\246L"
+	.string	"\021v\327\331\301q\270\343mO\260\355\300>\202\251\351\307\b\222B"
+	.string	"\306\256G\013\307\276\200,F\330\026\331\025\333\231\366K\334\204\350\253\320\005\354\252Z\234\354v\f|\271\016\335}@<\274n\211\207\266\335\340\201\310\243w\"<\036\222B\231\330\330\255\bU\344\215\230\234\320x\337\342\365$R\270\260\205\243\330\256\335\023\004\377D\206\013\327\310\3415A\214U)[O\026\311\307\nu(\252J\220q\312\033vGJ\025\261\377vw\255*\303\257~}\351\034M'\003\332:\331e\rFC\206\302g\3136\330\246q0d\332\006\353d\231\n\230F\3330\214\001{>\034\r\003y<\032V\351\366oU\345|\013\236zyj\3126\324\003%59\025\352Q9J\031\021"
+	.string	"M\204\336\031\341\265Qd\210\3235X"
+	.ascii	";\202\350e4\233\300\026\320\275\226\260>\027T\212j?\261\314\f"
+	.ascii	"\022\032\275Jc\2265\367"
+	.text
+	.section	.gnu.lto_displaySetXY.10.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\335\t"
+	.string	"f\022C< \005)\035 7\005\243"
+	.string	"\361! \270\r\332\333K\024\253\227\032/Z\211\326\200K\225m\330n\327C\026cfFf[$\b`\361(Y\364n\215\006CP\245x\241H\343\266{\247\024/"
+	.string	"3"
+	.string	"0"
+	.string	"/\330>\271\023l\237\016m\233W\221\275\254Ccv\263\273T\206<|\f\375\313\036\320r\255\036;\020\273\353\330rq\334\362\266\021l?\330O\b\261\263\231\314\030\310\354n\324\002,m\306\220\330\276\307\216\325\034d\264\031@\341k\312r\367\243\006\364h\037\345)\341a\252\017\354\276Z`v\353\202\025\270O\3276x\226\227\022)m\212\257\244\270\335m\360g\030\026\0024#\252\355s\252\270"
+	.string	"\360`\305\232]WQ\202\330\347\354\356Z\276\354\307\376\371\372\313\303\376\250_|\024\"u'\220\344q\016}P\235\204\t\364D\024\374F\025\336'\242$\257\233\240\241\017\244\237\003\227L\243\217\236J\245\217z\352\236\263\362\345\210\023\032Kfx\312\022"
+	.ascii	"2\241\033\034\030.\250\243|\001k\232\366\r\333\n\r\263\326\270"
+	.ascii	"0|\303\030P\016\f\006F\360\031\026\314\rPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_displayWrite.11.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`\204\001\035\017"
+	.string	"\006\235eE\360\260(\035\031\211Y\037\232\301x\317\343g\2738\255\353\331\245:3\366\270:,N#_\372\363\342E\213\314\2321\374\252\215\300\224\373\265\006Od\023\031\207\257\347\n;\033)\3357\277\277\315f\033!{\023)S\nM"
+	.string	"N"
+	.string	"W"
+	.string	"O\373\260\233\360\376\265\334c\367\205\242\305\356g\300\005\270C\177\234m\237\304KxvL\373<\270\276A\003\253\346\306\356v\241\007\210\207\332?\342\241v\270\367\364\374\337\\\023q!F\313\245zn\013v\327\331rY\270\365\266\t\330V`'H\251\034\354k\253/\203N\363w\374\373?\237\371=\267\371;\232\3364\035\2714\334\322ZLkL'L\337#\302\220!\340f\267\302,\307\346@\234\020\266=\373c[\263\231"
+	.string	"\002\332\325\211\f\thd\b4\355\003#\336gX\254\27315F\002$\276\013\025\007\034J<\204:\340\003\314\026\235\005\n\247)\224\211\341\200u\250=\372\n(\023\033\201A\325&]\005\013\267\273$~\n\b\017"
+	.string	"\320"
+	.string	"\321\022\017sF\313\206G\017\023\363\2223_S\265\206%s\311\231?\331Q;\202I\276u\r\201y\221\263R\225\375\251\002\251\257\234\302I#\223(%e*q\036\211\254\210$\234\244J%]\nER)\241J:SId\322\215P\251N$\304\247\023\022\252K9\235P\335\347\333k\253/\333\006i\310E_\374\221\035\215\272\351G\r\025\244!\226\252\354\321M\317\222E\375\f\226\214\301q\032p\273\253\036"
+	.string	"2\241\021\374P\2620`\245\243\322QR\211"
+	.string	"\231\260ERi\200e\216\"\215)\263\327\356\345\233e\236\313\bsi\027\306\2155G4\314\342\325,\267Ba00\300\005\214\003\303\370\f"
+	.ascii	"\214\020\250pp\367I\265b\022&\031"
+	.text
+	.section	.gnu.lto_displayWriteChar.12.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`l\001e\016"
+	.string	"\366Z_D\020\221\223\016\300Kga\214\272Z\243O\r\276\217\310\217\224\323\004\277\215\325L\346\240O\b\232o\254Y\034\233\354G\224\274\255\204\301\334\332\t"
+	.string	""
+	.string	""
+	.string	"\245\251\266\205\200)\210\322U\034\030\365\254 i{o)S\nH"
+	.string	"H"
+	.string	"R"
+	.string	"\334\273\225\207\354\272\320\250\330\355\016\330"
+	.string	"v\350\016\263\355\2178\t\316f\361:\016\255g\370\2602qcw\263\317\003\304\303w"
+	.ascii	"\361P7\234{r\376g\376B"
+	.string	"\260\264`\265PO\016\203\335u\262Z\026n\275\355\002\266\027\330\351\366\\\346\367x\314\337y\367w\034\346\347h:j\032j\372\305\264\302t\276\364A\242\215\030\002^\273\025^9\026\006\254\001a\233\263;\266\f\006\0051\247\203\254J\006+\201\246\215`\204;\314\311\272\333Bc\344i\337\365\022\001\242\3274\300v'\220\370+$hX\212\022\350\340J\331\301S\244`\251\360\345\205\bWG\355\223\323\300\027\0278.\250M:\212\023\266\273$\376\t\223\007\0373<\254\304\303\264a\325H\345\313\377)r\364Zb\231\241\320\242\312\227\335\241R5\330\177\253.\001\241\253<\302E\241\021\b\3054\3220\207DT@&%\223V\222\2316\021\004m+\311F\032\350$\013m\246Ld\200I%\321\226\241\220H[\326\351\366\266G?)U\371#\237B\215\332\241V\365\350g\245(s4\352W7P\357\241Oo\263\272\t\037"
+	.ascii	"2\003\3020\016l d\030\356e\304JG\245\243\004\345\206&XP&l\226"
+	.ascii	"Tn`\231\243\250\316T\302\316\206@\326\204\347\032^\2611\300\301"
+	.ascii	"\302TM\200\240\b\030\007\006\006x\004#\370\f\013\346\nT8\270"
+	.ascii	"\373\244Z1\t\223\f"
+	.text
+	.section	.gnu.lto_displayIsTransferInProgress.13.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"m\t"
+	.string	"\206RC<@\305(\035\340\345\376\267\013"
+	.string	"\37700F\214f\270\364 \203N0\317\256\355\2008\213V\257\276S\365\207\332X#[\375\326\216af\223\001\317+F\344w\021\310\374J\354\336d\313\224\0020"
+	.string	"1"
+	.string	"1"
+	.string	"\004\362\321\266\035 J6\375\023Y\375\303\245\001#\260\373M\030r\323\325\344\037\345\231IGL\305:]/\023\273kU\2618nx\333\013\266\037\354;\177\226\251\025\252\177\271l\0048\030\260\273\212\025X"
+	.string	"\261\245\304v\311\306\330V\265\177rW\351/\322\007v[\002Xv\277\0063h\217\376^ \037\265\007\360d\233\3420\317\n\0067\222\217\n\023lq\025O\333ME\370)\242\013\215\344\321'\311\307C\203\221\027Jc\366wR\bb?\333\3355lY\376\025\235\315G\023\362>\233\346Mf\244\251"
+	.string	"y\033gz]G\264u\234\371\3314\236\271\351\274\231A0\007\352t3\304q\335\304|{K\250\200\202\031\306h\006\255PB\t\217T\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_displayIsSynced.14.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"U\t"
+	.string	"\206\222B9@\217\322\001\230\016\013?,\273\0340\313D<M\200c?\002W\332,i|\264W\177\027m4\030\215\331\260Q/\351\030&\3261L\240z\301E\250\223\277%vo\262eJ\0010"
+	.string	"0"
+	.string	"1"
+	.string	"\001\363\322\266\027\032PN=\374p\235C\345B&\263\033r\321\343\251k\312\277\311\265\021\215\230\326Ku\325@\354\256\265\365\302\270\343m#\330f\260\357\277\246\2515\252\257\321d\300\020\270\354\272f3\373\"YDl\243\354\215mU\373$/A=v:\300.\254ee7Tp\302v\351\360\002\363r{Qe;\342\262PJ\205g\232\227\032\r<q\024p\333e9\370'%\212-\344\322?\315\313\307\001\220\330Jgv\250\322\330a_\333\335u\204y>\026 \217\250C\002E\335f\017\307\324\221\030\201\335\207\003?P\251\373>\234\250\353\2048\317\007r\234\002{#\320\307\221<\357\3436\341\3363\036\254\242\2057\252Ek\234\361a\203\025\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_displayHeartbeat.15.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"e\t"
+	.string	"\206\322B:0\345(\035"
+	.string	"\276\353\341\270\340R\312\264\201\026\203\365(\177\266\330?4`I\311l\315\3426:V\033\214F\251\242\246\177F\244\330\024C\265\035\220\267\3668\302T\311'\233l\231R/"
+	.string	"0"
+	.string	"3"
+	.string	"\037\320.\267\013h\227\006m\227\207\031\373\221\223\211\327\313\356\316\210q\360\n\372\007yf\305B]1\t\273k]\261*\356x\333\005\266\021l\307\002\317vw\035[\366]\177\026\325\252\352k\030\216\225M\311.E,\300\302\244\312\206\306\366\325\276\307?\300\273N\017\330m\231\240\354\206\0076\330.\035\006\032\013UD\331\356\376j\330vU\035\237$\3423i\227\032\tX\354p\021\323\266\273\035?\244\364\260i\\\372'\355\3621\246\264"
+	.string	"p\2454f\207(\215\027v\241\217\310C\372D\334\346\017\007\302\2630\3728\320\374\274P\211\363@S\304y\030\346\307\373&g\343n\024\362&\251\353\274\251\t\367\331\306\226\025:`\251(\341\214f\321\032\035\013"
+	.ascii	"2\2417\034\330\270\360\224\332\034\323YW&\264\202)\227`\233\325"
+	.ascii	"\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_displayResync.16.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"e\t"
+	.string	"\206\322B;@\305(\035\340\245\373\355z\001\306\3720B\232Q\220\202\224\301\313\360\244\321Lp\246\261}\224\325\223\242\017\265Q\320V\277\265c\304N\324"
+	.string	"\270\"\353\230\t/\332+\371d\223-S\n/"
+	.string	"/"
+	.string	"3"
+	.string	"'\310.\265\017d\227\376\354"
+	.string	"\0175\366\"(\024,\001\273;c\306\277\353\347\177u\013*U\272V\024v\327\212JY\334\361\266\rl'\330~\005\307vw\035U\366\301\037\213jU\365\263\n\230\202q\355V\274\006lK\236p\\l_\355{\374\343;H\272\300\256\212\244d7D\360\201v\3510\227\213S,\331\346\316r\320vO\032\177D\302\033e\227\032\013"
+	.string	"\370\341!#mw5>\210\bB\333\270\364I\331\345c4qu\200&}\331aI#\206\035\036\316g\023\362>\233fN&b\303"
+	.string	"\362\266\316\364:\217h\353:\363\263m\032&\247\363f\006c\016\344\351f\210\343\272y\t\367\330F\225\027V-S\234\260E\261h\215\016\013"
+	.ascii	"2\2417\034\330\270\360\224\332\034\323YW&\264\202)\227`\233\325"
+	.ascii	"\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_displayTxBytesFree.17.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\375\t"
+	.string	"\366\222D;0\345(\035\236\213'\230\235\300ILT\302\332\275\322\031X\364\310\177HQO\332\334\326L\377\365\361\032\214\306l\0245\3753\"\"\031\300\340qS\264\362\005\nye\b\341\266r\247\0243"
+	.string	"1"
+	.string	"3"
+	.string	"(\247\342\354\270\320d1\255\223"
+	.string	"\273\263\033\270\201v\031_\240]*\307S\217)\377%\317\204d\270\270^\252\307\355aw\035]/\214[o;\3016\203\375M\321\232\211\216\032}nk\201\341\260\354Z\314\004\354\213\\\001\261\215\2625\266c\264\037;\t\352\363t\202]\030"
+	.string	"\225\335\271`\005\356\322\223\263\355\213|$\252\352\240\301R\225m\357)\020(\024\"\223r\374\335D\202\333e5\370\262R\310}\\\372'\355\362z\340\021[\305\231=UQ7\354gVa\336>\177)\003\241\317\310S\nG\036\347O\307\344\211 \205\036\250\013\301\320\204\007\202\272\221\347\021u\0370\354:\033\177\244\020\330\225\276\017\3544s\357M\021VZa\325M\337\032 \020\245:\006\020"
+	.ascii	"2\003\302\260\r\273\032\f\366\202\354\224\2568\032\213)\315\325"
+	.ascii	"g,s\rG\231\300\256\032\257\003\023\017\356\032\251VL\302$\003"
+	.text
+	.section	.gnu.lto_displayInit.18.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`&\001U\f"
+	.string	"\326\326R?"
+	.string	"Q5\035\203\366"
+	.string	"\366\200\005\002U\325\300\023\361\203\343\240\211\356\244\360\027n\325D\351\213\272\326T\203w`P\016\215\002\006A\210%W\265\"\345\273\017\177\026\3652l\365\243\300\221\202\032\331;\245="
+	.string	">"
+	.string	"E"
+	.string	"'\260\0332\275\330%\031xA\366\313\344\r`\277\262\027\300~Y\264S'I\354K\251\016*T\273[\351\210\213\237\242\177\024\007\340\371l>\037\021v\327\323\363\371p\323\333V`\373\201}Q\277 c\t\032\201\340\314\225Mn&\025a\337\332\3355\r\331'\177\353\244\237\322\351k\020J\325\214\004\253\335q\305\261\345\2052a\373\232\355In80`;%\017\r>\355\213>\022O\322\004\016F\031\357\336\242\2161@\242\215{\230m\341&\357q\3528\261\021`R\352Sk!:tc\233r\026_\266\333\211\370+2\0272\f\366\353\364:q\320 Y\324\016\237\002\223\355n\304/e\300 "
+	.string	"F\t\r\026\335\244\3026!\203u\\e\273\204\025/3\007\321\260M,\241'\251!\330e<PR+\336F\251\034\030V\b\002\177\226\016\254\227\357\003\253F\356\255\245!K\350(9\224\203E\nGq\237\032*\016\263\267\273\340\002\030"
+	.ascii	"2\241\365/0.N\322\213\334AG\024\\\016\322\200\274\240\035JiY"
+	.ascii	"\230p\274\220z\255\202{\252<\247\301I\213\273\016a\215k@+\f\r"
+	.ascii	"\n\203a\001*4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`5\001\205\005"
+	.ascii	"B\307\033&\2209\035\377\377\260\304\323\366\377Pk\227|333\376"
+	.ascii	"\001\376\201\177\340\023\366izD\"\"\"B\2336I{\357\024\255\250"
+	.ascii	"Ir\004\031Z\036\303,\032\263\342k\354\226=\327<iNgf{e\"\0274"
+	.ascii	"\310\003\217\003\034\267\032\257\030\247\026\237\024\227\022"
+	.ascii	"\217\020\207\016\177\260G\303\235\302!\341\315\340\246\344\245"
+	.ascii	"}\213\2514gf^\177\256\255\223\004\" \200\203\304\325Y\3105aE"
+	.ascii	"\232g1\0232\310\215ac<\337\230\240~\t+\004\211!\f3\3640]\306"
+	.ascii	"\354\321\316\347>\367\271\237\373\234\317}\356\347>\347s\237"
+	.ascii	"\363\271\317\371]\333~<"
+	.text
+	.section	.gnu.lto_.refs.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.74be6c90fbfa39f1,"e",@progbits
+	.string	"(\265/\375`\366\030\325l"
+	.ascii	"\332"
+	.string	"\260\364&Q0P\322I\007\316\323\306\304\347\177\216g\303\377?\277\377/u\020~\272eB\200\217\303OE;\025Lc\301\250\315\207\255\375\360IH4\301T@\357\303\277\210(\325Y\034\240R}\034\312v\337g\334\201\260\002\302\364\341\245U5\026\034\310d\020\"e\n\377\001_\002~\002,g#e\304\312\252Q>\002'L\022onq5[|xR\032\3457\206\3436\005s9\213D\264\301\2354I\322\260\222zN\221r\223S\244\317\241\276H]\201\345J\212\246\006\206\306\312\371\212\225\f\226Sl0\250?Sq\303!\2627\344o\312\331\355c\332\215\256\214\254\321\357q\033\373\200\002dH\233\224`\327\017sU\215\232\001\251x\361a\252\321\013\251o\331\004\333\232\312\267D\273\007\345\274\366\263h\301i:\367\032\300]\374\23605\312i\315h\254vN\343\"\316\242\305u\226.\331\275-\247\241\367\032\231\025"
+	.string	"2+Pc\305\313h\226\242/A\375\336o\200]\234\216\\5\372\363\223\237\2270\031\237\235G\247\345E\273\267\355\261\351\242\304\353L\243fm\030\020YJ4\372\fT&\202\235\264\327\307f\307\224\030\260F\017\244\236\233\034\205\361\266x\216\372V\337\326\362\211Te\023)\003\351\2400\341?w~N\177\346i\340g\233\035\376\357\374\335\374?\345g\023n7\304"
+	.string	"@\004\243\262H\374W\373\371f\255\313\377\271\237q\350\204\\\376\347\375\034"
+	.string	"Wa\375's\003\376\303\360"
+	.string	"\376\326\362\263\213\237'\270\315\337V\004P\377N\313y\222C\203\223\237#\b\262\325\203\177\227\3757\363sO\214\377{\327\371;\311\316q\376\016\373\271\305\317\007\374\034t+?\353\260\370\225\003\3776\362\263\362g\246\237y\370\371\306\317\304\237\331\237m\374,\374\371\350g\033~.\372y\306\3174\374<\303\3171\374\f\303\317.\374\034\343g\241\237U\3709\205\237Q\370\371\204\2375\370\217\366\363\211\237+\370\331\204\377a~&\341?\227\237G\370/\300\317\"\374\034\302\317 \374\374\301\317\036\374\334\301\3170~\346\340\347\r~\316\340g\f~F\361\363\005?[\360\263"
+	.ascii	"\377W\374\177\373\337\323l6\233?j\343?\007\370\001\220!5N\312"
+	.ascii	"\244\031k\224\f\254\351\316L\243f>-|\211\352\322\350[\374\300"
+	.ascii	"qJ\312\362\200\270\230!\226lqq\\\023\246\220.&R\310\276e\020"
+	.ascii	"Nc9\245\005G\326\362\254\256\032\b\360\2747\213\215y\357E\322"
+	.ascii	"C\264X\037\351$=\326K\332H+i0n;\214\235\274\277\272H\373`6\020"
+	.ascii	"\027QnX\023i/\316R\"\205\354k\035Z\234\306BM\n\331\027\326C8"
+	.ascii	"\016Xlo\324\0132)d/\207\254\025Q\240\357/*\267|\"\365a\023^B"
+	.ascii	"\3340qi\031\201R\240\226\374:\bF\263\223\006\311\234\234\372"
+	.ascii	"\326\242\276\253\250o)\352[M\345y\242\372\264\230\372.\242\252"
+	.ascii	"\340\023ic\365\017n}:+\310sJPX\215\276\207\250<\334&\373\244"
+	.ascii	"\357,u\005\237H]\274\225U9O\374\262\230uUS\275\300\246'\246\321"
+	.ascii	"v)'L\226\226%\231\027\326\263\213b\004S1@\351\030\302\030^^\224"
+	.ascii	"*\214%\214\024r\f\2112\314\027t\204\024\262\257\254\331\307+"
+	.ascii	"\205\302\030)d\037\320\2317\346\337\311\356\241\247\232G\373"
+	.ascii	"\320M\335\243\245\032\252\237\332\251\221\334v\024\2439\377q"
+	.ascii	"\232\373\264\367.\335{\317d}qL%\226\340\302\004\362c,\300b\317"
+	.ascii	"\275\\p\314-\\\007\206\311~\316\242\205\331XN\3312p'\205\034"
+	.ascii	"\273\267}\004?\227E1\023f;[#\367r]\025\300u\026\245\245\357\336"
+	.ascii	"\326\001\037\007pt\210ee!\340\330;R(<\274\254\276\357\035\315"
+	.ascii	"\224N\201\373\301\251\321.\266\221[\025\255\364^j\035\277Yj\357"
+	.ascii	"\331\215\2272?\320\032M\200O\244h\030\365\254\"\r6\233\315&\253"
+	.ascii	"H\217P\323\313'\322\313\361\232z\206\242\236\231\250\347#\352"
+	.ascii	"\371\007\225\207o\017}\353+S\302\314y\017\370\224dK\017\2152"
+	.ascii	"\226\372\263\036\031\034.tuuyg2\301\250\243X\243\234DN\224\256"
+	.ascii	")P\215\362\030`\021[\306\2024\312br\226L\245\211\341\005\305"
+	.ascii	"\3164y\301\013\263d\252K\2106x3\345LX\217F\331\216\301\234\357"
+	.ascii	"\370\313\345;\t\226wA4\367\032\203\314\n0+\200*\331*\242\226"
+	.ascii	"\242\347*\365\334\244&PG\007tk;~\315\235\351r\354\250\220\350"
+	.ascii	"\302mA\037K\036N\032\r||\354\006\307,\202\373\333\022b\306\f"
+	.ascii	"\273I\311\263\371\362\262\3438\245\247\247\246\323e\366eD\243"
+	.ascii	"\257Y\312\313\3435\272\262+\2771\n\344\200\274\331\215\031\303"
+	.ascii	"tt_L\241*NOX\360\360\230\314\026\220\274\035|\030\225\324\274"
+	.ascii	"x\351\273\013\314|\344y\375Xk\264\357\306\334\211\211\nk\264"
+	.ascii	"\355\270-\b\204\215)\255\321\376RVW\307k!\334{y\253\351\312\257"
+	.ascii	"/\315\253\342\325D\210\271\271?\024\bZ\034\236\225\234\034\273"
+	.ascii	"%\301\004\232Q\201A\233\342\342\330\r\317.\370\244\267\247\244"
+	.ascii	"\t\007\307{<W\351\356-\017\247\n\036\026\226\230-[\330Mm\017"
+	.ascii	"0\342\312o,Xl\345\242\274\251\357+\215\345\235\345Y\330\215\225"
+	.ascii	"\367\304kr\345\327w\225J\0258>\214a\236D\324\367\237^#\362\336"
+	.ascii	"+U\323^\244\222\316\271\206Y\305\277\303'/\360\037\275g\020\327"
+	.ascii	"\275aufT0)\306\253'p?vo\261\347\266\027y<\323*\036\237\314%{"
+	.ascii	"\332\033D\200{\306u\217\255V\022]\336\276\355\345\273\244\225"
+	.ascii	"\304\341\330.\221\307vY\344\271K\313\342\275m\222\347\210f,\362"
+	.ascii	"\361L+y<[&{\356\322-\3363c\020ui\231<\302-\223<\3073c\362\270"
+	.ascii	"\244\225\354AR\347E\244\251K\313\216\247\034\227.\324\023\226"
+	.ascii	"\021\311#wl\227\327\356^Fc\272\310\005\356\305Z\"\355\214U\334"
+	.ascii	"\246$\007\245\304f\\r{\357\035\340Iiky\227\344\216H\226\367\""
+	.ascii	"Q\252q\237$(\266r\027\b\226+ra]'\246{\t\270\355\275O\367\026"
+	.ascii	"\371\312\335{\213\367^\033$V{\257\025\317\221\371\364t\257\322"
+	.ascii	"\347\351b\025\2470\335\333hwm\311\343\331\326\022h\n\2243\346"
+	.ascii	"\335\321\026\231y\355"
+	.string	"\264\220\352Y\321\311u*\2432\223<\364\032\007J\314\b\023*n@\260\036]T\330\326t\232_je\215\322\2259\036I6J\006\007NH\017\177\215\266\301;\272+0R\332\2104RE*\035E\247\310[\221\"dT\364\250D\027\245FQ\245-<\260Z\276e\322KZ\037q\376\242\312\254\241QI\255\224K4\025\301\026\334\322$\311\027\224\272\260 \330\252ZO\347K\307\227!\316R\004[\252'.3\276\037R:\232\232\210v\222$O\251\327\250\031\363X\036i[\237\2350h\270\3045I\263Yre\013\215\tc\t\257\001\001\r\241\021K\034\376\254EIGDB\243\037v\230\364\203\202(c\325\301h\230\036\035%\t\205HB\033\034Hl\r\"\222\320\246\206\241\365\b]\331$\033\250p=b\211\303\224h$\024\201(#\b(\206\n!\004\013h\241\205\027\\ \256:E\353\214\241\b<GG\033\250"
+	.string	"\2341\304\202\220#\324A\317\211`"
+	.ascii	"p\"#v\025\2564\324K\020\364@\220\213\034l\356\342\305\212\027"
+	.ascii	"+\322\273x\001\004\364\"\bH}\020\320I$\n\223\220"
+	.string	"`\334\334HW\"\243\033kQ:\304\201\304\242\303#$\"\324\205\027\206H6\320\243\243\244\017\326a\322N\321j\223\342@R\201E\032\262ID7\257\221\342H6V\366\207\210\204\304\376\344\020e\260\210@]W\366\203\341J\314\301A\016\304\234\241\214\365h\306P\f\026L\314\030bi\240\353ph=ZY\033vh=\"\312\021\3021\304\026\341\254:\030\t\t\327\225%\032\342\260C5\210P\032B#\226(\224C\224\341\202(4J\262a\207j\300X\211F,\216\233\341pei \261(\bE`\327\032\206\302!6\306\320("
+	.ascii	"\342\320:\203\310\016\2555n\210\2049\206+\233\036!!q \243\206"
+	.ascii	"8\224Ad\221P\3309\020\020\214\004V0\001\004\225\b\202\034CG6"
+	.ascii	"\206FE?Cv\275a\304\026\375\b\215\206n\370!b\207?\020\030P\264"
+	.ascii	"\022\ts\b\r\215\324\037\247\262-\252\t\224F\317\253>\255N\254"
+	.ascii	"\237Wo\317+\004\320\004\255\326\262\034I\321\037\177B\035O\345"
+	.ascii	"\251\247\336b{\225\313\"\231\013\254\364\351Q\365\335\243R\305"
+	.ascii	"N\024\253$\313\250\237\312\237<X\2648"
+	.string	"\253v\240\254h\3615zN\235=\270\375\333I\365\024\251l/\032\320mG\332\033\032\365<\360\337\322S\352@%\027\267<\344\231\374op\300\204\234\211\231Q\377\200J\004U2y:\375|bb\205\211\016O=}\370\331\324\005%7\367E\375\317\036\376\033\0352BP\021\231S_\363v\026\317\342\3114F\355\361\327\367\345\324\361\223I\207\314\257\030\244\321s\211\333lZ\244\217S)\213\tD\330\251t\032\201[\274\262\252:\212\232\006\206\356\207\224\276\276n6\323\006\212\031\230\274fJ\2026\304\022\357f\247\341\351\342A\327h\373\365\031n\033h4\357\277\026\362\032c{\333\016\342/\315\254\321\256i =\233Mn\240\006,\202\003\250B!-\310\362\030\"4#22\232$\205\016\002\013\020\bca(\266\314\003\022@$-\222S\320\031\232\021I\031\005I\2450\254\001\323 \275?e\330\341r\3324z\210\260"
+	.string	")b\304\217\347S\035\250\340\317\240\373\346"
+	.string	"\333s\002\357N~\345\271H\320D\023\372r%\241\033;\322m\225\240\336\365\231\226\236.\340C\002L\342bM\230r\223\316\254\001S\320\263\364\002t\353'\207\240\370\373^\243\350\243\242\375\210\021y\206\201\222_G\025\b,t:\306vn\275\026\221\201\240%\023\214\206B\362g\365\203)\273\353!\334\270\276\237o\205\270\030\241{\323\034\354J\344@\002L%u\024\237\263v\204\177\233"
+	.ascii	"\r@\353.5\323G\350\217TJ\243\241E\\\220b\244\267]\353\206*\265"
+	.ascii	"4\246\023\213\002O\247)s\025\226\315\3032\213Q\334"
+	.string	"Q\221\252\216XG\n\257\264\250\223\274\350\n\275\320\347\307\013i\336\336'\227\330\f\246W\nG\266c\361\031\313\326\217\001\302t\314O\357\370|\260\212\325\034fc\240o\330r\f\246\374\275-\365\334\366\321\366Xh\035\367cD\306w\337\344\301\212\257\3533\202~&\342\275;\022\253h\2535.\257\246']\"\030\213\252\2671\370\314Ms\364\372T?\033\b\211*\352\347[H\002\b\227\361\225\233\246\374V\030E\203b\364\302\235o.\275\206\266I\003\242\354D\214\t\314$\223JU\033\325;\002@\273\204\204\r\025sD\252\264\255\005\257\220P-\331\273\020\017\254\220\375\341\300\321t\210M ;9\374\230H+N?\336\203`\307s\357SI\354\341\225\221l\356\004s\034JLG\340y:2<\352\361@\3102g\333{8\261\306\267\3750\253KD\2741(\026Op\362oc2\360'\343\277\334\347,\203\250qq"
+	.ascii	"T\212N\305\004\31747!\227\342\322\016\2000|\257b\240{aB\253\r"
+	.ascii	"\3756\363\016\3178\313*\261\323L\341\302.\333\034v\317\356xV"
+	.ascii	";\321\201S\"5\250\251\032D\253\362\364\017\032\241\211XX\237"
+	.ascii	"\3127\2202D\001\007\371f\202u\022\037]\207\366\370\366\\\027"
+	.ascii	"\214\314\253\377\304Q\355*l\006\253\f~\f\304P\376\n;"
+	.string	"\006\270\032\245\t\\\342)\007\267\324\347<\332\203P5~\356\351\301\263\210\023\300\013U\255\223\304\326Z\221\271\310\342\362a\0340\022\307\265'\206\2163P\2148\004\016u5\372\203\020\277\033\177\342\001\013$\254SLg\003U\275\263\006\321\364\002\235\261\027\270m\217J\034\031b=\324\330\216\377\213\3155\356C\326?\001?\002\225\345p\347\314\354;nS\246U\307[P\302\216\260\326\302\305R\301\235\265\347\352\036\310\207\2724bYE}\314\021GXPpJ\366\301<\225\346\300\203\327_\252\026\254e\023\351\353\220\244q\232n\241!\264\243\021aj\242\0306p[U&z\3659-\346\242~\n\344\301\342T\205~\034\300BcL\361.\205A'\306\251gC_\340`l\263\035\233\247fdz\353\356*\177m\304\272B\353e\273wm3u\026o\322\177%m\022\327\234\371\001\373\323 \301\365\271\341\227m\3007W\343"
+	.ascii	"\356\320N\300\345\221\374\245\026\017).l\237\320\376\bI\032\203"
+	.ascii	"\277Bq\354\025?\n\235\377\334\246\345Go\234\243\365-=\"\334H"
+	.ascii	"\336P\323\355\357\204Q~\200\334{r\277\3753\302O\365M\337$/\347"
+	.ascii	"~(\235\025\177\003\006\232c,GT\032\336\264W\361Ny\264f\326\243"
+	.ascii	"\361\275\212\360Z\267W\274\313\336\330x\347\233\347O\366p+U\323"
+	.ascii	"!\201\261\350\213\213\360\021/\330q\350>\252\227\372\201\370"
+	.ascii	"\331\313Z\001"
+	.text
+	.section	.gnu.lto_.symtab.74be6c90fbfa39f1,"e",@progbits
+	.string	"displayClearScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"displayDrawScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"displayScreenSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"displayGrab"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"displayRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"displayReleaseAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"displayIsGrabbed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"displaySetXY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"displayWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"displayWriteChar"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"displayIsTransferInProgress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"displayIsSynced"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"displayHeartbeat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"displayResync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"displayTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.74be6c90fbfa39f1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
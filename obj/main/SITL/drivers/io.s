@@ -0,0 +1,834 @@
+	.file	"io.c"
+	.section	.gnu.lto_.profile.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\325\005"
+	.string	"\264\b\016\001"
+	.string	"\026"
+	.string	"\370\216\225\261\004"
+	.string	"\001\276\237\344\233\016\002\002"
+	.string	"\002\001\002\303\365\340\332\r\002\002\002\002\001\003\377\223\325\230\004\004\005\006\224\364\237\314\007\b\t\317\253\250\341\002"
+	.string	"\n\271\225\361\330\017\006\003\002\004\013\247\204\361k\006\f\277\225\306\207\003\r\356\242\353\274\n\016\233\204\330\275\n\b\017\302\311\343\254\r\004\002\005\002\006\002\007\002\006\020\311\256\332\347\002\002\021\324\314\220\352\001\022\346\364\307\250\b\023\234\253\215\342\007"
+	.string	"\024\025\240\342\234\212\n"
+	.string	"\023"
+	.string	"#3\034\234qiMf\333\302+"
+	.ascii	"\234\001G\261y*'\201\226(Sc\020\303U\260\317e\263\247\306\003"
+	.ascii	"[\\\3662g{\032\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375 \273%\003"
+	.string	"D\003\257"
+	.string	"\025"
+	.string	"\001\003\001\002\003\004\005\006\001\002\007\b\t\005\003\n"
+	.string	"\003\013\002\001\f\001\r"
+	.string	"\001\016\017\003\001\020\021\001\003\022\001\003\023"
+	.string	"\001\024\001"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\026"
+	.string	" \006\b8\347\300\034\005\020p\314\031 \260\325\213\335@\004\304\200\340"
+	.ascii	"\307`r\003V\30080\030\030\002\306\201\301T\246\275\004\267\201"
+	.ascii	"6"
+	.text
+	.section	.gnu.lto_.inline.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`\343\006\345\016"
+	.string	"\026\022?7@\305(\035\347\332\301\005X\fIK\216Z\244\303\217\002\313\275.\031\321Y\003\f\227h\304z\013\262.\337\206\237\322\030Q\024\005\br\0046\241\255\221\330n\233H)S\n)"
+	.string	"2"
+	.string	"5"
+	.ascii	"X:X}\220\222\210J\243g\335\250/\353\364\344\327V\277\274\357"
+	.ascii	"o\272\276\235\316~\200\020B\330i\177K\b!T\373\300\026U\353+\244"
+	.ascii	"DEF\tf\354\362,N\300\370\377\311\026i%\242\034\317\356:}W\363"
+	.ascii	"n9b\242\232\270\234\2539\267\243\001R,:\356\347m/,\177\006\027"
+	.ascii	"\240\244\270\370\210\300<\212:Q!e\034\220\321\366\3553\346\360"
+	.ascii	"\220\343\365\244w\343\375\254\206e\371/\270,\033\356F$\rV\346"
+	.ascii	"L\243\331\023*\004\305y\200\240X/6\3304\306\330\332t\2141^.@"
+	.ascii	"\360\246\016\200)\224\272\230\300\3669jL\336:\320y\347%S(\345"
+	.ascii	"\254\345:\323\007\345jE\264a\261@b\2501Ud\214\304\202\024\024"
+	.ascii	"*\313\001\300\"\231)\232\007\022\300\203\025\304\241\220b\004"
+	.ascii	")&xB\211H\242\222H\242\250\202\344\001Z\311d@\236\316\b\224\026"
+	.ascii	"|\333\226\315\0327\356\377\f~\352;9\301\222oX5$[\316\306\321"
+	.ascii	"\223\001\t\200\246\233\241\236\304\321\002\322\376>\373v+\246"
+	.ascii	"\205\t4\020\336\364\300(\321\220\243T\227\364\205y\330\031\302"
+	.ascii	"\261\331jw\366\\\236\032v\307%\226\224x\321\352\322\321w4O|\004"
+	.ascii	"\273\276\3621\177X\300\261\r\032\302\"K2\003\nj&\247B<g\241z"
+	.ascii	"\033\232\022\324\032\272)\nM\230\036k\332\003N D\203\006v@B\210"
+	.ascii	"\035\376\306\326\267dS2\252\3538f,\255\346\344t?zW\300\273J\226"
+	.ascii	"\345\336\242\222\033/\243!7\272\037\307+F\031\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375 \357\355\003"
+	.string	"\"\206\024\037\240'\351\377\340\377`\031\376\377_\373\377\277\371\357\265l\366\377?\351f{\355\177\322\310\226I\006L%\037A\036\f\005\202\322K\024\177%%\031 =\353\245/bV\362\005\201\031\277\030\260 \276\240^M\363a\370a&\213\216S\265\262~\353\3253\301F\021"
+	.ascii	"1\207\200q\201\032M\324-0Ne\260\232\203\0365D\240\230%J\231\227"
+	.ascii	" \300\0200Ne0\234CP\031k\003X"
+	.text
+	.section	.gnu.lto_.pureconst.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375 D\335\001"
+	.string	"B\304\r\026\240\2531?\360Os\377\377\273\376\257M\3234M\3234q\334\254\f.\311*r\310\037\317\361\032\217\361\026O\361\022G\\\207\033^8\341\203\353\202\007\016\270l23*"
+	.text
+	.section	.gnu.lto_.ipa_modref.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`p\001\375\005"
+	.ascii	"\"\307\025\035\240'\351\377\347J\374\377\277\253\316\377\327"
+	.ascii	"\377\2738Ik\275\3667YK\333\266\326\232\224)\2476\b92\217\026"
+	.ascii	"\322\276\212\210\013\205\027J{S&\fB\007J\"\342M\024\251\202g"
+	.ascii	"\312\227v+\217\001\236\002\034\003\023\244\2162\314\276\323\357"
+	.ascii	"{\316\253\334\312\37782\335C/ \320\002\0212\362\201\271\261."
+	.ascii	"\204=\262\272,2\005\002g\325%\343\271\3731:X\345\223wM\367\210"
+	.ascii	"\030\f@l\230\n\006\026\027 \334\002\023S\020kF\035F/\017\233"
+	.ascii	";'M\272\2554\0068\227\211\024K\324\027\350\2055,\211\021\374"
+	.ascii	"\336\306b8\334\323\320^9ke|1\307\202Q\267\367\230\305\342\242"
+	.ascii	"\273\001"
+	.text
+	.section	.gnu.lto_.lto.88c68c7ddd0e7878,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_IO_Rec.3.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375 \364\245\006"
+	.string	"\002\r/4Pm\222\016\244\204\270\2327 \222\350P\013\213\212\035^\026\n\264s\025ffw\003\320\201%x\227\354uUUuUE\277{\022j\276^\307\376n\226\020\231\002\257bs6\257r\036\330\201\250\340\202k\250\024\030\034\007z\334F\363s\350@\367\360\036t\231\230m\327\215@\242M|\004\261\206\361\265d\273\276\244\266\215B9\031H\311\254(\255\244\311T\322\361\367\377|\346g\254\244\210\002d^\034$\231\021a\003L\247\377~\024\344\263\245\211\032#Jd\203bD%3\272c\005\250N\230\006P\235ZF\2552\3536\244\026\217\213RH\004*\273$d\346,$\032\365\326\277\340?\370-\002\007"
+	.ascii	"u\bX\347\220\255\302q\r\017\303\204\"\374\314hj\347\023"
+	.text
+	.section	.gnu.lto_IO_GPIO.4.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\275\007"
+	.string	"\302N56Po\322\001\220l\272^\212LWc!\226\355\321\272\270\261\341\020zq\001\213|\224\017\004\372\313\214@\302\fPU\021Q\214.r\347\007\215B\255\2064\262\211\334)\005\361r\346l\342\0051\331\231\270d\003|\270\030\034 Gbp\243q\204\350H\030\021\243\204\231\251\235Z\335T\0134\375\330\306n\"a\355f(\370%\026\024\026\310\237_\241"
+	.string	"$\315\235\354\371q\332a\237Z\335\254'\375\216\252L,\004*\273\033'\323\256\274R\210m\217\235\261\355\334I\027\017\330\335F)\2733\301\007\326\237m\177\344#\2173\315\374\020aZD4P^v'\364\374@\365g]\240\372S\217gw\231\177\222S%\016\027P\b\343\016\263\260\273v\240\220\350\326\3336\260\215`\373$\013"
+	.ascii	"2C\027\r\f\304b\224,`\303\204\356\032\0161\201M\032\343\016A"
+	.ascii	"\n?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_IO_Pin.5.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"\335\007"
+	.string	"b\21766Po\322\001 ;\323\216i\212w\301\022_\006S\003\022\310\361m\251\336\016#\362\021\034\003\377/3\002\t3@UED1\272\310\235\315\317\301q\031\322\310&[\246\024\361R{:\361\202\230\374T\\\362\001F\\\016\020\320#1\330)p\224\370H8\021\243\204\234\271\335\316\035l\016d\033;\013\205\265\273\301\340\2270,\254\222?\377\302\001\2206\255\261'H\235\210}jw\327nd\367\371+\265\001\22110\355v\324\320l\314;\235\330\316l\216mU\373\244\253d\237\031\027\330\035\231\274\354\316\005'X\177\236\226m\037\345)\2315\235$\036U\311\205\243efw\302\200\023T\177\372\201\352\317\215\\\273j\376WN\235B`B\"\215\353\246aw\255!\321\307\355n\033\301\266\202mS\013"
+	.ascii	"2\003\302\260\2268\0343\203\031c;\227Q&\215\321\201\t\002N\030"
+	.ascii	"\251VL\302$\003"
+	.text
+	.section	.gnu.lto_IO_GPIOPortIdx.6.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`\b\001-\r"
+	.string	"\306\031ZB\020\221\223\016$=q\305)\371\347\340\345\242\324?\320W(\236H\024\234\351?\207\b\353"
+	.string	"\243\3565\264\256U\034u\025\024\025\3565\036\t"
+	.string	""
+	.string	"P\301\003\005J\360\324\255,v\2144b\215\020\262\245\224)\005H"
+	.string	"C"
+	.string	"I"
+	.string	"\243\247lvI\273\021\334A\3000i\271\261\273\330\201\023\240\376\364\003\250\277\024\361\355\232\270\371\026\256\267\201b:\3416<\325\301\013w\""
+	.string	"\367Q\0042.\276r\fq \304\312cw\215'\234\206\373\335\366\003\333\013\354_\b\326CW\357\376\247hMt&\032\023}M\245\"\306\200\313n\206\223\216\205y2L\370,'\215\234\205_\214\f\212\335\275F\354\353\233}\241}\225\257\330\336\221\\\300\256(E\214\335\216\201\025X\177\356,\333~\211\251\245\222\016\037<\271\312\347W\256)(&\223\231\223\034\362\026\231\265\013j\340\273\210P\360I\374\371\035\352\257\312\223\236\200\243\201C\305\203\247\3341#\364!MB\275\344\200\301\304R\003\2049\354\356\203\031\302\276n\212lE\007\031\007\375\261\3118XG\003\251\300\321\"`\0228\020B\260\017\255\203m\n8\233"
+	.string	"\242a\"Y\246a\227mw\236\353\246\310\t3z\221\226\306\303\250\004n\256\031\262\255i\017O~4\323\312\003\270K\024ff\325R2\263\335/\324\003\026"
+	.ascii	"\237\033\307\026\201=\266W\017M\263\n\2774\315\245)+\240\341"
+	.ascii	"\321\025^,\031X+\271\220\007\334\030l\312tP\226\274\232\036\031"
+	.ascii	"#Ae\016\332\215\244\004\224\252\006\232KA\001"
+	.text
+	.section	.gnu.lto_IO_EXTI_PortSourceGPIO.7.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`4\001E\016"
+	.string	"\306\332^C"
+	.string	"\223\223\016D\266\340\340\271\337\023\346C\213\212\233\332\372^\016F\006\036C:|\203t\n\236\313t\367w\313B\024\3430\2365\252\"\206\023UU\t\240\003\nB\230\377Y\002j\253\246\306O\310\336[\312\224\002K"
+	.string	"I"
+	.string	"L"
+	.string	"\266\352u#\270\203\270!B\355\330\335\314\300\007\304\303w\001\361PE|\373\323\334\374\323\237\013\013\214\021\227\341\3579VX#\216\303\3655\220\341Z"
+	.ascii	"p\240"
+	.string	"w\200\306\305QO\022\027\312\274\034\354\256s\304m\270\341m?\260\255\300~K\351\367\322\372\356O\220\213\306L\201\324\256\206\226\217]A\031&\374\230\247N\256\302p\206\306ew\237\342(\223\243\260\236t\230\330\233\023{\363\315\336\244}\230\237\330\336\241<\300niE\214\335n\201\023`\207\3560\333\276\351/[\372T),\240lY\365\351Q\177/+,Q\315S\226\360\026$\330n\210\201\317\002\203\346\223\250\240O\035\001g\203\007\314'[\372\243\006\351\203\032%\246vPa\305\340\be\017\273\003\245\206\260\377VKvLc1}\301t\204i\b\003Z'-\302\321:Y\211g\344B\307\023!\233\320\201@\222\211xJ2\016\001k\024F<\231\005M\363d\233\356\363\267Z\262\256L/\364\002\361`*\221\234cJ\262\215\351O\277\212h\306\352\243\240\027\365\322\207\334\252\b5\352\205J\251\331n\231\370\024\006\035"
+	.ascii	";\013\255\273q\f#\f\217\255\320C\323\254\302/Ms\232\032s\314"
+	.ascii	".\306\262\004\272\216\356\365bI\312Z\311\205<,\326\240\023\246"
+	.ascii	"\205`\276\305\022\2351\021\007X9\342\3254\312\030\t*s\320n$%"
+	.ascii	" \315\361h.\005\005"
+	.text
+	.section	.gnu.lto_IO_GPIO_PortSource.8.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`4\0015\016"
+	.string	"\306\332^C\020\221\223\016$\375\301\017::d\242/\346\220\366\353\313W\351\030\275\253\364R\353\037\252a8$k\357\376Z\266\342\030\346|\004\243*\216\370\005"
+	.string	"\200\"\360\214\002\202\016\262\013Q\016\2212\206\b\331{K\231RK"
+	.string	"I"
+	.string	"L"
+	.ascii	"\266\352u$\270\207\260!B\345\330\335\354\300\t\304\303\367\001"
+	.ascii	"\361PG|\373\323\334\374\323\037\213\n\315\210\323\360w\034)\254"
+	.ascii	"\021\327\341\372\034\300p+\0018\320"
+	.string	"C0\363\342\250'\211\013e^\017v\3279\3428\334\360\266!\330^`\177%\351\367\322\372\356\317\217+F\306\300\215\335\r-\036\273\2022N\370/O\225\234\205\241\314\314W\034Er\025\326\023\r\313\356\222\330\233\022{\363\315\336\244}\227\247\330\336\231\\\300n\tE\214\335\216\201\025`\207\3560\333\276\351-[\372T'*\240lY\365\351Q\177-),Q\315S\236p\027\"\330n\250\201\337\"\203\346\227\260\240O=\001\027\243\303\345\223-\3551\203\004Bm\022S=\240\260^j\204r\207\335\201RE\330\177\253%;\246\261\230\276`:\3024\204\001Z'\r\302\321:\331\210'\004C\307#!\243\320\211 \222\201xF2N\001k\025B<\331\005M\363d\233\356\363\267Z\262\256L0\364\372\370`2\221\234cJ\262\215\351O?\212\210\306\352\243\240\027\365\322\003\270U\021j\324\013uR\263\3350\361)\f\034"
+	.ascii	";\013\255\273q\f#\f\217\255\320C\323\254\302/Ms\232\032s\314"
+	.ascii	".\306\262\004\272\216\356\365bI\312Z\311\205<,\326\240\023\246"
+	.ascii	"\205`\rOBt\216_9\342\3254\312\030\t*s\320n$% \315\361h.\005\005"
+	.text
+	.section	.gnu.lto_IO_GPIOPinIdx.9.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\325\f"
+	.string	"6\231XA\020s\223\016\300\300BS\214\205\216\036\2613\376\taS\346\214\345,\226\035\216\030\034\252\371;\266\356\206\320]\036a\001\247d\0240\t"
+	.string	""
+	.string	"\020A\030\"Jy\266]\321\324@\356\246\201\b\331{K\231RG"
+	.string	"B"
+	.string	"G"
+	.ascii	"O\241\331.\217\023\261\375\303K\312\n\036\273k\205\274@<|'\020"
+	.ascii	"\0175\304\265?"
+	.string	"M\315G\371k\260\322\201\266\r\327\347@\306fB\300\346y\007r\2708\351\031\332>\231\223\310\356:A\233\206\033\336\366\003\333\n\354s\002\236`:\236\373\337K\353K\247\246O\001\310`#CcW\245\373\2615 \f\022~\313K'W\341IGW\235\330\3255\273\262\375\264\317\362\221v\216\363\001\273\242\023/v\271\005N@\035\232\243l\373(\002\022\342A\251!\037Eq\324\353I\317\025\037)1/\271\344-0j\367\303\300gaR\301\037q\350o\342a\324\227\216`\273\321\203\245\223\235\302\304\byPs\342S\016*;Zp|\362\305\346<\251 \354\277U\221\3752\330\225\036\321`\227\265\311HL\256,\2025\341\202Pb\215d\033Kc\300\030\005\222\314\262\200a\231Uq\235\253\310\027F1:\351I\007\3510\232\221\232\253\206l\253Z\244\243\236\227\232\271]\342\244\207\301P\302\223\235\003\344\325\276\002\024"
+	.ascii	")\023p\234\216\237\330\336\277\241K\232Z\032\b<\032B\213 ~\023"
+	.ascii	"\222kx\327&JS\361\202\306j!\230\327x\025\231 \340D$\325`T:\256"
+	.ascii	"\264\n\n"
+	.text
+	.section	.gnu.lto_IO_EXTI_PinSource.10.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`$\001\375\r"
+	.string	"f\332]C\020\223\222\016"
+	.string	"\270\320\024\322\346\216.EH\357\006i\037\261\215\2630Fb\346\247\013\034<\347\276\346\321[\333\307-|8\002\233]\361X\022"
+	.string	""
+	.string	"\024\340\016\024\005x\356;\037\340\226\214\362\260\221M\266\224)\005J"
+	.string	"I"
+	.string	"K"
+	.string	"\266\201\235\013\367\322\266\342\375\330]K\344\006\342)\370\002\361\224\242\270v\250\251\371\2279|q\321\261q*\207\020Z\276\215\023q\205\021jp,\006p!\230\200G\214{\317\021'\312\254$\354\256s\343B\334\324mO\260\335\300~)\020\246\365\335\237\235"
+	.string	"%p0\270\261\313\362\r\331\033j\206\n\237\346'\224\327\270\352\361\335\305\275\223\317Xgj^v\367\304\366\240\330\236k\266'\355\307\334\244\275K9\201]\022\214\214\335\316\201\027tN\271\353\330\366[\034Fs\352{\026\256\370\215R\021\221\252X\025\266\bY\311\371\311\027\016\243\244\263+z\340\277\350\200\371)4\350OW\300\345"
+	.string	"\022\003\312Oqh\214N\250Sb\352\b\026\0374;D\031\304\356B\251%\373p\225d\307t\025\3231\246)*\035\330\225\036\371`\227e\222\221p\270\262\n\026\206\213B\2115\222\231X\237\003\3062\220d\326\006\f\313,O\007:\\%\331\203)G\243\336;"
+	.string	"\023&\033\371y\245#\333\225^\346\007\261\221\270\001i\bR\212\340\266\211Q\217\363aE(?\013H\030\033"
+	.ascii	"0\013\355\325\rO\261\275\207\243=(\b\3214\030cq)V$pu\324\256"
+	.ascii	"\026FH\226M\256\341\215\330(N\304\023\"v\017\021Z\002\3219~\345"
+	.ascii	"\210W\323'c$\250\314A\273\221\224@\232\227\256\264\n\n"
+	.text
+	.section	.gnu.lto_IO_GPIO_PinSource.11.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`$\001\355\r"
+	.string	"&Z]C"
+	.string	"\223\223\016"
+	.string	"8\002%)5\275\310\316\"\303-j \344\020\343\017\325\374\310\n\344\247Kb\027\271\017\272\355#\021\034\343\243\316\251p#\240\252\252W}\243\202`\314\3331H\243\377\232+h\311&[\312\224\002J"
+	.string	"H"
+	.string	"K"
+	.ascii	"4\260+\301\2754Z\361"
+	.string	"z\354\256\025r\003\361\024|\201xJI\\;\324\324\374\303\034\2560\021c\343T\016\035\260|\033\007\342\n\037\324\340Z\006p \230@\307\314\275\247\210\013eV\020v\327\271q\037n\352\266#\330\026\261_\ni\b\323\372\356ON\200\226\033\"\247\335\321\027dk\250\031(|\231\237P\356\302\325\216\357-\356\235<\306\0323sbwP\354\3165\273\223\366_n\322\336\245\234\300.\311E\306n\307\300\0138\247\334ql\373,\356\242\331\001\036\205+~\2434$\244*V\205,@Vn~r\205\303(\341\354\206\032\370/6`\376\t\f\372\323\025p8|\274|\362S\033\032\242\021\352\224\230z\357\031b\304C&G(\177\330\035(\265d\037\256\222\354\230\256b:\3064E\005\330\225\036\361`\227e\222\221h\270\262\t\226\205KB\2115\222\231X\236\003\306.\220dV\006\f\313\254N\3679\\%\231\203\351F#"
+	.string	"\021&\033\351y\245\"\333\225\036\346\367\260\251\250\371(\bR\212\340\246\211Qo\323!\005(?\013H\250~\033"
+	.ascii	"0\013\275\272\301-Y\030\024[q8\332\203\202\020M\2031\026\227"
+	.ascii	"bE\002WG\355\322\202e\256\341\215\330(N\304\023B\330<\t\321\031"
+	.ascii	"\023q\200\225#^M\237\214\221\2402\007\355FR\002i^\272\322*("
+	.text
+	.section	.gnu.lto_IO_EXTI_Line.12.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375 \373\245\006"
+	.string	"\002M.3Pm\222\016d\222\013h\316\200\210\261G\265I6\273\360\"\301\r\304\313\003m\013\240\006\226\340]\262\327sf\232\033S\364M\026\215\350\264u\376o\255\021\"S\217bg0\217r\033\250\211\240 \203s\240\026\032\\\006n\034\206\340\367\240\201\016\342=\350,\221\242\326\304\032\347#\2075\215o\224\255\363\215m\233\302H\210\344R\222yqb\222\"R\b\307\337\277z\313\317\330\327\243\037U\243D\0032;\037\220\314\210\360A\245\322\261\362\337\216~\252\255(n\\\023(\243\002\024\312\214\316\240\003S\245\250\002S\245\346\251Uf]\200k\242\214\222\220\2313\213\013\243\267\376\005\377\345\367\004\t"
+	.ascii	"2\003\202a\243\302r\025\216k\330\220\2308\340\204\221j\345\n"
+	.ascii	"%\017"
+	.text
+	.section	.gnu.lto_IORead.13.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`j\001=\017"
+	.string	"\246]hF\360\260(\035:\206\201=\020Q\307\211\354\340rr\033;\364\307yw(\235\235\265\256\203\033\313\034\276\002G\353\257\225\342D\013\204v\350\317^\275\300\006\236!\341\002\031w}t\265\030\033S\350\fn\261\344\223M\244L)U"
+	.string	"N"
+	.string	"V"
+	.string	"\353\202\265\330\r\023\030\201\367\350\360\003\272G\357\002\272G\333V\300\300\344\323C\030\227\277j+\232\216\335\360\323\017?\235\323<\371\026\316U"
+	.string	"acam\270r\013J\\X\001\200\225\342@\265\034$>\363la\2512=$\273\353dai\270\343m7\260\035b\277Fku\371\343I{]\332s\331\037\235\346bZc:c\372\037\004vZ\035^)4'\\\227\033\217\215\021]\204\260}\277\346\264\224\207>"
+	.string	"\223\342\323|\246\362\320\006^pZ1\273\013R\261A\217i\233l\220\355L\3731\2271]\266r\220\rgQ\342\351iOX\206\230C\277\021\215\370*N\"x\273\373\330\243_\352\036\257&^p>\363\3505\t\336\256j\304G\201b\342\307\300\356\321\243\237=a\030n\264dd\250\274\251\007\0215:\352\225.\352g\016B3B\206\215\031:\252\334a\207\251\324\227}nw\003\340(\035\022\001G_\211$\2420\"A\370&\214JL\276\020\251\364\211\0240x\"\"}( H\372@!\352\334\252\313\001h0V6\3758\240qccK\377\324q\332b\233S\223\2404\305\351K\324\251~\364\253\027\251WU\305\261\342\220\312\233=\315\020\324\316\211\034\233\0364?\b\032"
+	.string	""
+	.ascii	"\033Zd\201\316-4\263\355\030\232>c\356\002\313\200P\256\350\247"
+	.ascii	"\013\244\265\242\255\2550<M\226e,\200\206HW4\303b\\\2506`\f\002"
+	.ascii	"e\013\320\035\3524\241\3547\257\354\221\252\034\232K\355\001"
+	.text
+	.section	.gnu.lto_IOWrite.14.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`\304\001\305\020"
+	.string	"6\340pF\340\322&\035\223\240AB`\344fT\372<=$\340\202GRu\262\303\022\225S\036\2528D:I\306\375\252\310\332\025*\211\333\272\b\357\023\036a\2141\306'\250\2678\336\365`\3408\006iQ\300>\261\233l)S\n\\"
+	.string	"X"
+	.string	"_"
+	.string	";'\212v\277\0056\331\256\371;\201xm\273\200x\315,\333\307?\236=\221\215\rDK\273\333\251\211\263\0365\250\311\3623<\246\\!\256\2018\034q\331\300\003\273\313\2714\244\302\006,8\310\030q\265 \367B\210\212\007=s\\7\231(\225\335u\342\270tn\324m\257\330V`\347I\251\177\277\b*\275=\366GM\303\230VM\247\246\017\240\300\322k\004\354\206\"}\373\341\251iqh4P\330\276\357\342\263\230\013\331"
+	.string	"\217\030\233\033\272L\346B\326D\374x\375\\\263el\356Zr\2665m\006\016X\377fJ\256t\364s\224\340i\377\347@\254\307hN\262\033zM\205;n\232Z\371\0045\205\345\215\216H\254\200\2723\023E4\235\206z\244\364&:N-\244\231\323g\226\360\030\336\266k\223\342\303XQ\360}\\\342\265\224~\366\354\361\340\363\002\212\325\344\223\226H!KR\323\304\250\017:IP\213\034J:\222l\222\311\376Z\2510\373pw\327\272co\351\336\204Tyi\026\024\225\327\301\254Z0x\253\b\335\213\267\342\322\261\254`:\224\022\253*\264\254\272\013*\325\252\343\276\232\303U\251\321VT\230\023\006\270kD\216IO\0165\307V\265\037\334\b\302\266\273)~\321\313\312"
+	.ascii	"\236\335\265\020\257\345\020\034 \251\212@Hf\226\317h\331\364"
+	.ascii	"\262gO\207 /\240\030\f\" `\002!\202\326\003r\250\361\020h\204"
+	.ascii	"\020~d\227U\233X\017Gho\260\246\351\247U\355\213\03088\271\271"
+	.ascii	"\r*3^\215m\315\202\r\021+\236\\\354\030h\200\026\016\224\215"
+	.ascii	"\307\020\212\323\022\336\344c\373\006\320U\300\b\322\351\002"
+	.ascii	"\333\273\255\256\327\206="
+	.text
+	.section	.gnu.lto_IOHi.15.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`\025\001\035\r"
+	.string	"v\230WC\020\221\232\016?,\254\202\032z\242\030tI>\226\210U\203m\300m\n&~`2P\032\023\317\257!\233-\375q\235\2378}\003\f\313B\004"
+	.string	""
+	.string	"rL\027\002\202\003\211\2004\226\352..bw7)S\nC"
+	.string	"B"
+	.string	"E"
+	.string	"\335\005\304C\352"
+	.string	"\342\2415\233\306\273\321^\006e\202wcw-\365p\355\223\246\346{p\022>a\270N\006H\240|\034n\233\252\031\033#\016\363\244\300\21127\"\273\353L\341.\334\360\266\021\330&`\177C\244_\247\364)\216K\214\003+v-\324\344X\030\260E\b?\346^\311;\347\214\022\373&^2y\347\215\312\347\262\273\325\241mbW\207Y\331~\332/\361\027\355\244\223wvWF,v\273\002\376\240\016\035OqE\275\367\316\013\027/y\301gH\250]Q\210\217\"\002\346\2678\210\207P_z~\250\320\302\341\205\024\312\032\355 \"\206F}\022U3h"
+	.string	"q\202F\2248\354nKe\261?\355\356ZW\354\230\2160\r\037\330\225\366\200`\227\005\312>\020\256,\201\305\340\032!\261<\031\310\002\031`\254\301'\263\036`XfU]\350\"!\335&eQ{\344*<\324\356\206\370_\366\t0\332]P<L\035)5\240^\017\363\017\225o\223!\263\303\263\202\032"
+	.ascii	"2\003\302\260\330\302\306,\020\240\355\3601\333\2700\\\315P\340"
+	.ascii	"*F5\367\264Y\214Y\001\b<\032B\212 \003+\244p\rTBh\240B\021\212"
+	.ascii	"\206\316 \203\212\326\254\256\210k\371)\361\246\024j\017"
+	.text
+	.section	.gnu.lto_IOLo.16.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`\025\001\025\r"
+	.string	"vXWB"
+	.string	"\2216\035;}\266w%}\034\3513/3\242\t\276\0322\\n\307\032G\240\301b\301\273\303\230\355\371\214\"\340\006\026\247u"
+	.string	"c\037TUU\2157\214.\"@\312\375\3379\346a\034'vw\2232\245D"
+	.string	"B"
+	.string	"D"
+	.string	"\336\007\304\303\352\001\342\2417;\306=\322\276\245\204\302gcw/\345\360\355\224\346\346\003\350&\234\322p\245\016\204\250\360\242\3518\312r\251\001\342+O\013\335(3\323\261\273\316\221.\303\ro;\201\355\002\366I\002\245_\251\364+\315\f\027\bN\273\030N8\266\005T\341\301g\371\007r\317\t\003\304>\211\233B\3569\303\301\210\330]\353\320\016\261\255\303\264l?\355\217\270\312\366\222\3107\273'\244\024\273\236\001s\252C\007?\201E\375\367\r\213\0257\231\301]>\252\335\221\3077!!\363S\036\304C\2507=;\\H)Q)\211\362\244&\037Xb\324\"Qu\003\211I\211\230Q\336\260=.\025\305>\265\273k=\261c:\3024|\031\226\376t2\354\ni\240\b\230\246\340j\200y|\\\037-tu\b8s"
+	.string	"\322.\bY\246]\226'z\207H9JQ\324\3668\212O\265\273\036\377E\003\t \355n(\036&\215\021\031P\257_9\207\203\341^\264\344\370\274 \032"
+	.ascii	"2\003\302\260\330\302\306,\020\240\355\3601\333\2700\\\315P\340"
+	.ascii	"*F5\367\264Y\214Y\001\b<\032B\212 \003+\244p\rTBh\240B\021\212"
+	.ascii	"\206\316 \203\212\326\254\256\210k\371)\361\246\024j\017"
+	.text
+	.section	.gnu.lto_IOToggle.17.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`\f\002E\022"
+	.string	"&\342xH\340\322&\035R\267W\037\032\232<\006\355\337\027m6-\214\332\244\375\203\343#\n\237\303$.j:5\3253\257\">\207\023\303\210(:A\005\2352\306\030c\fCm\216G|\343\002!\006\310m\314\030\237\020\262\211\334)\005b"
+	.string	"^"
+	.string	"g"
+	.string	"\251\307f>\262\273\343b\261;6\260\002\357\323\343\tp\237\336\005p\237N\3315>\266\366\264\227*h\307\356\202\332\363\324\271\271\251L\3714\347BV!>A|\023Ya\330Hv\367[\331H\335\034\244\310@$\262\022\267\257\246\343\304g\2278\253\033)\273\223\335\265\324\260\372pw\267\215b\273\304\226-\001\322! \234\264wY\354\237\227\335:\245\345\224>"
+	.ascii	"\004/\226\210\036\230*\215\333\241\311\307\302\230G%.\373\355"
+	.ascii	"\373*^\2039\220\017\350\264X/\030\373A\027\262?\307\034\310\005"
+	.ascii	"d|\3321\366\367)?\363g\217\377I]&\343\321x\360h\264\241\033\273"
+	.ascii	"#\203O/\360>I\266K\373\257\303\002\262\351G2&\276\021\205\024"
+	.ascii	"ow[\270\317K\227N\213\005\213\325\254\362\242\t!\372\332\245"
+	.ascii	"\317\006\034,X\314\323.AR\fQ\211\366\343B>\235h\305\333\2651"
+	.ascii	"\361W\274\260\370\256P/t\351\303\301\305\202\305jd\223\2220\001"
+	.ascii	"\264\244\312\343\031n\352g\037\371\261\361\303\224\264d#{\330"
+	.ascii	"\243(\225\307\376\266\273k\335\261\273+.(,[x\222N)\tO\240\013"
+	.ascii	"J\345\302\t%\001\254pBa\001SP.`\211\001\207\026TP\340K\030\242"
+	.ascii	"\300o\254\371\266\272\343\223\032\0259\345qGCE\333@\264\243\r"
+	.ascii	"\251\212\264SU\034[\325\206\360\026\003Z\223)\007\217\234\031"
+	.ascii	"\340F\342:\005\321\007\261\0277>\304\033\271\030\201b\223\341"
+	.ascii	"\244F\230\315\350\364*U\221T9b( P\002Q\346\3566b\350[b\374s\311"
+	.ascii	"L\332N\336\340\230\231v\2548\267\232a\360\265!Q\374\025\211Q"
+	.ascii	"\003:5\372a\274\312\356N\265\r\312f\274\215kf\327\311L\241\333"
+	.ascii	"\2113f\274a\2340p\264\200\343p@\322\200\207\n>\374y\224\033c"
+	.ascii	"xE^\247\002xI\221.\270\275Ku\275v\356\001"
+	.text
+	.section	.gnu.lto_IOInit.18.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"-\f"
+	.string	"\306UQF\020\255(\035(\332\316q\244\020g"
+	.string	"\231\t\351\207Rn\261\346k\2271]>\327\327\371\312"
+	.string	"\251|\273\365g\330V\036\202\242\022\215\016y\034{\001"
+	.string	""
+	.string	"\030\371\201\020\325U\276\340D\001q\330\311\305#$\222\275\367N)="
+	.string	";"
+	.string	">"
+	.string	"\325\240m\342\242j\277\001&\240\225bw\267\371\340\340\351\224\240\217\021\0068E}R\223\n\003<h\204&\252q\241\240\360\326e\201\360$\245Egw-\t\204\007\356z\333)\2669\366W\002!$\330\276\3066\225v\t\007\374(\362\334UP\202D\212\317"
+	.string	"\2365\362\305.\203\017\"\332+\b\275\264\177\341\030\300\257H\337\330MA"
+	.string	"\261+\2168D{\265x\217\354U{G\366\031\252\335}\004\230\354\265\246F\013\tJ26\033L\030_\323\244LN\004\013Nhx\235$\314\026Mr:\260Oww=S\366\307?;\353\247_\375R\343@\221@\021\261k \266bG\3243\334\007\324\325\217\003\311x\325\353\244=\033\257\333B\037\027\323}\237\r\324\251\260l\236/\264m>\354\265p\337\366\342y\337\246\021K\357\224\246\211f\323\366\336A\244\202N\333\345\256\221\266\273'>\007"
+	.string	"\241\031"
+	.ascii	"2\003\302\260\311\302\326\021\210`{\301\320\362Q3\200\334\232"
+	.ascii	"\336\370\031\243\240\341\321\025P,IX+\215\013C}\030\fsI\b\026"
+	.ascii	"\204\317\324(\270,M\215\026w\371\251\366\246hj\017"
+	.text
+	.section	.gnu.lto_IORelease.19.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\245\t"
+	.string	"\246\021B:0\221\322\001 p\346\321\210S*\332?\374Hb\334\237\204\321\370.\230B\205Er\256\337c\263)^c &\304\032\017\003\207H\347(\274z\210\034j\024\314&\236l\262wJ\0010"
+	.string	"1"
+	.string	"1"
+	.string	"\273[\247\311\301kS\202~@\270qm\344Sc`u\300\006B\224\366y\311V\016s\371\021\246\244\004\b\355\256\245G(r\323\333v\260\255`[\0269\273!\263\236\265\2415)\037\333\227\366]\376\002\276e:\301\256\210B\263;.8\201;\365\370\203\355\224\273\301vj\320\306\371\270\332\277@8fv\002\253\335\375\311\251\257\261\235R\021\306\242s\222\263Y\242\"\023\2336mr\222\210-\256XJ\362\330#JN\225}mw\327S\264\337\372%-`\335<\004^'-\002y]%}\243\213\356\213\250\023\035\204D\025}\244\nB\260G1\372j\205\347}\3653\236\036:M\2246U\245\315\266\270\253\304\355n\203\037\223\201!\020\020"
+	.ascii	"2\003\3020\301\302N\021\210\030;\002\204V\200\300\243!\214\b"
+	.ascii	"\2623!\025\314\273\004\320\254\246\210\273\374T{S4\265\007"
+	.text
+	.section	.gnu.lto_IOGetOwner.20.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\005\013"
+	.string	"f\024LC \215(\035\224\323\201\231\032\037Ll\240\342POy\327\221)\006\353\005\352!\310j\025MX\r\230\333\301\266\236\366\007\323ig\320\264+\214\ny\247\320\224<\264kBj\254\016\350\343j%\210\354-wJ\0019"
+	.string	"8"
+	.string	":"
+	.string	"\226s\\\227\361\033\327\245Fx\367\250\260\363\017<\226t\030\021\362F\327\030\202!\201\007\f\357\023+*\326\205\237\016E\036\b\302\n\314\356\032\206<\006\267\274\355\021\333\037\366-\001$\254\335\005\255\024KB\202\250`\373\266;v\3056\204\366M\337\320\371\344<c\367S}\330\235 \366\300.=1\333~\206k\350\270\213S\202w1\301\001\202\224\211\335\231\005\233\247\004`\273 \021\037e\200"
+	.string	"\266\273\247p\351\027P9\nq\302\344\201-\205`\001\265Rs.\250\r\276\026\207\025\b\242\260\347\007j\311~\\\375\034?\177h\350K\r\021%\002\233\006\235\271lZ\266\3414\0034\356$K\321LP\262\f\267\311.\035\336"
+	.string	"h\270,\300\266qYez\036W?\277D2i\324\237n\361\200\244"
+	.string	"\372\335u\025\2511\036\375D-9\021"
+	.ascii	"A\204n\211\030U\004\370\205\315i\265\3413&A\303\243+\234X25+"
+	.ascii	"\271\220\003\215\341\321\224\035\320\004 %\240T5\320\\\n\n"
+	.text
+	.section	.gnu.lto_IOIsFreeOrPreinit.21.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`\356"
+	.string	"\265\f"
+	.string	"\026\031YC\020\221\223\016\030\236Nv\031 V\023CT\366\bc\336\246\353Z\363#dc\035 \374\213U\203a!\232\306z\177\253\214\312\207{\020\201\004"
+	.string	"\200\201\260\202\366H\t\236\346\253\341\220\322\200 d\357-eJ\001H"
+	.string	"C"
+	.string	"G"
+	.string	"\324\005\304C\333N\260\200\343\3169\225\224\177\b\261\265\314\354r\226zx\347O\263\343W\370\203!\030\226\230\026\240\320\365)(a\301\005"
+	.string	"\220\366*\026:H\274\364D\001}2\247\217\335ub"
+	.string	"e\270\341m;\260}\300>I\351x\322\017\235\326\364\251o\2601s\003\244\333M\351z,\r\370\"\302\366\375\024/\231\234\363\024C\206\211\335\255L\354\352\034\273\262\235i\177\345'8'\235<\300\256h\005\306.\207\300\006\250Cs\037\020\017\003\223^\217\342\005p\314\320b\\^\264\354\236\216J\306\276\202\204\332\3750\360[J6>\210C\177B<\214\nC0;H\236\354\264\303\b\0252\352\223\b\225\203\250c\221\371$\017\233\323RG\366\337\356\256Ud\277\364\364\002\330\225\016\321`\227\265\311D(\\\031\004+\302\365`\304\n\3116\226\206\2001\t\"\231U\202a\231Uq\236\253\310\037i i\324\227\016rAe{\221w\371\244(\266U\375\341Q\315\251WU\255\261\205\032\244\276\034\333Gb\022"
+	.ascii	"*\013\370e\230\002B\314\274Z\316`\035\336Q\256\354\201\256\243"
+	.ascii	"{\271XB7+\305\005\237\271vAm\362\272*Y\314:T\251S\324\252="
+	.text
+	.section	.gnu.lto_IOInitGlobal.25.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"E\n"
+	.string	"\006\023E<@\305(\035\240\256zs7C\261\311\262\300\032\t\027\215j\2049$\272\203 \240\r"
+	.string	"\346j\304\377\306}i\263\030\240m\235\3221\314\232%\270\241Z\2343\177\344r\022id\357\275S\n2"
+	.string	"4"
+	.string	"2"
+	.string	"\236\177\351\250~\260B\362\201\243\323\231\331]\0010bf\242\t,\305\311z\3746N\227\017\237\360\212}\340\351\361\322\331]\307\017\254\270\263\333\336lo\354\317\230S\377\343 \336W\032mD\241\265X.`\273\341\346\324\b\332i\346\004\331\351\374@vz\214=\273\345a\306\276\304Bb$\300\356V\211\341yJ\357t\312\030&Mv\371\360\261\305\021\023yAD\001sww^\312\224\035\226b\334\335\221%\312\376\352>5\200\241l)\273\023\261\001\353\242&\032_\335>\353\036~\350\242\216\003M{8\334VC\335\347a\353\030\252\303\266\320P=]\250r\n\314\201>]\025q\\W1!\351\022\245\272v\002\300E\222%S\231\262\202\212\3745\031\355\210\017\371e\024"
+	.ascii	"2\003\3769\006\324\201\030Q\230>\314\002W2\355\205Y\f\314\225"
+	.ascii	"\313=\335H\020\372\004\267\312\213\020@np\253\354\264\354\347"
+	.ascii	"(1\207w\256\371\004"
+	.text
+	.section	.gnu.lto_IOGetByTag.26.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375 \357\215\006"
+	.string	"\242\f.4Pm\222\016d\254\210\206\330\200"
+	.string	"\242#\023\004\222\267\321\303\006\370\334\"\007\273\033@\265X\252\343\236\354\237\231\231\346N\027iE\314\272!5\236\035mc\023\231\002\r\233\017\316\321XU\363\270\216D\345\030\032D\265yh\034\347i\232\314VD\307\265\217e\271\206y\331\213bH\361/\304p\343\013\220\250\361%\265\305\242|\224V\034R2/ZXRe:\361\370A\217\371\221}\202\002\250\244\21113\003\304$\363!lp\351\364_\221\216\200\2762\257c\324\222\220\n\222R\346k\277\022P\235.\035\240:!G\257\262\353\n\210Be\001\013\2319\263\020\215:\366/\370\017~\214\b"
+	.ascii	"2\003\202a\243\302v\025\216k\270\005\013\207\334\020\346^%\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`C\001\265\005"
+	.string	"\322G\036)\200k\206\003&2K\200l0\216\3304(G\362`\006f"
+	.string	"r\205\304\266ms\035\326MB\"\201\304\266m\326M\2046\3312\275,\031\303(E!\216G\253d\333\366\033e\366b\333\030\202\230\215\272\334IsN\3202W9\243\214MVHNDF@><6|\027\034\023\032\017\030\013\274\003\335"
+	.string	"\356k\333Z\\iS\331\323f~\332[P'Ns\316\211-\245\266\222&\032"
+	.ascii	"\240\b\256]K0D \032\213\273j|\321\003 \034|\003|\003|\003|\003"
+	.ascii	"|\003|\003|\003|\003|\003|\003|\003|\003|\003|\003|\003|\003"
+	.ascii	"|\003\374h\3339\006"
+	.text
+	.section	.gnu.lto_.refs.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.88c68c7ddd0e7878,"e",@progbits
+	.string	"(\265/\375`\337\023\235Y"
+	.ascii	"Z\223| Q0RJ\032\016\356\272\272j\253\272\332\366\272\253\332"
+	.ascii	"\356\272\277\273\343\333\272E\211\333\205\213\377\021\362\341"
+	.ascii	"-\344b\017\230\226E\272\356\350\031\310v\337U\246\b\306M\307"
+	.ascii	"\274\017\313\005\364\251\"\210\206\231W\267D\266\004aH\"uY\376"
+	.ascii	"\377c[b\233H\231\002\237\001\367\001\016\002oM#D8\375\013[\345"
+	.ascii	"\351\030\224\247\267\344\241e\215\323\257\240\376\313C\233\272"
+	.ascii	"\2543\022\204\323\177\333\376]\262`;\245\327\214\202\366Y\367"
+	.ascii	"\n\324\243\346\rV\030\247\313\026dd\023\206\205\323\227\240~"
+	.ascii	"\2338\201\203\262QV\312\252mt\327\376E\333\264\247k\267Zw\177"
+	.ascii	"\301\326\271\r{\262f=\314\237f\002\001\343\325\275\376\201\237"
+	.ascii	"\350\273\266gk&\002Gw\326\225\016XT\227;\273\356\365D\320\211"
+	.ascii	"\023'T\2672\265gNz\t\324\355\r\361\373)RO\244\256\330\216mTh"
+	.ascii	"\313\276L\266\311q\230kG\273W\037\034/h~\234qz!\365?\331}\270"
+	.ascii	"t\321\201\352W\350\347\263B\277\263JbC\374\322\270\r\361\373"
+	.ascii	"\272!~\352\002\360K\177\226\341\373\363\223\n\324\0057\334\374"
+	.ascii	"\3673\f\377\351\376\2179\316\317.\254\225\035\377\253\025\231"
+	.ascii	"\220\300\177~^\372\017\005\351 ~\036>\231\002\364s\007\032\224"
+	.ascii	"\300\340=?[\360\257\b!$`\342<?S B\202\353\374\\\204\364\037\204"
+	.ascii	"\347\374L\364_"
+	.string	"\314\267(\360\377\007\340\317\007\364~&\340_\020\376\205\361\357\213\177\215\376\305\340\337\013\376\255\340_\n\376\215\340\337\242\177\037\370w\350\337\023\377&\360o\211\177I\374k\300\277\"\376-\340\337\240\177\003\370\367\347\337\235\377j\376\227\375g\373o\346\337\336\3770\377\255\374\273\377\363\376\273\371\337\346?\233\377v\377\327\374O\363\177\312\377\272\377h\376\237\371\337\366\177\201\377Y\376\013\220\227\227\227\367\247I~\016\376<Q\002(4W\250\263\271B\225?\315\204*\273\327\347O\363l\251\334f4\353\331\214B\237@\315leG\2274\250L\350\263\371\006}\3764\243\313g\223\231\365\004\232\201+\310\035\2166ca\333C\223\331SRWK\347O\\s\205\366\\\367\236\331hg\211\356+\250sn\331c\2458\305M9\251-\241\004H9iA\233\031\327D\002\355F\342$\243\245 P\256q-d\343\224[W\035e\243\273"
+	.ascii	"\251n\345v\\w+\273\033\350\274Z\273}\3744\275\244\244\272\253"
+	.ascii	"\202\244\372J\311f\243\233\317\302Hy6\243ZP\"6\263\250W\337X"
+	.ascii	"\225\353\325sYN5\252\024\353\250\356^4\252\327S\307\031f\247"
+	.ascii	"\224\207\026 D\274\250+\317\232\033M\3428\345\346\315c\345\271"
+	.ascii	"\367\315\016\223;\355^\356\036\320\263{\200\217J\327\222\354"
+	.ascii	"\227~\343\324o\364d\326\315\351\322\033\336x\204eYW\035)Xh;\326"
+	.ascii	"\375\022\365\246\305f\204\317\312Cj\313n\315\016\\\224\332\031"
+	.ascii	"\247f\202|T\324\206\234\251\251\342#s\373Z\246\021\342a\343\305"
+	.ascii	")I\235\tf\333\02304g\200_5\004\201rjfe\356@Q\032\371\321\246"
+	.ascii	"\322m\334\312\211pj\032UA+\363;P\264t\373e\305l\\\325\004_j?"
+	.ascii	",\231\035\263e6\272t\353\303\267\313zy\320\332\315\354n\272\245"
+	.ascii	"\262W6\356\254\205\333\2232\335\353\322m\226\205\353Y\256\355"
+	.ascii	"\234 \r\312\315G\006+\035\310r\322\235[0\033\035\261a\356@\321"
+	.ascii	"{\312\261\006\343y\243\344\315]\227\372\035\361\333\274\035\361"
+	.ascii	"\373\006Q7hg\220\343\322[s\363\003j\331t\330D\275\2608\215n\017"
+	.ascii	"\377\332\335;e\244F\026\037\352\276\255\226\215\232\330-_,\353"
+	.ascii	"v\337r\355\225o\300C#\343\364\373T\277&~\275\274\2745\361\373"
+	.ascii	"J\251?\033\342\307\013\300o\255\344\004i\234>}*+\023B\304\311"
+	.ascii	"\244\207\037\354\304\304\230\fDC\323\204\374(\343\273\022s\366"
+	.ascii	"\034;\223\355\025\005\236@\231\220i\322\004LT\272e\r\217\210"
+	.ascii	"\234\022%\034\326\206\252.\311\016\027\033\226-\260s\030\216"
+	.ascii	"\033!K2Ny\311\342\345\310\365\200kN\371k\257\364\346z\210\271"
+	.ascii	"\021\343\323R3f\355m\207\035\300r\322\356\272`i\313!\007>\242"
+	.ascii	"~\301\362\351\352\232\001+\212\021#|d\253\272\367\245IU\227\344"
+	.ascii	"\247\245\265\304p8\037\321Y\323\342\252\2016d\b\027Q\313\264"
+	.ascii	"P\325\331\355\025\035\360\234\0209\0279\335\023l\211\204S\356"
+	.ascii	"\362\271\303Rd\b\367\316\023U\033\226\030\027\027\333`\324\013"
+	.ascii	"\004\215\252\316\016H\006\007(/B\3166p\347<\3119\221\352}mmq"
+	.ascii	"\r\334mV\366\243\f[\271M\261\002\344\\\203Y\257\315\212\027\037"
+	.ascii	"]YY9\200foPA\254\240\320.O;\246Y\027\003\247\357\341\300\302"
+	.ascii	"\342*#e\033\337\363M\fS\356\256\256\306\3508Q1\3531\347\303\007"
+	.ascii	"W\031\375\264\223\034\234\027\017\032\022\25006\036<\270\n\247"
+	.ascii	"\235\335U\024h\255\261\033\034^\221\036\347\252S\331/wo\334\306"
+	.ascii	"\250\250x\207\031\331Yo\252\310\226\326q\336\001\347c&\f\334"
+	.ascii	"r\311\324\024;A4\264\333\013\350D\356\253LWU\t\371\314\304\220"
+	.ascii	"\346)\307\331\271r:cl\317%G\324s\r\266q\203\243Te\267r\355\034"
+	.ascii	"?\262.\252:\273\256\272\022\352I\002\346\207"
+	.string	"\0247\317Q\f\265\323\r\326\335\"|ql\244|q\312ORD\332\200\231\001\246Q\322%\007\343X\037|n8\242pq\3724\213\207s\343)/\213\323\263\016\365\374\377z\351\354n*\337\332N\247\235\337\277_\337\256\320\317\263\275-\321\215\300\\\367\026W\235zdmiu\022\375$\335J\240^\333\331\214f)\233e\\\236@k\3230@G\267\272\271f=Shs\257\275\315\314z\006+\034\2212\222G#\220\204$\"S\232l2\036\225|-0)\r\215\305$S1\205\021\206C\236\246\337R\022\022\013,\230\222F82\271\330I\026\215E\"\022\006RH$\"3h\n\n\203@I\242\013a0\207\330\224Dd\302I\026\215A\246\245\245#\2220\250\036_\b\203i\321H\030L\211\311\"\322\003a\020\030#\211x$\f\376\210\306\342\213\035 c\021\210F\214\240\261\310\003\202\203a\020\351\003\f\206\302\240"
+	.ascii	"4b\004\223\310#\214\036c\021\306P\030\004^\tE\220\022\361h(\f"
+	.ascii	"\376\256TD\022"
+	.string	"\215\304%\365\020\244` \205\n\032\300\253X\321\300\212\006~W\261\202\210hE\n\"\365)\210z\311\341R\022\322\261\bd:\036Y\f}\311\2410\230&/\003\005\323\214\023\212\303\021\311\241\n \rb\fc\321\3274T\"\036\035\213\300cq\306R\232\034\246 2\026g\364\210C!Q\t\231\302\261\211\210\364A\022\215+\034}$\020[\020g\260\2004\024\006a\270\330\271\f\024/\220\202\034\f%\211K\310\244$\211\037g\020\221C\311\343\0219\244st\304\242w\324\"\330;j!\354%\207\016<\2204\026SPODt\001\211\0166p\241*\2418\026\207\232\220D\025\212\310\030C\306b\322\tCJ\310\246!\024\003\034\035q\300\"\375\332{\362\302;\363\346\226L\343\005\n\247<\345|e\n\273\245o\335N\r\254Ns\335\274\022\342qbg\207\207\345\354\226RA\243-\364d\246\306\211S\256r\266\362\343"
+	.ascii	"\277t\31126\2462\017g*V:\304 \tk\343z\333rf\007\365\251\020\365"
+	.ascii	"\347(Q\216\302Rr\234\031"
+	.ascii	"tM\225ig\325\002Fg\240s\234\236\245|\327\354@\007\370Yqar\204"
+	.ascii	"S\"\242\363\332\001\3709\253\326\366\331&wbV\262\322\322X\215"
+	.ascii	"\314\227W/+\314\0064~rV[\274\236\035\316!`\230\277/g\206l\365"
+	.ascii	"p\342\204\317\266\t\305\212\252\316\356W\343\215I\032\247|\306"
+	.ascii	"\005\t\221\201\236\250\341\250\"\214\"\021\021\021\021\221$I"
+	.ascii	"\322\001a\005\204 \007!\323:\022`%%Q4J\311\bM\320\244\254J=\206"
+	.ascii	"\003\206\020o4\343(Ip\013L1-ON\365\005w\366\271\272\264\336J"
+	.ascii	"\370\203\353\214$\200wa\002l\020'\355*\255gud\200\202\325\033"
+	.ascii	"v\354\362^H@ \207\335rD\227\364b\241\244\030\021H\266\375\305"
+	.ascii	"\212\307&\\1ui\304\206\261X$\343\343\004Ki\343\316\222-\021\351"
+	.ascii	"\253pY\203\351\377NS\311\b:>;\203TJ\026\244>TPe\252 \324\236"
+	.ascii	"\346\201x\316b6\253\302\223\027\t\r\255\360\270\237\223\277\364"
+	.ascii	"\304X\316M\245_\250S3hAHG\341\311j]d\241`T\206S\211\250b8\270"
+	.ascii	"\366j\303H\232/\340\273L\234\302\245\346\315\334\232E \004\231"
+	.ascii	"\341\027d\016\006\276\231\262\310\253\025\037\351\033m\223\202"
+	.ascii	"J\212+\372\203\247\363\265K\r\274C\303HV\302\312f\257H3\223\360"
+	.ascii	"\251n\033\266\256\225Y\bJk\030\024\354\200\2244\347\034\227\367"
+	.ascii	"\220\255\r9.#J~\261\242g/\361\372\307\340\003\246\211X\227\276"
+	.ascii	" \342?&\371\"\235\324\277J\255ts;\237\033\303h\303\370\333sA"
+	.ascii	"\022\017\357\355\272\225lT\224\3045@"
+	.string	"W\023\035\335\205\366A=\344\276\337&d:y\300w\320\214\203\221S\362\357?P(\353\247H\022\222\232\354\n\tJ4\327L\253I\252q\207\210d,5k\200\332(\277M\241\223LN\376W\200f \241\004$\2254\244\271\352i\264\374\263\317Lk\177\302-\346\224\232S\\\003\304r/\246\230\230\272O\214>\304\356\023\275Q6\263\325 \207.Oz \317\361\034XU:\310\342\037\211\343(\337\b\006>\304\030\357\317\220\220\276\376p\217\026\212Q\216\020%\222\323\221{\261\367\257#\221\300j\306\346f\004#\326\236t\3676\2320\210\370\215\t\305\231\032@(\0037Mc\334\360(\210\276\267<a\266T\nHV\376.R\002\f\223\031_\030\215\346r\235FA.G\247\336\336\333a\202|\t\2043\201]F\204\372\013\2741\221/\337\377\346\002'v~\336\213\030\224. \313^\302Qn\223\202\002\\=^#e"
+	.string	"\362w\034\356}1\377\3513,\202\347\b7\360L\2359t#\320\375\356\304,\335mqT\367\370Q\202\037w\277\r\357\235\315x\034\347\3059\373\203\241p\251O\216\217r^\370\001z\257^\022n\001\376\245m\001\206\231\332p\tG\333\335\353\246\231@\214B\305\022\006{5\236\321U\261\261\235\365\323?"
+	.ascii	"\375\204\373\241\273\237\177\360>+\t$\022\373\240qBr\f\366\263"
+	.ascii	"H\374\301@\354\325\372R\273\344\r\334\206\037\002\3704D3\270"
+	.ascii	"\\|\211lah\341+\314\033\215y|\331\373\215\036\260#\r\334\276"
+	.ascii	"o\260\177\260I\343\350\177\317\3155}v\315.\277C~\251\255\350"
+	.ascii	"\320\3740\360*"
+	.text
+	.section	.gnu.lto_.symtab.88c68c7ddd0e7878,"e",@progbits
+	.string	"IO_Rec"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"IO_GPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"IO_Pin"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"IO_GPIOPortIdx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"IO_EXTI_PortSourceGPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"IO_GPIO_PortSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"IO_GPIOPinIdx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"IO_EXTI_PinSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"IO_GPIO_PinSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"IO_EXTI_Line"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"IORead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"IOToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"IORelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"IOGetOwner"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"IOIsFreeOrPreinit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"ioRecs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.88c68c7ddd0e7878,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
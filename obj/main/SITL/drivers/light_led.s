@@ -0,0 +1,503 @@
+	.file	"light_led.c"
+	.section	.gnu.lto_.profile.5aced9f1f3c394c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5aced9f1f3c394c,"e",@progbits
+	.string	"(\265/\375 |\375\002"
+	.string	"\244\004p"
+	.string	"\t"
+	.string	"\366\254\342\276\002\b\002"
+	.string	"\002\001\001\251\245\204\311\n\f\002"
+	.string	"\002\002\002"
+	.string	"\002\002\003\002\004\352\263\360\321\b\003\240\342\234\212\n\004\275\375\215\235\005\005\237\326\324\323\t\004\002"
+	.string	"\002"
+	.string	"\006\212\302\222\270\005\007\b\240\342\234\212\n"
+	.string	"\007"
+	.ascii	"I\211i*|\241\356\332\225\226\273\376\216\247\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.5aced9f1f3c394c,"e",@progbits
+	.string	"(\265/\375 O\315\001"
+	.string	"D\002C"
+	.string	"\004"
+	.string	"\001\001\001\001\001\002\005\002"
+	.string	"\003\001\001"
+	.string	""
+	.string	"\004\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001\005\002"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.ascii	"4\205\230*5)\013`\007:l\331\360\262\034\f\332"
+	.text
+	.section	.gnu.lto_.inline.5aced9f1f3c394c,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"]\006"
+	.string	"rJ!)\200)I\007s)<\\\366`\346\2224e\n\252\253"
+	.string	"\200\213`Qk"
+	.string	"\273\213\313\2202$\362_h\355j\244\265\275\245L\001\237\236\231Z^\032\221^0pc\316\222\374\250d\003Q!\204(\250\t\264\371(\305\335\t\234\fPG\225wT9\250\t;=L\317\365\f0~z\372d\352\3556\330\224\303]\004\375\243*\036 $\0306A\235\224s\"t\201A!\2021\377{\235\3057\265>\235\272\273Co\323 \034"
+	.ascii	"G\233\001\207  \220\226\032\270n\213cR\234P\241\255\226@g\013"
+	.ascii	"6\210\341\2640\002wfh\201%$\205;\254\226\2351na\356\3439\256"
+	.ascii	"+\254\fa\275Tju\254O\231f\351\327eU\r\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5aced9f1f3c394c,"e",@progbits
+	.string	"(\265/\375 \274\005\003"
+	.string	"2\205\016\026\300%\035\377\277\013\370\375\177\377\365\377\277\006\255\031\327\366\336[&\031\344\023\320\263^\360-\243Kq\277t\036\366\303\372\\\365`4r\341\222W\"\234\310$\265\234\377\336<\211D\016"
+	.string	"0\013\300sI\341"
+	.ascii	"A\367\336\241\007XEN\370@i\200v\203\022\372y\001L\242!\223\274"
+	.ascii	"\r`\001"
+	.text
+	.section	.gnu.lto_.pureconst.5aced9f1f3c394c,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\232\004\001\231\004\004\230\004\005\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5aced9f1f3c394c,"e",@progbits
+	.string	"(\265/\375 ou\002"
+	.string	"D\003c"
+	.string	"\004"
+	.string	"\001\270\006"
+	.string	"\001\002\t"
+	.string	"\001"
+	.string	""
+	.string	"\001\b   "
+	.string	"\001\001\024"
+	.string	""
+	.string	""
+	.string	"\002\002\n\002\013"
+	.string	"\001\002\f"
+	.string	"\004\001\274\001\005\002\274\006\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"9\203p\001n\350\n8HQ\267\374\264\244r\030\3058\260e\003X"
+	.text
+	.section	.gnu.lto_.lto.5aced9f1f3c394c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statusLedConfig_Registry.11.5aced9f1f3c394c,"e",@progbits
+	.string	"(\265/\375 \232m\004"
+	.string	"\364\007a"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\202\200\200\374\342\203\237\210\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\304\007us\250\327\006uq"
+	.string	"\005\001\006'\001\004\371\003?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/drivers/light_led.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_statusLedConfig.14.5aced9f1f3c394c,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\315\n"
+	.string	"\226\223IB\020\3478\035 \264\307w\302&"
+	.string	"\317@x\306\355m\017\373\315W\3453\354V;\021"
+	.string	"y\312\345\221\177\304\336\323\302:\274\202\335\345\265\036\031"
+	.string	"\240\0210SBP}\003\261\f\2104`c\372\330D\310N)4"
+	.string	"6"
+	.string	"6"
+	.string	"!\213<\367\234~\341\273\347\271\302w\317\247}\200a\344\200\200\253\306\266\273 \227\362\363\365\364\037s\203\027\214\365\332\241\330]\327\027\314\344\346n\373\301\366\204\375S\367:\032z\"K\320\2527;eU\016\305~\267\273k\016\265?\373k\207#q\325@\265\335\222\333\202-\340\tX\371\330~\265/;\314\371\331\352\t\273\250\201"
+	.string	"\273i\366\313\317\3468\200\322\3457\317\301\251\367\200\317v\232\333\016\275fc\321\362r\325g\033\3424UClw%l\217\317|xv7\342\236/\003\022\002\212\251\334\363W_&1#5V\224\302\213Re\216\314\022\301$Q)Da\230'\223\210\002K2\354\020\311\022\230\022G\032 \211,A\221\203\307\215\220\004\315q$\301O\272\357\226C\335\261\254\002\004-N$\023"
+	.ascii	"2\241\237/0<xd\027\304\241\273^q\002\306\355J\325j09\\\t\fq\225"
+	.ascii	"\032\374:\017\310\204f0\357\022@\263\232\022\356\360\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_ledInit.15.5aced9f1f3c394c,"e",@progbits
+	.string	"(\265/\375`\360\002\205\026"
+	.string	"\306\351\220H\300XM:$\210&\206Y\005\356\213\223\366\\Y\\\215\246\276y\203\377\020\005\"W\312'\344\362\240\261\326dg\016\301.Q\221\264\321q\262\324QU\b\274(LC\207\350Dh\267hCx\216\n,\276'\204\220\275\245L2|"
+	.string	"r"
+	.string	"|"
+	.ascii	"\261\327\204N\240;\351\007\220n\033\215\326|\237j\373K\367\371"
+	.ascii	"\275@\367\2511\325(\267-\365o\343\221\216+\335\035\262\013\345"
+	.ascii	"K\333\325\333\330?\257\233\2227\246\367nn<\201\212!\343L\374"
+	.ascii	"']\230\220\240\311\006\2134#ZO\006\212w'>\001\314N\\J\231)NV"
+	.ascii	"\004\314\212\344\313\b\030c\313L\266|\246\313\320\244\2143\024"
+	.ascii	"_\357\246\273"
+	.string	"u\307Y\211+xU]\241\252\020T\031\fs\237F*\372\341\270\327\327-s\240oR\005}/>\365B\f\312h\242Q\033\332(U\233\270\254\244\372ww+'\251\246^\373\003\374v\005\345\352\307\253\336\256v\273:\345\252\344U\336\325\335\325\277tB\226\300$\351\036\021\225\245\225\314\\\214\337\256z\233\236\t\307s\304~\323\247O$\361\341n\"\246t\367\314\247>\370>c\344[T\365\253\372\032\267\021\222U-\\\330\217\032c\304\242v\354\361\241\374=\335\344\216o\304\202h\243\024\344\311\237\221\002w\004%9\bN\252Iw\333\350\235\236\303\240\031rr\240\270,\263\252\316\316~\224\034#cQ\227\2315\320\242\216\240\024\352\210\211\032r\325-\273nNd\213\305\347>V\n\226\272e6\252<\357\301\372<\260\264|\246/\300\201\243\221\343\356\026\231\225X\277\343<z\364/\364\247\265\037[\335\003\254\363\2608"
+	.string	"\265\"\250V\023^A0\035\330k\200\356\324\250V>\033`\035xX>\341\313\265\002\301r\251B \226\316O\270\343z\2055\b\264\345a\345\na\255\226+l\261\3659\351\306\277\246'%CL\364\261\222zF\272\024\263\223\2359\310H4\007\371\265\313\356n\217\301ANq\b\232\224\355\302#\301I592\235|\\\251\262b\213':\246\201\235\371\307\252\022(\024\261\250Ep>\"\037\277G\221\034\314z<_\241\013< `\002\031:\254\007\342\200\377c\360\355q2\310.XM\251o\253\004\312\351\354\336\032\305:\327\034\267\364eM\345\353\203]\244\017\035q\325\306woi\220\240K\206\313\005\3041\261\326U\253\324\213\346\024\330\273\tc@p}\213\242u\373lq5\254Y\340\354\214\270\023\247#VJpl\267Hf\305\350\355g\235\345\r\001]\3305"
+	.ascii	"\025\341\335Y6\326\254\350\367^f\b\320\266AK\324\352!FI\007\331"
+	.ascii	"T\343\373Z\247}O"
+	.text
+	.section	.gnu.lto_ledToggle.16.5aced9f1f3c394c,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\225\b"
+	.string	"v\021>6P\217\032\003 [\374J\206\n\200\322\200w\361\001\324\"AeNF\2613\202\220\253\351\200\365\006SH>6\231\250\323\270M0\242\312\004kyNj\004m\271\245L),"
+	.string	"-"
+	.string	"-"
+	.string	"\022s@fY\257\205\361\n\344f\2454Pd\376\317\370a\317\320\253]b\355;\225\f\001\022\376\027~'\0167\272mA\333\203\266,\001\177#\252\265\312\216\020\3262ky\031\210\3717^3w\311V\310\246\255a\353\021\223xVU\245\332\337\221J\371o\320\216\306\222c\201\314\001\334\004\364WNF,\265\355\205Y\"\315\177\204\332\304'\024u\312\262\026$\350\317\262&e\226\216\013+\"-\023|\265\253\022\214\036\255\261?\237-\024\353\351|\266\020\303\350\301\001\024\232\242n\253"
+	.string	"u\237\031\001j\200\230\236N4;\004\345$\266n\2168\256\233\233\325\215=\242\252\340\3422E\214j\320\261\r\b"
+	.ascii	"3\241\303/F\361\031L\300\250KX\315j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_ledSet.17.5aced9f1f3c394c,"e",@progbits
+	.string	"(\265/\375`\250\001m\020"
+	.string	"f\341pE"
+	.string	"\261&\035\177\352\234X\330\272\345\273\027\"<=\f!1\017\376\t\356\241k\332&\324j\342`-5k\3007@b\024\035i\356h\fN\377_\332u2h\302\022\303l\212\246u\354\351\215\272\021ido)S\nY"
+	.string	"Y"
+	.string	"^"
+	.string	"\217~\332\267\271\t\324o\334\302\332.\207\020:\273\033b\221\354q\364\001\330#|"
+	.string	"\354\321([\306=\020\373\027\tV\316\317\356n\372\341\250G\250\211\362A%Z\313\225z\2149\f\271b\256"
+	.string	"\\.p\264\273\177=_\\\253LP\311\356:[\256\f7v\333\fl'\260S\024pw\327Jc\337\373E\307\271=~\363\207\236\326b:{\032\224i\354\351\3704|Za:\237\376\207h\306\006\r\035J\350\013oa\276\033\333\023wD\034\347\267\377\227;l\343P\030\245\274\205Q0\303c\363\263\353\201<\232\304#$\250{-\004\356\243c\303\263\353\205x$\0131SmG\225\037\214\230\202\364\230\206\260vV\371%\364\320\250\220\306swS\372\026L\244\021\203\317+\206K\3260\310\241z\350q\260X\250^\241\236%\263\312\317\251\252g\345P=\347'L~\215'\234\362\255\023\366\230j"
+	.string	"\206\214*?\207\364\300\257\025f\\\\\270\261\312\317\366R\251\036\354\007$n\245\343XTJ\231\212)I\034\212\332D\204\304\2414XypRB\331N\035\307R\352H\233J\311A\312f\322\2356\221\0026I\340\272m\305d\352\266\016o\017Wi\234\020\244\002F\254\320\250\232\276,\260\321\243\322\225?R\323Lm\023.\337\362\310\202\246 \\\305I\266\273\b|\024OQ\362k\036\035!%\005{\034"
+	.ascii	"@\205\006D\304\nh\214\177\004\241\262Lu\246\204R\247K[X\2028"
+	.ascii	"P\327\347*\301}a\013\217\005d\315\2160\367\226\272j\246Y\336"
+	.ascii	"\271\320\324\241mE!\377\264\373=\033\fN<0\312S5\206:\275\265"
+	.ascii	"\245\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5aced9f1f3c394c,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"\315\005"
+	.string	"\202\310 )p\213:\251\372c\235\373\231\351\364\\1\327\265\212\215sEc\300\350n\225\256\372\353\002\327?\331\232\221\255M|\373\315\335R\n\226\306)\023U$%\313t\t\350\b.\257\271=\234\n\206\2724\350WP\217\240\333@\271\357\256}\370|\332\335\2427M\213]`\332\221\020\362h\200\214p\001:\020\3768\341\250hSm5\315\240\254\232\322\376\270\2305\367\227b\220$s\261\325\336P\036\355\356ZzA\266\257\b\026"
+	.string	"M\233G\300\032\032\f\315eP\240\036"
+	.string	"\034"
+	.ascii	"\034>@:\\\nz\202\341\022\202=\264`a\200\002\204\201\341\026A"
+	.ascii	"\022\026L\320\016(\003\346\\k\342\001"
+	.text
+	.section	.gnu.lto_.refs.5aced9f1f3c394c,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\004\001\001\002\002"
+	.string	"\001\003\007"
+	.string	""
+	.string	"\003\f"
+	.string	"\001\003\016"
+	.string	"\001\004"
+	.string	"\003\001"
+	.string	"\002\005"
+	.string	"\002\002"
+	.string	""
+	.string	"\003\013"
+	.string	"\003\006\002\007\002\b\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.5aced9f1f3c394c,"e",@progbits
+	.string	"(\265/\375`\374\020mV"
+	.ascii	"j\227$!R@\022&\r\007\371}\334\371d\016:$\204\261[n\377\324\337"
+	.ascii	"QY\323\177\230\032\215\317Ej\217\237\035\240-\002\362!\310\331"
+	.ascii	"D8q\353\252\243Px\213t\024P6gG\277\212u\251\342\236y\224l\325"
+	.ascii	"\227\"\017\273\301\245\253?Su\377\373\375\233H\231\002\275\001"
+	.ascii	"\372\001\002\002\353e\235<M\353\005\355F\356\226\360\331-qs\305"
+	.ascii	"\006$X\212~\231\352\312\023\025U\204\351\3266G\006\254\031\325"
+	.ascii	"\262k\313\306\303\344\221\225qn5\037\267[n\246\b\033\217&>\324"
+	.ascii	"\025\332\240,\217\343\343\227\016Z\260\250m\217\037=\346\326"
+	.ascii	"\r\002\006\315\027F\377\275\262i(\023\266,2\214Z\021\342\201"
+	.ascii	"\252\322\202\204\321o\r\365\f\374\275\263]w\212\317\256\033\351"
+	.ascii	"d\253\273\315\026m\233{\266c_*[\345\273~\235\374\275\177\201"
+	.ascii	"\006\366lw\3302\021L\335?\252x]\3124\353\326t\257CBC,\222F\230"
+	.ascii	"\244d=A(\t\242\216\321\213\240\236\003\225\304\206H\321\007\324"
+	.ascii	"\357\224\177\237\254\223\025C\241\273\251\273\005\330\261!#\006"
+	.ascii	"\f\243\013\266a\333\034\261R\276@\003\337\035\241\264W\367\312"
+	.ascii	"Cy\264\325`\204\321\367\324o\224\007\200\354\006\236\243\376"
+	.ascii	"\271#\322\375\352}\241\004\245\312\251\265y;35'6\2142\253\273"
+	.ascii	"\rJ\2056D\223\177\231\254\327\210]\322\006\263\305\272W \336"
+	.ascii	"\312\003\n\b\243_7D\252nP\372o\t*(\375~~\316\371w\204$\235\177"
+	.ascii	"\213\220\3765J\241nC8\372\327\267(\254\001J\"\376\215\373_\366"
+	.ascii	"\237\354\277\224\377g\377\305\256\376\333\345\337\025\377F\360"
+	.ascii	"/\004\377>\360\257\003\377\266\370w\202=\340_\006\376U\261'\374"
+	.ascii	"\347\375\034\303\277&\374K\302\277/\376\375\340\337\r\376u\361"
+	.ascii	"\257\005\377R\360/\372\377\371\277\356?\335\1775\377\345\330"
+	.ascii	"\376_\371o\345\177\230\377]\376\277\370\357\366\277\355?\226"
+	.ascii	"\377j\377\323\376{\375/\340\377\226\377\351\363\371|\376\233"
+	.ascii	"\366\263\322\337\243\025m\332\354S];j\301\264&\220:\022\027\304"
+	.ascii	"\367\311uj\306\270~\005\335q\306\244\355\210\372o]s\353\266\355"
+	.ascii	"&\211.\021\223k\245\022\305\231\210\372\375a\227\256\271t[\266"
+	.ascii	"kG}0%jmM+W\024\347*\365\273e\351\2313\253\346\355)j\255k\367"
+	.ascii	"\344D\326\226\346\253f\207J\254\207\347\\O\234\327\016\31794"
+	.ascii	"<\265\345\212\266\346\340\260\252\"\302\350y\207\372\025\263"
+	.ascii	"c\276dNf\345v\252we\270D\255\255\351\251\251\023j]\335\023]\017"
+	.ascii	"_\271\233\341\351\366\352n\021\251\220$=\264\030}\2325\363?'"
+	.ascii	"\265\261\204\207&f\342v\212\344Xf\261\302\363A\243\t\032\243"
+	.ascii	"\315-\263c::\264t5\267\250\347?m\244\262\273q\334\254\255d\342"
+	.ascii	"\371\336\354\236\370{v\267\b\374G{7\"\253\233\nnN\315\241\f\351"
+	.ascii	"\203I\364\273\272\217@\275\2662\031vuLF\361\262\004Z\233\006"
+	.ascii	"\001:\fH'\327\253%\312l\356\265\267\233\256\226,$W\2462\2712"
+	.ascii	"\217?\335\304<v\257\313\237\244\030\362\270\311\260\253e2\214"
+	.ascii	"\271\004\352\246>v\030\222\006\265\211\271L\2621\227?\3110\344"
+	.ascii	"2\331t\265\004\222\202\023\"C\r'P\214l\227dS\337\200\242B*\177"
+	.ascii	"\234\311\225\331p\335+\346\324J\004\272\251\230J8\244\324\232"
+	.ascii	"19o0UA2w\355\356\001\240\230\260\230\335\344L\"av#a\202\321P"
+	.ascii	"*\216\253\263\207\254\363\b\204\252m8u\023\320k7T\367q\333\331"
+	.ascii	"\335\307\356\306QR\255\3353\374$\267\240\240\272\247\204\240"
+	.ascii	"\232\352x\346\324\315bc\314\226\3110,f\357\254\031\266\3254\326"
+	.ascii	"\343n5\334\225R\r;~\265\215\356^4\352\3262\307\031F7\214\016"
+	.ascii	"[\362\006#A\324\375\262`\266\271<\034\205\302\354\260\356\265"
+	.ascii	"g\207\344\321Vv\"\345=\237\317\347\236H\327\013o\227}{i\276\260"
+	.ascii	"\030e\261e\343j\363$\213\245\240P8@\311\301\334\344\305\251\355"
+	.ascii	"@\023D=\332\003\f\214.\207\312\023\035\020\214\036m\372\3726"
+	.ascii	"\371k\323\366\247\033\313\312\254\225S(\324\272\250,\3128\365"
+	.ascii	"\253d\331\351\334c\233\354\304O\204\276\326\243\017\233\023*"
+	.ascii	"\0248\\T<D1\352\204\253\240\361\241\213S\375z\375`&\231*\032"
+	.ascii	"\330\312k\314\020.\222\204\313z\375\275+\266\3629\002u\003\021"
+	.ascii	"\263\245\0037a/^\302]\314d\233\254\204\265\3163\260\217\0131"
+	.ascii	"\026+a \234\265\316\254\n\274\340\230J\t\333\300\\\353\234\372"
+	.ascii	"\351&\262\036\344\272{hhhHhhH\347\351\312Y\345\203\376x\234\b"
+	.ascii	"\246\244\006N\342\344\272\327\377\214\204\223l\223\271.\2646"
+	.ascii	"\027\033\341\034\3269\2656\216\022\314\374\350\032`\250\347\314"
+	.ascii	"\0278\037i\0168\370TY\205\240"
+	.string	"a\224o\300\231\222\3322c=\262M\336R\323t\235\325\305\355`!\202\325D\375N\007\365;\"DT0rUn@\324\357\230*\327\300A\266i\202\205|\277\030\3537\310\265W.\322f\n\230\224\3725\221\356\236\3175\221~\207C\375\331=\251\337\315P\177f\262\325M\330\332\234\233\325\226\275\265\331`b\364\273\243\372\263A)\211\023;X\212\247\376\034\336\022\263 T\350\3243\017\017\210p\241\302(\272\277\222r\216\263\216?\207\267\034\331\202\232S\317K\306\361\347\370\300\031\231\362UF=+o\250<\347z0\312Q\252\023\273\231\320\251\"\263\342\250\237k\360\023\337\200\341\331\346\007F\331\006C\235o\260\f\3157T0\273\221|\203\307\246\033\311\333-\261[\002]\202ud,E\317Z\324\303m\210\264g\203R\246\321;'w\334\324\344\2360\312\263\362\221\217\334\364\323LoJ\266t\346t\200\365`\246s\023"
+	.string	"Tdj\030e\344\257,\327\031\2212\353\205\347\t\207\225\037J\002?c\2208\202Q\021\216Q\221\n<z!\343\002\343/\003\243\"\035\243\242\3640R\f\203BF\3370\250cT\364A\006FE<2\226\206."
+	.string	"X\341g,\312\b!"
+	.string	"\343a\244"
+	.string	".\021\001\227\202\220\2041v\204*0\361\246\350\3431\372\204\300\245\033!pig\364\255\350\251?\030\202E\264X\374\021\223\222\216pd,\r\221P\242qi\227\364\023\002\203JG8I\277b\fT8\f\032\221~E\234\023}\300\245\024=\304#\030H\250\f\242\261\030\004\376@\360\t\031\177!$\375\224\322\237\022\0208|\221\364S\312)&\375\224P\036cPX\224\364S\3029\222O\210\201\361W\374\201"
+	.ascii	"\\\032\340HA\342O\370\003\252W\261\"\201\025,^\3009\213\026\n"
+	.ascii	"\264P =\213\026\275^\213\025=\365+z\273\237\217\370\023\272`"
+	.ascii	"\364C\"\306\030\026\177D\236\322px\201\357\306\3503*B\215\207"
+	.ascii	"q\300\207K?\"\221q8$\022\355\030},\214\302`\f\034\3410(\f\346"
+	.ascii	"\024}\300\240\n\302\241\213\244_\007\305\030\306#c\021\310\350"
+	.ascii	"\303y\257\347\202\204\b\036d\240\"\245H\372)\371\2140\200A%\242"
+	.ascii	"\"\361\327B\220\230D$\f\036\255@\204D,\022\2450\240\b<z1\f\246"
+	.ascii	"a\332\302\236\250|1\272\372\244I\264h\234\201\311\242S\366%M"
+	.ascii	"\310\2271\336\332\f0V\336\314x\240\216\320\230\341\205\323z\256"
+	.ascii	"\236\3151\214\262\223\207\0322[\030\225\262P5\270\262\270\254"
+	.ascii	"\334\rO7+F\327\326\270M\311R\206\324@\307vn\343-\275\220H\030"
+	.ascii	"\345-\313\306\253"
+	.ascii	"\323rD\013\214\232\032gY\337\320\272P)nNL,\347,7\263S\206\225"
+	.ascii	"5\203-\207\306\323\363\212\r\r\215\323(`\276\241u\005\251\223"
+	.ascii	"\301\3129\215\315G\207RK\214X\032\346\214\026\220\263*U\330L"
+	.ascii	"\002\347\033Z\227\017\034\332\232)eg\263\0346C\220`\2142\231"
+	.ascii	"\316\233\024\227f\224wX\270\035\234\324\027\2332,5e\312\306\324"
+	.ascii	"G\211\302c\013\245\243\204\236\254ohk\272\247N\354P\311z\026"
+	.ascii	"\341)\347\2614L\201@\250\201,\206\224E#\"#\"\"I\223ta\005\204"
+	.ascii	"\030\007)\264\016\021P1\223HfD\223\244P\3328/\030\335\330\343"
+	.ascii	"\212\275\205\206@\3209\356c;\355d\330"
+	.string	"\2478\237\223\366f\320M\335\006}\b\220\n\337\242\315_\365\356{\005\260\344\331\244\364\301je>Ck\232o\030\301i\216(\310W\202\f\221Q8D\003\224\301r\234\302wIa\367D\302\200}&\026\337@vg\244\242\245\362\200P=\360\320g\231\032\fPSEl8%W\334\002WH>\220k1\b*\241\206\201\306\031\256\367\032\347\224\252\260G\212H\361\232\245\367\221\371\240eq\224\245\261\033J\337\257\241f\224.\375\354w\016\034\232\305\357<\b\376\020g\264\376\300\364\302ia~v\237~\273e\243hn\"\232\017\275\211K#-,qj\376\021}\204\221v\"!\304\307\013\376\276\335#XZ:\375\020|C\247\206\3642G\375\330B\242\r\237C\207\\I\261J\030!Ps\273\270\024~\361\b\377x\201.\340\371\300\300\300\333O\271\367\356\234w K\364}\360\237\372Ov\357e\306\223\375\354\356Vb"
+	.string	"\025\345\350Xx\013\236\354I\241\016\274vr\276e\370G\305\224`\216\267F\3743v2\031\242W\r\221\2452n\013\f\242G\n\341\201\251\252)\351l\302\201\243@c\313hF%\004\237[_\301i&f\025ad\304\340D\220gr\325Z\255\356\236\2717h0\346\276\261\212\212\347\315\210\271W\311X\236NT\272\fx\340\311DGS`\215H`\003\312@\331\312\267%Nn\377\246\370\265\270,\302lN\202Df~\\<\357\306\022\230\323\370\bAt\233r\223LNv* ptQ\002r\2654i\373tG\235X\035\247\3003\271\251f\\\212\242\310\305\340\177y"
+	.ascii	"\260[\374\241\t\345\346\020\216\356UalW\317\276\b\3409\305\312"
+	.ascii	"\226\264\367\256\\J\250\202\327\030\202\367\366y \003W\227\331"
+	.ascii	"\032\022\034^\264g\204\361k\312\363\257\013_\016\236,\004\225"
+	.ascii	"3\224\352\2529\036\341\344B7\350S\036\243\217[\277\267xjD\364"
+	.ascii	"\247\213\273\3755\204~\341\006\006\033\314S\\\264\306\226\317"
+	.ascii	"\321\177\200\377\232=\320\350\213\355\037\266\226\271}\274\345"
+	.ascii	"{\375\234\357\236\325k\023\257\371eX+\361\217\200\373\0021\207"
+	.ascii	"\333[f\035:]8\300U\262\361\244\n"
+	.text
+	.section	.gnu.lto_.symtab.5aced9f1f3c394c,"e",@progbits
+	.string	"pgResetFn_statusLedConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"ledInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.string	"ledToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"ledSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"statusLedConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"statusLedConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"statusLedConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"IOToggle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5aced9f1f3c394c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,371 @@
+	.file	"pinio.c"
+	.section	.gnu.lto_.profile.cee9304552bc2ed4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cee9304552bc2ed4,"e",@progbits
+	.string	"(\265/\375 Q\255\001"
+	.string	"\204\002E"
+	.string	"\003"
+	.string	"\342\366\243\226\001\020\002"
+	.string	"\002\001\002\002\003\004\002\003\001\240\342\234\212\n\002\241\251\226R\b\004\002\003\002\002\002\003"
+	.string	"\004"
+	.ascii	"?\213\n\216\333\025\272\2016"
+	.text
+	.section	.gnu.lto_.ipa_sra.cee9304552bc2ed4,"e",@progbits
+	.string	"(\265/\375 .\345"
+	.string	""
+	.string	"\220\""
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"\002\002\001"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"B\221\221\333g\003X"
+	.text
+	.section	.gnu.lto_.inline.cee9304552bc2ed4,"e",@progbits
+	.string	"(\265/\375 \260\375\003"
+	.string	"\262\307\031$\200K\322\001\fP\035\220\f\342\312\205\230\205-d!\0047\007[\n\314\320\231"
+	.string	"\310\024\003\372\375\373\261\021)S\277\356u\317\316P57I\202{\2412\306X\340\243n&\221\214A\375\200rNE\0337I\207\373:\256\236\005\207\277\256\317G\255\343\223\320o\244 \216\312e\360\2136\013F\222\350\223\241\332Di\210\357\217\b"
+	.string	"z\ba @Q\304@\2007\313d\331\376P\326m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cee9304552bc2ed4,"e",@progbits
+	.string	"(\265/\375 \301\315\002"
+	.string	"BD\r\027\260%\351\f\303\200\234K\222S\f\206a6\340QOQ\262\333n2\245\3724f\204\231\3417\017L\223zR{l)\027U\023\217\324\214\216\323Y\367\f\336\t\b\r"
+	.string	"0\005\225\027"
+	.ascii	"\236\262\b\274\023\250\272\251\202\321\274\022\310\254)$d\022"
+	.ascii	"\003\216+\246l0\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.cee9304552bc2ed4,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\231\004\002\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.cee9304552bc2ed4,"e",@progbits
+	.string	"(\265/\375 S\375\001"
+	.string	"\364\002G"
+	.string	"\002"
+	.string	"\001\024"
+	.string	""
+	.string	""
+	.string	"\001\002\b"
+	.string	"\001"
+	.string	""
+	.string	"\001\b\177"
+	.string	"\001\002\t"
+	.string	"\002\002\007\001"
+	.string	"\002\n\001"
+	.string	""
+	.string	""
+	.string	"\002\002\274\006\001\002\007\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"1\003\320)@U\334\240\254\n\2036"
+	.text
+	.section	.gnu.lto_.lto.cee9304552bc2ed4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinioInit.9.cee9304552bc2ed4,"e",@progbits
+	.string	"(\265/\375`\266\005\235\""
+	.string	"\026|\326G\200\332U\007\277A\376\032`\005\334\364\311D\254\202\237d\374\2604V$\236\213\363\332f>\007&\374\\T\321\352K\360\024\212\237\270\330\rq\364\215\211\246\265\321\342\347\374\272\245\340\001\003\232Y$\321\316\317M\366\226)\245\024\304"
+	.string	"\264"
+	.string	"\302"
+	.ascii	"k\247\234l\037\265\323\265\005\250\235\262\217\331L\001&\\\026"
+	.ascii	"!\227\233{\257\356\207\260m\233l\326q_\357\350\344\340n\266\332"
+	.ascii	"JSS\373\356\343\326j'z)\301H!\376z\307\342\236VR\355\034\376"
+	.ascii	"\260\022\266\226\\GH\321\3309\270\333\261\330\243m\226\301X\020"
+	.ascii	"\262v\016yX\003F\346S'\031Jy\rN\325\261\030\325++8\026\241\232"
+	.ascii	"fubL9\3329\204\262<Tfg\204\256Z\237\261 d7b\223}`d>\261\002\347"
+	.ascii	"0\312S\n]\316\034\213>\332Z\241\247\225\224\016\221\311\n\210"
+	.ascii	"\242\362\354e\273\rb\320\277\267\332\303\260\\\225\035\213\306"
+	.ascii	"vZ\205{/\273\023\261\330\314\323\314\235cf\n\314)\210\316Ex\006"
+	.ascii	"\364(\213\236\342b\002\325\275A\"f^K\201\261\336\033\034\212"
+	.ascii	"R\"I(L\221N\271i|/{\300"
+	.string	"\023\250\021\013\f\350\321\217\242\362\254\372G2'\177\376SO\253\250*\374S\314@\335\325\334\323Y\335\001\336\231\247\225\315\266\324\271\366\316k\352L{g\325:\247\357l\337\371\255\263\277s\347\236\207p\351#vo\216(\234\333L\301\216tW\267\222\271\271\270\227]J\271\037\023\311\275I\242\265\223\334[|\353\224\331I?\361\265\222\303\354\205r\341j\013\364\336\033\324)\017\255\235\346l\337\230\271\235\271\257\032\313\327Y4\032\300\275S^_\367&!\360\203g@.#\0260\177\326\327\240U\006\326\r\344&!\203\336\344u\320\036\247f\300\203\272\303\007\031m\232L\377[\tx\b\021\215L\323\f\376\257@\2314Zh2T\332\367Q\311T\237\366\351\216\245\360l\245\272\303{\257\203\326\322\374y\034\036\313j:S\037\331\bT\236\365\311\321F\240\252\317\363\354B\250\245+#\032\220h0\023\t\250\324\347\260\204\t\030"
+	.string	"O_B\237P{\236\031\205\221\267\023\347\232\376\307\366\323o\257\356#\365\337~7\031\227<\312\266\377\257u\211\t\317\334\310|\322J\037i\274\177l6\203ZAc\037\311Jj\317\267\363\215RL\320\315\030\347\376\314\273\026\336N=\237\013\376\217\373\375\003\274\235\357z\305N\005\022\257\350\306F\021x;\244\335\013]R\357h\306\256\227B\207\264C\341Bg\324K\322E8\300\274\027G=]\f\036\257\247\273%\357Wk\365\005+$eP\340/}\355<\222iZr\200\376\307xP\333\336\0067\207\251\266\357,\345\230\240\233\265\275\367^\035\241\266=\320c\031Q\202\351\362\034&\315F\351gM\321"
+	.string	"5\270/F\037P@\217\342\312\2409\003]\372\2324\231\214\314\030\0177\224\030\257\232\210\216\0338n\217\364\202\325a\300<kU\\1\252\200\224A\333\202\312\354\323j\247\205\004T\367\336\241\261\242\2370\367^\242.\335\304\300\0316x;mP;\255\215m\271Q\003\364\350\232e\215*\233X\327\276\267~\355\273\2140s\250a<\246\fD\206FDd$I\223\306\200\002\221\251\262z\020X\2504M\322\030!Ry\236\375\206\274R\265P\326 t\267\303q\033\221|\212\005\271\301\336\204\314,\2414\376j\362\221P\373\213\221W\202\273U\020\341z6x\377\374\020\235\370-'2\220\202&\272\321\233A\354.\352B{f"
+	.ascii	"f{\261\212\n\222f\n\207`D\360UI\240b\277\375\323\210\364\026"
+	.ascii	"C\265pL(\203\217\263\367W\246\252\260\035\214\3711\246\255ij"
+	.ascii	"@q\013<\300a\301\354\207\027\341\036\323D\331u{\244\223\343M"
+	.ascii	"\356\270bF\247\310W\232H\313^\346;\217D^}\f\020\337\322u\363"
+	.ascii	"\236M0Y\303I\372\272c\257\312p\302l\030\335E\017\327\341\f\341"
+	.ascii	"\264\005\267\032n\026UI\t>\006\236fuW\306;'\306S\037\3018xQ\343"
+	.ascii	"9\321Rq\001\3651\210\326j\322H\251\2270\177"
+	.text
+	.section	.gnu.lto_pinioSet.10.cee9304552bc2ed4,"e",@progbits
+	.string	"(\265/\375`\303\0015\020"
+	.string	"\326\336mG\340\222*\035\222S\344\301\325\031`\252\3468\271f\"\t\375\021\250\225CZ\242\2167.\020\300\025gu`t\324^\001\\\333Vn\b\3474\032\302\0303\024\200\230\007:yi\t\n\252t\231\206\020m\305\306F\210\334)\005X"
+	.string	"T"
+	.string	"["
+	.string	"/T\247\031gp\367\204\212\231\3355q\202\316\277\317\005p\376y\017\300\371g\225\375\343\245lo#\321\212\321\355n\250)\256\272\247S\345\337v\320\365Z\335\363p\365><r-\222W\213g"
+	.string	"V\302\346\266O\016/\326\234\"\021v\327\323\365\352p\177\267=\3016\004{\236\004\336\356\256\025f\277v\203/\377\316i\277\210N{\237\3269=\347\364G"
+	.string	"\264x\031\201\342E{\224\353\262\023\262\271\017\007\213\327~\373\267\331c\273\226\372\254\312u\t\205\320\315t\273\245\202\177n\340\320\211\352e\212\300\203"
+	.string	"\231\351\330-M\314\240\363\317\237\366g\017\240\252\206D\334ZC~cb'\243\0323\250S+\330|\264\314\033\333+\257\221Z@\203t`\306T\317\212\006\246\243WPo\243\365\201e\3622)\220lw\035\330\036]\006\tA\315\356>\210y\f\223\277\342\2371\240\346]\377|\024\347\337\325\003\343fCc\231;\273\\M\215\331\017\342\t\345D\001%\212:\"rj\020UD\343\347\024\0209\212\306Qh*\211\031\306\222J(\032QV\302\224\222)\004\02509\022K\341\211$K\241\247\334{\2530\t;r,\312\3624\206K\225\310hH\003r\200.p0 H\246\252\247\266ha\336\345\317\006]\331\036?sa\244\346F*\271\341)\030\036"
+	.string	"3C\357\220\3009\273ehwF\326\200e\026\001z\300\270M\210\236\tl"
+	.string	"\355\300\020b\310Q\2068%\243cnB"
+	.ascii	"\333\201!\224\220\005\n\361\b!Fm\006\222\270&\326\341\032E\r"
+	.ascii	"\377\214\373=\017\212kn*q\246\024\n\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cee9304552bc2ed4,"e",@progbits
+	.string	"(\265/\375`,"
+	.string	"U\005"
+	.string	"b\t$.p\307\351\305\0274\na\213\022L\n$\017J\357#\\S-\335\304\234\360\365\017\377?\377\377\377\337\276\266>C$\"\"\222\021\022!r\247\024\376\367+`B\001)\346\005\360g,\222I:\251\357N\b\210t\217s\342n\003\016d\001rN\332\027\007\b\004\2173\342\036/\005\225N\344t<\267\001\26038\025\232%\224Bh\225\351\205\251\365\335\265\031\341\245\330\237\335]K\247\230\366\265\255$\310v|\354\306V\333\243\334\240f\363(=D\333o\004\t"
+	.string	"\240\036"
+	.string	"\034"
+	.string	"\034"
+	.ascii	"\034>\201|\265\364\247`\270\354\235tJ\017"
+	.text
+	.section	.gnu.lto_.refs.cee9304552bc2ed4,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\001\001\026"
+	.string	"\001\001\030"
+	.string	"\001\001\031"
+	.string	"\001\001\033"
+	.string	"\001\001\034"
+	.string	"\004\002"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\001\006"
+	.string	"\001\001\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.cee9304552bc2ed4,"e",@progbits
+	.string	"(\265/\375`g\013\005="
+	.string	"*kp\027DPdR\007\245\275\026S\356\337^\030\334\266\007h\353\267/v\312W;\261\343\267\344c\3725\376\265\326q\013`\033\321\033R\220\\8\214\210\013wp\260\273Q"
+	.ascii	"\001\330\326XY\221!R\023\331\377N \255L)@\001\\\001i\001\\b\246"
+	.ascii	"\340\314\366Z\205\242\315<dp\356d\253\346_\274\352k\336\245\375"
+	.ascii	"\375\267jx\375l\310\367?%\023\373\377v,\335\3035G\3634\004\314"
+	.ascii	"\377\351\226\220+\256\332f\347\377\217\222\222~ws\3200\1779\315"
+	.ascii	"K\020\017\314\273\344\032\334CeO\036\234\233\330\366\207\266"
+	.ascii	"\227\332\366\263n\317\342X\334\272\342\237\372\377\004\202\344"
+	.ascii	"\352\316\332pv-N\365j\002\347\322\0316\264Oi\366d\377\2570g\231"
+	.ascii	"\371b\202sWh\333\2674\2004\277\241\333\266\263\236\340\347e\303"
+	.ascii	"v3\243\037T\372\276\320C\022\257*8\373p\233\335\350\267\300\005"
+	.ascii	"\\\351v+N\226\300\347\354\341\276\365\377-\022\276YO/\234\373"
+	.ascii	"u\001\277\326\215~\335\216`B\303\020vc_w\317\265\232\356fS\347"
+	.ascii	"A\244n\317\022\272\035Bw\247u{\204n7z\320\335\327n'\340\240\333"
+	.ascii	"\031t\267Z\2677p\005\b\036t{^\267'\350\366\243n\017\320\355C"
+	.ascii	"\335\376\323\355>\335\356\335\275\327\335x\272\373Lw\333u7[w"
+	.ascii	"\273uw\234\356F\321\335w\335\335\246\273\305tw[w\223uw\200\356"
+	.ascii	"&\323\335\276l6\233\355v\246n_v\003m\005u\246W<\352l~\325Sk\t"
+	.ascii	"%\302:_\367\351\376\335\232\343\241\r\376\265\\(\335\022\210"
+	.ascii	"\177ab\253\230\327\245\373\005\236\314.\367\233Xg\024\367?\n"
+	.ascii	"\363\305?\227\224/\366\303\034\253\364\322\372\0369\376\r"
+	.string	"\374\373\377\374W\372c\377_\371\377?P\255\367_\b\221S\354\371\374\227\036=_K\271\226\343\037[\355\276D\235\324.w\270V\245\212=\325\253t\261\247\233B[\252\262\354{\374\277\317i\305\242Wrp\3668Ae\234N\230\300\265\216\347o\274\352p:\233\271o\320\267\3142\243\206\364\023f\263\331\254#\271i7\312\262)p8w\373]{\033\314ef\312\013\3471N\306\355\200\356\177S\210\355-\253\n\316u?wZw\326.m;\231\0314\r\335\3039\217s\254c\245\357[-uY\343t\316\306\253>\347h\332\323\270\\\037\275\377\3272\0316\370\234\253\361\267!\345\373>2\\y\220\331\371\177\223\222\216\222\200F\252X\257mn\007k\375]\300\217\310\203\264\355\325v\343g\032/')\223u\005\347v\254\266=\332\266;\333\266\272\200_\376\327\215\340\336~\254\270uYq\3667\354n.\246\375\315\303"
+	.string	"\233\376\226\377\227\356\f\206\334\031\370\204Y\262\324\362\313\355K0\355m\023\002r|t@\312\366\274\370t\351\335\251\325\351\320\201\253\366\204\320\300\262I\236\215\253~l\362\312\272p\306=\034+$EO\0260\314#?\237\230]\341\035B7n?\346\304\265\215\327\250\250\360\224\023\275L9;1\037\025.\270k\213\231\215\231x\352\310\365\311\265\271r\033\373\227\"\345\273\"\326!\270\331xJ\255\013l\n\013D\265#;e\262g\017V\266\377\357Z\266\202i\357\032\027\374\215\225\001\264\322\364p\366l\207q)kH\356\336\200;\254\332\210|\355U}\317\333"
+	.ascii	"9s\234\032\234\207B)4\226\266\355s\234N\236\343q\351\373\356"
+	.ascii	"\340\244R\244\337\364\212\006w\247\035O\343\001\377\311\376\037"
+	.ascii	"\201\320\234t\354\007\316\235\347v\272\033\b\243arff\307\353"
+	.ascii	"\264zd\364\342\260\275\271\316\030\2258\234\253\256\347]\202"
+	.ascii	"y_ZU\234\033W\265\215\273\177\277\204\376\277\225\317\373P&\260"
+	.ascii	"\335\307\203\356\363\006\335\235\377\243\374\027\241C\247\205"
+	.ascii	"\242\266\034\202sw/\370\036\373W\026\375\373P'u\252tnI\023-z"
+	.ascii	"\237\213\300S\275\336\371N\243\331}\374\357\3737\247\321\031"
+	.ascii	"\316\327\205:_WI\364MW\371\377F\211\234\326\245\322\235\324i"
+	.ascii	"\324Iu\243E\337|\345S\227\\m\323\215:\313\270Q\"'u\031u6\247"
+	.ascii	"\321\"\"t\216\340\351\b\305\244\021\251\242\211\370\003\305\002"
+	.ascii	"\005\216\017\311b\210&bP\023\361\227\fj\"\226\b\321D\004\032"
+	.ascii	"E4\021s\277\270p4\036\035G4\021s\262x\242\005&\215QD\240~2\""
+	.ascii	"\213QE\250\266\2278X\340\300t\343\247\231:`\350\200\341\327L"
+	.ascii	"\035\206\303\016\034\206ms\030\372\212N\310b\224\215\246\342"
+	.ascii	"\023\222\306Q\252\210\024&\373@1\311\")\345#\345T\214aLF\321"
+	.ascii	"01\224tj\"\346\243\021\267(&\221\305\032Q\306\026\306\361\370"
+	.ascii	"\301\311'\331/\240d\f\350\243\214\"R)y<\"\225\204\222NL\311("
+	.ascii	"#\215\237\247\237\224\023\224\321E\324\021D0\351\364\323\303"
+	.ascii	"!\210\005)H\204h\237.\034\215QF\031JR\310b\r#\262\205R\224\221"
+	.ascii	"E\f\245'\244\224\322\005\003P,P\034\215>H\266\206\250;\320\312"
+	.ascii	"\302\252\204c\246\326\264\201M\005\251\251\001s$\315H\320\nN"
+	.ascii	"\330\227+\320\207\217$\356\027\026\360\331\204j\n{aip\232\255"
+	.ascii	"\332\341\214\247\255\223\034u\257?uH\001\303\031\273K\356\377"
+	.ascii	"\022\027\301\\\215\335~\261+\334\023\2723\300P\256W{~Y\210\020"
+	.ascii	"\274Uw\3456\206\271\204}\335\301Z\215\267\204Q\262e\024\234\361"
+	.ascii	"\020\307\n\363\3005Q\222'+\013K\361\030\311\303\003Hc\251c\207"
+	.ascii	"\260\240J\352\254?6r\224x\301\201B1\026\336\020\035\233\235\263"
+	.ascii	"\253\306X@{aK-8c+\307\006\311\0019\3638\343\250\007\200\345\250"
+	.ascii	"q(\207\2245#C#\"\222$I:\240\002\021!+\326\001\021\260-\223HJ"
+	.ascii	"\222,\007\333\001T\214\355\016\210\021\301Jh\202\250^\016\007"
+	.ascii	"PTTR\377,*\223B\233\370\200xB\271\305\340\020M\317\335nM_\260"
+	.ascii	"\267\225J\f\373X<c\016\372A\370=z\360R\255\016`*\214\267\003"
+	.ascii	"\323\217T8\302\t\362\243\301\263\205\021 \r\206m(Z\0057\331\314"
+	.ascii	"&Sr\002\253z\301x`S\211~\335\035=z\304|F\310\252m\nK\234\256"
+	.ascii	"\222\026\3549g\273\223v\266\001\325O\344\356\226\357\303N*\r"
+	.ascii	"\322\332H\322\r6y^(\315\300|EJ\323LuX\374\356\230\341\353\305"
+	.ascii	"<\021\270&\232I\"\f\373h\025\004@hK\375I\207E#J!q\251G8\247\322"
+	.ascii	"H\004\216h\333$us\367}\0371x\300)\222\240\003$`]\rn\363'\260"
+	.ascii	"\262\331\355\252\200\331\2133\232\316\222\240\241\364\362\022"
+	.ascii	"\233\244\2270/ech\304\304/)X\251\226\321M\004\244\"\371\236\214"
+	.ascii	"r\233\307Q\274W\005\023v6\221\201\271\237\221\253\036\rN\324"
+	.ascii	"\326\307\024``B\276\n*\241\300\332%\311,F5\n\361\002\342p\204"
+	.ascii	"\300yH\bH\177\220>\253\220\263s\220\016\372\301\037\301\271\207"
+	.ascii	"\037~\373\342\347\331'5\rh\254\271\251\005hJM\034R\343+\215-"
+	.ascii	"_\247GF\261\311\373\200\375\272wN\243\022A\024\247\366hR\206"
+	.ascii	"\240T\004\257\2008\334\266y\022\271\221\302m#\357\264\355V\204"
+	.ascii	"?\367%\036\323\340G\223\025\241\035\305\212xC`G\354_\313\333"
+	.ascii	"j \256\251\234\177\237)\300Uj\213\267\004\020\277GT\001"
+	.text
+	.section	.gnu.lto_.symtab.cee9304552bc2ed4,"e",@progbits
+	.string	"pinioInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"pinioSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cee9304552bc2ed4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
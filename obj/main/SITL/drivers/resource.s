@@ -0,0 +1,194 @@
+	.file	"resource.c"
+	.section	.gnu.lto_.profile.9b8dbe6c73bf5565,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9b8dbe6c73bf5565,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\261\203\350\322\002"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.9b8dbe6c73bf5565,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.9b8dbe6c73bf5565,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9b8dbe6c73bf5565,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.9b8dbe6c73bf5565,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.9b8dbe6c73bf5565,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.9b8dbe6c73bf5565,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ownerNames.3.9b8dbe6c73bf5565,"e",@progbits
+	.string	"(\265/\375`\r\tU,"
+	.ascii	"\352O\240\02170jm\016033\302\320.\276\372\330333\375T\3258\332"
+	.ascii	"\340\037zr\033\254\223\323\363i\331\214\2227u\347\376m7|$\210"
+	.ascii	"T\211\177f\376c:\373\332:%\031\005\001\031\001\n\001\272\202"
+	.ascii	"\021\265\025/\267][\370\267\263\025\361\367\331\256/\304Bz\034"
+	.ascii	"\214g\273\336\256\222\036\027\377\233\355\032\303*\325\345\340"
+	.ascii	"\325|\277\314v\235\001\225\321\345\342\207\333\2565\224b\363"
+	.ascii	"\271\177\262]o\020\205\364\271W\262]s\370\244\346t0\254\355\272"
+	.ascii	"\003\247\027N\027\267\346\353\242\266\353\260LF\257\203c\230"
+	.ascii	"\257_\332\256\201\226"
+	.string	"dx]L\303|=o\273\3660\t\315\355\340\272\355\372\003$6\267\213\377l\327 \032\235\371\335\321|\375\316v\035b\017\315\357\322\314\327\341l\327byl\2167f\273\036C\204t<\033\346\353^\266k\021vl\256\007\373\224\355z\204!5\327\303a\276\216d\273&A\227\364E\360\232\371\006\331\256K\304\261\371\242\330\315|\327\266k\023\201x\370\036\354\303|gl\327'\374\374\360\275\030\210\371\n\267k\024\376\265\345:\373\036!?\270Rpy`\275\275\275\316\304\365\020\363\375\355:\177\226\234}7\002\037\351%=\245\257\364\227\036\323k\372M\337\351==(\261\027\025\342\364qzSRdE\376P\350\003\270\314|5\225\375\t\371 ~NH0XkeB\003\2135\221\355\272\264\204\006\001\326\223\220\020\342T\333\365\026$d\005\270$\265]\373\374k\253\221Z!\326\264\031\251\026\270\364\222\026\342\362\227H\275"
+	.string	"\227\205\266\353\256;\343\205\330\317v\355u\310\270\3139\3335"
+	.string	"Bh;f\263]\007\220C\343P\n\020\224r(\261l\327\003\376\250u(\231l\327\004\370\234u(\013\344I\206\301\255\266k\003v\324\260\370\300\034\025\230i\273\376\202\223\004B\332\256\021\264I\212\345m\327\t\324\234\211\035\332\256\025\2341\216\001\332\256\027\220I\307\\\230\257V\234\355\232A\030U\204\326\231\355\272\201\227\244\210\330\301\226\344\bX\353\312v\375"
+	.ascii	">\033\241\005v\305\210B\253\310v\r\201\312\031\nW\333u\204(\306"
+	.ascii	"\024\360\250\355Z\202\023c\nL\333\365\204%/T\300\277\267]Sx\221"
+	.ascii	"*\342D\333\003\247Zf!1%\023\242\303\256\354\246\304\024e\213"
+	.ascii	"fN]3\324\313\314=\220\211\3501H\034~\345\2640dZ\033\21757d\033"
+	.ascii	"\320\255\r\331C\255\255\0060\207\032Z\022\230\326\346\006\f\003"
+	.ascii	"\313k:\220m\300\035kkm\300\256<D\333\243K\f\036=x\030\003q\236"
+	.ascii	"\307\264\330\036\315X\004\331\371x\037\377\343\200\\\220\017"
+	.ascii	"r9\237sB^\310\017y\235\3379\236'rE\256\347\213\234\221\307\356"
+	.ascii	"\310\037y$\227\344\224\274\222_rL\256\3117y'\367\344\240<\224"
+	.ascii	"\217rRn\312Oy*W\345\254\274\225\277rX.\313g=\221/\362G\036\311"
+	.ascii	"'y%\317\344\233\374\223\207\362R~\312Wy+\217\345\263\274\226"
+	.ascii	"\207{.\337\345\277<\230\027\363c\276\314\233y4\237\346\327<\233"
+	.ascii	"w\363o>\316\313y:_\347\357<\236\327\363{\276\317\373y@\037\350"
+	.ascii	"\007}\334\317=\335\027zC_\367v\217\367\210^\321\347\375\242\337"
+	.ascii	"\373x\354\035\375\243\031EY\026:\2531\212eV\213\3052\263\253"
+	.ascii	"\273\252[y\205\301\242\355V\231Oa\260\314\256\033$cY\343\351"
+	.ascii	"\232\241fN\333\226=\236\302 W6s\315\330\343/\227\031\311PaYY"
+	.ascii	"\312\272\001\362\332\342D\217l\220\270\266]YE\335VF\353\313."
+	.ascii	"\316\326\314k\233\246\355\252r\345\341\031\024\266\307\023Dj"
+	.ascii	"\346\237\220\r\236\3026@\21368d\301\225\333\323\314\355i\n\333"
+	.ascii	"\325\227\333_n}2\312V6H\366\003\220\311Zc\231\335\023uQaWf\321"
+	.ascii	"\"\212\222\371\262\260]\313lf\026uY\024\0061\345\312\305\224"
+	.ascii	"u\333\243\020\035\376\326bK\f\262\256W6sa\224\271=\217m\033,"
+	.ascii	"\252\353\331\225\313\214"
+	.string	"\303\342\321\214\005\220\207\301\224E\333\263E\177y\270\262.q=\217A\026U\203\247\200\\4\252\251\273\225YTHLY\240e\304 \353\225}yM\211iq+\023\323\342\361l\325#Yk\364\312k\200\250\250A \"a\n\311XP\220\024%\031\326\360\242\241\031\326\001\020(B\334h\266\030\354\004\254\346\f\3666\035\234\261A\355\264\002\256\315vo\001\251\004w\016J8\226A0\026\310K\326j\323\275\027G*\316~^a-\036\0264[!\254\203\201N\333\227\320\204\230\354\037\r\247\206\033\256\236x\262p\303\261\341\205w.!\225B\205^\317b6\272\247\343\311A\216zbE:\355\312\210\360h[c\f}-\004C\"\276\303\360\326fZ%\003M\314*l?S\270:z\244\r\371\353\210@\244eAL`\211\030\301\364\001\342T\002!\026\346\355\276e\340?\261\257X\344\375\344H\327)\251\264\367\257\234\231"
+	.string	"\313\t\375\330\321\304\n$\271\264cs\2553\324a\336\214\225|\222\244?\372\206\373\2354\224\016\242R\345\257\342\260\366\217\336x\251\307*\241o/E\372z\230\212\021\262\361\002\272QP\244\340\303\326\343\n\036\036\341\"\214\275\304\0229\366\310Q\226\203\026x\027\334\201\n\020u"
+	.ascii	"l\030~\316\365"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9b8dbe6c73bf5565,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.9b8dbe6c73bf5565,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.9b8dbe6c73bf5565,"e",@progbits
+	.string	"(\265/\375`\370\006U\""
+	.string	"*@\200\rI\220\224N:\346\230{{\b]\313xc\001bi9M\002\333\372\277\200\206a\375\326bTy\251"
+	.string	"\320nq3\300R\016\276\034\255\272%\371*"
+	.string	"13\357\346\221\250\032\330WR\"\301\314f\022\231M\354\201t4\311\354&S\n\243"
+	.string	"\315"
+	.string	"\315"
+	.ascii	"V\237r\203\007\336\331\370H\243\3224\275\225\203\2424\275\271"
+	.ascii	"\225\217.Mo|?\202\037A}2j\302:\253\035\360~D\375\037\366\221"
+	.ascii	"\367\361;{\206\216i2MS_\217\316H#\307V\363\376;#\330<\fs\226"
+	.ascii	">\260\013/\346x\340\271[\376wzy\266\263\354\023\260\017c\377"
+	.ascii	"g_\200}\237\375\027\373=\373,\366O\373*\366o\246m)\266\347l\313"
+	.ascii	"\331\206\263\375f\273\3156\233\3555\333j\266\317l\233\331\016"
+	.ascii	"\003\263\375e\273\3136\227m\003\366\211lk\331\276m\245\355m6"
+	.ascii	"\233M\333@\266g\354\023.\325e\007\236-c\250O\246B\244|!ckO,l"
+	.ascii	"\271\302\351\311V?\314>\221+_\216\030\301v\266\276\310\b\352"
+	.ascii	"\037\351e)\353\232\266\376\212\200\275\350\020\362Jn\365\301"
+	.ascii	"\354o\375\313\245\212\352&m\353\223\016<O\004\365\275xS\276v"
+	.ascii	"\224\266\016\370oH\327\223\361\250\304V\277\313\276\220s\335"
+	.ascii	"\352B\017IF\267c\353k\034x\302\374w~\013\365\203\370\\0\331\f"
+	.ascii	"m\005~\307\017\325\343P\327Z!\246i\n\006"
+	.string	"M\2128\234@I{Z(\330IiM1e\375\214J\233co\210\b\204\307V\037\313~\324\245~\325R\224\2468i\232\022\330\231\325\361\bm\265\177\365\344\216X,:\006\360A\001!\3158F\255p1q\004m=\325\253\374XL[W\366fm\214z\222\254\215\375\346\246J#h\314\255\206r\340\351\253C\375)\274fs\210\322\326\027:f\215K\023\373\331\3523\355\247]J\213\332V\223\244\255\020\342P?\312J!\021\227\240\314\271\304\261\031}\316~\334\345pN\"\016\f\247\255\f\016<O'\250\377d\267\364\341\n\332\252\322\004n\305\013\343\211\255>\234}\267\277M\255l%-\275m=p\340Y\227\240>\223\b2\216\236\266\356\224\264\265 y~\234\266\372m\366\307\316\326\240\250\024c\253\213,Q?\311\251\203\310|\332\312\202d\315\202\217\r\265\255\376Z\262\216\206\016\331\326\247\241\276Z\f\020/\256\255"
+	.string	"\320\316x*r\220D[\3753\373e7siq\343\310\270\001\2161M\007\3410\350\201\206f\030\354\re2\314T\243\250\204\003\025(L\340\315,\020\316\f?\320\324\b\207\301\232\241\020\204\206!\206 \007\r2\033\2023\303\232\340\202\0025\302\r2\024\206B\016!hXl\357\220\020\222\252\260\253\255^!\373NV\305\226\030\025\322\326\004n\2507\250\036\311\361\334"
+	.ascii	"\372I\313\220\316\266z\177\354\327m\212-\262\030r\333\3527\023"
+	.ascii	"\250\327g\233\222Je\017\217\n\222(\207\265\325\313c\357\210\335"
+	.ascii	"Y\n\372!\333\352$\022\365\242\360\241\005\211c*\352 Qa\005m\365"
+	.ascii	"\352\330kbO\210h\326\315m\365\362\300\323\245\f\365\022\307\276"
+	.ascii	"\336z\224 \321\313\351\t\313\331\352%a\177\2719g\263\351Iq\253"
+	.ascii	"\205\034x\356\b\324\213\203\003\024|\25018D\214$\216\024\021"
+	.ascii	")*H\226\003\320\002\211\356\346\001\021P\235\223\002I\226\321"
+	.ascii	"\255\237\001\311\326\\q\204\307u}\337~\007@\206\200\177\223\240"
+	.ascii	"\020\321\356\003\222\001\3617\303\203\026\223\364%.\301\271\033"
+	.ascii	"\311a\225\301J\034I!\n\350m\225\031\022\210\313>\361\357\330"
+	.ascii	"<\374H2i\002\313v*\f\243d$\305\367\fK)\022'\357\201\350\f \227"
+	.ascii	"U\254^\361\213\032\342\346N6\tV\262\337\231E\242d\214\211\313"
+	.ascii	"Hv\022\016\227\020\027?\336z\214G0\034\345\027S*~\220e\232oS"
+	.ascii	"\005\233{\257E\006\027@.A\224\236'\013\027F\312\007\035F\331"
+	.ascii	"\364\323Ag\371\307\265\001\231:\325\204*:<\002\335\351B\222\366"
+	.ascii	"`\370\376\312\225\330\377\371\227q\026\370B\253\260%R\334[e\315"
+	.ascii	"\t\220\225pW\255c/5"
+	.text
+	.section	.gnu.lto_.symtab.9b8dbe6c73bf5565,"e",@progbits
+	.string	"ownerNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9b8dbe6c73bf5565,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
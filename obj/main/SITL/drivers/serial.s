@@ -0,0 +1,796 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375 (A\001"
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\002"
+	.string	"\004"
+	.string	"\005"
+	.string	"\006"
+	.string	"\007"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.string	"\016"
+	.string	"\020"
+	.string	"\021"
+	.text
+	.section	.gnu.lto_.icf.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"\025\007"
+	.string	"d\013\036\001"
+	.string	"\022"
+	.string	"\345\270\263\204\t\n\002"
+	.string	"\002\001\002\002\002\003\002\004\002\004\002"
+	.string	"\002\005\002\006\002\003\001\226\266\355\210\004\005\002\007\002\003\002\b\002\b\376\310\332\342\r\006\002\t\002\t\003\371\204\261\234\003\002\002\n\002\005\004\365\311\226G\005\223\220\260\362\005\004\013\002\003\006\332\326\203\320\004\004\007\255\302\302\203\017\b\273\352\374\254\004\t\373\211\332\252\006\005\002\f\002\003\n\357\342\376\200\006\r\002\003\013\254\234\255\305\f\001\002\016\002\003\f\231\366\336\334\r\017\002\003\r\351\305\300\264\t\005\002\020\002\003\016\362\261\204\342\002\021\002\003\017\370\231\323\233\007"
+	.string	"\020\230\257\232\210\022\002\003\021\240\354\315\034"
+	.string	"\022"
+	.ascii	"1\013\2273W0\023\004\tf\202 \301\314\240\001w\270\005,\224)\260"
+	.ascii	"\301\324\341\032J(\254)R\224\252#\237\341\025`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`\031\001\205\005"
+	.ascii	"\262\206\022\026\2207\351\232\231\231\231\231qAD\270\370mm\033"
+	.ascii	"!\204\020)e\nO\260\025q$\235\t\240\013p0\b\017\243\3403)\272"
+	.ascii	".\261\204X\340v\236\255\371\244Zz\226c\351)\265R\005\t\334:\362"
+	.ascii	"\365\215\206m\373\313\337\007\023\t- \260\")\243;\210\200\315"
+	.ascii	"h\270\007\343\230\211\301G\273\330\004\261\322\005\"\325\314"
+	.ascii	"i,\270|\307\020081\271\375(l \3404K\202\0213\222\336pJfk\263"
+	.ascii	"\006CBH\003\343\024)\346\002\265W\0134\337#h\003@G\007\026\250"
+	.ascii	"\016nc.\210\306{\222\315\n\001\201\242\201\3621\220ec}q\207"
+	.text
+	.section	.gnu.lto_.inline.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`V\004\345\013"
+	.string	"\026Q;6P\245j\030\003(\337\024\300`!\275\205\340g\366UJ\032\250$\234\300\017\203ff\265\030\037\230y\236\023\025\356\242\252\252\252Z vwU\217\267\277\367\336[J\231\002)"
+	.string	"0"
+	.string	"("
+	.string	"\217\0346\212\360\223\303\376 ww\277\360<9\2312\205.\266\357d\206\203\252\205\311\177 1qdP\fU\253\224\371\313XA\217\240\037\026\311\244=G\037vA\223\005\335\b\212"
+	.ascii	"\225\363-\004##|\334$\212EBm\257\220\253U\205D\327Q\020\200Q"
+	.ascii	"(3\356}G62\032\275\320c\327\303\215y\037\207%A\"\276\256\211"
+	.ascii	"\t\251\261\273\222\257\277N\003\324d\366\r\273\353\371k\\\275"
+	.ascii	"\0335z\255\001s\026\210\211\323\307d\313F9vW[\240\222\251\305"
+	.ascii	"\251\243D\231\0220QI\247U\260O\006\222\372\210\272#\272i{\037"
+	.ascii	"&\346\222\355}\372S\256= \300\"\221\271\342\001\347\034\t@\272"
+	.ascii	"7`)\331Cz\300\233\004\352\303^SE\217\217\272\270\310\202\353"
+	.ascii	"\024\fd9\263\230\243wG\217X>\327\350d\312\302\201=\020\316D\236"
+	.ascii	"\265\330\362\242\304\224\3059F\032S\210&\030u\341\272\t\217\017"
+	.ascii	"\206\033[\020\244\016+\243>\"/;\t\354a ,\260O\001fL\242\256\377"
+	.ascii	":\027\201b\223\255\005\336\225\334}\371.\016\334\245c\t&\353"
+	.ascii	"\300\177X\342X6\302?\024\316\212\020ia\230\"\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`\227\002\005\007"
+	.string	"\242\n\037$\220'I\007\377\377\377@\375\377\357\237\272\273\273\343\333\273\375\032\376\375\030i#\302F\204\r\265f\t\331D\246\035U@\260q\2053 \207/\f\254p\005\201\204\200\243,\341\207\037O\200+\222RJ\tY\220\207l0N\201\270rn\036]\253\027k\327\320\271\326\bvX\346\315\365\364\202~A\334\030y\362\312\204-\276\326i\273V\225\226\250-qU\325x\300\032{H\207\337\224A\231\207* \300\3021;\007M\027\251\336\345\276\303\340\026\203O\026\003\271Vl X\"$\001\226\300\273\356\036s($\374ut\t\022\027\321\244\367\001`,\322g(l=\311\374\022\315e\360\021\324\3148\246\004\021z\214\034/\234\020>6\032\256\305~hw\344\211<\313#\214\224\013m\033["
+	.ascii	"\032\350\025e\b"
+	.text
+	.section	.gnu.lto_.pureconst.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\271\004\001\232\004\002\271\004\003\205\004\004\231\004\005"
+	.ascii	"\231\004\006\231\004\007\231\004\b\231\004\t\231\004\n\231\004"
+	.ascii	"\013\231\004\f\231\004\r\231\004\016\231\004\017\230\004\020"
+	.ascii	"\231\004\021\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`J\001\245\005"
+	.string	"\022\007\030#\220)\3510\377\377c\370\356\356\366www\252\236Q{\340?\310o\247\224f\300?\360\217\020\211m[\312\024\377\317H\021%\020\226C\305@)L\b\222AD\360\004\024\224 \200Y\331\031#\206\301\337i\274u\313\347*\177tB\235O\273\243\267\033\277\362F\357W\033\245\371X~\312\254\357\305\275\004+ 0\003\021\222mY\024\342+\003\013KV 0\334\201\265\202]\313`\302^\214\251\301\314 (\30470V"
+	.ascii	"\273E\032\261;X\024h\001\242\303qe`%\266\001\020\034\312\354"
+	.ascii	"eXW\020w\0377.\341\tB\226V\013\370A\323dV\026\322\346\020"
+	.text
+	.section	.gnu.lto_.lto.98006b62dfb52ccd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPrint.8.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`\256\001\235\020"
+	.string	"\006\340oF\360\262&\035\222\312\231\377\r\016\2311\361\330<\002\n\320Q\025:\243R\030b\r\255Ur\263\246\236\332\356\257\214\274\277\002\225L8G\nc\3253\360\f\274\336\314V4\216#L\270\365;\376\035\220n\204\220M\244L)Z"
+	.string	"W"
+	.string	"^"
+	.ascii	"\273\241\002\217p\217\016?@{\344.\242=:e\013\025X\001\320\231"
+	.ascii	"\341\341\261\273\236\212p\226\251\307L3\345g3X \314c\266\255"
+	.ascii	"jJ\204\200\253l\004\033\002\372\353I\003\2522\353y\336\330`\235"
+	.ascii	"\260\271\376u\004(b,\320\346\271E\330]'\013\344pk\267=\301\366"
+	.ascii	"\003;3\277\350;7\267=\374\343\303[\265t\306\364\003\210B\210"
+	.ascii	"\344\330\255\211\371\330\240\bd\342;\277}\237\347=vg\226\267"
+	.ascii	"\260\201\226\212\335\355X\354\356\361\177\2713\003\007\251\357"
+	.ascii	"\264d\333\001\302\n\327\320n8\362\350\221\235\241\213P\203\247"
+	.ascii	"}\235\263H\335\365r\001\273\255\037\031\001\272\351_O\260#\266"
+	.ascii	"!\205*[\207\344U\244\356\324\035\210\225\302\230\016\203\002"
+	.ascii	"\267+S\342\277\260pR\321\036;%p\303\365\036_\270\013\025nwK\374"
+	.ascii	"\037\223\023?\347E{\004\321\017$z\2708\275\252\215\317\314\217"
+	.ascii	"\230\214\251O\215\025\250\212c\207\252\374h\004l\310\332\262"
+	.ascii	"\271t\267\245A\356\n\025J\371\255\240\324TB!\255\240PN\234K$"
+	.ascii	"&\244\323gBy\250\317\224\341\364I\360PN\244\023\257\364\241<"
+	.ascii	"\222\003N\301`\372\274\225\224\224\317\353\302\230k+\336\004"
+	.ascii	"\305\250**\216a\272\251\263\214\252J\343\267h\234^\307\013\207"
+	.ascii	"L\302\234\312i\362\314\374\360ch =\307w\321\036S\223\006\215"
+	.ascii	"\207\005\327# \240\202\221:\333\001\242\300\352\215\305\255\310"
+	.ascii	"QBz\373\245b\314g\232\rS2\330\352#\373rf\371\332\242U\310y\350"
+	.ascii	"3\246\246\0250\215\310\022\334\262\\p\270n\003\306\303\324\037"
+	.ascii	"\004G\023\206q\241\2275\"\200(\364Z\\Z\241ea\357\264\353\t"
+	.text
+	.section	.gnu.lto_serialGetBaudRate.9.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\r\b"
+	.string	"\222\21777Po\322\001\2408\211Y<\207\366]XZ\006\323\202D2U\203j\304bk\b9\007\203\266\214`3\203\020\202\252\212\210\224\240\026\257\365j\343!f\274\303n\262wJ\001V\205Q\035\r\273\244+N\003uQK\233\032\265 .\3120\261\213r\230\025\325&\247\300\331\203Eg'\313\350\314\324\275!\324\200 \205\355\210\2238\271\273\n~\310\204\204\334x\364=\0203\002\275\222]?\017b\330\237\026\212\f_\3777aT\006Rv-J-\213\022M8lov\306\366{\366G\377\330^=\017\330\025\235\224\354\326\003\033\310GWi\333\357\270\307fn\252\032]\302H\205\b\313n\235\232\023\\\036\247\013\\\036a\306\271?\316?\3107\244\225P\367\371\003X\330]\277Pwq\303\333\336\330F\260M\022\f"
+	.ascii	"2\003\302\260\2268\3742\203\027c\273kx\306\004\016i\214\006L"
+	.ascii	"\020p\242G\265\322\021&\031"
+	.text
+	.section	.gnu.lto_serialWrite.10.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"U\n"
+	.string	"V\224H= \3458\035'\027\003,\341\006D\356\002\217\262\3008\315\021m\242T\254D\202\332\006\343;\321\353\247xi\345^\216o@\311\n@\b\024\240\241F\375"
+	.string	"\212\313\344\036\224\224n\306m\345N)5"
+	.string	"5"
+	.string	"9"
+	.string	"\273#\307\020\331\247\307o\260\317\354\b\330\247E{\200\302\311"
+	.string	""
+	.string	"\312\205\300\356nJr\361R\364\277\362\202\224\252tI@\261\273\226)U\310\255\267\355`\333c\377!\376\370cg\375S\245uJK\215\3643\255\265\231\331\005y\031X\327\2249\261}\315\266J;bB\374\310a\335\025\021 qi?\345*\342Y\244\037\354\256`b\002'-\031SU\016\352\300\305_@\331\356\207\307ou|#\354SjB"
+	.string	"k\274e\224\355\256\307g\021\205Y\t\t\373\2742\230\024`\231\344\313\036KRG\354kvw\255+\007\026\234\354\270\320G\024\206\274\314\\\007\343\343\201]\270\205`\267\341\201\025[\310\373\2006\016\f\267\316\202\277\214\016\334D\337\007n\332\270\327\254\256<Q\\&\365\260&U\247Z\252\033\002\016"
+	.ascii	"2\241O\034X\\p\300PJmn\351\254\322\342\316CX\351\032\020\025"
+	.ascii	"\006\203\271\001*J\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_serialWriteBuf.11.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`\204\001\275\017"
+	.string	"\366\335jF"
+	.string	"\221(\035\277:8\210[\212\204\377\016 \375\237(\376\007n\223\230e\340\337\221\215\246\365W \374n\326\032\022\242\364Y\351\321~\345\231\230\271\264W\004v\307\317\004"
+	.string	"\026\201\235\330\227\223t\f\341[\244\222\275\345N)U"
+	.string	"U"
+	.string	"W"
+	.string	"13\273\341\210E\270O\207/\260}r\007\331>\r\3325\020l\b\020\243\003\r\307\356vZ\002\004\025\374\224\032A\377\264wZ\257\324'\267r\351y\255\\%\b\213\013\033\217\027K.\260A!\342\264G\327k\025#"
+	.ascii	"\320\356:\266^!\356\355\266%\330\006\331\267\t?\367\332=?\273"
+	.ascii	"\345\214\2162"
+	.string	"\372\002\006\274\030\250\355\202\310\311\2615\023\206\313k\267\377\342\303\324R@+\017\020ph\330\330\rE>\355\200\373\374\307\266\262\270\f\374\3144\362cY$>\314\354\356\210\033p\237\td\fSr0x\264\257\342+\300\307TN`\027\026\237\350\321\216r\352\250\366hj8h\352c\304\016\231\236\264E\235 \233\301\2128\266+\\\206\304\355\262J\374\027\032L(\333g\324\020\031\276\360\030\024nwK\374\026\245\023gBe\373\274*Hq\023S\305\034;\\Em\261\177\200E\307\r+\314\376\354\367<\374;\217\005'G\2250\230D3\204\n\231HOT\n\241N\245\021g\021\211\205\320\350\363N\335\351\3632\214>\223\2564\n\221:\321w\352HBl:\361\276\016e2}\335'T]a\264?\270\251Q\351jj\213\017\363\b'dbG\247\272,\243G\245\272l\017{\024\342[\3364\365\r'\307E\006\036"
+	.ascii	"1\003\367\334Q\343\340\033_\031E\321\004\361\020u\026\372\337"
+	.ascii	"XK\316,\247\024\344\226\342\276\254\335Yc+\264\264\321\255M*"
+	.ascii	"B9\210\001\314\351\200\rh\242\004|A!\270\f\214\bPQ\304]\336\331"
+	.ascii	"dS\230k\264\n\n"
+	.text
+	.section	.gnu.lto_serialRxBytesWaiting.12.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\215\t"
+	.string	"V\222B:0\345(\035\236\213\247\302C)\301\244\034\326\275\322\031X\364\310?\022\005\233Jfk\246\377\370l4\210\301l\024\304f\302\300@\023\b\217}\2702\354 \324B\364\223\277\367\336;\2452"
+	.string	"0"
+	.string	"2"
+	.string	"6\305J\262z\030\300\361\022`\267R\316\013\346e<\301\274\204#7\375\231\374\263<\242\200\270T\253\323\237Fbw\375T+\217\033\336\266\202m\007\373\002\0011>?\370|M\303\307\301k\267\343%`g\244\314\211\355\222\275\261\375\236\375\326WJ\257\244\017\354\262"
+	.string	"\304\354V\006/`\227\256\230m?\345*\245!)x\262Mq\027\bFc\313\230\227\017&\370\342.\035\266\233\202\360[F\030\230\311\245O\232\227\207\006%-\324{\331\365\364\240\210\375\270\220\345\371\372\007\331'\344\021u!\r\363\247S\341\321\270\254\243\035\227\2154n\202\2064\017\210~\270\216v\020\274Yd\034\025m\033G7u\357\t9(\270\341\315\213\320\017N\030\021\016"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\q\3062\327p\221\t"
+	.ascii	"\034\250\361*0\361\340n\217j\305$L2"
+	.text
+	.section	.gnu.lto_serialTxBytesFree.13.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\255\t"
+	.string	"v\222C<0\345(\035\200\213\307V\035\376\266\213:x3\367W:\003\213\036\371\027a`M%Z\264\372\373\\c\rb0\033\005\261\23100\320\004\242N\213R\026%\340\324\263\034i{\357\275S\n2"
+	.string	"1"
+	.string	"1"
+	.string	"\246XIV\323\305\261\341B`\267R\316\r\346e|\301\274\204#7\375\231\374\263<\242|\fP\255N\177\232\210\335\365S\255<nx\333\013\266\035\354\017\004\317\017>_3A"
+	.string	" \004\330\355x\025\330\031)sb\273dol\277g\277\365\225\322+\351\004\273,\0011\273\265\301\f\330\245+f\333O\271J\311\001\360d{\3420\240\227\214\rc^>\250`\213\267t\330n\352\301w\215.0\223K\2374/\017\017JZ\250\367\262\353\351A\021\373q!\313\363\365\2171\331'\344\021u!\r\363\247C\341\321\270\254\243\035\227\2154N\202\2064\017\210~\270\216v\022\274Ud\034\025m\033G7u\357\t9(\250\341\315\213\320\017N\b\021\222\n\016"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\u\3062\327p\222\t"
+	.ascii	"\254\250\361:0\361\340\256\221j\305$L2"
+	.text
+	.section	.gnu.lto_serialRead.14.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"u\t"
+	.string	"\346\322C:0\345(\035\200\213'\205hR\300.O\036\"\256\231\016\033\033\356I\312u\364\327\252\325\337\357\265\330 \006\343\025\304f\302\300@\023\330\270\023\363e9\232\204\271\352\311\337\233l\231R2"
+	.string	"1"
+	.string	"2"
+	.string	"\332\007\346\245m7<\230|z\030\302\232\036\033\0310"
+	.string	"\273\341\026A~\272\236\374\247<3\341\210Y\265PWM\304\356ZW-\215;\336\266\202m\007\373\016\236\177\375Y\246\326\250\276f\226\314\030\270\354\262b\001VF\302\220\3306\331\033\333\252\366O\216b\372\253t\201]W\313\313n\310\340\005\355\322\341\t\346e(\333\240\303<mW\325\361Y.*H\363R#\202\301\257\220\264\335\355\370*#\013m\344\322/\315\313\307\002\221WJcv\210\322\370a?\333\335ut\005\334'\344\021\201\241N\363\2073\341\351>\016\334\300\217\033u\237\304\026\352<\240\355\363\201\033\347\300\036\005\367m\"\317\373\266M\270\367\214\t\251\210\341"
+	.string	"\315\2425\316\b\321\241\212\001\n"
+	.ascii	"2\003\302\260\013\314%`oJse\031\313\270\214R\324x\250\016aL\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_serialReadBuf.15.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`\234\001-\020"
+	.string	"v\236mG\360\222(\035R\355J\226\361\2231E\025\1770\001\225:\222\026\313\257egG\324\373\360\006\304]\272\301\377\255M\f\376\020\354\370j\n\026\230Y\"q8\220\235/\307\277\276rw\365\353\277\333:\272\254\225|\262\267\334)\005W"
+	.string	"X"
+	.string	"]"
+	.string	"!\334\251G\316\266_\342&T\016\347\bB\334f1\226\0248\265\216]\202\033\330N\347\tl\247\373!\224\341\351\\\031\372\037qu\312\265|\222pp\361\022[\276\023\001\313\017\021!\3215\025\340\254l^\273\204\211-);#\265V\313\227\250\341\336n\233\3046\004\373>\002\240\317\374\237\217\277g\223\356X\232\236vO*-\247\364\003l:h\034\310\251\025CN\217zCmF\234\366\333*\277f\220mZ\310\2552p\265\331K\216Z\307\220S?\340\344g\302)\240\272<lp\2602\026v4\220\322~\314O\250>\252|@\255\262\232\027\265\216\f\034\242\0323BL"
+	.string	"\362\263\240\365\254\345\206\266\300\n\214\233\225]\241\300\361#\266%\233\334\b\263\033.\311\303v\351-J\270Z]\"\237\305\205\223\224\355T.\210\r\237\276\"E\344\323\230L\340j\255\1779\365U\266\323\357k_ \306 \021\303\2229\366\330\222\353\202S#C\205W\026\272\314\037$\357\003g\312\204r\032Q/\345\221\34672y)\224\251\304y$b\342\225\300\017\325\241\300\217B\t$u\246\222w\322\215@T'\002\342\223\204\017\354R\247\023\330\201F\326Wf\317\331\361t\200\211mh\351\302l\323\365\bk[4t]\\\001\246F\372\3416\027\346\017E\376\325\331-\037"
+	.ascii	"\017\023p\323\341\244\026\030\243)\013\230cTjG5\006\250tX\270"
+	.ascii	"i\265\241\024\214O\341k\213%\256qL\304^7\016&,{\026%!\215!\314"
+	.ascii	"\220\017\314\201\300@5p\005\314\025\250ppW\220j\360\246\320P"
+	.ascii	"\rAs)("
+	.text
+	.section	.gnu.lto_serialSetBaudRate.16.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\255\n"
+	.string	"\266\324J@0\251(\035\300\347\217tI\364i\250\236\234w{\327\342\031\361d\320\211\247"
+	.string	"Y\364\364\275\017\373\026g\221]\373\3111\332G"
+	.string	"\332&\250\244\302L\310\205\342\025W\255\346HB\373\217\356O6\331;\2455"
+	.string	"8"
+	.string	"9"
+	.string	"a\205)\350\247\303;d\237\364\r\331\247A{\302\303"
+	.string	"{\025\001\222\025\205\335\255\022\300\301G\320\277\352\226\222i\364X\301\330]\307\222\311\344\226\267=a\373\302~\rO\375\363\250\037\303\242\243\214~%sA\200\210\260[\362r-k:\030`\373\027\3331\374\001\360\251\017[vQZ\026\364S\002{\264_\340\006\300\243Dg\330=-`\260\033\322\227\223\0219\262\315\271\202\216\356\212d\374\004 \036\241\3543\312\007\t\376\216 Dw7\343\257@\037*@\224}^\312\006\017Z(R|\331\341(\312\024\373\330\356\256\345\311\016\233G\323\330|\264\r\272i:\232\347\353p\324\032\f\207\306y\333W?o\003q\336\246v8\215S5\336W1\021\356:6\257z\272\316\253\227p\217\255<9\243\002\213$C\274\020\247\304\244c\017"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Y\013\241`B0\327\330b"
+	.ascii	"\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_isSerialTransmitBufferEmpty.17.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"m\t"
+	.string	"vRC<0\345(\035\200\213\007\323e\310\037\214/\003\215:\334T\310\315\334\364\033\3022\345\020\215\355\365\037\237\215\0061\230\215\202\330L\030\030h\002\2059\017W\006:\301\260Y\216\264\275\311\226)\0051"
+	.string	"1"
+	.string	"1"
+	.string	"\004\362\321\266\031\034H.\375\033Q\035\304e\303E`\367\233P\344\245k\311\277\312\261\023\017"
+	.string	"\251\225\351\232\211\330]kj\305q\303\333N\260\335`\337\001?\206\251\025\252\237\311t\b\330\274\354\252^\0056@\2141\261M\2625\266U\355\243<\205\364\326\350\003\273\254\0010\273\337\202\025\262G\177/\220\217\331\003\320d{\342\256OK\006\207!\037\025\036\330\342,^\266\213z\360WD\027Y\311\243?\222\217\207\006$\255\223\276\354\317\2440\304>\266\273k\310\262|+\232\007\324\ty\240-\263\207C\321\331:\315\233^\247\211\266Nb\202\266\316gz:or6\346*\264n\2068\256\233\232oo\t\021NP\303\032\305\240\025J\b\361\201\n\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_serialSetMode.18.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"u\n"
+	.string	"v\024I=0\345(\035"
+	.string	"\276\236\177Q\212\265V\264\321a65\234\207\013\274\215\037y\330v\260&\2525\334\3077\335 \006\343\025\224\354\206\201\001\215\241\243\360\242Ej\235\274\002C%\237l\262wJ\0014"
+	.string	"7"
+	.string	"8"
+	.string	"\nN\340N=\276`;\345N\260\235Z\264e>~\354a+\030\261"
+	.string	"\273[\247\307\305K\321?\354\233\025+u\251i\330]\313\025K\343\236\267\215`\233\301~\r?\275\353\3274i9\245\257\321\210\274t"
+	.string	"\354f\314\006\254\214\272\204\330>\307\266\034o\"\3765\341\315.\307\314\002wz\240]\332'y\211x\027\352\003\273-\025\226\3351\033\0273e{\364\224\217\333\265\370\370(\024\021\247\355TN\203\030\207?9q\273\373\361c&\t\016\004\265\235~\316\026\030\001.\225\234\331cJ\316\016\373\332\356\256g\313\376+\235\350\033i]\210\004*\205$\217s\310\363"
+	.string	"\362\300.\254!\330\231<PTI\036hTC`X=\035\177\020\035XK\337\007V\316\270\327v\266\3540\"S\315\n\013H:\265i9\315\t\017"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Y\013\241`B0\327\330b"
+	.ascii	"\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_serialSetCtrlLineStateCb.19.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`\n\001\265\f"
+	.string	"F\327TB\020q\233\016\030\0020}\237^=\027`\270\202uD\234\220,"
+	.string	"\340\302\253LP^\220\025S\251\003\275\036\362\273\243(n\344k\273\250D@\001\024Z\320s8\316\001 \036<\024\305\377=5\332D\312\224\002?"
+	.string	"B"
+	.string	"?"
+	.string	"\323\243;\373\306\301\020\3730\006\006\225\034\273k)\210w\2274;\377\341/%\037\350R\207\253\2241i1\022\360yR\202\021\212\207\207O\r\037I&\345\261\273\316\222\217\303\035o\233\201m\017\373\237\237\036\372cL\247\224\376\205Z\241\241\231\261\273\241e\307\212\342\312\b\333\307\330\326\024\333`Y\220`\005\003\003\326\0133p\236\366M\374D\367\220\310\t\354\236\310p\261\013*0\202\352\321\340\013L\217\3253\001S*H\310\342\245\016\333\017\316\302S\355z\034\177\205\205\3543=\246jjX\302S|\252\335\345\370*\334V\211\020\231\036\257\221\004\216\022\241\221l\261AP\352\007\373\322\356\256\365\304~\312O\035|\034\005\214\013\311.\n\344JN\313\032"
+	.string	"\360\265\201\360\321\321\260\315\3324lBGs`\205t><\326\245m\326\346\200\263\b\230fqY\246Y\030p\017C4\242$\022&)\2354\252S\035@\005\n\321\005\005\345\b\305\344\205\332\023\032"
+	.ascii	"j\231\"34\030\271Y\200\330\rJ1\313\032\325,\b\214#\304\"\023"
+	.ascii	"\206R;b:@n!pL\b\353\032\233\016\343yU\016\\\001s 0P\"\030\021"
+	.ascii	"\240\242\210\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_serialSetBaudRateCb.20.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`\t\001\265\f"
+	.string	"\366\226TB\020q\233\016\3600\350<\217M\316A\005\357\3601l\241\263\t"
+	.string	"\270\360*\023\224\027de3Q\240\327\313s\306\242(n\260\234]T\"\240"
+	.string	"\n-\3509\034\347"
+	.string	"`\016\017U\347\370\377n\264\211\224)\005?"
+	.string	"B"
+	.string	"@"
+	.ascii	"\217\356l\032\007?\354C\031\027"
+	.string	"\\r\354\256\245\036\336]\322\354\374\207\307\244|\240K\033\256\322F%\305\b\300\347I\tF,\034\036>1|(\231\024\310\356:S>\rw\274m\006\266A\354\227\004\007\377\351\241?J\351\324\3641\224\r\027\007^\354fx\351\261\242\310\"\204\306\366[>\004\002\254\027\316X\220 \005\036\235\247\375\021'\321=\364\271\200\335\225\026*vA\005FP=\032\374\200\351\261\372f\n\316\246T\2210\206\227;l\217\034EV\355z\035\377D\205\b&\323c\252\001\030\336^\302\244\332\335\216\357\302I\250@|\246\307k\024\201CG\350$_l\020\224\332\301\276\264\273k]\261\337\362S\001\334\004\214#\311.J\344JN\313\032d|q\036\204x4l\2636\r+\361h\016,\022O\310\210ui\233\305)\340\f\002\246Y\\\226i\226\006\334\337\020\235(\212\224IJ'\215\352T\177\230\250!\262\240\240\034\261\250\254\320\033"
+	.string	"j\231\"34\030\271Y"
+	.ascii	"\330\rJ1\313\032\325,\b\214#\304\"\023\206R;b: n!lL\b\007f]a"
+	.ascii	"\315a<P\"\030\001\341\202Bp\031\030\021\240\242\210\273<U\223"
+	.ascii	"S4\265\007"
+	.text
+	.section	.gnu.lto_serialWriteBufShim.21.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"u\t"
+	.string	"v\322A9@\3056\035u\332@n\035\240T\244\233\365\337\221\004\223>\242_\300\350\306\274\227\234\243)q\034\243\224R\340RB\034G\301}\345\316\207\232\276\004\260\013\306\037\267\221\266\345N)."
+	.string	"2"
+	.string	"/"
+	.string	"7\250NY/\250N9\264\001|\f\331\203L\033\242\322\356^\n\362\3602\364/\272\200\330\341\\Z\036v\327R\354t\334z\333\n\266\035\354k\024\212\210\355_l\253\311A\341CN\231\003\233\341!\216v\027\343\006\353T\302\224\243E\211\341\322\376\310I\302\177\274r\202]O\311hw\304x\301:\3451\212\341JNU\225jo*\344E\313\023\001$\r\345\330#G\352\207\375\271\273k\365\330\017\375\363\343\257\377\374\262\262\fPA\b\260\313q2-) \267\3512\n\0031\315\3242\016\003?n\263\234e\"\260\315\323\276\353\3634\212\315\323\\\334\206I\\\231\367]\231\003w\023\232w\201]\347]\227q?W=\2068\221.\002\016"
+	.ascii	"2\241\017h\340\341\302\033\327\200\001\033\235\022b\300\225%"
+	.ascii	"\214\013T!\270\f\214PPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serialBeginWrite.22.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"=\013"
+	.string	"\226UN? O\234\016@\017 E\013*)\360\224D\200\372h>P\211\t\016\345j\270SP\351\365"
+	.string	"\315\"n\214\335\0303\017\362:m)\300"
+	.string	"\n"
+	.string	" \017\353^"
+	.string	"\314L\027\006\263@\177\332D\312\224\002<"
+	.string	":"
+	.string	"<"
+	.string	"~q\220\303>\264P!\204\261\273\227nxwJ\263\363\357\361H\350\363\234\312p\245&#\023\247"
+	.string	"\237G\0318ul\334\343y\341\003eB\022\354\2563\364\211\356x\333\nl#\260_\t\324\356\256\225d\277\364GMg\246\017\321\330`A`\305.\206\217\031k\212*<Hl?\355\1778\210\356\245\316\005\354\222N\240\330\005\017\270\200\365h\360\003\252G\353\223\352\321\235\003)T9lk\252T\006#\\x)\303\266\366Pc\355z\026\237\004\005\216S=\246RZ8\302Ep\254\335\265\370!6\023\254\016\217~\247z\274FQ\030\243\364\311\017\033\364\244r\330\017\030&s\331p\231\3142\246\342\340\222m\030wq\033&!\333\032\\\231\354\362\340\302l\334U\241X\203\200m\327F\323\266K\002\356\251U\222\027h0}\024DE2\252S\r\240\304\310\344\251'O\035\243\020"
+	.ascii	"3\241\025/F\326P\020\263\227\320V\343\2209\306\004\254\324\216"
+	.ascii	"\230\016\3302A\024\214\272\204\325\254F\213\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_serialEndWrite.23.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"E\013"
+	.string	"\226\225N? O\234\016@\017 E\013*\001\236j\031\362_\265\371\310\252\204\b\343\262\200$73\210B|\213\2701vc\314<\310\353\264\245"
+	.string	"\003("
+	.string	"\200<\254\373Bp\241\361\226\007\342\033\321&R\246\024<"
+	.string	":"
+	.string	"<"
+	.string	"~\361P\303\376$\252p\202\261\273\230f\270\367J\323\363\337\361H\b\364\274\272p\255&$\217T"
+	.string	"\360\253\f\24480\274\343i\001\004eB\022\354\2563\004\216\356x\333\nl#\260_\t\325\356\256\265d\337\364GMg\246\017\321\360\300\202\200\211]\321\307\214E\305\025\034$\266\237\366A<\204wS\347\002vK(R\354\206\007\\\340zt\370\001\326\343\365\211\365h\317\001*T7lk\254T\006$\\|)\303\366\366\223\346\332\375,~\t\n\035\307zL\245\264p\204\217\340\\\273k\361El&\\\033\036\375\216\365x\215#\217\030\246O~\330\241'u\303~\031&s\331t\031\3552\246\342\340\242qY\207u\\&A\343\032`\031\355\362"
+	.string	"\303p\035V\241x\203\220q\330f\3338L\022\356\253\325\222\027|@}\024TE2\252S\r\340D\007\324\247\236Lq\220\002\020"
+	.ascii	"3\241\025/F\326P\020\263\227\320V\343\2209\306\004\254\324\216"
+	.ascii	"\230\016\3302A\024\214\272\204\325\254F\213\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_serialWriteBuf.part.0.27.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`\345\003=\033"
+	.string	"\2462\256H\260XQ:\320\001\030O!0$2\305U$%;@\002\305Z>\034\371\207\332\242,\024Q\343\023v[Z\\OI|\365\301\016\230\217\352Xh]h\275qc(R\271\013\374\203\303\370\364\214\003\330[k\204\220M\344N)\223"
+	.string	"\237"
+	.string	"\224"
+	.ascii	"Hl\213\304f\306\301\234\367\335n\004\350\306W_\020yN\373E\236"
+	.ascii	"\204\273\021\240\003\250\325hI\260V_\316\251[\345\251}'0\236"
+	.ascii	"\226\0270\236\332\037b\373f\207\271OG%2\316\016s\263cA\r%!Sk"
+	.ascii	"u\235n\016\257\311\341p8\274\350\273\307\305\235\034\251\270"
+	.ascii	"\263\304\371\007>\305\242\027tr(7G\325\217\030\2476?`\\\024\311"
+	.ascii	"\235\213\0365\275\235\030A\030\325\364\340'\257\247\233+\340"
+	.ascii	"\263\300K\262B\255\325\317\311\270S\267}\303\366\005{\305\004"
+	.ascii	"\363\276\377\003\256\200F\255.\206fj\021m\362q\246S\261\fGg\303"
+	.ascii	"B\207\004\025Uu\276\226\355c\331\211\006\254P\372\361\\\247\207"
+	.ascii	"\362\265\357K\371\223\317\2378'\210\020\037{\305\344N?\177\342"
+	.ascii	"GA@\344P\334\340\301\355M4\234 \233*\364\005\252\301\203\237"
+	.ascii	"7\321n&D\231b\241<\365\231\276\304\017\336I\023\333l\001}'Ml"
+	.ascii	"\025\204Vd\020~\211\252\325\327:5\205\362g\372\300\233\275ZY"
+	.ascii	"\234_\272\371j\217\310b\222+\341\256\304N\242M\325\341h\021\254"
+	.ascii	"\265J(Oq\304\235\377\005<\246$\215K\356\301\f\235\361\263\324"
+	.ascii	":\370H\276m<\0357\025\204\2117#7\207t\225H\331\365D\313Fq\037"
+	.ascii	"|\200,C~^tSh\002\363\353]q%\024\3516\310\303\261|\200B\001\242"
+	.ascii	"g<\335M\260\343O\016q+\"\312Zu\020\374*)^>\022l<\235\373\247"
+	.ascii	"/8\242T&)7\207\336\213\265\326\272{\344}\004\035\302\250\271"
+	.ascii	"F\336r\024\016}x\215\354\377\376\232/\3754\254\325\227n\025\315"
+	.ascii	"t*5]\212\323$kz\244\253iQ5\275\251\351$`\323\304k\261\037\031"
+	.ascii	"\214\276"
+	.string	"j\257\021\342\016,\366\252\321b<\245a:%^<\263\035\232\2136\3339\3013\033\341\212\361\274z\\\260\031\315\245s\3002\023;3WM&\233\271V\266\347\327\bx\fe\260\344V\210\334#\223T\312\032\027\220\262\226.\317bI\2634B\272Z\325\362ZW\355\034\363\273\262\247\200Chc\334#\333\fN\227\265\244\026\025@t\256\332U\316\030.*j\b\315\241\rLr\277N\255WE\273\r\322\360.\033b R[\300\213\223C|KOYk\205\340kI\301\001h\357\364\007Q\250Q4\246\034\"\304\231\t$\222\231\031\247\003p\002\231\272\272\r\020hH6\035k\372\201P\002\207]\364A\311\\M\212TV\234\300\217\n(0\nF\267\210\265_\222\007\303\002\22784\320\240 \276\231c\220\240mZ<\201F\335cA\3420H\2773.\323\202\t#\326\003k\031\326\030\220P\037E\211\242l\201\220N"
+	.string	"\225\237"
+	.string	"\224.E\203KA\264D\b4\322\342\322,\357\327\214\304W\204\210/%\316d\360\025{Q\210\374t\221\224\330\234"
+	.string	"\317;\345qx\277p\003\302+\032\215\016\266y\326ku\206v"
+	.ascii	"\323<5b+P\001"
+	.text
+	.section	.gnu.lto_serialReadBuf.part.0.30.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`\244\003\315\031"
+	.string	"&\256\242I\240\230Q:\300\371t"
+	.string	".]]g\330\330\033\363w\260c\326\214\354{\004edd\016\334\3014\226;R\226\177\372d\207\255\225Cp\367\366=X\205\347\303\25305v\264\302<\276\322\220"
+	.string	"\027\254\364\375\317f\244\021B\344N)\210"
+	.string	"\223"
+	.string	"\211"
+	.string	"\240\222\216\026\006K\237\224{o\207\300YM"
+	.ascii	"y\251}\036?y\336\333y\200Z\211\236\240j=\023<\264\314\370\320"
+	.ascii	"\347h\177G\016\3509\256\203\307:\360t\301\023}A?KYj=a\017c>@"
+	.ascii	"|\b\036F|\270-\f\340\367\373\375\016\236\367R\335\305\020\\\252"
+	.ascii	"\322\371\274\236\213(\036\222\274\035\005\301Mb\222z\361@\200"
+	.ascii	"\016v\340xq\247\323\021<\223.\213\306\211S\230\253T\020j\255"
+	.ascii	"\036S\334\343m\357lG\2607*\016\277\364\203#\365\322\017\b0\243"
+	.ascii	"\243\326\022?.U(\034\"\343A.\345\005\rr\306\031\353\f\001?=|"
+	.ascii	"AS\013\032\334\214\243@\300O\217!\025Eb\314\027\021\346P\320"
+	.ascii	"\214j\23629\326I\270\220R\215.Sk\337\037\362\250[\217\024\216"
+	.ascii	"\233/\344P6\351\234?Y\3253\222\245\326J\346\230\372Ar\276\223"
+	.ascii	"I M:\307\230<>\020\223M\272\261\007hd\362\031M\325z\312<\364"
+	.ascii	"\203\361!\275\217\334Yy\246g\322\201/\325\034RQ\003\322/)\351"
+	.ascii	"\0047\362u\304\207JV`\021q\005\206\212\353qW[#dn\017\2063\311"
+	.ascii	"0\326j\322\370K:h\270\331\003/\220vQ\216=\311\315Xk\245\361\221"
+	.ascii	"\2242\337hG|\250\332G\035A\317\351\bi\267\340\206\373*!j\370"
+	.ascii	"\354\356\177\272\354\350\317\277N\374\322\275\323A\"+\260\204"
+	.ascii	"\b\362\241?\357\367\007\013\242#t\213\274\252\323<I\002\303K"
+	.ascii	"d\273\250_.jW\213\272\265\242&\357\343g\221\324+\026\365\270"
+	.ascii	"\242V=\351\027A\0326\261Y\t\342j96Y\030\303\305l\300\231\254"
+	.ascii	"\026\303\335j\264\321\262\031\0161Z9\273\301n\345\314\003\255"
+	.ascii	"\264\201\325h\261\033\230\254\274\301f\f\330\326aV\302p6[\t#"
+	.ascii	"c<\374\276^k\b\273\365\021c\204N\356\332#\0227|S\n\264\3265\341"
+	.ascii	"R(,\331\240\241\005\345\330\243T\200RZ\270 >$\367PG\320S:B\332"
+	.ascii	"A\241\222\324\004n\221?\330xR\331\205\r+\224\356w\004k\2775$"
+	.ascii	"n\370\224\230t\213\367`\255\265\356\026\331^\255\337\004\207"
+	.ascii	"\343T\250\201,\306\2302$\240\021\221\031\231ia\033\220\002!\272"
+	.ascii	"1\017\020\200F5\255\001\351\202fI\225\274\212t\337\210\032\250"
+	.ascii	"z'L&\375<\301\357\235\355h\370\t\326\234c\354\223\362\337\317"
+	.ascii	"\251\207\325\0045\372\bAW\271\212\216j\223u\347S\303\035k\236"
+	.ascii	"\335S\353^\321\006\323)B\344\254\335MJ\003@\261\272\321k\004"
+	.ascii	"\275\016KyA.\240\300\031Y}\240\2002\f\031\020\fu\034=\221O\222"
+	.ascii	"\007\373)\350w\332\313\330\253\311\270$\033)\350\031\254\251"
+	.ascii	"#\273\311\370k\003?\005\357\266e\021DC\272\370k:\024\315K\361"
+	.ascii	"~\373|\367\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`\177\001\275\b"
+	.string	"$\f{\002"
+	.string	""
+	.string	""
+	.string	"\002\033\177)\257\377\372\006\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \036\177*\252\333\3426\b\177+\360\372\2508\272\200\202\t\177,\200\200\200\200\004\n\177-\013\177.\362\375\231\027\f\177/\r\1770\016\1771\017\1772\310\331\316\370"
+	.string	"\020\1773\021\1774\022\1775\023\1776\024\1777\025\1778\026\1779\027\177:\004"
+	.string	"\265\006\004"
+	.string	"u\004\001\312\302\353\343\003\001\225\007\004\001\330\244\235\311\003\001\325\001\004\002\221\205\327\307\003\001\225\001\004\004\225\001\003\005"
+	.string	"\342\001\004\005\303\376\236\020\006u\004\007u\004\b\003\t\001\302\001\004\t\236\376\353\301"
+	.string	"\n\013\f\004\r\321\231\263\346\002\016\003\017\005\"\004\020\004\021"
+	.ascii	"& \360\242!\2536\025\301\0072 \033\323\320E\203\315\027a\221"
+	.ascii	"\2205N\200\274\203\346\221\216\341\\\020\301\331wuT\034O@C\376"
+	.ascii	"\\\030z\370\306o\350\033\3537~\3437\364\2151\302\367\r\3217\372"
+	.ascii	"\r\0311\367gO@\003\342\314;\022\006\335\314\326\031\003"
+	.text
+	.section	.gnu.lto_.refs.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.98006b62dfb52ccd,"e",@progbits
+	.string	"(\265/\375`\216\035\235z"
+	.ascii	"z\303\314*Q RJJ\007\276\276\257Z\271\021\363\313|z\324u\276\177"
+	.ascii	"\246\357\327\356\356>\333tU\325\226\021\361\212\210]&}\223\377"
+	.ascii	"\255E\304\304\313\206k\216\313\367\351\021\002QiUUU%$D\005\201"
+	.ascii	"X\265Z\231V%\244\254DX\376[\353\334\016B\244L\001"
+	.string	"5\002\225\002\260\002\276\333\235\356\313\3263L\263\357\321\2728\217\231\366\240i\262\203#\346<\365y\236\251\2016\313a\342\226\326\2124\313\\\330-/J\251\315\255m\365B2\221\2048\267\351P\271\230Ui\226\301\360\230\016Z\0300sl\2760Mzo\232\345.\354\205\301Tp\020\347/\274\366\035d\364J\357\215\376\354\304\261\031R\326\354\t&\341c\211\332\263\n\337O\265Z\255\262\n\337\013ji:sYIbh\347\264\0374t\316\257fy\013\217\345\\\30126\313?\\\215\b\2738M\274{a\245\324\250\2705\373\024\332GAh\1776+\3439\222\246\rJv.\373#\240\340i~\367V\271\367\232\340\311\022R\254\322\354\355\276\2633\275\273+k\366\347\261\237\251p\025\306\262&\227\232\267\354\336h\320\272\306$\004W\263R\326\352\254\013[\263\277\240\005c1\016\273%~XG\254\3124{\027\3559z"
+	.string	"\336.\005\027\321\276\333\247M\243L\302\3272"
+	.string	"\276\021\037A\300\277:"
+	.ascii	"\003\213\340M<\013\370\327\004\034x\262\343?\331\317*^v\236\177"
+	.string	"\025.\257\363\257\301\377b~^1m\353b\341?\365g\005\352R\370\217\3673\003yvZ'\374\274\376\234\202\345\0218\201\020P\374\334@\212\237\021\210\362\371\327\006~\356\371\031\002\037\021\377\372\001\213g\007?\007\375\274\300\210\031?7A\371\217\366\363\003O\323\361\237\177E\361\337\277b\360\263\013\317\371\327\013~\236\341g\001~v\321\002\227\340\361\277\306\201\376\225\202\237\237\374\334\344g\257\237\273~\336\372Y\353\347\254\237\217\374\034\365\263\221\237\237?\027\371y\3713\221\237\261~\266\372Y\352g\247\237\177\374\234\3643\322\317\310\237\217?\033\177.\376|\177\346\341\347\241\237w\370Y\207\237\205~\026\376o\373O\364\237\356\277\335\317\277\3775~\316\341\377\332\3178\374|\303\3176\374\354\343\347\032~\246\341\347\036?\023\177>\372y\370\363\001?\023\375,\303\3171\374\254\343\347\b~\316\361s\360g\t\376W\360_\210\377"
+	.ascii	"T\253\325\352\237\343\342_c\370I\f\021\354S\237\375\232<5-i\366"
+	.ascii	",\262\263\254z\355W6\355\327\270\366+[\3735Mz\261\034(\2230\272"
+	.ascii	"\351\317/\016\025\270\"\315~%k\277Ni\277*i\2776\333\257P\355"
+	.ascii	"\247L\302\327T\244 q\341\242\365\246=\203\365\224\226\342{\263"
+	.ascii	"r\307:\312[\212\222-c\2144\333P\030MuK\233\227f[M\373\2366\371"
+	.ascii	"b\177pI\317\276\274\232bA\030\233\215\"\307\236\314\250\315\n"
+	.ascii	"\265TW\201\241\376\275\325]\235\244\2254W\037i$\255\325FzI3\351"
+	.ascii	"\254\356\201\301\032\332Vo!}\365\022\321{\221\367\336K\260l\250"
+	.ascii	"\243\033\265\177t\262\233\340"
+	.string	"\304LM\341\235ia\2657\320+>\260\031O\231@\027)\266\007=\003\202\307\340Y\351!\375\f\202\224\274\222\205\315~\034\365\250p\364\032\tF\322r'\tn\216\372\306l\370\215\3161\215PTC\361\224\031\275O<\307\266\251)<\256\362\363\033\303\361\032\023\307\344e\305\324LME\2717z\t~\206\003\355$v\203\221\264\274H1\260\030X\260p\021\203wotE\211\025>JTfs&\236\316\037\2352\bY\221\267\223\207H6\365\320l7y,\f\223\257+\3156V\023i\363\334\273D\224\r\347\266td\322\372n\246\261\252\232\351c\207\005%\253\251\336\314\226\f\236\036\220f{\212\307\232\253\013\325W+\237ws\375\324\236\367\240\372\211\271\267\304\315\351\375\304l\277#p]\317f\345\232\232)\2028\250\262\201\274\231Z\031\305\026\226\325l\007i%\0063\240\227\326b\330\255\322\023GJ\0348p\355\331"
+	.string	"\037W\331"
+	.ascii	"^k\201\306\332\277\221\032\331\346y\211\312\253\276\221m\354"
+	.ascii	"I\233\332\332\322l\033\273\213}|\033\373\376\220\3216\262\367"
+	.ascii	"\032\231Q\3700\243\310\361\242\304(\346c\317\321\366v\034\347"
+	.ascii	"\027-\3364q\366v\326\314\311!\243>G!P$F\332\023o\362z\266`y!"
+	.ascii	"\301;\347\261E$\267\275f\331\315\217\234\022Zu\367\364%\315\251"
+	.ascii	"Y\266\373q\243l\023W\325r\233\263a\315\236\3258\345\206\326\354"
+	.ascii	"\331iM\235\b0\247%5\352\271\216M\032\303\325\245YV\303\203E,"
+	.ascii	"H\265Y\036\202\323\260\201R\323LC\367\263\342\272c\233;\323\365"
+	.ascii	"\220\253\204l\226\345N\227"
+	.string	"\223\344\251\310\006\r\353\303\0273\253Y&\303q\f\226\202\313\234\315\360\231\347\030\2437\332\\{fb\315\0021\t_s\262=\247\360\255\325*\247\bg\271\264\177\377\276k\\\336{\237r\242wy\374\235s\270\207WF\340?{\327\377\003\214poQ\213V\233\366\013\315(\344'\356?\275\027\351,f\340tB:\251\222R\347-\"\227\024\203\226\327YLJ\357\r\272HdQ\203\346\rJJ\257\323Ezs\342\033u\026/\262y\203.\362\032O$\221N\247\244\324\350\024\224\224:\235\256\324y\201.\322\270\004\202\274\313\240+u\326]i\323\t()m:%\245N&\243I\302\3359\221i=\225<&\211\274L\312+\343\022h\232\2146\257\231{\271,\351.\021\270\367\252\2714c\244\342\264\343\224\351\250\305\330\344\001\224\307g\363\"\247\311&\315{\233\034u\\\345\004\305\350\364&\341i\321\310\325]J\272\227"
+	.ascii	"\345\275E\276\323{o\361\336\253\263\274\212\336k\005\224\204"
+	.ascii	"*\225\3672K(\357UQ-\351\336.C\223\346\224\224>\233BjcR\350\375"
+	.ascii	"\021-2\364\232q.[i\021\354.\335{\231M\013u\202ZcV\266.\261\\"
+	.ascii	"\211\216\231\266D\270\336\234\254\251\373\271\261;2\327l\020"
+	.ascii	"Z\\\322\254\264*K\313\207T\002u\244\243d\200P\2416\253c\027-"
+	.ascii	"\222\254b\356P\313\234\254A=\261N-g\252ML;\313i\\\230/\257\250"
+	.ascii	"\b5kf\230zf*\334\206x\2013\246\215\310\331\335\275Y\3033\304"
+	.ascii	"\262\211\224\307o~\262\250vfx\215\324*\221W\\n\330\255\212K\031"
+	.ascii	"7}\327O<2\316\264\266S\3639\321\362\325FE^\3341\n\2335?T\242"
+	.ascii	"\262\272\356\317\216\032\034'R\315\266\232\246\276\353:\315\355"
+	.ascii	"\272\t\232\367\032\273\356G\357^\343\0173\nf\024\354\224'\223"
+	.ascii	",>\366l\022\272n\252f)\315U\361XiR\241\222C\303f\354\222z0^U"
+	.ascii	"\177\364\2316\023\304J\033\264\350\257\251\211\253Y\006j\316"
+	.ascii	"k-*\216L\231\363KM\263\322\266J\306H\232f\317\236t\225&\261$"
+	.ascii	"\324\265\350\020\350\233\017X\320+D\250W\276t\227V\256Q\250\016"
+	.ascii	"\331\263\013\213U[\371\205\314ZK\026\270%j\031\223\320\226V\203"
+	.ascii	":\0029sr\272\2551f\363A\002]\344\263\n\nv\365\245\303Z\252\004"
+	.ascii	"'d\332B\364\020=\246\337\032\256\331z\255\3054\230\016\242\335"
+	.ascii	":L{\3516\006\353/\034\366\006\242\271\360\032\031\263\255`\313"
+	.ascii	"\226L\214I\355/\375\003\337\371 \243\327\211\347\25045Ub\305"
+	.ascii	"\n\035$S\264\366N\260g\261\332\234\265\267ZZ\031\330\034\032"
+	.string	"\326\253\f\032\223Fk+\337\0258-0T\355\003A\242p\270\302P\321\0062v\bu\320\030qc\006"
+	.ascii	"%h\364\324\b:\n\022m\220\341\003\205\016\212\204C\023z\0028\016"
+	.ascii	"\037\027,\210C \017\0269z\310 q\034"
+	.string	"\302a\260(\bC\373\t^@\360\002\206\017\235\303\210\341\"\206\013\337a\304\020\022\212\361B\250\375\013\241u\b\324\201\203\035\006\2059\204\304\242\340\220\220\207\006_p\310h\007\033\264QB\317Q\221\221\220\310\303H\347F\033\274AH\243%\266\303\337\0200\350\001\221\020X\303\007\3617$\232\020\244A\030\304Q\202\007H\004j \003\016\340\r\"\"\340\f\037C\237\3530q#\036\301a\013\242\221\321\260\205\210\034=d\f\001\203C\235 \321\r`\r\025\200D\300P$$\n\201+\370@!\200`p\310\201\217\032D@\242Q\r\242\r\030:C\300 \n<4\202\210\214\214d\330\310\261\201\310c\307\006\303`\216\034=d\020\205;\216\212\200\303\0324\216\204\005\004m\f\215x\360\004\207\214F \006\217t\2106^\b\021i\004\213\204\"\020\r\2113\210\301\243\021D\033\021H@,\022\366ho\314\b\022\201(\f\365"
+	.ascii	"\312 \006\217zr\364\220QC[$\204!x\203\207xd\203842\341w!\241"
+	.ascii	"\031'R \241\203\026\007\013\"\240p\030<jq4\f\322 \034\016\265"
+	.ascii	"(\022\002w\264\3001<j\301\242\200 Q8\\a\250(\330F\371\272,\323"
+	.ascii	"\"\345\246\331'O\270\214L\323\322XXV[\223&\\F\006\b\364\251."
+	.ascii	"\311\331\222%\253\227\336\217\372\026\207\326\303W/\035,\312"
+	.ascii	"\275\250fW\350\351~\316\037n\3424\2732\211\322\325\305S9\226"
+	.ascii	"\316JM\316\310\326\026\327\301\201\201\256rwp\244\232\275O\251"
+	.ascii	"]\265V-\316\373\201\232\363\224\265\304\266\327\262\036\3535"
+	.ascii	"\262\275\001H\271e\250x<P\310\246tuR'q\033_ F\205\312\302=y!"
+	.ascii	"k\266\223\235l\246'\223\271\265\367lv}\256\317~\202S\202\372"
+	.ascii	"\316\254\371\360\203\\[\244H?\361]\306\211!fV\025DK\265T3\333"
+	.ascii	"\"[\373\214R\372\322\354\325\325\212\265\303\264\240\211\026"
+	.ascii	"\236\2602zH\353\220\257X;H\342\224K\315\346H[*\252\325\252\005"
+	.ascii	"\272\307\271*5`QJ\262V}\265\362YNE\2634\2732\177gd\32576?P\340"
+	.ascii	"(\305E\201Z\245\240\332\031\365\250v\366m\336\013\325\031\023"
+	.ascii	"\303\242\372@\371\312r\322\354s\266\332\347H\265J\253\223\322"
+	.ascii	"\272\364\335\313\321f\323\3622\227*\276\002Y\203|]\002[\227\326"
+	.ascii	"e[\274\267\030\275M|F-C\305\273L\246\212\034gb\304\326\246\257"
+	.ascii	"\313\254< \2064\2732\361\030O"
+	.string	"\223]\334W\263\253\262\317\364T\337T\245\354\2316\202|\250\202\3614\310\002\231!D$\"\"I\222\2441R\013\020\004cq\234z\346\001\022\240#=\222\202\222\231\241\021\021%IAR)\265\006\366\024\n\t\300H\271\322=\306\232\270\033>\031\214dr\235\002`\300\363\310o\"\356$\300\031\270\315K\227\204UV\327\374\tb\336\322\351!\360\340\210\003\271\027jD\205#G\214\277\213[z\225\362a>\0048\005\351\334\r=\332\216\217\003+\221\374B\026X\212\f\222\232\013\337\361NN\217\t\251nZY\3767\bD\277y9\213=q3\377fe\315\340\3637^p\232\351\006\317\037\3202/\231?\b\305\202\260\231B\336\034\026jy\265\3119\037\275\275x\242H\032?V\245\305\036\t8&\364w\241\321\335\342\317\2527\370\250\272I \371\036j6\311H\375\031\241\030\tqk\025\017\250\006O\362\334\334\030\254\324"
+	.ascii	"\r \2612o\016{\325\205\263X\375\300\305\030\021\310\002\036V"
+	.ascii	"\231\2043\344\031z\321\274\265J\261\352{1p\361\264\326\246\203"
+	.ascii	"!#\305\017\244\025z\020MWE\224A'b\315@M\332wR\232\254\004,6\331"
+	.ascii	"\320@\177o\301\214/\032\017\343RE\226\243\301\230\260\020\r\360"
+	.ascii	"\357\003f\375\353\253\265R-=\r\203}\374\021'\266\317[\265\346"
+	.ascii	"y\200$\330Y\325cw\317!\265%R!:\311\262\315\204\304\242\337\311"
+	.ascii	"\342\360\341\370s"
+	.string	"PT\376\n\241M\220\036h\206\037\f\316\336Q(M}k\005O\335\367\002G\367Tl\023\324v\\\216\273\323+\210\2320\313\327\211\024\215a{\314\024\254\023Q\236qBd\313\251q\275\306\367\037\300\356^\250\"\313O\266YD\005\326\262)\340\311\275p\257\321q\003V\366\362\034\201\312\223\2010!\310@'A\343Q\321\2249\372m3\235\264\321i\242\347h\325\307\207\304\037=\260?\013\247\277\031`]d\277{\302\361x\216\333S\274M|\013\322\353\263T$\361\034\024\2244\341\330\275\3366\353\251!\332\253aj>m\324\312\356\234\034\205\312\360\317\007\350\3244\307\352\370\242(\320\013K(\370\222\373V\206\375\345\024\331T\nbG\364\257\262\367\324\3142\330:S\226\311X#\006X\3644!Eb}\365\336\204\325E\337Xg\r\004\230\204\321\0374i\016F\217\037\274D[\311rn\001n\0345\220\034$\353\024"
+	.string	"\223 \213\376\260\302\250Z\215p\272\257\211\332H\224\r\366\032\255\211<\214\313\331q\213\025\202)rvD*O\030.\202\276\005\r\016\326\371^\2026=\320s@\007\376\"\250\361\353\217"
+	.string	"N\002\245G\"\217_\363\320\023\002\037\036\243\372\370\t\206<F\370\004"
+	.ascii	"\312O\247\252LV\352\304\304C8/\310\350\315\007\243p\327\"\022"
+	.ascii	")\306\321\375R\210\246\007\036\357a\311\002}\266\0354\262W\331"
+	.ascii	"\266\022:\212\230\352\026\341\221\005\333l\262*\213\362\304\337"
+	.ascii	"\363\f\243\005y=\2079\247\374\367\005\356\007\020v/\033h\334"
+	.ascii	"9\364\033\f\t\377O\360\356\365<\251\314\232\221\211\213\373m"
+	.ascii	"\333U\275\222\231\023\264\310\216\345\2313\225P\334\220\340Q"
+	.ascii	"\363\236\264\277\206\3652\307\247\273\250\237S\212P\223\320\341"
+	.ascii	"\371lF\210!\241\016\360\360_\004\260d\b\367\262\266\265B\376"
+	.ascii	";\276j\364@ox\022\3666\016\307\227\036k\361\303G\277\260\256"
+	.ascii	"~\333/Q\334Rm\300\207l\222\320\"\300\344\353\tT\347\246\360\f"
+	.ascii	"W\341z\341~\215\345\017\344\007\340\362\255\355\002;\013\352"
+	.ascii	"\n>(\032@\330|3\376\312p\017\257\021\371\241#\263\374\320\305"
+	.ascii	"\237\266h\314\356\234\261I\226;\331#\320\276\233Klw\202?0\304"
+	.ascii	"\221I\034\306|r\316\257O\254'\006\237#=B\342*\326@B5\277hV\223"
+	.ascii	"\331\265\365\305\034\347\377\254\205\243\033\235\246\203_\342"
+	.ascii	"B\\7\036\3172\344s$\027\363\206\275F\277\321\347d8\234,\032\230"
+	.ascii	"8\3229h\370\257\306,L\f\222\233\357\341AE|.\215x4F\276n\371\t"
+	.ascii	"\312\261\244\307P\376\307;\317\334\364.\354\336|\300\261\241"
+	.ascii	"}\277\377\266\371\031FN\374\311<\257\311\265\321\214b\0279\344"
+	.ascii	"\347\373\005\003;\277\251\030,p\005\370\034\345\255j\357\273"
+	.ascii	"-\374!\330\330\371\343\303\210\205\2312V\303\354\366la\343&\361"
+	.ascii	"\013\364\013\030\213m1^]\363\3449\232\034k\363\253\023\375L\216"
+	.ascii	"\027\346\203)'\336\212p+x\006}\016\313X\326\n"
+	.text
+	.section	.gnu.lto_.symtab.98006b62dfb52ccd,"e",@progbits
+	.string	"serialPrint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"serialReadBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"serialSetCtrlLineStateCb"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"serialSetBaudRateCb"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.98006b62dfb52ccd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
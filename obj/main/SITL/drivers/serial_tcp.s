@@ -0,0 +1,1042 @@
+	.file	"serial_tcp.c"
+	.section	.gnu.lto_.profile.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`&\0015\t"
+	.string	"BL/4`O\322\030\224U\3153\177v\255\033\371R\001K\f\242>\373,\355\233g\371x\350|\037\241"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\360f\361\360\335\b\331d\023\262\367\336d\313Dvm\257\256W\254\302\370X\240\251t~L`.6_\0063\242\004l\276 \200x.\272o\260\367\366~\321\005\250\f\312(\263\216\022\243\211\206\351"
+	.string	"d(\202%\246\262\266\236O\202N\313\t\345\250\202GEC\306\255\240\250\201\210{\365s\034!\206\022(M--\237K\331\020\351x\222\343\234y\034|\246H\"\312pqT\307a\345a\341\360\305I.\343\323\234\201\f\024\002\207\357\357}zw\373K\267\253+\260"
+	.string	"\215\264\332\016\b. P\0022\253n\003a\241aZ\026P"
+	.string	"t\002\006`\257_\024A\036y\305-\250\200\200\312\372\260d\331\251\201\205\241\235\353\n\266lkACH<\270\210\030\002\204\210\261\024T\356.\026\367{R\023#\200u\237\002\213,\340A"
+	.ascii	"\302\252/\300\022D\016`^s\213\246\355R\201\355\271\344d\266\365"
+	.ascii	"\324\252'@\341\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\355\004"
+	.string	"b\006\023\033\240'\351\377\377\377\347WUU\215\375\212\323o\377\377\336\376o\275-id\313\224\002\356.\035\326\220\250q\374\3620[\366\005Gg@\n\016(I\221"
+	.ascii	"\032a$S\354Z(K\214>;\263Qd\177\r\271\355\247\352*\207\330K\360"
+	.ascii	"F$ \240\202\261\231\353\230B|\303R\026n\324@\252\004N\006\226"
+	.ascii	"A3\307u\b\366\026\355\263,\303\265\226\231L\r\004\370\261e\245"
+	.ascii	"i\237\221\013\030]X1\370\275\202\214\342\013\0063\212\242p\244"
+	.ascii	"\261\331\210\2531\314\352Z\330\214\345\201\314\2129\004"
+	.text
+	.section	.gnu.lto_.inline.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`6\004\035\022"
+	.string	"\006XSB"
+	.string	"\221&\3518\025~\334\370\360\367\3219\256\3561.\2262\3414\312\354\214\215\314\243\302!\305q\300\360\006\240\024\235\372\377\267"
+	.string	"\365B\240\337U+\200\241\3713\017L\3778\033\215l\3274\232n\215\020\271S:"
+	.string	"@"
+	.string	"F"
+	.ascii	"\243\314EG\214\026\007\334\357\212\234\"v4)\207\0228R\254\342"
+	.ascii	"~H\377\207T\375!\326\373]\006x\357\326\314L\353C\265\221\231"
+	.ascii	"\236w\0027\200\3428\212\234\213\314\354\274\346\312@\231\031"
+	.ascii	"\262\207\246\335\353\232\220\231\025\376\272'\367\210K\267\033"
+	.ascii	"E]\311L\220\255A\275\200J\231\262\017\271\222)\345\004\201\021"
+	.ascii	"*/P\020\\a\263\227i\177\314\341\3735\325\326\324\n\02024\316"
+	.string	"D\215\227c\013r\032\341\222R\300=P\201\305)\204\034\032\\F%g\177\203\366qsc;J'*\233\322\211\007\001\356\206)\005U\340L\346\344\021\031\344\372\355\261|\300\fr(\034\324Bfn\276>\036T\226\314\314H`\002\177\241\2503^Z:`o\342VH\304\320\b\320>h\b\030\030X\220\274\301\036\244yb2sd\221\267\365\224\231\025vPD\272q\201\325\251\204;\206\334\206\021\312\351Z\373Cz\277PQ\251\f\037\006\254\275\275p\250q\305!\222\251 \205Ia\2265`\002!#f\346\001\022 \225=B)\222fdF\224\226[\030\346,\f.J\005<\204\3672\220d\220fS\210\336\220\302\215\231x\253\007j}Kk\362\"\251\245\b\033\007s6$\237!\342\244b<\272\372\214^P\266[[(\271\307\376\002\003<vy1\321h]a\rr\273\016l\rPz\037OY[\261\354\""
+	.string	"\353'\346\376A\366#"
+	.string	"\242Q\235\373\270\247\265\024\025"
+	.string	"\252>(k"
+	.string	"\362`\262\024N\327\335\001\306Z\316+\237\313\364%\223Q\222\263\244\320\274x\330\360\307I\200\216<\301C\367:M\006\217\b\250@"
+	.ascii	"\356\035h\0178\377+\217y\342u\022\373!\023a\373ti\t\336\023\025"
+	.ascii	"\347\316\310\273\007\315Z67\b\337\222\322\016\f\354T\247?\246"
+	.ascii	"\200b&\013\230\367\254\237S\347T&}\204\234\353\002]<"
+	.text
+	.section	.gnu.lto_.jmpfuncs.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`t\006\315\023"
+	.string	"VYZB0\217\222\016\300"
+	.string	"C!#\271\030Q\322\256\325\232`8\030X\3024\203a\363\032\242\246\335\006\331\021`\211\235K\024\317\250.\302\303\223\316/\241t\204\030\252\357v\260`\032|\362\207\371F\233\354F\266L)@"
+	.string	"G"
+	.string	"H"
+	.string	"\277H\210\373\005,\221\354\217\216@%\211\034\204\215\256\353\272?\305\017\363\222\310\031\210\032\335\247\273\361\253\372u\335\375\272\357M\340o\002\365\024\"\367\352\331\253\322\310\227F\267\345\325\357\267\206a\330\360%\020\306TOI\330.\036c\2635Fl\233\b\005\0225M\313\342_\361\005\231L\314,\212\310\375\245z-~\337\304H[\030\250'\266(\331\353U\021\271\224\352A\233s\225V\332\177c@h\210>U)'\227m+\241\337\032\022XZ\024\307\242f\004\021\245\2022\301B\206\224\n#+\035\326\350rH\370\3778\364\201\256\007\001\257\244O\377\376\001\336\177\034\3506\320\255t\013\3502\320\325\350\206t\207\002\354"
+	.string	"\366\037"
+	.ascii	"\017\231\021\257\007t\337?y\037\226\02659\23163\r\013\261\\Y"
+	.ascii	"\246\261\314\016\327\t\310\005\222\223\225\016\313\215u}\300"
+	.ascii	"<\035\314\203\325\271@\236\316\344\200\201\250|L\221\031\302"
+	.ascii	"2l\272\\!\321\206\211\001\345\303\022\201\345fc]\036\254\323"
+	.ascii	"2'Hk\231\"j\206@\332gZ\031\026v\250QI\243\324\214\210$)H\262"
+	.ascii	"\214\001\200\002\221\252\232\362\022\340\341A\212\303(\222\001"
+	.ascii	"\031a\246FDDaY%-=Z\223\024k\371\302\357|E\275+\334\315\310\352"
+	.ascii	"\225\0321\n\242^aC\222\371R\357\207\020\242\300\2527\0246\307"
+	.ascii	"4\233o\021-\270G7k)\242$-\324\354\264~r\252\300\205Z8\230\202"
+	.ascii	"?\0060\2046t\341^\007Px\253h\243\253?\314\330?/.\025\301\341"
+	.ascii	"\306l\234\263*[\260o\315\243\314P\263\ne\332\202\231\341At\304"
+	.ascii	"\334\377\301n\373\272\242\373T\244\354!\262\027\264\030\335\252"
+	.ascii	"[\266i\326\251r\b\026ZV\361N&\261\276&Dq\205\b\003\326:C<\352"
+	.ascii	"\267de\004\254\025<\026\265\357\311\321\033\306@`>\201b\330G"
+	.ascii	"\260x{d\200\345\250\313\243\034pIHWhai\216\316\254\204F\016\321"
+	.ascii	"[\345\301\326\341\235s\243U\256\306\276\323\217Ij\333z\357\231"
+	.ascii	"6\332A\036:\344\nIT\275\202\200="
+	.text
+	.section	.gnu.lto_.pureconst.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\232\005\002\232\005\005\232\005\006\231\004\007\231\004\b\231"
+	.ascii	"\004\t\231\004\n\232\004\013\232\004\f\204\004\r\232\004\020"
+	.ascii	"\231\004\021\232\004\022\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`\214\001\005\t"
+	.ascii	"RM%'\220'I\007\277_\001\277\360\317\216\334\231\314\314\314\354"
+	.ascii	"\004\241f\255\301\177\261f\240\2656\264\0256\"B\315\022\333\266"
+	.ascii	"\224)\247grh6\203\364\274\343\265\340g\022:\021:\025\235\007"
+	.ascii	"\235K\347\242s\241\211\227\201#\r\321R\023H\337\331#\340'\300"
+	.ascii	"Z\312\035\037\253/\312\304\337\325\364\316\"\307f\224\351'\304"
+	.ascii	"\"\242'2\303\020\362\340\250\242\020\222\254\240\332dx\312U\247"
+	.ascii	"S\356\224+4\371\tu>\235\216\332\252|6\312\033\235\252k\316\025"
+	.ascii	"\345\214\332\337p\202\033\005= \200\002\231\252\263\0039\211"
+	.ascii	"?\021x\366\302&\225\354\177\251\352\013\355<X\377;\236v\362\227"
+	.ascii	"-\202$\204\242\031<\310\200\035\236%\330\213\003\311\301\204"
+	.ascii	"\201&v\211\366\033\002\340\002\336\222\305\315\331Y\230\035\t"
+	.ascii	"\262od\253\201\245\317;HX \210\260\207\021\264R\270J\215X\fc"
+	.ascii	"\211\021\262\036\323\215\344\325\256\254\307Dq\003\310\251\035"
+	.ascii	"\3637\370\013\234\307:\007\277\"\366\231\244\212\305\244\rm\""
+	.ascii	"0\206\306Q\357\251\306\2642\004"
+	.text
+	.section	.gnu.lto_.lto.576a78dc81f5a40f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_tcpVTable.16.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375 \333\205\005"
+	.string	"D\t\241"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\006\177\001}{ywu\212\001\202\200\200\374\342\303\315\204\013sqo\274\236\344\244/mk\270\314\344\007ig\370\307\224\tie\270\307\204\007ca"
+	.string	"?\202\210\200\350\001_]\306\001[\305\001Y\304\001W\303\001U\302\001S\301\001Q\300\001O\277\001M\276\001K\275\001I\274\001G\274\001E\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/drivers/serial_tcp.c"
+	.string	"\f"
+	.ascii	"\200\224\230\244\310$\006\352\312\031\017\202\201\023\320\016"
+	.ascii	"\b\003'R\254\036@\021"
+	.text
+	.section	.gnu.lto_tcpIsStart.20.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375 \350m\006"
+	.string	"\"\314,2`m\322\030@\214\304(NR\310\214aM\300J\262\233\207\235\376\001\230\326\254u\252\263{\r\276\227$\325\020\004D\222\341U=\"$\245V+\261R\312\024ORf\322$,`*G]\355r\224C\345\024ZC\205ah\223\273\232t\331\312P\256i,\3135K\266\250\240\324\213G!\0369\260\343\215\031?l\0221\214\306\r"
+	.string	"F\251\002\026\236\f}\326I\275x\254\254\202\376<5K\220\344d\227\"\224\262#Q\210\306\317y\313\006\007\234\337@\204\232\210Hx\240\354fM1\360a\276\0217\220\340\003\004\373t0\003\020v\367\304>\025\270\342_\360K\377D\b"
+	.ascii	"2\003\316:#f\b\3055q.\002#!\362\270\033\235v\222\001"
+	.text
+	.section	.gnu.lto_onData.21.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\355\n"
+	.string	"\026\325KA0\307(\035\020\335\036\225\374\334y\275\301\246\250uSk\025\277\327Z\344\024\252\350\272P\301\032lt\267}\354\304\024}\250M\030\273\246-3\303C\227\346\020\221\226_^{\222\205\034P\331\354&{\247\0247"
+	.string	"9"
+	.string	";"
+	.string	"\260\335Ja\272}\272\236!\363\271}!\363\351\320n\360\272Z\f\005%\002\036\354.\225+\017\037C\377\256'\240R\245G\rgw\035Q)\224[\336\366\203m\013\373\032\001\365\236o\375\232\026\035e\36453v\340,\003\273'\263\b+\233\004Z^\177;\364]\346l\327\021\316\311$\003\266\300\301n\235\370t\305\366h\037\3461\341[\244+\354\252^\001$\262d\333\373Kd\213\262!\001\310\007\270@D\020q9Y/\006\037\300\f\266\335\275\360\001\214B V,\237>)\3639\245\204\013\204\226)\316\354Z\212R\305\276\266\273k\251\262\037\340\273\333\263\tyD\033\036\235\317\327\201\024\374\272\321\347\343\240\037\237\016\210z>\220n\034\354\205\272\217\212<\357\243\\\335k+U\2361\231I\236\314\305\313(\247\264;@\361(s)\001\020"
+	.ascii	"3\241\t\037c`\013\257\204}\217\312\004\251l\240\334\243\210\326"
+	.ascii	"t\202\251\t\"]\263'&HD\221\315S\247\3075\274\020&\031"
+	.text
+	.section	.gnu.lto_onClose.22.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`n\002\375\022"
+	.string	"6\243{H\340\320(\035\333)9\222M\256\f\306\017\253\203nM\377\275p\354\327\001Y#.\207\346\230\230\226R\032\347\306\327\036\250\026\265\356?`~\327\023n\3267\342\021\342\r\343y\360|\260\210\2342\263\200\230\267f\244\355\275\245L2d"
+	.string	"\\"
+	.string	"j"
+	.ascii	"\372\241\252a\214I\214\303\203\237\034B\335\341\201KM\340}U_"
+	.ascii	"\273\355\365\233\314\001t\343\250\370\351\016\021\350\347]jx"
+	.ascii	"\001\363\322{\310\274\324\227j\320C\235.\t\262I1\324\335\037"
+	.ascii	"\207\370\353\221\367\245\037\231\220d3\330#\210\263iF\023E\272"
+	.ascii	"\373<\337\016\263\330"
+	.string	"\356\310\244\273ue\263\017Wyu\240\272@\001\362<k&\324\345(\024\207\327\335\013\364\270\324\352\244\263s\251\227\231\227&^\\\215f\273\315\354N5\204-\347\250>vw+\343\250>\274\232~\373Ax\2654Z%\305U/\256\216\346\352\214\253R\256\306\270\312\274\272\274\372\220/G\244{\317\216n\017\273\036\235\223/F<\374U\177\236]s\331\211W\243\300\200*\n\205\275Lc\3370L\3650\016\244A\277\243\025R\366\262\224yIb\322\315\310G\354\365L\036\361mT\356be\362\352\"K^\\\r\237\242\031\226\267pE\346\034M\304\215Y\332b6|\212\256\232\252\250\263P\025\250\r\351\226W\360e:x\267;8\317\313K\243\206\026\263p\037\260\247\345\202\0273\037ZJ\235FR'\221\022\327i\202\004\006(*'\020\032\244\004h]uE\221\274\240`V0\260\200,U\353k\261T\033@V\352\313"
+	.string	"\262\270|(V\353#\021\321\325\213\212\365\301\254V\254\357#\354\307f\034\375rDB3\034\213\234\343\2323\\ $\267\022\272\355n\030+8K\334\202\273A\263<d\200%&`#\272\rXf\311\036\377\304cD8\t\332N\007. `\002\021aU\036\223\320\345\214\361,\230u;2\032\353\277\320\220\275\364e|\335\222\2754\262PQ\005\274\213\227\237l\244n\271\017\213"
+	.ascii	"\366\274L \321\n.\331\223y\"\266\244\2617\366\303\t]\307HR\022"
+	.ascii	"h`UFx\243!\035uq3\233I\253\034o\023\320h\001o\326D\215k\020\024"
+	.ascii	"\362\350\351Y\3131,\270\334S7?L8"
+	.text
+	.section	.gnu.lto_onAccept.23.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`\251\004-\034"
+	.string	"v\361\257H\240\230Q:\300;\312\020\227\230\317\370\300]\346C\242 \345<\210\301\376\004\345\365jm\005|\004\311!\360\377\316\203yf\277/\006\373e\023\361\220tz\300\203.\255\322Wu,\370M\236\257\261\"\177\260\377\023B6\2212\311\224"
+	.string	"\213"
+	.string	"\245"
+	.string	"#/7\357\r\214B\264\324l\335J\261\326\030E6\325\212N\371q\342\277\373\037Y\330\356\022Y\274*\311p\001\221^h\325JLp\272\f\314\363\356\213<\352\374\260\305wjub\"\245V\242\202\255\231\247K|\017yj\036"
+	.ascii	"y\272\347.\231\023\237\352\203\342\222\2224\265\326Z\357\370"
+	.ascii	"y:6\237\373W\320wZ\343c\007\251\220\3000\t\326x\217@\302,4b\301"
+	.ascii	"\244\261\207K\2161?r\206\021Db.%\324Z\227\201\301\031_\362\273"
+	.ascii	"\313awI\354\216W\001|\340\020yJ\266\313\006\355c\323)!\022\027"
+	.ascii	"\267{\354/\021}\211\255\273\213\b{\f\337\334,\345\205\252\315"
+	.ascii	"\355TFSA8\223\005y\372n \223\323\226x\222\3152k\255\016\366R"
+	.ascii	"\035N\314\236j\255\207:\335\267 O}\372\211\351\2060j\370\343"
+	.ascii	"\342.\321\307\255c\367cm\247\335\023\277>\037\376=%/\217\311"
+	.ascii	"\273S\362\352\230\2749%o\254\344\305!yoF^\330\310\373\242\274"
+	.ascii	"\256\222\327l\336\222\344%G^:\362\216\224\267\003Q\247\021\236"
+	.ascii	"\032b\345\242}\213\323\273\023\376e\367,\240\231\037\027\257"
+	.ascii	"v8M}O\210\fi\247\035\326\205B\005S)\350\347\364f\2546\266\334"
+	.ascii	"\274\032\346\352\227\026\233\253\205\230\256~H,F\037\232\250"
+	.ascii	"\200f\270\352\f\027\034#\0016{\327\302\205\244\305p+\273\033"
+	.ascii	",\037,\263;8\245\346>\200B\253\276\021Y\366\b)1I\274\206\212"
+	.ascii	"Q\331\003\230\200\b\243\276\201\334\325\360\252\rMq(I\263\345"
+	.ascii	"\303\334\264\217\344Q<\034\210\020\252V\245\003"
+	.string	"A\230J\r~vC\210\340\003W\266\324\276\3357\271\223\336\036j\205\206\002\373*\232\321\212f\262\007B *d\020\021`_E3\031-\305\254C\320\004\017\262\234N\226\323\341\216l\267\\Ng\223\255\270e(\320\373\355k[\200\302v4d\202\b\307\273\365j=\336M\005\216WT\313\341\210N\324l\274^m\201lu(n\274\332\221N\307\253\301\210\365\022~\215D\201x\207\007\345A\303\263\025a\247\037\245\t\210s\372H\316\036\347\017\263\326\337\201\345\267\n\251\023\344\024\262Tf\307\002t\332\225\265Y\020\260r\372P\256\314x\253\256\265\261\244Z\177\bbCN\".\332\027f\307X\002b}(M\303\003L\373\031X\250A$'\231S\252FD\224\024$M:\220\002\221\261\252\036\021 \261R\016\252\2312\233\003V\231\025\343\221\361\227\310\224\237\366]\177t\353s\\A\r5Ha\301A\360C|\215\017"
+	.string	"\253^\326\346\204V\"\230\303\276 p/\234\313\033\320,6\013\213\006\272\370\305\317&\360\027y\216\201o\210\207\330f\334\243\245:\352\023+\240\300\257\352\351nt\027(q\203\315\"&\002\233\206\037r\212\256\333\b*'\302\211\263\230\225M\005<\363\260%~\215\206\033;y)1\233\244\220\263/\300)\236b\257\237\322"
+	.ascii	"s]\376\037\220\300\245\231\251\250 \"\347[\302-\2558rdD\237G"
+	.ascii	"\367\005\365lG\321C\321\261\324"
+	.text
+	.section	.gnu.lto_tcpReconfigure.24.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`\254\007\375)"
+	.string	"ZJh\020C`\346M:\201h\016;\373c{\335\022\207.]q\221\237m\212\3257(\033\215\204\205(Fc\234\271B\004)\211\314\206\220\201\2579\236.~\317\002\372s\275o\036~>\004\202\202\334\335\2324B\310\2262\005\346"
+	.string	"\340"
+	.ascii	"\003\001\375\337\331O\315\276\257\373(\332?\273o\236}k\366\333"
+	.ascii	"\366Y\202\206+\206\364\234\342\356\005\262\247\350\322\235rV"
+	.ascii	"\376\353\370\203\377\273\177f\3431:\230\314\347\376\273\267I"
+	.ascii	"\0375\367\336\251?H\371TMNB\233\327VF\272\367\311\0345\367\262"
+	.ascii	"M}\230\362\371\377\234\306j:\2762\261\235\005\001\332\235y\225"
+	.ascii	"1t/\333\360l\254\204\362\231r\022\312\247\205\302+\033\t\203"
+	.ascii	"\300_\352CO\323\366z\346b\2431\026\002\305\3068X\027\226\304"
+	.ascii	"T\263\204!i \327\261\263\373\035\211\312\022f\244S\237\325\233"
+	.ascii	"\343\344\016N\254\b\243\246\204\27421\\\027Ff\006\201\324\215"
+	.ascii	"I\366\311]el\236\\m\220wpbclM\005K9cGb<L%;N\372p\033\367\227"
+	.ascii	"\030\262\333\267\341\336\373V\212\005\341\037\361\377"
+	.string	"8\377\337~t/\226\353\302\0346/\2505\373\0026\235\372\034\002\265\366\0271\242YiZ9-!\236\362/\301kNPP\263\252\2410pv\357e\264\325B8\262\247$\322k\b\331arZ3\266cu\334\332\314\244n\313n\234F\005\323-\321\356M\262rE\232\224 \305\202\252Yy\225\207\345\372\031\216\321\3308\243\275\212HD\371lk\305\346\016\221q\025\345\222\316~\013e\333\242m\317\216F\264\256\361\333Vz\357\265p.\303f^\234\321\370|1F\263\222\317s\f\224O\266i?\316\226a\344\272z\357g\343jk\366\263y\357\275\267O~^c\216b2\314\352\373Pf\377\351\327w\372\365\233~}&\263\277\364\353\017\370\365\225~}\001\335OJ\373\001\272\217\224\366\001\244\375#_\337\310\354\013\273\037D\373\300\016\026\311B(\003\224\\\"{\357\025:\312\262\333*d\035\222\336\333\305\312\346\317\241"
+	.ascii	"\212\254F\274,\327\027\031\033o\t\017\200e?p\326 4\003.[\225"
+	.ascii	"\364\033\027\272#&\234\310\350\247A\377\253\331\n\245Yyds\244"
+	.ascii	"\205\035\312C\032\243p!\243]\323\307\213\221\375\327)Lh\245\302"
+	.ascii	"\312@\2525\262\024\222\354y-Z\261\240\377j\205\003\255X\030\200"
+	.ascii	"y9\303\377\252\205\363\266\254\002\260-|\370\317\326\022\236"
+	.ascii	"\237\f`hK\265A\314[\350Y\017\357\331Z\271\254]\326.(\237\005"
+	.ascii	"\300\316\226j\203\362\314\231\325\001\203wF)>\205w\2040\202\300"
+	.ascii	"7\016\310$J\376~\314\206\323_\235\365\013\323I\255\025\243\203"
+	.ascii	"\274\203+B\266DOz>K\322\326|\007\032\225\263\206Y\305\244\311"
+	.ascii	"\022R?\207\016I8>\373#c7Y\237K\317g\203\362\211Za\033\0364G\b"
+	.ascii	"\364\357\341\003\312\312\323\332;]z\034\312C\006\007FE\0358P"
+	.ascii	"\013\201\t\022\034N\250G\243\013U\013\201j5\243\330\242\211\304"
+	.ascii	"\323\201V\b\324)\325\212xU\244r\241\336 fi\311"
+	.string	"PS\230x:0\312\212\210\243xEU\314*\316(\252[VT\304\343\025\225\212UT\263\216F\032\005\254\212\215\305\257j@\243*\213\305\025U\361H\304\032b\035\2115\212G\253\341\214\"\225\214a\325\021k\330@\275\221\006\3618\3142\032\217\303 \333e\363\332'\367\331\201y\213\363q\034s\033\203@\242y\305\231Q\026\312~\375\207\262\337\320e\221FM\326I\310\312\205L\223l&\305\347S\330\223\017f\262N\335\203\231l\023\223\235\2407H\250\344\326`+\017\2574\311_R|.y\365\327\222\375\221\r\260\234\\\"\023\240\002\254\222\231%R\200\215`\007\020\362\356m\321\005I\221\323\013&\331\026mz04\020\311\236\327/4\300\217\025H\2632\311\366\016\243\020\017*\200\375Mq\251\001\200\211\250!<\003%ddF&\210\202$),t\240\"!\262\232\007\0210-c\020Y\230 \005I2\254\001X"
+	.string	"M\311\307\244\361]I[C\322$.\351IZm\201/\300\274\243'k\205\215\340x\310\245\244\021\030\033\3670\207X\314\306\032>\024O\350\211\n\261\020\002\331aj\3079"
+	.string	"\203]\205J=\032\327\241\235\202|\261?\210\213\277\254L\372\300\317\213\007\330\013\372?"
+	.string	"\247\316\272\rs\216m:\363\304[M\242\254\212\274\003P3\311X\2600\340A\177:L\2764\310\005"
+	.string	"j9\326\023%\265\305\001i\265\250f\321\354\210Y\265.R9\022\f\224\375^\211\363\243\344(\301*\365=\260w\373\360H\237\336\200\033\316/\355\276\332a\021\177\243\217\373\325i"
+	.ascii	"\352)\347BYR\360\235\242\352\277\322\034Zh\342\236^\203\237n"
+	.ascii	"'\037\025\2215v\332\345N\t\213\352\362\013\255\355\272|)\374"
+	.ascii	"'\257\361S[\345\321`A\202\325\274CI\226Y\324A\200|\301\237g9"
+	.ascii	"dW\200\021\240\354L\236\002\243\bY\177"
+	.text
+	.section	.gnu.lto_serTcpOpen.25.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`\226\005%\035"
+	.string	"\226r\266G\220\234Qc$\342\r\225\274\347~\352\255;\006<\356?\346\310\177\316X\241\224\353\313x\262\253\006p\035\202\264\027\227O\226V\326UuL\254x\323\263\325\253r\277o!\031'\177\363\334\377\r\3328oA\310\336[\312\224\002\235"
+	.string	"\226"
+	.string	"\251"
+	.string	"W\270\243\352\203\371\344\256\231\200+t\302a\301\326\037_|\300\275K_V\367\032!XB\354\247k\265\257\344K\210n4\226q\356URbu\357\205`Z\354'\217i\333?r$D\376\315\214\305$\230V\327Q\023\345\275F\232\2157\200\376\214\235"
+	.ascii	"\372\323\362\370\357\350i\332\372\363\213\216\036\261\202\247"
+	.ascii	"-\263\324\342\222\032\022o\232\025\254\034\263t\206F\346\311"
+	.ascii	"\224$G\316PX\255I\240\206\230-\235\241\320|\020fh\343T\257H\303"
+	.ascii	"`\255\260\013\367^\327t\230t\303n;\310\266\315>\221\004V\207"
+	.ascii	"r\363}\374t\n\\}\372\323\307\241?\253\225\240cKJ\254[]d@\261"
+	.ascii	"\037Bo\177\234\262\b+\033\303\354\355\251\316`\350&\310\025\365"
+	.ascii	"\006X\227\266\261\250Z&\373\346\265K\366\245\376\235C\375\t\356"
+	.ascii	"\344\237\375\351?\360\343_\340S\267\354\306\037\346\352SVm\312"
+	.ascii	"\252m\254\272\342T\177A\017\020e\031\005j\356\235\261ls\271\234"
+	.ascii	"W?>\365\333D>\225slO\345~a\320\300I\203c\310\334kt\360\323?1"
+	.ascii	"\230\024\013&\035&P'\274\236\023\312g\n\bO\363[\202\246\2429"
+	.ascii	"\023\264S\304p3\031v\222V\327"
+	.string	"#*%v\335\336p2cdJ\016\017\003\006\246\024e\244\303\277$=|\313\213\322\353\\n\203\270\226/\313b\245f|\250\035\342[|\f\222Z\024$\003$A\031\361:\026\037\004\305{a<\365\255\374\212\b\223\204\017\372\324\247\347U|t\212v\211S9\021\273\367N\230\242\302f\213\367\336\363\370\344\304%E\004\326e}\202$\304x\236\210\327\024\023\3639Tfg3\276\234\276\f\2500[\255\215\242V\237\312,\217\221-\262\037%\007\340\251m\335\257l\r\222\367^\n\001\274\363V\344p=]\016v\003\312\r\231\267^m\004\220\257\366\023\253\365j\032t\202l\265\037!\241Z\006\027;\031\020\256\332\026Ag\353\241\020\252\341v7\036\215\267\273\265\300\355\200h+p\265!\232m\307\243E\340qNw\333\321z\271\334\216\226c\2747\257]2\272\343\353\by\3128h-\243\220\246\377CO\213d\373\264\276"
+	.string	"\264At\347GEb\221^IiJ\020\244\306\360\035e!\327\314\204T#\236\360TB6\035\030R\201\356\252E\307\25257\n\024\371\362\305\033`U\323\r\263\351m\276\326\374\216\\iZ]\017dJ\264\326\376%\tg\250QL\307 \"\231!E)H\222\341\340\"\021+n\003\021P\255BH\031\211\202\262dh7\354\255fK\316w\177\026!\305\n\262\221U\271\341X\324\241,A\332Zp\355\336=x\217]\267\315Ma\177\205#\220\007uT\317\234B\333\234B\233\316\320\025"
+	.string	"\2145\317\202FB\247\0261\366w\007\025\347\315\375H0&9bt\215\r\223\210\351\317\232\236\247\302x/\020\r{\372\032\360\n$Z9\005<6\366\244W\346\034l\362\353\213\203R-\273|s\234\206\270\327\b\311\234\267\346f\371{)\245dR\375\310L\375:(Q\225?\357\320 _\215z;"
+	.ascii	"\t\006>1\350C$\211d6\251\255\325y\016\305\004F\317\271\n"
+	.text
+	.section	.gnu.lto_tcpTotalRxBytesWaiting.26.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`\361\001\305\020"
+	.string	"6\037nE\360\262&\035P'\335\021\260\177xGY\270s\306\345?\rN\233\316i"
+	.string	"l\307\305\314g\330\232Q\263\266\r\241\315\203]9j\001WvR\265\260uX\234<\306\344;Y\361\376\034\327\260st\254\222F\366\2262\245V"
+	.string	"T"
+	.string	"^"
+	.string	"7tv?\004\346\264G\177\232m\037\305S\250\330\203\037\314+\213\225\330\020\333\261\373q\241\213d\217\360\001\262G\035q\357\021jz\376\247\004\322\310\344\270^\252\307\226C\320\253\345\032\362j\301\320\356\336\346\311\362be~Jv\327\351zy\270\263\333v`{\201\235\r\002\361\n\212\311q\205Xe\217\375\251R_\354\303U\027{\003\375\373?\257\2713\230\2160\raZa:5}\220\rD\r\003:v9\364\370X\236\b\303\304k~[\305\267\361\346\327x\232\252\203v\023\243\301\261\373\035x\264\002-\323>\354*T\376e8\200]\227\003tD\240~V4x\300VP_6e\020\263\2632\303\312\335U\251\276X55\202\315N+{\330\026\335\2057\322\242\200\352\b\t\230\273\263\360\004\300\330\243\343L"
+	.string	"I\215\253\031'`[^m\n'y\227C-U\331\277\301\2206\\\266\351+,h\273\233 \206\202\""
+	.ascii	"#\363\350\247d\017\251R\212\251\213\243\256$J\241J$\315\035\t"
+	.ascii	"J\2272\251 \"\235F(\016u\032] \235$p%\222\350\204\353N(\216$"
+	.ascii	"d\023\312\350\304\245L\246\023\267}{u\361\203\030\020\244\032"
+	.ascii	"d\300t\323LYlg\032\302\362\201g\245,\b\211\323\303\323RU\214"
+	.ascii	"\n\322\377X\231\201\232\032\025\346X\021\3012\371\013/' p\002"
+	.ascii	"!\302\343\001I\002\366?\374\362B\244\031\321\340\005\341<z\371"
+	.ascii	"\017BW0\216x!x\210\217\341\231'I\362h\303\013\341\3349\351>g"
+	.ascii	"\240\255\222\337\342d.\210\306\035)\034\372\276\241\031\207?"
+	.ascii	"$\b\030\267\232\200\324\202\341\274\230\317s\333\035\224\200"
+	.ascii	"\322\343<k\214\237\336\332W\006"
+	.text
+	.section	.gnu.lto_tcpTotalTxBytesFree.27.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`\206\002m\023"
+	.string	"\006d\177H\340\320(\035\330\003\327\35580_\244W\211\004\213\267\250\261IR;h\235\363\310e\310QK,E\356\366\377\255!UP\262\342*\177\342aL\337\003\b\002!Z\343t\304g>\030\031^\345\245`\274v\343\210%{K)Sf"
+	.string	"e"
+	.string	"n"
+	.string	"\n\274\335_mZ\342EG\013\032\240{F\006O\367\210\340\237\247\363\243\367\377:BI\274\\\224#\315\254\303\351\\\300\331\350\036?\223\022\350tJ\025\320\351\344\016*\352\224\274\342UT\"C|`!\233\265t\306\250\364\230\305(\227f0i\352n\305\351\302\314^\273\242\222\356\376\312f\032\364\235\3767\371\337\340\337\026\001\006hjt^)t:\225=lvd\033\\\233\373\307\3262\355W\331<\363\353M_\"}\350\250\332\2418zO\356Er\337\311\375\224{)\367,\367\313{\005\031\375\300\030\031\352\306\220\313\321A\263\007\204\336Tqt\377\227\353\215\342>\302\021M0\220\206\321vj\013\364&z\255\f^\016\016\210F\367x@\347\003\035\034\206n\330\346\344\017\336\027\261\232\344\345\311\323'&\363:\321\025bHO\001\311\242\333\214\0336\227d\032\211\035\330"
+	.ascii	"\305j\257\355\356\0263\355\314\313(7@\260\305\361\377\244<\342"
+	.ascii	"\310\216\b\363\210\007\333Q\232B\034@\363\203\252\023\201\264"
+	.ascii	"<]B\"l\243U\376%\254\254\312n\202q\353\327\023.\033C\366\253"
+	.ascii	"\324\304\004\257\273\023\344\250\254\002)\340\312\004\f\031\254"
+	.ascii	"@\226\013J\007\210b9\261V,)\357(\222\026\024\353D\345\224\n\301"
+	.ascii	"\325\267\n\301\n\2510\345cI\235V>T\270\372HLW\265\200\341\307"
+	.ascii	"R\251\302o4\266\312\346\231?\370\221\037\2545.lLb\217a\376\227"
+	.ascii	"\270\004\343\023\344\342\027\204E\241\"\b\306\255\003\310\345"
+	.ascii	"r9\025;\021\227Xk\304d<\356X\304\235P\254\366#\212\370\204t\034"
+	.ascii	"0 \240\002\2419\333\001_'\364\240i=\261\216\274\220\321\303\352"
+	.ascii	"\274Y;\035\006\216X\"\016\003?c\254\315O\355\245\t\347\276\""
+	.ascii	"x\200\217\341\231'm\362lC\205p\356\004\351\036g\240V\221\337"
+	.ascii	"\"d.\030\215%R(\364\026\206f\016\017\22288\016(\305\261\033\242"
+	.ascii	"\246K\036\265\226C1_\347kw\320\002\312\216\363\2561\352\364\326"
+	.ascii	"\2322"
+	.text
+	.section	.gnu.lto_isTcpTransmitBufferEmpty.28.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`\022\001\005\r"
+	.string	"V\230XC o\224\016@\270Lg\306XZ\003"
+	.string	"~\303\\9\320V\263!(\252\227\316\005\271a!\305\275\375c\375\272\"\374\207e\355NT\2204\021\244$\030\020\200\221\364:\337l\004\032[\025k\203H,!R\246\024C"
+	.string	"@"
+	.string	"J"
+	.string	"\001vGZ\244\330\215\b\f\265c\216\037p9\246]\300\345\230mopF&=\252PO\271"
+	.string	"9\231\261\033\241~8\351I\362o\362K\304J\305)\244\364\314\032\354\256\363\024\242\341\326\3336`\233\201}\017\001\366\257\335]\353\210\375xgg\375\327\225\326+\235\232\276F\001\030\"\035R/t%.\252\205e[\230\312\352\361\267G\276\2111~$iJqQ\033+\024\222\003\307\254@\313\264O\362\222\321Y\027\036\033'e\243\312\001\301r\347%\266\214\312\346\216\"\201@\352\002\016+DJX\230\274\332\023<\371\2235\030\264d\377\304#Y\234l\320IT\320v7\301\210\216/\243\nq\314\267p9v}\300bZ1\261\341#[\354XJM\005\036\242\220\307\301\327e\334\366\351\210\276O\247y\333\2046\021\007\205N\347q\037\374<\256\243\363\"\300O\327\361\300\315\373\340FcP\210\363\240\b\004\362 &\356\355L\001d\220\321\372P\023\204L\211\321RM\315\364(@TL\034?\021\030"
+	.ascii	"2\003\3020\273\t\023R \254I\301,\017\204\202\202\201#\246\222"
+	.ascii	"\376\343L\024\254\002~\215 \236\t\321xF\212\t\r\367\205\361\256"
+	.ascii	"\331\027\013\333\211LM\260J\236j\306$L2"
+	.text
+	.section	.gnu.lto_tcpRead.29.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`M\002\025\022"
+	.string	"vavG\320\322(\035\223h\302\036(h\351\227D&\304\263.!O\225\353\322E\262\321K\032\301B\220\032\243n\370\317\352APp\355\300~Be\2038\214\355`\006\271\032/b:"
+	.string	"\370\206\275\221\220C\352\024\262\331O6\2212\245^"
+	.string	"Y"
+	.string	"e"
+	.string	"_q\0263\307m\270\200]\235\0265v\303\004\376L\217\016O\300{4}\200\367h\333\n\026\314\030\366\260\007\307\333I\262\021\032\262\033~\312s\330c\247\t\363K+\235\355\346\203V\213=\346\274\033\251\345\\Oj\263.ew\017\364\274\251\3112K+\273\353\244\325>\334\336m\263\330v`\347\211.\254\002=?\217\376\005\357\361:b\303A\013A\2239;\214\245\356\330\357vw\255:\366\303\273\344\270\037@L\227b\332\353\322\321Kw1\255]:5\375"
+	.ascii	"'*x|\271]\234\\\221=\212E%\036\376\366\214\017d\022?\204\231"
+	.ascii	"\326Di\210\247\003\220\335\020\301\243\033\2302\355%=\371\374"
+	.ascii	"(O\325S\016\266\0375#d'zA \361\037_\306{,\321\013\335\210p\221"
+	.ascii	"9w\232\032U\215jP\3102g\325No\223\024\3414P*=3@\003\252*>8\267"
+	.ascii	"\\\206\f\n\222\235z\f\320\004)5\202\200q\303\231\344\325\246"
+	.ascii	"\260\312\323\2342\323\230}\241\f\211D\263-\374\305\213iw\031"
+	.ascii	"\004\005\025\300T\2010\251\227\013fe2x\212\001_-.\251UK\345\372"
+	.ascii	"\\-\025\206Uk\302\007\263J\275|`\313\365\235R\314\212Q\265\276"
+	.ascii	"\027\213\325\372H\302}\267\252S\242'\036nG4*cI\242\024G3\215"
+	.ascii	"EOu\344\320p\033\242\005\351\216\362\214P(7Lz\f\331\204\344\356"
+	.ascii	"\306Tw\\RO%\004\355\230%\021\333\017^\204:\3318\020, \220\002"
+	.ascii	"\231\251\354\001B\241u\013,\023\256y\037\245\331p\360\022\b\026"
+	.ascii	"X\206@Q\01636\256Hp\025\302\271\317\n\371\221\304C\b\027\362"
+	.ascii	"\271y\210X\371\024\206\021\f\265e\003N\210&\0275\244{\316@XE"
+	.ascii	"\216\013\322\\\320\032\223\245\250\351\351\267\315\370c\210\205"
+	.ascii	"\215a\262\363\326\214\034\226o\345\306\336\333Z\243\007"
+	.text
+	.section	.gnu.lto_tcpWrite.30.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`\210\002\255\022"
+	.string	"\366axH\320TQ:X)\206\020t\031\260\026z\360eT\232\324\036\030#\r\030`k:.,\\qO\234>\374\327uI\207\372\223W\341\030(O\341@-\201\303\027O\240<\271B\202N\220\306\336\257\331n\2561B\366&R\312\024_"
+	.string	"\\"
+	.string	"h"
+	.string	"\3354B\ft\177\205\241:0\255\205\320"
+	.string	"\3355:?\335#\202\177\236\312\217*`\252\364\364d\252<\354\037\242\343Mk\317\t\031\236\242\356\3768\205\302Tr\274\260k\267\002@\244\305T\316(7\242\315(\227h3\316\324\335\032CW\004M\266\333\255t\367W\244\221\320O\375\017\341\277\312\277D\002W\036\017k\023\377\225\316\330\340u\367\202\035\r-\006nrZS\245\362\310E\220X\002fo\377\030[\266\371\225\353\356>\327\374:\252\222\264\246:\232{o\356\273\271\237r/\273=7\367,\367\313\355\365\244\204\344\207JO\367\210\233\222\036\2229T\374W\223\377\274\177\002\0050\035A\234\003\227\240;\300\223\216\003\036\237pT\3019\271c&\212\241\221\341"
+	.ascii	"Q~H\223\245\f\350\b\211\257>\257\t\003l\335(4\347\3722U\236p"
+	.ascii	"L\310\330\3339^\226\274BbV\310\366"
+	.string	"vf\216Uf\t\005\275\001\246\330l\020\2601\247\004\251\275\202\326x)\335\374,J\003\305\313\274\003\324\242VZ\345_\205aU\274i\306\261\007\031R\253J\261P/\027k\345=urI\275X8\240V\241\312\365\271BU\207Ux\341c\255P-_*t}'\323[.\252\360{\265Z\341g2\266r\315\033$\031\202a\331\013\354\210\177\007\017JE\021\326\207hh\3061\331\261\217\036\037^\364\210E8\26698y\200(A\244\016H\020\013#\333\3351f\233{\334\261\205\035\241\331\"\371\0033 \300\002\021\242\344\001c\300\002\206(ZTS\364\r\306\311~\323v~\220\021\245\035\204qU\264QG\360\023\370a\230\305}\330\243\344\275%\212)X\205\360\271Y\210(\270?-\317\342>,\004!\323\335\006\224\0208x\222\272W\033\350Z\363[D\346\362\321X\221b\241\022\033\314\203\004\353\230\021Q\017\326\334"
+	.ascii	"\037%t\211\006|^n\234{[K\365"
+	.text
+	.section	.gnu.lto_tcpDataOut.31.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"}\n"
+	.string	"\246\323HA0\247*\035P\254\303aq\225?v[U\324}-\335\355\305\343\346\340-\356\240+\263\302\242\2353B[\303X\202g\037\001\024\003\b\021\241\006\003\003\344A\\\361JG0\220\016:Q\004\021\262\367N)6"
+	.string	"5"
+	.string	"6"
+	.string	"\373\227\213c"
+	.string	"lw\353,yx:e\350'\210\242\323-\344\223:\210\020@\240 \222\350e\001\n\311]\227\035bI\312Jfw-M\"\310\235\335\366\204\355\b\373[o\375TJ_\013}\300\036H\274v=b\0216Av\340\304b\373\322\376\352\254\360\255\320\027vQ+\003\273\343\203\353\366\314\343\031\264g\333/\3323\207\266\203\217\252R\201\200\002\f\346L\331\006i\237\025\001\032\224$\004\333\032\007"
+	.string	"\202\360S>\033\333\356\336\344\231\037\322\236}\216\234T'Vk$c\366(\2223e\237\356\356z\242\354\035\267\321x\300\215\267\231\303t8\017\305\205\306\373:\260\202_\367\361>\213\272\3614\030\225\373\300\212i0\247\323}\325\303\341|\3252\3563\243I\242\025I\247\rf\310\233L\247(\020"
+	.ascii	"2\003\3020\304\204\275\032\310\r{\tm\365\t\231\347\020@+\304"
+	.ascii	"\237\t_`\312%\330f5E\334\345\246\332\243\201\251="
+	.text
+	.section	.gnu.lto_tcpDataIn.32.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`\271\003\r\031"
+	.string	"\006.\240H\260XQ:\360\n\t\206\024\034\033\333\005(g)1l\267-\357\204\316\261\020\007\277\213:jx\\\203\305:\360\022\337\214\212\206\323o:\311\317\302\343O\341-\310\266\341\362\276|P\013\223\272\2323\344m#\204\354-eJ\001\207"
+	.string	"\201"
+	.string	"\224"
+	.string	"Jl\256\366{\334G\355\273\023\0270\347\020\217\2459y4v\205\227\346\275\365]\206\207\371.]\263\247\234G4\237$\005\005R\2269\247kk\030\354\365z\275G\336\235\322\332\303\024(\343j\315W\245%\267\334\316\303\b\372\250\300\361&+\\D\233(*LG\272\342r6M}@/\016\006]\252rA\217\254\234O\234\231s\256r=\272Gz\204'Y\252\314"
+	.string	"zq\005!\3149\255\267\034\320\255\272m!\333\017\354]\n=\273c\037\b\t\205\272\331\262+y\b\347\234\f\2222\2008@t\343\304w\371U\355\260\334Z\360h\317\346\355\350\352\354\333\020EQ\361\016\3312?\272[?\372c\316\373a\276\373\003\260^\316\273W?\272U\237:\365\251\303O\r\206\352O\252%\250\216\237z\245Z\243\372\005\006\264`\342\340\311\234*z[\346\223d\312a\373+\333[t\243\332\217\334\344\324\2343\246,\3159i\334 \274\234\211\3123\021I"
+	.string	"\320\350\262\343\n\317\235H)R\212\253sj\303\235\031-\351\321(\333\024~\344\265\300\bMj\027\330\370_\037\270\341\306\246\037!\233\323\213@\021"
+	.string	"\340J#.Zv\337\372Dt*\030\200\232S\206\b\244\233\225\2423m\260\020\372&\276\313o\277&\034\214\270\272rW\310n\334\243\350r\341K/\004PC\016@\355\"\200\2623\206\013\021\021Cdkx\220\233\027\335\030\033;\005\177Y\231=\222\037N?:l\233\344\344\223\333\325\331f\351\327\216q\320\337<\023\261\0222Z\354"
+	.ascii	"\323\030\f\347F\207\206#\013\r\253\t\001\323\321\360\341F6\213"
+	.ascii	"\321\\\264Yl\204l\266\301\205#\273\001\341\202\315h\256\232\031"
+	.ascii	"\347\204\210\315\\:993\327\2127\277C\023\202\236x\326&\341HW"
+	.ascii	"1\261x\352\331\235Pc\326\240jY\213\263\302\254#\270\332\227\305"
+	.ascii	"%8kgFQj\316\332\326\376G\310\026\347\2343\265:\253l\355c\364"
+	.ascii	"R\304\326\252\026\247RfwG\017G\224\331\325\342\354\203\3416a"
+	.ascii	"r\240\037XnV\344\352\374\372\224\274\b\004I\250\021\360\224B"
+	.ascii	"P)\"\023\020\005\022\314h\332b\220\002\031\252\353\006\021`A"
+	.ascii	"c\205Ar\3372*\036\326\201\216\0201y'\205\205U-/\266d\354\033"
+	.ascii	"\267\006Q\264\327\235\344p\255\301\265\225\324G\\<\351\251V\242"
+	.ascii	"\366!\222\243\222)\203\324\005\277\205\030\231\276\3240\353!"
+	.ascii	"\033S\\\344\321t>\214\376=\320,\340;\265j\210[\207\357\024_\325"
+	.ascii	"`\2216\211\351\307\222\225/`\214\257\233A,\244\035\360-\240?"
+	.ascii	"=ZI8\365\351\034\360j\360A7x\321\317\365d%\207\374\233\316\024"
+	.ascii	"SH\323"
+	.text
+	.section	.gnu.lto_tcpDataOut.part.0.47.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`*\0055\035"
+	.string	"\226\262\260I\260\226Q:4L8N\372\3129O\211t\333\300$\271\302\313\2308!\275\2371\016\264;\236\324\021#\206c_Z\226S\233\rX\336B\2756\254\315\364\377`\013\327)\376!\302\016\375*\253!\0077\033:>!d\023\271S\n\223"
+	.string	"\216"
+	.string	"\241"
+	.ascii	"\357\341,\036\244_eB\240\303\210\317\347\324\013\310S\236\360"
+	.ascii	"\3459\3773z\224n\366\253)\226<\247}\035\207\332=J\367\233Z\233"
+	.ascii	"|W\265\376\016\234\232F\236\372w\035\361\224\274L<\265\237\303"
+	.ascii	"\266\321\222w\366\225"
+	.string	"\377\236\352}D)\365\b\326Zi\247\033\343\273\217\"\rw\222;\277\304\307\021\250\326:\303\304\342\342\212\323$\0233\234=&\025\337\260@\026\254/1&\244P\007\305\214\336\253>O0\361\346\30499\002\325Z\375\243\026\267\353\266G\330v`S[\247s_\365\002>&\275\025G\263\314\\'/\371\260n\223\035N\347\214\3232:\215#N\337\320i\233O\3355\341t,\234\206\205\3234\343\364\213N\317\210\323.:M\336\352\036\303i1\234\246\341t\030N\357N\317\377\376\357\310\030\370jEQfL}A\211\320\370\217\177\352\267\372\332\367\203\034\210/\304/+\006\276\240/\370\035\367w\030\371>^\345\327\017*\335\364\241\322\205\265\305\257\246\200\340\243\362\005k\3755 O\247\214\274\344K\235\307.3\373Z;\202\204$O\270\023\020\344ki\264\\K\356\314R%I7x\256\235EQ\"sD\341L\212\022"
+	.string	"\227\224?@ra6\266p@\211;\356\255(\221\t\227\256\2704+\251\006\257\302\223\324v\236\220\224"
+	.string	"\236\350^\310{\244\246\204\331\377IL\226\253]'\207\273\213A*\t\322\024c\333\302\217\324z\200F\312\001\300p{\264\354\013/R\313\261\203\236U\302v)OJ\030(\330\234kk\270\315\367\314\203\264%\354\023\0211\201\265\326\367l\016\307\362 \340\251\326\252\340\212\304\220/\343\324\327\211\001\271s\020*\332PR[)\024D\224\023\272\221.\177>\224D\265\016A7\234-G\313\341l!n\270\f4\241[\220\007Z\211\313\321~x<\364\301\206\243\021\r\r\341h\257\207u\233\ft\264\274\361\301m\016\301j\222\263\301Z\fL\271Y\275-^j\004\200]\312\035`\316\272l`\301!\316f\315\342\254L\213\354fm\026\347\006\357fgJ\260\024%\270R\376\330,\f\306\025\352\363\232\235\271\340\"E%\2665{+\330\322llC/[5Z\225\322"
+	.string	"liZ\265"
+	.string	"\300R\207\246\207g%\fT\270N\256\211Q\240\224\260\361\311V\260\313l\216\033h\250q4D\241B%\024FJR\222\244\003\200\002\231\231\243\333\022`\325\031J;\247D\242\253\373\177\006\364\244\207\n\362\300\264>-\231\303ij\274\013%\033\271\350|2\235<\260\264\231\241\312B\2000\324\316\235/\0258}\n4{\"\305V?+\332\305\254g7\347\245\203\260\351=<\bwA\n\205\033n\3463\266\036\033.5\220\340\343\307\274\037\220\325m\207j=\277\375\357\025"
+	.ascii	"\030c\205\350i\0263\347\363\205\203;\374\261\224\237d\224\341"
+	.ascii	"\347\206\235\003\322K2u\324*\200\216E\372\357\366)\356\214h\236"
+	.ascii	"\303\b\033\377\2407\366\215\317\b\200\2672J\001\310=\002\222"
+	.ascii	"\t\262;\034~n\274\215,\254\255\304<`s!\025EG\0047MDk+\263\267"
+	.ascii	"\006\213\004R\275\273\351\006\205.M\243S\006\304i"
+	.text
+	.section	.gnu.lto_.symbol_nodes.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`\236\003\275\017"
+	.string	"\266\027\\E"
+	.string	"s\224\016H\310N@\016\204\004\260\366\002\222\034\347\325\237\341_\303\333\342y\262T\311\030\b\"\212\245\377\377~U\325\376\377\307\374\3777~\267\272\273;N\024\304\322c\240\377\335\020i\326\221#Bhs\333$\245\fJ"
+	.string	"M"
+	.string	"H"
+	.ascii	"\361\202'Z\350\321\251B\233\250L\317k\361\322\322\f(4\311\324"
+	.ascii	")\023\032\205=\325\r\t}\302\322\037.u\210#l\361\252\373\301@"
+	.ascii	"\320N/\017Z"
+	.string	"\204\302\001\200\250\252\327\364<\225\213j\253\3528\255f\3169W\032\304\252\252\201\021\374\005\227c\206\254f\214\370\373\355\332`\021\303\307\t_\2426\375\211^`\242\023\224h\005$\372\300\210F \242\003\204h\001 z\345C\017\360\320\004\272.\320\241\r\354<M\325R\021\016\315\262\246T\213\265\241UT\032\232\343\f]b\f\235\037J|\006\212\307\302-^\242R\342\257/>\364m\341\252\220\032;\202l|\re\302\347\200\037>\347\003\3617\340\356\f\017\0322!>\006n|\031n\003\034DT\210\330\305\013\031@F\374+\334\370\327\267-=`\\D\001\232\201kJ\265X$\355\035\247]\312t<\236w\234\347)\226W`\216\037Y\207gV+b\270\344\035\367\355\246Z,U)\373&$e\227(\f\373\222\220\\\202##\277B\222|\307\311\257\247]\347\200\341'~\023J\250Q \303RJ\024\244Me7"
+	.ascii	"\003)\242\352\021`\024\322)\205\242\242\330\221y\032{\232\004"
+	.ascii	"\005]\277a\225\221\004\202\237\252\212\033\373k\364HZD\327\233"
+	.ascii	"\315\367\r\376J\352\365\343\231\317\024\205\204\370\363\373F"
+	.ascii	"q\260\267u\245\035T\212\3408KS\236\3038i\365\201?T\322%QYo<\275"
+	.ascii	"\356 -\310Y\232GuU\277C\036,%\300\213\030\361\013t\331\316@\302"
+	.ascii	"\036\247!\3038f\203\nF,\244\006"
+	.text
+	.section	.gnu.lto_.refs.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375 _5\002"
+	.string	"\262\205\017\024p\265\352\374\377\177\350\245u\374E4;\216=\367\267[\312\024\243\246\n=e]e\263\372\021\035:\311\212\267;\300\364\202\177x!\013\370\001~+\3758n\020\316\370\211\177w\321\212\317\177\020\001"
+	.ascii	"\r\212\022"
+	.text
+	.section	.gnu.lto_.decls.576a78dc81f5a40f,"e",@progbits
+	.string	"(\265/\375`\372?\305\022\001\032\327%fW LQ9\351k\022\036\270\201X\243=\340\231\271[he=\006\315\327\002x\353\305\036x\236\005\323\212\217\241\300\365`\267\256\313o{\246V\225\177\334\225D\277E\216_L\023\330\324.\210\303 h\267\023\233\354\211{\260L\271\b\262\375\255*\337\r\245\337\266%d\023\271S\225\005Z\006w\006F\360\307z\310U\003\351\344e\263\312r\354\333D\272\210]n\320F\224?=tN\350\344\364\375\375\201o7@m\235\335"
+	.ascii	"m!A\357!?b[I\253\276:1H\341sQZ\r\250\216\234\005Bw\306n`\f\224"
+	.ascii	"\026\b\375\245\201\177\2310\006c\026\bmd\006?=~\024\305\364\275"
+	.ascii	"9\207\345\254\034S\2314\301(\343MG\363\350\035v\331Ro);\247\237"
+	.ascii	"H \035M\030\231\336\244:\307\273\354\214MkI\344r\316\0372\370"
+	.ascii	"\360\341V\271B\343\201\357\315)\370\375\002F\006\226\355\312"
+	.ascii	"\002G\276\224MN\372\311\322\265\222\006F%\024\316\300\336\226"
+	.ascii	"\262d<\021\303\344\301\262u\2210\226\325O}l\242\354\247\216\221"
+	.ascii	"\201OQ\231\217\"\256\244m\311\345\234\377wT\343\350\031m\243"
+	.ascii	"k4T\337h\032v\331O\355\364\341\303\007\016g\025*rr.\270\3579"
+	.ascii	"\374~\203\337j\360{\f~{\301\357-\370\215\005\277\227\370\003"
+	.ascii	"\253\001M\"\256\001\323\324\367\215\004\377o\243>\262\313F\352"
+	.ascii	"|\033f\347\300l]\027}\210\026\344\334\303-\031\204\324\306.Z"
+	.ascii	"\266(e~\262Pj\304\332\310\345\254\344\360\341\203\211\005\215"
+	.ascii	"\033*\350\275m\203\377.6q\207Nk\007]\023;o\031Y\352\321\3676"
+	.ascii	"\r\337f\301\267`\330f\253\001\275\245\202\177\033\347V\316o\343"
+	.ascii	"\354\033\333\265\302\206\323\353\205ZR_\013'\3506\016\020z\214"
+	.ascii	"R\346\256\234\363\217yt\265\364\324\267\003\013\204\336n\341"
+	.ascii	"[&\270\225V\003\352\301\002\241\033\262\005Bm\233\266l,\334m"
+	.ascii	"\033\373v\021#\316c\224\263rV\33267\347\242\265\034\370X\313"
+	.ascii	"\301iF\244\310\205\336[,|\373\003[46\215]v`\335n\313X3?\213\312"
+	.ascii	"\254\314Y\371\323B\346\274\270\372\336J\341\333\016P\263\256"
+	.ascii	"\316v\200\336>\341\fV\003\332\026\b\375\230\325\200n@Z \364l"
+	.ascii	"V\003\372\3330\035`\243,_Y}\177\333\006\306N\311R\273\352k\277"
+	.ascii	"p\330\205\3459Z}o\223p\220\226\273y\275\345\254\224r\305\202"
+	.ascii	"m\201\375V\315\246Y\030,\232\365b\331l\027\273\264k\277\335b"
+	.ascii	"\271\234\2032g\243\260,\266l\354J\003\376 \263\233\371\360r\246"
+	.ascii	"\352J6\340\267[\277\215b\225v\315\236\335\314\307(C6*\202\345"
+	.ascii	"-\347,e\212\365\322\300\250t\302\221\260\267\234\225\267Y\277"
+	.ascii	"\r[\263Xl\231"
+	.string	"\251\304\312\271\307\325\005_\326X\261!\227\263\362\303\007\016\037>|\370\360\301\256\311h\222%\303=\t\260\251\264\032P\022\026\b=\b\360U\300G\001\377\266\214\354\244\021\205\366\305\207\307\321\314\234\276\377\355\322\216Y1e\346\320\312%+B\372\336\002\370\020\300\031\300\276~\240\320\260\032\242\314\3129\377\360\310\344(\251\321\367#\360\355\322z\331\256\022\226\344@\323\327V\261Vn\273,\225\213\030q\2238%g\345\234m\227\003\2209\027m\327\317\234\234\213?\326r`-\007\367I\225\221+\350\375\007\370\226\353@`\362\210\357\360\033w\260@h\007\253\001\275\026\b\375\300\002\241\277\325\372-\024\233u7Si\t\231\273rVZ\320D)L\320\372^i5\240\330\002\241\030\200 \301\b-NfO\260/@\205HU\026\327\300\276p\016\377\251\376]\303\364 \005/\034\377\247\007\177\3270=XA\005\tZ\374D\243\360"
+	.string	"\374'\b0\360\333\237\372\016:\005\247c\360\237\006P1\302\331\020`\005\025-\230\004`G`S\263\207\001\277ea_\350\024:\306/\370\317\r\277\025\372\255\357\267\"\370m\357\267%\370-\t~\353\342\267*\321o?\370\355\n\277\035\301oU\374\226\205\337\246\277\375\375M\202Eq\202\337\016\375md.\340\207\371\3417\025`_\260\024\250\272\002\376\023\003\277\351\301\354"
+	.string	"\354\377\227\231"
+	.string	"\237\013\177{1\021\360[\023\f-\213\003\374\3753\r`\026\340\357\270\277\205&\007\277m\361\333\016=gv\350\244w\360\237L\2052}d\201\377\3341\0232\t\360\233m\016\340\3574s\203\337\232\300D5\370\177v6\002\370\273\305\311\030\360_+\177S\371\315"
+	.string	"\374\326\212\231\301\337/\024\r\177k\002+L\3015\370\317&\001\317\340\277p\177c\231\034\376\243\375O\373\017\303\377/'\300\234\347\2771\374\375\242q\334\377\034\361w\b\177S\340o\t\374]\201\277'\360\367\003\376\206\300\337\021\370\033\204\277-\360\367\005\376&\361\367\b\177\223\300\200\277c$\240"
+	.ascii	"\177\337\r\376\336\360\367\005\177\343\337\322\3756\206\277G"
+	.ascii	"\374\037\300\177v\34077\374\246\005\277\351\363\233\273\3374"
+	.ascii	"\377\246\373\373\315\337d\376^\373[\355\357-\177\207\375]\345"
+	.ascii	"\357#\177\017\371\033\352\357 \177_\375]\3657\216\277m\374\355"
+	.ascii	"\364w\323\337L\177\307\370\373\305\337I\177\037\375\375\302\337"
+	.ascii	"%\3746\315\1776\377\335~[\346\267)\370\377\345\267!~k\342\267"
+	.ascii	"*\374v\204\337R\340o\024\374\355\302\337-\376\026\376\375\373"
+	.ascii	"[\350o\337\377\257\277C\360w\007\376N\341\267V\376\326\300\337"
+	.ascii	"(\374\235\201\377d\377O\374\357\372?\364w\320\337%\376>\341o"
+	.ascii	"\f\374m\302oO\370\355\333o\327\374V\315\177\025~\353\366[3\277"
+	.ascii	"\315\277]\301oU\360\333\027\376\267\375\007\363?\353\277\211"
+	.ascii	"\377j\3773\324\325\325\325\375\273\344\217\227\376\017\212\004"
+	.ascii	"B~\207`1rs^\364\275AZ\210\026\033H:yV\275I#\026\207\277\303\366"
+	.ascii	"\303J'j\256\210\027\037\277V\275\344\361\3216\244j\007\013\376"
+	.ascii	"o\325\245\0221&\311t\247~\251:I\003m\212\325\016\027\376\016"
+	.ascii	"\026\376\257\324\335\201\341\230\321\200su\374\356\260mz\306"
+	.ascii	"\240\202`\2719x\224\304\254\346\346\2708xm\322\2401\3621\346"
+	.ascii	"H\376\250\021e\243\007\213\324\221\037P\2776\210G^\346\372\336"
+	.ascii	"\032f\334\017\032\246\344\215\326\262{\3422\346\324\367;L3\236"
+	.ascii	"v\2448-\2219\375>]\244/B\264\364\275G\035*\\0\352\372\336\030"
+	.ascii	"\267\tn\306\032d\323\225\301\203C\310\033\264\313\364+\243w\344"
+	.ascii	"\030F}\357\322\335\200<\021\341\372>\356FA\022e\245\023\007\377"
+	.ascii	"\367\205R\317\231\24689I\277J>U_k\222}/\322\230\245\263\251\276"
+	.ascii	"\227x\217\340\320\210\321\345\350\032\231G\214\242\216\256\361"
+	.ascii	"\327h\367\226\305+\253\357-\356\304\326\322\322\364}\\/\377\363"
+	.ascii	"\320\265\2469qt\322\324\321\355\322X!q\315\335\244\3739\343F"
+	.ascii	"\205\244\2579\347\334\222*\3665\345|M\034\035R\256\357\343n\366"
+	.ascii	"\237wk\220A\361\322\367:m\370:g\3707\345\314\030t|\250\351\222"
+	.ascii	"4\337\334\214A\307*\0071\253\357\343\314\270\377<\036\333\233"
+	.ascii	"7]qn\316d\250\tIsq|iA\203\3534\036)\0378\310\364\275\216\030"
+	.ascii	"\376M6\215j\301\241{\363\346\001\316\030c\2235\326\253'G\025"
+	.ascii	"\2524j\334|\246@\331q%\315M\267\025r\3562\217x!\315\3655\321"
+	.ascii	"\004\335L3\20003\262\276\2733fz\214\304\"\0163ezl\260\315A\322"
+	.ascii	"\227\214\216\023\230\267-}\257s"
+	.ascii	"\0053=\2315H \035y2\252\262\212G7\353JNA\223LF1\201!d\210Y\004"
+	.ascii	"\307[\226\034(\033&\016([p\204\230]L#7\263l]%\264\335x3\275L"
+	.ascii	"1\346\230yf\232\231cL\030\3142S\213\tff1\323\314/\246\027\263"
+	.ascii	"\315\344b\212\231`\3140\023\315\274bn1\331L5s\315\304b~\231d"
+	.ascii	"f\030\2734\273\230M7\271\314\245\024\2558oH\263\213\031\244\003"
+	.ascii	"S9\206ap\355pb\275\224L\244\245\273ma\035\221\361\006e\016\223"
+	.ascii	"\f\323\311\250\205\2342{X\266\250\f\331\210\013H\322\232\001"
+	.ascii	"\302\241M\352-\347\f\225\303\344A\002\351\310K\252r\362\026$"
+	.ascii	"E\215\211\224d\306\340\212\362fb!1\227p-eE\221K6\261^U/\336r"
+	.ascii	"V\336\364\361\233\310_\304\b\263\213ie^\231\312\344\256\212\221"
+	.ascii	"\207\322z\255I21\273\230O\254\327\234Y4\273\230T\314.\313\026"
+	.ascii	"\225\263S\007'@\216h\221\3139\237a\206\304\311\022\302\375M+"
+	.ascii	"7\273~\323h\032\331.\2374\037\\d\3645\253\004\335\264r\240\235"
+	.ascii	"/\2659#}\201^\340\036\245\325\200\3323\013\204^\247\210\317\213"
+	.ascii	"\303\347\225\301\347\245\341\363\276\360yZ\370<#\370<*|\036\024"
+	.ascii	">O\t"
+	.string	"\037\313\341c4K\224\340b\230\026\030\224\230Iv\242\030\243\234\372\036\263\341c.\370x\f\237\255\013\037+1\221{\261Bs\324\367\270\t>\036\202\377f\201\320c$>v\302\277\371\343\346\225\355Za\203\013#c]\337\240\240\233?\016d\243\310\221\302\245\357q\022\346`5\364\250\262eH\316\200,\257\306\244\372\177\036\001\364,\241\240\270\372~7\007\177\367\006\333l\201PS\207\271\303.\337\305\224:\n\366\365\304\250\357wi\360\n\362\273\240\337\205\301\277\211\343\306\317\033\030\304(o\230Q\2730oa0\372~w\206\277\023\303\366X\303\244a\302`\202\"c\3220g\210I\231m\351\373\235\024\374\335\022\374\233N\346\021Lj\f\f\363h6\375\faKk\322\367;\"\370;\036\330\356\236\260\251d\276\260\313\253\2310\256\374\361)K\362R\353\373]\f|{5t\005\366j\350wF\330\242t\330\"\255\006\024"
+	.ascii	"\026\b\265J\223\270\301\217\022\212\251\207\231\333@\331R\325"
+	.ascii	"Ug\313v5\226qb\350z.\255\214\220\270\276=\307\324\002\226&\325"
+	.ascii	"\367\250\033\334q\275\244\335\242$}X}\275\375\b\322X\226-\352"
+	.ascii	">\361zk\252\256\352\251bX\322M\234\215\241\247\210;@\330\336"
+	.ascii	"l\221\023\323o\235\264lQ!<A{\323p\355\246ch\271n\323q\032N\263"
+	.ascii	"i9v\251\246\327\3301qv\215mc\331\242B8\"F\346\267c\342\354\031"
+	.ascii	"\253f\367\245l\252\216\353\036Z\300\216\3045\222\306\362!*3q"
+	.ascii	"\007$\277\331\"\307\301\306\221\0343\030\334\243c\330B\311V\003"
+	.ascii	"\272!i\201\3204hQG]R\337\243\\\370\r\370\233\211\223\216B\002"
+	.ascii	"\351\310k\342\002\362\246\254\262#\271EE*i\267\224<D\214\350"
+	.ascii	"\265V\353\244\251L\356\254T\rA\202C\314\037\024\326c\246\224"
+	.ascii	"#\276\322\266\364\026\006&\303\254\321H \035y3\214/\232I\223"
+	.ascii	"\273\221@:\362\220\332\202\\\351e\325\215d\316J+:\244\254u\220"
+	.ascii	"\366\"\201t\344\305h\313\321d\032L\243\3512m\246\3174[\303\320"
+	.ascii	"c\372K{\3510-\246\273t\233]\366Z\247\275\223\264\222\257^\232"
+	.ascii	"R\216\330\nW\324Z\223\265\026\313\326\225\213O\035\260\222p:"
+	.ascii	"\344rV\356~<\271\232\353p\217\346\300Ge\340\277\321\316\272\244"
+	.ascii	"\2449\243\274G\310\210\031\341\322[\320\255\266\253\264\276?"
+	.ascii	"\347\360\3177e\235\345'\006&7c\320\224\215i1\236$OME\372\376"
+	.ascii	"<k,\277S\220=f\021\312\213X\337\237c\370\247\025\374\363\t\376"
+	.ascii	"I\004\377\355\325]I#S\334\330~x\350\240\264M\365\375\211\304"
+	.ascii	"?g\340\237H\270\245\364\024\273\364\320\\\347\031)\3632g\345"
+	.ascii	"\017o\f\334\216\256\276\277s\370\326\003\372SWWWg=\240\277o\275"
+	.ascii	"u\217\262d\271\352\373\313\245\265:\013\005\243\225\253\364\375"
+	.ascii	"\033\312;\353jx\262\006?D\260|\351\321\267\237X5uX\272\230\365"
+	.ascii	"}\334\335\376\363v\270\004\251Z\353\373\013\206\177\265\360\225"
+	.ascii	"M\360\251\264\032\320\237\005g\254\240\201Qrvv\252\331\fJc\333"
+	.ascii	"V\262\307\351\t\234T\332O5-6*L\372\236h\266l'\215\213\215+>\304"
+	.ascii	"\304\316-\034p\326\342\022\362\226s\224\007\035+\307#f?\267`"
+	.ascii	"\371\222#\325\367\324b\313\346\330\324E\351{f\271\331\221&MX"
+	.ascii	"}\317\261\263\254K\023\323\224\276'Y[\22185\246\372\376\307\006"
+	.ascii	"\376A\352\352:\303\354\224\334d\253\256\222\266~\352\270\300"
+	.ascii	"!9\301~\206\231M\205\201\222\326\367\374\262eB\320\346\340\364"
+	.ascii	"=\257X0\236\253\027H\302\364=\275n\266S[\253\342!w&y\222\263"
+	.ascii	"\2129\307*s\024\222\310&\210\211\231(\017>g4\220\272\236\374"
+	.ascii	"\254\362\223\212\210\0217\253Rj\315\351{J9\271\316\345\317;\207"
+	.ascii	"\350\230s\324\367>o\370\234\342\301\2168Ss\372\376\314\272\002"
+	.ascii	"CDI\337\237QN\345\317\353\351j\302\022\243\357}\314\340S\353"
+	.ascii	"\334\202Z\206\241\353{\0370\370\204rf\025\227\200,\373\266\275"
+	.ascii	"\031z\020sW`3\372\236KN'lSrG;dF\304\32049\231\234d=b\204!\303"
+	.ascii	"E\271c\256\357O%SC\214<Y{,\203#)\206\276\367I+R\344<\362\002"
+	.ascii	"V\033T\223\2356\307*IX?\217t\301\305\260\243\357\231<\215R\220"
+	.ascii	"4\262\364=\215\334#=LXE"
+	.string	"+cC\206\334!\230\003\234N\025\327\230R\337\373X\301\267N\354\031\344vy\006\271TxJ9\323\200\200\023\031\215\005\334G\013\377\247\017\273<}\234W'(3Q\347K\312y\365\237V\347\217\236\343AF\261*\313\321w\347,[\r\250\205\222-\020z\237\":t\234U!h\355\270\201Kj\235T?\253\3148\2650\\\307\276\347\324\315\342\200eQ\365=\221\035\345\007\310\231'J}O\036\327\250\007\226Z\337S\252\227YReh}\317\035V\316\330\230\027=fV\001\"\246\352\306\215\023\307\tV\b\033\037\252%VJ\217\373\211\203\207\205\244j\251\357}\242f\2346f\234Ph\316V\211l:\346\250\243\007\0324N(\233\2179GM\300J\224\267\034\025\345\201'\016\312\207R\215\237P\302.\256\031\247q\212S\330V\337\3730\341\367\310qr\272T\007\200\341\013\016\022e\305\324\367=pg\323\331tw"
+	.string	"\300\313\231\204\315\032\267\276\357I\303'\323\311t\2552d\243\030\260d\216\212\362\3003\262\344IK\337\367T9c\2341\256\025\033\017fdQ\036R`\326\246\256\357{\214\340\3336\366|\261<_\3306\034\262\211\346K\033T\223|T.\340=V\370?\223\316$\323\215\2032?\355b\220\265A\311\345\343q\001\357\231\201\353\352\316\243\250Ll\303"
+	.ascii	"%\304\323\350\347\321iD\215f\214Q\322\367\314\247\361?\317\007"
+	.ascii	"\0060\2662}\377\323x\026g\314\311\030\323sL\342\013\030\224N"
+	.ascii	"b\217\021\376\357\334\362\316\231fL%dq\212\204\331\r2Yr9\237"
+	.ascii	"-@\007\355\306\f\272\276\347!\203\345\3101s\226:\223d\303p\340"
+	.ascii	"\020\371\302s\206\377\033\367+\367\33777\206v\303\261\365f5\240"
+	.ascii	"\003p\023"
+	.ascii	"\364\033\347\343\204\270\243H\337\r\340n\233\260-=|\364\275l"
+	.ascii	"\224\313\234s\006V\315\0169f}\317\263\304\235\343\353\276]5v"
+	.ascii	"y\327(s^\3365V\356\272\371\020\225\331\351\203+<W\244\222\222"
+	.ascii	"\320\373\3374\277nK,WA\336\372^4A\277iB\020\322\343I_\223\314"
+	.ascii	"\357\231\377\226\271fxSc\312\260\276\366\314j@\005`\201\320;"
+	.ascii	"&\350\227\f\017\\\231\245\223\276\001X^1mbSgR\372\376v\271^~"
+	.ascii	"\327\276v\333p\316\231\250\314M;#l\332\240\344r\324\321\303\177"
+	.ascii	"\301\374\266\231A\236\272\266\276\370\370\252Z\362\345\262Yi"
+	.ascii	"\233\343a\277\250Y\022\022\347\302p+\003\353H\255\357yp\340\377"
+	.ascii	"\366\375\243\271x\3149?\235\312|4\362\240\277\275=\255\365\360"
+	.ascii	"\367X\323\026\340\377=\211\023\312l\\\206\3119[7\030\211X1G\207"
+	.ascii	"\374\377\036r&\332\234\363QiIE\264@iY\314JT\330\234,PZR9))\363"
+	.ascii	"\324\206\274\354\221\225\224H\342E\022s\316\304\316\312lD\345"
+	.ascii	"\224\215\220D\"%e>f%\222\230!\0339ePR\026\211JK*'\253\264D:)"
+	.ascii	"-\221N\026d\243L\314F\305)l\204tR\352\202t\312\240\264,:)\031"
+	.ascii	"Q9Y%2\333/Y\224TD\244\274,\366\344\234\227\224I\"O\316\305c&"
+	.ascii	"\202i\246L\365\306\224\245\262es\242\354\221s&v\225\251B\362"
+	.ascii	"\224\306\314\246\224\004\251\002)\3472\231\311\001DKT\346\234"
+	.ascii	"\223\262\221hsFR\036s6\"W\210\3129g\244\r\223t\314=\331\250\270"
+	.ascii	"d\254B\362 \031\221I9\311\224\3159g'\245e\0252\210\254\3122\231"
+	.ascii	"\215J\242UZB\346d.Cu\304K\242\205\353Y\n\211Z:\373U\373/\332"
+	.ascii	"M\343\001S\f\022\244\257\355\262\032\320\f\270\004\375\236\361"
+	.ascii	"dy\232\302\245/\207,\277[\376\253\345\232\241bP\262f\364\355"
+	.ascii	"\243\325\200\026\300\002\241\267,\3507\313y\346\f\\[_\016\310"
+	.ascii	"z\312J\216\226\261\357\305b\256\240\256\256\256nN\316\305\213"
+	.ascii	"\245\357\330\025\373\305\362\237]\231&JE4\314\315\226\211C\302"
+	.ascii	"\002\373\352\242B\262\246/\256\023\323C\315\025,e\\iO\212]\255"
+	.ascii	"\005\207\212\016$}o\225$!\313\257*\227\n"
+	.string	"\222kK\261\257\322\250\312\223\327[_ \227H\332\325\272Qn\326U\336\255\333\344>\271P.\223+\345N\271N\356\322./Wo\371-r\215\364\270?\214^\220\267*\004(op:\344\230\3041\353\342$\333\230rsI&7\337\027r\311\273\204\004\322\221\007\343H\351\315\204c\312\221@:\362\222\214s\336\244\334\270Ri\336\266h\334(68\035rW\367\007U\007(J8\035r0\356\214\t\274\301\351hr\271.\217{\244\201Q)\027\247>\320B\372\304\260\341\225F\203%J\334\230`XI\362\253di\303(5a\365\275H\314\2705#H\266\372^\254{\304M\325\\>\322\311n\363\262d\344!b\264\314%2\304'N\212\211U\352\372\023\266h\301\027\034j\301\027\034\002\026\001@\035\006\207|:kQP]\361;\221\002\177\353\320\257\bE\232\376\f\327\"\242\024\347U\200\330\260\376\200\277\364\202\253"
+	.string	"\261\016\201A\337\231\242\247\016\335\026A\241\2125\b\334\001\203\277\265\347\013\016\245A\240P\250\246i\206\026*\320\307\205\336\220JBp\003\253:\374\351\021\252(\b\t\3652\270(\001\250\256\303\337P\317\320P\021\020\030\004\356\326\336\na0\005\232b\005\376\204D)v\300\022<\"\337\212\211|+o\250\002\221o\365\001\252D&\210|'\204\352PgX\202\310\267\352\350|"
+	.string	"b\025\366\210@\254E&zk\217\004\"\337j\201PoG\344;1\374qPU\241\t'\200\206\352\352\202\bD\276\025\203U\330[U \362\255XH=\301o\250\367[\177\300\022\027\250\302\"\026~)\200A\237\312\001\"\337\352s\025 \202?\241u\250A(T\205\326!\332[{$"
+	.string	"\203\250:\f\016\215"
+	.string	"\f\356\326T\270\256=\240\373V\"\325\347\273"
+	.string	"0\210\357\373\tU\240\312\002\276\003@\360"
+	.string	"\004\022.v)\212D\020\352\251\302\335\016\013\300\337\372\353}\300\005\007"
+	.string	"\240\252B\023\\\234\030\352\255\301\023B=\035\025,pa%ZQ\302\372[1\004\366\204'T\030\376\004\240\016w(FP\327\336\252\202\n\374\2410$\\GX\325\341\005(F\020aU\207=)\212D\300\300\037\013*\n\035u\375\t? \004Tq\t(\2240\341^\005\210\022P(a\302\003D\b\251\303\"`Q\212Q\341J\244\016{(|\204+Q\317\372\023\266\340\021\002\252i\212\"\024\352\260\207\242G\035\366P\244DE-\370z(R\023%\322\037!\240\232\252,z\303\324D\211\224g(T[\020\366V\244\030\370\353\251\360\245h\020\250\016\375R\244;\021C\026zC)\322\335\232\356\204\206\202\351\016pE\321P\320\227\n\213|\351\216:\204\242\267\262H}R\024\241X\205A\025\303\224\267\246&J\244:\347\232:"
+	.ascii	"\204\024)\202i\312[\325a\212\024\301tg\242D\272\263\262\360\251"
+	.ascii	"BA_\212M\224H{T\241_\213T\247\004\024J\230\220\232(\221\342u"
+	.ascii	"\370\033\352IQ\204\"\035\252BU\025\246Hy\326T=\301o\210\216\020"
+	.ascii	"\352\021\245)\252\n\005W\244\347\232\256\302`\nD\276\225w\025"
+	.ascii	"\035\204~\275^\005\b\r\204\352/\305o\005\252B?\235a\312\343\201"
+	.ascii	"U\030L!\203:\204\242w\202\005\252\246\252PP\003\2530H\244\243"
+	.ascii	"\n\005W\\55\261\n\203D=C`\360\267\022\005w\352\332\343\200PQ"
+	.ascii	"\017\005VO\360Sa\035\372\365N\360\b\365\324\023\326TD\003\206"
+	.ascii	"~\275\023<\3025\005\225\305O\365\251\034\340\240\323[{$\264\340"
+	.ascii	"\353\241\030\032\352\215\340B\350\263\n\203DW\210\327\224\304"
+	.ascii	"\n\374\025\355\204j\212\024E\"\270X1\013\241:\274@`\320wWt\375"
+	.ascii	"\001\262\360\033\352\245\351\356*@\254\276\"\341:\0241L]\250"
+	.ascii	"k\321\n\013Z\360\005\207\322\024]\201EA_\232\356\204*\260E"
+	.string	"0MwC\241:,\002\246)\026\002\376ZHSt\b\374\021\r\323t\007\f\376\206\277!5Myk\272\016\177C\031\256\002\304P%ra\365@H\025\366T\f=\b1\\\177(B\024\001Y\360\300E\021\3607\344\201\003@HA \341\"\204*T4\344\003\376B\b\207E! \260\272P\201C=\240P]\201\277T\250\247\nU\254Di\272\201\205*$JSt\035\376\206\322\024\355\255=\2414E\325\023\374\206i\212\266\340\013\242\340B\210\016\005\203\"\244\247\220\272\372T 0\350\343\255)\bA+\360W\204W`Qp\204\025\250\376\206|;+PeQ\202\316U\200\020\352\271 \024B\250\347\002\212\337P\b\020\033\036$R\205!\326`P\030bG=\301oxU\"\027\326\333[{BE\347\020]\321S\205\253\n\251P\317\005\241\035u\r\256P\205(\013\303\025\246\260\247\302w\037\0244B\207\016l"
+	.string	"\003\330\007\202\310\267\246C\275\237P\035\206\030\nU\026?\241P\b\340\257\267\"\204O8\f\001\202"
+	.ascii	"\275\265't\377\243Fl\370\234IK\312\025\201\372qsc\244\204\b*"
+	.ascii	"c\267\004c\311d\310y\324\303\305\315\350\207\220\363J\307\215"
+	.ascii	"\325\0242A\032\313g\314\b\033\032@\356\226\273\005N\216)"
+	.ascii	"WW\355\"\221<\310\3748\303\200L\341Ag\265v\302\t\243\004\211"
+	.ascii	"\217{\346hM\335\023e\024\031:6Ud\360\031\270/#\325\371\246\247"
+	.ascii	"F\032-k\350\324I\0276cK\022\212<\2670\201\241\006\013\345\201"
+	.ascii	"\032\315\234$\210\030*u\252\241D\2522-\350\0164\t)\211\232\032"
+	.ascii	":\256\034\221\033\25539\314\25628\222\270AqTI\002&\247\311\215"
+	.ascii	"\363H\b)SK\372\316\230\201\332x\202\343l\035\351P\250\2436xr"
+	.ascii	"\250\020\267\364Ek\330\262\rr`\344\372\2424,(\242\307\243N\350"
+	.ascii	"\021\225a#\bUY\023\"jfv\254A_\034\205\201\276@e`=\3518(0\252"
+	.ascii	"\2401\216\3128\312\364\203&%F\216\276G\227\332\034\3418\245\311"
+	.ascii	"\220\206\036\241Gh\222\223\244\235\353\342tD:\232$\347\315\r"
+	.ascii	"\2332\035#4c@\372>\203\030\232\321\214\032\271\264x\224\214~"
+	.ascii	",A\213G\215X\310\234\276\372\242D[\306\033;\313?\310\230,\251"
+	.ascii	"\205\365}\206(r?\234\223\356\026s6~\2404\226\3119\312\203\205"
+	.ascii	"\222\212qf\316O\272\237s\"F\334L\356E\225\216\276\177{y\211\323"
+	.ascii	"\352{\312A\223\220\225\311\305\371\317\023*f\361q\267\253A#\032"
+	.ascii	"\225\364}\006#\370\031\200\230\371\211\306\314\371\346\246Q\226"
+	.ascii	"\322\261\233\221FU&\227\225\242<\374\244Y\201\325\301\375|\363"
+	.ascii	"3N\304\210\233q!\312\270\322\367\247\033\035$>\226L\372\336\203"
+	.ascii	"\377<<\005\312\311\251\357\271\346l\363\243\003mN\2166l~\244"
+	.ascii	"|\310xkd>\271\336\260i{S\003E*\351\246\346t+~\321rr\331d\260"
+	.ascii	"\213\262#FN\363\fz\306\260\241\202\246\357y\206\216\355\347\030"
+	.ascii	"\266\223\214\235\222\233v@\320\352\222rYI\207\007\2361O\274\260"
+	.ascii	"\310h\261R\022\363\322\367\f\363S\314\317k29\034U\372\376\007"
+	.ascii	"\f>\301\374l\373y\274\247$#^\360\177~\371yfS\325\321X\337\377"
+	.ascii	"\230\341\377,\275x9\327>\2609\311\n\227\224)\346\343l\306\232"
+	.ascii	"-\013\204j\250\243!djX6\204(\nc\b\031\203L\315\024'\035\003\026"
+	.ascii	"@0@H*\226*\263\250\017\023\200\204\314\213T\271\256E\214\031"
+	.ascii	"\231\021\021\221\024\224\244(\225\306V\206F\177\b>\273\340\357"
+	.ascii	"\320yc\211\001G`I\320\233\233\334\022f\037\275\366\026bc*\300"
+	.ascii	"a\247`\tP\275\f6Ho\366L@FsRD\361 (\305\247\325;\025Xe\345 \330"
+	.ascii	"E6\261Z\032\225\377\361\204Y\020\031\332\352\353&+\001\211]M"
+	.ascii	"\203\r\241Zm"
+	.string	"\253\274\316\035\b{k\305Y\357-\277\313\247\325\2257\205\024\315Z\025,\331i\33033\026@\364:\206\245\211\212\032\003\006X2\207E\022.\001Z\354\022\355\025$\022\"\022\251\234\362\007\025\214\232\004\026\345\223@'\370\263\275\337\017\356\212\n\202\275\202\f\333>`G\016\304\347\332o\250\343\251D\006\252`<\375^\221\253\260\243|2\225\221\345\207NE\nlL\016o=\331+Q\305\323\263\302\303'#\020\324zyP\"#g\035?\020]s\344x,\313~\211up:\031\211Z\240\031\256\\M\016\001\311\005\024\336\245\b\232\326\372\350\221\346\357\371lOh\f\334\252\032\241\220\324\002\007\312oGl\264\206Nk\317S\262\323\333?\331\0368$\307S\366)U\376\312\256\001\033\330\023W\320\255\304p\270I\212\265\334W\021\301\252\313#/\006 \315l^\2175\320\005H\205\355\024\270\223h=\360\232\335\256\365\373\037"
+	.ascii	"h\361k\r\211\336g\361F\245\266\267\323r\025H\241\002\265\336"
+	.ascii	"?\215xjF\255,\343\263\341\006A;\221\222\377\305b\325)i\352\313"
+	.ascii	"\315/\210\246WiVQ\3515\023\360\221i\260\t\273\227\022s\032\373"
+	.ascii	"sy?Vl\327\222<\201\211pY\325\032\311\242\243\234\257\357\037"
+	.ascii	"]\003\355\317\246\235`\200\204|~\321[\177\342\006\231<|\376\373"
+	.ascii	">\001\302S!u\020\352\217h:\346Xt\345E\346E\374\001\213v%\321"
+	.ascii	"\353\357Z\215b\356\227C\"\375p\021\027\022\200\304\017\251\275"
+	.ascii	"\002o\026W\002\273A^\n\016\034\333if\203\243\333\373#\271\224"
+	.ascii	"\006\247\f\026\0212c\356\364\n\006\325\350\016\017 9\271\b\354"
+	.ascii	"\031\376q<Y\300l\301\204\340+\263\005|Q\t\006&\244\307FD\026"
+	.ascii	"\227\200m2\360\3516\303\226\007\365N\354\303\"F\030C\2758\232"
+	.ascii	"(\304\223\366\332\277\223K:o\256\022\316UKRn\235\003\032\243"
+	.ascii	"?`\245C\177s\022\351\034,\212\241\246f\202\274\024d\362\331N"
+	.ascii	"\242e\312\300W\024\001\b\313\016\313\255\003l\t\2140HM\311\034"
+	.ascii	"\245g[\"7\225]%t\230\244\016\346\001\251"
+	.string	"}\0364\327S\266co\236W\315\313\03796\034\201\200\3118W\247P\272\333kJHQ\013\333\016\377c<\264*D\2234UV\316\030\356\t\020\343\200@\246*\030\260\325\333H\324\3260\344\212\035\337$\321^\031YW\363\367\345\003y`\221\216]\320\324\324\314c[\266\270\026^\227\340\303*\200,\342\b\343'xj\016\020\216S4,\320Ml\033.\254\347#FN\323\331*`|\002G\275^#hO\216\327/TH0~$\361\262\017A\307n\206\325v\001m\031\021\351\367W}6`\242\214\211\331L$\022\244\036\032\256#\036\2066\254\240\030\265R\031De\234C\273.]\355\200\344\271\275\262\ff$\311T\306\262o+\n'yN\244\233\303\177\020u\274\005\265\356\313Ld\212\316\375\252.ko\327G\311\345\243\357\364\312v\353\033\272\306\027\263K\232\226v%\266\0218\252\ba\317J\030\311\007p\351"
+	.string	"u\244\247\377A\344\317G\306r^\264 \245\265\335\274w\275\346\256\367\373S\313\0179\232\213\230\336\007l\220\201N\"\257\025\336\373\344\247\303H\317\245\324\331\271\bD\305_X\276\341J\206\013\001+\235\025_'\005\241\013 i\306\034\265\325\031Q_V\257\351\256\233b\331\b%0\266Q\b\211T\351c\257kA\310\273\267&E\203\3220I\334\030\f\344R)\2527\317\353l\027\333L\341\350R\350\322@\0238\271\202"
+	.string	"\310\004\360 &X\020\2358\263\224\037\235V4cU\234;\3679n\204'\377~\004\331\207\320\177\365VP\341r\202\215G\223\247\236\332a\257N*\006N\210D\231\032Z\232\323\003N\\\355>\306\342\215\254S\246f\221\002\372CN\261\274\333\"m\200\323\220\342\362"
+	.string	"Y\336J3;\344\t\306\336\027\f\264\177s)\302\310\021\371\301\373\235\303\032m\245\013Y\275M\027\020z\005.W\034j\234\207\211\200G\2710\220\037\273\366j\347\351\353\315\200\376\352#<\342\207\340,\305P|\212R\367\323\350Y\031\274\307\324"
+	.string	"\343<0\230;\007\013\367<\002t\035\372\005\025'\221\277H\227\3362\025\030:\241\266\323\222s\004\220i\206_\333\024 \277\004(?\201\255\001R{\002\236n\257=\227\212h\346\275\"8\353t\264\341\367\006/*kF!\255\022N\210\264\350\324\024\203s\256\301;B\346\022\237\267\201\033\223\322\017t\253_\037|\265.\342Pa\343\376\343I\300i,\214\372\210P\255Q\275\241Je\314\032\216\304\"Y37\376\252\245\365\325(\245\302\376\b1\367\366'\341\307\261\333\234\\\313ln\324\2047g\253\351\264\343w\311\355\246\227\241\207<\372\354Y:\227\314\356\r(x\360\303\350\303\024\016\256\250"
+	.ascii	"\265+"
+	.ascii	"]\306\241\254\2633\237I\033FT\306\017m\363\275\266:\250\367-"
+	.ascii	"\270x\206=W\370\266q\020]\\\n\276\267b\223\354\323Ws\203\"\007"
+	.ascii	"G=i\001\237\314\0353\212\251\267(&\305\332\276\260\354U)`\t\364"
+	.ascii	"?*5\355&\340v\023&\177{eP\333$\250\202V\"&\260\251\203\b\021"
+	.ascii	"8\212H\023\034\275:(\r\304\223+\203H\240\032<+\346\t\b+\2409"
+	.ascii	"\215m.\210\221\325\231+\245\007\213.\363\355\320Ae|)\207v\201"
+	.ascii	"[\343\354\207}\035\236\037\327a\016 \023\177@~\257kX\302\354"
+	.ascii	"\017p\242E\202\263\204\002e\377\226\217\036o\225\007TI\311\365"
+	.ascii	" \"\261r\215\201\026M)\262\241[\024\342LA\307YQm\240\221\005"
+	.ascii	"\004\270\016x\013B^\233%1\r~\374#\326Mg\267\255\365\201=\262"
+	.ascii	"o\315g' Z\006}\242\032\265c\035\341\341\330\ri&\202\237\3679"
+	.ascii	"\225^\240?\262\306\256\320\224\200\252\f\255{\007\003VuE\311"
+	.ascii	"\334\323\3722\267\216\204\004\230\324\316*\201`{\243&\220\365"
+	.ascii	"\372!3S\276\030\254\b\203\th3\006\342*P\320\024\262\366\217\234"
+	.ascii	"\230\031\tc\354\340\315\354\017\373q\210\034\305\237\372\315"
+	.ascii	"kT\224\321'Sq-h\217/\246\330{j\221\347\"\343\375H\330D\373H9"
+	.ascii	"q\245\226AR|Q&s\317%~\020"
+	.string	"\316\217\036.FT\322\210\317\364KWq\353+\351\320\235l\336'\376\031\253\371\350\017\336BS\013\367\356\316\346>\260\3668\226{\251A\275h\362\332\357fW\027J\252\210\211(\374;R\272q~\244<)\304\004\240\317]tC!\f\261kh\350\256\2711\002\030\211\350\207a\230\300J\255\351B\341.\016(qE\323\370L*\370Ad\2314\217\315\374\262rf\371\361\320\210\366\323\340\034\003~\332-\360\0061&\177r\300\312\252\200\024\332\346\314\243\244\247$\201W\261\306\235\305\347\016\300\016@\005\005\306J\020\335A\201\333\351t\31497\246\243+-<\330\237\017\001\306\352\247\254\333\022\344h\007\266\247\311\203\315\023\341jS\271\264;\246\201\363\335\374\266Co\b\177\214\037\rL\022\307\354?\316\034V\266~\351\203\201\336\207\261\001\3565\274\301v\033?\314\202oB\257\307n\244Y\226\324\223\3604\275\3769\304\024\370"
+	.ascii	"J\013\273/b\215O\371\227\340h\333M(\352)\f\350<\242w4\033|.s"
+	.ascii	"\373\306\334\356\277\026\f\240\007\273\251\237e\276pb\274\241"
+	.ascii	"\303C\336~\230\bu\340\336\246\315^\362\257\345?I\304e\307\376"
+	.ascii	"\237.=\035\375\221;{\344\267=\370\345\354\212\333\023\307V\331"
+	.ascii	"uh\306J\246qB\177\210\277\332\366I\177\322\261\036\220\372\372"
+	.ascii	"*\316\227\260\3501<t2\201\343\236 \232\363\374\025\357\254a\362"
+	.ascii	"wl<`\324\261\223!.\276V\234\007^L\310\001\217\277\307\351\274"
+	.ascii	"\336\313\037\222l\006~?3n\363y\251\226]x\323\0139\016\350o\212"
+	.ascii	"_\344!\362\006S<]\001"
+	.text
+	.section	.gnu.lto_.symtab.576a78dc81f5a40f,"e",@progbits
+	.string	"tcpTotalRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"tcpTotalTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"isTcpTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"tcpRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"tcpIsStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"tcpDataOut"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"tcpWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"tcpDataIn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"dyad_listenEx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"dyad_addListener"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"dyad_setNoDelay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"dyad_newStream"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"dyad_setTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"dyad_close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"dyad_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.576a78dc81f5a40f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
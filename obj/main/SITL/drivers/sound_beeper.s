@@ -0,0 +1,235 @@
+	.file	"sound_beeper.c"
+	.section	.gnu.lto_.profile.76e4488a03353838,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.76e4488a03353838,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\003"
+	.string	"\354\301\314\336\005"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\354\301\314\336\005"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.76e4488a03353838,"e",@progbits
+	.string	"(\265/\375 \037\335"
+	.string	""
+	.string	"\250\023"
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	"\001\002\001"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.76e4488a03353838,"e",@progbits
+	.string	"(\265/\375 z\205\001"
+	.string	"\004\002n"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\005"
+	.string	""
+	.ascii	")\034Ecs]n\342\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.76e4488a03353838,"e",@progbits
+	.string	"(\265/\375 \037\315"
+	.string	""
+	.string	"\210\023"
+	.string	"\003"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\001"
+	.string	"\002"
+	.string	"(\201o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.76e4488a03353838,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.76e4488a03353838,"e",@progbits
+	.string	"(\265/\375 $\235"
+	.string	""
+	.string	"H\030"
+	.string	"\002"
+	.string	"\001\002"
+	.string	"\002"
+	.string	"\003"
+	.ascii	".[\200\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.76e4488a03353838,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_systemBeep.11.76e4488a03353838,"e",@progbits
+	.string	"(\265/\375 \343U\006"
+	.string	"\242K,2`O\322\030\024RH\034\363\004\360\320W\177\330\353]\006d\230\217\3036m\224\250\367m\333\201K6\260\020\004C\252\261l\203y8\213!h\003\362\367\226)U\025\257\370<I\022b \224\200\240\256\212\210=LB\013KR\357\262\"&\336$\261'!\0341P>\212\030\345\203\262U\3079\310p\032\237e\232\373x\005X\307\371V"
+	.string	"bP\262\333\361\342\262)\317\211\310\257\320\337\33234L\355\\D\312\242\322A\331\315\024^\020\320\347\371+\321\006\201\t\007I\313\356>\027\242S\333\\uD\0074\233\214\266\200\207\335\275i6\036\272\323?\341w\3701\002\b"
+	.ascii	"3\003\316\231\301\341\313]\303\277!\264\222\032\027\356\306\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_systemBeepToggle.12.76e4488a03353838,"e",@progbits
+	.string	"(\265/\375 \303E\005"
+	.string	"\202\311#+pm:\240k7USW\\\366]\243\246\216\035\303R\350\346\225\217\027\364\260\264\226\206T5\004c\344WF\342\237\013\020\351\275e\n\267\252:\2659\037\215+\223\320\215\267:'X\2758\303\034\020\266\352\306U\342T\233\225#\224V\246\302^\t\"(\262\362\207]\224\232\177\001-\301?\026@\006R7\346d\352P\340\303\371\277\324\271\177t\260\020D\027O\251\273Yn\226\333\310}\267\263\003\357\3536\n\030\335\375\350}\231\275\334\377\212\377\213\377W\b"
+	.ascii	"3\003\316\231\001\340\313]\303W!\364\313\270\341r,\332I\006"
+	.text
+	.section	.gnu.lto_beeperInit.13.76e4488a03353838,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"\342\214/2pO\032\003$\372\360\377\266\257\210\237\033\356\372-\001\034<e\252\021\231\320c+\025\321|7-\231\326\377\277/\342\221]\370:t\035\331\004mI\244L)\022TD%'\251\023gFO\214\020\016\235\252BZ\320\232\321\202\232\035XQ\017\023p\232\026\344\034Tz\342\204\024RN\250\311n\207\325"
+	.string	"\303e\264\331\2479\220\326\230\377\257\303\332\266\360!r\331\240\374\034\243\227\263<\025\021M[\267\326#&\271\\r\341\201\037[I\371\263\204*d\374\232\271@\362\313\230@\362\353\325\266l4\004F\033'\242\377\320\205\370r\273j\2338"
+	.string	"\024\372\270\0014\374o\003\205<\\\347\266\bm\031\332v\004\b"
+	.string	"2\003&j\006.\234\200y\227"
+	.ascii	"\232\325\224p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.76e4488a03353838,"e",@progbits
+	.string	"(\265/\375 Ne\001"
+	.string	"\024\002J"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013\177\002\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\f\177\003\r\177\004"
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.76e4488a03353838,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.76e4488a03353838,"e",@progbits
+	.string	"(\265/\375`7\005\005$"
+	.string	"\nD\004\017D\200jQcM\241\321\324\032\374\272\273<\016$\211q\271\307-Ma\232!\344\354\314G\347\323.\242\266\020\222_TG;\b}\027\304\215\350\210\256m\265R\342\034=\375\356\221K\215{\243&\by\377\346n[\246\321"
+	.string	"\325"
+	.string	"\327"
+	.ascii	"Q?\221!\003\302\312t\t\001\364\267GGG\007\216hW7#e\310\274dn"
+	.ascii	"\231{\204p\315\370f\271\\\236\001\333\267e\023A]\270J\3232P_"
+	.ascii	"\b\247,\231\274\020N\367P\n\267\350</\201\323'\300\230?\332 "
+	.ascii	"yR\2326\201z\004j\017\350\325r\267\334\243\321\355\"S\263\f\b"
+	.ascii	"0\210\312\240@\245\351\f\250\202,Gr\001\324\327\350\274\311k"
+	.ascii	"t\032Ek\267\350,/\201\263\301-:\335\336\242\023\275\004\316\253"
+	.ascii	"U\336\254\273\345\253u\255\270\002\222i\301g\375\355\3252\177"
+	.ascii	"\340\275\016\004\334\353`f\246\n\310u\232.\321\322\276l\256}"
+	.ascii	"\301\330&!\263/\027\333xl\323\261\035\307v\033\333Y\266g\266"
+	.ascii	"\331\3306\223\311d\322\266\b\373J\260M&\0014>|\360\027\331\241"
+	.ascii	"\030\020\310\375\212B\352\210\372\002do\373\037\2010\312\b\373"
+	.ascii	" r\305b\177\254\250\025\027^P[\344\227\\\244z\244\370\0344\376"
+	.ascii	"\004\302_\275G\376W\377\013\r\213\355\037\244\266Z\t\205\377"
+	.ascii	"\324\001\341\213\252\030\032\177y\264\363E\\\215FX\234\230-F"
+	.ascii	"\253\327h\325ku1\252!jT\261<\307\377\333\007\265\"\362\340S\232"
+	.ascii	"\366uc\337+\267\275mdk\016\366\307\277\265\235g\246\300j\224"
+	.ascii	"&X{`\006\026\214rU\232\276U\250-|\271a\004\310~\"ZVH^n\327EN"
+	.ascii	"a\250\262u\261\3344w\314=s\221J4d\035\365\374\255\355\253\346"
+	.ascii	"\242\271k.\233{\274i\256\227\357\327\025\343\262\375\203\377"
+	.ascii	"}\271l\234]\001\351\246\271\306\333\265 [S\320\"*\016\240\377"
+	.ascii	"\370\322\231\205a=\351*M\227R\250\357\233\213\364\205s\274pn"
+	.ascii	"\234;u\331\230\327\216-@\237*F \252\342s\005I\230o"
+	.string	"\034\347\241\375Y\377\027\230K\306|\334)M\377\271Z\266\001\320nH\221!\"\007\265\317\003\207\377\245f\355\207Q\264\363\316\356\215`\007\270\262\373\340\267\321\330?\304\211\037\364\312\013(\2444m7\270\247\374\252\355\355\207\253\221J]\265\204\021m\355\213\030\270\361\310\327\226\212h\262j\371\366\367A*\242\213\265e\207k\313\252\265\007Y\365o\211\265\365\bT\357j\244\"\256F\226h{\360\352\215\300\"h\220%\256`,\261\266\032\201\3045HE\264\025\235$)\332\b\013\203r\367\254\301\353\020\026\201\303\032rm\331\213\375\367\030?\335\356\303P\312\302\311\211G\242\346\007Oi\272\241E\372\363\305\360\r\231I\327Kw\251\023\352\013I\022\222\224`\bYi\211\302\022\205\323JK8\334R\022\016u\022N\366\363\212\tPiS\356\346\364\244\300\274\247\264w\373\361x\275\033\321/\227\204Cc0\355\322\027.\322\236\n"
+	.string	"\276\234\223N\305\216\307\001*\355`\373\345\204\234P\220\340\351fM\351\257\227B\355>\370tC\277\234\322o\247{!d\034\216C\203\022 <\240L\023z\351S\232\246\3105\355^\360|7_/\205\322\365\232n;\035\212\0267\246\236\3576\301\301N\207\242\327a\227>\205\360\351\210X\360x\033r3\213Y\354\342A\377'\255\314\031h\256\222\214\371\342\271]\332\036\202\356\020}\351\221\252\272c\207\266'I\2202`-mK\211\036\260\322\254s\275l{\300\035\254-\255\2219s.\035\264e0\266#P\250q,f\2144J0#\023\214\214\204\321\024xp\002\221\261+\036\021\3005B2\265\240\2056\003\207\233\221RxSC\302\247\204\252\204\360&\003\276\001Xn\r$\226\260\360\0033\f\256d&\005\324\234\266\327U\236\367\222$n\247\200\314\215F\344>\241\370\335\254^"
+	.ascii	"\262\350H5e\323\304T\254\315\330\312\r\2640\372\370\335\270\313"
+	.ascii	"\202]\210u\376wE\325\215@\331\322/\333M\302n\023\224*W\271\350"
+	.ascii	"x8\201\324%@\315Fn\273\263\251\020-\001\373C\203'\n7\006\021"
+	.ascii	"\214\355\237\360\032\356\212j\266m3\205\222J\256\034\333r\316"
+	.ascii	"#\n)\264_\357Q\347\021\216N\324\2258\r"
+	.text
+	.section	.gnu.lto_.symtab.76e4488a03353838,"e",@progbits
+	.string	"systemBeep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"systemBeepToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"beeperInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.76e4488a03353838,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
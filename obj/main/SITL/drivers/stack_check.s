@@ -0,0 +1,248 @@
+	.file	"stack_check.c"
+	.section	.gnu.lto_.profile.4ae6e647e3ae6369,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4ae6e647e3ae6369,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\302\252\341\340\002"
+	.string	"\002\302\252\341\340\002"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.4ae6e647e3ae6369,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\002"
+	.string	""
+	.string	"\003\002"
+	.string	"\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.4ae6e647e3ae6369,"e",@progbits
+	.string	"(\265/\375 VE\001"
+	.string	"\270J"
+	.string	"\002"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\006"
+	.string	"G9\354\f\260\031\356\315\3410\257\337"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4ae6e647e3ae6369,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.4ae6e647e3ae6369,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4ae6e647e3ae6369,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.4ae6e647e3ae6369,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_stackTotalSize.9.4ae6e647e3ae6369,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"u\007"
+	.string	"\322N44Pm\323\001'\243*\310\251\272.\250\233Q\260\021O\350\255\207\242\225\337\"1\315f)\177\363\036kc'Gff\331\251\365\214E\237\204\250\326m\333[\312\224\002\2260\033iJ\220\0166R\206cE\253\232\0344\025B\\\320d\024\242TY\0213`\212a\252\"\207\242\252h\341\366o5d\275d\n\341k\352M\376q\021T\354f\327|\217s\r\276\305\241\037\256\274v\350_\321\341\365\237\224,;\233\363\244N\330\177\253!\333\351\314\364_\005T\"\320\355Ft(K\002G.lwl\213\257\361\215\216\261\307Ul\021H\307'\344d\227\213\227\007D\207\357"
+	.string	"\321\241R\034{b\3769\3762$D\264\315\363\254\030\354\256S\333@\267\336v\201\355h\033#\t"
+	.ascii	"\023\013\275\263\030]\b\351P\345\342\232x\034\221\263\020y\270"
+	.ascii	"+\246v\222\001"
+	.text
+	.section	.gnu.lto_stackHighMem.10.4ae6e647e3ae6369,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"u\007"
+	.string	"\322N44Pm\323\001'\223\003\202\234\252\275x%|eD\177\336V\347@Q\225\325\020\323l\226\3627\357\2616vrdf\226\235Z\317XtU\210\312\206%{K\231R\2360\233\211J\230\0166S\206s\305\313\242\0344\026B\\\320d\024\342d]\0213\340\212\201\262\"\247\252\254h\351\366o5d\275h\n\341k\352I\336\201\021\210v\265o>\307\273\006\277\342\320\017X~;\3641\351\360\372O\212\226#\273\363\244N\330\177\253!\333\351\314\364_\0054\"P\262\0331BY\021\030ba\273c[\374\214kt\234\275N\304I\036 \237\217\223\335.^\036 \035\276\003H\207J\361\354\231\371\337\370\303"
+	.string	"\231l\234\347Y1\330]\347\306I\334z\333\005\266\243\355\213\t"
+	.ascii	"\023\013\275\263\030]\b\351P\345\342\232x\034\221\263\020y\270"
+	.ascii	"+\246v\222\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4ae6e647e3ae6369,"e",@progbits
+	.string	"(\265/\375 D\245\001"
+	.string	"\264\002@"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\t\177"
+	.string	"\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\013\001 \n\177\002\f\003 "
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\340G\204\245\236"
+	.text
+	.section	.gnu.lto_.refs.4ae6e647e3ae6369,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\001"
+	.string	"\001\002\002\003\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.4ae6e647e3ae6369,"e",@progbits
+	.string	"(\265/\375`%\003}\031"
+	.string	"vr\257I\260X\325p0\021A\227\016fd# \304C}J\230\376>,\006\264b#\204\366\215\210]\302\377\026\300\227\372\311>}c+A\223H\2160\003\337'<\016o~\232\2124\b\263\027a%\372k\234\355(\314\267\277M\266L\001\213"
+	.string	"\222"
+	.string	"\235"
+	.ascii	"\013\264\005O\330~e\272\352\177\0048\333P\372[\320\254\221\376"
+	.ascii	"5l9\277\r\251\006/c\203$\214\334\201|\376\004W\177\334O\356\203"
+	.ascii	"\377\311\377/gN\375W\304\230;\034\356\027:\200{\216$\342\363"
+	.ascii	"\207>(@\324\\\207R\026\221\336\272\373\217J\256\t\224~w%\335"
+	.ascii	"9\256\344\321\201\376/\225q\207\252\230\022\212\300\244\026\266"
+	.ascii	"\221\214\330\326\260\332>\331\213\263\r\264\235d\373g\273g[\264"
+	.ascii	"\255\304\266iiii\311\366\006\333\252\035f\t\377\215[\243\031"
+	.ascii	"\214\016\355\323\313\363\177\n\027\365\247\r\306\353\262\253"
+	.ascii	"\262\007\254i\027\334\204RO\342\2502\322\030R\262\ben\333\033"
+	.ascii	"\342/\321\253?S)\023\253\016\375yA_a<\365U\367\337\322\207\345"
+	.ascii	"\325\2431\277\351\320Q-\245\230jz\246\256\226\347o)\271\327\235"
+	.ascii	"\246\257$S\346\252#S\246\252C\177;\271\346\215w\363\226\242)"
+	.ascii	"\034\252\3564\327\022\2151W\035\272\003\302d\311\214y\373\t\\"
+	.ascii	"\256<c\202\246\232^\351_\237\317\317\005\177.=\225\312\240\241"
+	.ascii	"\350%\032\355\365\031\255o\177\313;\n\327\357'\t\226_\250\001"
+	.ascii	"\314\217\217\013\242P\\!\213\344\375m\020\327\334\330D\362^\364"
+	.ascii	"\263I\377r\177\250-\177\211\332\235\331\235\021u\f\315\020r\022"
+	.ascii	"\2751Fo\320\350\335\261E^\036F\313c{Ks[\223\027\253\243+@h`\271"
+	.ascii	"PN\205\002\"!B\255x{v\315\315\376\200\371\213\376+0A\271\021"
+	.ascii	"\234\021\212\253\356\321\032\251\226\347\365\261\253\001\334"
+	.ascii	"\324\257\277\212\002\360\204J\013_(\312\254\201\223\270\005N"
+	.ascii	"\3460zU'\324\252N\356a\035&\001:1X\255G\366z\001!\253\220\343"
+	.ascii	"aF\001\206\006\313\211\211\257\013\257\235Y\205\027\3123\346"
+	.ascii	"\t!\243\255j<<\264\225\200\332\253\006Bmg&b4\213\025A&\203\205"
+	.ascii	"\tc\354\201NL\226\023{\255zh\262\0213Z\207\325\316\f\006b\025"
+	.ascii	"\243\365\254\036\310\310J\314.|\200\325x0\350\304`\265\036\002"
+	.ascii	"\216\315h\262\035\231\207\3216-\007-\034\022/\306q\321\270hN"
+	.ascii	"\306q\261X\256\026kt\213e:bo\2215\262?\223\357WS\022l\260\210"
+	.ascii	"\022\212V\327\300i\334\002@ R\200\234\226\036@9\222\222\2667"
+	.ascii	"\376'\325\2438\371@\372I\262F\246\351$, P\002\021\224\203\344"
+	.ascii	"\001\346R\364qq\002~\241\370\221\242\030\355\256\237\026\013"
+	.ascii	"b\264\202|d\206\235O\336J\311\325\210\\\026hu\n\211\036\200\241"
+	.ascii	"\305\3750\302\303\216\016\262\210\nK\f\306\026;L\3552\311\376"
+	.ascii	"\355\227\025\263\002\0274V\023yM\314v\247.H.\215\261\f\225\203"
+	.ascii	"\354h\354\245#\267E\\[!\232\031F\214\215>\314\272>\233P"
+	.text
+	.section	.gnu.lto_.symtab.4ae6e647e3ae6369,"e",@progbits
+	.string	"stackTotalSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"stackHighMem"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"_Min_Stack_Size"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"_estack"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4ae6e647e3ae6369,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
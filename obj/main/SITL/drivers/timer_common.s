@@ -0,0 +1,198 @@
+	.file	"timer_common.c"
+	.section	.gnu.lto_.profile.aa7c8ec85a70db81,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.aa7c8ec85a70db81,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\317\253\250\341\002"
+	.string	"\001\267\335\335\337\n"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.aa7c8ec85a70db81,"e",@progbits
+	.string	"(\265/\375  \325"
+	.string	""
+	.string	"\220\024"
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003\001\002"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\002"
+	.string	"*\001m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.aa7c8ec85a70db81,"e",@progbits
+	.string	"(\265/\375 VM\001"
+	.string	"\320J"
+	.string	"\002"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001"
+	.string	"\005"
+	.ascii	"\216\242\261\271\356M\3440\233\207\001\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.aa7c8ec85a70db81,"e",@progbits
+	.string	"(\265/\375  \265"
+	.string	""
+	.string	"`\024"
+	.string	"\002"
+	.string	"\001\001\002\001"
+	.string	"\002\002"
+	.string	"\003"
+	.string	"+\"R.\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.aa7c8ec85a70db81,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\001\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.aa7c8ec85a70db81,"e",@progbits
+	.string	"(\265/\375 %\255"
+	.string	""
+	.string	"X\031"
+	.string	"\002"
+	.string	"\001\002"
+	.string	"\001\002\002"
+	.string	"\003"
+	.ascii	"/e\200\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.aa7c8ec85a70db81,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_timerGetByTag.6.aa7c8ec85a70db81,"e",@progbits
+	.string	"(\265/\375 \376\035\007"
+	.string	"\222\21525Po\322\030 n\203\350h\253\361)\334e\002\311\032\203O\006@\257\001ul\b~\200\265\205{\316\030A}\306\3152\303 \006+\243\306O5\364i\031$\356-S\025\035\211\210Q[\034O\314\262hM\310+\303@\360#\257\013LR@\017\326\311\240%?\220\203p\264\270$\004\305(\341f\256n\325A\306\023\375\f\271\027\362\n\260\017\344\035D\351\024c\340\262\3131#\263/TK\311\257\375\346\177\356\033\0344M\301\370\355z\230J\273sa\006\215R\377z\242(\332[\301\034!\t\210H4VN\273\023>\225\240RJ\243\003\225ROD7u\333\252*\232`b\372\200a\031\205\324\005D\354\356ncD\322\237\376\n\377\303\337\021\b"
+	.ascii	"2\003\202\341\243\302b\025\220k8\007\213\001\331!\342\353\232"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_timerioTagGetByUsage.7.aa7c8ec85a70db81,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\365\007"
+	.string	"R\21788@o\323\001X\340\311\006 '~nz7\377\204p\240pwZ,\263\024m\274F\002\013\377\032\233\275\355:\341GQ\025\222\b,\273\001R\214,\t\317\376\206zI\333)\005\023\331\207\323$\350zh\310@\227\027\2411\326\341\272m\3530\007\232mZhz4\223\320\350gr\332\265M\214z\263S\340\016\"\2433\324utn\352\036\2648\026\324\310\256\242Hy\330\257vwMu\330\221\001\343\364B\220\262K\212\201\331\026\271b\262\375\331\033\333U|\245x\300\216\\\302\205\314\245c\264/\362\221\357$\025\326\354n\260\250\354\326\003#d.9\037\260.\253\013X\227\266\235\240\360\031|\005!Y\034(\027&\247\335:\251\217\203\217\240\377\222W!\032'aI\364\b\340\331]\307\260\224qS\267m`\333c\333\024\t"
+	.ascii	"2\003\202\341\243\302b\025\020]\363\036\026\307\b\367\032\240"
+	.ascii	"\306\230\256I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.aa7c8ec85a70db81,"e",@progbits
+	.string	"(\265/\375 65\001"
+	.string	"\3602"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\006\177\003\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\007\177\004"
+	.string	"\002"
+	.ascii	"\200\206\313\3161"
+	.text
+	.section	.gnu.lto_.refs.aa7c8ec85a70db81,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.aa7c8ec85a70db81,"e",@progbits
+	.string	"(\265/\375`\214\005\225$"
+	.string	"\nD\370\016F\200\336\315p\021\302!\213\207/^\356\r\236QT\376\201e\360f\246\335\226\021\020\240\030\326~,\226\020Y\330\022\002\251\343U\232\360\324\305v\f\312\031/\230\351~\202\243\370J\225\313(\251\261"
+	.string	"\004\025\261\331\266\333\226)\306"
+	.string	"\317"
+	.string	"\340"
+	.string	"\277\201\257?\360G\367\307\377\350\177[p\270\3763n)\026\020\370\307\020\002~\210N\241\372I\343\231\2270-\022U\334\024&E\254\243X\321M\253\324c\335\354*x\026\321$\257\372\277jN,a\2134di\344\231CdN\034\262\264\205eB\022\311\352!F\2266:7\311n\255\326.\261W\311\026]n\251/\376+O\315\367b\254\213,\025l\220Y.\220\351\0352}v\310\\#\233\265Z\t\026\211!\030\271\206n=\353_}\312\027c7z\220\245\035\234\336#\006\362\335\310\344\351M`n\332&0\3036\b\232\355\322\336\035\266\303l\203\3316\332fb\033\211m\035\333b\266kiiii\266\225\354%\262K8\001^\364\364\272A\346\311fW\333"
+	.string	"\314\2624<l\220\245\243N\223\266y_\360?\013\235\365\301)\001\246\275^\235\335!\233gk\313\340w\217\331o\225c\315\371\243\313G\203,m+\370\220\037\375\371\372`Z\274B\323%d\302\237\3655\b\274h\343\351z%,U\224\374\372\375\357J(\"]\325`\272\252\350\355?\025\375W\341-5\372\320M\213W\302\264\250\n\177\376;\372\242\257\306\371S\205\251\026UxK\213>a\372\273\022\376"
+	.string	"s\020\215\244g[2\266K\372\273\025p\350\013\336\216\351\252\336\354_#\325\203\f\376\241\0324\363\301X\257\251\243\325\024\227O\335\365\177\001\340\024Q\375\357\230\002Q\177 S\037\016\224\200\256\307\353\330#jc\370*\2526b\027\013+o\376\325\314\226\3313;f\311\254\326\236\255\227\267l\315,\264\376\277\377\r\204"
+	.string	"\210\021\273\260\021P\232\254:Wh\201\302\200\331.$.\300\310r\277\354T\371\240\"$K\223?\275x\255|\234\020\223sz\337\234^\264\323\306\r2\275`N\0377\310\274-\220y\345\312\206\235\353W\230D\243\212\">g\276\270\206Y\274a\353\316\217\031d5\310r\261l\023\037\027\3018C\2624\233u\242ClC\246\313\353\364>Y(^.s-\330>\370T\031\332\340\312\f\224\026o\036c8\264fYD\034Q\274`6\004\243\255\"\340\317\372\217 \200\2276\353\027Y\305^)\333\265Tji\225z\343\277\376\364\034\227\024\021B\226_\253\217\225\260*b\302Sk\247\254\327\372\013\225cr\276\310\3102\376@t\240'\025\242'\005ez\320U\320\2050\241\264\244!\203\322\216\323\256Wk\312\365j tOO\271\017L\266(\251"
+	.ascii	"\003\314\300P!t\274\242\036\024\024\257h\247\027\265\244\343"
+	.ascii	"\345Ht\340\3450\3704\345\224LL\350\351.\360\230i\307\323=\351"
+	.ascii	"\232NK8rp\204T\302f\244\244\007I\017L#%\341pIG\270\323G\270Z"
+	.ascii	"o\t\251\367\264\223\262\351\226\232r ,\350\232rQ\034n\275\245"
+	.ascii	"\246\234\022\324\316f\034\216\202\002\016\033.\234LDOPNNPLK<"
+	.ascii	"\235\323\256W\024\305\323\215\330\361:\024=\355rNEL\274\250\""
+	.ascii	"\242\005h\320L\337\230!ed\371\265\376t\312\304Q\335p9\256\223"
+	.ascii	"\036\364\366)/X\260V\213\230uR[\261lM\210ac6n\317v\3136\251%"
+	.ascii	"\t\236P\224d\211`\343\316\226l\303 Q\005\001\244P\"\005m\273"
+	.ascii	"l\334\331v\331\265'Y\250q h\2203\206\030S2\024M\220\331B\007"
+	.ascii	"`\002\0212\263n\021\220AJ$RX\250\354\354\033MWs\251\241(\227"
+	.ascii	"\207\225\264Tq]\250\366 \"\372f\220\210\306\374\353\320}D\030"
+	.ascii	"]?s\332\356\222Z\312w\273\203W\267\340\246\221\004\371\037\352"
+	.ascii	"\235\357a\375\263\006\331\335\370Lg`\244\375\327_\363HA#\205"
+	.ascii	":\226f\274\201\n)\f\022l\307>\322I\301\322\026\221j\036i\034"
+	.ascii	"\206\032p\216\376\220\374\223\346\223*\202\213\021\021Z\341\257"
+	.ascii	"\036\262\030]\030\271\212\245\f\376D\264\315\266e\255%\373x["
+	.ascii	"\tuM\016\225\036\245PF\300\t\210Z\332\336Z\244\022?\231\273|"
+	.ascii	"\377L\317\2622i\234\363\267\312\214\257\330\346\370Z\374\316"
+	.ascii	"Y,\217\304\177"
+	.text
+	.section	.gnu.lto_.symtab.aa7c8ec85a70db81,"e",@progbits
+	.string	"timerGetByTag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.aa7c8ec85a70db81,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1988 @@
+	.file	"config.c"
+	.section	.gnu.lto_.profile.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375`6\001\375\b"
+	.string	"d\r*\002"
+	.string	"\032"
+	.string	"\367\207\374\251\r\f\002"
+	.string	"\002\001"
+	.string	"\002\003\002\004\002\003\001\240\342\234\212\n\003\006\321\211\300\200\002\002\007\350\223\272\372\005\b\264\215\316\215\n\002\002\004\002\005\n\262\374\202\245\005"
+	.string	"\013\325\374\357\356\nT\002\006\004\002\007"
+	.string	"\b\t\002\n\005\002\013\002\f\004\r\001\002\002\002\016\273\203\325\342\t\020\360\356\366\360\003L\002"
+	.string	"\002\016\017\020"
+	.string	"\002\021\022\026\373\323\226\350\001"
+	.string	"\027\257\323\300\356\004"
+	.string	"\030\212\372\355\362\t"
+	.string	"\031\271\313\342\254\r"
+	.string	"\032\336\310\256\264\f"
+	.string	"\033\254\245\232\372\b"
+	.string	"\034\231\201\201\232\001\004\035\343\307\231\244\n\b\002\023\002\017\024\002\024\036\307\276\344\257\003"
+	.string	"\037\230\225\332\336\004 \341\240\310\330\001!\"\240\301\276\347\017#\260\314\343\322\006$%\240\342\234\212\n"
+	.ascii	"! \260\202T\233:\025\362\243\3135\325&lZ&\240{\320\220M\234\303"
+	.ascii	"F\207h$0\213{q\001B\006\271<_8(\360\363mFk\357\035\227\367\246"
+	.ascii	"\023g\345\276\330|nb`WC\365\265E\241\023\370\233\n0\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"e\003"
+	.string	"\304\002\370"
+	.string	"\020"
+	.string	""
+	.string	"\001\006"
+	.string	"\003\007"
+	.string	"\003\b"
+	.string	"\003\n\013\020"
+	.string	"\001\001"
+	.string	"\026"
+	.string	"\003\002"
+	.string	"\001\027\001\030\001"
+	.string	"\001\031\032"
+	.string	"\033\034\035\036"
+	.string	"\003"
+	.string	"\034"
+	.string	"4\t\331\212\001*{)#\314$d\271\f\210\00532\357v\035`\201\254\004\336Y\b\314L _\216\0040\367RB*]\025B\254d"
+	.ascii	"\004<\345\357\252\t\224\270?\003\224\243\004\006X"
+	.text
+	.section	.gnu.lto_.inline.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375`\004\004e\f"
+	.string	"\202N360\217\222\016\200\271\351K\252|5\210p\273\322\026\262S\031\360\271\355\253\020\211\247RiI\273\013k\326?\030\260a`\300\320\b\0025(\357\344\276\273\257=\2627I\001\377\230'|r\265Z\251\254\007e\210\b\305I\001\035\312Dt\341\331\363\336c\300\222\225\023F\226\357\347\240s\013\026\007!F\026\017RK\300\b\007g\370\200\037\243\021\024f\203\224N\252\355u\001\222\264\275L"
+	.string	"JR[\200\007\234\323\344\330\026\302\212\023i\303R(U4J(N\365f\302z\r78F\035\316\204\237ZZd\210NF\235\211h+\361\016\027\346\362A\314\362m\355\376\f^nl\033\333\360\327$\216\031\266\255\365\r\t\322V"
+	.ascii	"\337iij\333\371\315/\025P\250!\252\232HnS*Lc`\242ATW\036\022"
+	.ascii	"\340\3030Jc\006Q#\224\206\202\231\370\231\t,\262\315\212\311"
+	.ascii	"\365\016\021 \263\271\n\033\370N\032\035$Z\025\016\256\307eN"
+	.ascii	"\263\234\005\347e\332\220\256\204\307\220\272\337*\004qP\303"
+	.ascii	"\0320. \324\214\217\200\236`,\263\267a\365F:\323V\344\356\333"
+	.ascii	"\255I\004L\235\372\305V\0015hR\306\376\215b\270H6\267Q9ud\220"
+	.ascii	"\363\t\273U\233N\r\n\322\007~\273J\361{\246\302\311\003\356\240"
+	.ascii	"[\346\0213H\323\003\017\260\327&L\370\241\2463\272\215\233\343"
+	.ascii	"8\376\210e\264\210x\222n\024G\325\230\334\001\201\213*Sa\324"
+	.ascii	"z/e"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375`\037\003\025\013"
+	.ascii	"\262\214'+\200K\322\030s\221,\207\330\024\306\315\307\270\ff"
+	.ascii	"R\013\347m?\023P<\304\214\030\001\3016\3766\261\031m(Z\204\354"
+	.ascii	"\266\211L)\352\202\002\301E\315O\030$\t\bF\351&\367\375\201\032"
+	.ascii	"\250\005g<\306\267\022\222k<\376\343;3\033\032\203<\307\345\302"
+	.ascii	"0\033\314rf\313\302\334\261\343\334\240N\240\265\326Rz\236\207"
+	.ascii	" \312\242\310d\267\326\255\265\203\272S(@\005\320G\035U~t\032"
+	.ascii	"]Q_Q\267\023\267\305\027\017^!D\304Mq$m\210:\322\234n\323\332"
+	.ascii	"\211ybkR!\323@_\250\341\2753I\n\222\032\315\001p\002\031\253"
+	.ascii	"*\036\021\200\030\210!BF\247 IkN\222\001x\275Y#\335\250\260!"
+	.ascii	"\032\fN'\232\n/\333\201\350\206\2358\327t\300G\342>\005\240\256"
+	.ascii	"\022\340\336v\304iEg!8{~h\316\316\355\022\220~\362\276\310\020"
+	.ascii	"\207\247\273\363\265L\224\327\016\361\332C\234\267\030O\264\023"
+	.ascii	"X\3061y\364\005G\bH\235\263\341\340\364\324s\265w3s\3260\316"
+	.ascii	"\2221\353\311\337T\223e\242h\262o\326&\270\002.(Cs\324=W\251"
+	.ascii	"\365\270]\260\2757\250\256a\235\326B1\216\305\003\351\003\363"
+	.ascii	"|\325\261\034\313u\306\\\210\3310\234jS;\006\337\177\324R\215"
+	.ascii	"\022m\212\031"
+	.text
+	.section	.gnu.lto_.pureconst.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\230\004\006\204\004\007\204\004\b\204\004\n\230\004\013\232"
+	.ascii	"\004\020\232\004\026\230\004\027\230\004\030\230\004\031\230"
+	.ascii	"\004\032\230\004\033\230\004\034\230\004\035\271\004\036\200"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\205\005"
+	.ascii	"b\310\027\036\220+\303\001\377\377\177\277\273\273\273S\020\260"
+	.ascii	"\201E\333JJ\312\242-\247[\250-\215\220L)N\365i;\355\262@fG'\303"
+	.ascii	"\205\n\023\"<hhti+\315-\363J\264\215\2342U\200v\346\223\271d"
+	.ascii	"\376\314#[\310\3741\207\266\320\024a\340\330>\002u\343\215\371"
+	.ascii	"\332\256\2713\200\3131\001% \260\202\232Anr\032\b$b?\031<\245"
+	.ascii	"Xh\370\207?\314\303>\374\341=\004\021\321\031\372\031\330\240"
+	.ascii	"V\366Yw\225F\340\b\333\n\227\2537k\254\300\244\370I\034]l\357"
+	.ascii	"h\250\016,~\202\001\205\270\202\033\302\336\b+\326\001\027j\b"
+	.text
+	.section	.gnu.lto_.lto.6db7737d4369196a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pilotConfig_Registry.122.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375 \222E\004"
+	.string	"\244\007a"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\203\324\221\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\336\006us\350\366\005uq"
+	.string	"\005\001\006'\001\"\257 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pilotConfig.124.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375 (%\001"
+	.string	"\340\030"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\005\001'\002\002\177?\202\210\200\020}{\274\001y\273\001"
+	.string	"\002"
+	.string	""
+	.string	"\002"
+	.ascii	")\243\f\240\b"
+	.text
+	.section	.gnu.lto_systemConfig_Registry.128.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375 \223E\004"
+	.string	"\244\007b"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\303\327\301\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\347\006us\377\005uq"
+	.string	"\005\001\006'\001\020\222\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_systemConfig.130.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375 Qe\002"
+	.string	"\024\004>"
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	"\005\001\006\035\001"
+	.string	"\005\001'\002\206\b\177\005\001?\202\210\200\320\001}{\273\001y\273\001w\273\001u\276\001s\273\001q\275\001o\274\001m\273\001k\273\001i\273\001"
+	.string	"\005SITL"
+	.string	"\003"
+	.string	")\"\300\274\177"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_getCurrentPidProfileIndex.131.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375 \357\265\006"
+	.string	"\222\f/5@o\222\016\230>E\267Uh\021"
+	.string	"\027S&7\177\200\257lmw\271\220\333\330\354YG\313i\201\027Ta\212\242\270V\340\360\246\030\025\264\300\f[k\237l\231\002S\233\206\016\307SQ\217\342<Og\301\341Q\326\347m\004\256\036\030\254\007QU\326\323hX]iG\2009\321\377)I\004@fE\302\025\351\210\304\365\350\364\004\b\233u\272 L't\001#\030n\257\211\320m|/\351J?\216.\003\2422\260e\216\266\226L\231P>\376\320k>@\b}U\353\030a4N,JX2\265\3478z\025\257\333\220^V2L2\022E1\243\220\231cF\272\350\256\277\301_\360c\004\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_getCurrentControlRateProfileIndex.133.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375 \357\265\006"
+	.string	"\322\214/5@o\222\016\230>U\177FI6\324\271Q\2148N\201\372\320\316\362\226\013\271\215\315\236u\264\234\026xA\025\246(\212k\005\016o\212\341)\003\314\260\265\366\311\226)W\233\206\016\307cU\257\342<Og\301\341U\327\347m\004\266\036\030\256\007aY\327\323lY]iG\2209\321\377\251H\004@fE\302\r\251I\342z\224z\002\204\325J]\020\246\024\272"
+	.string	"S\206\247\337D\3506\276\227\314\314]\351\307\321eLR\006H2G\247\226D\241J>\376\320k>@\b\215u\353\030a4T,FX2\267\3478\212\025\261[\220^V2N4\022E1\243\220\231\243F\272\350\256\277\301_\360c\004\007"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"\357\232\267\204 \341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_getCurrentMinthrottle.134.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375 \375\365\006"
+	.string	"b\r15@o\222\016\230E\\#@\016\fB\206\252!M\300g\320\217\0203\267\027\271\215n\217f\220\234\026xA\025\246(\212k\341\005\0051<YP\345\f\333\304\222-SS\234\007O\347SQ\220\352\300\217\247\001\002R\026\br\f\256\"\034,(QU\026\324\260\272\322\016\001s\243\037T\224\t\200\030/\026\356I5\212\033\322wE(\233\365\335\320\324\227.\300\004\313\355\265Q\272\216\257&\272\322\237\247\333\274\264\034\304\304\230\261\315D\226\267\"\362\213^\340\216\224D\364\225\032\210\306\224\342\202\241\"\023\243\006\007Z0\365e\t\246>\367\321\253y\335\226T\003\303\261e$\213\346\206!\306xf\244\215\356\372+\374\t\277G\b"
+	.string	"\001\023\330\210!\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_resetConfigs.135.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375 \320\215\005"
+	.string	"R\n&,pm:\310\036\b"
+	.string	"O\027\222=ty\321\222\212\212Z\201E\232\360yb\330/C\334\232\377\273\270\272p\356\365]\254\200\"+\267L\001\247V\003\273\262J'\275f\206-\034\223j\220i\025^\037\fmFj\325f%\366r\250\300\214\025\356\316\362\227P\344z\227 \323\3301\367\213\234\344\314\277\200\346\360g\00282\210\272/)T\217\201\020\347\377V\337~\322\212\233^\317\311\362)u\367d\315n+\267\357vv\340}\334JA\242\273/\275\017\334\363\376?\374G\374\237\004\b"
+	.ascii	"3\003n:\203*\\\347\032N\026\302x\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_activateConfig.136.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375`\237\002\325\023"
+	.string	"fbzH\300\324M:\251\013\313:t\030Q\bl\001\360\177\2314\211j\273\303\235\314\2227.\215\022\374?^\372\216\322\233\265\017\333\027=\310\313\234\263\231\005"
+	.string	"U\235T\022\351Y#\"?\245\236\341\350\252\004\300N\237\254%\233H\231R]"
+	.string	"]"
+	.string	"q"
+	.ascii	"\240\372\213\352\375\324\272\352\247\224H\001A\300\233\263DU"
+	.ascii	"\222\271\213PF\266\357'])\3479\257vz\277\035g\343\\\2061\324"
+	.ascii	"\2001\347\304\261s\354\326\343[\226v\3579\241\271\002\"Qc\222"
+	.ascii	"\232s\206\033ty\225\376\221\016\300\266#\273\256\036\3149\255"
+	.ascii	"\266\035\236{o\273\200m\007\366*\b5\252\343\354\341\272&\224"
+	.ascii	"=\356\241O/\200\356\332/\027\275\315*:+\263\356\356kT\263\303"
+	.ascii	"\300\257\356J-\007\3150g\202\261\346\324Y\340/}F\b\237\350\321"
+	.ascii	"21\275-\006>~[<4\246n3\255\262s4] \373\337\334\037{\325(Q}\002"
+	.ascii	"\252M\242\232\265R\257\242\032\\u\f\262\205|!c\334F\300G[\"\311"
+	.ascii	"$\035;\035\211\203\202p#\240\337\332\021"
+	.string	"$D}\253O<P\314\264j\202\213\n%G\003\324\266p\341H/\321\365\354h+\263\311\3728\016e\343\0239\003\013\013\356\006\216\364\226x:$J\277a\3639\t\3314\374i\303GDh\316\311\300\306\2358thi\001\037M\366J\217&R\364\232x\272\023({\262\353\024\216q\201\200\321\2047100\021)~\271``/3\261W\370z\tg`\037d\302W\215M\350\022\340\030\215KMx\023\213\325\204\255\334\354\337\334\037S\230\332\315\226\346\004\n.km\331#}TF\254\314\253e\2518O\002\025Y\255k\350\026\027\334\225\240\017\tr!rh\205,\322\333d\021\370\030\267\301Q\224\321\216\003\352\377\220,z\334G@\250aDe\214S\310hFQR\240\326p\002\241\232+\017\020P\310H\223\fk]\257\342\372\271=\240\223\bl\035\242\254\2622\277-\023\231\253\200\311\006{@\246\322\243\232\320"
+	.string	"\202xdV\251\242\f\thd\3444\206\302O\024\235\351\260\355\356\302\300\221\265w@$\027\3218!\334sX\334\327\322\034\245E\037\243\t\227sP\037%\230`M5\310\353F\022\213/\205B"
+	.ascii	"\320\340I\210\267\202\243\003Xs\bu\336\205\377\032\006\375/\314"
+	.ascii	"R\003"
+	.text
+	.section	.gnu.lto_validateAndFixConfig.138.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375`\242\037mw"
+	.string	"\212\262<(M R\332\032\003\252T\353\327\376\177#\342\027\335\210\267\261/vE\272\032\340\206\316\226\254\247m\323\215\305\2638\177</\222\301\334}\237'vf\336!"
+	.string	"\200\b"
+	.string	""
+	.string	"\020\221\231\231!"
+	.string	"\242\023\327\013\376\252(o\032L\247\337F\331dJ)\005s\002O\002u\002xV;8\264f\322t,4\225i\006\233X\244*\261\006\001:\233;\240\354\275\336\016\027\232\312Bbk\3165\3565\3567F6\221\273\255\247n\273%\021YM\337\256\013\316\252k\326\367\23525\221\217\214M$j\235\266\211l\213h\233\310/<\273\2401\f\275\306\357\325\005\331\203df\227\271KO\243o\021Z\207\005g}\3377\371@\200rrr\230\016\006\013\376f\247\315B\255\333\334\204\351\230\t\317\261\034\307\361\022\206c%L\3457v\343)\0010^\270\030\240\205"
+	.string	",V@\251H\201\""
+	.string	""
+	.string	"N$\237\234\232\230\226\224\222\220\216\214\212L\224 A4bH(\b\350\307\247\207gG'GD\b\02087654\310\231\243\261\330\022\331w\227\033\254\220)\310\244\253\252\271\t\373W\326f\320\223\331d]`\301\341L\027H\026\326\314\244G\363\\\017\271\035;O&\017\347\270\240'\263\007K\224%\207\363\022\023a\315p[\315J\202\236\314-\031\234\251\354\327\223L\253\371-\350\311\324\332y2\263\234\335r\236d7\232\247AO\246\r\265fix2o8\001\207\201d\034F\231~Q\246]\214\361\001X\235CvI\214\267\b3\306\005\270\372yq\026\326^\3215\254\r\305.\371]Y\035#\\]\\\005\227.\236\242\260Q\024n\361"
+	.string	"\b\033"
+	.ascii	"B-~b\260\223\203\177\376\344\327N~}\336D\245\231\002\271\250"
+	.ascii	"\360\371\322\224V\222\342I{\216t\347G\201\\vn\324F\270\246\004"
+	.ascii	"r\325yQ\2236\321\204\316K4Qc\342$\346\232hN\316G\260(\256\254"
+	.ascii	"\315\016\344\232ci\302`]i\2656\037bq\244\354\t,\027*\363b\353"
+	.ascii	" \026g\215=\201\346@\305\002\312\274\324\372'I\373$\221\222\346"
+	.ascii	"=\256\326<g\275\303\032U!+\354@\2563\366G\307\354\255\210\347"
+	.ascii	"\020i\021DB\b\031\342 \2024N\220\267\250\337\214\265\315X\236"
+	.ascii	"\323k\304\232F\f\257\351\310\260\236\t\263\353\341G\022O/\036"
+	.ascii	"m\f\344\342\301\022\3215\t#\\;\274\330o\275tV]\273>\275\330\272"
+	.ascii	"\245\241\211\354R\025\357\007dW\f\254N\216\"Y8\272\256\234\375"
+	.ascii	"\352gu\252\220\025\332tY\261KN*_\255\326\256\325\305t/\026\360"
+	.ascii	"\276/{V\227Ws\004\315\334.13\013\314>>\004M\320\fq\036\312\355"
+	.ascii	"\023\237\212\372\007\304M\3731\2752h\373}\247\205\314M\213j\256"
+	.ascii	"Ey\272\017\257\301=k\233HT\"\213\273Jo\036*\326\f\263\231q\203"
+	.ascii	"\363\260\341\311\016\260\031\337y5:\276f\240\221\201\203w\021"
+	.ascii	"\331\201+\207\214o<\344V\264N\006\255\031\251#~#Zg\003K"
+	.string	"\352\333\356\350U}\345V\316\374\036\256\\\233Eq\317\035\214\017\345\021>\332Mk\225\337nF\252\276X\361\263\3620H\374u\323\246\232?\234k=\307\274B\037\272j\254\317\263\013u\213\005\231.\343\262\271m\006 \3206Q\371M\327&\274\2560\005\351z0=\373\375\326\254\025\355\016\253\f\317\341\200\363Q\024\362~\233\201\226\331\201\007@\370\263\341Zm}\274\331\372\252A\321\317\312\023P\340\235\3054tj\306+\264\032\210'\264\376\355\206\244\352\213\225\035oi\033j@4\373\372\321\267\366\2765:\213\273\207\376b\001\006\032h\320n\300\201w\226\177\215V\032\240\325W\261\017-l/\312\241\301.H\257B\253!NV\365\355\037\n\324\312\266\377\003*\241\225\207af\017z\213\322\370\276/\024\267\226&\224\342&\322D\216!\303;\253\211\3342\332&\366\277\240\001\320\311&\255\341\207\314S\246?\224\271{\316\334"
+	.string	"\371\1770wV\333\350\367\350<c\352\350,#\306\321Y\352\350\254L>95\265[3\023\322y\251\350\254\204tNB:#\025\235\217Zg\243\242s\221\321\331D\353\\\242\350Ldt\036\321:\017\365^\263P\3219\250u\006*:\377\024\235}\212\316=Eg\236\242\363N\3675\353\024\235s\212\316\"\272Js\210\2423\210\242\363\315\321\331\246u\2569:\323\264\316\310\326y\246u>\3168\033[\347\342\321\271=:\023\215\316l_i\376\242\263\267\316\3359`"
+	.string	":\233P\273\027\234\2769\016\307\274\200D'g}\245\273Jw_\367^\267[\263\n-\3105WT\254Y\2600\024\027|\3235+\374y?\240\005\032\253\270\214tZ\266TY.\177\374y\\\320\374\334\352\344V\f\276\337\024&\316\340g\245rK\331\353@m/\311\370\"\372O\342\254yK\320\002\327*3\305\322\313w)\205\242\\5?\262X\rQ"
+	.string	"-yx\034J\343\313\360[\313/K\037\226`\226`\332&\002}\2132\037N\266"
+	.string	"\252^'c"
+	.string	"\374\370\360\363!\232'\252\304$}\256>\177c}z\2477\2768\365\210\351\371\233j\023N\325\324\006\037\023\317\177\340`\232\347o\366"
+	.ascii	"\255\226\\L3/\257\017\3348\241\351\001Ei\347C\300y\337w\347\221"
+	.ascii	"c\354a\221\244\234\317y\276o\316\317\200=W\267\344\220D|M\026"
+	.ascii	"\243\210o\257\356O\370\250G \376uh\020\337<\370\260\372\2526"
+	.ascii	"z\250\017}s\200\363tIfy\350\235u\3635wx\0048\263\313t\257\374"
+	.ascii	"\216\r\220\371UE\017\345\301M3\212\276\357[u\261\206\006\275"
+	.ascii	"\3240\271X[\255*\232\211\007\264y\032#7\274\320\335\352\276\350"
+	.ascii	"\026WGG!\264\371\356\013B\003\006X-\3015\202n\327P4\213\253\203"
+	.ascii	"g\020K\315\027\251\\\322H<t0\320M+\252\202\264\"\210\346j{`\210"
+	.ascii	"\036\312E\301v\267Z\232\247\242\366i\271\237\273e\354\243\371"
+	.ascii	"\"Y\226\253\220\023\335\201\261`n\3602\342\241\314\266\333\325"
+	.ascii	"\"\377\003\252\226\034\276\347v\t\r2\2733\270\236\253\203'\372"
+	.ascii	"\276VPP<\212\013\306\303\r\013k\233\210|5g\324\3116\364P>\n\t"
+	.ascii	"j\033OL\322\272[3\275"
+	.string	"\026?\351\201\253H\261^!'\315\364m\343y\310\024\\\022\364Pn)\3554\345\247\263\236Y\036\241oz-OB%\374\366\037It\274@\017\355\244\266\351;\353{\212\332_\fN\246\037\372\317\r\215\267\203!\337\235\035\325\317j\310\005\212`\325\347\241<\363\307\357\247\2307Q\266\336 \235;\326yn\r\316\304%\373f\337\234\334\314\267^\231/Q>\r2\273P\207s\201H V%6\025%\324\343#\237\370\2459i\276!w\200=\017e\327q\267n)}\\\003#\335\341Nj\205^\213\233\247mM\211\224\355\206\252g5D\001\027\370\267\343\322<\251Tt\214\355\016i\215A<\315\035\022%\206\006\207\206\304\370\257\307#\307\206>\242\214\022#\262$\007\034j\276@\261\032B\021~\261\212x(\377\017T-V\036\246C\\ie[|*\252\231\237)\243\304\242qE\314\212/\024u\212\201x\250\263\207"
+	.ascii	"\312\t\tR\203C,\302\023\n1@\240A\202\007RTI)\037\026\341\t\204"
+	.ascii	")\023\222)\210 cjF\b=,\302\323\f\345\024U\f\024\2224\246P\230"
+	.ascii	"jA\311N5K=\311\230\n\241"
+	.string	"\004\032RI\251\020\222%L)IHJQ\241\220|\342a\032&\304\240J\246@\203\006U\0229\255\321\377\203\211b\336k\265\3063\201\232\357\373\002}\275c\f\3114\225<\234\034\214?\315\237/C\366\315\343i3\320\256]yr"
+	.string	"\323\255\3263zb\200V\020`i$\302\250~\237Y\005\376\223\257\225\374\226\262\357\373\276\017<\264\223\337\3577\226f\307\360\305\305@\026\265\364\025\320-\251#\230\0312\231[\372\032\250\337U\207.`f\016(\275K\221\236y\311\246\364}\244\257\2069\344\032x\350\277u\322\367\223\252\245\355\227,\251MfU8%IO\204\363K\223~\031\034\353b\240\227\324\026\351\251\334\336mIM2+t\256\r2\273>~\272\204cux"
+	.string	"C\225\276\364\333\226qsK\272\272\266\211H\337Y\332\350\252\357*}\301\035\244\317\005\036\312\236"
+	.string	"S7\2266^\221\340@\200\251_\201\f\374\325\360\226Ol\242\260%p\364T\026x\261\227zR\226|\336YGo\023\005\201\207*[4\345\021\022\035uh\206\306\037x\316\003\242m\364TT-}\177\004\207\317a\371Wei\305J\333D\243\177A\344\212\001b\216\024P\364\236\204\257\310\210\345\206\351\265jE@`+\021\276\230zf]\204\370\247'\2701\177R`<\375\324w\323\356\314MK!\344\213\230\271dQ@l\270\302\354\242=\221!\336\f\245m\242\212\301\2477\361-\354\004S\260\305Yy!@`\037\331\304\244\003\270[\207"
+	.string	"\321\006\366\203\013\377&\020\262\001\272\304;PvH%,\203\226x\242\022\303\264\026DD\337j\335[3\264\001\n\340\327J\204+b<\263P:\357\344\364\376d\267(\224\f\013\247\217\361\335\254\273\213\301\311|\272i*\242N_\203\217\302*c\357\314\343bu'\226o\272i)\006\231\233>\314\035C\372\036.YT\331  s\001\317\343w@E\r\235~\304\267\250\323\303*S\303\017\377D\231\246tE\n\277>\262\2059U\270[\353\340\b\271\321\006\365C\357eK\301\327\341v\031\337\327\352k\350\223A\244*\202\036p\346\345\226%\027\357\254\240\237\n{\003\202\253\250\0221%\320\242\216\251\031\021\221$\005)\244\003\222\013\020\206\342x\324K\351\001\022"
+	.ascii	"4-\311\303N)%C\244\206B\373\006\254\327{5s&\300$\227\377\f\276"
+	.ascii	"%W\352\bC5;\337<\303\325\313\210\327\306(\222r\r\215\036\016"
+	.ascii	"\222\022QjX!\004-&\n\006\203k\231B\344\037s\307\207\177`F\243"
+	.ascii	";i\230\353\345n\200\201\230(|\310\347\262|C\230]\333\211M\202"
+	.ascii	"\353\341L\315\313\324\366\271\367._\2206a\346\244'\f\262\023"
+	.ascii	"!:%\002<\003P\351\244"
+	.string	")\001V\337\2035P8QM\374\024\274.\334~\032\203\377\355\035%Z<h\211\302\024\357\361S\266b*\365MQ<\323 Oxk\207VXJx\346^\322\016\215\024\310\f\345\266\367\350\376\004-?\204e\214\337-\365.\245\353N\277r\001\331\206\2634\0056\361L\276~\350m\277\340^\355\340&m\233\354\242\231#\347\214\250ck\252\376S\226\2034\241\b\023\005\247\037\005\374#\222\337\357=e\225CK\325\376C\353\307\007\356o\224~0\035\310\266\273\345\034\327d2\257B\357\006\"\2357\017\3313{w\363\216\242\327\001Uy\233c\320\366\366\202\034\313n\334\351 \2173#G\0234\362k\212}\225\334&N\215\210\374\037\355}t\\\366\326\270Za\013\313#\263J>\202\273\227\354\375\005_\352\266\252,\266\360\277\344\312\2605\351\366\312\206\344\037[\373\275\346W\356\035\273\253\003\346\362f\255\026Lb'\n"
+	.string	"S\272=\036\243\004l$\f\362\"\002zl\0366\272\325z^\202|\2463\362\371]\002\374\325\303\255\013C\313\033f\303/>\033\305&\231\357\340\221I&5\033#\360\277\246\373%\304\364\f\343\243\212\310i'\332^(\3340.\362bPx-<\367\202<d\226\204\245\r\200\326e\215\3554\267\245E\231k\213U\304-\013\"B\305\240\221\341\2728\003\020\371f\021\025pWLlO\314K\262\1776n\001c"
+	.ascii	"\361\303\257\0024g\216\224'\242l\200\274\316\222\307\0041S`9"
+	.ascii	";[\202\235\230\2065+\316?\221;\244hN\017j\004\020\031\374J\214"
+	.ascii	"\360\332{p.#\t\345\231\316S\374\375_F\234\260\365\211\004\016"
+	.ascii	"\200\201\216\367\365b\246\204\301\241\251\2075\223\013\250{\264"
+	.ascii	"]\236\271\353\226\2669\322\370\340\210\260F\262\275\345\336\004"
+	.ascii	"\204E.\024j4m\272NJ\206!U_\026^\027\256\001\006s\311\260\212"
+	.ascii	"(\314\254\216\210\261\330\274\360\325\344\373\360\350P \221\214"
+	.ascii	"\025\350\026\316\r\266\363H9\361\013\245\302\356\013\265\222"
+	.ascii	"\206\213\202[1\331v\232\375\275#\355\344P\330F\032\250\253\250"
+	.ascii	"q\243\020\213\030\344i\021\215|\274=\220\210\244\202%\034\242"
+	.ascii	"\274\227\021\032Ri7<\366\222\006\203\352\346\260\300:%\033\034"
+	.ascii	"\257\371\203\210"
+	.string	"\220\023\273\311\260]\263\034\033+6MZ\306\250U\306\266\223 \245B\237\032\233\316T\016\367\347)@&\336\215$\261\262\036\241k\347\366l=\360\3419\232,\303@-\345\315\024^\331\270\333\365d\311\220\325:F9\214\355Y9\360\303\214\333D\022\253\342jA\211@ \227\240%=\320\276]P\352\211\032\314\260&\264\267\022\006\347\201\257\231:;\232\037I{\343\362\027\225\255\003\361\247d(\320\241GT\266\177\212\303\013|\rO\370\336Y,\302\277B\036\025B\255\037 v\234\266N\361\254\367\324\215V:%P\322\331\242v\216\366\230\331q\333Yv\370\\F\353P\344\366\336\325\b\020\025\333\232nD\207$\254\301\rb\305\345\330\006}\246<\021\357\375\343k\264\240\354@7.\027\212O{\234a\032\022\372;U\355[\232\3776\204\267\274\017\330'7\277/\265b\006\215\2621c\013\372\255/h\375\304\333\027\225$"
+	.ascii	"\207#\314\353F\262\347\247\247p\243\032\375\203\253\271\240\265"
+	.ascii	"Q\302!\206\323\255\323\262\316\\\300\350\323\312\315\213\314"
+	.ascii	"\315E\r\357\246X1]\354\207\306v\341\216bu\031\2530\307r]\326"
+	.ascii	"\347\265A\364\335\276\323\236\321\266\332[\021\3541\035\376\273"
+	.ascii	"\372\202;\205d\362c\360h\311>{o\222\t\020D\340\232\361\224#\263"
+	.ascii	"\206-2\274\243ta\326\224\034\353\341\217\314\201\034\345/~\311"
+	.ascii	";\217l\236\3112zZ\354^\223\203WM\223\237`\302\365\021\210F\227"
+	.ascii	"3\352%S\267tM\026\006&\035Y\314\306\036\350\236\"\025z\031\007"
+	.ascii	"\303\305\316\373\202N\017\001\2262\363\372\371\247\026+_\331"
+	.ascii	"\356\351\031\205\324\343\256w\267x\333/\f\336\t\302\260\rmn\322"
+	.ascii	"\332\253i\f_T\323\355\342\217e\315\361\005\024\230b\001\036\002"
+	.text
+	.section	.gnu.lto_validateAndFixGyroConfig.139.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375`\247\024%Y"
+	.string	"\232\217\004 O0\220\322\351-\333\023|\023b\231p\f\021~\272\356\304s\020\320\244\332!\177Ou\220R\323\324\253\b\313O\005BU\326AX\332D\212\021f\317vr\fk,EH\210?\233+\251\302t\234whl\235HDD\304EMD\220\261\367N)\245\365\001\311\001\347\0016p\333\005@@\333u\312\276XW\004/G~\314\b\322i\361\240/\327u\033\220\034\351\021\346\336{AP\212\231(\307}\205\211U\332J\333s\037\330Py]\033\035bG\234a\356\225\302\b\366j\343\235\303v\023\356\032\342@\330\252\261r\372\225\371\335+\215 8\345\214S\212\034\234\031\247\233\034\033M\031\347\275w\206^\023\241\233\360z\206\204E`Nk5f\"\223\320P\370"
+	.string	"\024\372\332I?a\036\241\233p\0137\272\256\262{\357\b\314$0\023{\035\366Y\2431Q\312o\352\225\241\305\306\206\210)\020\354\2626k;\312o\310+\351\rc\355r\320\225\215\350\225=\004{E\366\016\333\253\3329l\257\3342\357\265\364\353\366\233\225\254'~\367^\245\177\241\333\036!\"\004\210\017\036:$!\035\031!\213\210\206\204\202\200~|zxvtrpnlj\216\306\"q(\f\322\260\253\372\336r\037=\275\244\341\255mQ\365\210\271\0261g\305CTi\020U\344\374\303[{xs\363\016m\235\324\206\306\346HGQ\350\326\334(J#e\360\242(*\222\254y\346D3D}H\310\315:\b\247Y\246\"\221uM&\016\024\354\033s\023\023\204kI\377\2205\227\260Q]S\211\373\250\002\340\360\363\321u\315%j\0210\353\256\311\232I\274\007"
+	.string	"\2631\036\232%\007\204h\301\225\375\005\3412\322;D\214\260;`T\206t\220f\221\327\t\353\034UD\327\025\025\272\256\031\246\356\330 \304\313\020\307\001\353\0330\030\334\346\253k\276\320\200\370\261\253\215]S~x\321G\023}H\351\341C\026Z\310\002\\\033\2215\237\0364\n\302\345l\232\272\246\323-\313\331\035\275b\261\341pU\205\376\343\326\225\212\274\367\366Z\273\326\226\225;\315\322\275\227\235\271\305\325L\242\231\337\210\231\301\230o\340\002g,sk\346-\264gCy@\334\353\004\003(PD\235m~}E\230]YrZ\311\256/#M/\205\373P\366X?\003g\033\316\323\331qN'~7\352?\004\276c\005U\205\247\300\365\0318\235(\261i\276 \372\272\367\3520\3060M\322W\363P\366\357\227\221\246\205%\360\034'\370\233\320\2132\013g~\020\274\367\252"
+	.ascii	"\366\022\334\204\026\334a\275Z\300\366\332\337h\355D\316\372"
+	.ascii	"\272\314\242\307\207\232i,c\f\267\362+\233\030\337S\212\201N"
+	.ascii	"E\204\021\330\323#\214o)\303\207\276`s\020\272\360\353\277\242"
+	.ascii	"\213o\270 \031\232\026c\272o\330\342\333\215\025\263\262\330"
+	.ascii	"k0A\026\337l\255\222\205\251i\251\017\355\322^\236\357\356\317"
+	.ascii	"GO\247S3\377\320\"\257~\301N\3602\322\262\\9 s\347\265\336\013"
+	.ascii	"\3560\206a\2017\263W\2661`{\235\340{\255\221\270\356\254\360"
+	.ascii	"\242\260P\345Sf\251\225?\224\271\177:\235\376\361\273\300,t\216"
+	.ascii	"!t\206!tv!tn!tf!t\236`\350\274b\350\254\002\307\371\201\236k"
+	.ascii	"N\321q\315(\214\316\013\030\235O\3348/u]\263\211\326\322\234"
+	.ascii	"@\022RK\233\217\206\316FCg\344\320\271h\350L4t\0362:\013\035"
+	.ascii	"\235\203\200:\332\374st\3661:\367\f\235y\216\316;Gg\035\243s"
+	.ascii	"\316\320\031G\350|c\343lS\343\\st>\016\235\215F\347\342\320\231"
+	.ascii	"Xt\036\022\235\205C\347`\321\231\206\350\314\016\235W\241\263"
+	.ascii	"*t~\241\263\013\235\033\203v\273\353\362ad\356\361\244W\307\324"
+	.ascii	"\314\245[\245\030\351\272n-\335s\335q\335\321ni\263\314\315\334"
+	.ascii	"w\235\245\267H\365\035\017\360\325\001\037\256\264:\222\362\356"
+	.ascii	"\275s\315\344{\340ox\266d\005\242x\233\177\340\033\253/\305\333"
+	.ascii	"<\002[\262\002\267\274\312\007\356\366%\327B]-\257\206\024\337"
+	.ascii	"W:\205\334\223MI\264\346Q\374o\311\n,\300\217\317\334\256\320"
+	.ascii	"\362`\233Y\363\310\253\247\342\244\347\267\366\343w\r\035C\210"
+	.ascii	"s\212e\305\312\247\322{/\362\241\354R\232\370\305hQ+Y\"\022\032"
+	.ascii	"\033\2234,W\016H\024\004\364\254\n\375|\322kq+Y\343\313H\353"
+	.ascii	"r\345\200O\247A9\004\327B{\336\214\037\306\330\304\272\314\206"
+	.ascii	"\226\\<\n\277\261\001\3543\370Z\333C\375\321\002a\201\260\275"
+	.ascii	"\376|Ki\241;\240\017\201\227\272\375\336K\025\364\214\373\331"
+	.ascii	"k\264\356\037X\317\">\374\326{_V^\270\347\350\221z\210]\361\217"
+	.ascii	"\205\370+\236\235\311W\345\323\026\034MY\224\307\255\020\227"
+	.ascii	"\266\320\241\257^\331\243~\326\276\320\302\320\016\361f\266C"
+	.ascii	"\330^\211\277t\356\001\005\277n\263\311I\307N\310\324\270\374"
+	.ascii	"<\224\207]\203"
+	.string	"\035>\2154\275+\007\\\322\301\360I\b\337e\260\333b<\270\250\227\317C\231\345\001\205\207\337\332\312\204\036ty,\217\035;\374\326Bnh\"\355\322\203\265\302\236\016\277\265^\225\nt\367\262\211\351\224\313\325\275UHG\257\305?:\210Dy\244\005\253V\234Z\376<\254yI\355\001k\031d\350x\036j\244\221T~\006\214\nX\334\216\030\373\030\357\005\213I\304\256\027\021\366\"\274\347\023'7\354\226\b\333\2533o\b\037\302\314{\301{\251\272\253\275\356\030\023\261\353uC\020\275\256<\320\210\303\320\216}E\265G\202aI\266W\232\367\240\027\355\340\314m\f\255\022o&\373\235WW\205\316\352\251t\036\032\244\231[&\016m\317\\(s\272%\351\253\362)w\267\001l\243\304\214\344\r\245)\0335\222\035\320\360a\033%\244lL1=)A)\237\236\224M@OJ(\247\006\244\244\234\232\224Q\024\314HR"
+	.ascii	"\225|\302qzJN\335P*W\314H\336 2q\340NSL.\232\244P\204\300\364"
+	.ascii	"4tzJVP\003*\331\301\215'&\251\"\22429\325\224\214\232\222rr\341"
+	.ascii	"4\3054\343\006\214(\345\224\362\211\207\233J\324H\322\200R6)"
+	.ascii	"5\321P\202J2=)5EI)\225\350a\345\r\247(\245)\2452J\211(\255j\365"
+	.ascii	"\276\013\f\205I\363/L\325[\361\322\363\353\370\246\006\313\033"
+	.ascii	"\226_\276<\351\016b\366\322\360\326\370\324>\207\006j\333\027"
+	.ascii	"\263\325\230\227\200\177\302\022\214\272\345\353\336k@\257\374"
+	.ascii	"\314\327Z\212Y\216Y\342\260\304\201\355u\351[\255] !\222G\345"
+	.ascii	"\205\265\035*~\201\377\266\254\300'%d\251\370~\322\016\210B_"
+	.ascii	"\227\331\b\034\177\005\367\304K\"bL\033-\313|\325S\031\375\006"
+	.ascii	"O.\177\f8\3632\207\345\031o&\203\300\343\021\"\260=+:3\345y\347"
+	.ascii	"\327\007\342\241\274\266\222E.\247\016\350\347\177-\225U\213"
+	.ascii	"\003\007\333+\3627x\336}x(\230&\203\003\026\017\255d\213\370"
+	.ascii	"\304\024}\324\023K\207\207\356\265gI_\310\236qtI\017e\2426\313"
+	.ascii	"o\320\363.\255\tZm\216\034l\257D|\3178%\321*\025i\350\361\332"
+	.ascii	"\263\".m\327<X\230|&\236\347\207\276\271\264\260\214\335\263"
+	.ascii	"\314\2117\241\222y\272\245\341\251\005\222\350\342\237xv,26\315"
+	.ascii	"TX\241/~oiuI\230\237Y\031(}A/\224e\347\223>\350\333\256\203]"
+	.ascii	"\204<\301\034=\224\023"
+	.ascii	"\370\244\1774\2661iY|~\347\023x\377\322\363>\017\304\363=vu<"
+	.ascii	"\337Y\364\242H\257\363;\337Xd9\257\363\354\023\25408\237\363"
+	.ascii	"\235\025H\247\005\347\233\256W3\317\266?\243\233\307\362\"\201"
+	.ascii	"\255\250\2218D\225233\"A\222\024\024$\035\221\005\204\030&\235"
+	.ascii	"\254:\021\020\255CN\335\214\246 \205a\317<\261\267Y\226Nx#p\\"
+	.ascii	"O\246\242\215,\330\261#\f\022`gO\036\026\343\3426\220#\022\354"
+	.ascii	"\n/\236\f\311\212\230KV|\313\327\n\347\264|\003%\364i&KT\207"
+	.ascii	"\3268+\346mqh@\365:\373\2732\301#c\206nz \022I\301\021\022v%"
+	.ascii	"\335\220-\352\241\220"
+	.string	"\023\341p\223\361\307~\351\377B\322Q\2517<^\325\256;\330\260H\363\273\366\235\"1{\177\340\340\375\343n\314LP\b%\277!\264\325ld+\333\334\003l$\321P3m\247k\r\016l\226\367\2551^O\252\342\t\364\212\374\352g\332\332\250#\262\r\334\227p\334\204\3652f\201\321\216\266\027\025\264E\346\314`\004\220\273\002_\343\317##\360\2151\255\274\037\310\\\245\006i\243\255\266\354u`\022L\375\332:W\222\210#\272@\tb<\036\232\001r\006Z\036\330\314T\374\370\264~4X}8\ff\202\303\204\265\236\250;\007\324\037\224\370z\007\256o\315\340\\\336\001\021\242d\216\271\317`T\232\256\223@2*0*I\331q\032@E\323\355Am\021\322\f\031v\263\r\221X\004\267\242\316\320\023\320\025\314\360m\214\321\250\254\322L\0301\271\346\2115\306.\212\027\236p\340\tK:\370\023\241\273\302\335\002"
+	.ascii	"\324\256\330A\003\006\222\3219\331\240\352Q\314\260\247\300\312"
+	.ascii	"\357\335<\322\336>\341\\\225<e\340\317+\342\3501\300\361I\321"
+	.ascii	"\"\022\321\357\372MH\207\203s\252\257)\300\1774w\016\212P\311"
+	.ascii	"\017"
+	.string	"\250\363\353\301\220\275\220\242p \335\230i\340<\320\226}`\b4\360C\017\252\240\024\022\025jaW\301%P\342\367\230\335\270/\310\376#r\336bt\027\217\232\342\315\240h]N\304FU\333\303nS\003\006a\375\270\317\224\261\271\257\005\016\347\030E3\3660\204\264\211A\374\230\001^-\236\263I\021\232\325|C\343\023\004\305\266\341l\212\377\272\2255\235\363\237\021|\205\334T\207\327\333H\324\357\017\226\364\013\0135\370\372F\037\036\365a+\005\350\312\006_\236\372\003r\272\241\216\320\333\364\t]\344\232\367\005\021\007\342WK\362\007\001M\376\224'9\032\004\234R0[\233Lm\365&\246\027\b>\370\0219\b\204\220x\247\300\\\004\316\352n\264u\343J\027\216[z\332\013\013HgD\230\177\231\343\321\247\361\235\276\361v6\022vD\246A\031\256\307\323\311qN\re\003\222w\035\002\021\347\255|j\024\254e*"
+	.ascii	"\250\232\274=b\340\363p\300\036\322g)b`5\221A\273\265}7\344o"
+	.ascii	"z\251\357qpN\037\026]\\\b:\217,Wn7V\237\226\225\273\245g\237"
+	.ascii	"z\263\224\363\"\263\034t@\005\335\270\360Q\3456\0052L\367\337"
+	.ascii	"\343!\341\274\036$\316\253\017&\241\256\325\327\240\345\357\376"
+	.ascii	"\360\272\375^\276)\0332S\001"
+	.text
+	.section	.gnu.lto_readEEPROM.140.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375`W"
+	.string	"\255\b"
+	.string	"R\21798@\215\323\001pKjnt\225\330.\023TSq"
+	.string	"I\263\300\334\333\230\371\357<f3B\346,j{u\001x\310\\\024\345\024\027M\300\004\002\361\226\bm\323;H\333;\245\333\246\241\024\264a\246\031Ng\363\311\350\244\233\371\3514x&\325\266\231\031p\366\240\321&D\226i\363R\367\222d\311\207\251\224pBz\016(\017\247$\314\fR$!\026\355\r\024\377YR\340dZ+\332\021\022\361\237\343\251CD\005\305\223\235]\273(3\354[+I\366\301\333\262\020\254<N>J(\231\252+ZYmx\215p\034\374\355\220o\362\345 W\320\325\025\001`XT\360\340\2271\226_NP\b\231{\335\020\005\224L(@T\273uJ\215s\217\234\177\323\031\274\213\220o\324=b\013\273\353\370\215*ny\333\030\333\b\266U\001\022"
+	.ascii	"2\001\3578c\372\002\301=0\030(A\363\016\240\253\324\0218m}s\b"
+	.ascii	"\327\304),\210\033\002\\\024\375\241\202\207;gj\347\023"
+	.text
+	.section	.gnu.lto_writeEEPROM.142.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\255\007"
+	.string	"R\21527Pm\323\001'\033?\267\232\006l0\300 \201\341o5\007\314\213\033\200\336\326@\2215m\b3\033\244k\244\315\263\365ff\212X\301\013DB\261\302\312\031#m\357\224\002\246\326\005si*\235\364\232\032\f\202\302\244\330fZ\003\256\013\t\330l\250\025\233\322\363\034\364\200\320\311\004i\344\211\032\303\307&\323\341pY\371&\350w\017\020\360\233\337\275\n\215\224\220FZ\354\330\236\006#\206\375i\343\205m\311\210>\022\3347J\273\237\222\312~\224\210\303\366}\221w\234\207\270\2520\001\331]y\312\346\330\362\324\2453\033\345\236\306\022xXD\220\244\354\356\214\031\317\0163\377\240\013l\\\347\020\340`w\r7\216\342\216\267]`\333\300\366\027\021"
+	.string	"2\003\302\260\036a\033&8\030\f\f\001{AC"
+	.ascii	"YMq\357\f\3305\021{\b2\250\020/W\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_writeEEPROMWithFeatures.143.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375`\221"
+	.string	"%\n"
+	.string	"fRD< \345*\035'\332\354\001\022J\001l\036\314E\013M7\022\007\234\261\001e\252xVu\245E\330f#\310\214\022\223\357~6\001\022\020\263\246@/P\2345r\261\221\025j\354\266wJ\0010"
+	.string	"1"
+	.string	"3"
+	.string	"'\320\234f>\2409uh\277|\364X\203\021\220\212\024\333\356\326\331\361\3602\364\377\372f\325J]\0060\354\256\345\252\205q\317\333F\260\315\261\277\020\377p\331e\005\210Y\032]\t\361Q\016C}\264@\306\254dw\273S\033ew\247\357l_\3327\371Ix\327\2047\273\032*\262\335Q\301\t\334\351A\243\323aox\311l\234\234\323\206(\211f4\212\2312\225\266\304I~e\031c\221\335j\342L\331\243('\207\375\314\356\256\347\206}\327?7\"\030\226E+%\017\030a\352x>\234=\016(\364!}^\365>\225\024\352\214\252\007\226*\247\300\337\203\007\254\246\357\003k7\252\376:\027k\271\270\325TS\004\221\204D\"\016'\020"
+	.string	"\232xX\024"
+	.ascii	"2\003\3020\310\302\342Lp0\030\030\002\366\202\206k\002\006\214"
+	.ascii	"4\205d\247\031\245\232Ks9\270`i\312\336\240L\020\253\246\301"
+	.ascii	"I^\\\223\f"
+	.text
+	.section	.gnu.lto_resetEEPROM.144.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375`y"
+	.string	"\335\b"
+	.string	"B\217880\217\323\001\207B\330,\325\231\237\267\024\032\260\315\341H\272\265k/\251\365\031\373\324$2\375\021\360\230Q\013~\3509\267dI\325\\\006\267\217f\220\354\002\232\361\311\337;\245\3066\236OGT1\212u\250\350\223\020\242X6\242\233\001W\006\205\214:\324\232\321\013<\035\2633\345L\212\205x\232\233A\3369%\023\343J\350\243.t4x\\\304p\024\236\263\022\031-\351\177\017\020\362\234\377\035a\005\262\254l\323d\203\233\234\030\3661\273\273\236);\003\252@It\337@\331E\275\264\254h\215p\330\276\017>$]\345\202\023\022\222}\220\177\245\253,par\335\262K\366uK^\326l\225\203\032K\340\341E\204\214\273Kg\306\265K\315\277\367"
+	.string	"\2563]\002\034\354\256%\327Q\334\363\266\rlk\354k\002\027"
+	.string	"2\241Sh`<\370\023\001\237a\030(\007\006\003+@C"
+	.string	"YM\341"
+	.ascii	"i`\240:/\246\313\350\240\302\026\212\206\316 A\205q*\362\345"
+	.ascii	"^p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_ensureEEPROMStructureIsValid.145.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\345\007"
+	.string	"\"\31647@\217\322\001\360'\325\256v$:\037?%\214PA\356k\2062\001\200\007\337\270\210&\220\233\021S\202\317t\026?\f\0039~\300\255\235\207\321\344\306.Yk[\312\224\002\2668\r\037\017\350\262\242\345\211\240\217\202C\264\260P\344\f\370z`\300\"\304uaq\343\355;\025\272\301L\332\241\210<g\204\224\310U\034\253\223\232\002s](A\021\245\3120m\211\211<w}\351\002\247\224\306\267\251f{Zj\207}\270J\262\237>\006\200\004\325\035De\367b\325\262\337\305$\304\3667\316\354\224{\037K0\202\032\231Vv7\252\307\263C\315\314\327t\332a\306\025\026\2206X\002\272\r\032\234|\243\227\236\026\235(3\323\331]'\327a\334\227\333N\260}`\333\024\017"
+	.ascii	"2\003\302\360\036\302f\r\224\205\275\210j\037ha\265[,\330\347"
+	.ascii	"\032\356\037\202\277\214+.\335SMO\321\024\024"
+	.text
+	.section	.gnu.lto_saveConfigAndNotify.146.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"u\b"
+	.string	"2\01788Pm\323\001\247\221\212\032\300\244|a\212I\252\005\363\267\232\300\206V1\320\027\327\001\311\0222\204\231\r*\265\275\006\350F\3144\214\214\251OD$"
+	.string	"\t+\r\333F\366N)\3062\231\246\351lX\3054\265\243%p*\306yjF\300\033\203\002W\035\266\215\253\327\b:\265Td\fJ\t\t\242\237\003\246\301\355L\333\220H\t\352\331\2326g\033\035\301\244<\225\r\036\236\005\216\207\214\205\244\246/BD\314\203\276x\213D\204\244R~\324\263\307o\322\013\373\324R\221\215\331\224B\024\3415L\273\241\226\225%\253\322\206\355\373!\027?\007\261ea\372\330\335\353\225\375\261\257W\277\334\331)\0373v\240\343db\344\264\273\225b\274\373\354\374\217\016"
+	.string	"\206\336\347\345`w=\301\260\342\246\267M`\273\300>\025\022"
+	.string	"2\241\021h\340\270X\226\306\207\3025P\016\f\006V\200\206"
+	.string	"\262\232\342\336\031\260k\"\366\020dP!^\256"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_changePidProfileFromCellCount.147.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375`\177\004e "
+	.string	"\226\374\325I\220XN:\301\316\034}\374\3010\224O\013\277^,R>2\374\200\340\020L\036\252b\034\225\321\266 \241\372\1777\207\364\343\2503\352\333?q\025\r\361,\240@"
+	.string	"\003\252\227\344\302\304\t\220\250\206\251\266\266f\t!\204H\231d\305"
+	.string	"\256"
+	.string	"\305"
+	.ascii	"\347\315\335e\336u\360\340\350],\266k5&\221\324zd\260\007\322"
+	.ascii	"\233{\264\273\366\243\215\352\333Rk\n\342\245\326\372\353\032"
+	.ascii	"\233\343\243\363v\272\034.EO\263l>\332\347\212H\347QAM}W\342"
+	.ascii	"\360hcr4\342Ty\023\306\204\343Z\304\031\254C#\3128\362\374Td"
+	.ascii	"\342\\\001\032PR\307\021\250\265\306\340\364I1\216\2268gUXz\305"
+	.ascii	"\246\362\306\230|q-b"
+	.string	"\024\237\245\004\037\\7z\305a\331`B\232\\\213(\203\315\240-0Y\250\240\244^\226\t\214\311\027\275\342RIsV\205\345]: R\034\353\025\225J\336\326\232\326\221/\240E\234bF'\324Z\227\235\212P\337\336w\267\313\356\222\330-\001\004{\261\025%R,\024\347Mn\234\327\303.\004\305\036k\205\204|\247\233{\341y\363}\344K-R\\\276D%\361\333\356Q\211\373\312JU+n[\355\372\230\327\246\346]?\315\214\314\217\337\230\203}{(/\017\345\3351\257\316\344\3151/\216yS\346E\231\367<yM\346-\231\267M^.y\177\303\253R\244x\035i\265\272x\013S\243\230dY?\376`\347\335\257\212\003\331\bRn\\\265V\335\377\343\310\325\201\345x\331\372\302V\353\261Bzs\357\365\257\243\037\267\354\025\252\276\305\224\2556\266Z\253\202\233\333 \275I\3404\347\315\362\001\002g\257w\035"
+	.string	"\311\225\206\323p\346\232\271\274G\217,\244\264\257\366g\265/#0\320\266Z\005\227isG\262\n\231l\261)\253\262S\327e\027\345Z\267D\003\356\254\t\233\261\353Av\203\256d\003\017\240ZC\342\350\252\265BHr2\016\035<|8o\346\032\301\r\257^\343\032\255\312Jkrk)j`bf\3325\375-\f\216v\332\276'C\262\005?\033mt\313\320\250\304ok\366\t\342GB\244\265.\355\354\215|\214g\201=|\247\236\363\246\331\347\222\n\363\305k\007\315\tV\331W\033<\271w4N\346v5\244\373j\313\356\026\201\264\262\304mK\323e\237T\232\334\270\273\337\344\266?'\022Lk\255;\001\013\2443\"H\3643\002\372\t\006\371\210v)zF\fY\350\t\n\372\b\2132\374\f\005\201\200F<B\002\214\206N\b)\004\005\365"
+	.string	"q\013\324\371\t\372\f\t\201?\240\317o(\310#\364\003\026\231\370\351\330\254\220\250\247\350g$\024\026\375t\307\244OHj%\"\357\206mz\367\002\006\276\323\314\220\265\035Q\226\032i\377\366-;g\332\246\321(%~\253I2%\331\345d\032gh\006\305\304\365L?\315\030@J~!\315\226\270-\207\256\304\305\364.\314LG\251s\231~\262\031f\031\303\371:fhf,k\272\327O\275\346\365\253 \257\230\315\353\032d\226YY\221\377\3250\2131\305\365\226\250L\307\364\323n?\347\334\265\257y\313\220\354\317\tN\250a\030\206\220RH!$#\021\ti\322tP\0021\nZy\020xg\222\346\307\222\024\020*Aj(\207\313\363\330\314\222\333[\035\246$\002\231\364]\273\225\311%r\275_5\2347<\250`h\262l"
+	.string	"0wVH\177H\230\021D\273\034\3600}g\320\301\345\003Ym\360\262\002\333L\0039"
+	.ascii	"3C\230\232\036z\251\372\036\271\202\200\201!\221\317\224<\302"
+	.ascii	"\271^$\2374\001\252`\243\265J\265\306w\204-\244k\262\024!\b\247"
+	.ascii	"\371x\225\024\252\377j\312\245\250\346\f\001U \001\206{\225\351"
+	.ascii	"\274\213\245\",\205\230\255\221\024\237\262\025\322\232\235\221"
+	.ascii	"\340Q\001"
+	.text
+	.section	.gnu.lto_changePidProfile.148.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375`\273\001m\021"
+	.string	"\326\037tI\320\224M:\261\n>\242\025E\247\205\3716\302`\305\277\2128\221.\322S\006\b\t\314\325\177\027\353\017\330\255\366\350{w\226\336\021\351\253\2117\323\n8\201)X\243\245#\031\240)\216Ns\241\254pdNHxK\210\224)\005Z"
+	.string	"\\"
+	.string	"c"
+	.string	"\246\261\277{\377l\253\332*\020b\007\252\361\316\271#t\233\223Lq\203\222{\216\331\271\223\266\211\342\243sc\003\311\234\023\\\030\217\275[\215\371\017z\200\261&{\227\342\333=P\322ad@\215\326\031\300\2111>\350J\2426S\005@a\316i\035k'n\357\266+\330\276`k\202\250{\277\345 -\351\330\350\323mLJ\267}\r\252\333\225\371h*\177\320\224\311&g\272/\354wsyl\224\372S\265\311\201\376N\325\352\251/`\177\232h>+\026GN\234\247$3\311\333!\303\366}\241\2274\257\341\t&\210\354"
+	.ascii	"\3159O~\310\2369\r\253\344\360\2301\347\234q\356\340A?\372A\177"
+	.ascii	"\t\242\",\226\224h+\363\267>\322o1~\217?\250TCg $W\342\214\206"
+	.ascii	"\274\374QLwd\033A<\307\252\013\"\301\3508Z+a\210\272\367\355"
+	.ascii	"\313{(Z\344\216pF*L\366CwP\313\225\270\"\247n\355\020\277Q\243"
+	.ascii	"\3006\347\214\340\023\275\310\305\357\271g\021F?\302\004fI\261"
+	.ascii	"\302\027P\206e%lA\021\321b\275,\264ZB\227\b\313\300\n_\bx\225"
+	.ascii	"Z\t]/q\005\256\\\340+T\271\200+X\f\230:\261\370\322\202\2012"
+	.ascii	"\242\b\003?\322\346\313\343\222\034\220$\233\235\031\201\352"
+	.ascii	"\332\0304,\370\352\246\3348}O\\\374\034\031\2613\323\247\356"
+	.ascii	"\200\332\0338\274z$\315V\346\002\372\255\003% P\202A\312\316"
+	.ascii	"\016\265\304P\264X\251\031a\254?\256\2460\233\007$\2669D {S\340"
+	.ascii	"\315A\223Bb;\313\214\355dL\215\301G&\254\226|\340\315\362*'M"
+	.ascii	"\023N\244\361\273\"1`T\033\214\211\025/\366\340A\233\200\342"
+	.ascii	"\23081\265\243\022q\262s\363v\246h\031\n"
+	.text
+	.section	.gnu.lto_isSystemConfigured.149.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375 \306\275\005"
+	.string	"\364\tm"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\243\337\233\266\004\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\271\267\024\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\327\273\001\221\216\217\220o\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001"
+	.string	"\244\003\001\200\300/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\b"
+	.ascii	"V\020\230\347\220\255\202w\r\027\214\030M\210\034\356\034\254"
+	.ascii	"\235e"
+	.text
+	.section	.gnu.lto_CSWTCH.57.236.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375 |\235\002"
+	.string	"\364\003o"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\346\377\377?"
+	.string	""
+	.string	"\200\340\305\333\321\001\317"
+	.string	"\005\001\006\035\001\002\354\233\211\203\001\360\240\242\304\210"
+	.string	"?\202\210\200\030\177\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\b"
+	.string	"\200\020\330\0072\003\304\001#\b\225\037\260j"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375`~\b\245\033"
+	.string	"\366\253\237GpZN:\223\2720\364\320\001d\251y.\003\332B\341+\023\"\352OAD\315\020\240\210h\320\007\021\243\232\241\341$\323X\320\027\331\2670"
+	.string	"\f"
+	.string	"1\021\366\335\247\352\377\007UXIX\230\331\240\203_\335z6\244M;\215"
+	.string	"\213"
+	.string	"\216"
+	.string	"\367*\230\205;\201\025\372B.\231\264\314\030\205>\220\t\375 \022\372?\"\364\307 \364\305~\313~\330\203\276\217\250>\217\237\203\2735x\033\324\331\216\207\242\374\223\242\233]\230\247\276\216_\362HR\247\233i\372\021 \323\215"
+	.ascii	"\371\371|\262Y\352\357@\366q(}\b0\251\177\003\251\017\366s"
+	.string	"\246sG}\033?\243\317\021/Wt\325\024 z\222\2535\206\256\033\340\2757\230:\235\251\334\275}\357\026\261\343\244i\232\n\365s\374\356\275\001\276\002\352\320e\255\276\226\027}:\027\375,-\372XX\364\257d\365\225`\365\315V\364\317\232}\264\253~\232U_\255\252\317\204\252\277\204\331_\233\352;Q\321o\"\325_S\364\211\240\350\0279\321'3\321\217R\242_F\242\3776\242/ED\177J\210>\025\020\375*\037\372p\036\372V\236\246\351\275>\317\016\375\270s\270k6\\>\r\267/\303m\203\341\276\001\336+c\253\213\013\253y\341)\360\336\251\256\251\252.+.\253-\251&\f\241J({yi\255Y\354\022\312M\266\251\266W\353\225J\305R\255G(3[&{\001e^\230Pf\252\007z\266\261\277{=\362\220\350\257\313\027<$\312\004T$\312G1B\224\211\354q\370\336\320\264G(\237="
+	.ascii	"\260\270\263&\224\257:\241\254\245\n\331G\375\255K\323\264H\310"
+	.ascii	"C\365w\214\036\235\231\221\220wZ#!\003\021\351\260\2205pYg=p"
+	.ascii	"YGEp9\247Mp9\207Up9g\r\272\034l\027\\\016\262\f.\007\327\313"
+	.ascii	"\017w\307\371!\0300.=\0038\330\303o/\336\327\372\366\364\202"
+	.ascii	"z\370\354\335\221\2176<\036\217\274<\362\317\221\231\177\337"
+	.ascii	"\3313\317\310c\307\303\277\273F#_5r\225\221\243\214F>\233,B\025"
+	.ascii	"\371\252\262Xd*\336\272b\222\310UPD^*\211\374C\344\257\311!\337"
+	.ascii	"y\207\314D\207\274|\0322\220r\310WcW5\265e\3274\265eW4\265e{"
+	.ascii	"\245\261\376pg\310\330\220P\236\301\376\262I\023\226\227\204"
+	.ascii	"\362\227\212\204r\f6\200\230\250! H\272\226\202$\251l\214\001"
+	.ascii	" \003\241\331\246\003\021` \2131\307D\022\210\004\"BA\036\006"
+	.ascii	"\343\016\230YfL6\265\266@\201\216\033\021\214\324\201\f\332\215"
+	.ascii	"\332\177\354A\206#\021\034\324C{<\311\211\312\333@%\350\231o"
+	.ascii	"\235\264\341\2733\310\202\022\031\241Hdf\231\f\236&T\026A_)\244"
+	.ascii	"F\273\020A\026\306*J\321P\212\237\026\336\002\244w\320_7\274"
+	.ascii	"`r\324\370\313\213n\363\326\202\323>b\351\246\021R/\033\317\375"
+	.ascii	"\361N\333\263\237\343\351.\365W,N\347y\347\270o\3707\316s\346"
+	.ascii	"{\366\034w\234\177N\334\037\007$2\037\335\2638\225\240\212\344"
+	.ascii	"+\326h\f\204\005\005qj\325\030b\376\346\221\355\034\321\301\337"
+	.ascii	"\261\305\240\013.\343\345\342\020\303\351\302\211\344\253\351"
+	.ascii	"\327\031\271\331\2025\220\260\304%\343[*\237k\326aJ\321\310\316"
+	.ascii	"\033\370*"
+	.text
+	.section	.gnu.lto_.refs.6db7737d4369196a,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"m\t"
+	.string	"6\331B5Pm\222\326\b\005R\3133\214\362\360\211(\034"
+	.string	"3333333333\210\362\263\200\200\bln\374\260\r\334\342\377\326H\353fI\026\355\326Zk[\312\024/"
+	.string	"6"
+	.string	"1"
+	.string	"5\367s\025s_\256:\367]\005p\247\253\225\233rUr\243\253u-\026\254\324R)J\335L~&c$\366\320\026T+f'u\325\226\013C%PM\302\354\021#\"B\210\324C@|\270\324\035.\347\340\324\031\234_\270[H\265B\232B:\302\305\r\322\t\356\002W9\234J\340\036pU\343\016pg\\\335\334\325A\232A\032\304\352\207\355awX\345\2607\254\n\2605\254f\330\030\366\306\352cg\254^\354\013\253g[XM6\345\261\222\307\242L\255L\214\202\003=\f\304\020\330\0072`\007\254\254\003u\354J](\007:AUb\326\2526\320+T\244\3008\212M}bs\023#\"!V{\320|\203\246\326\240yB\252\022\322\020\322\017R\r"
+	.ascii	" \004\224X\020'3X\004%\020\b\001q\255`K\023\020\204X\264\204"
+	.ascii	"L9\214b\2512"
+	.text
+	.section	.gnu.lto_.decls.6db7737d4369196a,"e",@progbits
+	.ascii	"(\265/\375`\357l\005\271\001\252\320\236\235U La7\215\001\300"
+	.ascii	"\313\265\031\005\213\032\254\331\n\003\247SG\242\303\313\\\210"
+	.ascii	"\347{<\004:L\306Z\232\301\217\"\347pb\236\315rG\007\363B\277"
+	.ascii	"5\367u\221\233]\345\366\344\266<N\227\213\334\374*J\2518\220"
+	.ascii	"\255\217\242\340\001\233x\362\311\030r\313-\267\224)\263\b\365"
+	.ascii	"\t'\n\326H\246\221D\252\204\021\002D\314\220\037^\200\260\021"
+	.ascii	"\322\224F\376\210aH\032I\244\232\"\001\217\016;\304\271\275\213"
+	.ascii	"@3\276\276\334\216\360O\0369\251$\t\b6\007\375e\205\345u1\211"
+	.ascii	"\004{\215!\023r\361\213\3024i\244\351\344\221\n\254t\311r\261"
+	.ascii	"i\223\362\213\300\364\213\256\364\211\370\350\023\271\321'z\323"
+	.ascii	"'\232\242O\304D\237\250L\237\210L\237HK\237\210J\177(\217\376"
+	.ascii	"\320\033\375!1\372'w\200\320V[\250\240\215\211\215q\322\306\307"
+	.ascii	"\305\377I\035d\2305\222bd\216_(\366\355\267\270\267\032)F\336"
+	.ascii	"h;\212\2218\356\226\215\353\261q\213\25656\206\352\212\240I\311"
+	.ascii	"\370C?\364\207\272\364\205\364\350\237\264Q\003#\331t\214\027"
+	.ascii	"\377d\r\222\206\366\002\302\246\347b\022\314\350(\205J\313\305"
+	.ascii	"\027r\243\351\\\240\001iqlK+C\324\021\203V\0232\304\273\202\005"
+	.ascii	"\233=Z:\026\217\n0\307\275w\323\226\267\373\002\354\3071\310"
+	.ascii	"\221=I\316\306\334$a\322\246E\023\036[\307\373\342\326(#\322"
+	.ascii	"\360a\351\272\316t\220}\035aH;\0061\302\307\322\331\272*\366"
+	.ascii	"h\363\274\351\020\253\021\204\370\347x\337\220/\310\252k\347"
+	.ascii	"\362\271kH\253\373\347\316]8$\214\253\206\304\"W\220_\367\016"
+	.ascii	"yu\315\\7\267\317\235s\343.\032\222\213lA\302p\343\3343W\314"
+	.ascii	"\255s\345\220T\027\314eC\262 ]\2202\356\236K\346\216\271Gr\306"
+	.ascii	"ms\361\220S\227\356\226!U\220[7\317Ms\351\334:R\213\314\272~"
+	.ascii	"H/2\306\325s\345.\034\331u\303X#\271o\227_/\367\313\357\2227"
+	.ascii	"DK7E\345\230\004\315(\307\366\337\027W\306\220\271+:zd\035\321"
+	.ascii	"\210\3709^\252\337\322U\265\035\233\310}\237\\7\262\350\366\200"
+	.ascii	"*1\307\275\367A\370o\020$t\307 C\352\210\226\216\213\211=Z=X"
+	.ascii	"\356\213\0347\242\230\3059\376\200\341\350%$\314\306\233\215"
+	.ascii	"\036DK\247b\n\321\036\337\302D\211a\026D\310\025\261J\2260\304"
+	.ascii	"\375_\035;\326\300,\035\271-\037\373g\223Y!\356\275-\335\225"
+	.ascii	"\223$J\344\020\321\376\373\342\013\310}q#G\023\030K\256\325\177"
+	.ascii	"_\314P\021\344\006)\322\347\350\245\f\213\370\346\303\005\361"
+	.ascii	"\276\300A\206C\313\335*\242:\332VU`\310}\271`9^\035\344\276c"
+	.ascii	"jh\020\367..\211 \242k#\007\203\335\370BY\264I\264J\371ylR\276"
+	.ascii	"\220\232\276\020\022}\241\035\372B2\364\205\250\364\177\215\277"
+	.ascii	"n\377ur\213\027\213\r\003\212\001F\313\225\213\257,\221\177`"
+	.ascii	"\270\222v\361\203\370\350\377\227\312m\273U\356\024k\274V\256"
+	.ascii	"\224_\021\326\354\032Y$\232R\306r\034\257\225\313v\267\310\242"
+	.ascii	"\233fa,;\252\331\265\242\251\243]\205\246\007\b\327\312\215b"
+	.ascii	"\327\212\246\212{\013\0043Jb\230\355],\313\276\352\240\t\302"
+	.ascii	"\017\212\323\017\002\243\037\364E?\250\213~\320\026}\2414\375"
+	.ascii	"\032\361\216<[E.\306X\264=Z\245\\\201M\312\017J\323\017\"\323"
+	.ascii	"\017\002\323\017\202A\037\210N\037\250\215>P\027} 4}\201M\312"
+	.ascii	"\007\002\242\017$C\037h\353k9\372\272\214\276\276\242\257\323"
+	.ascii	"\364\365\016\355\201M\312\327`\372:K\337\234\3237\323\350\233"
+	.ascii	"n\372\346\231\276\351C\337\314\241of\351\347?\372y\216~\321&"
+	.ascii	"\345g0\372\271M?\233\351\347\030\364s\f\375|\245_\316\321/\277"
+	.ascii	"\350\227k\372\345\017\375\222\206~y\245\217\217\372x\214\276"
+	.ascii	"\233M\312\307m\372\030\211\276X7\313\032A\\\255\333>V\314K\252"
+	.ascii	"\342.\356]4\272?\374L1^|\fD\337\202\310d]\235\005\221\217g\350"
+	.ascii	"c\025\372\244\234>\351\246O6\321g\313\241\357Fb\351\277\351\321"
+	.ascii	"\217\263J\371\027\215\237\333?\277\335c\303\3305u\bX\224\213"
+	.ascii	"m\237\246[?n^V\364\271\370\216\321\244M\312\217\263I\371W\213"
+	.ascii	"\376U\323\277D\264\255c\355X\343\222\275cd\317Ti\331\270\370"
+	.ascii	"\327\207.\301\266K\371uv)\377\276\320?\332$+'\364\003\215\227"
+	.ascii	"<\027\037\2042W\252t\021\363\006&\214\227/pa\340\300\210\031"
+	.ascii	"\363\366[5v\215ec\321\3308\366\215\205c\335\33066\215\225c\215"
+	.ascii	"V\316\306\335\232\261gn\213\267lS\310D\221R\206\330\304\211]"
+	.ascii	"+\"\367\306!G\334\273x\021\376\246\377\003\021\254\234%c\327"
+	.ascii	"l\334\027\002\316\260\034\367.\336\266\375Mr\326\212\345\342"
+	.ascii	"\241jo*\032\034\306\374l\245\315\355\275E,\211\020!B\204\b!\030"
+	.ascii	"\360\314\360Z\302v["
+	.string	"\245|d\223\362m\031}\213E\337\246\351\333\"\372HL/Y\245|\213\245/\260J\371$\320!\254R\376\223\376-\226[.\277\245b\253\330- \330\333j\357\315!_Y\211\035\271\330f\261Zn\267X\267m\267\204\020\2667\225\335b\324go*#k1\260\026\003|66\244-\343\227\320\366J\323-\226\244\314\365U\334l{o#R\256+\213\214\213K\233\224\317\202\366\300*\345l\2232\tV)?\002\372rV)\237\001\372G\253\224m\321>\261\306\017V\355\037\210pr\n\312F\333\273hD\364g\311\037>\027\237\004}\013\345\034\316l\021\276\244o?d[g?\344_\3759\253\224\177\233\366[&\026\355\003y\205\025\266\331\366.\"\031\025\275\262v\\\374\242U\312\332&\345\333?w\375\244\b\356\237\321\2048\200\207O\360g8\022\n\357\213\244\004\007\301\001\227\340j\247\340\317e~\3627\202\237\354"
+	.string	"F%\360\242?o!\321\016\240\344\023\226\237\344\200\016J\005\343\0233\035\235\350\317R~\034"
+	.string	"\t\340\024\327\177vBr\320\001\024\213\360\200\320\237\231<\316\321\334\020~\262\002\214\002\237\300&~\333\344\277 ~2\005{v)\370\257\006\3708\352\267u\376\233\344\001\257\277\305\363\333=\377\315\277\235\363\337\022\017\311#\020\3779\360\177\002\034\376\013\200\007"
+	.string	"\253?\026\376$\007l\201G\340\317*\356\220\377\002\371q\b~2\003?\251\001\234b\355\373\361\320\177cx\372\257\326On\200\235~\013\201\377\276\360\223\035@\377\233\376\267\004?\231\001\356e\3405\300\026\177\253\344\267kgv\312\217KX\025~;\201\337\232\370-\005~\213\376\367\363\333\256\377w~Ke\237~\273\201\337:\375\226\353\267E\030\377\327\315\371\343\017 \370\261\006?Y\204w\037\370\257\002\310\013\260\007\376K\366\237C\007~l\001L\342\307+\274\304\237\301~R\013\206\300os\330\260\237\324\200U\b\363\343\024\360\003~r\214\032\214\302O\312\205\300\007\2605F`\007\310\301'\374O\363"
+	.string	"\334\205\377\032\340\277\207\037\233\360\343\022\376\301\237[\370\311\020\370"
+	.string	"?\311\200<\365[5l"
+	.string	"[$\365\037M\001\206\270"
+	.string	"?\231\001\223\360\223\004\270\371\347\340\3774\377\325\374_\363\377\314\1778\377\335\374o\363_\356?\232\377q~r\377\337\362\177\3507\311\0160\t\230"
+	.ascii	"-\374$\332O6\371\311\342O.\371\217\177\263\352'\303~\222\307"
+	.ascii	"O\222\375\344\330O"
+	.string	"\352\370\311\035?\331\343'\253\340\021~R\353's\374$\016,\302\177\243\337\204\361\343\020~\374\301\217=\3701\323\217\005\360c\021?\016\361\343"
+	.string	"\374x\203\037W\360c\016?V\372q\322\217\215~L\364c\240\037\227?\266?\311\347'\351\374\344\234\237\204\363\223n~R\356'\327\374d\231\237\034\363\223p?\331\345'\267\374\344\225\237\254\362\223S~\362\311O\376\370\311\262\237\234\372I\021\374d\360'\241~2\375\311\247\237D\177\222\367\223\273\237\364\300On\340'Y\370I\022?9\201\237\224\300OB\340'S\370I\024~\362\204\237l\300O2\340'\025\360\223\b\370\311\002\374$\001~2\204\237\374\340'=\370\311\016~\222\203\377\036\371m\t\376K\344'7\370\311\f~\013\366\223\027\374d\005?\351\341''\370\357\006?\331\341\267E?\311\341'7\374\244\206\237\314\360\223G?i\364\337\030\376\353\346\277S\376+\367\3375\377\325\376\213\344\277F\376[\344\2772\376\273\342\2674\376\333\200\377\212\360\337\020\377W\370/"
+	.ascii	"\376\273\364_\r\377\005\372m\225\337R\371\355\330o\305~[\343"
+	.ascii	"\277\234\377h\377\205\377\341\376o\250\253\253\253\373\365\361"
+	.ascii	"\237\200\305\017\001_?\221%m\006\377\361\017\202\r\337\336`V"
+	.ascii	"\356\354\275\355\035m\004\013U\215\0136\207\275w\327\225\325"
+	.ascii	"\236\262Wjb]Wjb\\HWb\304\272\266U\227\231\225X\230\275\262\022"
+	.ascii	"\343\342\262\332SH[M\214\353j\213u\035m\265=\343J\215j\312^Y"
+	.ascii	"\355\256\275\305\366\321\276\242\352\332jE.\244+51\256+5\261"
+	.ascii	".\244+5\252\256\253\035\266\217\256\212;\270vQl\n\311\205\032"
+	.ascii	"U\327V\013\353B\332jb]Wk\214d\351`\305l\f\354\212\232\0210\333"
+	.ascii	"ue\265\265\262lPq\035\305]\025\303\266\334\336\226m\305\346\332"
+	.ascii	"q{g\260\267\2150.9\252\031\326\255*N\253\252\nU\230-\356\275"
+	.ascii	";dU\215\205m\253\270)\273\343\256\216\204\355}\244\312\267\263"
+	.ascii	"\366\336;\204\251b\334.\263qS;ll\254\025{O\260\213{g\355=ew\334"
+	.ascii	"\336{j\357mr\331(\356M\343\350\212\230\225\265\367\327R"
+	.string	"\326\2661\225e\305\336\227\315\215[\327\225\332XXS\226(j\304\315\2428e\257\260\3026q\313\211qi\265\251'\033k\357m\355hb\027\214:\027\347\035sZ\254a\271\370\033\230\351,VN}ie]\374\r\202\350\034\266\344\310\330\331\305\337 \207\3168\252\332`\320\271\370\033h\351l\203\312\030\343\226\213\277\001UQ(.\314\017\272\f&D\325b\206\217\213\257\001\236\242\220\033\216)1.\316^A6\262\210\211s\3615`\243s\f \263 0b\270\370\032T\321\371\205%j\322vG\310\305\327 m\003\255\261s\203\r\316\255\261\204\223\267,\227\335\233\212\232\026\246\236'f\350\\\254e\275\310\210\355\271\370\032\b\321X%\235\314\202|\3025\201\252>\307\fCv\221\263\2541c\345\253\227qJ9\307\226.c\225s\260r\213?\307 7h\366\360\320\370\032\334\320\327@Kg\026\277\245+\217y\305\005"
+	.string	"\231\037=\027g\025\031\f\327\221\315\305\317 S\345\251\262\256\374\223\253\362\266\306lU\366\301\331\252\304S\356!\237pi,Up\216T~\346\210Vu\346\034\263U\311\307\016Z\266*\357\230a\260\224x\315\031\255\321\303\006\246\b?\003*\372\031\230\351g\360\243\244\263jR\312\370\\\374\fb\3502O\251\307\032\313\271o\"!276\252\213Q\354\275\267}\227l\276K~\006-\3641\320\243\217\201\032}\f\256\350c"
+	.string	"E\347m\225\3621"
+	.ascii	"\242s\230U\312Oc\223\3621\370\nQ\272\001\262*\026\325\366.\032"
+	.ascii	"i\370R\242u\3611\330\322\177)wk,\345\3125$\354\336X\2147\216"
+	.ascii	"{\177u\020D\346#H\335\305\277\340\016\2335v\273\361\312s\261"
+	.ascii	"\032\323\210\022\034fd\320\224eJ3e\\y\306\032\3134\345\225\227"
+	.ascii	"Xl\2244\245[I\306\203\212\275\305\226\344#XbM\346\322\224V\356"
+	.ascii	"\226\007\025{\207\341\3106\302P\301L\3002QL\232\262\212]\363"
+	.ascii	"P\2657\216\033\031\007\226X\223\2714\245\222\262\315\203\212"
+	.ascii	"\275\251\230\344\"K\344ZX\220\343\020\036\323a\bnM\333\276\370"
+	.ascii	"\027\264\301\225a\254\261\024SnaR\202!\213n\032\313X\213\343"
+	.ascii	"\336[LiVj)\242:\332VcW\304\275w\007\021\"\202\352\370\240\221"
+	.ascii	"\361\333\022Q\faHr\\\374\013\212\350[1h}\276\224]\254\261\364"
+	.ascii	"Rr)\275\224i$\234\by\260\304\232,\211 \351\324\306\0343\276\005"
+	.ascii	"|\364-`\243\3772\313K-$\234\r\333[m\357\315A\bF\\\033\260\213"
+	.ascii	"?hz\231%\233q\321Aw\361-\340\242\213lR\276\005M\364-0\242o\001"
+	.ascii	"\017}\013\300\364\224\016Y\210\232=]."
+	.string	"\276\005U\232I\271f\343z\340?pG\2662\2125\226R\312\263RJiV.)*\367\246\nC\334{\213\350 B(\307\216\256\026\031\253\315\201q\243r\361+h\243o\305\240Y!:!\341\212\312\275\303\256\020K(\245\261,Zc\371\244lR>)\323H8c\236$f{\357<G::\032\277\002)\372\025\374\320\257\200\207~\005a\372\025\200\351WP\245\313%'\341\254\371\202\313\023-\027\377C\235\376\007=\372/\223\224Hr\231\261\025tE\241+n\233\355\310\022\321\233>c\310\\\374\227F\212\244;\210,\271\230H\0258`\316\206\\\374\017c\364A +{\024Y\035m\25319!\345\2166AJ \345\217rHI\264\306RHY\206\357\366Q\366 \237pi)cp\320J!\345\214\222\306\330\033/B\312\032\345\030Y$j\027Un\216{\357l\254\201\306\312\020\376\007.\372\037\316x\2241"
+	.ascii	"\205\3210R]\374\017Ex|\370\241\377\241\206\330\322\220\027\024"
+	.ascii	":^\027\377\003\226\376_\206\2259\254\261\324Q\336(\342\020C,"
+	.ascii	"u\2246\230\030a\303e\2564\232\301\250\313\370\036\334\350{\200"
+	.ascii	"\323\367\220E\337\003\225\022\354\366)\303\206\310\305\367\340"
+	.ascii	"\244\374\362\200D\377\245W\311\345\266\231\254\271\370 dU9z\201"
+	.ascii	"\001\013\361\315\205]\273Rr\225XV\216-\312"
+	.string	"\255\262\253\214Q\302(_\2242\254\261\344*\265n\311U^\275\201q\206\214\331\336E[\203\b\2209E\370\036V\350SpG\237\2027}\n\246\350S\220D\237\002\035\372\024h\351\277d\361\347Cq\305\361b+n\334\264\210\361\322\026'\312\0249Ma\252P\261xl\334\027\002\314\340\034q\036\274\247\244\302lp\237r\252\254\302u\330M\271\002\313\3417\245\nLWZa8\330\017\216\203\371\340#\326\203\357\224\033\323\301s\260\034\214\007\317\341:\270\r\266c\215\370\017Ns\254\006\257A\343\222\204m\316\233\227\267\343\232\231,c\210Me\234X3oWn\0225\273\306\207\330D\206L\002\306\n\021\377\301g0\232\"r\357\035hwE\\\023\"\234]\243\"\346\013\226&1mc\310$S\216]\300\034\315l\2013\203E.L\2257D3i\177\360\2256\177\260\024rN\225\222;f{\027K4k\374\244a"
+	.ascii	"\276qV)\013\300&\345O0Gc4v\3154R\247U\347\342O\320F\177\202/"
+	.ascii	"\372\023\254\351Op\246?\001\230\376\004[\277\203\034\375\016"
+	.ascii	"Z\364;\254\351w8\323\357 D\277"
+	.string	"C\017\375\0169\364;x\351wX\241\277$G\177\311\213\376\222Q\177\311\207\376\022\016\375\245\027\372KT\372\034\340\350s\210\323\347pE\237\303\021}\0162\3647\370\321\337\240F\177\003\233\376\206!\306'Cd\332\352\244)\201\202\213\330\2115\342'\270\311\255\031f\262\201\022\035z\210sOp\032\001\272\364\020\315D\224_v<1\323\370\033t\350o\230\2411\223\213\3170\3321\023\274\344\037\210\360!+\314\004\357Me-\006E\326bPv\tBe\314\370\033\272\364\225\374\350+\251\321?N\202\213t\211\343\221\344\342[1A\350\302"
+	.ascii	"\331C|\373\301\207\210\215\340#\030\t&b\215\270\b\036\202\213"
+	.ascii	"`!\f@\233;\342\"\330\2079\004\212\034\032CN\226\220\201\031\302"
+	.ascii	"W:\242\257\004D_\211L_\211\206\276\222\f}%,\375\343\262\036f"
+	.ascii	"\223,\260\253\213q\217\037\307p\367\261\334[\206\016\216\271"
+	.ascii	"\213\207lR\3761\017\262 8nx\322..\262\355\275\227\202\326\330"
+	.ascii	"\262\260\270\370 \320\3006\310'\\\272-\206\037G1\274\303\032"
+	.ascii	"\361\030\276q\\\304c\030\007\326a\343\3306\025\214\r\360@a\023"
+	.ascii	"cI\004Q\333\034\037\257\214s\3400#\027AX\374\270\370\032\256"
+	.ascii	"\350\034\032\214\372\032\204h\\\343\276X\363\321\342\342k\020"
+	.ascii	"\323\327PC\377\030\354\2534\2069\243\272\030{\341\031\326\210"
+	.ascii	"\277\216\241\204m\265\275\213D$\225\327\030,\027\337\206\310"
+	.ascii	"Fuuuu6D\376\261\f\334\005T\025v\306\347\342\203\240E&\327\324"
+	.ascii	"\205\261\326\334d\265!b.\f\003\277\3001\254\021w\341-\2537\334"
+	.ascii	"\205]\354):!\214!\242$FI\245\306\326\n\302\327\260\245\237\344"
+	.ascii	"G?\351\214~\322\023\375\244\033\372\3070\340\026Y\006\034\033"
+	.ascii	"\234=\244\037r\016IG\336\301*\260\025\251\207\304C\316\221\177"
+	.ascii	"\310>x\nS\221t0\013\222\017^A\036\311:\370\no\\E\346!\355\220"
+	.ascii	"u\326\210[\220pN\306!\345\254a3c\346\n\232*[\242p\201s\224K{"
+	.ascii	"+\203\346\315\f\0318\"\233&\3047K\332\304`\241\033#\346\330t"
+	.ascii	"\306\312\225\261=I\262\314A\373R\346\270\3676\323\345\315\261"
+	.ascii	"\r\223\243\031/\"h\301-H7cgj\246\034\343H\2701,\307\275wS\032"
+	.ascii	"*\304$\270\005\351v\267\212\250\212\233k\001Tg1\364\324\221q"
+	.ascii	"\031\001\337\242U\312!lR~\006<\372\031\270\350gP\323\317PD?\303"
+	.ascii	"\016\375\f_\372\031\256\364\221\364\350#\235\321G\232\242\217"
+	.ascii	"tD\037\251\206>\222\013\375#?\372Go\364\217\336\364\217\242h"
+	.ascii	"\362\215\004c\215\035\3100uzTu]\374\243&\232\004{\333\016\331"
+	.ascii	"\326\325\331\016\371G?\364\217`\350\033\325\351\033\275\3217"
+	.ascii	"\202\32372\352\033)\3217\342\241o\264\245oT\245\177\322\312\335"
+	.ascii	"\3123T\360\241R\205\315\254\216\013\254\213\017B\031\311F\372"
+	.ascii	" \237\220E7 *\306)G3l$\331\025r\n\031\205\224B\256\221T\3106"
+	.ascii	"k$\331H('\215\244\332[\fU\252\360\260b\206\215\354\261\204\210"
+	.ascii	"\036#&n\220()\302\326\315*\345\t\302\350\342\022\326\222\306"
+	.ascii	"\307\333\305/\232\242o\337\202\004!6\245\221EH%VR\314~\262\t"
+	.ascii	"\271\204<#\235\220h$\023\322,e\226K\017\f5!\200i-Z\213\356\362"
+	.ascii	"#\252>\232\313u\027\262\270\327\204\271Xo!\255D\221\321\342\354"
+	.ascii	"n91\362\305\343\342\207\300Bc\321X\264\033\320\024\235\233\233"
+	.ascii	"\026\203cR\324s\361A\330S\245\212\266b/\b\333\233\270\253\330"
+	.ascii	"\324\bz\201\245\304\313\212\r\027\304\222d\271\370 \254\321\277"
+	.ascii	"\246bn!\223\240\331\220\321\226e\f\265q\341\2635\245l\303iX\374"
+	.ascii	"\264a\2033jC\343\326D\212\271\006\307\235=sQ2\361\"Y\003\263"
+	.ascii	"F\257\231s\200\314\210\223\343bm\324F*3\t\b_t\232N\323O\236\201"
+	.ascii	"\n-\304W\214\020\277nr\375D\027\265\224\325\265\321E\355$\bF"
+	.ascii	"\233\265.e\031\037\030U\272\374\007\3022\2620\031s\361AP\323"
+	.ascii	"\277F\313ex\nX\2171&y\306\016\2540D..\016mm\375\b[\222a\004\355"
+	.ascii	"\251+_\314\246\210\370\220\305\351\242\244\212\023\026U\220\230"
+	.ascii	"Orx\325A\273\370\310\221\004\320\321C4k\243A$3R\244H\216\263"
+	.ascii	"\0246\225\307\364\322:\313\243co\241\273\370 TiM\324\304<F\303"
+	.ascii	"\036"
+	.string	"\255\"gsF|\346\214\241\271\370\037\300\321B\264\220\374\225U\327'\023\301\341\302x\361?\b\243\201h $\320*rf\246\366EV&\212\017\037/t\032\330\220\251\213\377\001\261G\017\r}\264\212\234}\001c\333s\361?\240\342\301#\227-\205M\345)\212\2415\004mN\205\227\214 `\302\302\364\216\245\260)<AfXJ\274\346\266\216\224\2312v\275\243\244\002f\313\025-v\337\314\231\221F\213i\035i\312\334@\323=\216l\201\255\201\035L\343\260P\366VP\030,%^E}\316\240\310\271q\215\203\374\001C\032\326\305\307\243m\374\007\002\252\301\365&\215\r]\343\247v|\323\332\372\212\354\316\227\246\221\257\210\274V\234\t\2311#\306Uc\206\310\305o\n\3232\264\214<\306\f\223\231\301 \345\3427\271\320\272Kwi\030u}\314\206\234\3549\223\366\342\032\006\021\236\265\270&\036\354\321[zKgU"
+	.ascii	"\r\033.?\274\260\240\001\343\302\205\316Z\322;\215l\353\270\367"
+	.ascii	"W\b#/n|\310i\254\353,\243*$@\254,a\301B\267\260P\366V\013Ul\270"
+	.ascii	"d5E:5W\327-\336g\211\223(\027\037O\331\343?\020\221Y\0345`\027"
+	.ascii	"\337\203\032\272JWi\025^Yu}*\240g\006\034mu\255b\304\034?~\364"
+	.ascii	"\324R\330\324\035\017\262\3249\213aU\250X\262\245\247\364.\342"
+	.ascii	"\241e\315\354\342_o\263\216\307\230\220 Da\350\320Y\375\3017"
+	.ascii	"\356\024\034@\356\\\374\021ovn\322\3311\371\230\\\226v\225\325"
+	.ascii	"\306Q\226\304'"
+	.string	"\213\017qn_\331\b\361\304#\207\230=7\371\210\311uknbX\376\003Y$W\226\264]l\352\2719\367\003\231l\324\300A\271\370#\302\264\211\347f\236\037\250\254\001\343\315\221\213?\242\206\376\315;?\320P\0171d\352\\\374\0212\364Gh\321\241\223\313,\224\n\262\316\212|\355\375\025\002\373)\002Vw\361GTi\353\304:1\347X({\253(F\226\236\027fa^\264\234\221ssN\031\034\031o.>\036\314\344?\320\020\f/\266\340\270\030\016\234\374\"\313\316\034\021\235\224\030\210\027\237\211\314\215\033{$\253\216\026\335BK\233,\027\237i\313\311\231Z\262\346p\t\2511[\313\321f\346f\3145\026\312\336\032A\227\222\030fu\302\220\355Pss\rP\020<s>\3144dh\274\220K\203FN\206\226\020\022lI\2058i_\316\334.a\202\274\331\201R\246\214\320Y\326\033\032mWqf.\376"
+	.string	"\274\306\214!\200\361\f\231\222\006\327\2306\027\177"
+	.string	"W_\376\305\204\263G\305*4C\210{\177\205\030\222Qf\006\304\fs\023\256O\231\r+\027\037\217\t\346?\220\271D\016W\031\230\267\343\234\264\342\305o\345Yqw0_\304}aa\247K\227\\f\241\354\255|\304\022kb\266\367W\210\240\254\2563\027\027_"
+	.ascii	"i\364\377\233n\246\233\271e)l*O.\222\265&\311\334\336_!H+27\316"
+	.ascii	"h\271\271\345W\216"
+	.string	"\217\216,\027\233Y\356\326\177\240\242\033S\314d4\271r\005\f\320\321\215G\327\305\027@\020\375\233T~*f\225\024\266\204\210=\334\266\206\322\252t\311r\361\005@\303xs\212\321,+\261\002\310\211\261\307qK\035\013\257\213M)&\233\031eMM"
+	.string	"*\202\3344b\0361\221X\243\031\304|RVm\252 \231\213\f)0\214\027\027\213\245\235\036o\214\\\374\016\364\230\231gE\344\336TN\210f\232\351\304\032\315&&\223\233GL$f\023\023\315<+\232*\356\251\020\330\266\356\334*oN\312d\374\016\336\350w0F\377\346\222\233g\277\231\304TR\024\227$\311\232\213\255\231\246\233K\202\256\034\231l]\374\016\336\264\275\262J\031\311&\345\313e\225r\0066)\233D\314\"&\321\034b\n\351"
+	.ascii	"M\377\246\371#\303\bq\264\367\030\031\267\315\365\325\001\356"
+	.ascii	"\323F\216\307\305\357\300\207Yu\023\313\2542\3132\027q\307\220"
+	.ascii	"\225\311\224:\270li]\334\343V\261C\307\314\305\357\340\206\276"
+	.ascii	"E\3132\267\336\034\271L-\017UW)\240\2719\3020e\330\270\036\f"
+	.ascii	"HR\346\330ej\025M!\355\275\303\324a\306`\3620w\230b&\2315\232"
+	.ascii	"c\246\227\2259f\276\0303g\2309l\334\327\321\266\2722\347\b\203"
+	.ascii	"X\334\215\"\234\3658\036\252\256Rh\022\347h\3420\303\254\321"
+	.ascii	"\314\361\245\3426s\230_\346\r\033\367U\334/\254\230\254\263\""
+	.ascii	"\035D\020\325I#W#\343\337\274a\243\250J1\006;\027\2335\314\257"
+	.ascii	"\031p*.\276\b?\3727\301\254\321\244\241\361\230e\341s\361\361"
+	.ascii	"<\316\177 \241/>\306\366\350\213\270\243/\202\215\031C\2539\336"
+	.ascii	" s\361E\230\321\0271F_\304\233\276\b7}\021T\364on\231Zja\356"
+	.ascii	"\220\321\272h\306`U]|\021R\264\331\302tat\346\306\203\312\305"
+	.ascii	"7a\370\0174\001\037e\250\\\214\315\253\0137\204\230u\361M\026"
+	.ascii	"ErB\246<\271\370\346\n*uw\300.6U\350\025\"\226\200\b\272q%G\r"
+	.ascii	"\323\352\246\212?\337\261l)\352\374\350\271\030\307\320t\323"
+	.ascii	"\212\214\227\243\223\213/b\314\316\315m\307\234*\2536\225\220"
+	.ascii	"\\\307F\007\370\215H\225?\027k67E\314.\316}\362\237\\\367\003"
+	.ascii	"\001m\301Bc\343\342\213\250\241\237\375\374\007\n\352q&\b\222"
+	.ascii	"\213\257}\227\234\367<\363\371\201L4.\253)\027_\204\227~\236"
+	.ascii	"\313t?\020\351G\314\226\026\027_\204\226~\326\363\037\250\004"
+	.ascii	"ot,\2718\347\321+8\250\003\001\344\006J\234\037x\236\363l\001"
+	.ascii	"\001V\215\2579\027\347;M\317x\356\02068\270\213\211lR>\007g\350"
+	.ascii	"\320\311c\2620\325\261\021\302<C<\262\005\313\23499\316\033\342"
+	.ascii	"\275j\243\241\346\342s@\344\315\233\034\207\311\314\274\232r"
+	.ascii	"1\004\2165\3468L\264\024g\\|<v\355?P9\226\007\016\226\213\317"
+	.ascii	"AX\2336\271\f\001H\304\b\340O\037\035\027\237\003,6l:\3702\202"
+	.ascii	"s&\353m\216\0325\271,\017\020\037,x\200\\\374\020h\314\230\311"
+	.ascii	"h\354\336tDx\261Sk\216\3509\363\214\006\243q\262F\356\342\343"
+	.ascii	"\311]\377\2012\231\255>{\250\224)\223\313\314\210@\033\232\373"
+	.ascii	"\202\241\343\342\207p\"FL\036\223\005D\022,6{\346\210\340\274"
+	.ascii	"\331U\306`&@D\214\214a]\374\020G\364\237\271Xc\346\222\303\244"
+	.ascii	"\020\266c\204H\263\303\206\213\221\031\234\230\343\305\177~{"
+	.ascii	"\016\363\347.\331K\006sg\260\t\002\006\3475sfj\027\347/M\317"
+	.ascii	"oBT\340\374\f\2718\311&e\r\333*\345\033bK\213\226Lv\241\354\027"
+	.ascii	"E?\214g\310\3409kp\334\271\370 \350\364\237\335n\215\331-\217"
+	.ascii	"\005\315A\243\344\216\266ZC\245u\361A\264\321\177\276b\314W\262"
+	.ascii	"\216\245\260\375\202\004"
+	.string	"%f\364\020\325h\2019s\361Ax\251RE\210\006\210'mm9\307\205\262\247\212\206\324\221C\003\b\016\206W\232\213\017\342\207\276]b3\333\2551\263\341\036M\333\215*\213\006g+:8\b\035\372\317Q\2149J\276\341\301\0303J.\2202\304\265\213\017\202K\377Y\355\326\230\3252\215\020\234h9\213\221\271\304\300R\366\007\n\224\\\246\367\336S\305\275e\301\021,6{\314\366\327W\b\355\204\t\032<j\212\305\\f7\327\336_{*\217y\207\274\002\245\006\230\213\037\2007\375\347&\267\306\334$\317\b\021\266_\220\300\244K\017\221\b\f\035\332\2365&L2Z\206\275\367&\232Q\214q\216@\305)B\346\240\335\255\240\037OV\350\030\262dIV\222\302\336[\216\270\277\276B\020\311hC\366\343\342\007 +I\222\254\344\226\013\314\264\361\025\002[\275\201\303\343\342\377x\236\225\3305\2416]fi\027\037"
+	.string	"v\364\237\217Xc>\222e\\(\273+C\034:kl\224go\222\310\271\370"
+	.string	"\330\242\377\\\304\230\213\2205\232\366\336\221#\023\337:0\322\332\322&\310\305\007\300\023\375\347 \326\230\203db\210\260\375\"\004\270,Jb\314\355\375\325\201\245\332\"\005\356\342L\374\263\220<\204\244a\211d\364i3w\361\006.\253\224\357\031\233\224\017\2002\375\347\037\267\306\374#\303\b\342\332{\214F&\303\365\325A\321\330\2378\307\213\017"
+	.string	"\031\372\231G\216\341\271\2071\367\310e?\332{\007ya\261\3313\267\277\270B\374\307c\215\271\354r\206\266\207\362\314\021!m\027\177\0039\372\267\233\212k\357\375\242,n\256\252\241\374\333\333\322\332\020\001B\030\270@\005\353\031\3749\225\3671\r\201A(\250 \017\230\236*\320\022\322P\357\f\376\212\320_\211s\215Z!\303\260\007t"
+	.ascii	"o\350\200\021\301t(D\321\006@\251B\024-\301a\230n\370\375J@\n"
+	.ascii	"\272\320\003\242\302a\324P\351>&\250\240*D\321]\320}L(\324\021"
+	.ascii	"(\324\337\t|J[\200\022\222\200:A\002\005\013(T\324\020U5\264"
+	.ascii	"0L\223v\300\rD-\360T\r=\364W\342\004:`\250\302\321\nD\207\250"
+	.ascii	"J\342\002\t\fS\013P\023A(T\375p\037\323\b\364W\342\034\246'8"
+	.ascii	"\025\255\360;y\276\365\204\0321\\\323\022#\242\200O\003@\021"
+	.ascii	"\005L\177\003\ba\204\335\b$\240\030\201\366\242~<`:B\035F\215"
+	.ascii	"\030q\"\250\372\326 \320t:\321\037^\207\300 \257tZ\201\251\372"
+	.ascii	"\313\277_\tA\3671ap\037\023\272\236\352\006\2753\370\333p\037"
+	.ascii	"\323\0230%\301caM\201\351\321}L\303\023]\317\265\205\025\210"
+	.ascii	"B\255\303\250\020\364JPZS\240\n\275Th\336\3074\364\260\246@\025"
+	.ascii	"\206<\265\210\b\030LWt\250a\210\302\232\002U\340\361\316\242"
+	.ascii	"\373\230\242\240RT\215\212\202J\207\244\204A\0232hX' u\376\204"
+	.ascii	"\303\264'4\334\021\241P'\020\007\177\251\220\002)a\320\004\244"
+	.ascii	"\365>\246'!\017\030\205\202\020\320\351\226\303\335\223ph\335"
+	.ascii	"\001\237\204%\360IH\242)\322!\036\016Q\265\327;M)a\220\207\325"
+	.ascii	"UH\236HJ]\207\351\023\312\302N\251\207\002\237\322\337i\366\320"
+	.ascii	"a\024\036\232?\327\263\267{\0222\025\355\320\365\374\t\241P\027"
+	.ascii	"\236\204\036z\250\032\325\3020\315\360\373\241&@\005U\024>\240"
+	.ascii	"O\300\323\307;\222rJ\327\340\004z\300\022L\234\303\244^\372;"
+	.ascii	"/0T\001U\243V^\224\272\266\240F\r\201\250\007\241!\252F\255'"
+	.ascii	"\212\202oM1\300\001]S\365\204\320\n\024`\201\204\003"
+	.string	"\034\320;Q5h\003%\243\f\032\224\b \002S\n&\270\200\201\026L"
+	.string	":Bz"
+	.string	"\212\024\205\036\260\004t={\351\3574\2614\034\312\260\202\022\006&\254\350S\007\013H\254@TU\243xHR\247\252\2260\344\220\364\242\363R\025\005\242O\372!\2140\200\021H@a\236\004\003x`"
+	.string	"\017\362I0@S\223\001Fh\322\037\241\211\\\327u]\327u]Ut\345\235\352\351\343\355\326`\260\004\252\036\r\213\326\373\230F\004\323\225C\206\027\206\347\n\300(\247!t\267\252A\022\033\322 \341\020j(|BZO\265\027u\226\330m\030\256jP(\224\302\267C\327\263'\214\332)%\255\273\017@ha\202uuB{\273\225\303}L\300`zf0\214\332\371xkJ\242\007,\341\367\013\252I\031V\024*x*\245\360\361xg\020\217w\016\255\353\316\t\355u\270\217\351\304)E\016)\370\375\202*\366\361\326TX\016s\324n\b\225\252.\fy)\324\t\224:A\351\304\251\222A\025\335"
+	.string	"\217w\232k\320\205\036\372\0020\375\351\341\256\007\f\232"
+	.ascii	"\f\246P\035\320]O\005\024\301\022fO\005\264\027\204\312(\242"
+	.ascii	"N\243\365>\246!O\035\301s\352 D\327\026z@\324\034\356\320'"
+	.string	"\340\311B\221\020][X\325s\035\002\225\350N\210\227>\005%\200\366\202P@\3671}8B:\021\374\355((\222:\177C\r\250\032\325C\235\316\341/=\2352\334\307\204B\035\361$LR\203\204'\024O-U\264\227\232\b\252\302\036\212B\375\235\251\212\016\221P\240?a\324\tN\277\323\027\204\366R\025\230^\260{\212\372\t\227\324\0360-\261[\317\341\016*J]_@\205C\n\206\320\337\311\013ZU\324\0040\345\251\275\024\252\004\246P\032\305\t\245\215\206&\374N\023\277\240PEW\240\n<\225\303\020E\325'\364\004\250\323\004\023B\247\f%\244\347\0220\345\241\303(\024\252\320\017\005\002O\037o\207\"\352\334\2418\241\214\206(\324\251:\355x\352P)\035\016U!T(\265\"u\250`\215\022\002S\016\250\211t=M\244*\332\363\240\006W\336\351\264{\002\246\2765\030\204\032\356x\352\022\021\332\013\256"
+	.ascii	"\364\013\006\033\260+{\350PEM\240\352nx\342\224J\332\t\323\237"
+	.ascii	"\023\207\373\230,@\021,\361\002\357\374\2258\332\tM\224\227\232"
+	.ascii	"@{\231\307;w=5\310C\325 \264\027\204\302j\020\250\242&\202O\372"
+	.ascii	">\246(!\324.\250J=\361x'\007\350\216\005\017D\360`\204(!T\324"
+	.ascii	"/8D\325\240\341n\375E\rQ\026V\364\204(!\224\006t\327B\224\020"
+	.ascii	"J(\367R\241\320p\210\362"
+	.string	"\202\252p\327K\205H\300`\272\002Q\023\250*\234\340\002t=\321\336\316\311)\210\276p\256;\251\363\304\t\214R5\270\217)\250J=\215\030\252\301!\020\035\016\271\260\002Q(\324Dp\205\013\240\202@\264\267\343\001\245\206N\302\337\016U\317\023=\365\364\251C\247\235\357)\365\021\241\303\250]pM\3413J\341;jj\372`\227\302\247\341\203\335\352\024\034.\2358\245vA\243\023\301\237\223\212\232\240\300\013<\324\307#\312\200d\002S\341pw\342\224\312\020u\202Z\"\375\235&\004U\251'\016I\350\023\360T\215\204;\337\332KOp\020\201\020P\252w\264\001\030L\207QN\273\240*\365$t\037\223\212\242H\241& Z\357c\202:!\0341TQ\023\251\332\273`\335\231\303\247\323\205`\232M\240'\240\353\311\302\320/\310\013\256A\225\304\0210\230\016U\324\004P\005\250\023HP'H\364P\036Pj\b\264"
+	.string	":\214*Z\207jT\003\320a\024\221\224\272\242P\350\017ua\r\372\206'\240\303($\023h\217D\243~\347\005Vt\350\344D\001\364\327S\341w\256\351S\332\333"
+	.string	"L\241\204P\234PB=\340\t\005\025\344\001S\250\240\025\030\0254\001\375\005I\024\335\307\204\252A\336\b\236\222\t\023\240Q\277\323\304\016\030LW\036\252\252A^\207\025]\227\206\273\241\024\276\335\211S\252(\205ow\224\302\347\343\255A\340z\037S/\025\216X}O\351o\t\005;\3349\365Ra&aU\260'\330^*$W`\032$!\214\352\001S\fp\020:qj \252\205^*,\002\246+\254%\364R\341\021j\002\375\031\255<\324\311)iUQ!\nt\267\376\322u\007\f\246H\325\240o\t\355\005W\220ZS\023\247\372\200t\005\236F.l"
+	.string	"\246\347\003\324\340z\252\250\006\026N\234RH?\224\307+\001]O\265\250\367t\324\373\005}CT\365\255\273\025\230\006\205+:\\B\241\3225H\352\374\241=!\r\350z\252\273\244!\020\025B\005M\350\245$\326\263\204\211$`0]\323!\360T]@\241\207\242NJ'N\251\235QP\n\337\356\203\341\360\024\236\b\376\220\244T\324D\220\207\252;\337\360TyEE\3530\030,\261[\225\326`QO=O\250A\247\036\212:\355V\365\204\032\"\241B\251\365(\025B\177O\300si\230\24289"
+	.string	"\323\363\ti\b\265\353\235\250\357|!\030\374\355T\024\230\236\352\272\013\252\274\263\0030=\237\216\220\324\240\252\242\034\234\234\202k\024o\307\333\rK\234\031P\241\324\272\373@E\327_\352\224!\205o\007L\327\335\bM+0\215\322)|;\024'\324\016JE\327\336\316I\370\333\001\245z\032\320^p\005 \312SQ\022\350o]\203\252\317\005\017k\n\225J"
+	.string	"\375=\001K\340"
+	.string	"L\317\007 \255\350\020eAE\237\236R\325\205\023\301\337\257\204_P]\201A\023|<`\324\371\253`\207\016\2432\2408\177\250\272;qJ\355z\350z\252O\350\nL5"
+	.string	"\203\351z\246H\325\023\005\246\022X\207Q\252oM*\201\351\371\024\204\362\200\247\211\336\271\003\246P\273\036\321\232B\245\277\335\032%\\\243\202;5\270\006\2412\344\025\030\025\344\355~?\224\267\023\356\202k\324\311\341>\016\017\nQu\304\032\f\252#\204\206;\023\240\320u(5,B\201\366\200*\364R\241\221\211t\345\235Hh/\b\265{\212*\201\366\202\206\274t\035\246\353\271\016w/\f\317\325\310\307[\323\023-\f\203$F@\177\251SP%\201\256\247\252\364\002/\370\343\251\250\211\340.J\310#B\241R\027P\336\251>\340\t\230B\251%"
+	.ascii	")\240\242'\202\302\r\352\351\343a\025M\235\322\025\210\366T\350"
+	.ascii	"\251g\260\204Q\n\337\n\350\320\227{\250\032\025\264\356HX\201"
+	.ascii	"i\224\371\246&\023.\260\300\004\036\240yLO\251\0230\310\033\301"
+	.ascii	"s\032\001LO\250\021<u8\202i\003\272\236,\240)R\250t\025R@E\177"
+	.ascii	"Q=\324\307\033*\275\210\253\302\300\260q\261\037?\272\256\307"
+	.ascii	"\006pY\224\304\370s]g\246\221ag\312X\037\375\353>9N\321\\\030"
+	.ascii	"5-\366|\2179\307^\200&\013\210<!\214\321\277\246\313Qv\207\f"
+	.ascii	"I\221<\"\305l\215\036>Q\346\256\274\3103evlq\206'\337\200\321"
+	.ascii	"\303H\224;\231\206V\foZ\306c\321u\236\020\367\336GCn\356Xa\273"
+	.ascii	"\370!|\321p\340\350\343\017!/-4ss\256\217\357\262\002\316\235"
+	.ascii	"3\027k9\232\317\024'i.\326q\336\005\216\314X\216\"EA\264\312"
+	.ascii	"n\270\311a\352~\3341\266\321-\204\310\334\350\312\310\351,:g"
+	.ascii	"y\200\260!K\322V\324\272\370\326\250\327\3441\r\250"
+	.ascii	"\203E\246&\217\3318hF\346\322h\030radX\027\027/\221\034$1\370"
+	.ascii	"\234\321*\324\340\320\3711\243q\220f\372\3648\023\227\267n\030"
+	.ascii	"\224>*\312\350\035\031\006\2347^\310d\035d\214`~\\\374\345\213"
+	.ascii	"\026c\346A\232\0356\\\336\256\305h\270.'u\270\300\35104\244$"
+	.ascii	"i#b\311\276\260x\241\301\224\001\207\264\250c\342dR\236(1\206"
+	.ascii	"A\205\214B\252fF\224t3\025@@pL\036\222J\227M\347\001\023\200"
+	.ascii	"B\213\352\364\221&\007\035ShfDD$I\nj\324i\r;J\224\204\256>\235"
+	.ascii	"\265\241\023\177-jP\303"
+	.string	"n\203x]Ki\351\301\214G9+&-F\245\264qJ\256\307[8Y6m\335Y\202\240\220\313\237)\210\202\223\241%\034\360S\254\233\324P\305\r!\024\n\376\265\271T]$\220[@B\207\002F\031\315\340\344\240(\021\362\312\206\317\323\024%\007\222\342\321\373\362*o\330\006N\00350\005\303\272\370\324B\017\357\307\203d\305|\3050\227_\314~#\266\305\231\200\031\200d<\247\034\003\367\303\266\343_\204\301B\246\364\242\001\227\376\244\202:i\371\261\330_\021\332\253\210\360\024\200\036\214qYd`\221\3746\310\240\273J\"\fZ%\225\344sI\3535}\370_\333\275$\331\301\350e9\212\r\006\205\317x\360\212\336W\362\227\366\245D\347\2350\253{\376\025\277(;\202\022P\225G\"4\224\"\207\003\266\244;\342\351\307\364\026\357\243^\016\214[\275\214d\377X\230\316\034\206\bx\b\017\211:\244-\245s\f"
+	.ascii	"\207\367\372\307\237\322\016\343\326\024T\322\001q\367\264\372"
+	.ascii	"k\324\nM7PMk"
+	.string	"\237\364#\321\013\032\005\301D\206\272+d\354\"\003OT\373\316)\t}I\230U]Z\256.\316\366\022\210\353\242\345v.\203\032\217{h\372\200\002K*\222[\377\302T\355\260B\333\330\242\t\276w\210s\303\r.\214\252\327\0207\230e\006\234\265\256\035o\177\310\203\340\f\220\342\220\244\353\305\341\340Cbd4ook\310\021O-6(\333\357\307N\351\257w\364\303-,\273le0\261j\240\026l\021\f]\r;\001\340\301O,Z\301@\231\204\253I \234U\227\315La=O\271\275\343\354\b-!Y\013i\323\240\223\327\217\t\325\t\354\n\332\264\253\351UT\270\300\263\210}6S;\245\240\224wR\233\f\316Bl\313\334C\346n\322\r\177.jux\301AD\024\033Yl\022\203\212\013V\220Bz\370\334zH\374\tT{\325\346\0176&(\337+M\341\234\346i\230\340\"\035b\020q\274N\240\217"
+	.string	"\013\331e@~\034i\2573x\273N#\007\251D\271\311\234\177f\206\026\002W/K*\342\371\033\361\314J\275\363\362\366\351\331\022*7\361\2113\023\246V-\030\226\346\312b\207\243i\317\374~ \003\226\3126*\267p`\262\214\240\3177\241\035Mc!\334)\346\365\377y\030\b\342Y0\254O\bX\211\354\327\324$+\013\223\217\"w\310\203\351\213|\312\201\005\024\340\345\2720\021.\260\026\221\323\376\307fV\320\261\255\232%\251\303,\332\252\230\221\331\177\330fTm\311*jdP\264\313=1\276\037Q\2514A\240\002>\203\245\233\274H\354l\351&\276wC\274\3141\273\207P\202G(\325\243\221\350\200(\373\247\303\347\303t\202\317\372k7e\223\2061\321&\320GE\250\365n.#\373K\306^\220\376\235\026}\3333r\224o\03316-j&\032\365\2653\312nD!5E"
+	.string	"f-Y\204\020a\316\316<T\353@8=87\225\353\335\354\310\357\377Fmp\321W\211\247\272`<J\032\351\311%\2409\320K\222U\214L\021\200~Ai*3\275\213A\254\251\bY\234zp\215\365\376\325\337\3249=CF\264\374.\201\364\034\274U=\266\361\206\b\341\034\253\256y\021=\244\326\033\301\024\372\256\346\371"
+	.string	"\020\360IM\212i[C\246\261\247R4\356\354\313\345\345f\rj\032\316\306\236\025\3544Lt\r\021\337\333*\251\007\r\305\240\344\367\340\006\237!\223P\2010,(\t\310\264\273Lw\234\225d\344\0033\345\3667t\026\234\354\260\n?\301H\327}\016\033\361\013~$|v\212\033/\206\337\214j--p9\374\254\255\374\330h\310\301\300\352\232\324\271\\\264\316ng<\344\327~\r\036R\321\201\270oU\r\262L\267\226;\252\3236K\3407+\207\223\216\202n\2562\214]\213T\342D\020\266\026\315\361\206?KE\341\322\207\267Bl\324\262(\027J\036'\246\271#~\206\274"
+	.string	"\272\245\236\t\301\243\370G\027\r\332\3603\026\346*\233,\256\\\236\212\227\267m\363O#\314\022\177\310\304\204j}'0\236\320\325\261K"
+	.string	"f\307\232\370\201\253\340\210+\331\026^\255\341\032\310\213@\260\300\360!_@\232t\022\220c\332\245\202\020\226\261\031<\361U\324\216\037\262\b\3762;\354\314\345\340\260\335m\t90\356\270\207\267\\v_\247\233^\275l9d\344\226\242y\264\240K\211\222a\020\0057;.)\206\357\205\223\023\350K\376R\221\300\021~\314\242wH\320\025.\355\374\274\001\230\346\251\305\263a\2058u8\264\345\367\302\243\365Xh"
+	.string	"KH\203\334Y\352\302Z_I%YM\342'gY"
+	.ascii	"\266\\@\354\211\334S7.\255\374WU\346FzG\032\035\254\343D\241"
+	.ascii	"\233\237t\217}\314t\261\026\217\270\376\225"
+	.string	"\026H\327\351\327S2Q\213\247A\261\252(/\322\266\3223\005\362\\\276\246\264\352\032\032\025}K\030\342\005\360>w\006$L=\321\032\00392\357\205\276\266%\351\334\013P\350A\231\362\277\330\23734K\037\231\334M\227~*O\243+D\271l.\346\371\341\270\250\224W\t\265*\212*\311\375F5\333\b29E\030\001\277m\b\365\306\257\245PF\b1\303s\345\242zD\321\357\317\332M\224\t\345V\304\200\005\332\250\372\351<&=\025\224g|\322\221\245\177\rX\2134X\0062\206\342\224\007\337\254\324\023!\240\270\250M@\373\202\017O\241\325\224\263\352\202\031*/k{\177P-\202J\300q_\300`\021\036fM5\322\227\306\264\333S\237\223.\312\001\204m\245\246\221\265\227\013\200\340y\3413\274\345\002[\241\b\357$\377\177\3514$~\344\216[\304\350\306#\360d\317\036\367\323b\302\350,\216ma\207"
+	.string	"\322>GdV\003\330\311\3641\001jQ\331\225\334*\003B\255G\036\250\246\311|\016c\353u\331\030}\377\246\312\034\226\005EE\031\013\227\273\331\312\026\017\215\033mj\306TX\021 \026\2173\242\001,I\262\301\302\013\n\355\263>\205Q\241X\202.0\232\025\351\322\264\021gU\377\302lt#eJ\320\323\370\034\f\265\373\324#r\375s%\r\352\362 R\221\221h\331\r9\215+\272\221a\035W\256X\370\254\305\016\275\363\367\177\021t\201\310\302n\243\312*\370!O\321\365;CZ; \277\362\354\017P\002$\231\001K\321\024HIe\243QT\267f\365oZ\306\221m\032U\356\2218\323\333\331\035!`\305X\355\b\344`\033\337V\350\267R\177\257\003m\201\341\261\030`\257\025\251CT\367\255\251\262\313\330\035\376\025\353\311\020\334\273c\342r\360Zp\332\347\222\032\bOtFL<\262\314iMZ\260"
+	.ascii	"\211bh6\377t\206\311\346\031I\372\362H\247o\003"
+	.string	"\250\210\326\024\265\271\341J>^\326\013"
+	.string	"E\201\360q\340B\220N\204.\265\333\376L\322\362\366FD\022sWn\001\002\264mb\270'\261N\017\233\343\365\375\216u\376\275\367\330\201b\251\032(U\2008\364\337\b\265\030\247C\340\200\233n\350\264\032c\317 \266+u\274\b-v5\257!uOS\273\230\367\272\241\332z\032\260"
+	.string	"$\305\251\031\325i\320E\262\245_n4\312'\274\263c-\200\274b\\P9A}\233\320<\312(\034\013\b9\f\247\226\3454`C\261\013rca\200\233\033\353\224\277\216\n\262=\006$\003\227J\343\234M\366\3105\221W\241\274"
+	.string	"\353\037\330\330U\263hb\t\231,\360{/\236,\304\\\271\371\361\212\\)!}\204H\334Zn\360\310\304\227Kf?p\273\037\353\226\370\253$\337&v\024\202\323t\200\350\310\211\032p\371I\024\316\202\252\315A\337\001\307\320\313\372C\246;-k\361o\3601\243\206<\330\374"
+	.ascii	"\277\323\032\313\252\210\363\265\210\273\016[\f\345\334r\205"
+	.ascii	"\034W^\374R\233\221\271\303\247E1\214\265\235[\372\205\314\026"
+	.ascii	"\210\204R^\252\300ft\374\024V\327\353g\225\021\r\345\264e\353"
+	.ascii	"#q\344\266\020y(\2466\234g\235w\206<\253\336/\225\213hw]\375"
+	.ascii	"\325<\025\001\316h8F\325\325\254\356\213:\3223\343\347Z\177\374"
+	.ascii	"\275\332\013\302T\305\306\3254J\t*\025\001\035\273\332\314\262"
+	.ascii	"\322\305H\370\264\312\251t\222\235m\216\375\346\251\237\006\213"
+	.ascii	"l\3362rBE\221+\372\033G\254\245\324w\251T\306\345\001\360\341"
+	.ascii	"\037\242\245>5\264\341\221Vg|-\336\276'\202\032\026Z\327PC\322"
+	.ascii	"\020\340%\007\022\320\211J\003MG8\t\006\360\224\036\f\027\214"
+	.ascii	"\036+\364\317-\325\002;Z\350kp!\370\247\202\363\324+\265\243"
+	.ascii	"\304\204\017\256\353\270\337\002\002\217\336\001|c5\376\301x"
+	.ascii	"\311)\346@g}=E\313\212\272\323\261\261\035\"4\276\356\021\351"
+	.ascii	"\223l\204Td\245\241/\200`V\325\340\204y\220g\223\375O\2112\006"
+	.ascii	"\314\271\024?l\274`\3321\205\365\200\240\271\337\235\3266Z\343"
+	.ascii	"\024\235fw\346\356PH\364C\212%7sx\022@0e\036\363N\250\"IA\320"
+	.ascii	"(\267\247\377\301f)\321\335\022\033dy\264\246F;\323'\271\366"
+	.ascii	"\255'/\245j\026\n}\234\245J\325E\337C\013D\242\312}y"
+	.string	"\r\224\331\260Q\341<N\246M\214\203\377rt\216`\023\372f\n\261\024\253\373\bU\f\200\203Y\273\333a\212\236\365\035s!\b\244\007\250?\257\217b\377\260\236\251\251v*3\007}\263\345z[\003\001\234\005\364\330\326\032M<\315l\020\355)\020\357E\2672;R\231\316\340\216\347\3410\271<~\0313`\220?\0211\261\2128\240\210\t\226\3763(-\327\320\300\017\t\345\003\362\321\017w\024\013)S\215\242\270)\"R\324\350\226\345)W\303\2256\035y?\234h\302\224mO'\327$1\333\357D\027\205[r\n4\030\263\254$\255\202\253\337J,O\304\316X\002\230\210G\025@\001\002=\271\214\375\262\177\254\206C-\260]\315\002Gb\246\013\023\370U\357\324]6\002\216\251\367f\337\006\360W\026\226\201\312\t\263\257y\373r\372\247J\fN\262ZZ-RTw\005C\251\001\350>cdm\006\347\r\222\303"
+	.string	"\361\325\250\375\352U\b\002\013l\210\224\225'H\233\240\273\246x\202\306\276\310\225\337"
+	.string	"6\021c\341x\233\027\215\324\267\001\020a\254\3660\00503\273=\320\201\213N\377\223'\031|\020v'\310\037&\337\036\322\305\331x\217x\366\025\341\242z\340.\250\222\322\340k\325\274\2318~\213i\356\336\311\3314\226\316\242\207\200E*\226\311\242\3167J\027\213\345\024J\237Fa\264\233\265x\370z\030\005\031?\313121x\\\022.\313\373\270\344\266}\222\001`\200S\355<p\342\326\037\t\335N\034\372\3755/\262M\367\330\256\221\205\030\202\r\256\323\365\017\311\272!\277T\376\033u\033S\272@\213z\376\003\205Y\211\217\347^\341\312\251\3117\212\325\t\200\342\036O\bF\024\334\356\374"
+	.string	"\260\304i\0358\272\3343\312\326(b]\227a\303AIf\\,G\b\201_Q\305O\230\350\250L\030\277N\311\356\255\002\363,\007m\310Uso \267\246R\244\027\006\337\270\f*\347>\371\246[f7=\216\211 \227{<\022\007z\246\254\266\314/B\307\372\301\262\177\254\330\2676Uu\337\315tz\264\336Kx\353\320\301\003\214\356\350\260\025\302\354e$!]"
+	.ascii	"\205X\317N\325\236P\246s4\343^-\277 \364E\315\305\263\321\253"
+	.ascii	"~\251\005\263\207\007"
+	.string	"\256\357-\257\346\256\3524\342\371T\321\340oG\245\022QQ\366\213,\333\214\356\363\327\303tM`8\263\351\017\313,Pq:\301\3151\310\361x\256ee\365,7a\202.\314\374\331! \235\200\"\31483\001\307\377\254\207qoG\325f\331\313\013z\361\212\203Y\343\034`W\024\207 \033w\305\035G\n\221A-\300\027$\324\024t\2501\301w\276F\371MY\303\374J,\234\236\237C34A\326\2604\007s\005\016S\251\217(\354\272\234\325k\373\361u\367\252Vy\366pC\f\221A?|\004\373S;\204\365W\177g\225b0B\353.\373\2764\242\315k\213\030\260H.\335\307\r\305\212\305b\200Z]\241U\372}A\342\343\r\017=\177\275\237\031\023\027\260\016\370 \330\223\350\361\225\273\242\2113\364z\006\301\030\342\211\277c\001\263\345\367\206d0\256M:\001\367jw\216aQ\016\252\372@;\"\301\224"
+	.string	"\207\346\364yt\3301\237bT4@8'\232EAa\273\207\362\343\244\353M\334\001\307\217\036^HxIF\t\t\311 }\351p\270s\364s-=\023}h\326@\035\225z\307\272s\313\017\271f\016XS\316\247i\267>`/M\276\257\224G\257\025\203\330\240E/@\326\241R\006P?\033}\030"
+	.ascii	"\024\315\342i\267,eq\304\256\220\"J@\324\375\362\210_\336g\270"
+	.ascii	"a\324\233;\023\336\306A\373&\007\340\244`?\314\277D\345\037\022"
+	.ascii	"c\207\034\344\307_\b?\214^\356\227\024\326\317/\352\316}[00\240"
+	.ascii	"\244\254\322E\235\247\215b\200\245\204\377'\216I/)\027\\87)\017"
+	.ascii	"\021\252\273\332>\272\024\307\230\265\267\346\305Z\262\243Pw"
+	.ascii	"h\350J\300%'\0041\200l\022\035\024\362\312\265f\004\324~\017"
+	.ascii	"\311\003P\355\"\203T\330\302\035l\013I\035|\217\270\271*mv\261"
+	.ascii	"BS\366\327\364\303\213\330\267\202\241\365\222\362mUnp6\267A"
+	.ascii	"vE\277\177\347'\033\372\3577m\\E\257\020r\177KY<z\251\266\r\r"
+	.ascii	"r\216\332W\032\023\205\320\356m\361K\237e{N\bL\306\322\361\r"
+	.ascii	"\024\214\362\266W1W\233\3775\367\031\353\026\277\265\235\177"
+	.ascii	"\331\304\262q\235\270\351bh\016V\264\233\240&\255\332\330n|W"
+	.ascii	"\346\212\2756\345f2KY\235\367T\333\224\340gs4\370Y\224\2307w"
+	.ascii	"\007\206\337J\031\371\036\350x\223\206\n\234\267\344\245\fov"
+	.ascii	"X\207_\3164\314+\364\314B\200\355\346\223\277\252\036,\3079-"
+	.ascii	"_\030by\316\331\311\300\364\311\336\353\251\354\"\221[\005\336"
+	.ascii	"\263\375\331\302\036\351t\020\214?\377\272\362\231\t\316\230"
+	.ascii	"\2258%\245\356\323\373\205\374D\351\230\276\301\273\323\323\f"
+	.ascii	"\231\365x\271\007\226\367\355\325j\267m\0062"
+	.ascii	"\365\001\324\253g\tj\253\352/\034\343\n\230\317\r\345W\026\333"
+	.ascii	"Q\036u\177\362h3\211\360\253\337+n\2574\020\211>a\375\333\365"
+	.ascii	"\240\235{\234\272\265\201_d\226|\347\207u\205\367\007\205wA_"
+	.ascii	"\373~\345p\037\377\371\377p\237,\003\035\364\306\"N\3317p\360"
+	.ascii	"\037\360\017\217\033T\035E\375\341\207\2453\363|\247?i'>\013"
+	.ascii	"\027&\240\365\347^\3467\320\237\"\321\374\"f\337\025"
+	.text
+	.section	.gnu.lto_.symtab.6db7737d4369196a,"e",@progbits
+	.string	"systemConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"getCurrentMinthrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"resetConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"writeEEPROMWithFeatures"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"ensureEEPROMStructureIsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\003"
+	.string	""
+	.string	"changePidProfileFromCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.string	"isSystemConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\003"
+	.string	""
+	.string	"pgResetTemplate_systemConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"systemConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"pgResetTemplate_pilotConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\003"
+	.string	""
+	.string	"pilotConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\003"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\003"
+	.string	""
+	.string	"pilotConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\003"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\003"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\003"
+	.string	""
+	.string	"failsafeConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\003"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\003"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\003"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\003"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"resetAdjustmentStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\003"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\003"
+	.string	""
+	.string	"loadControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\003"
+	.string	""
+	.string	"schedulerOptimizeRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\003"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\003"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\004"
+	.string	""
+	.string	"featureDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\004"
+	.string	""
+	.string	"removeModeActivationCondition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\004"
+	.string	""
+	.string	"isModeActivationConditionLinked"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\004"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\004"
+	.string	""
+	.string	"rcSmoothingIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\004"
+	.string	""
+	.string	"featureEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\004"
+	.string	""
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\004"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\004"
+	.string	""
+	.string	"resumeRxPwmPpmSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\004"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\004"
+	.string	""
+	.string	"suspendRxPwmPpmSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\004"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\004"
+	.string	""
+	.string	"featureDisableAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\004"
+	.string	""
+	.string	"isEEPROMStructureValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6db7737d4369196a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
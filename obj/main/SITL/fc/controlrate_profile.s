@@ -0,0 +1,523 @@
+	.file	"controlrate_profile.c"
+	.section	.gnu.lto_.profile.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"(\265/\375 b\255\002"
+	.string	"t\004V"
+	.string	"\n"
+	.string	"\326\330\374\242\002"
+	.string	"\001\260\314\240\225\r\002\314\302\356\345\007"
+	.string	"\003\240\342\234\212\n\004\235\205\271\212\n\004\002"
+	.string	"\002\001\002\002\002\002\006\007\200\242\234\020\006\b\273\305\341\276\004"
+	.string	"\t\344\303\244\357\002\n\240\342\234\212\n"
+	.string	"\004"
+	.ascii	";\023\334le8E\331@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"(\265/\375 ]\325\001"
+	.string	"D\002Q"
+	.string	"\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\003\001"
+	.string	""
+	.string	"\001\002\002\001\001\004"
+	.string	"\001\007\001"
+	.string	"\001\b\002\001\002\001\001"
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.ascii	"6\303\250\212\364\313% #\317\r)V\333,h\003X"
+	.text
+	.section	.gnu.lto_.inline.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\205\005"
+	.string	"\362\311\035$\2207\351\177\365;~\306n=p\273\273\022\035\224\025y\257\270\215\335\317\306\363\356\356\024l,Rkd\023\271S\377P?TWs417|Pv\367QA*\347\366\317\334\243`\352\r\331\035\024\254\341~R\023\231\tx\201\260\177\021\033\037\221\231\323\367\177\365\256\037aE2s\271\177\377P\353\317\301\377^\250\231\231\312Kk\"a(\230\376\025\326\242r4\232g_ \027"
+	.string	"\251\020S\210\001\002i\325d\314u\2002\200\005\346\272\231\250O\205k\ty\223\b\254\004D\260K\r\002W\205\327u\005\214\246\","
+	.ascii	"\354\n\301\263\2412N\001\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"(\265/\375 \260\335\002"
+	.string	"\262\204\016\027\300\245\320\001?X\275\351\037\374\\\376\377\017Z,\246\221M\366\226)\005Z?"
+	.string	"\207\320\231\360d%\253\300o\026\305\026h\265Ao\320V@\023\255\315\341s\2544\254\344\035\034\004\f"
+	.string	"BH"
+	.ascii	"\366\240\260!\326\345\241e\254b\2029@\201%\205b\227O\021\222"
+	.ascii	"Y\360\006\332"
+	.text
+	.section	.gnu.lto_.pureconst.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\002\230\004\004\230\004\007\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"(\265/\375 sM\002"
+	.string	"\324\002_"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\005"
+	.string	"\001\274\006"
+	.string	"\260\204\200\370\267\004\002\002\004\001\002\b\001\005"
+	.string	"\001\002\005\001"
+	.string	""
+	.string	""
+	.string	"\007\002\b\0071cO313"
+	.string	"\013"
+	.ascii	"\270\001\020\256\347\306O{s.J1\222i\257f\0164\013\007\243\f\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_.lto.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_controlRateProfiles_Registry.23.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"(\265/\375 \240\235\004"
+	.string	"T\bb"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\202\200\200\374\342\203\254\213\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\375\007us\307\007uq"
+	.string	"\005\001\006'\001\234'\001\214 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/fc/controlrate_profile.c"
+	.string	"\004"
+	.string	"J\005\017\263\350\024E\336"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetFn_controlRateProfiles.24.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"(\265/\375`\205\001\375\017"
+	.string	"\266\237nF\360\260(\035\272\214\327\267CY\353\033\273\344G;\303b\304:\356_ryv\350J\353G\254%\250\374+\206\253_\304\371\367\245\037v\326\265\237\214\303\344a\334\311\201*&\230up{\322\264\271jS\355'{\313\235RY"
+	.string	"W"
+	.string	"\\"
+	.string	"\237\006?\332>A\037\260}\232e\317 P\022\300\306\344\305\306\356r:\302\333%x\313\310\372\224\032Y~\313\343\007\023\326f\276\326\247\f\241\270p\021\360\225\310\006:\262\226\323\036O>W\224+)\327\323>\222\271j3_\312\343\307\301\356:\302>\224{\273\355\021\333\021\354\317\0022\0378l\260\306\354\320g\377\347\341-\037\255\032\0355\372"
+	.string	"\264\203I\314\bg\327C\017\216\2151_\224\210\361\241\375\227\203>\315\242O\333\345+X\017]#\227\005\b\013\214\235\335\365\3704\004\320\347\001y\221\355G\373,W\301\372,\303;vc<4\273\340\0023"
+	.string	"\005OPS{\205"
+	.string	"\305\303\3740o\241*PC\306\356\3530_\3463\026\344I|\032\203j;\354\323Wm\237\252\366\310\205x\230O7\"^\332r\324\217\252*\b\235\027\n\003\367\315v\215\372\227\tW\354\261\324\353_.O\340\310\302ZL\016\222\330\243\232\"\207\306\rU\025\033lE\215\005\250S@\235R\335\003\323\212$\241\303\245\017S\b\352\324y\"\023L+\222\027\322y\253TW\342J'.\205\"U\340J\236\212\373@\340N\304\344q\253\256\3638\021\270\327\230\337r\220\025\032\236\035\022uMU\361\307FC\2529\321\343ROl\327lR?\013s4\304\033\227\273\273\322\n.5\244\247\005\032"
+	.string	"\2423\341L\213\201\032\3224xL[v\277,\201\025\022\263z8\301\342f\332\203i\223k\206\020\342\260\025\005\212\313Ah?Uk"
+	.string	"\021\253\3566\253V"
+	.ascii	"aqCD\331KW\215\007\024\021\3235\237"
+	.text
+	.section	.gnu.lto_loadControlRateProfile.25.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"(\265/\375`\304"
+	.string	"\375\n"
+	.string	"\366\323I@0\247*\035\005\217\377-\267oNs\250A\017\277\346\262\333'\"\267Y\034\037\366%\317\260:N\342\362\017\327\017\326\226\f,\326\035C\b0\351@G\261\032\305Xh\330\fx\200\t\fF6\331;\2452"
+	.string	"5"
+	.string	"="
+	.string	"\256\244d\335\253=\262\273\327w&\331\b^\256\366.\324\351\305`w=*r\322'\311\177\353\2251\265\361\2110\261\273\236c\252\343\246\267\275`\273\302\276D\376\204\346\307W?\304\275\236>\200\310\032\220\245Y\263K\323\244!\366\267\245*{\233\336\350\364\234\323\3478\022\003\n\260]T\315\301\322j\201\021\333\367QN\216~\022_\353\r\nd\256\003\261\005\344a\242J`5j\\"
+	.string	"X\023\254v7\"\300_\027\031\215\206{\335\350\311;|\2203\223\230\307\351\244\333\354\364\300\234\003\b\023v9 \374\362)\031>\3535\306\370,\340&\203\tE\217\005\b\272\210\233P\004u\302\317\3730^'s\341x\237\370\361,\f\016=\240\350\201\302P\364\272\262\364m\251\312\024%\264\0225y\243\376\200\307D>\313\227/\025"
+	.ascii	"\020)\2022\253\t\274\030n5\370E\330:J\210\005l\\\232\to3\020"
+	.ascii	"\030\330\020rye<\244j\320\205<\004c%(\333NY\276\264\013\316\271"
+	.ascii	"\2050\237"
+	.text
+	.section	.gnu.lto_changeControlRateProfile.26.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"(\265/\375`\264\001\005\020"
+	.string	"\206\335iG\360\260(\035\362\030\302\233q\310\275/\322\326t\311dY\247[C,\346\353\264\340.\235\r#;2\354\375\326\352i\305\271V\"cg\2721f\372<Lp\246\305-l\f\n\006\002\362\233\352\216\032\372S\333\310&[\246\024P"
+	.string	"S"
+	.string	"Y"
+	.ascii	"\240\317\203l\253\332\013\032\250.\223\262\334\025Q\273\331\215"
+	.ascii	")0\203\317\247U\266\215\307`\366#\313J\n\034\273\353\311\021"
+	.ascii	"W\235\223\252\362=\"\037\342ku\016\304e\200\227\213;\260\273"
+	.ascii	"\237\271rx\265T=\"\273k\025_\037\356y\333\021l\203\366w\002\023"
+	.ascii	"@K-\007\013Ko\272\273+)_\346S\235J\002\035v\2143\\\252\303\216"
+	.ascii	"\265T\276\330\347V\272\330\235\372\243j\317Ts\227\371\025\244"
+	.ascii	"\213A\243\200\316\256\207\033\217\265M\034\022\266\357\237\370"
+	.ascii	"\250r\024\376x\321\036\273\314N9\215)\2740\261\273)\266\212\035"
+	.ascii	"\363\262'\270A\033sf;\343oN\263v\321\364\232h\352<\260y\213\321"
+	.ascii	"GB\322}~\344\307OXN\rX\211Y\bNz$g\263\322\3432\227\234\005\351"
+	.ascii	"\263\353\232q\362\262s\260\026Z\016\032\226\3368\225v\311W\244"
+	.ascii	"\f\300\354\256\003\277\346*N\374\230O\203(z\021\245{\326\260"
+	.ascii	"\341\313P\2220\341C\211*\f\360(\3443!\215\200\241)\364\241D\241"
+	.ascii	"\t\030\242J\340\310\033\215x%\222\350\304\033\205'/\004\201A"
+	.ascii	"\323\027z(\020\f=P\214un\245\213!\310\260\261d\313\002\324\266"
+	.ascii	"pA/\3723\007\251\201ak\311\225?\322\307\271\213\223\037c\f!\275"
+	.ascii	"\030\352\036$ P\202a\314\314\003\200\211\316`-\312\2042\323\331"
+	.ascii	"\0306\263\262\322\324u\227\311\2131\262e`\257u\221c\234\320\\"
+	.ascii	"\317x\254\271[VX\252(x\027\"\356\320H\343\343pk\301\302h4\246"
+	.ascii	"\203\333\246\261P\255D\r\337\356\224\243\362s\200\355\035\227"
+	.ascii	"\302\032\333\025\312"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.27.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"(\265/\375`0\001=\r"
+	.string	"\206\030XB"
+	.string	"\2216\035[X\222[\317w\256\276g\r\342\333\030\320#\326\243\356\005M;b\003\275"
+	.string	"9\260\255y\007G\212&\004\217\005\215-)\273k\326:\305(\3752\230r\\w\006\211YA\262\330\233l)S\nD"
+	.string	"A"
+	.string	"C"
+	.string	"v\214\223H\354ULt+d\354\256\245#\376\371\0045?>\225\301\210<\320\247\215\017\207\260\203\245\324\025\030\211p\251\274\221T"
+	.string	"\036\t\354\330\335\247<5x\\&\225\331]\247\310\363p\307\333\216`\233\202\375M>\\\035\331\231\306\034\345\247~\362\307LCM\253\246S\323\257 \n\026\004Vv9|4\2664\2718a\373\225\215\342y\200\345ZJ8\310\264\021(\370\374\304c\335\r\301\322bW\305\001'\330\370\344O\n2\245P\251\250\030uv5B\371\371\245\303\367\002R\032u\300\206\226\334]\220\252\211\355\fQu\202\n\214\221\234\341\324\253\352\264\322\2018\351\224\246\nx\231\356\211Q\257/)\371\272\024\\~6\211K5q\227\326\341\300\200m8\r\036`\233\006\302\202\255\263\341\360\345\201\205\200|d\232\210\004l\323h!\231\266q\262\313\272>,\016\210\246\202ui\035\313\303\2003\021L\263\266,\323\254\212\024:\\\035\231\201K)\244\334\024\023\332\302\205\274\310Oy\206$\034"
+	.ascii	">\353\341\211\265\365\0348\023\272\223bT\030*\365{\271\320CP"
+	.ascii	"\213\275\210\007\267\200\264\240\r@!>\302\004\223\031\316\232"
+	.ascii	"\203\271\206\033\314\002,\302\030\2400\030\246\317\300\301]\002"
+	.ascii	"\006\254jd\315\220\333U\364"
+	.text
+	.section	.gnu.lto__reset_template_45.0.29.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"(\265/\375 \236]\004"
+	.string	"\362\007\036(pm\032\003\360\256\257\203\242\b\360\230\252\252\032\266\020\252\b\004\002\201@!\254\352\351\241\252\243x\377\305z\232\301R\355\235d\226eAU\205sN\250_\016g\020k\022s\2127\2139\214\273\306\035\307\236\307\037\310\\dNr7\241<\302\264\254\272\036 \312\367zO\276\024\265\024\337@HEO\333\2307\303[\241\"aZV\275oB|\007\240e|\177\212\257\nT\325\022\006"
+	.string	")\361B8\006\215=\205\216BY2"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.part.0.35.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"(\265/\375`?\002=\021"
+	.string	"\006\037oH\320\322(\035\313\214\300@D\220\271!!\022\235YX\214\016@\331\314@E\264\317*uTv\f\357n\023\\\366\326{^\374\244\f\245N\203\321\257`\220\265o\225\261U\352}\360\343\037\310jS\224\025\273\027\026\222M\344N)S"
+	.string	"_"
+	.string	"Y"
+	.string	"5\0369\305N\003\373\270-.Vi\217\234d\247\201YwM\374\364\354\3360\3704\t\351\323\376\214\355\230\213ev\217\217\267=NE\rghw\277O=q\331Uv2\377\270\203\330^f\327"
+	.ascii	"/\037.C\336\001(\331]\223@\334\363\266O\266;\330r%\322\3626\377"
+	.ascii	"A\b|%v[\216\212\026f\372\254\220.;1\273Jh\0344t;#\204b\fm\206"
+	.ascii	"q\201m_\3473^v!\030o\036B\212~\324Z\f\355\216\337\247\307\037"
+	.ascii	"\360>I/\340\3719\003\267\343<\347\365\033\223\314\200`\354\356"
+	.ascii	"K\372\270\230]*\331\214#\354\003\226\246#E\004\225\017\317\375"
+	.ascii	"F\316\026o\243\206\247\317u:\365\270+\230\001\321\202d\030\345"
+	.ascii	"\334\3075yn6\f\247\2212}\334v\267\001\317{@\037\305\247WZ\362"
+	.ascii	"\266\226\367\251\372\234O\027A<fD\350\204\270J\365X\220\300Q"
+	.ascii	"3b\221GRe\254\335\273\325\030{J{*=_\363wSZ5\256\220\n[\246\013"
+	.ascii	"*\023\026\004\t*\0215\301\201\330219%\242BY\235\200\241\n\005"
+	.ascii	"\225\210\nQ\300Pd\201\251/u\362\261V\250\224/\025\266>\221\004"
+	.ascii	"\006UT\341'\202`\370\225l\313w\2531~@\224\203Ei\2522\266\005"
+	.ascii	"H\323\375\343\251zj\257,\310\333|\334I;^\300\020\tm\320\231\003"
+	.ascii	"/ p\002\231F\354<$\360\352aXw\323@\017\t\214\202\221v\244\264"
+	.ascii	"\301\221\305\005\231\350\376\324\202g\336i\227\241yVV\227\031"
+	.ascii	"\030\260\037\242>\314\021\216\226\003\255u\"\307\371\2107\356"
+	.ascii	"\361\016n\031\266\f!M\225Yd\276\032\233KL\354I\212\301\355h\231"
+	.ascii	")2\tu\254\346\360f\336.\013@{\221r\212\247_\213\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"\r\006"
+	.string	"\204\t\036\001"
+	.string	""
+	.string	""
+	.string	"\002\030\177\t\210\214\225\311"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\035\006\200\204\001"
+	.string	""
+	.string	"\003\002#\177\n\200\200\200\200\004\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\024\013\201"
+	.string	"\002\031\177\f\272\200\036\r\023\016\032\177\017\002\033\177\020\027\021\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\025\022\001\034\177\023\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\001\037\177\024\003"
+	.string	"\013\372\363\352\266\003\001\204\001\003\002\013\244\001\003\007\344\001\003\b\002\344\377\220\375"
+	.string	"\001\202\006"
+	.string	"\017"
+	.string	"D\313D\304\f\212O}\320\023\f\317o\036C\206 \254\031\016\002\350"
+	.ascii	"\016/\025\370\b\003\006\247\031\025\376\t\241\312"
+	.text
+	.section	.gnu.lto_.refs.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\004"
+	.string	"\002\002\002\003\002"
+	.string	"\002\003\004"
+	.string	"\003\004"
+	.string	"\005\001"
+	.string	"\002\003\003"
+	.string	"\001\006\004"
+	.string	"\004\007\001\005\002"
+	.string	""
+	.string	"\005\003"
+	.string	"\002\003\005"
+	.string	"\001\006\006"
+	.string	"\003\t\002\003\002\n\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"(\265/\375`\035\027\315q"
+	.string	"J\300L*T0\216JJ\007T\022\341\340\2128\335\373\312\b\003fi*\226\021\221@]L`\376\331\217\035"
+	.ascii	"\363\221\201\030\025+\353\277\345\373k\235 g\315\312\301\353"
+	.ascii	"\334\354>N\b\303m\374F\302\300f\352X\311\376\217f\225\240\365"
+	.ascii	"\244\263\271\315!13\007\334zB\244L\001B\002\222\002\250\002j"
+	.ascii	"\330)\304kzX\213\023\016\253:\225\206[\307B\2737\234\372vS\337"
+	.ascii	"g\352;\211z6S\206\227=c\214\234)\322)\317\361\030v.\300d\316"
+	.ascii	"a\370\312m\214\315\333l\"j\314\234\235\276\207\250\347\005vh"
+	.ascii	"]\035/\260\3430Eg1jT\240\322t\332\235\025\307o9D\266P)\323\351"
+	.ascii	"\037\310\022\005m\312\225*AX\241\002D\233\225\266 \256`\251B"
+	.ascii	"\004\027\301F\360\026\206c/\374\205\2730\027\036\202\301\260"
+	.ascii	"\223\337\370y\026\202\265\234\233\347237\262'Y\272\300z\3401"
+	.ascii	"\036\364^\254\267\256\026\016\264"
+	.string	"\3407v\3431~*)\330!M\356\336\346\371\354/zc\037\370\007\023N\367\032}\b\260\365$\315\f\335\275W\205\220\212\234\032d\250x\b\245|9h\347\303_\324\363\025\365|\246\236{P}\216\250B=T\024lCM\321\252\347\037~\206\302h,e\205{\217\367^\001v\310#SI\247\274\306lg)\254vY\n\004\313{\215,\245'\315\275\306\036\346\003\230\017Hw\320:r\266K/T9J\3219\rh\227T6o\017\3726\265VC\2476=\225\005\007\355v\f\264{q\202\3727\031\352\3458h\307M\016c\347\t\026\273\003-\216\026\235\334\257{\233=;k\230\254A\323\3519P\317Nn\200\361\266\270\220z>\261\343:>\261{\253\247\343\240\335\317<\374\334\204\277N\240\310\033\313[vo\363\247\247\311#j\253\32379h\2472\320\256\200\235\277\177~\016\340g\241\237y~&\361\263\317\317"
+	.ascii	"\374,\300\317A?\227\370\031\350\347\236\237\tH\377\227I\341\347"
+	.ascii	"\b\200\374\254u\336\337\030,M\264\016>\361s\005\337\222U\302"
+	.ascii	"\177\023?c\335\347o\247\237}\374\314\300\216\377(\374\346o\023"
+	.ascii	"~\036\376\374\302\317L?\023\177v\341\347\366\347\030t\374\254"
+	.ascii	"\302\317K?\007s\374\357\371{\356\347\251\237\245~\236\341\347"
+	.ascii	"\246\237_\374\034\343g\016~\206\361s\006?[\360\263\004?\253\370"
+	.ascii	"\231\305\317C?7\360s\001\377\305~F\361\263\001\377\301\374\377"
+	.ascii	"\372\037\364\277\355\277ZWWW\367\267\211?\345\372\177b\004)\222"
+	.ascii	"$i/\265(\264\344\031\345\206\016c:\274\275\322!\320\324H\353"
+	.ascii	"\264\227t\0168^\342\332\330\224h\225\371\222\326\251\024\365"
+	.ascii	"6K\324\356\332\001;\033sC\020\365\357#Fv\350\324\220b:=3\341"
+	.ascii	"f\276\211t\2216\202\301\023\322F\t\026\271\233\334\261\342\252"
+	.ascii	"y\354!\313Bc\243C}k\365\326\033\310\201\364\020\265y\245\030"
+	.ascii	"\312\322\210/\272\253T\246\310\241\321\303M\215\220\367\220\203"
+	.ascii	"\321\271&lf|\241%\351\364d\232\313&\f\227\215$\227\rled\006\324"
+	.ascii	"U\316\323q\256\210N\235\035\244m\340\200\0219\202DM\375\373\337"
+	.ascii	"]c\362\336\233\303\246y\223N:g\033\346\024\377\016\243\214\300"
+	.ascii	"\377\364\242\177\t\017\232\267\370$\315\0305I\232\261\252Q\334"
+	.ascii	"\333<\357=2\213\0300\247\216L*\244\030\363\026\2177\024\177\222"
+	.ascii	"\227YD\212\335\373s\217\307\342\006\313\373\203\024\273S\367"
+	.ascii	"I\313\024\337&\263x\217\313\373s\217\327\210\002ydN!\305\214"
+	.ascii	"S?H1\346\324\025c^\237{4&i\034o\362\347\2121\303\\\261\345\224"
+	.ascii	"\017Rl9\205\024c*9\013r\213\334\024Y\032\255(F\202<^\034QV\306"
+	.ascii	"\244\317\023\331\\\336\267{\271\f\352&\021\270\327j\231|3R\261"
+	.ascii	"\232\323\023\207\023\232q\311\315{o\211('\255\345=>\221J\226"
+	.ascii	"\367*qJ\272Q\020\024\233\317+\204\237\305-\253{\003\352\336\001"
+	.ascii	"\242\356-\362}\336{\213\367^^\322\252y\257\017\037dWT\324\275"
+	.ascii	"J\241\250kU\\\203\272\267\313\272\250M!\305\264\226Ekdb]wF\263"
+	.ascii	"\310]\367\215\231T\305\212a\367\306\234\3325\245C\f\017\265\371"
+	.ascii	"\245#%Ed\271\314*3\323\203[\247\177g5\226\016\030\325\332\223"
+	.ascii	"N\257\204t\300\370(;\353\364\251Q\375\0035\376\316\3215t\217"
+	.ascii	"\226j\252\236j\035\255l\036\355\243wt\262\255\330\331Um\343}"
+	.ascii	"\243\243\336Vf\364\223\221K\027\323\321u\265\361\350\205\254"
+	.ascii	"\253\370\f\227\341'\027\006_`\344\272\252\241\372\211\237\312"
+	.ascii	"t\207.]\305rl\206\237\\\351\327\021rW\220}\213_\272\276\032\307"
+	.ascii	"\031\2712F\303u^pr\367\336\246\361\300\317Bt\025\037\301c<\305"
+	.ascii	"f\001qXg\274\356m\252\020R\261\323<\253\312a\"=:Ee5\016\332\r"
+	.ascii	"\200\206\251G\231\250G\273\324\243@\324\243W\352Q\036\375\304"
+	.ascii	"Vx\214=\322\203\254\323\243I\025-C\241\324?\323p\207\003\223"
+	.ascii	"\344\013\033X\247(\017\224\352\\]fR\036w\271d\017\235\022\272"
+	.ascii	".5\240R<\034M\320\004\331\001\206\276eE\001\243cH\232\203\031"
+	.ascii	"\253)t\252\303\330\311\017\033\252\244Pi\260qY\333\242^\315\321"
+	.ascii	"\242\032T\n\335\242s\213N"
+	.string	"\256\024\017\n\223 ^t\027\251L\301c#\216\t\004E\036\225:\212\303\201\026\207\013\006!#\353\024\215:\013\231#C\332@o \371\202\266FLEk4pu\346G\032\032\\Z\214,\351\264\321\031\207\353(\266%W\235\242P\217\333A\013\343\262B\237P7\255-N\235\242F\324\211\235oC\217\347a\233a\326\306\203z\032\370m\273\256;z\377\233\0336, \314%k\376\033\336Y\021U]]\352U!h\3204\330\007>\367\002\311R\363z\202\023\322\351U\033*\224w\020\354l(}\004\212T^\035\027\330\270V+\022\370\261%\325)]\243\315\205\021b\215z\376\302\322Y\274\310=\333\355\253\313\226&\"\207,rEB\264\033O\361\347\336-.a\332L\227\3511-\246\311\260\263\347\272\210\267\225n\273\320\225\271\326\362\326W\346\332\210\216\343\247\322\347\036\243\304\341\324`>\257xR,\2073\341\204\374"
+	.string	"\fN\016L\313\261\263\343.\324\274Eq\375\326p\374T\372\360\254SBWB\305\216\230!\336\252vp_x\320\2326\314u\332^xJ\252\266'7.\354\354.*\031\257\265\303\345"
+	.string	"1D\253M=o\212z^\231\332C\250D\310]\2719Q\317\003S\317c\242\236\207D=\257H\226v\263\021\2632\306\315\215\307z\013\226\033N\\*\212\024S\032\210\256\362\337\364\354\240\026\004\312R}S\001aH\026(\235\246\374)\273\226\362\376\341\277\351\266#]QU\352{\255\331\376\033\236\267\033\314\302:=O\rJ\335\230\036\235v\232\n\305{Z"
+	.ascii	"\347*JV\247\375\035\205\313X\212\fuj\314t\272\303@\273F+z\373"
+	.ascii	"\220\343FE\256\207NuvoO\236\264\231z\2234w~\204\025\351\262\267"
+	.ascii	"Y\023\266&\025\217\245\2159{\254\263\204\2327G\216\331\263\312"
+	.ascii	"\212\236\"\317.\305%\316\263\263\235\215\204\235\334\242\n^r"
+	.ascii	"`\321\335\253\\\201\223\205f\315\020?\232\315\016S\213BH\344"
+	.ascii	"\372I\206\207\253\223y\207iQr\303\256F\023vv\223\006\273A\336"
+	.ascii	";\265\302\313M*W\360\224\301\341^N{\203\375\375\325<4\026\016"
+	.ascii	"V\032)"
+	.string	"k:\275\261\262\351\202C3\301\241\275v\367rs)\225\274\312dJB\241\006=\233U\211\005_\313$c\200'\r\375X\242\337\021R\020H$\256?!+\302o\204\026\030\004\372\004\201lK$Z\215\230\224~A \021Kd\"\"\241\244\304\024\f\n\203\274\266\267\203A\030\344\035\371V\245\264i\370[Z\227vMC!\214!\021\322\020\350\027d\312\t\036\265\r\261\247\323\366\202HC\233 \322\020]e"
+	.string	"\022S\"qe\215\214|\274\246\241\360\227\262\355\0205Z\203H@%\037\317h%2\245A!\260\375\255D\336\331\036\322ph\247\211m\211@\244u\004\023+R\320\227\364\023j\203+\3132\375J"
+	.ascii	"\031\371\204J$\232|,\233\001\t=\003H\260\030jY\337p\bF\323P\370"
+	.ascii	";\321\002\360\037\261\027\354`\004\244\341\211\377\200\354\032"
+	.ascii	"\\\221\324C\340\242\001\027/b\340\375\305\004,&`\261\373\213"
+	.ascii	"\t\212\212&pQ\244\336E\021\312b\250\005\004J\303\245\265\355"
+	.ascii	"\265+qe{\001\264OR`5\022\312\360\r["
+	.string	"\036\320\013#\240\f6\251\345\275`\223Z\225H\374\261<\3410\006\016~\354\216h\263A\f\021\330\244\022\202MF7\273U\311\367#\366\332#`\022\261\267\022}I\303\2376\b\024\016[\360\255,\013=\337\260\345Y\207M-P\033\\\177\354:\354)\265\255\220MjI\264=\027Ej\013\\\002*\365p\2364\204\004<\022\340\302\341\312\022\265B!K\224C\354\301XZ[b\023\221'\206\325(\030\303\b8\354y\001\330\376|?\253\221p\251\207\304\304\302j\204C\374\001[\"\260\365\265\304^\013D_\333\223\364k\2010\220@\024\212\340B\204\240\026~B\245\037\273\276 \3541\r\177;\353\022\260\204\365\347c=@\n\002\227\330\f\202!\260+\f\302!\t\326\227\364K\331\025x\004l\203\253Q\f#\326'd\241G\206$\031+1ig\264\262LH\300\243\240\360\207\323\366^\264A \023\357EE0P\230"
+	.ascii	"\202\007\352ohU"
+	.string	"\002\036\t\331aom}\254\222\220m\203\302\037\321\357\210(\b\364-\021\375X\"\321P\002k\353\033a\225\001\270\004l\207!\260\253\022\223\321\232\364#\006\005\361\272\231\303\001\326\326)\272\325\250\026\n\344\350\026\312\274\003-\256sl\242[)\037\300\303|\200\315\024#F\347.\375\215\326\217\016K\315zpi-\221\340\334b\024 :E\255P+\024\353\246\b@\0325Xg\350\256rG\212\037\275:\212\325\\<Ct\240*\233\222\326\260\326\004K\247\277A\252?\352\343hU\217\030\036?\252:E\225h\017\035\272\316\270tzv\006\201\266\250\221,\247\2243#2#\"2\222$I\007\361\004\204 '%\204\346\001\022\300\0255\221!iffd&\005\005\225\302\306\001\200\241y\203\371P\341\007~\300\023B\204\302M\352\254\234\224\021\304\211\327?z\215\314k\260\203H\004\2677\374\203;\016\354^x\325\030\245\236"
+	.string	"\362umL\372\246^'D\023\241\216\023\317\255\267\320\001$\fE}b\326\335\252W\017\250\373E\214"
+	.string	"j\344\274@\026/]T\206,\317!\271\317*O\202\310\343,4\250\233'\177\251\232\363\335\020\035#!\036\227\353\021J\324\272\250\346\331\001Cta\300\274\250\272\371\351-6\247\307\3649A\035\022\325!yO\214T\224\351\314\267-\016\347\367\033=@aVe)c\027\311)\276\365\273\245GStS\"\223\n9\373\320V~\016~fd\231`\366m\356|\310\343\r\310\030\223\271\267\236\b\243\335\253\243\177]\02178\361g\202z\301R"
+	.string	"&\210\023\"[\215\322\371\267\177>-\317V\242\261\312\230z?\363\rM0\007\"\013\340\300\203\252\232\003\204\233m\031\203U\264H\0269\362\f\247\361g>\356\345\207Q9\207\346\327\347z\374\344n@\332\016u\326\341\340O:'\376(O\007\205\254\362\363\276\252IZ@\246\310\361]\\\215\370\277\"\264\244i8\351\246@o\316\373\032c\200\234\356@\240\262\f\242<\307\213Yq\243"
+	.string	"\2418\216J\004\261\334ZN\351f\"cb]u \271\222\311}/\234r\374\264\026%zG3\257\264\214\002R2\037\300\034e\002\2113\213g'\006\206]\004\031J\313\251\201*\t\216B\314\025@\2579{j\357\301\351\0042\023\240\231\017\236=\035\r\227\023\326_\016?\026%\350\017!\310\207kg9:\241sv\306s\347G)1.D\303\262UE\316\330\230\343\350!w`\035\206\231!B\234\313S#x>j$4\336>\334\327\252\352\333\336o\332./\350+D"
+	.string	"\006(\256\367V\016\253wQ\013\350l\332\265\307k\352ir\221k\330PP\030\237w[bl\347y\347\tj\371\334#\243\206\022\317\n\210M\253\355\020\225\206\215\rD\235\224\371\331\364\274\251\233\030(\201:\234\n\362\216\316y\321\021VB\222\314\"\006\237\236\223\325%\3327 Ot\371\324\n\377~\243\276i\344R\242\025\363\350\216\374\b\b\213\310\326\356\354\005\371[\264\"K\273\316\271Hd]4jpb\300=\013\356(r\r\210\250\023\200Go\002\330\307\207\001\276\026K\241n)\250"
+	.ascii	"\247\320\nx\254\356\223\021\265%N\21322\370\351\220n#\224\363"
+	.ascii	"\226\250]b\223\355\357\224\225\220y\332\037\243\344\273\032s"
+	.ascii	"\223\240\022\340\210\3617m\026\324&\257N\325\312\002\367\001"
+	.ascii	"w\206\274?\020%zG\301\001\017\310,\366\364'0s\206\035\310\344"
+	.ascii	"\256\321)\251\214IJ\212.\2377~\270\227\0274\20254`.#l\004kh\222"
+	.ascii	"\001,w\230l\313\210\355\001\317l\217\226&\353\331\f\323\323\004"
+	.ascii	"\036\275>P\206\2512\231\367\254Ubg]ZR\343z\322B\354\327`\326"
+	.ascii	":\375(&\002\342\"\177\352\353UN\233\001<a<W\355Z\360\n%\236\346"
+	.ascii	"\037\013\\\352\361\225\373\212\\\0203\003g\251\211<<\265]\264"
+	.ascii	"\207\353M\004\367\363\304t\020,\030l9\\LNU\373\027\035\3109h"
+	.ascii	"\216m\316\231\265-\2579\372\263|\325\360\204g\365\213<\362\372"
+	.ascii	"\332=\377\035Y\r"
+	.text
+	.section	.gnu.lto_.symtab.e49ac29d9c4e7ecf,"e",@progbits
+	.string	"pgResetFn_controlRateProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"loadControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"controlRateProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"controlRateProfiles_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e49ac29d9c4e7ecf,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
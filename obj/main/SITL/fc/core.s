@@ -0,0 +1,3119 @@
+	.file	"core.c"
+	.section	.gnu.lto_.profile.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\251\002\225\020"
+	.string	"T\025\235\003"
+	.string	"2"
+	.string	"\336\224\344V\034\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\004\002\005\002\004\002\004"
+	.string	"\001\352\263\360\321\b\005\006\007\b\t\231\357\210\200\005"
+	.string	"\n\350\326\320\274\b\b\001\002\006\002\001\002\007\r\342\265\374\323\016\b\b\002\002\002\t\021\251\222\262\341\t\024\n\002\n\013\022\240\342\234\212\n\024\203\312\357\216\007\020\002\001\002\f\001\002\r\002\001\002\016\026\027\033\243\262\274\213\017"
+	.string	"\034\250\200\234\374\004"
+	.string	"\035\315\206\311\270\004\017\002\017\017\002\017\036\037 !\233\304\365\321\002\002\"\214\233\312\236\002\002#\301\212\240\304\005\f\001\002\020$&\311\202\342\200\017\r\017\002\017'\376\336\373\325\016\n(\364\355\322\327\017\026\002\021\002\022\023\002\023\002"
+	.string	"\002\024\013,/\310\351\233\230\003\n\002\002\t1\304\306\257\225\005\f\001\002\016\001\002\0162\304\256\254\212\001N\001\002\005\004\002\004\025\002\025\001\001\002\0013467\234\361\365\241\r"
+	.string	"8\350\300\306\254\005"
+	.string	"9\234\346\300\362\007"
+	.string	":\312\336\235\231\b"
+	.string	";\377\240\343\367\t \002\004\002\026\001\002\027\n\002\030\002\002\t=@A\354\206\342\366\006\002B\342\201\222\246\004\002CD\222\252\354\340\007"
+	.string	"E\202\321\330\342\013F\374\202\331\242\rGHI\240\342\234\212\n"
+	.string	"^\250\3011A\024H)PA\n\303\030@\002\244P\331m\020Hl4J\033I\"\030T.\244\245\236\261\2608=\205k\n"
+	.ascii	"o[t`/\355*ob 1W\"4\tk\0025\333U\206Pb \341\253\305*\303l2\354"
+	.ascii	"\252K\240\212g-m>\013\023\033\226l\2226\222G\230=\223\004\271"
+	.ascii	"\013\004w'rlz\366\236\317\016\240\220Z0\205\314\006\026\242\250"
+	.ascii	"\361\037\356^\020D\036Q\036\202\211\270\204\366\211{Y\037\220"
+	.ascii	"\177\274\013%^\303\001\216=Vk@|ia=\033W\367\272\306\225.\027"
+	.ascii	"\335jS\260\356jDW\242\324S\337\305\177\201u\342\222]0\307{c\360"
+	.ascii	"y\375n\f"
+	.text
+	.section	.gnu.lto_.ipa_sra.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\n\001m\006"
+	.string	"\362\305\022\037\240'\351\377\377\377\377\377\377\377\217c\377G\374\377\021\277s\373\216\235G\253\340\031\347\007\223;\245N\310>\246c6&\343\205\302\332\211\211(\347\341u\032\n\352\204\035,8"
+	.string	"\210\026\332'9\3736\026\243\245\277\350+:\023M\036\t? \220\002\242\273y_@\304"
+	.string	"\0365\312f\241\206\247\305\340\325\321\270\305\".\b\001\310\302X\002~\254\240p\025\024\225\033l\023\b\021x\002\005H\355\206\034\006\204\330\214\021\256@6E\226\\\037\244\255.*NL"
+	.ascii	"o\276\245e\032p\332\202PA\333\325\206A6\356\004\232\300{\021"
+	.ascii	"\305\001\306\\\037\261\265\234j\204\351i\3150\214(\334a\0044"
+	.ascii	"\r| \323\203\206\303\306\3550i\004w\024n\b"
+	.text
+	.section	.gnu.lto_.inline.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`q\b\355\027"
+	.string	"\006\031aH\340t\225\016\261*\006\272\003\233\250a9\f\013'mN(l4\354\230\013\202\036\353\031\260\2449\261\020\372\240\225m\025<\202\261hv\364\t"
+	.string	"\3009\006"
+	.string	"!\323\202\203\001\r&\300\302\312\327i\007\226\342\233\035\261dK\231\002L"
+	.string	"J"
+	.string	"S"
+	.string	"\016N`D?\242,d\311\271R\340\005\221Z\020\003\017\360\331\027\315eW\032\002\263C\205\370\017"
+	.ascii	".\253\315\304Y\013\361\277,n\202;k\342=\273\377A\225\317$ww\207"
+	.ascii	"\277Ys\310\274\304P\361\277\253\332\322;\201E\370E\367\224\001"
+	.ascii	">X x\203\262\3033r\275\223\316I \230\311\n\236\301\277\277\356"
+	.ascii	"&\361_[\354\353n\005\037\211\376%\321\335\256\337\254\262\356"
+	.ascii	"\346<\301\376[\"\374Y\fK\201\004eW\204\25013\264te\017\325\240"
+	.ascii	"\2451\b\225\307\n\n\034\0017Z\244l\207P\344\021\347W\021\225"
+	.ascii	"\345\306\304\006\343NaU\323#\271\236\207\"\272\232$\250O\370"
+	.ascii	"\264\213\232\023\274\0053#4\272\321%\320\350n\016f\205\351n\323"
+	.ascii	"O!\224n\327\200\233v?\242\353\202\221S\361\235\\\322\337\254"
+	.ascii	"\364\007J~\273\030\022\333`\001'\353U\033Jn\r\031R\0028m\363"
+	.ascii	"\343\246\222\342\375\266\370\306\307\302\273\216c0QKV\031\267"
+	.ascii	"\026\036h\306\006\310\315\201_\260\360\224\n\037\317sDw\301\203"
+	.ascii	"\340\301\017\274\223y\211\201\357\234\344W\370\267\030\247Ki"
+	.ascii	"\270\007\370_\344\r\200\253\250\001*\022\241)IA\n\ni\rp\242\031"
+	.ascii	"\"\263\016\022\200\001\241\n\006)\n\245\024r\210\031\021\231"
+	.ascii	"QPR\206\252\rV'\302f\021\213a\177\365\346e\207HIu\f\305\346\035"
+	.ascii	"\024l\004\021\360\340\022\356\022\230;\2176\363\201]\325n\354"
+	.ascii	"\021\207\r\201+K\026\274\347\035Q(\021\271\245\275\305LK$c\336"
+	.ascii	"\\\214%\262\213\204\240\264\323\273O\372\340\321\246\246\263"
+	.ascii	"f\237X\342\342k\020\262\b\240r\205\017\354iO8FP\252R\214\221"
+	.ascii	"\321[\225D\325\234S\301\355\205\224^4\337\217\356@\212V\362["
+	.ascii	"\034\0045\232\345p\216IL\027\301\303\254\347\366\310\203\216"
+	.ascii	"\220\330\027\331\021\377'\326\322\r\250\366\bf\"\346y\363\233"
+	.ascii	"sn\353\306z\351\206;\342_ \375\016_c\006\251\267E\353\322\371"
+	.ascii	"\367\033(9\314&7\244+D\302\021\261\300\265A\345\257[\215W/\335"
+	.ascii	"3r\027\222zaJ\266V\206z\247_\242`\245\222\300mm\325n\244\245"
+	.ascii	"B\366\007\2347\200\032\344\017\245x\324R(\340\354\375\342n\312"
+	.ascii	"\202\277\234v?\017\250he\376\212kQ|(\310\376Q1 \211\251\330\027"
+	.ascii	"\374\016\364\2668\266K\255\207p\205\201\r.\222'\nL\263\036\255"
+	.ascii	"\376\277\367\371\323\336\314\263\273+\353\327\232\312\2422u "
+	.ascii	"M\261\3668I\276\227\363~\343Q\275\307\370Z\376\005\3660b\005"
+	.ascii	"\004y"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`g\007M\025"
+	.string	"&\327J<@k\224\016\303pN\332\033\314\fk\207\372\312ql\260\203\206a\030\266\254\002\327UE\321]u\321\326\237\244\235\251\\@\021\257\013\204\217@,\375\230M\353Cd[\373o*\271mJ)3"
+	.string	"<"
+	.string	"="
+	.ascii	"\231\316\322\233!t\3101\332\223\377C[\277\266\016-\325u]\347"
+	.ascii	"j\257\325\376j\335\267)m-G\336\363\347\367\007\322\372q\024?"
+	.ascii	"\316\2458\313\277\355Ux \230\2541y\017xK\321N\264\225h#\246\311"
+	.ascii	"\030F\"\2710\bGpC\321bq\226\032Mt'f2\357\301{v\340\377\272\234"
+	.ascii	"e\203*V\221\201\177\b\027\370/W\316\n\\U\366d\240\021\310\027"
+	.ascii	"\374G\221(\222?y-A\376\335\202\266eY\301\332\226\377\021\330"
+	.ascii	"\235\254(T\225\250\223\023.\334\332\234\374\255k\017{C\344\337"
+	.ascii	"\020\254Q\b\237\321Zt21\226\025\305\260\306\001m\r\264X[\240"
+	.ascii	"\345\264\004*\0334X\251\b\250\025\340\267\001\264\035m9j\307"
+	.ascii	"\030c\314.\027c\271\331T\203\177\212\202\260\344\f\376\247)\022"
+	.ascii	"1\006\2018+\275\207\301\337\036\017\t\036\005\200\317\250A"
+	.string	"Y\247j\222\024\n\303\030\260\002\021\252\251u\022\300\221z\032\223\n\031f\312\244M\262\307~\007\201j)\354M\246\202\274\007ld\3439\3542N\230\0256\035\036\237\327P\020\263\336\202:\331)(\302\301\356\036V\"\361\272\240\"\322\305\221\347c\256\305\022\306\304X\351\324\366|Z\374\230\224\032KC\244$\233L\177\301$\"\360_Z\004\"\242\273\214\037&W\004\026!A$+\360\331\255D\317\226tD|X\352\2241\240zt\034D/h$E\323m\3138Y\257\256x\331\025\234\244\210\365\376B)\340 YNE\312\031y\027\275\271>\004\315\351\023!!$\306\244\345\276\277\206a\260w\205\t\242\237\313\255,\215\204\305i\3341\215\202\300\254p\032\210A\001\362C\207e3<\001\215\366\334\221\352\214\f\252D\013\002\331\314\256\235\360\305\360?\221\311\304\b\341\304\r\363\250\005m\312P\201J(\200\365\003l7\004"
+	.string	"<a4\342nr\225\255^\033\f\220\031\234\237X\b\260Q\305\243\202\002\253\303\311\360\362\227%(\353\351~>\002g4\320f'\250m\375\033U\376_\203\340\020\035\003\246\206$?\233~\r\003@\314\234D0\230\261\026f"
+	.ascii	"F\003\374\364\304\306E\322\344\221\"z\"\274\013\262.\2175Z\217"
+	.ascii	"\315\237;n\263=\323Y\237\024\376\007\270Z\257\320\030\220\022"
+	.ascii	"{\222\304\027O\225\001"
+	.text
+	.section	.gnu.lto_.pureconst.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375 Y]\002"
+	.string	"\222\305\021\033\200I\215\001'\fe\006\346\022\200\bd\016`f\330\024:\265\242U04\322\031\310>\032\316\360\026\236\302K8\302\017n\360\nNp\r\\\340\001\027\300'\227<r\310\037w\\y\343\214kq\305\023G\334\224\2319\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"E\006"
+	.ascii	"rH\030 \220+\303\001\377\377\377\377\377\377\237\374\003\377"
+	.ascii	"\207\037\032\256m\204\220 \n\2616]\335\020\237\310\224\002j4"
+	.ascii	"\343\207\215\271X\315\261\354\nE\235(\2018\021\275\212\346\217"
+	.ascii	"\255\203r\222\324\247\261\023\"\324\245\026\326v\215\240\214"
+	.ascii	"=\360\305\234\232O[i\036m\025\003\250[\240\006\240-4\177\266"
+	.ascii	"\317\246\033|\023- \200\202)\252\353\037\231\363n\200\2341\300"
+	.ascii	"\262\261\216U4<cD\316 \226\033_\370\272\311x\013\212\221w\036"
+	.ascii	"\301\n\371\340\271\247,\301:\211l\\\224\311q\230`\271\003\333"
+	.ascii	"\202\316\336\247\004\004B\236\363\020a\204\201\201)!\016rU\340"
+	.ascii	"\231n\364Pe\006\034\3118\030Cyp\n\257\271\n\"\220 \n>\004"
+	.text
+	.section	.gnu.lto_.lto.7e6f104a56ecd542,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_throttleCorrectionConfig_Registry.128.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375 \217%\004"
+	.string	"d\007`"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	"\005\001\212\001\206\200\200\374\342\303\347\202\031\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\337\030us\355\007uq"
+	.string	"\005\001\006'\001\004'?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/fc/core.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_throttleCorrectionConfig.130.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\240\006?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_isCalibrating.131.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\246\001-\017"
+	.string	"\366\232aE\020\221\223\016Q\267\322\362\001$\313\317\027\222m\256ba1\242K\221(\317\372\221\020\001\213\214\374\365\307\370\203l#\271\005\377\275\030X\264G\362\0020F\n\252"
+	.string	"\030?\347\205X\204\301Wm\307F\366&[\312\224\002O"
+	.string	"K"
+	.string	"N"
+	.string	"\034L\306\013\256n>w\216\37448\261jB\250\264\034\273\210\345\262D\211\305\323x\342\351\325\371NL\024B\002 fV:_\007Al\210\330\361\033\245\026]"
+	.ascii	"_\007\005\3149\377rE\371F\252\3623\347\264\222>\225\373\343\266"
+	.ascii	"]l\017\260\017#\336\300AO\372\376\345\030\016\031\245\033U\267"
+	.ascii	"\234\235\342tO\366\341\\\265G\325\230\325\322\352h\365e5T?\200"
+	.ascii	"\003\225M\315\201\326\234)\255\036\263\306\365\202\204\355\022"
+	.ascii	"\273c\004\tJ\274=\205J\221&3\274\0256s\246\262\035\361\355\001"
+	.ascii	"(F\342\376\004\324\230\231\025\230x\255\006\275\226\201\251["
+	.ascii	"\356\217\001\223\002u\301]\360\201\307\004\022=\t\256\004\032"
+	.ascii	"\246\033\325h9/j\245r\001\037s\335\2578jk$z\222\356=\230F\313"
+	.ascii	"]\347\234\334z\213_\b*h:]9*|\206\350\006\205\210\2044P\006\212"
+	.ascii	"\220U\030y@!\003\205.d! \326,\210\2042\f\232\026\312:\251\371"
+	.ascii	"u\261\347\304\362d0\217\202\0344,d\366\337\242\264\\\177D;\342"
+	.ascii	"\354\311\032\013\\\245\201c\213bc\353\331{,\221\2660lO\327\016"
+	.ascii	"-t\230\220q5( \220\202)\271\362\t\005<s\274\220\302\233\013\034"
+	.ascii	"\232lWb\r\341`\330\304^\2140\333\275-\365=\221\233y\371m\261"
+	.ascii	"o\255\266k[\314\306t\002\003v\206\020\216P\274\211\017\n\221"
+	.ascii	" \243\355\327\222d\204\274\275\005\265\2167\216\273\241\253\215"
+	.ascii	"Q\223\247\225o\235c\266\001\324\265M\240e"
+	.text
+	.section	.gnu.lto_resetArmingDisabled.132.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375 \341\025\006"
+	.string	"2K*3`k\323\001\320\272\033\035\235\203\332*\032\205T\267 \265\211\t\003h\026kA\032\017\216\353Z\275\321\344\026\300\001\026"
+	.string	"88+\0349,\205\f\372\311\337;\245\236\221T\351\2243#\0014\230\215\234U@F\022\323"
+	.string	"\251\312\001J\253\204\266}\314.\025^\025\013L\271\357\360\007w\276\202\t\314\301[w|s\217;\317E\307\220Q\301\317\336(\030\021\354;vw\0353;F(,*\022\273\327\267\261\2363\261`\373\220'\033\343\233\266\217\320\f 4vW\306\204O\207\223\377\206C,\214:|,\273kha\007w\374\304\366\025\b"
+	.ascii	"3\001\0038\343(\276\205.\203\274\f\001.\335\230\255\355:-"
+	.text
+	.section	.gnu.lto_updateArmingStatus.133.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"E\t"
+	.string	"vQ@:@\305(\035`\255\326\377B]\023$\306\037R\037"
+	.string	"\250J\212\001\361\242\250\360\370\234\371\362S\312o\252\343\206N\021"
+	.string	"\206\205\034\206\231\007\305N:C\237$gG\266O6\2212\245/"
+	.string	"/"
+	.string	"/"
+	.string	"\377\374\322\374\370O}\300\373@\277.\026\327+C\352\360\b\276\3562X\225\004x\352I\361\2112-\b\273\353\364\276\212;\336v\202\355\002\333)\001`\227\232a_\3030,`5\331O\307\247\217\035\005\262"
+	.string	"\034\b\330%\205\004\366$\232x\330>\306\037{\345\340i?\3021\022a\355n\246\032\001?\265V$j\r\026\365\251_PBTD\331\362\257\301\256Q\235\243Rw\325A$\374\rOx\362\336\243\357\301\036\257\233\213\017\fU)\224\241\035\3266\034n\3232m!s`Ph\3104\256\223m2\336\0368\\\006\261m\\\206\001C\277VM\216(p\300*\244\335\265\273{Y\322\356D\344=\253\202\002\016"
+	.ascii	"3\241\335/FV\301\301\025@\265\017RX\304\205\017\341jTxv\031\345"
+	.ascii	"e\bq\351\242j\207\006\246\240"
+	.text
+	.section	.gnu.lto_disarm.134.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`8\002\375\021"
+	.string	"\306 tG\340\322&\035R\0320s\222HTB\220\331[\026k\266\230\251\006\003\240O\364\361\301\202\"\271\322\021D\312\032k\236\021,\"`78\321\3124\013\034\216K\031\3465T"
+	.string	"Q\230\353\237\006\210a\234\326\020B\366\336R\246\024`"
+	.string	"V"
+	.string	"b"
+	.ascii	"%\313\330:.\303\231\367\211\261V\030\3159\273-q\231o\232\214"
+	.ascii	"pU\306\377\316\271\257\225\372v\225\353\032Ke\210GXbc\306\032"
+	.ascii	"p3\342\250\324\342\2400\244\325\001\226\3149K\255\031]h\200("
+	.ascii	"F\321\205>\270\340\b\215\316\367\235\253\207\326JU[0\347\264"
+	.ascii	"~\255\232\233\273\355\032\333\004l\215\t$Rd\277\363M\250\007"
+	.ascii	"\307\214\"\371'\221_\221\265\262\\\253\303\036\203\361s\254!"
+	.ascii	"F\377=\3721\362\361{\242C\302\006\346Ri\222-[\351\276\354\303"
+	.ascii	"\2717\366\325\"\252\346V\275]\255]-U\035\257\206W\037\300ydF"
+	.ascii	"<V\222\346\244I\3721gQ\206\t\333\017/\353Y\244\266\252b\345@"
+	.ascii	"?\332&\030\212\251\034\004C\201\003Y\244\\\317\226p\037\226m"
+	.ascii	"\316\231\003\276\213\277h\361s\036m:\235\344\243\\\005:9l`\261"
+	.ascii	"\270>\213\267\240\340\362\362\"\037\227\006\2476\n\203\376\213"
+	.ascii	"+@\004\210\331jS\206\333\363\257\307\203\034F~\341F\270\001\304"
+	.ascii	"r\255\216\203D\004c\0356\235\234<\224\2513M\350,\270\264T\350"
+	.ascii	"L\036Lw2b\324\205\223\327e@\241\274\256$S\035\316\275Q9\232\251"
+	.ascii	"v\2651\330M!\230\3558\241\231Hn\275\236\241\222\233\310m\271"
+	.ascii	"\205@\002\250\335\300\201\376\333v\003\317<\":\212\364g<\b\345"
+	.ascii	"AJ\212|\344^EF>TrDm\025\b\372\317!5R\024x\375\244\342\006. \200"
+	.ascii	"\002\031\251;\017cB\007J\340\273[\356\355[\261\302\316E\323\336"
+	.ascii	"S\335\264H\340f!\274\223\226\305\264g\b\276.\350W\272\002\205"
+	.ascii	"\023xd\334.\022Yp%\026\255\253m\f\244\244D\213\3316q\206!s\031"
+	.ascii	"\210\017\036T\333JB\f&\240\314\\\215\330\347\207k\340\003\034"
+	.ascii	"\017&J\242\243Iv\354I\235\2225\226\231\364\265o\017"
+	.text
+	.section	.gnu.lto_tryArm.135.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\367\003\275\032"
+	.string	"\266\257\247I\260XQ:\360%N\310a\002l\320<\3670\036z\243i\007\354~\263+\324\241\373N\035\037\313\263\315\245\003\373\257\247\254|n\226\272\307i)\037*((O\bpO\370\024l\005\225U\003C\236\037\b\374&qo\"e\222\001\224"
+	.string	"\207"
+	.string	"\225"
+	.ascii	"Gz\322\212\377V@\220\241\336\257\326J~\356\256\330%?Erg\273V"
+	.ascii	"\016\034\252?\022\346\266\324\245\326\352j\241\317"
+	.string	".C\252Rc\f\235b\363l\257\322\371\\\346&\007\020\357\2440\3073\312\325`U\360F\230\243\301\251\323x\037\305\002A7\242.\314\355\304\026\224\362v!\2771\312\3618\306(7\343\205\356\306T\306'\215\216\305\225Z\260\030\343-&\200j\332B\243\263\211\254\037\"\334\217\316.t5\346\030\234Z\3532N\007\364\235\371\356\226\273\373`\267\227\004GH\214\265\332\032\354\213\334\310\316\236\307\347\306N\360q'\350'\367\217\316=~\340\350!%\321x\270\013\254q\373v\337\303\341p\270\035\264Kyk\232\227u\246\357\252yg(\257\212\362\246&\357(\362\322\346\235\"o7/7\357\007@\200\352\361v\f{\n\260\376\f\277\324r*\351q\246?\270\344\236\310\227fg\332\247\226\rXu\031\302\224?\005\237k`\374l\235E?\305\003\240\377\035x%\025\377\355\374Q\244b7P\366\351\302:\255\023\375|\322\017"
+	.string	"=A\365~Zh<L-\206\016?:NM\210\211\224\340\330>%\377\230\245\351\263\337d\366\205\034\201\216`\324\216\306Cn\302\342\247(&\005\355\032\336\325\260\201\217\353\221JS\031\005Uk\037\032\200\367J\034:\364\264\2413\243\360\267\241\254\236\351\345\333\256v$O\342a\317c?\274^\364\223\325W:\023\331\370\365\220v\"\r/\370.l\004\037\2672O`\224\266\366\371\220\027\250$\335\276%A\271A\f\251bc/\273\253\363<\261\236\027,C\bX\t\020\257\036\235\t#xtvd\257"
+	.string	"\233\303"
+	.string	"&\213\345\270rD\270xt^;\256\034Y\217\213\001kc&`2\027\212XL\346\"\201\264\343\320\272&\326Z\253\214\001\256\351\335\031\220\331\021\037\2671\242`)W]\323\313\270,\253\026\222B\\\200\020\300\001\f\"\333\267jU?G9CZ'U\223B[\242v-N\365n\004\t\364\270U\267\306N\365\\\272\205\261\341]\n\025\370\270\261\037\374\211n8)\035\224W|\250\332\367t\3322\0134\nL\221\202\357\237<U\250Q,E\231R\214\214H0\022TA\222\341\220\002\021\2713\017\020P\347f[h\fbH\r\235-m\265\274\231e`\317\375\366\373.\r7W*H\247\275\241\331\275F\223\201\231\207\341\211\307\307\037\021\034\347\006\303\371\231\246\356\033\366!\272!\332\324\b\207\211"
+	.ascii	"O\217\341FOh$\204z\201\016\214\276\2301u\320\235V\250k\354\227"
+	.ascii	"\264\377,\267\207\373\233\237a\307q|QCe\365\345k\356\317m\363"
+	.ascii	"/\277K\220\275\246`\363\247\005\207\245Ox@\274\242\021\024\371"
+	.ascii	"\263\313\340\277o\275y1>i C\221\006\207\001\300\204\354\035\034"
+	.ascii	"\363\nn\023N;*o\212\205j"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.141.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`M\001\325\f"
+	.string	"&\225M? O\225\016\300\343\235\034\022G\226\240\256\261)\001\217\211\377\002\277\225r>\344\244\340\237\345\027A\275\0015\302\216M\231\031%\352\343\037k"
+	.string	"`\240\002\003"
+	.string	"\013D\200\022\270\003\325O\b\331R\246\0248"
+	.string	":"
+	.string	"@"
+	.string	"\273\232f8\347\330eAM\216\217M"
+	.ascii	"|\321;v\031\"\272\025!\213\020\022\006\210\242\253\200\370\201"
+	.ascii	"\005v\367\037\236\023\242'\023\233\354\256\363\213\026n\310m"
+	.ascii	"cl\033\260\337!\327\\\267\256\032U&\322i\324\311\017\033\345"
+	.ascii	"\245\226\354\303U\f\366\323\360\351|\372\031\345D\250B\274\204"
+	.ascii	"\216\335\320\307\213]Y&8\330~f\216\275\342(\rK\300\003\005P\b"
+	.ascii	"\217\r)U\007\324\021P\305\327\"\025\352A\027D4H\026\244\323\b"
+	.ascii	"j\351\233+\303A\226Rm\220L\034\007\361\3241F$<8rw=\365\346\272"
+	.ascii	"R2R|\322\205\375\32316\376\006?\320\344\277[\016\336$\225\216"
+	.ascii	"\333\264\r\201\206\261\034\270h[\227\321$\003\314)\250t\032\003"
+	.ascii	"\216\353\264\f\265\327@\261\352\250\007b\221\214\334r\331\t."
+	.ascii	"\337\320(\261\372\354\005I{A&\377Y\325\273\245%\250\032- \220"
+	.ascii	"\202\241\271\365b@0\334UX\240(\3574\226\322\275\260\n\360\210"
+	.ascii	"E\221\357\330\211\346\334lam\2211X\300\016p\266fP\006\332\325"
+	.ascii	"\030-\024\022,\002uc2\3468/\023\236=\036Cp9\274HU\030W\334\017"
+	.ascii	"\320\016\377\335\360\357q\007\362K\036\225\250\353W_\222\235"
+	.ascii	"\355\r\220\267]F\017"
+	.text
+	.section	.gnu.lto_updateInflightCalibrationState.142.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`f\004=\031"
+	.string	"f*\226J\260\022R:\342\264\264\315\310\274\263\232\373\246?\312\311\371\340?\224\266\365\315\b\3415\027\321\341C'\251\375\307\316\277\355\037\361\007\234\266\364\023\276o\267\250}\251wq\330{\224\277\264\363\347\220K\376\272\310\325>k?\331\204H\231d\207"
+	.string	"p"
+	.string	"\201"
+	.string	"\225fK\253\336 \243R\354\356\315\225\331\255\0220Sq\bT\234\3401]\325Zim\3422\007\231\311b&\354\345*)96\313\354_=\037\356 \263\037\313zHp\254D!\361\261\351\271I\342c\263s\230\016\277\206jvr\330\225\243\206\207d\250\346\344\022\347\224\007\202\311\261\304\n\252\207\b\r\212\236\351\233\341\321\364\355\270g>\336H\240\326\372\242s\b\237\216\271D\251\265.\367|6_"
+	.string	"\337\275\310\356\032\330\035\013\004\375\242\303V\374#\224;\244\227y\247\356Kw\221\341\305f\243'\271O\210\347Z+\2567\206\276Y\202T;\316\332\375\321\221b\366A\313\001\206\337;\271\207\241'\337\355c2\372\035\2359\336\332U\322q\003w?\326\376\331e\336\020\346\225\2357v^\363\274\260\363\276\316\353\032yK\222\2272/9\362\216\315\333\314\313\347\375\200\332\b\032\021\276\367|\324\273\306\225\r\244q\235Sxu\340)t?\343P)\017TT\350I\017\247\220\250H\033\270O\272\253gUA\252"
+	.ascii	"\274\207@w#H\340\367\\]&\225\3305\256K~\302\033\262\201[\366"
+	.ascii	"\3301\237\340p\307YK\273\234\360'\n\256Zw'\373\030\227Q\301\302"
+	.ascii	"\312\n=I\373S@H\335c\237\367#\267kr\0305W\2555\301\276\351N-"
+	.ascii	"\373\240\223\213\301\305\205\236\354\376\0231*\307[\374q\204"
+	.ascii	"\206\004[3i\271\331j\264\332\005\232\006\227\225\027Z\355\006"
+	.ascii	"C3\021Y\333\206\226\033\255\203\315v\243\231J\271\367\017\203"
+	.ascii	"\034!,\253\\\353@\032(u\036\013\226\232~~F\305\034o\355@:\247"
+	.ascii	"\210f\r|q\322l\021$\006/kR\207\254\357D\224\305\372\003\216X"
+	.ascii	"\2238&\255\337\321\031{\f\035\236\347\224\"*\232\r\214\272\360"
+	.ascii	"7\347\360\252\270J\265V\230\331\\e\243\201\3314\240\027\254o"
+	.ascii	"5\034\300Z\3019d\261\256W\263\310^\035k\302\021\302\262\nf\250"
+	.ascii	"q<d\221r\202*)H\212R\351\240\002\03113\017\020Xd4b\230\326C\271"
+	.ascii	"\t\223\322\273\236\317I\tC\304#\322\363\016t\310\220\b\0319\305"
+	.ascii	"\274\2372\204EPiE!\310\200z\323\330\362\022\035\301\240\220\205"
+	.ascii	"\272J\302h{\230\206g\274\373\207ji-\256\245SH\300\203\031&\217"
+	.ascii	"\354i\217\323\223Hb\364k\025\265\252\016\257\202/\350\326\373"
+	.ascii	",\251\332E\021\271\343\261\242\331j+\257\002i\202\272\345\370"
+	.ascii	"|\373~t$\321ZF\016\312\262g\227\202\255\216\031)\226!\374\013"
+	.ascii	"\n\347S\360A4\230\332\364)\364\356]Z\270>\275\360\316\253\353"
+	.ascii	"\230\351\307xs S;\036\245l\261{d@\326oG\037(q\001<+Zq3\375\017"
+	.text
+	.section	.gnu.lto_updateMagHold.143.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\364\005\305#"
+	.string	"J@\260\rH\220VN:\305x\340\257\344cXX\370\363\344\017Xod,\031\026_\303\301\340\352\003\177\322#VN\025\313w\232\025\353X\003\371\302 \220\306\026% \301\222\226F\224\026\242\334qa\246\373\377\377\233Y#vo\"e\222\001\275"
+	.string	"\272"
+	.string	"\314"
+	.ascii	"\274\277\311\353k\336\336\344\345M\336\222\344\335M^J\362N\222"
+	.ascii	"\227l\336f^f\336\013\370\215\241\300:\212\272ZU\324\201\251k"
+	.ascii	"3I\215\227}\367=\366\307\365\355}\234L\370\262\250\327\252z)"
+	.ascii	"\256\033M\344j\255\003>\267\250\374\244y\016\375\344\337\320"
+	.ascii	"\317\373V\270\013\367\243W\345\271a\244(\244K\2555\3304.|\314"
+	.ascii	"\317\327\343\225;:\311f\341~\247\304\253\302\222z\314N\351\027"
+	.ascii	"\343\276\030Z\334\313:\357E\200\260\025Y\\\006\220\301\302\370"
+	.ascii	"\235\361Xd\352\342S\006\213x<\301\244\017\213\212{\312\n\030"
+	.ascii	"$\200Z\353\307\316VXS\314;\245Z\353r\025\026\213\257\314w\027"
+	.ascii	"nw\221v\247\222\265\026@\273\021\f\0314h\240\237d\377\370i\303"
+	.ascii	"\210\305\013\331\311#\321^\177\354\275037\362H\264\273\327\313"
+	.ascii	"E\343\324\211\274\310\206=\330.11\321\317n\004_\306!\327\235"
+	.ascii	"k\255R\335]\233v\271-\251j\035\022qs0S\243\342/\373\346>\032"
+	.ascii	"\261\313\220\353\016\344B6\255\254\265\036\330\233=\310\207="
+	.ascii	"\330\3476\201\340W}\356A,\223\026a\304\"\226d\310u\273\307)\356"
+	.ascii	"\256\335\223\265\271v\217v\274FEDC%\257P\320\313\276@\222\027"
+	.ascii	"\210\344\375a^\037\346\355)yyJ\336\235\222Wg\307\233\303\343"
+	.ascii	"\305)yov\2746\223\267f\362\322L\336\031\312+3ycf}bXP\323\b\365"
+	.ascii	"L\357f\\q!{\335\305\274\346\332\037\377\026gZQvE\275$\005vP["
+	.ascii	"\355\b*\323\227a\346\266\r\256\346\240\254\225\252\300\336\311"
+	.ascii	"\237<\200\020!\002\375\224\351g\031\343\304\310\206\\W\306tQ"
+	.ascii	"\2071\276\004\375uL\237\270\005\354_\367\325[\221n\270\353\256"
+	.ascii	"\245Z:&Q\343\234im\221C\rl\253\343x\024\005j1\213B\305_N\327"
+	.ascii	"\327D\334\366\022\224\327\276\356\315\270\222B\334\232\332c\255"
+	.ascii	"u\232@{\024\035\352\376q\366f\246\306\353\241f\264\"]\331\264"
+	.ascii	"y}\242\215]\227J\276$J\302\004~\325\004\372\271k\236q6\355\027"
+	.ascii	"\351z\357\241d\317\246lD\036S\024~$\212\200\327\256\205\247]"
+	.ascii	"(j\253\001\036\232:\364.%1A=-\005\227<\004C4mp\n.A\215\b&\345"
+	.ascii	"\354\223\b&\250 \211\247'\250\240\3578<Y\233kK*M\326\206=\025"
+	.ascii	"\003\324[\216\344?\r\324\214\246%\352h\356BP\226\237i4n\361\322"
+	.ascii	"?\237\216\333\264\035/\270W\315\365\364\333\207\247{\272\331"
+	.ascii	"\210rA;\315\323<a\210<t\372\246w\232\204\222\323:}\034\177S\360"
+	.ascii	"3+w\023\346H\320\366\271+\334\361+B\261\262\255\202p\314\200"
+	.ascii	"W\255\365`N_&\3643\247\177\366E6\254r6'\241\017a\231\260\214"
+	.ascii	"~\342\264\201/\343Q\337\264\r\225\024C\212t\276\356Z\346%\035"
+	.ascii	"\207\250\005W\022\270"
+	.string	"\020\220\032\225s\345\201\324\246\215\244|M\301\002\006\f\350\247MC\031\343\274\030k\372\210\246g\272&\200\201\250a$%\225R\206\231\031\251\240\005\005\205V\003\200\002\241\0213z\020pF\303IcC\324\003\007\364?e\022\36065\356(\003 $\017\275fmim!\334t~d\013w@\323\355\372\217\256\335\370\221$)m\035\226\034\324l@k\3437Zr~*v\231\013\226\264\033a\352\221\352\355\320\023\225]\035\255%\314\032\261CmdA\213J\240\304\030)\n-\242\205_h\371m\3545\007\214:_F\317tnf\252\323!L\326\2636\300\250x\331\355\244J\263$\302\237Ig\253\347\355\355\031\212Y\231F1nz\216\210\277\355\332\304\246\214<\254\253\f\216F\373\206\0311E\026\274i?\332\325X\372B\205-\374\261\310\267E\266\327(C\262n#\rD\016F\033 1\332\2078\003b\006\027\236\262"
+	.ascii	"^\r\274\221\364\0079\244:,\033\237\037r\367?\027\330\013\304"
+	.ascii	"\354W\226\353'\371\374\310\336\367Lm\201\031E\215\336\250\001"
+	.text
+	.section	.gnu.lto_calculateThrottlePercent.144.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\003\006e$"
+	.string	":Ct\016F\220\234M:\204\212\255\241;\276\031\030\265F\306\316[1\360\002Y\257\320\227\311"
+	.string	":d\007\\N\354#~K\351\034\220 \267\306\252 \210 \202L*\251\336\277+\003\006Qk\204\004_H\020\273\273=\032\241\335\322\226)\324"
+	.string	"\276"
+	.string	"\331"
+	.ascii	"\266\332t\017\235\256\325\246Irz\034\247i\343\364\351\364\244"
+	.ascii	"M\357\001\\Q\306\326r\265\251\225F\361N\025C\313\204l\222\365"
+	.ascii	"\216\255\320\276y\305\212\231\001\220Hg\205}[\272\266\013o\230"
+	.ascii	"o\233\244\305\326\262\252\2103d\212\233Z\205NK\315T[j\004\t\\"
+	.ascii	"\270\212\b\306\2137\274!Q\260"
+	.string	"\230\320\251\265\366\356c\253V\227\303\335l=5r\244\264\317*/\331@\302oG\230\254\255\027\253\313\341\3201q\\\363\266V\301\265\321\232\334X\221\263fZ8h;\032A\2626l\225\300\264r\314\036\245Z\360\306$\311\006<j\004w\304*'5\273m\301\23040\335\326\325\274\231\026\220\306\253\265n\330\316\030[\2779\311\006\265V\317\254\255\032k\237\265\227\332~`\323\257\034\346f\321\276g\316\210\354\367\304\370{\030\246\271\232v\3743yu;\214v\224\324\334\254\177\303\026\310\311\331\0201W\177a\362\214\320\207>\312\361\251\262\3162\316\013\335\263\214\363\233E\357\347'\036\254<6\324.\001Q\253\265.\360*\331\241\b/\220\245&157k\251wj\\\272\337 \360\254N\231\325,\332\302\337\274\227\275/\026\213E\277\207\355i\003\275'\247\246M\262f\"\247\227\306i\002\343\264\022\235\346\321\351\001tZ"
+	.string	"\235N\242\323H\265\351#:mD\247\213\3504\021\235\016@\247\207\350\364\216N\013\321i"
+	.string	"t:\210N\003\321\351\037:\355C\247ut:G\247qt\372F\247\003HUc\373\305\313\321W\013\220XGl\254X,\366\030\275\251\350D7:\022\261<\242\342\306\356E\177\372R\006\253\270\002\234\350\363K\t\366\233\305"
+	.ascii	"\037\361\0136\371\251\265\326v\337 C0\273\037u\351(\222@w\372"
+	.ascii	"\224\362s\335\201\216\264\246<\342\363\237\027\220\262L\326\347"
+	.ascii	"Ier\327\375\210X\202\331\216{\356\343\232\362\253\366\241\343"
+	.ascii	"\036\324\245cN\371\365\033\357\345\241\337\356\033z\261\275\366"
+	.ascii	"\333)\261\f\366\334\346`"
+	.string	"\267D\320\322\363]\362C\214|\355\013a\261D(\333+\022&P\2400.%\277\\@6\026\326Z\351\275la\034\377a\210\306\256\260T,\324j\275R\340\225\262S.`\310\220a\\:\236\005pM\0351\253Y\254\265V\332\275\236,\355\037\204\346n5\214\366\206\016\001u\"\004\212\016S\275\022TSSTQF(\244|w\024\224\224\217*\252\027\365\241WBD\207\251^\224\357D\017jg*\023R\276\036\n**_\357&\264ZZ}\017\217ce\256\367\021\211\231\321\351Bda3jM\037\303\212\330\236\256#3\302\206\364\266\030\231\036\303\266\201\363\254\3763\323\r\234\374\355\b\203\225\207V\237\336\273\255kG\223\022\016\223\0357Vr\367\252\262KO1Lcfa\314\322W\0138\307\210\237\020\307t\341\b<\305BY\002\237\302\263.6\324(!\273\335k\237\003\006\215 6\245\373\326\311*\035\004\027"
+	.string	"\177:\2208$\323\304i\203\016\340\236\245\034\336\203\276\302]*;\203\202E\026g\300\005\234\367\305S\036A\032\360\"b\371\265\\6\351\002N\342A\372\320\223N\303S~\035=r\250a$\344\020s\312\214I \"\222$i\306\260\002\2211\"z\020`dT\2335\357\231y\3551p\261\002\242\346\230\254\201%\204\245\016\030\237\252\332\273cv\007\322\375`X\346\217>\231\035\257\345\345\021KOJ\376\"\261W\230\326\216\254\013\376\217\344\003!'\005\20470\251\"W\362sf\251\261c\201\004\226\372\201\205%\336\261\307K$x#u\034\340U\223"
+	.string	"\342\222\021\003\bm\t\303\177\202!\3761M\314Ko4\035\210\236\003\264\020\332F\210\301\r\357\350\345qR\243\315\203\300#\363A'*\240a\340\226\241g }"
+	.ascii	"zq\364%n\376\254\2135LC\005Un\337g~\215\320\253m\365\f^pU\363"
+	.ascii	"\207\b4\274\237M\244\214\n7>X;\303k+\r\212\342\236X(\321\210"
+	.ascii	"\363*\006\303\210}\355\205\033\265Q\372Qt*"
+	.text
+	.section	.gnu.lto_calculateThrottlePercentAbs.145.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\245\007"
+	.string	"\202\21656PU\322\001#]\002PW\255\323\303\236\254\210\245:G\307\220\275\326\350\310D\257\326\b\022\257e\301@\005\266\300f\353k$D\305\373\270\367\374\036%\032\203l)S\n\033\020\351\353\003\312\260+^\022\261b\"\202\"^\331E\374\030\030\263"
+	.string	"e\021\003\303\262h}{\373\372\322\341\rI\244#C\275\"\320x\344\2102e\200\26434\362\034\324\233\356\360B\032\351f\177[\352\211}\270jb\337\273\241\246_\r\224\250t'I\355\212\244t\026U\311\254\334\273}\030\337d\353\036G\301\242\226 \244\305\005\244fw\025^\331#\360\352v\310\266\274\300\020\262v\320\261\331xXv>N8\273_T\224kO\315\177\351\0173)1\\\267=\003\032v\327\311u#\267>\301\366)\n"
+	.ascii	"2\003\3020YB\330\256\211\222\230 \272 _\212r\270\313\322lx\327"
+	.ascii	"\275\001"
+	.text
+	.section	.gnu.lto_isAirmodeActivated.147.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375 \342E\006"
+	.string	"\302\213+2`M\222\016\300\016"
+	.string	"\005\024\271\253\3046\321\262b\b\020\334f!\212\314Xk7\326\307\261\365\322u\273\002\200K\220\327U\201\366`\305\321\261q\323{\313\024G\226\313$E-zh\022\020\016\021-\232(\232\305`i\3422\265\nI\232Z\005\313\342\347\360`\203\234\257HG\250\353\261\005\346Z\025\272\230\200B\207\003\032\233\313\036\323\034n|\001\022?\377}H\300\201a\365:\311\364d)i\002\225|\374\231\257\254\260\220\231*vy\n@:\027$(\231X\303\216R=\3526\244\r\234+\253,MO\200!3\277\312\312\350\330?\341G\370;\001\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_processRx.148.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`X\001u\016"
+	.string	"\206\233bE\020\221\223\016\374\253\026(\225\200\002\263P\377\303\360\277\013\032#\007\275K<\251yK\305\321Z\247e\270\031\302\365\306\306\305\250\344*\351m\374\006p\004"
+	.string	"\024\240\366\020\230\304\333\005Wn\215\b\264A\354&[\312\224\002R"
+	.string	"J"
+	.string	"M"
+	.ascii	"\240\211\023\201\027\026\323\013\035s\202\332\226\370\350\033"
+	.ascii	"y\305\325\221\317\371P\276)p\t\342W\026\362q\320\030\023\254"
+	.ascii	"f\344\b\371Tb\347\224\302\313\276\222n<\200bae\037)zl\204\246"
+	.ascii	"\247\256+"
+	.string	"\237Iu32\347\264z\337\207\033\273\355\316\366\002\373'\002\337V\253\325\303\213\262\017\363s\254\306\254\226V\257\372\0016\3348\255|G13\347\251\305c\206\027\215\213m\221\235\331V\265\317\342-D\207\321\340\2179I\254\2201'\250\300\b\260_\236w\344\257\370\001\362\227m3h \362\350\001 \352\332\355@\324\237 m\020\005\275\267\373\225\212\025\232\006F\210\031\267%\346\372\241\236yN\332\026BzO\027\200L\r\025\257\031\321\222Y\217\3447\202\013UIk|)gm\f\031\364\336\367\251\337\203\n\215\220\265*-\212\r\222t[\354\241\007\237\022\220\203\023\223O\327]\330@\274\211|:n\3236\t\232\t\210\244D\333\272\220&\3221W\341\323i'\034\327i\031\230\362(\261}\352\030\217\027\227\231\030\372\230\313\355`[\256GR\226\024\347\234s\003\001\333(\005\250M\262\351=\037\207jGH2 \"\032"
+	.ascii	"6\023\020\3520CVd8\200\031\273 \305\317X\003|AL[W9\r\340\200"
+	.ascii	"\025\2639\020\016\306\260\025a`\213\253\335\310\301\226\270\f"
+	.ascii	")?L\001\215\305V\323Q\210\221\204\032p\357\250l\236\001"
+	.text
+	.section	.gnu.lto_subTaskPidController.149.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\007\002\225\021"
+	.string	"\346\"xG\340\320(\035\373\252\036S\210\2550\256\027V\002\2629\032\204p\317a+3\262\001\355\243\261\257s\367\261yt\274j&\321\306\255gOZ\375\231\022\2044)\0061\241\037y\250\b\240\021\f\330\242K\360omo\"eJ\001b"
+	.string	"["
+	.string	"g"
+	.ascii	"\246\247\375\023\347\201\375v\301\247\335\033\030A\273\037\211"
+	.ascii	"\007\230\016G\036\022\017\273\203\304C\303\354\032\"\263\215"
+	.ascii	"\035\350\331\241\001\341v\327S\020\207=\302N\023\346\337\347"
+	.ascii	"\247\232-\366\310\3410f\226\335\206kg`\206\363\200\262\301t\001"
+	.ascii	"\220h1\356\363\224\261\3112K\013v\327Y\263\321\334\245\333^\261"
+	.ascii	"\255\300\316\223\371\332\241\337\212\207WH\"G\321\007\236\016"
+	.ascii	"/\231\263\277X"
+	.string	"j\216\375nw\327\212c\377\366\177\240\376\335\247R\332\024\323\245\230\2161\ra\272\323\264v\351\324\364A~Sb&\203\3557^\354\316\344p,\021\024\022\361\357\267\177\037w\330\376\\\2764{\f\270\036\023E\273\037\201C\027\b/\231\3534\342\222rDPs\214\200f\304BQ\372A3\272\245\357\022O*c\240\253\252\254P}P3t$ ?4\325\206\020!_\363\310Lc\366S\\\205\205\224T*\036\246\002\250\031\332\351<\322\236\260\312\327Pz\02762\215\335_\354\236\021t\263Q\3151\374J\274J\370\241\001\223H\366\177\216b\305\3271\253\025*\326\312\344\345Jy\265\234ZNT\254\225\311\213E\345rUHy8U\242r\265R^J\305cY\245\260\274\224\253\305+\tq\213\202\312\345\275Z-\227\327\361\355\025\207\201\206\357\250\350Ee\321\244\266I.\324\300\013\261\273\t\374\240\2678\361u\016\355"
+	.string	"\005%\036F\0315\033%5E\205Z\322\307\214\220e\316'\215\372N\241\212"
+	.string	"\321\222\002\037"
+	.string	"3\003\356\231\021D/\303\262\f\266e\242\361\350\262\234\235\317\276\360<\331\266)\331\r\252\025\036lbb\\\332\230\036\260\032\031n\233A\262\211J&\222\t\273\313\334"
+	.string	"\025\221\013\327<\212\030\234\272\002\274\221*\b\t\212\003Y"
+	.ascii	"3\246\024\n\n"
+	.text
+	.section	.gnu.lto_subTaskPidSubprocesses.150.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`6\003e\027"
+	.string	"\326k\230G\300\332(\035\200(\310\t\252\304\353\0242+\bm\017F\326~\236PR\020\315\223\\\207\262y\227\306/\254\355\257\357\245\255\31160\373t )-Y\004c\002\212\033\213\001\237  "
+	.string	"\271\315/\202|B\310\336DJ\231\002\212"
+	.string	"w"
+	.string	"\205"
+	.string	"\266,\273Zu\021\276 \334\231`It\347\267\003\350\316\263\3760\006zj\213B\220\217\030\020Q\255\225l!\313\332q$\206 \235_3\353\013b\360Y\261\234\265v\344\261\243\345\"\343\241"
+	.string	"\211l\007\213\nl\264\332\206Hd:\030\344\"\253}\tj\2551\2469v~\017\206\202\306"
+	.string	"\230\301\370H6\212\224=\374\335\330\376&\364\020\365"
+	.string	"0\203}4E\261.\353\263<c\366b\0061\324Z\317\345\214\266\247\331\377P\376_\370\233A(~\204`\\\364\357\317:\321\371\0229*\305[\356\374\246\350\316\355\021\270)dt\270\270\367\353^\334\267\177\277\332A\376\315\355\222lV\267\037A\376\210\362E\312\017)\037\234|\332\374\331\374\257\371\375\361\271\371{\200@\022\032\264\225\321\253\325F\317L\345M)FV\267\373\357\372|\374\257\343\331J\253\033\203(\b7T\253\016\302\316K\b\227\377]\262LX\233{q\261\326L\224\340\302\375@\277\336!\277\207\225\362!\254\025V\341\273\333 \020_\";\037\002\007\207\356\374\272\201P\316\305=\256\265\266\300\257\016\355($\272\035h\251\321\001\374\2338\301[~\237\330\266,\256hh7\373\366\002Pp\024i\233\016P\342\250\301_\036:\366\214\337\005\345F\361\003F"
+	.string	"\207\313C\377\234\022o\311\275OlYx\260n}5\374\2538\361\2266\315B6*\274W\267\376e\227\373\321}\373\\\035\272\035&\324I\304J\225\263\332\021wpL\250\223\210\325\n\223J\325\242T\363\322\215I\225*\221\245\024\344\212S\016\212,\251v\310\033\322S,L*r\225J\251\310Q\347\332\016r\021H\215\347\352\3278\352\3777\213\205\325\204\304\325Z-|\255\354\225\f\0326l\240;\251\227R\214\330\243\260\301\026{a\034yq\357c\207\275\264\3016"
+	.ascii	"\024;\343\342\036\355\335\362\343\325\255\035\365\rhg\247\250"
+	.ascii	"2\273\004\316\013\031\021\001\223\372\347\320\241\f\0176%; \240"
+	.ascii	"\002!)\263\003\263\200\255\030\302!X{\365l\315\030\263\221\334"
+	.ascii	"\335\016;\022\3361\343\266\345\334\212\013\033\317\233\240\013"
+	.ascii	"\027\013\026.\262\367\334\270j7\376j\341\006-\023\017x \224t"
+	.ascii	"\203\270o\026\265\253\004j\024\033\355\345\252)\337\252\013\221"
+	.ascii	"\231\034m\233\333\333\330\302 \221\202\212\260\355\211\211\f"
+	.ascii	"y\200\0219^\363\234\030\234\270r\336\204\332\212Fu\277Z\366{"
+	.ascii	"\305X\3724\334\026\310\307\232\f\356\030*\013cL)\004\024"
+	.text
+	.section	.gnu.lto_subTaskTelemetryPollSensors.151.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"E\007"
+	.string	"\"\31635`o\032\003\024\022\302\032n\365Qt\317,\336\303\332\027\275!E\003\217\216\214=\224\036\022\335\331\003\367\226\301c+\210@\240=\253\350\006 \032\026\033\331[\312\224\002\240\206\313\323a\b}\2569#d@%\347\232\230\214\362!~:\016\236('(r6\305 \256\031C\0306\243\206\273\251CS\255\022HW\001E\245^+1\361\274\025\241\364\321\211\240\326r\332\203\032\255\251\377/4\265p\300\203\203\344\013\223\037\343\305\345]\245\322\241i\353\327:\304\"\231G(j\375\031+(?\227\320\003"
+	.string	"W\005\336`\\Q\026\300\270j\326\262\230;\235 \345\304\242\244\345\177\204\033\316\374\262\332$\266\266\221\346\227Y\370\337\267\215H.t[\203\266\nmO\001\b"
+	.ascii	"2\241Y/\260\270\340\004\346]\002 VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_subTaskMotorUpdate.152.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\261\004\005\036"
+	.string	"&v\275I\240\330M:\221\243\031\344z\320\223\271`\265\226\n\025\034\332\007\035\246\310\355\311[@!l\034\354\t\223\3721d\373\026\355\261\031N\330=\366\351\352\036cq\335\200\357q\343\005/\243\351a\357\315\351 E\333\b!d\023)\223\f\247"
+	.string	"\230"
+	.string	"\253"
+	.string	"d \224\247\177\325\322vW\210\364\332T\037C\214+\fX\255\302\004\247\273\240<\357\036\311\223\354N\345b\315Z{xm\325*T\260\005\312\323\237\363\214\247\342k\343\351\356v\311\bP\252\274\006\\`|Xb\265\326[\003\371\3563\263$G*6\357\366\257\272y\376x\237\341\270\371-L8\200\2120\335\340\022\250G\023\360\244\210"
+	.string	"\214\313\314\2670\001E\236\245!\247\217G\247S\030\264\237\022\213\263\237\323[d\240$\226\343\346\367B\254\031\363qy\325y\306\257\307LF\250\265.\237\277\246/\355\273+\265\273\030vE!\001?m\375\253\357|\371\360\032\366\232\267_\266\250x\364q\343\273\204\325\327\013\036\333=\223g\341\366Q\233;\301?O\367'\306\323\367\207`\0314\300$.\333\025\362\270\237v/\326Z\353\366\217\335S\375?\267\372\372\330z.\374\326H\336\235\222W\247\344\315)yqF\336\033\312kC\343\255\231\361\322(\357\314\3445I\336\262\344%K\336q\344\245%\257H\362\366\310\313\224\367\006"
+	.ascii	"x\321j:\215(\265.\225\245\251C*E\352V\027\371\302\367\356w\277"
+	.ascii	"d\177e\325B\306\220+\374s\177\224\232\267\263\246\265\002\037"
+	.ascii	"\331Z\370\020\347`\237\005\305\205\262\326\372(\242\361t\326"
+	.ascii	"&U\322\225c!\312\240A\303xj\366\221\004\313\246\306\236\346"
+	.string	"/\037g\244L\031fQ\372\252\023\b\313\022\323@\251*-\242\255\253\274)\230\006\r\260\354\335\r:\225.\356:\303\310.\307\026\233\354\323\036\373>\262\244)\033h\233@\261kOKY>\262n(\347\342\200\023\254\265>\330G\371\226\207}\324\351\202\020!\342\333u\206\371t\367\f\213F\231\217\214\333\326>\335X0\210\364\376\344ZH,F\214\030O\271o%xfJ\207wI\bq9\242\241\016BG(r\023rtBGF\246\221\207\034\321P\207\243\0249\235n\005\316fqA9]\021\356\2063qK1$Dt\303\351\214nA<[\244\"\247\273\035\025\025\351n4a\275X\373\307\232PF\206I\335\233\355\214\341p\0233v\321\351\235\234\306i\235Z\347\3344N\013\300\272\351g\341\321k\336M\257\333\264\t06\035\"\210\226\221\003P;\206\275\346\225\005\246vG\336\004\312\306\203c`[d?m"
+	.string	"';\250h\317\227N\035C\304=\322\370\253\337\311\211\016(m\353Z\317\330\035\032k\272\204U\030 \336\335)\221\300?k\372M\240j\f`Z\377\364.\205\n\001_\250a(\006\225SjFF\222(H\f\322\006\240\002\031)\253\016\020P\211f\233tK\213z\247Cd\350\331\242o}\251\277A\016D\232\3411:\007R\266\267\315+Y\324\246\371&\245J\255J\345\260\252,w\243@;>\300h\274+Z\f\270\345\234;32\352\243\367XJ\352\326(\252\366\342\002V\346\333vw\r\210\252Y\007\037\025\035'\fH\030"
+	.ascii	"<\313\270\265\347#\341e?|\367\261\304(f <\376\245\351\257\204"
+	.ascii	"\364k\200p\304\215\021\017\025\004\016\002)\266~E\300\255\357"
+	.ascii	"\264m\334Pl\214\330)\335;\303\214pm\031\342fp\033\374\221\022"
+	.ascii	"\234\210\"/\325K5~e\235V\006\371b5\340S\310s[\343\301?"
+	.text
+	.section	.gnu.lto_subTaskRcCommand.153.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\236\002U\024"
+	.string	"vc\200I\300\224Q:\270\260\216\b<\350#mM-)\216\213tC\367BX\034H\265\020\270%\211\371[\177\205\333\372\260o\365\231\016\202>\307KX\036\376^\2101\330 \221\230\324\242\306\003\005\244+{\236\232\2414~#{o)e\nm"
+	.string	"`"
+	.string	"j"
+	.string	"\362\262\237\210"
+	.string	"\235\2361pJqKR\322\335-\036R\231\236\254T\341\224\221Wv\r]V8\335LO\016\374\354zt\025W\236\2007\003@>Rj\224\343Y\225\032\345v6\234\267\225Q\005\b\213!):\022Q\201\n\037(X:\235\215,\235m9H\256'\256t\267\322\320-\241\253\355\206.\335\375\305\351vz\226\376\347\375_\360\357\2123\276\210\251\314\241\027e\333\251\257\366\207\201X\305)+\223\020\017`\215g?\257\266\034\364k\354\356>\003\375s\037\316\375\214{)\3671\356\231\367\273{E\t\200\244h\247<E\272M\004\2314P\376`\260\376\353\376:C\217d\2124\342\253\356\037\0349\272y,G\240R\271\242*SeT"
+	.string	"S\003\234\344:\216d\264\220\034\2440s\262\n\365\242~\013\352\203\261\2417b0\310\310L\225\223u\207h\207\024\022m\203\0329\350\222\231\327E\357\207m\247\036YfP&\r\252n[\203\253\222.m\230q\271X\223\240\220\226\231\365\326\204\266\301\026Mz\251\272\333\301\265\2475<\\\213T\236\246F^k\246\312e\026\250\037m\203\272\335\03581/\033\232\01397\257X,\204\013\345\256\226W\f\346j\271:\264nhflZ\256\030N\253E\345\260\017\257X+\007\006\213\265X<\232\306f\240\257\206N"
+	.string	"i\\\203\220`H\027O\n\354\037A\302*\356\312$\264\204\300o\366b\245Z\037\324\203\246#J\252\024\271\363\t\371\223\221\030=B\230\031\262\032\365\240&\250S\223\376(Txy\231*C\326 \021/\371\344|s@> \220\002\231A\353\006CC\347L\f\3470\356\222{\312\013\222\213`?\344\324w\0037\3351\021\341\036\357\307\0241\215DP\2664Y\270cHH\003\277\312\213\261k\323\034\023\223\376\367\254\264\306\305\340\201\264\345L6\260\rY\211m\361\354\022\326\253\346\303\032n\375)\336d\332\032\352\267fcK\253Z\273j\261\317k\300\206@\274\246\030.\371\200\030\233y\275\346v\204-\220\"\224V"
+	.ascii	"\330\273\250c\326R\217\330+\003"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.154.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`}\be)"
+	.string	"\332K\034\020B\200\334\312p\033\001\304+\315\003\223\027\232\341\372z\303\021\360\223\242\004\264\205i\0255X\030\r\331\364F\315\326\360\001W\025\371\376`\2311\335\320U\357\207\233\201h\220\nJ>{\272\333\277\t\331{K\231R\357"
+	.string	"\330"
+	.string	"\356"
+	.string	"q\377\334?\274\250>\373s>]^\034Y\234/\307\346\315\207;\323\346\273\205\371\332\331\374)\336\221b\266x\024\373~\304\231\205\231\235\347\331\302\227\342\235\217-\256\346b\003\032\2560\b\277\217\343\323\274c{\370bhkxz\371\326\302\344\314\336\234\347\020\351\243\231~W\373f?3\217\366\302\345y\376\240\"w\236C%#\370}\034:\020\371Q\274"
+	.ascii	"\362\243M;\315\207dg\001\272\267\256\2657\347y\002w\354\346u"
+	.ascii	"\312\237"
+	.string	"\217\034\305U\323\177\332K\241\027\326ut\274\024\233`\274\331q\273\032:D\0368]a\236\366\003Jj\200\351\357\300\017\033_\367\335\256\306W\227\2228>\212GxU\332\370xq\211@4\214\ba\250x\343+\036\205q\271\341\343\265%\002}\001r\346i\327\030^Z\252\276\007\347yZ\205^6\356\235\333fb[\204\375\333\020\337\242\001\210\354<\317\006~\226k\341\340\023\371\350\016\036\364B\017\344\007\362\343\336\t\363\022,\321*\330s!\321\322=\017\330\004\373\240%\332\222\315M\327\234,\335\363\217\372sRSza\320\236\356\245\232-2\316\360\264\026\313<:`\355\022&\364B\033\215\321\325m-\226=\324\322\025\263/\236\033\304\036\325N\245\272\251T3\235\355fP\252\027\224j\340\333\356\245R\255T\252\223\376v#\225\352\243Rm\364\270\273\250T+(\325\tJ5\321\347\356\240\243\375\003>\274\003\220j"
+	.ascii	"\245\372\207T\373\374\324=\243\232\347\247\336\371\251u|\352"
+	.ascii	"rT\377|j\237OM\216\352\321\247\026}\352%\325:\252\357\340\350"
+	.ascii	"M\r\214\024:\270\0253<i\354\3059\353\306\271#g\373\333\376\267"
+	.ascii	"?vV\202\204\235\221G\3738[\265\024\206n\211Ik\264GEk\024W\264"
+	.ascii	"\227[2T\332\277\331\227\363\2759\013\334\244UB\332\2447\244="
+	.ascii	"\034\023\037\013\366m\366\335\\\357\2152-p\027,-\260mi\357\326"
+	.ascii	"$\355\227\341\006\345\324\303k\332\263\331"
+	.string	"W\3635y'Z\246mb\260Ll\f\366SL'o\033\353B\006\007On|\"}\033\202\334]\337\356\035\327\334\270\344\223\2371\317~\347\271\345\344\227\271\031\023\n\204\b\021\310\217\343&\221A\023w\314\205y\377\023\271+\356\271\302\3740\277{b!A/\224\260A!m\364\276\262tO\324\265\235t\273\t\300\272\177\241P\301\202\005\362#y'\314\323%p\367\033\021\206\325\355\212y<\024\371\035\241FfK\341\330\347\362.P>\021_\210\212\"?~\237v\242(qD\302\316\276\024\354\347\354c\t&\261D\245\"\030\234ZQ\365!EU\325\t!\253(\026UT\243U\324U\020\304\325\005\023V \256B\250\260\362\261\212\232BQ\002\303\025\325T0\250B\252\307RKS\301*)\240\324\b U\t\020(\200RA+\340\022\220\253RL\005\201WUUA\340\3160\353\342\271A\\\226-\251\313Z-\035"
+	.ascii	"J\312c\307\317\002P0\325\241!\207\t\006F~\374Y\feS\364\276|4"
+	.ascii	"\307\204\037\305\321\263>\253W\272\346\250\322x\317\352\2272"
+	.ascii	"\036u\026#\207\346\243\374\241H\236\r\2416x6C\031\233\336\217"
+	.ascii	"Iuvg\003,\017\263\307P\327b\031\250\002n\002!mS\314\034\323\013"
+	.ascii	"wv\250\\\235=\234\020\235\361\364;\317\323\311\032Ce\230C\314"
+	.ascii	"\"\346\021\363\b\371\261\\\222M\331\232\023\264,\335\363\255"
+	.ascii	"\230\205\204P\274\214Ek\300\355\314\210\030\264\0016\206\020"
+	.ascii	"\351\364\263S+\363\013\221\277uZk\327\027\027\355\2022\223D\375"
+	.ascii	"\002\200\215\250A,\005%3\206\210D$\215$\005I\007\300\002\021"
+	.ascii	"\241!\262\003\022 \2245\007\222\212A\245I\fR\377\351\006\027"
+	.ascii	"\350\254I\206\260\243\341\232\347Li\007\221;\322\372CdN7V\300"
+	.ascii	"fu\no\324\016\032\223\336\206_\257\002f\314\017\334\342\3424"
+	.ascii	"\230\202\370xh\"\217\261\201\261\343q\230.o\375\277\001\276n"
+	.ascii	"/R9\016\3024\371E\272\313\212\326/\262:GO=\371\325O\003\251\316"
+	.ascii	"[\352\341\361\347u\313\310)\335\227|\372\\zl52U\367R\037\237"
+	.ascii	"\027\217\327\006\365\373\346\252\0076\245c\306\301^\366`\264"
+	.ascii	"\252\320\020\237\335l\277\031.\027\300\353\022\275b \005N\222"
+	.ascii	"\352`k\017\334W\202\243\240\321\317s \3408\351\330\241\033G\250"
+	.ascii	"\364\206\242\3128C9Z\232'%z\357\b^\207Oma\206\276\017m\307\256"
+	.ascii	"\365\r\313\277\2713lY\025Qi\f\367$\323\256\277\326\343\271\024"
+	.ascii	"\203\013\204\235\345\245\335\342 \346I\266\373\342\020h\202\023"
+	.ascii	"R\244O\224>.\036\335\220\351\031Z8n\n\017\376\001"
+	.text
+	.section	.gnu.lto_isFlipOverAfterCrashActive.155.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375 \342M\006"
+	.string	"\302\313+3Pm\222\016$\223\203\310\250\342\222u\001"
+	.string	"\002\342\337\370lm\355\371\3077\354\337\355\360Z\301\215 l!\252\312\202\210\225\267\002\004\265\224\352\025\247\331\275e\nS\027\214UQ\215bh\017\r\013\016\215\262\"\332\305r\005\201\261\232DUYm\312\262\b:$\340 \305\367\243 \327\345x\"s\305*\335\f@\245C\001\f\316\215>\333\034j|+\211\240\377>\264\204D>\025\231dvF)Y\"\215t\374\232\237>@\320|5\333\350\f\220dX\204\240df\rC\275z\327\255G\025*D'\230g\323\013H\310\314\017\363|:\3667\370\013\376\213\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getLastDisarmTimeUs.156.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375 \360\225\006"
+	.string	"\342\314.4PM\223\016$\243\2142\211\242\231U\334\211*\357\306\217]\005:G\307\213\331o\377\303+\003\n$|\203\252*!\256\260\336\002nY+\312\323\307\266O\266L\001O\230LEMoRx\r\013\t\fo\252\036\036F\232r\310T\017\202\242\252g\331\262\356\203\356r9\211\357G7\353j\034\241\301b\205\256&*\204.\240\342\302\224\3378\350.\276\225\314\314\335\347\307\321I\232\211\247ZH&E\nJ\226@\"\033\377\346-\227\243\035\233-\204\316\225\025\214dL\200\234dn\357R)*T\251@T\310a\324*Z\267\036=\350h$X\306)\002\030d\346\210e\236\356\372\023\374\003\277E\007"
+	.ascii	"2\001\0238#(\016%\256\321Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_isTryingToArm.157.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375 \366\255\006"
+	.string	"\302L.4Pm\222\016\244\004\2522\332l\304\204\252\025-9l\003\254\244\356\377u\177\366\355\337\rZ\027\337\b\302\026\242*\252\210Xy\251\215"
+	.string	"+\245\016\035\266\265Md\nS\226\213UQ\217bx\017\r\013\016\217\262\"\236\245r\005q\261\236DUY\217\222e\021\2048\240\301\315\006-\"\226\243m\352\321\217G7\343\2115W\254\323]\233t*\006Th\334\366Y\306a\350+%\202~7:w\245\312\006\305\247\242\221\314\316V\222\"S\b\307\217y\312\007\b\230\257f\030\035\201\221\006\007\204$3{x\321\253\356\272\355\250BH\264a\236L\035@Bf\3560\317\247c\377\202\237\340\267\b\t"
+	.ascii	"2\001'8#\217c\261\250\360\\\303SF\274%\004\tw\316\324\316'"
+	.text
+	.section	.gnu.lto_resetTryingToArm.158.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375 \344%\006"
+	.string	"\"\013*2`K\324\001@// \222\331\275C\343EW\256Rw\272\313b\267ZG\243\036\030\257h\340:\031\351\220\300\350\nd\2136E\007UK\377\223\277wJ\001\236\017T\351\224s@\032\020\b\024\310Y\021\344\343\230\036@U&PZe\263\355\343\305`\036\336\024\027\\\271_q\013w~f\005s\360\324\027\337\\\344K"
+	.string	"\226!\3011\301\317\336$\030\035\354C6^vt\264\314z\204\306n\303\367\261\336\202\241\331~\343\310\336\370\006\261\223n\202\341\242cwe|xt\030\371\2478CU\322\241\004`w\r\251\312\272\343)\266\255\t"
+	.ascii	"3\001\0078\003V|\241k\270[\b\343e\bp\351\306lm\327i\001"
+	.text
+	.section	.gnu.lto_isLaunchControlActive.159.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375 \305\255\005"
+	.string	"\264\tn"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	""
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\243\346\252\266\004\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\277\325\024\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\307\254\001\222\216\217\234\253\001\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\200\300\013/root/repo"
+	.string	"\025./src/main/fc/core.c"
+	.string	"\t"
+	.ascii	"2\003\202\341\243\302n\025\220k\370a\304hB\344p\347`\355,\003"
+	.text
+	.section	.gnu.lto_updateArmingStatus.part.0.260.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\372\017]G"
+	.string	"zo@\031?0bR\007\227\017R\212\303\304\230R\331"
+	.string	"8\036\030D\240\220\030\317\320\376\360uF\311\2731U\335\277\202H(\200\242#\204~\364\"\240T\371\347\267\233\331\355\376<\020fdk\226\354\275\245L)\212\001b\001\203\001gh\316\304\262[\005\217\375;\377\274/\343G2c\306L\331m\355\274\200\021\037\026\343`ah\037\246\206\263\201\205\311\037\246\206S\212\235\327F\\\261v\204\363\214\355z\330\261\210\177\275\361w\216 H\235\343\353\177Es?\036\037\376:wGcs\331=\320c\347\3467CE\215\f\341<\317\317\207\267\334\313o\240"
+	.string	"\030\201\001\317/\001^]\\[Z\001"
+	.string	"da]YU9\251\246\244\242\240\236\234\232\230\226\232JIL\244\243\2452\211<\032\213\304a\f\277[\207\311\376C\007V\177}\252m\3227\360\347\013\200\371y\002\203\202z\3003\320\216\376\022\233\263\r|\001\200u\264\027 \035\335\005\370\247\271\262~zk\216\326\362\373"
+	.string	"Y9\032@vOg\351=\326\032=}\265F\215\266\332\013\304\303\226FW\241y'\2323\232j\252H\005K\034\020\274\227\272\273\352\250;;\r\205W\247\237\234\300|\323\027/\232i\311\3127\253P\321JIS\236)%\212F:\202\362K<ls\257\363\372UtlK\264r\350 \016\310\333'\253\220tx\330\224\350\243[\022m\344p\325\332q\343\200\270}\361\210&\342aCB\307fD\017\351\330\220\274\316y\236\277\214\232\216\237\216\355\355G\233\016\r\353j\333\220\177\217mT\275_\256m\033D\312\266\034os\255J\365\257\257{\264M\265f~\330\320\301<\317\3768"
+	.ascii	"\275\037x\367m\347\356j\356H)\001H>yv\342=\034\006\276\303\211"
+	.ascii	"\341\035o-2:\350\336\r\357Wk\344\216\341\265\031\210\363L=\340"
+	.ascii	"\017\370v4\370Oy\3307t\320_\355\020?\374\356\357#x\207Cw\275"
+	.ascii	"\251\335A\204\320_\335;\256\203\373\271\302mvo\253\273k\305z"
+	.ascii	"G\363\006\251\272\320\365\374Z\361o\275\337CjF\246\272\353L\355"
+	.ascii	".\202\204\376\352o\032\211\256p\267\323-\325\333\352;\354w\267"
+	.ascii	"\333e\344\333\211\373\253=\353\325\216\365j\277Jj\267Jj\257J"
+	.ascii	"jw\276\332\251\216\332\247\214\332\245\220\332\243^\355P\257"
+	.ascii	"\366\247\243v'\243\366&\244v\246W\373\322\253\275\211\324\256"
+	.ascii	"\204\324\236\364jg\276\332\221^\355GK\355K\245v\345\253=\371"
+	.ascii	"jG\276\332\217\257v\343\223y/\276\332\211G\355\303\244\3668\251"
+	.ascii	"\035Fj\177\217\332\367Q\2736j\177\023]v\313\267y^\353.\232\341"
+	.ascii	"`>+O\346_\314\277\336\177\232\227\343\342\206\273h\302\316\001"
+	.ascii	"\031\022\362\243\306\246\017Z\346P&b\3264o\320<\206\203\351\216"
+	.ascii	"\034\357\0320\201v\2043\025\333\345|\357F\206\307\330;r\340\210"
+	.ascii	"\263\332S\247\243\357\371\260c\277\031?L\374\244\370\341\241"
+	.ascii	"\373{\331g\235\201\\\240\214\317\372\205)pov\376g\324\374\236"
+	.ascii	"\336\232\2635gY6\025\322\240\t{\257\375\344\002\337\256VKK{\031"
+	.ascii	"dP\325\354\346\317\331\244jn\031nX\356\226*\3103\001\247zD\330"
+	.ascii	"L\275|\177YT\374f)\251X\311X\230'\370\276T\234\264\225\266k5"
+	.ascii	"#S\375C\257\311A\206\310E\212\304\017'\355\006\202\203\220H\225"
+	.ascii	"D1\367\307\351\036\317\334J|s\240\220\242\216 mf\237\226\372"
+	.ascii	"\244w0\3318\315|\327\246\243$G\233\tF;\335R&MejY\"\316|X\232"
+	.ascii	"z^v\213\227;\232\007\250g-\225\335\226\310Ld&\361\303\313]\324"
+	.ascii	"c\206\253\304hQ\222c\271\314\227\233\304J\001r2\024\375U\345"
+	.ascii	"^\"\322N\221\b\177\271=:Rf\353\3742\271\243qr\377\365\377G\366"
+	.ascii	"OK\355*\213\333\020\234\345\320\227\344o\337\235\002\036\022"
+	.ascii	"\035\242A$\362\003=r\177\0218\252\001:qq\307m\365\377\363\305"
+	.ascii	"\375|K\264\344\216\025\221\221\370\022\244(e\277\024\217\244"
+	.ascii	"\361+\036\3677\312\333\322\376\262\225\330]\306\"g\321_=\356"
+	.ascii	"\254\265"
+	.string	"-P\333.~\304\032qqG\330\357o\256^\344\206\306\255\013\375l1n\ro\332\267\253\021\034\272\333\245\270\277\314\033\341\270Z\3566\336\326>O\274\322\356r\235|\325_%n\032\\,w\353\177\026\373\357y>g\376S\\\306{\360 ~\270\330D\017\241\241\rOi=\277\204\330\235\202\005\375UW\356)\322R\021h\005ey\267u\270\367\016\236\342\013\205\212\023/\240cL\236\342\253\254\0054j\366\002:Fb,\032\005\215\326\240`$kaf\006\215\246\360@\026\205\276@\241BI\203\003\331\214\022)b\026c% \320\340`\006\245`V&cE\322\307\276\310\242\320\261\347\330\211\347\013\025%\\<\307\242e\317\257\246Ca\220E\237fPh\364y\374w\336N>p\2658\366\324\200\240\264D\310\276C\005\006\245%\002\004\233p(-Q\337\237\236\347YJ`[=kG\263\372\346h\247\357<\317\363"
+	.ascii	"]\245\257\315\336\034\030;O\254\375\\\2606S\037\036 (@\272_K"
+	.ascii	"v\314>@\263\200\253\235v\265\233D\352\264\324\004z\363\236\327"
+	.ascii	"\266z\327[!\025\366\221\026\312S\265\235\333J\310Tw\245\2101"
+	.ascii	"\023\247k\313\353\227jx\250e\003t}\325\356"
+	.string	"A\265m\244q\2516Z\0268\256\251\375\205]\274\327\212\245\366\324\036\326\221\332Y}A\264\323$a\022@[\372\355\243\004\323\024\351\271'Z.\215QZW\226J\343\207\243v\322:\346\313\035\327\033\035!Z\334)!\036\001\240\366\0276\241\266\206\262d\313\335R\001l\253k\254\256W\242Q\244\226\275\362z\347\356\361\264\305\246\310\345\r\212i\347\374r\0165\231\207\376\352\323\326L\226h\271\333,8w\232\370\301\372{\247\375\203y\202\313.\236\240\356k\305M\333i\307\214\232\266\f7\335\322\271\253\f1\323^ '(o\320]\356\241\335t\022\255D\366!\257\311mm\361\303L\373\003\201Z\250q4f\22133\"#\222$\005)\f\007Q\005\304 \350\230u\036\021\360 \203X\325LRP\310p S#b\232C\2608\24479+\303UcFb\365l\304\331\f\337Q[ V\005\370QO\267\r\215\033"
+	.string	"\032\021H%\363a3J\b\374\026i\r>\233\337_\316\314m>0\250\023\313\343\325s\355%\264\243j\344\335\242\367\321\022\235\r\252\202\344\251;\020\346\253%\307\214R\212C\360\1775_\374\230ua\221\214/\344\267b\007\374\213J\206\333\0130okS\307\b\036r\371\315\340\232\337!Tc\317Z\311\227,\317:\n}\303#\370\302\r\246\033kI;\225\037\035\246\274\362\260\205\333eG\357\330\375\360\305\334\317\221\301\252Q\350\313y\212\265\221\003%\377O\320\006t\367\274\325\223\260\321o|\t\312>\311\321\251K\263Fv\326\017\327U\004\266Jj\303\2119\240\230\310\217\246K\315"
+	.ascii	"[G\200U!\322\tUt\025\304\354\214\351\311\257\204\376\221\260"
+	.ascii	"\"\217\220P\326\340aC0\214\031\335\256\246)hn\220pHk\032cA\373"
+	.ascii	"\310\034#\355/kF$k\237\321\r\036\245\005\354\227\234\223J\346"
+	.ascii	"\245\031\330[\004'\006\206\256\214\320\221\300\251\201\t}\r\206"
+	.ascii	"g\223\317%\322\327\230!\311B\255o#\003\324q\002$F\347\305\263"
+	.ascii	"\026\006\301\273\332x\3364"
+	.string	"\223\376T|c\314\t\304jI\201\324\301\2443\021\314\353\363uP7\336\361"
+	.string	"}\311\316\332\257\215\001;\241\r\003\367\337\031h"
+	.string	"\345\251\323@-)\f,"
+	.string	"\313 5\365\005&\241\016\373\003\244\334\311C\364\024\220\374)\001\321\355\340\235\004\333\316\251\331\312"
+	.string	"\253\b'\311\246=\264\306w1\274L*\n\212K\210\212\t\216\002\205\223\007\246\220\341\rN\205\304E,\212V\327\b\224{|\202\026p0\313x\211b\2647 \344\310\224\035`=\301\001%E\332\323\246[\204\354\004\255\256 \231\311\327\322w\301\327\020e\340p\030"
+	.ascii	"\273\206\245\271!\364\374\320\003\t\310_\244\002\237`\002\337"
+	.ascii	"\363\235+\tD\3207k\211J\202wLV\030Qy\017\252\355\")\264\0376"
+	.ascii	"(\310\330\257\314\331l\003\350\262\251\254\0220\203\217\032\035"
+	.ascii	"\215\217\201\325\004\273\035\267dxo\3229A\346\303&\016Rf\212"
+	.ascii	"\1778\340\026\\\222\224\007\036e\363[\234i\r\216\332\255~\315"
+	.ascii	"\033\344\264\266k\336\001\"\256\031yM\273\307\b\273\244\355g"
+	.ascii	"\347\\\035)\213\017*"
+	.text
+	.section	.gnu.lto_disarm.part.0.263.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\250"
+	.string	"m\n"
+	.string	"\306QC< \345*\035\3006]\030\242/H\002x\332MM\200\\"
+	.string	"\300J\331\246\t\240k2\216`m\356\326G\006f\271\267\255\211IAT\20005\305\341\247\246\342(\363\bDkk\311\336;\245."
+	.string	"1"
+	.string	"6"
+	.string	"6\315G\332\276\345\306\301\222\333\335zo\222\\\365)\251\312\277\355\001.\330\352S"
+	.string	"\006rIp\312\021\355\256;!\267w\333\t\266\025\354#\004(\237\fF\332\307\302\211N$\267;\326{\036\377\331\334\353\274`sO\332\367\310\030\365\233\033Jfb\265\335\375\244oK\331\337w\357(\266S/\253\002\222\336\264\261/0\344]\366\300"
+	.string	"\300\265\346J\316\231'=\335)\263'h7\020\333\365\b\260\333\021\357\305D\276VR>\211X\035\033\324%\246\246\226\333\326\bJ\271J~\be\204\244\bp$A:0\030*\211!XA\207J\0011\232\250\240h\252\241\217\303\212\222X-\302P\254\237my\272Sf\006\035Nc\262<\347\234\331\346\004\031"
+	.string	",\205+\307\n\013\215\206\013r\256\006\006\344\201\021\256\030\373&\b:O\244\212\363\031\3613n\236[\276p{.\202\305\214V\324\r\235\266l\346\355\264"
+	.ascii	"\\{1\345\264\234~m\031\003"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.part.0.264.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\375\006"
+	.string	"rL-3`M\222\016@c_\301\0064\303d^\357\343\265\376\007\r\213\350\306\363w\214a7\306\205\261\365\322u\273\002"
+	.string	"\020\324\034\025r\240\361\275A\326\210\220Md\nK\230\f5IORx\r\013\t\fO\242\036\036\206\340\311!C=\210i\242^\364\263\266\304\316\227\020\n\210\002+\020=\277cQ#"
+	.string	"^b\202\325\272)\241\013d\201\033\206\236\261\265%v\036\333'D\240#3\243\205%=\334\211\310\367\322|\024\325\225\344\327h\\\275JK@\262\340\203qa\262\222\231\257\016?Z\025Y\253\256\305\331\024{\225Y\234\215\262\201\266"
+	.string	"\204\314\374\302\321]\377\203\337\340\037\t\020"
+	.ascii	"=\023\030\0278G\021\007\210\202a\256p\032&.\316\210E\235\323"
+	.ascii	"i\241\315\224\235\006\200k\317\005u\314v\236P\306"
+	.text
+	.section	.gnu.lto_tryArm.part.0.290.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`k\004M\035"
+	.string	"F4\266I\260XQ:\300\311\211H\246\220A\004\032\234\344\r\201\002\001\025x\326c\235P\335O\362?\334\274sq\371\251\375h\352g\204\336um\320\312\017\363\215\321\204\241\360R~\270F\021\037\204<E\231'6\024\375\337\b!D\356\224\002\230"
+	.string	"\237"
+	.string	"\242"
+	.string	"\277#W\362\233\230nW\002\344!$Or^\tP\216.X{'\260<\371\021k\r\352\2344\202\325\311\234\333\224'\307\013(\017\264Q\\\311\004\200\320\360\211\274\210\212+\231\004\302C\205\277\364\340\212+\371f\t\311\367\253\265\256(}\340\315v\271N~\210\355\333\220O{\313\203H\365Me\204\214\020k\255\257\223{\364\363\344\270\264<\375\240\223&\017\360\224\327\203\361\221\362zE\337\232\236n\314\251\265\276\351\324E/Gi\200\227&O\255\325\253\030\267y\333\036l\307\354\261Ftw~H>\340\f\034-\272\206\3322\022\364\274\357\233\336\242\302\204G\230an\203\350\032y\313\217um\330.j\032\026\365\f\213\332\305\242n\265\250Y&\365\212Em\232\324\245IM\256\250G\223zMjz\246\3738/2"
+	.string	"|\265\276(\222\2514\310\250\035g\372\243No\202HDCNn\266\361\344Z\260\030\235\246\f\177\304\252\013\352X\370&(l\333\026,p5\034\0301\355|\304Z\203\257\223\016\256.\300\276\037\305\304.\250\333\241\354Zb!\2062T\277\005\253''\257\214#N\256"
+	.ascii	"\f]\316!\253Zu\r\374\341\271\234@?\307I\237K\017\036,\203\033"
+	.ascii	"J_s_$\246\270\033\342h\021\002\024\252\234\204\016\006\236P\341"
+	.ascii	"P{\002\205\231) \325Xj\031_\240$\267\334_!\327<z\0222\203\326"
+	.ascii	"Z\203v\215|Z9n\255H\026\035\025c\002\024\347\026J\373B\006z\336"
+	.ascii	"\2705SIT\272\r\262\r\2659t\240\347\371M_Y\361Ru\356Sy\025\013"
+	.ascii	"=X\312R\345\311?=\001\221p\350\373U\355\224\363\272\354\013\224"
+	.ascii	"twSD\021*\312\321\242\375(\227\362\301\317a\0200z\036\254<\031"
+	.ascii	"."
+	.string	"\261c3A\253\375\314h1\020\261\032\316\214f\203\3110\210\220\231\b\001\263\365D 1\353\361\251\301\006\3306\310|z4\374\314d\265\032P\214\306\261\035Y\215\026{\305F\274f=0\237W\254f{\355\330\230vBV{\375\320h\265\227\3136\375X\327\206yp\233#u(\371\023Gi\237:\316\035\364<\313\306\f\205\031\352\210\026\366\260\024\353H\n\261\212f\375/\007s\3768\203\234IgR9\2634K\205\273)\327\232;\263\243p\347\313A\275\212\250\326j\005\272Zq\007Z\353\332\357|\260\266\2657_v\303\325\262\366Bep\264(\344\001`\250\201,\"\031S\210FDD$\005M\013\007`\002\221ruu\021\320\301\263M\2226\003\r\027zK\202\345.\335,\314*\224r\270\210\205\223\325\020\361\300\207\333\3139\330Y8\350\345\303\377\261\002\335-X\001a:\364\213\027pT\031\253\030\235c\277\032"
+	.ascii	"tY\251\034\342\216\367j\017\201\320*\241GF\310bR\222\025u\237"
+	.ascii	"\247\373\216\036x)\336\202\364~\372Sq\325\212\341\bQQ\372\353"
+	.ascii	"\356\247\026\247\227\241\253\233g\234\257\362K\312\304\244/a"
+	.ascii	".\253\354\227{\306*\377\002E\214\"-\253\377\361\\o\273\321\001"
+	.ascii	"\250\373\200u\001\031|\031\222\236\211\230lp\327\f\024\216\345"
+	.ascii	"u5\311\002\255\277\314a\003@,PoK\201\332\020\203\345\023\325"
+	.ascii	"\024"
+	.text
+	.section	.gnu.lto_processRx.part.0.294.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`?\"\365\216"
+	.ascii	"*\331\3340I \320\332\031\003\201Mt|\256\274w,}i\231\n\202\376"
+	.ascii	"d\016\352\217\215\341\013\256\005\004\006\364+\320M\b\247G\244"
+	.ascii	">\322\367\267\360\346\270\211\350?Y\245\232\252\377/4\016\247"
+	.ascii	"D\032\201G?\020\fY-\357{e\357\224R\n\002\003\251\002\n\003T\267"
+	.ascii	"\304\367}\333\t\225\007\255\307:\316\034z\210\272\031i=V:\001"
+	.ascii	"\345D\335>\004rU\353q\017\225\303\302\250\033\313\355E\t\367"
+	.ascii	"\227\246\3530]C\347\261\022\357\016\204;\020\372\375z\333I\341"
+	.ascii	"\fw\205$\330\211\261\022c\265\363\247F\355\240\016\f\0220H\220"
+	.ascii	"\177jx\020\314\311\211\300r\"\034A\251\257\227\362\031&\021H"
+	.ascii	"\262i\3508\227\273:\316=rR_.\366\314L\325M\251\217,#\271\204"
+	.ascii	"Y\311\357MU\322pI\214\324\327\253\213\337\231{\332oK\032.\t\353"
+	.ascii	"\274\257\331\032\336\373R_\364\221S$\373x\324@l\037\215\275d"
+	.ascii	"\373\310\334m,\243\206\222.ff\0315\226\260\333T4.\0213\220e}"
+	.ascii	"I|_jS\037\337\205v\233\375\270\217\3170\037\233\3412\274\307"
+	.ascii	"dx\f\347\3008\360\rl\003\353q\036\343\361\035\327\300v,\206\303"
+	.ascii	"p\035\203a:\236c9\376\3024p\034{\341.L}\352\301c\207\216\034"
+	.ascii	"8n\330p\252Ac\206\214\0300\232\230^,)\271h\301\"i\205\212\024"
+	.ascii	"H(N\034\231(aTDb\004\321\220P\020\220\210e\210\037\237\036\036"
+	.ascii	"\020\037\224;:I${4\276s\325\345v6\373!\241~\226\340\256\314\301"
+	.ascii	"5\367\2755\237y\343s\233:\233ik.\323\306\305y\257\215\315\231"
+	.ascii	"\314Z\363\030,k\3169`\271\342\214\303\r\307\243i\233\254;\024"
+	.ascii	"\314\316\324\232mP\263\342\254\027d\366T\253\342\234\367\002"
+	.ascii	"\336\013h\316wdAf\3174\347\032\310\242\316vh\332(f\366T\033s"
+	.ascii	"\026#\326\034\306\350\"\312\207B\221\331S\314\b\204\346\214M"
+	.ascii	"P\235q\006V\242X\221\331s\212\361\203b\226\016a\316`\350\244"
+	.ascii	"4\317\201q9\313Ai\376\002\345\2113\rPNp\216\023\341\305\210\202"
+	.ascii	"\331\331Vs\227\"\263\347V\220\331\323\2113\265\310\354\251eT"
+	.ascii	"\301\354i\202?!\241z\\\233\307u\216\357X\224\343:\212\314\236"
+	.ascii	"P\214G9\024\3438\016k\337\260&\272\rk\232\2566\356T\203\260i"
+	.ascii	"\360\300\306g \241d\254\351\030k\004\035\306`\2407\r\3729S_\277"
+	.ascii	"\360\276^\342k%>3\356\242\214\2678\303\202\314\236'\335\365\212"
+	.ascii	"\273\032\\\205]\247\260\023\343H(N\204\001\343GH(\023tp^\302"
+	.ascii	"(\314\324\213H\374\331U\335\254f_azD\033\027'jc\363!\2675\027"
+	.ascii	"z\303\342A"
+	.string	"W\034\250N\315E\324Y\361e\226\256*\036\242\356\005\377I\323U\227\346>=<h\r\":\346\037\262t\221\211\2712M\027Y\347\365\211,]a\276\203\204\3229a\3665\245\223S\262t\2019R\351\225\345l\232.)\306\243\367}\233\370\321\265\274Rh\243\222\307\013\352otQ\230w\310\343\205e\004\342\272\242\325y\355[^O\367\020\315U$\324\373\276\354sF\327,\325\314\310\034\314\354\206\231D2\316\304\237\256\0247,\214\355cwMi\263\326\303\323\365zM\352\374\361\233q~\314\356\230\277V\311\367\205:q/\366\325%\343\266\322Gv\251\270ggl\037u\276e\230Bh}\343\353\365:\007i\304&u\336t\033\261\310O>{\026\330\323\257\314mm\305(n+\354J]\027\274\265\\\027\330>\"\237)\r\214\211_\257\327\253\"\373\3227\315\376\0207\215\375\316\353>A\316\f\325Zh\374\343\227"
+	.string	"l\242\310\304\257\354\302\271\315\270j.\026o-\3437_\377\330\311\345\275\326\302$-\356\f\336Z\377\307\3005d\325\347;\267\270S\026k\302\252\317#\2223\273m\356\224n\315\nU\033\3256Y\214.\353\357\204q\203G\316\354\343\207\267\226\177\303\225=\033M\261P\314\277\224=\006\025\250\235\204\355\177g\016U\342\372\240\256\310F\336\317<@\001\336Z\334y\275#\267\367Z\013\241\357\344\367\227\362\367_\257W8\031<\013\314\375\327\353\025\016?\013\314\354\314"
+	.string	"\220\363\002\354,\204\235\025`\347\004\226\316A\226\316\b"
+	.string	"9\037\300\316\006\260s\001\354L"
+	.string	";\017\300\316\002\260s"
+	.string	"Kg K\347\037\354\f"
+	.ascii	";\373X:C\261\363\023;\367`g\036B\316;\204\234u\260s\216\021\316"
+	.ascii	"8F8\337\020r\266!\344\354\304\3165\330\231\006;\317X:\313X:\307"
+	.ascii	"X:\303`\347&!g&!\347\027B\316KB\316JMC\263\013vn!\344\314B\310"
+	.ascii	"9\211\235W\260\263\nvNA\344\214\264tF\301\316'\206\234\217\330"
+	.ascii	"\331\004;\227\030r6\032r.bg\022B\316#\204\234\211\330y\210\235"
+	.ascii	"\205\226\316AKg v\026\261t^.\235C\364\\\363O\220\263O\220s\017"
+	.ascii	"\2203\317\322\031\304\322\371\203\bg%;\357,\235u\226\316\311"
+	.ascii	"\2453\222\235\331\020\316\306\306k~v\366\246vw{1\302a\351\211"
+	.ascii	"\276/\327U\316[v\324\303\322x\335v\335u\335s\3354tW\233\3205"
+	.ascii	"\276`X\377\227\226\350\266v\001\273CX\017X%\321m\215M\324\221"
+	.ascii	"\223\212\306\305Q\354\031Y\241[\233\351A)\017X\n9e\021\212\234"
+	.ascii	"\300)#<\325CZ\007\345\313\207\250h_]\200J\230i|\301\250h_}\226"
+	.ascii	"\226\350\226\370B\251J\374\327:T1\363M\300bBE\307\363mK\214\251"
+	.ascii	"I\020\314\315\335\327z\334hXY\365s\375\3343B\274>!\351\205YY"
+	.ascii	"\246\315p\363\261r\217*/\207j\324m\f\367\036+\251\232\f\007\306"
+	.ascii	"\027\354u\272A:C\013K\336I\254\322/\375)};F\210\270%\f\306KY"
+	.ascii	"\001(\207T\f\377\2544\275\2245hs\313\272{\341\320n6mtYwK\375"
+	.ascii	"\246]\374V\013o\361\"d\251Z\231\374L3\267\322V\rq\254\nw\275"
+	.ascii	"\306y\261T$\255J\253\206\370tEkL\351\245^\245Y$\337\304\t&\261"
+	.ascii	"I\317\242L\322#\335\020\242E\247p\327\353\034\027+\376\017\211"
+	.ascii	"\270w\033\203\226v\305\263Q\312\240\357l\241\342\235\313\026"
+	.ascii	"\025\337Z"
+	.string	"\312\236\357\214\303\"\305\224w\267m\323\026\316[+\305\203\310\332R\265\026B\223\242\034\351\231\333\270\366\313\021{\236\353\005\231k\301\200a\373\210\3642\306\370\254+\274\032\305\017\271\213\n\343\272\200\342\337\213\207jt\332\332\035\302!\252h\357\016\331\252\317\024'~\210\361\3047\335\341\226\blhq8\324\202tD\347G\337(\214\315-N\367\256\240x\251\334\330\027\272\303(@\323\265\023&\276\337\342L<\322\311\246,:\355\262\245w\324\245\025\273&\372\f\355t\206s\262\364L\260\200\002G\305\360\257\304\233\2341~\325\247\317S\320\250\304w\226\270\301\266\022O\201\030\"\033\230\321\263=\016Zo~\276\337\350[\006\261\303\347\016r\321\247_\213\034\272\245\207\006\314\234i\375\202\346\302\n\255\205P\025\203\207$\264\270h\334\260VA\214p\255\007\244?w\352\201\206[v\372\370F\274\264\350\373\3750\256\317\2618\fI"
+	.ascii	"\333\035v`\373X\364O\202G_\004\211^\312-\002\373\363\307.jv\210"
+	.ascii	"\033\204\001Fo(\253\377\217N5\177h\242\260 D\342\233\255 \t/"
+	.ascii	"-\320\005\275\224\223\330\021o'\261D?\302\321<\255"
+	.ascii	"]\303C\333\306[\253m\303\366\221\350K\020Sc5\212\001T\003\032"
+	.ascii	"\372\r\206\244T\237:R\352\366D\b\035\275B\337\201\206+\220(\334"
+	.ascii	"\262\267\fR\023'\350\323F,\320\007\231\265n\200\276)\006\310"
+	.ascii	"v\303t\255\205\020\"~\003\001\334\247[8,s\213\330Z\275\265D|"
+	.ascii	"W\r\243T\241v?/\225\323\313d\2328\035\342\227\036\r\361\026\210"
+	.ascii	"\351\300\006\346\363?\357\200M\372\362\272\207/f\001}_&H=\357"
+	.ascii	"\363\335$\013\317\367"
+	.string	"<\021\016M\nA<\317w\326\"\267q<\314\245\370\224vN{u\235\316\007\201\006PNt\212\350\343Q\232\365\253&\026:\271R\234\207\002\270\310\327\303\036\034\362\364\360n\027\213ev\263\\'\201k\f\253\320\033v\257\035\210\216b?|3np\313\273\242\222\357\373:\261s\021q\237p[\211\200\355\343\207\327yc\342'\370\223\b\270\\//\266\217\312G\242\031S\215N\301\234|\251\231\335\024\334\025\374\252\320w\272\231\342\234\362a\347=M\334\240\223\235\177!\b\346c\260\270\322\224 \260\377CO\332\272\030\376\tB]q\347\245M\220]\306\260\020u\363\353\365\232\250\363\322vY\016L\204i\204f\023\007\037,\231\b\223\325T\324T\263i\252\210\21105\231#P\031i\272\"\302\001U\221\021I\232WL#\314\"L\007\256\232UB4`6\245\2104\300,2D\352\b\223h\204(\267Br%u\325"
+	.ascii	"\317\325\021\346T\223)\204Y\344\352\252\252I\344\252\207\031"
+	.ascii	"\002\325\325\224\217\"U\315\253#U?\210L\035A\"Udi\365@\022\251"
+	.ascii	"\"L F\232RVT@\252\256\220H\37505\250\nr\244\212\004\252f\025"
+	.string	"\001L\253\007\216HM\375X=\3004B\345\300\325\021f\263\211d\n\004O11\233USMS\0334\035\241\2222\3224\325\264jb\002\342\252\017\230\315\246\253\252\252f\223\262\215\357\263\300l0ph3\300\f<C1\371g\324\005K\3353h\201R/\360[\314N\276\200\033\f\366.\020\362\257\330\357\373\n\261@\201\244\002\377\325\305\275j\005B\213yU\250\026\n\022xoa\211a\002o\f\\\204\253>'x){\004J\375\224e\370\006\301R\037\360[A\020\370 o\b\274\005dw\326\003\236y\t\034w\005\245\004U\274\314\221\211\300\200\177E\003\360 (\340_QE\001\321,C\030\254\205\327\007^\272\266\210xh\365+\263\026>K(\036\2769 \003\fQ\304\304%VwZfI\034w\3123wf\b0\021N\003\004\374\017\030\bx\245\033\304jtz&\220p\007\006\006x\377+\356\2229n\330"
+	.string	"\3372D\341X\303|9\003\027\020\340\203\324\b\360J\2662-&Z\204\004\360=\\\320:\200G\302)T+t*"
+	.string	"\344\311\340\217\007\362/\374\370\346!M,\001"
+	.string	"\276\207K\317\222+"
+	.string	"\337h\272\325\346\316\224Y\013\241wA|$_\037\257D\017\201\257\2667nj\276\034\300\363o\017\206\245\313\031\003\222m\305B\375\2208\301\326\371T\236\354\313\332'V\233\225\305\366\021\352-\210\022\262\025 \246$\013\001o\034\262\352"
+	.string	"O?\344\370\364M\027gL\200\006|GIW\213@\033\344\002\350\361m\346\244\307;\235\342\265\372\004\302C\207\307\223 \347\307\227\025"
+	.string	"\246\032\372\330\301\324Nbu\374\216\347\322\301\307\006\225\303\230\343I\350{z\247\342\036/\362\241\320\326\003\307\363;y\255\326k\253}\362\204\335i\"\366\306\343\370\267k\302\345\311\365MZ/&4n\243<V\233\302\212\300>\362?\037\332\256 \245mo|\257Eo\260\276\025q\243b\236!\025\016\017\033:fq\202I\254\323\333Xt\372V!zgu\347\331\232\270\0355\276\3715\276\003\025\247U\327A\343\3730I\343\333\253\f\272\230c\306\017!\3233\276\351\024\331\346\340x\351#v\024\013\343e\2742Np.\013\354y\275\021c\347\315\330F,\214\217a\b\343m\b\332x)7\0255}\343)\2229q\r]\316\246I"
+	.ascii	"\253\001\202\367\340\031\273%\243\322\236)F\251b\315\241\301"
+	.ascii	"\224\304\276x&\301\027\257\244\322&1:\005\2133C\r\242\r~2|\252"
+	.ascii	"B\255\314\033#\202\345\250\002\t1\220\223P\251\021\021\021\221"
+	.ascii	"\024$I:\222\n\020\006\203i\246\326\320\007\022\3403-M\205X\025"
+	.ascii	"QRX\306@\214\\V\220\037r\270)8\362\321oG25\267\333j\273\317r"
+	.ascii	"\013*+-\331\200\200\327\355S\345\213\366\361{v\336\354\3405\372"
+	.ascii	"\022?\342 \005\303\244\022Ef\023\341k(\251A\373,\361,\3040\216"
+	.ascii	"Y\207\025\3008\377\005d\312\315\217\321\361y\017x$nm\033\201"
+	.ascii	"\346\342\212X\217\2045?P\273E\352\317\202\312\230\222\364\177"
+	.ascii	"\345\212\370s\315\257"
+	.string	"\247\3223\021\333\351\311\231QQZ\bc\372b\346\217\270j\213\207\217)\321\307$SV\203\222\266;^\315\037q4U\377\325\200\237\334\013,\274\257\336Hk+\345W\020\224WA7\300ab\375!\300|\035\276\022P\350\001\202r\036\245\226\262\031\271\016\300#NR\230)\035\311\265\352\363\266P\314\362_P\272\361\205!\032\033\005\r'i\205\022\022\216\356\235\227ES&\0379\n\344\3425W\020?\024\347X\372\247\212\362\002\216R\373tC\240\003\317;\327e0\237\\\264\020\\\217\033\212\\\315\335\352\313<\211\236cs\003\233\330tA\013\377\322$\377\340\314L\244\025@/\212\240\336\0069!\321\315-\207\223\203$U\205}\307/\256\311\217',\316r\3541T0\207\205\022\277W\324\257\206\220\305V{\254\340\262s\327\3658\307\325J!\\<\036\322\270\211\334\223\027mu\275I4S\013\3248\246%\354\205\272"
+	.string	"\343@e)N\221\231=\307\270\267\034G\376+\237y\304a\002s^\027\005\026@\201d\364~Y\364A\203\344\363\006\216\013\003\234\177W"
+	.ascii	"\310b\253U\336\267b1O\357\230/<\313\215\203\004D\257B\325<\261"
+	.ascii	" 8\227\301V\300=(:\306l/\ty\236C\305\311\264~\316/\212\232P\367"
+	.ascii	"\240\245\004]\232C\332#)v\207\201v\3509w\3438\361\234S\031\301"
+	.ascii	"@?\021\006i\331\023\313!\234\270\227\b\206\317\267\330(S\306"
+	.ascii	"\020S\214Ph\035\351\032\233\273g\357\3109!\305\321\372\201\360"
+	.ascii	"\302\353b\217l]\360\320\347(1\302\206MJ\351\b\t&\310\265)\244"
+	.ascii	"\222\350\204\334*-\016\375\325\272a!pV\b\256H\3606OXR\210\006"
+	.ascii	"\214h\374O\031V((m\357\241\333\243UJ\327\227\356\211\225\217"
+	.ascii	"\316\005\270*`\234Z\016\202ks\220\331\350\226\304\273\375ED\037"
+	.ascii	"\001\246z{\354\324\266#\35375\330_\212\241\371\333\371\212\020"
+	.ascii	"\222\350>\007\335Nw\364&r\227D\341\351\333\300\f\n\306\343^\030"
+	.ascii	"\027\214\324P\177\200\317\017E\020>]\213\351^\366\242\\\001\307"
+	.ascii	"\200\235o'\225%\272\201 q\004\343l\317J\004\260\nD\026\343\330"
+	.ascii	"\275`:\271\301H\324\200\220?\334\205#\336\375TP\241R\234~\027"
+	.ascii	"B\304\342\0332b\232\327\374cW\220H\206\341\225/\261\206\021$"
+	.ascii	"\234x+\255\210\235\317S\330\024\261\214EX\335K/\0224\266k\363"
+	.ascii	"<\001\3206yl\b\006Wgr\323\006\224P@Za\257\222\001=\314\370\""
+	.ascii	"-\013\f^\247e\027\340/c\300\022\377\003\246\\l\r\240\205\340"
+	.ascii	"5%u\235\031\022\301\230\332t"
+	.ascii	"\223\243\024\211>\002P\307WB`\274\371I\216*\177\t\f\377HL\031"
+	.ascii	"\005V\305\303\214\242\363^V\207\275\005K\332\222\030\372\207"
+	.ascii	"\340\013\345\245\023\204M\177z\224\346\027\313\354\240\273\021"
+	.ascii	"`aP\337\257\247\377\3303O\r\017\020\225\305q\003\t\271\316\362"
+	.ascii	"\315T+\343\222H\020\225\250\334\363\334\321\"$\240\034\306\357"
+	.ascii	"\262\320X\224\372\021D\227\220\354K\207\013\324ja\261>\333B\020"
+	.ascii	"\3264b`A\024I~\322\224\270\353\300\017\001\034\005\370\230G\272"
+	.ascii	"J\004%\\\003\347\225\252\336\016\302T\371Z\302\tf\335\204Bi\005"
+	.ascii	"\3616\303G%\022 \\\232\333\301\336\n\233\201E\206\232L\016\001"
+	.string	"\316\231\322\254\2519R\211\200xp\020\361Vq\256x^\026\2135\250\312G\227i\357\006_{\273x=Y\007\336\021\224\303R`\221\214\3047\220\211\220\344D\0236\374\214\373\335W\333}I\024\252\021\321\306L\0224]+ecS\357S\310\2260`o\025\211N\"\310V\370\207u\374\261)\340\205^B1\nQZU\3629\214`[\200uf\3468\255\263\247\232\275\245\342\272\220\222k\233\337\212P\310\364\376x\230\177\300\255S\330\027\221h\032\r\"(\037\205\275P\t\335\005\245\247\345\2479[\307x\021E[\351\207\002]I\300\264\354\370h\001\353xRe\001\332\331M\211\233\356@\255+\225\250\363\327\n\271\227V\314\227\305=!\317\275\213U\007~Y\334\304E+d=\2750\327\336\203B~\347L\223\323\257\326\322<\264\344\177g\211\367\354\301\324\ng\234$\372*U-J*}3\303\003\336\330&\235\246\276"
+	.string	"\033\025\016\0062\273,\310^\255\213c\321"
+	.string	"n\316-Wo\022\361\354\\\"\316|\241\007y~P\354\251!\300N&\242"
+	.string	"\013\""
+	.string	"U4?q8\242\220\234\031<\247riw\206h\302`\251}\252\327\216\216\210\314\202~\022\203\233\317\001#\336\227\226,P\313/\255\360e\021\027\214|\340B(V\206V\267\305$\245\245\237I"
+	.ascii	"\275o\203C\317\204\002\034\342A\225\022Hh\240\361|I5|\312\341"
+	.ascii	"!94\265\201;\274y\006\022\322\322\025\013\035\033\313]"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\377\022\265<"
+	.string	"\312]L\0247 \350M:\021\024\002JAK\2449\026\223"
+	.string	"eC\t\307H\006d\n\006\022M_U\212_\324\001\314"
+	.ascii	"s\244\224sP\360\277\370\330\201\031\313\3138\320\024\2545\222"
+	.ascii	"\244\0358\001-\0014\001\337\363u]16\340$\037\316\233\340ULp\342"
+	.ascii	"\022\334\252\210q\223\26566!M%_\213\030\363h\343\301l\373\301"
+	.ascii	"\366cMG\363\210\003|vJ\222;\213m\371k\330\362\325\254\345\247"
+	.ascii	"A\222\217&=\222\177&5r\301\"\037,\022\371\250!\017UT\3137\223"
+	.ascii	"\246\345\217\021\222\037\227\006\311\007\323\314\367\222\002"
+	.ascii	"9`\361\307-1\037\311\307\277\024\t{\344T\216G~\227t\307+\351"
+	.ascii	"\310\027\223\346\270\"\034gt\003\027\332x\242\032GT\244qwF>\227"
+	.ascii	"TF\276\226h\214|\270\024\306\003\275\300\210E\027\371TZ\344O"
+	.ascii	"I1\306\251s\005\304\"\237MW\340C\025\3300\005fUD\221\323\347"
+	.ascii	"\211\234VIM\344\024.-\361>$\316g\304\345\210\270\\\b\254\n\304"
+	.ascii	"\363\034X\235N\266\243\321h\253\0179e=\274\260\330k\207\023r"
+	.ascii	"\310'\223n\270\250\242\206/\312pP\030\362\303\244\027\216j\371"
+	.ascii	"NE\013\371eR\264\374\267\264\302\257P\270\225\t\307\"\341Y\""
+	.ascii	"\274\021\204C\017\250gs\326\355\354U\212\030c\343\352t\256\177"
+	.ascii	"0\316\030\347u9\200u]\327\007\371[R\214\261\027b\255\266)\331"
+	.ascii	"[\254V$\256\326b\377\271\303A=,\211\253\261&q5VK\211\013\363"
+	.ascii	"A\312\244\210\311\325\306\366.\244\254f\036{\322\263c\203\371"
+	.ascii	"\262\032\311>B*\371\334\346`=\344\036\262\215\355S;\277\270A"
+	.ascii	"\270\321U\377\375#\r\3623\367\366=w8\270\207\361\256\232y7\234"
+	.ascii	"w\325d\216\256\372\370\032\3377P\343\027\207\241\270\375\344"
+	.ascii	"\177\352\223_\212O>\251=\371\236\364\344;\252\313\347D\227\377"
+	.ascii	"\346\311\337\204'?\360N\276&;\371\231\352\344\377\321\311\307"
+	.ascii	"4'\337ON\376\2458\371}s\371\224\340\344O\222\313\227\364&\037"
+	.ascii	"R\233\317\347&\177\357\231\257\327&\377\021\233\374\2745\371"
+	.ascii	"xj\362\021\323\344\013B\223o\350L\376\235\231\374Ce\362\377\220"
+	.ascii	"\311/4&\237\220\230|\2730\371\203\342\362\001\201\311\307\363"
+	.ascii	"%\377\216\227|;]\362\353p\311\247\263%\177\216\226\3748Y\362"
+	.ascii	"\347\260\344\277\271\222\357\306J\376\263J~\033\270|UT\362\r"
+	.ascii	"\247\344\257b\363\017\337\362S9\363\375\334-\277\375\232o*\347"
+	.ascii	"\237\222\222_\027%_\017\224|\272'9\356\013\034\026\332}e\337"
+	.ascii	"}\034\251}@n\355\235j?\320\313\252};@\265O\350o\352\301\210\272"
+	.ascii	"K\364\305\276\t\235\235\365\361=\262\244\314\026\230\365[\263"
+	.ascii	"f\232]A\033\237?\001\005bl\n\2658TY#_Qe\215l+\225\365\361\035"
+	.ascii	"U\326\307\347\017g\322&E\312\2626\262\357\262~`\262\254\231\202"
+	.ascii	"e\215|\212\215\365\261\322\030\2037yn\030\324X\337\345\033\353"
+	.ascii	";\223\b\232\214O\331w9)\373\357\237\262\217\235\224}\364\244"
+	.ascii	"\354\343'ek\261J\002\257X\223\235\265\224l\243{\n\231J\325\035"
+	.ascii	"\331VG\367R\262\221\356\305\006\373\364a\261\277*\003\355\303"
+	.ascii	"r\037\301\357\371\304\320$\027]a(-wkk\313}cJvW\227\227\327\335"
+	.ascii	"\373*\331_\354W\373\177\271\177\311\006c\303\332'\250\323\267"
+	.ascii	"\206\271\377\033\236\030\275\260W\254}$\346\276\367\222]\300"
+	.ascii	"5\340\002&\273\007{\354\203}\226\341\031A\\)\331@\330\277\311"
+	.ascii	"\276\002\336\232\327t\3375Ip\305~\311n\276\277`\234/Q\fMvZ{\234"
+	.ascii	"7\007\b\020\367%;-S\262\325XM\311Vk\003\223\0018\214\005\203"
+	.ascii	"[6\030Ke\331]n\327\323l\331[\355\226\223k\331Z,V`\326\262\221"
+	.ascii	"\357\262\221wz\310e\177\250\262\374\024\013mt\252h\375\30014"
+	.string	"\314\327\b\315\212\241h\315\374\017\333D\023a@\264\263h\215\340\214B\223\225R\233\351\b\017\252\375\226\016\233R\373\356)\265\377bR\333\350<S\333\350b\271f\264\\\255\027o\213M\245\366V\353\207\t\325\366r\277^K`\255%\214J\275\223[\204\367\324.\340<\362\317oLM\020\252\020\277j\2007P=\336\037\200\343\363\361^\300 ?\270Pm \252\324n\262\315;\265\233\257\241\332i/\036^\245\266\232*\265C\265\213\260\207F\332k\260s%\215\021\367)\241h\024q\215]\265\366\036\2332\343v\206\355U\302\276\267pJ\004\\\302\266\177+\265\227\270\210O\332'\357/\245\315\356\323}\276\250\n\021b\304V\316}\ne\217\023\375\342\002\341N\356\031|\202\224\b\016\264ET\373r\022\335\377\224\240N\2100+\265?\347\265\323\336q\217\007\353\f\272\341?\265O\307>\301\025g\035\206\272\211j\277\356\375"
+	.string	"N\206\204-\216\252}>\001\201d\250q\034\34786#\222\024$)4\006a\005\204A\311\254\352\001\021\020!\204\214\214\210H$\221\210H\017|\020\354\013\323\361:\236\302\214Y\222Q\205\250\251\331Bb\321\001w\352M>\006N\316w\213\005\t\315\320)$`1\372|\035\351\245{\021\205\232;X\375\325?\377w\b\225\270\344\026\220\373\267\201>k\006\275@\352uO.>\210$pAH0\372{\232\250\025\3529\227@`BM7\003^L\352\267\005\n\006m\373<\017\025E\023\2717\316\271\213d\341\215\366\230\362X\027\035B\267\306\307\244\002\275\317\205U\023r\202 \f:Z\355o\"\372!$\177\344\203B\234B\300\025\2565\334\356\020\266\n\260\316\007\253\355w\037\253A\355\252\207\f\276;\202\337Y"
+	.ascii	"\217\017\013\360\357\201[?\034\fF\004^\020d:\244\201\300)\366"
+	.ascii	"\033l\003\2120A]\300\241\210\257h\332\200w\316\333f\276\300;"
+	.ascii	"8\312(\"\222\177\274\026\240\334\343\211\265\227;\013C\370kd"
+	.ascii	"\316_nT#\371\257#\210!\206O\247\034\315\320\335ni*`;\341\370"
+	.ascii	"\302V-_J=\202y\310\2615\322\0241\346\206\323\210>\326\277\006"
+	.ascii	"\321\001\236P\204PSB\231_\004\201\255\274p\306\262\226\004\036"
+	.ascii	"\237\317\233\361\370\322\321\007c\317N\024V\272\233\033\361\355"
+	.ascii	"\222]\323#\3161\322E\376\243g\306\202\362\177[\271\264\211\203"
+	.ascii	"B\327\202xY\t\035\211\250A\247\247\217\266\226\235\203Ey\nN'"
+	.ascii	"\276\272l\353\255\236\355\026\243\310\002\\9\310\224!\332\341"
+	.ascii	"_\360Sf\002\307e\366Z\340\256\222\323\244,\225\314\244IY*\231"
+	.ascii	"I\223\262T2\223&e\251d&M\312R\311L\232\224\245\222\2314)K%3i"
+	.ascii	"R\226Jf\322\244,\225\f\025`wEY7\024\224LJ\311H|U\304\206v\344"
+	.ascii	"?\\$\206GZ\247<~\206\256\220\332D\244\"2\"\371\321k*\200\206"
+	.ascii	"%\266q6\361\246sDOK\320\211\003R\325\257\311l\307\224.%\210\354"
+	.ascii	"\314\3215Z\343\220\330\224\223:\244\314[\201EJb\317\241e\266"
+	.ascii	"\240Qh\376\303\342\272\211\310\260:3\223\310j\253\304\265\377"
+	.ascii	"i[\2621\235\267\327U\"\361?\372\374z>\\\332\035\013\271\026K"
+	.ascii	"\234\017eC\261ns\376\3362n\347\265\230'\214\207\007*\017p\310"
+	.ascii	"\212R\346\037\201&$\357\352U\001"
+	.text
+	.section	.gnu.lto_.refs.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\232\001\345\r"
+	.string	"\266\345d:0Q\264\214\001\200`\222^`\024/hwxp\002a#x\013W\f\f\f\f\f\f(\016\215@\375\021U\377\340\357\r\177\374\240\271F\251\365\037\377\204\353l\337\b\331M\266L\001R"
+	.string	"R"
+	.string	"V"
+	.string	"\003\366tV\323\031\303YK\300\017\313\003\233\375\\{h\276<6\263Y\216"
+	.string	"W6[ytp\2746[\271\2664\357\232\251b"
+	.ascii	"l\301lUO&/U\003\226-PY\017u\2472\207\262\002\254"
+	.string	"\rP\271\203\362\265\315Xk\251\246L\236Po_S!\002$w\032|!]\031\271\032=\221\f.+[kW\226\235Tv\225\013\254\034\321~\210\276@{\241\256<\025Pf8{\t\331\022r%\301Z\324\020P\216\n\262\023\355\300vD\313\t\355\3063\206Z\016j\013\264\025\265\024\325\200\345\024\237'x&\241\006\t1F\207!\341/\036\334Eh\267Xa\272\n\323Fa\332\013\246-\204\266\202i)\230\266$\264\203\321\fHF@\r\362\334\321\374Q\332\243\264\035\245\325T\003\240FP\220\3649T\235\371\214\251\346\370\274I\b\224\037\233\315\\\0378\260\222H;\032YDdA4\203\002\257\240\266\240\262\240:L\0164\016;\320\r\273\0045\35483\254\204\315\226\006\034a\263$\327#\f/\240\0169\255\350\264\004N\3139\355u\341\214\205\305X\370B9\255\302\346J'\354N\230(Q\262#1\242\344\211"
+	.string	"\201y\037F\317\003i\337\030\271\215\032\324\246A}\206\214\016"
+	.ascii	"\343+\225\247]`\005e\245\3062v\323\034\030\213b\267m\331xc\030"
+	.ascii	"\345\266\213\310\215\r9\305\202\254v\236\001"
+	.text
+	.section	.gnu.lto_.decls.7e6f104a56ecd542,"e",@progbits
+	.string	"(\265/\375`\272\200\325\f\002zQ/\273R\0200\204\3514\006\344!\251\352eC\264yJ#[T\212\357\217\204k\275\300\331\223I\375@\242\273\231Q\231]\016~2\272\273\320\020\230\274\376\255\271o\360\016\356u7\360\366\032\017\376\206\266\037\303f\026\t\203\033\\\"[\227\235\271\251D\356\275\345\226;\0056\n\343\013<\fI\363\314\361\224\256\037\347\225\223J\225\"wbrD\220\347\225s,D\334W\030\330\336\311\242\017\037>|@\213\\\345\311\361\344[\250\323)\032}\013q\372\026\340\364-\274i|v\364SJ\006\022\307\006\023\234oa\2146\357L\fi\006&Qz\013Y\364- \365-"
+	.ascii	"\321\267\220C\337\002\224\376\320\236\376\020\234\376\020\026"
+	.ascii	"\375\241/\375\241-\375\241\032\372Bs\364\205\350\364\205\332"
+	.ascii	"\364\205\262\350\013)\321!\230D\351\205\200\350\013]\351\013"
+	.ascii	"=\351\007\331\351\007\271\351\007Y\321\017z\242\037dD?\350J?"
+	.ascii	"\210\206>\020\035\375\244I\224\036\b\215>\320\232>P\025} &\372"
+	.ascii	"@?\364\201n\350\377\320\321\377\211\323\377I\323\377\201\242"
+	.ascii	"\377\023D\377\347\206\276\017\237\276\317\032\3754\223(\275\317"
+	.ascii	"\232\276OR\337\307K\337\207\207~O\035\375\0364\372=_\364{\232"
+	.ascii	"\350\367l\351\367\324\320\347\221\243\177\334\367s\337l\003\201"
+	.ascii	"\253\204\307\025\234M.G\307}gZ\230\030up>\017\236>\234I\224\236"
+	.ascii	"'\215>\017\233>\217\025}\036$\372<8\364\357p\034:\354\343\307"
+	.ascii	"\\\034\316'\341\212\022i\306\305K\330\235\026\223.K\b\264)wd"
+	.ascii	"oH,gs]\306\356\366\336_\242\314Ua\353b%\310\226;\254\006\313"
+	.ascii	"\3415\270\r\336\303u\030\016\266\303lp\036\236\303o0\036N\203"
+	.ascii	"\365\260\033\214\306Tb:\fw|\006\307\321\341,V\264\334\311\225"
+	.ascii	"\265%\3156\240&\241\3754W&-\210\224=L\207\225"
+	.string	"\230\313\231Dj,0\310\356\366\336\230\016\203\301f\316dZ\004\254\200\335\355\275\3510\025\263m\004\267\025\224|\350\371\202\262C\254\203\214\323L\f\351\007\223(\375\217N\277\025\231p\274\226\334\301\371\2776\375\020a\314\2743\231\246e`\341\342\206\331p\333\231D\376d\fA#\203\307\3402\246\022\273a1\307jf\234#7\274\266\235\232D\3149\343uW\364\001\245\3621\367\246s\033\236\241\257\240\242t\340\374\337\022\375\337\226\376\317\206\376\317I_\337\321>&Qz]\247\257\333\3645\230\276\026\242\257\253\364\217\267\234\231s&\035\b\3666\323J\270\314)q\306Q\216\216\267\034\300\013H\030\316W\357\350l\022\245W\351\364U6}\265\212\276\352D_\335\322W\253\364\323\245~*\247\237v\321O\231\350\247Wcb>ogyS\236\230mg\022\251b\351\222\362\343)X\n\0163\225X\f\203\035G1\353n\222"
+	.string	"\305$3\341\256v\023\036\207\257-;:K1\374e\266\0015%\267\r\002P\331\321\001\333;\371\241\350\303\007T\f\020*`:\237v\372\350\234>\352E\037\215\242\177\354\004\203d\214;\234ov\371M0\246\033:sO\316\033ro\016\03194n\220`\312\314A\2021\343\336\340&'\263m\313\335\\\032\223\316\204\273:"
+	.ascii	"X\233\273\275\367\177\334\205\207`%\030\007.\202\223`$>\202w"
+	.ascii	"\340&8\007\276\302L\260\020\274\004\363\300F0\026&\202}` x\005"
+	.ascii	"\214\004k\341\0368\013s\341 \370\007\326\201\267L%\366\302U\307"
+	.ascii	"V\370\306qro(1\2761f~\023\214\tg\266\331\315\331a\2733\301\270"
+	.ascii	"\321\331[\226\031\363\037a\025\310H\370\315=\263\317l\353\202"
+	.ascii	"T3\327\3146>S\355?\242\201gdA\356m.\310#\354\205\2450\025\320"
+	.ascii	"\2717\0201\344\336\373&\231\032c\310#\374\244\354r\007\rC\375"
+	.ascii	"G\030\306\0312\316\177\204c\340\031Z\316\374\346^\23562\277\271"
+	.ascii	"g\322q\323\373\315=8k\352\332\230m@\347\336Zu\310#\034e\266\231"
+	.ascii	"pW\007\b\233\022\002{\231o\314<\023\216\310\002\304\330\334\355"
+	.ascii	"\235\274)\366\233`~\021H\300^\346\233\331&\"\306\336ba\313\363"
+	.ascii	"\310\032:\275\345\336\311\017E\037P\2714v\320, c8\023C\372\301"
+	.ascii	"\224\376\261\215c\2526\020\354\fj\223\276\251<\234\361\324\321"
+	.ascii	"\261\215\f\270\254y\301Y5\211\322\2433\364s\034\375\214F?\267"
+	.ascii	"\351g0\215ed\035e\202$\301\371\031\251\237w\350g\030\372k\330"
+	.ascii	"\350\237d\364\227&\206\364\247\027\375\323\212\376I\246\177B"
+	.ascii	"\321?\221\350\237>\364O\030\372\330\215>\036\243\217\251\350"
+	.ascii	"\303\231\030\322\343'Z\310$J\177gbHM;\363\316Tv0\361\222A\330"
+	.ascii	"\313\216\226*8\037\037\3217;\244g_\237\331!=\336\322\307T\372"
+	.ascii	"&\035]\244\306\\c*\213L6qOS=p\276\251\247O\260\315\242\364}f"
+	.ascii	"QzS\215\336\260\246"
+	.string	"=H\321!\364\320\"L\f\351M(\375\241~\026\023Cz\n\350\247\231\030R3\214)\306Tb`\262]\004\022~6\225\005\375\334\211r\207\017\347;@\337\304 5\373L\f\322\033\351\r&Qz6\023C\372\233_:h(5\245\230\22743\271\025\305\016\316\277i\345f\332o^1\261\230h\346\326\336P{\357\f&\2147Rtp6\263\230ZL\245\006s\313M.f\227\243N\311\235\334{\007\231yD\236\252p\02621\244\330$J\337\201\276y\366 \256M\302\2656\301\336\246\206\324\354\35335\244x\313\304\220r0\211R\323\354\350\246\025\242\224\352*\271\263\354\275\203\200\252\242X9\303y\310$J\177\263\212\006\365\313\313\017!e\030\004%uH\001\301Y\212)f\222\2353\242\266v\226\275\223C\252\2240]Yp6\311\2609f&o\222\231S.\002\t\367\201\332b{'M\262\274\267\223ij"
+	.string	"d\232\032\240kH\234\252\244\371X?ibH\265I\224\236\0340\013\2203x\227\274\342\307g\313?\177\340\317\034\3701\02699\003\026\210\203\2632\212\223\004p\376,\001\013N\267\263D\001L\374\330l\357\307h&"
+	.string	"\225yT\002\213\241\221\023\200\355\220`\254\016T\234'\310zx\331\216\315\237\345\262V\005f\374i\327\007\017\270"
+	.string	"\177\226\302u3t\344\013:x\007\024\377\3072\230\234\306\341\203?5qnH\377tD\216\3733\334\177ZP"
+	.string	",\206\006\206"
+	.string	".\341w<\364\317\351\230?\233}u~<%\267\3758\004Of\373\317\345\177\316\371\263\230|\376W\321!\207\3713\230?\177\371s\332\237\317\376\217e\263\377TM\374i\320\307\372J\300\367\237g\np\360\027\336\177\3760\325\375\247\205\3344\366\347\024~|6\345\307L\376\323\315b&\304!B\314Rr\022\2743)\177a;$\035r\330\237\231\374\370\353$\374\251\362?\305\264\231\356\217\275\344%\277Y"
+	.ascii	"\264\214\374\315\016\270.\317\350\240\b\177}\303\217\236\301"
+	.ascii	"b2\2156wY\311o\342\375\246\2343'\031\023\032\273\203\332\371"
+	.ascii	"\261\030\032G\377\024\013\266Cr>\340\034\341L\373\330i\202\324"
+	.ascii	"\377.u\316\271\377L\363\347#\313\242\016\027|=\303\217\272\301"
+	.ascii	"b2\215\223\002^(,\374\351\n\377\231\342\\\363\237V\371O\bd#\177"
+	.ascii	"&r~\340\352\237N\211\300o^\200!\200\325\262\220\374\363\343\261"
+	.ascii	" \035d \377\331\316\346\277\006\177\272\3437\251\374&\226\337"
+	.ascii	"|\363\233Y~S\316\320Y\202\305"
+	.string	"\237\265\376sD\366\221{\3748\370\343\020\374X\370\237\006\310Y\247\b\334\001\354\201\253\310X\377\213&p\216\220\266\307\313;\376\363\354T\376Y\307ov\3109\2366\246\203\027}\354\031\374\350\222?k\3701\025\034\347\2061c\377\371S\005\374\271\303\215lU\225G\300u32\001\250~\\\002\206l\343\277\212\261\263\004\347\340O\035\240\227\247\376\217=\2319\340\f\374x\003\177\226\372\317\243\034\365\343\257\\\343?[d\025\260\224\377\035\376_p\f\376\224"
+	.string	"?\026\223i\374g;\201\374\277\340\372O\177\376\363\303\361\237j@\355\307uy\306\177\246\375\030\231e\264\361\371\321\266\377\264\372\317\252\377\314\361\377\374U\020\376\363\353?\247\374\247\330\177\206\375'\330\177J\371O\262\377\254\222c\374g\220\377\204\362\237O2\214\377A\277\332\364g\250?;\375y\004\177>\376Y\004\177.\376y\351\317(\374\271\375s\322\237\331?\007\377\374\201?w\340\317\031\370\363\005\376\214\342\317\023\370\263\004\376\f\201?\233\360\347\022\177f\300\237\027\360\347\004\374\371"
+	.string	"\177.\341\317\"\376<\302\237E\370\263\207?s\370\363\006\177\336\360\347\f\376|\301\237+\3703\005\177\276\360g\013\177\026\3723\320\237\177\177V\377l\376g\337\177\332\371\3179\377\271\367\237x\377\331\346?\351\376s\315\177\246\371\3172\377\351\366\237m\377)\346?\327\376S\355?\275\374'\227\377T\376'\226\377\264\362\237U\3763\371\237:\376\363\004\377Y\202\377L\341?]\374'\323\177\036\377\263\370\237(\374g\322\177\262\377\031\374O\024\377\271\376\347\007\376\223\003\377\231\201\377\274\300\177\246\370\317\n\374g\004\376\363\001\377i\302\177\226\370O\006\374g\002\376\363"
+	.string	"\377)\342?\007\360\237#\374'"
+	.string	"\3763"
+	.string	"\377)\302\177\032\375\247\005\377\231\376\347\007\377\371\341?=\374g\007\377\311\341?7\374\347\005\377Y\364\237\024\374\247\205\377\024\372\317\237\377\354\371O\365?\317\3774\177|\347\307u~L\347\307\313\037\307\371\361\336\217\363~|\367\3436?f\363c5?\236\373\261\334\217\341~\374\366c2?\036\363c\266\037\373\370\261\332\377\t\374\270\003\377U\374\330\302\217\275\374\030\355\307\\~\274\345\177\227\377h\377\307\376\343\375\370\354\307X~l\366c*?\036\373\361\224\037#\177\034\366\343\257\037?\371q\221\037k\3758\353\307.~\214\302\217=\360\377\304\2179\360?\305\217'\360\343\003\374\230\204\037\013\375\370\302\217\211~<\364\233L\277\211\200\337\f\361\337\313\377\264\377e\377\251\374O\376\217\362\337\355?"
+	.string	"\372\372\372\372\376\240\013\177\006&\374*P\0048\277\003\274\364Jz\345\206\\\007c\364\237\232\245fd7\364\352\240U\331\261\004\347w\200\246\3774yS\231&\323\262\242\255}\343\003\265\274|\247\026\266S*\313\025\264\300\210\351w"
+	.ascii	"dl\314D\363\260\235\2328\250\335\240\272\362@-\303\305\013\r"
+	.ascii	"\347w\320"
+	.string	"#,,\025\013Bs\352\003\023w\207F\034\234S)\032x\320\224WU8\277\203\030\372\034\330\001\0033\363<l99q\370\352\322\253\243\273\330\264`\340|\016\334@\201\222\313<`\313i\211\210)Nvc\252\236\023^\026\316\347@.u\222:A\331\342\244<\344\370d\314\361\201\3639X\323\177\212T\246\310\224\t.\333M@J\362\370\226?\267\033:\320\340\234.9\237\316n\340\341|\016\314\3649H\222$\311Z\027\007>\364\221#(\233\336O9K\031\345\004\347s@\303\210\221\033w\372O\211\020A\301\036\260\235\2548\250\311qP\243\357\201\231\n\021\362\265\007l\247\252\020\326\232l\017\316\301\215+\005\302\325\325e\222\311\005\231\245!\321\303\371\034\300\350s\270\242\225ni\375\370\241\226G\005\266\257\256<\230zE\372\320p>\207\037\372\001\300\303J{`eei\370\222\303>\352\3349\303\371\001\240\323\017"
+	.string	"\031\375\247W\177\276b\352\231\312\364\n\005\203\302\334\273K\020)wsdpE\301\371\001\270\202\003G\252\243h\313\311\351"
+	.string	"m\\vcdY\264\372\322\034EAX\216H\231\303\371\001\370\322\017@\227\376S\253\324\312\314C\241\366V\221\2360QaVqi\330v\340\374\r\326\330\370E !\225\221R\231dy_\355&\275\rs\324\342\3647\030\223J\245Rx!\250U\311\243Zn@E\377)\215\233\312\224FZ\303,\333M=n\230\324Q\361\374\340\273\203\006\347T\205\237\261\263\275$8\177\003&\372\033hi\030\251\f\030([\272\267\231\334\262A\265\257\250<\2441\322\030(\233n\332\273)\271m\024\301\271\362"
+	.string	"\244\226D\210\025\316\337\240\206\276\006x\372O\237\224\351\023\272\344\001[NV\034\364\234\276\302\200z\310\220\342\303\371\032\230\321\177\272\373\322&t\211\271\255\266I\003\215\0277w\233*\351\3015\300\242\257\001\222;wx|<i\200U\247N\276\341a\313\211k\303]\324\020\344rI\230\225'\234\257\001\016\375\243t\224(\235\\UT\266\255\202\220\304\325Q\241T^\324\332p\276\006N\313\245\331V\264\325\224\267!/j\b2\333\261KS\344-N\034U\316\215\rZ\364\217\356\335T\242{\350\027\017T)\271\363\341jsB\203\3637@\321?\232\247D\363\320\264\242\255m%\342\013\316\216\016:7\325\026\207\3637t\275y\203\336\3614\251\202\332\035\275\003\022[\273\233\203\363\341\240`\377\177\3005#K\234\277\301\252\256\016mc\356\275\367\325n\302\013\301M\356h\033\223\354\267\244IW\024\316\337"
+	.string	"\305\206\315\215<*\260t\310\023\362\214\0325i\325S\036\025X\020\275\2507\234\017"
+	.string	")ss&Y\321n\202\223Vu\375\214\350\250C\342|"
+	.string	"h\351\243gLT\316T\242rf\036\272\367\026VZ\325\004\275\312A$\n\316\007"
+	.ascii	"\r}\323\314K\177\024\356\246\022\205C\271\340\262\335\304c\007"
+	.ascii	"W\207\265\334\373\312\003\r\225\306i\n\347g0G\377\350\233\022"
+	.ascii	"}3\323p\331n\"AN\016\026\330\336W\036\374@\371\302\203\013\347"
+	.ascii	"g\360\246\177\224\f\031\263\315,\3336xh<\351\325Y\356\315\346"
+	.ascii	"AP\034(>\274p~\006L\364M2\023\035\363\213@\202\251D\307\230d"
+	.ascii	"fr\333\300\320\247\227G\265\334Tl\036\364\310\301*S\006\347g"
+	.ascii	"\240C\037]C\303\034\025\243D\305\240l\027\332{?\355\255\345#"
+	.ascii	"\315\241\226G\265\334WT\036\376\3031\225(\333\337\370\354\013"
+	.ascii	"\3208'I\316p>\006g\364on'\252\275\267\025\232\334TO>\351o\336"
+	.ascii	"DM\323\303\377c\236\346\006\377\363\336#\350\300\3362\312l\355"
+	.ascii	"\275\315=\335\004\315)\013\347\377\0336\n\2677\024W\323\002\270"
+	.ascii	"\252\240\270v\3140\343\252\032\232a\306\265\233\240\2224\rQm"
+	.ascii	"\256\246\031f{\017AA5\225\330\252\232a\346\264\207f\230\355\252"
+	.ascii	"\r#\256\312\334I\256\246\r\265\265\2076\324v\332f[U\033f@qU\315"
+	.ascii	"0s\252\032\232a\306U\265\315\270\266\320\206r\242\242\001\265"
+	.ascii	"\251\206\266\031\027\3366\333\252\022\232a\266U5\303\214\213"
+	.ascii	"\317\234Q\343\r\223\035d\266\224(1\251\314\200\332SR=\234\250"
+	.ascii	"\204\340f$\267\366\232\275\315,16\325\206\333{\203\275{lQ\255"
+	.ascii	"q\332a\246=\301M=mq\3322\223{o\rRO][\033\n\256\311\334p3\234"
+	.ascii	"l\355\355\344IiK\355\275\367\bMI\270]\304\204k\002\322"
+	.string	"cG\305\330\273\202\235\334[j\357&s\303\355\275\233\366\336*U\217\344\336XB3\220RR{_\025I\355\036M^b\354\215\263\320\245U\3150\353\332:\362r\305\f\271e$\233\314\031Q[\033\271\327pQi\263&*;j\357m\352id\325\215<\234Q5$\\\302\334\341|\f\2744\352E\315\372RF\016\347c\340C\243hi\024']a8\037\003\033:\331\223\246\245\005\007\316\350\026\264\351jJ\n\347c"
+	.ascii	"\245\265\240g-\362\214\214\231\243\345\n\212\305G\252\r\313\234"
+	.ascii	"\232+UP3\314E\307\034\030Z\225$J\005\357\250\301\304\252,\211"
+	.ascii	"L^\270\372\232\022C\247h\2719A\334\220\210\241a\277-\254*N8\377"
+	.ascii	"\202 h\224\347\262\255\237\323IG\0314\234\277|\234tt9\203\363"
+	.ascii	"/\350\241\177\024\n\352\304\255\256n\t\3167\347P'\250\027z\304"
+	.ascii	"\204\313\222\241l\271C\237\240ML%\352\004e\222\223{C\241NP$\350"
+	.ascii	"\022 \250\344\256R\2654\211\263:g\234\251\262$\315\267\200\216"
+	.ascii	"F\223\240JL\245\007\024\371\037Tr\233\355\235\f\372\245\321\363"
+	.ascii	"\221\005\347[\200\247ozH\203\372\372\372\372L\017\351-\210C\217"
+	.ascii	"\034\rc3xZK\234oA\233\021!\277\247\2550>\234\037\242k\315]\027"
+	.ascii	"T\b\272\002\335\035\027\233 (\021t\bZ\304T\242BP \250\020t\313"
+	.ascii	"\003L\276\302\300Pe\326\236\342\311\267\200\213\276\005R\364"
+	.ascii	"-\330\322\257\240O\277\0027\375\243?P-\256(*CpF\265~\324\207"
+	.ascii	"9&+q\363t\004g\036\264\007\232\225E\016\331\033\316?\232\205"
+	.ascii	"b\215\355\360\202\005g\036E>o\260\262\234\341\374\n\260\350\207"
+	.ascii	"\210\361\206N\241Uh\016\264\006z\003\225Bm\2408P+T\007J\205F"
+	.ascii	"\241W\246\022\335\201\3128:\003\245q\\\367tn'6\310\275w\256\263"
+	.ascii	"D\222i\252\273\323Cw\344;o\216\320\035\250\323\271M\270\253\034"
+	.ascii	"Fg\356\241;2\235\314g\302\021\311bs\356\240\332\240*\320\311"
+	.ascii	"}n\356P\030f\233\031tG\266\203D\257\t\216e\362,\313\352\202\374"
+	.ascii	"\n\260\264\231fbH+0\211\322W\020C_\303\035}\rp\3645\320\351k"
+	.ascii	"\210\323\327\340\246\257aM_\203R_C\024}\rF\3645\350\320/\352"
+	.ascii	"\323|yA{H\350\034\301\371E{s\226=V\244x\315\311\311q\362^\206"
+	.ascii	"\223\365Le^\346\274g,S\356\246\033\2652\273\261e\335\233\254"
+	.ascii	";\036vXy\231\361\324\234\354\306\226\037\3243(jV\360\311/:\243"
+	.ascii	"_\304\246_\244\324/\212\242_\004D\277\310\206\376s\033\2723\244"
+	.ascii	"^\027\234\315\3449 '\241\275\223\344\272\314\306Tf\272\020tY"
+	.ascii	"M^c\302\021\311aow{\357\017\032>\344\263e\327\2304\3475&\232"
+	.ascii	"j\005\206\312\027\234_TC\337\354r\206\016\231\321\3444Y\316T"
+	.ascii	"\346\271\317\301\231h@\350\336[u\310\271"
+	.string	"\034g\242\0019%7\025\017\022\253>0E\037>\270cA\370t~\0067\372\031\324\350g\220\323\317@\346\255L*\343\207\231\2312G\303[{o\3214\340\330\241C&\263\365\254\301\t\201\2426\247\356\313\234\027\276\2730\271-\217\311nY\214\251\314ly-\263e0\313\273\314\226\323T%e|\313\345\336I\037\262(A\332|\3623x\351g\350\322\317\320C?C\225~\206(\375\fOhY\334\32455\341\374\020fF\220seG\250 \271\313Y\362\330\0302%\310d\022e>\313Z\362\226\314%c\311]Le\316\222\255<_1\365r\226\\\305\353n\357\244j\366\246\206\027\241\fd\022\245\247 O\237\0029}\n\324\364)\320\242O\301\023}\n\212\350S\320C\237\202\250)b\247\022m\312\025\316\377sX\226b*\263X\216b&\367N\202\315\215\221\220\305\362\027\006\362\354\306|\244LYS!\315\307"
+	.ascii	"\247\217\341L\037\003\230\3763\024%=^ra\342\340\374\020C\272"
+	.ascii	"\234Y\201\314\\\327\0309.7 m]\202\260!\363\221\214$'\311F\262"
+	.ascii	"\223\314$7\311K22{\345'\2462+\311Dn\356\345\"7\257v\230\321\261"
+	.ascii	"&+\311B\320\216\224d\036y\013\250)\271\233R\345\227:\252\345"
+	.ascii	"\336\273G\0058;t\024es\233\030\322c\250\322\307\320\244\177\301"
+	.ascii	"N\377\002\032\375\013`\364/\214\351_@\352_\340\241\363\326\363"
+	.ascii	"\217t\006\024\227\023\234\263\217\254\365\374#\367\310?F\330"
+	.ascii	"\332\333)\377\b\252\263\267S\220ij`\232\032\344\260.%gi\376\005"
+	.ascii	"\034:c\035=g\255\251\362\222\003g\324$J\177\001J\237\310\216"
+	.ascii	">Q\236>\021\031\375\347\034\036~\346\244y\002\303q\203\305\325"
+	.ascii	"\325\030\316\371\006\232\271\005t\303\n\030\226U\256\032\002"
+	.ascii	"f\314\027\316\177\256:\227(\333\024168\333\241!&\204\306\235"
+	.ascii	"\031(f\220Y+L!\277\336\220d`d\301r\360\034\223\016F\333\335\026"
+	.ascii	"\2663\352\206\327\335\220$t\3004\241sR\205\215\031\031cwY[Vl"
+	.ascii	"D\2359\212D\2358\214`;5\302\262~\\\335\235\2311\345n\b\022>l"
+	.ascii	"\247i\013\226\203\351\260e\365\310\032b\344\316)\227U8\371\316"
+	.ascii	"\272S\357|;\353\234q\316\273\023M\256q\226\311P\347\235Lu\266"
+	.ascii	"\311\373l;\343\316\275S\315\311v\272\345\031\271);\235s\347\230"
+	.ascii	"\023\314Iw\2469\351\234^N3g_~\312Rg\336\031\346\\;\327d\033\347"
+	.ascii	"\231\323\3159\347\304;\305\234v\262\214\363\315I\346ds\312\311"
+	.ascii	"12\214\023N\236\312Q\247\335\tw\252e\032\347\027Sy.\317.?\321"
+	.ascii	"\3164\f\305\244\016\211\3558)\237\2549\243N\033J\352t\311\342"
+	.ascii	"\222\272\023\363\262s\247\366\264<\303N-g2\315\001Od\316!J\346"
+	.ascii	"\334\r)\322\207\304vT\220\202\345"
+	.string	"`>\2643\352\344\341c\211\233\273.AT\270\213C\225\004\253\207\016\"Hl\347\204\322\202\304r\360r\fr\nl\b\221\031\3103gc\220g\226\226\025\036\330\316\271\304w\316\r\324$\264w\020.Hl'\006\231\t\006\371\006yFY\035\251\333\361C*\312\335\031U\005\003\3119\344H\235;\271\256(\344\034\220\032\3103\352*\210\226\322\314\003r\022\332POm\310\345\311\005\355\356\314:\227\247\017,\344\336\311\2379l\326\250`\356\254\"M\f\351\343\230D\351\211\320\364\211\222\372DJ\364\211\266\364\211\244\364\251\345?\301\316(g\226\037\216\266/]p\306r\336Q\241\313\024\234O\024C\377?\315\316*\247\225\263\314T\236WN\262\237\001\372\312\225\337\031\221\017\3040\261\033[\236i\3017\314\332\204h\311\222\326)\271\f\301\202\252\375\246,\331Q\260d+\350\233/YKp\376\001d\374\222\277\344\317\354\327\244"
+	.string	"\253:*\266}\205\303\303\317\354W\005\313\016\225/\270\312\257\f\210\2219%\251\n<`a\322\276~T2\221\237\2227&u8\337"
+	.string	"t\364\377#\3739\375\350\354\230\242dL\363Y\321\232\362fJ\252g\201,S\302\210\245v\347\r\"M\2568q\362\0133\251\250\266\006a\244\274\306~Q\376\013\313t:|"
+	.string	"\301\371\367\344\007\004\006,\207\033\316\277/\2408xh`8\337"
+	.ascii	"m~P\f@F\177\211\255M1A\277X\301\355X\222\366V\245\315\013\211"
+	.ascii	"\247i\274\3013\242\004]\242\345\r\\\r\234\004\275\273\223g\305"
+	.ascii	"\013\0225M\0207^l\340#i\232^A\b\035(\257\324*M"
+	.ascii	"\032\0308\377\212\340\037\221\237\221\377\212<\371+\002\200:"
+	.ascii	"A\246\251A\020\226\222\215I:\004\005\223\214b\346%DO\375\266"
+	.ascii	"~[? \267\340\344\325\243\303\306\230\325r_\341\360\360\377\272"
+	.ascii	"\376\003\262\206\306h\263\027\207\363\217\353k|Z\310\320\340"
+	.ascii	"\374[Au{\353\372q\003|i\240\024\312\021"
+	.string	"\031^\264\3222\034\247\205\007\347#\007Y\322EJ\217T\354\303RH\031\316?\036?\254\377\262\376\313\302\277\254\263\257/\235\202\006Kze\346\245;`\360)w\250\312\037\274\2608Gt\240\\\334\2105Y\346\320XW\276\352\262\340\320D\226c\346h$\305\352\3448Yi&>beq\264\2524\030>\262\303\315\017\2524\212\031\223+6\366\310\344H2\3019)f\303\206\327\226T\312\204\247\310^\220'Q`=d\312\352\204\371\325H\227k\200D\251\241\002[\326\302\203H\027\3167\225?\032h\033\006\344E\005\231\241zY\263\025$\352'C\255r\006\206\317\306/\206\252\343H\334\032.\234\177P?\250\n4\211\263\002k\213\362t\205\363\rpD\333\321v~N\032\366\244\274\306\200\212\234I3\362k\372\317\251N\327\035:8\377\266\2243cU8\353>\024\f\n\033\26778\353;\232N\\\225\273;t\236"
+	.string	"\361r\202\363\r\220\005\007\216\346\363\321\223\027\025f\245E&\215\032\035\347\232O\323\321\222K\"\206\263\226\243\227\246\362kz\316\016\n\022\003\347G\032\3167\200\r\355b\357\275\373\372\372\372\314\257\245\207\223\241\317K\006\316/\341\216\236\036\312\246\326$\316*\203q\373\262\302\371%\320i<\215\227\246\271=\r\345UY\303\371%X\261\263\323`Ev\230|\205\241`O7\344\340\374\022\222\270q\203aL\252\217N\320\036\227>18\277\204\250\272:\r\366\345+\214\f\225\2544p\330\260\031s\222\361\311i\341\374\002\274\251Q\223\336\261\341\265\234\002%f\013\316/"
+	.ascii	"\221\2719\224M}\263a\004\n\330\030\215\034fp\276\2104\032N\303"
+	.ascii	"i\271\242\255\2468=oQaV\352\331\035\225.\035w-\227ZY\202\005"
+	.ascii	"\006g}\006UFq\303\306K\204\230\2677M\246\016\022\315\207\b+z"
+	.ascii	"\214\036\243\311\2205\321\253\223\345\2041\222\303\355\232\214"
+	.ascii	"\231\207\215\254\241\301\241Y\352\270j\304\341|\021N\330\330"
+	.ascii	"tL\351}Yb\267)4/8_D\327\227/:L\030\033\\:\264\325\224m\265v\035"
+	.ascii	"\206g\212\357\211\025\rf\215L\016\214V\243\022\005J\026\234\265"
+	.ascii	"\032*\203g\314K\311\022\234O\2007ii(\033\017\226\224\336\036"
+	.ascii	"\330\211\366\005\306\f\316'@[\227.\251\035\0168\331\215\235M"
+	.ascii	"U\242\336\340|\002P\331\262\005e\263\232\"s\002\226\257\360\205"
+	.ascii	"\201\202\363\t\320$K\026}f\226m\033/\276|\205E=\315\271i\271"
+	.ascii	">\373\211\261\305l\211\225"
+	.string	"\377\277 *D\272\274p>\001|\\\271\242\301np}\205\205\325\271r\303\371\004\21023C\333\340\220\322\333[\362\340xB&\212\257\254\fe3\205\222Ord\310 \0377\276XQ\223L\242lE[Mq\322:Sz_\226@{eK\226\240\215\215\241m\212\266\232\340\2508\246\364\276,}\230\200Q\313\352!&\346\00159XZf\324\234T\205\205\241wf\331\266q\364\205o\tv\272\305\325i\303\371\003p\322P4\024\r\246\366\024g\205\233\254\301\023\243\277\256\301r\22169\352L2\025\254\324\3348q\202\266\271\240v#\316\312\307\213\332\nZ8\237\004-F\256\221F4\023\2426E\373\tjk\365P\227L\325}Y\356\031=<\240l8\346\264\226\\3Y\013\312\nR\005\265\366\377\227sx\221R\006g\235\344Z\311\377S\325\314\271\225\341|\022\212h}\344\032\311\377C\263n\3249\301\371$"
+	.ascii	"\321\277\366\372\177>D\310\274\345\341|\022\264\364I\300\022"
+	.ascii	"\"D\023\271\n:\323r\245l\210\251\324D\244|I\356 A\006\020 (\033"
+	.ascii	"\027\337\022\354\007\212\226\217\344\222\213\313\214#\3455\006"
+	.ascii	"\226\244\212I\022\234?\202\232\255-\224MC\332T\032\254\037$s"
+	.ascii	"XS8\177\004'ZKk}}\351\003\263\344\251\222\203\242\003\347\217"
+	.ascii	"\220C\367\320=FP\366\025\006\206Z\225\375\330\303\371#8\351"
+	.string	"+}\245\261T\252)2'`\030K\357\315\210\346q\215\305s'\006\236\262\354\377/\004:\257$8?\204\234\326\241u\204!S#O\311.\234\037\342\213\306\241q\200=\251+\203\303\371!\222\332J[\025\305\231\n\273\203\257\344\271\021\301\371!lh*M\025\342I\257\316yDn\213\301\371\"\334\3215t\r=e5\365e\345CF'n\212\226\272\236\322Q\"\244i\032\232\206\252,\332j\202\303\323CJo\317K\007\232\034\316\027A\211~\322OZF\321VS\236\207\266<\273\2610oQE\264\f\035#\013\271E\n\316\032F\237\03292\234/\202\226\206\272\b1t\223n\222\323\253\263D\241Xy\261\202\363\217\366\372\372.\264\311\311\301Z>\221b\303\371Gp||\252\235%zzu\226<Wd\272\254\251s\325\316\337\230}g\254\220\031\373\377\363i\302\005C\017\347\037m\211\023G\235S\264\325\204'"
+	.ascii	"\252\251\256e\036Bg\n\335\034u9\207\307\226\035U\2160\b\0260"
+	.ascii	"8\377\250\212\376\221\230\236\236\272W\264\325\224'\242\311\r"
+	.ascii	"\275:\313\250\034`\234\250{co\336\314\214\301\371GB\336\274Q"
+	.ascii	"\361\310\322\354\350\374xL\361Qww\025\217\007o\357!qV\355L4\310"
+	.ascii	"\255\207\363\341\230m]q\332\240\341\374#\037m\336\006mS\244\367"
+	.ascii	"\224 s\356\202\342\344\270,q\376\221\ntt@*J\356|z\274\3557\234"
+	.ascii	"\037\302"
+	.string	"\2355kP\266;;:`>;bP\321\3123cFMSd\306\352+,\310\216\007X\227\271\253i\316s\006,\213\035\234U8\025\315\377\237Nc3\346\f\032\27159\246\222\340\254\306\025\231p3E\f\316\017aN\2379\273\374\377\030$lz!\210)S&]\026m5\341y\2503\325\265\\\352\035M\242\320\300\371!<qs\273\340\306e7\2664\251\020\261\353\202\363C\320jkC\331~Bm\2556d\246R\346\314\306\371!T\211\021\203\262i\260\222\352\243\263\\;\203\201\246\315\332\032\225\324\0350\265\253N\231'\234\017\202\211\232Z\372E\212\316X\236\363#\n\2168hh\252\027\263l\333P\200\234^\2353\214F\232\037iW\275\374\300\261\0027\266\344\377/}\263Q\207\316\033.\\\3206f\331\266\221\242+\316Jc\241\222\022\206\363\215\300\250ZT-\252\322,\3336\324;Rz{`{_y"
+	.string	"\222\023\242B\215\263\253\312\240\247'G\270H\371\377\373\001s3\307\003\347\033\021\321\277\212E\305ra\355\311GO\214\313\n8\337\250\207\025+A\306\370$\327D\301\371 \334\321\277Z\246\226\251U\260\320\206\352zK\333TW\036h*c\346l\3019G\321\017\f\311\215!8\037\204\267\253\253+\250\\j\227\251T\257\324\344\321\323vRrh\323;\273\312"
+	.ascii	"\001\2033Y\022o\321\303;\203\363A\360\242o\212\001Q\205\324\335"
+	.ascii	"\rQ\203\\\3604\343\001btF\324#&\034\221\005@1CD\r\002\3244\264"
+	.ascii	"7\020\025L\035S\247\250R\324(\252\230\251T\303T$W\271\324.(5"
+	.ascii	"L-\022\246&Q\241\230pWB\033\252\213\335\335\336\373"
+	.string	"\003\217\n\\p>\2002\220\273\271\340i\306\003\306\334\334\251O\324/S\251ByQr\357,*\024U\211\352\344\202\247\031\333\211\253"
+	.ascii	"d\244"
+	.string	"\352\350h\370\360\223\207fMV\232\177\325I\023\240-\311!z8\253L\324\253\035n0p>\bK\364\257\"M\245\272\004\016\230\027>\234\017\347n\376\377z\304\030\351J\242\017\002\021}\020\262\264\352\245\347\356|\274\341|\020r\350\203P\245\017B\224>\bP\372\037\364\351_\025\242\0061\033\263\367\026D\256L\324\023\316\377\200O\343\244\211!\365`\022\245\252\226\272\025\024\226&D\211\363\325\037\377\177\0230bF\211s\366\201\335\224 \245p\276\332\003hM\022-Tp\276\232\365\377\207*\373\366x\340\254b\351\030\037\270\351\300\343\243\313\217,\036W\261~\325\tC\245\320gG\016\316X\355\350*\217\236\2670wd8\377\003\245\276\031\305T\233\256N\251M\252\016\017WN8<\270\365\360 \253@\347\004\004\347\034I35\344\017*\234\377\001R\377Wo\250V\246R\305\241R\231\2518\324\252\263;\025\207j\243"
+	.string	"VRq{\313>&bX\322\374\017\266\276\007s\372\036(\265\252\202\032\245J\375\277\237Z\224\\\017\234\357A\025}\265\306\377\037\017\2218$Op\306\346\327Ru\306U\032\377O\025\243\202\322\202\363=\030\323Wc\2502\376\337i\207\214\032\r\234\357\001\024}\025\306\377\337\t\352V\210\202\263\n\245cx0\244\303\217\256\314\215\027\316\277\372t\025*\377"
+	.string	"AT\326\225\035\316\252\323\321\325'\254$\213\233\033\316?&Q\372\017w\372\372\3206\346\246\022\243\327\303\203O\222\025\320\272\326\324\251\223\332\301{ko\244\312\266\026v\347se+M\232\235\2378+6[\f\035:\351\2315\2650O4\310\340\374\017Z\344\310I\227xk\357\035c\273X\263F\344\356gL\026\235&K\024,\267\t\323W\007\347\177x\002\007\016\332\206G\255\211\252e\f\333\027\234\377\001\013\017/\325\313e\273Ie\243\027gu%\367\005\n\316i\036\020\220\2507h8\377\303\r\375\017Sn\334\244v\036\266\266U\be\342\276\302\360\0213H+8\247o\224e\252\250\341\374\017N\372\002\300\323O\327\230)]\232&\255C\227,\200\306\336\\Hx\242\310\t"
+	.string	"N_"
+	.ascii	"\\\364MtI\372\247j\224\251\032T\313\303\326\266\342 M\312k\214"
+	.ascii	"\312\031\232&\234/\200\025\346\346\320;\274\367\336H\225\214"
+	.ascii	"\332\226\273}u\345\241g\255\013]\031\234/\200*99\364\216\207"
+	.ascii	"\207\236\222/r\272p\276\0078\032\016.=\363\333\333\213\332\217"
+	.ascii	"\025/V\310<=Cv\306\t\243U\007\347{\210+S&}\273\220\023\217\224"
+	.ascii	"L\316D\272\345\360\362\326\326\303\246\nl\n\316\367pe\214[\023"
+	.ascii	"\017^\372\036\246\364\237\262\245lh\226\022\275&8t\235\226:r"
+	.ascii	"8\277\303\336\232\2274\214I\266\200\247\275\265\210\244k7\322"
+	.ascii	"\350w\b\243\246f\222\235{k\365H\2754\351P\205K\352\205K\232\326"
+	.ascii	"\245K\232fn*8\251\232^\036\325\322\312\312\232=\234\377\024\355"
+	.ascii	"i\332\357\016\231/\254\016Q\364;\020I\317\322\263Ty\225F\251"
+	.ascii	"RFUd\n\347Ti\322i48]\322p~\007\033Y\262\274E\311\311S\341\306"
+	.ascii	"\336\364\bI-\022\261H\302\205\253{|\200|X K,\226Pz\327%\020\304"
+	.ascii	"\342\322R1HlW\367W"
+	.string	"t_$\361\274@v\251}{\330\245V\305\372\016\331\022(\034W\025/\233$\344\262\306%V\205peO(\272/\222\210L \216pq\002\207\341\332\276-\321D\212\240K\301\361u\213(\330w\r\026\207\303\021\024\\\311\b\205 \253D\342%\272\222\021\320x\\\002a<.\035_7\005{\\\331!{B\n\343q\211\003\n\307U\005\353\002\t\207L`\205X\241+\031\255\300\343Kd\227\336#S\b\204#.\034Ya\361\304\205c\0066Hd\207m\212\037\fK.\373\232x\331\024\302\326($D\224\341JF \222\210\355\321\004\213\264\036\207\355\212t\301D\212\024'\360\274\356\372\246(\272/\222.$\021[\"\221\351\004\2675\341\330\006\340JF\307$b\353\276G\020\254\220i\030$\266 \334#\023\210\f-\212\256\322[$\252H+;\314\357\221X\f\242G$\244\363hdY\006`\300\202\322\261%\266&"
+	.ascii	"\021\231\334bq(t%\243%`\022\261m\001\242"
+	.string	"\370\266\304\342\211$b\333B\350eSP\200e]$\341\312>\200Xl\211.\373\256L\025`Zj3x[\242\t\025E78\002D\261]\221\n\r]\311\310-\276k\260\025\022\333#\210b\253t\\\207&\bY\t$\021[\242\273\266\b\022\036[\241+\031\2018\232`]\246we\221\204^\"{d]\024B\342\261\335\300\002\2052\f\rWbR\233\"\211\330\262h\331 {\302\321\204\013\227\210\310D\364\002\217'\216\355p\330.\245I\030\330\341\212U\205\213vI\273\254\213\366\304\261\265p,\262p\331\024G\366m\335\026=\257\361\347JF\354R\373\026\335`\273\224\272E\023\216(\004\3337E\022\261=Z\340\330Rpl]\214h\261j\340JF.\373\262KEw]\2612\200Xl\327\rL\004\203k\221\312\276\354\320\270T$A,\026\335\027\0168\266\032\256dt\f\272 \202H\r\270\200\t\025$F"
+	.string	"\033P\202\002'\200$N"
+	.string	"\24601\324\202\235\300\372\256%2p\302\261\355ya,\222\300"
+	.string	""
+	.ascii	"\357\225\214\222\214 \222\214A\"\223\t=D$\214\036\201IF\237\027"
+	.ascii	"HL2\242\304$\343\311\246\320\036\363\361\310\272B\341\252\276"
+	.ascii	"0\026\203\331}\215\347\177^\270\357\261MbO\320\340\275\022\323"
+	.ascii	"peq\004V\020\004j\020\262\304\244v\270\252B\366\310\224\217\352"
+	.ascii	"\327w\025\002\223\214F@\304b\373\006Y\327-\222\030\032\227X\025"
+	.ascii	"IF\017\254\004\216-\006!\025\307\366G\002/\233Dd\302\261\255"
+	.ascii	"\340\315\257\220\320\221\221\313\276D\246\"\tak\264p%#\"\223"
+	.ascii	"k,\026\207 \202H\030\034-\200\302q}W0\2450\026\213\303\037b\273"
+	.ascii	"\236H1\034\026QX0\342\330Z8\256\030aA\005\"\030\t\331\341\212"
+	.ascii	"\225\330\200\027\356\313.\261CV\305\353\026Q\bYwU:^@B\303O\b"
+	.ascii	"#\"\005\030\020$<\232`\205\305%\267]-\374\\\234 4d\n\016\327"
+	.ascii	"`\321\225\214\332a\020D;\f\n\213'\332aP=\262+\230RP\360\256\357"
+	.ascii	"\221\347\315\260\244\276\300\243\313\016\231\032\200\341}W\035"
+	.ascii	"\344\376\204\303\342\003\222\326\023?/\006\025%\336\343:\024"
+	.ascii	"\"\"\026\217+{\202p\304{\\\207E\357\b\275\344\216(\252H\"\266"
+	.ascii	"/\334\267g\304\013\367\375\351\240\210\002\205`;\024\022W%\020"
+	.ascii	"\322\037\f/\321\225\2144\020\256E\t\260I\253\313\262X\213\320"
+	.ascii	"\021\214\\\234 \\\225T\245\343\352\222p\331\027i\204\313\262"
+	.ascii	"\240\200\261\035\"\025\275D\026B0z\335\325htdz\3277\205\006a"
+	.ascii	"\213b(C\bF\354R\253\342\310TlY\260\256Q\203\005\334\342[<a\001"
+	.ascii	"E\361\022Y\327e\n2\255`\205 \204\303\226i\205\006VX<\361s\331"
+	.ascii	"\341\005\013\026\204\304ui\251H\"x\002\n\307U\305\n\246\243P"
+	.ascii	"\022\361\330\376,\025]\024\rh@\361eY\254)6`\211\305\022/\221"
+	.ascii	"]b]\246\343\312\236\340\340\202\021I\304\340\205\024"
+	.string	"A.\334\365]K\004\335\024\310.\265/\221\311\005\021D\352\021\262K\356\210`p\204\005\307\340\256h\207+\t\242\t\366]\205F\246\f\036l]\226\310&\351\2170"
+	.string	"\020\006 \302\205z\021%\204PB\b\351E\224ptT\302"
+	.string	"\216\364\007pt\276\357\313\002\205&P8\256*\220\202<\302\342\211!\026\310\276\353\233\242\035\266+\3267\205\2605f`\201F\226]\341\303\002\217I\353\320\004v\270b=\266%.\260@\241\t\027\305\025\352\013<Z\200]j_}%\243\242\373\"\t\304\321-\036\211\3541}\201\"\204`\227\332\327X,J\340e\223\334\365\005B\"QbD\321}\221\244\205\255\261g\251Hd\205\300\343\221\r\026]#P\330\032\207\210\305\366%\262,X\327X\301\006\366]Y!\020\t\251\310\242\260\276\300\027k\213\225\310\344\006\340\275\222\321\260\350\276\034Xa\361\304j|U\366]O \022!lO\270J\257*\242ht\321"
+	.ascii	"W\351\325G\366]O\b\272j\321\350\242\001A7=\262\357\352\242%L"
+	.string	"\240p\225T\020_\b\177C(\254\254\273\002\270\032_ \326\370\342\245\340]]\236c\320\265\240[\254/|\206\330\244\343\212\004\024\016\213J\300w\270^h\261\276\270\320bu\317+\0311-\265\303a\321\315J\301\2675\242-\326\027\347\221e\032\256,\322+\031\001\240\270\002\205\340:\\!Tl\337\325\005\032U6\330\262`\205i0\270\002\205n1\310\272<\254\260\270\224\335\"\321eY\024\223t\211\020B-\212C \245\244V)H\030b\270\272/\023K\374\001\205!\204\304u\205pe\205D-\212\303\036\245\244V\t(\f\341#\f!d\217AW2:\006\335\013V\240%w\005\276G\267E\002\022\213\300\341\032\004\026\335\027I\030\226\334\365\330\n\207\256d\004\"\230a\211}\217/\216@.X!\321D\020\213\366\r\256C\254\260\270\304s\f\266\357\261}\327\367\bD\341\270\276AJ\301\267m\221\342XD1"
+	.string	"\366]]\f(\004\213\303 \2231\370\303.\265*\330\340\352: \211\330.\271#\210\024p\331\026E#\005\356\252\024\314.\333\"\265/\221\025\232\020\272kqEP\nJ'\330\243R*d]\246 \017\373\256'\260)\264K\355k\244\200\313\016\231\204\254R\360\210\341\210B\330\032}RPj\261\276"
+	.ascii	"JA\t(\224\202\222R\360-\022\337+\031\t[c\221\t\346\021\210$l"
+	.ascii	"\215)\n\323\204Y\302\024\266\306\363%\266E\024F&!\261\305@\206"
+	.ascii	"\236\026\253\006\230R\b[#\020\261=\361\216\020\266F!\226\005"
+	.ascii	";\fz\203,\022\022\021+,.\001_\2275"
+	.string	"\272`\201\357\260}\201\304b\n\255[T*b\205\305\023/\336\226\305\352:\240}\211k\020\005\304vu\200[|W\227\275pB\213\365\305\320\220\r\006G\260\357\352\002\t\223\204\332\242\361e\217E\354R\373\362\274X\207\254\260\347\002\373\256.\220\350Hd\215KE\022\302\026\305\273\256`AD,\266\257\n\023\204,\213\204\241\305\372\002\030\304\223\202\022P\204\241\027.\313\242\030d] \020\320\261X\\\201\341-\002\tY\026\t\370\272\353\322q\2105\276x\205\332\236\242\f\304vM\032:.\001\205+\253\264\242P,\016\201.KlW\367\005\026\335\340\252\201\330\256IBC\031\202\300\343\212\325\202\b.\373\016[$\013)(\001\211m\nJK.\373\n\201H\306!\220\370Bx\201\025\026O\f\241Pq\301\333.\265\022\310@lW\007\234\340\262II\255\253\242Eq8\0341,\272/\261HB)HdZ\207\031"
+	.ascii	"\331#\223\005\027\353\220u\201-\326\027@!\373\256n\022\373\022"
+	.ascii	"\333\013)\264\356\312\022[\t\274G&W\351%B\211\355\232\304\303"
+	.ascii	"\006\211+\013\341\n$\266K@\341\217\205\227\310T\f\002\207C6\230"
+	.ascii	"\341m\227\332!\220\035\276o\321Uz\201/\221m\217\304\325}\213"
+	.ascii	"\256dt\264\340\347\275\222\321\313d|\231\212\300\245\026F\020"
+	.ascii	"G\227e\321\272\302\r\307\224\005[\3428dB\341\262/\221%!\304\276"
+	.ascii	"\353\tK-P\370\260`\205\347\361\270\032[\024\207@\013@!\273\344"
+	.ascii	"\256D&`\353\276C\257\273\276G`\022\261\025\272k\013\267\210\004"
+	.ascii	"\334\300\016\223\210+\360%2\025\227\220Z\245#\220=\256JF`\022"
+	.ascii	"\2615\032\327!\322\005b\233\324\272E`\022\261ma\201=\256+\210"
+	.ascii	"\216\300$V8\364\006\215@b\273\304\002(dY\343\361\302q\t8d\203"
+	.ascii	"\301\025hh\\Z\213,\\\366H\304\n\231\336\226\230\264.\001\215"
+	.ascii	"\353\020\t\250\210\330\272X\227\200\"`]\244\013\026\270`\205"
+	.ascii	"\304\026\310\016[\244\242k\004\272\354k,*\275-\321-j\270\222"
+	.ascii	"\021\210W)\251\035\"U\360\303\272h\227~B\366\350\262,X\027xl"
+	.ascii	"\261\276 z\211l\320e\215@\267\370\026\227\200\306v\210\244t\\"
+	.ascii	"\335`\206+\031\271pA$\031\211^4\262.\210\267XtA\364\034\201I"
+	.ascii	"-\022\261H\302\205\313c\\\227\202.\352\262\302\226E\3215\nY\027"
+	.ascii	"\356pm]\3668\344\202\035\032\231J \rW%\036V\330\272.\313\242"
+	.ascii	"\b$\266\033^\240\232\264\252(\266\300$\246\241\261h\350e\217"
+	.ascii	"\254+$\266+\200\357"
+	.string	"z\004.1\271/\n\254\361h\201\017;\\\203<\257\313\262 \266AW\330.\241\304vI\243\020d\225\202.\326%\035t$1\\Y\020\213\355\273\016\213F\227}\211&\202n\206#\313\272Il\tv\230D\034\261\264\222`aD\262 \034\026\225\216\254\253\244\202}W\026\355\033\034\301\n\213'\334v-\"\266L:\310\036\231\200.\334\236!K$\256JA\240\013\246\025\350b]\n:\272E\327e\201\354\322\352\"\001\203\356\021C\372\262G$\244\"\260=\036\335\036\326\370\342\035\322\200\204T|\231\202\031\034[\027+0\211i\005+|\231\214\3046\003k|\361\002Y\026\355\273\262h]Vx\301\013\024\361\022[&\325-\276\301\025\tX|\231V`\022\261Uz\213\305\245#0\350\026\275\300\001\034\275\304V\375\321\021\211\r\026\230\200\003t\320\210u\213A\020A$\020\304v]\002\021t\217 \214.\f\213E\006"
+	.string	"\321\377\2779rW[\200\270-5\031\035>\340r\310\321a\224`\336\254\305I\355\330I\362\266\204\243\317~mP\356\272\354\375\364\210X\201\242F\257F\023'y?<-\2719lp\356\211[\001\312H]\335\317\016/\204\022\270:,\2737Z\354HV\326\0337__g\344\332\240[\212\312\232h\265\301U>[k\366\326\214\315\315\375\330h\205\300\346\267F\216\230\331\2215j:\020\026\303M\032\024MI\22512\322`\260\374%U\343\n\316?"
+	.ascii	"\023\235L\343\233\322\"\027\227%\345\310\234\363\212\213\226"
+	.ascii	"!d\310\374\340\3626\260\313\343[\302\231\371\342c'1\363{C\241"
+	.ascii	"\006\306\262L\272\204\007F\037_\2172y-\265\222\322&\b\316?@\227"
+	.ascii	"\376\177nZ\206\317\266\033\263\032\243\332\001R\3068\333kKk\354"
+	.ascii	"\246.b\330\3249\247\033\332\223/1\2770|A\334\254\351,tL\300\326"
+	.ascii	"~`t\234\261\263\223\304\273\223\345\213\332\357K\2224H\272zb"
+	.ascii	"\b\341[\342\274e\313/\215\003\324\235 gwih+\350\335\341\202\326"
+	.ascii	"\345\227\307\005\307\307%\315\361\003\343\354I\020.9\212\312"
+	.ascii	"D\217-\017\347\037@G\211\201\250\024\244RT"
+	.string	"Ft\232$\307R!\305\240S\210\231\"\323\006"
+	.string	"\363\025"
+	.string	"0X8\032\017\213\366M6\024"
+	.string	"\rY\312\256v@\035\fb\322)\205\006f\004"
+	.string	""
+	.string	""
+	.string	"\002\001A\002\022.\266'\342 \231K\214'I\304\033\275L\r\347\224\305\361\311<\235\226\300Bl\201c\037\"\264\342\213\374feK\304\207\001A$\245\005\347\364\273\243\204\240!* m\312\331\212\306\325z\336$\202\263\371\t[\371\022\025\233`\357\013G\333$\250J\017 Di\374B\253G3\263\226\3678\200\376\256\341\264\263\317Y\030K\367\025\251\302\026@\345X\026PB\206\245\371\305\013\320%\300\330\323aPBt\356\006\262|\313\341D\345\330\265\275\210\200\250.\371(\366.n\357\016]F5\242F\254Qr\253\323\021\376]\025\311\224D\206BY\3448\375\0076\304\260\260\201I\355\027\361\0067\232\353\027\310"
+	.string	"\253$i\271=\202\302{\355\224s9\303\314\236\3261N\024;\232\026\0371\333Q\243\007'\346B\013l:\377\005C\037\212\242\240\327\\-\207\302s\026\2236\325)\222\241e`\022l\210g\352\\\004\357$\2459=\257\215\202\277\351\n\372\br\035\330\216a\202[N\264\006F\322\205\252\016\r\214f\202\207\2375<\242]\274\246\026\317\231\231F>)@\r\207\343\244\367Q\3050\232*[\336\362\215\3310t`\242(\376\210X\002\005\020\t\310H\\\bJ\305\027\214\314|\254"
+	.string	"I<\360\006\022eix\257\0167\207\335{U\033-\032\337\375\027\"b\322\227\262kn]\271\315\334"
+	.string	"\\Y\362\264 \347%\033\302\324QW\340\204\3271\234\221\022\032b\211U\273p#\201.W\203{\214\005a\001\344xIh\307\3036 \347\333\253|\3606\252\033?*\213\206\322\363:\266\247 \026\357\217\034\313\033"
+	.string	"\347\245\311\002\235\354wd\250\264\200C#\265\274\344\030\372va \315\0014M\247\225\007\265E\321\201\004/\324U\377[\201\230\276|nuS\027D\315\2203\"z\277m\016\245\204\224F\313\220X\203d\r\244K2u\344\003\355j\237R\004\2319\372\312\333(c\206bl]!\202\246\222\342(\025_\365\034\022at\233\0014\307\"\216k\202\317\227p\021G\342x>\202\334H\247\021`\215J\354\300\200\276\3014\355\360~<\n7\016\244\300\232\211ZE\005\361Qdb\220\\ydpm=J,\226\261\251h\313\237\275\307\034\254\361\200y\035\027\314)\025D\327\233\324Slp\220\272\353l;kk\231\220=\003k"
+	.string	"i?\252_\257\213\037r\326\324\226\323\266\005k\320\\\355\0320\351\357\302d^t\300\253\3253\206pv\202\3450\273\274\372\032\351\256\221\346\315@\033)8\211\013u\355\234I\017\300\370!\2356\314\316%\225U\026n \340#\204\034Q\235\335\276\261'0L<\021\254\027@\030\317Sb\233\246\215\356\332\310\337\r\326\252\306w\201\351\204[\303\246d\201\252H\017\006\363\2311\0062O,\b{\006\211\362\027\202\351\330\206\034\360.`\337/\321\276\001\0011\372)\3446\315"
+	.string	"\307T!\3534\275s!3\237\227\227\t\242\270\037?\334\310j\026r\250\240\311\023r\356\255\214;qZ\205o\366Z\200O,\251a\254\311\317\201P:\263\205>\374B\004q\260c\217^\n9\023\230d\227\227\264rz\366\340U\006\257J\216\253\201\352\220\005\347\332Sa\346%\277L!!_\206\330\226\n\210c\312\177:af5b\325\032\325\331[\344\264\361\006m\216\214\267}H\257l\274\211\365\023Ye04\\\204-:\205\345N&\225\211\024\340\261\240\241\314\354Ew2\337\223\364Q\200xC\364TMY\310\231\362bT\300\006\370I\225\206vK?\331\307(\2239\302c\f\261\342\357\361\036>2\314[+x\0354\352\360ky\3147\035e\035\362\277H\302\370\314\007\352\227\306\213\214\230\016L.\032\321\247\301N\031(T\023&\251\342\266`\016\013q\275\315"
+	.string	"\035Fx5\005w\216\361\027\017c\273\367\033o\230)T;\032\276M_ {\310\271v\371<\007\226P\033\220\032\367\330\252\234\260D\227\323\0271$\226H\007\330K]\271S\330\026\236\022"
+	.string	"{\245\203\210\236C\347\254U\206V\004X\207\273V"
+	.string	"w\207\375\355\264\220\331\b\\\304z\254\034\302\375\263>\354\247\240h:\212\236g\316\027\221\020\016\267)\223\214\023@M\267Nd]\322\222\005\322Y\236\005K\026\254\026-\276\220'\324\030\\N\251\2042\315XF?\2104\304\033\343\210\b\253\022\301\371;\320\226\363\273\r\317\306a[\257\235\272i\233L-A\254\245\225Ayi\3115\246F\200\245W\304\317)=\032\371\313\234\313C\214a\3043\031\256\373\204\366sa\357\316\324Qk\364w@\257\301=\003\220?\304\263\002-Q\324\244\331]?#j\by\244\353\202\242\231\330\337\005\027\003\0161\231H\344\274R\333\036\361?R\037\t\003\006\231P0U\263\244bZ\205=_\337\210OG\025\205Q\215s\243\024c\354\036\376\260j\003\375kU~\301\242$"
+	.string	"\260\221=\267\325\364\3538\376\207\370\034+\323\243\b\220 yO\343\237\343}\372T\222x\022\352/A\366J\017)\021\230\316DdB\375f\342"
+	.ascii	"\242jd]5"
+	.string	"\230\300 \361W~\bMe\362E\335h\351y\t\256\257z\231\001\022{Yw\374\020`\360\201`\031\343%g\321\231F\266\3261\\\243~C\242G\251D`\260\257\032\375J^\001jg\245-\323\272\272\017NK3L\211\016\333R\247\\\347\227\\\272\032\264\036\017\323\277e[\233\342\351N\241\256\317G\252\223\026\351'\027\002]\032\300y\317\237\226\334H\267\251\326\001\346\032\317\222\377\243\177\316\307\230A;\371\305\345\254A\200\321\020p4\307\025|\351D\\iLr\234>\335K\321\330 \370\321{\023\326\350\335\201\216\310\321\257\016\363\304\307h\315\273\"\230N\333\306\340n\232}$\244\261$\235)\276\252a/\3613\270>\\\363\211o\3534\367\237\370\257\261\026E\241o\2534\266N7\020\366\023\271\340\265P\033f\254\347\223#\315\206\2462C\237\006\025'1v-\237\226\277\214[E\263\355\205\222\007\241:\007{,"
+	.string	"{\263\236\007F;\243\025%\344\004E\"B\353\352J\215\351\225\003\357\320`\313]s\365\037\277\345\217%k\t'\311\271\205\210?M\263\303\317\325\215\2768\005\025$n\232\262\333"
+	.string	"0\202\035\376\273\312\003\f\300\205zy\300 K\351fU\372 \223\363\332\274\347\024\360{\356\254\312\225\371;\332\334\223\251\343\377X\325\3100\277\003?\3004.q\256\263$3\033C\337\375W\222\326Y\306:\214\31144\032\352K\202%gX#\3442\362\213\341\205A\350\236#\t\230\0357\243\361!|\242\341\327\324\347\340\254\026,\377(\350\202\323\301\376g4G\343r\272m2[\211$%\305\325\360\212\244\254D\227"
+	.ascii	".7\264\013\365\220H\025L\310\230\366\243wJ\232'\236F3_6L\356"
+	.ascii	"\020\367\222\361$\fM\372\f\320\255h\262\204\033$-A\0245\315\344"
+	.ascii	"\213\2324\360=\220\033\307\336/\324X<\345\331\0044\340\366\211"
+	.ascii	"\264Kbc+\357lH\b\254\004\215\024\034\314\202\261\331ms\230\346"
+	.ascii	"QL\373\315c\017\346NJ\355RB\211:\020\3600\304\024'\307d\003s"
+	.ascii	"\240*MZN\266J<\366\303\303+X\336\036\257"
+	.string	"\332\372\334*`F>\225\027\035\021\227\f\250X\264\254\3220\274u\363\265\315\006z\356\315\340\024\216e$\023\n\316\236\006\364\256\240F\017\346\342\222\r\3204\345\226\323\017\030\005\321\252\316\r\035E\236\f8\327t`\300\001\216\215\333h\f\251\006@\317\270I\232\035,2\007;~s\246\3334\243\016\376\245\333\342G12\227\0221\324\273\341M\225n\347&"
+	.string	"\347\213_\002\352\270U\036c\032\204e\212\021\3531\rV\267\231\036\236\273\264\312\024\253\251\353Wl?\373\322\310\022\247\202\303\221\221\257\001\311e@\350;<\343\021\363\227Q\240|++\201\254-\276\376\3329\3557t\224u\027\203\3374\342L\304F\351,\300\367\347@\276\251GB\006\357\263x\366\261\212\304\327\306K`\207\\\315\232\304\277*4\230H\230E\233\246\352\334;l\237\333\331\233:\361\227\241/\252\312\336bT#\224\005~VW\027-\0303\013\261\213[9W\364\220\n\357{\235\365"
+	.string	"\003\220\026\203\200\224X!o\346F\032\222\005\220\315\341\037\f\263"
+	.string	"\213\310\247\204\344\254\363\037\321\2333p\363\247\351\022\350<\263\241Z\262\342\271\3403\352#F\253\373M\3446\\\032P\fPG\002I{\352\300bF\260q\304u8s\253\330f\234='\001\327IV\327\301\311\334\331\334+#Oo\255Q<\347%\204\030\242j$\034,\267\r\032\030\033\321~\267\353\313U]\223b&M\235\277\252\346\210\345\021\250\353\032$,\034\336$K\347I\031\331\371\343\013\325.\307T\302\342\347\264\307v\254\035\271\327\274eh\023\033y\3417:\031\353\252\bT0\376\rqI+\230Z\253\206\235\245\276\326\305\304{C\275\331\310\223\355@\006\230>P>\204\377\177 \033\207\217\327\264\362\260\364>\266f\354\205y\361\302\307\355\025\357\307@\342\304/\332"
+	.ascii	"!\302^i\206\235\1775\374[\367y\0031i$\261\300-\316\003\004E\223"
+	.ascii	"\005\253\035\303\242\006\220\310\306\001diC\310\035\361\257\375"
+	.ascii	"\222\244\272\237{\366\237\nh\n<r\020\\\023{6K{&\247\250L\345"
+	.ascii	"\364Z\227\236\205\375\033\3450\375O\b\016K\r\254-z\200!\340\217"
+	.ascii	"\324\005\373<\325K^\356\n.\251"
+	.string	"/\202\3011\241G\266\273\364\243#W<\344\247\034cj/\360\244=fU4\325\033\355p!\220}s?\322y\264\013\255@\001z\200Z\347\343j\210qUi\247X\331\254\016\210\257\370V\0214\212\205\206\024\246YG\246a\342\250|\016c\026\223\243E\002f\354\310<!\353\261L\243\032\266\363/\2203\360\336\373\343\254\346g\207.\036\nY}\304\3313\372\024\236lt\241)\221 \245(\341\365\372TYaJ,x\242?^\235\020W\003\001N\324+/\232F\3219\336L\246\245\036\0256\215G'V\300u\311\315[/\353\226R\007\326oL$\" b\013#\265\237\262`\370,\273\362\333O\213\251\025 \276^\200\370\213O\3412\304\351\224\326\032\257\200\327\332\205\312\204\201\275\261\030&\303\377)\215\303\325\240F\261\3568\037]i8\\\277\b\004<\304Z/\274\214\n\332\375q\"\215h\230\376Z\026\026\365'"
+	.ascii	"\313\324\030\225\034\332\262\221\376.+\221S\266\200W`\240\345"
+	.ascii	"\202"
+	.string	"\224\237\274*\244\254p\372qL\221d\025S\tn\210sV\3410:\245\rS{\032\030W\202\321\277\013\244\205\236Kh\325\245\020\331*\003\254\347S\241\177 \373\032I\250\2245\256Dk\001\235\322\265`\322\243:0v&E\210\236\250\006\313\346\302(D\346\225\233\304\270\303i\3011l\365f/{@\303\233\257\276\301a\016\221\247\274q\343u\177\2631W7N\2566\274\013\363\305f\\9sP\214\023Ye2\022\315\223O\240\376\022\306\002>\017\303~n:,\205=\204\342mS\262\344=\370\274?D(\376sE k\030\373\320\234\246\222\272\342\307U?\216s\213\335\351x\256i\355\313\304\037\203\242\235/0\360k{\316/}\330\271\3248\271$\231\r\350\020M\212\336\373\177B\355\373\205\271\236\352)\363w\335?\224?]c\277\005\033\237\t\026\034%\265D\321>\034v\030&d\353L\320\376\256\302\330\342\231"
+	.ascii	"f"
+	.string	"Ub\225\0273\246\367\302L\364\005/;\032(\236a\233\0315\224BL\306\257\224\222\361cBXE\003\007;\205\236^\022z5\262X\007n\344\367\320\177\211\256\265\343\235\204\200\234\301\217\371\021\223\022\221Va\355\367\260\205\304\202\356XO\350PF\2753\002\247Pa.\017\237:#:\221\257\310\254\263\035dn|\335Y\325\0174\260\030:\006\026\270F\256Y*\353<\260%7\277\262\006\231\365<\020\232^X\235\200\203\200\203\261 n\312\217KL\316\371\225\324%\314\357\035W\347\374k\262h\220\370V\370`\006\362qjU\322\342\236\327Ih\263\002-]S\371\211\2237\337\275>\374\034\013lT\254\"\236>\002\350\231\274\261\222\244r\002\326\260\306\272\336\307\253h\206Z\352\300x\340GT Q\317\314\240\025\262\362\270\217E0\375\327\241\341\212\001Q\017a\350\360\350\370+c:\267\235\037'\347\306\207\252K\017\322"
+	.string	"V\304\374t\305\361I3\016\261_2\266\300x`\256;\331\322G\013\3318\222\364B\020\020\330?j\256\331 \323\007\231\3635\303,P\327\220uBR\326.0\347I&\035\234\034Q"
+	.ascii	"\215A\321\013tl\252ip\212\0201\317\025\372\257\tf\307\333\362"
+	.ascii	"\2770V#\236Awg\246\002:\236\002c}VX\356\002\225\326E\336\\\333"
+	.ascii	"\316k6\031Z\377\032\341[o\bh\257\226\337$]\016\2653g\277\357"
+	.ascii	"\335p\347\020\236k\222p\331\030\341\276\221\261\370<\273'X\033"
+	.ascii	"\022\364$\322\252\276\362\355\217u\272\036\341))\t\211U\347w"
+	.ascii	"\233\200\271\024\f\271\231\324Qx\315\210\240i\361\007\005\366"
+	.ascii	"+\236\350W\022\330\316VI\233\205\204B{\002\303\270\373\325 \361"
+	.ascii	"\274\300Q\372\005\222\240\377\200\225&\335v\211\207f\323\220"
+	.ascii	"\325\360\201\327>\260z\f\235\253`\330l_\376\271Hw\352\260\312"
+	.ascii	"\204c\307\306\030\334t\217\334\203\357|\211\002\311+\311\350"
+	.ascii	">\\N\264Z,\217\007\r\360\024~TQ\310\244\357\236e\256\034\210"
+	.ascii	"\f|\236\244iM\037;.t\252\363\346WK?Q\013"
+	.string	"\020\334[\351\370\364n\305/@\r\350{\006\3223H\350\222\306\2333\347\255\343\213\235\353\361\277\035Gsds\025\332ava\022\240\200I\020\277\340\n\256\255\3213\331<\022pt\3115\210A\233\fR\233\250\361?\310$\351=\275,\330^\264\240\237\3363]]\327\374\222\017\350\004\211\276\300|\352F\221a\213\365zmv\306\245\234B\304Z&\211\212\213\321\027\fV2F\266\021\351\200-\211\315\333+}\024\350\207\276=\241\t\362o\017\345O\272O\237\362\177 \t\232\254:T\233zo\272\340\035\255\374\260\370GN:/\235y\262\310\372Df/\267\240\262\217_\356l\203 \206k&\t<\203\310\233v\r\300\023LDN\341|X\265\242\364\217\215\"\374\304\275l5\021$e$\035\322\306\264\212\362Gy!I\347\003\273\205\212a\375\220\374\213\323\023Oz\031\273\b\264\366\277\2278\001\020*\265\240\0170\250\307"
+	.ascii	"\201f\211\200\265vQ\371\302#\340'\246t\343\rD6L\274W\234)L\202"
+	.ascii	"\271\t_V\275{f\362Q\347\331|\250O\267r\3547\314\277\3251"
+	.ascii	"=\n\023)\021\"\330\313\033\311\n\241q\371\017\036\313\301\372"
+	.ascii	"4\347\312\312\324\205PN\317\004\274qd\263\003f\004\235,\033\245"
+	.ascii	"\322\016\274O\013\366\001\313\237\177\016D\025\250Q\203\230\325"
+	.ascii	"\341\266\n\362>\230\0176P\326wJ\317\244\276]\016\013O%\343]\226"
+	.ascii	"\375f\362\350\235\200\365-Y\243\344YUT7&\340\340T\bj0\036\253"
+	.ascii	"\r\177hTb[\0208%\307h\331y\316\025@\343\241\202m4\312\261\254"
+	.ascii	"\007\235\361\322\003!9\3160\007\3766\276\270\021\326Z\223@\362"
+	.ascii	"\320R\025\030\273\332\0241\037\007\356\365\310r\273[\026\213"
+	.ascii	"\313\3055\303\260M\323\3641v\375\2119W\273R4\b\032=\346?\370"
+	.ascii	"\270\375\026u\376\347\223\022\220\214lv\302\323\272\303\362/"
+	.ascii	"E\374\331\261x\307\262\356:\346\355\374:\235\257\324\313\256"
+	.ascii	"\375\251\360\355\257\366\273\342\307\274\267\245t(';\3351{]\262"
+	.ascii	"\225-\211\372\204\261\376D]\331\241\345h\253uQ\312\313\226~6"
+	.ascii	"\245{\344x \352\303j\362B\313yQ|\327\217u@\322\337\2225\\\211"
+	.ascii	"~G9\357\367M\273\337\f\217\\\271%.;4w\272v/\230\356\213\370w"
+	.ascii	"d\221\347\270\303\213\341-i\322\221:\317\034r\245)=I%\f@\330"
+	.ascii	"oi6\254\353@0\307$9\300e\003\320\216\006\365G3\341-\034U\363"
+	.ascii	"\005-\236\314\3541\205Cg\371N\251\364\223\210<\215\307#\277\214"
+	.ascii	"J\366o\252\276\223js\216\316\215\252r\243Y\276x~\020\351\223"
+	.ascii	"\212p\240\232\215\251\334\253Z\347\276\304\311\340\256\211h\346"
+	.ascii	"\250\343\320e\362\007S\0319\346\321\022\246\204M\341^\321\260"
+	.ascii	"}\230i\357b\021\217\033\333\342W\227\037\303\357O\277\013\201"
+	.ascii	"\377H\370\264\277?\020x0\352\314\217\233\2372,D\362Y\264\341"
+	.ascii	"\207\366\330\"\007Q\366\207\304\257O\342\3715\275\273\275\236"
+	.ascii	"\201\373\227$\256 \207.\251R"
+	.string	"\313\332\037\206\336o\230m\225\300\002\344\257\275\\\3265zk\341U\223\276\261\323\007\025\313G\366K\366]\373\360\n\304\326\311\036\354\270\353\373\226,\347=*\253\036\203\237!<\027\034\236\357/O\342;Oz\247\256?\b\363\n\371\266\270\273\034\037-\274\323\265\017\013\255\232\217\213\307\224\201\263E\377\025\354\360j\337\020\270\261\274/\340\271\310\334\254\300\037\036.\324\034D\274ee\247R\331\004\374J?\270\021\274B\205\367\301\336\t\033W\b\257\257 'Z\334\320ky\217\260\321\035\2611\332\311_\302)0\007\2134\227\307\367\251\347\264eF\370\004\351M\202\356\003\377-\177{\230\177\305\373\215Z:c\177\372\274\301nK\026K8\237\202*\237Q\372\017\277F\223\271\335+y\335\350\206\344\214C\363_\317\227\320\344\266\252\255:\233\317p.\364\345\331!\262\027\370l\273\357\243\355\277\355>\374\350\032\241\330\024\303I_\317"
+	.ascii	"rS\3025d\\\312\210iM\216\020\177\307q\207\350\277Qzf\036ut\346"
+	.ascii	".\362>\031\212(\374x\356\320?"
+	.text
+	.section	.gnu.lto_.symtab.7e6f104a56ecd542,"e",@progbits
+	.string	"AccInflightCalibrationArmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\003"
+	.string	""
+	.string	"updateMagHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"calculateThrottlePercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"calculateThrottlePercentAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"isAirmodeActivated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\003"
+	.string	""
+	.string	"subTaskTelemetryPollSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"isFlipOverAfterCrashActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\003"
+	.string	""
+	.string	"getLastDisarmTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"isTryingToArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\003"
+	.string	""
+	.string	"resetTryingToArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\003"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"pgResetTemplate_throttleCorrectionConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"throttleCorrectionConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\003"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\003"
+	.string	""
+	.string	"throttleCorrectionConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\003"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\003"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"loopSubtaskUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\003"
+	.string	""
+	.string	"isGyroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\003"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\003"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\003"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\003"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\003"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\003"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\003"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\003"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\003"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\003"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\003"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\003"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\003"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\004"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\004"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\004"
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\004"
+	.string	""
+	.string	"warningLedFlash"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\004"
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\004"
+	.string	""
+	.string	"warningLedUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\004"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\004"
+	.string	""
+	.string	"pidAcroTrainerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\004"
+	.string	""
+	.string	"imuQuaternionHeadfreeOffsetSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\004"
+	.string	""
+	.string	"wingMonitorReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \004"
+	.string	""
+	.string	"loopOverrunReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\004"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\004"
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\004"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\004"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\004"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\004"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\004"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\004"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\004"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\004"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\004"
+	.string	""
+	.string	"pidSetItermReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\004"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\004"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\004"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\004"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\004"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\004"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\004"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\004"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"mspSerialReleaseSharedTelemetryPorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\004"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\004"
+	.string	""
+	.string	"pidSetAcroTrainerState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\004"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\004"
+	.string	""
+	.string	"pidSetAntiGravityState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\004"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\004"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\004"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\004"
+	.string	""
+	.string	"loopOverrunCheck"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\004"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7e6f104a56ecd542,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,326 @@
+	.file	"dispatch.c"
+	.section	.gnu.lto_.profile.2c0b429c173cb9c4,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.text
+	.section	.gnu.lto_.icf.2c0b429c173cb9c4,"e",@progbits
+	.string	"(\265/\375 r\305\002"
+	.string	"\364\003f"
+	.string	"\006"
+	.string	"\350\300\306\254\005\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\236\376\250\313\b\003\200\276\204\276\004\f\002\001\002\002\002\003\002\002\002\004\002\004\002"
+	.string	"\002\002\002\005\004\005\255\302\354\351\001\016\004\002\004"
+	.string	"\t"
+	.string	" `%"
+	.ascii	"T\004D\005\340y6U\273\275\340\200f\3030h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.2c0b429c173cb9c4,"e",@progbits
+	.string	"(\265/\375 *\365"
+	.string	""
+	.string	"\240\036"
+	.string	"\004"
+	.string	""
+	.string	"\003\002"
+	.string	"\001\003\001\001"
+	.string	"\001\005\002\001"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	">I\327\fg\003X"
+	.text
+	.section	.gnu.lto_.inline.2c0b429c173cb9c4,"e",@progbits
+	.string	"(\265/\375 \264\225\003"
+	.string	"R\006\027$\200K\322\001+\255px\001\201\b\r\263\206,\342c\353^$\243I\225G\320\004=\374/\350\242\244\221-w\n\377\007P\202yL"
+	.string	"\277\272iO\304\320?\365\356\276\205MC\271\020v>8\356O\200\026\351\023\310\032\017+(\260b\3110\006c\377{UzD\333?\205\231\231\350\321\220\007"
+	.string	"\374CQ"
+	.ascii	"O`IG\021\311\"\257K\250\033h\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2c0b429c173cb9c4,"e",@progbits
+	.string	"(\265/\375 7\245\001"
+	.string	"\324\002+"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\003\001\001\003\177\002\007\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	""
+	.string	"\177 \005\002\001\001\017\177\002\002\177\002\006"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.2c0b429c173cb9c4,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\204\004\002\230\004\003\232\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2c0b429c173cb9c4,"e",@progbits
+	.string	"(\265/\375 \272\005\003"
+	.string	"b\304\f\025\260%\351\200\035\rs\220$I\022\352T4B6i\255\221$S\236c\221-k\205!Z9\267\250py\335\317w\304\316\354\310\303\362\020\330\360\3213\020\020\021"
+	.string	"T\025"
+	.ascii	"+&0\033\003\025\226B0\254\033\200h\363\205\035;\213,\330a[~\360"
+	.ascii	"\\\363MD\230\307v\346\200m\033h\003"
+	.text
+	.section	.gnu.lto_.lto.2c0b429c173cb9c4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_dispatchIsEnabled.22.2c0b429c173cb9c4,"e",@progbits
+	.string	"(\265/\375 \340M\006"
+	.string	"\242\313+3Pm\222\016\244\204\265`\316 \212\022\227\004  kk.\270k\2678Z\273\333ag\367t!c\243m33\3136Q\274(\215\034\364j/6\315\356-SS\231\007\312\243\341t6\f\215rh\021\033\rD\243\254N\313\020\\q\032\254\346\251*\253a\262,\222\016\013D8\361\375(\310u9\226\370\\\261N\367\003\320\351\360\222!\272\322g\241C\215\257%\221\364\337\207\027\024\201\223\314\213\322J\226L$\035?\3501'(\200\276\006(\320d\244BD%3k\270\321\253w\335z\324 $\005\033\205z\001\013\231\371a#\214\216\375\017~\204\337\"\b"
+	.ascii	"2\003\316:#e\b\3055\321-\002#!\362\270\033\235v\222\001"
+	.text
+	.section	.gnu.lto_dispatchEnable.23.2c0b429c173cb9c4,"e",@progbits
+	.string	"(\265/\375 \343]\006"
+	.string	"\202K,4PM\324\001\244\034\360\"\346\362\210XT\246\275\245w\270\211"
+	.string	"\b\271\250H\fk\373\261i8a\217;\200\231i3\246?\334tf\177^g\222\377\337\310\337;\245\256\221A\305\244\352\232\006h-\240\b\223t@\253u\321(c\252\"\260(FQ\026\205\304\375\f\001D\222\220n*\370\317\036\337\342\027\231/\341\004M\376\273\343k\317\035\351\361\361P!\322\311\321\02699!\354Ov\206\366\024\3602.\033\273\rc\311v8\032\023\266\017y\263A0\013\026\016\017cdw\351\214\370v\271\371\247x\345\003\271KJ\300\356Z~\240\303=o[c{c\233!\b"
+	.ascii	"3\001\0078\003R|\241k8V\b\343e\210p9\026\355$\003"
+	.text
+	.section	.gnu.lto_dispatchProcess.24.2c0b429c173cb9c4,"e",@progbits
+	.string	"(\265/\375` \002}\022"
+	.string	"\006!xH\300\224Q:h\243\344\256\222\005A\035\305oJ_\263j\346\321\257Y \232\260\202(Fq\361{0f\214\f\377\374\370\036`\277\370sz\372\203\367\257$\030n\273\317Ue:\310\223\351\220\"\255\351B\243\300\310'dK\231Ra"
+	.string	"\\"
+	.string	"g"
+	.string	"\b\300{&_}\367\344\003|\367l\367\030\240!e\203\306h\310\2343\334\021\366t\366\317\223\2533_\350\252\037\"&\335\030\363\257d\234\031\272n\030k\352\241\270\271\224\f\200|H\034w\265\031e\344\342r2P\343\214\356\207\276\352\2511\351\306\233\353\251\301\234\323Z3z\270O\267=\263\r\301\326\007\001\307]\325d\003\001\024D\323\335.5\341t\2739\366\255\246G\301A\243\204\327f\237\324\251U\203\017\372O\237Zz\352\225j]\365I2\320\344V\27399\354\214\314\033\236\022\217?\364\242\227\023\331@\017\3567\033\365b\243\356\035e\373j\377\347@\263\007\301\030\300\234\"\204^\314yS\340\273\207\361s\361\263S\236$\202\002\026\254\360\t\242\353\2738R\314\3371KE_\243\222\243\346\007\255u\035\006\020\324M\240\202\b\213\017\266\031\322\025\276\324mpB"
+	.string	"Y\252!\243E\fnjOBh\216|O\013\356\213.S\214:\220rG'j\272\263\355z\016\246d\307\234\023\305?\272\360:\240\263s\317\217}\367\276\001^9\211Yh\311\\B\226\227\313\365\022\013\260\\\255\b2\026\026\f\346\"\242,\236\254\210\262\224\226XkB(R\bYZ)\256P\204\305\302\023\002~\265\260`\241\354\365\202\205\250\033\355k\023\272\344\351@\304\007mk&\276\3151\272\\\007<b\310M\352\2511\265\300\241\351\356r\3169=\225\312\365\256Md6\306\266\204+\271\220\350\254\002. \200\002\221\262;\007\223d0\f\254;\376\r\264&B\326L\315\r`p\033\210\361\214\fie\353\215\321\227\201h0\004-\3275\"ob\027wB\220\265W\331\013k\313\357\373\360M\350\262\221\262\005\034\314t\003\231"
+	.ascii	"\032\345\"\256\b\350\027Z\032e\026\340\216K\244\3563sl+-\r+\264"
+	.ascii	"?\223\361\361w\264\203kC\303tu2"
+	.text
+	.section	.gnu.lto_dispatchAdd.25.2c0b429c173cb9c4,"e",@progbits
+	.string	"(\265/\375`\205\003%\032"
+	.string	"\026o\247I\260\226Q:\025 \306\325\030Q\327|\025i.G#\333\3002\200\207\274\350-R5m\t\264\034\n\246\n\035\275\321\207\354\250\233\021/\263\317\257\333<\207\030\363\337\240\376Q\367\227\230P\377\324\257\r=\261\207k\021B\366\226;\311\215"
+	.string	"\213"
+	.string	"\225"
+	.string	"\273\023x \267'\255\222\005\320-C\312\251\273\035,\r\371\252\200~\356\336\307\217nG\372\271\253\233\210\210S7\320\301. _\027x\031\361\225<\001\361uo\273U\f\220\020\320E\267d\325\335%\323X:o\037\305J\231\234\267}\017\350#\213\213\254^nV\312IB\250V\257\004\215pdd\203\304\244\001\212\202\316d\320I\312@(*\350PR\370\250\314\223\031T.\374\344\365ts\216\022\272{\347\256\247\342\013\340\273\233bw7\354\362.B\2719\\\030\236L\253tW\2709\334"
+	.ascii	"s\027\2076\277;_x\013:\234\266\\\3111\320.07\371\367t\365[Z&"
+	.ascii	"\232q\211sc\216\364\017x\360\333z\322\017C\212s\307\317\025?"
+	.ascii	"\267^\351K\307\271,\316\235\342\334\027\340\027:a\201(\335(\206"
+	.ascii	"^\332I}\322q\245?\270\037r\246]\326\366\\\310\326\241\240Qw\263"
+	.ascii	"zvY\257\377\322\205\313\332\335\240\017m!\023||y\240d\223\220"
+	.ascii	"3QA\352\352J7\260\301\353\276\002g:\005\0360\250\212\240\202"
+	.ascii	";v5\034\312G\246Fw\277\022\214\\\207\202=\220psx\236\232\222"
+	.ascii	"\304T\371\2677ER\354\342\312\205\334\r6\b?\214\272q\337\221\314"
+	.ascii	"kze\021O2\373!\3676\361\265\362\003_\024\236\013\332\335M\371"
+	.ascii	"\367T\323\242\332\355\302\216$V\244&\223\251\341\342\227\317"
+	.ascii	"\312n\005n\016yH\f\242%\314\277\375_P\232\334 \257#2w\b\"e\304"
+	.ascii	"\344\262\273\037nD\347\265/\302AFv\367s\374\210\257\314Wj\201"
+	.ascii	"4\371\334\342W\225\b\013\202\206\347FV\353)g4\034\034\032\f\301"
+	.ascii	"\215\2546\303`\023\023\220s\036\f\266\232\233\230\315h\333\251"
+	.ascii	"\315bua4 `\265\232\034\036\231M\t\363P\316d58%l\207\247\2449"
+	.ascii	"\260\264\234\330NY\243\321vJ\026\020w\316\005\307J\362RJ2e\336"
+	.ascii	"\254\225\307\334\t\335\021\372\246\213\314\333\035\300\373$!"
+	.ascii	"~&\225\201\023TBG0~\035QJ\247\0165Yi\211\362\031{M=|\"3\211\301"
+	.ascii	"\\\360\rwXps\210C\314 \316\270\254\246\200\262LE\305\360\f\217"
+	.ascii	"U\272\253\026\217\034\303\001E\250q\030\310\020#J\221\221\221"
+	.ascii	"@\210\026\024\246\003P\002!\204\224y\021\36054\266)\354\006\332"
+	.ascii	"\300\327A\t)\212\232ICLF/r{\266't5\025\036\235\271\240\354\363"
+	.ascii	"\216\001\305\234K~\275G\246\254@\277>\002\3657\231\227\307U\033"
+	.ascii	"@\336<c!\2219L\22619?\360\003K\216\253\203\336\307x\306\"\034"
+	.ascii	"\307O\316\354\b\263\202\002\004\371t\210R\r5\246\372g\262\035"
+	.ascii	"\307Ym\"\364w\242)\262K\205\203\371\356\020&\353\b\214\031\375"
+	.ascii	"\350\ri%\2715\002/A\016\"LR\345\003\332}_$\357U"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2c0b429c173cb9c4,"e",@progbits
+	.string	"(\265/\375 \246\215\003"
+	.string	"\304\005\242"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\026\177\f\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\025\r\200\204\001"
+	.string	""
+	.string	"\003\002\027\177\016\002\030\177\017\252\333\3426\024\020\031\177\021\305\245\376\322"
+	.string	"\001\032\177\022\377\037"
+	.string	""
+	.string	"\200\200\200\004\003\330\244\235\311\003\001\265\006\003\005\006\305\245\376\322"
+	.string	"\001$"
+	.string	"\007"
+	.ascii	"w\204\002\3412\\\366@\217 k[!Q\204Vz"
+	.text
+	.section	.gnu.lto_.refs.2c0b429c173cb9c4,"e",@progbits
+	.string	"(\265/\375 !\t\001"
+	.string	"\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	"\001\002\001\001\001"
+	.string	"\002\003\001\004\006"
+	.string	""
+	.string	"\004\n"
+	.string	"\001\005\002\004\007"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2c0b429c173cb9c4,"e",@progbits
+	.string	"(\265/\375`)\t\2552"
+	.string	"\332Y\244\023Hp\032V\007\001\2228\302\001\313\324\207\220\n\274!\031\263\307\033\331\303\210<\211\260A\232\2609O\324\035h\311\352\003\373\346~\322\260\223\"Zr$\224_\354\0065\220\013\333\217\221\372\217o$?\200\345p\013\210\266]eJ\001\t\001*\001(\001Q\267\322m;\377\007"
+	.ascii	"\254\031\022d\212\331~\363\260\356\336\245xa\346\305l'e\237\342"
+	.ascii	"c\036\3459Y{\024\227\322;\345\373\320\377\327g\247\246\206\206"
+	.ascii	"\024\263\335!\267\363t>\316\323\365\204,\344\003tl\230\324\253"
+	.ascii	"j\323&\230\215\272\324\241\274\037\244\223\274j\2430\333\275"
+	.ascii	"\334\376\244\005\200\275\204\346\311\235\363\017\030\217\247"
+	.ascii	"\215Z\322\0137\351v%\376\345O\034w\312\371\322\377\027(G\211"
+	.ascii	"\331\r)f\375\211\235\211\277\355O_\322E\022zG\371_\377\257?\331"
+	.ascii	"\177\244{\202\036\367\004\271\262\037H':\266q\356\327\007\350"
+	.ascii	"\262\013\320U\275]\307\333t\367\225\356>\353\356.\236\273\233"
+	.ascii	"\313\202n\007\020\240\333\303\264ua\273\335J\267{w_\273\373\255"
+	.ascii	"\273\335\272\273\255\273\313t\367\230\356.\353n\264\356\376\322"
+	.ascii	"\335L\272\233\254\273Ct7\230\356N\353\356jwS\273\273Iw\277\335"
+	.ascii	"-\240\273\267tw....\256\333\033t\273Tw\316\210><\215\253|\252"
+	.ascii	"\245\026\222\371C"
+	.string	"u_\347\257\375\273\024\352\231\n\376\265\234\3145$\226O\223T\252\244\030\322\351\357\377\027X&o8_Iu\2138\377\213$\231~\031\241}\251\317\303\251-\227\326OA\375\033\370\367\177\371\337\372S\377\277\375\377\034\246\326\373/\343\307\355Z.\377\263\202\226\257\325R\201\372\307R2\323\246\013\275\341\364Q\211B\273\276\305\333z\327\257m13\264m\362S\377\357jrW\363\205[\030\263\236\257\"\344\005\203\226\263@\301-\323\252\230\b\265\206Uu\007\006&V\005\215\212\221\034)cb\366K\220\317\217\352V\016\314\266c\345\366\257\"\t~\346Z\374\331\323\276_U\304\244\005\234\325\277\374\314\305|\352T\351\205\257/w\002\365\260\003Iw\003\334\0224\020\272}gN\305\315p^!\377\\=z\320\336@\261b\375\177\2758\027\357\342[<\352g\016\245\035\213g\351\240\367_\371\377CCCCA<fU7."
+	.ascii	"l\233\310\370}\200N\310\254\254\347\f\214\037;0\353W<\215Z\231"
+	.ascii	"\024f[D\356\366*\036\355W\2361/+q\230u\253\303e\026\327$S\270"
+	.ascii	"6=h\226H\250/Sqd.\272\214\215AEI\027\037\271]\215\373[\324\337"
+	.ascii	"\034-\350}\253b\330\224Ac\035\271\335\321th\320\270[~\021x\241"
+	.ascii	"\272z\355h!\223r\323\264\273\261iO\265\265\251\316K\325\025\016"
+	.ascii	"\263\215\261\314\230\3616g\323\302C\343\215\212\321\226\253\026"
+	.ascii	"\001\022\005\263\215\335\334\376t/\023\3652\376\364\367\253\216"
+	.ascii	"\2420_\006\355\326\334\256\346b\332\327z\315\307\354\262\036"
+	.ascii	"\207\214\030\325\325\372YY<vl\354\r\bf}\314s'\204\310\215)\261"
+	.ascii	"\334\270[\367H\346\377[\345\336g&wt\236s\347u\3638\216+\350n"
+	.ascii	"\366q\372\200\217\177,\2665\231\b\031r\006f\273[\350\333\353"
+	.ascii	"\277\005\372\367\231.t\253u\237T\233@\357\333 \360P\256w\337"
+	.ascii	"\255&\353|\374\357\373+\267\232(\334\327\311t_g\373\363Jg\373"
+	.ascii	"\3776\177\\)\262u\027\272\325t\241\316&\320+\277}(\322FV:\233"
+	.ascii	".\027g\363\307\205\"\233\256r\253\tt\305\206\203-\312H5\315D"
+	.ascii	"dl\022\036\237zC\242\223\023\361\227S\004\341\204\323/\327LD"
+	.ascii	"=c1\230BX\004\0328*\031\223\202N\302c6\022\213?\241\223\016\b"
+	.ascii	"\244\240\003\\\n2\261Fc\360G,~\350\371\001\203M#\226\206\030"
+	.ascii	"\214\034\200\372',\006\207\301\022\271#\03090:R\221\323GH\017"
+	.ascii	"\220\036\350\372\b\311\347C2\362\3456\362\341\034\231\n4\361"
+	.ascii	"D\260\330;\022\211\305\236N\360\t\304P\230\373\r\2372\354\344"
+	.ascii	"\243R\021\204\343P\370\224\233\204\307a\0220\270b\251)\b\334"
+	.ascii	"1*\255(\036\207\030|\332\347\263 \224\344AC\376\0211\375\216"
+	.ascii	"K'\214B`\357G\2427\024.9\365~Ec\217(\350\250\"8d\233\210\304"
+	.ascii	"\nJ\271\356\306S\270]\343B\"\205Y\234\304I\354b\327\376\353\244"
+	.ascii	"M\301\252b\375,\030\274n\314\242\261\213(\254\f\313\n\303,\206"
+	.ascii	"\302-<\332e\330}\037\347\201\245\3451&\253\310\3512\035V\372"
+	.ascii	"t\227&\203\214\230\264\374\346\rn\035\354\253\"0\271\352\262"
+	.ascii	"\376g\3612\026\021$Q"
+	.string	"\270\305\317f\026w\305l\334\016\362j\f\355\231\033{\261a\343W7TW+\216\325J\253\352&\200\254\250\261,f\020DFdFDd6\005)\034\220\002\221)\263m\0210)\223\320\324H\223\312tL\n>\372\347\335N\353\232\260d\"\365\036\3613\267\270\337\273$\233\037\217\344:E\234\275\314\353fZ\247s\316\207bNSN\240\3412\223\213R{07\037\217&\340K\f\3042\377\344\2774\351\024\265\330g\020R\262\356\341\327\317n\034\361!\345\226J\n4\350\270NR\344\265\363\273KYP\222V\371\342p\245LH)\002\245+\276\025e\226\267\332A\003\273\307)[\243\277\005\032\024\202s\214\201\002uk\360|\262]\354<DS[\216@\222\226\365\344\236\304w\310'J\333+\264\313\265\262\225\357\220\033z\003:.\231&\236=\360\272\223\215\344#\005VF\327\0238u\351\247&\021g\025Q_q\324"
+	.string	"e\023`\202!b\007\r\f\221\364\\\236\360\361\325y\242E\215\322'\342Iv\254\263k\200\025\276\361\361\366$\377\377i\002>y\\VP\342!q\320\021\344?\370\300\217\252\002\276\234%\016~\033\013\373\312\n\316"
+	.ascii	"p\003g\006\332\367\013\244\"z\3605\303\225\277}\3748\340\371"
+	.ascii	"\250\236\255\257\333\276\366#\361i\023,v]\037\345\316p:c\247"
+	.ascii	"4\b\027\b\227s\360\267\342\302\275\035\360\231X\367\347\277\206"
+	.ascii	"\305\204\366\202\264\n"
+	.text
+	.section	.gnu.lto_.symtab.2c0b429c173cb9c4,"e",@progbits
+	.string	"dispatchIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351"
+	.string	""
+	.string	""
+	.string	"dispatchEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"dispatchAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2c0b429c173cb9c4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
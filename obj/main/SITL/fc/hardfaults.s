@@ -0,0 +1,234 @@
+	.file	"hardfaults.c"
+	.section	.gnu.lto_.profile.a2c2b590e1911f60,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a2c2b590e1911f60,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\001"
+	.string	"\223\344\350\214\003\002\002"
+	.string	"\002"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.a2c2b590e1911f60,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.a2c2b590e1911f60,"e",@progbits
+	.string	"(\265/\375 @\335\001"
+	.string	"\024\0034"
+	.string	"\001"
+	.string	""
+	.string	"\t\372\341\240\227\002m\001"
+	.string	""
+	.string	"\002\b\200\200\200\200\002e"
+	.string	""
+	.string	"\004"
+	.string	"\201\200\200\200~\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013\001\001\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"hJ\224\r\264\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a2c2b590e1911f60,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\002\002\006}\0012"
+	.string	"\001\300\004\0012\300\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.a2c2b590e1911f60,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a2c2b590e1911f60,"e",@progbits
+	.string	"(\265/\375 \030\225"
+	.string	""
+	.string	"P\f"
+	.string	"\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002"
+	.string	"-Al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.a2c2b590e1911f60,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_HardFault_Handler.18.a2c2b590e1911f60,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"=\n"
+	.string	"\366\022E: \261\322\001\037\202\242\033\032\211\t\240\027|Hj\342\252\206G\362\b\377\027\200\212\327-V\\\333\266\021&\f\305\306\271\027E\300\200\202\3203\260\007\020)Xf\253O\266\377\226)\0053"
+	.string	"5"
+	.string	"3"
+	.string	"\246\253zG\247\\\225o\300\361\016@\3548\025\370\334\270\334 \264F\217"
+	.string	"\261\265\361\340\\.?\371^\210\341n\227Pk\365\276\304\214\233s\333!\333\005\3667\0373X\305\346l\332je\210\375i!\243b\031\263\277\336\257\317Y\240\2153\004\271Z1r4\3256[Ll\277c\225\035s\332H}\255\306\2652\326Z=)\022\265\322\331\255]:\355_\366\260\200\330B\271zH\"\223)_\031\252\301\260\026\347y\024\275\\y\027,\374\354((\277\304\024\251\375\353\323O\321\317\313\027\rY\026}J\246\210\023h\304"
+	.string	"\202\034<\321\310\223x"
+	.string	"\221<\021X\362>\003\376&\032@\317\364}\240\327\261/c\356d\314vg\017\016Am\322\247p\033o,\271\372\277\2515\023"
+	.ascii	"G\b\232Q\271@\265\035X\203:\274{(YpZ\205\205x\260\206R\033g\306"
+	.ascii	">[Zy\301\"\310\fn?K#-\242\233\272cJ\241\240"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a2c2b590e1911f60,"e",@progbits
+	.string	"(\265/\375 o\225\002"
+	.string	"\202\304\020\036\2405\351\017V5s\344|\341\213\201sH\264&\354\355\377\377\037e8\326v\031!{\313\024\023@\324\266\265\261!\231\200\300\266tF\265}\344\200\356\340\237X\221~.\035\374}\341ar\f\204:\242\376\225\004"
+	.ascii	"\240\206OVF\211\213\f\224\001"
+	.text
+	.section	.gnu.lto_.refs.a2c2b590e1911f60,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a2c2b590e1911f60,"e",@progbits
+	.string	"(\265/\375`\330\003U\035"
+	.string	"v\370\307I\240\230Uc\2015\fxq\004\316Yb\344\311\374\213`gn\307\031\236\356\001Z\2206\226\314/\232h\374\342\332\332]\016\331\373\277\235\374g[\220w\270\032\005\276\246\364T\024\264ic\013\370\305\361\260\006\353\224f\370>\3312\005\243"
+	.string	"\255"
+	.string	"\262"
+	.ascii	"W\212\245M\303\341\237\2643\374\022:e\364\227\307.L\210i\313"
+	.ascii	"\264\332\246\212\264M7\301\242\267\351WE\325lQ\343\217\376\337"
+	.ascii	"1f\023q\205\230\362u\203\\!\327"
+	.string	"8\273Q\276Cnk\033!\373\366gsp5\2148)_=W\007\366J`\372\262\316)\376\201K\323w\006\313\2713\230}\201\330\367\307\205\342q\245G\353\217?+\313a]\fi\224/\263W\007f\336\001M\254l\037\241\330^\362\304\366\201\033\373\256\260]e\233\312\266\224m\244\355\3266\224m\230\355)\266\313\255\255\255-\333\035lk\331.^9\310\230=\244\2001\312\227\355\236\323>aU/\004\022e \322V\215\021I\022O\034\250\312R\366\217\300\252\027\262+\032;\225\242\232\n\201j\354\355\321\364\353{\322\026\250\342l\221(K\331\"1m\213\304X\332\256\350\277\022\257\312\002\321TX|\021K[ \361m\021\225\245\255\016\036AJ<iq\303\244\302#\r\227\200j,\231\262\353\257\376{4\272\212\340_Z\325+\340\213\313$\230D\n&\001\256\227\375O`\030dZ/L\246N\353\357\024\324}\350"
+	.ascii	"e\223\277q\223(\215\245\037\031\375\005\316\376\303\037\275O"
+	.ascii	"\376G\377\327\250K\354\003S\227jgu}\201Bq&\353O\232\t\340\002"
+	.ascii	"\306\212\322m\342K\005\240K\t\344\261|"
+	.string	"\031\353\022\261m#@\212\221\250\345\311\264/\222k\274H\256\324\215z\212\fG\024,\262~+\0056\317Q\246-_7\311Ur\215<w\211\013\215:\024\216\226\017-3\345\313W\311\364\345\201\335\255\313\003\363E2}\213\\#\276\307k\274\307\213t\354\177\360\237q\005\202\021\313\204\214\254'=\315\314+N3\236\260|\221v\203\007\006s\363C\375?@\203\305i\307\221\362\345\rfi\303\016T\377\253\240a\257\006o|i\356\235\3318\327u\021\330~\375\266]_\376\243\326\321|\271\021\273\242\332\251\363\260#\032\372\371zg\357\302\207\336\371\003`\035\255\366\363\345D\354|8\0227\242\034\216\306:\332\271\343\355t\316\240\237\223\267\013Q\223;o\247\206\242\334\371#\361\013`\003\356}\310\371jg\257\347\253\005\360\345\210p\274\233\205 \n8\337\315\202\314B;_\216\227\363`\332\201\317\002\237\237\0215\376\001b"
+	.string	"\304"
+	.ascii	"\346\037 \233\r\310\307f\332\307\346:\203~\027rE\273\323\264"
+	.ascii	"\315&\241\207\003\206\n\246\020\355w\022\205\270\r\341|7]Mh\250"
+	.ascii	"\306\333\335\212jB\276_\215V \n\025\016\253\345\303\213\025\362"
+	.ascii	"\205\204a\203\t\312\225*\263T9\n\226\257\252\252\213\334Y][\322"
+	.ascii	"\024IO\345\326\216 \216(\346T8 `\002\0211j\035IV\256[\334\317"
+	.ascii	"\3347\227\333yc\354\220\315@K\354.P/XY\200V\325jL\242\340\026"
+	.ascii	"Q\2735F\237\212}\025[-\022\302\t\311\260\264\227\302\fp\331\240"
+	.ascii	"}\335\256\206\204\366}\\\016\331\205\003\223\0013\261\022\267"
+	.ascii	"h\346\200>M3\252}\265\r+\f4\333@\356TX\263`\007d\257Yzs\353\266"
+	.ascii	"Sr\217\322\354f^\215\013d\327\277\310\376\332\356\330\206\213"
+	.ascii	"\254\017\263\036/\353\334,@\001"
+	.text
+	.section	.gnu.lto_.symtab.a2c2b590e1911f60,"e",@progbits
+	.string	"HardFault_Handler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"systemState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323"
+	.string	""
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a2c2b590e1911f60,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
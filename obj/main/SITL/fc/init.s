@@ -0,0 +1,1531 @@
+	.file	"init.c"
+	.section	.gnu.lto_.profile.cb8736be812cdafc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cb8736be812cdafc,"e",@progbits
+	.string	"(\265/\375 j\025\002"
+	.string	"\004\003^"
+	.string	"\003"
+	.string	"\233\364\343\336\006"
+	.string	"\001\377\271\361\364\r$\002"
+	.string	"\001\002\002\003\002\004\002\003\002\005\002"
+	.string	"\002\004\006\002\006\002"
+	.string	"\002\002"
+	.string	"\003\352\263\360\321\b"
+	.string	"\006"
+	.ascii	"9\273\001\002\004U~%\263\271\0026\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.cb8736be812cdafc,"e",@progbits
+	.string	"(\265/\375 \200-\001"
+	.string	"xt"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\t"
+	.ascii	"1\t\300\035h\271E\fp\340V\260\263\2749P`\200\005"
+	.text
+	.section	.gnu.lto_.inline.cb8736be812cdafc,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"E\005"
+	.string	"\342\204\021\035\220E\351s\355\273Md:m\201\310Y\230\026\002\345\356\377\377\037\331\366\030\265\237H\231\002'\004k\254\275\372\221\241\254\315\325Cq\365\337`*\021\006\221\322g\323B"
+	.ascii	"0\021\232\337\342\235\273{\270\364\356N}\247 * P\0021\350\370"
+	.ascii	"\025\007@%\3104\260{\203\007V\206x,A\021Q\022\007\310\002|\032"
+	.ascii	"t\333@\026z`\200\026\300\034@\260\316\300\025\204k\034\254\b"
+	.ascii	"\364\341\373\202\220\030\002\375\013\224\n\023>\300\332\201\031"
+	.ascii	"8\354\341\324\t\3107s\214$ \343!J0oM\224\323\026v\357\310\001"
+	.ascii	"\315kw\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cb8736be812cdafc,"e",@progbits
+	.string	"(\265/\375`v\001\025\t"
+	.string	"2\f(.pK\222\016\374\257\242\035>\204\256\335\001 \240\036G\202\242\221/\312\264\356\377R\204\037\303\251\251\n\335[2\023\372\035\242~\263\273\221-\223\fL`\250X\034\307\231\"\327\312\203q\201\3751\b\202\302\202d\216\034\t(Ic\326\332r\345\352\351\311\361\311\365B\320\264i\362hpx\270\314@\255\020WE\256\013\036\334\021\3015(1\3213v\254\024\250u\216\337\270s\005P(W\\\327\227\373\313uf\nP+\371DO4\3064\246\241\301\355\23373DI\215V\322l\264\305\265$'Y\036Y\212: \220\002\t\320\215\036`\001C\252\333Ux\251\330\332"
+	.ascii	"\262\322\016\f\374\323\034-k\022T\020\\0&St\327\327\254[\032"
+	.ascii	"\3709\230\206\350Dn\320\020\220\004\020\260\013\213\031\302\266"
+	.ascii	"HT\210c\004:6`\260\013\220\270\032\003\2141\200\177r,\033l\026"
+	.ascii	"\334wr\t\225m\035\025\265\016:\242\0347p\332\307\376>\025\206"
+	.ascii	"\303\353F\251\200\016\323\3200\217\261\356(\204\303kS\035\003"
+	.ascii	"\267\035\203\202\003"
+	.text
+	.section	.gnu.lto_.pureconst.cb8736be812cdafc,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\001\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.cb8736be812cdafc,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.cb8736be812cdafc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_processLoopback.160.cb8736be812cdafc,"e",@progbits
+	.string	"(\265/\375 \273\365\004"
+	.string	"\322H!+pU\323\001\2005\332\301\345^8\316\035\260{\204\177\215c\304\004j\004%\323\260\211\225\350U\325Q\341\331\373p9\204\310\"\271e\n\226\"\013Np\245\305N0\301X\251zlT0\325PTkQT\265P|\352f\200h\304\216\330\323\212\235\201\377\267n\366s\304\316\263\233\177\022"
+	.string	"p\216@\203\261\235\220/\273\223\361\362\344>\022\256\373\277j\311+\337\345\314L\0222\r\3137@\374\367\3134JZ\363`\033\006\b"
+	.ascii	"3\003\316\231!\340\313\3532\376e\\p\351\306lm\327i\001"
+	.text
+	.section	.gnu.lto_init.161.cb8736be812cdafc,"e",@progbits
+	.string	"(\265/\375`{\016\345H"
+	.string	":x\320\032@@\244N\007\217\254~\350)\r\371\252\371\321\334f\235}\241"
+	.ascii	"\350\275a\302\260\267h6OG\262wN5\323\313Q\222?\204\035\360\177"
+	.ascii	"\372E\177n\377U:F\275\310uw\273\335~[\333\335dJ)\223\001\201"
+	.ascii	"\001\243\001\215\374o\"\242o\327\375>\036\277\215\377\335\272"
+	.ascii	"\337\254\373]t\277\363\361\373\377\333o8\341\235\264\263\265"
+	.ascii	"3\231\220\032\203%\026\212\253\354\032-n\306]\316\235\352\271"
+	.ascii	"\233\256}\257\221y\256\007\273\231f#\265E\215\303\214uf\325\370"
+	.ascii	"\302\321Y\251\342\016\247\353\t\205\322\316\232N\327P\207d"
+	.string	"=\234\256\211\312\332 \376\350\203FJ\007q\272\316}j\256\244\301\265N\306\347\032\031\201\002\354T!ROj\f\026\341\314\324\321\331v8\217\203]\316)\245E\215\245\031\366\360\301!\3061\265\201\263\215\340\350l\222'[g\337\231Zg\033\356\346\343T\266\330\361\366\274\354\020\3438V\346\265&\362\"\325{\351a\177rJ61-)%!\035\031\025!\211\334\243\261e\213\371\341vc\207\003g\205\352\b\315\204=\375I\213;\025%p!\2369\240TK\261h\220\327\235,\237\304\342MX\256<S\221\305\343\207\347\200R+\305\013cW\334|\217\312/M\021\253\342J{\316F1\253\302]\241\210U\361$6GbS\373#c\007(bin\204\346E\200R\264.\322\263G\026\031X\373\002y\027iZ1\t\226%\n(5{\242&\356\026\031\244\311Q\342\200\322&\305\244\235({|\316\rt\221\226\375\321"
+	.string	"\024127\002J\311\276\302\274\276e\342l\027\327\027\267\216\302\270>#\303\240E\2518\216}\316\037I\030\327\277\261C\034\307\375\32101o(\357\366\271\356>\323]\004\030\307l\274\253s\225\263\360\260\303IZc\356\206\227\300cR\\\371\331m6\346\007^\207$|S\0356k\273a4X\355=\332f\177\342\206z\265*\337\361\374\020^{"
+	.ascii	"}\b\353\242pq\254e\350|\340(\360\024^[\203\251\300V\002\310U"
+	.ascii	"\267\362\023\213_|\265\262\205Z\fqqB\270\355\030\307[\025\332"
+	.ascii	"\005}\020\376B\242u\226\315\034\326\356\244\305\311\025s\240"
+	.ascii	"G\375\270G\2659\027\263{)\201~b\267\327\361*\034\246\375J\303"
+	.ascii	"n\360\333{\024~k\235\315\231U\302\307\215L\353\023\333<\355\206"
+	.ascii	"\343\212\374\332\252\320\005r\362\372\260y\332\r\374s\236\"\365"
+	.ascii	"\254w\234\326\351<\216\207c\034wy\364\303\261+\203\002g\333\377"
+	.ascii	"@\270\3617!\332\2578\333\"H\260Fo\3036\201\342=\372\331\377\234"
+	.ascii	"t\345g#\373\326\220\024\363\324\317=\373\030\025\236{8\201\346"
+	.ascii	"\247?AIs\226\363\264\205\264\312\f5%\260.\317\326\017b\361~f"
+	.ascii	"\311\357v\361\342=\252\314\036W\346\344j\205\301$\255\312\360"
+	.ascii	"\261*\242u\006\034\325\022\230\352\321w[-\337\243\235L\"\275"
+	.ascii	"Z\241\371\331M\205~\236v\373\224\335\231\230\316R\272\227\032"
+	.ascii	"08\325[\351f\274\013\020p9\357(\367{\200\373-\300\375\016\340"
+	.ascii	"~\003p\277\241\376\373\351\277\235\220\337I\367\273\311\375f"
+	.ascii	"\372\357\245\377Vr\277\223\334o\244\343\367\321\361\333\310\375"
+	.ascii	".r?``m\330\233d\315\222\301\267$\036\337\337\345-\343\362\232"
+	.ascii	"\241\275jO\336(\203a\220\2342\215\251S\366\274\301\266\265-T"
+	.ascii	"l\244\275V\252\0161?\231\273_-/\227~\266\247\302|\333\336/_Z"
+	.ascii	"g\223\031\352\320\037\331\033f\271 \360Zm\232\276G\265L\271\t"
+	.ascii	"\nS^AV\350\250\352\335\337\267\270\227L^`\234\352\226\321\214"
+	.ascii	"\177o6\255\373[\327v\277v/\336\343\ttS\345\312O\226\b\035@Ey"
+	.ascii	"\332K9Ko)\037\335\2419\271Z\221\260\364!\202\314\323\3669\037"
+	.ascii	"a\250\306K\215\333\356l\273x\214\312\004\362\227Rr\357\305{T"
+	.ascii	")\033u\241\305/\336\357\236\354\365c\365\324\352\310\300\305"
+	.ascii	"\261\026\223\037{\325\364\275~~-\233\327MkVE\264\276\177\177"
+	.ascii	"\250Wk\322\213\025=\252E\312I\017\206\224Y&|\256d+\336(\037\345"
+	.ascii	"\376#\357\034\bo\3445\354\267\316k\207@>\312^\224\215N|\367+"
+	.ascii	"\370\022\276G\2132\0053\267*4?\211\362\024\251p\f\233\233\245"
+	.ascii	"\264c\371Kc\324\220\203\374ei1\344\250\374Ut\270\255Ef\032u\205"
+	.ascii	"[?\250\360\275\340\266\250~\365|\327k\370\304F\350\271\220\331"
+	.ascii	"\b\206\320M\356x\370\320\367\232\340\237\257\365"
+	.string	"\366\371\363\002\002\324:\253!\263`\006\215D\231\206\204\227\212\211rQ\234\261\352V\277\202\334\320{U\200\207\220\027z\t\275\206\336\3047\261u\026C\316\203\202nrZ\237\370\\\n\220V7\274\313\005{\035\263[\304\005\001\362@\360\327\021\030\f\254u6X\314\247\2761\005\004\213\006\200\2761\205\305\274b\352P.u8\365\215)\036WV9\256\226L\034T5\262\250\260h(\233YX\315+\253&\202\2761\205\203\212\231e\325T6\263\254|0\263j\f\350\022-D\260`\231\336lZUU\365`Q\203\312*\013i\325\304\321#\205\025\216\032L\267\253\246x0\257\230\312*\033\312+&U\016eUVS9\225l,\035VYJ\036XXYJ$U\313\263\224>\376\371S\325\312\320\036\360xb\217j\005\344\001\202\002\362\2123A\32794>Dk\325\177\334\024S\327\364bWfE\264\342-\361\306\244\327"
+	.string	"y\316\321\243Z"
+	.string	"9"
+	.ascii	"\0348\214S\017~\003\220W\234\251q#\3333&\241\"z\036\032\347\037"
+	.string	"!)\242u\213\354\033x\267\263\317\351w\250V\335zZ\362Y\352\315\306\215\363\357\260\254\352~\241su\312\323f\241\276\357\371\240r\f3\301k\034A\326\244s\316R\317\234*\264\351\351\370\224\213\356\346\360]\255u\254v\226\037Wu$\357u\237\347,\374\344\2322v\206w\217\347\024t\022:\013\235\205\255S\217\323\260Mu\353\220\257\317r)W\205:\377\020\335\275\361]\255\320\374d\312\3236\346QZ\346\234'\251\201\027\310_\315\246-\220]\316\213q\034\307K\016\274@^\346!et\240\204wiP\256\217\340NAm\267\363\352$\264\347n\344\316\315\232s\337\230@=\245<}\276\333}\334\013e\365\324\354\336\336\036\316\231\370|\241P\256\327\353\357\276\360]\255B\336\313\274\230\027\214U\223\302e\004\314\207y\277\216\274\001\2016\250a(F\031CjDDD$I\222\f\007A\005\304 F!<\017\021"
+	.string	"\261e\254h$I\n\313\001\261\306\352\226\034\225o\212\376\370@N\037\\\272\n\346\260N+ni\201\241\245\312zaK6\222\343\302~G#i\226\267\273\312\315\230\240\352UW\360\266\225(\200p\025\210a\356[2~\262e\332\013\027\312Y\033\230~0AF\330s\320s\237`\030\325\\\217\220\360;3\357\033\332\224\2006\022>\016\272g\020q9\252\257\352\202\346\005sp\302\002Q\202wZH?\305\2406:9\030\376\361\306H\313E\033\316\260\260"
+	.ascii	":\243W~\302g\030\315\367\314b\251\033\035\3450\200y\222\362\224"
+	.ascii	"\0362\236j`\207\033b\\\215\363g\276\001/w\251\313\003}\3440!"
+	.ascii	"Mg\376\b>\330\205 F\030\364\236\020~\237\215*\263\3524\001\231"
+	.ascii	"D\272+\346\037\204?m\305\305\224r\317\262\223\020\343fRa\230"
+	.ascii	"\r@<\2674x\267\340\202\320\002\352\021"
+	.string	"\003\323\330\300\272\300K\252\310\321\252\325k.l\230d\r\315\235\265\242\f\307'\212\302\020\262\321\266\363!\327\233\235\225\330'\031|\214\210\367\004\007\3555P(q\363=\336\033\006FO\027*4_\253\226`WMH\235v\257v\200b\r\021D\225\303\276\235\373N\351\307A9\017~t\200\203>\230\321\342=[\202\312\022&\255\251\240-eB\302\350=L\301\006\r\333\273R\273_lQ\356\340x\221\225\211\232\352'\340\324C\030\216\r\026Y\034\330\336\0048a\267A\270\337\336\3159WjFy\276BuQ\013\030q N!D\265s\221h\351C2z0\346\251\004'\0308X(\327\031\250"
+	.ascii	"\006D\006o\343.\370P+\343\256\nmV\200,\"\005\002d\252\222\356"
+	.ascii	"\240\t%C\016]LDR:\227\204\213\353\211\212G-m\\\r\244'\2506e\021"
+	.ascii	"\323\362\320\326\007H\2320\344\251\367\257{\\\203\364v\013^\331"
+	.ascii	"zx\021I\027f\031\224\371g\334\213\203\263,m\033l\013\013\315"
+	.ascii	"\370\212RE\357\377\nD\213\025\f\345bB\0252\023\303won\266\220"
+	.ascii	"\005$\302\214%\0271S!\027\025\244\365\327\310\211\344y\343\204"
+	.ascii	"\232\300\263\252\222:\326\211X7\022z]ud\317\226\2558\376"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cb8736be812cdafc,"e",@progbits
+	.string	"(\265/\375`Z\007\215\023"
+	.string	"\326\344}F\240\224J\032\003\300hq^\216\007\221\222\376)\350y\036\032\347q\300\343\320\216\203:\233\034\306Sam\370(B\246\360:l\n\205\261\317KSq\343\306\315\233\235YUUUUU\325Z"
+	.string	"\354~\307\340\211\037\310\232vr"
+	.string	"k"
+	.string	"g"
+	.ascii	"@\230\366 K\273\013\245]H\322N\207\264\0179\332\211\030\355u"
+	.ascii	"E{\021\242\375\310\320\216DhO\022\264\267\0354\013J\371\273\002"
+	.ascii	"\264+\371g#/G!0\224\002\337\305\374\304g\0343\333\365\334\244"
+	.ascii	"f'<K\351\315\3447\213\3037\337\"Z\244\224\036n^\322\242\024w"
+	.ascii	"\306\266\263\223`\001a\326&\345JIg6\200`0\030\324\331G\260H)"
+	.ascii	"\005t\005h\035\366\022\034\366\271a7\241a?\221aO\303\260\243"
+	.ascii	"\270\260\247\260\260\253\250\260\257\240\260\253M\330[H\330_"
+	.ascii	"D\330a@\330c<\330e8\330g4\330\327\270v\032\f\366\032\013v6\005"
+	.ascii	"\273\215\004\373\215\255=\207\326\256#k\337\201\265\273]\355"
+	.ascii	"oV;\\\325\316\203j\027\247\3668\251\275G\324\356\003j\227{\332"
+	.ascii	"\347\234\366\037M{H+\216(\263\342\314[\312\356\252$\255\275\361"
+	.ascii	"\0305*eJko.\255\275\220i\265iZiF\247\225&|Zc`F\250\025F\214Z"
+	.ascii	"y"
+	.string	"R+o\346\254\274pj\0350R\255\001\346DvrT\252V\227q^]Z\b\253\325e\336C\243;\273Z\037\261\326\305\254\365\251\265\036n\255\037\334V\256\267\025H\302\255]{\222l\032X\311B\231ul\234Y\307D\232ul\326\254b\363\300*\026\332\254aco\r\023\177Y\273\263\202`\005\273Y\301pV\260\0208\352\254@qg\005N\337\n\f\177\353\327\310\263~\365\254^\342Z\3276e\316g\365\372Y\275\200\326\337\030\264\376\204\326_8\264\372F\242\325'\026\255\276i\264\372\302\2435G\fs\250\021 \b\b\232\025\324\311\306\030\220\203$Ic\0210hF\b\021N\304#>\305\331\001\305E\006P<\371 \004\347\231\263AY\025\2550\231dg\351N\350\235\314\222\261\013.\327\271B\354X\356\017O\365\317VE\177A,\004\b))\031\031\023SR22&\246\244dd\f\350[cj\017I\266"
+	.string	""
+	.ascii	"\374!\232\n\245J'\355WY+\364\003\377\332\220\316\253U\003"
+	.text
+	.section	.gnu.lto_.refs.cb8736be812cdafc,"e",@progbits
+	.string	"(\265/\375 w\345\002"
+	.string	"r\007\026\036\220\315\260\006\342-p4333nff\2512\"\344\214!0\370[\370o[kR\312\024\037]-\272\207\0225(\361\217t\017\302\356\034l\216\301j\n6C\030s\365r[\006\266r\225rO&+\231\216\b\206L;\244\033\001\313"
+	.string	"\324\205\255\270\212\270\013f\365\370&"
+	.text
+	.section	.gnu.lto_.decls.cb8736be812cdafc,"e",@progbits
+	.string	"(\265/\375`\202O\245O\001:1F{W \fa:\215\001\202\252s\217<\260\327V?\262\275pX\0162\341e\271\244v^g?\360\215\037\346\n\237\007\242\327$\377\356Vc\3310\214\301\253u\335\002d\267[ieW\346\237\017\231\np\334\361k\025\315lL-\205\234t\230HZ\351C-\264D{K)e\n\310\006\232\007B\bgf\020\367.\036m"
+	.ascii	"\222\243\206-\205\335y\207h\215\312\307\331\242\362Bi\372BY\364"
+	.ascii	"\205\212\372BE\364\205nh,\343\307Q\030\005\276\262X</\300h\271"
+	.ascii	"rs\214#\\'\305\025(7_(\206\376\217_`\027\030\006na\215\330\n"
+	.ascii	"S\375\262\300q\304V\270\352\307q\315\007\021[\341\251\341\333"
+	.ascii	"\001\216\250\305\241\223\333\273H\376\270r\263\326\223\037D\247"
+	.ascii	"\037\004G?\350\215~\320\233~P\033\215Ut8\226\312:\342\246\214"
+	.ascii	"\334\234\327h{\264Fe\006\266\250|\020\030\375 )\372AI\364\203"
+	.ascii	"x\350\007\301\320\017*\241\017\364\246\017d\2465\260E\345\201"
+	.ascii	"\304\364\201\212\350\003\325\320\007J\241\3773G\377\247M\377"
+	.ascii	"\007\214\376OQ\033\300\026\225\377I\242\377\363C\377\347\205"
+	.ascii	"\376\317\326\367a\243\357\343E\337g\212\276\217\023}\237\037"
+	.ascii	"\372>3\364}T\350\027mQ\371\0368\372=h\364{\270\350\367\030\365"
+	.ascii	"{\210\372=:\364{T\350\363\274\321\347Q\323\347\t\323\347Q\242"
+	.ascii	"\317\243C\237GJ_\313\321\307b\213\312k4\372:\213\276~\242\257"
+	.ascii	"\201\350\353\025\372;p\364w\326\364\305\276\364w\212\350\233"
+	.ascii	"Y\243\362;5\364w\242\364\177\253\374Z\271\005S\211\310\230r\363"
+	.ascii	"\335\035~\253`\361b\202\356\346\3578\351\247\331\242\362e\034"
+	.ascii	"\375R\215~\351E_\343\375\262\306\243\013&d\313<\261\250q\363"
+	.ascii	"\3132}\202m\217\312\327\331\243\362\345\022\375\362\206\3761"
+	.ascii	"\312\345Za\315px\363C@\002\304\210\220*E\300\206\034\257\020"
+	.ascii	"\256;d\007\327\361n\021!\362\204Xb\213\350\3446\271L\356\223"
+	.ascii	"\013\345.\271]\326x\271n\222_%vJ\007\256{$\003D7-\270\366.\356"
+	.ascii	"|\271\251\3102\224\203lQy\362\250O\252\351\223Y\364\3110}\362"
+	.ascii	"\210>\331C\237\234\241\217\305\032\225'S\350\247\335 =2\227\033"
+	.ascii	"\025R7?\204\250[\002\027\261\350\023F\262\333\343\242\270X\270"
+	.ascii	"\210\205\207\212q\354\370\344\267j\267\207\255\273r\274>\356"
+	.ascii	"\216\313\343\352\270@\356\017k\274=n\216\337\254\253\365kf\242"
+	.ascii	"J\225\341-\021\3444\264\241\236\254X\265\036\367\304-\021\344"
+	.ascii	"T\334T;F*VpBN\332\222,\t\312\026\2135*+\240\3238\216\262\026"
+	.ascii	"3@\314n~^\243o\315\244\206\020k\334\252k\0254\034\332Pa\\\304"
+	.ascii	"\275\367\377k\343^]\031\367\306\245qg\334\030\326xk\\\252[\334"
+	.ascii	"\273\312\331\n!bX\004\361\242\302\202\005\r\207\366S\232\255"
+	.ascii	"[\343\246\350A\344xk\334\251[\302\246\371\330NC\005\300\301B"
+	.ascii	"\203Dn\357\"O\214\253+,C\327\352\302\b\301\316\240\257\240\244"
+	.ascii	"\254n\276/\262\325\230\035[7?{\351\333\242\303\257\213\f\254"
+	.ascii	"t\311r\363\216-*\237\235\350g \372\331\206~\226\322\307s\372"
+	.ascii	"x\215>\036\243\217\251\350\3430}L\324\307:\364\361\225\276N\367"
+	.ascii	"\311\032?\270P\277\333\2129\351T\334\305\275\213B7\b\2351\343"
+	.ascii	"\315\307S\372\366\203\022\327\325\331\017\312c(}\341\350\337"
+	.ascii	"\326\371@Cm\241\362\344\346\337\322\231\363\203F\346\006\312"
+	.ascii	"\315\267b\216\026\f\027\211;aZN\216tv\316\312\261F;\307\306\271"
+	.ascii	"\225\263g\"\274Y\270\240aqO\225ZM\254\340\344B\230c\3436^cb\005"
+	.ascii	"\307\265wq\303\321\206\r\344\027\035R\270t\306\266\250\374\255"
+	.ascii	"\242\177\275\264\205\273\366\215\205s\013g\335\034\004\021\376"
+	.ascii	"\003e\341\262\335 \310\332\r\310.C\234\214e\376}\242\177}\350"
+	.ascii	"_*\375\3336\226\315'\310\232\227\270\233\037\002\231+U\272\210"
+	.ascii	"1\003s\346\345K\230\2630`\304\2141\373\355\031\213\306\246\261"
+	.ascii	"kv\005\273\306\262\261mV\2155c\335\254\321\262\331\264[5[\346"
+	.ascii	"\266x+6\2066%\214\f\261+\212\005\013\302{\337`#\356]\274\b\177"
+	.ascii	"\207\037\004\021,\233E\263`6\355\252\001M\312\216{\027o\311\376"
+	.ascii	"\016l\326\212\345r\301\323\336N32h\321M1\221\333{o8\332\260a"
+	.ascii	"\303\206\r>)\340\304\260"
+	.string	":\312v[\243r\310\026\225\267c\364\255\025}\353D\337\022\365\020\226>\262F\345m\n\255\2015*O\002\255\301\032\225?\365o\313n\271\374\226\212\255b\267\204`o\250\275w\2062\n*\013\311\3156\213\325r\273\305b\331v\313\001\260\366v\262[\204\350\366v\022\262v\003k7\310M\264\210\220\225\371!\320\366J\207\333\262\242\222\352\252\270\305\366\336B\230\255*\013\214\233I[T\336\2036\2005*K[T*\300\032\225O\322g\263F\345\035\240\177\264F\245-Z)\326\210\201\375:\b\"\034\017\275\366\223\275\213B@u\230\324\231s\363\021\240o\275\236!k\213\360#}\213Ai\353,\006\345\257\276\2345*\177\013\345\267N\354\023\fp\224\024\326\026\333\273H$T\264Z\241\343\346\027\255Q\251mQ\371_\036D#L\260\325\177\223`\030\377\355\n+\373/\020~\201]p\001\363\337\"\334\342\277i\377\275"
+	.ascii	"Wa\252\377\246\371\357\007x\n\2638\376x\005\226\372/\234\034"
+	.ascii	"\266X\205U\273?~\213\006\247\370\261\376\357\007\024?\366)\372"
+	.ascii	"/\020G\235\310\340\307&J\374x\003\250\337R\360[\r\266\001\377"
+	.ascii	"\305\201\237~\333\301\217\235\376\253n\030\376\227\373/\r\274"
+	.ascii	"\177\314\341\267qN\360\337\257\337\262a\023\374\030\001\377-"
+	.ascii	"\201K@\202\037/\340l?\036\301\177\243\376\177a\022\027\370\361"
+	.ascii	"\b\"\021?N\341\276\t\361c\017\200\340R\201\370m\332\217=\370"
+	.ascii	"\177\301\377\024~\334\364c\365\307\300\037\377~\274\364\377\315"
+	.ascii	"o\363\261~\362\203\333\237\f\300\217?\3748\004?\006\301\217?"
+	.ascii	"\360c\017\374\230\003?\326\300\217S\3701\006~\314\200\037/\340"
+	.ascii	"\307\t\370\261\001~L\200\037w\360c\016~\f\200\037c\370\361\205"
+	.ascii	"\037\003\375\330\347\307<?\316?\276\377\235\373\257\334\177\343"
+	.ascii	"\376\013\367\337\267\377\266\375\227\355\277j\377=\373\257\227"
+	.ascii	"\377r\371\257\226\377b\371\357\330\177\303\376\013\366\337\342"
+	.ascii	"\177\273\376\373\344\277M\376\253\344\277F\376K\374\357\326\177"
+	.ascii	"\205\374\027\310\177y\374W\307\177\263\376\213\365\337\032\377"
+	.ascii	"\275\372\257\325\177]\374\267\352\277R\377\035\372\257\212\377"
+	.ascii	"\242\370\257\211\337\306\371/\210\3776\375W\370\337\340\177?"
+	.ascii	"\374w\367_\020\374\367\003\377\325\360_\f\376[\364_\242\377\006"
+	.ascii	"\375\226\355\267h~\253\366[\007\374v\303\177:\377\351\376\273"
+	.ascii	"\375\177\362\177\003\377\303\374\307uuuu?\246\373/P\375\t@\023"
+	.ascii	"\032x\246\270m)s\363+X\323'Y\220S'\251\376\337\032I*\262J\357"
+	.ascii	"\275\207\305=uD\306\205\222&r\373\252\206\006\373&k\213\027\034"
+	.ascii	"k$\253\356\366\263/ \313 \331\"\273\371\025@\321\277\375\375"
+	.ascii	"\313\355D\265\367nA\0267\325\323O\371\333[\322Z\r?\220\305\226"
+	.ascii	"\203\377\031\377\007bo\023h\216{o\013\247\217\2249\321\270\371"
+	.ascii	"\277\006\373\3775\354=\264{o\252\250\257\254!Q\324\227\323\216"
+	.ascii	"\002K\253\"\212\372\312\252\212*\356\034\031\366\227\216\035"
+	.ascii	"U\304\032f\254\341\336{xwq"
+	.ascii	"CeUm(\254a0\252\270\251v\021k8\264\241\252\206\242\212N\303\250"
+	.ascii	"\257\254*\033\365\205U\025\365\205UE\264\241\366pC9\345\320P"
+	.ascii	"XUQb\260\252\206\242\276\234\252\242\240\262\252l\021k[\265-"
+	.ascii	"\305\254\241\211\375\345\004\264\367\226*\022\207?{;Q\355a\231"
+	.ascii	"\273bg\035W\354\033\333\2461)\3528\332{\017\305\330\264\260x"
+	.ascii	"\212O;-\n\t\226\317\304\336l{\305\001\206vX\334{\237\330OC\273"
+	.ascii	"\267\211\"\325\336OX!\270\332{o,k\346\004"
+	.string	"\325\006\332PNROZX?&\236\260Nl$9\354\336{WE}iau\3102\345\213\270\237\212C\033%\205\265\211\233-\213J\177\r\213\366\r\320W\220+\251\233\311\025\277\275b\275\374\\\031\003\306\343\346\237Tqk$U\220(\254\327\036\202`\315\324\261\007\307\234:fn~\005W\372'S\220(z\366\360\312\227\233\311(\240.2\270\255\233_\001\n\375g\271[c\226#M\030\300\356}\305X\346dUc\356f\262DP\r\265(Y7\237\2028\372?9$\237H'k$\241r\335\355\335\232\243B\314u2\035-2\253FB\221;\323\261iW{W\035\200\211q\013\356g\205\021\034e:\237\202*\372\0244\321\247\300\210\3763\3353\235?\313\271[PBFb`\221\335\234\347tx\246\363\201zA\266u3\017\020\335C\201\213*@nI^\314\201sk\314p\362\233\353\265\207>F0W\004"
+	.ascii	"\002#\347\311\334\315\247`\353?\303\3457:\244\316\212\334\234"
+	.ascii	"\335\364\324\310\"f\205\233\177\344F\377\331\314\2551\233\311"
+	.ascii	"G\t\350\r\345&\312\023\030/\262\233\333\b\275\211\242\302v\363"
+	.ascii	"\217\3244\233\274&\257`\215\331-\253\311!"
+	.string	"\2605y\322\226\323\004\361\270\34539M\020\324\021-\271\r\232\t\334\030):\377\250\210\376\021\226\376\321\213w\311h~|\031\376\270\371GR\372\031\352\3643\250\311ez\310\322\274\350\272\371\031\302d\265\242>\023ru\343\346?\243\335\0323Z\026\343\301\356M\005L\315O\026\030'37?\203\330\0301%\223\026i1n\016\263CC\313\230\265\233\237\241\211\276\bD*[V:0ib\325\216\334)b\304%P\216O\302\320\352\212\220\231)\351:\356\275;4ab6\244\216H\225\334%W\311b\331J\316\222\301d,\371,s\311W\362\227L\226\267d/\231J6\313Z\362\2305\346\262\374\365\f\226\247X\265\\\226\215\214\t\001C\0042\246\003\227\223\343\336\305\262\214$'\301E\242\016+\021\345\270\367\316e\027E6\342\"\226\t\200q\035\367\336u\271,\007\t\2235G'\267wq\211\222\030O<\310\317"
+	.ascii	"\245/\026kTn\260E\345"
+	.string	"1\304i/8A\212\324\271\371\030\316\350\207\360$\314\312\321,G\271U\327\n\027\211<'z\224\025sW\226b\2159J\206\222\243d'r\322H*\033g\320t>\006.\372\030\214\372\030\224\350c\320\322\307P\245ot\3247B\3237\032K2E\023\261r\206\312\3157R\242o\224\245oD\245\177a\216\376\0056\372\027\314\364/\214\351_ \352_\240\241\177\301\204~Q\233\3763\016c\306\221}\034\351-&F\214\254\262\"\005us\0171\234\026%f\213\321\221wXc\346\221\263\304\260r\216 \274w\326\023\242\031\217\254\245\245k\306\206\222\315\033\265\2472\277\250K\277\210\250s\\\030=kj\306\266\334\374\" \372E1\364\237a\0303\214l\343H\357/7Q\262\234\255,?n\256\301\223F\314\213\305\315/21\303\0323\215le\213{\177\321\3101\262\214\240aqW\355\364\360Z\302%\267\367>\332"
+	.ascii	"$\207jg\311\371\317W\3172,X\bv\006 7.\305!7[\271\016\317W\r\b"
+	.ascii	"\242\243\311\315\267\220\246o\241L\337\002\223\354b\367v\204"
+	.ascii	"q\271\371\026\210\372\317-r\025\031/:o7g\252\033Gm\252E\221'"
+	.ascii	"\313\234$0\332n\215\270-\263\260Tvo*gP\034\367\276\"\300N\034"
+	.ascii	")jo7\257\260VhYs7\337B\016\255\002\267\311&\260\024\252\n<\321"
+	.ascii	"\0353\212\234\"KYcV\221O\034\257\301l\236\213{C\221e\025x\005"
+	.ascii	"\0259\252\316\261\247mm\216\207\316\267@\245oa\250\263\211\377"
+	.ascii	"\222a\267\\\342\n`\007\23587g\250\022\f\3251\315\315'r\323\377"
+	.ascii	"\3630o\\\007\323\311N\270\316\032\363\023\236;\236s\205<w\310"
+	.ascii	"O\370\r\226\303R\250t\331\023\233\213\205N\216\270uls\314OX\316"
+	.ascii	"\232\343[~\302n\240h\331\022#\204&\216\030\230\240|\242.\375"
+	.ascii	"c\213\312\023\005\321'\272\201\343\330\257\260\037sn>\321\t\215"
+	.ascii	"\3410\034k\304q\337@>;\260\2109\335,b\357\275\355\273\224;\357"
+	.ascii	"R~\210N\177\250M\177\310L\177H\212\376P\022]nkT~\b\207.\261\254"
+	.ascii	"Qy3\266\250\374\220\n\r\230\215\007\252X\374\332\273(t\341j\t"
+	.ascii	"\213\233?\344\204\321\35059;\302\334|\241\0254^\303f\254\021"
+	.ascii	"\237\371\261\nk\366\354\205\265\277\366.\002a'\2531e7\337j(\205"
+	.ascii	"\352\352\352\352\254\206\362\307e\324zp9[r\363\217\325\260\030"
+	.ascii	"i\006\345\211\232\233\311\314\236\300Aq$3A\206\330vdq\002\215"
+	.ascii	"x\267p\021+z\335)%\300\034q\r\263\343\rS&\3101\356\322\231;\326"
+	.ascii	"\341'\255\266:\f\245\306KW\233\251c\0303?\326\200\220\2355is"
+	.ascii	"\273:\222}\201r\214\273ts\310\256T)\206\231\265\255\241q\214"
+	.ascii	"\273r\352\340#\370\fS\301N\260\021o\341*x\n.b$8\f\036\202\271"
+	.ascii	"\340+8\r?\301X\360\017l\004\177\341%\330\007\016\202\315p\026"
+	.ascii	"\254\005'\301@\260\016\334\004+\301d8\007&\202\313\360\026<\006"
+	.ascii	"{a\036x\007\346\302dp\021\f\005\217a)\270\007\266\202\277\340"
+	.ascii	".,\0043\301a\330\013\356\202\3010\032\026\203\243`\"\326\302"
+	.ascii	"`p\2265b1|\343\030\007\306\372uZC$+\243r\254\303%"
+	.string	"\214lb\377\r\203Fd\354J\333\333\212\343\2239:\307\275\213dY\310\216\035\304p\n,\003\027\261\230\360$\346\270\367~\b\377\215\273u\344\034\343\256\\\035\221\f\214\223\242X\331\r\303fc\312p\205c\033\\\n2[jj\230\235\361A$\3232F,J9\2332&.N\324\2143\342m\273+\200\311 \303b\227\312\265\0224\034\332{\207\025\342%\353\022\245N\fo\267\033FM\310\r\203\006G\227\030&7L\332\220\033w\347\320\035\275\270\221\"\232\275QA\274a\322\354\270A\003\fQ\f\333(;\3366\261\313&kZ\330(\351\210\251Q\242J\355\215\016#`T>\310/2\206\200M\261\355\030y\263zb\221\3232\225\025<L\254x\023z\322\206n\215\224\323\275\0017'\247\202\004\022D\305\004\031\\\n\024>1\344\262\250A\221\217D\240\300(\023\365bG\213,gN\3448\251\016\032BL\3408"
+	.ascii	"\230\220\267\235\022e\326VQK\211\035(\022\253\310\344+\310\315"
+	.ascii	"E\037,7\306^8\225Ax\256\276p\r\311\032hF0AvvI\264.x\304\240\252"
+	.ascii	"\003\023b\303\332!U\2074a\305c\214\221N\271\004\215\f1\312\315"
+	.ascii	"E\241\237\251\251 Xs,\330]\033#\3654G\256H3E\314\230\234R\013"
+	.ascii	"\017\026]\213%rp\017p#\265\343\346[c\031\247jL\206\017\255"
+	.ascii	"\233\341\340J8?4`\362f\013N\016N\222\235(6fx\335\374\001\f\337"
+	.ascii	"\336J7\366\215\226\334\225\233\262\305O\020\031pd\334\270\271"
+	.ascii	"\225m\334p\220\306\315\022\2566$\0316e\276\370XS\243\246dc\251"
+	.ascii	"\250\366\276\332\3037\006\240p\352\232\301f\315\211\037`o\345"
+	.ascii	"\232\262M\307\205\211{\353\021\207\213\t\332\315\327\360"
+	.string	"E\227f\314\224in\301i\357\247\275o\340\350 K\213-1r\373\352\205\2064%\2320N\212q\320\224g\200\314\220\261\361d\205\017$S2n\276\006\262\262LY\006m\205\326\223\035\261+B\202\334|\r5\322\322V\251(7H#_\234\244\334|\rUhhdUO\013\251\272c\232%C\266n\376\007k\304\210\221\233:b csNn\376\007i\345Yy\306\206\3161#qa%\206\321\314\214\204;\302\302msSG9'bNN\334\374\017\270J/\245\227#4\251999\375&&E\233\233\377\301\211\222K\311EN*\316\225\034\020\024b\034-7\337\2032(/\215PJ-BU\354\336W\373\tj\337\250\261\363&\365\006MnG]i\350\261\342\3645\244\362R\313\313, \210\360.\332\206\217\024Nn.\261\334\376x3%\352\346\227W\312\262\237\207\247\b\233*un\276\007Dti\245"
+	.ascii	"\377y\256\215\271\034t7\277\254\342"
+	.string	"\243\314\220$7_\373.eIV\216\215\205\031\221qs)V\216M9\271\275\215Q9y\301CH\330\177\036\214\246\265\366ts\371U\202Y\343\303\224S^\024\n\322rb,\314\315\367\300\207\276}\230\362\004\366a\312R\312K\257\237\307\247\253\213\211\265\233\357\001\226.\243\274,\376<\226\007\213\26427\337\003\032\372/\273~\236\2377!V@n\276\007V\372\036\244p\342\204\254\262^\031\310\231:B\005\231!\345\346\013\240N\311\244d\342\302\355\005\327N\031\034\01738#F\312%F\244\334\270p\361,\241\022\247K\311\313%g\306\033nI\244\300I\242%\t\222\236\025P\234\264\034!K\374\340XaK\326\221\\\367\303E\252\r\334\315\027\200\224!CJ\"\nN[bp\304\345 \362\222X\306\325\365\345\346r\313\302\221U\301\361%\367\237\207\250\304\220\210\022\036<\312 v\250\370\264&G\314h\314\334\254"
+	.string	"y\031\244\244+\336X\361\243\016\235\025b7\227>\204\220L\351"
+	.string	"s\363\005"
+	.ascii	"\244\354a\343J.D\266t\335|\001`\351\320AV\031\347\254\340\344"
+	.ascii	",\327\366r\273\371\002PQ\346(s\224Y\245V\233\025\\\271\304\206"
+	.ascii	"\027\2632\313\202\371\250\251\342\202r\363;\240S^\225W%\216\021"
+	.ascii	"Th\220\334\265\341\0262\345\215\2278\252\244}\325\335\\\316("
+	.ascii	"m\374\347\351)"
+	.string	"\233Q,b\243\254\301E\013\327\023\216 \033oG\242\320\270T<SD\032r7\2272n\t\033c\\0\300\376\363\220Zql\312\216VVd\025\b\204\310\300\335\350\24165U\276\030\323\322\222\223kAu\244t\361\362\205\220U\032\030I\312\026\332\307\020F\226\262EYU\245\005\327V\233.*]\302n.\251\262\032\027[fK\256\254X\021\224Z3\302\205s\300)[\021C\205\n\022N+\310\324QN\277\221\272*q\363;\200*M\224&J\024M\244\242\334\370)\321\246\316K\031\365\022E\336\342\305\312\213\233\313\023y-\016\316\361\307\273\300\310\342d\314\315\017\300\227\022\252\204Z\213\232:\372Py\001E\310\315\017@\027\035]\3514\202\2528t\330\315\331\016\035\345\360\245\023\317\0208r@\312\355\2036\243\005[\271\353H6\030,\266\350\220u\222V\200\362\345\346\007\240\210\246\203o\340\263!fon~"
+	.ascii	"~\314\315=\305\325\341\352YQ\325D\305\f99\262\312\016\025\237"
+	.ascii	"\322\240 \016\215\230Ys\363\0030\025\027GV\035\351\r%,\352\330"
+	.ascii	"\246j\307\211\233\317\301\334\2337$\334\0052-\346\350\344\312"
+	.ascii	"\254Y\221;\t\307S\344\210\226\324\315\347 \r\233\263!\337\254"
+	.ascii	"\327\236\032\001\026\032$z\b\005\006\343x\362\255\2141G\313F"
+	.ascii	"\033\2377OK|\264q\333A\342F\215\020/ \343\224\234\023+d(kgg\304"
+	.ascii	"n>\007gmm\"\310\232\243#\201\210\225)r\3639\030[[#\331\254\225"
+	.ascii	"\324\221&%PM\255\2459\311\026t&\216\232\031\232\222\355,\013"
+	.ascii	"\016\315\0315!QF]5\307\344\314L\316\002\202\263\243\306\224\233"
+	.ascii	"\317\201\226\0301\244\032\b\244\214\030\341Q\221\226v&\355"
+	.string	"\244\232P\216\260\034Z\310\374\320\301\022&E\006MH\2240\0355\272\252\020\2611&[\221N`2\2067\177\003:33\362L\204\024\221\026Aj\334\320f\2009y\326\323VbL\354\346\303\311/\376\363\004\235I\2512\023\306\213\227\222\213\324\326\213\0277\350R\334\374\r\232p\341B%\025\344J\210\r\206T\232\233\277A\r-Zv\270H\365\250\343d%I\324\315\327\340\215\312\251\220X\254\327\236\"\201\024\2178:L\264\324\224\235\304\242\272ArF^\321\022\225\005\355\ni\205\307\017)W\305\315\006FW\215\233\253\344\023\377\267\225\211&a7_\203-cce\234\224\326\031\327N\033\231\223\226\217\2600\262\352\bk\030\347s%\225e&\007\264\366\324\006\343\346k\340\345E^(\342\242\016\213\334O\224\2712P\276N\202Y8 8`i]7\037\016i\374\317S\242M\321\315\335\314\203\346\215\r\261\233\017"
+	.string	"2\305b\002\214s\346\360\f8\024\304\233\017"
+	.string	"\"]]\035\214s]n/\340\224\270\371"
+	.ascii	"pz\362D\004\255\270:\026\234v\020o~\006a\\\\d\023\024\236\336"
+	.ascii	"p\335#lo_\230\234l\222\177\260\201\261\306\302\245h\261\345\306"
+	.ascii	"\315\317 \006\022$\244\022\027m\320"
+	.string	"b\200\305\030\222\344\244\022<\006\310\221\257\233\017\347\226\370\317\223\243\034\271\342\201f\304\310\t\264\334^\224`\226\300a\335|\f\226\020\211\"\030\333\334\004u]q[s\3631X\261\265EV\035a\3415Zi\272l\334\030\261]F\210\220\030E4H\200VX3\004\207\026\037>H \326kOuX\2132\307\265\367\225\006RI\213,`?N\002\261uj`bn>\034\234\346?\317\317\221\254\022on\376\005E\222\007\017\262\312z\355)\033\346b\315\210\334\336W\032\034@cM\214\233\177\201\r\035:,\330\021\326\320\215\006Q\\D\231+3\306(r\363-p\243\1772\213\314\302jG^\273\005\t\267\251#I\225e\013\230\233oA\232\376\311\033\267F\362\006\211\245\001k\273\350\340\013\321M\0139'\262\230\334L\342\370Ub\207X\361r\274\371\026\224\351[\300D\377\344\f#9\203\254a\273\254\340\344\316\260"
+	.ascii	"S\346f\222\006\023$ZMn\276\005A\364-\270\272\262`\326kO\365\234"
+	.ascii	"p\261\204Nno3\002d:m\320\374\270\371\025\300\351\223/,i\365\203"
+	.ascii	" \2025\222V\026\354h\017\337:\030\363FI\023\271MeF\200\0374^"
+	.ascii	"\222t\335\374\n\330\364\255\005+]\270\030qDI\023\256}u\025BA"
+	.ascii	"A>?\367!qH\201LL@\336\252\002\203\301&\024\224\326\024U\203D"
+	.ascii	"+\232&\241?\363\003\360g\302\212\246I\026H\372AS\264\207\327"
+	.ascii	"\244\256(\234j\2230=/\350\231\247\332s\037\022P)Ew<%&\025\250"
+	.ascii	"\224&1\001\325\340y\356z\350\317\324\200\006\204\350\205\373"
+	.ascii	"\220\204K)\252\256"
+	.ascii	"B\016g\257\351\307KQ\016\252\260\211C\206\337\257)M\201\351\316"
+	.ascii	"\272;I\240\3022\004P\365\255\300tG\311<\177\371T\233\2029\310"
+	.ascii	"\304;\205&/UW\241\317\t\026\300\200\007\b@`=\205\247\312s\037"
+	.ascii	"\322\252\232\247\332\264\252f\323\220\260\307gE\323\244\013\353"
+	.ascii	"\271\004\264\242i\322\217\352!\350\001+\232\242\026\204\350\317"
+	.ascii	"DW4EW\336\271\236=\340\3324\002Q\357T\233P\020\242\026\356C\212"
+	.ascii	"\300\271\232<\264\227\242B\352\b\023D\240\021\350\245#\234"
+	.string	"\253\331C\177&\210\243\265\207\006w\204+\232&\361xf\320\212\246I=\0268\325\246\013(,\245\2500\003\352)\002=A\210ZX\3214\351gE\323\244\b\b\357CB\323$\036 \272\242i\322\317}H\344}HML\350\212\246IML\350\316}HA!\323\316.(d\342\020\0242\255h\232\204BP\310\004t\037\022\372\343q@\177\274\025M\223\320\037o\347>$\016J\246\360\207\232J?\367!\211P9\210P\213\324\362>$\016=a\322\2516\255\346\2514t\037\322\006+\232&\001\335\207\264\242i\322\317}H)\02059\340\361\314\f\367!\001\325\021K@u\304\322\205\373\220\324s=\231\200\352\371\343\215 A\375\200\376L\022\326\023\005\240j~8\272\017iU\315\025\005\365dB\327\236\373\220F\250\347\272\232\037|\356Cb2y;\016@\024\203\025M\223N\036\n\342\354\361\324\237\023\316\337\0073\205"
+	.string	"S\210\240Po\204\365\024\022\335\207$TAh\256\034xJ+\232&\tU\020\232)\360\224|v'\023\272\246M*\007\236\022"
+	.string	"Vs\025\366xX\323SU\233xD\253\321j\341>\244\245\246\017g\217C\357\2076}8{\300\023x\316\325\\Q\360Y\321\024\3157R\201g~\b\002\201\024\020\nO\036P\r\n\235\207\252gz.\351\037"
+	.ascii	"\001\005@\200\002D\354\024\255+\221z\256\352\t\"M\002\022\022"
+	.ascii	"\211HA\004\006R\364>$\223\203P\005\n\323S\330A\bsD\217p\350\367"
+	.ascii	"\003\252>;\302\363T\227\316"
+	.string	"\022|\274\025\r\376\254\351\311\224.\241\277\021\214\316\335\331\003\236p\252M?\324T\002\262\260\336\207$\264@\304\331KQ\n\200V\341\257\311\203z\256\351I\302\217\bNU\311\302\256w2\251f\332\264C\325\225hU\315U\270[J\321\235\006k\332\004dRB}\302\335)4}\301\335R\212\006\203\346O\351\002p\227\242K\250\n\334-\245h\b\013\247\320\374P$\334-\235=\242\225\027\334\245(\023\210]\357<\203\302\013B\246\335\357\344\361\314\240_\220\311\004\202POa\321\331kZ\321t\311d\332\005\315\237R\320Q\212\2120\231v\"8U\245\013\2773MM\237z\256A\240oES\025h\301z\037\022\206R\bDZX\357C\022\001\374\300a)HA/iM\317\324dR\317\240\217pH\004\360\001@4E\203F\353Nx\302\311\204\256zU\317\225g\252\246\217\267[\201\300\017\247:$\fZ\357C\342"
+	.ascii	"D\327\f\026T\020\232'\244@t\345\245MJ?\347nU\201\0360\240=A!"
+	.ascii	"\2230\270D\264\232j\257\311\374\260\023\001\374\240\002\317\374"
+	.ascii	"}\300 \\U`\320\207\204ow\256f/\330\2643B\341g\242\352),Zw \204"
+	.ascii	"p\356\204K\346/\002\347\357\203)DK0/\bw?$|\273\020\346\210 \022"
+	.ascii	"\276\335"
+	.string	"\020\t\237\217\267\002\323\365>\244\036\032<\212\200\025\356\224zh\260\364`\223l\t\266\207\006\361\232\242@\017\301\246^\212n \203O\b\263\003M(\364\320`P\212\236\260\216\320C\203C'\210\363'\264\362N%\245\242U=\203\"\316\335\372C\327]\n$\201\252@\337\321\331\003\2360bEA\230\252\t\350\232\232B)`HQ\323\004\025\270\232\352y\001\003!\314\021D\277\223\307\033\341\\M5\250\2674\324\373\001}\302\023\005\006\327Sxt2\241k\317\b\363w\366|.\234\253\251\356\212\204\351\031d\002\222\320C=\254\346\007\020E)\020]S\210@\357<\225\214B\230#vB=$|;\020\204B3\030\002\370#\032\241\236 \200\274S\335\005\005\255B \360\203\321\n\f\352\251f\b\025\250\324;O\245\335\252\232LB\24238b\035B}\226R\363H\210\21203\244\250\271D$d\332\365\314\323g\252"
+	.string	"\004\376v\352\231\242\246\272\356\200*\317\244 E\315\245!\"\025\250\252g\006%%\340\332\304\333\t?\230\026\316\340\210u\007\202z\256?T\311\002\t\337.EI\370v\"L\246\035\223z\256\275\235R\360\267KG\364.\234=\340\t\036R\270`E\231P\n\234\277\245t\204\f)j\232@\264\236\302\023\003\352\271\264\204\252)\204"
+	.ascii	"\376~#\220\340\343\245M\346/\203\335)l\262 \302\374\235\352."
+	.ascii	"\2049b\327;WS]:\327\024\275\220\002\321\325$\201\252\346\231"
+	.ascii	"\242\024X\205M\252o-\"S\324\\\3529y\251\t\242g\356R\224i\327"
+	.ascii	"\003\262P\256i\023\220\267\373\375N\336.\270\003\256Mf\206\335"
+	.ascii	"\232\236\25005\325\365\350>$\341\017\250\256)\220\267\343\251"
+	.ascii	"\034xJ\027\224\020\302P\b\340/\310\267\204\372\204z!\374Lum:"
+	.ascii	"S\236]/\204^j~\350\231g\257(\004\360\347\343[B}\273^\b+\312\204"
+	.ascii	"\376~z!\364N\241\020\320z\037\322\332\024\\\233\200;\246\020"
+	.ascii	"A\016B\365\004\201\252=\r\326\335\216p\311L\001\210\226 \316"
+	.ascii	"\022\316\325\304\300\317\017\310\003\256@\325\303P\nD\205\352"
+	.ascii	"\t\"Mb\nA\304\024\302C\357\344\245#\204i\006NaS\320*T\233\036"
+	.ascii	"p\n\233\200F\250\353\311t\376\316\024V\240OX\302)l\"\002q\366"
+	.ascii	"\360\331\36435\260\236B%%\013\234\277^\322\317\\\321%\264\207"
+	.ascii	"!E\231|\316\337\272\002U\337*\302d\362Yw\b\350\260\246h\223\356"
+	.ascii	"\245&\023\023\220\227\242L=k\332\004$\341\374\001=\004\335\207"
+	.ascii	"\304a\365-\241\277\n\200\316\036\360\004\365\024\2012\361\374"
+	.ascii	"\200\300\007\354\310\336)TO\020\247\272\023\2060G\024\255\351"
+	.ascii	"\311S\317\340N\005\256@\246]\020\375)\371\204\246\312\313p\037"
+	.ascii	"R\206\003\203\247\312a\005\002U\016>\302\035\tL\347*\034!\f\022"
+	.ascii	"q\366\322\244\036\032\024\002\201\256<\223\350\354\001\231vK"
+	.ascii	"M\037\316^\217\220\207\256Bt5W\341N\005\241\271"
+	.string	"\n\371x+\032\002\005!\320\003\002\316\037\252\004T=\234\253\251\032\251\300\003\376x\352\t\002\270k\n\362\200N&4\205\223g\252&,\245(\223:Bj\001\365\f\001\fbPM\037/\253'\252\204\256\351\331K\352\251&\360\203\020\t\337\t\247\320W\366N\265i\tUJ\201\274\236u\247\2005E\233v\336\241\003\t\032d\240\002&h\036\322\212\246(\007\236\022\207\0245\2318\360T!\007\244\013\347jb\340$\2012\241k\320\002\352\371k\352\235>\236\320\350\377N\f\262\211\220\030+\340\260RBv\2412\364\001#\263\270X^t%^\220X\200\266\233\020\242\2133\240b\035&\001\205\316\250\303\0215jL\026R\020\243\n!\204\210FF\233tC\026@@`H\"\022l\243\254\017\023\300\203\214\013\005r\242F\241\233\221$Ijl\255\001\312\223M\001\022\335nW\213\266\237\364\003\3130\316\371\001Cp\001\r"
+	.ascii	"\234\300\224\250\323\234:&\327\3769\352?\204\240\357]\206^\373"
+	.ascii	"\210\234\211\\"
+	.string	"y\237\347C\356\221\022\017ws\216\300s\253\210\227M\221\377\313a\210\2209Yx\322-\204\030\231d98\024\t\003\355\341_\303\342\035\n\272\307\031\246B\024/\n\325#\300E\037\210f\036E\337\\>\003\007\013\237\200\343\372\242\361\350\250du\002\023Y{\344@\273\034\313\177\245N\356\032\b\252"
+	.string	"\304\223\367\305\262\324\026Y5t\023\344\314\234\213;o\327\203\031\350\346.!\3501\340X\337y\003\272\210"
+	.string	"\340R\276W\241\200w\224\353![\2009N\242\036\032\022\307\004|\t#\222\027?\024\355\330H\262\017E\004\032\343\321:\214\214`\333\362\361\224\2050r\305\r\323k\276\361\311]\244\033DL4*j\200\214\026mkAL\261\253k\327~/\211\254\013i\274\177\217\246\207\2410\313\272\265p\222#\341W0aU\267\345\27232\321V2\215\t\222e\020q\206t\023\242\363\t\326\002 \353+\330\013\023\227\305gmfV\333\210q\241\240\225\372\211\234\266\202\255\337a\017L\303\306\251\362\264\354\030\251\240C\n\377\302l\234xP\031(\336I\231"
+	.string	"\270\303^\262\257\250"
+	.string	"\371^Z\323d\251\334\037p'v\303[B\264\3633DG\340!%\313\026\212\332\343\002=\352\332z\006B\365 6\316E\366;\320Qf\036\230aTG\320\024n\371t:b\213|2\002\301\023\253%\346G\365A\320\034Y\270M\342*@#h\202-q\340\352\214CV\2462\366\223\250f)\304B\232.\345\230^t\373\206\310\374@\374\013\327i\200\202\373\257\242\026\362}\366\275J\340\227rq[v\301#\017^\033\212\275g\300\032XC\230\373\3453\013aj~g\034\237\215h\310\367\3263V\305\007\022\276\321|Kp\0274\340\"`\007K\177\020m\375B\005\024\024ZSm\317\357\360\274"
+	.ascii	"\031\202\375\001\362y\2709j(;\001!<\206,\326\372\024\275Q\003"
+	.ascii	"/\264wR\230\354\024\252\262\177\2423\022@\220\324\240\002{\360"
+	.ascii	"+\263o2\260%\035o\013F\205\303\205\334\216\257\004\271\340\016"
+	.ascii	"Q\375\364\362\241T!%\177\325\005\205c1.\245\b\307-V\031\361\315"
+	.ascii	"*\376\031\327s\250\273\270\261S\323\265\343m,\315?\361\217\265"
+	.ascii	"\007+/\264\303\352a\344\333\b\257\331\240\345!\224D\334\024\356"
+	.ascii	"\3463&Kw\267\377\267\340\326q0\300;\336\245:\005\362Y\201\t\357"
+	.ascii	"\346+\234\202S/\252>\223\270\006\221\271\rI\271"
+	.string	"\206w\030\\\na\301gub\362N\306\272=#B\355\256\317\301LT\370uc\363Z\212?pW\020\033Y0\026\250\006#\370v\271:\333t\226\216\273~b\272 \3344\2666\220\034|-\375\271\022=\221\332\306\004\345<//\305:\344d\003\bH\001\270:3D.\221i8z\317\273\367\270as\211\270\030#\301}E\257U\227\350\355q\310\217\322\310~[\3470\304\030\n\243\035W\270\344p\226\325\206\315~\270\354\207\313\276\360R-\334\234\243\236v\270;\205\235y\3273\276n\365\323\220\323^C{nM\252\303H\3324\036\274%d\"s\2129T\230\340,\020\203\343\362\305\243\001U\312\234\232\312\b\200\256\234\253*\025\237\"6gt\217Z\254\336h\017#\337\303U+\240\3555\037\334*4\221/\207\366\216\005\340\022+\215w\326R?'\373\f\256\326\230%qe\203W\316\242\255\007\302\t\371\362\232}"
+	.string	"\336j\202\005=\310\262\006x/M\013rj\302\356\245@NB\2713\240\260\021V\217A)n\217c\001[\213\262\257\034\002q\n\"\316\202j:\tGa\342GW\220D\224/\220\307g\330\310x{\331\304\b\n\333{(\321\322\264\036\016x:Y\024[tj\260}*\213\366\"0\327\212 \341\244\352^\fT_\370B\032\271\f\227\2457\033\006\340\254!\215\bJ\373i\250\374k83\312\3357\204\251\3271\317-A\273\321\205\2763\025\266\307e\276q\b\341|}\260\r\263\326\037\340\314;w\27065\301\304r0MDq\241\362/u[\300*9\335ft}\275\236{\013\233\205\263\242\353\302\362;\3007\036\255%\337\004O\225F\027\030\237\374\017\217\362\337"
+	.string	"\230\335\353\222\321\367)f\217!\330<\t'C\315\264\211\307\032"
+	.string	"\",\002\324!O\032Z\215;/"
+	.string	"\244r\00733\026\355\371\b\371\322\016u\213\275\260(\312\032\n\027#p\212D)b\240\037\344\254\021\256\204~\375~d'\226\033\244\236\036\340\202\203\367\210\254\317\375r\362\251\332\254\203|\361\250\376\020hU\352J\240d}w\363"
+	.string	"\376\020&\253\213\264\031\306\336 \201\303\352\356\rC\264\320\372\363\037\243\017-~\251\202\007\354~\332\257\374A&\211$\212\357\260\361\244O\223[\007\t]\235\347Z\340\016\024\250pL/LU1\245\324h\341\r\325\264Z=\314"
+	.string	"\\\340\tB\275\261\253\302G\243\213C\024\205\202:\214\256\204\345\244\037H%@\233Q5\365m\255\006\306\270\204v\335.\323\336\276$\353\277i\242<\226\004]\263\r\367\027q\340O\021\027t\217\252J\332\356r~^\216\214\030\2318f$*\301\370J\234\376\322\240\306\240\371)\317\025Y\253K9\306)B\243kBi c\230\354\250\376\001\213\325\354f\267\023\247\222*\200}e?\241`v\035sA\260F-\271\230\021'ig\370)\301,\025\252\215\377\022-"
+	.ascii	"\0365[\244\223_\336#@\233\247\213\326u\325_$\361\033\206%\301"
+	.ascii	"\005l\031X\273\263\236\355\2160\275\265\3652H\270\247\245'\006"
+	.ascii	"\233<LC\006:,w\245\310[o?i\370\024&e\222X\307\"\245\007\323o"
+	.ascii	"l\362\302r0\217\006\355\024\241\r\221\\\025b\356K\2726\271.k"
+	.ascii	"\376\207n\007>6\225B\037\364:n\026s\2258\007\326\320\263[\375"
+	.ascii	"\277E2\365\304\004|?\\\221\251\022\353\300\004\254j\207\232,"
+	.ascii	"\273\361\364k\323I\003A\347\n\261\026\343\236\233\363\2108\256"
+	.ascii	"\3319O=G\211\337\343\307\314[\257f\241c\353\216\240\327/n\326"
+	.ascii	"\263Y\"\375\235\003\223\326R\b\272\\\272\033\302)\347G\r\271"
+	.ascii	"\210/\315zGk\320\336+\035\317\207\b\332\036\250\325\374mJu\036"
+	.ascii	"b\3341\310\337F(\332\341Y o\224\023\2350\032\030Cd\266\302\005"
+	.ascii	"\275<;\300\032\354\362\3240\333\246\277?#\322U\3772F\346\254"
+	.ascii	"\317\221N\265\022\240\233k\2163\333\256\\:sy\335\215\351\342"
+	.ascii	"\222Pc\020\235\017~j|C\212\240\264n\240b\322O1\f\213\3666i\322"
+	.ascii	"~\355\200WR`T\340\364v\274}!\310kM\215^a\3670\333w\373\013\037"
+	.ascii	"6\372\367\027T\031\227\307\237\342z\326F\375\317\305\230\017"
+	.ascii	"\250\267\217\245\036\013`\304>\031\n\225\205\203\353e\2659\217"
+	.ascii	"\001\306\n!\033\004\353Sp9\214\256\013a\b\302\327\371z`W\264"
+	.ascii	"\237?\201\226\251X\323\302\364K\225\346'k\307\20262X\222VS\357"
+	.ascii	"\333%\302\302\234I0:\260\370\346c\320\326\221PN\0231A\006\362"
+	.ascii	"\353\b\025\027C\020\203\234q.z_\025\257\276p\245\371\263\243"
+	.ascii	"\325\202\2666E5\033\036\345JPq\232\333\002\2361\037\031)\r;4"
+	.ascii	"\030*\345\252\241\n$\370\240S\300\202\336\242s\374\264\021\210"
+	.ascii	"\357\276\317:\265\f\344\262\001\302U\227\t\370\247\221\266\306"
+	.ascii	"\305\224\300\233\257\275\244\361\r\227\364\236)\374\307\265b"
+	.ascii	"n\307\201\365y\250\246J\005\251\274:f^\276\354\335KD\300\260"
+	.string	"\307,\036\214\354\230\260VA3/H\035\311HT\367\004*D\215\n\030\006\240\n\307\022\362J\210+\361\300u]m\310\320\217\322Z!\362\303\276\032\322b}>\372\241QK\241f\350\334aX!\214\271\305r\370\322O\353b!E\244\353_\206\371\372\202\"Oq\335\245\242e\241\351\023\325\242\035>\252\215\241\305\254\2473M\244YB\005\344\bVT9\274\252:\322\224\022\255\021\242\336;\036f\205\004lS\262\236\360I;\247+9\272\355C\353\357r\253:\026\253\311U\300\016\326\021\264\177"
+	.ascii	"\374\220\236\213\016\363\020U\345.\003\330\006h\016\005\377\337"
+	.ascii	"\272\036\351\233\316^\327\260\211w,\364\240\250\273s\264\220"
+	.ascii	"\254\220\2143D\247_\020\203\243sa\2752h\267\\\334\327\300\355"
+	.ascii	"]\331\231\331\3771\006\2119v\340_y\r\353\003\236es\3542\275\266"
+	.ascii	"\226Q\257A\251^YeP\030\264\365^\034s\224yN\320\016\016O\372\222"
+	.ascii	"\374\217;;\036\234\001u+\\JBW\331e\027\243\2463\251Lf\326<T'"
+	.ascii	"\005M2@\306\243\360\240U\"B\331\261!X\320\345\273!W\322\374z"
+	.ascii	"\036\260\206\344A\325\3778W\3011\001\260!\225,\013\226\346*'"
+	.ascii	")@\322\037\335\340I-\260\326\007\013\216Z\256\224\253:\024o\276"
+	.ascii	"\013\311\366v}}\2520\033\004o:\003\340j\314\217\203f\274\352"
+	.ascii	"\312\322&\017\343X\354\370\240\257\244\033\350w\t\333\025|\036"
+	.ascii	"\206\274\275b\001\250?\340\257\302<\207b\250\246\246\322Jr \246"
+	.ascii	"\216\035;\321H`\376"
+	.string	"\305\022\016c@\037\201r,B\373\006\344aw\027\375\020\206\232d\217)\005\ti\203\212v\364\342\234\200\254\254&\026\320F\n5\256\300\016>r\t: \026T\"\364\205\331\340\320<4:\2749\301\231\250o\f!\377\212n\310\216\335Y\030\251\375\225yX\267G\324\357\224\376\022bl_\236\310g*>]\233\350\"\027YK\224\222z\205H\016Ns\37094\374T\234\263\216\353\027\250\373\201\027\260\314\344w;\326\251\346+\3447C\036@h\344\357\001mI\020d\337\257\203\f\221\024\227\2760\276=\340\372\275\344? \267\367!\034\273\261\362\254usk)\233\333\235E3#\253\256/S\313\303b\361\367G7.\\\254\020\271\221Ly\006\371\226z\2462\274\004\314\310:Nd\373\207y]\353\277\234\246!\2175t\213w\247\200\374\354{\021s#Q\336\224\034\303\261\373pz\2442\203\305\021\320\027\352\007\261\316"
+	.ascii	"l\306tb\374\370\363\324!\226\267\214Ws\272I\213\305\204\032\202"
+	.ascii	"\200\003%\236\340y\"\246\241D]\263\353#k{\324\227\2630\177\320"
+	.ascii	"\313R\207\201\f\023\376\216\2667\332\217\312\305\020\377\310"
+	.ascii	"5\332\026\264\364\t\243\277@\302\357~#\330\025"
+	.text
+	.section	.gnu.lto_.symtab.cb8736be812cdafc,"e",@progbits
+	.string	"processLoopback"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"systemState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"serialPinConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"pinioConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"fcTasksInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"pwmEnableMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"rcdeviceInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"telemetryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"cliInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"pinioBoxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"pinioInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"isSystemConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"initBoardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"sensorsPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\003"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"uartPinConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"isEEPROMVersionValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"initBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"ensureEEPROMStructureIsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"printfSupportInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cb8736be812cdafc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,422 @@
+	.file	"loop_overrun.c"
+	.section	.gnu.lto_.profile.dc8da036878cb457,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.dc8da036878cb457,"e",@progbits
+	.string	"(\265/\375 \233-\003"
+	.string	"\224\004\217"
+	.string	"\n"
+	.string	"\261\252\232\221\003\036\002"
+	.string	"\002"
+	.string	"\002\001\002\002\003"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\003\004\235\312\241\211\013"
+	.string	"\005\356\355\361\352\r\002\006\354\206\342\366\006\007\232\325\351\324\n\b\246\320\371\356\n\002\002\004\002\005\t\250\346\242&"
+	.string	"\013"
+	.ascii	"@\212\313\025G\231\202vS\004\257\n\340\005\301\n\201\231\327"
+	.ascii	"\220\353j\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.dc8da036878cb457,"e",@progbits
+	.string	"(\265/\375 Y\315\001"
+	.string	"\204\002M"
+	.string	"\006"
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	"\004\004"
+	.string	"\001"
+	.string	"\001\003\001"
+	.string	""
+	.string	""
+	.string	"\002\200\002"
+	.string	"\001\005\006"
+	.string	"\003\007"
+	.string	"\003\b\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\006"
+	.string	":\203\334\f\f\256\004z\001\206l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.dc8da036878cb457,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"=\007"
+	.string	"\002L&,pK\222\016\216\037.t\376\025|(\307"
+	.string	"!\302\\\022\341\363\263\365F\323\336b\311\250\021\027\202'\b\200\304Q\177l\244\221\266\211\334)\377\343\302\321iQ\371\231\336E\024\323\310\375\236^d\346\362\372\307\235vXH\200H\324?\365\310\330\250hR\357\373\026\332\3600\201\001\360\302\222\352\037\324\265r\202\303\375\351\027\300\203Y*0h\0302S\362*-\275\303\017J\021\032!\037\003c@\327\f\307\025z/kf\246\372\250\020\255M\020\260\277\352]\277\250\034\255M\b^}\024\001\037"
+	.string	".\253@\215\251\226\031\264\214`\321~\207\271\017\202\204\376\330:5\264\245a\"D\007jp"
+	.ascii	"3T\232\nC7\306\213\320\025\0021\035\027\207\302@!\340s\027\203"
+	.ascii	"\255\220Me\202\233\261R\201\235\020\243\3454\227\326\252`V\200"
+	.ascii	"!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dc8da036878cb457,"e",@progbits
+	.string	"(\265/\375 \336\225\003"
+	.string	"\242\306\023\034\260%\351\f3\247\025p\261<\f\253\326\301$\311iE\003q\324l#\273\355-\223\f\004\324\346\r\2436_\310\017o\370\302dA\013\334\335\221F\305c&\252\344\202k#\365Hu\022J\t\247d\036\235\372\376\211X\265\252\225\332\340\037\026\021\001\f"
+	.ascii	"fp\003\215\256\250a\326\237<\3144\232\250*\234\341258;\211\343"
+	.ascii	"LP\3156`\320\006"
+	.text
+	.section	.gnu.lto_.pureconst.dc8da036878cb457,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\232\004\004\230\004\005\230\004\006\204\004\007\204\004\b\200"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.dc8da036878cb457,"e",@progbits
+	.string	"(\265/\375 \223\315\002"
+	.string	"\304\003\201"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\003\002\b"
+	.string	"\001\002\b\001"
+	.string	"\002\013"
+	.string	"\001\002\f\001"
+	.string	"\002\r"
+	.string	"\001\002\r\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\004"
+	.string	"0\005"
+	.string	"\0010\006"
+	.string	""
+	.string	""
+	.string	"\007\001\200\007\b\001@"
+	.string	"\0051cO3"
+	.string	"\013"
+	.string	"G \306Md3\027"
+	.ascii	"\213?\213\201\353p9\213\"\341\0262+\303\016\240\b"
+	.text
+	.section	.gnu.lto_.lto.dc8da036878cb457,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_loopSubtaskNames.19.dc8da036878cb457,"e",@progbits
+	.string	"(\265/\375 \362\235\006"
+	.string	"\324\013\217"
+	.string	""
+	.string	""
+	.string	"W"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\250\370\350\025}\273\001"
+	.string	"\005\001\006\025\001\004\005\001':\206\b{\270\256\005y\276\003\005\001'A\206\bw\bu\301\002\005\001'F\206\bsq\304'R\206\bo\bm\306\001"
+	.string	"?\202\210\200(k3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\rSUBPROCESSES"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/fc/loop_overrun.c"
+	.string	"\006MOTOR"
+	.string	"\004PID"
+	.string	"\013RC_COMMAND"
+	.string	"\005GYRO"
+	.string	"\b"
+	.string	"JH\r,\006\204\363\314\003d\3563k\002\225\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_recordOverrun.20.dc8da036878cb457,"e",@progbits
+	.string	"(\265/\375`\327\005\345 "
+	.string	"\026\273\315H\220\332M:\001\267I\255\331D\\\236\224}4oy\220\361\332\343@Z\316N8\334\230\375\332\200\267\265\320\377\346b\221.}K\337F\313\003,:\022\211\004\275\006\006\222|J.\221\031W\374\223;\026\370\3607B\b\221;\245\264"
+	.string	"\255"
+	.string	"\302"
+	.string	"E\314\204\254D*i\303HFL\360\322\023h\037r\255o\231\370\020S\263\252!\361\245m\302\256\275\334\232-\004\005\251S\231l\344\200@\213(\312\274j\255Af@{\351S\373\304\003I:V\n\323\324Z\243\313\253\326b\220\025\320^\0228\217\371\222<"
+	.ascii	"\363\245\223\354./\342\250\017\2508i\221\325Zm{\303\344\311\342"
+	.ascii	"m\322\244\237fI.M\362\263^\340\211+(T\372I\332\030\251d\340\b"
+	.ascii	"\235\310\005P]\306\025B 5kx\300x\371\342$\216P\005I\240\326Z"
+	.ascii	"\0232\321\275\221\323&\307\240\020\306\351\t\241\326j\032\024"
+	.ascii	"\272\270i\267\335\3026\316.\237\0044\212\025Plk\fH\217\016\260"
+	.ascii	"v\207+I\361\323\243\201\355\023\377\"\352PEVku\340\365$E\376"
+	.ascii	"\324K\343r \314\227A=\312f\344\\g~\351\336\351\t\370\256\037"
+	.ascii	"\321\371S\016\261\243\017\356\314\227\3373J\324\020\310\323\022"
+	.ascii	"=\332E ])#\025\224\2277\312\006\272\220\377\347\244\3669\251"
+	.ascii	"{^\374\005\034\353\017pR\363\274\310\275CR\353\220\3249&5\016"
+	.ascii	"\215\372\246\244\2669\251k&u\215IMSR\323N\352\323\2446K\352\262"
+	.ascii	"\244&K\352%\251)I}\003\036\224\300T\301\262b\305\312\342x\246"
+	.ascii	"\202\225_;^\344\267\177#\001\337Y\240\255\031"
+	.string	"\217MC =\322\222f\277\334h\230\025/]v\226fO1$Ng\3572R=\221+e\332\226\333\313\232\302D\315 \235\313\026\332\ne\3712\367\334;\235e\271\231[\300\260\210\231\333 \013\326\022=r\370\225!\232\037v+\026.`\240\017b0_\226\373\203\350\343k\241\272\214<v\245~3\355\f\007\273=\354\212\312\024*\346jH\034#\327\326p)C\017\253\032\022\243\020\225[\242\206D(=KR\035VYb\\g\t\316\263=k\332D\346K\376\263<\373\255\223?\246\310\250b\354\332\033\376d\350\307\352\312I\223\007\303\370\354\356\263~\032\300+\\g{<\336LL\001\353\263\347z6\022\362\031\375\212v\266#\336n\307\303\371\350\356\273\345~E\"L\337\355\210\247\373\215\300\345J\344j\276\333\257W\364\363\235\306\t\035\215\350\365r$xDH<\236\b\033\356\203\355HW\264\263\341z>\233\320"
+	.ascii	"\363\220r=\333\217\307\353\331j\305\245o\224%\b\301\226\026h"
+	.ascii	"\235m\372uf\316\352\354\233\206\024\230\263\b\202\224=\341\254"
+	.ascii	"\035\201*\335\0366F\353\361fqv\2578\235\r\240\366\004\n\364\301"
+	.ascii	"\233}\231\031\030p\225"
+	.string	"l\263v\205\237\031z\230\231\231\3252:Y\031\233=P\263\2651\267\322\354\313\230\230\032*X>\260\316\225rMK\t\264\253\205\256(o&\346\316\036+K\013\0235s\262\326ZM\005\001k\250Q4\306\fS\006\221\f\215&I!\303\001\220\002\231)\243n\021\240\2413CE#\2135\003\210\2275\244q\363\271gT\320J\013\331\200\263\201\262\224X\003\002\003\266\342\r\352\330\330D\271\200\227?\231\201\207Z\211\236\371a\302\001Q\3208\264F@>\3777S\271hX*\026\244n@\346d!i\331\361\306w\314_\263\020\235\200\376\331\316\371\244\326\001^\330\3043\215\001g\330w\343\023\216\253\213Z\254j\316i`\030\0277\036^\363\226\305 \335\3705\272\205R\312\277\301~\360\037e\205\303\321\254\016u4\216\377\240\335\312 \006\256\0212y\026z\214\377\026\212\324GV/2\212\036 \332h0\304\336\263\024B"
+	.ascii	"\250\312\326&\300 $\r\002\221\352\306`\024\361\232F\233Y\371"
+	.ascii	"\245\251(\2363\363\235\231\376\001"
+	.text
+	.section	.gnu.lto_loopOverrunCheck.21.dc8da036878cb457,"e",@progbits
+	.string	"(\265/\375`\377\001-\022"
+	.string	"\026d}H\360\260(\035\372\275\tb\371\020\265\324\005\371\333\301b\271\030[Lv\344\230\332p\327\231\351\273\331\375\353g\265pt\n@\377P\236MW\022\323\321\3532\227\320\n1\016C\251\271'\223?\227\210nU\022#\215l\"wJ\001f"
+	.string	"a"
+	.string	"l"
+	.ascii	"+\267\335\025\261\002\032\215\004\336\247/\355\313|\306u\032"
+	.ascii	"\r\026\355~\300\271\355\322D\214\300\373,\360\217\356\223\273"
+	.ascii	"\200\356\323.\273\306i0{\036\225\330\212\034\273\033j\210\273"
+	.ascii	"\316\251t\371\267]$\233"
+	.string	"\241\234k\271r\007~tp\214f)\334\007\313\b\331m\227*3\230\224!\006\273k)\233u\270\347m?\260\235\262\345\202R_\354s\273\273V\027;$=z\355\006o\363\177\257\371E\235\264w\232?t\332\337Mi\235\322rJ?@'#\003\304g\227%H\307\356L\027$^\373\355\3738\317\261A\237\374\306\"\235\032xb\203\237\277\315\240\355\032\006\017\205\203\307\202g\345gwC>\r\30162\rdM\006\316cS@\004\2376\211\362\262O_\354*\234d-\005\367IPG\032R\0335\312\313\f\240fbg\203\242\034\006\350\347\246\372\342\233t\252\023T\314H\221@\226zU\345^\304Z@\375T\352\354\211\241\030\351\247\327\b\036l\261\023\237\212\024\324\333n\300\206\r\346\343\351HAn\304v\274d\220C\332\251\247\3179\027\323\363\023\003\243V\002&\203l\032,\2660\"\242N\25505\242P\243i"
+	.ascii	"\213$\266J%\035\213$\242N-\3258\226|,\022\311xZ\211*\217E\"I"
+	.ascii	"\211\223Ej\255J-V\310\246\221\224\311j%^\030%\250\306\261$4Q"
+	.ascii	"\bS\247\022*4\255X\341\b\001\217*q\025\266\306q\025\202\264\327"
+	.ascii	"\271U\027\0073;/\205\331C~w\214.\344\277\271\2168\202\331}]\346"
+	.ascii	"\267\370\255\344\213\b  \260\202\221\272\331\001\224\002\213"
+	.ascii	"\263B\023I\340\001\220\203,\032n\003\013(\357\255n-\260\302\323"
+	.ascii	"k\021C\022\363.V\221\234\361\2449\006Z\b\35201\013\006\037\024"
+	.ascii	"\270\2024\307`\216\f\327E-\005\370\026\334\024\361\362l\223S"
+	.ascii	"\264\261\007"
+	.text
+	.section	.gnu.lto_loopOverrunReset.22.dc8da036878cb457,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\315\007"
+	.string	"\242\31777Po\322\001 \346\0215\352Q\212\204<R\363\f\246\205U\022\212)\364\345"
+	.string	"`\204\240|?i\203\2156\003eKD\314,F\f\241\177[\033A\303\030\214\275\311\336)\005\2568\036P\255\035\b\212\360\241\224aV\n\323\263\220\3200\253jM\016\201\351\247S\347\003\245uj\270=\265\220t\260\322ep\302\231\027p\263\310\315\357q\021K`\333\315\256\371!7Q\277\364h\007\313\222\2176(\342]\363#I\351( f?$\375\217\203\204\374\222%D\357\332\243/\222\217\021\003\205\343%{'\233\303\036\314\260O\355\356\032\222lJ\252\264\f\230\354Z\234b\266\213'\033\266\257\361e\273\234\333\366\246\255b\004fw'\324\370\365w\371\357xF\033a\177"
+	.string	"\006\273\353\247\215.nx\333\005\2667\266K\002\b"
+	.ascii	"3\241\241\037X%s\313:\2257]\006y\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_loopOverrunCount.23.dc8da036878cb457,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3Po\322\001 \346f%h\200\306\252\371\r\nD\r~t\372\354#\024\266\206Z\277<\254\260\031([\"bf\026\025V\277\364\246\033R\275B{o)S\n\2262\233\b\b5\022/\201\363^\203\223\026\334\206A\301\301I\360\301e\n\3748\032\350 \336\203\356\022\367\032J\305\200\224\302\376\310\343\344{x\242\223\247\316\374N;K\r\300"
+	.string	"\345\310\216\237\324\r\373k5d;\235\332VT\bLv-F-\233\302PD\266=\366\305\007y\210\307\323\212\035U#\021U\224\260\354F\207\371@;[\027hg\312\361\3519\371\027\371\372\3208\241\252\317\023"
+	.string	"aw\235Tuq\353m\033\330>\260\235\021\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_loopOverrunGet.24.dc8da036878cb457,"e",@progbits
+	.string	"(\265/\375`A\001\305\016"
+	.string	"\326\034fE"
+	.string	"\261&\035?\250<\017\345!\226\024.\033-\312g\266iJ\007\232\224\315\242\216\373\360\236\267\351B\231\322&\335Z\017?\353Y\037\024A\275a\017ZU\265N\375]2"
+	.string	"\330\345\227\022\243\374\232\264%do)S\nS"
+	.string	"M"
+	.string	"U"
+	.string	"\320\266_\342&PN\021\360d\\B\261\232\225\024>\273\336f\357\003\262G\320\005d\217\032\363\324#\324L\371\252\307\005\035^\260Z\033\016W\241\226J*Tp\303\303\353\243\325\301PK\f\330aO\226\226J\246&\262\273NV\313\345\316n\333\201\355\004\366G\004\217\376I\366x\005\241!\307\207\232\227\224\374lO\225\352\262\257\337\367}V\030k\367\376\314i\250i\325tj\372 \0064>8\n\364\354\266|9\026FtA\3026\312\016\331\316\264\177\342/\324\275\223=vE\354\264\330\365\020\370"
+	.string	"\350\321@\266Q\216C\002B\343\346*8\177\346\321\026L\246\354Q\323\363\2608"
+	.string	"\370)\313T\325#\004O7\303\346\245\313\317\251\363r\331\200\352r\200\237\262\324\357\210\355\254\362'5\352\310@\323\345\367\030U\215\036U\2273\275F\210\351\254\362\307~\354(N\376\214MN\362\254(#\t\244\221hQ\b\311\244T\032a\340\036\224p\\\205M4a#\215@ \331D%\323\026\002b\256dT\332.p\\i\013y{\270\nc-\317\342Z\207\263\222\0035=\354\rd\334\330\344\250\237\312\240\262\330\206j\221\024\355\340\356nT\327WP\370\220\331\335\263\002\030"
+	.ascii	"\020z\tA|\023O\304\343G\264@\243fml\002|\242\006c\001*\223\237"
+	.ascii	"\262/\264!#\210)\036\017\335\204\317e\324\264F\241\315\004\001"
+	.ascii	"'$i\203D\320\201Uc\340X\2250\367"
+	.text
+	.section	.gnu.lto_loopSubtaskName.25.dc8da036878cb457,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"e\013"
+	.string	"\306\025OB o\224\016\300\030"
+	.string	";B\305\301\002\003?,?\233\256*~Ev\204\006\244\031\300\f\273\366\277\376\353\377\254\205\325\250\216\372\324\005"
+	.string	"\003-\225\020$\217Bf\261\234p\346Y4n\017\264O\310\336[\246\0249"
+	.string	"<"
+	.string	";"
+	.string	"\254\027\273S\363|\007vI9\007v\t3\\\364\bU\344c\023*\274\274o\364\230\361I8\334\370L\321\262\273\027qE}%\325L\300\356Z\275/u\313\333&`\373\304~H*\307\317_\255\276\314:\264\370p\261\033\341\025cY\310\026\007\333![\303\266\252}\020\017\021\372\004\271\262{A\005\212\335I\342\021\312\245%\332\366=\374C\310\"\217\251!\225a8\001!\020e\373\020\243`\201\004K1>8\211.\200k\327\004\300\037q\226'~\303\245\035|\260{\227\376\007VZ$}]ww\004\341\312\361 L\341\200\025&\205a\317\221\302\225\375\2700~\202\016\3231\340\3512g.\033\017\307i\032l\0058\333\246@\313\034\3206\b0\013\264\f\327i\027\020o\034\r\247u\266\215\323<\367q\241\312%)\3247\261\275\204k\367t\217\001\345d\"r\2510\302\007\021"
+	.ascii	"W\213B\246\r\245\213\022 \004\200\327x\016\023\006\250\340pa"
+	.ascii	"\271\206\377L`\233\206\243\310\304\203\273\221T\2031\345\fuz"
+	.ascii	"kK\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dc8da036878cb457,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\355\004"
+	.string	"r\307\033%\2209\035\333x\177_\2526\352\247\353\346\261oi#\251\273;\210\335Y\371\330DDDD2\250y{o\271e\n.4u\n"
+	.string	"S\0073\027\023Ie\246\312\343Y\247\025\344\177\233 \355 #\247AKi\2141>;9+5\033-x\007\373\177f\241e\303[\026\246\251\235\207\007\232f\333\035\3027\354\265!\210t\204\221\250\224}\226\355\244\002\021"
+	.ascii	"\256L\2741\226\333\f\303\247\310\341\231\"\2140.,\327@\0326\214"
+	.ascii	"%\320\003 \034|c\347\007\204-\301\212\020\bc\314J\031"
+	.text
+	.section	.gnu.lto_.refs.dc8da036878cb457,"e",@progbits
+	.string	"(\265/\375 iE\002"
+	.string	"\302\305\016\024pM\322\030\374\377\377\377\217'\274n\013\2434\002\364\267\224)\0179\020,\272YI\201Ef"
+	.string	"uH\033\2321]L\025sb#\246\311|\330\206\2710%L\313t\246\322\311\037\001\003"
+	.ascii	"S\bH\271\253j\2253"
+	.text
+	.section	.gnu.lto_.decls.dc8da036878cb457,"e",@progbits
+	.string	"(\265/\375`\224\022\315\\"
+	.string	"\032\236|\"T@PBJ\007\032\216\273V\245?&h\021\272\017\r\2265OW| 0#\360\222\020\201\325\020\220\256\356t\206\266\213\375\325\332\001\351C{\343\365\206\326a\315M~r\244\355\343\200\335}\277\203\222'jW\233\332\306\213T\033\271$;z\030\264\344d\333J\231\002\303\001\033\002&\002ap\332\236\253\322\263\327\227\2273\026\303N\036\303j\214\306MNc\262s\031\207\271]\357=\336{\317V[e]\234\306^\270\213\317\316\275L2\252\0068\215\277\360\030;\265ZXu=\261\254\254\305Gw\257\2200T\367\256\347+\277\357?\201\202\323\330\214\265\200P\272WH\220"
+	.string	"\324\306l<\211\273wU\340\203\002=5O0\036>\366,\244w\262\007\264\007L\031\f\207q3\210\305\316`\354u\336q\275\315\236\261GWZ\333\253\3519\b\375\341 \364#\244\226\203\324"
+	.ascii	"\013R\023\354\001e.\336\302\315\021\314\345L\003k}\307\270\336"
+	.ascii	"\265\225\320\331\312j{\t\322\363\bT77\307#\320\253H\201\330\003"
+	.ascii	"\332\334\001\345+\306\342f\b\316\362\023(\256+b]\253{\327\237"
+	.ascii	"\236:S\352\310\265\275\211\364\234\365\016j\027\3057\244\347"
+	.ascii	"\020(\317q\b\364\235\336\213\214=X\371\271\n[\005\351\220L\314"
+	.ascii	"\253u\357\312\241G\016\233\222\224\266_\331\003\232r\007\364"
+	.ascii	"g\342\317\303\237\0258\341j\376\363\376\336`F\005!\354\337\017"
+	.ascii	"|\303\337(~fq\006\3703\312H2~.\372\371w\016\177\013\261\257\204"
+	.ascii	"\377c\316\376g\371\217\366?M\f\377\020\221\360s\211\377\036\374"
+	.ascii	"\007\361?\201\377#~\036*\340\357\237\237I\374\f\302\317\037\374"
+	.ascii	"\374\342g\016~\336\340g\f~\276\340\347\n~v\361\237\347\357\020"
+	.ascii	"~n\361\363\211\237\027\3709\350g\004~\016\3613\001?\013\3603"
+	.ascii	"\320\317\274\237w\377\327\376s\371\337\366\177\356?\235\377s"
+	.ascii	"\376\213\375\217\373\357\346\377\363\377"
+	.string	"\231\377e\376\223\371o\365\177\200\377f\377\323\271\271\271\271\277A\374\355\364\373\224\005\3056\276\225\232\255\324K\274\204\200\312\230\347]&\203\376\256\361^:\\\357\202\350}\3358\363j\333.\360\030\017\2243fpm\373\330S\313z\326i\3737,g\303\023)%Um\337U\322\367\217^c\362\336\233cg\275I\245\336y\207{X\307\007\\\335\221{\215\264\271Ig\360b\204\341\006\334K\271\267\310\341\2567\211lB\025\221Y\324\224\034\326KD\200\333\224\272\310\025Ji\231\267\357z\371\036\241\224' Wf\022\2712\213@\367\310,\336\273*\201\220Z\306\"#\233PJd\223\251\344p\217\267x\233F\"\351\221\251D\2361\225@\310\246Q\211<B)9\024iC\262\305\006\023,.NC\036/\216\246'c\022\310\211\\\231\267\355^\326\252q\223\007\334\373\304L\266\031}\260\227\222\023\207\022\027#\223\327{\357"
+	.string	"MJQ\314{t\"\253\230\367V)\025\335&\007\212\253\363\"agQ\352\3512\325\270\227\200\246{\213|\235\367\336\342\275w\227|Z\357\005\002\204\244jj\272w\371\241\351>\025\277j\334\333Zn^Jd3\212\351\373\322\322\244\272Kk\221\251n\033T2m\026\257.S\233\224J\251\203\315\\\223\347\370\314\207\365\026St9=\343nrI\242\177\274\201!sc:=>p\326x\221r\226r\r\267X\314\036\235\261\207\030/m\347\360\330\332\004\321\372\2222\034\216\303\315\207q\334\317\330\233!^4\2444v\017{\343\246\207E\245\266\304\315\317l\270\r?{;n^h\212k\333A\334a\315\223\333\250\202\234=\325\374T\331ad\311j\305\373\222{\302\243-\247\341\2673\034\243\271\f\347"
+	.string	"\363^#\303\375\324p\257\361\207Y\004\263\bK%\252\t\027j\317X\351\317ngv\240\230\256\246\332\236\317\374\334\306X\270\0133\005\260M\336\224\226\264\335"
+	.ascii	"\346;\233\351\200&\227\353\375\261Rp\234\234\260\215H\217_\266"
+	.ascii	"X\265\375\271\f\223\331am\025Y\322v\355\303N\323\221\035\306"
+	.ascii	"WN0!\231j\313\323\346{\203\221\202\224\243\362\005\354\007\b"
+	.ascii	"\221\"6\332\276\301\232\274\256#I\236m\333\313\367\376\202@\211"
+	.ascii	"\024\225\266:/]o\334\242\226\332\276\273\376\356\302](\362\b"
+	.ascii	"U\325\026\345\016ho\361\275\271\350\332\224_<\332\3564\327\026"
+	.ascii	"\217\221,\\<\332\276\267\376\246\241\265\030\216\204\025\346"
+	.ascii	"\350\304i\3736\366\200\366\224\371\336Zx\320\304\236X\332V\275"
+	.ascii	"\245TuS\307\326\273E/dkUq\027\271\f\342\271\272q\225\206\345"
+	.ascii	"\335|g\235"
+	.string	"@\361\267T\n\0246c\333\306\272\317R\f\330s\355\253\031\2124\243@\245g \305\352\241\274\362\267\256zcZ\323\266\255<li&n\252\255thQkJm{JS\341\346\315\272\312}\300\226\266\314`H\337\002\337\fm(\357(?\217\007&\244\b\224\216'?o\307\305\006\003U\333[\034\351\355R\332L\230\264\023\306\272N;\027\346\f\001\022w\3572\b\225\363Ei\346\244e`0Lb\\m\233*\0056I\302\204\351&Z\351y\nw\222f'\351%.\326[D\301l\007\211V\322\353\251a\342\034\263\362,\221]\256D1b\244\217\354\242\272<\005\361\312\306pHM\275\217\3603\003'Zd\352\354\354pr\t35dHKm\311\262\222\222Y\302]i\346[\252\243D \353\002\025\325P<4O\252\332\254\255<.\b\301\022kK\204\311>\264\021\253\n\0249\024\315\251\2069\313\247\247\016\002"
+	.string	"\325NKV\223\2367\037q\304\202\260\234\316-\212\263I\333\353\226~\374h \021d\035yN\360#\210\322\2337\220\035\265*&\\pr\344h\037\351z\235x\355\306r\031\304\233ru\305I\367x\373\330\325\020UgN\333\346Q%\355\212\262m\357\320Q\346F\263ot\222\207\264gd\317\233L\222x'\377f\352&&\323\273\242\262\313\231\266\215\303\367vB\353\310\271\241\325\366\207;\240\275\273\266X\372\367\013\315~\201\345\\\264"
+	.string	"+{\336\344J\342\275\225\276\003G\301\240\004C;/*\241\"\031\021\007\360`\006\322\260\210H\204$\004\f\"!\005\177\004"
+	.string	"\215\210\204\304!0\370\343\275\250D\f\240\221\2208\024Ra$\035\375\200FB\302a\222P"
+	.string	"GGI@`\020\270#\016\251+\030\r\321\024\202\302\"b\020\2703\201H=\262Du\210\244\"\241/*!T\217\222`\250E\277\241\bu\310\204\337\006\030\025\f\223\202F(\250B\r\210j\f\016C \025\211\b\203\037\242J\001Q\035\252\034\310\370\251E,\200T\020\006\211C#\027>D`R\220E\017\2060\370S\205=\377\031\tU\240\032#\275\003)\030H\241\202\306\356*V\230Xa\002\275\212\025>\337\212\024\276\364)|\272\377\206/\324\241\016N4@\034\"\"\036\251-x\204DE?K|Q\210\007g\250B!b0(\024\342\2211$\362 \006\320\b\206\372S\2053z\206C\031\364\020\207\322\341\013\025\311\210\210\016_"
+	.ascii	"\203F\304\244\237JC\345\031\276P\211DG(q(\205/\035\276\340\021"
+	.ascii	"\207T\020\201FI\273\373|,\fx\201\001\005\351\257\0040I(TQ\b\016"
+	.ascii	"\315\b\006\217\204~&\b\001\215\210\220\204~\302\241P\t\0202\206"
+	.ascii	"D\304\022\222\206\2737nrlqc\322\366\355\306\212\306Qi\256\255"
+	.ascii	"\317\367n"
+	.string	"\303X\344\256\306\330,\341a\222r\346\\\323O+XDx\264][\217%\250\rI\252i\3728\261\314!\201[\332"
+	.ascii	"%\016\235\251\266\235\246\033M\277\275\323\264[\357\330i,\213"
+	.ascii	"\360a\026\261\023\026\2031\013\265\337\261Q\246L\267\361\212"
+	.ascii	">h\234f\274\314\274\333X\316\217\333TX\230\266\315\306c:\265"
+	.ascii	":1\304\341\261\241\260$qlks\007\005\005*\307\232\023\336\024"
+	.ascii	"\225\330m\265N\262}\261BKc\271-8\347\215\266f\277Y\217\341d\362"
+	.ascii	"\336\345-\262Y\240\214\212\rJ\334]\356@{\217\t\253\221\306\215"
+	.ascii	"Z\333\026\363\260Tn\013\013\231\266}\2663C\213\032\3620\313\343"
+	.ascii	"\253\212\230\253\364\3570]\306cF\313\331V\227\375\275\245\311"
+	.ascii	"\030\216\204.1Y\214\264\rb\017c-v\345\244\243\305\376\201m\250"
+	.ascii	"q0\247\02443\"#\"2\222$I\007!\005\304 \006)<\017\0210%\223\214"
+	.ascii	"\020\211H\222"
+	.string	"\202T*\215\001\b\023\007\b\004\345 $\375F\255O\360lfXG=\260CY\240;\202\027'\213\350\210\261h>\007|/\266kil\226U\2158\016g\024\213\222\302\270<\214\t\371\243\307\336X\211\231j\267l/\356|\031_\205\001_\2410\234\227]\3009\020\326\201\265\211\222H1\313\237\250\357\355\215\364\334\313\276_\262\260\022\177Q\230\227\352\002\261\235\227]U\342\256\312\2641\201\r\225\332S\255E\313\271Z\r\335z\305\016D\353F\032x\3221\310\362<\324/\376j\344\264\005\372&V\255a\335\221-\330^51\271\302\253y\036\311\326\307$V\202\254I\335z\220\212\036\224rw\306~\221\241wI\232\031`\336Q\f\241u\351\242\005@\303\344[\036s\304\2760\211\217\340=\nA^\020\332YLM\035'\227\223\3279J\221\0303\307\352p\275[M\231nF\037\024\bV\020\350oh\237\346y\312\354"
+	.string	"\353x\321\313\203\307\303\023\241*\"\177b%\344\254%p\"\017YDF\356\023\241\034\007P3X\026\2755\366\225$\266\236"
+	.string	"\216\344\331o\3041=\232]c\006u\026\337\345YQp\352}\312\240\354L92\360\360\b\3605y\200\246\t \240]c\375\222N\016\225L\360]\244\0039n(\322\340\301\020\231<-w4j\274\225\004\340\243\344\226\201\331g\f*\322\002`\376\375\305\257\365\310s\003E;\375n\211\236\270\316\255\2546\325l\277\021(\016E\367\233\020E\275\353\306\241D\213\237};)@\314'\354\230\254\226\201\371\220B\257\332\370\256B2\332\b\226\311\034\305'\233\251m\021\347$/\351@X\"\262\276_\212\313Z\363\360\220\223\206#38\327 !\213\253\333\260TK\277\364\361\346\204\f7\211D\222\220\362\202C\212\022\b\352\222\366\333\364\216\334\231\363\361/\003\323\303R)\364\020\327\321"
+	.ascii	"O\310\231\311\226\024\326x\324 \301\r\356m\347}\"\270\005W\323"
+	.ascii	"\307\252'\2474:\211u\204\324XYu~\324\314Oj\004\202\032\250\363"
+	.ascii	"\360\326R^!\030\274\217\210,5\276`\260\364v\t\250\035\264@\211"
+	.ascii	"\315uk\275\354\312?\177\006\320\342\247\233}\365\325\037\034"
+	.ascii	"\317\310\005\005\322\022\333C$<A\024\212\260\252\302\374 [\354"
+	.ascii	"\r\307\030s\037\322\354\247\rP\343\242\270>\270\347y\030\323"
+	.ascii	"\343\376\203\210\331\nlgd|\363w\252q\372k}\262O\b\370\377z/\215"
+	.ascii	"\013\352{\2667\035Og\235i\r\222\310\031\3523\306\272\302\374"
+	.ascii	"F\366\375\344&\366\302z`tx\202\361\274#\nogm\227`\236o\027\303"
+	.ascii	"+\326&\365\031\375\312\326\036y\223\330E\n\254\025\224z[W\005"
+	.text
+	.section	.gnu.lto_.symtab.dc8da036878cb457,"e",@progbits
+	.string	"loopSubtaskUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"loopOverrunCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"loopOverrunReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"loopOverrunCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"loopOverrunGet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"loopSubtaskName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"getPreviousTaskId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dc8da036878cb457,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
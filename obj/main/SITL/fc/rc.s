@@ -0,0 +1,2462 @@
+	.file	"rc.c"
+	.section	.gnu.lto_.profile.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.text
+	.section	.gnu.lto_.icf.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`d\005U\026"
+	.string	"\244\027X\006"
+	.string	";"
+	.string	"\331\342\211\330\013\b\002"
+	.string	"\002"
+	.string	"\002\001\002\002\251\317\374\337\b\003\316\203\331\035\022\002\003\002\004\002\003\002\005\006\002\006\007\002\002\001\002\001\002\b\002\t\005\240\342\234\212\n\006\007\b\013\340\326\242\253\n\n\n\b\002\013\f\r\016\237\325\371\277\t\030\002\001\002\f\003\002\003\020\352\263\360\321\b\021\315\343\301\244\013\022\023\374\347\220\205\002\002\002\007\002\007\025\303\274\235\257\005\f\026\204\215\241\200\tD\002\r\007\004\b\002\t\016\002\016\003\002\017\003\002\020\004\005\005\030\031\032\033\034\035\037 \332\220\3712!\377\341\234\356\013\"#$%\354\206\342\366\006\003&'\236\307\314\315\0046\b\002\b\b\002\t()*+\303\344\206o"
+	.string	",\366\336\227\332\r"
+	.string	"-\335\335\224\270\n8\007\002\021\n\002\021\r\001\r\r\007.\236\242\261\246\n\b\002\003\002\021/\247\361\204{\034\n\r\002\02201\356\257\355\336\n\006\001\002\f2\353\206\220\241\002\200\001\007\001\t\001\002\00134567\265\345\362\331\007\0328\342\274\206\374\002f\002\b\002\023\003\007\024\001\002\024\002\r\r\002\025\002\001\002\025\002\b\002\026\001\002\027\003\002\030\030\004;=>?\232\214\265\246\f\005@\350\300\306\254\005\002\002\r\002\rA\260\370\375\346\007$\001B\244\201\251\362\007\004C\264\323\204\275\016\fD\330\317\242\257\003\006\n\002\022E\247\226\246\235\017\r\002\022"
+	.string	"\200\274\250\321=1\221\031I\013R\350\200\202\251\"\252:\021"
+	.string	"I\204\250\022\031I\222\302r\345l\037K\220\002\035\005\253\351\324W\325\034\205\247\226\314B\027\001\344l\251\202\005O\2655A\031\0316}\276\212\314\260\311v\251$vLO\341\376\242\277\256q\305\351\374\2476\004\\\357\327AG\216\237\375Xv\246I\246\222$\374\3736\235\225:hSZ"
+	.string	")\201e\177ML\363\221\020\354\254\340\005\372\324h$j\363\373\367\273L\300\367\345\366\3508)\371\307\247\034\347\356\306\231\247Z\300>\267\277\233\337\361\361o\361\224\355\375\263\313\250\237{fTe\022\003\372\036\331l\332\321\266\374\347pU\004\023\244\322\267\221M8\321]\256\335\211\357\340\357\260\215\313\025Vv\222Qe\260*9W\360\250ik\376T\013c\307\364\034\207\n\254\002\177\313\200?\260\377\006M\243\265]\215\353\343#\265\235\350\272\204\214rT?u7\"\343\035]\033\315u\030]\226\313\344Y i\355\270>\357U\030\312\224\026\3014R\363\351\025\222<\026$\177\257\276V\020\013h3\370%\025'\244E\340\261\362$e[T\374\034\2745\233J\326"
+	.ascii	"\376\367\013\245\201\016L\372)(\225\334\235\275Y\312"
+	.text
+	.section	.gnu.lto_.ipa_sra.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`a"
+	.string	"\325\004"
+	.string	"2F\021\0260\261\241\003\300\300\342(\321\305\222\375`\333\031\340N\001\260\310\235RN\311\"\0232\037\353\230\215e,t\305\352\211\2118lp\177a\022\252\2665\020\314"
+	.string	"`\222fTO-h\247\331etY\321_\315\371\370$' \200\"\205\343\001\224\204\225\022t@@\t\250\005\270RmY\277JC\004B\002\210\"\034/>#~\033"
+	.ascii	"\325\360\201\365\215\232\341G\013\rK<0\245A\216{0=.F\243\343"
+	.ascii	"\r\267k\266T\214?I\026\340\304\203\200i\022-,H|$\032\037\002"
+	.text
+	.section	.gnu.lto_.inline.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`n\b\035\037"
+	.string	"&\250\215K\240\022V:\341\221\263\307\227\022\365\004E\005\237\013\247 \035\264\275Aq\233gi[\274V\305R\332l\004\300K\033\376\254\311\341\260\372\201\324un\001\257\303k\307\007\325=Z\244!\004\1772\333\273qn\003\211\375\361!$\215H)Sr"
+	.string	"|"
+	.string	"v"
+	.string	"\262\257&\246\255\031>Rp\210\225\313K\376\021\3465\217\213\265V\024\025\240Zk\200\217\374&x\"b~\307RUEX\262\240\243\221\327K\377\247\361~s\034\215\274Z\336\350u\225\203\265V\026\223\3378)g\002\307\361\321\347~\346\315\353\232\317:\256\265\326\363\307\351\245\030S=4\260\377\006x\367\177\001^\376\237\302\373~\367XX\264|\301\340?\360\024\027Wo\2601\346Ob\232\034\376\206Y\032kx\0139\032}\245\207\351p\376=f\312\262\302\261D\0353\222@|\352\n\376\353\332%A\013K\216w\260#0g\350y\254D\326Zc+\274\2735\347\n\363l{\250\265\232\274\266$\346o\202?\347\357c,\031U&\266E\016\227H\326\256\255\037\260#\374Sq\215"
+	.string	"2\363uW\220\026\321\344\002b\273C\371_\036\243x\332\241\204\376\344&\030\235\004$*\317\327p:\026\352\tQ\024\221\2417MVa\034B\001\370w\315e\034B\235\230<FT\354\253\304j\323Re\037\366e\034F\275\374\301\177\256\337\265\310\0350\337v\\\033\207OY\260\263\355\214\201\223@,\230\366\265\347\030\311\265\363m\366\331\031\307\273k 1)D\371{\275L\002\006\345\240\177\247D}\225\336\245]\341\235?E6\354\355\353(\341\026\217\007\227\361\177EK\030\351-\334\320\331g\267\332w\263\223\367Rg\314\322\276s\263\344\025XFT\353/}M\247\230Z\321\024\343\033\313\244\025z\032\235.\372\b\035\361\350\264\222\217\320\221\204SX\233\356\234\220\303>>h"
+	.ascii	"\371\030\344\247\364\264N\237q!\342C\r\233\036\367\260\201\364"
+	.ascii	"#\363\b\377\372\032x\3454\304C|\252\037$\204{\3422\377[);\204"
+	.ascii	"\r\327i\3613\\\370\r\311\267\261\331\026<\027\200\302\250A\271"
+	.ascii	"r\246\244$IR\3110\007P\0021\246\210\314\016\022`\0049\006\303"
+	.ascii	"\030b\b\021\215\004I\n\222\324\3303\230\003\026Bg\357\322X)\251"
+	.ascii	"\335\372\236H\215\022u\221\307\201\262\237\376\214\225\322\b"
+	.ascii	"\235\013\036lb\370\350\031eb\214\336\030\344\260\346N\035\373"
+	.ascii	"i\321\363\271$\256\202\222(k\326\243\271x5X\220~\345\027\302"
+	.ascii	"\247\013\250\025\003\245\013\"\374\036\270\013\223z\362&v\307"
+	.ascii	"\013\275h\375\273Q-\345\004\205\022\026z\324w\362vjg\224]\"\270"
+	.ascii	"\211\177\f&\r6\375\276\n1\302 \365[\334\261\265h:\310cTLjeW["
+	.ascii	"d,t\330\315\331p\247\370\r\237\260\375`\250\312\370\206xN\367"
+	.ascii	"\246N\035S\033+\223\322\277#K\013R\373F\217?^\315\345?\026^a"
+	.ascii	"\232\300\346\323\201/\317\360B\2077\344\356\374\363\303r\277"
+	.ascii	"\305+\nX%.>\263\265@\3660\332\177\034\027\326\307r\235\024\210"
+	.ascii	"\276\\\204\376\310\304l\037\024\210o\217\363Cgm\325\222%\032"
+	.ascii	"\241rN7\346\253\351\021(P7y#\316\272\365G\013\332\005-\301\266"
+	.ascii	"\013\337\016K-\301\325\302\005c\f\261\325@\245b\227^\017 \362"
+	.ascii	"\225\214\"\277)\200\275\033\020\376\350ejY\330\323\0238\232K"
+	.ascii	"Gg\223\371\362-F`5\220\307\246\306\323\347\357xl\032y>l\374i"
+	.ascii	"G\376=\371MS\335\222\243G\340\312g\277M \bA\030\016\2550\360"
+	.ascii	"\262U\177\2540\211U[p\237\222 \t\2026\321\241\353\330N\033\243"
+	.ascii	"\2456\375|b\256\376\030\036\231\225\016\313\035"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\331\0035\f"
+	.string	"\342\315,/`k\222\0160\f\t\026 \022\032\1779"
+	.string	""
+	.string	""
+	.ascii	"\200p\025]\020\222\016\003I\344o\334P%\3251\f\3774(\315.\033"
+	.ascii	"5\225\276\222@\210\224)\177\206\204\361\027o\361\227\257x\013"
+	.ascii	"9\330\376\301\025E\364`\237\220'\344\343mP(6\234PKcRU\214\304"
+	.ascii	"GH=\b\002zX\221+\027\233j\215\nrh\370Ve\206_P\240L\022\016zR"
+	.ascii	"/Bvjy\207\261\203\324\220<\r"
+	.string	"+\307tI\356\260\n\313\247\265\326*\221\3606\254]\212~\201~\300Sf\312\360\302Z\003\200\351>.\316\\\034\376\267\230\324S\244*A\257\2407\320\263\220T#\274@\002]\250Q]7&\005I2\255\001`\"!\310\252\033\022@Qr\b\302I\310\244\"\221@\"\n\244\250|r\f\3509\320\2245\222HI^s\206\270\200v\244k\343v\346\2049\340\03702OU:\341u\322\252g\223p\301\rh\320\006\034\330B\346,J\354B\005\305\276\360\356Ls\235\335!\260\202\035\241`\201C\224\020\347\340\233;\250_?\277\210\203\311\244VD\337\244\"\241\331\272\332\271p{}V rI\003\023@\356\243\002d\302'\253\215\305w\232\037#\374|\213SnrX\216V\030llfyt\305\372\\\266\205\327\t\023\036\300\004\\\021\264-F(\344\002$C\360W\272F\236\370\316\020\366Z\326k\036\263!\304#"
+	.ascii	"uU@Er{"
+	.text
+	.section	.gnu.lto_.pureconst.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375 b\265\002"
+	.string	"\"\206\024\036`m\322\001\032\205@\215 \310\n\002\316\221\3051\233:4\003N\367g2"
+	.string	"\200\002\251\251\035s2%32!\263\307t\334\306\214q\027W1\0237\304\355p3\\)L\302\035L\301\fL\300\254&5\247\033]\350>\327\271\315\214y-\257\223\356\216\022"
+	.text
+	.section	.gnu.lto_.ipa_modref.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\222\002\215\013"
+	.ascii	"\242\217,+\2009\031\0163D\327\006\242"
+	.string	",a\264x#1\302\300\377`P\321\255\366f-\261\361\t\333\377\033\211)\212\216n#N\250\355-e\n\377\317\250\021\177!\036\236\r\277F33\230N\205K\247\245\234\322J\035\f\337\005\252\234\212tBeO\2311O5/\223\350\345\337\357y\355\321h\255\341\346\255=o\276\236*h\371\366x(\346|*+\016\244\272y\027\233\347\252\2379\346:I]/q\"1`\301\223\240b\256\355!\235QyT\306\017PJ\201\217\224\377\001\t\205\312!\204\002X\320!\225\037tB\312'\354\224t\266\274\355\3578\3079\325\032zM\004U\2501A%Ui\nK[7@\002B\220J\272\003\021`\225s\220\t\215\024\224\246\264\354\006\353\3147\371\201?0\016\037\373Y\004\002{A\254\274/b\204\364l\237`\002cF\027\226\375\204w\361\006\242W\234\324\375\256\261\203\030VX\273\246\264\374\314\312\036\354\243\220I\220"
+	.ascii	"\b\033\305\006\3322U.i[\372`0\345W\201\337\271q[\226\251zT\027"
+	.ascii	"Gt_\024\374C\230)\002:\024\371\337z\306\377\314t\272H\204A]\203"
+	.ascii	"\340\350\013>\373n\002\250\217)\306}L0U\270\330\244\222n\026"
+	.ascii	"\021W\243\021\214\376{\275\300g\\\031\366\272\326\031\200.\333"
+	.ascii	"\272\352\361\300\227^\327\226@\f"
+	.text
+	.section	.gnu.lto_.lto.9c711cad0a037b43,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getSetpointRate.72.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\235\007"
+	.string	"2O55@\217\322\001\230p\030\211\372\r\354\t\257\007u0\310\2044\b~r\207\272\320\276\035C5jh\350i\235\3120\f\004FW\003\244\230\032\236j\356k\262\367\226)\005\037\017D\347\365\342\\Y\274\022\342\202\247\243\020\257\354\0239\232b\f\bYl\300\260,fP\367\273#9\267\0219\211\b\2074u\371oP\177\030\304\241.\031\366\001\224\336\fk\220\303\250D\271jQ\241t\030\255\337\377\327\221\332\314:\237\354|\326\n\212@\352\247X\265\374\004\2526\332jm\246\255\323\247\226\024\363_\230H\376\027t\340b\330\2666\271CkS\017\245Qr\n\307\204\b\313\377\270q\200e\370\254\261\f]\2065\247V\333\303O\305\302d\033\205\234"
+	.string	"\007\377\233\333\250\302u&h;\022\n"
+	.string	"2\241\241/p+\n\036\026\317a\002\n\230\342\022\350"
+	.ascii	"TFi\266\261\353\336"
+	.text
+	.section	.gnu.lto_getSetpointRateDerivative.73.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\245\007"
+	.string	"\362\31645P\215\322\001$\243\232H\250.\025\370\023\342\310\003\2020\215\033G\033\024\245\274\263v\032'\306\260\004\177CH\252\252\312\250k\306\215\241[8_\370\266\277\367\226)\005\240\317\203\347\325\352XX\264\020\242\302\307\223\020-\f\024;\233^\013\007Xd\270.,j\266\373\335\231\234\343\214\\\004\204?\252\302\374/\250;\354\321P\237\f\353\020Jk\206u\310eV\243\\i7Q\272\213\326\357\316\324f\326\031e\347\273\224N\002B\376\211\025\225\233\300\225F\333\254\325\264u\032\325\222f~\213\021\222\377\004\025\300\030\266\2557\314\221\265\252\267e\234\214\222\222"
+	.string	"I\371\0379\006\260\030>o,\206\016\303\2313\253\2352,U\2504\222\310y1\370\337\324H\024\256\363@[\221\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRcDeflection.74.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655@\217\322\001\230\365\311\2266"
+	.string	".`\240\030\354e3\241"
+	.string	"D\257\265\023\270\320\276\035C5jh\350i\235\3120\f\004FW\003\244Xn\225\244~km\357-S\n!\320\303\347\325\362XX\264\020\242\002\350\223\020-,\024=\234^\013\007Xd\270.,n\266\373\335\231\234\353\220\\\004\204A\252\312\374/\250=\374\321P\237\f\353 Jk\206\265\310iJH\271j\267Q\272\213\326\357\316\324f\3269e\347\303l\240\004\254\374\023\253\226\237\300\022\215\266Y\273i\353t\252&\325\374\026(\222\377\004\025\310\030\266\255Q\346\310Z\325\3332NN\031\221\ba\371\037;\006\270\030>s.\206\016\303\2313\253\335\341\247R\261\322J#'\306\340\177S+Q\270\316\003mE\002\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRcDeflectionAbs.75.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655@\217\322\001\2300.\270\300\377i\004\256N>\020&=.\026\316\304\016u\241};\206j\324\320\320\323:\225a\030\b\214\256\006H\2610<\325\334\377m\357-S\n\242\320\003\350\325\372XX\264\020\242B\b\224\020-L\024?\235^\013\007Xd\270.,rR\367\273;9\347)\271\b\b\207T\245\371_P\177\030\244\241F\031\326a\224\326\f\353\221\333\254J\371\322\246H\351.Z\277\273S\233Y\347\315\316\227\331H\t8\371'^\\\216\002W\032m\263\226\323\326\351\255%\335\374\026\033\311\177\202\nh\f\333\326\034\356\310Z\325Ke\240\254b\"!\322\362?z\f\2001|\356`\f\035\2063gV\333\303\217\245bE3\221\234\031\203\377M\315D\341:\017\264\035\t\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getThrottlePIDAttenuation.76.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375 \360\205\006"
+	.string	"\242\214-3`M\222\016@\203\350\314\360u%\365\026&\340\020\201\206*\250(\310N\225fX\273\224\305\366K\327\270\002"
+	.string	"\0204\007\005\302\265\001\002\310\210\267F\032\3312\005O\230\251z\023\302[H0PxS\325\3600\226)\206\203\3529PT\365*X\266q\260]4\r\342\373Q\354\354v~\330\203\275\352\356\236\250\016\033"
+	.string	"\205\006?\217e\260]|\241l\234/\216M\0321\021\b\311\224\370\244d\211\023\321\370\255\257\\\216vX\237AXF\247'$\021 (\231\371.\r\210\352\240Z\242\272\206Q\253h\335z\024\332\260\310\256M\246(\025d\346xm&z\353O\360\017\374\025\001\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_applyBetaflightRates.79.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\335\006}&"
+	.string	"\232D\364\016J\220\232Q:\004\302hxC\373\021\334\210\2673\325AD\351l\347[A\030\3324\367"
+	.string	"HO\226\b\326\005D\333\272\223OO\317\372\367\332\366\274\3718'@\016\342u2\347\335\265\2606*vS{YY\304\232%\204\020B\344N2\333"
+	.string	"\306"
+	.string	"\334"
+	.string	"B\250\017\351\n\346\330\233\360\2518\346\244E\320i\306\206\364\246=\223Oq\214\310E\033Pv\2031\226\2404,\341b\n\343Hg\325bB\336{\035\334\344\n-\325\242\224\335\340o\t\202\035r\221J\027\343\275\027\210\027\334>\311\013V\357m\2622\336\013\004\342\236\364&3\363\215\374H\021s\261\034\n\237\256\0254bb\346\336{\263}v\336,\237s\336\354\037/z\f\246\246\350i\226m\213\370h\005\037))\277-*$\030\217\3614%\3458\f\026\343\213\321\222WS\322\322U\034i\331\200\311J\215k9R*gYx|\271\361<QGK\026\325r\224\303\310\2366n\2561lY\343}\203\004,m\367\336O\335\006\221~\326\242\025\356\275le %\235k\316\314Gf.b>oJ\272"
+	.string	"\355W\206O\321\001\t\357\275\023\230I\\\212\211\364\336\033\001\313\305\211\037\341\223\212\363\246m  \307\037\177\245\202\377\304;\236\275\f\336y\363\2556\021\275\224|6\311<\374\331vb~y\273\007\363\317\253\316\t\254e\237\036\036\033\202K\375\007\356\344\\\373\3607\360$\177\201/9\357\234x\246}x\036`-\353X\3133kY\200\265\234\203Z\016pZ\306\261\226e\3262"
+	.string	"k\371\306Z\266A-\327\234\226c\3262\314ZV\255\345\324ZF\255\345\323Z6\255\345\022\265\334\247ekZ\276\002X\225,\f\266\356\245\221<s\261\230\307!\257\372\235\374K~\342K\346\363\237\334\310\034\343\025/r\020\327\275\327\252\252EM\353 \225\343h\351\036p\341\316\005\247cIE/Y\367\320z@\313\372L@\312\254Q\277\323\326"
+	.ascii	"\232\247-\223\225\351g\223\\P\310`Io\032@7\326-m}c*\001\331Z"
+	.ascii	"\241~f;\361\251\256BAI\323\b\232Kk\240\007t\220\231\233\310h"
+	.ascii	"5\302(\271\002\264_6m\353g\255Q5m\323h\327\212\214uM\337(\215"
+	.ascii	"\317&\263t\022r\267\022\304\025\353O\035HKU\221c\t\353\264\021"
+	.ascii	"\264\325Z\231\324\206u\rk\215\342\342\255\33254+T\255\321N\233"
+	.ascii	"@\227\201>\033\355\262\352lZ\326\201>\320f_\2120\271F\375\212"
+	.ascii	"\347\341Ejx\231B29\006x\257\317\247\354Z\333\2565\352g\223\334"
+	.ascii	"]6\255kE\332\356>\325\3153\3022Fi\354\275\027F\353N\333!\002"
+	.ascii	"\\\"h\250\004\021nw\023\342\355v\274\034\201\036\217(\207\033"
+	.ascii	"\321\323\245P\321\201\227\202\205\316\314\365N\035\021\216\203"
+	.ascii	"\016\005\t!\234:\024\302\202\315\b\021B\270\335\216w!\327\203"
+	.ascii	"\r\231`\201+9\027\224\353\335r#nB&p\273[\2567t\013\312a^\n]\357"
+	.ascii	"F\304\343\365n\261\241\357\345\355\036|\253\253OXL\260\237Fq"
+	.ascii	"\005\346\354\351\235\235\024\2115\364B\372\372\027k'\006ATu\032"
+	.ascii	"\204\217\364\306\253;\262\256\230!\250O\202\356\351\237\366\020"
+	.ascii	"\244\350\223\340\347\030\345\267E\254\002k'\216\202\204\210P"
+	.ascii	"\355\036\314l}f]\273\361C\211\025\240\375\272\360\013iL\333\211"
+	.ascii	"xs\343\255\222\2153:\274l\231\351\264\331%\240g\375\234\026\320"
+	.ascii	"\017\3209\275CfE\372l\222q:@\337\352\030\216A\246\214\322\370"
+	.ascii	"\320\035WV&O\243\270\022R\332\002\177\250a0\004\021B\206\231"
+	.ascii	"\022\031\221\2440\205t\220\002\03112z\021@)e\210\210\266\244"
+	.ascii	"(\351\332m\224\025\372%\205\345[uE\013\031\370ld\t\311\351\247"
+	.ascii	"\271N\245\235\267\203\326K\225\rb\245\340\361c\2421\200+L\022"
+	.ascii	"\240\017\3500Y\\\217\30651>\026a\203-\305\261|A\320\225[\177"
+	.ascii	"'I\026,\334E\2660l\206\323xDZ^\225\273\220\231o]\032\255Q}\027"
+	.ascii	"\270\030\262\361\261\364\276/\272\376\275,\034\017\217\246u\342"
+	.ascii	"YA\022\027\\\016\023\374)\006y\377I\034\313A\330\366\221\027"
+	.ascii	"0\342,\321\213i\336\302\210A\030\205O\213\236\261\323\035\326"
+	.ascii	"B\313\320\026\024\3351\240G\356\024\300+\357\267\315`\241\231"
+	.ascii	"\357\356\n's\231]V\177Q\203\216\013\232 \205m\357\247k\374\324"
+	.ascii	"&\"t\024U\003?,'\372\340Pi7\275\236G\007\031\036\305A\336\255"
+	.ascii	"\371JS|)\315%\223\303M/\007\264\031\264m\021\350\214\020QH\307"
+	.ascii	"\026?*"
+	.text
+	.section	.gnu.lto_applyRaceFlightRates.80.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\357\002\245\024"
+	.string	"f\246\205I\300\222U:\362P|\0358N\376#:{>`\364.\214y\366\305\375\341\364v\301Im(\256\272\276"
+	.string	"\003\3328\273L\235n\201\\)\2456\005\207)d\241\235\263\300\214\033\352\2401R\324\241\315\251m\323u\263\204\020)S\no"
+	.string	"a"
+	.string	"x"
+	.string	"A\247l\003-4\315\330\274xH>IsN\224\217^\331\337\006\2615=\354B$P\237\2055r\f\3159S|\340\372\237\016>\315IB\306\320\2344)&`\372h\333oq\237\234-\024}9:G\332\251\t\366\230s\306\006\334E~\024OB~\\\024\317]s\376\203\027Y\250({73\327\322\312\234\323\332\273\301\271\367\266\r\330\226`oL\275\027\362\343\227\365+\352\001\241\323\322\366\315\350\236\260/\3165a\303\376\373M\016\274K\356\273_\367\375\256\377\374"
+	.string	"T=\242j\021U\267T\315\032\325+U\253T\035B\252S\243\032\245\352\223\252M\252.\251\232T\365\250j\221T\357\250VQ\375"
+	.ascii	")\233\033(As~(\177\314\243q\270s\340o\347\374\251a\355@\034\264"
+	.ascii	"\317h\200Z\0048F=C\335i_\253A\323\236v\205x\"J\350\370\371\036"
+	.ascii	"\224\345\216\322\232\366<\036r\305-\361\354\204\267\322\314\251"
+	.ascii	"+0.\271'<x+\\\353\332q\005\b\361xvZzW\\X\021/Iw\3675AtZRx\214"
+	.ascii	"\332\201r\346\234\f\354\226\303\270`\232s*x\301\301\346 GG"
+	.string	"\206\374\250{\240\024\303\007\335\205\214\257\343\333\213>\264\030\331\004\032\206\232\213\354\004S\001\202\212\305\202\213\314f\273E\230\341P0-\032d\242g*3\\l\306\022si\221\331b3\034LL\205\304\267\f4\\,\346v\303\305R\276y\033\266\253^y\244\333\235Kvda{ \";\262b\260\265\"{b\262\254m-\031\\-kI\"^\022\215\332m\314Nt\242\325.\3001\3621\324\2150\251\266d_\364\332\220U\355S\033\262\260 j\0036 \240\002\231\262\352\006a/\024\026\3710>\nn\330pC\367\005]$\303\321\222\223\r~\007\357\t3\330W$\334\312Jl\034\245a8\232av\256\326\304\003\276\312\224\345rd\356\b\264\230\210\320\235\201\021\024\310/X\265\253\330\025\366v~n\013Y=\3242\302\325\225\023%BBpOt\332H\274\215S}\220\007\021\3339\304\n{\206\025D\260\306\343"
+	.ascii	"\006\024~yL\355\"\003"
+	.text
+	.section	.gnu.lto_calculateSetpointRate.81.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\327\003%\033"
+	.string	"\3461\257H\260\230Qc\363\035XW\275\0176\205\032p\250\021\3214FL\t\315i\341\221\213\200\035D\221,>j\252\3276\033\204\023\252m44\270\350\236AcA\371\220\264:\201\n\266b.\230\354\375\373-\304\032\331{\313-eJ\001\221"
+	.string	"\215"
+	.string	"\245"
+	.ascii	"G\366\313+^\344\b3\266\004\005\271\367\276V\330\257[z\241_\266"
+	.ascii	"\203\036\232=/\002\360\240\224P\335{\027\334\032\201yk\373\324"
+	.ascii	"~\220\013\311}\210\231\334\2727\307\220\311\275\227\201\r\230"
+	.ascii	"\267\005\016\200\274\035\037#o\235\263\273<(tK \222\237\"V\367"
+	.ascii	"\336\263\366x\356\244\035+\315\371\027\276\325\363\365\234\224"
+	.ascii	"q\313\023\262\240\243\313\027\343uT\020$%\006\314\267\033\001"
+	.ascii	"<\351\330\362\243S \237\017\245\345\204{\257i\317\007\343.o["
+	.ascii	"\3076\216]\263\002E*\237{u\007^a\365X< ;Z\304\371\022\017\315"
+	.ascii	"{/\004?\311\225\214\360\207n\255S\202\276W\202\274}\375\221'"
+	.ascii	" ~\271\"\352h\321\016\356h\005\332\037o\335a\217\3244\017\336"
+	.ascii	"\261#\3353O\272a\037\362\313\264\250]&uk\2446G\352r\244&OmK\352"
+	.ascii	"\221\244\256\226\232\216\324\027 \300*\310\0060I\215\n^\027\305"
+	.ascii	"1\327\311\022\177\034\351O\372\203\257\366\355\027\371F~$\351"
+	.ascii	"\007J\213\004\363\026I\005\020\220K\203\033=FQH\252F\262\306"
+	.ascii	"jYMy^vT\351\313\023\216Z\201\216\035\235\376d\214\241\321\304"
+	.ascii	"J\223\017\025c\262\232\365\274*[\311Z\231xTc\265\365?YT2\320"
+	.ascii	"%kx\323\206\007SRt\240HRC\270J\227\246\210\207\362(8\017\037"
+	.ascii	">\220\267\265^\370Q\211\210u\365\213\321\231\n\2532\325\264\306"
+	.ascii	"j\001^\355\261\357\344OP\370C\006qsC\336\322j\211c\210~3L\036"
+	.ascii	"\022\020Z\nQV\205!\372\315\324\032-<+X%z\030@\212\311\225d3\032"
+	.ascii	"\215\274-\213\300\020\375t\303\357Z\324p\272\226P\f&Q\203#\301"
+	.ascii	"#\253\235;\266Z\3156\033\340\302\211\240\220\203\263#\253\325"
+	.ascii	"l6\263\233\f\215G\306\201fb\304\216\254\205\323I!\033=\253\231"
+	.ascii	"\335\316Y\316\271\243#\253\235\263\033\356\254\211\331v\202v"
+	.ascii	";yl"
+	.string	"\266\333\371\n\352>\336\272\303\030\260\234tuG\272\262\344\2048\020\222\372T\216\b\005\033\233^Uu\2350\262\214\242\220\232t\264\370\373\350\0059\331\n\364\r\217Z\266nL\271X\206\324\2544\025\310|\005\262Us\214\246\374+\207\252\340\017\331\302\005\372\336\005\362\266UmQ\326\325\217\246\212\2074O2c\240]x\004:\254N\250!4\307\020D\310\320\220H\230DARl\220\002\231\251:\017\020pf\2344\006_d\360\2409\375rs\001^ZZ\347}\315\002*\340K\262\357\352bjY:\021\212&\"\356\3023\024nMcL\210\351\230_\326\273J\002h{\252\\B\266\336\377\260\245\031\032\f\216\0160\350\020*\227\"\262\272K\370\321p*\033\247\036\377\002\267\270u\334[\372\2271|[\255\333.X\2216[\027\031\335\244\223\373\350~\270%\r\310\250\023\33370\333zx\233\353U\232\373\013\301\210\252"
+	.ascii	"\246\031\350B\212\f\343O\215\223\251"
+	.text
+	.section	.gnu.lto_scaleRcCommandToFpvCamAngle.82.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\022\004\275\030"
+	.string	"\206.\234E\260\032Q:\270\232G\312\030\273\237A\024R\231\305\300\346j\206\214Q\210\363\240\221\343Z\f]\337\367\377\r\253<tsu\236~\370 \335\t\374w\202\302\333\361tnGm\356\f\252Z\350\243\252\205\376F$\2212\245\206"
+	.string	"u"
+	.string	"\220"
+	.ascii	"\376\316I\367$A\030#\212\336\227\270[]\216\337"
+	.string	"~\33453\237k\377?Nd\023\316!k\206\212%j.\202\006\224\276~\217\373\350\371\315a\311'\205\212&\345E\226\030c\201\257\003\224\276\254\347\200\337\357)\360\353\036\033\313q6\"\251\006\211ZQ\227\030cKk\274\347\237f\217\177\242\307\330~|\376\255\270~,&\273\332\351g\366\255\200`\360N\364,\361#\313$1\2101:m?*\356\275\355\006\266\t\330\037\213\276\321\205P\360qx\204\005\013\3407U\300\215\026\276\360\"\f\245\030g\b| \017\242\301\307\361\365\253C\336\366\365;\200\337\253\311\210\021\357\026\313\236\215\223\245\322\260\377\305\030\243\025\310\376\355f\035w\2576\255\263i\325\246s6\215\263\351\324\246o6m\263i\324\246k6}\3324\315\246g6m\002\3232_:f\323\245M\2236\r\202\351\335\364\267i\375\322\371e\313R\325\021\016\351b\3313\360%\016W6b\214\t\374$W\362"
+	.ascii	"B\204\b\340w\245\252#\307\323}4HB8\227\267\315\250-\201\306\244"
+	.ascii	"32j\212Q\031}-\214\256H\214\232f\020\031\272\225\324\317=t(\302"
+	.ascii	"9\347\216lZPIR\233\307\225\267\225\2245S\037;\374\t0&bD/\350"
+	.ascii	"\365\270\314b\214\355\200J\322\323\204d\331\363*\250y\205\226"
+	.ascii	"e\365;\206\302Z\230\353\220\247\0302\262i\271\027\031=!\2524"
+	.ascii	"R\257\023\200P\231\245\027\007\0312\274`\037\b\236\020j\327\001"
+	.ascii	"\027\254\345\252\320\332p\201GC\313\005\363\320:\220\362\213"
+	.ascii	"\003\005X\353\303\353\005k\231p\261\177Q\201\354\300\310."
+	.string	"\2462\177j\245\312\r\030\325OGU\2458\252\243J\204\366B\206R\225\222\216hB'\305\321\007\3610\242\t\345\250\024\2078QN\364T\221MK\f(\2459\nr\221e\217\267\213Q5\2131\266s\243)u\322\266\330h\215\336\250\036\241\005\261\024\2456PP\252\340\306JOZ\263;\251iF\310kr'\016\001L9\312\373\b\370F\250Q,\346\024RH\261\241\244\260$-\264\030\240\002\021\2619;\02101c\214\211\220*I=\032\003\323i\223\324\250\344h\353?\317\264\375D\345\006\202\250q\r\034\236\253\201\275\277CO#\fL9\035L:\321\335\320)\003\\\016\266\323\215\365\217 8e\007\265\325\240\331W\321\252\220Kd9*\240\020\272\323\"\323Z\216R\005f\301\251\257\274\251g\304w\356+\207\320\352\274\n\226\322\262\203;{\"d\264Y\260Qk\272p\355\270\305\202p\"!\305\177\213\r\025~"
+	.ascii	",\byqF\345\344T\310\024\222\376\001"
+	.text
+	.section	.gnu.lto_calculateSetpointRates.83.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\320\001u\021"
+	.string	"\326\241vG\360\356&\035"
+	.string	"0\241&\\\026.\237\336\224\2618\254\317\330\315\302\320\343\037\375\353\035\232C}5\377\"\215\216\265\355\033n\221\351\357\347\321\"m\275#\272\022\207\377)\307'\202:\026Q\206\223\326<\354ZB\310&R\246\024b"
+	.string	"^"
+	.string	"`"
+	.string	"\340\342\330\033\307q<7\2739e\375\363:\311\255\262|\217\304\347\037;H\241\330\372wW\315=\2179\247I\204\321\216\003\261\231h\361\243\231\032\256CF\026\336\347E%\347\271\310\3102D\027n\344f\033:\355\032#\276\224\363@\363=\355 :B\241Hs\365H\346\234\326P\264p\227n[f\333\200}\243\336\033\333\364\236\377\373\317-W\255\252>"
+	.ascii	"\215\032#\004Hs\312\2141f\221\034\352\360\237\333\237\371\264"
+	.ascii	"\037\023}\255\231\257V\013a\233s\206\\\272\300wy\223\355\253"
+	.ascii	"\375\235\363\260\336c\"\227\346\314\200\242\304\234\223\200?"
+	.ascii	"\276K\217wt\227\3349\272K\263\354\025\237\345L\017g\003L\220"
+	.ascii	"\2139g\337\234\260\003~\320E\240\370\034.\255R\321\207\227\276"
+	.ascii	"Jw\371\275\317\005|P\361\242\307\245\243\334\23054\254i7IC.7"
+	.ascii	"\346[\271*\003J\001\323\333\2719\347\344<\340rM{\026:B/6/\035"
+	.ascii	"\335\251\\[\302\004}\350\323\376\n$`\024\301\266\265[;\341\""
+	.ascii	"\356\306\354\331KGrn\266+\251\226\023\267\222jIPb\302r*IY\320"
+	.ascii	"rB\3110J\004\265\002Q\017\300\b\251\023\n\210Z\255\200\"\034"
+	.ascii	"V\245\230\254@\026\225j\005\232f\256\357\215\202\013E\256}}\033"
+	.ascii	"j3h\260\333\322R\214\307\306\333\230O\241\323\325#\r\rpTg\233"
+	.ascii	"@\320\207\272\007\201\001\266\255o\214\270\355t'\335\327\001"
+	.ascii	"P\022Lo\266S\257\235\004\" `\202A\207\345\001b`\375\206E+\221"
+	.ascii	"\364N\356\342u\311\325\342\n\303v\232L\241\274\275\300'\2610"
+	.ascii	"\234Z%E*J4Q\240A}\002}\334\337\247\313\026\002l\242\326\374\225"
+	.ascii	"\327.\343\204L\207\317v'F\331\205\354\036e\026~_\356\b\364\t"
+	.text
+	.section	.gnu.lto_checkForThrottleErrorResetState.84.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`#\002e\022"
+	.string	"\266\243{H\320\362&\035V\001\364xX\310\f0\035\277\260E\224\027>\362-\017m$Y8w \354{w\240\034\323\266m"
+	.string	"F\202i\264\007\035\261\367\202\027\t<\023O]\204S*\216W\024E?\202\001g\230\346\326\b\331D\312\224\002d"
+	.string	"]"
+	.string	"h"
+	.string	"\037P.t\034)\355.\312\243\027\240\036O\274L\373+\316C{\017\007\307]\232\244\030\273:\0056\200z,\271\200\3571o\362=\232f']\207\263\340M\215\031 \247\335\r\365\346\264{\2324\037LI\341r\265{!\256"
+	.string	"r1\336\311\356\376\347\331!w\313\004Sv\327\211\313\201\270\343m;\260-\301\316\f\001\b\276\224^\337\303\363Cf\347\226;[wK\265\261\357\355\356Zk\354\373\334\"\357\371S\2514\230\351/\323\021\225\3662\255\231N0\375\022\222%\034\r\214v=\354\204,R\034\322\271\317\277\214\251\366}\240\007\331*\303\274\205\301\022<T\2176\214\255z\374\177\254\362ugA\273\317\006T-\217\372\351eF\334.\343C.\362s\214\301D&\372\036\243\0360!\302\226\273\325\205,\204\332]\006\376\213\303\240\340\347<\232\325\312\343\036\375\226\216\240\350\241bh$O\366\025>\333\305B\036\347\377\\E\363\264@\224b\264\346"
+	.ascii	"\252\017\272\267\223\343tb&\250ID\235\343.\372Rg<\273\253\210"
+	.ascii	"\376if\210-w\006w<nY\311Zf\254W\370\002{\275`-\002\262\007$\256"
+	.ascii	"\031K\245E\346\212\261\270T4\304F\334Z\265ba\213%|qa\275\302"
+	.ascii	"VL\026\256L\f\273\340\212\2053\030,\026\252t\266k\r\004&$\233"
+	.ascii	"\336<\224\333P&\037)\232l\271\2735U\033\177\252:\200\204\316"
+	.ascii	"\317\215\230\fbPm\317N#B\001\234\0317\232 [Y\371<\0055\002\311"
+	.ascii	"\034}Jt\334R\202% P\2021&\213\007Uc<pe\030\332~\034\202\013\331"
+	.ascii	"Z\001\327\330\225\351\223\360\207.\321xa\343\214\370\300\230"
+	.ascii	"\031\257\024\177\006\0320\205\270\tw\206\365M\372GG\366qdK\026"
+	.ascii	"\226\343\342g\331/\341\343CkL\341AM\215\034\f\377^\270\242\002"
+	.ascii	"x\311\003\226*\267]J\017"
+	.text
+	.section	.gnu.lto_processRcInterpolation.85.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`4\f\305="
+	.string	"Ji"
+	.string	"\027?@\344\316\030#\300\3025\b"
+	.string	"\203\3114\373\212Cx\304\225\215\273b\226\246\250\203\211D\201>\366"
+	.string	"\214\244I\370\001;\300\235\220\377/\242>=\300SZ"
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\020\211\210"
+	.string	"\210\b\221R\246\224R`\001B\001c\001\353\321\371[\347\326@\004F\215\226\233\3675\253\376y\013Y\301\271\356\353\276\353\336k\326W\177o\231\233\271\251p\373\361\222\273J[\251\321}L\210\024;Cn\311\"\247\370\276\257\026\262\331\250\265\231kp\3435\037/\271\363Z\257F\357\321@\276]\220eYn\034@6\033\324Fm\263\336Dm\263}\347\"\337%\307+pR\305\367\335\263j\226\001 \233eF\240\240\006\273\275\367f\326^\361S\326\307\347}\367\236\177\004\211\327^\367\232\233\357v\023\323\222R\022\322\221Q\221\023\321\220P\020\220\263\311\\*\223\310c\313\256\357.\267\024.\201R4\261n\272k\246\273)\276\344v\255T\327Iv|I\034i\256\217\344\332HN\211\0275t\256\235\326\245\272u\n\317\211\206\342Z(\016\316\203\336\032h-\300f\246G\2579{[\215\324\024\231\323|C\334\2712\017\233"
+	.ascii	"\3515glk\002\265\277\303\366\003\342\315\343\226\221\264\265"
+	.ascii	"fJ\265\245\t\351\245\220 \256<n\371u\225\034\223\266\264\265"
+	.ascii	"N\322\235\2519\022\211\024\335\331\324\217m\0066\354qk\265\313"
+	.ascii	"\022(E\373\321\253\r%\032Yk\204\2040.\372\277\346L\312\032\365"
+	.ascii	"\276o\363\265\343@\033s?n\275\357\313.EKk~jf\177\300\314\026"
+	.ascii	"\230\225o\001^\345\365\331\3773e\215P\376\320d\306\254\337|m"
+	.ascii	"\325\006p1\317K\363\026{|\3234\332\377\b\377g\242lcM\330`hp'"
+	.ascii	"a\020!B\264\315\3767\335\376\352\246P\257rs\351!\266B1gt\200"
+	.ascii	"\250\006\267>U\220\373\013'\256\200\323w\351\373\006rw\341D\244"
+	.ascii	"\267S\333\254\331\222\367}\253\032\220\231\023\327@1\357+\326"
+	.ascii	"l\234\310.}o\254-y\211\274UL\301\265B2ol%W\266\360\371\247\362"
+	.ascii	"\210\266\337D\2258d\336\207\231E\264\226\021\310\367%[\300\215"
+	.ascii	"\245\263\220\340N\322,\227\340\362\2266\313\315\365\254\023\277"
+	.ascii	"\272<\250W\231\367\306\374\251\314\355e\314~\324\341wc\306@A"
+	.ascii	"+\002\204\356k\316z\366]3V\3575_)\235\r\264\316VL\347\002L\347"
+	.ascii	"*\2463\201\2453\325\322y\300\322yj\351,\240u\016\240t\006\240"
+	.ascii	"t\226r:G9\235\241\224\316OJg\247\246s\023\323\231i\351\274tt"
+	.ascii	"V::')\235\221\232\316GLg\243\326\271\210\351L\304t\036b:\013"
+	.ascii	"1\235\203\230\316@Kg\347\322\271\271tf\266\316K\245\2632\351"
+	.ascii	"\234L:#\223\316G\244s{tf[\347I\206e\215Un\364\314\356\234\313"
+	.ascii	"\244m\351\321G\221\275\030\367Y4\372\276\002\307Y\b7\b\324n["
+	.ascii	"\364\335V\005\016\231\367\321\323\304\305+\242r\202\246n\352"
+	.ascii	"|*\037\320\302\244\360l\234\244Ug=\216\265\231\260\315zO\024"
+	.ascii	"\263\230w\247i\240\263\236\302\267S-{\242lc^u&\321\337\341@\250"
+	.ascii	"7vb\260\200R;C/\364D\317t&JF\371C\317\204\030U\fz\240\027\372"
+	.ascii	"#ct\311\230\"\235\031n]\320\367 \234 \324\253.[#r \362}\337\006"
+	.ascii	"\334rz\216\373\304\215\342\326\325\265\315\002}s\320L\235`\237"
+	.ascii	"\345S\255\332\371Mg\240\233\357\374.\233f=\363\233\337\321\306"
+	.ascii	"1\257\362\362\231\337e\215\3207\r\307u\247\270x.^\333\354\362"
+	.ascii	"\333\257\247\006\303\340Q*\237\333\260\017]=\030\022$H\355$_"
+	.ascii	"\371k\236\262F\344\037?\371\035\265[\323l&T\270p\241m\026\371"
+	.ascii	"\311\351\325\037\277\315hqS\326h\305\304N5I\243\275z\007\324"
+	.ascii	"\271f0l\f\031\221O\345\316\343cG\253\365\315\003\n\013\341\033"
+	.ascii	"\221\307\2165\302_=\016\260\266\375\260>\323h\3002l\330\3206"
+	.ascii	"\333\376\017\022.\3729*93\207\016\336R\255\177\022\364R8\366"
+	.ascii	"b"
+	.string	"\334\177\315\024\234R\330>5L\263\017\341;J7\026+\274\276\276\270Rt\035\275^pyH\341\302+\f\205\227\007\031a\315\025^__\\)&\234\360z\301u\242\005\f'wau\205=\273P<\277Tp\261xv\205\271xb\0211X\013\257\260\347\0130\260\260\347r\017\332\357\366|'\217/\205\320\037kz#\376\346\3521xs\204\t\335\f<\320 \235f=P\3006&\276F\346A\223Sr\266\346\025\311\327\372\3718\254\036\205\267Y=k\205\316\3424\317R\343)\323XD\311u4\221\244[\242\024<|\222\236\312\n\310\034a\370$\020'~(\353\373\276/\322S\333m\261\036\303\267d\376\334\034\005\341@\2507\007\322y\177\325\002?\345\300\001o\376\243\352\t|\201o\021\243lc>8\020\351=\252\276\373\340\004\241N<\315\321\b|\322\212\233\376;l\242fD5\340\251\246^\300\017\300\372\251"
+	.string	"/\300\315\002<;x\2708}\265\277C\272\242\346\303&j]\234\336\215]\275\026\300\207UA\223\003\300'\333\030\022I\2754\352\245\276Z\355\256\026\352\243\276\243lO\017e\350eO\237\034L\2638m\250\0171\177\206\234\256\334\206\2235\275\023\3237}G\321,=\323'1F\025\225~\351\233\252Mz\245\357\250\235\213%}\033\302\231\n\365\236.z\002\324=AH_u\365\264\336\030\273\321=\002\347\306\305\035=\322\007\200\370\250\201$\007\221C\210hD$I\222Bk\200\002\221\251\"\253\003\021\020-d\220\021M\222v\003bh+\306\277t6\254o\204\334]4\177\314\006k(\265\034\252\234\026\r\304\302u\272s \0265\353,#"
+	.string	"2\231\004A^\301\375\371\260\303\226\007\265\215\026\251\215s\003Ix\274=s`\212O&\362\310\217\237\002\305\213\355\243\016U\301\r{y\276\362B\302\004\374\344\333\270\356G\220F\026\334\007G\177\362"
+	.string	"\346v+\250\304YZ\326\f\351\005\245XB\335@\361A\251\003\213\324\307\026\242F2\017\0179\362\030\346\377\017\212=\362_\266x\2603\356R\2352\214\304\332\364\276yl|\354\215\013v\362\332@\303\035p\340a.\216\342\204Q\020\255N2V-f\350\213'\232xL\322\202\305\247\357\2356=\230\367!\345\032"
+	.ascii	"\033\353LF\355y`\306\333M,\355\035\221HWS5Q\006w\215N\t\007I"
+	.ascii	"\302\264 \332g\253\352\343i\250\001\005j\216!:\0034\024)Z\275"
+	.ascii	")\206\t\234\024\350bm\031\274\007\276\332\233Ov\373\336\2476"
+	.ascii	"t\031j\3457\207\270\007\371\025\200\224\354\351%\3616\307\020"
+	.ascii	"TP\236\2159\201\227\370/\272V\214\205\267s\255\233\252\220\261"
+	.ascii	"N\360wZ$]\204n\222\233\3044\331r|Dy%\tM\004|\246\f\2117\001\004"
+	.ascii	"\254\362&\007}\335ag\241\232&\004I\224\225+\316c\0342\224\fs"
+	.ascii	"jV\324\311\020\241\355M'\005\322\356\321\220\001*\340A\201\320"
+	.ascii	"\203g\360^\343P\004\241Rr\275\257'|\033\200U\246u\"\030\241 "
+	.ascii	"36\345\217\250\331`z\3578\266\201od>9\206\343p*\004\302z\324"
+	.ascii	"\241\241h\323\350\220\3101U\263\364\325\020X\2074\351\020\226"
+	.ascii	"\337\355Yt\211\254\222\373 8\336\344\214N\317\227\\\336\300M"
+	.ascii	"W2*X\r"
+	.text
+	.section	.gnu.lto_calcRcSmoothingCutoff.86.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"M\013"
+	.string	"V\326O?\020Q\225\016\033S\200,\002t\245\364^L\242\215\233\327@\320\201\357\331\317h=$CS\0137K?:\"<\346\251\177\004\021\364.\242\250L<\3241,\241\255\260\232\353\365\214,![\312\224\002>"
+	.string	"?"
+	.string	"8"
+	.string	"\177\001bj\001\262\273\333\201\017\320\236\301W\264g\332\272w\250\351\371"
+	.string	">\321\241$u\205\005T5R\001\276\022L\360a\002\307aO\324G\312\214dv\327y\372@\334\331mC\260\375\300\276\202\351G\b\214\370\220\020c\367C\210\216\365\310f\244\260\355\331\024\333O\233\201\003\357\261\303\243\001\021\321Ec7^\334\340\371\227c\236\354\226p!cw/F yf\333_q\227g\307`<\361\005\252\266\006\016\371\023\324\303\236\361\240\"k\232\3524\355\030eH\2428\251<TY\266\\5D\353\006\013\033\245\314aGR*\313>\334\335\265\256\354\307_{\032\376\365\353\323\371\013B\037\005U\330t8\0246\035M\027a\303\204\013\0314\002\314a\270n\343,l\0308\232\316\306u\240\rS\261\347\263\351\266\220\307\323m\2248\272\256|\330'$T\300H\313\255P\257(uf\244$\230ej\016"
+	.string	"m\b8\323a!\013u\205\275\252\252\275\242\204\343\241\317&\244t\r\324e\302\005\025\260"
+	.ascii	"*OS\355\321\300\324\036"
+	.text
+	.section	.gnu.lto_rcSmoothingRxRateValid.87.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\235\b"
+	.string	"\206\021?9@\305(\035\355\311\nd\333\001F\322&\257\001i\230\365\214\\U"
+	.string	"\231Y\227Xc\266\336\006w\326\314\247\031D\020\301=.\017S\300\311"
+	.string	"^\217\363\253\263:m\t!R\246\024."
+	.string	"/"
+	.string	"*"
+	.string	"\266\255\260@r\351\236\307\352\002"
+	.string	"#E\002\333\365\240v\274\364,\371\037\271\006r\302\242b\231\236\227\206\335u\252X\026\267\3366\202m\006\333\257\006\255\025\207\224\335\325\027`U\264\327\207\355\333&\331\030\333\231\366C.B\272\313&\026\330\325@)\331\335\004\037\004\\\323\274`\273\226=\263]\013\251\231>\325\032\370>\330\305G\3335\365\025\031\250\374\254z}*v\312\317\366L\251\034\366\263\335]\353\206\263\273~\325tj\372[\235\250\303y\bu\321\323q(8\242O\027\343\004G`n\303E\310y\340\007\242\023\001\271\030\202\233\214A\022]\204\"\020(B\214\267w\246\232\223\242\234\261\226\217\266\007"
+	.ascii	"2\003\302\260T\270\033\233\226t\031\265\243\nc\272&\031"
+	.text
+	.section	.gnu.lto_rcSmoothingSetFilterCutoffs.88.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\242\r\365>"
+	.ascii	"Jk`\027>@\350\316\030\330\254\0058\252\306\316\252C\254\220["
+	.ascii	"\360\233\367\245\036\335\264\365T(\333K\027\254\016\244\325\334"
+	.ascii	"\357\004\364\2425#5\355\357\r\267\210\370&k\206\302}\2062\335"
+	.ascii	"[J)\245L)\245k\001B\001h\001bm\336\320\320^\242>\323x\314C\256"
+	.ascii	"\321f\030\311\216\021\227\367}\2075\230\207\255~\217\351;\036"
+	.ascii	"\222i;e\227\261\321\2265\237\230nn\202\336\367]\320\266z\225"
+	.ascii	"\326u\030e\213\271\321\276k\332%\032+\202\336\267\356\330*\027"
+	.ascii	"h[]\362v\346\246\353/\312~\342h\342\373FI\264\346}\353\3008@"
+	.ascii	"\333*\327uqm\265\355\246\265UV2\007v]\333\333\177\250,\355\022"
+	.ascii	"\275\357\213\374)\234vZ\327\314\344\312\246\2322JEA=\025\235"
+	.ascii	"\232\230\210KJIHGC\241\333\262\253\232\276+\271\331\007.s\255"
+	.ascii	"\254\251\246\322\2539|\313\356k\322\245VQ\230D\033\256\351\305"
+	.ascii	"\215t-\225z\tbs\250\341\232]\322\"\020,\314\276\233\363(.\r\365"
+	.ascii	"\326O\251\261\257\371\226n\341a\361\342\025w\342b\305\233\322"
+	.ascii	"#\277\270#\335\327tK\017\030\311\3633\342LR\202Ti\342\222R\033"
+	.ascii	"\023Ob\037 \261\017\236\004\241\322GJ\372\232I|\210$\275\302"
+	.ascii	"\352k.qa_\223\n\\\363\210\273z\215\005\327t\373\261\266\364\266"
+	.ascii	"\315\2524\233\026\373\232l\251\327\022:B\226\276\n\327\210\264"
+	.ascii	":\244\323\324\270\204\216\220\2445\264t\013\017\024@\235\247"
+	.ascii	"\303?i--\275z\337\267\357\332\325\326\316\334\331\007\357\373"
+	.ascii	"\2623\327\2024W5\263\027\231\331\001\363Q\204\377&\306\364\321"
+	.ascii	"\341\212\230\331C\313\371\320\276\257\216\004\334p:\016\b\026"
+	.ascii	"1\302\2339bm\365_\225\333c\022\375\346F\373\276o\002n\250rG\t"
+	.ascii	"\256?+8\326V\033\374\357y3\367\324\3534$\201\232\274\314c\203"
+	.ascii	"\203rt\274\257Y\226\377\202\3674ipg>\310\375\376\235&\250\331"
+	.ascii	"t\233\023\334V8\305\no\346\212\265\325\376!\0324\312f\346\203"
+	.ascii	"\314ug\376\316Eo|\260\360Gav\235/\270\316\026*Pp\235\307\\g\261"
+	.ascii	"\026\323\334\240\237\335\f\272L\363\2020\327\331\200\320\271"
+	.ascii	"\200\353\214\024:\023p\235\301X\347/\327\371\310:{\265\316]B"
+	.ascii	"\347\001\2563\227\353,\240u\336b\235\265X\347\254\241s\200\325"
+	.ascii	"\031K\350|\245:[\r\235\001\254\316UBg*\325y\252u6\016\235\245"
+	.ascii	"V\347\250\325\031J\350\3744t.\256\316N\253s\223\320\231\251u"
+	.ascii	"&\262\316K\256\263\222\353\234\344:#\261\316G\255\246y\330:\013"
+	.ascii	"\205\316\256\320\271u\235Y\327ym\235U\3269e\235\177uv\325\271"
+	.ascii	"3\030\233xB\354\275/\220AF/\237\332\346\255\325t\213\351.\323"
+	.ascii	"\317\334\314m\206[O\rC\333\262f\213\207\206.h\306\037\312\001"
+	.ascii	"\3165\321\222\024\365Ro^F\326v\376*\2674\235A7R\037\005\025\365"
+	.ascii	"\364P\214\236~\f\315\017\211\313\235\276\030\247\224\363f\362"
+	.ascii	"\215&\334Q21\346\221N\244\334\322n\024(\347\032\221\322K\253"
+	.ascii	"y\305g\241L\"X\276\340\233\236Y\t\006\2027\323\351\257\320\276"
+	.ascii	"\214\231\276\351\0370MP\241\033L/\206\266\347\350\235\177M\374"
+	.ascii	"\036D\374\241\234\236\350\263m{\233\357\373v=\355\255\361\225"
+	.ascii	"y\243\274\341;\271\253\326\245o)\201\200K\357\312\335\231{v\236"
+	.ascii	"_\034\233P\351\373\311W'\275\322\367\222-\354\221>\351;M\360"
+	.ascii	"\350\221\374\364\237\b\023*x3+\254\255\036}\353\365\326\020;"
+	.ascii	"Q\2667\222\347\247\305M\256\302\377A\027\232ORHT\323\247\273"
+	.ascii	"\242H\350\332\366\330\234\256\307\036\276\0327\327\2255\373\305"
+	.ascii	"\031Y\3036x\367M\214\361\263\247u\377\355\n\240%_\236k\232^\300"
+	.ascii	"\240\326c\251\367\307\266\360j\314\355\347\271\321B5s\220\205"
+	.ascii	"o\277\357\372\b\335\033\303\347NP5\372\372\354"
+	.string	"s\347e\320\340\315\274\360\352\227i\301\341\271I\217\315~\3475Q\3143\f\241<v64\037C\221\177\rm{\337\227}\367\251\376\372\275\0244\233\323\351\253\2576Z\2669\343\320v\352\244/&\267\027}\212\355\021\332\373w\362\2075d\335\001\205\253P\221\234A#\002\212\026I\267\304\214\022\022V\274 c1#\231t!\003\211O\0208\021\003yB\005\362\005Y\t\027\310\0231d \t4q\022F\212\030\310\031\311d\f\344\260\316\254?J\2105>\263?\243J\340\006\206(\213\350\3702.\360\006>\354\016\242\245`\034\337s\352\235\\\341\013|\216\270\002\317B\005\243\3176n\302\310\031\017\370\361\301\036\211D\251\344*\355\313\230\300#\263\020x\004}\276\036\214\211c\271\362\365]\207\312\323\353\217\337i\334\252x\375\230!\301\001s\234Q\251\2567\321\226\354z\213z\032\373\306+\036[\354\325\230\007\274\024\261\037"
+	.string	"\346dt\006%\340\271\236\033o\214\311\210\263\312\023\3277\236Cah\202\266\275?\256\255\027\320\037V\255\337\372\206s\347n\331\346\f\300\237(\240\242\326\177\340\030?N\274\t\023\255\357\274>O\247wf)\241\270\022O\222\365\252\035\"\245\323\217X\265U\3102\204h\256\351\235\334z}\364C\244\360\234\262\303\017{5\206\256a\337\201\335\2352}u\330S\370\246\233\303'm\311\231\017:\321\352\261>\300\024\"d]f\210rK\327\021\002\r\360Q\200W\217\025\344\352;\260i\365j`\034\266\245w\372\324W="
+	.ascii	"7\345\2254\037dm\367\327\343\317\325\334\374\001\370\250:T_\345"
+	.ascii	"<\250\276\001\373<}9\365,\0240\312\246d\364\201\004\250Q0$\225"
+	.ascii	"tJD$\210\244I2\254\001\221\005\304\030\005\0354\017\021\020\245"
+	.ascii	"cL\331\220&)\264\236\001\223\320\215\235\224\245\260\277\330"
+	.ascii	"n\f\233\306\003\245\326\314\016\036\217\236\264[\277\230\302"
+	.ascii	"&\343\231#\254\f\316\203\200\\N\363o$\007\357\t\177\344V\373"
+	.ascii	"HP"
+	.string	"B\324f\313\264\251\034.\363\317Rs\214\006\n\257\036'9v\246| \201\245\361m\327N\316\241u:\343v\225/D2\264\206\026\"=\357\325\210M\351!N\255\024\336\021\336P\376\302\243T@\3362.<)\251\350\013)\350\0024\357\244\\:\211\025\007Fb\233=\306yv2\022\271T\325\003\351\306u\274\365\023\211\254/g\266b\322\317r8\220X\2249\315\376bA\301T\214\233\220qU\016?}\351\204\3014K\212\331\350=\003\257f&,\345J\231K\016m\375\215y\335\3175g\241Bk\363\324\"\t\266\302\341\022\311\207\316K`\177\222oJ\030\251\351\243\322\347\336\030~\320\253\026\336\222\212\310\263\231\210\255\366_\301p\256H\004\365\325\304\030.~\310\327\016q\261e.\307\332\323\301A\022\353\251Z\232:\216\303\177D62\251,\200\307@\002]\035\311\254C\f\212\352\026|!\315\020\005\206\363-\271"
+	.ascii	"\360)\366V\354o\376\242\217\205\016\3144F\207\360W\215\356\200"
+	.ascii	"O\032\n\250j\004oX8\221.\225\016(?\215\333\276+\233S\300\326"
+	.ascii	"\021\323.Q\001\037\344_\304\341W\030\036\342\035\320V\002\343"
+	.ascii	"\003\245\006\021\250J\323\310a\020\202~\226\036\215.4\255\260"
+	.ascii	"NF\350\236\254\233\262\360\346\215Z\256A\204\t&\365$\032Z\201"
+	.ascii	"B\373\013\254\\p\027\205\2105V#\300w_\3612`Pm\371\024\245\020"
+	.ascii	"TBC\247!\223\331\301\2111\252U\013{\333WM\241Vl\320"
+	.ascii	"\244+\230\236nG\263?L\234L\211\t3\n\341e\203\227\024\310\306"
+	.ascii	"\315j"
+	.text
+	.section	.gnu.lto_rcSmoothingResetAccumulation.89.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"\225\n"
+	.string	"\346RF> \345*\035 \027\t\226\271\242'\034\027\223\267P\201\231 &vE Gc\244Q\350?\"\242\206Y\202\305VZ\311\236\204%:\325\200pH(\033\017\rhN"
+	.string	"!\250nk$\210\354\224\0020"
+	.string	"2"
+	.string	"8"
+	.string	".\037\372\356u\016\372\356y\264i^\316\3663\257\213\024swk\307\361\361t\364_r\317\013\326:\345 \354\256\351\013\226qw\267-\262]\355K\004\247]\266h\267a\177\263\273\353Nf\237\366S\316a\326\254)\311\354b\234\001\026\347\275x|l\237\332'O2\236\306\272\300\256\f\200\313ni`\202\316\275\251\317\016\277\222R\321\260\215\344\nn\253nsL\315#R3s7\333TdC\034\305\267\201\231\035\361\223\211\316\356\036\230PT\204f\035\367|\326wO!\344#F\232.\032\244\025)\301\001e*\255\302\360\244\n08\002\305\n6T\224\211t\252\240\250\252#\220\303\007\006\261\256\302P\254\237r\277\331N\346\005\020\234\253\263\260OoI\261\2201\262;\317\007\026"
+	.string	"2\241\267/0.\216V\227`\2736(\254\f\033Y\211\004\333\265Z\244\016\354"
+	.ascii	"|\267\252&\204\253.6c\354!=+\016\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_rcSmoothingAccumulateSample.90.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\365\005\205!"
+	.string	"6~\323I\240\326Q:\305\370\004\247\270\342\035)\233B\247\255c\321O\232\360\263\300\235\353(\360\204\223\025&\202\2241\233\277\3752\025-\251a\355\370[8\036l\001\177\362\026\204\264!\335>\322\2612<\032]\326p\037\3265K\b\221;\245\271"
+	.string	"\261"
+	.string	"\310"
+	.string	"=|!\236\371@\036\204\351VJ\257\302\372\232\345\305\024W\255E\241\233^ \273I\243\367\361c\207\367\360Je\335\250\265\316:\330\263\233k3\3313\333[\374\016\246\363p\262\244U \212\026Ej\255\005l@v\363VRj\277\352:\230N\\\342\241U\240\021D\221Z\213\005\374#\273\351\342m\347M\331s\316\233\266}"
+	.ascii	"\001\223}/N\211\210m\231x\362\361Uk\021\267+\356\373i\226K}~"
+	.ascii	"\323\317\345\222%\245\212U\224\324\315r\3000\213DMT\260\264A"
+	.ascii	"A\201\345\003-I|k\242\234\312[\255\365\306S\250( \2451\242Z\253"
+	.ascii	"\2510j\304\035\273m\r\266\211\354SAI\254rO\344\022\342n\022$"
+	.ascii	"\027v\321\375\356>8t\242a\016\260t\313\253 \227\215n\304\310"
+	.ascii	"\236){\367\"\031d\265\326\004H\b<\333\224\213\245\363\346\267"
+	.ascii	"j\306\327P\007\361G\303\354\242\023]\025\366\313\272)\202\226"
+	.ascii	"\032\350C\356\237\245\276-\265\317\255\356\236\363\370\003\234"
+	.ascii	"\370\0030\365\316R\353,\265MF];\251sNj\234\245\2769\251i'\265"
+	.ascii	"\315R\327\234\3244'\365\314R\317L-\023\243\216YjY\214:\266\324"
+	.ascii	"\347R\233K]\236\324{R\323\223\372BWR\374\322\262\313R\253\210"
+	.ascii	"00\365\211y$\306\207\374V\277\272\375h\025\030\202\205\214\007"
+	.ascii	"K\253Y\233\025p\025\344\362\331\232\023Ia\327\267~[\237\231\335"
+	.ascii	"\245\331\007e\314vfy\232\004\271\202v\326\340K\253\213\260+,"
+	.ascii	"\fh\203\326\364\251\304a\b\207O\314Ua\272\007f\250\222Dh\355"
+	.ascii	"N\236:\013\245\263\346\362\320\260at\002\244_\312rUPZkm\332M"
+	.ascii	"a\337)\26338\214Z@\372\305v\205_\361\311\216\274\025\236ma\211"
+	.ascii	"^xSfgXXT1Ke\n\320\306\310\026h\037\364\372YY\356R\242\374\354"
+	.ascii	"\257\274\020c\373D\311\311mc{\343kWO`\277so\373 \227\236=\027"
+	.ascii	"\027\346\tL\367&J\017\223u\257\236\275\220\2276\260\222P\021"
+	.ascii	"\315e\342\344\022\002/\327\3342\031\034:\025]\211\0039\013\024"
+	.ascii	"IB\021o"
+	.string	"\027\241\210\227\3535\360\320\243\311%\345\030\030m\330aH::\342!\321X7\244\353\341t\027p\033v9\036N\327C\302\r\345\370\210CQ\017\227tt\324\303\315\212\277\227uS\370\334\312\361\003Y^\3537\336\301\026\325\017\244\371\373\316\235\205\262\275\263&\372\255\323i\353\016\026\346\301\214\252a\225\227\322\371\243s\377\242\344E\352\307\r/\241\377\350\242wq\222KL\215\343\227\327\017i\233\002\375h\243o\371\321\273we\260M\371x\032d\206\214a\325\227mm\t\347rR\266S[\333\232M\236\300j4g\355\t\024\316\013k{\003n\223q\226\2669\373 \223\233\305Ysk\350\345\336l\354\210VXph\2634\001g\250A,\007\221a\204!\031\032\005I\222d8\240\"\221\263\321\003\021\300)\023\020\021\215\244(\205\354\006\303\240\330\216\212a\320\bT\004\347\345\371\225\333ys\252\2758\271\221\353\026x\200"
+	.string	"oG\0065(3\271\354\037z\275%\006\364\336\351\334\300\016Cm\030\216\277v\224[#\013\214&\310\305\355\205\213\33117\375@`L\307[\233\307\231If#\347\334;\301\016O\3207\211\262\035ER!\243\222c\220nN\023\3419\312\032\270\034E\265\017\200\035\351\f9\273\272\316Q\264\013\340\264\033m\351\037\360 ]*\2120\376\3442\244fb\300\n\277:\374\027\210R\254.\220e\377\271\177\213\312\bV\2664o\236\274i\021\315[V\213\202\252{\200=:)5"
+	.ascii	"k\332-\032\316\025~q\013e\274}\357\017"
+	.text
+	.section	.gnu.lto_rcSmoothingAutoCalculate.91.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`y\001}\r"
+	.string	"\026YXA o\224\016\300E\226\025P\206\022\002"
+	.string	"\236\030\233\343\263\251\032\346\340\260s-\016\3043\232\234W\222\242\377\033j\201\340\310\254\266 \207\304B\b"
+	.string	"\001\220Lj\274[\245a\002\262\370\240\b\331{K\231RF"
+	.string	"E"
+	.string	"E"
+	.string	"\317\033\003B\234}\313"
+	.ascii	"\302\2200B#I\331\335\242bxv\013>\247\231\371\006Z\254<!\315-"
+	.ascii	"\021-\341U\341O$B:\nW\214P\307e\354\356O\317O\210\223i\035\330"
+	.ascii	"]\247'4\341\276n;\263-\300~*>\b\374\273ZJ\034FN\0356\271\262"
+	.ascii	"7N\352\310\276[\025\331\357\246\333eZ3\235\231\276U\340\302\210"
+	.ascii	"\005RJUl\013Z\275\330\024\317\304\206\233~;\304?\271rS\226\241"
+	.ascii	"\331\026\264qR\302d\371s\200\353\001\376\365\251\310\026\211"
+	.ascii	"\204\246\322?\203\220T\242\251\322\317\240\323\017\210\247r\240"
+	.ascii	"X`N\022\"\325RZ\341t\224\273\253Q\025\371\031x\345@\231t\322"
+	.ascii	"\205m\007\377\220\271v;\004|\017\337\036\370\032\376\f\001$\357"
+	.ascii	"\371\013\037\035\230\372\242q\301\342EAd\260 \201G\274`\231\250"
+	.ascii	"\001\300\230\006\035X\374\300`\260X\3316w\253\"\377t\004$\024"
+	.ascii	"\232\n^\304\355\236\323\247\037\333O\177\002%\005e\243\034KG"
+	.ascii	"V\305P&\036/I\251\306\322\t\324Q  \300\002\241\200\3221+\022"
+	.ascii	"\232)\022\336\314&g}\214\333e#\365\030\016ykv\263\261\355\361"
+	.ascii	"\264]lY{\343\210\276\3636k\320\"\207\231\221A+F\263\220\234\350"
+	.ascii	"\200\021EG\320[\344\004q\024c\222/\233Q^c\273V\031"
+	.text
+	.section	.gnu.lto_processRcSmoothingFilter.92.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`U\0325p"
+	.string	"\332\263\304'L P\352\031\003k\361\"N\321\005!\244\364VD\213\221\315\326^f\2411\261y\214-\353\0167v;j\264\333\031\023\367`,\262iy\266\373^QaK"
+	.string	"C\335\r\245\002\002"
+	.ascii	"H\305\004\230.\216.\016\302\251\231\260\330+{\247\224Re\002C"
+	.ascii	"\002p\002Lg\346\322y\271t\246Y:+\225\3163\356,C\343\214T:\267"
+	.ascii	"J\347#\215\263Q\351\374=mvw\356~;\212\021\350\331\232\r\257\305"
+	.ascii	"\355\325\221\025\363\366\035\355\220\364\223\356+\335s\335\327"
+	.ascii	"\356\270\236q\031O:\322{\3323\314\315\334x\334z\254\274\302\330"
+	.ascii	"~\313\336\036a\205+a\002\311<<\206\321\326\244\357\230\225S\250"
+	.ascii	"4V\253\247\260\003\3254\350T\213Yi7\205\217S\336\372\350\272"
+	.ascii	"\216\225\327\016\256:\234\270H\366q\216\261I\256\261d\034\222"
+	.ascii	")\227\022\311\256rK\221\241g\b\241\343\030K\364\345\366\222)"
+	.ascii	"\020\006\357%\221\354#Q\357\264}4vN\013\245\341\230\225\354A"
+	.ascii	"W\271\204\030\350\231\007\3341\364\023n++\231\271\335@\350*\247"
+	.ascii	"\230N\241S\020\270\335X\331G\020\272m\213\210\313\355\3251UX"
+	.ascii	"7M\224J\366\021\311\034\0027\225\225=u\223o\013\310(k\205\\\336"
+	.ascii	"\327\255\251\217l\224\354#\363\024\211\020\330m75\035\355\034"
+	.ascii	"a\030\224\304\367u\213z\"!\330\330F\267f\233w[*D\024\324\223"
+	.ascii	"S\023\023\210%\245$\244\017GFED\036\206\204\202\200~|:\364\360"
+	.ascii	"\354\350\344\340\334\330\3240\227S4\312\031\231$\262=\032\337"
+	.ascii	"]n\244\227\twN2\256\226\032\244\346y\b\301\216\202\222\312s\341"
+	.ascii	"\tIe\200\020\022\372\246\212he|\355\244g$\362\033\333\363&,W"
+	.ascii	"\234\211\317\212\203p\301^\302k%\274$cWO\302\243s\244\271\376"
+	.ascii	"`d\202\352\241\320;5\b)\224\363##$\225]\373\240\333T\212V\306"
+	.ascii	"B\027\021\305U\221\301=\304\365P[\325\205\356\332\250\036TE\312"
+	.ascii	"\324\201\220TheN\372\007\206\366\221\302\340\035\2344\361\036"
+	.ascii	"$\3163\303\021\337\251[s\035)\235\303\202\021\307Y\301o\2144"
+	.ascii	"\201l=\332o\254\210Q\204\231\\`K\361\3416H\252!ej]\363\243\231"
+	.ascii	"?\244@}\331]j=U7G%t\232\263V\032\231\270L\301aG\307\021gS\273"
+	.ascii	"\310oL\005\237\351\3412Ehe=:\3517\366,J2f"
+	.string	"\346H\036\335\206Y\333\305\310\300\374\230B\033\231d9\224d_\376I\306\316\214D\357\3736\265\335\0042/w$\325\373\276\354N\262\262f\021\315\374V\230\331\212\271'(.\021\267\210\267\223\233\332I0^ZP\344\362\365\\6\207x#(?\312mm\002\326\364\302\2562\375\327lLZ\375\325\2131\363\325\007Mm\260\022^=7\026?\341\202+j+\021\211b\325\0227\363\321\006>\313:\330O\310\306\032\370\250\027\n\241T\231\217&\261\231\321%?\215\221kta\327\266\377\272]\213\013\273\036\273\257\255^\354\205\030\272\374!?\332~\032\263\b\375\337\326\276\261\262\005\361\3627\370\345a\216H\026\334\204\252\241\022\3321\355#\327\\\314\331\276\024\0238i\325G.P\211\361\243\334\356\222\366\370YH<\f\354\370GD(\212U\3433\273.\370W\225{\035\3018\017\337\370\035\266\310.\233s\271K\222\357\373\005"
+	.string	"w\326_\227\211+u\235\270N\332>\376\207\231\246A\251Uj\213\311!\f\f%S\350\364\263\331\256j\033\216\335\266F\254\302\001\314\216(M\2764\034\273h/\214=\354\"\363\002\\\342\227+3\373Q\303\261"
+	.string	"m\310\327!8~\321[`\354\364\261\260\341\332gP\322\002t\232\330\324\3141\232\220\261\203\r0I\354k\346\002Z\313V\220\332\373\276"
+	.string	"p\003v\340\001\334F\254\254\332>2\300\344\013t\372\245{\253\365;VYl\362E\204\231\234\340\363V\333\017\201\225\360\313\30307\226\346\333\3426\302\032\\y;\257\332>\366\3730)\204R\237]\236ev\363\362\217\006\262\231\325\361\2471\367\264Y\213\235ot\\\263\005K\347\007\372J\263\003J\347\006\372\332L\243\2374_\365\223f+\035g\031:\316\b\3448\267\350\271\346\252\236k\246\352\270f\026=m^\301tV\301tN\201\343\214\202\351|\202\351\034"
+	.ascii	"\216\263\t\246s\t\2453\tw\036\261t\026\261t\236Z:K-\235C(\235"
+	.ascii	"\243l\234\241\226\316O6\316N7\316MLg\246\2453\b\245\363\222\322"
+	.ascii	"Y\311\235\223l\234\221l\234?,\235\217l\234\215\226\316E6\316"
+	.ascii	"D4\316\036\224\316C\356,\304t\016b:\0031\235\177\226\316>\356"
+	.ascii	"\334\241\306\271\247\306\231\307\235wj\234u\226\31694\3168\356"
+	.ascii	"|S\343l\343\3165\001\035\270\214\341--\313\326\210\277\035\317"
+	.ascii	"\267;\257\241\357\003_\266O&\213\"\321G\205\336\321\254\204-"
+	.ascii	"<\347\373\316\367\364\232c\232Yo\247\320L4[\247\310%\307sQ\021"
+	.ascii	"\364\360\3211T\317\303\363\273Nt\333\034[E\305ip\341S\030[\347"
+	.ascii	"\327\276\241;\217\005\360\271<~\341r.%\217\231x7t\005\3622\263"
+	.ascii	"\310f\305|\275o\327Q\320\017\320\206\004\350\177>\350U`\301\254"
+	.ascii	"x\001\275\n\300\007\376\347\373\256\235\212\005\343\342\300?"
+	.ascii	"\360)\240\200%\372|\316;\360LX\260\026\274b\270\f\214\215\342"
+	.ascii	"\363\255\327F>-`\244U\241.G\204>\332\341\373\020\312[\207\357"
+	.ascii	"*\355zmiPj\320\022\305\305\036\247\356(\"\335OSS\275\030\215"
+	.ascii	"\357\321{\322\3632\210[\024\201>\312\356\203\024\354\031-\ng"
+	.ascii	"\207\232\272\236\321\266\340\371*\240\363\220\306\267x\236G\002"
+	.ascii	"\032\177>\352<C\372|>m\347\231~V\302\351V\322\311\316\213\320"
+	.ascii	"\022\250Xu\232s\3530\243\325\371\366\263\0162\361&3n\270\\\\"
+	.ascii	"m\037u^\031%P\372\344\274\036\331\236E\301^\240E`\347\312a\020"
+	.ascii	"/\177{5\331l\342\263\027he<\002\337`P/\031\337\330n\212\322y"
+	.ascii	"i\211\202\3639I\234\255\312\313\315\221\243\355#\316Gu\222%\213"
+	.ascii	"<7\337I\254\204)Fp\305\274\2357\317\303wB\237\327sy\026\033\304"
+	.ascii	"\354\224\320\332\274\373\371\232\037qK\320\341\222\221\265}\264"
+	.ascii	"y\026E:)5\362\245\363\321\2661\243:s>\312J\"t\007-\215_\252\n"
+	.ascii	"\261b\001\300\231\335\024\\\036\336N\032\337u\335G\240\210}^"
+	.ascii	"8\037\255\371\254\"5\337\324>\272\333\223>o>\312J\302\032\013"
+	.ascii	"\376\270\302TS\26306c[\026\337\206\326\366\367}\271l\234\232"
+	.ascii	"\305[\360=\r\303\007\006\365\362\254\3270\177\b_\205\004\243"
+	.ascii	"\034\270>~\214\363\360u!|M\276\357k\202=\210\243\271f*\270>|"
+	.ascii	"\264}d\276\222H\025E;9\346G\233z\371\215\346\3244\277\374\016"
+	.ascii	"{\262x\345\323|\203-zy\226g^\351P\377\341\376p\203\004i\3738"
+	.ascii	"\363-\245\221xT\221>[.\220\355\271\234\3724\2269s\205\\\275\017"
+	.ascii	"\025\b\315G\377\274\307\326\220\231\022\221\256\311\227'\357"
+	.ascii	"\252\363\260J\276oW;wp\037<\340Z\005`\335\250@\001\034\031`e"
+	.ascii	"eu`c\211\205\243\006\016+,\f6\270QCKYA\343\300\312z\f\2602\310"
+	.ascii	"\240\006\005.\"\300\302Q#\202\r:`\262\r(\033YQ6$\210\312\240"
+	.ascii	"\202\0327\242ldiEA\345\260\006\033`eE\341\320@\203\254("
+	.ascii	"\245[W\177\332\215'\352z/*7\336\304\023\214\364)\365Qf\263\022"
+	.ascii	"\245\365l\\\362_\3418t\033C\270\355\212\327\372\t\204\210!&\211"
+	.ascii	"RQ\307W\241\353q\317y8'\247\342\033\313\323P\321\016*E\334\f"
+	.ascii	"W~\342Q\3345\363\274\235)\340\030h,jP\23254\030\301\267&`\033"
+	.ascii	"\252YQ<\020`\fn'\n\245@|<\005\360T\276\"\251\375t\317y(\303K"
+	.ascii	"\274\211\275&\237\2673\200\357+@r\274\224\201\306\n:\2334k\350"
+	.ascii	"-&\376\236I\023\260\001\005_0\361?{\316\035]\236={%|M>[\211o"
+	.ascii	"+O@E\273\020\230\r\223j\357\330\373\276 \\\360/\205>.\037\023"
+	.ascii	"\350$\324\222\370\036\242\345\221\374\021\022\337;\236Y\024\253"
+	.ascii	"M#\276\321\214l\2610\342{\354\231EZe\022\361YS/B\352C\374\324"
+	.ascii	"\212\227\212\372\020_$\352O<\371\024\237o&\027\350\002\210\217"
+	.ascii	"\262#=\221v\245'\322Ap<\f\223\270\335\326_\214{\tjH\364\351\241"
+	.ascii	"\036\271E\b\332\323\267\325\347\236\324\tH\263K\t\301\037M\357"
+	.ascii	"\364\310-a\2131\234"
+	.string	"\351\231\23364\267\264\355lz\242\257\347r\215\374\031_\223\257\002\323\367[\021\273\245\007\321\274\341\315\376\271\244\247X\275Qrv\247\364Q\006\321n\253\364n\370)(}\212\301NJz\b\376\204\255\344\227%\031\271<\357\244U$$\250\037\323Q\365H/\201\325y\r[\374\3609|\t$\034\375\207\030\357dlr\204\243o\023\237T\244FO\037\366`Eo\364>\330\260\305.\027\377\305\330\016\024d~\361^0\032\313w\025=\262\307\363\252X%r\372\267\331\245\341\324\026=\333\364\322\004\323D\364v6\021\235\207\036\236H\214\007#[\220\267D(\365\310\247\366\374\360Q^\222\003\235\221\263\021\210\352g\220L\303\2569M]\365bn;\364\215\226\3506\025\335 CJ.\274}9\372\250\221\035\016`\276\330\035Vu\341\342\302\r\031\273\245\320\216\005pB;~\341\203\202v.V7\246\350\243\322\202\023\250\342"
+	.string	")S\262\2209$#\"2\222$i\r\342\n\020\004bq \366\320\007\022\300\0049G\224\314\251*III3\034\002\204\t%U\272\267\312\300\231,\373\255Ti\347\226\n}0\335\036\210\310\347\337c\246t\313\217Q\226\306,osk\004\003\255\377F\304\372D\200\362l\002X?a`\033\360d\316\227\210\333\024`\346V\356\201{\273\202\252\031\231\215\f\221\263\245\316\330\371s\247\017[rU\267\001k\212\320+\205\205pC\bh\f\370\211\030\007\345Tz|y\232\325|P\002/\354N{q\335<\230"
+	.string	"\227q#\331\352\2419\347\336:b\232#0\005M{\307\316\327\016\027E\251f\252Iz\325\356\316\330 \276\020\254*\355\t\013\303<O\214`_k\331\211\203\034\350\227\\\337\376\234\270\031f\263\250\2256\\\037T\3666\375e\322H\300k8\240\355$\233\336Lj\337/\201A\347\002Tc\212\327\234K\207rk\227\341\271'\205^\bo\345\034@\237\006)\310ZjzY\300\245\261*QCIp\344`\221X\303\37059\305"
+	.string	"\272\027\215\354\t\235/z\270\030\342F\022\220o\333\205Y3}Y\342\366.\037\213X\230R\262\307\021?\266\315\t\335c\263\270\\\236\202\236O\\\317\222\310\213\030\03496zr\2553\344\347\332\007^\205\206\366|I\357\253\032\b.\337\017\225\250M\021Jk\347\326\337v\243\2779\276w\260\013"
+	.string	"\203V\003\245R\006DJbc\326\311q5\224\335\\hp\367\216\3531\027\216\037\034\252I\322\251\375"
+	.ascii	"\262M\004\022\240\266y_\215\017\247\375\377tbi\022=\bOpU\227"
+	.ascii	"H\2500=\241\223\212s~aM\357%\304?=s\305\373\237\346QA\024atK"
+	.ascii	"\007\301\341O>\357\265,\3463\323\314W\251\327\262\310\"f\202"
+	.ascii	"\340\211w@\026\236\340\030nl\313\277-\271\t\273'Y\b\364\006`"
+	.ascii	"\023\021\255p\330\26354m\350\b\0176\356\327\217\355\234\333\315"
+	.ascii	"\242)\2250\320=\252P\220\2505\177\203\242\001%p\362\217\365&"
+	.ascii	"\231\035\004\245\300\021\224\201\210\334\024\233\237\233\243"
+	.ascii	"U\005({\225\023#Xa\0344\304\361\352w\3503\210\212Fr\200\224\n"
+	.ascii	"\225\024\241\034\354\340(\005?\310U\227LHK\0210\313\307\352w"
+	.ascii	"\324\212\226\261\267\bw)\006U\221q\261T\b\342\311\211C.\216\001"
+	.ascii	"\001\201\204\026\211qg\032\335\352r\271<\203\235\230E\376R\355"
+	.ascii	"\261gl\3574\216\007\002\373\377\034\241w\315 \3247@\001\237U"
+	.ascii	"8'o'\354!\373F\266\331\316EBd2/\203xVFWb8\021Y\236\301\f\257"
+	.ascii	"\321\345\342?\377\265\231Q%dum`H\346\353\204M\0170o\004\362\214"
+	.ascii	"\r\006 qdf\016\344\033\352\020\232k\330\005va\235Y\2202<\315"
+	.ascii	"a{w\r\026\322\216\035\030\213`\264\364F\351#<HG\246\301\341\222"
+	.ascii	"&@\303PMhT;O(m\267>?p\r\217\300\013~FC\276\017t\376\341H\264"
+	.ascii	"n\355q\307V\022\327\212\200\357\356\321\262\364C{\210\326H\200"
+	.ascii	"\2260Y\200\345\270/\3100\001\221\023/\375\350\"\214\200D\003"
+	.ascii	"\001\343\250\005\353\247,\211nT\340\030\237\221\244\3609\370"
+	.ascii	"$\206\236P\331\034\357)B\177*\366[L\222\352mG(G\352 Y\210\343"
+	.ascii	"\362\376\016\2156\227h{\214\307\370_]\240u4\255aN\027e\003\275"
+	.ascii	"\310n\2277\277\241bf<\021\216zO\342\013\354\226\034\350\253%"
+	.ascii	"d\203\204}\021\230\0334)\211\375\202'_s\324\273\350B\032@\021"
+	.ascii	"Wa\006$kg%h\3603\032\001\244$$\\\007<\230\237\356\313\267$\336"
+	.ascii	"S\300-\314\346e\252\311\241\255\224_LE\205P\311\025]\240\336"
+	.ascii	"A\f\221`\024\222\207\270\300\275\303Q2n\363U\217-\255\276\226"
+	.ascii	"\360\222\316XxO\247\312\f\362\2651\244>\004"
+	.text
+	.section	.gnu.lto_processRcSpline.93.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\016\020\315I"
+	.string	"zy\320\032B@bR\007S\374\2167\335\027\232l\3623=\002\264\002\374\3738\333y@\271h \261\276xt\207v|\251\035\"\205\240\017\220\001\374H\373\263\2231\003\031\261\317\314\255\""
+	.ascii	"\002Fi\333\336{o)S\n\227\001\177\001\244\001\332\207\256v\330"
+	.ascii	"\325\356\266\332\331\377\362\276[\355\272\325\376(\226\006\253"
+	.ascii	"p\274X\001\264\345\314\311A\256\203d\277v\257\312\177\371\257"
+	.ascii	"\373\237{Vo}\027}\253e~o\314.\376v^\254s\276\227\311\344\357"
+	.ascii	"\201vE\214\260\n\376\326\037\356\253\356E"
+	.string	"\337\361]\334]\233\275\374\233?\235\177\334\313\305?\247c\3715'\253\025\317\244c\336\230\337\372\024\374\355\362\223\334o\331G\272\337\272\357p/~\273\213\261\373\035%0\271\353\312JaX]\241,\313\315\r\305\311\331\315>;\367n\264\343\217\202zrjbZRR&\223\220\220GFED\307!c\2218\204_\267e\267\216\375\335~j\036\254\312\t\023\355\372(\271\207\222s\213\323Opw[\264\323\3337\271=\023\253T\203fG`z\206\313\263\215q\321KnwT\255\244\324o\237\244\362IT\246h$\265G\262\006\314\330\f\371\277156\351\315\231\235\247\223\242\217Xc\340\225#\3777\026\205]0\343\005J\265\321K\341\tY\332\027\021\241\375Q\211\231\036b\217kn\234\t\254K\b\275\335K\261\215%\321F\251\342K\241\t\031\222'\226\035\321\303\27714v\31166k\370\245`\367\030\316\244h\336"
+	.string	"5!K\3737\354\351\300\264\013\033\371\266\030}\262KY\226\217Q0\315\026\243_t\257\201D\301\364f\r\020\222\361\363\177cU\330\244 T\240\357\366Z,\352\324\372\245 \313\262kh\224\354}\371\356:\205\273[\271\037m\004b\356n\375g\031\236%\262\354\023\256W5_\262\354EE\334\033\266\036|\262\r7q\377\223\020\336\303\375ah\340\375}s\035\025~\367\324u!\301\337rO\354\247{*\037>\376\230\354\201\323Gt\275\026J\177\313\325\260O\354\177\2329\365\325\335\255a\177\365\231S=\247\234/\205\276\314\233\351\340\341\303\007\367[w?^\032\333\2029S\350\356\351G\311^\206\264\354\326t\222\332}\004\t\375Pv?\334\022\347\356\322E!U\362\260\217\367z\033\331\306\340\320\373%\203\347\004\251\365;\237\353n\002\205~\250?\335\033\335\301!\344\367\265\273\244"
+	.string	"\327\306\366\236\272\r\367\367\212*\235/\035\310\375\303\274\030\033\376j\236B\205~\250\n\367\333\337;\372\205\217\031\234\324K_\335\347\234zO\003\257\314y\276\235\270\037\265\2370\001\342\347\3367\034\265kx\265?\320\372\272\367,\243v\007E\355X\260\366\006\260v\006C\355W\260\366\005\260v\005\260\366\004\260v\004\260\366&Q\273\025\254\275\n\326~\200\250\235\tk7\360j/\360j'\360j\0370\324."
+	.string	"\326\036"
+	.string	"\326\016"
+	.ascii	"\326N\005k\237\032\322.e\324\276,j\217\202\265C\275\332\237\\"
+	.ascii	"\355N\256\366&\243v\246\242\366%X\273\322P\273\222\250=\tkO\""
+	.ascii	"jG\202\265#\211\332\217`\355FD\355E\260v\242W\373\361\325>\364"
+	.ascii	"j7\016\265\027a\355\3047\033j+\001>\t\235\366\323+\370\003\334"
+	.ascii	"\246\355\264\377\311\305\251\2114\355\217\223&M\022{\345\336"
+	.ascii	"d\362\344\220\230\266\2208\032APG5Y,\204Hl$6\002\325\263\264"
+	.ascii	"\231\266R^X\241\005Z\251,N\342>ti/5\020\375Ci\277]\332\236\227"
+	.ascii	"\276~\334\230*\310=\365\3673\270\312}\243:\347K\007\322\320\f"
+	.ascii	"\261\022\016\312=c>C\225Z\251\\?u\230[s\270\236\353\345\255\231"
+	.ascii	"!)\374\267\341\372\207\321\316\247{V\315\314W\310'z\264\247^"
+	.ascii	"\244S\004b\267Q^\346gm\261\254\375w\376\321\002\021Z\215\016"
+	.ascii	"|\326\006\261\225U\251\033-W\224\264\223\317k\241\230*\201PR"
+	.ascii	"P\240\244\275d\235\211\220\033\351\317\013'?15\002\032\237\357"
+	.ascii	"\02339\213\247S\367[$=\204\237'\206\222\026K\221\342~\213\334"
+	.ascii	"\\\263\036\323\354"
+	.string	"\306v|\273\360\360\\\261\371\2113T\365Yu\214\005\364\206m\264\217\252\304V\236\203vb*\204:Gs\004\215\366\022\336\\\024\240\211v\321v\217\263\304mK\260\335\345\376\200/\222\202\32081\025K\360\357\341\304n1\\,\027\313\271\337\026\355\207\026\361\322W\037\357\347VX\226e\007\376}\357\246\202\277\332\267n\341\302\005\367[\242]b\376B\335#>\330-\035^\233W\303\370)\0312\377\270\277I\225\316\201\037\332\307\375a\322\254m\334C\373\237\205\212\333\270?l\315\263\311\260\201\003\007\367\333\342~\273g\367f;\352\207\021\231\213\203\367\324\265\313\374\267{Z1k\017\374\203\035.>\004\013\030.D\260\200\241\202\253\005\321\267\254\266\270\232[-\2321\\\250\200\321\334\342\242\321\264B\272\214\031,\270\2325d\310\340j\026\347\274~;qXN\233\237\327vF9\330V\255&\216b\245\301\332\016\366;\330"
+	.string	"k/\277v\027^\340\225%\201\030\354\006[\211\317\255\260\031\006\373\373\346\354M\tR\251@]\355\026{W,\232y\220*\035\363\264\247\376w\317\214\322db;\233\334[k\213u\275\326\376\270\177\326Ik\233\330\311j\231\234\246\005c\334\n"
+	.string	"\315\312\343\n\b\325\263`#\253H\360<\013\025\344\341u9{\224\371\021&\330\n\266[\367d\003\243\357\022\354\3372\007R\367\020\330\271u@\235\263m\003\246\253n\235\320%\246F\020\324t\b\366\017\232\001\001\3055\267\234[\241\004u\034\233\367\346\326\006n1\365J\220Ks?\232\031\220Z\265\255\332^ i\211\251X:\213\325\225\252\rb\216\303\367\303\271\205Ik\267]zg\333\212[\225hk\233/LSqk\023M\226\345\006Sbj\225\332\201\375o\263\033@q^\332\300f\366\210\333\300t\332\213#T\243\305T\006\032\nsj`k\315n\250\322\245\002\233\213\300.\240\265\007l\002\002\366"
+	.string	"}&`\377\335\263\\\346\276=\343\005\256)\005\330L"
+	.ascii	"l\252\035@\t\200\235\2343\265\251\366K\355)\327e\032I,\366#\016"
+	.ascii	"\022\304\375Vj\277\333\267Xf6\200\334K\336\0348\345\236\272N"
+	.ascii	"b\276Fb\376\337\375\007y\266\351)\231\277\267\230\277^rY\245"
+	.ascii	"gi\324^B\355\250\375\317\276\247\201P\250\201(\006\225S\210F"
+	.ascii	"D\244 )H\322\032\241\005\304 \304$+\037\021\360,s\216\021\221"
+	.ascii	"&\311\306\001\2430\376\3241`\233\2128\321\206\267\353\310\355"
+	.ascii	"\265\207\351yj\254\336\024\273\302\n_\3402\023t\250N\345ad\201"
+	.ascii	"L\037\302\257\267\261\306\270\326\222 c\321_WN\323iB\367\232"
+	.ascii	"\345\300\342\273\230\366\253\022\277\030b`\003}\370\030\221\313"
+	.ascii	"\255w\024T\256\021{k\315\224\301\022h\254\006\376w\344\333\""
+	.ascii	"\313|\214N\024\2148\0130\"\301\201\340KaA\327\203\t\001,y\230"
+	.ascii	"\354\363c\037Qu\374B\\\316I\277\321%P\360aq\365\2009\fJ`H\201"
+	.ascii	"?\334\300B3\340\317,\026\201\023>\3262\252\024PV\022\332\355"
+	.ascii	"\3630'\323d\363A7\243\35487\275^\016\037\006\272\007Y\027\n\r"
+	.ascii	"\203\260\252@\342\031C\315\\p8\350\353]\317_\340\276-+\3567\025"
+	.ascii	"]\343\262\tBJR9]\273\364\317x\312\206\277\323\275v~\362\016"
+	.string	"\241\004\t\017\362\212\251\005\267\223\013\017\007\032\312\272`\261\371C_%\270\"<\244\233\335\303\253\301\317jrOE\t\300\242\261\021W\201\217\t\006\240\324\341\300q\350\272\005\021H\222\fLahL\251\227ex)g\307\330AZF @>|\354p&\307\352GD\f\r\374"
+	.string	"%R;\221\346\212\357<\347\356\003+\270\370\244\273\026TxZ\300C\303\342\337u\034-D\020a\346\307pd0\024\373\224\330"
+	.ascii	"\360\022!\"\273\034@S\251)F\332g\2446\361\356\004(4*\226Sx4}"
+	.ascii	"\032\032\247\256!/\233\277\265u\024\272O\310@\370\005\234\252"
+	.ascii	"\350\276\016\022\273\372+Y\265\366\322%M\330 \267^\350\362r\351"
+	.ascii	"K\232\355\206\342\323\204`\352\016\253%\303\232\204\345\030\220"
+	.ascii	"\177U\007\215|i/\353riE\325\020\305\247x\031\331\242!\ns=\021"
+	.ascii	"\304\225\031\032?\201'\342\217\3531\237)\304\234u0\363\022\323"
+	.ascii	"+\001d\207u\223\337;s\255\200\267\374\034j\303='\366\261\205"
+	.ascii	"\235\260\0064@\020\355/\363\305\227\346n\025%\207\2016d\377\363"
+	.ascii	"\260\031\017\003\026\351\345\3300.\026\227G\234\205\034\226\001"
+	.ascii	"\232'\036\027n\322\217\270\201\230#A\264\312\032:\bc\344\263"
+	.ascii	"\rt)P\026'_\205\260\215\177\250\373b\246\256\023\307\177_\365"
+	.ascii	"\270t\016\0316e\271\013`9cV\324"
+	.text
+	.section	.gnu.lto_processRcCommand.94.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`X\006%%"
+	.string	"\206\277\343Fp\234N\007\267\320\005\372\307\234\263Jg~\371\0320u\226\224%\267\255\003'\3700W\002)\216\0065\242Q\021\325T\001\332\345\336\364\007\221Yo\360\315/eADU_\314\024-qQ\023\021ZjB\366\336)\245\024\325"
+	.string	"\267"
+	.string	"\327"
+	.ascii	"M\346\324\027\352\306\310\023\253\273\273\027-A\253L\340\327"
+	.ascii	"*\267\314d\032m\353\016\020\343\022\325d\315\275\027\371@\272"
+	.ascii	"m\235\034\234\243\261H\034\n\331 \360\347[\325\364\275\345\016"
+	.ascii	":\223\255\223\343\225\002\005\2055\2038NW\037\273\270\334\350"
+	.ascii	"+\312\242\332\352\342V\017'\232u\020]\263kH\327\274J\201\302"
+	.ascii	"\232X.d\360d\323\"5\300\262\250xt\260\303\232V\034D\327\334\341"
+	.ascii	"\300.\353\nZ=\346\310\364\262\250\274\372\027\224EU\325\276T"
+	.ascii	"\bK\016G\3235\253\322\235.ZbXg\224\257\351\003\265\273\326t\315"
+	.ascii	"g\352\013\213\202A\271\232\243S\326\371\344\237\n\335\265\245"
+	.ascii	"!:g\244;S_\314.k\227r.\335}E\367^v\246\223\252y\247\231[\211"
+	.ascii	"\231\0270\253_\001\374\237~G\275i'\375D\204\321\321\321\332\352"
+	.ascii	"?\321\023\215\236\203\2712bi\247\265\177\033\031:\263\t\024\336"
+	.ascii	"L\177\026>\226\237\354\336bs\307\366\017\345\226\261\366\217"
+	.ascii	"H\263{r6\314\255\244\227\310\340\366b\025I\336\314V\271\223\326"
+	.ascii	"V\373\273\254\217k[XWUJ\2172\243-\375\241\314\235\336\377\301"
+	.ascii	"\374s\376I\235}zx~\316\307&k6\272s\321\347L\\\235\207\252\263"
+	.ascii	"0ufS\347\240;\003}\316\277\325\331\247:\257\252\263\232:\247"
+	.ascii	"\357\374\356\354\356\334\006R\310M\335p\366U\364\336\251\250"
+	.ascii	"\233;\247\272\ri\262n\3463f\226\271\315\230\331V\273\313\230"
+	.ascii	"e\"\006m\b\016\330]y\327\030\266\031\254\001gn\213\264G\274\231"
+	.ascii	"<\377lv:~[\267y\357E\220\002\307\\\322\367\370\311\206H^\260"
+	.ascii	"{V\365U\033YI</\317\244\356I\017\370P\271"
+	.string	"\017\317\2755yJ\217\376~\317\314C\235\245\035\213Pw\245\261\264I\332\262\366\254=c\236\361\375\357\003\250AqQzTAW\341\265\337\275\367\0017\\\307I\230@\201\302\332\252\357\033\216\313M\351\321\326\231\002#\306\347k\247u}\030i`\330\272\315\311\302\205\013k\253\3533=\367\306\00483\206\f\r\345\013\336\334\362\223\020t\264\241\261z/\255\352\217H\003\303\032z\312\322\357\336\247\006\334QZ\312\006n\257V\231\203\007\017k\253\352wx\252\3213Ss<}f\020!\274\231\f\364\364\311+\220\224\224\214NL \201\344\302\210\004\323\013\"\037\r\0355!\217J \225P\030%!\217\232Z \207rx\211\t\251\t\351bi\251\t\311\242);\275\377\203\213\224\277\3249cU\005I^\316C\271xWL\303\254\342\364p\210d\306\f\237\030\306n\370+\233\025\334\230\033\343%\371b\345\370Pvb\2535"
+	.string	"'o\\\212?\177|)\267\026\326\t\237\311\nn\254J\310\331gn\205\264C\216\317\376\252\305\245&5\372\374\017\316^\324\033o\216[\203\357\363\r\225\267\364(\033?\370}\326\376\265%\352Ms}I\216)>\224\333\254\013\230\201S\343oT\226Z\210N\253\361\32568\274\246#\242$\033>\224\3277(\266\347{\240\332\314\202<o|)\006z\001>\221\025\2251!X\017\230\217\033}\250a,\304\224SF\241\031\tF\213\224t`\002\031!;\363\021"
+	.ascii	"5\350\230\033\325f3\202\211vI\200\261\267\177\001\317\231\265"
+	.ascii	"\300\237\371\363\267eP\257\226E\021\366U|\240\357\225\264\216"
+	.ascii	"\024\275\220\202\317\360\3317\252\211\277\326U\307\221\303\373"
+	.ascii	"\205@\322q,\300\251!\3275\240 t\006\306\244l\340\273\204D<\232"
+	.ascii	"}&\213\031\274\222\355\262\003}\322K\017Z3\025\226\242\306\227"
+	.ascii	"DvG\260\033P\253cD\307\006 !?\3647\345\006\300\021\320\362\232"
+	.ascii	"\031\331\234\364\345t\275 \207\001Xr7\354w)Q\370\260\375\321"
+	.ascii	"A\206\022\200T#%\177\260\243\277E\251\020\033\363\rG\222FX\332"
+	.ascii	"\023\302\205p\013>\301\313\345\263\343]\325\"\235\211\322\372"
+	.ascii	"\221\237\352\336\3241\"\233\206B|\214Zl\004\224\236\3037\363"
+	.ascii	"\257\227UQ\271\236\023\033\342\215\246\331\003;/K\035m/&Oq\372"
+	.ascii	"0Nu\026\003\326(\302\267$\036H\2203\001\350\360o\027\302|\237"
+	.ascii	"\211\253|\254\006"
+	.text
+	.section	.gnu.lto_updateRcCommands.95.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\352\033\315x"
+	.ascii	"*\306\374*J \224\322\031\016H;(\207\354\206$\300\361\332\353"
+	.ascii	"Q\341b\210\361`\223\203VL\005\225?\031C\364\035C)\233h\\\"\035"
+	.ascii	"f\336\027\356\017/\255\343K\032\370\223z\337\305M\313m\245Q\215"
+	.ascii	"\245\"\256\242\004\024\211\335K\232\224I\006\215\002k\002\252"
+	.ascii	"\002K\205\344\235\032\342\225\022\342\215\022\342\205Jy\237\204"
+	.ascii	"xe\b\361\306Hya\244\274/\210\274.R\336\026E^\247\"/\213\224\267"
+	.ascii	"\211\310\313\204\344]q\344Uq\344]:\362\246Hy\225\220\274I)/\222"
+	.ascii	"\221\027\305\221\367(\345=a\3445\"\301k\"\345-*\362\226Hy\211"
+	.ascii	"\210\274CG^\241#/2\345%a\344=\246\274\306\224\267\230\362\006"
+	.ascii	"\245\274i\312K4\362\242)\357\260\310+\f\342\355\224\227\211\274"
+	.ascii	"\177S\211\317\222\016\017jk}\347M\2252\370G\2253\274\363\362"
+	.ascii	"\271\243\3746\177\336\217\367\337\375v?\232\277\371\277\275\270"
+	.ascii	"\3735\272\221\303F\250\322\251\302\262\26672c\326\254\021\357"
+	.ascii	"\204:bp\370\273\361\303^\315\032\357\026\217\211kH\345\312\022"
+	.ascii	"\230\246F\232f\327h\267w\256\361\211\231\332\233\375\016\373"
+	.ascii	":4\213\027\250\306fF\332\303\317\354\032\027\205\357\260\255"
+	.ascii	"G/\f\n\273\227\373\334\336\314\032yP\252\360\035\226\370E\017"
+	.ascii	"\220\214\214\252\252*\354yX\343\207*<\216\005&\25675\f\203+t"
+	.ascii	"d\002\241\322\017\211/s\2705\2761\021\252t\f\250\265\241\275"
+	.ascii	"H?\334\223\271\233\362M&W\305\324;\001\024\343\344OUU\250\017"
+	.ascii	"\227E\372!\323\215"
+	.string	"\320\017\205/B?\\\345n\337\337nPS\250\215\351\222\013TU\225\252\263l_\370\3665b\345\245\242\240\236d\304\200\361\302E\013'\026ML+T,\245PJBBqt\302\310DQ\t\242!!$\211\243\261\030\224\022\321\241\260Y\271'\346\020\2265\363\274\302\264.\365|\324S\217\241\236o\370I\0061\007\240\030\247\036,bn\036\203\r\303h\343\344\027B\2467o\332\003{\332\261\213\026Nh|`\026uo\252K\003\353\201\231\316\320\361\212\2722\254\242\256\311KnO!|\372\373\241\317\367\300\334\204FR\272x\221a\245$\266#\t\237\310\364`\370\036\330\232\320hN\031\021?\303\306(\332~4\006\316\013\237\020\016u\021\316\250\233\201\215l\020\343r\023[^\264%\007.A\244\345C7ha\241+G^!c\0228\374X\345\306=\260*B\24640&\027\205H\2648\313\357\201Y\021\322p\322"
+	.ascii	"\350\3167\245\201Q\341\240\264\211H\314\201El\354h\327\312\303"
+	.ascii	"oq\271\260\030\006\303\033\031\326D\310\244\252\352\341\316_"
+	.ascii	"aKfb\016UU\227\275\302\304\276S\337m\252\335%\262\213\344#+\340"
+	.ascii	"\322K\037\255{\360\255\201EM\324\367\3228\344V\264\022]\244l"
+	.ascii	"\273\037\245[\252\252\\6\366\201\027T\226Q@\207\016\364\303\022"
+	.ascii	"-\314\303\323\034j\242\244\331\373\360\031\352\253\271\005cT"
+	.ascii	"\370\004\357ZUU\255\240>[\264\215\016\304\026\332hmC\2062i$\375"
+	.ascii	"\265+\324E\b\345\274\366l\361`\331\020;\274\341\030\034\004D"
+	.ascii	"\266P\177MC\322\310.\242\263\305o\375\333\342\301\224D\277\357"
+	.ascii	"-\034\233D\377\357\330_C\305\016\321\330[\207Is\261\203\332\330"
+	.ascii	"2\360V6\2414_<\264\330Ox+Z\332\304\016j\244\2725m\311\203i+\361"
+	.ascii	"\255hK\036\\\264\211\335x\r\234\210\035h\337\017\225:\202M\264"
+	.ascii	"\317V\310y \350\373pw\202[S\026\367\344b?\303>[n\250\277\356"
+	.ascii	"\227\262\276q!\205\272\215\376\332\013\373\314\371e.U\335r\332"
+	.ascii	"\337\271\020\353\344\261v|\257\265\003\243\022gL\340\276\251"
+	.ascii	"\252\332}\266\303\346\006!N\217\213\375\254\260\207\021\334N"
+	.ascii	"\017\033\373:)L\220n\261\352\240\346\347|\317j\277e+\370\361"
+	.ascii	"\003\375\260\333\006\236\2617\367\273\002\355N=\016\220TU\325"
+	.ascii	"\033\373\347\341d\260\337\362\341n\020\204\357\025\004\375\360"
+	.ascii	"\335z\360\376\310\334\356\266xp\367m\311}\266\373\253m\266{4"
+	.ascii	"\337\273\265\255\215\021\243\3660`\322\276\240\375\356{/D\274"
+	.ascii	"7+;\336\367X>\367\275\225*\317\373\236\031\303\333|?%,\n\224"
+	.ascii	"'N\336\2656\341Jy\277,\362^\253\310\253d\322B\312\253$\345\315"
+	.ascii	"z\363k\302\233_\254\333}\257n\367Mr4_\253\277}\221\034yK(\362"
+	.ascii	"\222p\344=r\3445r\344\035!\345\025\341\310[\344\310\033B\312"
+	.ascii	"[U\344%r\344\375 \345\035\222\362z@\344\025\222\362v@\344\rB"
+	.ascii	"\304\313A\312\273A\221W\203\2247\003\"/\006G^ G\336\013\216\274"
+	.ascii	"?R^\013R\336\n\210\274\024\244\274\023\020y}\020\361\366Hy%("
+	.ascii	"\362F\220\362B@\344\345q\344}\340\310\273\003\311\353\300\221"
+	.ascii	"\267\201\224\227\201\224W\007\221w\201\224W\001\"o\016\"^\034"
+	.ascii	")o\002E"
+	.string	"^\004R\336\003\210\274\006\034y\0138\362\022\200\344\275a\344\035\340h\2766\220\2745\220\274\002\034y\003Hy\001Hyi\030yg\fqa\236\326\001\354a\332\305\335\231\373KS\003\323_\311\226m}\265\026>\273\002\335I\277\255U\310\255l\313\260;i\242\334\232\266\344Zv\022\237\025\215\253\227\344\272\0025\251\303i_\276\366\353\360D=J'\325\255demB?\254\207x+\231\262JY\243U\372f\237\333e\302\003w\001\222na.\312'_\312(Q\2524\021\016\220\240\t}+}3w\361\345O\334\2359\266%\017.\365Y\337\001\350C\351\363\255lXM\243\001h~\256i3\232\206\024\306A\t\206\206\031-E\325,D\237\232\234ek\245\320\023D\322\273\0329\247\247y\364'\215\325_S\rB\030gQfa\033\224f\312\027\206\240\037N\365\n-\315\032\274\253\224A9\003\337K\352P\346\212"
+	.ascii	"\023\374[*\365\331\006Y\221\224\004\321\320F\016\035?\024Q\375"
+	.ascii	"\256>\037T\313\350\250&\362\255lO\r\325\347\373S\243\340[\321"
+	.ascii	"b\2401ZF\243|\3264\030\035\243E?\206\206\321\177\230f\226w\346"
+	.ascii	"\320\226I/Z\tR\237\355\2133\347\261\030\302\214\035A\007\216"
+	.ascii	"\213~\201\245\006\027\275\002\317\235S\267\350\003b\362\025&"
+	.ascii	"s\352\273a\316\t6Q\2440&B\377\311\216\2621qV2\242\020U-B\243"
+	.ascii	"}\370\336\324U\275\274\0022uS\037\020S\341\031\230:\311\224["
+	.ascii	"\273;\372\372\212\006!.\017\rfR\257\274\202\356*kP\226\361\275"
+	.ascii	"V\020\321\365\275 \207\253\265\366D\237\355\353.#\217\211\273"
+	.ascii	"\365\n\2056\332\252\277\244\372\374\027\032E\335\252\357\326"
+	.ascii	"\257\373\2178.fV\262%\017\262\t\025S`h\276\245V\321\rh\335\303"
+	.ascii	"b\353L\303\226\002\255\335\275\250\317\032.\317\257\304\320\324"
+	.ascii	"\203\334\bE=+\005Ga).\360\027O\251St\363\255\177Y}\325J]\202"
+	.ascii	"\216\027\247\220\250\317x\250\315\026}\366!\361\204\203|\230"
+	.ascii	"\276\352\257W\241I\315:\234\261\2272\313\223\244> \225?\202B"
+	.ascii	"Ha\332X\326\305\017J\314\312\023$\022\212F\322\302]\274\242\350"
+	.ascii	"\263\326\3345flb$\236k\021\352'\346\336\364\031\277\326I\216"
+	.ascii	"\232\271\326yt\003o\361R\231\003\027\245\027\245\027\257=I\372"
+	.ascii	"\250\205\312\272\344\255\177\307\023km,\343b\304\212\266<\f|"
+	.ascii	"{F\030\377\245O\364\261\304\351\031\365\211/\254*\301\004\372"
+	.ascii	"\240RM)F"
+	.string	"\271\246\\C?4\352\247Q\351\023l\262\2267r~\305>[~\021\324Dg\305\345\261j\023}\347}\304q\271\323\025\250\001\217\326\377\322Os\326{\006kdJ\211\221%D\254\250\222\\YY]U%e\025AB\244\352G\021$K\226\\e\031Y\202La\b+9\222\002\021!"
+	.ascii	"XVK\204XWYXB,\253%\275USUYTU\"P%9B\304\212\252*K\t\325T\321^"
+	.ascii	"a\025\311\242Zru\225Ee|\333\372\3256s\342\207'g\253\227R%t\r"
+	.ascii	"\353<\242\301\016\231\225\022\372:0\375\004\233Qb\232\203'\241"
+	.ascii	"/\006\212E\272"
+	.string	"\207\003\235\204f\321L\022\372M\246\337\332\330\021\251\236a\f/\257cX\347\224#\3754f\237`\323H\357\013\3534\272\241\305\032l\235\251\024#}k\315-\276^GI>SU\335\272\027\224\344\017I5|\257=\235\237\230\247>s:9Y\347Rw\255\300$\"0p\213\007e\214\200\327M\326\271\324\\\275\325Z#\364\321\230w\206TU\2151\346Q\202\030R\307\034\306\337\257\345\004\007\247-\016O_\253H\036\003\372#\305~\004\213\364\307\230A\b\336\205\320\206\215`>\334'\371FI\362\371D?\354:\257=[Q\\\304\236\020\372o>\034c\006\261v\267\365\002\006\252\354\303=\335\213\313\363v\030(\221V\366r\327\030\363q_\2178\3119s\320\017\2110\263N\233\261-\027\037\f\221gH\177\340Ao\320C\204\264\007\035\364\247\b\t\322\035p\320A\330\3149\320\2407\270\023\204\006p2\230\202Ag"
+	.string	"\2441\270\240\201\354\315\271\340/\216\233g\213\037O=\013\372G\005-A[@AW0A\237I\201\217\236\240G\373 \nq!h\217\bZ\0026y\021\350A\300\344\321\020<\320<v\364\003j\356v\264\320\234\247\0342\267\273W\241\313v\354\254\332o\331$\235\244\235\244\0356\027\006b\346\005\002\016\313\206\210sr\200\233w\240\004]\337\223E\237\371\260\316\2453\ft\003-\344[\377tt\002\315@\023\353V\262\005Z\207\004\254@\037\013\236\344\020|\257\005r\264\002M|\342\350\034Bi.\004\305\321Jx\bt\002\3756\236\223C\240\177\307\304\023l\362`f\376\200\336M\372%\365`i\246&\255\265\006\364\001\005\264\001p\266x\320\217\t\002\272"
+	.string	"4\270u\246o\004\364\327|\370\207\211\267v\327\315\365\210\246\033},qy\034`\243'\371\240\273I#\222\202|\257\033\315t}j\212f\362\2320)\301\240\003tV\034\036.\366s\004\267\361\032\263%\001%\007\225ZZ\350\207\003t\013L \326V\324hfK\240\211\262\213\357U\243\207i\372\312\\E\237\255\013sEtIq(\275B%\2546\241\277\004`\031.@\237\256\257L"
+	.string	"\255\266N\241\202C\250\342\b!T\202R)\245fF$IRHk\342\n\020\n\303a\036\246\264\003\022@%-G\243\320\241\241\021%\205a3\006\237*\\\220\200\264\205\273y\313c\017|\336\003`\222\320\247\242\331\246\326jW;\205A~\301\355\201f'\262@lg\357\256=\322\356LO\265\306 \340Y\350\372\370?R\t,\ro\324\001\0233\251\026i\314\234:\331\f\370\322\226WUgZ\232\3635!\302\277\347\233\017\231\016\367\n\242\035\230o`H\377\301\033*\202\342\330\026RK\255Z\217x El\023\006,OF\211\205-\2163\225\225\213A\234\034}\017\356\006\232\347\235\252u\351\b\365\362\263\360\034"
+	.string	"T\374\330\273{r\232\375)\233-6 \230\263a\204F\206\306I\005\265`<\334\245\252d\303*}d\3509Ba\220\202\030\357\307Y\323\361\027\226l\034%dM\265\017\3311\301d\322;F\0014"
+	.ascii	"\214\245\032W\032\243\036\275F\026\022\276\031\337DH\267\005"
+	.ascii	"\3738\036\224E@\2309\013\2340\365\025\271h\317\034f\322F\002"
+	.ascii	"\030\b\316r\217/\217'\034\205v\026\313\335\313[\234\307\0132"
+	.ascii	"\372\013\013\256\214\2621\313<|)\340\311B\275\254\002\323\006"
+	.ascii	"\f\0250\377E\203\377#\031 \350\372\260\263\273!\024A7\344\210"
+	.ascii	"b+*.c\244\311L\223>_\267\235Rf\334p\316N\367\235\323\207:(\333"
+	.ascii	"\310'\237\026\377\261~\376\035\031\300\321\211D/\353\377\336"
+	.ascii	"\310<\242\3113\256A\377q\254|-\315\364\367\177F\263PB>\031\266"
+	.ascii	"I\312\006\260\002\tp\313&\336\020\212\364M\261\266\365\300\n"
+	.ascii	"&\013rz\225yV1\005\0213\232\314d\224&j|%<u6\354v&D\\\201\346"
+	.ascii	"oM\001\n\374\274\371\241=\270\335\253\371v\210\036\313\204\322"
+	.ascii	"\326<\306 l\360pU\304\0033d\346\301\204\207\2052!\363\324i\207"
+	.ascii	"\342\351\361\315\347(\341p!\263b\261i2\313\220\331\035\n2q\200"
+	.ascii	"\220\206g\005\037\275\020#\b\313ga\231\326\246\376\314\213\234"
+	.ascii	"\216\341\370\001@d8\223\361\204f\201\277>K\363\210\303\252\023"
+	.ascii	"zJ\354\006(\366\312\2163\n\310T\017*\025\374\t\204\333\233\307"
+	.ascii	"VM\240\257\241\b\3368\312\365\003~\206\334>U\330\211\316z\017"
+	.ascii	"\256\374\304\374&n*i\026\372\013\234\364I\365\313J\346\024L\375"
+	.ascii	"jy1\260\211\256\222\265(3T`\3733\rp\222N\214]\361\323\304\372"
+	.ascii	"\356^Wj\276$\201\213\230\023\036\347\236\240Y\2258\n\023\023"
+	.ascii	"\0306x\030\007\036}\025-eD\345J\347\245\027\2525\346:\025\001"
+	.ascii	"d-/#V\315\177\203\363\355\336\264G\t\357s\031\321qo\376J\230"
+	.ascii	"/\350\032\260\340\337\352\275\235\221\3740\006\314V\345\204\t"
+	.ascii	"H\311\340\3004*l\375@\027I\363~\326P\035\322d\245.\307 JB\001"
+	.ascii	"\231\332\361\345\371\250MI\364\275\366\252\376u\325\212\270\r"
+	.ascii	"@\345\357\331\3319\323\303\365C\262z\301c*\203\203U\276\353\353"
+	.ascii	"\317K\200\020\237g!\251m\3660\331<,\367\313kd\241\320\354\274"
+	.ascii	"!\204G\255\260-\242`\243C\212\\VX5\322\347\2660\022nS\273x~p"
+	.ascii	"\342\240\252zk^\264D\246bR\221(\343\213\373\031\255\257kQ\\K"
+	.ascii	"\340\007Q\247\260\367\304\221\001\203\274\331@\302d\300\034\275"
+	.ascii	"\f\332\325l^7\013\240\036\016\364au^\273#zH\344@m\340f~\237\352"
+	.ascii	"\333)\234\241\304\r$\255\226{{\347In\332\233DR\210\033+%\331"
+	.ascii	"\242'vT\221\335\210\351B_\377$\343\330\025\305\276\033H\312\253"
+	.ascii	"lL\272N\314\303\033E\325c};\246\016\032\241\220\333\335 \007"
+	.ascii	"\211\304\226.(\323\312\021n\272\027\350\243Y\261\006{\236\360"
+	.ascii	"\024k\220Z\221n\357\221\264\256-8\230\267\376\306IY\374\361x"
+	.ascii	"j\254\236UF\300\370\001\020{\003t\272\007\003\235\3063\217b\337"
+	.ascii	"\370i\342\240\016\207\223t\341\204\251Elf\b\205\334\215g0\026"
+	.ascii	"\322\271\242kt\214\336\360\321p--V\003\270\355h<\317\263\206"
+	.ascii	"\331\026vs\305\026X\203'\004I\261\021\347Lih<\266\004\204\026"
+	.text
+	.section	.gnu.lto_resetYawAxis.96.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\255\007"
+	.string	"\002\21635`o\032\003W\252V{w\351\310'\263@\271\212q\344EN\333\t\032F\265\261\326V\217\330\354\005FWt\254\006\200\212B\335\202\234P\375H\f\265-\267\224)\005\2756W6/\207\031\361\300"
+	.string	"1\257\21437\004\305$\032\2629\201a\331\314tw\365(\0028\265\230@\361\242T\257@\245\304&\034\212N\307\262\\\b\241>\257-\324\214\270\25370\372\217P\223LRQ{X\326\302\003\275Y\326\036\313\022\272(\226\245B\b\025\362\201`\252\355>0r\264\256\036Em%\360\222\301\231t\3725R.7\311\223\217\266\316TkY\334\215n"
+	.string	"\262\202Q\372\376\317\330a\315P\253-\342\200\215\373\030b\022\376\027n\334\206\033\335V\323\366\240mJ\016"
+	.ascii	"3\241\321\037\270g.\003\244\006\230\200\201\267f.\304\2243C\200"
+	.ascii	"\256\341n!\214\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_isMotorsReversed.97.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375 \3405\006"
+	.string	"\242\013+2`M\222\016H\f\002\334$\005KO\215%\342h\250\002\004\267\331\332\253\261\326n\254\217c\353\245k\\\001\300%\310\353\252@xaj\335O\337\364\3362\005K\026\211j\022D\233\210p\220h\022U\321,\005O\024\017T\263\230&\252EX\026;\207\007\032\334|E:R]\317\027\227\253U\350^\002\n\035\016lh.{,s\310\361\005H\354\374\367!A\346\271\3721\311\344d+y\002\225|\374\230\217VX\300\\\025\363\340\030\200\250`\220\244db\r;Z\365\252\333\2206l>(\326\225\351\t0d\346g]\032\035\373'\374\b\177F\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_initRcProcessing.98.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\347\b\005/"
+	.string	"*T\034\022D`\\N:s\261\227\021\237Ws\\\256\036\314\262\275\313o\244\266f\335\223\240\232\302\270\026KU\363\235\336\253\036\037O\023\347\345\t\314@\203+\013`\260\\Wg\235/\263w\346\330\035\317B\253\304\022B\344N2\023\001\370"
+	.string	"\023\001\304*\237\323\272\025\032\277\313\373-7\266%\201\365)\220\375Q]\320@\353T\262~\225\027\353\214\355K\316\275M\001\353S\346\273\361\233L|\372)\177\323:\034\333\375\206\335\337"
+	.ascii	"d\303!\347\336{\340)?\255O\233N\244>E\177T\237\236\310Z\314p"
+	.ascii	"\336L\273GP\236^s\200\367^d\037a\237\243\315\363j\265.\024\004"
+	.ascii	"\364c,\372\020\207=\253PM\321\266Z|\250\272\347\222\271u\241"
+	.ascii	"2ANfaH"
+	.string	"\016\204\262\32551\013K\362\237!7\232\205\225\275\230\206DH\331\315\300\206\250C\273$v\354d\006\226D\365\201\260\244\tQ\312W=6$}fad\037\242Dk`AP\003ewb\354\224\006\f\210\355AQ:x\340\236\006\354\007\032a\331\025\367f\322\256F\302\306.\364q\325\310\364R\332\224\307Q4\251\354N\314\310\264\201\016@Sd\357\316\333/f\227\3557\357\201\rG\237Y\330\330\255p\302\275\227\355\222\031v>\236\371W\314,\305\274N\b\266\307\336\032!h\2431\ru\252;N\317\211\234\231.{\207\325\236j+\3505\230\266m\265Q5J5\264\323\276\327 \253\370\226,*~\335\214\025\353\275\367Jd\250O\321\356y\343cy\026\031|%\314\302\312~\371\224o\245>\355\226\320flx,\365m\373\312\265\244}\262S\277\357|\207$\035\030\257A.\373\3540]\316nt\24317\223\266"
+	.string	"\0232u\270\317\230\251\030\334\312y\n\352T\316O\207;;\245\226\233R\313L\251\345"
+	.ascii	"\251\345\245\324\262Rj\031@j9)\265\214\204Z>\022Z6j\313Em\231"
+	.ascii	"\250-\017\251\226\217\252e!\325r\220j\031H\265\374\243Z6\252"
+	.ascii	"\226\213\252e\037\3252Q\265<L-\367\250\226\327\266,l\313j[NS"
+	.ascii	"\313(j\271\333\262m\313w`\204\262\307<\235\363\336\035\317<\367"
+	.ascii	"L\352\205\311\251\374V~\2707s\034_\356N\016i\027\354\336+u\325"
+	.ascii	"vf\313\n2\322`\020'\303F\373\222\212\324Ermx\304\3614 \2259\352"
+	.ascii	"KyJF\266\205m\214\313>\001{\032\215\205n\204T\335n\354\201;\365"
+	.ascii	"\227\323\200>\275#rn\272\354\235\243\367\336\2736\032\337\371"
+	.ascii	"\357p2\007U\264\031M\237\032\252\277\230\021\334\251\251\372"
+	.ascii	"\315o\220\2433j"
+	.string	"\267\217)\241\304\346\336\373\200\037\346bL0W\2358\301\267\364+j#!\233c\251D]\324\307\344\025.C-l\242\376\261\207\372H\250\217\375\240\214\262-\250\327\026j$>\345\032P\023;\250\231\354\224e?]l\240F\316)\333\214m\354\037\25066\222\317\247\207]\354\004v\312\265\265\327\366i\005u\312\265$\333\251\304N\352\351a\212\177\351\351\307i\3636\325k#\361\235\356i\013\273*\357\212\323\n\033\355qyno\324>\343\037'\323\f\312\240\207\234\314\267\376\263\324\247\376\342r)rw]\366N\2126\353=Ke\320\302<\2728J\265d.X\300h\254\2538W)\250\272BV\241@\266Pa\202\005\262\352\352\005R\301\221\255\\\234\270B\302\260\262\272B\022\233\\\3573\346?\2703\\\235\344\373\375V\320\216P\223\330\372%\225\251\233\230L]\203\214/\317\243\376\236\004\265\016-\317\347\243\376\204"
+	.string	"\005\310q\301/u\200\345R\327 S3\347Q\177<\216`\370\360\374(\365\215\333{"
+	.ascii	"\255\324\367\022S\002\350\032dx\201cv\036\345'X\334\361'h\\m"
+	.ascii	"\362'/\013\336\322\357\201\277\232\243:\003\007\213\215\306\366"
+	.ascii	"\262\335B\267\b\362\007{\314\035>\036\333\246v/ \037\315\033"
+	.ascii	"\035~\035\206\263\336\273\3652\376\222\372\364D.\033\026\265"
+	.ascii	"?~Y\363J\021\211x\331Af\246\360\276\n\353\275]T\3748\227c\201"
+	.ascii	"\371\002\006\f\352\323\244&Av\027\230\245\362\337|/+\303\206"
+	.ascii	"\r\352\323\030dwQ\346\370p`\203\005\217\310\225\212\362\263+"
+	.ascii	"6i\316\021;|0J\273\227\353"
+	.string	"K~\336\365@\204\020a\277\024\241>%&\257<\227=\270\354s\r\200\251\250Q4\305\fT\206\206DDd$iZ\003\240\002\231\261\"7\021 \265c\016\221\224\264\324\0011,\264\002\3275t\016J8l\357\263\265A\310\307 \241\327\343`\037F\357\214#\303s\313\306@ AsK:\272r\374\220F\177\271\350\356\266\256w\342\327\254\347\310\220\002X\335J\317\t\345\316\004z\022\320}\365_\341m\344\241\247HK\227w\242\246-\034\361{\265J\303g\001Q:\034\017p\n\300\311E/>\037\031\004\204\377\321uKClm\327Z\241\322\225\316\002w2n\277f'\201G\336\205\227\325u\270\035}O\240\201\257E\322\021\\\373^!\216v\007\003\245\362\b\225FX\270|uH\314\371\3766\273\321\036\003\223\270 \257\27631\033\270\037,\261\035\206%t\330\226\n\026\232x\270R\312\022\223\325q\274\335\036A"
+	.string	"\334<T\b\254\310\255A\232\350\023\n\204|!H\216v\304\326c\257t\323\325\026\356\270\364qQ0\013\226\032\344-\265\231\024\314R\241b[\277C9f\326\274\217!?\r\353\361\360\022<\030\302Q\243\b\025P\240F\027`\246\264M*"
+	.ascii	";\255[\034h\245\023\\4\026\2648\034d]\242U\021i\031n\"e\320e"
+	.ascii	"\035\337\024\323?"
+	.text
+	.section	.gnu.lto_rcSmoothingSplineAxes.99.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"e\n"
+	.string	"\346\023H>0\345(\035\300c\357>\323w\372\0226\017\204{\260\022~\216\255\232\325 \355\322\267\242FJ\267kc\263\331?(\024:t\2341\246\244 \213a\240\r\246$\204AI-\357\330\310&R\246\0248"
+	.string	"6"
+	.string	"6"
+	.string	".\231\223\n\2019c\335\212<\374\266\032\372\244o\034\331\214\206\032=\276\233ge\234mF\323f`\002\240\344\257kj\024U5\2379\247\0255v\334\362\266\035l+\330O\b\177}sY\r("
+	.string	"+i\315\216\211\272!\366\267\271,\333ji\365\252ZU}n\003c\031?{\231s\243v`\302\310\026\022\333#\273\300\036\206\221C\004\rR\200\205\342S.\013\375\226A\337\307]\352~\265\242\271T\236\031\021\300\261\017q_\bY\214I\r\330\2668J\210`NS\203\177r\030\206\337\272t\206H\217\272\364E\334\3457\366:\036\330y\022\035\305\304\003\250\363\300P\327\341\370\253\210"
+	.string	"\273\213\357\003\273X\351\313\362\346\004\362\241~\310\375\365\203\225\273\233\262\275\353Oi\305M\363\220\323\225\373\223*\017"
+	.ascii	"\tK\3408\035_\261\275Dt\272c\371(\270\004_T,\b]X\306\2051\016"
+	.ascii	"3\315\006\313\343\232\233JG\236VA\001"
+	.text
+	.section	.gnu.lto_rcSmoothingIsEnabled.100.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"}\n"
+	.string	"\206SF>0\211*\035D\273\361+^\224i\035 \025\3522F:Z=\003\235\221MH\330\031YA\320\204\004z\001\3208\177Pi\321y\025\215\024E6\320\304U\217)F\350\331\342\364Gd\023)S\n4"
+	.string	"4"
+	.string	"6"
+	.string	"a\246 \367<^\232\036?r\231\360V\017B\340\347Q\362\361\253c\002~\251\024\320\273*\273{\001O\021\370eF.\273\353\f\201\0367v\333\024\266\031\354C\004]\266\354\320K5\331\277VK\266\323Q\323\232\351\314\3641\212\202\006\340W\016vG-\326&\210\b\002\330\356\330\023?Dt\354y\0302Z8\261@*\b\273\001Z\n\237\231\247\f\244bH\252\334\335\217Z\203]\265\300\002\t)\006_F\260\275\235\200F\262\373I\370\003\216\332\370"
+	.string	"\036\315\301\311\207\036}\016\366x\305\220\016\234P\001\326,\032\227i\027Y\006FE&\323\270MfQ\360\246a\301e\033\333\306e\223\260\273\226\234\332\360\274\034\256*\262\035\265\322\251g\325\250\007M\350\262\205E5\371\327+\024"
+	.ascii	"K\b\230P\307;Y\031&\204\001\206\001\316\300v\233 5@M\301\007"
+	.ascii	"\374a\035\027\306\300a\032`,\013\327\036V\370T5\250f\336\226"
+	.ascii	"\2467\241\224\001"
+	.text
+	.section	.gnu.lto_rcSmoothingGetValue.101.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`(\002\025\020"
+	.string	"v]fE"
+	.string	"\261&\035\313\361y\204h0{7\003>\013e\370\317\\\266y\333\034=\312\245[\240~\242hh\335\002\364\254\314\024\364\376\371M\365\023\352'I\273\365\337}a\334\203\t2\302\257\032o~\n\322\204\354\275\245L)Q"
+	.string	"M"
+	.string	"T"
+	.string	";b\003\333\241m\177\365\024#\033\366\\5'\001\253\230\322\r\320\356r\005> \036\276\207\304C\r\361\321#|\232#\237\364\230\003j\217\317{\353\f|zj\230N2W\230\013/1\300\356~\2340\274\324Jv\327i:m\270\265\333\026\331\026\261\263B\266,\001\352\005\264K\272\007\333\2624\355\201\303\247o\3755?$b0\271\303v\221RS\366\337*\315\366\264\366t<\353\177Ok\2463\323\367"
+	.ascii	"\200C\347t\033\263]\r3\035\033\203<#l\217l\020\333\317\263\f"
+	.ascii	"\263\307\356\007\0253v\003\241\277vr\307\305\237\363s\342iJ7"
+	.ascii	"}i\207-\341:+\333\356*\360a<\006\213/\342\320-.y\323\241\357"
+	.ascii	"\022\017\257\227A\311@\301\262\2203\237\305)\224\210\2212\350"
+	.ascii	"\372\302\317\261l\313\033\026\017Q7\036\351`\2633-,b\331\366"
+	.ascii	"\317\354\212\203\315W8',\017L\032\240t)(-\037\356H:\021\3279"
+	.ascii	"\340 \244\230\250p\235h\205#\tq(\302\211\210\233\020\n\2118\020"
+	.ascii	"\327\376\255\322\230@\311DL\"\270\246\272\001\243j*\234\247\351"
+	.ascii	"[_\240\002\241\233\252f\260\255\232\372\342\273\356\022R\006"
+	.ascii	"EMY\345<\206\321\210/\234\025L\325\002/ \360\002\221)\253\003"
+	.ascii	"\020\n=\254R\200\246r\007l)\256\260L\370\261\262R\024\303\236"
+	.ascii	"o7\021f&2\270\345\202\214\f\\rZP\030\206\360\030\300\3360\274"
+	.ascii	"\313\364k\033\254\004\331-\313m\310\rHa\203\373\2235\f\3149|"
+	.ascii	"N\340\003\177\205H+\017p\216\234e\344\2251\270v\364%l\221\362"
+	.ascii	"\255\314\272,\223\001"
+	.text
+	.section	.gnu.lto_rcSmoothingInitializationComplete.102.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"5\013"
+	.string	"\206UM? Q\233\016\037\210\\j\216ad\021&\203\031w\021\324\002\272\bk76)\251\024e\340t\033\2020jO\374\236\247\313\375\037B\001`"
+	.string	"D\310G\005\346\001t\200\177V6\323\203\354-eJ\001<"
+	.string	":"
+	.string	";"
+	.string	"\217P\023\363\357}r\241\241\230\301u\030\036'\016\207\222.\003\234\354n\244\333R!\201\025\035bH:\r\036\370\244\330p\357\331\351\266L"
+	.string	"\rv\327\311u\032n\351\266\035\3306`\177A\005^xd9\262?-5d\037\256\202l\247\243\246\325\351\314\364%\350u\274\205\214]\317\310\306\202\304\023 lo\354\210\0250\330\030\373'\362\f\36088%j\354~\224z8\026RJ8\tl\332\335\212?\342\037\226\t\227\213\364\230z\025\037\362\035\334\007D\217\221\256\001X|\300\3302\304\266u\021\230iw\253\370!\356\221\3619\036}A\223\347\036}\215\364x\r\256(\325EU\021(\n\226\007\027\252\2722\024E\200\255\n\020.\312\202e]T\344\313\256 \247\"x\302\004W\355\330\216:\311T\263j\324snd9\222\242\206\374\253(\204\206\t\250 c\001\022"
+	.ascii	"K\b\230P\307s\262R\2370\\`*\214\006\205\224\300\004X=a\240\367"
+	.ascii	"`\241k8\340\210\0220\221\201\337s\204\366\253B\322k\013\024"
+	.text
+	.section	.gnu.lto_calculateSetpointRates.part.0.165.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\236\001\025\020"
+	.string	"\206]iG\360\260(\035\360\307\223\336\241+\216\314$\311\222\243\271\207k\001T\324\006\235\036\024\361\216\347.\251ms\026QC\365\264\306\236\216e}%\256\356{\206\\\f\260\037\326;\310\001\213i\305\2039>\021\330\204D\262\367\226)\005Q"
+	.string	"Q"
+	.string	"W"
+	.string	"\377\350>\345?\335\247\347\363%l\253`^\3313\036\316\226\343\345C\212\fnw\277\317\370\362\325e\324\271\362O{\307+\306\272\324W\f\303\243$ps\241\343\021s\311\017\225\020\257\323\256\025b-\325"
+	.ascii	"\237\034\tv\327\036\313\335\3356\003\333\013\354\333\b4b\340"
+	.ascii	"v\303\357\323\241\367\230G\373\276\3555?\305\214A\256pc\260\303"
+	.ascii	"\37032\266\361X0\317f\033q3\340}\372\3445\307\0139\036\365aT"
+	.ascii	">\315\036\333\217Q\2016\204|Z\325\376\211\243X=\264\215;v;\334"
+	.ascii	"\324\354n\201O\017\360>A\001;vx\220\356Q\2435E\326\322\234\375"
+	.ascii	"\026\2471\371 L\001\245\177}\372\250(\342!\247\206\fEs\032]\034"
+	.ascii	"\347\345\306\026{\252u\252\337}\016h\330U\311\335X\016\363\205"
+	.ascii	"\210\333\316Be\023\271\262p\266\202\200\304\215\t\334\272\302"
+	.ascii	"\020\253\370\212\023\233\b\bg+\"0\002\216\020J\201\037\204\023"
+	.ascii	"\212\224\022I\024)\245`\204\244D4rr\220\022\225<<\n\215\300o"
+	.ascii	"\364\340\233@\022\225\276\021\210\372B\037\233N$\340Wb2\201\237"
+	.ascii	"^nlq\203\f8(\261%=jK(\351_\006@\303\202\323\212,\307\177\266"
+	.ascii	"s\253\211\321\3056H\247\361\264\337\202NM\206K\003& p\002!;\262"
+	.ascii	"\r\263\216\241\2074B \0337m\331\323]\340\\\025`\220\201=#\212"
+	.ascii	"a\376p\315)28\304\356\205\231L\260\t\273D\345\220\006\244\n\023"
+	.ascii	"\027\300\017\272`\016W\210\337g\262\270m}[\306\212;W)\213\323"
+	.ascii	"\006hKYa \250\275P\034\032\214{W\030\003"
+	.text
+	.section	.gnu.lto_calcRcSmoothingCutoff.part.0.170.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`c\003\245\030"
+	.string	"\006n\236G\300XM:\300\233\367\021(fYJ_\364l\354\242\335\036\213\274\256*\201\302"
+	.string	".\256\225\351\237Y\335>\276\326\213\017X\243\356\001\242\262\275\377El\3330\233\217\302\3453\314DPS\020\311\217\017\355XB\310&r\247\024\203"
+	.string	"\212"
+	.string	"\210"
+	.ascii	"\236\331\254&?\210 [\024\266\335\361A\204\331\213\214\370\250"
+	.string	"\240\305\3104\265;B\220\362\343\211\354\315f)O\304R^\355\322x\212\332]\234O/\b?\355\013\221\331l\373A\3164\263\245\274\021\307\355PUGNU\273+~\332\274\300\367\351}\300\367\2517>\373\364T~3\237\350\023\324\361\242\246\236 \335V\334\223H7\025\327\231\033\315\263\331\335\347.\223nFR\n\370\007\352\354\256C\0267xo\260\365E32\255P\232\365\246\037\300*\f\245\301\217\377w\334=CiOJ\253\224\226\240\364\005\334\234\240\201\261\213b\027feL&<\216\373\241\316D\346 \035#\023%<\234nd\252Z\332x\023\365%C\016:0\342H\001\272\030S\003R\265;\212\237\036C\373\036\272\022\343X\331]\226\177\344F|$\317\231\205K\022\"I\210\244\034`(\204\237P2\333\320\306\325a{\262.$\262\0318\272\022\206jwo>=\301\351\276\223\314f9D\252J\266G|"
+	.string	"4\301\215]\023\026\232\374\342P\247\256\364\202nK\315\007\250\326\275K\212\335\006\241^L\r\312\247\240\236\213\256J\215J\367\032Y\212\214\353\n\273]\027\332n\021\003O\247J-5\037\252\236\"\310\325\250\244Z\312-\365\251\316\\\255\207\221\334\371*\365Gc\354\327\235\354\204\2734\t~\223K\365\370:>\355\343A\036\351\323\367\360}^\237;N\0231^\206\024\311\235T%\353wo\325\206k\2444\315J:\356\220#\"&\366"
+	.string	"\305`B/\227\205\026\017\017Lh\350\3659\020\002\322 \r;?>\031v~\\1\013\"0\364\200p\325\370\225\363\212\211/\036\361\203\217\353G|\305\202\304\234\001\206\001\355\304D!\030,&\262l\313{\2536\374\334W3\226vx4Z\343\032\265N\221\032MU\362\227\226NhK\037\303\211\\\251\214&\331\336\323*\r\317(M"
+	.string	")\2436\007\327w\244\031%\300bE\024\232\022Y\357y8*?d\260\264\245r\312JW\312R\022SG.w7D\250Q0\304\020b\306(\023H0B\223N\345\001`\002\231b\254\003\021\320\265e\2462\355\031"
+	.string	"^!\024\326\330\275\244\303l \023\177i?.\200\201\030\b\375\357\210\001\213h\262\214\254G\223\0014\313\017\266$\315\203\027\300D\335\237\315\263\203\273H\007\232"
+	.string	"\004\307\0237\302\210\307\277\f"
+	.string	"[\020\270%\270\321\307\303\377\262F"
+	.ascii	"\3416B\342\036\017\353\20101\204\330\3344}]U\344J\205\t\334\206"
+	.ascii	"\250\337\314f6\304k\220\321\250\332\253@L\3246\257\366\240\005"
+	.ascii	"\325\320\\\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\021\t5\""
+	.string	"\2669\316?@dN:\013\003\302\343(]\232\2575\320\233c\nH\226\004\256\214:8\32326R\330\261$=\240\232\346\257\253>P\377\377\377\377\277\0332\r\302\317\371\024\277\203\340\366\234\231pt26\221)\271"
+	.string	"\262"
+	.string	"\306"
+	.ascii	"<\372{\322\035G\244\343\201j\216\003\252)4\214l\020G\037/\275"
+	.ascii	"\301A\265\321\237\253\321\277C\243\357\234\321\227KW6\031\375"
+	.ascii	"\270\224\215\321\214\226\3028\334\213\033r\301_-nG\275+\213\327"
+	.ascii	"Yq:\352\261T\374-\005s\241x!\365~kL\272\023}?\251\022M\241\240"
+	.ascii	"\211\276]Z\202\301\214$\232\317\322\021\274E\004\213\251!X\213"
+	.ascii	"\n\342\212>\364\365\244\036x\253\003kq\350\337\245\033>\250\341"
+	.ascii	"\2112d\300\3609\0276\250\367gv\265\240AU\376\220\372\177i].W"
+	.ascii	"7\311~\236\264B\377i\244pB\352\377t\351\306\366\367_'\306J\353"
+	.ascii	"\272\256\023\372x\322\377M\001\002\215\256\322Xs\027\261f/a\315"
+	.ascii	"_\2644\223\20153\2634/\261\364%}5\257^\315X]}F\\\375E[\375FZ"
+	.ascii	"}Gl\377QV\037\322\262O\310X\375?^\373\223\272\271\353J\263\227"
+	.ascii	"\225f,"
+	.string	"U\372\202T\232\263Li\016\223\322<\306\353\272\376\n\016\2434g1\224\276\337U\177\320\223~\324I_P:\245\006u\324\244\337\307\244\037hI\237/e\300`\224\334-\t\213Q\221\234\356\b\2071\302\\T.\322\007d\325\377C\344\207\352\220G\252\272\241\220\027>\203\364\367R }h*\365V\375\321\357\223R\365\371\334P\215P\232\217\276^\217~^To\374\304<C3\036\357\201\246\236\3435\300\332\035o\221\275;^\250\366)\272\347(\2019\347w\274\343eZr\2035\316;\343\361Rq\232\366U\306g\204p\241\242L\344Ksw\347\324eb\331B 3\315\361L]&\247\361&i\262\324\237\233\264*\226\217\007\226\325\346G\313\314\345\305M\316\357\024o\201&;\265=\325\356,^(\366\251\311\006\230o\326\b`\347\212\227\330<]\361r\313N\\\324\006_W\274T\274`\220\032\261\250\342]2c"
+	.string	"gq\312\240\242.G\371\311Y\b\347rQW\212/\\\236\326\330\215\272\274dFS(\370$B]\246\026\216x\227X\346B2\207q\217#^n\262\322j\307\351rg\266&\337\r\252\274\254\226v\246e3,\253e"
+	.string	"\351\260Y\263\331=\345\245\322\362m\3332\274\037\345\235\302r\023\\\236\326\345\224\027\n\373Gy\257\254\242\374\240l\257\213\025\313\fHy\023\264\314\312\373\264\344\324\256.\013\032\225\274Nf\234\242\005>\265\246\222\267\251\217\231Y\310\206\0212y\227\336\030\003\231aW1y\271\217\223|\211\326\234\222\027\310\373$/\233E\363\220\267[=\344\275j\231"
+	.string	"\2331yw\"o\325\033\003\210\022\036\221\267j\311\b\356\376\" o\201\226\323(`\244\327!o\261=\037\344%\276\361"
+	.string	"Ez^G$\337\031\341Z\265\354`\215\257\355\317\343\255j\331\001\364\214\360y\2167\200\215\250A\020\305R-\031IA\312((\244\003\260\002)*\342\034\021\240\034J\r\021\b\021\021\021\t\310\202\324\003\216"
+	.ascii	"\017s\013\316)\313\324\227\262F\032a\323\322\037\315\214]p\216"
+	.ascii	"(\021\336\323\212\222\210-;\352\177/c\252\254uH\364W\271\022"
+	.ascii	"A\323\206\351!\324\337\327\033s\3668=\b#\361M\306\t|*\027\262"
+	.ascii	"9I\3254\330\031\306\3575\362\\\343\357\"\372\256c\177\005\355"
+	.ascii	"C\234\234\035-?Ab\321A\377@\205\344\205\360\035\340E\275\344"
+	.ascii	"\204\251C\017\355\342\374\242h\331w\\\353\350\211h\224\001\230"
+	.ascii	"\311\242\335\326\354J'\232\301\323\276\r\260\357\332\370\241"
+	.ascii	"\264>%\371|\307\211O!\361\252\315J\023\246\200\212]\225\325\351"
+	.ascii	"A\301\fx\347u\365\302\354\025\253Hw\224\352`s\247\300\357P\004"
+	.ascii	"\232\354\351\364v\007\340\204\005\310\302\t\243Q\207 g%\001\322"
+	.ascii	"d\013\261\203\337\300m+\344\317\021\035\n\316\350\247\260\216"
+	.ascii	"\220\337#\300\240\002"
+	.text
+	.section	.gnu.lto_.refs.9c711cad0a037b43,"e",@progbits
+	.string	"(\265/\375`\354\003\265\030"
+	.string	"v{\243G\320\026Q\032\003\340b\263\002(#&&\256^\252\235\025\346\205\236Z\251a\340nv\270~\016\204\027\\\341\005Wx\301\025\276\364\244\001\274\245~\241\272kRHnB(\360\337\366\333\342\262\327\352\242\377\023\322l\333d\313\024\211"
+	.string	"\212"
+	.string	"\225"
+	.string	"\307`\3750X\361_\270\376\207\276\217k\347q\275\355\365:\337>[\275\315\267\027\220O\343\275\314\265\207\252]\246\025\217\351\376\245\025\207u\317b\305\251|\025+\016\312?\3217\255\276[\275T\375\202\007\b\017\315]\366M\r`\207u\373\252\333S\250G\235\376\324\375D\355\337|\357\264\313\226=\266\374\316YJ\233J;\311\264{\245}Tz\221\234\024:\365\355'\357[\272\275\333\027\215>$\332\271\320\276r\256\213\373\356\357\313%\001\334\250\272\315>\320\234\3173\177g\376\354\365\005^O\347\273\320\037\315\337\3275\244\247\021\024\3763b\204\373.Z\310\366W\320\374\217\354m\364u\302\257\205\373M\370\263o'\260z\331\267\307\344\317x\377B\263\267d\317\222\037\200\276K\270\243^\317\002~7?\264z"
+	.ascii	"\353\215-`_\3213\373\206\226\331\027v\314\276\3350\373\262_\344"
+	.ascii	"\333\027\002\373\201x\177\017\321\376\216\320~\016\371\343\200"
+	.ascii	"\355\337\260Q\243\365\007\265\342\003\271~\031r\017\013\370v"
+	.ascii	"\231\356a\274\007\301o\001\367\371\355\246\356I\236\216\351\255"
+	.ascii	"@\177'H\240\375F\220\373>\250\361up\305J\025*S\242\320\037\212"
+	.ascii	"\223&Lh\277\222\371'Ar\344\3337BdH\375\203\374X\375>x\354\320"
+	.ascii	"Qq\324l\320\250\361\203\200f\310\250\373,\352\377\324\357\251"
+	.ascii	"\375\255\266\353"
+	.string	"\324\247\325\276\256\302\234\237\241\3552\362_\364[\340\263\352Nk\\\225\263\273\314?\325}\3167\315/\325\272wu\037\325]T\367P\335e\3359\234}q\276\031\306\242\371r\316\002\317U\006q\257\276\250>W_\300\315M\005q\216&\210\337\350\322\235Fw\034\3723\272\333\320\257\241;\315|\031\335\303\030\017G{\354xl\264\307\354\277n\bNo\317\007\366\330\355O|U\244@\221\372=a\242\004\t\237\337\021>\361\025\021\002\304\007\017\035|\366\345\260!\365\253!\003\206\013\026(\314_\b=\3736\2302\177)\362\177\302\3633\221\267\333\357\302\366\263\260}M\3569\362o\344^\263\363\341\316\017\220;\314\216\312\366`l\037\305v\316\266\001\233Cp\217\201\007H\250A\\$4T4C#\321H$q\033\220\"C\024\230m\020\330\324\001W\306b\277k-+\212[r\307pQ\rY\264F\320H~\367\251\022"
+	.ascii	"\314I\250\317\265\3651G\211\350\351ACO\340\017k\274\341\367;"
+	.ascii	" \2328\275\325\370\272\342\221\201\326m\270Y\202p1\024lb\273"
+	.ascii	"8\260\254\370W?E\211W-:@\2710\262\023\302!\323uq\300\022\213"
+	.ascii	"M\034)\212\030*\316;\346Z\302\2425\327\351[EQ="
+	.text
+	.section	.gnu.lto_.decls.9c711cad0a037b43,"e",@progbits
+	.ascii	"(\265/\375`\006Y-r\001Zg\"\206T \fY:\215\001\272\375\265\222"
+	.ascii	"\272\0168\271]_\217\032\226'!\217Z\3169\r\214S\250~\244\033'"
+	.ascii	"\312^\032\312\252\314\346\013y\211\243\016\016\243\367\0069\340"
+	.ascii	"gW(\363i\013\200F>x\231\r\263\342\007\362\240Y::\322\320Y\312"
+	.ascii	"TUuK\262\267\224R\246\035\007E\b\302\bI\364\323.\375tJ\037U\243"
+	.ascii	"\217\276\351\347\331\241\364(\027}\264\251\217\226\351\243a\372"
+	.ascii	"(\230>\252C\037\235\322\317m\364\263\030\375<E?;\321\317D\364"
+	.ascii	"\363\r\375\334B\037\353\351c9]\204E\037\037\321!\330\241\364"
+	.ascii	"\230\206\376\235\243\177\311\350k\261C\351/\232\356`\205\322"
+	.ascii	"\267\331\241\364\277^:r\032\025\035\033\307\315q\271,\017\325"
+	.ascii	"\234\032(\334|\231v(-\262B\351\275q\364\213c\307J\0309`7\013"
+	.ascii	"]\033]+\270\270\242\334..4\037\031T\302l\334|Q\2704l3\303\255"
+	.ascii	"a\027$J\353\346_\246&\301\3366Cj\373\372l\206\364\27732\374\234"
+	.ascii	"\254\351\370!c\003-\305\305\312\330\226\226\217Y\324\262\353"
+	.ascii	"\346\377jei1VH\370n\276XW\351d\217\352\346_%\372\277V\266y\257"
+	.ascii	"\356\344\331\033x\230\310 \262\345\346Ku\253\376\003-\024\034"
+	.ascii	"f\312n\276/.\f\333<\333\215\001\224b\356\263\275\367On\342\302"
+	.ascii	"\f\223\233\177\301\364\323\336{\333\263\245\277\276\276\276>"
+	.ascii	"{\266\364N\335\371\037x\263\324\324\305\271\371w\327\305\177"
+	.ascii	"\340o\205"
+	.string	"/\257!\315;o\324\257\324m\361l\346\245\\\356\275\201P\2543p\332n\356`\207\322,D\377\027\352*\177Q\254\272\250n\336\366\313\235\367\216\251\313\221w3\217\025J\177\3337'\235\322q6\206\357v\316o\311\254\234;\257\327\336W\366\336\030\364\213;9{7\333m\207R+\346\350\226/\001Dz@\211\303\201I\303\252\307\236\336\017\032\034)o7\377V\317\346a\252*\257\215\26673\210'J\215\265\346\315p\210x\350l\240\251\335\374\213\202>\210\377h\205\267\337\256\261m\254\033\213\306\326Y5\226\215\265\263O\373\306\322\3314\026\3176\355\2355s{\306\312\3752\367\226r#c\307\370\340\275\241\320,-\231\225\274e\23075\317\275\367\321\355\235\335b\323,\\\220\006\214\321=\231\377\321\235\205\263c,\034W\206\222\306\222\335\3312\253f\341\202\3441=\033\245\314\334\0270k\226cs\326i\341\270\022"
+	.ascii	"e\357\2717\363\226K\027\333f\341\270\022\020\306\346\271\367"
+	.ascii	"~\210\377(\316:}\360\3369\306,\367f\036\304\207\020\366\316j"
+	.ascii	"\261\316\rQ{\347HAC\334\033\254\256\274\275\231\034\020q\320"
+	.ascii	"\303T\273\261\265!\337\212\321V\213\035J)\260B\351-\232\276e"
+	.ascii	"\352['\372\266\210\276\355\241oS\030\363[1\326\315:9\200\004"
+	.ascii	"\353\252r\363m\rMd\207Rl\205\322\243\331\241\364\326J\037\316"
+	.ascii	"\016\245\226\315z\261M\"\253\302\376\261e\242\256p\334|\353B"
+	.ascii	"\227`[\242\364}\226(\375\252"
+	.string	"?g\207\322\253\372O;\224\276\002\332^\261Xl\223\203\315\362\017!\216\225f{lo\346O\317\234's\342\334\374\022\372\226Cj\373,\207\364\037\364o\247\334\252\375V\212e\3324\353\265\267\324\336\033\303\317\033#{En\266g\226\212mn`\321n\315l\224\243P\314\315\334\233\371s\211\310I\233r\363\005\240o\253\334\002\324\016\361\036}\273A\212\373\372\354\006\2515;\272\235\362[1;&\224fq17\332\336\373\007k\361\342\202\357\346k\205\322_\355\201\035JS+\224\002\331\241\024\310\n\245g\332\241T[\241T\003\031\270\025d\335\302\217^\260\201\243a\260\037\033i\342\3713\231\337rA\323\363\243\\\266\034\355\3129\177;\304\305\024qM\342\263L\371\355\211\037\027/\0030\220\337\002\235\315o1\034\315\377\273\023\341\037\377\263\334\202\037\225r\335\304\376\373Q'?\226\200\217\377\022\375W\303\177)\370o"
+	.string	"\220%\364\3701\006x\334\237\377\032"
+	.ascii	"\177\375W\312\325e\273\373-\036V\261\343\267B\233\346\307^\277"
+	.ascii	"\235\263g\n\200u\374\326\204\377\206X\363?\313\363?\232\233}"
+	.ascii	"\263ql\223\0040\n\234\343\3076~\334\365\013\374y\003;p\r\002"
+	.ascii	"`\032\277%\336\022\216vu\242gy\007?\252c\352\2671~\254c1\330"
+	.ascii	"-"
+	.string	"+\003\377\240\360c\340\214\337Z\375\366\312be9\232\361\256 \3022\376o\260MR`\027\341\317h~\254\200\255\037;@\313.a\030\303Y?\306\272R\256F\260b\202\253~\273\305\013\227\"\344\375 \003X\324p\214\377\206]3\023~\264\005\007\276\3016\025Y+\032\240\245 \233\340GC\360[+\277\305r\345\267i\277\325\362[\247\375r\235\037\375\300\177S\300\370q\005/~k\342\267\034\370\255\212\337n\331\200\352h\352\267d\277]\373m\224\037\203\340\342\177\026.l\277]\372\255\222\365\362\3336\334\"\305\006\025\330//\300\2172\375\030\n,\377h\360\277WX\371\333&,\013\360\306%\370\357\004p\0070\t\376\353\002\217\340\277+\360\004\"\370m\007p\b~;\304 \370\237\201\r4\270>\276\b\360\243#\374\026\203\265\340\262\271t?>\341?\221\006x\305\1779\240\375\302\237\211\374\367\210\233\376\013\347\277"
+	.string	"\300\307\353"
+	.string	"l\334p\241?\273\325\375\367\315\217\231\376g\261\301\037\027\377\373\001{\340\033>\364g\261[\201g\301\035\370\257\t\272\377i\366\347\277\020\270%\356\bD\032X\240\2478\006\177\236\372\317\237K\360\277\356\277\233\377Y\376\267\371\377\366\037\316\3656`\342\177+\340p\240?\237p\t\034\377(\002J\330\b\361"
+	.ascii	"\256\243\0274\b\360\333[\373\024\377\235\361?\375Q\001\374x\370"
+	.ascii	"\343\r\3748\003?6\341\307\023\3701\t?&\361c\021?^\300\217\r\360"
+	.ascii	"\343\002\374\370\303\2179\370q\321\217-\370q\206\037c\370\361"
+	.ascii	"\205\037[\3701\320\217u~|\377\233\367\3377\377\265\373/\335\177"
+	.ascii	"\321\374W\356\277q\377%\363\3371\377u\373o\230\377~\371\257\n"
+	.ascii	"\377e\373/\227\377\256\375\327\350\277\316\377b\371\257\332\177"
+	.ascii	"\233\377=\373\257\331\177\231\377%\373o\330\177\233\374\027\354"
+	.ascii	"\277X\377%\362\337 \377\365\361\337\257\377\352\370o\n\377\265"
+	.ascii	"\361_\256\377\322\370\357\214\377f\375\367\305\177\247\376+\365"
+	.ascii	"_\345\177K\360\337\021\3747\004\377e\361\337\025\377]\377k\374"
+	.ascii	"/\362\277M\377\365\300\177\225\376;\374o\360\277\033\370o\006"
+	.ascii	"\376k\201\377\226\360\337\n\374w\002\3775\361_\b\374\267\304"
+	.ascii	"\177\037\360\337\021\376+\342\277\f\370\257\002\376\213\200\377"
+	.ascii	"\006\340\277\006\370\357\177\273\367\337\002\3747\304o\335\376"
+	.ascii	"\373\301o\333\376\373\341\267\025\374\227\363[\f\277%\372\355"
+	.ascii	"\377\303\371\257\007\377-\372\257\006\377\005\300\177;\374\266"
+	.ascii	"\351?\332\377\024\377%\360\337\n\376\313\341\277\033\376+\364"
+	.ascii	"_\373\3338\277]\363\333\267\337\202\371\355\227\337\312\370-"
+	.ascii	"\326o\223\277E\376\226\351\267\026\374G\361\333\f\277\025\372"
+	.ascii	"\255\205\337\006\375\326\376\237\363\337\304\377\274\377{\377"
+	.ascii	"\365\376o\375\017\363\277C___\337\3573\342\017\"\361\037\240"
+	.ascii	"\030N$x|y;\213\331\301\201\372\322\322\256\322\006\355\r5\247"
+	.ascii	"\245M\3236s\363*\211\230[\371\323F\tTF\377\231\212mf*v\016\t"
+	.ascii	"^PHB Sru\360s\003Uw\243\255\254,O\271{\357\275\3745}\250=7W"
+	.ascii	"V\321\237\315\236\247\234.\016\236\032\223\233\177w\266\377\300"
+	.ascii	"\214\302\232\230\233\231\024)lu:8V\220\241w\363\201\214\350?"
+	.ascii	"\22353\231\325#2\333[ \350\303\322\222\267w[\007ZM\032_\334\315"
+	.ascii	"\007\222!&v\257H\330{+\231\033k\303\032\022\\\246\246K\213\233"
+	.ascii	"\3773G?1\202\305\313\363\346\377\260\321\331IO\336\216\034`4"
+	.ascii	"sGK\216\264\0317/A\362\321\354r\363\177\326tN\202*\271\256\254"
+	.ascii	"n\376O\025\375\347!\317`y\231\177\350\215do(\264To\007\036_\336"
+	.ascii	"O\230~&\222\213<\033if#\371\210\335{o\256\255\204\223\252\240"
+	.ascii	"\304\343\313\333\\\\E?^\230\214\361\335=\0379\035Zf\311\021\265"
+	.ascii	"\233\377\003D\377\366\367O7T\326\336{\013e\356\254(\236\364\267"
+	.ascii	"\267\250\265E\177\217\305\026\203\377y\357\005\004\367\216\272"
+	.ascii	"\013\333{\3337Z\211\023\352F\207\215\302\355-\365\245l\300\227"
+	.ascii	"\026\325\331\227V\020\225\324W\r\252\263/\255 \252\263\257\255"
+	.ascii	"\224:\242\f\312\332_J\252\263\275\203\366\336{KI)GxiQ\235A\355"
+	.ascii	" \252\263\255\265[\224\321\262\233\371\245\334R^;hKm\250}\346"
+	.ascii	"\245\325"
+	.string	"\201J\352K\213\352\fJ+\210\352\354Kk\237}m\240-\005\225\365Bjg\005\355\263\257\272}\346\245\005Du\346\245Eu\366\025\305^\275\330\213\"\343M\030\2209\273\203Jj_Y\341\200\312\002\202\243bz\355\271\275-\232\213\235\265\341\366\306`o\034^YsP5\254\226(\270\253\250+P^\226\271\367\316`\025\305\303kK\301)\355\206\243Z\342\265\367\222\250\245m\265\367\336\037(\231p[\210\205S\366\300\261\253\\\354M\301f\356m\265\267\322n\270\275\267r\357\375\313\302\301\334\333\006\020\325\322\312jo.\"\253\215C\271\346b\357\213\226F\213\026\325\031\017\257\243\265*g\313=\305TZ\252*\257\275\334s_Y\372LY\266\253\366\336\326\215^j\311\260\273\371>v\372\317An\2339\b\376\002\244\332\033\224\341\361\265\355\254\254\016\356\223E\377\031H\376\261\302\322I\324\315>\200@\326\324\215\211\222y"
+	.ascii	"\275lL\201\272\371>Mt\376z\017\206\242\341\346\274\331\213y\201"
+	.ascii	"\313\311\325\315\3671\242\313x\322\274\301\202\306<{\223;3w\363"
+	.ascii	"\237S\3106\336\234\200\321\273\371\267\005\215!\313\032w\372"
+	.ascii	"H\001\355\030QB\226\271+\343\3107l3\333\310\\\331FF\341\316\026"
+	.ascii	"e\003`\202\304\256\313\017\024\017#Bt\276\017\225\276\217\013"
+	.ascii	"}\037)}\037(\375\347\031\331\212\215\032\245\362\346\203x1d\331"
+	.ascii	"b\252\b\323\205\221g\266\312QaO)\260\0266\315\007\nhK\2658\262"
+	.ascii	"\314Y\031+_e\255\274\225\253\262\f\333\314V\031\306s\f\273\026"
+	.ascii	"%[e*\233\346\003\305\334Y% \001\263\013\333\233\371;\243\213"
+	.ascii	"\261\006\224}\254P\372\236:\375\2362\372=[\364{\320\364{\226"
+	.ascii	"\350\367\004\321\357\271\241\337\023C\377\031*+\345H-\365\346"
+	.ascii	"<+\177\334\227\367\345\262\330-KM\213\233-\323\016\245DV(\305"
+	.ascii	"r\216\216\347\240]av\020\271y\207/\216\316\215\2629p7\3571{\262"
+	.ascii	"\254P\246v\363y\362\364\177\234\207\3610\034\333\304z\370\251"
+	.ascii	"\207\353\360\035.\313\322\315)] \332`=\3650\235u~\240Dy\346M"
+	.ascii	"^:\204J\2178:c;\354\3066\213\360\033\346\017\017\024\215,dn>"
+	.ascii	"\317\232\276-J\177\212\322\3634\365y\226\350\363\024\321\347"
+	.ascii	"\331\301f\r\0251\"fn\376\217\325\3404x\016\243\301r\266\211\327"
+	.ascii	"`3\307g.\221[\346\336Rp\267\316\302qme]\006\\\312\300\354\362"
+	.ascii	"\310\334\b\021\327\265,c\235>J\240\035e\306\306ro\346\032\274"
+	.ascii	"\202ub\346\362\327\364\301\365\334\233I\364Sk\"\267\203'\243"
+	.ascii	"V(=\317\225>O\013\375\235<\375\2353\372;k\372;c\372\307c\336"
+	.ascii	",\323\353\211\034\267\343\267\313e[\320Y\355\335\214\305\034"
+	.ascii	"\035\273\371h=\241\242vsP\03061W\264n\334\374c0_\356\231\030"
+	.ascii	"`_7\267\355\360e\351;s\363w\202\350\337\0265^\334\261a\024\316"
+	.ascii	"\346#\005\264\245|\304X\303^0\027\254\002\336\202\273\330&f\303"
+	.ascii	"e\307fx\312\207\020\230\r3o\035f.\177Ux\364=\357\3300\r*0\330"
+	.ascii	"0\027\226\202\313\262&@\205\352\336\035\263\3413\254eF\006ke"
+	.ascii	"\267M\fM\235Ov\246i\312\340n\334\374\235*};F\205M\225\263\341"
+	.ascii	"\262,]\205\307\232\333\003[\301i6\r3\265\350\251)tO|\005g\301"
+	.ascii	"X\260\232mb+\030\315\nn\336\211\313\262&p\021\007\354J\303\243"
+	.ascii	"\206N\376\016\225\276\316\032}\2359}\2352\372:o\372:lZ\207i\207"
+	.ascii	"R\033\304\n\245\327)\323\327\001\323R\242\240Y\366\2704o&\313"
+	.ascii	"\240#EM\337\330\315\327\241\241\261\030\356\302;pY\026\020\006"
+	.ascii	"\217\275'\024<f\233X\f\177a1\314\003?\261ph{oy \005\t\230]\006"
+	.ascii	"\016\356\034\030_`\322\034\246\261\f\341\341\344\346\003\323"
+	.ascii	"h!m\317\037c>\242|9\n\322f\344\215H\223\036^\276<\201\210i\331"
+	.ascii	"{+\301H0\023\334\004/\361\022\354\004\037\301Il\023\203\341\""
+	.ascii	"`xH\224\266\347\336{\207K\013\325\334\205|\240\234>\260M\037"
+	.ascii	"\310\246\017\334\242\017t\352\003\257\350\003\323\364\201U\364"
+	.ascii	"\201S\364\201L}\240\022}\240\r\355ET\202\\\224\0327\037x\245"
+	.ascii	"\177[\340 ;J\001\333\030\323\201s\330&N\001\337xfr\300\001\021"
+	.ascii	"\360\311\2160\027i>\260J\037\270\365\365\236\276~\352k4\372\272"
+	.ascii	"\213\276\206\242\257\201\350\037\317\3002v\306\336\266\236X\013"
+	.ascii	"o\245o\332\222T\2719\205\263C\351\327\340,\214\245\365\345\b"
+	.ascii	"\027\306\372\357\335\305\303W\227\0035/\256\334\214\255~I\262"
+	.ascii	"\220\271\335|]C\223\301i\222\346\311\267\345\355\231\207fi\311"
+	.ascii	"\256\336\334r\357\215\241\324,1\025\256\3020\360\013\034\205"
+	.ascii	"[\340\030X\n\273\260M<u\373\2167V>\203\230s\303~\211s\247\017"
+	.ascii	"p\357\266\"Zn\213\377H\316\235\026\016\315.\307\336@\340\251"
+	.ascii	"\273w\247\217\024s\027I\325<\373\360\362\366\336D:R\244\2128"
+	.ascii	"\271\220\377{\352\353e\207\322\f\340\364\177o\372?1\372?0\372"
+	.ascii	"\2776\375\237S\377w\246\377\023\323\3771\321\300\2547E=zg\242"
+	.ascii	"\302\334\324\211y\341\201v\363\255\273\367y\355~\353n\233\177"
+	.ascii	"\bq\036\251[\227\367\206\262\366\002\037k/@\331\214@MI\363\177"
+	.ascii	"`\372\277tf80]<o\276_`i\222X\262%b.\221\"l\226\367\353\207\336"
+	.ascii	"\362~\r\241\273cd\326y\345\331\302\310\232\377\272]2\027\315"
+	.ascii	"\315r\343\356\334Ms\317\334\265\313\346:\357\226\273\346\302"
+	.ascii	"]5\227\313]\341v\271e\256\n\367\355\206\271r\267\355z\271lW\314"
+	.ascii	"\035s\277\\-\027\214m^3\327\312\357\225\213\305\2225\001\263"
+	.ascii	"\334\233\371%\244\315m\021\326\366\274_>\366,\231\022\267\036"
+	.ascii	"g\326\231C\312ro&\224,<\342,\357\216)\327\fM\f\313\221\231\333"
+	.ascii	"\274j>x\357\036c\3130T\242\254E\261N+Q\2368\237\\\244\2501\257"
+	.ascii	"Y\232%s\362\345i\311\230\204y\356\315$C2\347vD\315Q\025\262\347"
+	.ascii	"\375\272f\356\022\315\363~]3\027\310\306m\366\036^\330\336L\""
+	.ascii	"4\356\214\234\025\032\220/\234\035J\007\220\245\377\233\366\253"
+	.ascii	"\346\344\300"
+	.string	"OI\337\225\335\315\027\355\3507\255\002,lk7\377\254P\372\037\f\3754O?=\243\237\206\321O\241\334\262L\303\315\307\221\233\237\006)\032\233\225\265?\b\263f\327%os\315(\372\323\271\247h\234M\246\260Y\2739\225{\231\217\26527\247g0\310\0323&\215#\362R\272\031"
+	.string	"\331\2163o0\f\256+7\342\312d\bC\263\313\244dd\274\200\"e\217\331\204\203c\003\016?\353T\3201\305\347\346\2062\211\274\224w?\032UG\370n\230+\347\332\315\277"
+	.string	"K\332\226\266\245a\322\226;^[f\254I\301<\r\223v\371\201\3351\347nN\277"
+	.string	"\313\306t\211\335l\266\266\226z!\362R\326e\360Ei\327%\257\315\221\030H\330\236z\271\\;j\352\304\342nN\267\244]\356\230\035a\212\244\\\260\031\024f(\271\371\027@\321\277\273\\>\3137E\2247\377\202\245\332\325R'\221\227\022/\345\253\032\362\226\327W\007\307\227\345\251\323\212\231Y\363\343\346\337\245X~.\226\310\240\202\345\n:\003\306\033,\037qk\276\200Y\311\\:W\372\314<o~\0079449ftms\316xas\363;\254Q\241\222V!\362R\326\t \253\212\207\030 {di\322*\231\211^\227\227\234\233\337\001\214\311L\247\250-}\346\240\t\263\315\236N\321\241\302\347c\315\315i\231\227\230X\032%l\247\t\027\2715\262\247Qx\250\240\356\310nN\307\322\037<\322\320\320\350\020\343\311\2234\t\221\336dS\320\236{s\025\355"
+	.string	"\301q\346J\316\222%\251\023\"\275\311\342\244<{\270\220\225\321k\362\324\211s\307\\\027\220\233S&m\212\024I\223\244-\267\314i\301!y\232$l\216\025\024nN\215\244K\036\031;\362\234K0\214\304\310U\r\257;1\272\250#\370\306es\325\206\317\202/\351\220tH\032$\216HS\r\307\215\233o\001\225tG\272#\r\022\002\256\017o\211\206]\025\220\247A\314\252\300\350\335\234\362H\177\250\360B\212\234\364G\352c\255G\020\2500\036\276\033vr=p\021\274\344\013\n\334\315\351\327\235mfX\236S\267"
+	.string	"\354\306\215T\207\334[\317\036T\332[\216\247:v\346\330\325\200\2729M\301\246i(yA\226\334\234\342\260:j\332\204\331bQ\036xk\2347\337\202\255\256\256\314\026\307\216\256\355G\243\007Z\02674h\2445\210\274\224uEuS\234\344\300zX\226\274Hk\3304\035\"e.v\334\374\n\312\2443\322\031(\363K\234\223\034yY\217\211U[\226\255\255\024\206SG\312\030\237\362\346W0\226V\245UiV\\\033\004\310\334\325a=\315\3228fd\301\2739\275B\333\242\272\204\334\234Z\335\231\245l\216H\220T*\225Ja\020\211e\365\341\241A\230\340\030{\361\024FN\303\205\215\331\315i\213\224\352?\360\007\206\335\n\316\224*\235\322Q\004G\030l\365\363d*\207\222\324\305\355\353\211BW\365\254`k\357\351\336K\241\354\235en./\245]"
+	.ascii	"t\204i3#oS\341(R\372\241CL\252|\n%&\355\243\242\345\013\235s"
+	.ascii	"\264\357\007\376\344\314\2041\273\371\034\300h\224\357\250\234"
+	.ascii	"\037\210\336\220\241f\311\315\347\300\246\1774\316\017\344\t"
+	.ascii	"\"\346\315\356\346sp\352s@\303\303C\363\254\331\306\272 \305"
+	.ascii	"\215\232\261<\237\270\0370b\3009\232\027\305\244\b\226\233\177"
+	.ascii	"\227{\374\007\366\204\2611\323\205\343\315\033\324\316\0021\243"
+	.ascii	"\314`-\367\346*\322\312\262\031K\264\236O\324\316\232m\254\r"
+	.ascii	"kd\354\272\344\355\315Ut\001\263#vuG\355\234\266\231\206\f\027"
+	.ascii	"g\226'\034\\\240j\324\240t\326lc\035\311\220K\022\2667W\021\217"
+	.ascii	"\224\2752dl\216\322\365\334Q\201\213\262\346?0}\303\342\333\333"
+	.ascii	"\320\206\242A\321\240\314\037\2232<\276\260,&H\224\256\233\277"
+	.ascii	"\241\211\0313\250\0340\001bW\313\035\032r"
+	.string	"nkg\216\312\375\334\360\241%\265\341+.\356\247\243\f\217//C1{\322\270\371\033\254\310\220A\277\256\327\336\333\305~Z\341I\232\347\346\342*\342\301\023\253;s\3635\300A\307\240c\332\234\364=\227R\236\300\271\371\032\316\270\271\241L\340]\332\227\312\305\310\321w\3635\260\241a\3200x\251\2342\027\317\"d7_\003\232\376\255\263\350\027\364\313\255\263\314\215\365\303\332\241\001\212\376Q\025n\233\250\n\031J\221\327\226\221\201\nHP\275\251\257'7_\003\233m\242lY\211R\355\275\325\201L\203\fm\233(\227\034F\344\265e\f\200K]~r\201\262o>\005q\364\217\256\331&\272\206\337\212\274\366V\007&qNr\3445\331\322\365u\363)\200C\235\250S\214L\017\220\032l7n>\005\316+\350\024\024Kf\2227\332\206\332\n\341VG\301\230>\005@\322\246\240jvN\003ZPm\250$\002p\243"
+	.string	"\207>\005XU\320\346\255\353\240dn,;F\211\307\0276G?C\032\375\243g\350\2247\004p#\223!\214\231\031\372%"
+	.string	"\267\035^\364\320\302n~\0063)RP&pg\271\271\340\213\322'\006\033\227*\246\022\036U7?\203\020(PP2\005p)\373\365\260\313\0017v\224\f\t\036\334\326\315\250\030\272$\205%u72X\205\205\241M\264\222\r\214\245\220!W\313\233O\364D\221\240H\320&\nP#\344i\315\254\021B\20729\332\344\310\2145mn\376\035\272\344?\020"
+	.string	"yr?\226\240J\364\252\224I\265\3516T`{7'\301eL\"\037\275\027ekn>Q\027#FP0\273\263\024\240d\007\216\"[\3454\243v\344(\330\255\323p\216\254\271\021\221\r!b\347\344\035\004hK\311\315Y&\321'\352\241\177\024\b\312\003\rb\347\330\r#\013\250\326\224\363$\232\241O\244\324?\332\003\345\201\372\270\\zk\3211\246\3720\314\351c\270\202\356@w\240_E}H\360\370\362\200rS\226u_\326\211F+\214\354\346c`\242C\307\235\231\271\213\374\234Z\030r\340\300\201\2460f\271\271\270\212\320\037TK67\243)8\201\\D\262n>\006)\0336\300\350\253#4\240\352\270\270\260\354\314\260Z\201\fJ\003\245\201\316"
+	.string	"\332QqR\226D\272\330p\335\374\t\232zk\013\235A\302\336\340D\257!\343\306D\306\321\031N\0365\262\276\266\t\234\2401\320,4\006\212\245\001Z\205V\241X$(3\350"
+	.ascii	"\322e\235a\335\374\243WG\261\330v\270\344\252\234\334\214Z\235"
+	.ascii	"\3152Y\033\262\246\356?\220\007\306\026\227\0347\177\202\035"
+	.ascii	"\372\023H\351\037}\201\276\270JL\265\267V\bL\326\330\350\037"
+	.ascii	"ua\233\250\013t\212\004/\250\255\f\334@\321\265\371\340\230\262"
+	.ascii	"\212\343\005<\343&\005\264\233?d\246\1774\352\016\225\272\263"
+	.ascii	"\001/\366n\033\222\352\330\201\307\2277\324D\177(\210\376Q\245"
+	.ascii	"m\242J,\203\004\240\275y\024Yv\351?\367\331f\356\303X@\252\275"
+	.ascii	"et`\202d\350\205\0349\326y\274w\2169\313\235\325\326\001\002"
+	.ascii	"\332,\201\273\371\027\334\304\211c\323.sg\245\316\262\266\016"
+	.ascii	"\254\r\260\27697\377\302\233\376s\336]\326\273u\r\210\332;\207"
+	.ascii	"\225T\307\205-\372\027\316\360\360n\2355\333X\277\2512qc?t]n"
+	.ascii	"$\271\371\027\276\336\374M>r\240\275w\252C\211\307\227waK\377"
+	.ascii	"\331\256\231\355lZ\221\027\024T\006N\276\244t\341\321\226\243"
+	.ascii	"\305\315\027*\303"
+	.string	"&\267a\223\237\351\336\226\351\205\225\265\271\262\212\236tty\312\335^D\204\254\350\013\031\321\317s6\247Qsg\007)\240\035c\312j\311C_\250\206\276"
+	.string	"\260np^\240\271\371y\005\233\317\274e\271;\2652k\002\030\315*!+}!\245\276\323^\251\275\241"
+	.string	"\360\343\203l\016\205\233\237\341l.\363\226\343\2543o\256\255\264\363\240\316B\032}\013k\372\326:\323?\217\271m\3461Y\3115\333J\2356p{xZ\352\f\324\325\315\267P\346\346\226\217"
+	.string	"\241\262\340C\377\031L\366\222\303\\\035voeA`J\314\323B\f\375\2406\372\317*x\311mg\323\312,\2556\025\346\271\263v\007\017B\243\037D\206\013\227\314\026G\013\217/\257\3133\033v\033\242\344\314\246IQ\302\365\343\346\007\225\255\255\335\256\243R\273G\330ro\256\016z\220@\241\022u\363\203\304\364\237\235\377\207\020\266\231\235\326i\3156\226\316\324\026\221\255,\247\315\031!7?\250\006\026,?g\020\f+V\256\026\021so\355\004J\304$\343Q\304\023RG`\210\004\372\001\223\214D!R'\002\253\252$\364%#\017j\262\204\232$L\026\211\302$\240u\350\204\\\223\306\243\210\017\350\254\301\017GO\304\244\037\213b\023q-:\231\370"
+	.ascii	"\360KFNLD\026HG\007\034S,\255H\341\b&0!\217II\243\020\231BU\221"
+	.ascii	"IHB\225\004\343\221hD\252\253\320\251\002NLD\017,V\342\n!\362"
+	.ascii	"\001\304\325(\002\022\261i\350KF*\023q\365\220D\252+\210H\244"
+	.ascii	"$\261X$2\245>G$F\260(65\211pa%\032K\030\211\302\007\364\f\221"
+	.ascii	"\240@\004V\242\261"
+	.string	"\204\020\t\nD`\210h,\201Dl\332\220\324\024\001$bS\005\253\372\200'$PQhT\"\242P2\022W\020\325\241z\"Y\342\t)\264\022\215%\202J\020RW\241SQ\270b\204\241\242p\230\\\211*<8\031\225\b\360\344d$\026\t\360\001\bA\020Bx\362\240\"9\025\207F\242\007d\322\311\203\207\023\216\310\245\365h\374%\t\325b^\223\306\343\020MZ\215Dd1\375\222Qr\004\023J\244\020!Bp\204\021\0230\021\024q\"\210\242DP\3628\324y:\"\233\232\204A#1\251\363%#\017*\322i\025\252I@\352\252\026\233\230\216\".P\235\212B\023V\365\001B#$K\\H\252O\"\f)\031\211\024\030\236X\211F\"\320\211$\021(I|\022\341\004\341\005x\222\310\343z4\3213$\342D\223\223\007\216\307\"\020\206'\344\020\231\002Y\b\301(i\342\351\004\022\261(\\qA\307"
+	.string	"F\302U8\342\351\304\232\024\026y\200<82\022::2\362!\022q\\\235DP\235\230\234\206C\0216$W\025\005\022\261(4A]\205'\236NL\240\363\341\310H\005\001\021E\223\272\242\030\"{@\034\031Y \372\340\310h5:\035E4\251+\n\rNFu]E\030QbU\2252$U\210`\341\304\252*\375dXU\245\237\241\023\303\242p\270a\204\272\nOL\360%#$b\223\007\"\225\211\2706\035\217\021@\"R`U\225\220\3025h\347\003#\024*\0231E\262\307\2078\244\256\302\023KI\025\231\244\236x:qa'\204\021\261\347KF*\3628\034:A\225\200p\025\216\260\300\211$qgx\"\231T\207Gd\323\317\227\214\206A\225\211\270\032\235\220\036\206I\026$\225\204E\022*\322\321\304\317\004\036\030\255Ha\223Q\222\003\360\310HL\356"
+	.string	"?\030\221H\036\207;\023\2000Z\223\302\"\021\223\272&Y\240\370!qL\241!\003\bFI\247#q\205\212\244\200\006\264"
+	.string	"FO*\222\221\370SW\341\212bU\223\352\t\344\021\211\034!\005\362H\302\002\364KFJN*T$\017HE\242\223\212\f*\322\321D\222G'\251B\204\037\343\221\270\016\325b\222:b\210\344\001\252\253\360\304\252\242PWa\321iX\024\016\207H\250C\341\t\n\210X\215*\022\3514\314 \\U\007\\X\3275\2304\261\366$O\250\253\020\251\311\t\350C\"R5\252J\372\037\200@"
+	.string	"\020Bx\372=\204\003xp"
+	.ascii	"\017\322\207p\200\243\243\003\200p\244\017\302\021\366\300()"
+	.ascii	"\311\311\001HF!\023\323Q\304\020\371\363\241\221p\025\216\370"
+	.ascii	"IR\221\202\301\365G\r\"\225x:\252\370\255\301\017 \226\214\222"
+	.ascii	"K\253\220\211\002\344q\035\252+\202MI@\013\330\013X\f\330\021"
+	.ascii	" \326%%b1\t\350\204c\321gI\211\270\364\203\004\242(D\256N\252"
+	.ascii	"\021\030D\002!t\302\261\270\263\244D\\\n\"\201\340A\002\241\""
+	.ascii	"\035\231\202H\352\322p%\236\220\374Y\277d\304\002\251\256\253"
+	.ascii	"P\205\207$\362\2304\252I\016kp\325*\0231\305\212\024\256I`2\250"
+	.ascii	"$\\\213G\023N8\026- \251E\025B\243\372S\225\204:I\021C\244\005"
+	.ascii	"}\202\220\005\017\222Q\250\002I\250\"\005\251JkR\230\024D*\036"
+	.ascii	"\227\202kQx\001IM\"\325\025*2x\202\220\305\205u}\0222\341d0\205"
+	.ascii	"\006&\247$^\215N\307!j$2a%#\321H\024\"W\235\f\n!\251  \026\205"
+	.ascii	"\304\225h,\021\264~\311(\031\334\260~`q\223A\037\017T\334#\025"
+	.ascii	"\367\203\212{$\274\037\204\367\350\351~x\272G,.\222\320\351\003"
+	.ascii	"D\025<N\301\244\332\304\"\005\212!\222h\365\200M\006w\324U\270"
+	.ascii	"&Q\022Gk\0230\275\300bhT\235>\240\"I\210\310\220,Ae\"\246P\231"
+	.ascii	"\204H\022\252\222\020\251\256\020ZX\277d\204T\327\"1\311\203"
+	.ascii	"\361\310\304t\034j\320I\006U#\261\330\204B]\211LHu\351GhU\330"
+	.ascii	"\241E\262H'$\255\026\233\230\204(\326\244\260\250\2436\035\213"
+	.ascii	"(\220\214\252V\235\212\302\025h\361xt@\020\375\222\321\023\322"
+	.ascii	"\203R\223\320\023R\247I\3104D\242H\025\211\270\342\210lBR\237"
+	.ascii	"\220E!\021\251&\203\236\324b\223\323\210\244\242pIGE\"\"\221"
+	.ascii	"\352\212c\320H\354\260\006\177J\302\024GbP\311\251\330D\024\264"
+	.ascii	"\252I\025\211d$\252\b\256\302d\220\311\t\271z@mJj\340Q\213\302"
+	.ascii	"\241\316\212TW\030\211C$\022\221\t5\022\231\264\007\206\352\322"
+	.ascii	"\360I\310\244\177\222\"\212\302\025\306#q\025\026\217MHu5\226"
+	.ascii	"\030\"1$U\025\251\244\216P\213JF\021\230\204\"V4%Y@*\036\227"
+	.ascii	"\222*r)\205\272\nW\020\327\241\b*\322\321\004\222($2\022\207"
+	.ascii	"j\322)\370$d\n>!w\212\252\321(\\\032\006\237\234\204\301'!\323"
+	.ascii	"O\022yD\"\325\240\312$D&\005\207\310\344\320\252&\223\222\216"
+	.ascii	"Ab2\211\334Q\233X\254A\031\222\222\216\253\323\260\202$\361I"
+	.ascii	"\030TrR\241\"\255NMF\"\006u\005q\025\256 \"U\244\r\310\343:\024"
+	.ascii	"&\005\217\253\2230\250d$.\255\307#S28D\022\375\214$X\024\233"
+	.ascii	"\232\204<\253\221\210W\341\261\230\204\256_2R\213\304\244#\262"
+	.ascii	")\203\037\233T\244\207\365xDz\330Q\221\216&\204M\353/\031T\""
+	.ascii	"&\031\217\"\324Ux\242xD\256\306\343P(\004$\242\t\344\322\372"
+	.ascii	"\013\341\330\3644\002ri\325\311\244\272\nO\f\221\277c\323\323"
+	.ascii	"\bCd\232TW!\022\035Q\202\002\310\245\024F\026H\300T-\n\207\311"
+	.ascii	"\340\232D\\J\006\325\244p\251)h5\022\217M\036\020"
+	.string	"\252H\025Aa\323\352\2436\261X\205\326`\b\253\221\350\364[\215\352\020\2516\005\213\353zD.\255\023\254A\020\216V#\321I\377\350HD\207\022$\360"
+	.ascii	"=4\032\"=\f\223<\030\211B&\017Cd\322\203\221\205\225\310D,\006"
+	.ascii	"\325U\210\324\371\377[\376\300\202Pi\"w3s\307M\f%K~B~B~F\352"
+	.ascii	"@\200\301\355\341\375\214\374\212\214\025\271q\243\310\217\210"
+	.ascii	"\023'd\342r\022\"3%9~C\256\025\257\2717s7\037\203(\372\377\005"
+	.ascii	"\271V\240\232\314\355\305a\301\371\221:5\nC\330\330\370\360\362"
+	.ascii	"3\303\307\246\253G\030\013\307\206\026\017\036\031\312\217\371"
+	.ascii	"\344\214\310W\234\030\021\266\252\233}\322&E\246\326~^9\254L"
+	.ascii	"\216:\270\233\1778~8~9\200;\313\256\003Y\335/\205\377rp\001\273"
+	.ascii	"\350\251\251\372\331@\263d\307\324\315\307\300\210\346I\2436"
+	.ascii	"\346\356\327e\205\250\240\024r\3631\360\241\377\037\027\372\265"
+	.ascii	"s\204\271\245E\215#?\032i\026\220\252M\024\214\037\n)\214\271"
+	.ascii	"\031fqw\006\276\302\222B\227;\031Q4\220$o9\266\322)Wv`\231\371"
+	.ascii	"i\241d4\222\310\361\312\312L\300\310\354)\261\230\016\260\253"
+	.ascii	"\362qU\005\207q2qb\325\204I\221\037c\226h\265$g_12\033\312fE"
+	.ascii	"\031\004\206\016\254EN9\344E\220*e\\<\241J\222\313\270\211c\346"
+	.ascii	"7\225:\371)\201\n\353\373\271\300Q\226\310\371\200r\363/\n\227"
+	.ascii	"\240\257\357\027u\177-~R\377E\375\3477\027F\005\225\346\377\007"
+	.ascii	"\205b\245\331\"W\205\271\244\031v\346\267S\250_\225\274,[}>\220"
+	.ascii	"d\021K\347L\245\321\301\305\220\223\326\320`\252J\013_Z\215\026"
+	.ascii	"q\254\334\234\352\245{O\343<\215s\3238\270\257\217oo\250\037"
+	.ascii	"k/\260\366\202\224l\205f\232\207\322\375\314y\371\250\262\263"
+	.ascii	"K\361\256\227\327\336\313\237\232\031+\317\273\247xl\250\213"
+	.ascii	"5o\312\334\234\2769[\2344)+\334\234\2729[\2307\036:0\270\241"
+	.ascii	"\377\264.?\273\202\360x\242yuP\360\212\264\311S\300\232:\306"
+	.ascii	"\320\241vi}uknf\216aa\021\361Z\223\225\260\031S\222\247&\316"
+	.ascii	"\255**5s3\001\206K\250\343q\204RP&\246 &\035R\b\025\211\3204"
+	.ascii	"I\007\243\025@0X8 \220\213GV>\023\300C\213\253e\201\240G\025"
+	.ascii	"cdhD\024$IA*\033s\237A\372\251\324f#\021o\026E\361n\252\220\n"
+	.ascii	"\367P\240\317\220\376t1\216G\201\276\004\264\001\360\213'9\276"
+	.ascii	"z\032\2639\022\352\036}H\320\370\240Q\206\230\323\324\251<\210"
+	.ascii	"h\fY\035\023\030\230\024\t\217\001a\021\240$\360\031\007:\201"
+	.ascii	"w\0249\303N\216\246\277\022\367\037\340\035\220o\244\013\260"
+	.ascii	"\2476/\201\260\206\226\243\032to\004\345\\\210JJ\274"
+	.string	"Z\364y\310\024\370`\304\205\343\277c\362\236\2547F\271O\367,\fX_\362\237\262\322\353\377\247\026|\335L\310\nIE,5is\236\323'\307\340\022h\216@\244\245\030\260\006\362\363\036z\004\017r\216\241D\336bDo}9\316O\b\376\340\375\327r<\335\330\257M?\016\310\b-G]\266\377\200\205!\326y\311\262$\344a1\2061\f\226JQ>\\\335\373p\377I\004&\272\005$\0033\375P\224\004o\023\261\344\301\265$\352\237\373\305\347c\360'\006\036\362\300\t\300sU\226\214^\215\330{\330\302\362\tW\037\365`\331S\264\320\030 \3662\362I\202/\375\t\261\367\333\027\345\025\240\340\304\r\206Z\225\310\215\352O\206\033\265\004N\f\232*\233\2671\325\340\377\270=\270w\304L\204\271\337\026\220_\301\371\371\025U\307\371~\326\343V\303\001\003(}c\365\327\311\002j`|,\232\232\270$H\356\302"
+	.ascii	"4b\273\367\031\205;>\035\207\t\3402\032\254\361K\206V\246<\326"
+	.ascii	"\222\b\317\302vY\206\264\263\265\361\377B\374\274\03046\007\263"
+	.ascii	"\220l\323\003\036\"\032\246\033\037\336\251=\347\256\333\301"
+	.ascii	"Q4\022\030ww!\2627\035\303\037x(\316\263\312\216\230`j\306\324"
+	.ascii	"u\353\300VdF\r\021>\357\027\036\257#\321\210L\213"
+	.string	"\243\2136\244\320HH\376\323v\316M\250\324B\f\334+\021\355\022s\356P2\256\363_<\020\366\016\372\002j\377\032\311\nE\3767f\215\032UP\036\211\316\020\225z|E\022z\305\314$\320\300\360\206\0273\035\333\230\313\303\361\376\311e\274\253g,\f\200T\026\305\324\235\f|!-\034\211\257![Z\374o\357X\365;l\033w~F\242\030v\214\002\333\310\0066s/\r\f\022\374\263\272\373\361\200\277\241\006Ki\202\370\347\375\270?\007\fK\t\341L\276?\003\364X\341\260\207$\033D+\253\300Ps\273J>\335\332\212\372\327\210\0263\377\276\234\372\267E\320\026\271\320\333\303\313f\374\330\331\377S\226\313a\304\025h\235\f\177>\255^T-\270Zx\243B\230\203r\336Y\366.\nbp\265b\326HE\360\003\3411NQ\007\236\021\344\233\314\264\352OJ\234[\204\250\345\234\022w\017PUF\207H]\361"
+	.ascii	"\032\312\345J`\275)\2615o\205-0\275\334\360MD\231\233\304KL\267"
+	.ascii	"\324\241~\333\222\226\275\223b\025aN;\312\373\265E\362\334\341"
+	.ascii	"9\224\315\312\334c\260A\343\256y)\321\305.\0162$\311\200\276"
+	.ascii	".\033\254\204o\364\362M\214\317\273\202?\354$\342\355\2633\335"
+	.ascii	"\213\262J\313\342\312{#gB\013\204q\243\327\b\314;\373\365\324"
+	.ascii	"\003\215}\266\237A1\262}\313\205\227\224\321\240\337\261\226"
+	.ascii	"V\037\315s\n\020\006z\037\273V\300i\t\374\345\226C\223\311\226"
+	.string	"d\307t\003\332^\033\211\271\350\017\320\325\310\0138\203J\235\271;\002\200\353&\376\217J\312\260\343W\307\370\001\332\277\367 \340$\323\373\216\222*_\272Q}d\265\001zx\3226\220\032\256 \001\327\210MS7[\353\255\360\001\n\261u\001\256n\033\330\306o\360N\220\345\032M`t\026h P\260O\3154\210\353\277\242\202\271h\337\007\343\216\255\306\347\022\347\230U\367\031mD\n\266\311\244\214\023\f\331\277\030\n\004\250\326\374D\240\220\252n\t\207\302\3147\254\207\364\001\331\256! \250\255|p\022uE\\\217|\224tm\2167\323[\352\025\351\216\2254\001r\331i\037\220\263\006m\341\247J\223\2467\350Y\310\331\370t)3\f\342\005\373\312\230\177a\366\350\f,\"\030D\364\253\350\006\236\206u\nO\255\230F\371\320 b\306\312c\2236`\346O-\313\207\344\216\002\250\025\016Ib\242\340gC#\200}"
+	.ascii	"\001\273\004\227|9(_\243\004\323\214\247\213\004\314\333\032"
+	.ascii	"\360\355\202K|\231\270\310\005L\222\t\027X\376\251\375r\211\245"
+	.ascii	"Ab\306\220\020\024=B\035\352\237\233\200\264\267a\325\360\007"
+	.ascii	"Yb\235\"\264\237\3538\3213\312\033\322\243`|\007i\253\013O}8"
+	.ascii	"\n\253\t\234\f\366Qw\235\277\b\351\177^\bl\025}\226\"\347`\354"
+	.ascii	"R\237(`\266^\213\2164\202\355,\206>\365\217\344\366\300i\356"
+	.ascii	"w\016B\367\0207\377G\f(\001n{yiR\304r\276\237\333#\275\017\033"
+	.ascii	"\334\034\177\357\223\225\222\2277\003\031\005\3350h\332<\221"
+	.ascii	"5\023\t\205=\245\r\240\251\353M)y\246\203\272\244@\207\235u\026"
+	.ascii	"&\023\345\344\t\365%\366\034#lD\353r\366\334\342\301\025\206"
+	.ascii	"\"Uq\233S;\217\242{!v"
+	.string	"A\326\031}\216\217\261\246e\21708,`\272\350\302;\320v\247 BD\234\315\227\275\036q\323\371\213\221\3750\245\007\364\003\265\374\367\352\021X\345\265\003\303\177#\301,\2325<\333;\037\2166\2532=\263\030AFn\256\006\351u\302\365{\225!-\026\225o\363\331\201\361F\356\032\340 \366@\366\033\374\005\246\013\r\223\250I\365q\030\220\200-\343l/\2126w\245\372\261\212\377Z\t\bq\352\277:lk\003cX\264\2564\237\277~\310G&\220*\302a\373\347\270\022\251\220z\241O\210'\334,O\373\275\003M\004Z\275\356NB\204\370\236\225\311,f\b$9\024\203\2577[\r\035c\344\303$\022.\204\2035\033\270"
+	.string	"\366{m\273;\036\254M\214\353\326M\341\243\331\347{\362\272/\2561\336\261\310hp\032\317\003\257s\bqT\363W\266O`\374\230\3572\t\272$\255\017s\201 \212G\372C\223\371\322\236Un\220t\320\261]\2161\260\007\260\225M\372\216\016\246\273\347\353L\005\316\327a\022\206\325\336\305"
+	.ascii	"d\202X\363!\365\177\376\352\3123~\323\337\233)\3759\322=\224"
+	.ascii	"\001u)\266\264\2519*IB\350\244S;\r\304\365\202\254F\254\246h"
+	.ascii	"\352%f\274#\233\303\373\033\023\332\n\013\331H@\206\023\236\264"
+	.ascii	"\032IC\270\304\372\022\253\252\340\220=\354\006\3156qb\324b+"
+	.ascii	"(\323\031\376\2564\022KH|'{MqvC\034_\323q\211&1\277\243\252\025"
+	.ascii	"\331\267\276\265\234dM\330`\313\344\251\210Z\030\344`\276\na"
+	.ascii	"k\346\r\324\267J\024gy\242\345\273r\033\301\233\347\364QJ\220"
+	.ascii	"9\352\334\217\2119\200\246$%\317\023\265\026mdg:\326\n3C\002"
+	.ascii	"\207b\207j4\223\277\203\262\327F\363\217\233\365\265\177\t\207"
+	.ascii	"\224\2123\330)\366`\364\t`\232^\240\250\240\016\032\"\001u\004"
+	.ascii	"H\020F\363.\225\235\211Y\205BXM\311aW\223a*\032HN\364C\316:\340"
+	.ascii	"&\030\002\320\324\271\335/\002g\377DsA\206\275\027\265\3427{"
+	.ascii	"\362\266\016\027k\b7\222\326\276)\177\235,x=&cX{\265$\2454m\302"
+	.ascii	"6!7J\233\300\217\263\217^U-(\006\362C\376\240\335|\201_N@>%2"
+	.ascii	"\235\035\\\350\001P\032\372\260\247\327w\230%3\2366\033\233\215"
+	.ascii	"%:5!\364\342\206\222\376.y)G\206\307A~e\272^\026\t\376\n\374"
+	.ascii	"\252@I\356\366`\021.\023\300\257\315\326\257=\220n\021\361\362"
+	.ascii	"\275\363e\200\220\303\377\334\006\277\364\373\320\226\264\314"
+	.ascii	"-gG\034z"
+	.string	"\306\327\311\301\371\002Bp\352JF\027\244\260\304\263=s!\26552\215\347\373Svc\001\t\212/|\376;\306\221D.5Rg\0306c\326\221\231\271U\236\031\222.\222sGB\200EX\0216@\300\217CO\262S\036\340\3543v\021A\301u`\221\r\266\020\306?1\334\355\225#\312\374\315g}\007Hn\220\202\303H\250\245h\270\206\024\203l\273R\303\327\271\225pUi\024\322\235\323\236\315\257\344;\2012\360\327\317\221\2227\020>R%\r\037\033\3361\2531O[+\216\231di\327^>\366\220z\316s8\363\360\213\311\344\214 \276\240f\003\227\340\356Ci\310Xk./I\375;\3073\222?\342\316L\342\330\227~\004\036f\246\271\334\231\377\0218Y\240\244<W\245=\002:\2540O\350\002\341\031\177Z\333\250\265\327\352\251\034R\304\r\001\253\034\224\202\016sS\334\274!\372\271\246\336\0248a\373"
+	.ascii	"\231\326a3r\321[a\224v\031\262AEv\302\252\255|PU\201\3314\202"
+	.ascii	"\273^\236\317R\332\324\037z4\027\255\036-5\245d\306P@5\223\265"
+	.ascii	"\366\370k\277IjT2TAQ\315o>\2021\224Jo\216\242\245\2579~\313S"
+	.ascii	"\026\035\234\213|\001\212\267\234M\233Q\"\037\252\216\177\202"
+	.ascii	"&v\245\343\331-\214z8\226\030\210+S;\\M\312\036\221^\327R\313"
+	.ascii	"\352\363H\352'z\0327\234\233$\252g\275]\2615\002\314V6\376\326"
+	.ascii	"\203\023\243O\367\\\361c\343\260\020W\261\n!\212q\320y8!\223"
+	.ascii	"\001|\365\305VHB\005\226\023z\327\377\330,Y\263\2573:4\320=-"
+	.ascii	"\365RE!\212\311\223>\343SU\003\260R\355\331Y/\304\034A\352T\247"
+	.ascii	"\022^A\027\252\026\035\024\r\235`\356ao\004Ee\177\"t4\302\255"
+	.ascii	"\005C\371=\235\020\360G\376\303\376\033\225\037\004*K\303\306"
+	.ascii	"\035g\275UsV\245Q\305\202b\351\367\307\035j,\345\324\226\362"
+	.ascii	"\241\037\253g\203\365,\214\377\002\260\342\264\300\266\330U\215"
+	.ascii	"\266\"\032\3413*\250\353\031\033\332\206m\005\305\302\377d\261"
+	.ascii	"H\306'%\217\305K\200/\314\316\206\361\254\005\333\336\266\336"
+	.ascii	"g\37502\203O\237\177\227\314\265\255\353&\347 \316\221\370\225"
+	.ascii	"5Z\360\323\361\374\332\322Z\216^vf,\227\316\354\355\234~\355"
+	.ascii	"\276\373`\366\327\230\216\372P\226\217,\252\277^|g\317\261J\364"
+	.ascii	"\235\253\370\007\\}_\21496\362\023Z\346\016\363\251\223\234\323"
+	.ascii	"\276\251\301or\235\202\303\232\220\351z\320\f\016\177-\206\001"
+	.ascii	"V\272\315\325i\320\022Cww\240\234w\301\264.L>\r\351\266P|\n&"
+	.ascii	"1\252A|o\2309\274\237!\005\277{\273\002\353\267N\263\247\215"
+	.ascii	"\257L<.b\371\342/'\277\376\360\332\343O\"j\302\314\\d\256k7?"
+	.ascii	"\271\347_h\376\235\341[\240\237\226{\256un$\r\017\3075\233\354"
+	.ascii	"\001\322\016\203\177 8\023bi\240L\317`\367F\372f\357\2459\013"
+	.ascii	"\213#x\274\0075\032\013pu@\334\034\375\022\026\370\035\b\017"
+	.ascii	"o\270\313\221\273M\361\365\226\314'[\022\214\177x\024\263l\217"
+	.ascii	"\300\263\300_13\205S\2759\016\200m`k\367\277NZ\376g\362\350*"
+	.ascii	"\246\364\227D}\2465\277\374\341\225\t\314N\342/\317\305\be\326"
+	.ascii	"\360j\373v\262\007\344\207S\230\265\342(u_=\276(^q\326\323\222"
+	.ascii	"\332\2326%\031/\r?y\316\343f\342\346\201\030\267\326\337v:\355"
+	.ascii	"\003q\337\273\b3p\276\231\363\022I\366\037?~q\253\222\313\024"
+	.ascii	"\377]\032\237\264O\322\034R_\357(>FM\3077\251\207\343\342_\333"
+	.ascii	"nt\003s\276\355\034%L\3222Y\271\366(?6\336\2378\207\b\333\253"
+	.ascii	"1\260\234\200\335\333x\231\336\302\351;\224\271\201\360\023%"
+	.ascii	"g\025\265\3026\356I\325q\251/\355Pa\322B\243\257\276\260\231"
+	.ascii	"O\274\202\215\246\366{\006\362O\216\217\257\356Z\3566\344\207"
+	.ascii	"+\236Z\004|~\f\260\346WVbg\244\337\023r\314\002\256\246/\002"
+	.ascii	"\277\332H\367N\354cl\353\350\343S\276\013v\254C\374'\370LK\026"
+	.ascii	"\n\007\"\0267\230\036L\220\272\270up\321Kp\343\216\321]\202\222"
+	.ascii	"W\236npM\3323o\360\355\364B\2239+\337\232\307\231\312:\340\033"
+	.ascii	"\"\311\020\317\r\273\345\274#\224t\005"
+	.text
+	.section	.gnu.lto_.symtab.9c711cad0a037b43,"e",@progbits
+	.string	"applyBetaflightRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"applyRaceFlightRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"currentRxRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"interpolationChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"getSetpointRateDerivative"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"processRcInterpolation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"calcRcSmoothingCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"rcSmoothingRxRateValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"rcSmoothingSetFilterCutoffs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"rcSmoothingResetAccumulation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"rcSmoothingAccumulateSample"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"rcSmoothingAutoCalculate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"processRcSmoothingFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"rcSmoothingSplineAxes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"rcSmoothingIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"rcSmoothingGetValue"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"hermiteSplineEvaluate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"hermiteSplineUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"hermiteSplineInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"pidUpdateSetpointDerivativeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"pidInitSetpointDerivativeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\003"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"pidAntiGravityEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\003"
+	.string	""
+	.string	"imuQuaternionHeadfreeTransformVectorEarthToBody"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\003"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"getLowVoltageCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9c711cad0a037b43,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
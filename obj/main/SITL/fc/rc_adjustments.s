@@ -0,0 +1,1378 @@
+	.file	"rc_adjustments.c"
+	.section	.gnu.lto_.profile.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375`\261\002m\n"
+	.string	"\344\013\245\003"
+	.string	"\025"
+	.string	"\273\207\266\334\002\032\002"
+	.string	"\002\001\002\003"
+	.string	"\004\002\004\001\240\342\234\212\n\002\003\354\275\370\376\b\004\005\352\263\360\321\b\006\353\252\315\223\t\007\314\246\325\346\004\024\005\002\005\b\t\n\243\274\344\244\007\b\002"
+	.string	"\002\006\002\004\002\006\002\007\002\006\013\214\325\362\227\013\236\001\002"
+	.string	"\002\t\n\002\n\002"
+	.string	"\002\013\f\002\013\016\304\314\320\257\017b\013\t\b\017\242\270\255\365\003\020\222\317\267\356\004L\r\002\016\017\002\016\002\020\002\021\002\f\002\022\002\023\002\016"
+	.string	"\002\024\020\002\025\016\002\016\004\002\004\024\370\216\314\314\017\025\307\206\334\021"
+	.string	"\026\206\271\335\257\r\027\313\331\240\372\b\030\367\226\216\331\003\031\240\342\234\212\n"
+	.string	"C\250\201\236\340$H%)(\024\033p\202R7\265\r\022\200\345\215\243\306\031(\230\231\tf\362.,\273f\003=\306'\255>By6\353+\307\201\2453\324\345\311\207\337\275\267\315\340V\027\342\325d[\255,\273g\212'\030\234\365\225x\220s\\l\007i\352D'\202l\310\022\201M\326hU\341F\223\225\307\233\247\b\367\350\243\377\271\354\217[\306\335\362b"
+	.ascii	"\376\373\205\217q\b\362\267\325/\301!\256d\377\331g\334o\354"
+	.ascii	"\313\341\233\333\362\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"\345\002"
+	.string	"$\003\001\001"
+	.string	"\t"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\007"
+	.string	"\001\n\002\001"
+	.string	"\001\013\003\003\016\017"
+	.string	"\020\001"
+	.string	"\020"
+	.string	"\007\001\003\001\200\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\b\025"
+	.string	"\001"
+	.string	"\001\026"
+	.string	"\001"
+	.string	"\020"
+	.ascii	"9\001\230R\320R\356Te\034%\032h\303\366\330\300\260\342\"\004"
+	.ascii	"\211\313\231\331\\\306-\013\363i\235OP\226\321\300\020"
+	.text
+	.section	.gnu.lto_.inline.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375`\307\n\r#"
+	.string	"\246'\207H\320\362&\035"
+	.string	"\225f'\034Y~X\215\236g\024w$\030\356Q{\003`4\256\371\322}\314\340\235\031\037\311F\016\207\001\367\265\214\227\217\213zhh\352`\360\302\2131{\007\007d\300\256\342ux15\333\t\344\357\235v\nv"
+	.string	"n"
+	.string	"x"
+	.string	"\256\007T\f\024 0"
+	.string	"\345u\" \200\t"
+	.string	"Z\342\"a\255F:\021.d\312\307\270\200K9M\264Y\"\312+\\\305q\302\203\212V\334\370\f\263\242\355\226\254\311\333~=J8\270\273#\255U\264\264\035m\032(\355\350\n\231\371\b$\233\016\n(<\252h\250\304\312J\3044\3204\220d\336\257}w\227\263e\016\002\364Q5\273\035e\244T\213 '\026{\304\254\241_\030\303]\320\227\355\202\325\265\372\325r\303\227\333\222\252\200\\\276\224\033B\270\017\022\220\275\343\206a\\G?\302lk\230\315\3236\363\3263\317\235\347\b~\246\037]\323\272\256\262\265\354*j\020M\271\374?\370\223N\317\336\234\307\275<\206\321\017\031&\276w/J\307\021\320\313\235;\027\t.m"
+	.ascii	"M`\344\355v\033\342\354\230\207\273\213a\305\0017JDM\321S\312"
+	.ascii	"\r]\0162\3458\261\302\026\031\332\3600Q\022#\ff\233\2669\363"
+	.ascii	"\274\031\301\357\243\353I=\253\247\354\263A\364<\f\243\033\023"
+	.ascii	"\213\363p\334\270\360\340\272's\004!\021R\317nv-\207\022\022"
+	.ascii	"\232jyzF\220T;\202p\250\241\361\211\300\256\f\270\327i\242\005"
+	.ascii	"\256\373\005\253\274\340\321\260t\021v\231\006\262N\353\354f"
+	.ascii	"\036\255\262\373\261Xl\367\363\351n\206yM\372eo\214l\332]\021"
+	.ascii	"\237\270%/i \3537\322\b\207\352\304w\346<;9)b\bS\317\226[/\362"
+	.ascii	"\303\351\3213[~\244tcq\230\373@\375\204+w\356j\227z\262\361\364"
+	.ascii	"rW\335\271<\351'\t\305M]{\313\343\354\232\335\315`w\2171\305"
+	.ascii	"s'\374\240\223\300%t~\264\312\376\031"
+	.string	"\213Q:\303\030\312f\365g\255\236U:\220\001\201_\250\361\271\232\021\221$)H\2419q\005DA\350P\221\007\021`\2454H\3216i\317$\253T\022\3469U\252\bY\331\006\344\b\247\215\2606\001\234\351\333\3712o\031\302\344\264E]\263v\251\312$\233\b\f\271\352sV\305\355/V\322\222t\302\330\342\300\270e\260<\301\230\246\363zG\3429\003\306\032\r#\222\244\207\212\315\321\246\017\201\202F[\345P\317;\347\217L\321\022O\270H\3517C\273\036Rz&J;f\272\321\2047\031Wb\261Pv\304\033M* \013H=\307\bR/4\377\344d|\001\377@\361\177y\241A\312\030\202\001\n\344\2118\203%\001Z\325}\005W\226\350\312W&n\325\256\347\\\3441d\335\2558Fl\363\322\262\341\350:\037\f\315^\305\"\227\022\312f\311\371\304\224\016\345\234t\274\243\307\312\020\227\364\336\212zc\320"
+	.string	"_Wb\036\216e\"\020/M\363\374\305}!\251\227O\207\001$\\\343\271\317\\\322\367\035"
+	.string	"\316F#\350\034\332\305\221\244]\f\375\313\225\307,V"
+	.string	"\213\335\331\352+\310"
+	.ascii	":I\b\255f\221\\u7\216;\241\221\005\036\b}&"
+	.string	")\362\021a\036_^!\255,ieI+KZY\322\312\222V\226\264\262\244\225%\255,ieI+KZY\322\320bl\231\274\221\247\324\314?\224\024 P\3131%\224\232\234\r?Y\340\004\303\35224\017\366\2600\026\031\317jb\n\211\211\036y\334\007\346K\242y\311ig\240Y\246\234\246z\2478W\004L\314\345\311\315U\005\2237\207\207e\303\271s\324\363\252\tc\036z\034/O+E\212\035#Y\036\201\354~\237\232aBG\332b\3007m\351\336m\020\t,\323\301\347l\220)\201\215!\365\351\330\004\005KC*\005wX\f\005\013\355\2608\203k\001\004\223\263\345B\327n6T\366\0365\005\220/\335\201\n\001-\n0\276\371\351\327\216\355?H\036\036O\320Na\207\217g\360y\f\037\317\340\363\030>\236\301\3471|<\203\317c\300w\n\005\342\245\303\312}<\203\354?x\340\3324\343i\224"
+	.ascii	"!\303\262\352\002\024"
+	.text
+	.section	.gnu.lto_.jmpfuncs.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375`\317\007U\021"
+	.string	"\006\025H8@\215\323\001\036\265\357S\331\264\344O\021\337\222\377\200\277RI\017\3030l\214\217a\256t\f\234s\206^\300\312\005"
+	.string	"\266\377\021\364\004\276\025\377\250\227mT\276.6\"S\n0"
+	.string	"9"
+	.string	">"
+	.string	"\346\270\023\310\305\302\245\233\245\363_\355\r_\373\243\257\246\335\"r\317\360/|o\223\264\001\350K\362/\311\275\351\372\365\330\350c\343m\314v\346\312)\030\317\313d.\027\215&\313\256iO}\333^\377} \320!\036\n\315\325\024\211<r\263$\251\236\303y\201\\\214\263\024\\ZY\032\360\377\332\016\366\002\362\003\342\236\256\303\375\006\024\215\271\302dx\030\231\213\213\205\246\"\243H]S\245\276M|\261O\002\024\021:]\364\360;|\323\355?\362\377\310\375\365\355tHa8\332\343\031oQ\374\350\353\342\270\256CQ(sb\002\2667v\253e\360\331K\332\237Q7%\370\365'\n%\b&$\252=\375\254\265\326SL\332t+\273\373{#\213\005\004C\300\331\001\t?H\036\217\321\"\353\276:8\216n\003\025\200\263\250\261\2745\013\222\202J\245\003@#\021\2324\007\022"
+	.string	"B\252\210\343\224!\002B\254\260fbR\3277\261H\026\344m!M}\202t\313Kz\235_\257\354\313\260\321\267\220\266\340\303Z\237\376d\031a|\351\f\375K\310\325\224\304\n\220\300@"
+	.ascii	"\343\304\n\026\255\324\t\377\337\346\"h$W\371\335\017Bm\3226"
+	.ascii	"W\213\377m\356\315S\361\r\266\341Nc#\231\267\031\320\217\221"
+	.ascii	"1\313m/\033\032\315\333 c\035\031\216\320\366\022U\361N\243p"
+	.ascii	"\372\354\206\301WX\004]\215\320;\374\344m\227Q\320o\007\351\002"
+	.ascii	"\252\031bb\006\230&\020\255\351\026\324\013\034\300\363\343Z"
+	.ascii	"\252\030b\022\330\345H\3278-\265\245\314\033b\356\214-cl0\261"
+	.ascii	"e\234R\331\030\\S73\234:x\222\n1\307x\330\205\351\f\007\337\250"
+	.ascii	"\235G\356\034o\003yelD\222\244\273\237\320_\325\347\337\375\036"
+	.ascii	"\275\275\370\372\016=\346\323\315\352\007\240\352\024>"
+	.text
+	.section	.gnu.lto_.pureconst.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\007\231\004\n\230\004\013\232\004\016\232\004\017\232"
+	.ascii	"\004\020\232\004\025\230\004\026\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\365\004"
+	.string	"\222\207\032%\220)\351\2719\376?\356=\327\335\211R\377c\035\250\242\374\007\350\241\341\320\302\203\332\021Qe\004\227\240\326\310\226);\307\264`v\222\223&\005\273"
+	.string	"\250\b\313\3445\036U\221<\352=\243\203.A\204SV\363E\340m\330\033\336\b3\363\376\344\221{\"\237\373:\340\362c\265\003\006H\365\275\016v\007/\204\035Bdy\363e\001\024"
+	.string	"U\005\354\001l\023"
+	.ascii	"\356p\032\245\243]\335b`u\030\301\212=\3401\256\325\004\346~"
+	.ascii	"(\313\236Z\030\026\370\375\334\001\026\t\367Ce5\f\300\001"
+	.text
+	.section	.gnu.lto_.lto.eccddf19bc35f81d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_adjustmentRanges_Registry.67.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375 \2155\004"
+	.string	"\244\007T"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\305\361\031\006yw\250\367\005yu"
+	.string	"\005\001\006'\001\254\002\245 ?\202\210\2000sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/fc/rc_adjustments.c"
+	.string	"\003"
+	.ascii	"*\342\203&y\003(\002"
+	.text
+	.section	.gnu.lto_defaultAdjustmentConfigs.75.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375`L\004\315\r"
+	.string	"\224\023?\005"
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\003\005\001?\202\210\200\b\177}\273\001\005\001\006{\001y\001\"\030wu\276\001s\275\001q\274\025\001\035y\001!\302\301\034\001o\305"
+	.ascii	" \310"
+	.string	"\001s\307\001q\306\033y\001\037\314\313\032\036\320\317\031\007}\323y\030wu\325\324\030\377}\330y\332\331\027\027\336\335\026\026\342\341\025\025\346\345\024\024\352\351\023\023\356\355\022\022\362\361\021\021\366\365\020\020\372\371\017\017\376\375\016\016\202\002\201\002\r\r\206\002\205\002\f\f\212\002\211\002\013\013\216\002\215\002\n\n\222\002\221\002\t\t\226\002\225\002\b\231\230\007\007\235\234\006\006\241\240\005\005\245\244\004\004\251\250\003\003\255\254\002\002\261\260\001\264\263\002\360\003m3\265\0024\262\002\257\002\256\002\253\002\252\002\247\002\246\002\243\002\242\002\237\002\236\002\233\002\232\0025\227\002\224\002\223\002\220\002\217\002\214\002\213\002\210\002\207\002\204\002\203\002\200\002\377\001\374\001\373\001\370\001\367\001\364\001\363\001\360\001\357\001\354\001\353\001\350\001\347\001\344\001\343\001\340\001\337\001\334\001\333\001\327\001\326\001\322\001\321\001\316\001\315\001\312\001\311\001\304\001\303\001\300\001\277\001"
+	.string	"\200\201\250A\3048\205,\373\006\200\2234\315\001\020 \350d2\353\0015\350\263\242k4"
+	.ascii	"r\352U!\245C\272\231\004xgm\rDd{\215\215\201\223\210|\340\201"
+	.ascii	"\230\357G]u\200@\330\256\020@\233C \307\022\001\352O\306 \300"
+	.ascii	"\033\006\333[_H\343\215\330\260 \324\266\215\271\206]\322\306"
+	.ascii	"\273\313\016\216\202\314\262d_\357\243\035\303\253\326\375Sn"
+	.ascii	"b\031N\374\"\237\243\024\315\227\257D\240\002"
+	.text
+	.section	.gnu.lto_applyStepAdjustment.78.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375`725\217"
+	.ascii	"\252\345<2I \020\323\031\016\303\"z \204\"\243\372\254y\200\353"
+	.ascii	"u\002h!H\212^Z\220o\225<o\"\250\177\005\211-\307"
+	.string	"jJ\003\2000\362{J\377\263JE\265]\336\321<\f\2738\211o\277\036\\y\262\006Y\355\021\262\367NR\312\031\003\306\002\033\0034\210\2753\324^\031\357\215\361\336\245\367\302P{_\020{]\250\275-\336\313\342\275Jj\357\n\265W\305{\223\336\233B\355E\241\366\236x\257\211\367\226P{I\250\275H\357\035\361^\021jo\b\265\367\350\275F\357-R{A\250\275D\357\375\360\336!\265\327\203\332\333\341\275\305\367\022\325^U\355M\337\213\276\367jo3\241\025~v\f\344\255+\327a\241\225OJ\207\f7\231wY\2549\310\305m0,\016\013qY\344\226+8\227_z\260\324\rz\341q\371Yn\355\rZ\311\033\314\002\\b\tZ^\tv2\260\255\276\f\017\335\n\013\337\b5\t\343\006\005\341\006\001\357\004\222\373\323\263\354\253[\362\3350\b\boP\217o\231\267\267\304\353\033\274{\016\332\005.\367"
+	.ascii	".\353\n\341\021\244\003;\274\3234t\302\031\254\36368'N\234\270"
+	.ascii	"\345\272\256p\030.\n\273\331\257\340\214\262;D\003\277\331\035"
+	.ascii	"Z\022\330\315\246ov\206H\330\035\342\264i\027\271\374\266C\273"
+	.ascii	"\333\\g\321\252\253\330\004s\350\267\256+\023\247k,\276\271\315"
+	.ascii	":Q\243uJ\22799\353\272:-\004\357\335\034<\220\314\346\310Fk\362"
+	.ascii	"\316\254\b\367.\253\361\032\222\331L\340\243u%\343\223\263\256"
+	.ascii	"lNk\243\310\351\262\025ww9\r\253A\356:Q63/b\026!,\267\301u]\237"
+	.ascii	"X0\222\312)\312\"TN_\306H\336\267m\256\333\266\331\266e\263k"
+	.ascii	"\226\215H\324\020!A\200\374\360\321\003\212\307\016\0359p\334"
+	.ascii	"x\262\341\324\304T\203\306\f\0311\226`\274p\321\202\205\322\n"
+	.ascii	"\025I)P\2340Q\202\004\322\b\021!\216\214\212@\020}\030\362\320"
+	.ascii	"\241HTS\364\215\\^\016:\324\362\262\342}k\246\300\353\226\002"
+	.ascii	"\334Vo\2336+\274l\254\314\321\352]\263l\250\nc]\2520\221\244"
+	.ascii	"\261d\025\347aG\031\016)d!\205t\205:\b\220A\374cP\035a\373\350"
+	.ascii	"\321\307P}v\317"
+	.string	"\346\261c\217u\3541\036\240\316\201C\217o\350\351\375\351'\033z\330I\017_]7\345a\302\3035\360\360\237\rMc\306\034\313\230c\3008\035#n\t\216a\3001!\234~\341\342\r\267x\303\20544\0137Jk\274b\315J\255U$\251\341\024j\256\3224\212\023L6\301\314Zv\t2$\3060\322\230-\030z\204\2100\034\"\214\327\013}dd\306Ef_\\\032\304\026\2420\376\020\226\245\205\036z\301\305\036Z\214]\321\302\035\270O\227\2260n\021CW\226.\2425\266\344Q\201\373t)Q$\024l,\311\325\304\025XEk\370\315\t\004\341\205\205\"q\215\321j1*\235f\031nQ\242@h0O\234\0332|8\354\241\253!\r\215\0300<\326\305\202\007\257+\265\375\200\211\215\030Kr\225@U\340\243(\266\344Q\001\204W\022]\262\353\262\307o\334V\274\246t\023\213\254\353\272\255\345u\205\267"
+	.ascii	"\336M\307v\267\204]'\242[\322\324\322\027\036\227\n\251`\255"
+	.ascii	"\034\244\224==\2771\223\263\231\314{kb\376;\227}\233J \037\242"
+	.ascii	"\347\2777\027F\321\210\031d\2265\005%\373pO\370\217\276\361\250"
+	.ascii	"lI\376? \226\241\224>lj\302c\324\237u]}\354N\365`\222\342\272"
+	.ascii	"\256P\234n\013\232\300\347\003(31&\250\234\366\213\234n\204t"
+	.ascii	"\244\364\341\266\027&q\205\217U\027.\t\261\030\252\244\367\262"
+	.ascii	"\375&f.7t\363:\325(\267\322\201\266\005\261\340b\301o\373o\237"
+	.ascii	"\3047\245\347>UC\345\n@\333{\373L\353\224Iz\373L\355\314\245"
+	.ascii	"\340\243z\303v\336>S\2709\024~\366\231\272)O\360Q\265\333\356"
+	.ascii	"S\202\313L\317\366\036\022\204\360l\347Az\226Y]\230\333\246\333"
+	.ascii	"\247\212\247\034\341\334\226\333\247\352\234\023Ag\273\316>\325"
+	.ascii	"\2462\204\234}\252y\346\216\370\250\306\355S\2053\342\243\ng"
+	.ascii	"\237ia\021\037U\032\266\337\3543\355\233\003\321Zo\373L\363\224"
+	.ascii	"D|T\333l\273\r\351\255\331f\343!\217\332\366Z\2078i\266\325\024"
+	.ascii	"\227\313m&q+\213\231m4\2250\206m\031\322=2\333eP81\3330|\r\314"
+	.ascii	"\366\013mVfu\341\313v\331>\213\353j\305[\230\217*\247\333Z\253"
+	.ascii	"\225\2542\353\272\322\350'\363\226}\026\315\326\256\225m\245"
+	.ascii	"\301)'\337}PX\327\332p\207:\312wE`\322\254\265,\246\334\nE\357"
+	.ascii	"\245y\016\240\235\013?\3312\361\tO\313\b\265\351\231\322\203"
+	.ascii	"v\331\222}/\273\214\256'\333\375\353\343\003\244\227\207wg\267"
+	.ascii	"\247\016\017\335\0359\2665\26545i\3200\227g\320f8\013\003\246"
+	.ascii	"\354\013\331\230\030\227\260\026\264(\301\276\336\313X\274\272"
+	.ascii	"\230\215\231\271\266Px/k\275\227\253\250\275\214\365^\276\342"
+	.ascii	"&3Oa6\314\234|/\257\357Er\033\346\023\336\033\205\233\274Uj/"
+	.ascii	"\224\367>y\257\223\367\216\240\366R\021{\233\024{\231\274w\311"
+	.ascii	"{Exo\b\305^%\304^\020\212\275\037\274\327\203\367&yo\007\305"
+	.ascii	"\336)b/\007\305^\251\367n\360^\r\336\233A\261\027\003b\357\005"
+	.ascii	"j\257\005\357\255\340\275F\265\227\002\265w\202\367\"y\257\004"
+	.ascii	"\357\215@\355\205\200\330\373\200\332\353\300{\033x/\003\357"
+	.ascii	"]@\355U\200\330\233\200\332\213\300{\017x\257\001\357-@\355%"
+	.ascii	"\200\330;\200\332+\300{\217\274\327\310{\003P{\001 \366\026Q"
+	.ascii	"{\211\2747\352\275C\336+D\355\rB\354\005\242\366\376x\257\217"
+	.ascii	"\367\366x/\224\332\313\203\330\273C\355\325\361\336\034\357\305"
+	.ascii	"\361\336\033j\357\023\261\327\206\332\353\364\336\246\3672\275"
+	.ascii	"\267\206\332\033\177D\256\005\315\202*\265\252\234H][\225!g\272"
+	.ascii	"s\237\220\017\tr!2\240`\350\027\252\202V\020\364\n\220\0235\353"
+	.ascii	"\230h\356\2544fh]\004\240\f4"
+	.string	"\3005\242)\240[hg\300\037\267\202j\241Y`Z\377!\327\246\325\343\214\347\034\b\352=x\034\312\f\212\205RA\257\300x\240\311\035'j\3121\355\304\200\273+[\263\264u#&\2041\003\023\256\361\207\2063\234\tu\274\320\321\211\320\240\261\255\353\220\213\333\302q\256;\013\3368\216\247\3370\363A\301\300\261'A6N\324\204#T\236\251\323\365\302\205\327Cpa\2133.\\\343\375\372\316\316\205N|\307\246=$S\t\220\327\235\230\232oI/\033\230\351\274\347L\250\306\231h\274\206\336\221\335\376\374\311\033C\343\354\246\2077\343D\315&\241r\016\213\032\016\355\224\260\274\310jE\030\2535\336\216O\230\267\225\214\3539:\325!\231Jyd8\r\223X\330\315\322\331\356|\b\343K/\016\003y\346tGn\232\315!\231B\220i~\007\231v9$\032\344\232\023\225\323\027\347&\0305)\257s;N\226\305,"
+	.ascii	"F\214\250\234\2728\221[!\241r\206\265.\025I`O\257R\200\271Z\343"
+	.ascii	"\343\304\201y_\2658\234\032\300\336\302\213`\362\356\f\306\342"
+	.ascii	"|\367N*\235\305\212+u\340ip\263\342Ef\002\t\351\234\245\261\241"
+	.ascii	"8\241<\210,\023_\262\326\3706m_\336Y*\276\206M\205\031Amxge\322"
+	.ascii	"\031\357"
+	.string	"\215\225\342I(\236B\3558$\r\305\213\314\brS\242\031HB\313\211\266\220\304\266\326x\346R\354\275u\342hG\030fN\270\355\345\235\265\2308\347\275\255\224\270\t\022/!\303q\210"
+	.string	"\217\201\304\213\314\344\021\322\031\303\2243BD\330\357\025\242\005\2575~\f\f^I\275k"
+	.string	"\002\037\356|\361I\336j\221\376B\330\221h8\375\264\351\235\303F\234\365\336\\\">\"\304E(p\263c1\304\211\334\3740\325\302\234\361;2\342\362\244\257\242\257\2575\236\254\313\327\321\305\\8r\352I\002:s9\0266:\003zc)\272\021\210\027m9F\205\201x\221[\035!\016 \376"
+	.ascii	"\022#\032{\212,\037\272\262\254\361Y\224]\357,D\007;.}\215\235"
+	.ascii	"\310\315\331\306\304\314w\036[?\037\316|\357\025\206\376\301"
+	.ascii	"\303\207\232~\345\030e\306\300\275<\274\310\315\311\244#\305"
+	.ascii	"\214\371\215%0\263\022\372Yu\341\320\275x ;\212\260\017\312\034"
+	.ascii	"\366t\270\227KaF!l\215\337B!\254\303\265\236\325\001/\256\255"
+	.ascii	"\357L\326\203\270x\356{\263@|Q=\321\351X\307\250S\201R_\344\214"
+	.ascii	"c\322\221\202\307\f\203\320PN\361^\366\2169y\324\347nM\240;\275"
+	.ascii	")=\210X\242\271\354'\030\002u[L\202\t\322[-Q\314\0272\365^\226"
+	.ascii	"-P\031\353\034\264\341\320bk\274\225\005\305u\235\002\265}\370"
+	.ascii	"\025\203]\r\244\232\265\244TN\031\353\314\255\301\013\202\r("
+	.ascii	" TI1yjB\305\204\t\325\024\212$Q\226H!!!I\223\242T\325\222$\035"
+	.ascii	"\244M\250\224TM5\2112@\210\017\224x\320\204\312H\222*\251\007"
+	.ascii	"\226P=\251jB5u\264S"
+	.string	"6\240T5I\302\244\nJ\224\020:\220\322`\352\311\323\224\007OM\224H1y\232z\002\345\311\206\322R\215\220\344\311S\025\025\325\223\247!6)|\262e@\260\001\226\234\0035\215lp\376\013,\202\344\274Gn\310\001\347\272@ G\316u_z\3708\343\221\333\321t\306C\005\007\257g:4\033|u\276\363\205\211\253\234\235\315\031\254u\256\203\266\304[\3479r.\330\353\274\206\246\304X\316irI\fvN\243r\202\225gf \t\326rfR\021\301a\3473hF\314\345l\346\013\021\217\235ehz`\262\016ggjD\024\345)\257\272\225\335\255\272\023@?B?)Onw)\362\303\303\3034\004\f\260\344%\340\004`\203[c\032\326\002\333\031\016\312\265,9\024\2472\247\334\22789\313\235\337\214p'T\037\001\206Ty,\216!\327\212T\357\220\2025\371\220\240\035>\200\353\021#\033\234\305\234"
+	.ascii	"\326\346\2541\275\342\265v\236\303\344\\\310\263&\263\024\322"
+	.ascii	"\2551\033\234\311\231\270\266'\337@\204?9\307\t\341\"(y\b\251"
+	.ascii	"\025\344Y\324\237T+\315\032\243\344Q)\026\b\037\022\214c*s\b"
+	.ascii	"T\006\200\"H\256\344$\242\346\\c\232L\245\250\235\235\037<]\221"
+	.ascii	"gM\177\016\r\321 \371\007op<8\022\224\217\223\334\203s\235\016"
+	.ascii	"\236d\352\035\024B\236\0211#4\b\315\324\211\200\031\344\340C"
+	.ascii	"\202o}Q|}\206\034\360\025tB\322\350\326\210\n\n\224v\246\223"
+	.ascii	"\372\037\362\314\311\314\257"
+	.string	"\257y\300\245\344\016\033\370\001Er4x\003\347;\031\\\003\f\236\301\231\f\272\207<#\362\007\020\222\te\206C\023\271\366\364\007\203\023\321C\377\\\360\241@CBe\335\2362A\200\0349R\335\0175ukD\375\334\2519\327Yp\273\343\022\237#\267\240Y(\031\365#\025<\352\214\307\370\n(\270\021\325\203\326Q\360\"9AB:6\360\361\321\303\307\207\354\240\322\330\255\021\245\233Ks\266\233\340rN;6\370\370\004\200m9\356C\202\3478\357\211\340\022@\360\b\350\314\221c\003\004q\017\234\250\t\310l\253\353\342\261\243\351\036\360t\240\301[#\372\206\0064g<\007\376\326t\273\241\351\016\364%c\274\211\201\3078\337-p\006\024\370\002ml\326\334\240\300Z\002'j>\t\331\360\260\345\300\261\276\203\336\r\246\336\032\3214h\230g=\004\276<6\235A\313a=\002h{m\310\363j\300\221\347\274\002n"
+	.string	"\001/"
+	.string	"\235\341\310nf\250\f1\234\220\003\001g\2672\003\234\250\271\227F\347\367d\343\352#\370\234\226|kD\305\204Y\236\371\0048\230c\223\031\222\251Tvu\001\2327$\257\214\234\357\234\001\005p#"
+	.string	"<"
+	.string	"/(\031\332\345\004C"
+	.ascii	"P\261\"'j\342\335i\212sGF\214\251\312\217\370\257\306\231\277"
+	.ascii	"5\242a-\2349\007\203\354\250r\230A\2242E\"\"\"\n\222\202\024"
+	.ascii	"$\215\001\342\r\b1\3100\212\314\003\022`\0021\b\307\201T*\007"
+	.ascii	"E$)\324h\f\\\037\273'\263\274h\017\360\221\\\3218\204\316\200"
+	.ascii	"\362\375@\2439\303w\241\204S\t\216Rr\034J\335\023\367g\223=\216"
+	.ascii	"\270\225\274%pFNL\344cl8\241\244\303\234T`\204\344\251\001\372"
+	.ascii	"\t\267'\233~\330U\215\035\030I{\221\341\341\233\321K%\004i\311"
+	.ascii	",x@\255*\206\212\306\224H\224\001\177<4\036\361]r\rm\"\342UB"
+	.ascii	"\203\007\212\326\035\222d\345\232\201\226\346 Kb\2772>O\346\004"
+	.ascii	"\352W\303\214\207\036\332\361\2630\001\314S\234\205\024\256\036"
+	.ascii	"Fp\257\341$\335\313\207\210o\234f\232\206L1[P|\003\003\316I\360"
+	.ascii	"3\353lf\223\275K_\3204\212\353,\031\254\324\345\207AA\226\376"
+	.ascii	"\n\332\020m\332\307t\214\350w1K\220\013z\303\0252\301\265\nJ"
+	.ascii	"\002Y\223h\231\016\260\2504\270\306\\WBk\305\326rVa\201\274\271"
+	.ascii	" B\276\234X\203LA\352\312\"\246;K\315\004)G\023*\004\320E\360"
+	.ascii	"X\"\022\247\025\004\247\3741q\320\313\211\031V>Q\270\022E(\270"
+	.ascii	"\230\334\354\232FD1f\021\231A/\201\267\341|B\214TAP\212\037\027"
+	.ascii	"\007\235\331\253\301\\~\333\356W\214\253\207\3246\272\236\277"
+	.ascii	"\314\273{[\t\220h\231\334\324\324u\276sm\344\n\002S\352\270\231"
+	.ascii	"h\315\307Q\r6\026_.\240\265^\020\255\320\233\021\r\223Br\232"
+	.ascii	"~1\2264\032\322]_\026\321\236t\331O\337^\214Z\323I"
+	.string	"\273H|\333\261f\253&T\027(\251\t%v\2700s\237\034\376\202\221\030m\353\204\022\233\2754@LE\266\267;\266lj\204\364\002%5A\306\206\033\362o\034\006\262\351\032\364\347\240\373\310Gi\360mn\243\314\326\237\025\030\370X4\261\025\024\310d\222\316\263H\f,\201\306Xt\342\027\227\200\017\320C\340\270q\372io\256\314\320\264\033\016\2764\365\030h\311`\b\2533\330\277\325\371\206\311\344\t\206\235\364\323cw\2458\360\335\017XaC\366\3355\025\325\271\271\243/\017\236\230x\b\024\220\234lsM\375\t\246\372\260\260\273\317\263\363\0248E\244\250\f\304\264\307F\235\2161\212\332\236\267\003v\321H_u\245\321\025\316C\224\315\213\017\227\306\021\341\304j\3231\023[\241\243\004\300\007\370\304?9\327V\006\246\b{L\250|\327<+\335Aa\t%h\354}\027\215,BKu1!\250\266+\032\313\300"
+	.ascii	"\344\235\273\260\251\230\373y\205\016\331sOB\3759\230\004,\331"
+	.ascii	"t\361\027A\354'$w\350&\n\212\266x\034(\007\344\\\333\013|\f\013"
+	.ascii	"\2220\222\356\245z\364H\026\217\022\316\232&\274\304\031\340"
+	.ascii	"\206\341\272\234;t\227IbEQ\250:\352\264Pi"
+	.string	"\343\214\305\020\242J04C\025VQ-K\365\001\342\305\241K\362\360\233\025A\262B\325\210\022\264\032\022h\223p\314;\247\026\242*X\230\255;S\312\035\305$\312"
+	.string	"U\271s*\270\253\330\261\262\351\244\316>\031\3012}1\216\325\310V\353\2315Z\371\034\245\326 \013t\007\226\346C\253\243*:\357\277\204F\2602\321\225\306\350r\310\237;v\244=\226\355\260\371RT\240d$\"\3511y\357\322\204~\023\232\275\220\3320.&\256*GZ\007)\314\3512\nl\275\231\3079X\246\033\337\035\022\035\311\337\321\344\267\236j\336\362\313i\3072a[\216\307-\3544\035"
+	.string	"4\223\236\251<\272>\202&b\350\n\027\205\236\306\224\341\030\257r\361\3213\275\337\313\370\026\305\336\237w.\341l8#\305\034M\001\004\266\371c\034\324\013\205\236\221\361\211\202\003g\364*\376\233\375E\327\373\320\f\007\3464Ch\237\003\231\327\365\230V\017\303\356\355\252\275\037\311\270\336\352\321\320{]\253wK\355\275q.\317P\245\344=\033\365N\354\007g\023"
+	.ascii	"w\024\316X3$PB\243\211\320\372Z\024\300\2513\221\353\221\363"
+	.ascii	"20\350\272\223}\300\350v\246\373\300y\241\247j\326\210\310\235"
+	.ascii	"\306\243\013\370\232\271\024\242\334\306y\fX\030\344\330k\317"
+	.ascii	"\373\376\035\264\326Q\343\306\312\2775\343\013U\351\262\212\002"
+	.ascii	"\301k\"\376\342\267\207\035i\367\254\361\236ZA\205a\315\356\375"
+	.ascii	"\220\003\224\242\327*\312\020\352z\\I\341\200\255e*\032g\004"
+	.ascii	"\3551,Y\345\315A13?`\267\255.4\336T\230,@\377\275_\376\022\362"
+	.ascii	"\213\023/\230\211o|\312\275\365b&\020\206X\347H\301\023\320\334"
+	.ascii	"\246\361r\351S\371\005q\237,\246\217\370\033L\032\031\003\277"
+	.ascii	"\335\b-\3244l\340\255\315\013\342\030A\337W,\213]\200\250X\241"
+	.ascii	"\357\324\2055#\230\241\315t\254\201\\Y>\020\270\325\027\246\246"
+	.ascii	"\276mu\205\261b\203M\203\276n\212[\340\375\336\"\"\013=\r\026"
+	.ascii	"x\0334\251C\003\335\357e\232\344\032\033\372\031\235\366d\025"
+	.ascii	"\303*6\325\227<n\362\300\331'1L\334\033=\347\303\235\341\033"
+	.ascii	"&\201z\007\246\363{\212&C\013"
+	.text
+	.section	.gnu.lto_applyAbsoluteAdjustment.79.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375`x'\335p"
+	.string	"*\267"
+	.string	"(L P[\031\016\247\200\200W\356\230\244#T\3370\264\f\251\326(C\2228\272\320\352\212lF"
+	.ascii	"Yb:\266@\260\341\022\001\fF\334\235\\\026a\311\013\325\177N\020"
+	.ascii	"%\0245\241\354\225\227\3721.\327l\001q\221\371\r\331\233l)e\n"
+	.ascii	"\223\002\035\002o\002)\377L\371\235\362\031\345\357R\371\241"
+	.ascii	"g\315\325\236"
+	.string	"\252z5\367\250:\bo\250R\326\307\034{\303\024\273\023\346\227\004\\\202\375-\277:\331D\n\341\006\231^o]nK.9&\2232L\255\272e\022\272%\037\3638\313\256\271'\250&pN\236>@?&\236\225igO\017\200~\312\346\222\216rp)\007\216\031\347\215\331gf\351Fn\311\227\206\271f\216\271g\267\324\253[\342\351\341\220g\327\206n\017\r\035\346\2319\314\271;r~KUU\307,\031#\373\366\027a\177F\376\037\270\215#a\337\236A\030\236\037\022\376\237\025:\375X\377\317\377\016s:\265\305)`^0W\347\220\212\004M\f\216\345\177\275\354\032\326\262\231\260D\252\332B\036\033T\225\255\305\237\206+<\333\360\377w\313r\301\372\351N65d\352\245E\313\215\251\252*\324\2115BWxn\021\272\302\216\262X{\270\277\335\355a\336v0\377r\266\0336\016\250A\303\200\031\005\310\210A"
+	.string	"\214\250\027\003\270\200zj\341\324\304B\200"
+	.string	""
+	.string	"X\301\244b)\005\212\023J&J$\221@*\022G\034\031\211(\nA4$\024\004\004\342\307\347\3030E\205g3\326\327\007\231\265\207{k\262wkB\246\213\037\246\215k\017\206kn\213\377\345lhK\366F\322\331q\t\232&\333\030<@pk\b\332\355a\032\006\350\331\031z\360\362p\0012\3746\206\337\336\312\004\300\230\263Qs\226O\016\277\030 \316\272\210\323\007\207\241\236\324l\0135r\364\330)\257\toY\340\255_\016,@"
+	.ascii	"w\013\300\335\332\231\343\025f\230\344V\205\334\002\226\341\245"
+	.ascii	"\024c\026\305\230\r\024\303'\342\224\326\326\304\3326\275p\211"
+	.ascii	"$.K\202\313q\013#\025\263,1\213\326\222GT9\242\262FT\270``\021"
+	.ascii	"E/l\210\027\274\\`\242!\265\025R\373*\343 2\240\261\0051\226"
+	.ascii	"\\\201\177\226\274\326\007\305\031\n*\354\207e\343D\005\261E"
+	.ascii	"1\203\2230\036\236,\310\362RX6N\224\247\321\032\2649ir\321\223"
+	.ascii	"\005\017g\376\202\220Z\247\221\027\225-.[\346B*a!\223A2\245\210"
+	.ascii	"\263\343\t\201\314<3qU\350\354\260\207\003\231.Z\246H\3313'b"
+	.ascii	">\310$(\267yb\3663\205\263\243\327\210\023\311Q\2370\256,\221"
+	.ascii	"\013B\036\317\0371\200V\326m\317'gG/\346\024\207\252\252\347"
+	.ascii	"-$\n{\006\366\027\246\375'\362\247\250 z[\302N;\3439\377}-\256"
+	.ascii	"w'\352\234\355|-\316Q\342\341kqOib\257P:\347\365k:\250L\222s"
+	.ascii	"Gb\257P8\3478_\323\365\016\351\315\327\364\215\262\270W(\337"
+	.ascii	"\271\315\327\"\036\345\b\035\316k\276\026\325\334\035\351\235"
+	.ascii	"\325|-\346)\215r8\343}-\276)E\330\235\357\276\022\377\356\212"
+	.ascii	"\322\234\351\276\022\373\224!n\270#\332+\324\206\257\304uh\257"
+	.ascii	"P3_\211j\204\366\n%s.\363\225\230\346.H\314Wb\031%\320^\241o"
+	.ascii	"g\270\257E\272\273\237\266s\230\257\3059\245\017\333\371\313"
+	.ascii	"\327b\231\273\017]\316^\276\022\005\225C-\347-_\211tR,\347\345"
+	.ascii	"W\242\336\035J\303\271\206\257D;\245P\206\363\f_\211p'\225s\225"
+	.ascii	"\257\3040w\375\302y\312\327\024\217\222\325\316R\276\246nv\257"
+	.ascii	"\320\0252\224\377k\021\360NU\263\226l\345-U\200\025\276\350\246"
+	.ascii	":y\352\032\017\236\355\276\350\221\235D\320\355\375\3433F#\362"
+	.ascii	"\235\362\020\250x\267\250\320\025n\253\220\242<\302\315m\264"
+	.ascii	"\030\302\304\3516\001u\321\353\266\254\354\022\330\026\007\t"
+	.ascii	"\353\371\331\216\334i\377\236j\267\360GIC3+\033\023"
+	.string	"\013K\202}!\275\272\232\277\\\315_&\315_\255\224/B\312\267J\371U)\237*\345\013I\371!\244|\020R~\220\224\017$\345\377H\371>R\376\007)_\252\371<R\276\006\315\317 \345c\320|\013R~\005\315\237\240\371\021\244|\b\232\377@\363\035H\371\r4\237\201\346\357h~\002)_G\363s4\377F\312\267\321\374\032)\237F\363g4_F\312\217\321|\030\033f7j\301\354\276X\266]\027\315\177j\376\212\3463\245|\025\315_\032\362S4\037\305\220\177\002\345+\r\371&\232_\"\345'\245|\022\315GJ\371\305\346\023S\376\210\346\037\245|#\224/\"\345\0275?D\312'B\371C)_\250\371A)\037\b\345\203H\371?\315\367I\371\037R\3760\345\247)\037M\371\302mW\347\243\327\016Q\03247p@d\303\020\034\227\033\275\310\033\275=\324\255\230\323\222\305\364\325<\267_@\025\037"
+	.string	"\336\330re>\350\005\024\332\322c\304\304\t\371\345\350\375\312\321\213'\313R\n\260\3464\373\rD!\025xc\273\205\221\352\r\004\0023\345\004\347\013\233\017\005\200Z\350F\253\275\200"
+	.ascii	"\300\354M\007\262.\312\004z\301\232\206\215\352\004z\363\240"
+	.ascii	"9!7\203\231\035>\245d\263\334~\233&4\330\346\215\275E\213\006"
+	.ascii	"\275\315\237\376\261\272\364r\252\205\032\026\2545\245\025\376"
+	.ascii	"9\372\212\216\264\022\024H\366\217\026\345\336qGo2nG\257\340"
+	.ascii	"\225\022Ia\3154\354\371H\002\203\343\215=\203\f\0304\037?4\f"
+	.ascii	"]\205\n\177\240A\231\307@o\030\003\315YV\220\212b\315d\366\254"
+	.ascii	"E\254@\353\306vAJ\005\315Z\303(P\206W\224tm\016\364\2129\320"
+	.ascii	"\234d\314\210N\343\270}\261\302\tQ\262\216\306\232\343\366\314"
+	.ascii	"e\004\001\327\215\215v\006A3W\312\302\224\212\005\272l\254\323"
+	.ascii	"\245R\356\201\336\261\007\232\231\304 \242\250\254\231\312\236"
+	.ascii	"\275B4\340uc\257 \326@\263\027\t\376\035x`\343\330\204\351p\354"
+	.ascii	"\254\243\375C\320\312)T\250\202\322\255-\202\336\262\b\232\273"
+	.ascii	"` \0322k\246\263\347/!\035_76X\n:\232\277\204( \205v\315c\323"
+	.ascii	"N\320k\326K6\252'hF\316\t\332!p\r\020Z\363\016{N\202\260\221"
+	.ascii	"\274\261\233t\331hN\236\3155\305\244&Ao\235p\177m\026\364\242"
+	.ascii	"\275\215\005\315`.\374t\232OZ3\234=\213\r\223e,|\3504n.\r\261"
+	.ascii	"\033[I'\241\321,\326-\372\330G\272\317\257-\203\3364\006\334"
+	.ascii	"\250\316\2409\254o\227\350f\313\233\241\233}\321\353\266D|\177"
+	.ascii	"Yv\370\322#v\263\3472\0130\340\335\272\260\263\316??*(\0174F"
+	.ascii	"{\320\266\003\227\335\310\203<\206\252\212$\306y\017\013n\360"
+	.ascii	"w %\205\2560Fg\351b\222u\361r\244\377;\261\236)&8\252\252\026"
+	.ascii	"\360\367\340<?\206\252\252\3060\303\"\013RBMU\325\235\262\302"
+	.ascii	"\335\252s$Js\223]\337\261\017n\360\b7\357\264<z\243\364Y\311"
+	.ascii	"\3376\367thT\363h\036\333S\313\024&\226\344\333\235#7\317Q\366"
+	.ascii	"8\262X\360A\200\001\007\362D\004H\021)*\250*+**\253)\244\036"
+	.ascii	"F\204H\215 \254\262\nRd\252\312\310\216\020?\202\370\250\262"
+	.ascii	"\322\321\243\210\324\004B\254\206\024\251\262\232\"\372\324\023"
+	.ascii	"\221\"U=\250\212\0201\002\302\007R\035L\r\201\232\362\001U\025"
+	.ascii	"D\212\njj"
+	.ascii	"\b\021\250'\245[\211\320c\bT\021+\253!P?lG\266[\370\232\001\016"
+	.ascii	"r\323\256\340\033\320\242\3656\353\206\326\254Q$\224\242\257"
+	.ascii	"'G;\326(\030\224\342\2125\n\366\227\264a\215&\353\2246\331h\330"
+	.ascii	"_\212\005kT\254\216i\277\032\035{\023\300\"\033-{kZ\257Fe\250"
+	.ascii	"{\332\256F\255@\031`\271\032\265\362\007c\2314Z\303\233\214\325"
+	.ascii	"j\024\313\023\003\202\032\305\362w\300Q\243[\236\340@jt\313\033"
+	.ascii	"\035K}\244\244\213\227\035Lm\244d\255\311\371\264\233\247.\335"
+	.ascii	"(\2752\004\256>\233\326\200\327\232\326"
+	.string	"\\7\355\212\346\372\373xN\353f\263y\303\002;\230\232\371\366KF\001\021\310\334xJQ\023\241\227\214\n+'\224\251!S\253H\023\366\367\324LO\275ql\022\320\261\324\214g\277s\bX\315\335x\242\235Y\365\316\245`\001\013\313YFV\302R\247\360k\353\203\033D\321K(z\345\356\344\300\201\324\\g\277hnT\241\271\361\024S\241\252\027\315\t%\026\026'8Ng\362\t\016\244>q\246\240d\006N\211F:\2676\252K\364\236\351\301\206_\2355\007\0345\373\355\327\256\006\225\335\215'\322\tU\257\235\211\032\316&XX\316\256\363\204\2436\021\326\206\330GB6\020{\351\366h\030\020\324\254\267_\274\031B\360n<\227\234ZBz\361\222\372Lr\"\t\352\2440\275\020\035\024\242\027\207\274\002dh5\277\355w/F\b{7\236Y\247\032B\357\036\211A\301=ZM\242\256\315\247W\313\247W\317\215"
+	.string	"\030L\232\333\366\313\027\005\002\337\215\235\207\tB/_\361\017\317\235b\032\030\275L`\364\256\001\363b"
+	.string	"\266\375\366\271\b\322wc\367\300C\220\336\276\021\353\224\223\032\2359\\=\342J\230\234\214^.\031\275n\326\240\236\272\232s\330\257\234\026@\344\334\330q\340"
+	.string	"\351\225c\364\306M\233\013\214\330\210(\263\234\321\3335\2437\016\016Ng\326\3264\235\331\257\037\213\037~7\366\236\232\037\275~EY:\017/\207\242\301\266\032\275^5z\351p\021 "
+	.string	"d\263\335~\355"
+	.ascii	"\340\303\316\215\001\202\375\250\202\260)\315s\206T\211\004\""
+	.ascii	"\"I\222B:\342\r\b!\n)X\326\001\022@\342$\305\323L\307\214F\""
+	.ascii	"\225\024\224\241\016\216\214\363$\207\240\363\326T]\3428\300"
+	.ascii	"J\243\226\210\333:q\013`\214\t\020,1J\230\363\323\367\273hwE"
+	.ascii	"\344_\020&\271\243\240\342\322\"\224Ob\353\313\312\244\206oI"
+	.ascii	"S\2212R\020\364\266\225\177\223\232\210\244\022\030S\254u_\322"
+	.ascii	"\210\273\304bB\206\006\363\376m\326;]W\270\244:\001tr\302V\362"
+	.ascii	"\345\210_(\232\216Z\024 Q\263\025~?\327\275mMm(\232\350\334r"
+	.ascii	"{\377\220\246\257\326V\323\216u\021\201w\021Q\200\357\013\357"
+	.ascii	"Z\002\240\377\331I\177\242\225\375\307\366e\f\017?\241}\351\264"
+	.ascii	"\242\036[^\003\2522\274\237\013\335\357o\314\220&Y\375\263\315"
+	.ascii	"\363\024\007\234X\232\217#\230\002\233%;PqR3\340\356\304\252"
+	.ascii	"\n\022\024\374\357\374#\215\013\336\3123\177\237rFU\373\327]"
+	.ascii	"b\244\374S%\336\307\332\327\026\245\022\022\267\037\030,|\007"
+	.ascii	"$w\335B65\023v\343\2371"
+	.string	"\327\340\221\005JR\220\003\035x\261\312\367\222\300V\003\240\232\205b{ltm\261*\002\361\216\003\303\202\367\200\\.\025\310\246f\302n\3743\346\032\216\362\205\024\304\030\b\3539\006\275;5[\334;{\242\241\312\241\200\f5\271*\003q?P\234\313\b')Lt*\"\315R\274cu\276e\200j\345\336.\001V\001\253! \372\347\353g+\\\373\354\325'\202\b\364\035\256\347\034\204\274\204\307%\224G\363v\234\r\022\253:X+\362-\326\363\317\377\333\317P\340\334\317_\336\021\177\257\271v\357\007\f \270\210\267;(\352\211\322\001\023w6\252k\362\357v\246\347\2669'\265D<\034\270y\253\210M\027\324m\265\201]j\271/\244\320\343\n\033gh\327\336\214M\366uw\305{\230\272\211\247\316s\376\374\227\245\300\317\357\257\017\340\277KB\266x\352!!\241TB=\236\247\017p\300\032f\3067\226\346\343"
+	.string	"\353;/\330\246\335\027&\356U\245!\365\274\370\\\265\326\023%`\303\334w\364\251\303rX\347-\236\363\375\343\370\243r\003\267\030?\332[\360\342\021k\213AA2\211\352\330\230\023W\360\307"
+	.ascii	"\343C,\276yD\234\345l\020\255\333\203\241\361NK\357\231\255*"
+	.ascii	"\345\240\241\020"
+	.string	"Fb\341\024Z\311\032h(\007\313\354\002\215\352\013\200\344$\207\320\342\306\020M\315\213\206\372:W\032\340\003\030M\342\252`g\212\340\216\226\377E\03467N\324\3549\032\335\205\bh\240yvr'\275\024\323\031Z\312\351\013\204_\033\367q\035\326\206\230\271\304\2057\255O\341h*d;F\2701\025\351\f,\271\001\354~\022!\r\364\254q*\250\234\301\031\217\2331rLM7V\224\034\310\222N\b>l\221_\370Gr0%}\332\332\317\374B\3023\200\366\b\253u\367q\b1\345<LJ\205k\263\222U\267\365x\306e\035\263\315A\036\223L\264\205\035c\305Hf\302Z\357t\272\222\231X\303$\360\302\233z!c\332\332\326$Nb\366\267\347\236G\370\235\367<\302\355l\272\355m7\353\006\260\360\321\270\325W\266\310\352/\300)\221\025\363G\026\200\252`\024s&\037\202\214\331A\005\200{\022\273\220@"
+	.ascii	"\374X|2x\350\301\320\3006nMg\316\251\312K\250\"i\304en\3138&"
+	.ascii	"l\0273\2575j/\317\242\251l\027\335I\247\252\345/\016l\007\224"
+	.ascii	"\367\t\314D\3348\232\223\325V-\t\233\303jf\373{VC\326\036\256"
+	.ascii	"S\f\002\236[\314,\231J\336c#\351d\006\354\210\216\322cG\217,"
+	.ascii	"c\322n\232+\315\215\034%T\t\304Fi\372\366\031=z\236I\036\370"
+	.ascii	"I\0078\215B\272=\005\022\347|=-\300\274\352\232D\373j=\224\250"
+	.ascii	"g\300\204Y\302\232\277D\345MZ"
+	.text
+	.section	.gnu.lto_applySelectAdjustment.80.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375`\314\005\035$"
+	.string	"\232AD\016E\200\236M:\3234s\356\312\240\306\344w\203\004\277\361\335\021\321\201\341\264\365\316\261ZP7$\212\303\206\rF\234\240?Z@\323V\332\244hT\246\032\261\r(U\2678L\212~8\360\272Ywk\322\2104\271S\n\325"
+	.string	"\300"
+	.string	"\320"
+	.string	"\257SU\006\036\257\033j\265\032\033\2744\206s\351\215\300\017\250B4&\024\316\227\246\324>\225W\251\361/\032\306\325\232\345\307K\255F\007V:_&\275\310|i\373\220\371\322\266\037@\250a \001\033\301;IO\222C,|j5\362\026\311\201\007\260\323\345p\347\315,mK\201\376\361\026\204K\222\304\252\340\001\\}wu\034BuT\310s\007\262x\024\217;\033\252\342X\020z\332\212\326\030\231\303"
+	.ascii	"\353L\217\213\375\200\023*+z{\026\017!7\177\274\2641P+\323\023"
+	.ascii	"\240j\312V\264c\t\361`6\250\315\226d\0069<\033\252+\233\201#"
+	.ascii	"D\326~<\305Q%Ew\230\253\022\232E\\fJ\236Eu\265"
+	.string	"\3646\241\326jJ\254\342q\007\270m=\266E\330\345S~\227\253\260B\006)\240s\231q\235\355j\371_|0\004^\244z\riR\213\220\371^\\\347\334\235\206\371\3626v\013Ie\001\027\333u~\366\007kH\255\301c\271\016%\326\005/\005,\005+k\262\246&E\003\331F!]-\373\233L&\327\274G\354\222\032\351h\251\215\210\236\345\036*\251\205n\374\203\376\365\013\270\225{\267\324\272\222:\267\324\270\245>\227\372VR\233&u\271\324\273\324\264\244\276\201\025j;tT}+\254\326\035\311?\025Y~a\362,\277\225\217i\261\207\242Y\224_\361\305\262\314\200\342\205\305\341X\016f\353\034\343W\\ lL\255U\027\303\326\275\244v\r\377h\235m+\300n\200\020\266l+\275M\206\004pj\255\0224\034m\303Yk\215\300\006\252\003\202\255\256\237\371\322\\\bI\276\242h\322\276\232#\177~\227?\200"
+	.ascii	"a\276,\367=\212dkVF;$D\307\314\3345Z\323)<B\232t\320\356^\354"
+	.ascii	"\036\204I\366\f\003\275\354\n\322\244\334V\353@3h\217\366\307"
+	.ascii	"\333\316\212[\216o\300\260\204&\021\245{\262\373`#H\224\033D"
+	.ascii	":\2469+o\302\024\332\023\007s\211\2231q\326*\025\301\027\363"
+	.ascii	"1K~\327K\367|\364D\237\371Rh\245\344\340\203U\345kG\351\332L"
+	.ascii	"+\350\211N\222\332\240\203\226\356\315\310\326\236a\240(\232"
+	.ascii	"4\030\257d\035[\320~\237\216iR\264\217q\324vzAO\374\036N\232"
+	.ascii	"\020\244p\203\001>\030,\226B\304\3605\235?\027>\337\211\222\351"
+	.ascii	"\347\344\342lrb\202\3525\301\250 \344\236\322\017\252\311\327"
+	.ascii	"\002\352\007C\005\212%\023\275'^/\005\257\211i\251\005\257\367"
+	.ascii	"\364\343)\031\260\223\013\337\023\017\312\311\351\211\2473F\335"
+	.ascii	"V\367H\020R\216\032d\324\n\375-\267\001\330Q\335\332\026v\253"
+	.ascii	"sR\324#|\023f$\003\206"
+	.string	"\313n\265|\261\037\b\230\231\216\034\321\276\313+\310\220\314<\332\335\342\260\201\346\3569\246\254\261\203\346\tW\206y\272\350r\273\377r\177\f\201\017<|p\253U\346Hc.q:s\220\366cC\233\026\007\316\313\024\303\254Y\235yn\211\226\002\232\302\302mn\013`9\317\305\355\021\232\251)\2675\332smn\246\232\230{\333\036\032W\230\325\312\362 \317\325\032Zs\237e_xn\250a,\304\020\223\246Fd$H \205I\213\001\200\002\221\2513\036\021\220\265DC\025\246\205a\016D\210\225S\302P\376\2763\007\344\024+\216\034nw\362\330mO\"\3010\\F\235\360\201\336\231\036{\232\252\363\3126{ZM\306\270A^&\352q\344M\250.\243\230I\371C\275\345\033\nXA\242\"r\302\352\366\320\037\207\266\305\016\326\351\213\271\266\307\021\361\340F\337\274F\223?\262\254\031\340t[\n\031\356\273\016\332/"
+	.string	")\2672\336\225\376E\210\245\331\r5\325\243\330\n\034fE/?'\364][h\374\335\333\225\013\262\301\277\324s\265\203f&@b,\022)\332^\265\226&\242,\206\th\221\035s\205\223\356\362[B\024%H1\216\007\003\266\322i\330\310\026\337\023\030\341\242\200"
+	.ascii	"\034\327U\310\243\216\270\002W)\325c\223\002C\260\032"
+	.text
+	.section	.gnu.lto_calcActiveAdjustmentRanges.81.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375`E\004\305\033"
+	.string	"\266r\260I\240\230Q:\200\341\370\273\266\235\307S}Q\026&\f\370/\311\354q\004\016x\205\022\2676\243)|\272O_\206\354^J\253\252l\017[\243\336\300\353`"
+	.string	"9N\016)%\237\2703I\207\350\222\370M\237o\215\020B\210\334)\005\232"
+	.string	"\216"
+	.string	"\241"
+	.string	"\347I\006\343\n;v\362\3779\346?\275H\356>\240\327]}=\0051\223U\353\221\354\244m\316\223n\362\002\345I\330\t\224'\235\263\261\016\260\250:\bA\310\024\r\271j\255\263\325a\005\037\201\367Is\177\235fI\216Ks\376\357\343\215!T;\236\356\257\221\032)\321\375\312\321\214q\302\026\220\342\207B\3644+\344@R\272\231\364\022\306K:I\024\343\261\240c"
+	.string	"^\321\310\200x\352\2027D\367\303whj\241\265\204\244tjV\250\265\232\356xH7\354\266\205\330\316\261\307\004\001\236\362yx\307R\364\273\223\276\245\312\223)h\024\271\304\004\321\242a\024vO)e?\360\277[\200\035;\273\347\004\375\316\016\274\224\251\"Z\235\r\024\242\313d_\200\220\213\221\027\207]SR\323\\x\277H\352s\251\315\245.Ijr\251\307\245\336\221\232.\365\r"
+	.ascii	"\320\362\205\367\036T\265\302(\232\251U\244\223\036\027\376\276"
+	.ascii	"S\373\276\221G\3311\2578\224?\2467t\252\265\022\355\330\201\376"
+	.ascii	"\360\310\203\271\013=\365\212To\304\325\324\"\253\326z!\273\343"
+	.ascii	"\236\310\206\020-\232j\367\\=b\227\222\313`Y\235!\227\311\037"
+	.ascii	"J\272_\nv\261=\234\312\207\227\216\212\017\033O\265\016E\230"
+	.ascii	"\002\264\006\264\254\2020\236\242\\\212Oy\222\356\217z\304!\276"
+	.ascii	"oUIbf\\&\313\376\305\005\257\206(\031\017\240O\362C\375w;i\326"
+	.ascii	"\006\021bO\374_\020\265|te\021\255\316\217\372\324m\207\217\262"
+	.ascii	"K\\\nh\251\270\324Z%8\371\023\232\317\343\244k6[y\222f\037\365"
+	.ascii	"\f1j@\371\261\205DF\020-.\030\"I]\333D\3472zB'\331}%_\022\036"
+	.ascii	"\261s\233\016\017m\203\205\237\022(h96\0215\256\331\370\374\360"
+	.ascii	"\330n?>(H\210\240\205\250\341f\265\234\031\317\016\3556\253\341"
+	.ascii	"|f6\013\334c\302\206\233\375\364\364\340f1`\320\261\232\252\202"
+	.ascii	"V\310@c\255K\024\356\373\177\247\311:B\213\257e\262ye\326\354"
+	.ascii	"^Q\331_\353\302S\345k\357\373Xk\255\347\203\277\266f?\374M\320"
+	.ascii	"\211\t5O\334\277\334\314\274`\300\241\337\235\213\300\354\242"
+	.ascii	"S\256\271E\247\334\322\251\007U\222k[\305\255n\032\354\360\261"
+	.ascii	"<\213\006\01688\345k\311=0,:3\256\225\235]\230\007\017R\2501"
+	.ascii	"4\205\214T\006\231@f\202\231\240\266 m\220\002\031\252\252\016"
+	.ascii	"\0210\265\225\310$\005i\3753\\\305*)\215\275p\021s\241\363\373"
+	.ascii	"\335R\333{\fr\206Z\261\264\200Q\027\274%\201\036\017\312ni\243"
+	.ascii	"\324\306/\2364\312V\300\340\217\036\244v\253\235^+\223\237\213"
+	.ascii	"\263\002EK\t\237!\221\230.;\340x\332\244\303<\020\270\320,\240"
+	.ascii	"\b$`\210\266\023\2608\252\233\276b[\352H\336\311\352`\306\306"
+	.ascii	"BU\205D]\021N\245\334\202J\373.\221\326p\230\tV\b\013\213}?\004"
+	.ascii	"(\240 \303q\234\3273\263\364\352)MW\205\242\240_g;\250\333\324"
+	.ascii	"\2554"
+	.text
+	.section	.gnu.lto_updateAdjustmentStates.82.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375`\254\006\335%"
+	.string	"\352C\350\016Ep\\N:{\250\023'\340_\326QgI\341{\033\216^..a\376B\307 \f\240\205\223P\336\025\315\341u\256\003o\230L\243\334e\203\270\006\030}\302i\214\266\035\311\301\223\"\226_\247m\2505\262\211\224I\006\325"
+	.string	"\312"
+	.string	"\346"
+	.ascii	"?\223q/\033\241\270\326e\313\271\2347\243\nP\331\352\211b^]n"
+	.ascii	"\265\032\225z\247k\354]@)\203\306\265\354\343\212i_\273\317\262"
+	.ascii	"\027\333\033\327w\372+\307r~l\325^\211\3656\346\274\204\270\325"
+	.ascii	"Z\027\234nR\3574\301\213\312S\362\002\312S\366\355\271\333v\204"
+	.ascii	"U\253\224\274\200\004\267\314\325Z\177\315\265\007N\032\277&"
+	.ascii	"\237\0072{%%\233\317}\330I#af\302a\325\201H\036\326\216&g\313"
+	.ascii	"\362AB\250sC\273\361\212M\336\004$\304\036\357)(B\324zI*U\261"
+	.ascii	"\001FhX\203\364y\221\223\362\263+\210\222\245\305\3247\304b\222"
+	.ascii	"-K\213L\220\345\214c\b\344\276\361\035\274\204\274\025!\3668"
+	.ascii	"\363&\324Z\227\205C\342\327\367\3355\356n\323n9#J"
+	.string	"\260<mJhN\255\300\013w=\274\314\207\013 sL\022D\254V\340\203\323\223\355\3068\032\2106z\203C\246Cl\314\311\204\020A\202\251<\355\346\031\261bF\310\343\315\315;\006\355\254\370n\304\3038\365j\255\020\366_\016\346\304\276\353t\237T\360\205\247{\025\345\351\373Y~\201XL\003C\263\342\27363\2035\354\336\3325^\361!$\251s\333>\262K\362\032 y\013\220\274\004L^$\223\367\210\362\0325\357\200\242\233}\211>\366\035\242\274B\2247\210\344\005@\362\372(/\020\3455I\336^\217\227\307\343-)/%y\311\222\267)/\223\274W\020\324\226cx0\271Zw\334\371\251l(\232\223\233\375c\347\335\357\313\002?\216\\pi\312\001M\324%~\266\247\223\303Q\361\200|\276j\255\017\232\316\347\20424%\317\227\236\3579\245\354\317N*\247\027\237`\345\351\200\376\331\371\213kH\220+"
+	.string	":\250\217'h\027v\267\245\240\252<m"
+	.ascii	"ZI\311\225\337Yz\021\221\343\024;u|]\246\025\327\350\346PIH\262"
+	.ascii	").\347\034\273\032\234\307\241@V\260P^h\241<%j\362\217\220G\322"
+	.ascii	"\315\006\352\003p5\202\\\361\335\366\332\354_\270\233\245#A9"
+	.ascii	">ak\323\353w\371\005\036\3055\260\3357\2706Gh\206\222\327\016"
+	.ascii	"\332\034\227\220\321\331\305\3605\031xd\216]G5\274\216QT\243"
+	.ascii	"\373\032\257~7v\264t!{k[\224eK\221\325\001r\335\"q7\355]\r\033"
+	.ascii	"\370\302\262\023`u\325\222M\373x8\374\314\222\217\210\2315\262"
+	.ascii	"\033\004\213\342\304\223\t\250\250\n\001`85A=\321eJ\232r\001"
+	.ascii	"\345\264\302\305\324\213\024M$D0I\375\230L\374\240\236H\254\370"
+	.ascii	"1IM\375\222\020l\024\013'\251\237\213\250(\251\237\317h\365>"
+	.ascii	"\022\366\333h{cc\325W@\275\265ChzE\335ux\301\207\032\307P\013"
+	.ascii	"u\2055|\203\205\253fd\323\370\302M+O\205\032\001\035-+\276;Y"
+	.ascii	"k\255&\203\017uQ\337xZW\024C&\207\013\367\ft\360B=\005\232@\033"
+	.ascii	"0\203ZH]\240\227\203v\313@\306r\332w\355\271urq\225\247\004\332"
+	.ascii	"\324:j\244~\320\207Q"
+	.string	"\037u\203\t\332\0055\203\033\365\263\304\230\325\360su.)\225p\325\271\204\226\311}q\2753\201r_|\210\234\374\017\025-\213\233\363\323\207\227\026G\367\303\327LN\347D\313\342\346\344\3147q`\001v\250Q0d\fdH!\022\221\t\243\005i:\200\002\031\232\253n\021p\255S\210F&TXp\177\003ZU\031$*\354\362T\243\274/\351Orr\367\341\252\212d\315\026\343\226\263\236\226\264\005I\323,\230uy\007:\362w\242\374\206\261V\204!F\t?\376kB\350\326\252c;\363\313\350\342:\213.|s\344\321\332*-\232\365\210\376\202\007)\333\245R'\263\210\367\214\n\326\230\256p\021z\205\373\210e6\3125\031\360==\342f\202F\333aC.vh\311\235U*\366\223\213\322V\016\214^\326\"\217\bN|\362Fy\177\022\220\022\340\261\322\265\204\302\025\n\301&\222\324'<\367B\275L\262"
+	.ascii	"\0039t(\241\257Q\301\020g\237\222\375\305\002\313\201\265\205"
+	.ascii	"\371\303\241;\373s\334BQ%\371\016\241\021\343\364\372O\370D\020"
+	.ascii	" \361G_>\r=<\031\260\316\315\032\274\216\2460u&\r"
+	.text
+	.section	.gnu.lto_processRcAdjustments.83.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375`\003\027\235o"
+	.string	"\272\274\364)K \020\333\031\003\244>'uG\231A\255E\267\266\326\214V\350\375=\205vh>\375\216\232\371\3243j\350|\350\020w\330q\002\027<.\030\247\0030$\210R\335\233\272\017\237w<\027\300#\337;"
+	.ascii	"\214\004s$i[J\231RJ\001\207\002U\002\226\002BB\316A\2553P\220"
+	.ascii	"\263\261u\376\001r\3661:\027\215\316=F\347\366\307\231\347\307"
+	.ascii	"\231\330:\263E\347\325\307Y-:\177\217\263\267\316-\002\223\027"
+	.ascii	"8\276-T\260|\233\350\033vh\347\325[\361\330Z\257\373Lw^\363x"
+	.ascii	"\227\351\226v\343us\351\266\353\246\353\216voi\037\346f^\243"
+	.ascii	"w\005\005\301\024>\3504\334t\236S\346>\303]C\243\311+\001\007"
+	.ascii	"\250\035\301%S3e\356\276\270\325Q2F\312R\365\245\233\001\205"
+	.ascii	"F\001\343\271\343\016\303E<\226\022q\002\r\023\364\352\271\376"
+	.ascii	"\302\\\344\020\372\216_8\t\2134pwi/v\\\375\216\275\315\214B\345"
+	.ascii	"\215\340\221\207\013\262\337\345\013\304\rj\202\340\373F\255"
+	.ascii	"Z\216\273\216\216\245D8,z\257\004!0\027{][K\307q\221y\206\206"
+	.ascii	"s{\013\220\247\257\350+VT^\021t\200\247\327'5\305\n\267\243\""
+	.ascii	"<yE\3370\"\237\333\027\267:\357\033-\321+W1\2673\267[cq\373\215"
+	.ascii	"\204\026z_'~_\3367z\202\247xz\345h\033\261\275\3624\021\333+"
+	.ascii	"\273\314p:\252\366\"Qq\003\213\253\363\276/\325\263\320\324$"
+	.ascii	"\305j\253\321f\246w;\204T\024\210\017PON\"\232\230<,)%!\035u"
+	.ascii	"0*\"\032\022\n\0022\376\370\024{Z\036\"\273\252\357.\267W\207"
+	.ascii	"P\211C\302^\350\275\246\027\325\205\241 ^\233\311\342Rv\035\325"
+	.ascii	"\245Ap\361\017]hp\250.u\376\264\327\354\242\222@C\347Nv-\242"
+	.ascii	"\255y\027\347\305\233T\0376S\230\364^\363M\025`I\0276]7\304\231"
+	.ascii	"V\030\303\322\036\210UKJV<\251\205Xi$\225D\025\325h\f\324\217"
+	.ascii	"T\022WT#6\357\2006v\245\215Z\220R\344\002\024'r\002U\2133$\264"
+	.ascii	"\327\\{\342A\304*\264\261\026\032H-LC\2655Sp\343^\363\005\365"
+	.ascii	"\251\255i\346?\003\020\361ik\226yi\250\275\346\323\213Phc\316"
+	.ascii	"\356Q\225\314\362\216\364^\323\251J\255i\362\327mM&\336\266\370"
+	.ascii	"\223\302\243\222\020\004C\247\367\232KT\243\260\027\230\335\326"
+	.ascii	"$sb\027\025\2778hcn\315\252*\376\304\230\030\305\300\324\242"
+	.ascii	"\0218l\332\313\322\327\256\353\265\t\026=\267B\2641,\255\036"
+	.ascii	"\351W\005\030R\347i\024\373R}\f\301l\350\270\366\"bJwb\325\373"
+	.ascii	"\276\354L\261\261\346\021\315\354\177\314\254\206\271\310D`L"
+	.ascii	"\330'\276jW\343M4\373\035\224Y\356\226v\326\317\301e\373\341"
+	.ascii	"\264S\305\260p\215c\016\342\320.\033{\343\327?\202\3132\2674"
+	.ascii	"\013\204\241\013\230\036\267\005\326\003\177\236\220\303\032"
+	.ascii	"9|j\254\336\203'\316\001\233\376\337x\253\357/M\243\355\351g"
+	.ascii	"\206\214\\\024\245\037\272\320s\\\266\027NB\034\344\374\277p"
+	.ascii	"\022\026\266\333\233\250\r-\243y\005\305x\270X\036\377Z\324\260"
+	.ascii	"IiA.\236\367\375b\301\035\030\304\235\322b\324\336\367\345\361"
+	.ascii	"M\346\234\003]rC\024:\304O3{\037\2559\252l\030Y\2348\331Oc\356"
+	.ascii	"\036\254\377V\f\r\330#\2103\220\0053'\377\372\317\245\322S'\034"
+	.ascii	"\027o\372\006\027\312\r\245Wv\257\270X\274\231n\026\266W\377"
+	.ascii	"\366\322\252\2413\260\360M\210\037\272tM*\266\0360"
+	.string	"\"p\212\236\332\344\314\t(\340\315\344\246\013,\323S\276\027sT\331Bhj\316\374\24713\363T\367\347\200s\363\345\206\314\335\327lX\312\r\205k\260\030of\257\334,\206\355\265?\351dSH&\304\017Y\311\231\035\200\300\233\211\343\235\226\205*\024\n*\337\213\217\234\231\202\n\274\2317\276\343\272\313\226\204z\205\202\312\367b\216*\233\245k\322\025\374\323\230\233\245k\322\025\370\2350\033\235\2034]3\220\306kF6^sW\353\354AK\233\265\232K\363\321\350\334\243\355\232yt\231\346\254~\353\336\321z\315:\372Ls\216\242\263U\3475k\320:g\320:c\320\321f\034F\347\013zK\363\215\326\031\202.\323l\243\245\315\r4^3\003M\327\\\243u^`\310Y\001\037g\032\255s\002B\3163Zg\031\2553\002\255\363\001B\316U\255s\214\326\331\200 \347\002\212\234\th\235a\030\235_\0209\017"
+	.string	"\344\354B\310\271E\2203\213 \347\025\255\263\212\326Y\200\3269\205\321\031\205\3219"
+	.string	"\2433U\353<et>at6\321:\227h\235I\264\316"
+	.string	"\264\316#\202\234E\264\316!Zg)\243s\224\321\031\304\220\363\207\326\031\252u~j\235\235Z\347&\2433S\321\331\203\321y\311\350\254\364\343\234\364\343\214\324:\037\265\316\035\214\316F\255s\221\321\231\250u\036j\235\003fN8\3126rn\304\303\t-A\336\304\2378R\342\203<{\026\023\337\344\206\254\304\232\3449G\331F\316\216\322\214T*e\351\3238jN\311[\022[4\247\304\fI\353\033\370\"\3146<\203\347\341&yC\217i\242\350\340\241\336\220\367\342>$\361\031`\360"
+	.string	"<\t'\340\322\212\324c\360\354\314\301\037v\246\036"
+	.string	"g2giF\374\202\340\247\236\2453e\304C\360\354K\034D\374\210W\357\270mNE\006\021!~\211\217\013!\330\264\201o\243H\375\022\034\227\300\245\025\245\022\222\215\372\237\002z\0332\212KI\006&\343$\345\310a{\215\372\026\363\204\250\246\274\222\364i\334-\004\370\316Az'\354\263z\365\335"
+	.string	"\342\265\336\355\222s\334\005do\201R"
+	.ascii	"\210\3571M\243\371\314+|3\322\"$\314QKI\351\343\3530\303?<s\262"
+	.ascii	"0\231\303\227\263\340j8\222w\222\207\336\314\344!\333\353\207"
+	.ascii	"\177\361$S\030\303\031x\250\337\361\314\256\322\035\362\264|"
+	.ascii	"/V\037\352\001%\r\204`\323C\365\331\215F\240\260\226"
+	.string	"\247\004\203\034\221\242Oc\242\021\031\204\272\376h\316\210\031\020\362\031\370\"%\372\351\215\211v\372\247o02e\323;}/\247L\337\364\335\204\351'xJ\241d*\334\2300FD\205\302\ny\354\301\317\\\266n>\357\352\270\n\236B\037s\260\t\373\306{x%\270\272\303\245\262\036\257\364K\337a\222\276\207S\t\351\223\216\036\351U\300\243?R\326\021vO\025%\222\241\016\3375h\364\035\276\227 [\370\221\371\031}\247y\332\031\221m\311\"T\364\006\227\227\254R\3649\232\324\221Y\232)\203\210\036\371~\007\314\221 [\250\261K\304\217\270EzUA\364\235\367\354R\370\346\364eN\f\320\247\361\020\032\\\232\246k\226\262B?\364D\351\322,\350\205\334\023\\\314\r\3630o\272bF\\$H\330^\203~\305\2237\343\003}\353\360\023\\%<\354E\334\004w\211\323-+c{5~\213w\374\237\3570\335"
+	.ascii	"_\335\034\3304\306Y\030\013\3063\326\347\267R\360\022\3343\036"
+	.ascii	"\237o\262\347\034\364Mm$[\374\343\373\235\245Y\023\037\342\246"
+	.ascii	"\371\227+\213\337\203O9(Og0\273\3731@\r-\211\217\b,\216\177-"
+	.ascii	"64\201{\363\345\206}\305\236\347\276\343o3\007/\370\366{Z02\236"
+	.ascii	"\277\340\331\301\246B\372NO\3354\227\005\367\311\023\266\327"
+	.ascii	"\366[2\342\363"
+	.string	"|\007\314\001\007S\\>\262\272\220TG\255\016:\320\272R\302B\372\260\002a\315Z\263\232+\213K+\002\016\256\272\262B\340\002\262\352\362\201\245c=jeu]\035\2214\206|`\035\217V\034\\\371\374\300\322q\254\001\024\202\326\361\255\272\254f\374\230"
+	.string	"\213\253\202\243\325\225\317\006Y;\216Z2\260\272\254&\360\241\265\325u\324\272\022\342\253)\256\256#V\007]\\H\036:\2542\270\332\242\272\332Au\314\262\352\200\352j\213\213j\312\211\265<\300\332\242\352\322\322\332\242*F\205t\225\220W\256\205\3704\006b\022\225\365\377FD\211\266\361El\374\002/#\315\177\261T\n\213Y\340\217\334\250\357\373\276R6>\353\333Lc\320\344\216\314\322H\224\002\357\245\3003\331-!\333\341:\236\306\357\210!I\005\206\n\313\367\222\342S\256:w\354\320x6J\231\241\253\344\310\257\020\210\317\314\034s0\201\227\361:\336\355\226f3>\001B7\314\227\342\320\2313\343=\320\315\033\002/\343\233"
+	.string	"\227V\016\370\030\217\300+\331-\333\252\376\200o\250\017\272a\235t\366W%\216`\325w\337\223\267.'\006|\214g\355\nx\003\276\301\246\200\177\005|\257\351\365H\331\034\024/(\212\ta@X\300\022\360@k\376\246\344\360\001\036\006\226d\026o&\001\377\364\342a|\003jq?d\361\254\r\233\027\177\342\311\233\333p\201\321\357}\277\232\311\234\204s\276d\\\023\201\371\203\301\314mo\315"
+	.ascii	"OlR&\220\231\004\305\235\037\332\207Oc'\322.\276\030\347\217"
+	.ascii	"M\215{6B\231\\\225\367\375r\311<\215;\205}{\036\326y\337\257"
+	.ascii	"@G\223\234S\223uI.\254\213\037\241L\016\232\204\215\016\022\250"
+	.ascii	"0\266\305\003\211\375\265`\347g\3340\242\226?(f\312\264\370\037"
+	.ascii	"eq\205\rE\315\337\332\323\2471\213_\361[c\304\2704y\247\225\004"
+	.ascii	"\003\206\355\225\305\253x\202\227\304\361\300\254\370\026/\307"
+	.ascii	"\253\370\242\262\f\031\260\351T\247x\001\276I\2724C\361)\276"
+	.ascii	"\303\370\035\262\217\342\264\261\343\305\016\305\263\323\347"
+	.ascii	"a\241/;\200\317\221\224:\027$\220X\233:fnj\230\223oNC\222\314"
+	.ascii	"\037\305\351\233+\301\315\351\274.i\246\206$\0325l\257\001\034"
+	.ascii	"B\337\250^\203o\300$\033\227s\323\266x\\r\r_\262\257\217\355"
+	.ascii	"\225\352\033M\257b\236S(\336\317\221\031\"\346\344B\315\020\216"
+	.ascii	"\210w\342^\215\343\311P\270r&\207O\255\351\323\030\205\241\007"
+	.ascii	" \377o\324\022]\343\213p\215\377\027\372\327\244kU\230Lt\215"
+	.ascii	"\007\362]\3274\002\201\262\250a,\344\024t\250FD$I\n*i\r\021\005"
+	.ascii	"\204 &\251C\333\0210-C\216\321\210$M\n\355\0335V\321\260\f\224"
+	.ascii	"\022\262\0138"
+	.string	"\\\300vB\365R\302\227F\033\002/L7b\272\275('\016\355g\316\215@ h\361\037\263\033\205{\033XO\017\260`\240\240\003\262C\f\352\f\327\212:`\236\205\307\224(\371\232\244r\307='\325\031nr\216Y\tYV3\266z\254\241\177\350\3614\267Ai8@\206\263\232\254\2778\376\004\332\335\233\001\305\310\337\261\"\336\367g\256\033\365\224\255\240\004\355RR\213@w\t\256\025\236r\335\035\252tY\266\344\\\2341\230\366\242\321\241j\177\376\273\033b\206\231*}U\200\212\225\202B\303\247i\331\n|*\252\267c\230\243\222$P5\231q\335\240\316\241\353\013\272?\202\021\033\244wL\302\230g\362nY\355\222\3573\243\306\001W\344\353QG\264\332\023\311\020\031R\347\300\257\006LL\323\313\346B\0352\301|\317\220\251\210\375\344k'\314\346!K%\312\302C\366`T#\215\017B\003\300\350\363\t\306\241"
+	.string	"\201\334\213\310\302`y\252\357\272]R\261\362\003\245\215\355\302\354\031\210AT\032!N\267\361\200\325l\006\206UK\307\303\376\354\226\261"
+	.string	"\221\222\r\037O\254\354\206\204\253Y\017\036\215<\217dGo\005\304\245!\364b\337P\f\323\033t\210\264\203]!\373\350\202\324-!d\355\322O\332\016\\\225\270g[y\367e\357\246\001\317\326\347fB\3620w\022?\232 \352\217\004\332YA\320q\342DC&q\272\204\003\2707\217\230\331\247*\324\251\002\221@:\223\rm\n\3014\260\254I\377>\3107\037\244Y\266\304\223\210\375|\206\034h\264\316\037\327\034\243\250*\353J\242\355\355\274\376W]\217\017\024\352\267\033\366\020\256\376\312\364,\233\017BkC)\003\222.\204?\032Q8\020\236\335Av\337"
+	.ascii	"\250\307\276\325\313m/?\347\344Tq\"#\3306\240@2\023x\3033|I\250"
+	.ascii	"\"\310\214\232\346YC=2S\236\312D\375\0364\306\356b8\206L|v]\216"
+	.ascii	"-\205Y\346^@+\201g\310\276j\177\016\240\243\227\027;\314\321"
+	.ascii	"#,\240Ph:Ov(\371{c\231\363\007\355m\177(z,\337\244\364\261\301"
+	.ascii	"w\350\366\024\326\013\271\001%\301\225>\345\271\304S\335?\353"
+	.ascii	"\230\346\256L\330a\210\026\360T\356\274\207\035Np#\272|\377`"
+	.ascii	"\242\201D\363\212\325>\022d\230f\354#\217\220\250k2w\331\020"
+	.ascii	"P8 Oc/\2146\233\250iq\202\216\021\311\373v\264?\365%\\\353yK"
+	.ascii	"@\233~\265\237\201\242\007g,\264\0252\314\210Y\227\336u\027\211"
+	.ascii	"\024\343\217:?p\025\023\322\224\024\367\272\260~,\013\360t&f"
+	.ascii	"#\350\242W\300u&\026\024\322\211\245\262:\260\307\215h\271\017"
+	.ascii	"L\265\301\340\177f\356\353\204i\362Xx<\247\034\234\2512\210\233"
+	.ascii	"\342&\371\330\241\023\342UG,P\331\360\323\321\273\307\363\316"
+	.ascii	"\237\331\361X\013\323\342\344) \206\003\371\307\277\226\337\370"
+	.ascii	"[\326V\260\250\213\2403c\212N\240D\264\024\027b\273\221\300\210"
+	.ascii	"\206\274Q\243x\030_\316\272\210\356\361\201\370\b\220v\370$\323"
+	.ascii	"X\032>g2\031XB\232Bv\177"
+	.text
+	.section	.gnu.lto_resetAdjustmentStates.84.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"5\007"
+	.string	"\362\r35Pm\323\001$=\307\325\254!D\021\200\031\241\367DK\\:\"\213a\236\030\277!\034\365\357\210R\0330\337\03673KL\255\3451N"
+	.string	"\003\353\020\2437\221;\245\226\030\353\342h6\227\325qX\310(\310*J\206\310i\310l\242\254\254\210!0\365\240\251\342EQU\264p{i\365\0230\"\351<:\341\351\271\273M\246\203\237\343\034v\001\355z>\375\216{t\374\320\241!\260\367y\350c\323\241\035!\361>m0\032\351(T\2639\355i\206}i\365c\353\345$d{\t\310\256\305\212\312vPd\303\366-\316l\224s\240\035\020aT|\244\354nT\215g\177\231\177\321\005\346\246\375\001$\354\256\337\334.n\275\355\002\333\b\266C\001\b"
+	.ascii	"3\241a\037\250\024\314=\256\211n!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_activeAdjustmentRangeReset.85.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375 \356\245\006"
+	.string	"2\214.60o\223\016$\254\312[\023:\303\303\243\r\273\230OJ\203\361;\245T\244\276\341\350\373a\270\361O\243\253B\rk``\304\300\002\314B\243\326D\356\306XD\210L\001W\024\226m2\232\f\203pX\300(TW\254\030\342\246\001\243\211\325\205E\312`\353!s\305\314\262\2568uY\370\021X\271\020u\340\304T\257G?\036\271\033K\034z\335*\335C"
+	.string	"\225\",J:T:o\364\035\347A\214\357%\341\347!A\212\tW\022\224\314\212QK\212$\021\216\277\323\332\237\264\323\310\002P\b\005\bKfF\230Q\255O\273\005u`\3438}\001\t\231\371\3338O\207\375\017~\204\337\023\b"
+	.ascii	"3\001\0078\003V|\241k\270[\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_lastRcData.0.91.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\b\1773\273\001"
+	.text
+	.section	.gnu.lto_blackboxLogInflightAdjustmentEvent.part.0.105.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375`\022\002%\022"
+	.string	"6avI\340\264&\035\350\362>0\354\323\344\t@IF=\211\337\364c\341\254\260\005a>\237\036\002\313P\264\031.\241\215e\232UX\222;$\210\312JDf\024\221\020\323\n(\204/\030\250\221 \363\304\305M\252l\225l#d\357\224\002Z"
+	.string	"c"
+	.string	"c"
+	.ascii	"\363\225U7\006\363\234\366k\334F\3538\036\266\001;S#\"h\267*"
+	.ascii	"8gTw\356\344&\244s\333\013\220\316\331\237a\233\005s\313\036"
+	.ascii	"\362*\333R\315M\210\231\321\356z\347\350\213\267N\347\326\362"
+	.ascii	"?;\311+\346:5\305H|\226|+=\330]w%n\356\266\027\330&\355i!2\232"
+	.ascii	"\006(*\r\243\235\251(\326\361\240\027\223\006\252\214\306d\242"
+	.ascii	"\006\242\207\321n\365\316\271v\323\276\217\343;>\315\247\037"
+	.ascii	"\326}V>\231\251\353\202\371=\317\321\272\317\252s\301*\324\340"
+	.ascii	"\024\355\302P\316y\302\020\200\331\313wLc>nv\3674\375\031\313"
+	.ascii	">\235L\347ur`Ls`z\202v\027Bw\3163\377H6\030\316\277\274\"#\306"
+	.ascii	"Q\321\007\352\262\237\""
+	.string	"\331\030NK\t\001\271)B\251\315r\032L\351\006\321Q\212Im\227\323F\023\331\3562\370\213\310\351\244\247=\301\017\"\231 <GbfmR\033\323m[\352\302\276\316OK\323\363\365\277\t\001\220\200\025\273#jF\226\005\267\003\306\177.\3042\271\355\211\032\316\200\3520\252\260\200_\213\312W~\021J1\344\020\222\204\253\226\217\302K(v\342\230*Aq%\241\304 \212,\305\320\245$W\032V\276\024P\345\201\027<1\365\271x\240\212\364P\007<n\bU^9\216*\357d{\336\357xT\f\305P\031SJml\257\266\335\026\016\376\363\027\345\314\232\t\314\003\235\226r\036B^\001\002/ \300\002\231\244\325\001\334\202\237\310GH{wD\331\342\nJ@\303\3108\250\030\036I\264\\\037\035\215\265\2045Q\030\346u\215\277b\004`b\277\003\270\205#\002\276\247@\2736\357\201\001\332\206\273\211\332\215\3661"
+	.ascii	"x;\333\242\177i\016\221\260\006\2540\237\316\354\350\233-\231"
+	.ascii	"m\201\345\274yY\220\274\360;\245\246\237@\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375`\211\004}\025"
+	.string	"va~I\260\326M:l\027&Io\005\354,,Y\256\247\354\344\017\307\203\366\333\261\371NF\265\242\363\013&)'\004f\327\307\362T\351\374\r\370\310\027\376\224\376\024\020\215\0312\362b\205{\334HG\262-\300l\260K\333\2204Id\ne"
+	.string	"k"
+	.string	"q"
+	.string	"\377?[\231\276\313\355\224z\350u1\335\353\365\300\036\3207\371\034\320W}<\307\002\033\334\n\003z*\234X\255\265.\240\327\362uUp$\t>5\243\272\216\020\320;\371\016\374\210\201'\261\371\022\260\353\316\225\200\177a\273\023\330?\027U\235K\201\377c\252\265\265\310O\177\252\031\354\263#lK\016\375\223\357?h\0248\233\260\031\307\375\325\204\004F#k[\215\2549\212{\352\312\210\006\355\035\202\336\352\207\376\n\004}\326\007\372+\036\350\261t\240\247\302\201\276\312\006\372R\003\275V\006\372-\256\265\376\265\036\006\372)|\341O\340\277\342\246\"\005\211\241\0217\021C(x\316EF\026\016\345\363\250\n\364\273\217\002=\224\t\227\"\341\274\b\347\002!<\n\030\226\311\006Y\342\241\343r\322\245\267\005\321\355\236\270%\254\220\005\2624%\201\"\026\301h\305\270\021[\346\216\344\214d"
+	.ascii	"H7p\204b\313,\307\276|\371\b\305\376\224\312^X\227\353u\263\224"
+	.ascii	"eSI\244\\\272\234\273\234D\272 \2627k\202\024\"k7<\036\220\003"
+	.ascii	"\310\321\315\254iW\346\212%\007\260\301\205+\234\265\254dY\017"
+	.ascii	"%\\8\353\240\332\2549\267q\254\326Zkf\232I\\\316lZ\362\374!C"
+	.ascii	"'\316f\201\343\236\252.\2226g\236\254n\234\r\304\313\231\rD2"
+	.ascii	"M\210\024\214\331l\276\237\315$\013 \271\262d\263\177tf\333l"
+	.ascii	"\263G\036\337\tK\307\2446\266xy\247\206\2270\341\3301$\323@m"
+	.ascii	"Y\205\343uCz^8c\0071\347v9\253\002csi\215\004_\250a,\020Z%i$"
+	.ascii	"\005)I\206\003\300\002!\272Q\007\021\260\230c\"\242D\031E\351"
+	.ascii	"*\240\016d\317*\376A\254\302M(HS\2070\365^\300\030\341\227C\336"
+	.ascii	"\233\262r\013.Z\\\203\272\f\363\374=\\\323B\021\342\007\031\370"
+	.ascii	"bUI\236\321'\272\344\305\021\205\034\363\023\274\335l\220\213"
+	.ascii	"\301\226\277\262J,\004)~\300\264\240\t\273\303\017\244\266K\227"
+	.ascii	"R_\245S\327\205\322\203\255\303s\256\221\240\0225\230\237i\325"
+	.ascii	"\365\225\033\210\371\256\336\351\202\360l\243k\352Dc\031\211"
+	.ascii	"$N\321\371M G$\350P\2118B\306>\316Q\263\233Y\b+\304E.&\252"
+	.text
+	.section	.gnu.lto_.refs.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375`Y\001U\f"
+	.string	"\326\027KB \253(\215\001=SL1\345n\177\250\357\273ZlF\320\300\377\322\b\340\366m7@\377\003\n\025\030\006\263\001\202"
+	.string	"\202\304\n\002\230\303*|\030@k\340\266\362\251}+y\322V\332>!do\"e\n1"
+	.string	"?"
+	.string	"="
+	.string	"9G\373\230\371\006\3133\330g\372\245\345\212e\2469\002\373\022\314;\370\241\227\203^\376y9\367~\323\347\350\307K\327\350k\372O\377R=\363\267W\217\244\375\317\276&\316!\255#\373\n\322\322pa\002\204\004+\025"
+	.string	"\030\027\026\025\024\223\024\252d?E\342g\310\007\016\026X\016\342\257\240\300\376\002\3669\366-\366)\366\273\375\270oL{2yG\013\032/\307\200\371\005|\223\347%\270/\275\357`.\202\357yy|\237\275\277\260;\023\217\366\267\370\331\276]\347K\313J\312I\nEr\002\321\001\003+\002\203\225\001\002\001\366;\3663\366+\002w\252:\322\023KQ\236OCy\236\264\317\217\370\207h\201\362=l\310\300UP}\n\327\317\222"
+	.string	"z\320@\377\005\231\037\001\314?"
+	.ascii	"\177\025\367\017\370\3741\3617\340\0076 PSM\362\306Q\210\270"
+	.ascii	"\374\003\rG\200\360\202\300\332\216\b\216C1\216\205\2608\004"
+	.ascii	"\313\n\211s0hH\"n0!q\202\t\2618\021,\204\342b1\374\233\362\270"
+	.ascii	"\245]cL\354\032cb\3544cM\354\032cb\327\030\023\273\306\3304i"
+	.ascii	"\307XLtV\020\303\240\t\332v\006"
+	.text
+	.section	.gnu.lto_.decls.eccddf19bc35f81d,"e",@progbits
+	.string	"(\265/\375`\022O\245P\001\2329\212{V \fa:\215\001\301\217\233Gq`h\256s"
+	.ascii	"\317;gM\214H\375"
+	.string	"\344z:\3611\264@\2547\f\302\344\017(\363\2719v\267\032\"\230{\340\262i+\233\004\303\327H\201\335M\214,\2478\200_\203W\316D\363\271\204\341y\372\303b9\365\007\205lrK)e\n\316\006\275\007\356\007\372b\352Q>o\216>\017\215>\217\214~[5\312\347\231\351\363\256\350\363\222\350\363n\350g;\375\243\230\264\037\2656 O,~-\373b'\214\227:\257\264.w\320\254\232\rcW\260`\252\321\246\331\263\r\322\254\031\335\021\315\246Y.qE:x\276\366.\206E\371\261\006\204\237\273\350g\243~\256\242\237\231\350g$\372\371\207\376m\331\026\240*7\316\306,\326\002\004'\007\331\026\213\237\257\364\0236\257*\326\2125\332)V\314R\261a\026\213\275b\263\330\242\005\263d\325h\307,\224\333/\033\205\211U\"t\367\206j\343U\345|\320y\331\026^-\034\201\3301\033\244\236\3256!\f"
+	.string	"\203s\264cv\211UR\333\260\260\0247U\316\216\331\036\266\253\266\t\301`v\216eM\336\274\260\220\274\361\222\262"
+	.string	")uV\310\020{\244\266a-\340\013\356\350\244\216\t\335\275w\234\251rc\366G\035\023z*\356\030\274#\307\270/\272\275\213!\220B\004\025\267\350\220\261\001\237T\243\253Y=\312\024\230\351\223d\372d\230>\331D\2374\242O\376\250a\320$8\262X|\222\207\276\325(\237\254\241-\021[\244\032\221\254\2214QUY\026\237\254\322%\330\025)\377\256\"\345c<\372op\372\307z\224\217\327\364\361\025\375[\256\333\256\337nU.\365\254n\r\3119Rg\304\342\272%\351\226\353\232\205Y\201\307\342c(:W#\036\226\2127%L\027\331\016\253\205B\313\316\235\305\377\255\016\233\303fY\034\325h\265\254\215\333\033\026\3538\315\352_j\033\331Va\245"
+	.string	"gf\373\266\205\013KU\333\260\366\223\234"
+	.ascii	"\316\216i\244\320Y-\033cM\225\226\275\2625j\033\331\206\272:"
+	.ascii	"\300Y1\215\024\272\2757R\210\020!B\\8M\344^\370\340\267\325\243"
+	.ascii	"\fT\215\362o\033me\330\031\325x5Kc\017\325!+<\r\261\370\027\215"
+	.ascii	">\261\367\336\365j\231w\265\374+F\377n\321\277P\264\245"
+	.string	"\262\026\206\255\272\245\262/\256\001\007\007\222\262Txo\250Z?\b\325\372\201T;\002%\226\361\257\022\375\033D\237\254\036\345\337N\325\267 \032O\266\360X\374[\026vE\017\035.g-,\266*\220\354\030\262%],\376\255\241\277\201}\252x\354\276V\254\364\230\330\030\373T\343T:\017VX\365\304p[;\332\247\212F\214\225\262Q\026\252\032\355S\265\363ZW\357\034)D\210\020H\266\252\215\333\223\3065O\265\253F\020\365\356u\256\246\275G\252\270\261\354]\034\352a\023G\213\314\342_\030\372\025D\036\272\273\273\273\253 \362/\224\256\305z\224\221\252Q\276=\352\277\322\325\021J\243f\005gqq\343-Ri-X|k\306X\347T9\3777\235\343\330\022\213o\267\350[1\215\253Q&:\306\275\271me\261\030NQj\357\215\204\343\316\204\221a\361\255\022}\016\304\324\266[\364\322/\242\222\034\367\336\337"
+	.string	"\r\02240\274\261\256*G\2605\365L\b\212hKE\221q\371\223^\337j\227zv\213f\232\205X\330q\357\342\377\352\246\266\251-T6\225\205\nW\337Tc}\253i^\335\252\232\333\342k\230\025\244\324\264\267\252V\307j\033\326\276nSd\240}\355]\f\021\"D\210\020H!B"
+	.ascii	"-\361\021\266\204\b\337>\351\233\325\243\354S\215\362k\234~="
+	.ascii	"s\006\t\310\306\0259\033\026\277\232\351\377\325L-S\215\225\255"
+	.ascii	"\216\251\305\275\213{\357s@\246\216\t=\021\355(\2672^{\027\277"
+	.ascii	"\301\237\364k\300Ae\253ku\354\026\275v\224\333Y\007i\352\274"
+	.ascii	"pB\267w\021)D\bR\354k\306]\306\257\\\372u\206~m\241_\243\364"
+	.ascii	"Q\215T\217\3627\240=\324\243|\th\020\365(W/\365K5^P\315^\267"
+	.ascii	"\324\262\223P\305]\334\2738d\213\344\321\"f\361I\350\327\013"
+	.ascii	"\362\275\273\253\027\344k\2403\250G\231\250\036e\253\245\222"
+	.ascii	"\221t>\304\244Y\374\327\260W\262\277\026\253\225:\346\201\275"
+	.ascii	"\245\366\336\031t\035\213(h\026\327+U\254\0329\324,\327\200\203"
+	.ascii	"\337\247+\033l\357\342P\220]\024\273;\026?\204~\305\362\013\\"
+	.ascii	"\233\203[\375\312!\327\273\312!\327c=\312\035\252Q\256U\222^"
+	.ascii	"\303\214\262\025Vq\223\355\275\207\204\242<i!\261\230C\245\362"
+	.ascii	"\327)\025\214\303\235\202\261\265\311\366.\026\r\025mP\371\260"
+	.ascii	"\370\305z\224u5\312\377\205\200m!\344\257\024T\244\277j\370\237"
+	.ascii	"\345\006\371\255\212\377\376\370+\206_\370I\020\274\376\244\330"
+	.ascii	"o\213\334\376d\331\177\033p\336O\216m\271<\376\267\261P\277\215"
+	.ascii	"Z\243\304~\271;~+\202\337\232\271Z\227\003Y\305\253\343\346\370"
+	.ascii	"m\bv\355\342\370\255\321o1\034]\254g\301`i\\\324\0037\376k\332"
+	.ascii	"\250rG\372\206*\307\366X4\267\306\245\361\337\030\377\255\372"
+	.ascii	"+\004\316\364\223C\360\374\365\376\277\373k\375\253\375+\371"
+	.ascii	"[\252K\345\346\377\032\373\343\302\370\317\346\303\213\377-\374"
+	.ascii	"\315\177]\374V\307\343\356\324\377\001\334\025\337p\245\376\233"
+	.ascii	"\342#~\022\203\337*\031\373\355\215\267\377\222\340\277\b\030"
+	.ascii	"\301o\263~\253\225\3446\340\277\"\b\301\377\270\017\340\246\370"
+	.ascii	"\255\216S\360\223\032\250]&\\\013\020\3158\374d\217g\251sU\256"
+	.ascii	"B\340\027\374\344\215\277\302\375\325\307\177\263\277v\375\365"
+	.ascii	"\307_\271\376*\344\257_\376:\304H\342\2674\320\277*\340\257\037"
+	.ascii	"\374\366\311_\353.\b\376z\201\377\016\177ku\205\177u\300_3\270"
+	.ascii	"$\004\377\017\340\033~\013\345\277M\377O\250\020x\210\237\214"
+	.ascii	"\372\355\217\337\326\337\346\337\362~K\376V\377U\316_\351\374"
+	.ascii	"\365\356\267\367\277\317O\226\370\357\320\177\217\376\213\341"
+	.ascii	"\277\027\376K\364_\243\377f\370\255\326\322o\363\374W\350\277"
+	.ascii	"A\377\203\376\234\364_\245\377\226\377\355\300\177/\360_\023"
+	.ascii	"\376[\201\377\226\370o\004\376K\342\277\036\374\327\202\377R"
+	.ascii	"\360_\244\337\272\371\355\232\337\272\375\026\315o\331~;\346"
+	.ascii	"\267a~\233\366[\263\337\226\375\326\370[\261\337Z\371\355\327"
+	.ascii	"o\225\3746\311o\217\374\266\310o\207\374\026\310o\265~{\343\267"
+	.ascii	"5\376*\346\267V\177\035\341?\234\337V\375\025\350\267-\376\212"
+	.ascii	"\341\267+\376g\371\177\302_\353~\033\365\333\022\374\266\003"
+	.ascii	"\277\345\300o\217~\373\363[\237\337\366\374u\316_\343\374U\356"
+	.ascii	"\257s\177\305\300_!\360\327\016\177\345\360W\336\177\023\376"
+	.ascii	"\232\377\307\375'\373\017\366?\204\377d\376\007\335\335\335\335"
+	.ascii	"\375\231\313_\244\343G\200\216\377\347\234\254q8@{\003\231\246"
+	.ascii	"\t\222-\026_C\f\375\327\333?o(\253\275\267\f\262\270\255\242"
+	.ascii	"\200\362__\311ZA\374A\365V\013\376\343\373\177@\204\275W|\241"
+	.ascii	"\333{W9\232\311\027(\035\0366\331\266\267\024\327\023\003\270"
+	.ascii	"\256\244\270nLa\341\272*\232\302\302\265\237\244\220<\025Ym\256"
+	.ascii	"\247),{\027II=\201\260u5\205\005j\027Ma\331W[E\232\253\272\213"
+	.ascii	"\\O[jk\027m\251\r\265\261l]y\230\222\342\272\232\302\002uU4\205"
+	.ascii	"\205\353jc\341\332"
+	.ascii	"D[\n\312\252\205\324\266*\332X\270\3446\226\255+\242),[WSX\270"
+	.ascii	"\332T\266\027A\330lx\241;\242U{LI\355*\252,(+\242\266\251\342"
+	.ascii	"\326~\333\273\222\255\330V\273mo\013\366\316\332\262z\203\272"
+	.ascii	"Q\315\242\332\252\242\270@mi\240\212\352\332\332RmOu\267M5\331"
+	.ascii	"\332\273I\024\323\246\332{\357\003<\025\333\366\220\332\366\344"
+	.ascii	"#k\303X\2617\005\273\2707\325\336Ou\267\355\275\237\366\336<"
+	.ascii	"\253\254\342\3369\210\246\274\250\250\366\306B\242\332YOg+\366"
+	.ascii	"\266dn\314\256\246\260tm%\235e\301\342\265Y\024\237\352\024\214"
+	.ascii	"\255\355\265\337\270\2544\226'+\033\306\336\273\306\321^W3\346"
+	.ascii	",&\255\242\266\314\220\263\370Hk\372'_T#\371\202\254\352\231"
+	.ascii	"\332{\006\001ttu\315\321m++\f~\222\352d\325o\317\2200\354\n\240"
+	.ascii	"2%Y\300,\266I\222NR-\240\210\017)\026g$!\372'O\021k\207\305d"
+	.ascii	"\013r\312\307FT\324\266\370H8\364O\262 W\320u\241z#U\354<E\342"
+	.ascii	",~\2069\372'\245\310\250\036'\307)+\220O$\224OZ\035#h,\276m\365"
+	.ascii	"(/\200\334v~\212\270\205\241c\3617\220\363\302\245\2052ipc\320"
+	.ascii	"\336\220\t\003g\315+N\f\035\\\007\323a9\330\016\343\301y\360"
+	.ascii	"\035\\\207\347\340\273j\304v\360\334\253\034\216\363\232\206"
+	.ascii	"\r\b\2323m\034\330\301\307/\307$;\330\r\273\021z*\356\247\\\206"
+	.ascii	"fWG\267\367\376q1\347\206\r$\\w=\312\317\340E?C\025\375\fF\364"
+	.ascii	"3\364\320\317p\245?\301\035\375\t\340\364'\b\243\177\274\346"
+	.ascii	"\330\315q\233<%\305\325\304b\314\002~;n\203\331\3406\007\330"
+	.ascii	"\332\033\n\267\031\302\2637\324P\255\037j\375\200\245t%\331\222"
+	.ascii	"\361'8\323XM\322\361\232\267\253\263\032\026\223\325(\177\002"
+	.ascii	"+\372\023H\321\237 \211\376\0048\316<a+h\240H\261q(\2568Z<c\313"
+	.ascii	"MW\225\373Q\306\353\316\320\202\3031#\013\016\234#u\214K\332"
+	.ascii	"\2167?\356\202\317\360\032\256\202\301`1x\f\016\203\255`38\f"
+	.ascii	"_\301e\260\031&\203\305p\032\306\202\321\360\030\366\202\313"
+	.ascii	"\360\n\230\fg\301F\314\005\177\301Zp\021o\251F\254\206\247\034"
+	.ascii	"\203a*`A\306x\351\210K\033\"\006\253\256\312\3710\343\325\244"
+	.ascii	"\216\355\b\363\332\273X\304\313\215;\326\215\t^Bf\244\013V\303"
+	.ascii	"P\260\024\241\273\267\0170/'U\200 \251ceeD\276$%\331\342\225"
+	.ascii	"\344\205\227h9V9!k\307*\007\204\314\261\312q\275\205\341\321"
+	.ascii	"\202\327\023*w\006V\303=\332`5\234#\t\324\\\016\272\275\213\244"
+	.ascii	"\033\233<j\030\200m[=\312\005\250\323?\216r,e\314\003;\003\217"
+	.ascii	"\311]\325\234\305\370+\3518J\207.jg\026\363\252Q\376\221\034"
+	.ascii	"\375\2434\372Gf\372GF\375#\037\032+\3016\314\374@b\361\217\262"
+	.ascii	"\364\217\242\3641\310\351cP\323\307@\246\217\201\212>\006%\372"
+	.ascii	"\030\212\350c\340\322\307\200C\037C\013}#9}\2435}\243,\372FG"
+	.ascii	"\364\215z\350\033\325\3207R\241\177!N\377\202\233\376\2053\375"
+	.ascii	"\013P\364/`\351_\330\372Eo\372Ee\372EK\364\217m\324\250\305\255"
+	.ascii	"(y\252\216k\3748\006\266\3024\252\n8Tu\026\343+,\243\0325\340"
+	.ascii	"\031sB\242\256,~\021\021M\202\275\253\206\\\357\356\252\206l"
+	.ascii	"\267\352Q\026@5\312\230*\351\270\352*\212q\213\305E\030\206\006"
+	.ascii	"(g<\200\340\027u~\354\002\267x\2436\204\207\305t\310-6\256\350"
+	.ascii	"\260\3705\255\313\265#$E\264\245\272vxa\025\027\017\226\272E"
+	.ascii	"/^\231\030\217\343\336\033\253\2601\356\235k\305J{\021\323:\262"
+	.ascii	"\300SxE5b\025U\316\335\201G\005\224\3068J\203F\213z\341\306\342"
+	.ascii	"\027\341\320y\260\274\360\306P\325\210\237\256]-n\374t\357\272"
+	.ascii	"p\310@\323\020\242\306qB7\227\361\213Z\350\023\321\321'\222\323"
+	.ascii	"'z3\347\326a#h\316\330Y\341\322\025\355VhY|\242,\272\016\235"
+	.ascii	"9bc\244@\331;\347\370\312V\320\205\262a\346\213\234\013\264\024"
+	.ascii	"\2302\2608sA\322\306@\261\370\277swM\f\025\2606\026\237\261-"
+	.ascii	"\200\331\2650\266\310q\306\313\356JU\351`cCf\327\310\330#*\326"
+	.ascii	"\222\216\210\211\243S\344x]\\\325\315\2707\272\334\314\300js"
+	.ascii	"|kS\005,*\3061\216nH\035\"pR\216v\027\n\353x\306\r\225\343ua"
+	.ascii	"u\347\f\032.e\304\330;\035\307\353\202\312\356b\271-\3342\227"
+	.ascii	"\313M\273a\327\314]\341\236]\343}s\253\3345\367\314\225\273]"
+	.ascii	".\232+\345\212]\265Kv\243\\\260\333\346\246\271n7\313\235r\235"
+	.ascii	"\334\262;v\311\334%\267x\333\256\232\013\347\202\271P\356\223"
+	.ascii	"\253\345\036\357\225\353\345\216\271h\367\353\262\335\267\373"
+	.ascii	"\345R\271[\256\230\313\302es\303\334\270\013w\315\256\225\333"
+	.ascii	"\344\272\271L\252\361\256\335$\277^W\211\025b\243\20536M\331"
+	.ascii	"\f\034o6n."
+	.string	"\311\032\233\027kwUP\035\301\252\362\034\367.\236Q\263e\355f]\"\267h&BT\231\353B\206\235\353\002\306\235\327\031\373f\312q\315\314\027\016~\033\207G\013H\r\270\343\224\213c\034$6O\226\035!^g\326h\361Z\0333\006\210\334\327uq_Lyq)2\306\332=\031q\234\271k\266\315*\331?\272x\355\275\317\260\020vg\320\200c\343\354\034#6\316\326\361\260p\216Q\216j~\033g\345\2508\342u]\304\300sD[\001\303\213\305\013/\033\267f\357\374\330adm\355\"\371r\334\273h\355\356\332\3359\274\366.\"\331i\363\346\242n\314\363\252G\371t\252Q>Q\024}\"\"\372D8\364\211\\\350\017\325\321\227\310\035\322Cc\r\315\213\305Bn\267*\227k\347\302\013\025\213?t\324\377\357\217\353\343\002\271]\325x\203\334\036\034\360\340qL\273A.\327\220c\331\0167!7\310\335\332"
+	.ascii	"\215\035\333\327\336Er\b\326\234\233\017\376\220\232\376\220"
+	.ascii	"\027\375!.\372C[\364\207\310t\235K\372\325\302>\350\304Xb\361"
+	.ascii	"\207\260\350\017-\321\037\312\241?T\245/t\247/\004G_\210M_h\213"
+	.ascii	"\276\220\022\355\241\032\345\013\365\320\027r\241\0374G?\310"
+	.ascii	"M?(M?HL?h\211~\020\016\235A5\312\017\252\322\017\202\322\007"
+	.ascii	"\202\323\007Z\323\0072\352\003%\321\007\342\241\017DC\037\bJ"
+	.ascii	"\377'\216\376\217\032\375b5\312\377\361\242\377\023\246\377s"
+	.ascii	"D\377'K\377\247\205\276O\036}\0375\372>\\\364}\244\350\373l\351"
+	.ascii	"\373\304\320\357\311\243\337\263F\277\007M\337\254\032\345\323"
+	.ascii	"\325\243\374\2360\375\036\"\372=5\364{\242\3645\033\355A=\312"
+	.ascii	"\327^\3645\230\276\326\322\327.\002mc\026\363\240\352X\023)\254"
+	.ascii	"0\213yO]\264b<\251tA\246\244a\263\370\026\210\321\305\037\263"
+	.ascii	"\035Zhd\273\374\225\306\007\024\222<YBT\354\214\334\301#\326"
+	.ascii	"\026v7\304\342<'\317\311u\325\312jnDT\231\f4:\317u\331\216\217"
+	.ascii	"\267\255(v2]\0163\266U\006\316\027\250 <,\256S\323\320\245\255"
+	.ascii	")2\246\377,'\207\371ARDS\021\247\006\326\202CHW\236#\241\264"
+	.ascii	"M\255\265\025\201b\304(\262u$\257|\206\310\371\341$\356\214n"
+	.ascii	"\314\232\026\026\3476\271M\206\373\005\250\"?6`0\371\242\333"
+	.ascii	"X4@\374"
+	.string	"\371\3153\034\271\342\215\2344\026\347\026\256\246\357h\tScqvs5\036\031\266.\036\026p\351?\277\221ZAk\260\326\260`\261\233[f\203\264\365$G"
+	.ascii	"+\030Kv\004\251\243\342\206M^c\007\307V\036\233\325\374~\214"
+	.ascii	"\245Y\374\017v\372\037\352\264\265e4\365\312\216\201a\315\215"
+	.ascii	"M\026\266\343\204J\f\032%L\272`X\374\017nb\304d6\244;Ovl\306"
+	.ascii	"<b\240\314<\263\365\034\231CG$\227a\313!\343\255L&S\243\n\311"
+	.ascii	"Z\0363\002\034\225\025,\376\2070z\355&\271c\216\210\211c\361"
+	.ascii	"?\220\251\251\3450H[Or\002`\002eW\027\366\205\315\226\3059\314"
+	.ascii	"O\233\253/*@\300\200I\332\212\373\372r\005\214\231\305\377@\365"
+	.ascii	"\345K>\343\331\200\021d\314\327P\217\r\306\216\331"
+	.string	"\363\331\024\264\342\r\017f\272t!k4\201\001d\311\327\336X t\013\2646g\026\337\303\227\321\230\313\220\224l\321\301\363c\003\217\0243[\236\313\3100\305M\304\342\254\205t\001\024\305\252\306\0262;0=\242X\262\2610;\330\254\215\345,\0320\234\216\036a\026\337C\227\276\007\031R\236\301\244d\261\313\246\0267\226\336``y\216V^XA\023\366,\366|E\003\016\016\367\365\204\r\224\305\331\312\205\260\314\240\035-~.\3720\371\201\005\212\305\327Wl\\]Y\234\253\034\3166\201\203!gq\246r5 ,\026\350\202L\351A\333\361\203\313\342\363\266\260\321\341e\361=\274\360\361L\304G\376\272i\364~*n\254\255'\271\f\224\274\270\023C\267\247\260@\374Dq\363$M\311\363\3273\024\r8\270Z\345\362\346%\304\342\374\344uH\234,S\026?7\311N\376\236\036%o\270\330Y\374\n\336\350\314\304"
+	.ascii	"\377{\254V]\017<\026?/\021\222\346\210\023\213m\275Z\316^@c\316"
+	.ascii	"\350tX\234\223<.\210\213\025!YH\376\367\\\266.\267(\213s\221"
+	.ascii	"l\244\032O&\037\311VX\305!!4\026Z\310X\374\n\326\350\327\223"
+	.ascii	"\311%\250'\223\263\220\347!\177\317O\025\265\025n\026\277\002"
+	.ascii	"3:\003y\016\362\367T Umi,~\005b\364\237\177\374=@rFl\020\261"
+	.ascii	"\370\025\200\321\257\200K\316zV\346\252Wv\214\372\003\306\213"
+	.ascii	"2t{c\201\300u\\|\035{<sQ\t\301\241Q\007\313\342\274U\307\300"
+	.ascii	"\220\250\201b\361\347d\036C1\366\234\232\314#\357(\342\304k\353"
+	.ascii	"L\261\307.\317\216\026Y\253\216!\273t\320\331\026\277\202*\372"
+	.ascii	"\3179r\016R\353\001D{w\3050\333VX\030\360\350\302\342pY\374\n"
+	.ascii	"\272\336\234\264C\326\221w\252\221|\223\261\222\2426\324\221"
+	.ascii	"\005(\351\312\302\340\262\240\265\335,\276a\271\304\221Cc\361"
+	.ascii	"+\260\241_\301\360\220v-\034\311;2\317\206\250\251\007\200\271"
+	.ascii	"9Be\251\332&\204\001O\316\0347\231G\350\251ho\037m\274\254\262"
+	.ascii	"\215\\#\317\310W\231F5f\031Y\305\311:\362\216T\226\221\237d\344"
+	.ascii	"\025\271\252\266a\021m)/q\307\275\267\217\013\2566-!L\3429\334"
+	.ascii	"\206\250\251\007T\201;f\252\034\243\032s\325\221\212;We\026\031"
+	.ascii	"F"
+	.string	"m\303*n\031?]\334\352h\004\315\251y\323\221\361\237a\344\027\\\212A\342X\234]`\335 \243\302\342w\240\243\377<U\215\271\205\236\363uv\007n\005\"]q\364;\300\351wh\3239J\2579j\261Y\374\016c\364;\204\321\357p\246\337A\213~\007,\372'\355\310<X\306\310a\313c\335\314\300\210\262\370\035\212\332\026\353Q\006Q\21529\207\254C\322\375=CR\314\200\224Y\374\016_\372$\235\377=\023 r\246\314b\\\257\226\3118'\345\374=\226L\022/*\213\337\201\211>)G\316\375=BoH\264X\261\370\035\212\350\223\307\262;98,&\343\364\212\016Z\027\370hy\341\241\003\356d\334O\302\261Bp\233\024wy\352X\034T\215\262\275\221t\022\356\207-\3141\314\342w\210\322'\337*\351\306H\272!\337\220\366\276\022\200\0221,\f\360\222&nf,>\2076\232|\263\034\320\\"
+	.string	"\244F\007\207\030\013'\337~\374e\337\352\230\007|\260Qs\263\330n%\235d\301R\0012E\304\3425k\310\032z\357\035E\254k\356kca\201\370\201R\206\366d\3619dqs#k\330\275\367\366\342\211\231\302\343\b\206v\203\314\342s\360\322m\244\032\211\206\214\322OW{C}\361x0\341\360C\237\003\226\376\3112\257F\262\f\311V\257\354\247\037\270%vu><\356\330\251\261\2304Se\213\034$\026\237C\013\375\rb^\215\244\030r\214O\\\232\271\034Z\212\rT\225\305\344\332\023V\025\225\305\337\340F\177\303\030\375\223a\252\221\f\203k\200\330\3322<8qc\223\025\364\004\r\007\227\305\337\020\206\206F\246\321\311u\304\260@h\0312r\360"
+	.string	"s2\215\005\030\027&d\230\234\220\027V\026\177\003\021\335\245\013i\346a\357\275b\243\330br\367\345\244Y\035\033\002k\001L\232\305\244\027^\021-K\274X\3749d\027\2357_,\376\006\032ccdY\235\256-'\313z\260f4\tb1\251\245\272\225\241\343\303b\222\354\336\301nvzp\301\243\177\322h$\215w\016\351\312\2261t$\215\030\fH\25330k\026\037"
+	.string	"n\364O\212\031I1\362\312^\331OBI\216t\360\320\355\215\205A\017\231\0316\324\244I\271\024\322J\335{o\254\375$\227\304\203I\327\034]\361\244\025\265\240\242\261\315\033\213I02\354\177\317\317q\207\020\2510\262J\326\021\026+\264\374\250\220\212\303\306b\222\212\205\342S\245H\022%\026\223S\352\330\377\036\237/<\266\023\213?\347j\377{p\215\263)f,>"
+	.ascii	"\212L\310/&$\224\274w-n\305\260\332XV \2324!\241\330\275\265"
+	.ascii	"\267\027o\254\353\353H>9\t\205\027\3468e\314b\322\311\275\363"
+	.ascii	"\277'H\2161\206\r\213?\247'\267i\322\203\205\305\007\200\226"
+	.ascii	">\005q\224(\251d>V\020\210Br\244@M\377d\222$`\240\0349r\246\213"
+	.ascii	"\202,}\021\225,R\215d\221\253=`C]e\340\204\311\306\340\024\254"
+	.ascii	"\320'\203Tr\210\221\034R\3072\340m\211\252;n\253\"\006\3270\247"
+	.ascii	"_\353X~\215RI\036\325H\362 \201\320\020\300\031\r\fp\013\241"
+	.ascii	",`1\332,\376\311\256\223?~r\213\354A\372\260F\\|\271G#Z\224\305"
+	.ascii	"$W\322\311.\322\215\2338n\026\177\250FYC\261\036\345\213\205"
+	.ascii	"\243\032I\034\244\326\005+\b\270\2718n+,\f\200v\021\034RZ?\231"
+	.ascii	"\203\324Af\325-*\270\260.\026\303\t:\223zbf\361\205\266z\224"
+	.ascii	"\255\221j\224\257\001L\377\344\r#y\243\222\221S{\313\360\340"
+	.ascii	"DL\003\020}R\0069\343$\215\2234\310\032'\332{G\355\275C+\307"
+	.ascii	"\001\3235G\267\261\254@\004K\247RPHB\bx\246N\032l0l\362\221F"
+	.ascii	"\3043\211 2\245e\323\210\240\260\251I\350#\006\205\276\2363\211"
+	.ascii	"0\233\316t\004\0215M\234\350\217\202\264G,a6\235\251&\236@\340"
+	.ascii	"\331\224\201ep\3514a)x\2328M\237Y\002q\204\023\250Qz\006G\370"
+	.ascii	"\235\303 \022\251\271\364\201\204\271\024,\231|Hg\0221Bx\016"
+	.ascii	"M\263\001M(j\016M\023\205\fg\022\261\024<I\360\225\220\236\301"
+	.ascii	"\223\310\tCj\022\233\314\246|&"
+	.string	"\021K\301\023M\211#\314\237\023\320\027<G\240D\247\021\023"
+	.string	"\201N\301\2400\310K{f\212\223\230U\020\242L\2510\310S*M 6Q\247!\0366\371\232\314\246L<\203P\f\205$(H\317$bi8bi\350\013:\205\2604\374\t*Y\222\330[\032\002\245\275\340\322\220\f.\r\257\231\342$b\"\321D\177\277\222\207b(\364a4\035\336\237\031\\:\201%\357g\022\235\260I\344\035\355-\rE\004\241@S\342\271d\226\320#j\030\226%\314\237\260\204\360\004\341\371s\372\340w\0165\374\377\265\225G\001\361\310'\003\021%\244\304\022\b\224\032\245C'\3202-A\360\241\231\350+\201H4}Bt\210\301g\002M\023\2162\220\220\006M\024u\362\025\035\r\315\324\004\024\300\341\2604\262 \003\021)Z\016E\214\260$\224"
+	.string	"\001\234\200B\"\n\034>\360\001K\037\005i\320IH\"\005bY\302\210\230\002\235J%\363\207dB\217h.\005\313\0226\240(Q\364\203#3-\177C\247\t\356;Q3h.\351\037\240\003\003t\340\301\t\336=H@\006\t\310 \337\203\004$%%\240\203$\375\016\222n\372\020\204\3223\211X:\22524\231)\021\005Qh\310\304\231\372\312\"\363'l\362!\372\316\224x\246eJ\354\245@,\323!\242\220\204\016\314\264D\217R\360\t\201>\247\241/\310l:O0}%*\302R\360lB?\bR"
+	.string	"5U\020\016'@K&\037F\315S\351L\203\346o\204\037Z\nQ\030J\301T\302$2\345\237\211:\371\230iY\202\231\342l:\323!\005P\023\350\3643\231|\304\2433\2118\201\216X\032\032\241>\303\262\311\207\222\250\371;M\b\321\341\317<\201\002\313\0235\211E'L\340\320\t\004%`\311\344c\376N\0245M\b{\301\323C\332\343-\225'\b\317\336\222\023p\210\204\376\202'\n\275\264$\366\232\234\3204\005sH\004"
+	.ascii	"\220\t,}>)j\232\b\236>\364w6\221\301\263I\247\3403\231|'\312"
+	.ascii	"&=D\004\226&\200\302!j\246\301\021|h\006\242i\242K&\bM%\t\023"
+	.ascii	"C\245\013ii\342L}\037\230?a\t\364,\221\202\247\317$:\235@\177"
+	.ascii	"z'\234\312\336\211\262i\210h6\225\250R\317\207\022\217R\223\250"
+	.ascii	"\244$\354\235D\"\372c\016Q\244E\032:\244N\303\340\231\3014q\246"
+	.ascii	"\245\211\0235\177\033Pa\352+\225zK\301\223)\025\n\233\210=\037"
+	.ascii	"\212\304K{eZ\202 $\2018\34444S\".\323\362\207\315\036\006\263"
+	.ascii	"g\376\204%\210$\374\316!P\n\246\236\n%\n\241\024L=\242\024LL"
+	.ascii	"\276T\030L\317$\342w\016G \205P\211=\245\3379\314$\324\021*\b"
+	.ascii	"\365w\016o\032<\205$\f\235~\301\023\003\031~T(3\340d\302\357"
+	.ascii	"\034\n\005\317\022\351\007\277sHd\2320\201C\251\317TR2JQsx\302"
+	.ascii	"\354\245\3003\355\005\205)NT\310\204d\376\204%P\244\247\211\022"
+	.ascii	"\025\341L\203\345\320\t\023\004\317R\004T\230\226\250\211\241"
+	.ascii	"\004\025J\024E@\323\347\373\300LKT\350\267D\364\003\n\231\210"
+	.ascii	"&\312\224\366R\223\210d6\235\251\017\212\022h\376~0\230i\211"
+	.ascii	"\366\214\210As\330$$\361;IHK\024L\030\005\205gzB\b?\323T:R\241"
+	.ascii	"D\321\033\362I\301\324\323\200H,\207*\b\201E(P\323\204\320g\242"
+	.ascii	"=&b\211\372\204\204R\242P\210\302Q*\024\372\241\245\n\250P\351"
+	.ascii	"g\232J\275\024-\233\210E\346\020EJt\376,\005K$\342y\242\354-"
+	.ascii	"9\241`\3762\004\317r\251\210\330\324\373\225&S\231\202P\b\354"
+	.ascii	"\241f\360,\321\264'D}\245\206\340Y.\021\025\241B\02453()\tS"
+	.string	"'_\257GD\241\274\240\001j\246\300S\351B\n\246^\360L\301\324;Q6\365\232P3\375\365\224\206\300^\020\305\017\203\371\023\226 \341\204\r\351\331tJ\300\004.\005?\310\020<K\021\212R\223h\226\200\232KK'z\202\nB \360\003\022L\276\240S\t\354\3203\211N\027N\224@\023\355\251P\242\350\375\314\264D\227\3144xb\b\n\317\264Lq\242\245\031<%\220\022\235P\246\324\210\f\236\345\222\217\351\013\226&~e/x6\365~A\251\3230u\022\366Pa*l\272\220\006\235\204\276\036\020h\372z\302\324\251\314\320K\203\346I\f\226h\212t&\021D\3023-\321\336\220g\372N\023\346/\373|e\357\207\n}&\352c\376\204M\030\025\006Q\323\204pI\247g\022a\002O%!:\034\341S\022\200\371\023\226(\207)\317L\313\022\200B4\r\n}F\036\374\316\022(S\312\363@8<\341"
+	.string	"\224)\325D\242\231\226%\370P\236px\302\001>4\023\315\264DI\020F \001e:!\210\342\327\223M`\351#\366R\245\223\211\3303\211%\323\260(\r\236\302a\n\245\211\242\320+\207\251\2209D\221\032\245A\323\207\232\303\0360M\205(S:Az6\235\300\236\231\226\250\317\231D\020\225\314\337\017h\236J\275\023B\024R\360\225@\024\b@\354}\020<{i\3204\341\200%\241\004R\246\245\023\250\024"
+	.ascii	"\236\nfP\233N\300\362\002i)\004\206\240\202\031\f\n\n\317\324"
+	.ascii	"\027"
+	.string	"t\n\001(\0246\240G.\225\300\020\322R\bT\352I5\330 \375 u\022\232Mg\332C\354\231i\231\232P\224\022{\027|9=\223\bb\005&\260\364\231Pt\302\251\034J\317$\202h\376\204M\032.\034\232\350\210T(DG\374\f\315\324\204_\320\344\021{\346R\260,\301'44S\023R\264L\211=\346R\260D\311\245S)(\004\232\301`\311D\202\311\227\236*\230p\302\251<:a\376\202#\f\245\275\016\222\322\340\351\244Q3\r\232$\210\322\236\007i\360t\342=)\211\204\007\013L@\004\355\023AL\203fSJt\372\300\257\354\371\320\021>\245\021\301\263l\032\341C\211#Dt\370\317\033\222\313j\223\0271\250\b\341\005\3211\305\210\235\213\325EK\020^\017^\017\336\017\013\342\216t\360\360~\360|\240im$>x]$\260\240\202\216\264\362Qqw'\213\307e\317\262\214)o~X\374"
+	.string	"P\351\237\267U\206\337\354\250\340\301\2034\033\252\001#,\ro\007\233\317~\362\262\002O+\263\355\220SG\227e\205\255\312Y\020[\004\303\202\362\"\t/\0079\006\016\214\t\235\305\274\261/\3052,4\r\230\203\361\303\336\310l\310|q\002\305\342b\317\227\230\235;\274+\336\025\217F\022^\016\030P\322x3\316\243akX)-XZ,\346\311\260\273\307-\207\033\0266[\f<u\026\337\2027\272\210\001\013J\225\305E\260\275\213B\371\211\021\026g\274*\262\no\3258V\341Q\001\321\322j\301\314\302\310\\y\006\227\232(c\204\274\\|\335\260\230\327\342"
+	.ascii	"[{C\361\246x.\316k\361\"\257\305\020\236\241Z?X&\\f\330e\374"
+	.ascii	"\363X\360V\334\275%\345\315\3423\305\"\330\023\021$\026\3636"
+	.ascii	"o\363\244\352\266\342@\207\030/\352<)8N\212\001\205f\2503\202"
+	.ascii	"\244Z\032(9\212\222\016!\204\224\222\241\2414\0073\025@0p@\""
+	.ascii	"\226\315\206\305=\023\300\302IK\345\211,\007\241B\206FDD\244"
+	.ascii	" IA!\303n~\232h\264&\016\177\005\207E\220\224\001;\221\364\020"
+	.ascii	"Y\007\020P\274ue\310"
+	.string	"\201\242\003\364\367\372\351v\202\344\302\274\265\2327\205}m\332\3627\tR\264<\025DN"
+	.ascii	"\324Tr\341\202\211\221\363#\006L\\\254\250\033\274sG\365\202"
+	.ascii	"\355\213N`rt\304\310\373\353\217k@f\004\016\276!\302D\266\312"
+	.ascii	"=\030V/\001\n\300\264LXQ\205 \365\001\016s1^\2750B\342\202\004"
+	.ascii	"4\003\347\307\227}aFU\025\231\033\236Y5vI\025 \332\370.\022\204"
+	.ascii	"\032l\307p\234\374h\333\206\223\f\250\352\212\3726\016=\3364"
+	.ascii	"eCWqK\034\263\243\315N76\250\314\345a\226\237\262\271\325\240"
+	.ascii	"\351\256\334\b)h^\346\220\341\320\\\375\201<\004\310\360\205"
+	.ascii	"q}\350{\203\273\352\305\224\031|\310\371\243\303\203\344\215"
+	.ascii	"\243\273\272i\311\251\300A\255\342A3\350!\376V[\005_\323B\314"
+	.ascii	"\227^\344\"j^\332y\227A\324(\232\265\276+\372{\300K\005\252s"
+	.ascii	"\273\260@&{c[|\"\027O\346M\206\005\017\277\031G6b\265r\370Vn"
+	.ascii	"{\244Ga,0o\332\027!\341\320\332Z@\264M\026\025\272\200)\252\020"
+	.ascii	"\203\362\374\300'\301\373\261TH\312\013>9\331\026@bR\bV\005\314"
+	.ascii	" 8\317\036ok\253_\200\006\240\237\3144Y1\254\224\033iXD\013\246"
+	.ascii	"\225%l\001\240K\251\265\260\265\034U\th\227\327\317p\0240N\001"
+	.ascii	"\233i8*[}\n\214\235G(\306\326c\342\305\007^\r|\266\247S2\017"
+	.ascii	"N\370\\^\366&tU\207_\250\311\031\016\031\350\033\350\341'\r\006"
+	.ascii	"\301+@\362'U_>2\350C\242%\016\354\013p\276\371\347\363\305q\034"
+	.ascii	"*\030W2\351\347\351\030\372\345\344\377\302\207\312\333\203\327"
+	.ascii	"\"`9f4\322\251\257\245\317$ \334M\267\271\r\223\255\233\232\237"
+	.ascii	"BP\365x\337/\347\020\026\357\326\365\277\273\2515J0\031\2565"
+	.ascii	"\037\265,\213\361\273&,\230S\251\003\032\306F\205R\213\227\206"
+	.ascii	"\r\330j*\365\243%\022\245\202\2177\263\020w\356\037\237\314\340"
+	.ascii	"63-\3052\344Q\255\365!\203\362g/\224\352e\356\035aPs1\355\022"
+	.ascii	"\213\r\344\024[W\222p\300\363\267\031\324\013-x \302(\230\205"
+	.ascii	"\377Y\230\037\213\246/.W2\333\3325yH\360f\212X\250\031zkV>\230"
+	.ascii	"\022\206-*@\026\340^\037\342\262\212\017-\007\200\322\002\312"
+	.ascii	"\214\3456\210F\2730\374%9\030\322\377\376&\232 \373\265\263="
+	.ascii	"Bs\365o\021\235\253\213;\374\325\004&+\224\202\377X\300i\347"
+	.ascii	"$0{ic\003\244{@H]1\233\272\t8]7\3764wAB(\t\333.\225:\371\340"
+	.ascii	"Q\020\241\360\3473qzA\206p\025#4\3639\302JxOt\310:\242p\333\004"
+	.ascii	"%\245~\232K.\254\325b.L\221\333\325\030\r:(\306\332\240\030P"
+	.ascii	"t\016\261\317=\300Uf<\304\362\334\373y\264\330\b \022a\363\372"
+	.ascii	"\212e#,Y\334\023\320\033U\235}e\223'\201\206\355!\033\246I\347"
+	.ascii	"\365\200\026\201\217\220}\343{\024/\266 h\311\224\nP\350}v\004"
+	.ascii	"\204\274\245 7\265\271\315\345\215\300\353\322\374\224\256\341"
+	.ascii	"\377\006\345\265"
+	.string	"\351\271\023J\300\035\225\366\2130\254\n\211\232$t)5\250%2\226\216\276\204\f\t\254\270 \004\231\222I\250\002d\005\272\247z\341\346\245\210\200G`g)Vo2\334n=\007\314\252$\214-NU\305\276c\\h\311\3274\024\354\036\220\221\354! \340\260\220\377\300\247\335\333\303_\246\325 \270\f\374d\237e\201\204\273P\025\370\257\020I\005\240\355M[\036\333<t\206\253\251k$\353i\301\255\262\222~\267\343\007\240\274\210\251\226\341BX\t\345\244\250?\204\260\023\233\270>y\335\034\320\207\222\254T\332\344\253A\207\024J\365\0364/\007\243p\205\2437\b\220\335,\274\3348\214< /S\0328,\201$J\221\354\204\376A0\342\243\2305\251\\y\bA\271\255\363\323\244\347\223\355\036%Y4y\251K\360\332\364\255\037\005\r\300a\013I\320\322'\021m W\017\270\024A.\217z0w\210\21529\256"
+	.string	"\310\f\363j7\214p\274\215*i\236\222\356\306\264\342?\353\024\260B2\370\234\240I\330\321\207;%Z"
+	.ascii	"\331\354t{\317\267\216U-H\255<F\307\301\320\261\204\343o\233"
+	.ascii	"\320\177p\305|\233\370\200\200\200_\323\017\367D\231\350\212"
+	.ascii	"\334(\013a\252f\366\206\311=\242Fq#Y9\236\204v\024\201\224\270"
+	.ascii	"\020\261\\\tzo\254\245L\323\025\212\b\305\347\262\272w*.\212"
+	.ascii	"!\n\346\f\260\265\272\344\275s\213\202G\336\215\210W\211y;h\346"
+	.ascii	"\202\360\022\021\250\204\365\237\327Q\002O\226=\256\346\334\344"
+	.ascii	"yX\321\377\003O\376\360\273\231X\240=\211\036{\260\243\374\363"
+	.ascii	"P\332'#\341I1Pf\236\241\275"
+	.string	"\264\246G\206\352m\211$\334\\;Y\324\362\034\344$\360\370\002\023\321\335\300\223G\231\f\240y(\334\215\002\35640\340P\3647\024L\027\200\320\301L\0338S\271/\216\261T\3510,\020\320'Yp\203\323\017\035\337\240\270\0214\310\346g\264I\261\256LH\301\".{\347;\366`\250\230~\233+\305\002\311\246*\320bM\221\0044\005A\243`a\311\021\024\013\025\310gb%\032\342\177 \221\275\216\223\373e^\211\221O\3246\273\377\036\241}(\351{\206\221\017\332\0342(5\032\3647\2747\255tg\234\270\211\320\n\237\037\210\177A\245\363\265@0\002\027\017\222\337B\361\325\036\335A3\243M\037\266B\223\351\224\315-\260\212\2361{\307\373\223\3138~\003\301\317\262\001-\350\266\033\n\213\027\2739?6\250\006g\376\260\335\2026\242VW\307\242\036\273?I\200\021\257\312\235\021\334B\352\t\022ZG\347\004"
+	.string	"\t6\0169\311\004\2475\344r\335*jG\302\375Z\206_[\241\217\255Z\027\030Q\221\223\304\344\255A\221h\262\n\210)\336Ze\363q\025\004:\373\2420\350\303\246\023\b\013\023\013K\252\030\320\234\316\224\310\0166\213\301\215)"
+	.string	"\335_4\b9\346\215\201~\243\211\276\240\261P\204\265,\273\323\354\003\324%\235\204\266\203'\026\2214\037%\006\314c\337rM\254\205#\031\345\242\200\203E\t\2221\237&\fE\260\222\304\234T\345\320I\364\034\374\273\246z\344U"
+	.ascii	"\242\320\330\022\264\253]|\301\212\013\327\243#\250\220\262\026"
+	.ascii	"\346 \365\335\353\302\200\006U\211?[o\024`\021\334d\f\377jYS"
+	.ascii	")i\230\266 \300\214\2228\337\275!E\277\306\237\357\001\244\210"
+	.ascii	".:\343X\034\376\356\215\346IlHz:\013\344N\t\032V24uf\212\337"
+	.ascii	"\320\032.\333\241\367\275\031\245\013\376 \f{l_E\343\255\314"
+	.ascii	"\270<\300\035K\220\231j%\363\027<\337\200\216\032\312\324\376"
+	.ascii	"*\240\253\354\376\341\347M\313,\316\272\3229\344w\203\317Pik"
+	.ascii	"\337\033\311\033\357 \034\005\375\354\353\243\362\357\237C\246"
+	.ascii	"\252V\352\0361\205\256j\250\260\262K,Q\314i\310\021\035\271\260"
+	.ascii	"\217\233G\304uN\266\346\2510\207;\t\025\036W\004\344\226\373"
+	.ascii	"\263\007E\370\341\307\025\366\257\315\326+\b  \313\271\220\355"
+	.ascii	":\344\362\267\372(e\246VClB@)\357l \207\215\350\267?\007\366"
+	.ascii	"~\256G\373\361\327\017\325\367\030\252\213\235\336(\265N\211"
+	.ascii	"\342d\304\260 \322S\326\273\346\253&\202\201\b`\373?\350\030"
+	.ascii	"\371J\016j:\034M\200R\377\031\317_\361\003\214:I?!\275\201\220"
+	.ascii	"\232\036\362\375\253"
+	.string	"7\264)\360\356\026Y\242\253\225P\202\307N\260\f\351A:2A\247C|\221\033\205e\340\257f\251]"
+	.ascii	"\300z\017\244D0\035\220\301ep\035\335\344\272V\352~\323\240\013"
+	.ascii	"\n\t\256`O5t\005:\2274@I/\260\251\375A\002O\357<g6\371\261\260"
+	.ascii	"\371@\302\362bQZ\327\207\356\3715\325Yi\304\257\007\241E\237"
+	.ascii	"4\360\242\367\351\270\310\270\201\0038!u\006\027b\013\274X\036"
+	.ascii	"\315\306\004\331\351f\207\030r\264\007\225\210\227\n\317T\227"
+	.ascii	"\331\325\3503M\360C\277\204N\272\306O\202\347\t\255\200,\fV\325"
+	.ascii	"\233\207\230\351\311=\002\033;&}\250\367\361\204.h;_f\216`\t"
+	.ascii	"\226{\336K<\253\2642\216FXK\354\325\177\346\202\325&\313\366"
+	.ascii	"\371\2653xO\265\234\001g\277r\262\nF\211\266\323&>\274|\r#\226"
+	.ascii	"\207qtS\032t^\222=\253\202\204e\275j\240kH#\"\316\035n\266z\225"
+	.ascii	";j\234\016x\330lf\203\265\333E;\351\005\001\246SW[\236\331c\362"
+	.ascii	"(\te\274)\360\301yQ\231\302(q\032\315-W\365\247,d\t%\202\350"
+	.ascii	"\261\337w\271\335a\"l\232\335\343\005\224\215\fEuq\361EU\200"
+	.ascii	"\027\321$\240\377Hm$\354\233\020\235\241?\002\242'Yx\274\262"
+	.ascii	"I\2763\233#\356@\301\025\375\303\301ka&\n\250\032+\377reY\300"
+	.ascii	"~\337\247\001\371\b\343\300<z\262\334\232v\005w/\324\244!\364"
+	.ascii	"\r\231lf\266\232w\374\242L\021)\212b\224'\373\030\314i4GoM\320"
+	.ascii	"X\241E{\200\320~P\355\362\005\345h\360\001\214)<\360\002\242"
+	.ascii	"X\3271h\304\224\205\203\272F\375\212\205\236\333\345\223\271"
+	.ascii	"%\311\222D\365\017\004\246\306n\323\r)\247;\267\020Xv*\177:\025"
+	.ascii	"\3253>\245\246\300\306\322KL\263u\324A|\300\354\003Mk\274\003"
+	.ascii	"\325\351\215 Y\356*p\315`Ju\254\200;A\351\246\247\205\203\201"
+	.ascii	"\2560\375+P$\214\342\361\r\035\201\256$\325\335$\374E\230N\206"
+	.ascii	"\371\004\001+\320\335\257\301\301^0\203\302\261\357\215u\262"
+	.ascii	"Xz\326\323\223u\034\357\035\334]\313\222\021\257g\3703#==\364"
+	.ascii	"\177\232~\003\300\021[\223 \177I\374\377\220\016\270z\371\204"
+	.ascii	"OnNB\376~\371\226\3530\315\337\320o\273\347\216\357\020\2133"
+	.ascii	"\272wm\2367]\237\316^\375um\255\251W\222C\266\257\004K\264\375"
+	.ascii	"@\322so\241\365S\337\207\377\004\312\270\234\237}\364\361\320"
+	.ascii	"\241\270=\371\035\373'\304\001\261w\372>;\243\257;j\203/\341"
+	.ascii	"^\273\344\254\315gDxw\354\242\031\177%<\224\345\327\323\317u"
+	.ascii	"\362\261y\375A~J\200\266\346\373X\233ji\222\343A;\237\247u)t"
+	.ascii	"\317\320\3455\364z\303\353\r\234\231\250\367\005\253A\204\213"
+	.ascii	"\005\277\247\347?S\335\320\264\201\372P\241\233\371\377\253\271"
+	.ascii	"\341\345\254o{\221\264\f/t\005"
+	.text
+	.section	.gnu.lto_.symtab.eccddf19bc35f81d,"e",@progbits
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"resetAdjustmentStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"pidAudioPositionToModeMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"adjustmentRanges_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.eccddf19bc35f81d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1328 @@
+	.file	"rc_controls.c"
+	.section	.gnu.lto_.profile.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"\005\007"
+	.string	"D\t\213\001"
+	.string	"\030"
+	.string	"\350\300\306\254\005\002\002"
+	.string	"\002"
+	.string	"\001\242\302\263\302\013\002\302\374\277\243\n\004\002\001\002\002\003\240\342\234\212\n\004\303\375\206\360\n\020\002\003\002\004\002\005\002\006\002\007\002\b\007\005\b\325\305\202\255\003`\003\002\003\002\005"
+	.string	"\002"
+	.string	"\003\002\t\007\002\007\002\n\005\n\002\n\t\n\013\f\016\021\220\237\222\215\004\002\022\201\212\206\304\023\344\371\276\347\t\024\250\332\251\210\016\025\026\253\262\211\366\t\027\236\321\306!\030\031\353\227\221\315\013\032\211\236\236\264\001\033\034\240\342\234\212\n"
+	.string	"\" \200\202Bx\333\245|\372\222e\3337J\324h\315nGa8\t\265\013]\241\243"
+	.ascii	"g\367\211\3662\"`\030\346`]\314\2170\004\350'\360\022\354\001"
+	.ascii	"\317\001t\016+\201\3255\252\265\026\220g\360\342N\2335\026\356"
+	.ascii	"C.\246\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375 z\265\001"
+	.string	"\350n"
+	.string	"\006"
+	.string	""
+	.string	"\003\002\001\003\004"
+	.string	"\003\b"
+	.string	"\001"
+	.string	""
+	.string	"\021\002"
+	.string	"\003\022"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\n"
+	.ascii	" \007\327 &\204\246\342ZX\354\342\233\213\261\262D\346*0\300"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.inline.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375`)\001\005\007"
+	.string	"2\211\035(pU\222\016\034|\005\3660\003\020\001\357\201!\217\357\302\003|@\274\211\250SUUE"
+	.string	"\026\007\246Hs\323\332%[\312\024\377G\344\324\301\210\236\225wR\266\271;\350\003\347\205\305\217\310\252\030\310@\247\234>+\223\\\"\026\022,\210\277d\377C C\001X\364\351\260\211\246 @\361\372_\224\031\354'\224sk\264rw\322\275\323\363\214\266\317\311\356\356\326?7\021- `\242RX=\223l \356\360>70"
+	.string	"\231\301\230d {1\003h\005\245\325\364\326\315'/.\2348x\006!\311\341\237\2005\277i&\232eP\340"
+	.string	"c\007\022\270\234\200\343Bs$\005\024\237\273V\360\036\200U\030A\205.\r\362"
+	.ascii	"\002\002@\322\331&x\350\035\337Z\370\005?\274`n7\250\326\254"
+	.ascii	"U5\340\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375`\304"
+	.string	"\365\005"
+	.ascii	"\242\b\033$p\305I\007\234\353\036\250\277\264\252*\372[h\372"
+	.ascii	"\257\336\375X\377\377Ob\210x\375\376@\301\320m\b\221I\006\344"
+	.ascii	"\220\tJ\233\240\215}\007Gn\227e\304\265\034:\306N\\\253H\222"
+	.ascii	"\347z\343\226\222\222\326\232\001\327\037\357\370\332\316\275"
+	.ascii	"s\235\213\262d\341\r\267\023@\035\0164Q\023\375\274&\3465Mf\350"
+	.ascii	"Zr)m\352K\3628#$ p\002\t\232\365\002l\fC\232\232v\254\251\301"
+	.ascii	"\231H\212X\210W\227(4\300&\007\230\373!V\276\004\366d \231\251"
+	.ascii	"\311x\315\r\177D\026T\200\276\fk\251\302o\312\025\\$\031\251"
+	.ascii	"\265\322\t\013B\351\332\303\324\230m\255\220\034y]\341\206"
+	.text
+	.section	.gnu.lto_.pureconst.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\204\004\002\204\004\004\230\004\b\230\004\021\204\004\022\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375 zm\002"
+	.string	"\264\002n"
+	.string	"\005"
+	.string	"\001\002\023\001\002\001\300\007\024"
+	.string	"\001\002\025\004\003\002\026\001"
+	.string	"\002\027"
+	.string	"\001\002\030\001"
+	.string	"\002\031"
+	.string	"\001\002\032\021\002\300\007\200\022\016"
+	.string	"_X\270i"
+	.ascii	"\354\200\215\2402\270j\350UMH\t\002\214\276y\004\263\357n\007"
+	.ascii	"X\030\006X"
+	.text
+	.section	.gnu.lto_.lto.37170b2b81fd7cf5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rcControlsConfig_Registry.77.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375 \226]\004"
+	.string	"\324\007`"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\316\201\023\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\317\007us\345\006uq"
+	.string	"\005\001\006'\001\005\031?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_rcControlsConfig.79.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375 :\255\001"
+	.string	"\244\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\001\001("
+	.string	"?\202\210\200(}{\276\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\003"
+	.ascii	"@D\312M\003(\002"
+	.text
+	.section	.gnu.lto_armingConfig_Registry.83.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375 \227e\004"
+	.string	"\344\007a"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\327\301\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\347\006us\377\005uq"
+	.string	"\005\001\006'\001\002\220 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_armingConfig.85.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_flight3DConfig_Registry.89.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375 \226]\004"
+	.string	"\324\007`"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\337\241\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\375\006us\324\006uq"
+	.string	"\005\001\006'\001\016\032?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_flight3DConfig.91.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375 W5\002"
+	.string	"4\003J"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001'\001\320\017\350\0072\264\013\352\376\n?\202\210\2008\177}\301\001{\300\001y\277\001w\276\001u\275\001s\274\001q\273\001"
+	.string	"\007"
+	.ascii	"*#\300!\314\306\2004\225\313)V\017\240\b"
+	.text
+	.section	.gnu.lto_isUsingSticksForArming.92.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375 \347u\006"
+	.string	"\022\f-3Pm\222\016$\243\252B\266\315-u\267nK;\177\310\244\226\177Kv\325\376\335\016;\273s0'0\210\235\231E\024\321w\200\007\224\251\307f\255}\262e\n\273\314\306\341Q\034\315s\t\216j\216\241i\032\024\036\232\2436-\023\360\203X\240\032\347=\252a\256,\033!\033"
+	.string	"1\211\357GA\252\313qD\007ku\272\035K'd"
+	.string	"\026 ,\375\365A\226\361\255$\033\3758\262\013\351D`$3TJI\223I\244\343\367<f\203\003\317U\257\215P1H&BP2\257\3064Z\025\253[\217VH\027%\226\350S\274 d\346h\211*:\353O\360\027\374\024\001\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_areSticksInApModePosition.93.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375`5\001\035\r"
+	.string	"\006\332X@ \217\223\016\310E8\200\270\035p1c\220\267\234\315\346"
+	.string	"\202\t\243eIR!\312r\312?\214f\254\207\2011\372 \331r\204\002T!"
+	.string	"A\323\025\234\370\301C@\246W\260Y\373\226\220\275\223L)H"
+	.string	"A"
+	.string	"F"
+	.string	"\036@\371\241\005P~5\320\251\307\033\006\026[x\t\225`27\353\027\354\361sGO]}\274\r\024D\210\264\217\237\004\273\215\006\001\017@Kq\032\231i\017\306\025\r\005\261\372\310\314\242H\213\340Rn\233\240m\201\326\023\002\265\313\314\354Gm\261\032\267\330\030\307V\016K9\354sXw\354\035\026\035\326\233\312\224\"\343\224\311rz\221(\236IC\333N\273i{l\315\301\035:ny\320\227Y\241\004\211\314\255\243\033\031\277"
+	.string	"\001\247J\035\016QzG`\314\314\317O:\266p1\221\202.\372\273[\205\005\306\177w\"\024\343\343\255B\005\246\345\260KGd2\363@\375\301 \034\324\031\374\3129A\213\374\352\023\312\317\317Xa\002\341\251\335>xR\003\"\n\260\021\220\222\220\252\227\007\247\001\226\231\220`\027\310\225Y\327\002\213\204A\310\210ue\034\313\203@\261\022\221\3142\301\260\314\332li\227\037\025\335\206\361\034\256\276\322Vs\r\320QZ]s\207b@x\242\336I\356\356#\352\356\345\235\n\031"
+	.ascii	"L\204^\350\206\0275E .\210\001n\300n\025l\001e\300\270l\220\003"
+	.ascii	"r\345\020\214G 1\261^\202{\025<\244\272\200\270\346\300\312b"
+	.ascii	"\203\017\201h5\344U\205\253yo\273\212\036"
+	.text
+	.section	.gnu.lto_calculateThrottleStatus.94.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375`\262\003\325\027"
+	.string	"\306\352\226J\300\324Q\007y\2273T\016\277\214\306\0134N%m\371\371\006\020D\354\201;\002\220K]\267S\316"
+	.string	"\211x\322B(\246<,\336M\202\366X\32545\r\034\005\020\032\315\365\352\330\265E\365m\341!cd\357\275\267\2242\245\224\002\202"
+	.string	"t"
+	.string	"\211"
+	.ascii	"'\222KU\177&\230Y\207\231\344f\321I:<\243\275\242\334\350\353"
+	.ascii	"\341\243T\344\336\236\251\322\245\355J\333e\273\376\210\2365"
+	.ascii	"9\212!h+}\237q\217\271\235&G1\354]\017@\n\342\340`\323>\264\245"
+	.ascii	"+CRB\255#\310\003-\253B\370 s=^}h+g\243*\367^2\307\343OW\200"
+	.ascii	"8\ri\035A\035h\2113\272\365\256\375'Ws\007Y\356\275\354\267\334"
+	.ascii	"\206fV33\0233\2570?\212^\366\214e\256@\343}\363o-Mu\321\021 "
+	.ascii	"4\2361\330\376\t>\0366?\302\243\253\334\256\261\314\261\013\336"
+	.ascii	"\267\376\336u\003-EQ\331~\207\271W\363\3271\367\237\347y\362"
+	.ascii	"\0231\263sY\235S\254\263\253:\243P\347\223\352lR\235[\325\271"
+	.ascii	"\304:\263\2523i\235\307\352,R\347\260:\203\326\331V\347J\235"
+	.ascii	"\351;\277;\273;7\200Q\250J\300\216{q\0016Z\240X\337MV\274\361"
+	.ascii	"I\005]\343i\374\002V\341\213?\247\360\301\023IT\374\300\327u"
+	.ascii	"\213\020\002\344\263\257c\020\204O\312>\270\240g\264\310\350"
+	.ascii	"&\006\r\\\\lW\373&\t\036\375\372\355sE\363\363\3251\034\204\367"
+	.ascii	"\336\003\334L\r\343\001\204\227\227\257A\210\030\371\321\374"
+	.ascii	"\344+)\241\244\3320\366\337W0G"
+	.string	"\350\0270\341\2756\003\334.ZI\002w\211\256\034#S\271e\036\201\025\217\346'?\355R\024\321\327\365\332_\326\n\f{\341X\210\311rlb\260\030\230\314\204Q0mhdjL\230\f\307|\005\340\330\315\214\314\314\211\305d&\331\243\365\023\361\215\323\320\330=\263\275k\221\252\205\006\313=\263\345\3770s\371\314B\373\032\275~\003H\bo|\035\247<\312gp}J\216)\327\277N\036%\n\307\311\327\252+#\016\305\203;\022M^\374\026\222O\312\344\t\374\350\031\252\371\331%\316\350\026\266^\3746\362\345(y\362[\017N\365\034\325\374d\326\227$\350H\250Q8$\031b\250\2102\222\322\202\264\001\240\002\031\251\3329\020PU$SAZ\016\317aT\2524A\332\006\t\b\2443pM\360~\324}\036>\262Ry\212:\272M\034\253\231\236\232\333h0\372M\273\236\003f\303\311\323\035I\3302I_["
+	.ascii	"\307n$W\006\207We\222m\200\202\177\024\271\004\266|p\005JtM\033"
+	.ascii	"6\356\001A0j\316\351\003\224\360\036\317\007B\030 \255\347L\247"
+	.ascii	"\0215\333\213\337\242\210\255\\\366KE\030S1D\330\241\244\020"
+	.ascii	"\330\006N\371\026E\272\276\336\325"
+	.text
+	.section	.gnu.lto_processRcStickPositions.95.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375`\377\032mt"
+	.string	"J\264\224(M0\220\332\031\003\257-\314T\315\232\273IW\277\231\213\355\242FEr\2274\374#\201\357\305\307\0169\222\275"
+	.ascii	"\034!\257P\032\263 E\001a\315\001BRQ\252\\\200\222*\325\301\251"
+	.ascii	"\250\214\213\342\244L\023\"%\230&\"B\244\2242\245\224\002\177"
+	.ascii	"\0027\002\210\002\374Ggw\235\273k\2108,\033\223\216\375`\333"
+	.ascii	"k\243z\303\013\310\332\261\320O\272\235t\253u\353\254\257\376"
+	.ascii	"\35627\334\023\022\204\270\332\336\260\021\346\266@\245\232\215"
+	.ascii	"\333\215\225\334M\272\255\331N\030\357\270\005=\306\301\255\035"
+	.ascii	"\276\357\033\342\330\254P\343\264\315\256m\3236\353\275\306J"
+	.ascii	"\216\232j\266\232\226\320V\333k\243\304\031\240\332\342\373\266"
+	.ascii	"15\313L\307f\271\311l\330mD\336\206C\301\t\267\370\276/\324\017"
+	.ascii	"\341\265\327\266\346\2437\233\247\260\024\216\302q\f\205\341"
+	.ascii	"\370\t\277\261\033;\3416\253\024(N\230(A\242j\004\325\224\b\251"
+	.ascii	"\250\020 \240\236\234\232\230\226\224\222\220\216\214\212\210"
+	.ascii	">\f\t\005\001\375\370\364\360x\330\321\311\301\271\261\251\351"
+	.ascii	"@\303aFf\251L\"\217n\313\256\357M\356\255\346).Hy\341+\212\222"
+	.ascii	"\2748\003\316\2128\353r@\211\212\235`\243\007\313p\374\344\315"
+	.ascii	"\355\306\211{U\243\271m\265z\202\315\270\371\321E\243\255\262"
+	.ascii	")|~t\231\320\350(\304\300\234`\274\301M\210}\225\030#\306IP\273"
+	.ascii	"\212:\205.\372\210<*\035;\246X\034\"\f\013[\032\250\227\226\006"
+	.ascii	"Z\303*\345^\205\345E\255Uso\235;\255\"\351)\224\213\207\350B"
+	.ascii	"\350 \252\3168\250\277~\372\363s\247-Sh\2377\221 \204\211oi\r"
+	.ascii	"\nbF\355@\350\f\253\320\036\240S\351J\222\f{\216t\204$\347\214"
+	.ascii	"3r\257\212\346\232(\360\303\272T\306\227\003\207\006 \205=\205"
+	.ascii	"N\361!)T\\H.\212\007\3155q\24096\377Y\225\2500\302u \224n\315"
+	.ascii	"i\201\213IO\241k\356\343^\255u\001CVp\326\345\370\001\244G\367"
+	.ascii	"\3600i\0170\244\371\016\223@\350\022\327a\302\202\347\254QS\302"
+	.ascii	"\350:\020\252\266\312(1\234\036q\234\033#nSw\3465E\274C\235\n"
+	.ascii	"NS\327\034\002\241DV\241)\324\314g\246\320\025\002\241e.\263"
+	.ascii	"\034\372q\203\254\225\353\322\241\0250\035\b%[ql\034y\366\024"
+	.ascii	"\212\202'W)\031\213c\035\b\035[\227b\234Xz\255\207\246\320\036"
+	.ascii	"\216\\\227Z\222\364\350@\250\330*%&\247\245\313\217\356\225\220"
+	.ascii	"\033\321vyt\353\\\205\034,\354\313Y\035\275\316\204\311X\205"
+	.ascii	"\336\367U\206y\371\267[/\235mQ\243\376\270\021mw\257\336\367"
+	.ascii	"e\177\206\335h^\321\314\254\021fV\301\214\303\030\217\2142\360"
+	.ascii	"3\357\214\316Fw\213\3143\360\355\227\356k\231\357-{/\365\260"
+	.ascii	"\355\002\003\022\345Ky\371\310w\267\020\005\373\272ZU\376\362"
+	.ascii	"\327\276\257\262\020\242\311W\376\016\336\027\f@n\323\004\264"
+	.ascii	"\314\006 \340\375L>\022\220\212\346\365[||d\317\320{,DX\261\242"
+	.ascii	"m\366h\2048H\215r\335\360!zI\256\307\024\337\363`=\357\276\005"
+	.ascii	"o\204\334z-\203\026\267\021\006!\201\004\332f]\"\304\301\264"
+	.ascii	"(\227W\221/ew\006\267\237\307E=?gj\253\007\343\325E\361\275\326"
+	.ascii	"GE=:\347\326jS<\230\325C\351\b\363\306\305\313\305\364\372\276"
+	.ascii	"\357{tk\244\221+lm\323x^\331\023\217\342\301\230\233\332\352"
+	.ascii	"\373\371#\234\325\360U\326\345Uw\333\372\247=\361M\343\233\366"
+	.ascii	"\332\227r\033\271r\302\3323\276\004=\303\023\017\326\362\261"
+	.ascii	"\337*\320vV\330GN\263\244\261q\261/}\373\247\235\361\020\030"
+	.ascii	"\211s\346h9-I\242\353Ky}\377\2547?/\027\303\377+\003M\327\300"
+	.ascii	"\361}\275\250\270\345z\356\201\b$\220\240m\366\337\210\220\255"
+	.ascii	"\337\277\235\215\\^}{\n\213\343\373\276U\334QZ\n\005\334F\232"
+	.ascii	"\345\nZx?\233\345n\3216\333\317N\377\250v\\^eo\306kS|;\277\335"
+	.ascii	"\232\b\361\257k\020Jc\227W_LN\013\222\177)s[\227\177\020-I\304"
+	.ascii	"\252\360\007a\356'\215\031\355L:Optf \351\274\"\351\254\242\235"
+	.ascii	"4[\245@\321j\315'\\g\023J\347\022Jg\022\256s\025\322yD\322\231"
+	.ascii	"*\351<\225t\026\221t\226J:G-\235C,\235A$\235\241f\234\237d\234"
+	.ascii	"\235\\\347\246\2453S\322y)\351\254\224tN\222qFZ:\037%\235\215"
+	.ascii	"\226\316E\2563\221\353\374A\351<\244t\026r\235\203\222\316@K"
+	.ascii	"\347\037\327\331\247\325\232{\222\316<Hg\017I\347\235\245\263"
+	.ascii	"\316\3229'\351\214\263t\276Y:\333\270\3165J"
+	.string	"\347\016Jg\032\327\231\203\322y\346\350,st^\036\235\225G\347\344\321\031\351:\037\223\316\356\321\271E:\263G\347\025\351\001\314L*s\214{\241\025:\351\265V\013\345lP\277d\346C\215\305a\270D\021yE\257\260\311D\221\035H\230\222\332\247_\036\021\352\244\326\351\237\276\207\321\351[\263\237\271rf\303RT\263h\233\376\177\274\365\271\320\364)\b\035hF\342\231\022\323\013\320\002\223S\034\036\224\244\244c\340\322'\371t\351Y\301B\270.C2\244e\035\031Q\031[\215#\243\016B\205R\017\213\216 q\374-i\276'gD\315\254\266J\277ld&\243\2371\253\256\202\027in5\273\2322\2322\332f\225\236D\227\037\225\355\003\2151\037h\336n:[\244O\200,\361\215\320\004X\323\004\357'\322\353\320\215\001d,dB\206\216\276\247UaM\034\336\317\243\317\241\243&\t\303w'\244\202\320\350U"
+	.string	"1z+2,ekQ\023:\005\276%\353_\232\220\240\"\263\242/\"l$\033\242\034\220\317h\"2\242g\023\365\2505\214Y\242?54\265\213\223DA\2521 A|z^\332cj\213\342\007\217\016\375\207o\374j\rZ\241\037\nz!\035A\357\336\315M9\207n\362\020k\24203\005\364\342\271\2413k\036`"
+	.ascii	"=\274tL\257"
+	.string	"\020\323@\277\302\241@\357\n\306\245\305\260\241\n\365\2603hk\2708\340\026\025\235\005/Nv~\276\305\370\363\347\213\b\333\215\n\236\240\223\330,Z\037w\372<\233\b\2276\203\004\312X\316_k\265=\03746\344\311\034a\023\234\2272\223\345P\031sdx\302\315\267V\313\363M<\022\337\374x\234\253[\253\335y\236\352\016\225\277\320@\303F\347\227E\314t\276%\363\356\342v\243&\347]\013\024\220\246\324\373\231\363\235\346\243\353\267X)z\324\016/\345\237v\002\344\2177.\375\323\342\374\004\317\356\214R\233Cp\336\rdL\213\"\251\320T\202\270\264B\223\005\245\037\r\22237\2234\225x?y\206\312\036`\327oq\343\265\242\326\007\t\270\323/\213\212\\^\245A\224\201\006\207\233\317*r\356fZ\313\334d\322\\\363~\336\374\f\025<@\257\337\032\312\202\0266\363R.l\233\267\340\215\313a\006\315&"
+	.string	"\330\374\337P\244F{\336\020h\307b\331\232\314K9\203\226\233Kw\311"
+	.string	"\006"
+	.string	""
+	.string	"\264\315\262v\206K\024Y\264\203\354\324\313\242\"[\311\023\"\270\254\371,\375D\354\36054?\363\035\276\277\3128<\215 \207-bl\2005"
+	.ascii	"\f\0164\310r \013+\006\026\007/\262\2606\300r\341\242\205\216"
+	.ascii	"\006\355\001\007\016\304\200\301\262\213'\030\033\274\310\212"
+	.ascii	"\321\301\013\027\025"
+	.string	"\270\310\202r\201\001T\007\032\264\340"
+	.string	"\312E\026\f\250'\037~\341\001V\026T\214\027/\262\240\224\\}\305\365]\3748\272\235Q\205\323\027\261^\346%\"\360\207B/\363\372\016h\272\242\243\227yz\006(a\366\335\001>\217\316\251\002\210s'\243\2001v\306#=\330\305\244\241\275>\242\354a\210\240\375\016vE\2603\264\317\3215\362\232"
+	.ascii	"~yc\241Y\224\200\037#\205ek]\370aP[\024M\274\215\022obG\223\370"
+	.ascii	"\022UO\342M\250zW\207\334L\236\331\005\356\224\306d\362\001\222"
+	.ascii	"*KwG\006\360\232\221\243\272\330Xf\002\274tk\355\277r0\216i,"
+	.ascii	"3\037\0010\273\302 6\026\031 \025\200\2276\213&\377\262p\332"
+	.ascii	"\302\314t\322p\314\267#\"\357\373R5+\023\344\313\242\"\327\227"
+	.ascii	"n2\037\213\207W$\254\357\373\303\n\256;\034\272\0356_m9c2\206"
+	.ascii	".V7\2603\262U\241\262\213Y\253\003\303\036\206I\025\265%\211"
+	.ascii	"\354\212\375\302q\201\227\356Pm\211\rXdP\352\341\22772\005\276"
+	.ascii	"6\357\265L\335P\032\216\031wC\344\311\314\224\302\244\002\327"
+	.ascii	"]\343n\r\360\353\267x\212\210X\212\2272R\353\341\033\251\035"
+	.ascii	"\361\036\234\320\2710\347\352\230V\230V\332fG\274\033\304\013"
+	.ascii	"5\2058$("
+	.string	"\250~p\355\237v\352\251\276\2359\2600\357\246\236\215a0m\251\006\033'\206\354\bI\342B\233\211\2076\343\3411\275Ty\370\310J\360h\255V\304[\340'\342\331 ~$\364\232J\354\022\237\260\254P\225\327Z\255\324\357H\005\337\b}\256{DC\271\202\327n\207G\325d\245\256\335nm\252\201=f_\232\333uM\013\200[\316\310=x\243OD\036\273\236_\021\264\327\307\035{\f}=\320\336\267\n\273\0256<\276\357V\227\361\036\313\376|i\224\241\275>^%\247\343.\363\347\253$$\303\033\345\244\336\0019j\324\035\233\362E\212\371\327Tb'\006\330U\305\007\026\365R\236\241\265\332\250\377i\224\250\357'\317\345\256-D\210\267@\001\301,\314A\357g\210_\332\351p\361\204TA@\255\360d3^\027\246\227\231:*\343\201q{\002q\200\257\315\264\241ef&2\277x?A|\214*\032\365p"
+	.ascii	"g\352\202_\250\022\361,\322\342L\251\031\022\221\024$I\24112"
+	.ascii	"\013\020\210\202i\030T\353\001\022@TAK\204\314\\IA\222JZ"
+	.string	"\003\241\322\203g\373\264xM+=\360\r;Y\024\364#z\353X\226P\224\204\211\302@\273\253\007R\242nW7\303\343\236\341\360C\375B\247%\243\311\251\350\302\b\243'iG]^\337E>\247:h\345\213\330\027_3\216\334\0301\300M\310W{f%\306h`\273\326\013U\335X\3244\337\330\260d\270{\221G\222\254?\003\377p;\277Y\020\212\267\303\022\021\264d$\275\323E\027\354g[\023\215X\033:\341;\251\\\232\242\332N\301\313\226\231\363\001\033\035?\212z\2703m\034\t\202 \346\257\257s\347\307]2\206\374\300\352\210\345\030\353.~\324\362\356\266\243)I\023\374\0054 \231\372\024/\251\006[\363r\325X\021'n\177\311\n\327DE\273cQ\264\353\031\f\332c\225\246\bF\274\366D\256\254\3379\344\365\f\017\355\267\033)\323\017q\257g\263T\007u\275\n\215 ^j\204\n\250x\236\370\352"
+	.string	"1k\032j>\301a\t\365\270\213\211\316\036\247\240\016\350\254\341\357\251\241\321\004\226a\333b\b\001\357\276\247Q\200\361\342\363$M9\n\255A\276\316\262\220\001zG\334X\013TF\251\243d\233\356\336kP\033\032\211?\342w\027\313\244q\211\377\256\303;\354\317;\034?\2056\251"
+	.string	"\224t\327\366\024t(p\327}\274ix\223\337\022\233n\027\013\345\304o\025\006\200\206\246\365\361\303\314\247\b\267\214\270i3Pn\237*R\252$\027"
+	.string	"\2013{\003\310Ll?\354p\252\001\2375\321Aa\035\"w,\222\313$ce\332Px\033\300\365\357$\017L\244\177\364m6@\207\377\214\265\031u\207l\216\037F\035\203\277\026\347q\007\245\237\266e>7\254@\232\t\253p\024"
+	.string	"+Zqn\366\370\016/\f\007.\341\t\305\374\312\373\314\313>\002l0\213L\031\t\337\316P\253\301\242T=\331\274\007|\256\0203Njx\227\370\254\314.%\312*_\320D6\310\202\345\030\f\274\023\003\347\223i\013H;\t&\004\345\by\276\364z\264m\f\201\236_\312I\357w\3226\006\004R\030\216k\264\035\332;\302R\025 \003i\261\022\202\020\004"
+	.ascii	"\344\327\301WP\236\003w\327\220\322\345\365\302\244\360\016 "
+	.ascii	"AlS\231,e\006\311\270\223aK\037f\343\250!\225\204\227\024\315"
+	.ascii	"\255Fo\350\230\211\276.\303\216\245\002\024\350\330`f\r\231\360"
+	.ascii	"\216Zx\355\274\322p\251\330\036\225<^\351\256>\243\325\017\220"
+	.ascii	"\271\316H\367\022Wx\352>\337\006i\363\356\034\006TBT\313\357"
+	.ascii	"\354\312|\031\255@\352\264x\rgM9I\333_\023\270U\274\212\324\004"
+	.ascii	"qH\2206$\216\210\223\250;G\277\376@\016''\247\320\247"
+	.string	"\256M\"\277\005\376\272\277\357X\0276^7\207\275\343N\001\311\355\246\227\276\333b\241\026\225\211~\255\254-\310Y\343\236\021\311$d\224\360U\232\206y\330\360\252j\027>&\3676\312\f\255>\206\232%\025\301\b\321d\240n\337^2\313\331\006\001\247#p\206\244$\177e!\206-\341\006\271\203:\203\360\257\"\246\214k\001-f\300\027\177+~Z\222\301.\214\367\344h$]\020N\232\214\020/\006\243c\2471wtx}\300\346A\b^\375'x\2750\356\257\210pz)\024\373<\347\031A\005\276\003k\027\251S\3349\301\035\207\374\204\244F8\333U=9\334\321\370\227\371\272TcZ\023\335c\274\031\027\343\233\201\fsp\360O\231\237\023\372\"NB\240D\270c\270p\355\232\314\224\310\340\205\230\223\241\233\316\367\373W\276X\355\030\241\025jW\315\373\365T\371f\210vb\370\274qO\266\\U\032\3246j"
+	.ascii	"=H)\334\2709\264q\354\341u\211\"\227Y\226l\342t\211\303\361\003"
+	.ascii	"N\357\030\r\337\2108\262\r\216\252c\213\201\217\024\033Io\032"
+	.ascii	"\247\310%\016\026\327^\r\004%z\374x5\236\250\006\177\253\013"
+	.ascii	"K%u\312\223\343u\0014\037\215\026L\270\317=\030\274\213{H-\002"
+	.ascii	"\177R\322\365Q6\017\230\227\344\274\262\002Z"
+	.text
+	.section	.gnu.lto_getRcStickDeflection.96.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\025\r"
+	.string	"\026\333\\B\020\257&\035\203\2012\226\315\254"
+	.string	"r\211y5\254\326\221\316\230"
+	.string	"\335\320x\261\312I\224{\031\274~\261\312\372\205D\033\036\224\266S1\024"
+	.string	""
+	.string	""
+	.string	"\032\333\263\001d\254\210\n\221c_\222C\b\331{K\231RI"
+	.string	"H"
+	.string	"H"
+	.string	"\001\362\233\230O\001\331\332\315p\342ew3\214Q\035\332\366C\\\304\307\240\307q E\224\013$%\232\335\305\b\\@<|\337\304C\335p\320\023\344\177\345\317EL7\"\211<\251\005\273\353\034\221Jn\275\355\002\2667\354W\b?\324\264j:_\372"
+	.string	"\256\016\026j83\273\024\272\232M\001a>\334t\373%\277\305\344\323\267d?a\005\n\206\026\273\213q\350\003\325Y\354\353\360\366\307\276lk\332\347>\342s\025\t\206\273&,^v\271\f\033\250\016\003\235R\212\300E\004b$;GUM\240\342\232z\222\027\241\354<7\241U\273\273\341\223x\211\b\276\207Cw@\362\243C\037$\036^\337\362\r\212\030\230Pv6'\222\252\301\376\333\335\265\236X\232\256n\272\251\253\374\361)\001!\034\231m\f8\036\260\303\t\351x\3164:\017\264\315\363\241e\034\331\206e\016\260\017N\207\007\226m\035Lc\2005\b\r6\314\243i\033vq\373\267zb\333\226~\345o\306$\244#V\231\373\024+\265\364,O\227\222H\206\322J\025\234D4\241\f\020"
+	.ascii	"2\241\251I\343\365\204\337xa\271\006\311\304\004\3105\212\372"
+	.ascii	"pPgf\265\001a\370f\257\253\024A\022\250\300\202\237\031M\355"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_rcControlsInit.97.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\225\007"
+	.string	"\362\01655Po\322\001 \017\221U\223#=\232\3424\036\b\212\023\311b\233\316=\367\233%\210\323\231e\021w<"
+	.string	"\264\264\0203n\306\364\230\302\013\302\300N4K\210\224)\005~\034+\002FO\007>\205\027\335kp\035\207\205\312\275h9\316\200\241\004Ct\036\b\243\333h\373iu\224\240\262}\024\344T_\373\310\205\017b\210\212\362\253\314)%e.\327\324\203\320\306'c\f\220\376D\306\266(\362\331\225\240\204\262a(\346)\355\n\213|\346,\235l \305l\rK\345\260?\255\216\354\247\363\351k\004RX\036Vv3b`v\243LBl\177\343\313n\271\346\261/\371\b\221^v\327i\307\257\347\345_\344\001\231\b{j\020v\327\231\2114n\275\355\002\333\006\266I\002\n"
+	.ascii	"3\241\227\0378\310\034[\312\374\001\013]\303\021\206\360/\343"
+	.ascii	"\202K\267h\347\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375`\346\004\215\024"
+	.string	"\206$\205F\240\326\312p\324yU\035\200[?ub\300(\212\0277\264PC^\203\036Q\"\277\347[\002}\304;\370\265\355V\247@\312z@&\340\265\340\3158\305\213\256\274\235-\032@>0  \245lE{!=\233\310-So"
+	.string	"o"
+	.string	"u"
+	.ascii	"<\027\023\377\"\247\242#'\244&$&\020I$|WR\312\367 \342N\237H"
+	.ascii	"\250\323'\013s.\245\367(\"\316\277\304\233\263\331\034I\315\217"
+	.ascii	"\2104G\023y?\373\331\026\325\327L\177H(s\263]\314Oq\367\037\033"
+	.ascii	"\f\006\2030}!\341\241t\367z\351\217\205\373+9\0368\016\361\177"
+	.ascii	"\0305r\375\375\363h\241\271q\034G\003}`\370_,\013\272\272\334"
+	.ascii	"~h\205\362\320\032\325\241o\204C?\311\206~\233\206\276[\206\376"
+	.ascii	"\033\206~\332\205\276\022\013\375\265\n}5\242\376\022\n}&\023"
+	.ascii	"\372p\022"
+	.string	"\372M\"\364\235@\350\307=\350Cq\320\237\322\240\037d\320\177\262\240uT\320/\323\377\3418\216?\314P\277\210&\270\016\004\317!\364\035A\357\001t\037?\377\371\034\254\347a\342_\202\311\251IDR\274K9\274#H\375Ye\205\303\253d\352\360*\225\032f\001\177;\274F\245\217\327\210T}\001G\306\303\033\202\3240k\355F\217WWj\r\033\013\036^\227S5\255k\252\207\327\245T\321+,\316\207\267\245\314\341m!{\274,\247\016x\003\222b\207\227\205\324\0303-\027/\274*\247\002H\343\242\361\303+\340T\002\300\267\265\037\336#\325\253'm_/\271\345\005'\322\3348\216#\320\312\362\202VV\267\316\255\362\254Qj\201\237\024\314\271\343U,S{\277\0311\274je\252\320\025\225\f\257\3060\325\005X5\303\333\247\372N\031;\336&M\024\244*\332\324\030\217\367\004\251C@\0254\274&H\r"
+	.ascii	"f\025\324\361>\235z0\270\256\032\336\247\322\206\367\211\324"
+	.ascii	"\220\324R\273\341m2UE\f\313\r\207w\311\324\031\0306V\364\002"
+	.ascii	"D\2501\024\302\311L$\022Q\3202\n\352P\203\3146\215\001\021\240"
+	.ascii	"\034\307\220A\302\215h\020\t\344\003\330\254\335\013\r\330<f"
+	.ascii	"\357Y\202(u\350\203\365\337mZ\201X}\374\212\345?\357\373\336"
+	.ascii	"\376\356\353?\267\342\243\227%\211\205\025z\362\366\220N\246"
+	.ascii	"\030]l\364\003\306\317\340{\236+\3560\022\347m5\305\212\221\330"
+	.ascii	"\204\211\311u\210\206\346\267\306S\332x\267|kBY^3\3324"
+	.text
+	.section	.gnu.lto_.refs.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\215\006"
+	.string	"\262\216,0`M\222\016\300\266\307\252\030q\361\034\250 \b\325\0130t\b\202 \b\002\f\r\377*\226\316\227\201l\221-\354\260\326\266\326\310&\215\020\322\310\226)s\260"
+	.string	"\tp@ip\203\023\n(\ffpa\200\372i\001z\331\227^\214\327{\221\275\026\371\255\260|)*\275\023\225\257D\n\312\211\373MJHFDB\246\037D\372?<\336\337\301\361\372\033\331\327\310?C\372\210\327!\336?\344;D\275!z\006\351;Q_\350+\270\236\360:B\366\203\354\006\371\231|\214{\332#\033\352\274i\257aoY?\265\217\330\273\366\215\375Z?\320L}\325\210\367\313\t\f"
+	.ascii	" \004\304E\211\252*n\251`A\205\200\270 <\210jd\006sE\3156pY"
+	.text
+	.section	.gnu.lto_.decls.37170b2b81fd7cf5,"e",@progbits
+	.string	"(\265/\375`\2654\265\344"
+	.string	"Jf\241OW \fQ:\215\001\345\3118\034;\024\035\235\312\350\031\214\362\301\346\3018\216\277\026\216\327V\232\301\350\265.\361\340HI\225\331\235\b\273\367XM\220\226\330\326^\266\341\027\323\374\360\261*x<\265C\323\351)\254MRX<\324\213\221\354z\271\371 \021\225\227\032\221R\312\024<\004\b\005&\005cl/\246\220aj{\306%\325a\026\270\305=\303\311{Om\321\362\301U\367\354\302=A\200H\221'\b\034\206\221\356\332\205\3131\201\257,\317;\006\207\335\025\356\031N\262\271]"
+	.string	"\263\266\230%\036\017>9\2722s\023\3208\001A\320c\034g$\330[\f\270\265\247t\2075\266\3629\2761"
+	.string	"'jhX\003\177Y\350\1773\320\377\216\320\3776z_\025\024O\351\030T\254z`}\237\024\364>#\350};\320\327\371\226\320\373\210\320\347\351<\364\232\013zM\207^SA\257\241\240\327N\364z\007z\r\003\275N\242\317u\350\263\033\372|\206>7\321\347+\224G\005.\272e<xE\034\221\222\024\326\317U\350\n\366\336\345\371=;\241\317*\320\016[\320\343&\350\007\030\bz,\205^\354\356\241\277t(\207\265\213!\205\f\320e\032\331\227\030\274\333d\016)\203\365\227\373\274a.s\357\345U\341%\311\356\336\3352\r\027\314\275\313A\304\204\365\357\033\252\202\275\257\206\337\335\333\273\032~\230y1\374\f\320\305\347\327\013\016\323\220$L\260\336\271\026\270h"
+	.string	"r\241\321\270\261e\256\246\313\226d\022\353\203\250r\345Fe\207\026[\033\272\"\t\217\347\030\007\035\334\271\313\344\236\345\246\026p\211U\327\023\rJ\326\375\232r\327p\224:{\251\242\207\326\336M,\227\356^\271u7\313\225\273Zn\331\235\273p\277Vn\334qs\357\345\336\3737\355\367\371\235\273ow-7\317\366\222(\316\203\234\223\254-o\357\246\007\036\017@\247\227#4\035\375\347\305\360\303\2716\320_\024\320_\025\350O\200r \242\033\204"
+	.ascii	"\275j7\312-\313\340J\371}r\323\356S6w\023c\225\031C\202\365G"
+	.ascii	"@\1773\370\345\275\275\233\301\357 \240:\027\303\017\237]\f\277"
+	.ascii	"Kv\233\334\262\013\256YN\206\345\334\2540d\005=\254\037\001\364"
+	.ascii	"\327\311\005\240\334\035\234\007\375\275\340w\367\356\005\277"
+	.ascii	"\243\350\341.\006\261\013r\2321\222l,Q\362[A\303Y\005\353_%\377"
+	.ascii	"u\336$7\303\314\275\233\354\2753\240,\360\312\250\200\365\335"
+	.ascii	"\027\303O\347Z\370\3350\237_$\026~KO\315\235\003\001,\033D\260"
+	.ascii	"\316G\376\353u\277.X6Bbn\261\275\233;@\257(UbX_0|\215\334\346"
+	.ascii	"/\330-r\016:\270\315r\177\355\335\274`zo\345\275\030\340\334"
+	.ascii	"\213\201O\215\207\022\311O\037\243o^\f?\364Z\370\2618z\315\237"
+	.ascii	"\221<@f\376\\\024\341\201\377~\340\277\351\177C\360c\016\334"
+	.ascii	"\300V\030\004\017\260\361\343\021\340\017T\375XH\365cb\215+l"
+	.ascii	"\374q\020\363\307-\215\037\2370\365\343\024\334\344\f\374$D\006"
+	.ascii	".\212\3721\333\1777\310\340\307%\300ORB\377\315\376\363g\020"
+	.ascii	"\027\304\177%\200Q\200\201a`\016^\374\230\001M\377\021\300\363"
+	.ascii	"\177\203\322\177\002\374\031\203\022;\372\317\276\377t\377\257"
+	.ascii	"\374\237\373\217\345\177\335\377\270\377Y\376\313\344?\372g\247"
+	.ascii	"&\314\204\227r\b\377\325\300\217\377?\377:\273\300J\026~<\200"
+	.ascii	"\037_\360c\001"
+	.string	"\374x\303\217\003\360c\f\016\3745\b\377\355\362_0\377\275\373\357\363\277^\376k\367_\274\244\377\266\375\227\313\177\267 \375\317\3715\007~|\364c\026?^\361\343\344\217W\360\343\024\374\370\004?6\341\307C?^\177,\364\343\343\217\201~<\3741\t~<\202\037\213\340\307 \370q\007~<\342\307\022\3701\004~\374\301\217A\374\270\347\307\n\370\261\207\037\027\340\3075?\236\371\361\375o\336\177\305\374\227\354\277\\\377\005\362\337\254\377\362\370/\326\177q\374\327\352\277T\377\245\361_\251\377B\3757\306\177a\374\267\351\277K\377m\361_\243\377.\377\253\374o\n\376\213\202\377`\376\207\371\357\t\377C\370\237\344\277\221\377\242\370\357\320\177\327\377\232\340\277\307\377\032\377K\374/\345\277\302\377n\340\277\030\370/\346?\336\377-\377\265\374_\362_\311\377\f\374o\376\027\341\177\333\377\233\275\275\275\275\337\007\201\277\006\3517"
+	.string	"\2257G\031\314h\t\353\222\233\031\214\004{/1\222\214\247/X\347\"\331\3103X\376\312`\013`\356\255\314`9d\366V\346\334\213\301\275\030h\"UYL~\3727Eh&\342\363\354\205\263\304\332\332\260\276\261\301\"DH\346\272\021pr\365\314i\262h\n\341\362\305\001\351\301d\315\207\217\fdf\357mw\200\264\233\245%aN[\317@p\335\rW\325\020\037X\347\037\270\316\206\206\225\253.$YYw\255\003S\2514"
+	.string	"W\r\264jmJ\305\026\017\036\367\214\207\231\274\343"
+	.ascii	"\306\3443C\342\344#\207\216[\226ud\254\2747\023\252C\020\273"
+	.ascii	"\034/\354v\344+\236\234%;\274\256`}\033(\3646*p\340\270g7l\273"
+	.ascii	"\240a\221\004\213\312\333{M\203\0341Bf`a\375\232)6\254\356\331"
+	.ascii	"\006j5\310\320\327x\325\240\272`\232\203\232\217\232,\36455\246"
+	.ascii	"rT\246q\303p\230\322\332K[\203\3278\241\2579\222\021\225\245"
+	.ascii	"\356\031\272\265\200d*r<k\224\350iRxz\312P(O\232\217\013\352"
+	.ascii	"\276\240\356\345&\256)\313\256\022\343\267,\307\300ep\330N\322"
+	.ascii	"|\201\023\263\204.\351\224Jf0\3122\214\213\327\201\271\2338\004"
+	.ascii	"\261\262%&o\357'\rn\204<\201\242\002\322\364[\226\233\260\236"
+	.ascii	"\317\336\312(\016\\Vp\346fLyN!!\345\245\373\264\223w\035\212"
+	.ascii	"\370@\263T\241\342d)\273\240\221\241\325\304\013\353\254d\263"
+	.ascii	"\207E\016\f\353\323$\345\244\031\274\026\267,\267\270J:4\367"
+	.ascii	"\213\r[>\2364@\225\356\236\315-EE\331\310\np\254\r\206R^\361"
+	.ascii	"l\364\373\322\242\t\013\326\307\273k\032l\353\351\006\032\372"
+	.ascii	"[\344\346eY^^0\236\235\264\333`k\251\251\301g"
+	.string	"\214\240\307{y?'\313r2+/\260\367\276\340\305\204\325\224\267\237\236:\324|\215iq\303:+\301l\366\206\031\037[UHX\177\246\005\372\333\312\245\275w\223\257\271\227\210l~}\367v\370on\276\005\330\333\303\210\346V\232\315\205A\267\314\22428\354\373\340\366^R%'@\305\264\244r2rR\355\344\262GrgiS%\215\234{\357\354\34529\202\271w\214\234\233i\253\210c\272\273I\225\334K\346\336\331\313\255\344`\264\244b2r*\231v\214\234TL\333I\265u\366R\271\304b\271\227v\266\223\312n;\231L:FN&\223\221\223J\307\235\302\002\007\224\246\2629+\251\213f\264\334JIR\312%\0358\243&s\327\355}\305\212\366R\001\366\226b.\325)\235\356\031\021\234\022Q\023%\3636\223\210\252\230{\tg\004\204\2717\020\"\240\235\264\200d\023n\353\270pI\033R\033\251h\357"
+	.ascii	"$\355\235\274\033n\357\235\334{\003\227\244\232{G\351\030i%%"
+	.ascii	"\355\375\304\223\264\245\222hE{c1-gLF\316*\246\017\232\022\247"
+	.ascii	"\326^\321L^\255]G\265\204:\223G6\022\030T\213\351\305\035\326"
+	.ascii	"\315f\315\331\324\030\f\254\311\370\222OJ"
+	.ascii	"Il(V\201\007\310\303I\224\347X\n8\317\204\273+6#)\204\301x\330"
+	.ascii	"\351\350G\223\2170{\206\016\314\f1|g\007\304\233\033c{j\260i"
+	.ascii	"\243c\262gt\300^\232\316\013O\\J00\227\031f\024\022%\022\212"
+	.ascii	"\263`-\267\fo\271\016c6o\2622\006\025\263\016\277\234\016?|\005"
+	.ascii	"\323\335\262\253a,3\313\346v\352\220\222\324\201\365\321%\212"
+	.ascii	"\002x\2576'\247Vf\355\t\326q\330\312-\303r\030\016\nv3\253b\361"
+	.ascii	"\334{c9L\005W\2512\322\340\301\003\315\335U\324\023=\256rg\315"
+	.ascii	"\013\270,PXs\340s\374\366\353\202Rc\f\027\264\215\347\006\007"
+	.ascii	"3\b\r\254\017\204\202\376\246I\271ap|{3\311\260\341\265[\206"
+	.ascii	"\247\340(\307i\327\315\211\247`\265\033\346\302\345\330\332\205"
+	.ascii	"\226\336\223\256\275\267\007\036\017y\214\223\312\363\247\017"
+	.ascii	"\304B\017tB\017lB\017<B5~\202\226\311\314\212<am\206\317n\031"
+	.ascii	"F\303e\267\271w\023\204\023\235Mt\305\b\032n\262\363\0250\245"
+	.ascii	"\246\256\275\233<\036<\330x\025Qk\361\323\377\221A\377\243C\377"
+	.ascii	"\203BvA\263\350\231v\244eL\351M\313\271\344\206\225\230\250\213"
+	.ascii	"\326\230[f\214\326\230\244\027\374\004u\317\232<\335\226\330"
+	.ascii	"\250\213\313\363\307D\260\021\254\004c\341&N\202\227`$\270\007"
+	.ascii	"f\202w\340,<\206\213`1\254\205\217`\037\030\f\003\301^\270\013"
+	.ascii	";q\020\274\205\177\340!\370\013\013\301<0\327-\303a8\307\261"
+	.ascii	"\016|\365\325t\317\330\264\366\366\0277\030kO\264\253\247\202"
+	.ascii	"\023\273\240\202V\343\236\201u\200c\224]\025\356\231\236\017"
+	.ascii	"\023\323\020\323r:9\321\362\301a\330\006\306a\343K\213\f\225"
+	.ascii	"\221\270\250{F\226"
+	.string	"\206\202\231\217\024\023\255\031\230F\316\037J\\$cX\371RFI\363\300qSvp\276$M\3454\366\305\206\265\357\310w\224\271\250\256\236\362\332\366\202X\351\342c\341c\241\267\320\342\256\236\260b\230\3115!\"\362\255\340a&\355\026P\245\t\f\220\274)7:,\276\345}+|E5Sr=\276\260\366\251\310\221\202G\343l\n=\036\036\223a\017k\005\326\007@\222/\351Kf\345\007\254l\211\351\032\023$im\314\336^V^\030\362\303\213\2306%34&e\312\304y=k\240\250\240y!\0313F\3535@\271EHW\024\230\267+\025\256\365hV(\262#\023\263\201\026\254\0366RH!s]\263;\257g^\263iE\226\031a\302h\274\013[a) QA\006k<1Q\246\310`}\f.\356\356\302\274\236UN\033P\364\236\317\f\365\304\353)\346\246\226\244E\213\026\355\345\203-&$\024\240"
+	.string	"\321^\272xy\253\302\206\265\346\202\312\215\261jS\323[.\200\321\321\351\272\033\246\224{\312\303[uvR\260\\\327i\035\\P\330r\301lZ4\245M\271\210\213\323sV\300\242\3622\021\026t4\344\256\3470\230_X\001\007\247\331\300\246\272|NI\234x\224\275\375o\231\213\207\231\277Py=k\024\031\303\344\346\246\277~dEu\025U\005\261\260\327\3264[\020\246\336\223<\013\224VZS\256\3312\225\253-\247\005uJ\256\231(\321Q2\235\315N\206m\027@36!O\362\266\321S\207\232#GG\254\240]G\271V\343\240\203w\351\022B\247\304ZC\271N{\242\362\344\371D\247mY9\271\306\320+"
+	.ascii	"\r\213\301\304\204\265>{\227\003\351\202d\207\2656\273\332\023"
+	.ascii	"\226<\034e\177\253\222#\302Z\223\351&\267\354m\332\311q\236\254"
+	.ascii	"\030k\013C\277\202\373\266\237\026\273~2eEEd\t\023:\031ZA\320"
+	.ascii	"[\320\243\331\324N\006,\351=\351\312a\n\023#\t\311\265\323\007"
+	.ascii	"\006\313n/L\252\2062/L\037\241iB\353\021\006\353#\030NC\016\362"
+	.ascii	"\302\255\b\353[\300d\304H\346z^\356\251=-\355\205%\311\254\f"
+	.ascii	"\021\"\372\213g\253)+\n5\013K;\363\272\376\362y=i:\235U\211\341"
+	.ascii	"b\326$H\020\335\345\323\204e\244\313\006L\205\270\"\\\327]7x"
+	.ascii	"I\340\214h!\2777\027dT\330\231B\357C\373\320[\027\300\356\256"
+	.ascii	"\236:\340\310\335hq\244\177\\o\345\020\005\331\341\004\337tu"
+	.ascii	"\271\002u\227\225e\325b\211\327r\214\333\216\177\207\346q{\320"
+	.ascii	"\300\211=\271\334\344\325\230\202\342\264q}e\343\256j\306\323"
+	.ascii	"G$\243\b\326:\207\326\201\343\206\225\316U\322\365\213[\246\223"
+	.ascii	"4U\207-L\227\307\345\013\3265n\256\210\301\222\004\353\3538\241"
+	.ascii	"4\364\224\226\3223\264\214[\246\231\032\352\032\006V\376\272"
+	.ascii	"E]0\234\237\225\224RS\036\n2\234\240\264bDi\246~\262zRj\312\003"
+	.ascii	"2\021\202\245\206\215\276\216\022}\316\027\3649t\350s\246\240"
+	.ascii	"\317Y\202>\347\007\352\273\026~\232I7\351%\355B+\3450\241\277"
+	.ascii	">\322G\031\353\352\354%\321\033\312\344\b\021\272=Mt\315B\023"
+	.ascii	"e1&\212f\344\252\262\362\026%P\306\260\326+\264Q\221V\241\227"
+	.ascii	"YT\270\336*\350\244\b$0:B2\344y\223\246\307d\327l\322\330\255"
+	.ascii	" \366\004\353\274B\336\313e2\031=\234&yyX\217Gg\357\252\2743"
+	.ascii	"\233&\024\2128u9y\226r\313\262\223,\306\207h+\211$\200\313\n"
+	.ascii	"\315W\021<\032X\343\341&`\354\254`\241\277_l\331m\313\223Jn\373"
+	.ascii	"\322\362\204\313qB\252<\337r\033Nrgo\033Y\264"
+	.string	"\274\3440\031L\266\313_\362\335-\313\317,\367\274\226\247\234'?s\225g\236\313\\.\334\223\316^\226}\241iA\0057\003G\263\275\313\006\"\243\013\030\351\262%w\271e\231\313y\232;s\311W\262\226\013\367\324\334M5N\254\334\275i\360ps7W'\343\247%\013N\223&\0160X\347:\340\223S\233\212#\272[\226\261\240x]hz\357R#\345\252\n\307\b=\216\022\375\r^\266\202^y\316x\373\202\376f\013\372\033:\3647o\350o\246\270\3456\237\223-\314[\033\226\243\202D\244\206\342\016\327\302/C\311Qr\210\234\335 S\013\341\252\n\031\326:\r\267ei%=\301\251\3531v\004\315G\266\027\006\n\353|\206\026\335,\311\200fF\031\r\031X?\237\375\231\b\226q\302^\231\024\260\316e>\317f5oQ\236`X\333\334d\241\277Cn\036\362\314dH&\353\360\264_p\340\262\223\322"
+	.string	"\265\353\262Q\003\353\346r\357\315SStC/\017\353\254$\213\345\261\177f&\rIN\n\007\372\274\204&G\034\217 X\343\354|N\362\317"
+	.string	"\277\226\226cT\350sXF\362\317\3442ni,\260\376M\024\372|d\005[j\f\301:7\321\242\254zB\nczL\t\320\036E\030\036\221\"\216\310\"[\344p\240\017\253j\034b1h\2035jP\261D\tlZ\242U\211:\306\364H,\236(\252Bu\004\226\004\212\265\347\002\225%\241\376\244\254\261\230\376\350\374\016\364\241\007Y\314\360\013ZC\244X\333\037[\274\031Z \036\213)\326\022:j05\232hU\"\206\003}\b\300\232\266$\\@\256\251\t\fG\022\252qxL\201\0200,\212\240\303\252Fa\n\021&\212\306TD\253\222 \024\246\031\216\305\265e{\324\341\220Qx,\366\254\354P\017"
+	.ascii	"\214\306\241\343\021y\004\266\301\237\t\310#\360'U\215\272U\331"
+	.ascii	" 5\350\227\266Fu\304\252\266j\0202D\n\243\220P\272!\305"
+	.string	"O\261E\2060<\206 \026\177N\244l\217\360'\203j,\376 W\021\3246\035A%\362\034\350C\317P5\232H\217 \260$\324u\250M\325\037\235\003}`\205\032@\350"
+	.ascii	"\211\022\"B\004A\030\241\201\f\004E\214\020$\201\304\016\206"
+	.ascii	"\f\032Z\225]\325\023\352\032\274\300\006-@MHS\330\354\250\304"
+	.ascii	"\226M\177\202\301\326\230^\340\260\203aC\n!\244\b\013\255P\017"
+	.ascii	"QHx\034"
+	.string	"\252@\253\2625\307\037\354c\2036m\360H\024\362\035\211BY=\241\310j\226U\327\3410\005\246\020B\n\365\332\n\345\337\244X[\266HTG\bf\030\252Gb\321\230\002\207*;\244Y\340\3236\035\006\211B\037p\326\024H\250\203BAj\211\021\210B\003h\213G\0228B\325\370\243\216hU\342\205\034\265M[\226\246\265p\240\017\304\342\217\032Tl\217C\004`\211\251\261\00257\033|(1B\270\346\324\370|hSUH\035\241E\206\200\034\336\314p\360\201\315\300\b\341Z\203\202\370\300\2564\254p\004\226U\205\310U(C\016\2125m\323\021\302\365\027\244\266l\n\0220\250A\035v\250M[\022\214CBc*\3140<\246AAH\021\302u\246\310\"E\020\nq$\241\256\251\206\2405\004\262\204\005\027\206X\221\025`K\020\026[\022\210\307\"\313\001\266\b\200\013\213\253zT\211\350\027\340\201\002<\370"
+	.string	"\005\360\0378`\003\007l\360\373\007\016\360\361q\200\007>\350=\360\311m[\002\233\226\370\021\322\250AUHUM\330\264jpH\002\005\322\004\260\rr"
+	.ascii	"b\310\204t\315?\3520\330f8\320\207U5\252Ba\332\303\256H\366\250"
+	.ascii	"\262\005\020\362\261A6\250\270\226\020ax\fa\301hD\256\232U\207"
+	.ascii	"\214\351\211\037\361X\fZS\234\2405\r\266\354Z\374\t\036\221A"
+	.ascii	"c*\f\"\327\024D\f)R\243:\f\006\255)[\034\356\034\350\003\212"
+	.ascii	"\265\207(d\001\305J#\224\006\tW\337\252\016\213'\220\253\320"
+	.ascii	"PE\261\032\323\342\252\262;(T\243\320\320\210\037c\nD\243\016"
+	.ascii	"\213\353\252\236@\006\217E\016m\020HLK \213A\342\220Q\210g\247"
+	.ascii	"UYu\035\036\213&\202m\312\006\203\206\326\266\004U\210\025\200"
+	.ascii	"\215jL\2054\355\252\2368\026\205\353\260\030\344;\026\203\320"
+	.ascii	"\022\204*\220\020E\032\204\346\260\"\214"
+	.string	"\351\211#\262\330\246F\244\320\252\266G\022\3025\003\253\252+Q\035\241\032\211\307\020A\251\210\023B?\026\f\215H V]\201J\250\2550\204:Df`-\246<\307\242Pe\207\202(\326\032\243z<\246@\302 \212\2414\210\"\r\312aW\344\272\252A5(]\177\202\302\225\305\360kU\366\347\007\031,\262\354Z\263\243\341\347\007\331\016\t\007\300\026Q\244A\342\220\tu\330\016\t\035\213\031T\241\024mP=Ql\323\023\305U\035nX\221\2550\375\t\"\333\2414H<\026\201Z$2\210\r\nW\036\340\2016\034)\244\256=-\022\271\366\324\260Ab\361\347\210\0241\002D\013D,\032\177tL@\032qr\206 \214\351\332\016\251\307\031\325\330\266\310\025\250\r\016A\f\217\251\211a\252\016-\230\2004\326\264A\017|P b\021(8\004\321\026\203\212F\2336\370A{,\016\001\357\343#\202\003\007B\260"
+	.ascii	"*\374\300\032\221k{D\n\203\302\265G\370\323s,\246A=\302\225\355"
+	.ascii	"\371 \200!\bu\210\f\n\016U a[4\201\3151\"\221\024\b\372rh'\316"
+	.ascii	"\331\016\0357p\350(8p`{:n\3345'\025zd\330J\177\345\261]aa\203"
+	.ascii	"\315\247F\226\314Q5GU\207w8u\241Q\303\013\320\r\205\346\017&"
+	.ascii	"\236\r\017\"c\230hh=%\\[\304\260\236RR\340\016\311j\006\024M"
+	.ascii	"\231\036oyR\231k\f*G\225\f\337\212$SE\274\340\250\033F[\371("
+	.ascii	"\363\302\332\347\344{\272\017\352>(\354\203\312{{\277\"sK~1p"
+	.ascii	"\231._[yX7\277l\\\270\300b\302\330\272\261#\"f\307\013\335\225"
+	.ascii	"S\307\264Bj\302z\300\346\020'\026\023\031M\017:\036UK\031\353"
+	.ascii	"7$\204X\250cb\264\231P8$)\306\230\251\231\022i\2324\006\363\024"
+	.ascii	"@@hX*\232\212\244\317\007\023@\322\251\024z\022\006\231R\312"
+	.ascii	"\220\214\210$I*\225e7)\342\246\021?7L\263p\211\205\327\262rH"
+	.ascii	"\234\017\333+\321\341{\356\343\211q\217\202M\002\324x\232\260"
+	.ascii	"FG\304\332\016(\006P\321e\354\244\313\302|A\024\222\t\255\301"
+	.ascii	"Z\373a\226\252\n2\375\320\254\325&\027\031\006\320\262\241c\325"
+	.ascii	"d\274\305\222\211\343\367w\317\034\211R@;\223\nY\201\003X3\244"
+	.ascii	"\2105E\033I\206\026/.o\331 k\253\" y_t7\031\332\177\260\213\304"
+	.ascii	"\252$\226\270\273O\263\221Y\275\3038r\310\260\bs\325;\202\375"
+	.ascii	"\207\310\027e\2631\234#9\303.\312\b\231\350\037\"1\032\203\302"
+	.ascii	"Z\266\203\277:\213\362\310E\262\213aM>\307*\fj\247k\275)\353"
+	.ascii	"\2023&\2669 2J\001\331U-\260f\243S\216\016Q\206m\314\356R\256"
+	.ascii	"\366o\220\362F\273\373;wE\020\r\026\370\272\337\366\3614\232"
+	.ascii	"d/\001\256\234\367Jo\374.\0327ep\224\306\366\231O"
+	.string	"/<\030\233\031\t\021\250\220\236\226\315\310\267\325\361\240k\326\264\272\301\344b\303\21778\303\262j\330\253_\r\003\026\033\376\350}\007\376\276\024\234q\360\271y)\376\326\026\0337y\nO\312?\002O\025\032(sc\357D\031D\367\032\224\361\2404\206\\\216\0028\250\r\036\303\370\004Y@y\350\016\024\307RnJ\270\237s  \200\205\227~\227p\2079\022\307\220\177\034\235&\023\264\240%\351h\027\327\025\305\204\377\031\224$\333\246\024ls\2523`OI\220\2558\214]\256l\024\036\260d<\316\017\027\265\335\334\367\003[h\264\231\261>O&\276j\360\2066\317\027\320V\273\210K\263\206\224j\257p\305j\001\033\346r\242\034\213%\205\225\227\2036\334\244\025\236G.N\"<\023\376\b\243I\2028K\341,\213\3371\343\214\3449\033\2703z\305o\325\216\005\034z1\257Z\r\202uZ\320\366\007\367m\321s"
+	.string	"\250u\353N\373\t^\352`\333\212\032\237\200\025,\007y&\300_\243\017z\301\276K\026\305\241)~\265\030X\350M\326o\355\270\365\310\376\344k\327\315\336\356\002\223\340(\024\247\211\271\2626\356n\333\027`/\022\251\271\241f\313\272\342\255.^E\374\200\215lZ>\007[[,\005e\023xc\335\236\305\031S\002\335b\320\252\243y\347:\351\241+\237\277\271W\353{S6\355~xg\221\271\306\274U\326\2760Y\b\035\034\361\032\376\355\376W\376-\310\025\367p\342\244_U\fa-bl\3430\035@\006!\267.V\353\256\304}\335\365\020.\bv\344sT\331\203\025\032\003D\036\347\276%\362i\013G3\252tp"
+	.ascii	"\031\236\314H\256\200\357B\312?\020CP\"Cf\372\n8\223\241\217"
+	.ascii	"\223\351I\005+\321T\305\227p\371: 1\004\254\013(z\313V\004p\267"
+	.ascii	"{m\213:rg:\321;\221w\030&\305\226\305H\005\266\205\310B\342\024"
+	.ascii	"\230[\321\363X\004\357\336\236<\216\201\026\313d,\023\212\216"
+	.ascii	"Q\t\036o\214\001\030\340\264\006\004j\245Q\\\006I\335\022\002"
+	.ascii	"\305Y\t_\301\357\303\272\025\f1F\341\301`\370\246\370\305l\201"
+	.ascii	"]\241\372"
+	.string	"6?\367D\266\375^'o_\017\345\217\214\344\212YU+bgc\207\347z\241\213\365\3777[\332B\366rd\373\224\317\237i\202\036z\364\205]\254\023\242\214.\224o/d\237\034N\225\026O$"
+	.string	"+\252\243\246e\237%\244W\216\316\361\"\370+\302\336\002\200\005g\260\020\256\023\345\342g\256\276\332{\034\325\020\n\n\300\376[_fa\267p=\021d\034\232>\256\214+\0202\270#N:\340\362J\347\337\313h\252\277\365\003N\253X\370\257\260\201h\342\003\032p\215\331\271%\022*\363\300dH\361\231\256J\352\317\204\352\007Eh\365\245$\036sag\0301W\325t\214P\301p\242\326y:Z\251\371\177<"
+	.string	"PV\001/\221"
+	.string	"\326\357\323\333"
+	.string	"\324\343Q\206\216\345\3106\204I\035\313\304)\271\003\013F@?Y\251\317/<\265\272m\305\004\\\245)\017\226\234\004\300p\371\343`\031q#}\357\004\tG"
+	.string	"\211\230V\237(\334\214k0\002G\034\355\2544>\230\232\230h\351[6\324{"
+	.string	"\222\255\246\262L\347\264\"a\253\334\2008\255\352\212\257D\003\236X\256I\275\300\244\203G\332I\271?\bU\256\300\271\377\350\trr#\240#\261\313\373O~P\222\326a\362_\244\352\256l2\037\213\371KI\022`X\034D{\226+\212m\237\201aYgs\340\312\275\271\273\377Y\366\336\"6q\\Y\3015\2377,\016\253\320'\006\361`\261\277\373\230JH\022\300b\215\373\233\353\216N8f\370\201Z\301q\206\255(\020\226-\315\3350\222\346\002V\247\350\313\305\206B"
+	.ascii	"\315%r\330IU\243\346\b\203\3341 \re>\034RC`\210.\003T\017g\366"
+	.ascii	"\275\271R\006B;\352\023c\320\204q\007\315F6\216L\021\233\314"
+	.ascii	"\023\356\2302 \f\300\031\231Ld\370\273\035\212\023e\237\226\332"
+	.ascii	"6\373~\375\246\216\216}h|S\251\205x\241?\273\313\235\333[\300"
+	.string	"\356\215\376\350\313\312\330\030*H\367\215\263X4\004\276 A1\035\321:\322\3466\250u\214x\246\342\b\307\200?\341\303g\013\357Ydc-C;DY3|0\bk\211!\004#R\246\314d\250\2405\326\342<\223Z\362eX\244(\342\002\034\323\311\301\325b\247\263xO\270$\201f9\020P\364\034\240Kb\177\002K6\007\376$r\263\204\342\322\261=?\324\023i\f\3141\201\3121\343\274\222\007\241\024L1ya\236I\017L0'\262\372\245\301\245\034\245\006\"\343`\024\323~\271(\200\231\322b\006\350\331s\327c9>@\312\350\253\301\f\353c\327iI\346_\322\304\317f\341\036\017}\035{\3429id\315\013L{NI\372\263\026\201\0314\301\365\276N\0213\013\361t\033\177\217N\256\245\306#N\376h.\032{\026\013e%USO\225S\030\251#\335n#\023%k\232\022\261\373\301\362\211\356\361"
+	.string	"_\356g\2248\3629`vW!\220\017\204\002\331\017\353\001\201\210\334\235\232N\206\357\024\313\272\337t\261K\362\373\025\331\300\034=1K\225i\304+\207\332\303Gf\2643\331\0205*a_YT\377\037T\374\243;\352\3532\336\261:&/\256,\251}"
+	.string	"\356\302\274B\262\003J\277\326\272C\356W\315\376\336`\264'\235\242\271\373\306=k\311\337*\027\035\3044=G\271w\023S-\324\025\267Q_\235\201e\326k\353\334\215bS(_\201yFb\215\007\013ffa#\242`\312\022\343\313\344\221\275U\341DG`\006z\264c3\245V\236Jm!%\006j\212\225\340\372N.X\365\247\013\231\355\266\242S~u#s,\020D\230\371\377\213A\255mu\244\250\326)\221\0378\"\n\352\225\212D\262\336\201\257\241\302\304\373m"
+	.ascii	"\263r8\245_hC;l\311Vs\204\327\033k\004\345\345%h\365\306\003"
+	.ascii	"\351\\\344\020\r\2014\342\370\316\302r\347\357\312BF\353\343"
+	.ascii	"\200sP\315\300\235\375z\237\376\007(\300VW!\317\341\r\320\341"
+	.ascii	"r\026\241\345\256(\0258\005\321D\351k\201\016\\g1u\217T=\243"
+	.ascii	"^\360\375\252uA\364\322\232\216\3174\003\005\320c\033\027]\211"
+	.ascii	"\272#z\377k!\r\241\034]\331)\026\335\036\326'+\254r{\236\305"
+	.ascii	"\365\n<\202\332\033c\263\227\005\233\276o\266\376\342s\313\303"
+	.ascii	"^\345M\203\277\352/8y\351\303\316\256#\276\333\207g\200\264F"
+	.ascii	"\363\304=\373&\2167\030w\375\254}\230\341\322\353i|\313\344\245"
+	.ascii	"\213YK\345\267\204\235\340\2635\334y\276Xx7G\373\3168\252\322"
+	.ascii	"I|Wr\356,\334\277\032\336T\320]_'\3416K\375\335\374\215\354\250"
+	.ascii	"\203i\364+\317-\215\003\313\243:\230\217n\233m\375\343l\213\361"
+	.ascii	"\342l\023\340\022\3715\303\207%\003;\006\325\t\351?\373\203\345"
+	.ascii	"n\327\315d#~l\310H\256>7'?0\336V/+\316\177\032.\317/\335V,ZC"
+	.ascii	"\236G\332\034\354\270e?8`W"
+	.text
+	.section	.gnu.lto_.symtab.37170b2b81fd7cf5,"e",@progbits
+	.string	"isUsingSticksForArming"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"areSticksInApModePosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"getRcStickDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"pgResetTemplate_flight3DConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"flight3DConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"flight3DConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"pgResetTemplate_armingConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"armingConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"armingConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"pgResetTemplate_rcControlsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"rcControlsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"rcControlsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"applyAccelerometerTrimsDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"resetTryingToArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"isTryingToArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.37170b2b81fd7cf5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
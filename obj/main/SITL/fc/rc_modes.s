@@ -0,0 +1,984 @@
+	.file	"rc_modes.c"
+	.section	.gnu.lto_.profile.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\375\007"
+	.string	"D\013\217\001"
+	.string	"\030"
+	.string	"\326\363\316\r\002\002"
+	.string	"\002\001\001\276\264\256\247\t"
+	.string	"\002\240\342\234\212\n\003\365\203\345\270\t\004\002\003\002\003\004\350\300\306\254\005\002\002\004\002\004\005\006\226\336\200\374\002\006\002\005\007\002\b\b\203\200\211\346\n\f\t\t\234\315\220\335\004\f\002\005\002\001\n\013\203\357\265\324\b\006\f\213\303\313\227\016$\002\005\002\n\002\001\006\007\002\b\002\013\002\013\004\002\004\002\r\016\017\352\263\360\321\b\020\021\022\246\213\347\204\013\b\023\240\377\330\335\001\004\024\262\270\337\265\r\b\002\f\002\f\r\025\230\311\247\340\005"
+	.string	"\026\206\375\263\365\n\024\016\002\016\027\272\251\207\240\r\030\240\342\234\212\n"
+	.ascii	"\" \200\202bU7\300\200\214\205KP\0240\001 t\265\317%\\\217%F"
+	.ascii	"\223\001j\031\357\236\315\262\334\272\313`\222P\314\0030>\326"
+	.ascii	"|\225\375\022\002\232L\303=C\"d\270/\307\316\263\203\363\205"
+	.ascii	"\206;\206\244\202@\212\342\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"}\005"
+	.string	"2H\025\031\200\265I\007\253\2660A\0234A\023"
+	.ascii	"\217\217\037\t\361\275\2215\273\267L)\256n\"\001\230h\210\375"
+	.ascii	"`\240\302\233\030\272\240\300\272\265\224YB\214\211\362\334\313"
+	.ascii	"+-C\306\316\377\026#l\006Y\033\346l\244\235=MG\217h)\357\303"
+	.ascii	"\343Q\347\322\r\366\024x@' p\002!+>\321\b\314\013Z&R\\\246O;"
+	.ascii	"\257\271\225\201\001f\200b'\001\001\216\201 [b\037\303\b\272"
+	.ascii	"\021\315\307\206W\022\006\\\024]\030+-\215\224\246H\210\224\336"
+	.ascii	"\002\243\313\206\223a\243\361R\333\307\206\327\330\360GX\374"
+	.ascii	"O\004\322\274<Z\007\001\027\300\r"
+	.text
+	.section	.gnu.lto_.inline.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`\302\003\325\021"
+	.string	"\006XWD"
+	.string	"\223\223\306\200\263z\255\020\360E\"T,\346\226}\246\234\252\023\r\203c\214\346\330w7Pn\227\317\2774G\250\034\261_P\210\302\027\251BTUU\325\362\007=ml\237\362O\202\320\377\266\021![\312\235\0026"
+	.string	"B"
+	.string	"O"
+	.string	"\333u\237\216\317\226\246\242]\024\365\241I\365.\022\177\035\036\332\016m\372{\366\343\332"
+	.string	"\256\253H\347\234\323\372\tsN\n\037\177\037Q8\034\236l\315\234\363\343\257\243\211+l\234p\031\371\3703\205\233\002f\032a\177\270\300\312T\302\306\341\003=\205 \201\301\300\022[S\017'\365!\356Y\256i\367\335\274\250V\271\306\265\365pR \252\375n<\036\227\374I\024\276\004\240\020\006p\2647<\234L#\322\256\304`a9\207"
+	.string	"\317rr\304\312\214\222\245\322};@\207\204\350U\311\255\320b\303\242\363'\273!&e\346\200U\262\342\240Q\201\"\301\235(#\203\225\321@\223\322K\326\026%\323B\206\034\303`\274\224f:o\242\001/\215\224\226\016\001\204\315P\342\\\b`\240_\007z\232s\202\034\340\030\353I*B\345eS@\322\0225\\\324\f\370s\301z\224\265\361P0 \224\355\341\241`\2563\013\312\301\224\303\025\030i\007S\016\367\231dU$\036\332\340U\035e\250\301\2552BB\001\211Q\n\031\306`\2422U\347\001\0210)CJ!)\0311(H\251\003\367\203'J\r\347F\277\312\270\340\267\201-\257\324\352\250}\275\3518\233\323\243\201C]\006\017\017%\n\273\371g\236\226\331:w`\300\244Q\253\203"
+	.ascii	"p\302\257\352\202k\203hwl\240\244pxw\023\335\220\r\312\203p\206"
+	.ascii	"\336\347\2634\005\301r\372\210\273\204@\2324\214L\350\020h\264"
+	.ascii	"\"\323\206\t\306\255\376\205/\025\021\003\361;\272p\202\203\217"
+	.ascii	"V3\241\256\025\253\202_\341q\366\274\3058\023\320\202\277~ \r"
+	.ascii	"~7\232Lt![]\202b%M\"\261\017\303\257\205\0321wP\352\221j\366"
+	.ascii	"\306:\002\260%U\030\177\030\347\222\375I\271S\004%Ow\364e\n\342"
+	.ascii	"i>g\265\271N"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`\031\005]\013"
+	.string	"\302M&&\220'I\007\177}\362]@\257\266\273\273\245s"
+	.string	"\244\360_\313w\347\252p8e-aG7\"lDn\261\267L;f6\256d\245\204\024\257\373\007|\023I\202\220\2038U\367\207\027f\334\264X\\\220E\211\f\332'd\314\306\220M\246\212\242l\220\255\235\363A\326\004\362\332k\017\2637\n\237\260\2427\343?\200\216+\254BDT]\357z\r\377h\262v\250B\276i\206W\273?\205\352F~#\273!$zxz\177C\226eYV\305e\343\332^!^\217\257\021X\016\004Z\250\241Y1!IA\251\320\034\220\"\241\243\262\003\022"
+	.string	"\002\"\212\342I\022)B\024Q\204\002\tHB\021\241$)H\2061\300X\207\247-\357\277\332\023s"
+	.string	"\356]~\211jB\004*\257\334^P\242`m\314\263\312[^jAm\250\267\201_\335\355#\225\321\212\325qU\200\245?\305\001#\217L\022,\006.w\037\t\024\231\252-\326N6\n-\252\224\223DHR\232\215\334a^\376\325<\"\326\351\256\256o\230\236M\250\021\373\336!#\020\253\226\3556\355QTB\351\250\313H\265\377\025\275\215\"\276Z\006\313e\325\007\244\\ZR\222u\302\b\226\252Lh\001\017\247\3361\001\365\002\202\001"
+	.string	"\"%r\244\2623E\001\023L\320\300\374"
+	.ascii	"\230\273Q"
+	.text
+	.section	.gnu.lto_.pureconst.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\231\004\001\230\004\003\231\004\004\204\004\006\205\004\b\231"
+	.ascii	"\004\t\231\004\013\231\004\f\231\004\022\205\004\023\205\004"
+	.ascii	"\024\232\004\025\204\004\026\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"\r\007"
+	.string	"\022\311\037*\220\265\031\016\340\257\007\337\035'\243XUu\304\335a\273]\007\302e\343\311\331\266\r\375\366\257\276\265q'e\343\267\233,\2212\005S\025UY\222fJ\300\002X&\226I\345R\247k#`\00138P\270\n2\306\204\214 \327<.\230\001^\t\327L \026\336\3324\225H9\274H\273c\020\032\244\374\321\247=IG\373/\257ye\036*\r\357\367\224T\236\246\347\\Q\356\312\250;;O\202* @\002e\n\311\007S\310\225\345n\334\020\r\n\006\360bHm\314H\253\235Ij\030WP9\030wwa\365\213\316\033\330[\347e\315\334\235\324\260RS\016\021iq\277\323\260\274\245a\301\340\350\n\346\003k\236\257\"t\030\340\211!\216=\204\262\306,\200\235q\020\220\021kt\225h\363"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.f93c3a1c1f15efa4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_modeActivationConditions_Registry.44.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375 \207\365\003"
+	.string	"\004\007T"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\267\317\017yw\250\357\006yu"
+	.string	"\005\001\006'\001\300\002\251\300"
+	.string	"0sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/rc_modes.c"
+	.string	"\004"
+	.ascii	"]\305\240r\3773\211\033@\021"
+	.text
+	.section	.gnu.lto_IS_RC_MODE_ACTIVE.45.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"e\b"
+	.string	"\266\020=80q\323\001\200B\207\220\274\260\270\022N\273\257\365p:U\227\006Lo&\370o\224\020\267\021\030\312\347h\246~)0\3504\264f\377\307\301\307\243\316x\215\331\336d\313\224\002,"
+	.string	"-"
+	.string	")"
+	.string	"\266\275\300\320\331+@\305\233\034\017\027\234\335p\306\222{W\317\377\352\b05`\352\273z\034v\327\n\246@\356x\333\t\266E\266c\002W\031\360B@\263\373\261\243\2636r\006\305vg\203l\253\332O\271Jw\025\207\001vEV2\273\241\310\n\237\313\320\007\256K\353\002\327e&\273\247\203\376\312Y.\374\223Ko\234\036\274\364\271\353\322\316\330\320\203V\f\241\342g\207\237F\022\373\326\356\256\343\210\255\253\036\244\007\215LB\032\033m%Rf\202\300\264\211M\314\n\212\b\323\304\264m\216\f\234Y\224\264\211\221e\332\004\205{[\261!\344\024;\374Q\215\017\337\302\035\004\007"
+	.ascii	"2\003\302\260\241\0137r\031\025\322\030M\034\"v\256\371\004"
+	.text
+	.section	.gnu.lto_rcModeUpdate.46.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\325\007"
+	.string	"b\31777@o\323\001\233NL\r\024\007o\032\264\2261\337\250\n\305{\210;\317 \302o\032\206\363hxPL\240Y/!\230\017a=\352\262\373\345\312\036\375\017\311\322&{\247\024\227\326\321 ,\256\217\345\312\001]\022\230'\242f\264N\320\017E\307Ck\006\242\234\003c\025WF5\f\313\350\346\333S+=?|\234F2\303>x\021B()\371\340UB~\311\030[|\367\351o\325\247\026\302\302!2\212\241\375\211\242\034\261O\355\356Zz\366M\177\244\032@\n\302\335\216PfO\363\305dc\373\321\376\311Q\270\233\266\013\354z-.\273\337\202\025\254O\177'\250>\255\017T\237\346l\030\003\215\200\231\215\225\230\335\245\222\344\334#\347?\345"
+	.string	"\035I\364\250q\330]\307\216\344q\313\333N\260\315`\033\f\t"
+	.ascii	"2C\363\f\f\217J\226\t\204`\310%\330f5%\334\341E;\311"
+	.text
+	.section	.gnu.lto_airmodeIsEnabled.47.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375 \344]\006"
+	.string	"\342K,3Pm\222\016$\243\212\253IsK\335\255\243@v\013%\262\372\317\320\305\262\265\273\035\236\336y\267@\374Z\231\231A4]\274\314\017d\247\016\215\321\332\3362\005S\226\314\245\241\302,PV\243\034\032\304\003\003\246QV\246Y\006\256\".V\223\250*\253U\262,\212\016\t:H\361\005i\310u9\236\320\\\261NW\003\320\351P \324\271\321g\234\303\214\257\224(\372\357\303\002\213\226\230d~F)I2\215t\374\233\257\214\220\260\371j\266\361)\206\247B\004%3k\250\321\253w\335~T\362\b\235` N/@!3?\ft\321\261\277\301\177\360{\002\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_isRangeActive.48.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`\241\002\225\025"
+	.string	"V\351\216J\300\322Q:s\020\360\335+\t\205\003\200\366\016\036\221\003Pu\213\300\0220\242\214\203\375\021<\353!J\210\f\332\207\243\205\340\254\204\222\206ey\212\221EQ\024\"3\351dlp\022f\223~\346\377\223\330\256T\2254BH\2222\005}"
+	.string	"m"
+	.string	"{"
+	.ascii	"\032\303F\2033\002\\S'\354\261\004\365E\352X\352\t\251\243\277"
+	.ascii	"\372S\343\317\371{Q4gp\201\017\224:\332v\203\025\033\3374\330"
+	.ascii	"\223\243;9\274\031Qs\006aG\2417U\221\243\370\275Y?\250J\203t"
+	.ascii	"|\322q\352\371H(9B\307\335\212,\037\b\221\300\234s\345\323\355"
+	.ascii	"E\004?$\021,_N|-\355\364\320 \335\033\037oW\3252\347\364\366"
+	.ascii	"|!\324\245\332\266\261\375\300^\035\001Jco\240\3111*\243V\316"
+	.ascii	"\251s`\025N\330P\252\320\321:C\352\250O\201\243\364\203\001\204"
+	.ascii	"\333\241\035\314\355\201"
+	.string	"\266\212\363<~y\215\242?\252'\032T\005\360\265\313\353\326\327\254\257M\276.\371z\3655\311\327#_\227_\253\276&\311\365\370\265\370\365\307\365\216k\rP\300\004\217(\005\307\2349C\"Si4Za{e[\\[\201\002\332#\005\244H<\320\257\223\\\203t\365C\210\264\372\353\336^\220\334\310I\376\243\335/\245\374\310I\037;\037}y\037\035'\225N\365\325\311'W\013\362\252{wB\306\223\027w\360\246p;\364\2407d\345\234\223\305ZCm\314\374\002\263\332\203!u\034\277\322d\204\333\241E\365\021\371\213\327\335/\267C\237\374g\0204\224\343!4\2659\206,\235\370\201\336\353+\b\223t+e\033C\263\027Z\3146\322\314\\h\0222\314h\264\330\005\b4\035b-\313Tdf.\265\030\n2\033Lf\001F\203\211\305\300d6\031\230J\212k\032f6\030\207Z\315\006[\005q*\316\363x"
+	.string	"S\t\036\021\211\022\201IG\210h\2557\262\345\326\335\202{Nu\240wL\240+*P\327ol\327Q\256<\222<P,\342\242'j<\017\35358P\302$%R\223\263tHKnr\362h\347\263/\271\262\320\201\342i0 @\002B\220\223v\265\241\245\025\350\225\360\306\300\027\3576\366\326H\021\256iL\363h\213g\371Gq\216\353E\234\001\302k\t\276x\f\026I\023\006\306\311\214\350cG\244\301\223(e`\347\340\315\341u\306r\3504\f\332\342V\212)"
+	.ascii	"\204)\213\316\nYx^-|s\270RcF\017\202qF\026\037a9*\266w\003\312"
+	.ascii	"i]\232d\341*\264\353\265|\017"
+	.text
+	.section	.gnu.lto_updateMasksForMac.49.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`.\003\355\025"
+	.string	"f'\215J\300RN:R*o\345\205\213\370\343\200\341OT\330\320\3241Dn\257\230\374\231\2731(P"
+	.string	"qZ\302RUm\275?\376\314X\277~\375\336\311m\033.\265m\004\254\311\nn\245\377\022\340\373\237\261/J\313\226\020B\210\334)\005y"
+	.string	"o"
+	.string	"x"
+	.string	"\037\031/Zg_\375,\252\007&\3518e\325ZgKt\335]%9\212\341R\235O\2628\335\3453ww\035\347\367\022\311\312\007\210\222& ~~\037\255|~/\263\003\025C\330\226\216\r\021S'L\351e\005\275\314\036\r\377t\023$\237_x\240\326*b\362\350\206$=%|\"fN\210"
+	.string	"k\352\307\235N=\230<JI\226Z\253\251\317\374\271\001\334\366\b\333\020\354U\tA\357\220\375\246\177\344L\177\354\347\037\362\245\037&R\273D\352R\244&G\352q\251C\221z\227\232\212\324\027\260\"\225\345\243@\217Z{\202@j\225\330\342\310\366\355?\331\257\277l\207\324^\320@\367&\233\237\006\204\316\244\030\016\230\242\030\320\223\303\200"
+	.string	"\225\007\fJpj?\351J\272/\335\\V\353\220\226T\255\247\002\237\224\027}\236d\274X\0067\264\214\0054\0014\216\354\t\217\021}\021d\006\222x\3338n\t\017\221]\273\224m\334?\235\036\355"
+	.ascii	"\021R\362\0321A\301\b\037\365p\351\325n,\334\247`\261{(\035\177"
+	.ascii	"\321\026\226\324\332f\244\353\002\334\301\243[\206\321o\310\332"
+	.ascii	"12\364>\272)\037z\273\263}\373\n\\Y+O\305W\001\223\241$q3^\374"
+	.ascii	"J\330\311\022RZ\302\241A\373\334\321\ra\177\203\301`6\r15\265"
+	.ascii	"\007.\033l3\244\f\rm\302\313\f\215\254\321n\353\032\n\215\355"
+	.ascii	"\005wk\251\345f5\230\331L\f\3556\253\345hf(\004\214\303`\313"
+	.ascii	"\315jp\270\334\354u\326\207u\207\034\001E\025\316\346\204\265"
+	.ascii	"\326\352\"\241\261\205\255]\301\302\235\316\322\333]\tT\016\215"
+	.ascii	"\262\206\214\2726dE\206k]S9\264l* \017\021\244\214\226\033[\373"
+	.ascii	"\002U\271/\023\307\t\031%[h\364>Sp\201#\367e\006> \300\002\021"
+	.ascii	"!\254\0076*pV\350\006\211\001s\024\257\364lD\3532\357\013j\311"
+	.ascii	"\254\360\243\210\305M\310\022\327Qz\276\316\335\325\310\022\262"
+	.ascii	"\033\025l\306B\r\227\372b)*W\177\265\200(\313\t\3770\224/\367"
+	.ascii	"\306\264P\336\222\221E\250\342b\244\nf@\260!\342e\0017\f\226"
+	.ascii	"\213\202\r\315\211\035\036oo\311bqN`\226\210\021\0010J\351\021"
+	.ascii	"r6\026\306\313\020C\002AV\203\217b|\306\n\257\203\267\324\f"
+	.text
+	.section	.gnu.lto_updateMasksForStickyModes.50.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`\324\001E\020"
+	.string	"\266\236lF"
+	.string	"\223\223\016X\332\245\216\362J\235R\255\357\236t\360\364\241\246A\373\317\223\351\233\005b3I\201faw\353\355Y\022\b\3154\306"
+	.string	"^K\342\233TZ!\260\277h'D\023BY\3356Yvl B\310&R\246\024W"
+	.string	"Q"
+	.string	"^"
+	.string	"\254\227\b\2349C\006N\260]:<Iv\271}@vi\224\315\343\341\313\374\013G\210\032!sNnQ\034u\211\255\242\374\277.\362\201\251\313\255\345\030"
+	.ascii	"\260\345\213)\020s\202\214\200,\214\244\225\342\373\353:\002"
+	.ascii	"\\\251j\024\346\234\326\017$qg\267m\3016\004[#\004\243\035\256"
+	.ascii	"t]\354\3578\216\243\327e\237\346\337\036\376\232Tg\237\371%\246"
+	.ascii	"^L\255\230\372#\023D!=\020\334\314\331\032\207\314\034\222F\214"
+	.ascii	"\355\3735\267Q\271\013/\370\303si\253\330\236\313{l\232\033\016"
+	.ascii	"4<\301,\270\332gq\031\324gV\n|f\372\317\rL\344\350\212\200@V"
+	.ascii	"\374eG\304\331u\361?d\331\376u\001\341\316\t\037:v\260t\307\001"
+	.ascii	"\364\373\233\3178\035x\231S\365\317\217q\031\034\214r\322\177"
+	.ascii	"\247\314&$\322\177\331\336\346\025Z*tD\226M\331&\035\206\207"
+	.ascii	"mN\326\003\377E\212i\203Y\311.\277\022Z\256\02223*\r!Sg\002\002"
+	.ascii	"4\322B\246\316\344d\324i^'Z{%&\320\tI\244\301+q\336\006n\204"
+	.ascii	"\322\2118\257d\342J\f\230\324\001T\342RH\244\022\347\tU\307\346"
+	.ascii	"\272\260\026\242\216\250\332\0256\347\234\222\200n\253\255\\"
+	.ascii	"\373\002\206lSj\203\245\025\203}tw[;C\215\325\371\250\256\266"
+	.ascii	"v\347\005% \260\202\031\301\335#\241Y\n\334\373\270\255\230\222"
+	.ascii	"\264\031\303+\200\333\273\273\222\351C@zW\342*\226J\004\213\017"
+	.ascii	"\257|\356\227\2675\302\222\r\255H\244\025\022\2171\300\214\204"
+	.ascii	",\315\265\031\017\314\034\031\356\205/\303\210\200\2112\346\362"
+	.ascii	"\332d\033s\215\226A\001"
+	.text
+	.section	.gnu.lto_updateActivatedModes.51.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`\343\f\305A"
+	.ascii	"\352q\310\030@P\246\326\030#h\253\376\267\334\341\307R\271-7"
+	.ascii	"\301R\234\3247\305\031\327\253\037oJ\206\031I\203D\365\326\276"
+	.ascii	"\263C/\375DDDW\377\363+<$6\340\007\370L\251\037\260\226\262I"
+	.ascii	")SJ)\177\001c\001\200\001\3178\334s\330\212\201\333r\264\210"
+	.ascii	"F\350\373\005\341\n\364\231\367\276\320\r-\234\326\b\326\272"
+	.ascii	"\231\3212\235\3537;\232\216#,\313\230\3178\346\340\0165-\327"
+	.ascii	"\243\343\030\351\310\246\341\230\273\f\367\033\007\3274\033\267"
+	.ascii	"\3330\035q\013\372\206I8\203{fh{%\252\335\304\3668\323h|t\031"
+	.ascii	"\016Q'\317\007s\233\3516\346 \003\3512\f$\211\031\363\331+3\020"
+	.ascii	"\346`\257k\223\351\265\216r\220\315\212\004h\020\"\360}\315\306"
+	.ascii	"\300-h{\355g\247\271\255\026\2445\202\001\221pyM\337\027,\252"
+	.ascii	"WF\320\366\312\320vb{m\273\211\355\325e\016\324P\347\333f\210"
+	.ascii	"$\315\344\275\357K\365U\222x\330*\264\031\351\335nbZRJ\022\016"
+	.ascii	"\221\216\202F\300\366\307\256\352\273\313\375\303\212\266\213"
+	.ascii	"\351A\342\245\t3v\323\225f\272\242\022\227\356\200\235u\324\212"
+	.ascii	"+9\3410=\tJ\013\373\b\245\207\352\217\353KK\337\001\303\242^"
+	.ascii	"\355M\345\372\r\351HT\304\236\364Q\360\207\365\246WDd{\232\264"
+	.ascii	"\221\001)bL\032\310\304[24\260%\376S\241\230vc\302\260\244\352"
+	.ascii	"dg\312\237~\323\006\320\300\2328\253\022\357\2009Q\211\357\373"
+	.ascii	"\006\303\272|\225\"\346\244U\025j\032\207H\030\306\245:}iQ6\\"
+	.ascii	"\273W\330\226\177\2775\324\031\334SO\212\330\223\366\037\326"
+	.ascii	"\373\276\354\3120\261f\247f\356%3\307`\016\316\t\337d-V\375\034"
+	.string	"\321>[\276\307D\377\357\270&Sl-`\360V\252\037\241\214\2135\364\241,\024c\206\266\032\030\352\240:\rJ\024e>\tu!\032l\257\377r\306\f1\323\324\344z\312\341\017\375hA\035\324\272=\200:\220\207\017 @\260\275>}\313\365\2079f\236\027\2744I\372\375Y3I\276\243\367\225h?\"\332\367}\257\270\371t\037\022\334Xze\023'\274\225'\330^\373\033\256\325/\204\330\350\311\035\275\357\335\352\270\302\236\231\274@#`\207{T\254\200\"\345\"\363\244\245\035\3654M\244I\3366\317a\243\272\313\364ZQ\350T2\277\210\341\255\344a\034To\332\365Ff(\322\277\311\334W\316\275)\277\0313\353|\301\310\331\002\353\214\305:Wh\235)\264\316\023Zg\t\255s\204\326\031B\353\374\240u\276j\235\035\264\316\rZg\006A\347\005\255\263\202\237\263U\325\317yJ\252\3454C\0319?\265\316"
+	.string	"\272\256M\363\220unb\235\231Z\347\245\326Y\211uN\002:\013Yg$\240\363Q\353\034\3749\033\265\316\300\326\271m\235\177?g\026\350\274\262\316*\320\371[g\3779\267\006"
+	.ascii	"N\246\223\246\362\361\240\357W\237\242W\272\312mi9\335u\335m"
+	.ascii	"\272\325\272\241\335l\3152\367\235\035\313X\006L\307\215\205"
+	.ascii	"\335&<\347\255\3449\266W\340\007\340\263\344\350}\255\276\357"
+	.ascii	"\373\"I\365\360\253\276\337:J\n\033?\372&\023\300\363$\371fT"
+	.ascii	"!\013\017\231\333\033\333y\215U\345\3557\035\035\0247\n1\371"
+	.ascii	"F\306\372\366\200\334\\\024\317\215/\370Mv`T{+\325\024\336\213"
+	.ascii	"\231\302W\370N\362\035\215\276\251\346\214\022\f\360\315x\302"
+	.ascii	";x E\022E\357|IK\370\t\256\244#\274\204g\351\272\320\254>\302"
+	.ascii	"7\027\262DI\276\243\025\227.\275\366\233\f\341\035\374\007\212"
+	.ascii	"\322\371!\037<\204\177\272.\246\200\253\177\360,\240.\264\251"
+	.ascii	"\277z42A\277\255\006\357\340YDJ^\030|\203g\3572"
+	.string	"\204\364>^\360\f^\275K\362\271K|\314\235\322\262\2139\022\267\351Vq\317\316\330^\027<\003>rj3\035\373{\005_\265\326\006\211\327\306Dr\036\251\021B\277o\376\324\267\210\326\331\362\275+\376\345\206\371p\304H\021\253\177\342\363\206\335,\256t\303@\025\2212\273[\234\210\333\345\275\226e\253\017\361.O\272^\330^\247\276\337\264[)\"e\246\251\261\377\373\277s\277\370\226\033&\305\262\314\221~d\277\347\332\355\226eK\334\270\251\261P\235\305\256\337Z\242w[\276\327\227E5\246\210o\321\372+\2417=5\357R\345\310\242\365\200w\\G\213m\\\257==\263;\306M\023\246I\223v\275\261\223lA4\246\006,\343\005\217\031:\212\026Z\374ft\217\0276~4\264Xxpa\203\305\317\203\017\032\305\031:\264\202\\L\240\365\302\305\215\032+\2129\250\2120\250l\314`Q\203\252\230C\213*\201"
+	.ascii	"\276\201\343E\016*\0357n\344\240\nB\217\375f\354KQ\375\3228L"
+	.ascii	"&\251\006\360^\035\226\322\343#\325\240A\324\367\225R\241\331"
+	.ascii	"\272\247l\336\307M\317\336\346nZB\372\\\243\221\355\325\365("
+	.ascii	"\t\001\370\246o\266\351\233M\205L\223c\272\020`\r-J!<\303v\221"
+	.ascii	"l\273y\2648\300\371\276\307V\262\005i\273\360\335\326Y_\\\364"
+	.ascii	"\246\\Li\366\236K\337\314k\246\377;\321>\023\334\335$\313\354"
+	.ascii	"\022q\275\274\225L\337\321\006\212\211\003\2467\335z#7[\263?"
+	.ascii	"=-\210\221b\021M?E)\203\304S\303\344\312\0358\0238\245n\230\213"
+	.ascii	"\244\243=\242\016No\232T\372&#)\205R\377}\206Q\355\344\364K`"
+	.ascii	"\226<\267\224\344\364R\337pz\352X\207\304k\253r\245o;;\013P\257"
+	.ascii	"\364VW\352\222|I\217\364P\337\200\222I\220\302h\322w\337\226"
+	.ascii	"\254\027\243%\213\360\333\356\214\350G\337v\275\206\364+\224"
+	.ascii	"\370Y\226\214\245\324Y\345\310\367,\245w\336\274c\226\341f>\305"
+	.ascii	"\302\367\235\321\007Gx\024/#Av\302\350{N\037H[>\231i/\374&w_"
+	.ascii	"9"
+	.string	"\367\246\3037\343\240\225\243\252\377>\036\325\303\367z\340c\240\303\376\304\231\001\200\366\250Q$&\225aH!\031\021\221\321$i\fp\002\221\251*\242\007\021`%tlFD\024\244i\016\203H_\330-W\301R p\207\331\360S\210\225\363\264\357\344\021c\361~\347\245\340\023\311\306\311\306;\300X\203+\357\205\325\250\036h\037\261\227\200\252v\2072\310\3622A\340!\275 \266\254\031\256)\353,\251\246\220\367\344m\230mz3Y\364cez\267\255\201\373\2044\200\337fg\3001\004VS\026\002MZ\242\013\3173R\216\r\313w'\335\266\304x\302\244USi\355\332\331\200y\026\302H\3267o\272\231\326T\t\254\230\317{\311\303\243\331,\231s\346\303gk\033\224$;\360#v\315\303\246$\304O\237zs?\232%\237}\251\020n\220\255\364R\252\3153\023X\217\316a\211\315\2613!\340\246\020o\264\310"
+	.string	"G\312\027j\007\216r\345\227~\314h2\031}{\354~0\024.\252\034\334FI,V\231\230U#\321L\022\351\037\f8\f\331_\347\235\205\242\246\304\266i\212\007\312\302\032 \365C\371\241\360&\2458\266X$\025u\376\245\240G\001\340\245|Z\003r9\230\220g\271:\236\202\341z&"
+	.ascii	"_\004\004\205\366\275\332\230\346\224\326A$|\253\223\245\272"
+	.ascii	"(\032^)\260\300\200\002\230\251wGZ\303\246\246\027\242|\204t"
+	.ascii	"\017\251^]\203h\370`2\320\264z\0348a\346\216 b/Q2\306\346ij\326"
+	.ascii	"a(uR\216\375\267\275\226"
+	.string	"-\332:\005\240\363\n6\313\254\2726\214\261\tZ\333\241\330\245\334\221*\335\344\354p\304\275\003h\326\340\343\216,\3245:\277\270\214\007"
+	.ascii	"\260\232Y\240\275\b\"\rr\006\240L\323q\357\211*+\304\017\314"
+	.ascii	"\333t\361fpc\372\020\317\365\231Qg\363\202]$\313\260i>\261\225"
+	.ascii	"\027)LE\303\217^\325.&c\347\356l#\026\331(\373\315\311\"}y\357"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_isModeActivationConditionPresent.52.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`\373\002\025\025"
+	.string	"\246g\212H\3200\2511\300\210u\005h\343\332\375C\256\371?%)\366\017\b\033\215\031\350rk/\300"
+	.string	"!\"\266\274\370\377X+\001\260/\241\213\\X,(>\302\013\3161\213\f\363\270\302\026l=\200r\360\017\260}\356\266\245\2242\245y"
+	.string	"l"
+	.string	"z"
+	.string	"\342m="
+	.ascii	"\361\026A\202\026\323^\352\340\256\023\212\001\032\336[\222\024"
+	.ascii	"\204\003\274\226\367j\322>\256D[\351\244\371.\037+}\031nx\f\232"
+	.ascii	"\233\272\200*\306\351=\333\\\221\260\271\bc+\003\244\032\234"
+	.ascii	"G\356\245N\021A\251\227\240\271\231\265\032\300a\322\340\221"
+	.ascii	"\203\251\0370>@\335\3679\223\273M\372\336"
+	.string	"\347\021\320\006L\221\263\371\\\225\334{=er\031n\326m\357\3306\261\347TTg\227\266I \247\2542\315\2619\316\373Y\236\026\357s\333:]\3554\265\323\263N\277u\0225\224\022\231q/\356F\325}a\217x\356\363\333\367\205\377\270\243\006\034\336{[\366}~\351\367\334\362q\322\350B3\376\200\210\242\356\275!\267&\307\333\333-v\313\366\234\366w7\321r\036\006\263\356\365\320dtoy\300 \343\355\200\177\004'w\001\243A-\222*\275\323\344\300D\343\307R\235)\235t\216\3601=8\213\243\027\325YaD\351\221B\030\345D)\243\355\372\320+f\205TLJ\022\374uOC\275Juf\321\323\231/x\233T\266#<\b\006R\343\204\263\273\367Fr \233\345(&\260xp\273\340\356\336\253\340\304\1771\177\347\3262\013\3632\267\376\212x{z\337\013\324\240\246x\265y\203\002\215x\035h\226"
+	.ascii	"\273\212\003\321\256\221\225\227\212,\206\342\232\221.\b$\005"
+	.ascii	"XJ\214t\315V\310\021\001\226Ux\315H\026\231lF\266\312\332i\216"
+	.ascii	"\353\225\376\2367xj\372\025\255|\232x\337M\236\224~E\366\247"
+	.ascii	"\211\242H]R\2436\033#\325y%\0249(\025\316\220[:\343$\321\322"
+	.ascii	"\363|\302\333\244z\275\367\336\225\310-\345\240\357\275V\355"
+	.ascii	"\324\200\301\261\321\245\245\236\027\3610\261\322\016\031>a4"
+	.ascii	" \220\002\241\232\254\003\346@\316\357\013\265\360\020Af\"w\340"
+	.ascii	"5\266%\tK5\277\242(\337U\326\270\001\354\t7*\007\201\206cf\356"
+	.ascii	"2!L\307\305\330\230c\270\210-CX\263\200&u\r,/\326@\3129\260f"
+	.ascii	"\341!\024\337\024-/\330B\313\"\220\320;Q\367%\241e<\256\025-"
+	.ascii	"\220\2067\233\256\013:\001\026,\200\n\013\301u\220Tf\262\255"
+	.ascii	"~\265\213\f"
+	.text
+	.section	.gnu.lto_isModeActivationConditionLinked.53.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`\030\0025\022"
+	.string	"Fc|I\340\322&\035 \221\007\222\232\352A\372?\024\274)Z\025\353\020j\021{\037\345\375)\363\032\3640\341\301JL/\214\325\316=\307W+\265\311\306x)\2420F\253\201\261\034DM\374F\326U\234\217\003\3126\215\020B\266\224)\005j"
+	.string	"`"
+	.string	"j"
+	.ascii	"\t\024\310\230u\321\304\315e8\030\220\322\234b\270%,\340R\274"
+	.ascii	"=e\375\363:\271\312\362g\376\311\245Q\002!\022\203I\224%\230"
+	.ascii	"\216\333\\\352\245\310y'Q~|N\254\355f\204\212\301T\312\003:4"
+	.ascii	"pDb4r$\307\210\244\217W\233\330K\367\266+\021\220\021\tF,\347"
+	.ascii	"\372\245\3149\25551\0177x\3339\266Ul5\t\377g\265|\355^\251V\251"
+	.ascii	"\376iET\372qb4\347M\023\323\304\321\021\365\274\366\333\267\206"
+	.ascii	"\2630\200V\020\2379'\312\376\350\213\276\315\250\232\213\300"
+	.ascii	"\231\016\340\rh\207\2179g\311;\207\340\273\33326\312\266\252"
+	.ascii	"\375\331\177dN\333\340\323\234\"j\f\315)\"0\t\370\216\300G\274"
+	.ascii	"w\362\001\274w\001k\243F\002\247\373\213\247\253<cN\302\203^"
+	.ascii	"\036\310\210\241k\202\373eGA6\2712\177\373]\215\270\227.\331"
+	.ascii	"v\371\213\027\222\017>:\2639_\013\016dg\270\013\230S\317\315"
+	.ascii	"\f7\233s2h\361\233\312G\361\316\026b\3645\357|\f\336\273\357"
+	.ascii	"\307\033h\tQAki\323\"\r\321B\354\312l\321\245\005h3\222\274;"
+	.ascii	"6xZ\236\340r\026\007\236S'1-,*\230\225\324*LE\b)\270@\200\tS"
+	.ascii	"\253\230\360d\200U\025ZV\341\005\225j\025\242\304\326w\307_\361"
+	.ascii	"\006GCnB\236\317\362>^\345\250\307MH\376,O\312uJk]<\276\225\371"
+	.ascii	"\313u\340nNK\276k\343\"o\367\2641\367\322\245\3139\347\364L\276"
+	.ascii	"\013\356m\227L<78\350\270\264I\003# \200\202)\263sf@N\263\217"
+	.ascii	"\262\205\277\025w\370\032\"IB\362\346;\312\362\205\f\302\330"
+	.ascii	"\372\260\322\341)\313\346\353!$\337\324\226\027l\241m\021PhO"
+	.ascii	"\324\276 \262\214\213k\241\005\322~\263a]\340DT\004+\312\336"
+	.ascii	"\203K\"\371\"\277\256C\006"
+	.text
+	.section	.gnu.lto_removeModeActivationCondition.54.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`\227\005\215#"
+	.string	":A\024\016K\240\326Q:\004\356\r\034\275p\364\020\275\021\006\203\005\032|\250)\024\246\223\231EZ<\333\216\023\027}X-\260\260~\266\3005\230}D\345\213\247F\013\360\002<\205\325\340\303h\332\257\212\240\t\3038\307\377V\362I,![\356$\003\317"
+	.string	"\300"
+	.string	"\320"
+	.string	"R\202\334k\\\300\271\363%\201\313\230/\355c\314\227\f\304l\345\305\247\373\343\227\242\343\330\275W\3271f,\340\266x\2765\320q7[-\245\241\347\314\204)mW \376\216\033\320\021\346\013\006\035g\273\304\230\360I\240\013\353\200\254\b\354\307^\275\035\006\322\360\266\332\205\226\2362!\2658\315\312\034\325\360=\t\024\332\004W\204ly\024\220EE\323 Q=m\363\310\352z\022\270\302:\250\222\222q\254\027\210\002\252\2503\032\216\0247\371Lq\030{\263$\251\352I\340\222\005\3204\345\352Q\300\247Z\312\334\332\004\303%I\267`\t+\363\325D\345X\257\277\340P\355\037_\3060\022cB\032\276\316\036\334{\271\372\202Hg"
+	.ascii	"g>\003f\226\300\\v\207z\311;\035\352}/\371\035\314\2274}\256"
+	.ascii	"\227B\202\\\220E[J\266~\037\353e\016\251\256\242/B\265\354[U"
+	.ascii	"~Tu\023\231\213\275J\01361\342vb\266A+\327\234\225ifn\365\013"
+	.ascii	"\230U\2161+\343n<\333j)\355\3053j+\237/+\233\266riV\266f\345"
+	.ascii	".+W[\371\003nH\276te\367\036\225u\271^\345\020\0337\376E\276"
+	.ascii	"\217s\205x\026\247M\307\020h\026\2561\376\325\265\230S\026\361"
+	.ascii	",\236\021AJ"
+	.string	"\335{\261\230\323\363\340\037\215[aF8\"\230\323\227\375\035\2342s1w\006\001\317\254,\023W\356-*x\311\272\363%3\2772\237\352U@\267\"\301\350\275L\001\235\023r\241\201\232]\243\232\220\350\026B\260!\234o1\377\234\311\016\265\241\344K@\230/\315\376\217(\335e\1778\205\274\223)<z\234M\244\312R\303\234i\2660h\323b\2363\273k\324\025\023[\323\272\273\302\024\322\336{\357\254\353\264\236\351\013S]D\303^-\343\356\261\344t\304l\"\3778I%3`\332\211\217u\024J\254\211\3055\333\2565\332?\346\234\211^\370u%e\250\222\225M|\316\2545\256\271\022m\351\325\262\263\261K\214$\333\304\256\335s\025e\250\2221s\206\037\311\311\to\f\251\356\2758Fv6 GTcTD^\204g\276\254\375$\2741\254\262:\327\205\360L#\024\337\271\230G<\310\316\f{\272\3676"
+	.string	"r\344\006\016\314a\347?;\037\035\035\236\251\001\202\31197>;\r<\036\f9=\272\034\035\235\207\235\f<\272\234\036\037\335M\r\363>\354zt?<^\217.-\n\275\235\200$\361\022\352\336\017\327DFu\330l\240\304\206\266\376\261\265\245\375\035?\307\304N\324#y\255\177\317\2316\024\313\213\224\321\320\272\245\263f[\036\311\323\376\331\332\246\177|\251$U\255lM\2540g%\246\202\32343\005\013\365>\276\005\361\"\352\240"
+	.string	"F\306c\255\211iM\363\301\"\240*\370`\023x\370P|\f\346\313\032\004(\220\2750\037,\264\236\344\265\226'\017\377\332\331.(^1}\255[//l\237\226l\212\313\201$JOh'\255\331\316h=\353_=\273/\225e8\353\266Or\033l\250q$\303\224RL!\221\211FD*\315\030p\002\2312\252\036\021\240\321\013hJ\n\303\236\001M\3523\177qu\343H\230L\371rS:\341\230\223?\202\342\255\017!L\023@\323\346a\255\214\203<\b\313xp:x% \276Vq%\230\211\354*6EL\"\276\303\370\363\027\200*4\271\344\n\226\322\2026\255w\243d(\027\003j\001\2002\030J6|\201,\305^@\210-\017\023\022\006Fq\346!\375P\026\357d<\266\0055b|\372\021\352\306\2175Y)\277_\376\342E\0332\322\016\205.\302\201\245\002\021\353$J\235\265"
+	.string	"\2756Og2\305\274\034\270\374\035$\035q\273\365\322\2425\177\2014\237\306\271\201\242U\347\020\230\017\336\227D_"
+	.ascii	"-U\260g\311\260\247\035\303\302\223DG1\236\353\247\345\205\353"
+	.ascii	"M\211\371\003"
+	.text
+	.section	.gnu.lto_isModeActivationConditionConfigured.55.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"\345\n"
+	.string	"\266\025M<01P:\2008\222\306\270\252\"\307\340+}\341=\237\242\2630\347b\0302\367\317\257V\t\266G\360\226FBZ\330\310~)\260\004\274\b/q\326%C\305a\350\235|B\266\224)\005<"
+	.string	"<"
+	.string	"7"
+	.string	"^\320@\343\3561\304\347\"\021\035P\244v#\246\242w\207\232\235\357\035j\215\026/P)\276\017W"
+	.string	"\337\006\026\330\335\223\236\236\217\223\371\230\354\256\263\363y\270\253\333\206`\233\201}\003\001\325G?t:5}+sJ\321p\320\261\373\351\310\261.\252\025#lkl\210\035c$\310\264o\342'4\037i\030\020YN\t\304i7*\360\201\353\225\343\005X\257\256\007\260^\331\016N\365d\203n\240\206rw=U\220\021\374:\241$\203\2238le\344faU\n\325\306\220\311w\256'\375\202aco\314\340\240\236\035\275\324\220}\270\273k\005\331\217\177\031%B\006\214E\253\\\031ESg\222K\205\302\246I\3108,\253\200]\260@\321\260\214\273`\022\002\336,\025\016\303l\033\207A\342\036\256\202\374(a2\251\337Y'\375\001\212\204IE\376\235\225\352\261\003\016"
+	.ascii	"P\204\366\323\206\327\304\016 4\007\334\202\346BH3\266\20090"
+	.ascii	"\030\030Y\200\n\206\252rH]\337\332R\006"
+	.text
+	.section	.gnu.lto_analyzeModeActivationConditions.56.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`:\004\215\033"
+	.string	"V1\254I\260\226Q:4\006\305\225\362@\225\307\003\341\026\257\274\230q;\320\377\272\226\257\310u\245\3600\241\035:S\353\317\024\375\265$\210\341>\336 \360@s\"y\223\373\203h\337\036Dt\206\333\034\013\005r\262f\032!d\223-S\n\222"
+	.string	"\214"
+	.string	"\240"
+	.string	"\324~a\273N\367=\273|\335w\264\363z\312\332P+8\225\304\252\326!\233S7(O__3\236\322\234\300xj\232=\274\357\250\336\b0\210\t\253\326\372\232>\\\340\242\357.\227\366VI\216T\234K\363{_\300\013\336p\265\267\304\031\003\353\306\261\f\331\020-\210\t\222\372\317\266%\231\241\007Q\321\311\032\037\203\232\200\226\002\300\325\270("
+	.string	"\027CT\260\364\225\201\373\331\371\337\251\017(.:\210\212\276d\206Z\253\367\206#\272\001\334v\021\333\032l\321A\017b\023v\332\337\3544\236\322\337\024\221+\237\315\262ki\356*\243\315\357{OG\300\321\315\336\211\355o\336\240\r!\320\254\331>\333N#\373\007\220\222\204\236<\354\032rMC\3273W\272I\272\036\351\232\322\265H\327s\\/]\337\300\314\223+\026\236j\025\312\032S\205\364\t\322\225~\336\327\276\177\344\300\026gr"
+	.string	"\333\026\"-\354'\275\311v\371\305\231L\177\303%\333u\237\377\2230\201v\245YY\205\220H\214@Y\325\352\213P>\263F\311i\333\305\245f\f|,\217\372"
+	.ascii	"\342\346f<\275\360\243H\234\302\337\272<\370\234\342<P\316\266"
+	.ascii	"Y\2662g\200\250a\221\242{\241\3021$N#\213\030w\312~Y~V\214\355"
+	.ascii	"\020\257\"\242A\256*\247\253\365\207\002\225\236\026\222\220"
+	.ascii	"N\213n\312\241V\214\247\273G\271\252\334\216w\340\245\350\314"
+	.ascii	"/\007\3320\036\245G|\242\252\265V\200r\247\021~\220S\343\300"
+	.ascii	"`\363\300\213dr\200Y2\004\t\rr~~\351\264\311\356)\250\214\317"
+	.ascii	"f\315\251&\274\034\323I\016\271c\n\313\346>\223\007\035\305\001"
+	.ascii	">\201\3420\234\r3\036\025;9\245a\020X\344\220\210\355\214\200"
+	.ascii	"\311^\260\022\257\024(pv^0\031\213\027\004\004\216\251\310\221"
+	.ascii	"\275xb1\331\313\345\363\371\344\301\001\212\320g\332\334#\326"
+	.ascii	"\252\003\303y\177\357\003\254\2246\2535\215\334\002B\326L\nd"
+	.ascii	"-\343\303\213\265\326Z\376\263\221\2345\363\277\323\031\273\340"
+	.ascii	"\222<\3372KP\265\341\3465f1A\347HE\251\344\260r;\207\271\022"
+	.ascii	":2\332|f>iX\363\022u`\257\344gzO\347A\356*\247\243\231~S\007"
+	.ascii	"\017\373\333\314|\323K)05\214\025PW\250Q0\305\214C\310\310\004"
+	.ascii	"3A\215\026(\351\200\002\031\262\262\016\021P\305tT\213\213\365"
+	.ascii	"\f\201\224\n[\366\017\201FD.\225\177L\237\002\2506\253\323Vq"
+	.ascii	"d\r8\330\265\233-T\223\321\304D\251I*\2644\003\324\027\375\300"
+	.ascii	"U\267\252\330\247\020\300X2\302\306K\354\360\007\350\256\264"
+	.ascii	"{C\354\224\035\214Lku%\306h\301\022\220gS\227F\024\257\235\r"
+	.ascii	"\213\3056\003\315\300v\214\313\"\250s\335m\356\001\323\210\220"
+	.ascii	"\221hNe8\351Z\273\310^\200\253V\205\022\245}\304\026\341\260"
+	.ascii	"\321$\240\204\221\376\363\211\204\375e%2\216[T\312\241%a\362"
+	.ascii	"\326:\311\344bH\332\375\3217\246\303P\001"
+	.text
+	.section	.gnu.lto_updateMasksForMac.part.0.66.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`\266\001\245\017"
+	.string	"\346\033dF"
+	.string	"\257(\035\220\0315\203j\242\210\2629\371}\240\177\243\311\202\340\305\346\373O\006\023\337\337\2045\033\370oH[_m\270\343l\361\366_\262U\375\250\317n8m:y\"\233\240;x\346\233J\207\005id\023\271S\nI"
+	.string	"U"
+	.string	"N"
+	.string	"\033\273)6\264\335\321\343\323\b\272O\217/\300}v'\300}\332_\261\235jY\264a|,\261\207\2756\304j\273\353}*\211\213W\271\211\376g\3178q\251\256"
+	.ascii	"\\\036.\007|\343\204\354\256\273\017\367\274m\217m\b\266\364"
+	.ascii	"\b\261\373\261\224\257\3423k\304\030\304\223:L\330Q\205,\013"
+	.ascii	"\305\253fJ\033\304#\036&\374x@\304\370\252q\320]\366r\352(\207"
+	.ascii	"]\215\350\370|\t\241\240\373\324\260\312\303\\N\352r\342\020"
+	.ascii	"\260&\260Y\002)?\246\336\202\342\030\267C\313R\332Oq\026\361"
+	.ascii	"-\250\007k\262\300\247\301`\3017\361\351\243\270O\251\247\275"
+	.ascii	"\303\365\302\206e%o\244\252X\267m5\305>\354WNZ~\374\317m0x\355"
+	.ascii	"\262nb,\312\2449\361\231_\366\307\\\355\373,\276\302\247\315"
+	.ascii	"\310\204n\311\204\035\325\270\254\006 j\257\332\203. \222\310"
+	.ascii	"\310\026\272 *\371DF@\244\017\207\304\364\211\020\206H\234\357"
+	.ascii	"3R\177\037\246\020\b\034M\370J\336G\301#\211>#\357+\231\274\017"
+	.ascii	"\003\006+\204J^\t\b\226<\371\331;\331\212\213\225fPU\261\035"
+	.ascii	"@JU\265E$\362'\226\200\242AU\266Go\001v\033+ \200\002\031\253"
+	.ascii	"\354\265\013\374\n\354\221^\001\374\013'4\023\023y:\302\177\270"
+	.ascii	"\266\263\340\260\250\347\324\026\027\274\t i\244\353\211\fj\f"
+	.ascii	"a\241t\002\270\235Aw\266\342\326zx\234\264\334Q\006\341\233\217"
+	.ascii	"\310\303]\037\253\317\370f,\021$\362A\262whg\301L^j\026\324^"
+	.ascii	"\220\234\342\351\327\3421"
+	.text
+	.section	.gnu.lto_updateMasksForStickyModes.part.0.69.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`j\006e'"
+	.string	"\232G\204\017Ep\236Q:\267\303\211h \003V\356\210\221\016\\\036\335M\371\036\250Y\250jP\243z\254\256\032\375\261'\303\305e\306UF[\334\001\323:\024'\263!\241\\K\274\267Z\243\252\236\345xamO\032!D\312$\003\342"
+	.string	"\331"
+	.string	"\346"
+	.ascii	"\273S\373"
+	.string	".\367Bu.\333\306>T\274'\263\332\325\351\266h\321b\346A\363\225Y\252:K\325\022\005\314OZ%\353\216\3422\357\336\312\305\202\277bc\311\250b)q\230\325\232\\\360s\021\244?7y%\364gz$\364\347\356\253\354\256Uq\203\273w\236LR\257TC\324\262\254\265\362~6\222\007\277\323\345p\351\r=\315\346\241\340\236\354ll\273\372\316Ig&\310s\366\347`\305 \246\022\027\223\255\267)\002\341\\\020\263\t\254\370\203q7\013Dv\004y\332\246\350e6\235\335\t\254\330\305\267\253\235\367\004\214r\255\213\321\307Q\3362\366\370\251\305&\2211\313l\252\265\352\214X\334f\202\343\031\036D\306\241\251\304\246H\235\253\235s\030\211\314G\037\272Y\250\265\356\205__\242\357\356\332\356\212\330E\r\004\177\272\372\023HL\310m\334\310\355\241\233\265\326\272mdW\307;`\307\313\364-\377\322\225\277\200\2247"
+	.string	"\312\253\204\362&\351x\221P\336\243\224\027@\312k\224\362\026\245\274D)\357P\312\273Kyu)o.\345\305\245\274i\216\367\226\362\2428\336\023\307k\246\274\215\343\345'\377;\025h+:\326\312\325F\250\n9\321\232\334\254\f\325\002\237\004q\034Cv1'\263@\263veu\235/\254\344\323\356\002\227\262zN\327\222\367\323\334\375\376\313\325\246\216\266O\343qE9\206\325Z\305\204\221a\326\256\332u\276\226a\313\224\247\036F\306\223\225\213F\3272l\231!\005s.\373\263\325\335l\035@\260z\031p\213\016 \004_\006l\272JV\256\t\3078a\313Z\223O?\267BJ\026w\270\302\216Vn\215\\>\237\316\246\202\003\350\034\273"
+	.string	"\372\250Od\023\242\215,4%\311\362l#k\324\271\266\241\003\220\022\315\351\274\250\215>\347D]\324h\232\026\330\331D}'^\200\210l\302'\021\224\307\314l\344\016u\256\373\2162\315m\270\353\241\3564\255#\223\256w\215\332\321\002\033\266\256\257\366\023\314\013\017\221M\210\205\353\\\243\177\214\240\244\215\353e\255>\267N\333DCd\223\372Z\210\264\326*a\377\346pD\354\b\022\374-\022\350\317[C\220\203f~\323\320n\264\033`\0013\\\333r\034r\333\366\371\314\017\233!\335\310\263\315N\241T\203\305\202J\274M\037\220s\2655\3615jn\2348\217\002\375i\266\022\035k\216V\304\270\273\271\020\221m\267w4\276\264V\254\b\37337~\373%6\320\237\334?\0135~*\2408\274\370AA\365X`\2501\325+\372\321h1\303w!\005\325\017\352\346\002\330\363\240\002\252w\363\365`\364\372\030"
+	.string	"\177*\242`\240\360I\361|+xP-z0x>) \217\001\323F\305\370I\361fDEI\361t7\353\323\261\2665\302\036n\337\334!\340\001}\264\023\252\"\020g\320\006\237\004\241\210X\016\350\242!\205\002\211\351\032\271|\244\326Zs\215\344'=\256<(\005e\352\023Q\2461\300\273A*\301*\374-\246N\032\363\263f\330W8'\016\320K-\240\337\273\301+\027\370[\333D\354\253U\352"
+	.string	"\005\316\b\r\327\306\330\204\265\326\253\264\221K\300\315\027\261\f=\332\340\306k\254\214\317\347J\235c\017D\223ZJ9\207"
+	.string	"#\365\321\276\247*\255U\370\255}\236\353\321\260\241\252\n\345\320\201\277\225\324\024\204d\365\325\356z\270\235\017H\034\200\201\250a$\305\214R\306)\231\031\021ia\222\306\220\002\221\252\252:\021\260A\253\232\202\322d\332\f\266\327S\3743\363\n\267\302=E'\376\353\220\003\301\240\001\254\222\250 \r\222`fF\232e\240\216\002h1\013B#\301\021:\346\177\306$\237\215<\374f\353\360\224\357\023@Y\341\317E\364\354\250\332\200j\332\323X\030/\211A\245\2666\245=\320\241\363\264PJ\235\032h\362\210m%|\212\252\303c\225Ld\004\351\233{W\254\317\205\374\351\004\223\261\213\237\237\371\310Z\b\350r\3727\331I\345\260\313\f^\007o\005\251e\253\340\306"
+	.ascii	"\342\236\2127N@.3\217(\021l}\224\214\305>\353\f\023*\005\235"
+	.ascii	"\203P\334\320\315'\213\004N/\2705S\234\372M{X\241\013\025/\n"
+	.ascii	"\266)\005:*\362Lr\367n\222\216\226\"\243\\:\020\200\377L\267"
+	.ascii	"\326m\241(p\334\353'\344!\246\330x\033qT\355m%\2121/\r"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`\365\002\315\020"
+	.string	"V\031cG\020\355\246\003(MV\250\256BhF\227\317\305\324\350\270\017\333!V\b\216\241?\007\322`\231\240\373mm=\342\211\315v9\002"
+	.string	""
+	.string	"@-?H\007\t\024\260\363G\331\030\311\006\250m@5\377Qd\267\225m\022%\231RN"
+	.string	"U"
+	.string	"M"
+	.ascii	"v$\244\200\307<\211L\267\"\037)\035\330+\344S@\036\205\3241?"
+	.ascii	"\236\201\244\307b\261\230\307\237\200/\263\343M\244[\016p\343"
+	.ascii	"K\244\351Q-\322`pLf\226\241\325\360=\211\311\206\241\230\201"
+	.ascii	"\371\231;\330t\205\265\326z\317-\311\314n\"\355*\216=\346\271"
+	.ascii	"\007\346\017\274<\002\227g\236\324\033hy\030\226wik-\363\267"
+	.ascii	"\3621\255r\232\314\020f\0368` \263"
+	.string	"`&\201L\003\024\267\270J\031\231\003X=#P>%O\276et#Tc\362,\033;!\206J~E\202#O\n\324\253H\022\220\351\001\236\205-\203V\022X\332\346}\271\255\264m\276]\315-ZTs\213\3334\032\232\003\270}\242 \002\207\323|d\2415\\\021\204\230\272\3506\203\360\031\272\300Q\027\215\034\365\3546\277|0\344\224\250\367\330\255\003{y\350\250\253\332;\352`\027,\022\273O\224\250`c\"9\370\221L\030\276\375\364E\315\017\320'\300\275\333\027\034`\033\272\352\336H\240z\351z\325\273\026\255\236q3\002\204\3359\037\\;\264zF\242{\002\013\005\316V=\033\333]A\253\233\256z\213\\u\005*\360\253\001= \240\002!\242\353\006TR\340d\204F\275\247\326\236\360s\0271\362>\215\360\035\315c\270$@\336h\226\346\252\344\026\231\270\247te\303\303\036\007!\220\332 )\032\246\212"
+	.ascii	"\031\031\034\202\003;\301.\021\034\001\207/\220TY\332\2170\017"
+	.ascii	"\033o \300\032F\242\036\215g\353\370\341\016\331*\302\017:o\b"
+	.ascii	"\302\250\345\201mH\303<I@\232\204\371\370\303[\236\027\005\340"
+	.ascii	":\264\315\371\332!\351\262\203\363\021\321@\234\375\255\033y"
+	.ascii	"\260\234"
+	.text
+	.section	.gnu.lto_.refs.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375 \325m\004"
+	.string	"\322K\037!\240'\031\016\377\377\377\377\377\377y\201U\232\264\317u\377?w\263\233lIZ\333\255m\262\367\2262\005\013\260l\360\205\354D\355\252O$;\255}X\237\362\2626\325\002\322\213r\204%\303,\370\3217\375\322_\00703\234\275@\256\300\235\260\036\241\177\3207(/H\236@=\003\375\352'\375\366\025\375C\037\225\037d\305\232db\017$\336H\034\241\021\345\003}\354\235\315\312\036\271\375\r\001\004"
+	.ascii	"\243\022\341g~yM\212\022\224/"
+	.text
+	.section	.gnu.lto_.decls.f93c3a1c1f15efa4,"e",@progbits
+	.string	"(\265/\375`($m\241"
+	.string	"\332\377d8Q0\022\322I\007^\317\026z&9\251\253\331\001\020\001T2\333\353\260\261*\022SV\327\377.\316\303\237#\270\023\013-\353\343\317\026\216\245G\022zE\035-\214\b\250\252\252,\312*\253\250\"*\353\016\334\322\230;\332s\024\310\032\001>\221D\262\245L\001\367\002v\003\217\003|\300\016\363\0017nY\314\262\024}[\251I\223\366\020\367\203\252\317\207\203\340\"C\327\350\373\007\2323\250\025-i@4z^\371\f\363\035]\317p\036\357\355,\255\027\n"
+	.ascii	"%0\034\\\374T\360\354\0011\342\003E\337M\365\274W\246\237\367"
+	.ascii	"\006\320ME\3044\177X\017gi\275f8vh\250\316\006\325\026Ag2$R\247"
+	.ascii	"\324zy\322\257\266\252?@uLq\b\023\260F\357V\264\020d\266\204"
+	.ascii	"-\221S\377@\027\366\262\263\324s\227\256\356\266\310\352\230"
+	.ascii	"\313\2300L\307sl\307bx\345:\216;\177a\271\243\353\275h,\005\f"
+	.ascii	"{\241rEF\354\017\342:\236\302Ul\024\247j\345*\217\217\255p\035"
+	.ascii	"\247\361\026\273n\251;\224\360\370\356\275*T\370\250P\241\"-"
+	.ascii	"\013B\227\226\203\236\337T\276l\"\355\341'j\031\303\341<y(cv"
+	.ascii	"\251g-\365,$\b\237\234(23Q\215\236\235\324\263\033\257\374\306"
+	.ascii	"Z\316W\030\355\274\336\273\336{\357\242\215\331v\226=W\211\016"
+	.ascii	"n\353\336\365\017\374A\177\013\027\374\306X\230\315\256[W\211"
+	.ascii	"n-\0020j\250p\371\335\273\372\250PqS\366\325c0E?T\177\202\312"
+	.ascii	"YX\215W\024\274\366\026.n\227dW\354\336\225G\247\rX\0336\215"
+	.ascii	">\004\365\214\"\345AF\221>\003\365\024\250=l\"m&\221\376\260"
+	.ascii	"\211\224\317:\360\213\030&\215\236\205J\345\n\250\227c\023f?"
+	.ascii	"\377\300b\\f\233L\317{v\357:\342\246\214K\030\263Q~\302c\274"
+	.ascii	"r\331\317Q\230\354(\331\363\232\335\273\352Xf\224\227,\215\246"
+	.ascii	"`\023)\312$\3223\224\357\314]\027o\365\374\223\362\360O\372\225"
+	.ascii	"M\244*\223H\277~\006\353\243\b\\\223\340\004\006\376&R\024\203"
+	.ascii	"\2141{\027\340\357\272\237\353\006\205\177\203\3416\0130\340"
+	.ascii	"K\374\3756\243\323H\374]\345\t\237\2419\035\2133\007\363\263"
+	.ascii	"\231:\023\270\347g\027\304\354h\001\301G\300\3365\370;\311\317"
+	.ascii	"%\344\371\335\304\337-\030/k\316\356S\376\223\035\200\277\205"
+	.ascii	"\334\376\267\371\374'\200\347\357\247\033\216\376]\303\317>\334"
+	.ascii	"\341\374}\374Y\310\317C~\276\372\271\352\347\036~\266\372\271"
+	.ascii	"\210\230\237\233?S\375<\365_\347\267$\374l\367\363\333\317U~"
+	.ascii	"\036\3739\354\347\256\237\271~\326\372\371\310\317F~F\376\214"
+	.ascii	"\364\263\f?\317\370\231\350g\031?\307\3603\f?\277\3603\013?\253"
+	.ascii	"\360\263\t?\237\3603\320\317!\374\f\343\347\f~\306\340\347\n"
+	.ascii	"~\226\340\347\007\376\247\360\263\001?\247?\013\377\007\376\277"
+	.ascii	"\373\271\200\237Q\374<\300\177\270\377~\377\327~>\361\277\357"
+	.ascii	"g\237\237\003\370\031\200\237G\374G\341g\236\237q~V\377\267\371"
+	.ascii	"/\370\237\315\177\300\377i\376\237\371?\346\177\331\377\013\376"
+	.ascii	"w\371\3373888\370\247\352\177\323\364\237P\n\367J\255\320q\302"
+	.ascii	"\266\203\325\016dd}\006c\351t\003\027\030\304TSy\237\355\224"
+	.ascii	"\361\261F\252\321\236\302l\251\230V\030/)<N\367L\030)fI\272\266"
+	.ascii	"\236A\340\264\021\024\222\243\214\265\334\\\005Qs\033=\272c]"
+	.ascii	"{\345?^\257\323\004w\353\212\333@\365\311\223\036\203q\257v\360"
+	.ascii	"<\321\344 k\264\307p\230p]1\345\201\201\365\017\352\362^2m\370"
+	.ascii	"t\306\302\244\031\t{\377P\026\004\b]\\\327\273\332\213\257\363"
+	.ascii	"^\251k\361\376l\024\2334lN\336^\374\307\243\324\245$\315\213"
+	.ascii	"\316\227^\335\016\215\336\242\251W\275u\325\\\351\275\274>\235"
+	.ascii	"\234W\312\371\363\267\017o\256\224\351\313\034W\243\315\244\263"
+	.ascii	"\204S\242\220(i\254\033!dO)Um\365\036\362!\275D]\336\273\\\257"
+	.ascii	"\023\227\211II\375\314\360r\033\243\365^\36229\227\200\020c7"
+	.ascii	"\234\272\032m$\235\205.\221j\003\222\245\204\007*N\254\334\255"
+	.ascii	"D\336p@%\3418v\256\351Q\327h\037I\245\fI\033l\264\2114\226\025"
+	.ascii	"k\362\243\013\253\215\by\233S\322\227\2621\242e\251\321\265\213"
+	.ascii	"\\'\224\266\260F\237\206\377rt@i\021\322\350m\230z[uN/\323y\357"
+	.ascii	"\205\272Y\257S)\347|\303\374\363\353\260e\004\256u!wo\327\263"
+	.ascii	"O\345\312\302\f\222\342\376\367.G\334\365:\233fV\313\246\224"
+	.ascii	"\271\247\021\353\255\n\340\232\r\271\315\325\352\t}\336\276\353"
+	.ascii	"\345\273d\3654Cs}:\233\353s\331s\227\236\313{\327\247\236\346"
+	.ascii	"\031s\311M3\253\247\246\331\363i\304]\272\313k\306\254R\227\236"
+	.ascii	"OM\270\347SO\323\214\371"
+	.string	"\324\\\262z\032\321\344\231\265\303\016+\346\027\216\322\\\272<\232\246\230\316\036\271\346\372\274w\367\362\331\215\353D\340\336\251\247\363\216\t\204\325\224\344x(\2411\237|\242I\351\352y\227\344\232M\236\3676Q\242q\233 X\256r\367\b\313-\207L]\246\033\367\n\320t\357\222\257\334\275wy\357\025:\247\326{y\350in55\335+\345\323t\247\226k7\356\3553<\265\247\246\331\3253hm\212\331\326\305\261.y\353\336Y9U\263e\224\313t\357e4\352\326S\2173\215\262X\230%\340jVB\312\213\007\025\025\247\261M\030\\\342\370\256\323\271\342\035&\310\332A8\215\317z\241,\360\022\325\304\357:\245V\b\247\234\325M\351Z\305r\234\234\222<\033]w\262x\034\241\222\342\272\326\323\312b\002\322Q\315u\004/-A#k\264}\364\217wT\367\270\035\005\301\363^fG\361\004\336\313\344a>\200\371"
+	.ascii	"4\354j\211\225-\365o\250\247\336!hW\326\350\235Oj\347\367e\346"
+	.ascii	"t\332\342\367\203\231F\337N\17775\017f\213\341\252\312I]\243"
+	.ascii	"\\bG\320\233I\304\225.\202K\032%\321:\250t\216n"
+	.string	"\362\372\004\023\354\345\273\3717\263\225\032\007?\357]b\035\3124\0016\332K\255\003\257'\372\306\rs\275+\237\301Rz\302Rq\270\227O\244<8\310'\322~\262\211T\001&\221\366\rz/w\236\300\244Xit\004\223HO\b\275\326z(\322F\320\336g\330]\243A\254k\213-\221h\005\242\340Y\243\232\2060\233?\341\017@\\\2355\312\177\315~\fx\376\34359K\374\207\336\313\344Zl\033\027\0213/$\352\033P\311\242\236\326\256\367&zLf\032\265jw\223\022\343g\304N\211\273\242Sj\324\246\335b\371qp\330\204\020\261\262B\263\013\262E\245>D\324\272\332*UB?'\227\033g\267U\326\210\211\375h\324R\261a\234Lm\032\265dv\312\323\0276Y\032\265e\326\214\327w\261R\276\303\206\243J\027'\3659\360\273\2446\212\320\n\017i\314\020Jbbv\254\004\223\247%S~9P"
+	.string	"\347\236<\271\035K#En\214\313\244qN\201\200n^^6,\245\002&I\237\237\n\204\013,\207\r\263`d\200\030\f\264_9\314(,`\230\250\307A\322\325e\265\310\200\361\t\313"
+	.ascii	"V\t\331\332\262\\\334\263*\341-\341{\023\363\341\303\372p\313"
+	.ascii	"\245\003\266\246\304J\243\226\311\367P5G\226\360p\240\324'\261"
+	.ascii	"I\254\026\223-\215\004\361c\377\226\254\362:\353VK\250\343I"
+	.string	"\222\247F\255\222\353\201\361\362\312\372\271\216)j\224\356\216\330#\r\007\243\347\336+(j`ZamR\3243\030w\337\255\022\257\335g\215\370DY\227;q{S+\354\335\023\021,\215\026Y\227\320\320\230\001\363\245\236\305p\330\034cy\374E\207m\212\341=\331\036N\276\354\260\315\235\345\210{\207\330\036,\021;\304Z\331\247\275\342\325VY\037\267KV\207\373\254\367.\241\331*\313d\235,\207\225\201\330\035\237\275Qe\177X*\226\223\352\271KX\366B\350\260\222\243\332Aq\\\217"
+	.ascii	"\245&\2141=\276{\327)+\204WKu\037Ke\243l\020\226\223Z/\224\210"
+	.ascii	"40WR*N\250\3209\023\346.H\032\204\207\035\264\325\b\232F\355"
+	.ascii	"\016R@\272\350 \005\204W+\245\246\371Zcs=\021oH\256\324\037\352"
+	.ascii	"U'\365*\023J\255\343\243\212\013T/\364Sm\223\345\301\353\002"
+	.ascii	"\326\251\223\bV)\333S\317\013\244vp\220\027H/\304S/\234S/\364"
+	.ascii	"\242\3766\207m\232q\351\213\263M6:/LJ[\324\024?L\"\355A\273\264"
+	.ascii	"\3140\265\"W\326\324\333;\002\222/W\032E\371ni\013\276\333\374"
+	.ascii	"8\335e\311V\023\232\372f\323\201wZU\2424z\241\231\372\006\274"
+	.ascii	"2\330\267C\243\375\247\336\020:Y \004\025\226\036\372\357\357"
+	.ascii	"5\355\327Q6\f\n\256i\364wl\"\325I\023\364V\023\007\004\037\224"
+	.ascii	"Fs\204>\316\234i7*U\200\310d\301\322\247\247\327|F\264\204cG"
+	.ascii	"\334\360\366\336|\350\037\240 \224F\273\314N\0175m\224tV\b@ "
+	.ascii	"PI\324\356\356:O\225\322&\252\211_\210' \016,\274w\2360\020\f"
+	.ascii	"\312\224\036\223\372`g\327^8c\242\232|\341\370\340\341G\325\350"
+	.ascii	"S\2500a\332\213\b\232\017a\310\266\032\375\215\231\27192prr\355"
+	.ascii	"t\323D\325\364\370\250\250_\301\035\267v\334\335`p\360\205\307"
+	.ascii	"w\235w\305o\276\266\360\332[\032\016\247\211\252\331\343c)\036"
+	.ascii	"j=\340\376\346\322]\372\251\205@\304dmi\264\304]\231D\372\233"
+	.ascii	"\036\352\332o\355\364\263\336e\tyQM\374n\226\332\332\332\215"
+	.ascii	"\357\255\313\021\325\344\313ny\306\tq\273\231k\242ee\017\255"
+	.ascii	"\331\320z--\255\327\324\262/\026\311\235 \234\332{\315j,O\257"
+	.ascii	"\321\316\202ne\3211\325hcQ\242\205\013\030\352\246\036mb\205"
+	.ascii	"\327\266\322\315\237\347\205J\321%G\347\364\013D#\031CeR\f\003"
+	.ascii	"|\210\310$$\024\351h\310XD*\223@D\242$\243!c\021\b\231L\002\002"
+	.ascii	"\300\310(\311h<\032\2055\034\2214\224G\243p\306\220h\204*\211"
+	.ascii	"\311#\342Q\252\024J\221\307\026\200\206\b@&)\207\304\031=\247"
+	.ascii	"\301\002(\211$\322PD\022\t\240\024"
+	.string	"J\252@<**\325\344\0219T<J\221F/\224\304\017N\203\305PY\224\001d<\036\035\035\207P(\211((\2132D\330@:\276@@y\032,\212\220\200\212\220\206\214I\036(\211I\021\306\031\255\274I\n\025!\345(\205\214EH7\306\"$K\264\241\230D\223I\"\222\210h(\264\201t\034B\221J$KD4\026\025\215\206B\"b2\t\035\"&\205G\n\025!\261\320\261\201T&\213E\304\023\016H\332`\303hh\034\032@DD&\025\025g\030\217/\022 \322p<\"\"Q\030\2404\022\223Dd\t\311b\n\021J(\215I\307\027GDe\322\006\nBI\005l\f\221H\r\206\2061\206;I\"\242rX\342\004\n)N\203E\r$P\r$\211\241r\310\301\0202%&\213:;\306\016\222  \213\303\036\025r:X\001\204\024^h \324\001\007$\304\020zq\202\020\n \214\030\341"
+	.ascii	"\013%r\210\304bh\030\003y\364 )Cr\030\203\250\034\022!%\371|"
+	.ascii	"\250\210$\032\211E\352!\210\240\201\b&\250!\374\004\0248@\201"
+	.ascii	"\003\351'\240 (\210\202\b\202\324G\020d"
+	.string	"\211\210F2\206\311\"\007H\"\r\035$m\3100TT&\003\370\220\f\311a\214\030C\310\022\310!\215!T)\024A\220\322X\024\032\035\217\033\b\335(\223B2$\207G\312\342\0065\2162r\224B-\036P\223\312\242\fTyL\201\210(\203\261h\244&\205\212D\306\343\013\343\261\250\034\322PT\016ip\202(D\004B\215\243\f!\021\bi\r\"\221\021\204\0275\222\206<\312\3238\361#\022\021\t\244<\036\221@\"\210\214DaR\350\004#\242\3218\2441\264\243\024\232@i,&\t\221\210J\024\224\310\2412\211C,2\016\2217D!\021C\305\242\243\b8\017\nz\221B\205\021>P\207X$\211D\307#\241!$\320\320\f cqx\0044\204L\002\261\360Y\332\260\273!`;\032\265\233\033\302\324j\324\001\254\365\211\226u\345T\245Q+\3306\320\266\271\025|\b'\326\272ZA\013\307c\371"
+	.ascii	"\036fZ^\\\212Z5V\215\005\304\311\233R[s\013h\377\250\244\204"
+	.ascii	"\355\331?\353\247\003Ek\255\213\245\363\202uV&\315\030\317\335"
+	.ascii	"\223\bS\237\255\242\303\007\344\271\204\246\227\270\320\353\013"
+	.ascii	"\323\262\263\245\343\013H\233y\223\2032x\244Q\253g\365\354\036"
+	.ascii	";\235K4\t(\355I\371\370\371m\231\333\275\316\n\361\004\345L\233"
+	.ascii	"\333\217\265\037\274\270\221Y\313q\"\350\244\226\327\\\251\223"
+	.ascii	"\032\277\033xZj\035\017\255\2751\226k\220\255y\373\256\341D\f"
+	.ascii	"&\351+kt\313\255\227-\326\316\316\365\\\245{\267\370\342\240"
+	.ascii	"\242\324\344\003\303s\322&wkw[\327\302\305\335\030\355n\013\253"
+	.ascii	"Q\033\346\266\355\b\232)M:\333\306\204\f\332\\\003T\200U\201"
+	.ascii	"`\2165\227\325\325h\333/\337\313\341\262\346\027\244Q\033\367"
+	.ascii	"=\035\264(XSp\267X\306\334n\3205j\273p\021\036rs\\\314(\211B"
+	.ascii	"\242\246>D\225+\267Y\256\3307k\227s\227d\327I\230e\013W\233\337"
+	.ascii	"mJ\375\210\210\262#\n\030\266\333\267[ Z\270\270\336\227\023"
+	.ascii	";f\243\326\355\266M\312\013\033_\202\370\250\222\2614\b\363\030"
+	.ascii	"3\b\225\214\310H\222$\215\001R\n\020\204\"q\"(\352\035\022\240"
+	.ascii	"\3654Q*\306\220\314\210$%I\322f\\\207\2318[\313\017\212>J\311"
+	.ascii	"hcL\313E\206_\213\333\356\277\3744#\331\373\372\317k!\375\317"
+	.ascii	"\275)\264\361\217\263A\215V\241"
+	.string	"\235A\362\200\244\331\376\340\027j\3672\277u\363<\364\231!@J#\330\360\325\220\203 \302\361x\r\215>\220\206r\\\377_\006[W\213c3\013\363si\304\371z:\364\027k\353I\375.$c\326\355\307@\304\371\351\tY\030\245\322k\224\331N*\274n\037(e\322\206\203$4\253\f}\231U\216B\206k\315\232%,\035X\264\323\357A\030\207Em\306]\371'\201q\340\021\205-\001\202&\266\217\027\230\270\240\320\277k\204\223\200\210\271<\234[K\016qP\372Nq\210\2375\311\232ioZG\233\303KS\331\241\230\233\301\324\235$\237~\302s\375\325\231\251\345\205\333I\357\253o\237\201;\375`s\300\241~sA\026\037b\315\2231X:\261n\203\f\3061\356\267H\001\240\036\302\332\312\n\177C\306\234V\271\024\362\021\340\267\b*=\200\0313m#d\311\234\337\255)d\326*\225U\t\352\277})"
+	.ascii	"\267\033W\250\261\371\333\346F\316\201A\311\370\256A{\312j\275"
+	.ascii	"\3516:\204~\b0B\200%+\301\300"
+	.ascii	";\313\023\365\216.\367\006_\267 o\301\207d\251\202\213h\262f"
+	.ascii	"\001\211YeqP\371\207jf\323p\250\324\202m\354\036\300\373\031"
+	.ascii	"\364\231\300\254\221\241<\001T,?\021\220FKL~\236\033\216r\227"
+	.ascii	"3\233+D\320z\341\332\345"
+	.string	"\025\261\352\024`\363g\007\025^C#\247\2208~\243H\320\324\240\037\344\030Ou\200\226\212\026\340\201\274\021?,\245'\023\361\031d\036-3Rg\256\017/?p\017/\303\377\300A\373N>wO\241\037\317h\324\2276YA\210Udm\253X\337P\373W\2076\302:K\366\365]\016\021\320?:\323\251\203\007t\2352\372B\031\00443\237\200\244\342\323\035>\262Y\377k\201\024Z\211s\035\374K\353}\274\f\254B\377(8!\275\205\251\\\b\364\367O\325\321jv!\">6\223q#\260\245]y\372\314\315s3\306 ]\243\024\256|\006w{\243A,\\a\351n\377\362\370\324\271\247\\ra\376\215\f8\030\205)\n-d\004\333\n8\037\306b#O\353\323r]\250h-\377_Q\234\f\365\344\\t\264\206b\227!?\035I\367\002\215\207\270\340\366b\241\262\210\250W\263\343K\310Y\336\252O\343"
+	.string	"\220\326\030\303\363\306\2315\237'OIy\221\362b\223K\005:\344\005\341\355\375\r k\004\002\301\327\353\316\374\352\257;`\213\313\370\352g\304x\330%&\221\374x\351\263<\337\340\344\206\323[\322\347V\374Rk\2054\327\307\035`\250\350\305K2-PC@\311\206\262\343\007\216\235\263\265\377\220\026\033\332\234\273\020\031V\213a_\305\213\266\341z^i\202w\240\021n\2748\230\300,\212\304\342RE\212\n`\317+\034H|*dfR\200\013\245\021BZ\255-!q\212\023Z\025\223r\033\016q\267\320\331\263%\271\206&\020Q\007\031v\224\020w\207lt\240Ssi\2309\307\216Lu\201\374jQ\326;JR4\245O\247\350\034\220\274\3035\346\314"
+	.ascii	"\374\b\354[h)\313t\356\021u\235\341Y\21312\320A\252*C\250\216"
+	.ascii	"\212\304-,\030\353\354u\277\344\253\305\b\354\025\024\b\351\316"
+	.ascii	"\364<\f\343\023Kd\352'5\325\3400\361OMT&)*ggHC\023x\332\222&"
+	.ascii	"\364\310\260\355,\331\246\234\024\025\207\t\315P&\263\223\230"
+	.ascii	"l~0\345\263\221vC`\\\205xt\343:g\231\346\325\345Y\265Z\232\320"
+	.ascii	"\333\351\375\341\326v\275\321\201\t\177)m\023\271\023\224$\261"
+	.ascii	"\205\205<f\3210h\033\316d\266{\240s\0245?6U.\230\3068\212\007"
+	.ascii	"\325fp1\203C\316\262\362_]\312\200\030w\316<\202I`\372\3350\206"
+	.ascii	"\357\354\252\371sM\215\224\367\232\327w\241\347\r#R\006\"\202"
+	.ascii	"\004\007\241<}\350\2768\306rZ-H\310d\024xA\262\261\fC\233\212"
+	.ascii	"\211\203\335\031b\325\252\221\332\227-^\tL\021\r\017-\210\332"
+	.ascii	"Lxi\f\274U\351G\212\236{G\002\320\003\271\022\267M\317\021\262"
+	.ascii	"Lr\3603\017T\024\362@\303\260\345f\204\213\n&.I\207\257EQ]\255"
+	.ascii	"\222Y\241\237U\031\221\347\357\016\357e5\334R\212\221w:\264>"
+	.ascii	"\bP\353,\016\314\273\341\360\376\b\366\203\026>\204\273\263\020"
+	.ascii	"\3761\317\373O\256\301\371\033\360z\035\332]oz\335\200\3021\364"
+	.ascii	"\376&F^>\347K\023.\205\272\016\273\017u\024\353\312\375\005\300"
+	.ascii	"\3375b\003z\212\373i\340#z\206hy\335\367\002\224\006\340\037"
+	.ascii	"\215\213\364v\214\347}\274\366\274r\036\374\345C.w\2579fq?\224"
+	.ascii	"\230\241\245\376\211\034\241g\207\266\037#\217\346\232\301\271"
+	.ascii	"p\337\326&k\275\352K\333\357s\036\316Z\341y:\346z\277\374\366"
+	.ascii	"\347\365\377<\020\326\322\027\340?\364NS\231\007\366\237x+\035"
+	.ascii	"?\331\374\300~\221\375n90\313\3030?\346\240\330\305\212\271\360"
+	.ascii	"c\223\342\017\3034\315\352\211\213S\356\020\277]\332R'\365>\365"
+	.ascii	";s\2017 \374\244\031!?\2040\002=bu\367\314\357\220d\356\305\252"
+	.ascii	"\347\276s\301\310\321\365'\343\303\310Y\331OI?\300\023\006>\203"
+	.ascii	"\263\372\177\215_\360\\\036\027\354j\357K\267Sq\204o\354ts\323"
+	.ascii	"\3503\367\377\351\351\361\1779]}>|\370\260\001\327;\367\257="
+	.ascii	"S\347\256\256\227\324\031r!\371;\207r\235#s\332\220\376\344M"
+	.ascii	"\262\2420%\377\341i\005"
+	.text
+	.section	.gnu.lto_.symtab.f93c3a1c1f15efa4,"e",@progbits
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"rcModeUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"updateMasksForMac"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"updateMasksForStickyModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"isModeActivationConditionLinked"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"removeModeActivationCondition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"isModeActivationConditionConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"modeActivationConditions_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"bitArrayXor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f93c3a1c1f15efa4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,567 @@
+	.file	"runtime_config.c"
+	.section	.gnu.lto_.profile.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375 \300\315\003"
+	.string	"\024\005\264"
+	.string	"\020"
+	.string	"\354\270\344\363\013\004\002"
+	.string	"\001\352\263\360\321\b\002\267\204\341\306\016\003\342\201\222\246\004\002\004\354\206\342\366\006\005\243\276\342\320\003\006\002\001\006\007\320\253\336\204\013\b\220\352\317\274\f\002\t\n\013\f\002\002\002\r\307\262\247\255\b\016\017\352\263\360\321\b"
+	.string	"\020"
+	.ascii	"X\005\246!\037\344\240C><\207\036\362\216j\206[7\317U\200\357"
+	.ascii	"\315\355q\3512\32428u\312\r\264\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375 L}\001"
+	.string	"\320@"
+	.string	"\n"
+	.string	"\001\001\002\003"
+	.string	"\003\004"
+	.string	"\003\005\003"
+	.string	"\001\007\b\n\001\013\f"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"*\2033/\003C\260\020\201y\215\312\340\22706\200\005"
+	.text
+	.section	.gnu.lto_.inline.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\305\004"
+	.string	"\022F\023\034\240'\351\377\211\254\3702\325\322u\357\267\370\004\376\377\377\315\254%\344,ido\271S#r\f@pG!\201\b\\\336\376\323u\250\2033\020\016\2133IU8\026\311\207\247\366\376\253m\333*\367\277W5\325e\337V\025\231i\274\331\216\036"
+	.ascii	"(\026)\3409\234%3GIA\261\344\200\320\270\302B\035\b\200\006i"
+	.ascii	"caV\271*\00566\242\277\b\026`\206\003x\340\330Q&@;`\016\030s"
+	.ascii	"\001-\260\201\225QR\326u\212&<\305\2779\203KP\005\030\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375 f\365\001"
+	.string	"\204\002Z"
+	.string	"\n"
+	.string	"\001\001\003\177\002\003\002\003"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\005\004\002\002\001,"
+	.string	"\001\300\004\001"
+	.string	""
+	.string	"\007\b\005\n\005\013\f"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"*\203\201:\004-\313\371ng\375f3*\370l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\002\230\004\003\204\004\004\204\004\005\230\004\007"
+	.ascii	"\230\004\b\204\004\n\230\004\013\230\004\f\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375 \364\255\002"
+	.string	"t\002\350"
+	.string	"\n"
+	.string	"\001\002\003\001"
+	.string	"\002\003"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\005\001\002\006\001"
+	.string	"\007\b\001\300\001\002\005\001"
+	.string	"\013\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023"
+	.string	"@\026=\027\266\354\250\331@z\003K\305\335\305"
+	.ascii	"*\030=\027la\2663\207b\345\247d\002\362\355\271`\013\263\235"
+	.ascii	"9`\333\006\332"
+	.text
+	.section	.gnu.lto_.lto.f0a880002f765dcb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_armingDisableFlagNames.13.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375`[\002M\022"
+	.string	"\346\341~K\300Vm:\250\031\343 \025\306\204'\323\204\247\240E\203)\230\353j\333\356\272\005\263!(\345\266\016+c\343#\225o\310-UG\2415\375AZxz+\320\230;\310\203\370[<\306|\007\036\366\226\245\306\301\240\332\367\247\t\332$\003m"
+	.string	"l"
+	.string	"l"
+	.string	"(\034\263o\245y)zoUl\364\250T\037/\255\335\333\025\032\250j\235\335\333"
+	.ascii	"1\320\027U\302\275\025\340\002}Y\317{;\240\b\205\211po\t\250"
+	.ascii	"\260\301\254\025\274\324\274\267\005N\2401\252\005/%\357\255"
+	.ascii	"\201\022\267\230U\346\336\036\020qs\2406\270\267\b\316\322\335"
+	.ascii	"\366\205n1\242\244\016S\202\202\322k\270\005\362\322\322\275"
+	.ascii	"\355\243\356\322O\007\362 \037r\"G\272\221#y\222/9\223;y\322"
+	.ascii	"\241\250.\205\301M\t)\b\303\205\007\375(8\013\214\356\023\333"
+	.ascii	"U\213\356m\251\t\316=\275\364C\367\026\200\222\236\026\241{\313"
+	.ascii	"\035\311iYw\274\364\037\356\255=KWD\346\242N\360\322{\270\267"
+	.ascii	"\235\020\233\313z\016\367\326\364\243'\365\r\267\307-\265>\303"
+	.ascii	"\275=\351\260}*\320\275\r\260S\227\260\026\327\261RAH\003\226"
+	.ascii	"aFu\016\315Qd\271`\031\325gjG\246\303C;orf\262\037\036[\355;"
+	.ascii	"u>\036\031\316\354;k>_*A\323(\344\324\276\037\032\255\366\251"
+	.ascii	"\364\fh\212\261\322\2251\252\017\342!>\342$>t\023G\361\024'\372"
+	.ascii	"\212\263x\213\2778\214\313\370\214\033\275\306o|}\216\037}\307"
+	.ascii	"y\334\307KMf\233\026\3712u\310\302\345(b\326\251\313\222\034"
+	.ascii	"k\262\251k\262\f^u\035\262p9\212\230UC\256V\332\006\307\360\213"
+	.ascii	"&{\035\216\246I\346\031\363\324\341\330z\341\256C\020\347\226"
+	.ascii	"I\222+T\2732\0163\214|\235Z\006\223\243\355\2258b\260kq\004\271"
+	.ascii	".] \327f\271\342\032V\272\270\016!\330\2148\343( p\343\266\r"
+	.ascii	"\223qZ\242ht\036\311\331l\274\3155bfR\232\211%\371x&\216],\217"
+	.ascii	"\263\r\bDd\027\316$w\353Lf\236\211\314e\262\265L\266\376L\372"
+	.ascii	"\326\222\3075z&\231\313$s\231\334\326\035\231\004\334o`E"
+	.text
+	.section	.gnu.lto_setArmingDisabled.15.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"\255\b"
+	.string	"\226\320<8@\305(\035\365a\311\235\250\360\230L\3466\031K\342J:\272\244\322\257\273\376\251\377\r\321\315\265pe\331O\1772\235a\346`\374P\006\034\211`\374\274\b#D\310\2262\245+"
+	.string	","
+	.string	"+"
+	.string	"\030<Av\314\236\275r@1\020\340\324j\331\335\250\035\367\236\236\377\221_>\024\351\031\340\260\273\316\017eq\353m+\330n\260\255\022\366U?\324tf\372\031C\206\301k\267\342\005`]\030\312\207f\373i?\344\"\336U#_v7RLvW\013\306\b\034KxA\366\251,m},P\257\251?a\230N\362\222\221\357\341\220(\377\035\363E\331\261\253v\302\002\321(\345\313^\221R9\354\303\335]k*\234L\304\006z\303p:\233\017\267Ah<\035\320'\324\305m\023?\235\214'n\335D\304 \230\223\320t\021\304q]\324V{\270\232\362\303\205\253\244&\007\f"
+	.ascii	"2\241\325/0.\020\0047)&R\031bQ\366\021L\271\004K\254\246\204"
+	.ascii	";\274h'\031"
+	.text
+	.section	.gnu.lto_unsetArmingDisabled.16.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\375\b"
+	.string	"\226\321>7@\217\322\001P@\206E\313\203\223]\353<\240\214\371z\367\226{\356\356\314R\353\177Cts\0260\030\366\257\217\234,\0032\3113|\246\277&\205\376\257\376\204\020)S\n,"
+	.string	"/"
+	.string	"."
+	.string	"\317\260\007h\317\374\331(\0171\366 \017\250\326\312\356F\275\370\367\374\374w\034\003\246J\317K\302\356:\301T\304\255\267m`\033\3016K\366Y?\226i\325tf\372\027m\242d\300d\027\342\325\262\256lD#c\373i\177\343\034\337Y$cv+HDv\303\003o"
+	.string	"\317\n.\240\005-P%\365\252z\224\352t\217\177\220\374\f\213Fy\360\231?\322\236\245n'*L\257g\251RP\022\246|\331a)\325\302>\266\273k]\005\035\r\003\0073\267u<\034P\307-l>\236\020H\344E\216\023A\036\315'r\236C\334\b\3345l\274\030\352:/f\302=\266\272\262\002\205\313\244'\253\206h\r"
+	.ascii	"2\241\375/0.\020\0047)&P\031:*\033cZ\020`\326%,b5\032\334\345"
+	.ascii	"E;\311"
+	.text
+	.section	.gnu.lto_isArmingDisabled.17.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375 \375\355\006"
+	.string	"r\31504`m\322\001@\203"
+	.string	"'\354g\3502+b`\265*O\372&=\321\026\320\255\241c\007jW\343\252"
+	.string	"\337n\016\202\250X\0275ACg\364\352X\023B\244L)v\225\006\353r=\267`\301X\231K\003\233\273\264\313b\3004\007\037Ze\300\317\301\002[\346=\330(q\257$U\002\217~\354\033TW\325\203D>\357\270\207\306\3070\304&\237\235\3627\325\251k\300\310\223%;vR+\354O\273\273V\222\355\264f\372S\245Q\""
+	.string	"\262\033*\235,\t\025\222a\233cS\214\220\3001\366x\021:\305\b\364a\262\033\233Z\034{b\3769>mH\214d\242\316\023@aw\235\231(\342\326\333.\260}`{\"\b"
+	.ascii	"2\001O8c\216#D\250@\346\032\275\204\310\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_getArmingDisableFlags.18.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375 \370\315\006"
+	.string	"b\21503`m\322\001\300\016\200\234P\206\215\343\2515xW\025S\020`\272X!\232E\275\013\260\324O\007\300\267\374EQY\260h\202\271N8\231\370e\311\336R\246\024\236*\n\324\245\262&\004\013\206\312T\r\027\234.\260\242\0220p\272\030`\205\300\326\202\345\202\031\313\272`\024\367\372I\225:\372`\337\343\021\3631\354\240\311g\177\276\006\372K\005\230\350\344fGNj\205}\267\273k\375\330N\247B!$\003%\273\021\333\311\216<\221\f\333\033;\3627\316\2611\346\342\205\026}P@\200\230\354F(]"
+	.string	"\372s\017\200\376\324\342\330\023\363\337q\247\341\3312\215\363\244\034\354\2563\323$n\275\355\002\333\006\266=\001\007"
+	.ascii	"2\001\0238#&\016\345\256!Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_enableFlightMode.19.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375`\034\001M\r"
+	.string	"6\331ZC\020\221\223\016\023@Sr*0\3100HS\352\017\321h\020\232J\3509\377=4\260\021\244\202y\204\264\177C;\305<\232/\262\024\353\241\236@)\002E($*"
+	.string	"1"
+	.string	"\021\335v8\324{\211'{K\231RG"
+	.string	"D"
+	.string	"D"
+	.string	"Zv\"6X\036\211M\305\306n\207\021\270\001\3531_\300z\324\020\327\01655\377\336a\312\311\013w\"\035\232\\\241\346\205j\033p2\301\016\224\207\325\275g\206S)\023\200\203\335ur'\016w\274\355\007\266\033\330/\t\251;j:5\375"
+	.string	"V\214\013\202oW\303\027\263\252\330\242\304S\277=\362=s\370)\355\332\226k\363Rh\354v\t\036\315\340\312\264\237\342*F\35708\263\013\"F\313n\267\300\233\353Q\003m\373'\216b\344\037\213*\212\036(y\361f\230\022\306\251,\347jD\275\246~3)\345gK\257\021N\\l7\256\362\025\315\037a\221\221<\367\350\217X\217Q\325\005\206\211\016$\371\331\035)\025\305>\\E\331Ng\336\375\326\003 \034\b\023@2\253\202\210\363\201\356l(x>@YG\202\307\307\023\002\022\ta\235\017\f\344\341|\260NH\204m:\234Y\360\ba!Y\026\3028\272=\\EeTC\242%\263\310\250\256\220\261\202W*\270}A\224\347,`e\2452)\3510\037\002\027"
+	.ascii	"2\241')p\206\303 \270bp\2451\3626*\341\016\027\270-\2061\n,Q"
+	.ascii	"\025\017_YcQ\355\271\220C\334\f\"\315\032M(\226S\347\240]@J\240"
+	.ascii	"U7M)\024\024"
+	.text
+	.section	.gnu.lto_disableFlightMode.20.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375`C\001\375\r"
+	.string	"\226\232^D"
+	.string	"\221(\035{\215t!G0\251\201\312\227C\023\021\323 \367\245)l\275\215E\2370_\354M\324\232\265\206,\020@\274Q\254\274P\341\223'\322\377/\271\022\302\031\361\001\352\005\3361\006\245\221|B\266\224)\005L"
+	.string	"G"
+	.string	"G"
+	.string	"?q\024#w\t\246d\300\302\026o\005\307.\270\t\370\007\366+?"
+	.string	"\373\245 \336=jv\376\303G\025\024\031\037\212\364\270\341\032\r\260^\334\b\200:\305\217\023\021\337\303\347\005\224)3\303`w\235\037J\303}\335v\003\333\013\354\223\b\326\034\3743W\335\230\246U\323\251\351{dT^\b\324\330=i\351X\227\013\306\210\253~{\344\207\326|U\227\355*\363B\027\254]\360\300/+\3102\355\247\270\212\321A\013\006\260\333!\306j\027L\340M\366\013$\332v\232\302"
+	.string	"\023\3168e\2141\275j\352Tm\361\317F)[\252z/e\312\226\257\251\3678d\364\372"
+	.string	"\205\305\333\361\225\263\350\374\020.1\311\177\277|\023\354\027\246\372\002c\"U\312\226\r\222R?\330\217\253\036lMk\316#\034\007\021F8l\202\210\363\211\356l$xD@\\\007B\310\307C\002*\tm\035\221\r\344\341|\266NH\264m\n\230\243\020\022\332H8.\264i\340\336\326(HIMn\321\250\256\240\221#f\211\340v\005Q\376\263\007K\t\227\223\222\236\022\303Zi\207i\001\032"
+	.ascii	"2\003\302\260\273\t\t\201\260\203\253\234\221\267Q\022\340\300"
+	.ascii	"b\266T\266\363\275\265\226R\210`1 \030\246\203\001\251L\262\250"
+	.ascii	"F\\\0301o\266\221f\267&\024\313\251s\320. %\320\252\233\246\024"
+	.ascii	"\n\n"
+	.text
+	.section	.gnu.lto_sensors.21.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\275\b"
+	.string	"v\221>80\305*\035\200\313\026\024\002;Mn\001\251#$\206\223\241\350\310\225\025\265\006\351\2645wW\324\306\210q\361A\004fFD\200a\234\315..G\255\310\363\372\311\336R\246\024/"
+	.string	"."
+	.string	"+"
+	.string	"\002\330\241\023H.\235\263X]\202$\365\001`\227\213Z\361\322\263\344\237\343\357\004\002D\3052=)\n\273\353T\261\036n\275m\003\333\b\266G\002\232NM\037\243\274L\b\272\335U\027`K\340+\3036\311\266\330\316\264\257\361\r\322]#Wv#0Bv\271\003c\002\016/\037\300\016\337\003)\021Tv~zM}\252\205z\307=F\376\205C\242\274\352\320\027a\207\327J\353\224\235\315\231R)\354\277\335]\353\204\341]\377\013\r\237L\3479\3030p6\036-[\320t8 Oh\213\331&z8\231N\314\266O\304\024Xs\320l\021\244i[\264p{C\275\234\024e\177\204\245B}\t"
+	.ascii	"2\003\302\260\200\341H\204\262\244\313(E\215\007t\004\274\b1"
+	.ascii	"L\327$\003"
+	.text
+	.section	.gnu.lto_sensorsSet.22.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\305\b"
+	.string	"\306\220=90\345(\035"
+	.string	"\276\353\016\307\326\336\2650\242\241>\361i4[\354\r\261\203\315\270\203\266\217\375\001\325b\202m\220\261\241KI\001\001I\005\314"
+	.string	"\306\260\036\322\217\242O\366\3362\245*"
+	.string	"-"
+	.string	"+"
+	.string	"\002\327\245;\233\345_\306>d\3454\362\262\273\023b\274\273v\376?\236\361P\244+Faw\255\036j\342\206\267}`;\301\266J\177T\265\252\372\027\306\004\205 eW\242\025`Y\262dCc\373j\277\343\036\335U#gv-8Hv?\004c\001\227\006\037\270.\343\003\367Z\"<T\370\023\205\351\253\203\214|\rG\210\364\336\245/\272.\017\345\312\005@EI[\366GRxa?\356\356\032\246\354\253\002\016\240\215':\303\032\264\316g\313\0308\036-\364\201\340f\326\231\037m\343\231\031\007\232X\201\267\007\0167C\333\306M\315\267\217\013S^8a\225\240\311\nE\002\f"
+	.ascii	"2\241\333/0.\020\004\027)\036R\031bQ\366\025L\271\004K\254\246"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_sensorsClear.23.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"\005\t"
+	.string	"\266\221?9@\305(\035\340\2717\021\203\273\\R\214\t1fL\362\035\244\333\321/\b&\360\223\372?\342O\317\302)\033N\374\311\204\0316\236\3461\031pd\345s\273\376\321>\331R\246\024,"
+	.string	"/"
+	.string	"-"
+	.string	"\317\340\005,\317\334\331)\3772\366!\260\324\blw\243b\274{v\376=\216\361T\246\347%aw\235\236j\342\326\3336\260\215`\033\026\366]?\314\264f:3\375\313e\005EC\262+\021\013\260\257\314\204#c\373i\277\365\216\356\256\2221\273\026\255\222\335\357\300\233\200g\005\037\260\004\251W\325\247V\250\214\331\3778H\311\337p\004)\357=\363I\226g\251\004\032+\250\327\205\212\223\024\305)c\366gJ\275\260\017ww\255\254\016\"\016\bZ\3334|<\241Mc\350\200>\243\020\004\0275O\f}8\240\250q\242\270\321x{\350pq\264m\\\314|{\270\312\262\002\200\327IQV\025\271\247\022\f"
+	.ascii	"2\241\371/0.\020\004\027)\036\201\312\n\230\026\004\230u\t\213"
+	.ascii	"X\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_sensorsMask.24.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375 \370\325\006"
+	.string	"\"\r03`m\322\001\310\017\200\234\320d\263xj\r\336U\005\001\303\nw\254\020\315\242\336\005X\352\247\003\340[\376\242\250,X4\301\274~Fd\275\352\275\267\224)\005\2160\n\222f\242\"\204\314F\342L\r\025\2144p\222\02260\252\030 \306bj!SA\016EU\260\022\367\032J\275\200\364\301>\310\243\345k\330\241\223\277\356\374\316\273K\r\240"
+	.string	"ef\307O\352\205\375\266\032\262\235N\025\220(\261\230\354Fd(K\342F6l{\354\212\337q\017\217\255\0263\260\027\222\002!r\262\033\341\345\004\357\256}\340\335)\306\255\247\345\377\343\215\303\"\273\260\317\023\340`w\235\0276q\353m\027\3306\260]\021\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"\365\004"
+	.string	"\242G\034%\2407\035\330\367\377\376\370\\\374\025\372\365\245\263\237\377\253\377\377\245\035\373n\"\"\264\324DD\304\366\313\277\245L\001\016\\\210\013,\002y\256a\003\021Sd\216\247mw\355Bf\235\200UB):5*}\220\321-\350U\266}\214>\247\234O\351C\263(siy\244\034\312\344/\233\215\327\n\034\265\235\210e\330\267\037\t\004\354\356\272?i\033\r\001\021"
+	.ascii	",\033\332\262.\303\345\007Fce\327\260\301\365\f\235\001=\300"
+	.ascii	"k\256,\002\350\001\257\331`\021@\017\360\215\235\037\021\241"
+	.ascii	"U\031"
+	.text
+	.section	.gnu.lto_.refs.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375 a\365\001"
+	.string	"\342\304\013\020\260%\351\f\3030\245\266\265\335\310&{\313\224\002z\t\330\251]9L\251\205y\031l\221\212!\016\322\241\235\0242\262\363n7\345}\235\032\b\004"
+	.ascii	")A\2119\233\022\327\273\346\030"
+	.text
+	.section	.gnu.lto_.decls.f0a880002f765dcb,"e",@progbits
+	.string	"(\265/\375`\204\016\005H"
+	.ascii	"\312}8\033DP^N:w\343\004<\355\021\315<\310t\367\203\246\003y"
+	.ascii	"\023b\310u\306\223eF\264\333\312\025c\333\3650B\312z\212D\242"
+	.ascii	"\304\034g\027@\003\023\226\006A\016\304\3521be\"\216Q\252\213"
+	.ascii	"\311\344\211\2252\005g\001\244\001\255\001aH\314\264\256\256"
+	.ascii	"{\301\nt\335g\322.\353\336\236\312\251s2\245dP\242]\027i\332"
+	.ascii	"\355\321&9\355\372\2155Yi\322\355r\335{\371\016\233\346\004b"
+	.ascii	"\247U\016\303t\3342q\335\331\216\305\034H\331\336\266\235\020"
+	.ascii	"\306E[E\342\245\265a\260g\246uXX\310Lk\023\313\t-\333#!8w\216"
+	.ascii	"L[=\0136\216\277\020u\241\361\362\246\325\207`\343\330\013\313"
+	.ascii	"\307G\t^\253\237\300\376\334\245\251\210\017\234+,pL\354\362"
+	.ascii	"\016\f[K\231\215\243C&\027\364N\357m\223\200\242i\264([\345-"
+	.ascii	"\334\306-G\177v\343\267\253o\320+\275\267-\032*\207\344\321\265"
+	.ascii	"\332\200\227V\225\225\3263\227\007\030\273\033\336\354\271i="
+	.ascii	"\342\246\365-/\255,+\255\315\204\203@?\353a\023q\002\333\374"
+	.ascii	"l\240\004\223\370/A\350g3}\352\317tm\342\336\362\326x\304\177"
+	.ascii	"\246\377o\353\317R~&\372Y\304\317!~\376\360\263\207\237\237~"
+	.ascii	"\336\3603\206\237\211?[\370\271\302\317M?3\375\034\341g\b?7\370"
+	.ascii	"\231\301\377\244\277\021\374|\340\347\001?\013\370\271\350\347"
+	.ascii	"\377'\374?\370_\317\177<\377\003\377\003\376\377\373\337\367"
+	.ascii	"\337\315\377\2743\377\305\374\227\373\377\345\277\227\377p\377"
+	.ascii	"\245\377\243\377\013\374\307\373OTXXX\370\363\236\237\355\374"
+	.ascii	"CZ\001i\344\214\361\"\347\374\307w}F\206N\017\314\337\330\326"
+	.ascii	"^\030\013\007\016\367\005H\013\002\023=\022\310\3121\351\223"
+	.ascii	"\3257\r\002\\\303&M\253\357%\313\206\r\273I\321^/&\003\333z\266"
+	.ascii	"\035!\022\273\013\236\335\360\236\220\224)d\\\255\362^s\033\346"
+	.ascii	";\357\261\036\321\262\345=\365^%\263\003#f\007@d\240(\243\253"
+	.ascii	"z\376\303\236\351\260yy \242[\201Fmm\033\026\032\366\214\206"
+	.ascii	"\031\357\3342\036OS\230\350\343'\3606[\n\347.\354\231\247\353"
+	.ascii	"y\f\2239\227i\271\f\237a\260\233\314\303\340\255OKp\317\005\003"
+	.ascii	"k\002\300\367&(m\225\317\374\0306\034\220\350^\266{o\002.l\003"
+	.ascii	"\247\246\325\013\362\224h\312\030\326\235V\317"
+	.string	"L\366\375\257W\331\274\367~\001\265\267yE\2642\020\027\361\220\037\334\341\217\374\334\353\305\206\207\235B\2474\322\352\377\006\027\313\275\311\244\333\336&S:\226d\302\3559\223\332+F\340J\313.\263\035s\252\320\333\267\275|\227cN\035\314\026\332d\266\320$\322]B\223\367\266N$\346T\231d\246t\314\311\224B\235Iwy\223W\252\024c\227P'S\r\324\211\304\224*\235\314\345\2303\351\007\033\231\037\363\316\336\223\2450\227\367G\327S\331D\322c\266\320\353w/O\263n\363\301\275Oh\323OI\204\353\256\364~\\\311)\241\334\336{\rt]\221A\357R\217I\005z/\225\253\032\267KC\262\325\273MX/Y\366\274\\Y\367\036\350\2727\311W\357\336\233\274\367\0065\237\355\275\001=F|\223}pR\246\245\325a\213A\207\260\232j\260Z}C\377F\322IZ+\306Z\030\005\017W\253\257\343\245\025"
+	.string	"+\255\375$\276\217\f-\203|AkU\210\225\326\006k\260\016\34370H\362\354\271\027\254\351H\354\336\361\351\"\357\260\003\002\255\211i\211\364\027\020Y\2369t\321!C\372\353\303{\221lI\033\232\205\341\201]a\337_\334A\332\016\322_\005>\250\265\005\032\235\261\253\253\363\204=\367\327\332^\335\344VA;\213\376d\3713\330\352\207e\354Y\301\312\205\254`=g\341Vr\333\312\356J\321\336d\00790\nBK.!uZ}w\375}\325\313\346\"\202\336\273\274\367\022@\200\266\247\325\\\275u\264\026d\311\223\226M\310n\260\212\220V\233\331>\336Z\335c\230|k-\r\320{\225\255u\344\347^\345\021\263\003f\007\252\026\262(_V\365\303$lc\021\337YJk\023\254\275G\354\2372?\232\264*\200\225V"
+	.string	"l6d\262\205\205}\003\020\026\r\331\213\242\326wn(\347\212^\024?\204\204<\310\"\335+\276=i\\\306/\332U\207\345\303\207\007\331\350\337\326S5\243\234\343\325\347<\250\362q\201\343\347\206=\0132\353\321\303sj{\235-\342\266\236{\232\314\334j\307\016\343Y\263\022y\263&\213\357\234\361\024\t\302\351\265\315\255k\274\374\364\231c\003\003\371o\310'\267\365\3042\224\3055][c\317s\230\001\317-\003\362]\267\r\270l=\261\334\346\031\n\254\022-U\350\234\260g\276[\343\304\341\277\356\022E\013\\\003\257a\301\251\312H\340\230\243X$AUeDF\341\260*aU\314Q,\312 0\204\214B\036\001 \2418\004YE\325\220R\217E\034Q+\006\3308F\251\030\262\212*\336(A\204,\272"
+	.string	"\340b\206\321\321\252\352HU<\006\315H:\242*\"M-\335\250\252\"\001\005t4\"Q\355P\np\006\257\312Q\264rBVUY9\r\315\030\201,\036\223.e\264*R\025\247\330kx\252\360\304\201G\3209t\270\320\341\302z\016\035\210\304\016OD\366O\304!\022\352\211\210\204\302\220\001Ie\334\301\316\250R\201\2541e\274A#\251\bu\234\212\272q\242xCF\324\321hb\212\312\210\303*J\300\211\304\022\r^\254@\301JY\2302\322\240\252\222\202*\3420\"\251vX9I\321p\2422F\341p\222\262::YX"
+	.ascii	"\307sl\034\240\336\226\264\303\214\366\244y\343#z\267\022\301"
+	.ascii	"\032\004\363\306S\343^\335\227[\253\n\272\311\003\322\352\273"
+	.ascii	"\375\233Jsy\023\306\216Y\253\034xi\355'\304w[oY\302<\333\302"
+	.ascii	"6\004\313\255H\253o\266\277\265\364Z\321S\255LI\253\327\343\245"
+	.ascii	"\225\b\013\361\235\005\250\b\236\230\223V\207\256X\201rJi+S#"
+	.ascii	"B([lZm*\304w\225\005sd\354Z\r\232\242\326\327EM\\\253o\265\277"
+	.ascii	"\317ZJ\230<\270%\2556\271\021\337ijY\036/\265(h\202r\310z\264"
+	.ascii	"\372F\373\373ICa.\307\250\264z\201\227\326\365\214\370v2\364"
+	.ascii	"s\332\ti\025\250I\233\2711\363|i\365m\366\367\263\231\020\235"
+	.ascii	"\t\001\302\246\325O\327\210\357%G|t\202hJ\312\302\304\224t\231"
+	.ascii	"T(\214\331Y`\253\001\201\031\250q,\207\0205\206ddDD\222$I\007"
+	.ascii	"Q\005\204 \b%\265\r\021\020)\264J\210\024$M\n\373\034)\211\340"
+	.ascii	"@C\233\230u\\\332\002\332\243UY\213\304\037\020\t_i\243\213\304"
+	.ascii	"\360\351\244}8\310\331\373=\262\323\330\216\200m\004s?NI\264"
+	.ascii	"<\365\2234>\251\032\231\\N\361\226<\252\027\336W\272\213\375"
+	.ascii	"Sp\303v0\372X\032_s6\027\230\306a:B\316_\232\017\202\021N\320"
+	.ascii	"2j\315N#q\031\244\371\177,\037\362xw\205J\343q\373\177\217P\230"
+	.ascii	"\007\317x\374\331>\314Q\f0\352#9\007\030\240bh\370hx\235\034"
+	.ascii	"\021\331\221\344/\263\364x\212\031\231\3210:9\275\211\212\230"
+	.ascii	"\3175|\332\262v\315-<hl\324\262\024>\005\203\3320\375\267M\317"
+	.ascii	"8\214\224\200n\321\322\322\3127\265\235\330\202\354\247\361\310"
+	.ascii	"\276\n\003\352H}\244g6"
+	.string	"\032\"\332\305i\351\305\255\206\200\030\276\247J!-zJ\216\261\376\363\353\304\374\222 q,\360\360\243\021?>Q\320\301o\336\374@\232\006\347\354\\\261\025\330\273F\203\266\220\nD5\370w*\200\302Y\230"
+	.string	"\275z\324C\344\240P\312\221p\001\004"
+	.string	"\034<4\315\265\320\375Je\203%\004\2638_[\310\330\210\256~\213Fj\f\320\367\301\251\233\232\202z\316\231q\364\306xi\036\272I\321\007\331\310Z\207\005\210\031=s$\310\030\030\233P-\r\347\022\267\250G\242\2760# H@a\322\225\356v\365\376\367\364\\\276p\205V\t\004\235_G\274\001\0071u\r\212/I\315\237\211\233\307\235P\236tQ@\312@@\t|u\211\372f\365\263\352\3146\375\363(\364\02281\240$\215|\241\344F\205\235\342k\372\261\003\332t;\244\3325<\346"
+	.string	"FM\202\340\304\372@.\234^\360-\347\222\367\rvI1\366\226\276\340\261c[\2057\306{\035OUO\340m\351\211\274\255\367"
+	.ascii	"\356$e \363E\200_\361\302\207\311\nx\334S\031X#\333\207g\207"
+	.ascii	"\242\247\346/\367jl\214*W\343\375\001"
+	.text
+	.section	.gnu.lto_.symtab.f0a880002f765dcb,"e",@progbits
+	.string	"setArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330"
+	.string	""
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347"
+	.string	""
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"sensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"sensorsMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f0a880002f765dcb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
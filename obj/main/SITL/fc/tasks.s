@@ -0,0 +1,1356 @@
+	.file	"tasks.c"
+	.section	.gnu.lto_.profile.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375 \263\375\004"
+	.string	"\264\b\247"
+	.string	"\017"
+	.string	"\354\301\314\336\005"
+	.string	"\001\314\345\244\232\005"
+	.string	"\002\223\317\352\353\001\002\002"
+	.string	"\002"
+	.string	"\004\215\252\323\020"
+	.string	"\006\275\236\357\212\016"
+	.string	"\007\314\362\222\226\013\t\347\230\200\264\n"
+	.string	"\n\376\376\316\323\004"
+	.string	"\013\376\303\253\241\n\016\305\352\265q\017\361\314\370\272\r\b\002\001\002\001\002\003\002\003\020\240\342\234\212\n\023\207\311\252\341\017"
+	.string	"\024\216\362\225\376\013\020\002\002\002\004\002\005\002\006\002\007\002\006\002\003\001\002\b\002\001\002\t\002"
+	.string	"\002\n\032\203\260\250\341\t"
+	.string	"\007"
+	.ascii	"\335\345\257\030\300Yji\032Oa\335y\313\006\332"
+	.text
+	.section	.gnu.lto_.ipa_sra.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375 \353%\003"
+	.string	"$\002\337"
+	.string	"\r"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001\002"
+	.string	"\001\004\001\006\001\007"
+	.string	""
+	.string	"\t\n"
+	.string	""
+	.string	"\013\016\017"
+	.string	"\001\023"
+	.string	"\024\001\034"
+	.string	"\271\r\240\334\317\035+\004\252\332\320R \250\001H\003\251\270B\020\370$5"
+	.string	"\342\\B\300\334&\3028A.\027\206\261\311\007Z&\0257\316\332\316\t+7@\031\350\264"
+	.string	"s\270*\374l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375`\272\002\005\n"
+	.string	"BK(/`M\323\030\324\002\326c\220K\201T\252\321\200S\036Rt\260\177\344\006OL\r@/\376\273depI\222$\020\364PG\032\005iK\244\334)\247\223r\342\"\313@`\310I\210\005\345\246\017\206\261c\242\210\274\rtd\323\254\202|'\345\306\204\362@\360\200~,\360\372CK\334]\347\347]V\301*\3477\214\237\321\222\030\027\004\305\333y\027)\307\246Y/=\250\b\t\350\246\231\371a\fP\215\345%"
+	.string	",(H\005\253\236s\030\237T\320\212\335\225\354>\231o\330]\207\317wQ\356\356\352C\353\025E\250Q*\022\t\204\0264-\255\001P\242Q\322\325\003\021\2000*0\214)\"\023\320\210\242\224\030\334\f\223$\250\333\350P\314\030\220\2432\312k\030c\375R&\013m\363\030\177zz\224d\277\351\343\352\306\317\016\355\223a/=Z\373D\025 /\250\206\177~.\021\221\236k!\233D\226e\312\203\332\2361\266\023\250fE8\374&\341\257\036l,FDXY\254\202\321~9:\314\301r\013\036\262\352\001$\262\017\245\3429A\364`'\246j.\223\201&1\343\035a\0266\\\272R"
+	.ascii	"\024"
+	.text
+	.section	.gnu.lto_.jmpfuncs.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375`\327\003\235\f"
+	.string	"vP2-pi\222\016\374\273z\033u\tKI\005V\202\254\252\302_\274fz\006\352\177\314\372\337\343*\tU4Z\200\365\333\337\315\332\337m\023\231d$"
+	.string	"\""
+	.string	"'"
+	.ascii	"\r;\030p\006\036 \364\205\233gf\334\3152#\313\250\252\252j\303"
+	.ascii	"p\303Lr\262B\275?T\362\t\241U\004]?9>\271\376\221\220\331\225"
+	.ascii	"k\371H\322\005W#\351\240C9\324\226k\243\375\233\276\334_\256"
+	.ascii	"3\241\007\235\332\002\201\374p;\305O\\\313d\256"
+	.string	"\\$\"p%\222\243\b@\"\tuZ\0371\262\304G\034\3205M\271\247H\001\344\037\306\265\001\005\314\223\213\b\252\352\316q\034\016\tEQ\317\363\275\270m\227\305\265\265\314\232\246\321p\256\034\004=\036C\334n\2501qS3R\222\024*\313\030\300\302)\263\016\022\240\260\213\320(h\034\251\021\tR\n\245e\337\002\313\226\2721x6R\321\241\312\274\016\230\227~P\221\202|\3311\204JB\252\271\277\206?\177N_\210M\216Q\231\017\310\371a!\205\302\277\306\027\350\215\300w\247\247\360\242\215x\266\257M\376\352Y\340\001\202\362\030V\350\007\022\023\r\025\025?-c\302\220\215\323K\tc\275,|E\311\261eH\303\342He\210\222\251'\204/\372F\264\211\320\002u&aq\306\243\323q\206\350\322?\343\023\264\202\3026\220)\032J\2541^`H\310l\367N\327\223Q7\313\t\316\001\020N\177FvOe"
+	.ascii	"@\277\235\320c\205Pe"
+	.text
+	.section	.gnu.lto_.pureconst.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\200\004\001\230\004\002\230\004\004\230\004\006\230\004\007"
+	.ascii	"\230\004\t\230\004\n\230\004\013\230\004\016\230\004\017\230"
+	.ascii	"\004\023\230\004\024\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375 \341\265\003"
+	.string	"\"\305\020\034\2407\303\001\377\377\377\377\377\377\377\317\374\377\377\377\377\267\236$\221\334NjB\266L)\212\304\374\331\"\346\207\271a^\030\2220\037l\005;\002\002\326v\315\325V\r\351i;7iQ\022\021\rw\267\214\213\025"
+	.string	"CS\304@\276\225\305%\020{*\300\232Dw\341PB\300\035N\313\204\026Q\302>PXP\245\261\220\006\250\201\020\233\001"
+	.ascii	"\202A\326\033\300\002"
+	.text
+	.section	.gnu.lto_.lto.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_taskMain.118.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375 \362\235\006"
+	.string	"\242\214.2pm\032\003\240\237\323?\006D8\002\206\207\241\003\005C?\0137\206\232H\b\364\246\021\273(j\313\250\030\370\353\003+U\305\372\031BO~\267$R\246\024\222a\362t\026\252\317\024#\004\f(\334H\007\311\251\036lx\237\016\307\363`\224oCP\352a\212\257\242\250\3702\327\335D\325H\264\211\366\002\261\226\321\332\362\377m\242\226I(%\005#\177\305\212\312I\234\bG\246\255Y\353\016{L\177D\024\363_\214B\376\013\241\007"
+	.string	"v\032\017\\\354,\026\270\330u\266'\2766.a\230P\200\244\374\177M\303\323l\326\036\031\023\262@f\222\302\377\262\220e\3416\2675h\233\320\326\n\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_taskHandleSerial.119.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"M\013"
+	.string	"\206\324MB O\225\016"
+	.string	"\353\240\266\304w\022\222\235\031\306\375\224\246*\212\004\227\264\347\025\244\222\001\206\252\363#\034l@\bZs\367\330\263\004\035\t\t\026\260\n\3404\322\2713K\221\233[1\321&\326\222M\266L)9"
+	.string	"<"
+	.string	"8"
+	.string	"\273\233\314\360\3573\223\372\371\032\242\350sbz&K%\300\327J4]f\001N)\"t\210\244\254\342B\255\270\352\372@\004U%\227\335\265\206b\351\326n\233\200\355\001\366C\002\252\352K\n\260`-D^\273\020b1\2665Qt\240\330\276\332\367\360\017\337S\r\234\261k\301\004kw\024`"
+	.string	"\223\317\221W\264\317\354\037\332\247?\233\305G\r+A\301p0\002\266\001\024Z\240\024\235CxjI\203\264K\004\"T\220\364\205}\020\017\001\3627\230AH\037~\372!\355\363\362\252{\220\230 a\2441{\024\251\304`?\333\335\265\274`?\365\007\336\201\fGc\340\323\311t\035\210\3430g\3616\036\346\263q\t\266\216\006\303\331\270\316\333, \366(\310t\333\307\343\3516\312\270\277\214$8)jo8RO\270pU\310&j/\360\364\2417V\001\023"
+	.ascii	"2\003\302p\311\302Z\021h`\366\202.\240\326\005\256$J\026\\\025"
+	.ascii	"aW\322`\241\300\224K\260\304j\312\270\3137\333\223\n\263\242"
+	.ascii	"VA\001"
+	.text
+	.section	.gnu.lto_taskBatteryAlerts.120.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\275\013"
+	.string	"\346\325PB\020Q\234\0168T\353\021\242\240\031\034[s\234\223\267T5b"
+	.string	"q\025\372\267\034\260\026\351\312'\3357\"t\177c\030E\374p\256\255\002\310#dc\251H(\\\230\351\rN\346\251"
+	.string	">!\262\367\226)\005="
+	.string	":"
+	.string	"?"
+	.string	"6\214\203\037;\361\270p\0221cw\257\230\341\333e\324\315\177\352\024\357\343.-<\312\314\b\t\031\001>\223\274\2406xO])|\235\352$\301\356Z\275\257\302=o[\201\355\003\366\021\004\366\345\356\256c\207\255j\353 \377T\365)\225\025-2#vQ%56\234%8Xl_\355w\270\207\355 \023L\331\305\200Bd\0274\340\002\326'\201_\252Oy\001\325\247\267\216\240\351=o\204\234\b\273\310\375\203dD$\032SY\361\251[.B\2740)\211\177L\365hE\353\211\243\373\207\203\030\371\032,\201\244\367>}R\365\3718c\230\240\301Q\322\022\033\3444z\004Z\003\316\247\303@\004\342d\331\b\003`L\243y\264\215\350\302\034\\\240\316\346sa\231vi\0068\004\201\223]\242P(\273,\340^n\354\360\002\026a)v\017\264\212\n\213\316h{>\032\222\"4ENZ\352\023"
+	.ascii	"3\241\201(\006\210\243\\u\330\246a\254\232\023]\206\007x\023"
+	.ascii	"%\013\256\256\260\213\037\314\261(\373\n\246\\\202%VS\304]\236"
+	.ascii	"\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_taskUpdateAccelerometer.121.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"m\b"
+	.string	"FP<8Po\322\001"
+	.string	"/\266\267J\216\017\365\370\030\022}\344d\353p\221\026\2434\246\2725\304yo\t\304 }]\004\251\013@\242\334b~\361R\004\f\364`f\326\222M\266L))"
+	.string	"-"
+	.string	")"
+	.string	"\227\376\354\227\207\034\273Y}\\\230\300\354\356\214\033\377\256\237\177\221w\300\224\351\272Q\330]+\230\312\270\343m\027\330N\260\215\022\366Y\277^\036\231\226\003\226]\214\032\232mI\025\217\217\355\253}\220\207|gU\270\263\253\261\222\262\033\"\330\200sIp\001\354\362z"
+	.string	"\026\352\227D|\344$\235\337q\351\222\204\036\274\364\334.\330\245F{\202B\017ZObZ\026\321d\207(\215+\373\327\356\256\243*]\2036\0221x$\215\343J\031\2003P\367\320\205\274\2319L\222(4\232\031\327M\320\2007\b\215\233\336\266q\363\023\236~mTya\246u\212(s\002\t"
+	.ascii	"2\241\243/0\\(\033\025J\301\220K\260\304j\n\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.122.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"\305\t"
+	.string	"\326QC< \345*\035\340\304Q;b\004\024\226U\025F\200\341A\r"
+	.string	"\024i^\004\341H\344\264\320\326\260\027#\"h\315\327\205\316\022,W\002\250@\n1\013\005\363{AU\307\021D\310\336;\2450"
+	.string	"3"
+	.string	"0"
+	.string	"\273[\247\310\303\323)C_@,\235v\035\237\364`\3451\323\210'\272a\211\245\356\272\324\020QRf:\273k\251\0229\356\355\266\031l/\330\006\0201\t\260\335\215Z\200\215m*$\032\333\227\366Kn\022\276\225\341\200\335\020X\312\356\250`\204\356\333\346\005\3347z\002\356\233C\373\345\343\310fX\257\024\212,\257i\f\356\023\342\304\005%i\336\344\234\266\305\205\274\352\363\256w-+\0373\030\324,\331\343IN\226}\272\273\353\271\262\337\372\247\224~\346!&\013\240\303'\004j \211>\337W\341\r\330\343\200\022\240\207T\275\210*\002yB\325\373\300\3121\360h\342\363U\322h\364U\315hz\3074O\264\243"
+	.string	"\345U\246\247\201\324\002\020"
+	.ascii	"2\003\3020\037\302^\r\244\205=\241\032\213Jl\220\265\325.\276"
+	.ascii	"`\213\300\250KX\304j\264\270\313M\265G\003S{"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.123.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\r\n"
+	.string	"6SF=0\345(\035"
+	.string	"\270o\374}\247b0\0031\024\266\006\315\354\n\021[\335\206\025*(\033\206]\365\307\034\n\255A\f\266\311}\211\013MV\250,\034x]r9@\344\227\372m#d\357\235R3"
+	.string	"4"
+	.string	"4"
+	.string	"u\222\034<\235\022\364\377:'\024O\247\033\220O\252 k\001\360\361\322CLQ\217\252$\374\353\262CDI\251i\330]\313P\374\270\265\333v\260\315`{&\005\blLs1\261?\332\235wl_\332?9\nx\227\2069\273#,\260\335q\301\t\233k\b\367l\327\350\r\266k\006m\231\217\255\325\260\004p\250\004\330\335\255\231\f6\235\261}J\244\304\244\344\314\233\2447m\366\005\206|\3709\2602 \226\232'{<\311\311\262Oww=W\366]?\225\322\327\024\204\300\324\227]U_Dh$\202(\221B\236g\342\b\314}>\212\017T\252\334D%\211@\243\312y_\375\034\270\253\by\265\324u^\355\214{\272s\345\007\221\330\306DQ\216\264;\013\371\320\363\001\016"
+	.ascii	"3\241\367/\306\325PU\330\013T\363\300\013\353\336na\275\270`"
+	.ascii	"\251i\221X5-Nr\314+\361\fj\017"
+	.text
+	.section	.gnu.lto_taskCalculateAltitude.124.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"e\007"
+	.string	"r\31646@o\323\001\230NL7\214\337\204\0206\305\254\235B\317e\351z\177\267\034Q;q\202\240TP\233tD\320U#,d\374\345\245+[obh~|km\313\224\002\332\303\005\3728l\241+\313&\254\200Z\035-B\363l\321\202\210\241\217\007\024\255L\213\235\202b\022W\0267\f\313\"\347\273\251CR\033FN\027\020\243T&l)*\322^3%\344\224\001\273\366\353\022v\264\246\376\277\220\324\332d'% \322\262\200\362\213b`~\252V@8m\235\255I\\\302\331d\321\315\317\301\242\362\177\tE"
+	.string	"pe`\202\214+\312\003\031W\345Z\027\177\036\327\224D\032'/\377#,\231sr\265M\274\361F\235S\303\360\277\351\2156\\\350\266\007m\025\332~\004\b"
+	.ascii	"2\241a/\360\270\340\n\346]\002 VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_taskTelemetry.125.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375`\311"
+	.string	"\275\013"
+	.string	"\346\326RA\020q\233\0168"
+	.string	"!5>\202\366\306s\225\301\t@\007Y(\325F\241!\365\371vR\fF\250El\364\360\347\277\252\272\3359\255n\307\254\211"
+	.string	"\0240\206o\352\212(\302\233\301\376\367\357O\366\2262\245A"
+	.string	"="
+	.string	"?"
+	.ascii	"\377F\266\""
+	.string	"\002BC\013\035\273k\251\310\267G\250\271\371/\271\245\363\270\307\312\303\341\305#\245\302\002(/rd\274\fP\003R\242{\311s\203\367\221YY\260\273\316\316\343pS\267\375\300\366\001\373\b\002%\373pw\327\032b\237\344\217\232\316L\277\312\310\240\241\340\264\013r\332\261\246\b\303\304\305\366\323~\212\253\330N\202\301\226]\021.Nv?\003&P=\016\270\206z\204\017@=z\263o\004\251\037ab\003@V\373\017ec\026\362]*\204\020$\345\356\217\373GRPNTK\276F]#\230\324 e\212\375\025g\241\371$,\032\345\273G\177D=^\265C\f\024\037<\362d\177\\j\232\203\316\307\323 \004\352d\231\350\302\370\332h\0244N\310\272$X \017\347c]\231fm\004\030\253\320\311\254\020\206e\326\345\333\303\325\020\0063L\036\372\0211\031\325\236\340\311w\206\3129\201\t\307\t\250%\377\002\025\020"
+	.ascii	"3\241uh\340\254\267,\266\227\025z\201\305\201\034]\025Op\027"
+	.ascii	"\026L\271\004K\254\246\214_\036B\223Ua\271\352\230P"
+	.text
+	.section	.gnu.lto_fcTasksInit.126.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375`\026\t\225,"
+	.string	"zL\220\020EphU\007\223\347\312^\204\020\240!=\031D8!B\330@\r\214\226\223#\232\250\220V\377~\350a\025M3$\236L\f1\003#\202;\250RS\311k\207B\315\247\305\252\244\235\342y\236'\177\357\275wJ)\005\366"
+	.string	"\340"
+	.string	"\370"
+	.ascii	"\316)\352\214\276\363\277\263\273s{`\340T\036\301\"\363t\272"
+	.ascii	"\256TY\240\353L\325Hi\255\356\255v\346\356fsqm\353\250\351\324"
+	.ascii	"\312\022\201\355\224\033<h[+\007\201a\327\225\232\320|j\211\335"
+	.ascii	"\333\245\324)'`;\345\2269Owe\335\366\032c\004#v\357\005>V\267"
+	.ascii	"\355\353\t\361v\272\034\356f\253\321f\354\252\246\350{\313\275"
+	.ascii	"V\230\035\223\303\366\365\230P\\h\255\240\344\007\263y\250\203"
+	.ascii	"(\261#\035\206|\202\332\310\214r\272\n\322\211\357\230M\\\327"
+	.ascii	"PY\235\313\302\205!\225V~\253j[\325\021\257"
+	.string	"\031iZ\207!\2154W\027\250\202,\342\263\002J~P5\333U\220T\276\206!\211\324\222FWu\244\354\220FQ\237T\224#.\031\205&=\323\374\251%\213\376\270$\021%p\357m\256\366\035\311\242\373Z\341\336\313~L\376h\036j\346&23\007f\226B\257>\255\251\3078\b\252;\250\351'}\0132\256!nh3\035\310t\231\017 B\204P;M\377\205\362\251ln\0219\372\375\245\231E\214 \360\217\376\002\177\t\305\256f0\365?\005\323\261\205\350e\334\357\337\306A\314%Z\214\t\366\336\"\004\3560\355u\202\033J\247\214\"\205\367\261S\356\024j\247\3758\224u\224\315-(/Sq \305\2369\377uwPefj\221S:\243~\3105g\206!\303\373\310\27514cO\342\017\231\273\210\376K\346F\357/aN\2353\264V\363\257\267\232\223\336\031\351\235\217\336y\300;\013X\235\215X\347"
+	.string	"\253s\321\352\f`u&z\347\241\325\331\367\316\275\325Y\350\235y\253\363\016u\326\255\3169\324\031\267:\337V\347\332\352L[\235g\357\314\252\316\353;\253i\217"
+	.ascii	"\212\262\352;\250\332\324\bqF\375\320\366K\316y\356;\211\024"
+	.ascii	"\253\335i2'\221\343\336;\250b"
+	.string	"u\235\226\n{\357\205\300=\247\351\264M\332'-\263e\252\235\342\276\310\252\263\310\236hh\254R\277\360\262c<\263\376\372\350w\334^\205\002\357n\251Xi\257x\037o\277\242l\312\330\263x\364\264\032\222\250\037\252\263_\242\317\376\022\245\036\360\337\353/\331S\245\306\325\021\344\003\375\365\200\337q\2463|s\365\001'VX\353\247\237\341\331\215A\210^\306\2525\004\256\273\267[-*s\313\245mz\037k\277rAR\374!\312k\232Y\262\322_\366\203\305\271\302\203\376\322M\323\336\306\244\345j89\336\320\276\301\354\370\275w\370\277\344\256\241\316\036w\307\313\235\242\2231\263\205n\223\203\315\354]X!a\177\366{\366i\3152\r\352\372?\f\275F\303\327\372/\224b\352\263I\001L-\226\236b4\221x\232\301$\024\332\300pC\310\364\364\264t\201\311\311\306\216\203\f\234`8-=\001\203,\2003\\,\311"
+	.string	"\006\205N@\006C\334D\203I\b|jj\022\002k]PM\305\t\365D\316\271\200\317\031\275\200\036F\357L-N\335\225;\366\3649\220\0063\272\312\262\323\233)a]\351\210C\346\215\020\221\347\3208\217\306}q\031\240\272\352\303\373%\333mR\r\360B/v\212N&\345\3106\351>\\\252\005\"\244\235\232R;\r\360@&~\224M\334\227\226\035N\251?\016\325V\356\327HE\257\202-z\333\027\026'\322\337tO\272x\261\311\001\370\017k"
+	.ascii	"\337\200\034G\364\0376l\242O\36055\3646\337\017\241\276GRS\346"
+	.ascii	"\354}M\350{\n\234\025zo2\305\373u\367<\007\316\334\032i\253\274"
+	.ascii	"\217\273w\246\220\233\372\2008\307\236Q7\264\203*\217\210\356"
+	.ascii	"[O[u\237=\315\247Mr\325.\333\245\332\251.\200\264\250\201$d\035"
+	.ascii	"d\"\"#R\220$)4\006\240\002\021!\253y\0208\245\210L\222\f\007"
+	.ascii	"U\335JB\257S9-x\032Hi\270\003\365\325\207\212v\202\347\\)[\222"
+	.ascii	"\032\271\211\2634*[\2271\004\256@\b\245~s"
+	.string	"\027\017\261n\032\177n\377\216\212\226\020\n\033\021\026\234\230c\037\317Z\240\241\376|\266\330Q\035\320\210\006l\243k\255\036.9b}i\331\360\272\355\311\265p\356Y\310\344\361\327'\033P\364\345P\031q2\224|\361\204\261\273}[Q\220\260EKVBWW\r&R\023 \234\223\032c\205\022\342\350\252\237\202\377@\352\324\240\232\322\035\254\250,\243M\033\266\246\222\031\373\317.\373\372\231h\001S\341\0135\3400f\361\026GV\362w\325\311\301\205jrG8b\210\023C\312\022\236\001D%\363m2\302@\342gGDz\225\245FA\366r\003$\323f\250)\220\213R\342V\204\031\306-\352a\003H_giHur\221\220}\"\217S \027\260\203\013q\034E\027m\203\232~\336\207\360\333\255h\207\217\272)\333\345i\022\257\350\0333\314\035\004\304\225\n\036\n\005\272\f\225\007\237\330M\315\023\247p\376(\276"
+	.ascii	"\314k\007\251<\300s\276S\037\333\210\327\321GV\300\300\345\353"
+	.ascii	"\002U\373\241\021>\266\252\260\277\005\363\007"
+	.text
+	.section	.gnu.lto_cfTasks.127.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375`\334\005\225\034"
+	.string	"fk\252Jp\230r\003\373\272\354\263\375Y\026\004\220\322-\360\017)6\024\215\360\006@m\030\374,\220\3307\215\257\270t\0244\245\253'x,\f\026\246!qEG\215\347J\313\227\225\313\333\267\3111$\311\301\216\224\364x\232\356\022\016\226R\n\233"
+	.string	"\232"
+	.string	"\231"
+	.string	"\305\317J\343\246>%(\314\2208\"\020\346\325\3469~\326\256\233\002\360Q\367\037A\200\030#\374Xz?\3572\253"
+	.string	"<\352\336\243\215\r\331\263\332\257\204O\374\302\242\211A\323\221\266\203\201\317\217o<\231\032\312nV\367\263\0336~\222\253\215"
+	.string	"\350\307a\367\363n\261\327\270\200N"
+	.ascii	"L\331\357\272\207-\273XP\037c\366\031\027\232\007\234HF\r\310"
+	.ascii	"0\fxb9\235v\206\3256\020$\352E\033>k\367v4\247\347t\032\365\244"
+	.ascii	"\256\366'h\347n\276\256\366>\343\353*\227\343\\\315\013\313."
+	.ascii	"f\242\304\237\212\256v\007\253\372,\223\232\013\232\017\341\225"
+	.ascii	"\274\210\255\253\317\236\265\251\276C\355=,\275\215\364\341\303"
+	.ascii	"\310Z\355\236\025\324*\242\271\373[_\203\227\325\363\356xq\276"
+	.ascii	",u\337\363\034\274\363s}\257\325\356\321\257\357\240\013\312"
+	.ascii	"\323\226~T\224}Z\367*W\254t'\031\037,\366\372\335\251}\006\212"
+	.ascii	"\224(=\351\207}\240\324,\006\213\306$\257\311\037kW\233\310\375"
+	.ascii	"=]X/wuG\242$\311{\263\3325\374y\272\250\2367L\023\031p\256\356"
+	.ascii	"F\352\350\036\020W{BI\n\302\n\365O\2200)\324\024\326\024\340"
+	.ascii	"L\013@B\302!&SH\b\344\235F/\3538z\216\256\326\327\272[\177\353"
+	.ascii	"p]H\227\353E\272]?"
+	.string	"\322\361\372\222\356\244?\351S\026t\275\216\305\033\371#\017\302'\371\021\236\204?\341Q\370'\017\345\251\024\370\027\t\276\223_\233\253}\264\212\351\257\254\\\300A}6\272\347\237QRL?\325\342s\255lA(Z\324\307\321\322{\3363>\205\3223\325^\205g\301\364NM\177j=\013\256\350dR\237\225\246M\351|-\323\332/\005|\330\026c\225\023_zF\316?\376\322\355\320x\374\361!lt\341E\031y\243r\327m]\350\226\345;r\013\217[X~\347\037\307q\351\3268\303C\226\2777-\035\027u\350\234W\226\217\256\f\237i\371\215[\037\244\374\322tk\023\303\347\2715\022\213\356\312\213rk\243\362wx\244a:nY\216\224\351\227\370\306/\375\302_\027\326y\207\256\314\362\235\242M\021\316\201\215,'\266\257L\317>\306\231\b\344\311\232\346\262\3713$\f\200\211\2501`\311$\243Z?\n\315\001"
+	.string	"#\021\271\316\001\020(\206\246\206J!\035!\307\224\240P\341\300T\262\036\3341b\030]\205\367\022\006+B(\305\364\324\310\253\246@\272D\311\220ku\351E\034\360\f4W\245\363\213\b\212\304\306\305\262\222\nq(\\3^\274\017$[y\036&u;\365\367\027\230G\004\222A\304cC\355"
+	.ascii	"\374\310\227F\272\307\\\021\250\272\361S\f\351\200)Uj\366\256"
+	.ascii	"@\345$2\215g\301\325\211WF?\311\321/$!HD\265\370\231\017\036"
+	.ascii	"\331\002^+\364k\b\205\276\264\272\224?\023O\210\355Ds\244\224"
+	.ascii	"\332\001L\330\310\245\230\n5\322'\206\031Q#\324\323?[C\261\233"
+	.ascii	"\004=\251z\204A\3427\035t\223\017\2717\214B\3135j5\232\366\213"
+	.ascii	"\235:t\232\315`\311H\024\361\237\211\002"
+	.text
+	.section	.gnu.lto_taskTelemetry.part.0.173.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\215\t"
+	.string	"fQ?8@\217\322\001\230NL\rp$z\232\371\307\231\3308\225Gy\277\201\363\355\251\332\220Uq\265\020\321\207\244\206\341\004-\352\f\232\207\245,h\257\277\203?#\255\335[\356\224\002-"
+	.string	"-"
+	.string	"/"
+	.string	"\206\371'\262\033\327\307\006J\314\356\316Ku\335\273\302\350\371\207]K\255PW\200U\307!\301\343\246aw\235y\334\362\266\031l/\330\327\0026\204\377N\177\231\342\267+\225!\264o\362\023\357/\223\265\335\220\224\225\335O\341\322\b\331\345\301\0134\227\361\035\315\245}\022\333'\225=\007\024\335\200\213\204W\333\342\002>\345"
+	.string	"\225\226\230\206\242\240\266\2541\256\262\354\177\377e'\241d\227cFfA$\313\210\355\333\207\235l\016\347\322\001\035\004H\024z(\215@\034W\261\tx\363t\022\335\2474\267\2109\n}Ds\343\272\35110i\002\304\315\022\211\304M\316\343*\313\016/1\f\315Pm\331\316\002\024"
+	.string	"\031\213\021\261\002\343\202\271\212\f8l\323\360\233-\200\367"
+	.ascii	"\nW\343Em\2753\b\312ygvZ\260\231\274\323,p\355\305\224\323r\372"
+	.ascii	"\265e\f"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.part.0.174.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375`%\001\205\r"
+	.string	"V\030YD\020\217(\035\033\241\013\254\020H\001\320\017>\310\324\253\205\302"
+	.string	"hc\b\317q\020\234\022\347T\363\300?\352\267n\035\264s \261\3455\311\\\235\246"
+	.string	"* "
+	.string	"\026\0036\330\265\240j\235*\213\2244\262\267\334)\005D"
+	.string	"E"
+	.string	"D"
+	.string	"&\213l\024\017K\366rZq!\245bw\263O%\271\350R\343\024\371G\375\342\003G\227\361\0033\\\245\201V\211\024\031`Ij\204x\370\256z\004\001I1\006\370\274,\330]c\032\356\353\266\033\330V`\037C))\2205\245pA\223\235\002a#\023\266\372h\321J\200\335\344\276I\310G\031s\022z\350\241\331p\340\3231\332\017q\021\242\207\036\276\330\355@Be7D\360\351\002\330\247\346\032\327\247|\346\372\304|\036\204\355P\254\017\035Y\377\222\225\226\212\352\3116\350\272\016\020iA9Q\212+\276\242\315\321\021\377]\257\372I@X\260H:\212z\262N\271:r\377\312\020`\331\riaY\016\323\304\207\247\374'\217\366\375\021G\361U\001\033\307\231"
+	.string	"a\2631\350\3308\214\347\301\326\3418\370p\233\347qh"
+	.string	"\254mx$x6\237L\213\220q\234M'\323<O\266!\300\035\205\315\313>]\347e\361ru\004ul%\302\262\240$\211\021\257\231w.\273\253\020\3779c\005\006\036"
+	.ascii	"C\013b\271\001\0171\256\013t\213\364\336\204\306>@\024\fs]\323"
+	.ascii	"X\326\326\224%`\b\220\017d\034\005\202\254&&\303\360\026\215"
+	.ascii	"RX\027\210\202`\356\031\272\250s:-\264\231\262\323@p\355\305"
+	.ascii	"\024\207\246\306\275\253\214\001"
+	.text
+	.section	.gnu.lto_taskHandleSerial.part.0.175.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375`\031\001%\r"
+	.string	"\346XXC\020\221\232\016\363:P\020\001"
+	.string	"\321.\343G\030\200w\2151_)\300\270w]\3234-\270\271\216\254i-\276\025\033r\020\f\252\276\021\b\240I\221v\005 's\300hUp\350uoh\205\376do)S\nA"
+	.string	"I"
+	.string	"A"
+	.string	"\273\237\202G\033\240\036\253\017\230\036\341\005L\217\233\307\233\260\375Y\261g\317\370\027b9>\324\020\221jv\327zT\020\367\256\t=\037t\005\200!\303\363\343\220CdwMi\270\343m/\260\335\300\376\206\376\364q"
+	.string	"fW\245dc;D\030#>\363\307<\355\333?\361\361U\234\344\315\2149!\237\313\234x\305\346\204x\2279\251@\337\252p^b\300\3240\240\036c>\377P*\016\t\036\235i\037\305Sx\377P\334\261\353\301\305\213#U{\304\223\037\271\272\240 \247*\202\027\031\242\033\177\201\351\232\352\024\261\244d\311\376\212\263\320|\021\256\300\345G\217>7=^O:,A\242\005\r\226P\226R]\254\360p\265\305\216i\205\351\204\031Ww9(\341\036d\335eB\341\262\220yp\0212O\007BG\222m\233\t\026\300\030\b7\302]\235\205I\260H:\227\307\3026\316\002!`\255$\333\254N\3236kc;\257-\026\ti\212\252\213m\217<\r\226\235fB\207\332\r=\033"
+	.string	"8g\340W\357\201$Z\306a\025\272\262\n\020\020\005\303\\\341hc\305\346*\244\316\023\257\f"
+	.string	"-\f\365\224\302b@\036\b\341\236Q\212:\247\323B\233);\r"
+	.ascii	"\327\036p\243E\364\273\312\030"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.part.0.176.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375`\031\003]\027"
+	.string	"\226\252\225I\260\030U:\360!\250\353\222\300?n\f\017^\032d\340d\030\305\265\205\224\311A\347+\304\307O \220\372gC\275\343\ng\216\"&\200\325B\273\203\237\237\215\363?tn\201\353\377\243Q\347\250\225\253EG#\204l\"wJ\001x"
+	.string	"\177"
+	.string	"\201"
+	.string	"\247\246\031OK\236\363\345\316s\350\200e\305\335<\247\375\033\307!{\016\035\223j\365\t\002Rk\311\340\3242\343i\314\r\204\247\340\t\204\247\366k\330\336\271YfGy\251\253b\016\250\306\373\325Z\311\323]q\331)\2703\224\371<\247\323\206\033q\260\005'\342\013\3120IQ\024"
+	.ascii	"G\003aN$\021q\336\347\007\334l\316\001\017\305\232Z\253G\022"
+	.ascii	"\267x\333'\3330{\037\004\244i\3228=\216\323\3428\035\216\323"
+	.ascii	"T\234\006_\376+N\317\013\220\211\362r\242V\020GX*\n*\244\305"
+	.ascii	"w<\350"
+	.string	"\025\363\013,u8\016Jz\252\374N\177\330B1\264R\207k\360S\332\370UZ\235\301\261\205\300R\207k!\362\365\334\354\373=\356\213\275\347\373\320\325Zc\366y\034\310.\031\347=\213:\212J8\323\327\261\343\363\\\262\375\035\273\034\307\320v9#\317m\364\021\0251\252\265\316\004\341\351mR\306%-\360)\3325\341!:\021w\\\317\236*\177\342\342\026\n\303\025\367@\007i\374\374^\324zSf\363\b\004\227n\002*\265,sw\301\275\357 \f\"\243\0301z.f\363\310\376\220\023\321\361\177\234R\315\333T\341\351\334\373`Q\242\303<\362\376A\2500A\261\233\263\235\023~\035\220h\262\033\242\315+v\231\366*\303\274\355{\336[d \251V\214f\31337\347\r\017\326Ua\007\2661\251X+\230\002\333\230^60\024\213\274i\261X\255\024\314\353\204\202iP=P\261P.\f.\257\223\212\265\222"
+	.string	"\273Q\271\\\261\024"
+	.ascii	"\247L\257\f/\024\214La oV(\026\231r\275H\323\001\2676\250\\$"
+	.ascii	"\254\325r\221\245\327t\330\031\335\234ilK\367\305\203\221Z\320"
+	.ascii	"\374\206\373\301\020JG\226 \230v\204\323\274\315\005\206\312"
+	.ascii	"\177B\350\017]\311\004\n\025*\204\2474\004\224\337\224EB}\240"
+	.ascii	"\3140AZ\277\310\215X\270\200B\005@\250q<\305\2102D\231\td\202"
+	.ascii	"\021\231P\2411`\002\221cV\036\021\3609\273+\331\231\003<\325"
+	.ascii	"|\205\224Z\020\344![D\364/\006\306\247%\253\027\223MG\006{&\020"
+	.ascii	"@\244p\r\343%7\214\025\264\206\0332\261c\335\026q\214T\315\374"
+	.ascii	"\264\f\017}`\022q\334\232M\016\365*G\330h\313\370#rZ\344\215"
+	.ascii	"\341\251\003\203\303\316\373^\037e\026\033\262\001\3223po\273"
+	.ascii	"V \361\237\362G\007\2311;i\rk\f\261\241\f\320\305\3618\341\273"
+	.ascii	"\025\032"
+	.text
+	.section	.gnu.lto_.symbol_nodes.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375`\263\006u\024"
+	.string	"f_sG\260\230M:\020\213}x\375\332\021\377\207\205\211\367B\354`\374BD\361\024\344\233\214\004\227\211\bs{d\234\376\240\377\240\277H\376\303\n\300\265\222\340\332\0365C\207,\213\017\333\2169\210\035\273\212\332k;k\202$I2\\"
+	.string	"^"
+	.string	"a"
+	.string	"^\315@\274U\365\224?\376\341\321n#\035\202\353\225.\300MeU\355$\226T\315\331\222\335S\366\271\255\272\236\253\026\236\273j\3077\274\003W.\362\373$\022\003w\021"
+	.ascii	"&\342\025\270f\0210\363\016\217\300\025\213\316u\213K~\037\326"
+	.ascii	"\225\352U\2318\371EJ)\007\\\255t\252\372\262\n\236\032\356/\303"
+	.ascii	"\255\003\303m\342\302\375d\341\306Q\341\036B\341\3461\341\206"
+	.ascii	"\222p\367\220Jw\216\b\267\r\bw\215\0077\r\007\367\214\006\267"
+	.ascii	"\f\006w\214\005\267\223\202\033F\202\373E\322\355\302Hw\013+"
+	.ascii	"\323\221n\331\314\302\310(\212|\202\310M\336\220Wx\237L\"t\355"
+	.ascii	"\022t\325\352\200\214\013\257\260(\266\376\3349\251\002%*Ff\227"
+	.ascii	"\354\252&\250,!\231\365\f\212\331\033\f\b\346\007V\203\255\247"
+	.ascii	"l\313\222r\304\365\332%\332\313\307\265J\256\236\227u\330\255"
+	.ascii	"\301\235n=m\234\326\224&<\335\316\274%nI\342N1\342V!\342f\nq"
+	.ascii	"\203 n!\037\356 \036n\037\035\356(\016\267\324\206\007z\313\335"
+	.ascii	"\300\243\270\267\231\223\363\r\025.J-n\016h\235'**\265\2708!"
+	.ascii	"\316\244\305\275\311\335\314\2706\241\r\230\253\tk&M\216\006"
+	.ascii	").\215,'\013e3\234\001mqgf\334\030\0307\026\003Z\237(\271\302"
+	.ascii	"\321\342\302\274\246k\326\342.\331\342\316\222\242\226\324\326"
+	.ascii	"\222\230\314H\266\263\241\330\276@\242\330\006r\250Q\024\n\351"
+	.ascii	"p9\205)u\360\002\031*\326\030\021`\030\210)\252D&\224\230\231"
+	.ascii	"\0179[\"\230{\347\030!\031\323(\002\234X'kA\b\244\231\310\346"
+	.ascii	".\362\324+\037\311|f\235\357^\201\344-+\346\b\241\001\277\202"
+	.ascii	"\210\231\341\370\272\226\013\302\250\351]/\206\250\215e\351\224"
+	.ascii	"\373D0z\007\303F\202\216\r\003e\nz\247?\017dv\225\035\312N\231"
+	.ascii	"K\314l3,\274\323\3252i\035y\377\276c\225%\227\033Zma\203\376"
+	.ascii	"X\037I!M?c\035\313X*\347\261\375\374\345W3\3533\377S.!\327\020"
+	.ascii	";o\233\317\214j\340x\032\316\232+f~\210\214w\374\0016=%\347A"
+	.ascii	"\255\002"
+	.text
+	.section	.gnu.lto_.refs.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"(\265/\375 \207U\003"
+	.string	"\362\307\027\034`\215\032\0030\f\3030\f'AB\310\220\003\274t\206\030\260'[[\357\330;\311\024N\226\034y\371n\206\374\217\035WGS7f\314^\354\212\023\224\024\204N\016Z\031\224j:5\205\232\006\232\262\202\004\306gp:\322\331L\347\222\024\260\350d\320\262ggy\214\313y\200\331y\313O\255\004\002"
+	.ascii	"7\003Q\301\034\003"
+	.text
+	.section	.gnu.lto_.decls.42f30e5bf8f1c9b0,"e",@progbits
+	.ascii	"(\265/\375`\360R\265g\001\332a\262\205U \fa:\215\001\301\217"
+	.ascii	"\315\215\252k\254>\350\374\204q\266\307\030k\372\215\001fpX\226"
+	.ascii	"\226o8\364e\364\333\2502\233\256\224\354\355t\023\212m\331\232"
+	.ascii	"\313\013\202\237}\355tT/\007\273\352\231M\217\202&\r\0353\023"
+	.ascii	"'\351\246\244\363;\252\036(\311\336RJ\231\002f\007[\b\277\b\027"
+	.ascii	"\016\027\272:\240!eH\322\314|\2364\235\215@9\361r3\3367\357\002"
+	.ascii	"\033\035W\212\334|\2362}\236\024\364y~\350\273[\307&\257\235"
+	.ascii	"K\307\b\2717\224\275\267\235\033\347\332ux\222*\201\353\256\316"
+	.ascii	"\316\205\3433\204,\bZ\017\214\212\222 f\276\276\243\377k7\007"
+	.ascii	"\337\220z\263\203,\263h\221\021r\363\177\233\274rn\033\3446\362"
+	.ascii	"Q\003c\263\271\371Z\216\276f\243\257\313\350\353.\372\032N\263"
+	.ascii	"\271tN\274\222\234\335|\335\204\215N\242\257\217h\213\264E\246"
+	.ascii	"\221%2\217\264D\346u\331\231\377\206\271S\327\214\355]YQ\243"
+	.ascii	"r\363\035s\311\330$\207[f\007Y7?\236\254n\276\026\323*\330\333"
+	.ascii	"r0m^\236\345`^\203i\323\022\231\207\263D\346\027\243 \032:\234"
+	.ascii	"H\335|M\245\377\001\225{\005\253Ui7\037buq\327\213M\336.\027"
+	.ascii	"K[\227\233\345r\261rm\333\211\006\007q\220y8\354.\270\331\325"
+	.ascii	"\3112\263\226\273%(\206\020\027bS\2644\321\357\221U\271V\356"
+	.ascii	"\025\223 \275\260*=.\375^\214(W\312\0309w/n\276i'\212\371F\337"
+	.ascii	"L\243ov\321\267\355>\371u\273N\366u\003\241ko\247\353\026dgo"
+	.ascii	"\247 k5\260V\203|\344k\210\233\231of\3217\335\364\355l\221y\263"
+	.ascii	"\211\356!m\221y;\"\372\246\230~\235%2oZi\273-\221\371_\264#>"
+	.ascii	"qssd7\337#\227\354\226Y\271\266l\006\345\"\271,\330\344=r\215"
+	.ascii	"\374:\335\263{\344\026\271fV\256mg ct]\316\260T\230%df\266\333"
+	.ascii	"\026\231/\351\264\207\273\002\017\0242\210\307\314\033\035m7"
+	.ascii	"\2774\243_f\321\377%\362[v)\027L\033.\273\233m\024\244_\"\030"
+	.ascii	"\016K\224\235\233_F\321\377\035\273U\377\035r\277z\234\340\241"
+	.ascii	"I\341f\244\033\266\nP\271w\227\2271$\033#\240\201\251C\242qk"
+	.ascii	"T\315\301\331]'\027\266\212\225\373\2613\025\334\034\334\331"
+	.ascii	"u\232\361\006\007\325\302\276!\3559\2703\244,\007\034As\235\356"
+	.ascii	"\327\245\272W@P\310m\005\364\206\214\223\262o@xo\256:c\307'\373"
+	.ascii	"f\345\264\366\261\r\bdUwJ\206]\263rZ\033\323\3559\270\263\275"
+	.ascii	"\221\377o\330\005r\273\256\330\355q\271\256\327\005\273A\256"
+	.ascii	"\217\233\302\375q\205\334\035W\205\313\303&\357\327\315\361\273"
+	.ascii	"uu\\\0301\354\2329\244j\016\316\016\0072"
+	.string	"MT\335\034\234\335\227\373u\265l\025 '\344\256\352%\345\346\340\354\256\323\357A\b\367\353\276\260o@G\344\246\352\r\351\232\203\263\333\033\371\241\224\342\305\005\266A\276\333\026\231\031X\"\363e\227~)C?\337\351\3471\372\371\211~F\242/\326\0059\033i\334n~\356\241\237i\\++\003N\230\331\315\307x\372V\3419}\034\247\217\337t\007g:\204-2\217s\350\343)\375k\247\177\305\350_+\372hl\221\371\333D\013Y\"\363uw\347\225K\270\034q\272\331\336\261x6i\363\216\274\200\235\262\274H\271\371\326\203\031\344\301\316]\026\333\035\262\233\357\354\025\013\007\253Ua\340\311\316o\355,\035[\307&\355\235\215s+\307\316\371\340\267M\356\254\224;uL~\333\344\316:\301\253\333\033\371\301\350\303\207\0365c\356z\350lv\331\"\363d,\221\371kD\3776\313-\234\3376\261V\354\233\333\265a"
+	.string	"aw\346\334\354\306\310\334RUw\346\346_0\375\337\322Y6v\215\235\263u\266\005\233\264m\354\231[46\3153ro\250/?\222mc\345l\031\254V\245\245<\255\251\333{\337jQc\267\205K\317\311\027\335\007?\322m\033k\306V\301H8\355b\311\\]\\\027\373\006t\024\332Oc\330\214\355\215\274E\373\221~\017B\260m\254\027\373\206\221c\373i\314\224\006\200E\271\262\262\333\033i\364!\310\314\234\266-@\371\026\215\276\234-2\177,\221y{E\337\266Y2\226\315\t\220:7\337\222i\033\306\212\261I;\346\267`\354\227\347\265\256\315\266\367\276\340\023\006\327\346ts\323\336{\333_1{yyyy\366W\314\333\036:[\"3\003[d\336b\351['\3756[d^\205>\234-2\257\305\026\231\026\013\322m\026\"\263J\013\271\333\366\336A"
+	.string	"x\2732\345\346\236%2\357\323\346\266E\246\205\263Sl\262"
+	.string	"\226\312m\024\313\344\245\023r#\367F\006]\261;O\226\334|\016\350\333\002\2308/\317\026\300\374\b\372Z\"\323\266\331'6\211\201\205r\017B8>\256\005]\300c\001\257\316\315\017\241o\335\276A\314\016\341\034\364-\006\246\315\263\030\230\327\372r\226\310\024\262E\346o\331\354Z\017\t\226\257\266\233\355\332\265jv\311\355\232E\336\203\020\376\003\265\321\366F\332\265\274\267\223\265\032"
+	.string	"Y\253AyE\210\323\0223\377\352\337*)\200\206\252\222DK\342\341\002\0353Og7\3776\355\267H,\032\006Xj\252k\267\355\215\034\nBf\311"
+	.string	"\273\371H[djKd^\267\022\264Q\301e\230\310\217A@v\024\227\314\217\307~,\366\3430\265s\370\313\247\037o"
+	.string	"[\340\312"
+	.string	"\023\303\032\370\337!M\350/\257\021C\340\353\277\351\231\317_\226\340\307\033n\2100\366\373\261\317\r\363\3721\217\377\n\331\361c\256\037g\300[?\316\361_$7\264~l\243\306\217\261\260\325\217\253\250~<\343\277f8\306\217a\374wL\352\307.n\336\177\351\374\367\356\277v\376\213\367c\373\343\236\037C\375\370\351\277o\376[\367c\016\376\301or\270\031\374\027\315\177w\340\025\374\230\004*\370-\335\177u\340\024\3746\304\177s`\024X\r~+\200\337\022\300\036"
+	.string	"\237\340\307#L\360\337\016\263\370\361\322\177\215M\304\0166\350?\336\377\002\374G\361\237"
+	.string	"\377\275q\006\374\245\r\262\006\3747E\241\303\201\376\362\304\004\270#\274\374\313\f\374\327\b^\361c\n\3746\004\343\035\341=\177)\274j8\305\372_\ry\374\361\007\352\177G8\317_\206\340\202\3359\004\210\375\302_\236\370/\032N\377\353V\202\377Pp\361\177\207\377\216\360\237\277D\341\277#\374\376\345\005~L\374\261\360\307*~\314\364\343\337\217}?\026\301\217C\360c\017\374\230\003?\256\300\217I\3748\002?v\300\217C\374X\204\037\203\360c\004\374\370\303\217=\374\230"
+	.string	"?\346\340\307\033\3748\203\037\003\340\307\035~l\301\217\215~\234\341\307\030~,\364c\240\037\377\374\367\312\177\253\374w\312\177\245\374\367\355\277\311\377\"\377\333\366\337&\377e\373\257\332\177\221\3747\355\277f\377=\373o\331\177\307\376K\366_!\377\025\373/\220\377\372\370o\330\177w\374W\307\177s\374\367\306\177\265\376k\343\277Y\377\305\372/\215\377j\377\251\374\327\352\2772\376;\365\333\020\376k\374o\372\337\022\374\027\375o\361\277\303\377\216\360_\b\374\326\315o\033\360[\020\277=\372\237\367\277\316\377%\377\223\374O\373\217\366\377\003\377\343\376\007\345\345\345\345\375\345\330\217A\315\337"
+	.ascii	"\022\002"
+	.string	"{\037\355\226\333{\037\367\336\275\252-\344\3368\204\244\306d\310\330[\313H\306\336:N\211\332\373\266\251\201\263\222b\373\352B\232\322\204ml\273@\036\255\324T\327\036\333h\274\2524\333QmO\355\275\355\033=fE\303\315\315\345\216\362\2505C\306\315\337\260\245K\035\372\215\033:\252\233\277!K\22792\330\024\033)7\177\003\225F\242\355\215\0042\315Rp1\345fm\204\314G\235\233\221n8\272\370\270\271\314\002\223\333J\336|\ry\032\351\003\307\365\004\353\346\222\206\315\372\342uw\3635\324\225T\247*\255\214\364N[\002\243no-\017\027^\264"
+	.string	"\203\255\254zi\025d\347\216\214\323\315\217cY\270s&\352\346k\370\242o\223\345\214\227SO\266\344\330x\236\3639\345\224Q\327\261\r\bdWr\306\354\366\326\362\200\177\020YSSJ\275\234*c"
+	.string	"\215\211\231rrs\t\003\350\255\005\035\235\233\257\001\255|Q\272(\243\206\220\275\315\270\271<\226Q<pw\276\004\211*[\260\020\007g\353f(\022|\315y\271\371\032\306t\371T:\351+2[\352\346k"
+	.ascii	"\323\217S\356\036\2265X\226\224;\257G\217'm7g\274\031w\242\262"
+	.ascii	"\334|\rU\3726\231\357\3309\201\013\356M\256\363l'\247i\361\202"
+	.ascii	"\306\315\217\223\357\376\363\364\230QSG\356.\323\351\265\270"
+	.ascii	"\343\302\226\351d\273\037\2560\034gn\276\206'\375\"\272\034\007"
+	.ascii	"\0057A\270\334\374\""
+	.string	"2\031\0162\203\226\221\031n\262\2318d\236p\271\371\317u\267\311\\\227\331\224\260{KY\242\243no\255\003\364\204\005\021\222w\363\213\236\320\261\261[M\226\234\233[\350\225\031\341:\273\371Ee\372\177\236\313gr\232\214&\253\261\311\274&gy\326r\217[\326\344-\331\f\r\016\312x\320a\331\3455\031\213\3231\004Y\030:,\273\262#\035\226\035R^\223\257\264\241\303\262C\312k\362Z\266B\003\001eV\333\b3\351\022R\367\223\313p\370\2113\343\266o~\321\016=&\213\261\311L&\3071\311a0\022NK\371zQ\267\367\316d\362\222\314\005\310IhC}I\215\355\2759|\370\320\343&\b\0163\313\031]\360\321\265\302\216\233_\344B\3372ib\007L\366b\223\371K\356\302\226\277d'\327\314\0202L\207\315K\235\231\237\341\215~\0060:s1c\273\366f\333{o\360\241!\227\346\306\315\317"
+	.string	"E\003Y\"\363\031\314\3643\210\351g\340\322UL\025\312\334]\271\371\031\2444\223,\305\312\375\310xqT2\234M\346)\231-O\311K\356\031\240ro'.c>;\300\254^\2309\n\266\333\002\227\274\371Dl\364-\223&ocO\256\231(cP\362[v\263\311\234\314m\2779\231\235\\3/\326\222\300\235\355\275?|0\372P\312\251\243\323F\347\023A\321'\032\323'\022\323'\n\323'\342\322'\222\322'\202\322\307`'#\177\234\262\242\204\271\371\030\336\350?+\301"
+	.ascii	"\031Uw\267\236\324\\\247\034\365e,Ku\301wuZ\030\223Cgl\013\323"
+	.ascii	"A\312UP\354\344m\345\264\034p\226U\310D\362\221\274#\027\311"
+	.ascii	",d$\331H\366\312IrW\376\312i\231,\243e\260\274B\016\313e\371"
+	.ascii	"G\036\222S\310g\031H\366\221{d!y,\007\311<\262\230Mf\263\274"
+	.ascii	"\365\254#s\375\242\301\3402\006\343\277[\330\216\356\313\224"
+	.ascii	"\226-\034\347\316\311\205}\3632\206dCI\b\377u\3123\242\334-\f"
+	.ascii	"\307\276\325\261Z~\244\254\\\243m\214\352mlod6\3138r\016 \274"
+	.ascii	"7\030Z\234V\2221+\373\226\224!\245\016\351\312m\214F\256\361"
+	.ascii	"\244\356:\305\330R\367\"\256\256\005\232|\314Nsc\371F\332V6\313"
+	.ascii	"Pi\352\266\262\031\236\343d\206g\2677\262\034c\346\016\231\021"
+	.ascii	"\362\225\263E&\0020X\3119\332\312\362f\270\271\371\030\242\350"
+	.ascii	"c@\323\307\020D\037\303\016\375!<\235\261r\226\2270\025n\376"
+	.ascii	"\220\034\375!/\372CI\375\241!\372C^\372C6\364\207b\350\017\265"
+	.ascii	"\320\027\262\243/\364F_h\214\276PR_\250L_\250K_\310\205~P\035"
+	.ascii	"\375 :\375 0\372AO\264\221-2\361\035\214g\223F8O\314\323\214"
+	.ascii	"\255\233\037\264\246W\260\255\221\371<kd>\310L?\bL{\260E\346"
+	.ascii	"\203`\350\003\315\351\003U\321\007B\242\017\304\245\017\324B"
+	.ascii	"\377\370\rns\346*\306\223\233\257\022\334\346\"\327\320a7\270"
+	.ascii	"\016\263\261I\334\006\317\035\257\301-(is\325\256\331\033\031"
+	.ascii	"\035\226]\032ns\223\b\231\202\304m.\033Vs\354\275\361\240\303"
+	.ascii	"\262\333{k.G\0327z2O\225%2\177\241\213N\003t\004L\026\221\233"
+	.ascii	"\177\241\212\266M\356\333\205\303jU:\371D\327\003\213-I3\266"
+	.ascii	"7\362N\271`\276<\244\035\233\\7\017Jxl\205\301)\\\212\225k\333"
+	.ascii	"-\324\020\220v\234;b\007\305\256E\3408w\344\3146\301an\322\256"
+	.ascii	"q\240\304j\356\210\035\376\202\313`1x\fF\203\315\3408\354\005"
+	.ascii	"\313\341.\370\f&\203\301\330$\016\203\271~\327\356\2224\307a"
+	.ascii	"\356\032\234#DT\225\005\276\346\352\366\336a\360\020\234\245"
+	.ascii	"\303\223\324\336W  \t\363\213\265`.VNk;\035APB6w\304\356\312"
+	.ascii	"\3410\027\315\032\274\025\006\353\300a!\242\252xf,QS'\207\303"
+	.ascii	"\\1\367\214\225\373\261\267\025\b"
+	.string	"iS\346\216\330\355\275?\\\310RC\365\326!\377x\3131\227\267\021\354\rC\\\252v\334\354\001\322\361\026\363\314\n\017:7\377B\017\215\261p\b\002\363\341T\346\346_\310\322c\270\f#\307Hx\232A\005_\301Ul\022[\201\302Vp\021\334\026\"\252*\003O2\352\254\340)\357\322\341Ij;\361\350\200\214\316\231\254\334\344\307\226\035:\377'N\377N!9X\271\037#\020I~a\302B]\033^\001+\351\360$e\202\026(k\277\002\304\263\267W\333\030\032\333\221\2724K<X\2716\022phu{#\333p\223_\001\202\022\332P*\234\325\355\275q\033V\343`\002\0012f\314.\n\206\303O\360\033Nb(X\nv\263I\334\206\235\030\225M\230\330\325\301\220\377\223\245\377C\245\377\343B\337'O\337G\216\276\017\235\276\317\031}\037/I\240\034\351\304P\335|\037(H0\232M\3424l\304\f\263"
+	.ascii	"\326\302X\032>\202Y\300\320B\232#Vp\22498L\314|\237\030\372\307"
+	.ascii	",\234\371\340\245\351\300;\303F\200\222\f\231\002\273\371=o\364"
+	.ascii	"{\326\350\367\224\321\357\371\242\177L\344\270\354\307B\260\n"
+	.ascii	"\327m\004\345\223\027q.n\306dH\307-~L]\335\\\200,\372=T\364E"
+	.ascii	"\332\"\323\203%2\337\343\004\b\016\362C\013)\263e\205\b\220\037"
+	.ascii	"c\3326\032\037\307?\316\306Ts\304r'\206\301\274\354dM\031r\363"
+	.ascii	"{\262\364m\022\177y\335\267\"/\240\334\214\275\326~v\207\237"
+	.ascii	"\273._\260n~\034\334\365\237\007\310L\022)Un\376q\327\016 \031"
+	.ascii	"b\266\327\016\314\305#\007\315\035$7\277G\206~O\224\356\300\022"
+	.ascii	"\231\030\307\235K\263\321\344\346\363\334\351\377\330\006\326"
+	.ascii	"\262I|\343\266\371Us\347n\204o\334\026n]/M\233\033\327\r\256"
+	.ascii	"a\345\264\2046\024\233;u{o\243\017\037l\023,xn\314\214\243\360"
+	.ascii	"\325\2321,L\003g\331$\256q\\\343\276\271v\200\216C{\367\2603"
+	.ascii	"V\343\336\301P@P\310}e\322"
+	.ascii	"\035\203\240\331\355\275?p\370\360\301g*L\307Q\347\377\270\n"
+	.ascii	"[\331$\276\302T0\360\f+\247\205\334W@I\036A\320\360\025v\201"
+	.ascii	"_tx\222\252\200\225\271:]%\210\025 f>\017\033\375\343\031X\306"
+	.ascii	"\013)egn\306S=5\264\344\254\334|\0361\032\307\270\235A\326\""
+	.ascii	"\356\346\363l\321\267\311\267\200\245\316&\213u\311J\273\371"
+	.ascii	"<V\364y\336\364y\236\350\177\200\241.\036>Z\2716\022_\330\340"
+	.ascii	"'\334\302&1\024v\302P\001Q7\367v\374=\256|\314a\\jv\334\214u"
+	.ascii	"l\3458d\274\320\310\361\336\326o\261\\\030e\242\270\371q\363"
+	.ascii	"\r\203\364^\216\233\326C*H\017\207\251\305\266\206\316\235\336"
+	.ascii	"\215\236\226\231\036I\276\330xO\013\n\317\016\254\034bn\356a"
+	.ascii	"!\275g\303\304\243\023\243-\253\306\317WU\2320\032\357\325\370"
+	.ascii	"{X\227I\334\2261un\016\262Df\326\202\364\036\r\235\227W\005\310"
+	.ascii	"\225\225\317\212\254\314\315=\253\3536\202\275"
+	.string	"\001\350\216\220\030`\252\250|\3164\351\362D\306{T\177o\006\276\213\342\205I\217\233KKdZ0H\357\311\310`r\250\210L\305\360iQ\325\245\005\214\367b\374\275\243\335b\346\r\2013us\317\005\322{0|\240\260\334^H\225jRr\334\242\336\223\372{.l\334O\220\0324\300\334\314c\211L\213\004\351\275\250\2401R\342\250\320k\321\203R\243\242Q\344\346\277\347\364\036\324\337{\262Z<\230\002\342\343f\037Kd\366\216H\3579I\3259rsOow\331\026\320\312\354\362\3149\t\270\231\n\303+\271\312!V\244\236\356lm\240-\r\213\035\033\275<\265*8u\330~\264\240\200\305\335\225X\267k\315N\013:&\232\236\"o\206\320\261C\233s&\247-\bMW\330T\2341\232G\217;(8f\221\037 \307;\037o\322L7\311\033?\276\332x\231z\272\231\216\256L\276\241\253\213K\356\233?"
+	.string	"\254\026Z0\347\214\272p\032\032wcg>Rcn6n\376"
+	.ascii	"\234\324\2501\347\354\332\246*:"
+	.string	"2\345uf\326M\371Xa\216\254\354k\352\346sPW\246\214\211\306\b\314\023\335\225\245+\273\333r\346&\232\2363eTh\273\3314\223\345\344\ty\221\343\346\307\261k\377y~`\\U\341\n\023&\2149\306H\357\264\257\027u)\230\031r\024ss\f\017^\027#88\310\002\006L\231D\3722re\345\255\016\233\233\317\001\233\027/e2\371dv\005\206\313\035\344\315\347\240L\233\\L.f\\\034\2159Z>g\204\264\331\305\225e\254\f*O\276\264h)\223F]\370\314\233 Yg_E\350\234\335|\016\264\334\334L,F]G9=-SJ\344\330\001E\271\372Q\304\274r\023Ki\246eN\326\315\346\024\323\212\220#\021\262\233\315*@\036F\310\334|\001\2141\251\230QL8\237-(s9\312\031\246\224\024\242\236\262\334|\001@\321\217c\276\375\347)\243\204\f\271r\263\t\005\b\220\262\233/"
+	.string	"#\3726i&K+\236}\246\210\335\315\027@\217&M\3146%c\276\252\360\221\027fv8\271\331\306\245\246f\262yyCwe\327s\253S\3732\227\334d3\231\220\341\260r\263\271\226\345\264\220FL"
+	.string	"TI\222\230J\216\2416\027\016\023k\312H\222/Ntt1\225\\3\254\306\210\334\220\233\277\001\231#?b\242\031u\035\343\230WSf\\vJ\356\304\244\231Hn\242]\210\303D.\311\006fgg\246V\257j\212\210\226\263\236\217\257\251\257\233\277\301\223\231\331\033#Wg7G\2329pgTP\301,\022\202\032\035\226\227\031[\324\312n\026\351\265\350Q\007\353f\223\2106\213s\007g\22291\231QGf\216\231\340d\313\2332?Ssb\356\314!9\216\003^\201F\227(/)\244P&U\260aS+\2449\t\022\244\f\263B\310\2471ic?L\234\254!s\3635(\373\361\243L\332\265M\245"
+	.string	"\2719\270 $N]\260n\276\006;z\364X\247\202\\\371\354(\262fu\36330\003\006\206DD\316\330\017\034\r\030[n~\006U\274\274\212S_nz\\S\244\240\335\374\f\202tu\225afS^gM]oOn~"
+	.string	"\356pq\321\300\303;\313TV8z\335\374"
+	.string	"L\331\332z\300\236\203\343\221{\342B\343\346\007\300\b\016\034!\300\315\301\235\351\210\272\222w\363\003\340\245\315,3\313\324\262k\233\312>)\273\323yQ\242<\2316nj\215Qb\006\315\315\217\303c~\241\262sg\207\205U\326\331\265M\225aK\2259Zv\246\326\03018\260\\]}P\345\315\235\317\016\313C#VU\205\264\304\310\325\331\336Z\036z\234\312\262\220\334|"
+	.string	"\344\320\346\fsF\031f\3276\225Q\033\032tWUc\252\360n>"
+	.string	"\246\364-\013\266\314b\223e\026s\212Gjo+\003(\241\202\307\305nWi\035"
+	.string	"\350\r\031E$\356\346\324_j)\267\2301~zd\344\031\221s\263\t#\207\217\025\262\334|"
+	.ascii	"<\351[43\266J\0137\264.^\306\346|I\363%n\314taJ\225v\314\250"
+	.ascii	"\322\256\3043\241\314\247\222\216\371\302<\232\273\274+\353\224"
+	.ascii	"w\312<\323\311&\315\026\377\225+\345\3400Y\355\ro\211\311jV!"
+	.ascii	"\266,\241\273\262\213\363Dweg\266(\3170y\262e\266(\321\224i\334"
+	.ascii	"  \313\03067%\034/\017Yh\320]\331\311Ei\241l\023\"\252\212'\252"
+	.ascii	"\f\222\272\233\306KV\303jU\332\t\223.f\213r\256\\\023\"\252\212"
+	.ascii	"\307E\01345e\231\260\264\261;\246,\023\226\254\303f\213\022L"
+	.ascii	"\334\027\335\225\335\336\373\302\21463\\p\220\217A\024]b\300"
+	.ascii	"\004\316\233 $X=R\270y\007\361L\251\263B\215\233\217\001\013"
+	.string	"\372/\333\224u6\f\026'Q%\335\313\272\0174)sss\311&\253MyQ\341*\263\002\230X\221\233\217\301\020\375\227k\302L<7L\246\334|\fz\350c\240\245\221hTTb]7\037\203\027\372\035\350\350w\230\323\277R\222\331AAY\342\354\200\273\371\035\300\350wH\352w@\323\357 D\277\303\016\375\016R\372\027\264\321\277\340\213\376\005o\272\344\202\3642\016\310\212\005&n7\017Y\"\363\\\266-2}\272,\221\371\013\230\350\277\274r\233,\257\224]wm\037{\350\304\230\341A\231q\232q\363/XA\377e\225\333dY\245\3442\222r\244\303\362p\347M\312\315\277\200L\377\345\224\333d9\245\334\312k\373\330KSG\327Ek\215\241bv\363/\220r\233,\245\2246*\320\265id@\206\234\203\313_\350\314pr\363/\260\241\377\362\3556Y\276\225Xym\037}\312\274\270:\263\333[\353"
+	.ascii	"\2759ja\332\334\374\013\236\334\334\312\244\021\035\"Z\036x\344"
+	.ascii	"v\304\261qs\322\2029mmv\255\347b\214\221+6Vr\020\271\371\026"
+	.ascii	"\\\321\177\331$Y6\261U\356\332\256\352\361\361\306\354\252'\r"
+	.ascii	"\214\215\274\233oA\n\372/\227\224j%[V\323\307*\235\f\223R\267"
+	.ascii	"\253\220\007\270\005;\364-\250RR\252))\303\220\310\0178\345\351"
+	.ascii	"s8s\244D;R\246\245!A\022\001\"\034\260\350sH\262Bid\205\362\354"
+	.ascii	"\217\363\362\254\024SD\005\267\233\315\314\252\300\\q\030\242"
+	.ascii	"\317\341FYY\2137A\262zrI\330l\335|\243:CJ\262!e\230\271\267"
+	.ascii	"EvQU\215\215\225a\372\250\212iA\337H\213\020!Y\274\360\270\330"
+	.ascii	"!\365_\212%K1\373f\3276U\317\213\247\257*\273\275\265\034 H\216"
+	.ascii	"\231\016\261\233o\204\005\004\310\t#'\037>\3120\275\367>\"7U"
+	.ascii	"\t\334\340q9\333ZU\036\276a\215~\311\243\364z\371\365U\206\331"
+	.ascii	"\275\367N\363\302\343b\267\265\260<\374%\330\3130 \264+ut\324"
+	.ascii	"\376\363\370\256\004\261\273\371\033\240\350\377\366\3677\267"
+	.ascii	"S\325\336\373\252D\356\252\247\037\363\267\267\245\265\036\376"
+	.ascii	"\013\026\333\r\376\347\373&\200\334-\346\254\331{[8\272L\212"
+	.ascii	"S\216\f\366\345\366\206\362:\216\340e\005\345eC\212\315\313j"
+	.ascii	"H\212\315k\037\241T8\016Um\257\243\024\333\336CPPG\022]VRlN{"
+	.ascii	"H\212m[\355\026b\254\354Fz\0357T\327\036\332P\333i\263uYe \005"
+	.ascii	"\345e%\305\346d5$\305\346e\265\331\274\266\320\206r\252z\001"
+	.ascii	"\265\253\2066\233W\233\315\326e%$\305\326e%\305\346\365\305\306"
+	.ascii	"\301\250\243\245\206\2345bkl\033)\250=C\306\226S\225\220\234"
+	.ascii	"\024\262k\243\331\333\266E\355\252-\267\367\006{ouU\241q\262"
+	.ascii	"a\341\236\344f<Aq\352\262\310\2757\007\031O_]\033J\356h\267\234"
+	.ascii	"T\221\256\275\213<1m\031{\357\r\302\021)\267\201X\271#\330\326"
+	.ascii	"\236\212\332\333\202\215\334[Fg:B\205\300\265(\374\361\234\351"
+	.ascii	"HeZO!\210!Q($\376\206\3003]\325!\361\307\263\002\207%\244\027"
+	.ascii	"\206\206T\250'\212"
+	.string	"\025U\201\232L\024yT\343z\256'D`P\177&\204\316\224\204\025\245@S\032\004\f\376z|\250\357\\O\022E\365\204!\021\003\350z\032\203\347\212\t\024U\341\006\r\351ZbH\002\213`\0215QT\205\031\212\252P\250\247B=Q\240g\nbz\246\3509\323\021\210\016Ih0\3059\234\200Z\002\232\032\327\023U\022:\323\221\220z\"\030$\226\270\340\367;y\320_\211\"\025]\317\365\204*L\317\240\b\"\240J,\n\201\253:\201\237\005\302\023M\327\023\030\316t\324DL\001\202\b$J\200\b\034\002\213@g:\022\236?\037\b\"\360\227\002\235\351HU\317\242\220\370\2730\202\003\007\316t\004\342\247\304\364[\317\242\nL\njJU\374P\246\021M\351\2053\035\031\205@\020F\253\b\243\0208T$\022MH\002\226\bJ:\211&\254>}\246\243\024\r\032\223P\246\237\252A\360\\\211+\006Txb"
+	.string	"\025\236\030P\241\236(R\030U\237\337\320H\002\317oh$!\351\302z\256*\020\213\025\230\022\201i\211\244 U\304\352C\205\300\325gU\321\3654A\205z\256D\301s\270\004<\261\212HBS\240\212\222X\3253x\001\025\002Q\240\301\037\213\021\350\322\231\242+Dh\320\200\n\201(\3165\210\222\020\032O,\r\201+\210B\f\250\020\210\342\2076M\240\351\024\n\251\275\240\337\357\304\304\224\305R\316@\264\002\207%\250*\324\023\305O\311\347LGhJ\374\201\370)\241\200b\340\\O\022\0360\241\002}\316t\364KA\374\224\320\3654\301\244\242\251\022j\242\311\304O\007G(\232L\254\352\031\004\032\002\317\023\232L\b\235@\203I\303\263\002@\304\364\224"
+	.string	"\323\0210\370\003\001\f\376\222\210'"
+	.string	"\203\277\336\205\016\216\326\364,\036\241P\241\236k\006\021*\324s\335p\246\243\237\017\025\002\327\2411\r\200\272t\006IX\032\002\205\351\351\243B=\327!4\311\270\002\327\240\bt=\203\306_\360\034\241B=\327\242k\030\002\317\023T\250\347\252\377\003\246\350\020]\322\007A\204\004\210\020\242\251\367\020\f\350\200\001\035\230\017\301"
+	.ascii	"$$\006\210\200\244/\002\022^\327\225E\260\210\232\030:\323QQ"
+	.ascii	"\025\202(\252B\324\267\252\276\025U\361;K\024U\241O\272\226\030"
+	.ascii	"\222\260\252\304\022EUH\244\372~\222\206\247PH\034\241\252\350"
+	.ascii	"\217\230\226\370\221PT\205D\250/\251\004\025\352\211B\351\327"
+	.ascii	"#DW\225\305\t\013\326U\tM\362\255\033T\243\217\351\267\002K$"
+	.ascii	"\rE\004\203\304\224\bC\212\256\250\220Xd\002&\237R1\210\246'"
+	.ascii	"\nI\351\271\256>%4\211\303\231\216P8Y`\365\202`\220\230f\246"
+	.ascii	"\337\n,\226*j\f\236+L\243O\025\002S\024\352\017(<\207,H\254L"
+	.ascii	"K\300"
+	.string	"\240R\021\ng\212\211)\n\202\337\357\354\255>u\003\250\020\270\3523\0355\245 \226\212DMiO\361\024\376\3222E\223\200+\210i1\tmJ\207\232\320`\321HB)x2\365\240I\3004EW\020}C`\006\253\257\267t\242 \002}K\306`\321hhEU4M\032\002S\370\326S\365\t\215\351\252\002-\252\027\374\240\301\363\327\263\246\350\212!\360\227&\001\205\345\020(\324*~(\323\257\351\024\352 uD\220X\374\245\033T\024M\227P\022hpi(Bx\216XQT\302\220\024$2\251h\312\204\002]\317\025\300\365'\002M\"\236\220\002O\243!\360\207\252F_S\352\023D\207\303\223\351\347k2\236\276\246S\030\244\246\3044E}\250\360L\225|\277T5WTUR\"\372\200\252\232\372\240E\026\353\020\007%%\342j\374\001@\0056\235\276%c\n4i5\026\207\300\rh\221\305\352CW"
+	.string	"\327s\0050E\223:\244\304\365w*\371\210\253\361\364-\r\201L+\221(T}\277\324\350LGC\"p=S4\210\376~\347\006\252\357\367;\313\365LG\003H\321`\020\250d\256A\276\336\231\216\326\2371]U\017T_\023\272\032\205C*~\304\240\317g\256C#\361\347\363\365Rt\210\002\321\347\353\251)\252\032\207>\237N\032\002U\370|\246:\004\026U\237\257\027D}>\236\325\267\252\300\240\320\231\216T\264\310bM@\022\232\236Lj\002@\250+0\005\b\343p)\001M\306!0\230"
+	.string	"\020D\360\211\020\242\t\004\232d\f\376\206@\020\251j\004\261\200\265\t\035\006\317a\212\256C\240/\351DS\246\265\350\363mX\201\246E\237\317\\U`\320\3473\317\365L\362\371L\324\004@\325\3473U\374\210\301\374CS_\317\n\034\2260$a\005\016\201f\272\226\370\r\215$$\235\250\211\337OD\006\325\267\002%\361\373\235zHB\322\211\246\346\252\372\200\305\023J(\t\264\310\002\205\257\204\022'|\320\337\360\\\325!P\257\276\f\224\220\207\300\022C\365g\002\213*V}#<(\301g\204\007%\360\230?\017\200\370LG\2521\005\007\325wB\222P\212\256\352)4U\025M\223\222\316\036\272\342\f\2360\026\205\332\350[\201&\251\306\024Z\365\241?\340\n\224\204jL\341\203\372\320\"\013\024\2521\005\017Zd\261\252\306\024=\325\230\002S"
+	.string	"\311\367\373\235f\017\205\323\304\b\022\"\314\365LG\306\242\320GLY,\375~'\b5EW"
+	.ascii	"\323$\003\240>\023\035\204\320\201\b\306\242\220hH\004\256\306"
+	.ascii	" QE\323\036\325\227\001\365\2350\026\205>\346\0324\252\250\t"
+	.ascii	"tEI\030\213B\f\250o\270\004\f\236>\240\341\0220(\342\367;5\213"
+	.ascii	"\244\0235q\256g\022O\252*\371\230\226\200L\276\337\357\374IO"
+	.ascii	"\246_F\223\210#\206D\240\n\\\201\246?+\320$\034<W\244\350:,a"
+	.ascii	"i\b\f\026\205\347\211\337\357$\032AB\304\357w\232\350o\230\201"
+	.ascii	"U=Q\023V\021I\033\b\242\277\237\b\025\310\341L"
+	.string	"G\304\224\305\222\005\252\217\230\262X2W\237\007\037\240B\340Z$\022MX\321\245\364\\\201\224F\220\020ALY,\3513\035\201PS\242:DU\fT_\3239\004\n1\240\240a\035\242*\232\026W\342p=S\254\340\360[\021\274\200\3720\240\276\f\350/5\022O\244\350\212\236\260\016\32145\3760\260X\201\277\263x\246\bZO\tp"
+	.string	"U\215\027\3245E\203\"F\240\2521\003\272t\256C\364\227\242%\226\206\300azv`H\004\256E\241Q\035\022\177\035T\240\212\246\350\252\262`Z\317\024+\200\320\245s\r\022W\004\203\350/\0304*\255g\212\025D\353\320H\034\021\f\242#X\244\350\272\236\022@\177)Q\251h\305\205$\"0EK(\025MX\317\024\300\013@\353\231\216@\020\201\033N,\242)\210\225HLA\370\260HWT\210\006\321u\203\352\303\240B=O\030\022\201\353ohT\372A}%\254)\261\204\206\024\005*\001\327!\232\004\354)\252B\265\2704\324\204&\rK@\3273M2\236)|M\304\024*~g0\205\006u\t\2504$\216XSb\321g\365\211\200\264\016\201Fm\002&\037\272\236\251\017]\317\244\242\321\027<\201)\252\026\255\276\020\353\020h\354\035\tiD\006\033\300"
+	.string	"\005\364\357HU\241\236+\210\237\022\210!\360\024\202\370\245*\210\243\242\024]\177gz2\375|+\221\230\002M\205\202D\242\004|\345\377^\021[\305F\213:\311\262\254\326e\315\016\026\"f\234\230\334\224\323\315\275\236\220\336\230\255\252z\223"
+	.string	"\264)6T\206\2747\026\244\306\307\025.7\367T\300b\360\204\314\031\200\223\236\217\236\217\236\33018\355\375\2647\227\230O\326\324\334Y/\310{bW\312\2505p\304\334\334\003\362+u\236(!ss\357\307\257\304}\371\332q\363\343\374\312\177\236\\c\n\022/7\177"
+	.ascii	"^;\250\347e\346u\325\013\303\362&\027G\013LI\320\013.6u\276\274"
+	.ascii	"p\360\b\203\301\343=/6\236(?\202\324\335\334\343Bz\217\207\003"
+	.ascii	"\304\300\216\364\272z;\214\250\201\005\205\237\250#\262#zD*\345"
+	.ascii	"(\020\345\220B\312\241\021\232q:\263"
+	.string	"\025@0PT \025j\233\344>\023\200\203\313\254eq\"&\241b\204f$I\312'\2056\003H\212M\206\372mA\210\334Ol`,\225\346\235\375|~\262x\006K\217\231\255;\307\031\244\006Z\363=<o~/\022\346{\310\331V\334Sn{k\232\267$Ud!\016\316$\0339\2609\322\236<\256l]Z]\220*\243T\025\277\210dp|\244Uj\271\241\306\363\363\274\r\374\261(x\300U\314{A%^1\366\343\225uh]\021\323\335<\256u\354\2142G\237-\241\027\304y\\\3158\017@\206K\">\023\001\005\3214F\227\034\260\033@\277\026mc\262)KH\207\345#\311\335M\b\357\342\342(\371\034\230~@\317~\361\024\033\273\020\254$\023!6\346]\375\350\373\344\023\370.~\226:R\325\"\230\321\2036\022\032\233A\201\220Ko\210\2653\322\337-\241\252\245p=\233\204\316\035\002 \353"
+	.string	"\226\005\2348\0163Kj)\341(\005\211G@\263\003`\317\311\240\0359\036\370\243s\350\037\277\267\241\310\326\366\273\026~\241\302\366\225\362\217\217\031\353#\2316m\253\0052\205\233l2\025$[%@\252\340l\361\t\220.\233LV\240\345~"
+	.string	"6)\371\034]`\240\337\315i\204\"\364\222`\227\fh\214c\231G\307\035\242\n\375\357 \322"
+	.ascii	"\231g\311\364^p\215B\200\211c\267\361\210\330&\347\232\314t\255"
+	.ascii	"\236\371\355\375\2214\305X\213'W\313\003\276\025@\242\276\271"
+	.ascii	"\3379\357RTf#\\\247A\206\223\231\2503\236#[\354\202a\340\242"
+	.ascii	"\276}\346\023\265\217l\377\211wi\0031\341\200\270e\016\244E\275"
+	.ascii	"k\352\026\373\311\305^}\"\272\013I-/\225\234\365\323O\226\234"
+	.ascii	"\341\2566\261Gi\301\332m\031\333,g\333 p\373\200P\016\211.\300"
+	.ascii	"\367\251\367\214\263%*k\032\314\370\030vZk\275T9\2209\340m\356"
+	.ascii	"\371\003$\220\303\334\250\341\310\204Q:\371\311\2269\204EL^\200"
+	.ascii	"$M7\361\\\325/\352\006\355\3124\255\314\322\025\232\237^\322"
+	.ascii	"\302\347\270\r\302\006\215b\317\205\317~\343\353Z{Z\321b)\321"
+	.ascii	"\031\210g\246\325$:\223E\016k_\246\371{]\330\247\220\361\305"
+	.ascii	"\210\244\234\253\261J\033\246\226\360).[\244\314\222\363\210"
+	.ascii	"\316E\315`r\002\312O\232Y\353@p\332qd\260H\3538\003\013^a\235"
+	.ascii	"!\n\005\266\332tC\341\035Y\346V\207$\223A\337@\337\361J\300@"
+	.ascii	"\267\261\343\025M\205\230\203\354\200$\036\002\244\263\357\344"
+	.ascii	"|\245\375@\331\301.\230:\351 \312j\234\250Py7\311\306\367Bi\017"
+	.ascii	"\334{\327\322\341jPsM\201\211p\001!\006\201\231c\203u\247\221"
+	.ascii	"A\024;h\021\202\035\315\223r\263\260\200W='oa\201<] \243\177"
+	.ascii	"\257\303\2006K\2407A\374\3547F\313\215*\036\204&\r\265\201\220"
+	.ascii	"3\266\020\236\306%4sC\240\221\207\242\2461\300\021\303\352\263"
+	.ascii	"$\005\244\300a\274"
+	.string	"\322\217\272\302Q\316\0304\373\344\262\363\220\300\203\270\235AU\323a\350\216\013\212\377\345\260\333C\271\201\003s\316G@a\356+\242[\013d\0318\250\300\177 \317\310\321yC'\210s\351w\004\271r\034\327!\006\335\013\257.\367\326yt\007\375\226\021\232\310\220}\376\323\303\343\345\371DI\252g\366f<jw\240\247\211\332\2320AzJ\t\257\214`p\034'\332|\0204\230\204S#Ge&\213\277/!\314|\347\362\034\222\306\231\003b\360\032\2235\207b\001\007:\005\357\360\326g\234\f\226\272I\302\257y(\321\023\377\203_\332\366\232\333\r\240\243\267\f6\310)\265\304\311\365G\343\220tgP\207(\204g\347\367I\377<\244o_\270\r5j\231\035h\366\264\311\324\006o d\270b\367\022\334xu\214v\314ji\342H\221\254\003,Aa|\350\003O;\205\031\320\334Mx\006\3011V\027\350\325\240\211"
+	.string	" \3570'2\212\331\376E\037\305'Sb\212\314.S8\330\rJ\017\342\302\350\341\357H\237\335"
+	.string	",\300\233\235a\003\t\330_\211\017\024\356)\276\177\237\005n\201\326\\\016\356L\221n\212\325\240^)\313u\241;\215\370\256%;\23245\ni\350\267$Z\300*\217.\331\374QQ[?%\320\363h\333\216R\211\016Hf\211\351\007rP\241\205\336)\300\r\360\021\302\323Uk\374\306\017z\303\371\305\023\203\367s\350\337i\317(T\200\323\254\250\013U\324\b\001Y\206\344)g\335\034\202d\343W\311\2070P\224\264P\304x_\327%\250\031BbP\302\362\004x\247\034\370\352e\274\205\005\330;\307J\003\203iD7\t\017\031\\\377\206^\207\313\003\362\303_\2616\223B\221\231\253\210\200\037\253+P+\001\0373\363\234P\201\273\325\261\245\2747\n\323\243\343\3569?a-%\251\347\311k\374\244\220\320\331\225f\303YSr\035S\241u\336"
+	.ascii	"*\037\246\276\353\350/o\255\\yZd\346\027 ^\257f\266i\200\375"
+	.ascii	"\340|<\312b\361\361,\257\032\246\353/zu?\n\322\322 \253\"\"\205"
+	.ascii	"\247\223\350G\037zs\030b\200\004\233!C?z\202E\177yo\223zLu\311"
+	.ascii	"\360V.\225\265\274\2361\346\360\265\311"
+	.string	"\24540\245O]\310\034!\246\302\220\244\016\213T"
+	.ascii	"\254\2423\253\340\024\025-\220\216\336lk.G\305`\rdv\277u\301"
+	.ascii	"\343K1\271\347\234*\346V\363\346\276\363\252oH"
+	.string	"\006\204\005\225C9\365BB\373\277\230\337\235c\262\326\306\020\373\360Z\304\177\037\213\3560\364\276QE\231\240\371\023\256\030\335F\r\n\025\211m\227\247\367\275\300\004%\373\325\363\021\332\232\252\313\350\336U\232\211\213<\225dN\"\276v\225\bEQ3.\341\233\006\335r\324\222\271h\353l\024\267b\207e\017\013\035\276j\245\367\201\233\207\206\255\255%\352\b>\343\233\231.MT\004J\300\214\365\330\266\2079\257l\030\320\216\225\246\030\310\3334\365\301\210C\233k\033\235\372\267\354\006\2608\264\rw%\355\316p\034K\016%:#\037\\\230\317_\004\354x\374AW\201\215}\r\240+h\026\214f\315\342|\333\200\275\021\354qk\276\001\006\306)\350*]T\032s\331Y\016*\0033\274 7\326\027\203\032A\334\"\321Y\300\035\354+\274l\237\370T\324\001bg\256\343\017\360s_\260\212RA\227\370j\306\254p\252\240"
+	.ascii	"\336\330\246\031\203Bg\311q\233\264\312l\230\354F\350&g|;\r\254"
+	.ascii	"\301\374\3569\236b\ne\270\026\354\242L\366\376\273/\354Z\341"
+	.ascii	"\223\r\222\344\2428\312b\355\330O\207xE\307\321\032\243\220\316"
+	.ascii	"\303\026\252\277&2OV1\217\362R\312f\342\bB\242Bcz!\324\3108."
+	.ascii	"\306D\b)\020\277\272\362\315\033m\027\245\276w\373O\353\376a"
+	.ascii	"\303\200q]\343\203-\226\017Z\"\217\320\226\242\261|\2117\202"
+	.ascii	"{\346&\346j\252\2271K\352\327\2500\271\033nW\223\021\213\\n\221"
+	.ascii	"J9 \352\357\340}\3233$\212N\251!\035\224\235K\t\343\277\231\367"
+	.ascii	"\272\330\312\243P,t\t\021\024-\366kDdI\223\265\263Z\026\2076"
+	.ascii	"=f5b~\373\333\221\243y\272\331\f\037\315K\261&%#Q[\315b\244\344"
+	.ascii	"\231\f$\245\360\276\021]\367\250p\353g\236\215\217\334\3022\031"
+	.ascii	";\272\201p\b\235\241\347\234X\263\361\371\003\007rB\223\364M"
+	.ascii	"\237\032! \252C\320\020\264X!d\333\375A\365\3559*\360\213^9p"
+	.ascii	"\342\224\273\372^riZ\023\231\007$\370G\345\006\311J)\200<ez\242"
+	.ascii	"\322\002\3149\221\375\t\363\356L\343c[\365\246\2443\036\031^"
+	.ascii	"7sk\225\346\365\362\345\236\025>\3640-\244U?\373\275\312\376"
+	.ascii	"\03308#\315A\207!\320\363\\\213\001\205B\\\f\340\340d\251\321"
+	.ascii	"\316p6\251\325d*wxsf\035\033/\3375\250=p))\320\t\021W)5\245\235"
+	.ascii	"\326[\322\332\3552\225\003\003BJXj\033\367\001h\020\240\373\322"
+	.ascii	"F\321\334\371\006\206\316\253\377\356\335\036N\364\240\005O\207"
+	.ascii	"\307\224\342\336\351\003G#\344\226\254\177\001\375\320\201"
+	.string	"\262yv\351\356\023\360\244\267\313s\311\253$b\345\366\332\254.\321\r\036=\224\241t\305\334h\353k\327\021#\031\240\342p`\307\375Z\034\236\253\037\255\037a\022\321-\325\001\036i\007\217\2647=\024\344\025N~\301u\247ajk!\223#\257Q\342\030\217\004U\206&Ee>\031\0241\242\230\351J\241J.\367\273\250\271k\003!\005D\342\304# |\274\024\334a\367\316\031\257\221\261t\224\255\346\n\375\263\255^\030[\\2\037\370\3678\236#]\233y e\354-\263\334'HNBU\354\205d\005`UN\230\235\350n\207\002\277\376\260\313\301\376\220'\362f\237\214D\241\375\256\321C\367\022L\323\236\214\335\204\354\033h\243lUW\031L\306\305\261\264\221L\004\002\350\320BoP\325\026\026\346\315\346\250G\277\266Nt\002)\262\t\310\307p\nk\001Pl\373\343d\324L\370\200\260\007\353j\001\t\374S\264"
+	.string	"\020}\024\306\273\006!\020\235\365v\332\002\331\272 F,\210\006\262~\347\""
+	.string	"\335\210P\\\372\n\336\310\3167~HIx\020M\362%\031\241"
+	.ascii	"\327\254\016\013zv\367\006!\262\360\245(\307\275Q`\255\224\r"
+	.ascii	"J\327\n\326\223\262\204c\300r\224Jj\262\266F\300\003;:\301\331"
+	.ascii	"\215\361"
+	.string	"\212\330\b\345]\340\222\275\363\214P\364\217h\336W\036\007hb\004r@a\212\232\243\313\3711\210\337\033\221\223i\311\226\246\314l\331\315\335\232\016\245g\322\231i\343\245\033\362\035\270\353\340+\013p\330\236\207\274\352\244\007xI\034\024\245\230i1.\375Y\202\316\336\017\262\232K\266\335l\207\311b\\\223\223\364\341\032\217S\250\002\361\032G\351\273Cd\221\241n>\325\322\t7\001q\307Y\034!\372R\314\021\212\305<\210\351\037%\212F\260_\244/C\357\222\376M\240m\r\373'\224w\004\371\313N\251\333\236\241[\275\371V0\311\354\235\337\315\214\006\257\037\375x\324\264/\300\323pY\230\r\374\211\237\206Fh\246\303\2216E&\371:\256xn\212\310P6\1779<&&\206\311X!}\021\277\354\331\262\260a\314\006\371\215\366\3711\023\213q\337b\357\357\346_\231\356n\276z\304\327\214\377<=^\2709Q\354"
+	.ascii	"\320\177\270\235\326\351\346\313\034\236\311\347\274\257/\246"
+	.ascii	"\01614\253\247\377?9}\237\033\007N\036\317\313\353\bkc.\374\314"
+	.ascii	"\375!\323\273\225c\325\333\340\242g\263\262\263\355\211k\346"
+	.ascii	"\255\031`\177\243_\353x\362\177\373\344=\363\006\214l\370`v\356"
+	.ascii	"A~\361\372\037wG>9n\177j\362\263\342\374\031\216E\215\214\271"
+	.ascii	"/\305\321~\372g\322W\001\367\031\324\246\371\374\345\375\353"
+	.ascii	"\206\251\254c\207\266\303-\350\212d\357i\335\240\354\275\361"
+	.ascii	"\323\f2\\\017\013v\005"
+	.text
+	.section	.gnu.lto_.symtab.42f30e5bf8f1c9b0,"e",@progbits
+	.string	"fcTasksInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"cfTasks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"currentRxRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"taskSystemLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"rcdeviceUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"pinioBoxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"mspFcStreamProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"subTaskTelemetryPollSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\003"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"rxGetFrameDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\003"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"rcdeviceIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"dispatchIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\003"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.42f30e5bf8f1c9b0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1123 @@
+	.file	"failsafe.c"
+	.section	.gnu.lto_.profile.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`\346"
+	.string	"\365\b"
+	.string	"\024\f\332\001"
+	.string	"\027"
+	.string	"\342\312\307h\f\002"
+	.string	"\002\001\002\002\002\001\002\003\002\004\002\005\002\001\002\006\001\240\342\234\212\n\002\003\206\233\270\374\003"
+	.string	"\004\374\357\377\234\002\n\007\002\b\002\006\002\t\002\007\002\004\007\364\272\233\034\002\002\n\002\001\b\344\212\333\215\005P\002\003\004\007\002"
+	.string	"\002\001\n\255\200\342\340\013\024\n\002\001\013\345\227\312\267\013\001\f\236\233\221\355\007\002\r\324\210\217\002\002\016\353\262\334\316\001\017\302\327\301\252\013\020\337\246\213\313\r\021\370\264\244\335\022\215\210\305\275\016\n\002\001\023\265\272\243\371\024\304\221\346\213\006\b\n\002\001\025\353\303\321\231\004\026\214\266\217\340\001\027\353\210\377\210\006\030\302\275\376\223\017\031\240\342\234\212\n"
+	.string	"+ \220\0022*\333(\304\r\201_\023j\363\314F\231c\265\207\255X\212u\005a%\224\031\215\330u\317N\312\202\021\201\325\004\344),\300o\004\334\034\274\034\266\004\007\230\274\265\310\002"
+	.ascii	"\260`y\301\b2\002\306\001n\001\234g\302\"j\267\013nc-\3415\235"
+	.ascii	"\n5\323\342Q\0047"
+	.text
+	.section	.gnu.lto_.ipa_sra.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375 \217\315\002"
+	.string	"d\003\203"
+	.string	"\021"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001\004\007\b"
+	.string	"\n"
+	.string	"\001\013"
+	.string	"\001\f"
+	.string	"\003\r"
+	.string	"\003\016"
+	.string	"\003\017"
+	.string	"\001\020"
+	.string	"\003\021\001\022\023"
+	.string	"\024"
+	.string	"\001\025"
+	.string	"\001"
+	.string	"\001"
+	.string	"\016"
+	.ascii	"\250\300%\034S\312\032\241\232\334hK0\211\232\305\345.\202:\300"
+	.ascii	"\031\344\354\003\313\242,\005\003,"
+	.text
+	.section	.gnu.lto_.inline.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`|\002\355\t"
+	.string	"\262\214*0`k\222\016\324P\017\3731\020\361\2475,\320m\242 \264 q\274i\320\023\006F\266\365\n&"
+	.string	""
+	.string	""
+	.ascii	" I\323y\373\375\250\361N-\"[\356\024?4\003cb\363\\\200\231Nf"
+	.ascii	"J&\230\312\332Q]`\332\003KkS\371_\210\377M\317\224I$\021\220"
+	.ascii	"pHZS\263Qx\020\315F\220\270\033\302c\367\265B\030\021\371\205"
+	.ascii	"j:\025\307\205\364\217\241\024 \036\325U\034\220P\215\347\237"
+	.ascii	"\235\245\034\315\206\205\201\0051\234\313G\364\372s\310\314\313"
+	.ascii	"\367\217B\200\361\257\365\277Wjff\344\251f2\263\322?\205Bd\346"
+	.ascii	"\344)cC> `\2422G\325\003\345\005X\256\247\rn\271br\230\0314X"
+	.ascii	"\2705l\3536\340\320\026`\373a\032\202\035\312%yy\273\031B\206"
+	.ascii	"\325 \003\337%\236\024\331\t\"\203\301\270\306m\362\234d\"\305"
+	.ascii	"!y\225,`\276\200&Ef\235\200\r\037\332\013\342\003\023\360\206"
+	.ascii	"W&$\303\241<\002\341a@\213\337\020C\016\025\nH^C\362P@.\211\210"
+	.ascii	"7\340\fg\217\034\202as\301\215\354@\004\023\227\325\260\374\265"
+	.ascii	"A\363\020$\325\377\n\266<+\257(C"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"m\004"
+	.string	"\322\006\024\033\220)\351\370\357\356\256[\334\373\210\356\356\356\312\371\003}\322\f\341\003\331u\023)S\377\t\007\342\377\360\033N\031\205L\217\276\360\204\037\274\340\317\007.\345\203\355S]\333r\035\033l\357\250\214\031\027\3407\204\312\323\022\203\320\022n\020.\256MS\021\031"
+	.string	"T3"
+	.ascii	"\306\205\022F\231\272\311\024f\200\324)\316c\320\240\020T4\325"
+	.ascii	"\210)\rhf\260aV\\\013 \367\346\rh\027\2250\251\316\365l\017\b"
+	.ascii	"\001\343\312I\314\022n\001\206"
+	.text
+	.section	.gnu.lto_.pureconst.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\230\004\003\230\004\004\230\004\007\230\004\b\270\004\n\230"
+	.ascii	"\004\013\230\004\f\204\004\r\204\004\016\204\004\017\230\004"
+	.ascii	"\020\204\004\021\230\004\022\230\004\023\230\004\024\230\004"
+	.ascii	"\025\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"\365\004"
+	.ascii	"\342\305\017\025\2407\035\377\377\377\377?\323O\215\226\232\314"
+	.ascii	"\376\363;B\244L\001\377\317c]\252\3354\r\235\342\b\016_\263\360"
+	.ascii	"}\036\371\203V\002\033\254|\225\311\323t\252\316k\031\225\317"
+	.ascii	"T\216:O{\232G, \260\002\221B\333l\331\007\030\\'!{\263\036\016"
+	.ascii	"\210\233\340\013\tlcs\270\345Xf\204D\t\2607n\234\236\021\260"
+	.ascii	"\247\004_\211e4kn\331%yfaa\002{Z\351\2650\274a0\003\240\335\r"
+	.ascii	"\246\266\273\341\244c'i\201T\214A\311\2667lW\257\235I6\264\""
+	.ascii	"\270\001"
+	.text
+	.section	.gnu.lto_.lto.9e56bdfaa846f986,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_failsafeConfig_Registry.44.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375 \231u\004"
+	.string	"\004\bb"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\203\304\221\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\374\006us\317\006uq"
+	.string	"\005\001\006'\001\b\201\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_failsafeConfig.46.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375 K\r\002"
+	.string	"$\003>"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001"
+	.string	"\n\004\005\001\006'\001\344'\001\350\007?\202\210\2000\177}\300\001{\277\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\005"
+	.ascii	"6\303\300\035h,E\300\001\300\001"
+	.text
+	.section	.gnu.lto_failsafeProcedureNames.47.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375 \254\025\005"
+	.string	"D\tX"
+	.string	""
+	.string	""
+	.string	"H"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\370\231\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'8\206\b{\370\316Qy\276'>\206\bw\230\316\001u\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\013GPS-RESCUE"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\005DROP"
+	.string	"\nAUTO-LAND"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_failsafeReset.48.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`\313\001\215\r"
+	.string	"f\227VD\020\2176\035\234\264\f\335\f*\025\302\304V\013\215\363p\273X\245\301(v9\366\220$\004\310J\226Gv\020\360r\246\360\215\023mBg\376\257\03777_]\201@\b 2\025\024\013\252I\323\356\323&R\246\024>"
+	.string	"="
+	.string	"I"
+	.string	"\326L\347\323\027p\305\260\320\200\261ka%ca\342\312\006\333\307,\262_\234d\262O9!)\205\273\233\251\206\213\236\"\377\036\256\371@\n\317\314\201\335u~\340\205[o\273\200m\003v\202\0047\313\225\252\252Q\032\341\340\345\312\327\324\223\304\230;\b\020"
+	.ascii	"\273\0258\374\017G\t\371'\217\236 \222\377\036}\221\353\361\032"
+	.ascii	" u\352\200\322\345\312&y\251\031\354[\253%\266\246c\246\255\314"
+	.ascii	",(@\227\260\301WL\230\311e\344\340'L\230ZB\325\210\333\332K\220"
+	.ascii	"\320\244ZF\252\356\236\313\336\\E\004\006\236BUT\233\363\222"
+	.ascii	"g\200\311\356r\370)\017\261A\370|\256Gk\306\027\303\322x\025"
+	.ascii	"UK\243\213\021\f^\213\336lp:Z\350c\323:Y\310\003\317\366\321"
+	.ascii	"\311\"l\332'\333\200B\331\006\001s\0228\240,\204\343@\031F\352"
+	.ascii	"n\255\226 X\301t\352\331\357\270\354\004\177\351@eR/\036\227"
+	.ascii	"\255\340+<Td@T\270\340)N)\324\210\301\003' \360\002\2319\312"
+	.ascii	"\001s\241\353d\340J\336\265]*\207\301\217\301\254\314\340\214"
+	.ascii	"\257>\330\323\270\373\260\247qI\002\234\342\353X\023\212f\306"
+	.ascii	"\367\225\224=\343\305\254-\217\304\356\340\2266#{\353$R\253C"
+	.ascii	"\002\0228\344\334m\230\310\266\203>\034\002$\335\242=O"
+	.text
+	.section	.gnu.lto_failsafeInit.49.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\265\007"
+	.string	"\022N58@o\323\001x\215\fN\226\007=.\r\314\312$4\302\004\247\035\224\216\300u\375Z\3665\237\333\206-\024\330\211\306\177\345\216\242s\"\335\017bM?'\333m\2156\331;\245\336h8\233V;\234\266Q\317\202\002\327\331h\003\2471\320\215W\251F\300\235\003\307\243\236\256\363h\026\356\255\225\244\214\007\n&%\222\023\366\353e?\374TI0\225\225\216\177.\033\342#\037\200\322\356\032\370!\027\211\360M\237\226"
+	.string	"\305\203\237>\350\372D\2500e\200\270\210\342\312\016CQj\330\267V\222l\353 \245j\tH\331\265X\305,j\242p\330~\346\317fyX\332\237L(JT\273K\345\306\277\307\317\377\307\t0^\300Q\350\021K\330]Gptq\313\333\036\260]`\373$\013"
+	.string	"3\241\241\037x\311\334"
+	.ascii	"6\361\224$e\025\206\256\341q!\214\227!\300\245\353\264\363\t"
+	.text
+	.section	.gnu.lto_failsafePhase.50.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"5\007"
+	.string	"\362\r35Po\322\001 Od1>\374,t&\340\303_\344\341\177\332F\321\254h\026\265\036W\213\025f#,\254\02523n\\\003\375\322\273\367l\213\377\226\354-eJ\001\346l:V\365\361\\\225\005A\n\t\227\307\202\fW\265"
+	.string	"9\331\007n2\306\032:\031\004aX\0061q\357VMV\rI#l;|D\003\330\335\003_\344\361\301\337\3703D(\277\375\371!\352/5 \204\224';\216R/\354\273U\223\355t\352\245C%c\262;qj\331\224W\302a[dc|\217\177\210\254\271\250Q\022\2608\221 a\331\215Ps\002\352\317}\200\372\323\214kO\315?\310\335J\005\312V\032=/\b\273\353\334J\024\267\336v\201m\003\333\030\001\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_failsafeIsMonitoring.51.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375 \365\325\006"
+	.string	"\362\f05Pm\222\016$\307\250J\270:k\2376\375,\355\374aj^\276\252u\303\376\335\216\266\260;o\304+\232\366\17733E\212:\223Z\2464\023.\302\216\326\b\221)c.\031\253\332h\256\312\212\234\005\205Kc\305\206\253b\210\230l\023/\2261\207L\0269\030\226\305\n\227\205\243\341"
+	.string	"\bJ\374\017\375\320\0022\023\341z\224\004q7J\035\321y\335J\335\016@\251\007\005H\240\327=\367y\020\343;%\034\375\357\007)%\022K\227\031\352Nr\204*q\374\236\257lp\340Y+\247\021\352\205\310\004\210I&\027aF\265>\355\266\243S\211E\310&\372\364Q\0222\363\267\211(:\354O\360\027\374\025\001\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_failsafeIsActive.52.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375 \365\335\006"
+	.string	"\362L06Pm\222\016$G\213\307r\300\334R\337\360\263\264\363\207\251y\371\252\326\r\373w;\332\302\356\274\021\257h\332\377\315\314\024)\352Lj\031\002\030\274\314\326\266F\210L\001k2\233\313\352p0\353\212\036\206\005\214sE\007\314j\210\032\255\0233\002g\017\033-z\262L\213\230.\013KC\002\021\234\370!\n\262\001df\302\375\250)\342r\264Z\342\363\312\265\272\037K\253\007\003L\242w\372.\364`\306\227JX\372\337\017^FJ\006L2G\247\225$\251D:~\320c>@"
+	.string	"\275\265\333\030\025\343\204\"D%\263\213P\243[\337v\353Q*\345\002\205#\205\372.\n\231\371\343H\025\035\366/\370\r~\213\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_failsafeStartMonitoring.53.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375 \372\325\006"
+	.string	"2\31504`m3\006"
+	.string	"?+\366)\223\0336\3425K\227\203\367P\272\241z\322\035\2465\351\225\017;q\242\027\363\326\244\243\210i\246\303\352\274\221\302\206W$I\244L)\265X\027\354\312`\262\013\233\032\206\205\f\203M\207\354j\230\226-3\255\201j\017\227mj4m\233\225w\307\320D\032\251\234x\342D\355\r\325B\230\264\021\020\375?\250=\374\021QkXV\202\003\335Y\326\034\312\022\341Sb\321\221\342\201\245\326\353\300\210\321z\372\377\306P\033\023F\037\n\201\310\377)\255\234D\216l\264uU\2565\261'\272A>\212\220\357\377\214\031\346\f\271\332\034\016\350@\035C"
+	.string	"\205\377\205\035\250\302\215n[\320\326\240\355E\007"
+	.ascii	"3\001C8\343s|a]\306\277\214\013.\335\242\235O"
+	.text
+	.section	.gnu.lto_failsafeActivate.55.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`z\001\035\016"
+	.string	"\366\031\\C"
+	.string	"\221(\035\317Z\252\222\343Z\201i?\257\354i/\366\037\017\316\315\021G\270\367\263\025\t\250m\320\377\262\214\212\252\3527$\304\372\273\306f2\377\033\340\232F\230\334!\236B!\304t@\226\020\2627\2212\245D"
+	.string	"D"
+	.string	"K"
+	.string	"\351\247iL\323\232\351|\372"
+	.string	"HV37\f\314\330\325\360\312\261\256\007\363\301\366=<\262m|\225\332\314\245Sy\231\331\335\250\034>z\216\374\233\370\326\255\220\236\231\202\335uv+\033n\275\355\002\266\017\330I Jr\236\203\266\311Wp*\020\260\220\370?\320\256\360\024\037\220\324\356\212\370(\256\002\371\036\376\214A\224\357\376|\021\374K\300\002\002u\002G)_\366\312\224\352b\037[m\261\261\264\346\245\267\227\326\260t\3664|\257F'\363\364\n5{9\2410}4\356\030\250\212\251"
+	.string	"\035'\021\246|9U\365*;\374\340- h\273)\">\213\263H\"\224\224\300\277\324\267:\250\002\244-a\202F\326\b\227II\376Hm\277\2016\247\223\357\234\254\020\256\224\346\204t<\033\321\t\267\361D\024\n&\334\211'Z\3406\237\310\t\211b\310"
+	.string	"\203.tB\021\005\004\nE\217U\351\332\302\240\204\253\244&k4\306\bH*\346\235\314\246\232\fP\323M\177Be\252\251\266\026\034fD\203\221i\266d\250\240\332\r\376\302\201\213  p\002!1\343\003\343\200QeF~\356<[\032q\035\3120<%]@%<\013lQ@\364\004s\023\310dQX\360*\344\234\321\326"
+	.ascii	"\254\303\216\006\306\255\341\354\032\255H\336\226m\002N\016\263"
+	.ascii	"r\320#\007\202\332s<\004\250t\213\326<\001"
+	.text
+	.section	.gnu.lto_failsafeApplyControlInput.56.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`'\002\305\021"
+	.string	"v\241sF\340\322&\035R\317\025'J\211\254\016\034Y\325t\004\201Pt\362\344{\211H\350\3511.\241\342\345\016\247\255\031\223?\214\020[\334\352\252\240B\233C\2101\206\363\034\301\0057$\030/F\263\313f\221\021B\366\2262\245]"
+	.string	"Z"
+	.string	"a"
+	.string	"\002\266\307\233\314\262s\374\323\260\334\214\347F\250\307\356z\232\301z\370\3351Y\347\266\b\265K\226/k\235\273\360\r\212\354n\210\314\006&\330\335\177\260\214 >;\207\004\256\335\316;hB\264+n#\007\003\344>\324|\376\363\304\221\2752\271\223\335u\306d:7\200\333\326\261\215\300N\007\001\371\330\243_\263=\246\376\347#:E h\256\254\331\337+uf\3779FCI\326\036\373t\240\233\323\364\226\351\250i\230i}:C@v\3248P\333\265P\363\2614\242\013\017\007\272\375\020\376g\323E\234\306:\220at\255\234\256\204P\007\035\273\213z4I\367h\340\003\266G\370\206\271\n\224"
+	.ascii	"7v\327\304Oq\"\006\rRR\214bH\256\254Y\025\352o~\370\301Q\244"
+	.ascii	"L\374\204\312JK\313\366\250\372\357#H1\224tw[\320\246\264%\274"
+	.ascii	"\344cVm\211\030\r%\251\316\374\177w\267\323\236|\314\226\n!\b"
+	.ascii	"\007,\227l\257N\"\246\333\205)\360G<h\306\347\360h\n5\001\252"
+	.ascii	"[\245d\205%5\343\242J\261x4\021ZT.,\336\004U\352\305S\221\231"
+	.ascii	"\361J\nx\005\263\"\343\321\254V2\236\351s]{|\342\322\027\267"
+	.ascii	"\225\274\b\345\364\"\223\242n\013\336\"\305\"\242\\3\224h\337"
+	.ascii	"tfN\006<\251\036u\250s\212\343szZ\320\021,\227\016ww#\3119=i"
+	.ascii	"\205\r<lx^Y3T;- \220\202)12\017\"\002V\r)\223K\237\354un\306"
+	.ascii	"z\324\302J\001\312\305\036C\306\246\026\227\"\302^\310\277\263"
+	.ascii	"\246e\332Y\033\245\235-H\307\2020\032S\210\305\024\253\246u$"
+	.ascii	"\214\225?\252\320\031J\247\013\202'-2q\025dE\230\fn\323G\210"
+	.ascii	"\223\031\214\013\335\354\325 \260+\330\204k\357\2616W\004\203"
+	.ascii	"{"
+	.text
+	.section	.gnu.lto_failsafeIsReceivingRxData.57.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"E\007"
+	.string	"\"\01634P\215\322\001\247E\214*\247\336\315Z\322+\213=\302\356gXz\356S\3156dO\037\r\264\240o \355/df\314@\270\270\277$\317U5\202\375{K\231R\316`4V\245m\256\312\212\234\004\204kc\305\205\253R\210\231L\213\030\2131\006M\0269\030\226\305J\267\177\253%U\001\220\206\374k\223\253\352#\021\241Bn8\207\006\260\273\006\376\306O\016\276\305\241\037:y\356\320\357L\016\257\026\212\023(Sv\367I5\331\177\253%\333i\315\364_@\311\307\005dw\224\032Y\017\210\302\260\355\261+&(\360x{71\272IC\324!\262\333E\225\370\366\334\374g\034FT\204p\244\317\223r\260\273N\216\004q\353m\017\330\276\330\276\b\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_failsafeOnRxSuspend.58.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"E\n"
+	.string	"\306\323H? M5\035$\004\202\201\n\233"
+	.string	"D\251\231\034/\2279\001/A\346\013\300$\037\254\032v4\335\200\001\021\003\204\\?`\230\200@\fb9\322\336N\302\277\020\315f\177\354\305M\373\326\035\245L)3"
+	.string	"3"
+	.string	"7"
+	.string	"\024\310c\306'\326\343\343\026\326\243?\273\304\303\323>\265\001A\352\304\356b\372\340\337\363\363_\341\021\220\004z^"
+	.string	"v\327\t\222\024\334z\333\032\266;\354_\004!(\325\201\375\307\356\256\325d\037\365\307Lk\2463\323\277$\013BP@\354&X\245XU\374\020Ab\373i\177\302)|Gy\216\354\2268x\330\r7\034\031\016\232H\275\252\306\016\243\006\242\\\371\032q\317\212\232z\221\030I\020\271;\006\017\262\273\034\276\205_\360\370\020\036}\340\223\007\037\375\217\365x\215%\021(P\241\\\331\001\230M\3432\001\230M\306\351<\003:O\205/\225,c\3514\232%\203u\n\020\3204\031l\243Y\f`\027\256\303*\030\3368\031\207u\266\215\303$\341\376\261jr"
+	.string	"\006\252\220\212\254\252\301\233\234\002\r"
+	.ascii	"2\241=h`<\020\022\002\001q\217\220A\024\330\205T\013\006@p\261"
+	.ascii	"\201XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_failsafeOnRxResume.59.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\315\007"
+	.string	"\322\21656Pm\323\001d\354\260;m\325\350\265\332\001%+\360UDL\221m\034\253\270o[0\372\177;S\330_q\354\2533m\314@\214\316\004Y\306\\P\365\323&r\247\024\276X0\227\265i0\353\232\234\005\005LsM\006\314\332\314\213\266M\213\200\263\006\21469Y\246\315\352\333O\253\241\004\r\320\243\037\377\031\312\306\376\221\361\250\220LJ(W{\363/\013\020\355\356\201\317\361\016\007\337\342\322[G\372\035\352R\206x$O\f=E\373\001\"\336\273\032\200`\200\037\355\354\257\213Ja\177Z\r\331\217>Ue\224\024\204\273\022a\312\202r\344\302\366+s\366\311?\321~$\0221*\355\356\324\212s\217\234\377\215\003x\240\356\261\202\260\273\216\036h\342\326\333\036\260M`\233$\f"
+	.ascii	"3\241\301\037x\315\334\005\333mJ4R\261+\317\365\\\310\351\202"
+	.ascii	"\365\227q\301\245[\264\363\t"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.60.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"\265\n"
+	.string	"\266SI@0\247*\035P4~\\\377\363,4\336|\373{W\305\327[\315\031P\276U\347q\251\006\0319\205M\260\341\276\305\377kQ\310\316@_\031\006\212\260\3143`\206+\265tD3H\301\032\331R\246\0246"
+	.string	"4"
+	.string	"8"
+	.string	"\034\261\007s\316nC~\272\\=\371w\335\022\212\250\313\312\307W:\324\n8X\020U\022\263\032\t\357\272v\210\240j\002\304\234\323\032\212\0367w\333\021\2663\3663\001R\355\f\r}\370\325\b0\231\201\213\262G\224.\210}9\227e_-\257\336\253o\271\030P\240\241\315\271\272E\2303NFb\373\027\237\354\005\037[\3631\004\001\023\260\004*\265y\367+\227k\260Q\002\352\315v\305a_\005\300.\203\214\006\341\365\265E\037?Lk\316\371\340\277~\202\341\213\2343\311\304\371&\3129n@\310 \2457\007\356l<\037\016)\344q>]\211\002\344\205>\235\205\307\021u\235\021\251\3334\370\273\360\214\272\322\367\215\272\3138\277,K\034\230\245\026\224\nj\203<}\350}\313V#\260\001\376Q\344\006\022"
+	.ascii	"3\003\3369\344j(\234\331\013T\363\340\265\261\005\022\232\365"
+	.ascii	"\340\275O\211A*v\345\271\236\0139\317`\377e\\q\351b\266C\003"
+	.ascii	"SP"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataFailed.61.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`\006\001\335\013"
+	.string	"VVO=\020Q\225\016\310\2213\325' \200\004\210P\315\375\237\344f\213\311\236}"
+	.string	"\320*9`\226\232X\322\254\325w\306R%\2617\f\002"
+	.string	"\005b\005\"\334r\021`i$}\t\2405\262\245L);"
+	.string	":"
+	.string	"@"
+	.string	"\037l\377\362\307\206\361\217\2647\275\260`J\355.\246\034\376y\324\374\370\217I\244\363\266\307\rW"
+	.string	"^(\026\330\335\213xb\360\270\314\307dw\235\235\247\341\266n;\201m\003\366/\004\031\032\222v\204N\276\273\0368\305"
+	.string	"9\335le\274\004\207=\201B\276s\236Z\200!\335\354oK\035\331\217\253\"\373\351\370\264>\235O\377\272R.$4v3\204\253\005\255\025\001\252\312\300\004\213P\326\260\235=\005\212\250GuH\275\252Z\250\n \270\fmWn\302@N\244\006(\255T#\256\266\345%0\002H\273\213\300\377NB\363=\334\262\003\215\345k\034\267\342F'\003\024\256H,\227\254\223\321\262\013\346i\200\3212\027\354\201\226i\260\n\247\203I\bx\003\301\302\301<\233\r\007\273\276}\\\025)P\201 \345\242\216Lq\330\013~\242\f \251\210\2246B\314"
+	.string	"e\230\273\273\251\216b\027"
+	.ascii	"3\241a)\260\205\267D\320\222\036j\021\210k\204\344V\023\316a"
+	.ascii	"\335\005\333\315J\352Z\t\006\304}J\fR\261[\236\013\272\220\243"
+	.ascii	"aly\031\002\270\374\300(E\325\330\256R\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.62.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`}"
+	.string	"5\n"
+	.string	"\006\023G?0\247*\035e\274\177\037\312\324X\216M\307\201\252\373\304\204\355\235\021\223\323E\336J3\243U\366W6\204\261E\3205\013\243?\365~\035\f\fC\024\031\240E\005\031\013Y\300\r\243\355\275wJ\0014"
+	.string	"2"
+	.string	"5"
+	.string	"\246\327lw\253\024\351b\367)c\347'|\243O\n\307\345dH},\330>o6\030\200\231\316z\324\370J1\036Xv\327\361\364m\334\364\266#l;\330\237\001\262\216\324Z\246\354\030=\351K`3\005\265\266\213\2521X\030-@b\373~\353\240\350\002,C\b"
+	.string	"\330\335\355\324\026\331\333\3517wv\354\341j\377j\020\223)\317\272\202\353\300H\206 A)\322|\320\236\017\bQv\367\301\017\357\302\360GN\235\001\212?\235\372\240\311\351\224\007\037\003\240@<Z )\326\354\320\213R\025\306T2\232\213\207\263\271h\352gBb\303\321\324\212\315\205\242b:\236ZY0g\221\351\324\017\307u\352\026\222\274[H\322\363&B\264\271\213\370\223\245\034A\254h1)U\266C\001\017"
+	.ascii	"2\003\303\341\306X\240jI\036\n\373\271\317a\243\322\343e\\\320"
+	.ascii	"\341(\323\2032\361\322\3048\347\232\022\232\306\240\240"
+	.text
+	.section	.gnu.lto_failsafeApplyControlInput.part.0.80.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`{\001\375\r"
+	.string	"v\027WD\020\2176\035cA\020#\200D\301\216\223\366\037@'\251\r\005o\306\276\006\275\263\306\252\310g~\205\233\255\320\353\034C\r\206;\342\376\323\"\252+\002\020*\2022\002\n\227$2\260\270T\313\n\247f\367\336;\245<"
+	.string	"C"
+	.string	"J"
+	.ascii	"\276\267\331\226uz\017\266\267\316\234\355\342\237i\251R\205"
+	.ascii	"\007`\270\273\365Tb8w\031'\347G\321\bty\357\223\203\212\n\321"
+	.ascii	"(\302c\306'\325\261\273\256$\334\364\2669l#\260\217\"_\365\215"
+	.ascii	"}\233\034\306\364\224\"<\370\026?\304"
+	.string	"\313v\027\307X#\364\355\250\273\347\277|8\b\356.\216\251@]\005\003j\230\331\335\215S\027\250N5.@s:\277\321\234J\322\211\025\237\274\305\024\212\214%\003\276w\003\247\025!\t\212\262d9?W\246\3302\343\222\331\205\020\343\305Z\240\247\r\007\037;\023$&&\241(\300p\260Rbs\311\334\t\237\211\304\221a\206%\334\320\267\341\021'q\342\222\001\237\211t\240\003\013\226p\367\253\247\016\366\\\f\264\n\"\262\261\007\273=\256\217\016\347\023\202q:u\304\003\202\205t\252\002\214\223\240zh\237z\021p&\362\241\325\221,\323\252e;~\256Lq\007\212l eI\245\205\210\225\027\f \006\330g\032{\301'^\024* `\2021\206\273\001Ac\3148\206\352\031\030\257\216@c\324\2023Q\030\346\b\267\260\340F\235\314\304YG<\\\031c9-\373\274\033\340b[\261\215B\320\236so\024\236\336"
+	.string	"\033\214uS\222\312\003\030\241\332\027\236\241=\204"
+	.string	"\301\203\307)\336P\332\262\345\255Y"
+	.ascii	"\266\207\200\205\266\245'\2041"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.part.0.82.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"m\b"
+	.string	"\362\21787P\215\322\001`p\217\264\036\205=H\332\211\267\272\030\352\304E\220\240\265\371\261o\372\372\360\326@\213t\r\244\375\205Lsfy\351\355E\264\254\332(\353\201\310\336r\247\024\316`4\233\366m8m\233\035\206\005n\263\315\006N\343\314\214\367M\f\201;\007\2157;]\347\315\3146|\\5Y\241\2045R\t\253\352\311\266\005\306s0\273{\200'Y@\204\2045\241\"\377\036\314\376\036\342\031@\355\356\201\017r\025\204\277q\351\210\017<\351\322\377`\227\225\216\226Gk\004_PO\326\370\270j\262\343\005\301\265[\361rm\206\034\341\260\237\002\331Yv\371\017\333 \013\207l\224\253P\373\225\t\305*ew\347\245j<t\2051\344?\365\n\251$\272ZJ\027\207\227G\200\204\335u"
+	.string	"\306-o\333\300v\201\355\223\020"
+	.string	"k\023\030\017\327\270a\030@\036\030\341\212Aa\"\340\214X\3249\235\026\332L\331i"
+	.ascii	"\270\366b\312i9\375\3322\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.part.0.90.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`\254\033\035n"
+	.string	"\332\247\270%N0\220\322\032\003\326\n\3525n\025\030bl\234\021\323\203\244\361\227\006P1\340\361\363\241\275^\224*\2560=*\336L\353\016`\252_Z\216Te\276\317\363>\234\251RA\016\346\321\333\335\236\026\0032\334C\244\317\333W\262\243\333\225[\246\224RT\002\030\002M\002N-d8\"\222\271\271\355\232\013\b=\345\016dg 0\267\226\256\273\352)\243 c\273\022\200\354\213Y\024*\357\016\312\242\f\315\3730\203\006\020\344\214\373\205\246c6\262\214\236r\322)C\204\236r\215!h\314\2425\334R\032\334p\355\244\243\264\013=\307F*S\246PY\020\345\244H\021\202\212\211B) By\362\004\213\370\262\r\237<sT\r \266\260\t\215\216\233\301\315\244[p;n\006\221\022\356\375\212"
+	.string	"jEAl!Q\363\264-d[\247m\341\033\217\210\242\321nX\334\034\021\345\266\033\026Q\026\334\253c\204\222*Q\353\373\302-\265\220\231\210-4\266\260\22703\215&\273\314|\r\227\366\266\2234K'\326\367}\235Z\370O&\272\333(N"
+	.ascii	"0eB*\252\004\211\021PONMI\246%\245$$\021!\216\214@|(\"\032\022"
+	.ascii	"\n\002\362\320\341\307\247\207\003\317\216N\316\006\234\033\344"
+	.ascii	"\321\306X\254!\016[!\373\236\302\345.~e5\2123}\342L\240\003`"
+	.ascii	"\003L\254\247\330!\227\216\"\215\327\274\262S\201U\272nkZ\335"
+	.ascii	"\204\327Q\243I\244\242J\364\215q\0223\214\361\021}{\016E\246"
+	.ascii	"\255\251\347Ot\323(\321\253\223[7%\357\2708\223]/\331mq\245\244"
+	.ascii	">\244,\"\360\232S-\036b\256\217\346\250\270\321\224\0061\305"
+	.ascii	"\005\377\220VT\343\303\b\321\220\212\r\214B\215^\207\204Z\034"
+	.ascii	")-N\224\026\347\255\305qc\203\372\032\310\203t\211w\350\353\037"
+	.ascii	"\237$\335\003]s\016<;\255\231\264J\264uX\242-\324\345P\220\037"
+	.ascii	"\327nk\n\361\234!,Q[3\005\337\320\326\034Ss\234!\025[\224\032"
+	.ascii	"\275\002\001#\3227i?\034\211\327L3\363c\021\020\260\262\266a"
+	.ascii	"IpY\311\032\257Y\306\332\004.\277t[\223\314\215\254R\365\205"
+	.ascii	"2\215\327,\302\362\350(\302\354\271.jk\372\360\242\367uM\035"
+	.ascii	"\237\230.rJLh\211\3151\"qH\005\004L\254\207\316\374\352\321\355"
+	.ascii	"\322\206\013\215_K.gY%3\2730\036/'\2141~q\371#\277\224,\321\373"
+	.ascii	"\276=\327\356\365\265"
+	.string	"\345\236\323)\206T\357\373rk\241i\016\240\231\331*f\276\301\334\263\026ar\325/v\260n\236\275Q\243\320\367\354M\302\301\236\203\371\210\355J\333\033\304\264\267It\340]\002\027\205:\223\231\371\202\210d\265\031\263w9\363MjUx\307<\315\022_\272R\267QS\026\375\301\301\3014\304V\330\326f\226\355\306js\336\313\270\374\261\234\266\3363Z\027\272V\027\241\350XNY\356\031-\323{\361\020':U\322~\020\016j\211\337s]\263\027\347\035\324\016\23788\374\244\232\030\321\325\254\006\341;\255\355\337L\3020\371\313\333\373n\352\202\304\217}'{\253h\333o\2778=\245\007\2765\032\025\304\367UJq\007\366\231\001\n8\340\200\266\205\355;\351\001\205I\221\374;\231\031\253\025\276\017Y\230\270=\245\007\262\007o[\201\226y\201\006\274\231\302\247\201j\255*?\213\273\203\332\177\366\331\227b\334\177\r\370"
+	.ascii	"\367\020^!\201\004m\013\377\335\310T0\223\212i5\005m\277?+\270"
+	.ascii	"\244\333\362A\356:\236\240\253\024Hq\363u_\005\334CZ\310\026"
+	.ascii	"\260\360f\262h[\330\337u\355JxX\315\244nZ>\350\357\344O1\225"
+	.ascii	"\026\310\307\037\204\031\352\311\251)\311\324M\232\227\224\216"
+	.ascii	"\316IGg\244\033g\0217\316!\220\316GGg\243\2433\210\243\363\207"
+	.ascii	"\243s\221;\023\271\363\320\321Y\350\350\034tt\006::{8:wp\347"
+	.ascii	"\237\243\263\317\321\271\247\350\314\241\350\314st\3369:\353"
+	.ascii	"4\225\346\234\242\363\206\2433\316\321\371\346\306\031y\343|"
+	.ascii	"D:\333\034\235\2156\316E\243sM\321\231Xt\036\026\235\333\206"
+	.ascii	"\322,,:\263E\347wg\257q\356\030Kn7f\357\253c\020\315{&\244[k"
+	.ascii	"*\335r\335P\272\233t\277\365\030\020\030\313\207\353\367\312"
+	.ascii	"\252{}&u\222\246z\305X>}&uF\253\336\314c,\366\025\343\37212\030"
+	.ascii	"\253\341\322tL\375\020\023\365B\203aPm\221\300\305NY\253F\255"
+	.ascii	"\257\022n\251\2734U\004\206\341\003\227\006V,\301n\351\026=\327"
+	.ascii	"E\264\036wG\3373Zf\215\222\377\364^>\337\223\203\267\346\345"
+	.ascii	"/\357\256\351\330\305\341i\334'Q\320\347C\3505]\3177]\023\001"
+	.ascii	"\337\252\327\352\326g\205\320\321+\364\200\273V\217\336\311:"
+	.ascii	"]I\226S\020\256l\344\222\310r\372\241\255\355\364^\216W\304\313"
+	.ascii	"_\236\321\325\032f\007\302\371\026\3262xP\257\325\017ej\230Z"
+	.ascii	"\235\177~S\350\022\031\032\210.I\321;]\350>\367\231\344\003\244"
+	.ascii	"\002\035\343J\2233\204M\261\032\311k \2722\"\272\036N\355\236"
+	.ascii	"k\b\300\250YC\357\344f*\277\352\013e\204\302\260g\311@\366\205"
+	.ascii	"\273L\036;\363\355\312\301\346\205]\213\371\210T\337ys\250uU"
+	.ascii	"\357\230\013\013=\315\226:\016o\274\322$\211[\020\n\034}Q\200"
+	.ascii	"\320\262\270\322#,\306\035\203\036\230~\230i6rz\245v\270\342"
+	.ascii	">\217\254\034\255\240\371\361*_7u>RN|\333\345\321\303\035\303"
+	.ascii	"BUB\323\316\364<\223@\016\337\306.W\346x\336\311sT\370\240\200"
+	.ascii	"5s\314\265\235\036\250\234\373LJ\371#\003\205\342J\223O\216;"
+	.ascii	"\306X\205\246F\036G_\024\235wr\0136\317\333\340\305\355\371\360"
+	.ascii	"8\025-\360|si\211\2409\223\263\363:wp\356\223\370\266\363Rz:"
+	.ascii	"/4-\263\331r5\263!\347\377\372\207\366\227\227#\2307\003\316"
+	.ascii	"PL\273\317\226\331-\363%\356"
+	.string	"S\t\324\0210V\037k\250+Eb\264\002\006\n\370\204\346\236\340\315d\240\351\016\377\222\373q\243\242\335\360\356G\274m\303\013\240\347V\204\202\205\013)\374\251\262\301#\3163\273Ngs\237\"\322\326\206T\230~7o|\234\367\001c\303\f\3717_\232ah\217\217|!06\332l\376\370\275L\243\345\203j>\304\025\342Bl\276\261\250%\255\271F\274\231\306\017`\356\312\236\020\346f\323\356\221\266\370\215\027\247w\344\314.\0227\2117\263\370\311\034f\250[\237\305\337\306\254f\237\251,\314\2156\363Z\253Yp\357\344n\027\344o~\202\246\367W\363N\346\251\246gv\310\364\311\367r\262\243\320\006\231\"\006\215\035\210\360LK\031\273\031K6\035c7\341\305\346\262\360`/\301\003\274A\213\030-\b\030\001\002\r<x\021\302\213*\027UV7\030Tu`\325B\350A\003W\tl\340\"\306\013\021V\344Ta"
+	.ascii	"c\001\253\252\017\252\252.(V\305h\021c\305\325U\225\013\030V"
+	.ascii	"\037TY!\331ESU\006-\2568x\321\"\003\247\030\033h\360\202\203"
+	.ascii	"\f\234<x\321\242\003'\027VWNMA\f\343\203*+\247\0300`X9\031\233"
+	.ascii	"J\353\267P0\002\276DC\215?of\337\210\341JU\346\310\005FO\260"
+	.ascii	"&\232~\351\275X\253\227\276[\340\363R\005\340\241`\341\002\233"
+	.ascii	"\372 \234\343%d9\225\212jk\367xy-\247%\\\331N\242\255P"
+	.ascii	"I\250\025]r\313i\222+\233Y$\247w!WvN\227\220\345\024\350\247"
+	.ascii	"\255\315ay\267\234\362\270\222\201\032/\226J>G%\237K$\237I@%"
+	.ascii	"\277\313n9M\372`s\322\3233\322\323\263P\362\031(\371\374\223"
+	.ascii	"|\346I>\2635\311oR\332\340\307\207\366\227\007\307\314\254\211"
+	.ascii	"v\256pv\265\326\360R\254(\230+V@\034J>I\r\fW\240\200\217\304"
+	.ascii	"}\016=\013-\322\033}\322\017E<\222\023\351\020/\342\203\216>"
+	.ascii	"\304\253\340\n\371#G\337S5\243\217\212\341\215\272u\326\310\030"
+	.ascii	"\220P\263\\P\n\004\233\373<\372\360E\017\342}\300\020\031\362"
+	.ascii	"\341\033\206\242\1772F\252\327j\024\232\232+M\246\035y8\201R"
+	.ascii	"\371\357h\346\032f\\.\016`\324\2364S\265\022D\337e\230\350\373"
+	.ascii	"z\246D\026\311B\003\211\241\357\032\327\2417*\341\213\213\021"
+	.ascii	"\274\021\357d\241\017\372\306\213\273\003\342>\211hB_\"\350\201"
+	.ascii	"\254\bB=\315\220\265\214\037lOef\256t(\355\313\256\230\261\002"
+	.ascii	"\002=s\2153\357\303}\016\231\320\222a\372y\370\016\017\364>N"
+	.ascii	"l\230\211\271\317\357\341\341{\252\327\341MX\341RCP\247\216J"
+	.ascii	"\345\336n\326\226\313\265cE\013U)\3262\312\330\234\276\232}V"
+	.ascii	"@e\347\300\321\327\344\203-\231e9]RjkC\261\300\204\351\231\337"
+	.ascii	"\025\306\272\204\302\222 -c\254\312\265\232\345\202Jc\277|\033"
+	.ascii	"_\254\200{l\277\345>_\353\006\360\313\t\2730i\322;\371(\003\322"
+	.ascii	"\317\277_\334^\212"
+	.string	".\327\313\233\371\363\002\320\rRE\274\223\003\202?\250\362\030-\321\262J)S\"\"\"I\222\244\003\"\013\020\210DY\330Z{\003\022\200#9K\244\216)d3\nRR\224\302\260\277\001 \313p\221LM\262\3565\207\216V\237\026\311\"d\244\233\2715c\225\254\313>\250\027\306/\272\257\226\006\247R\277\210\016\372\241\276j@v\364B/\211\363\267x\212#\220\351\032\273a\033\001\362R\277\002\b\253B\342\354rj\"\304_\277\324\022\371\200\020\351@\b\202\370\247\315C\033(\321\234q\310\232\206\313\364\361\003\247\306\r\n\363\353\362\224Q\035-N=\303\267\352hC\206F\023\2562\3317Y\263Q\272\342)J|\"\366\264\375V\275'\"6\203\246\363T\361S\351\035\207e?\r\037\2516\247y\227\233\\<\033\017\350\334\213\212%A\t\267\210\304\365gU?\325\025(\311h\325\357\343{W@>\365\210\230\270"
+	.ascii	"\345\351\231*\035\204\372'\221v\234}\f\336$\302M\267y\232M\241"
+	.ascii	"\tC\006sF\204c\271\373M\001\225\256UG\355\204;\362\037S\214s"
+	.ascii	"+O!\361D\004d>\217\022}\342F\031\240\267\212a;\301\212\"\377"
+	.ascii	"\" \313B\250#\013G\314.\005Q\213e\264\270\257s>\326s\206\335"
+	.ascii	"\376i\344\233%\217\0378\f\022\031\312\275j\335\210\317\2766J"
+	.ascii	"v\222\352{\3042q\275\036\372},t\272\214\312\240\213\257\2331"
+	.ascii	"]\3357\333\232).\225\214\306\021\247\245\007\377V\252\267l\222"
+	.ascii	"-\211\034&[\240p\307B S\033\333\354\n\303Kx\3461\3429\230\213"
+	.ascii	"\276I\273\255\241\241$:{q\226o\217\252\214\341u&*\033$\255#2"
+	.ascii	"\321b`_\242#\376\262\303!\236\233\024/\355\220\251\312\221gk"
+	.ascii	"p\273`e\225\317\205\200\305\232C\2733o\017\303T\204i\206"
+	.string	"\256$u\200\210+\026k\266\n-3@\217\007X\334\254E\b\031\263\257\\~\355D\226\336Vy\235\240\305h@\"\361\201`\360\315\032\370\307\372o^\206\020\364\t\327:\344\0337\006\244n/l<\022\345\262H\370\306Q\3545\355\325\351\352O.\2350R\274\337\016:\343\272\265\357\372%\205\007XJ\203\207?\251\016)U\r$>sS\301B\203\270\021\322I?U\272\327\250\353X \352\346\367\240\013\251\t\022\241:_B'\264\357o\030vf\r{\367xV}\236\342\350\300\266Y\244\355\r*T\256K\220\263e T\346|=T1*$H\325\227\352\3319\n\321_\337srhG\n(\375O0\343\312\207Y\023\227\316[H\351\034}\341\323\355\230\177\344\002\027\215\031\327p\257\210\342\254>\262\350\255\307t\003\022S[\361\306d.\241\303\025aKa\313\324\262\253\373\363^\244f\242\246\215^\373`O\342"
+	.string	"\2110\271,m\262\304\322es|\257$#[\303\027W&\266#%I\330\261W\244r\263}py\035<\224*:s \275\301\325\031\315\006\355\021\256p\243#\271\033uj\232\345\277\\6\030\240b\322\215-\025\366\001\303$\257\256\266\026G\302\326\245A\237\276\227T5\227\330qy\206\275\017:\317.>0\\\310`\337?g\361f\236\237[\226\273\024\027}0\271\352]}Lw\026p\027XAP\f\274\3434\227\321\\\336g\245\256\030\311R \n\\\242h"
+	.string	"X\322\004\235\231k\343T\311\r\312\rt\003,l\361\254\377\241D\275!\313[\024UI\271\220\257l+\207\234\276\314\315ur\003F\017\314\025\356\227\254\346\026\323\024\370\263|\007\033\232"
+	.ascii	"`X\276A\205\027\353\325\272y\230[_\362x0\340\221\305\306\277"
+	.ascii	"l\320\222\fsn&\211\246\336\\v\2343Z\006='\323\241Ea\273@\272"
+	.ascii	"cG3E\001\027\366[\006\273\204[\030@S\300\262\035i\002\r\351\210"
+	.ascii	"\261`P\200`H\207\376\031e\203\377\256\216\225\\\251\320\337p"
+	.ascii	"\220%.\223~\016\327*\033\213\3377\316\251\247\200O\321\023\257"
+	.ascii	"\200\315NiZ\370\321\036\245\031Ckd\230uW.0\3669\020\267e8-6h"
+	.ascii	"-\315il\363\306zZl\265\324\370\364\327K\345\330\2067\313\332"
+	.ascii	"\034\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`\275\003\315\021"
+	.string	"\006\234jI\340\262(\035\220\233^(\n\341\362&%\313;\2236lR\023"
+	.string	"d\300!\255\013\023\224P(\255\272\303m]\225\025\377\213\235\330\357R\021\303\f3\314\345\034\006Q\004A\320\261\343\271\300\377\366_\262\276\343\252\005\022AB$\221)U"
+	.string	"W"
+	.string	"V"
+	.ascii	"*]\223\3224\nZ&A\307 h\230U\277\240\264\3137\233*\016t\213\352"
+	.ascii	"\267\320U\353\r\245\3729FT\377\306w\272\214\320\364\031\352\243"
+	.ascii	"\303\025\225\332\225"
+	.string	":\351\013}\357 \252\204\373\3538\r\244\204\377\001\314\331l\002\375\375\323\360Qp\3169\013\364\314\367\037\004\n\253\363\275\351\347l\3721j\372A4\375\026\256>\214\231>\256A\277\224\351\273\210\351\333`\372/t\316\371\243\206\2744\004ua\205\277\006\230,V\341\325\262\022\37682\034\035\331Nl\007&\341\205\241u\035=\260\264\302\026K\370\036$\310\311\240\037\254\264\203\005}\303j\233 /O\251\342\345\341\351m\274\027F\030OYD6|\210\274\261RK:\024;\024\336\236Q\005\374\340\340a\342\355)\325DH\215\023%\336\f\243\222B\374|\020y7\220z\033/\207Ro\343U\032\251\243\\o\305\2127BIdst\200\016W\264\340\256vu\024\037\317QW\2557\304$\261DU\262zS\255\365\210\204DH\304\321*i\342\035!O\274#<\005M\214`!\362\216h\372\211\310\2258/\t\251\001t"
+	.ascii	"\371!\362\022\270\351\202\330\021t^\023\336\t\2578*)E-\b\212"
+	.ascii	"\367D;\241v\312\274\023v\024\310\327\230\342\265p\013? \240\002"
+	.ascii	"\241\252\022\017A$\030E\262\264\357\nI\233\327\351\362\265RQ"
+	.ascii	"CD\251\b=\003\021'\030\277py\332\212\246m\344\"e\311\001)\030"
+	.ascii	"D\030\013\023\224\300\361q\231\020\332A&\226\3415\001$\203D\220"
+	.ascii	"\004\t \031$\202$ y\201\036\353\322e+\030\317\357r\314r\033\273"
+	.ascii	":8\273\330\347|\216\317\3759?\367s|\356\317\351s\273\336\tn\345"
+	.ascii	"\357\033\200.u\004\\X\004C o\345\\\274\016E\316\036\213AwHZF"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_.refs.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"E\007"
+	.string	"\362\316'+pM2\034\037\034\013\251pM\025\312\016\377\377\377\377\253\252\252*n\021G\317\312 \314\365\020\305\306\326\206Z#\244\221\335\366\226)\005\032\354`\033'\025\254E\325\022(\323\016\314\364\356\005\246\332\200m\326d\326\313\314\274"
+	.ascii	"/f\350}>\2124\005\345\304dj\t\311\210H\b\310\307\252G\007\307"
+	.ascii	"\206F\306*\306\305\253\305K\361N\274\022\323\210\027\342}x\035"
+	.ascii	"\336\206\2673eX\027^\2057a\212\360r\246\033H\237i\202\364\265"
+	.ascii	"t\236\305\254\215\246k\355SU\324\274\2275z+\323\275\277K\257"
+	.ascii	"\b\" \300\"4\312\003\023\005\271}z\260\242X\315\334\233\240\341"
+	.ascii	"\330F%\207\365\206\214\224\270\273\257\031r\233\357[\\}\325\313"
+	.ascii	"V+n\271W\226\265\"\356i\031_\370\212=\227\201\025\355\226\001"
+	.ascii	"\255\221c\301\311*j\205O"
+	.text
+	.section	.gnu.lto_.decls.9e56bdfaa846f986,"e",@progbits
+	.string	"(\265/\375`\264.]\305"
+	.ascii	"Z1\201CZ \212IH\351\253\212\213aQFd\261^:\356\016its\207(\253"
+	.ascii	"gf\266\241\020\375\b#\366\214\212\3701\030X\227\377#9\241/\265"
+	.ascii	"\2150\353\177\316\b\326\322r\300\001@\001\n\204\177\231\341U"
+	.ascii	"\345p\tF\360\354K\276\013`\215\340\037\027\236r\244\206\026\243"
+	.ascii	"\266\355\357-w\n\222\003#\004W\0049\333\270\322l\026\335\324"
+	.ascii	"O\355\324-\032\252>\233\251W\274\2359;I\323LUM\225\333A:\263"
+	.ascii	"S\bX*\r ?"
+	.string	"\330v\356-\033\2765\303\235\242\225\352\023D\307\320>\332<\277\372\336R\301\257 vvn\256\202\330\335\036\301\267<\360\255\024\016\262H<bMeS\237\024\3246\026\351\225\2658\310!\221[\223\006\277R\260\253s\225\202\335\273\013\006\241v\330Q\300\343\224j\322\201FL\367\225%I\262\357_\317\254\0259])\321\312\302\243)\244\305\252\255\314\214\307$\307\215+>\310\246\324*M\276\256\332\226T(bjG\332\352W\224*\305v=\341\260\034XmZVf\220j\306qP\327jZ\345\262\223t\346'^\016*\251f\034\331/\204\245'+s\364hV\257\277\322\360\272Vk\250Uv\224\316\f\305\373\372!\325|e\253n\225L\rS\337\252\230j\246\302\3252\025L\035S\237u\255vy\365R\277\374:sV\346\234_\317~\241\177\003\017\352Z\265\241rYg3'\251A\201X\002\305E\232\270\234\235\031"
+	.ascii	"e\260\033"
+	.string	"\203\002\246J\004\267\203~\340\272\245\252\325\347\207z\303+Z=\273.\351\314\316\2343O}\263J\202\352\373\326\2019\220s\375\260\253ss\365\303\356M\205\273\243pO\263\300@\025\r~M\303\257Q\360k\026~\305\201_Y\004U*7J'\317M\2272TN\372\276&\361\207p\017Z\355\260\023\253c*\004)\222\373\276\002b+\3240\016NZ\226\320\364}\b\2702\251M\352\263>\371+X\365\372\365Zf\260\234\235\034lR\312l\254\357\253\223G\300\314\036\034\002\374\032\264\343\251A\273c|\177v\025\324\016\273\277v\3755\253jU.\273\304\264\314Nrv\372\360\262\254\344p\322\267ru\335\252\316W\256\252\344\033xp\035e\326\312\331Y\271n\316\311Z-\330\251\325\002]\225\031\222_\273\373\306w\326\016;\\\177v\177[\240\202\004\375\241\342H!\311\363w\017\n\215s\302\3776e-4\207\377Qz"
+	.string	"-\201\026\200T\211\337\"\200\027\225\363[\002t\211\216\300\337\"t\220\332:\316o5(\263[\300\037\370\255/\352;\277\035"
+	.string	"\334u~{\001\020\026\370s\002*t\b\177E\266\002\np"
+	.string	"\374\366\247\3125\b\177w'\240?\240\340\267\272*\024\376\277\351(\301\204\300\356\267\016\370\377E\314\361o\025\360\237\355d\332\376\217\371\277\366\337\355\177\230\377p\377\3134\007\275\301A\374o\341\377\004\007\372\255\007\177U\362\267\320\337#\376F\300\337\007\370\333"
+	.ascii	"\177\007\341\374U\347\257<\177\335\371+\207\277\366\374U\354"
+	.ascii	"?\357\267l\1775\363W\270\277\276\375\265\355\257e\376\212\246"
+	.ascii	"1\370\253\331_\311\374uL\017\340?\317o\335\376\276\340o\t\376"
+	.ascii	"\376\360\267\207\277;\374\375\363\267\317\3379\177\363\376\266"
+	.ascii	"\177\235\373\253\232\277\306\375u\354\257[\177\205\361\327\346"
+	.ascii	"_\241\376z\365\327\037\177\265\372k\325_u\374\225\371\327\033"
+	.ascii	"\177\255\361\327\031\177\235\372\253\324_\243\376\332\342\257"
+	.ascii	"L\177U\361\327\025\177U\372\253\362\257\311\377a\177}\341\257"
+	.ascii	"\033\370\253\006\376\217\375\337\372\177\303_3\360W\244\277\236"
+	.ascii	"\370\253\361\257\305\377T\376j\364W\341_\207\376\n\301_\177\376"
+	.ascii	"\372\300_}\376\243\371\177\346\277\231\377\316\377\r\370\257"
+	.ascii	"\345\177\207\271\271\271\271\177w\302\177\023\344\027@UQ\272"
+	.ascii	"\246\236v\252\312U\257\354\204\243\002\251\026\025\227\363"
+	.string	"\025\rx\316\024\241\362\001\343\205\225z\001\003FON\342\"\327\264B\226+\316\364\275\016\022?\247\313\223\215z\202\202\262I\214\004\322\3225\025\264#\022uF\352\t~\216\f-\236\266E\213\tZ\346\250\n\210\244%\261\302\241\b\r2\230}\237\303\304\364\372\264L\335\246\2752\022\207-mJ\003\254\354\222l\301f\311\256X\262\311]\316\325\271tzR\241\302&k~\312y*#\335:\230\202\263\005\037\247K\351i\225:\215\013\271>\255%-\265\345\247)\r\252\326\032\026\247\276\307\361\241|}Ze\2571\301\231\221;NiXrq\371)kp\034*\374\236\263\371\026\371\264H\233\3049\347\t\340\300\222;\222\247\236\202l\362dt\362\004\272-C\256\236\220\301\375\357r\362)\347\034\245s\346\247$\235W]\255A?\207j\353\005\377o\266\277\006C\316\2344\203\203\303B\306\2224^A\276\016-g%\023\371"
+	.ascii	"&\224\222\031c\t\214\231\221\312+\244\317Sf\"\227\300r\366\311"
+	.ascii	"J%\222\204e\366Y\002\313P9\305\026\250\232\235LdV.\263OV\346"
+	.ascii	"d\005KJ&\324\022X\022\312g\t\214\t\225\301\230\271'+\223O*\224"
+	.ascii	"\371\311'\2031\3352\330\022\252g\tl\t\265\004\306\364Q\251T\\"
+	.ascii	"\225E\225\301\355@R\241\226\224\271ES\215\344S\017\332\222s\231"
+	.ascii	"\277\344\\\235(\345\247\013r\256\261|\372\222\214Q\245$\241\265"
+	.ascii	"H\202\222\\\326\017MI9\226Y\211\2664d\231\363\220\244\242\334"
+	.ascii	"\324\001\322\211\226yT4\244\216\032\231I)\347\b\232rF\326\214"
+	.ascii	"\226sF\346\234yO5\2349\317\350Yj65\345<\005\324\224k \311\224"
+	.ascii	"rn'kR\240\226\300r,\205\310\230\2005s\fNdm\346/\314'\f\206\354"
+	.ascii	"\312L9\347Z\0067\241\\\274\365u:s\244\330x\276\350\313F\207\234"
+	.ascii	"j\321\264\205[\r\020\004;\274\262\256p\034\220\016\233\212%c"
+	.ascii	"T\330L\237\271Y\316\370J\3020\363\326e\260Z\232\035Z\372\376"
+	.ascii	"&\277u\233N\023\226&\\\372\036\223i"
+	.string	"\266&\363d\214\230\352\\\"i\323\367-\346\357\265\016S\271\324e\316\312\232\202L\223\232\276\275\254\035v\030\324\237]\177\021z\203\331\201B\262\344I_\237\372\343\205\002\247R\333Y\325Z\217\263&\r?\312\2207\3064\277h\244i~\331 \323C\210T9(m^\313\326qDL[\316\331Jg\351-\335\244\313:\255\325\332\206~\322]\332I\2075\227\306\32274\2246\353(\255\245\245t\rM\245\321\232\254\307Z\254\253\364\225\246\241\237=\245>\373\254\301\336K\232\311[\353\252\312ei\3264Tl^\315+mS2\324\320\340\303lJI\225\343\362 \210X\214*\267\246\245~!\255\316r\322\024\022\245y\326\316\376\322\241\325\354\031[[\315\"U.\354\f\310\230\221_\350\310\023!$\235\365\304\3022c\006-V<\276\224\355\b\323\024\342Rr\3262\2009\353\032<,d\025\234N\255K\233\033\036p\373"
+	.ascii	"c\370\375%\207\201\354\201'd\256\305[\337\356\022z{\375g\367"
+	.ascii	"4\345\314N\002\020\245\nY_\036~\342c#\370x\007>\236\201\317K"
+	.ascii	"\203;\311\2252\333q\325\367<7|\336\025|\036\023\374/=\360yT\370"
+	.ascii	"q\274(|\236\022>/\343\357\320\340\357\310\340\357\316\360wL\360"
+	.ascii	"wW\370;\032\370\273$\276\356\f~\233n\r_\227\005_\007\206\033"
+	.ascii	"G3\353\023\250slIjQ\243\357uJp\007\362\\\005\332]\007\004_w\003"
+	.ascii	"_\227\002"
+	.string	"\377v\301\277b\370\267\b\276\023\031\370Rn\306\277R;\300"
+	.ascii	"\201\225S\302\264^|\340\031!\273Q\345\"\210C\232.IG:\252\231"
+	.ascii	"t\244\344\254.}\317\201\n(\215L\2165\275\222\252\\E\233b@\022"
+	.ascii	"\261\263fje/U4\253\007hE\231\353\\\345vl@\376[\325S\2739,8\246"
+	.ascii	"\276\027K\350\267\231\243|\361\344\252\357\315\325\f9^\230\224"
+	.ascii	"=\373\376\316\360\337\037\215\324\0213["
+	.string	"R\325WW\177v\025L\350\327\307\325q\306)\310\355qyt9\271\030\322\367\227\307\177\255Zj\003&\0362\364\315\251?\273[%\364+\303\356\310\322\232$}q\356\2164E\2368[\350\030\303J\316\225\351KEu\231H\222E\330\364\2142g=p\3742q\344\224\334\302\356r\304\232\217+\033\367F\307`\021$\212\314\306\023\0324\2640}L\305\325.+61!2d\330$\320\322\262m\t\242\346H\316fdYR1b\244\351\212D\221-\351\373\007\2240`X\346\232 XEn\032\032/\031S\\\270\270I@K\244[\020W\227\032o\214\252\331\324u\233n\323\205\002Z\"\337\202\260\274\371\230\272\261r\306\304\343B\335'\034\032M(Y}\257\223\316\234\0275\256\276\367qq[\254\271*\256\212\313\002\002\2567\031\242v\324\252V\260\270+~Y\360$\021\371\021\005\r\207#c\270\310\030K\221\342\306"
+	.string	"\004\304\255L\354\313U\372\215\241\316\245-)\203\023\302LQ&\353\"/\362&9"
+	.string	"\210Z\324\0214Vz\300\270\311\337\244^\352\036U\306\320\332M'\f\223\305\226\036\370l\316\306\316\355\236I\346V\320\225A\215\222\2659+\227F\306\262M_\333\006\270\243\t\225\276\357Q\302\347\231S\243\246\323"
+	.string	"\365d\345W\234\024]\332[\022\026a\310n\265T/\225\314\306\t%\345d\222\003"
+	.string	"A\266\241yk\353\213\306\251l(e\334\322\316\360\253V\231=\013\323f\2035\323Z\343`\213\275\241\210\rmh\326l\007\351\223\263\0160\3156{\306\232\261e\254\233\205\253O\373f\271"
+	.ascii	"\3317\233\366f\273X2\025m\252'+\305\330pV0\321\250vn\331\307"
+	.ascii	"L\220\264d\302\326\2301\226\255>-\231\0039\263%c\275X1\025m\312"
+	.ascii	"\231\243r\242\244\311\r\371\220\001\207\267\033\276\320\330\211"
+	.ascii	"\t\263\003\305)C\231\276v\2157\025CK\212\255/\365i\301`3G\310"
+	.ascii	"\326|LN\r=rd\341\363\020\301\347\261\262j\230K\033\325\031\023"
+	.ascii	"\237\307\006>\217\f|\036(|\036\2463k\006\226\005\356\314\254"
+	.ascii	"\325\314\230\222\372\236g\t\333+6\013O\022)UaXR\350aCX\337[C"
+	.ascii	"k\301j6Y\331\371r\365\354\252\242\013\233\203\223\321\327R\301"
+	.ascii	"J;j@\340P\211\335\240\321\367\226\312o\273\332H\006\346\332\240"
+	.ascii	"\351ki\020\272\235\222sf\245\215\253\257\316\026\347\255\230"
+	.ascii	"\323\216\255\200\001\025-\222V\264\361(\273\320\320\352\353\274"
+	.ascii	"a\201cY\326\327>\261Pl\224\377\346f\n\223Z\215,\3706\f\307j\313"
+	.ascii	"\fD\372v}\225\235ur\373\374oxZO\312g\025|\313\3046\371ol\233"
+	.ascii	"\262)*\372~'\n\276]\322"
+	.string	"\20108\220\364\265`Xig\013\304\315\232\327\030\037}o\301~\373\325V\026\t\006\232\211\306\024[\337\235\372\263\263]B\267^\215\345D\213\226\276\034n\340W$\325\006\251O\033\304n\351\226r\216\032!\004H\r\rn\300\024\271\261B\t\357\207\234S\fg\316\324R\224\255\276\267Z\277\025b\207\330,\235\f\334d\\\261Y6I\326\213\252\037N\255\033\2625D`\364\265F\354\221[$\266\210E\322\3012\347\244E\302\303&\347$O\255\026\324j\301M\222\003\353\311\356~g\006\256hB\267D\254\024+Jl\372V\240\235\244fsL3\013V\0270WW\\\304\232\274\254-Y=\254\364\350a\177,y\266M\361\270Q\306\372\270\375q\325\270\272|\351{3\265\312\377\233\335\231\023\0335^VV5ta\311\305\341\204E5\301XUU\331dm\300W\\\333\256ie\214\262\3579<\351\320a\231&\344\006"
+	.string	"\301\222;\302#\203\"\206\315\034\016\034\226i\002\022\202\254\264\035\2258\2709&\327\r\020!9\230\326\260\r\033\366\306M\316o\030dAa\311\305\351pP-\261\372\336\250Rp\331Y\331YY\215\032j\317f\216\214-[X\306f\314 bgx\261\"0\020S@1\302\t>\022\350\t\237\t\030\340\235\027\205\020A\fz@{:)ZDQ\027v)\261\004\343\013\277\340\321H\001c\020"
+	.string	")\361'\342\327\301(\335\001\203E\021@(\212\037j\242\310\350K\177\036\200>\277^\217\361\250\205\243\237\320\367\363\360\242\020\306\337\007\bT\240D\013$D\350A\200\004\025P\350\2210\321c\241\204\017P\204#j\034\036\375\f\321\236\027\205\020aL\321\023\301\024\030\301\261gD\001\033\203Ba\320h\207\242H$q,\212 *\376\206G%\034Qc\316p\250u\306\236\316\2617$*\352\206DE\213f h\274F#\232\002\201>\036\212\"\361w\323c\321\236\003\212\364h\f\022\241&z@tH\024\024\372x@\324xt\177\250\221w\337\321\007\354\021\025C\354\b\213Fh\013D\305"
+	.string	"\244\276\242\3375\242F\276\024V"
+	.string	""
+	.string	"jtdDM"
+	.string	"\207h\321x\304\002\222\211\241\n&>\034S\337\221\005\017\250\261\004\n\306\022\307\340\260\204\216\211\242\020\277\036j\024<\016\217R\021\277!\001\344\374\034}\300\"\005\"\220\240\002C\025.@J\177\351\216\347\303\210\020\307\324W\fQBHL\217C\"\t\024\302bQ\204\n\214\320\243\021\005\013\034\376\373/\230\242C\224\b\277\203\017\020\360\001\bH\274\203\020\302\210\020F\354\016B\bBB!| \204\377\201\220=\036{\300\022HD\027xB\027|\306 \tD\303\240Q\352\203"
+	.string	"\355\031\211|\302\022|^\024\002)\025AT\374AJq\212>\243_\252KQ`\360\0041-\002Q\244T\350\013\246\250\321\007\t\025\026\217H\030\022\372\212pP`0M\321\023\304\3360X\301\261\307#\362\265@\f\366\210\216\204E \037\3400\350B\357\3503\366\214\216\322\343\013h\321(\201\016*\364\375p\216)zb\030\374\245\300\240\221n\0304\302/\374\320\242\037\222\317\b\363\030I\b}'\206\304\340\321'$\026S\3648,\361K=\030Q4%BI@\205DC\021\214|$N\024\207\036"
+	.string	"\n\211EF4-j\001=\372D@\201D\024\322\240\017h\030\374\241\306\243\036:\034\372\212~=\244#_\017\311g\304cL\211i\212\366P#_:\324\373\245\306\016\273#j\f\032\215i\216\317\207\241!\342\361\350\027"
+	.string	"c\020\311\327#:r\001\005\036\217\212\303\240\007\264\210\342\330\363\235\b\246(p\202\224x\374\371\206z\304\343\221\257G4\f\026\035\211D#c\357\227\002\031{D\301\241!\221D\217\017\206\201(\354I\260\203\302'D\201\275\241!\"\n$\032\365\212~\307 \fF\b\216=\020xhz\004D\177\304\264\330{\340E\024\234XDS\021G\"1\025\221c\354\035{\037\b\035\207A\236\3618DO\240;\242a0%\036\203C\242\021\016z\"x\374\371vhz\224\376\230\350 \f\372J"
+	.string	"\006\205\276\023?0\020O@\205\307#1-:\372\034E"
+	.ascii	"\242E\306\3400X\002:"
+	.ascii	"\002PxD,b\201h\030\004\016}\302\017\035\216\275\r88\016\203G"
+	.ascii	"\370\210\032\321t\005 1\230\242+\370\216>\022\220L\020\r\203"
+	.ascii	"'\202\350\017M%@{+\360\240F_QQ\207\366Lt\270\220\020\211\n(\220"
+	.ascii	"B\004\360/\004:\3443\n\203\276!\021\307\"\242\240pH\3040\350"
+	.ascii	"3\022\361K\215\"BL\200\036}G\026^\030\006O@Js\204D\342\b=\235"
+	.ascii	"\224\213\303\304H\030'c\2269\302\033\323\216\026\273P\231m+*"
+	.ascii	"\n\013\267$g~\364\275a7\3142Gp\221\375\264x\362\264ZR\304KN\031"
+	.ascii	"\026B\206\364\275_\367\3536\251OOn\034`\245U\3015a\242\365\203"
+	.ascii	"\006\r&KvF\214\244\251\261\001\362\022b\003\254\301t\226_\340"
+	.ascii	"~R\\%W\311\355\272A\342H\225M\275\b\352\272N\267\033/\3148/W"
+	.ascii	"\n\027^|\304\335E\027\216\265\276[\275\202\347F\0321Yg\360\177"
+	.ascii	"\265n\f;aJO\340\262\272M\035\243%$.\211M\336\247\f\253\034H\354"
+	.ascii	"\234\3252F\304\310\221\233$E\205\006\243\357%r\213\374\032\371"
+	.ascii	"5\322\327\210\235\233\333)\271\241\311nH\257\t#Ge\255\257\216"
+	.ascii	"\223\223\217e\020 )\236\312R\364\375\r\203\354\250\242\0019\311"
+	.ascii	"a\246\320\314\210\210\214$I\322\030\222\n\020\204\303i\030\346"
+	.ascii	"\330\035\022\300\003E\323B\246\314\f\211\210HAR\220B\246=\003"
+	.ascii	"\b\261\002%\262x \274N\031x\336\035\217\352*\202\230\320\201"
+	.ascii	"W\332c\003\244*A\237!\251\324<\206\230)\351\310\304\246\210\006"
+	.ascii	"\nl\336\221r\232G\233\001\371\320\237h\252\2753\032\230I\324"
+	.ascii	"\025r\203\225\255\366c\250\224\313*O.\347\020\024\205\n\313:"
+	.ascii	"|h\361\330\233\366\200\377/\004<]\343`\004\317r\304\214\023T"
+	.ascii	"1\250#gIh\273\344\205\251\030\327\001;\372>\2261U\245\243\006"
+	.ascii	"\226(\234\304\273\345S\203_\342\261-\374\331\343\332\346\304"
+	.ascii	"\207\025\271(\201\337\375\276\241\216$RWE/\005\303hN\206[\256"
+	.ascii	"\221\362\370e\001\302\316\260\004\255\217\373\0354\320qw\262"
+	.ascii	"\263\037b\206\310)\246\256\230:\344\376\267\032\025iJa\312\315"
+	.ascii	"D\320\232O4\f+\3009\326!\232|\341\361\326K\003\216\316 \234\032"
+	.ascii	"\301\270\212\310#\243\225\207A\017\001\375m\200\257\373\303\360"
+	.ascii	"\341\201)\321d\003\275\260F1\026\232\004\306\311y\205\024\355"
+	.ascii	"\254\230\032wy\376\025\2310\215\025\243\244\004\2025\273mc\313"
+	.ascii	"\003<mG\331\021\262\317\341\335\323k\027\255\022\013\227\236"
+	.ascii	"\253m"
+	.string	"\217m\340\334\275E\017\234\016@\343\213\371J\366=\227\303hQ0r\252\241\340+\310\266]]\3221\241\007\233}\355\271\004^\023\321\205Ql/y\035AU\320J\336\351\372\227\tT\311\211:\2009\210i\255\036\303\372Iw\032\372o\354\244\250\003\222\235G\320x\024\222\232\023\233=\255Sx\315\254i\252\367a\240\224\350\321?j\035b\313#\f\240\305\242\200\270\271@_\346-\030k?H\317\rx\210\256J\255\324h\304@g\326\001@\255\346\262\332K\336\200\351.\223!\351Z\274\312\313\366\305\255\355l\362:wg\037\327\321\243Y*\rj\354\255IG\210f\215\023\t\f\207\001&\221S\\3\033xi\352\324e\226\024z\303\271%M\3248\240Z\303%\210\351\266{\204\013\331,i\344\335\203)\013\002)\372\320\004\270~\233g\"C\020\362\271K\357K\212\212\372\360\214\365&\020\201,G\201\214\035\340\013p\343"
+	.ascii	"\007$\005\273\240X\307\020\017Z\206_\357\243\026\210\322\324"
+	.ascii	"l\3648ds\316\211\347\206\244m62\032\215\337u\346\202\013\343"
+	.ascii	"$Ey\341\032'\343f\004\006\201(p\347V[\037\032\304Z\355\247\316"
+	.ascii	"A\236MS\3350^\362\016o\332l\317w\252u\353U\205\351\255\356?\026"
+	.ascii	"\026\003\350+Z\r=\276\2233&\261]6\254sH\001t\255\001\275\370"
+	.ascii	"\351\267ij\375y%\374C\035"
+	.string	"\3754\241\237\027\0253IT\376\212\030\013\301\236@\223\016 \330b\321+\332r\320\302\363nI\362LxX\bW\b\021\353\223\357\r\374\340\275\006\354\324\034\232X\313\325Kv\020l\007\272m\320\035\321\2149Q\034\224F\257\243\3532&\364\355\217\377Q7\255\321\335\r\275(\035\314[\037\037Fl\337\247|iu\202\220/\263i\230}\311\356_\346Y\276\343\rO\347\323=\363\037s\242\264C\326\200j\313C\023\351\317\264\203\351|\352(\312\227qh\t^\366\351\002\324\223\242\313\312\374\344\343\343\001XNs\212v\027\367\034\211\214\344\236\b\270\216W\200\302s\355Q,\022H\271\221\332d\357\274/\210\026\357\227\227\203\002a\244\250p\270\360\317@\330\354\036\200Cj\320k\0200a0\032^\217\032\317\356\260\276\333\241\252N\256\206\005\203k\334\360\007]f#\013\215\r<\361\343\352\245\342\270\205h\221\354\351\026\022F\032"
+	.ascii	"\n`\353\375\202\177E\032\323\254\361\337.\350.B\373\211\207\206"
+	.ascii	"\336\370\013\344\3429\257\035\002\027\322\352E%\215\317\027\227"
+	.ascii	"\002!\322\267\233\340\036\324o\241\253\274$\303i\347/\234\364"
+	.ascii	"N\"\322\246Nj\311hN\216\027H\323\375\016\343\025\013Z\351\007"
+	.ascii	"\313\016\2212\003\3431\263\245BXB\241\240\267\322\363\035\351"
+	.ascii	"\302&\201\273\253\360\374\253\307\232\262\\Z%P\363\334\211m4"
+	.ascii	"6Y\352R\001U\236\265\001\3624\"\355\331\361~T\374P\214E\303-"
+	.ascii	"v6\203\207\203\f\200\254#\016=\033j1-\031l9\244\214\233+C\307"
+	.ascii	"\277\233T\\0\024BF\030\3676\220\311\205\237\361Z\037\351\247"
+	.ascii	"\244\310\304\255\210\354AN\346\356\337\214q|\267\213\371\"\250"
+	.ascii	"\177\247\013\035\003\270\256h_n\fI\177\226\235\220\273\347\270"
+	.ascii	"\265\245B\260\035[\032\237\230J\217\223\001!\017\021\211\236"
+	.ascii	"x\2116\357\274\353\2444\254\312/\320\rp\016gQ\201\234\202\336"
+	.ascii	"w8\f\225\017,\366\016\026\232\222\033\030f\2548\237\232;J7\032"
+	.ascii	"\374\204w\022\020\336\213\264\327\206.\341\332\232\224\203\334"
+	.string	"P\030\350+\372\021\013\245\313\021\013\336K\220\036D\264}\333\263\251L\337\243^,\245\376\232\021\300\177\230\037\025jg\350\220\333?\210\307U\022\207\001)\030]\330\365F\314\203\244\326\317\270\367@\245\327\217Q\220\234V\211\2348A\233\2330\207f\251Q\035\354\236\275\215 \311\362\360v\304\220\262\327\302\206\024\307\036E\020\234}\177\2032J\3656\rl\254M\320\211\022\3735\337h\270.f$\307.\321o\f0\232\030\036\321\\P\255\032\325QU\261\273\324lD\221\274\022$s\257E\257`\354\302e\377\025\376^\310\002Q\225\351\2449I\261=\364\326\t\025\241G\3761\256\215\323A\t\035\245U\240%\007\341s\363\311\214G\345\233\336\f\270\202\006W\232i\256\214\334\363\"\f\311\241\342\272\250\301\325lY\bQB9$\370\3037\365~\006\332\321L\337\035v\313\251D\331\347G\257a3\"\223G\230\001t\237\233\200"
+	.string	"\222\242\245\236`\027\357\223A\265F\244\3452p\350D\217\026\342\351\033REm\021\321\222\354\363=\225\322\324\036\230\367\237\243@\007089\220d\343\200\230\255\306[)xP&\347\r\262^{\271\002\274\004\3277\325g\t\240\020\360Z5c\214\001\313?\376p\210\247-\303\273_\006o\b\343G'H\030\217\"\362H5\260~\232\002\363\205\253\030\216-\026"
+	.ascii	"\214\355\tL\306{\022\276E\310Q\307\241\b"
+	.string	"\220\033\n\223\024\240\347\203 H\256BI\274\321.%0\227\327W\"\257\350D\246\235V\35220|\264\360\243\361\331\220\235%\366\300=:\243\265\200\350w\370A"
+	.string	"\347Z\2345\301\327\b\370\326\271\004S\265\346\363)\026_\3113\017\245\367\354\313\342\216\237|\315}\201\340X\326k\372\257f_\231\337\345\377\302\021\2709\017\336i\305\274\032\034x\320\363\202\301\373%\314L\360n0\271\320.\357\252)7^/\253\311\366\341\373\210\274\005\214\357\\/h\033\233?|}1\352\335\333\360\005\021\357\321|\252\352\002\264\241y\256\341\276\363\215`6\306\273\217x\245\236N\356\013\330\361\3645b\246\332\333\306\274\007\017QN\204\216\226\0135\347\020n\226\364O\300k\220N\253\375~\036\217\216\355nO\247t\016(\2779\034q\256\3463S\ropvj\376\201\220\217\311\036\320\253\025\277i'\334^\244/\024\330\3415\220M\220\374\264\364\200+0\274\334\220\233\257\031\274\023\375\036\366\243bx6\r\253\375\265\262\345\207\235=<\244P\370\217\273\356\236?\021\370\032\236\375\017\027f1\270j"
+	.ascii	"\310\201\021,\250\341V\363\263B>\035\355\032G\257\320\n"
+	.text
+	.section	.gnu.lto_.symtab.9e56bdfaa846f986,"e",@progbits
+	.string	"failsafeConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"failsafeIsReceivingRxData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"failsafeOnRxSuspend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"failsafeOnRxResume"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"failsafeProcedureNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"pgResetTemplate_failsafeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"failsafeConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"failsafeConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"crashRecoveryModeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9e56bdfaa846f986,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
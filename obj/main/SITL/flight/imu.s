@@ -0,0 +1,1912 @@
+	.file	"imu.c"
+	.section	.gnu.lto_.profile.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`B\003E\020"
+	.string	"\204\0256\004"
+	.string	"8"
+	.string	"\255\234\214\225\013.\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002\003\001\335\276\216\252\016\002\343\267\245\270\f\003\240\342\234\212\n\004\330\266\351\240\0050\002\004\002\004\005\002\005"
+	.string	"\002\006\006\007\247\320\217\212\001\b\n\321\270\262\265\017\002\002\007\002\007\013\f\357\322\207\337\001\006"
+	.string	"\002"
+	.string	"\002\b\002\b\r\016\017\273\360\302\213\t \t\002\t\002"
+	.string	"\002\n\b\n\020\021\022\023\024\025\026\350\322\344\372\f\032\002\013\005\002\005\027\030\261\317\360\375\017\006\006\002\006\031\033\233\326\340\375\t"
+	.string	"\034\302\260\206\302\t\020\035\036\362\330\255\243\r\022\002\004\002\f\002"
+	.string	"\002\r\006\b\002\b\037 !\"\354\330\211\364\t\002#\242\302\263\302\013$\203\366\244\240\016\n\002\b\002\016\b%&\352\263\360\321\b'(\304\363\207\325\f\002)\273\377\260\374\b\006*+\243\363\317\341\f\b\002\t\002\017\002"
+	.string	"-\327\235\250\225\n\004\t\002\t./\313\304\355\226\017\0030\311\204\277\354\005\0201\315\362\210\375\004\022\002"
+	.string	"\002\0212\221\326\260\227\004\006\0053\373\377\236\340\004\b4\220\262\215F\034\021\021\0215\231\324\344\225\004\0046\240\202\262\202\016\030\020\020\0207\247\243\357\305\b\024\002"
+	.string	"\002\0228\240\323\362\254\0039\364\334\252\227\001:;\240\342\234\212\n"
+	.ascii	"V\250!I\201Q\202a\243 IZ3\200\202RCF\017\021\340H\002\221\241"
+	.ascii	"\021\021\231\005IA)s\253,\374\314{|\032\235\013\224!\322\236"
+	.ascii	"R\364\375\245\345\306\322\347\257\340^I\350\243\224}+f\327\267"
+	.ascii	"\233\031\260r\267\361\335\317n\364\363x\326v\013\016\203uW\021"
+	.ascii	"\354BV\f\373I\005\312/\374P(\031\305z\033hN,\366 \031\262V\345"
+	.ascii	"\"\037l^\367\377\277\230\344~\220\027e\265\343\354C\207\240\235"
+	.ascii	"\365\325\322#n+zv\241;g+~'\376\316C\223\231\361\3409\253Z;\376"
+	.ascii	"\203\224\003\027G\373\025\r\320\252*=6U\216\263\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\320"
+	.string	"\335\005"
+	.string	"\362F\025\035\220+\215\001\377\377\377s\377\377\377'\266m\233m\253\2427Tw\232\331\337O\270\2242\245\032\313`\234\224>\024\270O\253PW\227\263l\225\313\243\354\304\224\230\021\205\b\364\236k\200\311z8\266\261\312p\241\251H\354\357\037\366\251\322\3130\2414\321\003oE\370&0 \260\242A\255\003\210)y\276`\210\203\247\021\217\302\230\277\200\016\211\271\022\310"
+	.ascii	"ua\002\024\315\333\200\002\240\020T\330\030I\023\354$\200a\200"
+	.ascii	"\025\340p\273\021A\203cf\302\233\356m}N@\233\003\026\r+tz\333"
+	.ascii	"Dh\215\334Wl]\360\303\242.t\302|\001\213\037%\005\353.Q\002\""
+	.ascii	"\026M\r\001"
+	.text
+	.section	.gnu.lto_.inline.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`,\b5\033"
+	.string	"\006bqF"
+	.string	"\261h8<X\306\302\035\016\336\215\025\363\333\331\3051\017\304\216\035;>i\277\371\222\260\353D\343\221\026w\311\327\201\221\255\265\320\377J\220R\361\255\360\241\262\237Vb>\327y E\374\351\340\202\304\222\264-\245L\001\\"
+	.string	"_"
+	.string	"a"
+	.ascii	"\n\363\3373lJ\247A\024\266*\377-\260\374O\241B\\[\213\351qcR"
+	.ascii	"\025\0365Z\210\270\263G\331Z\265\023\246)vj^F\036\251D\253D\265"
+	.ascii	"M\332\254\022\323v\267Z\302\006\306\206\\\221\355\nZ\217\n\337"
+	.ascii	"\360\246\326\226\376\177\310\216\355\370?\203\332\033[\234\377"
+	.ascii	"\021\354\001\376\370\0022\245\227\362\370\324Nx6\360R\026\034"
+	.ascii	"F\310\340|\242#\327\216&\253c\247\346\245s\201\315/\315\0211"
+	.ascii	"i\n\020\377\243\\\362\332\234\377%$\376\223\230D\303\377\024"
+	.ascii	"\373\265 \217\250D\227)\266!bh=(\243:\267t\363\346\315\032\352"
+	.ascii	"\227\263ej\342\177\316@\266\003h\246\275.iZ\275\030\002+\360"
+	.ascii	"\333\315\013\033q\003\222\031\330\tR\2577\246\263\377\236\027"
+	.ascii	"xy{y\0164\007~\336B\365\027\"\363\277\002\267'\315\\;kyR\024"
+	.ascii	"\265\001\314\362B\350\244(\031b\271\261\002"
+	.string	"\333.}\007\342\024K\265\265O \002\205M\fN_\350\320l\210\214\300\236\371\301\341\321\360@\323\301\363\201\024\032\0209\002\266m{3\363\303\216m\313\177\026'S\227\377\023\fA\264\303\260\317 \027q\205\307\nC\301'\324\"\032C\377\255zk\216\371\274\025\004%\244>\207\232\236C\315P3\tx\005\202\253\344\036x\346\307\007\307\323\371\340b$\331A\352\004e\362}%\317\353\314Rs\2345d\355\272v\364\034\200\306\250!I\306\330\bIRP#\313\001\200\242\031\032\263\016\022\240C1G\362\2641\210\004'%)IA\n\245\345\356%\214\377bWX\235\226\177\315p9\303:\022\200\300\372\356\331\216\350\023*/\005\034\273@\033o F\361\252)@\302]\004\352X\271\341%;'\225!\253\374D!\030\204 \255\3257\212\021\270s\211\264\241eC\036\023-y\177\002\225\310\001t\263\310\347W\316\361x\275"
+	.ascii	"\352 `S\021\357^\236\227\005\350\3466\264b*k\373jw<R\270a\033"
+	.ascii	"g\252Q\273z\361\330\350\234\264(k\304Z\221G\334\373\3360R\006"
+	.ascii	"\336\027[A*K:q\336\277\004\244U\337\201\306t\202 \311\224\360"
+	.ascii	"j\355\017,\266\030!\341\303\270A\016\230!)\206\323\340<@7%\302"
+	.ascii	"T\210\372E \002\017\217\251\rm\322\214C\252\034\277\361-k\t\333"
+	.ascii	"\241\221\206\322=a\341B\224\b\2063;\032\2670\205\027\344\360"
+	.ascii	"\300\350\331\177z\310\215\202\001\216\003\302]6f\356<1\312\031"
+	.ascii	"\177K\276\211\\\367;J~`\tw\217\217\222F\2630\016\212\002\rm\036"
+	.ascii	"V\n\305I\251[g\220\320|\3705\323\2359\345)\177I\005\332\001\332"
+	.ascii	"i\r\372W\221\233\005FC\037\032\275\004\300\217\313\264\240>U"
+	.ascii	"d\353:\360R\371\371\260\021\223~ir\251\223\206~\254\373w-BL\005"
+	.ascii	"\0323qy\362\023\220z\356-k\347\357>/qK\240}x\221\367Y\237h\341"
+	.ascii	"+\251\256\210|\341\251\224\032\036MSX\245$\340\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\210\002]\013"
+	.string	"\206\32195P\305&\03503333\201d\242233\263\004\211\3476\271\2362\300cB\306F;u\204\360#d\"\360a\n\225_\331\005}\224tK\006\233\264\365\336)\245'"
+	.string	")"
+	.string	"'"
+	.string	"\031\003\260W\234\366@\333\003\357\246\374m\355\245\013\264~[\344\267\271\221?\340\337\352\351l\313\373{\373\332Z5h]Hv\314<\t\236\007\337\344\373\340"
+	.string	"\034\325\350\210T\274\340"
+	.ascii	"\367V\323t+\305\030\243\233\357\"\232\273W\367\355\212z^^\311"
+	.ascii	"~O\314\323\321\266\337\304$\321F\264\020\277\203\363\265\351"
+	.ascii	"\346{\324}\271-\366\033\030Z\205\266\331\335\201Op\264\005k\013"
+	.ascii	">\345h M\303.\223\021\220\007\026\372\220d ('%\027\026\372`Z"
+	.ascii	"gS\316u\227!\334\301\201\214iz1\332^`\236\323kQ\252\202zn\330"
+	.ascii	"v\024\005\0018 p\202\021*\273\003HD\376\0176\345\262\2544\027"
+	.ascii	"\207\255mL nH\300\244\007\212\313\nJ\337\374\202\365\265\335"
+	.ascii	"Q\r\206\357_\033\300\007l\352\272ni\314\"\314\\\020\330n\002"
+	.ascii	"\254\360k\233U\002p\344\223/H\"\005\270\b\352m`W\300\355l\261"
+	.ascii	"\037\220 ]0\006\273\025\333\256\263\232\260\232(7i\341_v/\372"
+	.ascii	"^n\r\347\310n\t;\3163\375\366\b\020\034P\030\305\006\\\006\256"
+	.ascii	"\210M8"
+	.text
+	.section	.gnu.lto_.pureconst.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375 P\035\002"
+	.string	"\002\305\017\030\220\3270\006\307\340\314\314\310\246\037\"\002m\265d\004\327\2261\226\246\013d\036\301\033\270\300\0138\300/\317\362*\r\224O.y\344\220?\356x\343\f\361\342\211\007\304\0177\274p\335\0243+\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\001\002\235\t"
+	.string	"\322\313\")\220\265\031\016\177\324]w}\247\337}\276\273\273\273b\020B\b!\032===\265Q\023\"\363\257\304\266\0338\2466hD\312\024\377\366\306\263\0234h9_\235R\360\004W\253V\215\334u`\201\200\357\001\004\275"
+	.string	"\314\307\307W@\340\204\031\266\244\274\276)o\252X\177\365\224?\305\312#Rt\021\322\230\214\205UnE\356\rz\316]\353\252xV\345\325\243\223*\247\272 ~*\237\230*\207\237N\271\341\245:\332'S\036\225;7!P\250\220P\3218\313\032P\202Q\250\350<\021`\241rV\315\246\255o\376\035\020\325I\304\026\b\261\001\255\242\026\327\354\231\377\221\034\234x2\354\337\025^\275\325*\234n >\250Ed\365\301\022\246|=\231\336\260\272C'T\253\303\301=\206\245EaV\224\372,|\307~S\256\025\200\020\b\\-5/\271\361\370\25338@\256"
+	.ascii	"\377\n\207,\347\200\340F\233\365\001\255\212\036\r\336&,\033"
+	.ascii	"M\305\357\n\350\304\225\013\032\333\007<\367*L\363s\0016o]\b"
+	.ascii	"\261\261xB\312\212z\233=\0203h.\344\r\246\033\001"
+	.text
+	.section	.gnu.lto_.lto.5408d891ecd1f5f0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_q.73.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_qP.74.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375 \231]\002"
+	.string	"\364\003\214"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200\320\001\177}\304\001{\303\001y\302\001w\301\001u\300\001s\277\001q\276\001o\275\001m\274\001k\273\001"
+	.string	"\003"
+	.ascii	"8\202'\013\342\030(\002"
+	.text
+	.section	.gnu.lto_qFast.75.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_headfree.77.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_offset.78.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_attitude.79.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375 4\205\001"
+	.string	"T\002'"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\025\001\002\005\001?\202\210\200\030\1773\273\0014\273\001\274\001\273\b}{\275\001"
+	.string	"\003"
+	.string	"f\nK\tz"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_imuConfig_Registry.83.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375 \224U\004"
+	.string	"\304\007b"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\203\377\261\037\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\314\006us\350\345\005uq"
+	.string	"\005\001\006'\001\b\226\340"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/imu.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_imuConfig.85.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375 A\315\001"
+	.string	"\304\0024"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001"
+	.string	"\031\005\001\006''\001\304\023?\202\210\200(\177}\277\001{\276\001y\275\001w\274\001u\273\001"
+	.string	"\004"
+	.ascii	"/\242\340XJ\203\030\200\003"
+	.text
+	.section	.gnu.lto_imuComputeRotationMatrix.86.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\305\007\355\034"
+	.string	"V\260\244G\240ZQ:\232\327\221`}\313%\224\313\204"
+	.string	"3i\267\266i\310\nE\203C\305\001\001\321\313\350\002\333\376\016./tG\237\005\030\005\003,\360:x\021\303\223g\377\332\376\265}\032\306\203m\333\354H\343\333\2364\231d\n{"
+	.string	"\205"
+	.string	"\240"
+	.ascii	"\246\375\376\371\355\363\273\3477\317\357\235\337:\277g\277e"
+	.ascii	"\277s~\343\374\216\375\276\371\r\373\375\372\355\372\335\372"
+	.ascii	"=\376f\375\336\337\377\255\003`:\332P\331I\315\211\242\330fR"
+	.ascii	"\215Nv\330V\353\017\035\206P\037V\220$\246\243\035\302\216\351"
+	.ascii	"\2501+\331a\024\252\306t\315\2001\"*\315\234\363\2674TI\257d"
+	.ascii	"\325'\205\005U,\351]\004\346\234~P\305\n\365\252m\233m\234\375"
+	.ascii	"\322\020jl\0254\t\222\332\322\326f\244F\212\324V[0M\365\030\002"
+	.ascii	"\255\016}A\211\230(\3632D\243\216\2206lh\351\370\251 \031\332"
+	.ascii	"\322\026h\227K\311\203|\321:4\007\rb\342k\316)"
+	.string	"\300\n\245@<Xs\350\350\017 \256A\035\255 Z:\322V\207\232[\342\322$\3741\004\276hC\221\337\031\266\262\3466\331\277\211~\017\375\366\375\356\375\346\375\026\372\275\373\255\373\235\373\215\373\035\364\373\366\333\366\273\366\033\350\017\353\332_\005m\313\252\024\216>=c\246\fk\307\375\325nY\253)lT\225N\273cL\224\325\260\335S1\006p\274\3149\207\302\250\325\001\004\t\022D}\277\253\245\023IT\263D\314\t\264\351~\265\344\301[]}\322]\026%B\252\210\b}\013\024\314\027\334\372\242\364\030hU\227\333\366\210\274\006\272E\313my;#\221H\t9P,T\265\025*\356\036\250\225*\265\335\241\321AP*Sj\253\333\031y\304*\027A\245D\301-ms\022t\352\t\016J\217\240\"u\322\344\266\264\r\232\240\304%\267.\n\340\341\310\350\327\301B\005#\f\024~\031\214$\034\375\212\2228\374\002"
+	.string	"0\222\206\tI\277\016HHI\277\030\024PY\272M\005\320P\001\2274\021\223\214\030D\235%\032\352\035\306\013\027\372\244,&8\244\202\260\035Z\277\374\331\026,V\370\374\364\254\017ou\333cU\nyN\230x\211\235\345\331_\331v\247\252\024\222\263\325\021\332\331\225\322Iv\022#\312\234\225\3656g5\305\rb\351\204s\322w\340\227b87\033\323\355\315*\323\r\251RH\276\026\266\277\312\355\253X\n]\253F\333\260Y\243\236j\265\002\200\226\250QX\346\315\220P\220$\265\262\034\020\003\021\031\332\346\021"
+	.ascii	"\2354\210\020\003\025I\224\2445\215\001\343\231\006\031\220\204"
+	.ascii	"\314\243\355\346^Gp\2223\202\365\253U\232\256\205\377A\234%."
+	.ascii	"~1\232eP\372\250\314+\322/&\330a\247\005Ho\223)c\017X\231\367"
+	.ascii	"\341~\347\201\035\315k\bp7\340&\333@\350\326\3302\016P\006\032"
+	.ascii	"\035{\236R\013\361\341=\247\346\235\026P=\2366t_l\245\356\231"
+	.ascii	"D\237y\006=\376\333(\201\365\233\273\325u\332a\230\343\203\344"
+	.ascii	"\307<\260u\340\377\017_\t\256W9\364\210\272\270k\300\333\326"
+	.ascii	"@\005<\267\022\030@t'=\3275\347}\362\264!?\237\362Xg\312/G\223"
+	.ascii	"A\227\266\232\371\316(\357M\375\3746\344\017\301\"\216js\027"
+	.ascii	"\232\277\016M\350\347%\232\177\231\201R\317\217\026\355\004\217"
+	.ascii	"\213n\304\323\236rB\364\227\322q\214)\337\222\214\241-\300\355"
+	.ascii	"\216\345\317\226\001\212Zp\376\017"
+	.text
+	.section	.gnu.lto_imuConfigure.89.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\002\003-\025"
+	.string	"\306\347\210I\260\324Q:\331\251&?\342\237\363\002\274[\323D\n\252\306\317\214X\371'V\215a\371\330\331\306\013+\232\332\266\225\235\0266>Q\353\340\323\237\rOp\241e\216*\377\rN_\364\037\374-\020\354\201\036\241Zk\334V\312\224\002l"
+	.string	"h"
+	.string	"x"
+	.string	"L\362h\205\355\3732.d\363\030^\361D\271\230s\206\227\266\215\035^>\264\025,\270\235w\343\235\323\304\357\001\353\322\252\366\201\016\343\366\335\b\3139O"
+	.string	"\031\315\311kq\002\326e\200\013"
+	.ascii	"/\365.\360\3227\373\351<\025\363CJ\272!\2519\347kS\374v\275\371"
+	.ascii	"\017zk\334\301\271\256\034\3149\255\343N\211{o\233\305\366\006"
+	.ascii	"{o\002\013\366\310\371\276\272\327M9\3465f\2549u^\374\031\247"
+	.ascii	"\361\301\367\271\364\214\250\037/}\021\274\374\206<O/v8\375\331"
+	.ascii	"\274\034]\024\366Us{\354\363\376\225\357~\025P\355\002\325)\252"
+	.ascii	"FQ\365\t\2506\001\325\241\252KV\352\026\250f\201\352\225\252"
+	.ascii	"A\251\226\240Z\005\252W\325*\3257\020*\001i\3711'\211_\222\031"
+	.ascii	"\022\\\304\340\247g\262\376\322y\270\347\373x\202\213\\\3444"
+	.ascii	"B\255h\270v\005\013\372\321\204\200\226\254}\001\203~\f\367\200"
+	.ascii	"\316\342\270\265%\253Q\031\236\244aGk\001\034\031a\255\315\341"
+	.ascii	"H9V\313\002w%\027\354p\243\236<\262S\255\rs\"\367\006\020\231"
+	.ascii	"s\276\3706~\003\026\223\311\300\313-2B\365\216ci\210i\272\301"
+	.ascii	"\3577DgN\034\313\256j\237k\221\243?\353n\262\032\032L\204\214"
+	.ascii	"\026C\003\203\241\021g\266\230\254V\023c02\232\315&\326dl\005"
+	.ascii	"\034s\251\231\231\275l213\232\207\027\315\f6\363\212\325B\274"
+	.ascii	"\\T,\202\220\325^6Q\254\275B\036\356\252\271=\246\260\304\204"
+	.ascii	"\333\034\243\254\337t'\353\200`$\244EY\027!\272\251\224\r\022"
+	.ascii	"\341AW\371~\222F(\327\272w$M\276\211 e\237S:Y\327^\350\322\310"
+	.ascii	"\347\227\363\251\354\311\332~\222tS8\026D<)\037\0018 \300\002"
+	.ascii	"\221\261b\007\337\362P\304t\337d8\331\222\035\342\323\371\220"
+	.ascii	"\020\212HS\032nY\207\270\3173\323\236*\363\006k\355\265\373\007"
+	.ascii	"\326\341\310\360\336\2260\334\3403\024\270\303\361\261\374(q"
+	.ascii	"\231\330@\277M\3241 \251`\310\007[\346\370\201\263\214\341\215"
+	.ascii	"\365\270g\266\253@\330\346\334\206\256k\334\3203\362\264\335"
+	.ascii	",q\275aB\302\013M\303\247\001q\006\207\230\364\234\257\321\202"
+	.ascii	"\203\032\272\345\205\260\310"
+	.text
+	.section	.gnu.lto_imuInit.90.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"e\n"
+	.string	"\206SG;@\305\2521\2407\253 0\224\271\354!\312\266\311\317\204\345Z\363\340\231\202\233\337\274&\007\033\231\350X\227eh\374\347\370\363\322\253\350\030\217\356\310\030\275\244\360\020 \373\367\226R\246\0245"
+	.string	"6"
+	.string	"4"
+	.string	"4\333\275\327R\216\237^\351<\371\207=@\034\303\327\013\306iE(K"
+	.string	"dFU%Xu\210\207}Z\214\2519-\n\367^Oq\274\270\273\333^\260}`\337 \2360\315\213\357|\223\367N\243Qn\304VP3g\313\302I[\366\353\245,\373\323\277H\220\266\232\025\271w\225\013p\311\316\304\303\3661>\331)\227\271\356i*\025\001~\307{\354\264\317\345^\324E\177\366\020\217\377z\347\357\363\361\336\331 \220\n\214d\220\0244\264e\332\"\322\274\350\201\223\362V\246hh\277\344\371\037\007)\371\257\346hH\240\317\216\034<\337C\203\205\3706 \313\t\211\254\246\300`D'dG \030\262\030\331}\275\224Uk\344\255D\321T\335P\032\336\205+I(m%\374\224a\206\242\2328gf\021"
+	.ascii	"3\241Gh`\255.\303\362\313\230Ach\210\223\330E\375\254i!x$\246"
+	.ascii	"Z\321\205<0X\177\031W\\\272\230\355\320\300\024\024"
+	.text
+	.section	.gnu.lto_imuResetAccelerationSum.91.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"M\t"
+	.string	"V\020=90\221\322\001 \\,\021h,\362o\363\245\360\005\377'"
+	.string	"S \026e\314:\003\205\300Z\303\366"
+	.string	"\277\001c\313\214\251\311\303 \025,\020\216\367\005\372I\007&\247\215\333\356\235R*"
+	.string	"-"
+	.string	"."
+	.string	"~\307\236-\363U\310>\305C\203%\333]*A\356=z\376G\016\360\235H\217\234\205\335u\374N\034\267\274m\002\333\005\366\031\002\030>\370\351\214Q\374\367\351\217\264O9\343\022\322\224\342\314^\221\242\374\260\277\331\335\265D\331\034\201\024\214\202kwcV\263\261\371\"b\007\240-\272\316\344\n\257\362\025\303|\320\"\277\374\322>gG\353'Ga\305\033\246\265B\204\233\224\310\fn\373\340\252\213\200\230\335M\360I\236\n\376xD\240\215\206$\"\266\t\bJ\2619\200\350\207\353\250g\300\265\342\201\243\241Z9\332Y\3557+Q\r\252XI\232\354W\315gyK\365\003\024"
+	.string	"3\241\215(\360\rz\373\250\274H\355`0\362'\226y\030\f\001\343V%\0320\f\340\200\370\234\342"
+	.ascii	"\355\022U\002\322e\374\313\270\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_imuUpdateEulerAngles.94.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`J\013E1"
+	.string	"JW8\022@P\350\312p\354\232\303K\320\004@\335\264\n\300_\343)\313\"o\240A\030]\314\200\265Am\017\277F\373\260&E\004\364\250\034+d\233g\316\310F\334\372u\336\316Q\f5i\204\354\275w\222R\006\372"
+	.string	"\001\001\033\001\357\205\360\336\007f\257\203\262\227\352\275S\357m\360^\006\357\225z\357\002\2637\252\354\205z\257\202\367&x\357\323{\235\314^\004eo\323{\231\336\273\364^\245\367&\275\367\300{\207\3575\360\336\002f/\201\262w\300{\005\274\027\351\275\001\336\013\340\275B\263\367\250\354\r\276\027\370^\364\275\347{\315\367\226\357\375{\273{\271\204\322\026<e{\252\352\243\221\"\365\216\231Gewy\271\013\323\345`.\373\2659[TU\025\262\271\233cW\310&\0137\335\375\303uo*\n\007g\274;\244\252*\361N8\345\243 \020=\315\362\235.\243\031\202G64>\212\n\242\031\224"
+	.ascii	"1\302\300<?\212D%\177\2645J\204\317\262\001\236%~\220\330\214"
+	.ascii	"e\023r\216\220\265\315!\\\036\261\r\341#\261\251\225P\252\252"
+	.ascii	"\362\034\367\016\266b7\232AU\325\355#\033\020^!\357\256\223\335"
+	.ascii	"\235\332\025\322\b'\243\346\353d?\0312_\037\373\311\330y]\354"
+	.ascii	"\037\223hM\026\275N\342\0373hM\026\275\036\366\217\351\263&\301"
+	.ascii	"\336\365\021&\030\r\036X\033\271\257w]\304\t6S\346\353\317\353"
+	.ascii	"]\017\361\353\255\311\"\n\036#\306\353,\344\b\0339:\246[\025"
+	.ascii	"\034f\361\200\252\252f-\3371\230\025\313Q\330\334\026ff'\233"
+	.ascii	"]g:\246B\323sCv\241kUU\321\276T'\207\363\034\003\363\330\361"
+	.ascii	"QkD\273uLu\3629|"
+	.string	"\333\330V\354F\273\\\307_^,G\331\030g\315G6\227\317N6\371(\0237\177mi\335h\267\256\310\245\252\252j\237\311.\227\252\252\252{\267\335\367\226\275\227\354\275c\357\025{/\211\367\206\275w\304{\301\336+\342\275_\357\r\361^\257\367vu/\007\264\367\002\332\273\205\366j\241\275Y\357\265\360\336\nf/\205\263w\302\331+\301\354\3052{\211e\357\325{\255\336[\365\336\b\001}\n\240\206\t\256\340w\372S\002+>d(\215\323*\364\364`\036\241\305\243z\003\304\203\3228\276\333\n\304\202R+)\226TK\3631\325r\262\331\274lN6\235\036\324\263#\227W\"\220\343?}~\232\216\340\327cj\032.\235\351\377\222\240\264\341\223\224\016<)I\342#~\340Lw+\322\300\360\345\242\0027p\247\2765Y\366\261\0278\272F\316\336\212$0\307{\364\344\031p\002\277\237\200\001C\001/\357\326d"
+	.string	"1\306Bw\220\316df\255\022\325"
+	.ascii	"\276\233z\321\320|\fp(5\341\001\234\211\316\232\024\273\210\013"
+	.ascii	"\217^\221cg\255r\364\335\r,\207K\211o;p\034\017\303\2677\f\347"
+	.ascii	"\003\b/\257\223M>\n\n\376\350\35732Rj\340w\301\302N>\006\017"
+	.ascii	"\245\346\003\251f\210\036\370/\032v\371\363\273d%\232\217\350"
+	.ascii	"\241\326\216f\376L\222=\304\315/-Z\221\177\227/\375\326*\213"
+	.ascii	"\307[\252\251j\232T\377w\322[\223c\017{\237\347\270\3542\204"
+	.ascii	"Nq\017\f\022\354e\017\253\342\nG\f3\342\r\027-\314`\260 \312"
+	.ascii	"0C\021\203\250\242\206\r\342\325\322\236\315XQ\203x\343\354\254"
+	.ascii	"\006QX\227\306\245z71\271;i/\036]\310\302\2068}rn\375\302\331"
+	.ascii	"\330fe\353f_\221\240\326\343\200\374tf]\353l\024\262-\245\247"
+	.ascii	"\244O\340R)RN6\263n\262\361#\327\006<\223\265\360\nOaW\247\241"
+	.ascii	"4\334\342\245T\366L\363q\317\234lZx\322\223\266~[\274\341\233"
+	.ascii	"\2234\016\251\233T\270\271\266\367\227\207R\270\033\227\323["
+	.ascii	"/\3610\344k%\023N\341ld\344\364\203m\234\022>\341\357[\221X\227"
+	.ascii	"\360\031s\366\214\2148\215\037\236$'\327\211\365\024vs\324\032"
+	.ascii	"\321\"\271\234\336\032\211\207!_\037\301:\272\246\367Gg\022\333"
+	.ascii	"H\027\351\266\253\023\255\256\252n\025\341U\017\016!B\020\253"
+	.ascii	"\006\222\306a`\203\360"
+	.string	"`\236\217\305\243\342\353\221\3061\030\036\017\036\364\333#\227\347\240w\364\261uP\335\301\024\325\024\203\006R\f\026\\\352Lt\326\252..\036\333\341\353\2644\216\353\2745\332\202k\371\331\371\313Kk\304h\021\324\243\376\200\331\250\201<\006\221R52\222\202\244 \205\346\320\002\021!\242q\003\021 \2552N\231\"ZR\244\326#\360r\371\\u\007h\002G6<\336\234b]\t\fO\204\221\244\357\342\006$\370O\307\200[\270i7\366\275/J\357\255\017\223\032Q\317$.\317\226\275%\343<\346\005n'\365I\237\334\237\214%\212q\220\204\220\267>\230\257\267b\260b\334y\3514\346R4<\213H\027\363\213z\224r\213\357R0\244P'\227\003\242\201~\363\321\376\372\350\016\340\354]\345\377+\351\216\241\314\353\334\376<\"#\272C\305\201\211\262\032\213\004\242\033L\366\275\212\346\036\230\raD\313\030\317\270\022\373"
+	.string	"xO0\224\215\302\372\n\211fz\306A\203\334\034\261\037@s9\002O\";+\"\215\\N\344x\020?\245$\n\251,C\370\017\023b\241\207\303y\2639,6\\#Op\221#\331\240\016\032\237\377d\2042#\326\013x(\313\r\031\b\266#h\224\230H\232\200\267Oh\007\260I^\202;\243n\241\341TW\0048l\27238\204F\311\276\212\r\214\017\332\313\344\254\246\201E\177\3375\021Nk\204\316\233\351\021+\346p\250\030\200\001\013\260\307)C]lI4\352\007r\302U"
+	.string	"\026x\361\255\340\r\243iX:\030\216\022y\327\252\240L\333\376~\022o<"
+	.ascii	"\332\261L\351\202\311c\325\205t\374\253\341\250\257\003\033\340"
+	.ascii	"\363\371\223\241z=\271{\3447*qC\177\007\fXq;\226\032"
+	.text
+	.section	.gnu.lto_imuStrokeBoundary.97.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\250"
+	.string	"\r\013"
+	.string	"\266\224LA O\225\016\220}\b\001\001\256\004zB\203I\025\017\023R9\350E\372\201\002$\340\021\to\037\207> \013\265\304\006\240\034\017"
+	.string	"\006\202\020\026\216\320\221\261$\314\235\320i#\326\3306\266H\366\3362\2459"
+	.string	"8"
+	.string	"9"
+	.string	"\373\025\004Q\210\326\356f1\303\247\337\247\214\372\371\022\320\363I\271\244\360(=H\026Xh\200!Y1\301\022\335\3035\002\bR\275\270\354\256u\004N\270\261\333\016`;\304~G\221d?\365KU\037\373\212\260\245\242\301jW\302\253\305\262f\t\016\023\333W\373\247\243\276\247\034\030c\027\303\b\022\273!\210?\"\237\225S\260O\371\r\354\323\237\235\342\241)\261\244\017Nl\207h\017{,\240B\021R\227\355\005Wy\221\335\020"
+	.string	"\377\303Ap|\r\237f\320\321\217>\375\016\366\371\270\341d\252\200J}\364e\207 \215%\373rw\327\001\336\200\314\246\t\330h2]\307\301d\030c\341lZ\266Ap@K` \323h\004\266\f\323y\231\205\303\234\202L\227m8\256\313&\341\347\227O\004}Z\2422\332\033\247\037YF\317]\027^\"d\021"
+	.ascii	"2\003\352\ff`\362\240\204\200\211\005s\274\302.\020\367\206\216"
+	.ascii	"\013-\337\372\003X.\326\022\253)\300\035ii\257)\341\246\024j"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_imuCalculateEstimatedAttitude.100.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"-\013"
+	.string	"v\025OA\020O5\035 \341\343\232\213\200\006\"\200\016q\371\221\301::\335\375\227\203\025A1\262\247\346m\213Y\003\004\315\200&\024\366\376\031\300"
+	.string	"\024\215\n\n1>O"
+	.string	"bp\370\021c\312_\325O\332\3362\245<"
+	.string	"8"
+	.string	"="
+	.string	"^\361q\264\021\322\252B\211\326\356n\322\303\277O\251\237\377P\004?5D\f\227\023"
+	.string	"\353\304\013\016\0214'!\020\341QW\013\342G5B`w\255\241x\341\306n\273\200m\001\366?\002k)\262\177\372\247T_\313Jc\253\005\005\026\273\241W\214Ua(H\252\267/\261}\265\037\342\246\357\247\2163v9\254R\273c"
+	.string	"\207h\307@>\311\216\315wd\307\3749\037\271X)i\t\331\245\002\022*@\352\262\246\332#dvf#o\"\205\250\002I\320S\372\">\242\343\177\360\004\216><\346s\262c\003P.4\2302x\364e\217\240\312\016\366\347\356\006\031\004\226\216;\240\271X<oS\331p\205\262\351\270M\323\200\001\367`\301v\341\022t[\305\313l\024\017c X\274M\203\301x\233d\334\317\225\"\033(\2150X\036\371\231\022\265\035t\372\320\0277|$\370\016"
+	.ascii	"3\241Ch\f\256\201\371\260\354P\r`!\027+:\3142\370\271`\270`H"
+	.ascii	"\254\246\210\273\354\322`\rA\355\001"
+	.text
+	.section	.gnu.lto_imuPropagateAttitude.101.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\203\001\305\017"
+	.string	"\226\235iF\360\222(\035\240\322sOwM\013\340J\252\341\235r\370(\343S,z\273\325\265\001\337\360\037z'-\352\333^0\373\360\305 \252\313S^\311a\214l\"|N|\021\377\246S\252\231\322\216\006\217J>\331{\313\224\002X"
+	.string	"O"
+	.string	"W"
+	.ascii	"\237\334\007l\237V\331>\016\226\330\222\023)^17\273\333E\022"
+	.ascii	"W}\2332\252\312\027\371V\3378\016\237\222@\f\004\220\221\017"
+	.ascii	"\2034\261A\363\222#\237\313\363\251h\224\006>\334\330\340\371"
+	.ascii	"Z\222\244F\004\217\323\256\031>\025UN\312\356Za\237\206\233s"
+	.ascii	"\333#\333\b\354\347\ba\350\030\263\247\272s\230\237\373\354\347"
+	.ascii	"L\265\224\352\030\325\027\001 D\366\335Cmw%\034\2624\263\206"
+	.ascii	"\t\333\367\330V\360,T\207q\315\235\335\231\033\231\335=\361\001"
+	.ascii	"\356\323D"
+	.string	"^\355\257\370\213\352\263\013\017\260\033\233\221\331\005O\374\341>\r\236d\013\"Q|\214\026\275\216\326\213\fI\332b<\n\332\016\227\0069\f\022\267\353J\340\273\370\213\b\276\354\323%\317\333>c,\3202S\032?jBD\247\266\307\0064\033\227\006\261\037\363\026)_\346\n'=\354\264}>\236v\351\322\001\207\n\026\226\2066\330\3228\302~\f\303(\007*B\201\024x\246\324\210s\b\305B\211\324\241 \214H\022\036t\023H\240R\0272\235:\224\022{\024D\246\016\345y\246\316\003\262\036cNa\305\326\345\356\356&@\271\310\211\366\002\006z\230g\\\331=X\253\225\371\331:\036\027\232\r\370\317&c'Z_,\255\317x\r\024\n! \220\002\221\231\275\001b\001\253\r\321\237\316\n\242\035^\360Z\335P\313(\372\323\276\332\301BH\234M\2649y\331\013>\254\023gV\004f\211\340Q\b{b\240\374 "
+	.ascii	"?\342\370\350\210\001W\244\255)\200#\021\355=F\220\th\243J0P"
+	.text
+	.section	.gnu.lto_calculateThrottleAngleCorrection.102.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\030\002e\022"
+	.string	"6\344zG\360\320&\035\272\263\255\304\201'[9<\345J\244g\364OM\270\355\234\276\372\202q\177\362?\260p\017\300 \330\264\237\3263`\330\327\257'\203\250Md7\256\376\022_\025\262\371\304\276\344\034\256\250\273\273[#\233H\231Rh"
+	.string	"Y"
+	.string	"l"
+	.ascii	"C\030\376\363\333.?f\324\177L\373\234\231\217\320B\203\204\242"
+	.ascii	"9'\310\245\t\224.}\016\357\340\262i\t \274D\003\031h\304\b\331"
+	.ascii	"\230sz\037\367\340.\267\003\340.\367\302]\337V]>\3147\322\267"
+	.ascii	"\363\"\024i\276\233\200\234"
+	.string	"\233\033\235\370m\037*j1\217]eD\230*id\316i\r\305\231[\3366\002\333\005l\265\tsN\221\017\017b\361y.\355\362\242\017/\375\027\356Ro\032w\371}\354\333\t\233\321g\350\245\243\r\004\243\253c\177\233\233c\253z\365\237\273C\325\335\252UW\247\256F]}\272\332tuI\325\244UsW\313\253\267\253W\325z\365=T8<\342oD\3149a\3041k2\025B\370\324\220`\035\253\313};)@\243OGs\333\2617\021\223\243S\271\266\311\t\367\220\333\217mw\345\036\354\371N\342%<\363y\314\262L\037Z\306]n\273\212Qs\322\257\235\322\322\207\273\013$\203B\r\2660?\2620\216\330\325\361\3545X\340\324\246\017\214\243\021l\316\327\200\357\202\240\0250=\262\220g\253\035\017\007\361\240\203\021&('*$\322%!.),\257\245\301\t\013\205\201\247\302\"I\361JVX\274\220"
+	.ascii	"n90Y\361ZZ\255\025\017\0054\2779\356@\024\262\330O\003\306r("
+	.ascii	"\310\273\225\261\335\255G^\373m\253c[\265\253}J\205\332\322\246"
+	.ascii	"\366.\300\236\357\264\266\002\224\317\006\2439\303\264']\323"
+	.ascii	"J!\260hK{\260\350%\373\3144\022\023\021q\227\244\025\t' `\002"
+	.ascii	"\021B\326\003a\005\f\031\376eh\244\332\036a3\210\030\030\337"
+	.ascii	"i\025\343I\333\262hx\325\022\303\207\370\344\231Zs\215\223\367"
+	.ascii	"\203\305\306\332\246\340\252\344Ev\354\312]\024\363b\202\227"
+	.ascii	"C\2413\363\267 \307\017\314\222\327\020X\260\320\016w\366\342"
+	.ascii	"\200\n\260\223\027\233\233\236Q\227\247\025{"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.103.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\272\001\005\017"
+	.string	"\306\033cF"
+	.string	"\221(\0358\177=\307\203\275{H\255\222\003\274\304X\254\366\277\274\251\274\231\332%P\326O\002B\2764\335H\036\220\250U\300W\253<4\371e\331"
+	.string	""
+	.string	"\254\230-\302l\206\255\024'\372M\254\335\267do\262eJ\001N"
+	.string	"J"
+	.string	"O"
+	.ascii	"\0170/}\262u\274\265Z\020\023*\f2\260\335\335\342\207\237>e\026"
+	.ascii	"\365\344k$\0360\374>\001\204,\227\035\226g\231\201\0350rB*\021"
+	.ascii	"\340'Li\374\b/d!\273{\024\327\f\341\212\252F\262\273V0\324pk"
+	.ascii	"\267\315\331F`\253\200z\323\264)T\320\203\217g\201S\342\225\212"
+	.ascii	"\237\335\3724z\260\237\355\356:\266\330g\375\232\252U\325\377"
+	.ascii	"\200H\270\204\0071\263\253\212\365\330\227\2141\342c\373j\377"
+	.ascii	"\304aNgY\260g\267\003M\315nK\304\005:\227!\017\315\313,\334\307"
+	.ascii	"\352\222\246\001\207\0320\030Jc\216!bfhH\220j\3216\351\364\240"
+	.ascii	"\263\370\33160/\253\3541\327\370\034;\302W\250tv7\201\257\342"
+	.ascii	"2#\337\345\322$\024\351\243\314K\215\004p\260P\032\273\356\356"
+	.ascii	"\027\2552\037\035\244\300I)\017O\r)\fD\243nA\351D\344y&\016d"
+	.ascii	"n\3044\352\266\022\004\223N\302\203\355\244+\031m\234\227\262"
+	.ascii	"\215\200\2304A\344m%\022\311\333>\255}\266\261\305\235\034\033"
+	.ascii	"^\250\2702/\3433nl\364\276\2310\221\327\270^\330xq\331\326\001"
+	.ascii	"\266\017\334\205]\241\033\273\253\300.y\213$ \320\202\0311\333"
+	.ascii	"\006\002Co\311\300l\340;Y\016Zk\023\r\202;;\030\202|\005Q7\270"
+	.ascii	"\373`\240\206\240\311\251\321\n\304\251\234X\321.K(\313&'3\374"
+	.ascii	"\001\0260\037\302\342\341\335\246l\260\3045EpI\003\177\357\253"
+	.ascii	"gdA\310\355\312z"
+	.text
+	.section	.gnu.lto_shouldInitializeGPSHeading.104.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\365\t"
+	.string	"\006\322D> \345*\035@\216\"\353\360A2@\212\206\302\350\003\036\320\376D\313\013L\244\333\340\346\tj8"
+	.string	"Z\313\324c\240\370|\232\214\306\215A\200\314\240bs\260!\f\210\262z\255\232\020\"eJ\0011"
+	.string	"3"
+	.string	"2"
+	.string	"\013\362\361\337\352\350\233\3761\270"
+	.string	"\304\310\244\220\255\357\227\360rii\310\324W"
+	.string	"\363\241;\355\272\"Q\252\002\2349\247UEv\334\340m7\330F\260\3775\217\223\366\354\322\244\033\263\377\315\205\331\352\207\0256\326\212\274,\300\234\254\036o\346\300\225\021\325\333%[c\205\205\222\307\227!,\202\231\312\006\312n\316R\fk\316iQ\337\306>\206%\016.\335N\300ET\257\334n\314\037\303/\304\311LJ\007\330\257\3356\3722k\220\364\252\203>)<\370=\355\007$K\356\025\356l2@\036qD1\341\371H\210\026\236\007\220\330\021a\210\033\003\207.\"D\342(\024\022\211\232r~a\376\314^n8=\311O\373"
+	.string	"o\326r\303\355M\256\313a[\003\017"
+	.ascii	"p\b\370T\307\253\303\216\251l\200u\267r\215\004\035\343\303\205"
+	.ascii	"\256\341\n\023\344\374F\033,\217k\216*\035\212Z\005\005"
+	.text
+	.section	.gnu.lto_getCosTiltAngle.105.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"\245\007"
+	.string	"\262M36Po\322\001 ;\305\017\"i\324Z\r\023Q\212\327\2264\222\251\032\364G(lM\362\331\263\231\241\023B\316\232\231#\2142\017\255t\215Z\323\237Q\203\354-eJ\001\336h<\234+v\036\034.\210\206\030q-p\342&\233\210\232\002c\022\fY\354`X\026\255n\377VE\251\231\220Z\230\304'\fK\310G<\004\243\335E\350.B\341\223\016]\361\311o\207\376\347>\251\016S\003P\241L\331\035(u\303\376[\025\331O\247\n\2300\270\227Pv3R/\253\002Q\035\2665\333\362M\377\320\354\323\353F$\003\217\226\013\023\227\335\215\231c\252\303\367\201\352P9\256=5\377 WX)\245l\034\350\t\220\260\273\316\215\323\270\365\007\266K\002\016"
+	.ascii	"2\241\221\037\030b\202\2219\032\023A\305\201\330\fV%,\327p\341"
+	.ascii	"\020#fl\342\256H\263\341]\367\006"
+	.text
+	.section	.gnu.lto_getQuaternion.106.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`D\001\025\013"
+	.string	"\306\023G< \345*\035H\305\300\004l0\247\240\201\341\236Y\226'\203<EG\230\212\204\002\036f`\220o\261)\303\310\330r+\026\252"
+	.string	"\020\002\310\032\b\006;d\002\354Zn\277\020O\b\3312\2452"
+	.string	"2"
+	.string	"6"
+	.string	"\337;\227G\360\336}?\360\336y\264i/W\233\t\241a\274\004\354.8;>^G\377\256\017\220(\323U\300aw\255$j\343\236\267\235`{\301\376K\347vw=U\366[\277\247jN\325S\325\252\352c\n\\\031\250\177\334v5n\266\235u2\020\214\355\253}\221\217\214o\225n\260\253\202\255\354\226\fV\b,\235(\241\303N\264\366\371\022I\004\253\335\275\013\031\300\243\2338\366\355n\203O\362\022\222\357\361\316\026%=\371\316/y\357>7)\033\253u\322\233]\232tr\330\001\"\316\b\304\271\243\031}<\240H\"\3023\001\001Rx8\037\260#\206@M\306a\305\203\b\212\302P\0041\345\236\333\251\362\007\2406;\315\013s\263%\274\214\205\253\315\031\003]%e\316Mj@\035"
+	.ascii	"2\241+h`\\xQ\001\003\315\001C\200\0340\026\005iE\005\002\264"
+	.ascii	"\001\306\005Y\242 XT\300@s`H\024\344\200\261+H\003A\024\265F"
+	.ascii	"(#2U\203\007\020\\lhVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_imuComputeQuaternionFromRPY.107.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\315\b\245("
+	.string	"*L \020Cp\236J:3\2009v"
+	.string	"\037\026\037\207W\341\274\016C(b"
+	.string	":\305T\303`\252\336\204}w6+\033\361\215\273,\306\253^!\020\232\366\201h9l\303\n\3578\235/\313\251\257\206}K\332&-\355$\003\361"
+	.string	"\331"
+	.string	"\361"
+	.ascii	"\336bw\261\277\330q\266\234-\306\236\263\311\330f\354:\013\355"
+	.ascii	"\332\\\354\305p\006\3430\036c:\227\361\031\243\331_\035\217\031"
+	.ascii	"fz\270\222\361!6'd(fH\n9\"%\342\214\214\370r$D\027\261^\315\342"
+	.ascii	"$L\220$\001Q:\213\265\214y\213\230\353\215:\327\2541i\222Wk\235"
+	.ascii	"2\271\036J\223M\275}\223\243\301J\024\254\273y\312\230\251\274"
+	.ascii	"\230F\325\254\270#"
+	.string	"\256\326\372`#\224&\215\246\347\256\2418\312\230\245\300\360Q\255ku\342ju{\260P\245\311us\0225Y\032\211\232\334\261\335:v\023R\231\226\004\222qeO\2555\370 \036s\351\243d\357sl\355\313\020t\206F\346\322\351\307\215\035\366\261\261\261C\306\2449L\032c\314\036\016\037\210f\326k\252\265\032\215'\r\264\342\234\276\f\265\326\235gh7\274A\336]\033\273[c\267\374\021\306\264\342<.\324\375\237Z\0238\031\201\312\346q\326Z\311~ \300\031~A\241~\262:\265*i\314f\237]7\262y \273\356\325\257\355Z\212}\301[\274Y\356\342\305\362\027\357\225\343\274V\226\363Z\260\030o\005\317y'\230\214\267\312f\274T\256\363\006\035\370\315\236j`+\266T\224\251\330P~\3632\260\025\357\002S\361*\240s\237\350\334\004t\256\023\235\333D\347\"\240s\017\320\271\006\350\334\002t.\001:w"
+	.string	"\235+\200\316e\242s\227\350\\%:7\211\316\r@\347\"\321\271"
+	.ascii	"\350\334#:\327\210\316-\242s\201t.\321\347\016}\356\217\316\025"
+	.ascii	"\242s\203\350\334\222\316\365\221s)9\227$\347\366\310\271'\347"
+	.ascii	"Nr\2565\020\341\231\203f$\307Zk\034\377T;R\016I\317:\372\200"
+	.ascii	"\242\013\270\222\332\023,L_:\026\322\231\316\004(\351KWRk;*="
+	.ascii	"\300\257\222$])\370$\244\007\240:\222\036#\033\200\033\335\352"
+	.ascii	"\323\2131\315\302\217\016\340L\200&\234\352G\367\271\251\360"
+	.ascii	"\242\033\235\364R\365\340\213^T\245\r\317\310V\004Z\370p\016"
+	.ascii	"X\201\350\300\241\023\375c\214y\277\017\335\306;\f\376;\322]"
+	.ascii	"\033\335\204\017\343\204\252\202.\264\340A/*:9\256\240\372\260"
+	.ascii	"\315.h\226\337%zM\237\005\337dv\262]8\267Y\303\246\326\305p<"
+	.ascii	"\3161\253\265\354\311\367\3626\262)\270\357\300;'o\214ye\363"
+	.ascii	"X\322; O\247N\376Wt\002\347\323a\264\223\206l\360\355\365\244"
+	.ascii	"\276`\352\216\366\336\300j\374\367\244\376\377\2524\301#\017"
+	.ascii	"d\215\306\316\361f'\355Q\337\336\204\272\202\323Hc)%\275\371"
+	.ascii	"\250\373wyvA\375y\007]]D\016`D.\337P\b\346\003#r\225C!X)\266"
+	.ascii	"\245\005F\344\242b[ZC!\030\215\3405\251\274\246\004\257Y\345"
+	.ascii	"5\305\266\264\204Tp\205\t7\fuu\0219tm\t\303\204C\341\317\004"
+	.ascii	"\361kC\330\226\013\257r\271 \270`!\f\206\251H!\354B\021\034\n"
+	.ascii	"\267X\004\271\276\300\202\020\230\226\330\342\304W0\214H\374"
+	.ascii	"\n\376\334\252{\365kF<i>\007\337\036\235:\203\323(\361|\330\225"
+	.ascii	"\275\270Ks\267\303\207\351\263\215\302\353aW<\331>}\027\204\375"
+	.ascii	"X\375\351M\202\357j\231\217\325\023\250q\372\256\b\353\261\272"
+	.ascii	"\023]\323wG8\017\326\233\376\273\203\202\005\301wI\030\317\325"
+	.ascii	"\021\034\017|w\313v\256~\340\277\273'z\f|\227\313xY\317\272\201"
+	.ascii	"7\005\276{\302t\260\216\365\002j\214l\004\276\233\302r\026\256"
+	.ascii	"\254\265RX\307\031+\023\002\341\024\2011\346\354\316\325\257"
+	.ascii	"N\340@\265't\003. \200\231\250A`B\tBtA\222\024\024$I\032\003"
+	.ascii	"0\003\021)J\007\021\320$\206\320HI\250e\324'cO\003\303\222I\214"
+	.ascii	"$`\304\367\2052\221&\177\353\021\223(\245\243\202\"\"l\220r\025"
+	.ascii	"<\t\201)G\331o\235\260@4\255\005\336\251S;H\347\177\226\356q"
+	.ascii	"j\355\275\022b\232\241M\\\230TP&\355\247\344\223\336\232;\254"
+	.ascii	"\017r\260\226\367m3\005\003\206\235A\306\321\026K\306M\240\006"
+	.ascii	"\215\266\277\206\324h\3124#Y\270\310\2639t\273\0368\215&4Xd\267"
+	.ascii	")\035S\264\230\375h\333\336\341\365~;1p\327\332\347\023:\260"
+	.ascii	"m\013\363k=vb\"\357\013.E\205\234E\0132I\n]\207\026\254V!\322"
+	.ascii	"\2315V\217\271\002\200\215\033\022\265\2473\310Dt\264d\342\232"
+	.ascii	"%\207\253'2\336,d\036\001_\342y\002-\004\345\366\321\035\003"
+	.ascii	"\302I\231a\252~\245\215\374Dt\306j7\3243\346\007\306\254\f%["
+	.ascii	"\\\377"
+	.text
+	.section	.gnu.lto_imuSetAttitudeRPY.108.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\366\001\235\016"
+	.string	"\366Z_E"
+	.string	"\2216\0358\0354\rz\344\237\3770\201\201\004\321\352HE$\022\276\024\351\325VD"
+	.string	"\322r\347j\f\373f\004\bf<\320\300\f\026\021b\377\252\252\252\004(\372\007\3709\262z\207\237O\323\0061\332D\312\224\002G"
+	.string	"F"
+	.string	"O"
+	.string	"\330\243\237\366E\3744:\3121\316vkP+vw\201\021`\217\007^\340z\264N\340z\364\310\266\361\260e=@\330\\(\221cw7\345\360\321s\344\177\3043\320Dz\002x\260\273N\320\264r\353m\177\330n`\347J\242<(29\311\203N\240\n\221JQ\222\035\222R7\330\267vw\255,\366]~\316\303_;\352\3172}=\0353m=\255\231\316\247?\200\243\243\206\351\247\031\273\030V;6\025e<\330\276f\273\250\030\2046\n\002\032CS\325\316\315i\225j{\256\2023\320b\207\034F$"
+	.ascii	"\215\335u\200\342):\n\236w=\036\274qM\325\031\025\031\245\\\331"
+	.ascii	"1\317`,e\267\364\221\351\265\243\341\204C\345\003J\256\214\345"
+	.ascii	"I\374\204\b\333-\035\364M\374\305\202\337\341\321%\001&\236\023"
+	.ascii	"\035\341B\035I\374|>\220e\016D\344u[hD\244\373L\330*t\036o\343"
+	.ascii	"@%\033\210\207?\222\020\320\026\372>\320\246\205{k\225\305\230"
+	.ascii	"\212&UR\024\030/ \314\\jGx\r\215\213\250\227*\fG\243\n\270A\275"
+	.ascii	"XjKx\013\031\026\252\226\006' \360\002\242Qm\0032B[J`\nl\260"
+	.ascii	"2\244\f\003\366 \331\232\266\304\314!~\205\345\2611\216\007\237"
+	.ascii	"s\273(\265\274\005\242\273%c\311\006\366,\215\337\026\030\230"
+	.ascii	"\321\032h\275X,\005h\334\021kc27\263\203\220\367\034sP\324 -"
+	.ascii	"/\204A\006"
+	.text
+	.section	.gnu.lto_imuSetAttitudeQuat.109.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\234\001\035\r"
+	.string	"f\227TB"
+	.string	"Q5\035\230\203\201\203(\003\002\0239t\207\3158\307evir\253\0072k!\006J:h\336AK\350p\254\202@Z&=\314m^\377\377\377\017`\0133!\346\t\214X[\021\211J\262\355\336)\005?"
+	.string	">"
+	.string	"C"
+	.string	"+\277\274\355~\224\200\355\356\305\004\264W\001\0170y\225\034\300\344\325\241m\343$j-\"j\\p\341\330]\216\202x\370\031\372w}\033M\342g\266`w=G\223\206\233\336\366"
+	.ascii	"\333\030{*\b! e\211\2126)N\372\301\276dw\327\364d\277\365og\375"
+	.ascii	"\331\311\277~\365\323J\305C\312\364U\310.\206\221\330\226\325"
+	.ascii	"E\b\333\247\330\255\034\027\026\215\003\344\207\001\355\325\237"
+	.ascii	"\366G\234D\370\"\031\2657\207\361b\207\252R\233\363\0260\021"
+	.ascii	"J\355\356,\374\242\250\335M\340\253\370\212\b\035\317\233\274"
+	.ascii	"\"\340\020Su\030\315\021g\363&\236\002\324vG\037\375\023G\341"
+	.ascii	"\361S\257\006\201\363#\030\022\315\217.\020\026\036z\205\203"
+	.ascii	"\267\006\003\352t\334\007\002\247\223\360\200\233\320e:\234\346"
+	.ascii	"\363p\030\213=\n\233\217\373x\336\307Q\310\275d\351\311\332\215"
+	.ascii	"\r\345\210\222@f\230\201\350\313P\226\032x1\217i;\310\350(IT"
+	.ascii	"\364Fm\315e\304\b& 0\203\021b\250\0032B\017\311\300\fl\260c\210"
+	.ascii	"\003=Zj^\212\206k\242X\037\036\307\246(\030\356B\3742p\347p\274"
+	.ascii	"\335\264`7\360$\262\374\326\3041iKM\f'\30747\263\203\310\343"
+	.ascii	"\030L\310\253c\016\206\032\274\345\2050\310"
+	.text
+	.section	.gnu.lto_imuQuaternionComputeProducts.110.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\370\0025\020"
+	.string	"\206\036gC"
+	.string	"\2234\034\030#\364\313t\016%X\300UG\304}\342\271\013Kqt\331\275zh\217\224\307\235\317\030(\"\204\025f\220\300,\002\013\376\013("
+	.string	"P\200\026\243\263\210V\222\372\036\017Zi\273\355\336;\311\224\002S"
+	.string	"M"
+	.string	"T"
+	.string	"m\035j\213\037J)$1\274|(`l\215\302)^\236\245X$\263\305\006F\346g\240\004:o\375\034\200\363\326\031"
+	.ascii	"\347\255\257\226\207\277\021Yr\001\241\201\205\217\314\364.\302"
+	.ascii	"/\343\253\266\n\177b2\025\243'Af\026c2\016\356\335v@\333\003"
+	.ascii	"\355=\004\017.t$R8o\276\t\013\r\235\331\n\356\264\237\n>Dk-3"
+	.ascii	"\263oi\375\331\"\236\331!\307\222\216\035\035+:6t,\350\330\317"
+	.ascii	"\261\335\261\236c\271c\267c\265c\177,\036k\001\244\022;d\216"
+	.ascii	"\201\311\334\260\363#o6\031&\002?(\347\363\366d\232\377s\020"
+	.ascii	"XL\217\356-\211gx\356w%\216\341\251\341\302\275Eyf\273\317Q\360"
+	.ascii	"\213MG{\233\262\314\357k*\273\370\335\201\205\306e\206oW\206"
+	.ascii	"i\321\340\204\244\003\205\363\20641\034\337\307?G\206\023\260"
+	.ascii	"\272\274\2423]f\"\250_\002\021T,\005-\223k\325\265L\256\225\326"
+	.ascii	"\323\210+\205\362Z\023JP\025$x\026P\246\224wb\235x#\245\252L"
+	.ascii	"HX^K\245by\241/\255\345[\332\341\344\334\254\034V\322\333\005"
+	.ascii	"\266\361\234T3z\313\3008\266\217fDo\035\370\306v\321A`20\241"
+	.ascii	"\267\020l\343\017\355\200\336\232\\\0230 \360\002\021A\326\001"
+	.ascii	"\002CwJ\201a\260\356\236\341~0\353{\356p=\230U\343=\230\217\036"
+	.ascii	"\303\2751\030\241\036\303\2751\2302i\034\310`\270Z<\351b\270"
+	.ascii	"`\\M<\351\025\246k\265\313\220\005\260\365\214\001\236x\233\231"
+	.ascii	"\274\326\230\342\273\360\233\307\376\031\327\252\205\200:G\264"
+	.ascii	"\f\2550\303\002|h\020\227\027-$\003"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeOffsetSet.111.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\206\001]\017"
+	.string	"v]hE"
+	.string	"\2234\034\033l\265\tY0\027\"\327\307\363\217\255}\024\221-\351\307+/\373\023\246\223tq\265z\013@kT\026.\0320\221\211W\327\221\356\"UU}\206F\201\033\311\276\366s\321 \355w\267\275\267\224)\005W"
+	.string	"N"
+	.string	"X"
+	.ascii	"$\017}\200\367.m\224\r\362\002\006(\247.\312\274\b\304d\034j"
+	.ascii	"\204\354\212\240\216x\352\035\247\231\362GB\325\273\017\3049"
+	.ascii	"\256\204\307\006$\364*\341\002\205\255T.\244#\302G\200\320\205"
+	.ascii	"+\201\241\361\3413\317\227\220\225\3719\331]\247+\364p{\267\375"
+	.ascii	"\300v\002\373D"
+	.string	"\002\026U\2510\373:\216\343h\215\261_\273?\247?\247\335\236\323\234\246S\323\0371\235xu\b\217\023d\3675\336\026G\027\303\304k?\355i\237\346\300\212d[.7`\370(|\361\262\317P\247\235\276\256=\353G\214\306\263\273\n\336\031\301\367.\352 \247\302[\234\324\006G%\213\260\370\3644\027\260\323\343i\353\321\t\241\n\263\326\256\301\273~\346_\216\0245Z9\304\236^\r\364l\030\342\321oN\227!c\223n\243\362\034\036\273\333@\305kL>\211wfi\311\273\336\371-\336;O/\036\264\351\270\301\310f\253\034\035\031 \244QLXF\"p\205B\212\310\302\004\360\202(\302\bD)\231@\223\002&a\220P\002WH\244\022\b\022\367\032\343\314\273\370-6\343\346\205\372)\317\334G9}\261\315\251OV\3122\267\273\333\001H;E\224w}TUe\357\324l\354\340\024\266\342\371\327\354\323\f\035"
+	.ascii	"b\b\270\352\034\206&\034D\261\260\253m\330(\265\343\336\020\034"
+	.ascii	"\030\020\020\bJ\202\301\334 \021X\334a\371\370\032H\220\030f"
+	.ascii	"|\331\f\345p\031\001\006vT\217Ie\b\254\222\244\030\005\256\221"
+	.ascii	"\257\304\253jdV0\367"
+	.text
+	.section	.gnu.lto_imuQuaternionMultiplication.112.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\324\006\225\036"
+	.string	"\226\271\276E\240\326Jc\304\234\260\324\243P\321\r#\347\243\304@z\321>\035\336\f\270\350k\"^\013r\305\335[\266H1F"
+	.string	"\314^;\345x9^\216\233cA\215\215D #\021"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\200%\237l\222dJ\001\262"
+	.string	"\214"
+	.string	"\261"
+	.string	"\037\256P\231=\304\271\024f\263\333l7\373\315\216\263\345\3549\233\316\275\326\216a\031\236a8\017M\3035\\W\037\035\217\003sD\n\310\025!\020gD\300\333\221"
+	.string	"nH"
+	.ascii	"\264e\330\3156\007\323\222\004\261z~a\030cf\313\340\tbJ\037h"
+	.ascii	"iJ\230\3149\235,\326\252gqh\347BlgfnX\003B\t\2554Y\266^a\026"
+	.ascii	"cV\0233\315\234h;\344\346\024BU\251g\261B\343\360,\366l\303\263"
+	.ascii	"\330\261V\211\205&\346N\232\016\0160\244\3149\177/\3411\313\261"
+	.ascii	"\332un1;\323`\311R`\316Yiv\006\302\275\333\032\265E\320\262<"
+	.ascii	"\bns\261\354\346^\371\315\265r\234[e9\227\312s\356\224\351\\"
+	.ascii	")\013\355\237\325\354\250\313>]\326\351\262M\227e\272\354\322"
+	.ascii	"e\225.\233tY\244\313\036]\326\350\262E\227%"
+	.string	"\272\354\320e\205.\033tY\240\313\376\\\326\347\262=\227\345\271\354\316eu.\233sY\234\313\336\\\326\346\2625\227\245\271\354\314ee.\033sY\230\313\276\\\326wY\227\313\266\\\266wY\226\313\362.+^vw\331_V^\326\003bZt83\\\2249\003;\327y\326\216N\224\234\343\034k\367\034\037g\311\b\274\271\315\257nl\206\214\301\232\323\334\312\345\342kN\303c\004\316\\\346U326F`\314aN\025\003,\203\271LY\334p\f\276\274\345S\276\273\374%X&\304\007\304\245w\226\267\004\267\374\243\327\345\036,\347\n\361$\215\367_\352\022nTQ&\257T\374\356\274\213Pv\210\020\177\225C\304\356P\362\376\377 #\260\354\3138\344\217N4\3147:\354\3159\261j\033c#0\364PX\254\305x\026}\256\020K\246\250\221\311+\255P\203ws\316)O\242\365n\3169{\264\326.l"
+	.ascii	"fs\263\002\006|\300\b\234\300\n\274\300\f\334\300`\025\302\276"
+	.ascii	"\"x\361\250\272\344T\227,\204\2500\013Z?0\n\023\264*H\370]\320"
+	.ascii	"r`\341\007\301\353\353\027\265\323-\256\b^?\260\255-\257\237"
+	.ascii	"O8\275\233G\3539\231\322\203\354e}z\223\252;\375\251\351NLo\002"
+	.ascii	"2]fm\310c\351K\250\256\364%`\322\225\220\236\024<:\322\221\215"
+	.ascii	"1ht$E\227\272Q\220\350EC'\022\372\220\325\205\036\2636\034\006"
+	.ascii	"\275\210\007\f0D\\\305\254\311\324\201\036t\251c\004\016\335"
+	.ascii	"\335\234dF?\007\372\256\312\250\"\353>\377\371\256n\004b\275"
+	.ascii	"\347>?\224\021xu\236\367\374uc\320\352<\367\255\rc\214M\002~"
+	.ascii	"\250Q\\f\315I0\241\224\224\024\024\322\034 \003\t\204\210\332"
+	.ascii	"\021 \235\203\314\310\005TY\206\032c\343\375\211\364\224j\332"
+	.ascii	"F +}\241\346\316q\033\350t&l$B\263\006\212>P\026k\344\f\276\022"
+	.ascii	"H*\f\0210\265Q*\315\233p\224\330\\fib\347\024\344\326)\334\303"
+	.ascii	"y/\310\036fy\f\344\337\341\032\372~\351\360@CO@\361\2536\004"
+	.ascii	"\235\306\"\223\3676]&h\260\005\016]\032\"\3411\370\026\226\244"
+	.ascii	"\233#\354\252\272e\336\030\275\246\004\245\005\277\335\247\255"
+	.ascii	"1\357\273\322\321\004\333\216K\032\036\333\224!\tLm\344f_\350"
+	.ascii	"\236\334J$\313\0262`\0231C\0066\0013\344\300\226\310 \244\224"
+	.ascii	"%^\212(\251Xo\377\210v\013`V\341\004\2658\374\037"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeTransformVectorEarthToBody.113.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`<\006\225 "
+	.string	"\246\276\316H\240VN:\324W\340\324\253\343\207\234\203cLN}<\210\271\274\265\346\nJ\272P1*\204n\341\253\214B\343(lK\3633\275\312X/M\216\227\343\303\350\017\245\252-\037\332z(U\375\037J:\366e\326\222\235\244L\001\272"
+	.string	"\250"
+	.string	"\301"
+	.ascii	"s\0353\3270s\235\233k\334\\\337\346z\234\3539\327\237\353\235"
+	.ascii	"k-0\343\344\003\230\256\265\221\344W[\027\222m\354\321Bi\250"
+	.ascii	"\326P=\323\333j\275\241i\266\316Z\212\346\2300\235\226\255\323"
+	.ascii	"Q\265L\315\324\206ug \222jl\230$\232\016_\204\030\0220\231\316"
+	.ascii	"\b*\215\rJ\216 W\211\330\213/*$I\022\320\321\002r:\016M][ah\214"
+	.ascii	"\240\312\340\300\253!;\224"
+	.string	"}\355 I\262$\037\345t4\231\352\334t\314)\316MG\007m)J\246\202\344\215}\361`\246\205$I\340ShP7hU\033\n\343\005\266\245\2133@\222\244\327\013l\204\372j\033\200\355\237}K\0222\270\266\315\273U4\005\362\243\252\007\217\b\212\246kX9\222\344R/k\016\325aee\241\243\257\260V\275t\264b\335*\\X\3652\022\226\022l\345\267l\262\256=\n['y1{\256\247\346Zj\256\243\346\032j\256\237\346\332i\256\233\346\232i\256\227\346Zi\256\201s\375\233\353\244\271\366)\r5\222\326P\037\351\231\332He\250\006\230\353\242\271&\232\353\241\271\026\232\353\240\271\006\232\353\237\271\366\231\353\236\271\356\3155o\256y\346zg\256u\346:g\256q\346\372f\256m\346\272f\256i\346zf\256e\346z7\327\272_#K\207\272\356\002\314\312!\314\307\307\274W,\205k\352\331\201$\271"
+	.string	"\344\016s-\211\270\337\236;\020\002m\202\273^yz\323o\3771+\205\363\377x^\224\222h'P&K\202.\024\344Xp\270\342X1\365\375\2173\213\272~?\026\313\241\323\223\256W\033:\212\b;+sr&d\372\324\257\346C\351R\277\232\232\322\243~\265\262\337\241\3764.%\261\353\367\247?\315JI\354\372\335\351O\203\302t\337\233\026\250\0226\246 cJ\367}\211\201\"9\242\264\345w\337\201TZ\204\310\357J\342\004\2201\337}O\372\213%\261k\333\254in\240C\274\226#I\022JH\225\357\232\246G[E1a\214\031TK5(\0065\325\357\202U\025\320\002\204\007U\022\034"
+	.string	"'T1\260\002ReU"
+	.ascii	"\376x\276\242\320 \013h\341\352*\013\250#\343\322\2139\207e\214"
+	.ascii	"\215\353]F\272\225-G\257\222c\314\350S\256\302)\f\307\026\023"
+	.ascii	"E\027:\022\321w/\232\372\320\211\206.T,\207A\027\272\226D\240"
+	.ascii	"\373<\350\347\270\003\335\247\b\274\324\177\336\363R\016{>\357"
+	.ascii	"\003\365\245\367\264\225\302\336w~\304{\357\312\363\335y\037"
+	.ascii	"\020\245$J\035x\036\241\316m\276s\334\221\234\343\256s \234\347"
+	.ascii	"\374\347\3468\357)\226\302\233\367\314\312a\315m\2564\237\257"
+	.ascii	"\371\255X\022\233\376t\232\343,\031\222e\34617\372\346\220\371"
+	.ascii	"\314\356\272\313|\300\001}\262\013o\250A@\304\f%\247\002TRP\222"
+	.ascii	"\2449\340\002\221!\252m\021@\265DV\001M\313\252\346\002\341\177"
+	.ascii	"R\231\245\031`\265$\035\300x\332\217)\037\036=\202\230ccsQQ\f"
+	.ascii	"\255h\020a\255\203\034~k\245\334\030T7E\b\341\351\023\310\204"
+	.ascii	"\034\243\310\347\037\241\177eH\t]X:_\337w\301D\330\366\205\013"
+	.ascii	")\340\023BN`\3512\360\314\330\254E\304\250\205\346\3008\321\036"
+	.ascii	"\331\366\r\353\210\360\313\315\373lYL\236\326\003\224bfp\340"
+	.ascii	"\357\340:x\356\306aH\3613\220\236\350\223\222\007!\007_\371*"
+	.ascii	"!W\277\363\003\032\206\272\"\354OZ`.VP8\3766\004cI\032\324\023"
+	.ascii	"1\021\230\316\326\247<\025\265\306}\245\032\n\313 `yG*\254\324"
+	.ascii	"\302\203\177"
+	.text
+	.section	.gnu.lto_imuStrokeBoundary.part.0.140.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\212\0075*"
+	.string	"\212I\b\020I\200\234Q:;Ij\362\376@T7K\245\212F\267 r\323'\341m\224\346YEe\335!\232\251\255\366\273aIh\341\300\004\322\253\351Kk\330\355\022\323\034/\234FX\226\271,\225\206\020\304\315V\373l\226\020B\310\336I\006\343"
+	.string	"\344"
+	.string	"\352"
+	.string	"\036\326\243X\302WYje\316\312O9\225\246WY\n2\266y\030\201lKI\241L\355>\351\2434\204!\341\257\230Z\ta\250\351WLA\3036\327\250@V\206j,\347V\350h\017\255G\331\276\367\255\360P`\234m^*\373\336\356W\375I\323\241\300\350Y\316QX[9\267\r\216\266\202\365h\320\201\322\243\347}\322\243\335w\322\335Be7u\267y;\225\317\214\201\2242\226s\316\035\305B\032\377l\337\353mz\215\245\315V5EO|mM\375\341k*Q\224\215\035g\017D\331\320q\332\001$\312\034wv\342p\234\017\234\356\252\022\005\261\361t\365&\2277\236\336\226H/\307\213>\375d\227\306\213\317(u\234A9\347o\375\316X\026\357\355\271M%\3129\367\211<\336\267w\267XwGu\247i\002R\215m?s\316\2711\220n\366v"
+	.ascii	"\3666\020{\373\207\275\355\323s\273\r\340v\033w\273\315s\273"
+	.ascii	"}\273\335\266\335n\327n\267\331\333m\332\355\366l\265\335Vk\267"
+	.ascii	"\323Gy\243\354\355\223v\033\277\375/\355\366\023\344\250x\240"
+	.ascii	"r\256\321\254\223}\240]F\316\374\263~\254?\312\337\345d\204\355"
+	.ascii	"#*\306p:\263Z\241\026\3631-\332\207c8\021\177D\270J&\223\344"
+	.ascii	"\216v\273\202\351\337\231\2538\235E\306\214Y(\330\277\263\235"
+	.ascii	"Z\272\030\203\334\032;\252v\277\317\345\\}/]\204^\275e)\242\254"
+	.ascii	"\245R\261Zu\2678Wc!R\230\364\273\236\245\233\355\340\271\272"
+	.ascii	"\301T\020\367\255\204})\267r\255o5\313\304\242\324A\306\214E"
+	.ascii	"i\035*\327+nh\204\345\234Id]\271\262\024d\304\345l\004\307\221"
+	.ascii	"\234\225\0019\247X\252\317\224\242xA\025\221+0\033\236\323\314"
+	.ascii	"\002SbO\302\251\341\031\266\341S\353\b\305b\032\256\341\037\221"
+	.ascii	"\234\230\305\251\3301L\213\206sk\272\210\267\211t8\315\\s\316"
+	.ascii	"\023\372a\177\263\324/r\264?\024\025\245Gg\370^\256@\210\026"
+	.ascii	"\262.\"F\177b m\300\252\307y\251\2121\210\341i6\233\315\363R"
+	.ascii	"\214U\234~\035\241\212\2779\347!\306R\335"
+	.string	"m\224\246\030\305\025\230\361\226u\037\354l\214@\204\b\221\036M1\276\301$\263R4\244f\004\212\377\025\247%\013\373\271\347\272V\021\202\251dw\t\023\367\311\276c\226\2241\342a_\214\306\b\025\025T\325\016\214O,@\fy\347\370b\214\237\345\247\222\257\260*\344\224#\305\333\354\276\231\237\201\321/\322't\367\311\243}]z\364\370[\277_\250\230@U=\021o\363\342}t\344\200\347\353%\345\220~>\337o7 \330{\241;\203#\220~\275$\035P)C\020\367\0032\031\261<#\035\220\347\342\002O\305\017\230\024b\267\323\341v\273\013<\027\272#58\202\347\353\211HB\342\001\201J;[\357\034(\371z\271\244#\243\336\212\0249\244\236\316\227\333\001\2039\007\002\372\307\202\007\314%\375~\300\034\373\363DD\\\254a-\2359GYx\326\037fu\243\264\017ve\250H1cr\210\267\311\006@j"
+	.string	"\302'\016\340\244\201\003\020V\275\3024yj\032\226\242s\024\023\250\202\362\203\213>\370\304?\370G\250\233\357\360\267\201\003\207\364\250O\2024^M\236fX\252\331!j\017F\207\234B_\361\214\006_\361\r\202\177\256\f\276\342\036\374$eT\260\n\340N3\r\250\261\323\001\207o\030"
+	.string	">\277x0\213qX\025;\")Z\341\301\022\312\232\271\222u\270a\325k\013Y\233\003\200\245\250q<\304\2203\244fDD\204\0244\031\016\220\002\221\"\253:\021\220\261\204&IR\331:\377\252QviZr\364\267\356\254J\272%\366\022\262e\345\375ziB[\2512H`z\354\311\205\313\245%\214\202I^9\026\306\"\0261\202}\033f#\345 \206\237\220\034\204Z\352\270\332]\3221\310ISxF\003\2768\006#j\005\226'\220\034\305\2202%\316\230K5>\365\020\022\307u\264\030\337Q"
+	.string	"I~.\001\255"
+	.string	"\023\225\027\326\223t\254)\300\360\374%J\270`\370C9A\n\311\216\367\362I\223\350\352\005\233m\"8\300d\373\216\007\0306,\265\374\361\375\275\256'\263?-K\177\007\344\017\220\007:\236\334\272d\363\334\r\\S\033\373X\236\221\337\335\271\n\254\236[c\002L>\302\327\201'\363\342\302\242\216\031\370\2122\bE\235Oo\300L"
+	.string	"\034\264\004\3202\bJ\301\243Y\237"
+	.ascii	"\273y\300\204Z\346\316$\275 \344\347.\355\336\013X\360:\031\216"
+	.ascii	"\211\245?\263\236\346`5\0300X\314\341h\212\353\031< 7\307\373"
+	.ascii	"Y\022/L\346\360\254dd3m\234:\300\023\266\030\362)1\372Q\001"
+	.text
+	.section	.gnu.lto_imuPropagateAttitude.part.0.141.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\361\f\0358"
+	.string	"\352e<\025<@dN:_W\005\0137Y\035"
+	.ascii	"\252\022\320\317\256\020\201\347\261\307F\211\b\321\312\370\255"
+	.ascii	"\254\244\013U\322]X\b\346\337\262\\%\307\206\234\007\213\252"
+	.ascii	"\320B\305\331fZm\033!IJ\031R\001\027\001F\001\206\230X\223a&"
+	.ascii	"C\270\266\266Il\251\022\245J9r\344p\304\221 =\2024\303\315\215"
+	.ascii	"\003\013\271\021#\345rEqf\321\273\253s\025lwy\021#%W>s=8\327"
+	.ascii	"\302\b\250D\315\3368P\211\232q*\265\313\333\203\017m\022\357"
+	.ascii	"\271L\310\210v\217\353\203\017\255\020<Gfj\255G\037\275,'n\271"
+	.ascii	"\016\343a=\334\207\003y\020\027\342\301=\n\0322\304\206\305\223"
+	.ascii	"\020\2416*\004\005\n4G\022\n\3008\006\364\003\212\037\376#\307"
+	.ascii	"\200~0\236\231\276:kFN\271\016`*\"\237={\002\323\376\362\344"
+	.ascii	"1\204v\307\216\035%Z\347\360^\337\242\2753#\323\231\243\\.\273"
+	.ascii	"9J\256Oj\017r\351c$\251\326\n\306\351\222\0319=\356\233\375\342"
+	.ascii	"Pg\325\273\333\273\3417r\fg\377\026\252\326@C=\265V1#\247\\h"
+	.ascii	"7"
+	.string	";\343\270\315\020,g}r\267\335\273\274\206\331\310q\233!L\240V.\201zjuJ\340t\035\0309]'\027 rjd*\"\247\273\234fw\343\356Vn\027\022;\363*V\237\031#~\206\265V$\247\367\302r\374F\345\226\233\351d\216\317\203\334L'P\270\247\030-\252\325Z\327\030\2057\345\335=\333])\273QY\001h=\227]\251^\022Q\275#\336\273\366^\021\357\r\361^\020\357\375 \325\353!\252\267\303{9\274w\203\332{\323\336\253\341\275\031\336\213\201\357\360\242\275\367\302{-\274\267\302{\317\336k\366^\n\357-{/\331{\307\336;\341\275b\357E\2767\354\275\022\336\033\341\275`\357\205\360\336\007\357\375z\257\203\3676x/\203\367.x\257\327{\273\336\253\340\275\\\357M\360^\004\357=\360\336\255\367\032x\257\326{\263\336\213\365\336\253\367Z\275\267\300{\253\336K\365\336\251\367\022x\357"
+	.string	"n\304+\200#\361J\261%\336(\326\304\033\200\005\361\036\337\013\340\275P\374\3445\276\267\370^\"\013\362\246\357E\331\217\371\357mv2\363\212\306CSSk\223\303N5K\312G\f\0132?\231\0051\0032\363a\376c\276\303L\207=\305-\033Z\2518\363\2368{,\333\217\024\241\323b\366\206id\223a\255N$\247\335?.;g\236\036\277\261\342TcX\355*\230\217\315\323\303\200F\217\232_F\324\302\005\221\231bgD\f\245w\311\251I\222\335\3476\354\022\216\374\037-\233_\377z\330\021xZ\362E8\330%\\\353\331\365\256G\270\001O\020\376\340`/>\227\315\255o\035\302\261<Y\335\352\017~E\210E\216\203\013\370W\2033\270\203\023\3237Xp\25730~\301\361^\231\024\\\352]\\Op\005\315\364\\\b~\340\t\216G`\374\201H\006\036\365-\255g\335\200\361ZX\277zV\363x\254"
+	.string	"O\177u)\302+\205K\276\002\017p\253\363\243e\263\352T/p\242\200\037_\365\342\324\t\234\352\250\337rO\352\306O=}\016xz\002\3773\352\003(\2755\024%Kz\"\300\255\357\224\274\327D*G/Q\362\300Kd\250$j\333\232\251\344\201\247\310L\255vf\333G\032\t\214e=N7\206\214f&\247\3132\210\234\006\370\013\274Dg\330"
+	.ascii	"\370\021\352?\200\"F\250O\325]\221S\274\221\370\277\330t(\361"
+	.ascii	"SuV\016\223T\241\373c&\236\226d\251\233vxh\311\256V:/\364\351"
+	.ascii	"\033\317\337GO\274\264\344\253\353\303]>$\242\\\326[\036B\344"
+	.ascii	"\264\317\203\234\242\316J\246$U\350\372\260\337e\217r\213C\t"
+	.ascii	"$\210\220\005F l\035\204\255\205\260u\322\306\215\033?f\020\335"
+	.ascii	"\222o&x\264\321\260\221\204\022\033K~\302X\362cc\311\303\325"
+	.ascii	"h\033p2R\274%\203\260\031\227F\330\017\2676$\034\016\2666\035"
+	.ascii	"7\220;\332d\270!i$} \303\260\366\215\207\215$\022\356\355-\211"
+	.ascii	"lV\243{\335\236\321\277\313\356\222(\323d\306\364\2158\211\377"
+	.ascii	"\2716\242j-\004\035#\230\004[\304\261.-\367\274\032D\032\027"
+	.ascii	"\315\314\020\215\347,\f$h\367\271\017\007q\"\237\331\317\376"
+	.ascii	"\341\333\313=\017\337\225[\323zrm\254\362v7t\230\016R\213\276"
+	.ascii	"4\230\017!\326\326\210\035\356\341\377c\344\023]s\370n\211\023"
+	.ascii	"Dfv8\227\335\347\2324\373Tm8\207?\321U\253\035\355\273*V437\034"
+	.ascii	"\r,\004\024,\362\271MS\333\323\360\264\243\317%_\206c\270\206"
+	.ascii	"\027\023-\233e\317\360,?\262c\270V]\363\017\275p4\013\257\360"
+	.ascii	"\013'\342Y6\307n\241\354\025NE\330\2243\366\263\027\237d7;\025"
+	.ascii	"!\226C\n\327\222\345\353\024\n\313\336\304\322\3652Cd\267Re\353"
+	.ascii	"d/n\301\002\270\034\373n[S\331\277\250\274Z\353\024fN\270\325"
+	.ascii	"\307P4x\216\336\024\306\341\023\373\376qOx\343Y\njd\200\373\250"
+	.ascii	"aH\345\fCS3A\202\202$)H\032\003\360\002\221!\332\346\021\320"
+	.ascii	",)\235\222\031I\312(H\013cr\307\255af\273k`\306)t\276_\351\035"
+	.ascii	"DV\344\233\231\360\341\004\030\033\205\345q\315_B\251\260\301"
+	.ascii	"\001\300^\214\342E\356Ud\032\200\310\332c\274\305\027\3751~\252"
+	.ascii	"\0136\255\342f\035\260\031Y\244lC\312\2364kJ\323\346,\274p\327"
+	.ascii	"}4$ \246\035\364\033\373\360\017,Z\247\212\212\334b\2372\320"
+	.ascii	"^\323\316\300\212\363\256\343\300\277\2415g\374\006#zCk\3168"
+	.ascii	"\rF\321\345n(\270\255\310M\244\316@\260h\372>\304C\"T\322\246"
+	.ascii	"\022FJ6\255\221\2022\203\322\306A!\316!\351\227h\316\242\360"
+	.ascii	"q\221\236tO\361^h/!ba\240}\322\242G\023&\331\271\314\346\315"
+	.ascii	"d{\252C\rY\321\031\006\3627Ay\3348\223\362f\302y\224\252\263"
+	.ascii	"\326\234\221\322\342aG1+\311\203\017w\364\2202\207\250\224\024"
+	.ascii	"LC'\235\365\200C\361w\2211\3069\343'\274Ry\274\352@\330\212\371"
+	.ascii	"\325\331\215\2232C\223\023\0046\005X\\\363\262Ax\275\203oVl\t"
+	.ascii	"/w\307'\355\263=\242\267~]\230\200\235\023W\375`\205\370S\223"
+	.ascii	"l\nB0\243\321\3345\034\214~6\236,\302\360\353t\006\353 \333I"
+	.ascii	"&\375\237\330\344\213\273\003\327\217j\202}d\205\344\346\020"
+	.ascii	"\342\274[\363\025\275\323\006#\376\214\022\226d\006\224\267\221"
+	.ascii	"\301C5\353-\343\033\264\336\301\247\314\210\272hMl\004+\001\020"
+	.ascii	"-h\003\177!\002\240\246R\264\200\200\236\226\375"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.part.0.142.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\345\002\365\025"
+	.string	"F)\215E\300\332(\035\200 D\337\b\262"
+	.string	"\031t\353\030]x\323\233\2616\311w\200\314\224\222\240\021\360\277B\373\377\372Y\324\326\211\255e\243\376\265\f\004PZ^X\027\320nG_\235\243O=d#\177\"!d\023)S\nz"
+	.string	"o"
+	.string	"v"
+	.string	"1s\3428\302d\316\331\202K\213\300K\233\317x\227\335\013x\227\366\177\330f\275p\313\266\362\331\216I\323\223\263\302H\2279'\351ru\274\365\317\223\335*\330\362\023\360,\221\215\256\177\037\004\332?L\341\261D6\322\270\247\262q\306e\247\340J\023.39=d\2411\205v\2411\246+3\252\350l\346\234\267][\2140U\002\007?\bsN\377\245s\307\334\266\n\333\025\354\375\002\017=\023*\275\314\267}\200O\256\007\027[\227\356\216\027\354\346\346\260\301\327\356O\252=\251\226\235\272\353\324\273j\375\354\277"
+	.string	"\255\321"
+	.string	"\310\2349A`\346\r\351\304\307k\277}\277\310\211\3706\207l\277\306\262M\314\210\177>a\314\263\320\322\323\343\312\234sti\007\340i\367i,;\024\262\352g\254\017A\321\315\346\370\302\252\366\203\\H\353CP8\257\361\344zQ.\005\203\206\r\033\274K\271\017\303\343s\316\331\211\274no;"
+	.string	"\034{\221\267\333\255u\205\016L\203\354C9\020\207\016\036<x\227\273\257Q\331\353\234\323\265\273\343\321uE\"\271\230~\261\377\3447\377\370<\376\340\233o\336\245\356\203\032@^t^\032\324\204\211A\250\240\310\350\3276\335\214\270\205\364>W\022\202s\276\220<\t\t\237\347\322\250P/\273t\251\360\264*\231D1\224`\302\271IE0\341\254V\241(be@\245\301\204:eX\245L\242x\242\024\300%\006'P'\322J\304\315\t'\004)u\002\201\"\225D\025\211\001\215\303\022&\221\264\nC\221\244\337\034\264\237E\225\030\270\327\302\276\335\261\250\006\344B~\253\335\3502\265\037+::\270-l\004\n\256=\201\202\372\344\266\340b\235w@m\013\027\364\262o\273.9,8\330\272\274W`C\212\fY\343yw\221\345\001= \200\002\031+\335\006?\022\204\313\030L\016\372\013"
+	.string	"F\361\363)\232\227BI\216a\342\3726RWa\235co\344\200\231\017Y\32448s\035N\261\375,\006\314#h\373h^\343-W\301\222q\013z\334\256I8~\340\376\363\307\031\273\303.\211\3720\377\265#\261$"
+	.string	";\264pv4/\204,\370\n"
+	.ascii	";5^\340\361\370\274\331\361zI\221\263\206mM\331e\200\324\336"
+	.ascii	"\271 \346\340\243\307\027\234\352\351p\213\265\317\t"
+	.text
+	.section	.gnu.lto_imuInit.part.0.144.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"}\b"
+	.string	"R\21788@\217\322\001\230\256\360\2600\372\"E`a\032\0026\226p\226?\330\023<f\352\354\031#\267D\331\b\242\b\342\f\374\204\023\222\016\250\005\272\254\375"
+	.string	"\027\250\330\312&r\247\024>\230\336\234\034gb\363\030\270O{"
+	.string	"9\210>\035\207\3734nz\f\274uD\237N~\022\021\035\005\204\254\350\264\217\334fHv\n\354\201\270)?\317\233\022\263\r\177\255\242\334@\322\312P\r\325\224m\r\364WB6\302W\"+<Zl8\262\354\321\276\300\2007Y\240e\244\265\241%\250)\353\365k\025ek\3461P\262\3731#\263&\321%\305\276jdc\330\343Ul\217@L\262_\276B\331\263`:X1\273+\037\365\344\244+\274H\376U\0070\235J\327\200S\310!\301/\315\302\356z#r\307\333N\260\355\261\315\022\021"
+	.string	"O\023\030\027\314V\224\3003<@\024\fs\205\2730aqF,\352\234N\013m\246\3544"
+	.ascii	"\\{1\345\264\234~m\031\003"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeOffsetSet.part.0.146.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`\276\003\r\027"
+	.string	"\226i\217J\260\022R:\360\215t&{7\215\311,\301\370\214\366\270$\336\206\336Gq\225\374P\302JE|\bV6\357\257\366\373\333\177\350\030\021Av\314\263\031xs\225\033\370\357H7\"A"
+	.string	"^:g\306\352S\344\036\202\375\177\023\271S\nv"
+	.string	"u"
+	.string	"}"
+	.string	"\177\341\322\350\366\"\035\313v\304\332\323s\241oDt\"\356E:\257\277z\036\220 Q\217Z\253\201S\023\200\235\232<\200\353t\036\305u\272\276\360f\2276\316.O\357\302,-\267\036\333fi\3019w\342\t\036"
+	.string	"Aa\007\030\307Z\211\263\3235\361\334w\2229\177\376|t\337\027O\016\177\254tX-\371\204\370<9\371z\251\265\032&\342\246\267\215\300\366\001\233T\020\302\341nn\315\025\362\222'\353\006\331\236\216\321\351\022:MB\247G\356t\227tZ\204N\207\320i\030\235~\321i\027\235\246t\232\244\323K\247'\235~\n\031\214\212\001k\345\331\nR\201\350\023\212\037\375I\277\323\327\276\277Tt\272\275)\307\262\036\261\016\3058\023\356M9\257 \352\314\261\"\250T"
+	.string	"v*#\217\342r\231\244\204\204$\333\231\324\336\316\224\214\037}\350\377\221\254\254\267\272rG\266\3441\331\020\331rg\226O+6\351\206\254=C3\377\023Y\331\316\352`\033\262k|\255ka\373j\362\001y5\307!\365\332\004X\303\035\355Q7\\\353B\356\244\273F_\212\342M\366j\335\251\354\222+"
+	.ascii	"\312\247\2027\267<\367\273;@\312\007\344Yx\r\250\271\237\302"
+	.ascii	"\262mN\303EX\255\325\305\237\361\247\232?tj\r\266\371\237\315"
+	.ascii	"u\372e\341\243\n\b\03092:\313!fzfe\203\rm\206S\241\206v\201\302"
+	.ascii	"\f\003M\306f6sc\233\255\244\270\226\201\346f\206S\253\335\314"
+	.ascii	"\312\223u\203\374\342O\346\237s\305\326\203\355\330\372e\267"
+	.ascii	"<\357\311]!\3336\022<\037\224\352\226p\311\332\013\256\345\203"
+	.ascii	"A\311N\252\037#\250z\253k\360,\036U-\216;\025\333\301\261\256"
+	.ascii	" \374\030\217G\222\265\037\274\312\305\330\325\216\033#H\200"
+	.ascii	"\201\201\372i\355\346\226O\346\310\332\023bfI\250q<\305\220r"
+	.ascii	"\002\022\242$A\n\032\r\007\240\002\221\271\252:\021 A\211(\020"
+	.ascii	"\252P\201\246\3550\004\353\"\247\266\327\316\206w4\232\212P\325"
+	.ascii	"x\233CT\313\377\261c\342fg1C\025\306\333\026\bJ&v\253\350\370"
+	.ascii	"P\310\025/Y7\224\341\323z]i\241\234\013\243+\032\n*qQ\0363Td"
+	.ascii	"%0\366[\316\263\207q{P1\220\333'amT\250\302\267\231\252\314\200"
+	.ascii	"\344z\250\241\032\373Ov\tU9\372$$_\213\b\357\022\302~\301\276"
+	.ascii	"\020\030\024\211T\213Q\373WWcT\376\022\203\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`8\007}\031"
+	.string	"6'\220J\220\330Q:\220\351\274\232\270y\341\037wZ\321W\271l\230\207A\t"
+	.string	""
+	.string	""
+	.string	"\020\3634\002\200\021\220&DB\244\355N\355\206\240\007\370am \235\327H\347\325l\366\207\366\311[\215\326\200\016.\244^\017\006}}\334>ir\357\024v"
+	.string	"~"
+	.string	"{"
+	.string	"\366\346]e\204\256;,\204\256Q\366A5\352~\034t\315a\033\234\313\250+\016\313\340XE\277Zp+\005G\211^U\006O\205sM\363\004v\275a\177\301r\b(\324\237b\203*\r\240~j\177\252\215\322\347S\345\215=7R\336H\340Epx.\306\327\377\262;\317\352}\253\344\277\236\027\347Z\345\377\3315\315\033\344\357\277+\252\312\356\2757A\177\211\375\017\200'\375\261J\fZ\372\221\362\237\341T|b\"*\035I\371#\025\221\206E\245'%\247#b\023\202\327\023jx%eR\177\213\260\257\305\"\365\305N\364\263\034\365\303L\364\261\224\350_\261$\372V\354\210~\025\021\265F\210>\025\020?S~\350\203Y\276\036N\204\223\311d\262C_\212\345\320\207b7\bi\030*3"
+	.ascii	"a\350;\271\360\263\320ob+\020\225|)\0349\341^\326\274B$\364\231"
+	.ascii	"\004\304\343\017\307\365Hu\343\212V\335\230\226\322\216G\332"
+	.ascii	"\270\242?\033\017k\035\363\221\314\n\332\270\236\265J\215i\361"
+	.ascii	"\"\252\261Q\225\335\251\032\013\321\233\324\006\325\2455h\r."
+	.ascii	"\305\235\002n\307\240\214\003\234?\031\323\240\325\b\224\261"
+	.ascii	"\214\276\227\030}.0\372]\212\375/O]M\247\256\367E?\331\324/\343"
+	.ascii	"\242\037\246E\037\f\213\256P+\372fTt=S\364\3110\365\307\324{"
+	.ascii	"\357\177\203\"\347U\331\275\367\372\374\\\f\371\005\266\353\341"
+	.ascii	"\331\351\343"
+	.string	"\032E\346\343J\345\363\361,\275\332\331a\241\331\343\333\361v\322\320\324\322\036\327zO2\004\210TN\207stxf\326\207\231F\0358\003,\274\025\340\372C\307\343\342q\321yLCm\266lx\206\002wL\323\332q\355\210\334e\3518\307*\307E\265\034\017\177\225c\232Y\017\364x\302\303\226c\032\212\225\343\001(\216\205)\020\307IKh\020\307\001\200\205\2501\024\n\222uI\n\n\n\245\306\340\002!*n\003\021\200\210G\025S\022\210\304\021\211\036z\030\356\261\003\fR\207/\344\224\027dR\311-\244\267h\225\226iO\340tQ\243[\234\ri3\235\237\211Z\207'(v\003\347\303\357\210\007!\345ps\313\253!F\314z\352\002\270\372\361\265Da\2651)\255\351Q\030\217~\346q\376\026\3170p\006+{\034\371.\322\317\232\370.\351\307\232\374}\0353\322\232G\331\313\022\007\354\021H\345\375\365\370!"
+	.string	"q"
+	.string	"@\361\207\346\262\307@\273P\3479,\346\221em~QXE\021X\311\244\236\315\032\020\262<\330\330\320fRF\027\233\371\004\200b\236\026\333\177\362\346\203p\240\355\242-\023\0326\332]6l"
+	.ascii	"\362'\030N!\330\211\201\202\357\2003\327I-\350\336\023\267\270"
+	.ascii	"E\330\\\032V\001"
+	.text
+	.section	.gnu.lto_.refs.5408d891ecd1f5f0,"e",@progbits
+	.string	"(\265/\375`f\001e\f"
+	.string	"FbW3@\213\223\306\330\306\201\356\237a\030\206a\030\206a\230\t\227a\300w\033\363\005\234\372\300/\310SW\005~\343\027\332\323\302`ohm\315\210\335\233\020)S\nA"
+	.string	"M"
+	.string	"M"
+	.string	"\312q\272\261\366b\255\304ZI\351R\032)\205\224\036\tE8r\213\340\026\344\326\343V\3436\343\366\342\326s;q\033a\273\261\325\330fl1\266\027\333\212\355d\225l\327\252l\241\365l_'5\007\001Z\231\2242\351dr3\321\302a+ \226\002B'4+\241\321\315\303f\036\024\223YJF\227\203B\230\035cCE\351\242\220E?+\347\2243`\270 \255\025$\225\202D\235p\252\004\bK}\260\266\301)\203\323\005kCNA\326v\\B\002\3660\3260v\214\003D"
+	.string	"\27607\227\325X\026c\261\r\222\245xtR\261\312\243Q\305\356\221B2\323YLg\033:{\351\35425\323\315\t\211\222\204\252H\241\213\036\307\234c\021\221Z\210\260Vd\332\220i?\24650\255e\n\216\230\002\363X\202S\242T\231\322\225\371\346\035\023YBK_\206\230\022\216\031\275\367\332\037J\n\307\234\254]k\241\365\201\310h}=\240\216=\216\235\303\rS\362\331\365Y\365\331\373\250\001\031Ez\036\275\200\004.c\243\001\007\017"
+	.ascii	"b_\371<\b\343r:$\177\335\322V\310\357rv\354\026\222X\270\303"
+	.ascii	"\300M\2505\222N\314\"f\214\001\023[\306P\026\313H\001"
+	.text
+	.section	.gnu.lto_.decls.5408d891ecd1f5f0,"e",@progbits
+	.ascii	"(\265/\375`#NuS\001zFF~V LQ9\351h&|\242\276\370q\322\004\343"
+	.ascii	"\212L\005\202\200\223r\220\225\244S"
+	.string	"|N\r\2134\230Fp\354\\\322\350\256I|injUY\375V\205\324ht\231\201\3737\263\376:\212\252E\030~\362\313[\021c\237o\361\273\223\3567\347\224>#R7\331[\356\024\310\006\332\007\033\b\366\tG\231\265\276o9\347;\356|\2239\017'\245\247\274\321\372,7Z\007[9?5\032Q\236\234\237\210j%@\255\004\270c]_W\360}\1779\337W\316+\353\021\276[5\302_\326#\374\246r\372 \353\021\376\262\032\341n\322b5\231\324N\220D<6rz\244\365}\227\235\257I\230(\t\277\213\234o\256\363\312j\204\337Sg\315\325\b\354+\371\342)G\177u\222\016\332\222G\nG\337\366\352#5\371\266F\302\213Bf\264\"_\216E\372\276\363\271\"\347\234\353\333\260\317\335\335\335]}\033\376\333H\017\021\242l\342\245\3579\300\372\332PTQ\206\001\025\003\314\254\207t\217\257\3313+"
+	.ascii	"H\251\221A\244\213\324"
+	.string	"d\017i!\027\231?|@:\353\240\211\343\002\337W8\347\337A\266L5S\210\\\365}5\313\241\247o\340h\033C6g\255=`t#<\350\255\266j\033\325\r\353\001cw\312\234\221\257r\260:+\017X\316\310\377\315\325]\r\244\177\264\217\232\354\255\326J\353\255\356\321Y\325\215\b\bdx\2249#\317.b\304\322\004\335W4\347\253\230\263u\364\216\232\304\240y \211\332K\217\225)}_\331\316W\f\260\275\273\253\030\340\327+\347k\224\363U\2063\251\036\341\276j\0325YA\327\370\b\017n\217R\210\204\366<\331\203\247\357\253\221\363\265\002\\\357j\005\3705\353\374{\206\214\037\0357ZdI~\255c\374J\331:\003\3139\027\005\271\231\223%\255\357+\216\363\357*9\237(1tL\301\240\362\201\342\245+\255oSuO\365\2137U\273\370\b\017\036\024\225\311rF6\325\315\371\251V\002\f\325J"
+	.ascii	"\263\r\311\323\024|_\255\316\277\245\222\204\354\260\201r\322"
+	.ascii	"\242\002\"$\216\030\035\325O@W\300\344h\351[W\365\f=\025\345"
+	.ascii	"\234DN\331P}\254\311~\352\247z\327\271\272\021\271cf:|\270W\226"
+	.ascii	"]bp\347\272\254>4\272\234\315\320\367\265\352|\225c\307\rX\236"
+	.ascii	"\272"
+	.string	"\247\342\251Ie\245{#s\216\232S\227Cf\316[o\300\252\236z\247.\253\033\021\020f\210C\372\360\201\030%\b\236\363\276\2728_\217g\265\253tj\262C\255\363\332\246\312\271\371\204\314\310\2343Q\255#\002u\325\367,N\022\344\\;\340zwW;\340\033\317\242z\204/<7\250G\030\307\301\340\214\342\242F6\007G\210\310\035R\n\234\277\306U7U\216\267%\216\006\223\276\265\226}\255\267r\216\3129O\320g\350\264\226}\203\252\021\356\255z\204/\250F\270\266\021\361\ng\204\255\260\2209-\347Ld\267x\221\312\323\267\331\230\t\332\022\022\366\242o\245\302\226\006\206\313\330\026*]\276\252\2265-_\264\332\216\374\025M-S\337*\231\252\246\246\251g\352\230\352V\327\324d5\363\3270ULT\325\262E\255R\231\241\214\314L\365\362\265\352\226V\301f\b\243\3149\177@\372\360\341C\005\222'\016\t"
+	.string	"n#\353\021N\252F\370/\234g:\217\236w\341|\357|\007\316\263p\036\003\347O\234W\341\264\240\032\341\277f\371+\224JV\261\330\251\252\255\234\2263RC\263\2213\004H\337\3775\255\252U+\365JMV,\177\245R\253\374\"s\306Bv\346\203\203)<\314\244|m\210\2273\230\036[r\316\257e\277\210\277F\251f\025KE~m(\n\231\217\374\024\231R&\266\3149#}\370\360\341\203y5\003\221#?\267\346z\204\213\252\021~E\373\006)\331\203\377\234?\317\343\363\367|\237\026\324#|\253\021\276[=\302G\326#|V#<d\006U\373\355\006\177\305#\202\277[8\377{\366\333\0171\374M\302\262\370\253Q\227\206\300\b\313\001\017G\301\002\023\273\342\267\035*\\\215\263\"<\r\206\337\032\377*\204\342"
+	.string	"\377-b\323\372\243\341\257@E\333\001'\f~+\202\035\376\026\370[%\373\013\241\202\377B\375\225\356\257s\376*\347\257t\372\313\272P\353\374\3507\207U\204\300|\177\377\354\007Vh\245\241\377ZI\241\215\254\320\bH\341\034~\223\002\277\305\300"
+	.string	"\276\377HZ&\004\310\270\241\261Cv\205\3062E<\205\226aV\340\202\350\257?\3677\355_\337\376\277\331@\232\277)\260-\324\223\005%\r\201v"
+	.string	"\007R\270\206\377\026\3776a{\225"
+	.string	"=\002\004\324s\350F\377\035\362\367\357\003\277\005\372+\t\017\374\266\003\177=\253\235\007\375w\351\357\021\226\003\266\002\r\302\361\257F]\376\326"
+	.string	"\317\177=\370w\372\177\236\277\217\354\006~\313\202\325\300o\253\315"
+	.string	"\005\026\003v\205\377H\3779\320F\256\200\377\242\360W\022\326\304\337+j\210\363\376\033g%p\305^@\205\277\007`-\320D\024/\372\257\231\2235S\370\355\007(\330\n\3745\t\203\277;X\n\330\t\004\357\341\b\370\355\t\1775\252\024|"
+	.string	"\377m\273\334\341T\271\222V\345j\\\0339\005\377\r\341\257\004\370k\001\376j\200\277Z\360W\001\374]\345?\376\315\253\277\331\374-\367\367\233\277\343\376n\363\267\233\277\347\376\016\332\021\376n\373\373\355\3575V\204\377D\277y\346\257\377\335\177\373\337\025(0"
+	.ascii	"\222\377n\377\311\374_\223\346?\232\377f\376\213\371\177\346"
+	.ascii	"\277\232\003\375w\204\377U\376_\371\237\366\337\312_\341\376"
+	.ascii	"\233\377\035\300oK\374v\001\277\345\340\267\"~\233\301o1\370"
+	.ascii	"\355\005\277\355\360[\016\277\335\360\333\241\337\006\375\366"
+	.ascii	"\374-\376m"
+	.string	"\377\255\347o9\177\323\375\035\347\357\264\277\305\376\006\373[\351o#\177\007\371[\353o\254\277e\374\355\342\357\250\277\217\177\227\340o\026\376\036\301\337'\376\006\341o\021\374\275\342o\025\177\247\177\023\377\356\375\355\364\267\360\357\340\337 \370\033\375\273\205\277;\360\367\006\376\306\300\337(\376F\341o\n\374}\302\337%\374=\302\337%\376\016\341o\b\374\355\200\277\031\360\367\007\177s\360w\210\2775\370\373\303\337I\177#\340\357\013\376.\300\337\026\374\225\316\337\024\374U\203\277\202\370\273\303\337\023\374}\364\267\321\3777\177=\377\243\370/\367\3277\177\205\373[\303\337D\177\013\375\r\364\327;\177\367_\365\374\025\317_I\374\325\316\377:\1775\372+\005\177\025\372\237\302_\353\374U\356\257q\177e\363\327\020\177M\300_/\370\353\320_\201\376\372\363\377\304_\315\277\336\277\332\377s\377\341\374\177\373\217\345?\n\377W\374\037\363\277"
+	.ascii	"wwww?\220\t\177\220\335\377\201\227O\316\377\002I^ \025\316\006"
+	.ascii	"\253\022\246\234Qf\253\234\301\203\226p].+\307\233\312\271\206"
+	.ascii	"\002\312\302\202\302\316\337\036W\353\327\307\257\217\273\325"
+	.ascii	"9\347\f\346S%\b\2262cY%\375\267\373\3352\323,Ir\245\357\203\260"
+	.ascii	"\316\377\365\375\343\374d\225s\246a\"\263\025T\020\376\353\253"
+	.ascii	"Yk\322/Tm-\300\377\2333\t\013 3\024\032Y\316\271\3169\225\254"
+	.ascii	"=\361\260 \377\377M\267\234\243\270\216 p]Eq\345\230B\343\272"
+	.ascii	"\3220\205\306\225\217QI\216\032\2542\327q\n-g\rQQG"
+	.string	"\021\266\256\246\320\236\262\206)\264|\225[\244\271\252\031\311u\314Q[YC\216\312O\031m\353\312\202\251(\256\253)\264\247+\rSh\\W\031\215+\027\345\250'+\252\250l\245!\243q\321e\264\255\253\242)\264\255\253)4\256\257\032\207*\215\025\215;\262 {j\330TT\226\021#\353\311\252\310m\n\271\225\341r\256iR\331*\273\345\\\200\234\263\266\254\340\236r\324-Pn2\240\260<mUd\316\271C\f\250\256\255\034\345v\254\331mj\311V\316K\240\230r\214\234s\356\340\210t\313E\252\333\021HV\256\222\3129"
+	.ascii	"\031\231s\214\234\2175\273\345\234\2179g\037\253,d\316;\212\246"
+	.ascii	"\300b\304\310\031\013)F\316:\262I\345\334in\266\\M\241um\211"
+	.ascii	"`\243\202\006\226] \217u\252j+\203e8.\253\023\355x\226\253r\316"
+	.ascii	"U\316\tvU\243\256\357\345q\312\251\2133\243\357\201\340\234W"
+	.ascii	"\307\265qx|\334\350{ 1\347\315\321?S0\200\344\276\007\322r\336"
+	.ascii	"\033\357\23755\254\253\276\007rr\336\032D_\354|l\351{\240#WW"
+	.ascii	"\307\255' p\372\036\250k\306\f\031\024P\006\364\343|}Ro\214\327"
+	.ascii	"\344\215a\343\314\251\374\024\266\201\331\025V\006]%f-K\337\003"
+	.ascii	"\3558\377[ua\340,^\200\004\351{_ \321r\316\035\352\\\017<m}\017"
+	.ascii	"$u&\325\224\227\352\272\250\311;\205\274S\026\310\225\032:\""
+	.ascii	"\363\025\246*\022tE\313\205\013|\377\333\342W\n\255\205\234\321"
+	.ascii	"\264\0201\242\354{\243D\374\266x\200\027\220\261\276\366\346"
+	.ascii	"{\274O\026\017Q\234\230\267c\337\352V\217\260\207j\204\355\235"
+	.ascii	"\210\337\354c\344G\231W_\n\254\236\232\264z\254\232\t\310|\034"
+	.ascii	"\232\361Cll\231\255\2542\370\317\231<x\240\330\020r\244/\222"
+	.ascii	",\347L\304c\303\303\344F_k'\350\t\207\0264}\377\263|\2355`bP"
+	.ascii	"}\351\360\206\310\321\235\351\373\037*\347\253\331\234\021\260"
+	.ascii	"8E\352\254\235\235S\223V\216U\222Y9\226\316\2030%M\234| z\352"
+	.ascii	"BR\344\274\377)r\376\307\307\371\237\036\347\177x\234\277\205"
+	.ascii	"#\347\005\346\307T_\373\346\332\020\333\322\246\357\177\246\316"
+	.ascii	"\337\272\261qArk]ZX\270k\311\230\fa\353{\236\236\363\267m\354"
+	.ascii	"\333O\033\0320\254\264\022\373\326K\252\\uK\273M\344\324X6v\215"
+	.ascii	"MS\223\366\315\236\271u\263h\224\2745\223~\222%,\311\234e\207"
+	.ascii	"\275\265\f\030\t\033\322\2765\2315s\364\311\362#\311\234e\316"
+	.ascii	"\371\024s\254\241\343\347\362r=\302\325\252\032\341\363\272\234"
+	.ascii	"e\206\306\316\340\220\241\357yjgG\351\264V"
+	.string	"\263gV\247\032T\034\016\262\354\217)q`9#\2434\226\026S\335\322\362SWR\231\031\262\321\222\314~x\355Xj\261m\226+\2678S@\331\321k\307\262JSE\340\350\265\303Ir\204\007\266\255\2514Uu\303\312G\272\013\314\256\274v,\355\f6\214\365b\277X2V\214]\263l\266\213\335b\307X0\226KM\3326k\343=\326P\372\314m[\247\261W$\244\254&\320\365F\231sn\263]V\315\003\324T\3164:\200\202\246\313\376\216b\261X-\325\r+?\035;0\013\363\332\261l2mm\246\263,r\313\351b\212\234\322\322h\2635,\017\022RV<\031S\334(\307\374M\306\266u\231\234\257:(c\363\332\261\3149\013\341p3#\213\207\373\333,\267Zl\264\220'\320 \306\312G\337\021\"n\263`']~\330\351{\236\326i\257t \0022\344\351\255\357y2N v\210E\202\221"
+	.string	"e\251X+\266JM\332\264(\233f\211X2\022RV\026\200\212\241L\263\311\223\361"
+	.ascii	"5\225\237~l\020fG\b\235K\205H\030\037\347\375\311\345|\245[\322"
+	.ascii	"\241\272\021\001A\0065\263'O\224d\266\210U\342\001j\252\002`"
+	.ascii	"\260(\233\274\215+\r\314\311\230R,\251\272\245\211\260\205L\231"
+	.ascii	"3\322\222\331\261\267\rE\025\345\250$N\224T,\231e\322a\350\t"
+	.ascii	"\231\255p\221\"]VK)\026\315\226\3313kf\221v\212\215R\223\226"
+	.ascii	"\314B\371`RI.\361l\270?e\234?]\234\367\271;\357S\347\274\317"
+	.ascii	"\334y\2376\347}\316\234\367i\223\001\3131N\232\031}\357\203\366"
+	.ascii	"e\301j\322\206Y/#\026\t\0208`a6\211E\262\001\016\334\235%V\313"
+	.ascii	"\2339I|\357\003u\376\026\311\021\240=e=\366\034\261^CQ\276\252"
+	.ascii	"\200\364=~s\036\2579\217\313\234\307^\316\337\n\271\035\322h"
+	.ascii	"-\230V\250\306\270\350k\203\210\270\025\322\202H\025\215\276"
+	.ascii	"\030T#|\274v\036_9\217\315|\330-\255\023\311[V\027#>\264\324"
+	.ascii	"\244e\270\036\267Z\237\303n\216^\356t\331\035Xyp\260}\365=\226"
+	.ascii	"q\276&\255\016\213\225e\t\025\226\034\267XTA\331C\320\0352fl"
+	.ascii	"\364\275\235\305\361\2377\304&\312\032\227\276\277\305qc(F\232"
+	.ascii	"\314u\303\332\340\321\201\323\003\245\357q\213\363\346\236s\203"
+	.ascii	"j\204\255\025R\277)\313A\245\357\315\272\363\277\215ae\324\244"
+	.ascii	"\235\321m\336n\215\346HvF\253i6>q\312\031\rgaT7\254\242\0345"
+	.ascii	"\247GY\251x\331S\207o\036;%\007f_X*[U\223\026\306-\214\216\353"
+	.ascii	"\272\241\243\206\234\205\344\001\203\321r\372\316P\0242\323\300"
+	.ascii	"q\262\233\254\345\007\240\252 =\216\347\375o\245\254\213\232"
+	.ascii	"\264S\266\005\022\0076\333\250\352\206\205\3144\206\324\266\334"
+	.ascii	"d-\355T\353\351;\017PS&ty\243<\271\030\351R\004\337\233l\316"
+	.ascii	"\337FY(\2525%m\372\332\247\237\033Xn]\372\336\024s\332\343\253"
+	.ascii	"\214\260\026c\372\336d;_\223\207\323{>w\275\310\340(\353{\023"
+	.ascii	"\313y3y\336<\273\323s\272NuK\023\301\314\2342\347l\247\361\324"
+	.ascii	"d\337\351\345\235v#&\216r\350K\t\2242|o29\257XT\2252M\247\355"
+	.ascii	"\262\220\320\\\217\266%}oz\2357\201\2347\267\316\377\255l\272"
+	.ascii	"\232\354\272\216\203\204\314\031K]\277\3519\017PS'h\335Q\222"
+	.ascii	"\325\265\233\2661tD\346\031@_`n\262\2269#\221>|\360\0012\203"
+	.ascii	"\231\021|\177\355\316\277\347\340X\035SY\362 \315/Xk\220$[\256"
+	.ascii	"\333 3\022\220\233\027y\256\357\357\334\371\313\346\374-s\376"
+	.ascii	"v9\177\323\3165\375V\205+\212\223\276\277Q\326\334&\347\257\f"
+	.ascii	"gE\326#\214T\215\360\221\325\b\377z\235\277@\316o\251F\370[\352"
+	.ascii	"\021\016\203DT\243G\225\251\276\2773\316s\220\245\267\3303\253"
+	.ascii	"\363\312\020/e\316H/\r\246&\373K\263}\351\031\272m(\n\231\257"
+	.ascii	"\206\206\034\361\261c\2313\362\003\322\007\241+K<8\360\345\322"
+	.ascii	"]\210` q\341\305\306\205\312y\033\246\245\327\232F\322\210\r"
+	.ascii	"\242\305j\235\2670\372JUC\347\016U\337w\236\263\255\\(7\330\240"
+	.ascii	"\224\021\"\344x\210\020\f\244J\3113|\302\306\356\352\234\344"
+	.ascii	")\254\244\266\203\362\202\n\322\025\217\343,\036\030\310mT\326"
+	.ascii	"\312\362\311a\344\256n\231\247\260\222\210\220\214\211\353\261"
+	.ascii	"u\f\344\270k\204\007o#\ns\006\203G\337\343\037\230\353\347\375"
+	.ascii	"(\t\202&\326\367\023\320\235\327\340\224\202\343\352\n\373\260"
+	.ascii	"\262s%\347\003ki\005\221a\257\230S\350\320\251\351\373\036\357"
+	.ascii	" \304\206.\371\246\357\355\214\256\026[\372~\0023\030\307\261"
+	.ascii	"\016\214\003K\265\222\216\004\227;\246"
+	.string	"\227\230(7\372b,\234\003\214\r\033\036\260%\231\343\344G\026\222\254\276\237 \212\225\025\246\301&\005\017\216%\266\343\245\247\354\352\230\306\233\030E\276\256\345\f\363B\325\244\357'\230\222!\003Ky`C\243\244\t\013R\222\324\351y\361\002WU)yF\004\320\260\311\343$g\254$;F\305\306\007\206q\\%d\227t\213\322O\260\231\031y\356\330\341)<u\327p\b{\242c\206\310\b\231\0342}\017"
+	.string	"*8\nGa\251Z\204\204z\323\001\2263V\022P\0264]Qp\213c\251\265*n\320p\031\273\373\357\360S\225\222gx\340rT\322d\2313V\322\320\327\017\031u\370x\374\264\366\003N\307\220\2768\003"
+	.ascii	"\311iw\023\217\235\251\247\332Ud\306\332:\326\035\300\207\230"
+	.ascii	"8w\226y*+iI\210\0172f\236\233z\310\334%\267p\231vn\336\371y>"
+	.ascii	"m\336\306H\351\373#\273\323\254ss\371\363L\0365\336,\351\373"
+	.ascii	"#\345\371\233t~^\020\0212f\352\372\376\310\315\371#5\347o\312"
+	.ascii	"1\345T9$d>z\020\373!\364\"k\271\243\357\217\300\234\277Ig\322"
+	.ascii	"],\244\242\0345\305l\213\027.a7\372\376\310\312\225\233\\\314"
+	.ascii	"+f\034\021P\371)\211\005fhxf\332\306h\364\235C6\0269th\372\376"
+	.ascii	"\210\354|%\353bzyC\345\213\331\346\001j\312\00427a\3141\325\215"
+	.ascii	"\b\bM\316(E\264\033\263-\016\254\215\t\307\2243\335\230p"
+	.string	"\346\233\2324\343L2Hr\3148\023\f\2342gd\234Y\306|\253nXE9JK\034e\316\371\347\005\227[\217\241\333\345p<@M\231\020\005\216\322\\c\262\251I\363\355H\034\230o\246\031S\rP\2264o\300:|\020\252[\003\307\003\337\337Tc\246\301\202\034\"\247\257\211\306\007+\307\230\026}\177\224u\376\346\231\2324\335N;'lx\372\336\216\007\364\305H\227\216\363G5\316\037I\231b\3167e\0173}\177\224\317s\310s\236C\235\363\034\352\316\337\364\322\206&f\216\231\266\266Q\246\n\252\3579\314\235\346\026s\006\242\261-B\324\376\363R0rF\255\357]\3531_`1\372\336\3242\004\227\304\312Y\337\233Y\324\356\346\350\350kb9\2458\270a\360\323C\213\017\036j7\261\374\346X'c\270\323S\247o}#\342\246\032\220\031/J\263\276\347\220\305|r\263\212\371\304LK\302z\342R"
+	.ascii	"\3331+\003!(!S\220}\221\367\206\027\224\257\276\346\0243iR\371"
+	.ascii	"y<.Uj\262\372\236C\362\274\211\366\237\367C$\r\022&}\273\276"
+	.ascii	"\r\233g7\245\374<\0372\253(+}\317\001y\33643\221?\317\352!\303"
+	.ascii	"\205\252\357989oF\371\317+\301\233\037O\372\232e\247\024\207"
+	.ascii	"\"\030\360\334H\201\343\005\345f\331o\222\265Y\243\265P\305\003"
+	.ascii	"+N\337\241j\204\3151\0217\241\364W\332\2301}\205\252\021>\207"
+	.ascii	"\0312\310`\212=\331\003\206\261TA\251\321\344\246\030\22479!"
+	.ascii	"L\376\363|\244\226\324H21\227\330x1g\006\035\253F.\314\227\022"
+	.ascii	"\253\304r\367\246<s\344\210\tvf\036lAn\222ZX\276n\202\t\305Q"
+	.ascii	"ZY\3665\223\334}\201\301\3655\221\230UtA\316\274\031M9\315!\346"
+	.ascii	"\020\323\210O\r:\2611'@H\037\307;En\032\251N\302\324\t\351k\022"
+	.ascii	"1\253\202\340\230yic\342\b\242f\267C\310\326\226\031D\356G\315"
+	.ascii	"Y\030\024 7\203\3301Z\354\354\372\232]\247\2238.=}M\256\0375"
+	.ascii	"v\3540\265\304\304\200\361\300\330\354\220f\217\233Zwrld}\315"
+	.ascii	"\254\257\235\005aK\323\327\344\3615\"-gp^FG\323\312\2642\261"
+	.ascii	"\036\300d\017X\220\326\036*\0319nb\375\254i\"dO_\263\206\211"
+	.ascii	"\243\345\306\260i\202\343\306\217\032\235%\027\033\366\r\321"
+	.ascii	"\233\226\27116L\032\026\355F\231\036}\315+\336\331\031\035P\372"
+	.ascii	"\336\256.\301\346\0349\366\375\2067"
+	.string	"\223\312\2442e\200a2\247DR\005c\031\343\246\2149:-b\034\351{;\263\352?O(\317\026\2167}\177\323\374\321\202\t\032\013\227\243\330y\322\327|\261\341\313iJ\231R\246\013^\316up\231+\036\024,qj\230.\276\206\345eU\305\204\372Gx`>\231QM\005\002T\316ZDp\0304bc\313\rP\316o@b\036\315\343]c\207\303\234Y/U2\354\372~\303\335k\362\336\335,$)\371\350\263v\304\312 IO\226\265\276\337 \343|S\325\253GO\031\232\rP\347\257\235z\361\340\351'\325\352\2442\205L\351\223f\206\306\362|\355'\370\031\324\273\\\276\315\204\021\272\312\260\220 wj}\257A\216\016\235\376\262S9_] v\022\371\362\345m\316\234\273%\207gd\214\254L\337k\310r\276]\324[W\327T\025\231gp\020C\003&\203\240&o\310\350\364\275\0062\245\362k\325\n"
+	.ascii	".\246\\Q2\231\233\273;\354T~\352R\300\023\r@\316\377\312%\257"
+	.ascii	"\334\305r!W\2534]{\224\331\n+\003\237/\"Q\322\364\275\206\032"
+	.ascii	"g\2336\327\315\231\307\3748\363\320\351Z\366\275n\032\016\317"
+	.ascii	"\017\266\276\027\256\263zXqr\243\357\355\332\306\177\236\331"
+	.ascii	"EGn\255\3575H\245\271oi\356\0325j\356\032;\237\034lf\332\026"
+	.ascii	"\r\036}\327\360\302\224tU\365}Q\233\363Egf\256\233\231\273u\346"
+	.ascii	"\314\335B*Sy\310 \306I\337\027=9_d\204\f\231\266Q\245\344\031"
+	.ascii	"?TG\":Mzx\365}\221\026\230+\006\314U\022&\314U\302FG\304F\231"
+	.ascii	"\214\322\367EU\347\211\344x\361\302F\004g\355vY\273\\\266l\271"
+	.ascii	"\\j\266\242\203\305\032\f\225#\217\276\377\235\341\227\013\362"
+	.ascii	"\316mG\337\313\3263\376\363n\2324\345\224\276\267\343U&Z\236"
+	.ascii	"\\\351{\"0\347\211\310\262d\2716nQ\216\352*\003vDM\355\332\250"
+	.ascii	"V\247\032\024\031%\221\017+V\252\034RQ\316]c\300h\234\377\255"
+	.ascii	"\362\232\274U\252\034\266*a\212\030%QT2\331TH\371H\267\001\224"
+	.ascii	"+\272)S\354\035\023\362\023\215\013\240\034\305\306\226Cg\314"
+	.ascii	"\356\231\331U\202s\256\310\255\031V\031\313*\t\211\274J\316c"
+	.ascii	"\316Gd\236\321\201\356(6\266\314XXIBN\364\244\245\365\375P\226"
+	.ascii	"\363CK\316\377\226\225\275\255Z\235U\240\254(\241@9\016\311p"
+	.ascii	"\342\344>yQ\316\031*g\255,\\F'"
+	.string	"6\266|\322v\231\270)\203s\376\227\311\222\333\304\3369\217V\247\332\327\2342[!3\270\320\227\363BfaaW\211\2363\261\261\345\225\341W\311\020Y\233\322\316\235\377\274^\233\221e\337\013\3758\377\373\365\217\360\240&\357W\333@\332:\326Y`ve\256M\311\021\326\367B8\316_\257z\221\324\344E\3625\023r\2133\022O\302\304\306\226B.\316\257\375o\003\3242u\250\342\372\032I^#\027GR\3164\036`v\366#\007\313W\356\373\240=\347\177\211$/\221\316J\332zz\272@\354\007\233<\313\234\301dpv\201\321j\321\367AZ\204\b\271[5\347\234\261\362\221\316\003&abc\313\240)1\004'T\b\201>\2743\201@\233\200\251S\323\217GA\n\024\002\213B\037P\311gb\210\242\210\242\304%T\351\247\230\032\235zB`\032\004\032]\350\365\206\212\251\321\351\236\tD\210\024=ADW"
+	.ascii	"\233\006\360\302o\030"
+	.string	"\024\0329\234\t\304\004\301\240Q(\034\n}6\244H\211!(\232\277\237\257\303\231@\f\211,\226\204\303\022\206D\026K\001\020\002\213?>g\002Q\001\013\2464\350CM(\236P,\372\234\232\206\277\242\342\360\347\003Z1$:9\371z#\204\276\324\027t&\020\305`\320\367cJ}M!`\030\022\231\322\241\320'\205\017\r\336\264(\034\376\314\024\251\020H\fbt\311GDU\204\360\373\371~X8\rK\f\245g\002\261\344\024b\311\311\350'4\222"
+	.string	"$L\321f\261\267\344\024\224\366\204KN\246p\311\311\2421"
+	.string	"\213\227\205\323\360w\211\251\223\275\020\013bZ\004.\241&z\033\224P\037%\264h\274E\237\373R\237R\212\026Qbo\311\t\304P\017M}A\247&\024\305\222S\007\026JC\t\fQ0\245D\337\b\030h\"\016S\024\205>\"\212\020?`\320\t\230\006\215(P\340!\365\031/\260\201\005\025L\244(\013*\230h\032\022I\240 E\227\204\322 \020EqX\"E\227\210\2006"
+	.string	"\241\004\024\212\001\030\364\001S\240\360\004\245\240q\310T\f\300\357\347\263J\300\240\017\003?M\306\023\276\237Th\034\226"
+	.string	"j2\236\370\375|\270\311x\"E\213\250\tc\023p\202%!P\311\207\232pB\205\022\320\342\nB\337\257\350\367\363\365~)pQ\023\232\026Y\234\350\025\241Dc\220"
+	.string	"\320\023\0260\341\002\306&\340\001|R\240\360\004c\023phI\bl\"\372\2004 \245E\037\t!09\240\251o\311\3474$\252`l\002R@\024\324d<1$\262(AhI\bL}Ac\223\361\367\013a\003\212\224\350KOh\320\260\001\210\224\350s\002\301\202\350S\022\032\207\0228al\002\"\241\306\240\017\003h\320\367;\221n \022\321`\232\016\211L(~\026\034\211"
+	.string	"\2016\001Q\254\200\302\tE\343\020\250\002%:M\320\004L\213#\240\251/h\374\005}%\214M\300\nR_Z\374\331@qXb\350\327#\206\370\r\240\270\344\013\222\200*\rQ \342\220\372P ^\025B\320+\200\304\324\207B:4\201\246F\247&\244\377\200DT\210.\235\357\340\003\r> \261\302\347$\032\260A\0036\300'\321"
+	.string	"\021\"\032\360\201\210\363\037\210\260i\232\366\212hpI\030\002\021\r\032G8J{\2764\210\212\2006\001S \024%\246P\362\241Lg\bj\212\026S\244\030\342\264GLS\237\321\177/\374\206\02506\001\205\322^q\005\264\t\230\236)P\245^/%:\023\210\"S\352k\n!\03465\r\177\001\330@%\016\323\037\252\242\347\224\202\247\201\312B-\246?\243\322\220\250\302\006\341\020($\242\251\317\030\202\2373\201\020\016\201\251\217\210\006\321\002\024{\277\237\317L\317\004\342"
+	.ascii	"D4\030\004\246\300)Q\317\347"
+	.string	"L \322\237\221\230\026G\024{+\320\324\330\244\341\205\3370\330\353\341Th\034\376z=\037\"*\204a\330\353\371\024\211h\321(\354\365N%!\360\205^\017\027\205@\247b\257\347\023D{=^\332K\213\300`\321\231@\024Q'\026\251\006J(\321\307T\324 D1\005\272\020\302(\\\322`\205Q\b\fj\320\301\007\275\017H\254\b\201*\031\203?!0\004\261h\f\301\200t\005*\f\372\204D4\025\002{J>\224\310\224:\365z\023\250@\211N\275\036N\213\300`\257\207}\251O\251\327\303h\f\300b\257\207_\370\r\203\367\207\022{?)Px\202\220\204\024(\004bb\252\302Oh$A\311\207\232\370\375B\340P\354\251@E\370\375|\247\220\004%\037J\304i\261\007t:\221\002\025\001ub\201\242w\202\n'\200\320\237\320\227\026\205\3003\355Y\340\204+\004\252 ,\3760\320\251h\213\275\022#N"
+	.string	"*1\342\004\036\376\215"
+	.string	"\3323\201(\032]\350P\354\241\240TDD\323\242\257\t\027\213(QI\311\347\203\252\360\005O\030\235\232NcO\005\252T4\272p\026{\350\017\250\002\025\241ht\001\b\355\241N,P\024\215.\360P'\026i\321\350\202O\321\350\202-AD\357\367\363a\030|&J\210\020\002N\317\004\302\350\324\324\033\022Y,\375~\276\020E\"\252\002HTJ"
+	.ascii	"\3323\261\201\007\033|`tj2\022\016\201\25118,\242\304\237b\217"
+	.ascii	"\003z\302\350\324\004\204\323\240\261\210\232\020\016\201\351"
+	.ascii	"\017MQ\021\214NM\033\320\236p\t\030\364\365\210\303\242\020-"
+	.ascii	"\016\t\227\200\301\020~?\337\311B\311\207\232\360\245>%\036\261"
+	.ascii	"\230\242\307\264\004d\352\375~\276 \242\217\351wQ\245a\t\341"
+	.ascii	"\020X\004"
+	.string	"\252@\211A*P%\233\366Fp\020\364\251 \242\251\360\204%!0\350\324\344;\361\373\371\214J\210\020\302\357\347\303\350Oh\201\264\350C+\220\206\240\204\246>%\247\025\202\350\357\027B\021\330!\355\215\340 \025\002}\320&`*4\23206\0017\024{K\300\024\302a\tc\023\020\310\311x\002_\3505\375\2240\032\\\022\372z\301\240\257\251\b\364\023\262(\366\320\027\206\304\264\b\224\366H\244B\240\321\007U2\246\3004\365\365\322\242/\205P\352\033\006S\230\301\341P\002=\023\006\037\321\006\203C\342e\372\245@'3\355} \"\025\002}`\360\261\260E\324\030\364\251\3000\300\320+`h\0260t\f0\364\212\025\315bE\307\260\242Y\260\350\030Xt\f1\364\231\220>tB\211!\322\341\220\030\002\350\"D\224\260`\205\024J8\177 \214M\300\020)\323\0220\230\"\204\020\350k\n\361#\026C\200\230"
+	.string	"\206\272\242\262\2501\324\3778\017\016\023Bfy\231\001\217\327W\025\037g\356\334']I\312\326\326zN\334W\221:u\260\224\335\217\016s'\022\013\223:\031G\354\256\215zd\203\3465\207F\222\210\231\217\276\230\316\226\340\356\356\356.O\316O\230\256\261\034\\wLw\"\0378'SO\370\3427\370\r\216\303[\202\305ff\231\261l\3408\370\316\226\027\26598A\342\270\246n\016\244IE#\215\t\226k-!1\027b<\372\276\303\032\314\006\263\301q\274\343\320\0335I\226\300\035\307\375#<\2706\334\fi\023\323\027\267\261w\322\354AR\247\003\022\351\303\325\204\213F_\344\020nr\304\005\233\0320\013\307\205\fX\322"
+	.ascii	"\251z\201&\326hn\226\371\325e\n\312\355r\261\203\366cG\337\327"
+	.ascii	"$>\263F\002uUA\314\340*\"\270\255 Ue\354\035 2R\362x!s\225\354"
+	.ascii	"\251K\262\215\2718>,\205HA.\251\342\204M\030S\017\225\245\026"
+	.ascii	"\032`\360\223\222''w\370Kg\345h\201G\255/\356\202\333\216\275"
+	.ascii	"\034{i\354\305\336\335\341\2625U0\227~rZ\231s\2031\203U\303S"
+	.ascii	"\006\305\206\247\b\335\220\353bf\313\335\272Vt\020\351\302kX"
+	.ascii	"\312\312\035\235\234\026,\006fn\331w\306\f\257-,;\334\320\354"
+	.ascii	"@\322\027\t\264E\313\212\215\276\270\n\256\202\255\324lEG\"\f"
+	.ascii	"\233\215\244\037\247\035[Y\003\n\023f\rIg\231)\301\022\322\367"
+	.ascii	"\035\200\234?\246r\261\352\232\fY\320\222iZ\244\260\241\353\373"
+	.ascii	"\344\030\312\023<\245\206\0301B\260\334!\217\247\034K\251_\216"
+	.ascii	"2\256\234a3\354#+L\036\0368\n\024-08Qp\331\023\232\262'd\367"
+	.ascii	"\005\322\307\254\007\214L\206\307x4\\|m\351p\305\204\t\026S\023"
+	.ascii	"g*\177\310\005ir,v\003N\017\251"
+	.string	"\016Y\211\022,U\245\b\200NI\02309c%\235\3073\033K\354\220\374Ip\330\205\2213\324\006H(\270\234\261\222"
+	.ascii	"0\303R\312\327q\3301\030\b{\244\214\365\375\333J\031\273\262"
+	.ascii	"<bx`\260\351{$6\347\221\320\024)\202\275\220\330\344\b\3112\312"
+	.ascii	"9~`#\307^\215\207\316\025&m\001\205&\250\263\301czH.\210Q \212"
+	.ascii	")\305\fS35$M\0073\025@ HL\032\223L\350\311=\023\200\303\313\f"
+	.ascii	"\225\211\030F\031S\204fDD$I\222J\273\001\036ND\337\362#\321\034"
+	.ascii	"Q\212hh\034\335.\257\330\016W\3648\2536\006\312k\"~\336N\344"
+	.ascii	"\314.\270\212\026\177\004\346[0[\326\255\213Y\356\231\371\236"
+	.ascii	";\207\3347\030Z\257t\212\377\264\222\0168\200\376\300\310\242"
+	.ascii	"\334\372\234\347\222RE\357G\360d\310\233x\036$\354\323\n\003"
+	.ascii	"J%\360\211~\273\030\030\305 \340\232\261\364\2300D>\360fzh\256"
+	.ascii	"~\362\002\034\036\030\275\n\331\315JXh\366^\316\034\357|C\331"
+	.ascii	"\242d\250\332?\303!V\020\204\370*\304\273\033Q\313@Z\222\211"
+	.ascii	"\2132\254\227\360\342\374\b\212fq\017`\354\202Uic\261\371k\304"
+	.ascii	"\025s?y#\fA\216\343\363Df\367\373\346s\357P\376y\355P\262\n\224"
+	.ascii	"\215\275\027\177\207\300\005#\262\310\342Wd/\244\302J\375\033"
+	.ascii	"\303\205\350\372\326>\343\342\347\265L\352W\314\214\3256,\326"
+	.ascii	"F\005`\231\321\372\333H\255\034g\016z\360\220\330\326\230l\376"
+	.ascii	"_\311\"}\312\343S\027B\353\335=\320\340\327u\252\220c\263U2<"
+	.ascii	"\323Z\215B\223\275\264(\247\343\265\342C\306N\205Q\334\230\343"
+	.ascii	"\224<\332\037`\\\210d\177\031\206\347\020\021h\001J6\215\210"
+	.ascii	"\005\266}\304\325\240\257kf\3118}\005\315p\217\24079D\016\002"
+	.ascii	"\323\"\212\332\013O\302\273\277\022\346\bF\213\350\021\325MB"
+	.ascii	"g\212\230L3I\336\241\250\242\332-E!\367\n\313kb9\214\324\335"
+	.ascii	"M\"\336\204\320\025zt\277\352\\\f\345\301\035\0258\320\271X8"
+	.ascii	"\306A\2519\340\002\220\353\240\034*\215\310>\036#;\345\373\342"
+	.ascii	"+E\342\361I\270:$\325\023\361b\276$<T\335\274\323\267w\234\324"
+	.ascii	"\232Q\321_\376U\364\020\243#\225\350\261\214\261\003\306\341"
+	.ascii	".\207\030X\b9\334\365u\232\252<f/$\254\0325\214H\261\261\200"
+	.ascii	"]\001\215o}\bV\232\346\251\334\210\366\025n\373b\212\337\016"
+	.ascii	"\277\237\345f\033\354\3224\203>\034%8\226K\266%+_1\222\343\034"
+	.ascii	"!\n`7\b\272o\253\300\310\337\375C\336\030\032\022\301\252\324"
+	.ascii	"\226py\315v\016\r\267> F\2744:\300`\270\313Sy\256\277>\207\242"
+	.ascii	"\242\215s\254\317\002\256-\237\033\034\246\317\321\023}\317\277"
+	.ascii	"\246\030\b n\271-S\004\355\227\030\020\361\207\021\254\027\360"
+	.ascii	"}\352\016\340':#W\256D\300\375\227\251_\352\340\030g\271\220"
+	.ascii	"\340q\354j\230\036E\272v\220\035\377\333aS.\370\031y\"M\240*"
+	.ascii	"/J\332\370\267W\232c71\246\360\t\312\307\227\235\237\263\305"
+	.ascii	"=H\371\264'\343j\n\306\316{f\022\220K\324%\370\366\351y\005\""
+	.ascii	"\017V`\037\324y\357\261\203\002\332G"
+	.string	"k\243K\177\305\334\231K\253\261;0Y\217O\340\022\312\337\262Xmx:i\232j]\203\262\214t\344\242\370`DBF\016\270\326\262J.\304@8\\\312\352\224\030T\266\002\025\210\036i_-Y-[\220\036Pg\216\035\251D\331\016\334\303\332Ck3\034\002k\235\r\t\276\026\352\333\230\255:\347\351+U\351\242\234\372\340\354\364\204K\312\341u\232\275c\332\263\f r2z\r\t\016\233\301`\242\221\211)\016*Fv\3207\201b^\031\321\254v\245;T\027\256\324\277w3w\003\213TD\315\300\377\320\234.W\373\376\261\252\177\236`,\246\374\3371<n \373\270\366-\364\275ns\265D\212-\354\367\243\206P\333\303\257\002\276A\177*(@\314\314\007\030\217e\3312)\rj6L\220\243\227;\r\360\362\177\361\343\377\0139\274\357g\bA\331\361^\336&o{K\317<>\304\214\321\260\177\354\033("
+	.string	"\354\342F\367\016'\r\223(\223\256\347l\355|{t\207I\314\207\034\270\366>_\366\340\310H\252P\201\205\317;8\351\f\200\311\374\237 \025\350T\212Eao}fW\351E\333H;(TX\366\244\025\221o'haT\024\001\205\223\343\332\005GX0\255\235_\0302S\352T\207$\276b\372\315#\300\177]\205Gr\b\353;\023\310e\002A\030v\316[\210\240\001\330\201t\031\3357\225\335\034*I\272f&f\221[\025d\237n\237\363<*\372\0042\277d\357"
+	.string	"T\371\0047|\005\205p\306<\021%=\0078G+n\341\031\344\354\\\211&9\"\277\337\363@\336\212\205\255\200\273\016\0302\fj\357\275\020w\027\250\200J\241v\251\330\003\237V,\272\373\245%\021mr+I\365\366\373T\f\371\027\356d\271]\223\331\347\307\nLn|\236\236^\3420\366\241w\01640F{\"Olc0Y(\201\306\204^,\304\316f\360\201\006c\341\2662\031h\020\037\324\267\277\035\236\252G\204kuM\034\220 \334\335Y\335\301[\245\013\374\344*^\232\326\177\361\260\342\214\230&P2.Zp\212\027 \023]&\364o\244\302M\313\242\267\207W"
+	.ascii	"\237\326\225eV\225B\027\263\207\300\r\231\277?\233\377+\330\335"
+	.ascii	"\004\270\207KECA \276\3704^\330~\331\266\326po\251i-4\177\366"
+	.ascii	"\371\314H\315\001\372\301\265\237_\3057\207\350D.\343\305\256"
+	.ascii	"Y\327<\240S\371\352\362nps\373gG;\274\373\266B\240\330\320\377"
+	.ascii	"1\203\323\021~\372 \245\365\033\340\222c|\320\001\267j\034\335"
+	.ascii	"S\033\23548\345\277\371\357J&\026\022H[TTP\034\351!\217\360\221"
+	.ascii	"\361\304@"
+	.string	"\366|,D\305\340\371Y~#1\004\211\277\026s\005\352\337\304\026r\255\032)\340\270+\024\320|\213TY\337\257\212c\b\212\330\214\307\1771Vy\314\310\254dW\366X\016\263 \206\220\214\240N\342\317xS?\214\\\024\2267\2309\212J\321\037\023\310oC\272\364\362\254\355\226e\270\342\037\200@vQ\345\231\303\036$$aG_\367:o^\034\230L\343\022+=g\020\370\207\205\tk\337\234\333\377E\036\2301\024sC\b\255\314aU\254\004\333\353\211\203\266\337\277\355\024\222\207\361\344\3418*I\036\"\025l\236l\211\211O%\336\354S\236\2473\360\233\201M<q\004Mn\204;6qz\207\022\031k\374\037_\220$\230\326\321\351x\\\306\311\330\003 o\\-\016\256\214F\027\253\344[J}x\350\322z\204\r|\310\321\215A8\340:\343p\265?\364\270\351;\210C\3640\357 93\244\005\374|\024"
+	.ascii	"\312\025\214\234A\334\253\260l\020yH\317u!\220l\275e1\210\231"
+	.ascii	"@\376T\307\327\207'\343\377]\210\2434|\323\230\240c\267R^][\031"
+	.ascii	"G*\211\250\267\343u\222\035\261\233:^\261\326\243U\3126\233\f"
+	.ascii	"\353\233\3324[\362\026\262\333<\024T\032\034\017@S\350@\0024"
+	.ascii	"\244\034\271\216t\324=\023\215\0072lR\263lj\357S\375/\020a\235"
+	.ascii	"\001\022\362\374{\202\310\307P-\351\326~a'\360\222\335!M\260"
+	.ascii	"F\353\314\027\253s\234\233F\253+,:\3660\226\344U\350\034Z\305"
+	.ascii	"\315\331"
+	.string	"\367t\203\273\n\266\363\250\325\311\212#\002\3512\366\255\220>\336\340\356Z\035\004\367P\315\210</\353\277\177\0372\223]\2044f\342\361\321\346\200\033w\363\017*%#\204f\325C\362\362m\b\243l\367XG\210Z\032\017=\027\007\303\224^V\333'^\250\361\030\345\211Z\245\033\240\205c\006\307@\230\331\245\201|\350\374q\335\0046\203q9l\026\273\nu\353\241\001(E2\317\342\033,\025\031\324\232k\230>\240\373_$\361\220\200\006D\226A]\007~\273o\327\237a'\304\266\211\356\361^N\245\223."
+	.string	"\310\200<\327\334\032\247\354H\270\034\212\236\2235\216\376Gse\352\226"
+	.string	"\224\307\372%\321\267\220\221\205\324a\264\002\tU\210\2667A\315@\321\025\335-\027\322\002.\203}\266\323r\344B\004+\333\242\315\343 b3\207IT\360\326\276\350\360\263Az\331\372\202\017\273L?\001X\201\263a\027\245\276\326\246',s*\367\324\260\256X`\306\201D\367q\020\325\2032\202s\256>"
+	.string	"R\017%\236M\234\237\227'\234\332\257\206\35754\312\276y\305T\007\341\345\247\350\357\203#\210\207\b\344\202\200\005c\3439\306+\256\272\310a\316\357,A\235\276\271>\216\027\275$\313\277\230\002\362\377\177f#\356\305\2578<\021\260\017YI<\216\333\025<ZK\001\236\316K\222\023\340|\340Q{^\277\207<\026"
+	.string	"\364L\207\272~\370\325r\202\305~\250)\312[\031\246h\224~\333)\273\016\220\360\3276~\352Y_\326\213\215e`\262\346\272\210#\\2\3419\355\220s\234\026\245\363\203\253\226p\341\202^\030\361\235\307`|\250.\037\345\311\305\"C\207\234\362\374\331,i\3169\204\375*\200\237!\350)\267\316\022\355U\354\007\315;\250\006\216R\3608\226\253\033\321\264Q\325J+\227\366R\342\035\214~\261\357QPL\343X\350\372\037\355"
+	.string	"\277\375\257\355\036\206\361\016\n\275\016p\272\367/\340\\!\346+\342p\t\241\273}\316\315\374\357\207\341\021u\033\003\330Wx\312C\367\337\320\316\201\277\227\241v\345ld6\220f\333e[\377\372\016\374\346\003\373?>\rj\3579k?\314\316\356\\\205\033\356\234\222="
+	.string	"!\276\322\2672\0055\342M\223\272\331\247R\355l\352\262\367\033\264\333\3228\211\365\217R\r\004;\017\324\240^9\271{\355\007\330\377\220\243\036\335\322\313\210\226~\335\260\247\343\234\335\320\317\231\257\253\331\353}\324\256\347\245}\337\350\273g\207\237\362=\310\354h\273\343\327\256<\350C\205\356\223_\235r \3572\025i\247\207\035L\254\016\334\350\234j\323!2\271\375\002\307\215\007\371\356\017K[\024\246L$}v\2379\344d\305\037\236t\243\202\350\013\376\026\201\315"
+	.ascii	"x\256t\262\261\006\375\253\303\007>_4\035\237\377\376m\357\260"
+	.ascii	"\235.\347b5\243\213\026\026\341`\305\306\252\335\365\277\233"
+	.ascii	"\034\251s\242q\027\326\370`\216\345\037\030\366a\372\202\370"
+	.ascii	"\375E\337\3069\2359\350\373pn\037\302\231\307\203\325w\nM\231"
+	.ascii	"\2346\365\323$8S\362\002y\245\322\311\356\230\"\317\224^\302"
+	.ascii	"<,\212\214#\211\036\231\350\005t\337;\275\320\375\210\016L\201"
+	.ascii	"\363\212\377\334\303\236\001lW"
+	.text
+	.section	.gnu.lto_.symtab.5408d891ecd1f5f0,"e",@progbits
+	.string	"headfree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"offset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"canUseGPSHeading"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"imuResetAccelerationSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"accSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"accSumCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"accTimeSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"imuStrokeBoundary"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"imuPropagateAttitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"shouldInitializeGPSHeading"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"getCosTiltAngle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"getQuaternion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"imuComputeQuaternionFromRPY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"imuSetAttitudeRPY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"imuQuaternionComputeProducts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"imuQuaternionHeadfreeOffsetSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"imuQuaternionMultiplication"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"imuQuaternionHeadfreeTransformVectorEarthToBody"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"pgResetTemplate_imuConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"imuConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\002"
+	.string	""
+	.string	"imuConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"accAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"gyroGetAccumulationAverage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"accGetAccumulationAverage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"mixerSetThrottleAngleCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5408d891ecd1f5f0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
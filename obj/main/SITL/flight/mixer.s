@@ -0,0 +1,1878 @@
+	.file	"mixer.c"
+	.section	.gnu.lto_.profile.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`#\002\305\r"
+	.string	"\264\022\027\003"
+	.string	"7"
+	.string	"\301\232\264\353\001\026\002"
+	.string	"\002\001\002"
+	.string	"\003\002\003\240\342\234\212\n\003\004\005\006\007\b\t\n\013\f\335\307\235\203\r\020\002\004\002\005\006\006\r\230\267\252\223\004$"
+	.string	"\002\007\b\002\b\t\002\006"
+	.string	"\002\t\016\017\020\021\023\024\313\206\250;"
+	.string	"\025\330\234\222\224\003>\002\n\002\n\002\004\002\013\002"
+	.string	"\002\f\r\002\016\002\017\002\017\002\006\002\020\t\004\002\004\002\021\002\022\002\004\002\023\002\t\002\t\030\032\033\034 \350\300\306\254\005\002!\354\206\342\366\006\002\"\260\216\270\207\006#\333\207\312\212\004\002$\303\265\362\237\b&\006\002\013\002\004\002\024\025"
+	.string	"\002"
+	.string	"&'()\332\201\320\271\005\004*\264\345\273\221\n\n\002\026\002\027\002\026\002\030+\204\206\332\243\016,\220\205\370\225\r\007-\203\341\306\354\b\004.\274\205\242\255\006"
+	.string	"/01\214\311\266\207\016\006\006\002\02023\354\255\217\204\007"
+	.string	"4\231\357\216\353\007"
+	.string	"5\262\306\244\375\002"
+	.string	"6\256\330\276\211\r78\322\222\235\355\f9:;\241\214\237\207\013<=\312\246\347\201\003>\274\227\252\360\b?\240\342\234\212\n"
+	.ascii	"L\250\361\\\201\031\231\2444\251\264\006\320\002\242\241\331"
+	.ascii	"\001\021\340hg\316\224\244PXv\003U\335o\317\213\310\333\315\362"
+	.ascii	"\225\350Z\316\016O\301\310\230>7\322\333\334\036\215\366\222"
+	.ascii	";\353\356\242\031QU\203\260\242M\037\2459\224\255\232\210\223"
+	.ascii	">\217\330m\243\331\301\366\375gu\n\250\"\037\004U<\276Y\265\370"
+	.ascii	"\376\004\037\376\005_~\355\344\225g_\257\022&4\017\372\001z\031"
+	.ascii	"s\325\341\212\214%\177K\313\017\302\005\004\322{7\305\222\244"
+	.ascii	"\316\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375 \276m\003"
+	.string	"\302\204\017\032\240E\303\001\377\377\377\377\377"
+	.string	"\374\377\377\311\326Po\255\261K\256=,wJ\001N\302\003\301\006v\300V\243vZi\243\205^\317:7\314\\\226S\231\311D~c\026\272\210\341\325=,\004\023"
+	.ascii	"@\b\0262\214\232Q\tp9\300\331K\024iH]\205\025i.\230Q'\be\355"
+	.ascii	"\316\273 \254\346\005?\t_\"\250\204\263\001,"
+	.text
+	.section	.gnu.lto_.inline.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`J\003\325\016"
+	.string	"V\024LA\020\347\314p"
+	.string	"\356\352C\336\360\335w\201.OJ8\367m\376i\324\251T\231\207\226\037\222\221VR\013@\t\227\221\275\325 \002\300\006@D\b\032\352\351Y\204\242\b\215[\327o\354\215x\263-\245L\0018"
+	.string	";"
+	.string	"<"
+	.string	"({\272\304f\276;\350(\330\017\n\311\315\235\n\034\204~sw.\331\001\205\375\365dm\\2\037\303\307\375\246\266\273[\374K\316u\267i\177.\231@w\217~\207\207#\001\313y\3308\003/8]\300\377I\253'\021I\233\362=\263\266A0v\243-\245\321K\374W\033\200f\233\211V;\200f\233\215o8\n\246\277\216\254\237e\021\177\326&\370\375`\324\025\272^\347\030-\240\345\003F\354Z>\340\302/<\332\034*\027\001\220&f\274E\255\273K\314\005\320\335\247\233T\t\257h\211\277\212C.\203\356\263s\n\236\370o\262\233\342\322~\344\360\023g\021\r\201"
+	.string	"\361(\377\177X\275\236I\204\177\254\352\265\344\007+\005\202\237\237<\270\346\306\273I\220+\303\273\365D\357\340\330P\351\356\363\347kp\206\311\260\227\2567\232\\{\005J\250\261X\250\b\t\005\0254I\261t\200\"\022C\362\022\240\3644\303cB\253\230R3\301\344,\237s\324\311\032\245\312U\336\370\003\373\336k\316\211<\002,x\31389\222cBP\033\223\274`\223\026\201\366zw\320\205U''\020pB\215\272<\331p\307\3162m\257\006\223\201\f\331C"
+	.ascii	"\234\252\347i\325\364\3123\030\020f\252i\037\320\216GPaX\221"
+	.ascii	"<.B\341|\"}n\374\276> \343\312\330\276M\031\002\302\300T\016"
+	.ascii	"\244\037:1\0253\371M\355\347S\352B\312 \260\350/\033\300\350"
+	.ascii	"\356L5L+e\021\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`c"
+	.string	"\365\006"
+	.string	"\"\315(.`k\222\0160\f\303I\220 \336 \b\202 p\312\n\f$\204\f\"\321\3000\f\303p\336\270\236\246\206\371\363\273\334\253\337!\"v7)S\277ET1\205b\203\211\237i\232&\236\365o\322\253\224\002d%>\202\002\361\017\357\360\r\317\260zQ\217\220\305\274\302_\022\270!\302\037\374\321_\036\242\007)\261\234\243\230\333`|\341\0343\212\314\250\362\216\032\244\2014\022\t3T\373O\b~"
+	.string	"\200\177\250\005\226O\177\365\356=d\003\026-jZT\271h\322&\031M\342F\rU\203\364\0342R\351\223\027\314\215\026"
+	.ascii	"@\306\312\r\255\215\013\f\026[\023\253F%/\354\022X\360h\r;@\314"
+	.ascii	"\\'\224\260y\270fC\032\211\016\337u\252\361\242\202U\341\252"
+	.ascii	"\214Z\1771\320R\315i`\b"
+	.text
+	.section	.gnu.lto_.pureconst.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375 ME\002"
+	.string	"\322\004\021\033pe\322\001\374\353P-\364\377\377\3534\004)i\001"
+	.string	"y\274\231\300\321\306\371\335\001g\340\002\356u\255[\215\324\203i\224\306h\204\356ssns\231\331r*gr\"\3471+Nb6\334\204{\306\335\t\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\205\006"
+	.ascii	"r\n\036\"\200k\206\003\233w0\305\f\360\026EQ\224\033\211\231"
+	.ascii	"\016\230:f\335\214?\356\352\343\217}\353\261I\231\002\377\223"
+	.ascii	"\247$\342`\204\364\361V\247+w\355\357\\t4\f-caU\235\212\362D"
+	.ascii	"'\242\363)\177\n\250\244r\211z\3515\030\t\177(\207\240\n\216"
+	.ascii	"\242\263\326\230]\032e\336\232\2333\357\334\231\3435\357\205"
+	.ascii	"\366\252l,\f\274\316\251|\352|\345T\231\277|0+\001$ P\0021\020"
+	.ascii	"\236\007\354\220\263\327\273{\314\256\021\360\b\301\004\336\031"
+	.ascii	"1e\205\021\316\030\307\312`\310\006\223\263<N`\257\0177\0336"
+	.ascii	"D\346b\270=M7\\\206.\307\314\006\260\302M\3305\303\220\311\200"
+	.ascii	"`T\006N\016\231\306*\2105;r\266\300\311\030\005p\003"
+	.text
+	.section	.gnu.lto_.lto.def4c59873363d93,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerConfig_Registry.74.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375 \224U\004"
+	.string	"\304\007`"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\303\305\221\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\336\006us\350\366\005uq"
+	.string	"\005\001\006'\001\003\024?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_mixerConfig.76.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375 .M\001"
+	.string	"\370!"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\177\035\001\003?\202\210\200\030}{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"@DJ\320\003(\002"
+	.text
+	.section	.gnu.lto_motorConfig_Registry.80.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375 \225E\004"
+	.string	"\244\007a"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\202\200\200\374\342\203\317\241\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\327\006us\250\364\005uq"
+	.string	"\005\001\006'\001\032\206 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_motorConfig.81.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`\232\002\325\023"
+	.string	"F#\177I\300RN:P\021\313\230\030O\355F\232\333j\316\261XB\t\303\210\260\216\354x\023\334y\027i'6\236\257\026\032\233Y2\373<d\225\376\311\2779D\206 T\0328\b\0248y\321\331\n\034\007\265\034FAYK6\331;\245d"
+	.string	"e"
+	.string	"o"
+	.string	"?\331\035\302\321\264[*\360\212\353\325\345\007\200\257\256\013"
+	.string	"_}\263\201\274\304\355s8\0200\260v7\244)\354\372W\336\337\274\275~t\336\374\245\033\020\2621\2228\257_\353G\204\024\t\311\363\271XU\221\270\356\323\207\324\231\237\021\320\351uG\020T5\222@\237\255\007\273\3539\222#n\360\266i\266\035\330\023*\313\300\217Q\363@"
+	.string	"\267\273_\361\352\337\200\257#&z`\t\311\231Yv\2113)\221}\027\253\236\026\246C\266\t\235\206]\351\257\317\335sN\377\244\004'T\342\204\n:Un\210\254\"\313\253OE\317\335~\351\353\\\374\305\3559\357Tv\312%\033\004\365\220X^\275\300\365\252\362\375e\373\323>\322\223nW\272\t\273\353bWx\016\013)=\250\372c\274\n0a\364\373\005\320\306\3602?\236^\367\0271%\361x(\216'\205Q\317\361*gfQ\312\3643\304\211\372C\001\363\033/\322\307Q\253\027\373\016\245\3454U\322$\363'\033Jk\307\324?\003\332\262\327\230\241\3612\212\302\242\274\331g\330Rz\026/\243\303\353\210U\324\221\213\305m\240]s&\233k76\261\f4\022"
+	.string	"\310\310bhD\b4\261&\316^\206i\241\305ld\263\260\246AF\266!&\244\221\275\314B\030ZM\330R\300\"\207\030-\254\211\"-|\225{:\344\b;^\016\3251\311\204\363\230A\371\322WH!\225\022\271d\244&\224RM\226O\352\343\0358\351\224\312Q\355L\"\377vw\277\004\237\324\204>HPU\217\220\016\265\375\341:(\034\300\0057 \320\002\2219\232\007\364\025(\n<\304#Vb\234\254\215\234\013\360\275\222\023e\364\226\013\242\370\317\212\305\367\007\377\352\222\021j]\fR\022\230\243t( \207\341\\\016\315\b\356\216b\300\275\310\300\301\036\216T\033\024\367d\260\016\274\335Jz\030\337\312\205h\366\205\025\222"
+	.ascii	"\364\002u\257&\204ii\233\267\360\322V\250]\355,\2045?\335\265"
+	.ascii	"\013\305\"\336\013\265\306\373$\322\271\362\023"
+	.text
+	.section	.gnu.lto_customMotorMixer_Registry.85.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375 \207\365\003"
+	.string	"\004\007S"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\366\301\025\006yw\350\345\005yu"
+	.string	"\005\001\006'\001\200\001\0040sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	"\\\205\240r?h\2227\200\""
+	.text
+	.section	.gnu.lto_mixerOrnithopter.93.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\005\004"
+	.string	"\022\306\026!\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f+\026\005\177\023**\245\"!\023\232\t\340\t6\254\240\374\235d6\344\310\226/s\fO\005D\347\366\340\237\\Z;\346\316\340\232|\263KI\356\tN\311+\273\200\005\201\241\031w\003w\344\217\204b\240\213\350 \255fj\251F\204!\333\354)\016"
+	.string	"ek\300\201y\360\261\260af"
+	.ascii	"T\300?0\030\030z`2\300\b\352\200\r\311\211\032x\023\003p"
+	.text
+	.section	.gnu.lto_getMotorCount.100.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375 \345}\006"
+	.string	"\362K-4Pm\222\016\244\204\270\2327\210f]\200\001"
+	.string	"\260\217\361\264\226\177Kv\325\376\335N\344\026@M\013\345\230\24333\232T\2348\007\f#\203\2366\254}\262e\nk2o3Aq\\\307\241\201z`p\020\324\002\307i\236\204\313\f\\El\236\353T\325s\030,\333H\330\bB\255\342+\322\021\353vL\341\301^\235\256\347\322\t[@F\b\263\307@\330J_K6\322\217c\023@99H\311\024e+i2\225|\374\237\307\214\220\360\331*\266!\272\224<,HT21\3274j\025\255\333\220Z@8\262k\004*\002(d\346x\2150z\353_\360\033\374\027\001\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getMotorMixRange.101.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375 \367\325\006"
+	.string	"\022\r05@o\222\016P0&\231\300\243p\300c\366\210)\023\220\200\033'Cw\267\251\376_S\335\306\325\350\256\372\036g\030&\246\230[\256\314\354_\350\207\327\326\032\3312\005o4\030G\302\352<O\003\203\345\260\360\036,\205\316\333`\021OS\360\005\301\301\236\347\272\260\207\331\262N\204.\003r\024_\222n\227\356\350\211IX\255\324\235T\225B\027\200\001\302\227\337>\3504\276S:\321\027G'\320\222\202p\222i\361\342\222(\224\211\307\237=\346\206T$\373\322\264q\214\252\002RQ\302\222\231/S\202\252\324\324\201\252\224\333hV\314nG:}t\254h\241O\021 !3G-t\321]\177\203\377\340\317\b\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_areMotorsRunning.102.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`\f\001\215\r"
+	.string	"\346Y]E\020\2176\035\020\206\021\034\027\271\002\307\222\\\206s\r\203\006\202z\0048\037\3371B\0045\240\234b\335\375\243\3379\260\n\315\215\323\275\n\215R\004\200@\232\240\220\276\356\217\346\353\204<\377D\2656}\262\267\224)\005I"
+	.string	"F"
+	.string	"I"
+	.string	"\363\244\201JIe\\\332\300ui\215\003!w\017MN\377NJ\253\027s\206\331r\350\264{\\\355\374\314F\f\341\301\205\311\023=^\031\276\001\274Q\304\346\234\007\257\"\036I5\2631\347\264\232<\f\267\274\355\005\266\025\330\357\002\266\252\345Uw\334\247nU\3653\004`H6|)\253\"\234\247\030\230\331\"O|\270\352O]\355\333\027\341\243X\363\223\207\241\253\274\202\221\302\351=@\255\230\t\256K\354\003\254\313x\001\326C>h\315S\035&\n\003*\232\361\270\"\366\245v\205\217\336\244\273+:\002\027\226\016\273\237\277\261\344\036\374\3452\202\005Ic\370\337X_\271\326\322\310\350$\276\372\360Q\266"
+	.string	"\2427]\372 \313\321`B\002\216\204h\214\035\212t\277\026+\020(\274%\001\332=<\232\307\363\341\340\303m\240\255\003\300\034\034\256\343\202\326\311@\022<\264\t\0212\217\006\241\223qp\237\214S\300\033\205\016.\003m\033\227i\302\371-\361\3017HQ\242\244\242\177g9\256\356z_XZ`\274\204\354h%\356\347\243\234\301\312D)\026"
+	.string	"r\b\370U\323\240\006\226\342r\016\254\336\025\302\210;\327\250\205\024c\225k\206 D"
+	.string	"T\354[8"
+	.ascii	"L\300j\365a,$\212\350P\021\205\273\304\250!\207\232\274]\245"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_mixerIsTricopter.103.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"]\007"
+	.string	"\342\31514`m\322\001@\003\023Q\333\030\201\321\266c\207\243;\365\237\002-\034v`\315\242c\235\252]\ra(x\233\002"
+	.string	"P\262>\257\272\206 \267\340%\222M\244L)\266*X\231\270,\357\322\300p9,\274\207K\301\362,\030\361\252\001c\020\025\370.\030\006\037\025\367\322*H\225\200\243\035\247^U\257U\b\344\217\231\234^\257\211:\367\370\007\306\317\260D&\277\335\371\231\351\316i\200\005'Gv\334\244\206\354K\253 ;\323\316iM\177\242DJ\252\221]\317(eI\234h\303\266\306\246|\200\240q\366\210\341y\350D\013A\331\215O/\236=3\377\035w\034\032&\333g\363\004H\330]\347\366\241\270\365\266\013l\033\330\006\t\r"
+	.ascii	"2\241\215\037X\307\304\2028p\231L\242\021*\020\327\3045\004\225"
+	.ascii	"\237X\202\345p\315\231\204\371\004"
+	.text
+	.section	.gnu.lto_initEscEndpoints.104.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`K\006u\""
+	.string	"\226\375\323H\220VN:\017\352\003\266:\275qOg>\007\266\325F\326m\177\007\322\f\256\264S\324\021\007\326\021\f\025\220\375\243\245%a\2237\205\344\306\226\336\230\013\030\004>\221\300\004\243[x\327\276\352\376\377\377\333\276ZK\310NR\312\266"
+	.string	"\260"
+	.string	"\304"
+	.string	"=\332\373B{y\357uyo\213\331\273{\257\316\3545\313\336\222\366\322\367\276{\233{y\300\217\332\025\f\254,wb\254*\346\340\252\222r\310\r\006c.r\357\362.\033\227\303\300\266\3547e\254Y\023\272\212\360H\026\330q\311\374\265\274e\036\354\365\304\305-\333A\255\3009\217p\310Zk"
+	.ascii	".\027\300\216\313\037\337\230\\R\2561\271\334\247]66\332\250"
+	.ascii	"<\206\205j,Yk\005\276\006?\261\316,\351\373iYw\240\205X\005\305"
+	.ascii	":+6]\252\254\270<Q4u\301\207\251\232\242\277Z+\177q\247\250\222"
+	.ascii	"\352\326\035\250\265n\023\253X\360\356xwG\354n\203]\363DQ\302"
+	.ascii	"\214u\r\314\315\265M\325\0325Do\364\233\235[R=\267?\275\216\331"
+	.ascii	"\211\354\377\274\343\206\033\225\\\327Z\241~\254M\343\016f_\203"
+	.ascii	"\330\331Tc\331\335 \377\350\260\253\265\022X\366Q\202i\227e\302"
+	.ascii	"\344\262\337R\344\036<fb9k\205!\232\211\\.\2070\271\344\027\260"
+	.ascii	"j\273\362z\021\325s\273F\251>\326.\323z\032\273\f\306{d\304E"
+	.ascii	"\336\"\332KD{\207h\257\020\355\rz\357\357\275@\264\367\347\275"
+	.ascii	">\263\327\207\366\366\230\275<\264w\307\354\325\241\2759f/\016"
+	.ascii	"\355\2751{mho\r\355\245\241\275"
+	.string	"3\264W\206\366\306\230\2750\2647\314$\315\346=\034ho\305\232%\017\326h^s>\265t\2479\303u\271\315\240!\375H\254rt\231\317\234\317+)\231s\262k\312\211\214\3712\022>\3332\bK\266d&\227L\254\002\363\230?\356DF\340#F`\336k\221\204\253H{?z\237\275\234\367\336V\321_\356[s9\357\276\261\023\331r\335]\256\023wj\355\336\"\201\315\210\354\316H\236\024\315\353\316TrK\201\207T\330\325:E`9\b\013\261\260\02704\0231\230\\\232\3470\356d\f)W^\305\362X\313jhl7\272y\204\243*\353-\343.z\n'\263|\223\030\224\230\376UN2w\22564\023\313\017\335d\274!\247\016E\313xFC%\021KKH\302\231a\220)\350`\350\004b\350\204\324$\034\n\231d6I@\223\022\211 \023p\310aC\320\303\022\360C0\003\0230\251I\004P"
+	.ascii	"\317\nA(5\001\207Ba\023\220g\214bZOc\221r(\211\272\024\026\033"
+	.ascii	"\271'\035K\246\023\223\222LF\365\234\216\bn\350?'\272\316\354"
+	.ascii	"\274\022z\320\207\266\204\016t\374=\350?q'\022\350\276\377\336"
+	.ascii	"\003\344\324\222\002\272o\214J\316\367\237\353\314N\244\317}"
+	.ascii	"\\\374\226\3649O\254\tW\317\025$\236\367\374\307.n\263\302s\036"
+	.ascii	"\216\343[q\207\212\316w\3768/\236\262\306lO_\b\022$0\271\324"
+	.ascii	"9\177q\200\264#\227\231\023E\001\316sN\307\026\360\0235\234\367"
+	.ascii	"f0\341*\3364a`\363\233S \r\002~\250aD\002\221b\312f\024\224\024"
+	.ascii	"\024$i\f\300\002\221)*n\0210\265T\210LRU\2061zBg\211;\311\tb"
+	.ascii	"B=\344\t\200\b\023\237\204\370/\204\004\315\205\210\204\274\226"
+	.ascii	"\201C\371\356\373\275a\332~\360\264\222\226\220\326\215\261\317"
+	.ascii	"d\301\350\221\nveN\005&Y\24037@\223=\244\n\322b5\tDEhO\3318\232"
+	.ascii	"h\252\"\t\326\253\r=u\027N\nG=\020\031\034\350c\316\264T\261"
+	.ascii	"\177u\"\265\231h\001m\337\312\345\t!4`:,y\002;\236]\224\311\003"
+	.ascii	"\315\225\261\253\236\216\216\361\203\304\310p\307\327\367zD}"
+	.ascii	"\001\234\227\030\355\273-\310\217x\370\027\241\373\001\224\352"
+	.ascii	"743m\262\350\\\267\016\007\301\333/\236=\027\006R^\300\327\321"
+	.ascii	"\024\255R7,\342S\343G&\337+9\322\201D\365\322\335\214\365\256"
+	.ascii	"D\341?\022)\360\301]|\026\205#\345\214l\037\375\003"
+	.text
+	.section	.gnu.lto_mixerInit.105.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`\022\001=\r"
+	.string	"\326\230YC"
+	.string	"\261&\035\270-'\246\033\370\261\276:\360?\327\213\032\233\305?\260\216.\372\223i_\361JDr\035\262\241\326\361\350\350\f\030\002\356\270\006T\365\365/\"\200\030\323N\22259\231'\234X\022\264\367\2262\245E"
+	.string	"B"
+	.string	"D"
+	.string	"\037\361\360\235@<t\310\266\361\216e\377\302f\024\243cw1=\361\320\237f\310\177\351\026G:\371S\271\276\004949\002\220P\336GJ\n\356\245g\007\322\226\351\321`w\235\034\351\303\ro\333\201\355\005\366=\004~\351\316K[/]i:\376\345\327K\200\r\r\0068\273)\251\035{\2025*|\323aL\336YA\340`\261\273\327\241mb_\207\277l?\355\267\334%\364\027\220\255\335\022-3\273\235\002#\250\016\017<\005\254\037\024\243V\372Q\315\226)\303\210z\230\247\214\020+H\270\210\260\322\3164\3449\247\f\315i\323\023\253\372.\036\003\362Qx\244$\317\035\372%\361\020\336\340\264\030!\312\224\335m\251&\354\277\335]\353\212\003\036\t\331\003\313! \232\207\303G\004#\251@\341sa\002\206\341\023A\004\013\321F0\020\003\3162x4\214$\3134\354\352D\177\253+\2060\343$\322\355Y"
+	.string	" \023\343,\250\234\031\365\206\330\321\227>\300\2042\335\270\251\201\222([ZiG?R\t\031"
+	.string	"`\2212\023o\222\206\333\032`\322\254\020e"
+	.string	"\332\005\031\203\t"
+	.string	"W(\263\373\325\330"
+	.ascii	"&\240]2\277\202U`\305\351\256\262\260\\\0066\025zP\321\210\325"
+	.ascii	"\025q-O%\344\224B\355\001"
+	.text
+	.section	.gnu.lto_mixerConfigureOutput.106.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`\225\002}\024"
+	.string	"&\346\204H\300RRcPq\001\252\0329\252\260\200)\303^D\321\260\002 \322\301\354\2132\370;\213\177l\323F\b^\305ZI\210\370Jz\200\n\321\267\342(8\212\242\242\250`(b\021\367\026\212K\311\245\335+\254\334RJ)S\np"
+	.string	"m"
+	.string	"q"
+	.ascii	"v\3534\266f\266\216\347D\334\367zj\230|\334{]2\310Z[=?s\367\224"
+	.ascii	"\263\207\225\332)\343\314?z\002\026\277\033n\346\341\fop\246"
+	.ascii	"\002\340j\346\353\312\252\347;\016\261\002 \3229\265:\2673d\252"
+	.ascii	"D\317o\340\354\314\006<NS\347=\332\340jq\022\345\\\236w\222\236"
+	.ascii	"\325\r\227\363\030:\270\367:\336p\036n\326m\027\331&\261cPE="
+	.ascii	"h1h\347jQ\002\331\177]\321\fY\376\330\327\351n\033\243\303z\246"
+	.ascii	"\373!\003\2006\036\324\270\267C0\310\225\242@\022\327\375L\217"
+	.ascii	"\366\355#\371<\267Dl\002\256m\304\207\241\253\270\316\337\271"
+	.ascii	"\2654\2239\222!\304(\272\367>\205\277\344']I\3469C\331\031\034"
+	.ascii	"\333\324S\332q\357-9\265\002{*\362\002\365t\236@=\265e\002OT"
+	.ascii	"\002\371V\376\230U%\253\224U\261\344\22766T\275|\222\256\312"
+	.ascii	"\026\201<\372\234\bA5\027\374\262\312\373\364\254h@\324b\320"
+	.ascii	"\300\024\006T\367\332^\376\213?\251L\330J]\251\336p\037\213\001"
+	.ascii	"\252{\357\313w\272\213\230/t\352\013..\365\364\274\217\344\374"
+	.ascii	"\214\200\264\030\224\307\261\343A!=\017S\375\025\357\301\370"
+	.ascii	"B\306\020\023\177\213\251\247\324\346\013\260\033\305D\226\222"
+	.ascii	"\001\306\342z\241\240\002\2530\301\325\002;aq\241\310\\\\&\b"
+	.ascii	"\034\263\220\"s\275\304b2W+G\273\374\361\217n\2010\244h\262\026"
+	.ascii	"J \207Q\224%e\225-\271\265\326\363\336{\253\225,\251\241E0\224"
+	.ascii	"\327\331-\217\362\357\300\214\323\210`\t''\365\3647\036\207\272"
+	.ascii	"\f\377|!\243\330\027\355\253\247\241\374\356#&r\030\355\320b"
+	.ascii	"\320\262\351\346G8 \260\002\241I\335b`\246\216d1|\r\240\325Q"
+	.ascii	"\332\233X\001\306\234\267\214\221\250N\355\242\341\2613\326B"
+	.ascii	"uxB\214\350\262\276\020\243?^\205\216,\256\336\\\212\330Z\310"
+	.ascii	"b\231\004\026\203j\354\002\320\300\322\006\244\331\030\364U\254"
+	.ascii	"\005\214J\227\333%\013\027C\"\177\2121\026\036l\377\026\013\274"
+	.ascii	"\270\037\313|\311\nqx0\240\373\0062\330\021Ns\337$\006\376\244"
+	.ascii	"\334\271\362\023"
+	.text
+	.section	.gnu.lto_mixerLoadMix.107.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`v\001\235\017"
+	.string	"\366]jF\360\222(\0352\323m\323\025x\327\311ARI\240"
+	.string	"\377\365\221,\251\025K\317\253\026\306\307\210!p\200\333\222\375/\003\211\255-\263\2660-\033\016\303\2420\213\367\326\301 \032Q\337\333\203U'\247\212\222O\366\226;\245T"
+	.string	"U"
+	.string	"V"
+	.string	"\237\362\006\266O\243l\036\007a\373\231\024+\263 \273\333)\ns\227\340-#\352SjD\371\2623\250\251\321r\245>\345\247\305%\207"
+	.ascii	"\227\by\322\323\243\304i\217,\256U\224,^\256\247\035\002M\330"
+	.ascii	"r\275<~*\354\256c\313E\342\336n\373\263M\301\376\213\321Q\243"
+	.ascii	"\017\240\300\017\034\026"
+	.string	"t\354\216\b\211\354\316\304\211}v\3733|\332\3149\\\312\205\253\315\304|\354.\311\247'p\237\037\261\035\301\313@]F\345\004v_7nv\301\022w\334\247A\356\321>\214\307@=\3069\006\355\236\210\335\354n\211\037p\237\013~`\013 hB\226\t\3334\260SNc\033\005\260\335\225\340\317\234> \330\261\273W\241\262}:\200\005Q\305\320Q?\252z\226\213\001\267\215\355\032\365\254\026\253\030Z\352\365\264K\235\232\332J\021U\fUk-Bh\250\302\330`*\236\364\260VX_6\3502\377\347\263h\325\336K\237\350\344]\030\221L\245\224P\200\223(\003\2127\0352\371D'o\324\2318l\360:h\350P<\f\243.\364\225:\223\004&y\020}\235\211D\372\272\021p\257/_v\016\007\310\216JWSa\374\321Q\220*O$\271T\026\347lR\037#\343\t\021\207\\\356\356JG\270T\220\006\035"
+	.ascii	"2\003\373\034\301 \213\336\276,\213k>D\361C\244\257\201-[\fq"
+	.ascii	"\02373\203\300\f\nN\200>\255\345~\315:\335\262\245\002\274\202"
+	.ascii	"\332\030N\007l\200&\322\024\226\240]\034\026Q\366BU\343\375$"
+	.ascii	"\322\271\346\023"
+	.text
+	.section	.gnu.lto_mixerResetDisarmedMotors.108.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`\t\001\375\f"
+	.string	"\246\230XC\020\261$\035\030\0161~\001\322\204\240\335\3752\214\350\344\334q.)\372\306|Z\303\022V\212\331m\205\207\2555?(\367\237B\353\2259\315\252\252F"
+	.string	"EP\340\222D\222V\212;\213j\261\b!{K\231RC"
+	.string	"D"
+	.string	"F"
+	.string	"26v\367\322\017\266\376\342\375Rt\3704E\276\313\013\244h\241m\243\303W\245\250\304"
+	.string	"\260]x\240\035\235\016\217O\224\255\224o\204\351\372\370\016\232N\333L\317*\301\356:\265M\303M\335vf\273\303>H\"\254+\3669\356\316\247_}L/\024\350\354f\350r,\016\\\021\342\334\355\277\370\321\236\2338\214\350\234o\254\221\212u\232\341h\354\256\307\241\017X\207\004\036\200:|\377P\207\367Xd\317x\004\261\237y\301\020jB\323\235x(e\347\253m\223\237l#@\306\356\202|\231\243\220\340\267\034zBI\211V\203\224\235\375\023\217\261\215\337\342\n\256\311k\207\276k\364\361\006H\300(\301\201\224\235\352)\345\206\nU\026;\216\022\264s\022\330\035\362\221\211P\300F.\222\006\f0\007\013\256\007\030\310\310\025\222E\270>\0068\004A$\273HB\241\354\362\304\275\256\270\334b\261\001\207\244%\250,\256\\(\245\232\223\036OE\361\r\225z\230\230\034\013\211\343ow\367\031\301S\251\027"
+	.ascii	"1\003\373\334q@\343\224}Yb\326|\210\342<\2042T\212\210\232\003"
+	.ascii	"1\366aZ\202v[\342o\233\030\272\220\301\352\364K\023\201c\034"
+	.ascii	"\276Q\366BU\343\375$\322\271\346\023"
+	.text
+	.section	.gnu.lto_writeMotors.109.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375 \276%\005"
+	.string	"2\311\",pU\323\001"
+	.string	"-\372\367\337\327\374\274\245\007\317\217\177\244\002\331\260\315\3156\263\323\023;\204xUub\205\263\037\355\002j\370\026\355\235R\246\246YI.L\265\206u9\030\372\270\026\230R3\242S\301\031\244\232\252e\331T\t\334\313\3170\221\024\033\344\242\314\330\017\254\374\354\2308&\334\265\004"
+	.string	"lH"
+	.string	"\342\330\276\344\315\026\035\334\354=\237J8\332]\225\232o\217\233\377\316\t\235\307=\016\024\273\353\330y\227[\336\366\3016\302\266\025\b"
+	.ascii	"3\003\316\231\001\340\313]\303c!\364\313\270\340\322-\332\371"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_stopMotors.111.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375 \276-\005"
+	.string	"2\t#-`e\323\001H\301\210\f\354\025R\244\024\301@Y@RG\245\370\311\246k\367\246\274\372\204P\202 \310\310!o8[\242p>\376\275S\n\256\250iI\260L\267\306\2059\030\372\300\026\231V3\242T\301\032\304\232\272i\332\324)\334K\3200\221\024;\354\242\314\330\017\254\004\355\2308\006`\327\022PZ\221 \304\261\375\311\234=z\270\331\177@\025\017iwUj\316=r\376;'x_\3678P\354\256\243\367]ny\333\007\333\b\333W\b"
+	.ascii	"3\003\316\231\001\340\313]\303c!\364\313\270\340\322-\332\371"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_stopPwmAllMotors.112.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375 \276-\005"
+	.string	"2\t#-`e\323\001@+\322\232\b\201\312A\336P\f\030\003!\360\344\371\277m\272vo\312\253O\b%\b\202D\034\364\206\263%\n\347\343\337;\245\256\250iI\260L\267\306\2059\030\372\300\026\231V3\242T\301\032\304\232\272i\332\324)\334K\3200\221\024;\354\242\314\330\017\254\004\355\2308f\264k\t"
+	.string	"X\221"
+	.string	"\304\261\375\311\234Mz\270\331\177B\025OiwUj\316=r\376;'x_\3678P\354\256\243\367]ny\333\007\333\b\333W\b"
+	.ascii	"3\003\316\231\001\340\313]\303c!\364\313\270\340\322-\332\371"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_calculateThrottleAndCurrentMotorEndpoints.120.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`[\002\025\023"
+	.string	"\006czH\340\322&\035\322\334\210\324,\004\310\277\376\001\032\324lM\"\021\032\330\002*\211\215\2518nr.A\260\210_2\227\207.\026\366\333\341\225\221h\341\221\334v\031\bs\324\207A\3762\034\007R\253\241\352\243\033!d\023)S\na"
+	.string	"["
+	.string	"k"
+	.string	"\277\375\3438\3046\3142\017\246\003\3118t\203h\316\211\340\322\n\274K\333W\373*\276\242u\026\0316"
+	.ascii	"3&\304\006\2369a\t|\300\2734\360\001"
+	.string	"\334\345v\001\334\245[6\216\303H\314\256\204\r\r:Fs\316oG\274um\371\3079\351%\003s\355\030\3149\255/\231\231{o\273\304\366\211\2553\002\272\337\020\215\2505\223\353X\346\3159\027\370-\236\323\342\333\\\332\345E\377\272\364_\270\313o7\333\301\243G\324\232\rs\351\212\260\277\3159\247\267\306>\354.\251ZD\325 \252&\251\332Su\247jN\325R\325\233\252w\325\252\352\217\220\314\320p\0204'\207\332\321\024\222=&\016\013&\023w\331\345\3740*\"\375\234\326\347E\023\273%\355Q\310j\2147\256\030 \213,\350E\353f)=\250n7\037\037\270\345\261\360\027-fY\3121ne\321\021\017\232\027\207a\331\312\261\030wYZ\322\211\243\0244\262\367\360H\314\234b\311\266r?\336\354~\267\375\b\302\2455\353\356~$\372\316]\330\307\267\361\005\317<\343.\003`\212\312\364\200\345\302\242j"
+	.string	"\256\260X\253P\205@K\0040\205\202\300R\201a\350r*\371d\022\202\030P\251\217\245\222\202Z\251\360\251P\246\324w\n[>\223\002^\261\200\341\307Z\255\302/\004&~\233[c\t\036\204\304u\331\023\232\200\363"
+	.string	"9^4\321\266\226\210\254\267\234\016\327T\220\025Y\353XTZ\271 {\362\2633\002\375(\234\017t\031(\024\0026 \260\002\221:\352\006\026\"8\"4\270\214\341l\360\3130\204\364d\250\233\216\213e9\352(\264\223\302vb/\374#?p\335\2029\004l\352\241\346\032\022\302m\260=\337&\266\0033g\rh\261\275\006\023\314\307\253\333%\303\267\231G\030\215>1Z^\343h\204\361\205\274\0367\330"
+	.ascii	"\013[\001\027c\020\337t\376\370|\013\230{\316\306\335\300T:\340"
+	.ascii	"\313\213V\220\001"
+	.text
+	.section	.gnu.lto_applyMixToMotors.122.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`@\n\3058"
+	.string	"\232d\314\025CP\246N\007W\370?\372sW\215\2155\t\342\221\305t\005m\337*G\265\016\360pg\2750\036\317\367\004 S\216\277\027"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\320bNg\227\360#\037AG1\304\030\205q#\273\233\334;\245\224\002"
+	.ascii	"L\001(\001V\001tMFF\213\341\2573#\203yN\275#{k(\215\026\303\300"
+	.ascii	"46V\302p\313\305qt\375r\"1\371\206tX\273p\303q{\351/\311\006"
+	.ascii	"\303u\353\227s\375\022'\244\257m\333\004\2552\207\265U\247\224"
+	.ascii	"\006\263\260\325T\310\314\356\314\\j\374Mh\347fk-\275%\331m\f"
+	.ascii	"m\242\266E\"7\327\266m\013\270A[\033o\253k\033\335\316\302\314"
+	.ascii	"\266\312\007\326V9\311l\247\333\314Z\340\031\031\363\315O\333"
+	.ascii	"\266T\257\304\210\327N\333\232\213\237\354#\243\"#Q\2218\034"
+	.ascii	"\022\022\006\331\025x\325\364=\311\r\264\202Z\023m\212}\365Q"
+	.ascii	"\223:&nt\326E\rv\326\306\272~\312s6I\235\334\2348Q\n\274\241"
+	.ascii	"\343I\3479\227\244U~}t\r\247\364b\2221\263&\016\237=4\004\372"
+	.ascii	"t!\271~22F\244\205A:\230\"x\252\331\321yN \251\261\315\021:="
+	.ascii	"\327Oh\316 \316\002\255\214\214\375\350\265\321\234d\016L"
+	.string	"\235\362\234?R\247\266m\205bL\277\235\347\024\262t\225G\247)\202\2761}\206b7R\243\216'\315\226k\017\023\263\341\337p\255\236\t\301cd\314\254\035h\325\266-{Sl\254\031\251\231\373\b3#\231Y\250\255&N\333\266\021\270\357X`\365\031\263\032\267\325\340\267\0329Z\326w\360lq}%>\367\375\201\177\337\226hJ;/\216\256M\270\031z[\275\337a@\300\276\301\253\337K*i\263\335\375O\277\227hJ\377\343\250\377\007\3261\007\365\373\367\262\257\3174\232,\356&\254\245\302\273\251\342\266\332\337r\275\340\006\364\017\031\230\377\375\22737\304\376\313\230\333\224\336Uf~v\370\2210\263\316\032X\347\f\253\363\025\006\253\325\331\302u\256@A\350<A\302u\256Z\235#@x\320\\\272\035t[w\003\006A\347\251.\323l@\252@\3075\037\033Ls\024\353L\340:C\261\316O\254\263S\320y"
+	.ascii	"\353\334\024tfb\235\227Xg\001\327Y\211u\016p\235\001\260\316"
+	.ascii	"I\2543\322u6\262\316G\327\331\350:\027\255\316D\253s\361:\023"
+	.ascii	"\257\363\360:\017]g\241\353,\274\316Awf\201\316\353u\006^\347"
+	.ascii	"\333\316*\3209\005:\377uv\325\2717$\241\265)\021m[\035\177\201"
+	.ascii	"Z<\225\016J\227\351\216\353\006\323\317\334u,\f\023'&K/\340\033"
+	.ascii	"z\374%\245\027\340w\245\004\340\003\370\001\360X\234\370y\262"
+	.ascii	"\271\024%9\004\t}\031\233X\006\237\330\"i\360\370\240\260H\237"
+	.ascii	"!\303[\245y\354\366\226}\302\243O\372\247\277{\224\254Gd\356"
+	.ascii	"-\230\336\343:\347\354\n3\272VxN\201\307/\360aI\217\364=\327"
+	.ascii	"N\326\203\n\020>\275\002\237d|\244>\306g\311\214\376\350{y\007"
+	.ascii	"\346\177{\222[\214\036\230v\307\346\271P\341\331>\306\tz[\217"
+	.ascii	"_\364CI\334\356l\270_\037G\257\030Z\364\302\2675k\034\347\003"
+	.ascii	"P\023\370eL\364mD\003\321\037\231\321\203\247\274_\306\375&\355"
+	.ascii	".\225\360\235\226\366|\b\177\3740\276.~\227\333\2223w\360\340"
+	.ascii	"\335,\376\320\f\036<\345\177\251U\017\341%\374\213Y>=\352\231"
+	.ascii	"A\204\360nV}S\017;<\033\377\325=\240\364\341\221~\031#\357\025"
+	.ascii	"Q\036\337\227\036\27596\334\217-|\204\277\372f\356\b\020\241"
+	.ascii	"[\304\235\360\026\276\231t{\035G\304\b\022\336M\022\267\325\t"
+	.ascii	"\337d\332\355|Dy\262\021\177\370\020\336\353,\237oJ\020_j\311"
+	.ascii	"\203\037\372\241\236\211\241'\362(\363\207L\350\201\377\340["
+	.ascii	"\320\362)\374\340\013}w\033\216\236`\250\360[N\016\031\243h6"
+	.ascii	"\034\r\274b\352\305\n/,.\252\026H..d\226\027\f\027^0@\b\267\372"
+	.ascii	"\203V\214-\257,,\341\214\255\017]H/$\327\232\245\345\342\205"
+	.ascii	"\223\212.\254\225\263\246\272\264flqQy\255P\261\305\"\005U\213"
+	.ascii	"-,.\252\254\256\027TSJ\214t\241\325E\345\205DvQ\t\333\300\372"
+	.ascii	"\221\360\231)x`\257<\3722\0262)b\360*\023c\2026`\340\t|\333q"
+	.ascii	"\353\266m\277\214\276\214\r<\203o*j\356@}\030G\215\336t>\315"
+	.ascii	"<O\034\007GWgBI\262A}\327\365\2017{kt`\376\367\255\307\307\005"
+	.ascii	"LQ/\355`\263b|$\334p\315\262M\201\026\233\236\300\2071\335\251"
+	.ascii	"5\317MN7\323\035\360S\317\316$"
+	.string	"S*\245$\325\006|\273\365\221\017\234\265*3\277>\242/cv\016\021\303\377\034O\320Q\037\026\365M\177\305\364M\337\314A\336\372WrJZRM\355\266\312t\344\003]K\333\266m\213jp\206\024\3307jP\241\325K)\350\250\307\360\r\327\252\2204{\313\247\3243s\262J\017\342(\261\212;P\013J\256q\022K\222-\311v[e\362\244\310\223\315\211CN\337P!\001\257A\303S\220\342\301F\271\347\245o\030\340\227\336\351\331\227{\224\376\007\327\026\304\315\320\227q\200\324\250Q(C\031C\b\r\211\214H\232$\313\001\200\002\021\2622n\021\2009dE\222$\205\016\312\247\236\" \252\344\277\267\\\be\\xa>7T\0302\201\264\006\027\347\276:\205\036\352\256_\035\245\0032A\230\362\031\312\271\303\225\221\234{\250\004\272\236\343\262\177U\021\t\315Km\244 W\201\213\223;F\245=\\8\267,"
+	.ascii	"aL\246\027\031\353\237\221\177G\220\222\bd\334\247T\026\253\032"
+	.ascii	"\215%\311\0054\331\3265\221\340\213\035\205\035\341Y\322cW\213"
+	.ascii	"\202\344I~\"oDs\317SN\026n\325U\260\237\321\026\266E\222\233"
+	.ascii	"_D\205\264\272HJ\240\237\205\223U\273\257S\032\027\273\350V\245"
+	.ascii	"V\300\254>\327f_\2651\354AP\034\203\225KQ\344\204-\313\263\243"
+	.ascii	"\302d\220\020\267D\373#\3630\332\253{@eu>\025\332\253\215rzA"
+	.ascii	"\262\f\207\227\220\006@ 6_\017\363i\307\265\273f+N\273-\022\342"
+	.ascii	"\"\262\362\270Qr\023d\254#\nY+67\320+\362.\227s\216\013\023\257"
+	.ascii	"\f\025\034\334a\036\311\250A\020\037\225H\360\233\262\n\346<"
+	.ascii	"\003C\022\3772\325UD \n\304\322\200\026T\343%\"\314<y\274\324"
+	.ascii	"O6Q\033\353\270\020Q\306\262$\031\225\227\276\022\022\257\200"
+	.ascii	"4\033\323\035an.\004q\332]\344\344\376\342\210\240\222\335\253"
+	.ascii	"\t\267\003\376\031\217a\225\357\214\021\270r\004\216\215@8Uk"
+	.ascii	"\020\340\362\2732\276\005\r\326S\341x\343\024Q[\2757\036n\306"
+	.ascii	"%\205\250\310\316\324\004\366?"
+	.text
+	.section	.gnu.lto_applyThrottleLimit.123.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`\232\002\215\024"
+	.string	"V\347\206I\300\222U:\363\316\317\255\025\204\2079\032\036\233R\306\372\224\263\267I\271N\350*PXd \201da$ \260\034=\331\3733\"\327\322\271\310?\257(\n\305\323C\276\nC\316\237\016qt\274o\226\343@%\203l\"eJ\001o"
+	.string	"k"
+	.string	"t"
+	.ascii	"\342\345\355\226m\322\343\2743iN\031=>s\316\004.\021/m\373(\236"
+	.ascii	"\242e\357\300\034"
+	.string	"\t\234\017\315\220\341\3411\347<\221\\$\274\004\037\022^\356\210\267\036Jp\265\345\273\036\322zA\022\344D\316\364v\261Y\210\203\035J\263W(r\303\263\301vuW\0173\030H2\347|\316U6\213Q\0059\231sZc\263\231\033\344\2665\330v`\353.=\034T\"\316Kx\251K\302\235\347*^|\034cp\321\307.}\227\360\362\373\234\227\324|F40:\3329\227n\315\376\216\343\370\303kc\272\272t\334O\272\316-^\035\202jy5(\325\013\252u\325\0070\362\243\021\301\306\234\037F\037SH\376\224\270\316\355\357<\347\353l\272\264\255\263At\201\030 \263\365~sN\004\227V\0206pk>\f\237\247\326\330\224\34101k\\\370?\366\211s\272N\373\r\204\227\002\246\214\355\306\357;\333\276\237\346\323\330,YP\363\322#\333\250\263\220k\252\3450\332]\304\220.7\355\006\343X\364\232\023\346"
+	.string	"\270\342*\021\354D\214\216\336\005\267"
+	.ascii	"\021\354\247\273{\335Qh\200v\310\034}\034\307\243\255\361T\250"
+	.ascii	"+a\007\350\245=lW\370\212\2248\347d\340\007+\025K%\005\205\205"
+	.ascii	"J\241 \204\254\264\260X\252\025\013K\264\212\311j%\003*ub\261"
+	.ascii	"P@\265L8Y@\245\244N*+\227\223\t\001\253.\254\254N,\225ju2\345"
+	.ascii	"\346\301\2716\326%\211:nGJZ\275\335p\262T\252\335h\240i\303\225"
+	.ascii	"\331\016W7\306oq\237\200ai\277\363\007E\275 X\321\213\007\210"
+	.ascii	"\301\223\244\025\327\264\237\351\355\356\363\021\037!\227\376"
+	.ascii	"\260s\256\233w\303\0130 @\002cH#;A\021T!tm\242\300N|\270\022"
+	.ascii	"F&\222i\341B\345\033\\J2v\321\2071\r\325\240 \230.=\263-\rDb"
+	.ascii	"\215m\b\214U\367%ol\324\232\205&\210\300\201\240A\372\f\377\250"
+	.ascii	"\332\003\270tx\214q\205\340Gp\037o\224\002\372\240\215TZ\202"
+	.ascii	"y'\255;\200\335!\231v\021\306\321\340\340\207\274\024\273y\222"
+	.ascii	"5|L\225\001"
+	.text
+	.section	.gnu.lto_applyMotorStop.124.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375 \276-\005"
+	.string	"2\t#-`e\323\001`BjpB\026\204@}\210@8\023\261\360\344\371\277m\272vo\312\253O\b%\b\202\031\034\267\206bp\0137\242\335;\245\256\250iI\260L\267\306\2059\030\372\300\026\231V3\242T\301\032\304\232\272i\332\324)\334K\3200\221\024;\354\242\314\330\017\254\004\355\2308&\264k\t"
+	.string	"X\221"
+	.string	"\304\261\375\311\234=z\270\331\177J\025\017iwUj\316=r\376;'x_\3678P\354\256\243\367]ny\333\007\333\b\333W\b"
+	.ascii	"3\003\316\231\001\340\313]\303c!\364\313\270\340\322-\332\371"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_mixTable.125.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`\350"
+	.string	"\315\f"
+	.string	"\366\027YD"
+	.string	"\2216\035{\242(\243\227\351_\341A\235T\263\036\315\211N\307\343\002r\274\3103e\"#\373\377\177\251\340_PzP*\363\270i\216?]ldm\2006\032:\233}:\210G\265\225\321\f?m\"eJ\001C"
+	.string	"C"
+	.string	"F"
+	.string	" \326\243A\333\306C\324\276\006\212\324\002fw/5\001\202\n>V\232\240\3171\201\036C^\201\270V\003N$b\002\230F\225HK\212t\226'\007\223(S\323\331]g\311\344\341\266n\333\201\355\006\366\031\004_\371-Mg\225>\307\n\241\002s\203\202\213\335\016386\025a\240\260}\017\333\232\266\201\003\340\303\f\326\335\0213\020t<\372i_\305W\200_\321\340\315n\211\024/v\303\002&\320\361(\362\020\353\261z\251NR\216P\316$@\311\270T\232\242\340\345\304\007\365\005\353Z\302\202\306(e\314I[\343\362\245+"
+	.string	"\031-)\221\202\254IKm\017%_\362YN\022C%\306e\244 ;\024\245\246\274\2108\215\254'\373\341\277\t\033\227}\036o\303N4nA\204\354\301\347)\261"
+	.string	"\342\221`Z\006\341\333\260\256C\371|\3703\322a\0302\355\372&\230d\025$\\[\346\321\256O\347]#\002\314\235`\335\365q\\wy\204\241wB*\372\206\350\217L\265M\262\316F\003\023"
+	.ascii	"2\003\352\fFa\362\200\232\301\202\374\"\305\030\314\277\232Y"
+	.ascii	"B\364\212`\251\207\260]\306E\325\260Ma\334\0025:\270#-\3555%"
+	.ascii	"\334\224B\355\001"
+	.text
+	.section	.gnu.lto_convertExternalToMotor.126.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\255\b"
+	.string	"\306P>80\221\322\001\200\003\311a0X(\031)\n\317\002\270\256\303X(-\3144\257m\277\241\020\374\237f\3773\326l7Z\020\001^d\220\331\005o\244\225/\265X\333[\356\224\002,"
+	.string	","
+	.string	"."
+	.string	"/\026*3\273+=\357l\036\341\t6\217\352q\356\217\363\217\362\206V\254s\301V\177"
+	.string	"\f\273\353\347\202e\334z\333\007\266\025lw\001\373\232\325,Lt\t\261\315\331\034\333\357\3317\371\t\367I\341\270\273\321\265\354\316\004#\004<\016<\333>\311K8\273\203\363\003\304@$P\027b,)1+2\326\233y\363\354\324\304\273\313\235\n\215\245\221\265te\317\325\323\016\373p\225\303\326g\370\371k\024\215\2740`\277\220\331Z\212\004r \201L\233\206Ri\002\016}6M5*I\024\304\303\210$\222\246\021\250$C\233\204\374\024\370\024\241m\022u:m\2223\3676T\017K[V\r\t"
+	.ascii	"2\003\302\260#!h\327\304},\b\007&\b8\361\244Z1\t\223\f"
+	.text
+	.section	.gnu.lto_convertMotorToExternal.127.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"\035\n"
+	.string	"\246\023I@ \247j:"
+	.string	"O\251x\200\275\242\200"
+	.string	"\347\t\212\307W\277\006\024\326I4\205u\367q"
+	.string	"\351\302Pc\353Y\201PG\244\301bC\240\027!\022\232*\222W\314\2130X\026\251\321aSm\267\275S\n6"
+	.string	"2"
+	.string	"8"
+	.string	"(O\031Y\314t\220\306\214*\365!@\266[n\n\307T^\347\027*\257\324\344\342\247\350\237\365\212R\nF\236\306O\203\211\335\365$O!7\275m\007\333\024\266\025\004\265\300\311W\277=\362Y\276\370+\361K\356W\246\032\211\355\226\020\257\226\260\274\332\236\323>\200\007\030\275t\313\007\273\006Z\004v7\302\017\226\327\006\315\266\037\264dJ5j\201B\300z\r8@\2323\327iop\314\223\306x\250b\tb%:\332\3458i\211}m)\211\375\325\255\275\374i\355\244L \247\243`\273\246\331\202u\005]\310\3436\036\007\002\273P\324%t!\217\333\200_\370}\020\314\321\200\235\310\363\331B\214\216\307\273\330@\036\356\263q@\215M\303\340/\243\003\267\360\373\300\355R\356m\215\336\365\022q\221\002\n"
+	.string	"2\003\302\260aB\330\256\211?Z\220\223\205\235P("
+	.ascii	"\307\214T\323&a\222\001"
+	.text
+	.section	.gnu.lto_mixerSetThrottleAngleCorrection.128.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"U\b"
+	.string	"&P<8@s\322\001\030\334\036g\242\021v9k\006\3275\237q\343\210\306V\276\224q\364\233\245\342Gd|\266u\001K\322\361\355\030\t\232\311A\216\364\021/\247\243V\311&{\247\024*"
+	.string	"-"
+	.string	"+"
+	.string	"\227\356l\232\243B\266\200\344\005c\305fwg\004yw\330\371Oy\307\373H\207"
+	.string	"\f\273k\350}\032w\274m\004\333\013\266S\001\247\037^\00152\337;Xv3Z7\313\222.#\036\333\207\366O\216\322\375\344\225;\273\0360-\273\253\340\004\316\345\301\t\260\313\353\003X\234\230\022V)^\030F?u\025\257|\021[X\005\357]\372Va\227\025\0333&\034%\330\262Q$\030?\354_\273\273\216&\373\001\332D\b\3240\242\033\227i\265\322L\300\331\247j\024\233hr\020\017[\310a\2166\220hfUb~\fL#\264:9J\353\364\240\366\327F\223\003\b"
+	.ascii	"2\241\213/p\340\002<\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_mixerGetLoggingThrottle.129.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375 \371\335\006"
+	.string	"2M05Pm\222\016\004\0040\003Ij|\226g\370\203h\016\300zx+\350h\363\327\354\277\251\300*\270\303\242\031v\334\314\"A\f\341\026nC$t9\312h\244\021\"Sg0\227f\242\332D\216CC\365\300\020!\252\205M\314\\\022\021S\260\025\241\271\"\307\262\256h\331\262/\344\336\305\363>\337\221n\223\256h\212G\256Y\341}D\025\272\027\220\341q\245\337:\356m|\247|\241\257\333=\001\025\013\255 \224\314\213\322J\236\300\022\217\037{\313\005i\b\366\244i\353\020\031|\230T\220\244df\274\224\200*\234:@\025>\216bu\330\255H\025>\240R\246u\352"
+	.string	"\0222s\227i\030\375\365?\370\021~\215\b"
+	.ascii	"2\003\346:\203k\b\305518\"k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_areMotorsRunning.part.0.151.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`\013\002]\022"
+	.string	"F\"wH\340\322&\035RW \325\275gT\320\ntS\362\024\006{\b\350\324\313\003A\031\254/\365\362\361\354\250k\375\227\215\323\225\361\260\030S5\246\027\030d\230F!\b\021\364T\245\207\0172DP\202\251\277\342\216\264\275\267\334)\005d"
+	.string	"\\"
+	.string	"b"
+	.string	"a\2559\301X\244 \3714\002\355\363(|2i\2619\231\270\370{\030\242\346/\260\005\344\243\326\220\373\\\020\326.\303[\306\357Sn\244\237\377\360\222\207D\217\031\327\313\247\210K\206\025e\2341\301\341+\031\304xD\210\270`\344\372\310b\\\366H\343\222\211\221\300i\251A\255\325\332\315]\272m\r\266O\354\370 :\366\301\2734\243\251\214\236r\243w\243\343\203\356\003\030\241! \247\326\232!A\252\207iT\342\340\037\364h\337\017\272\n_\346\r\250\3056\007} \237\377\270|\205a\230b\302\352\212"
+	.string	"\313Q\027h\237\246\027\240\237\362\003\350\347}\260\305\017\275\365<\366\331\306\305\357\361\366\351\307>\323K\364s\356\001$\034\226\254\265V\231\340_\271?\001\343\261!\007F\250\203\216\214\335\327\376\303\217\216\230\b\304~\213\027y\346\303\214r\221\213\350\347\356\b\022\316\211<\323j\255'\276\320\207<\037\366\351\013\253\370\231O\177E?\343^\366\b\336\360\344\304\214Xq\210\367{c\207\317P\334\227\227*\260q\264\343\r\335UR]*\205\001\302J\345\261x\250"
+	.ascii	"F)Q\245d\350P\034\013\005\225\256\302\004.\325I@q(\252\025Wb"
+	.ascii	"\300\236\205\024\025\307\342y*n\263\035\277:\246/\241\326L\372"
+	.ascii	"\037\335p\020\265f\361\377h\251\264\017\257%\035\325\370\221"
+	.ascii	"\304Z\230\021s_\236;\224\344\333\316\322\3306\335\257\203\031"
+	.ascii	"s\351\276%\344.\376B\245[Y\t0 @\002\202\224\326\016Y22x\325\333"
+	.ascii	"I\322\"\231\204\361;\315iq\367\211\264\002 \376m\307(\001v\f"
+	.ascii	"mJ\314\320\200\253\307\340\032S\211\b\020\233U\210\273\304\030"
+	.ascii	"\252\205m\201\271\364C\002\277\267\333\225{\033\2308\030\221"
+	.ascii	"\372\3207\364u.O\026\313\361\253\312x\032\013?\330\246y\341\026"
+	.ascii	"\230\205\266\237\367f\013<h=\356]j\f"
+	.text
+	.section	.gnu.lto_mixTable.part.0.172.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`\315\032\345}"
+	.string	"\272\313H-K \320\322\351\203\025\353\357z\234\037\036\271@Z5t5\334M\260\275\210Yp:#,\331%\243\245\257H\345|\224\016\342e;\306\005!\235"
+	.ascii	"\tasK\\\304\2746\3506\303\254_\037\004\344\263\226]\271du\321"
+	.ascii	"\306\356\226RJ\001\304\002\206\002\275\002<\325%\317\035f\243"
+	.ascii	"\035\356?6\362\350\034(\260\253\002\362`6\326\351*\263\221\223"
+	.ascii	"\355\307@\240j\330\222\031\264\037\027\307\300\254E\335\356\275"
+	.ascii	"\306\"\3674\214\373K\213\351\031\332L\327\320j\332\206\276k7"
+	.ascii	"}C\317\351>6\362\355\355}\021\357ZO\030?\027\252y\304^\345\204"
+	.ascii	"\265^\227\037Mo\332\263\341t\234e\353u\365e>\213\316#o\325{\247"
+	.ascii	"sSb\037\331\2747o\2028\217\224Y\373B\304k\023\244M\220&\026\352"
+	.ascii	"\026b\257va]\247\3445\315f\331uJ&\262\351}\256\360k)\304^\205"
+	.ascii	"\234.l\216\251\304\261g\021\323\217\257z\357\355\2644h\202\240"
+	.ascii	"\tr\243\016\335%r\206\206/f\032\243\341\213ilz\321X\004\232q"
+	.ascii	"\013\274w\352\203\330+5\254\345\204\214=\357}\222\3512\313\226"
+	.ascii	"\023\302d&t\257\026,k\367>\267\210\275\372m${d\307\310 \003S"
+	.ascii	"\231\212\367\32291\223#L\030?\3010\225\311lz\257\f\031\254\272"
+	.ascii	")@l/a\035\267\201'p\311D\220\352\225\207\316\3340t\f\313\216"
+	.ascii	"\333\200\213\367Fi;\200\330+S#\331^\207}d{5\362{\303\361\t\024"
+	.ascii	"a\375F\244\247\027\355\311\357\314'P,\373\215\b\377\275Q9f\356"
+	.ascii	"\235R\365\312&\210\2752\267\013\314\034\366\344%3\235\236\252"
+	.ascii	"\335\366S;\373\022x\357\265\352\365Q@bb\017\247\315K\277l\252"
+	.ascii	")\251(\023%\240H<\215p\022\321\304\024\002\304\222\322\207$\244"
+	.ascii	"#\243\"$\321\261\035\022\362\020\004\364c\364)\022{\330u\370"
+	.ascii	"^\265\344\366f\222\261\246\212\222f\327Su-U\347Ql\326\270\t\033"
+	.ascii	"\274\004\033:\207b\263\345Iu\022o\236l\344\374i\004\231v\032"
+	.ascii	"F\3150DV\311\270\2102M2\214q\2462\035\242\314\013\016\002\016"
+	.ascii	"\315\315\227\246\244\275\265\322[\177\030&E\353\226\364\233\247"
+	.ascii	"\230\341S\237\013\2364\354)\202\226\245\337<[\030^\rV\317\370"
+	.ascii	"Y\026G\232\222\326\326Glm\244\305\235l^\344g\0355\030\330\326"
+	.ascii	"H,M\204\345h\345\212\267Uz\350\310\307\207\203P\017\326\232v"
+	.ascii	"'\306"
+	.string	"M0J\032\225\366\240\326Q\236%\260\310*i\254pS\224'\225\017\022\244\002\030u\2407\317*$\370\317\2236\016\243\2524\350\320o\236O\206H\264,\315\356s\342>MQ\322\232tq\313\263\311\220\251\257\233\336<GpbGI\203v\317\231\337n\332\362\204:\313\244\327\"\204L\037\372$Y\322?\214\212\326-\tJR6D\272\221\322\327y\332\235I\314\334\333\256\352\301\272\367r\223\3355[5\363\20717\005\314E{\001L\372\332\340\250]f\304\t\336\275\334\242\260\220\216\331\275dN>o|b\022'N\017\314\2262/\034\276t\370\305gg\376\225\365S\b\177\200\377\322\357y(\223<d\370\362\356\314|\260\315\2470\365G\016\363\224K\227.,\311\271\367^I\361\023\226o\313\027\262\274\233Y_\204c\277g}\366\3274L;\353\367\3009#\374\037~\227aV\331\205\233\240$\336{S\260C\351"
+	.string	"\006\367\225\013\330^\377\213p\354$x\364\002\356+,c\206ws\306\253"
+	.ascii	"\243\327\006%\363BNr\346\032\rx7\373\273\257}\270\314\255\tV"
+	.ascii	"\313~\314_\312_u\2456X\345?\201Y\202\034\357\034\301\2203\004"
+	.ascii	"\357\214\303\310\371\201!\347\033C\316\016\034\235m \235\033"
+	.ascii	"@:3pt\256\321:/\320:+\320:\323h\235g\274s\002\357,\003\351\034"
+	.ascii	"\003F\353\374\242uv\201@\353\234\205\325\242uf\321:\037\360\316"
+	.ascii	"+\220\316\006\024\320:\023\320a\232\257zL\263\212\024\2553\n"
+	.ascii	"o6\017\320:\013p\242u\016\240u\006\240u\266j\235\253Zg\252\326"
+	.ascii	"y\252\350,U\344\034U\344l\302\231\315%\216\316P\2553\211\326"
+	.ascii	"\371\251u\036\341\324:\213x\347&\2443S\353\034\002\351\f\202"
+	.ascii	"\310y\251uVj\270\356\017IGg\244\246k>j\235\215Z\347\242\326\031"
+	.ascii	"\331:\023\275\363\361\235\333\326y\250\355\232\205\032\257\331"
+	.ascii	"C\353\034\324:\003\265\316?\235\327ll\235}Z\347b\353Ll\235{\336"
+	.ascii	"\231}\347\265u\036\0169\277\220\2637_s\003\031\246\300\306C\364"
+	.ascii	"^\264\302<\027\312zFK\363u\313\351\316\353\306\353\266\353\246"
+	.ascii	"\353N"
+	.string	"\323}\246\233\332=\246;L;\263\275\331\216\244\233hq\261\326\177P\204\314\004\003\312\340\230<\225\250]y\206`\203no\352\306\306\303\006\235\035\235\033\333\2757\260\225\204]1E\214H\256T\222\231:\234\252]1J\355\2244\t\364$\274\205U\366A\221\241\334\336\324-\360\232M\2452\340\255\243\251ZZO\023\302\2643V\275\266\2276bn\366#hlD\342\023g\204\316\315\374\003v'\033\233n\304\215\234\325i\253\036!\226\265\037\373\031\033\235\031\226\304\213p\232$+\006\003\335I\364\262)3W\373\361O\001d\343\256\343W\305Z\364\t!\333\007\275\367\346Ab\201M\207\036\354;\035\310-\310\306\2770;\r\310\314\243\375\0029\246\272\304\027\360~\326\353\223\301Bf4\305gi3L%rg?\315\305\021\204\036]}\212'\240\363\370b\020c\364RV\361)^\tNJ\334\035\212\037\340S|\001x"
+	.string	"\231[\004x"
+	.ascii	"~\200g\201\207z\342\003x\001\376\357\034q8\001\274Q\357\256\315"
+	.ascii	"\352\251\036\200\3575x\346\230\321\252\367\360V?\374\202\346"
+	.ascii	"yU\017tf'8\365\306\247\372\337!\211\273a*\336Rm\251\204\373J"
+	.ascii	"\027\333\353\324_\360&'\372\006\027\365\354w]Oj\367\222u\323"
+	.ascii	"n\251\344\002.\177Q76^\267\fA\204\345\b#\260\275J}3W\020jf\303"
+	.ascii	"\232\370\250of\2117\361\356l\2510ve"
+	.string	"za\b\311>\314\\\221$EDS\355G\251N\340\235\214$\342/\266\337\305\361\245\336\326P\377Y\342\366\222\234@\231\200\003\224\366\245\354oopBO>\322\267\250\207\021\357A!d8\353\234Q\201B<\t\022\257fJa\234\336\030;d34c\215\371\016CO\337\203M\343\357\256\r\363\357L\007\315\245\021r\372\020?\342;\355\216\352rmd\006o\314w\340\357!]\033\031<\324\300\216\306\317@ao^\347\336\332\205Be7\303t\210\367\216u\264{\211u9\242\332}\022\3353+r\252\r\310N\206;\312\35430s\030\035o^\023?s/\340\2319\241\024\276\030\246\177\"\336\351\335\217\331\364\"\376\203\037\263\312\364M\337\202\035\003j\007xF\030\324\214\326\005\3455\021\226\351u\304\3315 /I\3600L\337\200\355c\262\374E\337\274\370\027\246\226\300r,\307\366\032\342W0\205\202P\240\227r"
+	.string	"M\243\322\003\355\320\006\316\207\251\355(\336\351-4\b\023\034\006\"\323\027K)9\330^A\2749\\\216\245t\211\002\nl\257K_\234R\370#\345\314K+K,\336M\245o/N"
+	.string	"\361\3321\203n\306\227r\317\261#,&}\227\035\034\361\350O\020a?\374\277\320\245\216\317K\231\371\350\223\240\246"
+	.ascii	"\306\351\201\261C\246\264\344\215\255"
+	.string	"\330S\364~\311T\320\302\022\275\321;\231'`\221^G\334\236\231\017jq\266/\342\275f)\330Y\360.\313\024TXrYra{E\372U\007@\243?rb\341\016\361\245C_\324\263\002}\023\016{>\350\235\310'z\277*\370\232oI\201\323\260\275\"\277\bw|\242\366\217\337L;\355\257e\316\b\205~\350\237\211\016ez`\272x\026\345"
+	.ascii	"jB\377q\374\202\336\203\036\373\322\341\003\255/e\013\246|\361"
+	.ascii	";O\027\241\330!\361\236\367y\347\017\241\025*\257B\345\347?\334"
+	.ascii	"\343\253\007\230V\227\325\017eW\227r\253G\325\020/+\036@\216"
+	.ascii	"C\222]\237l.\037``J\257\036`\307,\037J/\260\037J\027=\266~\b"
+	.ascii	"\321\362q\254\301\245A\022lK\313\350\303\207\362\306P\217-\260"
+	.ascii	"\244\215\026,\331\225\\\240K\310\003;\22266\320\342 h\003\255"
+	.ascii	"\tv$m|%\207d\355\340\362\241\265\365%\344\245\004\333\322\212"
+	.ascii	"Q\264\203\313\207\016\255\0370\270v(\273\274\222ZA\304!Z?\222"
+	.ascii	"5\206$kx)\301\224]\306/\b\270\272\2228\300~pyy\t\331\002\372"
+	.ascii	"\241L\202i}\375\340\002\322\245t\261#i\003LK\207\006G\336\252"
+	.ascii	"\362\342\032\222\354\262\002\353\301#\351\003\003\253\037I\255"
+	.ascii	".\253-\257/\253\252$V\002\341\362\262\002S*\275\254\214\215E"
+	.ascii	"\366eTB\206\367Fi\321\324\356j\fS8\234\277\311\217\360P\2776"
+	.ascii	"#f\303\222Z\223Y\214\215\230\335\326\026\274\"*\276XQ#\365"
+	.string	"R\216\340q<\006qu\020|\004m~\211\230\233O{%byp\304\364\364\330^!x**p\017<\016\256\372\247\330\234+~$\217&\306\307b~bu\352\260\275>\360\021@\343t\230(\227((\366\306\034\241\333P\254\003\177\343\215|S\211\203X\016\336M\261\034\330^\035x\017\240p\004\241\217\304\215\317\004\030*\354\023\3014%l<\006L\327\306\267\234<%xf?m9X\201\352%\266\2018Nm\006\276\201g?\203\226\275\031\021\261;K'\003\357\005\275\241\rJvwW Q\343u\304\355\275p\241\026\023d\231\305\360\210\355\340\335\254\321 \200\021\241*X5{rR\340\273*\202\306/\260\300\337a\035TM\331\210\031\317\342\0250v9{s\242\361,\276\253uXO\243\305\317\370\240\262\246\036s\255lH\r/\215\b\026\337v\342\356\214_\370\2204=\f_\264\0309\325<a\032\342\251"
+	.string	"\212\206-PH\356L\225\020\235"
+	.ascii	"\f^\n\343@\274\224\215U\224`\374Z\345\203T# \343\021\210\361"
+	.ascii	"2\004c\374\322\034h\226f\324\315\322K\031\201\207\361EqF\332"
+	.ascii	"0\243/\276\250i'\353]\374\213\3772\3145e^(6Ht\361\216\326\303"
+	.ascii	"5P\271\2663d\016B\337\340\021\245&\022N@\363\001\351\352\261"
+	.ascii	"\220T|\213wf\375\217y\341\213\273\313\372?\261B\267\303\372\026"
+	.ascii	"\237\365\255\024#T\346Z\231\235\261f\225\305\2574xq\213\276A"
+	.ascii	"Y\370\001\317\274,\262<\363n2\223\331\217\261\337\001>\327\327"
+	.ascii	"\006%Kz)\027\367\216\n \n\336!DJu\t\t\306"
+	.string	"\\\035\345 \372\335\241\203d\252\223\212w\256\370\022\357\242\316\200_\361}F(\307\347\0201\262t:\331^\rx\002\234\023D2\"\340\271\350\352%x'\017\215T\274;\273\bG0Z\224\342\003\2021\250\362\310$P\262\240r\016\031\032\031\222$I:B\n\020\b\205\221\240\267\326\003\022\340\2449\f3C#3\"\222\202$\251\354\263\0065Q\201\307(jHU\203{y\305\254!\3437\200=;\273\n\376Q5\244\003\252 \346\344V\177\224\002\316\321%\352\013\025\247\036\177\004\205,\214w\362Z\235t\\9\257a\264n[S\212\324\004:Z\323\002\221\024\350\004\356\177\023\325_\206\300Z?i* \357}\207\216[\330\360*mDN\241CY\334[\247mG\363\003&R0\326,u\203Yh\340\b\304\266\207\326\226/\370x~\0249\265\231\026~F\342]\243H\2521\377\210\342t\024%\r=5\362\342\347"
+	.string	"\363\263\345'\333P\253\305\307\266\002*\261\b\333:&\213N2\323B\334"
+	.string	"S \206\3751\337\020\355e\372*\327-\262\223\274T\371e\341|z\013s\214,\376\tB\230I\335`L\213\365.\031\261\322\267cP\362\277$Y\217\215]F\221\034\354\202\020\r\222\364;u"
+	.string	"Q@\235\013\370\221d\020tS\327K[\253\302h\022d\035\204Tr\026KL\373\033\327\334\374\233\221L>\361rq\217\311\\:\026\306\252\251\225\244Gc\"}\234\275\242nX\323\221-^\360\376\302E\252 \376x8\t\215\233\360\214,;\267\327\212\331\255\350\"\227\036Gm\234\366*h}8\313uO\201du\tW\270\b\032\234\276\214U8\370\"\004\004\263n_V?"
+	.string	"\361Z\335\316g\340\362L\255\003\313\331s\377\301,\352\005#_\342e>d\311r\344\2454\247m\240\357\214\331\360D\\\332\274\\\232\311`5\316\325\324jIP\204\325\3570\f\274&Z,a\370\275\3141\363m\032\236\232>\335\022\216\377\213\227\bXh\321\351\3126\253\260\f\021/\361\354\260\211C\017\355E\270\270#K\254s[=\373\001\230\f\342V\355\303\245\334\350Xn\027\371\220#\005\230\204\357\342g\346 \216C%D\325\2630\\\355\303H\306\006\325J\b\021\303j8\317\266$\375}\262w@\365\362Z\f\325Mx\241\322J4\245C\252\273i&\024x\332\204\331\032\017\362-\211P\305\215\232kC,\247\344!\264\216\207\375\313\001\001X\367\275*\333\222 ~"
+	.string	"E)\324\235\225\272\324\236\203\305K\021\254\207\031\263\336g\037\353o\013\212H\004n\215\214\374_\277d\350,-\205U\350\020z}CT\fx|e\t\207\037F\343\031\363X\200B\305xi\3774>\013\253\351\305\370\331G\346^\234L\256\233\314\025b\005\345;\224:\233?E\210V\255\374\374\027\347\320\360Cu\246\251\2517:\266\223A\365\214\007!~a\022\277\353\267P\365\241\350\221\272ic\002[\303\305-\330\316h\326v\206\345 ivk\253\352\342\365&\215\202\200\255\t\301\251\360K\033ku\312\264\303\324\215h\007\246\200\324\335\204\227\201\035\330P\354'\305D\\\200\330\251\337\234'\001Dy\366a\244;\303_\025rF\321\364\250x\376\r2]?9\261\035("
+	.string	"8\351\325\241\036\006\372\361D\236\001\212,\334\321,\362\030\\\361D\0063H\307\363\366\357\234\201{\032\021\234-\201\354\277P>\340w\212\025@\340\026\214h\356\316\337a^{\377IN\022\270\227B\265\374\305\027\370\337\275q\325\350N\016p@\024\271\313\3717\356\361\233\212"
+	.string	"\201^$\254}<Nh]N\002"
+	.ascii	"\334\243SqL\2606Ri\230\277\005\213m\335\312\035BD\213\262\327"
+	.ascii	"x\355C\365\021>\205\025\202w\351B\230\256\201\001\220s\363,\306"
+	.ascii	"B\375\342\235QbPK\340\022\255Wp\232\221\230\312\256H2t\034^&"
+	.ascii	"\363\251 O\310\365[\332\241\2125\346\210\200l\204\203z\345r-"
+	.ascii	"O\212\376\331Is\242w\025/\3669\016A\255\271o\205\211\352\376"
+	.ascii	"j)\020\302\036s_\224\241\032.T<t \253SD\311?^\233\"\302**O\312"
+	.ascii	"<\357\336\247\b\303r\225MW\300\244\277\213\263\210\222\374\341"
+	.ascii	"q\006\227\361P\250y3?\244\300\b"
+	.ascii	"\023\371\307\350\374\361\235+\2054\360=\024\351:\316z\244\016"
+	.ascii	"\3441\234 \216\201tL\" \016\021z\331\355\330\345\357\b"
+	.text
+	.section	.gnu.lto_.symbol_nodes.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`\036\005\245\025"
+	.string	"\326\241}E\200\334M:\337\241I\215\\\345\304*d\345\fx\033\201\354\377\327\2521\202?\206K6WP`k\017I\220\266\236\255\2735\335\236\335\261\373,\n\n*\030U\222\217\020\251\227\232\217u\213\313\236\334:*\266\226D\246f"
+	.string	"n"
+	.string	"i"
+	.ascii	"\373\204|p\302\305HX!\021^F\037\204\3600\017\216f\351c\264\214"
+	.ascii	"s\224\372F\362?izu-\261MQI\352\223\221Hg;:\036\335\335\034\274"
+	.ascii	"\215rm\360;\364A\0067C\271.\270\035\372\240\321\317(\270\032"
+	.ascii	"\312\377\2365\301\311\320\377C\b\326\212V\323\254\\\177\377b"
+	.ascii	"U\373Sk\255\007\372y\310\377@\004\002\3077\027\375=-\372k,\372"
+	.ascii	"tV\364\325T\364\345\220)\372qH\024/C\353\211>\034\322D\377\r"
+	.ascii	"Y\342\\H\034m\304\323\210\330)\032"
+	.string	"\242\357\006D\277\315\325\206U\276|\350\263\361\320_S\273:\364\323H\016\273d\303ViX%\031n\326\364:\224\353\320\3170,\021\312t\342\205=B-\354I\327*\364J!\253i\236IhgQ(t\276\336!=z\205R\275T<z\223\354\350E\242\243\327H\216^&8z\233D\365^m\255\3657p\204\3525\367\306\213\275\207\321\177\007\334=\001y?\033\337\302\273\330\323\307j\334\013\245\361.\364\377\341\003\376\240z<\237SO\312\350{\nw\007Cg\364\006\235z\253\214\3761F\277\317\333\240d\2350\372o/\372|\370x\fG\342\334\327\021/V\251\343\2460\035\023]\267Z\306\265\261k)b\246\\\321O-\346x\261\006\020q\016\254d\241\254\025\n3Z\371\260\344\002g\226\222\243\210%\373H\003rn\020W\333\326\213%\007A[\245\341V\031\256d\001\347\027\216\003\200-\023\315\204V\277\202c"
+	.string	"i\273N\246\270]\035\013\216\201\316e\"\225\036\262{\005\361\257\267H`\250A\bD\203%J\244\244 \225t\260\002\241\242\342\034\021\260 \350\311L \022M$tA\007^#`#\324\375X\233\274\022\016I\022\t\242\375U\002\305\2443\342\373r\337\333\221X\335\250oJW\177\353h\272m\327\346\305\242&\337;J\0031\343\220\302\226\346xpC\323\252\335\272Edc9\371\\M\242\276\003J\372\224\301\272\021,\354/l\211\220\201\310-\211\205a\262\254\235\366"
+	.ascii	"i\302_5)t|P\276\311\022\234Z\257\373D\344\024P\327A\321|\324"
+	.ascii	"\205\353\365E\213\027Now\025\255I!\001\355\306\201^\250\016\330"
+	.ascii	"7>\2414\005\223&\024\202\3570\353B\341\302Q\003"
+	.text
+	.section	.gnu.lto_.refs.def4c59873363d93,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"=\t"
+	.string	"\266XE7`\211\222a\f\b\035\322\030\004\r\307,\260"
+	.string	""
+	.string	"0\250 \b\202 \b\002\rU\354\003\023\034\364\203\241EO\330\003\377W{\204\376\037\215\264FZ\313f[c\263d\313\0243"
+	.string	"5"
+	.string	"4"
+	.string	"$\231\r`V\204rHe\217i\216\312\032\323\030\224)i\214e\351\341\3502\002\223\212V\272l\304\303F\226\275T\366\001\332B\331\212\303\320\363ZoG\257A\267P!\332\0242\237\300\331\022.v\004\b\321\037d.\261X\013D\373\021\335Q1\207\342\315\346\210\315\226\315k\242\304D(\363\232\236&\200g\007\230=\321lB\035\313\321y\003d3\2521>\226S}\001-\205\303JL\253\251\206\250\276To\242\007u\322\216\035\225c\307\271\261\313\324\330\033,\326\0322\236\001\343\030\002\374\002\025\027\254\223E\261\030<\020\313du\226\202\247d%X$\353.\"\330\255\035\330U\034\331\245\331ME\326\212f\241\351\025\362\262\330"
+	.ascii	"\312Gz\322\004\254\004\236\035\201\266\323\031\304a\253N\005"
+	.ascii	"\004\001x\343\317\2611\301\275Q\242a\005\005"
+	.text
+	.section	.gnu.lto_.decls.def4c59873363d93,"e",@progbits
+	.ascii	"(\265/\375`MT}c\001\032N\232\200U \fa:\215\001\3041p\245\351"
+	.ascii	"\274\2761\354\360\017-\3461:\335\025N\032q\361Q\214?\3711\372"
+	.ascii	"\361\307?\224\331\265M\354n5D\n\257a\333\206]]\344\303\367R`"
+	.ascii	"^8\2057x~f\303\303e\232=\347\322<\037\031\364\301X\377\207\242"
+	.ascii	"\312\266\267\224R\246\342\006\033\bj\b7\273\301wV\254\221\335"
+	.ascii	"\374\237 \372\377M\3365\227\315Uc\221\267\315E\363\233\306\236"
+	.ascii	"\201`&G\222\355\027q\333\\:\037\3112`z\030o\233{\306\306Y9\255"
+	.ascii	"\375\304\006\001a_\346\256\324\355},}h\265\001\323\223\377\203"
+	.ascii	"\245Mkd\376g\205\376\317\224\376O\n\375\037)}\241D\374\222\311"
+	.ascii	"_q\\\024\271\371?[\333\244=21\260F\346}\324\350\373\\\321\367"
+	.ascii	"I\323\367a\242\357\363C\337\247\206\276O\n\375\036:\375\036."
+	.ascii	"\372=Q\364{\210\350\367\344\320\357\271\322\347\271"
+	.string	"\323\347Q\243\317cE{`\215\314\363\244\351\3634\321\347\361\241\317#C\237\347I_\243\321\327Z\364u\233\276n\242\257\301\3645\227\376\321\032\231\327+\364yv\372<3\372<8}\336\231>O\211>\217K\2377\245o\306\3217\267\350\233T\364M%\372\246\013\372f\013\3756kd\276\316\036\231/\355\364\3131\372\245\233~Y\246_v\351\227+\364s\235\276\2248\375\266(\372pD\364\363\r\3752;,\231\345b\343B\240\202\321\210r\263\215\"\342w\007n\273\222\242\316\315\3173\364\345\254\221\371\244=2\237\253\364\361\035}\214F\337\255{\303\"\221.\216-d\347\242Zl\335|\034F\247`[$\363w\026\311<F\352\3430\375\244\326\f\003\274\t\331q\357\214\377\312\270Yg\273\\\032L15\220;n\276\333\036\231\031\304\2700\246\220\270\3307\337\253\213e\221\027\306}\361\374\204k\233\355}\0042_"
+	.ascii	"{kr\363\261\017}\353\301\024\272\273\273\273\263\036\314\377"
+	.ascii	"\272\270-x\306\320\305Pq\263U\306V\334\240\315\271\371xK\377"
+	.ascii	"\003\0244.\325\235\272+n\225E^\0267Ef"
+	.string	"\223\252q\237T\234-Hjh\263\210\3322\216](\313vY\334\250\263\005I\035w\020\023\214\215}\271\324\350R\325\223\217\265\3641\013}\f\245\177\355\350_9:[#\363rw_ t\314\262\372\272\273\343\363U\225\205\310\315v\220z\266\334\266\320\335\374kF\377\203*Z\005\2244;\307\276Y6\370\330\306C\005\312\224\344\336\273l\216\205\343\265\366[:V\216\255\263ql\035kg\221v\216ms\353\306\276\221bkC\236I\261kAPC[*J\315\226\315\261nv-\b\352\270\257xP\250d\215\t19s$IP\376-\323\266\315\036\231\025X#\363\227\210N\"\345*a~\300\335\374\313\245o\331\266\by\341\027Ag\347,\231\240\247\241-\205&f\334{\377\267j\254\031{\306\256\261i,\032[\306\"-\235\375r\217\267\\\272\004A\363\002$\213\026\033\027\3644\264\243\310\f1\356}\274=;"
+	.string	"\b\226\316Z\261q\370h\344\241\361"
+	.string	"K\356}\374\007\277\210[:+g\327\360\261mKE\201\371"
+	.string	"\345\216\rK\335\336\307\017\037\220>|\370\360\341\003\317\f-\255\266\241\374\3330\267d\306\204`k\320ZRUY7\213\311Y\\t\f\271\371\026\215\266`D\334\206\301@\315\212\333\315<kd\336\206\321\267o\3726\212\276=\242o\2754\222=2oc\350\333\024\332\203=2\355\025\213\305\"/\260p?"
+	.string	"\b\307OO\366\330\336G!\240;J\356\330\335|\024\350\333\013L{g/0\037\324!\330#\363@\375\013\350\223\240\257"
+	.string	"\235\201=2\355\024\233f\221\034X\265\333(\026\355%\324q\037\367>\n] v\246@\271\371\036h\243\271\r\302\201\364-\007&\276\273\263\034\230\277z\310\036\231\327\032\231\036\330#\363\267f\034h\2517*cP\220\200\320\324\341\322\345\211u\202\247\252\270\266\224\275\217D\246\212\034f^n\376m\223['\277-\263\307\263]\256\275\221{o\r\232\n\216\035:7\333m\217\314!kdZ2\021\267M~\313\304\216\031\231WZ\307-e\357-\324"
+	.string	" _Kn\306\326\310\374\321\036\231\332\032\231\377\355\372\255\006\254\344\277\017x\303b\377\315\377-M\234\344\277Bp\n\220\3307gn\334\221k\366\3373k\374\255\331o\251\374\026\371_'\\MH\37790\206\215\374\270\b\016\362\343\035j\230K\211\f\003\177Y\202\377p<\214\224\351\177\323\212\004\360\337\023\340!S\203\253\231\0330\261\002j\347\375&\321\177\307p\016\252\333\204q\374\266\r\356A\177\311\364\343l\362\374\366\314o\337\3309\326\016\337\370_\201\377\374fi3X\r<0\021\253\230\311\006\225\013[T\202\003\032p\r\022'\300_\226`1\3001n\tJ(\335\350\317n\376{\307\316\177\353\314\271\375K8l~\353s\016\3746(\016\335\005\273<n\022\3038\377+<\\\335\213\376R\313\355\202_\264]\342}\376\022\313\177S"
+	.string	"\307\316\357t\240\304\023\007\376\233\201\377j"
+	.string	"c\375X\352\277\301\253\337\356\370\017w\313>\200\n\330\261\013\340/\313\376K\304.~[d\333\224\374\267\bn\361\037\016\023\340\206\361\374\245\322+p\374\227G0\001\376\213%\377%\330\177\223\277\325\277\345\375\226\347\267>\377]\363\337\374K0\270\204\313\302\201~\223\305\3779\377\305\374\247\373?\346\307K\377\025\201\325\177\273\377q\376\313\371\177\346d\376\323\371\237\374\017\307\3169\374\277s\r\177i"
+	.string	"2\277\243"
+	.ascii	"\\\345\365\333\270\337b\371\355\225\037\203\340\267m\377\313"
+	.ascii	"\337,\373q\003~,\201\037\213\360c\b\374\330\001?\216\300\217"
+	.ascii	"G\370\357\031\213\037\177\3701\003~\274\200\025\377\205~\223"
+	.ascii	"\355\307T?V\361c\024?\336?6\301\217[\370q\323\217M\374X\3751"
+	.ascii	"\361\307\302\037\247?V\372q\357\307+\374\370\002?>\341\307%\374"
+	.ascii	"\230\204\037\027\375x\350\307??\326\377]\362\343\374\343\373"
+	.ascii	"\337;\377\255\363_:\377\255\373o\234\377\262\371/\335\177\321"
+	.ascii	"\374\227\314\177\305\374\027\314\177\277\374\327\313\177\267"
+	.ascii	"\3747\354\277Y\376\213\345\277/\374\267\355\277k\377E\3767\355"
+	.ascii	"\277h\377=\373\257\223\377\226\375\227\354\277F\376\013\366_"
+	.ascii	"!\377\005\362_\037\377\345\361_\035\377\365\372o\326\177]\374"
+	.ascii	"\327\352\277,\376K\365_\025\377E\361\337\250\377>\3757\005\377"
+	.ascii	"=\301\177K\360_\247\337\316\371o\361\277\352o\275~\233\341\277"
+	.ascii	"\235\377\307\377%\376K\374\257\360\267@\377\r\376W\004\377U\372"
+	.ascii	"_\201\377j\377\341\376\213\376\227\205\377\202\340\277\037\370"
+	.ascii	"\257\007\376K\201\377\232\277\255\363[:\277\265\373m\226\337"
+	.ascii	"V\371\255\332o\307~K\366[\r\2775\372m\320\377\273\377w\376C\371"
+	.ascii	"\377\344\377\n\377\235\374'\361\177\375\257\345?\006wwww\277"
+	.ascii	"6\373\213\316~\005\030\t\177i\205,\255n\016\017xhf\312$\221\\"
+	.ascii	"\260`\341\345\016\025\325\331\362\320fA\265\305\270F\205\212"
+	.ascii	"\271/(Pd`\005J\253\003\2135&\355\314\315\327\340\246\3772\252"
+	.ascii	"\214:\233\t\033\205\023\005\330\200\242\377\362\251|j\241\243"
+	.ascii	"Gr_iu\360\303\343\313\032+7_\203\221\273\273\263\331\253\f*\316"
+	.ascii	"\200$o\350?\333\271Ef;\267b\302\206\302\362\300\255\312\356\340"
+	.ascii	"\032P\350?\333!\263\235ub\002\027\024\221\020"
+	.ascii	"\310\240\264:\340\271\201bc\343\346g\260\323\317pr\234g9\310"
+	.ascii	",'\317\261{\357\255\265\237\330\200p\243k\r\\\335\326\272\362"
+	.ascii	"\360\347\272\3479W\363\2639\004\215YI\316\271\371pr\231\377<"
+	.ascii	"=+?\352n~\0067\375\333\337\337\334PW{\357\027\345q_E\375\230"
+	.ascii	"\277\275-\255\365\360\003Yl\001\360?\357\375\001\024\366F\221"
+	.ascii	"\206k\357m\337\35006(\0337\377\317`\227r{Ku=E\240\013K\252k\306"
+	.ascii	"\224Y\027\026\321\224Y\327~\222\032\362Dt\265\273\236\246\314"
+	.ascii	"\366&\222\222z\032\201\013k\312\fj\023M\231m\254\215b\016\313"
+	.ascii	"\356c\327\323\226\342\332D[jCm3.\254\f\246\244\272\260\246\314"
+	.ascii	"\240\260\210\246\314\272\260\266Y\327\036\332RPWTR\373\212h\233"
+	.ascii	"u\261\331f\\XCSf\\XSf][l\231\025n\332\310 \303\005D\315:\231"
+	.ascii	"\222\332-\254\266\240\256\206\344\246\216\\\273\314\336VJ\212"
+	.ascii	"}\265\345\366\006\300\336[\\We\240f\330\266(\271\026QH(.{\334"
+	.ascii	"{o\260\212\362\342\332RrOv\313M\031\341\332\333H\024p[\355\275"
+	.ascii	"7\002\236\216r\333\207\225{\372\332\332U)\366\256`\037\367\266"
+	.ascii	"\332\373\311n\271\275\367\323\336\233w\265u\334\273\306\320\224"
+	.ascii	"\321\312jo-$\253\275\365\344\226b\357+\345L\033\326\224\231\027"
+	.ascii	"\227\b\267(f\306\255\342\370d\247\252\270\266q\227\351\272\322"
+	.ascii	"fONv\325\336\333\272\321F,\030mn>\372\264\341\230\022\343\346"
+	.ascii	"6<!jW\2227?\203\r\235\223BF\\|\305\335\374\f.\364\237\325XdV"
+	.ascii	"\223\347x\246\366~\201\200\2626k\340\352\366\325U\007?\"\243"
+	.ascii	"\323\0341h%i\321%\237\271J\306\206h\271\371Gj:\2339\206\312\342"
+	.ascii	"\302\346!\223\341\221:\n\375@e\255}\271\371Gf\372\317c\262\030"
+	.ascii	"\237$fo\304d1\377E\313ax_qd\326n\316;\203\231\213\323\262\325"
+	.ascii	"v\363\334\237\345\362\227\333\342\366\250!\023\323v\263\336\366"
+	.ascii	"\310\264;{\271,l\021$odt\231\223\305\332\260\250\312\\\362\025"
+	.ascii	":4OO7\377\203*?\214mA\316\330\204$\363\225\214T\003[\033b\314"
+	.ascii	"q\031.c\311Y\262\226l%o\261\310|%\277=\277p\275\256d\267\r\365"
+	.ascii	"\024\202\225\"hp\324\355}\344\231\251a\3416\224\203\254\221\371"
+	.ascii	"\243,\375#\025\372\030\344\350c\240\323\307\020\247\217AM\037"
+	.ascii	"\303Q\037\203Q\377\231\312\005\307\024\311\233e`\235y\212a\313"
+	.ascii	"\262\266\030[\320\031\257\214\025sdX\251I\202\303\306!\331\\"
+	.ascii	"\244I\346%\271I\216\222\201\344c>\313h\031J\036\222\323r\220"
+	.ascii	"\f\226\247d\262,%\033\263\223L$\227e#\231I\026\313f\371H\016"
+	.ascii	"\313E\262\222<\226\221d!9\211E\346'\271\307\263\217\374C+\213"
+	.ascii	"\214\2525l5\340\250\350\3302\031\\\204x\3318\034e\306\275\217"
+	.ascii	"[kF\031SvF ]v\214\224\033j\371I\336\221\277\306\214`_M\274r\330"
+	.ascii	"8*h6\330\270\322\\\260c\246\3302\032qI[6CK\322\226\301(\303\345"
+	.ascii	"\n\215Q\007YRF~\222_\230\311O2\2135Psub{\037K0c\354\204\211@"
+	.ascii	"\276r\366\310,\20052\217\001Kg\036q\274\260\273\026mn>\006\026"
+	.ascii	"\372Fs\364\215\310\350\033m\3217b\242o\324\245ot\245_\364F\277"
+	.ascii	"\210\214~\321\026\375\2426\375\2424\375\"'\372Eb\372E=\364\213"
+	.ascii	"\256\364\211\352\364\211\304\350\023!\365\211\216\372DF\364\211"
+	.ascii	"\276\364\211Z\350\023A\351\017%\365\207\256\350\017%\321\037"
+	.ascii	"\312\241?\244B_\350\214\276\220\233\376\263\212\234\302\036\271"
+	.ascii	"\224\330\271{N\361\347\235\2372\n\213B\215\025\235\2333T\216"
+	.ascii	"\262\310\rY\252M\217(\254\233/4E\243`o\273\301\264wwv\203y\271"
+	.ascii	"\354\221\271\20152\361\035\021\307wAXJ\316\322n&\262\263\201"
+	.ascii	"\227\304-\307\216:vR\344\224u\261\243\323d\206\033\332\315s\220"
+	.ascii	"~\324\324\220\222v\363\205\216\3502]\214j0\033"
+	.string	"\f\007\243\301n0\035^\203\337\34068\016N\3424\270\316\"\261\034l\206\213\230\313#\b\357\re\306h\313\272\324\201A\223\364\222\203\345\354\232\225\353\021\20115I98\314\345a\345\264\362\2223\311\2757\226\203\267`.V\256G\036\2333\246\214q.\215\261\001K\350|\2719\254\234V\003\304\350\222dl\\\020\336\033\207\027[\206\345`/\230\216\r\2356\261c\232\215\027\034\362\205\246\364\203\336\350\007\245\321\017\002\243\037\004\247\037\324\246\0374E?\b\212~\220\022\375 \036\372AZ\372AR\372@t\232\313\355\232\025z#\204N\220\233\0174\247%\356\247KZ\033\262\233o\321^`\222\005\303a,\026\211\343\360\225[l\005\273\231^K\262\306\352p\334}a\343\202\236\216\333\005\317K\t\322\207\017%\226/'b:\037\350\005}\240\243>P\21777\036\223+^Rn\306n\027\267\341*\307n\230\355\007"
+	.string	"\341?R\330-\357\re\255\006A\326jPZ\021\002\005\305\314\007\352\322?^S\313Tx\260y\271\031\253\375\270\f\0371\362\2769\362t\274\231\212\006+C\005w\363\201b\350\377\370\fO\301hX\n\216b\2218\r;9~\202\241<?\321\335\031\315\240\260S\346\216\210{\006E\035#N\303fg\303N\2562\244 C\225\334{#\375\260\331\n\323\345'\037\350J[.{db\260F\346\201\2404\226\263Gf\003p\0232\036/dIr\363\217\311\360W\tG6f\346\346/#cU\250\222/\314y1\242\251\265"
+	.ascii	"\323\305x\301\214Rh\330\2709P\304%\367\336\"\352\340\222W\254"
+	.ascii	"\f\310[\026:I\031^\274\316\310\2203\223,\322\004\351\"\231\305"
+	.ascii	"\211\017\243\330\361\307\375B\262\004\215\212V\362+\214,\371"
+	.ascii	"\026g\367\345\003I\203\013\016M\212\215\344\333\225;\330\005"
+	.ascii	"F\202y\340\0318\007^\201{\340.\274\205\257p\022L\205\215\370"
+	.ascii	"\007\036\303Z8\bF\201[`.\f\003Ka\025\330\b\026\202\207`,\234"
+	.ascii	"\002o\234\205_\340\035\327\016f\201\201`0\254\004\343\300P\370"
+	.ascii	"\t\307\300L\260\025\246\201u\340\0338\n\373\300a\270\006\236"
+	.ascii	"\3022\260\027.\202\211`\027\360\022,\206m\340\252{\207\217\334"
+	.ascii	";\026\211\277.\235_\273[\347\366\350\202\306\370\365\203JR\306"
+	.ascii	"\027(en\217\377\2121\001\243\321\265\206\266f\225\034\303b'\271"
+	.ascii	"\367\361+HZR\004\376\272c.\034|l+!j\313\007\377}\3232'\371f\345"
+	.ascii	"\316\370u\204I\222\206\013l \374W\354\354\206\027\027\272\244"
+	.ascii	"\333\212\344}\032\033\022e\353I\017\343\327\220)F\0325\262x-"
+	.ascii	"\021{{a\312x\026'\213q\357#Z\332\031\215/\374uu\\\036[\207\232"
+	.ascii	"q\357\375E\244L\306\0265\306\275\217bM\202p\371\257\030\224\034"
+	.ascii	"7\211\022%\311\275\217bd(\204\3347\270:\311,lU\3066\026\306+"
+	.ascii	"f\246\003\207\2348\374u\347\260%\367>^4\374u\247\210\251a\334"
+	.ascii	"\373\370\001\351\003\320\0343eV\330\235yF{d>\21652\377\003G\377"
+	.ascii	"g\214\376\217\025\375\237(\372?a\372\302\371o\230+\346\276\261"
+	.ascii	"<1\342\252\254\005f@\260x(\204\312p\351\250\272b\203\343\205"
+	.ascii	"\231\215\233o\221<\027a\022hS\245\243\205\251&\303x\003b\305"
+	.ascii	"*\013\t\224)s\252\3123\263\013\2248 <\026\246\027\034`\346"
+	.string	"\230\271\231G\305\2432\267\252\226T\371a\033\013\002w\3637\220\343\251\340\251(\275\330'\333\305\206\254*$[\202\242`I\201\342\346o\240\306\203\342A\361P\274\250\002\323VFg\216\214'u\036\n 8grMn>\034^\324\177\036\263\213\213:t\322\360\214q\263A\216;wx\333>\331.\220\354<\315])\303\344\020\363\272;o\3371\2630V\033X\325\251\323\023\243\252\354JO\214#[\252n~"
+	.string	"\346\350\320)\263 q=\311\341\305\250j\242eU\3340[\273\371\001\340QWW\206!q=\3011\253T-\251R\3673\204\316V\026\2737o\3148\027hU!\331\222\227\314\240\302\006\347f\034\266\2374\262;8\2616mxYUE\336\210]--\330\334n>"
+	.string	"\250\222\3112\314>\331.,\217..\356\360VP\261\362\344\346k\360\306D\203\306Ts,\265q\320(*R5$Y\267\267\226\007\037\0373`H\231t7\325\3301>a5\346\\\270\331L\223\321\b\305\270\262\333\322"
+	.string	"\212\376M3\246\231\362\314\016\355\355\025\227\245\260%\241\272\371\032\024\371r\223\314\027\363\214\205\024<ePX$\257\227\253,\0307\233b\3141a\300\314ip\303\312\315.\246\025\323\213\007\255\375\002\001aP<\031\3078-|\346\\\220\372q\263\251\305\344\302\363V\005f\353\346\233[z\314\t9r\363\315\302\033\273\222\232r\363\3158lg\313\033\325\3157\341\376\363\244"
+	.string	"\215\013Jn6\261\350\024\032\264\340\200\347\314\023: Wnb\271U6\264\326\334l\316\020q\363\312\005\223\242E\313\315\317\240\215\376\3157\363\315\336\3610\264\267\227Z\220\020;/x|\241r\323\215\n\230\207\260\271\354\343\212\310\233\233M6\263\315\\3\325L$r\312\224:\246\227.8\264\233\237\001\021\375\233h&Z\236\313D{C\341h\333WZ\035\360\250z4\241q\3633\210a\306\270\271\303\344a\366\260H3\206y&\"jC\005)"
+	.string	"\331\223\255\016\364\333\024\252\272\233\315\216RH7l\276\334\374\fT\350\3331\037&\0204\311 \346\017\016QS&\214\235I\202\231D\254\\\217\b \361\222\024b\376\bz\"\332\373\313\214\221\314\204b>1\217f\023\323\211E\232ef\221\233<\314\036G2\313\314!ef\230\311\304\312i\rm\251\2655\311\275\367\207\017=+\272\344n\004e\037\247\343\0205eB\023\272\244\271\304\034\263H\223\311\221\216&\023\323\210\251\304\312i\035\367\013\03750wW6|"
+	.ascii	"j\023\246\214\r3\377\246\022\261 \344\221\207\233\233\315$<\255"
+	.ascii	"\031ZP\334\374\016d\364o\036\261H\023\t\03417\273\233\017\207"
+	.ascii	"\307\007\313\017\2570\372\035\272\350wp\323\246Q\213I\336\350"
+	.ascii	"r\363;P\321\357\200\246\337\341\211~\207%\372\035\216\350\337"
+	.ascii	"\004b\3760\313\362\246\313\217\013\206KU\324\315\357@D\337\243"
+	.ascii	"=2=X#\323\3542\277L\035?\217\320\222\266\035Tn~\007\037\372<"
+	.ascii	"\025\370\341\205\312\315\331\336\212ir\335t\341\347\271Z\300"
+	.ascii	"\214V7\277\303\227\276\211\303\314\361\363\004\225\0312\305\311"
+	.ascii	"\315\357\260\245o\336\240r\367\206\306\315\346\226N\321\241\005"
+	.ascii	"\007=7\326r\330\310\272\271\365\2333n\017\323F\013wv\344\334"
+	.ascii	"l\3220k\334\264aj\2316\020\300\2657\224iC\250\316\336PB\326j"
+	.ascii	"`\255\006y\211\027X\232\231\337\201J\003Y#\323\224!\342f\226"
+	.ascii	"O\227+\311\262\233\177\254\221y\f\326\274xQf)\332{o#oK\030\227"
+	.ascii	"\f?\314Lai\321\302\274\212c2\241\241&\n\013\0277\257\256]\234"
+	.ascii	"\264#V\262\f7&\\\222\254XaV}h\357\035\2657\216\032f\330\275j"
+	.ascii	"b\244"
+	.string	"\016\213\233Uv\255\347M.\215\027\f\270\314\024f\nsJ\216i\243\212\305\322\005\216\225\212\233SqqlBrY\230\326\216\233\217\001\225\224T\351\305R\241\223\254\323\005\346\213\216\271\315mB\361\354\253\275\265\034\200FKrkiy0\361EM\234\371t\023\212\315\242\235\371\362v\363\341\234\355\310\232\22242w\356\300\231uM\270\260\271R\247\016[6N\271\323\242B\207N\351Eo5\343\326\332\362 $%\206\231\232\233\177AY]]\351E?\355\3754\264\243\314\214\031o@Ei\262\303\215\2332\316\006\031E\326\300\325\261\021\261s\341\3462\216\346\332\2023\347\346\362\315\255\3505H\254\322.\240\241o\225\330r\215E\226kJ6<S{\303(\300\033T\214\016\312$>\323\301\343\310\021\311\253\362\226\264\272\371\027L\321\321\225^,\214\2565pb[K\313C\226\202\242\026\305\215\0313%\032\275\221\354\236"
+	.string	"ymI\3159\363\022\215Y\347\210\303\212\315\177\236\240;v\254\244\334|\016f\364_\222\271E\226d\354\235\013\024 lN\350\n\315\033\362\346s\270\"F\314\331\316\2637\234\2326\016`\300\230m`\245\213\003\230\376\313/\267\310\362Kv\343\201k\303\330"
+	.ascii	"K\02148\3129*\272\224\334|\0164\272t)\275\3303:I\223\013\016"
+	.ascii	"\016\322\313\234\221!i7\237\303\224\336\262\245\f3\001\003\227"
+	.ascii	".\374\345E\016\0327\337\0029e\\\031Wf\341q\200\230%I\2417*\027"
+	.ascii	"E\262\234M\013\310\325\315\267`\314\225+%\026\236\r\254T)\303"
+	.ascii	"\310-\271\201\305\306\371\230\301\022#\273\371\026\300\351\277"
+	.ascii	"\254r\213,\253\224/\334'\373\251g\315\334\\\235\226\032\003\325"
+	.ascii	"\342\346\362\255|\322jau\363-P\323\267\200L\377e\233E\226m9\205"
+	.ascii	"\007\256\375\"\203#`\230\024\001BR\205F\327\315\267\240K\377"
+	.ascii	"\345\032\262\\\263k\036\270\240\2406H\342\365c\213\027\034\016"
+	.ascii	"\0247\337\202\027H\344\331\362q\007\201\300\2135pb\026H\351\227"
+	.ascii	"Rl\231\226V\244\2027\032\r\r\333\201\261\241\323\246\321L\251"
+	.ascii	"\003\346\346W\220E\377%\024d\t\245<\303{Ci5\200H\221\236\252"
+	.ascii	":6t\334\\\232\231J\214x-\271\371\025 \365+P\242\377\322\211E"
+	.ascii	"\226N\260\232\t\\\373E\bl\276\314]\341\211\243c\303\313\315\257"
+	.ascii	"\200\210\376\3132dY\206\311\220\236\354\027BB\300\024iS\2677"
+	.ascii	"\\\007\345\225\333[\334\315\257@\005\222\222\t\222\222\314,\307"
+	.ascii	"^\222\225L\252\034g$IR.\321O\027X\021j\242\365\205\354\346rI"
+	.ascii	"\017\233\375\306xs)f\303\030\267\233\233\017\307\306\375\347"
+	.ascii	")\275\342\244a\273\371\033\356\350oPC\2444B\244\f\033\300\336"
+	.ascii	"\366\310\345\342jk]y(R\244\f3\341\t\003\2266A@\300\304\271\273"
+	.ascii	"\271\fs\343!\022\346Uu\3637p\321\337p\006\006vg\230p\334O\034"
+	.ascii	"\312\236\240\020\343\355\t\211\020!6\016\211\013\233\211\372"
+	.ascii	"\261Elo\270\016\204\342 \271\001\344\346oX\241\377\022\b\020"
+	.ascii	"\033\347\001/-\252.\271\257\216\035\034\351N\377\245\017\213"
+	.ascii	",}\334\031<S%\030\273\273\275\370\230r\363\221\346\350\277\344"
+	.ascii	"Q\362\370\221D\"\243CGf\223\217\033\013\002sk\340\304\366\025"
+	.ascii	"\\\007>Svtq\273\371HWJ\255R\253\364\n\203*o\274\364z\331e\241"
+	.ascii	"\322tiq\363K\256\322\205\237\247l\363\206\245\312\315Gb\323%"
+	.ascii	"\2162\307\177\036\0364%Y\336n\376E\232\302A\t(Xj\030\355\202"
+	.ascii	"\f\271\271\334\372\332\177\236\036.TVd\331\370\317c\204$\311"
+	.ascii	"\224\215\0325\302\266\254\261\302O_,\264\320\270).\f3>\324"
+	.string	"\334|$\261\022\353Xe\226\336{?\035\267\013\244#PZ\036J\031P7\244\310x\231\325#\004\315\005\330\315\207S\306\370\317\203U\250\301R\022\243\204!g\310\232,;B`H\270n\334\\\276\260m\216\033\t(\353\b\333\230\233\217\324\245_\266\260\027\305E1%K\222\355\377\r\200\345\"\207\312\314\315\001>I=z=\207\301\244\362@\020E\340z.\205\020\016\227\226\206\276\242p\350\343\001\026Ou\204\212\256I\"\250\250\t\013\020\323\340\004\212i\005k*<\241\350@\020!8\250L\353\211&\r\375\210\030\370\245D\242\003A\024\321\337p\t\r\262p\nI(\236\200\376\206Kjz\016\035\b\302IE\327\365d!DQ\035\026\205h1\003\034\016\004\201\252C_\b\337\021\n\305\364\350@\020k\357\202\003A\204\270"
+	.string	"-\236\200&\235\305`z&\r\025S\f\007\202\260\300I\002+Z\002\006'\342p\304\317\365\374\255h1\250\207\256g\220\270\204\226\260\300\2118\0341\204\301\2118\034Q\201\323\251\252\"pX\017\004\241D\f\241D\364\t\231|\204I\267,\366\224\210?kO\250D,\205JD\214\266\220\026s\261\210\252\277\337\311s\"\016}Y]\211\370\207\n\225\322\340\311\373\241E\246\\\344]\355)\021A"
+	.ascii	"\251'\320\227\235\324\265\230*\241*\364\206k\221\311\267\001"
+	.ascii	"\205\025-A\303\212\256\320aX\"x\nUtm\"a\350\313@\034\256+\004"
+	.ascii	"\025\005\203\",\235H\2018\\\213CE\342p-\366\254\251z\302\247"
+	.ascii	"\210\216\200"
+	.string	"\324\224\222\370\235C\024~\200k*T-\200\252L\030\326T\310Stb\210B\021P)5\341\367\301\221\257H\302\232\n\323!\025]\211C_\252\226(\23604DbE\225\200\326&\365\\\317\021|\252Y\374\rI\b\001)\tS%\245aPh\304\206u\t]\213N+\024\235\3539\302/%\3624\244@\244\321 \013g\211\246tIh\310\003\020\253z\022A(\tS\241\220I\205\"\252\236\032~h\357@\020\276\036\272\224\256B&5\204\257CQ\351\fN@I\230.\251\247OOIbI=\213\351\217\b\375\rI\f\025\213\250\317w\232\037\b\241\003\036\200\240,\016K4\245$\234\202D\3429\324\023N@\211x$TJWhJI\024\245$\202\232N\240Rj\202\2200%qb\210\202\005P%\341\251B\006\3410]}\250\252\016Gh\030\341Sy\212?!\t\352p\035\216\370\tE\b2\371\202\247\217"
+	.string	"\367\245**D\225\364\021\220"
+	.string	"\003$ \204&\336CX\200\007\013\360\300|\b\013\020!b\001\t\020\241\237"
+	.string	"\021xE{>\367\255BTU\231|?k\357"
+	.ascii	"\037\240=\24538\001T\351,b@E\227\322uh\355\0251\200.\245\253"
+	.ascii	">\020D\321\247\206\360%q\030\341\203\241\023\303`\020P)\005\n"
+	.ascii	"\375>\b\236\352\312\204\nyz\277\017~\302\223\205\337\211\376"
+	.ascii	"\214N\f\203>@\245\024\330\373}\360\363\373\340\207\002}kz\242"
+	.ascii	"(t \210&5\204\022\321\250I\355!\236K>\265T\321_jb\250\022\177"
+	.ascii	"h\223\032<S\025-\0225\241A\"\323\bI\301\023\330\203\376RUEM\f"
+	.ascii	"{\3024\003\245\263\3040\355)1\005\211H\352O\230\262\320[\317"
+	.ascii	"bo\211I]G\200\022\213\026\374\240\301\323\327\263\252\250\ta"
+	.ascii	"\352S\177\351R)L\227\364\b|(\320\327t.i\241"
+	.string	"\342\210\340i\"8$\252\350*<\301\247j(\242\250\252\204\216\260t\2160AL*ZO\023\351\352\023!=\221\204\251\017-25\251>AT(<\201\276^\023\323\331k:\227\204\212\350\322\251&\365|j\361h\330K\213E\325\007%:\255D\0330X\231\210\302T\003j\"]O\023\251\212\3768\250\303\325w&\365\224\204)p\035\016\227\212=\237\212\304[\017\004\021\302\267\001\372\033\2228\211+\017]O\025\214B\370\245$T\340\312\013aHl\"A\005\256\272\210\256\247\n>\2257$6\221\340S\315\"\272\236j9\302\t)\250\300\022B\247\037\017\032<}\305\336\232\224\002\213=\264x\002\211D#8Q\225\205\336I\\\203P\242\323\232a=\325\036\240\037ZTQ\023\250\332+\2368\235\214\210=b\032L\322\020\034\016%\320+\327%\246\025p\261w\256\347\b\305\264I\204_J\004*\246\360K\211?-"
+	.ascii	"{'N\247\240\026\200\275\241\026\200@\337:\024\256\007\202\370"
+	.ascii	"\245D\244\t\330b/\351\227\022\315\024\354\tv\004\373K\211x\025"
+	.ascii	"\246\303\024\210L?a\252\001\r>'\316\r0\255\360K\211A\302\224"
+	.ascii	"\304*\302/%\016\241&\320\240\320"
+	.string	"\352C\223\222\214\320\337p\251\267\252(\261\t\355\255\301t\355\t\207-\244\352\020\350\264\246&N\265\204t\025\236B%2\b\323\263\004u\270\236*\212A\205\023\247\023Q\020\365\371D@\327S\r\372)\r\375\202C`\021M\207\304\025-\"\241K\351\332\343t\006\321\237\017\006t=\325\236QQ\210\022\227\206#~i\n\353\311\202\t#\3410]KL\340\207\242IG'N\247\236PO\013\300\336\001\212\305\223xb\030$rRQ\023C\037\252\366\200\305S\365\005\005\255\305\341\220\205\243u\030\364S\317\023\3520\351\207\242I\275U=\227\212D(\321i\035J}\224\204'R1m:{JL,\240?\r\302\364T\"*.\365~'\n<G0\034\006{**LOu\355\rU\337\271A\230\236JCD\352PUQ\rII\303\225\311\327\363\365\212,\234E(\321i\355\035@E\327`\232T\324\002\260'L["
+	.ascii	"\366\232\316\245\336\222\212\256\277^\0221\330\023:\3750\240"
+	.ascii	"\277!\t!\352S\321\024JpX\323\245\024\0054\250$\024A\2030=K Z"
+	.ascii	"\321\"\252\202\212*)\245j\211\023\303`P\204\340P]\205\303\021"
+	.ascii	"@\237\220\351\fb\320C\213LEMg\020U{'N\247\336\017]OU\t]\205)"
+	.ascii	"\006\3410]\317\026R\365D\205)\nk\221I\005\256F\2450=\225zP\237"
+	.ascii	"\3604\361;{\302t\251\367\003*2W!\323\320\327\013\006Q_\017\r"
+	.ascii	"\246IC\225\330\033\256L\247\2065]J\203\275\336*D\323\242\360"
+	.ascii	"TW$\3647$\301\263\2368\235p\261\247\242M)\t\035\f\016\325\f\364"
+	.ascii	"\255)\261\\\017\254`\0252\rG\240\301a\nA@\353\201 V&\342\312"
+	.ascii	"4\354-\235 \206(\252\250\211T\375e\360!\021UC\254\303\241\032"
+	.ascii	"\302g\355\361\212Jg\211aj\026{Ji\222p8\302\004:\002\272\236*"
+	.ascii	"\374\004\207\276\341:TS\030\022\016\323\242\212\232\020\236\260"
+	.ascii	"t\"\005u\270\016\227\210\226N\244\360C}B\247\242\020\003h\221"
+	.ascii	")h-\252L\022@\213L@k/\204U\2302\361\234\324\025]B\203h\211u\b"
+	.ascii	",\216\200\026\231\210L\240?\2142\005\317\f\254h1)\311\002h\360"
+	.ascii	"wB\360\\S\245\364\227A\230.\371\240\301u\035\252\300\265\351"
+	.ascii	"\\\362Y{\t\020\261\nS&}\021\"Fd\200\201\n\224\240} T\264)]\n"
+	.ascii	"\261\002\225\322`R\baz.\205\360\251\305\020 6\374\204\347\322"
+	.ascii	"\322\320'L\227z\376\363\226\224^I\332h!\243\244|\201n,\254N\314"
+	.ascii	"\256\2313P\330QI\302\333B_ZvS\220\224Y\200\232H\321\332r\204"
+	.ascii	"g\244\307\031\0222nX\204\031\271y\310\020^\021\006D5\311\032"
+	.ascii	"+B\304\2243f\026\204\210\321\003"
+	.string	"KR\320\201\225f<`P\262\250"
+	.string	"\303Wr\022+\026Qn\276"
+	.string	"\226\350\036=xA\204\370,\001r^\020$P\350\334n\346\3758\233\023\035ns7\363|\234m\315I\031 \002"
+	.ascii	"\343u\361\272x;\354\325\325\007`ssu\274\035<\035cAl\330\320\301"
+	.ascii	"\373J\222\344\013\230\362\355\210\364$\f\007\317+\367\370\341"
+	.ascii	"*\363\246\314\315\027\300\016}\034\333\373\030d\"\t\242\302\215"
+	.ascii	"\253$\013\252\313\"\206*G\236s\247\315\231\333\315l\274\033N"
+	.ascii	"\214{\357\241\2373o\324\244\334|\001p\351\237\267e\306Q\203\203"
+	.ascii	"H\230\233yY"
+	.string	"\274,^\215\027A\001\361\311\252:S\243nk\305\360\360\363h\234W\303J\231\"\315\233\271\233yZvS\312\302\334\314\233\301\323\322\305+\307\006v\372\347\311\2709\314\"_\352`\304`C\2026;k`\224^\246\320\350\341\365\"\273\341\035\225\004\206\030\250\003rUZ\034(1\nI\206\214Q\210Ff\224ts\025@0h@ \223\213\267E>\023\300\202\312\313%\212\036\006!B3#\022D\222\202\202\2440l\007 `^\004\0227p\241|\347\220\373\304\265\341\376\030.\346\342\242K0%\220\b~\205\356\351\261=\245\207`\264\324\271L\007%KE\226\353\270\263\267\007\245ud\001\\19\315\362\026\354\364\257P}\347\320L\277\207\301_l\365\020\312\215\007B\b\202\036\244\237Zsp\337;\032j\003\362\2638O~\266\3563@\204\305<h\201\033\020\370$\210\307\3612\004\025AJ\376\310zj6H\006"
+	.string	"\024\242H\2419\3674\251\0339A\256\354\357\001kP\005\020&5\361#\022/\364(\356\027\f)\350\215\026K-\245\261\020,\320Hs\260\rP\035\005+jYb\336)\247\023\224\265\252\320\001\233b\235\217\020\226L\350\025\321\256"
+	.ascii	" \205\310O\t5\320\026S\241\253_\350]i\241\016\325\335\362e\234"
+	.ascii	"\235pi]\300p\356P\321`\355\321\035a\262\276\\\370\2154\201\346"
+	.ascii	"\327\266\212\021r\240\310b\376\305\031\n_\337\207\300&\310{~"
+	.ascii	"\215\034\326\322\335\023\303\200\246\305|v\031\202r\332D\203"
+	.ascii	"a\200\206d\321f\367\3043\303\272\254L\256\324\013B)\355\3713"
+	.ascii	"\342\006\201/\304\204\002\246\\\306\317\242Fc\305Mm\360 \250"
+	.ascii	"\b=MhL3\240\361\024\202$\310\277w\351\022\302\345<\203'\210\357"
+	.ascii	"[AJ\310R\035$\256\355\255[\254H<\260CW0\200\nrw\020|9-\224\337"
+	.ascii	"\324lqX\244 c\225K\352\257mv\210\004\024\311=q\212\240kc1\033"
+	.ascii	"0\247\251\336\337E\265GN\375\022\241T\372\347\361-\231\221\233"
+	.ascii	"}j0\326\200\360\337\215\217\273\325\002C\222\270B\177}tG\003"
+	.ascii	"\221\310Z\260\201\3476\021\270#v\334\333\225\324}q\362$\307\032"
+	.ascii	".\207m\333\341\326\\6y1\271`\265!m^\202N\370\304\211[\240m\236"
+	.ascii	"\341j\002X\277\321\n4:yv\361\331Wx~\363\002\205\211Y\356\260"
+	.ascii	"1\256h\177\r \030R\017\2452\346\235\351\027r\215n\244\t\251\206"
+	.ascii	"\017:\213ShWIj\3274\tq)\246\nA\200Fe<Q\257yu\021\212*\314&\205"
+	.ascii	"\212\327\220\251\306G\n\301N\335,R\215!\003LC\201\355\021\266"
+	.ascii	"L\231\311\203\022\024\277\205\307*\337\\\b\266U\334\270\336c"
+	.ascii	"!\026?A>\354Y\252\310\t\254\364\353\330\367W\210b8\250*Q\265"
+	.ascii	"\021\241\307C+\035|\203g\241)\324\353\230\033\243\377\357\360"
+	.ascii	"G\373\273\300\013\202`\303\314h\2202\261\213T(8\334?\251f\232"
+	.ascii	"\314!\035)~\330\202\203\307\353\300\337\b\256\367Q\214qnH\026"
+	.ascii	"\275\202\226,%|\254\344F\223\331r\2558'\025F\202+3;\210\262\245"
+	.ascii	"OT2\016D$\\\314\224\302e=T\257Sx\341\257\300~\264b\341\363\032"
+	.ascii	"\023\321tnd\r\350\231\303m\211Df\204\244\030+{6\335&\tBt\346"
+	.ascii	":\f[\22508O\212\204U.t\027\320\3201\367\314\364\345f\313\002"
+	.ascii	"\270\033l\357\202\031c/\033qvv \220\365\375B\3562\211\216\204"
+	.ascii	"\377\356\202:\245}6\316\327\b\274\374\200D\002\2318b\274\031"
+	.ascii	"\265x\233J\252S\206\325\313\217\260\376\203\245\212\376\301\271"
+	.ascii	"\3061\021\272i\276[\004\200\004\226mV\305\336-\366\377\230\r"
+	.ascii	"AE\361i\217P\213D\217Mn\001\3474\333\267\203HJUA\336\325\261"
+	.ascii	"#N\034\245\240\003\345\245\367\304\030k\002\ba\3132i1\t\236\247"
+	.ascii	"\fv\032\317.[\272X\250\244\370\302\221f\306\345\316w:\346m\306"
+	.ascii	"\207\221|f\325\225i\323\272\001\302\320D\317\202.8j\266S\305"
+	.ascii	"\017\375QX\220N4\2228\206s\375\036\270\0301\303,\265Z\267\322"
+	.ascii	"$\261\260\272\007@\207\027\377[\300\013\013\341s5\235q=f*\262"
+	.ascii	"\364\"\017\217\f^\313\017\230\026F\n\357\226\337@\213&'\245\354"
+	.ascii	"c\301\341r\3045v\035Wj\331;q\251g\035\026\370V[\371\\\025\321"
+	.ascii	"\213\271B\243\242{s\\Y>N\274\302\t(\212\211\337a\001\2531]\322"
+	.ascii	"\031\364\331\255\355\2239p\227\001\202\356\223\315JC\\/\301k"
+	.ascii	"l\027\252\252\202[\340\340*[~\323ow\231t25\350f\360v\272\277"
+	.ascii	"?\371\262\177\301\333\244\215mvB\271\002i\313\375\350n$G\311"
+	.ascii	"\364X'\361\007\320\205wa++\032n`\373b~\273\255\275E\365s\342"
+	.ascii	"$Tc\357\250K\311\347\2746wY^\267\275\235\262\353m\214\3615\323"
+	.ascii	"\b;\313C\204\021\275\350\304\240QB\177+\201\342TO\nR`\340\257"
+	.ascii	"%\347\235\035S\032\032\307d#\351\277\313~+<K\332\336\021\f\246"
+	.ascii	"@\264\031\316\233\346\t6\324\312d@2\335\331\022\240\321\332h"
+	.ascii	"\255\355\3503\221d5\250\360\357\337\272\324\035\274\356:\223"
+	.ascii	"-7\336\225t\340\263\363{W\235r)\202r\247\027\002\323\227\244"
+	.ascii	"[\376Q\217\305\201M\351\240j[o\306\242W\344'\267YB\322\270%\201"
+	.ascii	"\361r:#&&\361d\272B\364\331\244\215\333\246\261\217\370\3676"
+	.ascii	"\247V\211\022\017\212N\2757\220\261\332\355\240vez\027\323\215"
+	.ascii	"\350\311\021\234\233I\325\313x\226.\317\205\227\037\227\360\250"
+	.ascii	"\213\353\304\367<9r\3358\270\365S\026\223xD\2223\3278\241\272"
+	.ascii	"{\237(\037E\273\222\357m\206$UF2N?O\343<\235TNY!\242=\036\240"
+	.ascii	"\004\217_\364B\370\253\252f\217\202x\267\234\262\335\227\227"
+	.ascii	"\314\b3`\310\002\271\313\217\220(\353yk\254\024\241\346ONK\362"
+	.ascii	"\2430\001\211\223\340\303\t\211\353\371\207\317\224k\334\341"
+	.ascii	"\b\362#+i\2747\261\033\321\367\240\002\025\2117\031\263guWJ\\"
+	.ascii	"\032\367\265\025\232\\\325\024Q\311\037V\220\237\325\031bWi\301"
+	.ascii	"r\335\034-\304\002\366;\305\334\202)IU\266\250\341\t#\206*\222"
+	.ascii	"}6h\274\201I\030\241\013\003\020\254\"\361\304\217\245&I,\243"
+	.ascii	"[\025\341\242[\3323b\023%\262<\270\315_\220ic8\352\0210\251|"
+	.ascii	"{(\374\221\r\273\344\320\231\377B[#\2734`p0\2204\270\320\334"
+	.ascii	"F;P\360\317\215\206;\023x0F'2\361\356\222\023B\013\002|\215U"
+	.ascii	"\352\006\264\351\355\234!\320\334)\020\346\3368d\350\360bd@Z"
+	.ascii	"\243\242\0064\246s\006\356\"a\304zB\317\007Wm\343\2274N\370\205"
+	.ascii	"\347\224\312\303S\247X\372\037\016&\303\353\270-<\251\365\364"
+	.ascii	"\320\313\277\213\024\032.\022\016\272T\300\341"
+	.string	"\307\270\345|\211\374K4\370\220\030$\231\005+\f\243\233c\020\022\344\237\3654\273\370{\310\177\201E+\274q\316\352\214;\212*Z\333\271\277\351\3625\0178\035\321\031\361/\303;*\341\214\017\254\016hC\334\315\306d\f_\311\324\271\346\240u\r\3242K\224\341\005y\250\273\307<f-m<\351\007\021\214\241L\262QWw\005\240\200\020"
+	.ascii	"\341\377\f\020"
+	.string	"\3246\276\213\017\262\312\221\rU\361\237\345\260Y\203\255\261v\206\016\277\r\026\016\335\251\313\277\354\277n\344\241\316K8\323~\302\207\002\r%\013\247\313(\205\0302i2J\n\263\241>\234\r\351<e\b\004\230$Sy\373B\002\267\205\037\027\307\036\002\360W\245\nE\220u\343\013\030\350\214\231,Qcm\013\342\275\3164\204,;\027w\300\321\316\371:\237\305\304\336\362\273\305l\221H\335\366\375\313\tf\251U\340\200*[\006\305O^\323\343#\314\356\373\354~{\030wB&\366\253c\200\227z\335\023(\2043,\360V\bM\200n\346\031\f\036\240\365\246?\235\313\212\342s6Xn*\271\265\273e\376\002\177\300\247U\231P\274\031\3463@\027\304\315\211\240\356\362S\343zX)f\323\307\313\np\314\365R\261@/\313\331\236\351\333\214\260\217\367\315\322%\\\325\265\333\003v\027E\236;fz\257\277\034D\367`"
+	.string	"bG)\006\264V,\325d\304i"
+	.string	"\247\333=$=\004g!\030\262\355\316\330\320e\022\315\337\005\312\320\265\0010\254\2613\"\267\244\027\215\036|1\021v\230]r\376\221\352\212*\tk\236\270\253\302\325H\336\366\225\n\222v\312U\363\347h\360\240\235\b\225\200Y\301&`\256,\362a_5\205d=\002.\370\320\235\033\321\333\003\234\215\016\313?\261@W\272_I\303a\210\215\240\344%C\342\374\331i91B\363\261\001\332z\261\0201\311\314*%\211\\\242\245\003\224\246K\037X\254?f\007`\314\"p\311(j\333\311P+`-\2651\305&\004\302\376\370\210\007K\221\204\232\364 _\304;d\177\204\255p\343\266\353\250+\224B\026i\333\031\260F\307P\2447\f\364!\264,\260\344&\253$\342\243\350iZ\363\001\345\257c\247[A\244\315\002\022\231\227\357\245\246\350\321\326G\265\372x"
+	.ascii	"\"9\260\210\2558\341\t\254L\337at\263\206\026*t\237L\t*\001"
+	.string	"\013\245\304!\202\263\006\\(\323\352\320\001\354\251\263_{@\246\311ZQp\252\330\345\254]\322\031TD\254\267\243U\217\002\357\316\030RT\241I\312I\376u\323\315~\375\323\314%\331K\253\274\336\253\315\273\365\231\207\376\320\262p\340\220\277\215\006\340#H\021a:\337\277\272\370h\265BSK\224\364\364\364\310\3464x\307\001\317\030\234\b\272\305\003\272\024\244\334\016\273\303. wP\366j\204]a\316\333u\351\214|M\237\321\265\222/\202I\307e\354\226\034=\021\347\317\036$\274\350\370\341\332!\301h\232\364X1\242\216\240\275\370\f\200P\\H1~\311'\211\234\0379$\314\222\372\317<\242e\241 m\031\337'\316-\03528\365\"\310F\t\b\204\326z\003Y\201\007a\244o\256f\232/\274\bx\234\315\252y\304/\246\205L\277\370DT\231\370\004\320\327x\251\265\346\037\3223\350h\354\330\204C>\264\213"
+	.string	"\300<|}\031\035\211\204\322\030j\033\215\315J\332\220\362\233l'}\257\234I\251\311c\303\321>>##\340\307\002K\034\nLS\276\254\371\353,\304\313{i\310-\320\313\345\017V\325\300\to.u\202|\253\316BM\276\357\"N\201\324pUJN\336"
+	.string	"&\3662\356$\332\3030\360\314Gq\004;\276\312bQ\t\027\223\366\320\371\003A\252NUa\200\321\r\241Z\377\247>\035\231\334JY\257\350M\323\017\205T\255T\223\363\201\002!8\250d\275\267~\340\352m\025\360\216$\r\340M\367\226\277\035\323\265\335\220CD\237:\266\251\231\031\332\374\221V\275l:g\301)\335?\246\270\262u\337)\300\2039\263\273\301"
+	.string	"`c\373"
+	.ascii	"\346\032\254G~\367f\271N\377\"\336\337\035b\034sq\267\365\032"
+	.ascii	"\017@d\020Gs\334{g\303\321]\302\363l\343\301\373\345_7\331\303"
+	.ascii	"\364-\360\222\362\351\341\007\020/\345i6\271l\025\002_\227\353"
+	.ascii	"\235\037:\256\243\242\335\350\226\262{\264\020\007J9M\254\235"
+	.ascii	"\034\314#\353K\254\334\245\216\373w^?\200\353Gyc\241K\317\243"
+	.ascii	"~9\316\03497\337\t{\240\304^\304\315\022\341\025{\253\260o\247"
+	.ascii	"\204\036c}\024\375V\273I\304\257\365>w\333\333\203\237\257\275"
+	.ascii	"\2074\327\320\233\3021\344\356\006\374O<\371d\034\313\310\013"
+	.ascii	"\305\207\210\364\364s\323\317N\246\263\b\375\242;\316|\270\362"
+	.ascii	"\302\376\227\326\342p\337\355u\230s\336\255$\363r\363Xe\017\323"
+	.ascii	"\234'\302C\255\257\246\035\375\260\323\211AE\034\243\260f\233"
+	.ascii	"\275\367\037\241,\312\360\346\376\264k\t1/\244\354KdvS~\036\201"
+	.ascii	"\234\231\342u \023\335`\211C\210+\3704@ \207\3553J\370s\215\267"
+	.ascii	"\235m\307=\226\351S\317R\177\374\321w\005"
+	.text
+	.section	.gnu.lto_.symtab.def4c59873363d93,"e",@progbits
+	.string	"motorOutputLow"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"pgResetFn_motorConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"currentMixerMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"motor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"mixerIsTricopter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"applyThrottleLimit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"applyMotorStop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"convertExternalToMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"convertMotorToExternal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"mixerSetThrottleAngleCorrection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"mixerGetLoggingThrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"customMotorMixer_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"motorConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"motorConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"pgResetTemplate_mixerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"mixerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"mixerTricopterMotorCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"calculateVbatPidCompensation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\003"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"pidUpdateThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"mixerTricopterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"isFlipOverAfterCrashActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.def4c59873363d93,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
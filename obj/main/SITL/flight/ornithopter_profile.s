@@ -0,0 +1,559 @@
+	.file	"ornithopter_profile.c"
+	.section	.gnu.lto_.profile.7a4f631b4fbaa85a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7a4f631b4fbaa85a,"e",@progbits
+	.string	"(\265/\375 \311\005\003"
+	.string	"d\004\275"
+	.string	"\f"
+	.string	"\322\370\322\200\f&\002"
+	.string	"\002\001\001\350\300\306\254\005\002\240\342\234\212\n\003\376\307\327\353\f\002\004\005\006\007\b\311\225\330\363\007\t\322\255\311\207\002\006\002\002\002\003\002\004\002\f\274\336\354\360\004\r\240\342\234\212\n"
+	.string	"\n"
+	.ascii	"U\020\005\256@;\250 \003Ph\312\005\221p\227\251\035J0\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.7a4f631b4fbaa85a,"e",@progbits
+	.string	"(\265/\375 +\r\001"
+	.string	"\270\037"
+	.string	"\007"
+	.string	"\001\001\001"
+	.string	"\003\003"
+	.string	"\003\005"
+	.string	"\003\006"
+	.string	"\003\b\t"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"6G\275\204\261\001,"
+	.text
+	.section	.gnu.lto_.inline.7a4f631b4fbaa85a,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"\025\004"
+	.string	"b\007\027 \220)\351\277\375\217\352\377\207\031\261\207\205h+\007\345\006F\377\377m\030$a8k\330\237l\271S\377\013%m\t\374Z\f\322v\260\340\017\242\341\312\210\215\266\315\237\377h\305\270\343b^\nF\224\003X\202\344\027\262s\375s\"\266\355=c\216\224&\007~1\366HiR\370\300e\b\016"
+	.ascii	"\270\272\266T\340V\330\025\027@\262\373T\026:2\327\001$\003H"
+	.ascii	"\001\310{\024b\2270\230\031J\001\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7a4f631b4fbaa85a,"e",@progbits
+	.string	"(\265/\375 +%\001"
+	.string	"\340\037"
+	.string	"\007"
+	.string	"\001\001\003\177\002\001\001"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	"\b\006\t"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"m\n\266\001,"
+	.text
+	.section	.gnu.lto_.pureconst.7a4f631b4fbaa85a,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\232\004\001\204\004\003\204\004\005\204\004\006\204\004\b\230"
+	.ascii	"\004\t\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7a4f631b4fbaa85a,"e",@progbits
+	.string	"(\265/\375 C\255\001"
+	.string	"D\0027"
+	.string	"\003"
+	.string	"\001\270\006"
+	.string	"\001\002\007"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\b\t\002\002\b\001"
+	.string	"\002\t"
+	.string	"\001\002\n\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"-!.\007Pl\350\254"
+	.ascii	"[6\200\005"
+	.text
+	.section	.gnu.lto_.lto.7a4f631b4fbaa85a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ornithopterProfiles_Registry.36.7a4f631b4fbaa85a,"e",@progbits
+	.string	"(\265/\375 \244\255\004"
+	.string	"t\bb"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	"\005\001\212\001\202\200\200\374\342\303\217\230\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\304\030us\316\007uq"
+	.string	"\005\001\006'\001\314\243\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"(./src/main/flight/ornithopter_profile.c"
+	.string	"\004"
+	.ascii	"*\303\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_ornithopterProfiles.37.7a4f631b4fbaa85a,"e",@progbits
+	.string	"(\265/\375`\363\003-\024"
+	.string	"\326\243\201I\260RN:r\021Xz^\210\216\240\016\215\317\375D"
+	.string	"\254\224Uz\333x\312\307\321\025^\374\342\026\033\304\217\324b\265\017u\323\212\360\204xw\274\221\355F\372q{|\336\220\363\302f.\017\226\234SP\301\0375B\266\334)\005i"
+	.string	"f"
+	.string	"u"
+	.ascii	"\366\251\336\342\366*\240\013\250u7d\253\326\036\0023\0309\350"
+	.ascii	"\336Q\302\203#7\t\017\372f\223\021\020*AA\004\243\254\265\212"
+	.ascii	"\353dz\332\273\351\274\035\244;o\276\325'\211\262\"]\320AZ\342"
+	.ascii	"\233*\021@'D\023$i\371\214t\271I\245\216\276\307\372\344\n+\322"
+	.ascii	"\035}\316^j\255\236E\272\021wx\3335\333/6U\020\273\037Zar\347"
+	.ascii	"\b\277s?\244\"7\177\246\373=\326\017\340\312\210\212\340\346"
+	.ascii	"o7I\313'\265\313d\367\202\346\356|SI[\336\235\235\362\252\177"
+	.ascii	"\366\253\233~z\347\364\234\323/@\3425\200G\255\"~D*\030\310\225"
+	.ascii	"\342W\267\337\363\261\\\374\305\355W\356\2425\313\001\025\024"
+	.ascii	"\220Z\353\312A7\0309h\200\236\304\366g<\013\037+/\\,\306\211"
+	.ascii	"\207\341>\231\246\262\306\355\f\367\021\241\211\346=`\230j\016"
+	.ascii	"6\263\343\331|\207\204\245\222v\035\020\226x8\377rQ*\307\343"
+	.ascii	"\210Q\342\335\270\315\341^%\200\235\333\2209\3013\371\255\030"
+	.ascii	"\023\245\206\016\247\001\203T^\306m\237\317\230A\342\225\374"
+	.ascii	"'\264=<\353\007E\254\326\272\300\217\361\001\304\311\023\324"
+	.ascii	"A\037(<\310\362$\0047\177\236;\333\343g\266i\241\351\2147d\255"
+	.ascii	"\207\246F\263\365\2209\266\221\247F\212\266\034\234Q\347F\344"
+	.ascii	"\031kvD\233\232\217\330\242b\262\207V\023m$Y\023Iz\365\273\363"
+	.ascii	"\255\376\200\005\030ns\3402y\366\265)\273cs\345t\215\334\025"
+	.ascii	"\322}\325\325X\2109\344\264\326Z\251YN7eg\\aCJ\271\371\263\312"
+	.ascii	"\204\007\031\243\312\023\n'\333\020U\341?\\\240\002D\250!$e\033"
+	.ascii	"\021\222\211D\"R\330\3026\020\003\0212I\033\021\320DG\210 Q\274"
+	.ascii	"=\006\346\273\246D\234o\263\305P\352>\236\200\233\206\307\250"
+	.ascii	"\177\230-\b\367\rqS\b3<\220\337\200$\220a\306\030\214\332\343"
+	.ascii	"iR\026\354m5\375\013\352\370o d\232\324iQ>\264\307T)0\357\231"
+	.ascii	"\374\027\246G%>\017L\273\262\225\266y\252W\001o\261\360\365\355"
+	.ascii	"\233\330x\017w8\226\006"
+	.text
+	.section	.gnu.lto_getOrnithopterProfileIndex.38.7a4f631b4fbaa85a,"e",@progbits
+	.string	"(\265/\375 \360\265\006"
+	.string	"\242\f/3`m\322\001@\203\300\r\364&\260\20338\227\001\236\323\276\247C\005l\315Z\017\275w\245\365%\3261\365Z\303\344\214?\216\255\257\230\r\bn\024\211R\246\024\276T(M\303\270W5<\nV.\003\333\3469\0063\017M\203a\233\346"
+	.string	"\301./\202U\022\354*\3521\350\334c\323\265WQ\252\301G'\354\177\034$\372\034\226\340\344\255K>'\340R\352\300\305'G\366\345I\305\260\017\260*\262\235N%\310(\030\331\005\215R\366D*\351\260\335\261'[\024:\216\2776@\026\023\212\020\224\335\213\251\306\3433\372\367\370\201\b\211\025\362<\005\030v\327i\205,n\275m\004\333\013\266+\002\b"
+	.ascii	"2\003\316:#e\b\3055Q.\002'!2\270s\235v>\001"
+	.text
+	.section	.gnu.lto_currentOrnithopterProfile.39.7a4f631b4fbaa85a,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"E\n"
+	.string	"\206\323F;0\345\2521\036\276\366!\021Lc\2400\241\226\037\252\233M\004}\001:\252E\346\231}#\362o\217\273\233\276\356\343\363\375c\214\210d@\002\345[bq\252\032\302.X\335rK\231R5"
+	.string	"2"
+	.string	"6"
+	.string	"!\027A9\245p_.S\013k\006\300\332\373\371\376\240;\035\270Aw:;\236\272L\371\227\235\201f\033[\026\227\002\021\326Z\313\261\345\272\347m7\330\326\330O\b\366]\311\311a\237\263s\303\2664\307I\313)}Z\020\203\340b-\306M\200\255\321\225\230O\362{\372\210\027>@\254\265\336\251}\262\275\323\333(\333\363\003,\037M?\001'\314\313Z\0131;\215\302\207\235:Tkw\312\315\337;x\304Tl)\031\237r\2365\340%7\251\360a&\225\344\307S\277\324\235~\022h\250\344-\376l2\034\020\330\251\341H\023r\304Q\375\210\240(\254\237\370\361\200\240\316'\002'B\337&$}\231\007\327\021'\374\304Z\303\317\273\252\233\233\227]\342\242\026\340E5W\376=\212g\006\020"
+	.ascii	"\224\251\2022\027\0022\035\323bf\233\350\355\264\271\250\252"
+	.ascii	"\0344\265v\204\022\3175\374\210\t\367Th\200\n7\334\225N;\311"
+	.text
+	.section	.gnu.lto_currentOrnithopterProfileMutable.40.7a4f631b4fbaa85a,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"=\n"
+	.string	"\206\223F;@\305\2521\365g\327\322T\246\035/\225\027\263\215\024\230\024hJg\r\222\230W\313\005D\233\273\003\335\335\270\356\2103U\215W\025C\316E\340h@\211\3071S\f\306\261\345\2262\2454"
+	.string	"1"
+	.string	"7"
+	.string	"\037\007)YD\270\254U\004\r\005\233Y{=\337\037p\247\0037\340N'\307\305K\321\377\353\n\262\225Quq)\360`\255\265\034U\253{\336\366\202\355\214\375K\366=\311\271a\177\263S\303\266\364\266I\313)}Z\020\273\250X\233\252\t\260,\024\305\345\213\374\222\036\342\204\327\314Z\333\235\332$\273;\275]\262;?)\037-.\373("
+	.string	"\226\265\326\001\366\030\205\337:\365\247V\356t\233\277o\350p\235\0040\301\370\224\363\250\001\0379I\205\337\262h$?\236\372#\356\364\223 \303$k\001\356h0\033\317\307\251`(\003n\302P\355\204\037\b\254^\330\231\370<\034\017\364I|<\r(\3620\f\256\241\r\350\205\265\202^wM\3676\377:D\312\203\326b\232'\377\276D\244\001\020"
+	.ascii	"\224\251\2022\027\0022\035\323bf\233\350\355\264\271\250\252"
+	.ascii	"\0344\265v\204\022\3175\374\210\t\367Th\200\n7\334\225N;\311"
+	.text
+	.section	.gnu.lto_getOrnithopterProfileIndexMSP.41.7a4f631b4fbaa85a,"e",@progbits
+	.string	"(\265/\375 \362\265\006"
+	.string	"\302\f/3pk\322\001\220\365\377\003\200M\b\271\364aD\205\214!@vB\244\336Zk\355\350\276\031\255g\260\376\251\342\352\377E\350\007\356\240\352\3535\240\215X)S\n\276T&M\303\270G%\274\tR.\003\333\3469\0063\013M\203a\233\246\300\300.\257\201U\n\354\250\3511\350\334c\024k\257\243\324\201\217>\330\327\370F\364-\354\300\311W\227|\316\344Rj\200\350\223\227myR'\354KVG\266\323\251\023\211\020\201\216]\3205\262 \322\307\205\355\216M\261\305\240\343x\253\002d\271 8Dv-\246\024\217\317\350?\343\022\f\221G\025\362<\001\020v\327Y\205\"n\275m\002\333\007\266\253\b"
+	.ascii	"2\003\316:#f\b\3055q/\002+!2\270s\246v>\001"
+	.text
+	.section	.gnu.lto_setOrnithopterProfileIndexMSP.42.7a4f631b4fbaa85a,"e",@progbits
+	.string	"(\265/\375`j"
+	.string	"\215\t"
+	.string	"\306\021B:@\345h8\240\336\372\377\374\372\313\346\313\233\355\022\320\220\272n\235\221\003p,\323s\266Y\253\203\341}\017W\202g\210\315$\313\220z\345\316\376\313\344Q\303\261\376 do)S\n."
+	.string	"0"
+	.string	"0"
+	.string	"&"
+	.string	"vw\323\216\207\3174C?\323\031P\211\246g\032W\0021\225\025\354\356I\236\027\"*3\323\331]\247J\314\270\265\333n\260\275`[%,\373\256?5LH\313\346e\027#6`aZ\n\210\355klg\332\b\t\341]%\353.\307\n\312\356x`\005\201k\016m\227\217\036\373\327\312\"\250L[\352\217/)\371\037\246 \345U\327|\022\346ZF<\t\260q\312X\356\256I\265\245/aR7\253\221\027K*\005\330\243)\265e?[\r\025\034\204\250\323\354\341p\241\356\343}#\207\217\003G\036\b\354D\237\267\201\240\210.\364\331D\335\203\304\346\371&6\216\201\275\021\367m\240\347}\233f\334g\253,\006\021\330I\003\016"
+	.ascii	"3\241\007(0\203\267P\270\003\201goh\343\332 \202kb\035\023\262"
+	.ascii	"JM\006\356\0220`Q\345\266\253\350\001"
+	.text
+	.section	.gnu.lto_updateOrnithopterProfileFromBox.43.7a4f631b4fbaa85a,"e",@progbits
+	.string	"(\265/\375`c\002e\023"
+	.string	"\026$\177H\340\322&\035\223c\216g\222\354\326\022[K\225\200\n\324\321[\264\034\3640\237\026\037\217p\323\265\302j)[\355h\321\367U\033\377x>\003o{\r\322a}\016 \216\332\2359\326\3129\341\205\beu\331\275\367&r'\031i"
+	.string	"d"
+	.string	"m"
+	.ascii	"\227\002^`^\306\023\230\227\273\200\201\353C`\355\022\364\b\304"
+	.ascii	"\b \335\241\202\313=\251\227\353\332]z\370\323\267y\220\031\t"
+	.ascii	"\351\356\216C\334\365J\247\3448\272\366\024\345\2043\263y-\371"
+	.ascii	"\260\323s*\2337\322B\211\t\r=\221\333p\0160\213q\b\272\373\266"
+	.ascii	"\307\234\031,F\212\322\335\033qf;\337\323w\227gw#\354\306\231"
+	.ascii	"?\202\251\335\261\006{\243\267\360\366@\227KA&\036\347r/3/\317"
+	.ascii	"t\026C\210\350\025o\273!,rm\367\\3m\367\341\267\322\017}\345"
+	.ascii	"\213\276\234\214\313\\\334"
+	.string	"\310q\017\200\356\3440\320\243;\303mH+I$\022\037\372\303\277\350\274\373\2538\213\333V\244\310\347A=\321W\270\036\326\324\226Qe6\021(5\335M\231\266#I#>>\271\266\"6\016\350\354\220\\\333\323\2020\260<8['\226\"e\216sN:^3+\223\350\244\260\335\210E\246e\256\374 \262\246W\274U8\214T\355n\007{\027\177\241jY\255\346%\363\t\211\343\3104\035j\310\2328\256\305\356\266a\246\r88)\223\\\270\331p\304\"\323r\007\347\231\362\177\334\370\300vB4+),\224K\212\276\240$\244>I\243Za\245\314\250XuS&\252\227\025\213\367\305\250|\252V\214\347\322Z\261>\257k\271\264\254^X:\326\n\005\323\245>\231\316$\301z1\252\257ky\336\327\211\204\257s\315\264=I\242\214b\306\203\363\204\203\374OP\023\267\007\247\344\034\b<J/\206\255\344\375\214\323"
+	.ascii	"\367@\253\202B\315Kj\303C\250\247n\0300 \220\002!\271\254\003"
+	.ascii	"T\204\266\2250\352\201h\f?Q`\276\263\373\271J\363l\330RC\262"
+	.ascii	"D\356v0\222a\332\330\t \321\266\205m\304\266\225\321r2\362Y\362"
+	.ascii	"\3259q\027\271\3229$\254mc\264\323$u\333}-\256\245Q\276c\202"
+	.ascii	"=\344\252I@\0200!\223\007l\037\220g1\366-3\026cI`g!)\305kl\227"
+	.ascii	")\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7a4f631b4fbaa85a,"e",@progbits
+	.string	"(\265/\375 \365U\004"
+	.string	"\344\006\361"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002%\177\013\320\231\263\346"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002&\177\f\200\200\200\200\004\200\005\037\r\200\204\001"
+	.string	""
+	.string	"\003\002'\177\016!\017\201"
+	.string	"\002(\177\020\002)\177\021 \022\200\003\002*\177\023+\177\024-\025 "
+	.string	""
+	.string	""
+	.string	"\005,\026$\027\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\"\030\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013"
+	.string	"*\302\001\337"
+	.ascii	"\257\2015\270\372\b \r\330\201\250\177\320\030\320\350Z\023\017"
+	.text
+	.section	.gnu.lto_.refs.7a4f631b4fbaa85a,"e",@progbits
+	.string	"(\265/\375 A\355\001"
+	.string	"D\003="
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\002\001"
+	.string	"\002\003\004\003"
+	.string	"\002\005\001\006"
+	.string	"\007\001"
+	.string	"\001\b\001\007\002"
+	.string	"\003\t"
+	.string	"\n\001"
+	.string	""
+	.string	"\013\006"
+	.string	"\001\002\f"
+	.string	"\003\f\002\004\002\r\002"
+	.string	""
+	.string	"\002"
+	.ascii	"-\244s\225$"
+	.text
+	.section	.gnu.lto_.decls.7a4f631b4fbaa85a,"e",@progbits
+	.string	"(\265/\375`\360\032uy"
+	.ascii	"\272\310@,R0\222:J\007i\002i\247G\007\255\312\274p!\257\300-"
+	.ascii	"\031\201SR\257\025\311\t\rl\314lM\360u\236\204uR\335\016\200"
+	.ascii	"\b\240?\267\013\332\376\211\335.\340.\346n\262\347\356\252\252"
+	.ascii	".\b\263\030\355.\270\273n\366\313^\271y\362\303\266\r"
+	.string	"\262\245L\001P\002\265\002\310\002Z\3344\3219\3367\270\354?S\314\313l\260>[\2564\372\237/{6\241\253sslB\367\037\035\266\3219{\364i\217\236\261G\273\330\243P\354\321!\366\250\r\373:\307\366TSq\263D#\231ECrS\344\366\370`\317%t<\307%t\257hV\351<W\242\210\311\003\253H\313q\037\0205\360\310\3055\312'\251\250\215\232\231\266F_\245\330sY\232%\314\303\317Tf\314L\017bdd\310\304\214\241\2624\333\362EK\031/_\320\270\234yYc\013[\252\235\231\022f\207\262%\032g\0238\354\306w\030\017\303\261\034\266\303n\370\311?p\034\353\341<\374\306u\230\016\357\3417\034\207\233<\207\331\234\333\330\2073\363^$\332\317\324\245\313\003k\220\224\2659\243&\t\247\375L`8\013Q\275W\310\226\345\275\367*~\326\341w@\005\317a&g!Au\257\220\256"
+	.ascii	"|\370\362cG\334\275\367D\322\t\264\b\231\017;,\241\3576\313\\"
+	.ascii	",B\207\324i\366Mf\337J\354[\210}k\331\244>Z\2457\273\304\306"
+	.ascii	"6\320\203e\201f\317S\354\315\216\330\247\001\261/\303W\366\316"
+	.ascii	"\031\354\335\204\366O\027\366q)X\256\302V\270\231\304X\356\200"
+	.ascii	"\212\327\243\225Kv\357-b5T7\272\032=\t\366|\345NSW\305\225l\r"
+	.ascii	"w\216\223tok\304H:#\026\241\3431&K\252VW\311kv/\363h\b\016\237"
+	.ascii	"5\266F\317d\021:\313H\272\031V\374\\F%\304\217\376~\373\317\337"
+	.ascii	"p\204h\310\204\376V\003\376\204\377$~\016\203\362\177\350\357"
+	.ascii	"\263\034G\377\246\362\377\315\3776\377\355\374\277\363\277\316"
+	.ascii	"\3778\377\341\376\273\375\247\363\037\317\377\037\376\347\371"
+	.ascii	"\037\367\377\371\377\355\377\234\377z\376\273\371\017\347?\226"
+	.ascii	"\253\360\244\277\245\374l\344g\260\237\225\374\214\344\347\257"
+	.ascii	"\237\223\374|\303\223\237\267~V\376\354\345\344\177\321_Y\370"
+	.ascii	"y\3713\223\237g\370"
+	.string	"Y\206\237c\374,\365s\f?\013\177\216\372\371\205\237\323\237]\370\271\205\237W\370Y\204\237G\370\271\204\377|~F\177n\3613\007?o\360_\356\177\237\377d\377G\374W\373\0374777\367\367\322\257\223\341G\242 (0\357T3\216\035\213\303\227) \255t\177\347\275H\345\321\002\245\026R\331\303\252\251\274G$\223\343Q\326U\036\255\232\367\036]$\362\250A\362\036Y5\257\326\255R\243\305\227\251<^d\362\036]\344\235R\262B*\265\254\232SZGVM\245\326m*\257\321ENe\325@\336\254\243\333T\276\335fR\313\310\252\231\324\262j*\207\360\236\032J.\255\2718^r\374f\205\2747\260\272\246\262\214\234V\314\344u\273\227\315f\334,\004\356\355Jf\271M\365\3404*\347\r*\264\251$\217\300\242\362J^\244\323\nJ\362^(TO\027\013\202#\323y\223\260\363X\244\353^\315\270w"
+	.string	"\254{\217|\235\367\336\343\275\027(\253\213y\357\017#\253%\026\326\275\\IX\267\353\bf\306\275m\366&M\313\252\351\225d\002\223\245\271\2744\230G^^7e\226m\036\253\334\253{/\303\331\245\326V\235F\303"
+	.ascii	"\001\t\263\266\306\r\2304f&\247\364i\364\235\3667\227>\353/\234"
+	.ascii	"\274\027\311Us\260\3644\332h\335\205\233#\332K\035$TZi,\r\367"
+	.ascii	"\362\b\035\317\315\361\b]'Y\204.\001F\322\265\031\323{\013\221"
+	.ascii	"\326\024,\\\032=j-#\200\244\200\031\362\325Y\304:\310\22065\215"
+	.ascii	"^\305\325\031\032\033]\270\004\021{z\321\301Y\314\226@\250<\217"
+	.ascii	"l\313\007\260\270\254\375({\n\231\262V\243L\231\rh\314\226\322"
+	.ascii	"8tX\223u\263\307\032K\353\320S\332J\347\320e]\245\243\364\225"
+	.ascii	"\246\322P\270\331b\275|;\351'o.b"
+	.string	"\215\003\313\226\247\232\225\031\036ft\025\321\321\350R\265\255-\357evuUe.\201\264\030\031#k\261\346\321>*si\265T\351\360l\261Nv\223\312L\003\001K\330\263o\2135\215\256b'\327=\276A\240\226\224;\261\223\022\245\007\231\002h\247\261\b\335\t )\226\t\337\001s\"\327\350\201\276\354\037P\366Ve\246Y\032Z\272<\357e\202u\221NR\231\313 \032G\276<{I+\351\033\270\331`\355\365\036\302^\336e\r\326Dz\213\235H\356\324\221E\036\247\236\037q\3672\177\262\202\264\261Y\364\235\244\221\270p\257\031\027\362\212G\243GP\036kF\2304z]\037\333F\230\336_\005t\031\003\246Q <\366\2726{\235\030{\235\026{\335\025+\244[\332\353\204\330\377\364\261\377\201c\377C\306\276}\374\275\203\3278\213\013\3676\357\275\002\330&]\332\316\032\355\036Lo.$]\026\027\363\232I"
+	.ascii	"VD\254\321z\305\242?Mlgun\364,a\302-\367\212\203\233-W\231T+"
+	.ascii	"\256\273U\301\232\267\254\256\005\372\t\0217X\032\275\201\211"
+	.ascii	"l4\270\2674D\354\231,G\325Q\006gG\335\"{\363\344\252?\242\240"
+	.ascii	"a\342Q\267\210\216G\367\026q\263\374\252K*XMR\217T%\334\254H"
+	.ascii	"*\220\327\254\252\365\244"
+	.string	"\212\244\366\260\200\314\355\211\244v\325\"\354\3442\272H/t@\330P:\203\020\2419.\207\004\225\225\007er\252W5\302\315Z\344I\314{\315j\221\032\244*\331\311\305\2749v]\322\250\021\033qb\250\016\0337 :e%B\204\306<\002\327hM\002q\365P\253j\364BG!\334\254C\354\23500{.g\307\203\022/9\373]\234\375\016N\365a\333\236A\330\332\354wi\354wg\354wb\354w_\354_u\324\255\237f\017v\330\352V\325\232\265+\2523\333K\214\244\2536T\254z\343\017*\022K\373:\273b_\257DP\202\346\254Q\224?FWk\274\332\370\203Z\255\311\022\253\314\276\322\250V\177\020\221\033\223-U\242\330\327\031gsv|4Z\253\354\214\035\022\023 \202x\031R\253\376z\031\255\"e\230\353\363C\243u\252R\275\"\353\261\"!H\336;U\221E|\356\235*b>\200\371"
+	.ascii	"T\314\253\t\027\035\372\235\227\035\032\302\364\236\333\261\221"
+	.ascii	"y\352\320\350w3\370p\263\371t\232R\016i\244\210\031\212\022\306"
+	.ascii	"\207\022\216\236s\263\365\364\016K\311\233\203\305Z\226\034\327"
+	.ascii	"\002BJ3Sl\312\374\360C\307\031]\2525@\226Cs\250\304\335\210S"
+	.ascii	"\003\205\t\22708\270\276\303\023\\\271z\016\355\310\203\343\211"
+	.ascii	"\035n\366\235\2610\314\036U?^x\342|i\364 ~\274\275\005\001a\203"
+	.ascii	"\016\2359\020V\354\2449\211\023'N\313a\313\323_\312999f\210\250"
+	.ascii	"\324\340\330\234\265iv\233~\023\"\213\203:C\2367\213k\201 f\031"
+	.ascii	"-r\215\276\371\333\255\335p\037\027\202x\214\275I6\212:\321\202"
+	.ascii	"\300\324\250\3516=q\210\316\324\250r\243\215M\221\032\023-l\326"
+	.ascii	"X<T\300|\2001S\303\321\350\203\264\234\315vvU\222\004i]\317\233"
+	.ascii	"\305\\\340Vnm\255\331\202\270$x\202\346\311b\340\276\222\215"
+	.ascii	"6[W\355\334h\205QYc\337"
+	.ascii	"bz\314\233\314\311\264\232e^\034\214\205\210\227\235\270\313"
+	.ascii	"\305\265\264\363*c\262\351\341\255\3669B\227\304O\016=w\332\f"
+	.ascii	"\332G\016\216\232\2312\272%N\306\334\370\004-\367(\2474\332l"
+	.ascii	"\036\230\r\221\225<Y\336\032\275\355\262\177\377\272;\225u\357"
+	.ascii	"\315\361\303\274YTB\347\037\346\245\177\210+#\360"
+	.string	"\037\275\365\377R)\224\213\236Q*\204\001\220d\f\205\031\2240\376\t\305o\230\3427\364\005\245vA\247&\376\024yBF^\3607\374\t\376\2065\225\001XD\213\305\224\330\324\324\003\2221\024\372P\242qX\233\322\340\017\b\325\003jJ\213RhP\b4\372\322\"\320\211\274\337\020\305\020\261\367\344Ce\020\215E\340/-\201\304\237P\304 \246\210AD\352\031{\032\370\210\272\0201\204\030D\t\211\034\244\306^\323P\312\200b\211a1\252\250\205\t!\224H\241\\\364\214R!(\311\350\021\211\027D\245\306\242\f\023x\006\004S\"Q\3127\"}\0014\372z!>\030\301\230\376\006\270\257\310\013r`L\213i\t\277a\211\373\200\3044\230\376\354!X\301\300\n\0261\200\316\"\202\006\"h@w\026\02101E\260\202\311~\005S5\002\375\tE\221\200!\343\237P\030\245\206F)!/\n\3060E\221\230\276"
+	.string	"\022\233\224\214<\240\342\257w\202\020\250+\362~@\247\2400\203\027\251\006E(\251\026\304\324\030L30J\215\275\022\242`\264\020z\2216\325b\2617\204!\204\342\205\3405\245Q\304^P\212\007$\032\217\214\304\236\261\330D\354\301 \n\235xJ\306\240\2240\312\t\370T|\032\016\0010\246E''!/\b\374\001\211B\336/\b\204\021\"-\366\\ \031y+\230l\221\367K\233\216\214\276!/\b\214z\301kJ\323a\021\200b\024\017*\365\371zDP\303\250\036O\370\202\230\026\221\322&)#0\370\353E\021%\005\201"
+	.string	"\304\350E\361bH\211N<\2504\030\354=\371\b\220\002\212\2216\005\201\274\021\306?-]8L\211)\214B!1\305n\330\203r\"Q\344\265"
+	.string	" \bC\330\204\224\302 $\032\213C\251\024\352\027\354\355\232z>\241\246\"\250\236\013\241\240!\261\007c\b\nJH\f\001\243'\203'\303\b\364\t\211\251\323\021Q\370\344\013\366v\275\240\260\230\022\211|\305\2248,\022>A\245\303b\2326\365\232\244zE\241 \260\367\34399\025\213AF\036\013c\020\250;\023S\006J(\210\320\201\365\241H\241\200NB\342\220GL\215C\341\223\021\030$\nS\030\237~@(\247\024A`/*\205\217XL\201\302\2041\230\002}@'\247T\350\343\245M@\250\037\317\0074\026{P\251\220\230\366J\234I&\204\003\007X\262l\207)9\234=\032\255bU\254\222\005\035\335pI\033{%3\003T6\206\231\305Y\243\324(5,\350\270{\202\346\007Y\334\345\322\261\364W)\257a\374c95\3671;\300\214\255\241\345"
+	.ascii	"\305j\317\327\r\215\362!:\262\3441\206\303\233\2662=v<i5\335"
+	.ascii	"\026\334U\330\262.\373\215\007F\367\032Q\222&\344#\202\021\250"
+	.ascii	"\022A)G\302\024S\206$\230\031\032I\222t\222\n\020\006\204y\236"
+	.ascii	"\267\320\007\022@TA\222*\310hD$I\031)\324\2431\007\264P\030\341"
+	.ascii	"\364p\365\355\262{\343Ie\364P\335Y-\r8\351\356\261\264 x\261"
+	.ascii	"\313\016H\024\347\222#(#\251t\204\236\366\017C\302\177\207\003"
+	.ascii	"b\320\271&n\357[\253\233\230Z\303\204{Ur6\214\200\370\260\345"
+	.ascii	"\325C\017\307\2017jB\207\305\244\215\025\306\232\304_\351\353"
+	.ascii	"\001j\361\222b\001,Z\013\013\n2\005\202\365Q\261\245\326]\226"
+	.ascii	"\2553\245\255\274\n\r\023\324WY\220\345M\303Kn\bA\246\224\327"
+	.ascii	"\243\210r\376\036f\200\003P\220\343Oy\253\375\213g2{\351d\007"
+	.ascii	"\021\004U\267\323\306\371P\331\2402S\005\242<\344\210\307\364"
+	.ascii	"\017e\350\233\350\221J\253\224\231\026\200\326@Ov\265y\035 $"
+	.string	"5\265H1\266\224\264\321\247P\0029\251`^3\005\240b:M--\215\273\266W\313.4\335B\215{\364/\321\200-K\300WPj\312\265Tr\004S\226Y\275lP,\334\231\023\330\373\335\002\013Jw\033I\321pABM\254\203Hm\013q\241\320\260\345\002\364P\267\354\334[8\245\367\214\242\322\312p\237B-\325\373q\246r\231\265\235\240\n\213\211(\223\337\211U\025m\371u1\022\322+!i\273.\212\270\267\363\351\244`\230\373e3\266\224\255hL}==\\\351\316\312\313M\244\234\217M\251\337%\317\361\302\317u3\334\255\250]M|\327+\003\3454\304\"*\020\210u[N\276\277\211\007i\342q'\310>pe\357\006v!\322v/Q\bx\263\3045 \032E\305\022\314\354\330\211\260\364\025\313!\314b\001\260\200J\037\2513#nI\335\264e/\362\f\013\331\322r\322F\250\373\002\245\034\326"
+	.ascii	"\036\314\020{\206\301\342_F\203\237~HW\347\202\300\304\277x\375"
+	.ascii	"\376\364e\b\240\210\315q\242\n\210/\301\021\262\323\343T\261"
+	.ascii	"\n\317\263tmS\036U\034g\t|Y^\353\352\221\263\356\321\272\252"
+	.ascii	"\210dTJ\344\2749\213&s\232R\316\260\314\366HH2\367\\\232}\234"
+	.ascii	"\370\242%\340fk\265\353b\201\030\220\246K\fB\273\356\267\227"
+	.ascii	"\nU\312'\204\307\005\346\231\020x\277\241\334G\315\351\272\312"
+	.ascii	"\255\253\272\264I\356 1\223\205\007\311\3569I+\305\007B\263-"
+	.ascii	"X\341\262%\323\254\354\020)\371hZ'K\347\352\210\036\324h\254"
+	.ascii	"\221)\206e\03420a\303y\224E\n\264\277~K\271\324\2564\305l)\340"
+	.ascii	"\007\361,)\220\235@\211h\264\212\251\304n]X\311y\345_\be\b\271"
+	.ascii	"=\312\354:\213%.K\232\\D\336|\234\3756\r\247\232\023\231\250"
+	.ascii	"\305\004\333\370\336\321.E\002\3017^\373\242\037\210\244\337"
+	.ascii	"!\203\264u0o\244\307\202\371\177-\347\265V\263\006\333ERK\315"
+	.ascii	"\337\272\241\0307^=\237+g\302\236FNC%-1s\224\252\034\231Y\ts"
+	.ascii	"\227\321!4h\315\224\246\nG\364\253\344\031\233\225\"\375Dh+\n"
+	.ascii	"O\022\245f9\341\201o\223F\304\316\256H\277\343\233W*\017\323"
+	.ascii	"k\332T\340\275ma\344\021\255\245w\250\204\320\304\013\2604\313"
+	.ascii	"\255\353\343#\250w\315\004\205\341\020\341\312\334\326\340I\256"
+	.ascii	"\2075\207\334\357)\204\227\320\326\344\005p\234\036\003a\255"
+	.ascii	"\"OW\346\260\026\264\003\333V]\"\307\0219\257\017\267\245\202"
+	.ascii	"AyM\221\315\324:\273q\002\344Zt)C\0160\271ePIfCv\214\344B\201"
+	.ascii	"\t\265/H\357G\345\2719\313c\023:\302\205\254zm\024\004\331p\343"
+	.ascii	"\006\367\3040\0322\364\024h\035\237\371\333m\326\350\300!\351"
+	.ascii	"\336\231\301\026s~\273C\334\335\235s\211k\177a\036_\364\355g"
+	.ascii	"x\264\026\373r\r\035>i\246qn ?\344\345\177\232\327\274\033\271"
+	.ascii	"5\320\350(\367\fa\352P\363\b\310\243]\023\007o\322\n"
+	.text
+	.section	.gnu.lto_.symtab.7a4f631b4fbaa85a,"e",@progbits
+	.string	"pgResetFn_ornithopterProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"getOrnithopterProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"currentOrnithopterProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"ornithopterProfiles_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"currentOrnithopterProfileMutable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"getOrnithopterProfileIndexMSP"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"setOrnithopterProfileIndexMSP"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"updateOrnithopterProfileFromBox"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"ornithopterProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"ornithopterProfiles_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7a4f631b4fbaa85a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,4354 @@
+	.file	"pid.c"
+	.section	.gnu.lto_.profile.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375 \fa"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\234\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\322\f\215*"
+	.string	"\324-\306\r"
+	.string	"\245\001"
+	.string	"\305\323\273\353\f\004\002"
+	.string	"\002\001\264\356\326\251\002\006\002\003\003\240\342\234\212\n\004\005\006\200\245\251\303\f\b\007\b\250\275\341\347\006\006\002\003\002\004\t\n\013\344\314\214\230\016\n\f\312\303\201\314\017\024\002\005\002\005\007\004\r\017\020\375\315\377\216\b\006\002\003\021\334\344\364\356\003\b\002\b\002\t\003\002\004\022\023\345\255\276\224\013\003\003\024\025\326\346\251\373\016 \026\027\030\031\272\357\326\340\r(\002\n\002\n\002\013\002\013\002\f\002\f\002\r\002\016\003\002\007\002"
+	.string	"\017\002\020\034\035\036\037 #\350\351\277\263\r\020$%&'(\327\346\362\327\006 \r\002\r*\352\263\360\321\b+,-./0\276\347\213\334\006\032\002\n\002\021"
+	.string	"\002\022\n\002\02234\315\343\301\244\0135\253\375\240\244\017\016\002"
+	.string	"\002\023\003\002\003678\266\340\231\276\0022\007\006\006\r\002\0059:;<=\335\310\201\366\t >?@AB\366\373\231o\n\002\b\003\002\024\003DE\257\255\242\227\0162\n\003\002\003FGHIJKL\214\333\264\354\003\030\002"
+	.string	"\002\025\nM\203\241\345-@\002\n\002\023\026\002\026NPRTUVWXYZ\243\300\332\254\t\b\002\002\002[\\]^_\255\236\206\273\001\006`\235\304\212\202\003\022\ba\366\375\372\377\b"
+	.string	"bc\351\223\222\345\b\b\017\002\020de\376\306\244\237\007\004"
+	.string	"\002\025f\202\222\314\254\fg\220\247\364\342\005"
+	.string	"h\342\206\317\307\ti\374\255\365\254\f"
+	.string	"j\310\255\301\356\f"
+	.string	"k\277\223\361\266\blm\325\240\225\353\001\027\026\002\026n\375\210\250\236\006\004o\223\254\326\367\004\002p\301\276\364\275\r\f\003\002\005qrst\347\354\345\251\007\204\001\003\002\030\005\017\002\031\005uvwxyz|}~\177\200\001\201\202\203\001\204\001\233\317\310\351\n\205\001\213\301\302\227\n$\032\032\032\032\206\001\245\226\217\345\007\032\207\001\225\223\341\204\001\210\001\354\277\324\317\006\211\001\251\342\270\376\017\212\001\252\325\237\241\t\003\213\214\001\355\205\330\341\004"
+	.string	"\215\001\222\200\241\200\r\216\217\001\367\237\277\261\f\210\001\003\002\033\n\003"
+	.string	"\003\002\003\220\221\222\223\224\001\226\261\261\374\f\004\002\002\002\034\225\226\001\272\353\216\323\002\004\227\001\342\234\310\321\013\230\231\001\262\221\246\274\017"
+	.string	"\232\001\207\316\331\307\003"
+	.string	"\233\001\216\315\216\314\001\017\002\020\234\001\366\334\243\331\013\234\002\033\006\004\004\007\007\007\003\004\002\004\235\001\236\237\240\241\242\244\245\246\247\001\233\246\366\244\250\001\256\332\333\305\006\251\001\252\001\253\001\203\323\311\217\254\001\212\323\267\360\004\255\001\336\215\314\344\r\256\001\231\331\376\250\017\257\260\001\265\263\276\320\005\261\001\226\210\220\365\005\262\263\001\277\332\376\350\b"
+	.string	"\201]\250\201\321!\021)I\n\nRh\f!\005\314)\350\224\221\007\022\240\362i\220\352\234a\002\021\021\221\021IA\031)He8P\212\236\251@\030\373\nm\202\351y\340!\225u\360\335\206cK\354i!B\204\3342\f\211\367\212\tK\237\336\300\023Y\247\356&\317T\222\327\275NP\236\200:\034\215f\020\371\250\277\241\266\337\203\265\3466w\bU\023D2=\266'pONi?\377\222\317\324\243o4N^-^iw\344Kgm\005K\by\"\354p;W\216e"
+	.string	"\242\2425tGj\006\331\310\204U\273\034\314\212?\305\216\021\365zO\373s\230Ds\272\bi\346DT\211\216\0161\371v\261\232\303\221\324\211\033\222nO\366:\027\334t\026\344~Pf\214x\242\327\001\360\335\t=4S\221\302\363m*=\215k\330q\022L\342\035__1\325\246"
+	.ascii	"\2215haX\020c\203qD\234\216\236s\202\212$\024\307\213\313$L\034"
+	.ascii	"\317\020\203\271]7Ev\363R\250iv\361\350R}\365\027\344\220u\317"
+	.ascii	"\356\020\355m\346{\330\004\3112\237u\204\0066Yg\332\3210-9K\260"
+	.ascii	"\371\344\025\"+"
+	.string	"\247\177\005\231\356\355\345\310\244\177\221j<\3709\203i\213\2767\021\241\321Or]E<\374\362g\351\251q\366\004\366z\027\321\342\2138\007\227\242\036*\364\306\276e\244\322\272\346\3070\"\311\340y\262BZ|\027F\304\257\300\274_s\177\2546\374\243\026~\255?\247x\360\377\2328\367\3353\264\333\342B\272\362\320\337K4\001O\313\200\207,\307;^\341\322\020:-$|\271\337\321X)\rG\344<\325\214\350\374\347\221Y\255\212\353\270\300f\006k\n\005\025\315kF\364\177\220\004\\KA:\303\340\244#\200\233\025\354\307\034\016}\347\ra?\006!\252\025\232/\211\212x\272$I\344\261\264\335\361/\326\327\227\213\202zzM\276\317B\342\372v\236e\231\3332-\334\025\020h1\027lc\026\f\272\354\367\270=\224\274]\374(?u\020\003'\204nt\260\207\27093\374\375xH\025\332\274?\023\235\374\342j"
+	.ascii	"-\211\2407\0011GZDp\356s\212@\350\003\177(\202\237\250\352\350"
+	.ascii	"mg\202\310a\223\315\363u\262Xb\0167\023\213\027\254\261\323l"
+	.ascii	"F\303\233\013\236\n<\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`i\003m\f"
+	.string	"B\217)% W\322\030k\027\033\"\202\022\323\n 2R\222\342\001\354\bD\206_\304\3408\214=\"k\215\020\262\267\224)\005\236\352\357\254\316y\316\343\334\234\333L\352\243\227\253F\355hNg\2269f\207\361\374\313\024\357\362\267\250\035\313\371\312\271\312)\213r\262&%G\"EJ>\262\"g\b\210\232\376\217\367\350\340x\333\320\310\370b\033\332\324\307\022\314\266\270\342\t\tU\333\324\377JW\236!\330+B\215\036\024\203v`;4\274\026L\363T\370S\317\340W\201\021\350\351\r\254~\267\300n\300"
+	.ascii	"g\322AokB\2500\002\177\250\260\256h\222\2445\220\202!2\252\007"
+	.ascii	"\021@-C\220\025i\nY\3667\367\305d\376\313G]?U\007\352\365^K/"
+	.ascii	"\234p\223\020<\264B\326@\3030:\017:L3\024\244u\341\377\243W\t"
+	.ascii	"$\241F,\275\335\034\200\3715\222\213\020\360\341\271-n{\021\324"
+	.ascii	"-eA_\214\356\003]\n;\307!\276\322\035S\340\372V\360\322\202\033"
+	.ascii	"\177\302\022\254t CG\205f\202\271\"\231\367\037,i\323\200\254"
+	.ascii	"\214\t\236$]\323\244\343\320e\2521;\362\242\217#\n\320\234c\262"
+	.ascii	"\275\016\313\230\347\274-\017e\226Tx\034V\003?`L\346c\307\016"
+	.ascii	"\025\346<\257qg\313\003X\337Zr\344*r\264X5y\344\262\376\201]"
+	.ascii	"\314r\305h\"\363\341gi\302\371\262\3479\271\006[\323\032\007"
+	.ascii	"\332\312X\236\232S\342\002\020\320\001"
+	.text
+	.section	.gnu.lto_.inline.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\275\025\225F"
+	.ascii	"JYl\022C`\236J:\313\320=z\336\352\316\210 \345\354\242\351\002"
+	.ascii	";\237\326\347\340\235\024\326|N\333\372\325\231\301\217\037r"
+	.ascii	"\350Z\374\333R\206g&r"
+	.string	"#\316\225\232\002\027\021\361\270\260|'\323?\fQ\362\t\331[\312\024\021\001\027\001\032\001\315\246\b\232\232}z\250\376\312AF\247\177\376\224j;\2560\265\363\250\261\325\214t]\022&S\363Rs\024^j,\206\321f.u\326\313\270+A\376\016w'>OU,d\336\330(\321D\311\332\027\206/\241\037\366\237\234\235W\321\317\013\215\307{\215@\177\261\332A\023\307\b\017\261t\377{)\251\255\272\316\331\335 \273\233\037\370\323\221\215CK\270\370 c\264\312\374ZU\273\224u]\271\233\323h\350\302\366\223\263\323Jk\222\030\234*X\216N@\250\221.\0346\362N\032!\326\f\333\231\236$\233T_\247*\220&=\270\030\370\200?\035\211l\377<Q>\017U\252~\273\367b\240\252\013\220\206\252:\306\275\027BU\203\335{\221.T<J\2135\355\336;\340\347\177bU\203\204;r\324\177-\266\332Y^\230"
+	.ascii	"7\355\213\325\254\377\0314\237_\247\372\330\347\207}{\251\266"
+	.ascii	"\357\267T\377R\325\264\377\0274\363\377\264\371}.\366\275\367"
+	.ascii	"\002\3705\374H-C\305*\340\"^\367\212\224\201\341\033\310\037"
+	.ascii	"c\210|\314A\360\357\332\376\356\230\372`\370\376\374\022\374"
+	.ascii	"\303\323\361\315\027\252\265\354~h\341\363=\337a\315\341\305"
+	.ascii	"O\317\300\203\017\236h\263.w\257|\007\337A\250z\307g\214\016"
+	.ascii	"\037=*l\036"
+	.string	"r_u\3127\372F\243\352\033\035<$\377\274\037\266\227&Y\350\234w\332\376\360\316\333\373au\033\243R\343|\337\367\265\363\213\243\023\n\022f\016\237\tD\374\253pc\246\266b\246\276\342\237\247pS_Y\035@\024\2605z>w\016g\333\364m\323\267\215j\2563\227\215oo\205\215Dn\331\023\372\211\376\214\252v\342\222G\373>\337gT\347a\222LR\205\325\213+\354\210\321\321\013\273\314\320f\234b]\346\370J\004\375\325\374\337\304R\270\251\263\372o\206\261f65V\333\261+ti\216|\206\263\326\267}\013\271\236kah5(\224\315W\017l\346~\245j\272\2716kL\277\360w\343\t\023\363#\021'\314\236\234\016\257\020<TTu/\231\314\023\254_\361\336K&\373H8w\375\257eO0et\346\"`\345\214\002\231\250n]|\200t\305\021\367\244\253\335P\324\255\264\2574\266{\213\377\267"
+	.ascii	"\321Y\234[\226\343\270e\2548\2055\231L&\355Q\333KL\247\316j5"
+	.ascii	"\323Ag\025\233\355^\243\320\257\266\340\206\300\261R\324\337"
+	.ascii	"\002\004/\207\321\255 0\261|\n\024,\325U\026-\377?h\256\302\017"
+	.ascii	":\213\225\230\017\032\213\353y\252\236\335k4:\325Y\250\203\250"
+	.ascii	"j\331\275\306\240O\021c\230u_o\222$\265\223>\2756\340\207\177"
+	.ascii	"\361\267S\336\275\027\350'xh\274n\376\372\276\204H\302{\273\327"
+	.ascii	"\302M\344\335+\206\244\340QG\013\326w\257\030\002\007G\340K\374"
+	.ascii	"\351X\207*\002.\004\\\177:\226\267g\001\346\211\360\364\260\376"
+	.ascii	"\365!\375\206\236~\330i\235\276O\324\267{\265\372\350Q\342\026"
+	.ascii	"\321O\325_\374\310\331\303?\316WH\353\225\232\031\216\033T\250"
+	.ascii	"g\017f\203\316\272-\343%\017\034\207}\304\377b\027\375\304\377"
+	.ascii	"\177\373a\247I\220\034a#F\031g\177s\316\363\031\233q\221\371"
+	.ascii	"\037\350\347\001'\237\317\267?\007(\353\227;)\310\363OQ\223k"
+	.ascii	"\302\316\224uV\215\203\217\307\037\253\205\304d\217\252c\250"
+	.ascii	"\334\311\351,b\336\344)p\303\007[\032\243\263\217\377\f\205\223"
+	.ascii	"\332j\354OG\342\260\235\234\314\304A\023\207\350\334\343A,e%"
+	.ascii	"\230\231\022\276\346\3320\001:\357\370\337g\035\3574\306\361"
+	.ascii	"?-v\337\275\302\346`0MQ\364\274\367\276\321\340=J\254e\301`z"
+	.ascii	"Qb-\353\323\336\333\301\340\231\376$v^z\251~\353T\312\275\327"
+	.ascii	"\305\206\227o\365\300\262\254+\323\312\222G=\260<\253\007\226"
+	.ascii	"2l\235\355\253\253y\365J\366\314\226\331c\275\222\275\365J\235"
+	.ascii	"V\337\352\225\372ZO\336]=\220\353\200l\365zV,\307\021:\353\267"
+	.ascii	"l\365\f\302\214\320X\007\356\360:\207\325\260g=k\375G1\356\325"
+	.ascii	"ZJ\352\2537\030/=\032Dg0\032mV\251\3123\210C\177\202\004\250"
+	.ascii	"\"\363\326!\205\230\031\231\221$\251d8\322\t\020\220\343P\244"
+	.ascii	"&>\037\022\240$9\306\242\21415#\"\"\005-(\337JsH\314\336 \374"
+	.ascii	"\211\254'\245\215\210v\207\223\266\004\254\217\232\257:XNM\272"
+	.ascii	"\337\335\035R?n\340\362\371\250\\AiU\222\332\334e\333\2467\226"
+	.ascii	"\203l\341\300"
+	.string	"\025\213\243\331\344\037\261\311>i.{Nv\333T\277\240\264\253\314\352|\324\215u\330\177\320\352\232b\\\336B/8i\244:%!\331C#\223\031:l\362\202\2270\371g!ex\345X\005\f\260\233@\361\375O\240\2564\307\030pO\342\035q\300\311(@zY\373kk\327\3512S\252\205\202&\246\257#\231\375\352\024=\362.:\271\344Q::\304D\233\310\245\001\231=U\340\363/\334nK\021\210C\312_\352\225yr\330\003\373\334\311V\323\027\r\325\341\327#\202\233k\370\310\314\016.\337\326\310z'i\001\201\327\261\3168\177d^;@\211w7\314n\2336\202K\243k\003\220n\277\256\276]z\275\342\375\262\363\265\216kX\312\261\374%\306\314\177\324\225'K\246w\222\003\307-\306\222\212g\226}D\260'T\215\214\314\f\352\253\0164\223*=\207\031\001\217\226\370,}|\002\312\273\274\222;\302\354"
+	.ascii	"Ll\347\316\356\2601/Mt\303\2324\226\304\366^+l\025.xm\024:\177"
+	.ascii	"\b\2068\260\210!\217\276@\364\005S\006I\001\237\340r\314lDb\222"
+	.ascii	"\363L6\326\331\350\323\005c\006\313\001F\343.\224: I\212\027"
+	.ascii	"\366c!\327O4\221X\305&\002\372!c\223\207\330\373\025I\005\223"
+	.ascii	"\303p\350\243\244\372\352\211\365^\365\005Ss\0266NA`D\013Az\036"
+	.ascii	"\031]?\371w\353\324\377A]\317\273\300A\361\t\244\373\372we\202"
+	.ascii	"R\326\024\017)\310\313H,\360+\261\354\031\230G\277\213\024i\331"
+	.ascii	"L\035\"\340R\013N\224l\"\003{\247\277n\350\013I\203vv\205{Z\300"
+	.ascii	"\310\372\333F\251w\177\214\3101\024\203\204\"pM\262V\216\357"
+	.ascii	"G\212\262\200\315\300\324P\200N\032!\264{R-\311\342\353\215("
+	.ascii	"\236\340d\261\334\330\371\267\326l{f\264E\221\036.'\255\360\310"
+	.ascii	"=.\264IN}\366y\032\b\2474\235r\253\345`\306\b\355Cn\200\213\243"
+	.ascii	"\001\006\325\246[ \334B\257H\357\366\316'\201\260\346\316\233"
+	.ascii	"\230,\346WO\324\200\334:\244#\302\315&\264\270z\024\351\024\300"
+	.ascii	"\230\334\356\312\004j\374\fVP5\267\300.\201\264\371\265\\\234"
+	.ascii	"!\261z$\260Ht\026oB)\013\235w\367\211\310\222P\214;\021\320\261"
+	.ascii	"\342J0\017\330\370D\233\013\261\246\363\017~\303I(\270az\262"
+	.ascii	"\007\220d\354\005XM\320,sU\037\231\213\235o\232\324P\021K|\030"
+	.ascii	"\302O\360\246\033D\200T\302\337\325\031\005\n/\030\356\342p\374"
+	.ascii	"\234\251\257\350,\331\332\334\256\255\216\263h\333\300\227X\222"
+	.ascii	"hW{-\342yo\233\223j\310\225\004j\256\f\013\t"
+	.string	"\317u\225\361\372g}\334\343\205[\006\023\374\022\241n\002\013\212w\347x\250\230&[ \324\006t\271\205x\315\3552\362H\340\031i\273\026\002\346\221\347\200\244\245b\026\001\203\ts`\222\254\3002\026c\371\353\230\226\325\211\350\032Rbm\372\357lT\202fR\366|\3468\331\f\372\300N\237\275\204\032yL2a\002\265\246\314g^|)\nV\201\246-\027&WT\230{\026I&\001\371prF\br\316&p\351\303\013[\207C'KN\3501\314J+Y\"`\242\243\246!y\334(\326\025\373\r.\353x\355\361\221\340\271~ \344\372J=\231\343\354G\261\221\330\274\206j\025\\\366\200'T)Zg\260P\217,\004\337\353\020F\331KJS\332t\303\264 \217Z\344\3074\022\330\317\215\005\034\363{\2157v"
+	.ascii	"\027\321\371\315\013\026N\001s\270;\353\352\250\235S{\203\271"
+	.ascii	"!>\022&\023\362\222\031\035\003\325\214\\\301\243\002\212\217"
+	.ascii	"\204\210l\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\372\nU\034"
+	.string	"6!fA\340\026%\351T6\254\n\030\343\020\307\307\367\004\216T\034\214\334\311\200\323`\346\375\330\341\214\0276\207q\007\027\210\342\344\310\311\221\305 \236@f:H\230@\344ii\245\260|;\212\032G\326\020!2\311P"
+	.string	"U"
+	.string	"V"
+	.ascii	"\255/\275\227^\202\236\201\366\324\023=A1F\346\226<\325\352\261"
+	.ascii	"\224\002x\255d\265(\312)%\022\255\236%\341g\001\256UV\357\003"
+	.ascii	"\370\347\177|\1779\252\316\024m@\274\001M6\222\205\365\330\212"
+	.ascii	"\245bU\005z\354K\240g\352\271|\t\201+N\002e\227:p\030\032\232"
+	.ascii	"L\252\242z\250\r$c_\220\252%\n\365\365T\255e\243\001Ck0\031f"
+	.ascii	"\312\252\366w\243*]\256\353\272\036\221J\366\027J\026HR\230\320"
+	.ascii	"X\371\"\272\"\f\244\375~\252\366T\036\224_\364\200\244\322\324"
+	.ascii	"\373j4$\212*(k\\@\362\276\323\240Lo\006\271\214\366\217A*yvR"
+	.ascii	"Fn-\030\344:\3449$\353\335b\3008\251\324\327\263\220\333\"w\""
+	.ascii	"\267\243osI\025s\027m\235 M\300\224\340]\030\022\024\032\307"
+	.ascii	"\rY\261\270\271Yqj+i\304\001\021d\bk\020M\365J\037Z\362\360\220"
+	.ascii	"k\303 4\365\330\357\343\203\274\207\314<x2;\310u\230n\006\347"
+	.ascii	"\\\334\013\326\260&D^\251\204\251(\222\223\234\016\367\341\355"
+	.ascii	"\034O\3179e4\233T\247\260\203\376\310-\243:\250)\243)S\3515\252"
+	.ascii	"\342\250\252\177\215`\326\240G\3526(tPK\205v\267{\254\032\274"
+	.ascii	"[\200\350\2501M\246jFSP\220Ba\030\003P\002!\205\252\250\036\022"
+	.ascii	"`\302a\nEQ\206\0243D$\")H\353Oa\030\003\304E\241B\3203\220o\367"
+	.ascii	"\254\377xw#\031\376-\342D\232\376\037"
+	.string	"\337N\343\323\371\004\362\274\001\021\367\177L\273JL\026<T\270\352p\033)\306\312zq\214G\243\236\210\265\214+Mjg\267\361\017\366\266\316A5\034\361\353\"\\~o\260\204C\031\362\236\246\244\240\213\250\372=\247\354S\232F\223\223ye\203\357\3508\002\345v}\334\236\351\220`\374\226\221\307'e\0013\243\254d\211+\307\330\006\214kX\301\200\200\333\367s\202\037\331b\256;\236\177=\321E&\266U2\203\341\250\fB\2646\317z\n\324\275\201\302\006:\314x\343\224\353\024:\224_\217\n\342hd\272r\356u_=\260M\317\260\321\241\251\307ga\336=K\362\252d\323\036\301Y0\261\263\r\260\223C\306\331\250q_v\266v\364VXe!\n\200J\210>\377.K~)A\024?\352~D\271\"\b1.\273\306\311\216\337\260s\266c\027\005\231hy4\3573\007\035)\203\007\3121[@\372e\342\251"
+	.string	"\004\266x\025\f\026\200\341\233S\356\263\273\213f+\352z%\252\302SZ\244\311\210\264\231\027_\366C\24700RaH\376[\254 "
+	.string	"\332+\324[\037\276\206E\013U\234\013t\243H\257\262*\265x\036"
+	.ascii	"\305\213\tn\372J\256\266&\007vAw\267#X\225\265\367\325P\217 "
+	.ascii	"\330\323\312\346su\036\211/\351\303\027T\310\265BCV\321'0R\264"
+	.ascii	"C\303&\t\330\212Cs'u9G\230\r\034\tU\367\325\235\037\323\205\257"
+	.ascii	"s\227&\37312\314\343)\373\301&8|x\013=j*\355\316\231BW\035\307"
+	.ascii	"\342$cN=+\277q\332\277\314\345\001"
+	.text
+	.section	.gnu.lto_.pureconst.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375 \304\305\004"
+	.string	"B\f%)@\217!\035\303\300Y\300\"\323{2\023\271\031u\356\320\031\320\350\240\230T\257\277\334\024\t\020\312\210\273L\021o\322?\371K\022/\232\\\226\254H\262\342\310\245\310\213!\033A.?V\274K\273\364\270\354\270\344\330\270q\251q\231\361\"\306\213\027\037->V\\\212;q%n\304\205\270\017+\207U\303\307p\027>\205\233p\021\356\3015\270\005\033\3017\260\t\334\200\017\340\023m\241\013\272\237\353\331:\037g\333l\232\233\271\230\357r-\267r)7\215RJ'\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`k\006%\030"
+	.string	"F\335\\@\020\223\222\341\200:\220\n\240\026\020\210"
+	.string	"\240\030\310#\205\333\341\220\377\277x\257\243S\036\020\303\276\373h&,\\"
+	.string	"\274\272\003\277\360\037\350O\201\330\033\362Om\204\b]\273(\027\314&\204l\"e\nB"
+	.string	"E"
+	.string	"N"
+	.ascii	"\345*\315\312\031P\260J\023\201wY\366\234\2125\307\312\371\251"
+	.ascii	"\001\030&`\246tz\n\360\025\nu\242\224\244\234\244\016\300\354"
+	.ascii	"\\\005\001\201J\253\3247+\254\034\353\024)\027i\357\317\371W"
+	.ascii	"\244\216\340\367V\205\333|\202P^\215\3702\313?p"
+	.string	"\320I\205_\221\246\026<Uu\227r\027\266\224\267\364U\243N\255\004\277\247\334S\022\327\223+\350d)g\351{\3751\311\225R$Wr\245\335\201\226|\312?\254H\224\201\177\244A\234\260\230\253\"9\236\270Z\265j\231LI\232\370\351\230\302P#\246E\204\030\304K\373\301C\331\241\034Fzl\"\215\033\336\243h\376\3366s\r\234q;rD%j2\224\030.<-D(\t\363\306\026\363\353\372\306\323\220G\rg\036\362\016\237\230\234\310\314\230X\326F\352\310A\034\274\3616@!\352\367\034\nH\247\254A\032)\344\f\0310\376E\214\017\021\r\217\033\221\366\204\017\351BB\257\213\312.\267\341\\S\315\346.\320\222G\305\240P8\255\243W\034\233\367\346Fsk\245\323d\361\n\025)\246\371,\313\002\200\303\250\021A\310\024\315L\222B\032\003`\002\021\"2\353\022\300$A\306\324\024\321\244\240\265\366?\003"
+	.string	"\200\300\251\"\330\241\"\275\355\b\310\3202\2129\373\222\031\213K\002)\\\345\344\007J\224\363R\2544\300\257\272\204\362+wH\204\366k\367\342H\2600\243\3531\033\306\026\"7\371\201\365\316?|\201\321\233\272/\216X4&\277\216\354\354\013\222\276\031\006\305Jd\226g\234*\262\226\326\277fj\022\315N=@\202y\f\027\242\275\273>\021\342Vh\214\253\002\266\034t\207\227b\254\022\232}\307\370<\t\327Ib\265\f\327\247\374\372\272\221y\370IXp\b\345\242*\001\247F\331e\206\207\222\303H$\260$Z=\225\340\352\334\242\263}|xw%P\275X:\207\356pY\360\233j\262j+"
+	.string	"I\352^d\366g\272\344Mi\311\030\177\220\344\350/r\325\237\364\320\364{\257\2151"
+	.ascii	"\r)\210\261L\351\fT3\355K\305T\333\255_\321\374W4\370\0238\026"
+	.ascii	"\245\314-+\t3\034\025\354E\2630\214\027\371\034\177\026\025\001"
+	.ascii	"\342C\201kn[\225\311\256P\202\327^\250\022X\005\023<\322\317"
+	.ascii	"\367X\203\032\250\316D\300\240b\362u\351\201Na#\025n\246\360"
+	.ascii	"}\246\205\355\fn7>\362\350\263\375\031Z6\247\255\371\345 \t\265"
+	.ascii	"0\005\0020\340\305\317\206\305\006]Koo\321\362\237t\223\024\357"
+	.ascii	"\230\316\\\204i`\007\246F\005\006b\223\306\177\276\312\0013"
+	.text
+	.section	.gnu.lto_.lto.779ae4a278acd401,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_wingSaturationHit.47.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"\r\013"
+	.string	"\366\225M> O\225\016\213\204D \002=]0k\304k\230!\253"
+	.string	"(^\304\300T\204x\026j\374\306\"\001\223\363\203\265\210A\017\334C\004\210\002\n\311\311Xp\326\334\b\020\210\3024\022\311&R\246\024:"
+	.string	"8"
+	.string	";"
+	.string	"\273\024L\244vWb\001\331\243\306#\330\343u\b\366\350\317F\361\260\264\007J\210P*vW\323\013\377\236\237\377\323\035\340\350\363\274(\260\273Np$\341\326\333\006`\233\200}\003\001J\2625\235=\374\261\233\376\250i}:5}\307\003D\204\304n\204\026kWQ\245\301\366\037\2663lpa\254\203\n\020R\273\241\304\003\262G?\355sx\207\357&\217\260#\372\323!,D\023B\331rj\246NQ\013L\003<\365:\361\200\025\262\275\2438\331\356R|\017\377\320\3611<\232\201'\017z\260\307+%\303\n\025([v\370I\265`\377\332\335u\336\226\3310\261\333*\233\313\227I\307y\233\206\313 \260h6\217\346],\033f\201\246\331*\031-A\327\321&\033\3466\n:\315\343\270N{\204\373k\225\344\270a\005\322\220UEp2J!\016\246\310\364\252\001\017"
+	.ascii	"3\241\241(F\210q*|\t\210K\005\031\001\345\001\204\235H\335\374"
+	.ascii	"\017\013\264\013o+\214\307@\325\036wx\321N2"
+	.text
+	.section	.gnu.lto_pidNames.83.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"\032ROLL;PITCH;YAW;LEVEL;MAG;"
+	.text
+	.section	.gnu.lto_pidConfig_Registry.118.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375 \224U\004"
+	.string	"\304\007b"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\316\302\037\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\314\006us\250\346\005uq"
+	.string	"\005\001\006'\001\006\370\303"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pidConfig.120.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\002?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_pidProfiles_Registry.124.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375 \225=\004"
+	.string	"\224\007c"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\202\200\200\374\342\303\374\362\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\006us\305\006uq"
+	.string	"\005\001\006'\001\342\002\216\240\002?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.ascii	"*\"\301,:E\2217\200\""
+	.text
+	.section	.gnu.lto_resetPidProfile.125.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\314"
+	.string	"u\013"
+	.string	"v\026Q@\020Q\225\016\360\"\030/)\tt\003\207\301M\365\2638\\D\275\026,J\212\300\223\001\0256\372\230\241\003~.\b\300\211yl"
+	.string	"\240\025\022Pd\244\241uTRk\234\243\352\252\251m{\223\275S\n:"
+	.string	"="
+	.string	"?"
+	.string	"\273\237j\265\033V\214 \362\351\360\002\350g\344\001\350\247;\233\306Cp\237\322\241!\345\332\335*A\274{\354\374\227\270\304+\211\036!\rv\327\321+q\270\345m\037\260\255\300\376& \372\031\245]\301B\274g\212I\306*G\r\222\024\331\241(\312\017\366\261\335]\313\317>\352\217\364\035D\270l\324\031\273\033^;\2265a\204\210\361\366'\266\037\355\237N\242;*t"
+	.string	"\001v\202\257\320\006\200\273\313\340\323\236p\025\234\310\356.Hqa\373h\355\356C\364\323\301\307\362p\2721\212/C\242q\3341\350\303\243"
+	.string	"a*p\227t\3177\361\023\036\354\246Oc"
+	.string	"\321{\237~\231\215\246\331\270\007\030\255\343\341\213\005\243u\352GB\246m4\225\202\026\201S/\234\247Z\bx\353d\270\372\3316\256N\302=\266\3623\204\021\254\221\314`\003/2J\253r\027-$\237\312U\340\031\2653g\221Q@\007\017"
+	.ascii	"2\241\027/0.\034\220\t\310\006\216k\204\222&\\\262\247\215\230"
+	.ascii	"\026\251\251Z\254\013.\315j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_pgResetFn_pidProfiles.126.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`4\001\325\r"
+	.string	"\306Z]C\020\221\223\016\033\324xU\001\277\\X\276\034\261\357S\265\210\f\260K\340\325k<\b\0348\254\017\003\264\215\240G\230\b\231(\226\220\377`\002@q"
+	.string	"\n\220\350N\002L\030\205\030U\017\351\330\b!{K\231RI"
+	.string	"K"
+	.string	"D"
+	.string	"\233-\343\236\210\375\311\203\312\n\033\273{i\b\353\241w\303\334\036\241\346\346W!.?"
+	.string	"\363B\324q\2170\300\356\002\3502\300\005\271\322\201\022\222`\271\336\364\004\247O\324\261<\253\220\335u\212:\0167u\333\232\355\006\366?\001\231\351w\fp\021\303A\215]\r\037\216\245\2111#^\272}\3177\245\270\212\355%\313X\334\006\353\345\004b\306\356z<\232\201\365\330\201\347\330~\332?q\024\333I\030.`w4\323b\327\3730\002\353\321\336\013P\217\326\tP\217\016\027N_\350CLU\273\202\205\274\310\235\024\345\234Z\251\352Y\204L\230\306\r\203\272\246>T\002\224\237\241^oz\354"
+	.string	"\363\242\222\343\223\237\352\356r\252-\266\307\345ww\255#{s\322_\275t\303\2475\323\001\330OHL\260\222L{0\202y8\026\001\031\301<\027\212\204\b\230I\311E\001\2030\341\022\321N.\020\003\316<$\332\205\222e\332\305\361\366_\035\371.\267bdh>\n\212\332\342jF7\2525\351q\250+\037\207zR\251&%o\034B+8\324\215\006\033"
+	.ascii	"3\241Ci\f\246\001\315\330\256\251Y\212a\247\20711\030](\303\242"
+	.ascii	"i\004\246\245`\204\313!\265X\321\331^e\201\252\314A;\253\204"
+	.ascii	"5\253\323A\2738,\242l\260\323\336\236\003\376\244\334\271\346"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_applyOrnithopterPidDefaults.127.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\357\003\245\022"
+	.string	"\346\035pJ\300TU:\322\302\206\327\215\024\257\026\346\322n\025\202\331\323\242!\236D \030\255\022\032\\\327\002!W\225\325\262\332\224ht_\317\355\345\261\226\247\261\341h\307\274i\320\242\377\257\204\223-f"
+	.string	"P\271l\267_`\031!d\357\224\002T"
+	.string	"S"
+	.string	"c"
+	.ascii	"\037\260k\333\005\355\236'+ =\364\371\024\361!\351&\361\241a"
+	.ascii	"\266\220\237\267=\020\316\003\n\337\356\2165\304a\017\301Ja\276"
+	.ascii	"\311K\211V\213=<\251\355\034$\355\274\002\250\315@\003\273{\237"
+	.ascii	"S\235\232\214R\223\227\3355\245\325@\334\342m\307\330\206\261"
+	.ascii	"A\t\001\"XUx\216\230\3601\243?\213\224V\333\206\003=\3154\327"
+	.ascii	"\323\315j\314>c\264\362\330\007ww]m\366\317\037|\317OM\246\237"
+	.ascii	"\020\004\027\273\037\216\214V\027\346F\330>\212\355Jm\027\006"
+	.ascii	"\260\2377\027\260\262!\235\240\335=\331\345\324>\211\227\200"
+	.ascii	"\275\007'?\016\364\340\261\003I\016!\035\013\016rew\372\r\033"
+	.ascii	":\210p\3669J\264)\274\006\212\306\f_\201\n\207\221{\321\3039"
+	.ascii	"\260\360\026,V\370\026\234\024m\231\003\221+7\333,W\221\"p\333"
+	.ascii	"\335\007\017m\325S\224\244\335m\360\323\001C\312N\004\216\370"
+	.ascii	"\260\024\203\207\343\345\320\243\030X25\320\323\f\322\352\233"
+	.ascii	"\251\225\212\005\363b\331\230\021\314\r\256TM\200\324\252\244"
+	.ascii	"1]13e\353\304d\313L\331\032_\027T\345\212fd\2252\031F\322U3\266"
+	.ascii	"\250\330l\245\\\343\3134]#\312\271\007\267\332<\241H\227Se`H"
+	.ascii	"\027u\264$,\372%Q\202C@\324\343\371>t#d\202\335\207\274\b\021"
+	.ascii	"z\3138a\364\023\004\005$R\250a\220\305jFQ\313\263\330 \003\021"
+	.ascii	"\231R\007\021\2604(\211\004S+\273 \355SDQ\t\247+=\2136\003\024"
+	.ascii	"\333\211\375\0202|\233A\036_\031\26454v\216\246>\003&\370\273"
+	.ascii	"c\354\212\004\274$\342\262\343`\250\363\b\177\307\230:\205\035"
+	.ascii	"\204\22253v: \\?\324\330N\323\271\371uW\215\233\024h\273\bFp"
+	.ascii	"\227\211\232v-EA\020\351\003a3\"\230n\226\347^\242p\213\241\266"
+	.ascii	"S\247\276)\200\245\302|\021oc\033#\275m^\r"
+	.text
+	.section	.gnu.lto_pidSetTargetLooptime.128.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\270"
+	.string	"]\013"
+	.string	"F\225M@\020Q\225\016H5T;\200\bm\364\214\364\202\372es\030\250\220\255\223 <'\311\004\b\224o\037\353A\364\223\016\321\200\271\312\bf \002\344\002"
+	.string	"(M\365\013\026NT\343\302\352\032\0337\2222\2458"
+	.string	"9"
+	.string	"<"
+	.string	"+v\301"
+	.string	"\036\351x\024\371\307\365(\271\307\365\350\316\226q\260\303N<\204\023N7v\027S\016\357\236\235\177\022\247|#\320sB`w\235\337\210t\353m[l\013\260\177 \217\321\306\t\034\030B\031\332 (u\203}\311\356\256\265d\337\364\307Lk\2463\323\247\200T\210\201 \305.\2050\307\262\"\013\020\025\333O\373\">\242\273\351c\312\256\206\027\001\234\n\206\267\022e\350T\377t\024N=0\312\250\353\361\247\257\225\272waF\206\365\2000\\I\330\rY\256\251\367B\210\256\021T.<\032Q\375\0227\361\361?\030\202'\377=\372\236+\232M\326\3314\255@&\333*\306\\2\331\206u\030,\310\032(\300\034d\t6\030\206\343`\227\020k\233\206\303:\232\306a\025p/\271\226l\300\002+\244\"\253\n\216Q\331\342k]\235z\r\322."
+	.string	"\325\024"
+	.string	"2\203t\025\003\027\007\367\0061CbG\356\260gD^I4\253\302\032\340\016\025bp\341\002\314\336-j\275"
+	.ascii	"\b.6\020\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_pidSetItermAccelerator.130.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375 \373\325\006"
+	.string	"2M03pm\032\003\240{\375l\356\207\356\315\273\215=\260\204\367`IXj\261\325\200lbz)\340b#KD`A\326_S\330*\025j\004\201\2024\271\245L)\323\2728Svd\214\t\236)/\205\b\371\3114n\030*\020\274\036\034\252N\003\374T\034\017\214\023\002n\006j\201\344\204\227eM\210\311nW\252F\302M\264Y\250\271\213\326\324\377\327\225\332&\260Q\262p\372+RPN\362D40m\335Zs\270\003\263GO\275\374#\246\220\377\006-"
+	.string	"\360\3238\240\342G9S\361+\326\2328\313\270M\026\024 '\377\241\3030\346\206\325\376\360E4\n\271Y\020\376\267\211F$\327\271-A\333\203\266\244\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_pidOsdAntiGravityActive.131.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375 \305\265\005"
+	.string	"\344\tl"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\317\265#\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\235\253\001\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\367Y\361\370\200\265\001\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\244\003\001\200\300\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\b"
+	.ascii	"3\003\346\231a\340\353]\303\363\"\006\023\"\207;\367j\347\023"
+	.text
+	.section	.gnu.lto_pidStabilisationState.132.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\315\b"
+	.string	"v\021@80\221\322\001\200l\031\0373\n\236\375\210e\3603\371\367(e\255[\n\245<\224\326\032\266'\224\2443\252\031s\257?\007\037)\034K\264s\034\327\017%\376\244+\267\3352\245-"
+	.string	"."
+	.string	"/"
+	.string	"r\363\201\355\322\240\r\363\260c\217\342\201QB\333\335\0319\016^A\377#\347\254X\250+@\303\356ZW,\215;\3366\202m\006\333)\001\353\330\262\017\373U\325\227\177\311h2\020+\273\031\265\232e\2213\220\216\355\253\375\220\213\200\207\235\314\331\335x\221\355\206\nN\b\270<8\301\366\251\250\362\243O\362\330\205\377a\013\223~u\351\233\266K\203X\313\311LJk\376O\233\306\307\005\227\212\312\305d\246\322\232\035\2424\272\354ov7\242\357\363=x\242\321\250\363>R\347\020\342J\002\006yB\\i~\023\022\334(b\222\270\017\305\004y\025\323S\340\256$\362\346\327u\336\354\204\373\315\306\226\345KF\023\023\b"
+	.ascii	"2\241\263/P\300\20530\352\022\026\261\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_rcAliasToAngleIndexMap.133.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\001"
+	.string	"?\202\210\200\020}3\274\0014\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_pidInitFilters.153.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\350\001\025\021"
+	.string	"\206\036nF\340\324f8$\0041\343Y\016uq\201\370=b\270ApK;\200\002\002\223zH\021\206\227\337\375s\232\b!\001p\334\005\276\355bG\r0]\220\266\342\020\3164gr+\025\007z~\023\234\b:!{o)S\nY"
+	.string	"Q"
+	.string	"X"
+	.string	"F\273\342\0037@\275\263\370\023\357\035\352\004\274w\206\331F.\372\354\211vH\320h\332\335OY\300N\260w\234&\3147\251\305\336\241r\316\251\316\217\240!7j9W\316\301\216\217\023\001j4\356$\310\212\"\007z\336\324f\231\247\224\335u\2065\023\267w\333+\266!\330\231!1\3732>\303E\376\217A\370\226\017\337\371\276y\357\256\007z\"\035%I!\313\321\026c\251=\366u\306d\033a\345\261o\373S\232\3462\255\231\316L_\200\207\002\247\351\b8\356\226\030\227,\220.G\213\224\355\247}\030\217\001\273-\304\007\354\362\360\bf\3618\335\020D\204\226J\354\033\035\007\213\206\226\026\357\344\"I\325v\371\315E\005\224v7\002\321C$\262\034\207V\276\251\236\204 \275"
+	.ascii	"\220\251\027o\203\205\332\225=\364\205^C\306\377yg\220\305\242"
+	.ascii	"i\345C\237\362\352\242\253X\333\243\355\312\026\3305\036\362"
+	.ascii	"a\252\002\021\03203`L\353e\341\005t\231x\205\362\002\272>\033"
+	.ascii	"\0162\340L\314\327\001t\241\371V\257\232\017\305\200[.\230\327"
+	.ascii	"g\323j\275\276\224\2707O\221\351\354\246;\220)\265%L\310\207"
+	.ascii	"\34646\216\343\022\216\201O\017\n*\234\245\244\004;T*\250XC\027"
+	.ascii	"0 P\322\361#\225\025\225\312{\367aI(\324\371\214\311\026\252"
+	.ascii	"\366\330\001, \220\202\021\271\353\001R`\036>\317\002\356\226"
+	.ascii	"\264\2560\361\255\231'\020\266\200\025[r\033\317\341V\204q1\206"
+	.ascii	"\3114\334\344H\016'\201\026>\230;\r{\337g\273\036\026\356\355"
+	.ascii	"x\3565\214u\226P\226\205\270|f@]\311@\363G\356V/%\335e\201\363"
+	.ascii	"95k\303jft\277\313k\363*\236|\262\242\013B\001"
+	.text
+	.section	.gnu.lto_pidInitSetpointDerivativeLpf.154.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`P\001\355\r"
+	.string	"\346\231]D"
+	.string	"\261&\035{\240\347\273\322DL\372o\353\305\370\320H\234\351\236.\314\344aV\370\315\243\336\252\246\035\033R\321\343\254m\037\305\225\203J5IwUsG\262\277\207My\001\251\313\315\177\3727i{\223-S\nE"
+	.string	"G"
+	.string	"K"
+	.ascii	"\027 \037\365\001\344\2439[\306\277\021\353q\202\305$\246fw1"
+	.ascii	"(\202S\356\321\202\312\371\234O\247\363P\217W\206[*\2050W\024"
+	.ascii	"\357"
+	.string	"\2025`w\277\272\236x)U\316gw\255\235\207\341\226\267\235\331n`_C\366]\376\353/\277\374\367[\252V\016\020\212\024\024\357'4\273)\323\306\272\210+L\330\276}\030\333s\217\375R\"\201\001\004\334\277\323;6\365\242;p=Z\325>\313[\270\273\2208\356~`1\263\373\0250\201\353\261#\n\255&7<\347\274\261NR\302\323\370\347\2345 \\\261M\"/\bQ2!V1Tzc\251\202TaC\013\033\013\3722Oq\362I\3304\242\357\036\375\021\371\310\001\021S\343\241\245C\211N\373C)\\\261\017\347\2340\fU\002\231\350\344\200\203\244YP\020b\202\220\201tB\241\255dZ0\312J\"Z\b\200A\037 \232\b+E\b\321DB\330\004\355\201\004\f4\"a\037\036\336D\331\b+m\333\b\363|{\250\302\200\303\214\315\214\022\230\242\211\035Uho\024\364\235\277\372G\005Q\276`\034"
+	.string	"\255s\340\314\200{f0x\271\354\013\023\305\371\027\f"
+	.ascii	"[\204\252\"z\227\f\363(\306*h\002\304\3759\344G\335\027\\c\334"
+	.ascii	"p\035(\002\306\201\301|\022Z\240F\013w\t\f\030\204!\367\254\303"
+	.ascii	"\307J\031"
+	.text
+	.section	.gnu.lto_pidUpdateSetpointDerivativeLpf.155.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`-\0015\r"
+	.string	"\026\032[C"
+	.string	"\2576\035S\231kV\276\b\355De\b\027<w\363\321'b\006\346~\246\021\324\217Q\205\376 \376\2176%\f\034\t\326\3010\256x%\370\377\377+\" \2637\253\t\022HUI\326\344\246{\023)S\nF"
+	.string	"G"
+	.string	"E"
+	.ascii	"\032\017P\035\346\001T\207\356\354\023\377^v#\206\004\212\007"
+	.ascii	"\026\273k\251K\227\335!\245\331\371\030\036\216\310\003"
+	.string	"\035nXN\205RMO\025\357\001\305\261\273'=S\274\223L\f\317\356:E\336\312]\335\366\307\266\001\373\241\232\351\324\3649\031$\030\357*\247\335\t\321\305\316\300\020\031^\272\375\3177\271\343sx\207\356%\213\370\256\354%\274\304\320\244\330\335\216C\023\330\034rP\357\330\316\264\257\341\033\272\313\224\030\356Z\030\001b\367\033`\001\233\303\244{B\n2\324T'\312\013\307\030k\250\255\272^\305O\377\260\3710\036!\311\213\016}\022-p\201\202I\306?\306\270Bu\344\222\n\252\202N.%\232P\326\330\037(ud_c\214&\254-\366e~\370\322\035\033\346\340\203\272\256\214\0339\240}\270\020\354\3120\210\007\002L\304\342\024$\300B.\213\001\366\261\300\002\3216\313c\303\231\310G\263\270,\323\254\316\267\327\226G(\321b\306DOP@\035\371\246\237\005B\005\f\332q\325\024\233\223\251v\326 /\362\003\026"
+	.string	"2\003\006j\006\027"
+	.ascii	"k\340\0012\005\002)B\224\222\210\f)c\221\250\225\3110\300\271"
+	.ascii	"\314\326\205\004.\b8\251\252]b%E\270K`\300 \f\271g\035>V\312"
+	.text
+	.section	.gnu.lto_pidResetIterm.181.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\301\001\215\020"
+	.string	"\326\235jH\360\260(\035;\206M/\nJ[\201\254\200\262\223\346\356\370\031b\2377w\331\240mf\224\274(\210\325\251\275>\214\324GthE\373\224G\310\347\3076\351\031\330^x\030\024\316|\031s\016\260\376\342\363S\035d\357\275S\nS"
+	.string	"R"
+	.string	"T"
+	.string	"\006N`{\245\007\331^/r\312\316\361pfEln\264\350\214\273\313M\024\236\247\341Me\352\225N\231\362q~\300D\216\352\225\016\330]\001_\b\272@\272|+Ik`>\037\036\201\213\026\363y\361\301\\~8\330]K\326\327\272\267\333\326`{d\313\220\035|\232W{X\221g\275\372+\333\353\303\223|\342\r\370\032=Y\233swUs\312\330\241J~g\214\035:\354\276\250B\353\205\304w\320g\367\245\326c{*\215\024\207\335\376\313\017-\372\212\263H\035f\236ok?b\264\301\361\263\273\243W\223"
+	.string	"x\r=k\311\262\353\215\370.\276c\321\2471\3122\313\266\327\343\234\252p\005\335\324)\343"
+	.string	"\263\031\232s&G\377tQ\360\317\323b3\026\311\343tw\227:\301?C\023$\006\352\020\001\256d\315\026m\313\021;\303u,\026``\373\303s6\204\314\354n\203\026\217\005\250\216\203\t\365II\204.\205S\241\200\322]\230\300a\350LH\334\311\t\305\225\210\270\224\"\341\304\251\224J'N\024\356\377\031\343\0073J\354\370\361\346\212\007\345Ce\343\004\370\272\3545H\235\t\204\2536\002y2,Z\260l\326\210\343I\233\017\3431H%\223<\313\264\275Bp\005\215@\336wZh\001, `\202Au\364c\020\022A\324\004&1\257\020>%\335\r\003\303\305\206\315\255\240T\220\321\203x\215\261P\235"
+	.string	"+\342\340B\347\nt\350Js\032\303\337\362\nG\302\202\226\023\266\200\345>\260U\265\355\203\255\004^\337\330\232%"
+	.ascii	"\327\271u\246%\345\277\"dF\343\006\366r\264\353\360\273\243\204"
+	.ascii	"\023y]\346\t"
+	.text
+	.section	.gnu.lto_flappingSin.193.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\275\n"
+	.string	"\026\224I@0\247*\035\020m'\356\367\251\311e\377f\243W\335f\202\217\3554$?\2025p&\374\224U\f\355o\304\tIxKl\200\254\252\024\024`\345tH\321\276\2171\200\303F\341\006\266\221\275wJ\0016"
+	.string	"5"
+	.string	":"
+	.string	"O9"
+	.string	"\317\026'T\252\030\347u\240C\300mwk\346\n\225s\364\t\225s\323\344\336\245\347_\366N\3125~\253\323\245Ebw-\277\025\353\236\267\315`\033\302~'[\343\n\234\034\374\303K\333\363c\227\031c;\264\230\031\241U\320\342\227\265\262v{!\260\355\202<\234\263\346rN\036f\321\007\273\006\006\320vW\343\206\3139\333\016r\364\303\323\311\021Y\300 \004%GS\371\331c\237]f\002\227ON[cC\376\263\203\202"
+	.string	"5\216y\262\301\223\234%\366\351\316\026=\354\227\026\004\024\217\325]\tv?\306\006\001\246\177\356\351@\241\216\363gC!\"\325.d!\272\250\250\031\"\017F\375\224Lu\263\340\021\tT\252\335hT\252\030pOw\266l\233\316\fj\246@\213t\227$\342\341o\013\003\022"
+	.string	"2\241/\034\022\224\313\231\371\275\310\270\233\320\\\303\301\0268y\334\373\031\353\201\b\022\002\202\314F\r\013R4\210\n2"
+	.ascii	"\225\306\324N2"
+	.text
+	.section	.gnu.lto_achievedFlappingSinusoid.194.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`#\003\245\027"
+	.string	"\026\356\235H\260XQ:\360\017\017\212\f\027 \230L\310\033#,\255\312\f\215`"
+	.string	"\f\364\366~c\202Zx\004([\354\320\2760Uj\037\346\004\237\226\217\225\007}\200\217\013\364;\242@\034\030\303i\263\036\253\326\312_\263\204l)S\n\206"
+	.string	"{"
+	.string	"\220"
+	.ascii	"\366\375\033O\262E\203\270\r\303|\266\310\230s\212\007m\020\266"
+	.ascii	"x\036\377\350H\026{;r\356\370P\021\224\241\005\250\2037\332\371"
+	.ascii	"<15\tPQ\023\323\234\023\301A\037@\035\364i\274\006\217\275$!"
+	.ascii	"D\b$X\321\023\0218\232\346\234\257\001w\205\007\345\001\204\007"
+	.ascii	"\327\305y.Wy|\334\345\223\256;\036\212\2574 b\213\020\213\227"
+	.ascii	"\2233M8\337\221\256#x:\325"
+	.string	"\323\2039\247u\307;q\203\267\035\301v\005{?\004\253\033*\031\231\354\004\347\301\341G`6\355;l\357\361bN]\203\034\327\341\301\017:h\034\035\375\356\240\257\023\036\374\036\351\020\262\370X\231\341\353\321\237\335\313\351\266\260/\347\002\331R\035s\243\333\365\336\335\222j\030\251~\221j\226T\257\244Z%\325\242T\247\244\332E\252QR}\222\352P\252A\251\226R\275R\255\253\276\314\352(\210w\241(s\232\370e\231H@_\214\033\375\275k\266\225\200k\0277d\311\r#:\305\302\302\211\215\336\024q]\253>F\242\324\272\254\270\037\211\210X\260Rj\031`\231s\006@\255\313\316\030\031\207N\033.jep\214?9\005\027\022\344\264\327\321\304\347\363\022j\316\t\363\177\034\310\005\f\261Xx0\3343\371da)\270v\315\006\375\256\265\003t\213\263\334]p?\376\344\336\343>\274\344\007yf%\375\316J["
+	.string	"F\212\245\227\320Bb\305\264\203\337\257\212n\316\036\002\272\273\002\204\214D9\375\371\001\266\241\301\261\311\211\321^5\033\215f\223\315d\230\331ptj\263\t7\263\330MU\323!&\233\220\243s\253\315R\226\321d\230\335^96\033f\0354\274j\263\030\355%\273\301y\321\310\330v\253\271y\345\330l7/\261\327s9\027\310O\272\001&*\226,\314Q\214G\204\264\265/;\302\366\313\352\346$P\314\302lX%7\225\2651k\035\251\264v\265\254\275\222\361gU\273\332\223\226\261\210K\021\334\246PA\277S\255drr\005\211nq\372\342h\212\224\335\026\336\t3 p\002\221\271\322\016N5\b\304\320\2113\322\035\031B\214V\004\261"
+	.ascii	"\274\341`\217#\376\262I:\316\352\0019?\017&\313\235<l\261\245"
+	.ascii	"\r\366\2569\323u\274\213\004\016\rm\240\351I\336\233K\277|xf"
+	.ascii	"\334\246,Lhe\313\300G\031\221\3738\306\261\276\007\216,\210\354"
+	.ascii	"\031\1777\207\270p\200\241b8\024g\"\303\250@@\20784\275\234\t"
+	.ascii	"&\35706=\243.Ok\366"
+	.text
+	.section	.gnu.lto_applyStrokeSynchronousFF.195.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\214\013\3259"
+	.ascii	"Zc\310\025B@\344Q:\205i\366\250\377\255\304\350:JK\323q\220:"
+	.ascii	"\001\277g\232JPz\257\275-P\324D^\244}0\022\261\350^\302\2323"
+	.ascii	"\372\027\375J\\\236\001R\251\237y\272e\221\027\372\337\032!d"
+	.ascii	"\357$\003F\001!\001X\001p\272<\316\357\346\227\373\337\374k~"
+	.ascii	"6\377\333\217\346Os`7\234\276\234\026\306i\352\226\250\233;'"
+	.ascii	"q\247~\256\205g\3374uu\341\356%Z\306\313\021\271\266\023q\323"
+	.ascii	"#J\264\r\220\253\351\303\275\r\233/Q,ck\366\242Y\210\277\263"
+	.ascii	"\370g.\375\264\205iz\360a\213\032I\201\246\251w\325\\\\w(\272"
+	.ascii	"\366\341w\266\267&\224\375\315\307\335\327\345q\027\205r\347"
+	.ascii	"\272n\203\263\315\365;\333\335\307\335/\363\266\262\2735\265"
+	.ascii	"\201\256['\317\033\327u\035t\202\337Y\253\003h\317\256\177j\317"
+	.ascii	"vY\267\235T\020\327LB\024M\310\324\221\353\272Z\331\312\313\376"
+	.ascii	"\344\324\304\2644TJ\022\006\201?_\313\256\031\227\365\203L\263"
+	.ascii	"?i\271S\22671-]\231\203\202\207WJX\236\324'\355\211\034'X\270"
+	.ascii	"\346\304A\237\327\024\265&\0076\231c\202\177\207\2465\261o=\300"
+	.ascii	"\207\312\241\367I\313\262N\255\345A\362\3511\032S\bn\225\234"
+	.ascii	"]\031\334\315\345\0010\302e)d\006\301\353\220\371\256V\256\353"
+	.ascii	"\n\231g8\257UlP"
+	.string	"\364\206L\345j\205\247N\310\247\277\202\246i\301\330\347\345\272n\343%S\355\r\365\356\207\350\356gwP-\231\315\177\035\365\353\316\247\251\375-\375\242\345\360\227-\227\263\2604\223\270\372\206\224V\375\263\372h\267r6\243\243\"-\004\343t<j\\\270\262\225\2079\347Avf\226p\367W\021\177\t!\257ovP\376HJ\025.\267\261\3059\206\224\320\031~\324\3353^\307\370s\3353\256>\235\0375~[v\264gqF\200\305-\211\253\r\304\335b8\360\227\317\237\276\t\316\216I\2352\233u\277)q~v\177u3\233\207\343\336\3608o\257\273yc\270\334\273\353o\336\026\216\273\002\205\257ys\335\355\237p6o\t\177{o=\315\033\302q+8\232w\202\0267\202\026\367\201\343\316:n\254\3436p\334W\307mu\334U\307]\340\270\t\034\367\200\343\246:\356\251\343\026p\334R\307\035u\334\001V\334"
+	.string	"\216\033\352\270\237X\334N+\356\246\343f:\356\245\026\367\360\270\225\216;\351\270\205\307\035<n\340q\377\216\333w\334\355q\263\307\275\256\2703\213\033\257\270?\242iO\225z\346a\366\270\256\221\352\236[\307\006S\244z\316\360\243GQ\371N\234\201\364\232\3119<\323@\001\262W\306t/\024C\016\220/\347%\374\224\021$\314\317\306\277\347Q\323\310\rX!+\310hz\216!\3473z\272\210x^\212\032\027\006a\310P"
+	.ascii	"r\276K\224\304BN\220\273r&c\b*[\310\207\244 ?e\250<\025\367B"
+	.ascii	"\235\362S\316s\360\\\324\3709\345\fMy\205\263\323\253Sf\2635"
+	.ascii	"\310\224\227r\205L\025\367\336\031f\246,E\367\336%j*\211\226"
+	.ascii	"[\312OCH@\034\2673`\211v\230\225\002\335\320\017\2250\201\002"
+	.ascii	"E{v\230?w\026\214\223N\257\231\214Peo\310/?3\223\316"
+	.string	"\217\264P\2408Gi\276\374\354O\377\"j\024\331\345\023\372\333\374N^Fn,\205\254\244F\221\335\232 \243u7\306R\3121\244t\020rRV\312\177\241JA*\222\326='\035\2756?\225D\234\032\252U;a\246\220\363\224+\007\2630\373\342^\350V\016\346\241t\314\236\367nB\226\220\271\262\317\317\030:/T\231\177YB\306\210\3365(\334\340\335,Z\340/\201\271%\023\345,\2335\233\233z6B\362\352\316~\371m\016C9\206\372\336Q\342\352\202\247\234\031\233\237M}\257\256\233\304b\363\363\244z\326E$\361D\330\221X\264\001\224!\203\214\354g\203\210\024C\002\301\210`9\210dB\033D\262cQG\361\204X\n$X\022X\021\371e\004\0033\212\221\345\b3\242\230\021f\334\221DF4r\b3\022A\024\277\302\212\306/\262\342qlXD\022O\034\305\216\307\0174\276\220\306\261a\177="
+	.ascii	"3\216i!i\3140\332\220\241\025f$\336\320\372:\222i=\220j\261\261"
+	.ascii	"\342Q\013)&v\324\022\276%\277\272\231\255\333+\231\225O\3719"
+	.ascii	"\005\351\254\212i\"\310Q\376\022\355\201\214\340\311\201\274"
+	.ascii	"\302\031I\257\231\345$\261"
+	.string	"\304\303\312Y\371\357\032fB\002\253\2163\222\030\247\374D\364\276!\274\204j\257\316\242$\256\"\031s\356\205q\324d@\255\003#\0039\200\322M\320\213\227d\352J\003\321t2\022\323L.]\341\"W\330\271\310Nsh\205\326\201\321\262*[ev\372\342%\273rU\246R\2665\362@\344\203\241\r\331C\201\274\201@\036\220\013\340 \037\b\344\254\0019J\332&\350\205\006\321<\241\242D\245\004\261\002Z\342ue_\246\312S\3126\352\273\346\313\375:lv9\307j\223.\361\222lm\366\3456O\211\253S\271\315\215\337E\002\262T\236\312\207\024B@\256\"\324\364\312]Y*G)\313T_\350\0223\n\237\244\374\354\250\374\200\345\250a8$\221R\210hD$)(I\322\001\260\002\221\241\242z\021\3604\310$\022\032Q\245\316p,+X\306a'p5\035@\207S\205\026\034Ok\001\351\275\352i\rU"
+	.ascii	"*Bd{2\322\357\372\204\205B\007\341\3711s\026\236\375\377\302"
+	.ascii	"I\215\207y\264\034\233\373_\3145)yB\221\202k\021\r\244=\323\254"
+	.ascii	"\376K?\021\035\365\031a\247\370\320#*\374O\355\247\253\271)\023"
+	.ascii	"\356\315\276\231\241\024\372\220g\235X\033\337\30101\360\301"
+	.ascii	"\317\242\312\232\332\036\377qI\353F\236\242NC)\305\b\324\277"
+	.ascii	"M\340B\305\333\320\004\f\t`L\021\262J\t0o(\025\221\202\376\345"
+	.ascii	"\020\340#\331\377B\327\202;\004\3260|\r9#\020\270\td`\346\265"
+	.ascii	"\307\347\246K0\3500\276Y\376\337\"\364\237\0053\260\310\250\235"
+	.ascii	"7\312\332\021\336\345\270#\2111jF\312\020y\257\266\320%r\304"
+	.ascii	"\3356,\267\225\217\266\233f\016\247\211x\274\005cT\024\0260\257"
+	.ascii	"%\261\310\273\270\t\3066\222\005\360].0P!n\335\247\224\263\355"
+	.ascii	"\317\266\035\363\222]\262O\025\206\342y[ATTJ\024j\302\262:0\327"
+	.ascii	"\351N\353D\264\320\n\223 \302\265;\245+A*\027\204\031f\306:\375"
+	.ascii	"{\003\334d\233\344\304\365\320\223\273\317\222p\345\021}vQEO"
+	.ascii	"\262V\214\367\310T\356\356\027\250\030\351xG\253\311L\346\335"
+	.ascii	"\265!\261\016\233d\307\267\275\253\022\214f_ G\3213\362z\\\\"
+	.ascii	"\260r\024\252\305\222\t\032\\\031qt\344s\262\250\037\303\016"
+	.ascii	"q\263YU{o\313\340\347\345<\270\231\022\037\244\350\312\331\356"
+	.ascii	"\261\240\245\322'\305\027\275\354\305\375\017"
+	.text
+	.section	.gnu.lto_applyEspelho.196.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\302\002\r\026"
+	.string	"\266*\224I\300VQ:\024D\344/\315\313\333\3552\021\224k$\257=.\235\320\035\326#\202xt\037e\200!\205E\373\337\312\245\377/\241@7\352\251\336\005\"\031\204\270\225|\354@#\224\341\334\013\202\2154\350e\375V\362\t\331R\312\024\200"
+	.string	"s"
+	.string	"\205"
+	.string	"\332\272\366\001\3668\334\034\275\324\026\352mR\322\013\001\354\356\031\r\257\300hJ\315\372^2\0011\240\253E\367qT7\211\031:\272\373\300\t\214\032\376\277\306P\031\265\277t"
+	.ascii	"\004D\303\246\267A\003\022\224\356&\005(\214\250\341\324\027"
+	.ascii	"QCF\2415\235\274\265\253M\247K\021\245r\307\363\240<\013\020"
+	.ascii	"\005\361\300\302\303M\230!%\224\350O7\210\227\333=\335t\367w"
+	.ascii	"\307\023\322\207\372\277\301\177\006?\317\004\242\206+fQQt\333"
+	.ascii	"\340\307\375/\314Vw\312\372S\027\246&\"\232pl\373}\266\345\023"
+	.ascii	"\277\316f\023\377\356c\324H\225"
+	.string	"\245>\325\027-Ru\321#}\213&\351W\273_\331\275j\367\251\335\243v?\356\376\024\356\305\335\207\273\237\273\347\335\357\334+\200\035\362\001\303\305\222\332`\322\335!H\245\233\302\035,\364H5I\367\257]\221\364w\325\021\324\3244\351'\254\272\027\"\237Xu\300\233\362\320\036\021\256+.\241\325\0225\024Y6T\366@0O\016YD\322\265`\361\013O\236K \350\322\313\261\273m\256\245\352\310\271\353\265\272{\211\0322\343\f\345\210\262\243\324\022I\214|\375\005\301\240\223\\\367Mf\271\205U\210\356\005n\203_\361\362\251\310\215R\007\274mp\227\236\f\031\301?\342\212\331fdF\r$\271\225\362\037\2468*\214\335\271\004W\245\f;d\212\356\326\025\030\002<\260\326k\276\264Es\351<\340\201\315F\027\255\205\023\223\375\274\306\031\314\2475\237C3\001\326C\322t^0\013\024H\036Xk\207\314\221\315H\232"
+	.ascii	"\217\365\270d$-\026\223\221\252\377\367\265\316f\023\037\360"
+	.ascii	"\373@\3041*\342\307\253\262/\377\257\314\n\007\375_\341\337\334"
+	.ascii	"\0307Y\254\342\030\236BZ8\305*>\325P*S\314\364\222u\344\207\356"
+	.ascii	"\232\240\2309\305,\270\033LtD8\024D\222t\220\221Q,.9q\310c0 "
+	.ascii	"\240\"\031C\036\244\304\361va\224vE\0215>b\004r0\355\253G\260"
+	.ascii	"\031\342\302\261/\246\354mY+P<\036\343\201\326\237\036RCQ\343"
+	.ascii	"\353\016\347\257uP\364\357\360\024\316\214C{I\215\007\250\340"
+	.ascii	"\356\035\247\331\347\017\273\202\304\331X\310\201\240\"g\034"
+	.ascii	"!9\361\307\205\314\311\214\221\303\265\306\200\030\026\020Z\001"
+	.ascii	"\226\343\264F\236\213B\001"
+	.text
+	.section	.gnu.lto_applyResonanceFilter.197.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\365\002\275\026"
+	.string	"&\353\225F\240\332\230t\2407{:\021\257\035-A\371X\327\264\242\330\001\355\306\213\340\023\306\206Y\330p@\377Z\004U\314\231\346\267T\007\221\020\343\360d\365:\204\024q\3103\206+BX\341!\212\201B\261\261\032\324\b\221;\245\202"
+	.string	"r"
+	.string	"\205"
+	.string	"=\210\032tz\030\200\036\216\033\374\216\307\263\263\360\363\360\273b\347\217\025\236\022\342\356\"8i\b>/\013>\337\363\320\243]\237$Cv7\201\r\210N\332\366{\334\307\314\036V0a\342\307\003\036\217\023@\272\354n\212\300Q\240\223\343O\240\223Z\343\263\217:g>\355#)\247gJN\307\342:\036\270a\302\"Fg\033QPp\254|\347\023\205\3566gH\302\356z\346t+n\362\266)\330\336`\253\205\241i\307B\314\347\256\337\371\214\017\026.?6\245\331>\332T\032\366\307\325\031\246\371\357F\035x\237\356\373g\336\373M\327\271e\036\274K\237&}\032\346\323\243O\213>\035\3724h\234&?=~Z?=u\372"
+	.ascii	"&\214+]t\3748\017\222]\025\305/\373C\026\311\361\337\017\374"
+	.ascii	"u\376\340G{\346\347\034\310\203|\307$3h0{\220\304\027\267\"\210"
+	.ascii	"\274R@:jHO*H\217#\326\214\374\310\212\325j\201N\222z\340\r\325"
+	.ascii	"\223\216z\334\356D^\304C\037\207]\026\316\347,\324\357`L\341"
+	.ascii	"\271\230Q\223\236T\205,\361\3608U~\276u\204bQ\313m\267V`\252"
+	.ascii	"\214\276\tn\207m\026]\322\251\241(<\\p\304\332,N\"[\240\310P"
+	.ascii	"\022\240\222*MJ\226\034*\267\351\305\266\207\367\330\210vo\016"
+	.ascii	"|!%\312\224\215\335=\216\021\240\223%\215\271\321\253\315\242"
+	.ascii	"\003/\227\2525\266^\303\222\251>\204\250)mF\262XYN`\255^\252"
+	.ascii	"W\031c\301bT2V\207\f/WL\304\222\251.\300J\030\2145\362JA\215"
+	.ascii	"\013DJ\326\241\345\372\300!\365r\251lR+X,\245 \200K\020,XJV\226"
+	.ascii	"\260\024\311\267\037Wg\030\300\211\027B\245y\214 -\204\323\244"
+	.ascii	"$Ea\233\244\226PS\333\210R\223\322(\356FFa\0245R\030\025\200"
+	.ascii	"\323\203d\244>\317a\021\251\352H\365\b\356\346I\222\024?NB*\322"
+	.ascii	"\001\0015 \220\"\021d\345\001v\204\236\\\234\246\n\234\331\275"
+	.ascii	"9\244\213\310\2648\276\324\037\fL5\016\201(\213Q\"\216\231\365"
+	.ascii	"\034\001\336\020\022\005>L\374\360\350\021\271\305\223<6\355"
+	.ascii	"\300\222\005A\201c$\314p8\306\303\307\341^]\243\027h\254\344"
+	.ascii	"\375\254\205g\f\217U\214\233\3220\207\210o4T2A\036\217\361\025"
+	.ascii	"D\35186b\3330q\300\005\315\225Y#\202\001\013p>\223ry\256\274"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_advanceFlappingPhase.198.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\301\001}\017"
+	.string	"\006\035iG\360\260(\035\360{fq/R8\376?z\301J\332e\207K\365;\017r}\360a\273C7\364\236\313\2763\263\366\377\365\234^\267.m\367UlX8\f\213\\\236\350>\252\303\\\0019;\242\245\317\206\b\331[\312\224\002Y"
+	.string	"K"
+	.string	"U"
+	.string	"\250P+\245\003\"\203\301Bbg\316\232\267\031\216z\307\311\270\212\362\001|\251w\003\316M\270\214\006l`9\036\237+\026"
+	.string	"i`@_K\343\002\0137`8(>\n\337\210"
+	.ascii	"\244\201\361\370X\361\303\006\226s\332\265\345[\251v#sN\353\353"
+	.ascii	"\223pw\3346\311v\210\255"
+	.string	"\004\002\366\343\234szc\354\317\376\217\325R\325Q\325\253jU\365\003\254\354\274\270|\277\265\230\363\245'\307\254\221,6\330>\331 \333\252\366?|\346\364\231C\177\346t\021C\305\2343\304\007:.A\376\301]\306\013\340.m;\201\202\223\003\312\243+j\330\\\210kb\273\233\333\f\027\207\3255\274\300\232\335\230\303\237`\261Q3\315\261\346T\211t7\205\343A\304\013\226\362Xw\304_4>\373\325\275\013\\\035\304C8\364e\034\3017\375\353\322\367\215\273\374\236vQ\007\034\031p\246\202J{\354ZJ7\026$\246\023\024\006&\234KDLF*\236\t\305\301(\245\201\007aD\362\300+)\255x\"!\223TNJ\236\211D*y\240\332\374\3068E\206\303\026r>\212;\355Q&\303f\333\037\305\311m\261-\327#\252]u\033\343b\212\270\335M\030\272\300W\211\026\006)\322\r\271\314R:74\254\035"
+	.ascii	"\037\0230\252\2162\265\353\214\313\032\030\006N@{\001\206\203"
+	.ascii	"\326:*\260Y\361\341\n\n\355@`9\320\326*\340\007\3438.\274\037"
+	.ascii	"\216\201u\225\222\241\025#6\265\312\273pW>c\261\245\351\244b"
+	.ascii	"4B1E\227\202\002"
+	.text
+	.section	.gnu.lto_applyFerocityWaveShaping.199.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\201\021EP"
+	.string	"\232\211\b\036Q0\222\312I\007\364\203\022B}\316\240\3639\3165Y\246\324\265P\356\276k\004"
+	.string	"\244$f\207\335\360\322\237\365\201t\002.\375\215\206E~_\324|\007Wb\340\302!\350`\020\360\273aID\177?\210T\343n\013\006\3659\f\275\363\236nM\032\2212\311\335\001\203\001\322\001n\376\206N)\305\254\215R\205\244\322\271\302Y\255Y6\310\265)\271\234\265f\311\260\246\367\006w6fG\305\007G\"\314\0304O\263\013\334%\027b\201p\205\001[\262\013<\257w\233\354y\270\017o\336\313\1778\020\027\363 N\346jg\273\333\337~f\201f\254$k\255]e\300\244\264\205%\267\326\310\264\215\331e=\215\311\253\261v\020G\214\213\021\315\207\342\230'\305\230\311\3270\333D+\227\n,\246\331\215\201y"
+	.string	"F\n\223/]\033\234\201\235\035anSI\354,\252\207m\276jUv\213#\246\306)\244\3136\225\254\226\325+}c\263\033\263\253\265\2668o%\360qYf\221O\265*\033\341\214F\353p\263&\327\262L\"\365&x\205=\235\265.\2276\306\322w\2404K\225\002\226\333D}*VQ\204%\337y\313\274\373\261+\233\234l\233\373\253u\314\334Y\255uiW\370\316S\272Pz\036z\240\364\274\335\335\002\016h\262N\212B\240r\243\0246\347hfW\353\222\251_\270\223'!\035\031\025\021\r\t\005\001\375\214\360\351\t\362\354"
+	.ascii	"u~\276^\312C\233\235\354\251\236t\2438\304\022I\354G8\334\b\207"
+	.ascii	"7a\\D\004\366\241+of`\241 \257\003\305\340\305?\250P\t3\\\275"
+	.ascii	"L\226\f(\013\247\227:\030x\304\253\304\356\323k\232\242U\345"
+	.ascii	"=+<\330\265\002\363X9\361\225\305\305;\300^\323\024-\025\256"
+	.ascii	"S&KJ\024\376\365\232p\024\325\322\214\301\231\2425v\337\211)"
+	.ascii	"Z[\357\035\277\262\2668EYt\245Ay\231\254\024P!7\027\326\030\231"
+	.ascii	"\347;\341h\b\300'V"
+	.string	"\334\301'ET\251\326\3723g\254'V\314\275\246Z\353\362\325\023\255/\211\357\376\314\356\262\355\366\320\020\306/\"\375\324\2173:_\274\233H?\315\321\272.K6Dh\351*\362s\271\273Y\3558g\027\203\337\t\361\325j\005c\017\347\003\241\317KIz\036\367\315\324\220U\361s\203\274\013\225\001\377\352\315[\326\005\321Vl\252\005\262\001\275\253\001\022\376\025\214\376\231\377\204-6d\301qZ5\325\356\262\310\215\334=Z\233\312\016\231\367\311\307K\204y\207\234\313\177A\020 _\363\375q-\277\017\346\355\301\274\023\274\315\227\307\351\276;\316\374\352\370\3317G\0048 x\200yo<\314\327\306\307|\0358\332\327\211yk<\355KcF\323\327\2762\276\374\033x\333\227\201\227\371.\360,\277\002>\336\004\2307\306\315|a\234\3547\200y\t`^&\346}\301\274K>^\027-\336\345\313\342=|\007\370\227\257"
+	.string	"\007\363]\301\274\0010\257\n\346M\301\274(\230\027"
+	.ascii	"\346=\301\274J\314k\202yK,/\211\345MZ^$\346=b^#\346-Z^\242\345"
+	.ascii	"\035Z^!\346\rb^ \346\375a\336\021\313\353\263\274=\313\033\\"
+	.ascii	"^\236\345\335Y^ \363\3520\357\217y}\314\333\363\361\246=^^\312"
+	.ascii	"\213\372x\273\307\313)\357\241Pe\330\2619B2\354\331h\226\265"
+	.ascii	"\204g\234\332\306\373r\345k~\271\337\371\267\371\351\376.\177"
+	.ascii	"\017?\363?\373\277\374`\3760\377\230\037\355O\373\327\376\266"
+	.ascii	"\277\314o\346@\273B\354\343>w6\017:zE'u\233\035\301\220:}K\323"
+	.ascii	"<\222\2419ZG\247E\2668\002t\216\376\033\033\232\035#\bZ\347\215"
+	.ascii	"\255i\324E\375@_\215\265n\224,j`q\355iL\002\033\031A\353\274"
+	.ascii	"\255\315\341\350\364m\215\315\210\366*w\3163\235F\026\221p\227"
+	.ascii	"\203\2337\366\362\306\255\205_\217\n\323Q\214,]j\254\325\222"
+	.ascii	"\204K\016\314n\251\227+\bc\266\271\223f\310\312V\025?Q_#y\305"
+	.ascii	"\204PB\262\327T\326F\303h\240\233\334\\Y\232\025\337}\206\253"
+	.ascii	"\256\266\264\221\313\335\3422\266\204\221\200\272\270\213\306"
+	.ascii	"\"j\"C-\324D\335q\307\255\243\036jT\355H\366,\302M\212\026\352"
+	.ascii	"^QM\314\221,\250\201\332\006\232\003\355\324A\215\306\031\273"
+	.ascii	"v8\326\265\245N\r\324\301\262\264\247\361\313\201!?\335in\\\030"
+	.ascii	"\"\313\222\316\251o\254\033\321is\306d\215>\352\264\256F\247"
+	.ascii	"t7:E\247u7z\331H\347\242i\364\345\034\347T\3613\3455r\377F\217"
+	.ascii	"\367\351\032=\035l\237\356\311\231\321=]\0247\243\203\3353;\202"
+	.ascii	"\025\371\311\\k\245\352;Iy\272\347\224\301Y\361\335\3564\260"
+	.ascii	"y\032\215;B\3615\365N\363\324\216c\315\335e\024M\r\354\017\270"
+	.ascii	"\314\024\321l\001c\240gt\223qc\374\222\321\013tS\247E2s\334@"
+	.ascii	"\313\350&\363f\354*\3524\003]C\372\327:\305 \277\276\200+\r\216"
+	.ascii	"\002\355\353\005\372j\306\344\260{\355\353\033\273\212\\\231"
+	.ascii	"j\233{\257\255`\231\374\253"
+	.string	"e\246\347\365T\270\305\265u)\267^\304c\364\220\004:F\332\t\364\341x\235Z\3609\034\360P\257\243\rgp\234\305\346\221Xd`\241\256\214\347\363\316\252\326*\024O=lTNkD\203g05c\203(\037G\204@\222 \021N\365\210C!I\220\b{\f}H\246\244v\020yNE\370G\021\236\222\">\tm\f{C(\242pj\tQ\250\344\347\304\204\1770\341)a\024\222\250#)\361\036\020\243\236\244\246\240\212\370\20672\344\241\020\342\360G\301P\3100\b\305A\024Q\310A\324\024\224\023q\211\024\317\020*\211\320\210\017\342\022\251\237\022a\024\215(\336PJ\307\020\025\022\241\214\020y\373\364b\030\225\204\211h$\203\250#E\2306\210\022\"az\232R\302\364\242h\245\222@M1\021\245\244\246\230\200\313\252\243\265\251\320h\356\342&\241G,:\351\350\205\351\323\"\200f>s\325\246E\253\350"
+	.string	"\372\306\257+<T\360\242t\211\201\263U\205\324\310]q\004\202i\024\244\223\216@\220\025\001i\026\215\265ru\212\fg\026~\356\021\220\016\322@eph\214m\214\210&h\027\307\037\346\f\365h\002\032\253sxSC\031\333\217\036\240\201t\260\b\307f\374B\321"
+	.ascii	"\364\017\347Qt\t5[;\032\200\016\226\301\211!\240\350DO\320<3"
+	.ascii	"c\233*~\236\350%+L$\367\036\375;\222\363\006\264\241F\002\251"
+	.ascii	"\350\236D\374\272\317\275\356l\226y\305\243w}\374\340_\355\271"
+	.ascii	"\334)\333\214M\265;Z\251y|)\365OQ\r\032c\322D\243;\372r\214h"
+	.ascii	"9\332D\377\315y\224\251aC\240m\256\006! +\270\037*LLA\215\344"
+	.ascii	"\030>T&\220\033\035\0266Q\250\270~\032\271\242K4\b:Jt\320\205"
+	.ascii	"4s\306\344\210F\236\243@a#\347\023\374\241\361\274x\321\003F"
+	.ascii	"\tV%\370\363Bw\205\247\221\333\303\202\002\020\202\026\332\242"
+	.ascii	"\\\323\211\240\007h\254\036\026#\360\250\205\216J\246N\212\026"
+	.ascii	"\240\261z\312:\340\003\315\263EI\246\203\243W\220Hj\244&\001"
+	.ascii	"%\201K\250\201@\303\020S\210dD$H\n\222$\035Q\005\304 \t\2512"
+	.ascii	"\017\0210\241sP\211\210\220\222$Ic<\277h\232\231\256\237Y)\320"
+	.ascii	"P\242*\215\031[\215l\322\257\023.\355\036N\252\251"
+	.string	"\3144\030ST\310\240\216\375=(_\242\2719\312o@y\2729\253\225$\254ZF\215l/"
+	.string	")#\2228,\361\027\206\372=\246\023'\030\201\236j\362\2420\370\217\210\213L\257Gy\334D>\002\316~\226\322\211\230\376\241\246\006\264\347\204"
+	.string	"\274\0365\341bC\244a\0322\320Q{\203pK\241\235.\032\355\321LO\321\271R\201\027@\213\345E\0343n\200\366\337Q&\266\217k\006\351\215\357\201+\344\243zA\266\240^R<\330\252\206\030\202\310\b/7\241)\273\317ga\200\340\231\322\304\226\013B\250\330Dx\351B\200\263\300\367_\2470\b\256B\316\216\206L\246\350l\323H\204%\0069\331\203w`!\232@\261\3207I\235*q\r\225\233\r\026\305ujV\220\3730\247\304"
+	.string	"\327\371\333\237\320\345v\224\237E\n\276\036\223\203}0\252~}\200\207\300\357\361\306\346"
+	.string	"\253"
+	.string	"\022\021\361\222\220\205\233\032\230 \300eM[\205IU\314\251\254[\273\324P\r\225\333{\342\352+\336\205\350n\255'T\371\001y\252\\B%\324\275\252f\\"
+	.ascii	"\tA\327\230\232a8\254\362l\271%\251ew7V\024\004"
+	.string	"V\031f\204c\303\200\325j,\313\035\201\270]\257\273\364$\337\205\376<\025\365C\354h\344\227\251\016\350Q\242\342PU\016\331u~\"\331\2774C$\030\300F\276\362\3655\t\315\247T\241\206\237R\331\276\371z\013\330\261\0018D\375\343\256F#k\360\025\375J\023^\264\267x\275\240\305\210\360k#\214\266Gf\255\005\2232\233S(\024J\376\221\3205\271\031\261y\350\240\277\330:U\030Z(<\212J\231\235'\324\265\200\200\331s\342'_\274~\372b27lg*V_\254\356\\/\242\252\f*r\306\037\256\362f-l\212\256\035(\370\232\250\315b\341;\241\007a\2550\241K?$\252\326\302W\242!Ss{\202,\223l\237\300(c\n\341\315\336i|\004%\300\"\002\013\200\212\333T\246\036#h\302\324\034(\n\243\221\335TE\301/\026\2376>^#\013\234X\376\317\342I5\356\225R\205\030="
+	.ascii	"7\344\240\002"
+	.text
+	.section	.gnu.lto_calculateFlappingFromThrottle.200.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\365\033Uw"
+	.ascii	"\372\310L+J \322\322\031\016\277\220Q1\025\230\303\326}\337\016"
+	.ascii	"=\254\003\324W\372\350V\344\035\002+n\224\030\356\376\360\324"
+	.ascii	"\032\232X\034\3225\256\354}\331\324u\251\210x+\272\013\340F$"
+	.ascii	"\200/\tk\020\207\371l\177\350$\243&\"D\312$\003\223\002Q\002"
+	.ascii	"\304\002\274*\316\213\304\274)\230\027\305y\217\316kt\336\"\346"
+	.ascii	"=q^\242\363\232 \362\016\021y\205N\375\006\021yK\fyI\234\027"
+	.ascii	"h\310;\342\274?D\336$\221\327\247\310\213$\362\036\207\274\306"
+	.ascii	"\277}\213\314Kd\336\341y\233y\371\274\177\231\027N8\264=hig\272"
+	.ascii	"\016\333Z\245Pp\305#\272!s\276\277\316O\347\347\341\277\373\361"
+	.ascii	"\376"
+	.string	"\274_\316?\347\207\363S\377\271\377\315O\367\257\371\343\376\267\237\355G\363\247\271\211\335\357\236o_\347}{R\360\320\252R)}t\366{s^w\307{\017\327\333d\336\017d^\216o\366\314\021\222Q\367\244\264A\253\306\331\357p\273M\316\361\321\023dC\253n9\236(G+i\213m\255\3423&\b\207V]W6+p\366u\233<\361S\246kk~m\356\3469\\\207M\322mq\276!Cv\256\271\245\016W\270\223\255\325@\226E]\352\327\260\225\361\004\327\324\374\252p8\233\270\254\257\3145\313\313\332\024\277ue\203Zc\324\253\326}p5{\270M\276-\035\230O\333\235>\017\216'\016o\303\333\356\266\311\265\221C\3714Z\303\365\271\266\036\020U4\263ue#\202f\351\300\212cv\352v\260-5\251\213m\025S\324\313SES:qo\034\317\273G{\232\362jK]\344\272\326\311i\263\256\353"
+	.string	"\033\343xb\322\211\212'\016?T<qW\271\213\347l\323\325(\355L\323\255\272\256\353R\177\371)\332\341\207l_\025C\345Y\254P\201\224\002\305\221Q\321\t\"\023CBA%H"
+	.ascii	"\215\370I\372 \217\306\"q\330\254\334\373\200m\235\305\n\265"
+	.ascii	"\275\032XE\332\221\320\236\002\255\357\f\243\330\373\013)ui?"
+	.ascii	"jadV'\206\213\310\374\304\230\023\rg\370\315\001>\357k\314\220"
+	.ascii	"\250\312\030\347\355``\023F\036uw\261\247\212v\326%\214\314\207"
+	.ascii	"\316\334\302\260\320\013\017z\201\r\030.1=\211\3510)\357+\312"
+	.ascii	"@"
+	.string	"F\036@\306\360T\321\002\273\204\255}\304\360\207\257\214\226\347}m\031\336\310\022\307w\270\267(\373Z\201\177\214<\\\bc\341If\341>-\272\204i9\262\354+\013\037\207(\264\274\354\353\311\306\341\214\274/hq8\003:G\f\b\2149$\352a\314N\022\254\311\304\341\213\036\306\354\240\200\316\021\213\302\303\343\2257\020\330r\230\264\256\353\335\316^`]\314F\036\353\272.;\301\302\276I\337e\021v\227\314\356\321[4.\325/k\241\261;y\230\320\345\224\245\302\230J\261\200\f:D5\312R_\364u\025\201B\2070\343\255\245\322\230\362z\004\211\0314OuwO\020\363\301\245\306\350[\327U\307~\317\0053\330\2139q7@\202d\006h\036\263*\027\027vg\211\343\213!\331\322e\243\322\031\251\364\303\0359M\263kR\217J/\266\327\336\247\245\253U\254\376\013z\247:\304\n-\324 \220-\335a\377"
+	.ascii	"L2l$\037\236\013\230\211\346\035[\272\177\177\267\r\200@\264"
+	.ascii	"\361\300W&K\033cK7\253\273\237\327v\027\325\335Czw\336\230~\\"
+	.ascii	"\\\370\325s\027\246\257\330\322Ez\213\303\303\360\210\346\347"
+	.ascii	"-\216Z\037\277\276t\305\250\366\n\342X\335[\200zD\352\356\262"
+	.ascii	"\213\367\377\332\354\272\270\210\257\234\035\250w\303\226\356"
+	.ascii	"\377/hZ[\257V\221{I\333\017]\\\304\356\363\334OK\t\023S\361D"
+	.ascii	"n\033P\276\263\275\235\337Y\352^"
+	.string	"\3146\255\034\337\271r\305\023\337I.\200Sh\332\223\213\013w\004\3138TqW\252\t\337\211\325w\373\2674\341\370\005\372u\365\326.\333\222[\272\373\233\241!\272\266\355e\367e\237\376\213\364r\276\037\373\234\357\271|\356\373\350\337|\017U\341\312\351\276\027\273\225\207}\235\357{*\257\363=\n\277\373\336y\274\357\2470\357\273\236\367\375z\266\257\t_\363-A\353j\177\326\323|\261N\347\353\204\352p\276SM\036\367\005A\352h\276Q\347\205:/\223\363>\235\327\351\274M\347]r^&\346\375\340\274J\216\274\036\034y\223\234\267\203#/\222#/\007\347\335\340\274\032\2347\003#/\006\347=r^#\347-r\336\013\316k\301y+8/\221\363Rp\336!\347\235\340\274B\316+\001\363B\300\274A\316\013\344\274\017\234\327\201\363\3768\257\217\363\3668/\217\363\360\335q\336\006\316\313\300y\0278\257\002\347M"
+	.string	"\311\213"
+	.string	"\222W\307y\017@\362\032\200\344\315q^\034\347\275q^\033\347-\340\274\004\234w\211yk\234w\200#/\215#\257\322yg\034ye\034y\0058o\214\363\3028\357\013#o"
+	.string	"\347uq^"
+	.string	"\316\333\342\274I\347eq\336\025\017\fW\270\005/Jo\341\020\303!\rQ\215&n\021\322pi\177\254k4\0176\305\226JM\243\007\350G\245?\f\320\310g_\235\245\026\325\242||Gh\320Y\271\253\350\236\336R\215fQ\276<\245\006j\023\274s*\300\002\264\214\236q.^\312\024\306z\270>{k\357\252\254\334\214F>\355\346,\265\230\303\0162\372N,\034g\345\240D\351T\235uK5\242E\367\314N\204#@C\211\322i\253\263\006K\214\206\321\347\322lG\027\243_\200yrQ\031L\241\005\300\027\r\243\215\006\231e\001\364\213\036\3561\375\\`7J\260\273\365\255k\227\216]\245\025\236S^\251\321wb\233"
+	.string	"\372v\007\202%J\347\314\315\241R\274\352L\270h"
+	.string	"\372\3216\352\355\201\303\204.]4\320r\317\035\223\f"
+	.string	"h\033\365\212(d\222\311\251"
+	.string	"@\263\230\023'\251Yt\213>\023\272\214\313\222\324\3105+\260\350'\3219g\317\025\r\267\205\316\371G"
+	.ascii	"\253\340\242\034\343;W\270-U\252\242\261\242:\234=\333\272\210"
+	.ascii	"7\316?\266h\016j\rDs8K\321hw\376\251\320(:E\277)V\203\326\027"
+	.ascii	"&\024\215\344\203\022\037\365\2562\214\022\006\025:\351W\332"
+	.ascii	"\250\217h c\324XQj\340\363b]\324\277\3227\243\214a\345\212\332"
+	.ascii	"H\224z\366\274\241\t\210W4\241/\326\327\341A\364\002\3630\313"
+	.ascii	"\206Z\2720\232A\214\t\">\253x6\277\330[\020\320\022Z\r\302\211"
+	.ascii	"\021,\300\211 8B3xD\r\324&tr\254\252\207\tej\023M\324M\004\263"
+	.ascii	"l\250M\364\320\215\351'\324%z\250\215\3300\311\226Bmt\247IH\242"
+	.ascii	"K\224a2cH\364e\210\276\005\2525P\363 \323\217\313\f\213\t3\242"
+	.ascii	"\317\346\304\257\350\333\231\032\027#5S\027\207(\241\221z\231"
+	.ascii	"\t\270\244~9e\005\274u\335\035\205\205x\272\326\225\313\305O"
+	.ascii	"\227\320\037d\226%\373\247\333\215\351\207\365\364\351d\027\335"
+	.ascii	"\220\355\323o\022rq\241\023\226*i8\362\030{Q\236)\317(\323\224"
+	.ascii	"i\305\023\221\215t\003B\037{\250\255z\327$\024j\351\203\332\313"
+	.ascii	"\006=\253\250\325m\203`\230\341\263\212\306\326jf\263\306\321"
+	.ascii	"\036\307u\3552`y\013C\177<\020$H\361Dc\237\315e\364 \350\005"
+	.ascii	"\232\246V\242\245\201_!\t\026\350`\f4\\U\022\304^\322\306Y\210"
+	.ascii	"m\003:x\366\244vE\311\003\204%\002"
+	.string	"(P=fV\204\254"
+	.ascii	"\254\373\032\262rF\240\200f\267\303),\225\310\312\271}\250\006"
+	.ascii	"%b\004\334ehI\276\254w\350Sl\251\366\222\352\343i\373\341\037"
+	.ascii	"\256\353\272\376\004\004\bqz\272b\232\032\301\251\212*Y\001\323"
+	.ascii	"\325S\324U\321\351\351\212\311j\204+&\021\220NT?\230\240\236"
+	.ascii	"\250\252\216L\236\246\214NUC\254\216T#\024\311jb\202z\232Bb9"
+	.ascii	"E\340\204)\252\311HeUEA\223U\361\311{`U\371xr\222\232\202\002"
+	.ascii	"r\232\252\212\022\341\311*\312\310\023\tRWML$\260F\350AUe\005"
+	.ascii	"$\204'+&\311\247\251\253\253*\253\250+%MV\311m\252\341$\365d"
+	.ascii	"\351*\nJj\212\311\222\023)&\252\245&+\021\226j\030m\325\223'"
+	.ascii	"\253\245\253\252*\253\245$\033\327{\311B\005U\357\200j*\223\206"
+	.ascii	"z\352\035\315\244\343\236\226\334\244\021\\\201\204\234\316y"
+	.ascii	"5\251GJw\322^\357;\022m\216\205&\025\351a\257\262\006l\314\021"
+	.ascii	"\225\023\025N\372V\372{'\206M\335\250\332\251\037\326\324K\332"
+	.ascii	"\351\206\206kR\323nK\372uS9$\276s'7t1\223\342\203&r\245\251\363"
+	.ascii	"\325\247\322\037$i\017ZI\337\371e\203\222F>\327\324\246q\235"
+	.ascii	"\346\301\231\225\273\232\276\3250\215\353\263$\r\344&\245\220"
+	.ascii	"\203F\322\035\034\005*=C\007\215|\312Pf\372\326eH\232l\345\240"
+	.ascii	"L\325\220\231\276\365\030\016\032\312T\315\006\255A\037\205\026"
+	.ascii	"\263A\006\255\001\006\235A\227\006\323\323\376\202A\277\357@"
+	.ascii	"\260L\325\2408\322F\372\316#\r\264,,4\322E\372S\332\250Wx\327"
+	.ascii	"R#\315\202\360\202\266\240\213\364\330\005\315\305\202~\022%"
+	.ascii	"\254\240\243D*h\026\2104VT0\220\202\3262\350\374\033\322\023"
+	.ascii	"4\005\317!]\344\303SHK\320\0234\026!b\022\364\305\242z\002!\350"
+	.ascii	"\260\256\016\322\020\364W\020 ]\017\264\217\006\322)<\320XQ="
+	.ascii	"gO\256\366\022B\250\347@O\371\321<\332\201&\3321\311|t\217\376"
+	.ascii	"\321o\372\210\022\330\243q\200Y;\201\346\321BK\302\273\006\326"
+	.ascii	"\376`/;\007\230\005Z\201f\240\267\366,\320\310\302A\005\372_"
+	.ascii	"Q\"\316\236\t\f\236P\310t\316?\004:\001\035m@#\320D:f\331\001"
+	.ascii	"\255\243"
+	.string	"\337$4\241\227\372\026\216\007t\221\216)g9w?\241\034m@\237I\226\3259\372z\277`l\260\260Ix4,j\322A8:0\202;\316?\301\033\215\303F\007\365\215>\263l\311\2006\226\346\b\355\030\265t\221ZN \247kkM\352\220\322\247\332\353vG\242\255\3255\251'\376\345U\336\364\340\031j\322^\353\365)\2675T\332\024M\365\247\375\272\023\303\242wmu\3244\351\002\372_\240\313^\352\002\332\350\306\204.\205X\352\361\217\200\276\016>\270\361[\3521\317R\277.j\207\343\234\330\301\277rY\234\212\242l\362\235\033\2020\250\342\020AL\202\2229C\"\"2\222$IkR\013\020\006\302q^:\366\022@\024=\316rN\231\272\222\244 )\354\354\031\223L\"\211\343\332}\t*q\007\204\217I\006x\266\363~X0W7\337\231D\016\364\307\342\217\334\342B\3266Z\246\355\266P\224 \021"
+	.string	"\007\316>\350\033dZ\206\234u@\371\310\373\261\274o\210$\223\313\2177\276\017\276\321c\002\245(zR"
+	.string	"\264\200\262\026-\307\230\0345b\245\306\004\210\255\371\343\202\2518j\202;z\022\244\2550\334'\263\f\307u\016}\345\262\345V9\371b\213\374Df \320\363\202F\224\316\211\364A\231,\036.\334\272\3635y5\022\f+\310\242\377d\275\334\n\370\264\331w\253\2235\026\334Ec\252\321\274\b@\300\214Q\214\224\276e>\233\373\214\033\232f\203\255Q\334a\342\354^\314\023D\362\257\004\220\315\246\301\250(\244>PFl\013\302\233Z\270~\022b\224T\037\221o\377E|d\303\f\262\246\261p=f\316\231\234\217\241\177\373\203\200\035.\303p\221\264\n\001\375\231\0265\271\"\307t\266\200\302\017\017\026\374GC\013A\351\230\021;?\202`\315\204Y"
+	.string	"\211\350\330 \271\033\003\362ye\356\345\fQ\340t\373\354\026\356\250@&\203\310\216\255j\315\367t\255\013\007z\024\347X\030\311\013\005!\261t\365n\357\234\233\235\023\274\222v\020\021\227\016-@\024\256D\271\206$\216\216s\330l\222\327\032\333Fz\230\364\312\314\207\261H"
+	.string	"\202\262\002\220\207`\205\342[|\341\350\026\374\356 f\270pm"
+	.string	"\254@\313C"
+	.string	"\240P\213Z\240\013\306\256\036t\300\376\364HZ\236\234/\353_\275\347\355\016\214s\213\325\274\232\250\275\027\373\321\022`'QkhR\210\201\303\325\003\336\275\351\231\021\255pY\3057\r\340c\354\306\201\005d\263\377B\243\023\221\307R\026\226\314nRK\325\222n\227\341*\210c~Eb\t\213\342\210\240\002n\361\220@M0"
+	.string	"\330\233V\032\030\022\370q\021_i\262+\362\372xO\"\030!C\337\013Z\261]Km&\233\025M\360\031\b\002\213;'\203\341\001r\272\264b-<\302\364\314\274K\223\341k.Nq\240\3458\016-\220\013\256\321.\220Nu\225\221xy\247\351\017S\361\324\276\313\312C\n\300>%\367\n\344_\350G\347C\222p\032\025\341\037`\300~A\013\240\\\324\245\242^\235x\345\363\210\216\275\232\210\225b \204\242B\212\231)\200:eN\013\377\217\026\305\214\216\232~\243\360N\232\356\200\232\274\204F\221\211\216L5Rs\025=\374\262\260\025\346\344\225\346\226`@\223\016n\272k\032(\031:R\310~\036g\240/\f\021\301m\370[\344\025\354vCp\0062T\373\324\336\034\242\202+\003\312\222\271')\240:\246k \n\313e\252\370\017\341\024\245@\274~\316\2123\377\032\367\315\212O\364"
+	.string	"\001N\242\231\260\025ck\237\275\255\332\210\220\323\tN\373$\207w[\242\235_\2347\246\375\314D\225rDqO\007\037S\004\024\346\311\366\342\203\03432\020\301\023\330\f\030\315H\356\365\310\366\004"
+	.ascii	"<\242\330|\266\313]\241I@\211\364\346\b\b\255:\006K+\360\214"
+	.ascii	"\241\361]\266\262\237\n\244\366\0063\366\357^\365D\016\373\260"
+	.ascii	"#6F>=\200;\023\353\0241\374\002|\230\2348\206\242\355\005\233"
+	.ascii	"\245\327a\332\230\\\215x\371\334\353\210\373\013\250\204\320"
+	.ascii	"\357_,\231\215\234`8\362'-\326\250\227z]W\236w_b\343\f\247=\322"
+	.ascii	"\214i\323\330*\201s\224\341 \017+c\\S\013/\371\313\373\213\326"
+	.ascii	"\370\3213\204\226\226 \343>\032\232V\236\226\306\205[\210\226"
+	.ascii	"&\341\231\262\3614\330\0336\251\222\226\325&\205'0\3717U\313"
+	.ascii	"N\300q\204\275w8\304\247{H\177\201\322\206\276yh\353lj\001-"
+	.text
+	.section	.gnu.lto_getOrnithopterWingState.201.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`s\002e\016"
+	.string	"\206\232\\D\020\221\223\016\b5\361\276(\306\"`\237\210;n\337\350\352\347\261B@\314u\311\004M\231\223\034\r<\242u\361\003S\255\333\204e!ke~L\006"
+	.string	"("
+	.string	"\2043\260X"
+	.string	"\227\006I\2509B\b\331D\312\224\002E"
+	.string	"C"
+	.string	"L"
+	.string	"\366\323>\211\227\030\235\245\344"
+	.ascii	"vI5.v?\003&\200\035\372\373\207u\210=\200u\350\221]\363/.\347"
+	.ascii	"\245\344\241E\307\356j:\342\243\347\310\277\211g\035\212\311"
+	.ascii	"\363B\260\273\316\016%\345\326\333\036`\273\200\255\234\033\354"
+	.ascii	"\222\357\016}\273X\207\327\004\021\306S9\311\224\375\231\244"
+	.ascii	"\212\260_\355\356ZI\366Y\376M\246\263Lc\231\2762me\032f\272\312"
+	.ascii	"\264f:3\375\017\001+7R\336\341\330\375\220\332\2614\360\305\312"
+	.ascii	"\306\001\226\332\235\313\200\361X\312!\236PP\355\317c\300\b\201"
+	.ascii	"\252!\236\274J\355\355/&\n\2256\2101(U{\344-X\200T\037\304\030"
+	.ascii	"/\325\276\360\025*D\211\272\332\030\336b\023\266\273\007\374"
+	.ascii	"\024\"\031<b\251\244\313\361\023Ga\223_r\037\256\303\211\240"
+	.ascii	"= \0226\022\215\023\t\331*L\320,l\235\021\315\023\022i \034\203"
+	.ascii	"H>!\215\003\201B\332\346\333W\253$g!R4'\332\301\231\332\nn\243"
+	.ascii	"\306\202L\2718\343aj38\215\031\007\230^%\312\240.\265!\3744#"
+	.ascii	"\302\245\007\021e\274. @\003\021Qu2B\327H\2011\330\370\204\031"
+	.ascii	"\221p\2731\023\026\3054\255\301G1K\222[k\370b6\241v1\213\205"
+	.ascii	",Z\303\0273\t\265\213Y,dqkD\002\317m0E\212\355\216Z\263z\367"
+	.ascii	"\006\226\021]\355\210 K\2300Ch\326S\240^^\264\203\f"
+	.text
+	.section	.gnu.lto_adjustAerolasticPIDGains.205.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\232\006\305#"
+	.string	"jB\024\016G\220\232Q:\314\253\247\034\024\260^\225\025\370c{2V\366Q>o\237\003\256\303M\245\225\256\276Y\311\277o\r\027\270\335\244f\364`\317+\270\022\021n\025k\342\225\314\273$\326w\004~J\f\356\030*\371\204\020\271S\n\320"
+	.string	"\261"
+	.string	"\322"
+	.ascii	"7\232\346\245\245\005q\013S\027\227\017\\.\222u\353Y\306.YI["
+	.ascii	".\276\336\250Tl\2151\214\233Z\353\321K[0\025\037\024\244\230"
+	.ascii	"h\373\251QQ\200\022\350\360Oz\207b\342\201j\r\322\306\253\326"
+	.ascii	"\241\003C8_zx\236\332or'\275k\271\350Y\255Z\256x\325Z\035\230"
+	.ascii	"\301\371\362\300\207\314\227\344\203\314\227\356\331l>\034Rm"
+	.ascii	"\306b\214)sj\255\267\025b\362\344\3606i\3572\263$\227\366|\343"
+	.ascii	"I!\225\031`\325\213\313\310\2361$=|\252b\220\021xt\215=\f\006"
+	.ascii	"5\215\350x\371\260\227\302)3\300*\035'q|\311\005b\256\326\370"
+	.ascii	"T\375H\242\037^p\334x\032\254\212\242T\266\241\326j\n\254\272"
+	.ascii	"q\237\267\275\303\266\r\333d\nZ>z\264\214\332(R\320\003\277\244"
+	.ascii	"\361\312\210\330o_\330\303\027t\205cHxxy\203\330HG\247\3627\270"
+	.ascii	"\224\237\301\241\374\013\276u+x\327mt\255?\301\2117\202{\335"
+	.ascii	"\006N]\340`w\021\321\251\t\234\332v\352\001\247\026p\352\241"
+	.ascii	"S\013\235:\350\324\001N\rt\256\373\347\324\265S\373\234\032\300"
+	.ascii	"\251{NM;5\317\251g\247>O-;\265y\352\222\244&\227zIj\272\324w"
+	.ascii	"@\207\310a\242\344\306i\034k\255q\264S\305\312\257\"\007\373"
+	.ascii	"\267~\256\277\353'\376^7\355\333\377\362\303L\0033\226\313\230"
+	.ascii	"c\364\362\032\347\313\277\312\255\374\312\213\001\253\300\b\366"
+	.ascii	"gO\021e\246\216\226\255\3202.%\322\326\200VD\362\350E\033|\330"
+	.ascii	"\237\003h\005\246<\332\033\377).+-\222h\203\306b\026\355\265"
+	.ascii	"\242\244\211\242uN\232Fz\321\"mM8e\206he{\264\024\213\271\345"
+	.ascii	"\312\266\274#\365\343W\206\f\316\334w\021\3712\207\217q\361\254"
+	.ascii	"\265V\360\305.F\311\3165\321\003\233\314\227\345.\031\302\206"
+	.ascii	"\316\227\217\036wyt\215\031)Wh\272Q5 u\361\246Aj\365\031\025"
+	.ascii	"\330\240m`\013\254\321\221\037=\222\344\n\351\005%@\306l\321"
+	.ascii	"65J\2605\037\0255Q\274D\321:&\027\201\356]V\220\233\201\310."
+	.ascii	"Y\345\n\t]\003\373/Rn\354\022\327b\342\2545j\202\237\305\305"
+	.ascii	"\356\304ba\276\244\233\001MO\027b\001\245\033\021\224[\32295"
+	.ascii	"\001\231H\341A\205\216\227[:\237pNL#\224tP(pN\271\035/\207\373"
+	.ascii	"YJ\242\272$\372\224DsP\270\016\274\035\217\227\233Y\351\301\222"
+	.ascii	"\356\351\006E\242I\347\304t;\241\303\231\270)\361P\334\036\330"
+	.ascii	"\274{\312\361nP\273\035\357F\033\326\223&\321\376lpv\265E\314"
+	.ascii	"\267?\023\300\262\355\320\022\030\2606\001\313\263\003\344\200"
+	.ascii	"\020\2005\264%U"
+	.string	"\027\241\254\240\255\255P\200\r\002Z\236\r\360&\204\211@\213\001\315\016_VmK*\260`\017\237\245g\016\204\003`g\353\263\277\"u\244g\001\354\343H\375\240-\317\366\354\245\216|\215\213>\226G\230H\333\331\016\005k\264<+\373\"\225\365{\232^\022\027}\023\315\227\263\275\220\252\030\354\341+\3767\303JL\303\361x\346\fy\250AH\303\224rdHH$\215\026\024$\035\320\002\221\261!7\021P!eP\t-P\373\035(\017-\227\272F\225p\352\\mB\200\355\n\272\214N\353\310TW\215\350\213\206\005Q'\035A\265\313E4L\274p\214=1\313?4\311y\275\357Z\316T\031`\001\257\267\337\371\233\260*\\\020\212Amp\214\264Q&\357\305\216Xx+5\336\301\\\373\033B\2224v2$\235\367 \\Q\333\321\034\202LRB3\r\357`X=*\326\313\357\334\254\243B\030\n\202\336\005"
+	.string	"\203\335\367."
+	.ascii	"\272\037\\\262\314\343M\210&N\241\\\256\352\315\366\2145\304"
+	.ascii	"\364l\356(W\262\3773\f+\243:\336\027\243\304\212Xf\202\313\302"
+	.ascii	"\3113#\211\221\fc?\376\003\211w)\231<\006\212u\351\366\246\t"
+	.ascii	"\31554$b\354\265\207\013\303A\253XJ4e?\177"
+	.text
+	.section	.gnu.lto_updateServoSpeedScale.206.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\264\007\225+"
+	.string	"\032P$\021B`\246J:+\002\313\320[\223?H\376lP\344\261U\353(\222\276\332B\272\337T"
+	.string	"\313\332\267\313\362\356%\3076\316\206\034\001\245\363\212-(\272\233\207\177(R\275QV8\202\306\r5\3226!R&\031"
+	.string	"\001\350"
+	.string	""
+	.ascii	"\001?\273\253\365,9\250\352\231c\240\274\313\017\367\313\375"
+	.ascii	"t\277\335\315\335\357\236\313\036o\205]l\264\241B\346\306\207"
+	.ascii	"\363\346\257\345s\257\373\335\n#H \336.\354\325Xm4\311\353\333"
+	.ascii	"\323@'V\326\265\fy\202\332j\215\253p\306}\013\361rb\257\310\372"
+	.ascii	"\261\266\274A{\265\30698o\032\361>\313\337\210\207\3330\257i"
+	.ascii	"\225\365\360\344\371\355\325Z\031\334\\\252\363f\324\225\350"
+	.ascii	"\315\362H\364\346\022w\365,\231\325\261\253\274=\307\272@\265"
+	.string	"\326a39\361B\241\340\t\244f\331L\334\0033\004\221hc\027\n\271\220\220 \034\224:\222\006\344g\271\200H\232\036w\303\003H\251\324\006\t\236\337]J\n\0175\006\3768-\255\314\002\r)B;\226C}G8F6}\274,\027\354\345\001R:{\202\024\242\225q\027\241\231\225Q\265\326\337\235q\240\025\231\201\031j\255\313H\264\264\357\320w\227\313\356\206\330\005\356\b\265\326\261~\3630\372N1\247\246\214\373vW\304\317\204\235enf\004\211\022%\350\315\367\204\265$\237\211\217\311\203\320Yk\177n\273'\036F\354\212N\255e\023\366_\016\006\305\276\311\315\325\332\342#o\356\267\350\315\252\316Z\363\343\203#\343\344\022\361.\213.>r\330\315\207\344\217^\261\307v\343\212\334Jv_\326N\262{\365._\253\313}!\234\356[u\273\357\360p_\005A^*!\336\004'/\202\223\367\300\311;Ey\r"
+	.ascii	"y\245\202\274QB\274\005N^\250\223\367\251\344%\020\344u\002\362"
+	.ascii	"6\225\274L'\357\322\311;\340\344\025p\362*Q\336$\312\213T\362"
+	.ascii	"\036\235\274\001(\257\321\311\013\200\362\026Q^\242\223w\350"
+	.ascii	"\344\025R^!\312\033\004\362\236\224\027Hy)\3455M\336\322\344"
+	.ascii	"m\223\227K\336[H\222\223#-\235\305f\307\247\266\324\373:\267"
+	.ascii	"\263a\366M\226\250e\301,\230<H>\005XA\237\313\347l8k%;r\037\347"
+	.ascii	"r\2604l\330@9t\340#\227\372w?\342[\362C\317\314\034\320W}?c\033"
+	.ascii	"\222;rq\030\222I?\002z@7\371)5\200\026\220\324JM\343\030\367"
+	.ascii	"\220z\341|\315\320\244\243F\352\263Ysd\376\261\321\361\301\221"
+	.ascii	"\355.O\r5\200\246\200\212a\276\\V+\331\224U\017\365\262\321O"
+	.ascii	"\221\223\033\240\205m\325\234\307\210\306\250\003\264S\235q\257"
+	.ascii	"\250i\0335\224\237QJ\261\315.\352\033\333\210\372\251\356\370"
+	.ascii	"'\324\302n5\306\275`\003[\250\201j\214mg\007\231x\367\003\b>"
+	.ascii	"\362\354\0132B\333l`\337(e\330\264_\325f\037\357$\342\250\335"
+	.ascii	"\035\377\266\314\333\225\265\3623h\331Xv\272\271\313\006~9\252"
+	.ascii	"\0259\271\020\272\252\273\231\352\216Y\212\017\243\303\346\246"
+	.ascii	"y\216e\212\234<\007,\264d4\330\213\031_X^^\\[\301\032Z^^\\X/"
+	.ascii	"\272<\200i\245\240!\344\362\322\332\222a\356\326\003\025]0\206"
+	.ascii	"`-Xty\255\030\276\350\322r1\334\212!c"
+	.string	"\370`i\277`p\305\030\202}}\305\030\n\343\310^\326N\262\301%Q\364\310\272(\244j3>\262\221\0234\025\202\004\007z\252\0210\331\201\016\252\031\350\251\006~1\356I\265\0016\256bI\251~\035\033\234P\247y\3212W\247\214\373\202Q\016\3567\350\035\325\364\317\361o\001C\365.\321\t\021\n=\262@G\225\365X_\322SC\005z\352\013u\376'H\"zg+\321s\002\200\bt\026\333\235\233\032\031'\201N\275\273\r\356\207\030\345j\255\326Ja\317\347}\210S\210U\210V\254\320\233\364\017\222OS;55\260\313\022!\237#\006\316\bm%\373\273_\007^\2215\374=?\336\177\206\027\205Hy\325DxE\326(h\034W'\272Q\246^1W\347x\236\207\350\206\205\370F|\2437\231\002\200\210\250Q,\006\025b\246fDDD\222$I\007\220\002\221\2519z\021p\251c\212\210\246),\007"
+	.string	"\305\375\371ch\363\304A\207\330O\214|\272\200'\336\032s~Y\263\330=\264\\<U\317\370\037\363-\345\332\313k\367\226\221\303w\023\357B\233\373\361\206\346\032\245\003a\233,~\210\374\234\336x"
+	.string	"\031\374\033[\227\003\376\213A 6\301"
+	.ascii	"\355\307U\352\215\b\004A\272\361_l\032\266\322\243'mO\214LI\212"
+	.ascii	"\236\204\352\371\271\344E\366\210v\2246\033\201\\\331>\350\n"
+	.ascii	"Y\310,\361G\002N\343-N\335KjV.\321\013m\372\200\034\330\376("
+	.ascii	"\201\b\331\267\233j\366V\347\ry\211\225\n*(\032^r\245\320f\214"
+	.ascii	"f\310\377\216\275\001\271I\214\261^\201\202T\214\b\323\\\314"
+	.ascii	"mr\256)<g\374\202e\034tFA\335\215m\b\022\233\262\034SX}\321C"
+	.ascii	"\247\311\354\026(\326$C\007dY7\024\316\304\272\324O\023\335\251"
+	.ascii	"\260KY\003K\035H~XZ,\231\021!\361\257\276\"\216*W\3442&7\357"
+	.ascii	"Q\001"
+	.text
+	.section	.gnu.lto_getServoSpeedScale.207.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375 \367\305\006"
+	.string	"\242\f/4`m\322\001@\203\240\364 \257\372\034`\210A\216\017\255\233\374h*\344"
+	.string	"Lk\362@\233J\271G\276b\032\004\005nX\253\242\301u\322Yxg\311&R\246\024\266*\205\313\362.\016\r\327\003\303\213\270\022 \236\225I\274\212\300\230e!{\027\f\313\336\024\367\332I\2452Ja_\344\321\037\177\363\204=y\355\316\267G\272K\005\300\310d\310\216\230\324\r\373\321j\307~:U"
+	.string	"\264m\3161\331\275\b\245\354\211#\361\260\r\355\311\3778\b\264?Q\354\330\nJ2,FPv\367Q\037\220\356\242\007Hw\312q\370\204\376C\216P\301\001i\032\314\263r\260\273NM\263\271\365\006\2665\002\t"
+	.ascii	"2\003\346:\203k\b\3055Q8\004\216\031\233\270+\322lx\327\275\001"
+	.text
+	.section	.gnu.lto_getFlappingSinusoid.208.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375 \367\305\006"
+	.string	"\242\f/4`m\322\001@\003\007\207PV-\222\300\020\203\234\r\370;\373\016\273\341"
+	.string	"Lk\362@\233J\271G\276b\032\004\005nX\253\242\301u\322Yxg\311&R\246\024\266*\205\313\362.\016\r\327\003\303\213\270\022 \236\225I\274\212\300\230e!{\027\f\313\336\024\367\352I\2452Ja\037\344\321\233\377\361\204Ay\355\3167H\272K\005\300\310d\310\216\230\324\f\373\321\252\307~:U\340dds\216\310\356E(eM\034\t\207mhO~\307=\240\275Eq\343SP\322\261\bA\331\335G}@\272\213\036 \335\251\306\341\023\372\3778B\005g\3234\230g\345`w\235\232fs\353\rlw\002\t"
+	.ascii	"2\003\346:\203k\b\3055Q8\004\216\031\233\270+\322lx\327\275\001"
+	.text
+	.section	.gnu.lto_getFlappingAmplitude.209.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\245\f"
+	.string	"\326WWC\020\223\222\016\\\236\002\001\247(\013\217$\260\345\274\307\231~\232!\034\235\2352\033J?T\273\027\352\223\222O\377\317\311\034R\025'\204*\n\240\b"
+	.string	"\004\"\320\005\357*\264*S\242\346&U\3647\221R\246\024E"
+	.string	"B"
+	.string	"E"
+	.ascii	"\357\224~\300;\225'\256\235\322D\315\007\320\265\234\022\001"
+	.ascii	"q\325"
+	.string	"\222\032\247\227\221\316E\017\210F\370\250:\016S\025\210\260\0213\322\201\224\344\246\004\316IG\230\316\0051\004ew\215\241\356\303\375n\333\201m\006\366\033\004\233\"\3733\377;Z\217FD\277\24368\317\001d\327C\220\037{\242f\244\260\255\331\025~\306&wvi\274\210\261\273\013\214@\344\224m\237\305[h\266IK(d\f\330\310\274\324\364\330]\253\344$\001i_\027\360!M\375(\304\n\220\346\310\246o6\001nw3y\2110t\320\334\3400\007e\360\270!\221\346\360\236\021hvp\230\343\207\t\236\341\331\0326\340C\317\223\036\300\205\t\034'.[\354\022\bsd_\003)+Yva*\331\003\017V\331s\"\341\303be*\024>+\023,\013\037\b\025,\017\206\301:)\340\213%\005\263\262\353\302\254\252\264=E>\351\002\3605\267\252>&\244\242C\332d\202\tc\033\323([\202\250\016\276\024"
+	.string	"j\b\330\326Y\036\023\334*(\303\366\232\242)68\016\204\360"
+	.string	"\260\020\001\034\344j\"h\260\30551\026\013m2\221D\005f"
+	.ascii	"\225\361\253\246F\305\324\031"
+	.text
+	.section	.gnu.lto_pidUpdateThrottle.210.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\225\007"
+	.string	"bO65`\215\032\003(V\303\013X1\370\323\001\375c?\271\341\373\274@\360\255H\233'$\356p\337\302~\271\021\347\032\004\001\021p\026\255V\314\021i\233\215[n)S\n\032\316\266e\332f\2534\203Q\300:s\3330`\234\205\351\200%4\314\214\36601\227f\035\2156\267,\323\246\345\273c\250\227\310\344\364\211\021\205\261\366\360GKuF!J\202\356,\353\222,\313\003\f\024J\305\007\246\332\317\003\243E\353\352\377\033C\255=\033V\225)\305#\243\177\"\205\372I\206hX\332\032\266\3360\007g\257\245^\277\210\007\362\337\240\005\025\313\001\013X\226\225\003,\313r-\211\277\213_L%\022\243\223\3773\212\314\031r\265;|u \217!"
+	.string	"\302\377\302\016D\341F\267%h;\333~\001\b"
+	.ascii	"2\0013xF\340\0024\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_pidInitConfig.211.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\332\022\355L"
+	.string	"\032\202"
+	.ascii	"\034I \216\273I\007\337\025L\347\373\251E\324\222\337g\b\255"
+	.ascii	"\257\376)\207(\356\213So\251 \177L75\355-K[\302!\"\267\300\004"
+	.ascii	"\016\b\227\302%b{\361\024\024-(\240\252R\f}\3614\260\323\250"
+	.ascii	"\032yX#\233$)e\206\001\227\001\302\001G\314^#fo\221\367\0221"
+	.ascii	"{\207\230\275Wg\257\020\2637\210\331\013\344\354\375Q{}\324\336"
+	.ascii	"\036\265\227\207\331\273\343\275:jo\216\332\213\303\354\275a"
+	.ascii	"\366\3328{k\324^\032\2657X{\255\314\336*\263w\306\331KU{e\324"
+	.ascii	"\336\030f/\214\332\373\242\366\2720{[\230\275,\336\273\342\275"
+	.ascii	"*jo\212\367N\325^\024\265\367\204\331k\342\275%j/\211\332;\302"
+	.ascii	"\354\225zoT\355\205\252\275\"jo\210\332\013\302\354\375p\366"
+	.ascii	"z\250\275\035j/\007\263w\303{5\324\336\f\265\027\203\331\373"
+	.ascii	"\364^\247\332\333T{\231\314^\340{\317\332[k\257i\366\376\275"
+	.ascii	"\314\n\260\032\006n\026(\343>t(\352\346\357\022\332\250\"\002"
+	.ascii	"\304\206\230\335\340\f\035\320'L\240\024a\307r\333\362\233\006"
+	.ascii	"\\\210\310n\253d\264\f\345\004\366\224}\360P\024\245\342\272"
+	.ascii	"6\230\270N\231\375\264\273\334\273\234\001\023\"\362\032\002"
+	.ascii	"\334\001E\365\210\360\001\212\266U\355\013&\256\333\306!N\256"
+	.ascii	"L\374\341\344\272\304\335I\334\206\206F)\317\304\220{(\212\006"
+	.ascii	"\317g"
+	.string	"\317f\033\357S\023\331\251\211\351\3514\201o\3422pH\223\221L\r;\245p\240\354\214\233\314\251\263\024jo\3504\223\311\001\2057f&\215\267b?1\004eu\3704\371\253\016\003\235\310\346\3605\220\205\231S(\2122\033\367\030\031X7p\b\212\242\333F\2622^\f\274\273\204vW\311\256\207\016\002v \036\342\303Ax\370\007'\234\207\305\206\354X\320\272\262\303\013\202\346\341\347Y\252h\331\341\273Qx\322\335\nFE{V\340\360\016\033\316A\3037LaIv\2214(:f\370n\025\256{\344\210\257\201\266K\030\236\341\351\030\234\376t\205\033\321\231\340\364\323,U.\327\232\276\233\205K\330\344\t\022\266@\331\241(\312\203\021\217\320e\277\204\t\023g\314K2\230\031\005\215\256\376\376\366\230\336t.\252\001\317\364zW\304;\017<\213\371m\026+\022\262!\264\335a\006\254\324\272BC\3210\036e8\021"
+	.string	"\\\201\330\235\3477Nb\226*\217?\212\242j\316zD\3573\346\231\337$o\260\032\302P\364kE=\027G"
+	.ascii	"\353\277\375\315Wd\021\217\3773\033wY\323\347O\314\317\374\236"
+	.ascii	"\355S1\2771\2731*\357\230T<\346c\313\300\344\356\366\212\345"
+	.ascii	"8\226\333\344\262\237\335Z\271f\343\312\235\\\207\251\334\336"
+	.ascii	"\336\266\241(z\026\236\3741n\222\302\232ow\005\340\016\204L("
+	.ascii	"\032\246c\231\203\241\032\027\223\037\256\313\b\234\\\371U-\021"
+	.ascii	"\336\035Bk_\375\267\333\246\246\277g\227\031\275\236]n\303\206"
+	.ascii	"x\275x\215\331\f\273\361\216a7\336\254\332+\246\366\206y/\230"
+	.ascii	"\367~\251\275^jo\227\263\227K\355\335\362^-\2657K\355\305b\366"
+	.ascii	"^y\257\225\367Vy/\025`\357\224\367J\251\275Q\316^(\265\027\353"
+	.ascii	"\354}R{\235\234\275Mj/\223\263wI\355Ur\366&\251\275H\336\033"
+	.ascii	"N>\330\370\334\031\363z\370\270YW\034\301\353=\016\265\346O\262"
+	.ascii	"\030\b\214\307\275\336w;\316\343RuE<\035\337q\206c.\310?pb~M"
+	.ascii	"\216Xx\352\370\030\267\271\260\346\333\323G\241\216cI#-\327*"
+	.ascii	"\340\323\225F\272`/\307'\020\024\207\343\301\347\270q\034\007"
+	.ascii	"\366\331\370\215\003\343j\334F\237\226\240\306\371,\205\264\\"
+	.ascii	"\233\321\2006\t\002-\002\032o?\233|\261\235v\0321m\227\370\207"
+	.ascii	"\b\b\320\311\365T\032\363\202\267:\r\264MJ\260r\3017\231U\335"
+	.ascii	"\352#\356\212x\235\207g\274\352R}E5\252\317\020\324\020`Q\235"
+	.ascii	"/\245\220\216k2\364P\200|@\205Bm\225b\\\006\214\307x\224r\037"
+	.ascii	"\301\370\206:?t\305@/\360l\322\002%$At\332\332\305_\264\270\213"
+	.ascii	"G\325\025\361X\234\001\265\270\031W\f\264\342,\210\307\266"
+	.string	"\263\242\356\250\342\333t\372\2148\210H\210\310\326l$\262\235\\?g\314#\322sT\234\357\244\217\226)\344\030\3513\346M=\305\037W\304\233\322p\204A\320\312\264\202vdUhS\347J\351\243#\n7H:\356\304Q\230\370\211\237\310\0227q\245\333\b\255\306\264Z\264\361D\2113\006)\035\211N@\311\312\365\035\202$\b\017\337\210\223\220\372\210W\275\250K\365\032a\225\235U\207i\261h0\023Q\347\nR:\250V\323\350\037\3431E\034\352\346\\Q\355\322&Q\360\222_\340k^\345\311U\204\351\227\3161}\317\362\033W\245'\267\371\232\3001\317\372X\025g\275#pK!\254\371\230\331|\232\301Y\3476\037\201L\223\305;!\276\313\204-\271\240\367\306\016\037<\001^g\266\270\244\2401\200\314\231\255,\302\2562^[\034\n\330J\223e\226\031`\313\fW\227\0242[h\234V\313\212\314\026\232\240W"
+	.string	""
+	.ascii	"l\r`&xf+K\030\324\352* h\025\265\\h\312t\005\275\270\270\272"
+	.ascii	"\202Om(\303\371`\211\367u\260\025\263\300&\225}\307\027\346b"
+	.ascii	"\016\254\003\3630\213>\006\346\034(\355\320r\355\313\331\020"
+	.ascii	"\007\r\031\021\331\206$\\L\370\345l'\355\220\227\257\031\316"
+	.ascii	"\351\201\261\251\323hR\227{\271\324]Q\215\313\273\334D\016\351"
+	.ascii	"\376\305\345\214(\rn\271\345\350\360\004-\337\362\317\r\035\265"
+	.ascii	"\237P\313\371N\032\3341\313\245M\326a\001\221\345\312\261\234"
+	.ascii	"\213xW\016\205\274`\221\230\237\225e$=Im\311\3129N\332\333\261"
+	.ascii	"\212\236\nu\306\274\341]\267P\345\374&\375[Ra\2018\210\022\221"
+	.ascii	"\ri\314c\241)\t\251<M\372w\\\233\362\355\025\372\216\200"
+	.string	"a\013C\275\241\036\2338\245|\312Y,\021\230\245\226$\224\362aj)J\244%\224Gy#_\350:(O\223\352-\261\034\r\373\236\034\353=7\374\353\023\236|\230\3529\241S\323\344N\376:\260\236kr\016\224VbB\302\232%g\"\326\214\226T:*Y\304&\311\225\374\310\261Vb%9\233\245\224\226kH\036\302&\0258r$\357\276\"\236\233\006Ax\3442(\3211\362m\271N\022\311\340\020\345\3109\271\232s\306\274\"7\362(=\"/2\247=\020\0229\257\245\223\226C8\240C\314\323l\354B|\365!?\221B~U\247\341\204\234\343\244\223\216kA\276\375\326H\"\003\r\020\363\344\3213\346}\331\001y\220\327\276\242\332\217\003y\2405\300\372Q\343\244w\313\201z\250a8&\031b\310D\222\202\222$\303\034\361\005\204\020\304 \272n\021\2404\310\034\"\021\"%m\n\205\326\002z8,\250"
+	.ascii	"\274\024\251Sh\323}\215\\)r\201\325\271\321b\360\340W`b\372\345"
+	.ascii	"calxV\236\376\277?\311\233Q\344\307IEZ\220<X\236\271>cF\313K"
+	.ascii	"\210\202ra\330j\037z;\347\217-o\325hP@\030do(C\320Y=\b\244\345"
+	.ascii	"\313P<\266`h\327\337\247\233\"\245s\361V\311\275\203%\355H\271"
+	.ascii	"[\277Z\333 \032E\276\237\202\301\206\013\274\217%\nh \246\376"
+	.ascii	"_\r5DK=v\213\224\030\36763\275v\3435\223.\n\354\327\214\270i"
+	.ascii	"\320G?\340\334"
+	.ascii	"B\201q\231\262\"dy\245\344KRq&/\304\210\332\341\251\203\"\313"
+	.ascii	"\3547+W\026\030\245*\304\302?]~\324\"\3576\212&\220s\210,\004"
+	.ascii	"T\377\030\375\346\311\216$_&\346\372\253xB\323l\371\210\030\351"
+	.ascii	"\225O3\261\215h\242\\\224\b\001V\020\n\266A"
+	.string	"\330\211\007\316H\"A\327|*\fTr\204\211\350]}\205j(\177o\356$\356\353\355\201(c\030\243\273\314\017^\306\036\006\206J\354\002\001\023\341\233Y\020\001g\023_\350,\250\275\272\017\256\007z\3273\330\203X\016\277\336\370\036\365\fJ\\\213n\002\036\001\202\360\006{\220\316\362m\267\222vV\274FY`\016Z\312u8\2133\2705J_\032\025.e>\007%)UN\3223Xu\300\361\275J\2573\350\302\356k\361O\333\320:;m\317G\316\351\223\340\370\353c\356\300\371\007\325\rq\3109<&\260_\343H\351\272\230Ne\027\333a\241\227\020\n\017\326\312\355\210\035\363\360@\362PA|\261\025\376\3001@g\273\303\223\035\\\365_3;\0225\206\fj\244=\272\267O\237\177\273;\321^\362\343J\356y\241\376\277\363ow\223\206\357f\027\347y\203zW'\204\201}\273\2334\034\273\202\246\031\343]"
+	.string	"Gon\f\310IH\021\2556\\"
+	.ascii	"\267L\231\r\257\355\255t\013\234\2772\354)\020\316\344\202\003"
+	.ascii	"\344\f\333\343\005\320\017\003\340\024s\332EF\346\226\022\321"
+	.ascii	"\"=(\\6\224N\200!\343\226\357T\241\017ss\260\006\021\377\210"
+	.ascii	"\361'W\341\224\344\302:\300\252\023\304\272\215n\2369C\201\346"
+	.ascii	"\225\365\346\035\254\365j\016\365Q\243 \001*\311L*\341\237\002"
+	.ascii	"\25052\312x\031\260\021\n\301\322\255\356\bc6\255V\003"
+	.text
+	.section	.gnu.lto_pidInit.212.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"5\013"
+	.string	"\366UN> O\225\016#j'\036B\327\037SLz$\037h\262\232H\313\031\033\b@\177\036\313\364\355\343\264`{\036(\352\360@W\322*DH\004\002\310Q\266`^'q\32487\023K6\2212\245:"
+	.string	":"
+	.string	"<"
+	.string	"\253\016\023\273a\305\005\264G\207\017\220=j\237d\217\376\354\026\0175\226\262B\003\305\361bw7\315\360\357\371\371\377p\b\230\"=\037\bv\327\t\246T\267\3366\001\333\006\354/\b:a\003\005\207V)_vhJ\305`\037\333\335\265\256\354\267\376G\246\261L\253\2463\323\217\b\320`A\365\216\022\273\027^0\326\025Ol\220\330~\332\357p\017\337[\024\016`7\240\007\234\224d\325+\246\225\n,S\276\234\252zT\214\315It\264\335\323\305\347\370\b\356\301\347\223=\246\036`\341\356\"\"h\273{\361A<D\310\337x\264\204Q\036|\364G\331\343\003\033\017\307\351\274\004\032\016\024q\306\242\341@\233\310A\207\363p6\b\034\346\263e\274\320f\241\270\003m\274M\324u\336&\tK\307VW\206\260\\\270JjR\240b\222\017\265\03148+\205+#1\2651\231|\021"
+	.ascii	"2\241\273h`\\`\220\031H\001\232\337\\R\232\353\001\270\202\321"
+	.ascii	"\240\3121\244\032\373\300\254KX\315j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_pidAcroTrainerInit.213.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"U\007"
+	.string	"\"\31517@o\222\016XP\226\024>\306I\240\343L\271 "
+	.string	"9\254\310A\223\fg\200m\252\3777_\267\325\301\r\254hd\354\031\006\004\023 8\254\316\026'\367_\024\355\023\"S\177<\f\030(\206 \036\260\b\2078\201-H\304\217F\021=\2353P\203\026CY\246E\216*\013O\233\217\326\212\004/\020ZB\322\215\256\005\304\240\377AGV\031x\311\314\204\033R\221\212\333\365\332B\364\312\365\272\"\200^\325\350XX2\244\327z\325\350A\216\257&\341\3515\002(\030SO\\23Z3\271\272RP\1779o\037S\225GvVR\030&\254\314\214\260\243[\337v\233\352\206+\215\372\002\0242\363\307\225L\035\366'\370\013~\224\f"
+	.string	"3\001\3638\303\364\256\001\303"
+	.ascii	"\356B%\265Y%\240k\270[\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_pidCopyProfile.214.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\030\001\375\f"
+	.string	"\006\230VA o\233\016,\336\244\032,J\310\017\304X\323Q\200\214\241<\b\305\347Q(\200\232\301C\"\213\377\357\257>\324\357\304\220\254\320\361\371H\301&\201\020\032\005\023\304\034\200i\300\251\344&\372\264\311\2262\245D"
+	.string	">"
+	.string	"C"
+	.string	",\376q\330\r\023-\272\224\027\273\213\351\206sNAM\216_]\254\220\3279e\271p\b9N\230\272\001#\r*\227W\222\n\300\003A\216\335=\351I\301\373dV\227\335u\206<\321\035o{\201m\005\366A\002>\\\035\331\231\266\216\362W?\371c\246\241\246U\323\251\351_\002H\035D/\215\330\255p\222\261&\252\204\007\333\277l\024\025\004\231\266\201\003\234\237\220Xw3\204 \261\373\0250\001\313)s\354P\253\025O\236\034\325Rg\267\342\361\f\013'\024PM\\iT\025\245X\221\273\333QO\210\252\rD\250(I\030N\275\252\302\224\016\303\277W\232\032]\344Ib\324k"
+	.string	"P\251\324\201\370\344\311\376>\251&\016\030N\243!!\223\211$\310\204h\037\033\347\221i\036\033M\246aLG\246\215`\033\020\007Z\310\007&\2421x\200a8\r\326\261\341m$\303a\233m\343\260\353\363\034\256\216l}\210a\362\350\207\212\t\r!B>\344\223~\001i\307\225\006\033"
+	.ascii	"l\263\341\214\351P\262a\2415\325\357\355B\017\005]\357\r~\300"
+	.ascii	"\342\240$\300\025\024v+\2141\231\366\2549\230k8\312,\300\"\214"
+	.ascii	"\001\345\300``\204>c\004w\t\030\260\252\2215CnW\321\003"
+	.text
+	.section	.gnu.lto_calcHorizonLevelStrength.215.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\376\007=,"
+	.string	"JN\004\021E`^N:\313\312`\2033\016Q\217\277\350\234+=nP\244\225\006\326\017G\220\033l\tA\030j\333JNW\246Nx\372\3037\341\231\205h\303K!\304\361\016^\345\n\037K\371?8\212ok\333\b\331r'\031\001\001\340"
+	.string	""
+	.ascii	"\001\357\302\237c\241\027\032xg\232oU?9.{\232S>\374\342\224\260"
+	.ascii	"\206W\313\313k\013\026\376\033\013\263\\\213\325\335f\f\257\310"
+	.ascii	"\356p\354H\323\253\303\357\347\260~\be\341O\346S\341W\271\025"
+	.ascii	"\026.\263\3346\374~\2661SIkx\273\266\330l\321\360\373y2[\361"
+	.ascii	"\247\234\215\205k\314\274{\323\304\361\340\367\363j4~\303n\305"
+	.ascii	"+kz\315\271\367B\375\344\247\337O>\224G\261"
+	.string	"bfZ\330\332bs\320\274ac\211\347\336+\245\364\"\364\247\375\020\372\263\213\334\352\302 \360\347CO\333\325\212\357\233Pa\313N\016\027\330\325\205\301\227\371\352!\367%\264/\037\025\270\364\363M\020\022\306\343\2762_br6*\372C\326\374AGH\230\217\237[\325Z\001cu:^\346\313\207u\302\033\362F\b\246U\033\b,\265J\367\336\263\275v\201e\325\352\233p\357\345\312\005\026v\37693\2731s\ff_\222\305\256\263\346\336\333@\314\351N\360\217\374dc\212z\256\237\374\024\350\317\245\376\333\353\331\0251jXu\217\223z@\023h\bc\322;Yu\217\2015*\251\205d\310\200\025\352\314\310\026\365\\\003\372V^\201di\302\343N\253\257\230\327\262j\2331\337\336.c\216\202J\200\340^\316\007\236\256v6\200VvB+7\035\356\314\204V.p\267\363\222\255\254d+\023x\3339\351\313\363"
+	.ascii	"[\031\351\\\316\304\257\235\217le#[\271\310V&\262\225\207le!"
+	.ascii	"[9\310V\036\332\312\001le [\031\200\255\374c+\013m\345\240\255"
+	.ascii	"\f\264\225\177\266\262\317VFm\345\363\254lm\345\356\312\265+"
+	.ascii	"_\201\221\236\267\260\207\001s\257\327\336\236{w\312%\271\227"
+	.ascii	"\237\313\017\367\273\375m\377\362W\373\327\376c>sC\334\254\375"
+	.ascii	"t\262\255.\217\303O_\356\347\327\331\031\024\252\205:\252\317"
+	.ascii	"f\227\024\355VaC\265\235K\307\316\016\266\260\211pR:,@\300\016"
+	.ascii	"\266\217O\212F\240\201#\226t{i\036V\335\003j\241F\357d\325_\003"
+	.ascii	"5\327\264\316\257Q\270\224\316@\243\355\3533\377kcF\307L\225"
+	.ascii	"\260\230\034\313 '\332\025\211\233\016hG`\363\357\330\362Rb\231"
+	.ascii	"\314\\\231\316N\266\331\251\371\032fz\3408\216C\177\236]\343"
+	.ascii	",\356I\275\367^u\2331\b\3246\211\2666ZU\217\371f~\006\004\377"
+	.ascii	"\b\207\020Q\317%\242\031\234\301\345\021c\376-\315\022\262\313"
+	.ascii	"\022\366\366\364\264\356\305b\3526\320\025.Es\352\356\263\235"
+	.ascii	"\211kL:\247\251\013\264S\377\312\231n\314\325nb\352\3325\340"
+	.ascii	"\246~7\303gG\246\350\373b\307\324\217\373\321\0256j\357\002}"
+	.ascii	"\033}\226\372}\001M\252"
+	.string	"\307L\365\272\031\275\307\bs\325\233\001H\243\222j\203\261HYEEAitq,\272\b\306\230\252TS\225\304TE\241<q,&\225\034T\024a\0243\034\2212\214I$\n\242#\322\250\244:\032UT\035/(\217\305d\362E\225\020W-(ad!\245Dq\302\250\302\204\324\321H\265B\252*\351Bj\001\221\221,\212I)%\022\231\224\022\256a\335\336.\343\332l\177YWZ\234\255\367R\210\004\023\334\254+\r\311\031\325M]iq\300#\245 \274\264\346\035Vg!\265\322Q#\t\215:AQ\023\265Q\023\227)\032\261\213\232\310'\245#\352$4v`\322\274`\233\361\345\216\001J\372{\372\217\256'q|\b\232\330]\314L\354\246\022GN\333\030\255\252\007\324\363\360T\317\336\360\020\303\372\035\350\241F\320\275\3043\324wr\246\346\211XP\377\364\201n\270t,\253\311V\230\274a\007\365S\264"
+	.string	"\r\240\207\215d'E\373\t\320\002\340\244J\230y&\367\336!\200\376\334C\230\325\251\361\265\331U\200\234\250\201(\303\030b\206\241!\021I\n\222B:\200\002\231)\253n\021`)dn\210$I\251\335P\007\214X*\fByO\376\267`\274\243\245P\234\227\032'\370\251\220R\245%\231\257J2\005\034\253x\337\365\030\006\365\375\270/\253\260\t\213t\244`\034i\323\260\264\224\013q\027\221\215\350P!\240\022u\301\243\036NB\372\2241\016s\231\236\214\033\203\240CL*\370\352"
+	.ascii	"\215pJo:GN|\265A\242\200C\037KIu\021\316\005\257\364\261\213"
+	.ascii	"\263\265\250\332\205\251M1W\331\344\204w\003\271\022Xg\240\016"
+	.ascii	"[ckgZ=\264U`_R\360\200\r\327jb\005\003\250`3\261;x\210\373!M"
+	.ascii	"7\376j}{\202\017\274\345x\264P\204r\341#\254\353\022\357P\032"
+	.ascii	"\013$\306\356(\f\360\201\316\233\265\376\265J\335Hc\336\265\203"
+	.ascii	"\205\2579\277\017.\363\264\252\351ZP\334\307A\215@\371<\r\237"
+	.ascii	"\354\262\322{(<j\333\265Z\004\302N}\262*:=\363\326G.K\350\370"
+	.ascii	"xf\244\020\203LxIA09\376\021|\321x#^\205\203L\302\t\336\032<"
+	.ascii	"\337\177=\365\366q\316+\231q\332\220G\005"
+	.text
+	.section	.gnu.lto_pidLevel.216.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`R\005\025$"
+	.string	"jD\330\016F\200\334M:_\274J\214L\tb\333hX\374\020\317\016\3635\227v\254\201$B\337\276\207\203\207\261q\343\003\253\322\276\372\374V?\273dg|3FQ\250\344\024\3052x\026\247\322\022\247\203$\354\351\326\b!r\247\024\326"
+	.string	"\277"
+	.string	"\343"
+	.ascii	"=\034\331\313l\235\241>\346\013G\222:([w\223\332Q\376\226\213"
+	.ascii	"Y\307\305fio\306\334y\241e\306kV\245j]H\035k\265\326\0077\235"
+	.ascii	"\242\304b\263\022\250Z\r\221\033\326\312\r\002@\225X%J\005J\355"
+	.ascii	"\207}J\324\251\344xP\255]p\316j\r\213`\ba"
+	.string	"8\237\036\314_\234\253\025\b\224\263Zk\004#\341n\332\366\241<J\224m\366\201\212j\212\2051u\252\256\324\251\265\362\216\276;o\226\037:o.\221G\375v\232\345\322(\377b\367@\325\006\214\021K\352\267\036?{\334,wW^F\037\254b\351`\355H\347bT\264\354\301\332\361-\035l\221\331\341\2035,wjA\336\274\354\324\n\213H\351MC\255\325\324\210\225u\343n\273\206\355\035\266\211!G\026\277\2064\351\037z`m\245\036\275\261\334\243q\021W\312tw\315<\305\265/\335W\265y\351^|\270Z\211\024|\264\0202pFr\2347\2778\216\344\261\0036E\223v\330\220\256\020\373e\335.;G\335\200\301\202c\371\025\374\354Np-\367\321\255\374\bJj\243s\271\213\016\366\0378\225\337\300\261\334\003Jj\001%\365\256\244&*\251\207Jj\241\034uPI\rTR\377\234\332\347\324\001p\324"
+	.ascii	"N\255\303Q\367\224\324\271S\343N}+\251\317\033\265YR\227%\365"
+	.ascii	"\236\232\336\250\217D\275\310\352\034\263n"
+	.string	"&K\255WI<5\315\354\202\344g\277\226\237\313\327\276\3751\377h\335\031\023\344U\\\310\332fFsk\264VF:\033\340\316TqC\244l\006\222:\322\031\264\r\326\264J\353h\236\306\203o\304 D\320\033E\2347\203\366L\274\254\330\321\002Z\243=ZJVL24\373\330\232%\\\325\031\222I6b\255S\n~\026h_\374\362\331\2375\200,\256\005X\335\372\354\rYL\002`\003\244\2218\031\233Z\211\026\354\0227s\242\214\006\024\317R\344\306y\023\300\236\254M\227\236\325\371\303\311\250\240`\301^\3611,&\024\251\265R\bs1-l\027/\350\215/\316\233={\261G\240\"\207kKJ\227\362\334\242\025Z\323\242\234!=\316Q\373\261+\304E\233[-\036x|\240\241)C\244l\306m\356\266\270\335<\3058\2675\277T\265\231{\356\341\024\327\300\230{n\035I\332\001+w\267h\003f\222"
+	.ascii	"\305$Lr\342\375\200NN@%\003L\302\245_/(D\321\324\243\321\033"
+	.ascii	"\361\003\342\360\005\201LD\346\206 0\030\354\365\b\177>\340\223"
+	.ascii	"\260\207\002\206\317\204\360\327\013\006g(\t9\371\202)zMK\277"
+	.ascii	"\244\\\257\311\027\003\0304\001\303\367\324\003\345\263\221T"
+	.ascii	"ZI\002\f\337\023O\310\264\344k\212\301\373\371\222\234xJA(\236"
+	.ascii	"\004\002\006>\365\202<!\020\030\344\351\302\246^\326\355\362"
+	.ascii	"\217\027\201V<\027\254\221\325\021\314d\260\003\006\004\251="
+	.ascii	"i\2226\265\303\233\202\025\260\013\266\022\354n\005l\0018\305"
+	.ascii	"\257\341\022\355n\377&J\n\321\276\315k\314\311\021\2657p\240"
+	.ascii	"7&\330\037\277S{\342#m\270R/\302\266vv\036\355\3202\330US\374"
+	.ascii	"b\36366\353\3402\227\2357\207\036d\3111\262%Ek\n\f\325\225\022"
+	.ascii	"s\205\330\305\220\025\332\227=\027Z\2501@\342\bb\306\221\031"
+	.ascii	"\221\021\322$\205t\200\"\221c\326\r\021\360\265\253\342\f\273"
+	.ascii	"\001\336\377\272\225\225R\016/Y\270Xs\337\306\023@jR\226\373"
+	.ascii	"PY\t_\366m\225\305\222\216Q\222\035\247\347\331)r\001\2271\241"
+	.ascii	"\221\347\002aJ4\242\275\027H\3534y\f[\232\220\206\013\251\303"
+	.ascii	"p \226a\372Wp\037\351\214\326\025\244\362\260\030FE\325\3778"
+	.ascii	"}d\201\373t\303Ha\241\235\013\036CQ\274\237',\005|\2508z\353"
+	.ascii	"bv\036\302Z\260#\307\203#\207\024\257w\221\377m,\243\235E\370"
+	.ascii	"\263[\0066\376\260Q\2444\001\006\033\304\337\206\243&\211\020"
+	.ascii	"\n\002l\247\025\035V\016\001\242\002\256\3724\007\026\3065\354"
+	.ascii	"\365\007"
+	.text
+	.section	.gnu.lto_handleCrashRecovery.218.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`G\f\335>"
+	.ascii	"jk\250\027>@\244N\007\257i\013-\200\b\355\016\272\00115/\300"
+	.ascii	"R\\\224Z\255\215\322\033\221I\320m\354'\306\351g\340\016Pw\300"
+	.ascii	"Bl\252\275-\\\202jG\300\337\375\377\377m\267#qwK)\245l\001C\001"
+	.ascii	"n\001\201\177\367\3768lt\361\244}U\032\332M\247\373\257\237\271"
+	.ascii	"\243^\242\321:t\330o\211m\311e\362q\027\2056\2638\347\017F_\271"
+	.ascii	"\353y\b\243_\004\357\275Y\235\262Z\321\257\341\234~}\rG\331|"
+	.ascii	"\234\346\204rQ2\257\317v\363\242\371\030\202\323Oa\247\314/\230"
+	.ascii	"\327N\325\225\231M\035\245\252\206\371\352L\244h`\3149t\003\202"
+	.ascii	"hF\006\033\357m\302\306\215\205'\243\326t;G\243\250\235\340\275"
+	.ascii	"L-\376r\275\026\323\366\230\032RK\227\271W\304\315\275zZ\314"
+	.ascii	"U\354\224\365\212\355\314\355\245\277\264\r\306F\323m\035\205"
+	.ascii	"\321:\301{\311h1\202b\247U\r\245vJl'\265Sn\231\tI\335\270k\016"
+	.ascii	"\242Jp\224)\274\367&?J\267\375\344\324\304\264\244\224\204d\327"
+	.ascii	"\243\261\210\244\246\304\367\226\033\351\313\370\026\267\326"
+	.ascii	"OH_Nw\335$\305\231\356\354|iJ\235+%\3219\362.\211\263\304\003"
+	.ascii	"y\234\b\232\242\203\006i<8$\276\036\261\302\203S\342G\243\021"
+	.ascii	"<\270\"^D\372\262j\"g\244\221\216qDZ%&\240\203\006I\212s#B\345"
+	.ascii	"q\"\250\341\340\360\224X\340\211\022\303\326\0037G\254\252\203"
+	.ascii	"\007\307\032w\303\211k\034\323_\017\334\035\261\352\336\333m"
+	.ascii	"\332w\304\265\271#}\335{\331\337\342\344\232\241\232\271i"
+	.string	"0s\036\363\252\006s\374,\336{\373N\375\336a\204\370\351\267\333 [`\007\342'\b\346c\276OsB\273\260\230-z>\322o\262\267\232\252\340\177\f\2420{\200\230\276\250\211\337|\360\377\235h\017\352\247\377\210\030A\202\204\332\351\177\267i\"\2261]\377\340\245\020\341x\344\237\340\273\276\375\232\250\245\217\340\033Ef\254\264\365\236\346S\342\004\n\024j\247\376Xv\355\367\336\265\377&\267\231\332\237b/\220\351\213\230\373N\3431\343\276\34301\35771\265\323\376\227CtG\367e\216\315\017\231\365\332\374\233\314M\274\377\204yu\246pt\006[\235'4\264Y\302\352\034\241\3514{\035\235\273V\347\007\315\246\273A\243\351f\320j\272\027\364_s\262\307to5\231n\005\254sV\233\351N\260:\037@:c\255\316WHg\003\253\263\325\352\\\205t.\260:\023@:\0170:S\261\316\002X\347)\3269"
+	.string	"\353,\305:G\261\316"
+	.ascii	"Xg(\326\371iuv::7\261\316L\254\363\022\353\254\304:'\261\316"
+	.ascii	"\310\325\231]\235W\244\363qu6\"\235\213Fg$\326Ye\235S\326\231"
+	.ascii	"\270:\377\321\331\215\316]\241\363\354\374\360!\327\001\336\243"
+	.ascii	"=\202\005\270\303y\264I\224\264L\230\250\235B}gq\376\231\242"
+	.ascii	"\203\006a\277\351O\037c\017\272\345\314m\263\215\342\375\366"
+	.ascii	"\364\236&/\t\236\266_\323\273\367\256\337d\n\357\364K\307!\302"
+	.ascii	"\216\204SR.Q\026\260\247\320\364\t\036\354\333\215\337hz\bN?"
+	.ascii	"\206W\314\355\024g\343g\224\257\265T\236\272\016\375\266U\256"
+	.ascii	"\264X\274\337Z,j\247\203N?\\\n\331\374\360\3104\367}\030\274"
+	.ascii	"\3223\375T\231@\207nV\224\236\216\237O\200\304Ao\203\311Oz\245"
+	.ascii	"o7\2746F\255\026\346K\372\216\343\274\323e\356\331l\374`Yry\302"
+	.ascii	"\341\341\"\346\275lW\310O\376\017r\303c\037\371S\216\334\004"
+	.ascii	"\331\374\220\3277>\373\251\237\333\361\327\302v\213W\027s\333"
+	.ascii	"\245\025\265y\\\\\210:Q\373\205\3330`\336o`j\247\307\367\262"
+	.ascii	"\353+\276\361\273\205\322\207*\364\023\360^f\027\263\205\036"
+	.ascii	"\304P\274\227\311e\250m\222\241\333\324\325\370\236\323\027\300"
+	.ascii	"8\355\030\366\031\277\231\247\221\276\233\354\005N\271\367\006"
+	.ascii	"\225\231\203\007\3577\244\016\262\346\317\212\241 \363\327$\240"
+	.ascii	"\t3X\374&\237\200\242.}\303i\343\222\350\032^\2254\375\254\337"
+	.ascii	"\301\234\365I\200\202Nh\333\0375\203H\304W\177\351\331\335\b"
+	.ascii	"\333\262\210\004\326\251\352\247?7\244\321\335\232=v\230\276"
+	.ascii	"\250\rL\266\205F\226\026f6\305d[cfei\3113\245\231\231R,\300\f"
+	.ascii	"\024\016v\\*\227\3131c\332Y\231\322E\332\030\b\025e\035\232\306"
+	.ascii	"\322\302>(\227j,\212h\"\306\314\312B\244\235\215-\2270\304\220"
+	.ascii	"he3\302\210fe\313\020c-X\234\205\031\325\226c1\224b"
+	.string	"cK\024dhaK\261$\026\333RQ\346\"\231F\306\242\254\305\212\344YY\230YRl\211\226\334\222b\245\213\261e2M\251\\&W=\266&\336\177\242!*h(\310\366mOU\214}\212\352\350\274\020:}\223\373\216Si<g!.\204\305,_\2704}\223'\274\325K\370\t\2575\350\300_\275\204\247r\204\365\007\246Tp9uR\236\200X\357r\354\f\374U]\273\245\033Ei\363:\021\024\003\337\321\3060\350$d\270\004\270\310\020S\204\267\262\343N\374I\033\007\244\025\"D\355\324\252\211\020\320\234\327Gx\005\216\334\n\253\236\300{=U\264\300W1\251\340\276\304\013\274?\001\rx\002t\355\226N\004\350I\332\274&\004t$\003\276\3534\006:NB]\254\336 \312\263D\325\205\232J\013\036\346\236\223@{J\002\246^\200\017\361\"sD\274\331O\355t\312P=\363w#)\300G\331\221\372"
+	.string	"Z\036\004\210\234\224\240.}l~\210\374\341|C~\223\243\036\3007^\240\303\361\223\b\363E=\027\2409\250\007\360\356\310M\201\373\340\247V\221\200\370\250a4$\215C\250dD\002\021I\222$\215\001\220\002\021!\253\252\003\021P1c\216\2116I\232\003\255\312y\317\005F/\026\364\235\233\232u\fz\216\\\373t\333/\327\375\301\366\222\377\006x2\204\311\2459*;M\373N\345"
+	.string	"\tEF8C\007\3218D\216\214\202s\200\240\222\277g\206O"
+	.string	"\n\001\202\352\307kd\265\303H\364\313H\033\270\005\033DI$p\004\241\372K2\267L\313\225Mv\312\035;\202P\313\263\177o\377\307\201\253\336\3039\377\034\374}P\340\223\334\2355\330\264\n\"p\237\274\t\370G\254}r\217\276\313\036\245\\\242\244P\266\375\027+3\353\346\016}\002\242"
+	.string	",\303\355\020A\002\031\3004"
+	.string	"`\327\367\006\370\202\251\360\272\310\266^DW?|)"
+	.string	"\351\300\2772\373\203\256\322\312=\311\316\032\340\343\002\352Aq\001\304S/\342\371/\342!\215\206w\0273\0261\353\031\033\004x\246\237^TX\303\277\240\237\341G\314vi\273-\321dFB\032\332\316\023tB\362L^\252\357n\003\033:\240\2615,\036\240#\025-\020X\200Pq\255\316\tU|1!\204'\201\206?\260\336\035%\352\332;\313ZV\013\177\257\004\210\254\331/_ll\016I=\347E\233M\364\021d]\372\275\235\242\277\217\231\327\fO\322\223JT\257\005\026\264\310?"
+	.string	"|{\037\333\237\0130\377;\320j\271%\201wA\232\337\352Na\351\tZ`7\355D\321\363L\005:\275\023\365\264\306a?i\326\356v\373\230\022\366\341r\231\003N\227#\007:\374\242#"
+	.ascii	"\255\364\nt\314\362\016 \364\366\333\264^\n\200\036\351\346\007"
+	.ascii	"\361\227e\230\366\351\210\204\ty\232\225\215\235\177G'|\"\301"
+	.ascii	"\324"
+	.ascii	"f:\312,\323\253tb\200\017\006\270\036\340]4\343\312\030>*"
+	.text
+	.section	.gnu.lto_detectAndSetCrashRecovery.219.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`L\007-("
+	.string	"\372E\234\017G\200\236Q\007\021\341\020\026\007\275\033\341hT\362 '\005\374\312\255\332\203\n\003\rS\265\013(\227\254*I\265$\244\361\006\254+&\2568`\344\215a\215g\022\221\003GP\342\233[\202\216\255\215\255\333\226\020\271wJ)\005\346"
+	.string	"\314"
+	.string	"\350"
+	.ascii	"G\244\006\224\313E\030\261\013\257\005c\t\030\035\t\236\025\203"
+	.ascii	"\325{\2054\265\334\253\324\200\037\324:\345v\346\206\322W\304"
+	.ascii	"\306\222\301\273M\243\t6\307\354^\256\006\234\240\326)P\367\330"
+	.ascii	"N\321\356\331N\231\310\314\346g\351\026\035\200\311a\222\322"
+	.ascii	"\274\367\372\336H\023\273\307\333\351vr\270\333jSk4\233\242\357"
+	.ascii	"Dn\332\004\025\251,v\217\207\304wQ\255\333!K\002\231J\036\361"
+	.ascii	"\\\024\323q=\245\203\246\222?\374\026$\244\311\251W\037ns\232"
+	.ascii	"J\366p\325\211\207\327\234\226NC\0050\277r4Y\322\tE0f\210\232"
+	.ascii	"U\311\344\266\311\222P\253r\206\247S\311\250\234r\311\321&KF"
+	.ascii	"\241@\367\336U\251\344\217\022\231m\211\223S\036\321\236\033"
+	.ascii	"J\220=\245\275\206R\311\2356\341\336\313\216T65\3634s\017\231"
+	.ascii	"Y\310lC\004D\337SZ=\263\245\273\235\300\366\023=;\323\362\350"
+	.ascii	"O\346\306\322^?\356$\f4\341\2154a;\355/*[\032\375\351\016f\351"
+	.ascii	"\306\222g\031V\300\377\354\2102\306\r\2314J>\2079\353\350\377"
+	.ascii	"\304\334\377|>\237\374D\230\2553\321\352\254\300\346<\324Z\335"
+	.ascii	"B\235\325\035\324]\335@\315\325m\240\261\272\005\320\234}T\347"
+	.ascii	"\036\325"
+	.string	"\231Gu\356\251\316<\325y\267:\353j\316;6\347\034\315\031\247:\337T\347Uu\266\251\316\252\352\\S\235i\252\263\2459\247\2523Zs~\232\263[\347^\340\373r$\303\005\346|4Y\367\306\323y\307R.R\314\334\334U\332\n\213\246\302\253\3219\306\204\322)3\013\346\265\323^\231\031\355r\201\352n\215O\210W\304(\304(\266Su\312Y\305\274r\352^a\317t\017\251\256\346\033\243?[\252\350c\275\375\372U\206\302\355\035\224-m\277\276\233\231\321,\340A\317\\\301\2027\322\366\277\005\213\307\230\322\027=\314HeS\2776\346\202\372C@_\023\253\021\361\342F\375'\246\275\375.\262\025\026\326b\234\005\003{\261\227\355\224\366BeK\003o\177]j\202\231\321\324U\201BS\373'.\235\276\237m\265\230\376Z\221A\203\006\333i\372\276\016j\352\342E\373'\316\322\354J\367\032\017\240\337B\266\304"
+	.string	"83\007\017\336H\364\275\n\026\216\261\343\027\031\202\216f\321\022\260;\265\263n\002\366\177\307K\177\371"
+	.string	"B\204\b\333\351\377P\212\313\212\033\t\363+G\272\302\372\337\224\354\234y\204\2217\322\337\002\tr\374\342{\271\252:\202&\260\001|\242\b\210t4\364\245\b\"!\005\177\001\200C\243\r\302\240P\bT\215\206(\200$\322$\017@\244\243\016\303\024@\241\220\305\017\227t\364\302\b\205!\004\266\b\376\200\302\021'\222\214\204\277\034\377\212H\034\251\360\rO\2308BQ\302\227\342\310\b\311\367\023&\371\212~8\250\002(\364\r\203A\241o\3152\366\023a\fp\202\31013\376\261\347\354&\251,Uo\"\034\317h\360|\276\225\314\361\371T\313\371\206y\265\3443\24628v\377\324\304R\265\202\331X\243\353y\236\2608=\275\347\3511A\267\004)\262\303\373\335\347\260\266\276\334\360\276\353@\355\236"
+	.string	"\230\347\226\302nN\301\353\336\233\230u\033\"\225\023\242\225\225\355T\207Ri9\307\230W\313\241W\360?p\230\352\344^\350\207\276\2554Je\306\314\311\216\256%lr\317"
+	.string	"j@\r(\027\207K\243\006\367\033\244\256X\335\204\236\273\254\323\020\003\200\230\250a8\004\221DD3\"%IJ\222\016\320\002\021\251\252\016\021P%u\316&i\2065\2303P#\264\226\017\003T\036\034,\3305\b\324C\255W\277yU]\3541$\r\006%j5\306\366\2473\037\006\307\222oO\333\345\246\300\226ikW\200\207io\225ol!\203\221\225\317\323\345;Z\276\335\264N\273\366/~\353\231\321WA2=\352G\304\\\301c`pz\200\037\021G\210B\001\276\230\200dT\351\335"
+	.ascii	"\276\236\236>\201Q\370R\223\006\365!d\271Z4\227V8\342(\206\212"
+	.ascii	"*\006\200\221k\324^\342\344V8\030\025G\267@Z`\205\004\307\016"
+	.ascii	"/\254D \243\330\004\324\346\t6\r\343\003\334\270\034\270*&,N"
+	.ascii	"\003W*\312\023\200h\250\312S\007\020m\320\35127|K\260\225\201"
+	.ascii	"3\024\021\350\315F\201\301\311\177\bE\201\211r\005\2611?\223"
+	.ascii	"\247h\235\200\"^\321y\376uB\360\013.\353\222~\305\005\360u\357"
+	.ascii	"\353\250\301\321{\036h{\320\204\322\005\306\211\254?"
+	.text
+	.section	.gnu.lto_acroTrainerSign.220.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"5\t"
+	.string	"\346P?;\020\005+\035"
+	.string	"\220%\030\001Y\245"
+	.string	"\225\005\353\300\336]\"\200\370E#\200\354\320\275\377\255o\364\b\377\236\177Q\366\005"
+	.string	""
+	.string	"\237d\023"
+	.string	"\200\321y\264Rp~L\354\032\221-eJ\001."
+	.string	"."
+	.string	"."
+	.string	"\232\236\377\330)f7\032\352+\035\256\256Pa\344eE\360\231 \203\255d\346\261g\352;e\006D\354\256\023\365\251n\356\266'l;\330\256\005v'\0173\315\003\273\265\327\312\356B\270A\340\234m\377u\024\317v\201\262\223\317 \306\0252\263\331\335\350\371\001\347\034|\001\347\234\232\334;\f\255<K\215\215Di\266s!U\002\346\2247\266\254\224\332\262\017WY\366a\177f\372\020\201FE\365[\312\256H"
+	.string	""
+	.string	"+\303\265\270l{\001\037\367\247\263"
+	.string	"\211\"I#\003\264\201\021;@\025\034\3613\362\210]\202C\242\213Q$\205B\243\330\221\355\341*\313\251\3353\037~M\251\007DM\020j\016"
+	.ascii	"A\204\346\265Pn\b\005\252\"CE9\r\220\016a\271\206\353f\3618&"
+	.ascii	"\210\250p\005Py\254jt\212\246\366"
+	.text
+	.section	.gnu.lto_applyAcroTrainer.221.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\376\017\265M"
+	.string	"Z\203\264\034Q@\022&uw\273\214wN\037\316F\307\036;\230\351\337\354\363\3642\241\315\255\356\037\3030F\024\374\bw\211?GR\024\356\271`\306\242q4\246(\346\204\356B\246n\242\344\312Qe\207a\262\177#Fv9f\346\230\007\b\b\310\232\021\262\233\244\224R\276\001\211\001\274\001Rx:\274\003A\357\202`\224\017\312\264H\357\275/4\224\f\272\t\013\277\372\250\0310\023[h'\314D\346\240\233\360jV\345\343B\273\367\366\022n&\355BO\031"
+	.string	"\001\332\206\243J\306P\2734\200\321\037\352\320\250\367\252Q\020\354\365\215\217nn\201`\257n\032$\235jw\214\030\375\201\212Fe\342\200\231\330\353\312\334r\2671\221\231\225\360\264\257\326\365\272<:9\275{/Q\257\274\364Ix\3723^,+2\022\356\314\255\326G\332F\342\001\322x\235k!4\271W\315\210\213\324\202\334\336E8\216\205\367~1ir\3575\342\241`\257\314\314}\326h-\363\324"
+	.ascii	"\0312\216$\321M\241l\324{\2572\331G\266\327_\317\260\275\276"
+	.ascii	"\217n;\b\350\307'\331\303\263\243\223\203s\203\264\2519\322\314"
+	.ascii	"\310\304\030a^\212.\304\2410\bd\327\337{\313\rD\361\223J\347"
+	.ascii	"\326\356\334j\304\350\240\263\006:c\342?n\355\343\326\202'\227"
+	.ascii	"t\317\022#\316S\244w\212\244\271NW\275u\316\031\232\343\260\320"
+	.ascii	"7,\020q\244\215\264\314k\244r@\374H\3264?\234\261\237\320\034"
+	.ascii	"\231\317\fe\344A\365\266|i\375h\031\024~\311)?<\006\210\302I"
+	.ascii	"\373|iI\333(\026\3460]\375b\226\305\345E\263\254\035\356\322"
+	.ascii	"\245\303\2119z\370;V\341\2217\202\213\n\tm\226e\202\013\255d"
+	.ascii	"\345\300\341A\237/\255\255\006B\243\264\217Y\326\226\263%\364"
+	.ascii	"\372\303\341\242B\302K\r\031?\241*<\362\032\312\323\177N\377"
+	.ascii	"i\373X\311z\373%\357\275\335\326\216U\303\312\035\210\342\336"
+	.ascii	"\313~UC\253Y\250\231\375\214\231\265\230\213\321\303\307a{\352"
+	.ascii	"\005\237}\341\003\331\236A\254\274\312\300\017bQ\240\337\302"
+	.ascii	"\356u&13\320y\r\004\357u\222\270\241u>\320l=\346\001\333+\360"
+	.ascii	"\373M\354\311\372\3547\264\257\312\253\355\263\361 \b \2119\202"
+	.ascii	"\276\"\301\321\225{/\211\032\372n\002\3561''\266\327\365{\332"
+	.ascii	"FZ}|\\iO\252\274\312~4\2004i\330\372`<ef\007B\372\206\322\016"
+	.ascii	"\344\006\016'd\261\223\341\336{\177\037\265\322%Z\004\024\214"
+	.ascii	"\267D\367\017\261I\337m\035\264\262\206\347\364=\376\036b\373"
+	.ascii	"\223\236\035\272e\325t]\367\304=\306\313\026\336W-\330^\373\211"
+	.ascii	"f}y\\i[U^eV\263\362\2172\367W\253\325*?\030\363\212vV\321\324"
+	.ascii	"R\232\231\3329E;/\265[\263R#\351\036\240\213t\237xg\023A\347"
+	.ascii	"\022A\347\244N\322\215\324o\315\312\243\206k6*j%"
+	.string	"\315DB\347\021Dg\021\357\034B\350<Dt\006!t\026\022:\007\021\235\201\336\371g\350\354\323\316\311\241s\317;\363\274\363\316;\353\274s\316;\343\274\363\315;#\337\331\346\235k\336\371\370\3164\357<\363\3162\357\034\363\316\306v\206i\347\227w.\276\263K;\023\337y\330\316\302v\016\n\235\201\355\314\n\235\327w\376w\366\240s#\220$\203\225]\022:)\177\247viT\371n\335\372\244\254\245t\273u\277u\303u+\231\213\201[*}\233\022\003\013]i\302-\027=N\310b\207WCs\324=7S\324K\217\205\363\305\357\2575*M\217\003E\372\266v\247\204z\374(\315\203\361\004=bx\332\336SZ\3505\247\326GC\306\346M4}\317)\375\3157\375\323\360\344b\372\343\337<\316\035\bU\023\217|\246\367\271\254\226\b\303!\177C\262$\221r\245m\315|TfK\265Z'\323S\332w\334"
+	.ascii	"\353Z\263\232\221\243N\317Y\3636\377\233{\232\035\277\346\327"
+	.ascii	"\035\236T\017\201\247\235\244=s\2546\355D\330\f\277j\215\020"
+	.ascii	"\300\304\304\366z\374\226\353\025Z\3226\"\034\003\366\357\317"
+	.ascii	"\362`\345\325\275{/\r\315\377\263?\265\314\274\314\323|?\315"
+	.ascii	"\254\274\3522T0\334\314\037\361b^\346\221s\317 \306/~\314\267"
+	.ascii	"\2127~S)\253\256\335)\3213\026\275\252\211^\325\255G\267\007"
+	.ascii	"\235\276tS\261M:*\320\251\0137\025k\004\34318.\350\027\346\205"
+	.ascii	"ZU*W\332\023\230\217\366q\034\210\037\244e|[\206zNxxQ\361)~\255"
+	.ascii	"\252\332\025_\376qX\303\363\201\343\202{/\337qx.\305wy\346Z\367"
+	.ascii	"\320T\236\026\300p\336W\f\307\366Z|!\261-\245wy [_\365I%~t\007"
+	.ascii	"\216\013\272\242\245\203\224\355@\3252\374(\247x\242\323\335"
+	.ascii	"\330;\222\305\256Y\355\336+\374(;\360\250;J\013\245tD\240S\266"
+	.ascii	"\250U<\026Q\023\237\271f\203\323\367t\340\270`\353u\016,\016"
+	.ascii	"H \001\266W\242\210\257jX\020\370`\354\353Q7\224\226\371\025"
+	.ascii	"u"
+	.string	"\212\307\232\241\225\276\243L\373\255\006!^\367\362R\265\272\347\274\267\nh\370J\357X\236f\302\017\354\342\210\312E\323)J)5\025\0255\365\204\363\302i\003\346\262)\305\002\203\247\245\213\247b\024s\331d\321\\R-\231\303\n\226\315\247\345\005SL\030/\0044\245\226L\246\006O.\315%\363\233RPS\0134\227T\301((\246\003\313\027-\244\234\204TP\0358\375\370\351\250\002(\030\312\246\213\026P/,PJA9E)\237\230T\312#$O\301X2\225\315\251)\246\222\250V\325\277\373`\334m-\343H\317\277\034\242\177\361H_\364X1U\254\364PW\365V\374\013\032q\344B\314D\374\210\020\"\224\037\002\310\310\317\320\2179\0202o\216\003\361CD \236\305\341\345\374\030>gI!#\027\013\203y\241\036\367j\237_m\260\r\341\tzf.\362\036\020\fp\305\301<\332\346\330\321vu]\351"
+	.ascii	"\364A\217tA\351?\317\334\362h\243l_\001}\322\3711\274\202J\377"
+	.ascii	"\363H\032\236f/4\364\331\355|\224Ct+\306\372|\367\350\362\321"
+	.ascii	"\222\371|\007\322(D\266\210\220\264I\321\371h\316\211O>s\r\257"
+	.ascii	"\347\223\256\303w\264b?Z22\266\327\236w@\032\267\005\347\243"
+	.ascii	"\314m\231\343\340\351N\330\275\227\304V\233BMR\t~\243\025\322"
+	.ascii	"\256\320\016i\207L{\350\0056/.4\352\215M\323\373\261\351\365"
+	.ascii	"r\240\001\235\3264\005\371\350\346\240S#O\201\224\3155\202\215"
+	.ascii	"\"6n\325|4z\2561z\376\031\215\376\350\261Z\256\205*\344`\002"
+	.ascii	"tj\263\342\375\210\224G'\007\235\326 };\271}4\214\376D\217\345"
+	.ascii	"U}\244C\207\217*H\236\337\371\025\357Xl\360|\303\320\364:\277"
+	.ascii	"\363H,9_|\235\245\317y\233\273\0310<\365l\226\200f\350\b\201"
+	.ascii	"N\250\221,C\031B\246\206D\244 )H!\035a\005\204 '\241;\017\021"
+	.ascii	"@)d\214\021I\222\354\254\001\266+/\005)\241V\251\321\f\256T\367"
+	.ascii	"\333\3244:\254\247j\240\t\312;\360\005\351\037\345@\351\210\274"
+	.ascii	"v\021\340\244\247\223\311\0323\ty\237\276\216\333]=\370\223\324"
+	.ascii	"\033\003\244\372\240\323\005^Ae\217\035\341/\264\206\347$r\325"
+	.ascii	"\237fd\206\327.\023\243<\272\005\002!I\307\371\353\b\334\215"
+	.ascii	"-\b\035~5N\331\034\337\246\240K\251\220\0206EC\331\270"
+	.string	"\355[p4\216\203\327b\242\275\023\357\020\326\b-\330\347rX[\r6\305\254+\324\265\330;~\306'\325\023\033\343[\204k\272EP\372V5\2224\237\312\266\b\217\tj\364O\237\017i\316\001F\301\017\b[\310\037\240M\357\213\265\b\244\255F\335\356q\267\225\216\304&\346\266\352\361:b,\177\250\357\004i3\bl\336g\340i\237K\351g\302\275\2319\310\266$l\367\353\367\326\241\202\017\370\330!\367\202\347\231Q\305\273\"\367~r\177\355\222Y\254\177B\267e\347V30\002\325\3746\365\275\365$\220\363\203\007\270\206X\377"
+	.ascii	"\007\203Q\323\022\006\224\241pQ\361\214\031\275\302\206B-\303"
+	.ascii	"8\314\227|S\020\370\277\347\345\330\230v\004\"\350\324\207_\005"
+	.ascii	"\234\217\312\233%\361\024\332a\244\206M\n\354a\312\303pD\216"
+	.ascii	"\325\246\224P\\p\216\035w&\274`\201\237\031\200\217M\272\352"
+	.ascii	"\223\030\r&\t4\315\373b\222(\320\261\223\305\002H\021`\210\342"
+	.ascii	"h\321P\306\242\212\312\0207\303\352\250\353\217\215d\214lOag"
+	.ascii	"\372}5j\005\260\336\241\255\271\344\030\306;HKT\001,\335x\256"
+	.ascii	"D\271\227\2558\272\024o\321v\327\002xg\363\212P\224\236,\021"
+	.ascii	"7?\261\350\215e\246\352\2677L\210\235\264\330O\334+9\342\277"
+	.ascii	"\327`\367\013\360\337\033\254\224\\|\247\033\026\270$\356\003"
+	.ascii	"\301\233\002+\223\202\316cf\222\317\255\221\225\362\261p{4l\334"
+	.ascii	"\252\306\267K\025\201c\027\364p\364\364\t.5\217\225\212\343J"
+	.ascii	"?\363#5>\371\223\"\274\345\305\230\324\310\336\t\235\030o\016"
+	.ascii	"\306\035\361j`C\376^\312\f~0\363\243)\203\225\216\276\363\261"
+	.ascii	"D=&\346hs\007\316\316\220\213\370P\b\313\241W(KbI\355\367\333"
+	.ascii	"\215{|\335\007\221\224*-Gf8\243=+\361m\231\n"
+	.text
+	.section	.gnu.lto_accelerationLimit.222.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\376\001\265\021"
+	.string	"V tG\340\360&\035XF$\276\246\363?\204H\036\361\243h\374\246|VB\310\004\310\366\220\002\301\037\241\022\347\250I?S;E+y$\b\266}\037q-M\250\t\233A\n\r``\315`.w\226*\262\255\031\261dK\231R_"
+	.string	"X"
+	.string	"a"
+	.string	"\266\257\342+fv\216B\255\326\342\303\211\305\313\317\323\356~\035/\220z\027O \365Ns>\273\327E\315\231\357\201Lx\371\220\203\tW\356\331\274c\2056\217\021\301M\f\020\034a-.P\"\301\324\n[R9\302\227\330\261\273\307=cBZ\246\007\262\273N\230\220\346V\335\366\210\355\nvF\b\031e\337VRm\366\343*\016+\323\253\373\334~\357=\177\352\267[3\235\231>\200\004(\206j.\023\264;\023uc\223\272#\023\367y\314\264g>\316-\333>*_\232M%\034'\241\246\335m\360\316\022\362\346\034\214%\007\317\367\370\205W\273#\206\214v\367\201\031\250\3369+}z\t\252\311\250S\333\225\245w\271\241e\324oS\233\321\211jsN\201J!\324"
+	.string	"\245\310\335]Q\265Y55\003\016\251%\241\204\\tP\365\260q\244\322\324T\216L\r\227\247\253\247*M\"\027\035\232\035{\220s\252\335\375\360\177\016t\342\227xg\017(y\030\224\324\273kJg\207\006\317\021K*2\320\005#ya\b +\001a&\262\327\005\021\320\202\254\344\025\213\241\270\006\234\200)!\321.\017\021\320\344\223\215l"
+	.ascii	"I4|%`\b\207\317\025;\371<\016\030f\362\212}2\030,\366\265n{\305"
+	.ascii	"qF\226\036w\0013\212B u+uLO\243\306\330\216z%\031'\222X\224\346"
+	.ascii	"\250E\316\031X\"J\331a\342\021\341\005* `\242A\2467n%De\361B"
+	.ascii	"\246\250\177\237\204H_V9\016{\224#\341\304c\274h\373\343:\323"
+	.ascii	"r]$\354;`\251\217\305\205\340\273ae\201lt\034h`\370\252\341\362"
+	.ascii	":\004\353\304\235\242\321w[L\354\257h\217\237=\n\b\007\034\227"
+	.ascii	"\032\017\330\260\320\320\022p\216\304\343\004\327X\351\332\326"
+	.ascii	"\3162"
+	.text
+	.section	.gnu.lto_rotateVector.223.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`k\003u\027"
+	.string	"6-\230G\260\230M:\360\021E1\031\266\367\202\024C\257\227\207\216\356\025\343\027\257yQ\241~Zg\244blAZ46{\300\364\2438:\227\231\177\016o\336\343\336\367\234\327\250 \316|\340\276\252\354'E\243\237XB\266\224)\005\200"
+	.string	"{"
+	.string	"\177"
+	.ascii	"\357\314\340{' \036\264w \021Q\360=}\034\317q\035\262\333\334"
+	.ascii	"t\232\335\"\234\323\256M\307\bl\257\361\336}\007\340\275\263"
+	.ascii	"\177\303vyg\002\337;\313l'8!\026h\201\024\021\021IVv\267\245"
+	.ascii	"F\326G\333\035S\366.j\312|\225\003\036\217F\264)\241\032\320"
+	.ascii	"\2738\263\273\253Z\210\210 \207j\263\2143R\\\257\364\316\210"
+	.ascii	"v\023\252\245x\252\034\354\256S\250v\342\366n;f[\202\255,\002"
+	.ascii	"5\307\335\254\230\246\211\351\231\230\226\211\351\325\3231\232"
+	.ascii	"\206\3214\030\323/O\273h\372\323\264*\246\275\247;MGMk\2463\323"
+	.ascii	"\017\020\300\006\023\024/\361d\327\304T\226\215\352\236b|\351"
+	.ascii	"g\372s?\356\321\276}\037\376\2177\335\311`\316Pqq\020\244\222"
+	.ascii	"\310\210\3601M\221R\362\340[r.\243\262H-i\360%\371J\006\337\371"
+	.ascii	"=~\223\035g\250\357\211\375\b+RH\240\354n\201\263\013+\030\305"
+	.ascii	"\321\030PaX\n\252\267\341\345\323\033u\371\323U\372\331\250J"
+	.ascii	"c\222\017$\346\334\007\303w\223\367\316\323\017\255\b\322\033"
+	.ascii	"\355\364!\215x\017\361T\243><\252QU\360\b\255\210\210-A\2516"
+	.ascii	"yCy,M\005o\264 !\221\316\2575\372&\341\323,\247l\340,\275\336"
+	.ascii	"\351\023n\264\\H4\313)\325\335\005Rua\333\200\362\253E\366\227"
+	.ascii	"\356\234#\3758\267\3757g\272m\236\273\003\t,\270T\201\005\227"
+	.ascii	"V\370\320\343\023]\367y\271b;\261\027\354\363p\236\236\237\016"
+	.ascii	"\0022\300v>\363\034\270\340\372i\3054dpm\300\320\362q\355ph\361"
+	.ascii	"\300:\264\016\340\370\365\323\003k\305^/X\013\264\355\277Z\304"
+	.ascii	"\343'a\244HT\220\316:ua\225\020\275\252\222,p\226\016\351(}\200"
+	.ascii	"\224[\013$% \022\313\343\356ntN\214B\215*WT\320h\314\213\013"
+	.ascii	"E\231\321\027\245\321L\nex:\243\253\033\355Hx$\243\236\346\350"
+	.ascii	"\265\204D+}Q\031\215T\302\243A\250\021\360\250#L\221\tl(\210"
+	.ascii	"\244\205\205s\240\002\221\253\342\006\020Xfb\232\016\":\332:"
+	.ascii	"N \177\273\211K^\336\357\374\3360\267\253KP\215.\214/\265^\003"
+	.ascii	")\312{=\277\307Q\314\017U>\257*c9d\270\225\331\024\n\016\031"
+	.ascii	"\317\3437\314\314\244\236\204\022\300T\262\035W\030\004\024\215"
+	.ascii	"m\003\253\031\265k\326W\003EW\321\264\007\030J\300\231x\311\370"
+	.ascii	"h\272x\342\030\275^\376-\274r\303zf\330\212\b\316\233\f\375\003"
+	.text
+	.section	.gnu.lto_rotateItermAndAxisError.224.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`U\005\215\037"
+	.string	"V7\302K\220\330Q:\204\244\333\300u\024\340b\224\232\240KA\205\366t\372}\202}G\311\fm\203v\302\351\355\372x\260\177\373f\213n\354S9\252K\220\330\250E"
+	.string	""
+	.string	"\202\272\211\252QO+\351\250\341\027v\032\327F\032!\204\354\275w\222\001\256"
+	.string	"\242"
+	.string	"\256"
+	.ascii	"B>\204\367\250\241g`>\307 \217\266\344\214ts\334\f\316\343\366"
+	.ascii	":\255<\226}V\036\333\224\327\235\245\226\"\367 p\tSA\025&\347"
+	.ascii	"l\263\302\230\331\366\267\370\306\227wY\032CO\263\234\301\327"
+	.ascii	"V^\337\324\271\302%-\277\244\336eM@\246\247\267\246\306\315I"
+	.ascii	"\340\003\211F\215%\310\001\\:j\374\351\0059\344\322\004\\\372"
+	.ascii	"yk\224n\216\226Q5c=f\274<g|\346\326\330\2709VE\025\367\220\361"
+	.ascii	"k\352X\035\203P\211\353\227$\343v\n\022\323E\220s>\220W\026I"
+	.ascii	"D\265\232:9\347\256\277$\340\033\300\273\237\323\335\026\272"
+	.ascii	"/\223\267\037\244\300\212\252\230\356#y\022\241\376S\003\231"
+	.ascii	"\250\377\035\367M\224\307\267\017\240\310\204)\371j\262\273\330"
+	.ascii	"\2536\330\375\232s\356\265u\352\256\321f\227z\323\374\310\033"
+	.ascii	"}\326\373|\325\333\274\265\313[\033\337\332\367\326\266\267v"
+	.ascii	"\265\265O\300\346\312\023\214\277\340\312\371ErL\366\302[;~\344"
+	.ascii	"\317\372\257\376\252?\352\227z\331}\343\315F. \207<\262\372Z"
+	.ascii	"PH&\254N\257\320'd\215\nT}\253N\253z\311\217\206\310\237\316"
+	.ascii	"\371 \375\342\247:%\362\"\274K\241\250R~ Wl\3119C8\217\021\334"
+	.ascii	"~\365\313\257\213\317\303\245\364q\301\260\273}\356u; \001\312"
+	.ascii	"\243\354\360\340p\3451\266\327:\216A4\206\r)m\260\377\317X\247"
+	.ascii	"N\273n\315b\035\366\346\246e\341\340\246\2559~q\203\233\266f"
+	.ascii	"\007\b\225\270\214n\\[\354\243\315\227\305\362\353Bc\255\275"
+	.ascii	"\266\244\372\371\223>\342\fs\316\022\272s\357\032Z\360\225s\216"
+	.ascii	"\320\344NF\364\237\216\233\204Ngou\fE\244\n\333\362\325\244\265"
+	.ascii	"\327\006\217wA\246\005\216\234{B2\t\246(g\237\202jil\305b\344"
+	.ascii	"\203\350J\276\244\217%\332\330\306\362\270\332O\0353\021\247"
+	.ascii	"\210\3179gk\203-T\006'\236;O\017\316\207\202N\203n'\204K\201"
+	.ascii	"@\3342\370\350rA\267 \335N\326;8 r?\266 \021\270\\O\b\233"
+	.string	"O\356F\302\266\263\003\262\341\324Z\367\303\263\263\005\351t;[Z\314\267N@\376#*O\274|\226H65tsn\232\360\253o)R\223):\263\030\354\2749\212\306P;\2633\341\222Ui\301\372X\340\313\312\315f\370e\273\347X}<K{\3431\220\250$l\013\025P\237\365\342\006\003_\317:\326\206\002\303_7\207\016\365\277>\326\003X\241\022\345\225\302\366N\033l\264\253\244Y\f6s\363\363\264/c\236\226fgB\032U\260\305\352#m\030t\250a8\344\224R\n\225\210\004M\222T:\240\002\2319\2629\021\220-V4SX\220\302t2\006y];\331|(`}\266\031l%\252\030\266u\023\3020\361\217D\274h\r\3466\032\351t{\262S\325\313\r\252\2412N5\210\272a\024B\366``\261`z\242\232gd&m\271\r\376v\006\301S\334\354I\260\316&x[0~\016;u\301"
+	.string	"O\311v\217\022n\240|\202\024\233\332\210\235N\324\360\n<\200\237F\006\250\207i$\274\203(\224a^\002$\245\262#T\217\024U\373\316\235\325ae\371\226[k\n^?Fx>\213d\310+\311\t\247"
+	.ascii	"\271\346\013P\217\016p\003\217@\320\225~'+0O\305\322\346\363"
+	.ascii	"6,\365.e\356\\\276k\316\0163\332\375~ \"\031\321w\b\331\334\372"
+	.ascii	"&2\032\311\376\007"
+	.text
+	.section	.gnu.lto_applyRcSmoothingDerivativeFilter.225.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`K\0025\023"
+	.string	"\366\244\200H\300\322Q:\243\002\022`\024\306\023\361"
+	.string	"<\340(G\200\244O\177\317*aF\317\270\202+9+\022v\306\002zK\241\202\271\2739\345\267\245_\026\273\rAP`\242\335b\261%%\367\321H\222v\324\177\017\033!{\313\235Rk"
+	.string	"d"
+	.string	"m"
+	.ascii	"\273(\214h\354\356\211\r\240>m\3730\036\303f\367$o\005O\t\223"
+	.ascii	"\013\234P\323\356\262L>\362}\312\017\370>U\305m\007\277)5\332"
+	.ascii	"|0E\002\356\004RNw;\210\302\371'\242\303I\223\335\255\211\223"
+	.ascii	"\304\245JG\023U\"\3101\032!\242\363 G\224R,=\350\321F7\023#\230"
+	.ascii	"\262\273\2169\335\315\215\272m\233\355\024;n\323\217\371>\257"
+	.ascii	"\017v8\234J\310\304\320\346\335\242\356\330\3270\f\235\254:\366"
+	.ascii	"\177\376\225\352\274?u\240\033\365E\2033\372\223\3213FK\215\326"
+	.ascii	"GG\215\276\200\022 \037D\334Do7D8d\223f\021\213\003\375\366\203"
+	.ascii	"\254\262\r\344\336\367fc\322\022\323\013\037\273\233\340\323"
+	.ascii	"\020\"\317\275\033M\n\036\377c\033\006\020;!\363S\333'\357]`"
+	.ascii	"\240cw\033\3703N\204\301\347\371t\313\345\312\375\230\372)\330"
+	.ascii	"\003\367\264\212R\355\026\330\367\334T\023\032\275\331\275\017"
+	.ascii	"\255-B\263+S"
+	.string	" \245RI\204jZ\314\304\360\016p\204\200\220\007\376\362\251r\030\332\240*\333\035\355\336\223\3139R\335\361J\243\256\004\355\240\211A|\215z\334\323\205.\343\305\347q,&>\367\265\327L[5\227W\204\032\f,&\253\275&\260\300d\001h\260\016-i\027\n\013L\306\252ih\201\271d`\301\300Z/,\327\214\306B!qL\366\232\261j\261\330\214\305\333\253\216-?\225\256\210|zfJQjc\033\245W\312\341\223$\2433rw\027$\020S\272R\233B\205\370\234J\247\336\3020|\372h\037\250+A<j\274\210fAE\345\373\004u\301\016)* \220\002!I\353\373\t\214\366\274\256(o\001\017~\230\375O3\276\220hqe( \207\363\277\216\274?\032\376\215\2735\333B2\236\325\275\264]\203\345v\231\201\001\231\225\244\",\313/\351\317\375v\330\024\032\273\001\302\301\343R\203\200\f\013\206\246"
+	.ascii	"s4\216s\351\220yyc\\Q\214\252\203B\001"
+	.text
+	.section	.gnu.lto_applyItermRelax.226.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`Q\t\3550"
+	.string	"\232St\022E`\232R\007\377\362P\016\2548L\377\253}\273\343~\367\255\314\243\200\353cd5\300G\301YV%~e\267\001M&G\232b\306\0270D\r\034a\006\201\034\016\2223\267)3\242\371\301n\250\031!{\313\224R\n\032\001\370"
+	.ascii	"\027\001\334\304m\177\027\236JW\251j+\f\327=m\033\346\026\327"
+	.ascii	"\266l\006\270\001\233\260\221\354\024\252c\353f\302\372\276\350"
+	.ascii	"%p6\252/\177K\302^\271\235\271\2374\224\252^\213\301\303\266"
+	.ascii	"\035B\215k\333\247\001& \354u\250\223l\257\267\221l\257\\\305"
+	.ascii	"\234\247\304j\255\024\364Q\263\252\370\265m\273\374\"]\325AJ"
+	.ascii	"\240\237\244\017\362\330\303\263c\324\311)\022\207\302 \273\336"
+	.ascii	"\367*\356 \204a\224\313\252\203\322Z\231\326\304\201\222\364"
+	.ascii	"O\0223O\226\265O\031\231#\323\220\370\221\250\207\347&\351ii"
+	.ascii	"\323u\322#7\271e\026m4\251\021\337\351!]cm\274I`7\371\345:h\322"
+	.ascii	"1\317\251\223\002A\223\376\360b_\371h\242\217\241\217\036.D\223"
+	.ascii	"zy\360\002\250\223\362\270HY\316\2567\351k\016\207\221\013\353"
+	.ascii	"&\315\020QS\344\202\372\275Hf\210\2501r=/\200\2579\034P\177\270"
+	.ascii	"&\252\223\246\335\241\266m\373\255]\213\313\351\036\204\320\266"
+	.ascii	"-{\224\253\253\031@37\0353\273`\016\352\005\375\376\314NO\336"
+	.ascii	"Q\242\037\302z+\346\376\322B\bM\224\231!\264\034\224\003#m\333"
+	.ascii	".\350\322^Lp\223\241\360\216\366\312\215\202\355\325\277\243"
+	.ascii	":\232\213\004\246\n\311\270\031\216\355\265_\206\332\032\347"
+	.ascii	"\031,^W^ef\263\362\027c\356\257V\253U\3760\346\236\322]\240\255"
+	.ascii	"t\017h\266n\244\353|\324q\315F\355\326\\\324Y\232\211z\255[\250"
+	.ascii	"\333\272\005\f\235\225Bg\240\240\363\317uN\n\235}\202\316\310"
+	.ascii	"\353|\024:\367\004\235yX\347\235\353l\274\316:\3279\347:\027"
+	.ascii	"Yg\342u\036^g\341u\016^g\226u^\257\363\275\316\277:\373u\356"
+	.ascii	"e\347}m\331\270\321e\324\266\335\252\302i\313\254[\222t\\\267"
+	.ascii	"[w\226~f*\267\2268\246\362\\\005i\227r\204\365\221i\321p\314"
+	.ascii	"\305^\273\261\364\033\027\263P\335\266\255\317\372\302\2341\335"
+	.ascii	"\250\272\355\022\243\327\266\255R\257\001\177\337\240hN\257\026"
+	.ascii	"\237X\304\214\215\026\002\266\262*F&\226\370\2756\305[\303\364"
+	.ascii	"\241\211\370\375\245\326&\255mpa3\246\243\324\312\327\231\312"
+	.ascii	"!\231\246a25\300\254\344\274\030\273P\251}\250\324\016l\214\371"
+	.ascii	"\".\265\362\265\312\364\372\253S\016\311\264\370b\334\315q{;"
+	.ascii	"\240\020?l\3709uS\272\341\007\335i\255\r\266\224\230\r\277\356"
+	.ascii	"\266\264\007\r;\241\360\033p:\367t\300*4\341\337.Z\255\367\203"
+	.ascii	"\t\216\340\213!}\303\265\373\001Q\023\302gGG52\372\243gp\007"
+	.ascii	"m\023|\246v\313\354\317\266\27522\372$\366\213>\370\r\r\343l"
+	.ascii	";\246\202`8\366[Kc\370Rc\323k^Qj\260\367\367\234\355\344\326"
+	.ascii	"\004\256\336yS\274\247\003\366\016\254\255\263\373b\035\203\025"
+	.ascii	"\372\237zy3\035\363t\300\376fb\327\0371M\363t@\346\236\3531L"
+	.ascii	"\334d\034\242\311;\332\304\366\272~\002\265\274?\036\367\213"
+	.ascii	"\336\337\240~D\377\177?\370\006=s\376#\213\224\221\321\342\361"
+	.ascii	"#Dx\t\251\f%\244*\260(N\255`FIMAy \301\3340\265\002\252\331l"
+	.ascii	"\361tlF5\233\024\214PSN\035\242\2320L\bU4\241\246\230+\013\346"
+	.ascii	"\013\247\313O\007H0\245\226S'L0S\224X\256`:\251X>5Y,\017"
+	.string	"(9J\n\252\271\234\212\212j.\213lm\177\330[7\215<\2602W\357\274A@\016\365\031Y\336\334\205\375y\240\344O\362\225\201Z^W\312*\220\217\001\277r+\344\373\034\221?\364\244v\233\361\350\217\257\f\374y1n\277\336\371\225\213\334\233d\3173\363R\007VEy\300\375\246\341D\230@\201Bt\357{^y\227\025'\200\027=\263\005\flGy\236\005\013\362|\253\036\032\343\003\343C\240\231\330\235\357%n4\354|K\325\342\374\361\270\202\214\301\n\361M\361\216/\326\245\006\307\317\357AT\212\232\036\343}\213\356)\275\350u\236\231\203\007\357\250\261\300\023\275\316\037\317\230U\241gN\241\031\325?\036\272&\376\312'\347d\212\307t7\244\334\355\344\274\017\232\216\356\035}\361s\002\200\301\250\201<\006\rS43\222\024\024\024\024\322\030\240\002\221\251\252n\0200\250\246&I\322\0017\221\244p\205\212R)"
+	.ascii	"\"\277\362vak\r\221\324\\\270\206\335%\211\310\277]\b\206\250"
+	.ascii	"\"\301\377\035\366\325\253\374\3114\240\375\361'z{\344\f:\251"
+	.ascii	"FT\017\b\244\245\332\256s\001w\320WC\032\336\220\324l\211\236"
+	.ascii	"\"\303\364\022I\n\367B0\214\307\241\257aa\305>\"\327\225\235"
+	.ascii	"\347\332\200[\264\025\2549\374\204\321\276\005\214ft[\017/\343"
+	.ascii	":\311\310Z\312\277@JY\320\253A\317\267\270\367\257\2720#\357"
+	.ascii	"N\275\377\276!\273\363\2439{R\254\253\004\007XBX\213\335\t\360"
+	.ascii	"\024\272\365\352\n\0309\307\207\r@t\325\177\256\323B#\337uy\305"
+	.ascii	"\221@B\033\320\rg\271\306\243Q]\b{\020j\021\331\016\346\224\340"
+	.ascii	"#\230\363p\201\350z1\034g\345<\270\337\245t\345\271]&\201\263"
+	.ascii	"~\217\363K\201;2\366\3342g@#M\366S\236\215\225\245\312\242\251"
+	.ascii	"Bg\034\b\264\214\3613`\021\003?\341\276\fvx\001Ct\031\323\322"
+	.ascii	"K%g\267\200\022\236\022v&_\345\002\350_\334z\232`I\005\217\211"
+	.ascii	"\006^\215\211E\372\230\226\274U\207\213\373`;\256\200\347\375"
+	.ascii	"\250\251\315\365\310\246d#JMQ[\372r\204z\361<^\207\344\356:\231"
+	.ascii	"-7<?ITP\020\240Z\354\236\317\317\346\017"
+	.text
+	.section	.gnu.lto_pidController.227.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`/AM\001\001\232\265=]L\020\020\207\345\244\003\003\251\203\005\312\037\200\"\264\336\357\261\313twu;\317\352xDyjd\b\375\264\213a\024\203,3\277@\334\006\211\341~\317\334\004%jp\001B'7i\321o\254\013\212]At\275\2271\316qx\255\021)\223\f\310\005\027\005\004\006 $\361~Py=P\342\025\222\304K\200\312\333A\345\035@\345\025@\345\345@\2117"
+	.string	"I\274\033T^\r\224x3H\342\005@\345\305\240\362^Py-\250\274\025T\336 \225\227\202\312;\001\022/\220\312\373\243\362J@"
+	.ascii	"\257\217\023\274\021T^\b*\357\003\225\327\201\312\333\243\362"
+	.ascii	"6PyyT\336"
+	.string	"\035H\274\f \361.PyuT^\005\220xs \361\342\250\2747*\257\215\312[\003\211\227F\345\235Qy\023\250\274\bT^\031\2257F\345\205\241\304{@\022\257\001\225\267\200\312\373\242\362\272\250\274-*/\013\023\274+H\360\252\250\274)L\360\242 \301K@\345=Q\202W\211\004oR\3455QyKT^\022\225\027\251\362\216\250\274\265\362\212\250\274!*/\210\312\373\241\362\036U^\017\225\267\003\022\257\321\b^\016\225\227\310S\337\026\301\313\"x\317\200\032$B\373\223\346\334\352<fJ\345\271(\305\033\312\235\341\251\263\324_\370\013\376\203\177\335o\367\337\375}\376?\177\240?\357\317\363\323\375i\177\333\377\366\303\375q?\235_\356!\030\004\177\340#\366\300\0358\305\356\231\312\203[\031:e\202\214\\v\262G,\345$\016\017(]\004\267\030-!C\355\036m\023\247+\304-N,M\323\347\036\025\206"
+	.string	"\313\302,\023\264b\324\264\267w^\321\036\r>\335\270Jp\233e\3177\2062JT\303\033\273CU\236_[e\205\362\264\251\t\002\236\265\301\211\371\375N\233\0351BG\207\324\326<\317\371v\217\326\205\357-\2075k\207\266\312\3224\265a\277\347|\216w?\007tA\327\333\243<\2756\277@\204qh\3224\r\364g\233x\213\b\363"
+	.string	"\326\365Y\362\024+\345>k\b\357"
+	.ascii	"\347\334\245GT~\3142\2614\265:\263\333&\207\275)me\214>\254["
+	.ascii	"B\346\bl\f\023\214\221\236=\372\020M\333R4\214\036\263Ll]\330"
+	.ascii	"=\372p\367v\366w\350\226\356\212\003\233\236<_\214>\374\260{"
+	.ascii	"\334\253\335\355r>\347\315\327\371\334\036\311-!\343!"
+	.string	"\214\2346,t\360\216\214c\202\246Zi\347\315\021,\023s\301\b\216\311\323\251\024\206EN=\3004e\022y\333&\232\266\035\215\242(hH0\372\332\331\216ok\342B\212\231B\021\363\364\320)\023L\323\224\306\207\313\001\336\007\035;\216O\213\301\005\0243\245\342!\357N\257L0M\2314>\\ F\037\356.3\017\347\37083l\2074U\022\3520\372\320\005z\336}\331\315\216?+~D\232z\345\241\223\246L\033+\303\350\303e\336\004\361C\243\223 ~\270\307]\2773\277\322\023\316.Tj\202i\232\342\3500x[\267}\224\371\r\201\036\277\177\326\317\366Y\274\275[>k\267{\266nmX=\233g\361\354\235\245[;;\267r[g\351ls\343v\316\302\255\234}[\267m[\266][\265M[\264\215\263p\226\371C\002\037\021@\360\200\003=\032\340\261\203\201\005t(\220\003\307\r\0335h\314H"
+	.ascii	"\001\0311`\034`@\001/\\\264`\261BE\n\024\004\234PJ2Q\202\004"
+	.ascii	"\322\210*\"\004\210\017G\036:\030q \016\321\346\343\236\003\220"
+	.ascii	"\002\336\022\241\345\275]A}\377\310\371\372\231{\343\355#\007"
+	.ascii	"\315\221\246)S\275\341\305k\373\336\325\256\266/\0377;\263\271"
+	.ascii	"\243\\\224\3103\336=h-Cs\274\b\263\022\303[\347\247\213\354k"
+	.ascii	"\203\036\016@\262\224]n\276y\304\276xT(\221b\034u\206\367\316"
+	.ascii	"X\222\022i\206\227\016\205\217*{\312|\355"
+	.string	"\224!\303;Wf\f\257\\\035\016@~F.\315\224,e\227\230/\235\257o\363\353\311\305\033\007\266\305;\007E\001\206\302\350\323E\250\013/\234\234v\340J\220\252\231\245\354\342\362}\333\222\244Dj\341u\333\222\205\267\255\204\262K\353\313F\205O\213wm\312WM\205\0229EO\no\032\232\245\354\212\362E\343,eW\3257\216\n%2\231\004G\205\022\t\205P\025/S\205\022\031\005\275\242D>\341\037\317KPx\037\204\205\034\301\"\277B\206\340\251\210\037P\241DF\031d\007\234\357!\370\006\376\004\231\207\037\340_\204Y\t\362\016g\0373@\350\013\f\272\016\276A\254\300^\241A\234\203\220\036\343@uP\251\362w?VN\024\004 \241\253\353\335\361\r>\267a\367\032#\224X{N\243n\017\317\260\341\320_\204Y\355\341\004\354\364\3640\002y.#O\223c\304\035F\234\242\277\b\263\232\303\007\300\335"
+	.string	"\017N\ba-r*\261\344\274\20079\374\002\235\261\265'\353~\254\334P\023}\272\b=\321_\204Y\311a\027paVm\334\002\355\221\352\371\335\217\025\037\224\303\023\013\326\033fq\366\025gf\254\342\314\217U\031\247 ;\2120+2?Vn\230"
+	.ascii	"\2621>A&\306Jh\b4w\310\373\261\"C\025hz!<\303Ifn\302L\031.A\346"
+	.ascii	"$\310\350\375E\230\325\030"
+	.string	"F\322s\224\360\t\025[\226\262\213\354#\300^\321\031\200u\022\335\217\025\030j\202\212\231\344\027\213@+\027\232\343E\230U\027\016\001\006k\353 \356|\030FO\2362\247\022k\353\037\270\374\b\20516x\347~\254\270\240(\326\234\210\331\302\036\256\304\322z\207Gi\271Q\230\225V\026\346\340\307J\213\212\211S/\302\254\262\360\360\205\022K\313Q\251\243+'\334!\256\220\250\2134M?w\256\272r\302\314\001H\232\246\313\311+\254\257\221\357r \264{!\273=\002\005\335|\037h\374j6\314\240i\232\246!j\374j\315~\255\304\246\347nj\013\311\317e\321w\333\246R\367%\013\245\350\025\275*\232E\037\020\236\246\207gD\364\346\335\rFE+\372\304\034;C*\332\007\236,'\032E/\001\235\242\016\204\247\331`D\364\270<\254\307\030ht\032\025\031\025\021?D\321'\324\356\030\t\217R\bh\037w\364"
+	.ascii	"a\023\255\324\233\324'\372\350\305\216\b?\276\3224}r\356\bu8"
+	.ascii	"\2754M{\324a\271#\322\311\221\212\212\370\241Rs@\224\274\302"
+	.ascii	"q\334<B\251:J\221B\3740\251\215fw\306\340\266yCN\023\030zo&\372"
+	.ascii	"bfv\306\344J\2641Q\3415\265\264\022\3151\022qZ\270b\346\2333"
+	.ascii	"\022\375,\2638\347Y\024?\027\251\227\271\270l\233H6.P\262\320"
+	.ascii	"\036\253\260\233m\302\330]\032\016\361\330\321\n\213\036mX\354"
+	.ascii	"\210%\313q\313\026\342\207H\375;\037f\231\305\215\235E\361\263"
+	.ascii	"\227\211|\247i\n\005\242\227+\242\231\306\357\350\201\r\242\231"
+	.ascii	"&\316\303\017\365\323\272j?\034\352\t\372\201Sa\273\313\006\374"
+	.ascii	"\350\t\232\230\b\311\317\035\321?zy\352\020\222\237[[D\217\350"
+	.ascii	"O\205!\371\251\246\266\t\260\020-\242Q\273)4H~\356\n\336=v\311"
+	.ascii	"\200\237\f\321\350^\242.x\310\206\332\021%i\347\250\227\373\271"
+	.ascii	"\237J\263\313\024t\317\204\270\250\321\317\204\3707]\265\315"
+	.ascii	"\247\273,\225\246Q\006\200\350\024\320\370H\361 \031.\020-\203"
+	.ascii	"\331\232\363C\037\365\017\365\355\246\302\220b\276|\350\016"
+	.string	"ZQ\374\374:\352\022\314\326\306n\260\207\276\035\006s\\\032\245i\324\223\273\3070\274l\322\342+MS\036\037.w\261\327\021lO\346\303=\2169\226)s<sL\303O\256\013'\r\265\313\\\354e\233j6n\343\210\037zh\017eO\347\375\272\013\fe\205\036"
+	.ascii	"{\313\263\312\002\235\\\"H\323\264\303\215z\271{\022\210F\335"
+	.ascii	"\205h|XX\213\204\"G6\373#\033\342\207F}50\255(~\3622\221?\221"
+	.ascii	"\246)\007\376k\026\204\306'\305\203_&\3629\3224%\366\222\253"
+	.ascii	"\234C;\241\355I\361\340Z\341\320\277R\0268\246\025\305\317]&"
+	.ascii	"\362\213\227\246\351\260\2273\020\227\257\030k\206=\231]:\266"
+	.ascii	"\341'?\334\037\333\020?\244\241\214P\354P\024?w\231\310\273H"
+	.ascii	"\323\024\355\345\356\356\362\224\363_\007\341\223\342A^&\362"
+	.ascii	"\313L\323\264{\271\273\273<\345\357\317\335\200<[n\240\f\375"
+	.ascii	"\341\223\342\301\355\313 r\277\227\251\264\220\374\334\275\f"
+	.ascii	"\"\377\365\375\372s\037AHe\007\311\317\255\351e\020\271\371\257"
+	.ascii	"\227\251\264\220\374\334\345*\216r\034\333\223\331#\331\321\214"
+	.ascii	"\237\374p\1774#~\310\r\002M\320\242-3\255(~\256\013\336\235 "
+	.ascii	"\b?\371\276\216\321\334\302t\002\"\033jW\360.\006\031\360\223"
+	.ascii	"\347k\026M,VN@dC\3552\221\177\232\246)\367r\367O\3234\335\366"
+	.ascii	"\332\025\301\313\177\247\373\262\337\363|Y\320\353\276\334\247"
+	.ascii	"\362\362\035K}\231O\345\345\272\312\313w^\370e\272\333}\331\316"
+	.ascii	"\355\276,w\273/\307U^n\253\274\234Vy\231Yy\271\254\362r\233\312"
+	.ascii	"\313j.\370\345\260\017~\371\314\b^\036\363>_V>\320\227\271*/"
+	.ascii	"o=\320\227\271\374\354g,<\365\345\253\247}\371\311\337\276\017"
+	.ascii	"D\301\373D\177\373\376\320\343\374\007|\334\367~\247\363}_\345"
+	.ascii	"\375\240\313}\317Wy\017Wy/\207\247\276\177\273\335\367n\027\374"
+	.ascii	"\276\355\203\337\263=\317\367k\247\373^\355o\337\247!\361\036"
+	.ascii	"\r\211\367q*\357\341 \361\236y\270\357\337T\336\237U\336\233"
+	.ascii	"U\336\227U\336\223U\336\273\251\274\037\253\274\027\253\274o"
+	.ascii	"Sy_C\345=\233\312\3735\225\367j*\357\303*\357\323\210\340=\232"
+	.ascii	"\312\3733\225\367f*\357\313T\336\223!\200\367cN\360^L\345=\330"
+	.ascii	"\b\336\177U\336\207\251\274\007Sy\277\254\274"
+	.string	"\367\252\274\357\252\274WV\336\177\251\274\367\202\202\367\\(x\277\205\202\367]*\357\271T\336o\251\274\327Ry\237\245\362^\253\362\036K\345\375\225\312{+\225\367Y\225\367UH\360\036\253\362\376\252\362\336\252\362\236J\345\375\224\312{)\225\367Q*\357\253*\357\223\225\367P\224x\377$\211\367T\225\367SJ\274w\222\304{\251\312{d\345}T\345=\224\022\357\323$\336c\3455*\361\026\223xi\250\2743T^\031*o\f\225\027\206\312\333D\211\367\205$^&\225\367I\211wI\022\257S\345u\241\362*\251\274MJ\274I\222x\221T\336#J\274-$\361\036\240\3622U^\026*\357\nJ\274*$\361.U^#J\274E\222xS\250\274D*/\n\225\367\204\312kB\345\035\242\304[B\022/\t\225w\004%^\003$\361\026\240\362\212PyCP\342\r\327;s\361\n\003\307\201\006b\350!`x"
+	.string	"\356\330\346\263\300\tb.\362bv\325\356\f\350\031f\266\f=\003Z\206\254\257w\032iix[fZ=\032(\001\003\017\257\003\302\3201\264\322\036\024\266&\375\3240\274\320M\276\262^`\262\364\352z\202s\356X\302\206~\321\262\304\251\257\367g\311]\001:\001\031\320\341B\017\001\243\3006\237\026\312q@Z\032\312e\314N\233\032Z\336[\241\005:<)\364\243\343\204\022\244+B5\005Nx\275\220\222v\241S@yr\327\324GZI\243}I\272\251QB,^I\372p{H\372fh\3266a|\325@\253\024\373X|\241XG\372Ymkc)\316\252\250\345\350\345\266\340\206Z\211i\341"
+	.string	"\315oJ+x\310\271\345\023A8h\374k\255\302K\371\305\320\237=)\036\274\241\205\277\207J\211\302\224\204\322\302\036J\265q\314\205NmsN\261\251\367Oi\022\002:\001\251l\320`\352!`fl\363\314C\tl\363L\257\2666\024J\315\326\033D5h\264\027\0133z\311\207\306\353\207\004\261\320L\235\024\246\020\317\nm\244Yh\264O\205^\241Q\302EkT\350\303-\365\315\234\333\204!X\354c\021h\244\257\367a\326\033D\316\004\024M\221\301aX\232N31\332\212\364\225u\372\220\233\"}#\205\276\336\221\334\236sDn C\241y4\221\376\037\nf\300\264\242v4\0175Y\340\360\nO\350\035o\353\263\365\t\255\224Gx\207"
+	.string	"\237\t\315aCz\2046\241\204\036\302\327V\002\ts\235'(\320\b\204\306d\364r[4\235|`\360\231Vj:\267\0168[W\031\200\256\375\304\031\240"
+	.string	"\315{O.\274\030\275\334\355\342e\207\251'B\363\231\356\020\332\203\026\241\211s@\350\020\232h\307\347\016\b\375;{\037\364\021\325m\023\307\227\r\305\276\032_z<\350\227\275\021\344<\203\241v!\3750<\215g\217\220f\200"
+	.string	"}E\377\225\246\223\351\004D6\324\001\275\334!k\005t\320C\300\274@\237\350\035\274\330E\235i\272\330\346\323\024M\323(\003\370NW\355\362\235\226c\243\367a\330\033;d\336[!\003z9\344\242\026X@{\261\220Z\201%\214\207\261*\277\027\\\274\250\360z\242\263\326\225Er\f\375\331#\305\203\003\350\016:)O\021\236:ujx\200\004\320\003\350\024\204\034\264\006-\200\036\006\n@s\320CDS\200Q\374\204\323\013@\337\316\006\375:/\310\206\332\335\242\236v\333f\r=\033\335V\354\203\241\307\246A?\354\215\235\363L\304^!A\027\306:\304\f\372\312b]\247\031\375\214s\031\364\r"
+	.string	"t\211f`\t\214A\357\026\355\376\347\030\364\003o\326\234\027\364\357\336\201\254\270\202\266\240w\213}\212\177\370\311\013\372w\267\340M\005M\303\2334'\016EIB-z\2715\002\007\261\b\302\024t\220\376\324\026\005}\261\263DN-)zx\254\354b^q\005\027\031\227T\353\207\231\344\326\n \315b\334"
+	.ascii	"\351\030{g\246i\252\242\321\002\317H\320\277\373\223\205\376"
+	.ascii	"\\\202\226\340\354\320\230VqP\213msG\233b\337\215f\3235\024\377"
+	.ascii	"\266xC\321\020?i\210\370!+{\204\263?\347\231\023\376\336\001"
+	.ascii	"}\357z\033g\304\\}\300N\203\306G\357\026\003\213N~r\321TKCm\004"
+	.ascii	"\355\243\211a\372\360P\025\026\025u\231\030\232\314\ft\212\204"
+	.ascii	"E\342\207\021\264\tg}\3163\b\372\177>\250\037h\b\372z\3570\265"
+	.ascii	"\205\344\322\274\325\037\324\313y\177\240_vFh\214\267\232\271"
+	.ascii	"4s5\323=e\007\232\271@\031\221\374$o\265\213\251\006\333\246"
+	.ascii	"\223\215s\240G8\313s\206\331\246\f\275\006\323\244\305W/\271"
+	.ascii	"t\033J$\266e&\027\305\317\024=h\340\006z\273K\t\305X\305O\366"
+	.ascii	"h\027S\r\364\263\316\232cZ'\330\376\360\2408\363\367\365\007"
+	.ascii	"\277\336\267\032n(#\200\201n3h\\R\030\350\006\300\370Y}~\002"
+	.ascii	"O,\320A\272\013\tT\216l\026\350\026g\260:\265?\245\276\362\257"
+	.ascii	"u\243\035\nL\322\321\204\025\350\355-\306*\374\344v\226\326b"
+	.ascii	"\264\202\305\230"
+	.ascii	"\305\303\267\217"
+	.string	"\370!c\331b\354\302O\352h\027T\r\265\317\273\002\375\25438\0239\376\246qt\216\356>\376\322\021\277\3268\232\004\233\336\223\312\016\222\237%n\240jJ\270F\1771v\361\2237\032\2553\210\005\317IC\025\356\311*#a\243\235vi(\324U\266i\324W\215\325\304\270<.\227\304\017m\264\2223\265\032\375\274\237\360\b\177\255w\215`\3061\374d\215\276\336K\364\031\254\202\304\304\273\3063\3064\374$?i\264N\240\"<dCE1\276`F(&\030\005\205\215\ff\213\004\247\332h1[$\206\034\343b\026((\030\265\314\325)\231\225Y\240\230`\024?G\364r\327\314\210\026H\007O\252\241\026\005>`\357\032\341\030\321\370\311\375\320$\243\343\004\224j\250\345,_\344d\326'8ckOV\315r\032\235\302 \tjG64Z\207Y\337X\t<\243w\215nF9\374\344&\3203\332\006\002\235"
+	.string	"\"\004\372y\314\362\2342\f\315\271\232\027\243\030-\243Y\rN\220\032/?\236\317A\030\035\243O\320\035\3200\232\351\246"
+	.string	"\215M\3763\3261JS)\036\313~G1\343\234Q\232\246\367\200\370\341\001\315\003\f\004\3365\3421\352\341'\r\350v\013\334R@\017\252cB\002\360\213\3365\336\031\373\360\223\005\264\013\251\206\032,\341\242_t\317\231\nk\321.\372\202\266\371g\343Z\364\013\315"
+	.ascii	"\215q\300\273\306<\343\036?\271OT\250\001\357\032\373\214\177"
+	.ascii	"\374$X\"Cx\310\206\022\321\313=\342\003\301~\001\313\302\215"
+	.ascii	"%$LO\004,\0137\226\260\360D\004\t\216$MH\2204\025A\221\302\t"
+	.ascii	"L\344\351\310\222\221a\007\025\304\360\304T\244\311iI\205\016"
+	.ascii	"\035 \031-u@\342\264\364\224\301\022&ML/,9)\001\261\364DD\210"
+	.ascii	"S\223\223\223\005H\234\226\236\230B\020y:\262T\301S\022\246&"
+	.ascii	"%OK\036\030aRR\2210\361\300\b\223\022\342\022&\030\210\240NM"
+	.ascii	"OE\210\\@D\311S\207#MNOI\232\202\260P$\t\023\"GH,\311`\211I\221"
+	.ascii	"%KB\226(Ya\304\322\013LOE&X2\322\304\301\221\245\027\226\216"
+	.ascii	"\210`\n\222$\006#C$NKO\025,=\021\021\322\344\024\303\n \226,"
+	.ascii	"\3010\301R\022\246#J<(\342\364a\t\bKH\230>xJ\262\344\344\304"
+	.ascii	"\244\b\210\245#L*49u`\204I\211\207-r\303\b\223\022\034O,\254"
+	.ascii	"\300tD\005\034I\230\210 \301Q\304i\t\216\033'\266I\311\222\023"
+	.ascii	"\216\247\246&'\034G\273\273\314\250\267\227\2071uxQ\215\334&"
+	.ascii	"m/\322\313\335\"\026\343\336\333\030<\304ER\022\245\200\326\306"
+	.ascii	"\276,h\375\271\243t\336\020\215i\231\240b&I\244\227\313T\267"
+	.ascii	"!\346\004\276\352EM\350\376\333\331\337c\342\260\351A\341\255"
+	.ascii	"\371\252Q\270\225\3013\265\205\344\333\323;\024\b\320\237?1\274"
+	.ascii	";>\202\203\206u6\350\361\273\3037\244\263#\303[\237\240`\024"
+	.ascii	"?\373\204^.\227@\343L\365[\301\25233\204\306\273\253\226\017"
+	.ascii	"\260N\"\023\3424\213)n\t\302O>N\177\213\027dC}\310\231\235\302"
+	.ascii	"\260\016\t\305.G6\314\326\361F\310\331\241\233s/\241F\354\016"
+	.ascii	"gM\034\3129\353\317=\001\257;kJ\030\201\005u\363\215\240\361"
+	.ascii	"\257\255\221\320K\026\324\327\363a\331Y\0322om\013y\367\347\007"
+	.ascii	"\214\203\246\251\362\307\363~\3008\374\\\356\323\273E\256\341"
+	.ascii	"\3326W|\251\025\373\222\206io\200\306\264\314\372e\315}\232\373"
+	.ascii	"\342l\363\200\340\024\373n\3074\353\003\"\353\273\351\227\365"
+	.ascii	"\t\265\263m\276iV\354;\\\031Y\277\271w6\326\027\353\273\351!"
+	.ascii	"\242\251-\344\240\241\233mJ0V\354k@l\254%\030\326\260M\033zC"
+	.ascii	"6\305\276\030z\3035b}\264\206\016o\313\354,\212\237<B\0324g\272"
+	.ascii	"\210}\t\032\240\227\313!t\240\034Y\241\b|\327\207k\363eHf\314"
+	.ascii	"P\314k\350\263\351\267\351\177\245\251\241\337\334s\353\257\351"
+	.ascii	"\263i\016\201\246\302\340\372r\372k\232\243.\302\336\026\033"
+	.ascii	"Z\200^\3562\237\346\273\366\201\350j\372a\315|\332\206\332RM"
+	.ascii	"7\333^WX\263\223o`\346E\252\241nG\370\244\216\b\275L\323-\316"
+	.ascii	"\276,\3234G}\270\307\355\317\031B/\227=\030r\235\205\340\221"
+	.ascii	"#\213\373\200\353\372r\344t\247\305\005\022A(\206\031v\331\346"
+	.ascii	"\375\364\270\034\255<Oo\270\205\353\372x\366\316\242\370\331"
+	.ascii	"\037\370\361\3408F<\232\006qV5\324:\216\221\035\315\320\364\321"
+	.ascii	"\270\371\215i\235\351+\333l\3615"
+	.string	"\264\202\366%\013E\235\351\347q#4&'\244\227W\333\\1\264*\366%\r\251\f\272\345\211\t\362\224=Yf\004037\224\262\315\025\303(\305\276\244aU\237\031\246\353\223\351\227\351\017\241\220\351\016^qh\266\314\264:\030\303\007k\246\373\2301\3052Z\r\265\027\323\037\323<g8%\246y\354\235E\201\265\020\2678\247\026\f4N\256\001\364\322\207\024\363\3053\304'\352?\317_^yPc\372\211\372\004\"\252\302\257>`\363\230f\250\243l\002\335\300\205e\r\315\325\020\371\325B\334\342\306\302\364\3014\323u\b\260,lSa\310!T\2320N\255e\337\253\017\246\3219Sh\220w\333\246\321\262O\307\rnL.\252\220\260\311\n^\375\347\207h\334\340\234{C\327\2404\001\f\001\301u\335\017\033\236'\034\364r\017\300\3422\263\001\333\351\026X\\S4`\271\276[W;\241\203]-\304-mL+"
+	.string	"J\230\343\212j\330N\243q\272\020\3419i(f\326A\364g\003e\377K\263\\7\"4P\331O+\262\371\322h\234\256\033\360\2444\360\302w/}\275\217P\223\353\202\227A/w\b\030\f\016\247\317w\301\2554\253\351*\256\032\377V\237\253O\245\265\326\357\322\337\352O\025>\351wi\016`S\002\251\n\267\264\241m\262\370*\204\2647\345.Y\210K\177Ks\\7\035\n\210\3765is\\\366\327\300\344\242\276\245\177\326\206h\214\3254\332\267M%\224P\261\257\004:\b-\324\346\207\226\367V\b"
+	.string	"\275\334\325\322\207C(\366%\210A/w\371X\331\317\322\327\322!\366\244\374Mm!\323\372Z\375,\335\204X\372W\372Zw?\226\356\240\265w\245#h\373\033\323\312\352[\351O\025\312\333\346XVsX\263v\350\202*\035h\233+"
+	.string	"\025\373\222\376\374\252\277\207\366)\276A\357P\274\"\231Y\361\315\033\254~\225v\341\244\241\320\"\234\243\024\2546\266\005r\356\336\361r\203eA\332\332\030\264\275\253\256\333\246\022jC\261\257\204\236\236\303\327\267\352_\365\220\216J\177J\337\352TP<S\372z\227\001h\315\253\002\n^\325C\300L@\bH\233\256\332\275\224\2716\375(})u\242\250\255\3312\323\nBA\211\344\004\204\222\375\252V\332K\376A\351O\365\223O\372P\340"
+	.ascii	"\237\364\341\366\250\334\332P\266O\365\263\332\360\214\001\271"
+	.ascii	"\223\276\022\rU+&rr)+L'\340\017\037G\366\0200\021\370APV\306"
+	.ascii	"l#\327fG\002\037\355%\025\201\337\243\372\310F\261\227d\233\n"
+	.ascii	"\203jc?\252\321\276\251\260>\024Y\372\364(\326X\3206\305>\026"
+	.ascii	"h\r\306~V\233\035'\004\275\334b_\251\206\256\231*\366\r\032\232"
+	.ascii	"\337\224o\036\b\204\223\250\263\301$\331T\246gQ\346\230233\322"
+	.ascii	"$I"
+	.string	"k\303\026@08<\"\224\312\252^\037\023"
+	.ascii	"DN\351\"\212\254\346 4d4$I\3327\\f'd\367\224\350\305\3427~C\225"
+	.ascii	"gl\213\313)+\006\n\256\013b\342\202[\244\323\274\361r\t\034\350"
+	.ascii	"\306\023\\4H\241\2753\262-\361\321}\"\3210\214?\275\335\273\036"
+	.ascii	"'\277^\025}w*\276\bPs\356\234\263\261\341\202\f(\377\023\350"
+	.ascii	"a\353\022\020\027M}\320\t\221\340\356 \264\236\2158$\306\277"
+	.ascii	"\317\256\215u\245KHq\244|Wi\263\234z\2713=\304\007\033\347M\270"
+	.ascii	"\355\341\224{\r\257\334"
+	.string	"\325\3673\330\216\315\333F\027:B\035\246}\304\214\367X:\313\177G^\265\302\274`n\226S\332\272L\256K\360\r\244\034\350bh*\231\336'\2718C\201\240K\3434!m\25460\244\201\201\202J1\353\001(\267\003faN\250\366\020\346\353\"\303\372|\252\253\352\331\375\344\234T\375\021\230\346\t9\206\300\001\303\313\265%\002\327\231\203r\230\212\026\364\343\033\3040\233\277$t\361\177\307\025\305_q4\343xP\366g\355C,Q\360\007\004\371\210\206\334\2746\370 E\360\032\322\247\364\367\031\376)\b\324C\355\320\035\317\026\030\314\216o\266\035\375\304\315<Z\002|\306\366\030\216\216\2506\355sd\224\353\322\022\302\205\245v\256\341\316\\\267D<\230f\316o\303\267\177@\2148\301=\013\265\r\314\257\225\202v\231Y`\312\232q\314\222\342\305\305\224\005\333M\235\202\335g\037\026\232\271\264\237\017#\221\352\226y!"
+	.string	"%\020\374^\213\246\373\005\221\324\311\b\224KLf\233{\3448y`b|\226\221F\325}G\177|\021\244\260\354\032\313\330\303p\374\347\344\366\343j\262\364HX\356\373v'\200@\177\f\244\232\013\033\202\177\356_\354lv\026\"\"i\r\272\217{_{\2018~\267\264\332\242\004\311\351K.;\204\323\033\373\3202\024\021\007p\254\356\354}\307il\021O\274E\335\311H0i\305J\327\322o\262\370\351\357\354\235\327\r\202\f#\203L\b\334\223\226]\220\031\325\001\033\b\374\351UfGT\320\231\207$\204 \351\355\215#\304#\372m\3543\202\206\026\026\034\t\221\241~&\376\336\356\016\353\201\313SEtK\230 \242"
+	.string	"\3170,k`Al\361\256\325\247\r\022\312\303\223\t\327\256kS[_\275\372+\272\017=\013\317\205aG\037+(\325\214\273\217\036H\333\222\317g\224\220W\353\252g\330)5\016\274\240\340\317X5\342\220\376\236D\036\317XlBg\340|\247u\206\366\354x\b\3330\270\376\202\005\222\212\r(@\24308\372\003\003\020-h0`\230\252/\210 \324\005\037-P\307E\025\376\024\324\004\027P\254\217\n>\027[hdq\244\026\n\025E\nv<\232"
+	.string	"\312\327\321\217'\236\240N!8x\305[\035\332\242\001\300\350\377[\314\306\271\266c\253\t#0\241\364\177\344J\320P\023\027L\200\\\"\220\016n\357wc\037<\237\225\273\263\340\022%1\0353\225pm\210(\363\361d\232(\347TDY\245Z@\025\371!\336O0\2372F\"\223]\313\216\016\341\r\211p\003\376\246\017\377\255\210\006\221\016X\311"
+	.ascii	"\302\275\353Q\2474\031\375\243\343\344h\367\344X\005\203\377"
+	.ascii	"\331\206"
+	.string	"\305A)f\247\377F\024\r\227kd\276\262\326\245\3660h\334\306yS\343\202E+\334OsH\233\007et\210\305\035]\337\377\365\211\237\375G\302\206\376\003\254i\004x\246\375wX\246\323\347\365\234I\3329w\303uW\325d\312E\342\233\265~\311\243F.|\324D\225\253\212\243z\225\372\301\303\\\320F\250X\263\273i\333\264\211\303N_}|\276\025\374\3560\202\3154\0025O\273G\367`\360\245\306\3203)\\4.e\245J\004<z\366\365}\224V\333\326\021E_z\025\025#2jE\0344Vm\217\b\"3\035\321\335H\1779\206\316\305\036\236\273F->[\210\223'5&H\022\376\275\211\271\221*%YNwc\351\225\366\352\230\364\210#QY\237.@\316\244z\2253&\261\327F\335 :\212\341\223\345\276\003Q\342\tK\330&a\343\367\303\224q\205\321\210\250\246\227\210jG>\207bR\361"
+	.ascii	"\274\310\234\325\207\024\177\023\345\306\033TL\311CY\225\261"
+	.ascii	"&\344\374o\303\300\273\036\245\006P\212V\256\247\003\365\b)\261"
+	.ascii	"\031\344\202Nx\202\016\021=\220\237\001/\322jX\323\023m\177n"
+	.ascii	"1\331\241~\037\322\005H\357\022\001'\031\004\221G\317mH\373\274"
+	.ascii	"\346\032\321\313\260$\\d.\024B/\016\274\302\034\316\2517\254"
+	.ascii	"\274\213b\027\032\001\365M\023V\353e\230Ea\0220\241E\023\252"
+	.ascii	"\200/\320\177o\n\323\001\t\204\223\377\207\2776\226\2150\244"
+	.ascii	"#\223e\246\312!\0041\244\346\b\216\\\022\021\261et\327\262',"
+	.ascii	"\2457\330\330\307k\003w\364sI>;\216o\305xL\343\345\207uA\003"
+	.ascii	"\t\031\327\bM\025-A\351;g\002\261I\267\036\007\315/\254C\350"
+	.ascii	"G\207\266\006dU\2279\030\246\321\\"
+	.string	"\227\027\357\242\255|\321\021;\317 \331H\203E;\2102\031n\3008\276c\007\313\352\373<\270\236o\347\324F\244\376\367&\nlr\362@q\266\026S\200\267\250\211x\307\306{\337\373\224\0246\242\213\240W\347k+\235K\245\224Bg\001\\f\374\266\222S=03\017g\005W\310\324\241S\007\262%}\223\325r=\250\271\253\016\005,\002?e\332\263k2:6\303\025\025\237\017\326\345L(!\2661\215<\fE&\026!:\256j\227Ud\204\341w/y[Ge\343\210\356A\237\342*\024}\022\202EX\261|\364\316\222\327\270\263\034\250|\2665\330\202\316J\235\327\333\307}\364\310\376\021\232\326\032\344\205\353\024\002*\241\373S:\217\211\224\246\013\001S\237\374g\206\250\202J\324\334[\372*B^\"{\020_Y7`.\006Y\364=\367\373\220.z\374\330\257\017\354\234K\324\233y\317\236\335\376N\240\234."
+	.string	"\303\346)\341"
+	.string	"\272\017\370\324\250e<\375\213\261\203\365\311;~\217\300A+T\221\213\002\005\276\021J\030\277o\007\177\355\320xN\330\337\303\317\324\230\030Z>V\337\f\235\232x\336\372tc\377\016,?U\241M*~]A\335\354*\304~8\231\320\341\254\275f\231\224y(\007t@o\221\221\202\300\334\004\270<\236(\217Y\321\206M\311\027\376\023\004J\255j\361\\\260G\203\005gfK\275p\021@\312yJ\347\251\376\037\313\213\013\221\025\344_\257\301\266K\001\232\003\231\252\241\266\372\310s\304#[\035\f\3237\306\256[\307\017\017\273\307\340DK\312"
+	.ascii	"\230\262\023\332_\b\337H\260,\322J\210\314\331@\200\207\376E"
+	.ascii	"\265I\206{w\377\256W~\025\324<\210DI\304j\364\206&$5\357U\030"
+	.ascii	"\266\033\253\377\033d\332\251\250F\277\324\242\223Zz\204\351"
+	.ascii	"\234D\347w\374\302J\366\247D\261\270Mr\376+J+q:\004\017\237\242"
+	.ascii	"\0212\234\203\f\255\207\2404e\020/A\243\336R\224=\343\224\336"
+	.ascii	"P\004s\0279H\247A\031\323\262\303\251#\027\340\304G\361\220\356"
+	.ascii	"'\n\216A\255\226\034\256\fNQ\222*fh\362\210\270\271\251b\242"
+	.ascii	"\317O\231.\373E\016]wb\210xW\253h`^t\312\255\211P9Up\327\373"
+	.ascii	"e\t5?\234\025KV\271H\017\226\360\224\220\032\231`KC\036\210\267"
+	.ascii	"a\312\230NS"
+	.string	"\273\251\034\276\355\262\312\270#\343\221\020\310;\206U\037\002\232\260\361\364\"y\005\352\036Y$\203\033\353m>H\360=\203\313\277f\213\312\337\300{j]Z\233Y\376\3221\272l\312\200\315\270\n/\322\205A\311\036\252w\312\377<\005\231b\225\352s\241\"\231\"\245`|P\244<\256\200\\\006\300D(/\355\342e\005\320\223R\300\224\242z\034\337C\345R\217\030P\013\221\324:KE\2226\330u\260^\266\215\252d?\0061WD\216\257\210\371\033\371\362\204\017\360\315\231m[3\207]\206\343\365fQ\321\212\334n \234)\345\222\030\363\344\t\316\r|u\035\244SNu\357\026\200"
+	.ascii	"\021\306\347\"G0D\336\261\3138LS\230\262LM\032\032\032\256\332"
+	.ascii	"\2756vB\004V\226\217Cs\354,\304(6Y\322G\236C\037\220j\311\026"
+	.ascii	"\036q\365R\226Pb\341\333#qt"
+	.text
+	.section	.gnu.lto_crashRecoveryModeActive.228.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375 \345U\006"
+	.string	"\302K,2PO\323\001 \233\256F\270\032\301\272\211FSL\004E*@[\337u\231\020\333\330\333\b \r\020\rRU\021\205@\235\235P\201\032D\304\211\304J\231R\216\240\006\211zV\004\204$\361\360($\206\211\027U\025\017\"\360D9T\317\232\246\352=q\257\231\324\002M/\354\223\\\003}\021[\\\371\355\216\177\001\334I\025\360\320rc\307,\365\303\376e5c;\235j\2409\341xg\262\313mZV\305I\351l\3376f?FH\300\f\037C\270\201\216\025\214\022\226\335\370\024\344\360\t\375\217|!\243C\3310\3313@aw\235\033f\343\326\037\330\326\b\b"
+	.ascii	"2\003\316:#h\b\3055\261a\b\022\356\2624\033\336uo"
+	.text
+	.section	.gnu.lto_pidSetAcroTrainerState.229.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"m\n"
+	.string	"\306\223I@ m\225\016/\327!2\016\224\334\0253"
+	.string	"\223b4|"
+	.string	"\274\212\351\341\020A\303\020\216V\357o\330\202\255#\264\350"
+	.string	"\335\360Z\005R\245\bR\020h~\231\246\366j\334GW\216\211YM\266\224)\0055"
+	.string	"7"
+	.string	"6"
+	.string	"(\013$v7j\204o\207\232\233\377\327-\270\216t8I]aF\f\302\007\214\356\004;\034pH\375\365D\320\2312%\227\335ur\235\202;\273\355\020\333\321\376\003\337\367YU\360\256_\237\276d\243\003+\365\326\210\335\004\337\211\205e\032Z\266O\261\235i\177\200lw\215*\017q\301\265a\327\3630\307\344\2317\033\304=\t\253\261"
+	.string	"E\257_NJ\262*T'*Ef\020\021{\240\272R\275\216T\360pJ\023\366)\334\033\371,\207Dy\356\231/\252xv=\200\341+\301\240\224\237\355\221RW\366\365\013\032\r\243\211\2044\234\2113\026"
+	.string	"\033O\324\006\b\330\020\b\0209\033L\201\230\371\200\242\245\342\216G\363\211Z\247\363\211\024o\017WU\027\023\032\300Jj\202\273\273P\222Pm\220\201<\347\007\r"
+	.ascii	"3\241\017(\360\202\317\200V\220*\\\020\304\201b.\3442\nP\335"
+	.ascii	"WR\343\304\235\213\252\035\032\230\202\002"
+	.text
+	.section	.gnu.lto_pidSetAntiGravityState.230.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375 \342]\006"
+	.string	"\322\013-4@o\222\016\230> ;\220XI\035\272\325\272\261"
+	.string	"\344\25580\264~k|\341\233\311>\326\201\205V\263\354tQ D\370\030\200\245\363\244\247\003\252M\023\262S\324\353<\006\n\352\223\331\303i\250@\371 \036\252\b\207\374T\035\211\364\\\023\311\331l\201\250+\237e]\251\311\212\216D`\341.>\0135\367\361\b\320\266;\3227\203\025\026\016\0349i5b`\2522\241\210\374\250\371[\373\004\005\fK\025\033t1)\245\264\031\302\007\031\234\306\276\005\263\220\016txd\224\274\264M\007\202\0306lD\022\024\020\215B\330\002\026\332\336D\243\r\334\341_\360\347\217\021\007"
+	.ascii	"3\003\316\231\361\341\313\3552^I\215\003wn\321\316'"
+	.text
+	.section	.gnu.lto_pidAntiGravityEnabled.231.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375 \310\315\005"
+	.string	"$\nn"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\317\313\266\004\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\235\227\025\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\367\271\001\224\216\217\320\256\002\002"
+	.string	""
+	.string	"\244\003"
+	.string	"\200\200\200\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\200\300\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\b"
+	.ascii	"2\003\202\341\243\302n\025\320]\363\232\020$\3349X;\313"
+	.text
+	.section	.gnu.lto_pidSetItermReset.232.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"m\007"
+	.string	"B\31647Po\322\001\240\243\271J\232\273G\201\207\317\023`\234\230@m1\245\033\035\212[\263\354\212\263\204\233\336\b\361\311\235\251\252*\232\2257q8k\nk?\366o\262eJ\001\035\314\303\260\371`\030s\256N\006\212\241\007\207\314\323\020?\331\006\"r\266\210xi\254\201\260-\2064m\213\231\271\267\366\235\006P!\252\322\243\260>\177\344s\344\177XB\244\347\016}\021\300\341D\t\212\313FIW\366$\351\343\260o\355;\331\357~\265\fV,2\336\261\354^\254^V\005OP\266\237\261\255j'(\310w#\315UR]jw\"\370 \340\320\322N\371\364X\002\r\223\n\222\226\335\215\257\343\362*\375\213\\\2003\221\256\230\205\335\265r&\214\373\335v\201\355\3136H\b"
+	.ascii	"3\241e\037\270\ts\213k\342z\b\271\244&\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_pidGetPreviousSetpoint.233.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`+"
+	.string	"%\b"
+	.string	"\222\217880\221\322\001 TQ\f\305\303OG!\3660\314>\250\022T>\207j\272F`\373\fi\366\237F\314\224\241\326\313\b\006\003\031\324\347\032\342!h\346\017m\237\354\275eJ\001\244\314\"\024-\0021d\243Y\202x\310\"\034\346D\026\222\230\242\2154A\002\326F\r\333,i\3326=\337>.TA\370AA\214\213\243\270\305\331\335\004\337\344'\024\276w\351\n\223\276\273\364M\260\343B\351\313\376N\n?\354\307\205*[\325\360\254_#\301\214\307\361\325\313\256\306\253fa\244K\3046g{\364,\267\270\263\353\241\302\262\273\b6\340\\\332\366GN\302\331\255\370\205x\003\035.\031)4\273;?\017\300.\343\001\260K\br\356\312\371/\371\202\314*\246K\235\256\033\205\335\265v\251\215\033\336v\201\355\003\333+\001\013"
+	.ascii	"2\241\245/p+\n\"\026\017b\002r\r\327\304\342\341!\210\250p\003"
+	.ascii	"PyL\355$\003"
+	.text
+	.section	.gnu.lto__reset_template_189.7.235.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`m\001\235\r"
+	.string	"\306WVA\340\230\266\320\001\250\343a\030+u\201\366"
+	.string	"[\203\366\017\231\327\377\033+\257S\215a\234\343\034g\255\316\317\262\270*\350\304i\006s\234\265\2465\255iG\002\360\205`\343@\224\020\037a\263|BK\211\004G"
+	.string	"J"
+	.string	"?"
+	.string	"\336\257\004\240Vw\217w\017)g\002c\351\354N\357T\013\027\b^\230bDX{\300\2312\2374\001@9\346\264\267\035\322\334K\300[\21797s\241\265\321\254f\031\267v@\364\263\201\320\332\200\267\320\032\246aX\006\"\033N\016g\207[\036\316\362a1\304.\021\363\214\030$\261X\3423&\036O<\242x\225\342Q\305\n"
+	.string	"l\264\274e.w\331\313_\036\343`3\rX\214&S\372\325]\306\373g\001\004\016Li\237\3560\336b\030\274\255\024\200\001\025rv\310a\211,\266\310a\215,\366\310Y$g\223|\252\222w\272\344,\223\251\264\311\256:\271J\237\234=\235\005\007\213\332\212\204\307\t\363P\370J\205]\026\326\271\360\210\3411\303X4\254\nX\001\021\b\373\364\241\031\312\247f\360[s\370\265\031\365\2759\312\007\347\374\342,\2450\316\312X\354\214S\245q\266\306am\234\275\261\2528^U\307\331\035O)\217\303\372\230\325\037g\201\254\323 \267\002) p\"\203\350\001W\021\3561\025%\261{\304\304\n\375\372\032\206\342b\227M\311\2462\204\341\234\252\333e\224\035\024\3739svI\255]Ek\207\\\006"
+	.string	"\367\244fP\215\306\t\210\337h\027\350\211^w,C\307"
+	.ascii	"\006\213\003\370\213\213\t\234\361\355\004\314\356\230\303\205"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_applyOrnithopterPidDefaults.part.0.308.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\264\003=\022"
+	.string	"\026\234iI\320TQ:\320\366\005"
+	.string	",\317\r\343hU\2661\023!Y\317U\322\\\221\237\261+?\271Z\264\334\250\301j\353k\357\335\336\302'e!e\307\"\214\322^\276\340\232\261&\356\220Y\261I^`PiD\366\327F\262\311\336)\005K"
+	.string	"P"
+	.string	"_"
+	.ascii	"\037\260k\323\345\354\226\246W3\030\275\272\274\311\367:z\201"
+	.ascii	"\357\325\276\t\3332\031\317l /k\36687\016\271\335\356\202\257"
+	.ascii	"t\304g\247\323\233\37113\264\323\347>cf@|\022\270G\"aw=\nq\327"
+	.ascii	"\333V\261\275b{\016\002\324\363\226\332\354\227\377K\fD8\261"
+	.ascii	"\353\241\210hET\235\022\307\335\276\n\231\2373\311\366qF\245"
+	.ascii	"\310~\3632KK\023j\360jo\332\250\224\331o^.`ax:\344\354.j\364"
+	.ascii	"J\362\234/e\267\211\225\312\375 \3439\355\243x\212\331mb\001"
+	.ascii	"8\240\027A!\320\217\005\272\037\237\037\236\036<N:\306\023\235"
+	.ascii	"\3519p\364\370\334\274\342\341g\247~#\264Qc\227@\365\235\031"
+	.ascii	":>n\020\304\313\210\001c\207\362\361\2631\334\305x\202r\034\362"
+	.ascii	"@\315\356>\310\360\026/\023\335\356\252\260\330\340\342\223x"
+	.ascii	"\365c\337+\200\235\236[\221\332,\232\224\306\001\341J\305Z\201"
+	.ascii	"\261\\\310\t\244\006W\370*\tWb\013\351\242\300\"\266\0028ub\021"
+	.ascii	"[ \354\202J\\\265\200,\321\302\b\246\\/\360T2\331\n] \214$] "
+	.ascii	"\351\336R\233+\f\355\250Q\030SJif-\234\264\271>B4\024d\332\031"
+	.ascii	"\021B@dT\240\013\362!B\346M#U\250\241l\346\320D2[\0365\214\001"
+	.ascii	"\360\002\031\n5n\021\360,\204&\232\322\270 \355\300%\316!\222"
+	.ascii	"\350\212\316\r\367\227\033\341dsI\324\255\203\352SF,\013\006"
+	.ascii	"\322\301\200\330\313Z\026\211S\265\016\004+Z\260\037C_\f<\206"
+	.ascii	"\013X\340:\203\032_\240\310:%\020^\b\330\342z\203\032'\201*\023"
+	.ascii	"*9\023\347\334\205\036\200d\035\223\246\345\204\031\004\350%"
+	.ascii	"\023P\3375R\266PI\t\277\267wF\330@\240\225\237\2554D\321t\220"
+	.ascii	"\230\311\313\323V\332\213\255X@\252\f\337q\362\007C*"
+	.text
+	.section	.gnu.lto_pidInitFilters.part.0.309.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\222\025\225X"
+	.ascii	"\212\217\344\037N0TRI\007\345\267\370\244\246\3101T\375\221\242"
+	.ascii	"\360HvghRk;\272\233;&Y{\3671\373W\362\264\367\365\370i1\243\253"
+	.ascii	"S\370@\237\007`P\344\227\304\344\017n/\241\273\370\222\332]\365"
+	.ascii	"fR\232\273\276\373\265\026I#\244I\231d\355\001\265\001\347\001"
+	.ascii	"(\231\335!\016\347\036\007\"{\035\036\346\312\035\276\021\271"
+	.ascii	"\233\220-n\255\32501\337!\275\233\0204\013\211\212I!\355\001"
+	.ascii	"\364f\021x\241\263\r\f\230!E-b\335J\001\214\025\003\320\233_"
+	.ascii	"\210\334\313\220-j\255U$\362l\317!\275\227!h\035\203z\271\341"
+	.ascii	"\351\325\2726us]\2407\211<\\\346\257\021\271\032\tFkU\f\271\314"
+	.ascii	"\273\357\362\264\364j$\034\250V(rcj][qs\237\320\233\273v\242"
+	.ascii	"\363&z\241\363\346\356\267\354.\021\344n\272\213\367\265\263"
+	.ascii	"z\2672//tj\255\306\233\r\303\216\020Q\351\304\366\201k_\250`"
+	.ascii	"\372(\250'\247\246\024L(\226\212JIH'L\22482\"QD4$\024\004D\374"
+	.ascii	"\361\351\341\031\nw\320\340i\002\233\245\322=\177\205e=\nHd\201"
+	.ascii	"\005\251d\250\240\215\027\304\314\374\311\314\235\360\276\264"
+	.ascii	"\006)\367\306M)\300\352\342\230\211\271\235\351k\220;\240\b#"
+	.ascii	"\206\227\200\270Rl{\223\306JjOzs\243\333\02531\265#\265\265\331"
+	.ascii	"\302'\270\334D\233\337\250\242\026\307L\214\313Kt\261\001L\037"
+	.ascii	"\005m\344\331\020\307L\254\355Fh\300\"\t`\261\n\260\250\254\201"
+	.ascii	"\213\210\2026\214Q\256\230\211Q\371\220\232(,$\345Ajndr\305L"
+	.ascii	"L\312\201\250\234i\201\211g\377\t\3328\363\033U\276\342\230\211"
+	.ascii	"\235\335'\206\233!\313N\242(pRv\311\f9\245{\260 \2330\017\260"
+	.ascii	"(\003\260\250d\302"
+	.string	"C3\261%\027\002\211K\200,\226\260 \311xg\351\005\261$G\2036\344\016\304r\247\307\205\317L,\311\203@)=2s\210\300\250|\r\303\274\370\354bS\030\306\302\201k\220J\206a[\334>aE\200\305Z\353\225g#a\\\314A\227\n\332\250\265\356\265~\370N}\267\313v\027\204\335 !\001\311\375\03394\300\235>\232\034\0256[\330Fv\207\234\3026\312\222\307f\327\277\332r\371gv\262w\032\b\234<\257\277\001\226\313%\020\355\356+64\301F3\370^\260\3159B\240\365w\271\\.\273\223gw\347`\243\333\342\2765\373\354{\375-\216\033a\205\326\272U\265\227\023\302\216\375\024\022\316\233f\233Y\330\360\245qws\233.4Z\312/\260V-\2467\367\273\260\024\341\345\356\365\036g\225\373)\273\301\276\361\277\366\355\274\371\276\362+\346\320\241\221i\361\222;\271-\365\345rYg\033\312\256"
+	.ascii	"C\336\032\277\373\3228yg\234\274\001\bye\234\2741\204\274U'/"
+	.ascii	"\214\223\027\200\223\367\005\312\353\"\310\333\202\305\016\257"
+	.ascii	"\361u_\252\223wE\220W\005\312;%5\344\215:\233"
+	.string	"/\324\311\373t\362:\005y\233N\336\024B^&\224\027E\220w\251\270\303\253\3644\337\244\223\027\t\345=ab\310[\342s\337\243\223\327\350\344%q\362\026\ty\211P\336\241\177\371\n\005\355\360\002\335\314\227\210\362\376\274\314\327\347\344\3559yy\202\274C\341\333\276;(/\032\344\r\242\274g\220\327\374\332\017\374\333\267O^>y\237\003x\005\355\247\254V\260\345\021\325\211\311C\225\277\375m\377\227\277\314o\346\237\373\323\374l\376\272\377\356\302\335\357\207\300\273\203\003G\351\347\003u\363\246\316-\2106l\324\350\324\244)n\021\353V\025&V\20083'F\371\245\307\303}\330\313\231!R\343\026.\214\033\232\016N\346c\366pez\b2\005Yk\355!\b\232\205,2\"\303\031\275Z\253\216+\220\031\n*\266i\0074\365\244$\241\244.\366\345\360\271\231\301'\032\251\225RH\301\272f\340\021\306X\b\250Q"
+	.string	"_I\233\300\260\242$\324HTN\364\325\274i\354-h\002\n\244\360\305)\371\225?\nh\232"
+	.ascii	"ur\177\242\374\230h\323\316g\352GG\315xpQ\340\244\020\217\332"
+	.ascii	"D_\016\235\270*6\352\022,\244cE\256\263\343P\232\204aH\227\300"
+	.ascii	"8\253\265V1\300/\244M\250\316\240p2m!u!}\222>9o\2260\342\242"
+	.ascii	"&\2214\022j\022\354\302*a\330\267\242\376\2317\215yY\253\265"
+	.ascii	"\376trcH\245TqY*\203\030\035\345\027\022$OB\246\311\342:\333"
+	.ascii	"\367Y\262\314\344J\234\250`\205\307\226\311\216t\"\251&X\251"
+	.ascii	"\265F\361\221\2555\353e\273\274\002zV\221\313_\025\354\314Ju"
+	.ascii	"R\243^8\331\342\277*\034\226^A\211:\230e\311\227\326\323\311"
+	.ascii	"\035\352\356\367\261\241\021\352\241>\341\274\376x:I\347Bm\244"
+	.ascii	"\305o\006\006\263ZQ'\324-\304\036Z\332\260\2234\244Z\222\030"
+	.ascii	"\205+\017\234\203\027\3674g}y\302Nn\217\035\032\324f\224\340"
+	.ascii	"\324\211md\305\211\315i\177sG\266\354\2508\261\203\372sw{]eL"
+	.ascii	"\374\247[N\237\376\351\236\006\352\335\264K\252\306\377Z`%\353"
+	.ascii	"\254]6\201\207\317\277v\027\003\366\"@E]\255U\306\315e.\3562"
+	.ascii	"`\017\270q\343\274\t\324\377B\302Z\\D\201\005\032h\340\274\371"
+	.ascii	"\323\227;\223\017y|dt\\`SP#\346\351\236\336\205 \002\376\227"
+	.ascii	"O\027\271:k\205\335\323\357\322\0336O\227p\227\327\2457\001\005"
+	.ascii	"\306\272Z\265\376\265\257\363\277\n,\270\200\377u\001\334\371"
+	.ascii	".\210/$Jq\\`\301N\256\3259\354\343\365\r{\330u\307G\267\\.\317"
+	.ascii	"\016\307\377"
+	.string	"8\212\200\003\b\301\007'\220\037\307  \fq`\210\325\007;\202\200\260\343\n\001\035G\037B#$\300\201\025\220\036\016\360\270\332!\201\016\236\0218\310\340\307\017\034>\204\364\360 \003\036W;\200\350 \356\360\340\250A\217\253\007t\034}\b\327\212J\307\321\207\021\b\007\033\034=\320\300\370\301\021\007\017\243\325\325\017#\225\321\366\360\261\343\312\b\244G\217+\343\360\\\033\312\332\320\352\"Q\235\334\035%O\002\264\031\305i\3524h\364\201P4Z\200\276\330\222nF\327\350\356:\246&4W\272\304\251\256\213\364\026V\036V\034\254\"\260\2128o\326\210\321\001\314h\031\035@\277+\326\036\226\021X~2z\207\354/F\037\357Lq\177h\375\324I\247c\355\235U\235\203\315\216\373\330\017k\217\017\313\017\313\357\274Y\325\301:I\310\270\326\232\325T\3050\372c\230\316\021\3459\274\227.\301\252s<\2367\215\370E\003"
+	.string	"\243E\003@\304\213\3561#\370\362\342\244\312\346\216\2448\203\203\265D\376\351"
+	.ascii	"\247\346\t\034&\027B\264h\027}\032\201\242E\026\333\265hSK\336"
+	.ascii	"r\311\351\314\215\327\221:qlt3\024\223X\264i\2074u**%\252f\321"
+	.ascii	"\227sD\336T\257h#\233 \b\250a\306k\322&0\352\324\0241\252\350"
+	.ascii	"\025t*\372p1\244\235\231\352\277y\323\230\033\264\254\244\030"
+	.ascii	"g?x\0359\302M\033\335\030\222\t\2516\355JL\035\n\352\004TK\365"
+	.ascii	"\345\370-\237:*\316\207t\t\214\272\224\n\303\245M\250\352\312"
+	.ascii	"\024I\237D\245h\247\247\246vjv#c\325\324\217{\223\246L\321o\363"
+	.ascii	"\24616hY&b\234\355\340u\304o\357\313\223\372J\204Yf\322&F\207"
+	.ascii	"e\262/]r`\223c\342\342\033\230:\250\005\r"
+	.ascii	"Z\332QR\232W\b~qK\243N"
+	.string	".\n\"\330\346\226\032E\007\335H\370}\251s\260\275\331\342\276\023\230\213\025\272\324\246\2269\276\277\"%\264\021\372\362\210\232\262\364)\003\201\257\250a<%\021S\206FD$IA\222\341\341\005\204 \245\330\225\007\022\2403A\215\203\220\031\232!IqA\352\224\206\003\344\217\266\365Qh\024\311\001\203J\257\341\322\t\225` \373\342\204\336\263Y\006\376\022\033}\274\226s\273P\220t\367_\2655\220Y\332\312\274\277@iXa\301\240\212&\243Ui\013^\302\362`\377\322\305Fr:\372h\255R\255\036\342qO\326\306S\203y\300\033%\317\330N\264y*\3147\355a\255w;S4w\204\016\372\026&\352 \004KxT\202\223\343\241\013\255Q8\254\335\177Y*\244\276\276\333B\341\030}\232\013\323\006_o\370 eI\255\335\275\260\030\203o\261n\007j7\tMK\207,\250d\235\020\027\274\t\257\032\356>\250"
+	.string	"\031\240y\214@\317\006\276('\235\225\013\002\344\315]u\035\264!3\f\304\377\265\004s\240v\036q\2426!\2245\355\f\372a\017\360\337\215#\261\t4\371\323\255k\217\237\204\227\002\211\221\022\304\367i\200>w\2733\357 @\202\300\264id\1772\b\f\223\253\302$4\255\364D\262L\231{\304\263\006\302-\301\317\214\020\016\f\030\320;\346\277b\300y;_\326\340\314\024C.\252\267\361\345\277W\335\037c\240\357|\f\215\013@\237\266\220\242\026\372\316\302V\026r0r)\302\270\026\333\"\267n\313\350\230R\351\3705\025\256\370u'\2300Q\373\261\314\351X\177"
+	.ascii	"\033\222\336\016\274\020B\372s\330\303pO]XPg\325\374\227h\025"
+	.ascii	"\200\240ZZ\323\372\200\022B\031\254\206v'O\244MAa\306\336\246"
+	.ascii	"\221"
+	.string	"H\303D\360#2\323\\H\347\262\273\307\255*\265L\341\345\\\262\203lQ$v`@>\317\023\302?\312\036\013\241#\330\360\205\023\257A8f\031H\352\341\236=\272\314\022\003\266\263MFP?\232U:L\b\303\207P\351=\276\357\263\321\221\374\303^&p\232A\220\270\203\231j\310O\252a\212\220X!\020n0\037\240\345\306\237\2735\212\214\3136E\252\371\306\037\246\031\374S\201\352 \242\341\2544R\350_\306\306s\376\222@\266\254k\265lY\327j\365\350,U\262\261WN[\222\331F\032(\210Np;}\202\232&\025%\255o\224\221\240\347\324\277\330\324\363\360D\312a,\206\370Y\320\301:h\202RP\262\024\231\002\013\373\263\031\327\340\316\350U8\024\340q\354\t\311@g\"\2036\367\235\026\260\266\375\302\261J\330\366\355\330\353\275\255\027\237\027\006\035\025\331+\3004\300s\235\271\320)\241S\236Y\231"
+	.string	"\210*t\323z\b-\360\017u\025\250\272\364\330\245\266D\226\252b\222\361,\376n\2565\315\3325\334hU6\310c\030\372@i\013\322\206\003\375ZU\030\tNb\307\223\230\037\006-n3\240\030j\203\316rB\263\310\334\230\342x\357>PK\006~\316\233"
+	.ascii	"g\331\233\373j\212\304\253PVR\250"
+	.text
+	.section	.gnu.lto_pidInitSetpointDerivativeLpf.part.0.310.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\243\004\205\035"
+	.string	"\006\365\265F\240\330M:\300\023\337q\201F6?\261\b\034&V\361\344\307\214'\275s0$\224\227\017\242\266\277e\211o\332\341K\272\312\331\235\361\211o\322\313+\301\207\215/]\3002\207U`\200\211]Xo\333\b\331\233\354\235R\233"
+	.string	"\234"
+	.string	"\235"
+	.ascii	"\247\362\277\244g\321\220\277\345\361<\245}\254'\321=\213\206"
+	.ascii	"\351.\224\026)\273?\007\247^ \236\346\234@=\225\037PO\355[\331"
+	.ascii	"N\342Yg\227\375\027du\252\256ll\261"
+	.string	"\331\335\333\351\004\342y\360w\207Rw1\254\024\234\222\246\363\303\236\256\203Q9\312\214\275\335E0\307\013\317\007B\2208zK2\224c\025\217\327\231\343\t\365\211rZ3\366v\034\254Q\3531U\002B\300\206X\216\275\2469\377\365\rQNV\306\036\217K\001\247\205=\273\353+\365\270k\267\215\304\266\007\033\344\005T\204|*\347X\310\217\247>\213zj\373\301%\365t\225FI\236\3119\345I\233Rgggn<\245l\033M\272V\245i\242\264\030J\207\367\272k\225\246U\032\374\357\237UZR\351\017\220>\nW\273:\316\336,\024\245R\344^\377\222\237\311\247}\337\311\233\370_\266y%\231\367\344Pt\217b\260\035\246\337\366jZNR\256\330\354n\007\361t\007Tr_I\222\277\365.\333\230pq\021\271 ~\211#LH\272\026\222\324\331\235\032\006\247\021&\350\256\205\364\234]\022\033%\210\247\266\376"
+	.string	"B~\264O\006\243\300\330h\273\350bBX\030\333\335\na>6\302\247:5\211\022%\352i8?\356\020 \345\004\247}\002\205\374H\347N\215\271\363\234\340|\223\231/\366/\376\372\261\227\275\246\t\037\2306\317r _\330N\302\361\374wW\t\f\363\273H.P\207\332\252/#\013\265<Z\374-.\023ww\177\372\021\324,\233\240g'U\005\305lwy\260\370O\366\257\210\277\345\331a\222q\354\203\275\n\022\020\016WO?\377u\005S\270\250\236\260|swwsN]\250\372S\036F9\031? \216h\206\210\232QN\006\006\241\030)p*hAACG12\024\341\216Z\344\202"
+	.ascii	"\030\350\201\212\034\321\355h\205P\256E\320\355E\356\307\305"
+	.ascii	"\r\250\310\350\366@\307CD\270\242\333\321\320P\321M\376;\245"
+	.ascii	"\272\376\033bVaJsI\234S\016@Vm\223\n\221\f^'\016\007\257S&\321"
+	.ascii	"\"c\222n<\017\356\356\206\r^\247m\036\320r\262\322\364\264t\345"
+	.ascii	"\227plT\005R\234\264Y\233\266\316J\207\325\204\306\305\031]\326"
+	.ascii	"\267\202\230\335\f\206\f\0324\324\323\332\23442/\343\320\301"
+	.ascii	"G~\364\251\247\3424\341\033s\204\313e\227\230\017j@\322\031N"
+	.ascii	"\007d\250a,\306\020SDh\204\204d\244I\206\003`\002\2312\263\035"
+	.ascii	"\021\200\301c\027&j\317\254\256\\\3139\351\305W2)i\257,1,\350"
+	.ascii	"Q\310\250\225#\213H\034*_\320\200\226\315\035)`.\221e\274\225"
+	.ascii	"J\033\376z\336\270\026\214ipd5\206{\202\307\205\244\210\334L"
+	.ascii	"\223\365Xb\203\346wM\017\223G\213AX\266\272\317\002\222\264\203"
+	.ascii	"H\017\300(M\247\264U\214\307\332\206h|\377i\330\024A\034A\350"
+	.ascii	"5\366J\262\0269\322\276\007\034\210\365\030!4@\253\334\336R\021"
+	.ascii	"\320\323\262\337\355\202\f\347m\001w\234\311]A\305\264\200\263"
+	.ascii	"\315`\300\224\341sv\331\037\247\341\263f\231\337\n\310k\214\023"
+	.ascii	"!&\372\300\240\212\271\342\3162Q\027!\002u\266\300\311x\030\023"
+	.ascii	"\250"
+	.text
+	.section	.gnu.lto_pidUpdateSetpointDerivativeLpf.part.0.311.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\320\003\225\031"
+	.string	"f/\237G\300\030Q:\3005\240\020\001\035\341\372\201\272$'\345\344\300\021\370\3321P\200\204\212p\002C\246\334\274\240\037\355\355\005\214\254\302\260\3572\266|\254 J\030\004k\266\317A\316m1\003\355\300\013R\355'\204l\"wJ\001\210"
+	.string	"\201"
+	.string	"\212"
+	.string	"\274\275\335\254\322\376\220\023\231\275\310\013\317]\335\225&\273\274\007\237f ~\022\370\001\360S\336"
+	.ascii	"\370i?\210m\331\3153\273\313yB\213`\227"
+	.string	"\324sd\314\356\256>5\207\365\037\357\006\345\354!8?\225\342\314\377\320?\034>^F\034\355\341G`w\005\340z\276\br\006\256&A9\356n|\252\217\222\357F\277\301AC\314\210\263q\265\355\200\007t \355@\341`\250\254\271\030V\330]\277\226\273O\267\035d{\202\255Z\002\347\341\0249\362\343\247\237\2437\372\007$\007\206L\256&{\326\353\356\322\244\006YE\005\352\365ze\254@vJ\224FM\351S(-\202\322\341\213npJ\317)\375\235\367\353\224\226\237\364\013\310\034\005!\273>\2753\253\233Oz\274\350\267\357\027\235\3107r*\211\314*\033oq\267!?\311\215\374\310\354H\214\364\255\261\227!\264k\372\262\273\r>-A\374T}\367\207dv*\365)\317\223\275\310\013\031KI_\215\234\032\252\355\341\203\374h_I\247\206i\264\r{\022\210\033a\332\335\tV~E\204\317\343\323#H\220"
+	.ascii	"?C\375xc\200\224\372\251\315\302\221\037\247\252`(\315\252\237"
+	.ascii	"\236\347\213O\345U\314\344\204\217|\244!ra\356\344\254)J4\211"
+	.ascii	"\306\372\357nM5\310\216\342K\221H\272\353v\347\305\307\352\326"
+	.ascii	"\346\211\017\305]\304]\332\177~\005\240\223]P\201\006\264\343"
+	.ascii	"b\303\304\377\261\177$\362\326Fe\223i\354+\371\022\227\003:."
+	.ascii	"\027%\276V\353\025kq\001\206\023S\341j\0010\013\202\t\027\213"
+	.ascii	"U\f\305\t\227\212\326j\205\253D\316\212\005\323YA@\340\027\013"
+	.ascii	"\034\330*\366z\301V)\333\362_\005\032\372c,\231Q\252\351N\250"
+	.ascii	"A\236:\304\006\017\3204S\n\352\214\007\007U\022!j\262\3112\326"
+	.ascii	"\177\273\273\240\203\203\232\322\004D4\244\360\374\354\034\375"
+	.ascii	"\022M\317TIQO\212R\333\302\005\236-/&\fG\"\224\345Z2h\270\271"
+	.ascii	"\001?Q\252\247\245c\331\300\241\203\374\330\001\374\0245D\356"
+	.ascii	"\314\017\244\313\242Q\250a8\305\024bFfdDd\302\266\225\003\200"
+	.ascii	"\002\221\2622\017\020X\211hA\232\003$\204ie\227Dv\005G\270\373"
+	.ascii	"3\266\005um$\263\001D\207{\201\377\360R\310\374w\313\252+\202"
+	.ascii	"\255 X\325\177]\311\250Z\250.F{ \301\334\302\t\001\334\307\256"
+	.ascii	"\217^\2078\351\303\301\352\035B\204%\355\306k}\021\330\371>L"
+	.ascii	"N+4 \343\367\312mtSv\225\314\315\206MY\030o\026\215\033x\311"
+	.ascii	"\235\005{\354\266\226\004\031\266H\226\320\354L\374\021W\233"
+	.ascii	"\263\365\336Qrg\226\2201-\255\334 T\001P\202F\201|\352\001\223"
+	.ascii	"\270s/\025vk&\360\037"
+	.text
+	.section	.gnu.lto_getFlappingAmplitude.part.0.314.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`R\b\365-"
+	.string	"ZR\320\021Gp\230N:\377\236\336\344\2032\345\016y\201D\245HYw\324.\372\377\262\273#\205\255\035\367\205\320\333\346\032\342\247\254\021\346\331\316;`\265\032\377\201\362\004\250\341>\254l\266\034_\"\372\005\374\377f\326\022B\210\3342\005\007\001\365"
+	.ascii	"\r\001\351\334\325\213\224K\356\344\013v\355^\232\247\336\337"
+	.ascii	"\275W\201\333O4\201\202\343N\244\345\336K\354\263\333\325\031"
+	.ascii	"\311\211G\256\030\316\312\032\233\027\314\353"
+	.string	"\215\215`1\234\225\316\255r\371K\313\223\307\337\275M$N\237\240\031\344\036\025\353'\336Znr\221\233\346uk\271\310\235\027\336\033E\256\356\336\213\200\323\023\br\372s\333\225\327\377\263\020\036\202\365;\321\346Y\232\3203m\013\016\360\336{\344\264\210\213*\247(\367\250\234\266\016\306b\033\342P\030\\\325\024m{\203u\316b\233UIX\343\351G42\003\033\343\341\252d\0066\203\205\250\201\262\2740\256\342%\003-R\271\301\205\2373l\260\212\327\330\272e\264\346%f\325U\t\217\205jO:0f`48\265\\_0\030E\r\374\331\221\301\371Z\201\026\273zp1\236\3226\316\327\022-\272\367\262\035[\027_Z\326\362\360\315\252t\357='\311\3708\374?\313\377\344\277\352\005?\324\b\313\\\334l\307;}9\312\354);\3136\363}\203\336{\357\033\307\177d\355\007\030Y\373\"kOd\355\207\254\275"
+	.ascii	"\236\343\013Y\373 k\017\264\332\007\340:\276\321\332\003\260"
+	.ascii	"\366?B\373\242\265\367\261\366=\253=\217\265\337\321\261\366"
+	.ascii	"9\326\036\307\332\337\254\3666\326\236h\355\207\326^\030\264"
+	.ascii	"\017\362\035\177\265\366\252\265OW{\324\33277\231\255j\317H\026"
+	.ascii	"\215\001\215{\273\002\323\334\032)\023\037|\204\271\216y\216"
+	.ascii	"\371\216\031\nK\271\272\025z\305\232g`M$\024\267j\026+\2226\030"
+	.ascii	"\254\350\333*\003\274\267y\314+R6\317\322\230o\306\336\020\300"
+	.ascii	"\253\274H\377M\020\231z\313 \200\234\256?\237\2350\223s\024\306"
+	.ascii	";\361\316\351lS\203\362\344I\234\032\004%\277\034?\177\342M0"
+	.ascii	"\223o@\373\302J8\356L\307v'\3269\235w\2427\216\325\236wj\r\202"
+	.ascii	"\034\235\352\361tO\247]&0`\031\236^\200\226\374\331\301\300G"
+	.ascii	"\346T\233\371\03796\"\250N\027\345\200H\351\265\215\332\305\177"
+	.ascii	" L"
+	.string	"L^\334m\263\024\3106WP\177\013\027,s\335&\321!\343M\332\202\234\241\315\274N\257\235&\351v\274I\311ib\353\364\220\217\006\222%\236\326\215-n\31518\235\323BN\226eZI\266\310\2507\215\323F8\233\276i\243\223\f\374\267\364\305\246\325\037hW\314\020\031\266\260\211\315\3135-\346\302]\356<\247]\303\351N\247r:l\007}b\301\0266\n\307\201\375:\364\005\233\327\320\256h\265\030\333{\020\030\350E\355\265\207|c_\322\356V\333\252Y\256\241\235v\317-\377\356\201\261,\005\357U*8_a\276\017\3474N\317\324d\231\253\2519\fm\n\033\221\244\r\374\235|\346>\312{\223G\266\273\031\2173\360\215}Y\252i\331\3007\333{oV7\363?\225\312=\365\346\247\264g~c\013\260\b5\177J\242\212:1\345D\025\364\247$\252\247*&\344\261D\024\022\031\325\004T\005\205\204\242"
+	.string	"\302\311I\212j(\205dj)$\204\024LH\265\211\312:\221\250\252\212\232z\252\372\3204E|S\022\b(\251c\325\223\b(\022!\216%\240\230\220\307\246)\252c\222\361QRNS\307\252\250\250\251\243e\3646\2160\256\266\036\304\243f<\346\030\\l^R\243.zQ_)\331ZoFm\232\371\242\234\2205\303\001\235#'\244l5\366\221\216&]/\210\315\374R\016!\221\260\206\336\315\322\025\034\352\001\355\342l\307\374B\256\355\232\371Sv\326\260\231D}\273\034\243\3655yaC\204CO\266b1\322\310\260be\250\207|d\201\315{o\260\231\027\320\306f\277\267<\241\026\320\250\3362L\222W\2416v\273\321\241\tj\240\026jVc\263\202zA\237X\200\006\352\206\013\\Z\023\240\031\f\315\213\031"
+	.string	"m\354\225\217\314\371\323>\r\240m\261\177\332F`4\022\316\024[\005Z\027\266\236\336i\237\200\236\250QH\244\234Q\304fDD\322\024$\303\001\200\002\0212+n\021p\251\204\256\246\240\365g\f\334\032\200\337\357\225`\330\350R\252\177r\006\362\2446\356\006\203b\013\355\311\223\020\244\237H\317\203\254\200 g\347\314\267\207\364h3S\006?5\223\3741\252\234\213\356\374dg\312\231\345\t1\021z(\"\r\207\013\365#\n\351x\006\260h\366\353c\374\324J\271\335q\236l\001U7r\267\330\304Z\312\356$\202ql\231\332,j\027\265\314\265\370\033\203\324\351OF\341\333\304\007\001:\231z7\021\222\013n\312E\211\017\2703\254\2374\310\255\336#\307-9\307'\031\221\275!\337\b\021\024\256\377\002\340oujF[\242=\274Su\241\305\001\306U\341i\00721KC\261A~R"
+	.ascii	"6\263\017\333tL\343\236;f\027l@\331\rr\334zy\352\016\256-K\360"
+	.ascii	"H\374\002(#&\232\363p39\334 X\007\n\334b\310\3674\352\r\322\345"
+	.ascii	"\377\307\245\005\350ZB\222\310\r\242\032^\035\fz/k\344\023\021"
+	.ascii	"\353\212\361/\356\266Z\234\366\361\367\265G.\341\rf\210\031\263"
+	.ascii	"\347z\276f\235\237E\007\366\354\346\300=S0\025"
+	.text
+	.section	.gnu.lto_pidCopyProfile.part.0.316.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375` \002\375\020"
+	.string	"\366\036nH\320\262*\035O\036B\003\221\321\017\020\325\275\351\225N c\0201\016\273\244Sa| I\343\2502G\341\215!;\241\0029\216k\236\312D\027\016\003|\361*\345\245s\026\017\346i\r\027\376\300\323\234\370\273y\262\211\334)\005S"
+	.string	"\\"
+	.string	"Y"
+	.string	"5.\231`\267\245|\\\027\232U\332%S\354\266\024\353n\007\233\316\356\230\340\323\007@\237\366O\330\206\321\034\263u|\024\227$cG\013n\267\273\340\247\206x\354*\275\230\377\333C\263\027\225k\200\227\f\227\243{"
+	.ascii	"\032\354\256A\032\356y\333&\333)[\242\004*-o\363?$k\fhv]~\370"
+	.ascii	"\330\017sg\204$\215\"\fM\005\314.o9\214\"\314q,v4\273\2650\""
+	.ascii	"\260\355\337\034\347e\227^X\221\201(\341h\260\230\330\355\216"
+	.ascii	"\340\247\307\027\370>A\037\360\371:\002\342q\317\275\216\302"
+	.ascii	"\347\251\371\274\244\177\203\331\"\221\3158\366,P\371:\273\365"
+	.ascii	"\027.>\275\316\323\251\277\335\323\251\371\334p\244\370\311}"
+	.ascii	"\307\345\255\020g(oQ\342\335\020wWA\316uT~\355\323\023X\362\263"
+	.ascii	"O\237\365}\252>\367\007%D\344\230\211q\263\341*\325\300JN\215"
+	.ascii	"\226\037\231\374!U\306\352\335[\215\261\247\364\247\322\3635"
+	.ascii	"\2777\2455\0369\255X#\n)\224\211\203\024I(\242Z\205\240\302\220"
+	.ascii	"\026\0135\362\t\004\025\236\200\255\221\b!\211\bh\022B(\001O"
+	.ascii	"+\026\bB\262\352$\265\002[*\325\n\024\331\226\367Vc\034\232\351"
+	.ascii	"aC\246\025Tel\013\220\346q\317\370T?\265C\t\3623\377\366c\300"
+	.ascii	"\361@\242\207\207EU|\335a\004- \200\202\031U\354\0025\f\3666"
+	.ascii	"\242\266Fld7\242\337\340\311\002\203Lx\177u\301\333\3614\006"
+	.ascii	"\221M\332F\206\366GT\207\331\302u\263@\353\017\300b\205!\324"
+	.ascii	"}\220\313\220e\030i\233\314C\215_X\254v\307\205\023<N5\2431Z"
+	.ascii	")\235\203\231\204J\254\346\341\355\274\025\013`{\321r\372\247"
+	.ascii	"_k\306"
+	.text
+	.section	.gnu.lto_applyRcSmoothingDerivativeFilter.part.0.322.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\207\0045\035"
+	.string	"\326t\266G\240\330M:\300\343\033\257\324\022P\366\241\347-\361h>\377\357\326\302\325|\332e\237tr\3416u\255\264\330\271\267\276\332\023\371\256'\315\316\363\250\347Y\374"
+	.string	"\371G\032\006\354h\200\231N\001\032\351\233\231\265\204l)S\n\243"
+	.string	"\224"
+	.string	"\244"
+	.ascii	"\372*'sj\235x\353\212\031\007\252\247:\222T\023\270d\3257q\227"
+	.ascii	"ks\366\330\3025\347|p\321\013h\027\35539Z\262\355+\371\022\236"
+	.ascii	"\275%\251\242\246\f\220!Qzbf\316\231\273\270\363\234\361\242"
+	.ascii	"\274\200\361\342\0069\3575\332l\024\345\252\215\347kP\342\341"
+	.ascii	"\365\003\"\275\246? \216\323\216\365\004F\226\230t\246\343\243"
+	.ascii	"d\340\264\305\006\016\030C\346\200\371\020\273\001\225T\2345"
+	.ascii	"\205\221\307:\207 MV~\300\033__\322\230#\325%\304\006\204\261"
+	.ascii	"\032\340\266Y\317\234\323\357\355\270o\267=e\273\307\2264\002"
+	.ascii	"Hw\372\017\214\\3A\317,C\206\305\243e{\354w\262\237e\373\310"
+	.ascii	"c\264\250\2714\251&\317\216O\327\330\207\362(:\177\312*\204\364"
+	.ascii	"\277\213\276\320x\361\033!\350U\306\324\323\241.\224\327\266"
+	.string	"\303\341\260\314\373\303\306\241\251q3\365\315\252mnRmSuM\252i\263Q=\376\352\026_\365KQ\275\247\372U\252?@\203\022\232\346\2441L3\237\304)D~u\373WG>\226oVG\336\361\361|+\337\236x\353\263\306\324/1\262$c\346\234\r.\272\2027ZA\247\025\367F\353\310\020\225{[\031\265\325-\252\002\343\3233\246mm\257\264\246\247\303.\035\204h\033\"(,c\312\372\345\234s\212\005T\356\270\266\207\017\372\337\f\314\350\013\304\255\302\270\334K\304\b\022$\306\213\243\220\312\017F\230C\006P\271\273v\t\023\372\237\270;0\026\311\276\226\026\004\302~\266_<\213\217\205\2509\347\204+\307\362\343O]4PP\320xq\367&l\332\372\341\350\351\320\347\372\205K_H\252\306\373KuIU\331\205\262\273\374*J\345\351i\222E)2\237&\217\024\177\212\307hs\006;\240\242\365\331\255"
+	.ascii	"\302\260c\241\033\"\332\001\2018\241#\002`\244s\341#\375\003"
+	.ascii	"\341\204\216(\267K\021\244[\201\"\307B\347#\224\373)2\312A\320"
+	.ascii	"\361\020\021PQn74T\224\273\331\326\313)\307\333\342\254\f\333"
+	.ascii	"8{0\341\221\257\336&\325p\033\346c<%\025\302|\261\213\3411\341"
+	.ascii	"5\271\240\377]\030/\352\335\365#s\263\270\325\311RZ\203@m\326"
+	.ascii	"\316\240a\374\357fw|[\3072\3167gO\301mmV\307K\f#I\024r\240\231"
+	.ascii	"A[(\363\\7\332\366@\276l\260\255\213\240Xp\310\317\351k\266P"
+	.ascii	"\366\270P\306\005\255\344l\t\004b\250q8\246\fb\206hDDd\002\303"
+	.ascii	"\244\003\220\002\0212#7\020Xi\250\024\322\001\335\004\234\224"
+	.ascii	"\241\tuxb\200U\320\022\244\266q\2509\2456\376\307\333etd\300"
+	.ascii	"\005#D\331\032\377\025w;\2164\252q\306zG /\212\017\263\212L\017"
+	.ascii	"4\354+\"\357\024\240\203\035\370ioW\267\367a\036\272Z:l\215\314"
+	.ascii	"\331\277\017\376\031a\2300\366\355\235X63\244\277\r\332\323\220"
+	.ascii	"Q\310\360Y\241\353.\030pA\351\240?!\020\373JmRo\232o%V\025(C"
+	.ascii	"\021L\177\375\302D3_|z\255\273\007\306\307T#\020\301\330\260"
+	.ascii	"9\355\225\025\022g.E/\262\371\002iY\364\201@\037\244\b\215\244"
+	.ascii	"\256\353\233\304\024b\371Q\001"
+	.text
+	.section	.gnu.lto_pidSetAcroTrainerState.part.0.332.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"\225\013"
+	.string	"\206\225N@ M&\035,\275ZVT.H\b\016\320\005\013|&\220\243\304a\005\302\376\f,\006-qk\371\333<\306\217\241\206\364/\003\207\003H\020\002W\243\021&\027\327\202\333\353mG\025\212d\023\271S\n;"
+	.string	";"
+	.string	"="
+	.string	"\225~.\206\203\237\333J\016\364?\276\"\024A\237\020\321\364M\206\242\204\357\006`\366\241\204\2058\3320H\252\360\343%\004Q$\345\3059\307\200Z\253\037\023n\307m\027\260M\355\013\b 4\330\276\375\361cG\"^\371\226)\225\317Y\337\307J*y\245M\251\200g}\222\223\350\260\nQ\353\030\340\323\033\217O\373\033l\177J\006\355\021\037S5\303\224\342\301\313D\255\001\237\016`\257\023\025B\262\266q\322n\340\221\017}\231*BL\264 \357\237\242\315<\354\242l\177\334w]\".p\220\215$M.\312\313muO\366[\3779\t\323X\325J\252\241\250\026f\030\317\342\021\360`4\017_&\0062\033\352%@\220Qp\200j2\226\005\364\322a@'\022w\033L\207z]\327\241\021\333\362{2DE!\026Z\321\\\324\372\256\277>?\203;\216|\370\351s\270\025"
+	.ascii	":CP\034\214T\032\250\"\274\020\350b\350=K\260\037\020\005\303"
+	.ascii	"\\\327\2703#Vh\321\252]\304\271\336\246\337\316\025\204\223\027"
+	.ascii	"\363NK\3234\205\356\265e\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`L\025\205D"
+	.ascii	"\no\224\027A@\336J:\253\331\023\342W[\361\226\230\207\351f\267"
+	.ascii	"\215\346A\331\214\301\253\351\377\222\020\355\013_\215@\306o"
+	.ascii	"Ax\205EQ\024\2053\316\350>h]\304\t\222\205\"\324!d\032\202\200"
+	.ascii	"\306J\342\336I\006c\001d\001o\001Y\217\037\223\357SL?\252a\362"
+	.ascii	"e#\313W\355\216\345\213v\301\374\352\313\227^~E\025;VO\247S\310"
+	.ascii	"w\311\367,\354U\033.\305\345Q[\016\005\366'\265y\247\257|F\346"
+	.ascii	"\253h\311\257\343\365\246\253\304Sv?\350\312W<\327\251\250\323"
+	.ascii	"\351T\362Y\3625\203\240\\\327e\233/\231\273\325v\260\364\242"
+	.ascii	"V\323\271\322\211jV\317\301z\230\253\374\267/\033\320\352zU\345"
+	.ascii	"?\257\225[\241\272\225:u*\251O=*?\n\365\260\247wQ\235\276\245"
+	.ascii	"\312\3014\345\377Q\271\227\312\364\256\245|6l\023\252\031:\252"
+	.ascii	"tG\365\353\325zR\376\335\275\362\\\324\374)\377\242J\271\227"
+	.ascii	"(\027\203\322~O.\323I\276\233\333\344_L\316\\r-\252\222\203%"
+	.ascii	"\311\367\273HwEr\225G\236f\344hE\276\246b'\221\237\r\271\232"
+	.ascii	"\220\333\006\271L*\236N\247\323\243\3747@\336\246\376hE\325G"
+	.ascii	"\327\351\221/\307\243\343\354\310\207\273:Z\216\232#\037zq\344"
+	.ascii	"\237\2717\232O\025\361\251j\343dW\251T&\325\310\027\274\247\221"
+	.ascii	"\0378\343YT\031\027K\214|8\027;a\\\314\213\374\270\353\242\333"
+	.ascii	"\250\330\331\242\331\234=\303\242\367V\344+o\250\270\244\332"
+	.ascii	"\335?\312u\245*\323\235\273\357\250\356\243T*\225)r\206\333\335"
+	.ascii	"C(\002\317\263\314\307c\225\337X\225\177\307J~\"U>\235\251|;"
+	.ascii	"R\371\213Q\371vA\345\253\345)_.\247|\263T\311w\253)\337,*\371"
+	.ascii	"^a\312\367j)_'6_+J\371.\327|\223\222\362!\2572?r\232\277\347"
+	.ascii	"T\223\371\217\227l\275\310n\334\323y\324n\034Ip\354H\302\003"
+	.ascii	"\t\262\035\037\033R\355v\202$\t\022\020\037<\220\330\360a\004"
+	.ascii	"C\237\205\273cG\352\371\222\232'?\016\236|\304\306\374\303\353"
+	.ascii	"s'\337\2201\277\320N\276\364.6\243\342\265\252s&\020\027\353"
+	.ascii	"\303\365p\213\356\223\232\370$:\267i\316\245\"'\2370N\376 b>"
+	.ascii	"\340=\314\3573"
+	.string	"|\231\302|\353\256\2174\237\217\260\357\250\321\374\275;\3701\3017\003\337\3029\227\3727\371z\200\375\247\272\311_\363\227\237\327&\037\217M\276\032\277\327\251}\247\343{\032\265\r\313\264\360\276\227o\247\227\217\346\256\2713\357nxgS\323\210w}h\327\206u]H\327n\322\264\024\315\365\314\365\033\271\233\211\353A\270\026\204v\240\372\326pn\206\326\345\366g\376\334\231\223q\276\314\355c\324\266|33\371[q\316\226\217\345b\245\3056\246\257\345k\251u\237Z&\237M\313WB\313_\357Y\356\351\305\273Y\356I\016\237\263R\251\221\311-y\313\036\215\210\277va\037b\242B\374f\3535\241\030\237X\337\357\232\020\0075\037\"k\217\324\323\232\020\277i\327\203t-\330C\354_\327\202\370\320@\374\303\242\351@\f\324L\323\201\370\322\270\376\303?M\271\376\303@\320\365s\375\207\203\240\177\340\2674uh\333\341"
+	.string	"\315w\340\322\324\227\303\261BPe\002\2512\207\016\326\007\364\355\234c\2134\177\201\013p\211D\032\327v\030\251y|\271\266\303\007\244\004\232\347\260%\262\211\275\005\260\273\244\2775\277\376\220Z\246s\375l8L\324p\030H\372\033\346\306h\347\317~\342?\013\364\0233`\207\244B\320C\020\273\323\346i#\0364M\037\177f\004\336q\334z#0\003\366\375\3665\347\355N#\347\232\021\016bOb\316\215\361N#< \372\207A.\342I(\302g\335\212p\003vH\372\2179q\t>\255\017\361\332\274\016\260\255\247\001\0035\337f4\264i\300B\354}\362\274\266\004`\177\341\254fW\253\200\177\2407\302rL\372Z\005\374\346\357\236\231\264\260\263U\300'\210$\340#\266\207T\007\373\001\205\223\204O[\200\217\330\177\020T,\373\031\002\374\303\2360CC df"
+	.string	"\023\025\300A\353\037@"
+	.string	"\356\312\227\345\312w)K\276U\332|\245\266\362\235\302\222/\225V\276UW\362U\312\312\227\203\225?y\225\003\375\3657\017\317`\327\263\036\206?i\366\356k\252U\275\365ap\225\300l\210\257\365\271\214\353\177\"\243\362\364\242\034)\333\032\373~#\331\224\3672e\353'\204y\354\252\020\375u\346\341!\374\226\030{5o\361\345\002\375\235jw\244\214\322:s\240\206PB\250[\363\r\332\254\340\332\232o=\260&\303\265(\023\332\031\031t\f\352\205\025c\277\240'\020\207\321\021z&\263\341\336\342\374|\206=Nt\204\336b(\321\227\030s\342\032\361\026?1z\213\227\030x\213\221\326+\220S\364[\360\026\023\211\026\275\305A\230\357I\300%\033"
+	.string	"\265\267\370\b\017\232\367\026\367h\256y\213u0\377\306\267\370\001\373\026;xB=5\274\305\r\230\002\336\342\001\315\027A9\355}\355-\016\222\352\275\305'\366\336b\242\237\357-\006Z'\233\360[\370\322\250\247}\013\377\254oI\252\251\264\007\257\205M\034\353Y\370\321\251/;\361K|\346\375\022\f+M\251\005\017u(|\226\310\354L\370dQ\262\261\365_\321\274\022a\276\303\222\016\332\335\210\203\034=\177\256\246'6\b\272\021\347(\320\215\330\001\363\024\236\253\343O7b\006\320\267\032vI\221\210\256\033\003[\021\377\331\177]\007\377D#\333\256\023\361\016\271N\304'\342:\021\347\370\255kD\034\2410\201~\250Q\030\245ygFDD\222$I\007\261\005\2049\346\252\250\r\021p H-\232\021\021\tD\202h\323\001\3501m@m\23633U\bL\324\347=\b\203`F\201\316Z"
+	.string	"Y\362fg\027\331\234\f\206q\232\343\001`!\003\357v\276\226\350\274N\204\2201\247-X"
+	.string	"\300\302\033Z\243\261\321g\232D\362\323e\201\340\204\035\247\266\313\210\247\037\213\351-\333\353\200_\006\260\227\367\211\307\316\201\3567\0244\217Mg\227\331\231\310N\332t\274\220\033\262\266o\251\031\253u\316Wo+\323\327g\223%p\372(k4\301e\234\027\245.\240\177\365\233N\r+\037[U!\215\177\374\017#O]\327\2640\231\367\204\2725\016\3219\367yM8u\277\302\031\210O\240\303]NJ\225_|\361\003\220\007Q=\025\370.\310\206%-R\rw\320\204\237\340\001>\b.,?"
+	.string	"_\240\031\002\302l \250[\036\227\025-\211"
+	.string	"\021\360\332\333\022y\022\250\323\256?\321\255\340\271\332\230"
+	.ascii	"\256K\371Ju\347r$\022\227v\273\332n\247k\304h\022\312_;\342]"
+	.ascii	"=`\274\340R\3449c\332\325\311\1772C@\327\334\n\2116\205DCM\242"
+	.ascii	"\241\220\323PH\264)$\032j\022\r\205\234\206B\242M\241lO0\216"
+	.ascii	"\335\236\226\t\211h\313=7\370Z\004\177\365\226\307\276>\221\336"
+	.ascii	"\267\274@\034_\202\226#'\261\210$\f%u\233\224\b\242\276 \276"
+	.ascii	"q\265+[\bu\217E6\005D\320Nd\2277\035\b\241\261\267\271/\222\350"
+	.ascii	"\315Z\341e\200\264\271\267\2139v_\257\207\225\032hF\336\2700"
+	.ascii	"\264\323\252`\341\200,\362\303'\351\003\306\"c\fi\347\t\0161"
+	.ascii	"El\275\022\305\325s`\007?\034v\314\005^\373\2517"
+	.ascii	"\207\241\036\002\032\005\203\004cx\210\236\216\236\202\257\326"
+	.ascii	"\365\2203\024\037\n\213\"\212\2502#\2103=\377\330\277\323`\311"
+	.ascii	"{\t\324\360`K\274\260`\240JB\376e=;\352\021\006W\357Y\036\035"
+	.ascii	"Y\360\341\376\032\2679\0168\237~\260\300\354)\355\007\006\r\033"
+	.ascii	")\370$}3%-\232\356\220$B!\b,U\216\215\327Y\013a\201,\254\226"
+	.ascii	"\345\233:Y\341$gh\334\002\242\266eX\177\262\035\217\3601\361"
+	.ascii	"\372\320\211\211\220\317\330.d\353%\246N\336\366\253\367\033"
+	.ascii	"\316\353\303\024\024\357\271\323 \216\r1{y#a\351G\263\253o\362"
+	.ascii	"\220&\254\350\361\212e6@\3149E\261)\226\307(\022\231b\211\003"
+	.ascii	"E\324\317\207\265\033\334\307\262\212U"
+	.text
+	.section	.gnu.lto_.refs.779ae4a278acd401,"e",@progbits
+	.string	"(\265/\375`\262\b5/"
+	.string	"\272l\260\022H\200\226N\032\003C\021\344\300\304-\231s\373I\357\020\300\331H\334\355z\2001\2072@\244\303`\303\217\345\226r\252\001\347v\217\253{\024\333\245\224\252\247~\313\b}\275\232\005\340\025\334\025\334B\253B\361\333\332\232%d\313\024\r\001\026\001\031\001@\252\257SU*\370b\313\345\016u|\002\006\236y\374$\342/\211_\024\005\365>J\337\223\356\315\361\205\005\376\267\364\247\322\357r\002\305\221O\2573\340\215;O<\356\204>@\2713\233\277\304\374$\345n\324|\242\344\017)we\362\223\315\375\247\251\236\303|\224\371'\323W\246\005\020?Z\356F\313/Z\356CI\257Dz\237\245G*\375\316\362u\224\366\234\345nL\372\"\322\247G?\263|\240\321\327\235\213"
+	.string	",$\364@B\217$\372\232\241O\205\236&\350\201\307G\217\003\005_-\355\214L\271\037\226\374\251\237\227J\367\247\236?\362\371!\342+{\236\007\371G\344\236\203|#\317\337 \367\032\344\007\217\277;\353\330<\225\234\257\301y\242\361"
+	.ascii	"\347\304\033\340\3156\347\304\342.<\377W\274\346\274\230\356"
+	.ascii	"2\351\373\210\177\242\2774\317\370\036\nwt\370+<x.\004\356?\340"
+	.ascii	"~\002\367\005\376C\377\371v\024\335\367\334z\356\333}\367\353"
+	.ascii	"\013q\004v{z\335N#3\335\237{\031\273\302h\013\367B\267\003'\333"
+	.ascii	"\177\317\355\276t)\374&l\334J\250\017\207Ba0\370;\337\327\264"
+	.ascii	"\243\315?\233\352\213\036A\346z\226\205\260\357r\365\301n\243"
+	.ascii	"\334\211\311\2279\356\201\350R\252\203\337\350U\352\365*\265"
+	.ascii	"A\335\247\371<\314\327a\276\221\3713\314\0376?\310 \370\314\020"
+	.ascii	"E\243\274\3007\315pu\231SJ\335\207F\371\035\312*\370}\334T}*"
+	.ascii	"\273\375S\340\250~)\267\325\177C\177\267\335\332\332~\262\337"
+	.ascii	"\344&i\243\235\377\331g\027\231\255N\205\376\324\024\024\324"
+	.ascii	"Nv'\247fS\t\351\374\243#\241\327\352J\364\2237\251'W\333ufR\327"
+	.ascii	"\271yI=]I==\311\276\276\023\030\275\331e\373eF\036[\354\260\315"
+	.ascii	"\366\301>\333\251\214\273\024\316\036\005e\334\237>\2627}\344"
+	.ascii	"\231p\366\245\321\366\243\321\276\350\262\263\307\331\354m.#"
+	.ascii	"\033A\200e\036\373 \360\"\217\002\177\231\037\360\315Tn\221r"
+	.ascii	"\017J\276\316a?3\330\007$\352\333\241\347g_\f>\373V\361\200\355"
+	.ascii	"\347\355\266\177w\030\325\276\027\232\375.\253\265\257\245\300"
+	.ascii	">\226\244\375+G\373qH\373T\242\366\341\f\354\277-\355\263A\355"
+	.ascii	"\253\241\355\210\341p\210~\024\321\3764\2643\005\355KB;\322\323"
+	.ascii	"N4`W\376l\326#q\2124\233\265\007\027k?\027kW\304\320\273!vA\354"
+	.ascii	"\275\036\366m\276\035v\240\345\360<\273\341qV\003\336\017\277"
+	.ascii	"{3\370\256Y\253O\267\352id\204\300\365\336\367\030\331{%|m,\215"
+	.ascii	"\375Z\257M\261(\366\304\232\330\022\273\265ZX\314\337\017\333"
+	.ascii	"a9\354\206\315p\265\027\326\n\375\255:\357\037\363\336zy9\373"
+	.ascii	"x\327M\366\177Y\f\377\334\\\232\377\226\275\360kY\013\373r[\031"
+	.ascii	"\312v\377\333u\277\223\265\355*^}&k\365/\271\256\276\222\357"
+	.ascii	"\352\247\001\1774\346O\266Uc\026\363\036\360\251r\366))\003\317"
+	.ascii	"\315\375\023\372N\207\371#\346\0331_9\030\344\316tz{N\316\216"
+	.ascii	"s\336n,\216\267\327|\267\0038\257\216\272<\352n\325\335q~\245"
+	.ascii	"n\216\305q\276\373\342\265\021c\267\306\276\313\365\316\330\225"
+	.ascii	"\261W\270\215\361\365\315\255\355\t\033\223\263|]R\323*\331\230"
+	.ascii	"\030\030\221\364\353\020!@z\360X\254\25796\353\253\215\235\257"
+	.ascii	"5\026\306^i\314H\367\n\243\253\246\360}\345Z\030_\267\266\305"
+	.ascii	"\327,\364+\207}\261W\r\373\342\353\325\336~\375\202Y\255_\275"
+	.ascii	"\274\305\373\311\257]\272/\335z\375\316q\221\253\262nkjgF6Hz"
+	.ascii	"\213\257\372\376X\257\372\372\330\0334VF\227V\372+b\257\302\324"
+	.ascii	"-\323\277\313\225\367~9\342\0377e\271\\\353b\370+Y\253\375$\207"
+	.ascii	"\331O\333\252}$\217\331?\262\230}32\261\303\026\303\330\376\264"
+	.ascii	"!~i\266\272\322N\036\351\2657*:\311\023\021\177h[\354BA\373\265"
+	.ascii	"\003)\327kO\036w\304\210\017\260,\376\006}\033b\275\210~\315"
+	.ascii	"\256\330\323\355Z\361\303\355z\341v\355\347\316\253\342,\017"
+	.ascii	"\207\362B\345\216&\177S\240\237\313\265kb\257\310}\221\273%\352"
+	.ascii	"u\267~\211o\200\261\250!@\316"
+	.string	" \242\210\210\214\214\210\210h\233t\220\"\252\241b\007\020\320v\367\305\rK\377\275y\213\013z]n\2622\032\342\253\200\235\300\304\202;\235&\355\211D\035\f\314'\352\277c\240-\307\241\225m\343G\022\303\026\"\317\237\300z\200Do\344Rbuik\323j\230\310\334\236\225\343s\221\2636\275\244K\304\335\021\337B\256\257\370N\340\003\365\231\276NoH\377g\313\222\320\321\362\375c?\227</X\020\f1\346V\006\203\227v\230\344{\027\374\345lP\201\2111\270\250\212\231af0o\2660\347=o\r\256\211\334@$\013c\361(\220\231\016\212\331B\363&\026P\253S\377X\016\361m\260a&\247P \\\371\214;\234\026\344\277\f\225;\362J\274\036\343p\201\201\320'\037HB\341\324R\357\373R\brf_x\027(ei\t\305z1\026\336I\200\247\nv\253{\236\366\030\204\367\337\340q\246]r="
+	.ascii	"\216\217\301\2562\2011['^\356\266\325\212\331mNG\351(T>I$<\377"
+	.ascii	"s\200\361\206\2369\240H\006\037\007\031\352\307E\301E-C\n5"
+	.text
+	.section	.gnu.lto_.decls.779ae4a278acd401,"e",@progbits
+	.ascii	"(\265/\375`\263\253E\251\002\3168\304\302\016T JY:\215\001\327"
+	.ascii	"\327\364O\325\207\227\037\310\272\335G\212\213\242\363Y~\222"
+	.ascii	"\r\207\f\355\034\303\353\017o<0\312\327p\274p\331E\020\350\001"
+	.ascii	"\342i\233dY\226%\370\377,\357\371l\330\277m\333\267\177G\327"
+	.ascii	":(B^\243\3618\313\374\324H\222\275\345\2262\005\212\f\330\016"
+	.ascii	"a\017\301%\372A+\375`\224\376JG\177\245\323_\3274\256\303d\356"
+	.ascii	"\331\005\270\f\324\007'\371K+\303\371\353\025\375{\301\232\006"
+	.ascii	"\006\336\013\326\257N\364\327*\3755\207\376\272\365\217\345\342"
+	.ascii	"^PQQ\301qX\354\366\3548\003\003\022\306C\224\266!Y`\276\354d"
+	.ascii	"\3755\341\303\371\313\341\360\325\336\035T(/S\232\260\027\fw"
+	.ascii	"\206)\r\316]\240f{o\017)\230/]O8_e\243\335p\333=\303o8\313\027"
+	.ascii	"fK\241lz\r\253F\024\277a+8\255g\t\303n\302rz\356\275=\210\020"
+	.ascii	"1\324C\002d\315kA<ZWP\206t\331R\207\013\326r\317\360\026\254"
+	.ascii	"f\266%\310\344\211\347\226\3121\233\213\256\371\252\020}\265"
+	.ascii	"\206\3761\226\343\264c\261{E\334Q\247\346\007\316&\204\216\261"
+	.ascii	"\254`]\210\310A\303gY\236{\\p\376\302\320\236%\f{/a\023\275\202"
+	.ascii	"\315\356\031>;\303Vp\331\255\333\312R\350\242{o\021\036D\344"
+	.ascii	",~Xq"
+	.string	"+.\303b7\250\243\013\231\033\316We\350_\277\2615U0\031\246r\3170\364\307P0\3241t\357\246(X\254G\335\373\n\017C\361\024,\326\263\004\335Q\303\256\2504`A\"D4\251\034\241\243\363s\032\375LFc0\034v\317<`)\277j\327\357\352\022tC\365\266\230\244p~\016\2435\260\367\365\260\336\300\300\353a}\206\323\317\\\364\212\237\\\240\233\336\324\306p\376\261\027v\242:\321\311\352\302\271\t\264G\3539%\206\363s\230\376\365\233R\202#\207\030\206\212\222\3624\206m\334\230r\003\177!\274\327. \230\247\f-JK\\v\200I\351\bs\252A\345\311\243\007\223'\276\302B0\022\234\004o\341\"\230\013[\341#X\t\356\302L\360\022\234\205\265\260\021\374\304C0\221{\206\261\360\217c 8\310/fj\332B\265\345\367\337\271*1>\270\360\214_\b\323\270\177=\351\336Vi\035\230\350"
+	.ascii	"c]9\367\257G\t\272\241\2027\236e\330\374\366\336\"\202Dd#ch\336"
+	.ascii	"B\344\247{\372R]\240\365\347\376\254O\351\364\323,\372)\230~"
+	.ascii	"\252D?\035\242\203.\320\372\024J\037\007\352\020zZ\203;\375A"
+	.ascii	"\234>F\323\307\002E\237\215K\037\314\005Z\217\201\350c\033\372"
+	.ascii	"w\177\372\321\250\276\337\005Z\177\321\350;\347\322\271gA\267"
+	.ascii	"\316\366\271e\230rT\341\374;Fo`\337\240\365\2017h\375%\323\030"
+	.ascii	".\320\372\337\276 \036\274:stq\370\262\232\326\332\030\276\377"
+	.ascii	"\332]3\027\216\020\016\024%(\316{A\232\311]\r08\377z\351\377"
+	.ascii	"\267\315}s\335\334\350\315\273gW\357\252\371]s\361\236\241{7"
+	.ascii	"q9\023H\226\346\357\271\367\376\035C\003\370\274\373ZO\023\206"
+	.ascii	"}CF\235\347\235\323\273l\276v\353\260l\"\215\0326\340\200\355"
+	.ascii	"\275\203D\210\020!B\304\316\233*3t;\371wJ\337\253\013\264n\270"
+	.ascii	"?\353\257\223\376\235\241\177\233\364\357\222\376\335:\255\273"
+	.ascii	"@\353\be\352\210rxxMp\376%\373\205n\335\365r\327n\035\226\374"
+	.ascii	"\245%\272\367\376\177\311\3341\367\354\326]1\277s\227\356\031"
+	.ascii	"\372\r~\241\272\373\345\312}\250\261w\021+\rd\320\\\331\363\333"
+	.ascii	"\033*\"HD\352D\246\254\311\232\357\276@+\206\373\263\276\005"
+	.ascii	"}\301\3340\367,\304\215\273\260\t\272\315\366\206\372\b\321\354"
+	.ascii	"\t\301\202\363S\320\277!V\237\300\300\300\300\033b}\b\372Bpo"
+	.ascii	"b^\260\260\340|\337\360u\273]~\337n\333Mt\360\235\246\373\226"
+	.ascii	"\367^\272W\202\236{%P\341\272\226\312\326\374\021\372\277lkA"
+	.ascii	"*8~8i\371]"
+	.string	"\373\357\226\313\345k\370j\357\246\275w\007<\346\215\225\037\316\257\273@\353\216\232\320\257\226\224\315\313\214:8\343,!x\344\240a\002K\273Xn\035\330\220'\316\377\255\362\213\345\277\320Kv\321(\260\267\331\336\273\003O^\027h\027\316\327\312-\273g\020\334+7\321\301S%+{lo\250\017\017`\030 \035\234O\201\3765{\217\225\335\301\261\376\205`\275\201\027\202\025\304\005Z\363\375Y/\025\241\337*?k\024\025tc\331{\373\214\220\304\210\024\234\323\373\263\376w\312\177\305\356\030\004\251\323\323\325\306\26274\203\017t\n\207\021\234\017\275@\253\276?k\232\265\n\235\021\376B5\f+\t\020\310\035\210!\235\202_\343\375*\233\314<\263\252p\305\002:\314\177\251@\1775L\225\362\257(\374\227\311\205r\243\374xK\305\277\236`\037\301\257\325\234<3\005t\031\004V\021nX\214E\005\277\326\312)d\025\331"
+	.string	"\031\205\332\365\253K\376\265"
+	.string	"\177\026\341W\265\362\b?\226\222\202h!\001\352\225J\344_\t\240\376\310\031\376\225\004\256\t>\374\002\026F\370\257\0135\205_\023\323:\301\300\037\013\340\307+~|\342\307B?\006\341\307\025\374\330\204\037\217\360c\017~,\342\307\n\3701\005?>\300\217S\374x\001?6\361\343\023~\f\200\037\207\370q\b?\316"
+	.string	"K\200U\340\021\330\001\214\301\217K\b"
+	.string	"N\341\003\374"
+	.string	"v\001o\200\007\200Q\374x\205\037s\200K\250\360c\004\374X\004\334\202\005?\366\360\343\004\3748\350\307\r\020\336,\377U\234\313\327\206\031\376\\'\017\205\277\212\207\252\372\341\375\263\335*\302\237\323\2640#L\313\200\302\277?\317Pe\260\371\037\315]\322\036k\b\023\250k\177\356\223\"v+\370/\006\377\035\361_\022\177\256\362g\350\315\340\177\336\177-\370o"
+	.string	"\376\267\371/\005\177\272&u\241\313\372\201\331:\200\037wHWX=H\225k\007\177\n$\375\372\257\013+\007i\006\251\211\266\177\345\311C\272\254\033\250YM\\\bR\025j`\232\265\n\375i\001V\r\n\360\347\022\376|\342_K\374\231\304\217\331?\207\370\263"
+	.string	"V\022S\031\214*\346\377\332\232\301\237\202X\0030\346_/ \363\257\270\353\377\007\f\376u\304\217\211.\310s\326\n\326\214\267\034p(\277\032\366\337\020v\374\252\233\224NL\007aV\021\377[\260"
+	.string	"\345\022\374\301$\177\212\301*\200?\273pC\b\312\255V\363\247\"\374_[C\274\016\304Y(aU\372\317\302[\244#$qI5\310"
+	.string	"\002\277\242Z\200\001\b\004\271\251t\336\342\033\374\353\230\377-\360\276\250\301\365\357B\2253\360\2532\376\365\202\017k\005\351T0\203T\355\\T\246\2644L\215R\245\376\325\202?E3\322e\r\300\237\002\t\272\333Z\001n\002\0053\371\007\177\360\306\237\2125\245a\027X#\370\357\212\177\005\300\177[\240\370\257\t80\t\026|\270.\274\305'\370\203\313\324\351\226\360_\022\376k\200\377\026\340O\203+\004\277\032\\\277~\370o\bMA\341\237+\360\347\344\277zha\001\375%E\312c\204U\376\374\226\323\007\326 \274\225\347N\227\327\016\377?`\007\034\350\027F\301\022`\026p\004X\305\237\322\341\021\030\304\237\212\3711\n\177j\002\326"
+	.string	"\033\340O\321~\234\002\276"
+	.ascii	"\027\340O\255~\274\001\376\260\345_9\374\370\201?5\362c\022\177"
+	.ascii	"*"
+	.string	"\\\201~\354\302\217[`\b\376s\371\032\036"
+	.string	".\221\316\300\023\374\251\023\346\361c!\3561E\365c ?\016\202\253\326\237u\003f\361\343\255\2739\340\013\370\205Z\177n[\033\362\247*\324\300c\332\237\211l\tr\026\236\376B\037\377\205\362\257\032~5\003\377\232!U\372\025\325\202\334\301\212\341Wi\374\252\323\277\372\374W\354:\375\027\003\177\212d\355\371U\033+\317\177\b\260\360\026M\270\216\301\037L\300\024\217\013\200\377~`\341?\277P\351\307Kx\006\226\201m\340\032\330\t\323\300MX\351\307O,\3440\2413}\246@?V\262\356\374\351\004V\342\237\271\322"
+	.string	"\254\303?\005q\231\374\367\311\177C\310B.\330\217\267R\242\224M\216\3126\336E\205\242~\375\253\360\377\212\377+<\350\177\213_a\341)~!\004\177Jt\201_\345\273\021\374\027\204\352|\213U\377k\376\277B\321\303\277V\371\323\020\026\344\177]\341\206paM\222\256\270\027\\\320\342\032\376U\310\237\032\207\256\210?\325K\243\377\232\252\301\365W\202?eZ\361\177\005\360\253\177\252r\275\377-\270&^g\315\177"
+	.string	"\374A\270_\r\376j\217\247h\314\244*\324@\365\357\277R~\025\260\353W\353t\370U:i\231\377\034\376\340\331\257\032\361\245(\254Rw{\227\273\371\277\367\037\316\371\316\363\013y\376\\T\341d\006|\240"
+	.string	"\331\237[P\367`\374\252\005\377\257\\\027\037\376\232\310\237SU\357\317*0Q\016\376\352\233\377q8\251j\375X\212X\364O[\270\371\005\0168\004\277\026\376\252\317\257\016%\370s\223[^\272P\275\333_\306\200\356S\363\036\367\340\277\202\360c\341\177]\340\341\217\203)\240\332\346u\322:\3777\374A9?f\373q\333\003~,\201\257\277\336\373\261\306<?\356\340\307=*\033\354"
+	.string	"4\022x\317\257b]\340\214\007\252\031\031?\316\372\325\004\374\307\377\220\310\257\202\360\253\005\370U\002\374\352\b\277\032\302\257\222\360\253'\324\007\374\252\335\257^\360\253\037\374\352"
+	.ascii	"\312\374\367\371\207M~\325\305\377\373\017\321\216\366\247A\037"
+	.ascii	"R\016\377\365\277f\360\253d~u\314\257\316\375\352\227_\205\373"
+	.ascii	"\325\266_]\373\325-\277\252\366\253R~\365\353W\235\374\352\363"
+	.ascii	"W\227\374\352\326\257b\375*\221_\375\361\253>~\265\307\257\356"
+	.ascii	"\370U\251_\305\361\2537~\325\351We\374*\323\257*\375\352\006"
+	.ascii	"~5\003\277\352\374\325\013\374\352\362W\221\277:\364\253\017"
+	.ascii	"\370\325\006\374\352\212_M\361\253&\374*\206_\325\277\232\177"
+	.ascii	"\025\377\352\377l\346\317\200\177\256\363\3479\177\356\3733\337"
+	.ascii	"\237\365\376\354\346\307b\376\334\376\031\357\317\026\370s\232"
+	.ascii	"?\237\371\363\230?\317\375Y\356\317a\376\f\346\317^\376\334\345"
+	.ascii	"\317o\177n\373\363\332\237\217\177\336\362g\265?\247\375\371"
+	.ascii	"\312\237\313\376\f\375s\330\237\235\374\231\311\237\225\374\231"
+	.ascii	"\353\317Z\177>\362g\254?\023\371\363\220?\013\371s\220?\377\370"
+	.ascii	"\363\324\237y\374Y\307\237\243\376\234\343\317O\177\266\361g"
+	.ascii	"\247?\317\3703\005\376\274\342\317\371\317M\177^\372\263\006"
+	.ascii	"\376\214\201?\255\363\347\244\037\267\375\031\306\237\221\376"
+	.ascii	"|\201?'\377\314\376\331\370g\b\374\331\001\177f\300\237]\370"
+	.ascii	"3\213?\247\360g\025\1776\300\237Q\374\371\304\237=\3703\211?"
+	.ascii	"c\360g\021\177\316\360\347\340\237\325?\r\374\3238\177\n\347"
+	.ascii	"O\365\3764\372\247y\177\312\346O\327\374)\232?5\363\247e\376"
+	.ascii	"\264\356O\351\376T\314\237\306\375)\334\237n\371S\265?M\373S"
+	.ascii	"\264?=\373S\261?\r\373\323(\177\372\374\323\256?M\362\247Z\177"
+	.ascii	"j\344O\213\374\351\325\237Z\375i\325\237\002\371S\252?\235\372"
+	.ascii	"\323\247?\265\361\247N\177:\343O\233\376T\351O7\360\247\031\370"
+	.ascii	"S\f\374i\322\237\302\370S\244?u\376\351\005\376t\371\247D\177"
+	.ascii	":\364\247\306?-\376)\003\376\324\205?]\361\247,\374)\n\177\232"
+	.ascii	"\342OM\370\323\022\376t\204?5\361\247\032\374i\006\177\032\342"
+	.ascii	"O-\370\323\t\376\024\304\237F\360\247\037\3764\350O9\374i\206"
+	.ascii	"\037\007\371\361\323\217\227?F\372\261\224?\365\371q\004~\374"
+	.ascii	"\200?\345\371S\342\237\n\3774\370\343\006\3747\204\377:\340\277"
+	.ascii	"\013\370\257\320\1778\177\232\377\327\375\251\372\237\313\177"
+	.ascii	"[\374\351\375q\340\217\311\374x\314\217\347~\334\345\307o?F\373"
+	.ascii	"\261\331\217\255\374\270\312\217\247\374X\354\277\333\377\017"
+	.ascii	"?\006\373_\347\377\225\377\272\370o\301\217\241\374\270\311\217"
+	.ascii	"\231\374\217\373\261\222\377-~\314\365\237\205\037o\375X\353"
+	.ascii	"\307U?\306\361\343\027?f\376X\371\343\242\037K\340\307\020\370"
+	.ascii	"\261\003\376k\345\2775\376\373\200\3776\340\277\f\370\317\342"
+	.ascii	"\277.\374\367\204\377n\360_\023\377\343\374\347\373O\346\177"
+	.ascii	"\227\377k\377W\370\237\366\037\313\377\261\377\202\370/\367\277"
+	.ascii	"\204\300\300\300\300\377\303\b\277\004t\277\262FwU8\007\243\202"
+	.ascii	"Rki\334\2428\007\241*\300\323\177\360)\3704\004\214\r\033_\273"
+	.ascii	"po0r\330\202NA\247\257i\330\270\f\230\027\220h\005M\364\037\234"
+	.ascii	"\021\234q\321\266V\257\262\n\202\004\231\202L\301\246&;\262\350"
+	.ascii	"\374\316\367`\223\220*I\024\316\257`I\377A\245\240\022\216\273"
+	.ascii	"\332\264\215\200=\233H9c\252\023\030x\321\256\225\r\325|\252"
+	.ascii	"\302\003lo0#\362\237\0334\\8\237\0020\177\177\027m\335IWPrD)"
+	.ascii	"(\243C\247\355\r\211\0349\353\333\016\n\200\350\177\355[\373"
+	.ascii	"\332\312(h\322\377\312\267\362\341/B{\033\251Z\337&p\243\377"
+	.ascii	"u\357\367l\335[\235\260\225\255\344\263\266\323\200\225\001\254"
+	.ascii	"\021\007\347O\200F\377\353\233{\266\276\301vj\323\276\342Z\341"
+	.ascii	"<}U\371\355\rf\204\306\002c%\003\347O\360uw\267\272!\312\331"
+	.ascii	"\313\242\363\313\373\352F\373]a\203\004\347\265M\312\304\n\235"
+	.ascii	")\234W5+\033+9=\312\260\371\212\227\252\265\251\001\244\213\007"
+	.ascii	"\241\227\214/*8\257kp\026(;\304\314\230\340\210\376j\346\256"
+	.ascii	"h\320\240\255pox\306\024\036Cp\376\004U\372\253\235\235\214\247"
+	.ascii	"\tj\220!\323\346%\001\034\035&\314:f\210\035\335\3271\027N\311"
+	.ascii	"H\023\316\353\334\327\202vaZz8\257b\250\302<\001\304y\225\373"
+	.ascii	"\232\032\2650_p^\343$\220\373\362\345k\031\272\225\220\260\227"
+	.ascii	"E\007&\301\225\325mu[\341\202>\260\262\350\300\272|\205[#r\367"
+	.ascii	"C\013\347\365\255\t\033\333]\013\202n\245\002\224I`$K\226\225"
+	.ascii	"K\030\216\347\226\257\\|j\004\376\205\301y\325r\347\270\320\271"
+	.ascii	"\341\274\252}\215\013\331]\022\037W\256\254X\254V9/\264\257X"
+	.ascii	"\326.\332\0322o\022\334\320\377jv\266\232]>\241\323\336:@x\331"
+	.ascii	"Q\215X\341nD\301\301\371\0220\351\177\265r\266Z\271o\351\336"
+	.ascii	"VU\326(X\320\021\007\301G\205\312\n\035\341\215\234\347\246\212"
+	.ascii	"\n!v\325\026]\253\344\225\321\241f\343|\020s\372\311\223uLHO"
+	.ascii	"\220\262\257\257c_\305Lt\360<\005\364\370\233\201\363\327\260"
+	.ascii	"U\312/\304B\376\366\023\234\017\302\213^\243\254`\377\205\025"
+	.ascii	"h\321\301\204\3631\b\265\013\202^|\324\2403|\322Q\262\004\347"
+	.ascii	"\025J\016\263\322W\205\363\371\316\245\211\227\032_8\037\004"
+	.ascii	"\025\375\257N\316V'wMh\357%\253\325\213\t\204\023\375\257L\326"
+	.ascii	"%\353\363\256a\330e\266p\353MZ\024\004\021}\0209\220 Y\273t\217"
+	.ascii	"\217\275,:0"
+	.string	"%_\273\326\216(U\301\301yM\362\2365U\276\310\352\350\257Z7\007\346\300\257\t\367\006c\265\212\275a\n\356\\_\r58\0331\262f\035\303\336\233io+\260\240\220\035G\276f\3357\325\f.\355\ng"
+	.string	"\244)R\344k\031\303\276\301\324\365\214\273\272\372\032\n[\006\331\007P\312\366\210\003\340\213\225\325\225Ca/Ia\340\365\226E\347\267\243\300\214\020f\355\001\321\202\363\001p\246W +\220\265\352M\007C\366\262\350\202|\255\312vU\320\334\341|\276+\367_\270\322A\325\231\203\363\001\360\324\377Ju\266R],Az\233\261q\3411\342T&\206\363\001P\265\356Xw\254SB\342\215\035}p\3746UT\210\177\355\361u*/\235\003}\343\005\347\225\307\341t\300E\251\272\376\013\211n\300\354`\302\371\021\334\351U\212Gm\256\354\r\347G F\257Ph8\320"
+	.string	"\342\374\b\324\364\212#\210\333\234\335\224\033\227\353\213\022\027\316\217"
+	.string	"\212^k\370\370|\341\033\302\206\363#\340\322+\215\341\232\032\225\024\316\217`\207\376W\246\337\263\225i\225\221\255l%\002\254\321"
+	.ascii	"\342\2677\325\bMe\347\366\205\363\332\324c\344)o\r\347G\360\244"
+	.ascii	"\037\001\r}\317V%5p\305\335{\255LHto\252\021\303#H\272\002q>"
+	.ascii	"\004l\364\277n5p\257\231\212\2033`\320+\212\025\030\316\207\300"
+	.ascii	"\213\376\257\326Q\375\3249\252\034\225\316=S\377T8W\371\260\222"
+	.ascii	"\323\237\032G\355\333Q\201\327\025\236\233\237\372\247\356-)"
+	.ascii	"}\320\244\016\317\315\357\315}\253\300k\343\271\371\251\177\252"
+	.ascii	"^\024\317\315\357O\265S\243\267nk\357\035\030xE\341\271\371\245"
+	.ascii	"gW]\321\035\017;rh\262l\234\017A\231\356\271?\353!\350\322\207"
+	.ascii	"\240\210>\004=\364!p\322n<\254K\316\314\201\303\371\037\364\364"
+	.ascii	"\227\212w\353\2662\240\\4Oes\317\3246\252\031\265M\217\272\367"
+	.ascii	"R\334\2238\304\210T\2155\257\361\013\303\246\206\363?\200\331"
+	.ascii	"\362\344r\247\252Q\321\33435\215zFM\303Uf\007\307o\357\035'*"
+	.ascii	"\347\215\316\377`\245\377\301I\377\303&\023\305Eg\214\324\327"
+	.ascii	"\362\306r\237r\266\236q\364\257z\231Su|\355n\035\033\223\331"
+	.ascii	"\2223$\272\243\242F|\371\242\212\241\332Jq|v\274\005\267\304"
+	.ascii	"\240\361\311]\0253$\003\206\345\017g\025\214\032\247\331\324"
+	.ascii	"\304\221\211\013\243\336\365\310\261\004\232B\233)_\340\376\013"
+	.ascii	"\213pH\374p\376\003w\372\017\330\355,Mq!\203\363o\330U\323\256"
+	.ascii	"\272\251o9\314\335:\242\022p\346/\272\243x\214\370\003k\372j"
+	.ascii	"\026U\355\252\226kQ\333\364\336[\t\272\241\202\306xe\321\371"
+	.ascii	"m*\252\020)\016*Ur*\333\325\266\274 \031\324\223\035\316\347"
+	.ascii	"S\207zd\316\244Q\327T.;\324"
+	.string	"\234\301\201Q\271\350\354\320\242n\311<\322\270.0{8\377\201*\372\277\307\377\272\227\242\366\336:T\350\216b\332Y\377\373\253\336\033\342\347\271\351\235\340\177\336[\tc\357\031q\374\366\336\027\216\366Z[\n\202\363\177\020\373\377C\354\255t\367\336QNfE\22428\231-m\247\263:\251\fNfE\244\234\240\233H\207mfd;A\257\224\362\225\322\336[\to\350n*\"\265\233\256\224\230N\320\035\265\241WJ\030v\223\024\006'\350\222\222\223Y\021\251\353dv%\345dv%\225a7m\245\335\264DD7]I9\211\271\222\302\340d\266$\345\324TD\352B\257\366%\363\006-\2424c\233-\361\354\275\237\240O\245\235\275\227\242\266R\031\214c\027\211\342\330V\373\326\205A\215\354\275\225\260\334a]\t\241L\273\316\351\311\225\321\214\275\3576\016\016\224\256\022t\357Mc3)\335\275g@\243\366f\272\242"
+	.ascii	"\325\336{_]34\2426\317nZzb\302\272\332\231\301tEc?!r\367\336"
+	.ascii	"[\312\311\f\353J\250\355\212\331s3A\225\256\323\323\325~\356"
+	.ascii	"\273\"Q\332L\tz\367x\314\222P=\341\374\007\250\256\250h\302+"
+	.ascii	" eK8\377\201\250+ff\252X\020t\353\270a{Yt`\017l2\325J\372\006"
+	.ascii	"\357\007V\033\262*gj\025U,u\332KE4\b\263\313\242\363\333QQ#\356"
+	.ascii	"@\234:e\f.\007\316w\240M\377\352\230*\306\244\013\225\036\316"
+	.ascii	"\252\224 \027\322P\361q\026E\005\333x\313\324\031\260\256(\252"
+	.ascii	"\227\372\344\236\035N\205\0025\243K\203\346\016\347;\300\245"
+	.ascii	"c\354\275\367=\334\032<\334\372\337\263\257\251M\310\236{o\f"
+	.ascii	";k\340l\301\202\363\035\300\322KT&\320;\243\214\234\f\234\357"
+	.ascii	"@\324\022UIO\232\034WX8\337C\240\232\004Jd\263J\343\001\335\201"
+	.ascii	"\202Jr\205\363\257n\031a\272\222B\007\347o@\344NH5\242\016Y\023"
+	.ascii	"\275R\363T\261\324,\365\210\252u\317T#j\021\325\210ju\004\317"
+	.ascii	"\006\034\265 ;\3070\337\303\236\276\0072\372\036\256\350{8\242"
+	.ascii	"\357AI\377\252\020\265\212k,.\t\316j\325\237\352\251Pj\020\234"
+	.ascii	":\251\021\304\t\316@\202\204Xz@x\340\374\240\250\376\006:j\364"
+	.ascii	"P\247T\037\352\217{\246R\251;\264\220I\331\030\213\272O\257\033"
+	.ascii	"*\225\312\243IY\026\035\330\336[O9\203\203c\230\037\324E?\250"
+	.ascii	"L?\b\252\0374E?H\212N\267\232C\305ag\245\212\025\234\237V\034"
+	.ascii	"O\275?\234\037\204\245\177\311\346Hy\322\t{\326\001\023\372c"
+	.ascii	"\302\305o\354\316\311\021{f\300%O\225I\245\241\316Po\2506\324"
+	.ascii	"\032\252\223*C]\272gj\223\272U%\032S\236jS\016\354\312B\322\\"
+	.ascii	"\235\331\220\037\324C\277\003\240~\007?\375\016z\372\035\356"
+	.ascii	"\364;\214\321\357\260\246\337aL\277\003\226~\207\033}q\240Wa"
+	.ascii	"\177y\3579\316\237\341d>,v\257\214<\034sp\306W\027h\255\340\376"
+	.ascii	"\254YO\350y\257G*\354,\013\316\031\362\233(\215!fcr\364Zj\360"
+	.ascii	"\375\315q\223\331\f\275|iE\251\371Z\217po0S\236\231M^\363\265"
+	.ascii	"\236&\350V\262\246\261\322G\305/\347\3456\367,\263\311x\317P"
+	.ascii	"\021\"\202\204aD\300f\254\371\034\354\3649\314\351s\220\323\177"
+	.ascii	"\276\313il\354h\362\302\371\367,\247\311h\240\354\355\261\235"
+	.ascii	"yF\363\265\235\375\201g\214n\207\023\316y\214\317\022\336_\017"
+	.ascii	"3v\3028fTRp.C\2142\346\306\003\347sp\323\377\357Y&\223\353\240"
+	.ascii	";h\207\006\227\227/\234\317!M\237Ox\241p\t\313B7\247\247\224"
+	.ascii	"`\351\013\362\211\242-\271\211\221\313\340\255+\013g\271\257"
+	.ascii	"\341\365\f\020-9.\207Y\307`\315\220\2033\030\"\027\266\215\005"
+	.ascii	"\347s\030\323i]\306\336\324\210\342P\032\363D\303&G^\242{\332"
+	.ascii	"`\303bvv\377d\204\211f\035`\242\351\027\272$zr\346Dq\037 \326"
+	.ascii	"\032\334\027\250&\352F\005\017*\372\245\216k\f\2224/R\320\254"
+	.ascii	"\241\212\246\275M!\363\243\303\244E\313\225\3004A\242z)\037`"
+	.ascii	"4#\311m\331Jv\222\245\344#\271,O\311Qr\222\354\226\215d\265|"
+	.ascii	"\226\277d\257\214\226\2572W\026\313K\362\220\\$\257e,9-+\311"
+	.ascii	"Dr\220\334$we\262L\225\263\362\225\234%w\311aYH\256\312L\262"
+	.ascii	"\227\274\225\237dh\006\313V\331,s\311P2V~f*yK\326\222\3072\\"
+	.ascii	"~\313_Y+\003\311l\371\307=\313U2\217\347\036y\352\230\351\017"
+	.ascii	"\357\231\266E\r\367\345"
+	.ascii	"}\027M\277\30411\303\302\005M\033\034\3218\177\321\031\\\252"
+	.ascii	"d\031\031*\205\262\251`\022\223\352\315\221\023\325K\341\004"
+	.ascii	">\323\340\304\242fhk\035\374\351\227\324\214\220:m\242~Q\033"
+	.ascii	"Q.rK\316T\221\221\331z\246\245kiO\263\354#\356\031\006Lo\317"
+	.ascii	")*\356\231\242I\325\234\375H\313U\322,\251Z\217\022\206\275\217"
+	.ascii	"ly\246imUp\037\035\273\274\2619%\351\2272C\002\301\204E\323/"
+	.ascii	"\251\030\031]\251^\332WV'"
+	.string	"\357\351\351\346\3063\375bg%\205\355\230\302<\253\344\035k\321\024M\256\222\336\001y\356\r\345\221\243\346\316\306\335\371\034\260t\360y\201\326\307\271?\3539L\351s\240\241\017\024G\037(\215>P\027\235\241\376\314\224\233r\216\313#\214\033\027\234q\244\2006\270L\301\371@[\364\377l#\327\3107\262\323=\313O\231F\007i\260\206\344\247{\246\214+\212\306nK(?\335\273\213fg\005\r\342\242\322\263\033\346\003]\321\027*\364<#\033\211\003\345\004\347\003Y\3217z\201\326\b\356\317z\240\247>\020\225>\320\223\376\206?\375\rl\3647\210\321\337\200E\177\003\023\375\rC\36478\351\377\354\351\377\220\321\377q\323\377!\323\377y\352\377\370\320\032\334\237\365?O\372?[_\003\236\276\206/\372\032\312\3645t\351k\020\242\257A\207\276\206\255\237\341\215~\2062\372\320\373\263>\203\026\375\fS\3643$\321\317"
+	.ascii	"D?\003\r}\ft\3641\224\321\307\220E\037\003\230>\006+}\f8\364"
+	.ascii	"}\350\350\373\330\351\373\260\351\263\335\237\365>S\364}\266"
+	.ascii	"\364}v\350\373(\351\367\230\321\357\321\242\337#E\277'\210~\217"
+	.ascii	"\223>\317\236>\317\030\375_-\227\n\346q\321(\320d\362\343\n\316"
+	.ascii	"\347\t\243_w\177\326\363p\321\347\201\352\363t\351\363\364\320"
+	.ascii	"\217\246ei\024,d\310\23128\277\003\035j<\242\266\b\005\221r\347"
+	.ascii	"z\334?,\317\037S\2427\350\236\270oG\0262**\321\252\260(\024\230"
+	.ascii	"\347\336P\334'\245%:%}\222>S(iXJ\226\202\245V\322\261\364+\255"
+	.ascii	"\222:I\305R*\251W\nM\245\244M\356Y\032%\355z\272$er\347\242\244"
+	.ascii	"<\316\322\242R9\302<q<]\264\036%\f\233\351\314\334so(\220\213"
+	.ascii	"\226B\237A\264#b\3214J:\225\372H\241O\215&\243J4\215\222\nI\225"
+	.ascii	"\244P6\004\234\201Eq_\032%\305!G$\215\236\337\336P\021\304(_"
+	.ascii	">\306,\310\230\355\002\255\"\360t\222\313\227\244\t \316\337"
+	.ascii	"\211\323\337`\b\266K\241l\232\006\332\226\250\320VJ$\315J\241"
+	.ascii	"O!\r\255\265h\312\225j\245H\356Y\272\225^\371\245[\251\025\266"
+	.ascii	"K\"c\247\007\2667T\204\210 \021j\224\2203t:\377)\326\323\254"
+	.ascii	"\364\b\005\366\306\242\251\232\236\246R#yj\356\310\022\234\277"
+	.ascii	"\323D\247E\204\236bE"
+	.string	"\260\005\256\r\347\340\375Y\277\203D\177\347\207\376\216\223>\221\216>\261O\237hF\237\350\246Ol\242O\034\242O\264\241S\037\177\232\311\2263j8\177\330\247?\264\323\037\266\351\017\307\364\207]\372\303\037\372C\033\372\3027\372B1\372B4}a\022}\241\224\376S\033\200C4\300;%8\303\301vsO!\275\022\306\306D\205\332\340\250\224\323\177\347\306`\273[\267\2653T\233\226\027\260;w\267\245\215i\356\242\t)iy\001\023z3\202\224\273\350\336P\f\210\325`6=M\320-\325\263\205L\313\213\237\r3\027\215\316SI\314E\273uT[\351\r\007M\2440T\232\373v\353\250v\352FI\313\013\330\336\320\377\351N\2330\235tF\252\204\345\340?\034\230\312H\227R\032)S\352\204\347\2445p\235{\206\001q\234\343>\354\367\214\003\315}[\231Hm\300G\306\205\356\r\031 \336\303vjd~\307"
+	.string	"\361\231\213\306\204\210\226\027\277\275\241\352Z\021+#\023d\274/\320\n\342\376\254\327v\372\232M_O\321\327Y\372\372I?\b\230\207\335\360\324\371P\223EM\236\027\214wq\3009\362\205\363\203dx\315\263\225+\236tijn\r\347\007l\264"
+	.ascii	"\342\374\022\342h\342\225\f>\207H\035\242\331\333`\034nP\204"
+	.ascii	"\340L,\273\033\036-d[D+tXvL8\023\253\020\241\367\354rD\262C}"
+	.ascii	"z\334h\244\311\341\374\022\334\350\337\313\255\033\270\227[\211"
+	.ascii	"S\204nVG\212\340\374`\0264A\2368\277\204;00\242\0245\273>8~\032"
+	.ascii	"\316\315\227'a'J\351c\332\333*\201\313\223'\304/@\036X`z\354"
+	.ascii	"\262l\334\200r\342\027\023\024%[\260\200\2659\363\003\347\227"
+	.ascii	"P\304\211\223%FSzO8\277\204\247\347\223\270\225\366\f\272\335"
+	.string	"I\325\305A\202\204\270\304.\211F\313R\025\204\330u\342\022\037+Oqrp&*\321P_jT\371\303\231\230\344k`\254l\211\2269r\204\270\205%J\324\252B\223\203\250u\342V\236\017\030\240Z\017\234\211Y]\260\260V\270 \275\247\330U\211\362\274M)#\347J\220 D\"AzO)S\022M\321\360\250\364\021\257N$\222\307#\304\312\214\r\316\304!\"4\311\235\301\231h\365\265:\350\024\016\234\211B\256\234\222#T\246p&V}H\226:|e\377\205\330\254\214X\035\224\037?V\270\001\024\351\2432\3442\262\006\016\347\027\340\210\017\037C\247\213\001\312t\206\316so\252\020>r\214\340\361\300\371\005\200\352\321\243H$\215\036\3305sV\247\205\363\t \207\270\203\270c\205\013\272R\352\013~\335>\245=\2625PPD\251\240+%\276`\235\247\257*)5\320\f!F\235(\305\303wVG\205"
+	.string	"e\2108\2108\200\b\311P\311\023\343f\303\006\361\206\006w\323\270\202\005&\2724\367\307u\343\242\251\221\002\233\202\363\t@\205H\203H\203\350\024t\245\364&D\330\033-/)\024\016T\031\321\t\333%!\233A$K\206\f\rx\217X\321"
+	.ascii	"\342\307\343t\007$N\212\211)\330t\255l\250\240\227\020=Z7\312"
+	.ascii	"\310\340|\002l\242\022Qi\350\364\264i[ey\016\2576\233\024\316"
+	.ascii	"'!\032\0308t\272V6\024\004UPy~\007\2102\206\n\347\223\220\306"
+	.ascii	"\367!\035\276\341_\260K\320fj\332V\\?t\240\326\350\371m\247\252"
+	.ascii	"\020EYC\304\f\353|\370'f\r<c+2\224\363\341\234_\030LsF\316\n"
+	.ascii	"\316'AJ\017\373>\364\373\205j\220\035xOp>\tO\372\037\306\371"
+	.ascii	"\205;[b\350\364p>\t3\364G\b\334\373\336\212%H\357)g\302\242{"
+	.ascii	"S\205P\315\364\276<\305y\363&\016\346\301\204\251\206\035\036"
+	.ascii	"\336\320\315\265\262\241|\272\236e\330\210[t\360\216\f\335\f"
+	.ascii	"\363\344\226\240\345\r\333\304\231\222\344G\2236,rPC6\370G\217"
+	.ascii	"\0259W\336\340\374\021\322\206g\206g\206j\202\256\224\342\f\341"
+	.ascii	"@\331\215\255w4\302\254\271\373P\315\237\310\350\303y\230f\210"
+	.ascii	"f\204+1\367l(fh\247A\023;\237(qs\224\312\354,\t!r\327F\007J\217"
+	.ascii	"\272\017\311\374\303\271!]\027\016$Yp\036\216\021\372\260N\270"
+	.ascii	"&6\306\b\316\036\356\317z\331.\320\352\300\375Y?\202\017\375"
+	.ascii	"\017\343\206q\253\016\\E\250\024\210\244\b\316\037\301\311\355"
+	.ascii	"C0nK@\274\005\217(Y\332\302y\350e\370e\b7\3542|\343\273\362\341"
+	.ascii	"\332\360\312\220-\004\325\326\201A\2307"
+	.string	"\341\231\032\335\027\234w\2164\211\331\303y\250e\310E\370\366dW\205\363\207[\266\312tA\301\031\253\005\307\242\232\322p\3760K\372'\346\255\006\316\037\246\375\027n"
+	.ascii	"\217H\030\316C,z\206\bh.\020\256\261\322&\t\316C,\277\312\207"
+	.ascii	"\225\206T\024x\nB\345\006\347!\017\241\017\3210\023,rr8_\004"
+	.ascii	"-\372\037\232\r\315\364\033\0240\354\215\025\307\266\243\250"
+	.ascii	"F\344$B\224\264\341|\021\276t|\210542<r\317\206:\206V\204\230"
+	.ascii	"\366\022\330\bcvh\033co\250p&\303Z\366\336\220\301\371\"p\351"
+	.ascii	"\337\261\254\341\026\036\327Pkl\315\006J\206Kn\335V\t_c\220\f"
+	.ascii	"\265z\2242\354md(e\b\035V\031N\031\212\r\251\334\263\341\330"
+	.ascii	"\220\311\207F\206G\0364\034\033&\271\213\216\r\237C\260[G\205"
+	.ascii	"a7qq\023\335{\017m\024\251\023\322\223\263\336\346\003\223\023"
+	.ascii	"\nT\332D\207Q\206a\367l\b\366 \350\336X\206`\303&\303\257\017"
+	.ascii	"LN{\251\b\bb\240\244\304y\020\301\243g\346.\310\232\377\341\027"
+	.ascii	"\224\036-P\255=\234\207O\362\250|\210PC\377C'\367l\350\225\247"
+	.ascii	"\371\300\332\350\264\371/$~A\202E\207\363E\230\241/\302\326\017"
+	.ascii	"ao\330"
+	.string	"\245\317D\205\320\341\374\020\332\350\207\240F?\0043\372!\210\321\017\341\213\376\207[C-\26388tZ\027\315n\356\211\t\347\207\360\2461\364\002\255!\356\317:\0342$2,\362\013}\244\260e\251\341\374\020\324\364\207W\377\205, \031\243\206s\276\207[\207B>\264\372\205X\216\311\023\007\316\017\341\212\3760\310\260\352\027\366\334-I#\303\371!P\321\037\002Q\013\204\363\003\347\341\017=#\204\347\005C!\\\206\004\331\361\341\217\177\310\0033\r\251^\b\374\353\303y85\364\361!\325\260\307\220\212\203\253\275\227\206T>u\366^\362\271W\202{%\310R\260\230dY\363CH\242y\356\317z\267\b}\270\203H\347%Z\005\347\2070\245\177\303\356\320\306\320\3060\252\003({U#T\263\274\257)\250\235\253\257\251h\006\222\345\214\031\316\303\034C\0348\325\222R\203\205\363\360i%\003\322\304\206\363Cp\032\336"
+	.string	"\341\215\036\316\030\316\030:\t\3734\320\331\261\332\021\007\212\363?\244\361\241\323\332N\226)\201`\016\327\243Ml\016\347\203\0207l\0326\t\315h\220\363\206FC\207\034\316\007!M\017\227\206K\032\360\356\255a\357m/\020J\024\316\007\301k\270\207[hF\303\036\223\335\024\2723\234\017B\025 \240\006\024\362i\230\333sr\366\006\016\347\203\320\244\177a\035a\2357\2576\372\027\312Q\347\204s\356\232\336M\366^B\342\323\003\353\203/\372\037T\321\277\260O\330w\243\330}\220D_\270w\205|| 4\371"
+	.ascii	"\310\2339\241\336}+\201io\253-\237\036v\0370\351\017`\215\276"
+	.ascii	"\220\315\025\346\t\335\250p%\324\330\273H\227O\21778\375\001"
+	.ascii	"P\321\277*\334*T#T#\304\343#\362\355\021\347\320\241C\023\256"
+	.ascii	"\271\020\017\016\007T\233.\234\007\260D\377\3024\3024m{Yt~\003"
+	.ascii	"\250\022\222\021\n\311\b\315\b\313\b\313\b\315h%\rc\336\262\350"
+	.ascii	"\300\350h\314\310\262\273\320L\346b\323\003\357\276\331\320\361"
+	.ascii	"f\205\363\007 C\337\2034c\306\004\265|x\241\241\372\023\203\363"
+	.ascii	"=\350\242\177\341\234pn\325\241\276\275\201%I2\004\347{P\246"
+	.ascii	"\345\344\210=$\330\302\345\205\363=\020\323\177\272&]\323\365"
+	.ascii	"\274\020\214\020L\220\250\007^\356\231\320\213Z\205\213l\241"
+	.ascii	"\031/\250\250\007T\372O\331\244l\274\336\336t\323\033\326\022"
+	.ascii	"-\036\330hkc\312\242\363;\323\003\316\f\347{\260\365\332Zp\r"
+	.ascii	"\336{\357g\020\314\233\233(\006#cC\363\266l\031\362\334TT!z\302"
+	.ascii	"4mq\301\371\035\304i5\265`\223\360\rH\037\023 \032\234\337\001"
+	.ascii	"\232\276\020\355\n"
+	.string	"\323\322\264|E\221951\262\367\022\005=u\252\314|\340|\241\331\025^\271\322\246\006\302\324\234\253 z\3034!P\1778_Hv\205e\302\262\252\266,\321\035E5b\207.\312K\035\316\357@\006\026\236\025h\001\002\003\341\354\224a\022\206\206\263PL(&l[{n*\252\020;c\334\2105a!\264\307\236\23218\013\251h$y\321>\234\205S\316%\f\027\276\0368\013\3078`\243\205O\204O\204aw\3578\303\036\007\310\333\321E\bvaX\036\217\223-T\002q>\2370J\230\031Y;\204Q\204_US\236OOhp\262\364\204P\324}\261\356\246\314\340|\016\272\350\013\237W\350D\350\004\312\226\347\230\227] \316\347\240\355Jg\273=\325\204\363\205]W\310\204\311\327r\230(\252\021<Ng\272\252\340|\016\270\b\221\\\241\022%^A44\270\250p>\007g\\\\k\230hi\251\341"
+	.ascii	"\352\310\221\273<,\2541o\372\027\022\021\022\t{Z\321\277p\210"
+	.ascii	"p\210\230\335\006H\364/\024\362{&\024\222\343\250M{ik\025\223"
+	.ascii	"C\212\030\277/\267\037Ep\376\006P\372\027\006\021\006\361\322"
+	.ascii	"\241\244g\004\347\233\240\243/\364q\205?\204?\312\32222\370\340"
+	.ascii	"p\276\t=\341\324T\223]\225g\034\017\0369:\214\022\242\225Q1Q"
+	.ascii	"\246CG\216\206\300\2607\326\224\347\216\242\032\321\303'\304"
+	.ascii	"\315\020\234oBK\377\302(aT\216\252N{K\201\210R6\367\314\232\201"
+	.ascii	"\363M<\345\310\021\\\023\374\342\023\245\207\0165\234/\224\367"
+	.ascii	"\3644\205I\316\206\215\373v\241\033j\025\333\313\242\003#\023"
+	.ascii	":\t\235\252V1\273&Z8C8#\250\265N!A\365\303\016\347\013a\351_"
+	.ascii	"\330$lb\022\272!\334\302-\\\202\202\025\346\006\235\026\316\302"
+	.ascii	"\245\031Z\314\232\204\221ma%\341\373\373\323\200@^U!\206`^ei"
+	.ascii	"p\326\200M\274\260\236p\276\006s\232\216\246\023\\\203a3\341"
+	.ascii	"Q=7UU\210\365O\315\030\033\316\327\340\212\226\243\345\250m\036"
+	.ascii	"\204SP\270\312p\276\006\317\276\276\213\026\264\225\364$h\363"
+	.ascii	"\322 \310\236\346\333[\273\340\300Y\273z\242\f\271\244,1\202"
+	.ascii	"\363K\314\321/\341\246\177\235w\317t\236~s\245\366^\242\252`"
+	.ascii	"\314\216`\222\034^\344\340\374\346\327nt4\317]\236\036u\324\370"
+	.ascii	"\341\314!\352\002\255\270\314\375Y_BJ\032\315&\215\306\273\273"
+	.ascii	"\323xD!\267\306\226\225\2645\327xf\350\330X\303Y\253I\242_\242"
+	.ascii	"\207\235>c\267b1cf\305\3227\204\202\357\306\262\346p~\211\255"
+	.ascii	"O\302\314\234&3\247\353\350\350t]\220\275l\367\245\244k\314u"
+	.ascii	"\035\2113}\022C\344\3444\022\rQ\bhS#Jb\206\376u\030\035\246-"
+	.ascii	"\203\250\376\365\027\375\005\307S4N\377\032N\303\221\320\206"
+	.ascii	"\225A\230\232nS\323o\332\355\372-o\016\211\227\031\316\347\303"
+	.ascii	"vU\274\250\262p\326Z\264\026\315vw\324\352\243lmk\033B\266v\315"
+	.ascii	"\006\250\347c\tg\315\005\333I\361\333z\202\263\336r\321\206x"
+	.ascii	"n\344\334\320\376\013U\2548l\326p~\006U\372\030\370\351_\247"
+	.ascii	"\351\264\2714hh\\\330\316\316\266D1\260RV\266F\255Q\302\034I"
+	.ascii	"\264D1\350\002\003\323d\032\242\020\200\247\026%\203\016g\344"
+	.ascii	"\325\370\302\271J\006\366\352\\\341|\f\254\364\177=\246\247\334"
+	.ascii	"3MEK\321Tt\230*\226\222E\tm$\221\022\325T\264\230\346\272uX\366"
+	.ascii	"\326!\024\305+\213\316"
+	.ascii	"\317'H\2200\2645\037\003)}\f\226\364G\370\351\217\300{>\365W"
+	.ascii	"X\221\036@5r[C\271\376Z;\253s\204\r\316\272\211~\262\263\203"
+	.ascii	"\210\337\232~\242\275\232t\345\360\241J\341\023\313cr\222\361"
+	.ascii	"p\233\034n\352\340<B\314\222%X#\260(Q\222\321@Q{\210\315X\203"
+	.ascii	"\363G\200\351_\357\270gz\207F\"$!l\207F\362k\036\272\207\346"
+	.ascii	"\312\0223\207\ng\034[\220`E\3019\b\230\350\336\233*\b\233\017"
+	.ascii	"*a\242@\300<\255\350\302D\205|\201\211Ny\t\023\375!\306\266\265"
+	.ascii	"\021]Dgi-MD\037\321[z\210\306\272g"
+	.string	"\372J\337\320W\272*\210\267\324G\205H\305\346t\267!\177\004\024\375\021N\364G0\321\037\241D\177\004\227\376\210,\375\021X\372#\256\364G\b\321k\335\005Z\317\346\376\254\037\241C\377\277\256\361\032Z\352Z\331P\037\242\350\350\243\342\2677U\210\2354\3216i\242\256\245\326v\234\226\370\246\340\254mh(\25445SP:G\233\221\255%\234q\324\t\242\227\006\347\217`\322\372I\337H\237\024\221R\207\363E\300\321\"\312\350_\323\3204\326\250\324i/a\005 \214I\004\233V\3222\264\222n\322KzI7\3357\273,:0\037\036K\272\0025\323uS\027\237\037\2228: :\356p\276\b2}\021I\374\202\177~\301\300u\357\013\275\202\212\002|00('('XG+y\360\301\244\312\240\002sF\347\301:yY\234D\265\30198G]K\013\304\302\364\367_\310\003\345\272A\004\347\213\200\322\027"
+	.string	"\2338q~\210\321\177\020N\020\016\325\223\213\236\336Y\215h\025\375\007\243\301(\266[\241m\034\261!\200g^\236\002\230\004\020D?\210w3`\006\024\273\273\013\256Y\337x\005\325<\270\006\217\231\231\301!\200 \031\210(X\3047wsrp~\210\250\0313Y.[\331JA)8\262\342\300\366\246\032\021,2U'\b\316\017\261\026,\023,\023l\232+\013\361UW'F\213\216\356k7\212\003\r5\272h\210\033\372\017\212\021s\3214\bf\271!\027\r\261\365\037\374r\317\202_\202q\252\323\336:\204\304\260\202q\177\020L0\214*\206\343\352\322l\341|\241\027h\r\272?\353/\210\263\266\026\204\353\t\323\345A8\"\222)j\252p\016\276\035\356J\031\034\316A\267`\033\033\232-[\326'\r\373\326\270\362\032\022\275"
+	.ascii	"\213\232Z\235\237\327V\364\202\257\264\264\325\206\206}k<\275"
+	.ascii	"\204D/8\202\206Vv\201\217)S\202go{Yt~A\263"
+	.string	"\007\317\362z\212\260Q\242\205s\260,\310\343\211\311\232.8\007\255\254l\234\250\251r\3029H\026\024\273\322\005\n\316Ah\006n@\305\3019X%H\345\002&1\2610\266>\375\007\303\202a^X\026\264\t:\t:\tF\321U\230\262\350\300\276\036\214\262v\311\270\360p\3029\b\345p[\332\202P\341\034|\242\306\371\260\315\3111\3039\350e\201\031\375\340\222\033|\006\237a{\026t\321_\273\270i\357%\n|\216L\271\013v\375\351\222\224\311=\013v\2559B\\m\035\037\314I\245\321\333)\022f\311\f\316\267\200L\377A\256\337\263 W0\t\nW{\007\210&dZ^2\235\234\034h8\007\221\030\251\253R\303\371\0264\321\267\240*++\250%d(dO\253\314\223%Yp\276\0053\214\030Ym\b\367.\242d\345+RD\205\023\356]\204\213\370\366fwu\225D\213\225\325\327P\270O/$\317"
+	.string	"\204\351?X\025\254\202\262#"
+	.ascii	"G\364\357\333\r\002\001r\337\202\266\322\336\bP\260\002 EEu\321"
+	.ascii	"\202\256\224\364$\210\362\211\363%$\t\316\017\200\214`\216`\216"
+	.ascii	"\340\024q\314\216,:\277`\217\007\247\362\222\314\330\222\003"
+	.ascii	"\347\340\216 \217\377\302\235\250\036 \036\316\3041Z\354r\340"
+	.ascii	"\034\324q8\355\007\027l\322\205\261EZA\003\361F$\330#d\313<\032"
+	.ascii	"\022\266\306e\362\204e\213#c\323\270b\003\221\022il\016\221\224"
+	.ascii	"l\333\236H\221\302\212\226-\362p#\022ls9Tb\bH\005'\022\350\004"
+	.ascii	"\333\032\213\214\314es\005\322\021r\003\322\0212\303\215H$5\215"
+	.ascii	"G%\322\322\204%\223\203\223\215q\202U\"\223L\026\036\204NH\261"
+	.ascii	"\341F$\212\224\310f\353\344\220L\")\225Ke\260-\262/ \235k\022"
+	.ascii	"s\350\210=Z\235M\244qE2y\242E\242`\200\005\244\320\002\305\211"
+	.ascii	"\242\001R$`\205\"\212\026\212,R\310p\302\n\025\200\200NX\241"
+	.ascii	"\302O\213T\246\240D\032U\360\264He\n\030\024\320\262*\210|\222"
+	.ascii	"\214I6E\221\022i\201!c\263\005\320Qitq4\262)\210z\202>?\255\223"
+	.ascii	"m\215*,\240e\213:\300X&\211\232\354\213\004,\233IE\033\330\""
+	.ascii	"\245\261\205\030\310\025\232\313v\271B\313\026a`[c\013>7\"1\324"
+	.ascii	",1D\344tq\"I\304\246\030j\241e\2134\334\210\2043\2314\0169[\244"
+	.ascii	"\213\022H\312\242\fb )\221\311\f8\360\240\350\301\0071J\260G"
+	.ascii	"\244\344\220\022Y\242\351D*Q\002\306\262i\324.\225A\"#\233\314"
+	.ascii	"\255S\271\034R\211Z%\262\231\\\221L\023E\246\261\tC3\217\214"
+	.ascii	"M\rF\255\361(\306\262\311d\032\213\316\345\220\022\351\344q\262"
+	.ascii	"GF\026\216H\246Nb.Q\364h"
+	.string	"\270\2615\036[\326\331\323\302C\022s\211\002\250\275\021\211\"f\211\"\346\220\022\211\250$\302\252\263X\304\334i\213\312\"\246\252,b\246\354\013Hgv:\331\346\361h\f&1\227C\271\3312\323#\253,B&\215\301#\353D\312\312%\262\035b\235\3017\213EL\022<M\243\321PNj\266Nd\021\333BqC[\344a\032W\210\301\036\225),[8\215\310\344\211\241&\207\226UqD29`@2\201\330\343r\205\016\354\013\034\200\204H\260\255\261\205e3IE\207\025?\0308t@\202m\215\355\n\026i\310\311\266\340d\026\005m\360\200D\213\266ilY\260\307\345\n\034\224EH\026\0318@\320\"\225)\034\221L\r\030\202/\224)\374\364\360\024\205\031~Z\266H\303\021Y\244D&\215C\316\"\023\001E#\220S\2114\252H\221\302\212e\223=\321:\221*p4\006\265lQ\007\023\026\300\032X"
+	.string	"\037\225\306\243\243\345P\253O"
+	.string	"\3010:"
+	.string	""
+	.ascii	"\311\344\262\005\020\016`\210\321,\021\243\371cl\215)\206\232"
+	.ascii	"\353O\273<\352\016-\021\253\002\207\326\250\b\331\302\003-\021"
+	.ascii	"\253\002\323h\344t\340h\331<\201m\215I\244\241\244q\b\202#\333"
+	.ascii	"\032_\260I\003h8\341\310:\235\313&\n\247\321\310\303\221m\331"
+	.ascii	"$\363h\211\302\351sD2y\216l\322\205Qi\200\027\310v\350\304\211"
+	.ascii	"\2433\001G$\263C\n\034\212\312\023\212\230@\033@\264pA\222\261"
+	.ascii	"\331<\341\354\220\304\004\332\320\262E\017D\340\302\021\311\f"
+	.ascii	"\200\tAB\355\n\240\"%\322\250].\217X\f5\201\216\354\013\310\244"
+	.ascii	"\021\331\"\225)\200\370@\304T\201}\201l\215/\220M6\005\005\030"
+	.ascii	"8\360(O0\261\241\335A*\366\bwz\224'\374$\223HJ\037\023IX\003"
+	.ascii	"\027X\310\0056\341\002\013\031\261\t#\026\212\201M\304\300BI"
+	.ascii	"x\330:\213=\031\214\206\332%\013=-R\231\302\021\311\004z@\003"
+	.ascii	"\022m\323\310$\341l\223HF\"6\305\021\271\"\001\023(a,S\3700"
+	.string	"]8B6[\034!\r\r\235 \"r:{^\260M\346\206\023Np\"-\225\313\246\321\2202\211\005\213\023\031nD\242\311\306@\036\225P\217\310\245\023I\211dqd_\260H\243!c\020\313Lj\321\363"
+	.string	"\021S\005\030\302\030\306$\333\202\017r\210M\001\001\333\032[p\272\300\303&\217J\243\321\217\022iTAT\"\215*\204G$S\373l`\301\266\306#\023\t\310\351B\222\261\005\006\247\013\355\211#\233\"\003\207e3I\205\206\024\354q\271\202\022\371S\244D\0365\215\304\226eqT\236h\207\330\226=zX\"[c\013\315e;d<A\203\223e\233El\n\024\0332\260\307\345\n\006h\223\310\026@Fm\221\222m\266,\222\354\013V\005\024\206\222\306\241 \365F$\212\220\\\260\307\022\307$\022\311\205\007\366\270\\A\350D\3068Q\204\344\202Mq\204l\241B\220\022iT\341\003\344D\3068a\334\240oDb\250\310\036![%R\263\304\020"
+	.string	"\330\343r\005\237\026\313\346\320\t\f\355\362\250\235F\244\tL\02748\215H\023\2240\226)\210\210\234\316\rEJ$\323h\304\202}ad\300\tA)X`h\251\302\206\0266\030 )\311d\032w\224H\026DckLqD2\203-\3604\227\315\246\001\224'\216\232l\233B\007\247\223\035\0322\256\022\330"
+	.ascii	"\002B\023\220\300\006\020\320`\002\303\346\262\035b\027\300\356"
+	.ascii	"$\331\005\3040\036\0211h@\202\205\023i\211|\3016\231\032Z\344"
+	.ascii	"\021R\205\f\254\323h\264\342\204\rICJ\026\351\002l\363\204#\222"
+	.ascii	"\271\323\342\210\217\310\025\031Z\264,\213#\222\271\301YdL\236"
+	.ascii	"\360s#\022\315e\213T.\217JH\320\"Q\310\3206\333\025\312\023\222"
+	.ascii	"\222L\346\t\fm\260-\032\333$\233\202=B\266\304\266\350l"
+	.string	"\262I$\003\264\255\021\250]6\223\212\362\021\333:\223X8\320jh\262-{\264l\262@/\030\025\211\230\311!\3334\30286\215M'Q\321\250\biT\034\0322\356\264m\221\210=>\340\034B\036\031\225I)\200\226M\366\001CC\306\240\t\022G\004\344\rH \021\220\233l2\271l\266<\034\220`\" \377\254\360\371\020\262\311*\331\"}\016<\310\300\203\017b\004\007@\002\204\017\204\212lkL2\217\330\266\330\262N\266Y\004b\213\307\024b,]\004U\200at\300Q\223m\231>l\221e&\2658\032\221.\200t\241\201\210\251\002\2334\016\2618\262,\223E[t\272\300\036![\335\"\223H\027\306\226\305\021\311\354\320*\221ik\\&\211T\266\330\202\221\323\330DqD25\260E\244\326\310\242H\211\204\201\201x\264T\262\307\242\323\311\016-\233\314\342\021\311\314\240\\\"[%\373\202m2\035"
+	.string	"\301\266\306\027\310v\310\310\036\213DDK\326\002\306\266\230d\204aT\"5)h?D\342\210d\022!"
+	.string	";\213(\216H&\006&\0020\022\001\370\210"
+	.ascii	"\334:\215H\023\222\232-{t\224\3444\3628\213lklY\024)\221\f\340"
+	.ascii	"`lY\243V5\026\261GKU\250}\222H\307\345\n\311\344\262\205 \030"
+	.ascii	"F\007$\215\310V\3116Y\"\"d\212\022\312\345\321\321r\350\004\241"
+	.ascii	"\226Id[c\353T-p[gQ\267l\033tD2w^0\202aL\352y\301\250\210\341"
+	.ascii	"\005#\243\241v\251l\235E\242#\222\271\036\221\314\264U\"\227"
+	.ascii	"+\230HG%\222\001\035\2100\214\016@bqD2{\224\310\025\332\023G"
+	.ascii	"$\023\003\373\202M\372\264C,\021\321\017{\\\036\025\333&\313"
+	.ascii	"\214\301\026\333$\262-*\227/ \233K\243 \366\270\\!\251E\2760"
+	.ascii	"6U [\245\321\247\005\007%\322\250\242\271<\261\241\005\030\306"
+	.ascii	"\244\fIvh\350\004\333\032\233=\307\"\f\307\344\322\310\3116\215"
+	.ascii	"\332b\253D.\231-\353\fb\217\220\3550\311\230d\217\304\rlkl\026"
+	.ascii	"\177\234J\226y\264DqD\256P.\221-\322\25146[\234pdY\" \030\306"
+	.ascii	"\244\242\317\360\005\243\242\211\fIM\366\305r\210m\026\215\234"
+	.ascii	"\306\346PO"
+	.string	"O\353\\.]\024[\240v\331sdY\242b\3334\03693\260\314\244\026\003\222\030\344D\3060\026\213\220\\\260\307\016J\244\261(\203\363\250x4\262FF\013,\227\311b\223U\"\215\315\266\270l\016\031=(\221\306\"\f\031\232\313f\223\355@D\264l\221\206\212CE\247\013\243\006\226\231\324\026M4\3316\211$\322\360\202QQ\211|\301\350\250\311\266\307\"\0213YT&\0357\260\307\345\nl\262m\227M\243\026\037Z\344\021R\0056Y\244<\321A\2114\252\310\320\262N\266\205&[T\204l\266\200\261L&O$\227\315V\271Da4\244D2&#(\262N$\r1\214I\266yd[c\263\210m\225\310\r/ \233FV\211T\241u\"5\215\332\037U\2114\026\r\331!\245\361\305\321XT\"\217\212G\236\026y\204L\026\233\313vy\244\241U\"-\207\212\311$;\264l\221\214\035nD\302\371"
+	.ascii	"O{#\022-\022\263EZ\026\217`0K8\233\354\013d\363\b\242-\006\235"
+	.string	"E\306\026K\344\372\202M\341L\"\255h\262\255\222E\201\201m\215-\034\301X\261\363\202=\246N\247\221\tc\231,j(\036\331\243\246Q\211TD6\333\fm\323\330:\213EJ\344\261i\204\321\\\022\025A\264J\244\345\021\021\322\310Yd\235F#f\261H\211d2\215I\242\r-\353$\"Z\026\225\310\"dsY,R\"ah`\235F\027?\316b\021{\314\320\0161\213J\344\321\213\342\221e\231\316\r\316\243bO\222yd,\3060\036\025\227/\232\254\363\207=\"\265He\221\361\250'H\211\214a<*^\200m\022\025\223\254Ri4\032z \006{T\"\213\036nD\002\002g\261\bI\244\\\3060*\221G\032`\264F\027/8\264J\326\3116\231\355R\331\032]\274\3600\364\"\311\303\0265\260\305\r\354P\023i\311\242\311\266\354\n\255\222m6\221\2064$\265\310!#\323\350\302\2475\232\260"
+	.string	"\326\211\304\343l\233l\362\004\n\326\211\264\201-2\266Jv\250\311\256(R\"\225M#\003\224Kd\313<Br*\227C\037\234H'\333d[g\222Qkt\361\242\247-z Tdl\223\313\027\311$;\224L\"\021\265F\027/~Z%\322\022E2\311\242Hj\262mk4\201\035j.\211\200^\360\034\227\310&\273\202\210\251Bkt\201\344i\211\330c\261\355p#\022\312%\26256\331$;4d\234\300\211Tt\036!\233-\214\206Z\344\212\243\362D2\271l\376\30006\323\033\221@:B&\223\313f6\032j\221L\265-z \324*\221A\030\306\244\324\311\"%\215/\326\366F$\230\305\020Lc\222\350\203\263\310&\221D\313\346\212&\3332\227F-R\331\\nP\302X\036\177X\013,\233\255\223\211\304&\213\224F\342\3218\264s\364I\032]\b\231M#\f\236dr\331\324"
+	.ascii	"\303\230TLj\221C\313&K\224\241\2714\032R\032\211F\345\322\311"
+	.ascii	"6{\206\224,r\310\3116\231>K\243$\313t\262\354\321xD2:w\224Hc"
+	.ascii	"Q\221\210\310\351\024\256\255\222E\016!\211\210\330\345P\221"
+	.ascii	"=\"\223E\305!d\3534&\331e\2235B\320\336(\350\b\211E\352,\032"
+	.ascii	"[c\n'2\306\211#\222\311\263\342\246"
+	.ascii	"pS\334\023\356\215H,\233IE%\234\315\245S\311:\035\370\222\311"
+	.ascii	"6K\264\313e\263\004\321Y\\6\223\212\326\266hb\203V\211D\322\354"
+	.ascii	"\021\262e.\227*\264lQ\323\330\366\020\241Hqb\331L*\322\311\345"
+	.ascii	"\322\204\242\332\026?h\225H\244\340\205\204P\200p\201\005\025"
+	.ascii	"z\210\304\021\311,\321\032\025!\223D%\224H\343Q\211\241\246\263"
+	.ascii	"\004\211\016\317\222eG\213\211\2639\033p\324\276\243E\305n\\"
+	.ascii	"\201jPh\321\377N\032QJn\303\273\222\262S\266S\266\203f\245\301"
+	.ascii	"\234T\032\275\035\264\235+s]o\212\\9s\273\212\232[qh\253\257"
+	.ascii	"<\277\035\263\264+3\341\301d\r\347\243\200\352\177\307\312\016"
+	.ascii	"\231\327\2149l8o\355\341\b\003%.\311W\312\314\b\253B$\322\203"
+	.ascii	"U\244\016\r\025-\245\345\204\316\n\347\rTQr\214\t\315`%>\332"
+	.ascii	"\f\021\233\332\021\222\003\316\234\024!TSy3\305K\030\\\276\001"
+	.ascii	"\005\312\030\2603a\235/E\250D\341\022lB\223\325\344ku\243\246"
+	.ascii	"M\211\261\002%\030\205\207\016\026\326~\002\267\002\352\235\265"
+	.ascii	"y\005\327\030\241\242\223\346$\250\225\366c\013\253\311\n\315"
+	.ascii	"Q\266\242\304yj\262\236h_\017.L4\222\247\025#:\226\020\347\344"
+	.ascii	"\230\021\001\322\245\241k~d\276\224h\256,\347\357\313W\222`\\"
+	.ascii	"\025\032vkH\326.\260\266\2526\\\353\330\227+H\334\354li@\023"
+	.ascii	"\364\236\216h\021\245|\356\256\216<e\251pb\254\324\361\202\363"
+	.ascii	"\016\221\035\";FnT\324^\006c<\304\252\374\260\276c\3447\321\301"
+	.ascii	"jc\215\026\\\034\316;ET\2702\200]}(\252v\206d1Ln7p\236c\007\325"
+	.ascii	"g\345$\302/\313\n\316;Av\252\276#\344;B\360\216\22040p\235b\006"
+	.ascii	"m\005\242\361\204{9\250\310\375X\253\262\031\0339\177T\253\f"
+	.ascii	"\027\260L\361\342c}\302Lr0\341\233Zm(\2411K\202\363\016\217k"
+	.ascii	"\346\214\230\317\016\255%-\350\023404:\206\177\301+~\\tH\351"
+	.ascii	"/\037-D\240\316D\021\235,\240\361\304\006\025L\022\f$\213\202"
+	.ascii	"\223\203x\203\270\004\352&c\007\307:\265\203\304I4\314\316\323"
+	.ascii	":\206\312\t\336\2155+(e\214\022\226\r\342\327\033)q\224\340\274"
+	.ascii	"3cg\306\216\323\215J\325\f\261\001\007l\207\306w\234\316p\335"
+	.ascii	"u\241\240\241\241c{C{\326/%4\332v\232\260\335\352C\006\035\265"
+	.ascii	"\035\246`\023\017\025,Tbv\226\206n2\016>5_;JC\247<\253&fv\366"
+	.ascii	"\212%-\360\r\033\234\211\200\301\2614\031Qp\316Lq;\252\376\326"
+	.ascii	"\034a:\352|\020\373\210}D:\327\260\324E\224\002e"
+	.string	"7\346\267\251x\204\370\211sN\244\263\366U\326\246\rg\242\234\257\221\035i+\2033\321\257\216\376\211q\206j\202fUW\234\360\325\301\321o*\234\232\322\326^\223\025\2349~zk\024\230\037SI\210o\210[e\366\350\234\211\256p^K`\201n\256\234N\313\253\273\221\027\fdsb\033\275)\"Ap&\256!\342EyfQ\3636y^l\334\250\340L\274#\252\331z\246\275\341\034\215\362{\342\267&\rQ-\230C\214N\026\032\375\006C9\013\203\346\214\332\026\326f\f\321\314\252c\307\226\327\025\273!\033U`\0310\234\211d\210d\202MVPy~~9\214\234\f<\234oB\2311c4`\320\225\022\337\352\306\343\013\314o\311\234\2528\234o\302W\2300\304\271!\271\206\225%vD1'\316\251\320\300: 8\023\343\210r\271\f\226h\031Q\316\311\217\0362\266\020\371\362e\203\2724``D\346"
+	.string	"\2378\337\004\250\2677\"\334\265\262\241\202\342\360`\342\346W\247\225\245F\227\023\341\306\340\242r\342\332\332\2107\202\364\036s\242%\352\004\206\313\031\234\177\302\214\270F\\\033:\335)\250<?0!I\344\306p\376\t$\304-\304-K}T\374\210_oi\332p\376\211\036c'R\031#\252\245v\027\272\251\256\224\336\200\020\205\207V\035\277\355D\025\242\347\206\233\"G\316NT;1\213\211\016\336F\231u\345\n\316\304\264_\256\275+N8\237\210F\304\362\013\205M\002\214\277\2504d\021\030\006$\2520\b3-\304\034r\312L\021m\243"
+	.string	"\243\025"
+	.string	""
+	.string	"X8\030\017I\245y\225\017\024\200\rR\3260\371\224:Z\224(dH\231\021\021"
+	.string	""
+	.string	""
+	.string	"\220"
+	.ascii	"\001\035\031\200\fA\213\264\327<uV\300:\260t.\"\371\\\305\017"
+	.ascii	"\245\377\236\026\361\006\315rFus\373;d\215e\262\314\022\244\005"
+	.ascii	"JMu\205\316\213\021q\364t\321"
+	.string	"\036(\306\035Z\367\226*R\260\312\2006.\364u\250\005~\020\274U`\325\266j\330V9\234\f\201\366v\031\013p\270\302\242\267\203x\031!\027\035\205N\223\"\227r\307\236\233x:7\261<o-(t\267c\004\233c\2349\302J\344\365\255_\272,0\271!\034\206\005v\032\026^[\245\251\317\222\355c\374\305^\240\031\363\t\013\n\376\016,j\203\364\027/,\274\272\271\023A;&8Q\344\253\\\n9Y\275\001\016\206\353\373\213\360(X\230\231=\001B\343\252\037\361\177\263\322\222\320+\265\367M26d8\221\303\t%\201\207S\272\300\231d\347\0302;\205\033\260\002\253Q!\334\326\230\\\374!\277h\265\235\373\350&\216\202D\331d\204z\261\201\032\374\016\330\bQ\304>\033\330\027\025\311\320%\266\220\352\371\320VG\371\371\026*\230\370B\206y\362\347\216\275k\210\3408J\177\214\220T\220\364W\030a\230"
+	.string	"\263\372\310\205\006HI\340q\3259\234W\213\003\323\231\363\272\347a\215\263\207'\272N\341\340\0336\no!\251\313|\306l\262\341rFaZ2*1Q\306s\221\342\353\013\254\233\365u\257&\275\356\346h\206G}\030D\233y\365\363\233HE|:$J\262\333,[\255\017\266\2032\244\252\372c;\rk\260\317\273\352\375\232\310$\235\351\232d\371bu\336\257C\315%\303-\210\020-\275[\321\206\r\031\226\226\210\261_yd6\347\262 \023\331yp\241\200P|K\215\211\274(\227\036\322\267\nj&\031\031\200\231\306P\237\240\fdd\316+\333\034\212\035%\330\344\031\017\314Yb\372\016^\026\275\2242\233\245;\213\325\037\f\304D\272\310\376\244\371\253\353\302\265\366\264\217b\231\017\317\203\024\240M\007\235\022\025\036;\3046z\3154<\376\350"
+	.string	"\343\007\322g\376u\211$\246\036\3631d\"\222~jb\236\332D\002\1779\336\313\216"
+	.ascii	"GQ\360\2453\353\346\213\b\376\210\031\254=*\347\315\276V\342"
+	.ascii	"\264\003\341\244\232\363\243\341[B\2607\034\206\017M.zJ\274\t"
+	.ascii	"\031\244E!y\035\313+\325\024\223\3701\364V-Q{~\356\277\264\274"
+	.ascii	"\177\212F\374\331\350\250\304\264\017\221C\274\332\312\225\336"
+	.ascii	"\213\365\022\363YdI\022Ps\221f*8k\324\n239\034A)\031\355\316"
+	.ascii	"\223*bJ\021et\361\255\277\357\206\202\007\365 \"\332\001-\210"
+	.ascii	"\301\353\326\300k\203\247\356\023\f\037\240\r\243\256\355\213"
+	.ascii	"v\203,,`\f\t\356\304M)L\213\ne\377s\321\t\322\021g\311,\034k"
+	.ascii	"\033y\251y c\310i\264\217b\353\353\245}\376B\3723\237m\t\203"
+	.ascii	"\234\\\003\032\2432G/Y@\314\343\206\264\260\366\b\001\261\225"
+	.ascii	"\007\247q\275g~f\026\320\222\342\020\354\233\2619\tl\n\201\201"
+	.ascii	"U~R"
+	.ascii	"b\273\373f\253\327#\371\364\361\363A\033W\\\300UO\220\350%\372"
+	.ascii	"J\013\335\221\r^\025\343\177;\025R~\243\327\300cN\355g\361i\327"
+	.ascii	";58\223\311\236$\244E^\352\3708\324\277\203P@qc\b\t\314\326\f"
+	.ascii	"\275\225\312l\246m\336J\325@\020wCS\371\230\344\243\330^\307"
+	.ascii	"R(\202E\302\310\357\361[n\302c\005\357\213\262\3102D\360\332"
+	.ascii	"\342\215od\350\224\323A('\335\340\r\310\373\034\302Y)\017\027"
+	.ascii	"M|\204\244\331]D\225@bo\200\350\254 \274\313\373\214\313\371"
+	.ascii	"\315\024\266\352AJ$\334\t"
+	.string	"$\244\211\212T\233\r'\271\271\247\251\351\034\017\"7\373\207ll\367\224\023\025\211`uC\327V\311\303\375\324\212eC\314\355Gc\355)\030\236 Zg\317[\007\205I\335\001\222\317\013\277\233\212\276\211U#IlA;\031\037\305\272\356\f<\023@&Iq\223\017]\315\212\b,\032\301I\345B\203>\3323:\231XL\006Z\324\377v\316\250\340j\341\007k\342E\241\220\237\360\022\322\276\031\226\034\213-\3709\312\363\001\352o\362Mn\377\342^ A\207\200\273\363\200\224G9xF\341M{_?\354|Ax\311\2039\370\221\3401\342RF\362\005\267\327xn>\306S\373w\004\323Y\307\300x\277\202^\0363\306o\200\035\242\260\324\211rN\303\rni\206:\277\355\306Gi\332\356l\266\f\227\3068\332\002\205\354\264\342\023\367\322Y.\024^\272\030\206\320\242\360:\210\226WJh\323\330g=\350\017\246\304"
+	.string	"\200u\344\022\357\361\303\"\322\237\253\025\220$\376.YM\253\234O\327k\250\223\206\273h\204\212x\263x\354\002\362w\211%\353-\377Q\334#\261m\034&\227\023\20310q\344 \f-\007\346\020\374\006\201\032\231\006w\035\221h\210n\304r"
+	.string	"\373\026\332\326Fb\025\203\027Y*\350\330\3468P-KD\222\037w\032\024\316\307\326\307\312`\243\006\321\026\021\300\030\016-\0325$}"
+	.string	"F\347\016\263)\322\272K4\356'\370EP\366\316;7\261\253\313\355=\307\220\034\0355=\017\376\323d\rU\023\322\343\322\2151p\211\325\242\022Fp\226\002\3317\037e\266\265\240&\"\004\211\322t\312\361\202\204}8\344p\201H\326\005X}\360Qr.\210\0339\n\302\214\335J\263\n\326\260\334@h\201\330\226\225\332\030\324Q\376d\373G\270_\013\034\007\t\256\235,\225Q\326\373\033`\2315\213\024/CM5\303\362.F\001*\177\032\245\337\032Br\201\023Z\213CG\177U\327\360\3431\205\347X\232\223\261g\257/\255Q5\365|\207\035U\363]\311y\034\265\205\222O\301\257\277\3274\365\213\214\335\336\316EbZ\317(\222\344\256\367\210-\351\216\261\223\366\007\0358\302\342/\261\375\231\362\255q\032F\212s\"b"
+	.ascii	"\366f\016\002\006QN\277\341\246{\274c\212\f\3668\005\216\244"
+	.ascii	"\301\016\366 \352D\356\342\222\374'&\367\n\b\336K\255\217\016"
+	.ascii	"\252\323\316\024\263O\320\314c\310s\270.2t\006\257\036\345E\331"
+	.ascii	"\374(\335\227\201q\021\345\217\352\2254`\201\2712IA#\0031\376"
+	.ascii	"!ky\213\266\332\036N\250z\300\321\322\0252\nd\n\030/\215\375"
+	.ascii	"\277e\277\326\312-\345\264\317\307\037\274\253t\302\316\030\306"
+	.ascii	"\213h4pV\352i\356\355\302\267r\234\t)\221\277\351\264\341v`\245"
+	.ascii	"\243oX\320_\272\203C\374pz\364\255f\2104\365\370\352d\2100<!"
+	.ascii	"\001Q\"\017\3015\334\341\224l\207+\333\322E\n\020\006\336\342"
+	.ascii	"\276\212\370\305\236)\205h\271X\320IW#\362\266y\206\354~\021"
+	.ascii	"Q1\230\244U`\0376\214\301\026\265M\274U!&\335\306xc\316Z\235"
+	.ascii	"\005\037\225/\302\243\326\340+J\277\0058\264\004\227\003|`\266"
+	.ascii	"`\237\"e\243\004\020\243\215\357_\355\205\3640\254\240T\346\370"
+	.ascii	"KwL!\3441\327\227\270\312\301\332\237u\207CI\262\253\274\203"
+	.ascii	"\205\267Qk\342\343\240R\3537\022\217\333\263\227a`\205'\202\364"
+	.ascii	"\256\223\030J\254 \rq\214\212"
+	.string	"\355\005\3161}O)n\354\230\336\355\210\177\366S\264>2tn\330\361\250\237|\265\206\013\244V\026\301\374\354\236\2411\tkSd\260\362\0063\300\217\026\273K\353\214\256\252TiV#\330\f!,I?\344g\373#*\365y~:Ll\305\223=\374#\237SAV\215\006\"=4\033\035L\314\214\b\322o\356:\211>3\234\"8C\002\003q\251W\313F\023\301\004\214\236o\321-f\021A\363\232s\031\017\260r\353\216`\342\377\365\235U\347\274LDKE\247\023\305\006\035T\256\363\2240F4#8[;\303^\350\t\352\335\211\363\360V\261=\023,\307F\361\215\177\226\220[6\224\003\367\\\037zD\336\021o\2259f\313\334\237]erv\266Xq\177\275\272\b\b\362\022[\f\013\212\231\351D\231\260\243c\276\253*\3606\325\036\225=\362s\302\216C\020\231+\343\341\375'\361L\026\035\3056 s\352"
+	.string	"\026\005H\213w,\232\2766 2LoZ\365\342k\256\334*\361\265\361e\216Y\224:\351\242\224q\202t\311\230--"
+	.string	"<M\253G\216<\315bB\f\202%\312\347\030\337qpFi\"4\021\360uE\221\027\363"
+	.string	"0\260e~0\275_E\374o\002\300\035\220"
+	.string	"z9)\n\244\333A\355\n\325\336k%\262t\320\365\226\321w\322\350\352\034t<L\257\270\240j\206~\275\027B^\255\346\317\032\177@\001A\001\355\254\240\230\355l\312G\303\021\301\246\301\376\345n\332`#VA\365\332\205 \003\361\373\301\265\027\265~\331\301J'\255\343<\354\233\313j\244S\217\nM\270K\256M\266\036\203\253\350\307\214\306V\327s0S\330Y\"\223G\351[z\212\263\025\312\330B\310x\264r\3666J\375\342\334\223J\320\232\323X\f\0259\36791f\320\367\250"
+	.string	"fO\227\241=\231p\271.\335A\275\345f\245S0\027\255k\315\230L\036\201\327\202\330\314\311Goh\305v\356\261\222\3648(]\236\362M{\343\262\310xD\032h\366\203\340\260\340\263\36372\325\344!\2657\342(\023>\026\320\345V(D\316\021t=-`d\037\265\204\304b\022\0071\262|\274\t\371\373\235\317\367e\363\317\314\232nv\343\374A_\252\307x\226\355\264\210>B?\202\274zbf\230\317\002\250\262>FG\0048\265\302\237n\356\327+\335\337\253\3112\262\232@\254\340\222\374\343\003v\276>\024r\313\335\342:hQ\032\213;\263\343R\304\24507"
+	.string	"\263\325\2406\202\261B\362A\367C,\177Qm\303\220c\360N\234\265(\245\326\017\216\306\3234\334\001\243E\0320.z\b\226\332\230E\202\365\204!\232\352\363(\327PUua\361@\331\365M\031\221\005M\234($\245\003?\031\3746\004B\221|%\023\301\322j,L\264U\215\3060O\267J,!\231\3538\233\306\204\242\340m\277\251\314\006\212\0234Q\225\272\333\222\300\275\356l\031<\006\202\304sX\005b\214-\003\2474\005)\n\266\352\350>\226;^\236\236o\226Q"
+	.string	")a+\253\222f\227\247\230\231\ny\221\314.\301hE_e\205\226t\021\302\036\217\204\005\245\276Q3\004\310\001\250\370\222\245\267CA"
+	.ascii	"V{\261\243\024z\350\250\372gk\035!\310Y\351\r\341\340c\203;Q"
+	.ascii	"\252\213y\265z\036\332\3461m\254\246k"
+	.string	"^\253\364[\024vL\346i\374Ym\301iH\223\252\b\372_\177\202\203G\304U\374\036!\245\023C\245J\370\232h\233\035$\355g\003^\235Z\202Q\374\3734J\275\f7I\327S"
+	.ascii	"`\224\313\013\204\327\376\237\230\245\022O\250m\327tP\232\336"
+	.ascii	"\270\320\n\242d\006\277nFk\204\374\003\233\320\301\304\316\236"
+	.ascii	"\200\254R|\004\270\0320\374\300\370kO\362\355#\030\350\340"
+	.string	"\020\020H\255\005\231\025\274\301\267\365\274\264\264\255J\236'\324>\245O\032\251\272\237\371\233)\243\213Q\026\317\363\tj<\3271\212\221\030\274\266\237\275\261\235\276\223F\355b`\325\"\304\322\321r\177\267\331-\353\026\274\270\007\344\024\273\225\347~\303d\331\035\301\214\217(\327\331\330\021\332\001\320\r7B\315\311$,\200%\232\275\226P\032\357\362\244\233\tZ!7\034\273j3(\304PT\260V7\332\317\022y\037rF\364'\370\200y\230\336;@q'\306\344\343\326\237\260a`\337\203\350\254\340Z\214\377\347y\317\356/\246:8\3642;\264\361\t\324\2563p\243C\362%J\273q\364Q\363\256b\006T$\307\264\261\241p\324uT\206?a\360l\376`W\340\027\323\266\314{\020\217\346\275\344\314R\036N*\t\363\024\r*\253wU\331\325\221A\2403uX]\240\345\310X/Q\320\330\022\317S\r\225\200\033\331"
+	.string	"P\007\326z\245\352\231\3064\264\276\346\211\370\322\265\3009\254\224\tA\232\347\200\217\333\350}\341l=T\347m\240\261\026\356\001A"
+	.string	"\341\002\270\241\204\270\235V\216U\234\212Z\260\bw\f\002\214\343\\G\255\013\032\342\341&\203@Q\251g\006A\346\355\3245\005\314\374+x\025rgEm\021\005em\364\265J\270\363G\n\357E\323\241N;7jP\037LJ*\343\035\255\355X\332\310H3\031G:z\2403\370}I\005\213\221\372x\232\317\023\215\201\034\267:\025\242^\334K4\322\303/\351\\I\225,`\247\364\214a\307\347\274\316\347\301\245S=\223%\337\027]\313\212\021\241q\032\2628w\2500\301\344\256\343\207?\177\023\206\016"
+	.string	"v\314e-\023\301\366\251w\233:6o\2145\224\303\3349\264xR\212\332\336u\037\255\335[U\214\371\027\252Dt\212\253\037\037\372\313y\032\221\037jX\335\242_\003\241w\225Bp\360D\374ikm\371re(\261\263\211\231G9\206\264\200[b\256=K\tG^\016\023\fm\341A\216\354\372\206,\203]\374\217'\314 \004\344\332\224)\231\205\016\335\337\270\202\225\032\206d\236g\324\300\232\314n\215[\207\367\352PXPF\243\261\263dx\225^lhQ\256R\266#7\316<\024\277\2725wWuo\004\351C\023)\223\177\362\034\231r\326\024\231x\230\300q\325\243X\360\0355\335j\366\201\256f2\005@J\f\037f\024)\\PK{o\006\223\310\203\244\\\326\270i\325\013\"2\357i\357\301\345T\267q\t\376\372L\265\351"
+	.string	"f:!\226\013\035v\314=\203\325\324\035Ia\341\001wh\323\216`\332\274*\301\237\312\356\"\213\356\021H\030\347\b\263W(\210R\216\\\341\033+\232\021\024c\376-\020\032\206\347)\363h#\224\325\272\270\005\355n\255\330\002\203;\322\b\347\215\223`\001\216\234\355\262\024Ie\354\367\202\nBGT(\024*K=\220\005a\2706\214AY\237\271\235S\002\004\357\301\274\333\334\374u\222y\260X\0318`\365I\211\324\033e[M\004\316y\256D\bH\034\2756\205#L\026\346\322\003~fBkg\206Y*\267\256\214*\346\344"
+	.string	"\344m\345pv\242\037P\222\315R\203\313\020d\007\336\256\240\313(\321i\005\265\236\tg]T\270\301\270D\2100\366\220 [4\207\251X\3655"
+	.string	"\024\343'\004\352e|\005K\266\210\364\235\026\r\177K\232T\277\265\031\255\331\215}\347\034TG\203zA\231\252\335V\204\333\370\267\235\264\350\371\250\310F\312m*\243\364\3510}>\204\360=\346\371-\326\206\223\221\b\005\036\363\252\272/\021\302H\212\246"
+	.string	"_\353\213\255\203\251\360\026D\304\203a\r\221Hv[\032\2640O7i4\b\207-\246'98I\322`IB\205H\007\370\021\013\202\036\036\367\273\225\222\221l\017\321(\206 \336\b\036\003\002\027\370\300\017\230\332,\365\220\216r\177\352u\205(O\222Y\322\221}<\377\003\314\203@P\361\306|Ep}v#\f\264\232\227\005\216\274\332V\346\220\257\246\267\003\301\324\330g\257u\260\251\351/\\\300]MQ\033\r\b\f\036\273i\312Rh\237\245`\247\254k\254c\025f\271*\276\251\337(\233/ \262\036X\3510\346l2 \351\013\254\214\036Q\017\177!\1772R\362q7\036}\305-\3207\304n\0259V\345DD\317\306L\361\220\241\206t"
+	.ascii	"\335\221\036\253k\005\241\036\344\371\237..\227\202D\220\334"
+	.ascii	"pMK*\236\032_i\251;\322T\361\207\227T\030kD\177t\017\353\221"
+	.ascii	"E\363\221P'!,\302\332N\3719y\031\240\024a@;t\216\236\270\330"
+	.ascii	"\207\365\364\0227Z*aT\002"
+	.string	"\006O\317\303\372}\013\332i\037\005\035\273F\247\b\236\250\275\372\023\215\016\232v\202\352\031\312P\200\261m+Xg\314q\375\207Tx8jo\r\356$\034|\361\234\224/\373\334\377\020\254\222\f\300c\r\022\357\203\215\024\375\237\007D\006\b\270\263<\004\273Qn \352,\325\032Z\033\b4\026H8\b\252\033%\323\233\033/%\340;\234\216\247\240o\200\324\002\352[\221f\002\f\370b\356\350$q`\263\214J\276\372<\327\3614\276CN\232\240\355\243R \366k2\2605\027x\024\370\313\006\346\227\361\332\273\341\242\t\277\232v\032\311\027\231\251\240M\333\367p\323\016\301\3401c\241v6\223k\034x}Y\321\244\374G\273Q\006@\321\315Mb\244\356\274>\033\t\263\260\241\323\216\330\334\275\357\314\312\222\200%B\237\2613\270c\343\243~\306\270n}\2528\360\007\302%_\374kl|I\t\343\223\003\212\245\244\r"
+	.string	"^\2211\220x*\227\335*\326\256\355\006\256\316\030\302y\225\326pC{\273\017\231\264<}\304\336S\033\205T\205\334=d\035\366\024\032{\355\366\366\212EoR\256\356\314!\257\267]Dm\252\362\357jQ\205\n\213\323\304\3413>G\264E\353\025H\023\034K\200\234\206\007\273\313\314|\215\002h\332O\267\317\210e\276\033\315>\210\300\246\276\234h\036+F_\272AcPq\023\277\026\347\024\234\310\204\345\b\322\013X<4\f\321\351\305\245]\345\032\006\376\351Yr\013N\177\356iw\362\312N\367\216\315j\021u\351\341\2269\207g\276"
+	.string	"\275lI\266\222C\242t\2332\247tDIp\031\356\235\313\276C\032s\007\270\363\231\220S\003h\221\242v\350\243\024\372\263\031O\276\263Z\331g\257\346h\326\233t\035|i\220[\316\263\323\312 ;)\236hZ0\213\331v\227\217=K,\214xV.Hfj\262e\344\332\307\264\023\366\244\035\373\345\367\373%J\320^98Ze\221\035+\t~\201=v7=\357g\033\206\314f\276\033\177\333\220\366H\021B\027\230\322\215\220j,\260\223\245U\344\2575\261~sJ\367\252\230=y\352\0210:\263\213bX\344\340\347 \b\243\345\035\254\b\244n\204\2014'cb&\333J\355\ra\304v\035t\013"
+	.ascii	"\237\346\321"
+	.string	"6ao\245\370G\203\0302\003\032\240*-l"
+	.ascii	"\300\032y\226\3143\2307W\323*m\036a\2368\006^\224\262\211\273"
+	.ascii	"\261\277\322*HP\027\311GL\376Jt\211t]\256W\300)\264{\243a\245"
+	.ascii	"$\303\335\261\345+\304p\005,\0250\352M\312\274\270q=\021\376"
+	.ascii	"'W\227Z3"
+	.string	"\310r>jL\323\032\f\362\216W\256L~\316ZJ\tpvJ^\223\265\202\301@\330\020Z\371u\022X\013\327rJ\327*\250\023\360Li\317$]ra\302V\240-h\375|\371_\221\303Ga\225\345d\2423\274\224\355maU\"\361q\370\320\3616\301\215\001PZ\221\345\270\234D\"f>DKi\302\035)\233Yz\027\352\265\022\2452\270\263|p\226\330#\3027P\231\267\374\f\330\254'P\315\n2\271O\026\360\024J|mZ\"\302\363@\222W\272\313\212\016\362>28\330_r.6D\332D\260\224\007\032\207\204\325\340\345j\343\222\224\315\261\353\032L\004n?\205\035\035\255\334\244%?\211g\24024\373\307B\341\346\306:T\027Q\236E\346+opC\3648\367\233k)\371L\333\330\240[\031\237\240\204V\224\332C\370\027\315\367\374\222ZqRJ\0062\031\335\313\365^\371\340\244\005pf\326"
+	.string	"\035\030\f\377\221\243P\374@\211\007\261\r@A\255\336\244\303{\030\336O\216\034\332v\336*\267\255\027 qe\305\307!\337\023\376\r\201\353\225\\C\305y\360\324\r\016K\270\257\315\235&\\\210\244)\363Z\257\n'\002J\266\321\373\213pq\313\311\263\271sjzT\3016"
+	.string	"\270\267\343\202\035\350\336M\b\322\262\344`E\236A\225=O\227\303&<z\035\304\004?\267\265\351,\335w\336VY\2609\232\037d\371+]\242\315k\020+\021-\365\270#:8\214\255\346\327p\220\317\366\246{\274\377\345\241\214\303\377\b5\275F\324\332\252\350\201\234K\375q\311\334\f:oQ\346\f\326\24093\346\013\322\277m\360\024\233<\034-\363\326\020\365\247\016\036\016hr\373\316\320\335\262G)^+y\bA\202F?\036+"
+	.ascii	"\315\220bR\220\240\346\370\023\376b*\262\214\366\267\334_^\206"
+	.ascii	"\355d%\201C\374\277Hm{\2675]\267\373)\017\356\270\032\227\310"
+	.ascii	"\276\003tw\325\236\243[[\301v`\304\207E\370\305\310n\026\305"
+	.ascii	"b\021\034DB\236\017\351\347\205\272\177@\274\355\330\027\f\203"
+	.ascii	"\231\023\371A\023\260\021f\234\216\023W&\260\346D\367\211\\\213"
+	.ascii	"\245\257\017\266\377\230\362\306%\202\237Y\360.\2537\253\301"
+	.ascii	"\2511\357\234\321\306\016\231a\001\355\234q\2604\326]\212\361"
+	.ascii	"q{z\031\341#\210x*S\035\025i\306\224\333\033\377|\305\356\221"
+	.ascii	"\320C\214n\030 \036\025\034\177\211\370\243X9^\377\020\302\305"
+	.ascii	"\266pE\316\275Ap\367\214\314\376\276\333\324A^\036\221\305\237"
+	.ascii	"\253\213\303\305\262\356\002x\317\364\343\210\271\023a\347\303"
+	.ascii	"\364\364\230\030\355\236\230\335\022Wj\035]\353=\351\357@\031"
+	.ascii	"\020\301|X\370\217\254\007\336\371$.+\275 l\033\242J\307\363"
+	.ascii	"\307\207\f~d\332' y\217\204\337\rr\247AQ\037A\262\305\240\364"
+	.ascii	"\004\364\277p\236H\352a.\225\005k\241\223}\267=0\303:\367Ng\031"
+	.ascii	"\230\375\035\004\017\316zH\261\2371\347\247\r/\3454\357'<^x"
+	.string	"&\217\303a.C\344\213]\337\020Y*:\330\311\223\322\363s,f>\375\3134}\037\341\t\225\323\320?\317\324L@<E\240\323a\256wdw\313Rg\313\246M\201`02\017J\332\247 \216B\310%$\215\212`i\024o$\203\177&\370\036\fs \235\001\211C\221\233\343\377\251\007\251\377\017\217\237V\363\355V\352\335\340\303\262;\t\350a:\376\355]\373\001\374]\205]\375\376w\034\346\006\220\026\265~\304\277\031\2144\001Vt[\234_R\372Y\257\303\242\331\370\257J\0373=\246c\217\211*\213\370]M2 \030\230\007\234=\247\374\222\252k\203\265\f\200q\002\2773a-\275u\274\016e1\247m%b\324\307\261\023Ow\270\035\325\037\0163\312\257\017\223\177\250x\b\351$\345\037r?*\361\232\352\245\370\270\017\252\231\353V\276k\333p\031\257\0039\357\212]Z\357\266\234\375\376\250_\212\372\207y"
+	.ascii	"_\361\347f:9\322\262\231\341#Q\257p\347\357K\204EP\tWx\257\302"
+	.ascii	"\277&\251\327-,\017\306\303\343O4t\3465\367\376G]\377\204\263"
+	.ascii	"v\375\310\333\310\314;\306c\267\246\035#\271\345:|\f\324\333"
+	.ascii	"\347\375yj\204\263\307\034\177\356\235.\352,\211,\354\370\265"
+	.ascii	"~#\275<\372\270\317\306n\307\265\022\214\227\205\372\331w\025"
+	.ascii	";\231\357?\301f\236\346\031\342\277\365\267ft\213\373\326\030"
+	.ascii	"\235\023\317M\230\337\032&\232\275\252\304\357\250 =\367\312"
+	.ascii	"\350e<oNy\006\325XCN\234\311L\222\232\257\267/hy\211\3329\203"
+	.ascii	"\247\222^\300{Fj1\321\347wB\337\020\343\t\231vF\370\177\231M"
+	.ascii	"\034\234\311g9>\221\240\323\350\270^M\006\375\305|7K\3569\337"
+	.ascii	"\247g\372\352\255\251\201\007\234g9\357\005}\310\333\003K\363"
+	.ascii	"o\337Y\336\256\013\274\272\326\251<\236\332q\336\005\263\214"
+	.ascii	"\300f%\3310\035\323\337D\360"
+	.string	"\223<\277\212\346L\016\307w1\324W\323\340\325\302\304\226\027\263\243\026%G\271\213\255\274\265W\003\375\032[\027\027\267]\375\257t\337\312=\f\311\273\020\344\004 N\216-\262\226'\331&\214\f\334\353\205\276\030_\377>=[\013\226\227\312k\352\300\340-z\214\r\034\223\335\213\364\271S\317\33307l\317\251\300\236U\306G3\364\207|\3470n\305\365#\007\017\022\327s\022yK\357}y\357\205\315\274\345c\\\\\306\365\031\226\313\ty\221v=\220\234\210\373\033\214\247\222\262\237\366\314\017#:\n\271\016\325\375N\221C\266\3332\334\036B\353`\364wz\323\343\233+\351\n\260|\3016\376\343[\340\205\007.\007\301\331w\356\303\237\033r\340B\354\0341-\370\260\002{\257l\331H\330\231\257\033\310]\353\302\367\177\033\234\303i\037\2373<\301\353\235\357\253\020x\035\311\311<W\273\236U;\342p\310\341J\f\376"
+	.ascii	"\352\301\206\3612;\006p\222\206\277\321\242\271&\321\0358tF\315"
+	.ascii	"\320\204\027`\307\035x\257\350\342\264\034=ms\312\361{\254|\341"
+	.ascii	"\2764\272\211\320\203\n1Y\342\267\274K\342\366Z\017A\346g\201"
+	.ascii	"\037\352!=\343Q\227I\376\254\031~\311\320\031\315s\235<\033\357"
+	.ascii	"N\322P\227\355,\222O\3521\230\373X\377\023D_\310\\\250Lr\217"
+	.ascii	"\207\336\206\327\343\221`\214\326!\326V/\277\333\223\344sk\276"
+	.ascii	"\003@\227\264d4\345\201\021\371\376\003"
+	.text
+	.section	.gnu.lto_.symtab.779ae4a278acd401,"e",@progbits
+	.string	"targetPidLooptime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\003"
+	.string	""
+	.string	"thetadot"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"flappingAmplitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\004"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"pgResetFn_pidProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\004"
+	.string	""
+	.string	"applyOrnithopterPidDefaults"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\004"
+	.string	""
+	.string	"pidOsdAntiGravityActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\004"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\004"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004"
+	.string	""
+	.string	"pidInitSetpointDerivativeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\004"
+	.string	""
+	.string	"pidUpdateSetpointDerivativeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\004"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\004"
+	.string	""
+	.string	"calculateFlappingFromThrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\004"
+	.string	""
+	.string	"shapedFlappingSinusoidLeft"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\004"
+	.string	""
+	.string	"shapedFlappingSinusoidRight"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\004"
+	.string	""
+	.string	"omegadot"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\004"
+	.string	""
+	.string	"ornithopterFlapping"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\004"
+	.string	""
+	.string	"tcommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\004"
+	.string	""
+	.string	"k0"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\004"
+	.string	""
+	.string	"k2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\004"
+	.string	""
+	.string	"getOrnithopterWingState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\004"
+	.string	""
+	.string	"adjustAerolasticPIDGains"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\004"
+	.string	""
+	.string	"aerolastic_Kp_scaling"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\004"
+	.string	""
+	.string	"aerolastic_Ki_scaling"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\004"
+	.string	""
+	.string	"aerolastic_Kd_scaling"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\004"
+	.string	""
+	.string	"getServoSpeedScale"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\004"
+	.string	""
+	.string	"getFlappingSinusoid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\004"
+	.string	""
+	.string	"getFlappingAmplitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\004"
+	.string	""
+	.string	"pidUpdateThrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\004"
+	.string	""
+	.string	"throttle_"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\004"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\004"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\004"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\004"
+	.string	""
+	.string	"pidAcroTrainerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\004"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\004"
+	.string	""
+	.string	"acroTrainerSign"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\004"
+	.string	""
+	.string	"applyRcSmoothingDerivativeFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\004"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"crashRecoveryModeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\004"
+	.string	""
+	.string	"pidSetAcroTrainerState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\004"
+	.string	""
+	.string	"pidSetAntiGravityState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"pidAntiGravityEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\005"
+	.string	""
+	.string	"pidSetItermReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\005"
+	.string	""
+	.string	"pidGetPreviousSetpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\005"
+	.string	""
+	.string	"rcAliasToAngleIndexMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\005"
+	.string	""
+	.string	"pidProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\005"
+	.string	""
+	.string	"pidProfiles_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\005"
+	.string	""
+	.string	"pgResetTemplate_pidConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\005"
+	.string	""
+	.string	"pidConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\005"
+	.string	""
+	.string	"pidConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\005"
+	.string	""
+	.string	"pidNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\005"
+	.string	""
+	.string	"wingSaturationFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\003"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\004"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\004"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\004"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\004"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"sincos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\005"
+	.string	""
+	.string	"currentOrnithopterProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\005"
+	.string	""
+	.string	"sincos_ramp_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\005"
+	.string	""
+	.string	"wrap_2pi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\005"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\005"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\005"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\005"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\005"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\005"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\005"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\005"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\005"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\005"
+	.string	""
+	.string	"fapplyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\005"
+	.string	""
+	.string	"getServoTrackingError"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\005"
+	.string	""
+	.string	"getServoTrackingDelay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\005"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\005"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\005"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\005"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\005"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\005"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\005"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\005"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\005"
+	.string	""
+	.string	"wingSaturationHitAllPairs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\005"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\005"
+	.string	""
+	.string	"getSetpointRateDerivative"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\005"
+	.string	""
+	.string	"rcSmoothingSplineAxes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\005"
+	.string	""
+	.string	"positionStrokeBoundary"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\005"
+	.string	""
+	.string	"imuStrokeBoundary"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\005"
+	.string	""
+	.string	"imuPropagateAttitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\005"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\005"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.779ae4a278acd401,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
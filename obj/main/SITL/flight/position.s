@@ -0,0 +1,691 @@
+	.file	"position.c"
+	.section	.gnu.lto_.profile.f2667454decd0e2b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f2667454decd0e2b,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\r\007"
+	.string	"\024\b\201\001"
+	.string	"\030"
+	.string	"\260\364\222\254\n\016\002"
+	.string	"\002\001\002\002\002\003\002\004\002\004\005\002\005\002\002\002\002\001\240\342\234\212\n\002\003\352\263\360\321\b\004\005\006\201\277\312\340\b\n\002\006\002\007\005\002\005\007\t\n\313\304\375\332\007$\002\b\002\b\002"
+	.string	"\004\002\007"
+	.string	"\003\013\f\r\016\017\201\324\335\277\f2\002\t\002\t\t\002\n\n\020\022\023\024\025\026\031\350\300\306\254\005\002\032\354\206\342\366\006\033\347\273\234\355\f\002\002\t\002\t"
+	.ascii	". \200\002sbvH1\r\343\035h\254,\302]\033\003H:0\330\263\271\r"
+	.ascii	"\230\016\024\265ssIq.<A\207\201\202\001\265@,\007&e\336\331X"
+	.ascii	"\"\342\365\036\3458\021p\300$\001\227\005\214\334\303\211\341"
+	.ascii	"\336\233\234\323\002\231\017\325\030\211d\316;\210\370\353X\271"
+	.ascii	"mY(\247\260\342\016\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.f2667454decd0e2b,"e",@progbits
+	.string	"(\265/\375 a\025\002"
+	.string	"\204\002U"
+	.string	"\007"
+	.string	"\001\001\001\006\002"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\002"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\n\001\001"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	"\031"
+	.string	"\003\032"
+	.string	"\003\033"
+	.string	"\003"
+	.string	"\n"
+	.string	"6\005\200\001d&A\325"
+	.ascii	"\020:\347\034\020C\345\360\213\035\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.f2667454decd0e2b,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"5\006"
+	.string	"RI )pe\322\030@\262!\3739'\236\371\0250\376\357\247\365\335`\372\347A\217\314\357c\377kO\342\257\366?-\0241[J\231\002#\016\371X\251\333\360\204S/9 M\204\033\311\013e\003\260\347\302#\236\023\351!\032\312\004T\032\371h)F\353`\f7Q/\177\202s?\322\322\321\356*\364\027$\"\256\222\264\354nbi\352\341?\320<\253\334\335\225\376J\315\226=G\276^\371\331\262\267\370\300\210\005\032"
+	.string	""
+	.string	")\216\222\027F\017e\243\242\2650c\320\351\341\302S;\334\0300bx\330\230\030N\303~\313\315\305\b\300\f\260\325"
+	.ascii	"\004\264q\001\b\206\317\215a\031d\036\240\215\200\333\313\253"
+	.ascii	"\356\205\251\360\n0\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f2667454decd0e2b,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"\365\004"
+	.string	"\322\207\027\037\220)\351\377\277\305w9\201\037\357n\331\333\232\370\357.7\221R0u\254\265\f\321\356\376R\246\277\341\013O\230\210\355\377\251\242\302ZFH\b\017l\035\027F.\254\334Q\004[\237\224R\372\312\030\263L\032\017.\261\362\277+\n\031\326\217\205f!~-\275A\357\220\265\nz"
+	.string	"\362\300L\004\032"
+	.string	"]\030"
+	.ascii	"\341F\226\341\213\r\226\346\002\b\2072\036w\230\003\307@KH\315"
+	.ascii	"\225\347\003\241\240\351HP\360EW\367\230!\0174\006DH\0258%\340"
+	.ascii	"Eq\335\264\333\314v4\327\321\300\020"
+	.text
+	.section	.gnu.lto_.pureconst.f2667454decd0e2b,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\006\230\004\n\230\004\017\230\004\031\204\004\032\204"
+	.ascii	"\004\033\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f2667454decd0e2b,"e",@progbits
+	.string	"(\265/\375 \302\005\003"
+	.string	"\222\204\f\024\300\2475\377\377\377\377?"
+	.string	"-%\"\255\tg\224\254\235R\nU\211\360\240\241\n\347\331\316i6\363\330\306"
+	.string	"A\227\204mp!\331\310Y\266\362e\240D\022"
+	.ascii	"_\221\240\304\341!\276@\207\022\214\0136\224\330\031\202\263"
+	.ascii	"2,\354\375\204\2015I\350Y\360R\204g\022\326'\331\226 6\200\005"
+	.text
+	.section	.gnu.lto_.lto.f2667454decd0e2b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_calculateEstimatedVario.36.f2667454decd0e2b,"e",@progbits
+	.string	"(\265/\375`\311\003=\033"
+	.string	"\366\363\261J\260\324Q:\372;\342\033\017\275\337\304\213\346\232\342\220\355\365B\030\343\035J\276W\254\322\353\2550\372s,\336\270L\361\363\321\332\221\004\216\332\227\227\250\364'\035\023\3164a3\005Z\002\211E+h(\205\n\375\237\020B\210\334)\005\231"
+	.string	"\217"
+	.string	"\240"
+	.string	"T\264/d{He=\310\247l\230C\034\210q\240l\324Za!l\330Gj\027\371R\017\032f\033\270\313\221\342\364 jg\036\2410\2030J`\325Z\t|\364\002s}\210\020c\025\t\206\t\253Z\243\f\030\201\371\321\224\332\207:\217\242\377vv\325\372\342\210U\255\325\200\013\230\037sD\333~\216\353(\262\021\375\315@q"
+	.string	"J\222TV\255\225\026;\r\371\221^\206\374\2702ntj\344?x\236\036R?\236L)\035\235\226\rj\255\246>\245\024\367\336v"
+	.ascii	"\333\034l\361@O=:4\335]q\353\304\372\312\226\356O\247\336\251"
+	.ascii	"^\265\363\233Lt\243\367\335\310\217_\005:\264\226xth\377ztc\330"
+	.ascii	"\027\3532\331\246\336\321y\324\215ss\340=\273\217\337\346\277"
+	.ascii	"_\366\242\256)\251iL\352\031\223Z\306\244\2161\251aJ\352XI\375"
+	.ascii	"RR\273\230\324-&5\213I\r3\251_&\265\253\2446]\324\245IM\232\324"
+	.ascii	"\243I-\232\324[R\323\222\372<\020\226N\270X\361\223I\255'\206"
+	.ascii	"V\352\325H\204\306\243~\340I:\006-+\023\366L\260\270\2526\203"
+	.ascii	"\3410\nlY^\353Z\330\376|Jr%\256\372`*S\221\037"
+	.string	"_\353Z2\327\265\337:\261\3125\367IWl\341H.\230\265\"%\360\215\374H\006\277\351\2435\324\374\032\371\261\\\f<\264\240\\\350\353;\222fm\233\007z\337\315>\370\bR\254\264\260H\354\221uL\261\245Y\323\263\n,\311]\204\234ml?u\021GSV\r\031@*\262%2`\307\215\026\344\316\366\302s\311\270\342\222\373\023\211\315\216K:9\261xU\247\222\242\326j\001H\265\362xv\305\375\031\376\351!\372\321\325p\264\240\034\016\227\363\231\001\331(\b\341t\032\200l J\033\356&\201\303\250\003r\220\033\252m(\355\323\023\224\273\351nD9!\232\356\307\303\r\250\003-\350V\303\321|\206\210h=7\316\t\331\206h\272\\n\210\006\373\361.~\231v6\207\267=\277\354\316\006G\324\352\262/\037\016u\326e/d\374\216\304\321\331\027\240\212\253\232\305\331\013\223\256\324\320\231\265'T \357\253Y"
+	.string	"@\245+\244=\362\3146\371\020\337\024\231e\331\231-\225\234.b\266eeV&\204YW\275V\032\2636\302\323\251\347Z\230\235m\235O7\033C\2501 \003\025b\n\252\021\t$\220\031M\222\016`\242Q\316\310\016\021"
+	.string	"\262\242+\311\260\277\001_\030@\206J2\032mz\345\227\204\304\352p!i-\300\034]\226\213-\322\3273\3536\262\300\005\363\203\207\035\264\tn.\023CH\274\354CN\274{\260\013\335P\031\244\330\3638\273\216g*9"
+	.string	"u\007m\266\327\261lyi\t\222\373\376\364qw\354\333\224d\315\350\207\200\275\027\323\326s\0059\235\300\266:\21593\242N\242\352\320?U\214&Xf\226\357\002"
+	.ascii	"\177\tz\b\365\262_\032"
+	.text
+	.section	.gnu.lto_fitStrokeAltitude.46.f2667454decd0e2b,"e",@progbits
+	.string	"(\265/\375`\211\007E+"
+	.string	"\352M\344\020Gp\\N:}J\346\260\034\320\027\2555\220=\027>\273FK\201\352L\027\202\217\230+\341\005y\224k\361P*cP\013\344X*\227f\251\357>\356{2s\030\261\346`\245\213\206Z\034Y\303\207YK\b\331D\356$\003\374"
+	.string	"\351"
+	.string	"\373"
+	.ascii	"\234\024V\205\017\307\276\267\027H \312\022\351\322\355S\356"
+	.ascii	"\306\354c\030o\343\373&\347\273\024>\033\373\250p\\\212\305\225"
+	.ascii	"\256\245\235\221\200\301\354\373\265w\362\264G\371\032\373\324"
+	.ascii	"\230\204\200b\246\341\t/\td\375\250\310#\233\230\205$/S,.\241"
+	.ascii	"\225L\233\235\252\252P\277\034!\275e\376\331\233\\\035-\006\363"
+	.ascii	"T\365\207\226*\252\232T\300Q\351/\201\007\235\277\346\201\316"
+	.ascii	"_\276bf\363d\230\212\002Y\242\025E\216\252\252\277\036\202\262"
+	.ascii	"y3y6\373\352=^\212\236\327l{\305\267;\342"
+	.string	"lua\275\367\243F\216\363L#0/6>\206+\207\351$\006\210\232\257\275\300\030\227\227M?\206\013\307r\265\350\215\237\313\333\2574[]7~M\236\271$9|\272d\230S^msg\273Ev\035\255\211\304\306\373l\177\322A\267\325e\343\026\245\240\252*\333\255\256\032g\337\231y\0133\033\231Q\003\001\353\230T[\023I\033\2714:5\273\004-\325Dp\264\356\030\355\035#\350w\202\276\333M%f\354\314n\250\211\035\355\035\206k\211\221\252\252\n\201\217\345Y\204\374\"\277\214bh\2775<\177\337g\273\323\233\334\0348\243\275\353\366j\233C\322-\2049y\264\035d.\211W\025\356 \314\247e\007\246\345\251\006\f\026\\\313\277\323\262\224\202(\250\277\235\237L\313\t\216\366#\270\226\235\232\230\256\345\245+\317JIH\247r>2*:-\023\245\226\207\256e\241k9\350Z\036p-\003]\313\002\256\345"
+	.ascii	"\247\345\237k\031\300\265\354cZ\356y\362\314\363'P\316\275k\231"
+	.ascii	"w\265szZFO\313'j\371^\313\346i\271\257ekZ\376\003\364L\314\321"
+	.ascii	"RUi\334\331Q\303\\\270#\177\373\225?\225?\371?\371\241\374jG"
+	.ascii	"\231\177\305JH\r\324Pm\315\254`O-\240\201\272\343\326\261\246"
+	.ascii	"\016\320\002\372\253\330O\007\350\323m\2653\2429\363\323\276"
+	.ascii	"7\2729L\r\240\237\332\256Y\305|\032\200\203\3661\2238\241;N\265"
+	.ascii	"\203\236\236\352_\251p3ez\372p?\340\203\256\3544\215\272\327"
+	.ascii	"H6\315\242N\317\310\224\346\331(\257{\335\324\035\276\226\274"
+	.ascii	"N\233\251\277rA\233g\236}\255\335\026\302>:\335\240]\220)-\324"
+	.ascii	"\217\226\220\261i\006hF\215<\333yadr\275\240\277\366T\r\231\021"
+	.ascii	"\313Kf\266LE\215<\352\263-\310eY:|\373\354k\3351\036\314\303"
+	.ascii	"\204\340\027a\021#F\234\277\267\207\320\3400\332\273\233&G\375"
+	.ascii	"\250\033\364\321t\320\031\265\331\f\372+X\267\331\026\316jg\374"
+	.ascii	"\002\354r/TA\023&\316\337n_\027\2302\270_\027\365\202\266q+\330"
+	.ascii	"\362\253\216\272\036*\363\204\273;.Y\252jd\262\375\353\007|B"
+	.ascii	"*8\024\026\177U\304\341\220HUT$a\205\037\n\213i\0250\230!H\202"
+	.ascii	"EQXL\001\344!R\365\202TU@\241\025\260E\272\302Cp(\354P\254\n"
+	.ascii	"ZY\261\240\352a*\251*\242\260(\\AT\361+\2360!LQ\342W%\004\016"
+	.ascii	"\177TV+~RILT\021\264\372\025\211D\253\237/i|\007a\233\266\032"
+	.ascii	"3#<\247^\272\320$\214\261\217L\324|7\177\003\334\300\201\303"
+	.ascii	"\226\233\241&\352v\323\272#d\205\232\331\303\207\363[CM \253"
+	.ascii	"\2618\250\233Z\250\373\313*v\\\352\240>\271v\324\255cK\315g\363"
+	.ascii	":^\202`%+\317_!\"f\217\247}\355\304[\271\034"
+	.string	"%(\3411\206\207&5\017\212\324\276F\362\330:3\322\244g*\247L\356B])\314l\306\031\245Lj\344\341\316\023+\273sB\225\241]\244F*5\332GKC\225ZA\177\371\213\366U\267\202%\365\200\216j\033\367\324\003Z\305\216\265u,\200\221\250A<\344\224A\006\251\032\221 \232$I\007\240\002\221!\253n\021\260\241sp\246\240\205\312\306\032\336\301\222\246N\302^f\212-\334ra\361\b\034<\004\b\205do\335aR\362\321*\302`\264e\004m\023m\363E\366\354S\264\312\222,\253\312\347\006\360\243\374\304\023\251\232\274\212\367\265\005n+0x\324\314G\0277@^OX\312,H\210\007\222S\243S\350L\341D\202J\216vo\021\310&\212\002\374;\205H\247\243\006e\262\300\2354\267\327956G\001\001\201\362\227\030\221yD\265l\326'\026\030\37449\260\236\t\366\224\022\250\354\247\005\350"
+	.ascii	"</\200\273\241\304\366E\300\200\220\214]y\335,5\250\301\r\245"
+	.ascii	"\036\361:\355\036:\314~4\2001y\301\022\366\214\022\031\026C\216"
+	.ascii	"\201\017*p\271U\t\227\222S=8k\336\036\274\021\236\3748\324\013"
+	.ascii	"\240\201\233\371`\304\2030\373\275\236\300\304\206\3057\236G"
+	.ascii	"\327O\223L\221H+3E\3432?(\036G\177\236a\260\3470\334 \265\264"
+	.ascii	"<\363\343>\0165G\337\361:_\247\002"
+	.text
+	.section	.gnu.lto_positionStrokeBoundary.47.f2667454decd0e2b,"e",@progbits
+	.string	"(\265/\375`\274\006m("
+	.string	"zG\264\017H\200\332Q:\177\313\005X\304}\224\363C>I\320T\340^E\r8\360s\354\037\260\221\365\257\325\213(\220.\214hf\241U:\275\n\210\350\353P\317\231\202`\303c\013\263\270u"
+	.string	"\261\363\356PY\373\337\366\311&D\356$\003\344"
+	.string	"\323"
+	.string	"\356"
+	.string	"\030naI\311\254\203\035\n\263\216a\374\213;I\245\265\344:\312\f\203Yw\264\357\305:ff\306\b\202b^e\204\035d\\k\367J\r\035\345\b\267W\346s\275\313x'L\214\273\367\352\n\331\275\314\"&\272\035\r\272"
+	.string	"{\364|\217=\312Ff6gf\335\203\2419FY\273\367\002\033\310\215\367\365x;]\016wK-zv5\362s\312\246\373zi\005\241\253\251\035\347\t]M\351\370\216\214\224\216\033\221\262\252\272\034\313\2323\260\306\265\205\303q2R7\352\255\301r\215\213\355jj\371\364\\\260\fCu#RU\247\2001>\326\364\224\307jO\003?v\260\365\224Qg\020\030\263\343\261\242\267\032?uJ\031\265{J\2503\350\336{\257\327\031\312\247Z\323\n\367^\256H\345\324y\347\314\267\314|\304l5\004\026m,\376\373\336{\317\376\301\005\276x<\205\005\352{}"
+	.string	"\263\315\353M\0311B\r\324>p\216uj\377Z\250\037\3663\211\0317G\216aE\236\216\345dL\302\244${\264\266\203\263\277\371\205}\367\025X\032\250\332\306\374*\267\362\202/\204\207\304z$\321\036}w%\263\226]UN\265\311\314|\252\215\305\374n6\233M\356\037\314ie\243\264r\202K9#@+\013\245\225\201\320\312?w\362\377\322\312=\2662OZ\031\200\255\274c+\373\322\312\275\2642\017\255\274C+\353\322\3129\2642.\255|K+\247\266\262=+\243g\345\323Vn\264r=+\037\030`mi\345\343\254\3170o\2629\347\232\241eD.\345g2\377\213?E\no\261eA\2307\207\322\006\327\f\322\304\266n\315\314,\216\026c"
+	.ascii	"\232{/\004\276\232\2571v\031\237X\260\200Lc\376\326EgU\266\323"
+	.ascii	"\376\261\316Y\206\013\033l\027Q!a1\2662-:\264M\020\241\315C\322"
+	.ascii	"`4\247\246d\356\327f\2300$\275y\303\312)\203\345\2179\231\f\032"
+	.ascii	"6l\260G'$\325\226\\\365_\367\342p\273\367\0369t\346\016\036\352"
+	.ascii	"\221\274\023c3\223\321M\020\250\224\244\341\206\336\323>\311"
+	.ascii	"6X6\264\234n\365\313\231"
+	.string	"X\235\264\261\306~vm\003K#\240\236\017a\231E\214\250G\236\335Y]fln\240\272\351o\353\321\024\263\215\305\365\034\372\317S\232#\226&zO\317(a\273M\200\2351\211\177)q\273\027\352\001\277\313\275\034\361\205\034e\244`\320\036\355\226\220\324Zv9\371_\330-iS\034-\265_gI{\300a\263r\252\315\254\302(8\024\026\201J\304\341\220\210\364;*Q\207\027\202'\\\024\205\305\025G\271\026 \202C\341\207\242Rpi\311\005\022\217\221\214\224\210\302\242\260\005\221\005\260\250\"\205p\005\n\240\222\360h\bDZj\0014\002b\"\213\340\022\260H$.\001uN?_\301\251\237~\372|\\K\035o\255\250!Bz1\316{\257(\234\371\273\371\342)\250\277f6\0361&\241\262e\006u\240\006\227\"\273\003Y\236\366\241j\323t\252\025/V<r4$h\236\236\261\023A'\350\005t\242\324"
+	.string	"4\202\376\031\333i"
+	.string	"k;\375)?\233\030\261\262U\345\3538\275\366u\217\035\353\024\235\327\275\266h\307*\242\247\315\353\223e5wjL\004\322\376\306\270d\313\330\304\330\304\036E\351 \323t\215\353]\373\240E-s\255\253\347-\326\250s}\257\237]ebOg\302\230\374\264\021\256\177\375\323\001\200\214\250a,\006\021c\250dD$(H\232b\341\200\002\221\241\263n\020`X\233$\035G_\324\324\273\240\t\301\036z\036x |H\037V\305@+ v\242\313\00482\245"
+	.string	"~\177\36254\223\365\217\267\204\263#\344$\213^NpX\230i\341X\313\266\255\347n\277\270\005\200}\225\204\343PT\261\200Z)z\204\231\205oM\357"
+	.ascii	"\342M\252\016\354\371(\037N\312\030@\004\317\317 d\244J\324\036"
+	.ascii	"\306\r\226\027\357\002\267\016av8\322F\322a\324\244d\250XX\322"
+	.ascii	"\241\321\372\027\025\360\2424\372\354\330\300H\031@K\320^h \016"
+	.ascii	"\255\251o\372\223\222re\366Lu\336\177\216\177z\232\301\bE..\263"
+	.ascii	":\245\213\301\335%\017Oj\312\370$\277%U\005!\2248x\224\324\361"
+	.ascii	"\232\215\037e\354H\360\022\343\342p0\265\207\336\2653\007\024"
+	.ascii	"\326\276\207\255\264E\303\3258\317\336\341\272?\364o0\350'!1"
+	.ascii	"T/Bs;1\357\370\364\261\324\371\213\032\302\324\032\326]\311S"
+	.ascii	"=\301\226\361\037"
+	.text
+	.section	.gnu.lto_calculateEstimatedAltitude.50.f2667454decd0e2b,"e",@progbits
+	.string	"(\265/\375`\001\fM="
+	.string	"\312h,\027AP\346Q\007\257+V\005\fv<\362h\350\032\310L\026\273\323\332\375\260Rl@\374\341\260j-\320\310\320\2339\316\n\266I\220$A>\361b\255;X\020J\343\017n\026x#\334\322\266\335$\245\224\002g\001A\001n\001\034 \255J\233\3513\314^M\206\255\206\3409\343\356\275^\3144\230\331V\275\277\264\264\303\364\230\246cv\316Fpy\026,CF\247wo4K\f\330\324X\322\035{N\253\334{M\200\001\233\032\213^4\tS\242q\"\344\004L\321\213\333\262!\330\340A\333\321\033S\313\3505k@%\032\247\350\336h\202VYB\260\235\271\343\032\332v\027\034,\274WI\2344\367F\027\260\202`\253S}\\[\3755\323\332*\267\314\202:\352\344v\0308f\030E\367\336\3447\351\266\221\001"
+	.string	"HEA=9\035\233\230\226\224\222\220\214E\";\024\006\201\253\372{o\271\227\215\204v"
+	.string	"h\234\003\200k)8.\036\365\326Po[\374\311\255\235~\b\334~G;K"
+	.ascii	"Q\361\343\224n\232\"\305\231\242\364R\3379\213\002\305\225\222"
+	.ascii	"\2348\322\023$n\254\301\345M\034\237\222\037O\272\350\\s\242"
+	.ascii	"\363\210\263TJ~\030\351\341\225\263\".\374I9\345\0041`g\t\240"
+	.ascii	"\276rF\304\203w\316\214\234Qs\340\020-H\257,\032\3637u\357m\272"
+	.ascii	"v\037h9\\\3550#\375\373!\320S\203\310\2106\366;\232Qi\262hd\376"
+	.ascii	"\277\001mH\370\214hb\277\251;<f\3235\325\2253\250;\320\302\275"
+	.ascii	"\227\275\211\366\243Y@3;\0243\373`\036~\b\031\326V\037|\237i"
+	.ascii	"\207\2469qB\273 \235Y\003\007\357f\325?\225\231\003\224rf\017"
+	.ascii	"\037\274\233l,\003\307\352\211f\271\376\363\256\377\273\236\234"
+	.ascii	"9\304\b\357\346?R\231\033<\261_r]\231#K\365\237\335i\032Y\231"
+	.ascii	"\373\375\223o\254\376*\244~\232\374\327%Vf\023'\274\233\376+"
+	.ascii	"\346\260\361\351\215\375\222\251\376\215*\267\207\357H/J\322"
+	.ascii	"7\367\322&mc%\360PB\242H\347\214\371\"\356\247z\002\357zrT\021"
+	.ascii	"k6m\207\203[\n\317@\341\335D\261\266\332\037GH\233\023\252\026"
+	.ascii	"\346}\314Q1\377's\377\356\2671\027\235+\f\235)\f\235'\264\232"
+	.ascii	"f,\326\371\001\353\354\240\30143HZ\261\316\007\252z\256\231@"
+	.ascii	"w\351\246\352h\363S\3135;\265\230\346\243\321\271\311\350\314"
+	.ascii	"dt^b\235\225\214\316IEg$$g#\321\271ht&\026\235\331\242\363\320"
+	.ascii	"\235\205\356\034$:\003\211\316+\353\254\272\363\273\263\017\235"
+	.ascii	"\333\302\200>\316#\317\270\347\023\275f}\215.\236Z\347\326j\272"
+	.ascii	"\243\335r\335`\272\305t\317\265\320\203\016t!s37\031\356:f\325"
+	.ascii	"\200\200\352m\005\313\364\224\231e\032\215&K\377\344\001N-R\366"
+	.ascii	"\031|\347\330\013\023c\377\245r\206\177\374\3447 _\016\037\271"
+	.ascii	"\026\247t\327\327F\221\241+Dn\210\222\204\237\301\217#\341+\310"
+	.ascii	"\233\003\250\316\037$B\355\340\233\357\317\262\020\236\2741_"
+	.ascii	"\324pp\274\2641\376s\257\031\001\261\330)2\224\240\371\270\360"
+	.ascii	"\330\275\035?\021\230\262u+\304\206\217\302\234\227\275b\360"
+	.ascii	"\235\211\324\217\241>t\243I\373\344\311\332j\360;\254\261\265"
+	.ascii	"\243\263\276<\304\177\262\013\373\356"
+	.string	".\330w\215\244g\321^\257\317>O\300\336k\017\366^\033\237\203\230\323a\367\215u}\322aN\177}\327N_\346\302\252w`\325\263z\0041\247\301\2527>\371\230\323\241\325\003\237S\346\364\227\240\217_\326\310\325\3017]\007\3574rU\337\301\2633\325\304\274oP\233%J\373\366WklN\250\032\373O@\035\blJ\353\346\266\266j\3656$\217\023\272\226\245i2\024 \307\326\255\225\265\202\022]\224e!<s(|\205\207:\304|4\341\251\236\302\367\264\177Y\364\350A\335\210\311\303\201\005\305\204\177\2716o\304!lh\204\335fY\017<\013)\035n=\275\247\315\322ji\337\332\267\265\325\003/\f\263\343k\252\343s\203-t}\360QiX\244~\316p\013\327wZh\360\3361,n\274\266\323z\341\226\322*_\310\020\354\342J\213k\353+\031C\311\305\245\314\212Rnu\245 \341\305\256PU"
+	.string	"\277`\\\360\222\321b\375\202qA\331\225\002\003\373\005\343\202\326\013e\327W\b\255\032)\\\024\275Fhqm\211\370\212\241\325\325E#\253\310YW1\224[_[^J\031\311/\027-\266`\260H\306\330J\301\225\314\352\362J^!Y)C\253+\371\245Tv%\331hX[\b{1d\323\2257a\322\326\364Xyj\001\274"
+	.ascii	"`z6W\222\304\233\355V\006\317$\245%j\351\231y\201;\327\222\277"
+	.ascii	"\364k \346#(\027\322J\037\205\004\2134\357\351\237\035\2652\263"
+	.ascii	"\002/\322\022I\366\271\367F`Ws\"\255XK\3262\231k\253k\240\346"
+	.ascii	"\236]\331\0301NF\245g!\315\363\2646\313\216\366M\351\233\256"
+	.ascii	"\rH\017\361\251\205y\3371\tH7\367\220>\351?\214\004W\233\355"
+	.ascii	"V\254\036\255\231w\023\351\221f^\214\217\365~\006\202\003\201"
+	.ascii	"\264ik7\215\337u\355lc\277l[\037\370+\242i\303E\357\275\3544"
+	.ascii	"voX\201\342\257\317\236\303\220\230\3671{\231\363\340\351\020"
+	.ascii	"F\303h\326V\213\337u]UhP\023\2243\021\023\361\331u\370\216\226"
+	.ascii	"\210\221vmmm\365\3034\367\0308\201O>s\233\244]\342\335$>\322"
+	.ascii	"\314\n\036\331/9\371d`O\340\032>o\001\200\355\250q(e\221C\206"
+	.ascii	"dDFAJ\223\244\003\200\002\221\251\262\316\001\021\020=\250\034"
+	.ascii	"\033M\222\264\033\352m\247\212\312"
+	.string	"\013bHG\030*z\nj \330Q\263\305\337\265\220\211^\352\"\213\264>=\223\362Q/\343\335`XW\234\232\3437fS\221\177\025%\2643\354\315\272C8=\321\f\206\bD\364A\022\3119J\253vF'\264\b\242\340}E}\246\305\220\027\245\206\001\330\250\341\035\024\253>\264\365Eu\237\264k\202\316\004&\006mX\231\343\236_\237\030r\215\272\235\254\037\265dp\036\334H\260g\343\274\036\230\200+3'\3701\204\031\001ZYv\351\275~\006oB\005`{\240\375\263\330\017r\350\360\311\266\227\"\020?\021\311|\207A@>\326\221\366\177\212\357E|\034\214g}\350\333\013\005\331\363\2343(&\363\333\255\n~\r\313\200\266\016/N\251\366\254\237\351\"\265\rC\275$\270\274\217J\007\022\262\002\200\002\2265\350\337iT0\003L\231\377Os\375\200\030\037\034\340\t\002\n_\227\370\007IQVZ\253\375\251"
+	.ascii	"X\216\330\022v54\2178\203\362\346\356\234\227-\031\204G\342\033"
+	.ascii	"\322\206\335\017\216e\354(\207\215P\200\366\034\373\306\201\324"
+	.ascii	"wf;\2015 \270\325\362;\2221\251rD>\r\004\2110\236+\3646\300\204"
+	.ascii	"\310\355\341\201\256\017\201\343\3405\2366\2331\253\261\001]"
+	.ascii	"\034k\226$\332\250\304{\270\001\345\357B\007pI\220\336\220\300"
+	.ascii	"\234\037\205\023RG\362\230\324.~\\B\224\234D\242\016\315\267"
+	.ascii	"\367\004\013\334\250\311\267|\200\310H\373[\365\201\246\021\247"
+	.ascii	"t\017\276?\337\236\026\211\220t\360\207Ap\254\240C\315\271\251"
+	.ascii	"\305\352\312\275)\241\214\"\016\353\300\034&\0356\354j"
+	.text
+	.section	.gnu.lto_isAltitudeOffset.51.f2667454decd0e2b,"e",@progbits
+	.string	"(\265/\375 \350\205\006"
+	.string	"\"\214-4Pm\222\016\303\004a,\250)\242a\313u\024\310\266\221\346*{Kv\325\376\335\016smO\343<\233\305q33\225\210\225\227Z&\b\363\016\215i\226l\231\002c.\231GY\324\346i\234\005\361@E8\270\f\305 \3410\325\306]\b~\232\206\312Y\357U\316\222e\233\b[\301\247Q|?\nr\335\215'8X\254\323\345"
+	.string	"t\302&\200\361\301\322g\036l\031\337J6\321\217c\033H)Q0\311\004\225HI2\215p\374\235\267\214\220\320\371j\246\001\352\210T!\202\222\231\2716\352U\274n=Z\351\b9\301B\236b\300Bf\216X\350\242\267\376\006\377\301o\021\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getEstimatedAltitudeCm.52.f2667454decd0e2b,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`m\322\001@\203@\324\204\025\340D\216\216\202\252\251\225sS\316Y!\232E\275\303#)\364\272t\b\256"
+	.string	"`Q\004\267sKr-bwr\333{K\231R\326d6\021N\260\0239oj`\200\016\013o\003\023\036\236F\352\274\f\201#GAzS\214\322\273\\{\025\245bB\032a_\344\027\345s\030\302\223\257\336|\217{K\005\250\b\345\310\276@\251\030\366\331\252\310v:5\340\002\005\301dwb\264\262'\255\244\303\366\307\276\370\037\007\371\230b\227\206\3456*\211\021\225\335}\230\017\2707v\001\367\246\031\247\236\224\377\2203\017\222\224\312\002=-\007\273\353\254,\212[o\273\300\266\201m\213\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getEstimatedVario.53.f2667454decd0e2b,"e",@progbits
+	.string	"(\265/\375 \366\315\006"
+	.string	"B\21504Po\322\001 ;\323\216\251\351A'\207\210\336\002\002\265E\025\375q(n\315\032\347\235$\321K\260\r\365D\025Q\2141\366\237k\261`t?\330\275\211\224)\005\326d6\360U\257\0039\256zpx\020\rn\363\026\"\234\206\352\270L\201!\207\201r\025\204\224\303\\{%\245\032\204t\302>\311\257\350wX\302\223\267\316|O;K\005\030\205\262d_\240\324\f\373\323\356\256\225d;\235*0\262\242p\262[QjY\025\206\342a\373cc|\220\207|\034\363\332\260h\034#\212\022\226\335u\001'hg\371\201v\246\032\217\317\350_\344\323\207I\212%\002=/\t\273\353\264D\027\267\336\366\201m\004\333\030\001\007"
+	.ascii	"2\001\0238#&\016\345\256!Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f2667454decd0e2b,"e",@progbits
+	.string	"(\265/\375`\311\001\215\013"
+	.string	"d\020\305\002"
+	.string	""
+	.string	""
+	.string	"\002.\177\026\320\231\263\346"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005&\027\200\204\001"
+	.string	""
+	.string	"\003\005%\030'\031-\032,\033\002$\177\034\200\200\200\200\004\272\200\202\0056\035:\036 "
+	.string	""
+	.string	""
+	.string	"\0058\037\002/\177 \377\377\377\377\003+!*\"\005)#($\0022\177%=&\301"
+	.string	"'1(\005\302"
+	.string	")\303"
+	.string	"*\"+#,\304"
+	.string	"-\305"
+	.string	".\0023\177/\0024\17705\1771\0019\1772\037"
+	.string	""
+	.string	"\200\200\200\0017\1773<\1774;\1775\300"
+	.string	"\1776?\1777>\1778\003"
+	.string	"\034\244\032\003\006\035\344\006\003\006\204\016\304\016\003\n\037\307\377\241\372\001\001\204\007\003\n\036\362\266\2248\001\344\217\201\202\355"
+	.string	"\001\304\n\003\n"
+	.string	"\260\326\225#\001\342\026\003\017\037\310\244\001\003\017\"\201\234\313\322"
+	.string	"\001\344\001\003\017!\201\316\245)\001\244\006\003\017 \304\006\003\017\006\242\026\003\017\034\344\027\003\017\035\244\032"
+	.ascii	"/ \260\0021*\233\003\f\355\f-4\332\362\206\326\026\272%\322\353"
+	.ascii	"6/9\357\367\320$\032\206z\f\034\270\t\272dp\024\034\016\201\214"
+	.ascii	"\310\322\371\026\306\302\276\005\004\351\261\177d=\221\221\r"
+	.ascii	"\235\030\312\230f\334\344\201\224I\203\343\357x\206a>a`&\217"
+	.ascii	"\346\300\3160%:\343q\276r\210\261C\211\234\003\237q\031\217Y"
+	.ascii	"/\003"
+	.text
+	.section	.gnu.lto_.refs.f2667454decd0e2b,"e",@progbits
+	.string	"(\265/\375 \357\035\005"
+	.string	"\362\316''\220G\313\030\377\377\377\377\377\377\377\377\017\210\270 &\210\211\024g\1772\274%{\227\244k\271\333.I\333}\302\335d\n\257\032\260\233\254\354\250\224u\270\266\241\232\341\332\205k\025\256M\260\336T{\220\330\240Z\315d\t$g\"c\250\035\240\276Pk\221\254@d+\324\026\344\210\342)Zrn@'\036\273\307\211\262@Z\215\263\031g\214c/\333K\332B\254\3041D\332\207\263\f\350Ec\241h\235\35052\246\326b\247\305\0214\364\354\236"
+	.string	"\212\033\305\"$\326\202\330\332\016\347\007\361\366\363\207"
+	.text
+	.section	.gnu.lto_.decls.f2667454decd0e2b,"e",@progbits
+	.string	"(\265/\375`\022\031\305v"
+	.ascii	"\372\276D*R0\220\312I\007\266\374-\340\247\340_\353\3019\327"
+	.ascii	"=\213N\346G\320\023\223\306\273h\330\230\373nx\315.\226<\310"
+	.ascii	"\242yx\317\374\212\214C\223AD\311\246\016\376\370I\362Q*\266"
+	.ascii	"\260\243\021@\250 \204\013\020\023\314\306\335yQ\2112\250d\323"
+	.ascii	"\204l\231\002-\002\202\002"
+	.string	"\273\002\227\340O\372OH\300s\330\r\307\211Hvs\375\370\240\254\241\r/\257\273m\240\201\006B4\320S\366\003\317\371!}\035\023\371\200X\215z\226S\317VT6)\326\334\020%7=\243\251g'\352\271\210\032\202\261\324\363R5\212\241\232pR\031\f\207\341'\t\246;\177a\271\357H\265\335\336#9\250\235\335\364)\250g\022>to\217I\370N\202*\304D\276\353\306D>\336\302\\\3709\202\273\374\204\004G\221fM\366S\207\206:8\334\364\036\250\347\021>\336\343\021\276O\240\236\216\211\262\220P\225Y\252\220a\031\321bU\tysc+k\246\300\334\332T\254+7\254\360\025~\036\216\331\330\b\027\244\221\233>I\225\361;\\\025^\013*B\303\307\233\233\236\327~ny\n\253]g\267\225\356\006\3613\273\"\203\224\233\262\031\237\361\323\210\251\234k\340\264\363(\333F\353n\203|\244\260\330\304\334\264"
+	.ascii	"&\362\245F\352\031\355AcZ\202_\365l\344\013b#\0377\023\371\204"
+	.ascii	"\330\203\217\313\222\316R<\370\230Ym\007QpD\310\223\233\242\354"
+	.ascii	"\301\367s\224\237\2410\231\021\272\244rvZw;\3643\347Lr\354\246"
+	.ascii	"o\231\310\247\262\007\024\234\204\271H\377{d\353g\005|\230\240"
+	.ascii	"\365s\013=~n\221\025\202\307+\370\357\214\237\003\310\301\304"
+	.ascii	"\253\237\215\315\377r~f\332\260\022q\243\377\006\337\005\307"
+	.ascii	"\333\324D\234\304\317U?\303\360\242\377*\223\377q\220\372Y\210"
+	.ascii	"D\341\377\002o\321 \376\013\302\317.\374,\343\347\250\237\217"
+	.ascii	"?\027\177V\341\347\365g\024~>\341g\027?\223\360\363\b?\177\360"
+	.ascii	"s\007?k\360\263\322\317+~\256\340g\n~V\361s\212\237Q\374\f\301"
+	.ascii	"\317I?#\375\\\342g\006~^\340g\003~&\340g\021?\027\375\f\342g"
+	.ascii	"\242\237\177?\373\376\357\375\034\3643\320\377\020~\366\371\271"
+	.ascii	"\347?\333\377\264\237;\374\254\376|\177\346\377z\377\261\374"
+	.ascii	"\007\341\377\333\177\267\377,\376\257\375'\373?\301\377/\377"
+	.ascii	"\325\275\275\275\275\037\025\373wH\374C$\002?<0Y\272n\225\017"
+	.ascii	"\214\225\036\235\233>\225R_\202/\020 \334\306Lu-\231\244\356"
+	.ascii	"\215\372\373\203o\327\371y\273\336\226\266\215\344w\246\244K"
+	.ascii	"\034\r\243\376\"\300sx6\324h\361\335z\336-\216c\241N\222\371"
+	.ascii	"\002kf[\342h\025\365\314q=z\260[\007&\317Z\222\253\356\t\217"
+	.ascii	"\347\345\301kFm\347\350\340\325\305d\2268:D\375m\336\253\337"
+	.ascii	"\034\317\233\343\356P\333\266\372y\215iq\345u\026S\307\357\216"
+	.ascii	"\277\361\351&\353n\021@dpusn\372;V\373\317\263\004\027C\336\235"
+	.ascii	"\372\373\373Z\212\331\335W;m3\223>\347\035f\243\377\207Q>\240"
+	.ascii	"\321\243\272n%`6\250L\332\244|\274\200\376X7"
+	.string	"r\250\333f.\321\202 \227\3171\315\241\266\201\200h4!\275l\2034Sg\337n\233[\031\244\311\302\262u2\227\255\023)\324J'\262\273m\n-\323\244\220\274D\013\322\\\2429\233C\255ld\243I\001Q\225\316\346R\316\331\024Z\242I5\227\312 \315\241$`G\242\334`#\345\205\221Ke\343\250\332\222b\n\321-[g\247\351\346\264\032\315<\240{\313\311L#\305\203\335\222t8\222V\244\234\\T\225\364r\266\222n)\346\354\026K\302\350\252\b\220-]\033a:\244\220\255\246\252\321-@U7\222\233\256\273\221\335\375cn\265\335ZBK\260\252\252\356\254\020U\275\205|\253\321}\323\326\2705\227h^\316\2447*h`=\325\"\031\254\323\004a\252h\310)M%G\005k\346\260\273i\333\366\270q\251\351\270\351\305\021\002e\306a\"\246L\3459#\347G\032\025\267\335%8\226\334\335\033-Z"
+	.string	"YNp\314\240\376\327\3062FVV\331]\336)v6\b\240\034\3171\255\233^\345\245\301\317\242[\303\356+\331\274\351o\022\365\205n.\362\361\336\036\027\371\376\233,r\362\326E\344J\335\376A\331\342\225v\323\333\227\367.\362\267\271\216\217\362v\332-\305l"
+	.ascii	"\020\263\001;pI\244\316|\351o\221\034\346\364(\311\262[\342e"
+	.ascii	".L]\0325^\322\320|\261\201\365X\016\337q\036\323a\034\030\217"
+	.ascii	"\355\370\006~\362\034\206s\256\3438\277m\267\262\273\317f\316"
+	.ascii	"\310\311\255\3416q\020\274"
+	.string	"i#S\206\343\200\320n\25690-p\034\307tY\024<I\303d<\207\307\260\030\246\373\262\200\fL]w\033\250\215 .w]neTt\212\325\3201u\222\340\361xQ[\261\032\306\316(\315\374\250\344\261]%\255\266\312\274\271\241Rw\r\017\031\0326\346M\365\364\320f&\263;\253\221v\016\304\205e\351\330;\332p;5\332\3300\346\246\267\316\341T\034\324\244\224\271\351\315\341p\377\002\306\253\013.\335\361\006e\316\215\016\235\013\267\374y\351\315%\233\340\341\335<6\303q\305E#\2063\"y;c\304\224\254i\335\335\335.>/\252+\256<Uie\213\363\246\347Q\306\211s\345T@g\2075\206>\261q\246\353\332\375\312\351\273']\231^\2336\027\016{U]q]\037\\^t\367\315/\034\364F\030\031\0377\275nn\373\030\321\202\205u\251~\312\300\320lQ\203\346Gs\327\204p\"\343$"
+	.string	"\005\b\0212\243\016\\\220\204\001\273j~\327\\\345\fM77\275i|V\255]\035\267\251\021\0032\325\252\237\373%3w\315\360\035\267\235\345D\332)\320\025\027\304-\257\227[FND\272\344\312\374\232\221\363\355=\335\202\360\360\fl4\254\335\364\212\371\035\203\306\314\027\263\245z\303\374\322\375<;>r\260\021\273\351\325$\230\237\307\347K\016\214]\016\352\1777x\361r\277p \324I5Y`?6T\375\345\207I\024<*e\270p\271]"
+	.string	""
+	.ascii	"\373Q1r\243\316g\205\245D\257\013\267\371h\224}\321pE\213\226"
+	.ascii	"\013\307A\021\2758P\224\334\375\356\027\256y\302\230xQ\221ay"
+	.ascii	"^,w\371\035e\013\031\003\373\t{\362L6qs\343\270\020N\024\r\223"
+	.ascii	"N\336X\232\003\2343\277+\365\327\n_\266\347e\273S\337\351v\252"
+	.ascii	"\001\373%\325\363\235\362U\251\302m#\310\301IS\023j\345\020)"
+	.ascii	"`c\324\373\262<\251p\263\207F\231\357\251\3367\203zvF\203\006"
+	.ascii	"\237\327\224)\034\307fm\325\301F\333a\345uw)\021tC\223\037G\360"
+	.ascii	"\312\242\\)\254\246\"\231j\225!Q\352\322\250\337\341BF\366\204"
+	.ascii	"\302\244\261d\207L}\362\204\343L\374\326\222F\352\276\306\306"
+	.ascii	"X-\025j\245W\f`;:\324_1\276M\232\260Z\332v\263\203\327\021-\256"
+	.ascii	"\274tO\315w\2310\271\315I$Z\\yi\233\260\260\273\203\317\322\370"
+	.ascii	"\210\311R6\341\324_$|\225,y[\001\312\266\221\264h\223\276\251"
+	.ascii	"O\253\360\363\036\271V\327\254\221,\233+\256\274\356\254\022"
+	.ascii	">4sg\260\210}\335\"\327\b\267\245\235\206A\0277u\351\227\372"
+	.ascii	"T\313\313\353\0229\301&\313\350\236QQ\211\r\371%r\247R\020R$"
+	.ascii	"\357\246W\b\267"
+	.string	"\005\353\360\005p(\004\306X\001\202\005\026\207M\354\022\220\035\256\030\364@=\005y\210B\240\221ge\213Ga\321:\f\316P\002\032_\b\207@\245'c\261\311\270B\r\240D\364\003\200X|z*\006\005`\"\002_0\001W\ff\f\241\240\200?\207qt\034\016\201A\030,\360\t\351\310\n_ E\021\235\036\220\021E\024\016\037\210"
+	.string	"\305\022\212\0242\220V\246\250a\220(D2\036\243\220\220Z(\032a\260E\342\257\t\270\016S\366H,\006w\232X\242\3208\364\r=)\261\253\323\207\243P\b\211i(\214zQ\2642\025Ap\212z\2612\361"
+	.string	"=)\255\036|L\034\241\234\200~\222\216\330\341\212\225\005\273\036\233\232D"
+	.string	"\016\035\306Qp\211\030eD\n6\035\235\200C\r\234\210\302'#\260\007\350\304\3211\252(\214\261\032\241\204\004\220\2612\021;`\215@\226E\013E&\242\320\204\243\213"
+	.ascii	"\210\353\312\342\b\300\f#\220\211\030U\274\340\303p\215\201B"
+	.ascii	"p4\\c\354<\255\354q\006\213\017=\021\034\261"
+	.string	"\303\025E#\360\002\366\b\034\3760\255,\360I\310\0363XY\3400*8\004\006A<)y(\n\215\300\022X\241\006@\036\236\224\204Z\034\003\370\210\225)\212\025\262\303\025,Xa\323\320\203B\343J\\\235\324G\200\342\001\024)d\374\236B\205\t\025&|O\241\")I\005\212$\365(\222PvhX,^\260\264s\030GHGc\361H\\\217\004\274\b\265\032\221\330b\321\210\324s\\r\0226\021\213J\306\225]\237V\250\031\3541\352E\020\273\344\004lQ\024\376\210\307\340\222\020\352\350\263\006\2051V\246\240\343q521\001\227\202'\204\253\021\330\002\223\021\b\343\207%F\025\203K\353\020\352\tx\034j\202\032.\255Ga\221\b\304.\241HR\207k\214\245\246`\017\273\224\202%\n\243~A\342\214\343\322\272B\321\310\036\227\212F\340\013!v\351\004\004,Q\370c\227\216.\326'!\253>)I\251"
+	.string	"\027!l\240\006\217\210E!+<\026\241\220X\030N\302a\023\022Q\b|B\n\032\217HG\"~L\245C\302\330\240l\021\271Z\330\270\021\363\321\305G\225%\212\023\255\274T\255\307\227W\017\270\013\354\250\206\334\024\335\201\356@yp\200\244\361\205b\035\345QG\316\211V\007\246\372\243:v\324\261{\276\345\200\343{\206]]]9Ai\234C\250n\332\222\371XY\035q2\325\344\314\364\266\240Vqd\346\250\2227}\033Z\225\2329\247\200u\267\220\317\032\033\256t\270\201\326@k\2400\360 \201\330\210Y\342\206.\217\302\200\336\bZS\004\316K\202%\250r\t1\007\362\034B\210fF$IRH\007B\n\020\204$y$\213\355\001\022@%9\323:\247H\233dc\016H\311\225\275\320WR\317\257\250\351\376\0160\274\265\364\to\234\352\311K\212a\350r\247\3759\225\266\005\254v\340f\236i;\234"
+	.string	"e5L\347\336\327\317\370o\220Y44\23187\371$5\320\217(\016\320=$w\223[\033\237ICR\f\340bwJC\324\231\315+\324.*\366y\207\002\374\007n\210\375^$\037"
+	.string	"\261\036\217\256\350zV\247\254@Bi\270\266B\005\235\rH\004\313\311k\207\224FT\337\337\025<\232$$OA\013\"#rF\025GH\f\270pD\321i"
+	.string	",\326s\202\030"
+	.string	"\"\240\325\246Qg\376\320\027\225\374\211\3209\333\257Q'\005\\\t#\231Q`\200\343\262\252\266\020\211\342\273\2501\342OKy*\330=\253\260\357\353\272&\226\001l\231\215\372X\037\004\b\247)0\372\243Yq\020,\311\335Y\274\253\006\013\\\245t\267\213\004\271\325\304j\004\206\306\346\ng\007\210\332/u\227#\242\230\260\006\232\202y\035\230\374\t\362\227\305*5->E\202\332\013\fYpZa\361\334'"
+	.string	"\fN\017A\267\251\323\362'\245\300x.\235\355n8\371]\023\315\326q\351\373\n*\240\376\031\220\260\256\003W\033\253\031[.\020\247\030H8'\322\035NY6\3040\261Y\210\222u\372\022\230LY`\327l\261DX\306\243\n\rx\304\254\2449\331\204b\276\003\276\033\030K\3770\241\3514\323\003\314F\020\3170\356\245Q\345\210\372\325\234i\240\225\334\277\307\336\204\316\375\311\r(\342\347\005\356\316<:ws\200\360\224\245\305f\245\315\342.s\315\353\362^\2156\312\272.J\366\220`\2348\337q\264r\003\263\375\252\301\255\024\013\372I\216\342\344,\241L\354/\326p\022\005Gk\301"
+	.ascii	"1f\237\322\037?(P\f\217\347\003\b\366\305\003\337\262z\222A\206"
+	.ascii	"\b>\314\353+\022\340\266\\\274@>\346\274<z\004\236:1\314\233"
+	.ascii	"\017\362\354?;r/\205+\342\265\246\ts9\203\245\214g\326lh\236"
+	.ascii	"\034>\222\350\303d<4\306|\332\316YZ\266\300\007\235\313\220\016"
+	.ascii	"B\301)C\227B\254J\343\030\251W\232d2[\362\207pA\004cV\255\260"
+	.ascii	"c\303S\340\343\324\200_ \031r\022\370\306v\262\003\240\036]l"
+	.ascii	"\364\002\3270\231:A\301\257\260\017\233\315\210\362\321\002\236"
+	.ascii	"\003\317#y\350\350\032$[\210'\277\312tF\302K\237\336\342\314"
+	.ascii	"\270\222\001\210\241\227\334\273\210F8\275\204d@\311\275d^\245"
+	.ascii	"z\214\270\035\001\256-\375\312(\177\203\256q)\302\204}\016\232"
+	.ascii	"b\205\005V\215\252X\316t\206<h\3335>\214\305\177\031\204\250"
+	.ascii	"G\242@H\360Ze\r\360\360\006nH[h,V\004\316 \247\332\r\026\352"
+	.ascii	"\n\2470g\336X\233\001\222\030\260\306i\177\244(\254j\325c\226"
+	.ascii	"9\2559\n\311\332\367\240\301\177\324\016\357\203\213\231\375"
+	.ascii	"<bu%M\204\250\n\005,\234\315\252{\367zN\350\300\204\365\370\210"
+	.ascii	"\376\371$\005\307\201\304%\212\236\263\bd\242g\021\321\234\371"
+	.ascii	"\334\321+\254\350wnp\273(\t;\237\017u\366\b\242\370\311,n\200"
+	.ascii	"\321\322\317\2071\262\032:&i\013\2224\215y\314\252\304q\361h"
+	.ascii	"\317f\200\364\252\201^\276\003\242\354\275\267\222\330g\367t"
+	.ascii	" ;\006L\300[\nFw\376h\013\207G\231_F\376\304\364\212\274\275"
+	.ascii	"\231\036\347\360\237\325Y\006o\302\356\340n\fs\346n\365/\202"
+	.ascii	"w\314\370\f\307\267\024\377\r\357\235\337\266|b\036\006\372\f"
+	.ascii	"\351\"\352_\307q\346zk\266\323_0:\254\002?]\376\017,\323\370"
+	.ascii	"\316\345\213\224\2478\345\322\230\235\226\232\323\256u\323\363"
+	.ascii	"\3626\006\371\232\375r2\354 |\016\234\034\331\017\354\350pG\306"
+	.ascii	"\311\367\033\314\231\327\233\376\304\364N\373\030\237\273}\230"
+	.ascii	"\321X\217\223\250{\363\357\270\243xG\270I_V\306\353>s\023\361"
+	.ascii	"\303\350I\033\326\f\234\033~\370\220\234\245\241V"
+	.text
+	.section	.gnu.lto_.symtab.f2667454decd0e2b,"e",@progbits
+	.string	"calculateEstimatedVario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"positionStrokeBoundary"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"isAltitudeOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"getEstimatedAltitudeCm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"baroStrokeBoundary"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f2667454decd0e2b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2598 @@
+	.file	"servos.c"
+	.section	.gnu.lto_.profile.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`:\005\375\025"
+	.string	"\204\031.\006"
+	.string	"9"
+	.string	"\340\371\347\236\001\030\002"
+	.string	"\002"
+	.string	"\002\001\002\002\003\002"
+	.string	"\002\004\001\002\001\002\005\002\005\006\002\006\001\240\342\234\212\n\002\352\263\360\321\b\003\004\251\257\310\332\b$\002\007\002\b\001\004\005\351\361\316\337\001"
+	.ascii	"\006\214\216\274\341\007\007\346\252\251\302\017\004\002\t\002"
+	.ascii	"\n\b\t\224\305\200\177\006\002\001\002\013\002\001\002\f\002"
+	.ascii	"\t\002\r\n\r\232\242\313\204\f\n\002\007\002\013\t\002\n\016"
+	.ascii	"\017\320\276\240\262\f\004\002\001\002\016\021\347\226\374\373"
+	.ascii	"\003:\017\002\017\002\006\002\020\021\002\021\006\002\022\002"
+	.string	"\023\002\023\002\006\002\024\024\022\023\024\025\026\030\340\216\253\313\016\004\032\243\230\366\360\007\b\001\002\025\034\240\367\360\225\r\002\035\303\234\376\371\001\006\002\003\t\002\n\036\037\206\353\317\360\016\f\026\002\026\002\027\002\002\001 !\320\214\206\364\001,\030\002\031\002\001\001\004\001\002\001\"\355\275\211\266\003#\370\243\334\217\005%\224\217\314\331\rr\004\002\032\006\002\033\002\006\024\034\002\034&+,-./01\316\226\366[\020\002\035\026\002\0262\377\341\234\356\013\00234\221\277\333\370\016\216\001\002\007\002\007\002\t\002\036\037\t\002\r\002\007\036\002 \002 \n!!!\036\002\0369:\244\214\210\351\nH\001\002\"\002\004\002\005\t\002\n;<\373\304\266\213\013&\023\002\023>\342\201\222\246\004\002?\230\227\377\334\t\002@\362\324\245\255\006A\217\240\261\222\004BC\247\336\216\365\001DE\302\234\216\234\017FG\341\277\213\314\016H\240\342\234\212\n"
+	.ascii	"\200\235\250\361\261\200f\202\223$\251d8P\202b\250h\364\022@"
+	.ascii	"U\026\343\316\f\215\f%M\375)l\006\300\321\335\337\031WB\251\311"
+	.ascii	"\265\326\3506+\200\372\016?\202\300\315C\345g\244#\025f\257M"
+	.ascii	"u\035@f\227 /`\211\260\342Y\t\200f\3343Of\222\022\364\311N\225"
+	.ascii	"Hk\272\343\365\234\252\217\200\204\371\325\353\331\364\023f!"
+	.ascii	"\300\222\001B3Rz6=\206\343\235\362\n\220\371RT\0209\ffH\337m"
+	.ascii	";\2503\233\251X\352MY\017\253q|k\3069\231\377\353\020\356\227"
+	.ascii	"\360=*\204\036\017\003\345#\266\233ou\310\344\261\275;=\250h"
+	.ascii	"3\372Gz\263]\271\243f\243S\3530bii\016\220\366 \234\371R?\340"
+	.ascii	"\302\212\240_\034\270Cth\324u\243\366\002\375\355i\210\254m\360"
+	.ascii	"\204\321C\206\243\300d\201\264?\261\276\241KG\0355\362+\313\274"
+	.ascii	"{\267].8\356\305\343\317\372\241\364?\346\0343\023\035&\371\213"
+	.ascii	"s\310\240\300t\305i\016RC\270\335\321z\234\325\347t\230\236\371"
+	.ascii	"\371\377\231\325\235\"\034\310\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"}\004"
+	.string	"\364\0039\001"
+	.string	"\027"
+	.string	"\001\004"
+	.string	""
+	.string	"\005\001\001\003"
+	.string	"\001\007\001\001\002\t\001\r\017\002"
+	.string	"\021\001\001\030\032\003\034\002\035"
+	.string	"\037!"
+	.string	"\001%1\0012\001\0033\001\0034:\001<"
+	.string	"\001>"
+	.string	"\003?"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"' \200\202A\352\001\217\n)\206z\3207 \005\r!\327mC\200Z\254\215"
+	.ascii	"m\216\333U\207i\001u\317mA\360\327_\230P\366fm\263\310\225\003"
+	.ascii	"\363\215}\016\376\030h\226\355T\216#\214\035\244\031\200\021"
+	.ascii	"~ '\033$\f5\030\272\270\340C"
+	.text
+	.section	.gnu.lto_.inline.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`\243\005\025\026"
+	.string	"V\\hI\320\262*\215\001+m\347@\266'\203\225\212\332\215i\fl\016\033V\344\343\003j\235\206\366\324\022^\032\201\376B\363\222\350\3640J\365\200\210\0262Jy5^p\006\312eC\245\303\347M\334ZEe\235m\313\236|\262\245L\001N"
+	.string	"Q"
+	.string	"_"
+	.ascii	"\213B\222?\203\325u\271A\376\346\234\"\217^\1775J\034\221g\243"
+	.ascii	"\224\023m;\246E\257\306?\265$NlG\017\222O\331\036\321\206\003"
+	.ascii	"\265\257\257}!\332vJ\006\367e\355\234s\206\017[\026^L\226a_\302"
+	.ascii	"\026\004/&\203`\362\310\341-\003\330\021\033\321\253\200\321"
+	.ascii	"J\370\257\375\311\350\364\264EK\214'\347 \223\001$p\226\fY\022"
+	.ascii	"\374OV\365W\255\276kkM\3149K\007X\215\232\"}D|\350\251\326EN"
+	.ascii	"\006\227\372\244&\351\222\342\234\263\324K\322n.B\005\016Y\215"
+	.ascii	"\373\233$\270\206?\030>7\344\364\221\023\342\2414>\221\355\211"
+	.ascii	"\037\020\020u\331\227\256\255\021\342\005\350\034/X\376'p&\343"
+	.ascii	"GO\220\004\264\241\0254\006VP\322\225 ,P\240\\[#\372l\016\\B"
+	.ascii	"R\205\234\222\273\235\357\006\306$KM\367C\240\301LL\r'2j\234"
+	.ascii	"\325\344\230tb\n\334i\222W\243\006\377\227T\206\255\245\231s"
+	.ascii	"\216\306\360\203\027t]U\334qhF\207\276\214=3"
+	.string	"tJb\0131-\273 \355\301\266C\215\3463\320\025\346\020\276\312\352\250\370\225X\237\212\254\215\020\362\2401\036P\230\260\022E\264\204\237\207\007s\343@\365\222?<\230\033\004G\2302\200\207\250\3415\032\231\241Ia\235B\007p\002!!\272\362\022 \344D\006\243\216PfH\212\024\224\244Pj\337\240\017\247c\n\024j\244\255\270\201\236\026 \021\315'\355\3659\320IMC\274\223\3213\320\347\236@H\030\322\225\264\023\035^\246T\234\030y\263I\006A\3222\204\027\360\223\217>y?\030\216\\\276\032L\216\234{\0024\373\343\3746\364\344Jff\311}pN\374*=p\252\200\317\301my'\361\261C[\307oV\310>\264.\300\206Y\263\306^\3624\023\262\034\006o\007\334^\202\f!B\"\236\013\346\353\340\035<\031b\271\267\004\n\034\022b\245=\326\366u~72\251\334\213\264\374\232t\300I\203\260\261"
+	.ascii	"\t6\332\246u`\262 \226\347Z0\231\351\022\225kv\335\202\313\254"
+	.ascii	"`\353\332q\365c\356\21143)\374\023\341k\337(\273\350\006\342"
+	.ascii	"\3437\267q/t\364\236w\346\242\377\246ID\324z\317\257\206\035"
+	.ascii	"\263\231at\027aed\226N\273\310\316`o:\275\032v\327\341}\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`\242\004u\020"
+	.string	"\326\223A9@\305(\035[tAQ\200\013\315b\025-\300\006\004QK\216\0260X\017\321\240\200\315\025\026\006\3260\fo\207"
+	.string	"C\306\246\f\350\023\217:F\210\r\323@\020\241\264{\247\224\0020"
+	.string	"2"
+	.string	"6"
+	.string	"\004\003\215~\031\252\225\212[ \017m\270\221wA\rw-|r(\224\261\254\261\274)\277\255~[\345\267\271\225!G\376U/\017\235\335\203R0\002[=w\331*`0\233\246\031j\344\217i.\f\t\275b\214\261E8\310r\316\260#_\271\0042\363}e\006\233C\315\341e\377\002\261?|7\364\267\001'\266\211\357\022\233\304\316\344L!R\210d\031YF\375\234>\247\030E\232vC\377\302\234,0'o\027\035\342;::\002\342A\343\320_6\355B\251\224\371\026\177\001m[\321R\264\025\220y\263\364"
+	.string	"_\356<\217\377^\307\177\217\252,\342\3372\226\366\230h\353\021\337\262\f3\362\2777Kh\232\310\024\300"
+	.string	"\354\200\201\2501I\253H\2640I\326`\002\031\252\253n\022"
+	.string	"\222zD\222\2229u%1\224\366\337d\210\2758:\303\231\303\016\3633"
+	.string	".\r\376\275zF\n*d!\337\016\342\330\204\024(\261\341\"Q\353\341A\035\310v\230\255\f\3075\377c\r\241V\216\346X\254\326\320\021>b\207\364\034GK\312\275o\255|B\335\004\030\223\214\2465)\247\262\227\261/\330\223\306\t\273 \221w\f\265\232\307\303]\343\003\276\256\205\025\232\036~\227f\025}\330)\242(\357TD\303\022\242C\306\232\025KG\270:\342>\221\fJ7\346\025A^\030\030\335B\234\255\372\220\027\211\003\263\330\367\037"
+	.ascii	"\225\007\344\240z\020\327\265\204\215\260?\033\001b\005\230\235"
+	.ascii	"+\353\230%\006\274\306#O\371\230\352\317N5\321\262\221<\343\200"
+	.ascii	"(\3223\372\2078\n\342z\273kn\247\302\273\244C\003BB\b\320%4S"
+	.ascii	"\240\002\235\211\275\256\217jW\365\003\277P"
+	.text
+	.section	.gnu.lto_.pureconst.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375 J\025\002"
+	.string	"\242\204\017\030\200U\351-\300}1\022#:\215(k\037<\356\2132\372\335\226\312k\007\027\360U\227\032\247Q\372\242\017:\237\323\031\233\221\271\313Ky%\027\031\215[\214\304\035\256p\203\363\323\0163\013\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`\255\001\355\t"
+	.string	"2\016+-pk2\034\304}\216\375>\316\364\221"
+	.string	"@ \346\375?W\261\376\024cI\210\350\353\320Fl\362\3260 \352\207\254\251\271\342\366\377&R\246G/\232\240xl^HM\230rL\247D\231\024A\211~N.T9U>\205\177\224?\332\023\310\252\"@8\025\017\346T>\265\317\372\241S*\227\352\320\031)\217X\312-\255`\226\200\225\362JgC\371"
+	.ascii	"C'\245SRG\340\250|R\262\205\321\221\251\270x\r\002\274f\r7\020"
+	.ascii	"\bt\325\240\215\326\314\2745>\355\365\316q3wn\2169\344\234_\273"
+	.ascii	"\344\265P>? \203\033\334\276\026\001D\250\361P\250F\250\002\325"
+	.ascii	"0\007P\0022U\306\007\021\200\2514fEIs+Y\244\030=\025A\206\374"
+	.ascii	"6\260\263\223!\371\374\250D(\233\253]\252\374\227\022\327\370"
+	.ascii	"Y'\213\373\n{\206\b\021\354\334W\315\254=\336rvCxdaF\2537$L\033"
+	.ascii	"\021\r\025\2453\274\006\205\227\347]\271\265\355\270P\210C\375"
+	.ascii	"fO\271\020$\325_'\244\270sw\2766\036y\025\030\3605:\360#\016"
+	.ascii	"\353\035\334\247\232\245\343\2022\351c\022K$\026TX\240"
+	.text
+	.section	.gnu.lto_.lto.26ddd8d703b65655,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servoConfig_Registry.66.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375 \226M\004"
+	.string	"\264\007a"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\303\276\253\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\334\006us\350\364\005uq"
+	.string	"\005\001\006'\001*\264\340"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	")\"\301$\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_servoConfig.67.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`.\004\225\027"
+	.string	"V\247\216I\240TRc\233\221\215p\t\3508\207|\320\207\271c\017\251G\204G<\263\177\021`\343\013\023\\\371w\020\277\375\252\036M*\b\306\251s\001i\340,\374\032\2548X\363\211\b\003#\327\337p*O\240p\247\332\256{o)S\nr"
+	.string	"v"
+	.string	"\201"
+	.string	"\345\n\371\231\355W\3733\256\244\373\222\317\t\334\213\304\243\352^a\003\267\234/-\274\001\363\345\371\002\346K\353l#\264 "
+	.ascii	"\307!'\343\275\327fW\370<)\274\311\252{I\332\252\363\231\216"
+	.ascii	" \005\024\257\267{I\226\024\031\t\021\320\013\"a\212_\276\023"
+	.ascii	"_\211z@\225\004\036\335\236\370\026\337\027\257w\364Z\022s\357"
+	.ascii	"u\345\365P\334\346m\343l\307\330\344N\3069\025z\016\235\202\016"
+	.ascii	"B<\352\206\t\220h\234i=5\355\234\327HS\272\354\021\207\312\235"
+	.ascii	"\367\336\227'\034\t\224$\026/}\037\363\245I\221\030\f\373\251"
+	.ascii	"G[\270\253\366g\037\246(\364\302\026\311\256\221\325\264/\375"
+	.ascii	"\346\233nk\253k\255\276\312\204\342\220\017\035\357=q$\273[\345"
+	.ascii	"\225\2137\335\276\320'\016OC\367&\226sgt\332\370\321\342\310"
+	.ascii	"\275\302\005/\375r>\246\331\333\023_.\371\304\206\312\254\245"
+	.ascii	"YW\036\330O=Z\013U\204\304\312\332\037\205\213\r\261\214u\346"
+	.ascii	"a3.\254\003\025^4Z\370\027\216`\325\355\013\367Bg@\252\034\267"
+	.ascii	"1\274H\217*\370 \303\273P\256)\343\211\206\0071\351M\001\331"
+	.ascii	"p\037hQ\312\314\342\360\036\351P*\b\241\303\265h\270\242PNc\332"
+	.ascii	"f\360,\032\0050\266\207\353\250)B\005I\233c\241\001\200O\267"
+	.ascii	"_\245VN\306\0375\035=\267\017:3'8\350\215N*3\263\215K.-\201\273"
+	.ascii	"\345l< pP\02176\035\264&\307f\203\313\331\\jNwn8\033O\232\342"
+	.ascii	"l3\341=\323\317\247\342\326\217\005*\355\317\003v\330\232-cT"
+	.ascii	"\023\325\261&\"&\352\330\311{\357%\355\357,\246\2655\3731\337"
+	.ascii	"\227\220\n k\273\347e:\030\t\222t2\236D\247\244\322E\226Rz\361"
+	.ascii	"\300V\352\355\371\b\246-#\241\236W\355J\220\335\005Y\250\221"
+	.ascii	",\245\035\t\246$\230\031IRPl\260\002\231\2711m\021\360X\207F"
+	.ascii	"FB\212S\333\247.m*f\330\262\205U\321\2414^\351\216|\250\201\200"
+	.ascii	"4!\337T\351B\201\n\t\302\034\354\352\231\242S\347N\241\377\357"
+	.ascii	"-\231\034\210_W\371\222\202t?\f3\251!@\002\246\201dz\262\322"
+	.ascii	"d1\330\252\220L'=\243<6J\335\257b\016-jV5)\353\323i\203a\214"
+	.ascii	"\307\201\275\215\356\304G;\211\002\037\n\001\016\240\004\342"
+	.ascii	"\223\324^s\35461\016\376\342\246\367X\342\rh\277t_,\224\036\275"
+	.ascii	"\246H\303\"iN\205k\030\036\202\205P\217\375\313\326\241\005\025"
+	.text
+	.section	.gnu.lto_customServoMixers_Registry.71.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375 \210\365\003"
+	.string	"\004\007S"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\335\301\033\006yw\250\375\005yu"
+	.string	"\005\001\006'\001\360\0250sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"\\\005\2412\022h\2227\200\""
+	.text
+	.section	.gnu.lto_servoParams_Registry.75.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375 \226=\004"
+	.string	"\224\007a"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\203\336\361\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\006us\305\006uq"
+	.string	"\005\001\006'\001\340*?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"*\303\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_servoParams.76.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`l\001-\017"
+	.string	"\226\036iE"
+	.string	"\261&\035{$\036\276\020\001\204\323\373\316\3413;\232xR\rY\037|\344\t\346\370\024\030\312\001P\211\360\243\221'\037C\342\246Ow\306\255\377\177W\255\240a\234\001\323\230A\352\231\227\270\177#\204\354-eJ\001U"
+	.string	"Q"
+	.string	"U"
+	.string	"'p=f\037p=\332d\343\270\027b\377\245VV:vWS\020\316\016\275\033\246\351\021j\232|\232\033\350`\323\241N\217\020kq\261\021"
+	.string	"\225\001\226\360\354p\270\352\311\202RIX\342\345z\325C`X\035\352\345\211)\330]g\207\332p_\267]\262\235\300>\212\376<\365c\377n\370\264j:5\375\017l\246\006HkWC\213\307\346\304\031#2\377\331_\335\363U\006=\332+\316\302\364\3177\331\311%c}-r\354\256\310\243\021d\217\005\340A\266\237\366S\\\205\351\251\013\027\260\033\203\023c\327;\340\220\354\321^\371\232\277\3460\266\334\271\261\313\275\363]\374\205\004x\021\217\266\260]\357\036\375\355zT\265'T\310w\376\340\371\300\351\311\251\230\252\216\254\270\023"
+	.string	"n\032\3275\365\334\214J\266\f\365\372\325\027\314\300\330\254\364H\311\226*\253e\207\fU\031\333;e\t\017G\302\032\343\243\213B'&(\333\311(s\210d#Q(\2116\r\305A\203\321\003\006\332\311\310\004\202\026*m\032\t\210I\021D%\r\205D*i o\2571>\3153\226\211\234\024U\211*c\fG?\252:)r\250,\276\271\240>\365\351`\310\236\303\335]\350\221C\375\350U\207=0,\316C\026\031"
+	.ascii	"1\003\373\274\201[?ieQ\\\363!\n\210\305\032M\b\223\231A`\006"
+	.ascii	"\005'@\237\265V\211B\262\020\316S\2259hg\225\260fu:h\027\207"
+	.ascii	"E\224\275P\325x?\211t\256\371\004"
+	.text
+	.section	.gnu.lto_gimbalConfig_Registry.80.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375 \207\365\003"
+	.string	"\004\007R"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\356\261\033\005yw\350\305\005yu"
+	.string	"\005\001\006'\001\001\0030sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"[\205H\271\t4\311\033@\021"
+	.text
+	.section	.gnu.lto_servoMixerGimbal.85.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375 \177\315\002"
+	.string	"$\004r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\375\035\001\r\001\005\001?\202\210\2008\177}\300\001{\277\001y\276\001w\273\001u\275\001s\274\001q\273\001\f\273\001{\302?\202\210\200\020o3\303\0014\301\001"
+	.string	"\t"
+	.string	""
+	.string	"\021\250\253Q\347\206\352QY\007pP\231\221\022\364"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixerOrnithopter.86.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`S\004e\f"
+	.string	"\226QB9\020yZ\003\027\n+\\\033\016Z\207\013\nS81?v\313\360\255\252\252*]U\3753\265KF\221\202\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\025\265G"
+	.string	"0>\260\262\221\bE\320\333nk2\3552"
+	.string	"9"
+	.string	"3"
+	.ascii	"v\230\361\240\341\222\277\334\347:\022\007\263>|\033\027\277"
+	.ascii	"\027\227\030\227d|5.s\233\330O6t\023\273\036\217bQv\233\f\216"
+	.ascii	"\233\034\027\303\303P\254\b\247x\216\247l\313~\222&\200\031`"
+	.ascii	"\nL\331\315\331\300/%H\013\312\324@\311\236\302h\263\022\245"
+	.ascii	"\241\265\037j\023\262\243\261\032\360\206`&\344\330\201\242\r"
+	.ascii	"w\025\316\005\223\341%L7\355\364\323PG-5\325U[}5\326YkI\314u"
+	.ascii	"\327^\177\325]\345\250\274\332Q?*H\r\251\275*\022QG ,b\276{/"
+	.ascii	"\254z\330o,\341\276QNY\345\225Yn\331\345\230e\236\231\346\232"
+	.ascii	"m\276\031g\235w\346\271g\237\177\006:\350\241\211.:\270\321G"
+	.ascii	"#\235\364\322\001W\250q\31426\373w\020\243\021\242m\003\0210"
+	.ascii	"8C\004\336\020'\256Ft\341\356\240\356>\"\354\031'\245\206\270"
+	.ascii	"\356\221oT\254|[\272rT\217\002\375\221\372\333\346\304\324e\362"
+	.ascii	"H\321,\b\036\270S\035\230(\301\0037jCyc\242-\313\037\372gc\177"
+	.ascii	"\310\214!I\245\r\264\362e\261*\f\257R4Cw\031r\232\367\211\232"
+	.ascii	"\261\265\251Yd\226\2052c\fb\201\232\t\327\022\300\023\353\207"
+	.ascii	"\237\032"
+	.text
+	.section	.gnu.lto_servoMixers.87.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`\376\001}\t"
+	.string	"r\017;8"
+	.string	"\333\264\006)h\3234\r-\231\246i\2325\327\265\221\376\376\177\364\377\377.\320\227\342\017\"\217X\202\245\371\322\377\377\177w2\016\370U52\246\360\250&f+\255\355$\003T\227+/\b\271+m/\003\203\247qa9x\026\033VG\2266\207\243\267cG\332\336\275\244\245\321[v9f\231g\246\271f\233o\306\031x\316:\357\314s\317>\377\ft\320B\017Mt\321F\037\215t\322J/\315t\323N\007\177Z8\324QKQ<5\325U[\235\265\326[s\335\265\327_\017\007\2338L\342\312\202\242lV\257\314\261D\217R\304\267\342\373\215"
+	.string	"\001\002\264\001\202\202\232\315\340"
+	.ascii	"!\341\246\260\300\320\340\360b\016C\377\030\257\270o\343u\026"
+	.ascii	"\363_\310\210\355L1\251\270B\3740^)IIm8v\"\024;O\224U\2564\202"
+	.ascii	"R\021\030# \220\223\264\320\001G\001x8\200\\\302\022\231\356"
+	.ascii	"\240(\3276\303\256g\347\204\313\314\206\260D$\227\260\211$\227"
+	.ascii	"0\211$7a\211$'a\211L.a,\311\375\206\253\334A_\356\307(\003\207"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_determineServoMiddleOrForwardFromChannel.88.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`[\002\375\023"
+	.string	"V%\205J\300\322Q:b\200\315kL[\n\034P\334[\225\326\255\242\242\034\302\327A\b\315{\244a\"\230\317\211^P\340\357\267\370"
+	.string	"E"
+	.string	"(\351e^\231\267\033\3167\224\022N\007\211@\326\252DPF\201C\b\214mO\032\331D\356\224\002n"
+	.string	"g"
+	.string	"t"
+	.string	"\366w7\252\235\267\301\253Z\201J\032\265\362\022\270D<="
+	.string	"\332\366]\274\250f\333\344\235"
+	.string	"\021\n\021\331I\nRku\0018Ix:/ <]\241\333\036Rp\247\315\357\360\360>\276\036\264\305\347\204#}\016\216\220:-2g.H\022\025\304c\204\324\001K~\236D\274\367\311C\342\314\251R\251\265z\342\310\020\267\352\266e\266c\366\274\005\247\376\270G\322\261\013\367\373\336)\221Q\271S\3446K\233\2073Wg\177\313\262,\2759\263<\275\372\321-\236\367\207\236\246t\032TMo8=\351\364[\001HD-"
+	.string	"R\353\207r\252\342\240\277\025?\372\355\267\202J\333\034\311\213\244\324\232v\315\357\271e\005'\265\037\335\210\225\205j)G\351\243V\036\202S\237\210s\006g\372\017\202\004\026\226\360t\265\253\237\270\340\266\370\234,%\025\364\003Wgqwg\221\036\224=\3413(\210\265V\024?\306eT\260\360\232\307\275\366O(v\267Y~2\375\2102\261\253s\371\233P\\\0029\241\336\216\2349\304s\305\2357\f\373Rl=\224\230\372)\2525\007\345J6\207\303x\231\006\200\232z#\212j\255)/\356\203\361S\234\032\203\314<.\226\311\214\264\025\027\332\313\2066\256\214\021bb\263\331K\006\033\240!\3462c\3002\314df\254\241\305f\\4\262\027\230\230\013\256\031\314K\306\005\243\315\270L\nx\314\020\243\271h\306\221\346j\361n\007\353\346<\207H(\312\332\367\276jA\252"
+	.ascii	"WK\227\3076]\253\334\026\007\254\265\326puvp\247\007\rrDIM6X"
+	.ascii	"\273\"R\022\262\353\351y\032\242\253s\315k\330R\034+ `\002\031"
+	.ascii	"Ch\036~\261#\215\350\277\342\305R\202t89\301n\311h\211\275{\260"
+	.ascii	"\322t\240|a\023\226\031\343\314\311\241\261\206\332\236&\343"
+	.ascii	"%\333\205?Z>\230\236B&\032\262\317\356\025w\022\006\273\377\330"
+	.ascii	"Coo7j\007\016\330\rhsw,\202Y#\247\344;!\310\006\245uD\233\200"
+	.ascii	"\326\305\no\274Qm\025\024"
+	.text
+	.section	.gnu.lto_servoDirection.89.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`=\001\315\r"
+	.string	"\266\232^D\020q\224\016\223\230\001X\2412\224\355!Ca\025\356\310\306O@\227qk1)LA(fBo\0315\270\237>\263\261\032E\240*\365\277\212\310\006\231iH\343\204x\315\200\036D{H[\264}\262\267\224)\005H"
+	.string	"D"
+	.string	"P"
+	.string	"\0074\217\266}\024g\231l\030\374Fx'\261\222r\311\261\273\032\310\007d\217\360\002\262G\025q\323\241\246\31179t\320\002\207\312S\271\002\360:\b\262\273w=O<TfFdw\235*\357\303\035o\233\201m\b\366Q\002\031\263\277.\265\305>\334\335\265\256\354\177\277\346\255?\363t\3244\324\264>\235\232\376&"
+	.string	"\f\215\221\027\273(\261\230\235\021a\2300\207\247\260\252\274pn\233l\216\375\311H\360|\3130ovYN\300\354.\002\007\006eP%\274l\240r\207U\257P3Xj\245\313\230SU\237\352\241\321\220\247f<:\304t\266p\026%\rV7@\260vQ\n\376\262E_\261e\001\226\030/\017\254\335]\240\342.\030\374\022\217\036\225\362*\r\331\343\365\256\033@\275\350h\235\002&\371x\270\322\366\200T\022\205@\234\r\237\t\241\221\017{:\243-\003\367\031i$\222\n\240\013\024\264\020(B\211\346\341FZ\207\2007\321\207\323H\333\306i\234\357t\270\272\362Sjh\310\357\372&D\212\213\354<\352\211\355\250\0269i\007\265%w\327D\003\027"
+	.ascii	"\255\262+-)J\304\203\355\006\002\262u\023k\350\261\025X\332>"
+	.ascii	".\326\307\t\373\330lmy\353\272\013\267\026\026\305`\033\030\006"
+	.ascii	"\262\200\271A\005,\200\312G\252rF]\334\332\242\007"
+	.text
+	.section	.gnu.lto_servosInit.90.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`h\002\325\023"
+	.string	"\026e\201I\320\360(\035\332\211\201('4t*`\311GTC\261dRO\317Y"
+	.string	"\270m\031\034t\267>\336.A!\360\213\376\252*{\024\221E\333C\351\017\257`u\b_9pR\315\257 \254\020\350\305)]X\215\264M\210\224)\005o"
+	.string	"h"
+	.string	"n"
+	.ascii	"Ps\316qC8\374\307\273E\205\335C\025\2122\365\255\302|\335U4["
+	.ascii	"\354\036%\037n\270\253\226j\270\353^R\242\306A\303/eS\233\361"
+	.ascii	"\245\332\206/\345\251\t\367\335\214\212\007q\313\271\324\234"
+	.ascii	"\247p\376\201\330h>\2229\247h\233\351~#7#h 6\331g\342Dt\343\272"
+	.ascii	"k\215m\246\232:0\347\264\322l\267\373\343\266\201l\237\330\352"
+	.ascii	"\0221\017\270\317;\n\303\360y\\\301Gz\332A\337G\362\340\312@"
+	.ascii	"\202\262!\243Q6/\246\233\263\237\3624\323\343\325\261W"
+	.string	"\341\177n\251jp\325\253jU\365\001\2544\304@\2404\347M\224\216\331\003\213H\374\347\366}\374\235E\002\005`\377\211\tgO\312E\220\217\323\234\274\223\2036\t\017^4\314f:og>H\004\rP\322\266\205\017\265\204\354\3149S|\241\277`\371<\007\375\340\345E\036\034\331\221\273k@\250\211f\207\214F\355\262\260\301A$7g\335\007\375\273\2038+>?F\206[\343\247Z\200:I&\306\023HC\337U\\Ws\2307\247\356\215<\3146v\363b\027YR\002\332\315\371\027\344W%E\215\231\346p\250$\227 \355\327\204\375(R\352\3156\254{\005\345\325\242\340by\2150\016ZX.\rF\b,\006/\343\212\3535\242\004p+\002\213k\204i\265\\\243\310\233_\035'\300\351\311\254\314\036\"j+X\240\247\371\303(\203\n\\\225\020\265WX\3644p\257\3731\030\331z\262\2159\334\234\277\273"
+	.string	"\234\\\255\277T\270rk\316\364\377\233\233{\214\224\273\332\337\204h\314t\220i\224\305\244\267\004/ P\002Q\244,=\362\300\255G\214l\315t\021\360\336\332\302h\357B\b\216\021\341&Vb\365v\300\337\260"
+	.string	"\021\255\246\300!+@\265\262\360\350\357A\313}\377\225Y\261{\027\227$\231"
+	.ascii	"\004\215l\262\ti]\306\304n\001\266\240JjC\004!\212\fi\352\341"
+	.ascii	"\243\211\3271\304\027\260\333\302\340\005\215\262bF\3327\026"
+	.ascii	"\2333\032\004 \362e\215\3365\241"
+	.text
+	.section	.gnu.lto_loadCustomServoMixer.91.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`c\002-\023"
+	.string	"\026$\177I\300\020)\035\3000\3014Y\306\3152\270\n\264v\234\341X\362\022\366\246\213E\352\324k\272\313\267 h\267\244\331\373\266?\231URk\332\323\326\006\021\f\202 q$\b\002"
+	.string	"D\005F\362r\030CR0n\024[\311\336r\247\024i"
+	.string	"e"
+	.string	"p"
+	.string	"\004\036\340;\235\007\371N%\350\227M\343\343\255\376\007\bC\317S\2555\\\032\003\370\034o*_\377\350\\\371\362q^`\307\023k\260\177s\223\214>|\324h\263\304F\003\343\343\245KM&\251M\314\347,\311\335\204\370\250\315\346\352\370\024\2015\232\334\217\017\001\342\211\265\230K\216\004\265VK\261\246\341\346\270m\230m\005\266|\tw}>\317{\\~\215+\264\310\213\247~\313wJyf\3348\305d\317\036erg\354\223\354h1\27426\370\234{\256\364\256\264\224\322\367"
+	.string	"1Jb`\243\326\227^TE\242+D<\347\267\277CK7\027n\302\0350N\240}\234?\032<}\356\272\327sL\224\202eH\371\374\0341\325ZEN\035\222:\rED'\003nC\026vA.\036|lnt\230;c\223\357\333\332\2211\223P\266\033\\\205\311\002\020O6\\\2553\004\337\261Y\236\342\204C\367\022u\204\253\265\222\354\036\204\222\362\235~?\336"
+	.ascii	"\314\022\t\335&5\345j\254=\244\231n\027\237\310\217;\212\325"
+	.ascii	"\307\255\326\330E\377\347'T~\315\251!\254V\337\251\315\242 /"
+	.ascii	"Z\n\215@\242-\314\016VQ\335(#.\026K+\305\025\256\250<PEp\020"
+	.ascii	"JP\235\254B\224\226+\034\021`\326\204\224V\270\302b\265Bp\214"
+	.ascii	"}e\216\363\224\020\013\244\330\312x\337\316\270\243\304\004w"
+	.ascii	"\225\244\310\347\272\230\350\233{\335\216\322LB}\326Z+=\360\271"
+	.ascii	"\340~\003\020o\367\305\305\246\273>\271\273\247\331d\262\347"
+	.ascii	"\026rC\232\233-\307!&{\276\216Q+ p\002\241\262\234\007\n\262"
+	.ascii	"\"f\315M\234\277\267\343\335$\004\323\374\213\342\301E\314\203"
+	.ascii	"\005L\231\335\207V\254\027\212X\261\347cq\301\001\354\240\335"
+	.ascii	"\310\333\300\255\313J\352\2654g\016\247\230\301\235\205GD\325"
+	.ascii	"S)\215\360\326)\241\276k\200\245+\031<\303\321R\260Z\371B\344"
+	.ascii	"\231Q^@\0138\306D\f\211\316\325\311"
+	.text
+	.section	.gnu.lto_servoConfigureOutput.92.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`\"\f\005>"
+	.string	":j@\027>@$k\f+:\241.\005T\"\321u)eG\001\244\345\036\200\226\315v]"
+	.ascii	"\276\020-\202\367\271\356jW\204\334\001;\300\035\260\323\252"
+	.ascii	"?K\t\001dfBJh\315\326[J)eJ)\005k\001B\001f\001\334[\270\271t"
+	.ascii	"\227&\344\345`\340\034 W+8'8\241\r\344\301\226\f\252\364\204"
+	.ascii	"#FB\013\310\313V\267\004j\361\343\376\343\345\225\306\342v\026"
+	.ascii	">l\311\240m` \016\307\367}!\264\255J\245=\205\233\257\255\360"
+	.ascii	"\262\251t\237\333Un\364\333\204*w\304A6h[\345\276NZ[m\373hmu"
+	.ascii	"\201\226\333{c\355\313\204\335\022\027\351\370\276}Y\255r\201"
+	.ascii	"\266U_\272\314\215\335\007\3676`\243\023\213\236\367}\231\257"
+	.ascii	"\204\211\211:\355kf\337\355&\246%\245$\244#\243\"'\242!\241 "
+	.ascii	"\240\345\217\262e\327'5}w\271\331\n\002\020\377\236jd\335\204"
+	.ascii	"\007\030\347LI\326\244\364\222\222]\235'\261\025\220\226\334"
+	.ascii	"A\351\374h\216\013\035\2675\2736\232#\224\363\242.\223\322Ny"
+	.ascii	"N\004\210\007\347CB)\0034=B\200\"\235l\210x\320\224\333Z\221"
+	.ascii	"\006J\0138z\301\323\211\320\"i\322\216\272g\337A\205\370r\310"
+	.ascii	"O'B\201(\023\241?\202x\233\262h;\352\372A\244ca\3775\235\375"
+	.ascii	"i\342\243\327\326G?\245G?\270\2701\340\306\t\220\266\322SwP="
+	.ascii	"W\331:M\013\0201\303CH\355,MR\363\026\247\255\240\371\377\365"
+	.ascii	"T\"\264-\225z\337\267\365\332\323\324\314\334\331\n\357\373\262"
+	.ascii	"?\325\326\232\241\232\331\02103\006\346\237\267\017Eg\347\307"
+	.ascii	"h\365\334\211\275f\314\303\007\357\347\207\265U\026\r\013\236"
+	.ascii	"\n\242\323\204p\200\206\304\025b\202W\037\257\340\361\261\210"
+	.ascii	"63Bk\213\231mt\031\022Up\357{\366`L\2231\2216]\253|\242k\355"
+	.ascii	"Z[e\276\372d\022\222O+G\331^\372\324^\253\177\230\337\342a\203"
+	.ascii	"\361J\261b\305\332\252\177[i,6} \2310\257\312\342\1774\253\373"
+	.ascii	"Q\3701\236y$s\027\366\027>\344\246\343/6\364~\266\312\315\206"
+	.ascii	"k\253\375\317\203\017^[\231O2\367\231\371G\231\273\215<\232y"
+	.ascii	"\341G\302l\241\003\233%\364`s\204\324yK\253\005\233\027\274\263"
+	.ascii	"\202\004\314\326\322\214\325Y\232\257z\257\331\252\2534W\275"
+	.ascii	"3\025\353,\240u\236\372q\226R:\007P:\003P:G\265\316P\255\363"
+	.ascii	"\323\217\263\223\322\271I\351\314\244t^j\235\225X\347$\2453R"
+	.ascii	"\353|\224:\033\275s\021\353L\304:\017\255\316B\253s\320\352\f"
+	.ascii	"\304:/Y\347\237\325Y\271:\267\2533\373\316\253;\253\252s\252"
+	.ascii	":\177\352\354\357\334\027\226\b\325t\230|\337\035\223|\3364j"
+	.ascii	"\241]\007v\013v\017vk\351\316\322\275\327]\245Y\346\346uv~\210"
+	.ascii	"g\036\031\305\235c\314-&\336\344:\240\270\350h\021\276\t\333"
+	.ascii	"\352\220\r$_\237\221{\223R\364\264\204\n\235\323#1\372\226s3"
+	.ascii	"\243\307\212k\242\"'+\372gC\003Y8\204\206M\343\223E\250\tj\211"
+	.ascii	"\036Q\237\236\323c\353\320\023};\333\"\207^=\004\003I\325<k\013"
+	.ascii	"\242rfW\317\335\363~\262\020\230\3034fO\306\004\256\020\346\001"
+	.ascii	"}\224N\013}X\320\003\275PP\327\351\255\007\372F$\363\347,\\~"
+	.ascii	"\236~\326!\352\250\365\347\227w\306\\*\037~^=\034\354\3238\211"
+	.ascii	"\267\374h\230\336\372\026tv~\230J\320\315\361[<\363He\213\255"
+	.ascii	"\312\366\331W~;y\b\265m{\255[\317~;\013\315|\262q\353[\257\263"
+	.ascii	"\036\005\333\217r\220\334\252\365*\343SV_]\375\372\\\210\353"
+	.ascii	"\177\237N\337\367}Y6\320W\257\365m"
+	.string	"(\346M\223\210Y\267\221a\001\201\"\335]\303\341\262\202{\337\367\001\367b3b\340\f\0324<\246\001I\277\352\325\357\346\023\266\271\314\372\237~7\357\314|\222\257\376\277\377Z\315\0233\307)Y\346\223\377\177a\320\326\326\217r\367\003\270H\307\247G\302\335\244\231&\370\336+\202\370R=\266Z}Z\027\301\2232_\315{\336\300A5\224\224\362\276\315~V}\032\367\215\265*,\274<\354\253+F\332\325_-\246\312\2001\003\214+\205\213\031aJ\366B \006F#,\205\030S\006\213\025_.T0a|u\275`z\205\2111\021<1X\214\024aL\031``a\314e_Y\353u\033\306K\232\2627k\372(/\031\227,\274*\347\224\325X\237\206\365T\317\205(\340\251\276\235\222e.'\340\243\026\333ZO\230D6LXo\341\033\260\325)f\376\034oi\nNI\022\251\237\n \005\340\243>\200\017"
+	.string	"P\037\345v\304\b\324k\2615.\351\031R\247\324\314\2729x\336\246pI\372\350\017q\225\\\t\341\262\n\342\364O\257\236qJ2\360\246 \356\220\265\237N/\305\364K\337\364\353c\002\227\360\314\356\021\367\315\373\311\364\253\035#gO\306J\277\364\253\033u\037\256\2226T\354\301\325\203plJ\257\305&\007\217\017"
+	.string	"\331\233=H\037e\357\2615\351\333\315o1\316\327\306\256\024\325\270\254\340\240I\257<\214\003\3117\330:\372\3440\362\276Lar\022\317\331\373\226Q!\275\204\3673\315\273\243Gz\366\261\351\b\304s\270s\016\024\231\335%\216\303\265\273j\225\375\351in\023v\235\270P\274\237.\224\265\325\243\017z\214\203Wh\240\025\374\202w\301\246d\204W\3605\314\314qJ6\217(\222\277\243\224\310\373n\rx&Y\307\350\243\314\366\330\032\341\007\004\200\364\250\2018\305\fS\210hD$I\n\ni\f\200\002\221!\262\342\006\021\020\261d\316\320h\223B:SD\345\321;Ox\023(\006\002u\204"
+	.string	"\372\274\024\233\034\333]\201o\360\344u\267\333\226\004y\377O\227\220\025\242\346\332\030\fNF\024<!\027\201\300\200\374\343/\355e\307pr\226\005\247\030s\306\331p=\216qj@Y\332r\326\347\357)%[\300Kp\327\357 1\035\210/\226\263\307\335h\004L\002\214e\367\241\2140d\236\212\004\312\355\310E\202\236\254\215*\323\021p\334\315f\003\260\203\001\215.c\250\244\377\244\354/r(<\242\200\005\323\235\337\004\001\2109\266\0036y\2548\\<C{\356b\352\001~\031\b1\271\372\031\214~\304x\352`l\364n\270\265\313+rk\214K\313\241\2716\275\236\236\330\330\024\351?\0355L\3775\216\301\257\231ca\211\233`\354\320\247\201\311\273%\305\270"
+	.string	"O\fn\210\351c1&G\347\215\017\201\261\222\201t\034\204H\365\341G\027\371\221\377\250\333\274\357\272}\361/\305\005NT\264\004Y\264\034\f\\y\327\372\274b\236\261H\2311\224\003\2002;9?\026\266\026\314\354hb\236\206\346\304\213)2\"\230\222\031\247"
+	.string	"\211B\264\006\264\020\362\013\020gH\034\002zF\\Se\034u\273\2036\250\270\236 \265\367?\241\215\271\021R0\301q\226\275a\203y\006\b\321 ?\246\237\336\307\244\247\320\305\025\355\232\250i\235\243\007ss\237\371\b\301\002\3743=\203*\001\277\fq|K\016N\017\212v\270\266"
+	.ascii	"9<\020\013\020p\007\261\224\246Lq0\254\ru\006\222`\006\320\205"
+	.ascii	"\313\375T\314\264$Z\332A\025\376\3576\177^\276\244*\007\234!"
+	.ascii	"p@R\261Ti\301v4P\311\351\223\323\317\210O\343?"
+	.text
+	.section	.gnu.lto_applyFlappingToServos.101.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`@\034-x"
+	.string	"Z\303\250*J \020\323\031\016^Q\216\256\374\211\252.\257\241\265`Z/\034\305\247s:\352\223a$[\344\224\377\021\006\234"
+	.ascii	"\206\023A\361\217\350\013@#U\034-\357\264\t\316TO\343\317\254"
+	.ascii	"\247n\247/\245\250\272\314\300p4n\262\273I\231d\221\002V\002"
+	.ascii	"\237\002\213D\344=Ry\213*\257\221\312[D\344UU^\242\312K\244\362"
+	.ascii	"\016\021yS\"\336\341\020/J\344=\211x\205C\274"
+	.string	"\235\362\362\220\367gc\352;\352\3319y\322z\313\365\311`\017+\236\263\356\313\373\374}\277\336\317\347\247\363\327\371\361\374p\376\272\337\206_\316O\367\243\371\325\334h\367{\275\377y\375\317v\024;B|{?\367[b\337\023*_\373|I~\245{k\200^z\366xK|\340o\317\f\2419\337\223\344z\366\\3\210\020\016\277{\236%\332\371\035\343\361 \221\022[\256f\002\374\001\344J\177\036\361\223\320:_i\230Y*\307l\002\270\256\313 )\235ev\301j.5H\223\354\022\231{\032^\303\343\334n\211r\332\370\260\301M\216\272\243\265\211\22390\t\244?\341,3\r3[\"k\243\003\274\221\376\315\022\3516\316Y\215>66R7g\nv.\\\3563\354\022w\311\331l\325\0301I3\353\272~\315.q\311.\361'\3724\217[\242\232\257\263\031|K\032\351\3622\030\217f\231Rc\313\265K"
+	.ascii	"}\226f\252~n\213\364\247\224\360\274{3\2073\376\f\223#\255\253"
+	.ascii	"\026:8\353\272\004`W\244?wy\020\350\317\364I\350\317]\343\356"
+	.ascii	"\237/\331\326\323=!\213#\264\256\353UoQU\254\360\302\345wIh|"
+	.ascii	"\325\n\025)P\234\2402Q\202\304\224\324\b\021QP!\236\234\232\230"
+	.ascii	"\226@(%}@:*\032\025\251D\242\241t\210\236\302f\343\236\251\357"
+	.ascii	"\270\247\315Y\330\253V\320\331s\201U\314y\n\0247\374\004\323"
+	.ascii	"\357\rS\r\263\376N\242N\231\224&\0264\272\233\240\023J\225p3"
+	.ascii	"\307$\246f\270\324\flxD\233\213\210\301\357\fGA\231y\b!U\236"
+	.ascii	",}\327cfF\370\224\254s\302\335\314`\340'\270;\275 \224\362{\343"
+	.ascii	"\246\275\237_\326r\300\2026\347L_\360\252\360\222\227\203Pj{"
+	.ascii	"R\027\026\370\003\322\n?\322c\306\205\215\213\303,\253\277=/"
+	.ascii	"7\032fMaA\303"
+	.string	"\341EB5/\214\224\3531\243\"|\2416\227\3677i\254\252\2006\345\304)\242a\026\026\264\265\017\t\245\334\314\244\330\251q:\314z\363\025}l\3144\261\240M\3710\312Q$\361\214\214\317\021\344\310X\210\367)7\263/y>\245\307,\311mt6&\224Z\327\365q\347&gG\346a\326\272\256\313egh_\026\337\355\032\273\033\303\256\023\215s\006\255I\n\373l\276\343\302dJ\204\3758\276\356\313\235(O\0348\302V\356\026\332\2427H\323\207\305\370\270\265\357\262F\026\214mm\350\317\026\254Vf/\t\227\306<r\355\317\312\272\256\215\301A:c\353*V\342X\372Y\332\351\016\351v\274\202\245\321\024\274\337cl\301\030\346J\377\316\212\225>\036\022\360{\3268\346\205\214ez\270\240\361\315\b\203\021\216_f\204\253\322\337sf#FK\022\356\314Us\365\375\316c\200Z\365U7\341!\335\216<\270"
+	.ascii	"\264U\237\254\220\030\017\306\360\346\215t]\307\260\366\204\214"
+	.ascii	"*\034\220v\001\001\375\t@\313\340r&\212w\025`\200_\306\242\237"
+	.ascii	"\347C~wx6/\214\032\234n\345\246fG\202\276\3211[\322\334\215q"
+	.string	"\340\356\256\325\003!I\327u\235\261\007t\035r\354\273\374\334\035<\370e<\320\237\357\001\304\360I\302\325\211\361\3402\361n\004>\370eC\372-\324\2606\001\217\035\266\273<r+w\377\271\2740V\266\265\354*\225x\257%\013\226+V\222x_%I\344=\225)kD\336K9\335\367j\207\363=\332\353\276?\273\r\337\233]\316\367O\256\367}\t?\363\237\004\225\367b*\257\361}\276`\357\37329\235\357\327\353|\227\234\317W\211\312\033\202\312\213D\345\365Ry\273\216\347\313\365\201\227\310\325|\207\250\274\030\250\274\027\250\274\026\250\274\025\\\357\013\344|\276\024\234\356;\301\321|\177\fy}\234W\202#\336\b\216x{\030\361B\240\362>0\344\345q^\007\212\274;\212\274:\210\2749\210\274\r\030\3612\240\362.\240\362*\240\362&\240\362\342Py\021Py\017Py\rPyo\250\274Y*\257\r\225\267"
+	.string	"\225\227"
+	.string	"\225\267F\021\357"
+	.string	"*\257"
+	.string	"*/\r\225w\206\312+C\345\305Ryc\250\2740T\336\027)o"
+	.string	"E\274.\212x[ \361^!\361Z\021\361\0020\304\313b\310[u\336\025G\274*\216xS\030\361\242PyO\fy\251\316k\242\310[\242\310K\202\310;E\344\2252\342\035\241\362\212Py\243T^(\2257\204\312\373\244\362:\251\274M*/\223\312\273\244\362\202(\342URy\223T\336\017*\007 \220t\223\237\222\235e^\315\336]\b\355B\316`3\251\225\313H]\255\266\335\371s\344\325\025t\223vRf0M\237\n\032\007:a|\302\017\\\335\005\210\004\366\206oX\246\215=;\257\036\372\334\221\213V\275\304q\321\307{U\336\340[\232XqH/\327q\r_G\343\b#\240?\257\312"
+	.ascii	"\276\201\003W\246/i\306\250\225\273\205\322\241@\265F\220\013"
+	.ascii	"E\255\334!\035\342\325\272\373\f\253>A7\371\231\013U\026\237"
+	.ascii	"\240\257\326\177sa`\037\023\231\254Z\001\305C\321U\215\nR\261"
+	.ascii	"\342\356)Z\205\213\223\350\024}\274\023(\330,3\225;\321\305\035"
+	.ascii	"\002\275\325Q\365r\234\221\f\022#\266=\023\364'\032W\006hDS5"
+	.ascii	"\032\207\254P\211>\tm\242\217\024s\304\001%\321%\372SMb\312\245"
+	.ascii	"z\252\217t\223J\326`\021\275k$\301\330\004}\331\210\226\032\353"
+	.ascii	"\260\3452\323\030Dt\221\314_\223\211Qpf\234\370A\365SG\365)\030"
+	.ascii	"\242\227\032\252\233\356^Xf\372\026\242/\207\357G?\365\301\370"
+	.ascii	"\3759\225!\323xe\200\232\032D;\365)\b\231<\366R7uS\034\244\333"
+	.ascii	"Q\3142\3230gL\3758|u?z\251QAH0\307\037\r\242\237\364#j%\032\230"
+	.ascii	"eB\355}qb\2042\224\343\367\226&v\326m\313\204bc\201\273\030\237"
+	.ascii	"\234\031\241\030\241\240?\207k\372\232iCJ=\204\313\026\n\306"
+	.ascii	"6\245n2}oibI}4\263\376\320IH\375\241\207w\031\260R\013\022\213"
+	.ascii	"\253}\324\257\323\367\207L\036\263\370A\263\fT\354\237\375I\033"
+	.ascii	"u\261O\272\300Ui\254\250\215\032\025D\2029z\300V\222\\\305\030"
+	.ascii	"E\315\270\266\206\376,j\030|\374\215\203N\320j_N\237\036\322"
+	.ascii	"\215\330D}\2635)T\214Jb\027\255\301k\326\021\365P\377\211\333"
+	.ascii	"\221\243p\3322\253\354\233}\203\376$j\031|`p\030\205e2\024>\301"
+	.ascii	"x%\213Q\251D\177\016\365\355\316~\310\260\265\332\\^\013i+\227"
+	.ascii	"\307\330%\317e\336\017\0329<|\305\316\004\3412\277\256,\367\241"
+	.ascii	"6;/\3502?g.o)\374\321Mvy\354&<\356(\310\334!\024H\214\007\207"
+	.ascii	"\255t\232\313\023\203\266\226AK\243\2501zi\356\214q\340\013\265"
+	.ascii	"\271\275\263\225mV\326\365h\nR\032/a:\354\271\363\344\224^F\256"
+	.ascii	"\245})}7\303N\233\351\266pY\327\260\257"
+	.string	"\006}\213\203\247\t\230\354\373Y\375\354S\351\317p\341\016m\226\001\373\201U\007B\2144\355\007V]\\G\204\024\341\002A\203 E\204$\231\322\321\243\253kKxd+H\227\226\004[\035\b!\022\204\350\345C\353\b\221\255\016\206J\264v\030\331:\3425\324\321#H\021!F\214h\021\361`HG\217$Z]B#\367\362\221\204\253\310\251\005\002\016\255\017\214\020\321J\217 1RD\310\271\034Xyq\205\320\265\345uu\344\203 B\210xpUD\210\026\bW\034ty]Y\205X.#[]WG\270\270\272\256\210K\261\307\035\007\017k\023P\254\217U-P\311\351\255H\361\022\272\3730U\035\b\020\025@\372%\364\367.\fl\336\361\001&\007\202\366\021\201\004=:\002\035\335\243\217\367"
+	.string	"\004m\313L\273<\320\305Ayo<\300\3640\320<v8\220\346:zG\216\326\321@\347`4\007\322\r,\300"
+	.string	"\333\226\005\272X\006\257Y\227B\201Vjq\342\227@#\320\n\364P\020G'\320OwW\226\231\266\025\034\375<\276>\341\0074\002}\306!\335\216I*\007t\261\f\237\267:\003z\255\245\334h\033m@\017\375\302\250\315e\365\215~\212\262\314\264S\310\352\343q\251\023S\233\313+T@\333h\241 \322\355\b\005\255\200.F\271\323DA@\233\365\223v\322%\020\320Edv\232ub]\326$4\3312\323F\326h\242\236\235\267\272\023\003\364\220\036\033\200\327\340\372\222piT\312\376_\213\201\r\202b\353\260\364Q\250\262[\220\354\204\277B`\203\322\036X\020\254\311\003\230 \230 \372\363Z\372\177g\027\332\342\234\300q\030\2659<\023\254B\211'8\030\322\330\031\343@\022#\276\272\330F\352b\215\201"
+	.string	"\201\313\024\261\327\304\240\261Z\200\026\322M]L\n\254E\200\0133b\207eb\t\032\306\211\240\001\3264\032+\360\016\222P\324\323W\027_\ba\354\013f\350\260L\021l\200~A\307\350\031-\214\023B\265\322\330G\326\300\203\016sB\224`\322_p[\236`\364\3372c\354\375A\005\313"
+	.string	"9}\265\214\036\222\346\216I\313h\254@9$!\254\206\321`}\313L\375`uq\013\363-F\303h&`\346\230o\231\351^\214\256\301W\307\3250\372~\027\336\320\374C\0026e\351\027\375\325\277C\272\021\351\027\247\224\246\034\022\260\211\3642Y\241!\235w\332\255i\246\241N\254\374\013]\322\334-\b\351!\003\005\320CzI_\020\022\314\236"
+	.string	"\372y\216B/\256\231\306\024\bBI\237eFU\247\240\233\2709\005M\243\314 \346u]\303\226\224\220\264:\346N\241\244\020\332\202nBA+i\260\277?\013\362,3\212\r\017\330\340\b.\001\202C\250\362\0301\016\222\222153\"\222$\005Ik\002\013\020\212\"Y \346\324\003\022@\3644J\324\214\231\241\221\222\024\244\320\032\212\320\242\033\022\302\240\260\343>\201\241\n\003\263\230\247\375.\341\274\244\323\213\017\336Z\n>\"\200\236\325\222 7\243Q\201|\201\200\340\366\326\362\271<\347h<\2172\354\237\261K\263\357o\212\243]\241\3773\004\274\354]\251-:x\251{\224\307q\361\3153\345lt\2712{\374\337\353\220]\266S\273\214\246?D\361$m\210\303\227Fl\200vK+x\023\013&&`$\342\256\353\225\214-\335\257@\355ZX\235\364\240"
+	.string	"A|\245\367\266j\333\353\235\017$\311\232\272\304\266N\344\243\027\375\301\321\322\302\346\030\226\362\306}\026\t\274\f\274\323q+\021'\202N\313\251V$\004\265`^\217\267\366\020\350-\250\323\230x\324\364\335\265\351\333\007\366\352z^_k'\242\013y\272n\374\215\\r\2514\307ti%b\b\212\223\016\257\320\202"
+	.ascii	"\350\177_r\210\030\344\t\002\006\377\215/V\251\361\370\021;K"
+	.ascii	"+\317\244q:\1771\017w\351\204\007\005\346\351\343\005iR\n\246"
+	.ascii	"\323_\013\320\030i^\215\244\234\212>\345\332\254\233\266\036"
+	.ascii	"L\360<\201\335\210)\006\344\221\344\216J\201!\277\244\036x\203"
+	.ascii	"\b\335\362|\037\377\231K\351\3705\356\216\007=\361\310#av\324"
+	.ascii	"\365\213\336\202\267q\347\354\220$"
+	.string	"\037\240>\342(\337\370\317\307\347\020\230\300\231\314.\202\201\017EDb\230\022\002\327\022\225\213,\331\212\261\311\327\205\001\330Vtq\207\203\241`s\375\320\363Bip{a\306io\361+\256\005T\3502\342\370\206<\005\372/\207\344\375\313\276\250\325!\302T\203\016N\337\b8@5\263K\334PWO\030\325\252\263g\300\355\235\271\205\305\326^$\205\205\020e\235F\352\342\bD&\031\257P=\007\332\3440\313\2745U\233\320\004\255\221\n\311\031&V\274$k\246\200\317\350k_7\033\217\353\373U>4@\373B1uo\343\027a\310\230\260\241\341\034\201\3336R\350\304N\375\005\360\357\252\030\305\214p63\315\251\371z\372\037YQ}\265)\206\276a\240\374?Y\321B\232\307\t\365Q\334\226\367^\030\326`=\232\352\271\242R W\353e-\b\343\330\223\022\355\035\230v\b3\246\255\271\246X\245\033R\274\316"
+	.string	"\214z\251G\253\276\036&f\310\307\224\364K\377f/\343\222z\b\031\260\306@\262\373^\211%N\350J\221\201Iy\332e5eR\244g\373\261X\334\241\211&u\240\256\001\271\273$\024\366\262\260\013\242\334\034\224Y\216g[\247\274\0239i\260\200\352v\234_\024\036\250\221\2576\271`\r\211\312\320\035\326\201\306\242wnY\332\003\024\374\211\017\020d\246\200\013I\340\022\225\255\366\231\231\2262PM\020\020W6\265\322\255\351D\201\177\252*I\\H\006O\211\216]\210\261p\263\025\2512\211"
+	.string	".d\001\276!\323\022\211l JR["
+	.string	"!2L_b\252!\020\002\340\223\034\333\006/\265Z\227?\243~\237#y\036\241\217Fd\341\213\327\034H\204\260\371\360\223\31688(\271\350\252U^h\221WuI\250=\032\310]\323\330\222\245\001$\201\317\260\320\310\3530\256h7^\202\243"
+	.ascii	"\204,\030\301\267\372\"\b\017\273D\307\027\025\021B,\305D\311"
+	.ascii	"d\224\327\247\373\003\225jL\005\036fSU\371R2]\007'\001\3774\236"
+	.ascii	"|\344\203\331\260g*\226'u\022\266\350\224w\345\301\306E\222\261"
+	.ascii	"N\255\343\321\203\315\370\322o\"\277;\255K\262UH;\341g\216\020"
+	.ascii	"UZ&HC\324K\344\341%\264m\233\332\023\232\037\b\255\255R\372@"
+	.ascii	"\036\340SNJ\002DS\253\205F2\233\321\250\252\266>\210\365Z\214"
+	.ascii	"\007T\335\351\241,\232\321\366\002d\251\325\313Q\035M'\216\321"
+	.ascii	"HFJ\2119\244\255K\304\362\265GI\332\377\033c`\344\3618<KX\266"
+	.ascii	"\204\365|8\007\311\234\361$\365 \302\246\254N\324e\031RU\f:\322"
+	.ascii	"4\301\331\271_\321\"\007\304\317\306\363\001L\316\362\366\267"
+	.ascii	"\321\002"
+	.text
+	.section	.gnu.lto_servoMixerLoadMix.102.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`\255\004\305\034"
+	.string	"\266\364\267H\220\232Q:\003\361\n\231\024UM\263\213\374\024\001~\315\372\230\262\306\2409\324[j"
+	.string	"\304\244V\350E\242\236\326\273\027\233\247V\255jY\301H\002\201P#\021\346)*\003\267\302\366N{\356\"\037\272\300%\177\357-w\222\001\236"
+	.string	"\236"
+	.string	"\246"
+	.string	"\3445\022\033>\245\341\2727\b\364\312\017\310Wf\376d\376\357Mt\007\262\025\313\356\r\362\263r\357u\300\f\310W\004\377\261\257\364\003\354+\353\230\327<\350tO\305\245\2060\316\275w\326M1\026p\032<\323\326\235\214\331J{\352\370\302'8R\225\276\031'i\214F\216\"\017\223\324\203V"
+	.string	"\343\252\372To\306\224n\247>\303\274J\237\322+m--A\002\370h\320\013KMX'~\"\371x\223\036\331\361>\361\f\214\307\322\267\3433\206\341\336\313\263\364\3518\313\316\314?f\026b\2466\002\255\325\325\244Ms\203\313\032@G0\262\351-\361\346\2219\310\233\315\304|\0037\240$q\013a\366\351y\360\314\363\250\363\316\201g"
+	.ascii	"\007\376\262K\235\355\207\347\372\311\264'w\235<\353\344\377"
+	.ascii	"\034\350\322\222\221uo\216\343\234\013\246V=]\352\037\376\301"
+	.ascii	"?\352\224\371\374\342T\334Mp\342L\255\331)Rp\372\230\342\213"
+	.ascii	"Ka\016W_J\356\275:\314\217\302'"
+	.string	"\262\316\220\255\310\031I\344\220*\213\353\336\213\201|\255\177r!\3530C9\224\356Q1~{I2\034Oh,\004I\206 A\367`.K\200\354\341g>H(\336{4\201\231O\274\b\"\310\351\336\24327\023\202\n\211\260/E\330\327\235\276\360\013\224\334\310\001\356j3\261\214I\373toM\240\327Fb+[\373@\250\255\243\tvz\357\275\264\266O\237\207\361\370\2543\217\270\230\234\006\2510Z\226L\001\313<t\254\\\017\251\362\305\013\001c\331Ed\231i\337B\324s\250h\271\232\302\342\327\3569\313\\{\226\\%:\371\2614\341S\230\215\216\005E\375\001r\204*\177\367\336\nW^\245\202O\344\225m,\346\313W>\316\276\236x\272\305\314\227\222\257]l\242v\\5*ja\313@K\321\342&\203A#QT\253<\024\204\263\271\270\321p3#\023D\265\024%fE\265\021*fC7\334,\210"
+	.ascii	"\333V\320n3#\233\3556\323\t\356\336B\204'\263\274\300\354\232"
+	.ascii	"Gr\261=\335[\025\350\266\221l\323\316\200u4\301\230\247iO\343"
+	.ascii	"\364]\315)c\266{\372>\302\340\364\226x^06\260\220\223\337\211"
+	.ascii	"\360cXa\276\275\r\027u\203\344c7\217<{\247\273\337K\022;w\261"
+	.ascii	"\357\331\357!\261\375\376\324+\223\260c\215\260\335<\366\275"
+	.ascii	"\246,\221c\233\2119\\M\007\007i@(@\303\323}\365&T\250a4\244\f"
+	.ascii	"C\306\230\221\221\031\022Ia\341\300\002\031\"Z\017\021\2005C"
+	.ascii	"d3\n\315u\306\367\036\331\375#\030\333\373a\237a\035\365\211"
+	.ascii	"]\030\224\nQP\211s\024\204\310\220\025\310\002 a\301.\364\303"
+	.ascii	"G\346i\210\361\255\337.$\352\204\360CX\252\301A\273\264\352f"
+	.ascii	"/|\211\026\366X`\347\276:\037\030\002\364@\306\307:C\016N\n\307"
+	.ascii	"A\364\207\242\340\213\223\261\214\024\256\016\212\247t\346\013"
+	.ascii	"\306\310\362\266Z\246\313\300\274\265_9$\335\355m\317J\323*\021"
+	.ascii	"XS\362uru\215\003\003\365\3264\033]\026\3124s@!i\363WZ\022\265"
+	.ascii	":\2758;\bL\003"
+	.text
+	.section	.gnu.lto_forwardAuxChannelsToServos.103.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`\344\002\205\027"
+	.string	"V.\237G\240ZQ:<\233:M\246\003{\036aK#\322\327\372\b\215^\272\350\342\021~x\352\352\023\177n\307\376\365\347\307N\335\223\350 n\204Y0\340\244\300\030\207\0175\360\345\356\361\024\032\364\223,~\277\032\021B6\2212\245\207"
+	.string	"\177"
+	.string	"\215"
+	.ascii	">\371=\356#v\321Ka\320\2120\351\350\013\323\234\023\301\245\037"
+	.ascii	"\204\227\006n\363]z\257\371.m\253\332\013\030\304\316\343\204"
+	.ascii	"wN\242*G\346\024\025\370@x\351\230}\345\342\214\t\036q\251\005"
+	.ascii	"\3212\347T\255\f\007\270'\336\236\306.\275\325\230\217t\257\310"
+	.ascii	"\346\344\206\013\272\364@!\0257\002\340\204<\234&&\245\353\256"
+	.ascii	"C\270\231z8Z|\257\273,\262\351n\270\026W0\302\234\323z\303\261"
+	.ascii	"\270\277\333\036a;\203\2754\001 |\033\227\026\321\322\337.\375"
+	.ascii	"\326w\371\205\2412\352\350!\323\321\026g\272F\366qf41yc\3306"
+	.ascii	"\347\361\327\320\250z\346\271[&\365\244\033u\361>\201\352\030"
+	.ascii	"P\r\003\252CU\203\236\372\363\324\362S{R\275\252VO}\001\036\\"
+	.ascii	"@\211Q\231S\305\330e>\221JGO\372s\277\370\265\257K\362\322'\213"
+	.ascii	"y\233\026\034\266\n\341\177\370@r@\237\264\tTt42\315)N\b/\365"
+	.ascii	"H\001\250\265YW\316\246\023\240\336\202kc\320\240\277\331\200"
+	.ascii	"\320\006\371[\260f\345~{\032\021j\345z^j_v\275\375\216\306$\323"
+	.ascii	"\261\347J6\204sN\034_\351I8t\310\311\371.w!\320P\222\351\350"
+	.ascii	"\004?-\315^\367pJ\316f\204F4\323qW\307D\b\267k\344\245OwfO\303"
+	.ascii	"2\323\3212\253{\223E\347F\200tI\225\335\213\354\254xx\276K\231"
+	.ascii	"=\220{H\230\214[\276\251\375\256\366\305>'\002\024\316\211\242"
+	.ascii	"\201/\344C\002\260\325\213\305\262\360:y\310Q\330\352\305bY\b"
+	.ascii	"\261\372\371\321\351\331\001`b\365\341\207\302\005\330\313\345"
+	.ascii	"\303Jy\347\346\325*\341Z\275T\260\036\036\237\020,\325\217\217"
+	.ascii	"\216\b\325\216\353\245\272)\340\326\210\225K\005k\265\\\252\223"
+	.ascii	"(\373\306@\372mQ^<\221\355L\256\221\035\324X\233M\321p)\024\301"
+	.ascii	"Q;t\335gv4\034\021\322C)\343\025M\355i\207|\022_\314J\260\202"
+	.ascii	"B\233\f\263\341\306\354\200 5\030\247\205Y\002\273\332\216\231"
+	.ascii	"Em\270\262I-\307L\307{s\316\351%x/ P\002A\n\263\003\274c\\\034"
+	.ascii	":\034\355\275\356\340\321\237M\215\344\306\037j0\375\2005\343"
+	.ascii	" M\331\n\252\206<\342f\265\016\377\301\037\341e&\324FK\314$\236"
+	.ascii	"\266h\273v\211\274mL\032\230@*O\343!]\240v\025\334`\330\032\252"
+	.ascii	"\366<\006q\351\244j\302!\241\213\033h\032\325\f\235!\310h\230"
+	.ascii	"\340^8E\324V\354\370\201\0211]\357\t"
+	.text
+	.section	.gnu.lto_updateGimbalServos.104.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"=\013"
+	.string	"\326UM> Q\233\016\247\017-\b<^a7\302\241\001\n\310\322\306\321>(P\002/\347xa\313\377\215\332,{\342\242\333\3513\337\007\301 \t\bh8\326\226\007H\240\337LY\264\221\266\267\224)\005;"
+	.string	"7"
+	.string	";"
+	.string	"i\037H\260\375cc\335\345`\261b\327\253\\ \362\350\315~\021\300\263\034\202\020\0316@d\354\256\245\037\276=7\377%>u \356)1\330]g\007\332p\353m\023\260\275\300\376%\361z\022\034R\314\bq\362\263=.\265\203}\270\332a\377\343\2372-\305t\004\323Q\3230\323\n\323\251\351S\224\007\017\3201\304\330\325\360\321\330\220\030\002a\373\022\333\031\260\305\207\243\223\237\241\306\352 (\240\212\021!*SU\355KB\276\363"
+	.string	"\217r\236T\365\0335\256\251\325\007\006'?\003?\201\211\354\256\002\337\304=\314\367xt\005-\337=\372Z\364\027*\0202\r\034h\264\354\262"
+	.string	"0e\242a\026\262\212fi\"\\\256\t\026+s=\300X\224L\263&\002\214Q\250d\226\006\3032K\342\355\341j\207#.D\204p\264c*\243J\221JZ}\023M\032i\022"
+	.ascii	"\227\031e&\336\032\205\273y\301\007\251\235\301\005\020\035\300"
+	.ascii	"r\205\334.\3600\250\035\256\355\2412\013\272\220\357\305X\250"
+	.ascii	"R\343\300\235[\264\363\t"
+	.text
+	.section	.gnu.lto_flappingInputGains.112.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`\343\006}*"
+	.string	":O\f\021>`\350I:w\025\236\257\376\004\320\307\035YC\204\200\004~\246\313\376\266\265\376\212a`I\215\247S\302\26164\"\177\373\\o\347\335\320\223\241\364\377\211\271{\204&z\220\326\b!\204\310\235R\374"
+	.string	"\351"
+	.string	"\002\001_\343\307\371\374\350\263y\033\257\303\371\356H \251\351\3012?\"\020\367B\237\276\333\325x\375\215\310\353\223j\002R\3133\254\265F\370h+\363#\255\bN\355\263\035\215\327\333<w\250Z\321\350\344\324\3526\301\020\314\217v{\024\371\321|"
+	.ascii	"\362\243\275\354C\003\216T#\027\324\360\214\261\201Tk"
+	.string	"\265\332.\266y\372\351\242\333]\256\327\227N\340\317d*\311Q\\\352\345\227\034\204\257\n>\022\nzcf\344Kb\331\244,\320\361\312\260\210X\211\020Y\371\\\220\236T\\\236\\9\360\204\233![$-O\254\374\207WV\245\356Tc\312\254P\363_W\316$\226G\234\2049^Y\026\021\213oh\36780Z\002\325\250\234\234\362Q\204p\246'J\324\237-{\247\331\021*6\231\211\211\b\340\234*1\013\243\373\270\217[\230\b\"3\243rZr\250\265\232\222\231=\271\233n\177\200\355\0306Y#w\262.\f\252\265b\325\271\235\032>\230\217\326\332\242'\373\350o\221\037\253\366p.\362\t\036\212\324\266pv\216\230\255\211\230_\033\376v\013AC\221\206_\264\317v\003\243\233f\037\313\013\337\320\213f\227\324\016N\352\006'5\203\222z\201\202\277\271\253\250\336\366\0378\251\r\\\356\236:\334-\365\243\216:\265"
+	.string	" u"
+	.string	" 5\200\0375TI\375TR;\231\324M%5SI\275TR\237%5\220\244\376\225\324fI]\232\324dI=\226\324bI\275%5%\251\377`\351\314\236\331\231\330\251\325I\337\244\352g\264\023s\271\377\315\017\367\277]\264\357\037\227\343\263\016n\355\307\355L"
+	.ascii	"m\357\214\315\227{\235\035\344r\\$\350\210L\255\225\316>\347"
+	.ascii	"\n9\210}\272\361\341\370\264\005\f^\1773\344U\254\016aS\3333"
+	.ascii	"\254\325-\203\031\344\335Xp\30128W\302\027,IIl\022X\235?\334"
+	.ascii	"\020\210\020aW\237c\237\370\236\bz@K\035a\0226\275\027\"\361"
+	.ascii	"\272\022&P\220\037\r\354\353N\343\320\366\316\320\264\365\371"
+	.ascii	"\324\236{\272\233\310k\262osR\276\230\233\346\037\313\013\337"
+	.ascii	"\220i\321|~!\025\354\352\321\b\227Z"
+	.string	"%R\013\\\017|~\013\274\240\017\232\341\203\261\212\025\364d+\310\217\277\235\"\024\374\242}\027k\255\265\224p\251U\260\217;\013!\023A\224\334\264\225\"ST\356\270\346n#r\313\026\007\344\342jP^\026\006/x\344^\021j\373\242}B.\364\2359\356\213 \2432v\226;\023gm\024\227.\020!\241\246\373\216\334\025\367bg`\264\317U\273[@n\254\322\227\356\307*\031\306\371\314`\260'K\201\236\357\203AD\317+\364\026'nZ\371!d\325\256\2326\222\204{\302(\237m\031\3073\343\312K\255\365\312v\212\007\276\321\245\265\305\225\325E\342\270VWV\n\255\034?\270\314\0358\262\266D\327\240\340\203\007\020.-\037V]7\266p\344\260a\265\003G\226\016\253\032\\>\254(\0240\217\036Z\\V]<xpY\235n__4\347\365\361\363\265`&\"\326\252\345\302C\r\337\2266\315\025\276"
+	.string	"\251v\365\230\"|j\225\230\367\0359E\361,1\363gQ\236^\030\345;\337\2432+\347\246\371P\002\375$\374u\037\221\004\313\030\235I\341\016V\311\324R\355\347n\342\t\233\364\021;\213Z\377\021\013\3235\r\002\343{\216\374H\345\310\024\321\275.\017\033?\325\336\320\327\027(\254\326\257\004P\0335&\300\036X\001{\2615\361\316C\002\330"
+	.ascii	"\373\251\005\2607\364\264P;\340Nl\350\264L\373\264\343\236\246"
+	.ascii	"u\362J\363E\035\234\324\340\326\350(JD\242i5\020js\260K\313\264"
+	.ascii	"kHl\f\330\211\245\007\211\340\326\316\320\330\0017\355O\027\262"
+	.ascii	"\273\337\242\331\003\331`i\b\365\030\254\201m\260\001z\2501,"
+	.ascii	"\303\020\202\212\241\231\021\t#I\223\306`\002\03123n\021\260"
+	.ascii	"\265DFT\231\366\foU\305{\315\037\235p\330\277B\\\315\351\236"
+	.ascii	"7\353\306\2471\221\200<\003\023\204\007\204\357\301\032pc`&\236"
+	.ascii	"\320\b\252W\002\326\331h\ra\203*Rl\004\204\321\335V\210\225+"
+	.ascii	"s\003G\335\342P\256!\177\r\204\375\r\311\264Ml%\325\302\237C"
+	.ascii	"\356\277\003Jng\017\2273\001\304\307{\246\240\364\213FP\242="
+	.ascii	"\230\322\263\354\036\356\344\3140\217E!9\205\234\254KD\250\231"
+	.ascii	"\354{\342\3127\245\027\003\304\tp6\205\234%\n\340JO\025%\317"
+	.ascii	"_'\214G\226\374\262\217\302?!\351W\035x2\271\250\360\324k\005"
+	.ascii	"\322\235=\236,\343\220\254ac\2261\023\313\363\320\001f\256\341"
+	.ascii	"\351\251\002iG\215c\203\331\217M\224\277\205\354\364\031\033"
+	.ascii	"C6\304\344x\362\256L-\234\263\301\330\211in\242AW\020\"\n\361"
+	.ascii	"I\007\2361)\206\n"
+	.text
+	.section	.gnu.lto_limitServoTrajectory.113.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`~\023]^"
+	.string	"\n\237T#K \320Z\031\016\342\202qhX\225\326d\232\251*\033h:\332"
+	.ascii	"<\2371?\201\300E\201\352\312\373\006\bU\377\352&\345\366\232"
+	.ascii	"\032L\242M\247`\216\026w\261\210P\303\344\270\3428\n\347\002"
+	.ascii	"\242\205i*\242%\032\357\t!dK\231d$\002\357\001,\002b\366\202"
+	.ascii	"\037<\231\227\371\341.\r\243\234P\270Q\006t\363&\345\212\020"
+	.ascii	"O\361\2031!\250\320\366\346E\261\203@'o_4P\002>\205\3057\270"
+	.ascii	"\275\332\005\3630\273\313\025\3416\354\217\212\344\271Y\021v"
+	.ascii	"\261\354\275\354\262KN\235\230\"\006\312\276\275\337\032\337"
+	.ascii	"~K\203\345\231\271\226G\367{\273\324SI8\226\275\241\027g\026"
+	.ascii	"\267\256\353\362"
+	.string	"Y\366z\273$\341y\333\007\226\254\363\261\027\267h\001\t\273\313\037s^\367+\237\341x\273\274c\243\300nG\272\336\235\311\033\022&\rX\331\3615le1F\336\222(\256\353\332BIw*\352\253\230\220\304E\267j!\005\307\n\343\026\327\365k\304\217\253B\371#\257I\347\335\307]N\375\034\n\213\263\256h`\366\326\225\216\304\212P\376\230t \344\217\351\177\220?\356\252\2738\b\361X\265N\270\271\351\272\262\270\256\253S\037i.\3234=*W\371\224\356{\204T\237\204\004\342\310\250\210hH(\350\003\220\207\037\237\036\236\235\245\246\016s\231\203\243L*!\217i\263\272\317\001\323z\022\022Z\330\335A\314\001\022\341#\271\033\025\305Ia\242(\037J\223\002\277\242\244IM\276\340X(\231V\246\030\307\210\026\026\367\240T\204\"\rk\036\370\005%\005\002\242\304\353\207K\370\203\222\003)A\204\201=\244DJR"
+	.string	"\016\333\370\007-,\311}\036\370\205\004M\022\356a;O\n"
+	.string	"\\\033\277\007~\261\245Dv<\220\374p\215w\344\276\204eo\b7\315\256\203\026fv\346\226+5\371\032\343\245\322\013ad\317\331\362\203\241\205\221\035'M\376\370\"|\340\0274Uq&q\354^\272X\371B\230\330\223\337\022\273R\212d\204\b\343\233|\225\245I`"
+	.string	"\273\216w\245\300/<F\246L\302\267\261\007~MIM@\363\b\357\307\305G\267 O\357w\021b\203N2X\300\202\274S\021f6\264\320\004{\246@b\322\314\034\357\334\003\314\311\234t\261\256\353\262\027X\3307\304w\331ow\275\354\362\324\005[\334\330=\303\017\306\275d\253\355\257\342\314\223\211R\033\341\365\334\033\324\031\376\r\373`\260<'frb\233\230\326\325\205l\265M~I\017\3506\354\021o\321=\266\017\331\242?Wg\310\305m\330LK\r?\216Lo\321\007\364N\232\017.O3g\n]1`,\220%F\be1\272\273\034\342}\273*\027sm\364\250p]W\025\313[\354\214!c\201\005\374\316b\203]\026\007\325\330\374\322V\233B\356\337\274qj\337\2663\032h"
+	.string	"\371c\026\324\312b\032\003\330\220@\351\275\201|oPW\206\213\333\354n\215\353pC\271\256\\(\366\214o\363\300\276\355\307\215`\002\276\327\004\310\037\337\307{\b*ygfrs[\334\270K\347\344V\333\375\327\362\334\346\266\215\354\376\360:\300\344\275\301\344\265\301\303[\203\306\f\031M\336\030O\363M\340k\2760\036\370}\3611_\027'\374>\265x\337\367"
+	.ascii	"\026+T\334\360\233\342V\276'n\3675\361\273o\t&\257\323\371\276"
+	.ascii	"M\237\373I<\372ez\341w\351\177_\245w\371&5y\221\232\274 \232"
+	.ascii	"\274GM^\243&o\221\016/\021\223w\310\207W\210\311\033\244\303"
+	.ascii	"\373\201\311\013\244\303\353a\207\367G\207\327\247\311\333\303"
+	.ascii	"\344\345\311\341\335i\3626\233\274:M^f\223w\311\344\315\351\341"
+	.ascii	"\305i\362*yx\223;\274\310&\357Q\2077e"
+	.string	"\362\366\222\227sx\177\301\220\032\247\240\025\267\035\232\f\335\n\244\321\315\nx\344[\362\350\317\367\367\375i\3765\177\340?\346'\374\013\177\303\377\357\357\362W\371\255\374v\377\335yv\277{3{5g\263\3135\033M\342\342Y{8\247\354=\323l\224g\353le\022R\370\366w\247\362\314\321P\335\314~X\243\332\023kU7\263\3101\350\337\342\376\357\210W7\263+\240\203\213\001;b\024\243Z>\364\023\333\234\207\006j\036\314j\344<U\353@nzn\314\342\236\230Eu2\022\232\337\225,qx\214E\345\321\245\252\320\003\371\243\207F\372A\377\030\347z\f\340\022}\242Mt\212\376\001\242\202\361\275Vt\272\212\331A]Q\337\236\254\374t\323I\226\350%\304\t\2255\032xT\026\2206\272\251\350\345Pw\003\027\267\t\302T6\332\204\202N}c\232\242\242\021\200\206a\234\363\351\024\315q,\027\347\323?\374"
+	.ascii	"nz\205fr\373&\344\210\223\235\2456\262\311/:4\272\r\231#\316"
+	.ascii	"\304\004\244\215s\255\311\3244\242\300Ew\325\027X\206\030\366"
+	.ascii	"\036\300\031\2736\2638/w[4\350\234\340cy\235\n5ZS\311\324!\002"
+	.ascii	"\020\206\001\344j\255\355\351f\237\370\302\323=\235\324\333i"
+	.ascii	"\236\032\334\344\206\333N#Pfn\253\215\007\023\335\354 \301\261"
+	.ascii	"\277g\023\247R\247M0{\331:\215D$\200w\325\"j\032\337\213\331"
+	.ascii	"\377;s\266\326\346\364\262\221\210OE\234\316\351\253q\233z\204"
+	.ascii	"\223\340\364\303\240}ps\177\222%\236\255\353>56~\341Z\327\255"
+	.ascii	"\020\312.\321\254\367l\342\324\312\356\261,OE\022\275\266\006"
+	.ascii	"Z\003\\\031r\2053\033\355D\243\0134ZG\306.M\215\266\321Bj\272"
+	.ascii	"\336$\233D\327\350\207y\372dPq\213\013vL\324\222}0O\345\212\344"
+	.ascii	"\271A\321d\365c\3464u\033\342\2148\213\356\301^gQ\366\204H\341"
+	.ascii	"\222E7\251\220\206\306<~\276]5\005>#\262\345=vmfe\027\264\002"
+	.ascii	"\205\222C\242\227\313x\b\n*\233\232$I^\241\331\220\262\177\n"
+	.ascii	"\t=\336\3237\320<\234V\333\022\206\311\031}D\2424\342I\312\244"
+	.ascii	"\3465O\327u]\225I=\243\243\352\304\330\f\300\307F\366\256\272"
+	.ascii	"Du\343{m\022\217\326\332\345 P\315B\257\026\324\267\002\n\177"
+	.ascii	"\\\016c\026\324'2\250p*\034\362Gd\337KH\332\307>\342Sq\213\033"
+	.ascii	"\3259\376R\245(\1770\020UN\235\362\342E\337\313\217m\24030\362"
+	.ascii	"\005\213\243\351\n\007\026\024\025\321\342\300\321$E5\205\345"
+	.ascii	"\224\243\212\212\252*j\b*\003\336 \003\306\222\362\300\n\n\013"
+	.ascii	"9uU\245Cy\025A\322j\nJGjUee%u\234\272\216C\300\001\357\300\232"
+	.ascii	"\212\252\002AJ\202\022\240\250\2269\252\246\260\240\254\244@"
+	.ascii	"\220\212\212zQ\002\024\325N\216)(\017\322\253\b\244\250\246 "
+	.ascii	"\300\312!ee%B\224\316F5]U\215`%u\345\204\205\303\203)\020:p\312"
+	.ascii	"1\005E\345\024eu\345\324T\264U:\244\254\234\260\252\252\254\234"
+	.ascii	"\226t[tw\261\325\316\323%5X^\233\231\234b\025n\\4cL\n\221LH\327"
+	.ascii	"\025\355\t\357=\212U\272\200@b$\243\333pi\304\225\\\270R3a\227"
+	.ascii	"\271[\363q$\243\017xe`\035Y\224c0\212\321\206\033E*\363\303\377"
+	.ascii	"\b\233X\303\350\030\315b\360\271\306D\027u\002M\242\357\371\305"
+	.ascii	"If\243gC\b\243\317\346\n\274\201&2\362\2659\201p)j\265\035&\272"
+	.ascii	"\251h\321\201\350E\013n\024)\260\f\212\003\234\030\330\03047"
+	.ascii	"C\255\266H}\324Vu7\200h\244\356"
+	.string	"\301\347\342\033\006\334\250\362\017D\243`\343\333\342\306}\321G\235L\033\362g\324O\375\242\227iC\270<\2770]\251]t\216\340\220\350\363\2153\355\356\n\243P\253\231\255\215v zb\344\202Z\315\250\255^\267Q\245Q\377\360"
+	.string	"\200iqb&\307\367a\006\367\263\016\221J\275G\314B\314J<\266\026\027\2653<\200Zm\213\236u\006\351"
+	.string	"s\341.Yg\262r\310R\223\245\006\371\243\003}\304\007P\344\212\221\025P\t\233\207V\333\n\236>\215s\346E\314\224\304\236\240\276\261rQ[\325\375=uQ'\323\312\270<\027S\364R?\3652\255,\372dB\324[\203*egm\313\275\320lq\343\336h\"\006\352\310\032\273\336<\371\001\352\241\356^~\246qr#\021\262*\214>\255\266FO\031n\340Y\321?\274\322\315\233\224\256\350\216\212^\352\036C\035\324Gs\026\023\342d\211\016\202B=\224"
+	.string	"/\365n\026c\226\016\310{\t5\ng\037:h\007\336S\265\002\201s\250q(\345\020ThdFDD\222$IcA\005\304\020H%\254\016\022@e9ISC%&)(Ii\257\003\031\261x\3058L\216\351W!\221\270\352C\025]\214k\327\\c"
+	.string	"\223\023\335\006}f\207\315Y\026\374\340\247F\034\232\017\276\017\222\303gC\302\201\271\275\203C$\303\254dz1\265\323\250a\215\367\224L\330\333\243k\276\346M\031\306\002\354|B\264W"
+	.string	"\250\035\250\367\322We=CE\367N\276\374\346\326\335\306\005)\263\210\345\243?m\307q\033$Ql\253\337\034\032\211\034X\350x\006\036/\373\353\231\333-\211\343\b\360\034\356\317\26722\n#\231\3545\354G\362\307\352\323}\025\025\250\314=Hy\241\266\243\003z=\211\225\374\026 A\304\007/\003\n\027\210)\301\301/c2\006\215\343\333\241\222\270+\f\203\013\273\307,$\263=?\323f\332\307\341\346\342+\035\250\fy\017G\314\001\267b\243D\343\251g\376\306J\331\234y\205\031k\355\b\037\223\376\0201H0\006\315\001A\331x<j,{I\034\202\2779;\360%Hv3wp\227\354\273\272\247\254\022\203\250l\177A\343or\364\030\336\t\0075\320^)4"
+	.string	"\235\"\221[\262k\351\"\206F\240\311\371br\350\201n\252\323x'\bl\357\fR>\0265\372\216\224\230\2442\303\320#\230\254!\215wU9R\034\301N\232?X\320>N\203\004\270\2371\3714\0262\265C\344Z\033\2449\322"
+	.ascii	"\251\236\016i\003\340Cf\332\326\003\352B\250\rr\2211\310W\f\304"
+	.ascii	"\036gdr\211\233\0173@\377d\333\250\020F:\3130\333\376\230\321"
+	.ascii	"\226BA\003\372\b\340;\001\211E\254[Ws\177\n1\251\215,I\006\177"
+	.ascii	"9\267\234'\241\205\341\323E\353\274\335\356\310\036w\243\r\230"
+	.ascii	"\315\225\325\026\206\332%\266\016\200\370\2406\027\0345\nR\322"
+	.ascii	"J\325>\001M\243\032\2400Ee\241\025\241\2528\356UR8\302\340e\255"
+	.ascii	"\245\304\271\033R\343>,\370\201\235\215\330w\374!\233\333\026"
+	.ascii	"\202!\250&\270r\206\177q\036\223\006I\tE\275\370\361\007\203"
+	.ascii	"\314\241No\2640'\377]\334\373\364\247%tr\021\330\346D\364\273"
+	.ascii	"\270C\220rt~`=\222\236\231\251\243\2721\373\215\fu\336:\367\313"
+	.ascii	"\356\243j\242'#\013\353\321\377\310\200\306\373&\255\270d\233"
+	.ascii	"<\017\370\251\312c]\224M\003\217\203c5\333\312\225r\261\323\212"
+	.ascii	"\302\354\024\266\307\312<\361\313\f\016L\001\240@\"$\237\020"
+	.ascii	"\275i^\363\352\221g\004i\214\n\036LBe\032\212\021\256o\364\326"
+	.ascii	"\030\034\237A\344\232\027{\024TJ\225\240!}@V\031\210;i\225: "
+	.ascii	"+\336\342\221\370(\242Y\224\346j\002\320]\332\333\305\230\200"
+	.ascii	"\n\371\t\211\367$\275\234\337\037"
+	.text
+	.section	.gnu.lto_getServoTrackingError.114.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\035\b"
+	.string	"\302\21787Po\322\001\243\034\"\032\201\342\367\201m\234D\273\2356^\017N\035?\"\024\266\246]\234Q\243\034\317"
+	.string	"\321\032g\306\315b\246\340\004x\\\351\004m\314\276\335{\313\224\002\331\345\tE\177,\r\233\310@\332\02494\\\017\f3\342\362@\314O\246M\213\300X\b\224M\021\206e\223\343\355\343\302\023\204\235\022\264\250\270\312+\315\356&\370$/\221\360Q\227\246\030\351\271K\177\0047*%\375l\217\244\220\303~\\x\262U\r\237\3725\006\304`t7\271\354f|0\313\"U>lo6G\237\362\2127\273\033')\273\213\340\003\315\245m?\344\"\233\275\212\236\007\252"
+	.string	"\244\345\302\344ewg\347\003\231\313x\201\314%\354\370v\335\374\217|Ae\372\270\216t\005P\330]+\327i\334\360\266\rl[\266Q\002\013"
+	.string	"2\241\245/p+\n\"\026\017b\002r\r\177b\302\271\204\021\025n"
+	.ascii	"*\217\251\235d"
+	.text
+	.section	.gnu.lto_getServoTrackingDelay.115.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"U\b"
+	.string	"\006\320:7@\345\2501"
+	.string	"|\356z\204\022\211\347\206\260u\252\375\t\352\277\242W\316P\013\315\266\341\352D\366B\026\201\003\f\017\227\247\270\036]\241\220\304\n\034,\226\314\321\244\2242\245("
+	.string	"-"
+	.string	"'"
+	.string	"/\377'\307\004\030\313\350\001\214%\354p\347\327\325\0361\003\353\344R2\215\374\002\026\376\367\225L\032.t\333\203\266X\333\224(&\237Z\376\214W\200\263H\327G\333\256\335<\253\272R\315\277q\242\362?\241\b\031\313\266u\210E\272\266\025W\036)\003\020"
+	.string	"\030&\001\377\025j\022\227L\324)\313V\210\236K\226\265\bj\\\244\367jW\243\0079Z\307\377/D\265\357\025Ze\277(\360\n[\326\001\305z0N\243\330>\334\f=8d\020\rS\"\353DL\317\306M\254\240\032\350\263\315\220\246ms\263\272\343!\nB\016\t^X\230\325V&\n"
+	.ascii	"2\241\245/p+\n\"\026\017b\002\032\230\342\022KT`\003P\031M\355"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_writeServos.116.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`\r\020\205E"
+	.ascii	"js4\031@@dR\007\013\221|!\020\224@\004\2065\013\337j \265O\356"
+	.ascii	"\253\351\026\255f\020\033]\244\177\246*\f\205\374\240\377<\350"
+	.ascii	"\233\t|\007\360q]\375'\212\343\343\254\336"
+	.string	"\307\342\215lM\356\235RJ\001\213\001b\001\177\001\316\377\316\376\316\035\002\311/\320Z\313\251i[ \203\214Z>\266\r\225\306\353\246v\223\351\016\323MWF\360NI4\215\035\031\316\223\213\226\031\324\266\355\203a\263\314\375\205[L\203\351\272e\207\271\321-[\333=\370\242?\026\f\233\275jd7\335f\327\236\262\221\023,X6]\216n\233m\215B\321\347\240\266\255\343j\226\267\206\315.\231\253]'\327FEy\234\331%j\333V\371N\356\275\307u]\221<\354\265\256Yi]\366TR*\n\352\t\351\324\304\264\244\224tD:2\026\211C\341e\251\252\254\326\367%7\223.{\3165fOy\351\244\227..\005\307&\355\250u\353\315\216\220\356S\223\256H<L\0025T\367\251Q\341\342O\353\021\037,O0#g\370t\031)\216\234\322N\213\232\026T\255\300\261\3155\323\032\335\263\262\264\n\323\324\3704"
+	.ascii	"\024\364\354\273$\256\204\025\307&\327I+\221\215M\230\356S\233"
+	.ascii	"[\031\374\315\201i\273\306\272"
+	.string	"\242\206\304\217qlo\215t$\f\233\366POt\n\b\307\346\326\306b\227\3155q\330\247\366\\\257\256\250\265\271\260\341\330\214\364]\267\006\2619t\\;[\221@\346\234Mg\337\232jJW\271\\[}\231F\201Bw\344Iqm\307\025\246\271I\033Nm\216\270\n\351_\301v$r;\256\351X\217\024\235\351\351i;\332\232\231\2730\254m[v\347\032[3\200fv\033\314\f\201\371\b!\215\270\273\001`\263\212\325C\001\271\327p5\311G\020W\223i\244Z\354\376q5\271''\252\305\256\0377 \256&\005\345 \373p\373qJ\244\207{O\322\037<\334}\\M\352i;\336\341\336\033v\251\303mg\265S\245U\"\207{\016W\207\315\266\2226\352V\005\0163W\247\250mm\313\3547w\266Zk\353\346\202o\374{\332[O4\201\253\006\017oH\017{\346\016\036\032\317\017\t\237\216g2\2233\177"
+	.ascii	"\341\355\f\373\026\323\310:\277#\334G\215\220\272\177\350T\213"
+	.ascii	"\335~\021c\376\350pE\314\215\246\323\210qK\341\021c\336\316f"
+	.ascii	"\271\307n\263\3751\236Ti[\231\017\232HA\304\350\314*Xx;9\313"
+	.ascii	"o\b\237\3313\231\353\230\376P\346\376\301@)\024\376&\314\037"
+	.ascii	"2\\\2400A\002\004\241\363\203\016\323\034\326x\315\n\232\332"
+	.ascii	"\f\326d\232\023 8\240\374j\272f\257\241s\327\352\3145t\336zg"
+	.ascii	"\255\3259k\350l\340:\027`\235\t\\\347\001\254\263\200\353\034"
+	.ascii	"\200u\306\272\316W\2543\200\353l\305:W]g*\326y\352:'Yg\251\353"
+	.ascii	"\034\305:C]\347'\326\0319tv\272\316M\2543\323\320y\351:+\261"
+	.ascii	"\316I\327\371\310:#]\347#\326\331x\235\213\2543Q\350|\2573\313"
+	.ascii	":\257kK\017e\004f\222$\274SsN\325\212\253\301\036\255\357\272"
+	.ascii	"\241\3249\202I\020\254|H\177=\232\220\006+VW%\260\227\360#\314"
+	.ascii	"\244 jz\247\257w\372\326;\023\364\265\376z\b\277\3521}\323\267"
+	.ascii	"^\233\033ic\372\276k\226\313\263O\340\337\245\005\262Iz('=\221"
+	.ascii	"2<\2629\347\215\312\321\332\256;\216:g\016\351B\247Q\335\314"
+	.ascii	"Q1Z\202\242\226\3764\036<\214\034\273:\301gx+&R\3244\337\314"
+	.ascii	"\224~\351\275~\351\373\357L\260s\\\257\277\360\353_\363-\351"
+	.ascii	"\225\276\377\226OW\003\222\364m\327,\335s\317{^\021\346\037\244"
+	.ascii	"\207vCq\023d\355\350\370]H\177t\247\373@[\221\356H\257\374\310"
+	.ascii	"\370G\337h\276\374\254i\374\316\362\324\013l\323z\235\345g\310"
+	.string	"\310j\230\331\005\244\260\303\267\343\231Eb\221\370\305w4\316\364\226\370\375\346\t\247\351,HtXu\037|O\233\b\327]u\357?x\366\26363\037d\356E\315(\307\322\313r\272\234\336f\357\343x\346\005\266\025H\213\003$\274r\366\271\232\331\301\203\253\035\317\344\365\331\357\277\346\2402\0374\324\211\"\f\333\266m\300}\250\021M\340\226\322,S\250P\3416\3136\347}\323=\337H\333\224\371 S\337\236\335\245q\377\311\306\370I9\263\005\f\336\316\377\366\3437\3558\355\307\205\217\351\215X>\252?\335U\017\035\324\034\306\364(\032\006\2071\026(6\304h1FF&c\004R\2151\022-(\024y\304\027\f\0273\310\306`(c\2340\201bE\te\013\024b,\224#\310`(\277\246\330\305\21312e\f\027.\310\224\306\272\266\277\tW\343\360\225\275\331\224\226wEA\360]\177\231t\271k\271Du"
+	.string	"\223\017e\"MB_\242><\257P\007\036\001\027\327\265-\3277^\025\214\324C\311\364\201\377\360F3\351\236\226o=\363\222\312\322\312\201\337\372\313D\032\347L\320\221\340=\321\023\365Pf[\354j\275+\362;-\tB\216\234\3618\255^\030\250\025\251\374\001T\275;Lk\347\270\253\017iV\372z^\217^?\200\032'\315\221w\216\333E\315KC\364\265>\360h\204:\353E\024\360\253^F/\363r\313R\352\355\314Z\302\253b\351\274\276\362\364P\006s:Qxds\257Z\345\325\n\036\255\313t\307Q\367\004\235&T\371\220V>\232\2609\357*(*r\267h\222?H\005O\341K\230Q)\360\006\224o\340\373O\371\023\b|\001\"\376eJ\340\273\314`\347!c\204\213\323"
+	.string	"\001?\240\213T@\243"
+	.string	"X\037@K\024\213Q \237\316\002\004\330t\365^"
+	.string	"\376\352\212\025"
+	.ascii	"\207\002\255\336\211T\275U\021\237\233RuHJ\365]SO\345\345P\236"
+	.ascii	"L\005\266)K>WK}\362\033M\227\307A\245\fI\363t\026 7LQ\337\005"
+	.ascii	"\365Q\337pK\240\004==\027\362\237\336\220 \253\201m\350\264\034"
+	.ascii	" i\201>\250a8$\025b\206FDD$I\2224\006\241\005\304 \306$;\017"
+	.ascii	"\021\320,\306\230rD\306\244\240\240P\230v\003i\362\345\317\230"
+	.ascii	"\242\036\t\b`^,\023\356\225%\240^\314\231E\353v/\177\314\202"
+	.ascii	"\025\364c\362\225\016\b<\022\370\177\001\241\336\260\006)\347"
+	.ascii	"\007\302\332\252\344n\224-*'%\257\232\260xQ\024\230\212v\260"
+	.ascii	"\327CJ/\277\357\237\272\315\371\037p:\275D\271\230\204\356\220"
+	.ascii	"\026/&M\241\206d\220\361\356~X\035\204C\311\r\224\234\002\315"
+	.ascii	"jv\3414U?\272\325\342\261\221I\347\333.\274\177\3073\234\345"
+	.ascii	"\337\030v$\t\007F/\2176ft\347\341r}\3156\337/\356\322t\304\331"
+	.ascii	"\366\231\f$\266\031q\323\361\351\260}/\r\233\367RD\"1\005\244"
+	.ascii	"\373\212\024~\241\006E\314u\201\322&8`\342\331Ch3G\213q\021o"
+	.ascii	">\257gV\241Dor)\020z\t\252\240\rC\274\315\3741\350{\325J\244"
+	.ascii	"\306\025\206 i{\024\257\366f\354\330\322\373\020\262\334 \336"
+	.ascii	"\337-\216\377kW\232\036x\311\3063\034d\234]\215\231\246\356\f"
+	.ascii	"\275\202\331|4\207I\0135n\334\364\340\341\342\355\231\251\t\023"
+	.ascii	"\205\366i\307\242o\312w'^\314\013Y'\340\353\347\226v\337HM}b"
+	.ascii	"2\212%\245\220iy\251RN\274\304\274\037\022\0044\315J\334Q\225"
+	.ascii	"|2\331"
+	.string	"\001\375\331,\371.'u\373\016R!U!D\250$\202g_\032\334\230\f\225C\347\267\007P\324\002\320b\226\305f\243l\006j!a\332\256\230\020\333\314\306\260\037\t\2369\f\256$A+\245w\206e#\031\004%E\346\306\\\210\347\030\032a\205K\363\004{"
+	.ascii	"\006\034\312\347\026\333\233\362\307\027\350\035\021=\267\324"
+	.ascii	"QN\262Qjm\235\202UM\337\347\326\233K\\\2649\021\027 Y\271\310"
+	.ascii	"\337>g+$B\337=\241\343\302\367\032$/\260\343\"l}zY\030$\252\373"
+	.ascii	"X\332\334*\234)\233\340\377\253\351\033%\f\365\021~\210\204P"
+	.ascii	"A\024\270J82\264\007\334\031\365\r\336\207U\033>\221\002\224"
+	.ascii	"S\rfG\227\201\324\331\252\021\033bJa\367^XEz\255\343%\361+IX"
+	.ascii	"|\f\003\b\r\313\330`\3142M\372(\026\343\2474\266\032"
+	.text
+	.section	.gnu.lto_servoMixer.117.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`L \355\215"
+	.string	"\352\350\3442H\020PJk\f\017\206\263R\030\371\013\321\036\316=\277e\326\244\025\360\303\223\235Q\031\317\024\001\366\n<\234\236D\214rY\207\353\264\203\320%X\013x\035~\257W%\336\323qr\306\344\3475\\B\273$\256\203lM\246\224R\021\003\337\002;\003,\300\3219\200\2433"
+	.ascii	"\2553S\353\274tt\246qt\236\321:\313h\235c\034\235a\3648\2778"
+	.ascii	":+\265\316.Z\347$\243s\013\2433\213\326y\005\353\254\202uFj\235"
+	.ascii	"\217Z\347\024\2543\n\326\331\250u.j\235O\034\235M\034\235\211"
+	.ascii	"X\347\022=\316C\254\263P\353\034\344\343\f\324:\377\030\235\217"
+	.ascii	"Fg\237\326\2715:\033\215\316l\353\334ct\3461:\223h\235w\214\316"
+	.ascii	"\305\326\231ht\036\266\316B\243\363\312:?\353\354=\316\335b\036"
+	.ascii	"n\b+.Y\276M\332\373\244N\340+\204P.\254\365\272\357\272\337\272"
+	.ascii	"\253\335q\335c\272}\350^\353\2466\217\267\264y\230\233\247J\235"
+	.ascii	"\277!\370\277\254\375\345\265\036\367^\033\"\275\206\205c\330"
+	.ascii	"`!\302\335\206H\263yB\242J{\237t0\375;\373{\337\264\f\212k8\311"
+	.ascii	"\023\257L\215[\337\002yG\270\236U\273\026{\322\235\351:\250\236"
+	.ascii	"\343\020\236e\376\240\032\2106\303\314\303Fz\216\3331xn\272\316"
+	.ascii	"\214\034\3512l\302\313M\327\031\367Z\3231\277\320s\234\344Y\327"
+	.ascii	"\306\r\327aZL\3135\031\346\361aj}\271\022\210F\021{\3374\036"
+	.ascii	"\002\324H\366\230\251~\227/r\207h\r:\342\220\224E\235}\357\233"
+	.ascii	"v@\025\271\276P\034\321gS\261\205n\r&\331o\310\246\332!*E\200"
+	.ascii	"b\013}\274\201\206l\353\333\346@\324\211\330\013\314<-d\3564"
+	.ascii	"\356/^\272\207dSy\256\337\255\267\231\374E\257\372\336\367\005"
+	.ascii	"\240\330B\244\225DO\231\247\317\032-\331R%\3756\337\242\037\227"
+	.ascii	"\260\276\367\315\222\321B\216Ql\241\013\321B\303\026\316h\240"
+	.ascii	"a\013\223\314o:\r\372\022q\321\201\251\366\367\276/\323\347\220"
+	.ascii	"\344\343s\304\305^\323\232w\326d\273Hj\301b\205\n$\245\243\024"
+	.ascii	"(\214\212N\230 *1$\024\004\364s\364i\215l\017\017\211\027;E\342"
+	.ascii	"P\270\276'\271\247\275\342\311\206\332\006\214\026U\273\b\243"
+	.ascii	"\246\315\223\252\335\342G"
+	.string	"\257I\034\026#\264\211\201\353\025ocY`\\\305\333\236\233#U[i%.y\222\245\357\262\342V\033t\372\344\232\255\006?\302ak\332)P\020q\260\365\261I\215[\232\264\215\316\272\310\314\314\231\237\270\300\255\357\f\220\312V\2276\021\245\353\342D%\312\302|\250\254.\213\013\335e\225\221\321\301\203\200\256\364\317\032\243\353\214\f}\227ee\025JS\305M\333]\361#\0260\367\301\322-\324\0067\022qP\331*k\266\213\214\024\357\271\313B[\221x\372.\313\311\366t\022]5\355\027+\321I\026\233\276\313\372a\265\021\007N\r\375\245U\214eq\371\216\n\034\266\242t\261\277\364\006\321\2538T\266\2424\021J\017\227.4j1W\244\367}y\264\226\370JB\013J\377*\364$K\323\250e\265\306\350\033cDO\333\261\264\224\356D\034\357\373\2627\265\266\232a4\363\0331\263\024f\024\314E\337F8\337"
+	.string	"J\001\360N\353ir\n\212\274&s\262J\362\313\273\311/\340p!\236\0202\361'\210\336\304\013\253K\"~\236\350IP\317\3520\007W94q\303\377*\361B\357{\3243C_\"\231\203KI\202\025\337\327\252\211\335\351\317\344\025\035\222aa\303\026\016}W\365\244A/\364\315\034\254\362:K\036\005\351P\234+\251%I\226\334\222\3342la\3207\201\365\316\027Z\227\260\307\020\350\243Z8\322\333\311\350\2209i\226D\363n\002}\347\301\221\"\204\325S\361\317\037\377\347W>\237?>\261.\213\343\n\360'9\230\234\370|\237q\342\001\2664\214\337\376*\310\276\361\211\202M\216\273A\303\257r\020"
+	.string	"e\302~\3739\361\242\322\036\236\357\211k\262(pB\274/\257\357[\305\202\304\363<\221o9\246LN\335\212\343\022\200\276\357\333\344\312\034LyBv*\257j\340\201\035;\276\373\234k"
+	.ascii	"\245?`\350\230\255;_\374\235_\371:\260\007\005yn\330\302\342"
+	.ascii	"\267\030\247]\224Hc\370\304_\005i4\340\337\360\233\214\023\r"
+	.ascii	"\240\234\360\247\310\026\332M\"\326\027\376*g\211\246\312\353"
+	.ascii	"\314h9\034W|\337\327\006w\021\355\027\0017\026\n(\370\226s\242"
+	.ascii	"\211\312%\241y\311\376\2778\314\367\264\213w\324=+\247\303\376"
+	.ascii	"\266\322\260\277\303<;\223K\331o\032\016\022n,l\001\006\336M"
+	.ascii	"\f\206-\354\227r\326E\271\252\274\016s\232\322\377\213\271m@"
+	.ascii	"\351\274\341\367b\016S\205{sc[\243\016\371[s\247u\265\271\247"
+	.ascii	"\035\327\334R4\326\3074\267Y\373\320\334]\270\220\t9\267\226"
+	.ascii	"\260 \347\306\322z\315m\345\307\271\24188\373\256\271\233\364"
+	.ascii	"Zs\303\320\324\346\306j\235\273yt\356\253\243s39:7\223u\356%"
+	.ascii	"\353\334KX\347\266b\235[\331:w\025\353\334TA\316\375\262\316"
+	.ascii	"\311\037g\267uVrtNrt~\341\350\354B\353\214d\235[`\235\221\260"
+	.ascii	"\316,\0049O\261\316R\255\363\021\3269\212u6\302:\257\320:C\265"
+	.ascii	"\316EX\347'\326Y\005\326\231\b\353\234B\353\354\304:\017a\235"
+	.ascii	"Q`\235O`\235\205\264\316AXg \255\363\217\326\331\007\353l\302"
+	.ascii	"\217s\217\243s\tGg\022X\347\021Xg\021X\347\020\202\234A8:\177"
+	.ascii	"\320\343\354\301\321\271\003\326\231\003\326y\003"
+	.string	"\326Y\003\3269\203 g\fz\234/h\235-\350q\256\240u\246\200u\236\300\307\231\007\220\263\004\254s\004\2543\004?\316;Zg\035G\347\007\216\316\016\264\316\r\264\316\f\034\235s\034\235q\264\316\013\264\316\n\034\235o\034\235\023h\235\021h\235\0178:\033pt\266\321:\027\320:7\035\235k\034\235\th\235\007h=C\276\227\317\276\364C\341O\370!/T[v\365x\024\276\250\372\343O\b\362B~H\t\306\216\355\236\334\365\320\006\371\037\337ceA\200\274\220\2179\b\005Y\244\341\307\267\f\317\271\250\234\321\307\313\200<\372\255\217\301\215sr\307\214\231k\022!\355)\262\350\343w\344\252\314\336\204\037\252\002\206\215\2456\250)Y\207\323=\276\251\370\360O\246\\8q\347$5\351\361]\3033\256\204\3574\022\276\204\357\245\330\bO\3023[\204\037!\204\327\340E\370!\336r\f\204\017a\356\261\232W "
+	.ascii	"J?\370\236\276\363y\360\035\374\007\337\322\367\340{9\310\301"
+	.ascii	"w\360&\324\326l\360\034<\321\334\262\213\006\237\301o\360\275"
+	.ascii	"\034SJ_\203\037\3421\0071\370\f\312\374\322\005\202)\357\227"
+	.ascii	"\270s\226\240o\205\301\267\364\031&z\201\364]\316R\314\202\277"
+	.ascii	" \210\257r\355Zh\312\335S\375k\301\367\034\030\005_\301w\235"
+	.ascii	"\017\272vl\2345n\272\316:\r\263\313\306\005\3354~D\205\216\032"
+	.ascii	"wv\204\007\272j\360\3346z\303\026R\360\005\350u\227\237\340\201"
+	.ascii	"\224nv\314\301!\034p\212\200?w\316\322\034\263\017\341Y\215\362"
+	.ascii	"\271\234\251\032P?w\016S^\021\335\345\233L\257f\236p\200R\017"
+	.ascii	"\2346\231=>C\363x\177C\335\203\300%xf7\216[\204w\223\307#E\360"
+	.ascii	"\022\274P\016s\020\202\217\340\215\370v<\004o\244\306\034l\032"
+	.ascii	"\302"
+	.string	"\214\230\201\347\277\270\247\206;>\212\252\307\354\312\3617S-\3308\237;\347\b:\204\273q\001\335#\\AWp\330\302\035\337l-\334z\302E\245\317Vf\211\026\211\377\342~\361^L4S\354\267\377=\242\f,&#m:s\262\256v\376\253\261\276\337\276\255\322\026\267\354B\016\231YI\236\347![(\033o\343\326\241J*\225_z%\363T+\363\253\362:\377=\204\231\301Y\324\261\206\347\201\327\341\300?\320\300; \306\357\3224"
+	.string	"\310\200\035\211\034\317"
+	.string	"\216\317\261\300\343x\363\2723\013\324\211*`f\347\306+\220\300\337@\340\023X\363\037\312 p\300\\\321\200?\300\306\033P\300\333p\037\344\n\030\2146\211!\312\251\361M\004|\215\037V\007x\002\302T\007\370~:\005\001\005x\033V\003x\001"
+	.string	"\370"
+	.string	"~\025dz"
+	.ascii	"\334\255\215\351{\313)\030]Z\023\326\321\370\245\031O\343\205"
+	.ascii	"uK1\031?\343\013U\3067\r\316@@\271\030^\326\237\203\3611^\274"
+	.ascii	"\322\303\020SN\245/\276\311\305+\235\231\271\370\226\301\031"
+	.ascii	"\030\225K\372\026\237d\226\366\276CV,\276\305\023\325\226bJ\347"
+	.ascii	"\342[\234\207\344\022f\362\352j\330B\026\337]\234~Q\271\025d"
+	.ascii	"\254\212_\361/\307\255\264\203\265C\333sh$\025G\217\364\253\032"
+	.ascii	"\226\213!o@\303\222Pj\344e9\202\023\225\246p,=E\262=\315sM\""
+	.ascii	"P|\212\177A\346\240\001\376~I`021\362g\364\314\311'I-\357&\212"
+	.ascii	"__\256\247\342\2427\372\265\032\203\177!o\344%gp\257$\224&*^"
+	.ascii	"%\031\305\231\224\"e\330\302<d\351\310\020)\037OLE\240\236\236"
+	.ascii	"\240\200\234\340!OPQ:\202D\371@\022\005\245\003j\003\025\204"
+	.ascii	"\024)\342c\b\220 )!(D\371\220\032>AE\235\260\016\221\n\342\204"
+	.ascii	"\244\007O\021\247\247o\301\307\323;\265\324\324\nE\234\204\f"
+	.ascii	"d\351\b\024\013QB\2160I\rA\301I\205\023\230\2128\371xb\002\022"
+	.ascii	"u\204i\251\210\241V\020\022\305$\005\005\025\305\304\223V\325"
+	.ascii	"\357\305\305\"\234BT\275\222\225\254\357Ke\201\226vO\373\330"
+	.ascii	"\327C\237\213\377b\242\231\026\315\345\177OIFw\223&\036\346d"
+	.ascii	"lJ\021j\234I\377\305\256\203\026\032\026\r\307\303\255\311\214"
+	.ascii	"[\321\316\357\352c5\371\346\362m\025\270\3463\020\310\026\372"
+	.ascii	"\303\325w\363\233\311U\227\262\372\315\344\235o\3117s={\342\265"
+	.ascii	"psx:\327\216\207\327\016n\346\310\300\375\316\016k\200uS(y,X"
+	.ascii	"\311\330\313\375\230v\376\016\016?B[\031\346 \3439\021\244\256"
+	.ascii	"\260\362\r}\037\244\202}\334T\361\253\037\306\275\242\203\033"
+	.ascii	"\026\006\375>\003\006F\366\226\246\342\277\270N?\r\333\312\023"
+	.ascii	"y\345@\335\263\362\256\307\256\226\007\343n\371+\033\002\371"
+	.ascii	"\334\332\364\260|\3575\213+\033\002\273\320\332\352{\311\273"
+	.ascii	"\262\255~X\267\034SV}+\327\220E\265\252\277\001&G\365\316G\366"
+	.ascii	"Tw\013\217\0276P<f%k\276\207\367\362~\253ia\331\023\357\nR\237"
+	.ascii	"\322{1\217\225\024\355\366\277\367B\006\026\f\237\374\006\334"
+	.ascii	"O\276\364\247S\\\334ht\330B\367K\350q\255G0|\273\375\020\265"
+	.ascii	"m\216\307\220\342\277\364\372\f\211\002j\326l\255\224\006\317"
+	.ascii	"\257\353\314\217\337\240\034\321DQ\344\337fND}S\225|\024)\004"
+	.ascii	"-K\362J^x\027>\311\367\262K\311\366/\374\3271\007\221\357\002"
+	.ascii	"\017\310\342oA\276\020\365;\354\233\315\210\2651\245\221\221"
+	.ascii	"o\341\275\217\310\262b\026\305\300\306\304\214n\272\226\340\352"
+	.ascii	"\311\214#Z\352\016{\254\026\314 \371\026\272\260\360R\217\344"
+	.ascii	"\215\346\226cS\317\202\331\223\271@t t\314\235\323F\344i\231"
+	.ascii	"\372\016\004\223\036y\251\260,G\276\355\300\344\252"
+	.string	"\246\037\225\366F\204tN\374\227\211v\321\206\255\345\177P\367\032M\313\017\347\230\\g\337d+\374\214\356\263\037\n.\003\225t\354N\377J2\n\201\327\017V\300\\5M\327h\337t\355m^n\272\320\244+\254\201\317:&D=\374\333\245\016'x\356:W\315e\023>\225\020\026\033\256J\304\365\004\377<P\353\254\234N\214\037\244[C\377\305E\355\272\r\333\313\377\240\352}\225\367r\335\3347\267\352V\275|\327\265\322\0245\257.4.\301\266*+!\250\017\2627\005Y\274\001\n\306\024\274\262.4\253\240\377b\021\226?\277s\003\020i\250\3009\022\371^{,\346\"]R\326\276\210\360\371\244\243\266a\003\372\243\261\327\313\317\177\361\223];\027\r;@\203P\243\302\247\360Ob*|Q\225\310w\np\230\330\342L9\022\265\360\310\250h\254\234\216\217\323;\221I\320\032z\371NAr\204|\202\244\250\362"
+	.string	"!\023\202\3229CC\"2\222$i\016\002\013\020\bC\211\332Rz\003\022\300d1\310\203P\321\214\310H\222\244\003\257\205\340\\\225\226]\251\004\252\355\205\257\306\025r\252Ca}\276\362\202\322\2526\" \226\023\241\372\343&Z\245\026\265\276\210A\037 \214\0202\253S\361qB\242\350 \321\354\007q\034\274\007d,\275h\373"
+	.string	"\261\244\210\200\241l\327\017\372\260U\02596\b\270\177Q\257\272\007\345\334\332\250\005\024\312\226R\232\333\253/_u\210\202\222\b\227\314\374f^5|0\024\205*\200H\364\336_\267\322\223\347s\230\0229Y:\344\232\253\321\033\351\331S\t\032@6I\257\205\226\316;\224"
+	.string	"\250l|\257-\347\245H\204J\254M:\301\212ra\246Z%^\242\027\0322\007=\032\362x\025(81&<+\303\335!\324\360\fuH\345\253ayIo\2034\273Nm]\276\035T\351"
+	.ascii	"\217\260F1\352\305\323\313\347\255(\314BR\002\013CR\343G\324"
+	.ascii	"\032k\346\03781\250g\341\236\236`\037\235\320\033\016m\023\232"
+	.ascii	"z\005\302<\360*\257\271$ \317v\007\277\230\fX\347\\\227<\204"
+	.ascii	"f-w\217)\027:rR\302\312\021\354E\366\325T\361\317\310\016\325"
+	.ascii	"S.\320\253=\005\330\363\246%\234\222\026\325\277\330\"\023\b"
+	.ascii	"\242~1Tj\347\373\265T \366\353$\247*\323\371\023\241\221k\333"
+	.ascii	"%{m\35440\226\n:\307\221\3309n\246\201\304\207E\3411>N\025\210"
+	.ascii	"}RO\363L\366\362h\272`\004\211\b\325\245\236\241\\\200r\225F"
+	.ascii	"j\013\\#\323W\026\210\243\376\306\360I\336\324K\366\277\344\033"
+	.ascii	"\200\265\315\232*\276?J\240-\370\354\270\256\224\245(\260\372"
+	.ascii	"F\006\313\032\375\212\360\006\271\241\003\003\230\254\026\370"
+	.ascii	"\304w\277\337>\306\244|\326\365\351bZ\2573\216p\322\345\210I"
+	.ascii	"\215\366\034\212\034R\233\302\030CY\234^\362\341\006$\201F')"
+	.ascii	"\025\226\215\033}\345\3136 \264\365xa\334\341)\r\321\352\320"
+	.ascii	"%X\031\247\241\301svS=\013\300\333\005\210D\357\223H\311\216"
+	.ascii	"\030\330\"\260t\305U\231zj\247\205\303\3105\t\377\250\3772\345"
+	.ascii	"\377\222\255\260\206Y\f\2066\227\226Z0\235\344\201#\006Vl\261"
+	.ascii	"\343<*\222\345\350\n\213a\261<\224\270\340\371\004`\330\031\272"
+	.ascii	"\271l(^'\246\263\241\fy\0052N\020\024Fh1O\005NJ\324O`8t@Y3\226"
+	.ascii	"\340A\033\326\013;\022\361\230~`h/\201h\306\262\236\354\311?"
+	.ascii	"r4\363\356\0065],\0269x3\317\226\354\261\0041\312H-]\266\025"
+	.ascii	"\265\207\347v\346\350\215d\340\376\b\201x\277\224.\372)\2037"
+	.ascii	"\274@\317"
+	.string	"*\335N9\354!A\211\247\024\276\320\265T\203F\352\260\306\253\303v\257\235\005\213\\9m+!\244 \217\004\371\307\352\027s\023\353\372\232TM\003\303\317\245|x\254\2740\326\224\274\f\323\231!\313\320\\\373KE\023)\223\200\265b\235\227\337&\361\315E\007\204><Z\310g>\006\032\2702@\311\023\2617M\363\227R9r1\001!t\0313\250I\224\212\3350\201j0y\001/\351\245\372\326\021F\326\352\262K\330kJ,)D%\0040\005\361xX\277R\247\355Cp\026tA\034\360\376\323`M\244u6\022\207Y@(\245D\340\033\r\\\030\3720\272\360\351)ry4N\013#\206\036k#\322\0068\221\216\203~\306\205\216\364rC\021A\034\257?\250\335\223"
+	.string	"2\007+u\236\303\222\020\302s\333@\274\354:"
+	.string	"\025\362Po\003O\025"
+	.ascii	"C\n\2409N\016\216\304\362b\305\237]\303\354G\304\022\305\245"
+	.ascii	"l:\016\236\274j@\033\210@\255\027z\245\231\r!N\335\260:\\\356"
+	.ascii	"\244\030\204+\205QF\b\006]l\320\324\025o\330&\030\320#\356\317"
+	.ascii	"+\2352K\200\006\3427\273\226~\204\350\206\224\320*|#^\356\177"
+	.ascii	" \275\352\240gX\306L)\022\264\342\301\223a\205\0315A\376\240"
+	.ascii	"\353\307\377rf;\003\231y\322\300k\200zY\277p\2666\3102\331\352"
+	.ascii	"\355sUjRA\357\361\275\311%`\366ScK\341\r\365K\302r\306\n\231"
+	.ascii	"p\277\366\004!\226r\003\252\023\0210\321\300\213+\203\365\306"
+	.ascii	"\355\267C\2319\253i\375\236,\322}pA\311\003R\364\033\237p\005"
+	.ascii	"\217Na\204\221&\352\313\004\325(PL\310K\r\025e\377n@]\3336\013"
+	.ascii	"\247.\007\230Ro\313,\312\326\365\377\205\210\330\350avi\262{"
+	.ascii	"F\201\244\fh.\377F\265\030\034\225\204>oB\250\351=Q\025\357)"
+	.ascii	"C@\206W\354:T+n\251\316\241\353\001\365\245\241\n\025\r\375&"
+	.ascii	"\031\252\342\304\223\344<\321)\272\200\373Ftl\352\300\212\213"
+	.ascii	"`\240\275\006^\243\r"
+	.text
+	.section	.gnu.lto_servoTable.118.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`l\0235V"
+	.string	"\272\217\250\037M \320\332\031\003C\301\223=\305\215\305\311\304.\0063U\264\357\0349\260\253\033\362be\372\337?\256\275\016T\213\225\350\031\b\304\32470 \344\020/\363\302)\3404\230\017\"\256\214Bi\337\021\017\003\276\b\326bFDvo\221;\245\224\002\336\001\307\001\352\001L\224t\036J:\013\265\316A\2543P\353\374\223t\366I:\367$\235yZ\347\035\326Y\207u\316a\235qZ\347\033\326\331\006\351\234d\235[\326\231e\235\221\255\363\221u6\262\316+\322Y=:\027\215\316ot\366\325\271\243n\002\321h\365\333\336\373>I\\\363\332\251pc\275\326-\355v\353gn\245\240\263\256\354\205\216\243\240\301p\fg\035!\005-\246\341\2224\030\376\tK\302Ia`\270\r\2352p\243q\277\365\227f\301m7\2163\262Z{\265\214Q2|/"
+	.string	"\307V\215\332gm\265\330<k\253mRn\266-h\326\264^\211\026\364\n\374\\\330\b\271U\3505\356-\254\242\205{A\2431R\f\032\302'\332\373\276\027p\253q\333\252\212\026\027t\232\022\243\345\332\373\344\207\n\204h\204\357\273\206\324*\2338\266\312\266\3542O\203\230\274K\026fd\256\244\204\357\373.\375\b|\354\342Z3\221\273\255$\032\022\n\002\372\361\351\341\331\321\311\301\271\261I\266,\362h\\\325\342\273\313\375\301\251\027\335\373\242\265le\321\350$k\206\306\313B+2\001\376A\3517+N$\302\326Y\017ii!38-\036\344\241k\253\254\201\312\342\306\374\247\314\347J\321\350\255\004\357\341i\252\263\3361\326\350\332\"\241u\252\210yN\230\343\334\030kxi\002vmMi\233\247\323\223O6)\336\356\364i"
+	.string	"\310\006\351\322\002Za\327V\224Fb\311\002\301\217E\237;/4\215\227\005\245h\342Y\206\203\336\322\036\260dq\271\261h\204\227EB\321\350}\337V\353\312W5\352\207\311+\366Y7y\201\221kjy\320\317\304\252j\315y\337\227\325b\026\335X\343}_\366\246\326V3\207f\366#fN\302\254\263B\335\f`m\325\351\273\214\330\016^\235\364\230\330JV\036\037\3645B\217\347\361n\346\n\261\327\330F\037\n\360M\246\254\261r\321\\\230\223z\315"
+	.string	"^\324\005C\264\t\223a\253\271\301m\245\325^s\312\241cm\265\307\367\226\006\321d\312\232g\232\032\225'*\313\242\\\306\007c\tV\377!Q\032\254\334\220\201\334\250{\254\314\006"
+	.string	"\361n\372\367Y\037o(\263\263\"\323\\c\351\207\353a\rM\"\215\032\365\200A\273&\221F\256\310;\316\234\200\020\357&w\2274.\330U\375\222\333L#Q\263[\372\341\215\024*n\377`\200\334\201<=\022\035\376\361T\3717'\344\307S\245\rsA4\364\231\036\237\275\346\233\273\301i\250\365\216[\217\247\312\033\216\r\265\3365^\347\361T9XT\317\220\275!\320q\327\361T)\310\325\r\265\266\332\035\302kVG\326e\230y\312\241m\356}\227\375\364\346[\242\370BqD\346\216\241\307@q[a\"Q\336\315\250\265\325~V\312\237\031\027\225'2\257U\371\20317\023 \223\214\377\213\231u\036\262:C\265\316\013\264\316B\024@:\007ii\363\323\321\031\001\326\371"
+	.ascii	"\326\031H\353\374\203u\366\201t\356\321k\315<X\347\035\255\263"
+	.ascii	"\016\3269G\353\214\343\350\354\304:\023\320:7\261\3164\332\255"
+	.ascii	"yF\2735\313h\235c\260\3160Zg&\326\371E\353\354\202un\321:\263"
+	.ascii	"h\235W\264\316*Z\347\024\2553\212\244\363R\322Y)\351|\242uNb"
+	.ascii	"\235\221Xg\023\255s\t\326\231\004\322\371\250u\036\221t\026\221"
+	.ascii	"t\016\221t\006\321:\177`\235=\260\316F\255s\021\353\334\001\351"
+	.ascii	"\314\241"
+	.string	"uV&=;\312\347\022%z\345\320\013=\3217\363\t\344\207^\215\013z\241-kA@\337>\220/\322c>}\254s\036\350\033/o\314\036S\313\317\253\271P\240\264f\240\317\377\364<\317\373|3\311||\317\253fv\236\347\373\n\361\314\205\036\265\354<\220\030\234\316\267\357\343\213\374\230\317\002r^\347\231\364p\336\346s\376\204\337\315\3430\361,.\324\023\303Rp\261|\220\017\205\233\367D1\265\344\333|\321\241\t\016u,\311\344\373\236\230\232\212\346\270\225\375\366\213\244L-\3107>\373J)\023K\225'\362\361\221\337W^\202\013mA>v\233\370\025\027\253\375\302Ze\257\342V\\\r\236\270ZZk\253\307o\301>\265\365\215\257\0362\003\325_\177\225n\340b\002\264\241\207\271\0358\345P\177\255\301\031WX\244\001\260O\247\225\254\305\357\256h\237\225\033~\340`J\216\354^\376\345\202\020\305u:\217"
+	.string	"\375\302\236i978\276\331\332\311K\363*\214\215\216\377\361XL\330\377S(\234m\227\312\312\354z\271`\336\315\377\346\273\301\205\037\317S\236*\007\3160\321=\034\251\224.Q\240Hq\334\360\0227\347\372@\307\323\037`\363\364\bH;\340"
+	.string	"\201b\026+.\205\311\007c\277\242E\307\nA\232i\225\200l\372\005\036\213\021\373)\310?I\331\206oya>\341ZY\322 \337l\013<;q\2418a\031\270\006\356\bbn\225*g\355\3160Uy_\002[\367\2127\3351\247\257\023\242\314I\336\3041\020\362\310\023\330\n\325~\256X\210cy\311\324\231.\224\211\335\312\231\270&\240\340fq\263\254\2556=\022\216\307\023\360A\272\310]!\256d\203Q\344\2031\217wzG\214\322Y\271\241k\346T\356\331\361}_\027\354\257/\3354vU\b\300\003\\D\tI\221\t\240\214,\035\2212bD\212\310\020\027y\240\215HM510\005\225dJ\252I\312\007\004QG\216@\025!\322\303D\224\220HU0\025\205di\202\"\016<"
+	.ascii	"A\003KG\036\2002\262Dd\n\311\222\022\021KE\0205\2654\201\224"
+	.ascii	"\324\324R\273F\325\377u\326\215\301\340\007vT_\305\312\007\343"
+	.ascii	"~\353\2431C\n<\027wf\274\214\307\222\341cN\376\250\244\311\353"
+	.ascii	"\356\342\373\276/\321\203\361\023S\210\0062\204\030\354\376\306"
+	.ascii	"\202^\374\220\307\222\361\n<\216\027\231?\3463\306\253q\2418"
+	.ascii	"\206C>\206\f\321\275\266\241\026\017\343i<;S\260\312\023\335"
+	.ascii	"\nY\227\007B0\376\3057\\;\227\007'D9\223G\307\3640\b]\350q\220"
+	.ascii	"\351E\364\301\271\370\0276\270c6w\323\257\026\004\323\270\370"
+	.ascii	"\027bj,\276\305\273\036 t\372\025\246\206?\026&@\247_\3174\017"
+	.ascii	"\262\341\336K\324\2542\236;n\311\341\222D\357&\253\277d\301\253"
+	.ascii	"\245\033PC\375\020?\003\365\035\327GT\244_\3174.\217\253\022"
+	.ascii	"\305\371\363`\274\342S\274\007F\351\226\336\347\2165\317R\216"
+	.ascii	"o\357\006\257\370v\353\316kC\343\363y\260O\361S\3212VnX\345z"
+	.ascii	"\356\030\362\316\217pN\206\274\033\254\342\217\3040\360;\027"
+	.ascii	"z\264K\361\375\326\305\027\234ufp\337\346\244PL\017\n:3K\217"
+	.ascii	"B\351O\374\322\216WJ\372\023d\306$!\375\216\357\020g\342I<\322"
+	.ascii	"\023\231)\361&\346\\hO\345\\\254\236\001\206\022\337\323\243"
+	.ascii	"'\361\252\337\013.\034\375:\347\224+T\033!\246\005\021?\"\304"
+	.ascii	"\203x\0219>\304\207\007\001\346\355\203\207\317\361\035\374\214"
+	.ascii	"\276\303{x\"\277\2427b\301\205\366\337\027\027\253\367\274\024"
+	.ascii	"}\377\211\251"
+	.string	"q\370\016\257\332\320\306\306\341\3138\345\314\220\320\261<\036\036\244\366\025\251]\007\251\373\255\373\311U\026:\034\244\236\361X\334\001\201\202\250q4#\221b\206HDD$I\222\264\006\221\005\304 \006\335\3316\022\240t9K3\306\024\211\004j(\r{\007\237\305\361\326\252\"\223\377\220\005\241\262\313-\r:F\005\307\t\256\205\021.^\351\3626\217'a\210\262\307s\237"
+	.ascii	"M.\007\tJd\331$p\201\304\236\201\341O\311\312H\306\002 \005\227"
+	.ascii	"\005\224\335\267L\"\220I\025C?\241\251>\013\371\342\240\004|"
+	.ascii	"lG\nL\006fki\324\353\204m?O \204S\366\367:\233\t\034_Qi\362\374"
+	.ascii	"\202\224{u\337\223\302\216.0m\245\255\026\007\271\330\372\021"
+	.ascii	"\214f\345!\005\005I\370\315m\221\340\366|\240%$\370\355\262h"
+	.ascii	"\270\254\r\367\377\336pw\007IY\304\344\245\013\340\306\263\207"
+	.ascii	"0\273$\3733\267+\225y.\233\303\201\037\240\247\277\277\273\263"
+	.ascii	"9\313\231\207\327O{ X\335a\306\234\215\f\004\262+\371\241\344"
+	.ascii	"\324\377\371m\233b\204\345*Z\326\204\336\343\222\nba\347N\377"
+	.ascii	"\356\252\221P\217\353\366YL\336\025\tU\340H\030\273\317j\335"
+	.ascii	")\374\277S\213b"
+	.string	"\324\354\317\023\240\336\376\024\210t\266\356\351ug#\252\275\344\026\317b\031\303\007\303\0339\374\017\2627T\250\b\310G#\267\213\201C}\202\342L\274yc\350\345\275\250n`?\204\310\026\271\r\332\270\225\331\251\365N\r\"\272F\035Z7C&\001\024\313\036\262\373\r\t.7\354`\256\355-\236b\325\245\027\252W5\020K\255#\230\267X8\\\217S$\377\256e6\340\tk\361\002\241\322h\271\377[a\241\302'\210{C\023v\004\347\371\022\315\224\312\245\353\027/\366d}\322\rv\306\351\243\322h\034\215\003\345\322Ki\026\032\2119\276\244\026\300\030\230\277\"z\271|\307w\0362\212;\361\3529\303e\374\277W\004B\366\363\02791wA\321\272D\265G\035\275\201w\243\327Q\261\322\354l\362\247#\232\b\365\214\376\025\253\003\2104\241\364\266\301`Q\210\005\215fNM\353\255i\215\321jr\007E`\033\200"
+	.string	"\b\347\257\362\323\024\033\255\336\306X\242\261:\004u\325\306c\006!0\270\321\211\b\216\013\023\365\034\355\257K\261\246\035\334a-\001\334(\202k\001\362\207\356\254"
+	.string	"\032\232a=7\353'\236\322\306\230m\205\224\t\\5\333\177\245u\344:\320Y\003\016\347\321\316I\006\214\2169\0134?C\002"
+	.ascii	"\322\0010\377\302\322\347\211\025\236AJ\034\2032w\323o\326;;"
+	.ascii	"/\r\354\2454\250\037\307\204\345\255\362!3\314 \247]J\024\237"
+	.ascii	"\272\335\254%V\232\214\367\206\022n~\266\2774\036\037\205$:\002"
+	.ascii	"\300\272\227\016h'\205\262\0137H\246'\263\306UHXW\230\251"
+	.text
+	.section	.gnu.lto_isMixerUsingServos.119.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375 \374\355\006"
+	.string	"\"M05Pm\222\016\244\204\251\246e\2536\220a\311(\rA\030\264\255A{\264\236\333\326vF\354\354\212\033\310\303\354\270\231E\202\200\350K\026\204X08j\214\3266\221)c.\026eQe,\270\211\200\320H<@\n\215\303\004\304T\026\274\024LUd*\270\241\250\nZ\266\330\fe\032x\022;\241\315\314~8\254!\025\331\344~|1\367\232u\272s"
+	.string	"\235\232\002\032\236\327\375\326y\311\361\225b\206\376w\276w\245\001\024\f\255\243\224\030A\335J<\231J@~\316[VX\340|u\363"
+	.string	"\021\210H>#*1n0;z\365]\267\2426`\243.\323:}\001\f1\306_\246e\364\354\177\360#\374\033\001\t"
+	.ascii	"2\001'8#\217c\261\250\360\\\303SF\274%\004\tw\316\324\316'"
+	.text
+	.section	.gnu.lto_servosFilterInit.121.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"e\013"
+	.string	"\326UPA\020Q\234\016sJ\212\350\247\310\325t\311\r\200s>y\203\004X+\256\247\251\310U\020\367o\361\003\376{\377z\330W\225\247\030@w*"
+	.string	"\200g\240f%\224\262W\364\035\257\3344\007}\332D\312\224\002:"
+	.string	"<"
+	.string	"?"
+	.string	"\235M\343!\310\n"
+	.string	"_\224V\334\330\335LEt\331\335\322\354\374I\206\342}\241[\330\207k\370\354\360\221,\313\356\036|\232\276Q\346$\263\273N\357C\335\361\266\025\3306`\277@+\353\207}\325\255O\347\304#\307\351;\214\221]\017%:v\025Y\220\270\352\366O\370\341Q<\244\273\312-\276\250=\007\0200F\215\335\275<\232"
+	.string	"\366hy\200\353\321:\200\353\361\025\007ik\026\362\236UCG@\242\241\204j\312\236+\265\201\310\fR\342\260\315]\205\007\333%\035\360S\\\344\202?\342\321\031@y\357\321\007]\217\251\013B\214\230\b\021e\211\035\216RS$2N\001\030\034$\320>\333\206\303\254\301p\332g\333pY'\002\004\216\204\007\031\005\016\203\t\231f\3432\314"
+	.string	"k\0256[\326\321\264-\253\204\242\353\007\370o\260\341b%\322\221\245)?\374A\224\300\035y\271\252\311\246\004\017"
+	.ascii	"2\003\006:\306\022\003I\217}OX\336\0073\240\313\214?\025O\027"
+	.ascii	"\314\262\312\362\322Dp\356\001\\\216\032\304\037J\031"
+	.text
+	.section	.gnu.lto_filterServos.122.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`\345\003\265\033"
+	.string	"\266s\264I\240\326Q:e\255K\207,8\363\351I^\361Bw(\356Aa4\304?\316\325\0310\314\005\365$\364\374\253\377\366\025\336\375\325\027\f\324\320KNp\3758\007g\203\335ZH\224\257\005\270\300[\234\357JE\237\020\262\267\224I\006\232"
+	.string	"\224"
+	.string	"\247"
+	.string	"\265\312v\017\265\037\256\354\364Q\227\322}j\233\274\266\250O\321\3644\246K\255\365\300\351\032(Ou~3\236\316\323\306\323\226\255n\227\213"
+	.string	"\243Z\224\340i\313\257\n\254\326Zk\033[~\016\277#\353N\216tv\311\272=\311 \006\f\026\235\234$\022\213*\263\340o\362|y\311\370\220\307\343\016\341\351L\360\305\3474\240\224\345b\026\354\315\033\256\032Z^u>\n\032q\227\302\227\3033R\3607uj\255\177z\001\036,`0\223\fj\255\313\300`\213o\354\273kcw\205v\273H\335L\373\363|\371t\224\275\264@\343\273\003UW\217\211\273\373\363\"@e\255=\005{\253\023\021\332\3438]\0207>\360t\177\033O\337\032\222\3128I\355\270\270;\344q3}MQ\261\265\275\264\213S\362\332\224\274\264O}g\223\267\246\344\245)ye\223w\246\344\215M\336r\362\222$\357Hy\351\310;)oO^n\336\007"
+	.ascii	"PCE\360Zaj]Q$S\267\350U\216O\375\273\337\013y\225\211\003Y\002"
+	.ascii	"Wj\255kb\0274\2358\220\035\263\222\212?j0\204=b\214\241\242\325"
+	.ascii	"c\342\222M\323\377\205\315\264\314\351Z\272\250\323\276\250\242"
+	.ascii	"d\315\364\223`);\326]\346\351PtQ\317\331\341\005\246\004\365"
+	.ascii	" X\272)J|\321#\013\224\223?i\340\340\001\037\030a<-\233\364\221"
+	.ascii	"Tt\222\032\233\354\336\362\013\313a\332\273\023(\214\007\216"
+	.ascii	"\255\323\353\242\025\300\335\263w+X\340\003i\353\030u\321\356"
+	.ascii	"\231\344\016\274\272\360!MJ\276\004C\206\236\236>P\310\335\335"
+	.ascii	"e|]v\\\354p$\033\312Z+\317\336\310\217p\360\261\331\306S\356"
+	.ascii	"\017\017\001,)\314\351j\307\305n+$1K\002\033\264\223\013\"\362"
+	.ascii	"\271\325D\340n7\234m\300\006\225\360 \241\\\333N\016Gb\350'W"
+	.ascii	"#\n\002\022\n\361\241&B\310\347V\263\r\345j;9\213\033\3613T#"
+	.ascii	"\302\341\206j\262\341\356\275\364\364\243 \306\330\3325\217l"
+	.ascii	"\246\255\351\2428Mo\224\007>\353\243m2\316\032\013)\214\353\013"
+	.ascii	"\225\256\036\023?k\255ul\246\355\361MZ\277\352\261\031X[V\274"
+	.ascii	"Z\3266}\264\213\340\263\306\351\034*)R|J5\275\\\033n\232\266"
+	.ascii	"\016\364b\3235\223\230T\344Y\261\242\261\246iZ/\373\300\360\270"
+	.ascii	"\270\214C\007\r\341l\246\245iY\277\352\034E\250Q &\231\"\304"
+	.ascii	"(2\023\210\310\214(\331\001`\002)S\271\016\021\2601F\264I\261"
+	.ascii	"\264go\337H9\r]|\200\220\233\223n,*\007\313\331G\236\274\007"
+	.ascii	"\316q\321c\031\221\255\004\346\261*\331XXC\255.X\272\330\330"
+	.ascii	"\244\026\326~b\235\005TL\341`^\356\202%\371\217\376\034p\335"
+	.ascii	"\353}\361\336\2132\327c\361\f\376\277\214\271\341\247\007\027"
+	.ascii	"\356t8\217.K\351\301\324b{\363\237\f\300*\034\204\224\354\032"
+	.ascii	"\356\023b\274\022\255\247\223\034\352:3s\002\374\231\">H\246"
+	.ascii	"\356\037\265\017\357\276\370\246"
+	.text
+	.section	.gnu.lto__reset_template_97.1.125.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375 D\325\001"
+	.string	"\264\0027"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\030\001\177\344\031\001\334\013\320\017\350\007?\202\210\200(\177}\277\001{\276\001y\275\001w\274\001u\273\001"
+	.string	"\005"
+	.ascii	"@\260\312\021L\273)\255`\240\b"
+	.text
+	.section	.gnu.lto_wingServoSaturated.part.0.164.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`\236\001m\017"
+	.string	"\306\334dE\360\222(\035\262\313\224\303;p\230\\)\352\bj\247\201\025\326&\177d\036U \307\331L6QT\007\377\021\236\214p\305\254\222O7\215\232\232n\3409L*\223m\227\361\304\343\\\373\237\032\024\025ido)S\nO"
+	.string	"O"
+	.string	"L"
+	.ascii	"\t\266\307\003\037\240=\302\213h\217\366]\330>\3318\377b\266"
+	.ascii	"\305(\033\207@\207Mq\240B\204\352\325cw\271G5q\3245!\312\177"
+	.ascii	"=[5R7jX)\327\303~\024,+jX\037\236\002\016;#\273\353\315\345\216"
+	.ascii	"\267=b[\202}\036\001\371\357\177H\266\024\204\330e\231\345\354"
+	.ascii	"\210x\223\302\366\375\030\207\231N\343\006-\031\213\3355\335"
+	.ascii	"\177\235l\217\307\232\237q\241X](0\300rx\361\020\333\375\036"
+	.ascii	"l\217\316\374w\202\337\262Z\234i_\346/P\207a\231"
+	.string	"\001\354\222\260\211\355.\203G\007A\240.xT\210c%g\303g\204\266\335\205\340\313\270\215\347\237x4\006R~\365\350\223\264G\325\303.\342\312\361C\346F%g\316[\246]S\265\227\225\215\225\026\251\234\245\302X\341\341j\t;\246;1\255e:~\346\2071\255\231\0166\371\214\274R'\362B\023JD\235\tA\251\013u'Q\003\250\202(B\210I>$/\303\bD\342J&%\335\211\005N\324Q\bq$#\022\367)`\357\002h\304\225<o\304yl\347_\337h@|>t\250hJ\025\306vGc!\00314\276\332\241\251j\007\210\312%\252\246NU% `\002!\251\254\003\360\236Z\265\002\024*\031`\210\365\255\022n=\350\304\255 \003\220ih\031mpC\201K\002\206\220\203\211<\036\341\210\241M\t(\b\337\217\315[\374T\304\277\240\363\211t\330.\254\255i\333\316\276\372j\346\027\366\255"
+	.ascii	"\026\257\230Dp\351\265a\f"
+	.text
+	.section	.gnu.lto_servosFilterInit.part.0.220.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`=\002\345\022"
+	.string	"V\244|H\320\362&\035P\027\314\341\200\304K\243\371\027\231P\t\323>\001\004g\016L\320\332\344\247\215zX\257\233\023\200e\306kl\004\324\244\334IqPH\235D_\362\b\364\243<\211\347\035\207\3017p\262\3335\026\261do\271S\nd"
+	.string	"k"
+	.string	"i"
+	.string	"\027\340}\312\223x\237\266\371\220\r\334\240T\354\356*\372B0{\265\372|\220mX\3151\273\307C\334\226\004\351\300\240\233\332]\360SG\370\273\fo\215\261K\2153\346_\350"
+	.string	"h\266\233K\251\332\2515\215\330d2E\n\352\303u\217:6\234\250\")8<\222|\252\022\354\256\277\016\267w\333-\266\027\3301\026\236\322\213\326\031\035e\364E\342\r\001\210\335\r\273!+b\"\2358\321cM\006\3145r{B\034\317sKL-\246V\026\236<\306\215l\\S\022\342xT8L\030)M\355\206\340\247\303O\355\333\3460|\037\267\037>\321\207|]\016f\226,\\[\355B~.\274\213\330_8\351\313\263\327\200\013\332\021\265\273'\237&\360}\262\002f\315\364\306\376\r\013#N4\3334Wr\200\342\264\273)6\236\364"
+	.string	"\202\212\212\3679\3654\017QU\317c\026\345\225#\261|\273\262\003~\215\037\271\370@\237~i\265\274\317\250/\"1\344\3178\r\t>\220c\\\361\264O\337\345}^\257\273dq\373\261\242\007'\356\254\327\242\235 GQ\177\2543Ej\206\302\352c{\252\030\206\271\320\242\3403\013\212\214\213\346\345\"\003\316\300\274\264&D"
+	.string	")\264Vb@\226\227\f\210bbW\005\227\0278\343r\275\300\225\355x\365\261\375g"
+	.ascii	"\222\203\tGs\254R\177<K\314\223\007x\212\236J\325\261\355\357"
+	.ascii	"N\362\244\306\246\334\223,\n\261^\356\356\252\376\330.p\251\236"
+	.ascii	"\232\344\226v\263\0209q\347\001\361\252\312\240A<-- P\002al\033"
+	.ascii	"\033h;\332Ii;\270.6\017\210\355\270j\357\202\"\253L\213\300\230"
+	.ascii	"\227\247c\234\270\r\242wIY`a\355$\267\367\200\225\325\t-\016"
+	.ascii	"\020\021\020\267\353B0\r\243\t7\345\313<\266Y0\331\335,\261\313"
+	.ascii	"\336`,}.\301\235\017\226\364HWY\375v+,\242\341\270\361\256\317"
+	.ascii	"\315\025\242\337\365\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`\013\tu#"
+	.string	"\2068\314@P\346\312p\377\357\372;^\257\373\353\377J\007\020\\\231\314^\037Kff\375\377\336\277\375\277\007!\361/\251R\034"
+	.string	""
+	.string	""
+	.string	"j?\334\261\302 \n\022@\200\345\210$\025\001#0\034\204\274\207\3342\005\267"
+	.string	"\265"
+	.string	"\274"
+	.ascii	"q`\254\326\371\342~\347\221T\377s\363\223\2657\325Wc\272\270"
+	.ascii	"\362D\361\266\006[\364\323\230,\316\267\242\037h\252\350\003"
+	.ascii	"\246\370\241\023\245\343\302\302\302B\024}4'\266I:g\242WM\211"
+	.ascii	"MI\374\316\210\327\021\361<g\210\3439A\334\316\302-\255p\371"
+	.ascii	"\320'4=\254\330\201\016\275\252\311(\207\007:\241\340\227\233"
+	.ascii	"\r\375A\246\206\027\036\310\260KN\f\017.\364\345\230GZ\370\036"
+	.ascii	"\021\212\242h\205\376\034S\301\r\235\024\372K3YGG\270UeB\337"
+	.ascii	"\213y\244\204\213\221\272\231\223\377M\321\005?s\376/B\223It"
+	.ascii	"\356\357\037Ol\035\300\r\322\023\241\257\307\374o4\f\273\205"
+	.ascii	"\326k\344\2547\313\254\027-\353E\222\365&\223\364\276\215\365"
+	.ascii	"\252\211\365\"A\322\253$\2547\r\254\227\353\253\227\314\253_"
+	.ascii	"hQ\024\375\215{\244Oh\273^g\344v\\\377\262\3650Z\037\223\376"
+	.ascii	"n\263\216w\376@\256v`\311\260\202q\305\302*\007\203o\252\265"
+	.ascii	"\311\353\235\213|\337\242}A\335\007Td\313\004\315E!\322\3573"
+	.ascii	"\344e\204\364\377\230A\326\r\310\242\375X&>\226\255\307\256\345"
+	.ascii	"\341\321\367\263\243\317\007\253\277\307l\002\263\023\273\352"
+	.ascii	"\017\232:\376&\307\335\3408\234\033gc\343kj\274\r\215\r\233\261"
+	.ascii	"`\247\214\375:c\254\227\325\005\317]\016\312\271U\365\003\001"
+	.ascii	"T\243\2425\357\351\203rjzG\363\304\t\016\370\304S\252q\335\245"
+	.ascii	"@lT\356\347\304M\352\322\211\013\254\333\204\224C\350\177N\254"
+	.ascii	"d\267C\257B`\214N\\|[\005J=:\243\023K\275\317\310\303\325\f\023"
+	.ascii	"\017\3253LE\3016_\244\316\307\304\253\356\021\340\252\344\376"
+	.ascii	"\317\t\241V\022\221\215\351\262\334\331\023,_\022\271\200r\027"
+	.ascii	"K\027\270\275\343\021y\200 \221\213\3536\270\202\372=\217\310"
+	.ascii	"C\245\336\365\210\274\353\362\210WY\346\210\207\177Zc\277\003"
+	.ascii	"\300E*\021z7\344%sr\200t9L\230\240\275\217!\342\266\3361&\275"
+	.ascii	"I\330z\315\326z\333\226\364\236)\351\355R\353=\222\326\001\337"
+	.ascii	"\344: \334\252B\340\001c\t\356\302\005JC\b\340\310XWok\262\211"
+	.ascii	"\201\262\016\217\214#\275r\276#\323Hw\341(\325\264X\255ViUJ\245"
+	.ascii	"N)\215k\323\332\264\264*\251k\366\241!\351\024\323$UEJW\211\213"
+	.ascii	",\213\221\362\356\310C\345\232#\357\312\346\310kG<^N^Y\335\001"
+	.ascii	"\217\f\341\350\310\b\242\216|\225\334\367\341B.\223\242\270\230"
+	.ascii	"\256\001-^\322\036\030\305E\312(.J\332AE!\2555Y^M\024o\234\335"
+	.ascii	"\n\230\322"
+	.string	"\326\225\004\305X\352\356Y\334\037\263\007B\361R\272>\r\024+%\237\240\030I\335\"\231A[\316\007\305\033\267RT\252\325\250\\V[\016Z\371\362\211\003\200\250\250a\020\t\203F\"\263$I)\035\320\002\251!\342\034\021\300(\t\225B\"\022H4\")\350\001z\241y\217\"\r\032\033_\314`\034<\216\305(32*\262U=\276Z\336A\326\020\004\273\023\343\304\205\252O'\363\341`\363\277\335\312cd\301\253\216!\246Q9b\361RW\321\202\322\370\204\310|\237\356U\227X\217\223\327zO+\rt\316T\274\245!\357\306\017\306\330B\356\205\300\216I\252\032\370O\332\277\3756\013\374\220\016\251\303#\032\362\260\246_K\372\263$\276k\352\263N>\213\324/`k\035)y7\t\312j\346\001\312\r\321\347\213\226\272G\361\366\206JJ\377\346oBSZ\342r\361\003\277&\317\036n\277m\330\215\321s\314\314"
+	.string	"\233\3318\242\317.\225e%m;2$\277AVrs\251\313h?\177\027\270\262+v\222\230\003B\300\026\377\035j\320\"\001\226\254c-|\241}Q\223\325\370\f\032\030\252\304{\366R\307\020\r6X\031Y\262\373\225\244<.\251\243\f\321"
+	.ascii	"F\332\337b\007\311\252\247\251$5;\266\330H\346\353=PnO\246\260"
+	.ascii	"\266\273I\267\366\252\002"
+	.text
+	.section	.gnu.lto_.refs.26ddd8d703b65655,"e",@progbits
+	.string	"(\265/\375`\262\003\275\027"
+	.string	"&\372\234@\340\030gX\003\300,!\320\250\227\233w\006\307<\325\304\302\3409D\210\024Y:\234\t\001c\2141\306\030c\2141\013\205\037V<y1\355\272 R\222\264G]\377\333C\2776\202}ldo\231\002\205"
+	.string	"\206"
+	.string	"\217"
+	.string	"un;]\3129\323\026 %\321d3\323G\340"
+	.string	"m$\251\333H\352DPw\020\324\217T\307\261\335\b\3321m\241\233\354\203\233\035l\303R\367\205\272=\246W\246wp.\001\234oR7\205\272(\234kcs\001\334dg\266el.\245.\tu5\233\023\240\023\246\346f5\003dm\266;\243]\242\311j\033"
+	.string	"\2301\247\265\231\317TF[\332\276mL\226\004\223\225\256\216vJ\273&\333t\223\356\354\206\231\004#I~\356#\257\027q5\270\207(\270\205\034\3016z=\001v\213`\023\275.\204\327\016`\027\350u\033\270\366\3619\201\317,\006\257\026l\240g\036\005\227F\3012\246\263\323\004A\b\26262V\366Q\366\034w\215n\tw\205\356\0077\220i\327\315@u\017\317\255\326e\265\326i\335\002\255Q\252i\356\306 \310\312\260.\261\326T\037\317\0038\267\354\302d\227V\227\356j\253\354eg \246\314vax\356\361\334\216\366\264\237\212\024(\212\356\221(*\3728\024u\321\222\345\212\366*T\236\334\231l7\022\"@N\347q:M\341t\321i\241\231\037\234\376\361\331'v\202\330;3\347\234\276!Z"
+	.string	"\321"
+	.ascii	"\2106\r\03534i\350\023\n!\350\245\0165\350\322\254\256\211\265"
+	.ascii	"\f"
+	.string	"\353\222V7[\235\203\230\327\302uo\305\t\023%`\037\211\021\"^_\b\020\260{\037\200>\017\257{\035~\276\r\256OC\315\375\245\346^\270l\321\202\005\350V~.\005J\2037\001\272\227\300\036IY\036\231)\313\240=\312V\031\206\254\224\325\221i\331\005-\216LBf!\253\220\302\355D\b\220\036\233\215m\243\355\242\355\241m\327\366\201m\236\355\234m\234m\224\3215\333\233j\002j,S\242@q\242Z\242d+\262=H\354\307\216-\366\033\332\025\266\211\266\033\024\333\245\335\023\273\245\315\222\260\201\355\356h\353\234&\2203\216\366\315vQ\3326\247\003\344|R\215\320zC|\3648};r>\0356j\320\310\276\0312\266{1\266\357\305}.Xh\001C\250qT% \0042\"B\241LPX\230\346p\"rL\246<\020\370\006.D\212\213x2\305\206M\313\205\001\230 \373\005\213\256\202xu\214"
+	.string	"E\236+\304t\302o\326\251+!\370Sr\004[.G\240\247\230\212Y\203k\201E-\020\362\333\317"
+	.ascii	"\370\221\367G\235\027i\2165|2\341QYCa\366!'^\360\032\304\204"
+	.ascii	"\325\344\336\244\347\370\032c\243\226E?<\366FK\252\323\003x\347"
+	.ascii	"\221\004\025"
+	.text
+	.section	.gnu.lto_.decls.26ddd8d703b65655,"e",@progbits
+	.ascii	"(\265/\375`8n=\307\001J\354z\242T \fQ:\215\001\265\370\203\340"
+	.ascii	"\374\362a\306q\351\201a^\270c#\020\343$p\343F\177\317\341a\211"
+	.ascii	"\230\365\321Ze\027\300\217\227\230\203\3274\036\2739\360\263"
+	.ascii	"+\"dr\241;\223\315\345\"\267\027\374\305\201\330B\205\233D\242"
+	.ascii	"\233\230L\363\270\022\271\367\226R\312\024\255\b&\n~\n\327\177"
+	.ascii	"\372Z\215\276.\243\257\301\350\353+\372\372\211\276\336\322\327"
+	.ascii	"T\372)\033\375\224\214~\352E?U\323O\275\364S#\372i\226~\272\244"
+	.ascii	"\217\322\351\243i\372\250\022\3753\013\204\036mA\377t\243\377"
+	.ascii	"\273\026vs\354\250\243Sk\332/\201VTn\363\277W\327\212\345\263"
+	.ascii	"\312\275\253\354\275+\340Q\263tfw\263\335\267\212\206\324\t\333"
+	.ascii	"\216\037T\322P/\253\271\0327\243\245Ym]\300\334\374\323\214\276"
+	.ascii	"\b**\313+RV\226{3\205\264\276\364\366f\336+\033g\313\035az`M"
+	.ascii	"\344\n\360\333\261\25246\035bz{o\241-/6\031pqS>\252\\(\367\353"
+	.ascii	"r\335'w\354N\271b\367\354\226]\260\033\345v]\262kv\275\256\224"
+	.ascii	"\313\274Nl\363\206]%\277K.\223k\365\337\253\260;#\n\232\036Z"
+	.ascii	"T\334R\016\206\205\353\262\334\233)\304\303\302\371x\002\366"
+	.ascii	"\337\253\260{\343\346\300\314\245\236\342b\354\206\335\0367\t"
+	.ascii	"f\256Q J\227\236\035\013\2731,\334\316\022sO\245>\264<\001v\310"
+	.ascii	"q\302U\003\354\203\374\023\213\276k\026\b\355`\177\320\237R\364"
+	.ascii	"\322\252!\222\004\360\346\237M\364\013\360\343bM\261b\344\006"
+	.ascii	"\271D0s\031|\002\242v\217\334\"\027\211m^#\027\3105r}\\,;\027"
+	.ascii	"d'\227F\264\231\303\203\013\352pR\345\250\223\323\227\310\020"
+	.ascii	"\020\354}\206\325\024E\343\346+$\323\350\342\343\310\315?\243"
+	.ascii	"\364O\027\372\231O?\203\321\317Y\364s\233~\036\323\317F\364s"
+	.ascii	"\224~\237\237>\256\3237\207]\003\301\336f{\357\n4\022+uTn\276"
+	.ascii	"YB\2778\026@\244\307\327\315\330\376\240\307m\372XL\337\026."
+	.ascii	"\r\333\004\341\326`\362\\\"o\320\240\334|\334D\337\202\200\342"
+	.ascii	"\300@\013\002z\274\245{\354\017z=\013\204\036K\351\337@\375K"
+	.ascii	"F\377r\321\277P\364\357\021\375kC\337\276\321\377}\001\202n\272"
+	.ascii	"B\005\354B\335'\024Ov\332\315\327\211\211\023\007"
+	.string	"\306i\306\315\267z\372\026L/\310]\262k\254\037&\243\322S\242\344h\263|;\311\236\335\344B\307\362\354\027\372]\262i\226\0173\327\364\223\217\035\277\r\274\373\272\270\311\313t\233l\363.\331\277[7\366\3153s\357&3Z\352\204,\363\356\222\005t1Do\357\235\212U\361}\331\311\267]\364\347,\020\252c\177\320\3335m\331\330>\333\344`\333\334\252\261l\01761\267Y\320.M\216\263\233o\247\350[\016(O```\240\345\200\336:\321\331\376\240\026\215\335\263M\r6\315\355\031\033\3673\311\334\314\275 LU7\337\"\321(\330\333j@m`\240\325\200\336\006\321\327\376\240_\263@\350\341,P\231\240\013d\334t\221#\203\227V1;#&\212\024;\305\216\001A\016b\246E\355\346\273 |\206\006\327\324\315\267Y\372\366\314\213\205s\263\274\202\245\215ek\263k;K=\233\t\214\337\022-\355\257"
+	.ascii	"\\,\334\226\031\275\275\231\377\255\030\033\306\326Y;\373\305"
+	.ascii	"\316Y0\266i\351l\227\3330+w\313\274\215\323b\3270s\231Na\352"
+	.ascii	"\323\333{_\304/\364\207\020a\351\354\026\013\207\231\313\315"
+	.ascii	"\004\206M\001_\002\247\274\365\355\315\354\320\241C\207\016A"
+	.ascii	"\035:\004\245\242$\231z\362\215z\204\005B\217B\377\204\276\t"
+	.ascii	"\372%\350\0367\233\30561\260oL\236\013\200^\200\1777_\001\372"
+	.ascii	"\026\003\324\006Z\f\320\213\320A\026\b\275\220\336\300\002\241"
+	.ascii	"\226\212\255b\233AV\355!D\034/\225m\260\2757\217\245c\222\302"
+	.ascii	"q\363;\350[+\307\240\265E\034\325)\3306\b}\240\rB\1775\007\013"
+	.ascii	"\204\212`\201\320t[ \364zfB\267QP\30061\316n\346\261P0\340a\322"
+	.ascii	"\220\321\243\314\222a\250(\345>\333\233\351\243\267\356\266\217"
+	.ascii	"\233\177+vK\366\3331\313\274\333U\356\335\264\367\256@\207\016"
+	.ascii	"\220I\335\315w[ t\003\373\203\3320\241[\261\337>\261`?(\025\026"
+	.ascii	"s\237\355\275y2\260\342\306vsj\177\3203-\020\252\355\017\372"
+	.ascii	"\343/?\246\373\263\21369\205W\240\351\317\3119(%\322j\330l\321"
+	.ascii	"<\346,\237\340\2770\376\013%\233\340\177\232\237\2701\376\301"
+	.ascii	"X\n\376+\226C\334\031w\356?\316\177\222\341\022\362\217>Y{Qx"
+	.ascii	"`\007\376{#\013\340V=\315\025\013\221M\234\270i'\361\243JVL\006"
+	.string	"^\247\226u\t\376\333]\024\376\334C\202\377\246\360_\026\376k\201\377\342\310-~\034\374o\210\314\342\267(\370o\003\376\033\201\377\226\370q\001\354\226\355a\277@\230\372\277\301*_\001<\342\277bn\332\337\236F\350H?\332\201$y\205\020\002Bw-\253\020\313!\2542+\341\006\374\367\360\243'x\363\220\201\243?\272\302\177\321\376\013\202\274\332\373[\373g\020\370\312\217\261\374\031\371\347\343o\211\374w\307o\271\362\br\322\217\267\374\230\313\237\215\277E\362\333\245Mb\267l\017\253\225?X\362\017r\021\251\350\277i\177V\377\354\201?s\300\226\375\204\377\334\372\037\370\347\020\376v\020*\360\r\327\f\363?\n\347\340?I\370\006%\247\372\343\256\037{\375Y\003\377\323\330\031\377\275\312\031\370\355\210\240\374\001\327\211\364\3331\367r\267\346~\310\030\300\036\240\024\300as\344\024,\300A\277\355a\233X\256\353\341\307;"
+	.string	"\370o\320\217up\226l\201;\343\2020\200?\333\\\201\234Q\370\340\317\023\370\263\211s\300*O\334\016A\177.\221I\374\031\0027\204G\340G\201r\0032\003~\334\346\307n\376\274"
+	.string	"\265\034BV\300\355:\335\345C\357\362\0079\001\367/#\340\2774\362\210\016\274\002\253\264K\376\237\370\333E\374'\232\034\302]\203\325\374\037s\274|\200\377oX\230G8\206\377\034\363_\261\034\342\307\020\310B\227\t\306\303d\376,\302O\374\355?\377\371\005\3777\n\204\237\270\316\177v\371m\3763\b01X\371\303\177\300?\207\360\337\242\377\376\310\027\3746\255 \023\340\317\037\210\271\206\377T\373\357_\366\240\315o\373\376\353\227;8\333\374\030\007\177l\302\177\273\377`\376\207\371_\367\177\356\277\227\377t\277\035\203^\235\340\317\002@\331\3749"
+	.string	"6\315\033\376s\340\301?\327\001\311\027d\013r\326\034o\004?N\372\177\341O5\370\355"
+	.ascii	"~\033\302o;\374x\307\177Sd\r\277\205\300o\021\360[\021\277M\300"
+	.ascii	"o\033\360\333\022\277e\300o%\360[\022~\253\200\337\222\370\257"
+	.ascii	"\366\333\022~\273\341\267#~\353\200\337F\300z\370\355\207\021"
+	.ascii	"~+\002\b\3777\374?q\217\374\357\340??\360\343\343\217Y\374x\305"
+	.ascii	"\217\225~\214\374\261\212\037\223\340\277]?\316\372\355\004~"
+	.ascii	"\f\202\037\033\177\234\364\337#\177\016\372\317\363\247\005\370"
+	.ascii	"s\005\177\006\372\363\317\237}\376\034\374\363\371\347\373c7"
+	.ascii	"?\366\373\361\232\037\223\371\261\335\217\303\374\230\356\307"
+	.ascii	"\\~\374\366c,?F\3731\331\217\275~\314\344\307\312\037g\375\330"
+	.ascii	"\306\217\253~<\365\343\247\037\273\370\361\t~\\\202\037\233\370"
+	.ascii	"\357\334\217K\370\361\003~\334\200\037"
+	.string	"/\340\307\t\370\361\210\037\213\370q\001~,\364c\020?\016\341\307\036~<\200\037{\360c\016~\254\301\2171\370\261\005?\016\3721"
+	.ascii	"~\234\341\307\030~\334\363\343\235\037\353\374\030\347\307\350"
+	.ascii	"\217\363\177\335\374\267\357\277k\376\313\367\337\275\377\352"
+	.ascii	"\375\327\314\177\307\374W\314\177\301\374\367\313\177\273\374"
+	.ascii	"w\313\177\343\376\373\366_\267\377^\371/\333\177\255\374\227"
+	.ascii	"\312\177\315\376;\366_\260\377~\375\267\353\277\\\377e\362_%"
+	.ascii	"\377=\376\367\310\177\201\374W\353\277\312\377\342\370\357\215"
+	.ascii	"\377f\340\377\335o\307\374\027\353\177\233\337n\375\227\306o"
+	.ascii	"\227\277U\376\026\375\357\214\337\336\370\357\325\3774\277E\341"
+	.ascii	"\267\025\374\326\304\377\n\374\267\352\277R\377\215\372m\331"
+	.ascii	"\177c\374w\375\257\321\177S\374w\350\277 \370\177\342\377\333"
+	.ascii	"\177?\360_\r\374\027\003\377\225\300\177C\374\367\303\177C\370"
+	.ascii	"/\001\376\333\341\267o~[\346\267d~\213\367\333\273\337r\375\226"
+	.ascii	"\311o\223\374\326\307o{\374V\353\2679~\233\365\333\026~k\201"
+	.ascii	"\337V\340\267\024\370\355\004~\253\377\243\360\333\364?\231\377"
+	.ascii	"+\374\307\373_\366\237\354\277\362\377\226\377\033\004\006\006"
+	.ascii	"\006\376=\017\370\177j\374\024\270@?\273n\233g\327M\013B\355"
+	.ascii	"]\025\2003mY\316\t\030S\n\027\327\251\304\356\2757\326^B#\"P"
+	.ascii	"\t\020\021\375\237L\232'\223\333<\241v2I\007O\350\260<\340\224"
+	.ascii	"-\263\274\335| \037z\271<\225T\265%\261\315S\311\2236f\r \253"
+	.ascii	"S\310)\344<\322\263\231\312\004\352m,,\016<XuB\272\030\371y$"
+	.ascii	"Xw\306\f\273\371j\316\"\301d\032\254\034g\221\223H\216\032Kh"
+	.ascii	"h;\206\220$Z\316!W\t\222\031H\324n~\0067\372?{\330\346\331\343"
+	.ascii	"\004r\265\266\246\333\002\323\333TX\036P;\2629\262\023\310\177"
+	.ascii	"\3728\177\344\273\313\245\316\212\313\315\350\234\375A\237!\214"
+	.ascii	"\376\311\303\342\275?\204\b\333\304{\026.h/\355m\020\226dz\270"
+	.ascii	"\265p\350\251\343\247\216S\371\236\2757\323\336:r\240YXT\034"
+	.ascii	"\376s\307O\245\027\250&\332\315W\363\346\377\240N\222\345\005"
+	.ascii	"\327\315\317\300\246O\034\032p\324\250`U\335\374\fO\364y\303"
+	.ascii	"\214\f\217.7?C\021}bY0\006\330v\3633\334\320'\r\036&S=\342n~"
+	.ascii	"\006)f\316\232\016\264\0317\237WKXR2n~\006\246\263*\250\274\001"
+	.ascii	"%y\363\177\376N\252S\252yJY\274 \324\336V\006\b\263\372\262"
+	.string	"\352\333TT\036\3763\206\231\001\313\211\324\315\377\031u\306h\363\346\215\353\346\023\206\225![Nn\376\217\026\375\007\247w\257\372\262\326\330\210\305\371\301-\367\336\201rqzo\270\340\364\336\254\261\313,qzm\236\254\235.N\246\363\351\204:\223\247\323\371\342\334g\223m\236K\031\360\371\\\312nR29XkPw\031\362\177\336\364\177\316\364\177\242\350\377\224\351\377\214\351\377\200\351\377x\351\377p\351\377,\321\377Y\352[/\233\361\236\323d\276\373d\267\023\225\n`\320\3646\325\f\017\377\311\241\237\311\3442\317y\317\313{z\357\275\304\334SAN\350\276\254\3726\026\026\207\024\206\230\215\034\031\315\363\336\315\\:\033SqYo\307J\207\f\275\254\227\317\230qK\262\271N[\277@\333Q\225\315\330\277\235/$H\\\334|\fd\364\177\373\373\243;I\265\367\266:\231\233\212I\007\375\355\355i-\207\377\202\3056"
+	.ascii	"\377\363\217\202\272wS\336\335\336\333\362\351%j\311\254\r\366"
+	.ascii	"9\267w\223\326\322\003\264\252\240\314\264\252|\240\232\264j"
+	.ascii	"@\231iU\371@\231i\355\245\246#K>T[k\t\312lo\237\275\367\336M"
+	.ascii	"MK$\224UPf\311\355\003e\266\253\266\013\272*\273\231ZK\273I\271"
+	.ascii	"}v\323Nn3e\325\006PMZUPf\311*\037(3\255\252m\246\265{vS\222\352"
+	.ascii	"E"
+	.string	"\323\246\362\331fZh\266\231\262\252\007\312LY\005e\246e\305\336\200\301\225eF\231;!p\366\013T\323\226\222\201#I\3253\007\305T\356\273\275\355\231\323\246\332s{\007`o\034J\252\273d\r\273\3064'\305T%\251\264\314\275\267\006\031L[\312\3354\267d\367\034\024\023\345\336L\230\214\266\214\275\3676\300\022sn\013\261sK=p\354(\247\275-\330\314\275e\354\275d\367\334\336{i\357\235R\341`\356}\243\007j)C\306\336XA26\216%6\247\275\357\031\336Z\025\224\331\226R\210M\212\331r?1\227,T\224r/\367\235\026\2256[\"\333Q{o\233F/\253\256\366n>\206$c\356\364h\204As\272E\271\341T\227\355\256\027\330\221-\312:\272\f&'L\227V\232+\272<\267#FJ\271u\3631$u\366r\234\244\321EM\256K\020,\306\017\032\231\213m\346.y\313C\210"
+	.ascii	"\313]\262\026!VH\230\364\355\315\f\352\220\323\f\342\246\205"
+	.ascii	"\234\357\263E\337'\213\376s\\\206\313o\276\302\2562\034\317\r"
+	.ascii	"\032F\336\262[\3322M\363\346\264\274\266\223\354\331\373H\316"
+	.ascii	"\222\261\330fv\313n\271-_\261sA\362\227\234\206\0169\255oK\013"
+	.ascii	"z\305\362\331\324\n\013Y\333\315\367i\323\267qU\360\3242[n\332"
+	.ascii	"f^\3733\232=c\243b\371v\316\275\225d\226y-[\261|;I\346\246\302"
+	.ascii	"1bEd\257\303Q\314\307\237\316\367a\242\357sD\337g\210\276\317"
+	.ascii	"\226F\317\246d*@\324\2740y\236\362\347&\231+K\271|M\226\2307"
+	.ascii	"G\321H\356^\300\335|\237\026\364\377<\226\241d\262\\\226\231"
+	.ascii	"\266\231\315\362\223g\260\034\366\306I \233\327\233e\027\340"
+	.ascii	"\327\325v\232zv\f\027n\262Y\026\273\232\235;\333.\310\b\200\306"
+	.ascii	"\nH_\337\336;H\007\r\2160r:\371=}\332*-\020\232\301\376\240\357"
+	.ascii	"\301\323\357\271\323\357\261\323\357\t\243\337C\247\361\234\005"
+	.ascii	"B\027`\177P{F\350\231\t^\313\342\344fIVr\032\321Z\302H\362\254"
+	.ascii	"\344A*\"Sgn\316K\241\347$<9\216,a\335\f\224\221\3301Z-9W%\037"
+	.ascii	"\341\363\221\244\371\304H\021\234%\036`\242<\027\371\177\252"
+	.ascii	"\0346,#\373\346?\023\311C\240\376~\030\271Y\310\016\220%\215"
+	.ascii	"'7\277\307\212\276\215\223*\"\367\342\311\031\214\257\245\020"
+	.ascii	"\324S\230rIm\303\275i\252\262L6\331\242\272\320bx-\235\354\232"
+	.ascii	"\275\"\003\3112c\345\026\262V\336\312\312|#\363\3104r\216\334"
+	.ascii	"#\373\310@\362\217\254#\357\3108r\220\\#\333\260\315\234\225"
+	.ascii	"\253\236\255\362U\323\305c\262kTA\226y\206]\233\312.\354\032"
+	.ascii	"\332r\357\235\263p\240]\333Yb\356\2514\206\222-\254\276\275w"
+	.ascii	"\356\001fw\205C~\317\223\266X\026\b\375\261?\350y\366\364y\344"
+	.ascii	"\364y\252\350\3630\365y\226\350\363l\351\363\\\351\3638\351\357"
+	.ascii	"\270\321\3371\243\277\263E\177\007M\177'L\177\347\210\376\216"
+	.ascii	"\016\375\235*\375\235&\375\013~\372\027\270\350\037\003\2769"
+	.ascii	"\267\334\340\221w\346\370\315\217\3650\032\354F\207,J\236\223"
+	.ascii	"\233\377\202n\330\022\224\232\233\177AM\367a>\314fJ\250\017\357"
+	.ascii	"\325I=\001v\371\3416\266\211\373p\232 f\207\016AZ\2116E\005e"
+	.ascii	"\203\327\004\335\344\200\321u\027\374\361C\314Vc\2734\247\266"
+	.ascii	"\220\233\177!M\377B\230\376\205#z\303\266@(f\232\021:>\223\016"
+	.ascii	"\341\021F\344\346\013\3620\231\324H\2213ze,]\376"
+	.string	"\302c\315\220\233\361\326\222A\\\334|\247\023\346\006\037\333\030;\0351Y{d7\277"
+	.string	"\330\016w\201\241\327\304Xd\340:L\207\3470\030,\006\177\301a\360\235mb;\034v,\207\275<\210\271w\023\356\362z\336\b'\252\240S\235\r!l\207\271\3048\303V\244|H\331\261/\374d\204\023U\360\251\016K\317\ro\031\341D\025\224r\021e\207\301\360\224\rLP;\271E"
+	.ascii	"64x|}{3o\337\332\233\022C\306L\013\204\216\260?\350/\310\320"
+	.ascii	"\327\t\214\303Z\340\322!c\236\264\224\211\2033r\203:\273\031"
+	.ascii	"\303],\036):\271\0317\343,)\022\035O\300n\276\032\013\367?xn"
+	.ascii	"\255)\2436\327\206\257\260]'8\224yV\332\330r\250\330\300xZ;f"
+	.ascii	"\263p\330\353\f\337\337\315W\203\325\376\007s\023\027 xjbZo\230"
+	.ascii	"\3120*\270J\232\031;(9!T\322\322%;\034I\264\3434\036g\0135j\244"
+	.ascii	"\335\214\205\245\344\360\005\266\345\335|\235\244\276m\342(f"
+	.ascii	"\330\212mF\027\331\261\031\024\235\275\301\326\230\252\001\344"
+	.ascii	"f\\\246\223\244\321\374r\363s\332\350\253\301\314\377\301\035"
+	.ascii	".wV~0\307\264\240\245y1Q\245\233\27357\377\267M,\206\303\230"
+	.ascii	";(_\211\302\305\353\346\347\210\321\317y\323?~r\261j\270\370"
+	.ascii	"\243r\363s\250\350\347\220i\021\234p\205p\305\310\017\314\245"
+	.ascii	"\206\326\335\250\362\243\t\023(\256\251}3f\202\227\3442\345\005"
+	.ascii	"\024\013\222+b7?\307\211\376\261\222$;ihpCn\306I~\f\004\007\301"
+	.ascii	"\313\253\305\222\31227#\t\312IR\004\306\335\315\317\331\322\267"
+	.ascii	"lD\256\266\023\334\033\256\315\362\b.b\233\330\b\036r\206\215"
+	.ascii	"`!W\333ib\356\"\350\231\245/\035}{\357\016A\035\322\267\252\036"
+	.ascii	"0\320|\034@}\034<}\234/:3\177phc\307\324\345\243\007\372\264"
+	.ascii	"\303\314K\217\253]\345\336U\364\0135o\374\266x<\311\262uv3\346"
+	.ascii	"q\261\022k\035\363\300;\036B\304u\2320\217\274w\322Z\016v\254"
+	.ascii	"\345\340t3\222\204\202\346\343l\321?\326\221c\256k\307\362f\f"
+	.ascii	"w\301\f\026\246\021\214\003g1"
+	.string	"\225^on\3761\026\276a\371\254uaF\206\337\315Wi\201\320\016\354\017\212k\b\035c\355TyEI\273\331\207\006\006L'\275\233o\343~;\266\005\357\215\234\334\362^\315qY\302\345-\261\264Y\356\315|3sg\341\252\260\305\3315;\207\265\200\2562\330\005~\201\253\356\032\034\003Sa+,u\333\340\026.\233\353\207g`(|u\377p\324u\203a\334@\354\204\231\360\024\336\027\360\276\301M\370\t/\335>\234\264M,\343\246\371\345\273j\300\350\264d9\303\026\006N\317\216\265\371\335+/]\314\230\031\023\361\337+\273\246\035c\263p\1776\357\027\312\273C\316\356\225\030+X\306Es\367v\360\336=\300\226W\316\210\215\261pT\342\352\324.\336/D&m)T\346\016A\323\333\233y\257\300\304\351\355\315\274W_\266\350\355\315\354rwE\213\205\333\301{\353 \263\024\322[\300W\230\036\226q\271<"
+	.ascii	"l\f\226q\335,\234\235\303\332\370\314\022\227\216\256\275"
+	.string	"\231'\030\2737a\036\220\357\234\005B\t`\177\320\343\200\351=\013\227.\t\224\332\273\3718\\\3728=\364q\254\364q\236\364\203v\372A+\372\301'\372w\026\b}p\207~\320J?\370\244\003c\226\214\334\254\247\356\246\224\242f\343f-\225s\003\310\025\225\233\265\214\273\375\241\215\205\271YGu\220\247\237\364\223~\021\244\\R\223\002F\331e\351\333\001\363\003F\f\ru\375\202\207\251I\021+V]yu6\310t\223n\322.\202\224Kh8\270\211\002\203C\327X\342\365\302E.\223%\320\315\315\357`\007\340\001u\322\226\355)\036#J\266\260\372\202\374\221\321I\275\264\345\310\024\275\244\367\2320\"6\2040S\266\263-Si`\256*k#\005\315\315\357\300\205\0337\251\237\355a2\325I-\367\306\342\260\201\262#{~}}\251_\220r\211\r\216\216(1\300\276%\262\031L\332<\365S\233\202\367\345\212"
+	.string	"\260\344==\223\227\256\301v\1779d1\310\276\354=]\363TM\b\021\317\353\342\262K\336\234\362}\007\253K\233\336\315O\323\340,\361a\346\344\346\207PF\243\252\352\346\024\r\223\274(47\247zw\323\301\022\323\007\304\214"
+	.string	"\254\334\335\245dP\253\250'k]c~ta)\336S2j\242\314\211\245c\004\260\303\316\016\205\222\201\355\312\327\232\013Zv8\251\271\371\002\220\n\023\346\034\013Rb12\236"
+	.string	"\325\314\241\235\361\223\223K\351\210,\365\2244\034Y_\236\322\361\224Eiiss:\227N\341y{1\366\346\346\324K\206+\263\242g\375P\271)7~vqq)\227\240'Iv\300Z\300qe\313S.f\320\232Y\306nN\265\244mNi\246\306\254e\311\222\276\331\262=\325\302\nH_\327\336X\034\354X\025'\275\364\r\213\bU\030\225SI\261\330\036&\023\030.K'u7\274\\y\212EMW\355x\362vs\252\226\266\301m5L\332R\2663M_\336\220\340\020\331\222\342\266\206\207\234K\037Ln7\247\315\253u\215\321zssj\345jd>\330\350nN\253\\\255IvG\344\007\024()\332\006'U_:t\304\350\345\211I\317\236\242\351@%\325\204\335\234\232\245S\266\320\306\320\230\222Ja\353\021$y\302\320q\223\265'&\215\222\0011\023\255\257\271"
+	.string	"\314x\362t\354IJ\226b\t\332LM[\207\220\237\277($X}\033\n\007\207\242\037;\2700\237\222qA\003\243\254i\245b\251\230\272-e7\247ag\326\025\031&`\177P'\b\027\271\275\233\317\201\234>\007o\\?W\352e\313\366\224\206\026\364\360\340\3221m\232\314.\333L\275\3248\201\251\335\234:\261p6\230/\364\256\326\244\351\225v\3639@\323z\372C+e\202\301X\346\306R.\241A\200\223(\"X\3726\024\026\207\235\030g\264|\030y\312\344\351\222\020\"\236W\374!E\312\315\251\222[!i\244@\335\374t\231&\371\203\301$e\252"
+	.string	"\336|\016\206\350\024I\b9\374x\270\271\371\351\221\377A\234 tF\232\334|\355\335\320\264\310\225\321\326$\307\315)\221\237\371\037\274P\205,\b\216\233\257&\035\362?\210\345\266\3000\335\234\002I\203\330\346\267\244B\316\344\331i{B\333r\3639\330\322\267\337\202\246\300~\013\232\366x\352\343\017\006\333t\370\320\272\371\034d\351?\335\372\203i\232]\326\362\346s@C\237\203\2514G\232#U\0367m\03560(\211\002\222\245oo,\0169Bj\\5\335\374\247;\236*\357\220\234%7\350x\334\234\352\310bfP\375\341\330@N\377iV\232u\323\254\354\260iRce\345\352\251\215+\364\017\245\002\301\246\302\367\306\256q\003W\343\346\264F\212E\243\205\031]\372O\253\322*\213\027\343|\221\005F\324\315\337"
+	.ascii	"G\372\342\351T\372\342\013\312\027N\232\022#mnNe\244RQ1`l\260"
+	.ascii	"\244\377\364)}:\201\230\320\263\367\226\226\364\206\031. d\002"
+	.ascii	"\237\272\bD\377P8\005\301\200\001\323\333T8<\350\330qe\311\273"
+	.ascii	"9eJ\233\322d\272\224n\r\262\274ysf\035\357\255\243\314\232\020"
+	.ascii	"\261\033N7_\0033*G\271\240]P9\333"
+	.string	"D\251\240\177BL;)\204"
+	.string	"O\312R\275\274%/7\373\335*i\320|\271\371\0328\321\267`^\320/d\350\320\271\rLP&\200\341\351\325\241b\354\\\220\007py\001\203\316\355,\371\354\335c\3142\r\332\006\355C\327\240|(\033\333D\325\240wG\273\240rMB\250\0324\f\252\006\035\203\242\261sX=\273\251y\006\007\206\326\\\216\235\354\345y\033\230\240L\020\313C\365\320=\333D\321\234\241hP<\364\214\235\303bn\253\034+`\376hh\350pa/\314]\026\232\177\364\fj\246\n\023H\232\233\321\274\024\253\306\026\0277_\203\032\372G\311\330&ZF\253\351b\373{\336\333\220-\271\233\257\301\f}\r\244\3645XB\355t\235^\016\271\233\237\301\237~\006l\3643\330\323\317"
+	.string	"O?\203:\375\243_\32093-|rs\027L\227(\246\233\237\301\027}\231\026\b\345`\177P\024\016\325\202n\371\203<_k?\250\334\374\f\342\364\321\270\377\301\n\f\361B\345\346l\357\206\242Y\216\276\375\301\273\005\311R\306\315\317"
+	.string	"\213>\212\005u\373\203;wG\320\310n~\006U\364\321+T\002\371l\334\214\266i\247\f\304@\300\311\321\334\221U\345h\333\217Z\271x(\033\t\002\337\260\271\031UC\327\216\262\241M\224\315"
+	.ascii	"\312\275\223(\033\217\233\275\223<\326r`-\007\371k\013I\032\232"
+	.ascii	"\237\201\227\276`\177P\353F\350h\225\034\271,zc7?\203-4J\023"
+	.ascii	"\215\202\242\3411\214ww\246\256\315\224\243g?*\345Z\3311'\225"
+	.ascii	"U\225\276\233C\b\035\235\322\205\205G\233\233w\354\017\372\f"
+	.ascii	"\254\312\312P(jR\2576\267\2700\0377\243P0\217$K\266\242\002\231"
+	.ascii	"L\013g\313\366\024\316\013&\2365\\9\210\334|\f\322\240b\250\330"
+	.ascii	"9\266\006e\303QK4~\334|\f\300P\2603\353IY\316\0315.27\037\203"
+	.ascii	"+__\347\330\006{o\247\315\202\317k\213\036\006g\372G\235\240"
+	.ascii	"G\320\256\f\247\227\252\366N\026A\331$1\370\322\307`\210\376"
+	.ascii	"\321&M\264\311\231\203G-Id\217\016\360\305\232\233\217\001\017"
+	.ascii	"\375\243Kl\023]\222\247\230\240\334V#\320\320\005\343\374\262"
+	.ascii	"\274\334|\f\222$\301=LP&\223\214\bc\022\323\327\227&\211&\353"
+	.ascii	"\346o\330\323?\212\3046Q$\027\213\2032\231\354\300\311\226\336"
+	.ascii	"\202\323\341\202\316\210\221s\354\356\275\3672\205sbD/\350e\346"
+	.ascii	"\327\345\215\b\221\005,\371[n,,\0169th\315\251\233\277\201L\243"
+	.ascii	"@P \250\220\340\336l\320\260\266\234\344\212\030\260 G\205\250"
+	.ascii	"\351\244\205\005\302\021A\267\320-\324\207\206?-\364\213\356"
+	.ascii	"\314\013\355q\324\307\337\232\264&\033l\350\037\345\301\343o"
+	.ascii	"\303\323\216\035cZk\364\321,\213\346\310a\375L\330I+\017\306"
+	.ascii	"\332\354\364\255\365C\177\364\306\r\334\203C\317n\"sf\351\246"
+	.ascii	"\177\024\013\305\302=\020\020FwA\024\0324\222\027p\351\037\235"
+	.ascii	"\321Dg`\256\\\266\227\024p\345kM\327\336X\036R-\032n\262n\376"
+	.ascii	"\005-XY\345\"\271\207\271\201\004\261s\3127\264\233oA\033\375"
+	.ascii	"\243T(\325\325r\0173\306\223\216\345\336X\036Zd\255\305\335|"
+	.ascii	"\013\304\350\037\225\222\312ELP\356\252\021i\366\200\364\361"
+	.ascii	"\230M\275\220\272\371\026TA\243\2420\217\240\275\204F\304\230"
+	.ascii	"\005\\(\024\n\205\302`\333\373\262\352\323\233\351\365\204\276"
+	.ascii	"8\ncJ\036X>\202\246\316K\220\233o\201R\377\250\023\352d\341\202"
+	.ascii	"\224K{\033\214])\241:\325\240\324P\003\330<\001\321\246+\002"
+	.ascii	"\\Q2\303\003\306\003\201\024\334\234\0314y\224\351?\003\321\235"
+	.ascii	"\325\302\024\332\315\350\222\320\321\344\0058 z7k`\177\320\035"
+	.ascii	"\253\301\313\351g\233\247\337\351\306J\0046t8<\340>%W\314\363"
+	.ascii	"O\007\213\241\001\003w\363\037\263\212\2141B\242n\276\206+g\337"
+	.ascii	"\331w\216i\310\241\202\234\232\327\315\327 \246\377s\315\032"
+	.ascii	"\2137\302\211\326]\003Lr\3635(\371\370\3161\2755\330h\2733\\"
+	.ascii	"\330\360q\3635\304\330\333\273\233\t;Y%B\230\326\366p\rI=\275"
+	.ascii	"s\214\001hC\364\276\030q\333q\363\203\330\234dN2\247\031\023"
+	.ascii	"\226\200\256\222H\2737\2473\357\247\231\273\201-\321\352n>\313"
+	.ascii	"\334"
+	.string	"m\213\334\326\216\273\265\300\366\244\313\315\017\272\323X\016{\261\315s\314i\003C)\367\025\2078\03684\304\024\211r\363\203\340\352\352N1\301M\325A`\333\227U\037\332\365\007\343\315\356\247\030\313w!o\006\217(a\376\007m\332\033\271\253\233\037\204\004\f\030\353g\2022i\325A\232$\220\276\035\034O2\376n~P\016/\347\027/\347\330\334\3349f7\325\232\364I\231Q\017\035`n~P\224~\005|]\272\2345r\331\256\312\231R\362e\325\2677\234\007\2357YMgn~\005`\266l\301P\202{k\tAk\224Y\321\377\031g\233g\034Nb\253\366N\202\2415\264\276\254\372\302\336\336p\217\023\352\204$b\313!nn\270\307\005\366\376\241\003\255\321VA\r}\314\303\236W\316+\230\007\336[\007\016\264\206\222\n\226\264\232\332\311\366\236\275\243l\355'\333\016\230\233^\033(\377\203B\267!}7\037"
+	.string	"e\364\177Zi\236Vp\016[\266\253p^\320\255a\322\003\n\312\223\233\017"
+	.string	".)'\025)g\032\272\267e*\247\2506\026\025\207)S\316\264\367$\257\366\320~\246\3711\321d\271\371<\273\333\377 \217\225\233\036\326\227\377\301\2343pWL7\037"
+	.string	"[\372"
+	.string	"x\241\377\223\3146O\262\323\354j\355 \330\023-z\233\212\312\203\331\177\226\235P\316\030wW\321\"u3\206m\201\320\253\264?\350\201\336\210\211\235ci\330\325\374\034\243cr$\355\346\003\351\351\377\004k\236`8\213\203r[m\320\344\013\036\337\005\2566\033Z7\037h\214\376\317\257\346\371u\316\270e{\t\347\314\027.\035}{cy\320MvI\251\233\017\024\247\0379E\342\360\030\\\213D|\243\017*\022q]\205\303\365H%\241\"\021\327\234$\244\241`\005\353\320x\224\342T\217P\fW%\024\202V\242\t>H\026\216j\nE*\211\241\361\250\204\361D\006\237\034\026P(*\022W\370\260\320A\006\265\2508TA=\032\016\251DF$\r\021\300\200\211\023%\220 \214"
+	.string	"\t\013\240 ,A\005\341\n&|n\364\001\t\325P$\"qn\364\001i\264\016\221\214\307\244\244\241\020i\034\302YU$\b\365\b\305\260\030\001\244\t\365\250\264\016\325\024=&zVb\321\304\020\361x\002Y\"\205\023Vb\321\304\317J,\232"
+	.string	"R\217\206C+\020\251j\322\n\030"
+	.string	"\320\342()\211\004\237\243\341\220\321:D\002\201\\\211(@(\025\213B`\241T$\036\205`\200\021\204#\214`\001bE\026\215Cg\212\265H<\036\241\031@ZQT$\036W$\b\225H\351h\250H\004qD*\201"
+	.ascii	"\300\321\221R\261h,\246\253P%\001\021\211\2560\036\215Vc1M1T"
+	.ascii	"\217r\213\244!$\025\t\275\321\207\026\020XU\td\350\271\300\202"
+	.ascii	"\026I\306\022\200\204\310$c\t>\353\215>\024%\201(J\032**\345"
+	.ascii	"\024S\334\023),J\322Y\205\305\242\244\263X\224\204U\022\020\221"
+	.ascii	"\031\211T\217DD\303\264E\222q(\037\327$L\244\026\213\210G\303"
+	.ascii	"\224HE*ed\372\243\260(\351\303\205\343\320h(\2678\256"
+	.string	"Hb\221\252\002P\017\022\311\002\222\210\241\250HD:\016s\220+\361\270\"\347G=B1<qA\204\017<z\270\016I\020\021\223\322\033}@\036\031\217k\3218$\034:\202\030\332@T\034\"!\031K\030:\006\211\214(\360\340\250E@,\210(\020\r\215'\370\224\320\2034\036\207\210(\254\310\341\t<=k\n\365\204!\222\312C\244\"\211GC\342J,\232\030\"\251;7\372p4\256F\244s5*\"\252p\001\t>k\n\365\004\"\242\021\251T$\256@\244&\r\215\220\026\024\207\307\023@%Z\034%%\r\201n\364aHx\0041\244\001r\035\256H\034\013"
+	.ascii	"!s,\240\036\2252\fa\200d\\\221J%"
+	.string	"\020\r\215G\031\220Jz%\026M q\212F\342:\244\036\211$xJ\034-\200\202Z$\"\035\325U%\342\240\"\021\327$\243\361\004\"b\n>=+\261h\002\211B\017\222\205\0259<\201\247\305\360H%q4\036\217\021(*\022E0\204AE\002\235 \"\021\2172\334\350\303\321\270\022\213F$\016\220E\303\243\022?\030D\370\260\036\207I\037\210T\243\212\243\252!'\205\316p\035\222\030:\242<\030\214'X(\221`\301\211\224\200\272\016\211\222\2240\264\030\036\217$ \251+\262\305\n\302\n\220E\342P\002\253RR\321\004\206U\210<\252GJ\021X\327!\320\272\252\302\234U\025\022\231`aD\221\256\260\026\325\343Qi\310g\r\321\342\"\205%\210\206J# \242\330\021\001\305\025BqC\240\270B\303\033bx\205X\334\020,\256P\213\213\341Ha\261\304\252\"U\025\212\222\200>D<\252E\265H\337"
+	.ascii	"#\2040\302\b\026\351G$@\204\004\210\200~D\002\204\204\0220\202"
+	.ascii	"\220\376\bBX\350\303\001\020 T\327\341Q\022\222\272\n\205\031"
+	.ascii	"Ta\321\360\250\204Z4D\262pT\221\210k\217*d\241\022\025M\250\302"
+	.ascii	"\243\322:\\\241\250H\\\321s\243\017 \214\304\n\216\206(\220\210"
+	.ascii	"E;*\221\021)\257\030\036\361\215>(!\021\217\216\214\307l4\264"
+	.ascii	"\022\223\316\025\303\026\030\251*\035\rU\240\353\215>\020\021"
+	.ascii	"\223\202\220\224V\300H\341p\035\222@\022Y\220@DL\272\220\202"
+	.ascii	"5aI\330\022v\275\321\007\016\033\220)\024W\030\211~T\021\030"
+	.ascii	"\217+2I)\207h8\244C\304s4D\021L:\016W\\8:2\0361\254\030\266\020"
+	.ascii	"\036\325\024>G\243\321Pq\2303,\032\221\352qg\250\250\022\207"
+	.ascii	"\220\3521\211\307ht\244&!U\225hH\2444D\352\024\211\303\"a\212"
+	.ascii	"\024Hdp-\252\304!b\212\024\252qH\250\022\021\217\212\204C\304"
+	.ascii	"\0259<R\215Gu\210\301\252\036)\0353R\210T\217\224T\320Q\217\224"
+	.ascii	"T`q\\\213J\306\022t\324u\250\202\021R=\246PU`q\274p\\S(\226\030"
+	.ascii	"\256C\022+\206*\020\rU\025\206\2169\3075\005\f\305\022H\245"
+	.string	"u\270\256p\\S\370)\226@\"\325!\3431\205\241c\317qMaU%0t\004Z\205\253V\221\210kQI\005\026G\237b\t$\013*\022\361\204\2124<\226\030:\362\f\327!\211\234\341:$\021TY\020\221\202\353\215>\034\325\365\210\230\002D\321\210\204d\034j\261\022\207\214G\252\n\215\024\036\325\225\210D<\241\305\321\270\016\251!\030\036\327\237\242\221\270\022\221\306$}d4B@x\336\350\003\213#\210\242\244\037\026G\234\244!\322\320\361<\252DD\025\306c\022\221\312\342x4$\036U\244\017\013\365(I\211D\212\243\241\021\216JD<\036U\025Fa\221\270\201\260H\351()\310gU\221\352\221\250HD!\\\207H!\222\322q\025\201\232\204\274@G=\032\016\341\254GUE\2218t$\"\"\235E\"\222\026\301\220j4\304b\210\244y\220GC\025E#q\035\036\031\223\216\352Z41t\254"
+	.string	"\251\252\307\"\225\204zTT$\001iX\202\212\244\024\030\210\216\214FH\365htB]\207*\210\353\020\t*\221\021\205#q\030T$\016\251H%\026\307\034\026J<\310\243\361xT\205*\322\360\230B8tD\002\021\221\310c\216\232\324b\365\321\220\"\205qU\032\312"
+	.ascii	"Id1\024\026)\241P\211*P\223Z\254BU\005q\035\252 \036U\242\rG"
+	.ascii	"\343:4L!4\256JCaQ\221h\264\032\215HH\341\3201he\241\022\025\211"
+	.ascii	"\032.\2547\372\260*%\255JF!\322\212$\020\310\243\252\202x$\332"
+	.ascii	"`\025\246\310\242\341\t#\021E\n\213\210)\212\306\022T\250$\220"
+	.ascii	"GJ)\034\325\265\250\226\320\243\256C\025\220V\250P\2110\0229"
+	.ascii	"LZa<\022b\020\022\251H\307aQIH<\256>\353q\270\"\205EE\242p\003"
+	.ascii	"\365\250\2508\024\256E%#R\n\242\021R\250\"\207FI\302\242\"1)"
+	.ascii	"ix\224\"\303\252\"S\2440\n\213\304\"\342\321(,*\022W`P\221C\024"
+	.ascii	"?\253p\004!a\221J\344\263\016%\t\213D$\025\302\fH$\341\221:4"
+	.ascii	"4\3349JB\032\nY\f\221\204?*\221\322J,\026\r\221\204I\303\243"
+	.ascii	"\024;AE\"\213!\222p\004\3521E\206!\241zDLa<&\t\217\352\232d4"
+	.ascii	"Z\211\305\243\361\202\025\311x,At\034\2568\032S`@\n\221\206\307"
+	.ascii	"a\n\2530D\001\326\"QI#\211T\344QU\241\036yV\341\bBk\221\230\252"
+	.ascii	"GDDD$t\275\321\0057&\251G\020\253\321x\004\221\303\302\210\002"
+	.ascii	"#\205G\225\005\021\005\235#\265X\034\032\225\260\252E\307\341"
+	.ascii	"zA\035:*\031WX\225\222\212\304\034u\035\036\263RJ\244\252I\310"
+	.ascii	"\263HD\302\253p\304Z$\242\027\022*a\003\026"
+	.string	"* \001=\364\001iTqT\221 V\243\"\342Q\n\020E\342\020\t\304\320\021\t\342\203\005,\206H\370\177\320\211.K\241s\362\n\272\b6\235K\234\374\326x\202\244\221\021ws``0\211F\001.\306<\001\366\005\223\301\245.F\320h\005\227\202\373lSRu\321:\270\314\364\335|\020\242\364\257\001S4\rD\211\234\2167\247\3312\357+\210\033\375\342\002\232\2575E\376t\225\315\232a\325\303/G\207\276\037emP\030g\263\316\257M\337\251d\247OK\335\0136'\033\340^\024607)5g\232\316\020%zq|)\026\262.\030mn\006\223jqiY\355)yhp\ts\005\r\206\302\245\314M\026\275\224\313\316\0232LH\316\340e\224\335%\353f=F\217\321y\307\220$\222C#J\f\260\314u\236\233S\031>\272\2335\031<\020\222Z\214\234\030\273\273\233\377\001\240\226\223\323uiB"
+	.string	"\213b\2035w]\027\006\017\210\233\226\233\365\027Mg\233w\323`\336\324|"
+	.ascii	"\247Y\354\275\367\335P\355\005C\241\0034\302\346\203\246\326"
+	.ascii	"\\4\227s\314F\362\003.\375\333\346\325\264\026\262\345\336\273"
+	.ascii	"G\007\217\317\312\331\315\377`\251\177\035\227z\335&\201\314"
+	.ascii	"(\270sF\036\330\222\276\233\333\332t\026>\001@\t|\002\274r\235"
+	.ascii	"E\273\251\350\321d\303Mc\321G\372h|]\030M\372\232|PC\377\232"
+	.ascii	"\315\372i43s1\326\3227\2613,.j:\231e\250\031\303\325\324.\356"
+	.ascii	"zx\305\270YS\261)\b\f\f\ft\263wRSAIhUA\231)\367Nj+\272\3125\225"
+	.ascii	"o\236\354e\245I\027\232\365\231F\273N\273N\273:\r\007\006\242"
+	.ascii	"a"
+	.ascii	"a\246\240Y\212\2243-'\206\325\032&}\037\270\320f\332,}\013Z\266"
+	.ascii	"\344\227U\227\007l4\223\251\313D\\\355\001\351#\273.\253\023"
+	.ascii	"rg\304\2561\205\304\340q\363=\240\323L&S\272\354\304R\262TJ_"
+	.ascii	"\323*,\365\303A\013DS\346\352#)\030\232\013'\314 \031!4\364\276"
+	.ascii	"N7\232\254KI\021\257\032:\254\314\262\272\3225sc\201B\2300\321"
+	.ascii	"\\\0354\355\355\264[\034\331\n\324kr\315\205\331d\201CC\262\246"
+	.ascii	"\177\275\344\034C\263\021dK\t\n\005\002{Q>\222\244d\356\224>"
+	.ascii	"\242n\336<;~`\246\330 9m\004abv\335\314\314LZ\256p\334\254\203"
+	.ascii	"\350 \272\210\245\242\332\013\200\017#O\200}\033k\006\207_\013"
+	.ascii	"\271.\242\211`\274\256'ZD\364\220\035q}\267\310Z\0265\017\314"
+	.ascii	"4\023lj\212\210\362\007\212V\245\317\311\322\007\332d]\344\335"
+	.ascii	"\370\352\221\225\365\343F\225\326\272\336\342\331\243\301#\353"
+	.ascii	"f\255\324<\234,\323\306\334|\333|\236\231%e\332\304n\326:\364"
+	.ascii	"\216 K\264+g\256G\325\307\244\017/\007\223T\352\311\337\017\034"
+	.ascii	"@\210 !\322\244\263\362^\034\224#Z\372F\252\274\272B\304M\333"
+	.ascii	"8\217P\201\202\006\313\3155j\234lT\366\3260I\262yc\272\371\036"
+	.ascii	"(\321-\350\026P(\026\310\324\023`\327\r@\272\233\357\201\f}\245"
+	.ascii	"\257\3161;E\352\t\360t\302\267c\255/F\f]e\313\366T\232%J\f\260"
+	.ascii	"\013\247\311\006\032\035T\327UwS\022\207\352\250\003\002\304"
+	.ascii	"jH\326b\020\223\f)dhdh\223\244\003\223\025@ H8\036\021\013\327"
+	.ascii	"\331\346\001\023\300C\314+\205q\242\006\231R\206h$\020\t\222"
+	.ascii	"\024$5\n\303\030W?t\312\002\"\b\022\205`\354\312\304\020E\332"
+	.ascii	"j\036D\341p\225~04 )q\375\214\215\367\026\303\334\304] _\254"
+	.ascii	"k\362A}^i\233\227g\350\222\270l\027\300\274\215J\373l\006\030"
+	.ascii	"8[u\254\360\236af\207\2762i\223\323\033\221,\330b1\222;\364\017"
+	.ascii	"\342o\256Q\261DuS(\030\213\374=\taQH\200y\254\300\t[\371\277"
+	.ascii	"\200j\304\334p\t\367\334t\346\007\224\242\2360\372E\2427He-("
+	.ascii	"\336$\254\267\323\322k\033.\027t\233\370z\235\031)\241\274\357"
+	.ascii	"\256\265$\350\261\241\331L\326%b\350\215T\024\031\245;\227\215"
+	.ascii	"\204Nz\224\236#\202!y\360\250\322_f7\200\225#\270\255\335\242"
+	.ascii	"\334\304\335!3\360\347\2367\004J\036q\217Q#a\f\253\240\nJ\332"
+	.ascii	"j{(D\257*ss\245\361&'\037\264\256\235\rL\035,u\247\006a\226\250"
+	.ascii	")\201\002\003\327\003[\233\312\b\334\210\277\002\274;N\263-("
+	.ascii	"\2047m(\271\261\3504a\314&\364p3\325\205\177F*\017\f\307\025"
+	.ascii	"\353{\342\274\222\234\303\376\241\365\351\324M\224\267\237;\323"
+	.ascii	"t\215>\221\310\177\321\035\022'Q;\247\223\371\"\353\216T~T1\005"
+	.ascii	"\201|^\2757\b\007\331\347Y\333\002\346\210\217. \314\323}\327"
+	.ascii	"w\354\215\275\244I\270\3372\253\237G\376\300*\300d\300\314\303"
+	.ascii	"\312\337\237)\310:\203LH\2571l{fh\273\361\006\324\370>pV\260"
+	.ascii	"Gcj!"
+	.string	"\224L_\327\2235M\271{\250>!\351\270\231\247\211~\022\002b\264\366\006\335Z\334\210Bw\220_\323\033\226k432\230M\205\3036\310[\013}\244\214%\301\n#\270\216\002p\370\fo+\361\013e\375\311\363\034\025\\T@\022\201m\222p\210\f\242\243^>zR\265\004\350l.(&[(\n\317&\317C\350\320\t\201\303\032U\331\342\007\313\210\\L\334+\245c\263u\300\220'C\363\341\306o'\247\302\312\177F\0034j\2228C\251\220(:\222\220\240\2513\276\0348\337\223\035\350\225S\202\271\202\373\001\240G\353>\341\227F\260LS<[\255+\212i\372\257\001\221r6\300\226\306\315\222C\326\316\237\321?\357q\255\301\344\206&\300\353\212=\023\341\230\241\264\020\\\266(\326v\036R\260n\036\022\"&\216{\274\222BSp\201\374\374\321[}\310Q\334\334\366\324\216b\252\343\322\276\223\312B\"."
+	.string	",C\342\213}%:\211\327.\3210\312\375E{\035B\201\216\374[\222\0214\304\351\371\rL\337I\036`zb\356\370\027\261\332*H\365\212\224\270\302\237H\242\030b\310wW\313\215\306\302Q%QuVzl\026S\030|.Ft\370\370N\327\277\206\217V3\313\251\3435Q\fFl\364\314\232\211\3169`\270\320\3202B\204\341\230\275:Y\327\367P\0253\3026\214\022\252\221\235\363\247\017?\377G#D\007\352\304_&\016\256\214\245\bLDh\305\325\005q\277#\307\255m\361\035|$\374\353\215\036\253\227\030\312\203\251"
+	.string	"\306\330{`Ky\325\314}\266\356b\317\371?\351\314\365)\220zi^\323\255|Z\305\021^\377\245\006\262\026(\303Q9X\277Z.\366\373\263\302\310\243\230\373\2465\303%\343&Jn6\323\237\252\006\233\307\023>9w\013\346\340\t@v\374\005\260\021\351iP\213\374\245\370,N\235\322e\205\222!\335\217}X\0354\242#;\333\311\215V\214\362~\3061\242#p\235\332\024\217\034lE\177\271\336\226\326e+\021\255\346\376\032\001|\316C\276\264\356\376\006\030h\371\200\005\340\2200\246/j\366U 3\320~I\017r\303\276\332\313\271\275\307\214!\252q\243\311\023G2\211\030\315\027\314S}\213\340\253\346jZ\202$\025\266\252\364\325G\3131\226\"\017\207\325\231\033[\371"
+	.ascii	"\354\367f\252\274\374\260\361z\025\327\350V\331\303<{\263\227"
+	.ascii	"\306\266\2137\341\301\210X\020\003\221\373!\360\026\203o\332"
+	.ascii	"\233\n@.\320U\r!)7\304\376\255\351\004\257\357\\\t\320\263\252"
+	.ascii	"\366\270\365P\321yhBO\037\004;\3055h\301\013%K\242\304\223|C"
+	.ascii	"\017F\373\003A\037R\025\2579\246\237c\211\240\353$\005\235"
+	.string	"\023\033\216\351j\250\366\027\352xi!\240\355\263\340\370'H\364\221j\270\031\227\375\336M\352\235H!V\366\356K<\320\225NB\\M\352\334\032\324\3129\326\366;\350\0363\352\373\326\033\037\345\343\326\372Q\362\331Ywf\035\241\353E\277\n\360:\262:\037gZK\326;\001\203,|\304\210\345y\003\037dT\021\016f*#o\026,\327\226\205\242\035\247\202\227\355\204\216\345C\360\323L\276\b\204\263\266+D\020a\357\\\3062\255#f\373\214\3440\005\376]\325\233\316\240\005pa\3012\371\276\212\200\3300\227\246\245\030\273\373n\377\002#\302\257[\212t8\t\300\371\246\232$\307)m]d7\2471\374\211\021>\271\241-\352\215\353\377E\355\326\277\256\260\366\336\356p\201/\265\207\207mis\tv\315\355\013/(\361\255\354\033\333\261f0N<\201,\251O\274\263%\034\306W\022\306\275\306\351\005\3071\211\311"
+	.string	"\177{\224\030wM#\206\222N&\024_I\3769\241\227\3304S\264J;\344\277q.\020\177\302\262\347&\200\325{\220;\205\326\004\336(\363l\rN3\tb/0Sm\305F\367\245jfU2v\205\277\214dk\243\330W\277\301bb\247\244\327\b\257#\243*]\324&\003\t\t\201\316\227\313\026\330\201\020\210\342\303}\206\001\324:\274\006[\304\013#!\337\360U\006\200{-1\305\216\2409\007"
+	.ascii	"\245(\345\220\\\242\313\301\365y\314"
+	.string	"\343\314[x\006\364 \263\316\374V\304\366\355\343k<\031]\004\206\227\336\247,&\325-k\244\bYI\324\251kN-\276\003\233M\366Q\246E\312^\242\236\352\"\351\241\243O\271c\235\332\240\301,+|\337C\233\2358q_,R*\013\273\035\005\265\312Y\2665\312\205\334\216\002\361\336\327\366z\250]\242\374\003\021\276V\3148\322\342}\264L \020\340\317y\223\300\006\\\247\243\241\017o/9S=\f\242\305\243!5\030&\236\204\277\361\201\345\347g\034B8\25121\0066\257\304f\314W\276\240\023\267\222\332.\344\035'\025\336\035M\320\2039O]Oc\233\n\251\236Q\254\364X\327\220.\365_\255\256"
+	.ascii	"\342\324\211\277\236\"\255.\2008\036\213\017\253\360\253\214"
+	.ascii	"K*\341{\276i\240\234\366\301\300\016i\007\237Z\340\337)\326\226"
+	.ascii	"(CR%\307\321l\003\215*L\237v\300\325\323\354\271h\201\326\021"
+	.ascii	"m~\356\325\025\033\223\353\240\314.Y\0228\234a~\253\3563\007"
+	.ascii	"\221\t\006PYR\301\220\361\0133U\314\322\374B\274B\037\306\214"
+	.ascii	"\320\307\031Pc\332\304C8"
+	.string	"R\235\245\204_\342\374\315\305\345\365\245{\347\231\225\303\335\300}\030\325\023\"\255\"\027\201U\n\317\335\374\240\325\312X\024T\260\327\344\211\211x\367\005\275\210\241\004\353\001\336d\003\333\2470%\223\244n\223\343+ \334\013.2\262\353\367\262\013\220\207\t\277\237f\370)\274\"\227\200\267B\377\225\004\034\233\003SA\177<\035\256+\351\221K\004\306\020\207\302\246\204\202N\256\202\335q(\301\346\323\206\021*\333\220\233N\177\266fU8\036\272\245\254_\342\217g\275'4\r\203\345%u\210V\362dfT\321\201\376\277=6\\\306r\240\341\013\315c\274\213\026\315\030uO\230r\346;r\274'\236wM?\007l\267\341\246\221J\333G3^\3369\253\204\221\352\300\020\\,\345\2650\200\300\347-\310XL\223\020\021dl\233\270\2108\317\263E\f_\340L/\352\"\004R-\307\246\201\221\271e\\\201\022\261v\322\304\375"
+	.string	"\333%\177\217[\256~\240`\341\345\245T\0211|\025\302=>`\203\222\035"
+	.string	"f\236\3447\312+w\223\nW\300p\232K\370\306F\\\030a\"9q\020\300HI\234\321U\237((ga\273Y\206-\306\273S\353\032\206\245X)\377jz\035\272'\200x\257\346s\325\273:ox=\220\265\223\030\277T\020\3503p\227\352\023\331\304 \266\035K\2247P\207b\241\361x\177-\237\254\326\235po^\213\330\003\353_|\017\311\256\252\206\220\017-\300\336_"
+	.ascii	"%\314.\273\367\320}\005\341g\335\364\266\316}u1\f\205\375\250"
+	.ascii	"6\001\3168\306\207\211\236M\264\333^\346B\273?k\013\200\314~"
+	.ascii	"\236\003\211$\024l\376\034\017ht\350oR8\\\364\210\001\203A\246"
+	.ascii	"\347\303\252C\216\007\233\342\242c\371\332\343Du8B\023!:\303"
+	.ascii	"\tcI\007\264a\357\377\272%\022z`$Q7\236\020i\217+\007\262\007"
+	.ascii	"gn&\375F\204v\216\025\2429\274G\314\324O%\267\263\3577\352\004"
+	.ascii	"\354Ys\321A}\"\025\222\227\300\261\343\205L#V\214\327\005L\341"
+	.ascii	"\232\266\032r\201C\3029\315#\310\020\203\024@\256\233\250JN\363"
+	.ascii	"\344\355\252Y\037\272\330\356\231H_V\236\247\352\335\234\027"
+	.ascii	"/>\255\311\214\347\017\001"
+	.string	"\223\321\357\f\343\246Q%6\301\321^\217\211N\266\337M\300\216~\355\241\275\367\235\346w\313-\225\341\210\"\371\245 \t\2262e\323\360\3732\020\271\267a(\274\277\221\222\250H\"\2140j\276\306\333\343\320a\362\240k\005\034\220\247\341\305j\002,6\247^K\322F\177v\211\235\016\317\033+\025$:\017_\233\206\273\027\036\340\220x\335\367\336\255\272U\027l\341O\252\033\346'\231;\340?\005J\201@4\b\341\320}\241rb\343\225\261\331%\321\313s\263\2351\n\225\347\016\361\210\016\022\344\207!\307\013\3573\037O\332\321\007\017\373\227\357{\274\360\r\001?Q\320\362~\366\242\373x\035\367\235\202\022\355\353\335#\n!\b\301P\303\205\332Vq\r\343\213V\030]\355\021\207\326\361i=H\\\212jR\311\211\246\202\016\035AtA\326\266\303S\030\333\005\2253\314\242\273\305\312\\x\321)Z\343&\235\210V\\ "
+	.ascii	"5\371V0\222\321\022n\277\275?\366XX\031\233\206\212\365\216\206"
+	.ascii	"\364\300\r\n\037\327ME\302\251}\255\255\275:\017,7\246\03528"
+	.ascii	"L\212g\021<\223\206\373\247=\257\266\300\211\306\177\253\303"
+	.ascii	"\247\3758z\230\017\264\001\243\311b\367\275\033\024,\201\344"
+	.ascii	"\r\242\222\322\275l3\317\354\013\3379\301\021\270\210J\211\307"
+	.ascii	"\304\272F\265\3644\314\201\361\t\2229\217\360\030\244\f\036\361"
+	.ascii	"\213b\026:\240e`\032(\311~Q\254L\232x\335B\342S\320O\020]1ko"
+	.ascii	"\377%\377\374K\213\207\005\020\030\325\024\371N\034^\360\245"
+	.ascii	"\225\355Y\353\235y\247f\007a!\364\305\374\247(\246\223s\363\212"
+	.ascii	"\360f\342\223\231\004\350s.4f\360\343@B\250\003\231\003\374?"
+	.ascii	"\002y4%p\2440\237\323X\003L\361M\276'\250\023\200G\367\306\034"
+	.ascii	"3\2104M\006\204\024\r\r"
+	.string	"\231\262Ue|\330{\327\"8`c\315\235qf\311\273\270\347\201\2048f\271\206\273\316NR\342\252\223[F\333/\374E\260j\367`2\243x6\360n\316\221[%\311\361\376\322c\\\304\231\201\300EJ\325\361\006\236\206\371\314,\371 \342\275X8+,\330F\367\007\276\343a\372\237\353\006\222\216\311\211\3031b2\322#C\227cE\341\317\023\340\237\017\374W\247S\037&D#`\270VF\372T\270\221\3257\360*\224B\262\231\006)\217e\322mf7\304qL\3365SMr\025#m\346\217\255\210\247|\307)\311A\231\220\232\372\310\235\314\327\267D={\341\033\033\273\323\231\017u\343/\001\246(\203\221L\\\324\250\262\326\226\351\304RI\345\236\257\001j\3044)\336l\rb\334Dz|\375\252\017q6\264\221vBl\233E(\361g\354M\267\267\023x^\333\316\237&\033\356\310r\351'S\026\277?Y"
+	.string	"\311\007\321\217\372Q`w\213\347\302\036\363x\204\272\222S2\220jh\367\007\006\214\002\023\321@\331q')\021\2118\364\322Uo\355VY\216\"\201\255\027N\356vp\354\354\261M\360\356uk\375>G\215\353\374\225\305c\250\342\316y\223r\2009G\3122b{\204\305\242\200\216;\202\342\242\366\361\020\346\037+\255\200|\370X\323\201b\217\205\265\246\262\240\031\3519\376\311\001\340\300]\316R"
+	.ascii	"M\325rJ\323\275$\255\341>\001w\306^2\356\350&2\254\335\3400\027"
+	.ascii	"1Wh\312\310N\261\201\334\321\\R&\356\320\034\317\374\354\021"
+	.ascii	"eT\027\327W<@\370\220\274\215\326\211\317\247\230w\210\034\007"
+	.ascii	"\377\252\243/\264D\360\270\314\214\236AH)\376\270\037\302\006"
+	.ascii	"\333D\373\024\334t\"]\227\274\254\023\366\370\354\313\313\036"
+	.ascii	"\004\223\353\214O\036\310\302NS\241\275\003\216\300\\\363@\355"
+	.ascii	"\351\301\310\007}\232g*\250\233\200o\200\330\021\342i\367\201"
+	.ascii	"\027{\254\274\223c\330r\036\344\322\034O\177\366\001\345\366"
+	.ascii	"\374\373\365\212\270\274\366h\256F^\376\346\333\365\357\027\271"
+	.ascii	":\330\272\n_L#D\315\301j\357\215_4\271\003\346\2639IOd\351|\224"
+	.ascii	"\3769C[\366\2340\376\257\304\266\327\357/\352\177\030{f"
+	.string	"R\263\207\203\361\211\361}+u]\335b\317o$\370W\251\255K\362\246\313A\212\322\0039:\315o\341\215\234\013.\307\346\300\036\006_%\377\375\357\217\360\257\273\377<\331%\250+\234dk\020j:9\347\013r\376<\370\2077\316\315_\031\325cpbs\030\337\254\314\241\246\346\225\335[%\0379(\270\036\351=\273\032\370\315\312`\271P_\024\241=m.\313\243\216\351\362\227\004\017\354\275\020\221q\022\370\342U9\246\306i\346O\030\033\031\321\232\256= M\243\342\035\367NO\2049\2335O\242\220\371~/d\374\037=/\257k\003\026\332\330\333\320\306W\210Xp\347\026\344A\241{\301\331\310\376\241\352[:\217;\336E\216=F"
+	.ascii	"w\0242\256\035\324\346\206\206W\255\3115W`\037\245\343\270\003"
+	.ascii	"^\350=\203j\031\207\216\241}\335\266\375j\0363\361\360?\363O"
+	.ascii	"[\f:\022\270\353pyW\344c(\323\013\372\364\"\266\377\251xE\357"
+	.ascii	"\211\036\261L\344\005\357\256@\277g\372\350\250\023\030,\337"
+	.ascii	"+c\223\362\333\357L(\323\200\246\326j08\266\234\3643\247\263"
+	.ascii	"\324\355~\230\372\352\330\377/\374\007d\017\304\365\237!\266"
+	.ascii	"\023\234\260/\315?\347L\303\241\263\017\255\356*\3113&\330@\325"
+	.ascii	"\326\215m\350~!\303L(\215?\013\370\3322\025\333s\310\361s\363"
+	.ascii	"7\266\201`\366\306\246s\274w\237\343\377\326\275V>Az\207\274"
+	.ascii	"\356\340\272\264\357W\231G\034\367\025Fw\360\347<\316\266\275"
+	.ascii	"\357\353Q\372\303\265\356\222\205\335\334g\273\233\217\3240\336"
+	.ascii	"\315mw\317\244\33714\3143\030\327\2570\374\370w\036\232\304\321"
+	.ascii	"m\337BX<\255\366\323\352N><\203\302\265z\226\200\350\355\232"
+	.ascii	"\2578n\243>\227\247\343\360\\@\375\2110\377\363\275\007[\370"
+	.ascii	"[>3\343r\263+\376\357\220y$w\214f\364\217\371\005\317\256\200"
+	.ascii	"\033\242\232\003V\376\365\2361\3407\342}U`\275\347\326\rt\350"
+	.ascii	"\006Z\346\213}\322Z\237\333.\365\215\001\021>ZO\327\321\262\310"
+	.ascii	"}\343\026\276\232\332\322\202rM\026\215\017\203\2761\263\302"
+	.ascii	"/#\306p\352f\201<t\005"
+	.text
+	.section	.gnu.lto_.symtab.26ddd8d703b65655,"e",@progbits
+	.string	"servoParams_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"pgResetFn_servoConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"pgResetFn_servoParams"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"servo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"determineServoMiddleOrForwardFromChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"servoDirection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"applyFlappingToServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"getServoTrackingError"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"getServoTrackingDelay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"servoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"gimbalConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"gimbalConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.string	"gimbalConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\003"
+	.string	""
+	.string	"servoParams_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"customServoMixers_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\003"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"servoConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.string	"servoConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"wingSaturationFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"currentMixerMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"shapedFlappingSinusoidLeft"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"flappingAmplitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"shapedFlappingSinusoidRight"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\003"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\003"
+	.string	""
+	.string	"trajectoryLimiterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\003"
+	.string	""
+	.string	"getServoSpeedScale"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\003"
+	.string	""
+	.string	"trajectoryLimiterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\003"
+	.string	""
+	.string	"servosTricopterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\003"
+	.string	""
+	.string	"mixerIsTricopter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\003"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"currentOrnithopterProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\004"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\004"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\004"
+	.string	""
+	.string	"servosTricopterMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\004"
+	.string	""
+	.string	"servosTricopterIsEnabledServoUnarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\004"
+	.string	""
+	.string	"wingMonitorUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.26ddd8d703b65655,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,291 @@
+	.file	"servos_tricopter.c"
+	.section	.gnu.lto_.profile.8f8fe7df371a4972,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8f8fe7df371a4972,"e",@progbits
+	.string	"(\265/\375 '\035\001"
+	.string	"\350\033"
+	.string	"\003"
+	.string	"\242\316\326\257\007\002\002"
+	.string	"\002\001\002\262\374\202\245\005"
+	.string	"\003\274\205\242\255\006"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.8f8fe7df371a4972,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\003"
+	.string	""
+	.string	"\003\002"
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.8f8fe7df371a4972,"e",@progbits
+	.string	"(\265/\375 \200E\002"
+	.string	"\024\003t"
+	.string	"\003"
+	.string	""
+	.string	"\005\200\200\200\200\002e\001"
+	.string	""
+	.string	"\002\004d"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\003f\001"
+	.string	"\201\200\200\200~\001\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"M\005\320\025v\216\302\362\022\203\347=,C\270\334\272\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8f8fe7df371a4972,"e",@progbits
+	.string	"(\265/\375 \030\245"
+	.string	""
+	.string	"p\f"
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.8f8fe7df371a4972,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\204\004\002\230\004\003\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8f8fe7df371a4972,"e",@progbits
+	.string	"(\265/\375 &\275"
+	.string	""
+	.string	"X\032"
+	.string	"\002"
+	.string	"\001\002\002\001"
+	.string	"\002"
+	.string	"\004"
+	.ascii	"<K\200\320 \340\r`\001"
+	.text
+	.section	.gnu.lto_.lto.8f8fe7df371a4972,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servosTricopterIsEnabledServoUnarmed.29.8f8fe7df371a4972,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"m\007"
+	.string	"BN46@o\323\001\230\016\004\267&\203E\002\335(F\034\247"
+	.string	"\025"
+	.string	",\250\275\031Hh\274_\271\261\361\020\256\332\030\3161L\314\201\300\210\340P:\254\215\361\374\326\232\224)\005\256:\321\322<XuEm!\303*\242\225A\355\301\341\202h\200\022\027C\004\254b\006;\034c\036+B\r\303\"\334|\334\247\325\221*\001\247\235\375\001\314U\365\241\224\316\023'\311"
+	.string	"v1\022\374\221\223(|\220S\266\370\344\275S\376\007s\352\252!qY\262\277.\265\303\376\264:\262\235\326L\177\322\230\004\250\354j\224^\226\205B\t\261\r\26276@"
+	.string	"y\023\310\320\226\223P\211\313\356\007\325\343\333s\363/\362\002\216\025Ot\361\314(\354\256\323\023m\334z\333\034\333\007\266?\002\t"
+	.ascii	"2\241Y\037x\301D\360SA\273&\372Ed$D\036w\243\323N2"
+	.text
+	.section	.gnu.lto_servosTricopterMixer.30.8f8fe7df371a4972,"e",@progbits
+	.string	"(\265/\375 \331\365\005"
+	.string	"\342J)1p\307\351\220,tB_\313\275 \360\016\355\035\301,\345\023i\206E\210\320\346\240\334\027t?\263\370\215fU\r\212\363\235\307\372\241\372\326\243\311\227[\246\247&Z\325kR\026\255\022ljh\205\311j\251X\027\212\314X\023\214\244(&\247\307\347UQY\347\244R\372z\331\213\f@\017o\347\370s:q\2713\n\300\215\265\377\323\"\013\374{h\366~\226\002\026aw(lh0R \370\277\322\263\177\241\361Q$\200\020\030\272[\362\300f\033\263\357\036l\202\353\264\215\210Hw?r\035\300\236\367\277\343?\344\377&\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_servosTricopterInit.31.8f8fe7df371a4972,"e",@progbits
+	.string	"(\265/\375 \306]\005"
+	.string	"\262\211$+pm:\240{\263\017-\302\try\270F]\0306 \324\304\213\265/\350\300\202?\235\243\252\3522\026\274\\\030\003P\204\350\357-S\277,\212Um^\031\255\214mV(\266q\215@2\311\203)Yc\302\027\335\330J|j\030\345:'\345*\354\225\340\301\"/\177\330E\311\371\027\320\022\374cE*\224\2725)T\217\002!\317\377\255\316\375&\003\206 \312\200N\335\315\262\263\334F\356\273\237\035x_\267Q\260\350\356G\357\333\354\345\376G\374W\374w\004\b"
+	.ascii	"3\003\316\231\001\340\313]\303W!\364\313\270\341r,\332I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8f8fe7df371a4972,"e",@progbits
+	.string	"(\265/\375 z\215\002"
+	.string	"\344\003v"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\035\177\003\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005 \004 \036\177\005\002\037\177\006\001!\177\007\377\037"
+	.string	""
+	.string	"\200\200\200\003\002\004\200\200\200\200\004\001$"
+	.string	"\006"
+	.ascii	"U\204Z\3412\\\366\264\2423\240\021\301\252'"
+	.text
+	.section	.gnu.lto_.refs.8f8fe7df371a4972,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8f8fe7df371a4972,"e",@progbits
+	.string	"(\265/\375`8\013\305<"
+	.ascii	"\032j\200\027DP\346Q\007kwW+\370t\251j\024\022\022`\263\376\353"
+	.ascii	"+\360\243\006\353$ss,\237\214d\336\002\301\377E\267f\0323>`\267"
+	.ascii	"\036F\301\211\322\323\211\220\bX\244\335\210y4\023Z\334\367*"
+	.ascii	"!{\313\224\002K\001h\001c\001l; \377#\343\377\354\271\324\362"
+	.ascii	"\312\254\037\326\313\r\211Xf{\235k\235\217\257\275O\003\2653"
+	.ascii	"l\231\035zk{]k{\345\322\366\n\245\355U\254%Z\207\264\275\352"
+	.ascii	"h;\317\265]\227\321\264\235\273\264\355q\272\035\316\323\374"
+	.ascii	"M\306?\365\377\017\264N\324\344\302d\326\341\370\332\345\220"
+	.ascii	"z\315g\374g\037\302\216`\311\354\232\305Z\326\221z\356\306\337"
+	.ascii	"8\231\222W\237\200\303)\271\240JZ\033\177\347J\275\316>\332\256"
+	.ascii	"\252\3615NF\301\331\264\243\361\265\346%\343\217sX!4\262\314"
+	.ascii	"v\336\321\266S\350\255wwN\241\327^\327fG\352\031\321\305\265"
+	.ascii	"\355f\332\366\2705z\322*=\333%W\266L\3036\203'\365\332E\013\345"
+	.ascii	"I=\217\275\213\2231pjk\350\320+\322\313\217\375\307\004\006\330"
+	.ascii	"]\261\033\224\331N\341\245gH\277C/h\333\031\364\374\316\031\364"
+	.ascii	":\267KZ\272=\213\2171X\231Z\321?\373\217\217\b\304^[G2\333\261"
+	.ascii	"'\365ZG\352\265wg\025\335\376\240\251;\233\350v\243n\257\300"
+	.ascii	"\324\335\013\024d\020\335N\241\333%t;\204n_\352\366\006\335\236"
+	.ascii	"\324\355H\335=\326\335mw\267\351n\366\356\356\356\256\273\263"
+	.ascii	"\272\327\007\335-W^E\036\201\276\026\216\377\004[\377H\377\352"
+	.ascii	"\377#\377\177\250\t\215\377\205\0301\247[[\377O\245\255\207\""
+	.ascii	"\331p\374\3473:kN&\025,\352c\373B\235~\216\030\351\323\237\223"
+	.ascii	"6[*\262\313k\375\277\363i\247N\037{2\233\201\f\r!\343\026\247"
+	.ascii	"\346Gff\"F\344\3402\333\035\310\204\231\212\031\243\346\253\203"
+	.ascii	"\205\256\315\315\337\316\246sZ\306\270\270\231n(\003&M\316\026"
+	.ascii	"\272\266n\237\235+ijj\326\330\322\2723W\276\221\221\031G\336"
+	.ascii	"\221{d\035\331G\336\3129r3+\263V\356\312\313\354\314<r\322\311"
+	.ascii	"2\323\355\332\357\362\233\311LOS\206F\007&\314\232/f^V\2044z"
+	.ascii	"\245\234\333tN\267\217\216\227\255\361t\310\fI\226\261n?\223"
+	.ascii	"\231\036\347q\326x\332\232\335\340\262!3\035\217\027"
+	.string	"Z\3435\025eV\350\316\272}K\267\206\016\231\351h^\346\325\347#\365ph\023\215\253kRj\022P\205\312\327\330\0046\257yR\257\211\025k\t)\271\237\260'v\231m\226H\333\033\350\332\034fjt\377q{Z\267/\220\357q@k<\005\220C\311\030\272\377\027\344u>\310\311<\220\353i\277\343m\235\343\377\345\377\267\257u\373\332\003y\036o\263\306k\277T\306m0\2633\302V\367\03775)5\361\232D\344\334\264\001l+Q\222\301\334\313w\321\230\306\325Y\371\1772\255S\002\335\321z\"A\262\376\027i3\375'\224\251(\t\2174ef\273\267\224J3X\213V%\340\346\006E\016\254\361\360\340\244\210\201\311\023m'\313\321\354\305\024\375\036Pn\315\247\005\"\351\232$\234\3146\257\255\355\374\225\237\235\203\220\345 \271\310\211\370\273\234I\263N[\335?\237L\031\216\225\267=~:\027\201\022\375\002"
+	.string	"O\242\200ie6Cs\036\222\211t\206f!D\313\fe\377\223\356\016\212\334\035\360\3164I\222\365\330\346M\333\346\361h\273sw\357\223\315\377\357\301\213\277\251$\3529\317\007\370\352\017~\355NP\342\0379f\256O\033eLrHf\273{\351\233W\375_J\221!\244\316\245\364\213I\225>r)\206<j\276\024\311\244\376\037\375r\211$\021\375#&\365\235\177\003\316\351\037K\221\277\214\376\321/?\271\304\\J\235Lj\322y\304\244J\235O\225\276\321/\223M\035\313o\036=U\252\347\251Q\247\021\223\032u2\251\322 \316\206)\007\215S\314\034\030\324\337\230\313\347\332\202&\233FUf\034\375\271\177?\303\361\315\007\377\320hs.\371\345k\312*\2272-\031\365\370\377\021l)\301\242\277\2542\245D\377\245(\253~\213\0032\256>\223\3067\013\270\""
+	.string	"\f\034\242@2\276Y\300\025\006\204/|\254\361\242@K\b\022\211\"\\^\214\027Rop\306oX\342\210\002\3061BG\001\215\357\360\245j\233\303\323\205'\250\254\241\206\362\220\301C\206^Cy\360\371<<\371\332~\362\255pWaP0"
+	.string	"\356*\f\260U\021\266\"\272B\254\242\323\321\370^\001\215RKM,\276F'\230H4:\t\200\335\241#\325\017\006\021\330;\272T\300\251!q\304\325K\342\030\264ja|\341\341;\302\350\205\177.\204X-\210\256^\251\365x\374\025\261\210A\267\200+\365\n\215\277\241\225\0134\302G\260\361\007\037\245\214?,#q\312]z\203T\303\237\013\017\255\210\302)`\325\261\252X4"
+	.ascii	"\277\307\251)\242;\004R\001\215D\227j\b\304"
+	.string	"*\320{\217\277\031H\260\373\344k\217.\325+u\004G\025\335!Px\345J\275o\361h\340(t\203oT\324\257(X\024\376\\\244W\312\n\006\016\251~B\267\370\013N\025)\r\201Y?\241K\3435N\031\b\276\303\341\257*J\001\354B\301C\240\325P\373|#\226b\2600\321Fa\210\002\032a\367H\2742\276G'\270\212\n\030\234r\032\002\177B\247(\343\321\tC\204\254Wj\bt\337 p\212h,\272\306\027.\022\253`\340\320HD\020\006\306\242\005Y\002F\215\211\272\272\302\242\231\211W\357J\217\352W\016\200\320\250q@\206\2202fdDFdf\222\244\003\200\002\221\251+\352\022`\2459\255I\031\221$\205L\373o\220\021,t\307\316\356\036\242=\235\340\204\2764\217\032\3073}A\344`;5\372\322\b\252\241=\357-l\365\204\356\350\270\275)\314\241/\203\t\325[\031\013\002\n\201\202-"
+	.string	"t\305\205\254\016S\266_?\024\347~!b\345/9\030\342\270\3211\215ne\347S\312U\t\3058\2604\234\320\350x\355\330\324{\244Dn(\367\375\225d\\T3\200\211\023e(\375\016\205g&S\362\370\343\\c\361\257\335\371\313\310\315dk \"\355i(,\214@\366\277p\335\021\005\325\202\350\335\270\340\257\001\021\330%\207I@z\021W&\206\303tw4=\201\276q\252\235\345\336Lp%\224Y\260\361\376sV-\245\324\272\274\261\340S\235E\rV\260\301\235\363\303\200\250b|%\261\310H\216x\\\177~\224\023("
+	.ascii	"\330\331\361\244\3573\207nu\by\004\342\\\234\322J6*\206\367@"
+	.ascii	"E\372\356\264\233\314\200)\252*\362\336D\202\301\251\266\266"
+	.ascii	"\337+J\343\363+\276\301\275;\347N\237\240\376\306\007Z\200\206"
+	.ascii	"7\230k\300\275\257\037\363\t\251\013\300MG\354\025\004\240\b"
+	.ascii	"2\211}\311\210\243L\354\025\371\021]\224\240\033\202\366mk\345"
+	.ascii	"\001_P\3629\"\270\023\203\031\005c\312,{%\316\234v-\267\002\251"
+	.ascii	"a|\320\322E\2115\002\236\302WR\344N\001\2207Ok\333@\273\243z"
+	.ascii	"\366\002\035\246P\340{\"\034\346G \t\031t\242\334\376\fl_\257"
+	.ascii	"\026K\363P\n_$\241\006"
+	.text
+	.section	.gnu.lto_.symtab.8f8fe7df371a4972,"e",@progbits
+	.string	"servosTricopterIsEnabledServoUnarmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"servosTricopterMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"servosTricopterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"servoMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8f8fe7df371a4972,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,487 @@
+	.file	"wing_monitor.c"
+	.section	.gnu.lto_.profile.3bb4512efa2038a0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3bb4512efa2038a0,"e",@progbits
+	.string	"(\265/\375 \317\275\004"
+	.string	"\022\207\032%\220+\215\001\353\004\300ql\337\322\247|\030m\fn\233\002\016vwwww\307\264\226\033\021)\307\217\344N[\006\270\357\272\356\273\256o^\016\214K4\364\"\020\207c\321C3\241\004\273NC!\201V\232\252\267\253\345ya%\020\231\205\266\366\247V\f\234\352I\366JS\365\326s"
+	.string	"p\316~\034_\343\204\201\205\332`\320!%\022"
+	.ascii	")\223\352\260\210}\b\230\250\370W`od\031\303\200\225\002_\205"
+	.ascii	"\023ulg\0234\001rS\316\354\264\001\006\330\265\001\2036"
+	.text
+	.section	.gnu.lto_.ipa_sra.3bb4512efa2038a0,"e",@progbits
+	.string	"(\265/\375 O]\001"
+	.string	"\250C"
+	.string	"\007"
+	.string	""
+	.string	"\001"
+	.string	"\001\007\001\001\t"
+	.string	"\001\013\f\002\003\r\016"
+	.string	"\t"
+	.ascii	"`\013\227E`\301\247\305\334\004\234a\250\f\246\031\370\006\260"
+	.text
+	.section	.gnu.lto_.inline.3bb4512efa2038a0,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"-\006"
+	.string	"BK%/`K\223\016\225\n/-\234\325\230\341\212\203\356\206)\227\211u\211\022\025\207m\235\030!\b\302\b"
+	.string	"F\004&\374\357\337\2675\373\337+K\344N\001\377\367\032T\"\323\242y\252XfE\245\177T#2)&G\240\377\307\362\364\276~\005mx\b\332?\251- \"e\247\231\272\201\001\201\003\375\233\232B\202\303\004\300\220\377\345\250e\346E\245\036djH\234\336\367Ie\310\314xf\376\376\366C\313\177oTDD\307W\r\313\254K\240\177U{\310\254+\340\231\017!\021"
+	.string	"\222\004T-\372n\210(\221"
+	.ascii	"\367\031\261\031\232\324\264\367E\206\304p\320\024\257\2049M"
+	.ascii	"\331}\301\n\211\352xZ\235\005=\203)\200\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3bb4512efa2038a0,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"e\004"
+	.string	"\202\006\025\035\2405\351\377\300\315?"
+	.string	""
+	.string	"1z\033'0\004`q\342\361\315\0321\322bgBd\222\0014z\005\242R\357\350%\337\003\241\003\364\330\206\031\245\f\252\364\030\027\327\205'\234$\"E\352\235'\226e\036\254\344\201{7\366\215u2E\213\2435U\217\221$\270 \027"
+	.ascii	"`\b\227M\320\016\b\f\230h\243\220\2331\006\200\003\232eED\251"
+	.ascii	"\001le\270\r\"M\034f\242\305KH\n\3566\341\206Jc \214\346\225"
+	.ascii	"\330IH\001\334"
+	.text
+	.section	.gnu.lto_.pureconst.3bb4512efa2038a0,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\007\230\004\t\230\004\013\230\004\f\204\004\r\204\004"
+	.ascii	"\016\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3bb4512efa2038a0,"e",@progbits
+	.string	"(\265/\375 \204\r\003"
+	.string	"\004\004r"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\004\013"
+	.string	"\001\002\022\001"
+	.string	""
+	.string	"\260\300\201\206\030\f\002\300\007\300\007"
+	.string	""
+	.string	"\001"
+	.string	"\r"
+	.string	"\001\002\023"
+	.string	"\001\002\024\016\002\370\007\370\002\002\f"
+	.string	"\001  \002\013"
+	.string	"\001\001"
+	.string	""
+	.string	"\0051cO3"
+	.string	"\r"
+	.ascii	"0\007\340\034\020s\356.\nf\200]\320G\r\235s\360\230\211\377\264"
+	.ascii	"\265\263\001\332\300@\021"
+	.text
+	.section	.gnu.lto_.lto.3bb4512efa2038a0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_wingSaturationHitAllPairs.29.3bb4512efa2038a0,"e",@progbits
+	.string	"(\265/\375`\276\001\025\020"
+	.string	"f\336jF\360\260(\035\362\217\231\217z\343\304E)\315*Z\265\244=k\203\332\254\331\233\333\267\365\345\373\364\350\346\332x\266\204\352\276\276(F\333\317\356v?\262\211\254M\260G\226! "
+	.string	"\253\017\234\033N\370\r\211%{\313\235RV"
+	.string	"R"
+	.string	"Z"
+	.string	">\300}\022\270\310\366)\037\262}\232d\323\b\360\362\321\342\004\313\261\273\236\202\260\274l\3352\222>\245F\222\217\363\270\201\005*e\341S~\314h8"
+	.ascii	"H\275H\004\253\330\f&e\212rFu\375\353QVC\245T\217\237\005\273"
+	.ascii	"\353\210Ji\270\267\333\016m;\260\377\"\234\214\376h\3646\177"
+	.ascii	"\363\313\273\356\203@>\210\340\330\315P\353Y\236\271#s\327o\337"
+	.ascii	"/q\230\313MX\300\b\022\273\373\226\3772\310.\313"
+	.string	"\344\3460\250qQcwG>\235\200\373\264]l\320\347A\266\037\355\327\334\206\364\233\n\356v=\310\320\331m\031\b1Nt\3504\006\016\b\241\342(\033\234n\332\3618\251>\312\251\343\251\207T\222\177T\302\300\320c\2125Sx\n\220\333]\005>\212\347H\360E|\232\245%\036\365\351\267l\237\233\036\366\020\327\214\0356;\245X\323Ul6\243\032c\267LQY3\232\225\216\225ekt\247\321\001N\t?\223\0259\372B\237\312\364II\b\216>\021\030z\200\"\372&x\243\024\224O%\202'\372LB\336I\310\342\225\0240\270\002!\364F \030z\240V\351\312\362q\336@\306SR\323\324\030w4\235\252\2648\362+\214e\333\3657^\264\013Q\307\345\356\2564\311\257SW\310\274\002\" @\002\242\234;\036\tE83\354\215\344,\366T\333^f3\377\242\300\030\346XQ\274\001[\034t\342V\313"
+	.ascii	"`\032ZF\037\234\361\241\300B@\340M\336\214\204\305p\013\2620"
+	.ascii	"\272=\033\261W:9\342\272\0024K\261\210\366Z1\255\r\372I\244s"
+	.ascii	"\231'"
+	.text
+	.section	.gnu.lto_closeWindow.30.3bb4512efa2038a0,"e",@progbits
+	.string	"(\265/\375`l\005\225\""
+	.string	"f\276\331G\200\332Q:\331\310\240\021\023u\233\312\020\342\264\030\353\270\n@\032C\2429\267@:\232S\357\n\027l\325h3\333\345\265\35727ga\020\362\036\242\032\221\206\365\334\343e}$X\225\214\332\001\362\332\376\267F\310\226;\311\304"
+	.string	"\273"
+	.string	"\310"
+	.string	"_Q\366&%\230\265qs/\363\301\355\\|&\353\216\362\273\336Dx/>\263\027\212\005\25647\367\336\242\243\274\340vt\350\002\322\243\366"
+	.string	"\322\243\3271\263\2209\355\314\345\215\260\246\030\246v\357\355u\220\224\231\355-\363\234k\341u\273\034\356fKQ\333U\310gr\003\311,F\244\324u7\035\337}\f\325\016&\217\232\263!\001\251\272:\216\310G\225\325o6\001\226\027\034\037Cee\005\210\371\261\346`'BB\225\2546\273sj]\361\220E\353\300\252\351\274\330\260\246Gt\034\315!s\334\362\2205\354P\331\353\021I\243\366\231O\220\366\306G\325\325\253\r\351\336\313\325\210\254:\363\234\371\314\314\035\230\321"
+	.ascii	"\001jhT;\314\267\362+M\374!\274\304Tod\352\031][\311\251\372"
+	.ascii	"\\\361*MG\314\254\342T|Fh\356\275\020\244|\212\013\376\220\243"
+	.ascii	"\354\364\2537\036\345\377\322\243@\315\305U\307l\252>\333\252"
+	.ascii	"\351<\322\255dfJU\240\2463\tw\026\263\320+\007\235\354\f\364"
+	.ascii	"\363\312>\017;\367\360\356u\346\261U\336\245\225ui\345\034Z\031"
+	.ascii	"\207V\276\241\225m\266rj+\243\377:[[\271m\345\332\225O\200\001"
+	.ascii	"\220\001m\356\275\361\274s\321P3#'\373\303\376\257\337\353\226"
+	.ascii	"\271\3711~\031\224G\021\236l\206\275K$\265:\032nG}\352\001\244"
+	.ascii	"O\370baW\324*8\341\20358\022>ZVTl\255d\235\020T(i\212\215]\321"
+	.ascii	"{\372\370\262\177\230\"\005\315\365\301\236Ddmw3\347\365\261"
+	.ascii	"'@\031\231j\357\2757m%\327\346G\245/{\211\033ElP\373\364\221"
+	.ascii	"Y\301{Z\250/\366\242 cD\254!\257s\375\346m\230\2613\3049\303"
+	.ascii	"\372d\\\227!3\346F8\267\2665\256O\304\2725zV\\C\023q \314\b\002"
+	.ascii	"_\016\206D\t\023&\322\243\266N\352\252c\346\323]\242\020,\271"
+	.ascii	"\234(\260\324\362-(R()\245Gq\026m%3\247\035\324\250\231\342\032"
+	.ascii	"\332\335i\237\270\344\2156PXq\255\314\371,\255\335}\"\222a}2"
+	.ascii	"P\327\3769+\256M\325\347\337tj%m+\271)}W8`\001PA_\013\013\364"
+	.ascii	")\301\260\301'\246% S\210 \024\360'c\027\3649\371^\240\274d\004"
+	.ascii	"\374\005}O?\247\024MO>\031\275`\213&\337\013\026\275'\237\222"
+	.ascii	"So\t\b\3253\"\342\037\f&`/\370\373\001{:\346}ga\310\2016\325"
+	.ascii	"C\376\331\345\240=\236\250\305\031\252C\347.i\321\317u8?\336"
+	.ascii	"\362\336\251\033\3370\205\n\365F>\223\347\304\220h\304\226\322"
+	.ascii	"\265\222\277\353,\356\341\202\373\351VS\213\316\323G\347y\372"
+	.ascii	"k\277\367\326\310\265\222y\372\247\317|\017\013\035\"\326\260"
+	.ascii	">+n\327i\027&,\277\346l2l\340\300!\265\275K\2321\200f\253\310"
+	.ascii	"\315\246\274\266}<zT\252\353\030`i\320<M\224\007\020 \322\243"
+	.ascii	"\272\252\304k+\311\316m\250Q \247\244$2U\201\214\204\221\302"
+	.ascii	"\244\305p\242!\263\352\001\021\220IDS\013\222\366\f\"\222}\203"
+	.ascii	"\030\277:\2121N\240\224\002g\271\"\243\2079\200\017x*JwPV>D\006"
+	.ascii	"\353\233\331\371\314\351y\022\361v\310:\200\tGcP\376\253\260"
+	.ascii	"\276\024.\333;\200bk\027j\2155\207t~N\366*\264r\206\304xF\376"
+	.ascii	"\246m=1]\324H\276\261\357@\177B[<;\343[\006\302t\303%.:\371O"
+	.ascii	"y \362\024\005{\025\316A\006\213\003\2364\314\344\022\372k\021"
+	.ascii	"\373:W\026X\314nZ\263\210\340;K\265+z\323S\265^\366\207R\370"
+	.ascii	"3d\210\030\244\306A\005\324\363-s\301\252[CN\274[P\323_\351\367"
+	.ascii	"u\235\326\323\026\310\235\306z\234\b?\307)\266Jx\221\017}\006"
+	.ascii	"\376\324A\177\372\003m:\215\241\002"
+	.text
+	.section	.gnu.lto_wingMonitorUpdate.31.3bb4512efa2038a0,"e",@progbits
+	.string	"(\265/\375`L\005e\""
+	.string	"6\277\336H\200XN:\375\377W\240P\212\030\002\260'\334.w\257\3729\257@\322\024u\220\004j`\2707\341\003\325:Y\266/\f\233\210\273\354T\177\234#\013%;'\370\376\313d\311.\\\004/\241Ry\365\215\254m#\233\310\235d\311"
+	.string	"\277"
+	.string	"\320"
+	.string	"\2675e\346W\346\007yW\322\275T\260\357^,!l\3672\033\260\203\336\255\201\333\240\267\347k\320[\346$f+gj\335\213A5\221y\271\367\006\373F\217\317\237\314s\332I\007\246?_\217'\203\332\263k\022\377\353\007\252\2568%\225\016\264\"c\252i\214\377v\260\244\252\356;\201s[U\217\213R\236\021\224jsOk\252=\033RT\347\375Hu\231\263g\311T\327\343\242\252\316"
+	.string	"YS\304~\366\235\036Q2*z\262\333,\253;,\251\030\267/~\236\013\256\226L\315$W\2346N\262\250\244\311\245\332\347\002;\"\\f\222\310\323\306E\016\247\177\275>%\227j\345a\270\367ruJJ\235g\316\374\033f&b>\301\002a?\177@\261\333\352R\266\003\371\265\017Q\301\307\301\305\022\365N%\320\333\367"
+	.ascii	"(\256\253.\252cm23\221\265\227oQ\226a\270k0\243\225urpnv\276"
+	.ascii	"9+\327\334\353\2479\332\031\370"
+	.string	"\261sj+\377le\237\255\334C+\363\320\312\250\255lm\345\323Vn[\271\236\225O@\306\307\225UV\213\246c^\027M1\027\316\266\3518\332o\366\217\275\231\317|!\3744N\321\330\255\247\024\325K\023\233aw\357\325P\306?\2030!\351f(zw\007/MN\206\335\275\314\f\2753\371d\234\216\261\233\201%\346MVP\302\005\341\271e\013\275[>\330\303R\234\311\2354\343\272\367\246)\230\323cn\032m\224I\323\230cm\016\035\212\020\301\223\r\004\242\304]\216\203\207\017\037\320[\333O\273\202d\021 m\307\332\354V\252\315\361\340\365\222\177\236\333R\262\3110\n\364\246u\240\302\210\325-U0Do\3423A\353\336K\201\317\344o \3708n9\304\317\017z{\323?{\202\273!_\332j\030\0320\336\320^\266\222;a\271\020\355>\373LW\310\332<\322m\223k_,M\033\261wj@\254"
+	.string	"T\346 \241z'\026\301\303\356\213\035\262\225X\302\035\333\324\331\315\346\205h\355\266\"&\205O\344m\302\341\210\021\350m\355\257I\371\0051\255\271\356e\201\260\031'\242:\375\257\007`\312\201e\221{[\252`\270\246uZ\300\226\2461o\232\256\351\007L\324#D\034\"\005\215\212Db1h"
+	.ascii	"\322\2208,\262GB\240\242!k\034\002\2218\217<\b\021\207\035\220"
+	.ascii	"\214\204\214F\023A2\034\324c,\"\r\215\212\304\037\241\321\360"
+	.ascii	"D\020\211H8,\032\n\032\r\201\210\301 \343Q\260g\207\213$\204"
+	.ascii	"\214A\244b\321\030L\231\307w\r\376z\257L\t\334\261\221\300^\262"
+	.ascii	"\257\356\227\323]gy\236\366S\335\323>\227N\302\242\353H\232v"
+	.ascii	"N\237\354\326JIW\177\275\364A\253\370 \240\362\263+\270s\343"
+	.ascii	"\322r\254M_/\371A\022\036N\333:\031\236\003\373\351<\273\241"
+	.ascii	"\300\256^?\357\275\267\307\340\300\306i\264J\331d\272\372\265"
+	.ascii	"\224(t\276\266\375k\273\306t\205D\362^\373\372MT\274\3565\257"
+	.ascii	"\n\260\321\346\365\231\002a\250Q,\306\020R\206 B5\023\210\222"
+	.ascii	"\fc\220\002\221),\017\021\320\261DC\023\265o\0161K,\365\2363"
+	.ascii	"\261n%A\004\330\032i$\214j\313T\031WZ\375\3057\261r\376\006Z"
+	.ascii	"\324\221%\364E\210L\301\351\267R\367\213\016\201\0079\002\334"
+	.ascii	"^e\027i\270\007{\310 N\3160\351u\021\217\206>\3112+\036\254!"
+	.ascii	"\252\365\020X`\2653,/\235R\316\027P\225\236\224\354\344\200\274"
+	.ascii	"5\234\315\t\243+\t}eb\302u\345\265\247\255\007}[\247\221\330"
+	.ascii	"A\320^\337\033\200\n\252\265\253\330C\004\3033\341h\215\314\270"
+	.ascii	"Q\346\224\314\266!t\217m\343\250.\361\366\006\374\2060(,\214"
+	.ascii	"\035M\027u'*\353\233\241\240Q\327#\004zq\245U\005"
+	.text
+	.section	.gnu.lto_wingMonitorReset.32.3bb4512efa2038a0,"e",@progbits
+	.string	"(\265/\375`\345"
+	.string	"U\n"
+	.string	"\346\321B90\257\322\001P\301\222\335\222\306\367\333\370\367ZpG+\246\301\023s\341\001\327aVm\346\217\031\333`K\243\225 \214\235\327\205\001\232\210\020M\330I\023\251\206\334\337\204\354\235R-"
+	.string	"0"
+	.string	"8"
+	.string	"\264n\006\263}\215Q\366\312G\327\336\003\266\212\325v\267\316\214\243.Q\3765\016 \262R\227\031\204\335\265\024Y\026\367\274m\003\333\325\376*\253\272\350s\274\003\302\177\275\263\351$/\276\363O\364\235\035!!/Z\312Xh\0243e\217)91\354s;[v\206\332T\006@v+n\266\r\376\313\n\235\016}\327]\244\324ZT\362f*=\316<\222\227x>\236\007#0\022\n\271\b\350\013\205^\bd\244\217\307D \211\344B%w\243\320\203\177\343\343)\300\265\001\376lB\260\364\215@Q\0074\372L\265\304"
+	.string	"\372\032\026\352\350\363\210\352'|\250\233\002\203\016^XK \030V\315\270\347v\266\022bh\2529a\237C}\223\237p\002\033"
+	.ascii	"3\241\027)p0\272m\375\345\005\n\006\205\200\201 c\340\b\310\027"
+	.ascii	"\024\f\n\001\003A\306\300\021\220/(\030\024\002\006\202\214\301"
+	.ascii	"I\020\204k\\\023\311B\300/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_wingSaturationPercent.33.3bb4512efa2038a0,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"\215\t"
+	.string	"\006\323C90\257\322\001\204\031\031\242\374$\232\266$S\n%\037\261\253\375\261(E\030\004Yk\261l\334G\240\006\253p=W|FD\242\013l\336f\371\222\177\003\372@\337\376&{\247\0242"
+	.string	"4"
+	.string	"0"
+	.string	"\334\0010\237\266\215"
+	.string	"R\031|\330\341\302h\230X\314\\vC*9\016>\202\376E>a\030*\255\327\3521\263\260\273\216\255\327\305-o\333\300\266\202m[3\003c\021@\331u\335^ve\326>l\253l\216m\031N\330h\273\241\307 \315\247c\264\017\362\020\325eN\361f7\343\204\266\273\036\037h>;\017\300|\006%`\201m\212\317 \006Zv7a\344$(\337\343\323\021\251\370\326\247\237\222\233\032+\336\354p\025\345\206}nw\3272f;\232{\370\313\313\376\030_-U\322\364j\350\304Y\364\361\272\257\232\272\022\303\310TS\364{\030U\222\0035\325P\211\212<\024\375\020\270;5x\364\353:\217r\302=\2672\306\311\016KV\330\266\304\003\013"
+	.ascii	"2\241\375/\260\226\250a\336gc\f\362,\n\327@\211\t\034\250\302"
+	.ascii	"*\250;\246v\222\001"
+	.text
+	.section	.gnu.lto_wingSaturationCount.34.3bb4512efa2038a0,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"\215\t"
+	.string	"\326\221A;0\305*\035\200\205\355B\003S*\257\277:U\263g\f\304\314v\230a\300/\2219\213\260T[\221\224\003\254\302\351\303\rFD\204M\312\320\316o\305\311\351\307\001\032\033\331d\357\224\0020"
+	.string	"1"
+	.string	"."
+	.string	"\325C\265\271P0^"
+	.string	"v\353\324|`\273\324.\260]\306\216\177\207\237\177\222\313\225\306,\245:\035^\032v\3270\245Z\335\361\266\021l3\330\226\005P^BV\bZv3f\262U\2211\020\333&;c;\326\212"
+	.string	"\260\335\272\261\002\204o9\305\230\335\215\023\330\356n\234\020pi\333\027\371\210\311\237\0267\371\016l[\374%Q\300\262\273\013\256\227\220\374\217KO\224\340S\227~)bb(8\263\353\tF\016\373\332F\226mh\355\365\217o\375\001\036\rQ\220\354hg\244\331\303\3518\217\212\270\220\303GDK\323\213\370P\020\304\024\321Nhz:\322\344\030\230\033=t\323\343\270nf\352>\262\264\250A\305\013\212\017"
+	.ascii	"2\001_xF+\n\320\204\006\363>\033c\251g\221kxe\026\217b\002\007"
+	.ascii	"\25208\036\224E\001\250<\246v\222\001"
+	.text
+	.section	.gnu.lto_wingSaturationWorst.35.3bb4512efa2038a0,"e",@progbits
+	.string	"(\265/\375`\232\003\225\031"
+	.string	"F/\243I\260\226Q:dN \313\337\360/\213\3121\356\260\323@\034\331`lo\305\320W)\315q\005\272\360\024[_2oKw\244\375k\017\267}l\375S\372\363\354\177\312k\314a\255\245\361\210q\257ht\232\375F\b\331[\356\224\002\220"
+	.string	"\205"
+	.string	"\217"
+	.string	"\007\202y\220\221\316\252\265\307'\244\326\321\201!\210\247\036\337\002O\305\023"
+	.string	"O#L\2001\356c\f\033\220\307\b\215\217\247Z\307\327\302"
+	.string	"=?\307[\\\334S*1\004\351\\\211\363y\2378Z\030\325\350b\236\022W\\u%7:Cg\261q\303B\212,/pr\036N"
+	.ascii	"\277\037\026\002t4S\202N\321OF\202*\237\025\247*>\005\350N\314"
+	.ascii	"\004D\2279\335\214\334\017\235\3620=q\201\223s\031Z\250\265Z"
+	.ascii	"\326\350p\356\325m/\331\316`/,\247\353\323\204\303\311\204\214"
+	.ascii	"\262\307\030\271;\373\007\212~7\274=vk\205\365\361\037\360\240"
+	.ascii	"?\300\205|w\370"
+	.string	"\336\r\322y\241{\251\264\234\3227\020:%A\260\244V\233(*\025\t=\242q\337\337\373\205\276\366\355\003\361\211\274\362\371xL0\210\357\341\017yu\352\373\370\017\230\367\234$\306\334\210=\036\223\223Z\353\005\3614\301\274\r\343\363\274\362\205pb\255\021\366x\2168\251ut\235\272\202\270c\t\250\tR\332\337\021t\347\346\356$0\334\n60xMf$\324g\255\265\202\273\363\211\236z\002\n\232_\317\235\273\233\263\033<\334\326^i\307\b\305\216\214\214\222T\356k\240\204+\267\266\323DS\005\334\002\364\311\224\0349/\372\375\344\314\335\355\367.xK3\022\252\366$\334\002&\333\266#\211P\020\243\326J\341\350Dd\376\214S\323F\310\327\234\372#\366Dg0DJ\216\243\325)\372\371\354\356^@\337\210\303K\t\036MO\256\373A<8I2\315\360\215\004\006.\257\3756\203\265\330`\032n/6\032\t"
+	.string	"\267\230,\346Bm\261\016\265\351\226\0076\332-6\243\3116\200\230\305H\274n!@\304\\>\274f\261\016\262W\213\355\345\365\200\305\264\032\314\366\272\321h\266\327j\254\237\"\335\325\352)h\242 1\2612)\325\3668T\nY\342\023P\n\351:\2709\317pe\317\273\350\244cI\3728\220n\256\310\301T\320k\255'\304\335\331\023\234\273\002.k?\364\t\265\323\363\357GGH\270;\007P\242-\0052T\256\207\2333\335\365T\005J\250A4\305\214\"\204!5\001\005\024\304\024\244\rp\002\031:\263\r\021\240\2756\324\331\337i\320\304\b\312\b\337S\020\237\312\213K\003cK\222ly\235M5\206nHL"
+	.ascii	"\254\360\375x\372n?\335\023\013\224\013j\206\234-\302O%\276("
+	.ascii	"\3748\335\016\311\351!\205_\254\315\314\360\240\016\266\253\206"
+	.ascii	"\270\f\001\222\n\361\024\n\227\367\302\255(\220 \215\220\220"
+	.ascii	"j:\277\333\034\003y[\247\033zj\252\330\246J\300\023\260S\330"
+	.ascii	"\247\340~M\241\371\202\356\r\031\200i\350\024\0136\246\375.\267"
+	.ascii	"\340\033J8\333$>*"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3bb4512efa2038a0,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\375\005"
+	.string	"d\bF\001"
+	.string	""
+	.string	""
+	.string	"\002\036\177\025\265\346\314\031\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\030\r\200\204\001"
+	.string	""
+	.string	"\003\005\031\026\033\020\034\017$\027 %\030\002\035\177\031\320\231\263\346"
+	.string	"\272\200\202\002\027\021\201"
+	.string	"\002\037\177\032\373\245\350\336\032\033\200\003\002 \177\034\200\200\200\200\004\002!\177\035\"\177\036#\177\037\001&\177 \377\037"
+	.string	""
+	.string	"\200\200\200\003"
+	.string	"\017\204\017\003\t"
+	.string	"\224\320\3614\001\342\001\003\013\017$Dd\204\001"
+	.string	"\027"
+	.ascii	"\240\b(\327*,\036\246R=w2{(\323\004\356\224an\300\032n\200o\354"
+	.ascii	"\374\bh\004\254A\324\034\251x\b]\344\t\177T\026;\265\006p\030"
+	.ascii	"8,\272\245\f"
+	.text
+	.section	.gnu.lto_.refs.3bb4512efa2038a0,"e",@progbits
+	.string	"(\265/\375 \203\265\002"
+	.string	"\262\207\022\025\240'\351\377\377\377\377\201\204\347\321\333o\215\320\332O\310\226)\005J\244\261\023\005;Y,!\223h\356y\215(\036\265\203\327X\213Rbk\246u\266\034\215\261\324^\006\246a[x\036\200%\0245\310\022D\017\355\246\257F=\004\002"
+	.ascii	"QU@\234\201\202\002"
+	.text
+	.section	.gnu.lto_.decls.3bb4512efa2038a0,"e",@progbits
+	.string	"(\265/\375`{\017\025M"
+	.ascii	"\232\200`\034TPPJ\032\016\207\323\344\350U\334\224\r\004\274"
+	.ascii	"Y\347p\016\t~{}\353b\363\373 \267H?\364\277:\002\267\212\345"
+	.ascii	"\224`\266)\361\315\332p\205\205|\357\020p\273_#\310\336\316\036"
+	.ascii	"\004\2617\313\342\366\365\026As\244\240\264\3310\364\344\320"
+	.ascii	"\240\354\366o\"e\nr\001\265\001\271\001\347"
+	.string	"\327\037~j\324\304\202VR\242\304D\321Qe\026\345\337\036\266\311z\205\320\315\204\211\240\341\324\303\353_'\373d\231!t'k\272@Ym\340s\273\326\207U\226X(G\221\342\267\237Vc\325\260\345\300\026\206\317\247H\277%\320m\333\022h\317\356\240'\016\017%n\326\247%*&K\324\206SV\226\374\273n\326*\021\336\224\246j\260\361\371U\262\\{l\001n\324\252\262\344\340s\265vk\225>\233\344\273\303.\037\003\\{\355^o\370G\021\\[|\342\354\016\312\t\244\377\223\007 \254S\234\323\257\017zkk[\037\224{w\320\236\325A\367H\320\027\211\016J4\256}\023\301\017\252+>o\253c\344_\035\026\313\3476T:\366\262{\315I\205>,\301\342\363\353\356\240\351\352\240Zp?S@\"\350\203\237}\256\363s\2110\233\301V\200\301^\360o\013\336\3717\b\202\377b\377\261,\013+^\373"
+	.string	"\327\177%$\356\203\300\277+V\355?\224\377L\002\376u\3403?\327\374\213\342\337\236\177I\374\253\363\257\315\2774\377\216\370\027\375\227\377\375\177\266\377k\377\201\370\337\374\277\374\217\366\037\314\377/\377\315\376{\371\377\301\177\262\377\\\376{\360?\313\377\261\377a\377\301\376K\371\037\345?\223\377K\376c\3757\340\377\327\377\264\255\255\255\355\347\341\317\271\037\227B\375\313\351\265\211\303\244\324o\250\f+\346\254-\203"
+	.ascii	"\235\244\352\341*U<\217\315\275\366\266P\252X\302p=\022\207\353"
+	.ascii	"\361\207\323\302\343\257{-\342\f\227\300\337\016\223R\305a\362"
+	.ascii	"X\314ia\377:\t\224!\025\036\213C*\307\"\3160\t,\016\205R\305"
+	.ascii	"\234\034d<\230\260\320%\354j\315\206\302\266\261\004\005$\342"
+	.ascii	"4\207\353\261\307\272w9\243\211\007tC\035\211c\300\033\353$\330"
+	.ascii	"\264\021d\002<\356\332\335<K\301\251c\013\233\303\252cwU\320"
+	.ascii	"\250\227\032\370\255\315\366\261\315\037\025T+\315\350\036`\251"
+	.ascii	"\373\267\335\354\356_w\313\020\241\326n\0348C\344\322R\267\221"
+	.ascii	"\304RC\375\236\314\350\346\245\026'\305ar\352\030\364$I\022\331"
+	.ascii	"4\326\337\"{L\212\230&\177Y\255\324\335\373%E\026\235\316\320"
+	.ascii	"\224\213\266^$ZT\361P\326D\243\t\232\256d\323\332\026\030\345"
+	.ascii	"\202\331(1C\r\234L)\303\341\213r\277,\330\231\323\r\374B\256"
+	.ascii	"\f\251\031\r\360\251\0070>\277F/\312\365\262K\266\330\r\364\241"
+	.ascii	"\003\206FcHZ\023\211&.\224\376\333\205K\020;\314\206\360\271"
+	.ascii	"d6Xl\034\247\370<\007\351n\371\251u\254\271\001\237\2524\321"
+	.ascii	"\342\265M+\035\310,c&\030\215G\306\260\3308)\255p\360\271A\254"
+	.ascii	"\020\253\344Y"
+	.string	"\261=\353\021,\362y\f\322\024\272\227\007\335\266\266\345\271\302#S\344\211\216\031\302\300l\2147\222\\\201\375;e\277\266\311\250R\023!M+|\354f\202\026a\n\t\302\347R\331*\253\374Y >#\\;9#\366%\307\222\317K\220~\177\320\233\375A\003'#oc\254\322Uv\003\003\371gF\b\331\221,r%\275\002\251\326S\261\310'\327p.\\\305E\311\214O\376q&\215\021K\032\017\032n@L]\t\362\311<\270\307*\377\305>n\323E\203\353\213Jz\025\366_(S\235wtE\355\220\2022\365\317\310(\021\213\001\331$\375m\211\003\007\037\371\353\324Br\361\320q>\316\030\371\302\002\204O\216:\224\031\"5\2060q\016\031Y\313\262\034\f5\206\304il\311dXH\303Zr\f\270\244\016@\264\252\027^`\343\026\0171a\2004\005o\234\215VpQY\252\272\360\311OG&2\221\235"
+	.ascii	"@\312$\231Z\226\2158;\362\365\324tvZ\346\rX\026\2663>\271x\346"
+	.ascii	"M\023\263\314xk\301\206\215][\233i\267\200\324\200E]\251)\261"
+	.ascii	"\322\236\271h\321\365\303\226\341\220[H\273\373\207\323\301+"
+	.ascii	"J\310\233\036\332VPc\341\334\202\r\026\263L\355L\210IC\332\017"
+	.ascii	",d!\317\350\033Y\025\032T\322\332h\374\301MI\353\332\302+\234"
+	.ascii	"g\214@\013~"
+	.string	"\351\301\347\301,\027\234\027)NH\200J\006\356\330c\204Me\205\3546\232\250\301\341J\031\314\241\177\024)V\311\275\314\325j\246\02794\261\245uK1q\026\341E\314\007\237\347\027\322\177\331\276\312e[\256\237\t\272\244\2245q5q\036\246_\265%\342\033F\271avm\215\021\\\221\225\265\221\370\263k\357B\323\215\325\335\004\304\204U\335\240d-=\377h\003\211\335\335\024\26361H\203n\314\356\317_\263\267=\340\377\331\267\002j\350\216\"\033\"\025\322\004\030\303{\332\252\0037:\221C\322\251@;\036\022\022\217H\025\032R\217r-p\037\220\200D4s#U\347\"g\247\353\251>\240\\Q\322\021\321N\007\324\363%\001\005pt\224\264\333\361v2\252P\016\005\235\017\225\301\353\031\251\274\235\314\bC\271\243S\315\371\220rH\250\352\353\361@\330Qs\276\\\0078>\030joH\365\240&\247\016\025\221"
+	.string	"c\203\034_O7\364\342\350\210\002U\347\202'\346F'\200\212\216tI\"\360\344\212x\033\304H\022!W4\343\313\371|C/h@\310\371xGD\270\023\351z\271].F\372\006T(\240b\305\t2_\301b\001\026\013\240_\301\"(\210\205\212\240\364*\202n\276\030CG\030\350\250\273\034Q/\367\"G\335%\361,\360\335\250B>\0309$\235\232\336\200\363H\310\365\200T\036\257\007\204\363\251:\0272xE;\235\214\0219\241\035O\247\016\365\222\324!\017pdT!\024\f\250B+dT!\025A\352N\227\224>(\310\202\036\030\034d\220\022\235\350\361T\335\216\207$\024c\247\223\001\244\032\305\320\035\215"
+	.ascii	"\264\323\r!\001\021\365|@'z\226\273vr\301\320cj\2073\034\025"
+	.ascii	"\2555\257\025\213\206\211\351\307\321\210\021N\332li\212Y\245"
+	.ascii	"\265\321\005$\347$oi\341\301\234\302'\257\234\265\3123Y\353&"
+	.ascii	"\n\030\035N\326\364\004\2313Q>\262gal6\240\235D\2608\210M\023"
+	.ascii	"I\233\017\035\230|\245\212R\360\n\275\261B\230%\353\212s\022"
+	.ascii	"\305\345\002\237UU\\d\346\207\253A\f\223\222\306D\316EnD\254"
+	.ascii	"f^|\362\220\023\230\262\324y\006)\016r\023\243\351\237V3EP\204"
+	.ascii	"\025\"i=4\376\340\262jd\201\331p\016r\306\001E\212sI\255\210"
+	.ascii	"\210\0019\201=\250\2418f\024D\"\"#\"\"I\222\244\003!\005\204"
+	.ascii	"\030\347\264U\035\0210\251\203\214\320\214\244 )I\235\3060\227"
+	.ascii	"UZ\220Z\316\241\251\030Qb\231\t\247\2633(>\330\322p$\307a#\315"
+	.ascii	"&G\205\242\303\332\257\250hVg\216\335YW\034\245\032?\016\204"
+	.ascii	"L\350\216\244g\347\r\245\237\2159\031q\022\242|Y\265*\342\036"
+	.ascii	"\354x(\317?\356\004;T\372=\204k\260\331\344\371>\217\252\235"
+	.ascii	"\320\203\225\354\351\013M\334v\024\371\370F\001\020\374\025\277"
+	.ascii	"\026\370\021&XQ6Vi\352\342\177\205\244\251\035\241\177\031\305"
+	.ascii	"\004\266\312\350"
+	.string	"\206M\214D\200\345\370@\340\204\312&\277;k\nh\277\242\302\255g(\210\371\031\206\202\324\373pWZ \320(\360\327+"
+	.string	"\222\206U\370\327\"\"\032_\345\214\225~^.\327D\013\303\360@r$w_\304\337\177\337\304\324\206\372\367\007@"
+	.string	"~\205\347\177\254a\236\325\205#Yp\346\ns\006\374t\251\007\354f\255\232U\365\200Z\326\360?\365\373\322';i\272\236\007.D\223\r- \221eX\210 \031i\033\005)\0234\212\"\370\212-\273[\026\017\022\212\324\"*E\233\316\002o\246\251\273\242\206K|\253\364h\246\0236n\3745r\245\001\311J\251}\033\344\260!;\207\227l\027\245'\231\206\302\246u\222\347d\252\024\30528(\001\247.=\277M\372\003\370\231\313\337\337\377\320\2048EL\275\243\034\\g\214K\210)\004\221\270\334\212f8Qz\311\034\013J}\336*\3616f\306\256\320\272\350A?\244C\252\333\364\021\304\335\f\342j\\\360n`\264^\341\266\372\023\207\256\253\233\321\260\307r\232\240\021\314N\204:\256\225\265\210\232\361\312\001\033te`W\\wpk\366\354\232U:ac\253^\314\351\277}\365"
+	.string	"\340\373\ne\016\315@\017j\002\311\306\373\210\234\t\037\211\346]\240\f/K\264\220\200\340\220/\236\334\361\206\371\266\227\323\314\233o6\210\\\373\266\236\213\376X\313O\036_\234\264\036E^"
+	.ascii	"\207\001\334_\362\306\343\274\362GX\033f\016\246\373Y\302\317"
+	.ascii	"6I\341\263\316+\024/\006\f\256\3663.S[,O\204\2575{\215s[?\236"
+	.ascii	"\2035\017MG\366\341\377\\\315\027n\360\335r\275\335\346c4\273"
+	.ascii	"\332\\'\274\037y\275\rs\266\331]\323\b\033\254\177\341\234\231"
+	.ascii	"eZ\265W\005"
+	.text
+	.section	.gnu.lto_.symtab.3bb4512efa2038a0,"e",@progbits
+	.string	"wingSaturationHitAllPairs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"wingSaturationFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"wingMonitorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"wingMonitorReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"wingSaturationPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"wingSaturationCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"wingSaturationWorst"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3bb4512efa2038a0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,626 @@
+	.file	"displayport_msp.c"
+	.section	.gnu.lto_.profile.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"\235\005"
+	.string	"\324\b\004\001"
+	.string	"\023"
+	.string	"\317\333\366\301\006\004\002"
+	.string	"\002\001\001\317\253\250\341\002"
+	.string	"\002\330\370\241\354\t"
+	.string	"\003\215\377\300\244\017"
+	.string	"\004\320\235\262\314\006"
+	.string	"\005\224\217\236\327\t\006\002"
+	.string	"\002"
+	.string	"\007\b\230\232\324\211\b\t\361\272\334\207\001\016\002\003\002\005\n\240\342\234\212\n\013\263\326\341\254\013\f\262\201\245\301\003\r\330\271\210\336\b\f\002"
+	.string	"\002\006\006\016\253\301\343+\006\002\007\002\b\b\002\b\017\345\325\256\222\004"
+	.string	"\020\021\304\302\235\224\006\022\334\347\232l\023\240\342\234\212\n"
+	.string	"\017"
+	.ascii	"g\020\277;\257i\205]\347\341(e\234d\202\201U\3355\004\b\034e"
+	.ascii	"\323\257\212\r\342\354\355l*\300\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375 \366\r\004"
+	.string	"\262\305\020\031\300\245\320\001\377\377\377\216\\\376\377\3777\246\221F\032i\215\020\322\332\2262\245\356\316\202><\233\304Pd\371\235em\b\310`\3670\n9\200@\353 \236\251\0339\255P\361\027\220\362\206W\324!mb\"\032"
+	.ascii	"\026[!1F>\r\202Z\3400\344\301M\314>\334\n\230\177AW\\\214\002"
+	.ascii	"\026\213\2000\237\364\242\n\002\310e!\022\364b*LQ\211Y\t\340"
+	.ascii	"\363\032\030\027\230\252\022\346\006\332"
+	.text
+	.section	.gnu.lto_.inline.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`\020\002]\b"
+	.string	"2L%*\200)I\007+\325\f"
+	.string	"!N\201\t\017\270zj=T\005C;d\2555\311\210\204LM\306\207\260m\266\3557\322Z#[\356\024\333\3177\310\255F\224hw\016m\033>g\320\202\026\225\003ND\036,\006\b\030N\303H\377\375\203\002\274A\202\242\"\300\030\265\274\375O\362;\324\302E$\302\261\304\036Z\351o(\003\320\266\r\302\325\22695|\034C\333\344\233o\321m\316\006\\\251\231N\263\200m\313\210Eh\233\360\313\246\260\365fhss\020\242\255\362\317\227\0021 \220\002)!\252\033\202\221\331\220\001\030\023O\304\256\253e\216\360\002zq\203\305aO\231x;\263\233\001\0131\362-"
+	.ascii	"Ap\344\035\320\0210\016\t\221\300x'Z\335Dc\034$\023<\306\323"
+	.ascii	"\300\270\3502\r\"\225\305\013?\306\323+\3223\2168\234T\266\242"
+	.ascii	"X<\341\035\341\260\013n\347T#\311\240\2131\357\310\355\321\023"
+	.ascii	"\374\353(\220\224\341\261\321\n>\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`b\002\325\b"
+	.string	"\322\215')pK\222\016\375X\257\216\027"
+	.string	"\301\256\313\377\377\377\324\333,\206\235\316\017\020P\325\300\216\003\\#7mM\324>i{\313$\003T h\231\303@\253$d\341\274@\372<[P\3577\230>\024L\213Su\2264P\277\2362P{=a\240\326\r\347\323\005\352\306c"
+	.string	"\3214M\3047\323\242\036\352)\345\023\023x8\256>`y\342'K\f@\"\334;r>r:\257\244D2+N\217\242\2203\234\362f\317\310\353\237\361\264Qp\243\230\\\036\335\321Q\357\340/c\365\222\377e=\031VB5 \240\002\031\262\242\007\024\001\263\030\245\216\013k\225\345\030\021\n`\006\266\020\243\002\253,d\003r"
+	.string	"\2069\0325\256\013\217\210L\004\030u<"
+	.string	"\001\025\240G\316\214v\340\273\027@\022\310/\2209\231\317\214x\036\325\232\016m\033\301j"
+	.ascii	"\231\276J.@\367d\216y\ny\252;Y\267\f\177C\023\342\373_\326R,"
+	.ascii	"\r\205h`\275\023\275\256s\357\020\256\231|\214K\216U\200!"
+	.text
+	.section	.gnu.lto_.pureconst.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\205\004\001\200\004\002\200\004\003\230\004\004\230\004\005"
+	.ascii	"\230\004\007\230\004\b\230\004\t\232\004\013\230\004\f\230\004"
+	.ascii	"\r\230\004\016\230\004\017\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375 \343\025\004"
+	.string	"\364\004\311"
+	.string	""
+	.string	""
+	.string	"\016"
+	.string	"\016"
+	.string	"\001\300\004"
+	.string	""
+	.string	""
+	.string	"\001\002\022"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\200\001\b\020\001\001\002\002\003\004"
+	.string	"\005\001\007\001\b\t\001\270\006\001\002\023\020\020"
+	.string	"\013\f\r\004\200\214\260\006\016\004\374\007\017"
+	.string	"\0071cO313"
+	.string	"\005.cR "
+	.string	"\026"
+	.ascii	"\240 .\003\030O\321\002\0340\272l\366t\347\034CX\003\217\227"
+	.ascii	"F9\341\001a \004\334\035\312\342M\302\300\026\227=\234\005\025"
+	.ascii	"\033\177\3326\200\""
+	.text
+	.section	.gnu.lto_.lto.a5d42874edee204f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayPortProfileMsp_Registry.14.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375 \214\035\004"
+	.string	"T\007R"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\256\334\ryw\350\375\005yu"
+	.string	"\005\001\006'\001\005\200\0040sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\004"
+	.ascii	"[\005N\271\351\231\304\r\240\b"
+	.text
+	.section	.gnu.lto_heartbeat.17.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`9\001}\016"
+	.string	"F\034dE\020\221\223\0168j \bA-\250\311\177\273\364\211\332\307\302\262\263\351\271\234\237*k\370\340\212\372\222\"\026\265\037y\377\201\026bQ\251\314\016K\002@\005E\007k\005W!\272\n\342\035\307\362j\2305\262\367\336;\245N"
+	.string	"O"
+	.string	"N"
+	.ascii	"\033\333~\213\273\350\354\230\t\232\370.\023\207\223\025\217"
+	.ascii	"\335\315:/PO\347\t\324SY\342\335\247\214\235\377\3603\245\342"
+	.ascii	"\342}%\237\036.\347\001\024\b\232\001\237ivr\310\234\234\365"
+	.ascii	"x\372Lb\274 \354"
+	.string	"\256\243\367u\270\351m\207\330\226`\177%\277\fPU\3500\200c\027\245\325ce\350\r\024W\375\366\375\325Y6\346\321[,c\274\244v\027\033\331\330;?4\346\005\f\272\253H\233Mq\271\2148\315\354\246|\234\332\301\3464\332g9\214\356\340\206svQ5l\354\202\n\234mN\r\006)\357+\356\230\352\263,\200\342\275*\253,yM\210\226\fi\255R9\022\3560\2115\366g\234\206\346\237p\006.\336;\365\271zJ\245\312\013\026\037H1\002\202\253.aV4)\245\330\262AS\224$\354\317\225(\233F_4\272\316hz0>\t\3103\242\201\253\242M\233\200\331\003\022\342@\024D\233\026\032\211\\\bq\037\222L\373d\030>\"\240\314\263q\031H\307Z\250\302\226\2114m\3130\260\364)\253<\353!(,\361\343\227<\331\276d\203\225\2224\2314wE<\b\317\231QM\0011\301\337\362\360\003"
+	.string	"\346%\027"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\30151XX\021\245\206>\232(\342b\004Udp"
+	.ascii	"\"\222j\320*\221\246\024\n\n"
+	.text
+	.section	.gnu.lto_grab.18.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`\177\001\245\017"
+	.string	"\006\335gG\360\260(\035x\337\223\336\224\213:\\\216Z\3215^\177\035\261\271L>\370b\226k>\250.\036\341R\005\302-\002\302\327\353\227Hb\320\373\303\022lB\327ao\275\256\344\002\263\216\2104b\224\335/\240\375\275\367\336)\005Q"
+	.string	"R"
+	.string	"R"
+	.string	"\324\341\307\266\377r\230\317\306\231a\t\226G\345a\005\206cw\267\320\t\324\323\371\001\365T\222\370\367)\343\347\377\365\351r\271\001\262R>9\\N\003\255\017:\002X\252\031\222A[\371\354q\305R\211\321\323`w\035A\326\206\233\336\366\210\355\007\366i\004\005j\354\262\324r,\215\3068\361\330o\337\237\371\f\3454\226\257\032\327\356\336\305c\276\314!\"\337\3512\226/\233\223\017s\210\310\351-P\237E\341\211\211X\345\354\266|\234z\301\007\305\006\375\263A\321~\314Y|\0171\334c\267%\203\261\033*\360\366y)n\234\352\317F\024\342\301)\253L\371\016\210\232L\232\253R\226\314\330P\211;\366_\334\206\363M\270;\211\007O\352\251\224\237=\272\254P\321\001\025\035 \220\375\300\rL\247%\025kv\250\212r\204\375\271\262e\327hZ\243'\215\226\017\377\b\240\302\314\b\276\t'*\271P\252&\257\203"
+	.string	"\262\b\204T\342\"\230\274\216\204\"\251@*\215L\266n\264Y\030\221p\233\310+m !w$\t\336f\352:o\003\205\251O9GXb\342\307\251\\\331\246\362\257_C\206\027ZJ\252\214\232\273!\030x\344\310\314"
+	.ascii	"1\301Os\331\204\216\233\032\027\370! @\002b\310\252\0366\263"
+	.ascii	" h\233#\264\304\200\207\360\026\207q\314\027\206\376*e1He\307"
+	.ascii	"\3255F\301\017e\n\202\341\240<\303\003I\001\375\206\027\nf_h"
+	.ascii	"\255Qq\023\204\201\322\224\340\002\270\303\267\357\344\346\340"
+	.ascii	"\226/7\322\007\355\226\246h\024\n"
+	.text
+	.section	.gnu.lto_release.19.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`9\001\205\016"
+	.string	"\206\034eF"
+	.string	"\223\223\016X-\030\214\326\037\233\344\335\005\376Y\343c\347\375\327\021\262\255\317\236\313\222%\222\232\205^\210\332\017\267E\200\r:\021\205\300\n\033\372\277\253\357\265\255\326\f\242\177IP\356|\204Oz\264d\357\275wJ\001O"
+	.string	"P"
+	.string	"N"
+	.string	" \307\266\277\342,:\2335A\227\357:\271\244\310\364\330\335\314s\002\365t~@=\225%\336}\312\330\371\017?S\037vx\337\311'\207\313i"
+	.ascii	"\005\302\207\200\3574=9jR\276zT\371Pb\274\036\354\256\243\367"
+	.ascii	"m\270\351"
+	.string	"m\217\330\216`\277%\007\177\t\240\342\320Q\240\306\356J\353\307\326\320\033(\256\372\355\3732_\331\230I\217\261|A\223\332]\214dc\357\374\320\230\025,\350\256*q6\305\005c\204\t\233]\226\220S7\340\234F\3730w\321\035\324\360\316.\212\206\215]0\2013\316\251\003\336U\334\254\352\257*\204\342\275*\253<\371M\210V\fi\255RY\022\362@\2117\366e|\206\346\2370\006.\336;\365\271zJ\245\207\026/\035J\021\302\201\253.gX/,\246\330\262\301S\224$\354\317\335]K\224M\243/\032]g4\r\277I\350S\222\201\253\243M\223\200\371#\"\342B\023F\233&\"\221X\020q \223L\003e\027@$\241\354\263q\231\210\307\232\210\302\226\2154m\3130\320\364)\253\374\352#+01\344\227T\261}I\006-&yri\356\212p\020\276c\243\232\001\"\202?\346!\bd\206&\025\026"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\241q\231(5\364\321D\021\027#\250\"\203"
+	.ascii	"\023\221T\203V\2114\245PP"
+	.text
+	.section	.gnu.lto_clearScreen.20.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`9\001\215\016"
+	.string	"\006\034dF\360\2606\035x'\275\3429Y\337\235\223!\326\305\363\004O\303t\323\351\255\276\230-\306\270K\2347{C\333\020\345\257?\243Y\262\334\373\301\022lB\327ao\275)\f\335\375\225!\335\025eoZ\330\310\336{\357\224\002N"
+	.string	"N"
+	.string	"N"
+	.ascii	"\266\375\025g\321\3314\0234\361Y\246\026\224\030\325\356f\235"
+	.ascii	"\023\250\247\363\003\352\251,\361\356S\306\316\177\370\251\342"
+	.ascii	"\003\016\3573\371\344p9\r\234@\340\b\370L\263c\303\006\345\251"
+	.ascii	"\307\224\357$F\353\301\356:z\337"
+	.string	"\206\233\336\266\210\355\b\366Y\002\007\177\t\240\252r\024\220\331UY\355X\033Z\243\345\250\337\276\037\363\224\215yt\030\313\0275\330\310\306\336\371\2411+X\320\035E\272\026\205%3\302\345fw\005\344\324\r\256\323h\377\345.\272\203\032\376\261{\232Ac\027L\340\354:5x\0055*\357)n\232\352\247*\200\342\275*\2534yN\210\025\fi\255RI\022\3528\2119\366c\\\206\346\2370\006.\336;\365\271zJ\245\207\026.\035H\021\302\201\243.gn\340\254\224\342\312\006MQ\222\260?W\236l\032m\321\350:\243i\361% \017I\006\256\2126M\002fOH\210\003M\020mZh4b!\304}J2\355\223]\370\214\2002\317\306e!\035k!\n[&\322\264-\303\300\322\247\254\362\251\213\250\274D\220[2\305\266%\031\260\224\244\311\244\271+\302A\370\217\033\324\f\020\021\3740\017?\0363\001\030"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\3015\221\0276\266\036BH\r}4Q\304\305\b"
+	.ascii	"\252\310\340D$\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_drawScreen.21.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`9\001}\016"
+	.string	"\006\234cE"
+	.string	"\2216\035x\021\032\2020D\370c\013e\372\203\257\230\325v\317\343x\302\033\346V|\f\003j\026\325\216\377\b\334\fpF\263d\273\241\013\003w\351Nu\307P\315i&F\255P\202\257\227\027V\264\266\367\336;\245N"
+	.string	"N"
+	.string	"N"
+	.ascii	"\266\375\025g\321\3313\023,\361Y\245\023\n\214\315\356f\234\023"
+	.ascii	"\250\247\363\003\352\251$\361\356S\306\316\177\370\251\302\003"
+	.ascii	"\r\3573\371d\271\234\006L\037t\b\370J\223s\203\006\345\251\307"
+	.ascii	"\224\357$F\353\301\356:z"
+	.string	"\337\206\233\336\266\210\355\b\366[\002\007\177\t\300b\301Q`\265\253\262\332\2614\324\306\211\243~\373>\314S6f\321_,_\2500\221\215\275\363CcV\260\240;jt-\n\013\206\210\230\232\335\025\220S7\270N\243\375\323]t\0075\374c\3274\243\306.\230\300\331uj\360\n*\033\357)\356\231\352\247*|\342\275*\2534\371\r\210U\214\264V\251$\ts\234\304\033\3731.C\363M\030\003\027\357\235\372\\=\245\262C\013\027\016\243\b\341\300Q\2272*\227\025R\\\331`)\312\021\366\347J\223M\243-\032]g4\r\363%\237\016I\006\256\2066M\002\346N\b\210\373L\bm\032H4b\001\304yJ2\315\223]\360\214|\262\316\306e!\034k \n[\026\322\264-\303@\322\247\254\362\251\213\250\234\"\310-\231b\333\222\fZH\262\344\321\334\r\341 \374G\rj\006\210\b\376\227\207\036\017\231\030"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\3015\221\0276\266\036BH\r}4Q\304\305\b"
+	.ascii	"\252\310\340D$\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_screenSize.22.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\315\t"
+	.string	"F\223C90\345(\035\236\201k\022\t\024\254\224\240\210'\344\r\037i\342\275B\242\272u:\3767\354\002\324\006\2110\276;\266.\202\204\001\245X\2606\351\215\356A\033\\B\b!R\246\0243"
+	.string	"0"
+	.string	"1"
+	.string	"\240\255r\205\033)\315tr*\001\260\273Q\363\201\354\330u\201\354\230j\034|\202\376E~\261.bP)\322SC\330]'*eq\353mol\037\330\337\004\231VMg\246\277i\030-\005/\273\025-\326\262`)\035\266A;c\373i\177\365\020\360\341\350\001\273\252\025\224\335\220\343\270\035s\270\331\366?\016\022z=\334D\225sM\375)\200\277\223@l\273\023\006\376\210\027\261q\034\363G\331\261+\201\313\252\224-;$\245f\330\277VU\266\246\265\207\177\246\351+\"\217K\310\370\323\351\276\220\202\310\343:\tOC\367\201\026\"\007\212\016 O(~\274/v4\346:\006/\2128\316\213\231pok\252)\251\311\227\246j\2520\024\036\246lY\003\017"
+	.ascii	"\266\231E\246m0\302\210\t\003l\356\251\344\252\232M\351\255C"
+	.ascii	"c\231k8\264,`\t&\036\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_writeString.23.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`\322\002\245\026"
+	.string	"V\352\223J\3200\2511\302R&\226\013\224\007\262!\212\036\376\231\223\363\254\322^"
+	.string	"\013\271\225\302lf\353.\364\236\034\334\214\320\020xW\303g_\272\274\340\232|)\003\350\001\224\332\201\334\231\306e2\b3\220\272\234\311\304\330{\357-eJ\001{"
+	.string	"y"
+	.string	"\202"
+	.ascii	"\020\214j\027\271\271\0349)\266\332\n\026\330NT\263\275W\247"
+	.ascii	"\312\301\253}\241\273\260\335\307\341\253{{\226\202\367\372N"
+	.ascii	"\234\236"
+	.string	"'\355;m\373,\336\302f\013G\237O\317\3145\355^H\335{\323\326\005\224'\307\263\312\223\326\304m\037m\265\371\007~\374\331Y\342\365n\037=\334\216%=;S \275\334\330r\032\356\036|\265\351\351j5\037\334{]y\275\0167y\333*\266)\330\326$\366\345\252-a\177\274\266\307,[=rV\257\356\373CN\364\2437\372?l\265\371\337]\376\350'm\2655\253\253Y\375\001&\021G\001\246{o\212UwH\322@\361\337\237\344/=h\243\236]\311v\250\n\235\331\350m~\214\003\215Z\306\221lO\2329o\212\b<OP\367\342H8OV\234\003\377Yx\336p\316#\036\033P\367^\223\223V9\307#\032\002\"WW\264\"?\341\025W=\317U\236\\\331\234 \240\0178\247\233\326\332\022\244\032\235\220Z-i\257\364\032.\020\037\336\323\2015\222\223\343-ty\251\347\271Uco6m\265"
+	.ascii	"t\212\273\036F\341\361C\264L\365\026\016EM}X\333'Q@ \354k\245"
+	.ascii	"m\004\007\326\002\370\334{\031\330\241\035RD\003\267\260,\255"
+	.ascii	"i\023\204(\326\020s\265\350\333\322\036\270\353\201\253E\243"
+	.ascii	"\225\264\266\206\230z\336m\b\214\240\241\316\336\034\031fZ\254"
+	.ascii	"\214\013\214}\221y\311h\263\222\006&\26300\227\245\311`\023P"
+	.ascii	"\273Pb\263\230\025\232\f\026\333\300\002\023\233\2750\244\260"
+	.ascii	"W*\363b\211I]\262Y\212\3222,\346\"Ki0\230,E}\270\217v\304>x\225"
+	.ascii	"\033\241jr\226\265\261\315\262\rD\340l\3163\343\275$R\236\364"
+	.ascii	"\003\277\202\"\252\305\221\244Z`\205\217\031URW\341\007-\\\250"
+	.ascii	"\347\215\330\362T#\212?\333\364\225m)\322\241\253T\366o|Xs7 "
+	.ascii	"p\"\031\263\363\266\262\b\260\215#\030\353P\326\272\002\333\203"
+	.ascii	"\367*:\004'\016\336Y6\030\020s\033<\304`.\331\233n\035\221\355"
+	.ascii	"\323\304\030\244\275\313\006\351%\227A\032\267\262\315\214;\215"
+	.ascii	"Z\306\255\\\3771\026\267\224\r]4\0134@k\270-1\007\301\303\250"
+	.ascii	"r\300_\023\302\246\227n\247\023\275\242\253&n\364\bE\024\013"
+	.ascii	"t\257\205\302\fL\036y\004G\330\346\n\032\336\335Hm\320^\244)"
+	.ascii	"\205\201\002"
+	.text
+	.section	.gnu.lto_writeChar.24.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`G\001\035\016"
+	.string	"\226Z^D"
+	.string	"\221(\035\245\373s\035\023\323\001H\301\034\036a\370k\202\037y-\354\240mRk2\021Z\203M7`\031\206\332s\270\216<<\026D\200W\313\355\326\234\314\233\005\036#\n\350\223\021!k\237\310\022\"eJ\001H"
+	.string	"O"
+	.string	"F"
+	.ascii	"\3772\034\300n\252\345\305\356\007b\250=\363\247\331\366O\034"
+	.ascii	"Eg\307\300>\025\252\303\024sZ\001\263\273\260s\001\231g\330\003"
+	.ascii	"d\236\251\210w\317\316"
+	.string	"\177\353\230\t\225\213\207*=;\030\354\256\323Cq\270\365\266\t\330~`\277%\232VMg\226\276\307\246\303\214\0016vS^1+#\203A\342,\277\335\371-s\314\342-\272\263\220\264-\241iPq\275\354n0\360\314\016\264g\037\2712\242\001\353\344\037k\242\2212\242i#H\320}ub\335\365\220c\301\323~\212\253\350\002\033\265/\204\362\336\246\235\223\226\254Q\325\237\\\232\246\212\250\\>\312\330\006\321\025\013\006\307\325\366\201\267F\233jwE\356\335\300\364Z@\345\344B\311\227\375\225RC\330\307VS\336\376\375\233\257~\315Y\277\366\225\037\013\025F\022\324sR\344\264$zT\304E\b\034{B@!\223\b\".\2020\220\224\200B\237\t0~\240\205\017\211\t\364p!\030\322q\004Q\340\240(F\016r\276=\266\232\332T\301\007\0245\231\204\355\202\030yY\345\313\232\274\213\267\"\254\341\245\252\006\035"
+	.string	"\266\231E\246\275\246\326\306\315\224\247\231\342t\231S\312\232\257\262\331YZ\316\b_BuM\324\331p\307\262\330\003\033\373\225\271\001M"
+	.string	"\306\001\320\007\006\003\203"
+	.string	"\234\3010>\003"
+	.ascii	"#\004*\034\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_isTransferInProgress.25.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\035\007"
+	.string	"\242M25Po\322\030 v\247\276\214J~T\350\200\201\002%\240S\025n\375\305ql\b\222wdg6\026\tw\233\217\210%)\245\266N\240r\013V*\255\205\304\275e\n\231\214\f\325\237\316\205\201\0342\031\257\tO\304\205Y\0170ZP\302\362\200\340Gb\260\3039^\020\022f1JX\315\325\215\342T<\213\237!\367>^\001vw\177\244w\r\033%\030\203\230]\321\214\314\266L,\"\277\366\325\357\334+\211\226hjB\241\001\273\244\227\225\335y0\334\350\364\324\001J\247\215\nP:\375#$ho:CD\232\013\r\f\224\322\356\204\017D7u\333\252'J0\242\342\341\2222\n\251\323,\354\356.c\304\241?\375\013~\205\277#\b"
+	.string	"\266\231E\246m`\344\250"
+	.ascii	"X\005D\327<d\2070\257k\222\001"
+	.text
+	.section	.gnu.lto_isSynced.26.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"%\007"
+	.string	"\002\01635Po\322\030 ;\003\214\270\215\330\213\371\206C\221\004\220\210\rk\365\ntX\004\311;\2623\033\213\204\273\315G\304\222\224R[\344U\225c\235Z\333\210\264\275e\n\230\214\013\234A\036\353\n5`2Z\022\037\b\353\252\034`\254`D\365\tA\220\274\240\247s\264\036$\304b\224\360\271\232\331\267\255\032\325\241x\025?E\356u\274fvw\177\333;\206\226\027\227\202\322\356(\006fY&\025\220?{\316\357\334\253\210\216dJ2\241"
+	.string	"\273\333J\312\3564\030ntz\252"
+	.string	"\245\323F\003(\235\376\017\020\2625\235\037#\215\305\306\205\311\313\356\204\317C5u\332\252%:\020\202\302Q:!\211\324i\024vw\207A\312\320\237\376\004\177\302\257\021\007"
+	.ascii	"\265\311B\241\301\3143\227\225\235t\r\201\354\020\361u\315'"
+	.text
+	.section	.gnu.lto_resync.27.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`N\002E\023"
+	.string	"\226\344\177H\300\322Q:r:\323\263P\020\261(y\362\2770\216\260\035AY\f\320z\027\377;\2658\021\272\217pI\026\353\351K\027\306?z\013\224\213>\327J\305\301Qp\240x\252\031\216"
+	.string	"f\233\2017\n\236\321\n5\2647\3312\245e"
+	.string	"e"
+	.string	"o"
+	.ascii	"\227n\340\032\233uy\226\355\253\375\241\023\335\316\263y\311"
+	.ascii	"\356\216\251i7\\\340\326\352\322\341\t\314\313\325\005\314K\337"
+	.ascii	"\354\036\017\2016\344G\205N\322ow[1\305o\007\243\336\374\027"
+	.ascii	"]$\247\2739\b\342\021<\260+1\005@\207\003Mr@\351\274w\355\240"
+	.ascii	"\313Q\ry\260\273\326\234\356\303-o{\202\355\b\266\276\bS<\034"
+	.ascii	"\255\262C\234\306\037\373\340\356\256\343\316\236\352\221\363"
+	.ascii	"\376\325T\317\251\226R\rNu\234j\225\352\007P\033=?+\342\216p"
+	.ascii	"w\252~,\224\364\261x\322o\3377z\257\346K\216FQ\277\335=\214'"
+	.ascii	"\371JFI\271\321<\264\f\321\302ghwi|$\243\244\320\374\310fr\023"
+	.ascii	"\356\016\203\021\341\320o\227'A\0172\206\025}ne^\216D\021DB="
+	.ascii	"6\205\200@\351J\302\203\t\037\"\236\031m\226?\031\370k\3128\301"
+	.ascii	"([^\303\007F\022\337\223\020/F\333\365\246\327jwU\374\03110\003"
+	.ascii	"\200\202l\346\245\002\311\371 \371kj\2141\352\340\340\203\323"
+	.ascii	"*?j\274N\020\303.#\303j7G\305\217q\246\230\037ti\231\214>'3/"
+	.ascii	"\037I|N\001\340_b.\227\r\2659C\223Q`\331u2\253\305Xfh\262\231"
+	.ascii	"\255E\303\254\006{i\311`\255\030XK\254\345\242\325Z'&\226\315"
+	.ascii	"`h\255\031\231\214\326b\2058\0077\356\212.\301\tjJ\n'\342l\003"
+	.ascii	"wQ8(\221:\002\013\250\202\177\351J\025DhD\375rwq;M\277g\341\202"
+	.ascii	">\347\031oNu\242\252\027\375\232#\321\005\211G\216R\331\277q"
+	.ascii	"\034/\007* `\2021\202\220\036\266\227E\266\207d\333\323\007P"
+	.ascii	"`pi\261p\251\1777V\200\300\032\206\220\2231\\6\340\223\"\377"
+	.ascii	"\t\242\2438\005\246\322\003\266y\031\355\341v\341\305`fvd\257"
+	.ascii	"\302\362M\253-+\203?\301>\316\304\201\341\013\007?/@\255\201"
+	.ascii	"\227\246&\264,@\030#\022\2619O\313-\317\b9\245\020{"
+	.text
+	.section	.gnu.lto_txBytesFree.28.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\215\007"
+	.string	"\322\31645Pm\323\001d\254*\032\212\200bi\327\320\370(\\)\264Y\276\201\371\263\321\b\372\\\2322\253f\027\357\350h2H\242\3262\343\334\246\327\321\344\355\267-wJ\001\230%\021$k0\325\265I\300,Yq2\f\325E)DI\305\006*\263\211\032\353\212\230\311\262Z\260\"&\245\025\245\271\267\352\004\241\035G\317v\340\274s\252SG7{nO?\366\341\356\256\325c\205\227\020\t\301\307\256\304\211\311\216D!\027\2663[\262\375\236\375\215sd\237\017\007\330\365\224\200\354\316\002G\313#O\213m?\343\032\23158+\272\313\007\024\341\021\332\235q\272"
+	.string	"\345\021|"
+	.string	"\345\221R\\\373\323\374w\034\202,D\270n\373\253\034\354\256\037\327M\334z\333\003\266\rlc\004\n"
+	.ascii	"\266\231E\246m`\304U\335\321eT\242\301:0\361\340\256\221j\305"
+	.ascii	"$L2"
+	.text
+	.section	.gnu.lto_mspDisplayPortVTable.29.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"]\006"
+	.string	"\344\n\324"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\212\001\202\200\200\374\342\203\355\302\005\177}\370\354\222\005{y\270\354\362\003wu\370\347\242\005sq\270\347\322\007{o\370\346\242\005mk\270\346\302\005ig\370\345\262\005ec\230\345\002sa\344\302\005s_\270\344\202\005s]\337\322\003s["
+	.string	"?\202\210\200\340\001YW\306\001U\305\001S\304\001Q\303\001O\302\001M\301\001K\300\001I\277\001G\276\001E\275\001C\274\001A\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\f"
+	.string	"?K\001D\373,\032\220\002H\001\244"
+	.string	"R"
+	.string	")\200\224\230\244\230I\352"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_displayPortMspInit.30.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"m\t"
+	.string	"\226\020?:0%'\035\200\351\017\006\250B#s\177{\034\243wF\307\030\013\360@uCR\030\337\222\3362\302\267D\032\213\017\251\230\352\303\300 %EW1\317\304\033\r\3214D6\331;\245+"
+	.string	"0"
+	.string	"-"
+	.string	"\027\255\233]\220\032|\001\366\3119\001\366)9~z<\371'\371\025\362\361\362\251\274\307\200\205\335u\374T\253[\336v\202m\217\375\203\245\211\370\317\221\245$LI\317\006\275(7\354_+5\354+\233\251Q\260\331\315\b"
+	.string	"`\303\031\003b\333dg\276\310GL>\031\200\035\253N\212&0a\205\364\334\211g=E\304\331\265@y+tU\021&\302>\317\372\t\211\263\213\372\347\2037\351|\217OK\220\342\277O\237\204}\332\001\006y\266.\3040\342\352V\372@l\235\326@\253F#\264O\210\202\270\216z\020\\7\007\216\216j\345h\006\356]Z\0060dB\224\244\260\300\212\312\203\226\005\023"
+	.ascii	"2\003\3020\323\302\270&0`\210\245\344\244b\0071[\201-\030\306"
+	.ascii	"\005\013\300\036hn\217\302\3335\261\032!\264\020\231\270+\246"
+	.ascii	"v\222\001"
+	.text
+	.section	.gnu.lto_output.part.0.37.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`o\001E\016"
+	.string	"\026\232ZC \217\223\016K\030tj$\304\220;\r\276t\355\221H\002(\204g\334D\300k\031*\026m(\262h\337\n\254\231\fR\244'\376-Ta\252\331\220\267'\030x\037\234\271A\032\004\323\264\"\236\354-eJ\001E"
+	.string	"L"
+	.string	"D"
+	.string	"\216\326\241}\022\241\022\333\276\210\217\340\354\227\327\201(-H1:\261\330\335x\210}@u\370.\240:\324\017\347\256\3718?I%\321\365\251\033@\255 \2254</\376"
+	.ascii	"l\354\256\255\r7\274m\006\266\035\330G\021\206,\240\007\3305"
+	.ascii	"\2554\2608\373R9j\217\362\313\323\354\210\007\023\227\335U\360"
+	.ascii	"\362\247P\267\031^\332/\361\024\356&(\020\320\354H\n\206\004"
+	.ascii	"\235e\315w\316\320\b\035%\344\335\222\224X\323\316\320\340\216"
+	.ascii	"\022b\3355Q\341\262\333!8\fOUS\355\t\236<\t*6R\221\257\251O="
+	.ascii	"3j!\2221\251'\326\367\267jr\245ix\225\377\375\364\253\246\363"
+	.ascii	"\335\377\314\013\300\354\222\304\300l\007x\"\304[n\177%\344\247"
+	.ascii	"|\265\260\2000\021\207\003\207\001\237-{p\201x|\250\004P\004"
+	.ascii	"\355\350l\324\033\f\315\323\201\360\3312\255\002\307\207\346"
+	.ascii	"\341t\304\214\023A8\034\235\270\331<\021\003s\246yl\361\223e"
+	.ascii	"[\274l\347\325\344\247~\221P+\275`\273Ro\210\250\005\325\023"
+	.ascii	"\333\231\364\263*' p\002!#\353\001.\236!\003\306(\236\350\221"
+	.ascii	"\207\021\376\030\201\305\310&FQ\243\031\n\f\220\314\326\030\265"
+	.ascii	"\366\355\227\250\003\265!RF\204\357p_\f\036\354\332\331\236\r"
+	.ascii	"ZO\255\335\f#\372&\327@\200\003I\204\306q\254\254\006\311\027"
+	.ascii	"\271\0204\257p[x\2362}\376\265a\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`\314\001\345\b"
+	.string	"\364\013\310\002"
+	.string	""
+	.string	""
+	.string	"\002\026\177\024\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006\031\177\025\032\177\026\034\177\027%\177\030\271\200\202\202\200 \021\177\031\005!\032\022\177\033\002\025\177\034\033\177\035\005\013\036\201\204\001\024\177\037\023\177 \027\177!\030\177\"\036\177#\272\200\202\005\017\020\200\003\005\035\021\016$\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\f%\001 \177&\377\037"
+	.string	""
+	.string	"\200\200\200\001\"\177'$\177(#\177)\037\177*\003\003$\003\004\025D\003\005\004\310\377\241\372\001\001\202\001\003\007\b\t\007\003\013\001\003\f\r\027\r\026\244\006\003\r\242\007\003\016\r\302\001\003\017\030\017\tB"
+	.ascii	"+ \020\003\231\031r\0030\260\033\321o\f\375\310\304\003g\t\276"
+	.ascii	"\0072\310\371f}[\001\312Af\314\260z\004\207\200\303\t\304\371"
+	.ascii	"\245\261[0 \2773\032\202\317\314h#}\254\361\314\r<\306z\254\307"
+	.ascii	"\324\030c\213(\243\325du\220\335),\300\033\202\342\030\352\241"
+	.ascii	"\036Z\203f\231\023"
+	.text
+	.section	.gnu.lto_.refs.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375 i]\002"
+	.string	"rE\017\024\200\267\35130\0033"
+	.string	"\214h\024\370\244\327\376\273\021I2\005\022\256\007\223\277\270\274\003\033;\361\031=| I\332\323\356\330\245\005"
+	.string	"\217\321\030:\263\214\226\322\225\005!\206\271\261L-\004\004"
+	.ascii	" \204\236\267\300n\332\222\004"
+	.text
+	.section	.gnu.lto_.decls.a5d42874edee204f,"e",@progbits
+	.string	"(\265/\375`\324 5\226"
+	.ascii	"\352\361(5Q0\022\322I\007\363\275~\357\326N\200\260ln\356\325"
+	.ascii	"\345K\\@IP\314t\263\350F\227s&\357\036\f\025\221\345\240\253"
+	.ascii	"\346\376;\346\332\326\241\005\353\221\027\221FUeA\024QUUUE k"
+	.ascii	"\034%V&\200(\313\263\353\356\377\277\022I$[\312\024\316\002P"
+	.ascii	"\003G\003\320\276\374wv\303gg56\034}\343\\\003\b\305\327\307"
+	.ascii	"\342\037\352\313m\376\030\007\022%\027\236\024\247\201\254\357"
+	.ascii	"\035\353;j}?\255\3475\353yNMP\317\0317op|{\251\324\026\261-\235"
+	.ascii	"\236\367\2420\334\001~\242W\317\255\323\241\241\263\036\220J"
+	.ascii	"\305|\3363\261\277\261.\235\346A\311c\352u\212\367t\342\034M"
+	.ascii	"&O/\353Yx\341h\224)y`_~7\242i\351\201\023)jk\034\025sr\351\302"
+	.ascii	"Q\b\302\240\370\372\316\254p\032\3071%`r%\3579\306f>\366\336"
+	.ascii	"\2544\347\275\367\0076\303u\\\206\355\370\f\243a2|\307s\fe:\216"
+	.ascii	";\213\3411\017z\336\353\304arl\346\002\313\275\003\377\020\035"
+	.ascii	"\273q\030\216c>/\016\316\212\302Y\264p\232O\362y\247V\240A\361"
+	.ascii	"\335\201\025,\230\216}\340\350\210\246{\263"
+	.string	"\260~\224o\240\246\364\335\3734a\"\310\204\t\023&\272i\344JR\200\364,d\345 \266Z\177\016\303p9OB\264\224O\037-RN~\235B\371\215\301\3747\250\007\260\311\030V\256\307a=r}q\375\f\353\205+\b6\336\302P\022\334\366\374\351\001\204\002\370\327\351]X\317$T\016d\022\352UX\203@XK\2445_a,\3474F\343qzrZz\257\2229\001\037\346\004p\242J\224U\324\364\032\254\227`\025b\021*S\341*\f\r\342\262\257`q\233\244r\301\356\275?<\246I\352\252\323\263X\317d\037@yY\234g\335\341\006r\220\372^U\260\b\025\004\003\251.X\204\312`$\354\362F\363\236\335\373\f\361\363\264\212\022\322\351\237,B]\031H\375\271\354M\214Va\347\346\317\317\206\370\331\205\237O\370\031\206\237\211~F\341\347\024~.\372\371\205\237Y\370y\205\237U\370\271\205\237\215r"
+	.string	"\201\002\026C&J\374m\345g\2616%\374W\377\216\376n~\356\373\371~\200\277\377\206[~\345\277\375{\355\347\r8"
+	.string	"\340:\277\335aS&\217\205\234\213\370m\316\377\273\377r_\377\326\222C\267Q\3424\005m\270\317\337l~\256\201\361>\342g\343\177\275N\3633\223\237\277~~\362\263\327\317]?;\3719\n\232\237\257~\346\372\331\371\277\347\267w?\317\375\354\366\263\331\317\317\237\247\374,\345\347\345\3173~v\372\271\351g\345\317\311\237u\3709\207\237q\370\371\206\237m\3709\306\3173\374<\3749\351g\244\237\355\177\274\237\217~F\340g\237\237I\374l\300\177\023~\026\361\277\355\347"
+	.string	"~\006\372\371\347g\235\237\323\237\373?\337\377\275\377y\377\301\376\237\370\357\366?D```\340\237\346\360\247=?\001\021\004d\312\252\020K2\255\252K\246uA\\'%U\r\247K\025\342\222i\245\271d\315*\020K\262f\325\222L\213\311tK9\275*\263f\220(\036[:]\251\250+%\025\210\270\345\263y\351\356\345\263\247K\245\300\275WM*:\345\016Vk\212\223jJS6\231\200\250\246 \315\353\024\267l\322\274\267IS\322\215z \371\214\273G8.)\344\352\336x\272\267\200\250{\223|\343\356\275\311{o\220\352\352yo\017\020KgT\324\275\314\240\250{\225\\{\272\267\317\352\324\252\226dA\232Cked\316K\343\231d\347\245\323\242Z\311\222c\367\306\275\227\367VgU\016=(\334@\316\320\006\322d<x\336$"
+	.ascii	"\3200\035'Z\216g\313mk\213\271\236\301\306\332\214\016\212\257"
+	.ascii	"\257\007%\315\344\313.\257\207\256vr\346y\326W\302\200\251u\224"
+	.ascii	"\0044Z\334\234\177\3035\227\026\323q\335\245\275\364\230\016"
+	.ascii	"\323n\375\245}\3507\2066\030\006\363\326\352 \017\002K\203sb"
+	.ascii	"ys\016ei'>\311\020\367\n\001\343\204\322bf\240\370\276\372\311"
+	.ascii	"\327\002uP|_\367>[H\203\351!\235\244\305\035\024\237\316\214"
+	.ascii	"'Y^\nH\333\244\354\354\262:\355\266\336\242\256\201)r\243S\241"
+	.ascii	"f\313qz^\262\234\271=\254\263\2515mZo\001\327\3335\353m\335z"
+	.ascii	"\033\346J\243\271\365Ma\323i\243\371DA\371R\243\315\254L\347"
+	.ascii	"M\216\f\031\350\273\354gj\371\244\323&\333\301BdM\252\323\256"
+	.ascii	"\342c\366\345\013H\247MeG\212\016+O:\353\347\311\037\324\334"
+	.ascii	"\331ZB,\314\207Mm\271d\312;l\207\316\252\214\226N\033\254\267"
+	.ascii	"~x4s\214u\332R\2028\270z\364\350\264\243pT\347\f\236\033\033"
+	.ascii	"Gq\202\254\261\323\022\266\336\036YU8\361R\317\320\272\3344y"
+	.ascii	"{=ZASG\232\375\301\204K\007\211\032#o\234o\256\243i6\271)`[\314"
+	.ascii	"\243\354\207\221\255%D\212\214\331\201\347\263e\316\206\016\346"
+	.ascii	"\372'\003%i$\353\2326O5}\344\215$\215\347\216`1~P5m\344\177\216"
+	.ascii	"\217\230\033L|\030)\022\024\023E\311\037^\320\353H\026\233"
+	.string	"&\302qA\032:\356\272:\275\235Z\257\306@\252z\343\374~\234\241\375\243\235\204\2367\331\002\234\225^\337\245\242:\361F\313\302\222\242\203H\0179k\177^<t\332>\3249\252\300\247N\337R\326\336\321L\206v\217\277yp\226\247T\232\227\354\336g\217UZ\275i\3514\025R\177X\310\212\243-\367v\243\251\323'\317\324T\222\246\216\034\252\331\226*\316N\3379\376\306\301\\z\n\206{\237*\2201%\321N\233\201\324\025C\357*\365\253\rH\033hSMm\340\304\307\231N;\252\245\336S}\243\247\036h\336\253\354\251\0377\367*\177\230\023`N \215\022d\013MM\337N\240\332\206\330\221%e:}\333\370{\3315\234t\254\230{m\2356\025\213P\025` \265\237\206\3364p\352\352\366\344:M\200\201f\264S\027T\035_\247xA)\3740%\246\233\3722\231\247\350\r.}n\374\374\240\370\372"
+	.string	"9\260\225\374\246\223\034l\307K\0333re\327\340\202\3105uj\263X-\f\275\233U\273\017\033\r+nj\353w\340\273\251\366\312m\332\237\223\303\2265D\353\f\355\317\t\242\315\371pVY\037\004\243b\251X\263\240\365N\t\322\227\327\003\355\342\203\331e\267f\3120x5:\265P\216\256a6\236\260uj\311\332\312\202]\235\205uj\253\334R\301\362%\354J'\212\t\021\036\235>\270d\275\230\230}\0065\223i\204\304\232~l}\3672\205\3242\274(E\236\266\356I\334\226\233)v\212M2\210{\203\360P\303@\251\006\215\230\325\332\270\345\301Pk\303J\t\032{&w\332\300P]\235P\227zen\247Q:m/\215\230\266\365\fve\261\316\344e\265\025X]\336\020[\304I\230\274\037me\306\331e\241\330/\353\3046\261O\030j\275\254\221\333\036\326\007\027\353e\233V\b\307\031\261"
+	.ascii	"\214.\317\313\036\261\\\034\307\004q\235\262\340\345\335{ulh"
+	.ascii	"\305a\371\244W\277\013\273sZ&\f\265\\g\226\313\"\261[;X\342\326"
+	.ascii	"P\021`\242G\217\f\235\017u\313.I{\026\331\353\324*\t2w\270\315"
+	.ascii	"h\222\204\241\266\207U\315\327\332\337]\027$A\270\326\253"
+	.ascii	"I\326\253YD\3262yXp\314\365\252\216\325\002\261Z\fe\300\0069"
+	.ascii	"\216\362y\237\235\344\215\225*\235^\205Z\317\f\25060\220\031"
+	.ascii	"P\257>\255\307\001\\\217\323f\375-\226\025\016\331\027>85k\013"
+	.ascii	"\361`wXf\0245\"W\356\326\333\021\220\204\271\362\250js\334\352"
+	.ascii	"\370s\332m\313\031E\267\336VY\034tK\254\214\305\255\267TW\002"
+	.ascii	"\371xtj\247\326'\0346\006t\260\262\374\260S\277\215\262R=uC\340"
+	.ascii	"\0336\235\236\216E\250=\f\244Z\250\241\333\033;p\\\362\304:\345"
+	.ascii	"\301\351\2624,\r\273\324\231\361\306\024\352\266(~]Ws\273\354"
+	.ascii	"-;,'\320\346\n\005J\207\271\031\033\3532\037\234Y\262\264\327"
+	.ascii	"z\215`\301\262\025x\206v\240M2\030\346\t\037(^`\222N\355\355"
+	.ascii	"/\347\234\017\235\036\007j}\212fU\242\244\271\326!G\254\364\372"
+	.ascii	"\322\322\302\264hi\257v\006\315\232|\344\371A\333\217\243A\353"
+	.ascii	"\005S3\223w\257\227\023\301\27004WskWW{\201\270Mr5\234\227Ie"
+	.ascii	"\327{v\315F\275\227\237\315)\2525o6=pc\236\360:m5|ww\255\267"
+	.ascii	"&\357\265k\275\350\232\223\271)\235v^o\251]\222=\314:m<\216Z"
+	.ascii	"\247\230\272#\2356\232\266\352\211\342R\232=\345aM\312[\230\365"
+	.ascii	"\351\332\252\246\326m\253\316\220\257!C||}5\022f^[&\312J\357"
+	.ascii	"\3532u\b\275\347\372\207\367\331\317\032\315\203{o\260)\215I"
+	.ascii	"%\364\367\257^%\325\275\027\007\316\363R5\361\250\214\303,\364"
+	.ascii	"\367\260e"
+	.string	"\005\376\247\367\022\020\302\275\311\264&\337\332\245E\351\243\323{\234\270{\235\264\222\026hU9i\355X\222i\335\244\323\222d\b\252\253\225\\\222\335\033\342:9%5h\336\020K\262[ug\214\251\342\373\324J^\247\346\rq\235\256\262\304\322I\253j\031\310!\361\203\035\241\221I\311\210<\252OBqL!<bR2\"\016S\030\217L)\004PRb\"\022\213\304 \222H\215Q4&!\213\304\240\fEB\245T\306\222\021\f!\f5\351\310D\302\221h\351\bc\204\tJEC\243\360\205\214\245b\006\005 \237\204\002i)\005\322\022\220\021\221\211\003\244\360\270C\224\241\221\302\243\320\210s$BZ\342A\022\021\221\226p\210HK\026I\324b\350\206\3411=:*\n\312X*\032\245F\344\222=\022\022\221\206JE\301#\341\221)=\006o$BZB\321#\303\210<\016\221\204%\034\200\034\022?X:\212"
+	.string	""
+	.string	"\022\206\020y\224\361\202h\351(\302\b\341QQ\204\241\222QPU\201\002i,ZB\201dZB2\025{n44\n\211B\244\365\017\264h\240\205\013\033\202w\001\201\n\bT\250w\001\301\320\020\004-\206\326\267\030\262H$\321\n\007V\241\320\310\301Q\210\224\201\201\r\310\235Tx,\022*\t\215\301\235\0271\212\214G:\302\033\206/t\220\210C#\362\305\216\261()\003!rh\214\221s<\n\215HE#\t\304\017\214B\031\216\304\"\243\t\307a"
+	.ascii	"\310\"a\fHc\2210)\307\210(\343(4\252GB#\242\214\027\307\341\032"
+	.ascii	"\300K\b\211\210\305!\322Hh\034j\260t\204\341c,J2J\217DB\245\241"
+	.ascii	"\fE#\t\001(\025\215r\220G\246\031\216.\210Q4\346 \215\302\032"
+	.ascii	"\210C\225\006\243\"\245\030~\216G!\021\231\20444b D\016\223b"
+	.ascii	"\374 \237\204\342h\024\32604\036\221xqIhL\201,\026\215)v\220"
+	.ascii	"D\246b\0061\024\031\221r\216D=G\"\024\220\306\"\t@B\245\030\212"
+	.ascii	"L\250A\025\032\rk\020\036\251\307\030EczT*\032\245*0\005W8\026"
+	.ascii	"\227R\242Ph4:*)1q <2\365(\025\213\030\020\341\034\t\215EB%\243"
+	.ascii	" \222\310\005\2228T?4\224A\211\023F\350`5B\261t\204A\2044\026"
+	.ascii	"\227d\024)-\035\207G)\212\303\024\304a\021\214\024F\306c\n\024"
+	.ascii	"\b\304(\226`,\036\215LF9\200\326\254\307\311&\311\334"
+	.string	"\233&\243\002\342Hnqc\357\032\213k\r\324\337\322\n\360\317\372\331g\215,4\177\235\246M_r\\\261\271\355\323\263\002\342\243S\253\306\256y\342D3\363;4]vl{\226\357F\234V\266t\372<\252\276&}uznA))\177D\322\3309\265)\261\262<6Un\024\351j\274\244u\312\262\262\244S\272\237\316\3361\225;\305U\220@\361\3655\\\024@,v\267w<`~I \235\3323\275\025|R\361xR\367,\347\021\257:k\306\347\213\222\254\035-\267Z1#\207\325\351W\345\333\255\2307;g\365Vf3\231f\202h_\017\226\036P\232cn\347n\313\254`a\327\244\242Zk:\265d|\230olyr\326K\327\020\262\006V*VUU6\3566-,\372$\327\251\rs\213FD*n\f\334\237\303\223\246\007+$o\326\007\327X\271\305b\305\272Y9\236\233\244r\247\202W\276"
+	.ascii	"\001\373\356\222)\344\003\205\2475\244\355\326\355\366\313\n"
+	.ascii	"\026\277#\022)+\353\324\372p\353\345\310^\331\262\213\365\302"
+	.ascii	"e\227\006\330e\265\\\032h,? n\242F\306(\361\352\264\267\374\256"
+	.ascii	"\243\330\274\260:\265\001\202\247\250B\3518I\342\024C\b\221\210"
+	.ascii	"\310\2144I:R\n\020\004\203Q \310)>\022 %=P2&\311\214$IA\235\312"
+	.ascii	"\316\034\244.\2501#\021\006\255\211\217z\233\rq\224\310f\204"
+	.ascii	"\322\236\302\326\005~\213X\204E>\030\352v&1\325Z\237\177\023"
+	.ascii	"\271\224\341"
+	.string	"(L\033V\201 \204\346\301\210\261\324\026\003\n\206\263\275_\305B\227\311\013\265\323w\211\335?\025\033RQ`\303\355@\332\317\376\206=\313\021j\256\b\t\357f\232\340\310TW\332\037\204g\245*0j\313\351\305\242\342\025u\271\037Wa \303t\354d5\371`\006\345\255\237\253\303\031\300\005!Yq\370\251K\243.\021\255[\007\265F,\322\344\333\036]Ev,n\223U\272\364\300\370&\212+}\244\204\315i;f\212\177P\240\005\365g\207\324\003\\\340d\273\205D\367X\361]lf\245\237\021@b.\213\367\030\226\365?\373L\326\224r\352k\031u\245+\317\254\337\023\370\326\353\363\035\340\224\346\347\034\327\035p\007\202{\352\205\333\246k\312\327\206sW\264Y\334 $7\\\006\277\225\021\310'\304\217&<\t\302G\215c!\017&9\354D\005\237\231\034d.\205\317\356\f\344y\nn\242\255\346\222j\334\006"
+	.string	"d\032\376\327h\334\377B\233\200\247\375a\"\241\373\026\311\251\311Q\272M<\327\232\217\371\222hR\223&D\262\rN\267\231\233\342$*\3719\325\007\233\200p\252\235\264\200\r\361\320\307qc[\243\220\305\200\265\217\337\374\036\272{\323\210\265k\006A\354q\302\345\037\375d\004\220\004\360!\226\007\343%\261\250\0208\177G\241D\336\356A\247\356\265\002\301\247\361;\336\203u\201\342\355Bq\261\341|8\266\213\310"
+	.ascii	"\037\317\211;U4\331\212\376\222{\036S\356\206\304O\273\r\374"
+	.ascii	"K\261w\264\373\377\257\234\322f\307k \303\035\025\2170\306\256"
+	.ascii	"\naE\314\320\217\006\252\346\306-\302\244\032\321\243\037q6\314"
+	.ascii	"\335xkx\377A\303\206G\"\204\345|e\326\233w\021\035\020$\027C"
+	.ascii	"\231m\275\016&\314I\305c\003+ \304\0168\266\327\013\364\245\221"
+	.ascii	"\275\230\272X\004\345p\367"
+	.string	"\221Y\211\335\205O5"
+	.string	"\371\226\364\333\276\331-\334q\035\003\004B\030H\271\224\032\3460\271I95-\233`ia,\0327\031\364\307r"
+	.string	"\252!\257\345\205;9\360\247\030hBr\024\231\303\n_D.\354E6\360.\233\"\265),\357\240\264h.\\<\234-\003H\343\005\346\032\020\315\243\td\307\025\306e\343&\310z\013Y^\325\366\177\362h\001\3478\025\334\345N]D\003\346\323\225TXz\303\242\237\003\265\222|\023\227\346\006\361\005\321dFk\036\222P\352\324\020\274\207\rV6\340\337\017\213!\232\020\306\306v\336W@\002E@\020A\b\024\"\310\331\314?=I\206<3\325\262\r\370\034\336\327\216\240\265\367cg\304\0254\307\340\3072\001\364\020\200\323\363\211\273\003"
+	.ascii	"Ws&\370\036yP\235\035\322}h\007r\371\300\020\272\370o,\026T\326"
+	.ascii	"\037\356e<\231\213\340\273s@\223\316C\236\3177\314\243\276\222"
+	.ascii	"\347\t\222\313\250!7\0312=\343\032\"\232\326%P\"\225\236|\177"
+	.ascii	"\314\363{\365\003P\001\340$H\213\236,"
+	.string	"\302\256\314R:1\227\215\021\013'\226]|\350 \262t\355Y$\252\240Hj\372\312\250\345\250\036\371\323\326\341F\351\311W\3103\277\363\316^M`\204\177\206\357)\263\036n\227\224\r\372\353&\326\310x\374\034\032\265L\315\354\364\020\303\016\357\305\343\306d\004H\017\266\207\036\253Afrz\246\301\245\304\242\254'\204^\202(\030\271\001\006\343\f$l\343!1\350\354\206v\242E?\243\3607\332\235A\300w\013\275\303\001L\362\033\212\231\255\273\033\355\360\024\213\274\020\032z\223\206\022g\266oT'm:\357+\t\351\352\342@UT>\277\005\f\253 \215\033\023\350\2009\200\374-\322WHT\210\251\023<\230\202\300\214%\276\0333\374\312\001t\201\214e\016\0038\377\374$\233\335\303\225\306K\247A.\346\333c\367\002S\374\n\250\230yq`\016\327J\250V!\224\330\\\020\300\370u\022H\327\230\023\213\377C\355\323"
+	.string	"D\320\362\277@|\243v\tb\020\036\002\300K<N\210p\243qc\242\nu\005\032T\376\"Hp\2161\341\0335\276\200\217\362U\313z\3436\004\200#+\025z\213\007\200\200\345\034\257\357"
+	.ascii	"\340\346\006\220\313\007_\327\333\017\006\234\255\233\235\326"
+	.ascii	"\366\2679\035\217\265\316/\315g\277#\177\200\262\r?\230;\263"
+	.ascii	"o\362'dG\271\277V\365\234\311H\177\211\314\316\335#_n\3327\300"
+	.ascii	"\374\201t\033\373\360u\013\223\336\370\352\027\304\035\333K\217"
+	.ascii	"\177\371\271\032|\017\\I\330\362\274\342\336\202\025\227\232"
+	.ascii	".\344\242hV\274z\247\345\017\0258\245\362\003\371\017g>\347i"
+	.ascii	">\264\331?>[\216\330\330{\375\375\230\274\177\376\036\226y\211"
+	.ascii	"\214\200\231\262\ru|\260\221\343\201\t\023\353\311V\240F|lZ'"
+	.ascii	"\240\350\b\274\375\347\201_\365n^\310\016\342\335\374S8\334z"
+	.ascii	"a\377\352\3274\247\331\227\016\257\3421\370\003\027\361\237N"
+	.ascii	"\352\332\354\205\305\307\020j\005"
+	.text
+	.section	.gnu.lto_.symtab.a5d42874edee204f,"e",@progbits
+	.string	"displayPortProfileMsp_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"displayPortMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"displayPortProfileMsp_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"displayPortProfileMsp_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a5d42874edee204f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
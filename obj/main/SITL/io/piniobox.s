@@ -0,0 +1,348 @@
+	.file	"piniobox.c"
+	.section	.gnu.lto_.profile.c7eb785987b34db4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c7eb785987b34db4,"e",@progbits
+	.string	"(\265/\375 2}\001"
+	.string	"\204\002&"
+	.string	"\003"
+	.string	"\367\344\223\371\001\006\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002"
+	.string	"\002\003\001\240\342\234\212\n\002\331\277\377\371\017\002\002"
+	.string	"\002\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.c7eb785987b34db4,"e",@progbits
+	.string	"(\265/\375 &\365"
+	.string	""
+	.string	"\240\032"
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\005\001\001"
+	.string	"\002\001\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	")\201U\302\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.c7eb785987b34db4,"e",@progbits
+	.string	"(\265/\375 t\325\002"
+	.string	"\224\004h"
+	.string	"\002"
+	.string	""
+	.string	"\020\332\314\231\353\002i\001"
+	.string	""
+	.string	"\002\023\303\231\263\266\002h"
+	.string	""
+	.string	"\007\367\377\377\377\003d\002"
+	.string	""
+	.string	"\003\f\001"
+	.string	""
+	.string	"\001\220N"
+	.string	"\002"
+	.string	"\020\314\277\331\273\016\357\377\377\337\003g"
+	.string	""
+	.string	"\006\200\200\200\200\002\002\220N"
+	.string	"\220N"
+	.string	"\005"
+	.ascii	"\\m\0058\025Tc\037*\344\r\264\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c7eb785987b34db4,"e",@progbits
+	.string	"(\265/\375 c-\002"
+	.string	"t\003W"
+	.string	"\002"
+	.string	"\001\001\003"
+	.string	"\002\001\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\001\377\001"
+	.string	"\002\001\001"
+	.string	""
+	.string	"\002\004\004\007\001\002\001+\006\325"
+	.string	"\001\001"
+	.string	"\001\002\006(\001"
+	.string	"\006(\001\376\001"
+	.string	"\004"
+	.ascii	"Y\035|\323\034qn\267\001,"
+	.text
+	.section	.gnu.lto_.pureconst.c7eb785987b34db4,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\231\004\002\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c7eb785987b34db4,"e",@progbits
+	.string	"(\265/\375 =m\001"
+	.string	"\3601"
+	.string	"\002"
+	.string	"\001\024"
+	.string	""
+	.string	""
+	.string	"\002\002\005"
+	.string	"\001"
+	.string	""
+	.string	"\001\b\177\002\006\002\007\001\001\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"0k\364\214\361\022\004J\250\033h\003"
+	.text
+	.section	.gnu.lto_.lto.c7eb785987b34db4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinioBoxInit.17.c7eb785987b34db4,"e",@progbits
+	.string	"(\265/\375`R\002]\024"
+	.string	"v&\207I\260\022R:\"\307\212\031\372B\216"
+	.string	"\f?\201\324\357\202\272\276\302\226{p\370\215\367/l\376\026)\031\373\356V\253\263\3165\007\fi_=6\2310\364\037\364P\016\210\265\235G\\%\320\267<\024\n\255\252\337\366\t\331R\246\024q"
+	.string	"l"
+	.string	"x"
+	.ascii	"\275\004F\320z\350\336M\304\207\255\227\210\017M\263{\b\330\201"
+	.ascii	"Q\361$\375\230s\306V\310\362\262w\213J;K\f\345*\315G\272\376"
+	.ascii	"\370\300\345t\316\2220`\021\020I\216G*\3201\001\377\263\251H"
+	.ascii	"\364\363\360\2253q)KtL@\222\334\216L\001\026\001}\351\332\223"
+	.ascii	"\273\351\376w\225r\302\345~\256\254\2269\247\025\227+q\267n\333"
+	.ascii	"\307\266\003[A\004vOGw\007,\322=yw6,T\277\256t\273~\364\263B"
+	.ascii	"\265\274\357^\251\326U\177d\004h\342cN\022A!\263*\204Zq\245\337"
+	.ascii	"g?\311_R\302i\261\211\2400eu5g\257A\353=\377g\221\207\366\213"
+	.ascii	"\303\240\335\347(9cH0\342q5\347Dyh\006\255\207'\362\"\266\257"
+	.ascii	"\366\215\356\202\366\243\234\003\230s\227\343i\316\266p\033\027"
+	.ascii	"\b\f\3159Wj\034\n\2033\270\350q.\342\303\224\024'j\032\224!\314"
+	.ascii	"\235d\374\246\0161\013^\353:\252i\360\0324\345\203$\227g\034"
+	.ascii	"\321\265\241\257\310guS \206\251\256-\343\240\307\271\366\344"
+	.ascii	"\266:\376\352\256\016\236!\366\3544d\33644\347\215\305\036?\303"
+	.ascii	"Ck\316\333\212\f\032\233\007;T<\364s\366K/\200\202E\013\250\232"
+	.ascii	"\006W\307\004$\332\345\005\263\361ee\337 \32303F\230\215\020"
+	.ascii	"H\f\2432\033_F\331\214\214&6\312b32\027\231\030L\215MLe\200G"
+	.ascii	"\232\230\232\330\207q\254\211\211\364\346w\207\364\tTU\265\265"
+	.ascii	"\261\226g\026\216\020\266k\245(\337\355\221w\224\270\373\337"
+	.ascii	"\003\004\021R9\347\234\342\362\254\373\340o\304/\275\302\210"
+	.ascii	"&\371Z\271=v\312wa\373\337\017H9\205\b\262i\320ro\334\030`q,"
+	.ascii	" 0\002\202\030\274\033\177\362\004\001\273c\304w\360]\332\005"
+	.ascii	"\203=\321\315\204\304\332,\023\367\3057\204~q:3\353.\n\233\310"
+	.ascii	"\f\337\212\234\347\376\254\363\203\360\001\250G\350>\250\026"
+	.ascii	"N\267(HPs\234\302\220\244\305\216s\013\336\202\330'\227\213\335"
+	.ascii	"\372\351\256\201\210\375n\363\266\002\b\213\207\b\356P\305\340"
+	.ascii	"Gp\277\224\037\336\350\264\217\f"
+	.text
+	.section	.gnu.lto_pinioBoxUpdate.18.c7eb785987b34db4,"e",@progbits
+	.string	"(\265/\375`\262\001\245\020"
+	.string	"\326\037pF\360\320&\035S^lH\032\374\260W\253\377\232F\272\307\220\345\020\376b\363=\222\351\205q?\006[\375\346(2\242\345"
+	.string	"\255\037O\004/\253rPm\340\362`\003\013ABu\364Z\f\323\303\223\b\336\022\262\267\224)\005_"
+	.string	"W"
+	.string	"\\"
+	.ascii	"*\333\306\001\226\016\"\026\016\321\356r\252\302\3600vk\251\372"
+	.ascii	"\246E\250\251\362k\256\240\004O\353[}\203\035\262\031\023\036"
+	.ascii	"\037\013>p\355\310Z>\225\324\002\310\270<\2168\204\246\031A,"
+	.ascii	"\217\217\005&x\275\024\225\276\225\324\337<\201\204Z\237\313"
+	.ascii	"s\223\260\273\316\326\027\342&\3356\b\333\020\354\323\b\261U"
+	.ascii	"\352K6\343\352\261\276\354\322m\356\030\323\020\246U\323\231"
+	.ascii	"\351w8p1\300\263\373af\264A\321\207\305mn?\346\337\330\370\007"
+	.ascii	"\256\316\004\032\243\033\273\373\361h\021\322\343K\266\237\366"
+	.ascii	"i\336BuX\007\003\330M\001\353\331\21550\003\322\243\351\005\264"
+	.ascii	"Gx\002\332\243\003\026F\362-\233XteU\250\257\301:\362\310T\373"
+	.ascii	"\204!\337R5\255\350\312\327\324\215\004\016\326\321uN\270^\340"
+	.ascii	"\354\235vE\271\030Z\311\034(\207\321\201\304\354n\004;\303sJ"
+	.ascii	"\026\304\354\256\310\213\343x\376\212GkH\345[\217~J{\274\306"
+	.ascii	"\200\025\371\244\344L];2\031U\030;\335S\025N%\035\005\024\223"
+	.ascii	"\023\n\265\201D\200IB8x\027\274\316\244;\341\274\2163\351FJ8"
+	.ascii	"\022T\212\013A`\357\344\204\342P<\017\305\225b{}\325\234\224"
+	.ascii	"#\"(EU6\205\361&#\226T\207\362\343Q[\340\375\243E=\354pwW\003"
+	.ascii	"y\324\222n@B\036P\250\344,\343\200\204\032\325\016! P\202A*\351"
+	.ascii	"\006\342\200\3371n6\316\004\355\322\256\361\276\257\"T\324\030"
+	.ascii	"K\f\345\306\003Z\f\0022\261\270\004Ur\210\214\002c(6\320MnFW"
+	.ascii	"\034@\243x\254\342\006\fj\304\270\302\233e\260\210\3540jD&\336"
+	.ascii	"\342\276\021u;\027%\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c7eb785987b34db4,"e",@progbits
+	.string	"(\265/\375 \260m\003"
+	.string	"t\005\254"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\021\177\b\320\231\263\346"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\020\t\200\204\001"
+	.string	""
+	.string	"\003\002\022\177\n\001\023\177\013\377\037"
+	.string	""
+	.string	"\200\200\200\001\025\177\f\024\177\r\003"
+	.string	"\003\261\346\314\231\003\001d\003\002\005\237\231\233\310\001\001\204\001\003\002\004\304\001"
+	.string	"\007"
+	.ascii	"\270\f\003\324\316'\344\257K\201 \030.{\"\264\322\003"
+	.text
+	.section	.gnu.lto_.refs.c7eb785987b34db4,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001\001\007"
+	.string	"\001\002"
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c7eb785987b34db4,"e",@progbits
+	.string	"(\265/\375`\033\n\0357"
+	.ascii	"\312`0\025F`\246N\007\303\206o\201g\311\350I\317\364\005o\006"
+	.ascii	"\363i\327\272\035z \253!16;\304\354\030!{1|\001\216\3765*0,\371"
+	.ascii	"E\332 \362\341\027\313F\034\3765\224\264\331P\225%\036\366\311"
+	.ascii	"\260\332Z\022\231R#\0019\001;\001tIj\\\354X<K;\233_yg\303\300"
+	.ascii	"\376\247\316\366\273\363\237\376\334\035\270;\300M\274\210\234"
+	.ascii	"\365p\273z\266\377\031\224\346V|\322\322b\200]\\%\267?@\260\214"
+	.ascii	"h\271\270\213'\025g:\232\217\265\347\276\320\035Ds2?[p\374\357"
+	.ascii	"\322\361C\265H92\367\377@\"_\235\365\3270n\177\342P|\n\212\377"
+	.ascii	"\366\377\017\370\334d\311C.v)^\346L\006n\326\0262\364\016\035"
+	.ascii	"{\261\377\374\363\345a\222\207\356\342\356pv\2353\350y\033l\217"
+	.ascii	"2\240\267.\363\3778\004\371jr\361.\303\331\020\316\366\334@e"
+	.ascii	">C\337\263\201\027\350a'\335\036\346b\fv\252\025\373f\377Y\350"
+	.ascii	"\227m$\277.\356\354\005z\247\017\bp\240\333\205\272\335\200\367"
+	.ascii	"\272\335\327\326\335S\274@w\213qw\002\335\315\245\273\317\272"
+	.ascii	"}\200Yw\233\350\356\005\004\272\235M\267\013\350v\237n\277\335"
+	.ascii	"M\327\335t\272[\256\311tw\225\356v\353n4\335]\246\273\255t\267"
+	.ascii	"Xw\003u\367\227\356\336\325\325\325\325u\367[\267/\351>\227\002"
+	.ascii	"*\362\257\222[\351\032\324T3\373j\376\335L\352\327\007\377[\354"
+	.ascii	"\252&\275\341j\307\346\325\021-e=\377?\202\344\321\213}dSE\302"
+	.ascii	"\376#92}\022\003\232\233\377\303\233\350\327\326"
+	.string	"[I\375'\370\374\237\374G\375\233\377\217\376\177\317\272\225\377q\004\251`\311\344\377\022\230\374-tM\352\377\232\271\251)\325\326\213\r\256Ii\301~*\243\016\366j\272\326\263E\231o\365\377\036\347\004S\316\210\273\370\r\350b\254\336\344\221s\272\032_\343\314!w\003\200\314\337\2466\254\220as\266\017\365~>\224\246\r#\271!7\346\3426\347\342g@h~\245\021\227\253+h\234\351m~\206\b\370\363\265D\306\027\214\333\231\230)\003\324\276\205\225]L&#\377\037\350\363\202\207\306\362\210\030\017\343c\234\351M\367\322\376\305\30140\377#\271x\027\240\335\377\216&`\377\255\253u[\310\340M'\363.\336\\r\320\"\006\367\337\266\213u\007\233\276\346[\274\271\314\237E\"\214*n\356?\003\211\210\210|M\255\260\034'v\240\3178\363\017\026V\020\366\342\366\344\331\355[\264\204\321\350!$\213\001X\013\330\035"
+	.ascii	"\271;\340\261\rI\311z\270w\350\331w\356\304\323xn\352c\217\305"
+	.ascii	"\341l9tW\266%W\236\276\351E/\2338'r\027\275\177f\315U%!s\245"
+	.ascii	"\212`\371\250s/=)\027\235\333\024\236\327\234\26743u\3528\335"
+	.ascii	"\\\257\312\252\356h\247\235\016H\214\r\256\016\033$6 sYN\246"
+	.ascii	"\323\3616\300\017\353\027\270_W\t}\237\234\355n\374"
+	.string	"M;\\\303\271\334\031\364\307\2670p\277\\\016]:>t \345\264\313\265\233\237_\360\343*\343\272rq\313y\234\356\006\360\203G\255\314\352\306\211\023\002\245\354\253J\306O\320\210\350\270\230\351p|\254\273\237\227F\321B/\356[\344\354\276\335\275O\327\377\317\342\345_\217?\355<\367\241n\237\357\374Aw\343\377\b\315\377\036\254\234\363HZ\232\343\342\356n\360\335\377\250\320\347_\325\266\013U\243\224Q\n\345\347:\360\355\327\253\271K\211\331\277\237\337\037\331\245l\241fvU3\213\006=\222E\377\2632H5KQW\333.\245\332\262J\241G>\372m\312u\"Y\245\n\206U\006\251m\252T\221]J!\036\354\017&T@\322)\316\fB$\245\020Q\305\024=Bc\222\261\304\221Q\270\344k&\nPO\302\027\303'%\005,\212\305#$\236QX\342\034\001\343(\252x\244D\034\256  4&)9\235"
+	.string	"*`\034\022C\374\264\212\341\223\220(\\:\033\203\206\t\0326D\365\364\006\243\nF\025z\275\301(\0304\322\020<[Cpg\204:q\266\260ih$\272 q\300\330LHNPMPHJ!\242\212)xOIL*\260\260)IDT1E\217\221i\311\tA\027\235\204OE\306b\361\251\310\307\210\264\301H\034\272\350Q\na$\n\211IMOB'\037(\244\245\341\nb\321CT\361(\250\203A\017\rN\210"
+	.string	"q\252\240\020ULQ\034\022\207NE\305a\021q\230\324T\244\342\t\252\210\002pY\365K\003'\267v\343f\371\3404\231#\304\206\267\341i\321\241\273\252\221\372\026(Znn\227,\270\037j\027'\2237\013\310\356\334\300P\3059\035\231\222\270\253\354\233u\247\216I\204TY}K\332\264i]|\261"
+	.string	"\2608\310\322\"\367\252\361\030\353\333\2456\302\244]\334;\257\363\"\373\"o\025\220\335\275\241\341\330\341c&\216\033\326\245\352[E`\313\312\234\213\257\214f\363$k@\336\356\024U\026\226\035\027\337\251{\245\256\332w\352\306\370A\346;\025\200\304\250q,\210\220DJdDDD\2224\351\220\002\021)\253n\021`\255sjl\222$\313f\034"
+	.string	"\371\bp\216\325\231guZ<M\0221\306 1\337\235\3237\252\002 \325\224]\264\217rM\025\203\252\211\332\330pT6yQ\347O\007\246\225\373\357,Y\220\211\362\311\210c\211\021\002\272\004\230\021\305T%2\272\252\220\254\230\003"
+	.string	"&&!2\255_\266x\314\2154\326!\bw=\244wn\244\240c\202\224G\333\272\023\3325@\305L{I\031|\335t\273R\235\337\310\316_K\3658\f\022\252\340\330gp\202M7!$f\330\265\346\223U\374\346\300\272Bs\360\350\354\210S\037\200\022vl\2239(=\362\322\305r\021"
+	.ascii	"\bPb\347\255)A*\306\013(\307(1\001\214\214\022\031\230~\236F"
+	.ascii	"\365Y\272`\301]\\By\303R\300\377N\216'g\224l\031&\224\300\325"
+	.ascii	"\245\237\232\324\035\304Du*B\366\222L\321H\300\203\346/\3446"
+	.ascii	"6\370t\260\021$C\246\351\034X\222\340{\016\207\326\235\030G\316"
+	.ascii	"\251\374\313\026XD@VA\260\246@\233\341\b\357\327\336\3220\025"
+	.ascii	"3&b<=\365\213<D'\260\216\237\016(}\247\3034EE4\016\"S\346g\311"
+	.ascii	"\343\32463\200\220X\272\016S\213b\261\024^\251]\274\033] \001"
+	.ascii	"\252\007U\356^Xi\356\316\271\200/u}\330\013\375\021\357\f1\242"
+	.ascii	"_\314\225\234\341\276g\f\216\350h\177\300o\203\223\332\\\250"
+	.ascii	"\032"
+	.text
+	.section	.gnu.lto_.symtab.c7eb785987b34db4,"e",@progbits
+	.string	"pinioBoxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365"
+	.string	""
+	.string	""
+	.string	"pinioBoxUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"pinioSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"getBoxIdState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c7eb785987b34db4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
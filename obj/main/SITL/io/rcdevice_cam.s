@@ -0,0 +1,849 @@
+	.file	"rcdevice_cam.c"
+	.section	.gnu.lto_.profile.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"%\007"
+	.string	"\024\nY\001"
+	.string	"\021"
+	.string	"\310\373\320\361\004\004\002"
+	.string	"\002\001\002\002\002\002\001\343\233\320\335\b\002\213\326\277\344\004\003\202\270\367:\004\002\003\002\004\002\005\002\005\004\356\314\247\265\n\036\002\005\002\006\002\007\002\b\002\t\002\n\002"
+	.string	"\002"
+	.string	"\002\005\002\006\005\240\342\234\212\n\b\245\335\252\360\007\024\002"
+	.string	"\013\002\004\002\f\002\f\005\t\352\263\360\321\b\n\013\f\360\210\333\334\r\276\305\365\370\013\004\002\r\002\b\016\210\270\377\250\n\002\002\002\017\331\340\300\216\n,\016\002\017\021\342\211\217\225\007"
+	.string	"\022\306\316\263\207\004\005\002\006\023\240\342\234\212\n"
+	.string	"\035"
+	.string	"x\030?T\016@"
+	.string	""
+	.string	"8j\205\235\b7\003p\001\3545O\004P\230\213d\016r\005\2030\243\340XJ\213\236x\335\254}\211\330/\260\205\211\253\202\375$\361B"
+	.string	"\002\314$"
+	.string	"\"\031\b\260"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.ipa_sra.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375 \233\325\002"
+	.string	"\322D\r\023\300\2471{\357\377\177\353e\332n7Zj\333\250\2242\245\356\036\311\r\013\223\330=\177\372\310\306\fu\352\265R\331F/\320S~\340\320\227X\241z\333Wp\t\016"
+	.string	"+\003\202\""
+	.ascii	"\346\300\245\206\331\f\001w@m\260\002\241\244\316\214iA\224\331"
+	.ascii	"z\332x\261n\003m"
+	.text
+	.section	.gnu.lto_.inline.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375`'\003\355\020"
+	.string	"\266\331T? o\223t\001\251\347\212\0278\200\233\226\205y0k\365\240\234\315\"\266\345\350\301\302\020\202m\001yTK\036\021\377{?H\b\230\003\b\b C\203\002\214\272e\255\t\315>b\264'\277\021\271SA"
+	.string	"D"
+	.string	"@"
+	.ascii	"\"\035MBh\204\002c\rh\r\250\375\227\211z\324Tg\244\277=\255\327"
+	.ascii	"\343^A33K\371\255\342\310\001Q\204VA\336(\225J%\344p\003"
+	.string	"\250\001|B\016g\225\301m\364h\226\231\227\317x\032\020\325\324nE\002.@C\306\030y\241aC\201)D\215Z\332\377\321\017\020H$\314>.h\b\n*H\213xZ\003\302\251\327\350\023\247%&x\310(\367\335N\321\301S^\021;`\246!_\311\332\230\300e\032[\036\177Wr~\327\357\332\264\222\320\210\005bn\032\201\204I\346~\030\306\351\210\026'H\246\037\225\277\315\243^g\312\3736\357\327\311?%\311\314\3526\0213\326\266\\\025\233aU\221o\326\020\021\270{\324$31\226\255\374((3\251\253;*\002\201\341\0043\364\n\026\\\210>y\343z\237\201\023\205]_\330\330\246\205F)\262\216\371'\363\240\342( x\300Ym\260[\221\242\344\202\2001\236\346>\315.\335DfV\002_\250Q\275bHd(\214\244\260\220\351\200\"\2421\353\001\021\220\271CT\244\255L\233\001P\360\325\027\302"
+	.string	"\342\340I\246lNH~F&"
+	.ascii	"\n\363(-\020\312BwG $(U\241\333!\211\375\017\213\322\034\005"
+	.ascii	"\324Nf\245k\311L\263\210\262\032\261\267p\265\327X\021\313\017"
+	.ascii	"/\325[d\236\310\365\352\267\316[\236A\b7|m0\022\2339\214\376"
+	.ascii	"\274T>O\321DP\233\363\350\360\247\030\346\220\203v1\372'\220"
+	.ascii	"\266+\260\2224jD]\031\021\215\240\314`c\260\372\264\270\367\\"
+	.ascii	"\256\200k\345\013C\023\207\203\\\007\025\324\233%\270\340\254"
+	.ascii	"\327\263\341\016t\3168|4\230<\257\365\343\365\367\202\016\276"
+	.ascii	"yb\375B\275\"\325\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\345\005"
+	.string	"\202I\033 \240'\351\377\340\377\371\227?"
+	.string	""
+	.string	">BU\260\251\252\177\331\266F\316\371\263\337\377\372\275\355&2\311$U\225\246\355\033\210\374\334Hs\222\254\265\326\264\002I\270\361\214\007\216\031\206\334\242e9q\255\225\351\003\207\237K?\327\021%\273s/6RMe\265\236>\251\241{\350:\025L\023`\347\270s\035Y\325\"n\321\344)U\351)\340\217\037"
+	.ascii	"U\213\023\034\032\024\376\343\211@\024\004;\233\211\233\005\270"
+	.ascii	"\032^\001\335\327\004\021\225\002pn\337\006\324\031\002y@73\202"
+	.ascii	"\216\007\202d\240\t\032) \370\016\235\333S\331\200Y\200\246\001"
+	.ascii	"\335%\020U\306\243J\301\314\345\247\275\005p\003"
+	.text
+	.section	.gnu.lto_.pureconst.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\003\231\004\004\271\004\b\231\004\f\230\004\r\205\004"
+	.ascii	"\016\230\004\017\230\004\021\230\004\022\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375 \335\215\003"
+	.string	"\344\003\321"
+	.string	"\n"
+	.string	"\001\274\006"
+	.string	""
+	.string	""
+	.string	"\001\002\b\001\003\001\002\032"
+	.string	"\001\002\020"
+	.string	"\001"
+	.string	"\001"
+	.string	"\300\007  "
+	.string	"\001\002\033\004\034\002\b\001\024\033"
+	.string	"\f"
+	.string	"\r\002\002\035"
+	.string	"\001\002\036"
+	.string	""
+	.string	"\016\017\001\002\021\022"
+	.string	"\025"
+	.ascii	"\013c\200T\362p\022\020\\* \343\351\f)X\265\341\017V\266\005"
+	.ascii	"\344@\02663\325\314\003\026U\331\031e\301\3168\305\216g\263\335"
+	.ascii	"\2320h\003"
+	.text
+	.section	.gnu.lto_.lto.8fca22da23c335d2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_camDevice.33.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375 D!\002"
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\303\265=\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\035./src/main/io/rcdevice_cam.c"
+	.text
+	.section	.gnu.lto_rcdeviceIsEnabled.39.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\r\b"
+	.string	"B\21777@\217\322\001X\360d\r\220k\225\003\307\023\023\214\270\272\216b\352nw\037\323\267z\373\327\003}P\210\253K\320\330U\024\b\323\215\033\216\366\373)\341\2741B\266\224)\005\3262\033\215\346\260i\\\305\366\240y\261\343\"\004\247\331D\315\343\304\f\201\273\210\315\213\023]\347E\314\267\207\253)\250\005#%\331\367d\251P\241J)\205d\211\213x.\273\313\340\177\026\234\213\352\223\035K\rX=\344\253\217\2572E'o:\346w\262cW\201\225\214Q\276\354O\224\312a\037\256\246l\247\241\2463\323\307\022X.\226\201\326\356\351\325\262,\f\345\3036\310\306Xa\001\344\320?\217\3237.J$\256\335/j\307C\317\220\177\220\037h\224\214\264LP\242'@\303\356:M(\214[o\333\3006\202\355\223\f"
+	.ascii	"2CW\r\314d\202I\032\3331q\205\n\256\241\356s\rg\032\361\230\020"
+	.ascii	"$\334\271W;\237"
+	.text
+	.section	.gnu.lto_rcdeviceCameraControlProcess.40.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375`\305\t]0"
+	.string	":R\364\021D`^R\007\363\240P\255\023\216]\234"
+	.string	"\003\372*\343\007\037\016x\206\231u"
+	.string	"\b\n\324\334\224[l\022B\305#L\301\253\350\213\215\027\241d\230\005\340\230\313\325\221N\0053'\t\013\305\211Ub\233\354\275SJ)\022\001\361"
+	.ascii	"\021\001\367\336\036k\265\033\275\205\033\256\314\275\367\247"
+	.ascii	"\205;\r\215\215\313I\005,\334Y DP\266\264\252\275Pxk\\E\034\264"
+	.ascii	"}\205\373\254\311\272L\331f6\332\245\263]\223\022\231\273\327"
+	.ascii	"l\251Wf\320\366jl\"\333\253\332C\266W\346\033\314\277^\377\307"
+	.ascii	"Jf\2716\353\272<\256'\226\026\273{/\3233a\"W6\221h8$$\004\020"
+	.ascii	"\004\006\375|\275\226\307\256\352\273\222\233\327$\326\236\365"
+	.ascii	"G\n\267\226\265l\242*t\242>`:\321\022-\260\036\362\232\206xM"
+	.ascii	"B\302.\007\020\204\252!q`\220\021\266F\372\031\2438\233\270\217"
+	.ascii	"\210\367\276ZU\t\212\006H\2779\237*\221\r"
+	.string	"\027\235\2366R\024\347\020\347\035a\205[\316\"\2540\013\213\025\"m9\277T\326\307\345E\267\245\365\325\253\2524\347EO0+\207J\364\021\326\354\264+W\337\234^\2521K\373\216,+\377>k\245!]\256\360\331\322\002k\3475\335{\331\233YZ\315E\315\334j\314\214\201\271\r\013\352\367\0263\212\026C\325\240\353\336+\201\231kt\230\024Gq\356\275\024\2764\030\025\334`\275\262S\322\273\231\374\036\331\360\377;\255\327)D\270`\265\331\275W\375(S\261\376SR9V\336\207\201\036|\346\026P\336M\377 \232\230\233\325/\271\343t\025\333?|\237\346\2002\375\216\203\337\337Y:)k*\205K\013\204\303\357\376\336\273\374\2172\2331\275\357\275\227_\ts\2435/\371\234\225|\316I>gd\353|l\235\027\370\234\025\364\234\023\264\316\bZ\347\003>g\244\236\263\261u6\320:\037\031\371\234\213=\347"
+	.ascii	"\252sQK\233\207\252\263P\2335\007Yg`\3179\210u\376\265\316>\236"
+	.ascii	"sOun[g\036\317\231U\235\327"
+	.string	"\325Ye\235\177uv\325\271\033Xp\332\321\025\271\334\353\343\356\317u[\277<i\264ni\267Y?sO\321\260\275y\006q\235\364\315vd\221>\211\215?\364\0376\026\321~\224d%\220\370\030\277\331\316\374\220,\357\337K\032gl$\313>\357\213\200\260\236\t\234YiE)\346\335d\277\327$a\376\262\327@mv>#\266\250\367&\215\3536b\327/\242\353\272*\345\230\262LY\306\366\272:\027\036C?\276\332z\027X\003\357uH\366\350\r|q\232\241\353lh\357\265\222\300=\247\351p\350\340\301\273\351\201\355\365\350-\304\221\021\215\314\035i\217\254R\373\346}d\213\257\364\354XO\346\224?4\034\210\002S\026\321pH\020\337\204(\301\r\026\305\366Z\374\002M\310\270\337\272M\0247\030\2338\341\335<\301\366\032\340{\332C`\346\240c\317.\323\334\264t@l\0042f\205\267\206\333\215\345\032\3569"
+	.ascii	"\rw\032\226k7\3056n3,\327d\312\bh\033l\257d\330\316\363\336e"
+	.ascii	"C\275y\223z\r~\020-\215\333\225\007\272^\362\274\261*\364\376"
+	.ascii	"V[\bkB\327\356\322\001SRP3\234\\<\255hk<\261x\321\301ER\006\024"
+	.ascii	"\215\030?\250\346\244\203(\247\244\212\247$\324\214'\026\311"
+	.ascii	")&)(\246\027PNQL\311\251\030L\016\214X\n\306\323\024\223\f)\251"
+	.ascii	")\246\237\031\216\026k\reN>s8\236I\374(\003\327\206F\277zy\267"
+	.ascii	"u\360w\020\360(\255\022}\224m\260\3017\372>\353\006gS&\034\032"
+	.ascii	"\2249"
+	.string	"\306\207\037=Bud\341FR\024(\022!\016\036 \233=L\270\264\241\217\362\317\205\364\2041>\356*\326\273\304\302\204ng\205,\250\273\212]\372\035T,3\n\017\342@\374\007\220.\217\035\236\243\377>H\212\222\212w\223\215W\277t\006}o\351\177?\002JF\200\326\225\027\241\217\356i_\353\351\336\373z\302\217\342i\241;\335\276\220\363h{\270\001p|\257C\262\013\376\370\305i\006o\272\216\005A\344\267\232\332GV\301#?x\0165\026\341WU\02483\301\267Zw\220&j\200v\032\301{\035\222=\360\b\2768\315\340\367\356@\320G\003\200\304\250q4$\025D4#\"\222$\005\311p\260\002\021\242Z7\021P\245$\214\221\2206\205\264g\002\236\004\254\331\274\314\224\255>\312\322\300Q\035\244\031\374\217\345`WP\375\233$\304\231\254lE\224\357\313(\020m81`(r\205\223\224+\242\325\245"
+	.string	"\260536\221>\t\212\307F\272\006/\034(\353z~F\201\360\016\205\003T\033\345\334\351K!\214\234)\027\272U\013\371\374\006\277\355V}\022{\244\034\276\023I\372\3467\240\375^\030\363-\375\305\3017\027\033\265A\030\310\037\320\024\226N\034\345i\245\320t\rq.j\303\177\221"
+	.string	"\270\221p\\0\345?\362\306\215\333\346\021\352R?\351:\024\372\316\240gY\214\305k\217\356\375P\227)\305\275\343]\337\036\324\220T\267\263Ll\326\216G<\020\204d\203\3661\376\236\240_q\375FW\263\252\235r\243\362W\\\026\332\023<\300P\263\231\326\272\210\032\264\301\340\327\nbm\256\025\237\\N\215\227\316\354\201=T/\317\354]\330\375U"
+	.string	"\274+\006\267\252m\266Yg\030r\305\346\300T\217\311\bfAc\n;\035\007Z\037/\360\202\177\254\307\r\037\373\342\250\332\252\027e\315nd\235nh\243\301\253\003\274\016\267\376\177\204rM\034\037\306\257\302q\263\232\n\377(\252N"
+	.ascii	"\330\354\004\240M\362\205\2565Ns\201<\036e\241\202a\027\302\331"
+	.ascii	"\023\345\266\021\017F\305\204m\205^\276\274\365\007"
+	.text
+	.section	.gnu.lto_rcdeviceSimulationRespHandle.42.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\265\f"
+	.string	"\306WVC"
+	.string	"\2216\0358\253\2231\257P\200\253>;z\031\177L\233\201]\036\240nK\323\276h\314\305Z\312\366\366\021Ep8\230\206\221\340Vv\311^\265\376\377+\355z^c\001\024\261\2368&\252-m\"eJ\001D"
+	.string	"A"
+	.string	"B"
+	.string	"\216\361\357\303bD\030,\260\274\354nT\017\357\016)\315\316\337\360H\016\255\223S\nJQrq\302;\271R\007B-L\002x\036\212\243\205\003\214\223\236\027\274N&&\263\273\316\217\007\272\253\333^`;\332\307\002\207\232>\206\201\351E\206\201\323n\311\251\306\232 \213\020\376\210\257\210\374\263\202P\\\207\266\210}\035\376\262\375\264\237r\225\356\243\021\002\002\326S\312\240b\367K`\004\326\241\277sT\207\326\007T\207\356\034\371\317\307\312SD\211K(\305\345 >!\223:\244\272:(\275\360$\r\333 g\tQ\340\223\330P\260v\367(\207\376Hux=\351\251\301\304\024R\031q\362d\177\235T\221}jw\327\332\301\376\350\001\0256\230\032\353\320<\260\006\032,\233\240y\200qq\313b\204\314C\213\030\007\022;\nx\223\240\341\342f\333\270x}\234g8\332\201"
+	.string	"\022\252\235A\310\177|\3223\036%\311\0253Z6P*\322*\277\304Mh>\212\267\217\027"
+	.ascii	"2\003\3020\323\302\316\021He\3666\332\302\301H\334\325\0010\321"
+	.ascii	"\004{\200\352\211\270\347\020\353-\341\311eJS\361\202\306\306"
+	.ascii	"B\244fue\\\3137\305\223j\262\242KA\001"
+	.text
+	.section	.gnu.lto_rcdeviceCamSimulate5KeyCablePress.43.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375`\241\001\275\016"
+	.string	"\226\235cA q\223\016\037\241x\030\240\021"
+	.string	"\367\247#L\206\306\031\223;\301\330\330~\226\031\303E\314\266f\354o\211\3665B\322\273\025$%H@`p\001\362\342C\224;\200\355\332/\260\330\265\021\262\367\2262\245R"
+	.string	"M"
+	.string	"Q"
+	.string	"'\216\"t\226\013\357cK\036:\300\330\345\022\030\201u\2309H<|\037\020\017\035\262m\234\013\261\325\211\206\212\212\034\273{)\210\207\016\237f\310\257FP\277l&\321\341\003\271\336Tz\231\335\215&Rf5\262\273\316\315\244\341\216\267\375\300\266\003;\t\004\335E\"\324\247\316\024\016\244\354lN\224z\262\377vw\255\037l+\246\253s,?\204\351w\356\326\227NM\037\023\200\304\fMj7C\267ce\300\026\021\347~\373G\031\343\005\fB\347P\254\035Q\2558\325\270\261\313\0358\264\002\353i?\234Nv\342a\352e\203\352\365\250\0330\221R\3511\312\016V\032\025"
+	.string	"\216Qv'w\021\342\006>\213\267\360\274\257\034Z3\211\337\016}\223xX\351[\236\236\216\022-\005\215\262sn[\340\311\303\177\356\256H\365\344w\221\370Tc\224R\207\005t]\027$\032\007\264\371d%\332\305B\326Qc\032\317\006\213\220a\234\223L\002\366\2714\316E\302\331x.\354C\341\322\204X+\311>\027H\323>\027\206\333\253\245~/\252*\006\b%d\214\224\344\217|\212\rf\355\216\276]S\355lB~s&EE\366_<U\301_q\033"
+	.ascii	"?\003\3020\260\215\031\036\013[`&\236\031T\216\262\212W\226\263"
+	.ascii	"e\bk9'\254$\252qRWw\033\f@\360\032\301\254\307\005\027\313\f"
+	.ascii	"\307f\005\013\235\301\255\001\247D\007w$(\033WR\364l\343\023"
+	.ascii	"\312\023"
+	.text
+	.section	.gnu.lto_rcdeviceSend5KeyOSDCableSimualtionEvent.44.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375``\002\315\020"
+	.string	"\366\335iF\360\262&\035\242\353\226\344\022:U\352\263\032\242"
+	.string	" Ffz\237\234B\314\bz\006`\020\343\206\322\274\324\212i\335H\t\324\356Xb\372\320\331\204\027\317\3003\360{\223iaO\006({7\205\235\006b\311&R\246\024V"
+	.string	"R"
+	.string	"V"
+	.ascii	"\006\270\307\223\017\330\036\265\013\330\036\215\262\203\036"
+	.ascii	"~\330\363dX\355\004\331\335N=\034\365\320\0265M\224\237/\035"
+	.ascii	" \353{(\301\217-O\340\210\\\353\332u\256\2210\341\003\262ZW\031"
+	.ascii	"\030U\314&\002\302\3010\302Z\305\f\245\354\256\023dU\270\271"
+	.ascii	"\333\236`\273\263SC\333\243\023\334\225\b\327\332\330Ga;Hy\320"
+	.ascii	"\354~\257Ip\013<\252f,G&\223E\354\360K\355`_g\263\231\017\353"
+	.ascii	"\215}\330\257\231\316L\177\304\304\302\016\004=v)\314\206\254"
+	.ascii	",\316\030Ab\373i\377\365\034\324a/Z\200Uq\250\371\331\r\0178"
+	.ascii	">\213g\254\206\006 \037\226\032p\273\251\203W\333\345A\036\364"
+	.ascii	"I\214~\366\177.C\202\037\302\021Ny\360\321?m\217W\235\241Q\202"
+	.ascii	"&\2253\337\305K`\262/\211\030\b\347B\217\366\3701\356\345Z\233"
+	.ascii	"\027>\214\320\006\327.\217\337b\003\241\342+\276\343 \356\361"
+	.ascii	"/\001\247\021\213\332CiY\361TF\036\t\302H\201g\352J\244n\001"
+	.ascii	"i\245\245\363L.\035\n\001\227\030\214L\235\203R\311\324\221\204"
+	.ascii	"{m\365F\347\234OK\226R\030?\274S\264P\252\255b#Ugr\b\211\361"
+	.ascii	"\214\t\331LR\325\366Fy\320\242\030\020\231*\305KnDQ\332$\026"
+	.ascii	"\325/2 \260\002\031\312q\003\"B\377\312\200\221\310\250\177\""
+	.ascii	"\3416\270gE\231\245\310\341\253\341%E\270,5\240\345]I\271\005"
+	.ascii	"\250\362\214\f98\270\267\255\017m&\0304\353\350\361\336\242D"
+	.ascii	"\304\021\344\275\224\r\243\r\021\351\026\345\036\307\355j\220"
+	.ascii	"\305aWy\312\005K\354\247\004\037\201[L\2246\031D\213\3067\\\204"
+	.ascii	"!\236\233\363\235Ye\321e\364\t"
+	.text
+	.section	.gnu.lto_rcdevice5KeySimulationProcess.45.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375`_\013\3253"
+	.ascii	"\232Yx\023D`\236\326\030\367y\312Cb\335=\002\262\367C\001G\244"
+	.ascii	"K\321\312\024\3156\367h\350;.\327\353p\003\366\314\314\343\355"
+	.ascii	"\037v\314\r>l\360BQ\274\r\006\316\365\352\026e\244.\211 \267"
+	.ascii	"\334M$\221R\246\224R)\001\006\001,\001<\302\334\336.\372\322"
+	.ascii	"\350\223\363\322\255pFz\255\231;\312\315\266&\325\274\212\276"
+	.ascii	"\317.K\273;\333{\337h\201^\271A\333+7\224VS\321Q~,z{\2752\253"
+	.ascii	"`\016\366\352Afng\356\263~2\325h+\330}\337/3V\3367\212\304\006"
+	.ascii	"\332^\233\215d{U\333\310\366\312S\314h:*\344\375\205U\301b\333"
+	.ascii	"{\3377\351\303z\252\203\230K%\320\217OO\022y4\362\354\350\024"
+	.ascii	"\211Ca\020\350\266?vU\337\247\270\201O\252\016b.\317\\\351\304"
+	.ascii	"\201\232\370\217\017\023\3571\342I42G\0269\0221\016\341\031\333"
+	.ascii	"1\023s\035\264'^\364\341\304.\037\366p\241\020\036\036"
+	.string	"\354:\255\035\315\326CeZh\016\034rU\002j\256\350!i\220eu\231V\016o\273L\213\313\177hX\316v\235\226\016\265\371\276o\360\331\302W%\264\350\331\364\253\006Z\253*\201\256/6\210O\026*\022\f\0203\301\347\225\277*\004\346cJ|Z\251M/tX\235\326\016\343y\345\376{\360\276/{\326\263F\263P3\373\006fv\300\354\246\005\334Y:N\0037\221^y\003\007\016l\257\336\034\307\366\272\376*\3253\203\253\362>\206\233\302\203\212\215b\325\007\301\375\326V\242:,-\375o\345Aq0\251Z\275K\231(}\252\021\373\357A\232m\304\372\377\377\306\3508\363\007&\357,\377\316\341e\365T\335p~\364Iyf\262Hm\235\024\357\312\341p7\223\355Gzv,.\253\216\322R\232\270\211\260\b'\357,'\266\327\376N\353\2420i\246\\U\336\307\034\265\362\2072\267\372>\030s\2575'"
+	.ascii	":+\251\316H\255\263\221\353<\300u\026\320:\027\271\316D\256s"
+	.ascii	"\200\326\031@\353<\344:7]g!\3279\310uf\266\316\313\326Y\371s"
+	.ascii	"\006\3729\377\264\316>\256s\217\353\234l\235\221\256\363\321"
+	.ascii	"u6\266\316<\256\363\216\353\254\323:\027\177\316D\327y\350:\013"
+	.ascii	"[\347\240\353\ft\235\335\326\271u\235\177\2563\333:\257?g\225"
+	.ascii	"u\376\325\331U\347VP\344\246+p?mg_;@q\200~\265\321f\306\205 "
+	.ascii	"\306\236T\347\347\373k\032\005a\351\347W\033kf\237\304\305U\361"
+	.ascii	"\241\334.i\f\254\317'\313\364\362|\336\323<\261\347\213c\311"
+	.ascii	"\357A~\362\217\344\332\260A~\363\r\255x\325\030\036_8f\374#\317"
+	.ascii	"\033_\251&\r\317\267[+\275\242`\302\235w\352\374N\361u^\315;"
+	.ascii	"\320g\314\024\177\225\366My\001\224WJ\360J\023\337)\305\303#"
+	.ascii	"~\263\265\367\360!\246\353\t\027\360\241\035\305\332EEX\352\264"
+	.ascii	">B\362\206\211\033\246\267T\302\204\366}\253:K\351\271\325(T"
+	.ascii	"\360\316\342&\213\247b\356\272\0163\302\302\205\013l\257J\377"
+	.ascii	"[st\314<\205\246\025\362j\275^\357Q\257\255\326@\267)\035\225"
+	.ascii	"\317a\366N\353\205;|\"\236\360\207\301\027\276Q\234\201\236\223"
+	.ascii	"\013~\353"
+	.string	"\211\371\021\316\356m\037\312\245\201\377uR\271-\355>\260}\367\201\220\332K\227\366\233M\254\217\240nT\277\207\262\217\365\023\373{\247T\356\363\314\372\211e\377\367\335\242k}\366\325*X|U\336\207\245\265`h\337\367e\020RM#\336\204\206\246'\247\f'H49\235(\230\206\314t\340\351\003\223\207&&\247\024M!\230\234IPNI$\234><%19M$\035`2T\211&g\322\t((gR0Z\325\352\373`\314\017\252\336\252\203\036\312}#\310\362\367$\263\343d|z\253\355\270\216\331\"3\252-\305\266\222gW\221m)\226(\306\205\365\306\363-\305&x\030\274E\001z\327u\326w\315\375\346\317_\226/{n\206<\3013\253\230J#\302\255\241\273z*e\021 jL\243O\262\221\316\371\f\227a\364\376f9\340\213x\002~@\321\013x\002\016\303\263\212\336\333\224D/\304\013\360D"
+	.string	">\300/\335\005\026\200o-bp@\006\240a?C\337C&\235s\026~5\364\316W\346}\232\177\024\372\346\362\205\276@\234O{\202~\030\204\371A\312g>\263\n\026\037\223\311\261&I\224\327T\220\324!\227OtF*\367\\vk\307\252V>\321\030\351\334\225\3039\362\346\302\370P.\276\215\201]~\243\221\316!9\225\277\313w\223D\231\302\t\303t=y\336\264\362\233o\216\362\177km\323\200\340\250q$F\031dfDD\244$)H\322\001\360\002\021\031\032\353\021"
+	.ascii	"\251B\326II\254\305\002\231\317R\235\374,2\370\022\350\274\254"
+	.ascii	"23\007_\337 \301\005\236K_!<P\214,\262\235\022(~(\220R}I\212"
+	.ascii	"\343\214*\034\027E\373\257\024\373\213H\241\230E\261\251\026"
+	.ascii	"\027\032\344\207\016\027\251!\307t\242\004\017\306\b\256\"\205"
+	.ascii	"9\304\315\n\355)K\017\3624\262\313\222uQ\0162\247\023\0026Q\006"
+	.ascii	"\214\376\207!\030\240\bgP\220\215K\311\263\230<PA\371\240\257"
+	.ascii	";\210\250O\375\034\205\212\302\037\013\2372\367#\236v\177\266"
+	.ascii	"\364S\266\251F\250\313\366\306\274yiS{j/%]\212N\202Y\r\200\333"
+	.ascii	"\376!<`\364x\237\016\340h\027\020\026\005\341`\252\223\b:\236"
+	.ascii	")d>0h;k\f\310\272\250\357-q\217\322\332\0169=\334\355o\356B\n"
+	.ascii	"f2i\030a\377}Bg\024\005\026\354\021\253\255[\007w&\306\363\360"
+	.ascii	"X\276Uq\026\030\032\033\350\232\314\336yg.4\3648\364M\273>\213"
+	.ascii	">\n\233*\216\363I3v)]\372\244\210\001=\251:7\247\236\335\004"
+	.ascii	"\317\007MG\332Sc\351\373\222\327C\221'\035A\201\234\224\307\221"
+	.ascii	"\344\252:\303\\9\225\017ny\206\020\021\237)Dzy\353\346\210~\323"
+	.ascii	"*J\277\177\364\357#\250\275\013J\f\205\324*\325\211nZF\367%\336"
+	.ascii	"J\205\377\317w\2623\355A\244\bTF\321\037\354\321\260\035\357"
+	.ascii	"\212\030T\302Lb\264\354\325"
+	.text
+	.section	.gnu.lto_rcdeviceUpdate.46.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375`8"
+	.string	"5\b"
+	.string	"\322\01797Pm\323\001$\203\310\252\220T%\276\351>\234\212F\302\216"
+	.string	"(\267\240\216\370\321PoQ\373'L\346\"\262\216\326\320\210 \021^;\337*\356\330\306\352\377\273\221\275S\n\033\303\225a\013\236\316U\353\207\002\230n2\016m\270(\006q9\320:5lv0N6i\335\346F\300\332\303U\247G\323\352\324\200\373i\345\310\n\034\341\204\fi \215K\264\267\217\225\021\206d\347)FiG\200\342=G\024\214\220Bv6\330E\351a\177\332\335\265\034\331\377\376XY\033)\t%\273\026-,\033R'!\032\333\217\366E>\302\375\223pf\267\343+\355\202\006.\300\234\032x@uj\272U\2352g\253\034\004\331\233\220*HVvw\312\217s\217\234\177\3223\236\250{\274 \354\256\243'\272\270\345m\023\330>\260]\n\f"
+	.ascii	"2\241\251/0.\230\243\022i6\206\224@m\206\\0\344\022,\261\232"
+	.ascii	"\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_rcdeviceInit.47.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375`\243\001U\020"
+	.string	"F`oF\360\320&\035;\262\\K\203\330\005C\237\321C\322vC\272\200\213sJ*Q\311\254\277L\023\254f\324%\215Z\231\362]\315\262\333\031l\233v\026\331\302\235S\2319\274\323\366\202\272j\n\203\036fE\006\331[\312\224\002Y"
+	.string	"X"
+	.string	"X"
+	.ascii	"\332\213G\006\320\356\247\340\321\013\264G\220\023\310\036\341"
+	.ascii	"\007d\217\337\214\262\177\376\325\354yzZv\204v\227S\021\206\211"
+	.ascii	"z\204\232(\377\346\311\nJ=B\001\273\033`\345\0012xY\251\022\236"
+	.ascii	"`]\377=c\374\270j\274V\254\347\207\204\335u\272\254b\356\354"
+	.ascii	"\2661\330\216`?(\032C\334\230\301\001\241\2221\373K\245\266\354"
+	.ascii	"\177w\327Jc\213\256sk\317"
+	.string	"\271aL+L\247\246\277]\006F(G\205\027\273\037b=\226F\204Q\342:\177\316\323\276\375\025\276\313[\003\007\250\353\240hk\342\3435bF\210\366h?\205\377y{<\316U\240\236\223\242\245`\0025\273\373\300\366\311]t\005|v\027\302\353-H\276\315\243-x^\366\310\371\004i\252z\026,\3262t\237\243d\251\232&\214eF\2251CM\275\3531\006\246\243eH%c\252\273\233Rm\331\026\345\325&)\345]\f\262\242)\373;g\321\301\267\261\206S\336\345\321?\005'\244\221\022\n\027:\023\217\303i\363\356.\204d\324\211\220:o\003i\2443q%\217+\361F$\\g:q!\b\\\312@2q&\245\222\211\333\276\275\322\334|\202\f\314\016 \025UEm\031\300KE\032I\244\201\027\333>\220(\\6V\222\307!\324\226S2\250\"\375\367\330\003\303\3012\243\372(\263E\016\033%\b\035"
+	.ascii	"2\003\006:\206\346\016\344`\355wi\005(a\b\226\265\310\260\026"
+	.ascii	"\013(\204\263\t)\306ib\f\tE{`\240A\275g\025\227Y\334\022\020"
+	.ascii	"S\367s\212*\256:\375\322D\340\030\016&\200\332U\366\367\314:"
+	.ascii	"(\"\257k>\001"
+	.text
+	.section	.gnu.lto_rcdeviceSimulationRespHandle.part.0.61.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375`\205\005\235\037"
+	.string	"\2264\274H\220\332Qc\212\006v\034\032%\034\251\341\221\274L\343$\343\277Q\276\272\023\024#)\244\317\b(\225\0226\201\305j\0053\202\205Z\266\223\336\326e\350\216 \306u\324u\257\342\002i^\030\325\2648\321\261u\333\275\267\224)\005\247"
+	.string	"\237"
+	.string	"\244"
+	.string	"KX\367\246\016n\272\001z\323\351q\316\233\350\005\2347\355\013\261-\004t\317\006\363\364\351\312\2101\212\214$\357\275\266\2336\307{\257\241\251\321f\250\3544K[mz\276\254\307\367\032\033\247\251<\260\214Aj\264\222\001\330\2221G=\214.\005\\\2523&\004R@\032\025E ;m\220\212\312\003\367\336\032\322\213j\226\f\204Rd\334\npF\211S\345\206\227_\275\302@rQKY\317\324K)(*\243XS\220\351\366GC\"\252q\002\270\367\276\t\310T\326"
+	.string	"\267\221\365\334{\375!\341}s\333flg\260M\t\001\317B\323\253S\033\272\250?\307\342\241\367^\t\276\222\026:?\212\305y\263\332'\031I\341q\310P=S-\321\326\346\345\265N\366Y}\236\325\246\254\272\274\325m\317\352\372\364\177\200\004Sn\204\367\036\235\031\273C3\313\307\255~$\367\217\034\351'\371\225kVU\274*\036\007\250$\005\364H\f!\202\320\251\202\f\204\020\241w\252\240\003\276\364\036Q\330\221\032\223\367\246;7\375"
+	.string	"\235\362\213\334\310\212#m\203V+\252?%d\327j\256\365\251Pz\203@\327j\377\370!\275\023aQ"
+	.ascii	"\300\375!\003\346y\247\265\277zeJ\322\202\374\372U2\276y\316"
+	.ascii	"i\332\323\272\026\315 \372\227\024<?\352?q\3364m)\006\306\322"
+	.ascii	"\355]N\240\245\265\220\344\325\340_<\236-\367\336\t6\356[F$x"
+	.ascii	"\272i\255N\222Qx\314\302\362\253+\bnu}\200\326P\254\264\304\240"
+	.ascii	"\323\257r+A~\224s$\352\215H\2347e\301&\305\260s\275\003X\022"
+	.ascii	"\314W\313\330\376\367\336k-\321\236\342S)\273\240\260\240\370"
+	.ascii	"Q,\327\325\2214\026\357\275:N\374-\203A\357\365]X\237sj\r7\\"
+	.ascii	"\036\251\261x\207W\207\211/\264\003\0304\224\320\345\200|v8\023"
+	.ascii	"\272\032N\204\356\302N\267\333\341f*\200n\3267\236\037\237[\b"
+	.ascii	"\334-\227\002'\342\266\263\351r\266\0229\237\037\333m\207\302"
+	.ascii	"\306\223c\235\t\334\316\006\244\323\355l\265\362Z'\367\fY\242"
+	.ascii	"\232+f<TP\n\023\032\263\376\222f\314K2L\353\237:\255\n\210W\355"
+	.ascii	"c\316\365\343\212\030\226\342\354\330\204\203f\211`?\355\002"
+	.ascii	"\245\034\006\244P\211\231\325\035\245\033\310/79\026\237P\002"
+	.ascii	"\2641\257\237\365\311\004T\234\1778m\020!\352\215|\247\255"
+	.string	"T\f\354g}~\226\207\361\231\ru%\303\354OKt\316y\332\005I]\220\\\354w\246\216<\t\177\250qH\306\020S3$AJS\220\244\003p\002\231\2621;\021 A\310\234\320&)l\354\031\355!\274\n5\370\227\251\325\212\353#\r\265;\362\302\260\033\376\202\270\025\002\232\232\366T\214\324\243\246\256\t\312\235\376\263\237p\236\362 \271\007Pf\"\333\022\235X\245\243\307g\345)\330\355Gh\377D\242\236\021\006u\213!\223\322;\n&u\277\240>\233{(\323\201\274\257m\277\031\240\215\376\375\003\035\371\264h\021<\362\377~\245P\013!\003\027\251-\264\021}\201\2647bS\253\207{NC\333y-\201\273\327\225\314\371\324,\326X\032\353\210\374\322\030\001\351\240\247{VX\232h\007\346 \003\207\t3\224\004\316\203h(\300\255c\302w\344\227\233!@\275\"\346\356\322/\264\316\314y\215\026\321Z\033\371"
+	.ascii	"\023\003\347\211\327\0209F\360\032Z\005(\216\272\330\177\030"
+	.ascii	"^\377\006\326\301R\213&v\262\030S\001"
+	.text
+	.section	.gnu.lto_CSWTCH.20.62.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375 cU\002"
+	.string	"T\003V"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005\005\001\006\177\001\004\003\003\004\002\002\001\001"
+	.string	"?\202\210\200(}\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\t"
+	.ascii	"@\004\334\201\306\200\b\270\003\215\001\021/7\r\240\b"
+	.text
+	.section	.gnu.lto_rcdeviceSend5KeyOSDCableSimualtionEvent.part.0.65.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\325\013"
+	.string	"F\225K;01P:\320\247\031m\022\261\345\362\376\\hg(\037\250\206\272\277iH\354l\025PT\322\260\355\243\013E\205\345\233\020\026_\ne\240\233B\3553\016\364\241\353/\316j\367\2262\2459"
+	.string	"<"
+	.string	"8"
+	.string	"*lw8X\263u\274+\2617\205\320\020c\307\356\306C%q\355\232O\363s\005\016\356\343\271\276\364\207\"E\016\356\003z\016\370\003P\331]W\035nx\333\013lG\373\031\002\nR\273\033>R\033\2027N\234t\373,:~\311\021R\347\035'\031\354\346\341\300\2413\355\267\270\013\355\035\347\t\330\013#D\330\330\355\022\034\032Au89\001\310\341\273\004r\0309|\273\235\273\332\0222y\316\023\f\352\261/\343\246\215o\302\0244y\356\320\327@\016\257\n:\361"
+	.string	"\261\345\007\214*\264\006\016\223\306\t\345\311\036\251#\353\373[\025\331\232\376\223\004\233\353\201\332\242`,V\203\313\272T\270\034XY\304.\021\302\305\202\211V\226\211\224\002\306\"\\Y\234\200aY\214\330\316\277U\221_zU\343\003jS\0133\222sEud;@\376\005\006\2536\037"
+	.string	"\233+0.\034\202\365\020V\363\002,\240\007F\334\202\036\026\005>\330\201\020\243\tPc\340\370{k\306&@\024\fs\205\313k\002\353\321Q\b\306\363\244{\232.\252\235\316\005m\272\354\\"
+	.ascii	"8y0\217\323l\351\te\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375`>\002\335\f"
+	.string	"d\022:\003"
+	.string	""
+	.string	""
+	.string	"\002+\177\037\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005> \200\204\001!!\201\002*\177\026\270\300\002(\177\"\001\"#\201:$ 7%\002=\177& $'#(%)\002\301"
+	.string	"\177*\204\002'\177+\272\200\202\002,\177,\361\377\377\377\003-\177-;.\002.\177//\1770\001\005 1\003\0014\1772\377\037"
+	.string	""
+	.string	"\200\200\200\0019\17738\17746\17753\17761\17772\17780\17795\177:<\177;\003"
+	.string	"\024\244\007\003\003\b\240\341\365\321\002\001\202\001\003\004\027\201\200\200\200\003\001d\003\004\026\370\331\376\005\001\244\013\344\026\003\004\025\321\205\222\030\001\244\032\003\b\030\246\242\275\t\001\344\n\003\b\030\354\243\341\025\001\344\007\304\007\003\f\031d\003\016\033\315\231\263\346"
+	.string	"\001\204\001\003\016\f\302\001\003\016"
+	.string	"\202\006\003\016\032\344\006\003\017\026\310\377\241\372\001\017\032\211\220\350\006\001\344\013\003\017\016\302\243\255\033\001\202f\003\021\034$\003\021\004B\003\021\017b\003\022\035\001\001D"
+	.ascii	"7 \320\002)2n\002\321 \335 \260O{\002bh\017\315\032\365s<\204"
+	.ascii	"\220T\bI:\270k\027t@\007\350\202.\350\002\235A\347\005\031\262"
+	.ascii	"K\261\244`P\302\030i\276\235\375\214\345<\257%xDA\001ila\352"
+	.ascii	"\231M\300\020\027o@\372\241e7Cj\016\343>c\2115\246l\255\363#"
+	.ascii	"\312\300\3200xLr\003\323\355\201,\303\317\221\337(-\370\004"
+	.text
+	.section	.gnu.lto_.refs.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375 \3675\005"
+	.string	"\342\216&'\200K\322\03230?\0051A\0234A\0234\001\266\303\201\360lv\233m\233J1\261k\237\264M\202\310&dK\231\002'\305\332}n\016eo0\266\306z\306\032c}\261\236XK\254#\232!\232\035\326\fk\2055\302\372@m\240l\004\335\202[`\355\254\231\365\302lKH\244B\267\271\023t\321\rH\332u,B\367\"\312\0220\366i\254\323\330\304\330\2041\200\324B\261\025\212\245\270\037\226\033\322\013wB\372\340~\226!i\245L\036\2212d\003w\326A\367q'\033\275#\002"
+	.ascii	"\003\030$b\203\371\004"
+	.text
+	.section	.gnu.lto_.decls.8fca22da23c335d2,"e",@progbits
+	.string	"(\265/\375`\322&e\250"
+	.string	"\032"
+	.ascii	"\0259W0\nA;\351\256\277\372\031D\312\027\274\334\212\327\235"
+	.ascii	"\233\371\r\244\201\"2\367;\273\027\212Ga\301\021\230w\022\365"
+	.ascii	"7o\370~'\205\223\2333\236\223t\273\255\f\003\307:\266\251Q\241"
+	.ascii	"D\256~\020M0\243\274\240\245\347j\332\242\271kB8\274\303'D\022"
+	.ascii	"\b\"{\313\024\375\002\216\003\224\003c0\013*\263\2701bR2\246"
+	.ascii	"\013&7\035\374Q\215`\331\002\343\246\277L\353;L\203i/\035m\301"
+	.ascii	"\336\362\346\322}\377\201\346\314d\353)\370\254Y\023\245\244"
+	.ascii	"\305/\347,$\330UZOI\263\225%\267\332_\001\006-\330]\032PG\t\315"
+	.ascii	"R\352\026_\023\231`\3575\237\207\245fM\023\036\026\277\234\241"
+	.ascii	"?\0324h\320\260\203\247<\262\302&m\300\333\177\035\370\006l?"
+	.ascii	"\034f\003\2469/\273/\350t_\230\221\333\261LS\323\337\345\372"
+	.ascii	"\026\263\316@\347\370\370\264\340\271()_7\315\222^\3019\211R"
+	.ascii	"e}c\3119\343\320\340\272\272\262d}\263\255o\275\277\327\232J"
+	.ascii	"\347\3755\343z\334\264\355\372\256\243\025\032\357\025`p\254"
+	.ascii	"D\313f9e\202\224\031Sd}aWP\333\212\320\273\256\333^8\355n\332"
+	.ascii	"\200\006\262\246\271}T)?50\222d\201\335\364mc\275\005\277P\317"
+	.ascii	"\365[/\301g\315\225\311\226\024\277n\373\205\336s\335\244\241"
+	.ascii	"`h\\f*\331!`\231\204\005\241`\316\320(M\327\321\236k&O\241Y\203"
+	.ascii	"\206\037\232\254#\204Rj\332NZ\256\243\030\372\311\333\255\217"
+	.ascii	"|f\t\315\320\234\241;\367\213\360H\332M\237\264\2761\250\270"
+	.ascii	"\260\2601\2507Z_\201\216\273\321\373\262qv\323k\2606\\#\351h"
+	.ascii	"+\351\266\247h\317\254\22634\007/cPQr\323w\222K\260\314\030<"
+	.ascii	"\202\365\235A\335\351\f\352iV\236\366QoOP-\264\217\n\215Kk\264"
+	.ascii	"\234\247\032S\360\214@\373\254\302\005rf\346\234#\250q\016\326"
+	.ascii	"p\3364C\373\2503=A\355\"Bo#\023\324\246\023\232wR\033`\244\304"
+	.ascii	"n\232\366\004\"\177\017i\263\n\230\351\351\231\335r\206\366\354"
+	.ascii	"@c@\331\270\351\241\355\243\256=A\r\374\315\217Y\214\340r'\b"
+	.ascii	"\375\035\364\367\r\002\312|~\234\0012\367\001\022Y;n\317\337"
+	.ascii	"G.\317k~<\303\354\013\214\277c\334\235\377?\023\234\202\037\303"
+	.ascii	"\350\2728\177\243\335\233\277\001"
+	.string	"\257\215\2303\245\277\241\334\232\237\275\347\307!\374\375\323\341\256?\326\340\357)W\375\373\356\316|\360\267\210\377\246\177\217]\374\177\356\377\223\377`6\370\373C\226{\377\027\300\312\177\022W\376\333\317\360c\013\374\017\374\372c\250\337\037\023\376\035\346\357/\177\007\376\335\367\267\226\277\251\374=\3677\223\277\343\376\216\376\215\344\357\267\277\317\376f\373;\355\357\"\177\233\375-\344\357\262\277\177\374M\366w\330\337`\177\177\375\215\343o\257\277\235\376\017\376\335\301\377\277\277\023\360\367\326\337Y\177S\370\233\306\377\t\376\223\371\217\341\357\253\377x\177\033\340\357\252\277\241\376~\372\373\302\337\023\370\233\204\277A\374\027\363\367\003\376\366\340o\005\374\235\301\177\302\377c\376\243\3757\373\277\200\377R\376\347\024\026\026\026\376)\005~\032\276_\202\016\004\316*\3503\b\341M\217\253~<\205\251p\214~\366\212>(17\305.\360\213\216R\3000"
+	.string	"o(M\321\255\034\310\271)\250]X\330\024\324\373l\037\225"
+	.ascii	"=A\305RB\307M"
+	.string	"\235\251 ko7\355\301Q\024\200,\251\321uS\374\264zqr\265\304O\330\251\261|Y\352q\323,K\254B\0267\275\005t\267N*\r\207_[\336\2140;<\032aw5\324\b\257\230-\035Y\256\270\\\2777\274'\277\251-Q~_\356\240\013\245\265(x9\264\334$[VvzX\204w\357b\301\223\201\227\260\0227a\026\230\t\267\270\205\267\f^\201\363%\203\2250\363\216\301\313\216^\302\276\322\306w\223\2449\t\357\337\365\322unyIe\241G\330\0301\032h\274\204\334 \264\220\236FlP\320\355l\213\026\250\330\025%<\302\\0j\021\274\033tY\353i\256n\340N\030(/{R\2004M\267\013\016\031\225\024\030\231\365\366yY\257\362\255W\253\254W\227\254W\335\260\\\t\343\201\306\245n\007\247\314\020\274\254\233^5\262^\025[\257r\255W\235\353U\247\225COP\257\225\025M\232\334"
+	.ascii	"\254BE\275#\222\331\246\374R\331\331\021\265\263q\323+\245\241"
+	.ascii	"\024F\247\310\235\313\r\224\034[Un\372\231+\353g\346\346\264"
+	.ascii	"f\324\350\274T\201\"\027\324\367\244\326\026\2755\314\234\334"
+	.ascii	"&\367\311e\322\321+w\343~\247\356\022$\367\255\337:\257\353\234"
+	.ascii	"\013\020\342v\345.\334M\322un\037\314\214\310]%\235G\343\025"
+	.ascii	"\306GF\303\314\225Y\024?\233\264\363\314\216\3653W\353g2\222"
+	.ascii	"\232\275\300\031na\326\247]|\216d\310\031\334S*"
+	.string	"s\303\2602\233\300\231\265\261I`O\355\246\277l\377-r\215\334\265\324\310Y\225\277\233\252i\201\331\200\212\262\242u\364\246]hCo\332=\303\001\305\003#xc\305\217\256-M\237\362X\237Z\255?\355\243b7\241_\"qO\226\310\2305 \315\220'[nC\256\220U\006X\036\330Ma\340L\301\212\213*\365\233\f!\256\0267n\016%k40\370\205l4ua>\227%\275\031ST\027+JOj\306\255\241\303\344\311L\256\2500\241\254\253\325uN\236\314\\{\n\233z\336\032mkPfW\307mq\2372\227UX\316Yh\253\363t\224<YI\317)\3542\257\216\273\242\36304\214\246\215\353\352.]\035\027\3526\235\270\234@\256\217\373u\203\\\260\033vw\\\262;v{\\\261\313\343\376\270e\035\275:\256\213\337\256\353u\225W\307]^N\207\t\315S*\027\226\206\037\r\355\244\203l*"
+	.string	")\341\305\241:\025\261\362\343\246O\363z<\270\256\235\361\337zl\267\036\313i\275\363.\036\225'\245$\353\361Z\206K\243\206\t\315jE\\mN\314\326\343\257+\003.-\313\336M\217a\254W\327JY\345\217\317\371k\365>\234\234'\300/\312r`\271\351\277\334*\225\307\220%\215[\025\343\246\315\007_\222\233\302\270\031\243\3024\007f}q]\314\214\255P\312\202\262\376\"Yyn\363J\351h!\271\223\032D\213Rd\353\2467\252\267\354\254hji\255\255\277O\377eq\2314"
+	.ascii	"\305\t\222\233\336&\241_'\334d\267\374rS\r\206\254\330\257}T"
+	.ascii	"\006\200\255\034\332G\365\360\\_w\253\326\373\225!\234I\243\023"
+	.ascii	"\262\274)aMn\212\377nS=\203\203\023\323\271\332\262\005\367\375"
+	.ascii	"\004Q\002\276\020\274W\201Urp9\356\263)\263\364\007\247\305A"
+	.ascii	"\313\027\230\236\036\326\002\201\221\277.T\202:x]MNY\216\265"
+	.ascii	"(\371\320\221\004KN\031\027=\253=|\245\346y\225\266\214\262\327"
+	.ascii	"f\305\n\306\373y*\001=\214M\211\375\020\304O0\234\220\335\024"
+	.ascii	"\017\337\321\364U\261BwSl\267\342\rrI\021\253\313\301\242\243"
+	.ascii	"\303T~\326L\204\213\210\037\216R\0312B<\345\230\212\022\026U"
+	.ascii	"R7\305Rn\023w\221:r7\263\005f\213\2221\353\235\334\t\236\353"
+	.ascii	"\265\267&\262\f6y\\u2\240\034\317]@8\276\347M\361\223\333d2\315"
+	.ascii	"\234n\212\345:\257&-\016\312\204\305#jG\226\022&\357(f\322b@"
+	.ascii	"d5"
+	.string	"7\034\007-.\016\203e\231\013[\305\262\344,\037k4\212\337\326L\241\352\317\252\354k\257\013IG1\022\\\225\341\231\251,\370\260\273s\222\363\203\211\225\326M\217\343\344\346\206\337\006\227t9\005\217\034\277\351\230\311\371\r\332\030\312\345\020\344\262\256\255a6\020\031\202\036=vx\264\340b\273)[\003\326\364\030\333z\222\002\305hP\234\246\346\334\320\247T3\355\354\f{\255\312\237\3003g\206\031\261\277(]n\372\233\261\3657\314\"E\376T'\267,/\372\314\314\032\360'c.K\272\234e;mcV\264YY\261\020!\r\330\320,\325;\354nS\206\017!7\275\215\222\265\f\327(\273VN\246\315\327\217\216\342\037\235\327hY\312\246\205R\354\207`\316s\033v\300\374\230\361U(\366\216b1L\226\242e\027:8\234\033n\300~"
+	.ascii	"\211qS<\026\235\002&G\337\372\232\271\260\216\342\260\313\326"
+	.ascii	"\320\254\274\341r\346\334\240>\247(\211\301\255;v`\260\316yL"
+	.ascii	"\331\345\024\374\227c\260\231;2\2607\260\257(\376\3521?\320L"
+	.ascii	"e\263\243Gsn\303\f\033\221\260\0277}\215\215\365\035\2441\216"
+	.ascii	"\216b\034\215\366\323\317\025\\|~\271\271\264\3415W+\027\027"
+	.ascii	"\366Zs\316\026Pv9\313\262\263\331u\354\305\343\225e\t\313\300"
+	.ascii	"i\341\245G'\210\267v"
+	.string	"p\2261\242v]p\326\255r\022\243\272\351\327;\374\304Xx\3061\215c\032\327\252s3ggV\376]\260\304\256\313)\230\235\315\f_\275\336j^6s\316T3\320\334T\302y\317tg\370s\0327\005\377\323\234\2079/\327\312\274\254cJ\2262n!\177\246.g\246\226\322\001ZSL\255*&5\255\254d\202){\232YK\311\244\226sOf2\225\037\236\271\207I-O\345\025wS\235\241Z\312\314|\346\236\314\314K\013LL\255)&\265\345T\017\223\232\326TV\323\312<\231\271l\266`\346fOV\323\372\313j\317)\036&\265\347\024\223\232\326\215\216j\241U\204J\255\214\213\251\263\230\2309\n\nk\331\344\251c\202>3\226\234\333m)7)\310\031\353\331\304\262\254\3528\245\272(%$\313gS\200R\332zff\035\023\3313g2%\024\031\352\002%\264.\343\350:\245\r\254\374\264\2243"
+	.string	"\240rVv\256\3139+s\3164M,h\316W<LaPP9;\177\2402\226r\311R\316\327MK\334\024\223\332\326Sh\t\233ZXf\001UvX\306\242\325\\\325\224g\371)\347\334\201k\330\224\013\300\233\342\253\347\025\231\266;l\025E\254Q\221\350\201\205\"\026)i\204\007\311\342\003<;F\026)\204\002\260I\"k\304\2128"
+	.string	"\021k4\036\207\222G\243!\fG\001\024t,F\240\036\005PrH\304\016\213B\2508\226\240\351\200\204\020$\2066\030v\360!\004\020\206C\"\206#B\364\260C\"\004\311\342\207\rZ\366\204\217\005v\003N[4\206\300a[b\021\322\bG\001\244\002\031\244\0029\201\b\251V(2v\220\f\321\203\301\210\370aD\bEFv\004\320\tc\261-\0225\340\223ddA0\206\320)b\215\307\266M\342 Y\334\341"
+	.string	"\324\"\211H@\0038\n \242\2411\t\031DdB"
+	.string	"\311\023D#\017N\030\213GH\342M{\304\266\311\022F$\2238\311$KtD\212`tD\022\221\354\021q\250\206C\005@ \206HL`\304PM2\311\"E\030*\201\205"
+	.string	"\006\354\205v\230\034\001\311\"\261l\t\234\023\261FEF\"\210\tNTD\262F\366\304\372\013:\034\240\203\007\0254\367\220\001\207\f8\250\367\220\201\220P\006\035\204\326w\020\302\354\2605\262):(\201\205"
+	.string	"\321(\351\2508\342\2108$"
+	.string	"\232\243"
+	.string	"\n*\"\213\220l\321D\2615\262EE\033\022xX\243\022D\022)Tv\310\026\035A\260a\213\216G);\f\241E\036\221r\222\306c\261E:\322\260-QDQ\022\261\304\312n\2408bmW$N\021\221\005aT$\222\340@E\213\203lE`S\024Y\"V\304\217\r\006\210\210%\214\214\210C*\220:'\220\222\303\023E\023\306\343\020O\362\001#b\n$\333\032C\264HGl\333n\320\026\215E\n\355\260\002\013h\332\243\250P\304\266\304\024\305\226h\203d\361&9dQ\020\265E\r\214`\207\311\244\226\330\216\370i\215\222\222,R-2\022\217\216\216D4ElK\304\"\251`w\214\354\0077&\2228HA\304\"i\332\244#M;L\202\260\"\035\021\3336\351\310\036\025[\036\23769lU\260\255\3618$\002\2334\036\221\222\254\210"
+	.string	"\020\031\223<@\262I$\021\311F\2551\262\037\020[\342\207#\"\222\210\204\223d\217\212$J@\266\254\b\025\304\243\034$\233LZ[\243\343\221\203\341L\tEDVD\262H\223\034\352\264\311!N\213<\212`D,\"\331\244M;\364@\203dM\230H*\241\266G\001D\341G$\026\031\324\036\217\310\240\233v\330A\2505\026\223\326$\213Lj\211\254\21159<\2320\206\370pD$2&!\037`\207)\206\022\\Hh\310\302\b\021x\300J\004tD$\032\262D\305\024l\021\0212\350X\f2\026\211GAD\310d\020\320\004\306c1\211dI0:\022\035\333#\022i\347h\302XL_\364\331\260\001\341s\273.\bW\037]\250\300\240\002\233\302oe"
+	.string	"\327\226\3344\215J\245\2366\2376o\332\304\205\205dr^\356t_\350\276\240\022\311kS\241\274f\272\2149)\237\322\322#V7\266\234\002\237\340\360!\3254'(%PH\312\2242\031\351\261\003\267\376)\013*A\366"
+	.ascii	"\013\227\360\246\300\200\212\335\024\n\201\023H\024\223,u\341"
+	.ascii	"\306\364\226*i\371\023\002FGaa\252\004\241\314Y\352\2512G\316"
+	.ascii	"\352\207\214\235\2621c0a\2200\2747\204\306\0262\307\204u+\004"
+	.ascii	"\305n\223F\352\257\253\206\327\340 ~\023\322DV\2063\366W\265"
+	.ascii	"S\025&\214\233\216\022\272(*\277/_p`\363@\225\364\340\302v\240"
+	.ascii	"/\302\224h~~8\360\347\211\365\216"
+	.string	"4\221\225\r`i\313\b\340q\340\027\221\254\203T\250\222\321<H\342\230B\206fdd$I\222\016B\n\020\004\203a\036)\256\007\022`\364@\220B\247\220\314\210\210\210$IA\241F\007Lx\272\325\362\032\200\003gQ\327\347eR\333S\245}Y*\013\203\260b,h\247{\021\324\364\260[\"\256\310{Q\006\344DN\332k5\331\350\310\230\360\0266-\325a\304\253G5'Ln\320\371\310\r\251\2345P\031\"\241V\364Th\345;+yV\310\321%cH\201IF\324\205k\233\026\317\225\364I*\247\302\327\033\220}~\241\032\302\373H\347\017\302\207\236\235\275 \303\270,\007\345\001z\274i[\253w\243\264\304\022\031\352\202fA\215\262\225US\257)\256RK \276_*\3031e\231-\033\300>\201\031\274\246\364\254P\222\001\351\017@#C\361\263\343\227\266\177S\347\251\343\240\026k\f<\254D\3663"
+	.string	"\235g\3009\232\003\216\311\020z\277\303\007\302\312\322\n\344\f\t\243\223e\310\0220K\337\020\376\332\235Jk/\212\242\005<\030\370\357\007\375O`"
+	.string	"\320jYu\372\341j\222\006\203\033\324\376%9\026M\246\251\253\215\224\227\256:[\320\342(\375Yv\304M\330\352\001\266\347l\243"
+	.ascii	"\223"
+	.ascii	"W\032\026H\275\306,a6R\234\333\031\265W\3416m\320&\034a\335]"
+	.ascii	"\237$E\024\321\366\245c\213\212\215\222\310\310"
+	.string	"\300\315\232\376\355Tg>\255\316\016\217\304\1774e|\003\212\254\261\016%\365J\030\027\271\225\342#\232/\302=\236\2747\355\260\220e\004F\205|\377\"\004\200Kr\343\264\016R6\320\177\377m\226/\350\372{\334\314\242\321\375\002\246\316\367S\3441\037V\325\341B\007\246\367\241\310\253\002T\264\201\017\333]\256\252\222\002ydR\003\336\311G\315\033\tp\337\364\351\351k\343bR\340\336\221l\344L\266\236U\313\375\264\253\315\271\306\302\376\211\340\336,\270\261^\371\330\327\3314\221\327\301\307\253\n~\371\357qc\037\\\024\210\030\245\302\0360!\3129u\2172\275\375\340cY\350U\306\336M\006\350\365u\365\213'\330\267\314\232\360\207\320\034\232\220\327\300\230L\357\204\236\325^\264!x\211\034\303@UA\023x\346\207\003L{\203R\021M\270\001\036\370\352\322\256\231\331\243\265\224\177o-I\232\"\033\317&S\330\023\023"
+	.string	"\377ip\237J\200\343R\301>\f\034\035\002q\231NVixx&z\316\f\357w\332n\334\017}\034\363x\271y\240\306 \311\021\253\f\024\235\243\251\227UeZf\363\220\250\017jY\202b\312\320\2330*B\353bp\013\372\245\3162\314\254\247\367k\227`\023z\365/5T\325\202\320\225\025V8\322\233\351 \317\243!\362<\371\301\253K\323\200*\331\226\270\256\036D\243\262\240\257rDL]\320}\214\243;\213ZuDbg\356r\343Q\350\343\260\303H\240\272|\006:\205r\016x\211\022\337\032~\360\20143\321&\315\250T\275\250x\007\231\351\215D8I\212\344c\344>dIQ\222\355Y\374"
+	.ascii	"\356\236\323kK&p\200\262\231x\005,'E\0368\244?\031\236\f%\373"
+	.ascii	"(@I\354A\360\301\221I\251ip\250\236\2235\237\343\240\037,!53"
+	.ascii	"D\316P\336!\035\366\236\\\017*\304\"\321\212g\r\177\341u\243"
+	.ascii	"Isy_\273\t6N\260\370\340\212\3508\r\b\264_w\255\305\314\244\352"
+	.ascii	"\303\273\3523\267\374.r(e\306^\004=\301\224V\r\007\300\346\347"
+	.ascii	"\020\216\320\313*4\360\251'\222\312\306\302Q\300\034\020\377"
+	.ascii	"\t\211l\250^%\004\335\301Jc@\024/\352\\\326!\346\232\214\330"
+	.ascii	"\005P1P\332"
+	.string	"e\301\013>yn=6\361H_\375c\251\035|\201\227d'\217\311C\330\215\345\262\375\354\206\335\360\330\303\312\241\037\202\3174]\031\362\365\376\214\342m\230\300Fv4H\261\302\220,\360I\266\3617d\203\213\345\324;\256\364\223\301\275\213\305<J\377\213?K\350\217\341r\n\004\306.\214={L\253\031\217E%\355\204\275^\304&\367\341\373\215\264X\t\205z\351;\360\326<\027\344kA\366\342J\210\345\026\304\352\242WP\233\202\307g\321L\002W.~`4!\234I\313a}\205\222\217X\035z\036K\347ZC\352\301\032\007\223\013\2117\201\277Th\003\005$\343\016\306\365\227\035\337\231[\b\242\202\017-\240H\036f\270*\211\004\317\272\256\313\030\006(E\f\363G\263\221\3153h\241\001]\246\276\371J\210\356\327\367\273\300\273\331\211\234\265,\215\3376D\303\274\200lI\325\274@\001\354_\373K|\243\b9"
+	.string	"\220j\335\302\205X9\256\350\002]\211\217\244\360\r2\3172\264\b[\321\344\247\211V\324\327\002\314w\2738\020p\n\332\263\177\364'\177\253\202\032\312\005r\235\311^\312\206\365=x8\207\246\302\244T\004mr\274\235\220K]]\374\317d#(h\311\344\221\261\013\363r\340\006G\351}\234*\225t\211"
+	.string	"\210Z)\0132\212\020\036KE\325@\005\033\363\f:H\323\337\035u\270<c\007\331\335\223{\323\365\256\002*\377\2421\206\210\016C\323b@p\277\034\247\216tg\342\034\316\225\006|v\210p\332N\203\247\340\303S\330;\035.\305\233T\320\246]8P\230\362\370\313\210\215\332\\\265\232\276\247\013U5N\320\210xi\376\221\251\360\3500\320\032W;+4\026x\037=9\3377\312\021\300T\364s\254(y_\213\354MS\032%\t\023\350\202\357C\352u\220P\340\007\326\364\340\004\214\271~q\241\013\t\024\3263N%X\312\271\3171\204\253\336\234\322[\357\373\266op\243\300X\221\317\"F\252\332T\031\336\303\357\345\275\274K\271\236\017\302\216\353\373\352\230\361\370\205\316\027\217F\265\362\202\375\203\037\031\2771u\\\020Xe\204\023\337\307"
+	.ascii	"'x\035tz\271\277\341\275<\273\361\311\365Q\344\310\370\027\337"
+	.ascii	"\226\3467\353_d\217\336\025\346U\275\316L>K\336\351\177==\021"
+	.ascii	"\305~\325\360W\016|\234\373\324\272T\335T\023\375\220\355w\317"
+	.ascii	"\246\301\214\f\333[\321\027\323m1uj\277\255\035o\247\021k3\177"
+	.ascii	"C\237\212\335\305+\211\307\263\327\345\240\306\227\274g\377`"
+	.ascii	"\253\307\177\371\263\372\016\215\370\267\301\036z\370\236\314"
+	.ascii	"\244\363m\2402\016\232\332\345\307\373H\365\201\363\231\277}"
+	.ascii	"\275O\273\202^O\033\357D\352O\341\242\217_\375\200\335\310\266"
+	.ascii	"\273\217 \311-*\351GD\326\n"
+	.text
+	.section	.gnu.lto_.symtab.8fca22da23c335d2,"e",@progbits
+	.string	"camDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"switchStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"isButtonPressed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"rcdeviceInMenu"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"waitingDeviceResponse"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"rcdeviceIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"rcdeviceSend5KeyOSDCableSimualtionEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"rcdeviceUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"rcdeviceInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"rcdeviceConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonPress"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"runcamDeviceSimulateCameraButton"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"runcamDeviceClose5KeyOSDCableConnection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonRelease"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"runcamDeviceOpen5KeyOSDCableConnection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"rcdeviceReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"runcamDeviceInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8fca22da23c335d2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
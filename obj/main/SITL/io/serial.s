@@ -0,0 +1,1301 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375 \tI"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\033"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`\213"
+	.string	"\235\t"
+	.string	"\204\017\177\001"
+	.string	"\036"
+	.string	"\374\255\365\254\f"
+	.string	"\001\303\226\316\200\r\022\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002\003\004\226\230\365\242\b\003\357\267\360\307\013\002\002\005\002\006\004\333\375\377\333\001\005\303\276\302\323\013\002\006\232\255\221\221\b\002\002\007\002\007\007\240\342\234\212\n\b\232\226\312\363\017\t\253\340\320\236\017\006\002\003\002\b\002\t\002\t\n\013\f\215\311\327\216\r"
+	.string	"\r\233\275\224\204\t\002\002\004\002\n\016\351\255\236\303\002\017\217\231\357|\004\002\n\002\n\002\013\002\f\020\257\212\370\224\001\002\021\316\243\347\220\007\002\022\204\203\343\357\t\023\263\324\271\342\r\b\002\r\002\007\002\003\002\016\013\002\007\024\374\373\275\316\002\006\002\017\025\370\346\324\256\r\022\002\003\002\003\020\002"
+	.string	"\002\020\026\027\342\363\276\212\b\b\030\233\246\366\244\b\002\031\254\213\274\230\b\020\032\323\201\221\330\r"
+	.string	"\033\246\246\365\275\004"
+	.string	"\034\220\232\212\335\n\035\240\342\234\212\n"
+	.string	"\027"
+	.string	"\022+\312U\201a\212\2462\367^J\334\0340su\001\315\336\346&+mI\025M\2050e\006\303\345FJ\223\243\344Z\211\232\346D\005\266\\\261kf&\332\365Q"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.ipa_sra.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"\245\005"
+	.string	"\002G\023\031pk\322\0010\377\377\377\377\377\377\237H\377\377\377\377\330\2725B\210\334)\005\256\272\242\013\323T\363\365q\214\230xc\214\271P\354\"\324\303\374\036L+Z\317c\255\323\020b\2600\t\003\335\202-\260\002l\275\027%Ih\333\375M\370#2 \240\0021,\017\f\251\006\030\240\f\306a\360x\330\007\313\264E;\032\r\030h`\"\212%\2001\207\013\236\310\364K\034\016\235\b\241\225\200\277F\372\003}\003\347\020\036t67 \335\343\302&\210\273\"\034\007#\340\003\316&\206\005\315\026\371\n\366\r\310\327\356\264\016f\f\331\270r0{Z\333"
+	.ascii	",.\324\020"
+	.text
+	.section	.gnu.lto_.inline.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`\213\004\215\027"
+	.string	"\266\245\204J\300\020)\035\032\266?\261\255i\223&\275\364\240.\027\001E\275\241\226k\tu\247\007\262z\226KT_\223\031\363p\374d\266M\326\362\033E\025\374oL\001i\306\340\272\212\302\2204\377lz(\232\231\301\260\266\223\021\333mK)Sn"
+	.string	"j"
+	.string	"w"
+	.string	"\274\362\371Ea\tAOK\255\277>\323\355\367\256\266\365O\255u\274\353\306P\277\341Lyc\251\337p\346\365\016\221\3468\204\0208\005Ka%!pj\374\n\206\376)\335\344s\342\301R\232\206\317\2117\276?\323\365\377\327\264\261\215\227\244\027\260\377\32690M\027\004\2500\206\334\320\016\311\367g\372\263\324Z]~\376\267\306\265\326\332\177\354\253\226\037x\005N~"
+	.ascii	"\321g\272\317t\260\325\327\325\377]\350\217\322O+\252:\224\374"
+	.ascii	"\r\372z\240D\356\261\031>i7\364s\301g\215i\204;\034\372)\273"
+	.ascii	"\214\205\273"
+	.string	"\032\025{\222\365?\204w\0317\264\364{\322T\273\232\024\256\303\246\201\317Z\033Q\r\177\343'y\236\344y2h\016?FQ{\361\223\376\007\341\335\277\3771\3626\240c\214\333\277e\025\320\222W\266\277\267\236Q\201'Jv\021 ^\204$VN\306\202\210\216\035\017%\206Z/\351\305\377C\024/\326xD\345\2711\236<\255_rC\246\351\362C\341Hg\234\377K\336\365m\311\016.\302-{\326\022\240%?x\017i\252zJ\036\362\231\316\325'\034\263\253Q\032m\254\001I\b\324:\310\307\t\233(\222:b\375*\314\304\002\206\017\202\306\021\n\377L\267?/9[l\262,\023\036i\262\375\331\3254\226\221,\237?\204\366\001\366&\2203\306[\2641\306u\002\032c\034\317\357J\377r\004[\034x\200\277\305\027\2016\336P\003\304\211\tDB\306\323\370\022\222\3774\346\036\2519=\233\340\210N\317&\350q"
+	.ascii	"\2376\016B\201s\003C\351\036\022\016\031\362\344m\\s.b\314\272"
+	.ascii	"\024#\244D\256\210\266\fb\250\241<G\b2\016\221\b)\210j8\200\""
+	.ascii	"\232\2512\017\022\340\345\\\212\274\350D\202\n\nJ\312({\310\371"
+	.ascii	"\3248\242f\241\231\305\223lF\206\362\324\f0qu(%u\263\344K\344"
+	.ascii	"M\222\270(\302A\324\377\022\203\275Kl\277 X\024\376k\032\256"
+	.ascii	"\016\353\206:\220@$\375J=\353\300M]j\223@9\225\245>\257\357\316"
+	.ascii	")\231\305\207\326\342\212o5\315\027:o\324L\220\003\226\205\240"
+	.ascii	"\374\203\n@8\276\232n\323\310\001B\305\337\220\333\243)k\321"
+	.ascii	"\315\021m\333\326\203\3760&~\361\b\207\227h\230\033\220E\361"
+	.ascii	"\203\r\313\246\267\2122\241\b]\270O\b.qj\bG\025\017\353\342\025"
+	.ascii	"\207\241\327\301'\031\314\243\245C\2733\326\374`\367N7\304%s"
+	.ascii	"\246\263gv\202\263jF}\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`\206\002\r\013"
+	.string	"6\2200,\200EI\007l\306B*E\225\2701`\024E\332\3350\272\004\r\t\f8\316k\217Pk\255\265\375\315\265\210\333\b\370\026m\"wJ)#"
+	.string	"\""
+	.string	"%"
+	.string	"\347\345\272m\326\200\022Hli \262\302J\t 5\324\344}\024\366(e\371K\366Q[\206\311\226\013\242\210\235h\342\313\307'h\355,\377qh\213\324\362\031\337i]@\276\222\324J\222\313\333a\224\350\264\326\032\371\bV\214O\\~<\364\363\257Yp\025\334\206\233\340B\334\3453\377A\242\001\017\317\026;\360\303\340G\324ZK\321\214\234\275\266\362\026\376\302W^\224\227\0068\b\031\246\257H\266z8\310\006c\220\223\t\204#F\211\371\ff\323:F\250A9uff\222\202\026\026\2261\200\002\031\033+\017\021\260<F\234#\201P\315-\026\003#\275!"
+	.ascii	"\033qdA-\230\257\274Q\357\352\223\225\274\316\330K[`L\024\325"
+	.ascii	"Y\276\b\327\361\247\253\217\321\361\243\241\367\2327\026\237"
+	.ascii	"\247\314!\373P\241-q\320\\R\247e\316\362\302<\242\205\034\236"
+	.ascii	"\354\215\374u\366Hf\016E\270\022-\036m\027\016k\241\305\2172"
+	.ascii	"\217\244s\205\225\332 \342\365\217>\320\177\372\330\033\240\261"
+	.ascii	"\257\223Q\035z\273\025\214\023:\036M\347*a\013\t&B\031\225\007"
+	.text
+	.section	.gnu.lto_.pureconst.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375 F1\002"
+	.string	"B"
+	.string	""
+	.string	""
+	.string	"\026"
+	.ascii	"\200\004\001\232\004\003\200\004\005\200\004\006\205\004\b\205"
+	.ascii	"\004\t\271\004\f\030\r\205\004\016\205\004\017\205\004\020\231"
+	.ascii	"\004\021\205\004\022\205\004\023\232\004\024\232\004\025\230"
+	.ascii	"\004\027\230\004\030\204\004\031\204\004\032\270\004\033\264"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\345\007"
+	.string	"B\f&+\220)\031\0160\317\330\377`;\312\344\177\030\256\337]\342e\256j\261\234\025=A\375\320\327\243\327\b!\334F\n\242\335\366&D\312\0247<@0\250;\255\351\227G\013\242r\005\2029\260\360\252h\035\357\267\270G\371\244\215\232\366H\347\244}>C\320\3438)\241\034\241Sj\005\224\346w\312%\365\032\3008\246<\350\224\224K\332\f\0020F\312\277\361\270\224\003\225\205\002\303EL\334\332r\363\326\206\312\330\222\230\253\307~\363\276\262\200@\346<\252\262A9\221\227;^\317\213, \240\202\231\233\362\343I\214\021\302\305\320\273\022\374\226\321\265\241\260Z{3\264\374EY,\262\376Z\215\016\354d\271\205N3\304\210\316\242\313\222\345\332"
+	.ascii	"\361\005\230\347v\357K\206\001\b\357U\210WhUh\013\263\320\202"
+	.ascii	"\207\301t\204\\$\2039\347\351\035\333l\233\233\211B\227\346%"
+	.ascii	"\372p\363\0330\034"
+	.text
+	.section	.gnu.lto_.lto.4a51a15b232cbfdb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPortIdentifiers.30.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375 v\345\002"
+	.string	"4\004i"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\325"
+	.string	"\001\007\005\001\006\025\325"
+	.string	"\001\006\325"
+	.string	"\001\005\325"
+	.string	"\001\004\003\002\002?\202\210\200\300\001\1773,4-\305\001\304\001\303\001.\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\n"
+	.string	"@\bT\343\300\004\230G\300"
+	.string	"\314&\260"
+	.ascii	"L!)\327\017\240\b"
+	.text
+	.section	.gnu.lto_baudRates.32.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\025\006"
+	.string	"\302\210!*po\326|\375k\213A\252\277\343n\220\265_}\252\327\037\353\375\215\246eUUU\345|\330 =\317\001\276\301\352\244Q#2\311u\314\2315o\346\\\336\331\334\363g\320\347\241E\217\032\223F/m\3724\352\324\252W\263n\355\372\305\030\266\210\330\362\212\022H\035D\255f-"
+	.string	"\315\334\272\220\363\304\333\375UF\304%\220\030\257@a\222\003\007y\t\217\260,\304\316\324\253\263\3115\374qoSR\331 \367V\257\365C\034"
+	.string	"4\023\004\306\325L\0160\027\\\004\303\300m`\004\270\b\206\201s1\355R\\-\304\242\201\021\340\006\264\013d\300]\320\006\310\215y\003\332\0058\240] \204\314[\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_serialConfig_Registry.36.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375 \222\035\004"
+	.string	"T\007a"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\202\200\200\374\342\303\357\341\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\345\006us\375\005uq"
+	.string	"\005\001\006'\001\344\r?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/io/serial.c"
+	.string	"\004"
+	.ascii	"*\303\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_serialConfig.37.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`$\003\265\024"
+	.string	"\006\244\201J\300RN:\342%\341\325\357\307=\274\n\272\271\245$\314\303{\344\201\252,g\361\037\r(\222-\234\257O \022m\333f\335\217-\321s\362\352\f6\013\205\204\b(\bP\002X\215W\320q\201\235T\"%R \203l\262wJ\001h"
+	.string	"d"
+	.string	"r"
+	.ascii	"\037\222\371\200\335\235&\033\273\244\003\233\210\257&_ |\025"
+	.ascii	"O |\265\315\376q\262g_\372(\001\343\267\273#Ma\361 y\203\323"
+	.ascii	"\366\n\322i\363\211>q\230rRG\273\333+8bs\023\025`G\002\204\371"
+	.ascii	"\254"
+	.string	"P\324\354r\023\\\221s\372\242O^\220R\352h\227\3639\"aw=u;\234;\274\355\020\266!\330\364%=\334\334\242\324\310F\b\217\272NC\335K\341\353\225\332\"F\314\353\\\"\364#\344\212\206\336l\3626)\217}\230\217\346\307t\307v}\350\257/\3579\247/ e\177>\004J\273&\266\264\326\251\366T\274\274}\322/r\361\027\266\227N\022o7\242QYu\265\273\257W?\020_\025\200'\261\375i?\350B\266\223\272h\214\216\025\215N\016\307\355\224\363xr\342\021\001r\20671-=i\375@\r\327\241\224C\013\250^%\2647\374\206J\217\347\272e\375\260N\355\225\327`1\231\242\021c\320\263\273\260W\273\345H2qw#\314\200\351``\312G&|\r\221t@ps+\346G.\342\356\f\314\217q\0313\360>\257\006Q\013\257{\365k\364E\007Y\334\262Z\004\262\267\3108\274\314&"
+	.ascii	"0\313\211\207\025\031-V\033g\262\361E\266\3422\262\320j\343\311"
+	.ascii	"\001\317>\304h#\314lF\033I\310=\3351\005\237\023\216\346l(\013"
+	.ascii	"\257B)!\301Q\372\365.\234JE\254p\002H'\b\013w\224\320\306p)\224"
+	.ascii	"\005Q\261\004=JN\364\227\257\310\257R\036\217\354\240.J\251\346"
+	.ascii	"\353\223\326\210wR8\351\207J\252\2319\344\340\356.\330\340\001"
+	.ascii	"B\250qH\303\2242\025\b\211\0042\023\0264\017\320\002\2219\352"
+	.ascii	"\001\021pQ\024\220\310\220\251G\033\355\242\242\360\305\025\036"
+	.ascii	"S\224A\205\216\222\372\257\013\306Vqq \237T\034b\341\267 \226"
+	.ascii	"\360<\330\202\376\222$<^\215i\256\303\253q\311\0317\3572\031"
+	.ascii	"\353\362]&>\241A\265\231\351\210\300\tR-p\263\030j\230v\341\300"
+	.ascii	"_$\265\301< \342\242\356X\227\227\347]\240\"\336\316\321\214"
+	.ascii	"5h\240\343\216A\352V\323\261\b'x\211\202\n"
+	.text
+	.section	.gnu.lto_lookupBaudRateIndex.38.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`\223\001]\020"
+	.string	"\306\036nG\360\260(\035:\030b9\025j\277\356\202@\370\376SU\361\246\277/\251\316\335)nl\016\352\"9\373\244\203\037\365\362:\317x\005\323\335\244\343\017\0135\022[\013\354\025\n\210D\303\215\303v%\240\255\204\220\275\267\334)\005X"
+	.string	"W"
+	.string	"Y"
+	.ascii	"\3632^\300\274\\\031\007x\254\367\204\247oS\306\205'_"
+	.string	"\345[\334\235\0230\034\237*\202\274\310\244\270\354\220\365\241\340\244q\271\024y\321V\237\206\307\bR\003\302\003\307\307\022w\004-\347\363\245\340^v\004\256\236\325\347r\270\205PJ\rW_\206\233\273m\226m\006\366I\004\217\375\233\241\345\353\035_\357\225\3200B\037\300g\303N\207\nJ1\324l\320\025\022\347\303\353o\233|\231?V\320\300\364\232\302\321\231\215\326\202\301\240\264v\\\332\203\360\261\n\356(\205\3211AiM\340\003\334\345E\034f\362)\326\016\337\306\022Bu3\203\322\352\031\370\200-/(X\2034\032\032\034d\334\270\273,{\267[\221\027\255@\265\311\211\333\362\266pI3\027)X\303\302oJ8JS\037\376\3546\243\370\327\245%\224\346W\227~i^\302\355p\342~/{D\341\252\251n\254\300\332\356\310\250\211\261\333\262\253\n\374G\211\026\026\336\030w\\\024B$&\"\031B\001= \231"
+	.string	"\202\300y\304#\002HD\n\225\274\221\3103\021\201J\274\021R\311\363 \340\321I\210\344\241\214F$\257\322o\214Otb\323?\315\313\336\315\350\\\210\335J\271\016YYT\213m[^\300#\271\225+h\326_\314xR\260\306#\245\224\316m=e\306\345\034\300\\=\001  0\002\202\234U\035h\t\376\\Km\206\327\236\272\344\f\273"
+	.ascii	"\324|\301\345>\271\005\013\001\210f\022\026\367\345aC^a\017m"
+	.ascii	"\013\272\345\311m\203\237\004\226@\300\375a|B\023\017\374\315"
+	.ascii	"\260%,\301)\202-\004\256\261\207\262\342\033\235\366\221\001"
+	.text
+	.section	.gnu.lto_findSerialPortIndexByIdentifier.39.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`}\001\325\017"
+	.string	"\366\335jF\340\262(\0352_\005\033IW\244\205\200I\205b{D\375\n\340A\317\374\275\237\305\003\207\024\025\373z\347\323\332^\351\361\013I=u\321\177\2218N\21416kR83\277'"
+	.string	"\205\212% RTB\366\336r\247\024W"
+	.string	"T"
+	.string	"X"
+	.ascii	"\361\002\346\245\206\360\366\370\272',]\2332*,\371\246kQ[a\301"
+	.ascii	"\001\362\251\304\221\035:\\\036;\\}(8Q\264\\:p\335\250\276\016"
+	.ascii	"\217\261\001\013\025#@>\fQc\262\233\317\227\202\372\330\023\270"
+	.ascii	"d\252\257\345P#\331]C\325\307\341\336n{e\233\201\375\023\001"
+	.ascii	"1\277Th=\354\206\020"
+	.string	"\372\333\007\306\206\310lw\303\254gk\310\032\023\207\335\376\313\217\301l\263\231X6\331\214\f\235\335\r\271\364\202\355\362v\311\376\300\307\\0\200\335\227\236\030\273\253\300\007\266\313\2578L\311\266\211/\021\337[0Tf|\354.g\340\003\346e\207:e\n\227,\003\b\024\234A-\241\352qCF\205\252\351\312\005R\247\234\250-K\275z29R\220\307\302_L\330vS#\276\213\317\220\342I\\\232B\312\274\352\322O\231\227\327\307\216\340%g\247\346\004g*[\331\241Qm\331/\023T\026\r\017\r\036\254,[\233\017\025B'\242Nz\241\356A\207\"\n\235t\001l\002\202P\322y!\0227\3528QW\022\2013\361H\034\210\200G\022B\036\2072\032y\334\307{e\371-\276\351\314\2401Aw\324TUMrR\324\007M[\376\270\310\251\212\003C\016ue\233\t\365?dpR\220\347qww\212\004\036"
+	.ascii	"\022\023D\246& \275\033\321J(\267\346\027\025e\353\3514\030\322"
+	.ascii	"i%\307x\204\233\307,z\346\255\002SP\3278 \204D\t\341\230\361"
+	.ascii	"taK]PS\344C\205\373g\0062e\t.ET\013\201Ac\257(+\324\215N;\311"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByIdentifier.40.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`1\002\255\023"
+	.string	"\326e\205I\320\322(\035R\332\034\230$}nJ\266\206}#\343\\2[7\331\333*\345\225!\242\200\272\203\312sH3\204\336\f\374\365\207\024\347\320F\340\367\351\305H|\301\r\324\223\315\242"
+	.string	"\005\254\260\233e\264\003\376\243\222O\366\226;\245r"
+	.string	"k"
+	.string	"q"
+	.string	"\007\346Y\274\205\314\263\002\243\216M\352\205G\314\356W\353\250\362\370\001\340ix\001\340\351\232p\3709\336\240\234\375\004\322\271r\346\263\3744O35;Fl1\263D\351\007\316u.\022\\qsZ\001\007\244f\373\3609#\270\33091b{\231\233\353\3318\357R\306F\223{\335\245\320\222\316\250\307vsy2\251\265Z\326l6wx\3336\333&\266\244\0209AK\036Bxsl\324\307?\004-M\237\273\347w\367Ri9\245/b\201\304O\211\344\247V\232&!5\007\025J\361\335\237\273\264o\037\206\317s\312\337\315^ajP4/H\020\302\323\3332_\347\224\0338\220=\247\022V\025\247\336\355(\251\3261\301\251\031\204R\332\347\371\013\331\307\225\031\240\322J\200"
+	.ascii	"\252\265.0"
+	.string	"\202\3604\022W\363\351\240{\363\223\206|\026\334]\031\033\240\265 \315\2759\\\2710]\017\232\fb\033\303\201V(\221\357Wk}\360\203\002 \347\333\251q\237\031x*\227\022\371\230x\374\0313\005:5\333\035\336\203\"A\247\326Z\022\3432^>\212So\210\311\327N\375\030x\n\356\026\325n\346~\317;\375\341\214b\206\264\310\246\355\3150\005\355\336\354\221En\255\224\025Kd\271V'(\016-\226K\244\260\226xALq\265X\242\210OH2\254DX+\246z\211*\227\270BQ\235\300b*\022\002~ih\301T)\257\027L\225r\375\346\370\272O(b\352\375\200\247\361\363\216J\032\362\231\273\224\256MZ\326E\304ioF\335\240\250\2455i\231\373\320\035\321d\220\317Zk\005\367v\025p.j\257;\305\301\341\200\031\341\"\233\002& 0\002\204\030\324\035\037\202\230>C\301\335NR\352\357<\265"
+	.ascii	"\024\016 \270\341\r\026\331\027^\354-\2561\230\200\023.8N`\001"
+	.ascii	"#+T\366p\310X\3207\271\031\r\342\230Q8\032`}\361\324\351\203"
+	.ascii	"1ru\371&\311\002\310\024\036\347\215[`J\255\324:\002\312\032"
+	.ascii	"\234{\265\357\t"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByPort.41.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`'\002M\023"
+	.string	"\306\344\201I\320\224M:\223\231[\022\240\271B\345\037}]\003\300'\333\036\341\"\322c!\026\200\223a\305\266\032\235l=f\3321\267\311\002E2\300\355X\216\006Or+o\240/\f\203\313\261\314\033\344.\360Wfh\"\215\354-wJ\001n"
+	.string	"g"
+	.string	"n"
+	.string	"+f\334*0\002\365\224\3308\341\264`\252u\374<~"
+	.string	"w\332]"
+	.string	"w\272#\334}\2167'[Gqt\256l\3714GM\224\016\317\016\023\021g\242\004\001\362s\231Kr(|N+\b\031\205b\207\317\t\201\205\020\t\023\321f.Q\315\306i\2279\342K\356e\227H7\227R\221\350s\211J\251\265Z\206b\317\335\335\266h;\305\226\023\002raGC6|\360\302l\357C\177\307Y\232~\274\347g\367Ji9\245O\342\331D\b\261y\370\224j\335\2719U\034\024)\350\263\177\274\264o\237\310\247\315Z\2577<\336\216\315\355Awz{\306\227\271\304\f\032\314|\214\351\352\tT-vd\251\326\021\301\251\027H\371!\231\007\250\025\346T\243\326Q\201\017t\247W\361Dr\320\215\371KIO\313\355n\216\r\274j|\314\215\271[\271\254\031\217\227l\262\315r\0322\324F\023\252\265:\230\001\002 \2721\305\270\214\026w*\227\332h)\206|\030\255\004@\241m\r\177\001F"
+	.ascii	"\252\265\242\270x\r\203_\342\324.0\362\341\251\017\303\235r\273"
+	.ascii	":B\237\271\337\323N\231\202n8O5\362\2665\035#G\2731{\244\t\252"
+	.ascii	"\227\324\312j\245%\245\342eP\255\264\254\350\013\013\244@b\225"
+	.ascii	"\023\013\251\025K\345\362\201\253\257e\225b\371TX.\337\t\001"
+	.ascii	"\203\027T\254\357\005\004Y_\211\353\027\346\313.A\211C\315\210"
+	.ascii	"{\321O\273\267\224\3644w)]\247\324\254\013\004jc\366nPoi(\235"
+	.ascii	"\363\037\263\036/\331\364Yk\255\334\306\036\303\315\365\366\262"
+	.ascii	"\323\237\240\"7!\\\362&\327D\030'  \002\203 \324\035n\315\177"
+	.ascii	"\bw\372\f\005w;I\251y\347\335\002X\370Yp\271\013\206#\330\213"
+	.ascii	"\316\2106\006\333 \257\013\300\tD\300\276\205\312\016\207\210"
+	.ascii	"\005}\223\233\361\020\307\210\262\321\200\346\r\r\004Q\220\362"
+	.ascii	"\023\232p\340o\006\262\265\004\247\b\266\300\\\255\334:\002\312"
+	.ascii	"\232\316\275\332\376\004"
+	.text
+	.section	.gnu.lto_findSerialPortConfig.43.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"=\t"
+	.string	"f\222A8@\217\322\001@\3750p\032\231\016&c96XS&\013V\324\335n\211\305g\375dRV\323\232\021\314\206{\377\260*\n$\375zP\250\021\2241)V\310\340\266{\247\0241"
+	.string	"0"
+	.string	"0"
+	.string	"\005U\205\322R\027\025\254\226\335:]?\200]f\027\300.c\352\245\303\222\177\221c:<N\350\351;\004H\330]CzB\335\361\2667\2669\266]\002\226\257\177\3042)+\b,\273\026\257\227u\311\026\207m\222\255\331\206\320~\310W\244\327\b\007\354b\274Pv\353\2017\331\245\006c\333\3778\b\311\245\023\361s\006\177\253`\006\377\310K\274\214j\327t\352\223\234\345\340o\\Z\344\301\323K\337{\200\200\247\206&+\027E\374\354\372\301\250a\037\2631#!n\033yB\236Bf\017\207\241\263u\037\321\344\266\031\332:\240\351\351D\223C`\256\341\323\315\021\307uS\253{\313\2501E\tk0F{\001\004Oe\314\264\\\001\013"
+	.ascii	"2\003\302\260\343\216\213\367\320\226\0139\307\0306\251\r\016"
+	.ascii	"\214\021\320\304\223\222b\272&\031"
+	.text
+	.section	.gnu.lto_findNextSerialPortConfig.44.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`{\002\265\024"
+	.string	"vf\210J\300\322Q:Sa\221\224\361\020\240\311f\316\003\236\254\205\345eZ\360\020\023\220\036\241\001\214\n;!x\256\227Gu\363\343\345\377\352\322\215\332\301\366\251TD\020\004E\324\262\211\f\027o\377\350?U@Zi\354\006!d\023\271S\nt"
+	.string	"k"
+	.string	"u"
+	.string	"2&rI\265\356\032\030\001yj \374\317_\304\2306`\307S\263\332\351\271\r\001k\335\225\336=\200xJ\036\200x\272;\246\223v\221\216\341N\232\017\342\"K7s\336gNg\233\324D\205\315\307\t??\234\356\346a\370"
+	.string	"\210\305\t\226\356\026\256\020\321\357\276\317\234Nf\356y?\260\342g{2\322\331|\216*\265VO\234\256\346&o;\204\355\024{\372\004;\367\276KHr\021\234!a\233\301u\362!d\264\253c\357l\023\205\207\016\024\336\034\373\273\237E\342ir\247GqZ\024\247)\235\016\303\351\335\351\371\336\375\222\016M\300 \016~\324J\023,R\233\250\222\317{\267/\344\373\274\362{\264\327\031\021#4;>@j\335-8uI\236\336\216\261W\266\347\264\037t\0301\337}\bMj;\353\365\220\231D\314Z\272\342\206Q\267\021\341\322\375\255\312\024~\243\002ub\002\332Xj\225H\375\2005\256D\023O\303\245NLC\202|$\032\003(\234m\017?\262\360\243\224\013\247\321\202"
+	.ascii	"%\3433\\/\026\026\361\224d7\nw3\356n\201\241[\325\\\033\366\""
+	.ascii	"\227?\361\324ZQ|\242\307\310\340\367\234\272E6\217;\365e\342"
+	.ascii	"\351qBj3\350\337E\034\003/\230\326\nl%\326r\215\304d0\030W\214"
+	.ascii	"\003\006\322\256\023\r-\330\354\365R\312`e\f\326j)]\263\227\362"
+	.ascii	"D\200e\033^\263\022F&\233\225+\327\316{\204' \"$\372\244\337"
+	.ascii	"\367\221)\252\252\360K\222k\225\332\332R\210\253\343qK\364v\344"
+	.ascii	"p!q\214{\336\025,\375Z\004\325f0\254\265V\272:\376\267\b'\347"
+	.ascii	"7n\216?EU\265$\373\315\231\300\021\216T\230@\024\0030 P\202!"
+	.ascii	"sV\007\241\207LsWbkz\232\021\245'la8B\260\002\324$L\304u#\371"
+	.ascii	"?\212;\351\024e\026v\247f\374\227\251\222s\021\360\272\222d\371"
+	.ascii	"\035\020\350\237\243\270\033\030\021\367\310\250\201\003X\002"
+	.ascii	"1pP\023]\343A\222\035@\243W\204z\312\b\031\024\213\274J\201\307"
+	.ascii	"\251m\371l=\fU\211\216\3146\022q\206\214\326\330\271W\033\236"
+	.text
+	.section	.gnu.lto_determinePortSharing.45.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`U\001\035\017"
+	.string	"\026]hE\360\262&\035\270C\267\350\203\341\273K\354\300\022\340\261\350d\240\360\365R\023\226\216\316\355\346,/\335(`\262\037Q\345\257\2665p\003\031T\271Md\023\251\276\243\002b\274v\fB\374\370Y\306\"\223F\366\2262\245W"
+	.string	"P"
+	.string	"V"
+	.string	"\273\237&\362\020\354\021\276"
+	.string	"\366\2506\357\216E\250\331\371 \236\312\261\017\217P\204F\020\b\222\227\001\036\250q\371\201p\201L\r\030\222\307\202!>4<F\036K*tp\343\342\202\344\255\300Q\213 \024\337y\276x,\231\"\222\335uj\360:\334\242\333\336lC\260o\023\326\226}\235_\364\357\2061\2551\2350\375L\200\b\237\b/v9\274~\354\215\030\303\204m\225=\262\255y\035\fp\300\262hr\032d\332w=G\365/\345\004v[C0v?\006N\220=\372\313l\3738W\241r\007\277\021\236\350\247\247\205\247G5\371\r8;dDm\205\220I\22108<\344\200\n0\325\337\2104U\025\233\321\022\263\222/_S\3372\264\312\227m\356,,d\273\254\007>O\n\225\355\356K<^\021"
+	.string	"\271V\371\272\322\234X\001\244N\301\242\306\310\220\330\001b\245\017\373SI\255\261\017ww\003&nK\225L\027N\262\t\333\211\211\223\220:q( .\215P(\331N&(\215\3334\323VRA+\235P\332\210\001s(&'-\305q'm\364\355\341j\313\237\021r\345{\236\360\357\260"
+	.string	":\204l\304|\207}\347"
+	.string	"f\204\\\352w\030\324\027\333PM\262\322\025L\003\031"
+	.ascii	"]\204\036\230\005\3102K\2001\260\001\2521B\r\200P\270(E\3030"
+	.ascii	"\020D\035\215\273E\020\220\025\022\256\031i\"\310\330\202LB\226"
+	.ascii	"`\204@\205\203\273\202\264\301)\204\226\204\332\241\202i\006"
+	.text
+	.section	.gnu.lto_isSerialPortShared.46.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`\233\001=\020"
+	.string	"6\237nF"
+	.string	"\261&\035;7\240\bP\323\364\311FCh\203ZP\n<\257\324I^\027\220\034\377\326\013\3650\256N\315t\005\266t\210@4\241\242\001\220\240\202\356\036\nk\305L\260\337\260\273gWm\333\264\005\261{o)S\nZ"
+	.string	"Y"
+	.string	"W"
+	.ascii	"\321\337\013\310\307\354 \362\321\266\0338H\331\345\237\b\232"
+	.ascii	"\333\310\210\321\3211\347\247\255\315].#\\u\361\317\363\022\023"
+	.string	"71dX/\227\035\0367($\3159E\254\225.\004i\365\300\002\2604@\021\330\353\303y\2563,\225*H\302\234\323*\303\342p\203n{\3056\005\373>\001\377\370\316\237\035\347\227P\035\245\032\202\324\013R\253T_$\240D\r\b>s\322\304xL\032\021\006\t\333)[d;\252\270N\352;,p4W fD\310\036I\020~G\221zN\006\035\315\225\212\206A\3668RU\373'~\223:N\313\007\314\351\372q1\347\267\300\b\262\007!\022.\311\307~\341\036\260\261\177\265zn\300'\220\273\207\245\310VwW\346\210\361\240\322\230\277\272\217\351\001\2431\333)g\241\222\315\271z\340\257\360\272l\304\3437\004\007\016\214\306\256\260W\353\305\272E\312%\371Y\351\016\373{\321\255\261\017\347\234\323\353\262\255\016=\347\001\\\267\241L\034K\t\nj\253`\301\304+\241\234\b\244\234J\023\270nC\2318\226\023"
+	.string	"\027\266\023\256#Ay\335J\310\246\021\f\245\31539i\335\246q[IE3y'm\304\200\273\025\023OCu\235\247\211\276y8\327e\215\n\256P\344qgl\207\226\004\263*\307\rerk\344\206x\265Z\304u\005\037"
+	.string	"M\204~ea\314\221E\314\024\001\201;\225\0324\206J\030\004p!\026D\224\026\247_\226Q`\020\250\ta\260\257\270\346D\254\210A\370`\024\\\006F"
+	.ascii	"\34135\n.k\232N\324\342\246$\024\243f\317J\203\254uB\001"
+	.text
+	.section	.gnu.lto_findSharedSerialPort.47.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`\226\003\305\032"
+	.string	"\2061\257J\260XQ:\360'i\200\301\326\021']\013\224\304\214\027u\315\2566\307f\372\244\205,/A\207\035r{\232\355\030W\373\252\325O+o\301\366#u\002\021\344\265\037\336\303\321\177\2003\037y\033b=\275\266!B\b\331[\356$\003\232"
+	.string	"\217"
+	.string	"\235"
+	.string	"\300\017\371\371\211\202\355\2753\252D\335{.`\004\344-"
+	.ascii	"\372 W\372\341\233\201\363\327\033"
+	.string	"\205U\206\214\f\357=_|~\200xK^\200x\3338\230|=\317$\275\275$G\321\326\2467>\320\313:\252\330e\371\225\335\213\372\240\212\n\306\231p\224<p\243g\364\321FHUu\324{qQ\003\220J\307sq[\027 !M\271xB\325\306\311\311\350P)hu\361\206\352M\222S\"^\216\366\231\236@\310P\311\352\250gt:R\270\3672\325\361z\347\2313s\0223\233\314]\"A\364\252\203*\254\242\272}\314'\216^\312O\367\343\266\301\354b\3124\255\027\371Y?\377\2317\235\313?\235G\246l\037<W\222r\217\224iS~\315\255\307\260JB\230{W\\\215\271R\226\t\217?\375M\177\360\315|\346;\361\241\230\365T+\nr\321\200\204\237\344M>\277B\273\262'\234\252@\376\b\237\211YA\034\022hG6\t\255t\271\367Tp\3139\344\355\231\177\230Y\314\\\211|\351\347ENT"
+	.string	"7W\343\327\200\274\275\251M\231\037\227\246K\2440V\300\323\360\201\033\2125\306\355\2433\221]R\027\373\232\330j\034\031HKZ\b\320n\346\r\034\350u\255~\325\214\\\0031s\207S\361"
+	.string	"\241\b\314p\212\224\235\032,_\222\240<\212\217x\333}\250\327\037E`\254\200\307\022T\232\252%D\332\264\245-9*\206\003PV\277\313f\376`\322\353h\337\b5\020\317\364;\002\360\311P\231;\361y]\307\314&\336\004\366\247\251{s\017bg\2623\341wo\316A\324\227\310\370;nY\004\017\275\356\226\317#\336\226\r\\\322\265\b\261\035\263\266\301F\233a\250\211\331L\035\231N\217\t+e\317\ta\223q\320\211\321\314\0205\033\0215\323B\317Lf\203\365\370\200h1\214\301\bSF\213\325^3\331\253Gf\362\274`\264\332\213A\001\236\221\210\321^\266\331\214\366b\235Ao\033|#\317\021\212\t*!\3717\361P\237\331A\246\214H\323\3266S\bj\\\216\262}\\\352\030]m\201P&\272\227\327{\357%\333\3078bmW\237\351\226\205\220+\241\0308zE\251\357\t\030(c\373\270\245\310"
+	.ascii	"k\253\307&\262p\251\013$\337\n\211\f\344\275\001E\250q \245\214"
+	.ascii	"b\212 $\"\"B\"\221:\220\002\031\2631\017\020h\2134\205e\fy\364"
+	.ascii	"\264v\r\305\217\312F\375\200\316B\375\022\312`\340\005\242\362"
+	.ascii	"\360\375\271\342\033\261\312'\266\210\3328\247\203.~Cl\334E\301"
+	.ascii	"\031Q\336e!\332\270R\226\213\002.u/\177R\231p\350\026\236\t\322"
+	.ascii	"!\200 \t6\313\223A\242\303\324\253<\233\363\317\314J\205\322"
+	.ascii	"q\260a\376\020\300\224<\201S\254\260\236(\220\035\023p7\016\371"
+	.ascii	"\005\n`\276\350f\0041\307\313\225\347.*\277\006M\003"
+	.text
+	.section	.gnu.lto_isSerialConfigValid.48.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`\315\005\265&"
+	.string	"\212F\204\017Fp\334Q:\203\3527@sA\027\311P!Y\371\321\177\350z\376\206\231til\241o\260 \030\207&t\345d\262\016U\355\322\350?0\344b\333\315\267o\333\267\315\256\210\260\3446q!\200\372\366\177\311\337\204\310\235d\344"
+	.string	"\322"
+	.string	"\351"
+	.ascii	"g\256\342\217\361\216\257\244R\262R^\255\n\315<I\247\243\\!\255"
+	.ascii	"\225\371\311S\251\272\230\214\007\335\373u\246\313\275J\006|"
+	.ascii	" =\312\312\023\331\243\351\205\354\321\007\021\252Xxe\021\255"
+	.string	"\203e\025\313\362\334\253\3745\021N\177*\317\274*\274\257\307\333\351r)\316\242gW!\337\352\276S\301\361$\032+\326\336\211\273al\3634\343\217sB\033[\217/\207\225W`\b\227\327w\276\255\242\216\211\321G\315\235DZI\260\236f\354q*\230\343\345\316\233/\300\304\310\243\246\237q<\356\264\020F\207\326\323\214;\316zd\255m\267U\254\366D:\226\311\3614\243\217\323@\032!p\210\025\355\372\351\333\242q*5_\263\266\256j\177y\005W\314\222z\202py\275\342.\334{\271bmq\235\177\316\374%f\016\301\214n\b\307b\346\016\327\002|\0307\367^MP\361,Q\351\275W\022\260\b\223\301/\213\204\035\345\313\260G\227\372\315\243:\256\214\301\3221\243\2765\363\206\036/\335Hf\245U\355\257\346\305\343\305\375\305l\200\351f\347\245\213\375\005\320\312Jh\345$\256\214\364\262\363\221Q\021\256r"
+	.string	"\256Ld+\017\331\312B\2662"
+	.string	"[9\310V\006\262\225\177le\037Z\271g+\363l\345\235\255\254C+\347l\345\324V\306\331\312\026\255\214^y>m\345\212V\376\201& G/0\033\255\246\274Zo|.\032\364\213\222\233\375e\277\362\315\314\3447\315`\374\022\2159\2565#s\356UzH_\205\277\344\335Q>\331\255T\275\214\317R+c\312l\202\315\271\367jH\217*\235\001\215"
+	.string	"\311VmTy\302f\033\311o>\307\246\313\314\311\324|\266Q\027u\326\202\017\365"
+	.string	"\244\032\231\2317\241\036\352\024}\210_\206y\222G-"
+	.ascii	"-\324#\264\024w\0045P\003h\ne\304\343\t\324A-\002\355\247y\r"
+	.ascii	"\324NZ^\303J\220-_\377\364\017\255\327>\006\177\367\272A\237"
+	.ascii	"]\247\315k\002g\315#K\233&\272\336u\0026\271\326\325w\256\023"
+	.ascii	"\224\021\335\272v\33284\342\022\334\02449x\316g\3266\256\005"
+	.ascii	"\304A\333\366\213n\013\376F\333\322\301\302$\272\r\321F\236\312"
+	.ascii	"\0325SO]a#\036\207W\303L\2729\033\311M6)\245C\366\346\252\356"
+	.ascii	"\341\277\311\276\223\232kq\307\260\276\361\273\366i\247\350\306"
+	.ascii	"P\007\203\002\255#&\312\027/Q\016\254\234E\351\"L\006\371a0\032"
+	.ascii	"\255#F\212\330\267\300\200P\344\336\253(\200'\244X\350b@\231"
+	.ascii	"\220\002\242.\244^\0041\270\230\n~`\321\"\212\247\342\t*\005"
+	.ascii	"\206 \b\024\300\023RA\fB\374\324`\005\t\340\024T\213_\020\370"
+	.ascii	"\223\002\222\210\372=M\265\3705(\342 \013\250\251\237\213`p\352"
+	.ascii	"\267S\336\367\027\177\354\031\326\3160\271\364~\241}\363\034"
+	.ascii	"\326\222L.\270\2439\022R\327\036\036}'\317\250\317z*\033\240"
+	.ascii	"KP\331\263\00349\2213T[Nh#"
+	.string	".\3515\222w=v\251\236\256cu\372Qg\361\271+\352\217=\265\203\303\255r\326Q\337\355\347\275\367\362\032y\324\006\372\313;\345\bC\246\266\254\r\345\255\206\232\235\320\022\365\305\200\352R3\223x\252\307\"\352\0018\272\320\\\265\025\207\r\327\264\351\224vr\310\336\240I\245#\001\013c\3135\222\177\366\244\256J\322\264\251y3\203\314\024\260\264\221g\232\022\005\007\216\314\207\002s\250Q(\303\fsH\251\021\031\221 \243m\306`\002\031\262\243n\020hi\322\fc\032\223\266\211\252\203\266\256\fB]\261\252\203\211\345\030Ci\177\275fh\230\033/\344\310J\206\213~$\302\265%\326\2610w\006\254`\346\227h\355\004\372\317\367\"\344\371z\347\023\035\332\311\342!\252\331S\265\251\327R\214@\034D\300\267\261\323\261i\370N\312\277\177\266C\313#\276\276\343j\272\034\023,\031\212\303\034\334\001{\273\203[\274\334\206"
+	.ascii	"`\361Q.\003\232\240f\247\204\356LA\372c\3153\207\267\002=\246"
+	.ascii	"\020<\177\271C\356\301P\016\213eW0Z X\ru\255\367W\016\002\207"
+	.ascii	"h\336~\016q\016\2572\3018\217\343\253\331$\257\253m\346\231\257"
+	.ascii	"\220\017O\205'\243\262\352X\020\327lU\264\204\327Y\277\220\235"
+	.ascii	"\005\\(\231\235_2{\211N%\360\373\242\346\017"
+	.text
+	.section	.gnu.lto_serialFindPortConfiguration.49.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`I\002\r\024"
+	.string	"\266f\210J\300\020)\035\272\342\376\247\325j\0078\244X\300\336\336\307)\366*3\024l\\\334\263-\346\324;d\250\314H\246\336\346\247\255:u\240w\247'\253$\n\3336]\227\254\230\213<\3071\021\377\345\364A\324\030\035O\032\331D\356\224\002u"
+	.string	"m"
+	.string	"u"
+	.ascii	"\342\351\001\360(\236\242\305\265\002\244NMk\247\t\346\207\252"
+	.ascii	"V\322e\362\003\302S\361\002\302\323\005a\361 y\207\263\366UH"
+	.ascii	"\301\2355\337\345+p%CS\343C\007\003\216D=\335\274w\233a\t\233"
+	.ascii	"\323\b\276\252\234N\303A\260\201\n\236\235\017\035\006p}J\031"
+	.ascii	"/?ct\270\271\357}\306\230\272)\t\351l>W$\265V\317\234\256\346"
+	.ascii	"\026o[g\233\304\236&\001\233S$\225\201\2037\307f\211'\377\325"
+	.ascii	"\201\356\320\323{\336=w\372\036\367@\202*\n\302\214Zg\252tT\032"
+	.ascii	"\324h\304\201~\336\247}\373?~\351\226\017T{}\241a\315\354\330"
+	.ascii	"\200\252\225d \336\307\357\271\305\363\221\350B#\226ANP\265V"
+	.ascii	"\220S+\020Oo\267\330-\333s\332\357\371\212\226\223,`\200\212"
+	.ascii	"\373\260\201\250\326\232\300\b\002sE\344\246\222\350\356|)\034"
+	.ascii	"\244\r\227\26516\200\2639\201\273\363j\2774\036\023n\376lO8\f"
+	.ascii	"\026\232\204\203\307\250\b\005\300\215)\252\241\023\325\302\323"
+	.ascii	"/M\302q\242\347/j!K9\333\027\356\342\344>\235Z\353\310\251={"
+	.ascii	"\013\024\007K\265\326\005A\027J\361C\234\272\302\312|\356\324"
+	.ascii	"_\tO\303}y\360\347{\312\331\330f\325\22629\212vw6y\233\0011\225"
+	.ascii	"\027l\204\311^%,\0131\230l\244\264\330(aT\221\305`\243\207KD"
+	.ascii	"L^#-\226\342\232\215.\331\370:q\225\320R\\\"\004<\243\020\243"
+	.ascii	"\271Tf3\232\253e\3337\307g\361\007L\277r(\274\357/\317\222\302"
+	.ascii	"A\002Y\273\273&\261\355\rg\265;\267n\250\270\3334A>7\306G\341"
+	.ascii	"\334\357\3405\341\346\357`\255\265\206!\237+\356{\247&|J/\035"
+	.ascii	"n\263*& @\002\203\030\324m\034\202\230>\003\301\335lv\tM4\277"
+	.ascii	"\020e\317\005Lv\203\335\033m\273\\\260p\245\227\205w@\240\247"
+	.ascii	"\342t\3243W\243=xK\036\207\";\241]\267\267P\200\252o\321|\254"
+	.ascii	"\245\033\272\211\300\343T[2_\017\273\033\211\300\244\254$8B\224"
+	.ascii	"5\236{\265\370\t"
+	.text
+	.section	.gnu.lto_doesConfigurationUsePort.50.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`\033\001\275\r"
+	.string	"V\233`C"
+	.string	"q\225\016?c\251$\\\033\343\003\326\253@\215\f\216R\022S\304\f\023\237\r\035qg\331t\243\017\322\314\3540\001\204\232\252\246r\202\375\322\273\252F\020\246\252\023V\032\201\357\371\347;\033\321do)S\nN"
+	.string	"M"
+	.string	"L"
+	.string	"\332\243m\037@02\351_\007\223\243\330 )\301\262\373q\312\341\244G\250I\362\017;lQ\221\202J\225\0361\034fv\027\223\242\220\n;T*\261"
+	.string	"\251\023\324\304Z\031\016{\226\244F29\026\354\256\023\225\272pk\267\335\300\266\002\373\022\002?\214\351\204\351s\034\304\t\013\f\0063vMf5vEL\361\341\257\337\036\3710c\374\357$F\177\211|+\234\\,\240\314d\273\237\307\243\rl\217\376\266L\373\">bt\327\004_v7\2748\261\273\005L`{\314\\\200\366\b\337\021+\020\355z\0310\333{\n\310\266\273\t|\023\242\220\315\303\343U\343\302e\312\3313\326R\241PeYD\213\252+,J1Z\254\234\262\305[B\265#\204\362\250\250\031B\203\214\206\354\244%\373+\245\262\354\303\335]\353\312\332_w\274+\235h\323\361:\236\r\347\002\352<\007\236\310\323u<"
+	.string	"\346|<\330x\240.\304}<\316\343mB8\016(\304}\f\360\007B\007\342D\237\017\210\303|{\270\272rB\217\247j\236Zb[\323\214IG\234\252\351In\230r\246EeA\225XK\0055\023"
+	.string	"M\204\336\031\341%L\021\270f\2104\215\350\265\2616q]'"
+	.ascii	"\203K\327(\256\021ek\002\216\213\f\256,N\311 \341\322\253\312"
+	.ascii	"W\316fY\023\n"
+	.text
+	.section	.gnu.lto_openSerialPort.51.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`\323\003\255\033"
+	.string	"&2\266I\220ZU:\004 Y\304#\"n\217\261\362\311\216=\213A\r\240 \301\246h\347\217\234X\007\264U\372\021k\247\356\335\245\347\356\320\245_\374\274K$F2\211\004\316\271'\030F[\274\230\214D\353K\016\361\355\023B\b\221;\311\237"
+	.string	"\234"
+	.string	"\241"
+	.string	"\314_r&B_[\\\250\032\2010\222\367^\007\234@\375y\300df~\2223\t\361\316\300\232d\224\"\201\276'i\356]e\274~"
+	.string	"\372S}"
+	.ascii	"\364g\377\370\356-5EO\263\355\216\317{k\002\322\212I\311\303"
+	.ascii	"\210x\265\321"
+	.string	"T\351\201\0255\244\361\364W\302#\237E\315\006a\2066^\303\"3\300\2141^`C\237=?D\274iBH\346`\002\033\2720_\301\253&\257a\317\266I\201\252\351\n6$2O$%:>u\013\034\366\254M+\334{\331\376\206Fg\327\231\231\0073\367\230{G>\230\337\364\003\270\3249\366(?\316\243\376\233C\371_\177\372]w\362\267n,\253?\236\323\257?\312\226\373e\331\272,\237@\2043:p\b\271\321X\353\r.\327\\\253S\212\322\245\376\343-\263\020\337\370)~\035{\256\321\017\225\025S\032 \251\235y\217V\004X\216LH\356]\031\374d\024\252\032\345\206\264\241\223F\251\270P\215\002\022G\240Pr\027\252P\305\243\017\347\023\213A\205\255\"d\020\203i\357d\005*l\005\2132(tS\320\205\252T1F\362\336\325\001?P\177\262\265\001\306./\322\035\032\353;\005\331b\206K\226"
+	.string	"\213\3237\375jW\267:\204\b\373_\254[\312\262\352\022\233\307c\324\244+\274\367.\250-\035\225I\236ec\203e\210,\241\351\025\240\352\203\220\341\231\341\222\005m\265\331\372\332\f\331%\367\210\330\\9\033\351\266\250\350E\311\fB\337\007\343\004\206y\304\251\004I\340O\371!\241\336{?\344\347;\007\310\222!\273<\225)5\202\335\203\246m\200\310\021\247\254\236U\3031\21363\255f\377K\373Swe\031Y\225\311^\363\230W\236m$\346\367r\271\\r\007\265\023\263\034\210\230\016w\333\340\312\375\334\322\332\316\255\307\254\351f\035v\200f:\352L7\273"
+	.string	"KA\233\351\360\360\314,\260\300\271|n6\035\315\007\310\204\212\253\331L\330t>\265\035\233\213i9<3\033\256\226\223\335l2\037\333\254GF\303\345d9\005\370\366S\303\311t\267\033N\366\2727o\373`X\261\215\317\250\3062 \225\240\214\346\251\336\rd\346n\2560\324D\346\275\367\266b\315\254\341V\273V\215,KG"
+	.string	"Z\013\201\244\024M\225\022\207mf\016\257\362\200\245\004\210\330\227_\031\264m\247OV\234\260\240\256,B\234R\377\013G\250Q(H\fc\212\231\222\211$\b-j\007\240\002\021\271\263\003\021\200\271d\243r\3176\210\272\226\302\350\204MM\276s\314\007e\315\322\002\017\333\363\017\341C\364=\222\302\306=`\365\370\257U\377 \032P\240=\201\2435\245M\360\002F\033\323\003A\315\013\327\246\006\215c\332\030(\204\357\257\fa\037\200\226\367|j/{W\245\206\247\020\022\007z\372.\276\206?H\002xK\347V\256D\022\240M\2357\345\232}\032"
+	.ascii	"\205`K\227J\374\262Tr\261$\2462\002\345\260N\376\003"
+	.text
+	.section	.gnu.lto_closeSerialPort.52.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`\025\001\005\r"
+	.string	"\366\227XE\020q\224\016\030^70Q>\024\201\300bt\257\001\241\267\205Wr\363\242\303\207!\004\341\001\364(\214(\376\307\266\223uK,,\333\222\251W\200(\002\250i\240\345!p#"
+	.string	"\262\177\214\332\265O\032\331{\357\224\002C"
+	.string	"B"
+	.string	"F"
+	.string	"\002\262S\355\001\262S\203\366\214W\222\275J\n\013'\261\335\335d\210\203\2372\202~&L}v\270\234\nX\027T:B\217\251y\3310\361\326#\206p\025\343\245\263\273\216 !\207\233\336v\003\333\035\373\037\001\"\366\353=o\362K\355/j\214\306h\305\356\206\226\034\013\203\266 \361\372\333\177\313\032\333\365\364\375\b\301h\310\360b\331\255\007N\235@{\264_r\024\340MP\007\260+\222\302b\267\"\260\001\355\324\365\001%mw\027\370'\024\276\315\312\356~\304\251\217\312N/(1N\324P\305\026\t\242\204\013&}\312\246,\300\022\241\002\266\2128L\243\224\366\204\n\361 S\276\365\f\314E\310\r\226\225L\3315\025\345\210\375\271\273k\031\240\220\347{\2601y\235\203\214?\234\221\207\363@\337\326q\033\004\316C\332>\336\267q\b\270\213"
+	.string	"\3626S\327y\233\246\356\255\222\036S\216\270n\207\236\202\302x\220\021\023e6\367\227\310%\2014\200\204\001k\345C\311K\231\335\035%\027"
+	.ascii	".[\267e\236\314\2000\314l!~7\f\242\355h\030\213'\225\b\310\034"
+	.ascii	"d\255T\326zj\n8\330\325\204(\306\226q\315\346\302\335\214\"\226"
+	.ascii	"\247\256\210k\371)\361\246\024j\017"
+	.text
+	.section	.gnu.lto_serialInit.53.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`\373\003\355\032"
+	.string	"61\256I\260\324Q:\371\fv<:R2TK\222p\013\226\276S\355\345\361\332\030!\233\275\341\273\242\236\300)\373\363\361\212\267\376'\362c\344\370m\313\267\003\n\245\317In\374lh\372p\322\003%\371H\230\3631V\362\311&r\247\024\234"
+	.string	"\211"
+	.string	"\234"
+	.ascii	"\343\007\220\247\236\323\236@aw\341\212\002\337\272\022>\251"
+	.ascii	"uh\343\006\345\251wv\226\017\215\352\231\244Z\020\351\252\265"
+	.ascii	"\3166\207\313\217\303;6w\207\211\2250\222\216;w\276\220\317\031"
+	.ascii	"Q<+#@\237\303\214\260\027\277\252S"
+	.string	"\375\206F\232V\326\020o\306p\004\321x\t\033\031L\261\201\305\200\322\247\013`\213I*(\n\022:=\325OH\006d1\307qf\212\r,\001\200\275\021\002\221\224\0302 \320\334+\035B\226.\241WQ\020\215O\330\205Z\253\247\017\030t\313n;\211m\016\366&\t6\023\363>O(\250\251\336\372\270\374\215\364\213|\351\346\037\031\227b\336w\352\247 Om\222\220\210\204[~f\321\036\372\314\r\332\247i\365\220\2747l\231\017\377\230\023\357\222N\303\3504INSrz\244\323K\247\3478\375\231s\325\350\322\272\025k\205Q\364R\247h\223\216\023o\177\210\257D\264S\351\363+\227\230\262\264\324ZkN\255\241<\275\314\366N\373@\036d\367\241\316\261Z\213\212Jj\2556\246\225\247\t>C\236\006O?\310\r\356\324}[\305\337\310\271\273\357\021\361f\321Qsc\275//\241?\035Jg\023\345\246\001\024"
+	.ascii	"\\\276zlq\325\217\007\022\272_\232\244,\242\025\240\331e\036"
+	.ascii	"!\025\311\0307x\035\031\263\007\222\256\020\261\200f\027\177"
+	.ascii	"m\017w\242cpUk\255\340t\203\300\250\326J;mB\277\370\266\354\235"
+	.ascii	"7}(k\005\242\371J\276\004\304\030B\004)\202<\375^\351\343\216"
+	.ascii	"*/>\232v\351\205\327\222u\314|\275\241\310\232\177\310\231t\002"
+	.ascii	"\030\325\372s\237\177\344Hr\374\243S\327tt\034*j$vl\224\307\206"
+	.ascii	"\001\327\241'\207\3330\200D\355\304\b\234\235\f=%p<\002\234#"
+	.ascii	"\341\004\216-W\343\231\341l\263\035\033\316m\226\223\343\231"
+	.ascii	"I `\034\212Zn\326\203\303\345f\262a\375\336\020\362\f\\5\274"
+	.ascii	"\264\374,\017f\203\226\r\2252\273X\263\346\345\272(o'\262\334"
+	.ascii	"\177}\254\265\326X\204\227+\2632\031\\D\253\"\223I\t\303\222"
+	.ascii	":\271\260+raKOU:\007Un\026PIz\262\320C*\n\266A\3774$\335\007"
+	.ascii	"\302,bTL\261X\244:\r9.\375\216\273VMxVK_?\263\370!\251H\2501"
+	.ascii	",$\215RF\221!\t\204D\204\244i\003\300\002\221\251\272\r\021\020"
+	.ascii	"IJJ\212J\263\031\210\376L`\n\341\357 \2765\370d3\261|\267\307"
+	.ascii	"\021|\331\205D\234\202\003\364\260h\345(\366\221\326Db*!O\213"
+	.ascii	"Ho\316\"\024\206\374\213\037\225\345\353YUF\225<\255\261\350"
+	.ascii	"P9\353\177\266\266\356Z\261?\354\f\310k6\231\304\270\001\241"
+	.ascii	"\332\350\203\210eS\320\232\256\035\304\367V\315 \227\246\354"
+	.ascii	"v\371\327f$C\322\252!\351\215@\364\262\020\321\003\321%_s^\353"
+	.ascii	"a\f\300\005\275t\177\031\313\017"
+	.text
+	.section	.gnu.lto_serialRemovePort.54.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`\t\002\025\022"
+	.string	"VbyH\300RN:\002\205\371\377\237\335\0030\020\\`r"
+	.string	"w\301\332\312,\320\0133}+N\206r\327\334\270\026\364?V\361\\`\001z\036\234\333#\b\202 \b\202 \002\314\264\246\313$7_\207S\220\251u#\204\354-wJ\001f"
+	.string	"_"
+	.string	"g"
+	.string	"\237\226\331:n\363\331'\005\325\030\371\330\335O?\330\273\264\335\\\224\275\343\246\324(\363\205N\240\252\306,\204y'\273\033\034\032#a\215D\201z\3329\321\243M(\0239\220\0219\237\033.e\t\217\f\r#\341\005I\322\344!\007+\234\211z\242\227PE\315\302\234\307\316\301\356:\316\302\f\267w\3338\266O\354\330 \266\r&\242@\321"
+	.string	"Y{\354\220\327\376\325\207\3569\243\345\214V\031\0355\372\"\002t\232bO\273\030nU\3134\225D|\350\366m>\221Y^\300@\366\241\230\267@\035RRm\307\256\r\301\247\025x\237g\331~\264\037t\024\262\327^\274\332\355\260\344bw\023\330\200\3679\340$\334\247<"
+	.string	".2\361f\277\305\223b\376\217!\200\3613\220\373T\355\216\234\244td\177\341X \255\020!\341T\242\307w\226`\234\220J\363J\243\276\212n\314\304)\333\021~\364r\300\306\356\236\330\266p\025,\005|v\027%\305\215\\\376\317\247)\300\342g\237>\214\373\214\272\252M\275\236\350\223\207\352V\363#&\336\364\350F\352\205*-\025Z+-\340|\265\300\007\240KKk\005\004\261\212\211\204\024\360\325\202}.\360k\001SX>\225\027\3543\t`\327\204\326\353sq\271^\037\313\266\327\036[\350\336\f\016L1*\323)\315\254\0303D'\210h\033/\206(\3021\023\247n\033\314\345\356.\247\264\307\270\251!z\023TQqJU\372\214\307o\217q\252RO\303\023& p\002Bu\324\003\241\300\256\323J\330\243+\365\356\261\354M"
+	.string	"o\366\251\345|\202\t\250D\306\207Xl\301\356j\313\206\333\264\3342\213\215\023\034\327\n\251Y\374\241\260\373\266\355@["
+	.ascii	"\026\372\023\350\343~\213\270rZ\230\030\321\371^2D|\007D\032"
+	.ascii	"\262\276oD\335\316E\311"
+	.text
+	.section	.gnu.lto_serialGetAvailablePortCount.55.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375 \342M\006"
+	.string	"\302\313+2Pm\222\016$\241\252r\252\272<\\\200a\240\303(\024\255\306\336\222]\265\177\337\216N\357\274\201\023\366\233\231\231\"\243\373V\302\003E\340\251\303\332\337[\246g.\n\230\251\322l\03255\206\t\263\3202\325\246]\004\246\0324Us\240\250\252Y\260,\212\016\t>\030\361\355\250\207u3~\340\\\257J\227S\251t\030P\361\271\3541\317\241\305\227\222(\372\357\303\001\r\022\210,\023\224\231\344\210$2\372;o\371"
+	.string	"\241\263U\f\003T\031\205H|\224db\r/j\365\254[\216R6N@\256\220\247\007\220\220\231\337\025\242\350\330\337\340/\370'\002\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_serialIsPortAvailable.56.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`|\001\365\017"
+	.string	"F_nE\360\360$\035^x\324\221\005\231\3369\2154\333\227\320\374\241\t\315\351\316>Y\346\326\024\375\023\234\357\215\354\217\bA.FGT\372\tV\350)\360\fl'\255&(\314FL\241,\013V\277\252\363\t!{K\231R\\"
+	.string	"S"
+	.string	"]"
+	.string	"\330\343\002\006+{\377vl\336\323Bfhi\367\333\324\203\265\303\357\216\351\035\213P\323\363[\216\301\254\006\203\f\020V\f\034Qzi\240a\275d\024qs\b\033\374\214\370"
+	.string	"\302\202\201\332r\035\235X1\251o=\217j\b!\021\261n\236\031\311\356:gX\031\356\354\266=\333\"\366K\004vv\240\037s\032>\350\326\230N\230\276v&\237%\245\025\322\256M\023\217\205\021W\364<\350\366?\277\345\223\037\264\242\255OFT\344\302\306\356\207\340\321\n\264\307\333+\373d;\323\276\211\377\254\016\304\342\217\335\016I*v7\201\rh\217\004."
+	.string	"{\204\017\020+\230j\246'\301\364\212\301y\311\246\344\231\301\021\003\252\2161M\355\204h\300\344\016\333\021\356b90cwEl[x\n\224\002;\273;\202\342C)?\304\243)\250\3623\217\276\n{L\375"
+	.string	"R\275\276\365\210\303\224C\246\207K6\251\253F\207\221\252\216\375\265\244\346\030\335\270\260\301\232\023\025P')\\\354P\034\004N%\005u\302\001\260I\210\204\022\256C\251\266\024\267\245p%(\233I\247\332B\00685\001\325m*\251T\267\235\276\275\346\370'\356\340\225\344*\212\276\207\275\365\007\257\027\256\"\375=\fB5\211\213\276p\300T\307'\0260\323\b\"M\243%\217P\022L\3568\334\335\215\177\032"
+	.ascii	"W\bx\254\306)\275\006\322\224\272\356\204`\f\250\216`AD\305\262"
+	.ascii	"\341vq\366\266i\003M\0030\033u\241\013\202I\3064\255\333F\244"
+	.ascii	"\220gO{q)\240ZP\005\005O\331g*\022\257k\222\001"
+	.text
+	.section	.gnu.lto_waitForSerialPortToFinishTransmitting.57.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"\215\n"
+	.string	"&\323G@ \307*\035x\020v1\0053\031,\336\324\r!\001\316:\263\030\005i\r2T@wi\003M}G+H\320(2L\204c\272\231"
+	.string	"\b\004\bP*\017\374\216\202]1C\276i\226\220\275eJ\0014"
+	.string	"4"
+	.string	"6"
+	.string	"R?_g.0\034]\233\027\323\351D\023\232&g\214\265\316\272\216\204$\235)\250\313\263>Ud30D]/\022\273k\005C\222{\273\355\n\333\021\266e\0010\255\205\242\261}\265\277r\226\357\253\217+\354\246\306\001\273\"\204\0370\327,\236a\273\206\371\302v\315\237}\340\242j/\300\200\b"
+	.string	"\006\273\313I\023O\375\256\315\340e\302\3535ww\2477\315|c\2639:\364\240\021^\b`%9\222\001\\\246P\312\022[\034)G5\306,S\366W\377T\365/\016\t\b\200,\330=\315\032l\"\257\233\310\330\263\261\350\200\274O\210\353@\034\006\250s\301y\274\020\267ip\227\361\3618Q\327y\234F\334\313\224)\024\300B$I\363\330.\275\226\002%\035}\240S\332\235\206>\023"
+	.ascii	"m\231'3\260\316#9\266N\\g\365\302\tc\007(\b\251\0200\217\202"
+	.ascii	"&\324\"\357\022@\263\232\022\334\213[\252T-\003\365\262I\230"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_nopConsumer.58.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375 \334\005\006"
+	.string	"B\313)1`k\222\016\323\n\006(\267\323(\316>S\b\244NC\001\026\334\346\307\217\007\376Q\215\253\007M\237Z\0243\200\004&-\226r\201\230\342\177\255\021\262S-\323\026\242-\025\2066\275\013\206\271\2119L\255\201Y\036\206U\002v\017\227\3072\316=F\211\315\365Y bm>j\324\252\370\214\272>\257\024<\0370\324N\204D\352!u\200\376\244\374J\375\001\002L\f\210WK\261\301\321F\203\t&)\r\037$\343E%\240\021\t\215\220\266lY$L\005\317\314H"
+	.string	"NG\223J\222\320v\305\351x\362\225\377\300_\360o\002\b"
+	.ascii	"2\003\3169\003\027\216k8t\bC\245&\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_serialPassthrough.59.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`\222\004\005\034"
+	.string	"\266\362\262K\260VU:\244\341zd(\226%\244\377\354\240p\324\r\250\210UcS\246r\316Z\026\256dA#\302\365m\002\353\006\247N\013=ha\037\331\347\204\365\234\037\364\237@\271\353,\024n\037\277y\357\214VBr\035\215\020B\266\334I\006\244"
+	.string	"\226"
+	.string	"\232"
+	.string	"\343\3543\350)\303\212Y\265`TfI\216\266\353\214\337\213\361\031\032G-\215\320\016\333\207\267\032\366"
+	.ascii	"\321\351\312\221n\274z2]"
+	.string	"\325\243\367\244\212Q\216\306etg\ro8f\324\230\242\257\200rDo\331\362Gh\307\2077\0316B\221\310\344H\267\034\025Fx\225\216\336R\025\243\034\321U\366\001NI\322\207\267\"\253\242\322\023\036x\001H\267\241j\336(\247{\t\203\213q\022\306G\240\237j_\274m\002)\037D'\256f]CH\244\016|\r\302\245\250\265\244p\357\345j\303\345\316\2563\037\207\231'0\267T5\377\375\256+\375\255\247?\372\"\377y\245s9V&m\345\321V\266c\345\266\225\253\255|\001\225\205\220\"\334W4\335+\364\205\313\205\032\231\360\370\322\037dJ\3529\341\037\341\013y\305\r\034\314\036,\361\013tK\374\350\031!\336\233\"\370\310\022\314\217u\305\374s\002\241*\231\b\200\336\232\017\007\203\264\210\340\225\371CNd\366\"'\316\272w\247d\311\275\251\002.`~\344\3644\344G\363.\362#\317\230\251<\345\335"
+	.string	"=\235\n`\226{\357\253o\260\311'\303p\031h3k\250]\243D\271\270\275\254\r8\365\266\232\276\360.\341\360K\004^\221\250\202\221o\231O\212\214N\254\336\366~\224\341\226\277N!\002\224\232\006\206\254\f\225}D\3006\362\207\235\013\272&\326\3257\035\304\344\330\273\001\305\346\017;\026tMI\367\242\270\215mmu\331AI\356\352\377\272\330>\232\331\r\351\336\361M\220\255n\332\017\213o\252V\213lV\224C\020\263\236\315<\242\247\336\306\007\376\274!\020\250Z\323\230SZ\355#\3467\320\022\344\3361\377w\276\371\322\331\346\301s\260W\360\361\240\023\223\221\025F\037\017:1\331\350\323!\007\204e\330\002\02081YN\317\213'\366\n\021\303\331y\301d=\257\005"
+	.ascii	"\230GD\216\354\345\303\303#{\255J~\357\310\346\233fX\022\331"
+	.ascii	"\247M\223]\372Z@\231a\247\246!\017\035\373A\316\261+1\n\bk\231"
+	.ascii	"zJO\324\246\317t\327\222\250\036T\255i2\025h\003\307c\331&\201"
+	.ascii	"\332>\360,b\324\214\230\232\332\315e3\f\006M\355\306\220\241"
+	.ascii	"\336\3067?M\343\232\356.m\260xR\341\005E\375\262\352#\376;\370"
+	.ascii	"\364\203k\365\356N\257}$\337T[\250q0%\rR\n\221\210\210$I\r\351"
+	.ascii	"\300\002\021\271:\007\0200\310\244\212\2269`\212\322\361\335"
+	.ascii	"\351q\246Q\312S\202=\212d\021\357\242\377B\221\357\026\344\321"
+	.ascii	"\362\326B\275d9\003\354a\234\246(\351\224\006\377\267\340qS-"
+	.ascii	"H;KU\206\363\001\027\320W\365\034M\22074\271q?\301\341(\340W"
+	.ascii	"\\\334\305\220\343\263\031\302&\007\333\327l\003\334t\266\342"
+	.ascii	"w\0015IK\263\275X\316\200\365\n\002\321\350\032:EB\024 ]P\b\340"
+	.ascii	"\377\026\271\272\3166\n\n\222o\315{<\034+k)\002\ft]\247A\373"
+	.ascii	"c>d\026\242\274\bO\231<\345C5"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`U\003\235\020"
+	.string	"\344\027Q\004"
+	.string	""
+	.string	""
+	.string	"\002:\177+\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006%\177,\260\206\3618\272\320\202\002"
+	.string	""
+	.string	""
+	.string	"\005\036-\301\204\001&\177.\346\206\316\220 /'\1770\234\211\365\321"
+	.string	"\002(\1771\005\035 \300\003\002)\1772,\1773\252\333\3426\005*\031\005!4+\1775\002-\1776.\1777/\1778\250\212\250\332\0010\1779\234\367\200\311"
+	.string	"1\177:\0022\177;3\177<\377\377\377\377\0034\177=5\177>\220\037?\300\003\0026\177@\0027\177A8\177B9\177C\360\372\250\220\002;\177D\307\3712\005$E\305\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\"F\001<\177G\037"
+	.string	""
+	.string	"\200\220\200\001=\177H>\177I\300"
+	.string	"\177J?\177K\304"
+	.string	"\177L\303"
+	.string	"\177M\302"
+	.string	"\177N\301"
+	.string	"\177O\003\001\036$\003\f\036$\003\f\tB\003\017\016\320\371\216\307\003\001b\003\017\006\350\274\307\343\001\001\302\001\003\020\037\361\344\203\254\001\001\244\017\003\022\021\"\003\023\006\003 \271\255\362\217\002\001\204\006\003\024\b\025D\003\032\"\221\205\327\307\003\001$\003\032!D\003\033\032\"B\003\033&\300\206\275\355\002\001\344\001\003\033%\244\006\003\033$\304\006\003\033#\007\007\003\033%\231\365\231(\001\244\n\003\033$\300\327\351\371"
+	.string	"\001\304\n\003\033#\013\004\033\325\007\004\033\231\365\231(\001\325\013"
+	.string	"B\250q$\202E\033\252(I\315\034\240\002\231\262\242\007\021\260\224\006\215"
+	.ascii	"\221`\202!\nd4\350\366\224\320e\353\211<\237Xr\234\222\031\305"
+	.ascii	"*-\235B\276\342\214\332\215C\263\225\265\313.90Nx*\265\037\367"
+	.ascii	"\326)&K\250\352\244O9+)\240\316x>\312\177\242\221\342\233\202"
+	.ascii	"\225H\354\b\377\022Y\257\204\276\306\243\215\321J\220S\251\247"
+	.ascii	"{\310\272E\224\333\213\277\331\3674\361\372\275S\273?k:c\347"
+	.ascii	"\270,#\023,\245L\f\240\2016L\357\264E\325"
+	.text
+	.section	.gnu.lto_.refs.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375 \261}\003"
+	.string	"\002\211\026\031\240'\351\377\377\377\377\377?\216\375{\373\237\306\237?\331\255\355F6\2212\005\263\210\236\036\312\305\235\256\241\005\316\233\300\353\270\271[\017\350\3448r\037(n\307\215\373*N\305K\347Q`7)O\221N+\200\233\2759O\247\327x\220\321K}\253Eg7\274t\341\355\344\237\b\006"
+	.ascii	"v\306bQ\367\272j\274\005q7\233S\337\362\004"
+	.text
+	.section	.gnu.lto_.decls.4a51a15b232cbfdb,"e",@progbits
+	.string	"(\265/\375`W1\335\314"
+	.string	"\n3\035DY JI:\351\253|ZfE"
+	.string	"\363\236g\021\033\371\272\223\350\300\376\357\356\270\363\007&sI7\204\037\030_^7\265\336\027"
+	.ascii	"e\rowh\001\2248\217+\352\272\256\352$Gq\005DM\233\264\024 \024"
+	.ascii	"\245hZLnCHmS\324&)*e\374\2521\242\241"
+	.string	"\275\345N\001\224\003/\004W\004\270}\272iW\021\375\003\323\\s\026L]\025\246.\262\364VD\220FD\020\3475\260\304;\007\001\257\274\350jL\003(B\346J\235O\221-!\322\246\031X\225\226\fh\326\031D7\262`\351\347\225\226\237\306W\354\214\267',Vi\t?;\203\215^+\243\023|\264D\255\025\373gW\353g\247\334R\261U@\360\263d[\242K\374,\037`4\347\265\203\017\035t\020\203'\207\005G\212\337\3204\370\234k\033i\324\242Y)\003\210\332\342\327x\357CP\315(j\327\370\r#\315\263x\366\316\332\331(\026\212]\255\236\225\273\235\263t\307k\316\315\253\277\204\325\263q\366\353Z\031\245c>Q\2429\347\333&u\177ij/\\PR@\260z\366\211=\273+Y\032\204\225\027}sb\335f\226\032\262\217\334\0364\347\365\266\352/\361\177\020\202\325\263p\326\355\256\320\354#W\306"
+	.ascii	"(\277\"!\1779\257\037:\240\251\363\353R\233\301\267L\322\303"
+	.ascii	"Y\017\301\241U\222\336\312\220\336J\245\2670\244\267>\351\273"
+	.ascii	"\326,\233]3\260m\377 \204\337\345U\256\222\0014\002(\202\364"
+	.ascii	"6\203\240\r\264\031\004\177\223\236,\315z\b\036\003i\320\226"
+	.ascii	"Y&v\ra\315n\307\354\222\2730\327\274\346"
+	.string	"\274\322\364\216-^X\215\217Bz\033\"x\003\003m\210\340\027\2206\234\345\020\324`=\204\201\301 \0312\203\254\361-\330o\271l\227\375\352g\316\315\2343\0053hsWF\326\313fqMei\374\r\322\316\326C\020\204\345\020\264Z%n\2678\004\215\234k\246\001\300\022\264\262\306/Y\266\312b]\241\241g\356\312y\335\200\321\216\364\2464\266Hl\022\273Z\254\337Z\331\253\343\253g\316\3129\313\b\243\310\272\230\215AX\017A|%\237y\3129\204w\272\"\347\234_\354\321\202_\255\207`j9\004\177\213\3637\013\177\267P\323\363\333\r(;\371[\266FR\360\337\274\337\277O\b\301\337'x\334\242\250\341\377\242a0\326\326\303O\360_,\026\234\372(\363_#*\37471A\b\013#\374\321;\0320\301\360w\003t\354\3167\374\227H\251UP5\b\272\270\376w\351\002\220\3770\377U1e\003@"
+	.string	"\f\244:\374\027\205\337\342\350\234\306\371\360\277,\374\326C\006\036\360\333\017m\302\377.\340\351\177=\370mQ\247X\341\305\377\230\377^\360\277\357?\337\377\273C\371\217\367\337\356\177\335\363\356\367_J\263\325\277\031p\363\377\352\025\374\327\345\357"
+	.ascii	"\374=\200\277\005\360\367\006\177\203\370\233\203\277C4\006\177"
+	.ascii	"g\3206\377i~\\\201\337\032\375\374\267\377\225\371\033\305\337"
+	.ascii	"\037\370\233\003\177c\340o\025\376F\341o\023\376v\300\337\"\374"
+	.ascii	"\335\301\337\"~\333\367\333(\277\305\373\255\335o\345~\033\367"
+	.ascii	"\333\264\337\212\375\366\353\267[\277]\177{\344\267B~\273\343"
+	.ascii	"\267S\277\225\372\355\363\267K\277\205\341\267G\277%\372-\320"
+	.ascii	"o\231\277\025\301o\211\277\305\300o]\370\355\006~\273"
+	.string	"\301oU\374\337\373\255\005\377\257\374\266\205\337*\177\033\202\337\212\360[\007\374/\300o\215\277\325\371\255\313\377\266\337\346\374\017\361\337\353\277\331o\205\277\265\371-\212\337z\340\267\031\370m\007~\313\201\337j\340\267\034\374V\203\337\202\370\355\005\277}\371\277\345\277\226\377Y\376c\371\017\366\037\353\177\n\377\331\376[\020\030\030\030\370\277\200\370_~~\016\236\002N\"0\266\256\320\025\272D/?TK\".\024\310\023&\267\305/\321\035\032\206\341\320\222\324\370\276\020\352\355(\213:r]4P\360\255H\013\026#\3666\327\333\274@\022\030\241\2005\024\315FK\036\274\\\251!\345\274?\035\201\241\035L\353\213\225\024\262\263\306\1779\332\262\3452-\026\024\247\210+$\312\tm|\231w\207\013$C7\303(\031\345\315u\016\324\311\212\246]\311\251P\024\237\023\320N\221\231\001D\305\205%}_i,\357,]\227\346\234}"
+	.ascii	":e\210x\260\377`\316H.k6\362\031\006\255\213\265\"~\031{\355"
+	.ascii	"\0069?\203\024k^\352\361\361\245@\306\230J\007\221E\344\2744"
+	.ascii	"\022\312zZn\020\312bf!-\270\243\rBk\266AA\316\272\221\205\326"
+	.ascii	"\347\022?\227\235\327\334|:\312\315\347\222Gh\315Fy}.5\344\346"
+	.ascii	"\221\006\241\225\271\024\312z:\262BY\317\243\r\271\231\227\271"
+	.ascii	"\311\264\2216\237GBm\317#\rBY\314#\241\346\323\221\315\3533\333"
+	.ascii	"8\263\365i\t\224\263\23029\347\241\025\272\034\346\3144\312\313"
+	.ascii	"'M\224\237\242D\271)[8#\353\215\234s\316\313\256;\250'\314\352"
+	.ascii	"\223\341\204\202<s\200r\276\313D\bX\332eP\366Y\332\234\201V\243"
+	.ascii	"\234}\236\037p>\355\\\220Q\226\311M\346\220\017\324s\b\344\363"
+	.ascii	"\f\312Al\330#\241,\250g\211\262\255,h\366Y\227\026\232\357\236"
+	.ascii	"\214\322\254\345\232\273\252\310d\355p\016\251\255QIilVn\242"
+	.ascii	"\270\316\316\370\354\332|\375\304\304\232\2273X.\202k\332T\272"
+	.ascii	"\247t\2257\225\216\016\233kS\30193\255\325`\306Z\r\\\320x0\261"
+	.ascii	"\202\370A*)\275\327\307\203\213\215\206\t\325\374\201\2676^G"
+	.ascii	"\261k.\342\020\244dd\344A\336\207\231#Sb@\322\370\301\246\364"
+	.ascii	"\301&\224;\265(\214)\215\333\016{\375\2105\351\243\263k\327\271"
+	.ascii	"\034a\262\322\260n.PV\242\2145^W!Y\223\227\f\271~2|#2\326\327"
+	.ascii	"O\376\206\353\270V\032\322\330\321\360bj\234\346\354d\307\275"
+	.ascii	"\242\265\004\344\315\005\326\032\025\323\255\215F\310\017\216"
+	.ascii	"$kXZ\006]\263\260\255\245|gI\31455{\327\007\364\243\261\021s"
+	.ascii	")0H\252y\024aME\257~0A{@\233\240>\234\242Q\rf\343b\030\222D\325"
+	.ascii	"H\276\344\206\242F`\\\365V\f\237\0268\256\007$\247\203H\003\315"
+	.ascii	"45\344&T\215\356!\303\022X\003i!/\344\224\242g=\326i\215\326"
+	.ascii	"3t\223^\322am\326b\375\325e\315\244\275\232\314\256\r\3260\336"
+	.ascii	"\\\335\365\017-\243H\003qa9\243`\235\244\255,\\Wf\"\201\370\001"
+	.ascii	"\335\213\276HQ\345\330\002\002\273\254[Z]VQ\360V\031\354\306"
+	.ascii	"|4\316j\254$r9\326\270\322\273\254Jz\245\361#\342\253\023\242"
+	.ascii	"\004\332U\303 HE=\236\216\270$\245w9J\357\322L\217\375\322\343"
+	.ascii	"=!A\240>\256\364\032\303\321\f\001\217\310\331\240K\217\323\322"
+	.ascii	"c\260\3648Iz\374#=\200\345\020\354\030~\314\314r8\323\035\255"
+	.ascii	"\343\t\222\2745\365\326\361\275!\0064<\304\342n4\356\034\366"
+	.ascii	",P\254\r\255\361\373\256'l\242\003\352\255\3611Q\372\013\230"
+	.ascii	"\236\254o@e#8 \215\367V-h\026\252'+%\230D\205\311\312\206\323"
+	.ascii	"\214\027\026\237\306\007\241\235\232i\315E/RN\247\245\247]\333"
+	.ascii	"\251\233\376A\b\271\203\017w\007\020 A0\376\375J\177\327%\245"
+	.ascii	"\230+UO\322\032'\t\301\372\212t\364Ho\351\326\272F\323\350\031"
+	.ascii	"vmg\307x\313h\030\376a\3159\254\252\235"
+	.string	"\335\242\207\304\260\324\234M\324H\n"
+	.ascii	"2\202q!\227F\003\324\266\305\227b\253\341.!\035\3354\030l;\032"
+	.ascii	"\033\341$\2603\265\242\264\213\032\306\237s\0366E%]f\372\366"
+	.ascii	"\353\0273V^\3645y\222\266\013\231\313\234\3416\246\226\376-\324"
+	.ascii	"A.z1\372\346\032\277\203\376^6\263\201d\322\344^\024u\327\353"
+	.ascii	" zCS\032c!G\033:\355\376\244p\2207(9\237\306\370\007\226\301"
+	.ascii	"\256g\303@>\303$\310\213MK\372\021\330\263\005q\217c\037L\232"
+	.string	"\242\236\370x|\325)A\245\244\037\336\351\300:,\026\023\032r\206Z#{\211a\313\3116\203\337q\013\273^?\234\343\n9s\214\r\240\234\320\334\250jB\322X\252\303\252L\211\363Jo\253\2060\214<\031E\230\250\n\017\t\313\030\342$j\204\211f\226\033r\276\001\005\372\3048p\024\206\3026\360\r\273\342'\f\303\261\013\374\342\037\226\340'|d\317,\\\016\007T\335\341'<\0037Y8\247\206\334\024\223\022\343\342\t\216i\006\017]\017\003\037!\023I\364\230\260\223]q\023n\3024\360\222\205s\256\031I\270$Nn\255\202\016d\250\314\335)\005\227\260R\330*U\2451Nr\322`\373\231r\332\025\327\350+R\226e\210#\375\360\231~\030#\3051R\272(\323\220(\375\260E\372a3\275PKz\241_\372c\030\230\310%k\215\357\r\023\271\311\271\r\371TI[\204\345\020\304?8\b\013Q\221\341"
+	.ascii	"\313K\217\201N\320\341\004\2541\266G\013b\237\343&\233\017(Q"
+	.ascii	"]z\274\304\314\273\036^Vo\351q\006\013\344\253\321\370\006\246"
+	.ascii	"@B\262\0201LbNJ\215\177\003\377{\345b\271\200\037x!\360j\271"
+	.ascii	"[~\001o\226|\001\021\360\314\231y\001i\264\344\314\244\261V\003"
+	.ascii	"k5\300TP>\276\202\370B\260\364w\326CPf\256\304\357\237\360m\206"
+	.ascii	"\250\022!\321\350\355\023\341\207\023\232\235ED\244Is\177z|\277"
+	.ascii	"}?8\326\246\306\267J#\265\217\034c\321\306\227J#\271\364p\223"
+	.ascii	"\342\324\370Ni(\301\246\234\226\032\224\0313\267'#\215/\204\332"
+	.ascii	"\333\273mczY\216\034\241\333\022%\312\0253\341\203\255\002ZN"
+	.ascii	"T\354\240@\271x[>\304\242`UTU\032_<\353&\204rT\004\t\030\035"
+	.ascii	"\335\265\033\253rZ\372\223\201\021\205\r\256\356\327\356\205"
+	.ascii	"\n\252\254\006\225\334\225\263n1>i\253\007\217y{\273qV\357\315"
+	.ascii	"i\251\210\320,HZ\035\334o\334X\221$M\032_'M\345+\314)\313im\355"
+	.ascii	"\266\331%Jf\310\204\340\230.\333o[\f\016\245eU\021\031\331MK"
+	.ascii	"_\362^\030aj\021\324\3447\rI\207\221!!\215\357\f\366\353\305"
+	.ascii	"\357\206\023\264\036\022j\335\020\003\322\370\2365\017\232)<"
+	.ascii	"*\241\306\327\354z\270y\343\007[\343\313\244\201h\252\232\230"
+	.ascii	"\224\265\225\315BV\327\002\311\335\232\242K\322\37019,\354\212"
+	.ascii	"\231\330\022\344\341#f\264\344W\f&k\216\307\322\256\253\353~"
+	.ascii	"\231\230\302\023^\201r\356\360\372\375\202\336\370\013\202\001"
+	.ascii	"\273\272\272[v\352\205\f`<\344\264~\267\\\300\324\314\304\262"
+	.ascii	":O\n\215\271,\2549'LUi\216 E5\210 ArW.;\267\250L\217\247-8%\277"
+	.ascii	"+\322\231\017\223'\215o\222'\"D\356\021+\225\246\243\245UE\365"
+	.ascii	"{\244\251\3347\267,j\215\257\221\013\225\311\262\333Jk|\213\330"
+	.ascii	"\2639\273\252\0340E<x\\!&^\354\272RP\312\"\326\370\n\t\222r\345"
+	.ascii	"0b'\303\005\022\234\233*\303k|\230\245\f\267\307\205\002\211"
+	.ascii	"F\215]\350\365\001\2676\343io\255\240k\355(\312\216\035LNK\177"
+	.ascii	"/S\246~0\233L\335\256w\312b\201\021\312\371\210\003,'N\017\354"
+	.ascii	"\263\352\r\020\353>\335\247+%\224\212\301i\351/\375\031\002\034"
+	.ascii	"\002\365+\205C\306\357EY\035\216\337\250\266\260\027t{\303(@"
+	.ascii	"5)7\254\334\005zBK\206\206K\342\266\226\350hj\272O\030g\276t"
+	.ascii	"Z\234\226\212\300\350\b\202\345\314\351\367)B\220\346\220F\202"
+	.ascii	"\263b\245\253\361S#\032\247q\227$\200\276\200\375\334Ec|T\321"
+	.ascii	"\322t\376.]%K%\t\026'J7)\253\006\240WRs\301\325\250qkt\214\230"
+	.ascii	"0\261&\252h\214\030\027\006\033%6|\266\265E\311\370\205\341h"
+	.ascii	"2qtHB\366k\303\317\322\007Y\221]o\321="
+	.string	"\212\361YsZ\372\303D\324\202\\\\#\030\246_W\217\237\265C8\306\242\262Hd\341D\207\033\242zBE\226\220T\225,FX\261\202\252,\"Y\020>g\204\005,\210:\352\215\013\013%\317N\004.x\316\b\036\033e\r\b\243\312\203\002\217\315\n\317\031\241\301\215\272\342\204\n\0335\207\004\013\2363B\231$\241\336\364\350\330\030\213$\220\311\036\022\023\350\350\364\030\215G\343\213\262&\350\302\321\370\222\202\250\352`\245\232\334Qw\202,x\216$\324<g\004\016\017\t\034\036\0166\306\036\2411E#]\2225Ce\215\021\207\307\305\210\303s\325\027\212I\234L\252\310\233\033\342\013\013\236\243\rF*y\356\215j\304)\352\020_n\324d\017V\223/G\326\340\360\214\220\301,\220\312d\021G=\341!\007\247\347\210\314Q&\223D\034cQ\251,\356$\215D\344\n9\311\242\261X\302q\005\344\261\004e\221\350\302"
+	.string	"\222&(\215=:Eb\013\017P\252\022h\341\270\243Ai\3549\222@\243,\032MP\223G\035\033\032\243\312s\234IZ \251\036o>\020\221=)\334\030\213%\\pS\324!^\200\303\215\232,J\240\326\340\030\213Hb\216\n\252\261\270\203T\225\352M\207\016;\2522\311B\205\032\016\312\025\352\t\037*`1B"
+	.string	"\2220jM\314\b<=*\216G\035\016I\0178\305\0245\306\022\224jR=\201\3033\001\317\321(\274M\021\251\032U\234\364\bH\200\001\022\240\200\025/\312\232$\005\324\235\2422U&\213\023\340\240s<\216P\343\242\254"
+	.string	"\251\356\364$\237\223D\252-\024\2217\030\\@\203\252\203\202\270B\013A\265F\2759R F\2759\356`\265\006\005\231$\317\361EU\022O\244\352\013E\025Re\212\034\336\020U\023:E\342\nH5E\212\236\021V(\207He\nj\013E\325F=\361!\206\250$B@\205\r\021\205\216\016\221\204\025\310\231\333$\225*\250pc,\246\270@\231$\352\300(\2235*\0161i\201\r\312d\3150F\255)\241C\252\254\371"
+	.ascii	"\004%RU\332\020\221\304\034\233\032\345\361\210BEj\230Q>\207"
+	.ascii	"\202\037yT$\t\345\361\210$!d\201T\252;\252\216\252\244 Y#\201"
+	.ascii	"\212$\221\002\306cQic\354I1,\306\360$w6$yp6(k\024\360\262B\275"
+	.ascii	"1\232p\323CDQ\263\342\210B\205\rQ\007\305\004I\234b\n\343\221"
+	.ascii	"\004%\362\310#T\326$\240\204\322X\354I_\310A\326\250J\342\rO"
+	.ascii	"O\215\007\265\006\251\026S\024\225F\365\306\004%\362\230\302"
+	.ascii	"\004/Q\202\004\020\0268A\002\251\315\b\035b\021\251&I\034\213"
+	.ascii	"$\214E\342\016\t\033d\222\304\210\t\374\322f\372\232\210\340"
+	.ascii	"\260\202\341>\250\203\022\365\341\266\030\347\226\036n|]\367"
+	.ascii	"\267F\327\242\312m\213\332k\203R\301c\351\0254\031W\246`\263"
+	.ascii	"\025\320H^\364y$\310\n\240\024\354\345&d\212\271\367E\343\244"
+	.ascii	"dj\211\036^A\360\005\255\213\262"
+	.string	"\204\245l\211Q\345\035\271Q\303J^\343\206\022NiZ\303\240\\\251\031\256?%5\356:\212\214\222\0316`\330\035\335\267\274\031\224\324] \353\207\204$I\323U\301)\t\234\232\273\3148-9\2364~\362\004\267i\r\301\020\331\260J\232\362\366\206\341\242\212\242\327JQ\020\032\330\3111\234\f\265+\034ukk\270\355"
+	.string	"6\007mi\021E\203nP-\300\330\216\333\200\206Qr1@\235\241\241\341\264\n@\367\242E\260_\334\017\262&\307it\177ZZ4\30634\322\2163\032@\272\312\312\260\231\345\262\252B5\003e\357-\211\311\261\031\336\217W\227\337\327\254\216\346\244\300\300\360X\0073\262\275\250\360NL+\207\330\361\030\025\031\262\031:\304\226\254\313\274\267\004\207\301P\211\222\327\234\361Q\202\316\274\270\272\302^\366\312JJ\020\232!+0"
+	.ascii	"q\327\261\027\333\034\226Qc\314u4\214%\254\352\2511\336\302Z"
+	.ascii	"8\013c9I\362'\301\253\275\312E\035\210\224\345a\371\313\331)"
+	.ascii	"B8\004\272\274\303J\216W\032\347\232\232\021\250\032_\336\363"
+	.ascii	")}\f\307P\034\003\256\272u\303\274\274\312E/cjxC\376\262\220"
+	.ascii	"S\204\320\352\205U\\\0239\256:>\362A\b\327+2\244\216\331\030"
+	.ascii	"S\035\033q\2721\211\026\301F~\230\030 QYD\032_\306'\275\001\322"
+	.ascii	"\253\031GG\215\361\220\204e\250#\363\263yp\272d\n1fd\2044M\322"
+	.ascii	"\0303\025@@HL0\033\315\303\366\001\023\300\324g\363\271\030H"
+	.ascii	"\221bLD$I\222,\273\001\340*\370\362\r\215\226F\035\370\275\004"
+	.ascii	"\246\306\377]\241\002\3446W\332\252\202%\025\314\033\266\304"
+	.ascii	"Mn\342G\213\352\003\242\214\351\276\322\020t{\232c\002D\347\273"
+	.ascii	"\227@\221\334$\260\217\311\3428\305\225\245w\346\004;\035\224"
+	.ascii	"\276\200z\t@"
+	.string	"\260.\271\205\177T\314_\024o.\207\263\305/\314\243Ih\020\256\016\335J\322\311\266:\372\030\250\267H\023\350\226\350\257\261$\366\005d\n\224Xu\002\254tsD\232\037g\375\304PL\363\223\2208\022\246\027H&1j\210\2040\327\031F'\016\200HW`\363\255\021C\200&\031\fI5\f\202\177[:\351w\353\217\337\345jFU\334\022N\250r+\247\357\224\317\347\257\366\002\367<v;\226\274\221\273\3564\341j\034\326\326\234\362\274M\022M\347\237\350\fD\307\210\253\234h\003\314\342\026\314\363\0078\266i\233\321\210M\330\374\271\341\315\003\032\3623\016+\245\316\3542\345\313\007g\350\f\205\362{\224/\227UV\t\276\317\0171a\"%\345@\022W\361\035\n\205\021\036~\213\201\332\352'\354U\b\244\013z\370g\233\022\r\316~-\262H\025\356\2117\374j\f\025\267\202\300sn\263\210\275mq\214\315t\006"
+	.ascii	"\232\265\377&\367\362eB'\335\305d\261!\356\211g~\034j\220\216"
+	.ascii	"\364LqK\321\220\366\216\355 4\210\013\310\236n\226\267\333&\304"
+	.ascii	"\220\002d\025\023\363\311R\037\363[\357Z{\226\237N\341\"/&+\340"
+	.ascii	"\013,\326\232p\367\230\343E\005\352N\246\032#n\203\330\206\002"
+	.ascii	"\374\207x\324\2713bNc\020\321\340\334\255\031\312c\316\202Q\313"
+	.ascii	"E\004\363\247\370\2352\203H\275\274#\304s\036\b#\037;r\356\372"
+	.ascii	"\016\344\351&j\216\341\213i\277\233;\266\216\250\350\"\335\350"
+	.ascii	";\\\244\266C\177<\232\274\362o\257deT\360\376\360\306\327\024"
+	.ascii	"\bKt\220\300+\230\005t\006\033\215}\230\340\310\216\032\231C"
+	.ascii	"f}\232\231\233I\255\277\206X(\327\361\313d\023IW\023\231\004"
+	.ascii	"\314l\344\221\306\324*\317\246R\366h\243\375\213\305;P\3053\265"
+	.ascii	"\255\007?\221\220{ \367Uc\244Q\271\334\200}\037\031\376\331\272"
+	.ascii	"\026\230\024\254\254\333\007\333\353\345\206\340\003\340c]f|"
+	.ascii	"D\205\304d\366g\027\332\223\366\262!\275\222\320\245\007xv?\262"
+	.ascii	"\351\243\214CS\207\033\037\n\240\272X*X\277'\210\234\263\345"
+	.ascii	"\034_v\312\250\375\2709\021v\371Q\270\330\364\344.e\256/~\257"
+	.ascii	"\304q#\351\214\325~\366\2664\006\301\211\316\263mK\027\002`\361"
+	.ascii	"\016\021s\255\025\215K\321\315\202\2613\342\037\357\234\t\370"
+	.ascii	"\r"
+	.string	"\np6\225\034\017\215\376\317\n\020\303\020\275\230\f\322\004\327\035\322\240\230\312K\223oY8K\267\340i\b\2725.\244\373\t\263\326pVCb\267\022\342\337\250\362\270Mv\267\327s\b|op\306\262\222\343\275\203h\005\2203K\027\205N\265\321\3046\256\"\266N\343\262\254\250y\357\233\211\335\3363B\314:\304\033KPc\027k\037\371\006w#r\376;#\276\305\2560\251\016gN\374^x\\\032\327h8\202Y\301\r\2462[5'\024\316A\3441kU\334*\254E\333\206`\006\231_\324a\260\354x\343\307\367I\021\303\003a\373\311\223\303\004\212\267\337F\371\300\205\002\321\225\214\262\257\207V\367/@\350\274\306\t\266\341t\\ef\211\267\005\357\212\b\313\222\335g\316sgL\215\245>l\035iT\004\334\306\374\377w\364\336\005\242\210S7\001C\002\254\013\274\034\"l\254\371\026\206D\314\256\f\304\003X"
+	.string	"zt2+\270"
+	.string	"p\004C\"\270\002v\363\206"
+	.string	"\007\237hz\bI\304i\3750\375Fzr]\3664\305f*\210{\267}]\\\262c\360\3225\373\207\305\013\027w\231\b\374]\311\203\t\225<\027\275t\223\376\203\2578$\006\366\007\2027B\274\\\235'\300\231\200\310\f\263\347\004|}\027\032\375A/H5\257\300aa\331\364\242\215\243:\376D\177\375\365#\007Y\206\361C\270\206>C6\037U\333\315\253\244\247\006\214'\271^J\367\021\251~mf\247\2001\261s\330e\2348\020(\032r\312\001l\t.\304\025{g\031O\376\306\226\243"
+	.ascii	"\212\325\016;\037,\270\237*9mvE}$h)v\317\237\252\351\355\373"
+	.ascii	"_t\312\034K\005N\307\253\374wFl:V\207\n\333\177Y\207b\223\256"
+	.ascii	"R."
+	.string	"\033YWdf\256\036\320\221\212\315<mu\257\340\003\265\303\325=\236\205\fF\322Wc)*a\320\257H\001\373w\030\201\244\021SK\342\025\277\222\3509n@3\202\322\252C\347H\370!s\366\005]5o\264\243\3102\242\232\237\t{\212>\251\337\235M\234\207g\001\003\274\232\231\026`\277\260+5T\366p\214\034\037\244bg\004\277\004\236O(\366S\2549ji\276\n/p\202\351\311\377\223\370n\2665\013\336\314@\003\005\033\225\t\334\347U\264|\222\034\242\207v\262v\313\322\325\374\320\327\3434\371\026<\257\323\003\265\f\025*\221\2605>\340\203\277\367\222\366\266\fRB\035\354\361HE\220\226\203\3523M\221\t\351>8L@\353\244G\333\001M\336\375\321\246\206d^\325I\002PE\025\261\370\262A\311\3104\341.\236\271\205\303\353\303\3320/\330\271\016\030+\215+~\335u\0170\347s}\227\360\256\202"
+	.string	"\347u\257\337N/g\215\241W\037\\\352\320X\344\021\267\323\301\323\231n\243\351W\256\256m\251_\370\003@4/]\022P\\\267>&D\314\306\324\230\230\272\027>:NWf\250n\247\224\001\217\220_\341\357N\021\022\023\372b\200\374A\240#\202\203\031c)-\215Om;\033\311p\315\264pW\365l~\360\fQ\213\301[\2761\226\177\007S\2103*"
+	.ascii	"\317\220:\335?\264\022\322\202B\210\312\375\212\203\032\323Z"
+	.ascii	">~\030\225\307\264"
+	.ascii	".N8E\207N\211M\377\337\035k]\212U:&}\2424v\254\262\220\3003\351"
+	.ascii	"C\244\324w\023\276\231\360\227*\255\265\321\217\204\303\353\032"
+	.ascii	"D\237\356vp$\320\3666m\305:\231\017\"F\262\376djx\352\312\215"
+	.ascii	"\"2\030X\231\331`\274Y\334\221\347\007\335'$\323\025\235D,\216"
+	.ascii	"e'\302\3110@\0051`\310\343\025\205]\231\362rv\035x\3726\323\334"
+	.ascii	"\313~\001\367\337\220D\003\362\020}<d\016O\013FZ\257@\262\243"
+	.ascii	"a4-\320\237\333}\377X\233\305\211\r\274\3675\310\303\023g'\370"
+	.ascii	"\2639m\336\022\232A\2471\236\313x\270\312U\311^\353\370_`D\336"
+	.ascii	"\231\2755[3\3505\230[R\336P\331~\271W\225~k?\360\307V\234\357"
+	.ascii	"\274\313g-\240\355\025[\370\347\263\3046\376\355\212\327\005"
+	.ascii	"\376\001\266\255z\326\025\207\261\310\301\256w\006>\301\246\222"
+	.ascii	"\225'\230\350\207\036\034\340\353,IL\234\303\"v\352|\236\320"
+	.ascii	"%Nc\217\327oQ\265N4\320\301c\226\034\346\236\250~\224\363\255"
+	.ascii	"\033'\367\022\310\013\324y \341\230n\023R\037\270-O\276\331}"
+	.ascii	"$\361\\\261\027\231\336\320~\331\025\342\241T\177c;>\326\363"
+	.ascii	"\377?\273\232\307\243\003\346\361\351\215\225\216\311\334U\366"
+	.ascii	"\017\306e\262\257\336\346\360K\231\234\271\374\264\266s\276\006"
+	.ascii	"\257\340o\260\261\373\234\374\224\203.ml\212\277t\363T\\\201"
+	.ascii	"\371\303\267\231p\300\261\f\257\305\261\345\244zZ3\224a\026m"
+	.ascii	"\\\037W\203\337\3600\270\360?b\326\324\207\322#\374\301\351&"
+	.ascii	"\337o\313\327\345\362\364g<,\302q\305\205\317\375?l\235\203\373"
+	.ascii	"\253x\277\375a\200\222\r\301\212\364M\366\n\263\006M\257\020"
+	.ascii	"\0375\375\177\306*\375\373\214\375XnO]'\037?\003\202q\256\003"
+	.ascii	"\355\020\256\2671\375\344V\255#\003\363Rz\241\237\301\312@\006"
+	.ascii	"\221o\224s\230M?mm\327/\375\032\020\275\232\2608~D\331\245\217"
+	.ascii	"\243\305_S\017\033o\200n\017O\303\362\232\031\t\276=\235\252"
+	.ascii	"\3736\271\347\214|\202t\376\027\005l\354v%\216\364\321\025"
+	.text
+	.section	.gnu.lto_.symtab.4a51a15b232cbfdb,"e",@progbits
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"serialPortIdentifiers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"findSerialPortIndexByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"findSerialPortUsageByPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"doesConfigurationUsePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"serialGetAvailablePortCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"serialConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4a51a15b232cbfdb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
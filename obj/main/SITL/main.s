@@ -0,0 +1,253 @@
+	.file	"main.c"
+	.section	.gnu.lto_.profile.ccb84359813d24e7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ccb84359813d24e7,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\273\207\225\222\016"
+	.string	"\001\225\375\205\241\t"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.ccb84359813d24e7,"e",@progbits
+	.string	"(\265/\375 \036\265"
+	.string	""
+	.string	"p\022"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	"\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\002"
+	.ascii	"\271A6\200\005"
+	.text
+	.section	.gnu.lto_.inline.ccb84359813d24e7,"e",@progbits
+	.string	"(\265/\375 t\305\001"
+	.string	"D\002h"
+	.string	"\002"
+	.string	""
+	.string	"\005\303\377\337\372\002n\001\201\200\200\200~"
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"\001\n\001"
+	.string	"\004\200\200\200\300\002g"
+	.string	"\007"
+	.ascii	"`\003Y\335<\005\325f`,\023a\336\271\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ccb84359813d24e7,"e",@progbits
+	.string	"(\265/\375 \031\225"
+	.string	""
+	.string	"P\r"
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"@\340\r`\001"
+	.text
+	.section	.gnu.lto_.pureconst.ccb84359813d24e7,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\264\004\001\224\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ccb84359813d24e7,"e",@progbits
+	.string	"(\265/\375 \"\205"
+	.string	""
+	.string	"8\026"
+	.string	"\002"
+	.string	"\002\001"
+	.string	"\003\020"
+	.ascii	"e\020\274a\001"
+	.text
+	.section	.gnu.lto_.lto.ccb84359813d24e7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_main.13.ccb84359813d24e7,"e",@progbits
+	.string	"(\265/\375 \317\275\005"
+	.string	"\222\312'1PM\223\016$\351\252\301YF\313p0,LJ:5\255\204\270[`i)T\225\037{\271\321Xs\026\311d\3206u\007:\n0\320\266\021Bd\nKP5E\024\254\246\210\202\322\305"
+	.string	"!\201\255\005\205\0136X\326\005\235\353\320>,\024\256\375\003DkvE\232\220q\211p\330\217`\315m|_f\346N\343\037"
+	.string	"\nAI\246\305\212J^\030\023\217?~\300\005iH\374\023\004\211\327A2aI\311L\370\264\240)\363:\320\224q\034\215m\361\336\234\203\314\274e\027\030\335\3657\370\237\277\"\b"
+	.string	"h\310\f!"
+	.ascii	"\334\255\331\344\315\325\344\302\227\004#\243\005f"
+	.text
+	.section	.gnu.lto_run.14.ccb84359813d24e7,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"\225\006"
+	.string	"\242K+3Pm\222\016$\023\n\255d\321J#@!T\033\020^T\243\035\325\3130\312\356\223\244.\236f\313\214iffp\325\365Y4\2128\206\217\300f\033\331D\246k.\235M\206\343:\233\f\307i\254\005w\031\270R@\260\034CUY\216\232.\276\333\360}\203\207\003\307\310\376\001\202\025t;\n`\2621\212@O\377\360\264ef\"b\\\206\357+M\240\200\214\357-\t\037\021\002\222L\212\025\225\034I#\032\177\251\257?)\220\020(\371\204\244d\246\303\214\221]m\310\256{ j\263(\006\204De\023&3g\240PE\227\372c~\203\377\"\016"
+	.ascii	"\020\013&\t\243\34020\004\224\2439\2148\203\254\345\222\227!"
+	.ascii	"\200\034p;m\266\f\334\270Bq\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ccb84359813d24e7,"e",@progbits
+	.string	"(\265/\375 \323M\003"
+	.string	"\362\304\021\036\2405\351\017V\365sN\234"
+	.string	" 8\266y\373aU\356\253F\300>33^\261\311\336;\005+\327%\254c\354[\356K\350\303,P\032\227\207\265\375\244`\211\324\217\250m+\207j\n\370|\301S\350\020\002'a\377\203\r"
+	.ascii	"`\0200\b\030\2445\210\301\f\003\324\003\200\003\300\360\271\352"
+	.ascii	"\247\270\270|v\032O\2039\006"
+	.text
+	.section	.gnu.lto_.refs.ccb84359813d24e7,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.ccb84359813d24e7,"e",@progbits
+	.string	"(\265/\375`\\\003-\031"
+	.string	"\006/\246H\260Xq\306\274\261\022\343\001\363&\316\207\016|\233\017\207Y\306\236\272v\307\224\016IXU\346\300\337\264xxdm[\354M\3615\360\315E\"\026\205;\217w\355\t\375\02134[\300\3449\b\206'\271=\217U\0335\"S\200"
+	.string	"\207"
+	.string	"\232"
+	.ascii	"\377\025\324f?\347i;\022\350\374\201f6\277\005{w\317Qw\366\206"
+	.ascii	"\355<:\377\202\337\277\366\333\372\335\177\373\037@i\273\177"
+	.ascii	"\214\024y\253\325~\237\004\265\333\354\022\235\337\313%)1\311"
+	.ascii	"\364\347\\-!\222\336\276sm%y\316\337\216\204\226`j\207\234\347"
+	.ascii	"\177\265\002\336L\027U\274OW\255\020$'\273\356\330>\262\255\263"
+	.ascii	"md\273\3106\221\355k\033e\333\211m\323\322\322\322\222\355\020"
+	.ascii	"\266\257\330\236\2266\201j\252\020l\1777\271\334\333\240+"
+	.string	"`\217$\243\f\357\263\375r\333\2568\377h\376\276\f\303\025)j\376\270\027Oo<|\212\376\264\363\336\370{3u\032j\202w\244B\336\263\f\177\307\362\264\323\326\243%\231\033mH\246\250\r\311\213\232\247\335V\222\206;I;\3150\350\242%\231\216f\212LQ\363f\004\345\311\003\222\366\236\232m,S;\362\236G\372kN\347%\204\337v\226H\343\213\252d\266\353\231\031\031\317z\003BJ:]\275\tNS\024\262\307$\245\006\222\216\324\310\250\301\321\n\241 \027kK\353}\2564\300\242\242z+\356,\252N\306\316\026-\277\017\214\347\244T\372\341}6\201\303U\"0\365YRN\311\205\206\212)8\210\232|>\222\206xx\237E\320\025H\025r\035\252B\352P\275\325\3476\013\002\033Mtfh\271O\020\314\211I\222\265aq\275v\205\013\2362\340\027\372\317\340\004\005hG\021\357s\020;@\377\013\226"
+	.string	":\002h\317F},\377\2678\335\227\263\001\256\247Za\002\262\226\253\365\331&\346\001L\274\311\031!\332\260b\001Z\256\226\212E\342\300\tV\215\210XLd\275`8.\266\211\331\340AC\007\225L,\001\253\221\275\214\270\021[ p^\257\r\260\227\254\346&\007E+V\340s\001\277pD\230J\366z\301T\002\274Zax\371\300!\003\310\212q\265jP\250X\260\230*&t\345\300Lf\265`\242K,\001\332\202\314\004\231\231\024"
+	.ascii	"<CC\201\206\002\31234\253\025\215\314\n\264\314\312\224\304\256"
+	.ascii	"G*\222zM\271\377\206\237\016\006\216\037\357\363\255\007P`5\200"
+	.ascii	"::*\362\355\300\222\013? \200\002\231\312\323\006\375\006\274"
+	.ascii	"\200\261\371t(T\323U\202\377\331s\030\273\004\030\305s\020\226"
+	.ascii	"}\375\350\247\025\354\275\223\335\004]Y,, \363\341(\2015\304"
+	.ascii	"\274i\323l\314sc6\034\336\023\n:\321v\313K\371\030Bp\242\360"
+	.ascii	"\330\007\024A\003/V\033\030\243\b\013\267\346\0320\251\331\002"
+	.ascii	"M\210\2016\323\020\311|\302@\3324\206=TZ\262\243\273\227\330"
+	.ascii	"\334\276qm7\026o\f,\260\337\277\302\037\342\234cg'\362]\003\005"
+	.text
+	.section	.gnu.lto_.symtab.ccb84359813d24e7,"e",@progbits
+	.string	"run"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300"
+	.string	""
+	.string	""
+	.string	"main"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.string	"simulatorLoopYield"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305"
+	.string	""
+	.string	""
+	.string	"processLoopback"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307"
+	.string	""
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ccb84359813d24e7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
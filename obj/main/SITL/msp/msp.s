@@ -0,0 +1,5088 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`.\t\235\027"
+	.string	"F\035fI\240\326M\322\001\220qr\004\313\033\236\341i\002\300[;?\270\003\256\374\023\306\202kX\220\202'\274\226\265\340ux\035^\207\327\301\254\221s\263\260L\343\315\307\3231\250ls\362U\177\370\302'_\324\376\177\373\366\362\177\377\324HT"
+	.string	"M"
+	.string	"H"
+	.string	"Id*\303N\0210\030`"
+	.ascii	"\027\345\331\261\312\316c\035v\036\036\376\032t\255\2031\311"
+	.ascii	"\001\242F\233\267~\326/K#\245&\027\2548#bB\204\212\214!\217$"
+	.ascii	"\246\250U\374V<\225\210\312W?,\346d\203j\304\367\375}\307SXN"
+	.ascii	"^\fq\212*\361\345\022G\270\327\034^si\2060np\346|\340\340.\263"
+	.ascii	"\3141\307\300\334_~i6\270\337\276\315\340\276\340*x\226`\227"
+	.ascii	";\202\301\017\0347p\330b\273V`\002\323f\211\0178_y\345\254\212"
+	.ascii	"U5!9\302\362:BQdi\346\362A\025#\265\362\354T\30398x\222hM\245"
+	.ascii	"xj\242\313\271:\240z\234\310\365\f\347:\353\214\273c\270\323"
+	.ascii	"\\\333\266Z\327\235:\335\265\314l6\023<w\346\2323\367\234{\356"
+	.ascii	"\342\276\260\205[\341R\310q\372\315y\263\315\204\224\320\f1\262"
+	.ascii	"\230\214\236\300\340\375\232\372\261#)\210\350\242\213\300\017"
+	.ascii	"\023yx\350!\230\225\f\032,B\374t\030\274u[\"\245\304'~@f\034"
+	.ascii	"\365\304PI\n\207\221]\234A\tAj\301\303\241\305uc)\b\322\216\320"
+	.ascii	"B\367\356\315\233wo\332\274iA\035\350\034h\233\r8\273\314lw?"
+	.ascii	">=\273\003\200\272\250\321\301\240\002\nF\024$\005I\n\035\240"
+	.ascii	"\202C$i\334\022\200\344\020\022c\210ADHDf\002\241(\005\005I\231"
+	.ascii	"\205\351\255\346\037\361\313\334\301\365\376\263W\272`\323Y!"
+	.ascii	"\255\236\333A\304G\301\1771\3310\226\352do\300P\274+\370\n\236"
+	.ascii	"\270\316\343\357F\3262\352W\314\350\2718\276\204\317JHT\216\227"
+	.ascii	"\302\001Bx\215dx\344\017\004x\005W\025's\004\226\022\245\315"
+	.ascii	"\203\244< \224\221-B\267v\207p\351g\300\250\315[\002\266\254"
+	.ascii	"\350\357\347\356\fn;\246BeAM\016\0160Z\r\001\362C\353\017\026"
+	.ascii	"\350+\007\315\233\016}75/_\365!\022!\207\006\bg\203\342\202@"
+	.ascii	"\217/o\"\260+-fs\266\"w\351\302\352\232<\262\013\332\372p\263"
+	.ascii	"\247v\250\023\211\2217r\255\370L#\312\230K\210\202~G\177\327"
+	.ascii	"\344L\3231\374\310\362\214\373\310?*\223\372\363)\227<\337\366"
+	.ascii	"pg\370S4H%\fL\331\224\003\036\004\033(\261\324\013,t\350\336"
+	.ascii	"\356\363{\024\364\350P\016\307*\bfo\023e\277[\201\216t\221\342"
+	.ascii	"\200\017*\272\351\274\221\333\272_\275\371e\242\337Rs\234\323"
+	.ascii	"!\212\006\215W\021\302p7\257hI!\366|]\276O\227P\201\312\337\335"
+	.ascii	"\026\240\007"
+	.text
+	.section	.gnu.lto_.ipa_sra.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`\023\034}\026"
+	.ascii	"\"\r\034\031\2007I\007-#\262R\214\300\300\334\206\021\203\003"
+	.ascii	"}\236\272\2254m\333;\245\356\036\030\224d\025TM\t\023\354\003"
+	.ascii	"\333f\020\270(`j~\002(j\350\177UW}\375\335\377\377\335\255-\177"
+	.ascii	"\241\242L\257~\333"
+	.string	"{\357\375\366V\277\355\275\321\312#Fu\352\\W\361\225\363\336{\347LE<\212\024\0133\0323F\315P\361\271\006\3024\361p\017&H\201W\250!\346I\332\016\321\005F)\346\212(\017\022\240q4\304\2610Iq\0201\204\020\303\214!\204\020\221@DF\002\231\021\323\244\003\b! \310\333\002Q\246d\344rt{\331\022\032\214\235\263\002KL\345\365C\001\003e\t\211ck8\036V\260\246\200t\352\235\346-\224\310W\306\324\006a\343B\253\267\260yN\001+F\376\272\214\322V\016Q\2200qk\r\276X\235iC,\020\025X_\241}\340o\203\275\200\350\325\235\240\302\355\013\244\261\263\314\257zU\216\230\272\203\352/\367\230\302q\244\362\232c\361Q\326\200\203\013\003\342@%\024V\321\355\356!\207\236O\324\375\005,\331\207\272\222\330\200?\303\013\352\323R\276^aY_s\3757\"\264:=\245\323Y\237"
+	.string	"2\216$O\343\224\243.g\262y\2126\364\n5\254H\321\213\320\031B\210<)\357\341\236QA \226S\335):\003X/\310\245\343\246@\005\314\002/\355\216\365\324\265bD]\321(7\343\022\324\\+\f2\234\377\260\021-]\334\023Z\"=i\277\255\005v\312\315@\243"
+	.string	"\322\210\373\036C1\223\262\3710)d\324\375]}k\004\325\302/E\261\374O56\261\250S\364\003\003l\232\215\264\312\204{/@w\272t\227\332oc\241\036]\tk\327F\206\3172\b\351\300i\007w\257\247\265&\035\r`m\245]\241\326P\0315\272q\203\211\006\366v.*y\f7;}\257\300d\337,~\022J\200\005T\241n}mG\250I\353\344\346\221\246\201\031\351\227\351\322F\003"
+	.string	"\273A\354\262\314P\3612=\352\215\2603dA\0372>\355\374~nDC{\236\337\213.\r\240\216`\341\033vu \300<\363\260\304L\270\372\271\374\215xEF\215\255E\321b\2545;\t^\364c\272\035\350R\177\0324\023\037 \"\200YCk\345\223:\321K\003.\215%\257\fr+\204\230"
+	.ascii	"<\b\3425\341r\310Y\022\266J\t\210\006\203\336\252\301\274\214"
+	.ascii	"\263W_\023\203B!\243Z\020\265\025\0265\226Fg\275\210\270\327"
+	.ascii	"\322\rM+\327\021\003\201r'\202\322\371\270d8A/x$\376\300\265"
+	.ascii	"\372\323{\226\320\0049\220\031\t\013\323\214^T\365\3444"
+	.text
+	.section	.gnu.lto_.inline.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`\0065\205U"
+	.string	"\272O0\021E`\\N:?X\035\2076\272:,\347[\226o\220\212\212Pl\034\267\326G\003\252\037\252`\265\252\275\215Og\306\007l\n7S\325\234M'\016"
+	.string	"\t\356\375b@\334\016\224x\2202\317\230\360\336\320\255\222-e\n\356"
+	.string	"\004\001\017\001O\321\376\033\345\223S\365\252We\364\327\257I\277s\261\265\310\364\224E\357$\213D\355\210\031\372\023\351<z\217\006\277\336\257w\330o_o7xN\253\322\032\"|\337\253\324tyT\346\n\374\274wh\323\252\264n\372\364\336b\223\351\321\r\001^\275\367K'\212\266\331lZ\t\372\357\242y\017W\024\024_<0\377\322\241h\201\352s\332\376\231\237\332~.:\307\205\316M\326\314M\263\327z\204"
+	.ascii	"0\223\331g]|bDW[Td,\334\347\277p\f\350<\365\372\357&[\247\331"
+	.ascii	"\214\023\262a\347\232\3158\005?\363\356\275B\347\247{/\324\317"
+	.ascii	"d\223\367^\001\357\007\230kj\271#[\034Q\377\\\243\347\244\346"
+	.ascii	"$):\363\371\377O\337(\311F\311\033%\373\177\320\366\333\330\367"
+	.ascii	"\336\373\373\231zy\357m\321\277\245\321q\367\336\263-\270\320"
+	.ascii	"5\334\tVF\204\340\240\001\303\204\b\016\030(\370i\262\31428\254"
+	.ascii	"\240\333\355V\"\330\3577\332\240\031\235\345\353\r\f\350#\230"
+	.ascii	"\177\236\371?\315W\231\3234U\317\347\231Y=\257\227\231\371\351"
+	.ascii	"\323TUUUUUUU"
+	.string	"U\365|\346\313\347O\242\355S\212\351\003\036=\252\324w`\307+|\372th\321\312\262,\033\234c\364{\251\333\350X\331\035\370i\3544*YqEj\2222\270\247\305\r\317\220\214=\347\325a\001b\217q\201\342$\303\331h\311\322\244la'\357\273\225\306\310\331\357(\352\346\352\315\230\204[\264jvm\314\241\257\353\223<d\220\340\231\221ZO\224\236&\372\363D\336\321\261\fq\365\244\346\334\t\337~\377\f{\006'%g\253\204\377\363\342\300y\303\346n\215]\235\\\234\2312_\276\355l\357\242E)\002\304\207\r\031.H\200\320 \001\360\300m\215\306\202\266D\354\007\213H\310'\232\252\252\375\372\003\235k\235\343@$jr\326\b\334D\220\217\261\301P!\363B_4\237\343\020Y\263K_\"E\377\225\215\335\024\203\264\"\"\266\030\244\225\023\324\330hL\270\256\206\224\322\037\217\035S\354\242\235\376{x\200"
+	.ascii	"\300\271\251\213\340\235\371z\233\2238\321\224SN\357\371|\024"
+	.ascii	"M\323"
+	.string	"4M\323\224\325u\005\246*\257\366g\261\301\366\226x\005\223\332\215\311\2231EH\266\213/\f\016\210\324j\224VK\340\320\366%\227b#\372L\352$r\314R=Z\264H!;\266\034h\356\310\203\022\355\035]\035\023\230\024\f\362\203\352khlj\3161\350(r\013\f\026\t>\352\326X\2450\366\021-\216\311x_\261\272\370\246\374\240\320\331:\242G\2116\214\216\215\216\320\323\264\361\312|\254\025`\276\021b\306\364\365\362\275IA\357>\302\364Z\016\210\321|aY\3544\220\337\277d\221n\264\276,\227\201\237\231\374\205\227\354\205\331x\215\271\260\032O\341(tsh\316\300\271yY\013\377\177 \033\245\351=\361\254\231\036\260\254\240\253H\317\363\247P\007!\214ja\t[\240S=\257\177\237+RomU\351\342\237}\177\016-\226\231\230\222\363\312\024\2543\341\320\022Y\263S\236o\365\255\032-r*\214+"
+	.string	"S\363`\216\251\243Ai\250\307\317\177\026\315\366\211\314\217E;\331\325\341CKf\345qc\252\n)\376SMW\276}\203\247\200\337\215\222G\203wh\247\342\274\354\004\217\256\367\250\321f5\2612'\374\252\354\365\276\211\334l6\373\320\237x\247\1770V4\363\025\0375\216$\037\265\r\344Q*\212@[\361Q;\331\313]~\332\362;\352\034\017\346\331\253\302\272\362(\376%\313u\357\365\371\211t\355\213\336\363\026[\312\026\227\2673\315\020\255\250\363\250\252\026m\262\f\016\336y4\275G\213\026\355\356h\347|zo<\241"
+	.string	"4o\374@\3728RI\365\340\027\355\004\305Ol\277\027\001\203B\250\",\315\310LiR\220Ba\030\003\242\n\020\022&i\016R\311\370\022@\302\034\307\2228\213!d\f1\204\020\021\021\221@DD\002\021\021I\333\034\013\020)\205f\n\216\340q\327z\325]C\362\325mB\357\246}\343\275hk3\376\242S\241=\223o@\326\032\357(\323\352sL\223_\367!\225\t\301\300\013"
+	.ascii	"\262EG.\264\256\\Pk\202z"
+	.string	"\360\tk\2005\341J\216E\002N@B<\315\226\361!y)\325K\365\243\250L\366\210\360\276\266JhC\303\237v\331\216'}\371\025\231U\362u\305\222\023\177k\312\026\342\321^\273\372\234\016wB\272\201\226-f\235\036\342\220\303\375i\006\361\357\377\334q\216\003\263\232\27531\376\334\244\n\247\225|\337:ER\246/\034\244\031\322\267\326\352\"\026\224\007o\264\353\021\252\320\241\350\237\023&\247RI%CUXD\3126x;\334&\206R\272r\f\221\271QN-\370\320c.\307~<\220\331+[\005\243\037\303\345\3046g\327F\321BPE\212D\373\336\206m\313\370\b\237\265vX\322\237\0222\030#\3254XURI\336\220\327o\323 \004.>\210\r\241\2442\031\f`\024\247\035\243`\255d\210\241\367\223\357\210\321\256U3\251\362\247\301tP>(\233\002\233n\036\013\027\335m\346\351r\004\\x<X"
+	.string	"\212\325\323x\211I\313\255b\260\216.\326W\214F\343\324\307F,jP{\331\033\234\252\270\352\276T&ee<\360\364\200?\216\370\222(\024\004u\264\223!\260\303\230?\356H\"\221\034\272!\233\035D\n\202\374_\020\204r\217\367`\356\323x\363\034\301\360\304\232)\037\356R\257\225\3159\001w\035\3731\006\264G\006(\210\025\361\"\005\303\200\357"
+	.string	"\0135\357\301\3422}\273\032F\225\306\225\034\004\222[\350\"\214\272]ah\002\322B\227\340\361\276\303`\311\227p\013\025NYZ[$\037\347\347\375\261\332\0267`\321\375uv \2532\364\223n\270b(C\221L[\327\300\223c\275zwD\035G\231M\204\326\202x\2661\2013\217\205x\304\307D[\263\330\341\340\373\254\337=l\321\320\313a\312b\001'\234&\264\213+=\035\217\2751\242>@\204k\321|\307|\023\336\020\005\215e\230\244\276["
+	.ascii	"2}\\\037\206\013\013\206\033\213\225\212Z\2029\350\346P\234X"
+	.ascii	"\344\036'gt\353\246\016\243\313`\233X\340\321\233\250\2746\337"
+	.ascii	"\334\024H\353\324\240\235X7'h\263\326\246\270\253\016)<\334\033"
+	.ascii	"\207\256\254=\250h\333u\206Vv\032F\003\370\254\214\356UO\366"
+	.ascii	"\005\302\273Y\276\251^3\354\261\340\202P|\036>?Q% #gQ\004\231"
+	.ascii	"3\347\317\330\3165\004V\350\27406\027\262\303\252-78wRR\"\217"
+	.ascii	"8\345/[\243hg\\zD\301B\002!R\267*\201!-\236\315\261\367$\224"
+	.ascii	"p\365y\232\376<u\274\t\250\353\017\341\220V\0215\231\013W\315"
+	.ascii	"\351]\241\223\002\356\352\324$\201\255\254\"\232\023rV\215t\321"
+	.ascii	"\020\267\224\204\207\206X\016\254tj\022\232\332\263\214j\216"
+	.ascii	"\302t.\375~\343\257\375?\356\372\374{=\374^\r[,\"\370\372\237"
+	.ascii	"\246\370\220\265\027eQ\036\016\365\351\0026<\302\260I\326\340"
+	.ascii	"\237Y\235\\"
+	.string	",\211Pi\341\201\344\215\017\351\312\323]\216\3453\246\230\200\365\006\205\250u,\032\347\343\214\324X{\036\237\211\300\205\003\226X\215\323\310\222p\210\366\337F\334WK\252K}\367\310G\200[\311\033W\263\354\377S\"Jo\221P}\223\300\2249z\016\006K\350Y\n\2350"
+	.ascii	"v\022\377\321\322;\332B.\345\004\021\365\t\004^\244\025\214\355"
+	.ascii	"\240\211T\336\305ki\304\241\0305>z3\220J~J?\372@\323\004\357"
+	.ascii	"\372\333q\227\331\006 \267 U\0243\357\177\260Y))\331JO\036\276"
+	.ascii	"p+\001\004\367w\205(m\027\030\270B\320\313hl\206\366OmF\t\310"
+	.ascii	"y]\353\tz\350t\001}.BA\312\206g\325\035\272\t\023^1\021\370r"
+	.ascii	"i\2728\206\"\373\252\360?\367\312\307g\035\t\r\337\334\326*\310"
+	.ascii	"\024\321\321cQS\232\356\001\203\325\034\307U\305\305&\336\252"
+	.ascii	"\345\345J\b(\261p\336.\230s\367\307=\030\330\026\330\315\366"
+	.ascii	"\003\322\241\363\326>+\343\276\334v\305\346\236\251.Rb\372u\322"
+	.ascii	"C\251z\240\f\fP\036\364:\326?\247/\177\005\b\265\200\232\260"
+	.ascii	"+X-\331\f\224:\252~\036_7\"\354\035\0372\330.X6\022\272\245t"
+	.ascii	"w\364x\036\371\222\346\314J\033\304\267\200\262\255s\224\333"
+	.ascii	"F\243w{\032\r\322/MZk\2171\240\255\300(\270&\354Z\n\341v\200"
+	.ascii	"\005b\257\312\250\235\330\371\307\372YH=\334\262R\020\237\217"
+	.ascii	"#\022r\327\213\022'\344\265YX\326\005\236\332\031\274\242\007"
+	.ascii	"\177\2235\356L\265(\b,?\344\025\357\245\251\021j\222\335\206"
+	.ascii	"tr\216?\224\016\020\024\271{6'&V\222Av\205\031\245\r\222Q\313"
+	.ascii	"\321x\252B\372\\\300\327j\350\265\026\262\332\035}s\274\323_"
+	.string	"\033n\032\302\273\245\375\312\266k\025\332\247\270\311\374\354\354\367\262\224\357@\345\247C\232*N\204-\246\364'\025#\325\310\232_~\212\276X\273\273\3775R\020+\371s\324^\232\353\211k3\233\263A\362\212\342\035\020\023\005\362\301\254\264\027` \243C\262C\332\030\304\026J\036!\\\262\020b+\2152\024\026\257\277\017\310\247[\341\345\265\243Y\203\302)\264\243\334\351\360/\030\260\256\020>%\302FM\270?e\002r3\232\204\316.h\030\3215\024\325\306\001\257\272\264\375)\201 j\f\"\\^1\b\007\304dZa\037\264\267\rop9\225\335\231\270\373:\266\037$\201\215\250\343\227\320t\316\020G\347,\365t\f\271\311\034\323d8\022\302i\310\320$a\257L\006\305\005>Q'\024\2571\312x\037\277\272\013\367\356\177e\030\302\211\347\351\013n\322p\263MQ<r\300\227\274\024\021|\352G\004\262\277\001HS"
+	.string	""
+	.ascii	"7\220\336\330\032\007\355\324rk;\307\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`GMu:"
+	.string	"\346jw?\360\224\222th\313\307fU\2457\032]\025\356\2135\242\350qdR\360\3003pS\322\001\311\213\357\251\356,b\246\335f\227\246\326\263s\324A\334\267UE\\w#?\232\020\207\265\273\221&\223\f^"
+	.string	"`"
+	.string	"l"
+	.ascii	"l\255\231rT\336L(3\371\245N\237\244\034)gV\367\252Y5w\233\177"
+	.ascii	"q\227j\346M\332\345\270\313uiV'\272w\326\342\324\227D\357\342"
+	.ascii	"N\341\\W\277d\200\326\370\262\361xfu\355\364gS?\356\251\037\327"
+	.ascii	"\331\241%\311Rjm\262.\033\276l&\311\326\032\025@\237(<2\346@"
+	.ascii	"*XP.\330\274\224\332\3749\377Y\216\263\\_j\367CW\246\001\003"
+	.ascii	"\263:\352\205\307\303\241/\306%\215kP0x\tR1\250\233\016\342\251"
+	.ascii	"3\207\334\223\264\330\307n\263\202@\267LL\356\026_\2473\253;"
+	.ascii	"\362\247p\356\226R\243n\236\305\257\270\263C\333\345nO\023\277"
+	.ascii	"+)\231\325\375\313\345?\017Gfu/\f4\343\262Q;B\001I\013%"
+	.string	"?\201\211k)\265\312x-\217\007\004\372|\212s\013s\350\366q\207\231\r\310\241#\245\001\267\265\206dV\307hhhhf\247\2422`\021\343A\235@A\245\370|fu\025\372\344\267Y\356\033\367SR&\3277\336\306\375\005\3648t\235 -I\236#\250\016\335D\344\320u\230U`\034T|\020##a\"\311\230+S&}\004\r\227\241\322\275z\033\212\334\233\031\225M(\273\375/\b\347\274\221\257\277n{HV\266<3]2e2e\004~\351\001\233\022qO\2118\f\225z\301\001\331\032uj\260\241:\356\033\265\024\030L\362\266\262\240\3224\313uPfu!Bt\310\242\233\250''s\307U\bE\342J\016\315\321\"\244\001\202~\250\302\364\252\206$I\n\n\205\306\362\t\020\002\216f\212\334Be\036\022@\320(\206a1\022\243(\204\302(\b\021c\b!\304\030\305\21412\201\310\320\3148\007"
+	.string	"%\216\335\201\037\211\343\223B\365\207S\356\315\2215\337\305\020\346R\001\267\241\201\312\205\264\301\022\264pYG8=\245a\353\245Q\321\b\177NP;\207\241a\316\335W\221\204\022\224\366\322S\230\316DR\204\3246\377\335h:A\343b\351-\373\201&\215\036\372\221\353;\304\036R\223\2368\250\377#\266\002\232\205\200f[#W\334\266\005\241\370\254\201\234q\203\003W\314\343\004m,\270\024\357\003\271A\013\337\237-J"
+	.string	"Y+\320\034\207\323g\301a\210g\314a\374\314\240O\341n\351\032\311\315\235\025\023p\250\213A\240\tIT\322\343r\354\236\276\003\371Ib\336\031\264`=\203\226tgO~\345\240\223\275`\210\234p\215v.\225o\203\363y"
+	.string	"\350\301)8\007w\032-\253h\373\001\305,t\315\376\232O6\005e9\343D\320-z&\250tHLZ\217\336\275@\177uF\033ih\027\016:\245`\301\027W+2J\357M{\350\030x\257\255\fa\032d\350\240\272\265k\226\r\025\274\264\266\337\211\002~\001\317\241z6b\013\330\264s\266\261\334N.\270\001+\214\256\313\003\273\222\251N\326\272Wg\376\305\020cb\345cm\0224\016\360N\351@\017\270\204\004\233\024\023;\301)\310f\376n\342U-x\tX6v\264\035\342%\374@x\350\311g!\236N\231u\247\027A\262\241b\251\016\b>\344\274\340\342\333<\037\322(6J\177lw$\324\004`4B\3120\206'\214\256&;\252\361\201\265\301w\206T\214x\b\031 n\372h\243\347 ]\2560B\"p\266e~\206 \347\200I\tE\f1\n\260{\313"
+	.ascii	"R\361\362\252h'c,\374\276\245\334\332o9\242\251\244\352\300\304"
+	.ascii	"\240R\0163\030E+0\030wQ\210\225\200F\242CaEV\225\0232X\256}\024"
+	.ascii	"'o:\031j\344B\375\305\300\300\333P\034\301\006\250+\342%\363"
+	.ascii	"f\030\020\226<\272bl\250C\205\211\337\342\355\307\233M\001a#"
+	.ascii	"\216P\211\261\35084\270\244d\220\032}\225e\020~\351*\215K\241"
+	.ascii	"i\026\360,\002J\271\250d\341\020y\207i\024(\234\353g\241\024"
+	.ascii	"h\317e\241OI\202\267\341\211\217"
+	.string	"e\301\017T_\257\020b\274\353b\243\324_t\013~s\244\250i\0166r\272!&@\022\004\277\256\347\314\352B\347r\376+\342\372M\365\3774fR.\367\353\334\035i\301\370\261\235\031E\2278)3\207o\031\315\357\313+8;P\213Y\210\3640\004;F\031\220\\\277\201\271\260\323\242\335c\251~s\033E\tY\303B\036\220\361Yb\020\315\024C<\311\177\261.\260\375\356\206\340\237\236A\030\264E\321\245k\245\016\001{F\274\310\037z*8Y\333\325eg\270i\256T\253\021\376\367\024\223\311E)\346\222\307\253\"\240\254I~\327Ag\337\016\213\272\270\200\275\007A\271\204\350\225d\2010\002L\265\245\226U\316\f> |c\253\345\307;2\003\314\367 \355c\237Y\306\375V\204\214z%Pw\254\354\"\021\201\303\204\317\256\345\305\003\006\031\007a\260\020\242wq=~\347\354Mv\004?s\001\302\023\b="
+	.ascii	"<]\fd\3450\256\355)\230Q:\307v\312\240\311\364r\246nh\212^H'"
+	.ascii	"\236tl\274\257\277+N\235&P\363\261\200\211\275\314P\347\003\037"
+	.ascii	"\033\345\022\376\025'\300\304\262\006\177\372\006\253\b\347,"
+	.ascii	"0\005\214H\350\314K\340\366\343\314\273\355\220\303\347#\213"
+	.ascii	"\207\031\362\317^\374\334\200\235\007S\260\273z\326\350\330D"
+	.ascii	"\244\240j\204\006\303n\0278\"J\220\217\251H\351\2510\273j\300"
+	.ascii	"\002d!\261\026F@5\334o\304\034\323\367\236\211\322Q4\"\315:\346"
+	.ascii	"\341@\344<Lq\356\232\232\3621~P\356\220CL0\032\370\356\210`\265"
+	.ascii	"\354~RN\211\247\245\\`c\367D\301\345\034\023\337\367\211f\276"
+	.ascii	"\316\203\267>\2626\326\341\217K.\355\243\035a[\205\360\276R\242"
+	.ascii	"\335\333\204A\2659\247\362o\031*\032{ "
+	.string	",\031e7\234\0208W<,8\330\210\215\024AO\367(Z\322l\031\371\212lX\206@F\033\330\302\034\200<D\370d6\025\366\211\351\004\345\013\222\t\260.\0167\226\025\234\t \210z\256\375\241\216U+\303\"\023\223\325\27558@\3225&\030\305;`\t_Im%\225>{}L{\347\202\210\334\214\2301X\025n@[\231Q`V\316[\324\305\252\200W\252\223A\362\265 \311\017\356\310]\207\340\335\033\002\222@#\362\246\3149\005\021\034B\342*\304\247Z>\270\272\2772\255\220/\222\344\214\002\325\331\262\244|4\n\340D\032ea>+\3612K\034\365\200\214\031\314\267\334F\001/mEFU\007\fU\006-e\376\236I\263\310D\231\343\f\2038cqi\236\016\237\324 t\211\256,\177z\265/\346\b~U\r\f\365V@\322\343\324\236\346\332\030\320a\027\244\357\315\177\"\332\207\213o]\250\343"
+	.ascii	"\345\326\r\363\016"
+	.text
+	.section	.gnu.lto_.pureconst.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\230\004\001\231\004\002\230\004\003\230\004\004\230\004\005"
+	.ascii	"\231\004\007\231\004\030\271\004>\270\004@\232\004E\232\004F"
+	.ascii	"\230\004G\230\004H\230\004I\232\004J\232\004M\231\004N\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"\275\006"
+	.ascii	"\322\n (\200K2\03430\0033\260L\302\356`\377\374`\220i8\200\325"
+	.ascii	"\201\003\372\226\3300\324\021\016|\347\225\242\204\020\262eJ"
+	.ascii	"\001B\022\030\"\212\"\250\007N\231\01651p\245\346\360\237R/w"
+	.ascii	"_\273`\002\007\0042\346\030s\205h\033-\245\200\r\260\226\215"
+	.ascii	"\251YKc\371\305\326b\016m\241y\305\234b\311\tg\376l\237\371\302"
+	.ascii	"VbKb\"\346\316\026bSLL\316\207\271\303f\303\336\207\213\276\021"
+	.ascii	"% p\002)\224v.\b\262\240\304\376\036a\346\030\270\270g\233\321"
+	.ascii	"\355\235S\206''QL~\242\230\255\246\326\252d3'\330Mce\300\210"
+	.ascii	"\034\224\303h\207Th\304\004A\001\017A\215$\214\354\034\366\243"
+	.ascii	"]g\032\032I#\244\211\2446\273I\255X\301\003(\002"
+	.text
+	.section	.gnu.lto_.lto.5e1c563b0ab476b5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mspRebootFn.171.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`\250\001\335\016"
+	.string	"F\232_E\020\221\223\016\324\277\026\237\322\336S\215\335$\252;\366\3327\322\345\003\267h\357Iz\300\307\335[\331)\210\025h\237t\372\t\b\262H\255X\200\002"
+	.string	"\024\n\210\032\001\007\350\330x*\200\022o^\324\204\354\266[\246\024M"
+	.string	"I"
+	.string	"I"
+	.string	"\254\013'\326\356f\221\344KA\237\330%9QA>\210\214\031\032\250\257\373d0:\366a\205\345\0276\272t\200\303\373D\347\274\364\003\035N\241\032\250O\364\250\022\232\035\0211Fx|\026\242^!\273k\365\276\225\033\300mo\260\355\261\257\n \2550\207M(vv\330i\204\261\177\301 \201p\004mU\177~\364\302\272\321\200f\227CK\307\252d\212\304\207\355\253}\231\243"
+	.ascii	"=E\205\017\330\005ijv\303\005F\200]:|g^b'0/\r\262W\017C\354E"
+	.ascii	"\n&fD\224\377\342Vo3h(\261/,\374\026^a/0/1\221-\261dN\330?\331"
+	.ascii	"^%\210q\361\260\333\335E\275U`@Eo\354\253\370\214\346\307X\002"
+	.ascii	"\247\367.}n^>\306V\013K\212\266,\325\236@A\3579(\233&\002a\304"
+	.ascii	"d+\341<L\3429\341>Y\004\223\221OF\262q\231\247c\355\244d\313"
+	.ascii	"P4m\313>\302}\004K\227\242\032\226MJ\f\371\246;dF\030c\234+\202"
+	.ascii	"\377%\006\033&\031\301\007-.\256\251\021\347\023 \365\251\276"
+	.ascii	"\342\002nT\235\356PS) \220\202)\331\035\377b\204\321\270NG\006"
+	.ascii	"\200\317\223\311\334\026\302\255\327\261N81\375\270\021\246c"
+	.ascii	"R:O_\347\242\311DH\023(\342\352\347\225Md\350u\233\310c\331z"
+	.ascii	"1\033\346p\203\255\373m\201f\261\344v\003\254\236'\003\"\223"
+	.ascii	"\031\272\360\220s\306\243\275\034\353\334E\006"
+	.text
+	.section	.gnu.lto_serializeSDCardSummaryReply.172.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\005\b"
+	.string	"\362\01655PO\323\001 \330\222\204\326\245b4\243D!\020y\354\001\006E\337\234\345\263&\304\351\331h\341\306\314\317\220\214\212\210h\200C\357\004jx\334Vc\255\033\2212\245\240\253A\335\341|.O\204x`\360\304\216uE\316\306\325\307\301\212\240\252\262\242\306\333K\253\233\027T>\013\2750\314\237\\\004\323\217\240.\211\216\033 \221\362\340\251\366\004E^s\256\214|\030\232\331^\226\332a_\332\335\265n\366\273?\341E6F/\n.\273\03210\373M)!\032\333O\373\334K\260w\025\017\330\335XD\273\036\202\013\340'{\337P\237\340\005\250O\306\354\226{\037\233\001\3412PF\273\033\325\343\330\023\363or"
+	.string	"-\224=3\t\273\353\324B\034\267\3366\201m\003\3730\021"
+	.ascii	"\357b\310\304c\240\321\342\302\353\234\200\273D\350\002\026\002"
+	.ascii	"\201\001Z\340L\\\316;\016\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serializeDataflashSummaryReply.173.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\355\007"
+	.string	"\262\31645`O3\006Tj\002b9\361$\230\b\222th\213':\310\034\247\025^\230H\360\353X\217`\344\325V\026\003ELQ\226~\242\024H\227\256\376\335\335[\312\224\002!\315!\326\323\001i\037\031\001\321\360\221\236L\223\035N1\320C&C\030\226\311\315\274\247G\257\013%\337E\304"
+	.string	"\261\212?.XKT\332\004\201\307\004\021\fcKQ\001\3355\300\245\343\313\210\\;9\030CZO\377\337\350\265&\331\320\262\311K2\f/\377F\r\315?\252\205d\323\326\260\365\211Q6\223,,\360{0,\377L\250\301e\252\323\234\312\324\345\201\312T\2676\306s\344\326h\244\261R\372/\243\2107\303\255v\212\001:\021gh)\374/\354D\034nt\333\202\266\007mg\002\020"
+	.ascii	"\357b\310\304\303\277h\270`\301d9\235\003Q\350\224\002\002\343"
+	.ascii	"\f\\\316;\016\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_mspCommonProcessOutCommand.174.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`M\"E\211"
+	.string	"j\335\350/G\020PKg8\225\227:\320\221\355\017%:\343\364\337\203\023S\026N\002\274 N\376\377\243\252\256\026\275\0163T\334\314\34585"
+	.ascii	"\262\222/M\216\017\362\374\034=^\316Q$\037\023{|\332\037w\267"
+	.ascii	"\335\203\354-e\222\001\345\002\245\002\374\002\353\002\211\267"
+	.ascii	"E\363>\025\361:5/\213\"\357\212#^\025\315\233\242\310\333\324"
+	.ascii	"\274L\315\273\324\274(\212\274'\232W\251yM4oR\221\027i\210\367"
+	.ascii	"h\210\2678\304kd\304[\324\274DE\274CD\274B\315\033T\304\013D"
+	.ascii	"\304Kl\336\037\"\336a\363\246E\274(\021o\017\361\362\003\377"
+	.ascii	"\327&\211&\345I\377\321\255bO>\3532\335\223\362\301\037\316\037"
+	.ascii	"\370\003\376~?\337\337\367\247\371\317\374d~\275\257\231\246"
+	.ascii	"1H\037\307\263Gb&\206p\367wv\205\354\304]1"
+	.string	"\253\303\364D6\347\354\253\224\025\302\331\307\271\240\234\007j\275\357\307W2\302\345\220\023p\377F\360o\205\316\264\301\301i\272i\263O\226\005\022~\315\236\315\231_~\t\255\367U}\005[\201\232pI4\327\325\b\b\304\247\006\f\2374\344\323\341\253\327\212\203\025\270<\017\210i\366j\340\220@\263B{F\207\247-\272U,\210\355\214P.\003b\231\025\022\3631Z'\263c\276\222\255'\322\204J`s]W\250\247{\203\370\364\t}\322pO\357\252\270\366\2557\302\207\312Ys]\351\240\236\256\0241\017\211\264\203g\206\234s\304\301\314p#\266\307\220h\233a\367\356\31022q\257\273\227\254\033\261@zxoI\271u]\205\262v\205\236\032\355j\355\n\355nZ\004\rK\305uH\027e\024\312\273\337\3629\255\323\331\360\243um{B\321]i\370\224\370\244\341\323m\276\234\016\333\353\232d\243\304\272\322\025\260"
+	.ascii	"\020\237\322P@k\215\247k\"\366#\346\344\253\216p]\351\242\232"
+	.ascii	"\311\356U\234\370\363O\246E\217\322}\205R\343[<9\261X\241\"E"
+	.ascii	"\023\323\022\212\023J&\222\220\216\212FEDCBA@\304\237a\212\266"
+	.ascii	"\0136\356\267\336B\317\031\355\316S\n\276#\323).\r\013\347\321"
+	.ascii	"*fy\216\177+\236\262\260\n\271\247\260s\242\235+ft\326\310\344"
+	.ascii	"\336\364&\216\231\224_\372\221z\363\033lI\345Q\240?]bQl\350i"
+	.ascii	"\356]\r\024>\021\345JA]h\274\370\234kdB\334D\237\2217\364\311"
+	.ascii	"\215\020\234\244\346(\034\022T\326\310\242\034\211i\315\221y"
+	.ascii	"\204V)\253;\376\025SB*F9\2424\345\234kdM^\204*\211E\001{\237"
+	.ascii	"\221%(\001M=<\007\223d\242\027b\203C\350\220\037\234Y\321X\027"
+	.ascii	"\212@\031\022~/\363\026U\214\230\261P\213 \310\316\036\324>\204"
+	.ascii	"\001*\022\206\270wF\272\351\302\374a>\314\341\271\276<\325a\020"
+	.ascii	"l,\311\321w\371\013%k\216\177G\214%y\363\331]\034\201\346D\312"
+	.ascii	"\223\262\2739,Z\322\266 \277\274\206\004\215\035\207m\347\003"
+	.ascii	"\332\327\214|A\342\037\251u]\227\301\306\310\276/\276\333\r\354"
+	.ascii	"n\222]'\254\3754\244\267v\271\216\275\030\205@\377\266F)`F*\303"
+	.ascii	"\247\334B\220vJ$\027?\207cS\b\233{0\214W\214D\3049-\323\031\225"
+	.ascii	"\274\205\347\214Y\366oO\327\250\3058\307\007{\372\363\r\034~"
+	.ascii	"\357-LYzy}\245~\206N?0\021NH\330\034Yv\035\257\344\\\235\303"
+	.ascii	"v{3\355\212,\221:1z#x\210\nn@\302\307\353`\027\020\275\260\004"
+	.ascii	"x\212\201\006{\226^\275\265\274\236\371\234K\264\211\017\370"
+	.ascii	"\216\031\326\221\301\242\331\304P\337\241w;\370\200\017\266C"
+	.ascii	"|l\226]\275\265\357\363wyzgI\330\334\342>\335nB|\245\266\270"
+	.ascii	"\317\376*\342\350,]\264\333r\224e)+\270\204\007Y\be\371\355j"
+	.ascii	"bJ\310\3055Yv\302\205\346\266\034\304\026\034\340\224\265e\266"
+	.ascii	"\257g\200K\226\325\004\213,\321\226\323\304d!\224\213\343\262"
+	.ascii	"e\263\335\213\003\224\213\373aY\211\215\253\255W\302\246\254"
+	.ascii	"jG\226\221\304\200r'\027\267\252\031Y\036[\301#\241\006@\221"
+	.ascii	"e\037V\360e\332$\321\236\300\226\303\322wu\017M\271\270\257e"
+	.ascii	"\036V\360\347\017\211\016Y\356\352;\336Z\346\342e\260ULn\312"
+	.ascii	"\252V\270\177\256 \361\327a\370\224\230c\325\323\224\213\343"
+	.ascii	"\263\273\202\377\263\222D[\327\255'\005\031l\035\340)\016\375"
+	.ascii	".\017\342C#\226\\\241p\341.\335\361\350\332n\273G\327n\333=\301"
+	.ascii	"\3738|\327;\357\301|\261C\301\373\2729\345\033\223\266\247\371"
+	.ascii	"~\355|\337\247)\361\036\355g\276?;\340\367f\207\363=\222\346"
+	.ascii	"\375\221\373}O\326\274\377j\336\037O\346\253\236\356\337\241"
+	.ascii	"ys\270\334\217C\363\332\260\274X\037\374\316p\300o\220\247\371"
+	.ascii	"^\235\314\327\252y\253\212\274@\232\367G\221W\206\346\365Q\344"
+	.ascii	"\355\321\2741\234\340\205\241y\251\232\227\207\022\357T\363\276"
+	.ascii	"P\344\335\321\274.4o\013\315\313B\363\256P\344U\241ySh^\024\232"
+	.ascii	"\367\204\3465\241\310[B\363\222\320\274#4\257\b\315\253\243\310"
+	.ascii	"\033B\363\202P\344\315q\304\373A\363zP\344\355\340\210\227\203"
+	.ascii	"\346\335\240\210\027G\363jP\304\233A\363bP\304{\243y/(\342\265"
+	.ascii	"\240y+h^\n\232w\202\346\225j^\t\2327\202\346\205\240y\037h^\007"
+	.ascii	"L\3606\320\274\f4\257\215\346]\240yk4\257\002E\336\004\232\027"
+	.ascii	"\201$^\032\315{@\221\327\200\346\215j\336"
+	.string	"\031H\274\0054\257\214\346\205j^\002\232w\200\346\215\321\274\0024/\214\346\r\240\310\013@\363\276(rn\316i?\310\231\355a\362\005\325\350\005\032\355\343\205%U\240k\364\022\236W2\201V\240/\345L\225J\215\004\372|e\201\b \320\235\026\346\253\020\006~\2333\325+D0\032D\250\312\2475\215\376aK\263S\353\244\312E\201&\353:\304\3066Z\247\251YP-\352\334\\Z\237y\024M\331\237\363~d=\254I*k3\225\013\332E\255\033\326\235\365\321\034\335+c\343Dr\001\361\030~{\226H\007\030\320\007\030\320m\306o0\252EG\035\341}\025\2460,\240[\364\362\027R\205/*\030>X\001\215\232\361c\363u\205\216\202\376W\377 \003\037AS \347\004t\004\375;\002\032]\372\235\311\341\312\024g\323D\347`\243M\b\3206\372^\004h\024\320\257\314\347\230\372s\035T\247\315\003h&"
+	.string	":"
+	.string	""
+	.ascii	"\306\274p\321/\360:L\315#\256\353\220\032\333D\032L\325\013\243"
+	.ascii	"\216\0313|\352\242o\245,\317\271\245\211\237\272\237D8\243\246"
+	.ascii	"\341\2039u\n\350\247eydr/pt\316\243v\333\026\274\214n\207\243"
+	.ascii	"K\360+\257\350_\372u\035\266uM\305H\021\004\225\215\272\004\037"
+	.ascii	"\354v-\324\004\2422Gf\324\\}T\003\231\252\0337_:\345\312\243"
+	.ascii	"L\372\252\222Wd\034\036L\277\300\205\3744\356\337V\375S\337\274"
+	.ascii	"\031>=\230>\230_\211\225d\232\330W\212\b\007\263\236O\021.q\360"
+	.ascii	"^\r\034\252sT:w\314<\313'w\226C\355\266@fAj\247O\\@\335\252\303"
+	.ascii	"\226\210[\001\tv\2013\204\365\354\357\003Z\234\032!\031\267j"
+	.ascii	"\265\221\330|\230\343\225\204\301,V4\213~\240\212^\241\256\261"
+	.ascii	"\035u\220\270\256\253\215\345:<\250\336Q\363\250NV\235\303\247"
+	.ascii	"*\372e\236\"\221y\224{\\\374\354\245\303\364\302'\b\006\247h"
+	.ascii	"\352"
+	.ascii	"\024{\232\3020I[\235\315\256\277\247\320g\322?Hu]I\350\024\276"
+	.ascii	"\324$"
+	.string	"\364\363\324>K\215.\231z\313#\212>\321(\372x\352\363D\267\031\346\334\362\370#\335\203\227\263\245\263\311\243\177\004\352.4\017<\307\247R\273\320\307;\212\345\215\360J\036/\022\034\215]|0\245F\001\231Z\032N\315\206\206\352\240:\177&\265\r\275\354e\347\310\317E\352\244F\327|\025>@\304\030\306\007C\352\024\220\231eyL>\006S\tt\264,r\324Kr\316\020\213j\304\212\275$\247\314\211\205\214\314\214\0315\r\344\237\023\311D\336\204\231\266$N\221-\273\236\212\020P\253\221\304\250\204\017V\324\275\354\273\303'\206h\250\211\204z\210O(L\031_\363]\237\036\215\035\322\214K^\300\262\354\n\002\352 b\003\035\r\261[\211>e\024\357\032\331\214nh\232\t\373\210X\036\177\232\373i\330?\303N\351\372\226,\207\244\375\204v\332\357F\373x_\2052\230\235\030\241\360\301:\333c\006U\f;\204"
+	.ascii	"\271\252!*\013\353*\313\212*k\305j\340A\b\037\244\333cFV\017"
+	.ascii	"!;\252\242\254\256\252\252\256\246\232\260\250\204PU\245<|\260"
+	.ascii	"\020+\032\256\246R\037\247\242\001\310\216\032R\253\033YYTSW"
+	.ascii	"X9\204d]\345\b\222UU\024\222\305\243s\350\350\200G\325\324p\247"
+	.ascii	"f\004\311\252\212\262\362\261\243*j\n++j\206\322^\005\241\302"
+	.ascii	"\212\022ru\205\025%D\307\365n[ JB\273\274\364]N\344\243\024\264"
+	.ascii	"\313\343^\217\205\325\334\307\375\236\257T?\237O.-\256\314@\351"
+	.ascii	"\371\321\335\034-\313\263\307\020|>\ry\311\243\346"
+	.string	"l\"\037C\360l\351T\005\244\253\372x\205}\200\324)\177\310\320?\372xz\23428}\364h\037}<<j\336\235\036}+gF(c\210\3231\350\030\302\320\217\023\330t\264\3464a\240Bk\252\021\206S}4:-Gk0\316T\277\212\331\363\205\035\375\002\340\337\216\302\tZ\350\tX\350\026\232\251n\205f\241\227\326\250\320+\334\3516L\025\n\337\206B\277\355\204F\301\204>\241\2046!O/\331\224\320\267b\326\007\202\021\032\002\021z\204^r\343\205\205\355:Z\204\376\351\023B\353\350k9[M\232\020\240\200(\003\230\324\262\205\253\207\257\024\013\020r4\b\037t\216=m\246\314\007\201\036t\320\036p\320\035\364\265\372\264\030\255\347^\207Q\267\216jW\327\360)\007}2frdLi\373\217d\226\377@s\376\350.\216\022\262\301\345\026\367\331\025\355\266FXR\310x\n\247)\f\3523\364\355\274"
+	.ascii	"=1q\272\274\031\302zn\203\016\223N\305\0068z\203\257\006\363"
+	.ascii	"\346<\342\013\016\247\006\031\264\006D\332K\023\302:#2\030\243"
+	.ascii	"\304\340Fc\240\2065\027\225\213\021\2251mI\271\347\241S\213\240"
+	.ascii	"I@\2549\022\312m\3519UlL=\222d\370\364F\037\217\231\030(\031"
+	.ascii	"\266,\273.\260\240/h\306\223\321XT.\304\270V\252J\3202\365lx"
+	.ascii	"6|jA\277i\226\247\334k\266;G\272\203\243\354\024\200p\340\226"
+	.ascii	"I\340(iZ\272Y\247OP@=H\220\256\240\202\3565_L\355\266A\372f\375"
+	.ascii	"7\327\301\226\314\363#0\306r\200\216\001\243\007\220j\030\375"
+	.ascii	":\335v\tZ\252S<\257*i\022\364\233eO\345\026.~\036\005\177cN\t"
+	.ascii	"\302\346\214\376QF\317x\240e\364\233K.\250\002\361@;\340@\367"
+	.ascii	"\022\246\025\177\316\005U\267\006\230\250N\220t\003\375\303\266"
+	.ascii	"\244L\262\337\240@Q\347\220\364\005\371,9Q\271\240B\250u\303"
+	.ascii	"\223\365\377\356(\333\376\364P\240Q\372Z\247O\220\240~\325aW"
+	.ascii	"\315@W\360\263f\240\361\224\371\035\377\354\316\\G\024n9\321"
+	.ascii	"n\233\202W\222\233\003\251\245Q\2133\307\304\002}e\207]\365\327"
+	.ascii	"\372j\256\203\r\355\317+Y\205\256\353\232\004\315\"\370\371v"
+	.ascii	"\346od\231Bxe\377M\251\335v\220\210\227\024\023\335\266Iz.\300"
+	.ascii	"0\201~\202\277\250\362()\220\202T)3B\"\222$I\232\003\"\013\020"
+	.ascii	"\b#a\032\306\326\003\022\200$-L\243\2141#2C\222$\303\030\310"
+	.ascii	"dw\f\026\355\217N-c\317\017\375R\033\311\333\377\246*\211\345"
+	.ascii	"\270\262"
+	.string	"\264\220\034V\007\361\030\225X\264HD\f,<V7*\375\205\246\nu\310e\t\277\\bJ\341\0329\026\205)\001\034X\311F^\253\251`@p\276LJx\215b\236\237I\266\330nq4>\001I\375\230\302\2264\363f$\007\346\212\366\322\371\023\266\017d\270\201\227\361\036\361M\261f\t=O\365{\r\236b@\333=\021\333\002N\265\302\002o\2274\224\017%\204\344Br\305\216Ay1\201%\310\334e-\257\007|\264&\310\024N2\356\225\343E\r\301\214\236\245\356Ci\363\273\212\242\360~0\030\321\354\302\220g\212F\0024^?]JnA\n\210\373\f\361\376\264pw\017jR\001g\017\035\336\316\200D\032\335\255\021\226\330\31230\372k\237\240\034(L\034F\274\355\207F\307\362;\226\034\316\024\205Q\020#P\273vm\324Ih\013\f\207\210\255\2579\253\237\205\033\\\035\031\226GK\202\307+h\341"
+	.string	"\037\256Ne'"
+	.ascii	"\216`\013\214N\250a\2735@\220\351N\026I-C\036\\}o\374\001\\\346"
+	.ascii	"\217\272\341\200\374\367\307\030\t\004\365\213\202\266\330\""
+	.ascii	"o\203\353\373Ay\217\321\005Dc\020\214\027\\\\\337\203NN\204!"
+	.ascii	"n\314\237\254\347\\\334N\"\304z\361\336\225\306\206\217\363!"
+	.ascii	"b\317\031\f\326wo\246\016\351\024\316\007\320!\252\253\013\215"
+	.ascii	"\344L%~H(\\\023\233\200/\346#\213\276){\331\267\3446\324\321"
+	.ascii	"T;\337\373\353\325h;\314b\004\b\263\353\032X\246\277\251sfI\013"
+	.ascii	"\257\007\2247\034\272\352_\r\311\326\2658a\204\374p$hJ\256\223"
+	.ascii	"F\022\004\3155N,.\017\205B\002J\357T[\002\004B\275\341\223\220"
+	.ascii	"\234n\223#\340\250\204\034\260X\240\020\236t\233{uzt\201a\336"
+	.ascii	"x#\224m\210R\250\246,\253\245\2000\006~\235\346H\3700\030#5\304"
+	.ascii	"Y>\\\365\356\345\301\r\310\2456\304R;Eqo\354 b\024\312\264\027"
+	.ascii	".e\315\317\235\324`\217\224`\306\262|\233\276\020\224\313\225"
+	.ascii	"]\374\336\264{\330+(k\273k\300!2\022\001y2\275\021\304\na%\271"
+	.ascii	"\246\365\343b\\f"
+	.string	"n\025\3233\027s\357\037\034\374KvyT\220\271\312\250P|\222\250\373\252\267\203#\265eI\360\267\276\341\024\t\332\370\322 \264\207Vq\371\227\224\324\251=B\027l\352B\327\211\216xCm\272\037Y`\303v\262\242\"\321\n\231\374\032(\006&V\027\227\021+\352\345\356;\244\002uR\323\2626\027\313\315\246\212\320\247\026Ng\230\250\213S\260\335b\267S,\366F\002\311\356\321\256s\t\307\276P\033\215\265\206\314\375G\206\232\2137\365\322[8_z\020\017#\005\t\026\251N\326\260y}\366\311VOv\311\271\243*S\240\311Y\021\307Wh)\354\215\031c\360\271\257j\276\244\375V\0052w\013\245%1q\".a\267\231\223\324\035\371LS#qH%m-PtW{\254h\222\2769\251\345\227cN\263@hk\334\354`o/\272\240\260\370\305\263\247)\004g\3709t\017\350\312\242\365\257\246\263>-"
+	.string	"\231Y\227p\307"
+	.ascii	"\t\202\255\330\324\316\331\234x\274p\2669\\\023"
+	.string	"\032-\227|\211k\202\367d\271\215;\245\376 :,\021~\025iC\342\353e\314%\022\227_\241\036n\n\230\237O\031\211\017,\325\325B\274\r\366?\322\026:\254\310\3458 \262Ia\330\b\216\241TrGm\214\232\236\365\310#XL\\\221Pp\263z,\336\2747\246\311$\374\206\242\257\007\336\224F\013\336\001\231\206\241N\030\017-\303\346$6r\207uB|\261\224\001\201\205JA\223\n{*`\033\305\210\221\233\004E\242\300\021c\217\n\001i\211\212\t\303wb\241\352\003\252\024\371\017T\317\003Q\306\204m\352P|i\274\355\314R\372\274%\036\004`\350\236\323\222\231\215\365\200\021a\\\022\232\205^\013\277\031\210S\277\321\267\220]"
+	.string	"\211\201 \006\257\351\276E\335\216\f!c\3467\254O\237?G\200a\235\345e\361t\332b\206m\233@\200\271-\017&\266\301\374\252\245\364WA\224\216\266(\027\231\331V&\243\321\2219mU\274\005\022\030\003\fk\360\336\373\312\357\316?\266I,\371\304J\016\327\275\250\205\021-\215\300Y=x\002\036\370\3772L\224k\317\256\300>T\264\316P%\226\356\366u\217\3535\241Nq*\304\2645\3642\360`\355\270\001\351\314E](\251 \202M\202\230\234\210\352\005\016T\226h\311\314i&h\222\354u\354\007\365\350\230\273\312\207\303\254\316+"
+	.ascii	"\253\351\305\263\354*'+\017\260\201\007\340\0166\207\006\204"
+	.ascii	"\311\233\t\023\265\032>fK\034\002"
+	.text
+	.section	.gnu.lto_mspProcessOutCommand.175.5e1c563b0ab476b5,"e",@progbits
+	.ascii	"(\265/\375`\363\225E\334\001JF\327\256U\0208&\345\244\003\257"
+	.ascii	"\030}\346\307\242oN\302\256\207B\035\246n\273\270\033j\350\214"
+	.ascii	"k\016\272\267:\336\243\356\251\346\371K|<\2543;V}\306\315\315"
+	.ascii	"\374\320\201\034\311\221\034\311\221\034m\003\277|R\252%z\266"
+	.ascii	"\203\351\257A\370\311\020\001(\204EYK\310NR\312K\n\303\t\215"
+	.ascii	"\013\235\345\275\215%\355m\267\367\2662\355\355\266\3676[\332"
+	.ascii	"\333k\357m\265\264\267\323\336\333hio\237\275\267\315F\350\355"
+	.ascii	"\262\367\366\225\022z\233\354\275m\345\275=&\354\355*\357m\261"
+	.ascii	"\264\267\251\274\267\303\322\336\236\362\336\006K{[\312{;\212"
+	.ascii	"\260\267\277\336\333P\204\275\375\344\275\355%\354m'\357\355"
+	.ascii	".ao7yo3I{{\311{[I\332\333I\336\333\\ioo\275\267\265\322\336\316"
+	.ascii	"zoc\245\275\215\344\275\235L{\373\352\275}D\330\333V$\364\266"
+	.ascii	"\221\355\355\"$\364v\325{\233H\332\333C\336\333TioO\275\267\245"
+	.ascii	"\204\275\035%\354m!\302\336\206J{\373\351\275\355\224\366v\323"
+	.ascii	"{;H\332\333@\336\333Hao\377xo3\245\275\275\364\336\366!\354\355"
+	.ascii	"\036\357m\245\264\267\217\357\355\244\264\267\221\336\333Gio"
+	.ascii	"\033\275\267\213\322\336&zo\363H{{\307{[G\332\3339\336\3338\322"
+	.ascii	"\336\036zo\013\245\275}\343\275\035\224\366\266\215\367v\rao"
+	.ascii	"\323\020\3666\220\260\267\177\322\336\366yo\317H{\273\347\275"
+	.ascii	"\315\223\366\366\316{[G\330\333\306\367v\216\260\267q\336\333"
+	.ascii	"\305\264\227\233\357\345>a/\363\275\227\307\b{Y\314{9\214\260"
+	.ascii	"\227\231\357\345\275\264\227\365\336\313`\266\227\363\336\313"
+	.ascii	"xi/\177y/{\021\366\362\035\211^\266{/\327\275\227\227\302^\246"
+	.ascii	"#\321\313]F\350e.\357\345-\302^\236#\321\313r$zY\313{9N\330\313"
+	.ascii	"p\357\3457a/gy/c\021\366\262\333{Y\231\366r\333{\231-\355\345"
+	.ascii	"\265\367\262Z\332\313i\357e\264\264\227\317\336\313fi/\227\275"
+	.ascii	"\227\257\244\275L\366^\266\222\366\362\330{\271\312{YL\204^\246"
+	.ascii	"\362^\016K{yJ\b\275\f\026B/Ky/GI{\371\353\275\f%\355\345'\357"
+	.ascii	"e\257\264\227\235\274\227\273\322^n\022B/3\371\240\227\227\274"
+	.ascii	"\227\225\244\275\234\344\275\314\225\366\362V"
+	.string	"M/k\275\227\263\322^\306\252\351e$\357\345d\332\313W5\275|\344\275l\225\366\262\021\023\275\\\344\275\\\225\3662\021\023\275<\344\275L\225\366\362\224\211^\226z/G\245\275,\304D/C\275\227\237\322^v2\321\313M\357\345 i/\0031\321\313\310\367\362\017a/3\231\350\345\245\367\262\217\264\227{\230\350e\245\367\3621\355\345$\023\275\214\364^>J{\331\310D/\027\275\227\211\322^\346a\242\227w\274\227u\244\275\234\303D/\343x/\017\245\275,d\242\227o\274\227\203\322^\266\361^\256\221\3662\215\3672\320{\371\347\275\354\363^\236!\354\345\036\022\275\314\003\200^\336y/\353\274\227\215\302^\316!\321\3138$z\271\370^\031\302^\"\211\336\341{o\204\2756$zc\274\027F\332;\304{[ \354\025\202D/\013\336\033\204\260\367\305\210^ \266w\005 \364\376\340A\257\013\017z}"
+	.string	"\241\267\305{{H{U\360\336\024\244\275<\320\364\356\360^\035\322^\024\320\364\262xo\016i/\016\357=A\332{\003M\257\t\336[\202\264\227\004\357\035A\332+\202\367\206 \355\005A\332\373\001\232^\017\224\350\355\300{9\220\366n \355\325"
+	.string	"Mo\006J\364b\340\275\027H{-\220\366V\200\246\227\002%z'\360^\t\244\275\021H{!@\323\373\200\022\275\016"
+	.string	"@\257\r\357m@\332\313"
+	.string	"\232\336\005\274W\001io\002hz\021\360\336\032\204\2754\220\350\235\341\275+\204\2752\220\350\215\341\275\007\020\366\032\200D/\f\357}!\355u\341\203\336\026<\350e\341\275\005\020\366\022\240\203\336\001\214\350]\341\275*\204\275)H\364\252\360\336\024\204\275(:\350EaD\357\t#zO\274W"
+	.string	"#z\003 \3545\341\275%\274\227\204\264w\204\367\212 \354\r\341\2755i\257\211\367\202 \242\267\204\210^"
+	.ascii	"\274\227\346\275\037l\257\007\"zI\210\350\355\340\275#\336+\334"
+	.ascii	"\336TD\257\b\021\275\034\274w\203\367j\260\275\031\210\350\305"
+	.ascii	"@D\357\005\357\r\276wf{eD\364\002E\364\376\336\213\276\367\334"
+	.ascii	"\336*\242\367\333\333\357\345\037\236\001\342\230di\222\034s"
+	.ascii	"-I\212A\3151E\345Ye\252\235\270\203p#\271\231\270{p'q\027q\353"
+	.ascii	"\340\026\342\036\342\266\301\r\304=\203\233\207\333\310\215\303"
+	.ascii	"\334d"
+	.string	"\346c\306c\356\302\274\205Y\216\031\2169\013\263\0333\033\363\0303\031s\031\363\031\263\0273\024\346%,\302.?m0\203\036#\263\246\273\037 m\313\037\033l\246>\263\"\022\037\335\303f\006if\227\265'\344\270\3012,;\266\202\n\273\032A\037\355\r\324\2246\332 \2373]Ie\326^\t\232h\271J\023\035\217\335\340\016\264\034oW7\266\207\032G\r\306\031\016\020\203BU,&A!\364\265\024\304uC\327X6k\"\333\353\237m\032\033\344\023\b\007!G\240\317\006\371\024{\262\353\331`\363\260\330\240\210\245\310BrbDH@\035\261\0319\\kT]\334`_\337\006\335Np\2613[\022\231\321\021\231\231\350\242\003\203\331\233\243\226\274)lk7\307\265+3\023jD<\360r\211\307\262\275b\261\030\244\333 \237MZRv[\226\271h\035\315mP\256E\226\226Q\016`\234\326\317[->Y"
+	.string	"V\223\252X,\242P.c\331\240\333\025\326\236]\261X\034\002\266\261\025\301Rc\032@>\227\251\260\332npW\300i\013D\322\332U\261X\f\362\271\313Q\226\255\360\0256c\264\r\236\251@H\016\013\310\256X\274qS\326\"\013\213\306\013\262%\343\342P\221}~`%\355\212\305\"\017b\\e\310c.B\320IR\024\322\300\250F\205\003@>C\250\273\202\335 \237V\314\230\350\312\312\025\faf/8\312\312T5\331;f\025\213\305\340.7Y~\302_\033\344\023\212\r\027y\2120~|\241a\307"
+	.string	" \237\334\305N\206\354\305\202\020r\222\024q\202=DvY{\305\342\r\024|n\002\250\314\004`w\270\314d\203\273\273DF\b8I\212A(S\230\\\326^\261\230\004\005\237\253\242\366.o1\327\220\223\264\2009(\026\1770Q"
+	.string	"\371\334$<\002\345\023\310)\312\347\2769\313f_,\036\317\250\024\213IT\330\022\200|\022\240\205\341\312\360`\007\347n\205\244\230\236\256\275b1\211\212\007\341\200\003\022B\241\220\005\023&L\030`\237\210PbFVk\335\261\013/b\203\021D\210(\341\177\n\347y\252\330\001"
+	.string	"\201@\032\241P\370\302n\3005\t/\bB\031\274Y\026\313\272\255r\333\226m\327Vm\323\026m\317\326l\313\366\312\222\255\225\225\333\261\255\262bKe\303v\312\202\255\224\215\262_\013e\237\254\327:\331\256m\262Lv\311*\331$4\314\260B\206\030\016`"
+	.string	"\030^p\241\005\026\n@\200\001\254\240\"\205\n)\240@\341\204\023\002\b\200\t%\2200\202\b!\324\230"
+	.string	"\241\004"
+	.ascii	"h>\360\200D\007#\204\351\316\211\340`\267l\240A\006\030\\\020"
+	.ascii	"\234\221\001\376\320\263~\337\026n\343V\313"
+	.string	"r\331.K\267\313\255[\273\226\261\314\204\353U2\316\250\345K\b\2077\013\226%\246(\274nG\300(\237\360\266\225X2\366\023W/[\375\242\324\343\265\246\305\253VC\320\312\352M\313\240\b\f\032\005t\304\235%\233\246z\315\256x\313\232\230\002B@r,1]\361^\221\002\"\244\227,\212\327\312\006LQ\274r\365\202\270*\243\022KF\263Z\200\")q\375\343\251w\f\212\267\312\017\216"
+	.string	"\237U\216%&(^\2612\036*\021\320\002\023\346\203k\032X\217\327\224!V`JN\244\304E\t&\001\371:\373\352\t\203\322G\032\275O\2600\021\361z9\021~\351\261\345Xb\n\342\355\352`\311h\243\217\\\221\226\2145z\233\350\3610\311s\262K\214\270\356X2\316\350URs`a\362\341M\362e\007\r\035\360\231\201l\305\006\234z\274dP\212\213Ai\307\001j\317"
+	.string	"\303Y\241G\244\331;\366\332"
+	.string	"L\206!h\331/\324\261\013A\\\305\270\206,\r\325q\013\365;{H2\204\351yk\037.\315B\027."
+	.string	"\004p\200!@\217\\\017`\216W\2503d`a-<\021\031\322:l\255\242\215S4\257\250P7X\253+\244u\nj\214\"\207+\327\332\220\245!5FA\f\317\tL '\364\004\360\313s\022\200\273>\023\272\030\245K\220\302$\224X2~\365m\365\b_,\002\024\016\341\207\326\362ni\b\n\327T\024\354\304\3000\221\033O\352\210 \251\037\356c\021\260\334\340j\023\365nfK2\034\203\260q^V\203\240\305%l8\263\002@\375\331\270\021\307Xn`U\030\356\352\214\230.\3314H\370\003\246\341E6\305\203\372\333\t\222\202!\214]\025\346\"\325$\246\270\003.\\\265\216\206,\rM\361\210\2578\250\026\n\341T\b\357\334Y]\341\315\251E"
+	.string	"\031zb\0168\347\211wK\335\240X,\226X2\242\325\025D rC\2517"
+	.string	"2\324\304\032\374j` \036\326\336\335\322P\023g \302\322\320\2211H\272"
+	.string	"\351\330\301\2436\026\201\310\215c\317\360\027sP\002\026XOX\216%\246/\226\331A\003\332c.\r\0251\020\313\r\242\032B\261Xd\"7\212\372\327\243\306\"\020\271Q\324\350\016>g\204vp\255(\034\325rd \264SG\2701ua4n !\235~\027\336\267f\362\302\021\361\306\221\340\303\253\345\213\227\213\024\336.m\274ts\274K$\274u\255\305k\267%7\206\016KL\230c\022R\033\333\032\332\0240\265\264+\243\031!#\022\247&%\243\243\260f\021\320\331\226\260)`?}|fRx\351F\024\312[J\270\204KF((\372WC\261X\334\376\021\032\342]\001\357\006{\227y\330\375\271\t'\300\n\003 \3620\033f\202\034\330\231\304,)\344\364\276G\f\023#\216\215\241|\256p\216\343s\307\261\213Y%\247\233)\017\034\2409?\267\244"
+	.string	"\005W88\021pGs\232*R\\\205\nO\261\201\256p\337%\226\021\317\232\177T8\277\261\320,\214\220R\3478\034\034\271\234\202\377X\0314\rP\235\237[2@\301\365\355@\273\273*p};\3671\331\242\323aX\005\225)*\033\244\300\365\355\250\316S\2466\257\025:\005\024O\001\205\243x\203a\240O\370.q\215\330\206\362\017\n\017A\3478{\342\001\370\tg\0364c7W"
+	.string	"?q\346\261\313r\001\274\256\355\na\365\273\rs\001\206]\242\333\355\210YR\310\325\005\340\214\205O\263$\276d\225\234n~\223\030\231\0045&5\r\216\334\237\226\023\f\030\310\005\3156\350O\213'X\331\006\375a\305\315"
+	.string	"\331\006\255Y\016\264\031\034\311[J\2700\370\2177\353\220\315\227\303w\001\360\274[6\3170;a\202G\026\231\330DM8/-\021\356q\304f\211]\242\226\303\021\347:h*\026\213.\360\271\317\3627\"\027\"\035\261\216X\207\362i\302\271\215\253]\322\222\271U\307\374\3053^I;\246\035N\363\315\034\271!"
+	.ascii	"\002D\213\036\002\236\237\006j,\323\343\314\215+\bE\301\350\322"
+	.ascii	"\201vUP\213\305%\032\370\214\331nI7\327\206F\217\304/\304<9="
+	.ascii	"\036\013\350]\"\223(\246\371\007=\036}\242\247Ci\034\301K\206"
+	.ascii	"\266\340\206r\007]:\247=M\306T\006r?;\232\n\226\205\360\271*"
+	.ascii	"\310\361Yy\351P>\367\224<\\w\033\216P\355\331\355\034g\271\271"
+	.ascii	"t\256\2239\362`\230f\300\377X&\002a\007\027\0236\235\016\363"
+	.ascii	";\222\325\270\211v\024\231\312\222eM\247\303,\220\227\f-\341"
+	.ascii	"h\321\033\214\007\211\261\233\253\003/\031\212\362\274\204\223"
+	.ascii	"0\246\205\361\034\215\335D\217\3345S\356\034\347G\367\205\352"
+	.ascii	"\\\321$\214p\022\336`D\276\021^\251\200![\321*p?\0013\246\334"
+	.ascii	"9N\345!jR\221\370\034\372\211C\307\304dN\247\303\354\n\315b\373"
+	.ascii	"\306K\206\212p\026\3736\017\236\261\233\033\302E\330C\371\027"
+	.ascii	"\261\271,de\340\31006\377\360\271,\303\210\362\031\302\211Ia"
+	.ascii	"L\242\234n\356\212\256\351\221\341c\3425\007\350]\0315d\0045"
+	.ascii	"\377\230\370\355\300h)\215\307\331\027\372\\\\\002\016\031:\220"
+	.ascii	"(y@x\b;\307\331\022\007\341\f\200\223x\t\232\003\340*t\235\037"
+	.ascii	"\234\346*\370<\370\007\354\301\203F:\270\210\223\030\361\016"
+	.ascii	"~\202\256\362\222\241\302\217x\nk\351\205\033\244\237Q\342\340"
+	.ascii	"\030\\\304\006\347\340 \220\251\300\032|\203\237\350\312\340"
+	.ascii	"\032\204\220\301\177\311\013\016<\006\301_\360\017\370\232\227"
+	.ascii	"\f\235y\360%\350d>\003\2249:\326C\3478\373\373\017<\367\3440"
+	.ascii	"vs\321\377\216\256\245\300\347\321\177@\3063\306\330\315\255"
+	.ascii	"?k=\247\365\370\317=}9\335\\\026\272YF\021\272+\343HFR\363O\377"
+	.ascii	"{`\222J\035\024,D\021\345\316qv\205\376\035\177\352\370\256\f"
+	.ascii	"\0372\230\232\177\226\321\270b\365\3309\316\276\331\344%C\371"
+	.ascii	"\277\343\267{\210\214\335\\\025\272YF\020tW\206\223\f\250\346"
+	.ascii	"\037\376\367\300$\235\320\234\306h2\246^h*\026\213\374\263+c"
+	.ascii	"\210\214\252\346\037\224\347\214\306B*`\212\224:\307\331\356"
+	.ascii	"\302\374\3056\f)\356\331\3414\337n\022\343\251r\340b\261\004"
+	.ascii	"\005e:\344\251\240\367z\320i\321\343\303\017\263\213#w\367Ax"
+	.ascii	"k\300i\276e\016\342\001\341\375p$\324^\210\336\317\350I\323\336"
+	.ascii	"i\227\f\246\310\021\211\357\216\334\003\331e[\301c\273/\355\231"
+	.ascii	"x\t\244\314\272\272\322\276\007c\355\374\210\250d]=i\227 4!\332"
+	.ascii	"\3016\250\321\376h\227'\372\210vx\354\211v\331^E\216Hl\314\261"
+	.ascii	"\327\261K\025\234\230\365\t\355\207v\231B\223\210\317\306>h\227"
+	.ascii	"\255EyD\032\003\264\247\261K\023W\366>c\357\263\313\023^y\337"
+	.ascii	"\331\363\354\262\246i\367\234\275\261\016\215\252\330\243\271"
+	.ascii	"/\322q\025\215\331\346\353\302\005\304\334\016\263K\023}fs\375"
+	.ascii	"\003f[o\227&\362\210\344\276l\343i\321z\242*\366\260\333\276"
+	.ascii	"\213\303\n\243\242\333^\356\022\204&fpfI\262\256\266ls\331%\f"
+	.ascii	"efJ-\333rlkI\252\267m\270]\2520\206H\315m\033\313.{\251Dc\333"
+	.ascii	"n\243r&\205\252\330#m[-l\212\322l\373l\227(\300\314\300\310\266"
+	.ascii	"\257\354\262\325\232\242T\331\036[';\247\224$YWa\333Tv\331kW"
+	.ascii	"G\244M\"e\033l\2275qD+\240l\177\305\300="
+	.string	"\212bITN\266\275v\t<"
+	.string	"\333\240|>\214]\326U\261\007\223\355&\273\3545\271#\222\013I\266\225\354\262\235\274\035\221X\320\332\336\332e\2575\021"
+	.ascii	"\3116\326.QPK\341\310\366\325.\233L\310\021\t\205\"\333FvY\323"
+	.ascii	"F\024\200!\333Dvy\302\212\331\bR\333S\273d<\345\021\251X\304"
+	.ascii	"\341\343\f\333\240;\334]\366O\261X,\026O\340s\267\205\354\356"
+	.ascii	"\022X,\342\360qwww\270\273\344\235\037\322\223\254\253b\217\342"
+	.ascii	"\t|\236C?\361\245/\350X\\\353\276\335$F~\263\331W\326G\356\362"
+	.ascii	"\233\315\276\262\375\217]\336\302\373\273c9\336_]\317\340\375"
+	.ascii	"-\033\210\3677\327:x\177R:\211\367\327\325E\274?\252\022z\177"
+	.ascii	"=\336\373;\276\367g\324L\274(_#yQ1\035\204\027e\276\027]\342"
+	.ascii	"1^\364\310d\274h\021\227\361\242<\354\306\213\352p\026^4\207"
+	.ascii	"\341x\317&\363\361\236c\270\311{\3525\016\357\271l#\357\251l"
+	.ascii	"\036\336S\215\273\360\236h\335\203\367\314z\357i\365\336\263"
+	.ascii	"H\333\340=\211\264\020\357)\325C\274\247\020\022z\317'\306\343"
+	.ascii	"=\201\230\320{\0369\t\363\251\203\263\230\317!\021zO!\206\302"
+	.ascii	"[\365:\bo\005\323H\336\232\327L\274\025\257\223x\353\227.\342"
+	.ascii	"\255^Z\007o\275k\033\274\325\256g\360\326\272\346\341\255\313"
+	.ascii	"6\362V\272\306\341\255]\270\311[\2710\037o\335\302x\274u\216"
+	.ascii	"\273\360V9\336\302[\2650\034o\215\343,\274\025\216\335x\353\033"
+	.ascii	"\263\361\326,\274\204\267b\331\336\352\366\336\252\024\366\326"
+	.ascii	"\266\367V\266\264\267\256\275\267\252\245\2755\355\275\025-\355"
+	.ascii	"\255g\357\255fio-{o\275\222\366V\262\367V+\302\336:\266\275\265"
+	.ascii	"\312{\253\330\366V*\357\255a&\364\326)\357\255`io\225\362\336"
+	.ascii	"\032%\355\255_\357\255P\322\336\372\344\275\325+\355\255N\336"
+	.ascii	"[\273\322\336\332$\355\255Lhz\353\222\367V%ioM\362\336\312\225"
+	.ascii	"\366\326\255\264\267j\321\364\326\254\367V\254\264\267\"yoM\246"
+	.ascii	"\275\365\212\246\267\036yo\265J{\253\221\367\326\"io\255\242"
+	.ascii	"\351\255D\336[\207\244\275\225\352\275u*\355\255R\357\255Qio"
+	.ascii	"\025\362\336\n\225\366\326\247\367V\247\264\2676\275\267\006"
+	.ascii	"I{+\220\264\267\"iz\353\217\367V\246\264\267.\275\267\372H{k"
+	.ascii	"\217\367V%ao=\276\267&\245\275\025\211\246\267\036\225\350\255"
+	.ascii	"F\357\255Eio%\242\351\255<J\364\326\035\357\255:\322\336\232"
+	.ascii	"\203\246\267\342(\321[\207\336[\205\322\336z\203\246\267\006"
+	.ascii	"\225\350\2556\336[k\244\275\225F\332[\201hz\353\317{\253O\332"
+	.ascii	"[g\244\275\265\207\246\267\362\274\267\356\244\275U\207\246\267"
+	.ascii	"\032K\364\326\234\367V\234\264\267\026iz\337,\321\373\276\367"
+	.ascii	"\236/\355\375\230\264\367bhz\037\246D\357\231\357\375^\332{\275"
+	.ascii	"\264\367`hz\237W\242\367x\357\375\227\264\367^hz\177W\242\367"
+	.ascii	"v\357}]\332\373%M\357\351J\364\276\313{\317%\355\375\026\232"
+	.ascii	"\336\317\225\350\275\334{\257%\355}\\\332{8\232\336\277\225\350"
+	.ascii	"}\226\367\036K\332{\267\264\367J\232\336\267\225\350=\333{\277"
+	.ascii	"\226\366^-\355}\032M\357\321J\364\376\354\2757K{_V\323\373+\357"
+	.ascii	"=Y\332{+i\357\307hz_\345\275\027K{O\245\246\367a\357\375\024"
+	.ascii	"a\357\301jz/\345\275\217\"\354\375WM\357\241\274\367O\204\275"
+	.ascii	"\367\252\351\275\223\367\276+\355}\223\232\3363y\357\227\244"
+	.ascii	"\275WR\323\373$\357=W\332\373\255\232\336k\275\367Yi\357\261"
+	.ascii	"jz\217\344\275O\n{\177U\323\373#\357\275\225\260\367Fjz_\344"
+	.ascii	"\275\257J{O\244\246\367C\336{*a\357\247jz/\365\336G\t{/\244\246"
+	.ascii	"\367P\357\375S\332{\247\232\3367\275\367A\322\336\003\251\351"
+	.ascii	"=\362\275\377\221\366\236)\355\375\022M\357}\224\350}\217\367"
+	.ascii	"^)\355\375\261\246\367I\357=\222\260\367G5\2757z\357\213\322"
+	.ascii	"\336\023\275\367<\322\336\357x\357u\b{\237\343\275\307!\354\375"
+	.ascii	"\320{/\224\366\376\306{\037\224\366\336FM\357k\274\3674\204\275"
+	.ascii	"\007z\357\177\204\275\367y\357g\b{\337S\323{\236\367~G\330{\235"
+	.ascii	"\232\336\033\337\373\034a\357q\336\373\242\260\267\233\357\355"
+	.ascii	">ao\363\325\364\366\230\367\266\030ao\207\251\351m\346{{"
+	.string	"/\355m=ao\203yo\347\245\275\215\367\336\376\"\354m/$z\373\356\275m'\354\355\272\367\3662\355m\272\367v\227\264\267\271\274\267\267\244\275=\367\336\226K{[\313{;N\330\333p\357\3557aoN\335\364v\262q\3725\207|\032\f\251\341!\355\na\364\353\263\201\252#\356\362|\326~c~|6QS6C\252\232\336F|z\201\232R\303\221\273A\200\274\203\030\3711\367\200HA\376x#\217\374\362n\216\360~\234\255\240\274\230LKo\246\344\357n\310g\327K\347\"P^\355\243\307\333\007\326\217\356\346\250K\217\263\025\224\023\246\322\361\255\244\365\233\223\353\343\271\b\224\223Nj\244w\022\327\017.\313\357\315F\t\023\233\256.\224\317F*\002\325e\205\206#wg\332\224{v;\30792z\037y\375\332\330\214\230ED\357\"(\27744\242\274$\217\035o\036Q~eWv0u\344x\353"
+	.ascii	"\373\215U\311\201\227\3041\364\306q\006\013\373\205M\031:\023"
+	.ascii	"=\325"
+	.string	"1\205n\274\205\304~Q\276n,\203l\274\203\306~^Nl\234\211\236\226E\224;\347\016\206\"\242\3349\016\024\225r\247k4\215w\215\237\034\320\233\306\231\347h$6\321\376y\003\265\317\373\347\036\320\221\375\266\264|\316FOp\311\0313\312~H\222=L\236\336y\363\234\375\254\206|Fz\347L\364\364\326:m|\353\244\375\210\fic[\3474\316;g\355'\025\3258m]|\363]l\373=\r\371\234\232g\242'6f\037\337\271\317\355\007\004\311\307\226\034#\346<&\313o\311\207\030f\030\3469\f\334\357xs\224\304<\033=\255%\367\364\316{Z~FD\277\"\2339.6ttzDOj\314\344\fG\356\202\311;\203\251\373\351\260\271\313\221w>>]\301\373r\306\263\371\362\023\032\362\375\202~7l\362l\364l\2306L\224O\376r|\272\222l\253\025G\356z\271;{\261;\337\211\371\321"
+	.string	"\372\361\261;j\365\024\266\244;/\273\234\351\3166|?\036b\020\006\263i\376vnp\330\211\361\247s\263\303B\323\376r~\306\233\036\237\033  \224O\356r\"V\366\216Z?d8rw\313\334y\313Y\356<w\0061k9\313\325@\233\304 |h\337M\220\320\r\016\034Z\2124\3651\213xk\210\341\310\3358\270s\234\0164\f\023nL\362-\313\371\215\007\n&/\313\231\252I\217\271\205\305\355\214\345\246\b\365rs\204\332\241w7I7J7>n|\2705\351%\267v\360\326p"
+	.ascii	"\030~R~>\261@\301\365\316\304\335{G\333\2115\3013\300\335\177"
+	.ascii	"R\336;\030\003]5\312x\216Fe\333Y\311\204r\371\261e\256\215\311"
+	.ascii	"\266vfC\242qC>\031,^=\340\336\326\316HMx\311\255\034\265\264"
+	.ascii	"\263\232\233rL\033[\032\023\355\354\214\2266\344K!\027\004E\273"
+	.ascii	"a\"\203\305\311\336\231\331\331\031IS]\322\254\354l\346\204\222"
+	.ascii	"\341Y\031+;#5-\257\220\235\257@\241T\206|2X\234\330\025\355\n"
+	.string	"\201\204\206\335D\235\304\035\034\224$0t\312\315\324\220\233*#do\036|\"5-\373m-Y\204\301\205\223\310\317\247\026Pp\265C\213p\265;\277`\367\223\310;\2101\320\005\324\3449\032\255\214\235\255|-\215\235\217Mq\314*\247\320\271\312\033\007s\320d\031Z(S\371)t\004ur\223\224\031rB\325\325\204J\\\330\224s\230\022\026"
+	.ascii	"\271\201\002\234r\036j\202c\202I\235\223\260\320\255\2331\rr"
+	.ascii	"\2344ie\201\235\355\232\340\222RN!I'?t\354\nqD\257\216Hy\343"
+	.ascii	"xc\272\200\026\021s\037L%N\363\265P\200\337\362"
+	.string	"\347S\016(\270\326\035h\311\320Z\367\366\3410CnAX\250\373o\371\366a\ft\375\224\361\034\215Q\276\316Q\264\320!T\312)\251\2573U\223\032\224'g(\\(\324\220/\205\246\275Q\202>\3350\221\031\352:\235\232\236\234\251\232\312\230[9^N\316^](r\310'3\324u\365\203\311\311y\250\251\254\253\311\271\353Lw\343\205\366@\225~\020r\003\005\210\003\312'79\0175]an\24153\371\356\r\330MX\363\317o\356,\324\343F\fE\272\031\303`\251\213\252m\354\n\321\003=\272!\253#\356\364\274\270\240E\250\321M\331\336\234\335\244\255\241|2\2237\r>\2554]I.\217dU\005H\201\241,i)w\2368-a\021\340\310\r\242\255p\252\375\367\344\303\336\264\335\270\3254\025\213<\374S\227\007\"&Q^r\005\2409\204X\"&\201\313,P>y\311\273\207Gt\001\031\r`"
+	.string	"\\\227?\325N\002\351\343\305SDI\222\263\222%\347$\357\036\256@\227OXO\337\nGnpK\212S\371\363\251\005\n\256tK\270\322\275u\274\254\326\252T\320\375T\236D\327\f/\236\243\221k\353\314\225\005\265Q\203\206\316\326\217\0263\013\353\234\005\207\366\240<\350\316\317M\235\n9,\324\210\344\274\325\324\225\374\3259y\246\323\202\026m^\220[!~\234\315\2339\027\232\366\206\313\331wC\3077\274qS\247\002\001W\177an+\314)\006\001\313B\366\346\356\346\313\315\027\224O>\362\326\341s\253\251\t\223(\206%b\\)\216\334\2652r\266\312;\365v\030\311+\302WE\344\\\245wzA\032\372"
+	.string	"\211\\f\313n\b_\222j\352LE\327ei\352+\346\266H\351E\t9G\251pj\211k\022\362\006\245\227|r:?\271)\245\234>\203\023[\023\223('\b\220s\2203\330\261\3164\264\"C\237\026\344\200|\305\\\0253$\230\344\017\246\363\017\346IFl\"a\032[:\233)\3451}\3648\373\020sRI\322c\212R^\362\230t>\362\235Q\234$AA:_Q\302c\022\345\034\031\235\217\316`7\315\323\211\r\360\254\032J\031\372"
+	.string	"\215.\263\325\244\350\212\022^\222H\205#W\346\t\305\271\374\371\204\002\n\256]\272\234\275\244\320\345\347\362\"\230\360\325\361\034\215D<\316Dg: \247\022\033\032\232p\316$U\206>/\3608\rN[;\3369|\262)\325%\211P\034\271\253#\307Y\007\226\315\n9\343\211\304\214s|\305\334\025\216\363\025\245e\222(\247\233CB\347\2413X\n\247\021\233\031\232v\270s\026\031\366"
+	.string	"\253\206lC\237\026\344\024\200\362\311B\237\301\251\312Iu\016Q\300\262\220\035\002\rk\324@\371\344\033\347+Jt\307\341\023M#(\034\271\033d\343\034\024tF\r\371\240N!C!\034C\035:P>\331\306\331HI\013\023\005\313@R\356\324\240q\256q\006\353\351\313\341q\006\031\362!O \303\242\243aR\022\r*\245\270(\2745\234\3603\002\372\317H\351\\\362\001\304\264\372\371i\345\343<&\375\234\255\224\336\316\"_\\\253\2060\373\374,2d:\215\206\310\223\350,\032\006q\032BA\241|\262\317\371\213O+\2456f\025o\r'l\350e\031E\350\223\276<\345N\027\237\350[\023\300\214\236\363\f\236s\317\331ij8\204G\314\206\346\035\235\363\016\003\351\335\241\221\341\221\346\037\326\371\315\372\216t\037\237\350\253\n"
+	.ascii	"\0339\347ld\234s\316\f\177\200r\361\214s\006\343AbL\2366\206"
+	.ascii	"b)j\f\225\004\200\006\027\317WJ^I\031\304\313\030\236\210u\372"
+	.ascii	"\314\350\0312\267rnl~\023\3436Z\247\316PL\205!\327i\034*1\341"
+	.ascii	"\3049s\206L\272\206^^(\2371\316E\224\234$\305\364\361P\3424\237"
+	.ascii	"\tG\256\006_$\234z?\237z@\301\225\013\227\3038/\2078\2143\224"
+	.ascii	"\332\264\001\362\325\276a\024\260aX\030\312\347\020\357\"\263"
+	.ascii	"\224\323VN7K\340\362S\3575\306:\275\026\b\361\026\260\340B\234"
+	.ascii	"\233*s(\246W\367\206cC\262a\331\260\f\345\223\005\357\"\237F"
+	.ascii	"\307&\363$\034\2712[D8\307\374\f\243\202\005\342>\236Y\032\201"
+	.ascii	"\371\004Z\267\374\034\363\224\311\262M\204\025:\210\277x\020"
+	.ascii	"\214\243\201\370\3560m\270\326\374\363\342\251\326m\030\260\322"
+	.ascii	"\325\345\260m\3506\3142\314\202\362\t\304\211\3071\314*4l\351"
+	.ascii	"\221\n\341D\020\026\322\261\370%1i\312\235\343\324\\\365\\\325"
+	.ascii	"\034\2712\320\025\234\261\f\341\352\234\214\024rU\216x\034jQ"
+	.ascii	"\241\211\001(\237+x\212\271\255\234n\256\213\267\370\017g\236"
+	.ascii	"\"\306n\356\t\3364\324\207\2738\363\020\331r\037~\222\001\365"
+	.ascii	"\356\220\313\220\256\371\247\305\271\217S\245\2303\245\3618m"
+	.ascii	"\"L\211\023\310\317\247\037Pp\235\2534\270\316\235\363\370\213"
+	.ascii	"\213i\006\302\334O O\263t\321\3439\032{P\301{\250\253X\360\370"
+	.ascii	"\334\224*X2S\300\303S\260\303y\270\253kvc\324\322vX"
+	.string	"\352\200\202\353\300\342(\370R\315\272\210)\273\302\202.\007\034\236C^\035\223\013SE\f\207\263\225#]r\353\0047\374\004&\370\rg\275:\205\250\204\201\0170oL0)&`\226\200\004/\001\263BQ\356=\361\"\301\331\312\261Kr+g\004\"\370\b\316tC1\265\311\220\017\003\037`\364v\205\020R\231\f\233'\341\326TR\227\020q\214\304\235\036\224O\021\234\363\370\264r\324\022\205\356\255D\b@\360\020|\340 \360\300?\340S\267\250x\240\003:8\260\201s\240Z\261\006\276\201\f\\\003@\025\tZ\0060\200\343\002\026\370\005@@+p\013\374d\024x\005jT#o\0248\r\023xU\212\021\222@\004.\2013\030\027\331\006\205\300#p\017\326\036p\b\004U*\242\022\260X\324qa\353\024qI\024\002\026\213E\033P>\037p\027\346\204\350]\242\016\"\217\346\037\007\234\2778\245\022\246\2514\036\007"
+	.string	"G\256\214\321\007'\332\317'\027(\270\312\035\250\nW\2713\035\313,\227\313\016#4\032\271\237h\027\301\264E\217\347h\264!\206%\026\325'\027A\261<;<\247&\033\316H\216l\311\0060\340\rX\300\031pT\221]\276\374`Z"
+	.string	"s+G\001\t\270\002\020\360\004$\325\036D\245\240\222<9/JG\004\234\257\216k\311\032hx\r3\234\006\037\365\350\355\316\250h\006\346\n\031\276\"\206\313\300Tw(\355t\344\210\341\214\344\250\226\334\3129\200\001~\2003\035\f7"
+	.ascii	"\021Y\205\210A\202byY\307\254\272]!\244\352\r\242S\327,]\361"
+	.ascii	"\232\312*\026\2130\330\250AD\250(\342\324\020\224O\030\316t|"
+	.ascii	"\"9\2261\267\332\226l\304}\360Bo\020\245"
+	.ascii	"\002\021\217\230h*\026s\370g\253O\375!V\031!\0369\302O\302\224"
+	.string	"\265\027\346/\346\2460dJ\017\216\334 \222\016~w?\267\214@\301U\313\257\356U\313\271\217\211\232N\207\341.JD|Hh\371\357\356\035d\231k\3439\032_p\341/\264p\027\316Tu\207\230tA\256X\324\201a\227\210Uu\210LT\310\025\213:.\360\2715\247\032\211Z^(\237-\234\271\360\211v\234\262J( ::`\341\277\2727\237\tzk\221\250\244\371gWx\223\310\244\213\350\265D(\304(\315?,\234\347X\370$\214\021e\024o\r#\216\\\031\264\364l\376\334\302\003\n\256qq\302\270\237\315\247Lre\005 \300\0130\200\273C\n\026=\360\200\002\027@\374P\002 X\004\361\203\213\035\202\340\301\007 \\\234\330\035R\f\001\204\212!\200Hw\207\024/\202\360\201E\213 ^\260 \0059\334P\263;\244x\301\"\007\027-J\200\003\020*p\370`wH\361\302\205\020@\260x\241\002"
+	.string	"\273C\212\027;\004qC\013\025>\270h\321\302\005\0164?p\020>\260h\341\203\016<\364\200"
+	.string	"\027@\300\320\001\203!\\$ \007\026*\360\201\207\036d\206pq\202\343\300>\260\220"
+	.string	"\213\0267\370\360\343\201Y\364p\003\016/\316\034\\L \210\035t\340\241\007\024h\360\"\b\036\022\240\303\r=\240"
+	.string	"\030\204\017,p\241"
+	.string	"\026A\3008\201\314\013\035n\350\241\001,z8\301\r/xX\200\016>\360\320\002\210\033D\004\301\"\003/\036\300\242\005\017\032`\021\304\r\013\300!\b 6\b\"\207\316\301\207\033Z\264p\241\200\034X\004\001\204\213\037~`\301\013\037X \"\210\0279\334\002\031\230@\016-p@\027\207\024?\274h\241\342\207\027-T\370\300\303\r-T\340"
+	.string	"\304\013\025)F\254\213\037X"
+	.string	"\241\"\b\027.\200P\221$\207\377c\231\t\003\337\222|=a'\250[\230\277X\306\356\313WO\330\r\3142\320\212\245\272\335"
+	.string	"=rn\334\212\345\325\355\314\204QH\306\031\265x\031\345\324b\261X\304\341B\313\"G-\273%\335\304\003\302\243q\002\366j(-8\2248\315w\003\013\332\311\004G\356*\333^\225s\375Dl\266\235\215\222kL\266\265W6.kkI\265\264W5\2724&\332\331+Z\335\231Z\322\254\354\325\354\256\214y\205\354\365\312\227~\262!;\023%\313\222[\325J\035{\265\362\036\"\257\237\352\330\331(y\245\004GV9/5T?Uy?\261\b(qg\177\342\023\342\306\2248\315G\202#\267\306F\225\r\021\234\216\205S\206L\t\301\262\rZ\365\016$\246\367*v4HQ\335\b\216\024\301\177T*\007\342M\232\243\360\223!\230\300!\304\f\301\327\374S\251\234\347\342\224\224:5\354\370\032v\376b\031#h\235\362\363x\001\215\013j\f\001\003\007\206\321\210\362Y\247\234"
+	.string	"\311.&\321\221{\312\220\036L\273\020\034\271\013V\245\274\202\301\330\271\300g\310w\301\214*\345L\344\n\216\031\345\3535J\317\005;\027\030/\320\201\341\003\004\243F\r\224\317\372u\266\272jKB\251O^\241\300\b\272\240\230\023l>\331\272Rcn\315\361\326"
+	.string	"\002\257\352\344\325\353\f\006C(8F\214\223\363\361\352JW\223\327.&\257M\226\2742\301\021\334\373\021\266+\304\230\240\036\230%g5\247$\257J^\341\222\374\247\004\313X\345\252[\257\\U\353u\253f\275j\235u\004\275\020\225\230\204\261\253\307\224\335\026\314\b\336\331e\235\325\234\220\274b\275\302!\371O\t\026\261\344\325k\362\310\353\025\217`\2271`\273-\030\nr\331r\304\310\253\225\221\243L,\\J\343q\212T\275\026!\362Z\365\223\025\005\343\210J<\342K\023)\273-@\n\302\3018\372m\231\212\3423\025|\203\221\244\004\303\007\221s\331\334\026\325\353\220\3275\252\243L,SR\257Sg0\030LU\352\027\303\202\2454\036'J\310k\0242\310\266&\344\234u\005\006\365\364\n\025$\210v\366$\305\251\351\325\311)x\205\254)\353J\312\007:\2002\177>q"
+	.string	"\005W0`<"
+	.string	"\346(\363\"\202\314(\013\002\3445\b\362\025\310\217W\344P\260\n\2141\266\002\025\024\243\362\343\335\304\r\240r\325\325\201#w\231\226^\231\242\202`R\226|\364x\365q\006\233\nB\261yR{\234\263\256\232$\267\252\322\361U\351\f6$\330El\006\233\324\343yk\252\231\204\364\232t\364\212T\025T\362ud\304,\"z-\342\361Jd$\250U\205\307\016=\0359^u\340x\315q$\230D\3031\364\352\306\225\2474\036G\350\306\253P\320\353\215d\320\b\226 \033B7\256/\034\320"
+	.string	"*\346\347\323\016(\270\346\345m \357\250\030\275\0324^k"
+	.string	"\275\322\370y\005\312\021\034\002c\214\311\232\260\202TS?o \334"
+	.string	"+SzL\r\034\271\274\303\177\254\214\021\006P\276\237O\027@\301\025\357\\\\\361\316K&[bh\202\265$\003xG\371.\002\331\327V}\352\214W\2373]\355y\235\361\347\361\034y^{\316;\202B`\214q\230\034\f\255 \024\f\256\031f\366\202O\225\347\375\203\033\2605\005f\n\006\352N\325y\335\251\306W\035%\301 -\bS\2155G\254\342\324\342+N\363\265\370\2231\t2\3454\373\270\370\306\374|b\3761a~1\347\256\240\022\2150\314W7\256=\275\177\017\314\257\227\367\2039{\005\217v\344\341a}\361\362\177\271\373\275@\t\3628\336\331%\353\226\177\035\335\277\374\311`D\t\342"
+	.ascii	"B\327\345\325\215\353\210\322x\034.[~.\237\373\267\374d0\300"
+	.ascii	"\202ARsrF\264\304\375Z\340\376\270\267\037\316'\bt\365\226\245"
+	.ascii	"\n\213\333\217E\371\273\265\375J\240`\317\2226\266W7\256!J\343"
+	.ascii	"q\326\324\376\265\264_\r\355O\013\032\207\220\202v\366\352\306"
+	.ascii	"\245\2444\232\225\375fa3\315*e\227\341\273r\266\232\212#\263"
+	.ascii	"\362\223\r\341\217\375V\356\001\\\225\177\354,6\023\006\306\030"
+	.ascii	"pfo\206\t\203\fF\031\2143\030g(\237\257r\316\232\202\343\032"
+	.ascii	"\032\023\206M\rM\271s\034\263\255+bT~\261\264\031:\345M\035\220"
+	.ascii	"\312e\270\204\235\255\246\300\230S\300\376)r\304\346\212\031"
+	.ascii	"-qq`_\361&\205\031\345\353\217\342Fl\316\320\244\302\214\262"
+	.ascii	"\255\313\327gpZ\203r\276\232\222\222|\342\365?Y\233A#6W\2440"
+	.ascii	"sv3\307\202\334\214\331\020^n\352R4y}\305\334\025'\347\253)\257"
+	.ascii	"\256&\177W\333\314\330^\0231&g\253\251\256-0K\224\374K\334f\244"
+	.ascii	"\f\321\247\344+I\036\327\326\317\225e\306Kg\253K+/\271\225\205"
+	.ascii	"\365g\301\315(\371\301\342BB\207\225\274\372\223Zf\260n\\%\217"
+	.ascii	"t\2612\362[\315\315X\3550R\244\310\371J\252K\222\b\353Xu\"\177"
+	.ascii	"\025\227\031*\033$\"RC\316VRZ\222TS?\025\335\f\324\322\224\223"
+	.ascii	"T\224\220?\252n\006\b\261\331$\344\307\241\316WRq;r\f)w\216\203"
+	.ascii	"uC\271s\234'\247\377\351n&I\312\351\250)\b\220?\310\227\031\""
+	.ascii	"\233\"@v \317VRmI\2420{`\224;P\220\344u\034\237\200\344\213\362"
+	.ascii	"\002G\356\376`\372\177|\351g\272\217\177\251\306L\020\214-\242"
+	.ascii	"\220\217\367xuC\322\2464\242\231]Q\356\034\007\211\025\345\316"
+	.ascii	"q\224\216\277"
+	.string	"\022\214\274\231\236&\307\231\235\244\263\225\024\030\223\b\351\350G\322\233\311!6\277\216f\212F\347+))ED\177\021S\206o\f\221\224$\217\035?\017\030bd\230C\276\275\035g$)/\346\226\216\034\277\016\030|2yx9\316G)\257$\216\241\037\307\235\335\207\316G)'H\210.\364\033\277\020\214\246L\027.\277qF\222\352z\320m\374A82r6o6\342j\234\255\244\272\222D4\200~\032F\231,X\200~\356\363\377\354\310\264\261\371\234\217RM\222[3z\376\031=2i^z\316x\230D\337\271\316\277\343#s\005\306\336u.#c\305x\276\212j&\211r\216\363\347"
+	.string	"\311\210Q9\016s\353\305\346_\254!\003vs$\245y>F\365%\267\372\370\336}A2Px\370\274\3060\211\304\204y\213\021\222iBl\362\305\240qS\327a.#\263\244\231\347\253(\276$\321\236\336{\257\301\274\365p\310p\335\034m\201\031\223\305\002G\356\346\341\275\363t\310`!\301;#E\351}\361\362\376\322wo/g\0362G\210A\254\356\230vuo\273\"\231\252\233#\"u\347c\024\230\344\222\356\275<\222\231\222\242cv\341\362\356\222$\003\365\304\345\214\024\225\267e\356\275EI&\b\220\2713R\024\036SN\313[\316\207\f\323\222\017-\347\253(\274-\345\316q\342\340\336qL2IHpg\252\250\272\267,\3577\244L\321\315Q\n9\242\030Q)4\361\310rF\022\265dbq{c\t\"\223\003\307\220\333\371*j\251l{+\235d\202\206|)b@\311\330\210\021%"
+	.ascii	"\324N\246F\267\235\257\242\350\230lko\266)\231\237\0312>1\206"
+	.ascii	"T\3050b\004\345\263\327\316FQt\311V\353\264\267Z\214#2;2F\031"
+	.ascii	"\235\030\311\030X1\264bh\241|v"
+	.string	"\032RT\027\346VN\005\216\334\315\241\3349\016\332\331\033\355\f\326\354\213\021\005xvF\022\365v\344\206r\307\214\271\274\315\260\320.;sie\357\306P\022\203I\363O\227\375bVyJ\343\225+o\037\314\001\330\021\264\311\376\353\021\243\013\b&\206\0270\217\354L$\252\314J\315J\326\333\312Q$Z\035\024\340]\035\320.F\224\024M\305b\021,F\230\030\312\347\231\365\366\301&x\241\023r\324\302A\201#w\307\252\274\307\306\200]\270T9[Eu%\305\250\274\305\310\200rZ\2500\303\246\274\303\312\200oY\246\234\257\242\232\200Iy\203\235\001\225C>6`[\214\264\265\030mmR\256\2044o\360\3260\201#w\243|\275\243\270\001\323\320\276\230P\236\274\241d\001\226]\351'g+!|I\257v\362\366\212\001\007\034\2739\002\212\001\253\304\320\022c.\006\227\030\\P>\333\211\225\22015xk\220"
+	.ascii	"]\032\032\237Pu\246\214\300\221\273]M\336]u@\260\233#)\335\344"
+	.ascii	"l%\204.\271\225\323M&K\336L\316`1\356d,\371\305\252\252\224\306"
+	.ascii	"\343TQ)\225t\222\267"
+	.string	"\222\030_\200N\200M\200]1b\350\305\210\301D\371\354$\347\"B\264\244P\225\244\\\343\023\252\212 \3201\370b4\253p\210E)*>\300\206_\327\317'\024\240\340\372\345\313\373\3102K\007|\371\257\353\"\220X6\034\271\313\265\365\346\302\001nieam\305%\265\262\336ZF\340\325\021+#YL,\254\035 \221!TSH\316{Pp\235\274z'{\200B\206|34A\331\350\220A\356\311\246(E\223\323\325y\017\352\215y\244\255\336G|\200@n\216f\220C\332\350X\321\364\303\246(\205\034\223\3259\f\324[\362|\352c\022m#?\237\224lp\314p\264\321!C\222MQ\n$#\347=\250\266\006\324c\361Kb=U\f8r\267p\0279/1\331\202\244\273\352\27365l\202\232\177\272\3107`#\004,\262\301\301^M\305\242\016\021\220\310F\007w\311\025\213:6<\200<l\212^"
+	.string	"\352"
+	.string	"\356\2609J\262QRB\371\354\252\367\221\033\200\004\305\226\\\300\253\360\002q\330\370"
+	.string	"\016\3310}\261\214\024\333\024\005\034\271K\204\b\022h\003Xc\b\021\024\0313\213\267\206\004\324\360\243\372\371\244\003\n\256^\274\274\251z\352M\005\004\002\376L\275\215\230\245\234\266\020\340\345?\252\327\354$\265HE\275\245\316t\347R\310;\352\003\250\267\220\2477\324+\\\020\240\316\220\2179\300\242\266\227\0044\002s\372\351(\022TX\262\003\211\330\250\304\002\027\210\r\217(s-\314AF\206j\006\303"
+	.string	"\022#\032"
+	.string	"\b\305\3218M[\351\314"
+	.string	"\024\200\021KlHp\\J\244\022\223,\303\361@\335@("
+	.ascii	"\355\021-\024p/\005\3066\266jv\2337IZ4\230\363}\210\330\002\376"
+	.ascii	"\003S5\375\237\360b\310c\327kk\355\005\b4\333\356%5,\216\236"
+	.ascii	"\f^\235(q\201\237\244P\240-[\001\221\300\377|a\205NOLK\313\023"
+	.ascii	"z!\256\214BL\007\306\364(W\006]\334\301\344`\234\f\376\244 z"
+	.ascii	"\021\302\002\225\022\212\203c\177GNj\246\354h\177\324\322/O\325"
+	.ascii	"EY\263u,:\266m\230\321/\305\336\223\267\304{Q\276g"
+	.string	"\277\f\210\227\252\"\266\2069\226\377\376\252\321\343\f\250S\213\346\214?s\253\300\021\021\204\223B\362\325O)\340\237\177n\"3\356e\350\376%LfK\337E<a\220!\270\337\241\331T\335ZN\212>Zx.\345/\347\321\214\2570t\336\021b\"H;\227\027\220c\367\350\325\354\337\350\024\320\243\\i\004\261@\004\370Re#\212+\020\016\033i>\020\255\211\341*N=8%'\207\330\221NW*\234Y\216\342Q5\245\205\362H\033-\313R\206\374xo\200\321\361\333\321,\271R\214\352.\310\246\n\254\016s\261\332\306\376\216f\314\276\351\013%\275\017\374-\336_\331\356nji\362\004tx[Y\272\244\203^\247\323\277\035\320\244\3135\023+\302\"_\324/RF\312\363&6#?\214x\207\357\220\036\223\304\237E\274\006\215\234\216l\356+\177\256C\212\315\036\326\225\255\345\226\341\005\277\036\237\237\021\227\343\325"
+	.ascii	"\322@\007\003H?lrB\274\\\252F2\376.\230n\026,B\200\306\005\250"
+	.ascii	"\322$\020Y\264\231\314\340:A\224\232|[\275=\023\310\350H\321"
+	.ascii	"\017\264"
+	.string	"\203\374\320q\353Y\267\036\240\261\003\032\353\222\337\265.G\321\355\246\035\007\3071\324\245\245\254\242\342\270\236O\3431\311\354\330A\017\272>a<co\302\264\375\375G\267\231<E\313\007\\\370\360YN\020\002\253?\336\323fd\315}\267s\327\216\324\313e/9\341\342\217M-|\345\007*d\307\275]\363.0\2006X>h\352P;U\302\305\"Jq0[\221]\033\373I|\352\214J\232\321\224\223\206\201<\332\310\300\225\r\016\332\332\r\252\231\t}\267+\177w\327UfV%!\242\312j\366\rf\327\206R\273\343\200\205(\241\223rt\273\340a\027\254V\346\210\310j\t\b\177\374\267H\346~\005AW\023^\361?\026\314OI[=\226S\342$\300Y\370k\0250\341\374.\3541\244\371\202\"\376\b*gF\271\360\237n-T'@\026\213\t\240X\377\217|\232?\350bob<\225y}\020E?\323"
+	.ascii	" \224\0065<v9\220m&\3130/?O1\224\260\016\254,\255\356\277\345"
+	.ascii	"\337\206X\207\314w\320\257V\234\222\333\020T\323y\262L\306\b"
+	.ascii	"\362"
+	.string	"\340\217\235\346\016T+\304\354\320}n\341\303u\224\027\001V,\241\220\020j8k\211sp\305\221\331^\257K\0052R\342~@\254\300\326jg\235\331\265\237w\017\354\235\213\272\245\f.6\311`\317\343\220\001=\266\031\224{\f\n\364\177\3526f\307\205\334\315-\363\311<\254\257\006\036\0031UJJ\207\255u\215B\241t2\246\273@,7\306_)~\030\003[,\302Y\326|\204\331\352\023\\\001\3329\002!\022X\224\261U\306\341\351fB\334\355\376\2244\337\254I<\n@\215\225\242\250["
+	.string	"\216\214l\371C\314o\2640\212\025\\\354/\201\311\226\2551\236\f\364$\241\204\267\352\366m\275\326\001<=\271\212^\034\374E7U\205\324N\264\355\210wb\207\212(\314\230\363\343\216\232\237\227\310^.Lkb\255]\251\240h[B\311\035\304\246\2127A@8\233 C\261\325\260\323/\241\327\212I\303\351\355_D\346\364\007\320El\346\372\\\355\303\330\177\216\355\027\177\220q\304V\017[\321\307\332\214\276\035Sm\217\f\355\342\277\267\205\305\315\215qBt\365\355Et@\353\217\322\232\033\377\200Z\235\032T\207\230\231o\303\034K^X80\270\356\343$<-\237\026\334\ru\247\232\314G\024\335'\256\266\332\030w&T\214\206\203\330\005=\325\363\031\341\240\007#\254\327\017\275KLp\024N\016\340\364\030\222\225\315x\365\tX\241\316%J\024\271\227oP9\370e(\211"
+	.string	"W..EC\016T\t\215P\275\031\323\363\301n\256\236\326\n\215*b\306,\220+\026\374}\322\2676\034\277d\245\262^-\317\373\306%F\246g\023\341U\241\210"
+	.string	"\2056\213\244Fq\177{\306v\341\267w1\224\2422\024\032\b\343\342\372\034\277EF\020Z\225\263\372'-\027\244?\323\260\3008!\001;\342\352`%h!\313:\2762\313j(\303|\306\274\350\366\030u\233\001\230;8\347\317\335\325\212_\0216g\320y\021\312\r\016\304\213\300\027\006Cz;\221B\013\020\275XMp\022\005"
+	.ascii	"\213Z\005\324Q[}\277p\3770\344\260|\3159\262+\2179X\342\234\270"
+	.ascii	"H\325\202*\034\316\303\242\252A\241Y\036],\350\357\233E\256\273"
+	.ascii	"\201\025\342\371]\265\336\230\031\370\223\370\033\0215+\230\211"
+	.ascii	"\377^\3400\356\347\262.\257\236\027#D\315U1Lgw\374:(0\362\277"
+	.ascii	"l5\3501\216\250\235\240\024\305\003\217\017\202A\306\207\230"
+	.ascii	"\204\020\005v\324/\247t\357\261\200\03774\211\323\301Y\210\025"
+	.ascii	"\367\344\366\017\323\256$t\362\215s\212]\213<\2448\0138X\274"
+	.ascii	"\245\321\211\203\251]\314\037Dc\037\\hWA\203GUA\221\316\035\200"
+	.ascii	"6\243\312\204\230_\024\367\022\021\2676D\fV@\311 \202\020\305"
+	.ascii	"I\250\350LT\3436\254\354\314\f\016\004\025rI\301\336\254\226"
+	.ascii	"\3272\310\222tD\201\320U5\272D\347\332\307h\204\007"
+	.string	"j\310T\306jX{\021\226\007\261\335V'Z3-\324\333\317\\i\037-\016I\211\250\362\273o\227\353\177\351\347\301\f\203\374E\331\351f\t\233\232ZL\243\002\034\242\313\360y[\361x\023\264\321\363\217:\2179\021\023l\"\337V0\333\232\025e\321I\337%\335\233n\311\321d\224\037\370\277\241\300\220\245\302rV\246\r\260\305\267p\247n4!\021\345n\271I\345\026aI\307\235PL\377\007CS\301\037\2122\361\b\316\2204\250\343gu\230\303\005\201K\333\323d\024\252\303\035\007\021\3556\346\274Q\300\036\350\025\211\254\333E\302\323\021\n\236\370\317\244\273K\256\351\315\262pG\031\273\212\357\007*\2647\265o\242\266\323o\264q\272\r1\252 1:\316\362\347C\204}\246\016\226\346\0020LR\337B\335\341`\332{pz\352/g\021\003qh\320Nt\022\273?\223\220f\rb\340\265\t\006\303\230\231%\233\326"
+	.ascii	"%\177\302\335?l\205\233w\013\265I \234\365Yf\3018\275\246!\321"
+	.ascii	"\200\341\004\340#\367\325\021\345\233\0339\224\257\323\356\005"
+	.ascii	"4\t\301\2030\265\333\372\262u\214\036\336\300\276\321U\307\""
+	.ascii	"V\333\261\323\017\216\353\355~(\335.\273\2445\304\300%\241\351"
+	.ascii	"\240\007\357\361RV\330M\320$\034\030\275\240\"\002|\002}\333"
+	.ascii	"\034=T\362\2026!]\337\216\333@\236;Z4\212<\336R\006\341\0325"
+	.ascii	"\005\372g\314\267Z\215&\360\345\363U\342\036\217\217$)G\372\311"
+	.ascii	"1\255]<\314\233\344\243Q\\\032\262\317\335c\261\242I*qE/f\003"
+	.ascii	"6\200\344\327A\304\326\362p\216q\302\177I\37690\263@\235\341"
+	.ascii	"\216'\320)[\007\305^\343$\305'pK\215s\376\215\202\314\340QH\312"
+	.ascii	"\271\240\307\222\232\235V\257-6\350\353\204\203M\035\200n\\\353"
+	.ascii	"\0134\035\355H\005\201\304I\272\346\f\f\200\355\202\201\223\346"
+	.ascii	"\271\363\367G\326j\236oe\327\202R\313\232\3374\224\200\035\212"
+	.ascii	"E\300(v\254 2-a\024B$\257\001\"~\013\351\346\360(\246\313#\023"
+	.ascii	"\276\307;\n\226\217~\310\234_6\034D\250\351\262n\355\347\210"
+	.ascii	"\336\230U4\256\233\203.\360\211\255\331\264)\336<\317\346\205"
+	.ascii	"\275\005q{}\201\304\226[\007\r\215,=\016\003\256GNe\365Q\377"
+	.ascii	"\310\245l\253\323\322\326\242\341Wh\313)\206\353>\016\036\226"
+	.ascii	"\267\211\203\226/B\n\005#\202\033 ?\372\276\236H\264\034\001"
+	.ascii	"|9\343t\311\212\211\317\307n\013\036\030\016\276\037\276"
+	.string	"z\364\276\\\360\306\370\367J\377\213\262\237\350\341\031\343\374\343\350\272\314\341\373?\311\252\327V\244\256\364\016\221\305\020\361;\004\232\237\351\250\265\303\243\362\321/\235\216sN\323,\321\302\207Y\336\205\257\354\334\333<6\312\372\260\355\\\273\001\322\234\013\222zgy\326\304\327\312\211\210\035\013/\307G\350\031\337\t\303\356\307r)6<\353\351\237ey\347'\266#\204=H6\210\213q\252\276\351w\2562\324%\246\351\221\301\306e!R\360\\\217\355x\213}\246.\033n\363\274\215\177\360u\233\217\347\354\270\323\310,\005\353\333\341S\305Hb\230Y\007\225\016;\213\177\210\363\305{\240\211\245\246\217\023\264@a\334\306\206\264\225\021\234\264\337\374\002H\245\242fj\237\377\232%\357*r\232d\027A\322E\342\267\352a\024w\001\233\233\323\363.\001f\306\232\2302#$\373H\202\232R\304B\b\022\310\277\346\3517\332\024B*"
+	.string	"\027)k\235JG\261\370\346\346\272S\243\3020\t\236)\335\004X\344:\302\002~S\233I\220\364+\006\"\201\335\302\371\315\237\241\f\254\356\364*\310\013\241\346w\305\007\360\367\234o\\\240\200Q\017\n\231\023\027@\241\275\t\326\312\206\2617\017\215\257.\343\003\312?Ta\261\0272\216\b~\344\253V\350\270{ \346\236}\246\022\034b\350s\350>$\207P\235\355\330\f\366;\302\013<c\350\351\304\355J!\355N1T\177\311\252n\204"
+	.ascii	"\037\260~\205Z\235\220^~+>L\343b\235\3326\031=#pw**\341-\200"
+	.ascii	"\205\336g(tWL\317$|E\334\332/\362\003%~?\203\245}\232\344E\314"
+	.ascii	"\314\346.\t,?\245\203r\366/@\322[\001\215\237\276\"\177E[V\377"
+	.ascii	"\027!\302\254Ig\2343\026~\003\216z\210\022\210\203\347\001|\256"
+	.ascii	"\351I\333\256N\255\017Rw\261\250\377;\007\215\255\013\243j\327"
+	.ascii	"\204\377\240[s\016|\006\022\222k\240\001[\017\366Ff\236\246\022"
+	.ascii	"\214\302\"Gw\214\305"
+	.string	"\313d\262u\342\274\033!\331\243\250\243\007\335\033c6\350{-Ym=XF\346\030\377\355\017\357w\037=\357.\177\343\254?\250\227<\373\355\377\210t\353\3529\372V\302S\317\336g\027T[`\3651\034\"Zz{s\035\\)\345{V\027\031\302\3602\0355v\362\366\017\rvG\336#\201\026\237'\316\323\307\220\360H\206'3\345\262C\362\037\271\204\337\216\370\2724\326\\lIr\377\364\217R\217\346h\344\243DK\226/\027\341\370\027\001.1\342&\335\324<"
+	.ascii	"\033\225VC\234\007}\n\342S\235\377\301Ee\355\375\017\\k\221\377"
+	.ascii	"\365e\301j\253/\033\001Jxp\201R?<ga\215\334\b\026\341E_\255p"
+	.ascii	"/\262okLxK\326\r\234b\270\302\355\004\033J\377\310\370y\310\370"
+	.ascii	"\212\267\241\016\353\264~\313\333\330\031\277\341\342\00183O"
+	.ascii	"\357\315\310\034\b\362\212\306dL\007K\021\253M%1\b\343\037\316"
+	.ascii	"\321\342\341M\203\363\330\325 \230\366\037\024\0305\016\3404"
+	.ascii	"r\231U\253\026\004HU"
+	.string	"\032\344M\324;\200\323\030\231\202\224J\207\016Ez\n\"rTiCAN\037\261\247\017\362?\331\007Z\374B\305.\331\236\rMpA\304O\210\025\030\271\213\033\022\234O\242SU\330\037\251\352\323\353,\240\320UO\001\314\025\275P\202\377C\20364%\374p;-J\001\240\361~\312\326eO\255N\032\213\020;\222\036'\357\021\351\237-\234\240\262\267\303\320\235\371\240\344/\321U\375\273\001\316\204?\240V\003\2372I3\232\275\354\225\254a\243\375\251\210\376\250\036\240\376\366\204\206\024%\336\236^K\244\035LH\213\306\361J\2532\220\323}\273E\213\016\023\205\312\232\021ePv\\\310J\240\254\027L\314\213\225\353\257\267\344\220\207\327\313;\237\364\243\254\256\327s\352\237A\025\313}\243\2466mnL\\\301\317\\jE\343\243]\326h\324 \311\223\336\352je\261\030\203\265`\332_q\013\207\347\207\3148g\220 "
+	.string	"\352p\345\240\327\251\350\017Z\363`\0259\267\201\201\007\200\034\204\227)\336\243\254\370\335f/\347h\342\277\331\265\234\260t\020\230G"
+	.ascii	"a\224$\n\362\235\314I\314\373d\030M\001+\036A\303S\337\212\310"
+	.ascii	"]\237J\033h\273,\233\301\324\271suW'\177'\270\221\233\3156\213"
+	.ascii	"5e\242\363\216\030CT\301\305\236\345\031\370p7b\226^\202\362"
+	.ascii	"k\325I\201\253\337\004\366\261}\001\021\353\213\374\314XW\301"
+	.ascii	"4\224\261o\264\3731Yp\210_i\235\fGBH\302+\260(\264\247sF\211"
+	.ascii	"S5\023\244\177\235/\017\260O2)6\236x'2ae\223\367\347\276\024"
+	.ascii	"\323\247D\337\rM\325\025'\372\203\0202\376\020\305e\026l\221"
+	.ascii	"\264\351\022\300\036\212"
+	.string	"\003\242os3R\021\fU\223\0233\303\007\360\300\336I\214VOmZZ\240\240Mw\024\"\035\3538\204\263\331]pN\305d\350\016|\013\322\025)\234\351[\260[\201\206\264\327\277Y\205\267\334gy \230O\253e\223\024)\364*\371\265o\023=\036T\037Z\260p\335\233\230v\206\351>>\305\227Yc?$\344F\261\261b\205\305\356\204\3366\320J'\261:1\212\364\234\004\342\252\206\266\305\343\270\222\275\017\2600\323\376Z\001\212\323ot\222\202\203\227r\205F\224\263&\321A\"c\365n\277\254 m,,\306\371\202Y\266\312\277\225ma\\_\205\203\267\371\0379\371\230\020\360\265\356;)\336\342R\235\252n8q\300\362JH\003\215\302Y\331\256D\037\247\211\234\365\254-f\205\322\3512\317\030AvO\202\037\257\220]\300\\W\202\"\310h\025S\307\3037'\022\371\226i\027\255q\206\271\256MC\310%"
+	.ascii	"t\324?D\267?r\203\353\320\f#\\\350\254x\367\201\304\226\331t"
+	.ascii	"\207&\n\246*6\346\334\b\200\323#\267I\304\251\355\302+\006Ak"
+	.ascii	":\272\367\215\365\271k\tW\310\267]\323P\025d\251\233\227&\275"
+	.ascii	"\004\304\234\026\037B\260\347\022\333\346R1\001\216\247F\205"
+	.ascii	"\335\356}p$\0167\354\276'K.\344\274\375\273\336k\213\250\235"
+	.ascii	"\217\204\226\254J\270\314\241\333\337v\372\274\023m\226s\331"
+	.ascii	"g&\336r\"\021w\226\201\223.5\203V#Lh\374\230?\251\215\306\035"
+	.ascii	"\272\301\371\235\2021\027\260\n\226\r\374c\253\222\216\360r\350"
+	.ascii	"\352Sw|\231\004b\224\f%\235'Q\027\350\376\036G\034\026'\305\r"
+	.ascii	"\354\333\211\216}\244d\307\224T{p\267\026\343F\357\t\025\305"
+	.ascii	"\340\3015\237\230\374\356\326\357-\025\026\257:5\374\002\333"
+	.ascii	"\341\332H8\240s\364\205\3038>\203\003:\347\325z\260i\370v\260"
+	.ascii	"\177"
+	.text
+	.section	.gnu.lto_mspFcProcessOutCommandWithArg.176.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`\002\020\005R"
+	.ascii	"\312\214H\037Q0T\312I\007A\313\3078\320\017E\313\031c\037\266"
+	.ascii	"x\261\241\357\254x'o\244\241\30694j\320\362\370F\204r\243\362"
+	.ascii	"\333\036'\276\274\345\005\204!\320\003\016\301\3505VM\274\334"
+	.ascii	"oE 1\332P\324\321\320\325\034j\324\371\030\267\261f\304\022)"
+	.ascii	"\223\f\344\001\256\001\351\001?\216]aN\024\356\303\337\036\367"
+	.ascii	"\037N\267\306\271\250\327\252j\302\r\200f\177\265:\237.\267s"
+	.ascii	"\257Y\365+\034\001\314\341\257\326\272\004GB\320\222D\255RM\336"
+	.ascii	"j\275\262\021\345Rx\334\215\004\233\372\2542`\200l\177\265^e"
+	.ascii	"@\274\360N\236\343\244=$\321\032\304Y\263\214k`ogaju\032]\270"
+	.ascii	"3\210\027\236m\327\210\356\362\3305\356\256p\207\035}\006<\031"
+	.ascii	";By\367\316\353\300\343N\240xl\352\224\232\020#'q\233w[ \300"
+	.ascii	"\343iQ\333\265n\211y\253\3259\300\n\021/4\373\031\217UJ@%\225"
+	.ascii	"E\300\0277&\2240\265\326\243\240\347\244\027\242\307I/\354\256"
+	.ascii	"\017\036u~\177v\247\225/\001\364\343\323\303\263\243\223\203"
+	.ascii	"\304\271!aSs\244\2311\312\024\211\303T\2106+\367\313\227\030"
+	.ascii	"{;\013\004B\207T?\304\376\274:C_\210\371\213\373]\031\377\320"
+	.ascii	"\220ev\237\273G\320%\306f\366\036\033\256\300\230\007m'ku\177"
+	.ascii	"^5A\025@#Cr:2\336I\263\306\256#\366\034\324g\253\n\220?\257\304"
+	.ascii	"\320\241\274\031\204\270]\030#\351N\301\036\330\224\261\343\f"
+	.ascii	"\371\r\312\300\017Y\362\376\274\372B\377\025\003\221\323%a\022"
+	.ascii	"(lP\034-\037\364\376\274\322BW\350-\021\342\3055D~\244A\033\220"
+	.ascii	"\313\233\362\347\025\021t\305\226\327\f\332@\022=\276?\257d@"
+	.ascii	"5\320\nr\033\256\206\260qk\355(l\270\212\201e.\205\366\"\372"
+	.ascii	"eK\rD#YA>\374\363*H\033\223\323\257\035\202\256-\347Y\240\221"
+	.ascii	",\255\013e\260\\8\212\252\370\203#\342\210E\205\346\374\020k"
+	.ascii	"\236\355l\2055\305\215\244J\006\253\207\220tFo\211\220\033\271"
+	.ascii	"B\023\362\320\201Z\353r\023+\353k\342\273<\301\356\002\331=\366"
+	.ascii	"\004o\323`\203\001\274j\225zS\200v\321\273\035x\300o\356\373"
+	.ascii	"\366\320\360\252z\211\n\273mt\017\024\246\240\024\017.\211\017"
+	.ascii	"n\360\233\335\357Rd\252\227\277)\003\354C\233k\215\316=\363T"
+	.ascii	"\363\233b1{\344\003zwI\004~\223\373l\307\351\262g\2067\325\313"
+	.ascii	"\375\336\217fJ\302\374-yL\002a\304\256tsm\331s\271\336\027\333"
+	.ascii	"\031\231\226\275\020E\364)\251E\370\366}`^\244~\261SRk\020"
+	.string	"{\275\335B|\362\250\364\302S\r\267\302\234\221\325\"\265\b\313\356n\351:!\266d\250u\371\255-\334\254E\027\266\350\257]F\212Y\221\300\277*\026\334u.\271\271v\3170P\351\213\333>\262\373\035~\245\346\265\321\274\034$\035\357k\001\215\0312>\345\373\300\201\370.\360\036\2760^\374\311\357\342N\376\003\236\366\267X^\025\315[\324\274\002\334\3127\005\321P\312+\324\274\001\020y\0010\362\242Hy\203R\336\0232\274&\210\274%R^\240\224\367\247y}z\232\227\307\310\273\223\362\352\244\27492\274\310\224\027'\345\275Iym\232\267\246y\217\315KC\344\235\271\334\327X\344\225)\362\026\213\274D\"\357\260yS\"\257\260yQ\"o7/\177\356\373%\030\203jX\236|\231\322{\316\372c\360\210\212'\214\033;\336o\345\237\362\003\361\367\360\273\375p\277\334?\367\342\356w\177e\237\267F\274\344\261\370"
+	.string	"\375X\270[\243\225\235\013\232rV,\343\232\030\333\231U\335\236\312\355\326\bD\024Z\203\324\336\003\303;#\253\325\371)\342\224\250\240\245\263\006\177T\372@\313\350#3\314\255jk\247\037\350\216\302\024\324\351\234\336\351\241\225*&=x\220+I$\352\364\237 \341W\341\031\240\206\\p)\273\370\315\234\036\222bW\003\377\214\230\253\376*\177S~\021_\345q\312/b\230r\214\333\264\020\301C\366\256\262\206\307)\227"
+	.ascii	"5\275,\320\310\256Y\003+\202)x\3238\375*,\003\024\362-\006\221"
+	.ascii	"\227\026\013\234.\246I\361 \fI$_V\214\004n:\2032\275\300\264"
+	.ascii	"\005\372vG\302i\321\352\266!G\350\22080\220$q\005\037\214\266"
+	.ascii	"Q\026D\023!\266i\233~\035gA5w\225M\036\027\343\204\322L\211V"
+	.ascii	"\325\313\335U\346\300?\222.\226}(_\210\201\200\027Tz\241M\303"
+	.ascii	"(\313\022\230\306\3425\375\2429J\325\326\221]\3244\n\3477\350"
+	.ascii	"\342i\227\004\307\355E\022\320Z\2154p\2707\225\335\005\3769\341"
+	.ascii	"\301\275\013r8\334\034\373F\324\372\216}\272\337\264\371\005"
+	.ascii	"\016\361\"\277/$\232K\006\r!\276ef\nd\021\034\371\300j\366\222"
+	.ascii	"pi\276@$&\0064\233\357H\225\032h\310\327\362\013\026\277\037"
+	.ascii	"\246\251\240F\020U/w\246i\372L\301\251\231nQ\266\326$\210\024"
+	.ascii	"\017\312\001\021S\323\\\033\225\356\215\340eS\031\2240`\244x"
+	.ascii	"p\b\215\214\210c\331\020Z4\3155\346\303\246i\301\255\b\265\276"
+	.ascii	"\033#`]3L\251L\013{\270q"
+	.string	")\366\231@\270\330g\306\365\243\322a\023[\246\213\b\027\346Y\017\036\334a\357\215\370\021Q{\260\275 \311o&\2414\275\f\273\341\366\276\030\323vJ\373}{]\262\\\221i\256\377\216\206(Y\212)Z\332\220\203.\342\001\203\"*Das \034\242h\277\255\316\357_\373\221\354\311\341\245\315\265\334F\277\017>\314\356P\033-@[\355\352pNOHK'\340H\016q\034)\251\006\324R\216t\351\004\034IMI\246a\022)\251F\t7\230\206\"\344\300\261\224Ar\351\311\004\020\2169& >\355\270\340ii\004\245\033ME\247'\244\247\035M9&xZJ.9\321\344\200 \231\\R\322\341\204\364\224\324\201\324\224d\262yJ\206\320JN\311FJ\252\021\002\223R\272J,\232\222LG9p\334`:RrJ\036\261\310Y\035MKNGO:t8\035\031\235\365}d\221>\256H\341\024\256L\233"
+	.string	"\005\231n\305_\231~\355E<@\025\230n4\312+S\025*\232\273\307\376\371u`\311c\254\224\370\377\234\250e\261\016I\"!\241\"\271:\274-\2644\240\346Zc\231OR\013\375z\214\236\242\255Rt"
+	.string	"-\343\256\247\003\350\036\323\0050\217\353g\305StR\377\356B&e`\324\366v\330\002\240\367F\244\240\027\225\343\325\364\202\242\001\350\016\202)\030\324'\032E\247\200UL\n\270\005\035\324<Q\252n\350\301\203iP'\274\016\360:\321'|X\301{>\355L4`\323K\2116Q\242Q\035\264P\301\373a\243\377\311L\240\220)\352\360\250z\371\344%PD^\txY\320\317;2O\313\\\233\265@%\306\207g\250\027\335\031\352\036!\376i %PG\241\260\344q\005\320W\362\310\207"
+	.string	"\337O\303(\003\323$\rF#I\022\221B,tGl\241}\365\020\265Q\215nL\355n\212\305\274\261hq\322\306\323\\\013DJ\235 \316\213^T\307\330Dm%\245.\r\207\245\276\250\316{\250\255|\232\275\250\371\371\374\005\037T\224\004\376\035\255\265\326\235\234\031-\344\303N\f9\243\215mu\273\337\344\320\350E\221C\375\3530\r\037j\032]\303\f\333c\026\362"
+	.ascii	"\347rf\264P\215\216\213\332"
+	.string	"\025\236&\352\031\375*%2\232\247o\230au\001\201.\250q,\344\224R\b\315\214\310H\222$i\fA\005\304 \b%\344\r\0210\255DL\215\314h\222\3022\007\333\302\303=T?<8k\330\030)\313\341XS$D\017\371T\302\307l\252\355\375l\371x\231u\367`\372\254\030\253\322d\357U\220 q,Q\362\334\320\034\020\374=\346\312\031\275eaOqf\324\0036\247t\3426Z\336\314P\237\352!\216\007W\234\3361\306\242\231\002^\216\313\033\227c\035\255\231\362\177\363\342&\362,M\265\322S\023\206\242\344\225Z5\326\273\342\203\230|\300\356\273f\246\34200\371f\343@\271\221F8)\267J\317\217\341\244\376\250tb\350\n\205\322F\275T\263\3653\016\344\023\217\275\2500\202\f\322\371\363\311\b\\p\242%\356\312\314\253\352\001@\203\177"
+	.string	"\333\232\203\347]\355\274(\266E\234\266\330r\200NX"
+	.string	""
+	.string	"\013,[\363)Lb\356\331Z\345\346\314\202j\243\304HCD*fN\031N\217\354P\200\325v\006\202\320`A!\001\037\210dBC\255&\247\006\322!$\260\227\356w\002\311\263\256^\346\2624\016eM\325g\271\034\343\277R!\316\233yR\007)j\013y|\201\245\004\242\355\307\270\257\360t\034\376\")\334wc\316\3240\017\001\352p"
+	.ascii	"*FW\274\360^r\240\363\021\251\262B\371\205Z.~f8\214t\237(\267"
+	.ascii	"\350\374f@o\326 \312qx\343\311\3128\323\365\007!\377\273\350"
+	.ascii	"\303\235\216v4\346\rN@%[\212\230\232\351\234\020\016\f\226\322"
+	.ascii	"\347\233\251\312\344\253\210\034\371r\374\211\343q\367\016O\231"
+	.ascii	"\263\002\013\312\351\234\001p\023\034b\247\214IY8\270\327\302"
+	.ascii	"IA\232.\022J\311\277\t\367\226Q\005\214]3O\2569\"\237rs\306y"
+	.ascii	"\267BR\234\360\333epn\303KP\302\235\350\202\f%\313 Y[Z\016\204"
+	.ascii	"!\003\254\026\253\332\233\032&\036\251\307\007\341\026\027/\020"
+	.ascii	"\2460\016\324_\361L\003ZC\326\036j\017\212/G\231\211\272r,\207"
+	.ascii	"\004P\037$\034=}\312\245\033\243\321K\231+6\362\214\367`\256"
+	.ascii	"\f\315y\354k\267\272\306\233!\247n\3028\013\272l\231/\273\210"
+	.ascii	"\265\021\250E{\023\312\201M\303\036\226\341\337\364\231\255\346"
+	.ascii	"\006\243!\020f4\262c\324\2073\307\203\n"
+	.text
+	.section	.gnu.lto_mspFcWingStateCommand.178.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`P\007e\036"
+	.string	"\026\273\303E\240\322J:\02233\026(\304k\263\213K_\255o\361\367\013\373\026\002\303\372\267D\275\254\241J\254\317\037\337H\360\370b\\\245\030V\241\263Q\235\035\217\223\362\244\374\271)n\212\233\342&\236M\037B\b\331I\312\024\262"
+	.string	"\227"
+	.string	"\267"
+	.ascii	"\016\3055\030\256%\270\276\\\257\\+\001\031\035\031>h\213\337"
+	.ascii	"\234\033~C&\016PN\205\252\251\332:G'7\243,\216\3167W\366F\347"
+	.ascii	"\006W\326\366\344\243\3235e\263w\236\2401Lr\346k1\347\334)hO"
+	.ascii	"\260w\n\216\332\363\316NS\030_\252FA\247\2079R\367\243\254nN"
+	.ascii	"\016@\n\272gTpI\344\350\332\352B_|)Z\005\r0\247\031\215\2709"
+	.ascii	"\323\204\2343*\3504U\t\025\034\025%T\320_\366\216\226\013\023"
+	.ascii	"\f\351\207\006\fk@\346\234\274\237\320/\335/\253\366t\204\254"
+	.ascii	"\003\230\256H5\347\364\222u\360\240\276\332\306\261-d\213<\002"
+	.ascii	"&l\225\363f\266\270\266\n\327U\343\232J\256\247\344ZJ\256\243"
+	.ascii	"\3045T\270~\032\327Nr\335$\327Lr\275$\256\225\302u\322\270F\222"
+	.ascii	"\353#\2716\222\353\"qM\024\256y\343zH\256\205\344:H\256\201\304"
+	.ascii	"\365O\270\366\031\327=r\315#\327;r\255#\256s\3025\316\270\276"
+	.ascii	"\221k\033\271\256\221k\032q=\023\256e\306u\214\\\303\310\365"
+	.ascii	"\213\\\273\210\353\226p\3152\256W\344ZE\256S\344\032E\321TO\344"
+	.ascii	"\332D\256"
+	.string	"K\344z'\327$r=\"\327\243\\\213r\0037\032_tuK0\002\201j{:\224\323\237\232\356tm\273\241Loz\350Cm\350\322\231\304/]\333\024\210\327\236\242\324\3401B\204\225\262U\335\212\352US\247\022@d\354F\330\2345fR\237z\350\343\367\233\211\272\324\275c<\304\366\327\006 |\324\225MA\016gk\275\034l\013\302?\371B\240\241,\370\223\333\f\032\324\\8\230\345\301\353//\204\241\310\311\356\355+\254P\311\376\0328\025\342\024\013s\206\341\350\367Kdl\205\330\376lgi\317p\343\234SI\257 \316d\004A\013\333\237KVch\357\301HfC\320Z%\263\317\016\0268,\034\314N\023\333\007Y^W^]\240W\227\203\033kHB\227\026/\302\203+-\036\026W\027oH\305[\022\262\270x^[[\\\274]Z\230\312y3\033\350\221\026\244.\354b\246 \347,1\325\323"
+	.ascii	"uj-s,oY9\213\312W\256s)WAy\212\311Q\256s\003LR\314\310\311|&"
+	.ascii	"\34620\217\271\312\275\034\306\345/%w\271\312\021(A\221\023\207"
+	.ascii	"\363\234\233\343\330\374\346\032Ws\033\232\327\354Ns\215+\260"
+	.ascii	"3\373\361\371\374\247\347><\357\271\372v\316\243\363\035\222"
+	.ascii	"\353\\}\007Hl\220 z\343\235h\350<\241\017]\337\202.\004\364 "
+	.ascii	"!)#\007\272\276!\030\031\242\344\226t%\244'\035\035\351\352f"
+	.ascii	"\364\243\242\200\204\250!P\005\006\223D\202QRPP\320\2445p\203"
+	.ascii	"$m\341\021\320\2442\222J\305\304\3769\257\231\202\354\274\022"
+	.ascii	"\017\350:\246\206'D\233\016d\256\275!\316Z\3555`^\335\215b\256"
+	.ascii	"\352\256\t\362\326\336\020g\255\366\0320\257\356\346h\257\352"
+	.ascii	"\256\t\362\213\271[[\234\265\332k\300\274\272\033\305\\\325="
+	.ascii	"4\327\220\001\300\275dT\224-\317F\223\333\312\266\215\301\335"
+	.ascii	"\253u\221\260y\327\207\331!\340;\266\013\034\366[\200\350\206"
+	.ascii	"\013_\354mG\216\366\306,f\357\241\001\006\264\250\004\311C\035"
+	.ascii	"1-\324p\371\001\027L\215\203\267\306a\270D_\255H\322\224\252"
+	.ascii	"\373\232\367\361A\317_h\210\n"
+	.text
+	.section	.gnu.lto_mspFcRxTimingCommand.179.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`\345\003\005\030"
+	.string	"\026,\227H\300XM:\340IN\217\023\b\2008\374\034\323\016\274\262L\304\240\\\374\313\246\301a\314\337h21\210\224&\373\266^]\325R\320mP\016\2217\025\205,\216\243e\030\2264\310\266Ej"
+	.string	"M\212\2655K\b\331[\312\224\002\200"
+	.string	"z"
+	.string	"\207"
+	.string	"W\373>\377!\373\217\211\017\230\023w\224d\316p\201\023\200\227\016_\300\273\004\337\362.m\231\255d\2406g\f\234r\350\004a\231s\2726\347\031|\f\357\270\262\177\236\004\343\252\314\007z\314\371,\331n\263\177"
+	.string	"n:D5\365R;b\\\2021\016\306oE\213*\227\322BF\234iZ\232q\241\253\212\033M\343\016\030\337\013]\346t;\333\r\306\365s0\347\264\332n.n\324m\373\260\355\262\227)'x\2748\373\305\345?\177\353\341M\340C7\353A\367J\252UQ\235\222jTT\203R\375E\265'\3252\252\243ToT\353\252\177\340\300\025\034/\356c7'\213\235\226\211$\213t|\350\017\372\303\257}\2428\211\0368\021\341y\020_\310*_\310\207\310\036d\243O\027\363(\2608\001a\232s\312\200\227\b\242\036\310*\333a\t\001S\312\374\215\311\251\007\323\234!\314\245\025\200\0013g\306\216\360#\t\227\tn\200\313C7\245\247\bGw\273C+\236\224\254\r(x\033y\023(\\I\013RK?o\277\n7\362\236d\\i\341EqI\350\236\364\264t1d@P\333\231uw\027\350l\2615\034\311K\237"
+	.ascii	"\350\267\265v\207\017z\233U6j\246\271\021\020\340\2349\r\374"
+	.ascii	"\"\027j@\034\227~\t\357\362KB\347\244\347\007Gw\006\325\036\001"
+	.ascii	"\323\333\bl\214\242\324\204D\333\231\035\316tw\354\3174\0054"
+	.ascii	"\207\305^1\230\214\3018\2547\310\210\200\325\270B\320\274j\\"
+	.ascii	"\033n`.\231\002\266\021\321\341\306\025\263\261\271q\251\302"
+	.ascii	"\371\305\031\350O\261D\003\tgi\337\356\370;\222.\273I \314Y,"
+	.ascii	"\217\265.\033 \347\263D\225Z\025\207Cy\305\334\200\360'\251="
+	.ascii	"\321%\217\216\312\223\334\035\037\\\234\277\243}\331MR\230\257"
+	.ascii	"V\005\223\257\366?B\222r4\313\343\234s\306\230\257\366e\003\344"
+	.ascii	"t\273\0235h(pQ\373#\366\360&\257\030+3J\25010&\021b\006\311\310"
+	.ascii	"H0\025(\205\026\003\320\002\2211\242\007\021PEC%\024$(T\330\312"
+	.ascii	"\001O2rM\"j\375fD_\037\013\225\034\336g)b\020\373\250\244\205"
+	.ascii	"\265w#\316y\335\f~\214=P\341\002%XJU\372/\377i9\223\177\312\372"
+	.ascii	"\274\fnP0\333\215\337\0324\362;\306G\320c!\266\306,4\211\323"
+	.ascii	"\005 \345v\345\252\333XX\240\340\334\356\354UnI\3348\257-\027"
+	.ascii	"m\207.#\036>\367R\346}s\025\312\00334Toh\200k\254\331\365dN\300"
+	.ascii	"OLJ\246\002"
+	.text
+	.section	.gnu.lto_mspFcWingSaturationCommand.180.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`m\003M\026"
+	.string	"&\351\215J\300\360*\035\362\217\351\303\343\202\025\227Q\317\210\366\210\221\271 <\005\334\316F+7\tH^6q#\261\265I\355\"\016\377s2\337\004*\321\021\263\250\260G(nC\020\n\233\244.NoGnuG\230\221\r\021B\366\2262\311{"
+	.string	"t"
+	.string	"x"
+	.string	"\224<"
+	.string	"\361t7\266K\203dVe\t\206E3?9j\255\254\326\211s\347g\357K\316\330O%9\212\0245\233c{\237O\035O\211V\223\375t\363\362\366\273\t\n\033\020L\232\214\260\345|\f\251\315\b\315XD\361\340\234\2228G\315\217`\017\3562lp\023\301m(x\340\271\246&\303\223\347\346\375\337\037\f\221l\210\260\345\234G\005\265\326eZ\315\366\375\370\356yw\017\354\366I?\310\203\276\344\201\276\343}_\221\362R\346\235\223\267\233\227\231\367$\002vt\370\360\035\260V\017M<j\022}a\342A?\320\357{\357^h\326\240\005\303\245\023?{\340\226@4$\2061N\310\367\366\277-O\367-\356\"v\337\036\275\332\3529\344\030\"\325\250\265\256N\227"
+	.string	"yZ2\271\334\263\370.v^\206\247j\315-\031\325\332;\331\001\344\351\366.\">\250\316m\n\256G\232\356\224\253\217]C\364\261\271\204\217I\003\353\370\254\265\326i\340c\217\364\212n'\334\020B\206\233\266\344n\356\356\317\330\020~\213\275\333B\201O\343.\031\373}\340\033"
+	.ascii	"w\303\231\0361\334\324}\033\n\362\364\226|\242\257(yVp]\230\202"
+	.ascii	"\344\276\361=\022Az\027\003\214O\333\002\302\236\244Y\313v{2"
+	.ascii	"n\235\335\007\030\n\252\330\316\355\216\250R\347\0050-W\313\002"
+	.ascii	"}\265T^"
+	.string	"&\flB/\013\312\013\314\305\272\320Rq\261X^0\026\212\310\272\274\264\274X0../V\331\253\357\334\372\3744B\030I1-s*;\267'\2461\325\315\304\253\213b\037\307k\2553R\354T\377w\007\300\235\022oO6\266\316\246\340\250\252\351\016ju\222\024\311V\365\212\216\007T1\205\020!\305S\202\n\237F\311\236}\2413\320\361\212h\353\354\277\301\236\233QD\2501<\346\030\201dDH\"\2320i\256\001\340\002\221:n\021\340L\253\252JJR\330\f?&\320\237\322\021\3428\263\026\306\215wwY5^\201\366\376#\323\233\002\204\260F\246\300\331\374L\240\t\314v\207\377\006\337\250\361z2gm\273v\315\201\024m\326G_\031\237\313\301\220{\327\330Q0V{&?q(\3068\013g\020\f\273\231Y\273\322+C[]\337Y;\204\b9\354\271\270\206\202\237l#\207\334\317\032\300\211n"
+	.ascii	"L\323\013\325"
+	.text
+	.section	.gnu.lto_mspFcLoopOverrunsCommand.181.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`x\004\335\033"
+	.string	"\306t\263J\260\226Q:5\200\375u\360N\230\264E\316bN\3546\264\360v\270\260\037\224\21495\307\007\245\373BN\177\363\250/\3433\310\240\201\367\004\255\031\205\270\256\254\206sJ\247\276\316\313r\346\305<\307\016\376\313\037\031!d\023)\223\f\234"
+	.string	"\222"
+	.string	"\234"
+	.string	"\f\314\323\377\307\201\273r\n\032\253PBqj\311\306\374\335G\355MA\257E\365)\226\212T\304Z\177\tN\367\200yJ`<\357\236\351=j\357\241xL\255GL\210\324\372S\260\005\314\323\375}\206<5\377\"O\267\266K%\206\2536\006E*9\340T\255U\326I\333:\317\363\374\370\373\216\\;\035\233k{\340\307$\341\251\333\331N\307\022\267\302\006k\207\033\033`!F]xV\261\273\361\210\303\350}\341i\222\257\250\333\031\235\313\007\265\326e\335\256\350K~wO\354\256\203\335QG+\336\025\301\303\327\301\272\233HU\031\336\332\266\373\263q#\355\276\301\f,\304\355\243\335\232C}\007P^\232\367~"
+	.string	"o\372\306\356\364\205=\370}\221\2742%o\f\311\3532y[$/\253\344\205!y_L\336\025\311\353b\362\266P^\223\344-K^\262\344\245%\357H\3626\345e\312{\003\002dLa\361\336Y\353\2123K\035\322\250\033\207\372\203\177\323\357\364q\367\273\007\262\017\262\253\335\2052\341\252N\352wS\305\223x\363\247\275pWA \245bU}#&'^/"
+	.string	"\277z\267\202\005\276n@?\310g|H\235\303\241\266\365\376l\357\340\021\334\2567\306\345\005\fd\227\255\200\366\330d\237h)\326\264\017\353\261[9\237T\256j\206[\303\006\002\270\266-Mw\037\370\327\310U\365y\376"
+	.string	"\311M\323\313\271\026\273\034n\004\310\254\265\336\354\213<\252\303^\351t=\340\360u\247{\034\362\224\273\004\217*^O\210\317e1\254\001\364\256N\b\276n\021H\025\207\270\266-\361A\344;\326\f\205\310\205\353A$\254\337\001r\276!DWn|n=$h4\235\022\263r\347?=$f9\364\307\207\266\003\202\376\370|\350\315\261\031\341\303#\353\331\301\341\221\345\320|d63;\033\241C\223\375\314f4\331\352W\337G\233\302\312\213\241P\337h#\355\212F\3274\335\301\261~\265\nX\277\232c\374P2\304X\276?\333\307Zk\035\033\351@\344\253k\372\302g\b\372\212D.n21-\223\343Rb\236\\\255v\351x\224\326\023\257'\304,\230f\361\376\244\306\003\246_\304\004\244zY\365K\217\017W@^\317\245\245]\372B|_\002\241\205\312\\"
+	.string	"\003\267\021\236d\202Y\353\320\315\036\311\003\n\246\222\211L\250Q8F\0252\024\214\004\023\210P\230 q\341\240\002\221\251*z\021\200\251r\252\202!%\206m\377Z\350\373\r,\333\034\n>P\216\260L\366!\244\252@Z\302\374B|&?;c*\314`m\352\n\223\2213\371|\221+=.\nG\016\343\232\320\222Z\252\003B\226\267Hp\212!\20491U\374\306\251\326N\261/\371D0\345\337\203\353.\313P\203\231\274DD\346\211\210\203\n\356\325\271\241S\275\277n\247"
+	.ascii	"Yeu\034\324\354|\307\366\017\273\n\034!\226,{\343\202\nP\221"
+	.ascii	"\227\351\ty\243\323*\2612\007\022k\232\351\024"
+	.text
+	.section	.gnu.lto_mspFcProcessReadOnlyOutCommand.182.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`\226\002\005\023"
+	.string	"v!|J\320\322(\035\242t\\\214\333\201A\274\355l\033b\212:\342<\254\337\032Jk\254\306\317Ah\210\304o\036\3473O\355\030\334\366\304\b\347\312\r\210r\352ah\017\271:\220!3(Gn\330 b]\363{k\373\204\020B\344N)i"
+	.string	"a"
+	.string	"n"
+	.string	"\262\257T)\324\211\034\305\020\\*\363Q\270\362+\025\030 G\304\357\276\333\r("
+	.ascii	"G\257\366\236[\216\246\216P!@\320S\016\323$\357\273\331\364\334"
+	.ascii	"j\350\330\300\206i\212\265\f4\274K\356\240\003\037#s\307\020"
+	.ascii	"\356\303\027\\0\243\022\211\340h\340\330s\2468\357\024\006\367"
+	.ascii	"B\351hRk5\265\341<\334\"\267\215d\233e\323\226\377\371CS\257"
+	.ascii	"\251\351R_\344K31\035d.\304Tk\314)\244\366\302\032<\266cv\312"
+	.ascii	"6\270\273\213\330\2010\224\214\324\031oC\001\362\241w\344R\373"
+	.ascii	">o\021\373O\213\303ZG\370\240Q\353\316\200\007\220\017GN\">\244"
+	.ascii	"\007 >\264m\004\nb\226\225\320J\245\003\277\\\rFS\255\273\326"
+	.ascii	"\352<<HK\346\321\212\334\220Q\252\302\217@S\321\t\024\r\005\365"
+	.ascii	"\315\334\224'\227\022KW\224D\316L\334X$%\215\257\033\tvhl\342"
+	.ascii	"K\tN\211\027<fL\341\352\376\030>\025;\340H\307\265a\027\350m"
+	.ascii	"\276\320\217\242\336lK\0064A4\354\352\334+\337\"\206[\203\243"
+	.ascii	"\203\264d\366\230Q \366\256\244\253\263\277\347y\236\336\034"
+	.ascii	"\373@\377\030,0\224\205\020\341\001\212\353D\364\tK\005\346j"
+	.ascii	"YH\221\340j\235\254\300Z,\022\277T&\254\264X^\257\225VjW\277"
+	.ascii	"9>\357\340OFPP\312\227\211\006U\244\220\037\211 \"\360\227\211"
+	.ascii	"\2730\266wm\342\262/`\255\265\256Vt4\205\024z\033\335\363nB\333"
+	.ascii	"\322\341~MkC\\\350y\033\016:dT\253\373\0318 \020\003\021\271"
+	.ascii	":\217\030\277C\343\237K\347a\254\033\324I\342F\201_\324\032\367"
+	.ascii	"\350\307\br\025U\230L\340\305\034\302\224\247\b\263\253<\332"
+	.ascii	"0D(\312b\327/\267\375\333\222\205a8\246j3\200p\2302\250\366\r"
+	.ascii	"\314\032\234\341\267S\357M\316a\372\276\212\373\036b\034\302"
+	.ascii	"@\\1\316!*^B1Z>jOf\03275O\321\205\366"
+	.text
+	.section	.gnu.lto_mspFcStreamProcess.183.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"m\007"
+	.string	"\202\21644Po3\006\240c\353\255FL\221#\314\rw)\352e*\323MZN\236-%\306\227\331}#\323ElZ \343\252\216\226P\332A&[X\317p\311\2262\245\\\003\226u\030@\036l\333BW@/\316\207\313\246\247\343\220\315k\343&gS\355\203m\023\244i\333\324\200\367tI\252\305\002\022\212\344D\253h0\364\220\371E\376Z\210\210\350\257\b,\037!\205\364Z\320\213R\243\365\364\377\225\244V\022\204\2240\\j\371-b`\036R*\035\232\266\216\255E<\322\231D\242\326\237q\222\362\203\t=\310\230*\360\24625Y\2402\325\256]1\310\361\201\027\224\n\023\227\377Sn\270s\354j\227\330\372F\236#\300\302\377\306ot\341J\2675h\253\320\326#\t"
+	.ascii	"\357b\310\304\263\275h\300\005-0\344\022,\261\232\002\356\362"
+	.ascii	"\242\235d"
+	.text
+	.section	.gnu.lto_mspProcessInCommand.184.5e1c563b0ab476b5,"e",@progbits
+	.ascii	"(\265/\375`o\234\355\006\002z]_\267N\0200\346z\306\233\341`P"
+	.ascii	"0\376\332\210]\360E\353:3L\323H\232\246\007\202CU\215\353\340"
+	.ascii	"\331\262\366\210t\320H2\307:e\231\221\231\374f\342\323\231\211"
+	.ascii	"Gg&_\rr}\205\3376\335\200t5Z,Xf\330\215`\220-\245L)\245\371\n"
+	.ascii	"s\n\021\f*\316\215\250\342\334LX\234\373p\305\271\rK8w\341\353"
+	.ascii	"\334\204\257s\017\2528\267\340;w\340\322\271\227\25087\340\353"
+	.ascii	"\334\325\327\271\377\226\316\355\267t\356\276\327\271\371\336"
+	.ascii	"\271\367^\347V\242\342\334I\336\271\365\226\316\215d\351\334"
+	.ascii	"\324w\356\274\245s\343\2518\367t\351\334w*\316m\267t\356\272"
+	.ascii	"\245s\323\275s\317-\235[N\305\271\217,\235[\252\342\334F\226"
+	.ascii	"\316\035\367:w\221\327\271\341B87\221\245s\277-\235\333\355u"
+	.ascii	"\356\266\327\271\331^\347^{\347V{\235;\355\235\033\355\235\373"
+	.ascii	"l\351\334C\336\271\315\226\316-\344u\356\262wn\262\327\271\203"
+	.ascii	"\274\316=\366:\267\330\353\334a\257s\203\275s\177y\340\334^\257"
+	.ascii	"sw\25187\327\322\271\267^\347\326z\235;\353un\254\245s\003Y:"
+	.ascii	"\367\325\322\271\255^\347\256b"
+	.string	"qn\252\327\271\247X\234[\352u\356\250\327\271\241X\234\373\351un\247\327\271\233^\347fz\347^z\235[\211\305\271\243+\316\375\243\204s'\275\316\215\304\342\334>V\234\373\250\204s\367x\235\333\210\305\271\213V\234\233G\t\347&z\235{\307;\367\020\213s\013\2558wP\t\347\326\361:7\320;w\016\026\347\376Yqn\237\022\316\335\363:7\017\213s\357\25487\216\022\316}\343un\035\026\347\316Yqn\234\022\316m\343u\356\032,\316}\263\342\3346%\234\273\346un\232wn\250\b\347\236aq\356\347\353\334N\026g\231\3279&\204ss\351\f\023\302\231\271t~\t\341\354\362\3169,\235O\360:\343\300\342|\303\2123\215\022\3163^\347\026\026g\023\2548\333P\302Y\306\353\034\203\305\031\306\212s\r%\234K\360:\223\340\235_\2608\323\260\342<C\tg\031^g\027\357\034\303\353\334\002"
+	.string	"\316#xg\026Kg\021\204p\016A\007\316 X:\177`\351\354\201\2453\fK\347\016\274\316+H8s\340u\336"
+	.string	"\tg\r\274s\006^g\f\220p\276\300;[\340u\256"
+	.string	"\tg\n\274\363\004^g\t\220p\216\300;C\340u~"
+	.string	"\tg\007\274\363\013K\347\006\220pf\300\353\274"
+	.string	"\022\316\nx\235\023\360:#\200\204\363\001\336\331"
+	.string	"\257\263\013$\234[x\235Yx\235\013@\302y\205\327Y\205\3279\005\022\316\004xg\024^\347\023^\347\001\274\316*^g\001\274\316&\274\316%\274s"
+	.string	"^g\0228pN\361:\217\200\342,\302;\207\360:\243\030\341|\342u\006\341\235?x\235M\274\316\036\274\316,\0348\257\274\316%\336\031"
+	.ascii	"\257s\007\357L\342u\036\241\342\314\301\353\254\242\342,\342"
+	.ascii	"u\016\241\342\274|\235_\025\347\224\327y\203w\326\340u\006\021"
+	.ascii	"\302\371\303\322\331C\b\347\f\226\316\030\274\363\005Kg\013D"
+	.ascii	"8W\020\302\231\202\245s\207wV\2763\312;\237\274s\362\235\221"
+	.ascii	"\357\354\276s\373:\263)\316\377\316\235|\374\200\0314\211\020"
+	.ascii	"G\235\357\033s\356\\\2338\251m\221)\307jgj\207j\227j/j\367\321"
+	.ascii	"\236\324>\324\016\324\036\324\356\323\276\323\236\323~\243\335"
+	.ascii	"\331\335\244\273\261{\261\033\261\333\260{\260\273\332\335\327"
+	.ascii	"\275\327\255\327=\355N\353^\353\026\322=\2449`\356,V^9\220\246"
+	.ascii	"cU \317\237\311n\335I\302\251\232<\312\247\244\270\242\032\223"
+	.ascii	"N\376\324t\250\013\260N\241\226K\212\2120\331m3\201h\017\256"
+	.ascii	"\222/5\235)\003\355\264q\2364q\201\021:\235<H\222\335~\320\266"
+	.ascii	"\007\327\310\221\374\007+\2236\200\305\245Cx\227\354\326{\370"
+	.ascii	"Q\323}\254h'\216\263\237\\\\7\244\311n/\360\366\340z\021\f`\\"
+	.ascii	"8:.\351D\276\203\225\335~P\001\240\030\332\327\242\3239\206\302"
+	.ascii	"s\260\353p!V\006\355a\t\242%\035\350\003>XX\213`\311\037\037"
+	.ascii	",@%\347Y\203\"\374B\241\3438Xy#\004\254\023M\001EV*\243d\267"
+	.ascii	"\236\023\002\260\242G\302\034\311n\037\205\234N\2472\002\326"
+	.ascii	"9\247\323\251\264\311j\263v\313,|\206+\360\353\253C\231\225\334"
+	.ascii	"\302g\330\355jk\262\350t:\375\311\312n\335\311\304\"\032\354"
+	.ascii	"\233\026\314Jk\035\225\343\242\002\210\300\030\027\225iv]\223"
+	.ascii	"\310JD\027`?\217'8$A3\346\354AI\273A\344k\221p\353*5C\013rg\205"
+	.ascii	")\276\350%\334_ax[N\247S\t\310\312j\t.p\3529\273\307\317\032"
+	.ascii	"6#\351\307dm\"t:\235(\224p\363\261r\217\245\254\023-\001\216"
+	.ascii	"\202TN\247\023E\267l\202d\036w\022j#i\266\036\214v\3428O\374"
+	.ascii	"\034\003\t\235N\036\024\335r\t\222\335\372\321\nw\0337\336\224"
+	.ascii	"I\3429\346\334Q.\341\241}-\202 \331\355\231\320\334\020\2419"
+	.ascii	"3!\031\335\306\026H\023\262\330'4\307'4\267'\364\202\022\023"
+	.ascii	"t\033\263nGF<:0\235\233\321m\374R\251\237\321\227\323\351T27"
+	.ascii	"\032\267Z\263\261\262\3335&\353\024Z\3011\214J\002\311n\323\\"
+	.ascii	"~8\212\261\220\354\366\003\346&\267Y\237\261\222\231\2070\333"
+	.ascii	"i\343\314\201\211#\016\024\222\335r\013\271\241\235>\316\266"
+	.ascii	"Au\334!t:\307Pt\313)Xg\356\261\016\322l\262\023\244\\\340\244"
+	.ascii	")\253\201\"\331-\217%\371\235\271\004\025\315\016c\362;\235F"
+	.ascii	"~D\234\3161\021x%\331\255W\1775Y\246\00153>$8\346\334\230-:\235"
+	.ascii	"\316\024$\032\204\333-\333\036\334n\177\t\003\f\232\252\257\315"
+	.ascii	"\216u_\243\222\311d3%"
+	.string	"\026\262,\313\203\031d\360\241m\333%\177\263c\315(\230\223\315\216u\262\331\261\346\024\2242\335^\335\325\\\275\325Z\235\325X\r\244\257\332\252\253\232\252\247Z\252\243\032\252\237\332\251\233\232\251\227Z\251\243\375\243\223\032\251}\364Q\367h\243.j\036M\324;z\250\205:\250u4P\347\350\237\366\351\236\346\351\235\306\3217Z\247s\032\247mt\215\276i\233\256i\232\206\366L?\333\311W~d+7aGndF^dENdDf\302\207l\310\205L\330`<\310\202\035\306\201\274\204\001\271\312\177\354\307}\314\307{\254\204\223\260\036#a*\3471\036O\371\216\355\270\216\351x\216\345\370\bK\331\b\307q\021\206c\"\374\306n\334\306l\274\306j\234\306h|\306C\330\214\205p\031\223q\020\036k\201\205\002\254\240B\n\004@\341\204\001\250\020\200\t%\004\200\204\024#\210\020\002\212\023 |`\302\003\226\225\022"
+	.string	"\350\200\304\b\016TD\204X\276)\033h"
+	.ascii	"\342\203\207\fZ\f\203\013,\250\200\202\016J\224\223$\322m\331"
+	.ascii	"\357\257\036\353 .\303\375\354\366\032\354j\364\346\262\333Z"
+	.ascii	"\354\326Z\034\364\316\022\354\306\022\364\251@o 5K\274\257\270"
+	.ascii	"\230\254\270vT\371\216<o*\277\356\251\035\215\001\213\026\343"
+	.ascii	"\315[\016\244\250_\267\224\377\330yGA\261+\200m5\211@\252\271"
+	.ascii	"c\237\354L\316\205\236@\034\231\342\345@\212N\273\235\352\374"
+	.ascii	"\247\211E\342\340\341C\241pp\207\363\324\274y3E\347\272\227\326"
+	.ascii	"\224\260\304\242\032 \325\264y\377\300\212\252JBR\363\366\221"
+	.ascii	"\326}\224\206"
+	.ascii	"\346\335C\254\333H,\314\273\b\254\233\007\330\2277\221W\367\016"
+	.ascii	"\257.\357!\256n\241"
+	.string	"\032\256-\357 \0355R\336@(\206\306\276\270r\374\264\025\217\021\017\244\232'o\237\356i\036v\331\244\001R\r\223\367\216\343\350\016zx\343(\022\254\272\241\023-\352\316\251\341QC\344\215S\263\243m\324\020\362\276\261\251\301\341]\32345:\336\320\"\251\252\231\275\242\033\375\214\332\350v\326\330\250\251\341|\2756?>6[\2556\217\316M> %5iv\204::\264\211s\343\025\332\350\314\310\330\274\310\270\350\254\b\035\264\006:'\352%\t6#\252 \252\273y\313\201\224$\330\314\304\332,\017$\350\340\022\347C\300fCh\325\321\317\271\360\257\231\360\257\033\214\355\300w\265C\004R\215\2255a\210\215\257\031\361\234\007?\350%\3455\013&\345u\207\001\326<:\007N\233\227L\357\234\001\355\232\253vu\316\177t\315~ts\316}o\315|on\316{m\315J\332\330\234\223\2545\353\255\2519#i\203"
+	.string	"\253\250h\315yhb\316xa\315\32300\347\273\257f\273//\347\272\256f\272..\347\271\255f\271\255)\347# l\215}qI\243\232\215DA9\307=5\027yrr\206kj&\322\304\344\374\306\346@J\352\321\354&\002\t\332\303\310\271\215mM\004\022\224Gb\263:\220\240D\316j\216i\203h~g?uUCp\260\031\013\321"
+	.string	"\t\252\343\\f\244\001\0224\307\231\214\203\210@\202\342h\200\004\265\341<&\002\tZ\303\212\307\311[\320\343\271\262\261P"
+	.string	"#\253\257\360\330\304U0:d\364\024\032\233"
+	.string	"':\204_\\(\364\3248!\251\344\332X\210\344c\324\003\020l\025\202\201.\200%m\302\022@/\241\332\001\250\3769\t~\235\302/\317G\300k\021X\026\256\306#\255\307\203\307.\207\3248M=\004\366\202;\226\204:G\241\344c\327'\b;\311\344*U\210\344c\327 \320\365\007tsn\342\255=`O\274Y\361\2709K\233\257\224\b\\s"
+	.ascii	"\250y\007\035 \371\030"
+	.string	"5\t\264\036\201&\346\034\260\036\372\262\222B\020J\2336`w`\305\023\346*,\t;\352M\353\3618\261#~\364`l+\0360\027a\235\n\301\242H\333\336Z\217\307\213U\341dU\325~\\\276\354\3527\305\310\212g\3137h\346h\300:Z\253\220|\214\032\004\213\254\331\221j=\236(\026\205F\302\"\315\367\344\037\224|\240\332\203cg\3203P\335b\354\t\243\273\034\"\220j\256,\b$IK\032\257;\260\342qr\f\220.,`i:\367\305\210\344c\324\027XpA\324\261+`M\250Y\344\321\241\361FI[\361\364p\n:\260'\b\341\022[\217\247\210\005\261#\205\303\303\225(\035 \371\354\350\223\035l\335\201\025\317\220'\033\311\307\250\221A\355V\320sc\343m\353\361\030\261$\234N\247\262\247\306Yvit\227\243\365x\204X\026$IK\232\255=\247\207\306\237e\256\373\253\253{\314\033\273\203"
+	.ascii	"\3761\336\220Z\034\334\001\205\n\355\330pdB\351\201\346\354\324"
+	.ascii	"\334`\273\251\321T%\252\031\252\301\201\246A\245\240EFlkM\246"
+	.ascii	"\214\350\322\334\246\242\240\234\276> \325\340\271\335\025\224"
+	.ascii	"\324H<"
+	.string	"N!8\322\005\247\323\311\216\323\343\323\334d\315\214\201\n\346\336b\306\301!\323\021>\305\226\314\217\021\236\205&\031<\004\021P|\b\357a)\360\354\346\021\305\177\232c\217\023\317\034\363\303\002\211\001BB\023\201\\Y\201\360'\276o\036Ax\266\320\221\250\243\206t#>\370\266\372\340\375\317q\310D\020+\025\005\005\365\264g\342\331B\307 \017\2369f\210eb\252\370\021\261K1EmY\"\223\321\227R\324\003 \226g\216\351\301\"1\333\262\304\037>\216XD\034C\226o\2038\376\254<s\214\017\266(&\251-K<2\372\nd\226\tcy\304D\335\027\211b\032\321\027\273\203%\212Yj\212y\212r\273\375\300\022\277\302\0343\305\n\271H:\2354\003`6(\206SLU\262\304w\2160%\\a3~M\264C\343\240\004n\262\372-\024\361*\203\003\340\231c\260b\264\274q\222\325\357\340\001\360\031\334"
+	.string	"*\336<v\360\236\326\3508\342I|\003\366\006\316"
+	.string	"\373\332\271\232>\025\017\255\342\216\370/C\034,\233\322x\343\210\357\277FD\260\006\241\361\220\372t\253\210\026\316\3013\307x\305\200\361p\360\315\326\254U\230\\\210\217\262\262\372\266~\337:\365\030\212\376\272\317a\251\373u\337~}\"\310\2678\265\254\373\326\35778\253\276\251\210\261:98\013P\271\021\3610aG\270B\004akX\032\026\352\200\020\254s\3710aR\306\367\231c\312\376\221i\202sP{k\214\031\013\ng\337$&-\351(\201\230\265V@\333\373\255uD\363O\346W\374E\005\264\305\274\275\271\335\246|\3735\333$L\372)"
+	.string	"\205\t\275\033\300=\"\223\003\277\303g\022\023'\215\221\223s\273m\247\033|\373\327xE\245\371g\n\212\326\340[\312\2524\336\310\",\3114y\343h\360\375\327XE\245\371gZc\017\020\317\034C\367\202\314\021\277\344\003c\354\2461yyn\267\256\024\3047[k\200\244\261h\256\331\205\r> \371?\277>\276\024D\017\377\341\373\346\321\303\277A\032\1772x\346\230$\237$\306\261\20509\235\316\0010\307\354\275^L\337\n\034\363\367Hb"
+	.string	"=\360s:\235\003\350\226?\357\2511\201\334P\335r\314`La\241\333m\212\025\203\317"
+	.string	"\203\177\323\032{\236\272\331\272\233\024\257\032|\224\233\257'"
+	.ascii	"\306\367\341\202\377\"\237\303\f\203u:\221Zh\275nB2\277\362\002"
+	.ascii	"\374\213|+\351$1\210,~N\247\263q\230c\024c\030\275q\270\223t"
+	.ascii	"\006i\212\207\324\232\1772\217AA|\224)P\363\320\n>\322\251\305"
+	.ascii	"P\364\323}\016\335_\360\b`\243\177\301\264\257\375\201[\301\263"
+	.ascii	"\321\3461h\263\231\3374\347C\b\375t\337\n~\210\033<E\033#\250"
+	.ascii	"_\331\202g\346\034\330:\311\n\025&\247\323\211\302#\342\030Z"
+	.ascii	"\360\315\327\037\202(\346Qi\376\371,\364\3105\361\260\305o`B"
+	.ascii	"r\031|\224\273\221r5;-\226\301\337\267\320\301\247\n\276\375"
+	.ascii	"\013\241Y\035_\3017^?`\t\357\315\346\021\352Wv\307\006A\021\f"
+	.ascii	"\003\n\236\337\310Kc\034c\2541\327\230\253\333\255\267\341\030"
+	.ascii	"\316\370\225;<\005\337-@ej\274q:\274\323)b=O\203\240xu\301\n"
+	.ascii	"\216\362J\03329J\224o\266f\300\322]_\247Y\347,p\351S\221\365"
+	.ascii	"9U\360Q\356f\272\255\341\267?\202S\310=E\"\024\020\300\223\177"
+	.ascii	"\262#\323S\363On\231\374\311w\233\370\311G.\335\275\335<> \031"
+	.ascii	"Z\007\264n\r\377\313\004\223\022\277\023\037\2514\377d\362,]"
+	.ascii	"\242\225J\363OCGGl\020\022\031\251\312\217\362\006oX\202'\217"
+	.ascii	"\326 \336\260\302\222\255\325\377\034\362g\356\221\217\\\262"
+	.ascii	"C\361\252\247\350Ik\365-4P\353j\365(}uy\254\336\221\264\344G"
+	.ascii	"Y\345\355J\320\345f\272\026\\)\265m\325\277\334\3470\253p\367"
+	.ascii	"\231e\202d\206\274q\230\204\334\273\217\262Tw\206\374h\333\315"
+	.ascii	"\035\272\377\243\231n[\365m\331\022\3052<\032o|\255\252\276V"
+	.ascii	"\305e\207\276\331\372\004\251\354\217\306\033\271[\305e\237\035"
+	.ascii	"z\366\033!\250_\231\237"
+	.ascii	"\354\313\230\334P,C$S\344\215\323-\267L\221\333-\3731`n\\B3~"
+	.ascii	"u\005\223\270\261\037\345\t\270\377-ey4\336\310m\325\377gpC\227"
+	.ascii	"w\3638\343W&\301\331\034\317,\343C&\311\033\247\255zOK\304\242"
+	.ascii	"\322\374\223\377F7[O\340\212g\221\360\351V\3461\350\333}\371"
+	.ascii	"c\367\330G\231\371u4\273\360t+w+\341\272\202:\310G\301\370\303"
+	.ascii	"\032\003\347\276\266\272\370\275\030\247Z\374[\213\\OT\316# "
+	.ascii	"\374X\211ZW\252\267b\301\266O\211\021\017&\315t\247\370\251\f"
+	.ascii	"\211\210|m9\217\240\370\243\006\221y\337\304\357\324T\035\352"
+	.ascii	"\327\226\022\377\022\013\376\225\320\210\007^\022\377\217\273"
+	.ascii	"&T\316\243#~\037v?\214T\316\243\"~#\026|\001\261n\007?\021\013"
+	.ascii	"\276 (D\367A\374B,\330\200%sGr\360\003\031\271\261\330\303\357"
+	.ascii	"\023\347HG\345<z\034\374;E\350\320\276\266\234\316\034~\035\""
+	.ascii	"[T\316\243\257\301o\243\335\212\334\250\234G_\303o\323mK\306"
+	.ascii	"~\206\037\332l\316\253\320\225\337\311\202,\030\021j\265&\354"
+	.ascii	"V4\344\224\220\221\275\261+\315\357k\313y\224\310\256\330Zv\324"
+	.ascii	"\257-\347\021\023\026d\257M\2224\323-d7dA\226\311\026\022A\366"
+	.ascii	"\301\274%T\200\354K\246A6\250\234G~\354\177,\310\036a\262\333"
+	.ascii	"c\347\203;\031D\323cO\302n}\364\304\232\242\312c\247\262`\007"
+	.ascii	"\336\204\330\356\330\247,\330\036\001\022\204\216\275\216\005"
+	.ascii	"Y\030\302\302\021v9\026|&L\214x\254\020\307n\344\204\2509\"\354"
+	.ascii	"p*\004\347\332\330\335X\260\003JLPc_c\301\025G\346Dp\2343v4\026"
+	.ascii	"\\\321&\204B\b\273\231\t!j\020v2\026%\216\2610v1\026L\226h&7"
+	.ascii	"\231\005\273\006\t\210\366\265\345<\362b\377bA\030\024\347\224"
+	.ascii	"\315t\273\345bf\301\266\217\211\021\017\247\363\331F\334d\026"
+	.ascii	"t\034\247\323\351t\202\320-\033\364\255\021\037\017g\236?r?\253"
+	.ascii	"\343\337\354\346q\306\257,\202\2639\236YfI\246\311\033\247\277"
+	.ascii	"\317\272\243oU\204\214\2044\377d\036\203\366_\257\327<\377(s"
+	.ascii	"\377\365z\315\343\377\301\354C\315I\253\b\347dcW\233\223\325"
+	.ascii	"wN\206\275sr\353uNB9Ps\022\207\0075'u\334\2479\211\343>\315I"
+	.ascii	"\033\276\323\234\234\361\234f\344\237\337hF\366\271\263\031\t"
+	.ascii	"\355&\315.c/6\273\203\335\330\354.\351\264\3466\261\327\232["
+	.ascii	"&=\244\2715\354\275\346V\260\247\315\355_\3675\267~=\330\334"
+	.ascii	"R\337\271\025\322C\232\333\262\036\322\334\212\365\220\346\326"
+	.ascii	"\253\2074\267V=\244\271\255zg\226\261\r\233Y\305Flf\353\336\231"
+	.ascii	"\005s\037\315\254\225'5\263T\357\314*\211pf\243\2573\373\303"
+	.ascii	"\245\232\331\244wf\215^g\266\350ufy\270T3K\364:\263C\035\326"
+	.ascii	"\315\006\265\220fVG\223u\2639\330\371\223\370P\363\353\271O\363"
+	.ascii	"#\361\235\346\247v\223\346\317\353\306\346\307\353\305\346\237"
+	.ascii	"\266a\363\337\365`\363\333u_\363\327\365^\363\323\365\220\346"
+	.ascii	"\237\353!\315/g\302\371\217\274\363K\337\371\215\274\363\307"
+	.ascii	"\275\363\027y\347\2073\341\374o\357\374n\257\363\267\235p~\266"
+	.ascii	"w\3765\021\316\257\006\202\363\247\275\316\217\366:\377\331\353"
+	.ascii	"\374C^\3477{\235_\310\322\371\313>p~2\021\316\037D\204\363\217"
+	.ascii	"\275\316/\366:\177\330\353\374`\357\374_\357\374^\357\374]K\347"
+	.ascii	"\347z\235\177\353\235_\353u\376\254\327\371\261\226\316\017\344"
+	.ascii	"u\376\253\245\363[\275\316_\365:?\325;\377\324\353\374R\257\363"
+	.ascii	"G\275\316\017\365:\377\323\353\374N\257\3637\275\3633\275\316"
+	.ascii	"\277\364\316\257\364\316\037}\235\377\307;\177\322;?\322;\277"
+	.ascii	"\217\245\363\037\275\316\337\343u~\243w\376\242\245\363\363X"
+	.ascii	":?\321;\377\216\327\371\207\226\316/\264t\376\240\245\363\353"
+	.ascii	"x\235\037\310\204\363\347x\235\377\347\235\337\347u\376\236w"
+	.ascii	"~\236\245\363\357\274\363\343X:\377\215w~\235\245\363\347\230"
+	.ascii	"p~\034\021\316oc\351\3745\336\371o\226\316o\363\316_\363:?\315"
+	.ascii	"\353\374\320\327\371gL8\377S\204\363;M8\373\365\235\375\361u"
+	.ascii	"v\353\353\354M^gw|go|\235\235\361\235}\361uv\305w\366\304\327"
+	.ascii	"\331\021_gg\362:\373\341\353\354\206*\316^\370:;\341;\373\340"
+	.ascii	"\353\354\202\357\354\201,\316\276\244\204\263\003\276\316^eq"
+	.ascii	"\366\277\022\316\356\367:{\037\213\263\363\275\263\357\275\316"
+	.ascii	"\256\204\305\331\223\274\263\353\275\316\216\344\235\235\372"
+	.ascii	"\316\236\367:;\336\353\354\323\327\331\357\336\331\355X\234\275"
+	.ascii	"\256\204\263\323\275\316>\367:\273\334\353\354G\226\316.}g7\302"
+	.ascii	"\342\354q+\316^\344uv8\026g'\262\342\354o\257\263\273\2618{\333"
+	.ascii	"\212\263\263\275\316\276\306\342\354j+\316\236\366:;\032\213"
+	.ascii	"\263\237\225p\366!\257\263\233\2618\273\220\022\316^\366:;\331"
+	.ascii	";{\020\026g\037[qv\261\327\331\303X\234\035l\305\331\277^g\367"
+	.ascii	"bq\366\256\025g\347*\341\354[\257\263k\2618{\326\212\263c\225"
+	.ascii	"pv \257\263_\2618\273\325\212\263W\275\316N\305\342\354S+\316"
+	.ascii	".\365:{\024\213\263C\2558\373\323\353\354N,\316\336\264\342\354"
+	.ascii	"L%\234}\351uv%\026g\217\2568\373\217\022\316\236\364:;\022\213"
+	.ascii	"\263\373Xq\366\243\022\316\336\343uv\243\327\331\213T\234\235"
+	.ascii	"\307;;\021\213\263\357(\341\354C\257\263\013\275\263\007\275"
+	.ascii	"\316\256C\305\331\201\226\316\236C\305\331\177\226\316\356\243"
+	.ascii	"\342\354=Kg\347Qq\366\235\327\331q\2508\373\215\327\331uT\234"
+	.ascii	"=\347uv\034\025g\267\361:{\r\025g\277yg\267yg\257Y:;\215\212"
+	.ascii	"\263C\227\316>\243\342\354\317wv\347\353\334W\025\347~|\347\266"
+	.ascii	".\235\273\211\212s;.\235\273Q\305\271\031_\347^Tqn\305\327\271"
+	.ascii	"\023\003\257Z\226\230G\223N\260\230Y\315\247\024I\357\321O\231"
+	.ascii	"\376@zO\372\020{H\377\352e\201\3718\251b\206y\217w\037~d\364"
+	.ascii	"\336\343C\030\375\253\226\345Utv\0225dZ\364m\347\304\343a\332"
+	.ascii	"\334j@!\"\372\256fa\225`\30733\323N\224\232M+'?N\242\3145f\033"
+	.ascii	"\223\371\346\016\275\357P\322.\364>\364o\233\215\021T\350\221"
+	.ascii	"jYUF;\262\204\2324.Ri\376\231H\245\371g\005q=\216\030\ti\376"
+	.ascii	"I\0027(\350\273z\025\367B\007\334I\220\0213\035\337\322\034@"
+	.ascii	"\017\3036\310\230\303g\305\b'=<s9\276\343n\3740\372\344\254H"
+	.ascii	"\301$\302\t\216\215\2736\237o\271\023\233\236\207a\023\344\342"
+	.ascii	"yff\334\t\315\212\021\374B8\201\236\3140\251<\337\322\353\316"
+	.ascii	"C \220\016\2074iU\202l\303\361\255\330\3507\036\206\255\217\353"
+	.ascii	"J\007\225\346\237V\035\271d\242_\314\332\b\235o\271\303\234\207"
+	.ascii	"\200\334\020\016]\262p\311\036\3167\230\240\333x\030\266#\322"
+	.ascii	"\032\317\314\264K\0022\231\2045\276\343\374n\036\206\355\215"
+	.ascii	"\006\n\232\245\256\333\330\274[m\315\360Qf+,*\315?e\360\232\232"
+	.ascii	"\357\252\325\225\013\232iRo1\220\346;/\017\372\0208\243\023\232"
+	.ascii	"\311KNW0\233\304\254\215\360\231\357\303:\177>\f\333Y\f\356\374"
+	.ascii	"\2262<w\276[\355h\361Q\346\252U\320\025I\362\310\214\331\365"
+	.ascii	"[\032\367\3700lf#\260Z\277\253V?M\222$\211\324@l\362\r\327\346"
+	.ascii	"\370\020\0202\324\270"
+	.ascii	"\227\\[\241\023\263\246\3226~{\2411>\215\265k\223F*\315?\027"
+	.ascii	"\247\024"
+	.string	"\027\373\222d<\322\305o\272\244\230\342?\300\232\370\314\314\277$\0303G\314\232J\342\267\264\013\361i\2545a\024\"\304\273\263\013\354\023St,\232\31133\001\223WL\376\001L\230\2011;aT\350?\247\300\250\320\177\212\3400\232\234\202\331\321|J\341W\370}\370)f\206\257\002\341w\341\207h\2631\202\022\376\2536\205e\304\303\247vL\r\r>3s0\271\304D\032\374\266\373!\3700kx!H\006\006*\202`\31133\013\223GL\322%\337t\311\"\300\207Y\273c\254>3\3630I\304L\356\250\276\333(U\370\207\230\f\322\361\367\256\241T\236\33733\025\223?>S\277w\253R\323\276\344\316\212$\216\276w\365\244\354\2504\377\224\242\343{f&c\022\207\231\264\261\307\367\256\241\224\334\007>\312\254\222\356\275=\251\007\224<3\3231Y\303\334\222*\371\246K\316$y\2305#0\350\351\211u"
+	.string	"\31133\255\310\353#\022/\35233\257H\307F*\327\212\274o)\303\313\373\256JiQi8\200\367D&\nq\247x\337v\207\323\177"
+	.string	"\033\335\035\024Y\210\026\2636\302z\367\035'h\3670kl\\u5\310%\200\310i\335#\253R=\350n\220~+V\372\350\036\251&U\264\201\2172\362\253{n\356\273*E$g\003\231\244\310T\356\333\213z\344\0370dH\372\31409H\274\025\357\bs$fM\245\r\224~\213\035\331\031y\032kf\214Bq7\220t+8\230+\362\035\367}\363X\344]2)\240j\237\220\372\241j`'f\347\311J\205f"
+	.ascii	"\256"
+	.string	"\007i$\016\356\335\"O\212D\236\031\346\007I$\306\361M\372\366M\344\373\346\361\355]\275'D7 $\333\2125\267G\352=\035\266\005!\321\316R\246m\237R}*d\033B\n)c{\267\310S\336\032\021r\214\271\"\266\366.\331\323\024\003j\337R\206\247fw\201\264\"d\027\323\004\027L\323\312\026\262-\355\221uOr\026@C{\1772B\245\371g\005>\312\374\004G\201\263o9\373\256>\211Qi\3769\201!=\220V+V\252\220\322!\217\324{b\377\376\350$\320ff\337\325'.!>\220Q+\240\236\314\204\274[\344I\253,\t\311\264\244\344\217\337e{,\331\373\343\263w\220o\262w\021o\036\203|\n\331\323\325\3303\303D\221HL\026\230%\244\017\230&\016\3324\344\321\330\273zODb\317\f\363\204,B\022!y\300D\361\024LU\225\333mk\025{W\355i(\354\n)\304\344"
+	.string	"\251\003\031\004\203\245\005\303\305\205\030\246\001\331S\220\367E\200\255\373\361Q2\221.1\002\023\232\361+\004>\312\254\005\366\3140^\310\035f\022y\003\211\003\006\314\204\237\323\351\024\203\tR\346\202\275\253\346\204Uu\272z\300\327\267|}W\235\200\274\236\031\306\fY\003\346\fy\323v}{}\337<v}[u\352Q[b\353\276\023\373C\343\222\025\251O,1:\300\316\233\353\231a\326`\332\220\317\346\372\022\322\254\\\337\243O,\035R_\330zs\257\217[S-8\327\261\021Q\353\221dKvYq\256bb\326\273uKtXR\367\220\311R\350\032\302\310\321\301\330\331\271X \032\227\344x4\273\320"
+	.ascii	" SW0\020\310\267\206KbWyn\365\357\352]\275%0\253g\206A\342\362"
+	.ascii	"\255Xar\225\270{0I\366`\372`\372\334\266\252[\362\032jv\201\001"
+	.ascii	"0\177\325\245\036\324\252g\206\001t\251L%\215\333\326\221<\274"
+	.ascii	"\252\"\252@\327\016\210\264\216n\352\233"
+	.string	"\352\373\346q\352]\262%\"\251A\367\b\225\021\251\021\304\250o\251\250w\311\226\206\240\n]8\2508\"ofP\357\026Y\nzzf\230C\227\255\331\244\244qc*\262\246\326:}?}\337<:\275\253\266\004\324\204\350\236\375\200\033b\206\330\364H\262\245\237fzf\030E\227\214\251\244q;\"\302\334\244r\203\3000\266 |\\]1w\f\306\021\306\ns}\272L\337\210GJ\337K\217l\342q\266\200\217\262\005\255\342\266\322\277\2206E\245\357\252\022\243T\237PBT@\264+\253\371t\002b\322w\364_\263\037\017\003\322w\322\213hC\372\245\232\222\234\217\254\260\346\323\to[\217o\037\377N\217\036\006\243\357\036/b\317\350\227zJ\322\"\253!\315\247\023\020\211\276\213\3765\343\3610\354\370&z\021m;~\251\246\024w\001S_\002z\350\333j\350\275\252\004'\024ED\307\267P\020\320\267\016 \261"
+	.ascii	"p\325!\240s|\207\345\370'S\002;@\377\370p\231\352\244=\337?\237"
+	.ascii	"\262\347\303\363\335\363!\002y\376\255*y\355$\271?\364\002o|"
+	.ascii	"\357|\212\025\207\316\367\215\027a\246\363K2%\256\234\250{T\225"
+	.ascii	"\332\370\316\371\224=\234\032\3376j\374[U\322\272Yry4\r\333j"
+	.ascii	"\276o~9m\233\246\371\256\371\345\324\306\bJ\363)uJX\254H\024"
+	.ascii	"g\200\217rC\277\221\312\360\240\357jJW3P7\250Ys\242\204m\353"
+	.ascii	"N\007\220\331W\323F3\307\033\247g\036YD\251\250\2377\\\037 v"
+	.ascii	"=<\316\357g;\037YU\"\222\331qo4\233N\224\260Q\325\351\344\004"
+	.ascii	"\306\274L\314\267\215JC\315\036\267\006\024\335\215\215\025\346"
+	.ascii	"\2330\357\252)\0051\177\\(\323\234;\343>_\236\371}\363\370\362"
+	.ascii	"\255\241\022\220\31337\201\332\307\030\307\023%l?\344\230cp\264"
+	.ascii	"\326f\020\373\"\035Y\273\321:\266M\232CD\315\242\036\356\t\336"
+	.ascii	"\345[D\034>\207\367\266\233\307\231\023|k\250\364#\250\025u\341"
+	.ascii	"\243\214l\025\027\207oi\316\034qxWKr\354\333\323\321B\207\226"
+	.ascii	"\346\f\260l\312\302\r>ZD\035\322\031\177\303\247\354\321h\371"
+	.ascii	"\031\037\"\260\345\337jR\236\t\222\332B\243@\031o\202O\261\332"
+	.ascii	"\020\343e\274\b3\033#h\214_\222%MaD\333@\245\346\223\n?i\t\036"
+	.ascii	"\306\247\354\325\360\027h\2254\t\276\004\037\"\320\306\bJ\202"
+	.ascii	"\177\253IvHC}\005\370(\267H\375\342\305\273Z\022\035\rK\255_"
+	.ascii	"\263)\331\027C\325|J\341\247\345>\r\377Z\233\234\2719\325\254"
+	.ascii	"\362\306\231\341Uhg\313p\271.^\206\177\2556FP\027\217lL\222["
+	.ascii	"\341\243\314\366\r.\253\343_\310\331\322\3778%\211QU\370(+\033"
+	.ascii	"\t\300*~\353\324AP\364\337}\316\335\307\360-X\326\342ch%gnb5"
+	.ascii	"\265\274qZ|\0376\353x\004\375\347\237\0221\260\024\356\236U\374"
+	.ascii	"\r\376n\310\215`H\233\307o*\355\264\305kry5\301\300\334n\337"
+	.ascii	"\212cx\344,\236\271\031\244Y\346\2153\002\021<\213g\333n\036"
+	.ascii	"E\360}\330\033\220%i\341\375\324(\021 \004\317\3344k\351b\034"
+	.ascii	"G\310\265s\315\263\264\346\332\232\333m\203\340C\200\3222`\356"
+	.ascii	"\007\036\004\357\266\331XA?\360n]\022\021S{\221\2411FB\024<\320"
+	.ascii	"\326\306\025\221z\340[$\327+\fo\355\233\033\f\337\376]\255\035"
+	.ascii	"x\346&\\\273\266\242Mk\325\232Mi\263\331\201o\266\006\361wu\214"
+	.ascii	"6\273p\002\335uJ\205\016`\205]k\346\266\342]\"2\016|\013\210"
+	.ascii	"t\033x\346\346\264\035c\026I1\333\300\273@`\032@\344R\021Bg "
+	.ascii	"\003q\002\300@\027\327\\ \006\276\257Y\027\0204\301\002\026"
+	.string	"xO\273rQi\376YB\005\256\254\360\020+\360n\317\024\005\226\004`\002\023\250\"A\002PL\025~\200\355\223\022\344\236\004\276\255L\021\340K\001\001\b\274\247]\207Fx\3003s\233\324F\231*~T\233\203\"x\263\324\355\0269}\300\267\343\221\003\224x\324\265G\204\027\276\221^xO\273\3664 \257-ZAh\3051l\300\367\341\016\006|\013yC\013@\322\n1i[\300\267\334\021\315?\201\024\360-\340\321% I\373c\206c\230\200w\341\036\031\021\360\314\315\275\226\207\231d\2531\215\315A\0238\206B\036\001\357Jq\034\340\233\255{\251IHI\263\3245\300\267B\276m\230@\375\312m\331\033\340\273\260O\234n\034\363n\036\313\276\331:\203\277\307\020>\312'u'Z\352\267U\020P\364\333}N\277\335\367\243\006\324 #\024v\337R\337\303R\243\013h-\016S"
+	.ascii	"~}\255\rgsP\0047\020\307\320\205\357\274#\232\177\266"
+	.string	"6-|\023v\013DL\216\3611\250\321\223u\"\204\226\206\231\002jC(v\004\004\261\366\311T\301\364\327:m\032\305\244\037\260\360\005xd\266\022?k\337\371\261\360\255\304\221\251\202\351\217m\264i\016\212P\200W\321\264\270\202\021\261\367\277G8*\315?\021\231)\230\2300\024{3\321z\275aa7\021skE!B<P\341S\370F*\373\013\201\035d\366\236`OU\370\336\373+\302\"\260K\230*\230\233\200,`30\311Vet\232\203\"\310\210\271\335\246\360*\376\212\260}\254\237\214\0307\0247\013\233\207\315C\267[\002|\003\021kc\024\232\361\253\327\373\337#\026\313I\263\324E\341[\312\360P\370\376{\274\372\347c\325J\023\261\377\036\201NPd\221,R\363\334\266\023\336\245s\264\016\340\231\233\214\354\035\023\371\243\310\304\256\256\335\033\300\267\205\216\216*\344\216\020J\215\264m*\276\245sd\024"
+	.string	"\034s\205\251\351\310\022\211)B\376(.ys\023\200\242\tVv\315O-\315\204o\377\034\021Kx\346\346\225\035\302D\376(*\031d\226\341\301\232\305<[\020H\366\322\332\312X!1\320\232\230\033\033n\267\032\364\r\276\341\030z\222\301\240\022\337*n\t\337B\025\223\224\360\236\346\230G\302\007\340;\2605\320'\250\b"
+	.ascii	"\225VqI\370/S\324\"\341\373\317\221\316\337\034\345:xq\346\230"
+	.ascii	"\0331;\3368\354i\216XT\350?I\244\350a\277b\222\220\320D\252W"
+	.ascii	"WL\303\b9\264\244\310\241\305\003\3230B\bZ\\\320\260A\006\r4"
+	.ascii	"^\304h\221\361\001\3230\302\f\032h\260\200\221\"\206\f\0300d"
+	.ascii	"\264X2\r#\314\220\201C\213\213\031)h\3200\303\213\032B0\r#\314"
+	.ascii	"\240\021\303\005\f\0323n A\f,F0\r#\314p\021\203\f\030!h\321\222"
+	.ascii	"\242\205\f\257\213\226"
+	.string	"\033h\260\2101\303\213\031'4\320\230!\206\213\032\\\0270XH \206\026\0262Fp\022\303\013-.Zn\240\321\202\205\f7\304`\001\243\202\031-\\\314`g\274\250\241\206\0270\\\032\335\342\342\205\f/h\304p\021\303\013\224\031^\310\020C\006\002h\264\310\260\001\205\206\213\022\264`A\201\030/\314\240\321\"\203\0023\304x\021\343\005\013\030.Z4\200q\203\004\\\320`\321\202\204!#\206\213\004\270\240\301\242\345\304\206\01664\215\030.`\304\230\341E\r\006\220\321\3422\003\0059\310\030\301\277h\0270X\264\310\320\322\210q\203\f\004\324\340\"F\f\0264\264\350@cF\f\026\344\340\"\206\030/\270\250\341\205\f2Z(\320\242e\206\005.n\250\201\005\016\255\213\227\027\027`A\203E\f\311\026-3\236\002\027\210@\f0Z\270\334b\004\033f\300Ha\303\f\030)b\274`\001#E\213\226\031)F"
+	.ascii	"\3012lp\321\222\202\206\f\031-)\306f\376\007\367Y'\013\275l\334"
+	.ascii	"\274U\320-\3436^\237P\035\001o\3362\220i\031\367\223|\222\367"
+	.ascii	"\207:\235Ng{a\331\220v\271\n\323\r\227\2358'\241\345Y.=Y\215"
+	.ascii	"A\365\020\216j\323u\344\347\310\267\341!\030\327!W\006\230.\340"
+	.ascii	"P@/\216ETh\020\221\2530\021\271\024\035\016u\b\322\314\234\303"
+	.ascii	"\021o\222\211R\361\023\272\333\333\332\222\302\030\371\227>\312"
+	.ascii	"\023\333\231\026\233tUjr\351a\344Y\245\244\177#\357U}\242\364"
+	.ascii	"\264\246\230\364n\270Hm\231(\367\316\243d\2426\210\271\233.2"
+	.ascii	"\231\361k\326O\371\307}\222K\264\206\217{\224\247\2657\033#("
+	.ascii	"\341\021\\c}h\246\313\022}[\263\227\244\f\017\312Y\243w*\217"
+	.ascii	"ri\032\341\347\362\344\022\325\254\327\221\315?\371\003\334\263"
+	.ascii	"F,\321?\334;U\237$\255\251]o\036Y\242\367\251\366`hh\007\344"
+	.ascii	"\315e\352\355\333\320\220\216\n\355\023\206rW*\374\335\236\331"
+	.ascii	"\245\252\355\337\355\273\255\355]\317\020\314\027\r\275\254`"
+	.ascii	"\360\242Wr\217\272\221\013V\322E\313\205\313\260\007\333{Q;\222"
+	.ascii	"\377\332\263T\317\354\002"
+	.string	"\346\"\346\215\363l\317Z\375\257}\005\200h\2127\217\254\325\177\243!\221\332\263T\357\2017\217j\357?\372C\325ph\360J\255\372(g\240\253\247\222\326Gv\265T\207\033\375z\215\377z\357;\032\305\252\354\356\202d\343;Q{\223YS}\340\276\336'\255\337N\200bo\237\326\325!J&\312\204K\220\016P.i+\035\234:<\271\224\265\271\217\366\237\366}\363\210\366\276\243AT\007\021{\252\3101h\266sQ4wPr9\363\306a\022:D]\322\326\\\332\330\345\315\005\216\255[\347\310\325\311Hh\323\354\202\324GY\004\035S\274\206J\342\274\006G\246a\355\224\264\361\217\344s\036\311\267UY\365\332L\367\221|\022\347\375\2475\260&5x\266\247\205\330Qgq\035|\354\235\275k(\b4D\332\301h\310\273\215\202?fr\035\210\314\336U\023\354\021B\327A\210)\344]5\300k\3313\273\330u"
+	.ascii	"ZQ\366\255\036\240u\332\301\307%\257C\217\f=\027$*\032\344L\r"
+	.ascii	"\342\030\362\030\016+\276\206\372\200\233\304\361\255\231\\_"
+	.ascii	"\331\343\360'{f\227=\227>o\234$\216O\352\374\223\375rm\352\354"
+	.ascii	"\3461\251\363.\324\037\f\001\247eKf~\364S\220O\332x\017\354\240"
+	.ascii	"\323\254\216\377 \037\002P*\317\351\003\367"
+	.string	"\307\276\221\220\375\301\330\373OK`-\352jS\244\b\240\026\265\351\243|\262\243\227\2223\337:\365\027\212~\352\347 \365S\337y\374\360\264\204\232\211\372\311\231\317\340\tJ\361\305\302:\3400=p\371\353`\303\005p\004\223\022\247C\2156\261w\236\006Q\007\330c\252c}\366R\3303\273\004v\250a\252t\240\t\003\004bS\372\350`\207\347\222\267\016\316\353\327?\230\327\377\327\253\230\331t\275\3700\376{\361h\2631\022l\226\272,\330\263\214\357&b\240\326\365,\330s\375w=Rz\363\310\365)zU\305\337zf\227B\345\"S\211(\365scv\341Q*\272\034\272/\022\304\033mJDe\242\013\242\213\242\013\243\213\243\333\255\213\370[\337\205\237\365\257\365\310\247'\271\216~T\305\375\254\1773i_\326w\265Z\210\244OT\363\250O\267\376\300zf\027\253\222p0\020\353\335\306*\035\220gv\271*\227"
+	.ascii	"\"\021\201|\nYU\356\352\251\364\353\263^=R\255*\265\202*\225"
+	.ascii	"\254Hb\365\256a5\256\252FI\315\373\252"
+	.ascii	"w\033\253pO\365\314/7\312;\346\n\223\262Ni\367b\343%\347\345"
+	.ascii	"\306\313\215\247\252\253\212\341%}\224\271z\20545\365]\255\006"
+	.ascii	"\371\220\332QJ\215\004J=\262\261\0171\252G\tG\304,\352\221E\372"
+	.ascii	"\016\241~\224mlV\250OQ\353+|\002R\246\241!\237\362\234\202\224"
+	.ascii	"fB\234\336\325\353\2336\r)\203\2145=\262H\037\335\021\023\223"
+	.ascii	"\264\307\022\221\362\313k\351\335j\037\234\221\222\322{_\030"
+	.ascii	"\225\346\237E\037e\356\333\242\322\374\263/"
+	.string	"\253\017\213\307G\231\305\321\037\215~W\373\206\210~\024)\257\254\222\376\177<\262\355\221\376\223~\031h\323\005\365+\347 \344\343\037\351\337@\033#\350\321\277\217\243G\352\365\001\365\350\241\224\212B\366xd\221\276\037#\037J'\346\210&\243w\213\364\365\354(*\372\256\362\r\361HRF\177\360\370\326\220\317\221(\252\364\261b\304Q\273G\364\255!\237\320\357\370\226\035\337U>\305\241%%\017&\321\320\273d|\210BMJ\241\240@\241g\033\371\016\203\236\2249~\244A\317\352\361\025\352\210R\362\254\330a\003u<\333\310\227\367@\317\3742\245\324a\252(q\2249/U/W/X/X\017\3047M\013\312\361\314/Z\312\033\231\252\025\033\263\376\237\377\034\3377F\240\377\363H5\2768\035\357\363->\337U>\270\357y\346\027.\345\f\223\003?\245S\371|\361z\001{\021{\021k\373\236:>\256!\315."
+	.ascii	"\361\004A\2616\t\334\371\347\331\371\266\221\257\007\2162\024"
+	.ascii	"\306E\353\215\177\0347\336U\343+\3221CA\334\300\312!\n\223\227"
+	.ascii	"\263\264\227\2655\367s\376u\276o\036s\336%\343#*k?R5\226\343"
+	.ascii	"\2432U\356`\373\314!.2\371\301\t|\234Oa\016\221\313\306\003~"
+	.ascii	"\333\333\370\257K\0227\326\315\326(G\212\234\214\204>5\374\372"
+	.ascii	"\376k\274+\275yt\344\337#\373\236\371\345\355\005\316\033\347"
+	.ascii	"o\336\325\013\033\242\326\374\223\254I\367\274M\034\212\222\025"
+	.ascii	"!$y\233w\365\302~\334\307\225\255y\276\346\033\251\346]\315\353"
+	.ascii	"J\363\310?\232g\353\274\254\320G\366\275[o\036\037\372\254\232"
+	.ascii	"\227\343\317<\363\213\024e\312\364\200\311\016\345\356E\356\205"
+	.ascii	"\356\305\316\316\355\266\r\374\231w\034\r\242\321\213\221J\263"
+	.ascii	"\003\327\377\234\376\363\273\352\245\350J\372\204\327!\016/;"
+	.ascii	"*\364\2377^\362bv\274\216P\241\377\324y\363w>\363K\222\227=F"
+	.ascii	"\211C1\322\254\351{\371\373s\273}\347\247\340\306$G\246\312\365"
+	.ascii	"+\243\274\241\020\221\251\002|\t|\tt\273\365\353\247\340\306"
+	.ascii	"\244q\222PU\353'\241\332\254O\303M\220\353\253Oxi\331h\362k*"
+	.ascii	"\256;\2767\371\276\311\201\306|\031\224)r\374\026\267%]\243\210"
+	.ascii	"\361\331\242!\214\217\203[\337M\237\360*\2729\363\347i\226\272"
+	.ascii	"\314/\207/\210^@T\032\233\037\212\317\376 S|\034\334\224\320"
+	.ascii	"\364\t\257\236\032!\316\374\302\370\342\330\225H\205\376\363"
+	.ascii	"\305\332\205H\205\376\263i>\372f\315\362H\032\276\220v\304gy"
+	.ascii	"\240\204!>\016nw\217\323'\272\n\251O\267B\231<\363\313\025\345"
+	.ascii	"\213\211\342\205\310\344]\262.\351\34133\237([L\224,\024-&\264"
+	.ascii	"\206ys\343v\353\266\035\276[\327\345e\370\314L\033(WL\017\374"
+	.ascii	"\362P\254\f\r\273\252\b{\306\013Q\244\n\277\0047\263~\022\346"
+	.ascii	"\240@\241<%\276\023~\263\365\006f7'L\335\276'\276\233\250\323"
+	.ascii	">\370\255\013\276\017>R*\370)z]\355\f\f\374f\353\306\021'Fe$"
+	.ascii	"\224iz\343\273M\237\034\321\351\031N\301\204\320\311\260\317"
+	.ascii	"a\366%7P\226\bq\224\242{\200\357K~\211X}\007|\025\253\215\021"
+	.ascii	"\264\372!\032\265\030\377vP\220\226\330\360q\264\364{\377\373"
+	.ascii	"e\337\273\337s`fc\004\355{\021dZ\212|=(E~5x\020\205\275\363Y"
+	.ascii	"\265Y\2411\215\315\2172\f6L_|\207\366\311\021\235\340K\b\235"
+	.ascii	"\334\372\234\275w\033%\357{\377No\036\225\374\262\252\205\230"
+	.ascii	"\344\231\231?(B\315&\n\214\f*\361\032\346\2270\224\240\346\223"
+	.ascii	"\262:\265\326\344\313\351t\242\320\207\242\203\t\304\fb\016%"
+	.ascii	"\267\336\223\274?{\001YmM\312\372\316\036g\374\n\243\263\350"
+	.ascii	"B\256\334\230\256\367\016m\027\322\001\344n-\311\037\2157\352"
+	.ascii	"\375\033x\363\210\344\227\215Z\207\356DH\350;\365\221Myg7\217"
+	.ascii	"H\350\373\263?\350i\275|\224=/\357\273\252e\347\202W\204\302"
+	.ascii	"\263\203'7\355\201\242\223c6}"
+	.string	"d\021-\351\235\017\224\032(7w\2174\324\212\313\301\355\354\276\331\032\203\252\026\330\tnp\031\277\255\322@\321\237\227\347a\210\215\017\207\274w\031\337C\323T\256n\f\005\332lZ!\te\006\345I\367^\367H\353\334;\335\207\230\373\266\266\017\221ii\275\005R8F7\310EO\036\255R\271w\365\264\256\216,\23542\031\217<RM\253J\372\314\314\246\223\304\025\210\201.}\267Q\253\007\r7b\344\273\252E4#\356\351\244\260n\n\367\036\367\310\300\"p\237R\325\n\"\022u\022Hu{'\362)fon\377\222i\001\265=3s\352\344\357\205o\355\275\355S\314\330\326\376%\323\372Q\253:\331{Y\202\366\256\366)\3234\264o\266\366\241:\255\236\026\033\334%`(\372\361\360L\200\367\356\222\3013\262\023$\315\246\002\370]\235P\363\254C\336\317>\245\315\354}\310\207\220\232};\266\017\025\311\262\332"
+	.ascii	"\366?\370\244.\206;\370m\265\303P\364O?\347G\377T%\007\216K\306"
+	.ascii	"\364\335\301\367\320d'\347B\204\234\3345\233"
+	.string	"V`bb\235\3301\265<\360\253C\356\225\275\013y$\"\331{\331/\255d\337\214\355B\215Y\212\033 1\221\212\321\372Mu:\354\177(\203\004)\2041\306u\"u\206\275\217}\212T,\354\337\"YS0\257\0238\233@\257w\260GZ\277\334\353S\032\263\354\274\353\231\231`'mL\235\346S\n\244\325\267\336\273>\245\315\271^\005\327z\337\372\020R\327\372\267H\026\235g=3S\354$\215\231\243\371\224\0029u \357Y\217\ft\254W\301\257\336\201\374\022\361\352S\f\263\344\254\202\234\230\361\230R\275[}J`\025\325\277\325,\351T\331I\020\244\275\250\367\251OA\224\212\372\3270+\016\352\231\231f'`LN\357P\2372}r\372\267.\013\256\311\307\t\027S\312\227\336\233>\305\314\231^\005Wz_\372\020m\256\364\001\212\307\250\224\243\025\312\n\254\343\222\224g\035B4$\204A\004A\001\243\030"
+	.string	"\f\005\342DQ\325T\236\001\024"
+	.string	"\031P\222XTJ6\026\fDy\214%z\2163\023\020"
+	.string	"\212 \b\254\203\260\210G\315+\t'G\311\223G\037\023\311\335\032?\340"
+	.ascii	"\005\371/\177\274\3773\307\361r\302\233\317H\366&\003.\331 \224"
+	.ascii	"n\306\203\316\b\313\n\r\006\256\243\024^[\253\254r\275m\265\325"
+	.ascii	"\246\331\326\nY\332\272W'\245\246\344\013x\362\024\301\202\005"
+	.ascii	"!\311@\326\033F\260A\32056]l\222\220\n\255p\b\262S\314\r\263"
+	.ascii	"\256i=B\230\177]\266$ \023\220!\265<\023\334Dl\344\354\031\246"
+	.ascii	"\027\016,\326.\223\r\235\024=p\360\273\351\364\252\213\222N\263"
+	.ascii	"AW\f\344\306?q(\241\230\353\207D\001\221\265\364R\317n\021\t"
+	.ascii	"\016\364C\3361p\273\232\251\370\372\353\330\22503\330\333\304"
+	.ascii	"K\366}"
+	.string	"\002\032o\343\270\232\024B\365\313\"\224\3525\241\250\032\230\302\005JbYT\"\207Q4\256\221\244\335\311!\273VU\371\2215;`:y\017\326\027?J\027g!]\250\023\016.\004\360N\351P\265\255a&\227b\245O\371\277Nv.\361\207\013\335"
+	.ascii	"\243\342)T#m\032\250\370|.\002\027\330\n\356;\211v\3404P\033"
+	.ascii	"5k\205\221n\245\326\315\\\337(+\tl\220+\370\211\351d\016\\\250"
+	.ascii	"\3754\006\004B\317\212\233\305|\364\214\305d^\314=\001\271\202"
+	.ascii	"\347\334n\343}G\\\003\021U9\332\254\364\205u8\266zhi\237\334"
+	.ascii	"\327\023\033 \224Q@(W\322\002f\356\216)\213\3502'\201\205A;\274"
+	.ascii	"'\332\036?z\321\257\231\313Ja\215\213"
+	.string	"_\300\365\313ip?\236l\262\342\032\321\320\200\003RS\327T\203\245\017\305]UR./\271\234\272\276\364\235\205+\251\3379\366\206\317\261K\277\2763\013\300\356\371\022;w\333\352Us\200\377M\321\300\317\2507\001\3200\230\030.I\231\2514\300\300'\200\216P\363w2\016\326\247\027:\331\367\250\337z\206B\321Kw\240l\017\262\365$6'\347\240l\366\034`-\342\003\007\252\203\025i5XY\363r#Y\267\030Jk\026{\247.\362`t^\356f?\333\313\005q\212\324\310\020\235\251[L\305Q\264\374\264\022\022\234\266\227C?\002\353\266\240-\234^,\300\271=\033\356\204\033\016\001\311\007\243qq\355\225\006.\3433\310\343{\354\364\206\240$\351\021\221\277\351Va\006\272q\rm\027\2249\351pn\232\213r\001\332\214fV ~\335\320\346\261q\276`\312\361;\244a`\207\352\305\271\222\005zt\225\212"
+	.string	"g\366\332O\373(\321/\032\353\264\254\t\026-\356\324x\277>r\222\325\031\315{~tZ\213S\371\373P\300E\027\242e\\\211\026j\305\206D\344\360\n|\325R\226\230\275\034W[oYJUXK\336\330\330\022\\\267Di\340ZrE2\361\027\367\233\233\217\257Y<!S\r\207\355wVH!\375\202l\022\3349\212J\222\255\213\243\353Z\224\274\215\230\013Kp\314\244&\205\237\203\2543\344L%\376G\226v\317\313\334\243\255\224\270c\202v\370"
+	.ascii	"R\363S\312\315&\007\302\320\346%\232A(\204N\246\304\241\3133"
+	.ascii	"\275D\312|!{fS0\374\262\222\360R\225>\2401U\342|\023\222\213"
+	.ascii	"q\272-/W\251(\266<\017\253\362\264J\201`\3507,\257\270s\217?"
+	.ascii	"i\351YsD\335\263)\021\354n\277\327\346\370/\247\306(i\n))+\207"
+	.ascii	"\263\336<\n\027\203\360\325"
+	.string	"\333d\377\365\302iP\261\016\t\243\006\345\303\326,\214\265V<6\023C\303\036\277\361\266\2068\032\363\235\032\257\264\316\251\213\344\207\n9\314\357U\360\351\376_\210\364\304\331\\\340\255\241\203\f!\013\246\301\tQ\225RJ:\372B\371\365\371<\274\375j\273\351\026\023\372\226E\024\351\271\3612\034K\210\202\326\333NF\221\266t\204Ph\027`G\027>\177\305\30686\302\214\242T\007\270\372\0173\2271#F\354ag\354LEe\212\221R^\306?\220\326\211\221z\371\206R\310\337L B_[\326\243\023\343\005\3123\034\035\212\232\324\343\222\033\003\276\340\023\362\020\321\026\372\005\222}K\b\202\255\330\2023\30314J\322\226\n\210\177\f\236#\227\374\256\212\370\232\303U\260\037\205b*E\374Bi\211q\356\376B\273\370\262\326\002\323\274G\307\001\234\222n\\=\344\346\310\\\205\344\212W\273\204\003r\204\211\326\320\273"
+	.ascii	"9w^\260\376+&{\2171\337\277_f\371:\305\314/\351\t\251\303\273"
+	.ascii	"[Y!\246\347qFxb\213\027A\002\337\355\230\005\232\230\276\262"
+	.ascii	"\344\223\346\025\202#\232\303\fQ\033\240\323\250sjQr\032\237"
+	.ascii	"\211\255m2\002\226\001D\322F\f\220\214Gt\264K\n\214\025\n\270"
+	.ascii	"\257\261\f\0342M\203\333\313E\322\245\261CJ\027\006d^+]\021A"
+	.ascii	"\t\373\244\261~\t\203<fs\362\250v\362p\221\307\202\b\226\016"
+	.ascii	"\206\f/\2647`\030T\303\030b/\002\242\bl\t\002\253$S\277\304\374"
+	.ascii	"U\0208\030\345\324\300\003BZ"
+	.string	"\236OI>\217\3747}\304\361\344(Kb\302\265v\305x\376\320\bM\273\211]\272\200\247VK\377O\227\302\321\370\377\246\204.\036\3044\311\220\026\006\271~|\345\022&;=O\b\336\206v@Mel\003E\213\213,\334[f\355N\331\205\327\327\202b\021\241Uu\005\024d\306,\363\353D\265\006\340\t)\237\255'o\017*\241F\026F\250+>\360\025\217\261\216O\373\274\023\361\031\263h\024\374\364\245\206U\251\030\330=yu\253\244F;xn}\254\200\037\271\003\023w\227\305\256\340[\374\246\250\224\300M&.{)\334\323\bf\347\320\033\001e\363\031^\n\275\nR\2455J\256\244Fe6\320\036\271\320\211\211\354\250\324\177\314 +/*~\224L.VF+\310%d\254\346F\210\377\304\302\214\247\224\007\317z\277p>Y\347\227bt[\276\361V\251\344\350\025\2774;m\347k\210\037\311%\273\273\343"
+	.string	")\350(D\211\257\032|2\342\320(\006+f4\023\372$\202\247\013\275\350\016\363p\3563A3\037\347\254 "
+	.string	"t\277F)\206q\271Md\214\300K\206\365\b\310\251^\031\311\230d\006&\247;\313\013\267\251!\367t\246\341\367\244\316\bf=\f\354\032\201\241:\204tM\355\370 \302\245\032\360\353\356?\255\255\022i\241\nk\301N\204\272\265\031Z+t\346^2z\001\326\234\301\016\027(6\322\326,.\024\007\200\277\361\034\314\274W\330\321\241j\354]\r\237\361\333\345r\205]\233N\200\357\001\235~n\236g'\036}\035\300\033\360_q\003^c\364\"l\017jv@\303<\251\264\342\020\215>\b\336\232\353\025\343\3228\007\232\210\005\237\222\\j\230\035\234f\307\235\314\206\354\256\024\324`\013\326\325\360\262\270"
+	.string	"\304\275\365\252}9\275\337\363\230\225\025\221T%D\373\330\t\n\272p\224\214\337\367\004\232\035X5=\323`\300\236\304\032\201\241\005\326\016\t\027\326\343\306#\254\346\322\261\220\356f\315\371\277-\212\t[d3`\202\250E\323\021\360\025\016\202\305W\244\226\331\rM\366\021\026\215x\311\202> KX\245\376\203\026\223r\363.T\254|h\224\367>\206\202"
+	.string	"\004U\366d\326\016\243,\332\333\033\242\360*\017\350v\243i\223\204\363\251\330\034\226\303A\200'2\361S\210\351,G\246\357\371\374 \357!\301\272\330\215\233\216B$p\3655\243\365\301\345f*_%\314\225mG0#\201%uz\277\264$\323wPJ\363\"\241\206=\241\330T\300\332\374-\323\b\225\340|R\026\256\260\246\210#x\030+|\340\222\005\322\205\324J\344\362\307Ek\357Ge9V\301 Yh\250\216\245.\241](\230O\366\023\017\226\201EZE\2204\226\367\236\261\216\372A\222\270\260\022\242\035,N2{\240\227\2543"
+	.ascii	"s,\005\003\255 ,\325<1\224\227\326O\201x\351\243G>M\263\313\230"
+	.ascii	"\022\317\325\202\366{n2l\020\274M2\313\005d\021\354\324\302F"
+	.ascii	"\314 \345k\201-\216\350\324+\304\361\\\232\035\001ow&\b\303X"
+	.ascii	"\221\357J7\026\240\251c\266\"!-\313\254\277\304E\252d\222z\374"
+	.ascii	"R'P3\242\362\373V<#|\2512R\002\257z\317\220"
+	.string	"\362\360\334\215,\316z\256x\257/g\377\245W/^9\"\263\302\333\352v\324\205\236F\360\177\275n\371\233\"S{\033W\311\321\320\363<m\216\275\323T\247\246#k\222um\207~C-\245\005dH\275;\312:\353\231j\263l\037\022K\021*\361\003\345\002\251\267\007Q\337\033rb\367i:\036\240\231\001bT8\362]\202L>\f\340\036!\0361>UD\275\270\0133\327B9"
+	.string	"\233.\300\206\256aVg\263\005\002R\fr\323525I\027\347\307\301\203z\033\0230\233#x\317$h98\305\236\327YJ8\031\3336|\"\255um\243\b\3350\372\252\210\311q\246\002\321\177\2067C\270\323\221|!\022\211\034S;J\202\3219W\317\206\323\326\331D<\333r\367ez\360J\310\305\232\307\004(\371$\341\240=\213\002\275g\254\374oY\004c5\345\200\005f+\024\t/\376\333\301\205\366\025#\232\034/k~9\005Q\320\034(\214\030\350\204\234# \316jO\f*\026\222\363\312.\361\362\214h\201\b\271\364\312\305\215\275\021\245\027<\274\b,\253h~u\206c\371\211\201N\031Di\364\017/\324\363\355\342*\346\007\271\230\343\002\326\351\261n{\177\251\020\217\351\276\234\031Sk\324g\315\364\245`\2475\264R\3315c\020\016"
+	.string	"\236/r\340x%\237o5\b\341\210\305\221\254\364\2459\"\211\020'?c\025\f\250\231\360\356\243?\013\337\352\262\342\311\256\225r\022\233\204\027\226\310\256\036\312\257\343\333\227JR\207J=v\256~\020\301\327>\023\020\367'\244_\313\227\023Ys'|1\303a\205\243+\353@1\302\304\252\303\003\257@\212\313\021J\320\270tZ\030\233\212\026[\374O\202\256\245$bO\304R\bX\020\202\005\303&\310\300\312,\021\265\256RSAM\376\t\252\0255\002\234\271[\0303\007\365i\3014!Z\247\312^\200\342\027;\254\200\n%\034\261\263\213\324_:\300\251\332\335J\361>\244\005\252k\264\001w\366\233\b\272d&?\021\304\311"
+	.string	"\271\210\303\330\305\343\374\302"
+	.string	""
+	.string	"\275\300\002\300\215%x,]\024\t\313\305\005<\026\355\234N\214&\304\2067|9\3360\034D\005\256\213|+\032!r\t6\024\217\372\225x\017\344+}\037\017\031\206*\230\356\b\245\n\036\203A"
+	.string	"G\214\n\027\344}\242OEf\272\264\\\"\243\252\025\261\2571\3235\256\240\013!\222\332\267>A\316\244\306\n\324\341\357\312\305b\n\253\307\321#Y\177\023\341L\366\264\326)\320\345\016\021\262\331\320\211\030\303\203\227\370\214I\f>!\345 i\253&\207~\272\027\225\311p0\265\220\366\035\325\2745q\277\013\265X\005i#\001\253\271\242\344\270\006\262\023\211p\334nFnU\256nR\364z{\203\317s\362;\244\024u\030!\374\205\322\024\034\250\212\017G\356<\263i*\254-"
+	.string	"\220\r{\301v\200 Y\262V\025\323\253@\\b[)V\224z0\347\243v\025\310\017\211\2026#F)I\377\302\344.oE\352\376G\240|\026\001:\034\216*\325T\303\311\350\016\"\362\342\341\020\360#y\342\027B\334\317\221\362\255\237\314\025\226X(y\006\357\3448\t\272G\272\026*\240\235F\206Q\"\001&\244S\246\244\277\211n\n{\236\365\324\332"
+	.string	"t\021\214\315\252\2470\262T\017\227*ym\262\364VZ6\2577\3138\372\327G\350{U"
+	.ascii	"@\240\003\261A\352\221\355\2211\256`[;\023\231+ \376J:\3634\243"
+	.ascii	"\252\262^?#\322\210\036|\367\255gy\233L+\003U\354\377\234\275"
+	.ascii	"\253%\301\251\033\327U<\016\022\032\354\276\242\242\f\3148\224"
+	.ascii	"j\277| c\033\232\227\001\245\220z\021=avm\341X\273\205)\214s"
+	.ascii	"E\231iQ\212\372\343\305\3124\274\346J\001\235\243\004\005\030"
+	.ascii	"\242\025\270\016\233\003+\224\366\007\204\250NMjJt\322\037\252"
+	.ascii	"x\245\210\006\003\375\372\340C\357\240h\245Y\325\037.\334v\243"
+	.ascii	"\360\265/l\3310p\310\221R\262\220\034\222\267\001\005\177e\202"
+	.ascii	"\256g\330\236\315\211\245\351\353\274\030G\343\304\031\tH\033"
+	.ascii	"kZ%\240\316\216\035\340\005\200e!f\326\312uf\275|\305?\260\321"
+	.ascii	"=\001\230'\352I\245$\033S\235c\312\320\026\026\355F\006\240\320"
+	.ascii	"Dc\300\367\234\003\225y'\327[\247\272\276\027\2267\370\344\246"
+	.ascii	"\004zH\326\033i\335\002\244q\212\016\017\344\235B9\345\220\031"
+	.ascii	")\263 \210\373\022z\2541Z\f\352\002\265\n7e\211\245S\364\013"
+	.ascii	"k\330\250\nP\300K\360\001\373\177r\372\017\221\340\0078M\377"
+	.ascii	"\030\b\330\3465\006\364\3208\364\236t\fQZl5\376)\236\035\315"
+	.ascii	"\362\3704H\005\206\002'\004\352\307\252OTt\212N\213G\353ILq\270"
+	.ascii	"a\363\261>\027\355\003\021\201\343\367r*[J\223\240R\035A\036"
+	.ascii	"\022$\242\200@o6\310X\250_aP\3576\351\221\326s/\361\007\276\207"
+	.ascii	"\003\235\201\250\255PDZ3\315\201\315\231R\017\241\265\254\334"
+	.ascii	"\335\367\233\274\b\256?c\260<(\177*\032rZa\311\0304\232\251\215"
+	.ascii	"\274\307\223\023\311e}\207\242>y\275\201\311\372*K.\225K\027"
+	.ascii	"i\310x\374\212k\327 ;\2576\325~\334\266\340\257\354\303\327\374"
+	.ascii	"\236\322\347\250\271\237\bx\232{\301\304\354\212\240K\213\351"
+	.ascii	"\336\353\216\260\272g\270\320\204\323\210)o\n\253\350\273\275"
+	.ascii	"\343\231\316\236\027;\360\205)@u\211\344\262(\nK\265\204\225"
+	.ascii	"\205\271\313\241t\234\006rpj\257o\"\330Gk\0069\265\205\301r\006"
+	.ascii	"(\364\241\350\004\022^r\013:\221\361t\202\367\335\bh!\0076$\337"
+	.ascii	"\237mB\3758(\305F\3471}\254\206\366)\306n(\201\235*?\245\352"
+	.ascii	";\364\021OQ\035\230N\273bh\016\371\253\311\374\363\177\236\337"
+	.ascii	"\235[\233e\352\340\306\f\333\034ZVZ"
+	.string	"?\327I\003~\257\026\310\275\204C\371\270\031\336A\324\016\255*{\310c!.\027\265\347\225\332\354Y\311&7lJ\001!#En .\354yP(]\231\216d\361b\"\0278\371\261\245#\303E\214\244\006\226P\317\333\360\342\227\307\323\325e[\2275\f\377\327\355\321\364A)\343\321^\210+\304\370\215\215\fH~\313\236\231 \251\2447\0077\346N\310]\003\301\343\267h\2726\343\230i\211\026\013yY\321\225X\263\341`\271\016\302\302\350/&\257\231\203\310\304\001\230\3260\247\211\371\3176\304\036az\3302g\303\257\025$^\323\311\n\334\256\205\256\007=VY\363\331\022m\203\306Y\264\211\026\030z@\324a,1+\330`\340\343\"\373\217\241,\305b\324s\211\206\020\035\035\243\026d\3736Q\215\312\030\353\016\020}o\332}?@\236:\221$j\222D\315lF\305h\2460\314go;0\341\321R\200\311"
+	.string	"\202\2722\347\253);`\322\030\232\214\301\003\256W\350h\356=\244)\346\230\016\243\213/\235!\205}\260\264\312\231Rp\315\024\202\225\203\004\262\232\376\215\307\204"
+	.string	":\031\\f\214\323C\345c\366\323\215\002\253\306N\246\376~3\206\001\217\200\364\b\017\037),?E5]\221\277\273>\fFW\005"
+	.string	"\333K\2375\345Y\033\267\234q\022\350L\362)\306T\341I\326\005z\346)\231\317\316\031r"
+	.ascii	"\353\325\210f\312\257\037\277;4i\365\373x\026\212\253\254R\250"
+	.ascii	"\257\226j5\350\025vJ\205\307}\225bS@\354\332c\332\244WC\311\241"
+	.ascii	"\0345\320}\353\334\270"
+	.string	"S\203c/Y/\336f@\026\016\315\033EDXKn%\345\200\235\273\266\352c\r\032\bG\242\262Fq3\016w\352\200f\222U\337Hi\ff;?Qgy\246 \fJ0\317}fQ\213\304/\327W\224\214_\274\233\036f5\342|\002(Y\260\342P\325\262\312/\246\016\242\2169A\nv\205\346\261\034\272\334KQIT\264\372\t\342K\336>y\346+\353\215\035@Tc^\334\371Z\212\215=\370}b\230\323jKSc\332\265t\211yKB#\236\333f\261\030\202\020\341\330\322\032\227\303\302\356\r\300\246\355x\325\021\210\024na\b\345\217\3416_m\t\371\325\005(\223hc\330\375b\367\276#\323H\r\314+4\225K\037'\257q0H\202\207\036\315\221\205E\330\230!jv\360\004\207\005\343\316\211\267\271\220?\021:\370P\007\241\021\327\234\201hH\257\302<\356\220"
+	.ascii	"\365\2049\275\034\020\232\205\362\\\335\244%Jj\245\252\322E\336"
+	.ascii	"\243so\232\255{\242\262\343,\225(\324E\221\3737\033\306\351\234"
+	.ascii	".\202\354\304\r\320T\376\"4o7\205\006\311\003\311\t\325\256*"
+	.ascii	"\234 \276\355\274\006\013\204O\277W\tp\221\374\026\275\003\234"
+	.ascii	"k!M\006\221\325:\360V\024\211\033=\325DN\263\326-\251O\246\204"
+	.ascii	"\343\"#\r\2656\232\370`\306O\362?\277s3\226^\224`Q\f\375>W\316"
+	.ascii	"\303\3310\374\225\016O~\024\322f\350\354\304i\314'\\\377;\242"
+	.ascii	"^\350\224+\030\0032\302`u\320it@!\335\244\324\004\020t\030_\356"
+	.ascii	"{(\025\222\n&\256g\242\363_\272\"_\215\263\036\321i\244\034."
+	.ascii	"\333N\255\244S\323d\021\321\262\232H\b`&\201\350L\2054\362\037"
+	.ascii	"\2134\245\fO\237\342V8\3234u\n\234\352q\265\002\341L\242\273"
+	.ascii	"I\026%\213c\250\363\031|\326e\353\370,\220R(1hd\364\307\036F"
+	.ascii	"\250LX\375\202]g>\315\021\342\265\253\354-\022\247#1m\240\335"
+	.ascii	"u\252\352\351\331\353\313y\003;\236S\251\356\271\353z\315QWf"
+	.ascii	"\037 \347AS#\275\235\033\216\263\023\273\t9\253\"\321\341\377"
+	.ascii	"\347)1\273\233\274\024\255\267\013\003\201\006\252\236\260n8"
+	.ascii	"\r\013&\316\335\025-Q\006\023\207\312=w\223|E\212 q\306N\377"
+	.text
+	.section	.gnu.lto_mspCommonProcessInCommand.185.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`\016\013u4"
+	.ascii	"\372X\204\023BP\346Q\007\213s\356\270j\035W\273\273\246r\177"
+	.ascii	"\303\243QM\3441\023G\263\302\377\361\241\266\232U\366\365\017"
+	.ascii	"\017\017\036\220\265\211D\315\235\224\202\316\016\340oR\031\343"
+	.ascii	"G\261\326\232\2716\273\367\336{'\231R'\001\020\001%\001\276/"
+	.ascii	"\3104\017\261\340f\007\245D\353jw\307!\215\311g\376\321[\306"
+	.ascii	"1\364\226\300\325\226j]M\273\267\272}\335\255r\241\341\345\230"
+	.ascii	"\342n\177z\226-\327b\003I\230\275\266\370H\360l\373qw\203\007"
+	.ascii	"[~\005G\177\316h~\312\344\374\\\320\006ZW\335\374m\253\337\016"
+	.ascii	"_\\a\f\334x\344\200\032\3129\037\215^\\]M\375hu\365\221\264{"
+	.ascii	"\372\364V\361\353\302 \320\350\347\353\271-\273\252\303\364\361"
+	.ascii	"\333\236t!\324?\364Xzy;\244\026\306\346A`\nug\206\220\323a\022"
+	.ascii	"I\213?\234(\035\352NQ\230h\330\310\271\330\374\007\367\326\346"
+	.ascii	"c\245\306\270\353\204S\002\250\227\026\347\034\341\343Q\230e"
+	.ascii	")\024\332\233 N\207i\206]\247\226\225\n#\342,\035"
+	.string	"\346\020_3\007^Sc\316\031\330\004K\215x\331\364\302\252\260M\314\207i\005\270*I\234\0163I\372Z\342\326\370\232`8e\245\344<\215\002\007Q\027\036\271\246\230\177\257\331Ev\266\ns\316\256\306,\222bV*\347\334X\331\f\363&z\267Ouw\215\356\236\205P\217\241D\024*\260+\361\273\234\023\355\n\245\251s6nL\342D\376\357\3546\355t\023\334\364@\311YM\373\032\004\236\226\2043\203r\246\035\215\223\343X]\365\361\361\342f\272\333O\233s\322\321\374\370\227\321\362\371V%\247e\004\256\036x\343\027V\324\007\336\337\227\264Y\223C\021\027^\324A\374\364\335UV\330\225\355Pw\347\232\266\273Cw^\237\354~v\341wv{\232\177\255\273qO\371\027o(\277\342~\300\265\270?5\356\002N.n\243\213\273\311\305M\340q3\375p\017hq/\371p+\265\270\223\\\334H.n\001.\356"
+	.string	"-\356\242\213\033\200\213\373\250\305Mtq\017]\334\302\026w\260\207\033\350\3426\352\341\376\271\270}-\356^\213\333mq\267\036\347\315\266\270\327\307\255\266\270\323\307\375-n\374\270\235\312E\234\256:P\267\036\217\347\231\177,B\224\353\324\271'\036\347\376\305\233M\n.Cd8\230\246"
+	.ascii	"g\221\241n\357\322\356\305\345:\231\025c\364@\243g\351\242g~"
+	.ascii	"R<\321;\305\001[{\236#z\251\364k\345u\303\256|\335VWY\250\022"
+	.ascii	"\317\367\277w\247\027\313\005\354J\337\263sQ3-[f\346\234\021"
+	.ascii	"\270]\024K]\022'J\240%\216M\357\235\335s\246\265\367\337{\037"
+	.ascii	"\343\304\271\250\2254\256$J\245.\211\023\271Dp\264\314.J\326"
+	.ascii	"\266\373\335\030\034om\f\240\273%\250\373KsQ \355wk\360>\202"
+	.ascii	"\322\304\360\331\243$\246}%\272hs\375n\016\236\007\207\017\305"
+	.ascii	"\376 B\203\340a\360xX\213Y\340tYy\3139K\260\343w@t\210),bu5\251"
+	.ascii	"\217\022o}\262h\241Eu^\237|\346\234Y\325\347x\247i;\322\312\376"
+	.ascii	"\262\316\331\177\350\237\274\365\235\035\241l\350\216\264\272"
+	.ascii	"r\357u\356\364K\344\352\364\301A\177\352\270\372\316vo\2743n"
+	.ascii	"\304\f\177\255\325\377w\265-z\274p\264\323W\337\025\270\234\021"
+	.ascii	"m\316^\022\332"
+	.string	"\341x\034\022\2513q\265M\234X]\351j\373\211\217\3223\007\365\377\276\245\0342}(I\037<\351;?\355\"\352\210D2\261x\201oX\261\300\362\200!\303\005\255,$\226\325\b\253\026+f\300\310\252Q\304\332\200DZUeiQ\315@fQ\305@^\t\253\264\220O5\"\004\213\253\252\265\253\242b \257\216X/V\\\035\253\264\220\307\250bg\305\260\322:\316\310\312\322:\372\236\\\236\346_k`\331\330\225\237\373\273:\324\211\301\251/\360\313\356.\360-\305\365]\251\020\002~z\027{\307\260+\247\036oQ\013T\367U\3061\335X>t\02742Yb\307\370,^\036\225&6$MS\b\254\275O\236\216\020\220\002|\247w\232\225\351\265\266\304\361\302Q\246w\273\274\266\001d\030\3555;[\372\001KE\224\316p\331[\204\314N\322+\275'\235!\031\301B\304V\244_\351\362\314\004\034\301a\315"
+	.string	"/\240\370\001\236\205\026\237\235\313#\003\340\304>z`0?z"
+	.string	"\304?\"\216\r\221`\345\373\244)\017\326\201w\274I\226\274M\232\254\256\272\022\257\347\357\223U\370\303w\260(]/\374\325N\360W\274<\261\271< F\357\364\3179'\177QBr\321Ai\201\032\r\\\0256\037\260\r'q\200\332\250q@\004\215R\250$\020\021\221\2440)t\260\002\221!\242\252\003\022\340\324A\305\2302\216\fI\225\326\030\366\rO\016"
+	.string	"%\3229\3757\207B\331\200S\303\006\315\232\251P\346D\024:\311\244\331\235\336\377\032\3534\326\301"
+	.string	"\022\312p \306K2,10\260\325B4\362wv\007\223\324\234I\3638\223\306\324\325\027(\005\305\003\253"
+	.string	"Y?\033\220\324O\023x\216Q\263-\305+\3506\263\236\355!\331\333:y-\325c\375\005\253\333\331\t\344C*<\234_Z\2569h\374u\314\243\230b~\302N\313XE\017\220\345\030\224\367\200\254:fy\272pE\2334B\324\321\024\374\311a=5\241\300\223\346Zq\346\002\225[\313A~p\310@\033\301\271eX"
+	.string	"-\247\334~r|\255\374_?\024\332\344XBE\241\037\215\337s\363"
+	.string	"}l\202\203b@\271Nx\313\247\200\235$\035\261\036\207\375\006U\256\256\210?nV6\032)OaKT\273\214\376 \332\301Xj\241\2249+\005\024\370\316\350$\255D\273F\300\335\271i}\265\216 I\342RA\251\26301\037\243\226E\\?\362y\030\365\004\223\002}\304\316\266\020\207\007~\031\345l\274\001\251+\0205\034"
+	.string	"D\242U\367r\017\342s\330\262\246\375\303Z\360o\b\210\036k\317\016\304\200@r\372\232\035\330\376\007\205"
+	.ascii	"x\253\213.\343\2416\311\t\001\306,\024E\343C\023g\"ee\204\033"
+	.ascii	"\343\204\025(\343\2410T\354\206\302\327\362e\244\275{\3425+\375"
+	.ascii	"#\244G\002\334\314m\247\002"
+	.text
+	.section	.gnu.lto_mspFcProcessCommand.186.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`x\006U#"
+	.string	"6\375\332Ip\032R:\007\300r\n*\260\3023\221\254R\207\n\357wQ\027\202\320\005&"
+	.string	"X@\346\315\"\300\3547\354\317hO}\315\274\211\332$\"\003\314\325\334qC\374A\307P$\0054\255?\204\234\310\362\325\"\225\020B\310\336I\006\305"
+	.string	"\273"
+	.string	"\305"
+	.string	"i\315\234\223\f\2166\205\025\2171!!Z\322\364\323\313QbT\t\356\355>\330\303\210O6\035@\316\\X\326rN:\350\003\353\321N\256\335\335?r$\304.f\2202\"#,\235\034\231\260\3119\373\206\336\223\036=/ =\212u\274\370\035\236\316N\307\346\254j\212\236\370\026\373\030\252d\254i\221O\337\341\271]\331x\220+\255\253Scw\366X\375h\357vE\343\\\320\\\252\321!\217W\307\346\264\310\254\2577j]e\221YO\2257\200\026"
+	.string	"\"\360\223\246,\033\017\266^\245\322\3638\260\264\216O\bRlh\360\220Q\347\316\315\221\313\225\277-\220P\367\252E9\347\276-\022\353\335{\367\325\356\376\320\235\362\004\307Npo_`Q\240\234"
+	.string	"\016\330a\325\207\0132\355\227K=m7\212\257\245Xs\316\022\324T"
+	.string	"\203\340z\034\3557\245GY<\001\316\013\324\233\031\f\343\235\353N>]\334\325\3753c\256n\241 \037\236\217\375\275\223\275y/{\357\236\374u7{\263_\362\347\034\355\255\246\267\323\3656\272\336>\325\3338\275\375!\234\003\314\352\005\214\273\230\222\263\325\034\234\314D\237x\235\354/\373\315~\264\237\335\357nb\277\311\235\374\354\312\326\365\321\232\355\031+\237\252\313\362\254\231s\366`\266T\004E\245a\211\006dC\331R/\273\345_\245Y*/\254G\373A\004\342\311X<Oe&\037\313\030w[\300p\337\236x\210\207\361\206*\253)G\271+:\rM0,\207*o9\035\242pY\377\213f&\256\251\376\\\026w\177"
+	.ascii	"q\337\366\225\007p\266\025\306\214\302\362.zJ{n\017\207\020q"
+	.ascii	"\337\006\341+\257\3332r-\377\2153vL\223\206\342\256\016\323\027"
+	.ascii	"#\005\327\377\022\325\245\357\005\312\255\277\305\230\245\317"
+	.ascii	"d>\235@z\364m\335\035\367\333\350\356\216\273mV\320E\307+\207"
+	.ascii	"cx)\321r\006\270O\033Ab\315\331\370\226\305;\334]\342w\337\n"
+	.ascii	"\341\277\331*\302\234\302O\375\266\006v\003\343\256f\346\233"
+	.ascii	"H\217\361\024Y\030\261/Q\327M\037S\321\331\301VU5i\315\034\363"
+	.ascii	"\360m;\3125\322\245\230X\003JHB\2544<\302?\341\020\033\201\350"
+	.ascii	"p\004\374\245+.\f\207H\277\240\320Hi\0304J\032\002{L*\222\220"
+	.ascii	"\204\350\021\360\207\373G\2244\004\372V\240(\001\364\375\204"
+	.ascii	"C\037QO\007\223\220\204>\245`P\350\323%\3631W?\311R\356\250\246"
+	.ascii	"\303\203\211Pf\034\325x>\230W\245\306\013"
+	.string	"\265\301\201fHA\2030qi\345\250\206\205\260\212[t\267\212\277%G\022\246\021Cu\352\3656o\315\2508\305\354\030\031d\360\334\334\034\232\035\004\267'\244H\344\276\365\301@B\200\260i>i,\303\303]\355\364fKy\016\354\276\212G\356[\036|\337l\305a\036\325!mY:\270\353\314Q\003\267\030V\341\276E\361\025\333j\303\224\3621\262\346k\367`zb'10B\001\200\200\250QL\243\030S\306$\220\221\202\302\202\244\330\260\002\221Ab\007\021\320L\313\030i\n\n\013\205=\003o|\314,\031\237\237\0046j\345\023\224\306hP\362\212\367k\217\235\205\020}\376E\276\022\023/P\036\335f\311\236\314\361\311\032(\030\303\206%\350\f\264\374\351 y\357\203m\262\357\037#I\325\376\223\316v\tD\006(\247\303+F=\233)\351\235\375r\310\310tp\270\227\323E\307\224:-v\274R\245T\\\034"
+	.string	"G\210\333m\025Z(\233\341\241 \225Q\017\230')\001EvtH\207`\300\035\327<\216\222\206\214\264N\225\232\027\225)\016:L\233\320\335\021\260\246]\241n\254\021\253\256-\327V0W&\342,"
+	.ascii	"e\002\362\2057\215[\004\013\372ZL\020I^TT\335i\327h\001\224\275"
+	.ascii	"?Y0\320\203\255\270\345\214\004\274\213\363\ro\230\310W\213m"
+	.ascii	"\037,N7F<\361\007"
+	.text
+	.section	.gnu.lto_mspFcProcessReply.187.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`j\001\305\016"
+	.string	"\326\332aF\360\262&\035\220 J\353\332E_(\246t\177"
+	.string	"Z\267\177\233\016\335\363\342\030\242\177:y\306s\b\355zTGR\302\2329\244\312P\243X\215l\345a\032\267\223\236\314hs\226v,\220&\n\336\020\305\266\267\334)\005M"
+	.string	"H"
+	.string	"S"
+	.string	"\322\363!\320ev\002\240K\247\354\035\2372;\362\032\261b\323\263\273\233\306<\365\2500\345\213B\304\360\276\356\361\2567\240y\211y\337\207k\f\340\263bC\373T\242\002\016=/!\237\nB\020\223\3355\364>\017\267\274m\007\266E\366s\004qw\327\272\262?\357\370\326\257\n}"
+	.string	"\013x\314\264\334\005g\267C\354\307\302\244\f\023\237\267_ck\277\313\232\355y\"`k\354Yx^$tvg\202K#\310\016\355\247\270\212\324[(\037\260\273\202q\263;E>\220=\";\254\035\230J;g2\313\262\273$\312\232\001\353\340\217o\334\264D\250\302\214\200\256\005V\344\250\240\217m\323]X\310\256\017rpP\264\336\342$\344\331\250\333`\310v\227\001\013\r\031\f\340\230\271\364Q@\227QAh\\hx-)0f\317\016*\214\375#\016\245\033(\234H\234\364\250\344\204*m\025$@(m#\016\265\225\204l:\221\270\355\202\311\304m\332\334\307\325\225\265\230\023\260\024U\201\"\013\342UBg\347\222\334u\223\016\376D\037\252\203\325#\204\024\001\336s|\301\342\321`T{B\t\336\363k\036\037"
+	.ascii	"\357b\314\304\333\1778\234\205\315`&\364me`,h\n\271`\022\220"
+	.ascii	"\213\363\020;m\254!X{,\201\307*\261\002\242:\233\2521\252\334"
+	.ascii	"\336J\b\317K1\246a?;\306e\266\036\261\013a?\212X\236\272\"\256"
+	.ascii	"e\230\022\321\\j\017"
+	.text
+	.section	.gnu.lto_mspInit.188.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375 \321u\005"
+	.string	"\362\311$*pm:\240l\261\003\270\r\034|\260w\225H\374$v\f,\322\304|\2136\3211u\257\252\"\3509\363\356\363.\357\342\227[\246\257(L\263\030\323,n0\024\026W\231\306\024\341\027\266\310\330q]\031Ob\353~\023\250\031#\313}\345\377\200H\355~"
+	.string	"\303\221\333\355\0277\271\227_\001\275\337\277\b\021\247\242\026P\367\244D\3521\320\311\374\327\351\363\017\251\210\351\202\347#\331\214\272\233\027\324\251r^5\324A\347m*\005\211\356\276\354<\212~\325\360\177\006\t"
+	.ascii	"3\003\316:#,\\\347\032\356\026\302x\031\002\\\2721[\333uZ"
+	.text
+	.section	.gnu.lto_mspFcProcessReadOnlyOutCommand.part.0.469.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`\221\001\205\017"
+	.string	"\246^hE"
+	.string	"\221(\035{\232\371\355\3713\375\327\256\242\350 \366\321\310Vu\035\0174z\226Y\005\247\214C\320\325\036\265\314\264\315\302z\261\034\n6\205\336)\250\372\273\003\005\222\030\243{'NI\240s\257'd\357-eJ\001X"
+	.string	"T"
+	.string	"P"
+	.string	"+\333\016\021!\231\363@\225d$\230\331\240\362\2521\247\247=n\313\271\313\bW1\316\327TW\272\374\367\006-'T\244\272\f\217\030\0169\035\n~\31497\335I\027vT\037R\234\316\004\r\310\240\240\361\357\272\322\235T;\216a#sNg\032\356\354\2667\333\036\373/\002\223\025S\200\260}\373\337\310\336\330${\343\250\177\215\274y!\302\334E:\211\t\036\034\363\344\252"
+	.string	"\222=\332\313\240\336\033\375\005E\275\271Z\031\252}\021\037A\372\013\212\343\234\254\0301sz\b\036] {\344xG>\352\007\310G\373!\034\"22w\317E\025\277\013\215L\314n\3136'\341\022\3500\203\005\214\223\322\030\200\372\233\334\325\265%\210\364)\270\037\024\266\344\257\356\277\337\202\251\305w#Ekt[^\354p.\213muf5\006\325\322\352h5\374\353_\250\326{\3779p\306\204"
+	.string	"\016s\252jl\004'\"\222]\300@\001\t\350#\375\361\230\210@Z\204\022\007 \355\023\022i\236\2167\223\007!\355d\333B\332\346p.\213\377\275#b\2339[\217\244\254In\313\n\017\\\027\344rWl\271\330^%\356\327\003\314\267\002n\253\304\343\256\013W"
+	.string	"-\201\240O\305\375\f\013\265%o\037"
+	.ascii	"\3571\336\026\356\177\305$*\304F\t\2210\026Bh\310*4W5\374V\034"
+	.ascii	"\0251v\003\362\300\bW\fB\261a\024&\0368\221\323\016\230\013\302"
+	.ascii	"7\002\025\334[\204!9\357\350N\203\327\261O\303Sh\336\324U\216"
+	.ascii	"\201\366\236P\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`\3568\315\205"
+	.string	"\272\266\020&T\200\020Vu\353@\002\220\361\245\374\rY\212\\]([\227Z\232q>\343\255R\355?\231\223\330\334h\235g\032k\250X\377<p\360\013 \360/@\365\037!\325\277\030R\365\237\204R\375')\365\037(u\345\002\324\365@\364\r\320\206\337\n"
+	.ascii	"\236\007\215\244L2e\002F\0021\002u\246\320u\207\264\352\354\301"
+	.ascii	"\252\323\207\216:e9\352\234\245P'\020\034u\006\335\250S\005\033"
+	.ascii	"u\256P\243\316\032\nu\332~\352\024B\243N\026|\352\0342\243\316"
+	.ascii	"\234\214:u1\352\334\301\250\363\366\242\316\026\\\324IkQ\247"
+	.ascii	"PO\235\316\242\316\"+\352\034\342\251\323\205U\235FT\324ItB\235"
+	.ascii	"9R\324Y\204\242\316\027Tu\342v\352\204q\235GL\250\023\211N\235"
+	.ascii	"IN\324i4s\352\324Q\254\363\350\251N\336\227:\221\274\324\271"
+	.ascii	"\204X'\223a\235J\272\324\331\204K\235N\234\352|5\325\t\264\245"
+	.ascii	"N\036Z\352\002\231\352\322 \254k%K\335$,uk\b\326\275\262T7"
+	.string	"x\245.S\ru\267(\325\355\222Twh\245\356\023\ru\213\300:s~u\236\230\241\256\360\353\324\361\325\311\275\272Gd\250\233\244J\335\027\250\324E\022C]\243)u\211\244\324e\022\245\256\017\206\272P\240\324EzRw\211\223\272M\232\324\205\201I]'K\352NA\252[\205W\267\310Q]#J\352\272Q]\"I\352\266\200\244\256\320\221\272.\274P7WTW\2679KTw\267F\352\2620T\0277M\324\331\233\263\313\221\022\307\203:[;}\240X\341m\221\272?\210\324\275M\235\234\233\327\265\315b\007uk\005\270P)\223)TW\310la\022\331\315 \272\371#7cE*;\244n\220\311\302\276vAF$/\327\342\352\306\346m\232 d\332\b2Q\260\315\237\332\234\261\302\244\241\302\224\0214a\320f\f \363\305\217\351b6{d\223\305\210\331\302\307\\\321c\326\210\315\033\260\351\303c\362"
+	.ascii	"\315\325k\277\270\326\313\216%\366T\321\232'\260f\n\035\313%"
+	.ascii	"\307:\245\260M8V\313\215\211\302\306T\225\330,\031\314\235\032"
+	.ascii	"\213\005\205]\212\371Y%Z,>9Y\032ug\323gg\230\261/ce\210\261T"
+	.ascii	"`l\f/V\212\213\215\322b\177=\313#\206J\271\234\263,\026h\305"
+	.ascii	">\341Y\336j\217T\254\222\230\023\266(\006\203\355\305\244\250"
+	.ascii	"++`Q\354P\f\320\020\313\252\352\2560\300\221\337\n\273SW\005"
+	.ascii	"\256\333\303\204\272> \310\242\372\261:u\203drttr\204HY\245L"
+	.ascii	"\322barrrr\366D]\332\224RF\220\024H\256\364@\376\371z=\326\345"
+	.ascii	"p\177\243\266\032\323~\3262\217\275\321\277\330\325-\177\312"
+	.ascii	"\342\235?EH\316\223\023\207?d'f\362\027r\260y\276\273\204\203"
+	.ascii	"I\220\f\246\350\\\342\244\376\371z\276\023\b\035\351t9\334\315"
+	.ascii	"V\013\362I\363\231\313`\377r}\313\177\262\274"
+	.string	"\350\377\304D\036\272\321c\361u\342,)&a\257\222\273Q\252\202$\0242)L\321\375\365\342\004A\021d{\317\224\242\253\363\034\356o6\256\365n\356\205+/y)Z\323X\3461\336\327+\371\272Z\313\252%\360J*,\026?\022D\370\225Ub.\031!\370/EA\350\017\334\2036\241%E9\360\r~\r\220\322\222\"\225\244(\t\244\024%\261%EI4\t\036\3618\274\343\025\246\037!>D7\245h\b^\030\025\r\007\361\301y)\372\201\235R\324\303\373R\324\203w\340\r\217\362\233\246a\347\222\2423=\303F):z\227\024\215\226\225\0269L\321mzob&\177!\007{\251\225:\311\201\354s]\316\350\275q7\266u\315?\310\237\346\262\217\365\302\366\005e\244\333\252\\\202\357\376^\360L\2210\214\224\204\021Fp\021\244\214T\204\020Bh\020\032\004\376\200=x\017\330\204W\031\251\t\016|\001"
+	.ascii	"\242{!e\030\351\006\275\001k\360H#\315\240Wf\361\025\361B\242"
+	.ascii	"G"
+	.string	"|\224\221\216p\034\2372R\234\016\361\275\221\206p\020\036\303HA\364\207\2462R\017\357\241;0\207\347\340?R\016\315\2017\364\006\006\216\0245\303HQ77N\303Ho\232\206\306\3777\322\231\236\341\361\215F:\372\310/\303\276\221\2567\001A\262T\221\274\221\242\036\3057M\343?\303\243/\035r\262\343B:\341\305P\031\243\030\272\214\024CE\310'1tl$\030:2\023\030\272\317\243?G~@d\023\030Z\342\002\036\f\025!\215`\3506\022\022\245%.\240t\271\304\005H\2237)\215\317\360\322!\026]\216\306\346-\035Y\246\327\215\226\226@Z*B.YJ\002\007\204\007\016(\232\361\215$]V\"\251\by$)\254\316'<\352d\001\325\271\343U\247\313U'\216\035\001N\337M\334\363.lU\360\306\257\226\372\225Z\345I\354\023\3108\344\356}\374\272\376\231c\034\253\376\307\326*\377\251\361\006"
+	.ascii	"\004\354yZ/\003B`X\325\354{f\254\372\237X\253\374\007\306\252"
+	.ascii	"WK\247\032H\253ru\317\363\264x\262\372\211\370\273K\266\035\273"
+	.ascii	"\"\366R\340\f3\206\375\323\344\252_\326\017pU\337#\374\t\272"
+	.ascii	"\264\362\272!\233\202\022\347\220;\031\003\214\035\327\373t\310"
+	.ascii	"]\217u\235\343[\333|\372(\272X\005\261,\346+@\n\027\265\227\377"
+	.ascii	"\266\272\207\305\352\257\375%\364N_\320\207\004\037\341G\350"
+	.ascii	"\226\334Q\021\272?\004\336\335!\204\262*\007\201\375\203(FV\365"
+	.ascii	"-w\324Do\314\223\035\240s\300>rG5\350\f\374W\002\0319\032$X\345"
+	.ascii	"#\032\347C|\b\036\235\354\364\354\016\271\243\300\205\023/\034"
+	.ascii	"z%wK\364\345\311\272\344\216\242|\251\222\220\221}y\337\300\364"
+	.ascii	"\232\020-\220\334Q\033\020\340\362\220;\232\243\233\317\252\344"
+	.ascii	"\216\212\350\221;\272O\244`\272\255'\275P@E\310/\024P\024\321"
+	.ascii	"\215~\310N\335\344\317\304K\233\272<\021r\320\335J\212\242\226"
+	.ascii	"Z\211\223\032\370s\337\367\272\3079\3175\216oos[\363>)EQ5\377"
+	.ascii	" \236\271\254c\016{\024\214Q/F\271\376Q-G\261\212\3754\354]@"
+	.ascii	"\311,\211\02371\323\013"
+	.string	"_\350\301\016\262\322+y\222'5\260\201\374c\337\367\274\327:\316=\316op\267\266\361{\327\370\275\203h3\031\307`\374/\227\267\272oX\\\344'&\016\235\214\336\273\211\231\204\317\363\016.\331(\361{'\001\371\307\276\356\351^\307\237c\034\337\332V\013\362\247\315d\f{\330\313\306\325-\177\033\026\027\273\310OM\364\341\017\331\251\233\232\230\232\211\205]C\212\326\b\203\274\364J\257\304I\r\364\237\277\217kz:4Ektn\324WR\264&\307_\203\343\232\233\320L\321\032\033\327:\310\237\306\263\336\005\216P\004\311x\311kb5.\257iq\r\253\213\376\364OL\354\241;u\223?\023\013;\350\277\304\274\017\362\207LBe\370}%\221\320m\225DB5\340^\006\274\252\227<_\212\203\2613$\3211\034\357\365!\213\350\007\035I$\213\250\207\226\371R\242\033\335\244\003\313d\221\003\275(\260\r\215\352}"
+	.ascii	")\306P\362~\246\307\037Y\306ex&\2136\334\266XY\225,\242%\366"
+	.ascii	"\001.\262\"z\323\333\335\351d\221D$\021\275a\355\250\302\024"
+	.ascii	"\037Y\324\333\0167'!)IDiX\243P\214$\2423:0B+\211\350\250#%\021"
+	.ascii	"\225\361\225"
+	.ascii	"\216bK\222\215I\"\tT\222\313\261=$\021L\032\2412\275\335\237"
+	.ascii	"\025T`\310\"r\210\312\350\354\001\\\216|\304\b\255\002;\216\256"
+	.ascii	"\300\310\241\006z\370\250\330\t|\210)\244\034\242\026,\314(\213"
+	.ascii	"\320\325\331\005\032bQ\222\222E\350\210\336\356N\022\241#\330"
+	.ascii	"qx\021\300!%F\b\337\005\361 \370\203\207\016\316\201\345\222"
+	.ascii	"!A\200>\001\241\241'\273\222D\350\315;M\377L\313\335\252$\221"
+	.ascii	"\355\221D(\252\306Or'\213A~\202\306:o\002\317d1\336\305\222\343"
+	.ascii	"hw`\235\343(<\205\213U\255>\341U\310\035\317\023}\305\220\335"
+	.ascii	"\345\216\005\355\267+\246f!w\322\205\032tz\211WN\341\371r\342"
+	.ascii	"\346\367*_O\365+]\277*\3278\334\355f\263u\255\366\264\347\241"
+	.ascii	"9\315W2v\230"
+	.string	"\337\300n^\356\342\233\026\263\2126O6\304\266\031:\361\310\335\022\ty\331\026L\276SG\361\310\256\230\270G\350\302\240\013\177\3210\2268\306\257e\370\370E\357g\350\372mrm\203{\233\033\317h\304`\375\257\266q\265xQ2\0258\334\206U,>=\021\211CU\3778\361\306\3200\205'\350\353\201\245E\026\\ZR\002>\220\177>_\257\247\313=\316o\375c\263uM\315\203:\210\337i=\233\311\\\365\260^\371\213\337\325^\303\362\342\252\310ON|\342\017\275\307\211\233z\365\336B\377V\005\371\227\034\005\271\253\241\3246\222\374'\211W@`\257~\356\363\365\252\327\323\371J\227{U\256q\024\247\272\271\255\346\037\3044\247q\317\314e\253\217\265\r\330\303\370\345\356j\261SV\027{a\254X\201\262\253\357y\352\025\221=\2054\250\003s4\234\260T53\222\024$\351\363\031 @R\264\0222c>\023"
+	.string	"\214\006\265PLP\236\023\211D$\020\021\371\331\373\271R\007\027n\231\"r\315\233\266;\354\313N`\224\266u\240)g\246\025w\353\313*p\337AUgF\212n\370\031X\212\272\333\264\272\223f\024\250q@\0070\213\217\250\274\360e{\344n\335|\313Y\256\355\271o\021!\257s3\017"
+	.string	"h\353\242\346\t\242\003\317\225\340\177\346U\351}\272Wk"
+	.string	"o\333\255"
+	.ascii	"x\204\342`\033\323\225\233\324\024nb<m\351\342\375S\267\224\375"
+	.ascii	"\037\265N\232\t\fe\362[\377\300\235\027\323\0040\226q~\324\251"
+	.ascii	"K<\201\337|\316\335\032]Q\363\216HeNTp\224\222\0318\013\3421"
+	.ascii	"\321\240p\336\224h`\020\025\234\363\317\350\225\276\223\234\352"
+	.ascii	"\035\221\3547\333g\376*T\357\037\3551\001\304\025\264[\205\343"
+	.ascii	"0\227;\"\003+\fy\030y0\225Q]U\0364\005\361d{\325x\022\357g\364"
+	.string	"z\035l0\236ay\340\244\002\263\235\304a\234z\216u\\\342\f\331\201\340\302f_\257\022\222\276\310,{\017\f\031\235\376\330\200\332\341\203\3253\223\007\234\240x\315^\030*\330\301\271\325\302\303(\251,\310S\357;\2116S\277S\355\264(\261\246*\2316DO/!\311Ko\247\343\004\216\267y\234\345\250G\373\333\354%*\266E\023\311\206/\001\252\216\035\f\227\017\306\032\324\036\212\323\311\206\304-\357\242\2143\275\202O\206\364n\306d`\300\021\202<S\006[.\350\336\246\367?\203\300^\226\213\"\240W\020\004\006\367cE\351\202$\001\006\323\254!\326\372\272\013\034\361\315\327\346{\241\b\241\024*\033-\205\230;\275_\204\371\371\305w\275\032B\003J4\246\316\222\233\nb\226\224igj-@\363\315U\210\223\241\221\022\243C\201\244\026\001\225\243\304\257tM\003\373\206$0\005\007\363`\234\340v\217\266\250\003"
+	.string	"\210\360\"Z\251\2506D\226\030\246S\336\376\262\024\304\tX\257\\a\n\030\031\023 y\324\343\264k\024\202\265\375\226%sC*\340\2168\\IL@,\356#\210\032\341w\370'l\214X%\2550"
+	.string	"\366!7DeX\274\201YT\257\372\031I\221_\035\206\n\230[#\210\034\037\330iR\033r\b\220c1\006\037L\002p=={\023\315p\007\253\236\304\324C\335\265"
+	.ascii	"\353\216r\t\354\366~\373\331\33257\037\302V\310\356\317\313\212"
+	.ascii	"\367\205\266\222F\220$pT\247?3\0049\032\030\017\036F\001P%\240"
+	.ascii	"\264c\bB\247\3274\r\354s\001 \306\336\205\357\207\201\r\013w"
+	.ascii	"\001\260\236\303\346\206\306\355LC\343\365\377\f\266\376\270"
+	.ascii	"\232\312\237\201\354\342\312_{`Z\252OG)\203\276\205\236\260\335"
+	.ascii	"\377\037Ii&l\333\324Fp\252\376\200\025\300K\226\232P\263\364"
+	.ascii	"&6L\330\307\376\313\231\340J\205\035\013\275\254m\301\225(Q\327"
+	.ascii	"\301\347\020\021V\024\304\274\302!\032\212\013\n\355\037\323"
+	.ascii	"\205\315>jh\265Y,\301#\241\271\364L\302AB\325\273\317!\2209\037"
+	.ascii	"i\003,\346y\276\243\225\201\344\023*\343H\336\032D\234\005'\216"
+	.ascii	"4YP\253\313Z\334\216JSA\277F2\340@\rN\t\024\350\212\276&\037"
+	.ascii	"\242#\302)\373\335B=?,"
+	.string	"\001vn\361\342\342\3303I\r_jR\214N2\tp\366\007YO\371D; S8\354\375\227\243e'\315\030\317\213Q\"\007\350\210PO\317\210$\305\273)\315\277\234BOF]\024\335Po\367Pk\321\265?X\350hv=Y.\234\227\205\327\366\323\263*_wm^\206v\336\274\257V\006\351L^I0\005\020\314d\201#t\351\323\371\242m\374d\036\177\313E\334\373\245\3275_?mo\377\314j~\365\375\370\300\305\322($+Ka\311*XZ\032N\256\332\271\333qw\216\354\211\037\201\367\254\271/\312\335\332\2306\205Te:\345I\364\375\267\023\351,\235\n\350\001\321U;\013\236\230x\362\243\375+=\377\305\262\352C\270;6K\036\332\341B\036\323\237\306\355A\351\0058\227\362s\276\226\236\354\017\331\245q\360\322\336\363{\273\254\317\264\255[\213h\307\215D\354\205d\303T\304\334D\tA\277\031"
+	.string	"^\264\233\034\274v\336\370v\245lc\317\364\236\276\373\"\3636-\340\205\3660:\016\376h\364\002\315u*7h\377r\252\035v\017ne\020G\357\233\001\242K\026_\375\266\360\365\177\371\360\326}bd\3261\227\351\365\232\215F4.?\340\231\240x\033\275\257]\271\272\232\225\030 \201\032S\037\005\266#(\265\204\213\261\331\340\375\341\340%KZ\305\360xn\312\364\034\007\256A0\345\267\"g\222\230\362G%:\254\234\364\272=%\237D'\330\363\007A\252H\216\b\376a\246a7)\214\332{tL\364\361\205\312\243%\346\357\357\362\223\300\001\f\225F\257\300f\244\303\200\017F\374;M\300\027b\371,\2169\016\224@\005\177\003\215|\214\221\243B\350\211\207\007\212W}\346\247\027\005q["
+	.string	"\342\350;]\265\267\254\232\243\025\243U=\263\3227\362H\372y\325b\313\262\261i\276w\030qlw\314\234\334\301\214s\177\240\375j\0071}L\362\200\375U\340M\036;\353"
+	.ascii	"\331\373\232\203W\2018{\320\b\301S\026\224\235\316\204i \303"
+	.ascii	"\3556F(\035U\035kR\021\251\375\342r\272\221\253t\237\320N\363"
+	.ascii	"\274\207d\003\335\303\312\261_5\364\367\242\260*;\204n\341\302"
+	.ascii	"(\355\240\243\305\323t\241$\2021t\037\371\374\265\367\215\256"
+	.ascii	":\206l\220\025\231c\035\223\r>\3571\304Y\324{\307i<\356\240l"
+	.ascii	"\\\347#\2056\202\177\005\t\021\234\215\233l\313\332w\260\340"
+	.ascii	"\362\305<\367}`\323"
+	.string	"\013\256\326\254\004\200\236"
+	.string	"\355\372bX\034\254\244\220\2750\363S\b\234\277L\367\300Ss\247{{\253\331\013\272\276u\366\262`\026\253\231\202\271HWi\347\262GIWi\347\262GM\247j\347bGM\247j\347jGI\257j\347jGI\257j\347jGI\257j\347j\341\356\245\252\267\270\267\320\245\252\267\270\267\320\245\252\267\270\267\320\245\252\267\270\267\320\245\252\267\270\267\320\245\252\267\270\267\320\245\252\267\270\267\320\245\252\267\270\267\320\245\252\267\270\217\005\200;\rH\251X\360\337\213\b5\3370\2258!\344\004\332\347f\303l\317A\360\036\025*\301\271\2565\226Cz\214\016\032\203\377\274%\375lJ\225\256\251\034\326\361c\362p\335f#\006\355>\305\"\304l4H\254#d\303\234\315\tMU\310\334lHYG\310\206C\304ZT\216)\234\232J\254\035.\222\033F00a]\243\360"
+	.ascii	"Z<\214&)Z\275\023\313\272\213&)\fBH\361\020/\364>T\005\234nc"
+	.ascii	"\210;\267\004\327\377\347\250\341\234\342\017\013\177\003\245"
+	.ascii	"+"
+	.text
+	.section	.gnu.lto_.refs.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375`\013\007-\036"
+	.string	"\246|\313G\220\324J\032\003O\302\027EP1\034\226\b\364\020\245\275\036m_U&\370-\370J\270\024&1\217\005\335L\236I\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\243jF\360l\021\326\277\032A$N\322\350\036\242\2655B\332\226)\254"
+	.string	"\303"
+	.string	"\301"
+	.string	"#\204\200b\276\350\223\030\363U\220\b\240^\336\235\035\314W9\n\365\252\346,K~\235\021\003\306\026V\225\024T\323\322\021\211\241\t_\201$|\355\211\360\213\304p\020\302o\220\037\017\0368h\360\353\306@\354\253+\313E\325\313/Q\220\313\257\017\242\341\021\227_pA\375\277\226\277\257\245~\236\202\037\216\345ocy\233\004#X\260W/\357n\007\235\334\233Z\023\371\313\024[\371\325\302\262R\371\235:\360K\"\345\267\310\300_\210\362\023\026\370{ \377\271\223_\316\344O#\360\313\001/#\340a\002<\n\2007)\251\307\226S\343\351~\3111\037\351v\376\030\247\374#\234\206?>\227\177\\s2\303\2702\374\321\212\212\305\212%\024:\177D:\002\350\225\245\363\306('&%\244\"\241\344\033\177\020\r\005\003\377\364|\274\261\2459\315h\310"
+	.ascii	"\363\332\302\252\232\212rbJ~\252\204d4B\b\b\347S\237\304CB\301"
+	.ascii	"\"2\217\016\311y\324\017\347\321 =\224\217\332axt.\016\356y\363"
+	.ascii	"\350Z\215\263\013\2172\301,<\352\242j*\352\251i\311\346\321\024"
+	.ascii	"3u4i\346\321\022\016\036\r\252y\364\247\346\213I\220\030\016"
+	.ascii	"\032\t\244\371\242\037\337\336\017<\036v7\336\332\324\320\232"
+	.ascii	"d3\304\300f\276\330\245U\341\213WT\313/B)\277\330\244BI\346\213"
+	.ascii	"F\001O\031\3664\351\250\204P\b\235=\365I\302\227\367\342JgG\231"
+	.ascii	"R\23482\032J&\037\3651\034\f\364\343\313\273\253cK:\233e4\306"
+	.ascii	"\276\272\266\256Z$\245\234V$\277\310\204\"\311\204Q\021\021\316"
+	.ascii	"^\fJ<,4\"\263\327\"9{%\202\263\327\277>\f{\335S\356\365\216\307"
+	.ascii	"\016\035t7{\225\303\001wa\257nli\316&\031\363e\257C\"B\270\354"
+	.ascii	"\265\007\361\320e\337\271\235\373\342P\356\373l[\223\331\367"
+	.ascii	"\254"
+	.string	"l\f\214\013\253\205\324\223\222\211\375\211\331\267'\021\311aa\314~`\337\036\220<<\230}\271'[2\371\327\220\260o\026a\337Y\356:\313}\302g\273\200\233s\330\256+\317\0336\377\262\241\256\200\347Yx\366\024\236\375\344g\275d\267\n\302\370q\265\372a\337\325\252\207\375&r\347A\356;\310=\007\271\337 w\033\344N\203\334\225\310\235\002ro\260\262\273\254\354)*;\212\312\216T\331K\016\334\341d\243a\313n\034l\251\033\355\352r<kvc\032\332\231\031\031\223f7\206}yqi\275\260\202bZ:\201dTD$\0244\263\033\177\020+\354\351!\241 \204=\r4\331\323!\200'{\332'\004\317\302\236\326\235|:g\362i\334\215\321\366\324\306h\237\272\335\274y\363S2\345\23625\354\351\330rO\303\222YWT\001\201\020\250!\260\022\211**JI\241\320\001Q\247\022C\261\001\021\340\037"
+	.ascii	"\300pts\244FG0\tp\323\017s\252\252HY\177\352\364\30336\234\205"
+	.ascii	"\001_O2\370\262\326J2\275\202o+E\346\320\227\021\371\375\206"
+	.ascii	"\221\205a>\270\357?h\272fI\304|\003`\366\321\002JR\236t\023J"
+	.ascii	"\265\331\001\247\\S;\b\243U\215[\230_\0160\r:\304\300\177\300"
+	.ascii	"~\273\340\202W\314c\236%R\\\256@\306\033\250\022R\016\024\031"
+	.ascii	"\224i\2515v\271y#\020\022\276\n"
+	.text
+	.section	.gnu.lto_.decls.5e1c563b0ab476b5,"e",@progbits
+	.string	"(\265/\375\240\334\031\001"
+	.string	"%Z\004\016\271\306\343\027U\0200E%5\006\354\rN\f\316\337\263\370\017*\017r\372\364\243\332e\2077d\227\246\2173T7\3773\274\032\214\236\r~C\254)\26200\372\205\366.\322F\343\276\373Vb\210\206\"m\220g9\253\3001.\257o\337\326\267\251\224l\315\b\331r7\221[\356\024\241\024>\030\n\031BJ\346V\036V+\227\024\007.7\252.<\254\036y\212\203W\024U\027\036W\226^\3612\265M,^\221\244"
+	.string	"\\@T]x?\034"
+	.ascii	"D\325\205\265\362\320Y\253\217\\d\003/$\252.<mDsi-\215D\177\351"
+	.ascii	".=D\027\321X\232\210\366\322[\372\210*\325Yk\231\257R\253\216"
+	.ascii	"\025\354:k]\262\216A\201\305Q\004\244\272L\3438\316\322C:jA\320"
+	.ascii	"P\034#\225\200\304m\235\372W\036Z\210\276R\333\226b\240\237\022"
+	.ascii	"\274\256\250\272\360\326\256\2545\211\032\267~\231\355\026J\274"
+	.ascii	"L\327\273\254\225\314\232\006\005\026Gn\221\022\272\351\332\245"
+	.ascii	"\263V\257\365Km\353\021\3072J\340:\243"
+	.string	"\352\302\213\343\370\003\241\022\235\021\231\005Z_\031y \336`\274r\204#\353\033{lmE\001Q\007\017 \270\254o\\\332.t\214\365+\272BP\321\224J\007\321@T\251\256\022\322U\232H\347@\201\305\321\013AD\323*\375\343k\026\004\r\305@9D\020\222\307\203I3\351a\005\307\326/b\331W\347lP\240\266\365x\300\325\230\327S\326T\347\320Ez\311\202\240\241\026\322\244\323\033G\023s\322\2326qP\333\304B\230mMu\016\215\343hA\260\246q\034\353\034\232\211\002\326\307\017)\"x\232\207\366\241\243\364\224\326\241w\350\036ZJ\225\352\034\032\312\307d\t\236^\215~qi\277(c\277\350b\277\370\263O\304\333'\206\331'\316\355\023\263\324\220\376\324\271\031e}\"\224\375_'i\032\252T+\351##\215\244\343KT+\351\031\032\251\346\313\\^\032\336\n\245\313\230%\254>\221h\377\032I\313"
+	.ascii	"\246\341rJ\243e\350\243a\227U\f\035Y\177x\267?\004\263?\344\262"
+	.ascii	"?l\333\277\206q\035\343\327,t\213<\345\001\237\023\027j-\262"
+	.ascii	"\326/<\\\303X\321#\006R\326\035X\331\037N\331\371K\325\300rP"
+	.ascii	"m\330\017\235\350\240]\005\3274\205\210\006\322?ob\261\234\216"
+	.ascii	"\257\177\016\206\245\373\241\222W\265\242\321;\243\024\305*\353"
+	.ascii	"\017\227\366U\351zF/\223\021q!]\363\276\352\025\tZ\020\314[c"
+	.ascii	"K\312\372w\253\231\377\3560\256\253L\212\031\274!\221[\034\205"
+	.ascii	"\267\226q\311\310\241A\222\365\207F\373\303\241-\202j\303\212"
+	.ascii	"\301\311]\270j0\311\372\3023\3235\214*]\355\326'_\225\254a\307"
+	.ascii	"Y\355V&\253\223\2710v\353\330\nFm[*\306B`\320LU&T\322\330\261"
+	.ascii	":\313\332\305K\364\313\352e\255S\245+\230\257`V\351\2126\374"
+	.ascii	"1\306\361\324\231(\230\225\312\212e(\364\025#\261u?tf\024|\360"
+	.ascii	"\0010\306\016\247\237\255\347V:U\272vY\345\336V.j\333\322W\214"
+	.ascii	"4\034\313Ag\206\327em[\335,\b\032\202\300\224.\323-\345\307\024"
+	.ascii	"\037\254\276p\272\377\225\313\032\347\242l\b\227-+\334\217\306"
+	.ascii	"R\333\224\254/\334\262\267\\-\022\262B-\353\013\325\366U\351"
+	.ascii	"\277\254Z\016\206jM\211+\353\013\251\354\013\313\366\205cX\326"
+	.ascii	"*\353\025\265M,\004\033\230i\034\307k+\233*]\261\254j+\226\365"
+	.ascii	"J\335th5\004\t\027\253/\364\332\372\210P\023,Y\257V\326\264X"
+	.ascii	"(\004\343\204F$\353\013\213\354\013\203\354\013\177\354\377\253"
+	.ascii	"\224u\212*]\321\3263\234\2578\226\242\255P\326(\026\004\r\211"
+	.ascii	"x\312\233n\255h+Y6\002Z\t\2413ku\234y\375`\365\203{\373_\243"
+	.ascii	"\254f\253\215!\2623_\276*K[\252T\351Z\266>\371\212q\200t/b0Y"
+	.ascii	"?\210\267\037\234\356\007\271\354\007\331\366\203g\273\311*\326"
+	.ascii	"$\252\013+\353\007\305\232\004\277\366\203[[\375R5\26086\354"
+	.ascii	"\203E\326\257\347\250\332\"MIr\226\365\203A\366\315T\033v\013"
+	.ascii	"\2078\303\251\311P\326\017\332\330'!\272\016Y\223\034\355'<\250"
+	.ascii	"\246Y+\022U\272j\255DV\255\265\310\2125c\203\273$^]x\302'xzJ"
+	.ascii	"\2546\262\036!\302\250jA\245f\304l\037\210D\310z\225\221\226"
+	.ascii	"\374\260\022\002\354\261\017"
+	.string	"\244\261V\251od\362\\d} \213\025\310\017\315\376O\314\376/n\377ge\277M\265a\217\247j`\377C\333\355\227\252\201=^\222\375\237\326\376T\265a\377\203\332j\254\332\260\377\352\324\244\237H!\243rC\225\256M+\323\365W\034\2135\2555V\033j\233X\f\264#\203#2\256\232\360\210u5x$i}\327\314^mL3T\034\213e\242).CY\217\340\341\353\022\2135%\207\231\254\357\216\331\377\252\304\204F~\242\344\212\026P\326\377\232\264\316\370E\343\262\266\025i\225\241J\327\031\353QXQ\216\0061E\3438^g\254F9J\202\214\2513\2548\216q>\370@\003j^\314\260\372\256\332\276\213\266\357B\331\377J\264\306X\261e'\2275\f\027\206\222\036\232\254\357\026\3317\001(HP6\032\376\024\343\240\267\252\350\332b}\261\272P\245\353\320*\364L\265\256\270\272\016\255,L\230\356\221\371"
+	.ascii	"\347\003fX\220\034[\337\205\3328\252\006\366n\213\375\215f\177"
+	.ascii	"\327\355\177\375Yc]$\305K\312\336\327\330\310\003\361\006\"Z"
+	.ascii	"l\247\226\265\007\017\317{\252\227^\222*i\362\334\257\266#\243"
+	.ascii	"\254O\002\036\224-\273Lf\350\306qTZ^.\223\311\264>\302L\235\341"
+	.ascii	"\235\311z\031\215*\315y\331\314s\254&\371\340\203\017p\364\323"
+	.ascii	"\324\312\305\326\337`\373;k\177\377\330YL\036\243J\217\226\357"
+	.ascii	"|T\371\361\221\365w\324N\021\307q\254\036\215m\217\306~\333\b"
+	.ascii	"3\035:-\241K\222\277\344\272\fF\225\346i\356\362\354E\235{"
+	.string	"\206\233\273\022\235f\272\243=2x\323,G\025\335#\203\027\307_8\037|\360\301Z\243\tZtkV\265a\337z\331o\337\366\333\264\375\266\311\3763\227\270\034\245(\312.\353\270\377\317F\0368\332Lh \311\301Y\3715I#\007$\353\253p\277\0073,Q\017P\036\260\225e\352\301I\226\036q\251qj[\217X\033\231\351]a\251`adfzWxZH\262\221\207X\357\n\313\003\331\002\264\344\246q\374e%/\311bC\241\257X\306\220\354K\357\n\257\313K/\232\261\262\262\221\332\266\024\377\204)A\310\321\234\222\\Dm[\212\327\272X\357\nK-g\311T\262\226\274\226\247\344\264|%\267e,\331-\263\345\267\214\226\267\344*\2524[\311gW\271\262\224\f\226\213\260VG$D\371J\2625\325\273\302\363\262\222\313\324\270!\320W|\324\216\265Y\311_VPzWxq\374\345+\213z\322!"
+	.ascii	"\235[\033\373-\213}V\314>\273\266\317\202\355\263D\236\3441a"
+	.ascii	"[\215\271'Y\237\305\361\204\215\221\233\250Dcv\030\311\372\276"
+	.ascii	"2\231\3115\030\224p\005R\302R\226\365}[\366}S\366}L\366}B6\n"
+	.ascii	"\252\006\366\276\244}\337\212}\2610\373Zm_\223\355\313\251\032"
+	.ascii	"\330k\257\375\351\221\"H\250H\211e\235\213\344L$\033y.\222\207"
+	.ascii	"|\004\023\036\024\312Et\034\003\251\252\006CU\325\300"
+	.ascii	"\207V\005\244\204\325\327Y\373\317WBN,-ue\235\205D\305f,\301"
+	.ascii	"b\312:W\345 \252\224\202l\025\023U\273\036A2\262\276\026\262"
+	.ascii	"I\020\307*\005\254\272\267\247R\300f*\017\317@\026@\245C+\353"
+	.ascii	"5\377\240\240=\022\005\307\224\217\036\252\\\324i\255\007\017"
+	.ascii	"$IS@\276\266\3428&\272Q\364\212\320\310:\353\310"
+	.string	";\236\247\262T\234\247J\200\212c\240<E<\023\307@DU\325@U5\320ZRVOX}\rd\3779\352\002\342\227\022\221\216\254\377\234\003\312\307\005\226\203F\3268L\270\3418\312\372\372i_\365B*\373\363R\266\221\233\362\215\374\224\231Tiv\312J[GV\346\262S\226\241\306\r}q\f\225\026\215\343/\247<#\323P\333\304BlA\231\302\310F\3035\216\237\256\344\027#\230\220\235r\215l4\374\371\212\215Z\252\250\333\021^\034\177\005\353\246g4\206\372\253\335\376\272%'\005\201\224\240h\311\372\253\332\376:e\177\025\333_\223\354\257Gv\216\221\211T\351\005\271\350#\230\360\365\007,\336\212\343/\2420MV\032\275\254\277Z\355\253\027\260\352\236z\001\373\225\307~\232\252\201\375\263\213\334\002\250\326\245\213\220\254s\213\374\223\203\32461mD:\315C\231\205*\315-\362\212\334\"\013\251\323\241\320\227"
+	.string	"\306\230\260\260\342\370\353\003\234\017\326!-J\204\260\372\353\212\375Lf\377\031\3509\350\317\261\232\344e\031jC\316\022\346\t/ku\213\207g\240\325\214\n\2133Y?\177\331A\325f\257\203-$el+\r\032%{zT\262>\363%\024\3071N{c+\253*\353g,[\005\033\243r\201\363\322S\357T<\325\214ZF%\243J\325<5\314U;U\314\034\335\326\226\034W4\216\277\324<\265\213\0327\004*\306B+\220D\343\370+O\365\242N\207B\305Xh\207V4\216\277\256\256\375\036\362T6\225\313\020\350+\236\321.\351R\272\302\001\272"
+	.ascii	"\303ef\250\237\301vnS5\260\005Pm\330\347\253\255~Q\301\250R\016"
+	.ascii	"j\335]\241\2578,\216\277\210n\234\030'\261\254\237}\354\253\034"
+	.ascii	"X\342\336\336\336\236\312\201}~\332\317-\366\325\274-\202\252"
+	.ascii	"\201\275\nf\377j\333U.\277\n\246bQ\343T\2508\226\306q\274a(\004"
+	.ascii	"\213\023\225\254U-\252\233*\355@}\273\272E\205\273\017\350+\376"
+	.ascii	"\212\343/b\246B\343DI\326EU\003\233\341\366\325\016\330uoO\355"
+	.ascii	"\200U\263x\270\332f\303\036-}\305bq\034\0231 C\213\222u\213e"
+	.ascii	"\253\261\252\201\275\231\252\201\375U5\016B3qAXY\377\352\225"
+	.ascii	"_E\242n\251g\353P\f\250X,\216\277\214'\300\221"
+	.string	"1\223\365U\257%ZQ0&Y\036\232`y\020\263J\242d+\032\307\261\n\026\206$\252z\375\036\234\004\371\325(*\232:E\265\242\246\251UT*\252\024\325L\225\252g*\331U(j\331\365W\034\013\251\\_/\033\n\025c\030-\270\242q\034\237\204\337\303\257v\251^\352\231\372\344ek\222\243\030F\320\020\020\244\230\300\b\203\027\307\361\0078\037|\240\235\270@\301\335\350\f\245j`7Pm\330\2539\366\325\261\253A\200b\023\256\006\355\217`\037\305>\317\276r\277\304\376\207}\016\373\305]Tm\330\267\251\032\330\347\235\201\252\201\325\252\r\233\201j\303\376K\325\300n\325\206\345\240=\022\376D\r\376\366G\007\2101\260\027\234\370\023)\360\263\032\376\226\350\227\374[\251\237\211\237\365\362C\376\354\222\237\007\210\270\037~7\205\377w\374]\026~\035\300a-(\301z\300r\340\301OT\300\337\226\340\307\201_\335"
+	.ascii	"R=\036N\rA\267\277\r\374YYt\200\237x\001\215\237\005~v\375\367"
+	.ascii	"\323\277\241\244~\025\330?~%\376}\343\367\241\371\301\360o!\\"
+	.ascii	"\377F\362#\361o\260\037\005\320\376\337\210?\307@\345\377\275"
+	.ascii	"\240\305"
+	.string	"\374z\357\337k\277\t\374\032\311\257\253|wp\377\216\373\177.\374\276\341\226\253\373\265\260\305\374{\314\377\223\300\277e\374\233\356\377E\340\337d\334\273\355\357\272.P/\300N\214Z\365\273\304\237\b\267&\367<\371\367\330\377\203\200\257N\351\352\037\013.\013w\303\357\342\374\277\025\334\n\\\013|]\\\f\3264k\227u\314\257\277\232\321AW\203\337\025\300\377S\341\337h\376\235\346\377\205\320N\235\302\345\300\355\340\377\201\370\325\020~)\374\233\311\277\233\374\277\017\277[\200\3375\300\377{\300\357z\3709\340wK\3707\221\337=\341\3775\200\005\252\004PK\370\206\337\002\022\360\257$p~'\374l\376}gT\037\255\337G\346W\302\357\346\374D\370\177\037\370\342\376\337\006\377\017\203\377\207\363\377jbu\353'\252\277\253\200\237\265\341.\340\377\025\177\365\346\355O\364\340g\227X\246!\256\234\215\341/$\341W7\374*"
+	.ascii	"~\025G\255\340W/P)\370\177\304\026\3567T}?\353\343'\224sG\360"
+	.ascii	"\022\031\260S]\302\021\374\355\230\225_\360o\331~\300\022\355"
+	.ascii	"\224\237\365\340\032~\241\212\377y\377\307\374\277_\231\377x"
+	.ascii	"'\363\263<~\327F\371\271h\214\360\3747\373?\345\277\224\377i"
+	.ascii	"\377\253\374\247\362\037\355\377\331\313\3766\311\377\333\277"
+	.ascii	"\366?\3169\370\261\377\357D\204\313\337\225\300\336\3376\375"
+	.ascii	"\354\005n\232\237\255\200\035\376.\005~\026\347wI\374.\232\237"
+	.ascii	"%\376l\215{\346g\t\320\246p3\340\352\375\256\006~7\357\337A\376"
+	.ascii	"m\365\273f\376\335\346\342\375\327\200Z\202\005?\013$\301\377"
+	.ascii	"\020~\242\210\337\247\345\367\261\375>\267\337\267\345\367\265"
+	.ascii	"\375\276\267\337\227\345\337)\374n\031\227\314\337:\335\273_"
+	.ascii	"+\177\037\331\337\312\360"
+	.string	"\267\314\337\035\363\353\022\374>\"\177>\3723\321\237\215\376,\343\367y\371[\035W\214\257\307\357\253\372}B~\337\217\337\227\365\373\242\277/\310\237\231\376|\343\317K\177F\372}C~\237\221\337\247\364g\033\177.\372\263\323\237q\374\231\306\237\233\376\254\364\257Z\277\357\310\237\225\177k\302\265\373W%\377j\343_\251\374\253\325\277V\371W\257\177=\373\327\265\177\225\376+\220\177e\362\257n\377\332\344_\321\376\225\310\357\353\371}>\277/\347\367}\340_\265\374\276\020\374>\347\277\026\371\327\036\277o\206\337\247\374W\036\377\312\366\373D\360\373N\374\276\367\367-\177\037\364\367\241\370}\360\257\017\360\353\020\277&\341\327'\374:\001\277\006\361\273a~\337\320\337v\340o\217\277;\375}:\177\233\001\267\356\337\024p\301\374\272\003\277\373\345\367}\370}*\270^4\370}\006\370}\035~_\001\376\026\206\277-\361\273]~\237"
+	.string	"~\237\005\277o"
+	.ascii	"\177\373\202K\347\033\372j\376V\002\356\334\317\016q\345~\235"
+	.ascii	"\367k\275_\343\375\272\314\257\315\374;\006\227\313\257\317\374"
+	.ascii	"n\334\357n\371}\355\357\302\375-\013\177\013\201\337}\373]7-"
+	.ascii	"\366\353\267_\273\375\2761\177\013\302\325R\345\327W~m\345\327"
+	.ascii	"X~\275\366k\265\277}\200\333\366k\260_?\371u\330\257\235\374"
+	.ascii	"z\354\327D~\235\344\327d\277\226\376z\311\257\243\277\036\362"
+	.ascii	"\353#\277V\362k\254_\027\371\265\220\237\225\200~\361\273Y~\355"
+	.ascii	"\342o\027\360\267\f\370]\266_\313\360k\236_C\177\027\313\257"
+	.ascii	"\201~w\355oQp\325~\275\363\267%\270W~\355\200_?\340\327\rhE\370"
+	.ascii	"[\017\277k\345\3278\277\246\340\327\001\3705\006\277\276\340"
+	.ascii	"\367\321"
+	.ascii	"\375m\001\334\264\025\315\357V\371\3274\377\032\346_\247\377"
+	.ascii	"z\346w\251\374\372\277\006\376\232\370o\r\270h\277V\177w\312"
+	.ascii	"\357\223\373[\002\270R\332\f~\367\354_\227\376\225\351_k\374"
+	.ascii	"\253\323\277\206\375\353\323\277\222\375\255\005-\374k\n\377"
+	.ascii	"\032\201\177\005\361\257/\374\353\n\377*\201\177\025\361\257"
+	.ascii	".\374+\n\377J\201\277\255\240\303\337n\370[\234\337\215\362\257"
+	.ascii	"\001\370[\033\327\354_q\376u\303\277R\360\273e\177Kt\241\374"
+	.ascii	"\273\003.\031r\005\376\253\360_\177\377j\374\327\340\337\002"
+	.ascii	"\3776\370\273\322\177\325\177\333\272c\031\355o\365V\272O\376"
+	.ascii	"|\366\267\371\311\237\315\376\375\001\327\311\237\243\177\256"
+	.ascii	"\372s\220?[\375\371\307\237}\374\031\210o\372\263{\256\330\323"
+	.ascii	"\237k\3749\351\317P\177\216\372w\004\334&\177\356\371\263\f\177"
+	.ascii	"f\376.\223?\203\340\317\315?;}`~\326\214\273\204\245\200\033"
+	.ascii	"\366\253\034\374\271\003?[\302U\222_\370Y2?[\346w\301\376\335"
+	.ascii	"t\223\374\356\227\353\365g\021\277\232\377\\\302\237U\370\363"
+	.ascii	"\207\237\265s\273\376vl\303.\327\341\262\025\025\373\202-\202"
+	.ascii	"\377u\356\326\006\372Y\r\270H\376=\364\273Zn\326\357\223\362"
+	.ascii	"\253T\277\226\373\367\004\376u\356_\313\220\220\372\206_%\300"
+	.ascii	"\377\fh\340\377\004\376s\340\032\371\335\"\277\033\344wy\374"
+	.ascii	"\272\b\365\2736~\027\351w\217~v\312-\372\335\027_T\351/T\373"
+	.ascii	"\325\r\250H\265\304\257Z\340W\223\277*\343W\217\\\027\277\312"
+	.ascii	"\342W]\374\352\020\234;\304\272\375\354\333\357\266\370U\021"
+	.ascii	"\374j\b~\325\347o\307\374.\013w\205\312\263\377\273Bn\320\317"
+	.ascii	"\252\375\354\332\357\002\375\272u\177\376\355\272\361\257\036"
+	.ascii	"\251\334\022\374\333\306%\301\337\312\271#\370Y\264\337\025\201"
+	.ascii	"z\202*\202\352A\030tC\360\357\325\235ag\340\252 \200\233\342"
+	.ascii	"\337(\270(\376m\202{\342g\305~\326\311\357\372\374\255\225\013"
+	.ascii	"\377.t_\220\306}\276\203_U\341WE\374\355\364o\317\374\233\345"
+	.ascii	"\340\026\374\317\200\013\202\337\375\300\357.\335\235\337\315"
+	.ascii	"\371Y\016^\202\311_\374B\",\020\374\355\330\377:\327\003\177"
+	.ascii	"\313\304=\376\254\007w\177\241\017Q\233\242\375\341v\340\277"
+	.ascii	"\005?k\364\267'\376\003\377\341\227\337\345\300\357j\340wI\374"
+	.ascii	"n\013\277\013\201\337M\341w\027\360\273'\374n\t\277;\302\357"
+	.ascii	"\032\340w;\370]\001\374.\006\277k\301\357V\360\2738\277{\363"
+	.ascii	"\2735\277[\374]\340\357\272\277\333\376\256\357w\377\3574\377"
+	.ascii	"&\363\3571\377\236\376\333\313\277\351\376-\367\357\270\177k"
+	.ascii	"\3717\226\177S\371\367\330\277\233\374[\311\277\273\376]\344"
+	.ascii	"\337B\376m\365o\252\177O\375[\307\277\241\376\375\364\357\246"
+	.ascii	"\177+\375\033\351\337F\377&\3727\214\177\273\370w\320\277G\360"
+	.ascii	"o\025\377F\361o\237\177;\377-\303\277\337\177#\377}\374\367\006"
+	.ascii	"\376}\201\177\227\3707\211\177K\340\337*\374\033\304\277\025"
+	.ascii	"\360o\004\374\373\204\177s\360o\r\376\215\301\277q\376=\301\277"
+	.ascii	"o\376m\3747\361\337\302\177\377\376\255\377\255\376\355\335\337"
+	.ascii	"\316\375m\334\337f\371\333+\177{\366\267\322\277m\362\267`\177"
+	.ascii	"\253\365\267\321\277\245\372\333\036\177\253\343o\235\3766\351"
+	.ascii	"o\217\376\266\350o\207\376\226\305\337\n\375-\320\337\306\177"
+	.ascii	"\233\342oO\374m\317\3372\377v\347o\223\177{\374[\r\374m\f\177"
+	.ascii	"[\342oG\374m\013\177\013\201\277\r\361\267\037\376\226\001\177"
+	.ascii	"\213\200\2775\341o=\374\255\001\376\226\203\277\315\340o-\370"
+	.ascii	"\333\n\376\026\347oo\376\266\370\267\301\277\335\177\253\377"
+	.ascii	"6\377\355\1776\357g\313\374\254\230\237\255\373\331/?+\367\263"
+	.ascii	"q?\373\366\263m?\313\366\263k?k\345g\253\374,\332\317J\371\331"
+	.ascii	"(?[\366\263d?;\366\263N~\226\311\317~\375l\327\317n\375\254\326"
+	.ascii	"\317b\375\254\221\237%\362\263\026\374*\013\277*\201\237\325"
+	.ascii	"?\033\375Y\253_\205\361\263U?\013\344g\251~\265\204_\025\341"
+	.ascii	"W\003\360\263>~\226\307\317N\375?\363\263;~V\352g\231~\326\306"
+	.ascii	"\257\336\3749\206\2375\372Y\r\374\354\005~6\206\237\255\300\317"
+	.ascii	"\222\370\331\027~v\002?\333\302\357K\363\263\"~\026\002?\273"
+	.ascii	"\302\377\272_\r\341?\316\177\270_\035\376,\360g=\370Y\016?\333"
+	.ascii	"\301\317r\360\263\027\374\254\357g\327\337\267\367\373\320\374"
+	.ascii	"\2762\277\217\314\357\273\373}b~_\230"
+	.string	"\337W\367\373\276\374\276.\277o\356\367q\371}p\277o\312\357;\373}H~\237\213\337G\202\337\307\302\357[\341\367\215\360\3736\370}6\277o\377z\356\327\\~\315\366\353\262_\023\375Z\350\327>\277^\376Z\205_\013\340\327\305_\353_\355\340_\343\376\225\313\277\222\370W\030\3765\204\177\025\300\277\002\340_k\376\325\367g*\177\226\362\347(\177\036\362g\251?\373\374\031\376\363\361\317$\376L\201?G\340W\233~\225\306\257&\375\352\214_\215\361\253\361\257\216\340?\f\277\332\363\2539\277\252\374\325\023~\325\303\257z\360\253\034~U\203_\315\340W\367\3774\377\321\374\277\362\337\312\177\027~\025\204\377j\377m\366\366\366\366\376\n\332~\004\374\376%n\001A-UP\264\350\310:\230E\215\333\203\262\206\226\365\357\376\345\277\013\254\362C\212-\353G \312~\004\300\202j(\354~\\\311\372\0218\262\203Wxx"
+	.ascii	"\307\335\222\227*W\245\301*A4\025,\376\001:\271:\302\024\244"
+	.ascii	"+:2\225\365#\240c\377A*A4\257\026\322\"Y\007\247pI\321\242d\375"
+	.ascii	"\b(\355?\030%J\360\214\003\024\320U\006X\354\272\242\032\300"
+	.ascii	"\013\232\313:x\226\243\304\273\037\261\270\254\037\201\243=\264"
+	.ascii	"\302\215\031R\240\\\225\006\241\004\245\034\240b$\003\234)\242"
+	.ascii	"\273\202\027\307K l\2418\240\242\254\037\201x\377A\262\240\364"
+	.ascii	"\313\326\020\274\254\203c?KEDY_\304\035\017\017\224\321b\204"
+	.ascii	"$vU\032\024\0132\301\331\261\020[\227i\034/\201\360\303\241\227"
+	.ascii	"fK\326\027\241e\377\301&A&\361\017\224*Y/\351z2&H\326\027q\266"
+	.ascii	"O\202\021(s\321\265+!V\210\244!\tn\005\271\202YA%\301$A\260\340"
+	.ascii	"W\320+\250\025\fS\245\301\256\340\221\253@\250\262`\231\020\354"
+	.ascii	"\n\026)\233\006\273\202UA\253\261\263#L\037\274\270\253\241\204"
+	.ascii	"\243/bk_D\325\276\b\247}\0210\366E\304\373\020\230\356C\340\312"
+	.ascii	">\004\244\373\020(\262\377`\220\007\255\316\016\tE\021\311\372"
+	.ascii	"\007\304\303\203A\344dD\241\221\365!\260c\037\002O\373\020\230"
+	.ascii	"\261\377\340\217\031\302\252!`A>b\204]\031\303\326\243F\223+"
+	.ascii	"Z\252\360\230\232\232r\"\226upG\021\032\026U\262>\013A\035R."
+	.ascii	"<\231\211\tF=(\245\347V\270\230\221\365\357\2029\376\273\277"
+	.ascii	"8:\275\266\034\017B\255\310\273\022\026\204\n\342\b>\355`\342"
+	.ascii	"\222\365Y\260\333\177\360)\350\344\005\007\023\224\254\233~\320"
+	.ascii	"L!\312\372,\304\355\223\340%:G#X#\370\"8\303\202\240\241\026"
+	.ascii	"\260\272\004k\004\207\202LA\245\340R\360F\320\206*\r\326\b&\005"
+	.ascii	"k\004[\254%\2451s\301v\354\315\005\365Y`\262\317\202\026\222"
+	.ascii	"\233\0244Y\237\205\340Q\320H\225\006e\004\211p\266\212\2021\202"
+	.ascii	"2\2020\2021P\300K\322AJ\346\326X}\026\216\366Yp\261\377`\f,1"
+	.ascii	"\202\262>\013+\366Y\370\331_\001\315\376\ne\366W\230\356?\310"
+	.ascii	"b\205\016\220"
+	.string	",e\260\270\250\310\t\005\203\260l\231\201\311\372\017\002=\030\364l$\375\321\245#\353\340\217\207\007\201\204i<\246Y\007 \030\357qa\262\346$k\340\336\203P\260,\231J\003D3\304\252\201&\226w \232\037\250\007<\223\247\204L\226"
+	.string	"m\311Z\355\241j`5\2506,\320\214\207\003\363v\032*E>\262\276\001\342}\255J\221$?e~1\223\235S\022 \031\340\335Z\244\310\216\356k\305\21607\340\030\240\230\214\324\224\345\207X\313E\017\357\210\0350\314.\003j\223\256uJF\214\246\300\272\251\322\2260>\264%L,\300"
+	.string	"\277\374\\\220I\203G\344\242f\005\316\013\260\313\220+\r\020=a\024!#fts0\320\304)\321l\034\036V\230\034\220K\256\203K\003\003\310E\215S}W\260P\241\213\003\262\261C\230\254\325\260\362\246F\024M\273A\005\307\025\243)\220\r\270\006c\016\310\006\254\242\225Df\r\017\350\006\314\002|\003\302\001\265"
+	.string	"\267"
+	.string	"\333T)\220\r\210e%\343u6-\352\257\360d\177\205%\373+x\355\257\200d\177\205\"\373+T\355\257\260c\177\205\247\375\003\321\200S\200S\016\224\002,\013\262dg\225\365\325\265.%W\274\300\262\221\332\023\340\031\320\tp\f\b\005h\006\214\002$\003\212\001\245\252\024X\006l\222d\r.l_Y\2112)\233\373\302\302\005,\003z\261\001\313\200K\242Iug\260\342\370\253\313\251\f\324\004\372*x\331W!\313\276\ne\373*\200\355\253p\265\257B\216}\025f\354\253\360\263\037\302n?D\334~\b\264\375\003\267\016\214:\341\200s\313\372& \215E\217\310\2427\300h\210Empm\301`\343\232\361\304k\251k\332\264$\313H\206tj\004X\005\364\001\f\002\274\002j\001\205"
+	.string	"\221"
+	.string	"\213"
+	.string	"\255\200X@* \021\340\021 \020`\026p\b\360\207*\005F\201S\007\362"
+	.string	"\366\210\002\223\234L\213\254\304\300\302\204\004\030\005*\001k\254_\321\335d\205\0270\272\356"
+	.ascii	"\356X\277\314$\260\004k\252r\001\243@\"\265(\340\021#5\2668\320"
+	.ascii	"\331L\325\300~\240\332\260\017\321d\353\270\243\022\222&\353"
+	.ascii	"\2070\262O\302S\023\262)0\307\216\356!\353W\324m\301\243\f\030"
+	.ascii	"\005\204\002J\251R`\016 \016`\016\240\223\231\267#'8\266\255"
+	.ascii	"\037b\307~\210\244\375\020-\366A\214\331\007\341\266\017\"\311"
+	.ascii	">\b\253}\020L\033X\003\316\003q\034fE\0067\226\365"
+	.string	"A\264\330OA\314~\nZ\366S\220\356\247\300\265\237\202\217\375\024\230\366S\370\331\377\340e\377C\225\375\017H\366?\344\330?\360\005\220E\020\224\226^\326'!H\016\310\002\370\263\204\016\b\016\270\0028\004l\001t\241J\201,\200B@\026\300xG\227\242%\337\330\215\270\350\247\377\201\306\376\207\240\375\007\310\355?\240\311\376\003\244\366\322\2604\324\304\274\324\375\354~[~`~s\277\274\237\231\237\227\037\335\357\313O\314/\314\217\314\257\314/\356w\3467\375\351\375\340~\\~h~w?\274_\227\237\334o\214*\375\245\371\275aI\203\022\275\"%\001JY\026.*i*\030\232\032[W\324-+\n&\205\355\211\031\025l\312\332\324\n\331\324I\036\227\264n\353,\3134\211Y[\024\023\310\322\374\264hM\327\234L\253H\225M\325\306\242\\\2774\2771%xLXe\366vL9A\377\001J\373\016\270\333w"
+	.string	"\334\276\003\244\354;`\311\276\003\262\366\035\340c\337\001K\373\016\b\332o"
+	.string	"\335~\003\320\366\033\260\265\337"
+	.string	" \373\rx\332o@\214}\006\230\331g"
+	.string	"\227}\006L\331g\300\326>\003z\3543 i\237\001B\373\013\360\262\277\200\266\375\005\224\355/"
+	.string	"k\177\001@\366\377\023[\201\374\232\374\230T\301\001}\311z\311\227\330\227\024\232\223\254\277"
+	.string	"\033\373\252\227\221#\373\312\t\022\254ld\302\312\244\b\tY]\323\255\037\221}\265d\344v\204\007\366\343\372y\375\302~J~I~_\277.U\372\333\372i]\375\"N\301R\205U\243\257\200\274}\005p\331W\200\226}\005\\\331W\200\224}\005H\367\025\220d_\001Y\373\377\r\371]\001\227 \241\202\373\t\371E\177A~V\277*U\372\273\372Q\375\007\304\027tuJ\212\222\2563x<n\370\260\021\355\361\273\372\375\220\022\324u\006\257}b\204K\216\240\366\2516\354\0250\265\257"
+	.string	"\247}\005\034\355' \315~\002\346\366\0230e\307\323\227.??Y\237\204\033?\242^6\200\314-UM\177O?\032kJV5\202Ds\374\240~8~Q?\251\237\323O\207*\375=\375\232\340~O?&\264!]g\360\342\370\253\r\003\003#JQ?\001J\366\023@d?\001:\366\023\300\264\237"
+	.string	"\026\373\b\310\333G\300\227}\004`\331\377/\351w\204\3266ed\255\002#\317m\323\373\025\375d\374\220~3~F\252\364w\364#\372\035\375b\340\375\216~/L\3003\242\312\013ze\355\260\022\324G"
+	.string	"\220}\004\350\330G\200\215}\004\034\355\377\347\342\327B)\f\215\220\254[\270`~?k\222\243\t\004\235\371\255\370\261\370\r\251\322_\213\037\320\177A?!\036\277\026\256\227_\013\267K\232\351\217\356-ojk\026J\325\300~\213j\303\036\001?\373\367\363\257<\334/\2778\023`\007\2322Y\357\261V\216\246\\\262>\n`\316\270z\256\031\027\317E\343\346\251R7\215K\306+\215k\347\216Y\223\034\355\262 /\323\027e\352\352\246n\032\367\256\313t\232\306\rs\305hj\r\213\030WF\314\312P\037\205\256}\024\250\366Qx\332\256\0305\254\211\017\275\254\217B\213\375\003\234\331?"
+	.string	"\335\376\001\322\366\017\220d\377"
+	.string	"E6{"
+	.ascii	"\034\373\007(\332\277K\347\316\241\311\370\022\306\235;p\207"
+	.ascii	"\231\230+\347r\301j\003\022\223u\334\227\320jj\324#\353\2370"
+	.ascii	"\306\335\342\276\251R\027\316\325\342\346\302\271mRlJW\304\034"
+	.ascii	"Wp4X\375\023\352\366O@\333?\301,\213\025\263\030I\\\326'\201"
+	.ascii	"\212t*%\033yM\311FP\246V\\4\262\351Y6Js\257\270X\3345W\315eS"
+	.ascii	"\245\256\025\267\212\0257\312U\221\230)X\352\r!@\352\206\372"
+	.ascii	"'\344\330?\301h\337\0041\373&l\3317!\312\276\t[\373&\3700kr\301"
+	.ascii	"\027\213\351\022\335\r6\247lDCF6\232K\362\260C\252\344z\271J"
+	.ascii	"\33417\352.q\237\270RW\314\035\342\226\271B\\\".\024\027\314"
+	.ascii	"%s\213\270L\\#n\230\233\345~\271\\\256\023W\313\305r\217\270"
+	.ascii	"]n\022\027\211{\345n\251R\267\211k\225q\344\031u^9\322\216\362"
+	.ascii	"\232\260\374\310F^&HA1\322\363\261\257\304td#\267\211[\345\006"
+	.ascii	"\321A\225\215\246\262\321\030\\T\231\007\036O\242=\366\225\223"
+	.ascii	")\224\225\251\n\366\2446U\301\230\344\2465\272D\201p\271M\\\033"
+	.ascii	"sn\023\027I\235\026\321]\301\212\343/\337[\034\232-\017\3207"
+	.ascii	"\341\305v\203d\243v\310^\221]\3267Ah\277\004\273\375\022\332"
+	.ascii	"\366K@\333/\201\310~\t7\366Kp\261O\302\227}\022\332\366I@\333"
+	.ascii	"'\301\311>\tJ\366I\320\332'A\310>\t9\366Ip\261?B\230\375\021"
+	.ascii	"\330\366GX\262?B\326\376\bU\373#8\355\217\320b\337\203\336\276"
+	.ascii	"\207\271}\017e\373\036\242\373\036\226\366=\304\373\"\274\355"
+	.ascii	"\213\360d\377n\221\033#\310\366\304"
+	.string	"\216\213\005\022\227\310\205\341\276P\245n\f\327E\213\\\304\006;\206\350\r\017\317\215\341\016\331\021\275\341\371\252\350H\202\265\365E\330\332\027\341j_\204\247}\021X\354\337]\341\n\265\240b4\306\r\332{\356\217\033\273@\252\324\025\332h\276\323d\254gWh\227\331f\200fl0$\312\025\332g\204\270Y-\341\255>\206"
+	.string	"Y-\341yp\205\266\236\235\325\022\236+\264\363\366\224\031\005\030\202d\265\264.\201\252\232\006\365P\265a\037\302t?\004\270\375\020\322\366C0\333x\024\004\325\342\236\304Y?\204\255\375\020|\354}\207\206&\355l\314\026\243J\367\335\266k\261\247\353\227\331.\223r1\275c\215v\230!P1\026\222\032\212\306qL\301\007\037\374\354~0\261\372!\320\330;L\216\252P\033\2003\332\346ld]\307\003\252\b\216\254\337\001\315\276\n\347\342\f\230\355E\225\356/\273\313\376\302\276\310\321+\253%\254\325L\030\226)\253\337a\216N.\212\321\024\231\254O\202\334\306\222\243j[\217\007h\315q\331m;no\331Z\366\333v\333p;\313\236S\245[n\263\351-\267\233\354)j[\017MFoJe_\231\331RKR\305\n\230\256+_^\244\325y\330r\033m_\251^r{m\r2\024\372\212e"
+	.string	"\211\256\206Dqld9m\231@\277\203\225\375\016N\366;x\355w\270\332\3570\265\337\241\306~\207\026\373\006\300\3337\200\227}\003d\331R\330 pyhY\337"
+	.string	"Nv\213]\246\266\365\320i\324\246g\333L\225\356([lG\031\372\342\030\350J\024\210C\207\f\027\254\206\202g\305l,\353\033\300\212,\nE\272\311\366\023U\272\307\266\2231\366E\216\232\260DDw\206\347#35\023f\353\027\340n\277"
+	.string	"Y\366\013Pe\377\233\311\006\303\262\203\021#\353\223\320\343\3114\216\2776\330\272cs\255_f\356\230\022'S\260\255\003\212\222\375\265\223l\257\275d\207\251\322\r\266\273\246\244s;\310\242q\374\005\266y\250q\026\254\210c\250\247V\211\350\r\217\210\204\256\310\221\241~\001\202\354\255\254\317\266\374H\313\372\005p\332W\275\250\252\242Y;\272\207\f\177\212\261P\023\254\255\265\213l#\033\311\306\332G6\021U\272\263\266\225\024\b\220h\025\027\252\037\\\202\354\254\355\203\207\325tg\355 @?(\334IE=\2715\226\226\314\212{\310\225\007\366\222P\f\245\254\267\020\255\204eG\220\254_"
+	.string	"\032\373\005(\332\007\001\315>\b\323}\020\262\354\203@\266\017B\327>\b\321}\020\236\366Ah\261\377\201\336\376\007u\373\037l\331\377"
+	.string	"m\377[jG\311\275A1\311:\207\256\313B\005)\353\177\240d\337\204\033V\323\226\314\214\256\351\326\222Xt\337\330H^\333i7\355\247mc3m\250\215C\225\356\033[\351\273\206\272FC+zc'e#\013\202\342\370\311\211%C4D\t/\216\277\202W:\274\256\212\372\037\314\330?\325\206\375\007?\373\036L\367=\270\262\357\301\223}\017\262\366\277e\354\2430/H\232dm$\274\202&i)\353{0d\377\33716\214M\244Jw\321v\321b\017\205\025\355\027{Hm[Z"
+	.ascii	"\225\255i\034\207\355\242\315\"\367\330\200\f\321\017;a\233\r"
+	.ascii	"$7\266\276\007D\373\036\26402\242\202\312\372\036\374\354s0\263"
+	.ascii	"\377\275b\013-u\b\311\312z\007I\275X\321\262\312\372\034\262"
+	.ascii	"\354\223P\246\315\033\n\025c!)\271\350\216[2s\321\2756M\213f"
+	.ascii	"\377l U\272\343VOz\246\315\223\332q;\327z\221\352\262\343\366"
+	.ascii	"K{\267~E7\214 :V\311\2157\262\240>\007*\373\034\266\360Z3.\024"
+	.ascii	"\223\022\240\254\317\201\b\036\207\252}\016Nc\202J`a\224\262"
+	.ascii	">\207\"\2736\214*m\305\264u&L\327Z1-\030$B\256\232\360|J\260"
+	.ascii	"f\354\261\372\034X\354wPf\277\203/\373\035pi\273\3443Y\270\b"
+	.ascii	"\311\372\035\250\265t\035D\331\177+\327r\3411\345\312\221\254"
+	.ascii	"\377\226K\013%\215kk.k\036o`l\232%.\210\262D\301\314\024\025"
+	.ascii	"\261e\021\203\242\242\341VX\361\020\225\326\345\205jz\267\"o"
+	.ascii	"\252r\275\240\233r\301\230\233&\321\322\265\205g4\005\223\215"
+	.ascii	"\272\276\374\200\323\002+\2634\345\341\306\345%\2447U\223BUI"
+	.ascii	"[\301\306\334\230\336\375\244i\263\332\2666J\233\244u\322\022"
+	.ascii	"i\317Zi\313\244\325j\265\264C\332+\355\2246\256\005k\251\264"
+	.ascii	"V-V\373\244\345j\203\264BZ\266\266J\233\326\"i\243\355\217\366"
+	.ascii	"\253\335j\315Z\036m\221"
+	.string	"\026\255\265\322\276\265b-\220\226\252\355j\341\332#\255\222\266\254m\322V\265RZ,mX{\325z\265d\355Z\253\326\216\265[Z\267vIk\244\365\321fi{\250\322\026J\253\343\355\216v\352\331E\227(\217\265\261\030r\323.9+(+P\300\362\210\246[@h\246+\017,O\240\2642Z\034\353\227\031\013AkS\026w\361^\224\307\026$iek\227\235\323\320\227)\034\232\027\323$sA\3044\325\365\210\362`s\022\205B\273\022\345\202u\2677\024\235\203\272\262\202\261d\226\330\340\321Ba\257\260Y\303\237b\034\357 \213\362h\363R\271\332\026o`\266\272\300\001Y\273\2468\326\251\270,\226\256*\272\336\005\235\231\352\305\210\236\201\021]\273\302\354x\312\241\306Y\201\322J\225MW\260\026\n{\307\024\215\343/3sr/\324X\267QU\003{2\252\r\373\016\302\366;(\262\337\201\216\375\016h\354w"
+	.string	"\264\377\026\351-\216\2775j\217\332'7\311\312\031\224\254\235\3264/\240pe}\016\364\366\377\226\251\265\321\336h\227Ti\333\324*%\341\230\266Mm\r\0373zxh\233Z\032oOEK>\226\354\336~\372\034\230\331\347\300n\237\203\351>\007`\3669\360\262\325.\017o\221\264\0162FWY\237\003\271\255NU\r,\006\252\r{\016\250\354s\320\265\317\301\325>\007R\373\034 \355s"
+	.string	"\264O"
+	.string	"0\373\004@\333'\300\222}\002\004\331'\200\215}\002\264\330\337"
+	.string	"o\177\003.\373\033P\331\337\200k\177\203\253\375\r\246\3667\220\261?"
+	.string	"4\373\003\230\333\037\200\224\375\001(\331\037"
+	.string	"\326\376"
+	.string	"\246\366\007Pc\177"
+	.string	"C\373\002\260\333\027\300\333\276"
+	.string	"\242\354\013\340k_"
+	.string	"U\373\002\310\261/\200\241}\r\246\373\032\260\355k\020\266\257\301\220}\rr\354k\340b?\0032\373\031\274\355g"
+	.string	"e?\203\254\375\fx\354g\360b?"
+	.string	"v\373\001h\333\017@\222\375"
+	.string	"\004\331\017\200\215\375"
+	.ascii	"\254\330\307`o\037\2031\373\030\304\355c e\037\003$\373\030D"
+	.ascii	"\355\237\235\302J\021+\343\305\306Ja\317jDi\222u\224 \030&\261"
+	.ascii	"'Y\037\203\242\335\305\306\204u\302\222\261J\3301v\t\333\204"
+	.ascii	"\225\262OX(\254\030\033\306\232\251R\266\214\365:\373\305&A\302"
+	.ascii	"f\315E\207\340E\261\272L\3312\266\b\230)[\306j\261Yj\333\222"
+	.ascii	"\326\242\233\226\261B\330+\265\255\207\33623\335\222\213\036"
+	.ascii	"\361\022\005\313\233\032\321pj\333\322\002\260\276pea\313X\""
+	.ascii	"\331\350\213\230\272+,\341\327\223\033H\026\350_\240e\253f\252"
+	.ascii	"\006\266\002\325\206\375\005d\373\027,\331\277`k\377\002!\373"
+	.ascii	"\027\370\330\277 *\353\331\310\003O+\033L\262\376\005M\373\027"
+	.ascii	" \355_\020\357[\020f\337\002,\373\0260a\257\3248\2258\246"
+	.string	"*\017H\326\267"
+	.string	"\311\376\331(K\365\246\244\207\214)4\276\240\035\331(Mt\216\245bu\354\361P\343\316D\253\330 \254\025\013\204\375\241JY*\326\207\030K\305\366(\0332\304\f/\216\277\366\224+G\334\202\372\026X\355[\320c\337\202\034\373\026\320\330\267\300\305>"
+	.string	"\364\244\242\306\312\270\226\240\330\034\252\224\215bq|=\301u\231\360{`\243X\247l\024\203\230\2563XA$\\h/X}"
+	.string	"\224\355\003 k\037"
+	.ascii	"<\366\3176\2617`$\211\303X\033\354\022\313\244J\331\033l\r%\255"
+	.ascii	"\244-\366\006K\203\307\020\255$\2748\216\263\306`I\262\365+\b"
+	.ascii	"\263_\001\334~\005i\373\025\220\355\237\235\301\312x\022\025"
+	.ascii	"\003%\353\026,\321\020\250\030\307AX$\366H\225\2622X\031\254"
+	.ascii	"\221\326b\233\352'xRWX\375\n\234\354\253p.\350\330\030l\021\013"
+	.ascii	"C\225\262D\367\032\312\321.Q\"\366E\216\376\252f\f1{v\355\320"
+	.ascii	"\333\372\025P\355W\260c\277\202\034\373\0250\355\237e\301\345"
+	.ascii	"\206]\222\254\331 _\336\216\027]|a\210X \337\236\017\r\033\263"
+	.ascii	"B\2764\354\017\273B\225\262A\276\265\373\364|g\356\322\376\005"
+	.ascii	"\316\306\024\216\r\362\231Q\343\226\300\200\363\321\355(\232"
+	.ascii	"\306\361\227\025\337\025\024X\034\271-\340\226"
+	.string	"\246v>\274\0251\270\330 \237\232o\013\234\221R\3063\253\002U\243\327/U\003\213\202j\303\276\002\242}\n\366\310\370\312\334\265?\346Z\\\361B\346n\007mH,k\337\235\032G,rcK\312\332'\246\265zB\262\225\215|Rd\274\224\265\325\371\246`\362\221&(\262\272\2039*\363\242E\326>0FkV\335\030=/\377]-\264\306\203.k\037\226(4_P\\r\2769.`\342\206\330|\310qi\177\342\232\200\342\356\343R\304G\243F\215'K\276\2671{g_\262>\005@\373\252\324\347\346\323\202\024%\t+k\237\026\032j\r\243\032<|Y\326\344\310\246\262\260]q\362$\213\205:#G\306\207\305\267\246\245,Y\313\232\356\343\264]Q\343\330\032+\364\306\262>\316\224}\234'\373\367U\241\362\005\225\205\006\355>*\317Q\025J]\001\206(/k=\305\303}hC\031YK\236L\221b"
+	.ascii	")USY\373\244\274,\263pL\322)\337\231/J\334\214\275'Y\373\314"
+	.ascii	"\264\231\251\013\273\254\217\243\265O\002\326\313\326$G\023\260"
+	.ascii	"\340bc\352#\363e\371\232\\\211 &(\352\tO\352\033\3639\361=\361"
+	.ascii	"\225\371\240\250R\037\031\231OluC\201\305\221\313\242\211\323"
+	.ascii	"\264\210\222\250'<\037\231\357\210\030\251\250'<\037\231\317"
+	.ascii	"\210\230!QOxq\374\245f\261\243a7\324\3079\342c\202V\007$.\353"
+	.ascii	"\343\364\330\377}J|a\252\324\267\344Z>\256\0260\246\276%\276"
+	.ascii	".\037X\024\2070J\242\236~yW\324\242\260\372\367\201\371\222\224"
+	.ascii	"y%\241e\355\373\002\306\020\"EF\326\337\240\347\363\332\300u"
+	.ascii	"\337\326\330\322\031\030Y\373\220\264\021};\226\344\300\313\372"
+	.ascii	"\033\300\354o\240\333\337\340\266\277\241\312\376\206\261\375"
+	.ascii	"\r\\\373\033\212\354\337G\3047\304\f\250\307\212\254\257\202"
+	.ascii	"[\230\306D\311\372\033z\354\253s>\316\254+v\230\221\323py\\\364"
+	.ascii	"\246>\036\331H\n\314\324'\304\027\304g\345\213\372\250|?|U\252"
+	.ascii	"\324\007\304\327\343j\226\234DHk\321p\353W\264m\022\2047\365"
+	.ascii	"\001\361Me\243\022\270\354\276\334\242%@AE\375\r:\3667\324\330"
+	.ascii	"\337\340b\177\0024\373\023\224\331\277O\207OjHo\252*\353\250"
+	.ascii	"!\217\250\022\222\254?\201\333\276\n\347k\001$\372\203d\016H"
+	.ascii	"K\335\362\305[\271k\217+j\246,\212\227\246&9#\215\352<(\321\025"
+	.ascii	"X\276 \237PVT\247\351\212\256`a\025\365\311\360\025\371n\370"
+	.ascii	"\232|6|3|L>#\237\222\317\311\367\344\203\362\341\360\325\360"
+	.ascii	"-\371h\370r\370\216|"
+	.string	"H\252\324\227\344{q\037\f_\f\017Z\217\214\004\027=\242*\230\217h\3157\204F\3039\211\372\222t\031\r\007\343J\214\235\326\261\025'\205\203\376\004M[]R5\2606\252\r\373\tZ\354k\020\263\257A\313\276\006\264}\rb\373\032\260\3665\364\330\034T\r\3545\334\330\327 c_C\320\376\315t\377\206m\377\346l\377F\311\376\315\220\375\233\251\375\033\033\3737F\3736a\366\257\311\340t9\203\205\355n\214\t$\361\223\254\305\374\254\274\261H\312\3726[\366\325\255\270\036S0zN\235\256I\216v\223%NS\271\034}\212j0\232K\216\256_f\273\305\016\034^\364\027m\247\353\364T\207Q\245\032\214\246S\327\264h88\037\3218\216\301\350.\032N\004\264\250\256(^\034\307m\227\2141Z\206\3726E\366mz\354\333,\355\333$\355\333\034\355\333\270\330\332M\277\251R\034\275\305-\250\250)\353\333"
+	.ascii	"\355\022\304*\016\373=\025\207}\r\23266%4`H\263\266\242\323\206"
+	.ascii	"k\034\003i,:\213*\325l\372\312\265\232^\273j\302\257\202i6ME"
+	.ascii	"\247\r\177\276\342\037\326\t\320\021\246,M\363\312\302\352|\244"
+	.ascii	"j`\005\240\332\260\257\251\262_s\266u\332\257\247h\264a\233\021"
+	.ascii	"#qY\253`\036\256\253\374\240L\221\030e\375\032&[\035R5\260F\251"
+	.ascii	"\226\222\247T0r\243\313YY\260\013\213\022i\326eZ\372\262\241"
+	.ascii	"\033\307ij\3212M\026"
+	.string	"\203\0205$\212\025\307q\024m\246Ju\231\206\242q\204\\2\322\274\260\3725Q\37357\366kZ\354_\217i'\\\220`8\311z\205\322N\326\034^\232\350'ZL3Q\245\332\211Vr\035\246\227@i'k\224:%\273\262Z\302{\322NV\034UgVKxq\374\245\235\254;4\330OK\026e\265\264\257\374\314\260\361\323n\254j`\325#\325\206\275\221m\353$C\255,JWY\337\210\266W\036+\325\032dMr\264\307\202\352\246w{:K\260\340ei)'=\214\224)\032a\315\214\274\230\220\021:\031\306M\317\220\335\021\243k\321\221\272\026c\236d\001C\023\246FL\361\351\212\005\2324k/^j\302X\025\340\b\324\036\231/\257\tS3\375\212\213\306Mk\352~F\334\346\322\300X\222\005\346I\r\230U\250\212\213)L\234H\233\370%\312\264\204\203h\206\305\013)\255\254\345\344\210s/\372"
+	.ascii	"Rq\006\325\270\325\270\325\304\275\006\210\n\250\344T&\212\027"
+	.ascii	"/%q\370k\340^\303\302\313\030\267\254k\266\034M\317\211\327\226"
+	.ascii	"\254k\336\232l\373\257\321\"\2252\206\315\254\215\330\204\214"
+	.ascii	"\223UM\026\"\225\023\033=\244\262\306\202\205H\245\026]kL\371"
+	.ascii	"\332\313\372M\262)Sj\324\210~\330\341\001\265\332\306\252\256"
+	.ascii	"\274F-O\352.\353\032+\302\0343\314\020\331\312\272\246\211\031"
+	.ascii	"\026W5U\236\020\275\371\250\251RCE\312\025&\267\032\264*dn2\262"
+	.ascii	"~\263k\277\t\244\006J\r\224\2323\261\351\020\006\222S\232(\257"
+	.ascii	"9\023*\321\250\222C+\353\0323`\325W\023\232\254k\312\2021f\314"
+	.ascii	"\200\262jJ\325<\251yR#\365`JR^\232\213e\213\224\253f\3545\322"
+	.ascii	"\026l\214\334O\363FMXMX\215\030\224h\313\306\205\255I\223\327"
+	.ascii	"\210\2658\202\270\b\313\272\206I\030'i\246\262\256Y\"TB\"E\350"
+	.ascii	"\250)\324\325U\003\206\263\343-\255\264\351o\t\233\030\215$\257"
+	.ascii	"\001\033\356u0\346JH\3265_5^<"
+	.ascii	"bj\260j\260j\266\256\234\300\260a\005\r\001I!y\315VZ\035\034"
+	.ascii	"\222\326\2220\270\251\254k\262\322\224p)\313\372<^\373<A\214"
+	.ascii	"\030\271:\302\304B\252\310R\326\347q\"B\304XD\252\356\n\253\f"
+	.ascii	"L\212Y\326\347\021\262\262\252\271\302\201Z\271\\)ZRe\324\331"
+	.ascii	")\ty\315U4\033\335\371\360QS\245\244\356\n\313\025\023\344\204"
+	.ascii	"\n\220\327T\351-z/\312\262\256\241\252\371\321\245N\355\254\346"
+	.ascii	"\007\223M\207\216\032\0368c\234\342\256F0e\314E\315\324kx\200"
+	.ascii	"\311`\306\270de]\263\303w\205\035\322B\303\204y\244\006\252\006"
+	.ascii	"\252&*)\037\241-\345\250\311\361\232\250.v\\wQOO\032\220\322"
+	.ascii	"u\006\313\367d\250MK\326g\316hjj\327\210\206(\375\2708yq\312"
+	.ascii	"\3722\340\3250\3250\021\251( \342\344\265\344\342l.\212\024%"
+	.ascii	"\245\232%\034\250\2372?% \031\2263y55^\263T\006\264b\245\254"
+	.ascii	"J\206\255\232\244\232\244v\n\321\033\336\021'*iA\220\220\216"
+	.ascii	"n]Q\2541R\346\264d}\031l\324\020\325\020\325\034\025E\177{^\342"
+	.ascii	"\242j\214^s\024\224C\"s\312\372w5EoGX\316\024\335h\346\316(\232"
+	.ascii	"\365epQ\003\243\006\206\007\240#LcI\\@\262\376\007\2465.j\\\300"
+	.ascii	"\275`\302\302B\323\303\022\222\365?\320V\323\242\246\2051MY\321"
+	.ascii	"R2L\0171Q\200\200jV\340\354x\213\315\3134\030C\n\216\265\232"
+	.ascii	"\0255BAjb\266\324\b\325\004\261@\204 \221\213\352EeEk\342\327"
+	.ascii	"\304\306\"8P\353\027;1v\030\2149\252\221\365?\200\204\207gL\203"
+	.ascii	"\003\265"
+	.string	"rI+Z\302Z\202&\r\b\315\215i\334\252;\274\037g\330\230\220\344\316\350\371\344h\024\0051c\314\023\361\205\253J\326\377\300\212m\246\325\261^\251J\023S\206\f\031\"\025\016\324Z\207t\204\tK\210\212)I\027;;\343\030\025,62!\312j\t\253\006hGT\314\215c\260\374\030\022\266\224\002\006\214qz&\212E\352Tw\343\364\315+N\016\211\027/D*\265\370\025\344Eo:e\310\210S\326_Z\321\235\316\210\204\003\265\326E\035a\032\"\021C\322B\207\234\234\021\311\bp\256\215G]\326_\026\275\275\031\343\330'#\252<\2542i\216\324\340n\214C#nE\235\300em\334r\264V\215M\n\307\016\231,Y\214Z\316\222\362\322\324\251\256 Um7j\201\312\321\002\357--\315\210\245\352\247e4\245\277\200\205\271\263r#\2265\035\325\201\327bMmM\n\003noG\032+uW\\2"
+	.ascii	"\3702D\326\204\354\30622#\2255N\375\212\227\240~\302 @\017\230"
+	.ascii	"\004F\022-g7R\271\021m\004\023\376ec\031\211\003\312\3328\305"
+	.ascii	"(\305\030\345_\210|\211\021&k\243\331\321\202K\\\360x\024\213"
+	.ascii	"\254lRoAY\033\241\270gO;\242\262~\373$\356F4\353\357|9qb\034"
+	.ascii	"c\213\252RqGM\236\33486\245\022\303\213B\304\270\304\270\304"
+	.ascii	"\330D+)/\215\270\306\303\352\310\310\344\306&\302\250\0167(;"
+	.ascii	"=\214_\306/\243\022\034\250\2370\006\310K\"\263\206\027\224r"
+	.ascii	"e\026\033\301nTbD\362\243\221\304\007[\326\306$\231L\020\207"
+	.ascii	"\226\037X;M\306#\306#\306\256\243$2k\354\212\267&2#\327\215]"
+	.ascii	"\272\312\n\036c\306-\237\026\260\2535\343\226\021\t\031\253&"
+	.ascii	"{Y\033\261\214Y\252\364kF\255\307\275\220j\312\372;H\273\004"
+	.ascii	"\361\032\373\035\030C\206\030\213,\361\242t\205\247\372h2\363"
+	.ascii	"\203\210*5\026Ar\366Uc'\026\"\344\206\f\333\345\212\216G\326"
+	.ascii	"\327\2413V\031\253\214Vk@\031gn\214\031\203\334h5c\216\210\207"
+	.ascii	"N\226\036=\214T\024\244%\345\245\371\214\030\271b\373q#\025\230"
+	.ascii	"3\323/\265\254\215>\204Jj\023\244*/R\246\246fh\2422\303r\265"
+	.ascii	"\330x\344`\022\025e\324\241\202\305F\"\030zq\225A\222\272QG\313"
+	.ascii	"\345\343(\252\245\004\361\304\230H\263\276\016\021((\0224Q\231"
+	.ascii	"a\351\020\202\004\227\365u\232\236\236\214H\032\222\232\250\314"
+	.ascii	"\260\254\2324e}\035\"\343\222q\311\330\324E\204R\343\t\f\343"
+	.ascii	"\215\033\233\264l`\261\221\265\221I\250\244\3428\023\004)k\243"
+	.ascii	"\215\177q\361\363\002\206NlL2&\031\225\226\232\250\314\260T8"
+	.ascii	"\2410GF\0327*qa\221I\212\361\337]\301\266\356\274\304\310\220"
+	.ascii	"aDj\2422\003^A\253BgD\0222D"
+	.string	"*\206\233\221\321\017\211\350\r\017+\211[\3264\353\347D1\022\031\211\210Ts\321\240+g\216d\375\234%F\030F\030D\252)Mb\242x{\315\314\320U\326\31792\2560\2560\272\320\300$\364\361\025\306e\034\272\321\005ZnJBVel\261mD\211\3000\2660\262\330K\212\306\0201\262X\231\216\274\246h\235\331\3333\0069\001\355\224\206P\311Okq\306\370\306 #\320[\220\255\254\215?\304*w8\314\262\376;\335\277\013\256\375w7\354Q\265\310\372o\026=\275\"\2323Z.\342p\024\317\274\210\246\310\335\222\266\256\267\212\0313\305\244\027\321.T\\d\311\372/W\2312\305$\034\250#Lx^eqPY\377\275\021&L\361.\b{U\343\310\325\032\203\306\024\"w\3051`\330\262\\\311\272(f\277\231\331\241\226\365_\026E;\345\364\313\227b\335\016'&\254\260\2643vE0/\326q"
+	.ascii	"\306\f\032\312-\\\316\245\330\005\007\352\307\316\203\0323\242"
+	.ascii	"\236\360\206J\202L\335u\241\263yQ\224D7w\307\245JM\316g&\244"
+	.ascii	"\2424#I\326E9e\225\267\267\"\334o\211\350\rO\373\310B\364\242"
+	.ascii	"\270\345E\270\237\2246/Y\256\374\322\242\245H\264\025\215\343"
+	.ascii	"%\016>5.(\026Y_\351\203\215\255\230e\203\274&7#/\354\254d\311"
+	.ascii	"\321!\\e\230d\375\244\231\342\225\342\225\342\032\016\324O\030"
+	.ascii	"\004 \021\375\260\013\216\341\025\371)\252\275\270&\304\341D"
+	.ascii	"/\314\220\254\177\327\346\375w\205X_\340ld\375$\035\025*\305"
+	.ascii	"\264\237\021\243\251l\003\212\020]\225\027\323\302\266T\375d"
+	.ascii	"\375;w\314\177\327\270\342\307*\353'\247L\231RL\262\301F\215"
+	.ascii	"\250\362\302\340\354\312d\375\244W\221\254HV<[\362\203\t\013"
+	.ascii	"\217j\b\231\350Y1\212\035\r\242\036Y\233\231E\243\356\262~\362"
+	.ascii	"G\261\254\b%\214\211\364'\353'i\354\233\330k\362&\3051\234\035"
+	.ascii	"o\345u\231\002{\350u\3311\366D-H\223\342\223\242\0232\\T6\242"
+	.ascii	"\332(bjFb\276\027C03L\302\300-\371\222b\222\n\026\033\261Unb"
+	.ascii	"\354\360\232De\351e}\023M\270\270\212Jp\240~\356\332\244$2k+"
+	.ascii	"\344\324\310\300^T\002\202\026RX\326\277+&\371\357V\240HZ1I\361"
+	.ascii	"K\313]\224\244\254\213^\300&53!Y\337\304\326.v\001\261\340p\252"
+	.ascii	"\221\226\365MT!AR\314\312\352\212\361\302\013\n\353\307*f\251"
+	.ascii	"`\261\221\005c\232\250\314\360Z(\323\264\027YR\222j\260\341e"
+	.ascii	"}\023E=^\004\322\243h\204(\246\306\361\022\216\n\2624Y\261\341"
+	.ascii	"\305CK\034\204dLYPU/\032yQ\310\b&\024\213\024\241E\221\311\272"
+	.ascii	"xU\034\242J\257V$\362/\342\360\254\205\023\265\254\217\234\356"
+	.ascii	"\253WcK\240^\215-F?\\\302r6\315\372\305 E\253\337\375\r\331\021"
+	.ascii	"v"
+	.string	"$\353#\345\366\r\260\301\224d\310(R\001\273\320X\274e]\374\241N\025\265\271\371\370\335`\030 J?\262>\362m\037\271V\224*J\025\247\256\222\362\322J\220\005\306Wq\307\213S\303\026A\\\300e]\324!T\032\023\363F\246\307\021=\030qY\037)\205\202*\3460"
+	.ascii	"R\023\225\231\352d$\032\225#\030#\fL\313Q\326GJ\025\231\212L"
+	.ascii	"\305\247\244\2744\274u\214\232\\\321\351\305\247'8\314\250\262"
+	.ascii	".6\t\225\310\346\310\264\262.\336\370]\032(<4\032Q\220`\241\261"
+	.ascii	"\264T\024\302\201Z\341\300(]m11\203&\353#\211\212JE%\342\034"
+	.ascii	"\023\313\324\304\303l\r\362\205\354l\313\214\031\305$\021\324"
+	.ascii	"\270\005\023\251\264)\020\0264>\222\346d`q\231\311\220\321\246"
+	.ascii	"w\205\367\013\022\333\202\004\313\310\250H\244\026\277\202\336"
+	.ascii	"\330\242^P[SY\337\003@\2121\2121\212D8P?a6@\362\245w5\202#5\264"
+	.ascii	"\020e2+\272zdA\261`Q|\201\003\365c\227\301\2218[]\305p\362\242"
+	.ascii	"\350B\212\036\026\245\254\213C@\2653\"{Y\337\0032\212-<\360S"
+	.ascii	"\f*\006\025\205p\240~\302p\3102\323s\235\236\330\210R\024\242"
+	.ascii	"J\302\"G]\231\227)\376\250`\261\021\003\240\366\310`i\240\243"
+	.ascii	"-9\212\361\213?\031m\007\325\214\254\211g\210{\373,\t\t\013\032"
+	.ascii	"b\232\025\bR]\01364z\353\013!Qt\350\345\t\237<\311x\303#\232"
+	.ascii	"\321D\246DI\313\360r\027'b\364\304\262\376\261\253K\027\342\035"
+	.ascii	"\016\332\317\324\031\036\321\356H\215k\314\211w\354\030^\017"
+	.ascii	",Y\023\247D1:\302\300\264\310\232h\347\243\263\3621$\353\037"
+	.ascii	"\253\210a\352\244\276\202\332\352\300XqqC\342\205\370e\357\316"
+	.ascii	"\bZ\326?>m\242\227l\306\n\027\016\267\254\177$\222\273\034q\016"
+	.ascii	"g\307[D\320L\205Z\222l\364\230\243;\322fuF\213\026b\234\n\026"
+	.ascii	"\033\001\313\332\334\216\236$\351J\342vb\034\021.\003idQp[\272"
+	.ascii	"\024!\"\006\307\023\030\225\267\254\224\201\300\220\030\371\262"
+	.ascii	"\266F\314\202\263\343\255+\272)\233T\226 D\266\023\263\020\265"
+	.ascii	"\314\245\261\313\232\210\245\312\224)\304+8P?a<\240RC\314\225"
+	.ascii	"_\027 l\\\210VN\274\242N\201OsD\300dMLs\211Hh\323%b\225\272\264"
+	.ascii	"\031AY\023\251\f\271\024AIe\375\016\350 \242u\340\210\b\205\b"
+	.ascii	"\205x6\\qE\351JC\371\032\262r\342\0311J\222\024$4b\024\242\031"
+	.ascii	"\017%rig\352\266\322\034\225\251aLX\311\255\310\372\034\330\333"
+	.ascii	"D'D'D\2514\272\343\033g\344\306N\224\272i\360"
+	.string	"\334\362\262&>QW4\375\3602\375\357\262lFg\362\262>\007\354\302\302\210M\222T\273\250,\027LNl\322R\261\355@\312\232\270D\250\244W\f9\003\305\201\270\255-\"X\023\261\242%\274\244\036JFIN\004\023^\221u\355\005\255\260\230\232\361E\364j\342\212\306\310\232\330\325d\314\224]\326\347@\331&r\251dRr\0348ru\"\326\025Q\253\235\202\023\007\t\305O>l\364j\320=\341\305CM\034t\246p\254e\235\250\265\306\356-1\213zY\021(YO\262&\0329\361\310\357\266\\\340\324\300\262\376\006\3666\221\310\211E~\327wcF\027\"Y\177\003y\373'\016\371\335`\21756\273\254\277\2011\373\033\370B\254\252\"FU\260\330HUJ\312K\303\212\343%\016@\035cad\254N\214\0061C\326\22651\210P\311\310\034\023\246\254\177\3475di*\353o\240\215\370\203\370\203H\305"
+	.string	")j\321xi\211\003Q\250M\253\312\235*%R\271\021\t\362$mj\212\330#\216\203\263\030\316\316(\341qb\017\342\231\274-@Y\377N\315B\303\205E\326\337"
+	.string	"\023\0348\210:\224t\360$u\242\216 Y\031\021U\326\304\250l\264\273\2728\245eM\314\221\267"
+	.string	"Q\"&k\"T\017\242\022Q\211\350De"
+	.string	"H\031\020\211\301\244\351D\247\250[\214&Y\023o\020\231\254\204\220\025eM\254Adr\315\320\260\375 2\021m\264Yjc\232\232> \325\005\013q)\230\264\221\266\304C\033H\"\"\021\221\210Io$0-q\b\212\351\202\033\312\372'\31681\351`\206[hS3Y\377.\323\370\357\036\321~\340e\375\r\374\034\t\231\216\2046\324\350\220\006\324\210/\210/\210EKNX\"\022\235X\364\243\323ra\22551\006\021F\222\241\241l\264\n\305O=Z;_\231\222\032B\262\276\006\214\354\237\310\202\310b+\310CL\231\214\254\257\001\036\373'\n\021\205r4\203\305G'jh\235\251kT\240\230\262\276\006\\\354\237\bD\004\312F8P?v\032\034\3258B$c\304\211*\353g"
+	.ascii	"K^\0361VE\210\203\340\224\234\240t\346\304x\270G\304H\310Y\326"
+	.ascii	"\3034C\262\025uf\262~\006\242\354!\232\241^\006\270\366?\304"
+	.ascii	"\033\342e\2435\216\237z\374\35420\264\033\332\r\3118\021\247"
+	.ascii	"\303\273\017\311\374\246n\374l\r\307\270md\310\210\r\307\f\305"
+	.ascii	"\254iEjT\302\"\246\261)V\262~\006\246\366?\0043\0043\234j\260"
+	.ascii	"X\006pG\225R\320\306\0213\272a]\313"
+	.string	"c\t\322W\326\317\200\215\375\f\024\321\321\r\275p\200\212gx@%\251\356\f\027,qgY\017\273\034\205\031\242%\353c\340\314>\006\340\366?\204S\245C\270\241\234\n\026\377\020\251\354\304\330\345\210\265d=\224\373\207qC.\300/\256\022\022:\250\254\265T\265a\217\201%\373\037j\271*\035j\031\276q\200\212\221P\300\202\324\025\215\262\002\264%\353\241\333\2153,oY\037\003G\3661\240\003\013\226a\226\025`\212\226\200d\211.\311z\3106\206E\211\224\254\217\201\245}\f\264\330\377\320\312U\351\320\312P-\203\305?@)4LX\354\224\2442\037\303+\327,t\013 \220\213\032?\262\376\005\362\366/ G\205\312\260\212\n\026#\251Q#\267#\254$D\274$\031V\371\0205b&\353_\340\354\252tx6\234\"\202\032\307P\340pL\247R\264\342\241\224\377\200\370\202\204x9\236\246d\375\013`\355_"
+	.string	"\n\n\224\241Y\006\213\177b\030\322u\006\313L\213\250\254\254\207em\025\031\225i\326\277\200\321~\ff\236<\031J9@\3053\b\220\306\210*\317U\233\241\264%\353\341\330\032\364dF\230\254\037\203\334~\fg\373\0372\271*\0352\031\212\271B1\220\325\017\311hj\255L\022-a\262\0366\371/\350'\244\304\026\225\227\365cP\262\037\203\225\022%\3030\025,\376\251QB\247t\225\004\257ih\030\006\274\363@\254\326\265\210\306e\375\030^xy\r\223p\200\002\222\""
+	.string	"V\221\230)uqOc\262\036~\325\271XR\226\365-`f\337\002o\373\037\"\031\"\031r\255\354\031\037\\\221\025\267\254\207[YD\244\264\262\276\005\320\366-"
+	.string	"\266\377\341\221\253\322\341\221a\026\007\250x\006\nC\316\254\226v\374\250\332\033b\265C\216<ae}\013"
+	.ascii	"\331\267\200\214\375\017\207\\\225\016\207\f\213\030\271\r\211"
+	.ascii	"f!\033Ppd=$\"\303\rJS\326\267\300\317~\005\274\354\177huU:\264"
+	.ascii	"\032\n\361\t\305@A\332+\241\0253[yY\017\243\277\246(k_\262~\005"
+	.ascii	"\330\366+0\266\377a\017U:\3541\254\362\t\305@Z"
+	.string	"\255\022\321\020\245\265+\037sC \037V\375C\037\303\037\300.\233\350\213\027Y\326C*\017\037\002\311\372q\n\222\365\005\252\r[\323\006$\310\376\207Q\252t\0305\234\202"
+	.string	"T\234\304\201+\314U\023\021Kmm\232\365?\334\361\341\324?\224\032\352"
+	.ascii	"\316e\250\266\006\227*+Y\373`x\370p\007pL\r\215U\3267\261\252"
+	.ascii	"\201\315\025p\261\377\341\323\360i\b\245\202\305??.1\212\226"
+	.ascii	"\360\342\270\t\204a\220\026\027S<\200H\256\fY\031\342\310Smq"
+	.ascii	"TB\262~\005\342\246\246\226\313:\004\245\311\334\2160a\371\216"
+	.ascii	"\242H\261\002\206\211\211\225\202\003\026#\021\255\304\324]\355"
+	.ascii	".N\316\274e\375\022S\366?T\032*\r\2278@\001E\211 Dj\210Y\223"
+	.ascii	"*M\224\262\036\326\370\r\301\320\021g\375\022b\373%\216\354\177"
+	.ascii	"\2104D\032&\341@\001\001-\300\212T\327\031/\261\247\275\341\214"
+	.ascii	"&@\220\300e\375\022=\366K$\355\177XtU:,\032\036i\260\370g\310"
+	.ascii	"C\214VR\220\025\260'C#1CcrY\277D\320>\f_\366?|!\035\276\030\306"
+	.ascii	"\310`\361\017\261,h\210\231[\032\027d\262\036\302\370\225\215"
+	.ascii	"-\311\310\3720T\331\207\001\312\376\207,\256J\207,\206C8`\361"
+	.ascii	"\317p\311\023\245\253\237\022\027 K\262\036\266\250\300+\315"
+	.ascii	"Y\326\207ak\037\006 \373\037\nI\207B>*\031,\376\371\005\005Q"
+	.ascii	"\2722rf#*\353\303\260c\377C\240!\220O\212+\024\003=\265ZDoxm"
+	.ascii	"\224\322\231\033Y\037\006\034\373\027\236Q\245\3023\303x/\352"
+	.ascii	"\003JX\225\275\017\343\177\205\022\242\001\206\321=\302\256\224"
+	.ascii	"e-L\343\341\302=6\215\031\030bY\023U\033\266\205\341g\377B3\252"
+	.ascii	"ThF\230\007\001\250\030\251\004\264\263\256\250o\t\255\354-k"
+	.ascii	"a\036\260.\257\301!\255e}\022sww\3022\020\200\002\301mH\024k"
+	.ascii	"\352\213\224\027Y\013\311\230yc\362\225\365I\274\355\223\310"
+	.ascii	"\022\346\327az\211*\025\206\021\212\301"
+	.string	"\001\213\177\3322 \253%\016h\310\312\262\026\332m1vuFY\237\204\225}\022h\373\027\326I\205uj\234O(\206\362\001\244\2424\204\n^\034\247\201\240\335\342\322jd}\022Ltt\302/IH \343\345\302/\253\022\026)\221\254\205]\262\020Q\271Ab\205\234\2340\232\301b\031$D\231:\303R\"\025\365\"\353S\200\313\376\205p\252T\b'\214\023A\215\3433)\255\241\322\221\247&\302\270\007W\374\302\222\350\230\302\334\334\204o*Xl\244\200\266&\020\364\f58-{\250m\201E\217FU[\333\016\034\301&\250\"\024pbc\333C*Xl\004\203\2265\020\330\237\270<\"Y\237\002@\373\027\252\251\t\327\324\342W,5\027\215\343&\020\3346\0309\232\366\020R\023/kY\177\204\335\376\205V\254\354!\034\250\037;\024\270\342=2\276/EoN\262\376\210*\373\027V\271*\025V\021\002\201"
+	.string	"T<#\003!_zW\232\315LQ\223\254?\002l\377B4U*DS\247n\034G\371"
+	.ascii	"\236]\355\347\"\252P\212T(%\027Y\343\370\251\thv\364\005\302"
+	.ascii	"G<E\211\222\205p\200\002\212\312`\252\024\265$\024\242\265$("
+	.ascii	"MY\331\330\217\216\214*\376BFf%X&.\363\345mlL\350D5\n\305:\240"
+	.ascii	"D\343x\r\004\341\023'z^Y\377\005+\373\027\212I\205bB'\353\020"
+	.ascii	"\024\220\224\007G4\364\362\360\342x\r\004\327iG\320\322\327\322"
+	.ascii	"\020YW\326\177\341\n\fL\310\344\3058\216\203\342\370\251\t\203"
+	.ascii	"\263%\0272Q_\004iR\226\2650,\033\375w3p\026G&k\241\022\241\322"
+	.ascii	"4hK\030\036T\274PQ\222\365_\250\261\177\341\227\360K\370C\203"
+	.ascii	"\305?\r(c\302Zz;3\222\365_@\352\352\002\0235\263\265\025\377"
+	.ascii	"\210\t\341\211MK\253\006\017\f\013KHd\307q\374\363\025\033M@"
+	.ascii	"\205\006\035\023\226\224\021#B\"j\034\307\361\322\002\312\004"
+	.ascii	"\211N\240h_]\t\211\250\"\304AoR:4\r\271\220\b\036\023\2663\027"
+	.ascii	"\360v\336\233Q\031\241\325\360lJ\2260Y\337\205,\373\210\020\036"
+	.ascii	"zY\177=aZ\343\221\265\220\352ZG[\323X"
+	.string	"\326w\241l\013}\350\210\001\246,\353\273 \266\277\200fON\222\262\376\272Y:R\224\365\216\035B\251\257B\361SY4\216\2278\254S`\232\234\262\276\013E\204Mo\022J\251`\261\021\005Q\242\037vxq\274\304aoq\005\271\022\245J\205R\277\0379p\304e-\204\022\346\330SY\322\263\034\302$\2453\2671\034<\252\270\264\300q\341\023\022\036\214\"F\231\205\020#\036N\333\005P\016=\272\254\357\302\215}U*\274q\241\215%fqZY_(C\210t\341\214\317\020\332P3\210\343h\034\364\246d\004-\032tLx\361\322\021\207_\270t\241\215\",\234\0274H\262\026\326P\343\334\242\316@e\375;\241\322\177\267\004\034]\026%!\215(\223\0304Hq\253\024\224WE\230\024$rB\002\342\225\365[\210\333\377\325\347\237\215\201\216\3428F\362}\305GAA\366W\257\372T\225\303/TWU"
+	.ascii	"\377\365\037\303\215\2358\246\"#\022\307\261:f\017)\003\272\221"
+	.ascii	"A\374\377\337\020\307\261\214!\241\370G\035\n\213\2221\024\026"
+	.ascii	"ud\034Z\213\222\021\013\311\300\022\212\202R\207\204\242\216"
+	.ascii	"\216\204\342\037c\034\026u4\024G\311(\306aq\215\2410\240\037"
+	.ascii	"uH(\226\021\307Qq1\036\002\222\021\207}\035\031\207\302\242\216"
+	.ascii	"\206\302\242d\030\207\302\200d\f\305Pqq\350K\307Q\374\025\365"
+	.ascii	"c\204\021\006$#\016\203\222a\214\303\242d\270\b\"$\n\bR\274\035"
+	.ascii	"YL\302\252,\2512\206\204\342\"\242&\240\243b\333\320\027T,\027"
+	.ascii	"\307\252\030\213\370(n\213c\001\304q\023\324\221\034P\r\325,"
+	.ascii	"\250\255(H\n\004\245~\305qL\001Q\220\024T,\324\366\243\306mC"
+	.ascii	"D\240\342\230H\320NL\024\307q\\\302\317W[\354Cm\373\321\321\024"
+	.ascii	"\307`\021\307\025\304_qL\024\307?j\334\026\307\361O\034\307\355"
+	.ascii	"Q\323W\0343\025\207\242DDq\274\204C\0247\375Da\021\307Y\214\316"
+	.ascii	"L\306P\230\024\224\207(L\302\242q"
+	.string	"\213\257\037u(\006T\034\215\345\242\216v\330O\2228F\034\307\252\230\035\2251\303Nx$4\272c!$ka\021P\323^\213\254\337\002\221\315\026\334\202\002\213#\327H\211\217\251\027\027\247\350z\027\367\024\205\3031\025\306\256\035\220\251\027\246\3514(\346-\306\264\256\250LP\017\005\026G\356\214 \027+\030\226\267\037_\324\251\215;\271&a\034\234\013vA\201\305\221\013\343\355\306T\350B($$\022\276\020\302\020\306\020\002\t\177\204C\302\240\340\236\220\205\260E0\215p\205*\025\306A\034\017\236\t\242\t\202Q\247J\226\204\261\333\026$c\201\2138\216\352\301*\321pc\303\213\343/\036Z=\320d\240}izybI\274\320\351+.eVf\202xl\327[\217+Y\277\005\026\373\022\330\333c\202w\3042Dc\342\306\214\t\023\264\013\022A2\n\222\365%\020\267\203a$\300\266/\001\264}\t\210\355K"
+	.ascii	"\311\276\004\256\366\037\354B\027\265\002\373\222u\0331\230\006"
+	.ascii	"\311[\216\254/\001\037\373\022h\332\227\200\321\276\004\200\366"
+	.ascii	"#p\267\335\202oZ\364\n)Rzd\375\b\254\271\005\265"
+	.string	"\270q\305L\332\036/\323\004\022\366q\341\202\n6\004\240\006'"
+	.string	"ps\231\201\362m\352,\241M\237\340\t\036`P\366@y\21488F \f7\227\253\r\f+\300\257\316\360;\035\240\311\346\022\371t\241os\205\241\nf\317Kb\331\024\221\343c\002\272\237\360\210\034\037\023\320v'\t#S\350\201\362L\360\235\016;I\030\271\241\007\312S,\342\250\350q\202P.{\206*z\234\311\t\276\223\342\331\003u!\305\323x\003/\233\"\206\037*\370N\007\235\346\222\004\274l.\213\316\022:B\020J\244\223yCd!\305r\005e\363\303\013#\225K&\362\004\016t\005\330\307\205\f\240\027\300M\021\312e\217\020\b}\231I\025 ^\030\222I\344\006\350\n;\3602\206\r/\274|\242"
+	.string	"\272\360\002\211\021*\250\240D\276\317\337R\251\202\n\244\013#^\030\311\364I2\221 6\3504\227\315%\222\347%\001}a\025)\344\370\230\200\216P6\227+\300/\224\347\345aG \341\004\0172 ]"
+	.string	"\302\307\227gY\"\t?]\370\205!\t?\331\036\250\013\320\037\n\025P\"_\022\037\240P#\317\323\231\323\024\261\001~a\200\212\200\016\22102\204\022\371\222\200\006\241K\350\363\355)B\231\314\017<(F\3648ah\021\370\235\016\317W\211t2a\2473\005g\211\rJ\247\013+\310\220D\366\330\300\307\227g\t\003_\236e\t$\314|C\310"
+	.string	"E\226\200_\235bK\001\b\370\325\321\340=\"o\230&\220\320e\b\370\325\321"
+	.string	"\355\201\276,\360\240\350\t\246P\301Y\342\351\204\235.8\223\023\360\200`~\230\340;\035\240\316\036\347\362\211\264\200\362\205\221<K\030\252\002\374\352\030\225\"R8SP\221B\ng\n\312\3462g\3702M \231K\344\211\017\360\3239\002*\202\307\331|C\2740\222\004\374\262p\003\277G\026\340WG\303\b\030\\\030q\001\374\013\001\277,$\341\347\360\211t\246"
+	.string	"\277:A\245\210\347\373\364\201\223\310\034\237&\322\005\370\3251~\247\003t\002\370\370\316\260\204\262L\246O\263\351l\266\357\323\247G7_\346\023\206\262:\315\345\023\206\201\370\235\016\316\234\346\362\230\314i\352,a\200_\235 \022F\206\020.\241P\022\360\253\323~\247C\b@\033\025I\244\316\333\002\374\352lp\001~u\200\037\340W\007\370\036\207D\370\3251\276G\245\b\370X|\217J\021J\344K\242X\204_\026\206\032\276\323\341\351\204\227M'O\b\357\261\b7}P\330\300/\013)\236\305\021H@\001\b\277"
+	.string	"\277:\033\230\310\344\016\214\344\t\001\205\363\271\003;\233m\016\362ej\030\332t&}9ps\371d\262'x\250\300\013/\2371\344\370\230\200\006\341eSD\017\224\2475\352<?\354\300\313\030.\260\201\241F\204\016\360\023\331\323\201"
+	.string	"\024\2740\022\206\376\224\357w:\274Og2\204d\016\323\t\001\035$O{|\206\220\314\321A2W"
+	.string	"\276G\230\351\003\025a\363*\235.\374\232+\220\350\201\362"
+	.string	"\337\343\004\001\200a\243\005\360\006X\003l\263\001\254\001\256\2015T"
+	.string	"\337\3005\026l"
+	.string	"}y\220\023P.{\366\b#\b\n\340\"l\003k\200\217\320\347\313\364QA\303\206\223O\326\007\003\217\023\206B7\300:H\236\025N&\221\353w:h0B\211t\266\200\323\003\345\271\271@\005\362\371\374 \200\036\244\013!D8a\020!>L"
+	.string	"U\212"
+	.string	"\001U\212 Z@\371\302OgO\217\017\264\202\033\025=N\020D\345\273\354q\202\200\212\220\001\212t\341}\372\300\3107\307\346;\035B\320\3611\361*}$\340%\013\360\323\271\003-\276<\313\022/\214\f\341~\247C\bJ\346\322\307\304\313\203\234\300\017D\017\224\247\002\347S\205\216\206\266\200\003#+P>\221 B\300"
+	.string	""
+	.ascii	"\025\314\236\227\204\212'\222\207\307\007\206\035(\222\231\203"
+	.ascii	"\204\221!0 q\243\001\206av\0025\315\025F\244p\246\360\316\260"
+	.ascii	"\244\340I\020\260\317\013*\230\315\027\224\310\227\304\n=P\036"
+	.ascii	"\f\236\\>\337\346\253\263_\302\t\0068\001\205\024\355QH\200\b"
+	.ascii	"\t\020\201=\n\t\360\340!\001'x\330?\301\303\n\037\203\026`\232"
+	.ascii	"@\2268\301\276\307W\351t\001~:{~\357\361\005\370\351\354\021"
+	.ascii	"B\235\355\013#I(}\220&\366;\303\022\206w\206%\f\033\336\317\240"
+	.ascii	"\022\371B\200\271D\226x\27699>)\244\200\203Ox\304{b\371&_\022"
+	.ascii	"8?$\214\f!C\022i\202\311D\202H\361\034\276G\245\b\031\240\310"
+	.ascii	"\0229\311_\r\354#\3020\330\3003,y\226p\317\013\317\227\351\243"
+	.ascii	"|w\222P\r</\fU\001\035\022I\274\306W\351\344\371A\223K\030\272"
+	.ascii	"\204\2210L\204:G\234\360\302\310\247\006\031\222Nf\322\247')"
+	.ascii	"L\"\237,|h\276\360|Q8{& \316\260\343\302\013\335a\225\357\323"
+	.ascii	"\347\367\204G4a\250sD\017\224\307\006z\f\302\337\321\360\\*]"
+	.ascii	"\350\021~eH\"G\364@y\200\360w:\344\370\230\340A\276O\030\212"
+	.ascii	"\201\262\371\256\320c\216\217\t(\373\204{\326\034\037\023\253"
+	.ascii	"\222'\271Bu\220\314\034\337\223\375N\207\227g\t\207\320t\362"
+	.ascii	"\3608\2230Ry\004>\221\257\n\275\0037\235<>"
+	.string	"\025H\345\n}\3728w|\320\027\366i.yZ\250\262\351L\276\320\026\272d2\227<\354w:\020\203D\341\313\354\341AB\215\320\245\2639d\276'\2169\311\243\363\2114Q\024\302P\246\317\210`\315Q\371\362<\221M\237\343\362\t\033\217:\315\3451\003\270\351\343\3449\3364\227:\313\247\363\250\323\\\242\250y\241H\0236\320\243\316\2534\302\311\236cs\311s\342x\003\3459\016m\232:H\236!Ns\231\002\311s\004\301\373\3149\002\340H\201r\331\003\204B\225\313\036c\323\271\204\233\357\211\367\331SA\006\310W\006$|T\201D\201l\372<\007\020,\361\236p\272\220\001\217\263\371*\217\311\246\nhN\017\363(|\241>G'<\303\016q\206\235\242\007\017#\034g\330\271\031\341\b\3478\2418(\220*\216D\241\361\210\002\251\242\306'D\323\304\222\211\004\341|\252\320\331`cC\334\201\225K\024\033@"
+	.string	"l\252P\026'h:\227P\237\034 \374\235\016'^\245N\217/\204\363\251B\247&\305\253l.}P\237\024\226=PV\007Y\242\tM\262P\237\024\222#,?$GX\376t\220%\226p\212\267\205&\2375\033\005RE\320\370\3524\221;\311\243\222\351\3349\302L\344\r\n\244\212\233\020$\024Q8\231\303\035\235\345\016QI\002\023\371\204}\336\246\253$A\331D\232P\"_\245\r\n'\023\250$!\250$A\371\022\277\323\241x\354i\223I\344Q\371t&\337\347\357\351l>\337\023N\235=\204\277\323!\004\347\022\336P#\003\024\351B\323''\370\036E\300O\347\210\t\236\3572g\t7_\345\362\327\003\345\201\366\350\030_\030\371T\372 M\034S8M\310\220D2ML"
+	.string	"}:{\2003\354\034}\216\032\236/\234D>\221;\311#\354t\232x\237E\270\347\205\241z\205\024O\n^\245\223G\177\247C\b\027\024\215(\234\314#"
+	.ascii	"\20699N\350\315\373\364Q\276I\347\263\347\370\346 \241\314%2"
+	.ascii	"\247F\247'\305\363\327\203\344I>}\317W\271<\341|\366(\337\024"
+	.ascii	"O&r\371|\241\306\024/\263\307'D\016\023\271\363"
+	.string	"{\225\313\3462\203\243\216\017\263\007\347\251l.M\034a$\364\310\343\363\204ex{\240"
+	.string	"\b\276Ld\362\007?\337\023\315e\362\251\\\362\370\232K\236-C\362\335I\246@\362l\"\024\004\023y\302\331\223|n\340A\2028\321\223S\263D\3424\227\311\027\352\223\342\t<\246\360A\036S y\210\320c\362\t\325p\\B\241O\340\333\243\0026R\200\301\206\367\304\363UZ\360t\302Id\316Q\247\271\334\201\235N\036\3501\371\304\021\276J\247\013\356\021\212\002\251\342\330\263d\346l\3200\303\3161\247\207\351|\276\031H&\221-\374|\341\227\307Y\343\223\363*\217\360\006\350N\022^\216P6?0\231\316\247\rQ\251\203\344q\337'\022\205\362\211\3349\352 y\202\300\34119\302\362\250\203\344!\016\233\320\344q\331\003\324A\226\200{|\236A\030>\346\274J\n\276\323\001"
+	.string	">G(\317\362Y\002\232\\\362 \233*Bhp>\337\f\350 y\332\357tx\276)\226<B\030>\266P\035d\t\347\222=\361\206xa$\211 \323\231t\302\316\347\210b\323\271\204>\337\023M\021<(\214<(F(\337dS\005\264Y\201\027\3523\204\241O\237\024^\250\217P\305\023~y^\346[\002v\356@C\274P\037\343\353\303DZ\200\251\024\301D\302K\235\245r\202\346\222\007\230\002\311\003T6\221<<\316ds\311\363c:G\fah"
+	.string	"\214;Ix\211\002\206\024>H\r\304\347\0137_\020p\363\345\201\241>\037P\"\213\360w:\244p\2328*E\300\315\267\211\344y\276=@\3501\205\323\204\317\367\362 '\220\302i\242\205\235%\224\257\f\315%sC\217\312\246\023\304\211%\234\374\360*\235<\024\274G\245\210\024N\023\255R\304\253t\362\260)^eSD\n\037$\021V6\337\026z|u\232H\022\303\236\027\206\001~\"a\250\373\3524\221O\337{\004&\227:\316\026^\245\223\307U.{\2023\354\034Q U\fg\3309\026g\330\331I\302\316&\274\202\n=\346(\227=\354\bU\204\032BU.{V\270\271t\216\350\361Q6\2271l"
+	.string	"\242@b\300\007\006\345\262g\330\\\272"
+	.ascii	"\177P.{\212\357\211\227I\204\223oN\216\r\374|{R\274G\230\271"
+	.ascii	"\204\217M\347\f\313\247s\007\347U:]P\001/O \237,,\341&\222Xb"
+	.ascii	"\202\346\022\311\302\323\371\341\206\004\n\244\n\343\013#\237"
+	.ascii	"C\245NQ\311t\356@\337\347\016|\204_(\316\313\263\204\177\300"
+	.ascii	"\233\027F>\2176\320\346\333\303\343\004\241\\\216h:\227p\211"
+	.ascii	"\025\224\357\233\243\001\005R\305\221\370\233a\3478\002\024\212"
+	.ascii	"\354A\341d\032U<\337\023\316\344\373<\356@\221\317\344p\bC\235"
+	.ascii	"N\023\032`\347P\371\2769G\370\211\344\201\032\337\036\025pq\t"
+	.ascii	"\304\201.S \217:>&^\345\206\346\022\251c\204\362\034\225\310"
+	.ascii	"w\007)\203\323\311<>\337\346\022\371\204\217\316g\022IAs\211"
+	.ascii	"\324)\032\237\316\347\363\335\220<BM kF\250\231a\347\330\\\316"
+	.ascii	"\260sL\201\3449\362<_Xy\314\351a\036\233*\2247\257\322\351B\t"
+	.ascii	"\013\340%\317\262\205\227\251\323\374\260\241\271D\262`\204_"
+	.ascii	"\350K\342\371\352\350,\237%P8\231\314\017 v\222M\037$\023\203"
+	.ascii	"\343\013\365\251I\201d\276O\345\013#\237:/\334\\\336\314\260"
+	.ascii	"|\"\337\346\262\005\030\352\363\334\201m|\315%R\347\367&\233"
+	.ascii	"\310\023J\344\261\271\3449*\205O'\354\344\251a2\337\344q\303"
+	.ascii	"\021n\276Kh\023\371\204q`\246\363\t\277J\247\013\310\036\270"
+	.ascii	"\205\221$lPP.]x\356\300-\n\316\236\024*<w\340\r}a$\211\344\263"
+	.ascii	"u\366\244P!\371d\241/\214|\372B\210\030\361\334)\321T\241t_&"
+	.ascii	"2\t=\3029\313\035\350\321\b7\227\316\036\031\220\357\323\304"
+	.ascii	"\021\331\003\017\337\036\025\260M\317\221\t\303\316\347\016<"
+	.ascii	"\001\274\344Y2\217/\214|\376|x\226\300\236\245\fG\236\244\222"
+	.ascii	"e2\221<P`\262\251\002z\004\3020\362\bC\2219\302\357t\2002\235"
+	.ascii	"O\270\351LZ\240\323\\\362<\221C\236'\362\bC\237\313\234c\323"
+	.ascii	"yd\"\223\032T \231\257\362\310\363DB\227\312\243\023\366A\032"
+	.ascii	"\277\323\001\271\001\364\b7_\036\345\023\3514Qd2\235O`\020\372"
+	.ascii	"\276O\2357\004\n\244\212\037\n\344s\375N\007\037\236%\223\351"
+	.ascii	"|\352\235$\274\354\361\241@\252X\241\257\017\023y\202\r\2760"
+	.ascii	"\222\304\016\364}\346\274$R<\205OxDs\005$\214\f\201\002I\342"
+	.ascii	"\t|\302#j\232+@}`$\f\303\023\036a\323\\\001\n}\223\316\347\210"
+	.ascii	"\344\263\370\204G\300/\013\311\247\206\227g\t7}H"
+	.string	"\244x\032\233+\224H>\211H\030\031\002\210\204\221!\\\370\b?\235#^\340A\321Ct.3||\276<Kx\370\235\016\260O\017\354\343<\362\240\350\311\300\005\021%\200<Kx\205\217$@\200\340Y\302\373\231L\256\311\366e\"\2230\374^x\241L\237\036 \n'3\347\371\236xA\250|\231&\220\315\267\205S8M\254\320\343\363M\261tA\b\373\3644\227@\345\373\366@}\360w:\364\0349\364 \2319\026@\217/s\231\343|\216\270i\242p*m^\031\234O\030\332\343\3632u\232H\240\022\231\f*\211L\244\t\267\347\211D!d2\235\317\032\024H\025G\343\323\271\223l\"\201\310\246\023\372>\207\311\346\273LB\337g\017\321\271\303|{\240\357\253D*}\220\320`s\211\3249\346\344@\241.\334|\227\311eN\316\353L\036_\345\222\251sL.a(\222\371:\237/\362\002\370;\035\240"
+	.string	"`\276\315&r\007\004\217\363\271\202\362\211D\361t\346\324@\217<\310'r\204\363\304\363\205\006\241\312\027\372|O\274Obs\311\263\246@\362\254/S\251\\\362\260\354\013#\237\372;\035\222!$s6\300N\346\262G\370\362 \233\372\345AN@\005\222\331\003]*\201\337\351"
+	.string	"\205\"{x\234I$\217\017D\210\017:H\036\266\271d&\337\020\311%\3746u\220<6\337\351\360|\231o2\211\024"
+	.string	"\364\230L\"}\360w:\020\340\3712\231\313\034\026&\036\333\357t\200\223>O\030:\002\364\230\342\205}x\2142$\235\314\343\221\205\233>\316\344\361\330>\337&\n\347\361\330B\237/\324\247y<nes)\303\361\310B\233\313\036\350\361\3302\337\343\321\205\2170t\311,\366\250\200\r\240|\237\310\035\250\001B\200\302K\023!\3704u\f\220\302\247\271d\032\240\204\023\216'\240\220\"\204W\351\303L6\227!<\241>! "
+	.string	"N\3616\231\310\346\363\205\233\313\243\022\371>w\340\236\343q\303\211\367\331s<\2620t\311<\036Y$\214T\036\217\354;\303\022z<\2622$\235L\235|\237\307\037\274l\212h\256"
+	.ascii	"/\233K\366\t\217H6}VP\"_\022\311\344\207\033\350\361\304\033"
+	.ascii	"\"\231D\356\346\nJ\344\373da\350q\331\003C\316\033\342\355QQ"
+	.ascii	"\342(b\004\f\3007\331D\302\320\346r\303\307\027D\350\346rD\023"
+	.ascii	"\232d\227=\320\025z\0041\202\b \210\021D\270lr\204\345\372\235"
+	.ascii	"\016P\037\023.(\213\317\027\206\"yX(\364}*\225\310\366=\201d"
+	.ascii	"\302\340\323\303\263}\216'^%\324\307\304\206\036\337\344\362"
+	.ascii	"\304\033\002\352c\002\370\036\337\036\025%\240>&\334\267"
+	.string	"G\005\f\3651\321B}L\254,x8&\223H\026\005\222\004\210\020\037X\370;\035|zx\216\316\247\n\235d\022\031\002\364\371\236X>\225\036\274G\022\"\230 \302\t>=<6L'\364}\376\240\307\233\367\350\323\303\003da\246\017\364%\321t.\341\344\013\277!|zxj\336cSg\311D\036\207M\235%\363C2\211\334*\224\310\227\004\022F*\335'4\347\270\243\263\3349&\223\310\340\253t\202h:\227\320\345\211\367\031<\361*W\235&\f\311$\322\006D\210\017\311$\222}\223\315\027`(\362m\001\376\240|a\244\262\247\002\3147\231\374"
+	.ascii	"]R\360\235\016\320W\351\3449&\237!$s(\200\036e\200\"y\340e\n"
+	.ascii	")\234&\202PxiB\373\340\027\232\223\343d\341\347\273d\366,a\246"
+	.ascii	"\017\317\r\210\020\037`\300y\231\310$"
+	.string	"\024F\2328\3412\221'N,\225\320\367\371\235\016\303\rC_\030\331B\017\017r\3306Q \237!v>\360\354\357t\030n\345\373|a\3462\247\351\363\313\311q\302> ,\200\302\311,~\247\003\364\250\263\314i:S \233K\236\032\024\023\300\315\027\372>{`g\023F\2328AA\362\004S\370\036k\336\343\315\233|\3728ax\276\360\353\002\334|\237O\237d\215\nx\231D\366 M\020ad\n\026x\241>B(\374|\231\037@\274P\237\233W\007\t7\337\344\363\035\241\323\\6\237\310\030\232\316%\334\303\343\003m:\223\026@\227\320\367\371\302P\025;0\322\304\211\341\253\203\204\231\316\023L\346\233d2}r`\244\211\0236L\346\013B\305\363\205ad\no\362\351\314\321pB\250t.\237\357\210\234\236\026`\244\211\245\220\351t\246p\364\265O\344NR\303\337\351\340<\3668\235\314\020\2229\027\310"
+	.string	"E\226\320i.\225o\362}\366\b\241\307\246\317\363\371\236x\241\307\351d\n\341\343\206V\340\345Y\302,\264\002M\347\022\366I\276)^ \264\002/\214d\262\320\n\270\360\021\005\270\271\364ie\200\"a\023>\320\366;\035\234O\025:!@\237Nh\363\205V"
+	.ascii	"=:\237*t\330\227g\t\3678\235-\300\257\316\023\t\017s@\204\370"
+	.ascii	"\340|\252\320\331\360w:\244x\206\220\342i\363\001\026z\204\362"
+	.ascii	",K\244x\022\341\343\b$\300M\037'\210\227\007\371\314\371A+\300"
+	.ascii	"D\236x\276pS\304\313\203|\256\360\352 \237\357\t\344\004\320"
+	.ascii	"\n\264\220\002\311\023\204V\340\371\302\3602\002)\220<@\370x"
+	.ascii	"\202\007\270\271\364\331*\222\315\027F2\333\357tP.{B\200wt\226"
+	.ascii	"\314\034\234;{\336g\b\260\323\371\f\001\b=\2760\022\206A\247"
+	.ascii	"\271\214\341\371\302=\316\035x\331|:'\270\007\017 2\250\300\004"
+	.ascii	"X\330\311\016=P\236\020z\240<!4\227H\236\020\222Oh\b\035n\220"
+	.ascii	"\360\273\003\373\220:/\217\323\367*}\340%\263\207\007\351\352"
+	.ascii	"4\227==Hf\316~\241\310\235\036b\323\271\204\221L\037\245\323"
+	.ascii	"\205\032&\323I\002\007\005\022\003L\344\022n\276\3177'g\031B"
+	.ascii	"\005\274L:\237o\316\006(r\231\202\212'\374\362\360\250\200\""
+	.ascii	"\205\377o\266\020\213~mc\330\212\274\021uh\030B\314\024q\023"
+	.ascii	"~\001\206\201c\202\322\"d\242\273\254\200\305h\253\001\003"
+	.string	"6\001\301\"\227\245Fl\327E!\211a#\306$\240\355\b\272I\273I\273Y+C\341\306\312o\326n\324\262\\\225\0262n\324n\256\020\237\246\274\350|B\224P\301\372\262\377\233*J\253\024\244:&Ttl8$-+\320\250\204VXx\004Mi\322P\274\300\331\220\322ET\362\365\004\345\314\250$/mAb$\212N\023\272\3518\20333R\031\266y\355\371\270)3b!\342\360\362Av\003\305\030\247\376\360\261\"\352\206\3148\325a^\314\240\271\221\032\307\240\215\375\364\270\0313\"\245`\027c\307\315\223\232#)4\272\234\214\351\270)\024\225\330\n12#/\232\324,Eqc\341\202IMT\025/\033`n\226\030\323<\215\311\303\273\t\253\341\241tG\345\213\022\275C\b\024$`\306&\373J\220$\246$U_5Wb\212\272\324\274\214E\360\256\300\271\310\372\206+\337l\335t\375\206\353\353\206+"
+	.string	"D\246\261\264+V\337d\335h\375\006\311o\220\344\033$\353\336\036\313\265\245\t\253o\216\224"
+	.string	"\025\307@7Fn\260~s\344_7G\210g\210\252\252A\036\"\235\221\346\346\352\346\352\206\310\230\021\306\354\304\330\r\371\r\221.\264/& 8\273\001r\003\344&:\327T\365\233\350\215U\213%T\252\254n\202\300 3\315\001\344\242C\002\006\002\255\233\251\233\251\233\037Vnx\374\346\307\215\017\326i\211V\335\215\217\233\036B\257 Q\324\3267,=\304@\300t\003u\003u\243\303nI\325\364&\307ot\334H\251TSSgn\244n\242\206`\320\200\312l\027Np\310"
+	.ascii	"A\213\033\246\033\246\233'1\024\274\354\272\2427~\363\344tB\207"
+	.ascii	"\220\215\033\247\233\246\035\004OI+\277(\202W\004\314\276I\272"
+	.ascii	"I\272Y\272\353\340\206\306o\226njl\271Q\005I\215\033%\243,eN"
+	.ascii	"\342f\\\241\013\203\262o\2206\222\261\"bY\277'\311\376od\324"
+	.ascii	"l\315\350BC.'\005\215\266\320\212\214\342X#T7\266\024\t\177T"
+	.ascii	"@\214\213\312\r\021\361\212\232%/\006\215\233\030\304,Dbn<\262"
+	.ascii	"\026\366\360AiCb\343\005\361,K\r)\322\215\213\233\23770/\260"
+	.ascii	"!\"\230\320K\213#C7@7@7,\220~\263\3427,\232\020\025I\313\372"
+	.ascii	"FH\250\244\376\260\250\253\313\372&\350eP\222\310Q\365Xmb\027"
+	.ascii	"Q\324\016M\326\377M\\#\255r\3226\306f\317\251\211L\21545g\352"
+	.ascii	"\221(\230<4dv\200Y\213\236\021J\3550:\276\224\321\253Q\263\361"
+	.ascii	"b\312Q\236\321J[\321\023\363c\306\250\345\346\247\216\f\317\006"
+	.ascii	"F\276\nB\344F\231\242\222\255\265\254.2\323\241\017\267*{w^v"
+	.ascii	"\323\226(fc\344X\270\264\0324\304\274!\265\325\310\372K*\004"
+	.ascii	"S$I/L\226uF\217!L\246C\265\"\036iEu\3053\026NGWY\377\224\210"
+	.ascii	"\311\252\361\245\212]\2200-/\303)\331\355)L[\027\263\257\254"
+	.ascii	"0*:\351\317\307\230\035E\346\204D\272\304\274\220+\246E\341\321"
+	.ascii	"e.\353"
+	.string	"X\330&\2513\233\362\373\261\201\003\206y\372\222.\211\352im\021\203\002;\263\342-h\366[B\247\267\346\026v\025\324\265\246%\211\221'_EY\177m\305\361\327\2205\002\244E\224,\\lJ\254P\001\001k\222#\353\2575\255JU\214\265a\226\032\323)\221Q\033\026\331\212w\304W\204\350\210qE\210\225a\025\334\022\034\227\254\325\255-?yY\177m\375\374\bB\245\270\266v\247\205G\326\303\252\"\037NS\206S{Tc\224H\031B\021sT\035\211:\033.\225]\221\205EI\312\n\273b\222u\220\356I\226\273\262\341\221\025\027\r7(/fA\222cB6\214\361\001\336\024\230th\367\b\372\302\032\203\013\300\215!R\236t\001\216\215\331\013r2\214[iX\035\027\261\342\030\321\335\234\221\254\203\256\314h\262a\"\314\023RYQ\t\331,\t\236\251Z\366\220\306l\302\202V\240hiPl\224\b\313"
+	.ascii	"\235\320`\301\304\006\254N\251I\356\305\027\221&Xq_D\255\226"
+	.ascii	"\t\036\024$/1"
+	.string	">\253)CA6]w\355\032\215\257+\033\256\"\0329\250\0351\266\214AO\\`\220\314\300\301F\303I\313\350\002\256\351j-k\233#\352\336\336\2318\006\2629B\034\n\203\212c \233,\033\254\333\034\271\252j\240\252\032\020=\020C*\006\253\243Q\233\"b\006\020D\247t\205'\3446E\210\344\260(\027V\210\f\001\213\221C+\316\307\232\230\261+WK\260\fY\333^\217\222\217\373\260\t\242f"
+	.string	"\005\267\365\3436Al\252t\310AeU\331"
+	.string	"\241\322\004j-G\031\020\017\034Y\333Pm%\274)pT=+\242\242lx`\211 u\033\036S?\031^vS\246v\250LM\214<\321\261\203\324\035UZ \351h\365\324\24323\340\274\334\370\r\033\250\r\204\342\230E\254\"\210\324\336\324\246\3516P68\250\2449\261\262\301as\306\351\005\326\225;5\305%v\362\365\320P\214b\037Wl\222l\222ll\364\330"
+	.string	"\355\254+J\34366l\226\260\220D-\331\324\300a\005OL\006bF\245\314FI\323iYY\255\200\262m\220\264\2326\304\313[\326w&\2619b\343\022'\227\365\235\\61lb\330\024\251GGv'P\331\211\261\263!\272M\021S\024h\317\307.za-\211\233\332\274\020F\2414I\342\"N\203\361!c\313\220\360-\317\271\341\261hQ\323\3457V\345K\214\005\361n'm\341\362\266\242\206N\310\004\006\025\224P\361\207\335\263\302\202$H\270\246\336\300\341\002\013\320\013\2561e6?\305\027ZPS/lb!\220\275$Gcj\366\212I_g+\322\314\021]<\201\321C\263\235\200i\203q\246H\304\306\220\302uD\257(\304A\213\030fy9\210S=2'3S\301 l\001\225\t\250\224\205\317\024Fu\252$\206\302 \3071\306\030\242\242\332\004\001\263\025"
+	.string	"0`<\032\215\3074m\225\335\024\200\016Y\300\212hJ&\317\303(\210\2242\006"
+	.string	"\006"
+	.string	""
+	.string	" "
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	"^m\275Ya\201\331\336\3318\354c\213\025\243\316\230\314\233\310L\325e,\220\277\202\265\261:\006\260\242#e\036\351\242U\262c\214\225o\326\326\313\345p\320l\240,\313\002\347\262\337\r29\314I\321\240%\272\263\267\222q\246\341\307}2\361\022\306\332\321\374,\006\004\247\263o\245_\221(\341\346"
+	.string	"\254\345T\214\007\022p\365\270\020\n\005\211\301Q\321\350\261\224\266\"\363)hr&O\\Q\025\206el\f\226M\020I1\020z\341P \314\310\325\212\223\253t\342\240\034\270\204\340\341\001l\207\267\336\201\246\257GS{\001.\350\021\203\363(\265\301\030\367\"\336<^\302\377u\2211\347\325\003\362\007#V\326>\004J\034\204\2071P\305y\371\025\272\307-\327\325G\355q\034\377\341\034\347\021\205)')\375PX\327\237\3546E~e\027#\344w\263\305\305\275\235\275\354k]\357%\353\006?q\016\021Z\033\036;\023>\254\350\254\215\265\233\376\251D\3454"
+	.ascii	"=\017\304\215\030\303S\030\003\246\242\262\210\377\007\315n'"
+	.ascii	"\324G}$2N\223\231\215\351\202\013$\211\005\223\203\214\242\025"
+	.ascii	"\t\273t\377\031m26s\203;\322+\016\n\313\350\333\320\267\253p"
+	.ascii	"}!\210W\025\362&`/&\0162Z\247\343\204P|\2562u\352mi\305\221\355"
+	.ascii	"\253\204!#\236UW7\371\243\002\267\321z\034\303\245]a>\302\335"
+	.ascii	"\030\033\022\365\327\235\304/x\263\215A\312Z\260\244"
+	.string	"\230\006\\.W\001\373NRE_\216\267\336\370(T\357K(6\315\361t\365\021\226a\375\366\310\316T\0362E/h\376\305.\227\360\327\240\367\366-c@_\222j\006\313J\370W!\250\225~j^\257xi\305\371\364P\331\n\370\360e\312I\221~\212\24322\375\257\305\350\340\274\247%L\220j\225\364xB`\321\303}\252t\360\n\274-N\272aW\264\234n\234U\3149A\317\210q\351[\276\026\360\317\203_\300)F@\211\301\2351a^\235\030R\341&A\207\343+\016\032\036\323\264\233\362Xx\307\271\221{\265\370\241\333\335\t@\013\252\320\200\3730\215\036H\231\314\233\215\233p\217)Cgw\273\236\331\341\370\323p\271\236\001z\327>M\006\234y&\036&T\366\273)\177\f2\307\226-\t\340^b\346d\216\202\304\254b\033\320\3541\030\361\362\262\3168\243\224Tq\233x\343\274\306\370T\351\222Y"
+	.string	"\365\031\231~v\013\217\202\\c;S\023:\365\271\254\234\3408.z\301lx\314-\222\363(%\003\276\277-\210f6\355\025\201j\032\235\372v\023\346\302\351\207\335\235K2\243\275:F\232dZ\316\203\317R\204\233%(\235\0270\303\255@\365\225\266\223\020>\252\305\246\335\356f\363\273\240\347P\273\021\334$\034\\v\204Y`\377\311\305\220\021\013#\261\360]\311<X\200\350\217\307\032\004JE\307\321\213P\266\370i*\236\332\206d$M \221x\207I\247\026\210\017\002\"P\016\375\300Ym\210\nQ\261LwY\241\230\372-P_tm\222\2516e\301\350\035|*\225 \332\323\223&/\002W\303D\346\242k\377DR\340\326\222*wDd$\361kw\346\311=V}\263\314\307\"\336\371\024\363n\235\223B\352\207"
+	.ascii	"\300o\006?&#\030\373\235\223\231\007\256\031\226\261\222\325"
+	.ascii	"/\315\036\207b\307ihx\271\235D\3001H\204\231[\362\313\033\030"
+	.ascii	"8\2452\r+\341\341\003\321\3729#!\322\265\":Skm\335!\302\241\t"
+	.ascii	"N\270r1#b\352\034N\201\271\222\243;\241(\317\203\373H\204\200"
+	.ascii	"bI\362\275\312\367^H\343#v\270\367Y\022;$\327A\255\234A\336\314"
+	.ascii	"\346mP\271\345\254:\247\221\275\360\336\377\247\257\203\3646"
+	.ascii	"\341&\337\017L\204\227\021o\372+\215\301\r\330\200\213\033\030"
+	.ascii	"\320\240e\001\327\3363\240\373\241\036\337o\232@\252A\035\264"
+	.ascii	"g/\234\235\301\201e\2314dGuAz]E\207g\350\005\0165\022\375\207"
+	.ascii	"}\214\203\240\306E"
+	.string	"\240\330g\006\375\221n\232\222\314\354\217\326\rk4\347_\201\022\221^\262\234\205\246\232\213\327;\222\007B\006\276\264'3\364\237\333 9\3509\373\217\270\303>V\333\013\225\265\360\371D\270\364\230\311>\244\242\355n\367[Ao\205> \224\254B\t\2314\210\332\344\0221\372\027\306\211\027B6p\201F\275\345\342 A\031S\236G\210\252f2\221\316\tfS\346\2166\261q\345u\370\320\273\350\024vV\331tfH\006\226\221\216K\035\310FF\245\276*\031\343zY9lW\274\342\241]X\244\351\257\315\311\252\301\n\025\311\252.\2166{\354\242:\311\025\257\320\301I\275\250T\374eL\254P\264\371\334UJf\350D\262\202F\376<~G\245\030\250\334sL\025\220\0022\037\002qD\304,\"\336d\364\275\301\201\034<\334\214h\032U\016idsEV!\np\306\323\267\262\253\232\335\330\222Us7\366\016R"
+	.string	"\336p\326\213\252\210<\270\234s\320\003]6z\216I2\216\252\252\275\027M3\262\334\337\244\005`\351\234e\277h\207\232ie\374>\355\200f\256\246\313\261\027L\003\324\030hO\324\023\360\267Pyu\274Q\b\220\227\214\031\201\300\272\325q\300\317\324\273g\235:\032N\346j(L\360&\323R\207\326\004\006\202"
+	.ascii	"\304\361\276w\262\f;\274n\b7\031\377\233^\347\377\301\253n\177"
+	.ascii	"6\353H"
+	.string	"_\321"
+	.string	"\242\025\006(p:\321Kl{\251m\252f)\001\0348 Z\211\221\306\263\356\372vR\3415`\371\005\223\230\244) hI\276\320A\204Bi"
+	.string	"\257\312,\214Y\237A\270\343\244>P\3651\323\250?\364\300"
+	.string	"\0242\304\330\232\031\254\205Q\326\204\371z\327\343\211\311`\330?%\241\241\223\2665\332\305Cv\002\313\006\253\224I\307Ac\263XA\035\317\302\"\371g\225\367!\006\271\032\"\022\255{\316Hm\255\271\265\372\337\203`\020&CV\205\250\006\3507\264P\233S:\017U8\305RK\337Rv\370]L\035\204`!\231\251\273\257\253!,\376u\272\204I\302,\t;\205\302b\026y\365&\324\306M\024\355A\241\215\3323\303C\221\347\257\217\344;"
+	.ascii	"\353F<7\216\3228\227\254\210\023\257|\371l\377\203\360\f(\013"
+	.ascii	"\237p_j8\353\344\031\250\324I\300\2575"
+	.string	"\203\341\323\230\256\341X\200\002c:\304\201\202\334y1V\237\033o;TX\2116\314\275E\241\t\021\200n=\364jnx\354\375'\267\373\357\027T#\020V\266\226\377\337\350;\242=\353\262\275\243\022g\tG\234b\020\343\214\312\n\205\016\314\252\006M\215\272!\225\264v\26444X\213\203\r\336Wi\337\267\017y)P\361B\2332\3749\277\3102\322Sj\314 \n\310\fE!<\245\316\022\rUW\317\0309\303\244sIV\277\320\f\372/\301\340\264\f\301\261\325\020\327\315\036a\224\201\355?n\250\202\315v\225^7j\303E8\205\320Y\0060\016\343!\004\022\"\331p\322\277\206\366\260g\030\311|\231\210O$\362\233\373Tq\325B\302eI\315\352\006\001\362\366\211\354#\032\325@\221+\033e|tKWA\005*\335\"<\324\363\315\353\370y(\037\252\343\023\207E\310\227\307\024\003\034\316\355]\337\257\247\224"
+	.ascii	"\305\207\310#\021o\033c\210\020\243\334I\200.\320$a\313\235\312"
+	.ascii	"l\340\324g\257]\324a\270\217X\320\333Xt\\\241\337\326\200\205"
+	.ascii	"\205\305\334\366}\342\032\030fo\026V\237\2116)\264\f\313Q\303"
+	.ascii	"^\245D2\332\242UU\330\223\n\261\353\214@\275\366\264\031I5\017"
+	.ascii	"\211\2067o\276\200Y\372#7\023\350\317\263\273\027:F\312\3423"
+	.ascii	"\376\242)\001\344^\216\364\224\032\023\b\365\2766m\214s\330\235"
+	.ascii	"X5)\211\341L\205\275s\264G\345\027\335\213\267\232\032\311\316"
+	.ascii	"\346Z\016\n\274,)\036\207f`\270\306*\313\3446\242\371\\\227_"
+	.ascii	"\237\206\033\2425\034\326\241\314\036+I\315\037\322\273\007\350"
+	.ascii	"\022\262z=x#\214U\325;x#\340\236\023\336\023gY?2\004\214\032"
+	.ascii	"\"9\256M\177dy\202\034\266\024\305\270\032h\2657\275L\\\213\\"
+	.ascii	"7\204\223^\315E]\2675\232\370%4\376x^\260\022\225%\377@|\331"
+	.ascii	"\376+]\267\020\")\027\331\354-A\360tt\332\350\272\264\245\324"
+	.ascii	"\3542<M\337>\204\305\274\201\371V<+f\0013\030\320\260\301\322"
+	.ascii	"\254\213\002\361`u\302\2075k\245\276@\344\353{7.\037\016,]\217"
+	.ascii	"\004\364\372o\250\362\037D\313H&\034\315\254\007T=\356\255\203"
+	.ascii	"\214\220r\005\231\027Y\004\213\226)/\317by\237T=X\343\223Kp9"
+	.ascii	"\354i\002\"6\r\214\225x\375\215\253\021\266V\300\202\f\217\037"
+	.ascii	"4X]\021\315\\\t\213\265\257\200\260G\217\002\371B\016R\363w\276"
+	.ascii	"9H\330\232z\210\302#\271\231\301AV\203\304}\215e\0034\233j\325"
+	.ascii	"\274\017\027O\315\267\331\017\203\272\263\f\304\216Rb\246\330"
+	.ascii	"\217\262"
+	.string	"\303-\325\355<\b\353h\033Z}0\247\203\323\273\317K-E\274.\265J=\267\276 6>\n%\334\224\213\325\254\3738u\ri\360d\351\332\347E9\244V\335\027J\352\023\035\031\324\362\265\377A\304\313X-\213\034\342\273\264\377\365\352\r\021~\325H\233\244\024o\336^|\271ER\033\362\315\260\273;\215o\304\305p{\227\3405\211C\343\244_v\013u\233 \276u\377$7\027\243\247\024C\247\222;\002\341cJ\3074\360:\036{\351\007\036z!q\3313\300f\3264\311}\236\030\3300\215\263\214\022\252\353\022\325\320\f@\024kI\373\316\237u|\304\255b\362l\020\035\241\017\323\223\177\361\366\301a\357\232\330\002pm\224eD$\f\321Yc\026\227\356@LK0V^\273\004?\265\253\0378\206|\334uQ\020\257\363O\037\363\312>J\022\224\254q\255\257P\2267\321\305\r\b\265i\247\r\315\372bB"
+	.string	"d\207\334\017b\335\251aA\r\325\334\0070\216\245\323No\rwea\360\350G\024Y\243M\277.\333=\327u\r\030\257#Q\261Fa\256\030\337\272\300\372\r\333w\321W:\274\270\330W\224\260\330\365\210\210@Lr\326\260\233]N\3146+J\203T\321C\224\035%[\"\177\366\225\374\305\267\031\357'\374\2415\306\021\315\321\244_G\276`\324\016\370\273\271\320n\315\220?\354f\"\205\225\351:4\222\242\005\232\206\257P\241t\324<s\264\350"
+	.string	"i\256\353\212\355\335\220\037 \244\377a\326N8\263\374|#\205\361"
+	.string	"<=\336\260\210lJ\004\\\325r\335{\265\335\232\320\337\363\372\255\315\362:c\335\360\226\364,\200\277l\2415\031\211\310\360 \205Ed.d\272\376\n\202\204\306\237\226\245\024L\rw\315\266h\207wXp~\225\274 \276\bJ\316\3551\036\200\267S\2162Iaz\300h\003f\035\0177L\271\013'5\217~xA\375\307\303\0211\004/\327\200&\303\367\274]\b\016\t\253Y\344\\{\223<\326O\250Z\223(\334?6\016\360\342\347\216\356%\002\267;Q\350g\026dQ\310\256%\343x\013c\036\353E\216\332\2333>\345\017\005\320r\352\242\232\206\003Tk4\300\222\342\315\t\255\032\261S\202v3\017-V\037\302\217W\t\213>\035\214]Ab\346\250\030\265\210\035N\0329\217dNdt"
+	.string	"\330\343\016\3662\317\036\356u\3027Xe\312\307\227\033uP\371}1\226\\ZIU\177L\363\"\354\376l\277\366\231\016\204\211\2644\2158\313g\223w\237\210\034\355@\367h\243\352\205\233\244t\306\f\301'\375\347\305\262\341\270{\315\343\332t`\326\331k\366h\2105\225\"!\361\030\272x\302\276K\177n\342\312\027\357\303=\006\025\256\361H\215\346\345@\354*\fB\244\365:\3565\033\224(\2322\274\353I^\013Z\222\351)\024\217\237\021\376\243\265\302\240c\304\027\334\234\r \250\311Q\252\261\356\003z\273\350\312p\265\276\301L\300\364"
+	.string	"\233\363]2\377\320\267P@\246\205f\260\376bm\236\200lR\275\017\227\264\221<N@\344\307\252w\326E\217\205\266#h\255\020?U\t\2131GP\345\232\315\216X8b0Vq\r\n\257d\320\271\031\224g\241\217\200\300?wC\234~y\r|\346\016*\035\276or\237\364Qy3\006\340\360\027\321\013H\254\230c\246\340a\025\350\325\223\017\312\213\230+\316\341\331G\335Av\364\265`\316\023$Lq\333\022\027\031C\026<d\363\253'S7\257\205\364W\362\034+\005\224{<\377\3572\017\356\246\347\263VA\234-_\026[\323\254\371\201\373^i\027@"
+	.ascii	"\344\204k\366\036\026\220x\277\002\277\224p\\\035h\222\354\347"
+	.ascii	"E\233\355?8~\376=S\237\203\005$\277\253\346\377|\250y\235\003"
+	.ascii	"42.']\241\302de\257\256\200\\\305\202\205e\255\265\373\005"
+	.ascii	"LD\023\232`d\247\316\270\017\371\370\206\214*{\260\347\236\237"
+	.ascii	"e)\247\250`\222\352\221\022\354\247\177\214\210\354\322\346\034"
+	.ascii	"\205\005\250\203%\205Rl\322A\200F\232\325\270\310\256\023\037"
+	.ascii	"\177{\210\214\221\034\371\311\256\017*\026\021s\flhTkf]\023\377"
+	.ascii	"\241\224\314\275Y\344\247\343\302,\233-\262r\326\003\320\277"
+	.ascii	"\234\231\371\274\246\022\213Jw\217\003\367\007Y4B\016\225M%\300"
+	.ascii	"\242\275\302\221\323*S\247'\314\324\217j*8\202\200\220\315\221"
+	.ascii	"\n\330\206U\245k:\236\310\2575r\030B\330\337S\341\330\273\332"
+	.ascii	"\345[V\331\036\005\262\253\007U\224\b#\306I\333\324\313\323A"
+	.ascii	"/J\327\005\300\243\340\233\225\205\301rn*d\341fH\016O\225@V\324"
+	.ascii	"6\031jS\320%\367\007B.d\202\344\365D\"C\334M\200>R$\212\324C"
+	.ascii	"wGY\366\304\231x\321;"
+	.string	"\206q\3410}\365\312ROXG8\220?\364\315^M\336Ki\003\314\371\013\310\232*\257n\271~x\227@\022\222);\235\365\364%\n\352z\341-\270\224z\275~D2\300|\266d\315r\205u\026WW\353\345\004\0227\335\251\036F\356\276\336\356\035\031\326\355\360\237\007\252\360\261As\027\363\274\260\277\335\312\032& \367\355s\030\244\364\274\3337\212\221\034\350\356&\312\241\347l\247\324\237\033_Z\360\377\255)\230x\227.>p\034\376h\225rm\0133\201\034'\177\320\250\036\013\031\243}a\021\325(\033\253\335\r\214\006-\220@\224B\033\231\202\320;\177Y\277y\242\340\034\255\334\272\344J\232\313KB\257\263L\317\200X\214&\376\b\220\334_\273(\362&\2155\250t`aZO\027=E\034\322\251\007%O+zbOW\376\022/\025\261\271\b\336t;\346\317m\241\332*\202\245>]D/\372\242\235\342"
+	.ascii	"f~\202\3667(\277qb\247A0\351\254!V\213\240\032@\255"
+	.string	"\320Z\212\034^\272y\b\225\241\032\305\367\232\250\021\243\230\332A \321\231\005\306QG\365\245\202\027\020\301A.\224\302\265\324<\\:O\245`gK\302\325\003\022\261*\307\r\226\246\270\303\225\003\352\363f\363YDN%\265\nf\275\354\214\307\232\255\356\037p\277x\342t\317\254\"=/\313$\221IE'\253\273\370$\3142\377yh\344{\326\215\2344z\361eB\303\245\037=\222\263x\b_$(\356_-\210\240RO\355\b\250t\217\0038\376\212\004+I\257\020\264\326\341F\n74\234\250ia\322\277\317\272\323\213\3416h\0311f\261\322\220*+\233\372\271\033:\2257K\324h\031\355\267\207\213\372+A\232\366\315\343\302>p%\034e\266}C!\r0|;\016l\001W\337\037=\322\365\210Y\237\363IN\3043\271T\r\\g\3457\360\253\307@\347\005)\343\305A\237\371\030\375Evpf\020\bf"
+	.string	"\t]\261\204\276\353C\252\nR\361\351z\307"
+	.ascii	"\267X4\316\326\235\375\\\021"
+	.string	"U\215Y0\230\n\035\225\027\240\233\204(i\326\006.\001\311\273I\016\367\373\305Hl\350\325\234\225R$3\226\205=Zl\253\032U\323\276\205\356i:aW\252\005k\252\201\246\257w\351\212\035\201u\351\021\312\252\227\013\375\263\311\032`9\246_\3269J\351D\233\274c]\237q\227\306\357\277D\334Q\364\273'\267\273\231Y~\036\2673\357\340\276\364\003h\001\224M\247\253D\261\370z\026\377\263\r\223#\243\024\301\251'\005u\327\024\306\303W\306\372\342\313\261X\032\310l\305\210\341K\332m\233D[=\342\247\373`\350}\321Ih!\006`\3738\240\2440\305\365I\374\363R\020\211\267\032e\253\325\025aF\216\264\007 \255Q\266\025\220\016CI@\302_\2708\252,\252\243\251\370\230\n\277\214\210n\302\245\367N`i\323~\254\004\324\233\007\273\365\227~~\331\025C\212(6\257\347\203%\255\b\347H\255Bl\315"
+	.string	"\340\231\002\243\377^\274Y\376\304"
+	.ascii	"8\022x\013\216\301h}\273\013e]\326\247=\203\312\333\253\321`"
+	.ascii	"\020 y\232\355\275\260\376U'\374\244\004\363\335z%\nD2\265\226"
+	.ascii	"\020]\261\006\272\353\006\334\177\351\026\276\334\3317"
+	.string	"\314\034/hI \311\177\325\023\361\204\nx\004,\352\240A\312\337xJxG^e\205\024\326P\205D\241\3272\277\026\361\240\243\033\030g\266\002\272\235HL,\302\035t\237d\332\304\032\377\013\002\200\0317\273\2541G\226+\230\311\216\302\0026\300\020\030\020l\251\306\3117K\240\332M\371\232\321j\353\312\370nO\240\301\372\336\035\006n?\032\244\354\364\224'\217|2\301\0271P\245\201\232\3723\337\b0\020\0371\251f^\351\366\006\362\225Nu\203\r\357\241\356i?\005x\227\260\246`\270\036\355\375J\3403\372l\302\2711l\306\22096\365r\303t\033\347\210\240\177\254\335M1,wZ\266\213q\3144\034\236\321W\215\270\275\224\330\234\032e\024\231\301\004r\207\312\210\241\247\276S\013\360\3126\036\313E$U@\246f\363g&\240\330Z\3305\3500\022\250\226\276\314L\3777B\216\301\200{\222\377,B:"
+	.ascii	"\367\265C\334\251'W_N\230\236\206\241\207x\365w\257a\020<\265"
+	.ascii	"\312\206\344\224\344\234b\350;1o)\352\242s\202 \262,\346\337"
+	.ascii	"\201FU\024/\234.\342\231=\231\270c\247\360,\233\234\262k\376"
+	.ascii	"\321\222\f\3609`\347P\237V\004\033\266\005\265\217)\205\025\241"
+	.ascii	"\362\226\337t6\017\2302\f\307?,\300\034\242\203;\265?\255\336"
+	.ascii	"\264\244\322D\273\311'\364\332\224\304\266\261\323\232\210\313"
+	.ascii	"K*\213\355\376\310\300\353\253kx\341\236v\344B\320HS\022p\027"
+	.ascii	"\307F~\b\335-\271\261SG\006M\313\304\202TP$T\r\305*\304\005m"
+	.ascii	"\200\356H\037\214\363\261\346\f\273J\227\3744l\371\264\347\207"
+	.ascii	"Q&\247\371\005\223\241\221\367\225\242\027Q\301\353\356\201L"
+	.ascii	"\035\262@\355\307@{\375\335\373!&i{\007\226\003\341o\206\006"
+	.ascii	"\313\334\002_\265;r\323{\317\327=4y\214S\t\216\266\227\351\\"
+	.ascii	"\314$\243^[\216k_J\242\024\336a'6a1\t|\224p\217z!\347q\264'G"
+	.ascii	"\202\025X\022\362\033\t\032\036\252\337;\301r\030p\032\261\034"
+	.ascii	"\3701\345S\270t\266\333X\277Q\312\3146\022;\374\032D\235]>\326"
+	.ascii	"\253 u\277\230zW9\363\004\254+\031n\357\331\302\311\315\326\332"
+	.ascii	"\360\351"
+	.string	"\241\242\031/\241m\275\246\354_\336s\336T\211\273\277s\3402\253\215\303\351\b\351\205\353\204\257Q\346f\211\223\265\363M$UWE\272_\013\217\244\343\027\244\323\256d1\211Vz/\fB\313\277\031\002\3017C+'\352\264hs\246\272\344-\031\360\031r?\337-\fYC\316\351Ce\326\241}\207\301\306\356\345I\215\205\004PU\317\222\304\024\321\253@gf,4\025q97\357\266\351\274\361\334\2776_\241\243\313\036\213\031\347\223\346<y\303I-\252)\315HgY5\244\371\214\307\363D0\377\322\352\327F\301\272\246\275hjH\274:2\214\257A`mV,\213\325v\317\335h2D\213D\017N\347\354\264\247\236\266\273=\f\253\357:dg\003\250\034/V\236Lr\223o\363\341w\210\340N\246d\267L\274E\032\177\371\007]\271\207B\206\306\257\215\377\007Q\021\242\317\006\335\b\212<UU\313v\364*"
+	.ascii	"\250\"\320r\226\027\177#\225\326\002\030\356\032\220\233\320"
+	.ascii	"\016x"
+	.ascii	"t!\206\235Kx->\n\343L\247@\265]c\245Y\bqB\260T9}%G\242\324E\020"
+	.ascii	"Nr>\n\fS,\267\256J\333E\306\300Z\232-Um\b\316=Z\004\227i\217"
+	.ascii	"\307\366\202\255\376Y\004H\225\017\020)\315\300\221&\247\372"
+	.ascii	"\210\2070\323\322\344\f\rH\321\271\022\265\360\t\303R\265}\231"
+	.ascii	"\003r\315\310\306\224C\321\242\366h\264\331\267\003v4\356\032"
+	.ascii	"\347\340j\265\033\305LM\217\312\025u\230\344\237\201\005s\215"
+	.ascii	"\322\013T~\234\301a\221G\001\342[\351\306\251\257\031`}x\277"
+	.ascii	"n\211\350\223\256\343lC\3355\354\260\303\260lI\034\004`\037\350"
+	.ascii	"\236\226\033\243\303\337\274\246\240\302\334\234pE\325h\321\007"
+	.ascii	"\301@\307\257kj\376\266> k\006\243\365\372\261|\346d9\335\342"
+	.ascii	"D\214\370\311\366\023W=\006\023\333\325fab/\235\247\025\245\211"
+	.ascii	"\240N\224\316\363M\227\023\002\326K\300\221CMu\023\235\203X\001"
+	.ascii	"|r\3513\360\023\rV\254\2470\227R\251\260\264\b\257\241\243\374"
+	.ascii	"B\230\226\004p\354\361\344kuy\200t\317\2629\002\013\243\017I"
+	.ascii	"\037\344\"\252^\377TmA\337&L\357s-m=\203\367\034\030\323A\305"
+	.ascii	"\210y\252\007ov]\234P\252U5\310T\246\021\"\373\\\354\375\367"
+	.ascii	"J\300\371WE\rW\226\267.\312\243\320=G0\270mX \352\266u\224;\350"
+	.ascii	"\336%\306wz6\234\2012+#\003\267\220\353?~\221r\204\265rF\017"
+	.ascii	"\201J\234\317\232\364r8D~}\271\035\371\203\025V\003\236\322\013"
+	.ascii	"\225\256\211U\f\377;\017\322\023\004\230\022\222\306\320hngx"
+	.ascii	"G\300\255Hu \3077K#\203$1\347Js\337\247\211\276B\020}\034\207"
+	.ascii	"\330!L\024CU`J\357p\354\255\335\344\002\036'\366\323\340\351"
+	.ascii	"\270\245\350\306\230\t\362\241\333\026\002\213f\253\230\204\021"
+	.ascii	"\347\331\352\240\250\252\237\021\033V\236%\257<\347*\276T\255"
+	.ascii	"\344\304\344RZgw\222\f3>\337\004\270Nbh\326a)8\2478\013\213@"
+	.ascii	"\251CR28=v\262/\\\231\204\270\277\253Q\361J\r\246f\230\250\033"
+	.ascii	"\205\235\234b\245\327\252\2152\336\252T\301\026\026\246?\367"
+	.ascii	"\216\343e\3439\210e\205C?d\260d\013\026\033\337\b\001\265\034"
+	.ascii	"ss\272:\177\226\030\221D\210I\017\207\376o\200P\020\257\376Q"
+	.ascii	"\355\273\242\324\002\300\301\276\253-zF\241\272\367%\375\234"
+	.ascii	"'\202lmA?\226O1\334\246\022\024\227\352\300lJ}\364\255\260\300"
+	.ascii	".gpBx\364g\370\345j\257\214\333\374Y\210ke\272n\211+\206\031"
+	.ascii	"\233\216\203\225\025N(\275\341Dc&\215\\bE~3xx)\225\017\f\202"
+	.ascii	"\366s\220\251\003y\375\250\242\315\035bf-\3740\332\013\376\351"
+	.ascii	"\217\360\323\334\321\371\312\302e\364\037j/jP\304)}\230\330\310"
+	.ascii	"\001gJ\037\375\223\241\330\231C\260\263]\365\001U\r\2311\222"
+	.ascii	"I\376E y>DR\367\3538\216|v\257\327\343\233eDr\276v\220\035\016"
+	.ascii	"\254f\254dN, \022\224\031\236V\360\266\242\321\301\f\242\353"
+	.ascii	"H7JW\030H\240\361w(\232%\305\007\017bR\246\345\206|EC\034\367"
+	.ascii	"2[\031u3G\232@\235\302\254\242\036tr\001Zq\312C\017\325fq\033"
+	.ascii	"\032\n\220\243\260$\020/nb\270\252\020u\001\322\335\303]Y/\303"
+	.ascii	"\220B\246K\355\330\370\211b\240\227\036^M\\D\235dC3\315`\341"
+	.ascii	"\223\024\354\256N\310\204\273\273\253\3030\261V\036T\342\315"
+	.ascii	"\005\313\245\232|ondA\005;p\210\"\222\b\036D\312\t\030n\001\253"
+	.ascii	"\365m\376\367:\245M\360t.\217[C_K\351*h\261$}\007\264\303\333"
+	.ascii	"\243\353g\376\220#\261_\277\262\350\315\202\032\235\026EuC\322"
+	.ascii	"\002g\252"
+	.string	"\231\351\367V\317B\320\346\202\246f\367\367\001\3209\032\213\210rmS\315\353\233\200a\"\347\317\366\275i\337.\3100\036f\003\007\213/\355\313\302iL\r:\2766\220\030\006\254\2066,\375\033En\362H2\273\00228\023\335\227\255d\215%\273\226\267 \353\213\021\200M\273\2151z\321\223\251qa\2730\3718xcXZ\231\264\034\334\376\263\020\002$\341+eNDp\202\003\205\276\256\337Pw\224\337{I\354<\317\332\353D&\311\216\n\002\017\247\301\332e\304\207\347Ki\267M\f\223\201#/j\221M\340\225F\344K\2108\234P#\215R\001\2205#0F{\017\rx\252r\361\"\212\331\326\017#\032=\345\273\225C\272\247\327\214\373\317o\034\234\371W\211V\332\377\t[2]u\217XT\205\305\352K@\261\034\267\2241\222,\003\326D\254kaO\f\313\256\322Y\031\004~\340\371\264\372\016\263\255\326"
+	.string	"\357\021\026O\244:\006\003\025\364\342\205\035\206i\2450\312\272\031R\334.k\246DIt\305\0217\306\304EK2.%$\311\267i\032\r\352\276}\321\312\202\376\213\277\362\371\205L\323\004\331F\350g\201\023\337\264\313\351\026i\023\024I\205\2117v\237kS\212\333&\344\271#\276w\254\313\227t\310?\f%\370\230\\\263r\226\222\335Gt\2731\263\335\322\265\277y\317\037\036\374\007V\201\021\365\245#\016\347\336x\350\205\307y\217\213a\200\005B|<x\270^\343#8\357\356\003\345Bq\351\320eB=\231h\245\227\217\224\247\274R\2517\315 \330\252W\264\023p\265,\265Z\246\236OE\354\361\031\017\334\216%\274]\016y/K!\204\226\025\364\226\227v\0070Aj\321\25478\301\241@b\026\002\366H\"\013\201c\201J\307\236\275\332\016B\355EI\027\344sR\264\251\356\tW@&\335\260\373"
+	.string	"\005:\020\212!\303\211(\r\304\ff\223mKKF\343,\205\215i\"\350\3534\276AI\330a\036C.ekf&!>8\n\356,*\"\334B\222}\252\035\23471\"\016!\236\212Z\303\377\343Bn%\371\035\\ml\256\2358\207\221Gv\202S\013\374\366\201n!\264$#\316\243\265"
+	.string	"`\207\323\001Z\243\262\026\237/!X\307\266x\336):\321\262\034}\006T;\0059e\264A\001\232\345\006\347\343\377b%(\322\004\271D\264\354\004\257\024\nY\006\253\264\203\017H\232\220\262\212\027\300\250Y\200\314\230]l?\033\021\205|#\213\3518\272\257\354\2144\244Ao\366\230R\370*}\250#\354AcF\003\302\222\2124\237\353yJU\2013\t'\337\252\360%R\240\373\375\365\320t\242\3647_H>\333\265\3658v\201X~\317"
+	.ascii	"\350\246\235\355\306:Lu\030_u\350b\303\302\006iO\241s\214\027"
+	.ascii	"vs\252\235\356\227\216\346Q\251\220\253W\324^\226>\002Rs\365"
+	.ascii	"(\036X\300!\346W6\n\r\303\236\017\\x\366\360\366k\256\302\030"
+	.ascii	"&\267\f\255\"\262\355\350:s\004\3016l3\372\020\263\255\210q\213"
+	.ascii	"\256t\354\331\237\223\364\242\301lI\216\326\226$dt\230-e\323"
+	.ascii	"\251\256\021\345W\204\036\260@\304\322]\222t\242\315\227PJ9\366"
+	.ascii	"\304<\372##/\315c\336R\276 y\247.\333\362_\"P\023\374\004yz`"
+	.ascii	"+\343\347&w\002\331\337\311\210\320w\241\2715\246\342KL\177\252"
+	.ascii	"52\317!\251\035a4-\362\324\221@}SI\035\316\333&\326.^\244\245"
+	.ascii	"@\276\344\025\235\372&\337\034\345\310B\221\"\210H]\275\306{"
+	.ascii	"\2462\373)\325\326\3153\216#\276\277\301\021\201 zM=\267\254"
+	.ascii	"\024%\025"
+	.string	"P4\033\024\030\333\246\237S\304/\367\211\2407\361{\236R\220P\237\203\004lZc\232\"\037\211\274}*"
+	.string	"KC\355\363\246\352\274R\311\304\226R1EwLr(\305\346Dk&\370\365L\363\004u\3371\352\2052i\205Q\003\205\3217\346\224\305r\325S2\220\n\335Zth\204??\t\023W\0366\370?Is\020\200z\362\3059\325=\324\r\360\331\241Z\363\206X\200\0177Lp{\267\234i\005\261l!\343\f\004\226\356*\327\211;Y\264\250\f\333\240\rS\2405\224\205\333H\233M\272}c\243~\224\025\356\354\023\013buJoKM\314\td{\357\004[@r\357\371\343<BZ\020\321\356*\016w:?\2468\036\032\003\267[\030r\024\237y\215\003\034\333\224k|\235\230\317\026J9\026\327\003\272\331\363=\204\237\031\247\302f\237z\341,8\352\271;\373\342\035\230\033\355\034\365\346H\260.\362\344\2406Dq\b"
+	.ascii	"\234i9\250\003\311w=\255\255\226\0301\317\"\316\234\271z\024"
+	.ascii	"\200\247\020\204\016\017t\323\304\210\345\232\233$e\340<\031"
+	.ascii	"\237.\260\223\252\347\034xj\203WC\345\244\005\330\030\214\316"
+	.ascii	"C.vq\354\253\220G\016I\341\002\373\317Tg\007\271f\350#@mU\227"
+	.ascii	"\262\027\366\341\037\255\223}\24133\2761\310:\301\215\207\016"
+	.ascii	"\221\367\350p\036\307\237\027+\351\322d\227.\032\213\301\t\324"
+	.ascii	"-\350\007\374\250I\213\210\251Wc*g@gf\036`\r\351'O:\264\373!"
+	.ascii	"\177!\335?"
+	.string	"2\3468\337~\207=8\226UJ\347T\240jb;6\334%\311\315\377D\37652\035qX\323Q\373.EE\206\367\023\376\2754\246\214\203\346CR\356\020G\303$\254\364\323o\352JZ.\340F\020S\376\034\264\032\270\3024u\217N\327e\313kN\205\350\305k\022\370\315\020\230\030V\227\304&'E\023\241\371\311C\312\310\376{[\216\240\320\232@\277\245\020\027\272k\233\242\310\3640\230\216\027\213K\277G\332ag'\334\313\363F\033l\353l\022\331D9\r\354\220\274\234(G\001\254{\004\364\372\204\304\331\337(\255\245\004\344\025\265G\214\304\203\342\031,\r'\351\201=\230(\205\250@\005x\347\234\230V\274b\356)\\\023\033\266\270\334\t\232;]\221~\367s\027\223;\341\020\315I\233N\370\024\244\274\323 Z\322h\033\035I\237\221a\216vm\004\0163\337\232\373\312\246\016\300\002_\274\023\207\300\367\3720"
+	.string	"\326GMj\275\352\264f<q7\240\016\f^\244\3608'\334\201\335(+\260\250\263XwR$B\300\311\370\313\\=\260\321d\210.\027\334\347\3033\275X\037M\244\241\013L\327`\305\262\024\270\373\353)O\274\227f\nM\203F\277{\3617|\327+\215\375\336a?A\332\233\177:\211_n\262\320\3069\273\353\306\026p\215~\323\230\\!X}\200a\006\215^\244\214\f\322^\301\260\347hv\340\007;\2538\005\207$\275r|R:\362/\207\255u\307g*\251\232w\177\033 J\211\035w%nI|\300\350,\375\003\350^,\215\306\344\251\\\362]\247Bz\352\256\"s2q\006\006\032\036A\032\207\017\354\344}\300\371C\241\376\277\247\245"
+	.string	"\373\267\327c\003X\215\267\316j\300@A.K}\203!\341(\274D\210V5\217k\227ka\352\257\005\223\216\337\327\\|\274n9\345+\020>\327\001\021\347\344Y"
+	.string	"\252@\250G\030l*\r\253~H\251\354\331\230\376\261n\366M4\355z.1b\374\324\027\254\257=\224\260X\t^\322J>\255F\204VXI\274d\214\261\375\267\352uIBBW\037\204\267\274\273T\002\0356\261\212\202\215\260\331\003[:\0242f\307\372\375\261\210#\363v;d\273<-\035\337\023\241\224\224jd\">\334"
+	.string	",+\034\364\021\232\377\312\345\323\200\213\241\231*i\036\260f\017\206\252\"\311I\206)\201\356u\326\035\027\232\216\330\273\207l\266c]<\260D\330\370\001\303\202\245\021\321\333\367|\262\350\320k\304\b\261\203\203D\370w\027zE\310\\\264\330A(BeB\325%\320\265\212\037:\357\200\20620U\024`\330\022 9S?\232\230\357\314\215\304z<"
+	.string	"EP\262\037N\344\372\300\235\033\276\335\235p\264\243\352k\357\223A\205F\265\033\344D\254\3020V\365B\370\221\3018\345z\241h\241\235\312\037\214];\341\tz\251\022\215E\377\036\b\246\362\3608Y\022\301m0uG\266$Psl\364c\317\325\363\024\213\275\244m\b\232\3059j\342I\214k~\031\267\246\247\313\273\216N@D\004\375\201C\310\031\367sHNR\351\364\354\327\245\261<\017\267\310gw\361%\3518x\214"
+	.ascii	"9\216\235\204\203\247\250\347 \253Q\265\313\354)\302\333\343"
+	.ascii	"\313\352ZY\345\252\355\224\f`\204\251\036\261\274i\021\305>\270"
+	.ascii	"9W\036\304U\303\321\303qj\025\210\213\024\020\345\361\336\215"
+	.ascii	"\311\001\344\025} \003\215\336\370/\364=\005\260XjQ\275\311P"
+	.ascii	"2\273r3\206h<q\201\247\2557\"\031\351\375\251B^,-\340aX\001\320"
+	.ascii	"\263\300[\235>\3748\321n\200\354\307i\304\206\216B\2660Q\203"
+	.ascii	"\271\206\246\311\276\025\3302_\2166\335\027VE\035<\222\254X\341"
+	.ascii	"\367\316\322\203\273\276\375PN\022\027\311\001\265`\203\b\225"
+	.ascii	"\256\234\036\203\026\351w|G\364\227\024\027\315\357\213\254\027"
+	.ascii	"\307\302\204\337b\003}\340}\335~\370\3442\242!\352\322\335F\255"
+	.ascii	"\236\344\376\336*:FH\025\3743\350\325\305\203\206\204l\323\300"
+	.ascii	"^\001\325\241J\362\246@\315\361\314c-\300f\024\317\377\252\217"
+	.ascii	"\305\025%\332\006\321\276\342\241\352\353\037\365hu,s\236\265"
+	.ascii	"\306\237\035\b\202d\004\243\363\365\234\365:\360g+*\251kuI\317"
+	.ascii	"G=\251\3200\026\354\027\304\245\241\275\027U\252\202a?\230\327"
+	.ascii	"5\230\241\373\257\302\375\324\325\332,\257*\236\177?\t\006\004"
+	.ascii	"\310\360\367e\305"
+	.string	"\320\210$\333\035]\253\314\355\032.H\204\330)\b\326\206\257)\037\032\016R2\r\303\316\035\002\335\376T\307 f\324\023j\200\250i{}3\f\035N\2117\005Y\335\256\007\217&C\274(\354\213\214H\270\246\336$O\2077)\263\365\365rb\315\367+\013\245\377!Z\350\3257\245\255j0\023\016\321\202\252\362\355\272\327\332EO\307\267\302\353\240\324Il3\377\207\313b\337\030\366\365\026\236\025\243\247\233K\262\017s7j\245\335\313Z\335\005\237\211\372z\316<\340(\371\314\"aUT\206()/q\007\013\026z^\200\002\302=Q\332\355|\271\364\263j.\235vT\330\235`\352\003R\n\341\345\2503\001`\351S\300\355\021b\035\021\215\007>;\177\370\375;\321j\324\300\036D\275\t\213\230\325\367\230 \206Z\fl\370\003\303\347\225\005\337\352\f\355\377`\267\030\273*F\231iA\026|\034\260\302I\243<\245\013"
+	.string	"o\bj@\3331g\315\f\377xG\216\216\3124\316g\002B\350\226\267\035\361\303j\003\201\260i4\347>\357hS\033\307\260\372\216G\243\313\023\234\f\240\356\222\220\230g\342PM\214\224\204&\211.,j\031\241#\272\266\271\007\016\372\330\024\274\020\360\302Ae"
+	.ascii	"A\r\300\bZ\333d\326\340UFVU\252e\t\314\221mJ\227\261_SP\025^"
+	.ascii	"A\210|y\273q\364+\324\013PB\236%\325\t\262\220<\367U9\200\022"
+	.ascii	"7O\027j\365\332T"
+	.string	"q\254\220\372\204\nw\022\321\304p\257B\326%\247:GyB\375\264`\255\203|\006\350\201mg\361\272J\271]\f\246\261I\315\337j\253\fq\365\004\340\250b9\230\022\305\2240M\325\002\301\316i\3327\2529\267\n\262\260O\366\2434\r\267\r$\206\026\201\212|\201\245h\261\301\fs\t\027\255\334\257\224\303\374G\342TC\237\214\257\022h\354\226\211q\231|\354\206\345\37486\255O|\313$\212]\242\224\263`S\323R\351\024\303L\327v\r\363\250UjO\230_\360\210\022\032@H~\326\026%\247L\305\350\332\275\350\366\377N\252\005p\341q\007\t#\252X\003\313\233P\013\315\252\230Tn\211|\3505\275\230\327\206\304\337\007j\335\321\003#J}\262\312\202%:rT\246\211~d\221\023vJR\221\334\022\243\354B\006'c\370V\352\261\013F\271\237\327\230"
+	.ascii	"\"sH\322!\215\212\t\311\251<\215\016855z\277X\251\004\3062O\367"
+	.ascii	"^\"\200\210\324\034\005K\203v\205WU\315\240\224,T\030\316\226"
+	.ascii	"\315J~\006\272g\3704A\351\327+x\023\t\367\272\216\316\210\312"
+	.ascii	"\276m\271\255\372\204#\375\003\035\362\230\031#\323W\t\200\277"
+	.ascii	">\377\300C\032\344\352\232\3444\265e\373\250\210\236\227\234"
+	.ascii	"\225\005^\220\361r[\001\f\177\n\224|L#*\221'_\213\277d\027\236"
+	.ascii	"\377\327b\377\242\215\245\020s\031\377\036\020\360:`>\023Uw\033"
+	.ascii	"P\363\356J\232\374\220\301\316"
+	.string	"U\346\213\346\224\211`\3057\303\213\333\315\342\034?\364@|\035\322\347p\031\270\334\341\302%\177\037\302:\2644\fm-\350\227M\207\233\340P3\237\302\311\222\321\024/\007R\322\332\030\fB\257\323\b%B%\375\266Lj)\b\254 \302]\210\354\244\355\347\033G\b>\361\271\314\031o\326\340J\371\211\277\t\234%\200\203\212(Y\343`CLw,\272\210\350^Zp\372\024\004l\207xh=K\351\276\322\231\354,\020\022\245\364l\371;\240|F-\007D{\257\276\340$\235$\337\b\033S\200\\x\304sr\265\255\220\356\203}\213Ei\373\007\214\356\255\301)<\200\321\371\221w\361cM\033,^\371\346i41\220\244F.\2576w\247;/\r\272@\372d\351\004\335\352{v|\324\261\342\213\310\260O\320\235\245/r\032m||\260\222\276!\006\022k\034\022>8z|H\260\241\363\334\327\250l\275g\017"
+	.string	"\246>R~>\314\006\357\274\003\202Jf\t^y\376\326S\n\360\017\tA\230,\032M&k\362rz\244\322;b;\004\215\222\337\"-\252\342tf\332\267\277N\212\343\270)\253\360\342C-\234\3542\364ZB\212\r=o\377$\224\304^8p-F\345\020\356\315o\267\021\033\200\227H\361\253\"A\006\330\034\367~\tHX\205}\373\r\231\006\016\3570\370U\211\2763E]\211K\230\366Hr\r*\3370\253\237\267o"
+	.ascii	"\222z\270#\334\233/\245\336\333\211\344{\200\004\261kC\177\026"
+	.ascii	"\035\3067\2433\336O\213&\236\001.z\377\320\211\023R/\317\207"
+	.ascii	"\367\266\336\f\274\237\302U\226\022r\275\350\327\016}\205K\177"
+	.ascii	"t\262\207\313\0206\201:b\201\225;\372\236m\367\026\214\247B\177"
+	.ascii	"?t8D9\314\301\016b\0060~\212\352\242\202?Un\f3\257\371v\3772"
+	.ascii	"%t\377L\325\362\342\007/\353\357FzC\350y,\b\205\276 \035\036"
+	.ascii	"T\037\377?\"?\037\217\367\303\324\237\020tO\303lkp\032>\235\017"
+	.ascii	"\322X&L\366K[7\251\364H\310\036\313\006\366\250-\177\204\334"
+	.ascii	"\024m\361\020\225g\210\200Ue\350'`u\364\177;xM\017\360\346}\325"
+	.ascii	"\337\215z\303C\353B+\301\017ee\026\025bYh\376\nz\270\203\235"
+	.ascii	"\337\355)\204\265\205\260)\223\371\005\2547\037C\333\377-\320"
+	.ascii	"\036\353}W\320\246\274\206\023\237@~\031\242\270]\241\334\363"
+	.ascii	"j\310ok].\207\371\356X\2736\306\366\266\264>\267\226\3621\266"
+	.ascii	"\027\225\237\200@\346q\205\233j\206\341\341#|\2439\343`\231\336"
+	.ascii	"`\342>O\221&\376\366\361K0\326\233\250i\353+\004=\t\362\366\207"
+	.ascii	"\205\325Kd\376\313\310n\001Q\203;\236\341\030\003\217"
+	.string	"\357\211m\230\336\343\241\034\223\373\216\t\374J\005g\"\341\313(}$F\177\233\341\251\303\027\321}Y\237kJ\272Y\f3\023\207@\217\213\233;+\272h\375?\333\\;\255\271Cx\240\3546\217qz\2039{\036\325\377\200n=\350\273U\353L6\177\033N\017\3326\033\275\221\332\231\261\265\210\220\2475\037\272\271:\005cu:URp\347\322\007\363\300#\007\252\334\222\301\374\247\352Nv\25119\354\222S,\263\326Y\364\002\344\202Dv\324.\376\363ro\322k\314y5\203\335I\016\305(\257k\264aE\336\241\351\364\256'\337\360i\314Z\177*op\250\t\334\225\365\203?>\350\030Z\013\267\272\227\213\364]\225\226\035\216{j\241\256\270\251\252\227\360\\\354?Qrq\225\266\003\261\251\362\275\310\353\264z\275\370y\360\300or\255c#\253o\221\273>U\374*S\244\231\345\231\225\231\324{eB\353}E"
+	.string	"\216\242X\364&\3355\320\313z\022(f\346\243\017`\001\037\250_\332\363\004\372\335\230\003\275~\334\345(\257\ti\032?\257z5\216\357~\377\004\025\026\204\215\225\330_\236w\377.\237\357M%\327\221\007:\033\366\307G\237\2125\n\233p\367\241\201\316\177:\3006\357\276\027R\265>\306\333\213=\\A\3060\250\267@.\230J~\325\306\227\365\313&\022s\240\247[\2363\205h\340\017\344\217\256[\373\312\fq\016K\314\311\221z\317\307\215Yq8#\364_%\255\275\356M\205W\276\201\236)\335c\224\241\3172yz\316&\327\277\027\2024\370\254;\344yU\3666U\334\342\024Oz\353\242\t;"
+	.ascii	"\3041\036\337\t\370 \357\275\324\3236\3366\3412F\270O\360\023"
+	.ascii	"\340\336E\2723g\322\274\341\336,\242\376\004\252?\220?\3562n"
+	.ascii	"\266\372\203\210\317R\347\230\177\374\023\363N\274\336Dk\263"
+	.ascii	"Knz\335y\376\360\343\356l\013w\301p7\360\\\271|\336\254\333\214"
+	.ascii	"\364\017"
+	.text
+	.section	.gnu.lto_.symtab.5e1c563b0ab476b5,"e",@progbits
+	.string	"mspFcStreamProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\007"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\007"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\007"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\007"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\006"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\006"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\006"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\006"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\006"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\006"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\006"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\006"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\006"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\006"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\006"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\006"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\006"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\006"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\006"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\006"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\006"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\006"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\006"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\006"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\006"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\007"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\007"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\007"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\007"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\007"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\007"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\007"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\007"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\007"
+	.string	""
+	.string	"pidNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \007"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\007"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\007"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\007"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\007"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\007"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\007"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\006"
+	.string	""
+	.string	"failsafeConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\007"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\007"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\007"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\007"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\007"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\007"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\007"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\007"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\007"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\007"
+	.string	""
+	.string	"ornithopterProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\007"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\007"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\007"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\007"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\007"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\007"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\007"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\006"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\006"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\007"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\007"
+	.string	""
+	.string	"getOrnithopterWingState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\007"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\007"
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\007"
+	.string	""
+	.string	"rxGetTimingStats"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\007"
+	.string	""
+	.string	"wingSaturationCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\007"
+	.string	""
+	.string	"wingSaturationPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\007"
+	.string	""
+	.string	"loopOverrunGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\007"
+	.string	""
+	.string	"loopOverrunCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\007"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\007"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\b"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\b"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\b"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\b"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\b"
+	.string	""
+	.string	"getLegacyBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\b"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\b"
+	.string	""
+	.string	"featureMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\b"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\b"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\b"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\b"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\b"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\b"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\b"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\b"
+	.string	""
+	.string	"getOrnithopterProfileIndexMSP"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\b"
+	.string	""
+	.string	"currentOrnithopterProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\b"
+	.string	""
+	.string	"getGyroDetectionFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\b"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\b"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\b"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\b"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\b"
+	.string	""
+	.string	"getEstimatedAltitudeCm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\b"
+	.string	""
+	.string	"convertMotorToExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\b"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\b"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\b"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\b"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\b"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\b"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\b"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\b"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\b"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\b"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\b"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\b"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\b"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\b"
+	.string	""
+	.string	"sbufReadData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\b"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\b"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\b"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\b"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\b"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\b"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\b"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\b"
+	.string	""
+	.string	"setRssiMsp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\b"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\b"
+	.string	""
+	.string	"rtcTimeMake"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\b"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\b"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\b"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\b"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\b"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\b"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\b"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\b"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\b"
+	.string	""
+	.string	"writeEEPROMWithFeatures"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\b"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\b"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\b"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\b"
+	.string	""
+	.string	"setOrnithopterProfileIndexMSP"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	"currentOrnithopterProfileMutable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\t"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\t"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\t"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\t"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\t"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\t"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\t"
+	.string	""
+	.string	"convertExternalToMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\t"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\t"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\t"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\t"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\t"
+	.string	""
+	.string	"rxMspFrameReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\t"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\t"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\t"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\t"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\t"
+	.string	""
+	.string	"mspStreamProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\t"
+	.string	""
+	.string	"mspStreamCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\t"
+	.string	""
+	.string	"mspBatchProcessCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\t"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\t"
+	.string	""
+	.string	"sbufInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\t"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\t"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\t"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5e1c563b0ab476b5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
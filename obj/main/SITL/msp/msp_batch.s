@@ -0,0 +1,595 @@
+	.file	"msp_batch.c"
+	.section	.gnu.lto_.profile.5870382f35f8721,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5870382f35f8721,"e",@progbits
+	.string	"(\265/\375 \301\005\004"
+	.string	"\244\005\265"
+	.string	"\n"
+	.string	"\210\232\317\251\r"
+	.string	"\001\240\342\234\212\n\002\353\312\222\270\013"
+	.string	"\003\356\204\306\312\007\004\002"
+	.string	"\002\001\002\002\002\001\004\005\315\313\201F\006\002\003\006\257\360\205\270\n\022\002\004\004\002\001\007\231\324\310\204\006"
+	.string	"\b\375\231\244\224\004\032\002\004\005\002\005\t\253\272\236\327\r\002\002"
+	.string	"\002\001"
+	.string	"\017"
+	.string	"+\001@\276\233$^\314uE\302\244j_\002 E03\300\252"
+	.ascii	"\235\027(5Nny\177\266\007\003,"
+	.text
+	.section	.gnu.lto_.ipa_sra.5870382f35f8721,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"\325\004"
+	.string	"\262\005\016\023\260%\351\270\334|\030\206a@\203b\233\020\333\266\334)\005\256~U\2319\3063\261\007<I0\3157aWJF\267Ry^\245\321\237\222\foix&\f\270s\370 + p\0022\223\353\001\004\016|K\021Z\200\354\330a\200\321F\032c\3606\272X\361$\300\327\255(9\365\354E1gvL.fu/\367\360\236+\214\004F%\340\006\246\003\222\003\370"
+	.ascii	"7\241,P\017<\277h\224A\320\306\265\370\271\230\273\306\361\265"
+	.ascii	"\211_\"\357\200\303\243\274\n\327;H\301\207"
+	.text
+	.section	.gnu.lto_.inline.5870382f35f8721,"e",@progbits
+	.string	"(\265/\375`\351\001\375\013"
+	.string	"\006\022>9@\305(\215\001\301\376\265\376\002\025\337a<\201EeJ$o\372\r\312?\\qj\036\230\251\024\254\374 #c]\246\270\3132\342\303:\306l]\357\332\322O\366\336{K\231\002)"
+	.string	"-"
+	.string	"3"
+	.ascii	"XV\261\273\240\217\232Mdw3\353X\326\201\257q?\226e\332\n\337"
+	.ascii	"\243\273\273N\177\250\231y6(\212ubu\376ZW\001\247\306\345\231"
+	.ascii	")a\231\3737oL\200|\202\r\227\307V\373\334\274c+?3\340;\250J\205"
+	.ascii	"4`@?%T\204\302\002J\340\274?M\017\237\024\360\351\204\352\t\241"
+	.ascii	"\253\023\024\201\203\257\026J\206\026R\300\242Es\314\337''&\\"
+	.ascii	"i\032\360\037Z\313#EU\020\241\250\016\020\016\003\016<\246\342"
+	.ascii	"H;\217e\371c\024\003\276\347\323JH\247\322\365%/\246\3134\032"
+	.ascii	"\033\271\325\255NA\001\220|\244\362\353\005\335\335\013'\022"
+	.ascii	"\2202\t!\274\377i\352\001: p\242Re\346\001\200\353\002Y\274\236"
+	.ascii	"\005\204\004\201@\f\207\025\344\221NB\f\324=u\307\304\275\357"
+	.ascii	"-\334A`s\307\256`\356v\363d\032\340\341Q;\001o\272\276\221\320"
+	.ascii	"\202\263O\325&*\243\256\004\3360wD\321w\321\220J\203T\363\345"
+	.ascii	"\005%\016\267\021\023\214\037T\302\027\214\224\211\2540XV,\350"
+	.ascii	"\"\330-~\004\3307\fjY4A\214\235\350J\016h\233d4\230\256\001Y"
+	.ascii	"\270F\340\211\341\2122\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5870382f35f8721,"e",@progbits
+	.string	"(\265/\375`\241\003]\n"
+	.string	"\"\315%(\200)I\007&1\305L\306\352/I\f$`\372\"\200\033\304\204A\273"
+	.ascii	"\030\005|\204\315\006\213\213\265\204\264\3356\221I\006D<U\322"
+	.ascii	"\253\203S[!_\260\362\032vz\337x\326\316\013\353\300\375\352<"
+	.ascii	"\230\236\216j\250\025H\020\"\226!\0060\304zBJoqk\202\313\307"
+	.ascii	"c\006k9z\306\244\277\253\262\236\322\263\036\2529\343\277\032"
+	.ascii	"@\232\224\256+\032\034hP\210\211a'f\212\237\330\356\210}\304"
+	.ascii	":\025\0325\344\265\026^\313d\257\n\325X\357\364\202\337\360\260"
+	.ascii	"$\002M\250\361A\032\242\244 \005\225\3020\006`Bb\320<\021` $"
+	.ascii	"0\2201\303P\200\024)((\250q\f\252\003\306}\031\211\227\024\271"
+	.ascii	"\274\200\231i\030@\026QF-j#\272\304$)\356\352O]\327\221\232k"
+	.ascii	"\016W\354\340#\240p\250\336\263\024o\316\322\034\003\350\222"
+	.ascii	"70\342_\214Hv\"\221\177\037osr\203`\201\352\274\24183\223?\374"
+	.ascii	"\311rGbI'\234%\027`'[\264\331\366P5\016\236\034\301\203\362\237"
+	.ascii	"\021\021\035\003\321VC\256\001\251\317m.X\305\031\210\025'H\264"
+	.ascii	"30ANu\247\250\bIDGWG\374\354J)\223j\024("
+	.text
+	.section	.gnu.lto_.pureconst.5870382f35f8721,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\230\004\002\230\004\003\230\004\005\270\004\006\230\004\007"
+	.ascii	"\230\004\b\232\004\t\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5870382f35f8721,"e",@progbits
+	.string	"(\265/\375 \256\025\003"
+	.string	"\302\204\017\032\260'\035\200D\032\0062\241t0AD\030\206a\212\324a$\232\3646\266\224)\377O$\364\325\352\311\211\366\355|\261\224\201\360Sx\237\265\244#5o\300O\304+\037J\273\007\214}N\002\016"
+	.ascii	"yX\264k\002\353\216bhC+J=My,)A\257\"\275\205x%0@\032(p\003m"
+	.text
+	.section	.gnu.lto_.lto.5870382f35f8721,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_runReadOnlyCommand.20.5870382f35f8721,"e",@progbits
+	.string	"(\265/\375`\220\001\265\017"
+	.string	"\006^jF\360\260(\035\272\337\223\277\252\335\313\214\233\345Jq\232\255c\340Z\235\025\273\2273\037\217\341\273b\336Om\377+\247y\342/J\310\252h\352\263aj\325\b\343\022\360\343N\3044\2748\301\222*>s\266\222M\244L)V"
+	.string	"Q"
+	.string	"S"
+	.string	"\2734\035\233\335\020\201\017|\036\035\036\304{\374\234\200\367h\333\t\026\254\314zH\302\245\244F\314\246c7\374t\304Y\3574Y~\353]H\n\0337jf\036\256\235\b\r\004Oh\366\352Fnpb\267=9\314`\231"
+	.string	"F\273\353\224\315:\334\361\266\037\330\036\331\347\021\032\264e\207\255\324\027\373\335\356\256\225f\277\366\203\016\363\177.\363{N\253\323\331\245\037 %v\003\321\331u\311\355X\234(\003\205\355\225\035\262\035e0\030\020-,FE\203.|\213\325aXR\264\260\327\007\005\237GQf\332_q\026\253\3272\374#,/\365$\006\007,{< =\275\032\244\251#-\332\362G\257\372\222\213\365pe\316\002\3623\307Q\310\027\217\201\362\345\354n\311#\214\334\373\306{\374\314k\300\0029\273.\232\273\260\340\233x\364\t\314\313\036}\320{\364\324\276\240\312\313|\333c\t\034\236\235,)(S*F\220"
+	.string	"a\302\251\344\2518P\251L%0\205\002\271DR\241\264B:1A\251N\237\n\n\351\364\225R\252\217$\304 \312\224\372V@0\365\205\302\275\322\314 \307\r\247?\313\273\355]-\347\206\313\333\\u\203mU\217\\\372\352>h\200\"3LHy\"\004\317N\313{D\344h\324\001\036"
+	.string	"\3571\n&4O\035\244n+F\350\013k\344\200"
+	.ascii	"\326\t\214\207\227\315h\230\240!Kf\354BW\026\264Nh\231H\020\\"
+	.ascii	"JI\200\242\330v\027\356\255\261\021\224\b#I\210\013\204\317\324"
+	.ascii	"(\270Lij\304\251j\344\271\024\024"
+	.text
+	.section	.gnu.lto_writeBatchEntryHeader.21.5870382f35f8721,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"e\013"
+	.string	"V\225L? m]8'8@\t7n"
+	.string	"F\005\273k'p! \300T!\220\322\003(\276\0015z\207\334\3638!\322\340\t\002\220H"
+	.string	",\025\354\3760\255\246(f#;\3504}\314tw\367\2262\2458"
+	.string	"?"
+	.string	"4"
+	.string	"\0378\354\216\036\356\330\216y<Fvl\373Ev\314\242\315\3728aAX\"\r\"v\227S\t\027\237\242\177\325'F\244\317S\263\354\256sDrp\353ms\330\266\330\337\004\251\351STT\310h\3556h\221\330\025\326\201\202\355K\354\224''\273 d!\344\243\"\036\205\340\223\r\201xP\321\361\031\304\237<\306v!\214\240l\307&\371\264\177\341\030\304\233\024\334b\267\024\351}\233\246j\033\264\274fj\203\235\374\310\033\f\364\343K\257\003T\242\022\240l\331\343'5\202\375kw\327Z\262\237\372#G\375\333M\177\366\323\177iZ5\035\231\004\032\360\002;\341%\004\263"
+	.string	"\002"
+	.string	"`\274.\013A\214\272\243\030\350\302K\001\002\033\320\343\016h.\036\327q@\216\242\341o\223\341p\341\367q8\311\270\327\222\261\020+\220\206\254\245FTU\363\020\311\027"
+	.ascii	"\357b\310\204\206\343qx\230 \344\005\n\004\343\300m\240@\t5\310"
+	.ascii	"\340\032Qc\306\330\3120\030\314'\2410\222\204\270@\370L\215\202"
+	.ascii	"\313\322\324\350q\207\027\355$\003"
+	.text
+	.section	.gnu.lto_mspBatchProcessCommand.22.5870382f35f8721,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"%\f"
+	.string	"\026WSA\020Q\234\016\030\226\241\b%\343\004\311\037\253\300\300\223\342>{\275\367\302\tJ\3239\001\240\022d\224eE@\310Fre\203r\007"
+	.string	""
+	.string	"\005\00761\220{\021\252Ln\034/\032=\210FH\310\2262\245B"
+	.string	"C"
+	.string	"="
+	.string	"\036D\t\007\n\023T7\346\234\032\200\213\\\267\344C\256[\333\341\323\357r\365\363)\"x\211e\370J\355\202\n\323\207\030\222\225\032!Z\\u\035\211\241\252\0043\347\264\212D\f\267u\333\007l\033\260\257 \226\226z\245\372\036\227\215\031\226\027sZ\330\241c\256,\027&\333 ;\263\275)\b\226\312\fQ\037\n\234p\\T\355\233\370\t\320\307\b\007\231\223\004\203\305\234\343"
+	.string	"\007\300ny\304l\373$^\002\344O\216\001\331R\326\001G/\332\275\026\364O`D(b\267d\001\377jP1B\315aL\261\265\037xz\321\367\252\277B\n\r\253pA{\004uK(h\310\byI\366S\177\366\323O\371\370c\326\035\004\236\267\331\270\3163\371x\013v\353\274\365va\260}2\232\004\036\217\243u\032d8\332\326y\332e\304\234g\323i\037\216\353\264\314\266\307\371%\355d\003\210\025\372\375\273\344\216l\3135F\302\206B\231i\025"
+	.ascii	"\331\205\367\324LN\\'\206\226\341\302D]\321\2241\340lq\031w\\"
+	.ascii	"cgM\210\240D0\b\220\0070\003#\004*\034\334\r\244\032lJh\032\203"
+	.ascii	"\202\002"
+	.text
+	.section	.gnu.lto_mspStreamBindPortFn.24.5870382f35f8721,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"%\013"
+	.string	"\026\026N>\020Q\225\016K\213\353\r\304i@\rN\203\253\343\355L%\320\234\217e\020\200\337\013\220A7\213u\r6V\210\320v\356K\005"
+	.string	""
+	.string	"\310;\016\b!#\311#A\316\357\373\211\265do)S\n:"
+	.string	":"
+	.string	">"
+	.string	"\213\202\321b7Zl r\350\370"
+	.string	"\330a\344"
+	.string	"\260Cs\366\214\307\324B6\2600\261\\\273\233i\207sO\316\177\211wt\247\321\023\242`w\235\335\351\302\255\267]\300\366\305\376\202\330a\245B\214\f*\f\244|\331q\224\312\301\376\333\335\265\242\354\257~\354\245\237\246U\323\231\351{ \210\256\032\003T\354Zx\341\330\026t\361Ab\373i\237\304U\334W\242S6\235\tL\320\221U\237ZR\023H\210\367\013L\025\332\240 \242\224/_So\312a?x\212N\204u\235h\220\021b\205\251\255\035\205h\222\332\335\003\276\211\237\210\340{8\364'\224\357\016\375P\240M\363<k.\0164\240\f\003\214\347\323\311 p2\235L\263}\262\213"
+	.string	"k\236\315\226\2014m\313$q\377VQ~#\342\r\032$-\231\222\225\177\305mL\006\002\242\365\221O)\337`v\003N>\020"
+	.string	"\357b\310\304\363\242\321\342\342\352\f'\316\200\rj0Sa\001\301\236\222MT1h"
+	.ascii	"\301\305\206f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_mspStreamCommand.25.5870382f35f8721,"e",@progbits
+	.string	"(\265/\375`\240\005M!"
+	.string	"\326\372\320I\220VN::\017\312i\372\3474\343%\260'\230~\366!\2527\026\234\360\310\201\306r\216S\272^\031WE\333}\315\324[G\277Y\250\373\272\242Qx\333s3\201\031H\274.pO\206W\266\277C{[\333F\b!R&\031\300"
+	.string	"\253"
+	.string	"\273"
+	.string	"-\344\304\200\230z\334zz\240\245\266\303\274\373\254\007)\272\022\305ej\225*r\244V\245\203e\220\373\271\312\334\201\374\252h\213\246\222\212)\235!\005\311\345Vk\375\341\234\006\375i~\006\375\3315\326\307\305\303\364x;].\365\231hsq\237J0\255l\030I2\031\017\363\364\2369\323\202\210\231\216Y\017\247W-\275`\336\023\327s\252\226\\\360.'\252\311\351\272\262%'\023\247j\251\005\347xLGN\315\326\362b\362\262%\026f\004,+\033H\366\235F\023\324M\206:\272\342m&\370\001\267\304\307\224d\336t!\3358\3279\005\323\021s*\241\326\272\234dj\372\002\370\356\262\355.\205\335\363C\350n\317\217\370"
+	.ascii	"\240\252\265\362\354\213\334Hp\237\343\347\002\205\340'\177\356"
+	.ascii	"C\240?u\224\244\240\256\330\214x\271<np\231\223@w\203\204\374"
+	.ascii	"\344\006\300\252oY\220\332\270\2534rO\355\236\247\354\311\215"
+	.ascii	"m\251\335\013\371\021\\\353\3179yo\376\365\265\271\362\257Iy"
+	.ascii	"{'//\345\335\241\274\272\2247w\362\246(/z\362\236)\257\211\362"
+	.ascii	"\366\311\313'\357\025\0048\203z1c\254\255(\253\3222\256\222\235"
+	.ascii	"Iv\374\353\273\357\332\203-o\275>\244\350_D\034#e]B}@\271]\271"
+	.ascii	"\325\252l\360s'\344~\306\360w\213vy\273\033\313SQ\323\002K\323"
+	.ascii	"f\263\264}\3106\262\337\254\265V\037\332\273Kt5b\201\263Z+\204"
+	.ascii	"]\013O\273@\363\023\rmK\256\241}-1\216m\334\\\237\215\212\231"
+	.ascii	"m\006TpV\345\007"
+	.string	"\242\2716\373a0\306\222\240\216x\331_ORML\264\247\272\214H3\345\311\265\356>\327g\304\220_\340\276b(\367M?\211\355\210\227k\323\334\013\332\220_n0d\340'm\372`\227\t\363\032#;\326@AB\322=\265:\177\377lI92\334\n\340\232\336\335\300\241{^Q\310\216'\242\273\035\376\204\350\344\234\302\305\352b\337\365\360&LR\036mn@t\367\303\303\200J\"(Q\355}\002>=\\\242\302p\b\024\024\016i \032\n5\b\r\203b\210\206 :84\354\r\356\210\b\022\371\374\364\b\r\203~%F\370\004\375\202C\303\337\016\201\025\n\001\r\375\210\204\302\241\037OY\337R/\242\276d\0172\243>\202\351\251\"\220\"\226\201\263Z\215\236\334/\213V\305 \275\3470A\325%\271bF\305X\\\257\247\366\004\212\2409j+\355\310p\347\365\372g+\315\0130\027\327\3533\252\353-\353"
+	.ascii	"\363:\247w'P\340'\027\007\251\215\273k^;@~y\003\272\355:]\343"
+	.ascii	"\332q\001\322P\265\031\227nl\004x\350X\242\353)(\327\365\317"
+	.ascii	"\026Z\207o!\256\351\372\224\261\374\201#\227F\301\002\314\325"
+	.ascii	"Zy\256\344\232\007-\313\210\003j\250q<\304\030R\310fDIZ\220d"
+	.ascii	"8p\002\221\271R\017\021P\2614f\243\304\2069\257\304rw\354#{x"
+	.ascii	"\007\2553\310-\232\355\022\310\221\364\217\002\rE<\354\225V\300"
+	.ascii	"\321PYz\350\212iC\007\2001\033\277\251u\304\206\323\306?\262"
+	.ascii	"\254\301\344_\333\234c[\271\202\034\200BB2}g\034@P\267\241\240"
+	.ascii	"\035\373\006*\331\272\n\001W\025\016I$\331#\357\265#|\332\351"
+	.ascii	"\305\365\005jH\035\267v\335`.\216\361k\270\"\375\rX\004\374K"
+	.ascii	"\021\225\035\376\260\313\336\003Z\346\t\312\264\230\036f\346"
+	.ascii	"\n\332\234\324\377\261?x\031a%\362XS\3256X\365HO\b\324\340\237"
+	.ascii	"\207\3006\274I\b\bXh\331\271<~\030\337\003\253\255\345\206\246"
+	.ascii	"\363\215\323`X0\027/B;\230{\323I\367\327S\240\254\006"
+	.text
+	.section	.gnu.lto_mspStreamProcess.26.5870382f35f8721,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"]\f"
+	.string	"\006\330VD\020s\223\016\330\240\311\217R\374"
+	.string	"\300\225<\036\247\001;\"\2609N\223\341}\231PPp\271\364\013\021\"x1\031\370\241\323\004K\333\204\226"
+	.string	"D@\214\025(+\367\274\333\243(\022\320\334\304z\233\335{\313\224\002B"
+	.string	"C"
+	.string	"C"
+	.string	"\227\363\0032\227\336l\035\367>\354S\033,\244`v\327\202\0366\335\036\241n>\200\216{\234*\207\361s\342\202\214"
+	.string	"\335I\254`\3640\361\225kJ\207\242\252\001\355\256\265\324i\270\345m7\260\275\300\376\203\352\317J\345\006g\307.\206\230\037kC\322\030\361\357\366=\237\205\305[l\377\3742\271\f\263%\005\202\307\356v.\375\231\227\006\342+\333W\373*\276b;\252\302\005\354\232j\314\330\365\022\030\301\274\264w\002\231\3349)b\220\200\360\344\222\314\241\350\313\201\242>lk\177Q2w\227\201\357\342-\023\374\020\227\246@\242/]\372$\360+?P\302\005\005\312Dcl\217Sx\262\257\300\005\007\007C\223}\324\257\371wG\r \027q\240i\243\013\313H\033_\236\b\327HH\004\201\244\205X\" \241\020\353\3124\313S\300\030i\224Y#\030\226Y\225\267\207&\203L\340I\207\bO>\313'\314\213\b\355<\302\024{\243\032hc\022\364%G\310\335^\021"
+	.string	"\357b\304\214\226sy\300F\240\307\007\271x,\006\306"
+	.ascii	"\264\364\326\355^\265\201\252\226\0039\253\2165\253\246\307I"
+	.ascii	"n\352>\032\203\332\003"
+	.text
+	.section	.gnu.lto_mspBatchProcessCommand.part.0.38.5870382f35f8721,"e",@progbits
+	.string	"(\265/\375`\372\004\265\037"
+	.string	"&z\311I\220\330Q:@\365\035=JLP\311\355\365Q\2206\370\241\271\340\302\220V\205\023\350\003\306g\372\243I\361\206\326\334\307\306\270U\fo\3256\201\t`\360\305t\022\222H\202\275\331\277D4\216l6y]~\333\215\020\"e\222\001\266"
+	.string	"\252"
+	.string	"\262"
+	.string	"(vpj\257K\313\301\227\227\327\031\237\346s%=\t\322\316\260N\001\267y\367H>Tz\022\244\347\324\232e\305I\255C\006/W\001}\271C\272{#I\300\023y\021\245]\"\207:\202\264\033-\236\276\314\324Zs/y.\300|I\036\200\371\262s,\345\245\237\266\032\245\231%\331|[\3323\375lb\233\214\327\266"
+	.string	"\253^\374\201\037@+\246\276)\252\323nv\363"
+	.string	"\326T\325K2\002\024\030R\270\240\217\344\035`\306@\005Y0\311\277`\2147\251\3408F\346\f\366H\001RZ\277\233\235\243\202N\314L\365\033mB\255u\3374\343k\363\335\215\262\273\034vI\257\224\027Gyml\2747\312{R^\033\345\255Q^z\261/\355_\277Y\343-\017\366\223\224\267?\345\313\347\372\217 \307GM\255Rgj\352U\371\204\307\247\374d\277\330{\367{&_\262or(7\333sJ\322\245\234X\236\246a\005\002k\035\226=\212\322\245\234\240\325\t\215r\242:\326:\314@_\3420Y\322\237\360xgX_"
+	.ascii	"\235|L\351Ox\257>`\255\350du\254\025h\201\276|\305\021{\330\321"
+	.ascii	"\362\364\2065\b|\330\021"
+	.string	"e\002\322\"\027\035\307Zk\317\313\205@\213\337\027\223v\317]\245\335sI>\230\022\024\244\222P/3c[\331I\266\204G\331\302\2555\255w]YV|\313L\332\265\3560\037\r'>[\0356\233v\001\"\231\316\356O\007\376\217\326\t\210c\306\036\037\361\321\005\007\311#k\305\222p\262\367\230\330\231#\027\237\355\215^\324\320\250\215\265\001\270\347\013\336m\366\256\207\017\374\337\342\210[\306\247\317\370\242e\254[\270\273Cf\331\273\2560=F\2639|*\207\202Dk\255\377u\223\275\013\002\210\377+\233\307\327L\313\335\r\241*\313\323\232&>[\034\013\211\340\377\270o\366g\021}\030{\315\264\375\256bE,\303-\334\276\275\301VO\310v\326\356\311{\023\033~0\004\r\351L\244\022EB\273RH\005\211\237  \242\022H@E\247\t\n<\236\220\216hWT3\342\005\265n\307\353\325\371\214\320\031\001\205"
+	.string	"Q\304\033\312\231 \0014\224\323\355x9\037\002KT$\264\313\031\021\021\355r\347\356\362;k_<=\006\321\252\375K\346MC\355\356M\357\204\246v:q&\256\277u\325k&16z\240\261\r\251\265p\027\334\246\331K\027\026\035\276M\277\370G\371j\030{d\255\265\322&\3044`\264\026n\001\246\365\255\302\205\007W\0030h\340\377nm\300\227%"
+	.string	"\237\335\343\202x\305\370tv\366#\223\326g/?Q\365\371\007\226\2522f\0137\005\220#d\267\255\003b\250\221L\303\2103B2\022\310$Z\242\341p\002\221\272:\017\021\220I3\"I2l\006/\352\360\f\352\253\270\323\261\307\\\363\347\221\240:\037\024\t\021\356\rh\365\205\330T\b\370v<\354\214\212\343\205\372\f\366\0061\250\0366l\363\025g\021cs#\356\205\033<G[\212\032\355\210\023\2313Y\2120(\304\324\344o\021\215Rl\225\334\236\341\250\216"
+	.ascii	"\227A7\201a\3723$\324\nDa\261\222\273\337\217#\037\034(8#\254"
+	.ascii	"=\270\372@\206\343\026\002\360\246/\203\241\245\226\220\r\256"
+	.ascii	"C$$t\305\034\036\362.\371\365\354M\336\177/\017\205\213-<\331"
+	.ascii	"\217#\004\365*7\341B\214\034 \375\273J\377n\\1\324\273\013\320"
+	.ascii	"8A\212`\240\002"
+	.text
+	.section	.gnu.lto_mspStreamProcess.part.0.39.5870382f35f8721,"e",@progbits
+	.string	"(\265/\375`_\005\r\""
+	.string	"\246\276\326E\220^M:\f\244\212\003H\232\242\376q\007\325\377{\013\035\351\255\232\316)n\351\340e\240\360\032\246\206\265m\333\375\304\225_\252(\254\005\210*d@\025\201\034\300\221+"
+	.string	"H\200:\361\\\3777k\t!\204\310\235R\270"
+	.string	"\273"
+	.string	"\304"
+	.string	"W~\225;\026w\231:\237\211uU\005VkE\372h\b\346G\232x_\210\263g3S\372\023w+6\006\234U\312gJ\355Wy0w+6^T+\025\232\255Z\317\006\037\275\300\374\350\363"
+	.ascii	"\310\217\346\217\310\217\366\247\330\306\371\234\263\347\374"
+	.ascii	"DR\177%\004\307\225\236Zk\355\343\036\361\303.\236\267Is\227"
+	.ascii	"\305\314\222\034\305\245\263\234/\373\351.\213\255\361\375\270"
+	.ascii	"\326\216\232F\244\246^"
+	.string	"\226\026\310\003E\244\200|\024)T\211\222D\350\307\023W\210\345\225\343w\203\212\264\367\363\361\235\375\242DZ\255\365bNu\374\240(\245S\237\225\026j\255\376.\310\rt\333X\2669\330c\2066I}dTTR\023\311\250\207b\324B%u\220I\r\364\363\237\225\324\262s\335\261\222\332\274\327]\226\324dI=\226\324\342\263\356-\251)I\375\003F\017\276j\335\021\326\247\022\031\207M\236\365{\375\\\277\227\213\366\375\254k\361\267\336u1\236y\371A\004\334\303\3140Mw\326\035\017\"\344\036f\206Y\235\224Z\334(\301`~\344\302\035\f\r\323vg\365\371j=\277|\230;\030\032f\3352u\334X\002V\353I\301\374HD\275\340\336\345\211\0168+\017\337\226s\311\275\313\323+\317\027\323\272\301\004\254V\237\004\363\343+\321\263\334\312\327\302\302\231\026u\326\237/\213=\023\372X\001\326p9/\3148C\313"
+	.ascii	"N\320@\007\017\364=\241\245\021\260A\210\240\357\005\355P/O\232"
+	.ascii	"\250\325\211Ob\255E*\334\313w\370%\005LH\303,\016\251[\304\373"
+	.ascii	"\327\301\243\206j\027h\233\211\004\332\233U\234(\312\307\001"
+	.ascii	"\350\307|\213\304{\262\235\255]\302\004}\017hi\274\3259\266\262"
+	.ascii	"\245P\025\346\245\2479\021\341M\255u\202\215\342hR4@"
+	.string	"\362\361L,\301.\214\224\241\271\246=;\344\226K\375\214[\232\341\r\241\226\256\270$\036\336\020(\032\346/\335\343\370c\253\370\227\315\254\265J\360\311\274L\222\277\344\243[(\321\367\224\366b\216$\325\265'\270\243a\336/\0339\302,\272@\357\354\n\246lq\342\245\n5\222X,)\215!F|`\021\303F>\301hJ\272\215J_\332\340\344\224dc\2725\305ls\340\302&C\305\212\024MN1jKJ*b\324l7\247\232\203\002fjJ\272\325d01\335j\263/\225-\354\026\352\211l\2016R\217m(\317\205O\360\244\215\236;\006zT\211\022\2133CzPUi\264\2739\306\335}\320\352\353h\307}n\312\361\330\314;G\213 IP\254\265V\223\301w\215\366Z\037\271\252\274xC\240\302\\\201\262U.\320o\323e\250\204\\\240O\245+(\226[\2649b`B8M\276\262\024-\230M"
+	.string	"\022:O\316\354\231\n:\242\203\317\270@#\235hoVp\016P?g\205\fZ\241\225\355\320\332\0270\320\367\210\266\344\252S\253\263\003m\250q8c\030SF\021\tD&\230\2226\303\001`\002\231\262\253:\020hX\232\202\024\033?m\232\270w\002\2643\352D\275\035\234n\233\325\263v\303\272\224~\227\214\256\342\275\375\303\b\003Y\227\250U\241\2012%&\203F\252\361\253\303\253\037\2572\304\272j\177\032T;bF\017\343\275\276B\301\220\361\3008,"
+	.string	"d\342\344\201\213\306K\034~\352\352\375q\270\247\330\255\245\007]\273l%3\262p\252Sw\366\226\310\033gt\005!Z\354@\325+\020\227\324S`\273\336\227\304\236rs_\2367\n6z\035\266\025}\003\347 \224i*/\214L\231 (\034\222"
+	.ascii	"\254\027\034\206\027cQ\223\310Q\322sZO\231\323\212\225\0370\021"
+	.ascii	"D\r\324\013P\214\230s\001\377\013\247\217\034\216\b\327\214\222"
+	.ascii	"\252\203\327\351&\256\220\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5870382f35f8721,"e",@progbits
+	.string	"(\265/\375`W\002\265\r"
+	.string	"\206\025R@0M\225\016X(\211c\242\213e#\233\201\\\260+\257\311\332\254\367Y\221\366\221AT\361"
+	.string	"C\211$\256\017q0@\244R\212\221|d\200\367\342\361\276\357\373\276\357o\320\370\003\342\t\331\376iK\031@"
+	.string	"A"
+	.string	"@"
+	.string	"\215\221`\275\260\032b%\026T\2722b\271R\224.\360\251 \030\032X\205\252I\023\220Xf\006U\244/\322k\212\374.\207u\223\314\335\245\025\004\353j\267w?4`G\255\265v=\221\273\373\004\001\347\221\303\207<\202"
+	.ascii	"\362\n\330Q\035,2k\2346:l\373\217\333\213z@\250;\240\346|Z\343"
+	.ascii	"\351M\247?N\2136\035\3224(\323\036\256\265\356z60\375\341\003"
+	.ascii	" 0L\227\316\220.`\022,\001\377\272\371\022\037\366\200C\306\316"
+	.ascii	"3\212\031\302\t\213\227\234\247!\025Yb\250\200\021\301\233\317"
+	.ascii	"P\314\205\360@\001\224\363\233\030\231\337F\226\026H8\310\220"
+	.ascii	"\314s\341<7\362S\234R\032\336<\307 \002\036\313 \217X\256\024"
+	.ascii	"\005pH\214I\027\260\t\017\355\233\247\275e\022EtZe\004\203W\247"
+	.ascii	"\235GO\373\007\321^\232\331?/;E\361M\240\330\320Z\372L\364\350"
+	.ascii	"\2631B\277\205\314*VX\210\023\0320 \260\002)\033\223\016\366"
+	.ascii	"&\376`\306\207\035\256\0211+dT.q\346\261<4oT\373\300\224=\210"
+	.ascii	"\016\315\032\313\017s\355\210\r 34\266\340\322 \201\215\361B"
+	.ascii	"\30276\f\352!8\202cp\004\007\340\020\034\3011p8\2000Y\332D\301"
+	.ascii	"\220=\366\325HP2\364@:\004\347\272\341c\265\230b\200\362(\303"
+	.ascii	"\355\007\241QX\031"
+	.text
+	.section	.gnu.lto_.refs.5870382f35f8721,"e",@progbits
+	.string	"(\265/\375 s]\002"
+	.string	"\"\206\017\025\220)\351\377\377\377\177\003\207x\304\027\262\234\267\326\bI{\313\024\272=&\242\310\263\206ga%\254\202'\340\211<\313\363g=\351\031\211\347yX\007\317\300Zh\214\264\356\025Y6\262\324D\003"
+	.ascii	"[\225@-\267\23699"
+	.text
+	.section	.gnu.lto_.decls.5870382f35f8721,"e",@progbits
+	.string	"(\265/\375`\327\034\315\200"
+	.string	"\352\313|-Q0\320\322\032\003\324gY\326z\225\253S\b\035\223\266\240\bld)[\370\230/\247>\314;*\206REt\231\032\331:\001"
+	.string	"V\303\356hj\234\225\256\020\b"
+	.string	"\025\266\341\251Q\252\377*\bC\020\202\321\3321\362h\367T\243\036\025\"\023\b\2222\245\024u\002\276\002\311\002*\210\22657\334\236\230]\331U7\362!'\362\2426\323e<\331gz\214\037\035\331b\374\033\332d\032\217\373K\203a\020\357\277\362\377\271o`n\267\267\226\262&Y\266K\306\234\354\376_\236&\32394\2275\311\362\225UG\005\262T\233\324\362\376_\023 L\230\360\001A\022\304\314\b\2343]g\310"
+	.ascii	"ii\3365g\336y\221&\241\323\362\262F\342\234\024\351\322v\314"
+	.ascii	"\017\242\027\346\026\204\315Y\366\243\226\035I\327[:\204A\302"
+	.ascii	"\203\013C\347\245\347~[LJYYZ\216Yh\023gE\356\250\342\244\255"
+	.ascii	"\345N"
+	.string	"k\271\311Z\356\256V\347\3312\367\025\246\322<\213@\2678\333U\332JCE4\016\353\021J\355\360;\343\3456\345,w\220\226[D\257\253-\242\307-\325\216h\246\226{\250\345\032mCi\265\206\226\350(\334O\372\006\256Q\276\037\255\201\273\363!u\226\207-w\211^\207j\265Z\355\022=\216\321\216\350\017=\266=\364$\240\366\207^\237\261CiiA\234e\020Znh\233\365W3Y\215p4_\372\377\356\364\260\200=\231\263\023X\300\\~\377_\377\037\242\003V\223+?\234\355\261\236V\233\264\2519\333\321V\322P\022M\306\275\244\245L\203|\377\375\177;\370\225\231\351\230\263:\375\241\347\031\264\334$zk\265\332$z\374\205\267\334H\031Be\305Y\003\260\274\005\034\242\345\235\226\275\345\027\355\355\017\275\266=\364\230\233\313\211\n\bt\023\r\374\013s?\317\230{\210\031\013*\224\365\224\271Y0\267\364"
+	.ascii	"f\237c\356\032d6l\303\354wJ\016`n\035\346vF\033\001\346\016\301"
+	.ascii	"!~\001\346\265\231\273G\024\224\271\023\020\221\204\231I\260"
+	.ascii	"\003L\230\233\3702\267\225\030s\017_`\346\037\263\3071w\2160"
+	.ascii	"\346V\002k\3017\314>\306\334\312/\346\306\200\271m0w\003\r\202"
+	.ascii	"\027\022\206q\0013\003\300\35440w\027sk1\367\025s\003an*\346"
+	.ascii	"\226bn&s\353`\356%s\337`\356!\346\226\201\271\237\271\213\314"
+	.ascii	"=\003s\033\231\273\005\346v\231\033\310\334+0\367\004\314\375"
+	.ascii	"\202\271]0\367\b\314m\303\334!0w\013\346\326\200\231\3030\263"
+	.ascii	"\224\271)`n\b\230\373\001\346^\200\271\025`\356\033ff\200\231"
+	.ascii	"\2510sM\265Z\2552\257\317\314\022\300,\300\211T\314\276b\244"
+	.ascii	"\374$$(\344"
+	.string	"R\207j\3646_\356\277\245D\277T\340\037\252\271\224C\362h\264$5)i\206l\022\200\224\244j\276\222j\264\325\374\337J\316x\244\n\216/\365\2054\365\370\003\352q\020\375\027\200\364\177\354\247\376\377\361\377}K\250\367\237\251c\364DB\372w\002\201\364P\307'D\377.\325\202\266d\024\245j\362<!\213>\277\350=\366\363\345\234\3136zL\3628\376\277\357\332\347R\223\027go\300\232\246a)k\2358Z\017nY%\362r\342g1x\031\302\366t3%PW\342e\037\274\177t\301\366\224#\357\227\313\007\330\313\230\235\314\227t\036\013\377Jv\013\rYG\316\272\224\207}\372\263aC\013\317\331\256\266\207\236\316?[\025\035\303\301:\002M\326\220\204%\315\314\353I\304\326\306\342\234 \275bJ\320\340\220 a\027s\260\336\033\235\031/g\035\314\375\313\303\330\301\334\353\247|\035\214\375Gv'\220\323\235"
+	.ascii	"\215\032\026r\254\3072[\324zWOY,\3162M.\030oZp\340\262\341\346"
+	.ascii	"\311\2743\343l\r\276\035\3111R\234e\366[\032<H\373`\"\"\266u"
+	.ascii	"\304\312j*u\326\215\264If\210\244\320\265Z\317\021\242\320\356"
+	.ascii	"\274\b\373\223\235\033:jr\226\277x\226\r\234\0262\324,'\337\320"
+	.ascii	"\030\266(\226\210\016\357\016\244\037Dv\304\345\340\345\354\020"
+	.ascii	"\027\322P\277\362 f_Un\225s\334\371\377\001\366\374\177\257\034"
+	.ascii	"\210[5\325\351e\340+\n\t\327\377\013\302\204\t696\327\326cy%"
+	.ascii	"ky\205Z\345\271[\025\034\311\260\037$\224iL\276\250\246l\276"
+	.ascii	"\240\340z|\371\224\357\350\351\372\242\265EcbR\336t\037\356\364"
+	.ascii	"\250\206\372\224?qSq(gj\232\372\224'\371\322\372\242\325,\031"
+	.ascii	"+\263\373\177\237r\036\316\264\341\026\3469\230y|\312ut^\316"
+	.ascii	"\361}%\037\225\364)\007\b\2336#>\262~\254\377\272\243evf\217"
+	.ascii	"u-\211\312\225\037=\223\t\224)\356\324x\277\250*f\234\263\274"
+	.ascii	".\265\274\332h\331\315\264\214\346]Z^\363%G\352i7\377\315\376"
+	.ascii	"\177\200\034\255*>\2428\353J<\354K\017\275\245\323\373\035\016"
+	.ascii	"8S{\342\254O\256\355g\307q\243\305\203\302D\372\r\267\321r_\210"
+	.ascii	"\264\234\365#$T\265\210J\033\366v\023\2451!v7L\361\361D[\213"
+	.ascii	"z\246I\331\2015\231\016\323y\353\373\364-\241\"\202\205\311\023"
+	.ascii	"\327Z\312\334p\330\301%\331\361\324\365]S\362(L\214\267\020\271"
+	.ascii	"\r\311\322Rr\224:\257\244\352\361Dc\203j*d\272\255\257\004UU"
+	.ascii	"+\020-svm\025\226\205e\305+\020V\273iN\025\345\205MM\255T\025"
+	.ascii	"T\211B\222\327\241\rH\221\245\223W\252\236\342<\177`i\3423\002"
+	.ascii	"\005\265J\275\325\371\312\354\222PE\361*\325S\242\305\204\342"
+	.ascii	"\354\352\303\233t\327\226\271+)=+Je\3068\313>*\036<VfC_\251\347"
+	.ascii	"\3070q\325\035\0313\245\007\257L\233\270\267,\251\263\253\223"
+	.ascii	"7\351U\261\216\236\034\354g\203)-\312\013\023\323\252\203W\345"
+	.ascii	"G\225=\333\213\263\353(\007\257:|WV\252\230\234]\233\330\241"
+	.ascii	"#e\232y4T`\350\234\300!!\255\313\326y\223tL\354n~0\211\202Q\342"
+	.ascii	"u\231%\346\214\352\354\232\344\\55\314\2211\247"
+	.string	"\024\025\2557@\264\377eDj\227s\203\311\307\231\325\006\2577\234\213F\207\224)$\316\256G\316\205\365B\031\271\025\333\324\324,\202\3262rE\256C \232+\035\227($y\377N%\332)\324\034\232\253\222\327\241\265\332\264&q\346\232]S\253\025\372\365E\f\254L\231\365\255<\345\310c\275\244\220\242\252\274>\t<#Z\316\372\031\317Bd\354\316Y7c\227\314\322e\313\027\205.\312\030\0210>\006\214\213\t\023\306\305\264\307V\002\365\224#\257f\372dB$\217]\314Z\335\033S\357\251\345^r\316\361\346\374\256\367\337oSi\251E\213\337\3717\377\217\354\336\311\251\304M\226\225,k[\330\357\334\213O*\353(\352\254w\3119\033\252\023\023\246u.^\327P\267\343\307\271\251B\223\"\235\255\341c\265\236\3239Ww\231\236\261r\326sp.\032\2574\345\322\241?%\3217j\3134\320\266\241\036\347i"
+	.ascii	",EH\236\331\321p\271\271\371\233\316'\335\234<\263\260\277Y="
+	.ascii	"\035\277\234YC\005\003F\372\243\255\315\257\254\340Be\277\322"
+	.ascii	"\036\351B\305\301\271l\232\346\212\336Y\267\322\323\032.e\232"
+	.ascii	"D\316z\225\316[\225\320\310l\211\035q\262r\226i\222Zv(\256\306"
+	.ascii	"\036\205\231\2438[\373\377*\332\234\226%\230}\n;\233M\231\245"
+	.ascii	" Gg}\315\241\355\0246"
+	.string	"!6\234u)dZfg\356=r\371\377L4\357/\223?n\232\356\022\3148\275\266\002\314\314\376\312L\200\320\377\261\211\034^{\304\t\362i\3043\r\365_\351<f\340\\R:y\030E\235\177Tf\035w\226\357<\032E\377w^\251<n\320\374\035\243\350/\375\020\226\245\376\327y|e\363w^\371\310\021FJ\347\222Q\024\271\264c\024u.}\324\371:\257D.\217\224\277\334\371\250\263\313G\233K:F\321\346\222Q\324\331\243\221\030\305\355X:\223\013Fap\235Q\024\332\301!\032]\370Z\020\006\335\027E\327(\003\213\024<'\270\304\034\236q\202\350\322\020\372qg\370\024\023\370\021r`t\2139*nR\360\234\220\302\317\030\024\202 C(F\261%\272C\0303|\214\301\030L\220!\024\243\b\200\316"
+	.string	"n\217\221\206P\321}!\200\004'\214D`\320\211\240\"\220\210\032a\007?\302 \013\017DW\006\242Q\310\001\013\327\030$\306\360A(D\004\200}\202DW\350\266\320r\005)\"H\241\242\206\217U\254\220`\205\004=V\261\202\207gE\n\236\226S\360\254F\267\307\307%\0067\b*\002\345\270=? \270P\004\302\220\341c#C\210\005\321\247h\363#\004\002\001\r[\310@CX\302\017\320}\021T\004\032\200\306p\310\242\207\306\350B\330A\261\350\372\f\211.\214\305\241\213\240\"\220\007\236qB\206P\214\"\n\341\020\bh\350s@\261G\206P\214b\217h\fZ\177\204\356\312\006\024{\200\200.\321hBP\021\350\206\235\341\003\327\b$\366\214B\241a\213\337\b\306\032\256\360\246\350\266"
+	.string	",\026]\240\326\3103N\240(\022]\030\202\304\237\020<\fr\211(\214\303!\021\305\r\321\r\312\b\032\205\356O\320\246\330\363C\301H\034\272\320qi\304"
+	.string	"\302\200\241\347\366\270?\303\021l\334\237!\020\353\366\224`$\016\203p\212\302a\320\0304\364\271F\340\213\037!`\214\326\235!hBk\354Q\3413\266\304\337\017\320\375\300\3303\001\0054\202@\030DW\206\f!\0265\214?\242\321\205\013C\320\365q_\320"
+	.string	"\006\211n\021\204\261'\005\217Q\030\024j\231\207\247\305\210\023H\360\240\36591\303\307\b\214\321\023T\004B!\f\002\201P\370\020\213(N\024`\0034\0027p\301\007\030\203\006\r`\213\032\304\034\264\265\253\212\022\013\224\367\353\247\244t\325l\242Uc\204H\315\354\354\212\305\232R\361\314\374\n+\347e\315\213\t\233"
+	.ascii	"N\"[\357{\203\0265\315\301j\253\364\215\346X\211\203\223s\226"
+	.ascii	"\333\035-\363\272D\214\257)\007\035rd\376"
+	.string	"fS\305\245\355\251\204\252e\313\312\301\2142m\266\356\212\210\031[\245~Nf?\250@=\355\370D\344+\t\337\3259\231\356^ \001\034\353\316V\261U\007\030\037E\302\226k\222\ruE`\353\020\316\230\323\031\266\2572\326\006\252\031\331\352\265\336\260\341\311e\214\263G\216\254]\001\210-\253^\362\330\244\364er\361\332\245\226\023\0067\266\346\354j\203gUM\255\360pv\255\241\247KqT\350\234]ip\253\365\013J\032\346\354\272\305jgla\376\004\311\210U\2178,\254U\213nm\305\243\"w\364\344U\213K\227I\241]9\273\026q\256\263\271\263,\256\273\371r\246\231\307j:\236xU\021\"d\275\332\322bWS%\213\031\330\020^\257\334\312\007\305\223;>\t\202\200\250R\3618\n\003\221!C$#2\222$I\007\342\n\020\206by\240\347\314\003\022\340D5Q2\310fd$I\222\302\260o"
+	.string	"\264\354\241/\370FS$\221\236\024\331ae\367u\013\254zd\202\001Fy~\355\227^\240\237\333\254[2z\350\215\362\032\202\245\326\020V\357\\p\3767Y6\213\343\t+xoG\001F\254HP\344=\324\032P\351\352\315V\032\335n\317@\260\336\260?\305e\336Nn4\211\373\267\225H\262\243\267]\322U\352\276\220X\234\237\025\352<\201i\\\020\346\t\t\270\250I,)\246>\245\324\241\325nIH\276\003p\367\026a7\341YW\377\353\364"
+	.ascii	"9\312p\262\264ud\226\003#\027\355\213\tI\356\2443\007\344\302"
+	.ascii	"s\251S\211S\242rYZ\372\372\375v\304\353yG\242\211j\275\332\322"
+	.ascii	"68;PF\324\336\223\016&.\223,CD,\234\224\327\305U\3514`#\233\254"
+	.ascii	"6r\374\327\216"
+	.string	"\036\355\261[\352weZ\360\332E\310\377L\362\fF\200P\240\034\001\371e;\203\355\255(\363\320[-T\023\357=\036ZSZ\234M\036\315\003\210n\305a\177M\217+\244t\216\232kf\276\252z\004\323uH\302\206;U\327\224\341\207J\007\013%\311\252\225B\3055\223\247{`\305j7\266qCu\201\200d\312H\240\022\316\022_\213\347\247\276\037\233\"j\030 \275z\247_\3654\247\212\272\3000X\337(\331F\304\013\322t3\215\272O\207\266\006T(\227\314\251Tp\031f\336\215\240O\223E\351+d3\312\242\033\206\272\354@\310\034Q!SG\343\206F\353\224\264\364\2707M\004\362\231WZ\"\"\217\337\337\344\355:\203\034@\205\220\f;n^\367|+\006\016\fwe\267\201\005\240puG\361\005J\001P$\005\234\023\242\227~\236\232Qi\271\2248\316Q\341\221\212\033;\353\373_)\244\320\021N"
+	.string	"\252\034\341\265_\373\272J-\005\263W5$u\006A\007Z\362\346&x/\217\337\021\\\n\334)^\315=\266\f\220R\025\330\325\340\3477\2351\327\223W\342\251\342\326\023\251?\313\023t\272K'\224\303\205'\246(\203\367\235\314g7\332\347\033\255\027uC\322\316\212\036f\367\034\324\222@\205|u\331\2508)\236\223\250:\036z(\022$C(<\322aL\323\323\311\230\316\024xQ\202\251.?B\020o5\205\231\200\002A!\037\341\030{\262\240m8\315\224c\331p3JN IX\0210s\300\351m\026\t\377Q\026\311\253\036R\334\252\270?\242\211\n1=\202\220\245n\227=\266\217\347Y\327&\021@O\026\3652\212\335\005l\303f\311N\231\"'Sd\303"
+	.ascii	"(\033\221\352\222\227s\fsBo_\331\200\206\330\260o1\311\272\262"
+	.ascii	"\360\300E\250\310*\334\253\373\250v\t\200\021\225\271\3070\204"
+	.ascii	"]9\001\214^\226C/,/s\345}L9\215\377#\302H\327a\343*\275\200\337"
+	.ascii	"0?\025\036.\346\210\203\344\230\211\204\3631\036\3603\347\241"
+	.ascii	"=\376\362C\365\226-X\013\036~G\372\226\273,\031d\311KH\347\264"
+	.ascii	"\365\362LA]\253\254\220\260\007K\244\031\300+L\313\f-`\306*\r"
+	.ascii	"\262 s\205Pay\247A\360s\302\326\272u\026V\373\242C\235\267\271"
+	.ascii	"KhKt'9A\027\220\025\274z\013T\340\215\006$]\272\205\t3\254\235"
+	.ascii	"~\2153\f\303\221E\3761\264\b4\212\322\3538\323\323_\253\337\001"
+	.ascii	"\0348\260\246\341\346\004\240\274?\324\361\343[\026\222\252\356"
+	.ascii	"\t*\2510|AT\300d\312\3230\340\f\021\177 &Q\3249\036WB$\316f\263"
+	.ascii	"\214!\342\330R\344L\325$VPg\b\031+\306A\273s\001\207`\"4\233"
+	.ascii	"\225/U\211L\206;\333\332u.\023-\343\245\375\303\341\336\227$"
+	.ascii	"\343ls\035\375\232\365\031\317M\322mK\017\037\270\230]\352\232"
+	.ascii	"\254|\304`#b\007\272\247{\363\277;\244\2017\265ItV\247\243n\246"
+	.ascii	"\264[B\237#\323"
+	.string	"9\210\263\001\017\310\367B9{.\323\357\007\363\025\361S\357\021\310\346\323\214\003\364W\377s\332\305Dm\253\236\037\254\237\201'\030\036'\372\021\375w\34591\007-\026\370\375\332\227\007\f.\344\b\263]\3774\254\352\202\355\b3\023\260\025\377!c\fj\207\311\310\310\327\370\205\367!\364\357\332\335\324\356\201_"
+	.string	"\267i-\027|\202/w\257\237\217'\235"
+	.ascii	"\313M\335\312\364R\353Q\275\240x\214\007\n\263\366u\314\255"
+	.text
+	.section	.gnu.lto_.symtab.5870382f35f8721,"e",@progbits
+	.string	"mspBatchProcessCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"mspStreamCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"mspStreamProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"sbufInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"mspSerialPushPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5870382f35f8721,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,825 @@
+	.file	"msp_box.c"
+	.section	.gnu.lto_.profile.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\007"
+	.text
+	.section	.gnu.lto_.icf.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375 \245-\004"
+	.string	"\244\006\231"
+	.string	"\013"
+	.string	"\317\225\334\332\017"
+	.string	"\001\240\342\234\212\n\002\275\351\217\277\r\002\002"
+	.string	"\002"
+	.string	"\003\244\362\223\222\016\004\233\217\325\320\n\005\232\303\344\257\001\002\002\001\002"
+	.string	"\006\356\225\345\247\002"
+	.string	"\007\332\273\273\214\001\b\240\257\276\211\007\022\002\002\002\003\004\002\002"
+	.string	"\002\005\013\214\227\337\207\007\n\002\006\002\006\002\007\002\007\002\002\006\016\316\270\307\242\006"
+	.string	""
+	.string	"\n"
+	.ascii	"1E\343B\312\355Hi\324\271\330\316M\242d\307\305*\315\3736\200"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\325\003"
+	.string	"\342\304\f\022\260%\351\f\3030\f\244l\333\331\2607\261\215l\231R\222\350\362`\212\001\335\035U\306\365\265\021\200\364U \n\3571\365\314\233=,7\by\233,9!  \300\002\241\271;5\201e7\2655\034Zw[0Q2\f\226\204/@\"\273\300\002\004$ x\234\351|\307\312\004\262\330f\036\300\216"
+	.ascii	"\001\001\024\270|1\317\264@\300\321t0\307X\200\217\001\004\\"
+	.ascii	"\204!"
+	.text
+	.section	.gnu.lto_.inline.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375`!\003\035\r"
+	.string	"\206\021>7@\217\322\030\316\310\t\252\224b\217\203B\222\330P\251\2308}\204\2007\247\020\264\267\037\035\240\206\317\006\177\321*\340\370\252\252\350x\034Q"
+	.string	"c;H\354&\261{K\231\002,"
+	.string	"0"
+	.string	"-"
+	.string	"\272*@\323\2343\033\363Y\224S\211\265\371l\312\251\304\312\336\273oM\374\365\354\234s^\3770\347\024\375\276&@\2239'\366\231\343@ )\214\025MI\251\321\b\300\334}\372\352\211 hjyQ\035d\241m]L\214\024\214\335}:\341\231\353\356\353>"
+	.ascii	"\370\361\345h\234\203\313U\r,'\026qNt}g1\345Pm\031~,\364\353"
+	.ascii	"\206j\353\360\227\266\rc\"P+O`M\207\252\255\352\232\270\013P"
+	.ascii	"E\362J\324\003\301\277~\367m\";R9}l.\244\f\b\2027\322\340#gI"
+	.ascii	"(:<\342r\343\226\033\002D\255\274\326.\267\345\346\331\n\321"
+	.ascii	"H\"[r\313\316\206\004C\250\241!4ES\232\002;\313\032@B\204X\331"
+	.ascii	"\036\022\300D\035\003\302\250\300@\301\b\346\004\025Mf\262\225"
+	.ascii	"\333\001\351\005\277\243\366\035a\006.\245\355bX\3043\0174L\033"
+	.ascii	"\311\342j\027\361CD@\221n\242\t\r^Ns\344\370\2177\260\260\002"
+	.ascii	"\326Q\237\347\350k\345\342gM\301\261\242QW\232\027\241\233\223"
+	.ascii	"\356\324D@\206\325l\362\325o\272\371\202\003\274g@h\213@\322"
+	.ascii	"\2055BP\301\264\347\243R\354)\3111\206\256xP\273'g\324T]\273"
+	.ascii	"\200q\260;\234\271\321\341\025\260\357\0305\027\322z\320=[\252"
+	.ascii	"\242\016\017"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375`.\006\215\r"
+	.string	"\306\2204-pGI\007\374\037\033\002\002\312\356\325\200\252\252\302\227\320\372\257\017W\377s\035\037\n\036\227\t|\360\037\370\217\332?\266V\362w#M\246\035%"
+	.string	"$"
+	.string	"-"
+	.string	"X\254Z\352\013Ql\352\365|\261z\357\275\021/v\255\311\327d\307MY\007g\235\021\240\017\233z\037#4\004\004\037\274\301\035\013\030b\253\024q\323\313V\342V\366L\021]\352Uu\201\3771\340\357\3171\2301!\213x\225\005\256\321\220H*\025Ib\354p\240\250\346\232{ \333\252B \022\t\205\342\361\200@\"\021\n\345m\345\234\327N\220\255\305\302Fx\316=s\370\302\331C\333\247:\241B^n\"\316y2)\203\341\234k\355\316\355\267\214EQk\317\223\tA\323\264XX\226\303\341\002\200\206\250!\3112\222\224\244PX\346\020#\021\242M\007\022@\221+\204\261\024QD@\b\021\206DfB]\373\006\034\334\356A\323\241\033p\3374o\"y~\250i\326B\272\215-g\376m\353^\231\223Z\205r\320\236.\277\"&\353\016K\257e/\244\324\221\f\024\240E\220"
+	.string	"\220\337(X\330y2\237js\302\347\202\240\007\311\210@y\316\364\223\251w\330\n\003\\\004\030"
+	.ascii	"@1:&Z\270\003\f}=\344\365\255\320\224p\215\316\203\312[\254\016"
+	.ascii	"\374\341\355\263K\313\366\321\202\377\265%\324ZZ\2133\220\025"
+	.ascii	"C\352\3042>\225\0320l\370\320\345\240\r\352S\036 \226&\226\323"
+	.ascii	";\320\267\213\251\206n\344g\nPd\306\216\2153(K~\325\250\0242"
+	.ascii	"\006\022\002\370\220\241\004\321_\276\325R\316"
+	.text
+	.section	.gnu.lto_.pureconst.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\230\004\002\200\004\004\200\004\005\231\004\006\231\004\007"
+	.ascii	"\270\004\b\271\004\013\230\004\016\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375 \264e\003"
+	.string	"\202\305\021\034\2207\351\260\366\303w?\364\356\240\333\336\341\027\024\230\217\232\005V\237\336\215H#R\246\003\004\204\006=\270\302\311\374\021\346\356\276\317\245\252S\351\\=\326CB|\f3\336)1\311\255\\\225\377\272\2508\300~\234~C\017"
+	.ascii	" 1\234\255\235\341\250\314\203\305i\240\3223\350\347=\240\214"
+	.ascii	"qa\345.\273\354\0132\001\005\017\240\b"
+	.text
+	.section	.gnu.lto_.lto.4557da70f7b3a695,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boxes.33.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375`\274\n\2751"
+	.string	":[ \02470lM\007\0030u[}z8\270\006al\360\021\025\001\230 \243-\274\223B\201l!\221\305n\302\330\377K[\214\004"
+	.string	"\335\257@\225\262\357\344\357\243\357\277l;%\0312\001,\0018\001~74\327\377\201\375&\300\323\237d\277\022\263Gb\302\035\025\315\3257a\277f\210\364\023\331_D\301\257/\034\357\021\366\253`\220~ \373\203\234\377\343\350xIE\330\357\202:\355\261\266\313b"
+	.string	"\353\350\222\220\204\260\3373\217vV\333[5XutI\311:\354\227A)\355\247\266\243r`\352\350\223\220'\314\325\347\260\337\n\r>i\017\265]\324\003Pn>)\251\302\\\335\r\366k\301A&\355\233\266sZ\240\351\315)!W\230\253\223\301~/<\240\244\335\322\366\274\255J,\234R\322\205\271:\026\354\027\003\204G\332#m\307\203"
+	.string	"\351\205c\202a\256\276\004\373=\213\260H{\243\355w\021\030\371pLI\036\330o\006lH\373\241\355\210\260]\f\317\204\234a\2561\260_\r\022"
+	.string	"i\027\264}\220\204@4<S\022\316\\\211\330\357\206\t{\264\367\331^7\201\317\r\327\204\314a\256!\260_47\323\022\323\362\353w\264\317m\317\303\243\007\231\\\021 #\374Rp<>\272\260t\232\262\006\226\234\334\352G\374\306\231\353c\277\034\334L\313\257}5k\271d\004~M7\333\244\237\324\376Rw\324\233\210d+\354\227+O\377\247\375\240\274<\005G\224\302~\273\222\3725\355\337\004 S\320\353\220\235\260_\257\267\323oi\177\336W\245\243\373A\226y\330/\200\257\323\217\267_R\200\217\024\303\377\224_oG\277\243\375I\260\277s\363?% \3547\300\031\375\212\366/\022\220(\350\205\220t\330/\230\030\375\206\366\333\r(\024\364B\3119\330\257\200\357\242?\320~A\004"
+	.ascii	"\005\335\020\262\\\203\375\016\300\242\277\317\376\272\002|\336"
+	.ascii	"\334P2\f\366K\200\212\376<\373\351\264\346\336\334\016y\005\373"
+	.ascii	"-\360O\364\327\331o'\354\351\274\271]\262t\202\375\206\275\022"
+	.ascii	"\375p\366\307\021{\343\303\017!aa\277b_D\377\232\375l\306\324"
+	.ascii	"\240~\310g\256\037\n\373\035\343\244\337\314\3763\006\312\244"
+	.ascii	"\316\350\016\3735\360A\364\207\331/\206\fLvFI2Y\372\271\354\357"
+	.ascii	"R\266%{#dY+\375W\366c9`%{\2435s}.\330\357\001T\372\247\354\247"
+	.ascii	"\202@J\352w%\314\365\215`\277\bD\351w\262\377I\202o\022\fg5b"
+	.ascii	"\260\240q\346\002G\2163\fe\026\316\306\013\034g:\340\340p\234"
+	.ascii	"y\331\fL\325\206*\361T\263\2218d3\246Bu\030f\235\316\365\270"
+	.ascii	"\037\377\343\204\274\220'rE\356\310\223.\311'\371%\307\344\235"
+	.ascii	"\334\223\217rR\236\312U\271+\177\345\263^\356\205\374\2207\362"
+	.ascii	"G~\3113y(\037\345\221_\345\263\274\226\367\362_~\314\223y4\237"
+	.ascii	"\346\333\274\233\227\363s\376\316\343y=\277\347\375\374\237\037"
+	.ascii	"\364\204\376\320#zF\337\350\037=\244\237\364\224\376\322czN\337"
+	.ascii	"\351C\275\2507\325\341W=\253\207\365\261\312\037%\220r-\211\224"
+	.ascii	"GJ$%\223\262I\031\205C\211D\213\233s\223\245\024]R\331\245\224"
+	.ascii	")qu8$\371`\277\326\315\234\350\022\312.\235<9v\350\335\301~\375"
+	.ascii	"\223\350r\311.\223(\211\233\353\220\374\262\224\323\245\221\375"
+	.ascii	"\247\212\274\360\220\354\201\301~{\245t)d\227C\3122H\\\235\017"
+	.ascii	"\310;\346\332\333\202\305\350\364\317\332\245\\O\326\333\207"
+	.ascii	"\236\024\354W\313\363\364\273\332\377\212\253U\334\034\bd\022"
+	.ascii	"\354w\353O\351O\265_U\327\243\212\233\003Ag\256\275 86\250\242"
+	.ascii	"=\253e\205\303\024\251:d3\255\2331mC\325\26535\n\321/\273\206"
+	.ascii	"\006{6gU\215\313\222\370\241?4\263\2316\r5\026\203\250\317\264"
+	.ascii	"G\225\315X,\252y\313\236\030\002\177\031\270e\323R \352\323\262"
+	.ascii	"'\212\347\2578\004\263n\2521\00730\033\273\254\206\rh\30365\027"
+	.ascii	"\267,\227\315jh\021\230\242j\\j\212r\331\037\332\311\3463\246"
+	.ascii	"'\212\347\031\2124xf\340\232\020=\333\210j\001\354\204\034\031"
+	.ascii	"\320DH8s\021U\363\211b\230V\302\207\002\323\306\254\206\rh'\252"
+	.ascii	"\346 "
+	.string	"\352\033`\331\212\250\352SCO5\267\rOb\nT\033\263A\025\315*q\313\032\205\307\241\357\314\306\024\b\314F\264x\022sN+\263\3717\f\236\306\224\370e5l@\343\240\346\342Q\313\016\323\337\021=\177)\261\313\346\024n@TE\211\\6\037}\305\254\236E\342\232\227U\2630EU\3439T}\350\027\nc\333\231\201ih1\375\205Y\340P5\n\207\276\223\315'<\242@0k\024\346\2370\023\363O\230\222\331\374K\201k\004\254\013\f;\340Z\254\260\221\203F\200\317\25014B\fG\226Q\220\240 )H\222\306P\203H\323\346\020 \344\334\234j3j\266Rr\354S\321i\033\b\240\272\305T\033[J_\336\315B\177\203\226\227\332\322\324JVg\0356\250\351[\332\276}lK\003*P\243\233\312\361Q \357\f%\352\273H\026\224,\020\214\025\265\002X\224\3377\366yZ\201\214p\232\006\347O"
+	.string	"\025\201\215\251\233\020\332\240\323>-`\237\355\253\263@\302\245^\242$\250\224&\223\037\035j\334"
+	.string	",\312\023l\210\312\0204\025 \337\256\254\310\234-\t3\036\226Jf\347!\2341\034\206\212P\370\367\343Ye\216\024\2154\370"
+	.string	"\246\320}\367X=\213P\030\374dK\036\320\266\324d\231#\243\365:\t!~\226\210S\245(\316\367@\225\321\"\356"
+	.ascii	"\2551\322z\334\204#\233\3566\362N\360vM\034\321|3\210{f\353\235"
+	.ascii	"\321`\353\363\342\206\214b\361\367\235\340e\377'p\335\376\031"
+	.ascii	"\254\366\257'\007.\333G\334\222\327\342\337\277\352\223\271\321"
+	.ascii	"\237\357\004\211\377;\240\341\307\337x\342\021\360T\231\n\025"
+	.ascii	"n\302"
+	.text
+	.section	.gnu.lto_findBoxByBoxId.35.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375`0\002U\023"
+	.string	"\006\245\201H\3200'\035\033H(F\016n\324g\321\001\276\365\337B]Y\215\f\236\003\270\303\t\332\tI\225:\024\252#\023Y\265\375j\275\020\236\2409\352\211\215\001\2762\353\303m\264.i\276\236\n\330\016\374Um\224\020B\366\226;\245m"
+	.string	"e"
+	.string	"o"
+	.ascii	"\037\021c\327\200\261\347\306\2635\325\024I\325:\262<^@w\372"
+	.ascii	"=@w\272\036\f\3629\336\235t\335\353\350\\\351\362_\367\346\203"
+	.ascii	"\246\230<\304\2329\0017\363\363\033Lv!pN+\350 \311D\016\2373"
+	.ascii	"\002\211\232\217\20783\227(\307\342\271\313\231\030\223\373\333"
+	.ascii	"\245\022\024L\206\221\210s\351\211\324Z-e\342\315\375\335\266"
+	.ascii	"h\033\202--\004\337\307\337;\356\246\226\236\267\335;\245\345"
+	.ascii	"J\037\200\204Q\n\207\001\250Z7T\355\2501\350\022\210\343~\333"
+	.ascii	"\245}\373E~\316+\037\347z\245\261\001g6\030\f\276\023\3717\257"
+	.ascii	"l\037\337\313\3463zzq\243\326\021\344\324!\337\351\355\030{e"
+	.ascii	"[J\373C/\021\363Q\203\301Zw\216\222j\035\027\370\343;=0/\024"
+	.ascii	"5!\252\245\013\356\314\005\210V\354\314\245\331[\271-\333\214"
+	.ascii	"\230\234\362W\356k\250\214\341J*\324)\252Vk\314"
+	.string	"AR\270zAI\2518\222\253;\375R\247\250\240\241\247p!\270\3146\314Q\204\nzj\215=8q\243\f\363\037N\335\362\322]v\352\277t\247t\237\373l\312\251\222\341\310\310\252\215\002\372Y\332\245\331\343K&\270\361Y\362\362\330`(.$')'+$&`\312O(\300\204%\324&!0a\311\005\226\026\025\326J\n\211\n\313\244\325\302\n!\340\220\005\245\305r\t\303\026k\345\372\345\361M|\344\251F\016\251\373\321\237;X\023\242\232\340\316\271\026\221Y\230\26747pA\277\245\"\244g\317a\243\021\223S\237\265\326\332-\355\037\335\356\267\277}\244C\216\016\032\035\230\254\222\333\302\006\023\020]\232\037( 0\002\203\234\274m\\\341\035\342>\277\221\256m%\242o\325\230Bb\301\307\317\032\267,c8\214\271\250MZ\241a\371\303\334\0021\202\240/>\"\266Z\253\021\260F!\242\273\223\354\002{{"
+	.ascii	"\224\351N\315\213\255\276\201\231\020p\234lK&\353\251\2731\021"
+	.ascii	"\230\227\225\006GDY\203s\2576<\001"
+	.text
+	.section	.gnu.lto_findBoxByPermanentId.36.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375`%\002M\023"
+	.string	"\246d\201I\340\320(\035\2140]\n\272p\206}'W\0212gp\355.3(}\016\177\202\240\222\353}\316\230a\225\314\003\374Y\377\331H\221\027\373+\\[\326\200\020\306\227\244\322\275"
+	.string	"\006U\323\203$zE:\220\r4B\310\336r\247\024m"
+	.string	"d"
+	.string	"p"
+	.ascii	"$^\206\t\030qhB\035\016\031 _\255#\312\343\003\200\247\342\001"
+	.ascii	"\200\247\353\301!\237\343\rJ\330C\220\316\2250?\366p\236'\311"
+	.ascii	"\350\303&3#\360`t\276\223I0D\315\251\004\033\0314\333\206\317"
+	.ascii	"\t\241D.\347\303\0063\367\247\327\342\275\313\232m&\367\273K"
+	.ascii	"\"%\031\215 [\315eXRk\265\244\331hn\361\266m\266Ily\022\007\317"
+	.ascii	"\273\247\245\367\272[N\351\233H\216|:\n\374j\325\360S\252G\264"
+	.ascii	"\b\304y\277\356\322\276} \277\347\223\317\203\275\306\314\230"
+	.ascii	"j\272\036#\342G\177\347\323\251M\374\347u\035\210\030\233\021"
+	.ascii	"\203f\370r\324:\206\234\272\201xj`\336~\331'\333+m\006\016^\357"
+	.ascii	"\311\340\255\365\006c\250\326Q\201A\304\323\217x.n\030\355\320"
+	.ascii	"\305\3719\237\333\316\025\267f\002?,:\314\305\031\334\257KWc"
+	.ascii	"&\223lW8\321\212\"-\345j\235\215\f\265N1%\337\212\013\301\226"
+	.ascii	"\"-\361\364<\005\354\300i\2661\034E+\001N\255\263\007'\036da"
+	.ascii	"\376\303\251Y\\\300\323N}\227}\3573\206\215\020\255\346E\376"
+	.ascii	"\226\307\216N\321.\316\036c\022\001MN\221\367\306\026\303\367"
+	.ascii	"<\252\226T\212J\n+\205bRy\312I\013K\305J\255\\\252\225\223QD"
+	.ascii	".\264(LXaY\241X*\251\025\n\305\305\202\022\031\340\326\212\312"
+	.ascii	"\205ji\265\\\250\223\353\367\306\367\271\311\214\245\236\020"
+	.ascii	"x\025\177\357\246\234\317m\212\273[[\227\274\254,\\\234\027\274"
+	.ascii	"\240\341R\021\322\265\357\320\331\230\311\244\317Zk\005\177\020"
+	.ascii	"Pn\270\337\335\204\203M/\346&\223?\271\001( 0\002\203\244\273"
+	.ascii	"m\\\341\035\3426\353\034\370\332Bc\353\255\216\007\324,\210\360"
+	.ascii	"C\224\337c\270\215\215\272\215\264\306`\002\236p\301\240\210"
+	.ascii	"P\224\342#\"\253,\354nb\037\244%\344\366;\331n\333\026\372*\336"
+	.ascii	"\221\260\031h\to\320\004\233\310#\273\3604o\254\005\346j%\254"
+	.ascii	"#\246\254\341\334\253}O"
+	.text
+	.section	.gnu.lto_serializeBoxNameFn.38.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"\215\t"
+	.string	"F\222A90\221\322\001\200B\307\262\364\034\264B\227,\266\215q\027\306b\361\250o\220[\372O\220c\376x\312N\273\234\374\2334\250\"P9d\352\246/\n\"\363o%\237\020\"wJ\001."
+	.string	"0"
+	.string	"0"
+	.string	"\004\334\267\356\002\3347\203\266\314'\310\036\306\332\200\315\354\256\324\217\203\217\240\177\224sV\255\360q\323\260\273\216\253\026\307\255\267m`[\332\037\b\257_\373\374U\243\277\351\220\300 \254\354\262f5+\333b\"\266\357\261\035'*&\341\321\276\311O\300\2770\036\260\353bq\331\235\n>\350\276y>\234x\325\324\366*\342W\366t\2504\264\375]\305\242\333\325X\360SN\027]\b\212\373v\335\304Zh^\2518\263g\030\325\303\276\266\273ku\331\017'\017\244\246/B\035\372\234<\320\003\351\033I\n\021\304H\206J\237\374\024\330#I\224\244\311\363J\3223\367\332\252\313\016%\262\224f\030 2\334/\234h\2423\"Si\350\020"
+	.ascii	"\357b\310\304\223p\264\270\250 \032qB'?\204:\204 \256\261\255"
+	.ascii	"0\036\250\006\256\200\271\001*\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_serializeBoxPermanentIdFn.39.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"M\t"
+	.string	"\326\021@90\345(\035\336c\033\220\217`\006\030\362zla-\017\325\206\261\215!\214y\271\311\3771\0067f4\236\2149\365Q\n\262\200 \307]\267I\032(\205\214\254\262\331M\244L)-"
+	.string	"0"
+	.string	"0"
+	.string	"\230?\355\004\230?wv\313#\310\336\325\201r\275\354.\324\217w\317\316\177\311\005R*\3233\323\260\273\316\224ju\353m#\330\206\3665\001\177\226\245S\323\317h^,\n.\273\0341\001\013{*\"\266\277\261\235\261\024`\341i\177\344$\335[\030\037\330e\255\274v#\307\t\332\237\343\013\002)\037l\250\311\327T\016j\200+~\302i\273\032\f\276\311\205\205\026R\302\374]3+\024"
+	.string	"\255S\306\354hJ\365\260\237\355\356ZY\366[\377{\f\244\315\243#.B\375\351\2206\317C\210\003A\212\t\b\020\374\2108\3301\360\026\222\020\301\321\266\211\340&\356\263U\226\035R`'\315\260&S\237\332\240-\037\017"
+	.ascii	"\357b\310\304#p4\341\202`z\240i&\344\301\006s\215m\205\361@5"
+	.ascii	"p\005\314\rPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serializeBoxReply.40.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375`\353\005\r&"
+	.string	"ZE$\017J\200\232U:;\364i\033q\372nj\305\324\226\231+oNa\274{-\275U\242\026o{\002e\202\200\314f\006\333\004Y{\273\356e\273{\257\350\233\337n\371\327\260\016j\344B\220\214\262\344\373j\205\315??\"\204\020\262w\222\001\334"
+	.string	"\322"
+	.string	"\340"
+	.string	"O`<'\\\345\235\004\377\324\315\226\345|\224U\225s\216\320\020\330\2476\364\267\373Mo\022\274\223\214\343\344\214\304\254\312Y\031\241o\354\323V~\200\372\224}\216\3724\330M\346\312\244|(JD(c9g\034\026\362\340\250\362\275v\213\203\247\2653\031\273\252i\r\3057\330\237\372\002%*\242#\320i=\232\302\333\006A\362\370l\315p\204\334q\231\202#\244\216\263\350\227\260\271\372\227\261\b\305"
+	.ascii	"%D\344Y\277\305\243\320]\223\344\270\212Zh\3024\004\300q\b\305"
+	.ascii	"OQ\316o]\301\222\261\350\246l\216\327P\tXl4\371\227Q\007\212"
+	.ascii	"\003$l\371%\243\217\213\242\266/\343\016"
+	.string	"\324\226sn\217\303\213\337|\232\\b\346\b\311\343w\315\220s\356KtD\276\001\274\373hw\363\272\323\027\001\007vf\267\r\310n\027\270\326\233\300\261\336\003tr\356\364\343\374\311/\200\275\035\340P\357\332\231o\332\237\376\366W\336\253z\251w\312\336F\331\333\230\275}\357\355#h\221^\016\304r\246\361l\223\265\244VG\216\365k\375W~\250\237\371K]\355~?\313\271\272\333n\361\253Np\343\213QS\213\356\326\312\265\372[\335Z\005\253\216\325\317:Up\312\235\335>\277\352\313U$\245\337\354\366\n0D\021f\323\230\256\252o\325m\373\274\212\213\347!\243\254\270\354*C\342S\372T\335\372\234\312\3156T\346\243\b\037e\232\306F\370t\267O\357\243\036\345S\335J\031\371\300\274\331\206\002\3620y\004\t\207n\250\033\013dd\243\2400\225\311Y\371\340ic\350\306\001*N\266\001\274\342\337\022L\001l"
+	.string	"\237\370\246I\\L\211\324\013\rS\316C\na&Z \26110\017s\247\013\365i\001\234z\241Y\342\024\344<\230\013\006'\nq/& $\345<\254\300\345]N\240Wz\3329\235z\"\235\372\224"
+	.ascii	"\376\326\031x\211-\301\244p\004\335'F\203\204H\225\024'\373o"
+	.ascii	"\200\034bU\303H_G\361\2170\276\030\305\350\030bQ\r\253\030\343"
+	.ascii	"\324\r\221\211\206U|1O\221.\242\223\360>ol\343\225\204\336\247"
+	.ascii	"\006\300o\376\366\270\021\266\f3\274l\272vW\334\347J\321\273"
+	.ascii	"'\n\200\317\365\fC\ft\177\254y\252\302m\373M\245\341\032~\260"
+	.ascii	"\0342:\246\341\247!\276\t\272\317\266\275\233j\213\217g\020y"
+	.ascii	"\016-\t\357\263[)\2748\331}\225K\250Kc\244\356\364v\273\336\345"
+	.ascii	"\365\344v\275\035\213\234N\326\373\317\256\303\217\017\205\332"
+	.ascii	"\363\313\365\200\220\355XlX\177|\032x1z"
+	.string	"*r\275\037\017H\343\245\310\361\240=\300\035n\235\204\037\037\212\023<\300\0258\026\275\334\n\234\356\007\304I\330i\037\017\357\207\353\361\371~\270V\031t\214\324S5\264\004a!\r'\273\026f\246\203\215n\027\033\235\245\370Sg\307\232d\356\305\256^\270\001\366$'SI\213\223JN2\262\034\334(Vq\212\213@u\305:\370X\212P\335\331\230\2538\207\301R\227\020\f\312H\210\f'9l\t\213\242Z\377\345\337\272\207e\027\221*%\200\017\340b\267\316=\200qp\013\300\375\346eIN\345\2322B\030\210\305\311\236\240\245\356\340\224I\255\213?\203\346\234\363\212\223\277\251\003\360\016~\3269\354\360\241f\310H\2105\346\352Hs\250q4\205\fR\314\b\005B#B\n\323\214\001`\002\221rfu\020P\310\206\222t\023\3172\244\337.7\272\037\246\212\331\201\322J\036\302\200\202tH\t\346\354\210\004\025Z"
+	.string	"\362\256%q\261\276\307\217\362\304\227\345f\366\371t\254\324\204\210v\255\020\032\325@z(\264\331\337,;\\\213\t&\006\223H.\030\346\372M\f\217\241>=\276\274\016\203\220vb\350\356 \2164c%C\0029\001\246\320\033\3702 \300\366OI\310\377U\262\274\264L\255(\007B\245\317+\030\263o>\223\205&j\334\315\204\363r\004\205\257\3760\320\215>h\336\2514\2169\202\007J$z\350\225\005a\254>\215\027\243\326\f"
+	.string	"\250\257\342c:v\341#\224#\fx\255\221+tD\3376MVu"
+	.string	"/"
+	.ascii	"\250gcE\312\373\034\217\323`y\343\237d\300\344\371\275\205\361"
+	.ascii	"\006\241\351a*"
+	.text
+	.section	.gnu.lto_initActiveBoxIds.41.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375`\001\023mM"
+	.string	"J~\030\034A@dN:\027\216"
+	.string	"z\205\321\354?c\203o\213\350\325\020B!\361\020\007\250\016\007-\200\b\017\332\307n\017\013QU\341L\007}a\240\276\037\364\344f\310\353\031Q\016\205\232\231\366f-!d\357$\003\271\001\212\001\277\001\315\242Y\2339\325\367mj\235m,\342\331\206\336\251=K<S{\326\355&th\333\3736sem\004\337\367\355\312X\262\264\264\250\232\253\327\257\320w\001\326}\027\227\202-\255\254\004X\013\020\034\2702P\200\200U\325"
+	.string	"\252))\006\002\242\002@=\001pjbZRJR&\221G#R\2218l\3315c\267\257\204\315\230\237(\232\330\273\326!\331\231\333\377\232\323\025\002a\225\216\024s]I\353\273\002\276o\255\016\004\241\251\031\221\020\352s\274=\254\245\307\227\007g\345=\001\336T\017c\345}\301\312\265\227\004\356\177M\276U\251J \271\343\375\301\bp\337\017\314\371\325\034:l`=\3765\345\254^Q4\270\300\334\t\314\235C\2268\206\250\244Eo\025\246\031\247q\325\312\344DN\237o\365\021\243\36698x\300\3727\302;\377k>\327\tn\310\264\\\232\006S]I\213\373\324\032\001\316L\226\3775\341\326\274\346\r\236\333=\261\324\205\304\235\301z%\005\016\363s\267\372kF\327\250i\231\300\207i\002b\001\217>+*\230f\220J\332\334\243\316<\300\2317\fe\346Of\274`"
+	.ascii	"nwr\353\202\233\270\234\211\313\026\274\244\345JZ\262\340\244"
+	.ascii	"\266+\333\330pr\355\310\265\343\232\265\266\227\344\177M(\253"
+	.ascii	"\223_\025A7\256^d\202P\376\327|\262\036\t\313\366D\301Hj/\252"
+	.ascii	"Y\205i:\301D+*iM>\374_\263\t\023\255\f\267K\316\016!\303k\222"
+	.ascii	"\3475\253j\247\310\210\266\\\235\316\334\314\376<>\2026\206\361"
+	.ascii	"\260\302\373\276\215\315\320\322\336\r\336\235\367t\267\204n"
+	.ascii	"\245\235\347\033\262P\030\337C\333\375!\004\276\031\233\217s"
+	.ascii	"z-\361"
+	.string	"\216\315\316@\317\177sF2\353P\227k\022n\232R2\341\250dl\"B}r\347h\237[\310\001Zb\302n\302\230D\333m\002\005\276\3313\222\211\206\272\224zK\302}\254\366\211\205\013$\263\f\225,\2135\022\023\337z\255\326\017\3753F\262\315\254{\006\r|\263n\302\253\016V\207d\261n\350\030\316\316\356+\005\2629\353l\245;\343V\221\242\210\033\305\020\367\211\367\275M\224 \342\036A\304-\002\354u\357\020C\334 >|\316\033C\306\355\340{o/\246\307y/\265\270\225Z\334IC\334\312!\356\344\0207\262\305}lq\033[\334H-\356b\213\2338\304=lq\267-n\266\305\235\237\347\215[\334_\261%e\r\212SN\366\003}\317\n\033\275T\226\216\227\357\375}\377\234\277\356\317\363\307\371\343>\354~\037\317\373\372\323;\323\273\357\365\371\354\270u\256\327<\236\327\354\362\221\231\367}\361\362\354"
+	.ascii	"!\255\203@\274\353\337\3411\255\326\351\333\341\021\245\332<"
+	.ascii	"\272\215q^\327\267k#\034\327\315\347\364\245m\334\2539]\367\217"
+	.ascii	"\313\351\342r\3178\327m\204\366\243\356\331\364]\204\250`\032"
+	.ascii	"-7}8?\376\306\307\337!\315\"Sn\260\312E\274\232~\2335\227\373"
+	.ascii	"q6XUK\350\213\006\306\006M#\370\276\320-\342\331\252\365G\267"
+	.ascii	"\361,\376\263\215Os8\367q@\210b\001\214\362\350\252\350\236A"
+	.ascii	"\217\2437R*\334\367\333\235\203\334`\231T*Dv\220\231}w\220?\367"
+	.ascii	"\2455nj\020\351\031\220\235\315 o\nCf\31708\237\203e&V\013\226"
+	.ascii	"\177H\016P.\323\263\327F\225\235\202\007\313\030\362\245\317"
+	.ascii	"\240\306\366f\310"
+	.string	"\332\030 \340 %S\331\331 2\340\351\332\335\202\377\276X?Gf\374\334.F\261F\202SLu\275\254\247\363\321\236\005\221Y?Goq\247\303|>\256n\026\204\016\336s\273l\345a=\327\313\n\306\025\323\212i\317\206\310\267\373\225_#9?\321%\370\221!/G\244\262\263\377\251\301BH\030d+\375\302\177\265\311\214\243\004\306\363\245\240\355}\227\020\272\3351\370\216[\206\352\317\331\306v\360\235\373\346\242q\341\\\270\366l2?z-+{ot\204\340\302~s\247\211F\300\200\273\2501\001\304P\241\322\300D-1QR\222\224\206$\327=y\003dg\343\346\221pi\220\231\335\303\346\rJ\271\350\351H<\346\243409\245\222\001@\3429\031Wc>J\361P\227MHvLHH\371(}R\227K\002\336\224\212U\270\333\302\005|\263b>J\313P\307\222\234\316\300(\211U\304|\224\262Q\227"
+	.string	"\236`=!\317\2300-\202\016V\311\214G\360P\223\354\224\362\210\2351\017\2361$T\222L\261L\027\"\307d\216K:\2634\215\331\331\304\177\265\303\334B\016\260\033\0036\362E|\337\345\203\306L\\DC\237\313\331\346\320\001\337\254C{v\230\263\024/N\b.\354$\334>\311@T7X%C\312\216\212-\261\315\3079F\304\"\242\325\020\236\006/4\364\bk\301\302\320\301\342\305\214\0276X\270(\3168\013\0330r\273\340\352\021\326B\305\215\0345\272l\314`Q\243\313\005\216\034]\\\001:\354\006\f\034]:\302\302pt\031\241B\236\2554\030\032UH\036k \353\373R\241\360\270\277\272\006\027\366\343\336\371\315b@\372\\\332e\213\201c\264g\377<\326\202\245\321\032\\\223\256\354\354\"T\360!\367z"
+	.string	"g\246\314\304n\377\251\034r\222\341\372w\264L\371CV&r4\346\307\r\026\005R\177\246\034\357\304@\266\272\026\360\212\333\226\3363\350\t\364F\2325=\007\271i\231\024\313DV\241\"\037\357J\200\236b\210\364"
+	.string	"j%H\221\3313\013\316\347^z\356\265\276\357\373fy\345\024\371|\317\240\026eQ\3163\350\316\227\004(2\323\211\214\"\277\354\021\341\027\353\227h\260\220\240\336\211\314\372%\322\303\212\334&80\221\211\374\351\257\374\n\345D_\264\330a!H\313BgA\266\242\224qpa\246\374\274?c\020]\247\213\005\337L)'\353,z\263\221_\033\202\354ll"
+	.ascii	"W\177\274o\210CX&\275\352\357hqf\366\017\\!\261\273Jz\340\223"
+	.ascii	"\362\237\177\221:O\003\331\331\303<\002%r\006\024\245\365\245"
+	.ascii	"\314\\\337w\355R~\334\361\346\354D\013l})\227X\t\243\205C\360"
+	.ascii	"\031\002\"\362\345\374\031\003\301\024\0224b\333\333|\3377\301"
+	.ascii	"\222 U\f;j\003\245\200V\331\331\371a\355\210\342\0259>eaa!\365"
+	.ascii	"a\255\210<\"\267kc\270\260\225YDn\\\366\250\333\315\202\371L"
+	.ascii	"\335%n\027\342\373\276J\214\306)h\r.\256)\201u\250qD\005\221"
+	.ascii	"B3\"\"\"\222$I:\321\005\204\020&a\331\006\021\320(\005!S$$)I"
+	.ascii	"\251\003O\343\"O\251[\016\026\217b\204`\034A^LJ\353\210\340+"
+	.ascii	"\254\213\345$\241\017\256\324\021\275|a\344\377\030\231-2r8\027"
+	.ascii	"!\202P\030\037\266\253\235i\b\005\211\023\b7\377q\266\2517~\""
+	.ascii	"\200\222\013h4\261\0136\271\026aM\204F\3442S`lm:\234\331d\363"
+	.ascii	"\317\214\212\233\341\244b\016\225I\311\004\022O\322\334\270\336"
+	.ascii	"$2]G\212\252\n\3674\313\byI\351Gl\262\313d3\036?\226\016\225"
+	.ascii	")\371\250\235\244\303v\261\346\255U\034{\223\265HW\275\b\247"
+	.string	"\343\344\277\365\335@\233\204\"bC\202Oj o\267\202\210\324kW\257=#\272r#m\252\377\205K\fKs*`\211\224$\300{\035\261\0302b\357\037\361|\210\332#\022\372\260\007\273\2609R\372\335B\333e@\217\262B\271\244B\2738\205\326\035D3g\372\257\227)%eG\b3T\313\313VK\325^?\001B\020Gd\nIb\323.J\275@\245\224\304\344\"\301}]\177\001\277o1\022%L\005\370\363C\030Aq\201\031\223\202\357\037il\211[C\337 2\327\355\265\026\371\002\250K\241p\0014\327I\364\237y\321|(!t\377\242\266Z\367\013I!|\302\025B"
+	.string	"\310\255\206\007\\\222\306\245{\267\020\332v\377\320\364\374\024\022.d*\275\232\371\177O!KU\337_\221\276\276DS`\262U\276\370UI\031s\365#\265\007*aS!\243\376\335\t\022Pl\252<W\206n\247\354\241\270\003\031~\334i\321\375{\277\362\326\312@\310\304s/F\216\317\264\307\301+0\313\354\370-I\3348\350\307h\363b\221H\3429R\355iH\214\300\rlo\241\020\221\2231\005\3148\026\373l\254%x\217JZ\025\"\2022DUm\030\322*\006F\211\253-t\362\342\341"
+	.ascii	"w\032\020l\016nF\\\204\215\300\333\352\340$>\026\260\177\023"
+	.ascii	"d8\305A\027p4\f>\350\313\032\277\332\f`R\334\032\213\317\375"
+	.ascii	"7\276\340?\337\220\177]m\001\032\255\\\303\373\315\\\203\030"
+	.ascii	"c?B\220\352s \3110\262i\016\335n\334\201?\244\235/\216\343\216"
+	.ascii	"-I\021w\2145\336\214\264\212\231j\374K?\321k\314\222\211\r\022"
+	.ascii	"\260\034oR\204\230R\260\354\023\275\306,i\212Y\0132\247TR\360"
+	.ascii	"'`\306Q\030\254#\034PGz\207zJ\263\250\001"
+	.text
+	.section	.gnu.lto_getBoxIdState.42.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375`;\002E\024"
+	.string	"\226\247\213G\260\224J:\371%\030\3764\240(\300`\353+@[s\261\316\361\033\243\266\bg*\332Y\316\310\001\205\032G\344\254\271\341\016\0210\323\355\030{wJ\337\274S8\223\234\272\036\214\366\272~\2349V\241\325\b!dK\231Rz"
+	.string	"k"
+	.string	"z"
+	.ascii	"\217q\031C\247\022\362lN'\030:\346\324-p\202\360\236\201\257"
+	.ascii	"|\367\344S\276{\266\315\240\301\220\211\256K\241t\025I7\032F"
+	.ascii	"\346\324\325\026\305\211\016~\236\\%\362\213\016V\320\032\277"
+	.ascii	"/i\201yrEI\nG\313!I\2260\254\"$9\017*;h\375\300\345H|%KS\217"
+	.ascii	"\020\264\234M\256"
+	.string	"t\235\030\362\3355)w\244\n\276\3149\255\270\334\322\035\3366\007\333\024l\325\t^6%s\220F@p\253\177\367\003.j\214\2010\322\321\326\025\351B\331\337q\034G\357\223-\325(V\237Xmb5\355T\177\211\325\341\247\006?\365\367\251=\251\226\237z=\265J\365S\002du]\0202\247\322xdryY+n\365\333C\376\316$\276\356UC\267\n\n'\213\031\356\353C\330\234\263\345\236]\302{\326\205\252vk\262\277\355\370v\027\\yuc\362V\301\277\225bHG\216t\264\\/\303w5\341\2346\007r\037xe\351\356\376Vf\204\343W6788\337=\335\231\210\034@Z\030\275\360\300\002QDv>lJ\246Xb]%$\312\236\354w\237\335\312~\002\337\027e\2557\246\243\333\370\215\034?\312\"\217\036w\317\347\371\356}A\036WcL\227\3025q\355BY\350+Y\001Q_\273$"
+	.ascii	"\302Oo\207;1054\"\314\217\006\233\233\r\022D\0134\023\200D\031"
+	.ascii	"\025\232\033 Q\306\363\214\013\220(\203a\307'\247\246s\023\223"
+	.ascii	"S\233\351\361\251\271\f\260\270S\323S\373\021\305\236\032\211"
+	.ascii	"n^\316}\362ML\225}\264U\250\251-\317Dl\212jO6\334$\333\341\372"
+	.ascii	"\305h\217\034$\347t\202\020f\245\243\234sN\360DK\326\216\231"
+	.ascii	"\321\343h\2532b\006\227m\213\fV\265\025\344k9\030% \220\002\021"
+	.ascii	"\272\353\006\217\030\256\037\017\244\f\240\201\034F\332\362["
+	.ascii	"q\024\206+(\372d\321\340\332\241\003\022\253Z\027_\310\001\233"
+	.ascii	"\217FK&\327\242\002%]\207b?\254\326Y\221\263\013\031\277\371"
+	.ascii	"c\346-\240\020\371W\032'1\037\313A\237\013M\f4)\\\001\215\260"
+	.ascii	"\366"
+	.text
+	.section	.gnu.lto_packFlightModeFlags.43.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375`\251\002e\025"
+	.string	"\026\347\212I\300\020)\035z\302\212M\233+>@\2334\262`\2656\247\312?c\006\257\313j\264\354\356\260bu\367\277\226\252Q\207\335\335QQ\345*\2248b\fA\020,\033\350\304\230\337X\353O\205 \376'\265x%\243\221F\310\226;\245w"
+	.string	"o"
+	.string	"v"
+	.string	"7\302\331N\364\347\201\367 \037\016\222\214Z\253\f\344\037\343E\372\216\361\342v09qw\221\255Q\244;q~\360TD\324\224\2167s\027=\021\326\323Y\350d\240\007\2046@\037~\356x\271I\376\354\360\274\265\301\303\360\361\302\305\033\233I\351"
+	.string	"\252\0241^<\034\372\221\003BW\362j\346~x1\310\250\252g\207\347\263ERk\365\324\361v\356\215\333\376\261\255\300\236\276NB^\037;F\2479`/q\272\374\357w]x\323=\360\236t\372\035\0014\254h`UkN\326\214*%6\205\270\360\007\372HO\262K\313\274\204\327IEy\022\376P\030\243\264d\224@\306./\336\306\371A\227>0\204\234\321!\207KET\265\376D.\332"
+	.string	"yq\332?\372\b\334\177\025\036\253\325\207\tE\255?\002\016!/\372G\276(\273sw1#]\330\276\006\324\324lm\357!\343\356k\035D\ro8\344f\326\b\233\273)+\363:{<eI\331\0248r\001\024\267g\342\337\367\230\345\353\361DC\352\275\234+%Ja\344\330\017?7\370\254\202-j&\226\313I\327O\2120\233\327q\354\223NR\2630\204\200\232v{\344\r5\212\334\265\366\004\333\274\316\363\251J\352fg\354_nn\317~\311\024*&7\032\212xS1\271\321\020\324l3\227\215\345\304\245dE\205\306"
+	.ascii	"\006\002K\213KI\3156\003\340\224\221\033\r\345A\3156\223Ih9\231"
+	.ascii	"\311R^l\262\021\001\246\325V^d04\332\213\254\374\321|}lJ\356"
+	.ascii	"\306\312\005\241\331\234c[.N\r\232\231\345\332\236aX-\330~\030"
+	.ascii	":1\2753m\315}\360\344\325\320\321\364Nd\201\357\305i\255\265"
+	.ascii	"\222\333\363\207w\021\021Y\030_k\272\0017 `\002\221Y\311\r\177"
+	.ascii	"\214\324h\362\353Rm~U:\215\245\036C\323\304\255~%\222\021w\366"
+	.ascii	"M\224\276\357\354 V\017\027\214F\271\tCe\205\206&\031\227\177"
+	.ascii	"w\346\202\013\3370C\221\252\333\001\256h_\273\344@\311\346T\245"
+	.ascii	"F\361.\004\303Q\207\221\371q\340\304\204\313t\301\206\f3\214"
+	.ascii	"tQ\357\342P-h8w\211\016|g=\f\227\326\370!\214\356^M\260\f\344"
+	.ascii	"\273\"\231\251\rO"
+	.text
+	.section	.gnu.lto_activeBoxIdGet.part.0.58.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"\225\n"
+	.string	"&UI?0\247*\035\220\313\302\020\r\005\212\341wos\310\311:wg\320\237^s\305\300\t\213\001\275 mu\027E\261\021\243\204\026\312\251\217\b\252\212\03087!\234k\241\033T\f/Z\333[\312\224\0028"
+	.string	"5"
+	.string	"5"
+	.string	"\033N\211e\333\033\216\311\247{\261UE\025\0022{\260\353i\217\n\340\247k\302\223\237]\013u\375w8 \346\240k\221<\025\016+\235\335\265\245\344\216\267=a;c_\013\002l\337\376W\2621\266\311\306<\332\326\274W\272\214\004\275m\261\254i\277\300\r\230.#\371\262{\262\200\301\256\227y\264\204\345\361\341\f\224G\370\005\312\243}\002\016\233z\347\317\216`\363\003<z\203\313w\217>\327\341\221\357R\377=]*E\245\302\254\360pw\327\372\262\235V\247\363\336\177J\304H\202\311\356*\002\204u\305\006\001\027\024\243\315\023\375\321\2146OE\210\003i\032\031\026 \355#\3424M\203\267\020\206H\343\3306\221\2069\\}\371\337!\024d\252\252\210\272\223\322\017\253*\314\366%\257?\360\004\234Cl\003\020"
+	.ascii	"\3571\036\026\356\320\206BY\340\fc\312\225\271\025\220\007F\004"
+	.ascii	"\22709O\316N\273k\216\240\316\360\220\232B\363\322k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375`2\003\r\017"
+	.string	"d\025.\004"
+	.string	""
+	.string	""
+	.string	"\002:\177\027\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\"\f\200\204\001"
+	.string	""
+	.string	"\003\002#\177\030\322\251\222'\272\200\202\002!\031$\177\032\002&\177\033\002'\177\034(\177\035\345\205\336\006\002)\177\036\217\304\365\021\0055\0376 \002*\177!\377\377\377\377\0037\"8#+\177$\260\325\317\013\001.\177%\037"
+	.string	""
+	.string	"\200\200\200\001-\177&,\177'4\177(0\177)2\177*1\177+3\177,/\177-9\177.\003"
+	.string	"\017$\003\005\021D\003\005\020d\003\006\007"
+	.string	"\320\302\371\241\002\001\202\001\004\007\325\n\003\b\027$\003\b\023Dd\003\b\025\204\001\003\b\023\346\356\364\005\001\304\001\344\244\006\003\b\024\304\006\204\007\304\344\007\204\n\304\n\344\203\327\330\013\001\204\016\244\304\344\204\017\244\017\344\017\003\b\026\204\022\304\022\344\022\244\023\304\023\204\026\244\026\304\026\204\027\003\b\023\200\233\320\003\001\344\204\032\244\304\344\204\033\244\351\317\365\006\001\244c\244f\344f\003\b\017\250\341\374\220\001\001\244g\003\b\022\256\246\351\006\001\204n\003\013\030\346\336\301\357"
+	.string	"\016\027$\003\016"
+	.string	"\322\252\260\364\003\001B\003\016\013\312\371\217\245\001\001\202\001\003\016\023\302\356\2766\001\304\001"
+	.string	"K\250A,\326B\n$\005\255\317\032"
+	.ascii	"\003!\242m\003\021\200(dP*\224\200\224\024\024\364\032s\305O"
+	.ascii	"Jj\304\243\t\342\013\316\245[A`\325\320\272\0238\354\227\n\n"
+	.ascii	"B\031\177\331Q\230\335\250\202\203\353W{\233z\033\372\300s\204"
+	.ascii	"[Zm\004\201\353\216\213\370#\233i}\017\r'\314{\231}/\263\274"
+	.ascii	"\235G\316t\2361\310\030\370(\210A+\266\244W\267\242\230\2152"
+	.ascii	"\037\325\242\336\365\337\021\273{/)\234\021?P\022T\005"
+	.text
+	.section	.gnu.lto_.refs.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375 X\025\002"
+	.string	"\362\204\016\031\240'i\f\343XUUUU%TCZ\"\340\360\373\277\265\226\356K\271S\027\301\013L\364bf\305\236\230\036\266aZ@&\034\017\216\2061\331\310T"
+	.string	"\252=\223tF\347\210\001"
+	.ascii	"Z\224&"
+	.text
+	.section	.gnu.lto_.decls.4557da70f7b3a695,"e",@progbits
+	.string	"(\265/\375`\202!=\230"
+	.string	"\372\367H6Q0P\322I\007\365\264M5Q&R\024\314\317\377\357\226\306\352\272<\240\361\351w\367<?#\"\004(\220\346\327\264\016\307\210R\365\273\006-P\241\275\221\361\343Z\332\301\254\301\026\271q]\2444\035=@DQ\243T\037J\256\265'-\262\305\275\245L\001\323\002W\003f\003x@ C\312\240\264\275\3433\306c2\347\347\275Q<\246\302ct\224\317\005\306\242\260\200\245\310\341c^5k\317r\351y\f\207a\267\032\356\215\336{\005\310!s\345i\244-\317\t\317bN"
+	.ascii	"\231\315\3475\343`K\210X\333\004\270\007h\371\004\260\016\347"
+	.ascii	"\r-\217\254\355Y\313\026v"
+	.string	"\253O\256 \021WL\360\356}\332\361\027\246\3433\256c\271\363\034\027q\276\200\013\303\001\257\304\352\330\013\273\351(\2377*x\025\006\365#\205O\212\0245mB\232\200\245\326\207{\200\225\303\3223\222\224\341\232\3378\356\f\307]p\224.\303YV@\207Y\201\0326#HN\200\366\254\225\236q\334\234$\302\222\350k{\037R\036\356\001\376\234\305\200\235g\216'!mQ\266\343\362\301\245\355\317X\330t\242b\230\020\321\366\312\323'g\213\337\215f\333\353\220\236\253\260\025>\3435\216r\226\302S\356\363\274W\351\336\373\n~\341\023N\323\251\367\376\020\343\252\200\202\013x\215\251p\032\30759\3002\206woT\270\306Cp\264>\223\334+DK\307\313\033\224\265\275{\237>)R\244\310\211\333\301\244*\265\027!e\037\017R\206\302D\360\231\001\214\366\334\301\211\212\332r\266}\006\351\331\354\002@\357\005\357I\317\006"
+	.string	"\371\217\r"
+	.string	"~'\3723\023\036c'u\351\344\274f\367>M\3540\271\221U\344\271c\243\326\247\004G[~r\2233\224\313N\301\005\257J\350\035\273\3672\324\002\347\275H\f\335Is/\322\016\263\002\314\nX\261+$h@\373\022\351;\345yr\0170\345\023\300\022\177\313\360\302y\376N\253\232\201\357\306\001\336\273\211\277\267\210G\220\371Y\017\315\317Kg\376\027a\346\347\037\362~N*\363\363\f\274\237\233w,\346\302\277\201\374|"
+	.ascii	"\247\bs\b\336\363\367\216\247\237\213`~F\032q'\317\371\273F\001"
+	.ascii	"=<\360\277\200\277\205~^\361s\335\317_~\246\373\271\210\237\347"
+	.ascii	"~\226\373\031\356\347\267\237\335~f\373Y\355\347*?G\3719\355"
+	.ascii	"g(??\371\031\372s\223\237\311~\036\373\371\353\347%?'\371\231"
+	.ascii	"\353\347\255\237\211\374<\344\347\254\377U\376S\371\257\026\344"
+	.ascii	"g\347\377\006\376F\376\\\365\363\216\237\231~V\372\031\210\237"
+	.ascii	"{\370y\207\237\223?\033\177\266\341\347\341\3174\374\034\303"
+	.ascii	"\317/\374\334\302\317+\374\234\302\317&\374\334\342\347\020~"
+	.ascii	"\356\340g\r~\236\340\347\b~\016\376\314\300\317\013\374\277\362"
+	.ascii	"s\002\377\365~F\340g\024\377\267\374l\363s\372\263\375\357\302"
+	.ascii	"\177\264\237\371"
+	.string	"\347\377\377\373\337\367\037\357\277\335\377\266\377X\376\263\375\007\372\357\366\377\346\357\357\357\357\267?\277-\341'\340\001\035M/?\211j\376\324\340E\243K\234\274\243\234\206l\313\254m?\033Z\233\300\272\242\320&7\\<\314\370Q\005s$!\321\306\306\204I\223\221\331\351\252\222\003\314\330\233\254\303\344\221\241a\267\232+=1T\236\3519\214[\210\263\026\242\303l\2266\213\035\336e\336\200\200\331\372\246\3711i\373\006\373\273\253\275\372\013\307y\257\222M\226\322K\232\266Wj\222\252&\257\266\255D\370^b\255\226\242|\265M\261\264b\351\221#\315\345\204K\217\037\234\262\353d\013\311\233\253\2335g}e\272\266\322 \272H\020\275\005\274\227\237\316(fg\365\220\267\326\265z+U\336Kc\331d\376\374M\344\275\005\267\223\244\244\210\024\0329`c\350v\264\275\355\221\336.\245\357\037x\221\230\367\336\251\232\347e&\341"
+	.string	"\271\206\371\347\317\341jo\365\340\314\275e^g\322.*HU\235\300=\330\275J\023\367y\231\313\250\225r\371DN\312\304\363\006\021\340F\205\334\345\323J\312:o\337\347\345\253d%\205\303\362\351d.\237N%\317Ur*\357}J\361,\315\220\224\274\214ZI-\243N)\023W\351*o\024)H\252\344\224ZrqJ\361,\243HRK%+)\023Cx!yk2c\225\206\245\226J\027\352\251\007\022\223'n\371t^\273{\331l\3512\027\270\267\207\223i\207\244\203\253$\305A%EAr\362"
+	.string	"OIW\316\253\024\267\364r\336\353\225Dt\237,P>\343\256\026\307)\205\364\270NK\367\022p\237\367>\335\253\344\033w\357U\336{\203\314\036\317{y\360,\271\236\236\356m\372<\335\036J\265\245{\333\fL\025\251e\364\312)T\203\022\345\272LO%s];+f\032U6\271NfR.)\252\274\026\022\265\2513\203BUI\333\312\007\030\346u%\006M\237(\232_PN 7k[x\310\265\355\037\334&EN\252\253\007\237\265\217\223\301\271\267\200\022D\202"
+	.ascii	"\371\322\266wtU\232\025\026\305J\025\217\034V\344\322x\364\023"
+	.ascii	"\373\230*R\326\366h\272\371\337\346f\210\221:\246\246\216\251"
+	.ascii	"\275&%W\236\275\224$j\310Y\347\370\r\"\005\351\003\203\243o\344"
+	.ascii	"\030\351\202&\265\245\202\222[\363k\373Z\244\245\232\311g=\325"
+	.ascii	"Og\262\206\212\302cQ\355\244\2434q\257\0202\256{\237=\325M\355"
+	.ascii	"\304q\315\347\235\342`\214\207"
+	.string	"\230Mrb\004\027\240}\255\221\362\255HN=\327\305))\211\364o\033\275|\303\341c\351\254\227z\351\363\274S7W[t4\367.\223\tA3\371p\226.1sm\351\033\255\225rl\234<\234 A\323N\272\205:s*R\216.T\332>o\232K)C(\037H\225\326\322\306\372\376\215}\3350m\317\177n5\004\273\376\240\362\332\262\237\360\234\304\001R\330\324\332\006\371D\232>\213\266&\005\013\022|\306}\314w\373\274\327\254\217\363xOG\351y\247\002H\n\243\342\332\333\271\3231\344\206\265\357\252\364\274wD;\3575\353\247\254\272e[>\303h\370\354\207\365l\224\2367j\363\305\214\017\263\251\364\374\003\334\341\037 \005\302\263\031 \330\225 |m\337Oi\365Y\233\020\301A\005\327\366f\334\003\264\341\023@f\"|-\333\231\243\202\346\310\020dM\242\250\274\332\276\222\375\225I\035\243\300I+\013\367"
+	.string	"o\302\204\257b\313>\261\266%\300\352W\326\0234\034m_\277\376\252\244.\341\341\317\357\210\266\267\343\036`N\227\360\325\353\r\013^Y[\234*DMr\3054\002\253\355k\222\277\"\251\\8nZ\346\366\270\007\270cD\370z\344\357oM\253\255N\221\272E\346\312J\335z0J\334\235\226\360\225H\352\\\362u\325V\200 \352\220'O\2220\333\276\016\371+V\315\002\002\2056\3332\223{\200"
+	.string	"\\\t_\205\350H\205=Akk\242Z\325 v<\274\316\264}\r\362W \325\311\320\032t\266`\265A\265e'\367"
+	.ascii	"Q\360\t`\365!|\375q\223\346\346\207\244\355\t>\001\254U\265\252"
+	.ascii	"\267\370\352\217Jg.\313FSX\215\327\247\032uG\375\202s\225\320"
+	.ascii	"\033\025\244\242\345\352\306\336]6\177n\23245\361r\343u\307k"
+	.ascii	"\223\202\013>&\005[\362\005\251m\325q\235f\027+xm_q\324\034\277"
+	.ascii	"M\211.\254\350\027\217\364\022@sHI\265\255T\037\323^c"
+	.string	"\234\312\264\255Sgk\326\355\r\221z\273\232Kj[\241j\024\237\335\2552\257c\205\351\314\215*=\020|7`mzu\372ml\254\374\300\262jJ\377j\343\267\t\242}\251\342j\373t)}\360oi\2512\365\020\227D\032\033il\320\312\224\244\353\312\351\254*\253\262*\t\231}``8eH\310\221\325\244W\245\212\024\254\362\363\353?\024eqw\\{b5\276"
+	.ascii	"I\342\375\227\203\346I\334\020G\274E\245"
+	.string	"A\202\252\257\257\371\300\270\370\224\254\202Lzz\315\347\343\254uL\275)\260 \031$\202$\355\275\371\2026\310\266\244\332\366\021\037\003\364\362\365e\244\257L\231>\363\252t\177h\341\002\002\256\351i\346}F\207\351H\r\272\266\235\207\223ffN/\272\363\325\327\364%\214\0301}\347\343\254b\320x\210\355q\236UX\215&\363\276\013n\275aM\265\3551\r\245\321\225\306\t\204K_\367\272\006\343\343\254txzS`\3676\177j\333\330\215\033F\274\301\344\204\251\025Ak\333v\277\263zZJ`~l@\321KR\022\027\327tFt4\367n\210\260Q\345\025\361\246;\233M\021*8\262\236\373\001u>\231k\271\037mrE\232\t\3307dM\311\013\363\3410\313\256\210\005\321r>k-\375\366\343DBb\340\313\231^e\371A\243m\2735\027>{\240\273\274\267\260\226\327 =\357\263\267\374\316\200\315\364\374"
+	.ascii	"\260\376\375\361\003\300\006.\333\370\254\333\330\215\2417\252"
+	.ascii	"D\215{\307\265wo\026\bv\364\226\370\330\342\302\306\326[[M\177"
+	.ascii	"y\\}S\326\316z\255\261\030z\245\216eQX,\337\02150\265\363Y\253"
+	.ascii	"\365\025C\257\362\306\311\020M\bj\350\240\264\310aM\231\322T"
+	.ascii	"\322j\342l\22499\2327\0259\257#h"
+	.string	"7\314\314:J\221`\230-:\350\332v\224\340\023\337\021\267m\2435\224\351\007\205\324\266\317\316\266C\004\337\222\020\316\024\355iN\253\355k\220\240\034JGS\236\233D\347\203\213\263\366\376\270\330\225\225\005\"\300@\202\013 |\020$B\b)\234\020\004\002\013A-\220`\242H\034\276\220Q4T$\002\035\2212\200\002(*\222Q,\032\213\301d\320\220\007\"\022\250\203\361H\2244\026\2030\204\206E69D\032\r\215\2222\216\2222\214AF:\034\001\021\217/\022H\032\211\220!\024\031\207\214I\343Q\205\023\220D\024'R\001T\300\213a\221\013\241\242\bH\022\206G\031I\241!\f\036\344\321\210,\016\221\301\344\260\205c\021\b1\212\304c\262\205\235\025/\f\223\304c\f7'R!\224$\2720 9\034a\007\241\343\361\203$\321\305M\213\033\206\204\216N$\2030\020\356\234H\305P\320\320\210\230,\312@"
+	.string	"\031C\250\250E\214\"\321\350(t3L\n%[H\016c\344\364\030\r\223\310\035Z"
+	.string	""
+	.string	"\371A\222X$\362\354Pt4d\301D\261\305"
+	.string	"\305\026C#!\024"
+	.string	"P\001\005r\270\003\213\031F\026/\212D\030::\023\250H\036\205\216T$\207#\364|\210x\034\026\2071\322[\200\201\004\030\254\230\021\374\212\r&\330`\002\340Wl \024n\200\2010=\006\302\232L\026[\360@,\022\"\036\207H\235\344\211T\300\220\341\302HhxL\"\201\212F##\343\320\001/\212\303\212\f\202!\303\005\022xL\036\325'\221,\2069\020\223CB8\303\240\027$\020\251@\016_\030\215\202\206\216@C0n@\n\031%\211,f\030]\340$\203(\250 E&\211.\354\211\200b\034\r0\303\310\302H,\022\217xN\244\002(I\024\203X\004\203"
+	.ascii	"dP\f\"\214\242\021\204\234\341\013\343\t\307\341\f\242\221M\221"
+	.ascii	"\321\310\"\250\346\305\020y\034\3460<\006!u\020\332\341D\262"
+	.ascii	"8\034:\016\217\202\216\306\244\321(\350\210X\004\203\b)t\034"
+	.ascii	"\022 y\242\001n<\032\036\201\222F\343\021\350\346\005\t\311\342"
+	.ascii	"\260(dt\034\036\335 \203\222A+\222E\242\214\340\205B\020\022"
+	.ascii	"x\001\205\021\322!\0253\214.\202\216\220F@E\242\220\021\320\320"
+	.ascii	"\021\t\244\302\347\005\t3\214.j\216BDCvh$\204\302\f\243\213 "
+	.ascii	"\022\375\246\203F_ZZ\213*\252\265=0\177V\226\267m\332\024\236"
+	.ascii	"V\025=,\240\037\227\0364\3200\261\310s\302:s\005|s\242e\313L"
+	.ascii	"\377\345)\3319\261\234\272\f_J\007u\344"
+	.string	"\016oG\\\331\237V\333:\246\002Q\307t\275\253d^\307|'h\007\266D\002\212\351\255\2342bzE\302\364\235\236\017$`\316\034y{\322\305\210\016\343\332\013\"\212]\035\217 X6\332\326\272Gm\246\004A\004\357\013]\220T\022\272J\007\325\3613\322\004W\304\334\215\313\252s\1775R\345\030Z\203SU\363\256\355\361\224\b_\2754\02237\267889!V*\334_\257\352[\334\222%_\332\362\222{\200L&|\355Rb\n\036\223(.n;bXB\252\333_\265\324-7M\340\322\204\265e.\356\001\006\320&|\315\262\343\343\210\262\331\266\007\013\033\232\"\272P\265}\365\253W\350\246\344\005\321v\005\232\360u\255\311\262\226D\254\2509\235@\352\332\276\252\375\225J\255\"\207D\204H[\036@\212\360u\n\316\332\024\264\255J\251Q\320\200\271bj\373\032\345\257h5\r\270T\262\362j;\001\367"
+	.string	"\201f\302\327\263j'\245\206\243m\r\021Ph0\271\320h\373\n\345\257a\365\t\360\017\311\231*O\341k\364F\351\006\232\023hM\223\245^\205\376\001\202\304\250R\3310\210\362\224c\204jFd&I2\034\202\n\020\004\302q\230\351\241\035\022\200U5\320!\007\315\214D\251\264\237\0014!\370$u\254(5\275\205*\2635\333\0308h\302>\271\337$\034\201N43\036\030|\205\340t+\243p\363\006\370\233\340\305d\2734X\216\235\207\304\206a\231\327D@\022\312"
+	.string	"\352Z\204\233\013\307\037$\357\2309\030\027\333\261R\307\003\261\\\f\032\223\374\231\020%\343y\377\023\002\361\252c\310\320;\224\333Q\310\330_J\373B\377\200\"\262\352P\366\021\376\311\213<\314C\344\317\343\317\365Q\016j\031\226\\\374\216\312\216m\033\352\305t\234\t;]\341\273\277\033\002\202Z\3456V\304\214\221\r^\237\365\336\247\005\251\377\200\036\366f\277_}\007\237\201\004\250%\222\001\326\203\347B\270\207]\3238\314R\332\366\022\217\177}j\264?\024.\377v\263^\2551\212U\262X"
+	.string	"\322"
+	.string	"$V\236\360\030\320\200/=iX\020\254\300+U_\035PQl-\315\224\371FB\030\217E=\252\035\235IC\002\340\311\203\016C\200\335\362\036\241g=\361\342b\031.\207b&{\376\351\3554\2103qQ/\030\035\356\177\225\273\026\346\242\364C\271\023x\336\365\"\001\366g\232\0176\212\227\364%\362\235\323\325\377\254M\271\363\b\027\345\033\302\373\360]\204\235\356\245\220\220W\366\226\340\326\300\223U~_\330#\331\016n\200\2409`\021%J\376m\2453\022=i8Ak\316(^\004\260\3623\264\002YIJ\260\351&\017\241\016\023\3124\024QU\026E\334\020\330\214\300\331E\256\032[\203\203\334\340q\320\006i\266\344RC\3513\0379l\314T(*=x\363SQo Q\232\021\274\252\177\333\206\300\302\b/I7\211\255\220P)\030\3249\036\030\271\337\302\021\217\342"
+	.ascii	"\322*L\243\021\347nR\203?"
+	.ascii	"\313\037\214F\376\235\031\\l\001/\\\372\346\246\036le\364>\215"
+	.ascii	"\026\0350\322\025TA\337\254\203\fr\212\006\233A\273fU}\272E\033"
+	.ascii	"4\210A\261\331\200JPK\354\206dU\347w\002C%\252\373\rG\254C\021"
+	.ascii	"\215\320\211Fn\215\220\326\0372\354\215\317\354\201)1\253\033"
+	.ascii	"W\242'\375b\367\214\327r\362\316\334\357[3\310U\317\036-z\224"
+	.ascii	"\364\006k\220\2518-\034\263\322\002\340T]\215\220\376\210e+\267"
+	.ascii	"\341\240\266\347\311\177q<Df.\330\n=uqbY\321\211/\263Gof\257"
+	.ascii	"\330f44\240\375Lf\253\002j\346\r\344\342d6\313\274@\027xP\303"
+	.ascii	"\022\322a\252\263\025\312\264\035<\201\237i\215\344\237y[>\307"
+	.ascii	")/E\347\326\303\341c#\023y=\265\2541\371\n\274[\222?\224\263"
+	.ascii	"\241\367\215?=^H\201I]}\260\346\300\356@\030\377\177\\\274\371"
+	.ascii	"G\366l_&\362\216\220n\2334b\367}\243\372\r,\033\020\345\355\024"
+	.ascii	"\205\235\260\311D\346\200\312I\020`\216\250\021 \033\215\320"
+	.ascii	"4\243u\353\313{\314\252\315y\232\213y\016\242_M*\201\321\201"
+	.ascii	"\321\231bC\t\\\315\217S\214\037W\302,\266\303:O\317\370+\277"
+	.ascii	"e\264\372t\017\375i\032\224\242\0011\210K\207\363\247;\2372\355"
+	.ascii	"D\267\211\310$\\\212\026\035Kw\004\260V\222\342\032\374\206e"
+	.ascii	"\247"
+	.string	"\316\322p\217\013\272t\335\361u\232\223\337f\245\005\t|(\003\034\326\023\2743D\353q\377ZF?I'6\017\304\302\271\256!f\351H3\343v}M\020\222\n.k\253\200\177]`\004\334e\342{\026\376!\261e\030\346#r\277FI\203\352\235\312q\t0\226\204i\274W\315\257\317\330\230)\35766`_\b\254H\034!\263\312\227+\b\234F\025\321\334\023\214\024\"c\005\362`\236\001P\274\265\324\325\350\3408\364+\334\025j\022/\016$\030\222$\314\312\020\314\316\204\322\245\243\251x\207\211\360\346\251\201\023\343\315\r9\200x\340\242,\311P\342\212\rt{\371\035z\020\034\351\357-\276\b\345\025'\013.5\265\025\006\301\214\005T\313\035t\034`\\H\375\354\334\364\t\322\345\200\224\254\030\244lq\331f\242\322WU\333\007\226\026U~\344\2112\363N3\341.*&5\274U\320.1\357\375 \032\272o"
+	.string	"r\223UP\376\375\375\013\354W\304\013\307\367\206\345\302C\033TA\372\200b9<P/\364\376\307\206\372\246\r\231\276\031"
+	.ascii	"l4\261?e\177\300\337\215O\353\020\362\242\036\2359,\274\214\207"
+	.ascii	"\013\013\277\205\016\344^p\r:'<&t\314\370\3556\037\273\224\033"
+	.ascii	"\263\271\236\0066\327\307\355k:u\332an\203`\334A\335\b'!\317"
+	.ascii	"z\275\305\367\267|\330\312\303\200g\262?\3512\346\036<\235\005"
+	.ascii	"g\320\323+\366\21707i\231!\355\305\321\244\357\007\034\\ju\315"
+	.ascii	"\365\320\372`1\304g>t\377\005f\313\236\007z\347\300'\343u\337"
+	.ascii	"\177\177\356\036H\2770\f\216\341s\213\317vo\026\367\347\313\363"
+	.ascii	"\307\\:;\003\371e\377\344{h\177\205\266Mf\344\244\031~\271\317"
+	.ascii	"\370\377\252\366\2043\307\031\337\227\306\256\037\303\334\f]"
+	.ascii	"\030\027\2255\355\217\355\300~\314(\276\226\277\253o\264-\265"
+	.ascii	"\345AG\326\n"
+	.text
+	.section	.gnu.lto_.symtab.4557da70f7b3a695,"e",@progbits
+	.string	"findBoxByBoxId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"getBoxIdState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4557da70f7b3a695,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
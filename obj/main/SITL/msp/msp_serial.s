@@ -0,0 +1,1446 @@
+	.file	"msp_serial.c"
+	.section	.gnu.lto_.profile.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375 \fa"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	"\t"
+	.string	"\021"
+	.text
+	.section	.gnu.lto_.icf.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`\375\002\235\r"
+	.string	"\206\220<6`\215Z\003\334X\335>\354\344=\262c\231\253\237\357\344\321\312\303\247\272\216H\273\t\272\027\022\004A\020\020A\200wXA\354.\331\332n\262\367\226[\312-\245L[\006'"
+	.string	","
+	.string	"0"
+	.string	"\263rJ\t\007\363\357\364\354\267_\247c\323\351\236\200H\025!\347\362\277\306&\b\204\232\270\342\361-\002(\034\305/\312\221\022\263\355.g\026y\345\312\004\230D\006\352T)\327Eha\204\375\275\236\267\255\265\332n\331Q.\205\223\027\211;\231\2548\350o\277v,\020V\307i\016\030\340\314\032\316\240\263jm\257}fkU\034\322\203v\025<\037\016\027\034\004\007\345\200f\252(id\333'u\002a\277?\357;q\263|\326\260\241#\004\244S\314d\370t\302\217N7K\313D\221x\2440\261 d*]\250E+\364X4U$\242jU~J\021\302(\361\236\033\001c\250Q\256\300$\210\202\250\240\222\341p\202!\272\032\017\022\240\205\035\ne\310,)C\311\306~\006"
+	.ascii	"\261\2042\225\323v)!\031X\n\335\334\377TJ\002Us\233\216N\377"
+	.ascii	"\374\306G/\320\270\264\027\001\267\244{\3553\300\202\336#\317"
+	.ascii	"\246E\242\335\314\245\221\264\t\2108\303\255\263_^\013RB\235"
+	.ascii	"C\037S\363\221\217t\247\343|F\267\037\271}\255\242\326\373\306"
+	.ascii	"\213\207$\347h\317\230u\036\206\005a\336\234\023\364\300\316"
+	.ascii	"\031\347\021\031\347\316\325\366mk\306\252\311|\300\313\363\227"
+	.ascii	"\003\006\017\016\256\306\257\270S\274\277\360\300>\220\263Q\275"
+	.ascii	"\353\300\371\271\f\003,j3(.\204\372\314\207\377wT\231C\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`y\001]\006"
+	.string	"B\310\024\030\200K\322\001\340\314\003f`\006\346\026\033\210\251\013\245>\222\240\266\345N)\352D\220C\016\344\f\027\026\322\t;X\240*\227^\312\244\240O\334\276Q\340\354\2757\025c3u\346\370J\215r\324\343i<\"\3721\241\004m"
+	.ascii	"J\310\352\273~?\347\"-\002C\250\221Eu\234\302\316\032\340\002"
+	.ascii	"![7\021\320P\206\240\033\005U\2411\005\220\0212\231\247\367\232"
+	.ascii	"\031\206\321\326+]\026\304\303\3237\023\204H\2260\035x\020)M"
+	.ascii	"M\271\260A\"\356\360y3\\\216\235L\314\013\2311/\3649N\303\344"
+	.ascii	"\315\033Vd\252U\220`\376(\247\210#\\@\216%\263\\\250\003K[h\302"
+	.ascii	"J\341y69\247\205\0326\256\037\0325\035\357\001"
+	.text
+	.section	.gnu.lto_.inline.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375` \016\2652"
+	.string	"zD\364\rD\240^I:\004\317\372\343<\031\205\215\260\266%\213\261\241Y\247\307\377X\037\0011h\275\305{\203mr\034Yx\240in\216]JgZ\307)\240\300\2202\316!\364\250/4\264\222\267\337\026\333.\211{'\231\002\300"
+	.string	"\311"
+	.string	"\302"
+	.ascii	"\212\301\363\202k\320\032\006o\201\225\313\226\013\026\264dA"
+	.ascii	"c/6\272\242E?\201\245E7A\233\001\311f\314\373\221\361\326\215"
+	.ascii	"\252*\262\274\2427\231\310\314\036=FT\214\177|\244\013\222q:"
+	.ascii	"*\023\220\312\317\377|\232\225\356i\334nwc\366\322e1\007\355"
+	.ascii	"\242\301\332.Z\301\365WG+S\374\261\273BCQZ\372\022)&\301\352"
+	.ascii	"\262S\177\372\023\351c\232@u\251\247g\356WQV^1\177\316\311\024"
+	.ascii	"\273\353d\307l\023]\325\326+%:\n\265\031h\006\217\350M\032\255"
+	.ascii	"KQ\t\327\035(@V[\311"
+	.string	"R}?\367\335]\317\026\021{PY\361\242\335v\202\353\325*\"NQY\361\222\3316\013\t\b\2727\352O\367\273\321\374\371\273]\n\0358O\007\276\335\005\021\203\034\001#23\b\202?\350\203>\210\024\321|q\363&\032\224`\322\335`E\305\220\371\240\004is\306\360\367C?\274\335E\f'R\322\241\334[\204\321ed\314\217\037\312\265\352\252\252\352\342b\325\034\035H\210\374oR,\262\243\217\326g\211{\031\254(SlI\007\022\265\205dZJ)\347\3340\234k_+znD\272\277\363[\177\213;\234'6<\f\370\337&\375\314\223*U5\203\270C\245q\242\252\335\342\2200SL<\203 \b\206\353\207Zw\270\272\273I\207\033\206\341\2028\026\214.*\352\245H\301\007\217S\034\033\\\333\3256Z\201\320\n\275\210f\020_\\\016*\310\244\224\3377?\273\366\303!f\016\266Mf;\027w\273N"
+	.string	"\222\324\237\337\355kld\355\356\371y~\271\353v\241\020x\202!\3568\340L\365\001\362'\030\"E)Pa:\356\t\202\270o}q\375\220\236_O\245K\177\235\213^l3\263mt\rp0j\353\0275:\212\253x\342\031\275\3511\353\210\370\344\343\t\230\301l1Z\234\035\004\021\320\226nC\016\023\0364{\351d\3440\341Q\363\354\350\003W{RZG\334\n\r\252(\007\366.\277=\322\371Hw\203\033w\345\356\207+\325\215\273\340n(\347\234\363\333\375pK)=\347\234s\3169\347\234sN\313\335\235\252\252\036\342\220\031\001\236\341\305\316\327\320\025\226%>l&\360\341.%\345\325\346T+\252\260D\220\372(\317\304\240\243G\301\320"
+	.string	"\265Z)\006\321\002\253\3637\351\n\342\203\b\3025>\270\352\023\025\027VCC\002\200\366\326\005xz\312b\023\006\0256'L\310\266oB\234 yZ\\\372\016\013\037\251\263"
+	.string	"bU\004O\007\007/q=YP\224X\214\001D\032gZ\324\260\3357\276\270\204\330\374\371H7\273\231\356\265\353T\023\361\251\25289>\013\331z\244\263\311j?V\032\f\317\036\021g(y#g\001\211x\325\004\307\n\t\246\031H}\244\363,w-2\324\030\031\220\024\315L\301\223'\376\370\237\223\207\340\252[\332\340(\354[\264j\360\032\274)D\374*BeU\3003u\314\276A\203**f3}\305\326\227\233\"\231\203\302H\031[\001\201v\250\361PhF\204DD$IR(t\021\005\204I\347\324U\017\022\340\024A\212Zi\216d&\251\223\375\330\f@"
+	.string	" \213|\230\240"
+	.ascii	"\227r\261\237o\222\240;\341\207O\371\216\327\016\036\350\223"
+	.ascii	"\335\017\255C\353\315\013\344f\361\366\342)\327;\221\225\307"
+	.ascii	"\001\223teU9\027\315m)V\027"
+	.string	"\372\316\245\264\221S\314\202\320\251\025\270,6W*\\\314_zx)\314\340$\235N_^\021\275:\t<?\354\216\251\303\313\313I\207\307<\233\221\247Q&\331$\330s\260Ez\271\203\347\330Gn\001\302Y\234FMO\031\236Z\205b\3263\2767~\n\250e\326pF\237\200\343\216\206&\031\320r\376\2342\352\256\032\334\0351\252\201t\331\nM\351\364\313~>\325\257\244du\370\332\223\307\bV\250AF\263\344\036\274\305\275\222\312{\253\243\275\022'\255\031\241\271hR\340\304\024LC\257\256\256!\263P'\235\273\bM\211\250\303\\\353\002\357\n\037X$+)/\t3,E\312\217\303\222\237fAO\244zfO\343\037d\037\321\273\323\270x\t\212\367\326L\032S3\2160Q\341L\274P\371WF!\334Q\331|\351\004\356\274Dr\270\211\334\021C\367\031[\344O\321\313\324\347\f]\003\236\027\276\356\007\223"
+	.string	"\307\240\303K\220\317\220H\256\233\004\201k\026\236\262_X\251\262N\336z-\216\262-\\,\365\r\2474my\262\263t\205#i\007*W\366;\300\365^\363\307\366\336\252\214\210\375\314\"\244(w5\262\203\240/\376\332]\212\324\020\222$\025(03C\220\257\220\023\230>}\\\305C\306\362\231]\036\240&\205T.\370{\023]\313\332\226\374\3769\254\224\345\26001\"\267\227\352K\005c\n\264sp\334!\311\234pd\274\367\031\330(\377T`S\345\315\240U\243\231\345\\\202H\022\232{\375\351\\\f\232\t{\263z\213</\301\231\312\275\\\321t\005\362\177A\351\265\232\276\222\031@|\366\001\031K\032\006\277\205]\250\230\025]X\200&\326\355\377\252,\2016\337\270\313o2c\033o"
+	.string	"\327\306\036\205\0319\207e,4\b~\2139\023\322\n\207B\270y\217r\355\004\024Y\226/\302\2051\021\202\261\231\275\330\335\252\217\3038?yy\360\200\025\341&wv\2007\243k\376\024\006\200H\275\001\320\325hkH\021\016\0048)`ge\266\276\260\274$;\227\225(.\220D:\250\334\020\204\350\004`o\214.\270\251\3303\206;\246lQ\307\205a}\206\310\321\306"
+	.string	"\320\270\212\242\342\357|8n \237\222\030\350]"
+	.ascii	"\320\230'l~\310a\233\331\302C\3601\035\214\204\256\b\205\252"
+	.ascii	"\tx"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`j\b\375\025"
+	.string	"&\032N;0m\223t\200\f U\207\034\356\006r\260\177\220d\002\262\212\263^E\313i\202e\207\370(X\224\204\001\3020GV%|\352_<\2256\362\264\305G\235\342@1\373w#D&\0318"
+	.string	"<"
+	.string	"?"
+	.string	"\023\343\323\013\"\311$s\205\225\\s\311\243l\261\b\3136=M\257\013\363\375y\260\316N\227\207/\317d\023\364\366,\276J\352\265\027}\277\364\330\223z\016~\305\fV$\004\212Q\3078\225\327\236\273=\2422\271\337\fA_\007\253\306\027\373\217\202>\031M\3234\221\322n\356\352\013h\252\260\036\035\362\"\356\26704z\226\033L\332\227\272\r\272e\344\221B\310\001\274 [\252\267\300|\032l2\350\217<\211y\036\033\345&\016D\377(q \020\3101T\217\241\037d\312\003\271\r\375cf\272\261\363\007\251\334\200=\207\215\016"
+	.ascii	"\205T\236\272\202\324\025mB\0274,\360\310U\230\3114D \204\365"
+	.ascii	"\312\f\202\336\245\227\351Mk\300\347\303Qe$-\031\230\353\213"
+	.ascii	"\323\017\3644\002\310Kq\200\226\224hz\352#\013V\245\276\013\326"
+	.ascii	"\301\3518\f\326\023cp\211,\221/\203\265\f\200\256\250q\301S$"
+	.ascii	"3\232TJ\313\032P\002!\204\214\310<\022`\303\034\303\221@H)\312"
+	.ascii	"\220\320\310\004\222&,--d\343\r[\204h\234\303\262\022\352\266"
+	.ascii	"\261\273fK\\F3EP\314q!n>i\233Kl\003T\2373\350\344\314\300L\212"
+	.ascii	"\313\300\240\277[M{\2154\345\275M3PI\226y\232F\351\374B)\264"
+	.ascii	"\356\020\361;4<zQe\372\223 \234@\017M]m\322\207\00733yK<\340"
+	.ascii	"\267\222v\003\031f\352H4\374\245KWpp\n\370\200\314\\\017p{f>"
+	.ascii	"\265\252`\017\007\214(\353xS!\371\222\022s\3377\026\357+\230"
+	.ascii	"\260\364\212\253M\024za\370\205\205\213B\304=\017.oF\304\235"
+	.ascii	",\3031\251\311\3437C\270\b\007s3\205;I\241\213f\315A\013H\225"
+	.ascii	"T\3773\263\037\361,\020\001k\"6\360#z\373*\272/\204\367\364\252"
+	.ascii	"\357\034\343|,f\001\230\036[\006`\256\211Q\305\365\246m=\341"
+	.ascii	"%b(\225]\220\2470\240bg\n#V!a\255@\3173\266\221\302K\246\314"
+	.ascii	"G(e\360\236\271\235\254\006\314\373T*\257\273/\031s^\237\024"
+	.ascii	"E\332\347K\202\303c1\245s\377Q,\300\216\372\205\001I\375\362"
+	.ascii	"\024\251r'}\003\365#m\227\035bd\006\357\267\306(\347@\224?4\263"
+	.ascii	"\007\006U\327%X\232{\232\201~\275\002\016<9\302R{A\363\323\234"
+	.ascii	"\206\314\256X\325\336\221\001"
+	.text
+	.section	.gnu.lto_.pureconst.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\205\004\001\232\004\003\232\004\004\232\004\005\232\004\006"
+	.ascii	"\231\004\007\231\004\t\231\004\013\231\004\f\271\004\017\231"
+	.ascii	"\004\020\231\004\021\232\004\022\231\004\023\230\004\024\231"
+	.ascii	"\004\025\231\004\026\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`\002\002\355\013"
+	.string	"\366\021:3Pm\222\016d\254\242\006w\352\0313q\004\225X gjS\212\204 \246\221)D\263R\210G\312\030\\T\036\323\343\016e\374Cf\3179v7\333\310\226)("
+	.string	","
+	.string	"("
+	.ascii	"L\332\271\276\204\326*\016\267\266,\026\002\342\025hd\357\334"
+	.ascii	"\327\275"
+	.string	"o\260Wm\300\206&\020\366>eI\026\365\330\230\247G\222\235\362\262l\312\314\r:>\247\245\006\177\300\226kz\035\260\345\345\335\337\226\345\261+d\0278\221@D\257\343\0033/\236\205\017\020A\001!\327\373\374\231\365\334\366[\353\273m\255\237[\274\203x\004\366\247J\326`T\307\240\246\235\353\007\002\235\253\\\n\230Y\02193Xdt&\027L\b\246X\312P\336\300\230\212\321F\216\214.\017\317{\034\241)\304\004\032\347\357\005'\360VHqnK\0027\231\006HW\242\021`\fC\25015b\214\232\240\005\2056v\003P\2021ef\035\021`\301S\027d\2266{\034RCF\250\347\036\210\202_\241\352\204\236\275\n@\001\246h\274Q\034Ez\013\317\267D\260B\342\002i\336\355\022\350)\331\256\226FE\343\231\356\225\312)vY\210.WS\320=w\240\227\230\275\n\254`\246|8L\223W\227C\022"
+	.string	"\374\244\230\310\342v+awp\360'\230\306\025$n&b:>l\374\207Y$\367\233^"
+	.ascii	"\253\033\220\0014\322A\036K\031p\006"
+	.text
+	.section	.gnu.lto_.lto.fabf885c90292076,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_resetMspPort.14.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\035\f"
+	.string	"\026\027TA"
+	.string	"Q5\035\230\303\257\355\352V\307\301\212^\374#\373\034\343a\363G\347\275~\222y\"\002l\250\216#\216\260 \200\341\302\336\205\016m\013*Q\030\312>\231\336[\257'\304kN\375\372~jd\357\224\002>"
+	.string	"?"
+	.string	"D"
+	.string	"*\320\001\354\236^\300\330\255\005l\331\236\271\276\242=\333N\321\236y\264m\274\212X\f\r\r+r\354.7C|\274\034\375\263.)\231B\227\221\004\273kY2u\270\347m\023\260\r\301\276\203\366\261\335]\317\223}\351\355\253_{\375\261\253~)\3710Q\301\261\313\341\265c]Y\f\022\266?\261\215I\333\300\201\361\253\317\353"
+	.string	"\017\255TK\201\254\030\002\204l\006\326\006\314\245\375\324S\214\017vw\027\237\b%N`\323\246\360\026\336\266\273\b|\026\027\276J\215\021 \355\031\006\245\343\203H\276\034\221\277q\317\320,\337\246\035Z\220/\371\2547P\341\"\315\220\217\342rn\323\222\204\032\311\227]Cr\202\b\037P\244\036\355\320\fG\354\036L\240\240\206\023R<D\032R\006_F\004\277\005\236\320\003\361\346\322\321t \r%xB\217\253\320i<n\003\206\334E\200?\017\0059\361\373@nR\367\330\316\2233\031.\321\034Y\233\001\023"
+	.string	"5\003\220\347\214w\201e\34218\032\\"
+	.ascii	"\214J\207\351\335\2105\301>c\241\271\006\034\207ap\007,\003%"
+	.ascii	"\202\021\001*\312\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_mspSerialAllocatePorts.15.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`\323\004\025\""
+	.string	"\366>\336I\200VR:w_"
+	.string	"7"
+	.string	"T\215\235\300L\316\007\231\235\262\313\301\215\351I\257\327\321\324\034s\027\346=&\322?i?\201\331\031\313\241\355\305\023\256\302o\030\242\316\206C\223\224\020\244\230\236\273\335\211\325\317\255\375\177\223-w\222\001\316"
+	.string	"\276"
+	.string	"\312"
+	.ascii	"pGW\302_r3\376\225=]\221\273@\006\365\324*\253\247d\273*\342"
+	.ascii	"\035\375\223|\214\177\013\030\030\377\214\262\351\326\203#e\032"
+	.ascii	"\360\216\362\233\0273\336\371\242h\352\252\302\031\270\2674}"
+	.ascii	"&8\312\txG\371\371\235{\224w\235{\224\215\314n=U6d\220epi\232"
+	.ascii	"\006;\007\377\252\361\276_owQ\333\325\310\007\340\204\254\215"
+	.ascii	"\311\362x\237\335Ua\371\270\227,.K$\367\246\366\261\251\372\273"
+	.ascii	"Z5\336\333\315\370\265\001\330\270\b\001.\221v\200\215\256&\277"
+	.ascii	"\245UE\035\2541\343\245E\343\326\352\320p\002\006\270\254\262"
+	.ascii	"C`\302\270n\366\252\\R\325\376\330\t\020Ak\306yi\325x\335\025"
+	.ascii	"\245i\3125\271\324:\333\234\231\2070s\022\263\335\021!2\210\025"
+	.ascii	"Q\373\224\247{\264\366\220X\234\223/\345)\b,\311\314.\036%\304"
+	.string	"\2010i\232\022=9\224\021|\036G\231\004R}\362(\037\351\036\345\351\372%)\003\330\357\233\035\201\032+H:\251Z\327gV\252\226\315\300\372\013/3\n\245\372\344N\353DI\343\336\250\372\310\374<\326\376b>\021\230\234\0337\016\346 \240\237\243\235}Nv\356y\331\231g'\007\007\370\347\371\006\255l\203V\376\241\225}\2672\317Wy\327\253|oe\224W\331\336y\356]\345z+_(\251\313\214\027\267n{\246Xus\351\032\252\366\343h?\331_\366;\377'\363\317\370ih,\204\216\317\024\213\303\226\224f[|\240\362\272\247y\302\214B\352\223,\344\323\274v\260\325\005IW\240\332\346\205w\3508\315l4bDR\237\364\351\247\335\327\fr#\356\315\252\217\314i0\230l\027\352\366\364\327\274t\241a\023P\371\306$\267\037\341\336\016\236ot\337\344\273f\226@\241>\331\3236\345b\013_\273`"
+	.ascii	"\f\302\256+\020f\017\247T\255+\236\013\006^\232R\021\361\265"
+	.ascii	"|K\006\273\341\350\036\335\243\267\357&F\3156\332G\322\261\207"
+	.ascii	"g\211\342\035K\211\017<\036/\356Q\333\r\007\343\006S\314\371"
+	.ascii	"\253,1t\240\3149f\332^\374G]`\0075\332\326f\305\234\252u\257"
+	.ascii	"\316\2714bl\177\361\212[\233H6\206\252\31213\210WY1"
+	.string	"$\326\200JP\304\242pI\250B\330!EQ\351\303\t!\021)\205\223N\223\323\322\256H\034j\360\265\020\236`\262\320C\241\224\30444*\022\207M>6\241@\005\222\022Q\350D\242\311i)\310\244\204\264\0244At\n*\370\341a\223\220\030,\016\207\304\340\357\231\276q\260\r\313\212{\223\352\2517\337\330\217\242\304\250;\315\266\327\215\323\312\217\235B\017\272\312\217\272l{9\rdqm\332\350\327\276\266\351\272\006\271U\177m\277 \217\\9N\373\332F\223\254\355\214\312o\3234M\177f'\200\205<\333\0015[\234\356V\262\335\335\364\034\362\314\006uN+\231\337\353/~\332m\020\263\373\323lQ`\337\264\262\311\231\215?\200&0\327\250\372\270\353/+\007\366O\213\bY\2501$\204\214\222F\031%\030\221\231\031m5\006`\002\031\262\253y\020pH\232\244\320\030\013\023)a\265\374\201\304\022\376\002N"
+	.string	"\"SjL\364\354\r\301%%$\376\273\024q.#=\021\340\\9#\301\034\311\246\363\306f\003\302\222\247\305\372m\221\257\2325\005\217\002\201\021?\304\324\207\364\320E\341((\n\2124\036\f\324\377\370\311\322\316\330/)dm1\026\037+D\256\310m\200\274B_\260\337\277V"
+	.ascii	"\374\200\260\227\375\034X\305>iL\330\366\307\300\006[5R\b&T}"
+	.ascii	"9j\237\230\t\374\314<\327\303D\310,\262:\271\363\240\353\004"
+	.ascii	"mh*<\232\254\035\272\236\225\262\337<\005\367\r\255z4\263\177"
+	.ascii	"\tL\005"
+	.text
+	.section	.gnu.lto_mspSerialReleasePortIfAllocated.16.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`G\002\255\023"
+	.string	"\366\244\201I\320\322(\035RWl\347\033D\243j@;fc\345}\213\266I\232\334\022&H\006\\\2522Q\024QcJ\355x\003`\004\330\b.w\n\357W0\210\277\3328@\211'0\333\002\254*\247\230~\316\350:\006!d\023\271S\nj"
+	.string	"f"
+	.string	"o"
+	.string	"'\341\247\307\023\370>\303\017\370>\035\263\217>\352\354s#ftJ\273{\322\022\326{\343\375\311\330\301oz*c>\317\017\334\024\325l\262\203\236\311\356\226\330f\274\0053\371\215\250\250\371\fq\317K1\262\335\224\3306x\246\017G:\256\273\244\261\321\244\036\367\0046H5[\315%\270\262\273\2265\233\207;\274m\020\266Yl\031!+S\275\331\243L~w\327\232c\233\276\363\207\367\271\301\367\334:\245\245'}"
+	.string	"\037\215\033\005\212v9,\tY\2429\204\342>\177\217\375\234\257\363y\371\312t\020\241\231\341\254\204\037}\234M\237f\320 \366\036\230pS\200@9\022>v\307\223O\253\204\2377\331\276\264\317\342-b\337\321p\001\2739FA\273\243\002\0076*\365\r\021\311\250\314$2T{\302J\276\346\222\037!\"\232\312\214K\022\201\303\323\233C\225*\346x\320d\020\333\024\276\273"
+	.string	"\n\355Tf\260Hd\273\0251.\343\345\373\224\n\n\355\200\354\370@/\bv\324lg8\fV\212\316\356:p\361\027-\377\304\247-\274\344k\237\376\353\373\004U\346\250\325\250^\257\373\f\262I\232\031\022#\227t70\261\305\342zAP\301P-\253\026\027T\312\004\203\252\305\345\001Ll\271D`b\213e\304)\224\n\250\225\250zIp\275X'\227\025\212uJ\211\257\023\212\001\267\\*\361\004k\265\304\223i\334\1775\307\346y\370S\203(Fg\240\336\034\340f\232t\232\220\246Qy\224\353A\223A\356}z3\314\247j\322\343>\177\330 \311\340\314\344\222\234&\362J\267\215\357\344\240\006- 0\002\204\030\303y\315\370w\fq<\007\022\231@\302\321\324}O\263\301\227"
+	.string	"\013\227\t\246\242\310=$\004\367K\b\276\245\241\r\330wL\367\002\262\304\300\242@\214"
+	.ascii	"\364@\242hS\250\354\341\220\261\240o\336\\w\250\002+\345m)D\260"
+	.ascii	"B\020;a+\3160F\363\236\216v1\026\361\016*\315\365\335z\232\373"
+	.ascii	"h\257\272\342N\333\311"
+	.text
+	.section	.gnu.lto_mspSerialReleaseSharedTelemetryPorts.17.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`\\\002m\023"
+	.string	"\026\244~H\340\320(\035\313\034\301+\326A\"\210\206\307\033\255\224\305C\357\362\032\221\356\224\354\273 \n\345\351\216@\362?\206\352\245\312\374&\335\345\204\335=\206\032q-\314c\005\026\315\367\276\\\304A\0350-9\3415!d\023\271S\nh"
+	.string	"d"
+	.string	"n"
+	.string	"G\2735\221O\213\200\237\017\355\262\215^\253\331\333l^zp\273[\322\021\326w\265\333\223\256\177\336\354T\272\374\234#\220\345\306\330\353_\367\261\273\036\261\227N\001Lz"
+	.string	"P\314|~x\327\205\034\335nx\3048t 1&\306\333.ab-RO{\210\354g\214\315\\~\020v\327r\214y\270\301\333\226\261\035\301\226)\001\327\333>\203d/^\222XdNw\367\245:\263k/\371U\032;<\317\316\335Mi\355\244\245J?"
+	.string	"X\003i\206\201\334nL\016i\213\246\220\315y\376\235K\373\366S\3706\207\257]\205\353<*_\227\016\03500\034\022\360\323\265\203x\237\340\013x\237\366u|\232\303\317\005$\256\357\254\200{\342\003\262\335\004\036\256\310E_\366\220\252\366\251\202\374\350\007\"Z\364e\033u\241\f\341\215\bw\013R\roD8hN\032\222\321\351t\346\024O\252h\243\321\"s\330\266p\027)\337\215\350fw\033\264H\tx\r\341\200\316B\305\373\224\372\335\210ph\376\n\225\0042F\333\033\376\223bP\263\273\016z\356\243\362K|\032\003K~\374\364Y*c\2143\235\006-QEa\305\232pj\231NP'(&\223\017\r\247\023\024\t-Q\265\352\260\311\310\005\023J<\261JV\254T\t\005eJ\225LDVi\344\200U\253\223Xj\251Tb)\254\355\277J\223s\320'W\304\242\260Og\036"
+	.ascii	"b\206:IH\303H\243w\273\273\236\316\274\342u\032\352i\2376d?."
+	.ascii	"!`2''\001y\334\r\303\0239\250v\211). P\002Q\312\252<\317\030"
+	.ascii	"\322xK\nm\255!+j\337\263\361\220\210\005:\364\241\031(+ou\331"
+	.ascii	"\025\252\300\257\327\314\353\241\035:\346Mn\031\336I\2018\206"
+	.ascii	"5\210\327\005\303\t\0340\224C1\006[)4j,\350\315\317\365\0163"
+	.ascii	"\325He\203\2120\210\247-\362\2363I\306sE\220\031\216\033\330"
+	.ascii	"A\345\271\276[\231{i\257:\305\235\366\221\001"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedData.18.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`\261\035\355Z"
+	.ascii	"\312\214@\037Q@PJ\352\233\224\323\310\2538\301\024\222)\317\333"
+	.ascii	"\372\353\266>Re\232tx\\D\230\325p\021\265\266o\352d\007TF6N6"
+	.ascii	"G\242n\006\213\216\320.\217\215\013\351\214\215\013\351~Q\225"
+	.ascii	"\331\341\353n\267\377\357g\246\230\235\376\2455\"\345\336)\245"
+	.ascii	"\024\321\001\305\001\354\001D\327y(u\026\272\316\037R\347\240"
+	.ascii	"\353\f\324s\036Z\347\237\236\263\217u\356\271\316<\251\263\207"
+	.ascii	"\353\274\223:\353\\g\341u\316\261\316\035\2543\316u\276\261\316"
+	.ascii	"\034\256\363\206\353lc\235\203\326\031\330s\376Yg\337u\356]\347"
+	.ascii	"{\235\355uV\255sj\235_u\356\256\321:\342\236f\206]\326\025G\264"
+	.ascii	"\2065Ne\373b\346\3562f\3403\177\300\fd\346\324\233\354\3307+"
+	.ascii	"r\356F\224;s3\351&\037t\323\203\306YW\257\273*\353J\346\304L"
+	.ascii	"\275V\231\254ul\253\275\316\261\25523C\221\370\200\247\232\f"
+	.ascii	"\005\034\027\211\226\214\362\\W2\342\013\351\251\216\202\022"
+	.ascii	"\021\202\370\344\324\304\264\244\224\204\004\342\310\250\210"
+	.ascii	"hH\350C\020\320\360\307\247\207\307\303\216\2160\247\003\316"
+	.ascii	"\r\207\r6A\340\317\327\273VM\337\247\270\177YT\035\005%B\006"
+	.ascii	";\017A\354\342ONp\335\264\005\n\2343i\361%\245\24477G\002\241"
+	.ascii	"\346GFT\272hJ*dF\305\211z\240\371\220\320\225\372\340\202\023"
+	.ascii	"\017\002z\322\304\207?c\355\263\004\fk\314{\206x<0\277|G\016"
+	.ascii	"K\354\210\353\\)a\n\251\020\030\226\021\317I\227\270\266huY\017"
+	.ascii	"\311a\365Hu\274(\357\032\f\253\210w`\202#vs\204\003\nA\206\374"
+	.ascii	"\206-\033\325G\360\b\007\020Hwa\375\330\372_Q\236\257\253\302"
+	.ascii	"t\357\325$\271W*\001%\03136\371\313\n\301\352\020i+\302C]X$\274"
+	.ascii	"\212b\253\216\t\264+G\217N\345\260\302\244B\353\272\366\223\366"
+	.ascii	"\032Y3\374\353\270\300\260"
+	.string	"\226&\245\311\204\bWwa\371\260\262)\032\035o\277,\244\215_\251u]\331\257\262r4\217h\346/\303\314#\230}\250\002L\317\321?\037\300\035\354<TX\365p\035\354Z)\254nx\326\362\307\025\034;W.JZ\007\321F\210\373\375\222\215\326F\036\264\205gP\337/\373\357\204$\t\322s\032k\254$kx\346\265\360\314\314\375%\013\313L\201\317`\001\314J\303T\363*c\220\317\013\232\247\232\276nq6XJ\312l\224}u\353#\362Y\003\367\032N\353#\362\016\311\272\322p\245\254\241\314\212O=\217\033M3\267\350\347\031\346\3212\273\3503G\037\225\363\311]\264\314/\032\257\270s\2558\231\316F\353\n\306\312@\325_r\227\031\242\3403\341\216\351\314qS\223K\177\311F}\264+>I\004'fv3\234\006n\027\372D\225g\031*_\303LF\325HI\266\242\374\035\267\230 \r\033v\3342"
+	.string	"\325\200\341\246\373q\231\343\376\342K\213\343\366\322\033\203\343\346r\267`\340\326b\2237\262p\273\251k\256p\267\245.X\341f\373!j\334k\316~\265Z]!\231\302M\245\333h[\3551\260n=\2310\327\022V\245\226\302\314cz\353J\325\\c\\\270\206\240L+\263\256\253\222\222\225\313\363\230\371\202>3\366\326u-\301\335\002\bO\fzFZ\345\366\300\266\332oD\004$\\M\232U\036e&\243\352\217F\243m\376K\346\376h4\332\306\357\305\334d\335+\272\331]\200\317Y\312\347<\200\317Y\005;\013p\235SX\347"
+	.ascii	"\2543\n\353|\342:\233H\235\001\270\316%Rg\022\327yD\3179\312"
+	.ascii	":C\365\234EX\347\020\327\231\230:?]g\247\324\271\311:3Y\347\245"
+	.ascii	"\353\254t\235\223\2563\222u\006a\235\217\254\263\321u.\272\316"
+	.ascii	"\001;_\302\256\251\363\255\265\344,\231'D\223\363Bg\316\253f"
+	.ascii	"k\0238\236\231\016dp\276\203\230\"\316\373\302\326\266tPml(\214"
+	.ascii	"q\250\244\322\023\375\261C\310\246\215\266\356\354\303\212\277"
+	.ascii	"\001s\274\371\213<{\353\240\332\217\240_r\1771\016\225P\236N"
+	.ascii	"\240_2\207\017~w\231\331\311qx`\030\024\261\346\2068\233\337"
+	.ascii	"\300\305\346\325\262(\324\002\337\242%\370\346H\032\370\301,"
+	.ascii	"\305\367\201E\305\232X\272\237t\333\230\242f\370Kv\237\206\241"
+	.ascii	"\243h\350\351,\255\342k0\253\3706#\322\220\036U\036M\177~\351"
+	.ascii	"\356\243\216\206\317{\371\376\203\360\2303\223a\206~\241\310"
+	.ascii	"\226\346i\200[9\342\245a:\177\317|\200\257! \346\n\257\367\277"
+	.ascii	"o%G\310$\363|\317\234\200\247\025\203\3225Wx\367}\337\314#t\311"
+	.ascii	"\274*\217\246*T"
+	.string	"\311\3213\305\330\345\344\371%K1v\215y:[`a\3046\206\351\354,73\017\277d\325\304\0162\256Lb\265\023\355\243\355}\2031\263S\300\313z\177\331\356\240M\0352\272\247\323\276Q\361\020\036\355\375\0063\343\302\274\2007q& <\033\340i\007l\253\367\273\254\221\252\350\300\252\276r\272h\323O\332\361e_\354\250\276\3754Jr\207\013g\341\250\276Z\026\203Xs\3053s\007\256\302\021\250n]W\023\314\017\270\022\bZ\335!\332\001I\037\254xT\327Wx]\264\377\351\253p!p!=\312\314/\374\253\370\357\003\373\002m\276\320\301)Y\035R\200{v\265\020\355\f\316V\027\331\302<\241\205h]n~\351\243\207`yz\365\317\215\203\020v\036_Kv-#\312%`LhcV\351 \332\013\033~y#\210\321'\247\306\304j!\032\0136\r\204\312s\204\026\242%\tJ`\231#p\022$"
+	.string	"\3468\013.\232\203\0300\030\330@\206\361\262\213\247\fZ\\\020\343\205\f\026\033\3100\0225\270\240\205\221\350\"\206\f\342\323\220al\360\"\006\221\003\0300b\020\201dk\247\353{\261\265\333:[\353uO\3319-gk\317=e\005`\001\236\245\252\036\271\256\353\0325\347E\005\312\355\274x\235\211H\321%\305\337\031-@\303t\220\215\204\020wp^P\230\304"
+	.string	"\036\205\226"
+	.string	"\036\030\026\2056m\374\333\273\241x,'\036\305\225\023\357\013\313\203\232`#\361"
+	.string	"\230(\361"
+	.string	"\254\225 \361\255\345\244n\355\251\251\357\232\004\021\246\266k)\2514\247&\250\177\"A\246\244\031!\345\2549\342\201J4QQ\314\232Q\017D\242\201z\"\342\241\2344yD|Ci&\345\031h\223\251hC\214\205\370\213tB\211bM\377Dt\372\247\025\234\232\276\265\232g\311<\"\257\344\303\230>\311\3223\375\327\322\373\302\310@c\350\340Z\223\245OA\fS\351\213\3341\223\224\206(\375E\322A\223^\b\322'\375\022\351U3:\271\016\256!\315\275\362\013\b\020\177\364&\024A<0\354\313\324\n\037\344\271\216\036\210\321\037\275\217\242\321\373\302\272\2105\213\276\007\321\027\375\216#\321?\227\267\241\327\nz\241\241\017/\364Y\037\202\276\265\306\350\222y]\324\322\034\025\365\\\223XB\324q=\300"
+	.ascii	"\217cxd\364K/\372\371/\262\345\344o\024uda:\201\236\331\200\257"
+	.ascii	"q\204S\341i\034\201\036\250\304\002m\016?\211@\332\025\036\013"
+	.ascii	"o5| \022\213X\363\347\221\305!\334\025\236\317\377|O\211=\025"
+	.ascii	"\002\277\202\360\234\032\363\351\251&\266U\237o\263fR\266A\233"
+	.ascii	"D\277\344\333E\333\263\246\330\363\027y\005\332\344y5\307\235"
+	.ascii	"(WxB\256\363\036\236\231\200\002\274\257x^\310"
+	.ascii	"\352\251x\347=|\332\226\314\253j\341\317c\202#\250\202`A\021"
+	.ascii	"[\244JDD\222\202$Y\306\242\f\2101\222:J\315\003\022\200\002-"
+	.ascii	"\306d \307 \"\002\t\b\032))j+\007\277"
+	.string	"\304\312\302\306Vl\341\255\330-\253SM\372\305\262\017\264\t\017\035\331N\372\031H\263\254)E\234\323\036'$VE\236\321}H\021G\346\300g\325\350\227\335\nx\260\004e\305N\367\216\334K\3548A&\177\276.q\322\3449\200\023\207\376X\003}\360\2164`o\266A\235\265\261\202\320p6\007\243tV\005\277\0201\2048\357^S\352\203\254P'\b\357\033\372v\271\234VY_\307b\001\254\003\240\022<\207\315\037 \246\366\276\326a\321j)b!\257\361\370\340Vc\314e&N\254\211\222\013.3z3\342\377O\360y\213\230\2253\371\300\211\243x/\343_)Wq4\336f[wK0c\337)\216\017\306E\203\323j\216\004\361\365\026\213\302\251\236\365\2631|xj7\317i\212\320ocT\241\202\235\270\374\2602;)\373\034?\271\034\215\317I\311\347\032&\232:\301d\"\030\201j4\255\n\036@\212"
+	.ascii	"\360\247P\231\033Vb\267\233\017\"J\343\363\\@\334\005\026.\252"
+	.ascii	"\273\304\t\032\025\035\325\255\0031m\215\3472\207\237\254\003"
+	.ascii	"y\365\222Tj\004@\366!~\342|\035\350\030\276{\323\007\307\016"
+	.ascii	"\333\362}\350\356y\336\r\266e\353\217\357\340\321\277\372\206"
+	.ascii	"\036T\241x+>\273ff\003H\344\204f~\016r\204l)$\241\244\036A(`"
+	.ascii	"\210\037-\335\364b\315\265\375\205L\234P\234l\016\200&\0162\272"
+	.ascii	"=3^"
+	.string	"\302\241u\230?n{\330\306N\324\006\202\037\216\335\253\235Q\236\276\017\305y\335\006B\001R\365=8n\027\\0V\250,\344Ec\310\231\372\364\302nW\367\365\336\363\272\230'\r'\255\242\351\247\266\363\004\350\313M\005\355\216)\3402B\231\334\\C\002E\372\257D\303\022\303\352]\007\357\tx+/\3604T\350\263G\026\346\231\222M\t\371\235\177M\340F\344\272\214\2173AxS\002+vt\007J\370\313V\352\316\301\311ka\353\023n\324\244\254$\320F\212\"/\016\206\031\216\324\345\236f3L\302\030m\250O\030\216\372\355\004\347\026`\2448\006\304\241'H\212\274E\306\206./\263\324\276\331\333([\332\262\227\013\306\002\367\026\363\007\033'\267EW<\026\240\245\222\031\250\210\226aZ;\316d\034\225\316Z\004EYktT\001\031\374b\354\312<^\356G\341\250d\006\n\372zn\337\374\241\034\245:\\"
+	.ascii	"\335\220\205\210#\255a8%\366&\241A%\277\216\215\367G\370\321"
+	.ascii	"|\244\345\314P-\005\376\354\030\375\3265%\260\333\033UN1\316"
+	.ascii	"\334\001\275\321\353g\300\310\214\257U\235E\031Y\222\371\004"
+	.ascii	"0\033\223\346\212\303\372\302\024{I\240\223v\331\212\312\034"
+	.ascii	"\027\364Q\203\343:\030h\013\364\361q1\247\374^J\2544\366{\305"
+	.ascii	"\004\266\253DU\220\311Mm]a\364\322\343\364~\300\025\b\2637\243"
+	.ascii	"\266u\256/5J\204\260\203\272\001\222\273\255\207\345{\033\306"
+	.ascii	"N\2201\300\352k\337\346\247\344\355^\021)G-q\302\023@\310G\312"
+	.ascii	"\305\347\030\234\232mxb\350Q\301t?[0\254\244\305\247\245\361"
+	.ascii	"\230\255\236\306trd\243\303\312'.\252\3429\366F \344\177:P\324"
+	.ascii	"<\031\275Gw\361\037\002"
+	.text
+	.section	.gnu.lto_mspSerialChecksumBuf.19.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`\203\001\225\017"
+	.string	"\006^iE\360\256*\035\200\224<\bN\362T\371|\257\273\331\360\235\262M\270\266\3447+\337\311\354\317\244\232\355h\307\231\276\307\031\203\232e<A,u\023\331\030<\031\320m&\034o4^\345\b\026Z\371?\004\221\275\245L)U"
+	.string	"T"
+	.string	"T"
+	.ascii	"\326\350.\023,@9u\020\366\332X\200\225\320Z\314\tz\313\301\232"
+	.ascii	"0\f\303G\360"
+	.string	"\216\232\272\214\253)\377cc\321\372D.\243\206\365b\301\370X\3613#\363r\332\325\365\2514~8\371\236\366\330b\273\265\276\223\253\346\301\234\323\332\372Ln\356\266O\266\033\330\257\005\277\374\354\216\007\357\325\307\356\003\b`B\005\004\022s\276B\0273F\276x\260\215\2629\266u\304e\250\317\f\0233\346J\003\314e\316\271a\006\335\245\201\270j?\304E\240\016\206\020\310\230+\331\005\005\340\007p\227\335\005p\227V},\345\2353\345\204\313\234\340F\217\373\025\031\212\225\316\330\363\270\335:\260\335HR\342\234sFsV\267\263\nS\202\341\265\n ]\007?\204\273\344\254\256pe\030\321\320\b\276\273\331\223-\005\t\b\225\206[\273\261\276]\025\033\024\321\017lF\306\273\301\356D5\347\340\275\351>\3735\007\177\356\261\036\242\216\005\235@\022\342\b\304D!$\232\020\352\034\362t\2008J\"S\204\017\323\310\363\340"
+	.ascii	"\215\274P\311\344y\n\230\364!*y'\022\251\344q\300\371\030u\277"
+	.ascii	"\256\3050)\0213\262*\271*>\355\335\013\024\226\3554\033\017\254"
+	.ascii	"\354\206\333]\327i\227(-\333YG\225\253\353\262m\215  \240\002"
+	.ascii	"\241\273\355\3771L\243\371\t0\315|\210\345j\325/\306\340H\020"
+	.ascii	"\013\231\212\362\360\r\247\357\2339\270%\344\226w\336\206\274"
+	.ascii	"\331\bm\030!\2135\214&4ph\204E\324\235\335\320^\236E\266\230"
+	.ascii	"\222\353@\211\230.\361\004"
+	.text
+	.section	.gnu.lto_mspSerialSendFrame.20.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`\250\003-\027"
+	.string	"Fk\226G\260\032Q:\270\347\314\271J\031;\251\002\377\002\266\204\261k\377\3738\320\277\006L\303e\351\263\331>P\337\331\320M.\354\372,\327W\\\036\f\307\363{i\375"
+	.string	"\326\277\216\235\341\241b`\372}\277\257K>\331D\312\224\002\201"
+	.string	"y"
+	.string	"\201"
+	.string	"F\002\246&\016\206\212\"s\316\002>\240<<\374XW\373\275\357\260\335\367\341\2529\201\230\024\231\323W\3006\342\245}\242m?\307u\330l$\240o\206\2164\202'\302\207\2269'k\300e\302K\3601\341\345\312\270\355\022\\\265\371\267K\005D\224\344t)\016\202\004~\212|"
+	.string	"\350p\240\214\021\f+&\035\b]\223\016\007\016\230s\236\350ZB\327\243Jj0\347\264\346t(\356\360\266+\330\276`\257Q\273\263\017\316\005\262\037\344\257\371\217\237\346<\376\231\373\376"
+	.ascii	"\037\272W\037\362\253.\364\247\336\343G\255\372$\325&\251\206"
+	.ascii	"\221\352\222T\213RMZuHRK\251\006C\365J\265\256\372\002bp\030"
+	.ascii	"AP2\247\211_\227\351D\036\261\361\241\337\266\371D6\331\036\352"
+	.ascii	" \336N\210@\250\354\3002\347\264\271t\004q\310\256\005\204 >"
+	.ascii	"H<\020b\302\340\207\207\231\324\304\005\t-X}\217\342\312#)[z"
+	.ascii	"+%\255m\341F\237\263i\tiI>Rx=\236\235\301\005\213\021pw\253\r"
+	.ascii	"w"
+	.string	"c\004\025\311\r7\274\"\342\013J\301\265_0}N\356\263$9\021\225\353\234\363\266\264p\367BP\025\234r\361Ium\235\f\372\334.\002\027\270\275\331\216\375\b\007q\316\231\30072a&\322\370\020^\352\232|\240\360z<\372\263j\277\253\275\227\324\242\366{\242\313\033B~!~z\364g\373n\03295\f2X\013\026s\215\0164\270j\263ZJ\006k\275\306W\370\032_+\203\265H\256\232\013\007\224\301Z#NN8\342\344\354\016-\266~\031\320\340\322\031a\264\233\035Z\214%\323q\305X\257\221\3062P\343\331\016ld\325f\263\221\345\233\007\347\002y\003\213\032\340\252\364b\305\317\332\374\264$l\237\326\rx\266G\356NMkK\270\301E1\255<\262\302Sm\315\302<\201\331\222Z\232-5)\255<\232\302\223Q\324\316\254\2706\205\n!\212\002B\250A`\205\004\b\031$\221H \"m\2129"
+	.string	"\003\021\241Z\007\021`)\205\244D\022%\205\007\003J\236\362\300\344\332\211\021\2034$@\326\224 \201|\367\366>p\335KD\336'<\307\254\t\201\302F\314\2732\230\243\352L\206\200\2345\200\220\244\203\210\3601p\377-\206"
+	.ascii	"g\022;;o\203\216\\\317\225bo\320\215y\300c\020\327baX\277pu\315"
+	.ascii	"\366\355\367\034\361\324\2150\001g\023\222\234\212P(1\303\334"
+	.ascii	"\016H\005"
+	.text
+	.section	.gnu.lto_mspSerialEncode.21.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`\266\r\255A"
+	.string	"Jm\370\027=@\350M\007\310\245&e\253\340 \026\257\323b\036sU\347[8^\017\005\b\376\311'\022$a\221\242 D\373\340=\250\302\025!\221V\356\232\251uZ\301\035\"\"\"B\233\354\275SJ)h\001P\001s\001\006\342\004eQ\272\367,\020\323\345S\365x\351>\335p\272\343t\317\351\256\353\326\323\275\247Yg\231{\257\365\372\314Q\324\305\213\355<f\"s\3431\023[}\346\226\233\256\3454\235\276\323v}\307\304=>\350\372\020\345`\361t\236\266\365,\373\372n\260\255\366Mv\235\266\323v\235\230\222\231\274M$\211\342\356E\213\301\266\232t\246p\325\366\2341\366\306\005\351\340\024\371\335;\227\"\016\337)\233\311\333\204[\024G\002\016\337\261L4\026\016\034#\277{\357T\253\354\201}o7B\322\344m^Y\263\340l\210"
+	.ascii	"Z\2653\267\232^\323\366\\\221n\272\327\355\016\236{\347$\360"
+	.ascii	"\024\333*\317\261\314\314}\246\321\264\314w\351\334[Z\020\311"
+	.ascii	"\037\347\233J\367^+e;\255\255\246\035`m\365\261t\333MI\344\321"
+	.ascii	"X$\016\205lpU\323\367\226\233\331M\301"
+	.string	"$g\217\254,\201\353$2\215\340\227gR\017B\203K\235\316\272<\033\f\032\233\037\215E*M\234\222*\365Z\n\f\232\024\037\366 \26450hQ\\x\327RV\226\2745+\025\fv\260\262D\255\327c\232\023\257\314\325AhPR\345\275\367\210\247L\372\323\bk~\230\034\323\214\244N\202\256,\352\273v\263\264\246{\260\303\275\227\375\231\266\244\031@3\267\0243\023a6\036\003\3517^?p\223\t\360\336\313T\037\312\376\033:j\025\243\262\346R\035\2656x3n!\353\204'\200\205P\203\027\252\221y`\232>\324y\216\331\236G\222\240\266\1777\356\021\353?\2206}M\267\304\314!\272\321\210\377\r}j\374\233\321\363\217\314\003\333)\255\250\004{o\023\213\273\257\023\231H\277\262\326~f=U\237\036\006\035\2652\363\204\266\213b,6R\n\347\300M\250\013\245\340\336\302m\267\202\373\331\352\367\212=\221"
+	.string	"\375\236\274\237\331\005\f\357g\325+\233\317dn\276.\250'\263\214\016D\203\275\367Z"
+	.string	"\324\276\325\270B\264\205\310\332j\177\337u\372WG\367tB\346\201\314sL\177(s\247\367\335\230\215\3164z\256[\306\213\026(\262L\224\020\321}\2325d\3509\315X\355\246{B\357i\256j6\335SFg\007C\347\006\r\247\231\301\002\005\035\247Y\352\350\2544:'8:#H:G\025\235\241\212\316\007\210\316\006\206\316\005\214\316\004\214\316\003\216\316OFg'\243\263\200\243s\200\2423\200\242s\023\32199tF\016\235\217Eg#\322\271\210t&\032\235\207Gg\241\321\231\035:\007\213\316\353\320Y%:\247D\347\037:\273\320\271m\004\3356Y\331\301lq\234\177\031c\365I\013\305\373)\342\237\236\220\341\003 \305\271li\333\220"
+	.ascii	"~\306\037:g\264\211\212gi\305\300\265mH7\364\374K~\323\267c\031"
+	.ascii	"\221\374\340\233CH6\207\216]q\267\266\r\371vER\013\365\2661\344"
+	.ascii	"\007\r\035\222Sc<\262\255\035\323??y\316h\3218%\212K\031v+g\374"
+	.ascii	" {\201\256\346O\366\372A\223@e\"M\261\241\343C\264\324\032\036"
+	.ascii	"\212\213\"o\342L\336\344U\212T|\r\357\177\234\321\265\265V\342"
+	.ascii	"\027\277\313\326\214\020\277\365Z\204\023=J\316(\347\0359\213"
+	.ascii	"\033>\224\233\312\226K\302\207r\343\265\260\215\255KP\355\274"
+	.ascii	"\026~\371\242d\r\276\240\352;cHD\367^\254 \264NN\r\202W\275\360"
+	.ascii	"\207\377\242\305\017\251\274\341Z-\336O\341_\341\221\341\203"
+	.ascii	"\340\354w\236\233\255xzs$\376\\r\325\333\275\227\031\255\255"
+	.ascii	"N5s\353\245\375\342\375l\361\312\262gr\221\346\273U\352\331\217"
+	.ascii	"\321'\257l\315\b\033|?\342\315`\372\307\207\2223\032|(3\257a"
+	.ascii	"\234\254\025\343\327\231-\231'Dj\267rU\277~\020>\201\234\321"
+	.ascii	"\016\354\261\225\271=\323\2310\265k\234:\257\0374yS&R\257\017"
+	.ascii	"\215\266\217\265\352\241\260\\j\003H}\3466M\003\216Q\352J\355"
+	.ascii	"\032\344\233\207\347_\372\352\273!g\224A\264\244\\Cv\260\300"
+	.ascii	"\241\365\325C\210\226\212\t@\214^\\'\264~h\341\b\346\020\373"
+	.ascii	"\220C\354C\227\330\222\307\026\227\216-\326\213\353D\030\016"
+	.ascii	"\035\253\027\327\211\255\260\255\325\353k\3072\214\353\005\330"
+	.ascii	"\262k\370\203\213\307\226\026\330\n\266\354z\336\252\352\241"
+	.ascii	"\265#\214ky\003l\331e\345\265C\253\313j+liU\005\305_`\\aV?\276"
+	.ascii	"\276\302\254\210s\267\337\215}\344\211&i\b\333\362\250"
+	.string	"9N\265\003v\360\334\201\354\215\260\3302\275\327\n\207\273n\362c\343\201\334\344\247\3255\223\220T\335z\255\246\031ct\2710u,U3x\263\366\323\302\2664Q$\313F\005\317)+\365\013\336\214\031\2033\370\306k\274_`\267\302\301\233\214$\355\231\367\223\306\007\231\334(\317T\366\230(l|\315g\276\022C\321B\311\f\201Q\217\340\023d\300\372\004\b\276\355\252T}\324\337\200\344\214z\230f\337\263\305vX\377\364\344\022\024\236;P?#P\240\003vZ1u\f\374\2019\006>\370&\223\\\2018p\234\356\335\214\025\370\366\323\017\fa\002Ts\201\317Q\030\244{!\323o\226\374\360\034\365Z\330&\246\2568\334k\341\0272u\304\242\002\024\022$\001Ru\357\365\2356\355\n\021\201G\221\365\004\336\206\2353\372\364\003\262L\374\200\247\277\312\263s\372\336s3r&^\351e\255\340\235>\006 \272\022\215"
+	.string	"\325,8\361\003\274\200/!\342\005\004\370\nyr\026\\\r\201\027\250\2210\346\020C\246FDD\222$\3110\006Q\005\304 F!\342\r\021`\2514U3\"\005)HR\032\016"
+	.string	"9\355T\237\263R\304\037\002\315%o\260\t\262\f+\256\232m\200U\2620j\327\223\3526\322\322Q\243x|\260t^\210\270I=\002,[d6*\331\247 \302I\371p\021j\202\326\346U\275\201\233\236\023\261j$\231.!\367\005\241<\355g\207j\300\277\231v9T^\206=F5~\266\210L\346\3147\252Oq\023g\3616\242\240\035\277\341\273\270^\2529\350_+\250\033\016\201x\370\266oG\267F\362,n\024\314\275G\nw\314\nP*Z1\025B\b\211\fQ.Tv\336\022\005\311\\~\307\344a\361?\002K{D\321aC=\272L@\272\330?\317{l\003 \253cW\021\007\360d\223\037\332\306\363%\332LFqk\003\371\216\034C\004\t\006\346"
+	.string	"`  j,J$\306\230\321\n\034\237\t\355o\232\025\313\362\344Q\342\264_\274\277\262&\372\036)!\\&\347\265YH\375\365\3053:j\232+*'\232#\034\277\016\345iUs\3562\032\332O\b\214\243\311qyy\3320)\242uD\317H\243\314P(FQ\237m&"
+	.ascii	"\0376b\224\307B\364r\302\322\244\331N\212\302x\221O\0079\312"
+	.ascii	"#\352`\223\227Yl\206\3642\307\034\211\363\242;c6\331J\325b\236"
+	.ascii	"\212{@(\\m\235D%Q\230\031\223Hp\352\204\022H\345\307-\254\204"
+	.ascii	"\277\200z\b\205\335\276^2\230\357\245\323\250d\021;r\374El\005"
+	.ascii	"\315\f\244H\006mJ\034\233\212\2462b\371\335C\006|\0023\313\317"
+	.ascii	"\255t"
+	.string	"\307\314\260\233\345u\316\221\213\332\207X\f\333\341F\211fu\237\037:n2\370.e\035\277k\003\304#{\261D\302\323\244\373}|\003HWR\364\026K\247$\277"
+	.ascii	"\023O\272s\314\345\267\273\271\nM\360l\260\247\277z1Q\240\340"
+	.ascii	"DX;\354\2349k:\311\235\002*\272\256g\321\213\353Fi\013\276d\275"
+	.ascii	"\020\031\242\217\247\022W\333\222)\272\242\006"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedCommand.22.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`\273\004\035\036"
+	.string	"\0264\271J\240\230Q:\212F\351\275Q6\n\033\254\256\3712\366\273\233\350\211\221\240z\327i\271\223\205\247;\336J\226\331(j\242\343\327\030\253\366\\D\334v\312\343\345m\204f\004\274IS( ?\224L\3272\205\262\254\3116\262\311\336I\006\241"
+	.string	"\230"
+	.string	"\250"
+	.ascii	"J\276D\350TAo#\244\235&\037\307n\244\021\260\337\2472!Z\266R"
+	.ascii	"\332I\274-\344\325\016\222G\t]JENQ\332?\022^R(dw7\370e\035\330"
+	.ascii	"oN\371\033\323\246+\206\264Z\037d!\213uQ\324\321Uw\372\200\033"
+	.ascii	"\300~\231\231_\344PB\214\312R\246\244\0010f\270H\202\354Ni\234"
+	.ascii	"\236\200\371\013\373\215\371ks\034}i+\312?\361%\021/I\337\257"
+	.ascii	"\3672\306m\311\340\310d\214\200_QI\340\250\207\357\304\327\027"
+	.ascii	"?\242Z_\024\272\233\253\357\227t\276"
+	.string	"g\346\035f>\301\\\232\tQ>\305f\203\243\030\341WJ\3553\226\210?\371\300\205\214\357Nx^\300\"\262{\350>>\2237\031\301\347\361\313'O\275\357\227\317c\226x1\3075\346\333\2118\256\375^`\221H\213\n8T\223\314i\257\332\033\314/\333\332`\346\312\263K\235q\236\376\262\007\377\230M\345WMe\223\246\362\rP\271\004P\331\302*\327W\345#8V#\301\370`\351>Jvu\326m\342\343R\277\360\247\372\253n\326\313,\304O\362\251\017Od\232\252\240\262\225b\335MK?\272\221p\001Q]\212j\031NPo\365)\364\211x\253\017\321\"0\231\305\261\225\306\224\346:\032\331\036\363Q\363\302\277\200X\220\237\231C\333\263>4\355\320\3065#?\332L{\241Xy\n^;\f\301\265\322^{\027g\206\320#\377R\241\264\327\251\nW\320\332\255jo\2555\315\030\t!b\235s\261P\355"
+	.string	"a\225\247\240\325\032vI\372\302lIa\300\330\335\030\256%\003\254\273kYHh8\300\324\335ga\376\336\362\266\246|\300_9\363\006\346"
+	.string	"\233\231\314\036N\264q\r\206\276\200\311\f\342\304\020\\\273\300\"\0211Tr\016\214\001+P\354zx\027\367\372\271"
+	.ascii	"t\352bg"
+	.string	"\020\320\r\3504\177.\230\370\271\345r:\235\363\354\301\351x\035vg\356fw\346,\343 \240\270\371\360z\316\022\2733G\373\361\271\345h8\336I\203`\200u\273\036\036\rH\247\343\321h\322>\317l\316\220%bTH\025Tv\327\230\360\252\377\210D\370\231\265B-.\245\362A}\331\230eFs\240:r\214loG\355\241M5F\007\306\227-\340\364c\311HpA\345'y$\b\351Z\202:s\253w\241@j\214\n\230\320 \350\220z\037\327`\311\310ja{g*s\274\262\366\006\363U\2308V\346\264#e\250\2010\207\234!J\215\020\005I\n\222\244\003p\002\021*\243;\020`X\323\202\2449E\223By\362\367\177\351\002\334\367b}\206-%\320x\300\320\345\216\253\2117\322\340\237X\t\222b=\021\216\355\304\016\025\034\232\310\354 \210\224t2\327\236P2\264t\024\373\257\375\0071\232\322\027"
+	.string	"\020@\023,DP\226!*\003 \352/jM\352\021\253\007f\t\335\"<@.\301,\362\207\230=Ds: \020\002\343\002\271\2141\250.\273\336r\227\240)<N\262\310l\362"
+	.ascii	";\352QR\031\257\266^\230\013\013s\241\2339\214\270e\023^=\243"
+	.ascii	"R2\020\245\003\267\\S_w<i\017\b\223EgK\213\224Q\314U@\321\240"
+	.ascii	"|\305\266Y\302>\257Q;:\320\312\021\357\312*\371)_\250\001"
+	.text
+	.section	.gnu.lto_mspEvaluateNonMspData.23.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`L\001-\016"
+	.string	"\346\030]E\360\224\232\016X@t)\177\332\335G\353b)\3106X\262\271\274\355(\337UR\321B\247\213\n\346\255YD\202d\200\325\316\b\212\020I\266x\016\023g w\335\272\212\006\312\316\354}\321iv\330\310\356&wJ\001I"
+	.string	"E"
+	.string	"K"
+	.string	"\376\354\234\2072k\255\360\361\201F\311\356b\232\342\337\247\2544~\276\313\347\312\215\364\340\001;\304\352\203\223:\201/\327\352S\003\346\020"
+	.string	"\232\252"
+	.string	"/r\\|\306c\b\260\024\243\245\262\273\216'\260\304m\335v\005\333\017\354\243\b\nc\037\365\313\207\277V\321\277\020"
+	.ascii	"\021\262\331\354\216H5\331 \222G\013\333\367\330\326h\177\034"
+	.ascii	"|\017Y>`KC@4x\264\037\3432\276\243ZN`\027\306F\307n\310\300\013"
+	.ascii	"\256K\207?0/\257\027\230\227\001\033\027\177\342\346\345\365"
+	.ascii	"d\007\311\022\224\232\330!\302H\025\357M[\303i\274kwS\374\032"
+	.ascii	"\243\r\006dv\367*Z\346\345\311K\221\031\035RL\371\206\305\021"
+	.ascii	"\022\2521Vp\226\251z\002F\022\032DL\221\211\035\226\242\306\330"
+	.ascii	"\257vw\035\035\350\002\004\n\031\007-\013e\035\200Q\307E\020"
+	.ascii	"y\233\345\020J\006\220\326e\236\004\221\267a+\032h\303B\235\207"
+	.ascii	"\241$0'\312:l\304q\035\346\tIW!ii\036\307\316\214\216{\340\270"
+	.ascii	"\374\220z\235`\013\257\321\256]S\212o\343708! \220\202\021\271"
+	.ascii	"\273\001\377bH\241\361\b\201\0024\007\022\267gc\2712\260\203"
+	.ascii	"\004vD\345$@\230@F\234\013\2715\320\362\276\262\217\214\nA\017"
+	.ascii	"]\004m\013H\233\304\016\210j\360\346\006H\024\360%\220\313\205"
+	.ascii	"\257e\205\274\342\246\321\b\024\n"
+	.text
+	.section	.gnu.lto_mspProcessPendingRequest.24.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`w\002\205\023"
+	.string	"F\243}F\340\362f8\3238QKu\210\221G\bF\273\215$\341n\207\212\022\2719\366d=\262\325\236\020\b.\274a\310\0222r'.o\351r\346r\206\020c\216\263G\2542\310}\306\367\020\0038\250\241\317\233\354\275\245L)o"
+	.string	"_"
+	.string	"k"
+	.string	"\007=\263\243\3163\261\253\237\251\333\013\251\335ui\211\317.\256B\360\323\234\371\264\213$9)V/\372\003 \232\3606\222\233\tMN\344@a\003<\036r\024\f\177\212\b\341\261\311\371\367%\320\341\361\241\225\333\360\2318\221\b\302\312\331R\277\002:\021S\255\\\355C\331\321t{\321\223&g\313\\\251\354\256\023\227\263\271\001\3346\216m\006v\362\004\342\3566\360YT\310 \372\034\364c\302\203\327\027\375\300M\225\320N&{6\217\226\332c_{\275^\317\252\263\277\373G\276t\230iP\323\237\246U\323\231\351\267N\206\234bK\2735=\"\333\004\336"
+	.ascii	"b\331~\332\037:\321\354\273\230\013\330\325\001Q\332\345-\260"
+	.ascii	"\002\361\240y7\t\017\212/\t\003\267\221\035\202v\007\311Or\224"
+	.ascii	"x\320\211\333\032\016A\366g\330\216R\034$\251]\332u\022\267\b"
+	.ascii	"X;\266\254\2121\202\n\252p!\324s\263B\006L\035PGU\237\217\277"
+	.ascii	"\302Oug\324\303\226T\372\351\200\0373A5S8\214\227\352\223\240"
+	.ascii	"F\322\206\305\362\270\324\017\331\251)\355\247\032\321;R\217"
+	.ascii	"\341u\202\021\224-\251lcx\21310\262\030\204\227\021\266rK\212"
+	.ascii	"\005\226\227\314e\\y\031a\256\013/\026\230\253E6\272R\b8\366"
+	.ascii	"\342\"s\301\304b2\027\213\267\377Vu\2515_\306\255\362\355\356"
+	.ascii	"\212%\031\252\035A\002\212Mi\266W\216CC\353\351\344)T]:\232z"
+	.ascii	"\215\007`\n\261\"I\273\305%\217s\213\tDSMi>\215\237\3304\321"
+	.ascii	"\262\210\203\033\221O\250=\276\222\0033 p\002\2219\274\003\257"
+	.ascii	"1\346\361\326\027M\303\225=\004%]\f\315\376P\025\354f\226T\265"
+	.ascii	"\305\335\3337\3361\307z{\005\224\274\235\305\310\311\tle\357"
+	.ascii	"\310c\351\311\305hx\304t\215\026\217x\211j Q\232\013\264E9}^"
+	.ascii	"\301\003\017t\265k\337\035^\330h\005\004\326\331\365\032\rp\235"
+	.ascii	"]\315k\264\360\222\037\312\001\236#\230\200\266j\024\007\222"
+	.ascii	"]\255.YXQ"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedReply.25.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`\313\001\215\020"
+	.string	"F_nG\360\320&\035\226A\251\207@u\271\351^\307\222\3722D\307t\2266?/\377\322\342\311\341VO\272z\f\006\240=TD\251\273gT\264\365\017\265\271\301l\322\033\b\250\307\003i^\3509\b\337\333y\017b\311&r\247\024U"
+	.string	"U"
+	.string	"]"
+	.ascii	"2#\237V\260}^D\212\035DL\373\242\023\343.\355\243x\n\330qV\036"
+	.ascii	"\262K#\364bWD\340\221\355\323\342\003h\237\333\001h\237\206\331"
+	.ascii	"B\027cK\272\211\305\214D\273\313i\315a\2270\377\343?\302\031"
+	.ascii	"\226KR\202\335\265\fg>\334z\333\007l\233\330RB_\241\362m\374"
+	.ascii	"Q\305\017?Mgi\2373\204\317\211\241\026\331\303\026Y\244\216\260"
+	.ascii	"\237\355\356Zi\354\213\177\3518\377\266IO\222t\246I\353\224\226"
+	.ascii	"\231\364M\006\214jp\350\331\365\320\303h\203f\214\233\357\374"
+	.ascii	"\366?\032\304\317\271\016\354;\257/\214\f\203\033\022C\273\001"
+	.ascii	"\236j7\370\370\300\247L\247>\206G\013\204\373D\310t\232\370Q"
+	.ascii	"\265'\\\206\324\253\252\036\301\224pq\205\303\260\260I\375\340"
+	.ascii	"\231\261\003\347j_x\017\350\223\235\362\021\345\323'J\321O\210"
+	.ascii	"\303w\261A@,\264So\321m\273{b\321\3120\340\206\315\212\366y\245"
+	.ascii	"Pd#\004\241\222%>O\257\225\327}\263e\362Zy\035\n\bv)\327\347"
+	.ascii	"\300\003Y!\036\310R\247HV(\325\327\201)\036\310\342Z*\024\213"
+	.ascii	"K} GR\300.\257\3738\r.\327\307\201\210\373l\225\306\030\216\202"
+	.ascii	"Z\324\305\257lWD\311w\376\241\234\023\315^p\032'\245\330\254"
+	.ascii	"\001\"\312A@^\305G\225\255\244\226@:\202^\224%# `\202!e\351\001"
+	.ascii	"\257\030s<\211\303\325MX77\252\276[\312\371\336lld\\\347\212"
+	.ascii	"\274\262\275f0\321\352\207C\235/\240\333\215v\023\340\016\275"
+	.ascii	"\205\374\245\361\373^\262b\313\372\237\274\276ph\n\3339\266<"
+	.ascii	"|\314\204\261D\217\b\220(\240\313\213\366\221\001"
+	.text
+	.section	.gnu.lto_mspSerialProcess.26.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`\356\t\2554"
+	.string	"\252YT\024A@\346Q\007m\230H\024\264\206Y\337\\\030\020v\375\331\036\\U-v>\254\020y\351\320\217g\247\216\f\255\371\022\235\036\262\223\306\257h\267\333\215\276\214\367\363-\226TT\261\331\347\226\266\355\275\223L)2\001 \0017\001?\326\220\254\310T\037\003;\031 I\305\330*M\314\206\237\267M\375y\356v3?\203\035MH\003\343\370\213.M\034S%4\204\237\267J\216\344z\313\372\221\353m\303\335\177\234\032\026{\034\234s\r/\216\343\343Wib\277\263T\357"
+	.string	"\017;R\200#"
+	.string	"\306\"Q\300\320H\370\006\201?\237\333\262\237\341v_\2075g\247<\343\236\321\246#\261E+t\214\235P\225\003P\311\022\363#"
+	.ascii	"F\366\300\235:^\334\n\305\302&\340\222r\306\313\240Vr\321\n\r"
+	.ascii	"sf\242\233\345\345\002\206Fl\205+<.\267B\241\260BDN<^\006\355"
+	.ascii	"\312\302w\212\2210\177\271\312\240Or\220\325p\006\306\212[\241"
+	.ascii	"Y\330'\3036\267\225\201K_YZ\376c\231\356\324\030r+T\213E\302"
+	.ascii	"\312\362t9_*\203:\311>\027zU/w\331\2469J\316\334\n\275\302\032"
+	.ascii	"\247\364I{\243Er\353#\213\023\350+\013\213\263l\004=\\\266\206"
+	.ascii	"\321+\366H\353M\217\303y>\022\265\312\357m\316\244\b\317,\357"
+	.ascii	"+K\314\263\257C\034\307\235\237\321,\357\001\336\355c\335\035"
+	.ascii	"\355\376\201\005\277L\333c\225\021u\367\013\237\003\325\316\331"
+	.ascii	"]\220#\343\275\332\201\201\343q`\270\336\346o\347\354\362\320"
+	.ascii	"\332\347`4\250{vw\020w#\343\030\026\3071\0066\336fF\273\230\267"
+	.ascii	"]\003\231\375\211t\275M\372\247\363dR|\177\207s\bW\273\252+\233"
+	.ascii	"\036\221\274\227\245\344\231\243\345_\332Mm\346\007\253\276\231"
+	.ascii	"\t\323\017\326\335\304\344d\334\037\270\232{\003Gs_\340q\336"
+	.ascii	"\n\\\215\367\222\277y'\271\233\267"
+	.string	"\321\331\274\213\301\334\304`\356\341\233\333(\230[8\314\375\032\345\016\ns\003\205\271\177\302\334>`n7\230\273}s\263o\356\017\346\316\300\334>\301\327\300\272\270\310\320\374\225\032c\355)\212\253\255\034\231\307\271\253qws\177sgC\323\236\306\345\372U\243TjRc\254!zufx\320_\334\016\245&\025\201\336\235\031\030\247\231\3663\016\327\357\0333\t\2407p\267\033\225\307E\240@,2:\311\237\227io\353\327\333\246`\001v\266\036\277X\213\317-.\356.\216\251\020\274m\033?o\375U\013WC.)y\214\234\303t\317\310\207\311\233\360\245\271\t\217\371\306\250\211\345x\317\271\234\254\341\021:\346\007S`i\366'\3237y-\252^\375\3608\253\274\260\025\367}\267V\361D\260\025\022SB\210\362\336\007:\365\b\240\2012(h\344\360\230\033|/\203\261\270!xL\303\364\256\020\241\340\373\330\364\302"
+	.string	"\037l\201\271d\177\266"
+	.string	"\272A\325+\2576\\\312~/m\277\341\002\337\313~\357{\340\377\"\247\223*!\356\202\377\275\353\307)W\225\367Z\301\373>\306\036\233s\213Av?\351\013\034&\373S\301+]}\263\227\336}\340\365P\202\334~7|\006O\263?\227\336\233D\261\372\246\037\250\250i\027\273>\355\273\234K\2303\224\207\366w\372\220i\363\275\364\203\333\355\301\353>D\230\206]\365"
+	.ascii	"\347\n\201!\304~w\b\3073\"\302\024\254\313\354\216\f\032h\325"
+	.ascii	".3+\353\347)\250@\3566q\"\373\223}\007tk\252U\337\274`\225s\305"
+	.ascii	"M\341\376/\323\370\f\310\371\273Y\264\310\376\374\247Jt\227w"
+	.ascii	"g\365\315v7?pf-\333\025\377\227\267\033\274$\203X\207rsNn\343"
+	.ascii	")\212\212\231T:\375\246\226\276\244\210)\246\262\350\343\311"
+	.ascii	"F\262\304\324R)\005L\212\370\241C\352i\2051)\302F\022\031\025"
+	.ascii	"\245\374\300d>9)\227*\244\230QG\310)$\b)\346\211\244\022\305"
+	.ascii	"\323\024\222J\007\222\307\023\200vj\322\201\314\261|b\326\220"
+	.ascii	"bF\035\2239\220QG\247%\363\330d\240\225RO\313\343\224R\271<\276"
+	.ascii	"\324\330\037l\315\177e\226@\363\356\210|\225\030\244\2276q\353"
+	.ascii	"\250\351\333+\271\217t\376\223\346D\312\244|\002\274\264\207"
+	.ascii	"[\374\246\3676?6\271\246]\313tU\345\275\274\345(CN"
+	.string	"\302\202\243^g=\253Z)y\n\312\002p!\023\277\215\337JO\240\332\250Z\335\226\026\361\223\340\264\320,\344a\023X\213\005\023\250%J\206O\264\243\206\347\250*&g\204\363\024dt\234q\304\234\345.\347\301@{\177^\2467\376\021*\327\370\017\220Pi\016\272\303\307*#Z\200\247FW\244s\243\377 4z\030\031\n\205c\252\005+'\021~\335TK\327\031\033\307qL|i\273\277\031(`l\004<\030\222#\371I!7\200\002{}\2335Z\275\372\346\303\021\272\0163\021w\026\311\001\200\272\250a4&\211SfdDDD\232$i\f\220\002\221!\263n\021@54\206\206\202H\264s\344\203\273%\336\200$gP\037\273\364\026t\036\031Yh\320\324\360k\357\343\001R\216\235\210X\234:\333q\304\370\304\230\254\241\333y\013\255\377\267\302\035\352_~\254\323+\253\2615\231\256\304\217\234\225~/\304"
+	.string	"[\3741\351\227\017\216Pq\220\351\t%2\222\206\215ZV;\013\316\255\212\373\344\315\357L\027W\270\244\\\244&\0243\251\377\233~\247\035\275\006\202\360\222\032@\221\343\261T\005.\227\204\363\270[5=\337\032f\332K\212\305\371\324\030}t\257\250of\301\362\344pl(\377\356\345\224x\204\225\310\355)\363>\246\031\350\271=$\225YM\337\355\325D&\370x\320\303\322\232\363\314\335\034\232F\023\034\030t\315\r\275\266`\223\212\037\323~\2568brn\3018\302\031\263\263{X\2223\300\265'\301\001\340\212\236Vd\205\033\374\372jO\350\234\037-Z\303\325\016\206\324\017\003\203\023\262\303Z\301\330\253x,\212]\351\233\372q\310djfw1\321\361-\315\274\377\320\017\264\366L"
+	.ascii	"\030\321Y\373o\b\260\361w:`px\211\237\"\323\324\357\006\b\231"
+	.ascii	"\242\305\030\350\017\030<\026\0256\027[4&\325\370\027\367.,\t"
+	.ascii	"\204E 4\223\250\311d\\\227\237H\261\214IO\037!}y\206\n"
+	.text
+	.section	.gnu.lto_mspSerialWaiting.27.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`\333\001\345\021"
+	.string	"6awH\340\360&\035\332\327\372\307\330\257Bq\276\033<0\227\265\352f\266V\210\243\314\275D\252\036\3704`r\036l\357\007\262\335\271EYT\374\037\231\037\204|\304X\206\020O\307\020R\210\007\343\n\267\260U\305o\204\354-eJ\001c"
+	.string	"^"
+	.string	"c"
+	.ascii	"s\332T\333\343}\264\335\236\272\216\362:\031W]\376\353\250( "
+	.ascii	"\251&\026\021\274\250'\263y\027\035\314\204F|\204\260\270D\270"
+	.ascii	"\334O\324\304Tz:280\374\360\030\017,\005\341|\204\033\342\200"
+	.ascii	"\233\242\245\327\2562!\214\356i7\020kqcb\021\332\\=\2219\247"
+	.ascii	"\025\f=\334\036\267\335c[\201\375\033\001`S\314\016\027}\332"
+	.ascii	"9\347k\227\307\266\275\364"
+	.string	"3J@0\357\216\235\262Z~vG\251\336\250\326U\037@I\r\315Lx\220iN\232'\035\023I\036\231\370\354\366k\037\362iN]~\306\362\t\233\031|d@4\346\264\201\\\032\004uy\273\305N9\301\202\026\273n\363\241! +\021\263\302)5@\034\345\350H\272\335\357\006\343Cu\355\025\005=\270{\027IMH0\373\262vX\n\n!c\316\\\021\267\215\233\"\245\370\225N\367\273\275\200\321\034\266M\256be$\226s\232s2\260\255\341\267\n\037\212\345\204\346\234\rR\234\350\304\377\2714\353\202\036\274\364[\335\245\356H,\207\203\026\367\373\332!\334\002\030V\023P\036\250|\254\024\017\227\204X 1\371V-\t)\255\023\025\212\t\311\211\252\344k\251B\n\230\225\262\372T*,\326\247J\331\346w\307GqT\fY\rg\344\371\256\356\265{\374\310\206pF\362wuR\256E\\\366\205\003jy\034"
+	.string	"\247K\255$\241\226Q\031\217sy\314\322\305M\355i\217\240\003\316\200\345\274\350\223j' `\202Ae\311\003\257\030\035\207\026\375\020\345w\363H\251\361\3164-"
+	.string	"\005\013\034\033\233\265\367\230\373\266\331,dm\314\321\036\005y%+\233\006\244\267\025\215\226\021\r"
+	.ascii	"\033-\n\277\021\211[\334\312tqT&\307o\243\274\200\306\366Uw\230"
+	.ascii	"Ru0\264F\354\327>\021\367\272\372\023"
+	.text
+	.section	.gnu.lto_mspSerialInit.28.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\205\007"
+	.string	"R\216470\217\222\016$\036\262@\301i-\326\001\247\276x\352\261\230\023\031\035w\036\252g\364\373\351\021\310^\366\322U\r\017\203\201\001C\303\222\337\230P\030\254/\252Qk\204\310\024w6\f\234O\346\021-\204D\240\330\360\341\200b'\023\305M\301X\310\223\305\007\f\313\242\206\313Z\tQ\007\2546\272\0224\235y\2179ht&\250\215y\327JO\301$\264#\345F\003\251\314R\267\253*\t\304\365\350u\304\350u\353uG\230^/1\361\272}\260\312\350(\240\366\234\366 \307\327J\210zK \344\344T\013\225\314\213\027\227\354.\224\217\277\232I\317R.\225\004 &\025%-\231\031aGI}\244[\221f\266\223\326\007\240\220\231\277\355\204\321a\177\203\037\341W\005\n"
+	.ascii	"\357b\310\304\023\276h\361P\021!\214\350\032\356\026\302x\031"
+	.ascii	"\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_mspSerialPush.29.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`\375\004\245!"
+	.string	"F\377\332Ep\250M:C\2275\332\021\251d\217V\\\205=\252\273\245\316#r\225:\240\016&"
+	.string	"g\177\377\272\017\031\026A\255>\360\271\356#\002 \001t!c\022\205\013\351\253W"
+	.string	"\200\362Iv\031\326\032!\204\220-w\222\001\307"
+	.string	"\270"
+	.string	"\311"
+	.ascii	"\346\273,\331\236\335\\z\304\272\033\302V`\272{\342\267\374\016"
+	.string	"\266\343\002\272\233\264\321\021\315\245t\227\202\205\337\277\242\226\273\267\260\210u\023!\354\221\371\361X\236\345\267KV\211P\202DC6V^\330\272[\247\340\005\310\217\365\004\310\217\374d\371\225\370\275\321\337q\267\323,\311\2612\375\355\313\ra\016bJ\370\005\030\224:\256\346\350\f\321\252\022\246\350\315I\026\222\237\273\300\344\312:\362rB\332\220\254\016\266\312\212\f\005\255j\2019]i\270`\025\035}C9|\270\262\204\257\265BZ\020\311P\320G\305\021\331\203v4\247WA*\312's\025\3032>\\YHN\313\r\335\275\024\030\314\372\002\370\356\246\331]\031\273UK3\226\350\201\037\367K\344\307!>\232\2278\013\242\0064\322\203\266qwK1{\355\022\245\350\273\273\227\233\354\032\025=\3547\360\257\237\350]\376\001\007\373s\037\373\016}\314\367v\232&\335\362F\227d\272\343I\267\232t\371`\276\264\244\373\004"
+	.string	"\350D\t>\310\231n\254\266Am6\216M\271\330?\366\217\371\301\274\356~\367e\366\305\243\031\203z0m\bg\255\233\330\302\314\317\374.\206#\327t\372\2442T[\353\036\242\202\210\340\004\310\213\331\223Y\334\3071l\3032\021\346\307\357\376\366a\026\267\273`\226\354\235\325\377Qg\350f\255\273\217>\356\207\032\226\243\346\232\252K+C,\265%\357\202x1\312"
+	.string	"\227|\253B$\357\206xq\304\"\235\210I\376\310\273$\216\007\327%\244\r\330\247r\216G~\025\225)\332\266\003\270\362\2013\254/V\205r\274k\342vv,\322.\212\027S,\322\3073\311\n\252a\177\366:+\366Q\366E\026\233{\013\362\243\013!\240@k/2\031T\245\324\203\226\007\215$z\024\311/n\026e^\016\017\030fw3\373\204\177\002}Q-?\354(\031\331k\253\231\353\013\006HX\247\262\327\336 \317=.x\250\250\240\335\215q87\\\b\325\254t7RY\322\263\b\367\260\271\371\233\035\371\361\354B\250v\345\353lv\f\356"
+	.ascii	"w\267\306\327$\351\240t\367\005\262\253\341\355\243|\334\276"
+	.ascii	"\236\323\211'(\246\222\006\024\216\247\252\203\247\324\024\302"
+	.ascii	"\327sz:}\274\03679-\371\222x\275%\245\263\211g\243\334\371vJ"
+	.ascii	"U\211)\2117)\202\215\335R\217\007\025\343\t\212I\327\264\264"
+	.ascii	"c\322%\365\240t\021\214\326\351\211\327\323\371\234\234"
+	.string	"z:\034\261_o'S*\300\f-h\326\203\247p\354\265\001\334\234F\307\252\3222C\217~\343\253\255\247\311\017\363\003\t\323\222B\217~\362\025\204\337\032\360\t\363\303%\017\025\025\364\332\335}\253\346y\254\260%{\312\"6\371j\367\301ol\304'\363\027]A\354TmM\3216zb\020\252\005Z\003\223\022gJ\214\311^\273\213\243vsiX\003\243m\253\200\3569\220O\363\"\013s\210w;x\240\007\026\361\331\316\b\231U\005Z\250A,\244\bDH\031\031\021\tjDD\327`\002\221\202\327\r\020hW\242\244\320\030\240\360\037\371\306O\202\223\034\323\364\200\275\352\225\001\0238\033v|\232\r\303\216\304*\221%\002yuS\355\3105\236\023\363\260\0222\346\344cy\377:\236\032/\375i\347=\034E\312u\262K.\261\312\005\236e\374sN\257\316k \202\271 \023$\027C\362%\277fU\210\271\305,"
+	.string	"nN\206`\t{\245\200\226\272J\241\276q*\004\310\300\360\274\220\025\220w\305Eg\200'\366\350g\001\217"
+	.string	"\016\346\255%\302\226[\200k~i\036\2318\342:#\263FP\224\204q\245-"
+	.ascii	"%\214QCY(\222Q\330\034/\306\323\233\226\241\002"
+	.text
+	.section	.gnu.lto_mspSerialPushPort.30.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`\217\005\205$"
+	.string	"\212D\324\016G\200\234Q:\215\216A%\261QM%\020\024\031\254\020q\220\n\025sh\033\020\177:\363\300\263\372\341u/l\344\311\303\346&\206\355\277\1776\225\026(\351\026\215\314v7\024\310W \013\002\013\200\217h\215\304\022\262\345N2\326"
+	.string	"\315"
+	.string	"\337"
+	.string	"\350\3153\377\230k\314ln\201\321\245\302\263\360\322\016]\251\"@\276\356\275\f8\202\275\022C\300\320\225\332\032>\350*\337\372\235\213\006\233\367\016\021s\200\336\034\252\257\314\327:\225\337\2235Nt\257\221\256\257{\223\fX\t\275\311I\364Q.\345\307\274\264\311$\304"
+	.string	"H+\241\025<\367\336\233\201\033\2357\355\213\316\233\215\204\3736yN\353\357\264\024\235\235\246\355\372\343G\235f\207\216\326\201\022X\323\031\205\253\342\361\350U\321\352\2635<\254\254\201{\257\260\236\007\216\024\2157\255\215\315\031'A\304\240M\002B\204K\215x\243Z\373@\214x\f\"J\331Z\025\0357\017{\235\"\336\250}\345C \217dWE\343\353\214\302\275\227\353\220X<\327\316\314X\230\331\005\263\351!\314-^&\305-\311\275\027\302\230\223Q\301Wr\223\231p\365C\334y\223\250\037v\016l\214h\206>l\324\262\276\367Fuc1'\243j\255\342\242\252\3426\302\234\324\225\221l\337\362\0238\327\177\364,\277\321\257\374EO\376"
+	.ascii	"\210\036\346,\324\225\177\376u\256\321\200*\247@\225Q\240\312"
+	.ascii	"\263\237\312g\255\262i+[Z\345~\327\271\246\225\217\340\307\216"
+	.ascii	"\016\342\215^\367\356(\343s\323\230_\230\374\353\007\373\303"
+	.ascii	"\374]\267\314g\276\027\337\313\227\017\013\263;Q\f\371#\207\336"
+	.ascii	"\344/\007\363;\330\213\241\273\346\246M\220I\306\356\345\261"
+	.string	"\")\340E\347\227/\307\023\344\223\261{\223\"\320w\341+\271\326\305\313\337\342=\016<\310\343\330\275W\351&k\b\276\323\326\263\016\002\376\360\022~\001\262\205\223\371\336\304hf\306\307\352\330\032\205\321\f\024\255\263\231/|\251\201@\237}a\237\001'3\206/;\330N\346\f_j\340%\364\216\331\314\033\276\354\300K?j\263o\233\371\303\337\324\212\034\261\f\355t\027\265\355\007\233\030u\367\021\233\243\227\260OQ3\203x\233\030\274\304,\342K\022\274t\363a\267d\214`P\200TqQ\025\317\005\247uR_\371\023E\214aA!\300Z\306/\354\275W\023\016v\tFe\236\261*\265\214g=\204\334\276\352\213E!\243c\002\350\367\355l\311\221\252zj\235\202\343M\020\333X\254;\337\275\2558RU\0173\227\270\032\235\t\243\362\311\275w)M\212K1v\3419s4'\316\233o\023F%\024\255\2339\221"
+	.ascii	"\316\220\003P\275\235\007\236O7c\341\203\301\263O;'_/7\202\347"
+	.ascii	"\323\321d\344\232\2362\244O;'(\\\256\347\324\224>\345\\\314\230"
+	.ascii	"\240\230\232l\223\016\327P\275\035\3172\256\201\013&\247^\316"
+	.ascii	"\247\202\347\323\335\236\234\230t7\\\317wkP\200w\274\\\357\006"
+	.ascii	"\265\333\365n\265\344=\227\237*\230\325'Uz\217`\326\031\024\251"
+	.ascii	"\177~\232)\330h \255\261\030\210\214\231\324-\247*\235\326S\f"
+	.ascii	"NS@\326e\316\355\275\367\246\215\305\005\202YKf\277\357<\nfQ"
+	.ascii	"\235\266\256\365\024\247I\265\326\027\363\345o\n*\324\314?*\025"
+	.ascii	"\352\207H]\223n\366\244\tv\024\332X\254e\2150\307\254\215\360"
+	.ascii	"\303\376 W\220Z\226\250\205z\212\255\245u\355\251\334\231voK"
+	.ascii	"\016\332\263N\333.\205V/;\215\363\250\3216\273\204R\200\001e"
+	.ascii	"\250Q,\244\b$J\031\232\021\021\021\021q\306\200\002\031\272*"
+	.ascii	"\017\020hh\232T\032\003C@x\372\007\211\016t\2421q\347\017\tZ"
+	.ascii	"\307\027\366IN\\v\fi\331\r\270\210\3416\211H \253\225xW\233\335"
+	.ascii	"O1\222\013\t\240x\270l\3714m\252\007<T\345\\6(\342G4\231O\265"
+	.ascii	"\346\360wo\352#\262\246\227\371\t\275\250\201\017\340\235\374"
+	.ascii	"\256N \021\001?\017\024\013\315\314+ \253\335\376\"\202\256="
+	.ascii	"\257\273\265\357\356\261}\"\266T\207h\331*7\231&\222\006#\202"
+	.ascii	"\234\355&\037t\232\020A\031U\355\005\354m\t \004\2118\036\003"
+	.ascii	"\b1\003/U\364\t\256\265\314V\320F~2)\220-G\002\001\016\237\251"
+	.ascii	"\363\020\342\023\245\201\0214?\256\313\031Q\224\211\232?"
+	.text
+	.section	.gnu.lto_mspSerialTxBytesFree.31.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`\b\003\335\027"
+	.string	"\306k\234I\240\030\231t"
+	.string	"V\257X\373\343#{\366<\007Y\2577\n@\324\027\322\312\037X]\367\323\026\334\375\264\347EPw\236,1\016\371\322@\365h\341-\205\261\256\241\327A\3439\004\022^\223W\340\0132J\332\020!do\271\223\f\211"
+	.string	"\200"
+	.string	"\212"
+	.ascii	"\327w\222yLy[/\240\274m\033\334\257\276\363\210\272N\032\211"
+	.ascii	"N\263\264\265\251\213oB\370\371\204X.I\263\275N\2520Qv`\324\005"
+	.ascii	"1:2P\343\306s\321\213\315D\225\321\261\203\243g\367h1+\202\\"
+	.ascii	"\023\026\217\262\363\242\306@\321\035g\264<\fwk\352z\204h\266"
+	.ascii	"\026\257\225\301\321\306\363b;QI+\256\024?<\255\331d\264\017"
+	.ascii	"\274\005^P\226\0317\236S\023\302\275\227)\315v;\227\316\314P"
+	.ascii	"\2309\0023]\022\307\036=\030M\366\275\367\325\275c\366\275\350"
+	.ascii	"o\323`6]\370;\233\245\255\224\373\2753m\312\177!0\024\223\"\344"
+	.ascii	"\025i\243\357\252H\016]\242E\222\343\302\377\367\367\336\314"
+	.ascii	"g~\220?\024\216HA\344Qyp\037\037\310\244\333\037+\251W\310\255"
+	.ascii	"\272\030X|x\334{O\347\355\231K\360\177\230\364\236\353\367v\217"
+	.ascii	"\002\311\003\302r\257\217\346\226i\316[\276\217\373\224`\027"
+	.ascii	"\005\0230\333\f\217\310l\210\274\001\030t1\266\234\310\305h\222"
+	.ascii	"\212z\307\245.\273\177B7\202N`\250\315\r=\255\324\225hLB\224"
+	.ascii	"\365\213\177D\306\320\216\323J\261J\321\034p\016e\243n\204\303"
+	.ascii	"y \0228\347\275\267\273\205\273\302\205\376@a\354){\307\324E"
+	.ascii	"\216W\321r\315\335\236q\006ny1\245\366N\247|\257\202Td\264\013"
+	.ascii	"3w8\021\235\013\270c\003fV}H\316}pF\344\275\327A\220\013I\361"
+	.ascii	"q\3342\b\026=\355\226\037\242\274}\177\370\312\004\027("
+	.string	"\324J\002\013\325\322\321 \022\201\332\360\241Bk\225R\211Z\250U\363M\215\007\033\234\025\212\225A\305\3129}\300\261\3119\335\254X\247\232\002\234R\241V\247V*\265:\221|\367uT6\245\001\210\306'DX\307H\275c\023\023\221\251\362\202fA(\315\315\256q\025\331\376\317O$\017h&D\001$\223\311\344g\312\262k\nn\036\310\022\344#XEF\273\274\336{\357\250w\374\341\317\002\310\217\336Yj\256\266l\3335\346\0047\333\324\007>; `\002!t\271\003\177\f\263\241u\0046\241\016\307(m<\325\306N\215d\233\303[\217\226\026Z\244\b\201\230\005\326\305X\370\240\200\364Y\233\256Nm\236\377*\013\323s\321\212\257\231\324\226s\332d\371f\253f{\360\226\300k5\216\312\222bG\363.!{\215Z!\207\177)\272\034\367x\264\305\031>f;\b\032a\260\b\331\221\266\357\322t\340\016\255a"
+	.ascii	"\313h\035zi\271\f\023\241J\207\033\2367\336eS\333\311"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375`\312\005U\027"
+	.string	"\326d\214J\240\330Q\007\021L\304S\357T%,\374\001 v\304\263;k\373-\312\376\244\004D\345bJ\212\366\236\250\333\206w9N\216\313\032\336\356\344b;\271\270\342r\\\232\277\351\020\r\374\301\274c\375!j\263\212\265+9\262\311N;\311{"
+	.string	"y"
+	.string	"v"
+	.string	"\255\376\324{w\036\236\247;\374n\214j}Q\034>\355\r\177\243\341u\355\313?fd\370\334\365j\262\225\205\341q\027\376\034\333\302\303T\310\211\031\005\210\335{\307\365WD\013\205\267\025'|\315\220"
+	.ascii	"\tO3\372\275\315\036\2110\024\203\3603\017^\306\213\305\242\320"
+	.ascii	"\301\3074\370\332\310\340m\222\220\204b\244\252\252\352\202\277"
+	.ascii	"\251\353\372\313\272\367\357u\362k#+\"\330\321\243\343\275\267"
+	.ascii	"L\022Av\330k\301\032\233b7\207\027\343`\237e\233\322g\300\214"
+	.ascii	"\201\270\322\313\334nE\004\353\312\225\336\271GUUc\350Jo\366"
+	.ascii	"\246\364\006\002\354\0350\332\027\271}\204L!\251\2119\322\215"
+	.ascii	"\364R\330\244\223.\036\250\305\373\260\370\240\025\337\243\342"
+	.ascii	"q\232^\207\351wR<o\351\177\224\336\b\305+8\361\003\222\236\200"
+	.ascii	"\2117P\342\013\220\370\003#\036\201\210O\020\342\211@|\321\207"
+	.ascii	"\357\005\300\276A/82\220\315g\231\207\346\263\225\2449n\373n"
+	.ascii	"=\345\370\352\2419f\273iH\361\365\360\2419\357\207\346\030\250"
+	.ascii	"cz\331v\221\223\221\253\035\323\227\272\211TE%<\323\315\033"
+	.string	"2\262\266b\231\233m\267\025\021\354I\216\314\233\252J\354Ml\273\257JXN\2613)\265)v%\266\213\274\266`\355\260\247\301t\315\265\271\252\213\035\327\342\330\024\373-\367\215\"\303F\267\263\216\246\243Z\037\024\236\361YUw\027\325\027\"X\306\217h\250\363n\350\370d\005k\252\027\343\250\360$\321a\267T\r.P\346\351(\333\250\327\025\224\240\323m\271w\272mm\347\352r\305O\257\255\r ;\361\220\235>\033v\353\020b\r\351\323q0v\372\027\226\340\022\241\323K\266\211\206S|\360\316f\222\205K\253wz\347[\030\025)- \030\357\366f\363\016]\2501\020Ju\214\b\311((\210A\341\030\340\002\251\"Q\007\021\200\030\220 FH \021\211\004\"C\0179(X^\331\214\027\026\"'\272\352\347\225\325B&|\2404\276\300\032\276C\242kh\205%=\352!1\326\233\214\356um\3415\240Y"
+	.ascii	"\002\316\221\2751\276l3\034\317\313&p\034\003\026\335\326\324"
+	.ascii	"\215<&a\335\312\323\342Z#J\277#\257\264\311%/i\313E^i#wO\270"
+	.ascii	"\211\215\353\275\300\n\b6h\202\244.\354\365\2558\026\177o\214"
+	.ascii	"\330=v\315\305\367\226\267\021\370\213\024\354k\375z\233\202"
+	.ascii	"\211\261K\277 \270\214.(A\331\265\336\266Av\375\037"
+	.text
+	.section	.gnu.lto_.refs.fabf885c90292076,"e",@progbits
+	.string	"(\265/\375 \245U\003"
+	.string	"\022\b\025\032\220)\351\377\377\377\377\377\377\260C\026\235\310\027\377@/\bm\177%mK\231\002\277~\246\240\205\257Llv\304\206\364\037}G\277\321\315\350^t\237\376\322\027\364\253[\351\016\335t\003M}\226\005^\204O\372T\016\350S\234\305WTh\023\030\260\211o\177$\007"
+	.string	"C\bh\t"
+	.string	"\002gF\320\224"
+	.ascii	"c\222\202%\n\024"
+	.text
+	.section	.gnu.lto_.decls.fabf885c90292076,"e",@progbits
+	.ascii	"(\265/\375`\277@\315\017\001\232\313\005cW N\301\234t\376\017"
+	.ascii	"\244\212\r\305,\003(}\216\235\375g\216c\327y\200T\377%h\365\037"
+	.ascii	"\252H\255\237\230\025\253W\377\347\321\250:\236N\230-3\177\203"
+	.ascii	"\206P\025\343\354\253KG\235e\224\235\021.TT\363\361\247\3479"
+	.ascii	"n\337\223\2004\363\271\007\210(\321\204\354-e\n,\005\017\006"
+	.ascii	"O\006>iU\024\216\266\177Wu\f\036/\032\260\216m\033\206Y\rI\267"
+	.ascii	"\266o\272\363\314\325E\326\302r5E;U\200\261\205@\303w\325\253"
+	.ascii	"xN\221+\033\023\303d\252W\361\224\222u\366w\212v\321P\255\242"
+	.ascii	"\245\332\251Y\364\213^\321S\035\325T\375\324-8\355\"\347\235"
+	.ascii	"\337p\362A\351GP{+\241,\313\\\031>S\275\212g\024&3>c\263\232"
+	.ascii	"\036q\306\262\340F\370C\254a7&8\025{.\300\242 \261\374|\205\341"
+	.ascii	"\330\254\207\270\3412\311\265\035\347\272\310^8LM\217\025\310"
+	.ascii	"\232\202\274\367\206H\303x\325\253x\216\201IA\336\233N\351\""
+	.ascii	"\243\261\025\023\234\212=\026rX\220k?_y\027\231\215\337z\232"
+	.ascii	"\322;\225\003\346V5\004\357\336\364\034ED\t]\354\333L5=^&\271"
+	.ascii	")\006t)Kk\203wo\352\301\203\207 \017\345\017\2650j\002\260\315"
+	.ascii	"\324\275\324Mo\246&^D\t\337i\272\\\367\246\315d\357]b\376\240"
+	.ascii	"\207\371\203R\r\310\022\230i\337H\316w\326\351\2232\220\311x"
+	.ascii	"\374c\276e\234?\273i\203\223\202\215[X[n\303l\322\033\264cCk"
+	.ascii	"\206\227\266o\250\363\255\242\003\253\3515\245>DZcV\332\236\337"
+	.ascii	"\234\3472dl\327\323DM\222\257\266g\265\363,\206d3e\213-c0\230"
+	.ascii	" \211\234c\270\256Y\250X!\326\366\2345\206\255\316\237\301\234"
+	.ascii	"\303\374\334\205\351\330\354\205{\233\356\275\032\360\324\245"
+	.ascii	"\025y\323\226\277\2048\203\371\317\365\311I\001\326\203F[vBu"
+	.ascii	"\356\\\00629\37519\216\267p\n\002s9g\341(/\227\322\233\336\233"
+	.ascii	"\372\264\217<(`m\317+\3163\bfM&\031\004\363\274t6\377\230\227"
+	.ascii	"\341<\032\003\231\354\306-\264\304\320\264\275\321\331v\337\311"
+	.ascii	"h\374c>\216\201\314\207\340d*\\\205\323\277q\332\315\242Uz\311"
+	.ascii	"p\310\330\272j\373\f\234\347\277\231-\340\277\231G\341\3448\376"
+	.ascii	"1\337\200\363\362\274Q\362\246M\333\2038\031\311?\346\006\006"
+	.ascii	"\202BV\202\271-Yj\313a\374\204S&\373Y\214\307n\277\2147\354\336"
+	.ascii	"\224\247.U\301Mi\353\001\003\231\226\177\314s\007\323'\231L&"
+	.ascii	"\271\203\311\204\271\370\253>A\031/\331\275)\207\312\242\313"
+	.ascii	"nJ[\356\342&\234v\300^\027Q\302+\361+\345\2727\365\331\221\222"
+	.ascii	"\362al{\020\316\263\223\373|\335\022\336\347\271\003\223\223"
+	.ascii	"\334\201\371\224\201\314\223\177L\216\001\325+0\360\215\273\312"
+	.ascii	"\227q\220Em\313\013\360[\265\273\205@\003\034\343g\250\013\270"
+	.ascii	"\376\301o\237\250\320*x\316o\2210\320\214\006\301\206\337\022"
+	.ascii	"\371\373\204\212\3633Y\025\016\252\3713\233Zv\265\177'\240\326"
+	.ascii	"\277\257\324\356\251.@\027\363\277\f\b"
+	.string	"\225\345\340\252\334\001\277\005\362\363\016\273\325\217\200\341:\260\017\370\231\214\241t\n\311\237qz\310\233\203\300@\307\340\267*~v\200N\336\317\034\376\333qp\236\337*\340\357\006\270i\037\177{i\363\263\230\237\347~\356z\032\207\340\003)h\340\347$\013g\013b\f4\233\277\337k~&\323\346\037\376\252\346\357\021\360\032\353g\240\232\237\177\b\341\017\374]#\315\337\033\372\356\347\364\353g\260,\021\374\334\201\237S\350\007\374m\3677\232\316!\346g\020\374\334\302\317\\\375\345%\202\332\313\337\022`#??q\003\372\003~\253\264\202\016\252\247\272\374\035c\016\003\356\226\373_\202\201\256\301o\177\377\275\376\325\034\314\337\026\340g!?\007\371\371\307\317[M\334\362s\357\347\013\330\3749\353g\254\237s\234\377\301\374\274\241d\236\237u~\356\341\235\2339\007e\036\216\200\337r\300\366/\370\355\215\036\021\007\264\345\034~{e"
+	.string	"-\177{e\371[\n\334\317\"~\356\360\367\n\177["
+	.ascii	"\313\317\n\340\234\263\337\376V\362\267u\373\031\001\377A\230"
+	.ascii	"\301\315[\270\354\t\370m\324\317\366\347\234\237g\250\240\355"
+	.ascii	"\177\t\240\357\374\026\003\177\263\375m\345\357*\177\243\375"
+	.ascii	"}\366w\331\337_\177/\371\233\310\337\307\277\203\374\375\343"
+	.ascii	"o\035\177g\375}\365w\325\337T\177C\375\315\342\357\246\277\227"
+	.ascii	"\376^\301\337G\177\233\340o\023\177\213\340o\020\374\335\201"
+	.ascii	"\277I\374\315\302\337\027\370[\205\277Q\370\271\315\337\022\370"
+	.ascii	"\333\001\177\223\360\267\207\277\017\360w\007\177\007\375\235"
+	.ascii	"\301\337\034~\206\372\271\204\377j~\346\372_\367\363\326\317"
+	.ascii	"9~\306\340o\235\277{?\263\340\347\245\237a\370\333\376,\3677"
+	.ascii	"\377\234\302\337\377\231\314\317\300\377\034\374\334?o\3719\313"
+	.ascii	"\317p?\253\375\214\201\237\253\374\037\373\357\366\337\314\377"
+	.ascii	"\020\374/\363\237\313\377\264\377e\377K\374\267\373y\306\317"
+	.ascii	"S~>\373\271\354g)?G\371Y\354g\260\237\273~^\362\363\221\237\207"
+	.ascii	"\374\254\343g\033?_\375\\\343g\032?\373~~\341g\241\237K\3603"
+	.ascii	"\t~\036\301\317\021\3709\203\237\201\376\223\375\377\372\177"
+	.ascii	"\364\377\355\377O2\231L\376=\274\277\207\363\1778\0066.\307)"
+	.ascii	"Iq\334{\211d_\262\214\275\224\351\306=\0251\242p\272\367\313"
+	.ascii	"\215\"\201\310\304\364\336\253\3422\021\371^\247\264x/\223\361"
+	.ascii	"\005\253{\3575\362\234\212\342\345\271MKPLY\306\035'&\243\212"
+	.ascii	"[\344\006\337{\357\324SX\2261\004\025\261\260\343eJ\211\374\004"
+	.ascii	"e\274\307\373\005\253x\206\021\031\rO\230\017+\250\266\033.\003"
+	.ascii	"\231}\371\307|\317\310YW\311\214\351\371\341\304t\245\355{6\352"
+	.ascii	"\306X(5\322\320\360\345uL\025\323s\344\0025\326\266\206\3511"
+	.ascii	"KQfM\333\367\250*\230\352%G\310\226\231\213\266\225\256\207\226"
+	.ascii	"\227\245G\227\377=\234\2651k`]>\227\003\nY\225s\221\347t\245"
+	.ascii	"\355\3177\347_\271l\341/wN[mk\334R\215\244\212\266?\315\234\177"
+	.ascii	"W\305HW\264\275\250j[\341pr\360\340A\244\355O,\025K}\353]/E\360"
+	.ascii	"\252\333\353\233\0336sKm\177W\333\376\367XI\236\027\247\266\312"
+	.ascii	"\246\344\315\256F\3452A\226\030\270+m\345\244\232\273OV\252\232"
+	.ascii	"IWL:\231Y\241R\253\374n \231k\373\323\b\0254\035Vm\252\316\314"
+	.ascii	"\224z\326gJ\2220y=\373\377F\266\261hvAk\2023;b\3168s\345U\326"
+	.ascii	"a\r\035S\022)5J\221\242UT\333sZ\243@\031a\003\rM%{\205b\301\244"
+	.ascii	"X\361\242\355\357\330\315\351\302\264\211\033\023s\362\272\352"
+	.ascii	"\361\344U\214\315^\270\032pp+\326\320VD\210\327'I\254\334X\023"
+	.ascii	"\006\246sD\352\252F\333\372U\235|\3311\203L\333\2378\316\217"
+	.ascii	"\220\002\361\342\264\246\257N<\004\341\234I.\311\260\266I\327"
+	.ascii	"\230\032f\234\265\255\\>\304<+Qm\177Z\235\177eR\227pM!\223&y"
+	.ascii	"]\362W%\225GP\210\f\261\266\225\177L\316\022\3425IE[sr\203\344"
+	.ascii	"HO\030%lF^\217\234\315^\320\240R\225\201\031i[\213\204x5b\276"
+	.ascii	"Y\323\202\254\255\017\221:\344\251K\231\260\266u+\250dr\304\210"
+	.ascii	"\261\355O\026g\220\036S\322d,\3273\265\34161-9\002\251B\352\221"
+	.ascii	"\323\032\344\265G\365Q\177T\0365H5\262\\\r;\236*\300\230 \357"
+	.ascii	"M\301\300\354\240N\333\201\201\314\222\177\314 \006\332\241\003"
+	.ascii	"\n\031[\221\2665G\220\017\031\2200\033m\217\343\346\374_q\324"
+	.ascii	",N\253\326+\026\247\367)\275\367\276\204&\343q\324\252F6\353"
+	.ascii	"!\246W\n'kG\325\020\363\352\013\226\034\246\375\353\215\277\227"
+	.ascii	"\003\247F\306\261\355q\356\316\343 \317\277\3260\306F\333U3\341"
+	.ascii	"0Y\313\"\253QiLY9~i\373W\032]\264ty\323\366#\320\365\030\023"
+	.ascii	"\234\212=)0\036\310\2613W\307\2563c\343\330udj@\312\325\250\306"
+	.ascii	"\361\003o\206\233N\312A\265qQ\233\352\223\tN\305\336\013\246"
+	.ascii	"\025s]^g\202S\261\347$\327cM#{\2326\334\246,\031\307{\323:45"
+	.ascii	"\332.\252\357Z\215\tN\305^\0139\032\265\252N\325\031\225\206"
+	.ascii	"jUeT\251\352\242\306\250\305\nU_T\030\265E\245\342\264F1\233"
+	.ascii	"\327\025\225E\263i\244\025W\215\252\2672q\034\331]\242\362`\353"
+	.ascii	"\370f\r\357\336\324\003\216\216%;\362<\260e\312@\346\331\352"
+	.ascii	"SUA\3465&Lj\207x\231\"\244:\325\024f\023\271\035nm\217\363u\036"
+	.ascii	"\207I]\362Q\023eG\327\3668\307J\364\321ov\212PI\005i{\234\253"
+	.ascii	"\316\303\211q\036\007\352\274\231<o\2369o\2029\377V\223\346("
+	.ascii	"\344\253\256m\234\317\316\033&r7\332\336\214;=\340\037\363f\332"
+	.ascii	"yS\354\274\251\244\313\364\350\320\\\221\265\275y<of\235\"\360"
+	.ascii	"\217\331bR\244\245\355h{\223\305yN;\f\030\223K\327\025\373\362"
+	.ascii	"\006\363\213(\341dv\356\345\272\367r\340\003\344l\013\216\266"
+	.ascii	"\355\205\345\222gX\324\332\376\356u\377{:Wzdei\3732y\276D\236"
+	.ascii	"O\371\307<\032\027\344\226\rp\220P\251!G\034\bgS\232\024.-\177"
+	.ascii	"\263C\324\232nd)+\303\334\354\262\3005\333\230\333\226+m?\002"
+	.ascii	"Y\213\365\224\367\032\307\034;\365\202\300\222f\353(\235\306"
+	.ascii	"\001\323S\006\222\210A\336{\347\330z\214\315z\352\2756\352\216"
+	.ascii	"o}\245\333\032K\273q\332lm\345\255\326k\017\3429\266\376j\261"
+	.ascii	"\236\245\364\026q\200\304"
+	.string	"\221\261\303\273\367z\350}i%\301\354XN\031\310\f\342\037\363\345Y\025v\301%-\257\355\3131\264\236\302iSi\263\363\\C);\353\262\036\"\207{qt\035\251\264\224.\3438\253\364R\341\214\245b\216\226\t\f\f\026\323\276\304q\276\274:\377.c\263\226\203\203bj\373R\306\3712\306\311\345\324\371\262\305\331`\035\306\351\006\375\344\372\360\231\035LSm_2\235,\270\227709\231\344\r\314[7\347\355\231S\204v\322U\025\226\267\325\266\253k4\222\352Ud\201\311\315\337L\232\253\233p\332]\235\344\255\244\227\334\266UW\317\310C\336\233\266UW\313x\203\2747\365\020\344\301CN\030969Nk\032\031\310\374\234\334\371\267\2157\222\277\255\232F\037i\343\001\264\362\324\2645b\266\025\221^\332\336\242\235\377{Ho\265\220\016\322D\372\310i\027i\037\357\037\274v\313cE\032G\363`\032\3235"
+	.string	"\301;\032\313\024\351\036b\220}\003\213L\210\"\235\305f\034gu\211fH\350B\223C\342\335\233\006\371\320\251!k\353\261\267\306s\207\177\314\333\250\363\366\366\016\016\033\343\321\246\355+\230\263\265:\007\247\255\343\227GG\013\215l\251m\f\367\336\313W3q\256f\276f9_\313\316\327%\347\311\262\316\2631\220\331W!\3366\004`\246F\245-\016\377\230\2574\234\346e \363\225x\276\221\347\3374t\020k\236\206\264\375\206\245 A*\224 c\0053\225LR\202\251A\305\220\343\301\243\374\301\033R\2461d\220mqb\214>^\376H\276@\223\327\266\354Q\322"
+	.ascii	"cT\002\245\214\353\316I\333\373\240ii\225:\030HQ\314\221s4\t"
+	.ascii	"\002\244\314\361R\207\216\361\206\n<\237\256\262\206\262\206"
+	.ascii	"2\313\314\316\230\"]B\260^f\361\030)\316u\265-ox8\036\323\332"
+	.ascii	"\226\306\017\233\222(A\376\357\231Y\244\334\260i{\237\036\245"
+	.ascii	"UiU^\231\031\305\034{pse]5^^\225\341|\331}!\322\370\337+\321"
+	.ascii	"%\214\226\222F9\3438\003M^\025\234*&6WJ\031m\306WT?\234`\301"
+	.ascii	"\200QV\361\327\225\302 M\347\313\331\223\0351^V1\361\240U\365"
+	.ascii	"8\363qr\341\242\244\n2\022\315t\240\202\006\227\265BJ9\365\222"
+	.ascii	"JK\356GV\333\337\225\305\235\224x\311\224\305R\252wf\214\230"
+	.ascii	"\246\036&\032G\035vPP\366\214\003\307\036;)\030E9'\247\222\005"
+	.ascii	"\177]\251\r\304\275YKb\245\211KG\271\342%\013\236\034k\252\\"
+	.ascii	"\265-\237,V\216\324\035\035\221\266\245\n+eS\331d\317\202\324"
+	.ascii	"\3227k\246\2261At<I\376\311r\211\277\256\224\251c\013\232$x\367"
+	.ascii	"Zu8\241\230\341\352j\373\227\304\227KXhP\t\323\266\274\013\230"
+	.ascii	"\213Zk\373\273\016\304\234\315ii\373\036\343Y\346\026M\031\233"
+	.ascii	"W\351v.\361\353J\341Li;3\004\357>Yu\320\361j\341\265\005\357"
+	.ascii	"6\357\326\215\210\022^w&9B\267\324\326\266y\217\025\\\025d\333"
+	.ascii	"\3335\226\315\337\313!\242\025\206\244\355{\210\347\025p~UMM"
+	.ascii	"\265\265j^W\244\016\312L[\233\346jV^\360t\334e\311\222cjk\355"
+	.ascii	"z\252\250\200\362\326\366<lNk\346\366\314\337\353U\261\241\205"
+	.ascii	"\325\366<g\316\337\"\377\036N\024:\032\307\266\347\251;\317C"
+	.ascii	"7f\214\255\363\340\336\353tc\370B$\nR\n\212\033(u\215\254a\220"
+	.ascii	"\304\t\24127g\303@\200\210\325Q\347,\305\226\0220\267a\314$g"
+	.ascii	"B\272\264\265_,V\020\252\034^\332Z/,\327S^\336\306\264\265t]"
+	.ascii	"\234\300\301Y.}\357\275G\034+[lH\036\265\025j>\266\334rY\322"
+	.ascii	"RfE[\033\307fg\023\026H\252\264\265Z\272\214\253\006Y\226\253"
+	.ascii	"}\231\2715Y\213\032\222C\306\326\333\233\025Kc\312\270\301\223"
+	.ascii	"\202ME\265=O\026\033\233m\2733c\230\306;&\267m\275-\"YPm\317"
+	.ascii	"CU\245\212][C\305\252C\217\017-\3104m\355\332\02165Um\255\225"
+	.ascii	"\232\006\2048d\253\255M\253ej\224\211\241\301C<\321\320\254\230"
+	.ascii	"\234\220\343\265\262\352\320\303\243CR\206\245\254\314\236\005"
+	.ascii	"\021\331B\242d\r\026\263\333\263\0344\210\\m\177g\261\342\322"
+	.ascii	"\244!k\373\035\256\363\267dd6\n\221\264F\bg\216\024`\272,\024"
+	.ascii	"\026K\301\254\264M1\260B\342\242\355w\206<yb\305\314\250Xu(\355"
+	.ascii	"\244\350j\270\343\324\212q)\022$J\333\357\320\360\362\262`Z\246"
+	.ascii	"\276n\301\250@Y\305X\023\345\364\306\253\355w\226\316[.\266M"
+	.ascii	",\023\353\304r\235\367\310\002\024-\310[\204\021\302u\326\234"
+	.ascii	"\327!sZ\256\326\t\003BO\223.^K\276zR\230\024\201j{\344\210]\262"
+	.ascii	"\3412\201\201;*\271]\242\306t\\\264\256\264\265I8\210Q\343\325"
+	.ascii	"\326\"\251m\3043+\036o\247\335\013\252\257\266\327q\373\361\303"
+	.ascii	"\0269\357\275\304\364J1\rSB\232$\271V\305\016\266\310\325\210"
+	.ascii	"0\371\341\244\255\035R\3274q\253\210\233\266v\213\301x\207\333"
+	.ascii	"VY[{\274Z\317\207\025\244[[+\204\301h\230\335\315hk\203\\\355"
+	.ascii	"\314\223q\344M[\013DgL\207\016\333"
+	.ascii	"C\004%<n{4SNU\232$I\332\332\035:=j\250\301jU1T\2044I\202\343"
+	.ascii	"V+'\f)F\243\255\315:\331^h\231ik\215\026\353\232\255\261\301"
+	.ascii	"\2627*\233\2137\0375\316\316\220b\245\255\231XP\245\331h{\235"
+	.ascii	"\253\0313\354\325\035\261\306\355UO\3458nikih\260F\005\244fq"
+	.ascii	"\002\"D\255\355s\222\347o\255\316\251\265\262P+\030/\025\004"
+	.ascii	"\250\024\255B\300Q\343\265\305\214\230\027/"
+	.string	"l\025\233)\341\355F\214\333\252\022\311\013\254\265\266\026F\t\240\352\344\332\376\256\314J3fJ\333\347\250\331(\033e\247zg>\210A\264\305\333)6\333\311Q\225\326\244\255\225b\263\377\275J\367\203\212\233\266\326\005\203\361$\331$\303\324\376\367l\f*L\340\332>'=m\013\256\312\202\305\246\355s\266\316\337:qj\235\354\212\025\322K\314\221\262%\244\t\336-\026C\260+~\253\302>u\214\235\0360&QR\264\375\2202\220Y~\331a\233\322\264\270\273\322\3669/,\223]\262\027I\\\231\030\262\272\251y\366\362\245*b \252\006\362\026\213!\3745y{\377j\246\236\261uF\202\254h[\337\204xM\356\260`\261e\327\226\223\374c>\007\352|ES\355^\357~W\333X]\"\232\020i7\2044\301\273V\305\016\177e\363\332f\216\007\254\f\226#mk\232\272\346\177\257\007\n\227\024_\326\340\205\331"
+	.ascii	"\363\242a\364f,\341\"\247\206\363*\f7!f\312\374\357\355\\\231"
+	.string	"Jal\373\336\224\363?\277\177\363.\025\357\275Tez\213L;\346\317\347\222\271\303\317\303\225\t\360\337\326\207P\201{\227\256\340\335{\331\356$2e\211\206\007\367\377;\334K\344{o\361)\f\213\310\341)l\351>=\211\233\342\360\024\2065\365\224\336\033\032\3340\034\367)5\022\255\221x\357%\366Mo\023\326\324m2\022\223\236\322[\274\251\221\270\3416MmxJ\227\210OaXS\374\024f\234z\n3Nq\270M\227x\233\226n\234M\306\251',\306\251\rOaKSOMXS\234\032/oIK\261\210N7l\211\347\336\013\225\036\211;\367.\025/\221KG],d\324\rA\037\212!;D\372U\"_N\013'\220~C\024\302\037\322O\005`\211 P\205\341\317\227\202\003\240B\240\321\220\017\021\322\257\b\003$4\t\3303\f\002I\\\340\3020\006\224\005\"\244_Q\320Q|@\217~C"
+	.string	"\b\177FF\277#\363(>\004Q\"\037\320h\b\004\236"
+	.string	",1D\205B\r\216\342\303\317h\b\304\317h(\210\016\221R\370\031\r\235-"
+	.string	"K\240\030\032\376R\340\302\t\244\037\322\317w\204\266P\244dBx\301\005\301!\211\"%\023B\034\031\206IG)\f\177GB$_\260\204\360\027"
+	.string	"\016H\277\023\350\tEJ'\240\303_\320\003DH)\034\305\207\241\340P\220\b\241\220\t\024\020\t\2310\024\034\3229\212\017'\220~\301\241\020\004J\244d4\204\364\003\021\024*\201\310\300\310H\t\t\t\210\2043\024Bg\370\t\315\024"
+	.ascii	"\203(\206@$\234\"\037jd\207\250\360\b=2Q4\250\202\020\035\312"
+	.ascii	"pB\f%\202@\022\034P\b\225H\f\177H\026\3409\201\364\033\376|\036"
+	.ascii	"\330\340\202\001\210\212, \364\241Fh\013\302\236p\030\004\222"
+	.ascii	"@\207\276!\240\221\321\0042 \021t\212\360a\350w\3027\"Ix\224"
+	.ascii	"\363\201\021#*J\004\034BJ\341\310\027T\201\b\tu\341\002\337\320"
+	.ascii	"G\001\016F\fQ!\032\334\351\340\007"
+	.string	"\250H\351\004\0240\030\nOTH\005\f\314\023\271\220$<\032\300\207~A\024\t=q\236\204\005(`\001&\304\200\023\342C\221\322\tC%\340I\204\344;:\002\242\220\001*\324B\222\360Hg(\374\031\006\207$\220T\220\301(\tmA(D\207\200A\022I\302#\fP!\n$\t\217zP!\337\320G\201$\341\b$ \013\350\320\247d\344CA\nI\302#\r\206B\0328a\004\007.\260a(b(\024\242\003A\224\310\207\256\220$<\342!2\321\031~B\013B\030DQ\360\013\022u`\003jd\302W\002\005&*\204\022\001G\f\203\300\244\034\224\bxdQ!\r\f\203\300$\036!\022\3607L\002\342\240C_\013DJ>\023':\303\317\005t\206\237\013\347\360$\362\241+\004w\210|\350\nC!\021#\030\375|%\202hQ\221\322\t1\fw\202C\022(\n~\350\020\332BP\216o\350\243"
+	.string	"\fC>\023FF>\024b\b\366\034\305\007 \241\220\316\360(>\024)\2318\362\241\301\241\020\004\022\360\350\b8$"
+	.string	"\"$\264\n\205\212\224L\b\315\3400\251\026)\231\250DGCUx\302gT\20434R\022\242A\023\r\376\210z=\303\243\370"
+	.ascii	"\002\370\323`\250\201P\350\002\030\204\276\021H\300\337p\bI\251"
+	.ascii	"h\007\025\262@\006A\364W\364\033\"\241D\277\234$\341\2210\351"
+	.ascii	"\004\207\030P\"$\013\240C_\220H\311gB(\006\240\t\030\206|F&2"
+	.ascii	"\020\236\370\025!\001Q\030\006\201I:3\240\020B\207\276\240\020"
+	.ascii	":\364\021%)\t\001\005\321\341\220/\350C1$4\004\002M\240\301\r"
+	.ascii	"\303\243\340\340\300$4\bb\b\004\006A\350\030\001\201'\b\2252"
+	.ascii	"\004\207\350\021j\204\226@1\374y\200\b\r\372P\b\177\222\204G"
+	.ascii	"=\241\3200\b$\2613\f\002\223\354PH8\002=\372\rO\341\b\031\206"
+	.ascii	"?\024\374\206C\023\030\n}F=\250\320\021:\024\312\340\002\211"
+	.ascii	"$\341\321\006C!\252t\002\264\205\023H?\"$4\251\007\025B\207\276"
+	.ascii	"\241\013I\302\243\034t\350\033\n\205\206pP!\022I\302#\0374I\206"
+	.ascii	"\022C\024\206!_RN\221\322\tH\277\022\351\247t\222pa\004\321\321"
+	.ascii	"\220)<\3413R\201\350h\350D\205v\220\200?a\020\355@\222\360(g"
+	.ascii	"\210\n\213\212\200\346Ph\001!\206B_\221\320\020\351\247\304\203"
+	.ascii	"\316\360s\3017\364\021\235!D\034)\ta\030BQ\f\365\206B&\f\221"
+	.ascii	"~J8\017\021\002\005\0178\300B\005\316\241\017F\276_\020\025\n"
+	.ascii	"%\t\217@$\t\217@ \375|G \206\202B\020\037\002\360\337|\262`k"
+	.ascii	"QY\246\212\253Z\034k\023f:\3256\246\231\270\252\324La\253\254"
+	.ascii	"\274\260\332\322\324C\310\031\0273\246\222M\004\3351\252m\217"
+	.ascii	"y\344\207\n*mM\"\232\027\356%\313\003\322BK\333\337\274VL\306"
+	.ascii	"\216\254dI\244\276M1\202\344\215\2052~\271I\221g\227` \253J\273"
+	.ascii	")\177\200Y\275qk\303a\274\264\264\t\222\236U\264\310\252\254"
+	.ascii	"\261E|\254\210_\307\306+\263\254\217\2705Pj\256\200@\211\263"
+	.ascii	"Kc\247\252\035\0226)w\226\253\254-\005\261\254{i\367\227d\312"
+	.ascii	"2%\232\031\222yj\332\226f\3123/\321\224\310[\242!\301x\357R\211"
+	.ascii	"\306\307\315\275K>vI\226\220(\246\375\005L\347\2770\220\311\303"
+	.ascii	"?f\377\b\361\262N'\313\032\322\311\030\035\030\020\313\230\265"
+	.ascii	"-\301\324\026$\223\311\244\233{\227J0]\212)\303\274\004s\346"
+	.ascii	"\017\230?\360\301\371\222\344i\311\374\322i<@\210|1yaa\311\312"
+	.ascii	"b\250\241\243\312\261\312\013\002\327\245\254:\327\250\301Xs"
+	.ascii	"\265R\356\372\364d\361B\367\245\3559$\317\277\344R.\265\226\031"
+	.ascii	"\266\024[\316r\264\310`9\306Y\255\035\257\263/#Z\276\030\207"
+	.ascii	"\2144b\262\224e\245\027"
+	.ascii	"\f\270%\270(6x\244\240\303bW\354`\251\260K{+\227\214\3419\221"
+	.ascii	"\341v\233\027\347$\311\243\355\332Z\311&\002_\025bZR\310\232"
+	.ascii	"F\252\b\rW^\262\301h\373\312\301\301\316\212\225\364\315Z/\352"
+	.ascii	"\206\327\f-U\252\3303\336\2202u9;\316x\242E\254\3559(ACkK\345"
+	.ascii	"\220xTz$\331\264=\007\036ggiH\236\0361\202\250h{\0160\302\036"
+	.ascii	"V\226\211\300W\305X\027&\310\332$MZ\226R\312\3132\213\325C\t"
+	.ascii	"\224\221\266e\224\346\201\243\006\207\026\"mK(6\205\316\023\034"
+	.ascii	"gD\332\226d=\206G\230%Om\313\261\327\331&\034[omK\261F\372p\331"
+	.ascii	"\250\322\326\266|R\231\270\r\032\335\212N\212\361\350\322\244"
+	.ascii	"\3559\244\340\342*\277\324\216r\310\226\222b\307\226\327\313"
+	.ascii	"\257,pm\332\332\226M\3124\314\213\030[\352\244\214s\253\302\332"
+	.ascii	"\200\314m\252m\331\305rs^\270v\2341b\244\\\022d$\236!A\355\312"
+	.ascii	"!oL\311\023s\344\345\222R\211\232\026T\350J%e\022,e-\272\030"
+	.ascii	"\321z\323V\006I\373\b@\335\223\231M\261c\266E\314\254\3557\264"
+	.ascii	"\r\031R\0221\241,e\271\261:\330t\205)\2110\336\032\031\306<$"
+	.ascii	"\307\243\025\0132\326:,,\273\023K\204\241\250\2231\224jT,\205"
+	.ascii	" \220\306\220Q\246hf\266\315\030\323\025@0"
+	.string	"HH\036\024\215\2705\017\023\200\204\213\213\205y\246\306\034bfFFA\223\202d\343\355\321Q\321w \371\\n?Z\226\226\311K\3235\254\225\027\205\357\025\"yS+0%\214\372\313\304\001\351\342W\"\n\317\245\2033\331\232\256H\367\340\201\244=\204$\211\321\r\326\220\254\013\246wm\364Q?\203x/\230\244#\360\267\266@v\001\354Ct\001\022\220\027Mi&\265\f\265\272d*S\020\022*\235\264\022\244\302L\235\251a\327\370\235\361\033.\224\244Z-\261fRi\316flc\325\016\317\247S\020\203k\353P\362Clh\016f\310\315b\202\220\233\223\250\3505\344\021\237\211\362Kcf\264\322\022\270\202\224\270\224H3\241\340\3319\037\023\302\347\322\217\340\307\306dPd\222P`\306\3017\001.\335\261B\321zX\030\356|\035TS\005\261\270\005\266\351)\246Q\r\304\323[\367\030\367\177F7\257l\326\032"
+	.string	"Hff\246\247ZREJ\244p\0254\265p\335\346\310\352\013.\340\326v\265\325|+\370}lO]\005\007\322`\006\316s\270\345\005\347\215o{\331?bt\262\207X\b8\217:v\264z\323\361\254C\307\371\277\222\303\325\323\004\372\326\332tw*\241K\244\026{.\313\254\035.\256\177ups\034\020d\274\272\261\006*q\363\246\034\273\346\001\222lA\367\254\352\036\004\267\356\276e\372\332\331$B]\366$\331\365\b6u&*\324\f\301t\b\362y\203AlcS\310s\311<\033oO}\006\331\214\332\315\355\302N\rn\r\371L\202\020?q~\310\035\336\314k\356\306\001\203>$\017\364_b\004\207J.\365\225\212k@\3317\3010\233\232;>\262\330\244\252&\t\352\220\365\"u\036\333\3262o\225p\220@\341u\256t\005+\320h\311\266\353"
+	.ascii	"\234\215>3\353\234\237\205\373\203+\247\3725\3439\222Vp\215<"
+	.ascii	"\253\013\364\374\273\235Ca<\037\211\030W?\r+\207\313\3013J#\210"
+	.ascii	"\235>\031^\336\fX\252"
+	.string	";D\204\220\307\361N\240\020\311\344\352e\n@\235q\277n5\372\2374<\344\347lc`\267t\310\257-\262\031\265L:\203\315GX\302f\342)\300\271fj$)\333Qi\366\345\340du\221\375_3\345\355:J\366\037\377^\n\001m\353\031v\266Cg\03775cf4\302\260F\036\254\2550\217\250r\335b\361\2600>\337\306\253\003\210\224U\232\304\0073\242\246Z\203\370\b\310\266F\321\017V\343\342\f\240\226\025[\237\362V\234\240\271\241\246Q\227Z\232\366(#\361=\327XU*\025v\354Q\3350\360\f\f,\2301AVh6\314\256\331\"\275eh\331\246\221G\237\3013\210\370\034\304\273\350\006d%:Ju\334\212\230<_\262+p\271\t$f\005\325\351\361\240W\275T\321\377\300\326\307?G\023\361\031>\022Ey1~T5D\362\220\215*\032\3015\371\340\221\215]\264(\006(\235!\321M"
+	.ascii	"\204\036O\022r\273\205|\367\363vn\023K\314p,\037\376\222\311"
+	.ascii	"\221\374\2130\027P\374J\225`!Y\202\344\220\030}L\226(\204\024"
+	.ascii	"+\274F\263.\336F\267{\030\037\246U]l\222t\330\200~=\372K%3A\321"
+	.ascii	"\037\333\374\030-3\361u1,\202\237W\373r\234\205/\204\276\375"
+	.ascii	"\\\017\311\"\b\302\f,\243\226\342\255K\361~\202\273dh!\216\303"
+	.ascii	"Ic\301C\006\214l]s\203\321q\274s\324J\007\211\3357\333n\323n"
+	.ascii	"0\304[\266\221\341\353\360.\267Dg\032\3320#R#\334\20167\262\216"
+	.ascii	"$L<\025\346\241{X\246y\315\005F\373[\266B\220\215\350F\272\345"
+	.ascii	"\374\362B\247\265\251&a\246\3148i1\353T\353\274W\0173f\234\255"
+	.ascii	"\305P\025\273\265\251DT\203h\342p\245\205"
+	.string	"\320\313\264\034?N\341\320\334G=0q\220{\313\3076\277\355Rc\320\346%\361\b\021C}oU\025_G\340\372\031\037\257\020\253\224\214\b\207\234\020\024P\216{\204\222\310\256#\362A\336:\214\306gL\266\323\333\001\234\311\026\253\305\323y\035V\247\304\247u<\300\020\376\270)t\321\274\314O,\003\210#d\366\310M\003,$\232\272C\177\205\375\343\363\333\214BzU<\n\337\032\335\267\033\235\302jtY\2202i\226w4al\226\321bv'\360\205M\247\332\267\322\0220\247|\025\021\377>\273\002\377P2\230D\373(\2636\236\253\321\316\353I\300\252\212wF\306R\257Q\023AI\3030l~x_rtp\nc\035&\227\013\275\375F\006?\025]\210\301\016d\354\027\005\325\257v|\254\255\355\034\361\260H\346\207\t\024;\302T\006\356\306\n\366\336=_/\311\265\276~h\274\366\005\266RA\350v\226"
+	.string	"pW\345\257\246\003d\312\347\303\214\207\346V\310\360t\336\222\317\240\030l\344D\336\260\303\367j\20431\240\251{Y\325oj\001\210J\236\203\231@K\253\3771\340\371\n\334\022\342g\354\233\023Ox\323'w\336R\274\327\277\007\266c\3278P\272BM\3655\352\340\022\221$4g\300\242\234\374$\353^\364L^^\022x%\207\222}!D\270g\022[\234\022\b\\q\272\362p\252d\336\260Xmv\234\242*\335eO\272V\302kon\300"
+	.string	"\250\213,\234\325O`\304\330\227\326\260p0\240\250\314$t/\333\030\324"
+	.ascii	"\376\326\251f\326c\324\b6W)2\224\262\316V0t\215\365\310(8\235"
+	.ascii	"\315\260\327/\337\025J\323\020A\330\013\201V\3061\360\363\323"
+	.ascii	"\bt\317\206qR\242\247>\253\006e\fT\007\350\343A\202\222$\310"
+	.ascii	"\337\f,\235\026@\374\225\367\251_\231\330u\206\026\b\361\321"
+	.ascii	"\214\201\221\270/\0039'\346h\310W\307\350\3423\231\003\352\370"
+	.ascii	"A\235\ts\342\333\036\t\227\344jJ\303g$ 7\304K;\365X\305\233P"
+	.ascii	"\375\013\241.R\374\365\241\300e~Z\270\337\244w\3667\030\347\\"
+	.ascii	"\034\227\355\003cI\016A\022\207jy\361\022\254\277\317\262Nc\322"
+	.ascii	"O\332\206\236\007\032"
+	.string	"\242\254z\372d1\311\224\265\031\016sN\236\326\320R\364c\210s\3505!\fU\257~\356\230&\331VHo\367\007\357M\257\\[A+g\370\327(f4D\r\024\376\036>\312?`6\351\bx\301\302\254\030UK\327DV\033\270\322\314\324f\244%\375\202\013\350t\210\033\330\343\230I\027\225\034\0132\tu\376\212\221X\306\270\264\263\246K\335$m\266?\304\234D\301\236\202C\2468\364b\337&\315O\264;\0332\001+kt\331\001VP\257\271\204\\\301\350l\246\327\214\275\rA\322L`\034\254\032\204T\325g\321~hj\201F\234*\263\304\n{O\003\266\007\202\t\357\247P\276x\b~\247\317\026\006\245\376\261$"
+	.ascii	"E\376\312\376\346\202Y\377\346$Bw\377\212-h\324\302\212\032H"
+	.ascii	"8\252\314\204\320\2333\241\005-\303\251\311\301\244;ygd\316\256"
+	.ascii	"\270\004\036\233\312\225\037\253\345\323\372\201,\225\371\225"
+	.ascii	"\317R\372\261O\257l6\031Sbtf\306\2768p\214\305C\354Cdl\034\026"
+	.ascii	"B\247\361\305\376c\267Q}8g\266\312U\331\350\245\253\023\272_"
+	.ascii	"\301qa\217\300\013\004N\347\347\017\203\356Ma\247\323\223\201"
+	.ascii	"\035{\373f\343\357\221\343]\356?\374\350@H\376!{\337\306\377"
+	.ascii	"\216\353\202<\337\332x\247\303\314\347/\265\005\334\037\332G"
+	.ascii	"Q\2603\307w\376\260w\\\016\213\357\341\017\346)\271O\005\036"
+	.ascii	"\210\361\377\020C\264\314\322\360\331\227\375\271\035D\352%\304"
+	.ascii	"\335\310\270Z\2709\334\3377\335\333\034\2768\270\354\340s+1\354"
+	.ascii	"\026[\027\\\273S\365;\252I\345\027\203o\026\367;\251C\217\363"
+	.ascii	"\005\373*e\024V\302u\253\267|\b\326p\361KN\236j6\374~(\237\310"
+	.ascii	"\360+\202\3779\037\314\345\234\241\363#O\371=.\362\221\030\356"
+	.ascii	"lv\245\340\003\303\275\326o!\213\343h\317\037XX\343\030\257 "
+	.ascii	"\374\006\321\026\036\343\371\327>\377`\246\021\352\314\336\024"
+	.ascii	"\314w\304\026G\353\326\366Zdu\202\256\3269\270=\345\365-V\227"
+	.ascii	"\3533\2621}\n5K\350\376\372\331\203\001\335\314[X\375'r\323\347"
+	.ascii	"\365\237\233\221/s\037\204\372\323m^y.\\>\302\3641\347-\367\005"
+	.ascii	"\351\001\364\236&\371\200\"\337\f\240\355l\376\254\302`\261o"
+	.ascii	"\021\365J5m\025L\022\352;\251y\302V:\0361\236\301\267\005\034"
+	.ascii	"\016\371\250\202\236\036\337|\372\237\301%\374\276$\347U\016"
+	.ascii	"\026 ^\266!\213\345N\355\027\n\317,\006\372\273\323\277\226%"
+	.ascii	"\2337\374\t\344\006\302Q\365\363U\213?T\216\2256\205\377\007"
+	.ascii	"\036\356\346\206K\367v\367\321\033\rS\353S\307NW"
+	.text
+	.section	.gnu.lto_.symtab.fabf885c90292076,"e",@progbits
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"mspSerialReleaseSharedTelemetryPorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"mspSerialWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"mspSerialPushPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fabf885c90292076,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
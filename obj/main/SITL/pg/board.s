@@ -0,0 +1,429 @@
+	.file	"board.c"
+	.section	.gnu.lto_.profile.bd60051e0a232fe6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.bd60051e0a232fe6,"e",@progbits
+	.string	"(\265/\375 B\315\001"
+	.string	"\304\0026"
+	.string	"\005"
+	.string	"\262\312\266\244\n\002\002"
+	.string	"\002\001\001\306\367\202\274\003\b\002"
+	.string	"\002\001\003\351\232\206\240\003\004\240\342\234\212\n\005\240\342\234\212\n"
+	.string	"\004"
+	.ascii	"\273\030\\\334.!l\240\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.bd60051e0a232fe6,"e",@progbits
+	.string	"(\265/\375 5\025\001"
+	.string	"\200)"
+	.string	"\002"
+	.string	"\001\001\001\200\004"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	" \210\232\211*\026R\fQ,\274\330\261\001,"
+	.text
+	.section	.gnu.lto_.inline.bd60051e0a232fe6,"e",@progbits
+	.string	"(\265/\375 \303]\003"
+	.string	"\262\005\024!\240'\351 \266\211\277\244\365\365n\227\207H\204\b\255F\333@\0330P\225],1\244\035\271\021\271S\377+\262v\212\305\201\221\274C\004!\320X\020#\200!\261|?k\263\226\376u(>\033\026\332\"\317\260m\217\377\361\276\357I\202\266\312\363A\t"
+	.ascii	"7\007(JC\0262X\3027\200T\205\020-\205\211\225Z\017\006X"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bd60051e0a232fe6,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"]\003"
+	.string	"\242\304\016\030\260%\351\fC.\230\345\025\r+\345\"7I\222\344\342\"!\313n2\311\033\321\246"
+	.string	"\321M\370\301\013\036\243.\375R\316\200\350\212\370\b\331\224E:\233\316\333&\272Y\303\217+\004\022"
+	.ascii	"`\204V\027e\245A\034\020\301\312\030Y\311\265U\002\270\203\306"
+	.ascii	"T\020lN\016\331<\364Rrd\205X\224\261\240\332\007\314\2167\320"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_.pureconst.bd60051e0a232fe6,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.bd60051e0a232fe6,"e",@progbits
+	.string	"(\265/\375 S5\002"
+	.string	"\224\003?"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\002"
+	.string	"\001\270\006"
+	.string	"\001\002\005"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\330\003\b\b"
+	.string	"\200\214\201\200\376\215\001\001"
+	.string	"\320\003\b\020"
+	.string	"\200\200\203\214\200\f"
+	.string	"\0071cO313"
+	.string	"\004"
+	.string	"A\031\b\334"
+	.string	"\026\016"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_.lto.bd60051e0a232fe6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boardConfig_Registry.11.bd60051e0a232fe6,"e",@progbits
+	.string	"(\265/\375 \220\035\004"
+	.string	"T\007`"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\202\200\200\374\342\203\246\254\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\334\006us\250\365\005uq"
+	.string	"\005\001\006'\001<\232\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/pg/board.c"
+	.string	"\004"
+	.ascii	")\"\301$\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_boardConfig.12.bd60051e0a232fe6,"e",@progbits
+	.string	"(\265/\375`\266\002\305\022"
+	.string	"\326avE\340P%\035X\270\345h\016&H\374\313\033*\241\271\303\245\317\330\236\270\362\2760\024\303%B\331\246\376hMYq\234$\354\332\340\226\337N\264G\356\3038\201\201\344\271\t\036P"
+	.string	"\234>1z\035\204\354\275\245L)a"
+	.string	"Y"
+	.string	"e"
+	.string	"&\300\035\232v\221x\310\035$\036\032f\337 \271a1\345,U\355nKG\034vn\213\360i\302\374\315\244\243\233\305\316m&\"vz\276]\326\363\370\nL9\341\370\230\345<\021\035\023\035NB\236?"
+	.ascii	"3\236\353\307\314\346\r\330\335+=?\314j27\223\335uv\263\235\273"
+	.ascii	"\343\266c\266\017\330i\025\2731u\207xeIa\303&\257\334\221\266"
+	.ascii	"\013C\276\273F\022k5U\2431\233\026K\r\262\377vw\255@\366\223"
+	.ascii	"~V\2469\230\336b:\3024\324\364{i\325tf\372$\352!\207EHmW\247"
+	.ascii	"\226c\243 \f\"\017\333O\373GG\202=\211\346\001v\201\240\232v"
+	.ascii	"i\006\002(\361\035J<\214\372\026U>H=\262\254=\rzJ\264\035\274"
+	.ascii	")eDHB\211**\220\f\271J|\n_lxp\027\020`\204\247)e\024\005\222"
+	.ascii	"\357*1U\325\236@!\337\031\301\017\316Wp\350\354\225/\265p\273"
+	.ascii	"\233@\305\213\0137t\350\323\304CU\225\352B\310\262fV\3321\026"
+	.ascii	"\362]jZ\235\210\312\r01/2\256\023\017\267\224Tx\255\270XZ03-"
+	.ascii	"\231\230\225\013\255\226W\206V\311\210]3.\257\226\006\227\353"
+	.ascii	"\325\362\240\355\337*\220_\021\b\253)\231\326p\206)\275\306\203"
+	.ascii	"\252\3629\242\222e\355\351F\247h\023\220,\265O\024\344;\277\013"
+	.ascii	"]M5E\rBqn\001\247\221\350\007:\235\206\321\231\036u{\232\261"
+	.ascii	"\3711.\203\301\373\220\033\0046 \240\002\221\031\333\003\244"
+	.ascii	"\311\033\206\036\227\030\\`\305\313\336D\211\002AD\217P\323N"
+	.ascii	"\373\2739\036\033\370\316R^;\3634\315@\372\367\223(\346\0353"
+	.ascii	"\220_\370[u\324P\337\256\223k\362\261\255\220E;\310\214\312:"
+	.ascii	"N\334K\\\364\355\230H\300\224\304\345!\334\366Q\250e-l\337P\325"
+	.ascii	"\305U}x\003\214\331\202m\026S\302/\331\236\3308<P\303\372pO\312"
+	.ascii	"\rqok\215\036"
+	.text
+	.section	.gnu.lto_pgResetFn_boardConfig.part.0.21.bd60051e0a232fe6,"e",@progbits
+	.string	"(\265/\375`\334"
+	.string	"\275\013"
+	.string	"V\026N< 1T:\244W\202\001@1\340\250\374y\013Q\335Y\\k\331\214\002\3158*\252u\3641^\255\230\031\214i\235m\003@\240`7\0218pH\r\350\025\3678H\016Ad\023)S\n:"
+	.string	"<"
+	.string	"<"
+	.string	"\005\260G\373)ls\354\325C\323\206\374\331+\210\006"
+	.string	".8\250h\354\356\366\250#\376]\363\372|P\324\271>\365\004E\037\236\004~9\032\354\2563\020w\274m\211\355\005\366)\004\341\237\232~\206\240\203"
+	.string	"\021\273\240\215\032;\2120J\330\276\375\024\307\3264g>\344\034\265\201\204\353!\344L\373*~\372\216\332|\300.)\306\213\335P\301\243\023d\217\016o"
+	.string	"{\314\036\256X\362\240\031\2146h\307>\013\f\231]\341+.\331\356JT\031:\237\304\243\277\301\036UU\006\030\302\223\033v\244\255\271\220\007\257\017\220\211\026\353\243\235\324\222\365\372\265J\262\257\264>\025\313\004L\347@\363$\"\301\343\272\b[%\263a,\334e\233x\232-\362p\227\241x\233\205\256\3636\355\327*\311\327\211P\213\345\321\217U\265t\016\263!\274\005\3670=8\241\230\021 \017\234\202]U\035\030"
+	.string	"d\311\343[\f\271\025\030\017\276d3\206\026.D\bD,\211\ts\022\253\375ZV\001\357\001\024.\033\314\232\0254Z a\351\234rxg"
+	.ascii	"\316\b\341\256s\031\035\363\316k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bd60051e0a232fe6,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\035\006"
+	.string	"\362\b\"+\200\305\351l\330\310\304\005\316\241\013\300\227\304\244\026\356\335\204\337\214\244\231\306\334(\212\016\001\002\017\f\221\210\210\210\210\210\b\267\355\226R\226\344_\021\b"
+	.string	"\360\341\363A\207\2173\377I\207\247D\207\333\275\211:D\030n\206\232V\231Z\230b\227^\226j\225\022\276\273\266a\200\322\301\247(NO\202\242\r\351\036\016\006\267\350\024\\#\341\317H4E(\213\266\033\211\271<J\035V\312i\261\325\316L.\330\335u\264\320\330\276$\027"
+	.string	"C\030\304e\343\234\005\273\f\335\032\3554\001\267\nI\331<\nV\206A="
+	.string	"8"
+	.string	"8"
+	.string	"8"
+	.ascii	"8|\2000\270\364\304\202\341\362c\215S\013\201\205\n:\270A\007"
+	.ascii	"\323\t"
+	.text
+	.section	.gnu.lto_.refs.bd60051e0a232fe6,"e",@progbits
+	.string	"(\265/\375 \023\231"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\002\n"
+	.string	"\003\003\002\004\002\005\002\001"
+	.text
+	.section	.gnu.lto_.decls.bd60051e0a232fe6,"e",@progbits
+	.string	"(\265/\375`\030\022\025]"
+	.string	"\352\242\214#R@P\322\031\016W]\225\031&\005%\031DS\024%!\035D\214\3764df\262\367\364\345\257\226|\250\262QG\200\201\212$\003eQ\f\201\016|\375'\"\372<\200>\210P\345\363,\016\224\t\332EV\207\r\323\231C\\\242\032!"
+	.string	"\200X\032n\"e\n\332\001\036\002/\002\033e6\240\344\f\257{\375\002r;e\327\312\304\344\266l\245l\224\231\0321\303\353\356+K\303b\331,\033\267\317\225\333\267\257\225\215~\327\356\344\002\377\220\334\316\260n:\277n$\231\263\273\277L\376\365\372G\220X\271\205\333'\034\240\272q\\\371\\9sQ\245\327\275\002\001\001m"
+	.string	"\002\272\201\203\"\226\003'}Q\375E\367\007\330@P\375\272\375;\2662\354\223\234\262\037Lvp\272lC\337\266\2345-<N\017\360@\345\336\265\177\325V\f\347\314\355\331\203\323\2452\364\255\222\356\bCE\204\323\324\002uf\245\374\013e\311\026\032Bw\262\273\007\310\t{\"\3458]\264M\373B7J/\224\201f7r\241;e\272\221;\273\036v=\244J\262\270\240"
+	.string	"\323S\240\256\331\320\367\314\007\270d\256\275\243\362Q\201\341\203\323"
+	.string	"\034Pwk\177\200?\353\003D`}\200 \366\007\270_\353d\237\0356\354#H\374w\374\352\256\356u'\207\017\006\276=NOB\375\202}"
+	.string	"d\223\270"
+	.ascii	"\352\267\003p\373\266\003\360\254\036m\177\200\"\326\366\007"
+	.ascii	"\370\357\222\177c\330\256\016?\245T\263\305\272\327\236\235\265"
+	.ascii	"\306\324\016N\277\356\017P]\037\340\252p\302\377+\377\333\032"
+	.ascii	"0\341\337\247\177\003\350\371w\314\177\270\377d\316\367\377Y"
+	.ascii	"\376\207\375\227\373\017-6\375\307\362\277\312\0321\375\233\202"
+	.ascii	"\204\377u;\302\277\035\374\233\201\207\177\305\374\253\300\277"
+	.ascii	"\013\374;\342_\021\377\006\375;\364/\211\375\371\027\350\337"
+	.ascii	"\020\273\364\177\347\347\246\177\225\376E\372\367\350\337\242"
+	.ascii	"\1777\370\367\202\177\035\370\367\304\277&\376-\361\277\357\377"
+	.ascii	"\336\3772\377\347\376w\371\217\367\337\356?\335\377\256\377>"
+	.ascii	"\377\331\376\247}}}}\377\032\177v\362\353\244\005\347)\f~X!\373"
+	.ascii	"\024 \2738\277\370k\230\215\31395F=+\271\305_\2433'd\254I\027"
+	.ascii	"\365\314b\206\254\357\013\013\234r\224\032\305q\037l\256\316"
+	.ascii	"r\334\340\364\034\365s\222W\244\320W\203\030N?\267?\300\234\365"
+	.ascii	"\0012r\350\fu\363F\005\317\213S\034>\343{.\337\366m\370\352\030"
+	.ascii	"F1\031jz\335m!j\256x@1\355\352V\246\322\214\t\247g-\025\314\226"
+	.ascii	"\001\263{\300\356]\233T\313f.A|\275\354\227o\230\207\331\275"
+	.ascii	"\355e7s\303\304@[k&\023\204J\347%\004I\346\273\367-8\315\341"
+	.ascii	"F)\346\005\247\007S\263nT`U\306\350\335\004)\213r\315\201\020"
+	.ascii	"%2\203\323\347\212\331\267\377\275\023UW\226FF\375\272\251\347"
+	.ascii	"\037\330\310ew\307\230Y{\t\205\363\235\331\005\361\347\354o\023"
+	.ascii	"\350_\007g\267\025\336\027\265H\024\344\215#\320O\322}\354\351"
+	.ascii	"\265\227J0\254\243\362y\245\252gm\035\0034\330\216V\256XUi\263"
+	.ascii	"\271\327\336NbU\225\240\\\233K\345\332<\362t\262y\354^\253x\224"
+	.ascii	"b\310\343*\301\260\252\224`\315\252\236N\366\261\301\220:\324"
+	.ascii	"d\263J\331\326\254\342Q\202!\253\224I\254\252\036\033xZS-\274"
+	.ascii	"\220\\{T&\033\306\224\025r\311\023U\256\315\236\353^\261\250"
+	.ascii	"^&\320m\325\\\316!m,\032T\024\006T\031\262\331\004LAe5;\031U"
+	.ascii	"\032iv\033\201R\352)\006\216k\264}l\364\270\303\252\245\242\272"
+	.ascii	"\013\350\265{\252\373\270\035\355\356cw\323,\255\326\356\026"
+	.ascii	"x\224\316\251\251n\346\206\251\266:\246Eu\263\230\026\264*%X"
+	.ascii	"Vs(-\f\314\331,\326\343:{\016k\251\202\035\233\264Tw\257\027"
+	.ascii	"\325Y%#/O\212N\022\033S\3048\335-\313e\237g[\274\353@Y\214\261"
+	.ascii	"\rQ\277\302\236\355\316n\347\234Wmvu1\314\350\001d\355\252I\333"
+	.ascii	";B\203\323\177\265,]\315]\016\2714N\3476\250Pcj\030\302\3517"
+	.ascii	"K\375\256M\366Il\345\215\335f`6\270\034YIN\331\026*\001\222\033"
+	.ascii	"u\234\262\fk\367\243Bn\351Re\206E\224(\254\266>\232j\022\256"
+	.ascii	"'Vj\320\232!E\262\2448e(s\032K9C\031\r'\311\320t=\350\354z\230"
+	.ascii	"\231\022\004\351\004\230~\346\250>\315\363:;\361b\263_\034N\037"
+	.ascii	"\277\232\212\206,I\2260z\255d\202\320y\301\005\213\007\207\235"
+	.ascii	"\315\316e#H\374N\330#,\214S&;C\361\341%L9\306P\206\330\225\361"
+	.ascii	"IQYL\201_\221\321Q\346\211\315\326\225 G8\345\347\357x\nz\344"
+	.ascii	"\212S\006;\227\234\262"
+	.string	"&[V\333\345\367\226\025\007\305)79\177\37555P\034<\260\310\326\277\206\006J\226\033\3160\365\251\227\372\256s\027/\331\257\246\002\322-\343j\350u3A\354\025\022'\326\301\234\2270\r\033\260/\270e\r%J\314l\2704\035\027\247OW$\371>9\311\322U\300\323\235\365\002\255\227\314\020;-\222ZQy\352\027\206\345\343y\271O>2\222\rM\326\343\315\227\262\030hz\275\264\n\201\0236dE\024\247G\326$\227y\351\002\207E\375v\315\340\032L\352X\206\r\246\321\245\245\311XH\254l\327?\304d\032:\307\236\356\035tN!l\204\213\360\020\346b\"\373d'g\235\2538F\222Y`'\337\340\034\033\335z\240k\316\311;\030\310F\231<\235<\343\202\327\335@6.\260\242W:\351\214\337q\200RV\300\344\356g\0278\310>\031\3107\254\335b@\230\007\377\330(s\355\030\037l\301\001%"
+	.string	"('On\356\006\360\007\373([\265\274p\312[4L\033l+\236=\366\311Z*\230$i{\277\273\251\362#\353K\375\257K\375\217K\207\212\005\357\352\315\207\372\037\017\225\255\370j\237\037\030\307\271\005f\3413\310u\335a\027j\030sb\245~?"
+	.string	"\177}}\373\001\370\237\r\225\327\007\310\363\243R\377s\241\376\\\203i\314\200\315\360\345\215i<\34187)(N\377\213Ry@H1\f\246\372kv\224\240\365 \343S\003\306`\212\"\212\237\013\214\301\244\036\b\214\204Dc\221\206i8\204\200h\306\030LQD\241#\\\"\032\213B\301\243'&#\341\222\020\261\370$$"
+	.ascii	"\023\323\223P8\024\322\2340$*\031\207B\032\244\242 S\252\302"
+	.ascii	"\311\250)\330\004\274R\320\020I\270Dd\204\224\302\030L\302Q\341"
+	.ascii	"4\214\200\247)h,\252H\001\200\361JAINBIN>F\302\247\033!\022\023"
+	.ascii	"g\212D8F\"a\222\323\2140\311\351g$*1\244\246\305b\220xtTD\243"
+	.ascii	"\302ih\224\022\215N\277\243\2400i\211\251\210\346(X|J\215\202"
+	.ascii	"E\232\023\211\222\234\202rT\020\215\305\245\244\240\006D\001"
+	.ascii	"\\)H8\\*\022\203&\b\0351-=\211`\2001\230D,2\332\334\350GD\220"
+	.ascii	"\221X\344\024D$\234\300\030,\0065Hr\342p\243%bP\030LR\317@\t"
+	.ascii	"\005J\230@\201\346&N\2108!\002x\023'\206\206N\224\030R_b\350"
+	.ascii	"g$\n\246\260T\004\032\257$\300\207NA\242\220q8$\n\335\030\203"
+	.ascii	")p\212DIKH\302a\0049E\302\244\245b\315\021\nb\220\370d4*Bz\022"
+	.ascii	"\0265\351\020\213\224\214\322`"
+	.ascii	"S\021\0065F\"\023F\341\322\023\315\207\206\"@\200\003\f(P\215"
+	.ascii	"\202\204\222\234\204\204KEMBF\304\242P\320\2171\230B8\\2\026"
+	.ascii	"5\021\207HB\024G\304\242\241\b>5\234\371v\362j\350\270\301)\357"
+	.ascii	"q\231\337\013N(t\277\373\226\235\"vP&\234"
+	.string	"\362\030&\263\345\034\223r.\307\333\3213\242\247E\317\214\006F\f{=\304\360\222\035\274=\263+\016\343\346\326\205\266\205\301l_\026\2742f^\316_\366\324\342\3448\345.\234g\223U\026\215B9\332%d\213S\346\302x\017\303j\201\266\264\231k\201\205\230-p3jM2\312;\2714kl\013\211\035\253A\220'\305\203\353\326h\bk\033\323\262\247\206\221\321\206\305\351\334\034\253i9\343j\350\001\353\210h\321\022\222\345\317\302r\377%\033\207\022'\315\031\336\232\013\253\2708\226[\032j\230H\271\360\222\373sf\330x\323\243\242r^;\025\206\373\205\331\265\231\315c\027\023S\2249b\244\340\305h;\303\235\243#H0\333\216\027\f_\2528\r\201V\250q$\210\2244ffFDF\322$\351!\005\204 (\251\263\033\021`\245\223hj$IRh7\257\304\227\025\351\302\242\017y\202\013\250\331A\016\202"
+	.ascii	";\350#!\025rg\221z\242\244\363\344\210x\334\251\t\326C\203\213"
+	.ascii	"\223\242\006\304i\2374S\ng|U\347\245d\3673\037\252^P5\342q^"
+	.string	"\301\373X\376\377l(\013y\005~\212#\375\n\020\217f``\\\326\263\200[B\351\231*\203\200\337Pd+Hv0@Ai\fuk\300\340\363\212=c\\o\270\020\340\211E \267\020\217\204wI\344v\271K&\016\371|'\254\005:S\013\b\235%\330'\246\302\360\370?\337=\016a\204\333\203T*\221\220,]Y\276\233\261j\020\021\216&MA\024\021\237>\0068E\310\020(,5;V\327i\363|\272\230J\321,=X9\273\363X\315\364\035x\245\346T\275\245\330\026Y\376\347\212\203\013\255\312\324\250\n\353\250*Y\211\252\026\373\363\341\346\265%\332\321\241f\022s\344!\373\331\242\275\034\3063\226\373\314\025\306\200\345R\377\0210\313\246\266\022x\035\303'5\246\372A\324\340\272\212D\022\237\037i\223\373\324|9\226\302\370\037\335<\240\224\217\240\3560\375\317\246c\203\005-\325fy1\246\372\244\"Q"
+	.ascii	"PJ\247\216?\020$\341\360\241c\345`Y\251\300\206\t\016;J\327\361"
+	.ascii	"\r\fI\260\254H\343\335\177\205?od\207\305\217\210\204\2112j\200"
+	.ascii	"\026MX \220\307\351\356\271|\322(\311\027\206\342/t\333\226\316"
+	.ascii	"\nZ\241\017l\023\022\264\231\032\332\310\366m\373\314\257\357"
+	.ascii	"\261\023\226Z\023\211\226\025\277\317G\235\025\206i\370\242A"
+	.ascii	"\0241\2325I\233\250\354/&:\002\344\027\n\214H\352:\211\354n2"
+	.ascii	"O?\261\362\007\265h\374c\252,\205\021\003\341\231\\\0340\351"
+	.ascii	"\\\336'\"\337x6\013\240x\331R2\255\212\030B\003\351\263D#\331"
+	.ascii	"EY\327\340\234\bXE\222\262\334]\033\037g-\256\"\275j\262\177"
+	.ascii	"\264\037|9|X\306\302\3245:X\334\226\201\005\204\226ujr\013\017"
+	.ascii	"\304\201g\"v\225\242~\320`\237w\201\312\204\2438)\001\315\370"
+	.ascii	"\207\2629\331\234\036\230\230HZ\330=\236\013\256\252(\345\300"
+	.ascii	"\310\220[Q\262\254C\f\033\023\\)\264\375:,\377-,]\023\224\333"
+	.ascii	"\217\371\006\364L\250\025\373\233E\323\364?m\3366\313\216\200"
+	.ascii	"\336\331\361\340\236\b\277{}\304\356ov\264\247\362o\002\361\312"
+	.ascii	"\346\332\261Q\231\273\242\203J\363d}\352\267\275\362\177.\277"
+	.ascii	"\303\007\316\333#\377E\256\002"
+	.text
+	.section	.gnu.lto_.symtab.bd60051e0a232fe6,"e",@progbits
+	.string	"pgResetFn_boardConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"boardConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"boardConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"boardConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bd60051e0a232fe6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,270 @@
+	.file	"gyrodev.c"
+	.section	.gnu.lto_.profile.6a1ef3866826847b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6a1ef3866826847b,"e",@progbits
+	.string	"(\265/\375 +E\001"
+	.string	"\024\002\037"
+	.string	"\004"
+	.string	"\275\321\333\306\013\002\002"
+	.string	"\002\001\001\343\210\301\276\f\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.6a1ef3866826847b,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.6a1ef3866826847b,"e",@progbits
+	.string	"(\265/\375 2m\001"
+	.string	"D\002&"
+	.string	"\001"
+	.string	""
+	.string	"\004\200\200\200\200\003d\001"
+	.string	""
+	.string	"\002\001\002b"
+	.string	""
+	.string	"\007\200\200\200\300\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	".\241n\240\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6a1ef3866826847b,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.6a1ef3866826847b,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6a1ef3866826847b,"e",@progbits
+	.string	"(\265/\375 -%\001"
+	.string	"\320!"
+	.string	"\001"
+	.string	"\001\270\006"
+	.string	"\001\002\002"
+	.string	"\001"
+	.string	""
+	.string	"\b\b\001"
+	.string	"\001"
+	.string	""
+	.string	"\b\b"
+	.string	""
+	.string	"\003"
+	.ascii	"4E\203P6\200\005"
+	.text
+	.section	.gnu.lto_.lto.6a1ef3866826847b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroDeviceConfig_Registry.17.6a1ef3866826847b,"e",@progbits
+	.string	"(\265/\375 \2235\004"
+	.string	"\204\007a"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\202\200\200\374\342\203\305\261\033\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\347\007us\350\366\006uq"
+	.string	"\005\001\006'\001\b\234\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/pg/gyrodev.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_gyroDeviceConfig.18.6a1ef3866826847b,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\375\007"
+	.string	"\322\31786P\217\032\003\240\222\f\367\017\"&n\370\210\025\225\264\334\303\343\332\225\231i6\032\2710\300\030\257\341\"7e\213\231\031\342,\2504\265\b8\206\r\024\204l\271\245L)\r\"\316C\002}4\365l$\320\207\353J\241\031\032M\221\003\303\303\364t\020s\353\224\033\201\272\031\301q\335\344|w\366\310j\346\341\212qA\305\212\326%\255\225\360HI@\345\177B-2A\021\320\342\260\254M\232\345\246\372\310x\301\240\340L\373\235`\324h\235\375\177#\2535\314\206\231\202+\366\322i\371/fd\236\"Q:8m\r[\277\f\342\031f\362\300\317Z9\371?\204\036l,\373\271@\263\334\230@\263\254\327\262\370k\335$*\213\222\330\377\0317\354\031z\265C\f\220Z\235\f5\013\377\013S+\f7\272\255A\333\255\255I\t"
+	.string	"2C;\0258x<#\023\232\301\274K"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6a1ef3866826847b,"e",@progbits
+	.string	"(\265/\375 E)\002"
+	.string	"A"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\022\177\003\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\021\004\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\016\005\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\017\006\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.6a1ef3866826847b,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6a1ef3866826847b,"e",@progbits
+	.string	"(\265/\375`\177\n-;"
+	.string	"\372k\210\027@P\246Q:\373\276o\353\273\240jby\021L\353\367\253\373\275\276c\201\210\302<\216\372ou7\322\237)\336\277M\177u\023p{~&"
+	.ascii	"\323\023\021\375taw\177_\324@'\320\3326\001\371[\246D\001a\001"
+	.ascii	"i\001?\003:\377\261bd|\246\330\324O\325n\320\234\244.6=[\271"
+	.ascii	"g5k\330\315\215M\033F\3236\306\016\23377l\033\336\260\333\223"
+	.ascii	"\256{\t\2314N\303\306n`\324\310e\200\303t\030\332\004\341e\214"
+	.ascii	"\\w\237\311\374\274\037\303\006\276\303+\243\261Bv/)\233:\322"
+	.ascii	"q\313\"\251{\345\303xX\017\367a(\357a8\316\303O\276\303u\316"
+	.ascii	"k\367\204*(9pU\274\fH\317\310{\341\3458,\207\237U<\247\241\330"
+	.ascii	"\017R\b\231M\017\274=:\312U\352{\3671\356_\334(\025\267\352\304"
+	.ascii	"]\320\346t\351\313\2459\233>\304}\206+\201\251T.\303f\370\211"
+	.ascii	"\200\317\034\303\206\353\214fZ\255{\205J\217\3009\261b\323S\270"
+	.ascii	"\347\265\0170\323\033\016\340\236\021\250\034e\004\352\355\275"
+	.ascii	"\300T\252\007\246R\177\026\363s\030V\253\322)\301\234\315\326"
+	.ascii	"\275J9\031\252\004\267\307\246_\231J\275<\245\376\307\363\177"
+	.ascii	"\016\323\317w~N\360\363\203\237\035\374\314\340g\005?7\370\031"
+	.ascii	"\302\325\317\273\237\017\374l\305\026\376C\375\226\305\317\025"
+	.ascii	"~\246\360s\204\377\207\376\373\371\377\347\277\332\377\335\377"
+	.ascii	"<\377u\321h4\372_\371s\364\277q\001k\263\005\330CG\216\214M\005"
+	.ascii	"X%\367\034\210\005\235\007}\020\037\272k\017\3415011I\335lJP"
+	.ascii	"\221}\234U\f\235\017=\221\200\266z\302\342\026&\307\246\177\304"
+	.ascii	"\205\3767\355\030#\207Y\210\320\023\036CM\240\370\211\3236\004"
+	.ascii	"\315\246O\216\343:\377\273il\r\022\234\240{\373\253}\\v\267\030"
+	.ascii	"\323\332K\244\2003\023\263\204\337\211u\334\340\177\332}\004"
+	.ascii	"\216\272\313\2648\272Y\336\216c6\375\277\240\357\245\333(\325"
+	.ascii	"k/\225\3173\243\362\214\037\246\324\332f\004\372\331\244\225"
+	.ascii	"\353\0313u\266\355\265\271\223"
+	.string	"g\314\034\312\325\271T\256NcT'\235\306\356\225\031\245d;\032Y\371<c*\237N\246T'\333\330\317\243\331M:\231J=Nf\224\362yd*\223gL)2-P\226\374\370s\346\205\231\312d\013\t#;.\243\240\312\325\331q\335\314\346\325\313\006\335d\316e\334\021\t\273AB\205 \327\034\235] \f\211\346\354$T\251\305\331\255\005i\243\3034\030WhKa\250\261\tY\203yu\033\350\265;\254\333\310\r\355ncw\357\226dk\267\222(eZXXw\263*\254\311\214o\274\272-[!7L\345\023\315\311{\203\346\231\326_\253\221\323:\356ly\237\3062\r\326\335\334\350\2461\2110\262iLK\204\013\037V\373y@\354\327\223Q\252\273\t\2414&\326\211mb\317\254\323\242\361\323\232\331\"\267G\213L\276Y3\013f\227\f\215\"B-\316&\315\254\021[\306\320fT'\333(\2320\001"
+	.string	"\2203h\331S\352uDVHe\2121\210\344~Kf\227\360\323\226\275*\303\317+\263G\354\030C\233k\213\311H4\266dB\201\tN\214"
+	.string	"\305\215\251cV\311\232\025J#\233\332$\273&\222<>\306\220\360\3236\357#/o\346\216(@\235)h\272\346\275N\354^\347C\354\006\222+\333\023\275\267s\327\206Y!\374\214`\207\334\006\341\2673\035\327^-\025Kmk\214\3569\202\252\213F9\202z\213\350\332@\367\026z\177\253\264_LO<\216\366\330/\267?p`H=7\212\247\324\005<\245Z\t\2268j\373o\202\002\343\346\211\0329\367|i\305\024>jl\232\362\347\250<w\256\3647\331<W\322\302\336\356y\022S\372\233\236\342\254\264\225\261\351m\232{\226\304\244&\352(\211M9\322\365\262_\""
+	.ascii	"(k\303\204#\375\274\210\0311\244\031\335\311\356&\300#j)\222"
+	.ascii	"M\331\021?:C"
+	.string	"\342F\fI\203\263\373\310\220\240*u\037\241\230\03103H\301\240]qS\323[-\367qL\245:\361\224\312\212xg\271)u\331\f]Y\303\341\210.\341V\t\003]Y\303\341\b\034\276\"\261\313\005\226U\3616,\374\204S\275 W\200`\r;d\"b\t(b\005\177B\246\340O\250+bq\340]\037\017 1\315\332u\t\267z\351\260(\324i\371vZ>\"W\032\334\002\026{>\342\356C\254\237\320\202\3230\313F/\355\032\026\211\300\237\257E\201\367\260\202'\212>\242\257\305Oh\340=\340\320\027\364\375\3565p\250\300\301\303\216\335=|\270\360\341\202z\017\037x\274\017\034x\367\034x\272\342mT}K\350\033^\025\267\266\206W\001\202?\340\215,&\"\326\017X#\270U\302\327\003\352\360\231\030\240\356\360i\005\201L>aW\221\310EcG\344\"\001\024\022\325_\326\213 \261\247\022\271H\3640"
+	.string	"\325\"\226\207b\020\310\265#\022}C-\255\021=\f@"
+	.string	"E\254_\326\213-\340\356<^\211\0050V\240\270=\013:|Z[\303\256\337\325Ox\025\004f\341\270\352\r\211W\026\b\374\262^"
+	.ascii	"\213;|\2734K\205\031Yy\202\261W\370\320\027\332\032X\225*g\204"
+	.ascii	"8\363\360\231\023H\312\323J\261T\252\242:\2716\305M/\233\024"
+	.ascii	"\270\315\322\221\210Mo\251\314\350f\033\221\306e\222My\274\333"
+	.ascii	")Lf\256L\035\266{\376\302\234\350\326\310ONd\241\350\224\315"
+	.ascii	"&\322\001\r\310\222\214\302}3\333\"\310\246O\326\244]\323hQ\237"
+	.ascii	"0\367\254\346e\225\206|\374\260_j\205\002\200\257\250Q0\247\224"
+	.ascii	"3DdFfFF\232$\007p\002\221\2512\362\021\200\245cfjD\223\244P\350"
+	.ascii	"@\377[O\314\345\226j'\034\243\326N\237,\221\3367x"
+	.string	"\220y5\265f/\214\\_^\251k\024\232>05\342\320\331b\202\266\256F\374\207\002(\274\r\n\207\335\002ON\307\246\373\220\006\221\201R/\220\201\025\203\22656I\323\265\311e\025\250\232b\243\033\361\320[\214\017\211\375\377\356^\026=\321\375`yu,\001\327\243\262_\236K\024\005\220@p\313\237\005\222\200h\272\271\270\346\235\313\001\f\207\032nc\241<\027\243\013\261\330\220Vo.\026\355W\333\22656,\224S\004\367\324?\306U\013P\231<\017Q^\317\306W\321\221\025\365\355\211?\231\001\027\350\353@\234\331\352\233\363-iFR^\354>14\241\353\021\242\025\360qz\b\304\024\017\356\350\\TD\243\004\231J>\f\002;;\b\246\256\215\246}\340(\0028\306h\315\300\257\007x\001`\342\2702=\024d-\364]z%\032\"\3024$\266I\201\224\264\f\274\023\210\212\244|s\266F\r'\r\253"
+	.string	"i\\\347\333\300@\371\2517\001\261\267X-9\212\3303\004\265Z#Sa\341]p\323\220*\307\357\275\244\261\217\n\275\"\326\036W\210\320\235\310\021\""
+	.ascii	"\005\352\306mj\241\376\277\016\006\352\272\336V>\221\317\267"
+	.ascii	"\307\356\t\317\274*"
+	.text
+	.section	.gnu.lto_.symtab.6a1ef3866826847b,"e",@progbits
+	.string	"pgResetFn_gyroDeviceConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.string	"gyroDeviceConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"gyroDeviceConfig_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6a1ef3866826847b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
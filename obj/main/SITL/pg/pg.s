@@ -0,0 +1,537 @@
+	.file	"pg.c"
+	.section	.gnu.lto_.profile.d9bfb323ea9bec84,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\004"
+	.text
+	.section	.gnu.lto_.icf.d9bfb323ea9bec84,"e",@progbits
+	.string	"(\265/\375 v\005\003"
+	.string	"\304\004j"
+	.string	"\b"
+	.string	"\247\267\241\312\002\004\002"
+	.string	"\002\001\002\002\002\001\001\227\267\273\373\r\002\004\356\276\277\360\003\003\002\001\007\262\211\373\251\013\002\b\276\362\342\333\004\t\303\341\316\304\007\004\002"
+	.string	"\002\001\n\301\256\303\221\001\013\333\205\320\333\016\002\002\002\002\001"
+	.string	"\007"
+	.ascii	"Q(\2243\f\270\202\224E=\247\224\031\332\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.d9bfb323ea9bec84,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\r\004"
+	.string	"2F\017\022\260%\351\035\206a\0300\026\3156\262Ik{\313\224\002\356\002\024\206M7C\244\354\270\"Dy\217z<!\346a!\351\243\361\225\312\224\002\317\254\006\352\030\212\253\266`o\216\266\261|\001\034"
+	.string	"\020$e\b\266\n"
+	.ascii	"\331I\215sW\326\316\034\0057\020\035\304\"\204\305\022\322`\001"
+	.ascii	" ,U\214V\300u\310C\3520g\250\021\324E\260,\323\254(\013\234\001"
+	.ascii	"\244\332\271\312\365\314M7\265\234\006\206"
+	.text
+	.section	.gnu.lto_.inline.d9bfb323ea9bec84,"e",@progbits
+	.string	"(\265/\375`\207\001\235\b"
+	.string	"\322M-1`M\222\016@\234\261\204\rP\\\323\307\354P\261k\340\013\f\332\224\231\252w\006\241\226\203\220\005\230\342\032\270$\311*=\262\325\315\r\265\326,\331r\247\337\204\331\210\316\206\023)\364\241\263\341HS\244\312\344\2561xu\210h\200\264\001\034\236\037\240\270\220\340\0208\272\377\204o\351\261\373\016\360#3\241\241)\353\330Q\326\215\321\033`E\210\007I\353_\246\020\026\225\206`\366k\236\317\340HCFI\245\177\t\2556&.\351\273)\013\377"
+	.string	"\326n\323\227v\366\005\361\262k\271{1\315\314|\236!3\253\207.\300'\275\247\327\033\316z\343\207P\214\314\244|t\027\002& \200\002\241\240\214\017@\025#\337\255\234u\234\271\364 <\002\220\034\003PLp`9\353\320I\271\"\360"
+	.ascii	"\336\302\332\234\003?8)\037\267\341\277\035g\032f1\261 \346W"
+	.ascii	"\357Ui5\320p\200\260\257\345k\304z\305\326\022\313j\257Z\214"
+	.ascii	"^R[\371\315d\264\213t\r\r\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d9bfb323ea9bec84,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"5\006"
+	.string	"\342\n\035\"\240%I\007\243\373u\256\002#[\313\377\377b\331\357\260\252\252E\t\3425\fL\264\326\332\316\233\310$\003$\357n\354\033\353d\212L>\274a4\202\360\356\325\225\365\016\360_\007\311\224H\017|\215yUw\364\305r=\361\210\027\\S\022\347c]I\363+;\212.\223o\031=\364\023RJi)\314\307\320\177E^\313\341\345L\232\365\212~9\370\021\r\036\020\037"
+	.string	"9wB\272%\322\0204Q"
+	.ascii	"\302B\200p\214\2731\207\021n\250\346\bC\363\"\004\210-~Y\033"
+	.ascii	",\253=Y\021\235Awg\001\037\314\f\340Um@\333z\001a\314\345J\f"
+	.ascii	"=\340@\t\020\246r\267\212G\212\025@qK39)\200\033"
+	.text
+	.section	.gnu.lto_.pureconst.d9bfb323ea9bec84,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\231\004\001\205\004\004\231\004\007\231\004\b\231\004\t\231"
+	.ascii	"\004\n\231\004\013\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d9bfb323ea9bec84,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\245\004"
+	.string	"B\306\025 \260%\351\200\303\260\b\360ra \313\032\200\212\002\246\b\364\201\330.\326\266fm#\226\020\"e\n3\205Yi\266\230\302,u*\017tP\264D\223\226#\270\033i\037\005\026\3278\241\0024\206\32668)\232H\251\020d\341G\244\336\335\234\243\366\243|9\033\023\236'\030"
+	.string	"H3FSbES"
+	.ascii	"\327)\214\303c\r\b!#`b\300\\(y\207\351l\331\303Y;\354\001\300"
+	.ascii	"\305\200D\320\262W\334\202\3247-Q*9\327\330\026\001 \274\001"
+	.ascii	"\300\001"
+	.text
+	.section	.gnu.lto_.lto.d9bfb323ea9bec84,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pgFind.8.d9bfb323ea9bec84,"e",@progbits
+	.string	"(\265/\375`\371\001\375\021"
+	.string	"\246\"yH\340\322&\035\222c\034\027\362\365`*R\375\237\221\352&.c\366\312\317\234af\305\340\273\376\002\342\2015\032\2622\3566D$\267\264G\231j\216y\2161\206\020,\200Q/~\207\227\366d\322\262\273\025\203\220\275\211\224)\005f"
+	.string	"_"
+	.string	"h"
+	.string	"'!\217M\004!\327,\310\234\341\347\360&\362\321;\211|\334\021\226=9D;zr\210\222\316\205\267T\326;\031\271U\226\217\341\335\b\314\365\331\265\006\006\252Lq\363\030eI/\230\207s\\\003\237\026$F`\031\270\005\242\035\231`-\335\317n\022\003\223j\260\233k\2472\347\264\276`6\267w\333 l;\260\265$\335\303_Fu\264Z/\273\017"
+	.string	"\202\213Vb\233\223\303M\310\304\021g\240\270\354\267\357\007\235f\233\034s\031&\020\0132\347<\220?\363e,\025P\303\203!\265\037s\206\n\036}\300\213\261M\217\267el\223\355U\373?\207!\363\320\202\343\234!jFs\206\013l\300{\024\240w\361\0272f\005\333q,:\034\321\250"
+	.ascii	"\365\246;\244\263C#r\373\025\331\032\017(\322Q\3426fo\345~\366"
+	.ascii	"o\260\311\241\204\324\243\245K.p\273\213\214\353\355\t\020\027"
+	.ascii	"\016\2507\237\346\324k\024\2749[)\376\320\005\030\377\304\243"
+	.ascii	"\317\222\217qO\273\342\004\361\250\341\3633\243\267E\362\001"
+	.ascii	"T\333\215\331!\250):l\224\360\356\330\"Q\355\005\236pbY\355\313"
+	.ascii	"I\265^A9\251\276\223\352{i\221\340\362\255\254`>\024\022\247"
+	.ascii	"T,\253\257B*\265\372L\236\371\356\3701\316\255\260\321l\362B"
+	.ascii	"7'\262\252k\225\231\005Mt\0333\203\017\261\333nI\315\202B\300"
+	.ascii	"\363\255\361\215P\336\2344\177\371E\267\235\270\026\224\374\013"
+	.ascii	"%\037\277\001D\004\335h\351\322\2719\347\224N\020% @\002\204"
+	.ascii	"\034\245\007yy\321ab\333\330\2630\370\243@>\227\031\370\250\337"
+	.ascii	"\213\254\262\345\350\305\202-\336/\322\267d/.B\354\201a\300G"
+	.ascii	"\335DQ\016\013\335\265\200\346T\225e7\312\266?\264'\210\006["
+	.ascii	"\\\017\335;\370\214\320r\272s\212&?/+ \303t\t2"
+	.text
+	.section	.gnu.lto_pgResetInstance.10.d9bfb323ea9bec84,"e",@progbits
+	.string	"(\265/\375`;\002=\023"
+	.string	"\206\343|F\340\322h8\222^ s\334.3\356C\2542\021\225\256\200-\336\363\367\365\373C\036\210%\203\302z\017\027f\204\326Xa\314V/\212\312\271\232\340\373<G\236k\234w\275r\3654S80\302\005\356\223\275\367\2262\245k"
+	.string	"^"
+	.string	"i"
+	.ascii	"\f|\340\364\320\274\253\304\207\247\217\210\017-\263}\020\230"
+	.ascii	"\001p\204{\301\264\273+-q\331G1\0045e\376\230Rs\224\323\315>"
+	.ascii	"\212\340\b\210\240\244\224\016\007.HJ\021\002\245\273e\250\037"
+	.ascii	"\226r\272\232\203\240\002\245\031?T4'r(\235-5\245\233\001Kv\367"
+	.ascii	">\317\016\272Z\346\230\262\273\316\234\316\303}\272m\031\333"
+	.ascii	"(v\302\0042z\240\247\215\221\222Q\317\216\226?\233WK\305\261"
+	.ascii	"\017\356\356Zo\3541-r\336\0372\246O\337\375\243\230\006\305\264"
+	.ascii	"\206\351\004\323O\005\340\031\340\333\245\371\001Y\244\220\b"
+	.ascii	"\205\355\373\275\003\305\374\307(;\250\207v\214\215zx\224\355"
+	.ascii	"\344m`J\360\264\357\342=\262\357d.`\367\346\306\320./=\034\266"
+	.ascii	"lz\356\356L=\304B\220\263{{\316\227q\241\t\240)\260\304\347X"
+	.ascii	"\342J\357\310\226M\266+<\310\202\212\207}\3411T\036\246rv7\325"
+	.ascii	"\204\247\305.\225W\223\207\250\335r\345s.\271\351\314\"z\275"
+	.ascii	"\317U*z;|A\f\374\336\"\236TDI\212p6\265\374\371@\316p\237\313"
+	.ascii	"i\327\346\300\207\001{\371&\002\306\320zQY\001]\255\230\232\345"
+	.ascii	"\304\005[\271`+\r-*.+\226\330\313\352d\304/X+\266\202y\275b+"
+	.ascii	"\024\217vp\365&\\B\242im,\220!jP\335@\204MgN\0055\\!\224:#t\354"
+	.ascii	"\210\017DU\016\275\036\251\252#\211\037.\b-\177V\235\037\237"
+	.ascii	"\215\220$\257\251\020\"\264r \335t\346\032=,r@\305\361i\260^"
+	.ascii	"D$Aw\0011 p\002\031\261\355\001\001\302\313\334\036\312\326\n"
+	.ascii	"hP1(b\013;\036\320\nU5\\\266\317\312\330.X<\344*\017\222\303"
+	.ascii	"U7c\n\337\200\260q[Uk\027\304\266\002X\201\330\260iV\335 Xk\036"
+	.ascii	"\362\264\003*\025\244@\202\254\034B\322BP\214\211\340(\362HV"
+	.ascii	"\256\256p\2271\"\200F\001^\202\315k%C1\013\261\350_\277\316&"
+	.ascii	"\2042"
+	.text
+	.section	.gnu.lto_pgReset.11.d9bfb323ea9bec84,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\345\b"
+	.string	"\006R?80\345(\035\200\177q\031\350j\030\006(\375\301l\245\023#\3417CNJ\027[\355\307\326J\213&\003\346J&.\b\030\301\200E\3241\036\224]kA\331M\006\267\2252\245."
+	.string	"/"
+	.string	"-"
+	.string	"\337\t\256C\354\232\353\320\236\315b@\022\b\260\261r\331\335\250 \367\236\236\377\3243%S\350\031\320\260\273\316\222\251\343\326\333F\260\235`\373%\t\0274\nZv9Z"
+	.string	"\226\005WF\374\223\253>\377\fS\331\241\375\261\263\303g\266\237\366Kn\342\035\005\372\300\356)Ee\367S\360\001v\350\032\362U\366|e\201\355f0\370(\030\027~\310\241\017\272\016U\257zz\210\220\240D\331\262\277Q\352\207}\314\356\256\365dkZ\217\372\003Z\247Ss6\032\0275.ND@HDN\347\211\033\2157\256\323\305\212m\353b\366\211\216Y=\331\301\304\022\351\310\231TM\2657\212|\311O\375\241\305\"\005\n"
+	.ascii	"2\241\373/\260\301\205\003\227\321L\305\003\032\260\nA\233\325"
+	.ascii	"\351p\r/\204I\006"
+	.text
+	.section	.gnu.lto_pgResetCopy.12.d9bfb323ea9bec84,"e",@progbits
+	.string	"(\265/\375`\327\002\375\026"
+	.string	"&\253\227I\260VU:\364\006X\276b\321\210\224\271\370\314\311\332\244I\304\257g\271\244\210\305\370x\007t\027\"H\001\212t\306\255\335\031\262\305\360\013z\263\202\366\203\376\223\337\033=\271=\240\256\323S\354\277\004\233\016\203\f\021B\b\221;\245\206"
+	.string	"}"
+	.string	"\204"
+	.string	"\007l\240\274\350\363.\343\305\362\247\361\"\202\0040\307~\246\330\271\211\232\316\215)\265\236\250E\341\361\247\347\227\344\247\347w\364\360\274E\032{I\216b\2704\346cx\271"
+	.ascii	"W\005\210J\t\036\334\311\020\246\007\206\357G8\340B\001Iv\310"
+	.ascii	"\370N\207\216,7\332\177\247\266\233\214\212/<<\f\025\004\321"
+	.ascii	"P\301r\233\205;\30432o4\272\377\335E';\352\335<\234\2225\265"
+	.ascii	"V\323\332\215\347.\335\366\f\333\fl\352#\344\205~\361C\377\232"
+	.ascii	"\372&\223\022\021 L\330\366\350\254;IUj\021\261\207\317}\277"
+	.ascii	"}\377\306\211,|\207\t\350\246\350\270\317\377=\007\214\346\212"
+	.ascii	"\200h\034\307{~\335\206M.D\200\250\265\036\207\237\303\246_\347"
+	.ascii	"Q\250\221i\250!/J\021P\314E\307\224/\333\264`\233\027o\303l\323"
+	.ascii	"vx\276"
+	.string	"\006\354C\027,\326:\302\367R^\004@)\265\017\364 \330\205\354\344-\265\346|\212j=\003\275\033\251\312Zi\257\371?\016\304&L\251\306\327T\343ErM'vCf\024)\254\265V\021\346\247\221\334\225\245\351`D\213!\323\021\"\027$\\\235K\273\373\337\277\201\307\b\224\340\222\031Er\201\244\257\306rK;@\212\016NF\223|\"\337\234\207\204\262\326\331\214_\324\302\361[P\330\023\235\342vJ\210\004\t\345\320\244\r6\031\352\355\352\354SF?sD\310\no\316&\251\315\225\222\272TR\227\367\335\001\216\260R\271v\302\252\265\027Z\254T\350\224\314\252\205Z\265P\023nlpP)\327\013%s2\253\245r\241*\260X.\224i\333g\3167\3471\330\303\003\216\336\275Ap\207\007$\377\330\370\265\255krV\326\242<Qq\315\265\035<\240\273\227H^\024\241\362$\303b\b\340\223\373!W\027\316"
+	.ascii	"\362\200\342\201w\270\344\232\300\233\373\335[\316 \t(A&3\212"
+	.ascii	"\304b\\\235i>\204+K\"\321\367 \250^R\220ks5 0\002b\234\323\016"
+	.ascii	"CtH\321\036\334\212\271\340\250\327p\313\314+\246\203\267Q\330"
+	.ascii	"\2327\203\344\221-\273\034'\266\n\265\326\343\372H1\270jdd\020"
+	.ascii	"\007D:X\260B\301\\^_\345\252\005/\264\260F\274`\261\312\300\016"
+	.ascii	"\t&8\036\241|mm:\331B`\317\314wX\224\021$\252X\330\341\267\034"
+	.ascii	"\375er\216\336*\\\314\004\300qz5\354r#3\327\320\\'$\t\022\246"
+	.ascii	"+\220\001"
+	.text
+	.section	.gnu.lto_pgLoad.13.d9bfb323ea9bec84,"e",@progbits
+	.string	"(\265/\375`\334\001-\021"
+	.string	"\266!uG\340\322&\035\243j\334\\\tb\020#V\31254\0214=K\353\034*\313\213\037GC:\246O=uq\321\350\332&q\366\266\\\373\336\347I\243\020\351\320\254\243C\026-n\263\007\207\255\250\204\"\203\236XB\266\224)\005_"
+	.string	"]"
+	.string	"b"
+	.string	"FE\b2\355\317\270\216\353;0'\331\275\001\022\332\rMl\300;\347\360\002\272s\336K\272s\266\275\200\201\313\257\207-jn\223BD\r\244\335\020T\026\177=j\276\374\020Y\314\243g\342\032\037\320\2666\"\213E\023\214\333\213\317\23642X\246\tew\2353\262\0227w\333\021lS\260SB\351\357>\177\310\177~\020\247=S\272\373\316\2551\235"
+	.ascii	"\034,R\017\002F\2735\267\037K\304\341\310\261}\377\306i\255\003"
+	.ascii	"\231"
+	.string	"\343\031j\3716\036\364r W\250\311\330\335\357\305\376\316\245\355\262?\373\307\266\030`c6$\024D\032\357q\335\3076\203\354\256P\022\332]\023'\360\316\025\210\032:\007x\206`;fK\247\333\326\235\364\323\001\266\020K\260\274\3714gx\216\224\223\236\366D\241\304\003i$;\345\324F\245\3623\376\354\026b\020\3718\002\2411~\220U\027\352\340\355\306\032\3705\227\025\337\005Lw\256\323\007\235$\351H\205\316\216L\336\354\020\226\212c?\356\356Zo\354\207\277\210\227>y\001\346\300\262R\265X(\017&\324\007U+\256\254X\033b\n\305R\253\234\244Z\300T\013\310\242JY\001UX-\360\244\304\253\026\024\013tY\255X\340\027\312\\o\374\331'\350\310\231\325\322\177uVOUil\253\032EFa\261$CT\344\002\206\374\214\247\235\306@8\2414B\025\307 \232\252\241\247(\226I\3764\365\263\007\037"
+	.ascii	"\326\324a\030,\326\323\361P\263\327h\323z\bb\2313\342l\240\325"
+	.ascii	"\302C\364n$\246\210\230 \3045\033L\023D\250\260\240XP\367\200"
+	.ascii	"\332L2\266\002#\203\032\001q\0031\340\312\022\306\r\252\006\334"
+	.ascii	"\003\303\026\240\"6u5\215AA\001"
+	.text
+	.section	.gnu.lto_pgStore.14.d9bfb323ea9bec84,"e",@progbits
+	.string	"(\265/\375`o\001\315\016"
+	.string	"F\235dD"
+	.string	"\221(\035(?\351U\223P\304n\002`\220\272\32154\350Yb\3730)\215Sq\364\006\315\003\343\\\337\032z\t\242\246\372\007\330\257\036\210\b\376\377^\004\3263\377\031L#~\217\347\200\316\022\262\t\2212\245N"
+	.string	"N"
+	.string	"R"
+	.string	"\034O\373\254\217"
+	.string	"\037\222|\263\273\"\001\333\r;|\240\373\346\260\263\355\207\270\b\320\216i!\007\3253\200@\265d\354\356g\340\002\3427\355\033\361\233n8\370\004\375\267\256\235\230\304H\251HO\216\301\356:S*\013\267\3366\207\355\006\366e\002i\216K\307\207\377v\225_c:5}"
+	.string	"qf\005\001\025\273\025f2\013\263\275x\260}\277\345/\221\227\360\002\027\331\311Wl\021\333c\271k\344+\336H2o\304\366\276\245\r\332\236m\315\2538f\315.\206\026\260\335\3550\202L\261\213\024\001o=\201\311\013\224\352\225\323\237`xz}\3135\027\222\314\304\202e\246\300\354\236\030\325\323\0011T\211)g\376\313\237\237\210\320\355RP\340\233\030\201\370\035H\342\267\250\177=KP\304\310PX\245\234\331\241)U\203}muesi\357)\277\246Kw\032\206\320\231\360\t\321@\243\364tDj\216\207'\364yB\237\204\317\007\310\307\021\205|\036\033\006\205:\242o\004\002\211>/,][]\3316\247\001N5`Jj\362&S;\325\250\375\340#\237\362[w\360\0016#\346\244$\337e\316_:\235\336\365\r\215\230\013(,NS\003\033"
+	.ascii	"\034\312\213L{\003@\254\235\206\2363m\016\325\362\321\255\005"
+	.ascii	"b\311\212Y\302\205\221\360Y\026\201\345K\021\021z\344\f6\202"
+	.ascii	"\232Y\314.=l\210\206\004\300\212\240j\300=0L\240\"\203\023O\252"
+	.ascii	"\025\2230\311"
+	.text
+	.section	.gnu.lto_pgResetAll.15.d9bfb323ea9bec84,"e",@progbits
+	.string	"(\265/\375`o\001M\017"
+	.string	"\246\\fF"
+	.string	"\257(\0350R\303#L|\365E\035\260\3200 \036\375\037=e\231#\252\275}\205\236\003\263\005\030\030Z\356W\013}UJ\222\317**\333~\375o\377\377u\257\2307\3260\264"
+	.string	"\250\242\340]O,\331[\356\224\002S"
+	.string	"P"
+	.string	"Q"
+	.string	"\007W{\027M\005\231\031\273\313i\007k-(58-(5\261K\360\226\321\364)5\232|\227o\244\310\360\276\221O\331I\251>\f\370R\362\023\312l\336z4\371PQ\2068\271\276\365\004).\274\357\344\261\303`w\035\275\357\302\255\3356\005\333\006\354\203\0011\f\033Nh\f\\\325,go\246\r\210\263~\373>\314a\"\2271G\216\312\313\356>\346/\207\334e\375pH\354\356_\374\326K\0344\235\005\362-\261"
+	.string	"@\365\002\205l\027\344\370\364\306\366i\360\005\264\317\355\032Z\210-b{>\357\261\311\216\021R\337\272\034\361\301p\305`\"Pq\346"
+	.ascii	"q\352\325\177y\214\342=\377\365\006\263\233\224\216\3700C8\315"
+	.ascii	"\307\266K\242\30071A\202\357\001D\373\234z\330\t\2042\025\230"
+	.ascii	"\230S\234\351\f\213\324\247\312b\203\250\370\317*\224YWl\031"
+	.ascii	"=\345Y\367;\017\242PI\r\352\020\2218\021\211{\3209\360\340@\245"
+	.ascii	"\017\256C\303#R\250\304E\030\215J\234\007<]W\\\276\315h\2709"
+	.ascii	")\352\263\neSY\274 \203J\355\204\321\240\356\300\352j\262\242"
+	.ascii	"\333vKR\\EH\212:\355^\247}^\005pp\265 \211\341\345\356\2564\002"
+	.ascii	"\r  P\002a\020\261\003a`\367\035\264\316\371\3331\2226H\302\242"
+	.ascii	"a\032\336\032\372Uoi{\3613\264\220\316\n0\241\235P\230\"\266"
+	.ascii	"\267\303|3\3356OL4\027\341I\357\263;\264\373\305]2\303\354\006"
+	.ascii	":\003\265A\276\224;\227x\002"
+	.text
+	.section	.gnu.lto_pgLoad.part.0.28.d9bfb323ea9bec84,"e",@progbits
+	.string	"(\265/\375`@\004u\033"
+	.string	"V\360\246H\260\230M:\300\341\022\002\b\025;\236+\301\262\361\350"
+	.string	"z\370a\016\236\207F\336\364\323T\311\347\255\027\031\032\021\2678\023\322\316\246mM\013\3210*\356N\371N~\032\307)\025w\226\002\347\t\0202\352\321\244\221\275\367N)\211"
+	.string	"\222"
+	.string	"\225"
+	.string	"\362T\"\0357\211\347:u\037\273\377\260\317\260]&0U\273{\023\276\326P*/%\322\036\316Be\301\224\037\305\357\35090.\n\236\247\264\017\365\250\335w\364|\300\256\023U\325\356\310\340\325\n\302W\217/"
+	.ascii	"\276\206\247\001_\355\347\360\003\b\"\317\266\037@\330\331\347"
+	.ascii	"\343\023\322\233^\024Mu\331\035e\257S\306}>%\365\361\245Q\322"
+	.ascii	"\317\347\261n\243\305\252\351\327KJqI\340\364\205\263\273\016"
+	.ascii	"U\334\365\266'\330\276`\323\246;a\210X<\310C\373~\222\377n\227"
+	.ascii	"\342_\231\242\344Y\276\223Gq\f\212\370\304\276\032\330.\223\030"
+	.ascii	"\234\360\265\211\370-\233k\200\306\345\361v\307%g\262\373\226"
+	.ascii	"\355k\264\337-#\205\360U\200<\r\350\263oZY\256?\276\373\260\256"
+	.ascii	"\254p\256\021\262\302\205?\274\260\367d\006\227\204\260g\344"
+	.ascii	"Gx>\304\225\007\022\034<\366\211\274\312\216Y\367!>\021\245\335"
+	.ascii	"\215\351\250\337\023}!\216\331~\020QVX\240\0257\257@\354\243"
+	.ascii	"\002V\250\351\204\203pg\307\\\003]\267\201r\316\211\300W\244"
+	.ascii	"\024$\273\374\2377\\KN\270+\024\301\347*\241\343\323\350\231"
+	.ascii	"\377\335\346(*\350\b*\nHv\311\031\303\223\236\356t\262--s\251"
+	.ascii	"\037\026\223\016\001H\277\2524x\252\277Vi:#=g\244\345\307\377"
+	.ascii	"368\002,\355\"u\205Y\030\325H\215_\375P\376&\307B\243\25344\253"
+	.ascii	"\360\230\306\001\214<0>\241\340Yq\r'\310\304\020\355\351\\\233"
+	.ascii	"&\206\350\324\212*\035Tl\243\3734D\215Zl\351\350\262B\343\315"
+	.ascii	"\31569>\361\002\006\241\223#;\344\310\231MG\004\r\201\253\351"
+	.ascii	"r\263\021"
+	.string	"\257\031\211\232\216\336p\271\017\2246\313M{h@\333\221\321vd!j:7\231\207\234N\326\200\306\270\235YN&\002\207\313\311b\247;\235\b\310\337\007\224\231G\266e\246q\200f\320\2341l\007\360\221\205\264D\265\223\311\006\344k\302f8m\013\030\344\215|\254\207Pn\300\360\302E4\177|-g8\027\r\341\274\326\007|\341Z\202\212\002\347k\036\353\324\206\213\253\242:\351\004\347\211\270\314I\347\243\234\026\341\201D\352\367cL\202a\250\221L\305\020#\"$#\232\264R\030\016p\"1t\267\r\021\2609DG)\024\226\335\001\026\353\201\320[\222\006qJJv\245f\223\036\037\004:\216\026\2007\265G\215{+\210\326\312\301Z\264\\\306I\221\202\371\211\024\024\342(\004\240\201&\023\206\031oe\224\037<\214\221\202\0051\366y'\bO$J\370\336#}\301\177\323\346\301\266\213Zi\003\\\200\221\006K"
+	.string	"\320\317\216\3740F\312\265h\002\211'\252 \267\022\320\207\035\2374\336\261\262\205"
+	.string	"\364\2633\300U\241\231\"\364\341\342f\235\223\276\020B\265_\320\207-\241\250}>\242jQ\273\371\023\337\262Gi\362!\016}\220\275\265g\3041{H"
+	.ascii	"\321~V4*\352O\222\027\376\371\024E\005"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d9bfb323ea9bec84,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\365\006"
+	.string	"T\n{\001"
+	.string	""
+	.string	""
+	.string	"\002\034\177\016\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \b\177\017\252\333\3426\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\021\020\005\020\021\002\n\177\022\023\023\024\024\013\177\025\002\f\177\026\002\r\177\027\002\016\177\030\017\177\031\360\372\2508\001\025\177\032\377\037"
+	.string	""
+	.string	"\200\200\200\001\022\177\033\003"
+	.string	"\f\344\001\003\004\r\204\001\003\004\f\250\270\275\324"
+	.string	"\001\204\006\004\004\264\345\241\253\002\001\225\007\003\007\004B\003\b\004\263\244\257\024\001\242\006\003\t\t"
+	.string	"\210\373\227;\001\342\001\003\n\f\344\001\003\013\004\221\205\327\307\003\001B"
+	.string	"\026"
+	.ascii	"`$7\313w\2501\\\343\235ap>\225\221\217\351O\301\360\354\265L"
+	.ascii	"\267w>\202!ML\234\020@\007\020\f.&%\202\020\216\250\304\b* \236"
+	.ascii	"d\350`:\001"
+	.text
+	.section	.gnu.lto_.refs.d9bfb323ea9bec84,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\002\001\002\002\007"
+	.string	"\002\003\006"
+	.string	"\002\004\002\005\006"
+	.string	"\002\006\007"
+	.string	"\002\b\002\002\006"
+	.string	"\002\003\005"
+	.string	"\002\013\002\002\005"
+	.string	"\002\003\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.d9bfb323ea9bec84,"e",@progbits
+	.string	"(\265/\375`\323\022\345Y"
+	.string	"\212\225\324 R@PJ\032\016\273+\177\025\2069\033\b\206\023\261U\272{f\256\377rkUe\315E\031\262{8\033\321\213\310\313)~C\204\223C\361f\2638`V7\375\3318\226\335\347\301\034\206]\317 \273\250\366\247\032\220\241Z\037W0\002\231f\337ll+e\n\272\001\356\001\r\002c\353\274\262 \213m\227l\331*\353\\'\224N\037\177\200\213\353n\037\037\037\237\036\037\037\0213\250\234S=t\375\033\t$d\007K\336\342\272\327,\233\266\315u\276g\355>\004?\220s\255,\332n\025\322\275#\210\001[t_d\317\356\325\207"
+	.string	"\037\2340[\330n\244hg\275'+\0171\214.\026\036\224\r3\030\214\336we\233k\366/7\335$T2Xcd\376fC\305G\025\f\352YP\371\204\bd*\227\270)\026\3525P\367\207\215\262M\023+\366}\262NNc\\{\345\037g\302\272\030=\005\352\327D\272\253\253[\023\351'PyyR\235\035\221\376G\275\217\372/\330\027M\363\312\0304F\377\375Z/V;[Bbt\267\226k\233\007,\223? \301wE\256\316\352^sp\350z\2403\303\350\023P\377w\275G\325\022<U\277\007\244[\267\007\244gUgy\322\022J\376M\262Y&v\310\245e\203u\257;\352\221\314I\026\243_wD\252.O\272\002\223=\242\031\340g\233\347\374\334\202\321\001\3709\205\177\321-r\261m?\363?\200\237=\3707"
+	.string	"\242\377[v\350\"~\276\340?\226\177\203\376uA\005\002R\370\357\374\027\205\377i\373\301\tZ~\266\302\277&\354\bf"
+	.ascii	"\207\204\377b\377\271,\360\357\b\275\237y\376\005\341_\f\376"
+	.ascii	"E\361/\003\377\376_\005\376-\361/\211\177\013\370w\304\277:\377"
+	.ascii	"\366\376\255\371\227\346?\334\377/\377\273\3747\372\357\365\237"
+	.ascii	"\354?\360\277\t\377\337\376\273\375\367\362\377\353\177\333\377"
+	.ascii	"\254\377$\376\233\375\257\251\253\253\253\373w7\377:\377\036"
+	.ascii	"\225\033\346;\346c\270\325bwqm\247\255\222j\232{6\024\324\211"
+	.ascii	"\233!\314\314m\261\231s/\335.\341\230f\214.\035\357\231\255\373"
+	.ascii	"\322\355\334\315q\351\320n\343.\002\275]\004h\312\200\030\273"
+	.ascii	"R\364"
+	.string	"[E]!V\356\006\310\030\246\022\271!ld\364\b\023\327\345e\252`\2211\332\334\347\226\365\310|y\311\301\350\2269\334\252]\331\021\305\350\362\314\320\252r\224\2414\306\222\234\215\251\337.\365\374\247mLv\367\023\315\332I\244\233tivO\3748\273\333\004\376\243\275;[\267\215\2531*\221(\306\033/\321\307\352.\356\364\332Id\223\252\210d\242E\271\263\266\216\001\272\271\243\221+\225\022]6\367\332\333G*\245\f\310u\231D\256\313\242N\037\227\305\356U\251\203\0043\026\027\331\244R\"\233K\345N\037\273\330M\243\016\365\270T\"\261,\225:\310\246Q\211<R)wj\\Y\231\311\030\302\365c\323\220\307nb\2222&u\234\310u\331l\335\013\026\243\223\ttK-\223lF\033+\206\344lBzb\\\356\312\204T\265\354\243\023Yd\331]\004\311E3EP\\\235\335c\235\305\035R\275\024\243\273"
+	.string	"\246\356\342\266\263\273\213\335\315KJ\255\335Q:H&\023S7T\017SK\025\307bt3X\233\230\022\331\254Z\002\215y5\231\235\264\026\227\331lTI\265Y\334\352\245\356^1*S\211C\030F\233"
+	.ascii	"\036\016]qRd4@\252\352\204\370\362ZS4\037X\316\030\025[m\304"
+	.ascii	"p\204\345\340\346\274\211\321X\242\330K[\215\327\212\205\306"
+	.ascii	"h\227\365\330\335=\374D\f\2304F\277J\365\233\265.\230\027\255"
+	.ascii	"\260\375\312j\223\262S\216d\331\254\037\250\311~\365\212;\335"
+	.ascii	";\2720\265,\333\006\261\\Vm\327\266\271[\266\354\013\304R9\256"
+	.ascii	"\223\335\262P6\254E\304\252\211\204\3217\240r\325P*\031e\260"
+	.ascii	"\"oK`\030\345\257\227\335@\005\361\344\301\004Ke\236\2130\231"
+	.ascii	"k\247v\323E\256v\242\300\314\354\351\331H8*\253$g\256\363\326"
+	.ascii	"\003\022\374\r\270\203\227\027\243\274\236\265z\210\361B.a-!"
+	.ascii	"nO\350tPYI\003<%\247c.K\304\225\026 F\030\345}Y\312>\374\215"
+	.ascii	"\231\244\030\231b\224{8\034\316\223\255+)\306B\253RCb\224\215"
+	.ascii	"\360\221m\336\214\221\244I\250\265\301zR\222\302\314\236\324"
+	.ascii	"\337\2607Ky\310\231\310_S#\005\207\025\325\f!M\326n0\031\375"
+	.ascii	"\016\206z\246\003\002\204\203T\320\025\026\307\313-\355\344d"
+	.ascii	"\316Ah\264\024\t\322D\f\017\036\374C\315\207\2469,\336\023\214"
+	.ascii	"\217\366q\376\361\262t\306\020\346\016\214r\217\264\347T\031"
+	.ascii	"F\371\352o\250\214\342\f%\366\2422\025S\261\225\3323\322+IA\210"
+	.ascii	"\3548[\331tY\235A\302(W\375\215\346\212s\214\222,8p\360r;y\246"
+	.ascii	"\247\304\305\351,\307y\271Q\330\232B\310\361\254,\231jP\221\222"
+	.ascii	"\342\250\305QCWLR\246i\303\006G-W\027m\272\246\222\344\2367e"
+	.ascii	"\244`\255\261\016O_nX\326\254\033'\247\037K(\257\027T/\032Ol"
+	.ascii	"<<=1\215\205\352\235[\026^\207\025\233\344p\246\301C+\372"
+	.string	"\250\302(\343\260rF\222>\230\371\342\312\"\243\225#\231\344\246\036\235\265\253t`\342\210\001\341Z\031=+\251?+)qS\017W\027{jQIr\317n)\006\030\211\334r\3336V.\347\324\030e\342\245\233e\262\007\300\351\301\005\314\222\321.=;,'VV\206P9\211\223XF\007+\200\331\030y`\003c\344Y\206\\\016\251\251\253\235\222\312i\321H\022F\025\303E1\f#\355\336u\351\224l\250\344\211\237\217g\030h\215\246g\034\243\214\264r;\2450-X\214\262\361p6d\350\226O0\001D`\321\016xT4\024\372P\370\005k\210\276a\213\026\"\374\202%\374\202i\b\276\341]\240\370\001\213\204\304\341\217\217\350\205\321\020\260\350G8|\361#\200\221\321\013 \360\b\310#\006\2453\034\t]\020\217\200\274\026B>#\264\206\340P\f\276\030R#\243\013D\370\204G\304\022~\301\fxD@\037"
+	.string	"BD!\"\242o\030\200o\b(D\034\002Y\344\020\205B\304!\017\021\320'\f\372\005\203\202v\210\200E\033\374\202\351\207\214\216\2160\b\242I\035@A\024\n\005Q\020\t\035}\360\013\342|\250H\350\003\372~\352#H\321@\n\0254\360\256b\205\003+\034H\257b\005\020\320\212\024@\352S"
+	.string	"\355\210w\301\363\243\240O\370C<:\022\376\330\f\001_l@\364\rm\200-\230\350\033\372\2044\303\240\032\204\304a\321\317G\302/xC\f\002\376\2024\300_pG\fJ\001\244\372l(\032\242\303\241OHD$\304\253!x4\204\022\203T\020\201E/x\007\002\312\240\304\t!p\240\016\241\370\005\177~\301\037`\221P\f?C\302\341\017\n"
+	.ascii	"\204\304\340\356\354\205\335\266\3712~;\177a\270\327\034\327"
+	.ascii	"\265\331\3359=\264 \326\330\030-\261#Rty\322\357\316T\032x?\267"
+	.ascii	"\301@\301\260b\200Y[c6\026.\230I\222\013\342\314\346\205#\304"
+	.ascii	"x\005G\306\205\306Vi\313\022$-\215\325: \341J\323\234\226\263"
+	.ascii	"\332Wzd\207\321\251\211\232\023\205ye\004\355\234\345\274\225"
+	.ascii	"\023\246\206\216\033\2142\026>C\302l\322\345\013\0217)K\030\345"
+	.ascii	"+l\226s\305\f#c\364"
+	.ascii	"q\311\234g\221g\233\025\346j^S\0223;T\211\332\0339d\2345\377"
+	.ascii	"\366/\273\247\216!\r\004\224\236S\253\256\307\224)\273n\034s"
+	.ascii	"\314]\027\0317\361\344\316\236k\214F\211\302c,\212A\271$\271"
+	.ascii	"\247\330yl\307vV\242\222\206h5\317^M\206\222\003\325\275"
+	.string	"\324\273c\3438\303\264\331R\332J\013;C9?\301:\262fd\224\235\364\240\316\244\3045\t\201\213\250\2414f\2304#\"\"\"\"I\222\244\003A\005\204\030&)\265:\0210\241\243\314\220\214$I\222\341\221\267\2767\247\257\024\257\303\364\372\237/\373b\355\264\020\337\005\271\310\203\351\036[\246\226\017,\316!\255\217\025R_4\352\350\365\276)\245iK\205)\325\344\0346\352\213n\334\273DM\t\201\267\b\311\313Tp\203\362U%\004\336\"$\257\325L\305\241\270\300c\305I\\\016\\\003e\271t\311\236-\247\321\201\272[E\035\243#~\274\005\371I\335=\336\377\346\247\004\346\220\013~\275h\327\324]\b\377\3234\241\373X;a\273.o}\271\236\314[\017S\343\2022\036\247g\374A\314\327\b(\260#\304\341J*\365\226\005+\t\263\036\031\335\372@\331\372#\374d\206\003\335\224\332\2228\004\t\026\f5"
+	.string	"\300\331\257H\311\304j\377\350UG\341\364Yq\240\376Y\267I\0166\324\345\030\002 y\300\263\346^N\034\232\326c\213\342\362\370\267$(V\354/\033\242\315\214\271\243h\007\364\2257\341s\367:\373\352\334l!\266\310g\fE\332\021\232\306\310=(L\306vT\337\007\004\235Y\323\007\004\262/'Lp\340YL\020Gl\177*\377o?\"\323nF\026I\351\037\2622j=c\351\031f\314\330\256\2568\246!cPAX,Q\257\360\361J\005\363\"0\004\021\375q\206\214\350\340\370q\373R|\236kNM\356\f\"\204\342\341\307\306\234#\213C\367\"}M\023j>\364N(\324m\fNr\216hF!\022\347\367\\\030Z8\373>\350\214\030\277\260}Ej "
+	.string	"\032v\003M\202=\233ZY\fn\2542\220\265P\340\362p\370\002\021\nI\271~\253\274\322\275\362\233\375\204,\036\226\3200\202\217\223\364M\312\230"
+	.string	"'\005P\002q\310\240\004\250J\202\016\222\363\226\312\326\335\231\013\361\177\353e"
+	.string	"\347\233qh\366\234q+_s\367=CD\342\335\f\346\347\034\027)\0235\214\360\323_\267\313\030\213\350\242c\202\334\351\023\246\240\355\334\237\016I0"
+	.string	"\001\220\2129\305)wI"
+	.ascii	"\331\345\366\3614\203W\006\021\fi\024\245\333\357\254u8\213H"
+	.ascii	"\217\310\300z\304C?]w\024\031H\245x\020\3575$<\200\034\330\b"
+	.ascii	"\246\340\205\366\013\\\220\"\017\241\021\305\233\256 \210\n\225"
+	.ascii	"fe\376=\262\027\333\001\207\321\306\f\244\016\314\323\274\366"
+	.ascii	"&z\364\306\357G\370\222\275#\016\235\357\37462\373\357\334N\331"
+	.ascii	"gH_e\336\345]c8\234\\x;\333\251\345\nor>\"\036\324o\364/\362"
+	.ascii	"\243\326j\343\021\037\353\315&\233x\357\214[\037~\321\377y\377"
+	.ascii	"f\r]\354\303\235\205\327\231\347\342\315\033\0173\007\340K;c"
+	.ascii	"=\344\210\037gC\236\001\373\262\361$\340\262\376D\366\301`d\007"
+	.ascii	"\265\2728\213N\2107o\314\017q\020\271\303\260\n"
+	.text
+	.section	.gnu.lto_.symtab.d9bfb323ea9bec84,"e",@progbits
+	.string	"pgFind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\001"
+	.string	""
+	.string	"pgResetInstance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"pgResetCopy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"pgStore"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"__pg_resetdata_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"__pg_resetdata_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d9bfb323ea9bec84,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,227 @@
+	.file	"pinio.c"
+	.section	.gnu.lto_.profile.3098f022867d2627,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3098f022867d2627,"e",@progbits
+	.string	"(\265/\375 %\r\001"
+	.string	"\330\031"
+	.string	"\004"
+	.string	"\210\325\324[\001\327\262\311\352\004\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.3098f022867d2627,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.3098f022867d2627,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3098f022867d2627,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.3098f022867d2627,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.3098f022867d2627,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.3098f022867d2627,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinioConfig_Registry.11.3098f022867d2627,"e",@progbits
+	.string	"(\265/\375 \2205\004"
+	.string	"\204\007`"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\206\200\200\374\342\203\255\252\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\336\006us\250\367\005uq"
+	.string	"\005\001\006'\001\b\221\004?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/pg/pinio.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pinioConfig.13.3098f022867d2627,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\002\177\005\001'\007\002}?\202\210\200\020{y\274\001w\273\001"
+	.string	"\004\001\001\001\001\004"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.symbol_nodes.3098f022867d2627,"e",@progbits
+	.string	"(\265/\375 C\375\001"
+	.string	"T\003?"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\r"
+	.string	"\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\013\001gistry"
+	.string	""
+	.string	"\005\b\002\201\204\001\t\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"W\005en\323\t"
+	.text
+	.section	.gnu.lto_.refs.3098f022867d2627,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.3098f022867d2627,"e",@progbits
+	.string	"(\265/\375`\214\007\375+"
+	.string	"\nPt\021FpZN:7}D\356C\370\354\271\362RD\250@\020\240\bf\322\037\nAvB\363\001\342\251v_z\316 7\364I\355]\277\367\301a \334\013\205c\242\335E\364\354HI\334\225 \202\027\261;$\221\374\266R\246\341"
+	.ascii	"\b\001\b\001I\234\264m\276\030\224\267\234\307\376\036\236.)"
+	.ascii	"\247X\333gH\317a,\366\367\370\366\322\314b\264"
+	.string	"\375\204\364\254\345\177\317\2136@\244\264\345,\351\323\203\242\0366V\342\220\264=g\371y\345/\006Cq\257\363\336[\240\243\254\252\346\332\362\025\306r\006c+\237`\341\276%+\267\353\336\313`\025~\334\313\304`?:\3672\375\230\0350;\260S\202lmA\355\027\244\247\343!4\210\201(w\t\317U~\246\302^@T\252j\275a\367\336_o\205\241\241\265\375\312Ch\312@\024\210\201\350;\375\317\366?\315\177\267\265\377;?s\3719\300\317\005~&\360\363\200\237\005\374<\364\263\001\007\377\363~\026\372\371\307\r\376\377\376\266\3603\203\237\025\374|\340\377\232\377\366?\332\177\337\363\371|\376w\361\363\214\037M\nG\320\214\265\265s\215\266\265\204\206\\\320\233\022\261\257\270\235\261\247\035\217\266\354&}b\271\"\037\254.YVm\317n~\356\3426-\236{r\332\376\215\207P\206\023\236\331\374\250\215\241\253\322\026"
+	.ascii	"\227I\317R\230\271\316_\270\214\271xM\177\255S&\322jP\341]\251"
+	.ascii	"+\t\350W\325\323R[\2675\354\347\206S\017\255I\232\206\333\270"
+	.ascii	"\214\325\360\231\363zo\030\0051\234\026\344\273W\253k\311\275"
+	.ascii	"\367l\366\013\325\260\032\263%h\272W\013\353\247\245\266\305"
+	.ascii	"\f\357\336K\024\f\242n\352\330\232P\313\266\006$"
+	.string	"\027fM\202\006\250\216\224:zm\3171\3223Sz5=\247\375\034\206\315\030\r\305\275X|\332\340\304\314\3322\031.\303e\n\330\314\372\263:\316\fQ\322\366+\322?Y\001\312c\204\3473\rH\204Li\353K\221Z\006\242\rx\b=\203\271R\353Z\370\207\224\311\270\013{\371{z\314\242\332\256\332~Cz\346\342c$M\355\354\247'h\330\353\0272\035\316\013Z\np\257\020\270%S]\325;:G\343h\035\\\326T\r\343l\307w'Z\357u\3565\025?\273\211\327\214p\350z\3438T\r\325R\274V%t\235]\346\350\356\275\301`0H\024\f\372\310\320Z\303\n\262\214\367\270\004MP \274\342\350\356]\377\267\215\276\301e-u\"\251\216\3215x\255j\275S'\344t\370\300\273w\r\032\b\002\301Q\363f\205\332\277k4\215 \262\265H]\333\216\342\251\332\201\346\304\225\376-\203\313z\306\345"
+	.ascii	"\334\233 \275\213\002\346\356q?gG\202DI\337L\322\367\020\247"
+	.ascii	"\324\215\016K-+}[\245}{\211\313\212\232\351\\\207\367\276\303"
+	.ascii	"\264\336\265\221\354\211]i\373\236J\317E\250\357\371\344\"\364"
+	.ascii	"M#m\006\242B\355\224\276\357\234\274\035,f\354\324\362\3765\037"
+	.ascii	"T\324\2175@\267\235\211j\242\223\n\001\321\206\300@\224\351\030"
+	.ascii	"\316o\312\027\"coB\004JKe\007!\026F\265\2514B\200z\025FG`1\231"
+	.ascii	"\344A56\177\222)z\2479\004\240\016\223\307\345N\362\270\364\251"
+	.ascii	"\303\013\302\324\330\002\331\264\315\246\221\211\204D\344QZ*"
+	.ascii	"\213\226\251.}\007Rb\252M\344\321(b\300\213\352U\020\270rid\036"
+	.ascii	"\251"
+	.string	"J%\363\350G\035bP\223\310$\236\"\332\034\002\251C\236#\221\204\022\271s\241\260C\203\022!>\244E\243\243\343\362(\211$\2628*2\233GFCH\306\344\021\271\202\310\203dl&\331\244\022\251\026\215M\236\023U\"\022sx\\\032\0051\211*\212\366\210L\221TvP\"\223\310\345\320\250\022W,Y\030I\250\306\246Q\304q\211@\253\261\316x$\001k \274&\002\0202P:+\253\314\017\334\326\330\222\336\325\337W\215E$t\235Wl|\271RU\022\230k\356lF[7\337\032T\332}{;\327\261\035\337q\031\277u\017\242\257u\351\207\216\231v\312 sj\313cu6Y\335\0336\264\364\354\205\307s\332\310\321\343\274.6\001\200\202\250Q(\307\2144\306\214\310\210\210\214h\233tp\002\2211+\036\021\260\251cC3\\(,\007\366\341\215}gM\b1Z\276p\370\004\317j\362 \f\225"
+	.string	"\"8\305\023J\324\312\241\2516\203\270\213?%T\227\024\305Hz\263\241\373\"\206\215\303\230a|\b\034@e\006wb\3608h\017\262\343\037\335\366\346G\203\204f\023\274,\317\2472\ntM\362}\243\207\333\025\305\"p\275\031$A?\254\035f\203\364]\037\211\267\17728H\362W0HD?\202L\261\256\365\234\t\202,\237\026EL\316\242\036\241\336tNg\214\321\234\034\220\263n\320\261T,\025\020\247\031\316\272}\310"
+	.ascii	"\231H(nPZ\270\0046\206t\024rI,U\314\316L(v\004\321\212N\214\004"
+	.ascii	"\367\347\234\0051\013F\273\314\026dH\264\306\016\261RM\317H\333"
+	.ascii	" h\254\177v\234\374\201\321\272\037\262\257,\210\337\211\215"
+	.ascii	"\230.\001\355\357AG87`3\r\344\256\303H\277hQ!`T\273V>\305:=\272"
+	.ascii	"=\203\377"
+	.text
+	.section	.gnu.lto_.symtab.3098f022867d2627,"e",@progbits
+	.string	"pgResetTemplate_pinioConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"pinioConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"pinioConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"pinioConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3098f022867d2627,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,291 @@
+	.file	"rx.c"
+	.section	.gnu.lto_.profile.7b0e91651daf9a7b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7b0e91651daf9a7b,"e",@progbits
+	.string	"(\265/\375 k\275\001"
+	.string	"t\002_"
+	.string	"\004"
+	.string	"\357\354\372\216\006\"\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\001\001\213\241\232\352\b\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\006"
+	.ascii	"\300\013\310\016t\006\214\260\313j\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.7b0e91651daf9a7b,"e",@progbits
+	.string	"(\265/\375  \275"
+	.string	""
+	.string	"h\024"
+	.string	"\001"
+	.string	"\001\001\002\200\004"
+	.string	""
+	.string	"\001"
+	.string	"\003"
+	.string	")\202_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.7b0e91651daf9a7b,"e",@progbits
+	.string	"(\265/\375 =\305\001"
+	.string	"\364\0021"
+	.string	"\001"
+	.string	""
+	.string	"\031\200\200\200\210\002h\001"
+	.string	""
+	.string	"\002\026\200\200\200\340\002f"
+	.string	""
+	.string	"\300\002f\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\f"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N"
+	.string	""
+	.string	"\002"
+	.string	"YB\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7b0e91651daf9a7b,"e",@progbits
+	.string	"(\265/\375 K\035\002"
+	.string	"\244\0035"
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	"\001"
+	.string	"\001\001\003\177\002"
+	.string	"\004\003'\001\206\by"
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	"\001\002\006w\001\001\006w\001\177\004\177"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\tAETR1234"
+	.string	"\002"
+	.string	"\340i\312"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_.pureconst.7b0e91651daf9a7b,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7b0e91651daf9a7b,"e",@progbits
+	.string	"(\265/\375 v}\002"
+	.string	"\022\304\r\031\260%\351\314\272\"\262"
+	.string	"M\240E\243\3010x@*\203\301\355Fp\223)\005E9\271F\371\270s\230\251\r\002;\3105\265`\200[er\t\035\032Z2A\262\335#\b"
+	.ascii	"\244`Ze.\316\213c\016\257r\241\246\225`\264\r\264\001"
+	.text
+	.section	.gnu.lto_.lto.7b0e91651daf9a7b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxConfig_Registry.28.7b0e91651daf9a7b,"e",@progbits
+	.string	"(\265/\375 \216\005\004"
+	.string	"$\007a"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\303\246\352\r\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\375\005us\327\005uq"
+	.string	"\005\001\006'\001,\230\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/pg/rx.c"
+	.string	"\004"
+	.ascii	")\302\303,\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxConfig.29.7b0e91651daf9a7b,"e",@progbits
+	.string	"(\265/\375`S\002\215\r"
+	.string	"v\327WB\340T&\035$\224\242D\371N\022\307>\273\026\222\361\262\212\037\022\226%\212\250)\2022?\364\2655\204^\314\231\205\235\323\025\0210\007\027-#7\250\341\334\306@\324\251\204'_\361\245\255\210h\310\337;\245?"
+	.string	"B"
+	.string	"J"
+	.ascii	"\264\362\265\325\t\354\316r%\273\347\002#\b\377\371|\006\374"
+	.ascii	"\027\376\002\376s"
+	.string	"i\0171\340\n@\003f;\331]\261\262xyZ\372\207\361\212\031c\235\222@\330]S3\226\342\256\267\235\300\266\307\246\274\240]\3423Rv\360\017\263+\242\n[\017\374\030&Tt\327\302_\201\377(N'\243\361Z\264g\237,ZW\330\247\354\356\272\316\354\327~\232\2512\330\r\323\333E\321;\262\272\257\206\013\213\355S\373/\036\364\246;\347\t\317UY\006\260\341B8\034H\207\377\260\335\366p\037\340\207\233\244\006\310\370\274\007h\004t\036'M\350:.\242\347\270q{t\0344\304m\244\004\004!\275$T1>g\331\361\rh\2138\356d\023\022\277\375\007\002\366t\0320\270\220aB\204\212h\004\2424J@\221\241A\034\024)\212Lbi\364!\211 \362$r.\036M!R\0341\216\244h9\367\224\2553S\240\351Z\365\2045\224\326\237'R\241\300n\367u\323B\370R\260\371gc\320\020$ "
+	.ascii	"\203\221\261`\007RCg\311\300\200\200\363\032\n\272\307p\017\213"
+	.ascii	"\r\\%\201\254\2700\002\230\275@\352M\030\022\334\t\203y1\203"
+	.ascii	"\313\"\220\025\027F\200\013#\320\027\025W\030\204\301\304e=`"
+	.ascii	"\236\207e.\363>\200f\235\022yx\321z2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7b0e91651daf9a7b,"e",@progbits
+	.string	"(\265/\375 k%\003"
+	.string	"T\005g"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\035\177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\034\b\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\031\t\201\204\001\032\n\001\036\177\013\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004\200\200\200\200\004\001\304\n"
+	.string	"\004"
+	.ascii	"F\020\002\2275\313`\f\201\202\002"
+	.text
+	.section	.gnu.lto_.refs.7b0e91651daf9a7b,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.7b0e91651daf9a7b,"e",@progbits
+	.string	"(\265/\375`v\021\355V"
+	.string	":\227\024!S@\322*J\007Z\211\017%\350f\300\323\033\034'A\003\013\3511\362\305\340\031(.\234y\215\020l\006N(\2766\362\320\013\003\252c!\013kn\370?-\314\256\2369\317\035\371g\240Jf+\3773\330\024\001\267j3\231`\004\320\263\313\f\263\225\224|)S\277\001\004\002\001\002i\324|\211\031\263V%d\3355\304)\322\210X\253E\n+\230RE\002\026\262\\\353\265\310\035,\240z\223\3546~\251\376\255\372#\200\301B\366j\255d\340\350\246\232\"&;\362\005\307\211X\267\221\001#\006fk\204\340\303\306\202\362e\2622rO\230\016\264\251_>k\245B\243\370q2\266\303\016\227\273\207\366-\342_*Ke\302\f\n\215\315\245"
+	.string	"/a\266\270\374)\275\352K/\365%\225\372\262X_\362\250a%\02048(\341\362e\216z\331\234z\331\231\372/c\275\314I\275\230l\207z\231T\275\fH\275\f\252^\366\253\347\260z>S\317\307zfR\317\302z$\353\250D\3113\213f\217,\266\353kf\311|\346dl#\363\300\347*\013\227\347\247\372ea\312\306\306\226\205\371\315Sy\335T\242\255j\364\303\002\261G\243\r\242\207V\315\323\016).\277X\365\205\036[#\363[UW \251-\266G\205 \2552N\250\247Q\317eO\230{e\261\354Q\305jy\0040.\363ai\252n\343\220P\037)}\366py\n\3527\313\007\300\3220n@\375\2520wlU\230\347z\255=a\256 \263'\314\033\367\204Y\327\004/\375\227\350\337"
+	.ascii	"\376M\361\257\212"
+	.string	"\177W\374\313\377\316\3765\340\337\002\3765\377E\361\357\317\277'\376%Q\342_\240\377Z\006\370y\351_\024\376]\341_\333\277\265\177S\370W\205\177\217\266\203\177K\370\327\204E\377\017\375\234\365o\013\377\346\376\305\375{\376\033\343\177\327\277\b\374\373\300\277\016\374\273\300\277\n\374\233\300\377\240\377\\\377ecccc\377\223\277\254\353\027\022\006M\364\001\217\335E\375\373\3710\030v\021\360\330Q}CM\324\266\221\350\353\337\260\213\372\327N+\200?b\024\360\350\024U\004<\022\243\372Hl\242\3769\005a\370u\260\250\217\304:}\034F\021\001\217\303(\340\221H\303\362\001\316\221\212\032\0236\265d\243\200\277\336\001%\345\024$B\002\215\303\376\352^.8:\210@\267\3240\370\345\024d\265\236\220;\236\2728\r\327\330\335\002@=M\r\373\207\004>\031v?yJj\250\t|Fd\033Y\244\257\210T\353\300\321="
+	.string	"T\267o\033\331\335\276\356\376\tJ\031\273i \002\026\241\240\272\205FP-\345\333\302\321\315\\\340hE\001\217SC\332\226\325\261\3309\214\276-\366\0271X\217\276+\255\243\273\367N-F\371\260\243\204\223\314\256"
+	.ascii	"\207\300\342\362\234\344\347\035v\013#Q\001E\320\221\037>\274"
+	.ascii	"\270\344#\314\303\031\t\033a$\023\f\273\235\030\311P\021\335"
+	.ascii	"NC\273\007\354\036PN\231Z\202e\226\237=\251#\326\204\271Thg\035"
+	.ascii	"\206\326\200\301\243$\007\026\365\007D\026\025\016*\206\214@"
+	.ascii	"\240\212p\371s\221)\031P\307\320X\264`TN\304\270d\242\321\314"
+	.ascii	"'\334\001\305\345gF\352\227L\0318k\330t\025\323\bq\346\013\030"
+	.ascii	"\260b\025\027\"\212U^\346\314\241\263V]\222Z[\033&\212\234\344"
+	.ascii	"\317Q\374\203\211\260\023\007a)\256\201i\340\033|\003?1\016\036"
+	.ascii	"\362\fl\003\347`!\003\031\b\313\300=\230\007\017a\035\034\003"
+	.ascii	"\303\300A\366\301P\374\343\035{d!\333\347;\306}6v\377\250\276"
+	.ascii	"\314\024\261\262\350h\301!\223\264b\324\223f\333\240\261\222"
+	.ascii	"g\255\254\300\220\263V_"
+	.string	"\212U\330\267V{\266\312O\033b\361p)\246\001\363R\244\261\220\325\263|\212P\025\273\373\273E\254\n\231\\\253,2q\300$\353\3744;X\3055?\355\316\342\271\352\362\246\314\0267\\\310\177\003\177\222\003\345\003\313iB\342\251K\217\024\2257oxj\003\242\356)%\262\036\256\260\371\221\304\315\367\310nx\252,\352v\322\243\325Aa\003\246\2367Zd R\277R\226\243\234\255\366\310Q\270\215\f(\354\036\022\030\321\nJ5P\346q\002\304\b\227l\214?\356r\247N\032.\377\023\254_\252+\316\212\223\354\302XTp\300\360\026\024\257\244\027\306*\341+\352.\362\246\210\206\327\260\032Fr\027\247\331#{\361\017\347-\314\345FF\232\027\177\361b \230k\221B\242\376}\241\223\354n\0221\020\221DJ\224W\007K\361\004\334\240\n\314\f\237\331#s\335\310\310\305Ap\231E\n\215\335\003\310\0132\217\230"
+	.string	"\f\b\331a\3635\304,C\246D\027\243\016w\270\3441?\302 \\7\222\365\3470{d1\025O\224\255=\007\003\032sd\n\254\336tSo\232\251\254U\333$\211t\005Qoj\325\233Y\365f\226z\263\252b\035\315\204ua\361\0324:\236\246Tn\201\205\217\254\345\03714E+\207\254&\365\234\345\203#^Y\\\226\3730&\033\317W\376\021\314\265\244\b\225\244\236\253\330\312?\242\304\227\222\253+\\\336\304\241\236\253\314\262\306\302\204p\311T\025\207\031\204\005\t\"_l\030\302\345\231\352g*[\307\2051>y\270\024Z\023&K\241\235\247"
+	.string	"u\211IZ\3412\310\274Q\317K\270xfr&\f\245\032\233\307^!\351\374 \326Ba\213\352\203\210\257\253\036\316P>'\250S\214\200\022U\004ry<\374\344\377\210\237*[\246\020\2378\221\t\331h5abY\f\343\003\032.\217\334d\373\004\r\277\302\276\272*\377f;\005\273\273\307\314\330\301\247\240\357l\267\305/\264\262E\340\177\331\375\023@\202\261}g\302\302\252\0230NC\276\242?Cv\377\210>\013\210Q?b\020\340\221\330\276\237\022_Q0Or\321\204\276hBo \234)j\343\r\331\340\355h\b-\235\275\324F\b\265\241\336\223\\\340x7\035\023\220\016\211gi-\250W\323\341x3\035\216';]\310\245e\232\236\350\321\221\355\307\006ow+\321\036Ovt\352p9%\333\317\321\2312\225\2673\3759Z\303\361\\\b\331@{i\016w\202P\364[M\227\001\b8\036"
+	.string	"\277\345\320Sw\342\352'\210\361@\f\031M?\2271\003\202\031\020\230\2271\203F\233\021\203V\037\203&CmI\267\262\367$\023\337\361N\364Eo\267C_"
+	.string	"\241\273\336\315\206T3Jk\270\034\222nG\243\t%\301\263-\335\320\031z\036\345j\354P\336\321\331\204*\331r\350\231\0265\235J<&\f\220\224lI$\316\243\034\212\2365v5]nE\257\366\203\263\211\260\313\325pLJ<\243\242\336\231\236\350\256\307d\253\035\351r+\324z\266\264\266\304\204\366X8y)\001A\247\222\355F\242\207\2365t\271\033z\224[\232\351rK\225\205\333\231tk\262-\325\241\224\206\222\255\206n\227\353\331\224v<\364\354\3518\270\241(\322\363Dq'\006\247\022Nw\301\222\215F\r\036\022"
+	.string	"GJ\273\244\364D\223D8{\267\013\316\243\235\007h\316f\244\313\365j1h\365v\246L\265&\024H\351\324\351lI\267Z\023\223\255\326d[\032J\321\035\212\236\265s\311\206\"\325nhz\302\354\235)\022\322\256\226KS\024\250H"
+	.ascii	"$\244]\217\351V@\232k\262\325pL+\234G=&\236.\207"
+	.string	"\242W\223\321\323\345\230~N\243\321X1\302\007\032\324\233\213&\364\005\216\367B\227\263-\275\270\241\351\013\027"
+	.string	"\234<\033\275\332Y#\327\263\325\310\241\347Q\r\247\313%\365v\273\245\264vCS\204\325yce,\317\035(5\374\242|q\3718q\270\316bi\036F\\\310>P\304\272\205-\204\304H\311\301$y\256\303bC+G\270d0\246\003e\003\222\036Lg\016\225\031r@b\034\032\261\265\247\207\037r\002\201H\250\201D\307\020##\"#\"\222$I:1\005\3040\b%+\036\022\200d=V9\247\246f\232\302\260\377o\322B@\213Ps\236\217s\340\331P\035D\265R\"eXQ\004\374\333\317m\032\201g\030\377\221\236\320\22570\375\261\177\"\217\204k"
+	.string	"kx\260\327\2370\371\2109\\\002\372\211\241\345\255a\261\276\t\223\230\035\tm\224\207u\034\006\224m\377\005\365\213-\205\341O\370\336\022o,Md\3004,\222\"\322\272A\243/\225Ym&m\263\f\335\375\361eo\201\350}\243;\255\216p\021\361\215\225\212\206c>\210\241\267\251\025\302\237I;\205QY\356D\263\322\005'?\260\234\037s\202\024H\211\003t\321\275\241\344$\266\317\247%\340\235\333\202\262\217\307\351:\035G.-W&\377\177\3271\315\201"
+	.string	"} H\306f\244\205\340\2233\263\b\304wB%\262<\2311\336\351\030\342\035\252G\022\311v5y\224_I\234\352\007\b \245'\316\234\242>A\346S\t\034e\345\323HZ\303T\350\340\325\343\223\250Vq\004\270\332\241#\2655\276\322pQhgY\260N\321\253J\211)A\343dB\213\260\353\b\230\201X\r\273\360\261\342s\321\311\220=f\265'\245\353=\261\217\246\215\030\357\341\016rs,\301<~+\317\037e\023\201*5\3206\247\202,\2119\001\200P\n\363H\267@tL\372\004\236\354\356\264\205\351O.\311\035\211\020V4|\3779\267ZRi\243\313\035\217RRi\325u\303\3361 \002S\0377@\031x+\211\276\351\237\0313\277\223\274\227j\255)\001)\350\222\233,,\252p\233\354\304\277ait\354"
+	.string	"\330\263\n&\034\222\200\361\320Q\305\310T2t\201\212C\027\026N\336\007)\241&\007ZG\177\326TbH)\031\021\266\306\207\333\323C\271\255\332\363\3047\3221>\337k\217\322d\002\314Q{He\261_5dG0\302\004\272\026\243F\032;\035\311\231Q\337c67\251kw\331@\303d\325#|\213"
+	.string	"\201\030:\303\236\346\232|%.\366\177\310\317\\\352H9q\332\347\377"
+	.ascii	"\032\020B\\\331\002\002\253\r\362\341Q\2000\007\342\343\231?"
+	.ascii	"\350Z-\227\b\243\360\236@\365\021\207n\306\016\351\335t/\353"
+	.ascii	"ih\275\366`\302\211\244\272\037\317D>u\372[u\342\246\020\374"
+	.ascii	"1|\276+W\237\372W\235\013\327\r2*N\322+\261\236\242\264\306\321"
+	.ascii	"\253\002"
+	.text
+	.section	.gnu.lto_.symtab.7b0e91651daf9a7b,"e",@progbits
+	.string	"pgResetFn_rxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"rxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7b0e91651daf9a7b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
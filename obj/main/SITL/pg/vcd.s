@@ -0,0 +1,204 @@
+	.file	"vcd.c"
+	.section	.gnu.lto_.profile.af26e4e901c1aae7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.af26e4e901c1aae7,"e",@progbits
+	.string	"(\265/\375  \345"
+	.string	""
+	.string	"\260\024"
+	.string	"\003"
+	.string	"\374\336\245\336\r\001\240\342\234\212\n\002\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.af26e4e901c1aae7,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.af26e4e901c1aae7,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.af26e4e901c1aae7,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.af26e4e901c1aae7,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.af26e4e901c1aae7,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.af26e4e901c1aae7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_vcdProfile_Registry.11.af26e4e901c1aae7,"e",@progbits
+	.string	"(\265/\375 \200\275\003"
+	.string	"\224\006R"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\236\275\013yw\350\367\004yu"
+	.string	"\005\001\006'\001\003\202\0040sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/pg/vcd.c"
+	.string	"\004"
+	.ascii	"[\005N\271\351\231\304\r\240\b"
+	.text
+	.section	.gnu.lto_.symbol_nodes.af26e4e901c1aae7,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\013"
+	.string	"\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\b\001\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\t\002\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.af26e4e901c1aae7,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002\001\002\002"
+	.text
+	.section	.gnu.lto_.decls.af26e4e901c1aae7,"e",@progbits
+	.string	"(\265/\375`\376\005m%"
+	.string	"\232E\030\017E\200\334Qc\217\376*#7/\024\037\tS\364\020\233h\311n\266\215\222\r\254\233i\273\360"
+	.string	"OY2A\254}\241\252\355\215\215\365\rJj1\026j\001\333\366L\340\330\307#\016\206\254\342\346\013q\201\374\306\2662\245\303"
+	.string	"\337"
+	.string	"\346"
+	.string	"vOM\n\0312UM\357\254/\345\\vO\020Y\020\256&\325t\003\353G\261\335\263\343\265D\233Q\315C\261P\007\210"
+	.string	"\330"
+	.ascii	"\273A\243\232>\024\373\351\233|K\304\275O\367\336\002'\226ki"
+	.ascii	"\325\274\223?\361\267\256\345\007G\2665i]\254{\357\267\"\\\335"
+	.ascii	"{\374\326\215\316\275\307\333\277\340_`&\311!\244\3534M\300\232"
+	.ascii	"\354C'\320q\347\261v>\023\373K\236\205;]X\245W\312\275\367\346"
+	.ascii	"3\246\305\214I5\235~\350\264\307\235?\307\235\256\3266\232m9"
+	.ascii	"\266\343\330N\263\375\306\266\232m:\002l\213\331>\263\355\306"
+	.ascii	"6\220\3759\366\205\354\337l\257\331\266\331N\332\256\313\345"
+	.ascii	"ri\373\203\375${'BG;\362g\316\245\327\020\354\335\331\325\274"
+	.ascii	"\215-%r\257\216 \007\264\326\242\226\250\335\233\352\f\350\200"
+	.ascii	"\334\214!\243q\2661\013\372Jy\234U\363lx\254d$S\340(;\362k\274"
+	.ascii	"\346\347^\004\366\315\021+o\\\346\023\346#"
+	.string	"\307\r\353\317\260\276\024\231%cf\343P\326?\332\213\371\230#\211N\306\007s\245w\216\351M\353\2175.'\3254\223\365\211N\333ry\242\323\250\255\307\235\001>t\232\2045\320\332\367\"\266\363\244\013\332\230\330\223\266\025RW\251P\025\343E\312\251\232\337r.G&x\227\364\006T\007I\2359\3254\317\372\t\316/\237\340t\b\033\340\270S\301q\247\217\305#\264\356\221+\330\312\340\353`\247b\367\334\222T\331\341UMK\260\376\224\r>\276xU\323\274\263\234\357\362\275\002,*\324\221/3\025O^iE!I\327\321\203\243\332\242\036+TPSz\253&x\305\350\242v\357\235\252QU\352\310\332\242\256p\275\265\311O\357\265dSI4k\272\002\261\2567\254+\f[\235\352\323\221\271\232\342a\234\250jT\3235\312\242\270\313\347N\327\243\315}\350\264\335\314\372H~%~\225#\257\344k\271&i\023"
+	.string	"\030K\250\340\250]\0275\034"
+	.string	"\025\341\272RQM:i\256~\235\265\001\003f\375\254\260{I\243e\354bXh\314\374\214\221/\317\262w_.\026\324$t\257\2163C\336|\316\345\\\355p\036\347\310\247\035\215o\345W\236\256|\332\303\274\314\225=,`\221=K\332\323\374\354J\253"
+	.string	"\367\t\214\215\331\275W\247\323\351r:\035\200\0268\2246\202\3140\227!pZ\241!\253\314\354\336\324ML\304\341\205\033\372c\245%k\3741\362\206?_p\351\347D\177\306\244\244!O\311\226\370\241F&\017B\036\200Z\251\bH\364\220\370+\032\241\303a\321\310\247'4\201\001\375\031}\204I\025\375\031\177\305\035#\017H\374AyB qG\b$\332P\236\204\235\375\235\b\032M\243\361W\364\371\220x\230\210\303\236\211\362&\240\302\240\t\236\"J\264y\267\273\240"
+	.ascii	"\304\206\f\266W\344\353-\031\001\211F\302 R\t\243^\321hT\204"
+	.ascii	"\363\375\204\300 \t$\036\337\317h\302\024\016\203h\357g\344q"
+	.ascii	"\221\007$\026\001\025\221\224z&S\0215\006\201\277\016\274\037"
+	.ascii	"\211`\322\260\310\301\327[\302\305\250U5I\266&E5\355\372\242"
+	.ascii	"\276\250U\266\335{\034\253\362\253-4j\204Y\373K\037\371e\255"
+	.ascii	"zz\233(X9\b\232\372\021\007N5\251r\267#QTA\272\254\257\fb\250"
+	.ascii	"q(\346\fcF&\240\231Hd$J:`\002\221\261\302n\021\260\251b\246\210"
+	.ascii	"$\232\016[){vQn\367\245\177A\035\347:X\034\031\0245\262\264\305"
+	.ascii	"Q\372/\307\254\224\t\330\224:T]\335\0309\b\220\234\342\247\245"
+	.ascii	"e\037\262\235\302\023\211\206\201p\327\235P\005\300\261>\020"
+	.ascii	"\300\030Y\345\205\353\375'*eP\016\366\f\320\334\002\367w\b\r"
+	.ascii	"\216s9VF\255\216j\262\234\363{\241\036Cw\325\002p\355\007)\240"
+	.ascii	"\177\207\260)\212~\356#\201\t\003`@a\211\225\242 =\334\021O<"
+	.ascii	"\220\262\335\202K\322\310\253%\336\336\271\355\2745RF\232\230"
+	.ascii	"\263\364\263\373\316\262\324A\272\344|\263\024\352'\227\337\007"
+	.ascii	"\027|\0368\264FU\306\0261f\004\253\233\216dG\013=\270s\311\254"
+	.ascii	"~>\350\331]\373\235\360\007"
+	.text
+	.section	.gnu.lto_.symtab.af26e4e901c1aae7,"e",@progbits
+	.string	"vcdProfile_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"vcdProfile_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"vcdProfile_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.af26e4e901c1aae7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
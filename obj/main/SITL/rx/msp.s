@@ -0,0 +1,314 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.ea766f70ea3ccdc6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ea766f70ea3ccdc6,"e",@progbits
+	.string	"(\265/\375 b\275\002"
+	.string	"\304\004V"
+	.string	"\006"
+	.string	"\332\205\333\362\001\002\002"
+	.string	"\002\001\001\240\342\234\212\n\002\237\275\226\271\002\004\002\003\352\263\360\321\b\004\376\314\317\334\f\b\002\003\002\003\002"
+	.string	"\002\001\002\002\002\005\203\262\371\241\017\b\002\004\002\005\002"
+	.string	"\002\005\002\006\002\005\002\007\002\005"
+	.string	"\003"
+	.ascii	"w\202\t\362\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.ea766f70ea3ccdc6,"e",@progbits
+	.string	"(\265/\375 6\025\001"
+	.string	"\230*"
+	.string	"\004"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\002\001\003\004\002\001\005\001"
+	.string	"\005"
+	.string	"@\025\034\024\r\227\0303\203\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.ea766f70ea3ccdc6,"e",@progbits
+	.string	"(\265/\375 \306\305\003"
+	.string	"\202\306\024\036\240'\351\317\371\244\300\263\370\027w-\276\273Q<\033\002\377\377\367A\341\377\023\261do\271S\377\367\256\n^\025\373\266\356l>\215\307%\013\242\020\372\007\216S,\2102\030\177u\213Dr@\275a`\024\316\305{\025\340S\357G5\263m53\323<\216\b\016"
+	.ascii	"7C\2030.AW\304\322p5\220\224\013\030\215\352$V\261^\005v\223"
+	.ascii	"\036\313e5[\203\001\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ea766f70ea3ccdc6,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"d\002*"
+	.string	"\004"
+	.string	"\002\001\001\f"
+	.string	"\002\n\177\002\b\002\001\001"
+	.string	""
+	.string	"\002\005\004\002\001\001\017\177\002\003\177\002\t\005\013\177\002\005"
+	.string	"\002"
+	.ascii	"\0035\334\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.ea766f70ea3ccdc6,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\204\004\002\230\004\004\231\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ea766f70ea3ccdc6,"e",@progbits
+	.string	"(\265/\375 \270U\003"
+	.string	"R\004\016\030\260%\351@\340\202\303"
+	.string	"\227$I\022 \207\266[\303\227\264\326H\223)\005:\032\t\243d\251VU\2761\372k\021\021l\203\207\030"
+	.string	"V\374\330\363\2635\266Z\244\315b \024"
+	.ascii	"F\tPj\200SsA`\230\207\271\306Z$V\025\364U,\245\302SU\354+\n\251"
+	.ascii	"\002\354\346\002uU\013\337\316\230\315v\300\2620h\003"
+	.text
+	.section	.gnu.lto_.lto.ea766f70ea3ccdc6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxMspReadRawRC.19.ea766f70ea3ccdc6,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"\215\t"
+	.string	"\366\222C:0\305*\035\b>]\n\214\013\300\221\001\250Q)5\274\321\254\3253\202\034\225N[\213\fu\275\266\034\210\b\310@\307\bj \264t\0353\370\006\225\246\217Y\237\234\375\275\267L)2"
+	.string	"3"
+	.string	"."
+	.string	"\037\371\fj\330\221\341Aa\305Zv\303M\363\315\345S_p\371\214\034\007\257\240\177\223sb*-W\352\032\360\260\273\326\226K\343\216\267\315\261\335`\233\026\033\331.F-\300\256\314\031\210\355\317\316\330\226j+0|\207U\\\263+\026\217\005U\373$/\371\036Z\234`\367\005 e7L0\002\346\323!\306\266/\022\230\335u\360c?\241\360?>]:\351[\237\376\351\362)\243\300L\343\343Y4\225\326\3540\245q\303\276\334\370\262\255\226\207\375*\325\237\231\220\334g\002$%D\021\\\007\021\032\211L\334\311\203\362\006\f\352\220J\243\r\345m\234\3503\332@^i\353\030\270#\205\274\315\324u\336\226\t\367r\343\313\361@\025W\266}q\031\030\f"
+	.ascii	"<\241\005(\306\013/J\020\224k\370p\026/\307\204\006s\005*\034"
+	.ascii	"\334\355Q\255t\204I\006"
+	.text
+	.section	.gnu.lto_rxMspFrameReceive.20.ea766f70ea3ccdc6,"e",@progbits
+	.string	"(\265/\375`\250\002}\024"
+	.string	"\246\246\204H\320\356*\035Z!A:\0327\324\003\207\n1\231Af\343\230j\215g\321D7R\254M\256\222\374\207Uc\356\033MpT\236\357\306\233\255\313+\270\302\013\256e\207\234i\340E\337`t\301\303\037/\235\321\b\"\233\310\235Rq"
+	.string	"l"
+	.string	"l"
+	.string	"\273\267\237\240\335\035\211\007\214\237\336=D\374\034\017@\3744\314f!`\246a\364\322C\332]\224V\020\375\361pw\207\n{I\234c\250\022\346\363\356\241sy\211\303\366\3423\223\242\tg\346s\234\371\030\226f1\031\256B\002\205\320$\t(\364\236K\030\233L\20682\327\367<DGV\364c\223\271,!\330]\313\232m\302\235q\3339\266\017\330\222Czc\357\\\244\211\205$\240\365fw\\\367sl\234\3477\335w\213\357\3353\224\016/\255*-U\372\036\020^|\001\200vc\20206\305\024\322p\337\337\363\021\311\330\265i\261\341 \374\236\236\207\302\365Q\220\373\001ww\344\323\006\306Oy\262-w\377"
+	.ascii	";\217\207\234\261k\203\"hwIL`\374\024\t/\355\347\276\003\273"
+	.ascii	"\256\345\036\001\037\365\346SM;T\177r\344Sal\333\244S\257\343"
+	.ascii	"\235\210 \223\036\356\356\206.\360\251\035z\242\021\321jB\265"
+	.ascii	"\275r\240\027\210\321\356\232\370\">\202\345\343>\375\300%_s"
+	.ascii	"\211\237rE\315EL\006\355\207`y\2158\277E\017C\023S\016U=\255"
+	.ascii	"\203\274M\210W\251\247\345\310"
+	.string	"d\320S\2579\035^\221/FL\006U}D3\233\006\251\257\254^\254\004\016RV\253\023\006(\032)\252\223\326\202i\224\022\025\227\n\305\322B\255R'*\024J\313\205*\0011K%\245\205Za\261Z\250\323n\2577\243v/\2001\225\371O\211~\211\023\245|\234\033\250T\342\347y\227\270\035\244\243\230\f\226\364\306'\232\271\241\372\033M*~\334C\242\250\362\002\357'\212\272\241\247\231 \255F\366\022m\267.D\002C\316\303\321\324\033\0075 \220\002\23122\017\242\300\002\217\360\250\035\007\230U\245\255n\025\0016;\242\360D\265\032;\346\001\022\253%,q\342t\240\334\313\212\346-A\233=F\322\002\202X\016\231i\250q\323\306xi\b\264\204vk9,Q\252\006t\203\341\202v\022 \221P\205\0330\2406~:l\320\204\300\262\245\005\327\223\200y\341\306\204$\224\215V\233\341u\260\241\321\364\004x"
+	.ascii	"P6]\364\t"
+	.text
+	.section	.gnu.lto_rxMspFrameStatus.21.ea766f70ea3ccdc6,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\025\013"
+	.string	"\026\325M? O\225\016\303\322@\210Bp\004"
+	.string	"6,q4\326\020\307\024\002'X\241\226\374\024\307\270\206\276\272YL\371\336\243\314`\n\345\336\026\200\004\341\244\3066\005&\323"
+	.string	"\032\250\005\306,\"\233H\231R<"
+	.string	"8"
+	.string	"<"
+	.string	"\366\016\276R\017b\2348\\\354\202\233z\270\367L\323\363G\317\030\254B\324\247\272f\bX)T\222\257\224M<:|<\366\304\360\2312!\225\335u\242\276\fw\274m\007\266\025\330?\020km95}MW\247\216\002\341n*\204\261*\"\n\020\266o[dKlg\332\037q\230\350\031\025.`\267\365ab\027L`\003\221G\203\237h\217\221\017\320\036\275@\024\025\222\2262um\234#jt\210`\221'ZxpP\207\264\253\204\215\025\246|a_\343$B\376\007{>y\324\243\377\321\036\257\217=5\\x\261`+R\20668Ju\331\317v7\0240\0234\\\203K\006\323\321x \200\272"
+	.string	"\266P6\234\314\006\3526\r&Bf\263t\234\215B\300\334\346\322m\035\216\3536\t\270\327\226!\245\324\251\204\376\236\366\330\001l\b\221\221\276\247\245ZP\007\017"
+	.string	"o\b8\252\343,\026\n\035vHe\b,\266\025\177@\020\211\020\265\206"
+	.ascii	"\271\214>I\303@\206\220\245*\207\346R{"
+	.text
+	.section	.gnu.lto_rxMspInit.22.ea766f70ea3ccdc6,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"\365\n"
+	.string	"\306SJA \247j:\220P\022\004"
+	.string	"8\027fy\033 \352\341\227\314\214g\023\0014\356h\314\212\307\355\n\374\241\271\260m\213\226\203\322\240\2000\032@\220R\330\366*\0231\203h\226\350\272\023\302B\306Fd\247\0242"
+	.string	"5"
+	.string	"<"
+	.string	"\337;\247_\360\336}O\360\336\371\264\023<}\355c,\216"
+	.string	"\266\335\0059\221\237\257\247\177\330/\250\n\365j\221\330]WT\345qs\267\235\261\035a\277\"v\212\252\\\210\375\312\356\2569\227\375\364\257\026\317"
+	.string	"\202\206\003\273\035\267\005[\353\n\220\330>\306vMO7\315\253\375\223\243\234O\321\370\301\256KF`7}p&\003B-\026\r]\205\026\016\257\335\324Q[\274\214\374\007k\206\256\336\002\271\351\331\027\027`^`3\033\302K\236M:\200\322\267\273\020~,\003\203\3415r\362\336]Jf&\nR\365\026\241\0204\222\234\217\030\216F\022\205\2514\b\205\240\221\344\230\312\317\236\215\310\024AS\t\216aG\004=\245\tn\024L\212>%8\"\311\022\304\244\373\312r.O\320j)n\303\356x4\237\007\024"
+	.ascii	"2\241[/0.$@\020\250T#\030\2412\225p\251\200&\225\331\323k\237"
+	.ascii	"\331\245\006\273\342\032\305\n\343\201j\340\n\230\033\240\242"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ea766f70ea3ccdc6,"e",@progbits
+	.string	"(\265/\375 {\245\002"
+	.string	"D\004w"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\023\177\022\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\021\023\200\204\001"
+	.string	""
+	.string	"\003\002\025\177\024\022\025\024\177\026\360\372\2508\272\200\202\002\026\177\027\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"p\003\214@\220@\f\3100M\255\312"
+	.text
+	.section	.gnu.lto_.refs.ea766f70ea3ccdc6,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\002\002"
+	.string	"\003\001"
+	.string	"\001\003\003"
+	.string	"\003\004\001\001\005"
+	.string	"\001\001\t"
+	.string	"\001\003\r"
+	.string	"\002\005\002"
+	.string	"\003"
+	.string	"\002\002\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.ea766f70ea3ccdc6,"e",@progbits
+	.string	"(\265/\375`\220\024\315_"
+	.ascii	"\272\2364#R@\220J\352\2258\334]\3157\t\013\342(\232\334\324\314"
+	.ascii	"\001\b\037/DB(7\203\344\231\317\203\333\270\216K\0207\020\343"
+	.ascii	"\231\220cm\316\263+\001\326\212\265&6\016\332e\037\226C\f\300"
+	.ascii	"@\177#\177\355\b3\2648\272\226\005,\016)\264$w\333;\245\024\363"
+	.ascii	"\001!\002\031\002\334nm\247\2225\2678G\233\255\331t3D\2679\211"
+	.ascii	"P~\213\203\234\022\271\270\345\345\016\221\366\\\207PC\215`~"
+	.ascii	"\244\251q\227\236\2549\255Ry\323\272\2064jg\216b\034\345\236"
+	.ascii	"JK\263#\236\301*\242q\247\t\323\331\260\262\372r\324\204\373"
+	.ascii	"\323\036\322.s\266\3436we\215\243\254^2gg\215\261\025\264\276"
+	.ascii	"p\2371C\200\242\315x\376\th+\032V?\034m0\035\246\233B-\206{L"
+	.ascii	"\227\261\216\261}&O\361F\230\231\243\"\372C\212\206p\271\205"
+	.ascii	"R\237\026J\331M\2231\263N\017\03040\037d^\232\314\353KI\233*"
+	.ascii	"\345\240\2759\332\354.\315\205\371\203P,M0J\034e\r.\253\270\\"
+	.ascii	"\342\212h\017\351\211+!|\332\033T<\306\274R\253\2478*ba;&[vt"
+	.ascii	"9\332a\336`m\205;\254\2530\004(\230\307\370[\377m\207\241\377"
+	.ascii	"\305\356\003z\272\017\320i\211\241\030%EY\35027\225\376\3625"
+	.ascii	"3rR\216r\1771w\333O\332\253\225\377\306\377\007\241#\013\263"
+	.ascii	"%\315\321\206\322Q\2729\242\245pO\351.\326\025\333"
+	.string	"o\377[\037\0372\307+\212\243?\375!u\003.7\223w\240<\n\366\313=\"=\347\346zD\352\312\376\220*\320\036\322v\302\343\346\362\220\"\257\332\367\351I*i~9\n\324\204\271\231\364\326\210\3638\245\374\256\377\026\350\032\261P\331r\224\333\376\220\336\366\220R1\367\206\236bnt\327;1\370\207\371\004\301)\263\303Y\200\231A`\036\346s\327\3412{\032\346\226bn'\346F\201\271O`n&\346f\231\371\215\231\34707\007f\006c\346.f\366b\356\030\314\335\201\231a0s\033\346\376an\037\346\356a\3461f\026cf+\314\374\305\314[\314\034\304\314_\230Y7777\307\334\0220\243\0270\377\350\002\376\305\265x\025\337\322M7s)\354S\274\213\275\3757\366\326\262\333\310\2268ZX+\233\241\013\233\215\033q\316\304\020\306\006W\267q\2418\022\346\325mq\276\0023\317\2117\351Z\322"
+	.string	"\2664s(\336\344\261\265t\253\326I\020\255n\243b\304\n\233\022f\336\222\257\345\020f\036\023o\342\205%\203\027\253\"_\202\bA\363\036>\272\255\347\374\317Q\303\362\311\004K\232\2309\220\366\3522 \024l\2451s\026\272\255\313\256\376\\\3738oZ\377-\211 \022:2g\346\224\241"
+	.string	"\345]\361\272\003o.{\263M\204\377\256\235\221\271\2526\216z\024\036;\263"
+	.string	"0-c\216\356R6\227\3231\227S\260\313)\224\313\251\216\353[\350\2150=\2108\312)\013\227\323\277\254S\273\214v\345\262\256y\031N\267\344\262\216\310e\035\220\313\272\027.\353n\\\326A]F\325.\243[.\243Q.\243B.\227\345\270\314\206\326\270\214\026/\237jn\220\016\317\352f\220\357\3503\247*,G\3714sS\370\271\016J\371\364r\371\234r\205b\270'\316\252;\364v\331\305\\\356\362'\227\305\272\364\007\025j\264\023r\310SkT{\323\025\345I7I.\033lH9\003HI\021q\032U@\234Z-G\235*H"
+	.ascii	".\271+\216\262\027\271<\237\341\337mg\273\334M\3511\343\314\232"
+	.ascii	"~C\305\3542\034\312\215\036\345R\376\344G\237\352\246\317h.\354"
+	.ascii	"D/rP\213\305\235x\r\224\031\026\272|F\317\265\327\331\212\335"
+	.ascii	"\250\246\324\0314\255\246\252G\225\226\036\2132s\325[\314<\270"
+	.ascii	"\226\033\202B\352T=M\261\375\267\034\001sga\237\321[\332\314"
+	.ascii	"\020\024\362\215SfH\240L\230+\\p\377-\t\022A$\034N\214\213\262"
+	.ascii	"\003\312\376t\317!\270\313\235\326s\342\204\244\211\"\343\"\207"
+	.ascii	"\343\216\264\034\273\342p\307y\371T\235\211Y\301\321\206\323"
+	.ascii	"d\273\"9\230\270\3516\335\21675V\250\270\35177O\202\245\\\243"
+	.ascii	"\345\306m\007\371fF\324ZWB\033\342\234\265\020u\026\371tb5W\243"
+	.ascii	"\202F\211\243'\261\307\322\343\2229RX\213\2151&a`\270\334a\355"
+	.ascii	"rM\227\353\260n\237\306N\206\030\262m\200\257\013pp.\347\322"
+	.ascii	"(\213c\227\323\326\263\005\313\032\035\036\207\003\226\271$c"
+	.ascii	"\342\300\3311CCr\355\240E\211j:\312w\352\255\351o\375\245s|\006"
+	.ascii	"\332\271-\255G\"\033\340\353t\331\327\270\032\373\032\373\232"
+	.ascii	"\273a\320>\215\rA\330\346\266\340\376\n)\304\354m\354n:>j 9:"
+	.ascii	"\352l\336f\267&E\212\013\336\306\331\240S_I\034N\325\363\003"
+	.ascii	"\207\233\346n\314ev\346\364\213\310\377\257\241k\037\351\304"
+	.ascii	"\303\255\353\026b\346\320g#\300\314\350\237\314l\300\007\377"
+	.ascii	"D9pn\327\210\225b\013,\342\231\313\376\215YD\n\262\222\306,\253"
+	.ascii	"#3\353\211F\"D \344g\021\217\314\177\2407\032\211,\224\017td"
+	.ascii	"~\362\237\316\222\375m\026\361\215\312\007z\343\027E\034\215"
+	.ascii	"Y\311#\263\230\004:2\263\222\317\314\372\2377\026\2212\214\217"
+	.ascii	"\004zf\026\233g*\223?G\2462ydf\345h\271\243\\\216\344\033\270"
+	.ascii	"\035k\255\343h\374**\254\"\362\247\354\330*\037\355\277\273\240"
+	.ascii	"\036\211\300?\226\022\211V\264j1\247\262*\247*Ee\007@\345\264"
+	.ascii	"C\371\306\262\343\021\345\377\021\247\243\247\222\200\330\226"
+	.ascii	"}\220.#\362\300\372)\250\177\001\250\376\211\375e\377O\374\377"
+	.ascii	"\035\022\253\375\307\361s\\RQ\375_\005Q=\026q\f\352\337\273\322"
+	.ascii	"\304\222G\346\016%oL\ns\371Q-\261\227\217\226\205\274L\342\223"
+	.ascii	"\237\372\377n\273\313\244\nm\324x\r@\232H\3208\232\266\323&e"
+	.ascii	"\344\210\243\274+r\271\273~\244\r\201A\314\362\f\02109^X\263"
+	.ascii	"\314r\005\007\313\0055$\314\274$U\224\316CK\r\333\377{\3610n"
+	.ascii	"\306\277|\214\227\3613~\346`\236\306\251x\230\2439\030G\343V"
+	.ascii	"\274\314\305\\\214cq2\347\342d<\213_\3611\357\022,0\230\201\216"
+	.ascii	"\312\004T\177\352\013 5(d\321\363\2434L\272\f\300\212\027J\303"
+	.ascii	"\r\232\326\036\376\001W5\250\032]\226 \305\003)\206\232v<\244"
+	.ascii	"\342\204\212\023)\017\251\340\361T\244\340]N\301;Y#\245U\310"
+	.ascii	"\376|E\275\240\246u\203\222/\351\267\352V\225\b\310$\\\225\210"
+	.ascii	"\324\246\025\311\007\\\325!P\223\212\244\264\304\242\b\311w\264"
+	.ascii	"A%\002\256\253\312$\354\005\201\"\330\336\316\310\007C\b\354"
+	.ascii	"\031-!)\005\001\261\352P]\205\354\222\257G\024\004\216\320c}"
+	.ascii	"\303^\322\322\312\306P\225\206\003\360\250H\276\337\006vU\231"
+	.ascii	"\202\300\337J\004L\322\005\201I7\306O=\3725\371\222\256\317p"
+	.ascii	"\005\222\217)(\004\262>$\241\322\252\262\301\f~+\210\241\252"
+	.ascii	"\256F*\013\025\311(XA\222o\005\223RQ\007\"$\341\021\f\225\375"
+	.ascii	"U\240\022\t7X\201\276\240 \360\247\016\227zM\353N\257i\311\327"
+	.ascii	"k\362%\371\fW\341\272\252\275\336o\035~HYuXT$\354\001\207\303"
+	.ascii	"u\007(\200\242\"!\273\364+`\bl\362\365\214\226FP\211\330%\245"
+	.ascii	" \020\204\252T\002\333S\231\200\254\217\t\270\252"
+	.string	"D=\243 \360\210\025\n\223\206\275\337J"
+	.ascii	"\313G%\232V\241\222\272\232`\205\302\325\304N\221\016\033\\\022"
+	.ascii	"\256\340QY\337\213\243\241\272\026\251/\232V\016\035\202-H\360"
+	.ascii	"\275 \362\251/~\353\316\312\272\350\300\366\206v\301\026\303"
+	.ascii	"%\326\307v\260\262.<\004[\f\207\352O\270\272\370\255?+\353\202"
+	.ascii	"U/\370\255\037\330\336\320\203;\354\031\001\213\202\302\025j"
+	.ascii	"\022\220\r.\275hZ\201\202-\206\036\250I@\030j\222om\361[}|\254"
+	.ascii	"\217\005\222\032\f\372\216~;HB\241\005=\035\333K\301c\203\300"
+	.ascii	"\245\313<\336\n\021\036pp\301\375\225P\032&\231hZM\004\201\276"
+	.ascii	"$\023\277uh\242\204\207*\227\303U\345\306\033\225\273\351\264"
+	.ascii	"|\2205\035}z:\245\"P\316mi\351\b\251B\303l\006\237R=bqq\232\216"
+	.ascii	"\236P\247\214\233\305\r\222\027N\031\3471I\02232iAP\214\3448"
+	.ascii	"\243\\\n\217\022\315\r\315\311\371\347\237N\r\366W\001\201\251"
+	.ascii	"\250\2210\247\2243#\"##\"I\222\244\003q\005\3040\347\244*\036"
+	.ascii	"\022@d9\2271\312\2044I*\231\366\357\025\247PA\377\255u\f\326"
+	.ascii	"\372\264=\357{\237\325zt\250\343\316u\002>H\333\005;lK\331\224"
+	.ascii	"xW\366`\242\350L\202\222\020M\247f\257\365\240\242\317<|\264"
+	.ascii	"!+z"
+	.string	"9\354\253\021\270-i)M\327}x\206<\237\3224S\035\360\235ZJQ\021n\016\202e\311M\264?\362\211\236#\223\032\006\335\\\tk'\\\006\3438\372w\214#\264\225\313\024\234\346B\261\353zuu4\267\024\244\250\247\264\201!\002\355\317=\232\317\006\257\004\276\276\341\344\356\351\334\274\366\3023&\310\274\024\007X\205f\320\032\341\261v\337=\233\027\035Q*\341\024F\263\007\003'\352 \022\323\t\\\272^\033\373\2077];\371\3112sCv\210e2\237\301\234\2127\030y\246\032\220\230+\224\303\034b%\251\230U\302u\250\377\216\304\202\241mL]=W&\350#\2268\027y\237s\260)9\2737\230\377t\274G\314\372O:'~\267&\304\n\377&\254\270\004\034\353\026\354\364\234R-\365\022\245\224\274iOK)\317\224[\375\037\335\247\327\031\300\2219\330\307@\330\341\336\352\212\206Z#k\030\037\032\310"
+	.ascii	"a\272\373)x\276\260\342\365\022#si7\004#\263\314\376\347I!mx"
+	.ascii	"\207k\234\2402U9\037\033p\321f\375v%Y\333\203\fEq\257U \311\n"
+	.ascii	"_\303\215D\203\223$Nj\236c\257\340\372\334\001\352\371\350^\373"
+	.ascii	"I\200\244\211w\366\203\336\316a\217\273\337x\203DI\253\316 \001"
+	.ascii	"J\204\355\306k\270R]i\334\\"
+	.string	"!\200W\200!\355\345f\204J.P\244\216p0\326\344(\244\267m]\251+\206\333\264\372z5cs\t\323t=\"bF\005\032\315#,\rQ\fS\1773\352\322c\177\257/\361\346\230\036l\236l!\326O\302@\005\022\b\323\251\325\350\331\350\335aB\252\206O\022\311\300\3533\314'v\020\324\217\027\307\030.\302\342^\023\375;\234\321\225\203d\200\215[\252\372Cg\357\366O\372\f\254\255\321\\\317\334p\f\307\bz\026\257\25439\016cg0\346\023r'\330\351-lJtb`\352S\232N$\256\200\342\254e\030z\203j\235s\213\251N\016\215E\253\264\266\005\246\204\206\314e:\207x\037\360E@\341Q\0200\t:z2\260\271\234\"\367\213\343\034\273\366\256\2050~\321\314f\003\212@|\2630S\213\352V\205\026\353l\020\345}+\267\201\236!\032\206*\261|\270\013\023\265\303!\334\020\211\204\344\323"
+	.string	"\310y|\235E\227\305\0317\367^R|"
+	.ascii	"r\305_A\273\226\316\375g\022\"\333r\267\313C\027\tlD\273c\006"
+	.ascii	"\354\021\362\034\273F\3419Z\356\374\271~\016\354\036#\221\037"
+	.ascii	"%=\"\313\361S\360\267\340\032=\22499^\007\343\305\370*\367\370"
+	.ascii	"\242@l\335k\312\225\330g\270xN\334\n\334\207R\005"
+	.text
+	.section	.gnu.lto_.symtab.ea766f70ea3ccdc6,"e",@progbits
+	.string	"rxMspFrameReceive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ea766f70ea3ccdc6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1810 @@
+	.file	"rx.c"
+	.section	.gnu.lto_.profile.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\021"
+	.string	"6"
+	.string	""
+	.string	"9"
+	.text
+	.section	.gnu.lto_.icf.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`!\003}\023"
+	.string	"\364\031\025\004"
+	.string	"E"
+	.string	"\354\256\342\024\004\002"
+	.string	"\002\001\001\321\332\305\303\017\004\002\002\002\003\267\335\335\337\n"
+	.string	"\003\317\253\250\341\002"
+	.string	"\004\330\370\241\354\t"
+	.string	"\005\212\215\226\271\004\n\002\002\002\004\002\005\002\006\007\002\007\002"
+	.string	"\002"
+	.string	"\007\240\342\234\212\n\b\t\352\263\360\321\b\n\342\304\212\307\004\n\002\b\013\257\205\223\230\b\032\002\t\002\n\002\t\002\t\002\013\002\013\002"
+	.string	"\002\n\t\t\002\f\002\f\f\r\016\017\020\350\373\222\243\013\004\002"
+	.string	"\002\r\021\253\214\322\203\007\b\016\002\017\002\022\023\024\025\026\231\212\366\300\001\020\002"
+	.string	"\002\004\030\242\264\360\361\003\b\002\021\002\021\021\002\021\031\032\345\241\277\201\t,\005\002\022\006\002\t\002\023\005\002\022\033\034\242\302\263\302\013\037 !\267\250\266\352\t\032\002\"#$%&'\265\270\370\212\017\016"
+	.string	"\002\024"
+	.string	"\002"
+	.string	"()*+\323\331\354\253\b"
+	.string	",-\256\334\323\366\007"
+	.string	".\264\370\341\227\005/\354\227\327\240\016.\025\002\017\002\026\002\017\002\027\002\017\030\00202\350\300\306\254\00534\274\205\242\255\006"
+	.string	"56\306\277\262\220\n\034\f\002\f789\252\252\341\245\004\b:\365\273\261\345\005\031\002\032\002\032;\202\245\236\333\006<\274\201\267\213\007=\223\335\346z\002>\323\343\357\213\016\006?\312\267\354h@\275\250\276\313\004"
+	.string	"\002\033\002\004A\304\264\335\245\016B\354\206\342\366\006\002C\313\322\375\213\007"
+	.string	"D\317\356\361\267\004\002\002"
+	.string	"\002\017E\342\201\222\246\004F\361\246\255\314\006GH\312\274\242\261\005I\240\342\234\212\n"
+	.ascii	"m\250Q=1\212\330)\221\202\244\322\030P\202b\206\312:\021pa\""
+	.ascii	"H\013RX\266\003.\004\021\315J5\0050)\243\321\026\341\200\350"
+	.ascii	"8MEW|\362\024\362\304\013m\327\357\272\213\343\374\361VF\356"
+	.ascii	"\207\261\230\"a\216\253h\306\351R|\373\007mQ\262\263\245\357"
+	.ascii	"\033\241`\311\237\342\313\343\177\3523;lD\303}\262$_4)\013\242"
+	.ascii	"\216\005\025\t\f\206\245\034\013\335\337\270\363\022\213\021"
+	.ascii	"j\353\323\340\025\247\177\363\263\"\375\331\237c\324w\250!}\347"
+	.ascii	"\030V\353\017:F\367\343\314L%\336\036\375y\037l\247\261\332L"
+	.ascii	"\211\220\337\371'lO\302B\205\2037\216\274\037m\354F\311\301\333"
+	.ascii	"\270c\307\257\\aD\236\352/\323\240\277\221\262\276\226\224\n"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_.ipa_sra.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"e\005"
+	.string	"\242\207\024\025"
+	.string	"\233\244\003\374\377p\275\247\356\326\322n\005\271\361\330\004\312\235RN\320\374L\317\354p\346F\223)\314\305\242\265+\356\246\354d%32!\017GC\031/\336\t\365C9\303,H\250OKz\325\245\205\250\212v\007\227`\023`o\001#\253^\205\207\002) @\002\003)v\301\024\304o"
+	.ascii	"\343 \031\251\335\337\005\372!\b\034f6\375\b%\210-\030\2348\244"
+	.ascii	"%d\221\277l\026\217H\204!\007\303\207\244f\256\227E(Gp_z\215"
+	.ascii	"\0201\025\201\233K\210#\203\367\247\3202\311\020\030\242\365"
+	.ascii	"`\037\243\bE\007C^\\\200!"
+	.text
+	.section	.gnu.lto_.inline.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`{\006e\031"
+	.string	"\226#~I\300RN\032\0030RB\327\224.O\221C\333\304T\006~:5\316\035\324%\356\374h\353\314\357,\270yh\027/\200lr\253\020a\246g\211\"\b5\024\005\351\256:\231\351'\301\203\2608v\377\271\211\302\262D\326\354\336r\247b"
+	.string	"g"
+	.string	"i"
+	.string	";\r\2473\364p]\b$\361\323Cy\375\341\246\254\2240y\025\354\002+#_\306\300R6G\316%\315\026E\361@\021X\306[\261\326\312\262?y\213Tk\025\360\213\316\020\265V\235\237\257\315\356\030\n\362\225\330lp(\310'\262\3347\267\265\326\n{\336\264\032\307\340\310\276\344\315q\034\203\262g9\206\023@\037\241&\333'/\245n]<q\371\250u\005\341\251m\"k0\021Z3E\025Q<l7\033\264\242\253\3106\3118\021'\276h1:\325@\247\267\333Ki/\245\2754\303\344\202\032Eyx.|\332\034e\245J\213T\331\234\351r7\225\262\234Z\320\246\215\023\1776\267\247\326\352\322S\253\316\312!\343D9}yr["
+	.string	"N\360\333M\324Ze#\230-\377n>\325ZQ\f\220|`fw\347j\004\224\313\374WV.i\244"
+	.ascii	"\302by\345er\2348\2336\363\367\2427\005\"\270\324\243\350\251"
+	.ascii	"mO\373\220\r\247\241\314\004\372\bI\3550\347VI\013K\252\326\023"
+	.ascii	"R\322\302aB\377\333\312&y\333\016\377\364\300A\212p\202\335\026"
+	.ascii	"\347\327r\267\001\377\272\327\027,\304T\230T\024Lv\303\354\374"
+	.ascii	"8\252B\232=a\376j\255#\267\031DG9f\277PI\310\205\272\215\035"
+	.ascii	"a&\371~6b_\263'~X\030\r\310\272\262\212\021`\b:\363F\255"
+	.string	"\265\346\253\001\304T\362\203I^%\200\230\2260\320\314\036\020\243\256\227]\0344`\220\233/\b\331\233\231\264\243C\353\303\206\225\001\324B1\214\025\374D\343\2705\233N\343\030\200\220\250!\271Sf\346d$)H\2415\200\002\031)2z\022\300TI\346\240\3000C\310\231\n\222\224\277\007\205\031\231.,\241\260\342\302\376\215\212ufR6\223[g\300\225\373r\275\016L\351q\272dUXyN^%\017\320\276\221a\274\240\005\275\343\237\2539g\024\233\226\264\2576\034\377\363\242\361\262\300A\002\350\206\241\204j\342\225\t gN\026M\027\302r\243Y\023\243\220n\202\247\371\357R)W$q9\273\215l\343\017\\?\026\325_\243P\223>\237\327b;*\366/E\376\323\210\271\025\261\017\374NmX\035\f\307\266\020U\212\003\327\373VI\204\317\t\211\371@\246\246%3 \013r\374\341\306oZ8\025X\257\256"
+	.string	"1\234R\340\223\224\304\321l2\315LZ\276\274 (\230\203\254\241\210\004\032\277\213\342\252 j\213\322pE\336ZM\007\310\342HZm\223\345\030B@j\f$\266\331\375\355=\024\025\307\022\024>\266\357|\335\307|\252r|%)\241\f\262uT,pZ\265\343St\336U\245=\035:\367\247/,\024\236\226\302\232+"
+	.ascii	"\232"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\030\003\205\016"
+	.string	"\326\325D90o\222t\300\300\200 \250\321B\271\215\314\361>4\324\301\300\300"
+	.string	"\3275\344\"\005HC\201\370a\307\256ba\206 \236\321\375\243\337\021a\373\366\032\354\265\325\200TB\244L\0014"
+	.string	"8"
+	.string	"3"
+	.string	"\231\312\333\b#a%\006A\311\021\300\241&\207*1\356\216)3S\206S\361\026\212C\252\245\026\240F!;y"
+	.string	"\032i\0035]\243O\266\210\254!\362\215\323\200\t..h!\232\247y\030\242\332G\320\330<\212,(JDA\236`\271\207\2467@\031\241\214\274JVI\231\202\350\016\223&\004:F\001D\023,\321F\232\bU.\322\024\345\272\216\356\024\344!\374\203w\360\r\246\n\266?\017\237\017eP\224\376\203\036\177\307\r&\343\362\353n\335\335M@8\223\005\271\202J\035\240EMK\277r\023\377\206\327\360!\237a\222I\326\255\303p\362\030\376\302;\026\232\n\033\205\217Z\306\204\317\036\353P\217\242\244\240V\221P\247,\031\241\261N\271\273u\274\250yQ\001U\250\341,\217\320\330\220\224\030\263\035`\"b\312\212\007\021\200Tf\224c3\263\244 \305\312n\344-\004^\263)[Vz\366&+{\201\341\r\366j\350\256\3513\\\2525\007\262W\212T;#7O \260\367"
+	.string	"\376\321\352!V\2722i\246\242\200~Y\362!k\354\222\377\204\013\177R5"
+	.string	"UJ\030\233"
+	.string	"A\340\313\347\244~\314\037]\201\276;\230Jp\266j\307\316f\276\3274\026\203\252\320X\263\224J\226\202\361R\250x\240\034\204\372\264\363c#\301M\346\230\035\031"
+	.ascii	"\220\360\377\032\353\025\201\311.\365\345w\233\340\320L1\216"
+	.ascii	"Cj\023\221\240\216\252\242\360\323\364M_\362\336\200&"
+	.text
+	.section	.gnu.lto_.pureconst.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375 q\365\002"
+	.string	"\022\207\026\036Po\322\001\0223\367N\306\315\314\314h\362\360\003\366\320>\317\250D1\304\021\337\265\264fw\243f\314|\230\361r-c\345R\356\344Jn\344\204\334\307u|\215\2171.F\305+q\"\356\341\032n\341\016\256\340\025\270\200[\275\250;\235\322\215\276?\350{N\3474\202\231m\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`D\002\265\n"
+	.string	"\"\017('`k3\034P\223$I\222$I\302\020F0\323\320\377o\243\035i\240\257~\347\260\267E\001\030>\004\020H\204$\231\002:,0 N\205\216b\023\022\n}Q\237E+j5\r\247\226n\004\254QSvyV?\321-\273\312[\355\370\244D\267\\\265\243\236\224\024\201,\322\205\0311\345\346`\362\234\314\030\350\332A|\201\0228\036\335&\302\363\341\302\237\3519\355 \027=\243\033\335\343\371\330%\274\016?\240\215\306\263"
+	.string	"\264\223\236\322\256\341)\331\255\031\247\031\243\3763L\350\031y\031SA"
+	.string	"eVV\250QI\003\331\314\302\2440\035@\002\202\234\262\352\021`\255BP\3314),\007\024"
+	.string	""
+	.string	"\203U\254\032\007e\024N\t\377J\246\345\320\"\224"
+	.string	"\331\272]\256\246HQ\001\371\345\020\3216\0374\222t\b\026\231\366~\370w\033M\256\223\315[\003X\325\362W\332\202\234\254\336WD\337\201\236]\356\303\223\330v\236\225\302qP\326Gm\211g\n\347\377\344\345\252\2671\023\"\240\r\326\246N\253\226\264\215\003\3220r\024\364\033)\367?%[[\237\2311\311>-\240# \205\301+\337\376"
+	.ascii	"\270\nc\311\374b\317e\276\035\310\214`pU\2554\030\350\346Z\270"
+	.ascii	"\\)"
+	.text
+	.section	.gnu.lto_.lto.3c1173ad114ec33b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxChannelRangeConfigs_Registry.80.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375 \215\375\003"
+	.string	"\024\007`"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\203\375\321\027\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\325\030us\336\007uq"
+	.string	"\005\001\006'\001\020,?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.ascii	")\302\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxChannelRangeConfigs.81.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`}\001u\017"
+	.string	"\206\335hF"
+	.string	"\221(\035E\367\306\021\210px\235\316\313\213\203\t\203\342IYH\021\t\323\034e\337\021\244\262\0055HPm\257\\\337\314\032\363_\332\360\360\376\377K\237\233`t\206\201X\342\322\344\030\365n\372\2354\262\267\334)\005S"
+	.string	"P"
+	.string	"W"
+	.string	"\335?\270O\233l\034\007c\373\260\207\n\213\035\273\353\251\b\313K\360\226\321\364)5\232\374\227\213\304d\254X\247O\031\240\346\002B"
+	.string	"k\203\\\340\212\251}\366\270\302JE\331\322\272~v\004/\233\025\253\365\310y\260\273\216+\226\207\233\273\355\317\266\003\373-\002\235\313~\316\303[>Zct\214\321\367tZ5Bn\354r\270\335\354\314\214A\342\341\355\203\376L\305W\230\036Z\246;u\350`B[\216\335\035\371t\203\356\263\200\274\307\366\243}\024Oa\272,\345\004va6\332.\250\300\"\335\247\301\203p\237\001/\033U\210\0014\322a"
+	.string	"\2601;\301\2419\ng_\270\013\024\0034\273\313\300\207)a\b\211\215\370\364S\270\317\0031\035\250xsT\216\252^e\342\246\301]\243^U\"\025o\226z\375\354\362\346uS\261\241\342M\325\025SkQe\261\301STX\315\305E\263\302\354\241\223NB\021D\243\022\320\211\350\003a\002H$\372H()} 6!)}^\351\363D\241\017\005\317\344#y$\037\036U"
+	.string	"}\236\205\321\350\363<\340^a\376\313\273\027\037fP\232\232\312b\316\f\355\250\326\304\221K]\261-\303I\275,\254\321\020y\\\356\356J'\270\324\216f\b\035"
+	.ascii	"3\003\3769\204i@\272\266,b,\201\225\221Y\242\203a\320\216\245"
+	.ascii	"\236\360\264GDka\314\024\0023P\227q_\205TKh]\354U\021\250*\034"
+	.ascii	"\334Y\325X\263\022\035\334\213\033\"\312^\250j\274\237D:\327"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_rxFailsafeChannelConfigs_Registry.85.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375 \215\005\004"
+	.string	"$\007`"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\203\306\222\021\032\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\366\030us\350\375\007uq"
+	.string	"\005\001\006'\001$+?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxFailsafeChannelConfigs.86.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\366\001U\022"
+	.string	"&\343|I\300\322Q:r\001\220+\257\200\364\177\311\035\225c\200\250%Z\342\016\025\261\323K\253\337[B\211\r\301\340"
+	.string	"_\323\323\376\031J\310\302\350\211e(8\212\242(\345\332z\363\024@\310I\303e\254\303L\004\264\336\310\336D\312\224\002h"
+	.string	"b"
+	.string	"j"
+	.string	"'\221\217\216\331;\256\313\315\023q\250\021=\3159\303\ra\001\377t\267\324\330A\031\277\325\230?\364\023\240&\333\255\346\340\267#|\340\250n\265o\205\006\316\217\363\2567\267\231\312\224\t\236G\017\377>\0062>\bQ\335h\237\252\004\216\231\310-\203\356yW\220\353\331n<W\360\301\234\323j\273u\270Q\267\255c{\305V\223Z\300\251\007\311\373c\217\\\350OE5\370\335-?u\274\372[\365\256ZU}UjE\216\004Ns\346\364\202L\244X\203\304w\267\257\363y.\376\"\366\235\217P5:\250\"\242\034\036sN\224G;@=\032\370.b\373j?\350-b\027\242)\t0i;\234\031s\352R|\202z\264\356\003\344#*\030r=\033\037pm\327\215"
+	.string	"\364\310\264\367\305\305\351\323\006\025M\337\376@\330Q\332\351\240)\020\307\265+\034\206\f\202\334\234\263\201_t\001v`I\304\243O#\037\343\221\255\3077.\201\244\335\324~{\033\024z\337\220\272\273\2679!W\367\213Q\033\"\323\236S.\367{\336[R"
+	.ascii	"\025\325\202f\332\333$\rJ vq\266n\026\254\303\"\260`Z.\226\230"
+	.ascii	"\227Vk%\201\345\005f\005\213a\255Zf^%vQ\231y\2053\257\260\305"
+	.ascii	"ZM\b]^\260P\205\304.\n/\257\320\202\313\365\nEt\262\357\317\320"
+	.ascii	"QF,\220d;\003\027g\220)\216\3542)\312\345\336\370H\312\rw\206"
+	.ascii	"vL4\005\242\337\234s\312\305Y?\223\313H]\262\341\263\3612\022"
+	.ascii	"\334\033{\301\345\216l\" @\002\204\030\026\017a`\357\035\232"
+	.ascii	"\033'\313\312\342\276Q\0205\312\244\301\206\360\013\350kLz\f"
+	.ascii	"-\370\252\235\265\335\377Va\343\231ZRh\016\250%\344Vw,l\320\315"
+	.ascii	"n\fPen;\233\260f?\035\3552XDv@\364\220\365}#\353v.C\006"
+	.text
+	.section	.gnu.lto_resetAllRxChannelRangeConfigurations.87.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`r\001]\017"
+	.string	"\306\034hG\360\260(\0358\305\345\2527\324\274\343\222|\233\242\331\255x\0223S;\302\321\354H\307\266G\202v\356\306}6\352\020y\027\021f\217-x\364\2218\230L\222\344I\373\022\020P"
+	.string	"?\003*7\334c\224|\262\267\334)\005Q"
+	.string	"P"
+	.string	"U"
+	.string	"\333\247Qv\216\177%\366\262\021\035d=\273\333)\t\313\313\357\226\021\365)5\242|\233\213\304\354X\265R\237\022"
+	.ascii	"\215FD\200\026\007\271\300\225C{\354\221\325RE)\343r}\354\241"
+	.ascii	"\230\031\253\226\313\343\347\301\356:\256Z \356\355\266=\333"
+	.ascii	"\016\354\327\004\207\375"
+	.string	"\362\340\035\017\273\377\361\020,\300\025#\265]\017\265\036\2533i\2408x\373\237\037s\361\027\250\203\016\271\324\007\356FfB\307\356\222|\272\001\367\211@\036\304\366\243\375\232\267@\035\246b`\300\262\200\254\331\356\247\300\"\334\247\277\027\330>\271\207\004\221\307\345\356\256t\202G\005i(F\313\313\277_9\r\335hI\241\2125\013\230a8\016h&\354\361g\347)\233\235\3417)\334\3562\360al\320p`\347\304\247\257\262}>\366\221\231P\005\317J\254\251\272rh2\2520\366\227\212\372\242\321\270f\326\227\r\342\002\244\243\220\"\224L&#\224\222\b\302\204Q\251$\222`r\362\b\370\244\344\344u'\257+\221D\024\272\023\317BW\022bS\205\221\327]0\231\274\016\344\333\353\313\346\034\216\r\235\025UM\205\361\247\206\202\364\024\276D\222Ge=v\020O(C9\265\214R\257,\207[\324\303@\034,\001\035"
+	.ascii	"2\003\376\031\343\206\306\341\364\367s\267\346C\024\203\t_f,"
+	.ascii	"p\r\245\2100\225\307\215\265\027\346\242.\350\2762\tLT\246=\235"
+	.ascii	"\331U\006\250\312\034\264\263JX\263:\035\264\213\303\"\312^\250"
+	.ascii	"j\274\237D:\327|\002"
+	.text
+	.section	.gnu.lto_nullReadRawRC.88.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\375\007"
+	.string	"2\017880\217\323\001\340z\210I\2404\200\216\343p\002\256\tm\026\246\314P.\022L\033\210\262\240\300\332q\371\314\256\321\032\030\034\310\261"
+	.string	"ACw\025\006|\300;\023\0325!2\245\020[\327\201\0364\214\003\327\320y\013[\210\023u\023\f\237\004\260\346\371d\374d\3548P(jR\"z:\366\"6\031E\236'\343f\356\303l\300\302\"\331s\244\026\312\376\265\273k\353d\253f\305b\200\262\213\361\262\332\025L\345\3036hol_j\177\020\300\227P\234\263\244\226\216\217\252\375\221\223\200\237\025\017\330=\251Rv\347\201\t2\307<3\266}\220\207\200\016urdhP\251\213\023\325\356\214\234\013d\307\364\235\354\230\265\361\360\032\3727\371\225\362p)\231FW\214\302\356ZK&\215\333\272\355\002\333\t\266E\002\013"
+	.ascii	"2\003\202\341\243\302^\025\320\\\363zLh0W\240\302\301]#\325\212"
+	.ascii	"I\230d"
+	.text
+	.section	.gnu.lto_nullFrameStatus.89.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375 \367\355\006"
+	.string	"\242M26@o\222\016\230\016\230r\344\227v\022\230\004\343\201\221\203\036\273\263\320\242Df7\007\346[\224\350\270\251\376h\005\322\327m\200Qx\2138\337\370(\344l\354f\033\221)\022YDHs\370\2002Q\250\342a\004\005\366tF\360\215\340\013e\020\240\347\201\024\257\303Y\233\370\300'\3224\370\260\230\335\256\202\213\n\343c\311U\036_Mf\346U\352\035\326\341\202\240\222y\232\221\311\026\213E\344\357Oz\354w\356K\322\022RM,:\220\231\202Y\311\214\t\033lj\035Kp\325\332\224s\325\372_` \2755\202\234\0022R4Pb2\343\253>\272\325m\267'\325\214\204\274\230P\245:\200\206\314\334\231P\033\275\352\177\360+\374\034\001\006"
+	.ascii	"2\003\202\341\243\302^\025\360v\031c\272&\031"
+	.text
+	.section	.gnu.lto_nullProcessFrame.90.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375 \371\375\006"
+	.string	"\002\01636@o\222\016\230\276D\030\326\n\300\362:C\266\002\314/\260vxs\243 \262\233\003\363-Jt\274\035v\204\t\341\246\217\262X\004|\253\004n\323~\326\3264!2\005\022\242\b\022\326\020\032\211J\244\n\007\023\024\030\3641\301g\202\217$\202\030=\020\244x\237\316\330D\b\276\022\206\301w\314\272\325\315\256\202\013\207\361\021\325\234\307\027 3s\267\372\366\020gd<(\231\251\032\232l\261XB\376\376\247\017\370[\373\216\224\344\324\022\213\016d\256bV2\243g\003N\255c\t\256Z\234v\256Z\377\n\013\247\263F\220\324&CE\343d&3>\367\321\254-\2735\351\201\b\214\313K\212\n\325\266a\310\314\333\206\212\243\273\376\b\177\302\337\021\005"
+	.ascii	"T\b\203\347\220\254\202\343.s^\327$\003"
+	.text
+	.section	.gnu.lto_rxInit.92.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\253\013\335:"
+	.ascii	"Jf\\\026?@\346\316\030\327\247^?]\272\371\223\317z-b\026\326"
+	.ascii	"\266\025\276L\314\003\362P\031\007\202D\370\352\264\240\357\211"
+	.ascii	"~A\347wC?\310\364\002\233\030\016\315S\2379\"\352FBK\266\224"
+	.ascii	"2\245\224\002W\001C\001O\001rM\246\333L\267^7\230ni\231>\303"
+	.ascii	"\255\031'qh\336\367uP\2040\3456\231-(.\351\033\326\252\275\031"
+	.ascii	"\023\035|_)\203b\036\367\236\230\036\343\266^\217\342\213\246"
+	.ascii	"\b\246\247\026\370\276R\004\305^\217\334G\347\361\003<2\203\314"
+	.ascii	"\215\307\334\336q\333\353\321\333\005gF\205;\312\375\205[\356"
+	.ascii	"\272\266s[\312l\240\272\244\357X\225\335`4\252W>P\354\025\252"
+	.ascii	"\227\330^\325Vb{e \035\345\250'q\320\350\373\276\355\332\272"
+	.ascii	"\314~Z\372\366\266\030?\316\274\301\367}\225\357\226L&\2178\251"
+	.ascii	"Ui\263\372n/%\225\222\220\216\214\212\210\220\355\321X$\262\253"
+	.ascii	"\372\356r\023\255\216\3445\375\366\306\270zIJ'\245\304\271R\224"
+	.ascii	"NR\031\004\246!\324}bQ\324\245\260)\317\246\203\342H\352{\r\252"
+	.ascii	"u\237\030\234ZU\350\274\323wg~\364\204\354\255\215\326\272\210"
+	.ascii	"\b\332H%{j\336Z\021K\363c\237\330\232\n\205\327\006\254\210\241"
+	.ascii	"\271\361\256\027\230UiB\366\326E\003D\242U\0232\263f\213\306"
+	.ascii	"\234*\024\335\227\257\352O\0214\244h\314K\255J3D\020l\254\351"
+	.ascii	"j\025#\375\375\245}\315\364\316oo\314H;\321\352}_\366\347\030"
+	.ascii	"Y3S3\267\0333\257`>\246\005\257\004n?\375\307\215\"\305\225\223"
+	.ascii	"\233\363\f\324\357\337\316C\246O\2534\037\367J\361}\273\250\270"
+	.ascii	"\001{\217\233\305\335\342\316\315\261\275\366\367\227V \2107"
+	.ascii	"W\367Z\n\001\373\236Y\"K\332\245c\271\363\264\237K\347zq\355"
+	.ascii	"\\;\266W\342\335\341\340\026\313\335\327v\266\270\343\370B\206"
+	.ascii	"\fl\257Qk\201\320\250`w`\2317t\235\016t\214k\f\007\005=|h\360"
+	.ascii	"\026\242\343\210\200\243f"
+	.string	"\347f\004\t\005&\332\r\2126\215fw\346\231BE\202\277\367e\366\223yE\257a\301\364\366\276/\025w\232V\323\202;\256W\276\302\362~\366\312\215\305\366j,;\324\364\333C\302\364)\263\264\351\337\306\334Mr_\370\370\331\230\255\252(Lh\235#4\231f\2526\323<\205tV\"\235\245\220\316P\255\327\\\240\3014?\265\264\231\300\321y@\353,\240u\016ptv::7\025\235\001\260\316L\255\363R\353\234<:+\255\316I\2533R\353|\324:\033\255\316E\2533Q\353\214l\235\333\243\363\361\350l4:\027Wg\342\352\314\026\235W\242\263Jt~\326\331W\347\276\320\340\r\252\346\366\347\375\244o\330\364\320\313\267\252\tD]\335\203-z\n\357\206_P\247\356\301\022}\321\367\227\025\344\023\375\017r\036Ju\373\310w24~\373\254\231^!\347aU\241\363\016r9e\215\337{\355ol\205\356"
+	.ascii	"\231P0lL{|\343\177\335\235\234./4\344ednsM\033\023;\276\227\321"
+	.ascii	"S\2674\364\"\313)\273\\N\304m~t\035\002f\374\246\003\327-\350"
+	.ascii	"oM\354\350:\331\342k\335\351\351\362B/\017\342:A\260\375A\243"
+	.ascii	"\035\206\031\203;]!F\271\260\350_\264Wv/\377r\301\210\270acl"
+	.ascii	"\257\305o\274^\200W\306\017M\035\023\343\267\261\023\245~\005"
+	.ascii	"d\225\017\365`\314PR\336\214A\344L3\246O\325\"\361\245\312\374"
+	.ascii	"\235\022\277\335\020_"
+	.string	"\371>\310\360\020\373\235\247\007\231\204/\220\3756\316b\327\357.<\345Po\273IXf\367\314M\363~\256\337t\335jj\316\370\272\236k\3756&\002\276\325?\240G5\201\007c6,\201\357\272;\300./\3543P\342\300\250\r\232\300[\375\017\273\251J\310\245{z\023\354A\256\2225\227\t\223<\217k\327\t\373\257\376:\347\013\332\364);pf\327\315\205\363~\376' +\343k>\027\3733\263\206\016\214a\364\367\276\001,C\212\207\2262\306\r\031R8\260^d\325`q\245\245\274\202\341\324\202\205\273`\341X:h\264\330\261\316h\276\222\342\241\245\344\241\245\2641\243E\r\345\225\026\016\245\224\022g\335\300\322R\346\310\312\322R\266Rf?\033\2378\302\307\374&\017x\356>\357\262\205'C\204\037\220\204g\352\005|\204\357/A\252\027\360\025\362\374\234\313\226\033\376m\241z\367\203\253c\246u\200\237\372"
+	.string	"x>\300\267\036\317\202\305\351\373L\253syx\204K\337\326\313=,;\025\257\262\334\263\354\263\374\303\275\374\303\366\272\342M\271\b&\215t\323\273"
+	.ascii	"\344S\226\323\242\224\246\217r\023\204z\251SB\242I\035JW\036"
+	.ascii	".\034\274\243\376\206e\341I\0344\215\273y\3616w\356\r\355\232"
+	.ascii	"h\321\006t6^\016Z\026\362~2rM\022>\257\347*zqa\222\364m\205\r"
+	.ascii	"\340]\364\013\240\210\347l\ta \222Q\325?`1\252\237\222O\352\373"
+	.ascii	"\276\357\321\323W}\337\265z"
+	.string	"HO\214\033}\033\367\221/\242\t\337^\312\374 )|\001\246\022\016\215\261\244\244\237\201\n<\3237\261q\0362\223\277\364\304>J\237\374^\022:\332r\252\242-\356\314L\351[,l\b\353\230>-r$\235\364\023\374H#}\322\321#5h\243?z\247>\3077z\326lOL\200\336\250a4\003\021T\204hFD\222\244 i\f\260\002\221\241\032v\0208\305\210F\222$\035_\226\177\001\276\320\227\252\323\nH\371\034v\"\036}'\013[R\344\022\023\331\350\277Z\356\306$<\314\354\t}Ga\320\001(#F\2420w\016\230H\345D*\225-z;-!l\373G\346_P\206\257\237\307\230\262\002$\301\372'\346mP\301N3\312Q\342#Uv\232l\035\263'\364Jz\371\027\316\243T\tU!$!\236\353\320\343\242[\033!\357\355B@\314\300\311G\007\030\025\345s\344\2247\023\205\334j,\372"
+	.ascii	"\214\210\235n\321\222OG\367\202\235(\271<k\331+\360\207QH\323"
+	.ascii	"\2443t#\231u\301\220\353\370>\200Q\314\230\367S\374\332-}\226"
+	.ascii	"D\212_\355U\344\365\245\241}\302\210\216b\230\021d\224\264\322"
+	.ascii	"H'\366C\207#,\032\003\316)3\177\376\233\263\263SS\214\237\021"
+	.ascii	"\254LyS\232H$\242\223\302a\373\270]\320\360\356\304\035jzI\337"
+	.ascii	"\177\021\031\256\364\211\312\325\227\303?\304#\274.\261\366\230"
+	.ascii	"\222\003\016\277\021\"7\250\330]\247\201\023\201u.\217\330\002"
+	.ascii	"\212\252\324\360\240\374q*J\305\267\243j\r*g\217\220\007Pf\""
+	.ascii	"X\250\302]Hm\347\226\215\220\243\273vBV\305\307bEn\226F\250\241"
+	.ascii	"\230z\030\343\251-\206\023\341\347\230\037\250\240*\322\262\302"
+	.ascii	"$\243CWT\360\362\r\344\2777\342\245\031C\207\241\203 pj\332^"
+	.ascii	"\f\3540\020\344T\243\225\342\250\034\367\2448\253q\347\254l#"
+	.ascii	"\323\301\305Q\316n\b\312=\213Q\257\373c\024Z\367\024a\271\354"
+	.ascii	"^5d\275\327\243T"
+	.text
+	.section	.gnu.lto_rxIsReceivingSignal.93.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375 \336%\006"
+	.string	"\302K+3@o\222\016\2305\220r\254\013\211\032\321\\\213\375s\250\023\237\017\242$\342o7{@h\204\004\"v\2466\f\b\037f(\270\321\352;\347\352omo\231\002k2\233\3066\215=4,80M\213`\031\201)\b\206\306$(\2521\314\225E\321!\301\007)\276#%\251\356\307\023\234\253\325\351r.\235\016\0032>7\372\313s\270\361\225\022E\377}8\240\221\242\240\222\t\032\265$\312d\002\362\367\357<\346\003\204\316U\257\016P=.*JX2/\206\034\255z\325\255H\245\220\223\025+\344\351\001$d\346g\2050:\3667\370\013~\213\007"
+	.ascii	"2\003\316:#f\b\3055q_\b\022\356\262\251\235d"
+	.text
+	.section	.gnu.lto_rxAreFlightChannelsValid.94.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375 \336-\006"
+	.string	"\202\313*2Pm\222\016$\243\252B\266\315-u\267nK\256\364\274\246*{Kv\325\376\335\316\356\b@\205\032\317\0261\323\212\200\202\025\222\320\3526\330\260\255\355-Sg0\232\3064\215=4,8\260L\213`\030\201)\b\206\306$(\252\261\313\225\305\320!\201\007)\276!\025\251\256\307\023\233\253\325\351n,\235\016\0030<7\372\253s\250\361\225\022C\377}8 JQ(\311\374\214V\022e\"\371\3709\177\371"
+	.string	"\201s\325\213\343\323\216\214\212\021\225\314\213\341F\253^u\013RIdrb\201:=\200\204\314\374,\320E\307\376\006\177\301o\021\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_suspendRxPwmPpmSignal.95.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375 \270\355\004"
+	.string	"\322\b!*\200M\032\003h*D\200\240\340Em-z)\024E\203\342\021\021\203c\033\016m\020\0311)\002\307\336n\320\246p\241\331\275e\n[\0256%6%\304\261xHkJdE\370\2120\246\234\\\327\224\224\267\032;\003%V\336\323`\324\274\0026v\017\013\"\222\342\333\275|\247\035\005B\235_\251\263/\251\307Y\005e,\037\323\356\312\270\321La\266\252G\007\033\247)\024$vw\270q\030=\352\217\370\017\177#\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_resumeRxPwmPpmSignal.96.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375 \270\355\004"
+	.string	"\322\b!*\200M\032\003h*D\b\2022\354]b\335\345\022\030V\212GD\f\216m8\264Ad\314\214@\016{\273\241H\200\007\255\355-S_V6e6%\304\261x\310kJ\244E\030\2130\246\234`\330\224\325\267\032=\003%V\376\333`\324\274\0026z\017\013\231\222b\264{I\241\226\024\020u~\255\326\336\244\037g5\344\261\200N\273+\343F5\205\332\252\037\035p\335\246P\220\330\335!\327a\364\250?\342?\374\215\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_rxTimingHistogramAdd.99.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\027\004\225\034"
+	.string	"\226\265\266I\240\230Q:\300{\326\372)\177\"\354{\036\321\205=\016?L^\203\247Q\215\315\262\342BO+yRU\332\325\347\037%\324a;\367P\304\203\264\360\303\353p5+\\\353\212\277\2544F\330\360\340\266\205\2555B6!r\247\024\242"
+	.string	"\234"
+	.string	"\243"
+	.string	"\366\334\375\207\354@J\210\255J\203q\342\246\374X#~\332\347\361\036\262\373\370\371K\255:%Q\265\356\024\370@\371\321\273\023\240\037\313\017\240\037-\263\241|7\243\2226T\330xXj\255\256\225\341\362\342\356\246Sv\222\216\245\270S\346\223\021xW\335r@'ERh\210\t\200\234M|0%\212\321\177&&\315Q\364\261,z)&8R\262\342\277O\241\234M$\260\004\206\223\363n i\210\305\024W\271\025_"
+	.ascii	"9\232XSk\275\357\023\227\013\232\223\214Pk\365\274\345\210n\325"
+	.ascii	"m#\331\246`\213\006\002\002\356\343\177y\357n\035\310\037\340"
+	.ascii	"R7\213N\257\350\264\212N\227"
+	.string	"t\232\3744\035\247\307qZ\244\323;N\317q\372\005\034\350\216\\\330`\261\301]U1\334R\247F\251\033\357\375P\277\324\317t\321\276\375&\377'e`\rmWs\026\204S<&\224D\016\345G\231\365$\273\220\367|_\020\231\317\233\254\332A\204u!\376\323\020\003_\211\352O\004{(\244\324Z%\224>~\020\263|\356D\242\004\032*\237R\340 \224\037\347yf\331f\372y\255\r\251lOZH\251ug\363\321\r\002\017\246\324p\224\253\363\334\231\027-)\342\2336\247Y\334\016\207\177\321]\rKB?\t\206WY\303\377\241\037w\031\b\215\340\214f\373\262\002\366\\jJ\363NB\277sE`-\211f\277\347},\022B\331\272\314Drfm\270\324\254\304l\215\314\322\\\251\341X\315\326\372\275\035\030\375-f\037\365\nU^\320\026\310\277\337\016\336.\t\332\332\361\210\222\216\245&\264\251\305\364\006\322"
+	.string	"\333\332\373\216\240\211\267\024l\352\0224\207\366.h.\222\375\313\210\361\344\346\325\331\3444\r9=s\250[\206\234\216\2019\323\035\257\343d\230\033t>\340\344\360\320\036\035\0179\"4P\236\013:;\257\036\272\203\023\343"
+	.string	"\353\341yuP9g\301\210\230kD\314\005\342\205\263\343\312\211\361\270\026\f0,\204N\314\325\003\203\305\\\254\335\354\2533\206\337\324l\203\274\332\375_T\265\253\375\025\325\236\367\233&N8#r\221\2542\032av\244Q\332\234\2658\326\036\312\305Zk\2457g-\314\236H\030\254\035\225+3\3437*7'\267\334\005\326b\344~\334\227\245\373\232\322\221\\\334q_Kb\255\270\377\035\001\023\337R\320\251\313l\016w\235\204\262\024\031\027\311\177N\250q$\244\020R\210 \204fDf\304 9\006@\002b\220\203\346\001\021\360\275\024\n\n[X\326\023*\373\316f_\301\271\306):q\b\364\370\016\311j\007`)\305+<\312A\336\230\222\205A\261\b\233\370\346\b"
+	.ascii	"\032\002\207\200f\337A\325\031\333L\317\351I\300\334\201\031"
+	.ascii	"\265\244\033 0\031\210X&\331\026\344)@\333\030\272<\324\261\177"
+	.ascii	"<S\226\253g\371RXB\007\33156\273\216Q\332\370\2318Z\222Q\312"
+	.ascii	"\201~\031\205'\370\246\365*M3\357\031r{X \300\207\274\244\310"
+	.ascii	"5\233\370'MR\273\211\202\b\206\2369\321\337\270e\017\344\207"
+	.ascii	"\0347e\252\001"
+	.text
+	.section	.gnu.lto_rxRecordFrameTime.100.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\227\005\275!"
+	.string	"\326<\323H\220XRc\205\253\216\240\326\027_2\0377c\360\301\201\202Wnz\232u\340z\205\024C3\304{Q\352#\271+\270E\206\373h\301X3\200\001\361\006\210I \b\316\233\boP\034\265\324j(\250\316\321\366\336{K\231R\265"
+	.string	"\253"
+	.string	"\313"
+	.string	"wx\177\255D]]\271\367\270 \275IS_sf\371>|\343\362\027\232\274\t\322\255\367"
+	.string	"\361,\333\300\302\222 \374\035\327\022\361,/\230\302Q\264\272\367\336~\364\221\276a\205\370i:^\242\007)bV\311{\217\005n\032\227\336\264E\330\267\233\345\315\366\253}\253_-\3358\302\266{]\210y\335{4\340"
+	.string	"\351\315\237\337\2347\313\327\2347\275dW\371\361\351\242Q2\204Z\311{o\316\306\370\322O\263\264u\311G\031\330\206D\246\237/\304\0247Q\274$\201l\252V\206\030,\177\356\275\327\361Z\202\b\254\025ep\357u\035\022O\334\350m\357l\177\260\315\032\001\366\310\023\200\021\226CE\275\3672Y\353\344\242\3636\0032JS\335b[\367\257\242\364\336\213\300\037r\";\037\352\2469\360\352\207\274\363\346-n\312F\361\312\370\253k\366\021X\255\223\375\362\332\0276Z\rtV\373\234\325=\357\272y\216u\357\240\325:\347\272s\320j\234\263\372\346\306\337\346\254\246I\253g\322j\031\264:\006\255\206A\253oi\365KZm;\253S\264\032M\253\317\264\332L\253K\264\332\236\325\365\254\376"
+	.string	"\004PE\026QP\326\311\361\232X\343r\311L!4\336\365s\375X\267\366\355\007\261o^?\016d\351]\276\007\3002.3\b\267\342\373\331S\025\036{\257\2277\300\222\244\031\353\216}\326\247DH\357\375}hK\270\224\t\006\236\334\214\342\240\n\365C\303\024I##a\231\254cwj\264r\254\216U\200$\230D\255\2659\326\247,(uZ\324^\250\346\304\22769\355}\274\034\003C\222f4M\313\304\307\363\264\344C\263\2375\355\211H\351\022\252\275\364\235\245\355!\241X8\231OIi\253\246\310\212W\306\002\307\261\326\272\006\263\330\265\265\373\353\004\2628\366=^VA%\247\264\3608\003\3265\003Y\337\310\217\\\300 $t\336\f\206\001\235p\231\335X \013"
+	.ascii	"M\250V\255\215\275\261\327\272\200\0314L\204\361\220\002^\354"
+	.ascii	"c#|(\017\021\021\0056\302!\031%\r\361tl\204\323\361vI\271\016"
+	.ascii	"G<\336\021Q\316\220PU\022\252HA=]R\322nC\212\024\244\343\355"
+	.ascii	"(\350xC=\r7\023\341\224z9\245^\256\303n\210\227#\352!\345p5>"
+	.ascii	"\362\240\353\345\222\216\216z\271\333\361\3671\251\264+?\013"
+	.ascii	"\364\337\340te\252\277\006\016\036\374\301y\023\245*\303qfc\327"
+	.ascii	"L*&i,hl\227\242\033.\247\261\327\361r\313\224\255`\021x\316\330"
+	.ascii	"\264\244\214}\2613\366\301b\214\225\261&\232P\215\006\306\306"
+	.ascii	"X\036\264`\325\315Z\013c\001\240\005\245^\354\315\352PA\363\245"
+	.ascii	"g/\366@\262\330\302h\263f>\034,>\326v'd\331V\217M\255\217}0\013"
+	.ascii	"\217M\353\2122\241\332\216\355\261\017\362S\005l\25010\351\024"
+	.ascii	"BH\321\214H\220&\245i\fp\002\221\251,\036\021\340\2453E2\022"
+	.ascii	"U\326\375\177\262\334\222\375|\314O`\316\306\325\370U\233>\260"
+	.ascii	"q\324TX\204\\\243mxJX\312\204E\335\326\033\337\016\266<L*`\256"
+	.ascii	"j/\322\210\027\237\035m\314\206\216\nj\215\350\273\331L\242\216"
+	.ascii	"\001\025\254\363\342\002\254\t\344\2465\300(^\341\231$\361u\303"
+	.ascii	"\007QM\310k\036\r\376\242\325\026\034\002W\373 \234\332\020\212"
+	.ascii	"\253\352FI\312\272\2124c|\307\236N\032\216\177\345K\220nQ/\364"
+	.ascii	"G\364\212o\317\274\202\322\236zZ\342S\220\210\177\337G\332\210"
+	.ascii	"0:\361K\006%\316\321\005\022\303\253r.z\272\230*\243\346\232"
+	.ascii	"s\365\026\233\215\211\315*\317q\350\3327\005\260>El\366\205K"
+	.ascii	"\217\213\002\330\214C\360\311\227n[\302\037"
+	.text
+	.section	.gnu.lto_rxUpdateCheck.101.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`h\b\335-"
+	.string	"\212N8\021F`\\N:\375\253\021|\022\362\rD{\2677qmhS1}\347\205\366G\242\t\374%\271\305\r]\177\201\255\222\302\272\311\227+lJ\360\0258\224\206w\033\rl\345\263\237\377c\344\216tk\352n\215\020\"w\222\001\005\001\347"
+	.string	"\374"
+	.string	"GX\317\373\345\200\r\225\246\322S\236"
+	.string	"\354'\f7t\367^\005\314"
+	.string	"\370\224\255e~\363N\031_\213\301\301{\2014\351\356}*`$\340\323\243\003\251O\321\033\325\247\314\314\016\036\310`\345\237C\276\216v\205k\n\337\275\317\2456\273\362BAG\240"
+	.string	"\306\037\237\036"
+	.string	"E\342p\025\006\201?5E\333*\371?\246t\354N]W\030\326\205\236\245\366 5\364\350x$\315\002\241="
+	.string	":\204\206\026\260\013\242wf\215F\376c\244\210\3659{\017\221\266!\026@\217\027{,-\321\362\370\360\307\004\344\006\331\327\035\027\216\355\260A4i\031\006\307\357\300\310P \273 z\227;\001%`:,\220"
+	.ascii	"\220\033b\377\t\303r\\E\215:\342\360\212a\\h\002\274%ckX\r\233"
+	.ascii	"\212\255a4,\252\004L,\356\326F\330\226\355;0\036\350\321\275"
+	.ascii	"\367Vn\275\302\264\254\3751\335{\331v\205\3358\0138\363\2250"
+	.ascii	"\263\025\363\357A\326\016\377-\324\241>6[.1-\333\307F\373\270"
+	.ascii	"wA\336-\315\275Y\357\342\322C\375\035>\266\032\213\231E\\\313"
+	.ascii	"\b\340\275\027\002\037\313\263\224\340\237=e'\244}\027R}\372"
+	.ascii	"\326s\202g\351\\\313\262}\314O\255\243\267\231\314Go\2271\257"
+	.ascii	"\226\225\202\226\223V\313\b\210\226\017\260e\003\3262\322\327"
+	.ascii	"~\243\241\345\242\241e\242\303\235\207\206\226\203\206\226\217"
+	.ascii	"\253\345\242\265L\034\262\345\225-\013\203\226\203g;\003\203"
+	.ascii	"\226\177B\313j\320r\032\264\214\262\345\006Z\276\202\bo\226d"
+	.ascii	"hr\215\346y\277\372\360\\2)\226\264\303\375l\347S9\235\325\347"
+	.ascii	"X@\332\233W\271\0343\325\257pQ\323\314\343\230\327K\341[\201"
+	.ascii	"kA\302\r\037\007 \025\263\025\177\312\335\230W~q)|\345l.\233"
+	.ascii	"/\230\327\247\226Y\006\277\215W>\2332B\245_\356?\301_\337y\213"
+	.ascii	"\212\240\275\230\013X\004\315\247S:Q>9\335\231\266\032km&+\261"
+	.ascii	"\275y\021v\231\017\\\037V\027\032_H\202\315d\333\257\273\375"
+	.ascii	"\375J\365q\337\360\345\3055\207\276\356\300\366J\257\204\242"
+	.ascii	"\036h\023mj\336\346n\224P\370g\254t*\243(\243\250O\017\364\345"
+	.ascii	"n\317\322\364\226N\261,`39\035K\215\272\001\030\025\251\211\355"
+	.ascii	"\305<\300\022\233\231\202\005\373.nB\177D\366W\276\006y\274<"
+	.ascii	"\265\221ZU3\250j_\b3\206\243\311\200\2476\321\354\355\311Z\332"
+	.ascii	"f6hhB\317\0305\332i\277\306R\353v\277\333\320\241\251\251\211"
+	.ascii	"onu\304\370y\357M\233I\324\024\324lY;\377\275\367\242J\325(\347"
+	.ascii	"\316NN\031 Q7?\314\305(\371g\f\"D\210)]q\376\345A\335\375\270"
+	.ascii	"_\020\343\233\343"
+	.string	"\322b\203\354\275\027\253_\244\036\311\232A\332\362\266\002\254bA\022\352\251j)J\n\nJ\n)\200\312\252\312\251\252)\t\3454\205b=\221t\361\224D&=\254p\212J\361DUt\252Z\221\254\320C\005\"\t\365\364\241**95e\205$2r\301\325\324\322\325\324R\324\223\023\324\022r\212ji\201\221\245X$\247\226\252\244\244\246\226\326g\326\273\214\355Q\3516(\301\213\006\372(\253\265\270\330\006\372\252P3\371\357\240.[\233B\215\265\203\366(l\333\244-oK\330DN= 86\313H\320,\214\332^\347\240\361\225$@3\031\206\252t\\\263\306NN\2311I\255\324Bs\270\362\004\333\250\223\372nG\231\234y\343\344\315\r\211\326\363\274/\006\2322-M}\032\354+g\323X\207\207\213\332\336O3\215\372\3273\332\304\330\371\265\004\347\331\322)\346\303\227\344g\266E\255\247\231C\237\266\274\037"
+	.string	"\232\t\347t\224KB|i\356-\233{Et\b\354\267\375\002\332\027\2569\373\272\017\333\253\250o\345>e\320\240E\304f\016\003\200\263\250\2018&\rchD\202HA\n\222\244\003`\002\221\251\263z\020H\306\204H\222tDbZ\314\346\221\277.9H;\367!\275\352\002\204\266\310&\333\032\273\200\377\001\021\327\330s\320\334\363\byS\370\354Wy\216\256\251K\315A\300{\223"
+	.string	"Y\005\255Q\240\222@\303\022\212\030\251{I\364\361I\216e4v\316\031<l@\311\254uP\206\313^\345:W3\271\240\372\317\002\310$\2225\300o\364l\233\002\311).\017\210\201|\b\036"
+	.string	"7\262N\220lA?\261u5\351\030\360&\337\330\272\330\355\354\274\215\024\002\032+\024\216n5\022={\024\225\016@5Z\rg\246\366\203\n\343?X\224\324$\213-\b\203\203\b7"
+	.string	"\302[\236\220D\b{\202\203\304#\252\221\240K\\\214_\320\313"
+	.string	"\244\300\341\336H\262\203y\023\274\310E92\360\351\211\0363\022\267\347\2543C\300\020\027\320\362\317\302\215\321\2239\324n\275\025y\034\034Q\007\212:\027\316\005\325\321\230\334\277}\356\004\336\003Y\034\322\242Y\t\303!\201`\361\362^]NC\226)\b\216\005\265*%\006\341U\313\244\233\325\354+\262g\001\336h\200\036\254\222\026C\332\267a\246\031l\360&\343\314h@*&\272"
+	.string	"\220\202\005\335\331A\006\363\335m\357\244\252\""
+	.ascii	"\032\217\372\003"
+	.text
+	.section	.gnu.lto_getRxfailValue.102.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\227\003\355\027"
+	.string	"\246\353\226F\300\030Q:11\274\256/\006\021e\311\213\020\220\302t\367R\304\020I\023\310\300I)\376\341htD\263\301~\375\34000\351h|S\216p\031\202H\271\336x\223\367gi\327\301\342\216\241\036\333>!\233\020\271S\n\200"
+	.string	"|"
+	.string	"\207"
+	.string	"K \322\217U|\347\225\230^\221\335M\335\306\261S\266U\332\016\036\340|Hf\335\325e\241\262\273c\340\004\342A\333\376\221\013\341x&w>d\240~\316\350\0245\355\356X"
+	.string	".`\036\224\0170\017j\217\317.\206\023\374T\316|\332\305!AA\302\"A?\346k\271\203'\372\251)\350\005\031\0353r\377Z\344\250\216m\n\360Q\002\202\342\271\251\fmv\327\022\3073\343>\335\266\r\333\022l%\022K\273\216'q\273\273\333\005\251\236\034\331\263\355z\321\213\002Q\223Nh7\007\302\221\330,\276$\304\351g\307\307\026\241\335\215\220\344JF\370A\016\232\204\ty\334A\037\246\247\036\243\221\241\224^Ot\020\315(F\247W\223\243\275\263I\345a_\307q,c\335a[ze\351\032K\253>\364\247,\215\232\322\247)-\202\322a(=\247\264\202\322R\245\017"
+	.ascii	"\004\0270\263/\273;#\232\r\0300\314\203S;\344\222\314 \031\375"
+	.ascii	"a\230\304\3001\007H;\203\006y\234\252*\315\267\362\0371\335X"
+	.ascii	"\0027\\\013\007\321\307\362,\036>\264\344q\255y\260\346C\223"
+	.ascii	"3\372\224\333\206&\323D \023\346\350K\362\225\3642\030T^\345"
+	.ascii	"H\3469\310-i\222"
+	.string	"\311\346A]J?\331\363\217\216\240\267D\223i\356\243\344\223\244P\374(\362\357\331  @\333\323\304wb\236\370\003\363\240%nwF\240\335]p&\266y\005\246\3446\026Q\342us\323\022\341\n\355j\260\"\306Z\021c\335\214h\231`\271b(X\r\002\030v\342\025c\245\200\301b\254\324\256\366ou\207\t\334h\350\346\252\206\021\r)\241J\375\201\252'\372s\334x\244|5\212R\027\266Qj\233\232\332\276\335]\021\344}6O\252\322\337t\006>\233\242\236\3647!69:TQ\345\230\tgz\251x\212\200\300,\205z\244\334\025#CO\256\200\tK8u\245\327\351\331K\005\321\347\362.\026.\004D\250Q4\302\224d\206( \021\t\n\244Dcp\002\021\"\273\033\020H\210j\222\0242\034x;9V\227\247\347\300\354p\021\233\242\312\352\230ZS\"\214\020\314U(A\250\257\2244\233\354m\330"
+	.string	"\306\tj\264\377S\222QL\331\004\360J\221{\377j\377\373\264[\307\356[\305LOr\f\016B\346\350\204\244D\266"
+	.string	"-\204=\r\2670\235 \306\327\275G^\270\243\252\227\026\rF\256o\375\037'\261\221\246\302\310"
+	.ascii	"E\016\252\314t\032\030\376(\224\342\207\301\016\312xIT\343\214"
+	.ascii	"[<\331:\026\250"
+	.text
+	.section	.gnu.lto_applyRxChannelRangeConfiguraton.103.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\302\001\005\021"
+	.string	"VatF\340\360&\035\332JT`u4\037+\260z\301\246$&-bl0\374\302\016\210\240\211\013\250\222\3147_\327\236e\344\253\310\265\341\216\340,\3070\303<\342\246\021\216\027:\370\347dJ_nN\217\\XK\366\2262\245a"
+	.string	"W"
+	.string	"`"
+	.string	"='\361\372\347#{\354n\220Q\264\273%.pz\034\201\266}\236\217x\031\226`B,f \304N\215-\307\356\347\205<"
+	.ascii	"\367\230\027\341\036\225\303a\207\2320\177\346\320$\243\240\302"
+	.ascii	"\206\206s\205\004r2(\245h28\262\002\251\346\266\347\rm\226i:"
+	.ascii	"\331]\247\r\315\302\035o\333\201\355\007v\036\b\273k\315q\312"
+	.ascii	"\351\217L\243\376\335\335\177~\217\177\277\311\351\230i\030\323"
+	.ascii	"\232\351\214\351\203\240D\304\240\375\006\305n"
+	.string	"\205\233\216E\212F l\337\017\272\020\314\201\334\240\326bgw;\030\273\373\313\356lk\211\373\274\376## dg><E\273_\211\025\234\036\375\2352\355\0078\200j\310\362fT\202\024\231^\334G\\*T\223\332+\021\3626\235\302\255\351\214U\341\352&T\021t\350\271\246\336F\315\016\263N$\341\264;c\340\017\261\270N\273{\017\217\276\f\367x}\212\032\013\245\236X\336\276\244\341&\244\252\343\0057\351m'\231\261\321\360\2011\313%\373\223\245\352\330\207\033V1q\251\274\250V^\013k\265b\241\fH\201\320\242j\305\024\026\227\225\312\305\031\305$\246\345\305\264\274\226\025\325\312Ci\271<\023\021\263\\RZ\336\013\213\325\362\272/v\270\232\343\024\r\206\017\307\241\271p\"}\030\027\365\306vT\237\304T\006Q\372\001wj.dIA;\342\214\224\242\324Is\003\300P\247)\275\320I\214\222\210\002\036"
+	.string	"&jeb\343\225M\330\243\216\276\333\336\252\365\270\332\362>,\256\271|\347b=\267\231\262\034\210\007T\251_\202\243\251+Eu\214[\267\013\353\2611\026\203ZB\303t\323\030\017\330"
+	.ascii	"M\330\024:h\027\220\022p\252\032y.\005\005"
+	.text
+	.section	.gnu.lto_readRxChannelsApplyRanges.104.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\330\003\345\033"
+	.string	"f4\265H\260XQ:\360U\023b\204\216\203\332\312\221\340czt\354\247A~;\214;(x\005zR\320oi/\336\335\352\331c\222[\363H*\325\006\376XPV\030\020~%\316\021\313\3342\260\242\356v\203\217\032!do)\223\f\240"
+	.string	"\227"
+	.string	"\245"
+	.string	"\274\205z\305\325\3070\223\344\244\252\326\272\340t\021\214\2479\207\205\247\363\257\360t\367\305.\353\364\254%w\277\024\260\325\240\007INC>3\265\326X\377\330Q\300'\357\273b\3626\253Q\f\351l&\367J\237<\212\300\224\267\240\333L\321f\004\344S3nL\0354UO\357\325x%N\360\201\263\361\361\300\016\234\356\342TP\005\205\314\247f\350&\314\bH9\304a\356\324\346\226\373l\335l3\347w&\272\tq\277w\017IN\302\354\300\3318\213\023j\255\313\345\r\367e}w\231v\327\302n3\005\213\242\207_\236\356{\302\323V\257\236h\034\374\026/H\200\263w+~\241B\261\377{\2020?\252$QB\214\246\233\244\330n\335\273]^\215u\216\320Tm\367\330\205\275F^\034\227\310\333\022yoD\336\325}\337\361\274\2578y\303\220\227R\3369y{\362r\363~"
+	.string	""
+	.ascii	"%\244\333e\224\251\325(\230\246f\241OA\356\373y\347\335\357\215"
+	.ascii	"\034\370\342M+B7fH\255\225\205d\377Kr&\362>\027\257e}\320Q\322"
+	.ascii	"\225\252Zy\n\306S\027\277\310\276\367#_\"\037\233A\003\277|\271"
+	.ascii	"\272\347\025\335\230\032U\323\201\257\262\241\245^\036"
+	.string	"H\205\303d:\252\265\352H\371\224\016\037@\200\bOq\372\300\3172Z\3228\325P\222\313\005!CC\354\3352\275i\002?\034:f\253WM\324\340bw\357\027|1\367\233\016%\213\300\245V\332\313(\355\352\034[\007\355\252\271;jh\315\206\370\323\210\261\326\na\377\344PH\354\310\370\245,<}_\210\356\013\221#4\016\316\260w}\323\254fh\r\215\203L{\267@o\242\342>.\265\n\351\354\362\334\251\204\204\243Z\205 ,9\223\023{\244\323k\202'\005P\317\316\2120\005\217\217\317\216\t\231\2702\007-f\261\026\263\230\317\211\235\236\230l\266\"\346\340\265?@<\263\030\213\237\237Y\214\305\243\275{(\3751\266X\311B\353\232M\3576\200\222\021\326\335\205\027\\l\242\r\273\002\026\332a\377Z>E*\355\221\2264B.\361Kr)<\2454\247\243:\243\243q\360\313\253}\326Z\353\252wK"
+	.ascii	"F\216\"\361\325\377\3759~8\232\204\256\036\031\\lX\277w\0225"
+	.ascii	"\031A\030:j\034\334\331+E!\300>\352X*\\\300\200\241\0243\366"
+	.ascii	"\354V\255Hj4\3008\335\275\001G\2501\034\2061g\fBD&\220\300\206"
+	.ascii	"J\222\016P\0021\212\331y\020`\251\030hg\f7\372\021\360C\213\223"
+	.ascii	"I\033@\301\262\373W\275^\230\027>\2124=\367\267 \355\301.\314"
+	.ascii	"Q@\230\207me\306\275\230\201\337\2228\270\337\022\304\276\006"
+	.ascii	"s\037\317<\246V-\n\200D\245;\370T?\271Z4!\\6\266K\017\247\261"
+	.ascii	"\004>\307\0353i(!b}\333@\030 \252\344\210Pw\020\271R\274M%\256"
+	.ascii	"\003\207\253\247\256\0310\002\253\227b\211\203\021\f\322kzT\236"
+	.ascii	"\336\215,?k\201\322\261wJ\303/\246\034\250"
+	.text
+	.section	.gnu.lto_detectAndApplySignalLossBehaviour.105.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\024\013\005;"
+	.string	"\332b\030\026C@bR\007\327\312?#\337\027\302\335G\204\276\375c\272f\314L\013:\b\204A+\303\251\271\351\266\221\f\344\331\013\r\250]"
+	.string	"\220\006\242_\364O\016dfS\340\314\b\265\207D\021\nZ#{\357\235dJ\001Q\0018\001Y\001\256\263\265[\333\032\r\001.\266\330\371Z\241p\324\bAo\273{t\023\275}_k\242S\275\n\273\232\017\217\237\261\003\261r\345\217/\216\331\234\274m\003Ao\t\370\321\365\226u\243\353-\334\215'\331\025/\241\256\344\361\002\343\027\307\261\362\237"
+	.string	"\350#g\331\274\217\017;\223\200"
+	.string	""
+	.string	"\226\224\222I\310#\222\361\310\250\210\2508$D\034\n\203\257\333\262\237\341\366W\212\035\003\013d:\227\316\244\346\002\324\2529"
+	.string	"\365\312%\003p\362\354\342K\257\324\325\017\200\221\241\246\211=\273\270\222;\246\204\217\352I\266\001_\031?\216\245\231\306\036\213Pa\272]\023-'\245U\311H\366\355*B\305\355\232TX\n\200\370\346\334\232$\037\235<\2478\222\321\314\217\\+\212\033\231A\311E\303\261(\031)N\364J\211=\243x\221m\262k\226\261Kpay\bKS\232\205\344\3002\321\256\271\204%"
+	.string	"\247$\017_)\253\267cP8\352\237\330s\212\013\013\210=\243\036t\273f\264"
+	.ascii	"\226&4\277_\356\262\r\244tG\212N/\366\030g\314\316\217\334\""
+	.ascii	"q\226\350\344\352\312_tr\261\004\3428\3665\317A\234[9\277Rq\034"
+	.ascii	"wf:\237\336\003\274;\233\350n\025\335\302\025\001\337>\323]\221"
+	.ascii	"<^\200F#]~\356O;\263N\016\345\026\246\366\016\\\351\2034p\025"
+	.ascii	".\3730\254zk\234\215\212\025,X|\n(\340\237\333\376\224e\237\354"
+	.ascii	"\214\3474-\362G\231y\200#U\264\377ig\271\376\357\304\272\307"
+	.ascii	"\225\001u\373\234\233\311j\227\322.\246\2623\247\\o\375\205\313"
+	.ascii	"7;\322*T+\007\366P\356\2161#;\263\351\023\374\bk\376\361m\375"
+	.ascii	"\262\233m+\377\264\333)\224\001\342\353'\353\026\346\306\020"
+	.ascii	"\314}a\230\333B\205\250an\250'\t\302\334\n\204\271\023\270\232"
+	.ascii	"w\2230\267\222\217\361N\372\233w\222\267y#\337\334G77\2220\267"
+	.ascii	"\321\315}\364\3466\032\346.js\023\265\271\213\302\334Cnn\241"
+	.ascii	"771\230{\030\314-|s\007\337\334o\233\333}s\267nn\266\315\235"
+	.ascii	"\333\334\236A)\317z\367\345\212\337\347\261\305E\002\005\305"
+	.ascii	"u\355\\\025\037\343\376\346\336\346\256\346l\267_\2338\264\202"
+	.ascii	"\221\211s\271\034\036\246\375L\324\r-G\273\027\027\323M\354\036"
+	.ascii	"\036\246[g\234\034)\365K;\034\030w\203\375m\207\307\314\330\227"
+	.ascii	"egL\nAo\213\262\033\003yo\200\231,\211\022\252\361\247\203\\"
+	.ascii	"K\364\212\326\327\347\212&\313\321O\215\220\337z\211\373cu\303"
+	.ascii	" +\370n\270\n|%;3\312H\006/\255\216\353\227\215|\005\337\271"
+	.ascii	"N\030\224\275\242\005B\360\250\322\370\305\334\307\250zg\210"
+	.ascii	"\204\017\b\316\202\240\354\257E\303\334\223\2458\234\305mz\341"
+	.ascii	"3Y\241\201?\244[9\260\213\360\231\213!\227\t\301k\302\347\216"
+	.ascii	"\356\302c\370\267\317\360\233\376\302\273\030g\317\234x\327?"
+	.ascii	"nV\266\372\300Y\202|\274\017\336\002\247\301]\340.\256\267\303"
+	.ascii	"&g\234\034\226\b\335\221\265\241\237\266\205\177\372\252\257"
+	.ascii	"1\253\233\252\353\341\263\360D\255\276?\265\326\323'\016\231"
+	.ascii	"\320O\033\352\237\376\265X\341"
+	.string	"\270\\\303k\216GC0\216\271\242\332\355\370\235\r\034:tp\275\205z\227\363|\375b\"\255\252\371]\23568\242\223+}\013!wK>w{\301\177\372\214\206\204\357\215\b\322q=\017\037@\200p\275\r\276\3039\203e\\\231\264:\367oj\272\234\303\237z\226;G\004\216\350\027\264>\255\034(|\037\370\235\235\373\357\273\027\240V\016\254s\037\203\0364\370\323\3666\316\376;\337\002Y\365\336v\340oFD\321\211\343\230B;\235\273)\321.\305\333>\201\002\005s\217\007-\003\202\r\0323nd)\255\256\252\252\256\246\226\250h\324\250ra\303\245Aee\345B\306\324k\003\004U\325\f\0237\254\250\260\260\262\246\206z\n\202\016,\245\016,\245\325\f\027U\312),\033J\b\306\276\252A\205\245\274qu\205\245$\262i\371\223u0/\254N\353\267\230\216\017\315_\257\033\b\031\311\210\340\221\343\273\233\331\234"
+	.string	"\244\374D\3725\321\274\264"
+	.ascii	"?m\t\314%\t\337BQr\362d\362\215Gol\036\275\202\217\322\366\306"
+	.ascii	"\006@\362%\374\213-05F!2\221<\344\3570\367\024\275\021\203\234"
+	.ascii	"\240\350\375\352F\277\274\257\344'xAkL\257\245\250\220[Z\363"
+	.ascii	"\217\317\361\034\210\216\250\034\264>\345VuNiB\356\206\227\300"
+	.ascii	"a\331\231\355px"
+	.string	"\203\352\204\323\2524I\364\016h\335Sf\327\3411\267\033\236\302O\2623\211\336\277\230p\3752\351\247\305\177\221\271\212\357k~\300)\327'\255\"\177\332Db\220*\374\357\t\235\034\371A\220?\364\033\336\b\375\320{\326R\001\233\261\020\372&=(\033\307q|\374)\362+\274[\275\365\213~\261\346\271e\244\237\266\3239\003\363\272\032E\275\227\2351\275\256\305\247O\372 \335\304\317\361\210#\235@\017Q@$=\361yD\351\254\001\200\350\250q(%\231S\204FDD4IRh\f\200\002\021)\262\342\006\021`\251T\020\221(\031\306NM*/\273\237\030\311,\204\310\333h\365\036\316%M\264\2142\th\351\212\375\253\006\236\311\323\365\272p\357@\212i\363\313\343r\"\351*M\n\361\235\201\3238n\206\314\316b\0204\327\b\265p\212\202\251!\356H(\rh\311-\257\220\303\231\274V~\025\266\027\265\331\033"
+	.ascii	"N\301g\235`6\2130\013\230\340]<6C\360,\177#\003\337\242\321'"
+	.ascii	"A\344)\2430\316Ud~.3\223\260\332\216Y\262!\330\232:\254E\303"
+	.ascii	"\335\210\r\255\337\356\317\315\032\372&\021\035\034\236\300\315"
+	.ascii	"\350\355\013\345z\200\337\314\207!\334\301\216\356\350!\200\202"
+	.ascii	"s\217\022\227\226p\307\206\\I\2024\271@\346H#\300\002E\362\177"
+	.ascii	"\210h\n\232\206\n\nPy\211?\234\332\002\272\333)\025xf\022\013"
+	.ascii	"\033\211\311\225R\204e\027xz\232&P\215\327\n$!X\226\235\337X"
+	.ascii	"\224\232\373bO\214e\343.?\303\022\030&\327\377@\213\312[\376"
+	.ascii	"i\343\273\227\201\214\271\341\331ec\374 \223\362\244\342k\r\376"
+	.ascii	"\347\341\031\230:\217\264\211\026\362\2033\207s\233\024P4\215"
+	.ascii	"\374\036\244\021\212\377\027\307vC\370\350j\225|\332Y\341\232"
+	.ascii	"\217\035\362a\027\3617\307\221]\303$\216\002J\200\305pI\356\321"
+	.ascii	"\b0\225Q\255\326\343\253$\312o.h\367j\202\\\002\375\031\200\226"
+	.ascii	"\321\211\262|\t\322h\206\311\351\016\035\350\3447\257\254l;K"
+	.ascii	"\255\245\007\352\003\364\242\200F\307\326\375\2130\030H\302V"
+	.ascii	"\260\350\021\272n\023G\216@P\347\177\265\364\245\304<^y\337\201"
+	.ascii	"\023\225\030\257\372\246l9\360\256t\030[\334n;\360\037"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.106.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\233\001\245\017"
+	.string	"\326]hE\360\262&\035\240\242\373\177lsA\236\364k\354\211\321\021\236\267n@\312h\310\330Xp\360\264wB\370Y\333\326DG\376(5\243\345\304P<\034\321\260\370\235Tf\2317\323\2410\323ey7\324\306\275\267\224)\005U"
+	.string	"P"
+	.string	"T"
+	.string	"'\211\207\357#\361\320\266O\016\250\274:\367!&"
+	.string	"'\306KO\217].S\017_=\302\247\271\362\001l\254\307\220\205\303W\240F\206\314h\233\360H\2008\004\305l\024\362\311\\I\333\353\225\354\356w\2360\233+3\004ew\235\260\255\302\035r\333&\333\231} \001\3379\201\355'\250&g\246\225\235\315\271Rm\354k\327u\235\265\203}\235\237\344\264\310\351\3504t\3729\255\232\276\210\003\021\261\230\355\030`\354\306\272 K\003\276"
+	.ascii	"a[e\217lg\332'\361\034\325u$X\264\273\341F\213]\316\200\007\204"
+	.ascii	"\016K\002>f\364=U\361p\300v\250>\375\212\227\013\243<\367\024"
+	.ascii	"\251\320n\3530\024\251\252\017\241\341\245,\333\017\356s\n\355"
+	.ascii	".\002\277\347'P\376\315\241#\244R\3610\3653hr\214\320\271z\025"
+	.ascii	"\257\fxl\274\362\207\375\0227\261\362o\314\322\222\207\035\372"
+	.ascii	"-\361\360\032)\005\246SJ\202\025\025\223\246\261\224\002\270"
+	.ascii	"d\342\242e.Z\246\222\262\340\224\225\264Tf2b\024\004\223\226"
+	.ascii	"\255\240PZ6\342Z\177\373 \f\005\301\251\341\303\342\235\347\""
+	.ascii	"\205\261-R\243\264\324\365vw\243H\222\324.\231\3620\250OY\351"
+	.ascii	"\202\007P\006\2506<\217?\r\242\236\320\350\b\" \260\002\241\200"
+	.ascii	"\354<\340\b\r\222\bk\033#\220h\270\202c[\023\013\356\230\347"
+	.ascii	"\004\307\3452\310\330\304\020\242\322a\026\023\005\347o\034I"
+	.ascii	"{[\214-\235\020d\232dq\310\301\312`a\313kt\031x\2329\342\363"
+	.ascii	"\325\013g=\350\2225\266k\225\001"
+	.text
+	.section	.gnu.lto_parseRcChannels.107.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\303\002\005\026"
+	.string	"\346\350\217K\260\022R:\303\333\370\267\332?\b\2164E\327\205g\354VF\325\317\374A\006\265z^)\201\371\204\211\270 \204\276jeT\274\022\374\033\331W\326]zwp\360\356\230S\277d\033\305\r\263{\370z\350A\345H\2154\262\211\334I\006|"
+	.string	"s"
+	.string	"~"
+	.string	"\375k\260\t\312\327\375\275"
+	.string	"\371Z>\204|\335\332\256\324\177\2746\020\244S3\344\243\273],bW\264\366rE\326\221im/\364q\247\327Cw\316\274\034W\270\233\021w\332\360a<!N)=x\243+"
+	.string	"%pNzx\035\351n\363\304\321q\f\001q\364\324:s#\311\223\211\234\013OmN\032\312\017\276\356\364\204\272\023\347t\025\241\273\227\352N\016_\326wWgw\037\354\322\034\001K\270\223y\267\373\233\241'<\242\3242\317n\353\277\037\344D_\363\276\237u\340\227$\351\326Jw\034\351\362H\2272\335\013\b\340st\276\247\330}S\244\352\246\252D\342D?p\367C{\341\232D@A=\016\312\263\330\007\327|\335]\240\314\200v\352\237(\202xS\335?\006\257kR\276\336\334]\372\213\211Zp\272{\025_Q\273O\346\004\272y\214\222:P?1\344\353u;(\217L2\325T\331.#V\306`\346\037,&\231\362\001\034\275\033\271\0237Z\334\207\360\245"
+	.string	"\252\274+:\214\030\t\322\223D\2406\212|59\003\320\006\r%\236\372\250x\350\030y\267\227!Mf\241\031>\300!\r%.\b=\277\350G1\005\274\356\334u{\243\267\200\215\377y]\0131\362\272\030)\273@\2573y\004\3073[\371|\341%\354\364\220j\252l\264\310\302/\177\275\002\214\245E\206B\233\2250\030\\Z`u_%\264\231\2136s\265\300Tb\256\327\354\305U\022\2622\227\225\231\013F&\233\271\314_\237y\204~\rC\246&\033\337\246J\336-kH\266\270\016\251M\nY\031e\377b\226RV\036]\330\344\330h\361cw\367\312\344$\267\370\301O"
+	.ascii	"\366\2049\240\033-\322\016\344\310\273K{\r\n\bx\335}\262\253"
+	.ascii	"\362\245W\331\335\020^\3674XVD\0026 p\002\231\"4\017\341\300"
+	.ascii	"\357;\332\006\202:ze\002\013w\236\312\016\232w\367*K\212\260"
+	.ascii	"\003\265I\377\221)1\321\205\231:\354\360X\252\270\3239h\263\304"
+	.ascii	"8\353 p\244CC\306v\241\301\013\026g\212\035\306\0035\234\330"
+	.ascii	"btY\016(\tw\233>\340\\\346p!3b\362\200B\330\205\3042\r\213\373"
+	.ascii	"X\255+37\300(\335\275q\327S\f&\\\360}\b\227/g/\2333\265\346\t"
+	.text
+	.section	.gnu.lto_setRssiDirect.108.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\035\013"
+	.string	"&ULA \307*\035pN\020\271x\202S'"
+	.string	"m\007\240\025nK\300bx\270 \223~\240\2125\300\205\016\200\326\2605,\244\t\022=\306s"
+	.string	"L\004\270a@\b\016\352\337H\005.Y\376\202,\331{\357\224\0028"
+	.string	";"
+	.string	"6"
+	.string	"\032\356\325\241\255\340\243\3116\244\250p\324\026\354n7K\036\236N\031\372\b\342\351\024\344SAL\321\315\356\236v\331!\252\244\274tv\327r%~\334\365\266)lG\330\237\b\322\277$\274\022\210?\021\260\353qk\260\006\352\200\227\355gl\317\361,\341g%\037\354\222 x\300\274n\250\224\366W\036\013/3\271\356\216\304l\273#\204\0350\257\013g\340^\345\003{\232\323e:?/h\007T\222\201\375\332[J>\212\301\221\374\352\325\037q\257\237\247\235\332X\004`!(y\263\307\223\234.\373tw\327\263e_\366\327\317~J\003\037\3177\362@\016\004\202\025\033\237\320\305\036\016\351\353H_\027\002Y`t\236\017\3548\032{\031\237\257\323\360\274\257\313\214{\272\263ewP3E\353\364\001<\200\311\023\211\270W\tV\001\230\210\334\r\023"
+	.ascii	"2\241\305(H\202\201l\274\227\252\346`\341\257\356\024\341y\341"
+	.ascii	"\026$\027\206a\030\r\204\017F\301e`j\264\270\313O\265W\224\272"
+	.ascii	"\255-z"
+	.text
+	.section	.gnu.lto_setRssi.110.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\r\013"
+	.string	"\226\225K>0M\234\016\013\215}\323$\315GV)k\356\267o\314\246w\263\033O\264E\325\314\371\200\377z\0039\r\270[\215\032\240\247RR@\222\b\006\270\316@T(\002\221\017\205\370\035\311\336R\246\0248"
+	.string	"<"
+	.string	"6"
+	.string	"\217P\217\346\354\022\367.,\207\006\223\207tbw-\265p\356P\223\363/:\315a\005\341\232\321q\240dw\377=\033t\235L\213kw\235\237\356\301\035o{\200m\001\366\257W\230~\205\261\201D\367\f v\035\234T\254\210\030\"d\373\020\333\352\335\003\367Q\306\217]\n&"
+	.string	"\325\243\004f\332\347\360\016\334E\f\034w'\204J\273^"
+	.string	"wT\217\032\337\240\0363\224:=+R\365Z\340\033\321\311\024\366I\377\220\3611X\333\362\237G\177\243\036\257\377\016K\022L\240\210\260\311\223\355qR+\330\207\273\273V\220\235i\352\242\037~\364\226J\266a\032e\331\fP\b\\4-{\2702\301d\026&\263\020\\(\007\254J\246Y\223\210\261\004\226\314Z\200a\231\005\3616W\220}m\224\003\341#)\2651\005\371\217\377\375\352\250\306P\003\024"
+	.ascii	"2\001/~\364\021\202\300\0350\206T-\203\027\330+b\303\374aAta"
+	.ascii	"\030\206\321@\370`\024\\\006\246F\213\273\334T{Ca\336\332R\006"
+	.text
+	.section	.gnu.lto_setRssiMsp.111.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\016\001E\f"
+	.string	"\366\325PA o\224\016T\bk$j\341\022a\320\221\200'\030U+\031\300\275\017X\217\001\275<\001\207\214\361\255\021\234\355;\003VcFz\226@\243h"
+	.string	"J"
+	.string	"0\013\217\320\240j\244\365`\337\032\331dK\231R="
+	.string	">"
+	.string	"?"
+	.string	"\227z\370\366XA\315\315\2676\226\316\343\036+\030^\301\004\033&\0332\336\004\250\201\202j\261\221\360\3025\343\235 \201\335}\310\223\202g\312\2646\273\353\354<\013\267u\333\037\333\006\354\203\002p\265\303:\310\0375\235\232\376\005"
+	.string	"\013\030\336?T\354VH\311X\222*\305\207\355clg\332\b\024l\007\221`\335\3450bd\367;\340\002\225W\336\354\222\177\037V@\210\023\324\t\223\335\r.FHt\250\324\303\304\023E\352\200\324\n\b\257E\021\016G\212\210\030\271\273\234Z\213W\007\"/N\211b\277\304?\315\007\341\b\243|\367\312\037\305WW\016\307\214\023\r\245L\331\037\227\352a?\037Mc \322\026\214<\241\213;\032Rv\221\262+\364i"
+	.string	"\272:\231vi\002\030\023y\262\013\002\206e\027\346\333\303\325\216JI\006\222\222\232\242%-\265\261\007\371\316\017\371\346\244\234\243Z\352D\2458\033"
+	.string	"3\241o)\360\202\257\301^\324h\016\r\217\003\2364\020\200\340F\345\024\016\222A%\t\002\266\025\177@p\210\020"
+	.string	"\207"
+	.ascii	"]\303\027&0\251\272O\245\306\tw\037\214\262\bc\2011\212\252\261"
+	.ascii	"]\245\f"
+	.text
+	.section	.gnu.lto_updateRSSIPWM.112.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\367\002\305\026"
+	.string	"fk\225F\260\032Q:\3650\367\032-\316\t8]\270\222\256\324f\321M\025:=cEXp\306\232\353yo\257}\2743c\346\372T\345\202\3373\036\r\263\366C\355\031\224w\314\326\217\211\037\226\031x\324\264\370\237\354M\244L){"
+	.string	"t"
+	.string	"\210"
+	.string	"\326)\"\354\363x\017\373\344\021\367\271B\017\211\317\234\363\364h\217\260O\217\372 \237|\035\337a;\020\tp\322\240\301\241\3233\347T\360\350\003\245G\325\001\310G\375J>\332fW\031Pb\342,\300\201b'\264e\316\351\332\031\267]Fp\325\346\2074\246\034\036\316e\213\307\022B:\005Y|S\274\034h`\316\371\240\353\t\036N5\244\231sZsx+\356\360\266ol?\260\327A0p\232\344\257\356w?\303\036\244\2464g\216\201Ot \034|\236G\333\334\350sn\344\343\367=\275!?@7M\262}8\335\035\373\340\234sze\330Q\315\2321\251eT\007\272SQ\215*\251c\242\372\024\252aB\265)\252KQ\035J\265\224\352\b\252\301\250\336\250VP\375"
+	.string	"($\036\336}\264\314\251\"\311\313\214\022\215j\034\350\267\357\377\270\220\210\373\002\313\332\3678\002\243#!3\206\260\300\354i\325\211\356\211\213\374\266\005\3117m\315\315yC`Z\230\275\316FiM\033&\321Y\251\351\334Id\270\245\275\016Fj\303]I\311A\264\373\201rgV\213v\277\270\002|N\223r\257\353Qm\334U\214\237\243\335O\347\2348\273;\256\221\340n\360\201\224\323.\2661\334H\021p+\364\212\270\324^D\242\300\2249g\003_\310\207d\320\360z\311G\325\246\250\030\265\256\273+\277\350\002\356\320\242u"
+	.ascii	"\361\212\271<\310b1\031\214\200\r\215&!\026\342ChX\2536s\325"
+	.ascii	"f.\0176\257\230\0136\243\271Z+\313>\324\314\\ d\262\231\353\344"
+	.ascii	"\273\035\234+#\3507Q\345H\224\333\342d\314\372L\336\004B\204"
+	.ascii	"\t\023\344\343\r\027P~^\304\3351k\350\n\221\235y\212\241+)T\265"
+	.ascii	"\251=\241\247 e\256\344K(\370<\266p\341\202|\224\331\013\035"
+	.ascii	"4\342\302\311\217\016jc\366AO\320C\202;\"\372)8kQk\325e\t\223"
+	.ascii	"N\0017 p\002\231\271\234\007y\263\"&\036\321\204f\327h.\373X"
+	.ascii	"\307V\323\366\314}\325#\034b\016\277\240\035T<#\311\2726U3dh"
+	.ascii	"\230dS\031w\030\247\324*\320\342\016\373\\,\334\373.\3678:\226"
+	.ascii	"*f\221\360\344\270\333\330\266K/\265\237\201\037\326\032\343"
+	.ascii	"\244<\231\030{J\217/[\226\021/\321\036\006X\004\333\"\222\306"
+	.ascii	"z8\336 /\341\t\363;\030\345e\310\3470\006W\266\334v\005="
+	.text
+	.section	.gnu.lto_updateRSSI.114.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`M\001\225\r"
+	.string	"\246XYD\020\257&\035+lP_Ja\326&\245\316b>\013\017lVlp\366\336\274\200-\315\270=\360\200\374\023\304\022\364\213I\377\360 \265\232\261X\004\006\240 \002\200\302\036\235\250b|EO\377!\215\354\275eJ\001E"
+	.string	"D"
+	.string	"F"
+	.ascii	"\347\250.\235\331\247\2278l\200\026\027\022`b\354\356\204\033"
+	.ascii	"\236]F\250\231\037S<"
+	.string	"\032\256\323.\255\223\307{?\220B\212\341\272\223\303\315\244\352\030\315t\320\350\"@\335\200\354\256\225\353,\334\325m+\260=\355\203\b\325\345\241\006\206S\352\202H?\273\264)\\\261\017\277\357K\031\252\330'\375R\325\337l|\024\272\277\320\354V\370j\326$U|\340\330\276\332w\371Kv\022\004\003\330\325\020\"\305n\311\200\007X\227\036\357\250.c\236i\203\232\017\363\313\305\244\251\214\217fF+ \\\261O\370(\"\f\226E1\341\307\370d\351C\325\345\217\262-/X\354\227\260}\022P\303bW{\006\345\266\200\207\211\316\260/\342#B\276\007?(\321s\227~I\240\004\236O\b\202\021\021\017\206\205:\033\356|\220`\223\004\233\"!\013>\263\203\201\346\007\207\257\006\036l\216\\\02769%\321\343B\025\357\237\200J\231Dp\363I\334 Qr\324f\360\2012'\200j\021-\265\035\200\364\234/\203\n\036"
+	.ascii	"2\241w)`=\216\275\220\256\372\202\201\203K\231\200\312R \031"
+	.ascii	"O%\337\354z\327X\002\304\005\224<\345\fT\242(\265\215\243c\251"
+	.ascii	"\314b\234a\005e\313\300\250KX\304j\364\270\233}\022\211\325d"
+	.ascii	"\247n\202|\273\254<\001"
+	.text
+	.section	.gnu.lto_getRssi.115.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\022\001U\f"
+	.string	"\266\227R?0\217\222\0160\232\301gA\273u\303\320.\361`\314V\371<\246gp\314Q\225\356\033s\330\222\277\337\236\017P\373\364\360wm3\"\202$\224\023\f\332\255\r\257\326\310k\244\021B\366\336I\246\024C"
+	.string	"8"
+	.string	"?"
+	.string	"[\214\230\342\231\320\320\226\244\245\352\016\366@R\216\006\004\254D\203C\313\t\t\0301j\026"
+	.string	"\007\200~\351\f\364;\006s\234\234\332\037\254@\305\212\212\347S\342\214\022\304\030\233\236\217\004\367n{\240m\201\326\241~\265\b\364\363\005dH\301rk\265N\376Bk\027\217\3226[\271,\306e)\227\275\300\354\344\262\222\313F.\013\237}/\353\\\366\317ff\235QU"
+	.string	"}\034\332b\214\020\345\330\266\027&1b\006\242K\360\177tg\033:\271\365\035\336\356\317\"<\202S\203\352\361\361\001\375\334\247\t\371\377\255\310X\374\274OZ\nb\020\013\244\030M\020\324!k!5\310\257\033\221\264'\325l\214\\\326\310e1"
+	.string	"\351\b\2614\227\003k#\323M\003\217\313z\260\331\\\026\245av\361(\325\t`\357\024\363\352\316PP\227\2169<\221Q\350H\227S\323/\037\340\"c\351\360\212Fe:\007\213\224\022\266\320\"\204\026\033\030"
+	.ascii	"2\241\207)0F\nu\374\300\2530\031\b\207\005\022\301H(X\311\344"
+	.ascii	"CB6\224\t\nL\022\300pY\3134B\306\027\213[\331>T\255\27006\037"
+	.ascii	"\263\230\005#\303\265b\022&\031"
+	.text
+	.section	.gnu.lto_getRssiPercent.116.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`v\001\245\016"
+	.string	"\326\\cC"
+	.string	"\221(\035pj\315%\177\356\302\007\025\331oW\240\352\317@xZ\305\025\034\252\226\225tF\353\225\3156%\376\324Te\233\373\023c\001"
+	.string	"V<\370\357RX\334/\007\215\256h\377\333\236\265\237\220M\222L)R"
+	.string	"G"
+	.string	"V"
+	.ascii	"/b\314\360\325\210,\340\t\017m]\207\360\213\304 \372 e\004M\214"
+	.ascii	"\2213lIZ\316\320mI\313\025A\202\222\246\002\\P\315(\320\202\241"
+	.ascii	"\025C\023#\254{\007\247\234\251\332.\376\360b2\256\023\225s["
+	.ascii	"\020"
+	.string	"cl\272N4\270w[\003m\t\264\311\021\260\"\247\264\313\260>i\206\331\375r\226\"\005\246\345\265\312\257\205yy\016\255\263\370\225V\313\222`v\004\263\"\230\rmY\020\314~`\326\003\263\334\263\035-\313\201\331\315\263[\263Z\226\315\236\315g\275\001R)q\342X\240\207.@\006k\306\201I@\210\201\356\001\343e\302*1^`\261\036\337G\303$\306\025\207\347\037\356\233{n\326\007/\277v\316\335\234wj\030\307\200\324,-\231L\232!\347\034\224\355\233C\027\254\231\354\333\335\252\361\253\021\374\022\262\211\321DA\r\263\b\t5\213\003-u\214\240\272\021T7!\004D\244+\241*t\035\033=Q0\241:\013\247\023\252\343`+g\361+\332\007\254\3565\257\001\310\266\330>\027\205v\300~\313\240A\332\225\317\"\312U%\335\267\213?\274\230L\253ft\322\315Z!\372\347\243k*X\033\274M\350\242\033"
+	.ascii	"2C\237\220\300\376\033\020\332\020\342\225y\2560H\013\334\n\223"
+	.ascii	"\201pY \021\344\204\202\231L>$d\323\231\373\301$\001\f\227\225"
+	.ascii	"\320#d|\261\350b\373\256\262\3205\374\361L\234\202\212\034\356"
+	.ascii	"\262\251\235d"
+	.text
+	.section	.gnu.lto_rxGetFrameDelta.117.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375 \356\205\006"
+	.string	"\202\214-2pM\322\001\240\f\210\376W\034\257f&\200d\210\030\034\205\346\261nk#\315n;f}\314La+"
+	.string	"x\344\370;\255\200\214Q\255\370\256\221M\244L)\266P\227\347.\3175,$08\313{p\224\344\312A\3419\210\252z.\302\366\312I\235,\335\330\0379\006\375\rG`\362\327\233\217\201\336R\001.\254\314lL\223\232a\377Y\345\330N\247\006tP\304wNv+\262\2245i%\036\2663v\344\203<$c\210 a\305\202\017\216\t\022\224\335u\323\005\240\267\347\022\364\246\032\207O\350_\344\007\233NvE\315\263b\260\273\316+Z\334z\333\004\266\007lc\004\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_rxGetTimingStats.118.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375 \356\205\006"
+	.string	"\302L.4Pm\222\016$\243*J\240j\235V13@`-\352\207\350\340\270j\341\276\375\335\226\177\"<\025j<;3E\251\302>\303sT}~\315\242\222A\210L\001k2\033\3706\3601( ,<\rtx\231\313SC\002|\017\323\004\237%f\033\350C\250J\246\325\353\2024B\334P\335\021\024\353Uw)\251\016c5\317\307\016k\031_\200\314\314\033\350\231\200(\364\351\210$\263\"\005%K\334\210\350\347\274\345v\324\203s\325($,\f\314\006\307\204\310If|\307\016Hu\225^\244\272\246\321\252\254\272\375\350\201gdr}:e\001\006\2319\273>\026\275\365/\370\t\376\213\007"
+	.ascii	"2\003\336::X\b\245\256![\210\\\334\025S;\311"
+	.text
+	.section	.gnu.lto_rxGetRefreshRate.119.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375 \373\335\006"
+	.string	"\222\31505PO\222\016 ;\223V\270\372L\327\237?*v\220"
+	.string	"\212\311\350\253\251\205Z\333Z\363\361\265\300s"
+	.string	"5\221i\322Hj\226\005C\237E\354\252\377`\215XBd\nw8\036*z\250\b\341\300\360\020;\224D\344h\236\"\032\25081MT\314h\331\027\372\031\\\357\342\247\350I\025\220\231\tWT\255\342~\024n\361q\305\n\357G*tO\300\344r\243\327,\3678\276\230\314\314_\350w\2737\020\262e\335R25F/\311\002W@~\320g\356HI@W\033\214\313\332\210\2102P\\2\265H\320\002\251\320U#\025\276\216Vu\325mI\027Z6\025,\263\352"
+	.string	"\0242s\207e\033\375\365G\370\017~\217\007"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"\343\232\222\205\310\303]1\265\223\f"
+	.text
+	.section	.gnu.lto_isRssiConfigured.120.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375 \363\245\006"
+	.string	"\222\f.4Pm\222\016\244DX\210\205\222\356\332Z\322*\016A\030\003YF\227\257g\337\376\335\262\343\214"
+	.string	"T\250\361\354L\2336\206\nX!\t-l\r:\254\375Md\nk2\234\3478\317A80<8\315\223p\231\201\251\210\206\347&(\3529\f\226E\022b\001\bC\337\315\245\210X\021I\250 \r\331\334\215):\255V\247\333\271t*\006X\200Z\351\261OC\214\257%\221\364\267\261\265k\021\3508\271\232\241d\216J+Y2\215p\374\236\307\214\220\340\271*\2461\"\360\310D\"*\231\230\303\214Vm\325\355G\027L\262\024\353\372\264\001(d\346\315\272*:\366?\370\r\376\213\t"
+	.ascii	"2\001#8\343\216#D\250@\\\023SF\220%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_getRxfailValue.part.0.150.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\357\003\275\031"
+	.string	"\206\255\242H\300XM:pyPD\327B%\276\312>H\242\325\226\322\214\276\030.m\016\3359IH\201\317^~u\373\355\337\357\275\226>J\263\036,\232\352\232\003\3042!\361U`\\(\016 e\020bZ\354\221.k\311&r\247\024\211"
+	.string	"\227"
+	.string	"\205"
+	.string	"?/Sxk\275\001\345Tk\351\340\324\nX\247\366\217\035\236\016\241\341l\373A.\344\307@\263L\302\005\370Q5\304DUk)\236\022x\013<\235?"
+	.string	"\236\356\216\003}\005\322o'\013\310\237Dd\320W\313\"\t\270\264\242GD\3128\245\251\265\206\244\212\371}-*:\270\204\344\355kp#\n\206"
+	.string	"\3226\367\243\221\"5$\200\274}\t\220p\200\371\356\263\005)4\247\201\263V\022j\255~-w\003\270m!\3336{\243\002\325E/L5\242O?\336t(>\243}t,\020\3322\364\344\244\204\t\227\330\025*jG\n\256\004\271AM\234\223y\276\232+\223\212:\364\234\204PU[Y33\217\253L*Z\315\030s\303\335\310W\366\375%gb\207\036\317\363\200,c\224F\020\271&%\023\347\031$\222\333)\271vP\236\235\347\236\234\022*\352\027\241\371G\276s\330D;\223\317t\225\265\b\267t$?g\362y\275\341"
+	.ascii	"\274h\022\306K\203"
+	.string	"\222e\304\017 \320^\246\240\341Qs\352o\332\017 \004\032X\265\332\"\370S.\265\301\357qj\016\036\250\357a?e\212Hm\366t1\224j\337\352\244|\356\254j\315\326?\200v\b\021\363Ds\377\304h\377\252\034=\336\256\316\266\016\370\375\321\322\026\333\254r\201IS?\002\264_\260y\242\357\344U\261!e\333 (\333\264.\254\244\212\253F\225\301\351w/\300\253BC*h\212\231\253\363\262\376\325E\262g\246\301\231i:3\375\311Lo8=\303\351\313\314\\MT\r\316\311\261\231\355\214\262\023\261\0216\002&\023a8\b\234C\242\207\204\016Nl\244p\203\363\232\355\350\274,\264vnb\261W\016le\230\r\n\231\210B&\306t^<\"L6\023m\016x\354\271\221\211'\306Q&\206\266\347\027\311\340\213\030 \335\357n\201\374B\277\005\267\205mp-\241\266B+\240\"\237\322B\327\245$\312\372"
+	.ascii	"b\245\202\037\257\356\221\355\t\307B\301\312\257T\270\200\001"
+	.ascii	"\003x\372\355a\344v`\374\224\244F\020]\2355\200\2732]\226\246"
+	.ascii	"\354\f\247\022O\250\221D\243\220AdHdF\202Q\320\264\r\200\002"
+	.ascii	"\231\273\323\006\021\220\255\224F4M\215r\375\fLh\\xX\2442Lw>"
+	.ascii	"\226c\321f\344\337\327\263\370\262L0\272\236\352C \372\216:\030"
+	.ascii	"\327D\227\0215/\233\332\004\311\260?\0316\327\344}E\\\002\t\\"
+	.ascii	"\221hI\363T\306\222\213\004\3159\337yL\t>\311ZDN\243\363~\316"
+	.ascii	"\337\203\210\215\037r!D\225\276b'a9\251-\336|\036z\276X\337\307"
+	.ascii	"\314T\370X\2047s\330x!\376\001\004\256\215\355QGv9\033\333b\315"
+	.ascii	"aD\244p\t\254\026gR\331\374\246"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.part.0.158.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`g\007U*"
+	.string	"\032J8\020Gp\334Q:#\231\002h\342IY\032@\220\005\222E\361[\372\216\314\265\353I\255\2565\277\233\021\031\3727\354\261\332\244\025P\352S\355@\270\273df{\007\266mrv\230\226<Q41I\001\274\202\337H#\204\310\235d\354"
+	.string	"\346"
+	.string	"\356"
+	.string	"Y\374+\274\276\213\013\006\357\206\\0v\303\3455\346\204@\226V\016\216\262\004U\213y\305\222a\371XM\314+\263\023\363\312m\277lz\025\246sy\215En\313\374\253Sqz\025&\276\335;\005\007\354\336%\204\243\214@=\272{\200\364\350y]z\224\371Sx\002\205\246\"3\363\004\nN\f\374R)%\344DL\224\026\363\336%\357h\0339\360+\356\246\332R\364l\333\003\344?}\335@v\004\327\3437\033\006\254\023\221)\311X\251M\341@^=0\205\343x\333\323\024\217\347\356\336\273\032\243lz\032 \002D\355i\212<\316\335\230\261\250\325\be\321\263A\222L\216\234\221\306\031"
+	.ascii	"\315\2208P\366\264Dc\216\367\331\300,,-g\034\236\001\244\224"
+	.ascii	"\020\217uk\303(\2646\350=6\f\367^~\320\307\331\347\314\274\205"
+	.ascii	"\231K0\333(\004T\334=?o\023af\313B\253e\335j9h\265\f@\265\f\244"
+	.ascii	"Z\376Y-\347p\226}T\313=\252\345U\265\214\273\330\371\366\256"
+	.ascii	"\263z\263l\273YNU\313\250j\371d\313\255Z\266_\376GpV\371\370"
+	.ascii	"I\336+\325\304s\203\240\\\226\274\353\377\372\265\374b\377\227"
+	.ascii	"\377\314_\346i\370\267\033.\225\306\017\371\321e\305\274\303"
+	.ascii	"\353@\006\377\316\245\322\030\303\fT\221y\357\345\035U\231\317"
+	.ascii	"\367r2|3\037\343\365\214\227\027\202\037m\312\234\267\313\346"
+	.ascii	"\350\002\346"
+	.string	"c\304\232\356\245\304\273\340\362\026\303\\\214\323\275\224v\301\345\256\007\323*\f\220\275.\375\222\205A\026\006\006\310\200\200Y1\337\205y\275\225s\221\3610\376\231r\353X\370[\016\306\353\227\327\317\3537D\354\202\252\245\351fa/\273!\320\035R\211\001\273\367Z\270\326\003\\kk\343\272\247\017u\353\325\"\345D\2555\233g\220\252\215\353\217\375P\262\312\266\316\230\303\325\224\216\246d\336\372c\276a\r\231G\n\225\002V\355cyZ\007\365\336\340\211\314\037\216\006\002B\233{o\205:?\013\301Gr\224G\220 \221\2260aO\344w\261\2513F\243\237\330\326j\377\312uZ\016\236\266\315C\021\211G\310f+\r\355\264\007\240E\255\235\375F\373\\~V\225\2315\211\332bb\306t\242w\366\301~^=}\215%\257\216A\333\234\363+?\327\220v\230g\375+\357\230\201uS1\257yw\212\2547C{\207\343"
+	.ascii	"Q\250\350\236\200\264#\345h\233\357\346o\230\212z=4\"\235\307"
+	.ascii	"9s\246\364m\373>\220iB6[I\241m2\037\230\362\325\274\f\310G\302"
+	.ascii	"F*\354\211*\322\243\307\372\0024_H\222VgA\333\264\035\274\"\202"
+	.ascii	"\321\021\213%\036R\322\321QR\217@\021\n\233\002\205\375\215`"
+	.ascii	"\352!\031-\025\271\270\375F\030\035\261\020\261\204d\344\363"
+	.ascii	"\301\350\371p/\302\f\037o\206\217"
+	.string	"\207\304\242\350\210\327\363\375x\021t\234\364\302\310\307[JJ\362\361\326\237\267\211\360\261\256\342\251\262\301\365u\373\201\251P\333`f\241f\f\301\026\256\272.~(\rj]\377\306\220\023\242\240\026\301C\213ZU\213\344\230\002\313\f\224\002\234b\267\302\306\324\314\204\375D\245#J\020wk*\346\233\035R\311\256\333S*\200\256\361&\200\316e)\271\240\222\302$O\310\232\266\246b\240~\373\262\314@\001u\fdS\355h\305\334p5\323\237~\237JV\031+\264C\340\025\260J\206\f\351\321\237~p\344h\303\320\320\bA\233\212\207\322\\\323\336!\rD\366D\242\364h\256\217\365\004\306/f\362\352x\372t\036%\001xN\244\323\323>/\",\013\200\230\250\201(\t\215B\246HDD\232\222$\035`\"!v\326\r\022\300vEL\221\b\251\275\263w_\255\340Ki\337N\2441\001\004\323\256\236 qF-\345"
+	.string	"\023\0332iR\326\307\304'\376\005S\342\r\bkh\351!\031\265fg\243\377\2249p\301\f\023\316\320\211\311\205\371=x\277\276\357\002\234\371\031\3605\264\017\324K\002\005\t\276h\253\004\245{\016\256\023\357{EH\325w1A\0229Hf\303\270\343\343\001\243\311\025\314<;\337$a\217\215F\242\223\233\221\223|\256\3354\301?\346\006:\230&}\362\323\265\217\320i\255\033y\350!O\262\234\nnI\004\371\373\003M\332\221\347\307\023\236Z$"
+	.string	"\025\035\223\300\306\303\310\262\347\342~\220\304\335\001\255i:\342\274Z\247\272\343\260\332\241D\024\200\013\203d\266\007\016\013e\345\273\016\020j\003H\310s\324\013\342\367("
+	.ascii	"\013\366\312\364W\\\371\031\304\202ol*y'-\332*\004.\220\030\244"
+	.ascii	"\030\"\344\345XT\327J\305\300\035OH\205f\221\252\314\250Z\037"
+	.ascii	"\361\340SX\317d\213\340\371\"\324\230\333\227\031\241\031S\206"
+	.ascii	"\235i"
+	.text
+	.section	.gnu.lto_setRssi.part.0.162.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\376\002\315\025"
+	.string	"\266\350\211I\320\360(\035\321p\320Z\022Y\205*8\213\211CO\314\200Y\221\232\t*\344\f\004\033\223:\3661;\004c\252\351\375\227\240\277\262S\004z\275\340o\005_|\322\305\215\022\344\031\347L\330\325!\364\336\266\332/\371d\023)S\np"
+	.string	"q"
+	.string	"s"
+	.string	"\332`\3466\214\\:\374\271\t\334\201^\214\232\263\003\220d\274\034\020\252\274\372\337\355>6\375\315\231\031\257\332\037q\022\270\373\330,\347\254\3411\232\363g\340\322\004\306K"
+	.ascii	"\027\021/\365!\342\245}\021\266o3\306\3319\376\303\231\002z\200"
+	.ascii	"< \036sN\327\345z8\356\253!\316\217\371\2460d\270\202<<\235\314"
+	.ascii	"9=j\270\345m\037\260mb\257\205\253^\255Z5\252S\243\0325\252\307"
+	.ascii	"U\237V-\236\324r\325\241\250\336U\353\177\377E\324\227\200i\316"
+	.ascii	"\013ML\263F\036\361\234\350*\034\240\002\205\337\210m[*FA\214"
+	.ascii	"\215\353\362A_\373>\212\027\331*\327~\302Oa\342[\0021\347T]\022"
+	.ascii	"\r\331\306i4\366z\200J\265\017\331R\3639\245\036\"%\004c\355"
+	.ascii	"~\211\233/d\225\355\007\335\016\364\022\013\3432:P;nj\277\243"
+	.ascii	"\321\271\370\213\002\020^/\361\022\265\253\033\275\323\216\342"
+	.ascii	"\352\236V\221v\037t\332d\271\242\313[\330\3069\247\211\317\342"
+	.ascii	"H0?\347\322\261\224\024\361R.\352h7\334\363\202\376\212\037\251"
+	.ascii	"\3709\216\300\242\227\271\364Y\304\313\335\027=\334\341\303\321"
+	.ascii	"\243\367\325\275\320\031\350v\226x\301\2346\351\336x\303\207"
+	.ascii	"sm\354\223\2725\252Y\242\372#\261\332\312\313E\306`\263\232\214"
+	.ascii	"&\306j+/\007*4\332\feX\t\314\314\0053sIPy\261\270`3\232\253$"
+	.ascii	"\304\262\t\261\231\253E&\233\271\364k\343\223\334\352\274\017"
+	.ascii	"\347\234s\367\306vk}\032\257a{\200\202\"^^\350\013~v\226X\333"
+	.ascii	"\332\207\251emJ\247cc\027\374\330\031\253\375X-\342\005[7\222"
+	.ascii	"\250\332\325\206I\274\036\311\303U-\210N\007\270\243\321\311"
+	.ascii	"\260\261pb\264\370\222BpH\005B\250q0\307\214\024\314\020\211"
+	.ascii	"P\320\222\026\032\016p\002\031+\354\006\020pW5\313\030\314\002"
+	.ascii	"\241\331\217w\306_\033\033\0059.\327\242_\030Fk\313\200.\206"
+	.ascii	"q\336\b\030\327\321t\241\272\331.$\016\255v\002\364\263*\031"
+	.ascii	"\234\362[\374\254Cd\324 6\020JI\321.\222\352\016\3114.Y\002\346"
+	.ascii	"\337kg\021\220u1M\022-\020\004\376\220]\233n5=\323\264q\030N"
+	.ascii	"m#\257\340=\354\031\034\242\315wf\275\254\271\217\006\374\037"
+	.ascii	"-\006\274\203\375"
+	.text
+	.section	.gnu.lto_setRssiMsp.part.0.165.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\355\n"
+	.string	"\226\025J;0M\225\016\003e\316\256L\233TE\0256&\247\323Q\241\306\357_]\030V;B\237\255\305\030\342\325\320\203aX\325\301\301\3345x"
+	.string	"\235S{\0179Q\231\031\004jl{K\231R7"
+	.string	"7"
+	.string	":"
+	.string	"\2060\036\355g\260\335\031\271\263Y\377&l\205\005\022!\016\255\335\315\036U\302\273k\302\316\377\367\206G\362\\\035\244\322\223\342pb\300\356\232\321\340\216\267=\261\035\300\276\201\216i\b\323\n\323\371\324\377F>\200\270vE/\327F\210\037*\330\276\375\257cc\2305\237\262d\3229\212\363oE#k\332\222Iw\024\307\272\013\001\203\207\335O\300c6\002L\336\203\252-Vi\005R\217U}\r\337\240\371\024\234\200\313{\217>\267x\374\bOD\036\300\"U\365\f\\\240|\371\232\372"
+	.string	"qA\025*\361\311W\352\311\n\017WM\016\027\216+\240\341\b,\250d\034\246D6[\266\331\262\314\345"
+	.string	"&\243l\\\026yX\323T\266L\201\246m\031f;\017WMf\260\034\254>\nR=\331\206\352\253\336\201R\261X\026\217\032\002\313\024"
+	.string	"[+0\036\270\201!\005\002\006\271\004V\003\001*8@\024\fs\205\003\247\305\276\302\211W\331jN\3736\363vZ"
+	.ascii	"\256\275\230rZN\277\266\214\001"
+	.text
+	.section	.gnu.lto_updateRSSI.part.0.166.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\353\0015\021"
+	.string	"F\037nG\340\262(\035\252r.\211\001q~l\004D\222\021z\224%*\221t\203z\017\305\024\332g\305\231\316$\312\332^\373\365k\330"
+	.string	":\021\327c\203\r\363\2718\356\211\3540\210w\376\305\220H<U\025k\242[$\233l\231RU"
+	.string	"Y"
+	.string	"\\"
+	.string	"7\273\267\004\237.\360\371\f}@\367\311]\244\373\364>o\3026\353\202[\266\215\337^vd\004\216\254\206gw\277O\351\362\3269\251\263\345\207\214@3\232\353\234\316h\030.\003\320b\\hw?s\255@\203\251\n\370\f\031\355\256?\031\356\356\266\031\330^`+)r\252u\252\017\322\232\002\226]\013=?\266e\302\200Y\341T(v{\241\235&F\306\t\236\215-\211m\225S\244\t\234\213\210\0337<\237\227\271\257\3425\266g\325i\\R\333\361T\367cX\376\214=\333\227a\375\266R\322\2764\220|Z\325>\212\247h\375\2662h\267C\211\035'YV|p\300Q\203FL{XJN\216\350\220\005\271T)\345kn"
+	.string	"\004\314\212\314&\004L{\354\251\r!\324\317T\206`\322e\277\305]\254\374\017\026Q\364\263O\037\245\373\274,\251\355\360\330\360\322\036\026\237\226E\360y@gF\216K\201\250\264Y\316s+=\330\235\232\233\352~ *\205&\324w\022\303P\004\t\2444(\205&\023\324\2514\216\022@"
+	.ascii	"\006E*\343\2472~'\223\203\360\003\307\224O$b1Bi\374P\2428~\236"
+	.ascii	"m\375\314OA\207G\316K\302b\330f\351\314#N\332\fv\376\315_\200"
+	.ascii	"\245\223\223\356\323\244\266\203D\016y\335]\227\2246\033\307"
+	.ascii	"&\347\251. \200\002\221SU\007S6\240\341\027\302\306\003q\204"
+	.ascii	"\226\027\265\200\0261\022\013ZX\314\215\221\273\202;`\235y,,"
+	.ascii	"\361m|z,\024\t\0263>\311Z\321\004J\366Z`\223D\3350#\334P\n\262"
+	.ascii	" \240\035\346\364<\306\2461\265\225hGc5\265\312\212t?t\3019\325"
+	.ascii	"B;e\251\201\221\366\312qiO\251n\275\026\217\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\312\006\265\033"
+	.string	"\246,\242@`jM:\316\354\203\325\020\215\244\236\364s\245\263d\264\270,\276\342[\221\235@\366/^\262\231\364\230(\261\330\201\001=8\003<\023\345\310\237\025<>;w!\254\323\232W\020.\243\250I\223[\246\220"
+	.string	"\223"
+	.string	"\215"
+	.ascii	"\2752\306\2360,\224/(\270\350\033\252-N\306\311dr\215E\037\255"
+	.ascii	"\256X\237\212\336\254\232\342B\311'\212{\235x"
+	.string	"\030\203\177\225Ph\220j&\372\205j\211>\241J\342sF\\\216\210\023K\005\247S\206\350\237\325=c&\321\017D_P\345\363\003\317\003\324\246\275\016\257S\376G\340\340\226\312\263\r\207\276\332\206>\237\251\376\236\333\211\242\302\240\355<\317SC_\217\031\311\213Y\206~\236\212\n\335\374\375\213i\331\243\255\371R\304\320\037\253\377\231\346\004L\254\216\030\351Q\245\303\252F\025\021\b\337\324\267W\307S\242}I\275~\244=\373\220\272\277\026\245\377\bJ\337\321\244'\375FN\372\213\232\364\0251\351#\202\020\241T\264\244\177(\251\244\237V\223L@ray\244?\310H\337\314\252\017\250H\377O%\322\367S\207\274R)\344]\345\231K\323e\026\244\337\347\004\322/\253?z\315T\037\022z\364j\361X*U;e\307b\351\350\005V\252\203\345\370\020\307\343\334\220\262\021\225\326\350\rSi\334\316\214\n26\0273\271"
+	.string	"q\003hq\205\371\035\223\013\244k\200\013W\360a&7\035w\017\211\331J\313\231\234@\355E\223o\300\205b$\310\353)\307Sk;\301\236x\323\260'\336\265e:e\276-N\266\333q7+\r$.\004\234x\211\273H2I\257\177\021`\334p{8\001L\2657\032\331\310\271\035\034k\351\225\222\245O\tK\357\357J\177\222\225\336\253*\275\351\257\027\245\322GN\351'\367<\317\377\300b\365/\255\224\213\371^,7\275\261\374\003g:\373z\027\357\360\201\024/\272\273\205g+O)\305{\334\023*\276\031\323\340\002/\272u\201\005\236\272q\002o\227\335(\333\r\270ul-\220\030]\024\343\272\254\003\2645`x\266\025<\333"
+	.string	"t_\346\313\242f\001\357\302\363<\005\360\330<["
+	.string	"\276 \231\223\355\330,\203K\017\266\343\033q\231\r2\355\370\342\216\251\036\360\246c\r\230\t\335E\203T+\342t\334\204:\351\270\t\270\253\225\025DM\035\233\303\255\225\340\374\260r&\233\351\356\256\270\310\002q\250a\f\206\"\325\004#\"%I\222\264\006\240\002)\242\3426\021\240\020\245\221\021\210\214\004\"\022\314m:<\f\345e\353\250\023\355\276\211M\237Mj\267pS\316\332\220\3443HgP\303K\325\233tV\3359\361\251\036a\345\311)'%\223\220C\002G\366\220\020\215w\216\027\374A"
+	.ascii	"U\252\007\"\351x\3505\204\372\216\344l\027\241\356\324\374\215"
+	.ascii	"\376\002\226i\256\013\036\001V\344\004\027\333@\005\022%\370"
+	.ascii	"\327\300Y\261\"WY\030\210\243#cg\356\272A\356\330\346\f\252\272"
+	.ascii	"/:H\223\374?\316\221t-\033\2442\376\003\266\032sZ\3409\316jr"
+	.ascii	"\032v\341*\017\003=\005\201\356\234\341\351\316\372\362\b\270"
+	.ascii	"\353 \365\257\333EbX\177D\335\035h\304\223y\202a\201\227\235"
+	.ascii	"\274\037%;\024\333^\003\240\034\200\354\017b\260\343*\346\274"
+	.ascii	"B*"
+	.text
+	.section	.gnu.lto_.refs.3c1173ad114ec33b,"e",@progbits
+	.string	"(\265/\375`\243\001\275\r"
+	.string	"\226\345b5 \2118\351\001\204"
+	.string	"\204H0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0@\341_\365W}\f=\302?\326\037HWLc\303\376\033\256\241\330\323\276q\034\r\374\260\226\2505\262e\nP"
+	.string	"U"
+	.string	"T"
+	.string	"\320\365i\271aa\252\362\220\367\317}Vf\200~\270\227\334;\312\013m\005\353\251I\237\252\374\305<\212\237n\005\367\203\244g\221\236\201\035\203\275\002\237\001\366\n~\204y\004>\204}\202\357\250\336\"_8\204\332\232z%}\344\036z_w\024}>\b\035\262\351\017\212.Q<\264\371\234X\342\215\321\364\213\346\033 :%\342\255\210\257 \232\277\310;I\207$\337\036z\263f\250;.\235\343\375\206\303w\254\327x\375\342\352\024\330KX\017\361z\006\353\027\246S0o\271\257\334'L^\202u\352\322\341\365\217K\177\016\037\003\022.vF\257\345"
+	.string	"\335\200\325?\361=\356;R\027\340^\003\243g\304<\303\345\026\257o8o\341|\003\347\0318Oy}\342>\272\207\230>\275\3760z\244\351P\354\r\312[\354\331\362\214\275\2317\366\342\372M=+\266\310\243\212\336\246\002\310\343\324%\023\001\237G\310*\035\264\346\020\262\222\r\030tA/L\005\275\324\t\212\240=M\007\232\201\016I\337\244\026h\035W\232#w\237\034\372\344\371\311\215\366\313\336y\276\236\tDo</\221\275&\353\331\303g,\035\353\374\305\322/O\237H\237\020s*~\244\323!\030\377\256\236\361\017"
+	.ascii	"W\005\253\231@\305d\002v\267\210\3061\027\245,\266\026\373o\202"
+	.ascii	"3\213%\334,\"\013X\2346aE@`\377jf\320"
+	.text
+	.section	.gnu.lto_.decls.3c1173ad114ec33b,"e",@progbits
+	.ascii	"(\265/\375`vX\005q\001ja\376\204U \fQ9\351\024\013\037\365\313"
+	.ascii	"\222\340\272\203\257\207g\363bys\330XT\3770~\007~P\230\373\301"
+	.ascii	"9\346\377\333\354\222\215\022\343XG\243\210Fm\264p\235\233\316"
+	.ascii	"6\330h^\252D\256\337\256\324x\f\353,\240Jb\302\231\253)@=w\r"
+	.ascii	"#\226\220\275\345N\001\033\007L\b\217\bjV\271uFG\311\222Fk\245"
+	.ascii	"\335\262\300\262X\023#N\343f\322M\3542C\247\355\001y\262j\374"
+	.ascii	"s\f5A\3166\303i\377\376l\206\263\267\354\320\311\201\025:\373"
+	.ascii	"\f\304[\311\217\325\331\232\224\306\027\254\320\371\267Y\006"
+	.ascii	"`\2227\036?\032\377\235$\003eT^c[g\333\234\261p\342\320\211\301"
+	.ascii	"\2313\207&\215\032\261:{g\345\374\304\352\354\2315\r\305\302"
+	.ascii	"\312M\311kSc\365l\035\326\002\314\322\344\345\234\377\367\217"
+	.ascii	"\006"
+	.string	"k#}\243\207\364X\223u\221\316\321H\032\253\263\272\254\203\364\221\326j\"\255\243\205\364V\177\265\217\026\353\036\315\243w\264W\003i\256\306\321]v\331aM\343]\243m@\241\325\351R\346\267u\026\217M[\336\222g\353\254\2308p\254\234/v?\210\216\221&\342\267p\332\251\212\255\263a\254\234\034\020S\r#\212\030\234'*\035\326U}\365ss\366\201&6FF\2237QV\316\255I7Y\351\026?\210\226\222\"\346\367\203h\027\r\243-/g%\234?.y9+\341X:^\336\374\026N\037\336\036\237\225\373\2719\357@#\006\242\251\026\240\204I\236\255\3530\353\306\262\331: #\240\231\311\313Yy\213\006\202\210\016\263d\254\234\255\303\312\227M\336\213c\226\263\222\003\021\007S\f\031:cF\300]g\207N\002\314@\373J\316\003\331\002 \331\237\214\275\306m\005\342=C\350\254\302R\346(9g "
+	.ascii	"P\211{k\f\264B\347\317)\364f\034\364&\036z\363\013z\023"
+	.string	"\255_`\033_\274\302\032\337<\202\336\314Bo\272@\217\247\006=\256C\337g\207\316\3438\364\270\r=~\202\036+A\217\307\320\343\036\350\261\013\364W\017\375\245C\177\327\320\327\235\241AV\350|\236\035:\177\211\240\277:\320\337\026(\221\035:\355\032\313\306.\211l^\006\262vO2\264\032\377f\364\004\331\022\235\377\263D\347\273\r\372\266C\213\242\240\037\004AE\260C\347\333\n\275\365C\037e\016\375\025;t\336>A7X\241\363[\350\276\3342\031{g\032\317\261\360Z\3325\276\r\202\376\267],\027\273\264^\254\026\253\314Y\231s\276\210-V\356\247)(?\211\001\023\002\004\021\326\213\205\263rW)\006\204\322E\227\227\263\222\210\003\007\240\036F\356j\234\370\326\007z\373\002\265Xl\026\273\314\300\306\035\004\021\277MN2Z\316J \237:gu\3444\276uBo38\355\237\315\340|\t\320\337\276e"
+	.string	"\244\264\021\303G\343\337^\261Vzd\004\351\302\246q\025\"\236&<\314D5~\n\364!\224\226\355\307)(C=\251\021\313Y\371\337\272Y*vi\247X(\267Ql\333[\231\3632\347|\333\344\007q;\305J\261lWy%C=\205Q\200Z\\\224\216\276\234\225\034\2108\364\330\220\262C\316\211\377"
+	.string	"t\203\035:\261\025:\337\001\265j\326\211]z`\327n\323l\223\233N\312\254\314Y\t\324B\350\264=i\374\r\320\333'\377\341\312\"~\242\267\036\234\367\357\317zp\276\321\266Bg\220\035:\177\313\344\267K,\232\007Wjj+G\311Yy\001\205\302\342\206\326\370J;t\242V\350\264{7B\320\270! \351\300\312\034@O\221\331#Q\367\240\241N \364\343?\f\364\003\254\005\256\007@\200\201\b \240\005\rv\017\tc\371\355\005=\376n\331;8\362_#W\314~\225\320\340\307=\354\nD~+\343kA\032\356\277`\246\227\335\303\3615\025\332\206~\363\352\267\036\376\013D"
+	.string	"\267\200\355\377\232\031\343o\254\373\365\367\006\227\307\r\363\303\377\265\016Rtp\177\364\023\007<\303\217!\360w\325\355\372-\035+S"
+	.string	"\337\371\261\237=a\304U\350'f\213\337\316\375\217\263\024\\\t\374\266\357r\365\370\255\227\r\374W\341\313)\370\315\247\277\217\356\226e\352\263\025HA?~\353\rx\374\227\303o\333v\374M\"\205\253\343\2776~k\001k\201\005#\004\263BV\350\r\250\240\341ja\375\266\356\006\370q\221\377qf \340\200k\365\337J\217\240\300o\2216\370o\325MAd\213T\027\300\217Y\374w\003\030R< \354\021|~\334d\035\320\025\270/n\212V\241\304o\277\256\213\257a\035\307\316\200\t\356S\203p\235~\253&\331\300\tF$m\276M\177\223`\257\254\303o\266\360[\004\330\013\374\355!\002\267\004\277E\361\333\275K\202;\202\337\252\200wE\360\277\003\017V\334\344oAp"
+	.string	"\374\370\350\230\324\3015\236\360\236\037\033\375-&\274\375\315\025\376\026\016\311\300\337\031h0\374\233(\354\214\337\212\370-\235\213\364\333\017\377e\300\321o\257\374V\355\267\312\377\246\370\355\224\377\246\277}\373/\361o\257\277\177\334\341\005\377\355\340\267u,\364\360\202\360\337\020\302\036@"
+	.string	"\354\032\013\\\017\230\371\355\213\337.]\243\337\306\370\355\bn\007~k\365[\247\273\302oa\374\226\305o\307\334]\005\013\305\203\377D\377;\370\037w9\360_\024\247\300o*\340\267b\354\n$\264\006\214\200\307u\005\346\217\013`\345\347o\036\340?\227\377[\376\317i\370\257\201\177y\360\307\001@Q\342V\200\347\277\224\377S\376\257]\003\215\376\007\376\370\302\337s\376\333\377\265\177\377\375M\347\277\377/\376\333\204\377^\370/\005\376>\363\267\337\337q\376F\377\233\302\177\240\377\f\300\177'\360\337\006\374\367"
+	.string	"\3775\300\177?\374\267"
+	.string	"\377\355\360_\017\376+\200\377b\360\337\013\377\005\372/\360\277\346\337r\177g\371\033\356\357)\177\267\375\315\366\367\215\277\255\376&\301\337O\376V\373\033\351\357\263\277\223\374]\366\267\330\337a\177\017\371\033\354\357\257\277y\374\255\343\357\254\277q\374M\343\357\031\177O\375\355\342\357\250\277O\360\267\212\277\327\277A\360\367\361\357\026\376.\376=\374[\370\267\321\337+\374\275\201\2773\3607\006\376F\3617\005\3766\361w\211\277I\374\r\201\277M\370\373\001\177\217\3607\002\376>\300\337\"\376\016\361\367\207\2779\374\355\301\337\003\370["
+	.string	"\177o\370[\303\337\025\374\r\3647\372\333\021\374v\351\267N\277\035\363[,\277\r\373-\330o\177\374\366\357\267\036\370\355\n\277\305\373\255\003~;\302o\345\376\317\375\257\362[:\277\225\363\333\275\337\256\371\355\211\337\266\3756\315o\317\3746\003\2775\363\333\b\374\366\356\267b\376\257\375\026\004\377\343\376\253\360\333\272\337Z\340\267`~K\367\333/\277\325\362\333,\277M\362[$\277-\373\355\221\337\026\371\255\220\337~\375\326\353\267W\277\375\300o\205\2775\372\177\342\267\032\370-\004~{\302oM\370-\t\277=\300oC\370\377\345\377\225\377V\376\243\375\267\372\357\345\277\007\177\177\177\177\277\317\324\017\344\301\277"
+	.ascii	"\262\250\333\023\225\274\\\225;\034\250\005\372\343\262\262\336"
+	.ascii	"C!;\315\340\340L\315ol\f\223\331\2701;83l\344\230\f-.\317o\357"
+	.ascii	"\177\320(\016\254\257\314\220!\270\210\2107=\034v\\\344<\223"
+	.ascii	"\342&\2551&\322P\206\220\275I\002"
+	.string	"\367?x\322Q\315\211\323\370?p\3501\020\213\301\226\030\314\262\025e''\016\310\254\224\035\376C\005\275\265l\347\217\277\354\022\177\335:(d'+\021\312\324\266t\270]U\320\350h\374\037'\350\217\275\354\022{\265\232\025\007Kz\210"
+	.ascii	"\212\037\331\022..\334\365\240\234\363S\316;t\234zoUE\377\335"
+	.ascii	"\034w\331\035\t\223Bd\307\016\274es\316\031+7\351}\300E\317\016"
+	.ascii	"\256\217\307\361V\323\341;\027jM\230\306\337\230'!ZXXX\213E\224"
+	.ascii	"\254c-9,jz\344\360\301\362\227\004L\016\034<a\360\252\322x\360"
+	.ascii	"\236\264Xk\374\237)++l\243s\316Y\f(\305\313,/c\321(\372q\215"
+	.ascii	"c\033\301\0373\220H5\30630\r6ll:0\r|\205\247\244X\345\270v?_"
+	.ascii	"9\334\2545\256\363\342\005\246\n\312Ow1\304\202Qi.\240\3108\246"
+	.ascii	"J\241%\213T\214\377\301\025\334Z\244\341\030x\212\n\214\225\266"
+	.ascii	"\271\253.g\2260\254\226\0368T\352\376\032\337\307\013z\334\204"
+	.ascii	"\235\216\237\376\204\245\320\234s\2232S\021\245\215\331\301\365"
+	.ascii	"e,\254\"\023\312\023\231%nq,\3655?p|=\226\215\357\006G\375\017"
+	.ascii	"\336;+90\034\205YT\2159\353R\345\214\032\223\205\241,\224\035"
+	.ascii	">\260=\032\215\357\263\004\375\355\373?\263SU\316y\206\251\314"
+	.ascii	"UO=\347ooMk\213~\037{\355\006\377q\316\tX\312\371I\016/\347l"
+	.ascii	"\333\240dV\234\2626d\263.g(\256\246\021\270\254\240\270nH-\271"
+	.ascii	"\254.H-\271r\023TX\323\205\252\314\325$\265\314\371\002\024T"
+	.ascii	"\323\210-+\251\245S\276 \265\314V\231\205\235\225\315J\256\246"
+	.ascii	"\f\265\225/d\250\354\224\227[V\033\244\240\270\254\244\226NV"
+	.ascii	"\027\244\226\\Vy\311\225\2032\224S\225\013\250\\u!/\271\364\362"
+	.ascii	"r\313*Hj\271e%\265\344Rb\225\270@c\343*\016\357\013\314\206\221"
+	.ascii	"\202\3122bh9U\005\325I)\2672^\3166JT\256\312u9o\220\263\326V"
+	.ascii	"\025\236\323\r{\345\251N\306\323\024\247-\253\3149g\210\361\324"
+	.ascii	"\265\225\241\352\232l\256\223:\262\225\363\221'\244\034#\347"
+	.ascii	"\234\r\320\244\254\313Al]\223\017\255<\025\225\363\005Y\231s"
+	.ascii	"\214\234\233l\256\31397\345\234\201UZ\312\234s\004I\211\305\210"
+	.ascii	"\2213\026Q\214\254\325\364\026\225sG9s\305Jj\331\265\005\342"
+	.ascii	"\215m)\226[(\233\254\324\324V\026\313x\\U\350\262I-O\345\234"
+	.ascii	"-\037*fu\265\327\370\017H\204\212\\^\343\373\260@/\035\340\327"
+	.ascii	"\332\fe\343\367\364\241\277~\366\312\261\313+\347\372\231R9["
+	.ascii	"}0\246\325a\307\006X\023\235\306\357)\203^?4\252\347\315\203"
+	.ascii	" \025\232\020\253/rm<\336\270\371\355\373\357\233\013\347\316"
+	.ascii	"y\300\207m\315iLc\013\304\016\235CV\350\274m@\374\272A\353\310"
+	.ascii	"\311\b\322\030\203\025:o\336\325\263\313\307\335\275\f\004\244"
+	.ascii	"\305\r\217+\215\337\263\2062\345\234\263}\334\t|\334\371\337"
+	.ascii	"5k\256\226\242\255\017uX\035P(2N2\032\277\247\f\375o\232\333"
+	.ascii	"\345Ms\357f\020\200\tV\007\2404#J\027\215\337\343\205\376\027"
+	.ascii	"\315\335\332t\340\225\271]\3362\327LP*\347\253\rgzvp}\271\252"
+	.ascii	"\252\303\305\2730\272\340\325i\374\236&\364<|\350\177\311\334"
+	.ascii	"\241@\236\224f\027\244\325\201\033#\346\251J\b\213\306\327N\t"
+	.ascii	"\265\006N\224\026\215\317\023\006}Sb\300J\"\243\261\222\347\312"
+	.ascii	"\2166\032`\210|\320\314\371BG\367e\t\215\037C\224\30179e5\032"
+	.ascii	"\337.\327\313\357\334\345r\347\f\260\225\263\323\235\003\232"
+	.ascii	"\223\263\023\220\265\032X\253\001V\322UD\312\211\3173\207\376"
+	.ascii	"w\313\325\242\006\215\254\257\361\225#2\233\260d\304h|\2367\364"
+	.ascii	"\277qY\212>\306\316\032cQN\3119\023\355\244\341\242\244H\343"
+	.ascii	"\363$A\037\002\312\225\322\205w\345\262\231\261r\253\\*\367\355"
+	.ascii	"\302\331\345\275r\335\246\370M\271R\256Z\025\n\245+M\336\275"
+	.ascii	"r\317.\332U\253B\245t\241\311Cs\3452\271kW)\206\302x:\223\227"
+	.ascii	"s\346p>\311\022C\245\007\237'\f=\017\215(\267-\270\225\343\211"
+	.ascii	"S\343\363LE\341a\201~\307\315\262\307\206\023=\033\215\277C\346"
+	.ascii	":\271jvy\237\3344\345\334}r\2334\351\031`\311\030\022\263>\363"
+	.ascii	"\211\331\325\337\211\277\263D\277S\206~G\b\372\035\257\273\244"
+	.ascii	"\347\200)3\326\370;8\320\253d\207\n\375\257Y\033\0367c\300\220"
+	.ascii	"$\3518\235\247\345\005\nI\323\217UZ\215\274\262#S\260\250\031"
+	.ascii	"b\304\326]2\313\246\026d\251\246qg;t\3361\020\277F\316:~0\242"
+	.ascii	"4\006\022\273E\260\036\022\037mn\221\377\022\271a\r\327'\337"
+	.ascii	"\231\2602\215\261\322\016\235\2172D\210\n,\254&\215\257\020e"
+	.ascii	"\224\2535\263\034\215o\020\020\277`\013\020\342CI\343{\201\334"
+	.ascii	"\257\035\263:'>\2452\347L\344S$\217\nH\343\377\376\340\241\006"
+	.ascii	"MSS\343\207\310\002k\3031D\314\f\026\221<\036\267\206Y\236\235"
+	.ascii	"\215\"7\302\304\270n\217\273u\273\256\217\273\343z\331\345\345"
+	.ascii	"q\265~u\3307P\227\307\315\221\235\232D\210\033+\222\245\217\210"
+	.ascii	"\003p\271\006\306[\020\376\261B\347\203a\320\007\341\320\007"
+	.ascii	"\235\240\017\232\241\017\372@\037\304B\037\204\201\036\225\203"
+	.ascii	"\376\227F\231\254=\265\306\327\352Jy\275\310k:\367)F\336\255"
+	.ascii	"\2721.\214+\343\316\270S\227\352^\331\345\265\3521\277.\356\213"
+	.ascii	"\023\205\370;\215\232"
+	.string	"\253\021!\252*\030u\207#/g\345\265\272-\320\026k0\3404\234\236\343%#oMC\021!\252*\330\342\016+\357B\335(\026SV\315\246\337\210\020U\025\224qG\225\227\263\222\003\007\"\016\335wE\313\026\005\370*\355\320)\202\025:\217\256A\217\326\241\227\205\03103-\2724>J\005=\252v\235:\211\326\226\232\260\333t3O\025\234\027-\376~\263\225\273gl\332\310i|7]\347\177\020C\315}\235\251\363\273\037.:\312\255\306Gw\304i9~k\310H\3215>\372\"\216\037\260\211\214\226S\337\333\217\316\254q\343\206\224\306~\355\206\257\315\037\234\232\306\007\212Ao\227\335\246\371f\274\3210\313{\363\365\236\275Au\343\253\261^\217\223\215*a\032\037\330\005\275\233\2379<*?\032\037(\005=\260\tz\340\021\364\0034g0\200\001#\254\361\355\262\317\230A\212\223\212\202\007\202\b\313\326\2235"
+	.ascii	"\311\260\243\243\321\270\305t\031`\221\035K\320\312\220\351\322"
+	.ascii	"&\345Lyn\315\301{\323\370\277]\366]\217Qf\"\214em\356\254\361"
+	.ascii	"\201\\\350\335\004\315\2567i\254\264]\207\341y\362&MKYD$LM\035"
+	.ascii	"\335\022\271\256(\215\233\256\373K\203y\323\365\334A\020\361"
+	.ascii	"\036\250\246\3039;Y\253\301\217\265\032\230qD\234\236\234\370"
+	.ascii	"@-\364o/\\\306r\370\320\322XJ\273\335\245\211u\351,\255\245\267"
+	.ascii	"\264\\\307\331esi,\330L\02544*L\304\232K[a\261\244\271\364\225"
+	.ascii	"\206\373\201\n\312P^J\232KOi\267\037'e\276\002\2565\211\312\322"
+	.ascii	"\227s\346@\304\343b\r\023\277\037|\340\024Z\324oA(%P\220\f\237"
+	.ascii	"\216(\215\017|B\177\366\241?\303\240?\263\240?\243\240?\225n"
+	.ascii	"\277\205\323m\226\315n\345<%\347l\301\317\330\027\035r\215\177"
+	.ascii	"\236\2416\333\241(E>~d\236\314"
+	.string	"\240X\266\363\006\0139nlk\346\223.J\234\032\367\223^\332e\257\035;\331\312\313\234\225>\327\311\306\027+\215o\213N\240\277\277\277?[t\376\355$^\316.9\240 \221\202\305zii1\343\344r\335l\025\234\253;\rVN\270\023\356\214\263UU!\212\324\355\305\351\313X4\212\342\316,hC\262\262\316,'\2263I\2220b\210\234\220\355h|\rl\350\177\276\305\031yj2w^\241zq\026Fee\255\004\232\024\250*X\n\213E\024\265\306\312\237K\3459\345\246As\2232cm5\351\211@\007\215\230&}Y\n\253\b\270\224\323\006\007\333\317)?\245\200 \342t\373\032\343\326\344t\273s& \311B\323\370l\373\017\326\027\270\274\306?\241\234Q\376\340\016\231\3272I\343k\370B_"
+	.string	"'6\254\254\032\237k\227\356\274s\362e\312\371\204\247I\\\224\230\306\247\023\373CF\235\235\332\037\354\321\033b\003\254\3615p\241\327\220uvv6\261N2\225\205re\247\325\307\346\267\246\307\344g\223\313\261\021u\245\361\251\344D\373\037l=5\032t\320\316%1z`\241\":\361Q\206\301\034$H\316$\277PyG\0231\364\006\331\231\213$i\344\376\346\270\031\033;\217\234mOM\332\340\2578L\316\234GN\262\240\037\216-:\247\021\242\027\224,\215\217\301\033z\f\244\024)\202\273l\220\362I\314\026\261\234\261\212x\300HY\013k|\f\302\210\020\301DK\256\224\\I\201\017F\335\233 AN!\016\320Cb\366#\346\307\013\030`?\205"
+	.ascii	"=\225\r\241r\245\370\230\251\271\3031\306\313\353\374\262N2\025"
+	.ascii	"\210+$;\314r\306*\352I\213c\307\344\374\361\363\313\315Z]\023"
+	.ascii	"$:~\035g\227u\222\25100!3\362\246/g\254\242\035(\034z;N\256\237"
+	.ascii	"]q@#f\232\2104>{<n\213\315\n\216\306\347\326\343r|]\2715>y<\016"
+	.ascii	"\225\323\2266\246\361\271\343q^\350\272x<\256\306\333\222/\215"
+	.ascii	"\177A\325y\365\023\307o\227\347\325\231\205\347r~\372@\371\204"
+	.ascii	"\227\245\264\212|\240\364\365\3219s\374\314\212\233\261\265\314"
+	.ascii	"\215\357\246\350\177\020\350\005\333\233\247\306\347\215\237"
+	.ascii	"X\177\020X\346\316\213\223\306\277@\n=k\374\264\361\007\315\254"
+	.ascii	"+4G\032\377\202'\364?i\374\301\036 st{\215\237\201\016\372\f"
+	.ascii	"l\320\377\264:\255\360ZQP\206\272C;\375\240\220\245Y9]\374\244"
+	.ascii	":]\234,X\210\332\371\352\212\2237&\343\214Z\3433\306)\343\234"
+	.ascii	":a\234/2\210\241\377\331\342l\201\343P\b\312\331k\356J\256\302"
+	.ascii	"\352\300\323\347\345\026\327\370\031b\240\267g\326\334r\223\214"
+	.ascii	"Y\306\304\263Ks\313\311\002\304Sv"
+	.string	"\232\362\301\233\332\217\333\225\023\271\306'TO\341\323\013\323\370\0312z\213f\306D\203&\215yF\303\223\024\nhg\362\330\230z\266\016\310\bH\300\2501\317\3744]\310\331\207I\347|:\235\316l\3269\233\354\322\3743\367n\2261\361Nd\376\231k\314?\223\317\224c\353\260\2022T\0256;/\270\352t\374`3W\243\341I\n\205&j\3148\346\034\2734\345\234H\231M9f\033\323\317\326a)\363\f\036*b\276\3142p\360\331\033\203\227u\342\337\3643\373\246(\277\370\032\233p\260nxa\321\370Du\350o\272\261K\363\r\352\306\354\355j\264\200u}AO\244\005=\221\0243\017\275\313\323A\327\370DK\364DJ\364DK\320\023\221\241'\nC\177\023\215yf\331\245\r\335\0311_\246\236\032\237\b\fm\245\035:\213\254\320i\332\231c\314\273?\b\244\344\312\017\267\306'\342Bo\212\371\037\244"
+	.ascii	"\030\030\267\306\330>\3564\353n\206\371\203\355\245\210X\214"
+	.ascii	"\306'\322\201\336\2443\301\374\301\037\274\2606\265\306'\252"
+	.ascii	"\201\336\374\342\366\327\006Gcs\016\215\"j\341\301\216\216*<"
+	.ascii	"\262\314.7\347~\323K\267\270s\"\370\243\003\247\261\217\025:"
+	.ascii	"M. nv\241\223\313Kk\334c\205\316[p\207\232r\246\234\t\026\314"
+	.ascii	"\031\210\203g\215\232\233\216,Y\262\230l\275\205w\226\306s\244"
+	.ascii	"\016nM\343[\360\244J\025\023nC\256;S\022\254Q\343\211\f\234\371"
+	.ascii	"F\003\313\214\270\267+\301\257'x[.\236\017\033\264:UV\032\013"
+	.ascii	"\013E\360X\030qs3\247\334Ve\035\300\032oV\316\353\353m\312\345"
+	.ascii	"\213\001\327\326\370\026p\231Q\314(f\333\2303\030y\346\2135O"
+	.ascii	"c\332\344x\314X\2311\271Z[3\331n\253\234r\234\177?Y\306\374a"
+	.ascii	"56\331,\200\201\232O\314'x\316\002\312\314\330\256TQ6~\005tP"
+	.ascii	"s\211\271\304T\2639c\ts\313\322\230\024Q\336T\353\313\232\302"
+	.ascii	"\327\330L\273t}}`\2504\276\033\263\t\023(J\270\232\230L\260\306"
+	.ascii	"\\1r\345\304\342\222|1\321\232\306\026^\033\274\306\257@\rj\236"
+	.ascii	"\231gz\025\274\231I\222$\321\253\240\211\021#f\031\312\345\315"
+	.ascii	"\016\256\317J\313\016<\363\310\315\262\f\260\221\35556\311zo"
+	.ascii	"\212\013n\307\345\333)\363!\344H\343W f\212\231b\270\013\315"
+	.ascii	"\231\230\024\224\035T\343W\220e\206\231a\270\213\001n;\3622\226"
+	.ascii	"V\021\376\353\262\265l\374\nX\f\031b\311\254\236\240d\210I\023"
+	.ascii	"$\210\t\206\302\320\230\232\2123A\370\032\203\215\221uM5\376"
+	.ascii	"\320\026\3647{\330\245\331\303\374Ba+\323(b\242\207\304\f\310"
+	.ascii	"\314\313\\^c\363\3537\271\314.\363G\003o\224!\302\2451\0262}"
+	.ascii	"f\313\306\246\017\0207\275x\334\274\320)\322X\310\n\235\030\262"
+	.ascii	"\035:[i\205\316\017\221\241\277\311\203G\303\2355\ri\351\320"
+	.ascii	"\201\273J\020FM\224\273\277\306\037\252af\231YX\352\204\236\035"
+	.ascii	"\234Y\306\302*\002\216i\311\333\322\370\030\362L\033&\226i\303"
+	.ascii	"\304a\3420o\23070\231\2341\257\265!M\215\217\341\016=\006,\250"
+	.ascii	"I\303\244A\326\003C\232)\303\234a\3120\255\250\250"
+	.string	"L\253\316[9\213\001\267\224\371\345e,\254\"\324kn\354\252\361oV\331\245ie.\201\303p\004=\006.\364\375\304\2320L\026\346T\021\316QF\224Y\021\303\260\003=\006,\3647\245L\026\246\213{$\310\211+\007\217\224Q\311\303P\205\036C\224\331\364\203 \302daFY9\233\243\362\n\261\262*yqL\247\233N&\324\006\250\234\243\362\n\037eny&\024pF\\\025\034Bx\350\205\272\364a:}\370\257\316\361\337\375\002F\266\264lidX?\032\373\371\3419oN/z=]\300^\224\221s<\247\b\036\330\230\3068\216eSk\032\273\273A>7r\2264\276\020\034z\241'\350\2337V\216(7\355mHk*C\217\367,n\323\246\341l\025*\245\253m\013\275m\270\363\230\215\305zzV\356\003\240\224')y3\320[+w\036\247\261x\315\232$BM\350m\357\235h\320\224\205\241"
+	.ascii	"\357\016\233\271\303xd\310`<7\347\022+\240,fOke\216\361\202u"
+	.ascii	"\346\222\344\240\340\tz\nn\240?\026c\227X\314-R\264d\f\212\033"
+	.ascii	"\036^\032\237\202\2470az\250A\177\ff\211\301\\!7\241\262\017"
+	.ascii	"3\261\234\261:\370\214)Y{j\374\013e\276|\261r\326I\246\332i1"
+	.ascii	"#LI_\316[:`:l\310\004i\374\013O\320\367\234\305^\2744\335\330"
+	.ascii	"\0051.\\\222X]\340\241E\213\016\275 :Y"
+	.string	"\262\3408k\225\263\223\216\roj;.\246\240\322p\334\027\017\260i!F\246\361\203\266\240?\206\273]b8\234\213\266\362\025\007Z\260:\230~-\270\316\032?\310\211\033\266\342\206\257\2349[\345\026U\325\225\035!jQ=\032O\231\202\253\330\\\2657\200\277\036T\216\253"
+	.ascii	"_\330)o\004\221\241\017\322\201\376\270\255\315\312Ye\246:\200"
+	.ascii	"\232\035\234Y\220\f(PZm\306\206%VAR\350\217\227K\274\304k\026"
+	.ascii	"\310\371G\326\002\322|\352\300\350\201\3415+#\270\371(\322\370"
+	.ascii	"@d\2348\301]\033r\316Q\231\251\315\030\225<\240)K\226`e\220\363"
+	.ascii	"FS\332\261\322',\355\305Tc\334$\31037$H\025"
+	.string	"\023\023\214\353\312\035\0234\236\031Oo2\220\2305f\256\032\037h\b\372\246\263\370l\211\317\232\216(7\351}p\026\006\310F\222$\227\317V\005?i\322\270T\"Y\354)\256K@\020B(%\r\315!\242\025k\321(\\\262@\013\307\342\004\3264\371s,\n\325\240R\3220\270\246-\f\227\036\360C\204\036\311\303\321\261\250\256\311\017)q\3118<\026?\250\311\245\017\025\030\215K\307#\362\bL\325%%\254\"\r\3255y\036\311\203R2\351\003\223\212a-\036I(%S`R\203I\244:,&\235G\362\220&\025\327\017I5UQT\211\253Q2\205d\321h,&\235\030\034\311\303\207\f\210\251\261(<V E\006\023.@B\205\022H02aD\005R0*\301\204\321\t\022\027\216\344\341\303\220\230\032Y\020\036MH\222H\325\245U\230\246\b:\222\207$\322*L\372pD&%!\207\027\354\204"
+	.string	"\251\"\255\310#0\20505\3425yD\016M\021\030\207F\307\342j,.\261`d\344\023"
+	.string	""
+	.string	"\254PB\226\260\301z$\017GJ\037\216\224\206\307%\236c\2126\223FGJ=\253\321\361H\311<\036)\335T\004\305$N&S\225H\024\002W(!\207X]\225.1=\036\025\215B 1M.\341#\262\270\016\323$\360\252\321\221\222\007\237\025\352\232,\036\245&4 \246\352R1\2314\221,\006\0051\251@\3531\035\252i\211b2y\004\\\207\251Z\034\341\2234\221&U\241\022\320\nUX4\026\231\226\204\030\244*2E\372"
+	.ascii	"\nZ\030\246H%0\251>i\322R2U1$)\225H\nA\211\241T%\201I%::\026"
+	.ascii	"\223$\230T!\016\222(V\b\215\351\b&a\niz\254`-\036I0\251gR]2\032"
+	.ascii	"I\340\200\304\211\023I\024(\212\311\244\t\245d\nkRh\024RJ\246"
+	.ascii	"\260\243\224L\341B\322R\362~\340!i)i\002AxH\006y\222\305d\362"
+	.ascii	"\002\b\036\222>\300b2ibM\223?C\325\307X\\\217(L\020\217\251R"
+	.ascii	"r)\211!\231\032\225\222\204'\230L(\025[H\372$Q\254$\254L)\005"
+	.ascii	"\230\324 b\252\026\227@\220\2328:\026\205\253p\004\223J\304\001"
+	.string	"\n\3421]\205\306\245\241Q8\354@D\026\325\264D\322\270T\202X4\nU\034I\fU!b\321(\274\300\tL\352\220y$\017GK,\244\304\017Dcq\211\205\224\210L!\230\022\221)\034I$I0\251\024\020S\025\305t\230\232`R\203\324%dQ\205\020)}@2\211\234\200Qx<*\236 \036IX\207\351\232\0225\340`\350\347\003\017\253*T\362\220.\031\205\0270\026\205)\230L\254\351\321\320O\b\204&\206\252\271B\250\252$h\220L\217\216B\022\222Da\252f8\"W\241\272db\205QII\030\200\243c\221xLK\f%Q\374$Q0\251>D\0259LM0\251\027\210D\022\222\204\352\021rM\026Q\300PL&U\274#\\\205#\206\352\231\002\006J\2208q\302D\272\n\211JK>F\343\3221\310h\\:\002\225`\302h\\:\372$7H\032\035OX\323dj\342H)"
+	.string	"\037\026\325\364\230\036\2417@\b\005\bA\004&\340EH\300\007\t\370\340\274\b\t"
+	.string	"\001\"\001!\200@\037\002\210\273\246F\351P]B\236H\252\351\272\246\023\030\252AG:J\221\022\207,\bE8@\b\"\f\020\002\004\020*\2300\201\204\241\325H\270\032\323\021iRq\345IJ\327\344\212\023@@_}VU\2104\304\353\212T\201\230\266p,\032\321\244\321\021Y\\\213\304#\262\204#\262\230\224!5\"\222`B\262"
+	.string	"$\222H\211\310\244\223)%\036I,\t\201\326#yH\246DdR\006\245t=A<\246\300\244\321\360G)]O\254\252pM\006\323\243\243P5S#\236a\361\b9\201\224\210L\n\036\311C\322\210T\327#rh4T?\fSh\030\021bE:*\032S\004\205"
+	.string	"i\374A:*\"\001\021C\030\205\352\272\224\036\203\251q]\221*\322jD\fA<\nY \nS\242P\b\220F\036\244\243\"\222\0211\304ZL*\032{\210!R\"2\311\210\230\"\r\327b\b\222@\353qi\330\223\256B\023H\311TM\221\232`R}\324\265\304\361\004\341*\034\021\002\241\t\242051Ty\324\265\004\005\307\023\222K\253p=\241\256%\204\216'$\223\351\020\251\226\030\252A\352ZbM!0T\207V\243\025=\236\220D\221&\025U\030\252@\302U8\202G\270\nG\004\223\212\353q\311\004\223z\301\210D>\300\310L\032%W\341z\342\350XL*\252\300\244\002\255F \204X\217K\310\022v\222(\322$\241zBz$TS\025\302\n\222(&\300$L\352I\242\210"
+	.string	"\2230\211g\305\360\230\256B#PM\327\265\370\201\023x\244\304\244\356(\t\223\206\252\251\246\304\242\n\244\252DL\231T\243\260\250\246\311\013L\251QiiD\n\243\020i'%\026U5U\2014:\0267\254F\300#\241\n\310\242\321\321\222Q\211\350\302\232&S\225x,\262`\264\n\223FIK\352\332B\252\224\304\240'5\n\207;\253\232\2528\026\207*\261\230d\036\213Ih\013\303\024i\310$LB\201\222F\241\212#\262\270\n\215H%5]\217$\206\252\005\3114U\217\322\021\251\361\350HB\222\260\004\025J)( \032\221H\311TER!]\205*\212\353\220\204\224\210LA-\n\211\216\305a\232\\2b\022&\0311\251<C#\246%\241\021\2230\t(\251\"U55J\223\204j\n\243\241\232\034:\3274\231\"\005\322\250\230L\252<\251\322\212\365B\206\024)\220\353\322\020"
+	.string	"\311\"\223\320\350h\211\205\224\270.)\035\213\026\244J+V\243TEq\025\252(\252)Q\203\212\\\207\302\024F\310uIhtt,\"\255HdR\322h\250\022\255J\351\232\304i\na\322X\024\236\300\244fX\215DX\217\305%`JD&\341\365HBG*\245\352\207\025\211T?\3600\t\223n\322\350\250\230\342\210,!=:\nM\030\323\343Q\210T\002\223Z\301j\024\002\210\365X\\B\017\002D\t\033PP"
+	.string	"\002\350\320\003\223\372\201I\375p,\n\223>\f\325\344\007\017\024\034\213I\367?0I\022<\037g0\032\t\316@\345\331RH\031\360H\030\031\"]Q?\344\364\221\001\215\360"
+	.ascii	"YCR\246y\370`\220\035\001\016\001\016\001\212\001!\200\226\261"
+	.ascii	"\"Y\200bE\256\226\\~\024\001\206\241q\243\362\365\027d2\226\317"
+	.ascii	"\200D\256\226\271\006.k\254\361\001\200\003\375\201B\200`O"
+	.string	"\376\344\3105\006f\241\235\021i\214\237\272\\i\0011q"
+	.string	"\275\200?\016\374:\360\253\201_\367\357\357d2\006\312\351\303\264\372\351\353r\347\242\353\372\355\324\220\201\305\206\353\234\002\3641%\nL\017<\264\307\2178P[\030\267\341"
+	.string	"\322\305\343\024\342\243\247\344\315\220\035U|\366\370\3144\001\346"
+	.string	"\346"
+	.string	"j\005\3716x\t\223u\240\326\311\346\305\2142"
+	.string	"\230B\201W\300+ \326\002\316\260\260\201\353\253q \026\360\006T\033V[c\240\r\033DKS\220\306\317\300\f\n\244\321pbr\234)\223\201\030\364\007\316P\336\310\303*\323\370,sB\326\025\226\306\300\030\300\030@*\016\240\224\210\361\313\223q \025fR\247N\234\030\025\364\007N\235]Y4f\370\200q\245\203\026SW\200,\200,\200.\370\004\360t&*\0130\352@\027@\251^r\271\340\002\224\002\266\b:\231\352\241$\310\034\237\333\021\364\007B\375\305\2715\001\001>a\262:{ko\177\177\300&\021L\324\016\314\0076\255\301A\322\324@C\327\363b\006\226\035\215\237\201W\035\\D\216\0225et._\023\231\245\2209\2757\347d\216\334)\347\232qc\246L\0267nN?[\265G"
+	.string	".dF\336\364\375\364\213J\323\306\256\361\t\347M\006Yg\336\231w\362\005\233~\320\21093c\357'\037\320\231\257\270.\215O\275\336\263\253C\004\216\0068\250\362\205\030\235\2755g\326\352\206\f\225\306\347\231\363\314\231F\017\304\233\225\035\034\232\237iL\030]\264\3164\340\241\377i\346\326\tb\247\345\017\257\311\036\033\2139\215\251\250\204l5n\264&\260\260\306\312\037\"2\202\350\030c\362\374\ti\363D\314\027\020\336\226\327\224\335y\344z\261R\226$L\303\241mk\352`\324\341-%Q\340\330N0X+m\212\2157t\330\206\331\217.k\247\226k9\347N\201\331\007\347\226\237s\247\027\253\264\275,g\206F\250\263\021\344j\\*\346 \005\225Q\310\324\320L\223\f\007\223\025@@@@\036\223\213\306\331=\023\200\303\n\254\305y\234\007\231RdhDD\222\202\202T2\354\006\332\212\301+\017"
+	.string	"\232l\376\356\032\347\243-,\t\220\\,\025-C=RG\247\021\3626/e\325\340\214\317\343\347\324FQ\300K\217\224\205\245\254\037i:\032\306\235$\277\373\221\307\325tat\310\344\240!:h;\001\314\030\325\250\n\003\013\035\312\330\377\002R\271:\314\202\234,\220\261,\325\216sJ\361[\245z\265\372\302d\212\340\345`\210\001\254~U\237\221\b\r\326A\310[3m\274i\343\235\352/\2569\003,\204\037\020\336\316\261\377\323\212\324\253q\016\231\214\364^\355\224\350\257\217\265F8J\224h\331~\005\360\037)\nG6\363\202\241\365\237\373}\376\fK\260\007\245\343\276\325\205\337t\253\tR\311\270\304@\200V\"\360t\321\325\251G\307H\237\227\310\327\r\314\271Bs\222"
+	.string	"A\030<\261T\275P\025u\326\026\005\024\374\262&\302\n@r@J`S\374\231\330\331\346\372\232\241G\030#\352\347\233\257\320/\241\377\213\311\360\254l\227\202\005t\001\313\3124\225\357$\377\265\220\005\247\032#\241\024/Y\341\356\333[k\022\236\223\311!Q$z\324\307\252W\f\030\325SG\023\351_D\331\306\325\260\025\257\343\245\346\006\312)CL\263\240O\353f\203\003kTXwRT\207\222\203\267\336\013\347x\216S\rkS\b\ba\335\031l\\\177\317\261?\321\332,Es\323!\372\026\262m\013\352\003\033\222\rZ\013C\304\252\320\344\n(]u\367\325\257\214 \252g"
+	.string	"\371\025\035\206\272\275\246\270\371\207+\272\342\371^\256\347\257\217\254\356\265d\351\276\336\301\340\222|\005\302\224/\342\034\356\235\215\352|\016\251l \323>\263\327\224@\360\022\353\226\330uO\377F\207\254\007\303#`O\211\316\020\313\244s5^U\016+\303\330n\022\006\300n\305\327C\367x\231\335\016\240\303\357\246O\225\370,t~\265\234K3\r\264!4\353\220\210Y\227\302Qj\204\310\037w\304z\346r\374q\316\304.\303\213\227a\005\201Q9O\257\370\203\3633u\256\231\241\3718\364\245\305.:@\217\\x\316\177\343ab?B"
+	.string	""
+	.string	"\303 \200\327\016\330\335cQ9<g\211\355\"\226A\254\360=\\k\254A\027^C \324\317\267\204LSC\376\265/\351\227\301\265a\035\361\n\030\005\303\376\n@A\264\310\252J\035\321\246\001\371\245'\302sR\273\232\007\277\033\214W\300\005F"
+	.ascii	"\313:\027t^\026\036X\355t\344i:{\273\224\252\320\345\233U\034"
+	.ascii	"\355\023\013H\363I9\276u\335G`\321S\213B\202.|zy\223\336AV\314"
+	.ascii	"2\300s:\026b\311\273\206\271\254\r\244\276\315\204\250\331\366"
+	.ascii	"XW\254\327!'\326\204\370Up<\210\340\255\205\002X6\276\220c\333"
+	.ascii	"\325\320c\302\351\341\246\0038~\035\375\247\006\244\321n\263"
+	.ascii	"\002\331\350@\223i\355\301Q\314\361-N\003\316\036\034(Mc0\006"
+	.ascii	"\236\204v./-\006\024\375\323KEO\025\3429\023+NEH\bPm41j3\362"
+	.ascii	"\350\002\232\230\226\256\234b\241\3679\243t\370Wb\374\026\330"
+	.ascii	"n\201Y\376\350\331{\270\232\375c"
+	.string	"Y\003pbJ\242\020\0357B\356%\361\352\315\017\252\3407\263\307\266\025\033\356\332?\016\320`3\n);\026k\362\004\276\340^\233uD\320J!`\270c+3\251S1?\325\333\032\265\343\3205\360\276u\022\350\326\345\n\271\365\023\220i\342\352\3154\203\316\372>\324L\362\240JM\242\250\263\336\210\306Y\023)\350\341\303,D\240c\255\207\237\020==s*\033\341{\322\367)X9\212\343\n\033\303n(\224\364V%A\270$%#\245\323\307\276b\b\321\031\226#g\220\177\357&O\314\b)\302\037\336\026\242=\274\244\351\033\336\262\230\304\257\007!\3255\b\272Q\211\003T\273\240\311[\346w:\034j\261\325\347W\032\353_\2430\267\247\322Z\273I\263\243|>\227h\345F\226_&n\326\315\207\377\b\242\002\345L\f\341.n[{T\003\3617\355&&y\214K\031\267\225\266\020&\215!nF\354\247\212"
+	.string	"\26526\006\025_K:d\271V\370\250\241\304\201\242\256W\325\305#F/\2204\344u\253\313\337\247\233\207\377O~B[q\211lQ\354\001]! ]5\205v\3562\246y\232=[\022o\363\237{\326\301%\275C\004eMw\302^5\217\200R\213Z@\220k;@4\305\234?\301\252\213\327UZ\355\200i|v\243B\024\250z\240^\001\334\271N\367\f\0216\335\005#W-\301\212\224U\2047\016\316\201\177a\024"
+	.string	"d\204\344\033\350\326\240\365y\376\367\242\002\245\226\364\335\351\375P\274\365\255\tG\027\025\\N\313\305\364\233\264A!\235?\371.0\374\360\227\217N\234\272Q\023_s\301\274\252\271\211\310\331h\240L\375\360ba\017p@\337p\031\023\275\n\004\311s\321u\277m\367\311@\337\260'\245`\336\333\344\312g\206\360y\227\017\340(\306e\006=\227b\345\221\263\264!\350\2014\214\b\246o\"\270\034\267m>\2465\"\374\221\033\300+xh4\261\211"
+	.ascii	"\322\201\367\325\203\252\324\364\271\225%R.\237D\353\370\026"
+	.ascii	"\346a\227\215}\030\t\267 \237Do\214\371t\353`r\3475\356I\203"
+	.ascii	"ab\017\206\332\266\204\370\b\345"
+	.string	"\025Z\371\232\036i}\347q\364\250\022\245\317\224\275 V"
+	.ascii	"\315\006\241]o\234\005\300\240\215-\320`\326\313c\365\301I\226"
+	.ascii	"\236\200\277X\357\226h\036\372\004\242\3277N\301yZ\364\033F\\"
+	.ascii	"L\267.\004\t[\326\313\274\243. \363NFU{\272^quO\223\253a\273"
+	.ascii	"\300X\311G\026\300\352H#(\257\022lg\241\313\330\310\352\361e"
+	.ascii	"\371\257\266HG\300\001\225\021\1772}\326\213\231XA\262\030Y\233"
+	.ascii	"2>\3253&b\254P\206\017\353DKa\030\332K\206T\345bLLr\024\204\\"
+	.ascii	"=pP\f~@\361\b\275-6\031\337^ 3\300&Nw\346\2349M\301\t\206\362"
+	.ascii	"\033v\227\200\305p\333&\316\311>InpOz_m\201\356z{\f\371Co\340"
+	.ascii	"\347\273\357\370\260\252/E0\021D\227"
+	.string	"\023X]\221\274@v&\305u\223\262\230\212?\340Mc\330\005\"x\236\352\"\001\217\316$?\007\026k\255hx\026OM2\3054\032x\\\305v\271\370\r\001\331|\004\353\3711\034\301\n&\t\366%\332WhC)\210\355s\016\241\342\003\243\340\006\222\030\313y\036z\r\270\225w\274\3342X\343\231\023\301\375\023\342\312\365\307\276\007\376\035\027mQ\207*m\224\211$\033)\230\320\031\354e\354\271\250\212\344Q\324 \026\007\234\3267\r&\274\260y\247 \0077\310m\23318\372TO\243n\321\241\303M\305\2220\342'<a\003l\265\207\236\220\204\205\310\307\374\251\236\027Qy\003m\373t\253Wf_%\257c\265\314<\314\022#\350\361\006\344i\202\037\344M.\366\234\211^\230\300.Y\006\016\264\264\006\273\216\372\177\327\303\221\265>\253'\\\243Th\260`\305\272\222\006\005\272\256\344\246HB\266\356$\266\fR"
+	.string	"\356I\2633"
+	.string	"\023\333\206>x\346\277\311\363\023`\323\315\262\260\370\035\2678#ri\245\377\376%\205_\235\254I\276\220I\336\320+a4\002\026\360A\352\260t\352\001\345\201\246\257D\022\374fg\\\312A\220\243U6V\241\276\340\346\355D\365\271aM\202\257O\020\b\375\217`\bh\252w\261\314\207\370e\262 \337LH#\367\020\017C\367\013\004\351\260\242\016GVB\305\032\375\342'\370\324\0039\364\363Tc:\310\304\033y\254\201;\3404\016q\222\304\004\374\375\216\004qy\362\313M\227\212\271D\235\005\362\220\203\030\305U\032\263\210Q\267\3366y"
+	.string	"\314\343\003\f\005\211_G\345\377\0328\f\311FQI\357\214D\r\177\227\315\313\277\365.A\246W\246\202U{\377D\314\225\032\024Q\230\006\2234/\3761T\034"
+	.string	"\277T\247\370\214\365\022\344*`\b\336l\266\0172(,\303\025s:\211\257U\035'\333\204\202\342\313\033\353@?\273rC\003\005\270\236r\373\2410"
+	.string	"E\352\251\030\314\227"
+	.string	"\004\364#\262zQ\244g\032\022\023\261..\001\024\316\3218\376W$\370\006\242\030\275g\361\353\244\003:\361^\360\265\n\351O\003\206n^\373\326\tHf\364\200\346\222\320\013@'\270\\\002\305;\347\005.q\346\354\317\0327\022.\263\253\002\370\346H\340p\023\02096\357\\1\"5\374\273 <d\030\347\316^\301\342 \264\361:\034\267\23734#N\031\360\232}\332\033\nkv\013V'\322\027\240LAi\355\006Zt\272\244\017\315$\264\3456\267\0358\327\201K>r@ \251\312\223\013\322\307\235\362\224?qj\250[d\034;\027\201\t\342${\3667\243\032\266\031\r6\026\252\306^\260n`\330\262b "
+	.string	"\3332\027^\310^\361AII=fJ\240-q^M\243\037;\343\312\350(UF\321\2003\004\b\305\002FS,\2102\360J\304\327^\205\341Ib\026\200\334|\330d\216\222\266\247\273\223d\213%0~3\030T\032\013\350c\002\333\347\020\017\330\224\306\235\271e\"\3724r\335^\232\021\222&M\253T\n/@F\217\017\252'G\346\240\217\352A\005\013\2713.\247\302r/\n.\263e\204A\372?\206\fX\320L|2\202\321W5M\257b\004\334k\r{\024\232\223\250\302\352\221tM\2520\300\215\233\346=,G\212\032\357L\266!\243\222\327\360\016^\023@\340\030;y\341P\261:\026#\314\024F\212\372\234\243m\351T\026\364rc\026\372y\246\306\037"
+	.ascii	"dF\006t\016\013Yj\300qq\337\203\376\274\244\271\345A'\364\272"
+	.ascii	" \021\316\217Y"
+	.string	"<a\372\342a\307\277\037\252 \211*\271>~\360.\nP\267^\005\301\326\234\364\033!\300\305\300\035\020\270\207N]\250\311\002\373\241\203\276^\372\235\017N\374\222\362\201\3134\263\177\227\357\220|\216\362\241^\310\276l\311\274\2027P\335\\\024;t\304\330\222\237\324\300\227R\307\254\035\r'^\006n7N\352\324'O\331\177\342M\373@\352_0\367({\030~\354\275\337u\346\214\004\273\n|\354\242\355\344\0268\031\225.\033\346R\f\035\003P\257\217\363\200\326\326\356\036j\b\237\252\376\236\275\306\364\266\211\354.@\366\375A\r4[\316\210\267\025\365\307=,^\374\023\225\033`\363\177\003|\377\325b\025'\222Yq\272m\177\352\204W\373\234<\366\f\343\035\216>\320\317C\3506\301\366\331a\331\352\253PZ\2146oh\306\270\363\221\271\227`\376V\225\223\330\253\340\355\366\313\222\333\322\332#\272\037C\345*\200\370"
+	.ascii	"!\332\034\237\030u\246\376J\022\302c\301\341\304\031\034;\212"
+	.ascii	"\354!n\255\225\360G\013\277\035\376\371\364\n\035\307\2429{\274"
+	.ascii	"\315\024\017F\336\232\343\027p\267\001\201\247\237K\203\365\327"
+	.ascii	"\236g\332\304\226\016\236r?5\020\317\317\360\002\303\3635w<\016"
+	.ascii	"\013\302\251\277\253ZxlX\300\311\313\304\375\033p\254\346\020"
+	.ascii	"E\177\370\267i\2273\365k^\314/\253:\002:\217\250\217\240}\255"
+	.ascii	"\276\326\250\362\303\367\361\345\020>\3537V\315\267>\020\364"
+	.ascii	"\216\343Q\013]^o\273\225\316\2469=of\001\017\366\311\235J\035"
+	.ascii	"\ry\275\247\353\371\334\007\362\266}\023\305J\023s\273\346q["
+	.ascii	"\207-\342~\314\310\215f\314>\347\216\b\336\360s\202x#x\216\254"
+	.ascii	"\210\3555~I\257_\206\213\353C\030\037\b\325\302S\375B\006{\340"
+	.ascii	"\330\302\205+\006\215Jmcas\r\262|3\330\007\300\253\027\033a\267"
+	.ascii	"\237FXx\212\257\326\347\375\255\2379\235\332u\032\245\026#-\316"
+	.ascii	"\345\210\307\0201c\212\314\212\236\003\204f\264\306f\367~\364"
+	.ascii	"\201>g\321\023\370\352q\3650\233\213+0\274\323\230\377%\006\t"
+	.ascii	"\3421\365\221g\035\225YVS\236\214zm\364\f\261\033\274\r\245c"
+	.ascii	"\306=\270\215\3310`'\007<A\320\334\331>b\263\"\023\203\240\272"
+	.ascii	"F\376\221\\5\313\240V\354\337\266\223\253ILW]\001"
+	.text
+	.section	.gnu.lto_.symtab.3c1173ad114ec33b,"e",@progbits
+	.string	"pgResetFn_rxChannelRangeConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"pgResetFn_rxFailsafeChannelConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"rcInvalidPulsPeriod"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"suspendRxPwmPpmSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"resumeRxPwmPpmSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"setRssiDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"setRssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"setRssiMsp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"getRssiPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"rxGetFrameDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"rxGetTimingStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"isRssiConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"rxChannelRangeConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3c1173ad114ec33b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1179 @@
+	.file	"scheduler.c"
+	.section	.gnu.lto_.profile.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001%"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`q\002\205\016"
+	.string	"d\022e\003"
+	.string	"&"
+	.string	"\200\241\210\251\n\004\002"
+	.string	"\002"
+	.string	"\002\001\002\002\001\352\263\360\321\b\002\243\313\336\261\001\b\002\003\002\004\004\354\365\223\251\016\003\002\002\005\341\311\266\346\f\004\002\001\006\240\342\234\212\n\007\b\t\352\270\372\363\005\n\354\201\311\234\001\016"
+	.string	"\002\005\002\006\002\002\001\002\001\013\354\241\333\263\003\006\f\361\330\205\257\t\007\002\002\r\217\346\223\377\b"
+	.string	"\002\005\016\201\273\366\332\b\006\017\371\303\201\363\r\b\002\003\b\002\b\020\021\022\023\302\321\376\347\t\020\t\024\025\026\027\030\257\214\270\344\006.\n\002\013\002\001\002\013\002\006\002\004\002\006\002\013\002\f\002\004\002\f\r\002\004\002\r\002\013\031\236\246\222\356\016\002\032\330\242\366\300\003"
+	.string	"\033\320\346\212\335\016\006\034\271\213\357\254\003\002\002\n\002\n\035\036\325\256\333\305\016\002\002"
+	.string	"\002"
+	.string	"\037 \313\267\367\365\t\n!\255\276\270\334\016\004\"\220\374\327\244\003\006#\313\347\307\230\002\001$\227\314\374\033%\213\363\342\315\006\224\001\002\016\002\017\006\020\002\002\002\b\001\006\n\002\n\003\007\003\r\007\002\002&\352\263\360\321\b"
+	.ascii	"O\250\261\271`d\310d\026\026\266v0\002\304TUy\0210\271R\024\315"
+	.ascii	"0((\326\031\003\307a|z\350\2462\346\b+\361q\370\337\020\3465"
+	.ascii	"\227\333\210\354j\311\0053s\377\250\237y\004_\376|\017\206\313"
+	.ascii	"\236\032v\024\256\2601%3Op\\\243\326\036\346$\260\2452dI\021"
+	.ascii	"b\331\334<7vI\223\211l8Q!\335\270l\245p\006'\277\204*\bk%\341"
+	.ascii	"\373K\267\343s\244\332\017\007}\024\021}\345\333\242P\243\332"
+	.ascii	"\354<`v\330\301g\363\2648\307pc2\306H~gL\356\b\362\216\340_\326"
+	.ascii	"'\327\324\0354\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375 \337\315\003"
+	.string	"R\004\016\030\260\2511\f\3030\f\3030\270\2115Tk\306\202\232\221P\220-eJ\001\352NM+m\264\320\371\354\234\3153/\233\262\310q\032g\361\0331\254p\301.\260\313\336\304*\033"
+	.string	"\270"
+	.string	"\242\031wf\006\351\205\001s\006\250"
+	.ascii	"ZF\253\334h\031>a\243\017\343\322$\324\352\006\227E\234\005`"
+	.ascii	"\244bo\315aRvp\006\200\305,d\250\f\226y\217\312\340\22706\200"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_.inline.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`;\005\375\024"
+	.string	"\206\334cD"
+	.string	"s\224\306\311\256\346\324\255\341\373\020\374\355\264\255\305\tXz}\376T\250\242\323\260T\324m!J2\307Y?\036\016\320\341\263\331\373\227\273\377Q\257\273\217H@\025\252\352\313\254}\n\264O\004\302\375\367\2262\005F"
+	.string	"S"
+	.string	"T"
+	.string	"\177Lp\022\321\200By\263 \337\264\035f,XgZ\0203\026\214{\344\365\207?'>X\324\234sd\315\277\257\237\346\370i\237\346)qo|\264\357K\332I\3329\347\214\360\357\254\256\353\267\2569\247\374"
+	.string	"K\005\001\247\017=V\310ujk\242\265\221\232q\355)\223\342\2049\347\351\345\357\255\252\214z\253\242\r\244\267+\372\032\243\236U\371?\352@zve\331z\305Z%oV\260\r0LX"
+	.ascii	"a\331\341\315\351!T|G"
+	.string	"\220G\021\037B\264B\rY\212\022\f\342\253\202\001\373o\340\t\256jN\n\334&Q\353@]\312Z'R\355\032hm\2641\202\344\360\020\007\001\350HX\243\342\025km\036Pb\361>\210cN\f\035\0353\026l\0014\301\0203\226\214\004\013\370\266/u%\310\371\263)\3717\350\"\341\204Pz\367\334vw\244\r\037B}\342b_=2\352\005\371\020\340\r\021/-{b\037FX\027\326\220\031jb\024\370\"\200\022\302>\360\246rDj&f\333\2006\2020./\331\246)-\215\030\f\007\222A\253U\201\237\004\tD\021$!\363rE\031L\305\310\360\003\205\306\227\026-/\270O\016{\250!A\246\f\t\315H\222\2440\034\220\002\231\231\241\353\022\300\364-\245$3\016\311\0042\301\204\311HARI\007t\302\250]H/|\336\374\357\320\314\331m!\\\r\rr,\220l$\310\314\262\324c\223d&"
+	.ascii	"3\013\314\003\032a\016\r\027\001\201\273O\213\325q\343\226\353"
+	.ascii	"\366\203\354;\322\214\330\3215=fDh\212\375\213\266\274\200\242"
+	.ascii	"<cl\214~\344\005\005\032\346\036wM\247\223\266\241eX\203\370"
+	.ascii	"\325`\210\340x]\232\326u\312\216\223\317\334\347>\036C\303! "
+	.ascii	"\022\242\321\375\017T\017P$\0253\234\276\213\236I\247\302\t\251"
+	.ascii	"\006\364_\263\373\n\353\354\263\205cn\220\004\333\013\f\027\036"
+	.ascii	"\001t\021D\177\365]\367\226\fj\226\212\374m\335\211\254\2330"
+	.ascii	"M\300\020\203\266\364\354\315\307:\305\275\023k?`$\207\231\270"
+	.ascii	"\333I\314\257\264\033F\033\024P\271\317\317\376\\\367\177\244"
+	.ascii	"B&\360G\330\371\314\222\312\242\304\262\273\260\035%\302\303"
+	.ascii	"\242r1"
+	.text
+	.section	.gnu.lto_.jmpfuncs.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`g\001\305\007"
+	.string	"\302\312#+pK\222\016\344\252\212"
+	.string	"`\001\fU\205\367\271W\364\362\377\013H\350\"\001\365\220 M\365\377\377'\277\261\212o\377\001\261\244I\231\002;\367%\347$X\304\007\247\270\300\270\"\351C\374\320\345\274\003kX\f\337\227\022[\230i\2555^j\243\260$(\005\007d\236\340\007\376\312z\253\307\220\025"
+	.string	"\260h\255-\344\230\f!=\310\016\226ot\025Pe\210\020\007Q}N\260\307G\221\217*\327h\212f\212\270A\023\365\221O\253M/!G\270\031\001+ P\242b\314\352F\033\200\\CB\353\263\210(\003k\206\264lWG\373\246\233\036C"
+	.ascii	"o\302X#x\206\351\300\356^\342\352\264\324\360\267\030\211\r\030"
+	.ascii	"i\241\302\251\330\304*\330\253\260\001\207\317\261x\\\216E`\316"
+	.ascii	"\005\n\367\361@\316\364\346\343\272\332\0029\\\037\367\260\204"
+	.ascii	"X\271\241\204\260\372\355[\323S\356)\300\020"
+	.text
+	.section	.gnu.lto_.pureconst.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375 J\375\001"
+	.string	"\242\304\016\026\200M:>\3375\"#\202\300\214\005\n\020G\370\266[\200\031\344v\267\232\324\234\246t\243\0314\237/g6\227\271\313M&2\217i\334\212I\334\206\2310\203\373\004\356)wg\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`1\002}\n"
+	.string	"\342\315(*\200\267\031\016\323\241\022\211\211\277\210j\3024\265\304\300\220\211\220\327\272\034\325\310otX7A\367\020.\"\032\206\365S\263[\312\024S\023\365\200L\211\251\007dR\256\204\270U\231\2162\n;\026o\251\301\334\0375\345\315\214\177:\235\005\375\264\353\274s\225H\345s\224L\276\253\033\f\223\225c\203S\206\341\233\344M\227\335\263\226H\017\346\343\343s\317y\002+\035h\020\225GeAIP\n<B\357\202\223\007\006p\302\266"
+	.string	"~F\023\025\025\013O\250\034R\030\202\225?K\204\375\351\224\267\362\331\362\366\300\257\026Q\250!Q\245\260\0264\225\345P\2021UV\036\021P\255R\026\315\004-H\241\305Y/\351C\347\234\030\327Z\361ZZ\024'\004d\256\025\254f\246\226\326q\206\217E'\004"
+	.ascii	"ZY\216\314\026( ,\022\305\372\274\003\340\200\026\210\216\f\335"
+	.ascii	"\350w\341\034\331\005=AOFxw\271\345\033\201\3239\224\213\374"
+	.ascii	"\265/Gp\231\026\331ni\277y^<\336h\253\241b\350]\2739\026\312"
+	.ascii	"@l0X\225\307\362L\022\327\271A\207\240\355\221\033\271\303zs"
+	.ascii	"\3122\\\037\b\244\005\374\274Q\360\017\355\356[\244v0^H5\231"
+	.ascii	"\237X\\\037"
+	.text
+	.section	.gnu.lto_.lto.63a866282b3577ee,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_queueClear.26.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"%\b"
+	.string	"rO77Po\322\001 \232\237\316\372U`H!?<r\304h/i$\314B\356\360\b\002F\bb$l\310\214p\232\221\340UU\343\231\341\375\177\021\351\021\375B\273\355\226)\005\2568\230\305\340I\260\024\252\316tX@h\230\025\326\231\034\002_\017\0266#\256\013\233\032o\237Y\b:\030}\034\254(]qdBm\356\223~b\025_d\b\237|\222\217\261\303$\002\303i\312R\277q\257\310\315Or/\023\b\355r\357\374\222\233x|\321\243%2}\367\350g\362\321\236\240\320w\326\022\307g\0017\333\333\024z\330\317,\004\331Q\206\260\f\264\354f\244b\366\213) \266\257\261f\277\334\013\355I\030\027(\250\335\235\360\343\332U\363?\362\200\356\263]\001\fv\327\332}4nx\333\005\266\247m\227\016"
+	.ascii	"i\3317c\032\376\206\213\246\025p\0070\013*3\244\332B\\9\343\302"
+	.ascii	"H\026,~\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_queueContains.27.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`\211\001\335\017"
+	.string	"\246^kG\360\262&\0350\343gH\367hg~gP\261\00163\2326\205O\257\305\3255\303\007)\233\311Mx\177\315j\326N\272\257}he-\330\031\263aq\030x\316\017t\225A\260\232P\270\376\301\364\322!\226\354-eJ\001W"
+	.string	"R"
+	.string	"Y"
+	.string	"\017\240]n\037\321.\025\210R\356\376\231x9\t\020\033\\"
+	.string	"\231\363\343\266\204G\036\277[jwM\306\325\316W]\023\361Z.\036Ke\r\314ct"
+	.string	"S!#\342\261\304\215\2055B^K\367\262+\r\034\226\317\215\007s\005\231\3149\255-^\207\033t\333\235m\006\366\303\007m~\315\352x\360\336U\253\252\277\211F"
+	.string	"\371! \307\234/\263!S\207\324Aq\360\366?_\346\220\337\342\261\324A\363l*\016[\b\206\3601\347$\271\264h\273$\020o\247\354\220mU\373+\016K\335f\345"
+	.string	"\346t\301f\314\371!p\202\355\322_\336\321.u\007\374xX\351\354q\3169\345\201\357\202\366)>\370\264bX:\323\030\"\\6\342\276\254\355\367\004\376\260\250\020\333\326p\030+\333\234\263\201\377\342!\312\247\271t\212\212\276\345\322W\331\313n\240\006'\210\316Jg\333\323#v\263\373\262?\225.\330qc\306\353\262\003\245\222R@\235\240D\217JN\244\n)\022H\023F(\356B\351\304\0027:\241\270\222\0026a \2358\024\223\351\304\205\276\371u\371,\016\241G&\314\221~\247]\366\b=1a\316\376\235\026\343\332d\265\254\023\332\276\034\232\211\240]\036J\362]\027\333\373"
+	.string	"\307o.\303<>\2153x'\036"
+	.ascii	"i\355\233\202\341\257j\356\2500\221F\214j1\204q\2776\244\002"
+	.ascii	"V\bmK\n\302\033\023\305\363\202\302<\n\232h\211O\314\212\242"
+	.ascii	"\013).281V5\334s1\316](\021\252P\256\251\363\236m\237Z\332T\257"
+	.ascii	"\275\204\371\004"
+	.text
+	.section	.gnu.lto_queueAdd.28.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`\232\005\275\""
+	.string	"\306}\330I\200\030R:{\346L\323\225\300@\024L\022\224\224v\237\250\372\200\325\335\306\303\243\006\216\312\220\017\353\036\243\342\016o\360\314\330\026>*\265\336\355CBE~\315tg\3645\344\274\237 \360r\3227Uj\237\315H#\204\310\235d\303"
+	.string	"\270"
+	.string	"\307"
+	.string	"F\314\353Q\313|\304\2742\263\265\314\317\272\326\321\225\300\373\356=&\231\334\273l\300\016\324\243\274\374\200\364\250\372"
+	.ascii	"\351\321\007\020\216\030\351K+\247W]-}\231\271w\371k\036>\037"
+	.ascii	"\3127?\227\347\265\221\276[u9\025\307K\321\263{\026\211\237\364"
+	.ascii	"\335\332\023\325\330\222]wvD\025\257\353P,\223uFG\024\325s7\324"
+	.ascii	"\363\202Y\r\247\257=I\235\366G\233\230\217MY\334\225\212\347"
+	.ascii	"\341H{P\303\240E\261h\374<-h%{\364\240\204gw1\241\274y\313\004"
+	.ascii	"5\264\255\322x\357\\`L\233\361\265'\3439\300JU\227o}g\310\023"
+	.ascii	"\225\2658\f\367^\266D\250\2503\2003\277\0013K`F\027\004\021\326"
+	.ascii	"\320|\364\372\310g\351[\204\227\232\320\242a\276\222/\3413\376"
+	.ascii	"\025\017\261\231=\221\315\322\243\357o\335&\233\222F-)%\373\306"
+	.ascii	"\274\f\332F\226\255A~q\037\231\200N\216\265\214s\363\260\263"
+	.ascii	"\357\312\337\206-\363.v\336\235\226W\234e\335i9\207\263\254\246"
+	.ascii	"\226q\251\345\364\264\214\242\226O\324r[\313\366\264\374\002"
+	.ascii	"=+#U\025\220\326\262\274Noin\025\264,\310\303~\261[\346%\177"
+	.ascii	"\214\327#\004\305\260\254$\330\303\370M^\277\216\316u&\033}\311"
+	.ascii	"\036\232\222\306\254{\357\271\370_\374\256{\031=\t\237\035\020"
+	.ascii	"./\224\205\251*Yf\356\275<G\031\202z\364\300\031\3672\034\022"
+	.ascii	"\264o\214v\332_Z\243\323o\264\3235E*C!9e_l\344\316\356\266J\257"
+	.ascii	"4\241E3\005\304\331?kS\362\317\321\200\324{\205\021\370R\\\224"
+	.ascii	"\350\3560F J%\373v\253\025T[R\017L-\211G\201b\033I\323\026\333"
+	.ascii	"|!\004\211K \343\005\221\327G>\363\031\330z0\311\320\233\375"
+	.ascii	"\315o`32\311\372L\314H)\001\001f\270p\221as\373\2216\222W\037"
+	.ascii	"gN\267[\217\347\276f\352\367\263\234\367\336\2132\270\257s\372"
+	.ascii	"D\246\264\f\215\301&\216\343\223\263\2218m\323D^m\037\356\004"
+	.ascii	"\250\336{'\360\233\274,\210\177u\224O\b\t\245Gq\032\t\2142F\255"
+	.ascii	"\262f\343\322%\326\215\344?AA\366D\221\017\213\223\177z\210\200"
+	.ascii	"P\264\030\001d\342\247\350\227\"\310G\350\367CT\364\353\331\341"
+	.ascii	"!\025@D?\026CCD?^*\275\217l\355\315\322\261o`S2\311r?\373\267"
+	.ascii	"\256\201-\b\223l\275\331y\274f\fJ\035\004\333\035\321\335t\273"
+	.ascii	"\361x\276\333Q\021Z4\267g\3151\251u\3277\375\261\363`\245yi\001"
+	.ascii	"\263XE\272b\350\324]\363\211\333\265\316\332]N\034"
+	.string	"\363^\233B\021\314\320h\323n@\003m\271$5#T>\213k\265u\315\034\302\307\236\310\025r\f;\211\371YV\340lAq,@\005VWtm\2750\270N\347\372T34\006\277\266\242\307\212\310\314\034n\005xa\313\321*j\243X\2105\3243Z\2326\256\003s\250a4\004\211sHdF$\020\221\304\031\016p\002\021*\263n\021\2405dFR\220\333\001h\370\351\244\307\361\233}\205\035\205\020Y/;\273\276\023\313\265\271\243~\262\3367iD\337\004\206h\242\247@\022]\366\220\214\216{\366\201\274\314\364\206\340\023\222 \021}M\215\013\207\270\302\313\343\224\377/\321w\225%d\215Vf\270\332C\243\201H@\206\370\254\224\260\242Y`\f\211\343\201\234\341|Ek\342\234`:\2706\254\005P\314u\221\352`\376\214 \230\n\366\017G\204`\232\273+\320\\c\221\3258\025{b\2116w\003\002\247\230"
+	.string	"q5g\250&\206\256\331\232>V\223\224\360`d\265\033\256s\355<\233R\271\351\245\372\257\274\355{?j'\n;G\365\234"
+	.string	"\200"
+	.ascii	"\372\344\206n\310\356!ku.\362\267\263Mp\017\233D\037,\303\251"
+	.ascii	"\361OEp\241\006"
+	.text
+	.section	.gnu.lto_queueRemove.29.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`\311\002\025\026"
+	.string	"\246j\222J\260\022R:rc\354\2541\343\347\016\250\274I\366pB\240\252;l\226GJn=\267\023qx$Bu\347\373Q\177\373\037\260m\"\375;\302\375\007\375\007=k\322\005\241\030C\256\357\323\206xNm\323c\254\226\020\262\211\334)\005}"
+	.string	"w"
+	.string	"~"
+	.ascii	"5\273\264=\247}\245/\325\316D\373\253V^\322T\255=\026\037 O\335"
+	.ascii	";\212xJ\376D<E\340R\263\355\275\242\237\017A\365\234\020Rk\017"
+	.ascii	"\266\035|\362\260w\213\323\366Q\244\341N\233\177\373X\262\353"
+	.ascii	"\361\331\341\246\210\004tJ\221\260\206\256\234v\032\036\2060"
+	.ascii	"K#<\224\354,\204\333\004lQ\356x\346\376\367Iu\205\273r\332\001"
+	.ascii	"}\2161\265VO\335.\303M\336\366\217m\005\366\f\022(\016\214\371"
+	.ascii	"G\247\2560\233\327\235\372\263M\272\240$\264\304bgf\255\225\216"
+	.ascii	"&\247]\"\273w\233\th\3000\362\362"
+	.string	"\354\327\231~\023O\223\270v\272\334\351\221\373\356\026\235&\351\364\270\323b8M\303\351p\247w\247\347\234>\200\227\031B|\244\360\250\365'\213H\235AY\200\270\357\366{\376\317\245o\342M\265\373\034$o\030H\240/\252G\255U\345\324.\344)\201\360v\017:\350\0379\202\253\\\245\373\321\362\271#;\340\251\234t\307%\327\266\301\231\327\371\205Cno\366\251t\002\334\270\371\024\315@\221\024\271\023\313_\241\303RTk\275\316\266\354P4\230\033\247O\343\322\240\016h\345\255\025w\264\221\023\"o\030b\270t\217\225\023\201\233Y\336\r\367=EZ;wW,\022\004\314\205\300\t\210\n\002\022.\221M\366+\363\341\340\231Cl\033\302S\320\310Z\353\002?55\323f&\223\023z\246EFs\243\363\200F\302\314\f6\241F\006\0076#\233\301Z\n8F\201F\006\313\211\305d\260\262W\277<\277\304\033X\305"
+	.string	"J\211\276M\374\357\016\254^"
+	.ascii	"\245\302\337&\222\220\254cv\026\367a\\\"\227F\364\265\233c\252"
+	.ascii	"\334e\273\266\\\0062x\346\020\267(7\005\307\206\235\231\365\260"
+	.ascii	"\326Z\305\225\273\366\265\377\035%8U\004\361\\\320p]\333Z\237"
+	.ascii	"\327 \261c\313\235\353c\217\254_\0252 `\202!\346\214\007i\373"
+	.ascii	"\246\032\376\332\334\2310\246\241\305*\322\301\025\2273#Vd\""
+	.ascii	"^}lL\375&\221E.\360f\261m^\221\312q6\201l\342\222\320B6\260a"
+	.ascii	"-\026\260\300&w\b;\216Y\177\242\363\206\267\024\275\002)\353"
+	.ascii	"\200\222\374n\353\023X\024\200\3268+e+'b,\016\356\267\214\312"
+	.ascii	"\033\265@V\035\2679[\254O\320B\210@<\367j\361\023"
+	.text
+	.section	.gnu.lto_queueFirst.30.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\005\b"
+	.string	"\002\21767@\217\322\001X\373\310\003N\2211\213\\%\250@\270\317\024\200\320\260\270\003\270\240\376\217\274>-\246\204\273\317$/\212\242\352cN\r\026g8i*\347\b!\233\310\235R\3262\335\346\260Y\330\0304\215\204hPx\220Z\247\221\031\002s\021['%8\256\223\227\271\267VI\252\003\037\005\035|\304\313v\027\301\017\271\310\306/=z\202\303Ql\224\3420\031\334\007\371\264\211_2\205O\360\337\243\357\323\365\030G,*\324\007\256\354\351\201\212a\337Z%\331\206V\013;I\021P\331\265X\265,J4m\330\356\330\027\277\343\036\035{\001SC\204\201V*HT\273Sz\036\340z\314\216\271\0365\343\336\241\347\377\343\026\352\"\365\205<\207X\302\356\032~!\321\255\267]`[\332.\t\r"
+	.ascii	"i\331'c\232\372\f\267\254\224\030\333I\363N\214\025 e\213k\342"
+	.ascii	"n\004\326Bd\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_queueNext.31.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\305\b"
+	.string	"\326\020<6@\217\322\001\303\201\263\254\264\225n\321\236\202^LlF\032\264\201\340\r4\2451\333\020\245\365\2434\0363\333\274(\212\252\2179\265\026\227\251\274\241N7\302m\245L)+"
+	.string	","
+	.string	","
+	.string	".\f\325\313n\204\216\027\300\3764\017\300\376\324\343\334\223\363?\362L\013\207Kg\032=\263\205\335uv\246\323\255\267\215`\033\332\206\t\244|\331q\224\332a?\263\212\262\235~\231\316L\037\313bR\nVv3^\256Ey+\020\333\"{\343\207\\Ddn ~\234\262R\037?\365gP(\204\375=\005X\245\226h\253c!\345\313\t\277\246\376b\243t\222G\267\374\224+\314\312w\177\276Y\330\337\225@E#\3268[\007\002\324\320q\320>P\342\201!\002j\333\007r\016\354\231\350l\220\302\343\331\340&\356\025\365\324\200\244%\333\266\370\t\247\331]\005\337\344\252\016"
+	.ascii	"i\331'c1\345\315H+<'$\007\312\020X\314Rbk\024#.\214\263\303\210"
+	.ascii	"\026,\023\327\212I\230d"
+	.text
+	.section	.gnu.lto_taskSystemLoad.32.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"U\013"
+	.string	"&TKB0k\234\016\230\341wxX\324c\330.\020z\344\356\372#\331=g\243\031\301\331\240\261w\337\017\364Z[A#ik\013\363FAv"
+	.string	"\370A\240\256\341\016\325 q\205\362#e\330\241\030\244\2447\331;\2456"
+	.string	"6"
+	.string	";"
+	.string	"\376\360\322\301\376d\240\300\211\265\273\033m\360\361\027\235\243\237U\264\017\271\371\245\340\224\202\364\\\223\335\375\204\317\003dg\316\254\262\273\236\0372\301]o\273\303\366\206}\216\f\354_\273\273\246!{N?\223\030q\300\330\260\213\240\025bUU\003\004\211\355O\373\243\223\306\227\bX\333\005\2252\354\226\031\326\210x\235\334\002{\275^\201\275zt\257Y\007\f\242\325\205\n\263\b)\326\352\246\2374PJ\264\232\273\273\241\026\261S\021\223\007\317\004a\237\302+\210\376\003\017\320\314\177^}\r\366z\252\201P\022\026pf\313.7\223\006!H\347Y>2\227\016\004En\302\034\005\354\002\210#\035"
+	.string	".\334.\226\020o\343\300p\243\\\370\023\320\201[\346\373\300MR\356\257\245!{\220T\034\332\261\357a\276\205_\360>\f\006\013\030"
+	.string	"i\3317c\232\215\032\006,\200m\n\313$\303N\230\020"
+	.ascii	"\320\201\313\200\316\003C8\020\210\255\270\006\252!\342B\030"
+	.ascii	"\002$\230w\t\200XM\001\356\0220`Q\345\266\253\350\001"
+	.text
+	.section	.gnu.lto_getCheckFuncInfo.37.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`A\001m\f"
+	.string	"\306VQA\020Q\234\016\363\341\020\324"
+	.string	"(u}\235i\245\352C`\031R\364\005\353\275\246\335\256\021\321\004\350\251Y\304^\302\3257\305,\350\f\204\004"
+	.string	""
+	.string	"\326R'\244\235\203+\375U\264\2376\374w\244M\244L)<"
+	.string	":"
+	.string	"@"
+	.string	"\001vG+@vC\003>p=:\274\305z\274.\300z\364g\303xH\332\237L\032N1v\027\323\017\377\236\237\177\021\237\200\242\317s\203\301\356:A\021\207[o\233\200\355\005\366C\002:A\261 \351"
+	.string	"\312\022;\374\244z\260_\355\356ZG\366=\376+\323V\246c\246\253Lk\2463\323\257"
+	.string	"\220\341\242\300\307\356\206\022\032;\022Q&\212\355\247}\020\017\361\335\303\363\316\\EL\001\246\342\035b\251V\372\f5B'4\252\t8DHR\355\315M|p\251\223\224H\307\325\266\360\223w\355\256\002\277\304\306\261\220J\0360\365\021'\341\371%c\350\344\301G\277c=>\234\204\315A\266y\r4\231\206\311*\316.\235F\301\213\240a2\016\266e l\260\254\343`\227\001\346*h\035v\201\343:\214\022\356\253\325\221\037\314\030\001i\310\226\332\332Q\325\213\243xT\013dBT\004\034-:*u\036"
+	.ascii	"i\331'cz\200\032\206\263*\320\006\005\f\002\026\320.\300\002"
+	.ascii	"\255\221\202\2106\260\007\216\001!\300\024\270,\b\036\200;\270"
+	.ascii	"\354\210\201\232\270\2335&\300nP\206YT{\r\020\\lhVS\300]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_getTaskInfo.38.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`\200\006\r!"
+	.string	"f\273\317F\200ZN:\277\214\006r\321\225\261\337CQw\375T\361\267\377\321\261\357\237\372\246\312\343P\276\367\265\2360\212\201\022t\324\007*\b\273G\177\3044\314U&\231m\311_\032\307\321Pr\034\001\234\025\203I#\204H)S\263"
+	.string	"\256"
+	.string	"\303"
+	.string	"[\266g\237Z*\177"
+	.string	"$\230\365Uk\335\262\257\331\317Om\225\263\021U\t\353\017\302\220\266\257\004K>\302\247\376s\311=\377\263p\247\244;6c\001\324\252\365\326\300\\\362Bs\371\337\257\005K7\214\306yj-\002\226\245V\241\202/0\227$Z\001\345\222\343\006(\227|\372\307\2550X\267\314\312\215\2628\265V^\033y\200\035\205{\222\323-\311\2619\375\222-\003\331\220\021\207\277\032[\376\374\254\256~=&\227`\3558B"
+	.ascii	"\213\302\365\363\253\032{\314\254\313\371\263\342^\264e-Xz\304"
+	.ascii	"\341\017kY\027\241\326z\366\375\200{\335\376\267\361\177\302"
+	.ascii	"_&\t^\306\336zPoG\221\245\251b9'\261k2\314\257\332n\031Qb\211"
+	.ascii	"\327\267T.\031\324\213\266\253\303M\026\021\265v[36\354\336z"
+	.ascii	"\026\031AE\337\177\023\233\206\"\025k\255\016\256,\026\246o\327"
+	.ascii	"\222O\321\304\353k*\227\334\216\321\325\305\007\204\212\357\374"
+	.ascii	"\302\036\367\326\277Ie\302\034yk\375=|\"\222?$4\362\203vl\027"
+	.ascii	"\300\016\367@\033\266\373\303\303\337\221|\037\223\177\232\374"
+	.ascii	"\036\223\317c\362M\223\2573\371\245\216O\352\370c\311o\222\317"
+	.ascii	"#\177\r0\033/[gM\024\326\036w\350\3246RM\311\016w\377\375Z\331"
+	.ascii	"\341\027m\315\322\375\247R6N*6\246`\013'\025Cz\203\032\271){"
+	.ascii	"\007|#\373\227\260rPc(l\033\250\243`\255\225\r\212 \030G\366"
+	.ascii	"9F\234\033\373\257\260oPe\027V\r\224Q\032\364@q\354\023H\354"
+	.ascii	"\3761,\032\ro6\254\031\016\274b\255UnhQ\261L\367)\207\306\213"
+	.ascii	"\373\357\260mJ\r\347\223\273\207%\243"
+	.string	"\304\013\216A\213\202b\270\3172g\346\302\210\372\377\260`\234\314Zk\322\367\213\b\020?]3\310\266\bx\246G\034\312!){\353\347\221Q\250[\r'X\240\276\032j\240\246 \346\313e\273\234\355\333\365\020_\373Z\271\344P\027H#d\254\265V\322h\201Z\250\327\311\020\242UV\357\214\210VMM\374\204\242\205y\002\203\223\324\322\213\362\350Q\024\323\n\030'\230T\240R\274\026MK,xh\224\024\357\310\300\237\\0E\361^<=E\361N!\325\266\326\367l-\270q\231\245\221_\247r\3216\203[\226YZ\357:\225D}\365\377\032\304\332\250\272\367\235\021\016\362\2647\\\214\365\264\006\374\003\345\261\217]\357\344\342|\220\360O\251\353$\341\036JHA\346\201\032\005y\207O\357\250\342\274N%|\325\333\236>{\300\022\316\221\212!\341@\215n\364\364\016\b7\307\323\204m\234\361\311\355\331J\263y\232"
+	.string	"\234\225\235\336\023\246J\305\222\270\006z\304\325\354\235\032\234\227\016\312\332a\363Z:\251\030\203\342\034TAQ\216\256wL\336\346\302\312v\25014\244\230\203\n\215\310\314\024&\225\306\360\002\021\031[\035\021 \271#J\331$\313lZ\003\312\336\323\364?\337\2424T\201\020\030I\030D}\013\315\344\274B\222\341O\210\211\007\366P\013$\371r\260i\3673d\215\246\314C?\030\324"
+	.string	":\2615\325G4\t"
+	.string	"N\257\216\370A\f\367\314\200\210G\271r\006W\207\005\020\315E\331\301\212\377\273\202\275\313\212(\224\"X\204\310\374\323#\267\342\256\373\351q\206\2719\344\333\244\211\206\276B\241\3727+l!\271\030+\314l\246\206\030m5\020I"
+	.ascii	"*$\001\017A\243Fq\177nH\006\220\340\277\277Y*\rP\2710n\006\273"
+	.ascii	"wH8\321\3309\214dxh\264\027\367o\337\324\301\001\254\325\353"
+	.ascii	"\b\002\001\351L\302\321\374\273a</\317\364Q\257\016\376\001"
+	.text
+	.section	.gnu.lto_rescheduleTask.39.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`\217\001\355\017"
+	.string	"\306\035kH\340\320(\035\n\375nF\214vi\024\036P\375%\364\223\332\017,# \307\356\250:\261\fWuq~J@;^\273\316D\214:V\376\004\250%0\214F\350\206\t\363R\276\242/#\324\343I\030\324\r\315\222\275\367\336)\005S"
+	.string	"P"
+	.string	"Z"
+	.string	"\364\343\036\365t\276\243\236:e\317xX\263\237\331\\f?\273\333\311\017O\275\322)c\312\347BD-\227\352\025\346\224\303\3252?v\367B\234!\230\313Y\340\345b\003\207\2135=j\036b\374\3461\203k\025#\027\262\273\216-\327\313\315\335\366\311\366\210\375\235r\306\226\321\334ew}\370\323\333\374\027\215h\324H-v5\004\001-\215\362\300.\273\375\230?\223y\305\367e\217\341\006\343\247gw\r\234Z\304\307\261G\247\037\331\216a\005\233\202\320\251\037\355\223x\211\324mV,\332\2259\241\263\033\0360\202\320\003_|\213B==\316\377\262q"
+	.string	"y\225\234\004\221\321Rc\025\203Le\225\237]\204\005\314\204\313\r\226\030Ts\353\321\241\001\006\304\214\210\275`\305[\334\361\251u\2305Ri\247\250\304\267<\245\352!Z/\232\2244\356\370J\275\024\020\003\213\331X\361f\207\252(i\354\317\335]\007\017\034D\324\007\226N\fL\337\t\364\032\250x'"
+	.string	"L#%(\022\224\352\022\t\364$\244\230\274\b%Twr\"1\351J \252#\021\3607\301\003;\224\357\003\273Q\270\237+g\374\233\207r|h,rU9i{W\001A\362"
+	.ascii	"\211\330\335\004\266-<\305I$cc\001\212\347\224\370 Nm\022  p"
+	.ascii	"\202\231Q\306\003\351\357\033\233\316\026\033\021Z\254v\257\026"
+	.ascii	"\353a\230+\230\267\302\270S\301\312\304\257\024\302\033O\n\341"
+	.ascii	"\352pKb,kF\334jkoa\3653\331u*\204~\241\313\nr\264\360\222\362"
+	.ascii	"\200\305\227\033nl8\032\203\330\003"
+	.text
+	.section	.gnu.lto_setTaskEnabled.40.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\335\013"
+	.string	"f\327Q?0O\224\016\203\2425\264\341`\006\204P\rp4BD\341R \336\2059/C\232\346\346em\037\333*h\313Uu\3566kw)\265\345`8\223Pg\026jub\320\315\243}\262\311\2262\245="
+	.string	"A"
+	.string	"="
+	.string	"\360\224x\313\233\215\342\236\207\375G\b\367\301bw1\355\360\355Ps\363\257\213$\325\225\016#\252\253\307\323B\207\202\225\335}\307\263Bw\312\274.\273\353Lu\030n\353\2661\266\025\330_\020\351\314\3641"
+	.string	"d(\201\245\330\275\360\205\354\312\002\321\260}\373\036\366\344\023\333\232\366\001\004\333\275\321\200\253Xm\220H\020\271\345\247\375\215\203\330\316A\262dw\203\210\021\273^\001\033\210\334\252\\@\274\025\311\2750\345\356\256z\024U5!L\240\262\205S\257\252z\202S\005H\205.\270\017\224\223\"\324k\003\215\025\034\310)?\333+\245r\260\257\337\367}\326\f\373\336\177i:\236\343\207\231\326\f\234\254\243\311x\262\213\203\201"
+	.string	"\312\204\2427\026-\353\2108\231\203\r\b\363<\310D\3006\032\b\263\020\360GB\246a\241\317G\303&\336^3\314@\303\312\244'\bcF\205j\213&\344S~\307/\024\264\344K\243:\024"
+	.ascii	"i\3317\323\342\235!\013\216\002w\300\330T\265\f\016\241X\221"
+	.ascii	"`\226\301\2723\245\240\031\330p\215!\205\273\005\252i\340\004"
+	.ascii	"\001\003\0365\262?\2242"
+	.text
+	.section	.gnu.lto_getTaskDeltaTime.41.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`X\001\315\016"
+	.string	"\366\332bF\360\320&\035R]%x\264\222\025\022f\b\003\002S\377\2746\363\233\303\317/\333\235\305i\255\244\007\330\304\315@\222\213\340j$\026\276\fY\253\360\2608\f\236yB\250b:\232G\224\344O\375\r\255%{o\271S\nN"
+	.string	"I"
+	.string	"R"
+	.string	"\027xt\354n\026\362"
+	.string	"\3632\376c^\252\315\271O\031\025r\376\313'\005\035\034\322\324Y\210!\273[\352*\300\030AG\306\252\353p\215\006^\235\217\251SE\217\0217B|\347P\246\213\201\020#\331]\303U\267\341\306n[\201\355\021\3739\001A\256\032*8d\267^\240\326\330\217\273\273V\032OC\313{\277\032\032*\3641\323\017\r\004,v3\024\021\355\f\371\223c\333\305.\331\206\360^\213I\273\037^\264\330m\021p\201\321\245m\277\304M\270\230\213\255\233\016\263a\005F\321\264y)\025\373|\204\274\277nzHH"
+	.string	" 3\237\013\206\n\016)\007\027\030rD\b\357\341F|\236\t\333hw\217\3032/\247\222\274\237\270\213\305\307\261\312\n\374\352\322_\231\227WL\304\n!\026\f,r\020\210O\203j\215?\3362UY3\001&\tN\266\222\224\351\223H\n\325@\305\004\265\340\264e\016\030\224\240d\247\324\226\211\f\260\366"
+	.string	"\225\312R4-\225\225Z\373\270J\343{\370vD\237\233'\372bH\251\3379\311\306\347\351T\2502j\022\030\215\231*8\020 [\302Sl\002\200v\367"
+	.string	"\212\277N\002\036"
+	.ascii	"i\355C\3024\200f\317am\261m\3378\212\300q\311\r\323ch\0308\017"
+	.ascii	"^\201\273z\020\016\267h!I\213%\241\214\243\250\366\216\312\021"
+	.ascii	"X\224\267\t\211\313(W\215w3\341\212\237l\"\\\016\234\023\312"
+	.ascii	"\204\225\366\321\b\n\n"
+	.text
+	.section	.gnu.lto_schedulerSetCalulateTaskStatistics.42.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\365\007"
+	.string	"RO87@o\323\001xY\306\337.\211\330\177\225|\267p:\200bY\302\320\3456\325\177\215\3671K\2014\302\352\232\035\357\013JF\004n\2328\260\302\243\351\336\f\246\255\355\235RV\215\310<\225^[\275\266\271AP\324\351\261\266\211}(6i\201iG\263\260\217\2045A\253\264\270f\205\244Z\225\035\003g\027\226&\267,\323$\347\333S\033K\017,\247Q\3140\214>\311\277\220\037b\f\020|\367\312\007\001\274\332\240\244\314t\214`\215\375\211`\364\260Om,\331\367~H\r\254\2640\270\354n\324\320\354\251:\021\261}\216m\bm\205\005\356^\210\3401/\236\312\356\207\340\204\200W\346l\230\177 {\023\223F\211\314\356\312\370q\356\220\363?r\201\216$:\3344\354\256aG\342\270\343m\037\330v\260m\n\t"
+	.ascii	"i\3317c\372\365\206i0\255\2700\206\007\233Kj2\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_getPreviousTaskId.43.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\365\n"
+	.string	"\226\225K>@M\224\0167eM \236J\342\311A\354\223\032\033\347\237\2212\261\246"
+	.string	"\002\314mu\237\304\"\273\315\246A\213\200(L\261gx\240kQ\275\262g\034\003"
+	.string	"a\302\336\"Bm\357-eJ\0018"
+	.string	":"
+	.string	"9"
+	.string	"\0355\271F<|\317\210\207z\341\330\237&\346G\b\242\021\033\267\371\273\340$\\_dw%\034\347\005\330\335wx~8-\3631`w\235\033\027\341\206\267M\3006e\037@W\016\023\023\262<\331\335&\325\202\375\267\n\262\235\216N?M\253\2463\323\177HL%\004\210\330}pR\261$`\210\f\26656\304\027\235\203\306\330\3530p\017\317\006\017\311\264\033\252\357\224\264\223.\213\335\354\233?\372\207\312\017\035\272\301u\305\303kjD\321\321\240\345\351Jaw\243\316\304k\244\302\350\004'S\330\367\360.\343\207|\301\344\267C\037\023\017\003\256P,K\202\213\001\313\201\312E-@P@\001U\261.\212\322\341\212\201\305\242\034T\225EA\272\375[\0059\023\343XL\215\372\364c\373\351$S\355=\325\250\033$\317\212\f\304]\212\251\001\021"
+	.ascii	"i\355\213\230i\257\326\216\216\225\360\302\0354\366\307h\233"
+	.ascii	"\002\347\002+!\354\036\016\266\270&\216c\241\361\020\271\270"
+	.ascii	"+1\233\254!\250="
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.44.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`j\001-\016"
+	.string	"v\031^E"
+	.string	"\221(\035x;o\376\233G\302\342\001\372\226\377\261\357\250\367\035Pd\277:UQ\336\312\t\024\235\271\017TOU\204\240 \026\035\241\31667\201\336\265\276[-\021\234\3642j\336\031\200r\fa\037\355\275\267L)H"
+	.string	"D"
+	.string	"M"
+	.string	"\247Aa`\275vW\2032\027}\312\bU\344?\365\216\367\215>90\227 \337\2058\262\273\331gA\343\307\007s\030\017\224`t"
+	.string	"\371HQ\304\025\242\306S\327\f\337\213\252\307\202\335\265z\337\206\333\343\2667\333$\366Y\0014H\n\263U#\205&\373qw\3270\306>\352\217\252\376G"
+	.string	"\224KAlWCl\307\266\344\213\021\231\355\253\375\023G!:*\344\316.\b\031.vU\b\234\200s9r\221y\031\0372/-\262m\\u\332o\321\301q\363J9\213\033\022\247\271\315}E\306\301\346\325M{\302Ut\234\335%\361Y\025V\006\234fZ\346\245gF\216\247\370\252\305\2371\005\026\275w\351\263\314\313C\271\262)\341\301Ec\027\341\225Z\020\232\034\362\320\214\220@If\025&\fP\272\022\225\351\315\003\372@X1\371<\330:-\302II\212\266\201:\315c\300\234\204\017HS\3418\220\226\251\366qaL\203T\313\005\276L"
+	.string	"\032\241\355\340D\3579\302\321\tv\243FB\223\005<4#,P2\261\212AR\230\326\350p}\210(\001\036"
+	.string	"i\3317c\032\375\fkm\305\262\340%T\324\266M\3146\241\340\252i,"
+	.string	"\303"
+	.string	"\224"
+	.string	"x"
+	.ascii	"\305H]<)J4uF\233\275A-\203\242\344\ru<\316\206\200Q\227\260\210"
+	.ascii	"\325h\340\2164\325\344W\230\255\264_CPP"
+	.text
+	.section	.gnu.lto_schedulerResetTaskMaxExecutionTime.45.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`\360"
+	.string	"\225\f"
+	.string	"\246\226TC"
+	.string	"q\225\016x8~f\214\315i0\212\262\366#\326L\351\016\376\347t\357X\223)&\t\001Cg\256h\rA\314|\004\f\006\313v\325\376\377\037\367&\005\003\033"
+	.string	"\254V\224\037bJ\324\367\366\367\336{\247\024?"
+	.string	">"
+	.string	"E"
+	.string	"\273\253\311\017\367^\351\224\321\363)\036\313\007\246^[\247\030\360\302\334\354\256\2058+\255\313i\200\243\005\007\f\310\232\232\230\207\311O<f"
+	.string	"W1R<\273\353\370\201\033n\312m\217lw\354/\b\237\273\273\226\037\366A\376\327\rYL\001\213]\r'5\026FW\210\270\330~\264_\342&\274\203\240l\331\365`B\262\033\0360\202\312\351\346\232z:\237\251\247\366\354\027\017_\373\221\022\f\"\262\007q\352\356\024\377\235\372\247zz\361\230!\213\241\212'\257\031\f\022\n\200@\007\211\020\027\2548\213*d\304:\314\031\355\t\024\342?K\231z\210\217\003&\245\313\231\243\352\245\200\216\021!%\2548\263\303T\224.;!\006\244\356c\252\006q8\321\203SH\344"
+	.string	"\324i\020F\237\222\006\342:\215S\300[\004\021\247\231\266\215\323.\341~\256\374p\003\0320\225\\U\351r\251\332\244\217\224\006tlWx\212-\300kw\023\240\270\210\004\007\031"
+	.ascii	"i\3317c\272\211l\250h5\243\005\273\037\0225q\300\f\265\315\340"
+	.ascii	"\300PH\006\204\026\201\300@\335\037\252y\334\n\005H.\326\022"
+	.ascii	"\253)\302]Rt\300\"\224[\271\021\fGcP{"
+	.text
+	.section	.gnu.lto_schedulerInit.46.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"\035\f"
+	.string	"\346UPA\020O5\035\203\351\364\2250R\005}0\375\375H\025\034\251\211E\215"
+	.string	"\213\212Q\260\032%Y7!\346\356\213e\214\241\367sH\0315P\222\001\200\222!\250D%\"\001U\031\003\231P\376\356\270wJ\0017"
+	.string	">"
+	.string	"?"
+	.string	"\233\217\256a\b\032w7{\2657v\366\372\314\034\033\306\311\321\276\234\221\341\324\332]\215\212\316\371\344\370/]\003\374t>!\007v\327\023\374l\270\351m\013\260\255\331\367\004$\224\213\205\201v\374g0\237|\211\214/\332\202f\036|\3655\330\253\2010\004\032c|\363e\223\236IA\330\177,\rm\310"
+	.string	"\021\344A\364\242.\310\325\360\222\261\253\232\na\373\376\210\233\002\237\220\213u\201vR@\260\252\222\312V\344\376\211\2430\013_4\305*\253\260\327\372\241\024\2611\337\341n\201E~\022/-\034\243\335\357t\023\025_|ug\231\007-\230\351\202\231\007}\323\023\004\336$\036'\001\363\200\213\260]\264\t\224IE\333\274\213&\t\340\216\002\347i\025\272\316\3232\362\373cih\004\034V\037\365\270c~\374\212\005\363\205M\340)\006"
+	.string	"F\273["
+	.string	"u\025\r\034L&\330\306\315\322\025\004\031"
+	.ascii	"i\331'c\372\220\032\216\333\2051\223l\006\002\003',\361\302\332"
+	.ascii	"H\203E\220o\320\031Z8\002\251\266\300\035l\020\206\250\250)\321"
+	.ascii	"\266\251\260]\023\301\207 \b\025\370\345\np\351\026\355|\002"
+	.text
+	.section	.gnu.lto_schedulerOptimizeRate.47.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\025\n"
+	.string	"\026\323E=0\305*\035\300c\373{\371\313\367\211\204\310\221\246\026n\254HP\231\274\3425\013\333\204\013B\035\277aio\r\005\2702Q\206\t\023\r3T\316\304S\362\240<\264\025\260\226\375do\231R2"
+	.string	"2"
+	.string	"5"
+	.string	" \373\230F\252\304\266\273\235\374x\370)5\364/\034\214J,}r\\\032\210\247\231\260\273\037\271\256D\224\352\205\263\273V\225\270qs\267\ra\373\301v-/\373s\245\313>\354WU\237{km\002\"j\273\254\333\201E\341d\"\266\237\261\255j34\204\207\221\020N`\204\235\354\216\013\336\020\234sh\003\370\030\\k\013\0040\311\223/\375\361$\246\371!\306\360L\257:\347{f9\207\3510\351mN\371R\335\335\222\224.\237dQ9e\036)\003TVPj\300\036K*\003\336\250#\341e|@\237Q\350+\260G\003z\025\027\023\036\205G\324Y|:\240\316\003\212:\215\202\277\220\007v\243\357\003\273\314\270\237+]V\2719\210\261R&\352p\323,\227\253\017"
+	.ascii	"i\331\207\324\364\307\262\302ejK\260E\252\312E\343\234\303\r"
+	.ascii	"\256\211\023\231@Jj2p\227\200\001\213*\267]E\017"
+	.text
+	.section	.gnu.lto_scheduler.49.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`\227\032uy"
+	.ascii	"\332\307\020,I \320\332\031\003\177\006\260\275\337\030E\260"
+	.ascii	"\337o'\004.\325\207\rG \020D\224\315\237#\230\005\213>\3708\233"
+	.ascii	"\205\337\375\247\340 \307\032UL\361\030\360\216\370N\334\225"
+	.ascii	"V\313z\206\253n\252\211`\265Y\310G\354\336R\246\224R\246\002"
+	.ascii	"l\002\301\002\256s\320\322\031h\351\374\263t^\3668\373,\235{"
+	.ascii	"\226\316\256\353\254t\235\223Jg\036\327y\307uF.\235\217>\316"
+	.ascii	"\306\036\347V\351\314\272\316\357:\273\322\271[m\305\026*\024"
+	.ascii	"\264\263\207\003\367z-\356\360\266i\315di\303\3569\335\204\335"
+	.ascii	"\201\335~\335}\335j\272\317t\223\351\276v\303u\207\351\236"
+	.string	"\353\246\353\036\346fnCn:7\004\016\312\341\316\241\0139I\b\202\322\326\362\335Jc\263v\0069\007\004d\326\027\362\256\353O\016\031\247\007\233-\207\223\3228\207\202\201|\247\366Bo\320\355\212l2'\271\341p\377\371E\365\033\3666\t\206h:\fzA\332\300\375\246\317HO\311\230!\367\370\366\270\251\312\032\325\255\315\036\273yv]\336\367]\263\307O\250\227\304\207]\233\031:\315T\323\300Kge\270\321\234\361\200\3560\005\344\224\f\215w\244\313\260\233\035aN\216\351\030\230\223\214\244\313\260\317\026\252\332\373\276\311\266\343\276\343$\231*+\272A0F\302\234\354\226\247\2774\230\226\353\027\272\216\2230\264\030g\323\201\240\264\005\367\202\371\240+\323Od\267J\254\n\004\234=w\245\224\005\367z\251\240\363s;\334\300\205\216sv\230$\354;\205{\303^\324\035\272\035\376\200Cv\220\021\016KIk\371n\225"
+	.string	"\303\232\013d\267\334n\375\346\354+\226\222\026\334\373\305\200\035\032\267\303\367\205;\321-\033\200\354v\331C\306n\275\203\214\335\262\223Y\260\341\316\336\376\213\022\225;|\337\227\351\255\360\021\267\357l\020\037\222< \035\031\025\021\r\t\005\001\375,}z\\e\222g\007y4\266\354\273\223\273\256=\205\27188t`Y\r\342\303\265\223\336\334\334\203\340\265\316\213#\261\307%^X\232\357\253\005\266E\235A3S?\252\022fm#\326\304P\021\213D\325k\322|_YX\0225P\211\323DX"
+	.ascii	"\273\370P\227\026\002l\021|_jW<\b\210[+\255\177\320\364T\360"
+	.ascii	"%Z\373\034c\364\210(\013\243\266\313\232\030\214\301\260\371"
+	.ascii	"\276\250\354\220\027\026\256f\373\"se\024V\211\355\013\212'\217"
+	.ascii	"1\312\302\322\232\207\357\353\t\253\344\246E\260}\215\371\016"
+	.ascii	"\033$f\367\246\371\276\316\330\2457mc\315\366%\346H\275v\273"
+	.ascii	"6n\326\2620k\037\223`O7\366\200E\373\016\352\255\026i\263\254"
+	.ascii	"\013\274\024\274z\300\266XO\373\303\241\321\264w\201E\375\373"
+	.ascii	"\256\035\357\314\023\016\035\230\264\375\030\343}_v.\260\260"
+	.ascii	"\346\020\315\3544\230\233\207\331\250)\326\350\335s_\031}|WX"
+	.ascii	"\016\276\343W\271m\347\027c\373/\030\267f\313\353\274\271\227"
+	.ascii	"\363K\373-\207\366\201S\326\016\215_\345\017\214\326\261M\366"
+	.ascii	"6\242u^\365?\276\313\267\372\307\367]\027\245I\003\223\203\033"
+	.ascii	"\300-\257\323\354\373\276o\2135\347L\334\204&\373\0353ZP\236"
+	.ascii	"\353\363\270\346,5\224o(\365IB\216'\3371\264{\361:\024\343W\345"
+	.ascii	"\f\373U>\321\354S\305\261\331\362:\374\317~\007F\025;x\250\377"
+	.ascii	"o\266\272\027\240kc\357\337\301\277\034\224\372\316\r8T\006\362"
+	.ascii	"}\267X\260/\031\301n\006R\255\352\033M\217\240V\335\250oW\177"
+	.ascii	"b\331Eu\217\261\357\276\256\261\346\377\370\026\373\206ny\372"
+	.ascii	"\"\367\3267\277\243\212]\307\263j0^o}\247i'3\033\244\276M\265"
+	.ascii	"|\361\325\214\315\031\376W\361\230\227z1\t\362}\337\026\334\211"
+	.ascii	"\255h\203[\255[\276\201\003\207\261\333\252?N\241c5s\242\271"
+	.ascii	"\353\264\016\234\307\255\3069\030\317\233\213\361\214\3356^\273"
+	.ascii	"\n^[\250n\204Z\276\310E\316\254\203\2077\027\324\273\026\251"
+	.ascii	"\024\304\301\347g1\303=\375\253\314\315\302\t\r*\360\2331[\251"
+	.ascii	"R5\243R6%\310\271\245Di\252;7\031\224'cB\316-6\225\272\316\375"
+	.ascii	"\325~\315\355\325}\315\335\325\321-\036\347\316j\303\346~{N\263"
+	.ascii	"\222&l\276R:[\271sU\0076\037\3513\315\035\00497\233\256\031\252"
+	.ascii	"\3254\017\021\322\327f\r\032\2569H\3035g\320a\232\201t\230f\f"
+	.ascii	"\232L\363\217\236k\366\361\343\334\003\310\371\002 g\036@\316"
+	.ascii	";\200\234u\270\316\026\270\316\025\270\316\024\270\3169\\\347"
+	.ascii	"\t\\g\034Jg\t\\\347\033\256s\004\256\263\r\327\031\002\327\271"
+	.ascii	"\206\353L\343\307y\306;?\340:\313p\235\035P:\307P:\303p\235_"
+	.ascii	"\364\265\331\205\322\231\001\327\271\311u^\300\235\025p\235["
+	.ascii	"\270\316\t\270\316,\\g\004\\\347\025=\316\007,\235"
+	.string	"U,\235S,\235\rX:3-\235Q\3648\027\260t^r\235O\270\316&\224\316%\\g\002\226\316\003,\235\005\350q&\341:\007\340:\217p\235\001p\235E\270\316J\256s\b\327\031\204\322\371\203\353\234\344:{p\235\221\\\347#\327\331\350\235\213\336\231H\351<\344:\013\005^\216\276\312^\224\342}(\005O!\2275D)\202|\006\337\345EC\336\207\206|\003v\216:,\321;\242!\317\254\020\220\307\240\3270c\255\340|5T\315\330\230\355Q\371^cd<\340\201\\I\213\373\333\362:i\016\370\266/\017q\211N\016S\212\276\252\342\241\256XA\243\342\213<p\314\323\214\310\3077`\017\245\001\004\223\203\0335cP\030\206\276z(h\205\211\320\233q\273\351\226\f\312\323\323\266m\005\240\216>\263?Bv\n\265P{Z\372\032|W\220O\361Tqkf\300J\361\255\364\0161(\372\"\320\300\306"
+	.string	"<\2467"
+	.string	"\305/=S\001\217\302L\001\357J\307X\257`j\340\322\004\250\373\204\267=\301\237\245'@\r\316R\031!\277\023\277\364\254\211'\340O<Ra\2117A\246\304\367\032\264k\331C=\001\005p\261{\302\231[{\272E\225\265\224\037\362=EJ]\224\3576O\027"
+	.string	"\317\226_}\"&O\356\220\320G\372\"\240\271\033\340\005\001~"
+	.string	"\022/\200\034\211w\245a\254qX;x\213\207\204`\242\332M\227\260a\261\347\253_\377%\313\337\324\253\277\276i\017j\370\026\305\353\373\257Y/M\022\021\247\001x\231\322]?\342\003\260N\031\361l\242\330\024"
+	.ascii	"\026\250\210\370\020\017\300\033\307(=\210\027\361G\205\320\265"
+	.ascii	"g\226\016\361J\\\250\204\370\026D\233~x\020Uos\266}x\237\255"
+	.ascii	"\035\020\257I\257\245\271\346x\370\243Ozc \224\212\344\341\217"
+	.ascii	"\022\241kms\236\361\350\221\276\241\212O\307\022e\245\307\321"
+	.ascii	"\273h\262\203u\n\365F\337]\317\366A\327\236F\337o\272\2572\260"
+	.ascii	"i\363\374\254\243\2634dn\3217\233\253\340iWN4g\2327\2273\315"
+	.ascii	"\330m\321\267xt\254S\266\323;K\243D\241\211\276\257q\200%|\350"
+	.ascii	"\241\236\215O\364JK>\213\205~\350_.\252\030\364P/\364I\211Y\374"
+	.ascii	",\350\233\360\b\021\223B\276\247/\002\231\027\200\276J\242K\351"
+	.ascii	"\237\007\372vo\371=\377\363FyP6\237_\2329\277\370\274\333D\016"
+	.ascii	"\342\265\347\231\235Z\274\f\213\310\217\r\354\3062\272\337\243"
+	.ascii	"|\367\3331Q\305\344\357\274\362\221\366\240-\360|2\212\263\215"
+	.ascii	"\347[\357\357\212|\250\337\371\343"
+	.ascii	"\036\027'\213B~\212&r\254-\326%\206-<_\345\3062\036\277\313X"
+	.ascii	"\3601\254\343\267\233&\201'\210\350l8\224\371\3558\031\215O\025"
+	.ascii	"\007hu'N,\330S\030\341\352"
+	.string	"\364\222\304\330\255\361[\257\035\255J\027\352\333u\205-L\276\220_eo\275Iw]\323@\273\022\2753v_\031\033M_ &\f\205\202i\244i\305$5e\304\310\324\323Q\221\"N2\230TS\0330\0358\372!2\325\244bz`t\022\342RS\315')$4\242\236\230PODV\r0\255\220<1C\230a\025\002S\312\215\252r\262b\253x0\2154wXI1\251\250\220<\271E\234>\240bZI\331 B\345\204\244\006\323H\323\252\210\023\323\002&\221f\225\025\222\251$\345\225U\223j\252IE\301S\323\210\223\324\325\003D\230VO\314\"\314*\017UQUN;8\220jZ5\235@P\362\023\n*f\021$D\230POULRM'#LOTUL(D\360\224\007L*&\253\251)*\246$\234V\277\031s]#\323<i\243\365O\020M\016\365\334\243,H\217\241D\261\243-7"
+	.ascii	"~\270\340\245\360\035\217\327\361\027\334\265\335\2336)/3\214"
+	.ascii	"\305\305\303\255\367\325\032\261\343y\260\351\370#\277\343\215"
+	.ascii	"\002\241k\317\021\026\237\214\357t|KG\354\232\365O\260\240M\337"
+	.ascii	"W\362\235\365MrP\303\254\027\213B*\276\337t\232\365\302\305\020"
+	.ascii	"\321\202w\242\344+x\013\236/\255\340[C1\n\036\205\034\177\343"
+	.ascii	")\370\266p\202\307\3619\036i\357\306O\360 $x\034\017\346l\223"
+	.ascii	"\340_\374]\265\226\274\327\215o\013i\210\340\231$\371\331\370"
+	.ascii	"\032\037\301\033\363 x%o\343\215\022k<\004\377\2410\372]Q5\376"
+	.ascii	"(-\264^\257\236\306+\371\247\361+\234\310\320\344W\3173\236\233"
+	.ascii	"\244l}V\327\223\020d\306\037\245\204\326\253\326\325wa\267\233"
+	.ascii	"\223/J\027\302\364\222\036x\252_\362\300\177\236\234\177b\025"
+	.ascii	"\006v!\224\361\237\025\205t\340_\274\214g\003\255\336\201\030"
+	.ascii	"\017\343\255>D!\224\rF\214\367\220\bm\341\271\350l\2031b\017"
+	.ascii	"\213\r\324\267\253\2257*\214*\276x\250\357*\337\203\315r\351"
+	.ascii	"\033Lt2\307\304\023\243\226\374\372\356\354\305'\245q\020\257"
+	.ascii	":D\365\305\261N\217\374\013=:\320A\006\036\321\331\266\3075\247"
+	.ascii	"\351\031\370^\340\241\276\351\217{t\242\220\357\373b\271\260"
+	.ascii	"\300\037 }c-<V\373\020\247\n|\016I\274\234R\034\222\2009\245"
+	.ascii	"\n|\0136\211\276>\353\224\204\241\342\234\207#!\357\342\b\310"
+	.ascii	"7\265\251o\204\205J\034`S\237]\320\345$A\301)\225\032\273m\245"
+	.ascii	"l\254\323\026q\234$\360,\276\005\240S\314\211\223,\201\337\231"
+	.ascii	"\272x\026\257\201\0328QE\004\336\317)f\\\361\b\330\340}N\261"
+	.ascii	"'N22c\267+\376\355J\034\352\333T\r\351\253\214\025\2553\352\352"
+	.ascii	"N\240\030\231c\325\017\321\240\025[AH\006b`x\322A\276\213Y#\f"
+	.ascii	"\276\353\272\306\337\227\350\335\321\245\r\344\273\244=dhN[V"
+	.ascii	"\234\2727\001\202\013\250\022\3110\317\241\250"
+	.string	"s\310\320\210\310\2144I\032\003B\n\020\006\304\221\036\267\364\006\022\2005E\347\244B\252F&i\223\224\232\003f\250\251Y\256\221z\372W\311K8\021+\255\371m\027\361C\247\237\b\2079I\244ri\224\327\036?\320\314~\320\307{(=\034\025\bAs\001c\305;\214*\002\344w\230`Z\254\342\250\ri\321\340\364U\233\021\304\026x8\352\203\262\030\343\302\221<c\020\211\333\n\r\025\321\266`1 \206b\021\240\227\211\201 ZT\333G\323\226?\227\234\n\3074\017\216t\361h\0342B5\363D\215\026zt\255)\230\325)\354\256F\224N\216\302\316\024c\372\325FV\334\243\241\351\224:P\337\023K\222\260\374\306\225\305\017\355\327\020\037\253\363\261\016\261\333.\fy\203Z\303\256T\031\3561\3379vx\367 m\016\334\312<\323i\202\230\266U\\'*\223\370\250\375\021\203)\364\025|\237U\211\321\207\006"
+	.string	"+97\032\034\013a6\256~\306\225%\270F\221\361\344 \273\234-\371U\364\357C-j,6\364\222\324j\n\364{\306@x*\210\032%\214\360\350\224\325\007_\261Ex\231!"
+	.string	"\003\302(~P\004\262\344\271\032\310J\r\323\360\240\355\247\342\305\277\243p%\b\221f\242i\024M\306z%\352\007#\242c\261e\026P"
+	.ascii	"\271F\357\026\216{\272<\364\345mF\223y\213\337\375\bc\363\027"
+	.ascii	"\246Vy\34174\227HK\224u\020\343\223;v\207\246\311a\027\311C\322"
+	.ascii	"\013g\306&\2349\\\366\376R\334\027B\245\005*;\204\032tH\t\243"
+	.ascii	"!\350JA\217\234\272*K3\200c\316\t\260\003\351\034bg?\275!\005"
+	.ascii	"\354\365\027#\"\037\362\262}\201So\016\236&\b\230\235P\217\201"
+	.ascii	"b\021C\322u]\315\202l\254\005&R\230`\351w"
+	.string	"3\206\311\221\034\300P\231\333\036\346\250##\034\"\313\313\341\025\232l6\363\001W\346\020\227\236\021\214&\2006jw`\313\257\356\333czPO\331\202\362:g\0250f\262\205\253\023\302\210\026\005\247\206;a\026\r\230\203\221}6*\223\007X=\377$@|&\333\364[!\307\245\223M]!\237\013X\324\301\375\302\036\220I\\#p\332\253D\2468}\310\3373%C7129@\261\311\250[A2\276\213\264\340H\271j(t\357\207`c\214D\252o\002>\231\310\n\037\217\276\314\240\224\"\024\007\340^v\351I=\007\216\202d\250\223\351\022\236\211\244#\360s\356\033\003\333@6\002K\032\363\243i\373Z\242\362F`\260\311\r'\304`g\211\244{\022\362\324 (\264\210\027\264\301\251\250^\032\\\242\340\250\245\247\304t\002\f\333;viE\352\354\250\346\270\257&\t\253{\371\214\354\300\376\252\353\315\374\020"
+	.string	"&dt,\337[#\2261\023^\337\262Q\214\001nh\201^\355\330\245M\013\360\302E\340\033\235\263MU\361W\356\226&\331`3\320\317\004\346-\017\213F\031\213f\352\350I\277\312\340[A\002\r\013\312N\342m\347=\177\245i\335\327"
+	.string	"K\207\257\001C\2335\223\264x^\301MB\3629S\303a\325\246{\016\306\217\350\332\004\327\303\212@=\223\216L,\006Z\204\035\024*W\352\245\340\301/\215\346\332)\202\347\220\335,\233\336\367\260e\350\344u\241,\343w\016\276\n\220$\005\364\370U\354K\232\300\035\2320\272\344\026\024DiG\273\374\227\325\314\027\025\3533\360\223\270\212\205b\313\207\236\345AI?^\376x\034\0034+*\211\235\376Pw\246j\2306\204 \320\021\235<p\267D\246"
+	.ascii	"-]>\371R2aP\377\321\316\217\035\316!y\341gP\245H\305'Q\313\235"
+	.ascii	"i\003\3515\344\211\344\274\2253\223\b\021\255\304\004\216@V\330"
+	.ascii	"o_\373O\222=\323\242\366!\033\0258\312Se\302\252H\314\342\310"
+	.ascii	"XJ\341|w\264\342m\3207aQ\236x\363\335k_\n\007"
+	.text
+	.section	.gnu.lto_rescheduleTask.part.0.56.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`\007\003\215\023"
+	.string	"\206!uI\320\322(\035\222X-\216\274~\270\201\3443|T.o\303p_$d$b\347lk(\235\214\371p4Qp|\260\001a\333[8\243b\367X\345"
+	.string	"/8*9*\002\003\220\366\3212F1\206F\021t\230\312f\t\331;\245Z"
+	.string	"c"
+	.string	"]"
+	.string	"\346kX\274sg2Sj_\305W\274^\303b\220]\021F\270\335\023\301?'"
+	.string	"\377\235>\240\364\317\273\200\322?\373)l\2332\277l\035?I\354iF/4\036\273+\376\253#\376z\245\336\313\217\3152\274\236v\032\233u8\r\271g*\331]\203\036\356\357\266IlG\260k+\367\361\177\034\362\320\351\374\205\037\343<\016wr9\367\234v\270\007 \316\364I\303\302p\317\027f\277\241G\321\221nw\033<\347,\374\233\315|\315E\t\234\013#kq\027\257\327\\_\027\031H\254(\207\316\344\004s\354\320\206\3726\246Osh\37387+t\301\302>\034\370\347z\263\242S\002\376\013M\351\317\265\326\363\334\304\247\004\322\313\017\237\3505\\>\215-\224\364\261\262\364\357\365\267\0338\221\204\"\006Fw\264\316\270z\367\266\312\330\037\265w\334]\177\376\364\266\373\246\020\005B\273\034v>6\304\2273q\333\277\363\343~\240\177\350\017\372qn\262\357\313x\220/t\032C\3771}f"
+	.string	"!\351\002\250\023*\341\204z*\006(%\252U*G2\305r\240\032Y\344\n\202k\245\022\300\251\021rE\341\202j5!U\212*,T\212\230\"Kq\244\200\307\n+Rl\215#)\206\367\266\312\370\264\203\265\035D\260\332\342Z\353\214m\257\332(\277\221\002"
+	.string	"\307\356\222\37060\214>\215\353\366\2030\212\021y\255^\0259rIj\241;\323E\250\221P\246\220\"\024\314\004\222\206\342\264p\200\002\031\232<\007\022 w9\212\331\344Yna\375m\353\201\231>\"\230\201o\nE\244\021\023\207\214py\261=\022\362I\213p\313\361[\220y%\353\226}\203\236\221\246\013\237\f\361\362\367\024\037'\007\005S\003\177\240"
+	.ascii	"\0253\333_\311\312B\344\311A\346\271_\236\307\264\03084)`\307"
+	.ascii	"\317Ba\371\374\035\0213K*%H$\005\233?\034\347\030\376\316QZ\311"
+	.ascii	"\303|\236\217\317%\201f\035\032\315\032[\020$_\027m\370rx\n"
+	.text
+	.section	.gnu.lto_setTaskEnabled.part.0.57.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`\271\002\345\025"
+	.string	"\226h\216H\3000\2511\332y\204:\264\335e\363|\3071;\325?\032l\353\007\321\007\021\352D\304\377\356\367k\3121F\034_\326n\2474\005\241\n\325\255\337n\233\242\3502|\240Pf\240C\304\013\214C\262sik\226l)\245L)}"
+	.string	"u"
+	.string	"u"
+	.string	"\267\366I\330\376\t\r\264g\274\034\272/z\325\024o\334{k\267T\350\300\313b\260\321V:g@\377\305\213\210\260A\016a.\013\211\301\204.\320\370\271\331pX\035"
+	.string	"\243E\b\021\036\237(\332\260f\216\365#XD\376\205P\247\216pU\325\240\231v\222C\234\327\331\020\347\264~h\001\311\350\030\316\324\221\036\254\f\227\372\264\031\312\314\031\3403X\203{\257\037\263s\323n;\310\266\003{2\005^\267\203\265\372\360\250\337\276\337t&_\312\264\250\337\241|\023\244\2747B\337\351O\300C\371~i\2042r\353\213\353\336\322\300\255O\312X\361~\361g\323h\256\363K.1\371]\311\345\345\r\326i\227\230"
+	.string	"\257\344\002\362\256\254\022W\nb\267\236\363\345\357I/\265\274C\241\347\264o\342H\300'\275Xv\357\217\023\325\275\345\201[#\210\335\022\370\307x[\3571\006\226\332\330e\254T"
+	.ascii	"\017\220Mq\025>\237\310\022RR\306[J\031x\320y\021\331\223U)\321"
+	.ascii	"V\276\223!\322v\205W\345\3364t\357]\200\342T+>\321\255u-\363"
+	.ascii	"\344\255\3372\336Nz2'f~\231~Vui\371PJ\264\307_\306S/\r_K1f&\216"
+	.ascii	"I\211\246\263\327K\203\354qz\264\323\366K\177\265\323\324N\317"
+	.ascii	"\227\377i\036\005\260\356\r~\0059\236\255WQp*\021l,8\030\312"
+	.ascii	"\203\034\317\326\033}#\331\341T|(\270\t7^\215%\305\266R\273\355"
+	.ascii	"x5\222\020\353(\340v\265\236N\267\253\321l\317\373\261)\016Y"
+	.ascii	"1TF\006!\307\351i\013*\006`Zj\333n\363\244;\2460d\315P\230#\243"
+	.ascii	"\235#\030%\2327\216\364F6\356,x\261{o\002\377\252\227\363\211"
+	.ascii	"|\343\355HaK'F \255\260\020\0041R\242g\245\224r\271\310A'\r7"
+	.ascii	" P\002!\311\352\016\355\366{.n\203\361\027\342\314Dln8L\022\366"
+	.ascii	"T\350\023.|l#\325\001\273\031[I\230M\244x\333\345\3440\370\334"
+	.ascii	"\221O\363\234_\203p>\352\f\241\037\b\270\274\020O\236\033\341"
+	.ascii	"\211\321k\005\274\301\330\333\257&\bcp\n\371\275\b\304\306\213"
+	.ascii	"\230\264\200w-v\274\262y\262>\263-\260\234\267/k\220\367\275"
+	.ascii	"~8,\020\302\341\251\206\326\036\360\270Oy\370\033\254\235y"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.part.0.58.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`H\001\375\013"
+	.string	"\226TLC\020\213L:\340\0322pR\270\002\210\276G\264[\337t#\215\251@\215S\3559\00145\336\200\023Vc>KD\013?\321O\332"
+	.string	"d\002\200\204"
+	.string	"\204Pk+\261\0012SAL>\003\3716\222M\366N)5"
+	.string	"8"
+	.string	":"
+	.string	"\325\376\001\333&\225I[\303K\327\236\006+\231\335v\027|\245\004N\236\316\216\364/\273%\265\"9uX\235|B\274\243l\354\256+"
+	.string	"\356z\333\030\2663\366%\004\224K\006n\327$\207\333"
+	.string	"\325f\300\366\355\313L\366\367y\316\227\246\307J]\271+\225\347\264\217\3400\362\261\222-\273\002*\324vK\213W_T^).\341\275v\277x\017\006\375\201\203\006_\002\f/?\344\331\341i\241\211\214\355\221/\030#\\\273\253\241\340\263\221_\340\325\"\244\371\324\253O\362^\037P\027n\033N37i\313\264\353\226\262\354\227\377\003\034\216\317\250\021y\336`\304\316\307\210\323\361\330\214 \210G\003\0027\342\bb*\034\206tDP\024\206\"\370\275[\312rG\314\302\211\242L)m\331\236S\230`\033\220\341\365y-\002\204\333\031\334\001\" \300\202!\034u\251\366\205\211\215\3544\f\331Sqh\206\301\335\007\333\335\233\313\211\307\301d\235\020\341\304\216\353!\tq\361\340P\333\340&\332a^\327\026\245\221\323Z\034-\235\311\231u"
+	.ascii	";y\317,\240\275p9\325\351\327\2561"
+	.text
+	.section	.gnu.lto_schedulerResetTaskMaxExecutionTime.part.0.59.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`\252"
+	.string	"\235\n"
+	.string	"\006\223E= \005)\035 \213C\024\304\200\001\024\006\261\363j\021\013"
+	.string	"\270^9!\001A\317\310\245\262\036\267\365\272\377\211\205PL\324_"
+	.string	"\300Ku\033\252\260\022A\303\0251\007\202h\225\354\275wJ\0011"
+	.string	"4"
+	.string	"3"
+	.string	"\257G\261\255\362\260h\327|\204\355k3\0344"
+	.string	"\273\353\275N\223\213\237\222\212>\253\245\361\371\331%\253\365q9p\032\340\260\273\346\200\334\365\376\330g\b\001\226\244\302\234\\v\373)*\177\346N\246\372\230\222\017\273\nIx\265\224\366U\276\"~LY`\267\204\346ewTx\365\002\347\325\340\004\334+}\207{\355\002\273\037\277\226\021\3721\024\367\212 c\343\267\234\206\362c6\235\344Y\257\376\211{\375\254,76\221\225\274\311\371\362\244\247;]\366\224>\3554\214\354v\334\002\"\b\212\020T\342\034\362\200\243\n\223h$\021\n\275\213\t\220\205\027\002C\317s\340\017c\004z\245\357\003\275\316\266<\335\351r\204-f57<\347|\231\304\331\337]H\005\260\r\030"
+	.string	"hm\321Y\326p+\337\230lb\242\005\025&E\205\007\210\202a\256peM`=:\n\301x\236tO\323E\265\323\271\240M\227\235\013"
+	.ascii	"'\236\313\350\230w\254\264:\346\340"
+	.text
+	.section	.gnu.lto_.symbol_nodes.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`\313\002\235\016"
+	.string	"\364\024\307\003"
+	.string	""
+	.string	""
+	.string	"\0028\177$\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\017%\200\204\001"
+	.string	""
+	.string	"\003\002:\177&4\030\002;\177'\002\032\177(\272\200\202\002\031\025\005\026)\005\027*\002\033\177+\252\333\3426\002\034\177,\305\245\376\322"
+	.string	"\035\177-9\177.\002\036\177/\037\1770 \1771\005\0232\0223\0254\201"
+	.string	"\002%\1775\005!6\005\"7#8$9\002&\177:'\177;(\177<\377\377\377\377\003)\177=\002*\177>\024?\200\003\002+\177@\021A,\177B\002-\177C\002.\177D/\177E\005\030F1\177G\252\331\227\005\020H\0012\177I\037"
+	.string	""
+	.string	"\200\200\200\0013\177J5\177K\003\005'$\003\n(\227\356\322\027\001\304\013\003\013(\363\235\316\032\001\344\006\003\f\013\312\345\311\310\002\001\242\006\003\f\n\267\232\266\267\001\001\202\006\003\031"
+	.string	"\340\236\212\256\001\001B\003\032\f\002\001\302\001\003 \002\321\360\372\250!\004\"'\004\001D\003\"\n\004\001\242\001\003%)$\003%)\235\332\250\031\001\244\032\003%)\334\222\302\f\001\244\252\001\204\253\001\004%\264\321\270\231\001\001\265\027\004%\365\252\001\004%\352\353\264\031\001\325\267\001"
+	.ascii	"9 \240\002\031:\272\030\342DeI\230}\273m\205\305 <x\036\003Y"
+	.ascii	"\310b\030\251\207/\0201\2714C\022\346\260\376\0072x\030\fB\245"
+	.ascii	"q6\206\036\353G84\221\216\\Lx\2555<\177dz\21087\021v\214)\224"
+	.ascii	"\300\0303f\363 \034\206#\351\331\320a\343\356\030z\254\376\220"
+	.ascii	"A\200\366\220\266\005\340u\fIz,\321\3253\230\030\341\3541\320"
+	.ascii	"c\360\340o\001\351\017B\242\244\021`\232\332\227\001"
+	.text
+	.section	.gnu.lto_.refs.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"\025\t"
+	.string	"\306W>2`K\2224\006k&b_\001\200\342\207\t\"\b\202\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250u\032%\340\317\243\250\377\367x\213\254\265\366\177\267\370\375\243\375\255\221\3266\221)."
+	.string	"."
+	.string	"4"
+	.string	";\234m$\024\"!"
+	.string	"L\212\263\223\264\221\204R$\264\221\256\364\234\215&\343\274\024\002-gQ\263K\210\251e\227\332\252E\265\253\241\345\036\2045\244\236\250\237:\242n\324\311YH\200\2433\231\221\\\221\007I\261d&vyl=\273g\200\345\322\224\250(\275f\016\2646*\024\201>N\222U 9A\345I\263\217\364\323\254D\363\202\201\240\2620v"
+	.string	"]\234\241d\200\271\324\n\214"
+	.string	"\272\213\026\350*\253X\246F;"
+	.string	"M5\312Z\324\0255\245\226\004\357A\345\0372\266\207\213\335!\343\034\2667<\266\206\3073<\033\303\363\013\351\026\232]\2419\005\214O\200l\t\220G\210\254\203\310\r&\313`\362\202\016"
+	.ascii	"{\023\360\260\302T\r\2751\207\1776\367,\313\372\357f\302\242"
+	.ascii	"\372\212\272\204-\214\3014.e\333N\023Z.\013"
+	.text
+	.section	.gnu.lto_.decls.63a866282b3577ee,"e",@progbits
+	.string	"(\265/\375`\234&\365\243"
+	.ascii	"z\371\2406M R\322I\007\\kUt0\377\352k\025\021\335\374\017\336"
+	.ascii	"V#\375\254\253\313-WQ*V\0044\363\027\274\177\335\357\211\241"
+	.ascii	"lx\333_\340\366\233\247\312\203\252*\255\252\252\252\314\020"
+	.ascii	"U\2316M*,\242\244\"B\204V1\213h\207l)S\275\002u\003n\003A:e8"
+	.ascii	"\fx\216\303\177\267,N\005\3158B\204\367:\t1\237`>\221\026\341"
+	.ascii	"\365D\355\251\276\307\374\372\230nLtG\247\334\3072l\221\362\246"
+	.ascii	"S\346k\336c7g>\326\373\201\272\314\227\336\353\304|\"\210\371"
+	.ascii	"\304\216\033\230\223\226a\372\216\242r\036G\203|t\261q\265\365"
+	.ascii	"LA\362%\266D\3452\276\263S>\232\027\355^'\321\260\316\033h\230"
+	.ascii	"N\371\356|?\367\226\335{\017\b*s\353\033\354\364\200\034\255"
+	.ascii	"\341\326D\360\210:\324L\225\345x\216\241%\230\356\023\270\270"
+	.ascii	"m:s\226]]}5;}S\251\347\022C.\344\022\303\263\034\365\234\247"
+	.ascii	"\266`\022C.\303f\030\212\202\317\234\335x\314w\234\234\327\331"
+	.ascii	"_t\322\264\320\251g"
+	.string	"\024C[X\310(\206g1\352\020\223\0306\217\030r\030fc\350\335X\314\025\022\"\003xd\255\323sT\355\201\347n\303\263\024\325\004#Q\317A\324\263\224\372\034j\013\031\324\207\240\362\031kah\n\336r\316\302\316\023\241\234\367y\257S\350\307I\310\027\272N\277\201\372\377y\003\234\256\213\217P\317)\206B\234b\370VM0\211a\352\234c\022\303;\231\304P\345\021\303\033`\376\3637T\350\356Z\026\222A\212\335\377\302\237\373n~\346\371\031H\375y\347g\346\301\271\237\005\357\300\377\276\377\007p\340\233\237\375\332<\306o\177x\372[\035~V\346\235\304o\225\204l\3405\227\237m`S\324B\203]\277\363[\032\350\334\347\267@\334ua\fv]\301\177\302\237/\370O\347\347\r~\376\317\032\374\334\363\263\213\237}~~\361\363\217\005?\333\2373\370y\3703\214\237YL\360\277\016\005B\227\340\267&\374\354"
+	.ascii	"\212\024\r<\350\267k\324\374G\361\236\337\n\361\374\326g\370"
+	.ascii	"[\036\032:\200\376\376\373\031.\315\317\351\f\377\017\340\001"
+	.ascii	"\200\277\335\250\177\267Y\253;\361o\267\237\343~\016\363s\226"
+	.ascii	"\237\257\374L\366\363\330\317T~^\177.\376,\366s\224\237\237\374"
+	.ascii	"\f\3663\223\237\203\370\371\205\237\223\374l\344\347\255\237"
+	.ascii	"\207\374\234\365s\220\237\255~\356\3613\325\317R?G\375\374\364"
+	.ascii	"\363\375Y\307\317<\374\314\364\363\361\347\244\237q\370\371\306"
+	.ascii	"\3177\374\\\303\3172\374,\343\177\n\377\003\177\346\340g\025"
+	.ascii	"\377\317\374\277\373\271\304\177\032?\017\360_\314\317)\374,"
+	.ascii	"\364\177\313\317{\377\351~.\341g\021~\006\341\347\017~\366\340"
+	.ascii	"?\n?\307\370\271\203\237%\3709\202\237O\374l\342\347\004~F\340"
+	.ascii	"\347\242\237\001\370y\350\377\214\237\211\376\237\360\377\355"
+	.ascii	"\177Qaaa\341\3173\302\2773\370\027`BN&\246\240\272\230SO'&\321"
+	.ascii	"\324\263\213y\237]w\350B9-\251\240\356\222\350>\273\374\356\263"
+	.ascii	"\311\034\232z6\231S\317\256!\\d\312\356\f\263K\237\327\020n\232"
+	.ascii	"\202\272VUE\234\226CsS\316\346es/\243\355\270K\005\356-\322\\"
+	.ascii	"\262q\312\342\265\2479\253\247.NMv\336{\t\250z\362j^\250\271"
+	.ascii	")\261\346\275bO8nU\005M\316\271\313\204\347\232\220\024\271>"
+	.ascii	"v\334[@\325\275M|\347\356\275M\367^\236e\021\347\275D\206\246"
+	.ascii	"\302\252\252\356\325*\252\272E\232\302\354\270\267\321\362\326"
+	.ascii	"\230SO\257\246Q\230-\317\260+\345l\342\260\313\246k\251>\233"
+	.ascii	"\314\256\217?5\214\211\365\346\013C\373Kk\025\235\335\246\236"
+	.ascii	"$yZ*R\302&S\256\263\013C\273Ks\021\247\356\375\221\002\312\262"
+	.ascii	"\216P\360.\227*\236^\265\032\017o\232\234\351\364)\224\332iO"
+	.ascii	"\317\232@\326I\b\034\230N;J\264\3733\2026g\013\373\001\tV\315"
+	.ascii	"9\241O\365\313\232\036\034g\017[\226\217\255N\243>h\316\b\307"
+	.ascii	"\234\t2\2330#h\314\234)\025\220&\276N;"
+	.string	"\313\224%D\254\360\251\347229`\332\213\243\032\f\016\342Mi,}\245\251t\225.\242\245\264\225\026\353\261.ch\223u\224\262~\302ml|.\3108\256\3030\320\313b\023$\34374\362\262\330\004\325\230\271\001C\310Q\236C\373\240L\020\f\031\317\241q\030\2259}\024\2205\024\346\013\262\367r\265\tSC\306i\270\255\205\275,\266\"\242[\217+}E\251U\003T\307J\2359mN\370x\310\306x\241\2015\021]W.\254\323\376\362\031\022\310\006w\246*\351%\315\244\207`h7i$O\235\367va\302\2672/4\235\204\243A\304{\273\340\214\232\260\231\002g\262\330\306\356u\026\375`)\ft\366\244\267PT\266E\272P\250Pb\270\224\t\301f\370\246n\254\253YB\310)\244\n\311\021.\270\246\226\270N\337\\\177\027i#\315\344\274!Wo:%:\265\210\030\275\267\210ir\206 \323)"
+	.ascii	"C\264z\352\324\n\335t\372\326\372[Hg\365\362\2479@OUa\2258\235"
+	.ascii	"\376\314e\022C\237&\217\0306\020\243w\220\021\303"
+	.string	"\245\226\363\242\0051\255@\325:%j\254\024@\203vOc?\230?frq\240:\375\233\331\313~\202\021\022\330i_\025\r\267\224L!\323\351-\226z.#\303oANC\027*J-\314\f.\354\na\034\226\264\267\260\277}tU7u\017\246\323OM\325S\\\247\255zGGqa\337vj\250\226bh\363\370Y\016\317y\221\363^(\247\027\216z\t\373\302\321 (\347e\362@\273d\261\t\016\216e\261\t\242i\036\f\307o\326\271\246JA\323&p\321<8\216\353\202\232\234\367\252g\r\226\247\321\033\026\3449-\347\375\321\003\265\222\305&\250\326\345\013\036\373\355XC\346\374\031\013\032G\243P4\\\326<x\r\263\201\261cI\224\212*\353\273\327y\n\322p[\020\324\320\205Jr%\f\314\032\267Y\263\245\252\226\204K\337\275W\355\315\203\271\034\2145[\336\036OQ^@\341\220\331\022\274\367\026A"
+	.ascii	"d\345g%\305@\372fSw\356Z\232`\240\020\031\220!\210 \206\2313"
+	.ascii	"%w\202J\322\342\274\322<uj\267\330(C\377f\321\036\304&\225\366"
+	.ascii	"\246\247>\b\376\333\320j\271}\376D\"\033W\222.5g?\221G\315n+"
+	.ascii	"LN}O\231,Y\226=Q\365\312\225\316+\201\325WG(\350\343\245\004"
+	.ascii	"\213\357\212zk\205-\231%[\353i\252-\370n\303\2611\013\306\314"
+	.ascii	"\265:\3021/SYw\235\276\207\007\025*\235W8WG(\350\303\304G\363"
+	.ascii	"\214\320\212Y\261\246\033(Pl\224\026\201\313:B\301\035?@h]\224"
+	.ascii	"\346\302m>\306\250\301=\201\332'\314\307\316{%\264\327G\204~"
+	.ascii	"}Y\260\350W_\372\306H\031\033\021\267`L\364\202\264\351R\242"
+	.ascii	"\3042!\336&\277\n\376.\021.\252\316\233]r\313\204\333|\270\322"
+	.ascii	"8)#2\217\034\261I\320\372\326\304\270zX$\267I\310\324E\251\353"
+	.ascii	"\324z5\227\024\013+\252\327e\263\326\240f]B\244_p\326\3324;K"
+	.ascii	"\020\032\235\247\277&1\312\210\0210\373\366\205\316\025\274\255"
+	.ascii	"-\"x\234X\361R%m\310\020\216\246_aC3[i\200\200eeq\224\227\352"
+	.ascii	"\026h\223>\336\022tja\251vi\2276\210z\335\372\204"
+	.ascii	"\266\320auY \267A\032\260iw\304b\025\240\245\204\214\305\262"
+	.ascii	"?\204\242\2305\031\322_\326\317\210\2319\313T\235\324[\037l\255"
+	.ascii	"\030j\255\370\255\235w9ts\313\250\360\231R\205\204\017O=\363"
+	.ascii	"[\017\333\243\321\364\302\310\250\277\245\262T\215\226:/\263"
+	.ascii	"\007l\215\007\213\224\024\337\261\326\006P\252>*\036{p\236\250"
+	.ascii	"6\312F\331\2474\204aAiq\313g\022\353t\353d\237\3726\357\r\343"
+	.ascii	"\211>\265\351\003\312\n\263c\312>\365_\004Zf\222\020\231c\357"
+	.ascii	"\234.$$\354B\265H\316\231\216\r.\321\252\363.\374\335\032'h\235"
+	.ascii	"6\235\346R\bF\265\305|?<~\210\341\352\364<=\324\017\001\007\007"
+	.ascii	"/`5E\360\262\360\002\003\033P\275.\234u\204c\366\211\307\026"
+	.ascii	"7\247\366\3655\340\b\001Hi\356XA\345\306\300y\003r\017\232\232"
+	.ascii	"\2278\177"
+	.string	"\335\027\335\213v\332o\202\356\310\350\371\365\325N\336\037U]\247~g+(Qol||w\373\234\260\247z\025\334z\fm\275\273\245W\315\253\342\303**\036^\347\031\205\325\021\216\311\001\341\341\325i\036\021\252\232\266S\323w\007|\337\355\324\2119Q[\263\246\351\206\356\323\035^\230\212&/\315W\247\037R\251\337\221S\343\272.\256\351\344\344\232.p.\325\353\373\3622\367\246\263p~8\361\302e\200\302/\2513\365;\\\352\373\f7\0324\315,\362r\235*\276\363C=7s\310\326d\330\332\314\360^v6\257\226Wk\231\342\3572o3i\232,vlz\255\303\274\305@[L\217Q\233\356-\202\323\322J\301P\240iY:\3551\037B\241\020i\353\264\333\232\013[\331\303\373j\264a\334\025\241\234N\277\363\244>\335S\373\037^\247\345\275\367\307\216\363.\237~\206\274\303\234\342\007b\313\n\\\373\237"
+	.string	"\033\3676y\351\203\243J\001\343\264u\023\367\237\273\027\252\253\251\203.&TW\326\324\263\3536A9i\"Z\336\256\246\251\347\275D\027\n\252\351\203\346%\232z^\346\215\252c\362uv5]\250\346%\272P7\307\261bU2*Y\034\227\224\224\226\216\bH\272\220C\351\210H\300q\254`\221D\256;\030\221H\005$\227\220GF\245\241\322\252\304s\034+n\034\215He\222\305\212\304\224tt4\262@&\231X\b\220\224\304t<.\035y\2245V\037\214\311!\017KH\034\312\245#\217\215\342\232\224*\327\244\322\2524\034\"*\327\244\r\033*$\215\311\242\007\307%\243\214\034\007\254\312b\013\253\017F%\2432\207\n$\224\306#\t@9~\220HH2-\031wX\221+(\327\033DGI\305\243\001\230\222\2122\224\353\214\033>($@\303"
+	.string	"\002\224\353\215!\345q=B\256+\024\021%\327\244\034J\305\031\311\033G\243\322X\204\241\b\251\270t\202\322\252L\352\230\241\354aM\201\250L\"\215!\220XwXRZ[\360AB\212\241&\217\306\242\362\270\004\264\372`\234\001\224\\Z\341\007Y\\\223d\350\320\243"
+	.string	"\n\017\034\220<2*\2233\326\344\332\002r\001\345qE\"\231\216|\202Z\254P\"\2139V\254H\022?2\"\327\343zC}\005/$x\001\243\007\236\303\300\240\005\006-\206\207\201\201\221\021\006/\214\324\2770\262I\236\037\351(\"\2211V\246\225\211\205\240\265\006R\217\262\306\004\024\374 \255I7\024\217 $\215\304$!e\215%\033G\022d\3308\"\032*\006\240\254a\343H=\216\023_\312\261\"Y(\227\226\220,|\222\212\312%%"
+	.string	"\310\"\216\243tU*\246\220C\262H\343\006\246\244O\322\322\222\0075v\216V\034G\304\243#S\b*\322\222\021\271\256\200\004\244\254\001\203GYT&\203t(\215\310%#r\205#\243R\361\250\003IHY\343\205\221\362hdR\2231\200\2245|Ve\361\204\034\222E\345\210\244\342\361\206qF\2202\006\322\2124&\327\017\224\311b\022\320\232t\244C\306z\243\210\\w\210!@Q\231\264~\240\3044\343\306\321\270\303\222\022"
+	.string	"\312\032I\027V%\243R\275\221\221\f\023.\244 \202z\264\002\271&1!\2558\216\222,\216\306\242\022\213#d\222\305\n\023\253\222\221\306q\311\250d:Z{"
+	.ascii	"\241\207\242\322\320y\272\250t\375\260\203\226\016\211\225\036"
+	.ascii	"\235\302\201c\003\211MAm\350\262,\005\257\026\2208\267\201mB"
+	.ascii	"yJ\334\316tj\0019ZW\007,\320g\214\032\200V\025\253N\367\366\254"
+	.ascii	"\037q\271\374;\201e\373n\375\242V\211^T\234u\343\023GL\311\031"
+	.ascii	"\353\306\362\331+\307\225\346$v\271+C\244\314\371,s\263j\003"
+	.ascii	"\030\347\205w\225w\227\246\rY\342\205G\027\304%'\r\034\233\302"
+	.ascii	"\036\261\277'\203wm&}\352\r\322\261\343\267aV\324\034.k\032M"
+	.ascii	"M\343\233\353\241\306\306Y\221\315\031\302\246\261a\346\262\024"
+	.ascii	"2\351t\356\237\263t|v\257\206Q:\262\037)\324,)V\250\350\242\251"
+	.ascii	"\336\230BB\"bn\335\304\3308\241\345\275>\256\205\272\\raD)*<"
+	.ascii	"\342\312\334\306\335\302\035\207\330\262\245S\213\346\366\013"
+	.ascii	"\223\277-So\366\013\024\275.u:\265g$0\"G\bB3_R\0076\245\323\266"
+	.ascii	"d\252\330\246\030\351\324\216\271\033\240.fK\212\264\371\374"
+	.ascii	"Pov\0135\263a\254\335\317m:\273W<`\314T\211#x\247\264R\370\230"
+	.ascii	"\3650\243\353r\033\346vm\002\027\337S\307\250\3309uj\301\334"
+	.ascii	"~\321\202c\353\363b\277\374\304\036)I\236U\376\324K\240\236\t"
+	.ascii	"a2;\265\\\276'\266\347\303\257S\253v\267\037\255\203v\250\342"
+	.ascii	"\3710\007\202\205\314\314\210\210H\222$\351r\n\020\004ci\032"
+	.ascii	"hn\007\022 \0055QJ\206fdDD\222\224\221Bv\326\302\026b\337M\304"
+	.ascii	")F\007x\346=\303\322\353(\302n5\246,ka\276\254\0222\302Z\240"
+	.ascii	"&\201s\207\364#n\251\252\273\335\333\006(\b'&\247\347@@/%\370"
+	.ascii	"M.}\3172\026\303\210\356\363'\177S?A9\027\323v3\202\032\356\326"
+	.ascii	"Q\"z\001\220wdgg,\322\244\362\r\337G\301\366\273\305to\256_`"
+	.ascii	"\310\\tO\306\t\213\310p\226\324=\254\373\n\013\307\226l\355|"
+	.ascii	"\252\240C^F\001\345|"
+	.string	"\356\nU.\004mEL\355\005t^b\322\340z\224D\302\336\207\351\315\257/\227:hR\317\347\331\f\201P\373\207y\177\336\350\273\247\207)\213\235\362\256\260\322\026\037e\220\001\033$h+>vMP[\002\202%*\210\337\020\024\321\215aqW\352\020&q#\204\360\013p\314W+\200\3652\242\272d\222\302o)Yf\3310\271\345J\365\270\232^\027\030\326\241:\030\203\006\267\226\255Q\202\347\222x\003Q\347$g\343_\343\3438\306\260z\243:#\304\022\310SF\034]gf0\374wV\217\3713\212\372\r\317\264\351\366\265\236l\034\302\216\025\2664\263\260\2759\t\315g\340FI}\306)\031\354\361+f\203v[\325A\023\301g$\375Ix\030S9c\255\31522\225l\262\205\n\204\263}i%:\237\274\001\032M\311\"\315\252\303\346\216 r1\022\203;\226\303.\325\364\367k\244\200E6\224\275L"
+	.ascii	"\332_\237sj\f\022\365]|\213^\034\022\227>vq\326\344\246\336\020"
+	.ascii	"Z\242\262=\340.\203\222\345\322X\215\226\3314p\252\356\372M\364"
+	.ascii	"\314\240o\251\203&\242\222\306\020\214\243<"
+	.string	"\f4\206x\207\275X\246\001\233\231\342\277\273`\213\363>3\231-E\307s\371\315\222*\375t\f *\241\202\361\301'\327d\020H\336b\213\367\020\366\347\r.\336\3550\253\016\200\024\023\207S\210N\264\363jtc\203\2711\322\226\210\226K\302:\030~\250\205\022\227+\315\252\fS\247"
+	.string	"\311\252\215 \366\364\346{\255\250d=\3514\b\255\356]\262\313v\214\301\005:\301\017\271\013\t}\037\253\376D\025\260\201\231z\024\005T)\214\201\327\330\311zI\243Z\265\032\263\331C\235\245\221\361\221C\364\\\030]_>M0|\366\231\213Qm\rGf\224\242r\\-1\377\211\356\200`\327\013C\366\352\020EI\325\2724T\3460c\236'WN\344zJ\272\327\004yQ\n\001\017\022\360\351\253Y`\035Q\302J h\366k\345\332\224)p@\372\371l\360\300\371\026*7\336\354\375*\026)\013\371\202\354\370"
+	.ascii	"[?\233YI\204P\332b?V\227Ul\25722\354\236\216\260]\325L${\237"
+	.ascii	"p?\031\233\004\365(r\306\222b#\262\026*\241e\341\321zS%\326\323"
+	.ascii	"\274!\256\226\261|K\030F\251t@w25\202\r\240\200i\024\262\364"
+	.ascii	"u\324(\245\201g\364\201\027\204N`jL\224b\001I\204\026\204f\026"
+	.ascii	"\f=\006)\271\0222\2352\244\355\033nx.\235V8\304g\337\035BXe$"
+	.ascii	"\346,\326#v\317\341\264K\3524\245\352\275\202\357\264Tx,'\b\377"
+	.ascii	"\021\313\224\257b\245\332\376\203\311p\241bq\314\330\032\315"
+	.ascii	"L\tt\341\265\020}s\221\373\306\316&C|U9 \350\357\300n\334\304"
+	.ascii	"P\222d2\f\301(s:\2067'\351\360&<\203\030\206K\306\013\bs\266"
+	.ascii	"\tD\025\333d\220\221\357\234\3000\361\024d\342R\n0\361\372\315"
+	.ascii	"\2459\247\274\377-y\362\346\027j`\022\357A;\220\273\247\254*"
+	.ascii	"x\264\337\340\031\337VlO\350\030\305\235\236V\315\202\241\367"
+	.ascii	"I\270\367\231\303|,\302\303\312\237\333\224m\006U,\f5\255\272"
+	.ascii	"\217e4\343ZP\374\203\351\212js\276W\301\201\226w\037\264\235"
+	.ascii	"\371\032m\305\205~\004O~\322\345\232;\312\371)D\211Rq\273S\316"
+	.ascii	"\006\377\330\306FS\201S \377TG\3400\017\335\206'\374E\235\002"
+	.ascii	"\235[u-$wRW\007\217V\317\207r\266a\363\020\302\342\305\243\216"
+	.ascii	"\271{DyT\355\177\245\370\034\230\230\355\n\314\235\220\241QR"
+	.ascii	"~\322\206|\327s\0209Ri\237\256\277ks\007\242@\371\354\317\271"
+	.ascii	"f\362H\231\350\270\025x\373\0235\201\243*\362\270\331\004}|#"
+	.ascii	"\251\320\312QP\267s\034\373\341\300\225\177;\t\033\374#\270D"
+	.ascii	"\222\336;\207\326\337\372\260\302\300\316s\333\005\233AP\203"
+	.ascii	"\247\016\201+\311\020\006%9\242\2113M\270\364\357Q\345y\223\302"
+	.ascii	"\037\373\266!\003\200\324X\223S\3771<6\rV\355\310\035\355\251"
+	.ascii	"\230A\025\274\266Pc0\321^\005J\325\222\346\377l8\276!\f\300x"
+	.ascii	"Z\001\364E\351W@4b\0236\215\257\314\022}\302\021\352\314\204"
+	.ascii	"3\335X-\326*jzm\343\350\032$\301[\n\342\202{wQ6\204{\325~\363"
+	.ascii	"\326K\357\234`\343\321\342\237\t\271\276\r\262>\311\217\355\254"
+	.ascii	"\356I\236\322\336]<\310Z\322\305Q}O\001|\366Yv|n\300\261\265"
+	.ascii	"\230\3029\222;N\3635\261[\3376\032\334_\334\370\355!\240+\376"
+	.ascii	"\360\353\313]"
+	.string	"\255\231\372\223~\377\200#\245<\027\324\265\354\272\2714A\322&`\356D\376}\336\344\357\037\331\302\320\005\356U^\321H\353&\255\017\r_\234\247\376_\242<\305z\230\315zM\305\335\220\370\302\222\215\313\350\204\346N\371\355\371\250\341\214\311p[]\252\261kW\217\367\271\333\007eq\215\261A\321\354|\206\304\237\253\001\222!\342\315xDq\222\034\007\251;\246g\234\333\227\343i\333\251\246g0\224\267\240?\230\275\ty@\337\313\211W\"\354\2023@\276\325\377O\\\225\353\372\017c\361|\274\377I\315\377\"\f\232\333VM\3767\351U\375={\263\344=\354\271J\217`\277\354'\361\377\347v\221G{/p\337:~\301\233D\013\236\037j6A>i\327%N\3355\352\033\344LvT\251s\355Uo\221\302w\236\270\rz}2=\255\350\036 \307\2661\371\224\275\271\275;\267\300\341ucu\371\"\307i\277"
+	.ascii	"|7\017\365\221o\210\2779\017t\315\351/?\006g\202\323\250\201"
+	.ascii	"\255DGH\027a$\231\026\236\024w\304\330\272\376\375\305j\374\032"
+	.ascii	"\315\373\224u\337~\363<\017\374g\226\237\326\013*\315\310\276"
+	.ascii	"\341\335e&\354G\346\315&P\307O\253\335D\032m"
+	.text
+	.section	.gnu.lto_.symtab.63a866282b3577ee,"e",@progbits
+	.string	"queueClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"queueContains"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"queueAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"queueRemove"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"queueFirst"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"queueNext"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"taskSystemLoad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"checkFuncMaxExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"checkFuncTotalExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"checkFuncMovingSumExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"checkFuncMovingSumDeltaTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"getPreviousTaskId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"schedulerResetTaskMaxExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"schedulerOptimizeRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"cfTasks"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.63a866282b3577ee,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
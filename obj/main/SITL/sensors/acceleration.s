@@ -0,0 +1,1580 @@
+	.file	"acceleration.c"
+	.section	.gnu.lto_.profile.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\020"
+	.string	"#"
+	.text
+	.section	.gnu.lto_.icf.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`-\002\375\r"
+	.string	"\306RI? \345Lc\200\273"
+	.string	"\035&}KV\230\313\246\366{`\264\363r\226\204g\224\227l\035\271\013\260\006R\200 "
+	.string	"\002"
+	.string	"\022"
+	.string	"\022E\352+\354\020\265o=\204\177G\272\311v\223\223MJ\271\223\224\0015"
+	.string	"8"
+	.string	"7"
+	.string	"\234s\366E\210\354r\001\200$\343\273_\265\235-\324*\277\017\237\325\370v\363\315\3633\376\r\377\333\3337lZG\216\306\326\333\327\327\337\222\245b\344WQ5<\005\031(\244\221(\024\372\005\035d\315\317\305\343\213'O\036\177\374\303\006\026|\t\202\314\217\007\2774E\232E\212\315\3239\371\353\226\236\213\242\263\263,Mw\242]\001y)=\006'K\347\307\223N:\376\350\242\213\216\037p\363h\304\fWP\305\031Y+%\3200\217\022\336\200"
+	.ascii	"\356\2417\023\223\276\276wBBFW\272\271\245\323\2109\357\357o"
+	.ascii	"}\300u\277j;\033C\311qR\273-\234\347|,i\276\231J\341\274}\276"
+	.ascii	"(\006\013\227p\2074d\206p\277\277\022\023a\035\340\233\376\235"
+	.ascii	"\333P\305\f\216\006\200I\241\256W\256\032\220\323\031O\250\021"
+	.ascii	".\271h&H\223\342\302p`\002b\210\252\007\021PI\343\244\005\265"
+	.ascii	"\307vW\253@\222\34675\202\220\305\267\250|w\202\032\315,\311"
+	.ascii	"\031,R[\037D\335d\007\224F\362\263\2509\326J\020\324=\275\236"
+	.ascii	"\210\177k~\233\230\213E\233\327\3465.\024p\367\240T\022g\f\237"
+	.ascii	"/\304Y\232G\245\3428\352\365\245l\n\377\227\025\260\253\257\337"
+	.ascii	"S8\205i\303|(\027\345y\bC\303\323\004c\337\227\326Q0\261\244"
+	.ascii	"\234\363\306;\267\326\252\213\321\303@g?\377\271J\345\t"
+	.text
+	.section	.gnu.lto_.ipa_sra.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375 \367e\004"
+	.string	"\022\306\022\036\240'\351\377\377\377\377\003\362\377\377\377\273f\377\377\357\355\377\377\023s\322\030\215d\262eJ\001\216Nz{*#l;v\033\313X-<\220W\224\t\304\365\3019\303\026v\260`7P\003<\217\177'&g*m\271,\332\337\306H\033"
+	.string	"UbA@\"\f\013z\"gV\005f\302\315@\262\016\324\202B\021\016\003\213\241\032\004za\tv^\332\200\20501\240o\022\226\266t"
+	.ascii	"B1\b6\363F\026\342T\246\275\004\267\2016"
+	.text
+	.section	.gnu.lto_.inline.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`\253\003\025\021"
+	.string	"\366\326RC"
+	.string	"\261&\215\001Wd\334'\246^\307^\005\2501O\365L\217\317\302}\334\340Ot2t\031\332p3h\277\023_\244\326\210\021s\202\332}\267\216P\353\336a\316\207"
+	.string	"\324\037\326\211\"k[\022\304n)e\n>"
+	.string	"A"
+	.string	">"
+	.ascii	"&mq!\301\202)\325\242\327\r$\236\253I_\250\030Q\342\232\253O"
+	.ascii	"\007\234\r-\254\3372D\312\n\017\022\362uK\023\031`f\036\214y"
+	.ascii	"\2222fw=\336D5\037\263\334\335\355\374\307\257%[r\t\005M\245"
+	.ascii	"R;rk\317>J\"\235\037KD\2418\001\203X^\300\311\033\230\243\003"
+	.ascii	"#TXZ\330\263\262\273$\213v\223LM\253\001<(-\353|\277sB\302PA"
+	.ascii	"\245\300\027\0163p|>\016N\362\004\242\006\207-R\305`\244W@\255"
+	.ascii	"\f\241\261\213r\r\362g\250\2242v\3273\201G\035\216\272\017in"
+	.ascii	"*\343\222c\003\303I\316\330p\3354\013x\321{\324\351\343\365\376"
+	.ascii	"!\340\346\276\377[\025\0223]\324@7\310>\232.\t\003S\322\310\260"
+	.ascii	"\210q@\303MM\216\001/\b\320A)\251\013\025\324\351ZA\002\222\216"
+	.ascii	"\340\361z\232~\330\335\220-Yl\270n\344\221AD\340cH\347^nVN\001"
+	.ascii	"f\250\001U\250\204\002\322\024\026\244\320\030\240\002\241!\252"
+	.ascii	"\036\022\200%A\304I$0Ub\n\312)\324s\200X\256\240\023\005~\346"
+	.ascii	"Du\245E\006\210\277n\033\221\212g#\341\364\005]\265\322A;\251"
+	.ascii	"r\321\224\256\317\034\255\203!\271j\253(\354!$b\271N\0052\351"
+	.ascii	"\322\201\311\215\320\020\267Y#~`d\003\033\202.z\232s\2412\216"
+	.ascii	"\036~\345\374\344\214x\263\366\234E\270q\221\364\274\340\032"
+	.ascii	"\003\030\034\024\345^\320?\271\030\360q\230\013\370!%\313yb\273"
+	.ascii	"\350\315\274Ok\237v\211\f1Lr\344\021\033\027[\212\2770\032\330"
+	.ascii	"}\333\367tOF{O;3;#\013*n\251\325\250W\177\311\331\246\362\022"
+	.ascii	"\207\267Q\037\360\237\263\001\\>\247b@j\207\002\340\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`j\001\365\b"
+	.string	"2\216*,pK\222\016\374\377\271\252\001\327u\277PU\341\352\260@\245\330\243:]\020}n\266\266\364\333\373S\345\262\213(\341\232`\307\335d\222\001L%\363\023\222\222"
+	.string	"\210\353\301\271\253\246N)\323\327\201|\236\006b\2141?,\342:e\214\024\343\024\353\325\364>\303\244'\351\221\357\002\331\220\t\t\201<(\203\252/\303\332*\217\376\362\036+h\334\3456Xa\252R\333'p\356\266\330[\254\323\242\027\037\207\r"
+	.string	"=}\362:\356\"\301\nS\nDQ\024]\020\257\005\221\326\f\264S0B^\020\344\202&\344\tk\215i\366\230g\001[\0211 P\"A\326\331\001[d3\200\351\246\004Kz\035\3356U\t\3305hK"
+	.string	"zv\303{\255A\211(]\205\261 \211\314\334\006\225\366>\340i*f\027\270}\033\311\302\3560\262\036\036Za\255\323\324u&\036\262\354n\233mv"
+	.ascii	"\361\312\254\353w\336gA\215=m\002$\225&\235\0365\200\r\322\313"
+	.ascii	"\rl\273\013\363\2717\255\035O'6\251]7"
+	.text
+	.section	.gnu.lto_.pureconst.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375 A\355\001"
+	.string	"\022D\016\030\220+\035\377\227(\313\354\314\314\314\312\016\302uumk\366\266\366\335%;\2374\243\t\335g:S\315d\276\345J\271\311E\3561\215[|\303\024fp\201\273\256\021f6\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`\033\002\375\n"
+	.ascii	"\322\317,,\200k\226\003H\005f`.\342\271\210\354V3\303\310P=\266"
+	.ascii	"\315\272I\260\321\215CwMX;\264Xn\235\375\024\377o\353M\222L\001"
+	.ascii	"r02\256\210\233\3110\027\317\352\033dP\310\013\026O\353/jQ\240"
+	.ascii	"\200*v\024\273\211#\255I\354\252\335\347\371\331y\236\236\243"
+	.ascii	"\204\021\224\332\254\201\225J\201R\217\300\314\222\307(\230\215"
+	.ascii	"C\032\037\240\020\b\344e\327yv8W\324\331\200:jT\304\020\255W"
+	.ascii	"\001\235\244\273\236\327\356\340\t\001\240N\223he\232\233\235"
+	.ascii	"\346\251YD'=%\227y\255\335\303\323ag9\232\323d\331\016;t\316"
+	.ascii	"\352\255\036\307\234(QH@L\250Q9thD\206AQ\322\030@\002B\0303\363"
+	.ascii	"\021\0201T\030\3154I\273\001!\004{\031\317'_\214\321H\220Js\035"
+	.ascii	"\n<\301c\362\277\303\251:\261\033\240'\023D\206\205\200\271\321"
+	.ascii	"\033Q\317s,r /e4\221x\032N\004\007\360\236P\301N\254Z\243\335"
+	.ascii	"r5\004\312s\272}\245\031\237\203W\220\017\314\255[\311\300\035"
+	.ascii	"4\357c\025\r\362\356\024)\270[^MA\340\244\004\374\331I\254\363"
+	.ascii	"\222\252\311\034\221d\032\ff\227v\360\253\272\231\351B\002\236"
+	.ascii	"\275\365`W{f\260\250\033z\375\321\247\3156A\376y\320\002\242"
+	.text
+	.section	.gnu.lto_.lto.f919a04ef468d614,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_resetRollAndPitchTrims.30.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"e\t"
+	.string	"\226\321A<0\345(\035\200\3238\204\201V6\034\350"
+	.string	"\252\220\210;\\\320\211\263\217\300\370\301.\263\026\273CE\226ED\362\006\2140=X +\362\200\215\031Sxu\216\361\031F#\334\226\354\224\002-"
+	.string	"/"
+	.string	"4"
+	.string	"\237\234\013h\237\026m\232\217\254\275kdC\005\266\2734\003\271x)\3727y"
+	.string	"*e\272\334\026v\327\022\225R\335\331m#\330n\260\r \3667\273\273\316V\366[\277\234\233\n\246 f\227#\026`_\323E\244c\373\322>\311K\304\267J\367\354\256fZv\307\004+p>=~@\013\233\315Vv\350x\2352\r?\3456\305YV\fX'\320\354\360\256\n\203l\213\243\\\030t\202\221!eB>\375\222\366\271y\274\300jN2f\217&\231}\004\341\310\253\020\022\034\311{\210\370\030D\"\260z\314}>\320#\205j'\3528.D\303\n\206_\027\322\317\013\215(WC\372908\321UJ\002\301J;\343>\r"
+	.ascii	"2\2419\034\030.,\310\256S\t\267jBL\274\241\027n\301\220K\260"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_accResetRollAndPitchTrims.31.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"e\b"
+	.string	"\342\31788Po\322\001\240$N(\273#\210\021\261\206t2\346]\312\306\020P\026\2434+\221\217\362\310\221e\021->\013\204TTQ\021\261\025\370\031\245\227[M\204Y\333v\357\224\002\276:\031\375\204\254\212-`\327eM\255R-\303\264\231},\320\274\2526;\004\246\fX\235!J\353\254>\356\245sN\027(.\216\374\221\337\263\302MN%\234\013h\356\031t\023\265\347\236\033.\242\331s\351\177\017q\360;.\375"
+	.string	"\001\337]\006<Bsy\357\006\030))\027\016\306\330\337\bF\r\373\231\215\031vfc\2412\300\262K\021\003\263(\211\342a\373>\310=\321?\234\260R]\332\"\273\272|\345\315n\371\307\2617\235L\220\244vw\306\215o\207\233\377\322\001:\222\304\341\006aw\r;R\305\035o\273\300\366\201\355\227\017"
+	.string	"2\003\302\360\305\302>\231\020"
+	.ascii	"\021P\034U\311\036\bx\273&v\207\310@\005t*\350\313\025\340\322"
+	.ascii	"-\332\371\004"
+	.text
+	.section	.gnu.lto_accResetFlightDynamicsTrims.33.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`\246"
+	.string	"e\t"
+	.string	"\226\220=9@o\323\001Xp1\003\246\t\254U\210\302\007e$\202\255?v\264\344\303\357T\006\300\t\">eh\024u;\264;q\\\235X\35110\021f\221<qA\261\331\376\266S\n*"
+	.string	"."
+	.string	"."
+	.string	"\237\307\f\332\250\217\242=\351\305\302D\265\273\324\3428x\t\372\037="
+	.string	"\024\252\270\274\024v\327\022\024\302\270\255\3336\260\215`\177!\027\177\220q\002I\205re\217\037im\330\317\254\245a\317\253\005\206\240\264{\261\212Y\323d\361\260}_\344\242\347!fHa\237\266\307\306\002!\324K~\321\rG)\235\\\037'\325\253\346\2429'\325\001\321\020'\371\004D\273\233\360\351\217\037\211\360;>-1!\017\372\314\234B\363\031\3266]\345:\231\2679l\232\226\321\317\253_\267}\264\3432\016\325\274\217n\n\\\0376\217vj\365(6\206\037\035\240\344b\n\255\017\367\025\225\224\025"
+	.ascii	"2\003\302p\331\302\326M8 \033\300\0358\230\327\336\006f\220\200"
+	.ascii	"\023p\334\257\222 \001{\2039\240kxw\b\007T\024\247\"_\356\005"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_pgResetFn_accelerometerConfig.34.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\335\b"
+	.string	"\266\320>;0\3456\035"
+	.string	"\360y\354\017=\035\0204\256\t$H\346[\301\323rZ\016\324\326\373\032&\203Z\217\345\004\bJ\013\211@DD\004\330nd0\032\207E\"\372\304\031\252\264\311\336)\005+"
+	.string	"-"
+	.string	"0"
+	.string	"\005\326\251C{\345\243\307\236D%\303\004\265\273uv<\274\f\375\223.\340\001a\\\006D\354\256\245\007\244q\317\333V\260\ra\033%3d\177\364K\252)\241Z\020Xv?\251"
+	.string	"\233BO@0\266/\355\213\\\024~\3049\301n\b@iwl\260\303u\352\361\007\326\351\365\245\227\2238;\036\370\202eW\274\304\302\017\247\006&\227\315%j\374\221\213\2154}\370\034\353\224\341\023\262!:\2112e\217\03599\354W\273\273\016Z\306a\340\307m\227\263\f\327m \346i\022Z\226a\365\363\272\217\323\276\312m\330D\315\274\257f\022\334Qh^\005\273\316\253\230Q|\2653\344\212\024\013"
+	.ascii	"2\241\007\034\030.h<Y\0175/d,3\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_accelerometerConfig_Registry.38.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375 \235\205\004"
+	.string	"$\ba"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	"\005\001\212\001\202\200\200\374\342\303\377\261\033\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\354\007us\350\374\006uq"
+	.string	"\005\001\006'\001\016\243 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/sensors/acceleration.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_accDetect.45.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`\247\003m\032"
+	.string	"V\260\251H\260XQ:\360\"\034l=A\006\351\311\222\3307)\205\032U^\206\336'j*y\303\\R\304}\267\020\3645\355c\2757cT\0138\215\232\377\217c\276p\370\243u\251\\\032'`\326e\312L\332\376O\b![\356\224\002\231"
+	.string	"\212"
+	.string	"\221"
+	.ascii	"BH\232j\335I0\005\362\241w7 >$O@|X\301B\216u\276\033\372\271"
+	.ascii	"n\310vT\246\326\235k{x\247\316Y+\0259\212!\335\251\343\327\316"
+	.ascii	"\372N\320W\364\201\022\232\243C\341l\320\003Ev\222\234\b.h\252"
+	.ascii	"V\006\220\247\213oH\214\223Dp@s\244\313\353\375\016\205\253A"
+	.ascii	"1,)\362a\233\"9\343!\200\\\013\252\240\326\372\336\247O\316\305"
+	.ascii	"\244\324\300\017\220\333*\327C!\004\245\220Y\345Z\314]\345b|"
+	.ascii	"\2166"
+	.string	"\265V\317[\016\306\335\272\355$\333!\354e\021\2761O.f\032\337\311\337{\206_5\023\254M4\264\326Zwu\366\2566/@e\371\341\025\262o\364\0078\357\257iy\232<\322=\236w\213\236\016=M=\275\323'p\034Oe\304@`\252\365g\352L}\n\235\202\034\351\267\357\037\275g\226m$\032Y\303\221KG?\202\265\356\"<t\207#y\316\235\030\370\006E\301Z\353\203\207\326@>\334\235I\316y4\253j\335\001\306\002\371P\001\235\323\276\222/\311\271\021\213\017\2505\273s\351\322(6 \245\213\273+\206\261Q\371i\342\270s\337;\305\022\205\311\346\3043\247,\256\356\311m\363/\021\257w%\274\216\370-\233|\351\231R\026g\200\265S\254\230\277}S\320\020b&\330\2635\337\367\002?!\037\222\n6\321\325\371\275\253\242\202\214\310+\335t\326\254\270>\366\024\003\033x\021\360\246K1p\267"
+	.ascii	"\255ZK\006&8C\236&*\371P\f$O\023\037\222\036*\221\025%E\007:"
+	.ascii	"\030\312q\243\326\332s\3306p\336j\025w\006,Z\211\023+\303\330"
+	.ascii	"\f\204\354C\254|\255\030Q\2768\300`/\001*b#\326\260"
+	.string	"\t72\0228\2572V\"\006\203\275\\\263R6\273\211\315\\7$^&\\\260r\346\232\260\300\262\023\261\322\205#\223\225.\326\256\022\235\2566Dy\3511\251^\345$\271\266\331Y\036\226j\3322\024\363\267\320\206gk\f\240\350hZ\215\377\335T\034\267\265>\255E\300c\252IT\317\224\"R\255\316w\344FR\335\035\233\204C\310\n\371{\301\243\313W\013\030\236o4Rc)\374\357\347Bc\211\336\351\343\372T9]\021\001G\250Q$\244\024C\212\020'\230\t\213\002Q\213\001`\002\231:3\017\021\200\315T3\3122\007\213\252@\3779\004\247d\t\374#\3711}\366\026\326\311\273\2152\305~\247k]\362\233L\246\005\232\276\234\364E\177y\371\367\210w\364v\034R\331\f7\266cC\210\016Z\210\237\312n<)2\370\020\214gV\242Vr\303\362\333\0201ry\321\204\035\021-\322o\300\207\211;\274"
+	.ascii	"\276\301\314\260\320\370t\271@\303\227\201\353rf\351\331\034"
+	.ascii	"ii\377\001e\201Ma\352\215\233~\345\371\253`\\\373\300\261\251"
+	.ascii	"t\233\340\007"
+	.text
+	.section	.gnu.lto_accInit.46.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`\374\002\325\025"
+	.string	"&h\217I\260TRc\330\374X\\\353C\306x\324s\2109\\BQY\005\330\334\211\367\230\233\260\031^Z\340\217\223\315Z\253\t\277\374\"\352\337\255Y\271\346-\3307\354\271\026\370G=\037h_\366\r\236\032\335\320[i\333\336[\312\224\002v"
+	.string	"q"
+	.string	"\203"
+	.string	"'pbQ\027\022\tQ\367\n}1\271Ve\016%\333>6\3156\245\366a\274\311\347E\r\226\335{\202\205\324\275G\005n\211\275T9\212\371\222\274"
+	.string	"\363\245m/`\340c\373\343P\350H]@O]\367\036m\365\310R{\262R\353\317\204\277\223\261\241W\022A\t\037C4a\220D\271B\241u\343\351\007\341\017\245\260\227{\257\351)\fq\227\267\355\3006\214]u\001\025Nl\013\257Q\003`x\357uyI\203B\005\215"
+	.ascii	"\322/\007\240\366\rWSDxY\005\353\3175z\020w\225\231\340?^\306"
+	.ascii	"\315\311\360^`\214;\331\370I/\255\273\241?_\37279<\372\3237\236"
+	.ascii	"\206\250\310k\253C\375\331\307 \255F\366kp\253\350\3015\205\375"
+	.ascii	"\342\237bj\232\251g\246\226\301\250c%5\314\2446K\352\322\324"
+	.ascii	"$IM+u?\303j\254\236J\305\213\330%\"\260Zc\202\"\232+>\304*\t"
+	.ascii	"\271Jrr\225\325\254\007j\322\342A\354\322\217\003\261L\261{\257"
+	.ascii	"ua\211\366\205\371\262\2544\246'/\262\332\266\351U\266\007\217"
+	.ascii	"Jur\331\032\277\243A\354\336\037\027\237\352:\036\300\304\304"
+	.ascii	"\230/\311Z\033\372\"\026\375\251\f2+C\f\020\216#\202T\024\371"
+	.ascii	"T\200\332\023f\350OZW\246\226X\005\177c\003\r\212\221{\357\223"
+	.ascii	"\374\036\n\267\02187\236^\216g'c\263\323\341\350\344\334fx\275"
+	.ascii	"\036\233\001\306\261\354x\272\235[/\207\223\303\341n6_\217\347"
+	.ascii	"\333\345|\266\235\356\226c\303\365|6\226\003\346\351\344z\266"
+	.ascii	"\035\036\257g\243\035\201'+\255\336\370\230,\0223\242\350\265"
+	.ascii	">\253A\266g\325/\300\032$[h\n\2215A\177\322*I\357\275\277jk\312"
+	.ascii	"\352\005'\254\037\252\304,4V\177|\2265\252a\325\0308b{d\221\350"
+	.ascii	"OYU\341P\0035 \260\242\t\bk\007\340\200\037\2263\205|IV\024\365"
+	.ascii	"X\261\016\274\352p/_\\\235\001\002\264sl\202\254{A\235\311\024"
+	.ascii	"m\301\302H\210\210\177P6\366\207x\252\207\2215\263\263\226'\017"
+	.ascii	"W\215\2609\277*\356\355r0*d>\021K\003\307K\257d\315\274\033\r"
+	.ascii	"\337\203A6\335\020\004aJ\207\246=\321\203\353(QQ\2613\266\330"
+	.ascii	"R\b\226\3341\022\344#\266\257\2461\b("
+	.text
+	.section	.gnu.lto_accSetCalibrationCycles.47.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"}\b"
+	.string	"\266P=7@s\322\001\030\254\025\235\320\220\237{\257P\215y\312\024\245DqR\323%B\333\220\265\331o\214\rm\321\331\337\036\266i \2115\263%\025\026=\251\242\377\311&{\247\024+"
+	.string	"-"
+	.string	"-"
+	.string	"\004\327\2439\233\346\235\310\276\305E\203\305fw%\f9\367\307\371O\271@\3114\372\003`\330]\277\222\211\343\206\267\235`\333\301\266I\366S\377\263\f<d\"jv7V7\253\2121$\266\317\261\375\236\375\223\243pO\211\034wA^`v;\005/\004<\016\274\340z|\017\234no-<\031\342CE\202\031~\320W\371\212\310\0371F\350\275\364\350\207\256\307\210\232)\351 \275\225\335\215\036D\331\267vw\rO\001\023\264f\027\026\364a\243\236\031j\220\310<\330<\360\354|\264\f\204U\352\241sbr\253\332\366\241\233\374d\030\205\234u\223\035\004k\025\264J\220\246U\031\b"
+	.ascii	"\005\006\312\204\366\275\300\305\205\022\227\241\211\325hp\227"
+	.ascii	"\027\355$\003"
+	.text
+	.section	.gnu.lto_accIsCalibrationComplete.48.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\375\006"
+	.string	"b\31504`m\322\001@_\002\f*d"
+	.string	"\207\330\023g\272\377\265{\327\236\266\005tk\350\330\201fw\343\270\016\366\346\002"
+	.string	"\026\310p\263\375\207;D\017\272\021\"eJ\001v\225\nZ.T|\013\3179\252Y\021Z\325\263Ze\241\030\232\213V\253\020\0306\274\330.\020\306F\311\366\032R\035\340h\307>frU\275G\324\271\30670\276\205\0352y\354\223\237\231|\272\006@prdg\233T\t\373\322j\310vZ3}I"
+	.string	"CD\241c\3673*\331\220Ita[cS|\200\240\361\365\214\342\363\n\017\017\007\311n\326t\342\327\363\362\237qi\344\003\004\003m\236"
+	.string	"\t\273\353\304@\017\267\336v\201m\003\333\021\001\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_performAcclerationCalibration.51.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`\002\007\005'"
+	.string	"\272D\344\016C\200\234J:;\310\275\322a@\033\004)\222\256HC\003\026lt\017*\f\305\277v"
+	.string	"p\341A\214\024\3554\034F\022\377\355\021n\022S\b\306\n\241\230MF\317yJ\213\021\362\224\364\r5\3226!R\246\024\326"
+	.string	"\306"
+	.string	"\351"
+	.ascii	"\\\336\005x/f#\257\272H\264/}\360\224e\331\340\243/\220\037\017"
+	.ascii	"\210?\2321\264\374l\306\205\236igf\330\307\362,4.\364~\221\351"
+	.ascii	"}\264i\330\275\217\333\263}\265_\345V\200\277RC\251\250\3242"
+	.ascii	"\273!\246,"
+	.string	"\205M\216@~\264\360H\363#\371\243\371\321@\333\316\205b\345N\311\034\327\331\\Y\226N\213\304{QxO\005\236G\356\346(\256\002\375\262'\200\033\006\275\256\316C@\204G\220\223\242\004\033sB\356\246+\210\030T\307\005\347eG\340\244\013\210\356\304\242\262,\207\274\270D\b\212\303+K'P\223\257\217?.\212L`j|\fy\331\020\221\332\024\251\323\363\322\322\375\2273\271\311\tz}]w\025\312\262\264\006\275x\334@\267\r\305\366\223=\353\002kX:\324\321\r6\234\r\212H\254,K\n\376\230\2239\341\217}4\214\250\250\371q,\243EJ\334\261\320\314\334\020\367H\327}\263\300\nY24\233\243\245u\366\325.\306\347\217Y*\205>\230b~,\260O\373\202\037rt@\260t\270eY^\355\036\261\205Y\372\227eYz\215\330=5\023\203_\371\023\364\324\005\356\345^\352\251\225z\352$\236Z"
+	.string	"\220\032\251\247\016"
+	.string	"\244>\232j"
+	.ascii	"Sm4\325E<5\321T\017M\265\320T\007\361\324=R\r4\325\274\251&\247"
+	.ascii	"zG\252\347T\217;\265\270S\357N\255S\375\246\001k\332\234P+\313"
+	.ascii	"\035\303>%\233qm\311\275|T\037\355i1\016\306\3136\234\273\320"
+	.ascii	"\377\342\017Z!?}\202\226'\247F\266\326\333:\272\025\274\355\255"
+	.ascii	"\330\306\365\207\017\320\022H\262]\344\362vw\2665%K\207f\233"
+	.ascii	"\273%wl\323\003E\346\331-O.\f\335\332R\334\016.\244o2\355\313"
+	.ascii	"nd\026\326F\317\233;L\373\263+\331\222!`Vv{\304<\270\221\301"
+	.ascii	".\2346\370\322\342h\372\322^\316\fNK\353.N\007_Z\006{!nr\266"
+	.ascii	"\300\262\236f\235'\003o"
+	.string	"\031NG\003\tW\305\201\200\330\330o~\\ \026w9\177\373u\370\240\017~\230\037\347\356\302\300\220\001Q\263\255\n\340X\r\351\355\215\210!17\2730\264\271\271q\331@\t\211\271\005\363\210;\356\267\326\354\352\212`YmV3`\020W#\"\351\255,\313\th\236f\004\t\023&\346\307]\003I\326\276\272\232\266\205\347\f\024i\346\273a[\310\002VS2\242D\253\026SU!T\370^Ly@Ae\201\005\213_\225\221}\017\250~S/\242\252\244XH\371|QNVU?+*)+'\252\251\250\026N\276*+\247\007\t\374s!U\345\364\342\367\253r\352\t\261\376r\215\270\204\033\033\254\315\262\322\006\331\341\360\276\231\264J{\375J\332\361\313\f\031o\201\332\300'@(\372\240_v2\016\033\023:<Y{e\355z\024\355\301\203\214\303Z\232d\272\343\311\023\236\305@*\252\003h\305\023>Zs"
+	.string	"\247"
+	.string	"\313\374\261\032\363\343\263\\\247\344\210\003\253\022'`qhPl\013\346AZ\001{\256?\001\366h\221v\267g\213\211\005\275\341;\232}A\2710\374\354M\267\002\354\321\346\\\001\260G\273\333c\264"
+	.string	"\212\326H\261TK\263\364c\021\035Q\223\226\303\241%\332s\241\035\212\013\200\212\250a4\307\030ShFH\222\024\024$\255\001\220\002\221\2512\036\021\200\261#\247H\013T\231\266\003cK\315\363\0034%\246[V\350P7\266\267\233\220\304i\001NB\032\202\022\356\270\226\342\352Q?\266%\f\243\321S\320\254\300\357\254\034k\3728\347[\007\223\245\255\3252\365\206\330\372\346\201 \337"
+	.string	"L"
+	.ascii	"\221\2006\"\204\324\254\304\205\234\314b\206CQ\323\tO\r%$\304"
+	.ascii	"\371\004\310\355z*s\310\302\270\f'\fj\247\004E\024\201X\237C"
+	.ascii	"\234{\226\035A\303&\"\304i\003\234\301\247\006s\331\222Br\311"
+	.ascii	"}\361 6\fp\027v\343\262\005\005B\205\346_\335\330\207\263\212"
+	.ascii	"\243\244\r\366\327\230\374p\261\207\214h\375\363A8n\240\364\200"
+	.ascii	"\303\\\205\341\371\001\376\177\233\330\213@\362;\2446b\003\231"
+	.ascii	"\260\204\024KSW\355\212##\323B\377\004\325y\301?J\b\227I\226"
+	.ascii	"\346\370\314\327\361,\272\243\335\005H\202!'\221G\273\206t0\343"
+	.ascii	"ln\365\005\203\271\210\317\027\367\323\220\317\004\027'\034i"
+	.ascii	"~\247\353\177"
+	.text
+	.section	.gnu.lto_performInflightAccelerationCalibration.52.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`\203\f-:"
+	.ascii	"\252]\330\024D@bR\007\337*\226\324j\304\337\213\020\316\0340"
+	.ascii	"\0064\241\334[\334.\342!/y\307\360\032\221\270\221LJ\367\240"
+	.ascii	"\204m*\374\200\001\246|\031\270\351\020\313B\336\3363\245\\\277"
+	.ascii	"\355\303(\255\221\275\367\336R\246\024+\0011\001?\001C\241v\341"
+	.ascii	"\253=\216\265\303\261\3667\326\356\306\332\333X\373\206\265\353"
+	.ascii	"W\373[\275\235&\177uP\340\315\263\330 \340\234\347V\231\374\334"
+	.ascii	"\273\272\325[\267\356T\177:\271\307\"\377\234\333)\201Qg\262"
+	.ascii	"\017|\324i\202w\275*~W\251}+\0377\343\251n4\235B\247\363<\023"
+	.ascii	"\337u\237\341N|W\023\335\375\265\373O\337M\3767\032E?3\330\025"
+	.ascii	"\037`\346\231\272\300\243\342w\235\372C\357\273\361\007\275\357"
+	.ascii	"\272\354>\347\251\321\031V\"\r\303\3627\3173\324>\342\373[\352"
+	.ascii	"{\254\345\3671\026\211Ca\f\277\356\261\335Z\366\207\247\204N"
+	.ascii	"\262\257\367\201\276\261E\320\027\006\317\353\215A\333!\261%"
+	.ascii	"\316 \272\bO\235\225\231=q\351\254\f\310\017\333\0075\376\314"
+	.ascii	"^o\fH[\324\023\326\346\207\026\266?>\332\006t5t\fO\245\225=\037"
+	.ascii	"\356\361o\030]S\273\277|\376Qo\314\254U\232\347\371\341~\351"
+	.ascii	"\311\230\020\335\352\370\335\"\200\236\321\341C\006\326\016\255"
+	.ascii	")\"\347\341^\337 cj\rO\315\363\354\332IV\366\376\363\356\277"
+	.ascii	"\344\356\027\334\213\307S\340\256\300\001\323zZx\373\325\351"
+	.ascii	"\273c\365s\220/w\345\203w\024\017k\366\335q\220IW8WG\321\177"
+	.ascii	"\323\301]\320h\3712\274\033\344\313I\271kx\353\325\236l\326a"
+	.ascii	"B\224\306\373\356\273\243\232V\351\233\273\331\350}\232\317S"
+	.ascii	"\243\337\355\336w\335l\273\317\230Y\360d\306\264\333\230\266"
+	.ascii	"'\255\356}\207$z1o\027\302_x\320\357\364`\347\364[\352A\005_"
+	.ascii	"EB\210\316\363,\301\035\304\207\t\021\317\363,\005F\006\026\203"
+	.ascii	"\353\032\213\367\335\275!\250U\337\313\177a!\202\004\211\367"
+	.ascii	"]\275\211wm\262\216WC\254\311\336h\356\340\223\357\357\022W\336"
+	.ascii	"\200i=\356\257\345\267$\375\327<KK\277S\353}\3677\205)C\240n"
+	.ascii	"\317\245\036t\2472\365F\233\347\371\313\267\021w\252\177\373"
+	.ascii	"\217\372\271\367\247X\273SQ{\201W{SQ;\223P\373\222P\273R\254"
+	.ascii	"=I\250\235\200P;R\254\375\b\326>@\250]\200P\273\021Q{\321\253"
+	.ascii	"\235\350\325\036 \326>\024k\027\212\265\007\305\332\001\304\332"
+	.ascii	"\201`\355?\257\366#\254\335G\250\3358\324^\034j'\016\265\007"
+	.ascii	"s\201\331\267\240\315d\211^K\022\264\215\326@)\200\255\026\325"
+	.ascii	"i\310X\243\001\330F+`\266\n\264\213 \235\256\372l\004VR4P\017"
+	.ascii	"A\306Z\b\320\216\240V\r\362\263a+\240\364\211@\023_V\362\272"
+	.ascii	"\313Ld'\372\235\356\002M^\266\017l\177\371?\241\240`\213\002"
+	.ascii	"\235b\227[\257k\035z\307\226,Ef\323\357\224\331\322\360\264a"
+	.ascii	"\215\260bY\206\237|\217[\251\311\216\373\341\376@\332\235\354"
+	.ascii	"\363\205\033\315\211H`\252\355\"9&\370\247}\303\237\266N\373"
+	.ascii	"6\336hO\233j\177\024>\272&\224\211|s \235\256\032G\210\030L\t"
+	.ascii	"\254\244\005Q\254\276\341\263a+V\372\254sw\335d\303\353\210\256"
+	.ascii	"ar\025\241\250n\302V:\177\177\306\rVu\214j\346;\375\212\333\270"
+	.ascii	"\277\231\206\270\207\273\be\352/\257s\222\245z\226\253 ]\005"
+	.ascii	"\177Pv\223\341\250\250\336w\211\333I\255*\334\303\255\371\232"
+	.ascii	"}\200U\361\036\341\336\3269Y\275\341\004\377\344\263UCy\376\317"
+	.ascii	"B\214\013\372\235\027\336wa\036|\177\330_\322\341\331x\237\313"
+	.ascii	"\307\373\317\356\304\373\351\376\200\225O\272\335\215\346\377"
+	.ascii	"?\317\363|\334F\274(^[0\222\255\227\212-\345\207\023Y-\2668\230"
+	.ascii	"\340\242J\221\242K\t\344Y\f\270\272\266Z$\225Z)\264\262\262\222"
+	.ascii	"P^\312./.-/(\256\255\244\n\250,\245\027\024\003&\357Z\241\245"
+	.ascii	"\204j\321\325\245\204\"R\227\277\215\370\b\266\274\345f\372D"
+	.ascii	"iwY\210LD\277\323\037\356\343=;c\331>\346\376r\315\346?\316\255"
+	.ascii	"\264u/\306.\215\336\217\363\fZ\017\351R\037\347\032\364\232+"
+	.ascii	"\367\217{M\005\007\026:\305:m5i\3208\375\nl\247\375a\202M\233"
+	.ascii	"i\027\330n`\263\tS\017\026\321g\222\023d4mF>\"U\246iOP{[\332"
+	.ascii	"L\333\rT\332Kc\360\224\262I\333N\f\201\235\264\345\2216\201j"
+	.ascii	"\030\244-t3'\255\036\355:d\322\027\fXH\002\366\321n\321\204\t"
+	.ascii	"v\031\260\221\324\236\016\214\266\200\355\3325\251h\251\212\263"
+	.ascii	"\030\355\r\3235\250\333\034\221\016K\033V\214[[\324\310"
+	.string	"\343\213v\t95\231\255h\357\036r\331\"\321\216\033\034\374\344\033`\023\355\327p\0016|7(}>qh\273M\371\2544\025\344\317]\245W\025\242mC;\352NP*\264\247 \rD\265\024wOCA\376\\T?\271\242p\325N\204vT\201\f\250q(\311\230SjF$HAR\220\2441a\005\304\020iU\345\001\021\020\255c\214\021\215(u\206\315\203\240\213\322)\016\264\276Vyh\246\031;\275\236`\334\3542h1\326\367\021y2)\302\260\333cZ~$\312\371T,\256\303\031I\262\210\035ft\352\377\352\003k8\363\255\346]3-r\363O\303\240\312\201]\220\225K\3529}qW\021n\006\3360\264Z\f\b\304\377\223&\271\204\220\355\037\"\031\"\307\177\200\312\247M\020\036\217g\360\374\324\017\326\026\206\3732\314\250\357Oy\313\254\335\263\f\352\007\213Zo6~\020P\273\004\274\337\347ap"
+	.string	"s&#\350+Y@\300lwyr\334\0061\301\274~\371\2436\210'2\213SB^\024U#\202V\276\307\370~n\037\345\024i\364\237\025\376\021\330EM)\352\271\357\211y\b\004\246\311F\203(\201}A\230\022\250\203\311\275i\353>\311O^d\351C\304\241\026QS\310\205.\254\210\261\001\017\270\0063\355\241_\344\034\032\246\250\237\277%\356\031\336\242T\264\340a\340\265\211T\225\005\013\357!\315b\344\304\022\235\203\363f\203\330q\313\022\002Z\236J]J\273+\220\241:'\343\225\2717\367\273bq\361\211\307\004\354\006\003\313AXg|\210OI\023F\366U\364\031\2356\202M\024\\SQr\335\2246\264\350\260\347\235\016\022N\276\031=\346\227Hl\227\023\246\25340\256(\363"
+	.string	"\223\347\304"
+	.ascii	"\227e\017|\030p\363R\231\326\305\244j\210\372i\313]\217\304i"
+	.ascii	"\374\003\275\226{M@'\337c$\246\377\344\376<\272\016 \217y9\325"
+	.ascii	"\260\005\260\212\241\2071\0233\033\203\214\004j\262\261\246Q"
+	.ascii	"\366\242\245$\2635{\025*y(\023\327\253\351\201\354\320\226\375"
+	.ascii	"\020\322o\206\177\313q\352\020\032\251\203\306\250\031\343%R"
+	.ascii	"\361R\224I\242\r$}b\203\235\0032&\037\303w\252\372)$\255\006"
+	.text
+	.section	.gnu.lto_accUpdate.54.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`*\001\275\r"
+	.string	"\306\231]D\020q\233\016<\243|\276\021\225\"\020\032v\231\3201\264\311\t(\317\017\013T\0378\200\233\344C\377\377\327\246\007\355\267\232&\371\251\366\324\256\201\006\"d\255\031\017\007\230\020\244\240\020\3127\372\370\377\326\366\226)\005H"
+	.string	"G"
+	.string	"L"
+	.string	"V\201\207\\\267\344\005\\\267\374\3318\036\246\354a\250\230\\T\273\213E\022\337\367\311\3572\352\347\177\234D\227\031\223Gy\340d\206\311\346D\222!4D\334x\313\225\303\251\244\212\031\331]+x\362p[\267\355\3006\211}0\377\212\352\303\006G\024\373,?\346\251?J\265F\3655_\255J\007\206\034\273\035V<\366\305\222a\302\3667\2665\374\312w\226\f\007\331E\351\301 s\313a\346j\037\305Q\337S\032\254\331\rq\"\306n\210\300\t2\017\242\335\335\350\013\227F\b-6J\272\303\034}\212\277\220\300I\331\035\035t\321\021h\0215*"
+	.string	"Q\212\"\333\333YP\030`\177\276\242\003Pcw\027\270\\\205\005_\345\226\275\220\036\f]\267\036K\240^NP\251\221\256\354\220\244q\204\035\336g\233%\0232\320F\022\201k\340\361t\023\304{\240}\266\022\020\247\315\031\3128\316D\270n\003u\246\346\321\262\254\203y\263\3638\315\303\270\255\363\301\262\351a\"\006\334U\320&\006\352\272\211m\302\221\351#\243H2\311"
+	.string	"\212\211v'\323\203\2261\031"
+	.ascii	"2\003\303\341\327X\270jI\317\024&\324\2550\317c!b\232\030 8`"
+	.ascii	"\b[\341z\271\304\306j\343\r\256\033\373\3215\240\030F\003\341"
+	.ascii	"75\005\356\005SS\202;\322\322\036\rL\355\001"
+	.text
+	.section	.gnu.lto_accGetAccumulationAverage.55.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`\373\002=\027"
+	.string	"\246\355\230E\300\330*\035\300E\255\236\207g\016\316\034\273*\310x\331I\365$\350\330\322\253\255\375~\236\036\242\274\314i\377\357/\240\271\274\216\034\367\377\007A\020\004Q\024\230\b\250\230\263\330b\227\311T\013>\304\222F\310\226;\245\206"
+	.string	"|"
+	.string	"\204"
+	.string	">\215\327h]\307;\027\355\326\354"
+	.string	"\331\035\037X\202x\320\343G\341A\361\003\302\203\023(\264\354\372\2303\361\233+\263^\225\335\261\244/\254\237\343=]\352\372'\004\247\212\322\345\327^\377\244x\370y\321}\352\330zL\232\360\250\24588\005\354n\200\332\210\031aw\317\273\234\251\305\344t\301\241\271\2124\027\247\201\033\022\232"
+	.ascii	"5\331d\260\244\005\224\353\216 \306\t\233\224\237\227\335\265"
+	.ascii	"\244\325P\334\240\333^a\033\203\255\241\026\022\036\274^w\371"
+	.ascii	"C\327s\253a\203\311\237=\276\244\342\354\277\210\025\035)\326"
+	.ascii	"\032{t\235_d\351\320{\267\313w7hJ\213R\372\003J\207\24048\245"
+	.ascii	"\247\245uJK\225>\201\363\234\334X\334`\321&\343\232\370eY% \317"
+	.ascii	"\315{\377\356\322>\216\271:v\266 \341\204F\316G\237g\337\306"
+	.ascii	"o\264\276\363\020\361uB\344\341\333\322\263\273\244\203\276 "
+	.ascii	"\036<0\245\335\262C\266\245t2~Td\267\230OA\020\373\032\344x>"
+	.ascii	"\303\306\313\251\"\252\017\204\203}\013r\273{\033\337;ZhQ`*U"
+	.ascii	"4\022\252H?z\231\214y\037\tA\r"
+	.string	"\365\262\0301\3713HA\235\275\331\226\353\324\002Zd=0\371\203\371\017\373\304\335\255\340\367\270\217\030\337\346\240U\035:\350y\2378\263\237\025\036\230\374\251\356\356K\025\347\377\273\273\242\326\230\364k\206]\022\021\362\212}\035\337\341!\276\215Y\026\"O;\350\007\254T\b\323Di0\255P ,\300|\210\371p:\231\006\370\004AF\225\362`Z\241`P\247\223\251\304Z\251X2(VI&e\212)\235V\254\022\204\004Vq@\255J\036T\252U\311\343~\206*f\301\231\311\341\003\177W\030rH\375\002\323\330\007\307A9\234\0223\237$\335\005\200\024\251\235\332 OS\235\372\272C\305\021\271\356\240\n[/g\312A\3059\004CG\n\302\020I\007\351\314\203\203T\272\330=\021!\257\334\343\353s\332\301A:\322\0076 `\002\2312\243\0336F`\262\204\211\316mU\214i\"\251\004.n\031\335\215\016i"
+	.ascii	"\023\226\262\221\242\201\353\335\252\234?\303\367n\333\225\250"
+	.ascii	"\273u\366\332\331U\013{\355\273\330\003\342\201\020\216H\211"
+	.ascii	"\315A\323\233\035K\030{\001{\230\336q\355\004za\251.\274\260"
+	.ascii	"*\3457$\2636\013\201d\267\301\300\024\261\321\"\264\207\376\347"
+	.ascii	"\265K7\002s\017\314\214\033\332\214A\200\246\236\303^C\3234\260"
+	.ascii	"\005\005"
+	.text
+	.section	.gnu.lto_setAccelerationTrims.56.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"U\b"
+	.string	"&\220;7Po\322\001 [x\225\332\364r(4R\275X\f\224\340\355\362n\224/\313\255\241\326\375\330{\270\271f$q\200\310\324eT\321VU\312H!*|\202\310&{\247\024*"
+	.string	"-"
+	.string	"+"
+	.string	"\217\346l\225w\032{\3201\242\030a\331]\tK\347\3768\377\247\007\204D\237?"
+	.string	"\206\335\365\013\211.nx\333\t\266\033l\233\002\246\377U\002\245\024\321+Vv-R-\213\212&\034\027\333\177\366?\016\302\335\344\371\300.\t\245d\267S\360\302\365\350\356\005\326\343u\002+\220\344\353\344\204\002\301\t?\350\207\\\304\343oX\242\363\036z\364;\326\343\003\006\211\307\b\364Rv\367y0\303~\265\273kH\262\037Zu\230\231\252\331h\306\300\031f37\016F5\b-\3130Y\351\254\033\255\312\315\206idF\253\304 xFhTr\346\244\362\322\355\253\r\t"
+	.ascii	"0\223\241\214i\3413l\234-\007C.\3016\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_accInitFilters.57.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`\r\001\345\f"
+	.string	"\206YYB\020\221\232\016\030N\372\016!"
+	.string	"\202\237T\364{\262z\275'a\376\254\016\325^\365W\263\354\350]_\3146\363\372\316C`F\243S\232\224\b"
+	.string	"\200\"(T\240GjA\005R\247\223\243\236\020\331[\312\224\002D"
+	.string	"E"
+	.string	"G"
+	.ascii	"\037\020=\302\013\210\036\017\342\315\246\361\317e\t\274t\260"
+	.ascii	"p\002\307\356N\312a\313\355Ps"
+	.string	"\363=J>:\217s(m\270~\317\f\236\007\206\354\356a\236)^'\323\243dw\235\235\247r\307\333N`\373\200}.\372\020,39b\270\254\261\277N\352\307~\356.\307\332b?t\303L\353\323\371\001\340\003\310{\007cWC\315\216\245\211.@<t\373#\374\357$\036\263=\344\231\257\312\036\203\313\213\207\032\273+\362h\003\322cH\273\273\252\037W\221*\003\231\031\236\324a\233:\213J\332]\022_\305WX\r\256+zTE\300\362BD\252\217\342)\034\370 \233`X\213\316\206#\334\204&\355zH\374\022\227\221\340\203\036=\001%\337=\372(\321c\006\332E\201\202\256F6\330uBe\326\003\253\252\250I\3130mci\323\346\242L\246*\323\246\221\002\306 X\331t\202a\331\004\362q\327\026\230\377\202\214\0334\234v\240~\374\357_\251\260\022#E\0165\305\016\220\266\202\005\371\316\252\234?\024"
+	.string	"2\003\006:\006\023\003\211i\373Bf\017\\3\034\f<E\"Th\n\374>\265\206L%\240\270\f\324\005\263\254\262\2744\021\234{"
+	.ascii	"\227\243\006\361\207R\006"
+	.text
+	.section	.gnu.lto_applyAccelerometerTrimsDelta.58.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`&\002\255\017"
+	.string	"V\334dD"
+	.string	"s\224\016\233\002\204U\333\264:8\223F]\214,\352t\313L\306b\004,\006\005\244\206\252\220"
+	.string	"\3247\327d\001\314\022\3504gqf6\374\273W\343xR\251\216EjI\204\322\217\345\372\277\344\223M\244L)M"
+	.string	"F"
+	.string	"Z"
+	.ascii	"B6&\266\250tl?\355\227\270\t\323['\027\331]\301Xv]\007\214`{"
+	.ascii	"\264\353\002\264\307\355\001\264G\233\354\037w\261\3663\202\004"
+	.ascii	"\312\nlw9\005q\323\323\344\377\3047)\325\205\247F\301\356:S\252"
+	.ascii	"\r\267\336v\001\333\r\354\024\021Oy\264\005\223|\352\3217\321"
+	.ascii	"\036\257\207q\200\t\322:e\314v\241R?\330\317vw\255+\373\255\037"
+	.ascii	"@\246=\232\356h\232\223\351\215\246\267Lk2\255i:j:\313\264j:"
+	.ascii	"3}\021\217\212\017\3253\360\330\325\020\013.0\254\215~&DK\243"
+	.ascii	"[w\032-3X4\372\321\321\241\245\251\214\0300^<\005$\252\226ij"
+	.ascii	"\324\217\013\006\017\250\214Y5s\341]\346\325b\264\261\200P\362"
+	.ascii	"\227W\312\211\366\250z\231\036\327\324\243\f\261\204\257x\tX"
+	.ascii	"6\205\257\030\221\370\273\212\022\003\257\335%A\361\024\241\003"
+	.ascii	"\240\222\250c\020\216<\360\301\204P\311s\020\201\264@$\372\300"
+	.ascii	"\001\016\215\220>\257\004\002;Q\027\n\201\270\020\374BR\027r"
+	.ascii	"$\0174\342B`\310\215\020\360W\241\003\271\322\367\201\\\307u"
+	.ascii	"z\266\272\362\266#\026sR\224=\232\003\307\r\033\035\365pt\323"
+	.ascii	"\216~^6\312\251\341}\206\025, \260\202\231\032\355\"\241\027"
+	.ascii	"30\206\247\004\326\220\217{0\2763\211\356\r.\310\337\204\220"
+	.ascii	"\304\356\365bZ\003\006\016\361y\260\016\241 E\212\361b\304\342"
+	.ascii	"q9X+q1\027\344\005G\374\031J\276\035V2\212\305\270\206\342l\237"
+	.ascii	"\201\320\246\277L\350\275\315\372\353\320L\3266\373\024\350\345"
+	.ascii	"E\233\311"
+	.text
+	.section	.gnu.lto_accZero_saved.2.75.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"\005\001\006\025\001\002?\202\210\200\030\1773\273\0014\273\001\274\001\273\001"
+	.text
+	.section	.gnu.lto_angleTrim_saved.1.76.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375 *=\001"
+	.string	"\370\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001"
+	.string	"\005\001?\202\210\200\020\1773\273\0014\273\b}{\274\001"
+	.string	"\002"
+	.string	"_D\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_accDetect.part.0.89.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`\253\001%\020"
+	.string	"\346\235jH\360\2226\035P/\213\200$~\371\312\307P\255\321\3052\376\304?\211\350,\237L\303\007/\037\3074x\354\365\337\323\250\371\207F\303\264\300\243\224\312\2418\233\243E\3754`\312\340B\257\272\337cifn\214\326\264\311\336)\005S"
+	.string	"Y"
+	.string	"T"
+	.ascii	"5{\211\366\352\2638y\027\336y\202\025<\273\013z\365\202\355\365"
+	.ascii	"-\234\2422\252l;E\205\264\351\254\025\314\313\025\207\226\220"
+	.ascii	"]\026\367JM\334t:3\223?S1\247\323\303\216@E\020\035:\257\030"
+	.ascii	"\020\237\003\236\211\254\354\256\267\020w\275m\007\266)\3303"
+	.ascii	"@8\207\371C3~\306\366\370\032\177S\232,\213\022A\347M\311#\273"
+	.ascii	"%x\304\"l\257\256\3616"
+	.string	"$\023\332aQe,\233\366c\274E\336\206\244\251F>\224\253\223W?`m/\321H\177\3464\376\274\372\305Y\344a\224\266\223j\243\321:\301\263\313R\360j\006\333\253\311\th\017.\363)\317\0338rl\240'\223\334\200f\373\3445\300\002\253\335m\340\347<\206\301G\361j\361e>\365\242\275\036v\320\017 5:/\037\250\3313ii\232=[*c{\372\025\264#`\304.L\317\220%Qm\2448\316\357\372_\247\366\355\327\214\276\214\317x\2378\001\224@\222\341k\241_\330\221Z\302\216\305\363\272O)\034}a\265\207\"\002C\243.\374,|\236\327qb\b\212\242O\344D\241\316\205\363B\221C9`\360\302\027r#\020\f\271\317\263\2452>\354\020v\364p\345\314\337\244\235z\240^AQ\r\224\226\266\001\314\371\220fW\b# @B\004\235\331\006\306d\361dc\f\221\b;\002tOi\257\332"
+	.ascii	"@\236G\230c\220\337\002\356\203\371\022!\035L?\2244\016\334s"
+	.ascii	"\271{\372\b\256'\247/\t\333n\333<K\036\370\373H-\261/\344\013"
+	.ascii	"/\205+\026\273X\013\253\021T\303KLQx\377\265e\f"
+	.text
+	.section	.gnu.lto_accInit.part.0.92.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`\221\006\325#"
+	.string	"\026\377\327E\220^M:<\226gt+{\320\317s\230\222_,\264\312\013@\342p\315\237\361u\250\341\334c\362k\333\376i3\223\252\300_\001\335\r\324\032"
+	.string	"\344\002\254\002(#n\242\263S\344I\214\326M\255I#\233\310\235R\275"
+	.string	"\300"
+	.string	"\306"
+	.string	"\247\336@V\251\311\342_\275\n\f\246\nC\306\255\034\243\322\247I\255\265\024\375\252$\273\264i\330\345\351\2740\351Sx\242\260B=y\247\375(\227B\343Sx\226\325\032\004\311\226Z\205\020N=\201<\265\275\300x*~\300xj\377\211)THz\242P\201\206{\027R\341x\221\257\246\253\257Z\205\267\323%\342\275(\274\311\331\373LF\306F*\356,{~L\310\367\031\217\313\304"
+	.ascii	"\022\262\232&\031\023\032\222C\3521\251\217YWp\346i\207h\233"
+	.ascii	"NP\300Ig\020*\352\342\253\016\024\345\305j\r\026T\324wI\264\325"
+	.ascii	"ZgP\2779\005\274\214\t\325Z}\245\0367\355\266\257\330\006\332"
+	.ascii	"\243\205.\201\374\326g;\304\305\214\b\003\346K\207;\244\314\372"
+	.ascii	"\241\321&q\256\241\232]\342^\210hT\265V\013Z\3372\341\03795\256"
+	.ascii	"h>x\352\027\215\247\257:\203+-_v\224f\237\271S\336\362\263\326"
+	.ascii	"\352\363\n\261=]\373\371\231\246\225\345\364L6-\243M\223\262"
+	.ascii	"\351\330\205\377XN\323rZ\234M\257lz\222\323G\020\204\005\340"
+	.ascii	"G\2558\372\354\251@(\227$\307\362\371\304\305\005\f\2738 \244"
+	.ascii	"\3121\003\343j\202\262%\311;\241\245\032L\"\326P\b\345\253\376"
+	.ascii	"\204A\326\362\241\f\357\266\006\223R\220\333\222\017 \023\013"
+	.ascii	"\311\017\260\357_\271\225\237\345cI\262\355g,k\331~\302\n%\002"
+	.ascii	"L\027\224\240\261=a\325\3467\301\354Y\247o\310?b\016\035:\214"
+	.ascii	"\247\261\335\2501N\244\350N\3519\23701o>\267\346\224\021c]\347"
+	.ascii	"\215\266\207\203\361jydQ^\232<\316m\276\031\346\375\356\224m"
+	.ascii	"<Rk\347\216\275\250\026\327\304SG\352`r\3749\366\242[a\347\215"
+	.ascii	"q\252\021%\265V\007pl{\3210\\\265\372\376\303\376\033\333I\266"
+	.ascii	"\027IU\237\274<\203\325\251\211\222\n\244:8\035wnu)\003\234|"
+	.ascii	"L\327\376\3606\036\326\330\020\321\272\366*HG\\\017\357\371\253"
+	.ascii	"U\t\210\356\201_\226f\037\357\212\273a@9\273\373&>j\206\036\244"
+	.ascii	"!j\200fn\3114\314s`\336\352f@\030\240\252U\351\3012D\t\310lV"
+	.ascii	"\021!F\016\305-E\213\003V\2613\232\201\023W\340b\350r1\216:\244"
+	.ascii	"82Z\321\202\005.\004\222\216\227\202\200\213\"\034!\031\275\300"
+	.ascii	"\351r+rEE\270\333N\207\264;\312\355nGF8\026\267\"\335\356\026"
+	.ascii	"a\201\221Z\344t\267\027HH\272[\371YW\210_\365\rn\256X\031\312"
+	.ascii	"\376\336X\253\255\205\224vi&\333)\227Fb?K\215\214A/\327\t\302"
+	.ascii	"\313\235C\366\"\371\340\345\376\354\227\200\211\003\374\0014"
+	.ascii	"\311\235-m\355\336\223^\224\371\240m\300\365\331\363F\256\326"
+	.ascii	"\025\264\255b:\365\246@\350\252\265^8\365\2641\203\030"
+	.string	"2h\3200\236\322\366A\035\262\235\355\233d+\223\3620\231x\344\374\221\373\254\003i\221q\"ec;5zh\f\200\213\250qD\005\215bDD\204D\222\2024\303\001\220\002\031\262\342<\021\200\265S%b\322Be\331\317\316\210\t\357%\200\336$\362W\300\350'\216\233P7\273\246Z\332\372\340\036\224\025[EP\303\313\347\352^\247\301\324\376\260h\266\305K\\%3\237C\234d5f\2131R!\260\336qj\302A0\361s\261\030< D\236`\0253\003\f\312\305H\263\020\331\212\303;\371\350\250lf\261\321\362\022\236\321\375F\b\335\317c\340q\251T\200Y\212H\367m8\304\335\315\331\004\277\370J\335\026g\017Y\260\270^<\273\334\314?\f\242\327\236\032s&\376\324\207n\376\"Y\360|\366\365\027z\310\300`\241#c(q\266\261\3455\332\371'\207\033*\003\364\2079f\220\200?\030|\211\023\230"
+	.ascii	"\202tZ]$\255\236fJYT\236H\311\030,\222\004 \231\353\276\\}\266"
+	.ascii	"g\rjg\373\322 n\204\333\013\307\204\220:\347\316\3148W\004\371"
+	.ascii	"\336-o2\367\032\217\310\263\220\201\217\n"
+	.text
+	.section	.gnu.lto_accUpdate.part.0.94.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`x\f\345;"
+	.string	"\ne"
+	.ascii	"\026AP\346Q\007\377_\317\241\376\323\013\311l\342\360\315\340"
+	.ascii	"\364\177a\250|\024Vt\234\347\037\334\"#\334\312t\357B\370X\243"
+	.ascii	"i\232\210&\006p\344\224\254p\004/'\216.\302\214l\255\335M\366"
+	.ascii	"\3362\245\024F\001<\001N\001M\327r\211\265\320h\333]\316\271"
+	.ascii	"D[\206\215\307\335p\270\306i\201\300\344\234ot{\032W\323\355"
+	.ascii	"\353\034\016\327\253[s\311\226s\366\345X\333\313l\265C\333\327"
+	.ascii	"\335\216f\313\317\354\370\0179\211d\312\327\306on\346\3653;\332"
+	.ascii	"\3159\212\323\330\372\372\244\372\372\337\237[\356\326\243\351"
+	.ascii	"\231\311\304\372\277\333\333|\314\353n=\234\2303\032\24469?\037"
+	.ascii	"\370\332\021Z_\373\351L\254\257\255+\261\276v\273\230\356\336"
+	.ascii	"\022\353~\273\005\371\263\231=\272\026vfQ\316\271\350+Nc{\215"
+	.ascii	"]}z\023\325\327\223\210Ca\020\370\363\365\334\226\307\256*~\245"
+	.ascii	"\267\235\313\223\246\250\020\232O\224B\246\346C\336\2069^\f\224"
+	.ascii	"%\n\231\232\013\315<h\266| T\0242'\376S\033\334\271I\344z\304"
+	.ascii	"\234\250LD\254(\035\332\344}\352\020\302\033%\337\343m\220B\266"
+	.string	"\304\335%\336\276q(=bL\324'\250Ci\021+{\236:\3149\007\307\302T\b\037d\254\353\331^\026$\276\276r\354\210\253j\203%\035#\301\261/\225)\317\231\235o\314\353\261\313y\003G\203\224cH\374\223\\\211\267!\347\334\236\244\342\275\344\335N\244\273Qt\373~\004\027\332\355<P\007\017 @\260\2766\305)\013%\177\312\303\353B8\335\205n\021\016h\204\307\225p\251\t\207J}\375\203\261\323\251\311y\022\n\347\207\212\231\255:\n\3261\2167@^\337\250\333\3678\037\024\355k\235b\305\n\326W\307`\332\026-\333\312p\316\231\013cf#\331n\026\216\007\371k\346\234+\264\333\361;-\332\327|m\027U\357\312*\326W\207\372\257i\263[\262\035J\376\3641\263\261\222g\214\326\255\300\375N\340~K\271\337\b\242\200\337P\300\357'\367\333\311\375>\320~\033p\277\013\270\337\004\334\357\001\355\267"
+	.ascii	"\367\273\311\375\016\340~\003h\277\231\334\357\245\340\267\022"
+	.ascii	"\373\235\344Owb\357{\b\374\026\376\276\203\277o\340\317\375\366"
+	.ascii	"\371\276{\356\267\353t\336m\357\233\307\272\337k\373\255\266"
+	.ascii	"\337\330\335x?\357\3333\024\027\t\2279\023\231>\312OV\271+\356"
+	.ascii	"\306\235\316]\216\323i\t\024\266\032\251\346\262/l\327\b\017"
+	.ascii	"\333\242\354\365\234\222@\341F#\233\276p]\0358\266E9?\213\276"
+	.ascii	":\232\3668s\344\004\232{C\247&\272\346.\352p\355rn\266\372\311"
+	.ascii	"\353\231\307\304\332\004l\367{\344M\362\256L\302Nl\300\tO\304"
+	.ascii	"\335/\223\327\311\357\316\027<^\230\253\261\3770\323\221\017"
+	.ascii	"\211o\211\310\030\332\363G\314^\267!\3668\177\247\025\273e[Y"
+	.ascii	"\361\205\330\341\276\310{\326\346\234t%\231\021\200t\254_\346"
+	.ascii	"\233\366\256\354 \026z\225\260H>\365\030,\020\007q\177XY\327"
+	.ascii	"O\325~\310KE\201\264K\274\020\023R\322 @\006p\354\234c|\230\331"
+	.ascii	"\276)\356\017\257S\332)o[\374R\276\327\342\037v.\217\356\370"
+	.ascii	"0\220\216\006\370\037\306\245\346\207!R\026b\360.\356\341\356"
+	.ascii	"\367\312\233\345]\351\303O_\230\253\373\275\260\244\232\312\357"
+	.ascii	"z\267hh\372\332\317\365\311\267\313\373\345u:Y_{\330\225H\222"
+	.ascii	"?\315\362iG\245\232\221\214\016\225Br\261\277q\006a~\234rn?s"
+	.ascii	"\316-Fk\177\305\260<\374\342\255\216\2217z\305\274m\257\333\353"
+	.ascii	"\306\372\312\303\016u\004I\3728\313x\230\331n\335\312b\\\367"
+	.ascii	"S\3768\310\003\177\354\211\336\352\260\2539\347\314:"
+	.string	"\360\307,\366&\216\006\201-\273~\332+V\324Q&)\007Od\f6\021\271\212W\214\351\300\356\f\205xPhD\002B&\234\356T\354K\273\303Hn\305XP\b\f\001H,\035U*\022\305\025\r\254\0236\262\256\216\307\033V@$\r\254\343\t\031V6\260H\300\310\3420c\206\326\221\330VTYZX6\252\216W3\256\254\254\252\212\310\243\0262\353\nY\314\302\252\242Q\264:\"\213TQ\255U\343\352X\264\241\245u,\372\3343F\353\rI\334\2254T\200q\235p\312\243\242\210\016<\n+\300\336$\322\240\004\270MT\n#\300\t\260\n\tl\331\025\327\321\nM6F*\351\032)\\A-\314\247\351h\333\017}8\243\017H\357\331\031\353+\002\354s\234A\230\"\347\020\n\237q\340O\030\n;\330\262\253\314\2775]\373Z\373\230\366\334\273\262\347X_\237\230\334\260,\333\312\234\360\323m\314\001\\"
+	.string	";\031\300\007\330\304\030x/\357\004\363\345\275\351X_\013`\336\234\034\002\230\313\026-\003p\023& "
+	.string	"\017\300rE\300\203\257\262F\245\t\363\346\224\310\005\300jM\343\357\323"
+	.string	"\340%\034"
+	.string	";\030\026&\f"
+	.string	"\177\035\260;\346\313E\325\314\331\353\355z\264\367k\2014g\257\ng*\336\260\3665 \254\257L\230JM\316\301C\351\250P\252\2469\374\023\343\257i\266\204]\215\277\031\333\243e\233\\\362\233\274\023\253 \357\220!\254\257J8\005\"gY\362\247B\"nA\314l$\233d\341U\177\213\004\200\363\250a8\345\224RhhDD\222$)tp\002\221\031;r\003\022@e5\246!\307\220\235\024\224\030\366\237\003\027K\350N\350\f\3147\267\017\274,\025\032s\257\231-\334\3567\3350\321dW\326,\343\366\300G\233\310\001\213(\037\341\035$\301hK\036\261t\272v\254SL<\301\231[m"
+	.ascii	"\001\034\242\250\366\361;\217|\317\242T\253\257\202\234\004\006"
+	.ascii	"\316\263\304\212Kj\316Y\006 \263i\207\260eN\024\033S\353\357"
+	.ascii	"\003\265\016\026\225\274\032\307+N\257\027\325Q1K\356\205\201"
+	.ascii	"?\252\2029\346\257\347|@J\356M8*\360\251\243\024\353x\353\304"
+	.ascii	"pL\203O\200\215\016\033\236\222\032\201\254\344\357W[=\323f\\"
+	.ascii	"\2321\206\r=\276\240D\270\250\302\017\261\0240\231\037>\341\177"
+	.ascii	"\244#\034\221H\203Zff8\273\242o\244\r\212\347\350jJ\234)\370"
+	.ascii	"\346\017\027\377\302K\341\263\350\007`1Ag\2007\325\237\345\001"
+	.ascii	"N\354\3213\232L\206\362\346\336\017\350\032=\351\306\005\226"
+	.ascii	"b\366\362\364\300>\300\201C\305\350\205\377\236h;?\224\013x)"
+	.ascii	"\370\3573\310M,\267\222\261@\202X\274\276\364\304D\030\035\016"
+	.ascii	"@\3648\261L6\n\217\231\373\211\"c\231\315\233]\306a\f#\341\031"
+	.ascii	"^\216\rs.8\335\0038\333\200eq\220\231\210\362\210.\216\361\034"
+	.ascii	"\t\2657\322\324\016\3434\327\255B\313[&\257\024\276\351\377Z"
+	.ascii	"\233v\317\306ElW\221q\353~)9\341\220\222M<\201J\336\235\370?"
+	.ascii	"\277\031\232V\310\217\0168O|DD7\301\205\334\235h\032L\030k\n"
+	.ascii	"6\303\0177\035\304\206\016A$\233\277\244}'\373d\237\241\021`"
+	.ascii	"?\260\357\243v\033\315|3\302\213\323c>\024\340\310\376\373\007"
+	.ascii	"\033F\314\220\344\245\351%\327=M\3443|q\364\220\224/\314&Y\226"
+	.ascii	"\220lJ\347e2g\240\002"
+	.text
+	.section	.gnu.lto_accGetAccumulationAverage.part.0.95.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`*\002\025\022"
+	.string	"f\343vE"
+	.string	"\317&\035C\\\215\351\217\272\007P\020\230\253\341\352i\024nd\342\307\212\002\364\340'\362\220\271sn\300\257\225\261\200<\224q_\0354\206\255\252\252\377\255A\253\212\221\357Y\344\200Q\320\345\371\0167\262\367\2262\245b"
+	.string	"e"
+	.string	"["
+	.ascii	"\244Cw/\020\017I7\305C\373%\374\001\322\202}\200\270\374z\007"
+	.ascii	"\002\3466E\025v\210v;\356P?X\377\272[\363u\3704\343\313O\013"
+	.ascii	"\261\224\303-$\347\017'\2466#\304\023\313\360\367\006\354n\200"
+	.ascii	"\030\313c\260\273\367y\276\304TR\001\334`x\232\036\267\220\335"
+	.ascii	"5I\303\275\3356\212m\bvF\b\013s4c9@\0266\247\375\265\247}\277"
+	.ascii	"\346\323\323\363\226\266o\306e\310\004\211\323\256\343\257pi"
+	.ascii	"\326\362\006K\2671X\216?\363S|\307u\025nAJ\201\221x\200\214d"
+	.ascii	"\354.\307\241\037\220\0167^\3729-\273d\273\354\322a\276k\035"
+	.ascii	"\350\366\002\314\232\366O\034\307u\024\376\271\306.\315O\320"
+	.ascii	"n\327q\350\006\001owWUf{\301\257Q\r\350\270\304h\2211P\002?\310"
+	.ascii	"\304@~\b\337?\361P\301\020\221>\205\372\226\021\357v\021SU\337"
+	.ascii	"\"b%\217|M\275\317!,f\266\"43R\311#\353uwSRe\326\370\257\322"
+	.ascii	"\330NoQ\323\360\335\377^Z_:_\273_z7\033\004\310l,\021\n\247\227"
+	.ascii	"\222pZ\245P\034\214\234\220\234\240P'\223Q\036%*\021\223\323"
+	.ascii	"*5\222B\241N\034k\245b\225\244X\\\211\310\211\204C\255X\234\007"
+	.ascii	"\002\253&\244V\234\211J\265\342J\377*\r\201\347\277\342\266\251"
+	.ascii	"CTt\005\252\314\327 zq\003#C[\355`\375\237\312\fk\"\307K5\031"
+	.ascii	"\365\372b\333\035\277\246\007\035\030,Yd}+ `\202Aw\266\r7\"P"
+	.ascii	"Ab4*\360i\230 \327\270\020a\247\250\272\216\355\030\315K\334"
+	.ascii	"\331\213\037\255\276\021\216\030\233\nNi\300\003k\020\336W\262"
+	.ascii	"G\351<F;\232%v\225\257 \251\020\200\001D\341\334\245\251\027"
+	.ascii	"\3575\311U\206.6@=\254\t\333-4\032\027\260\203\342\211s\005\351"
+	.ascii	"\357\275\026\343\001"
+	.text
+	.section	.gnu.lto_accInitFilters.part.0.96.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`\036\002\005\022"
+	.string	"f\343vF\340\322&\035\220\314\241\227\330\"8\245\237\236\375\334\255i\341\247\205\310\325\027{\027\"\251\007\254\342\005\376\323@\243\353\225\264)F\236\353\3022\306\271\335!\306\030o0\215y\276#\302\032\277~o\034\177\033\311\336R\246\024_"
+	.string	"f"
+	.string	"b"
+	.string	"\001\264Gx\022\355\3212\0072\313\213hK\377geo\333\343S\330^\341\230e\357\370\007[\223\036\022\027d\263\335\345\036u\204\365\360\2735Y\207\232\221\345\203\254\374<\304s\315\034B"
+	.string	"\273;\342jA\002\273{\331\363\306E\223*\322\263\341I\362\b\262\262\273&q\270\265\333v`[\201\235,\001\326@\322\021ji\215\351\204\351\213\344K\305gW\303\321\217\005\021\207L<\350-V\216\201\373\372`9\217yB>\263m}(fq!\031\307\230|\260\034\221\231\207\0346f\273\037\367\350\217\224\366\375\240\003\3712o\261\225OZ\337\272p\376\343\307\276\253`}\205\211\2769\373\f\260\236\022F\273\213\362\350\002\244\307\223\007\032\325F\220 \357\371\304Fg\354\023Q\030)\362lW8\215\005)E\273{`\3503\0304hi\321\036\243\336\353\220\252z\033\243\307\270\214\222\317c\323\351\244!/\373\301a\240H\273k\300w\361\027\021|\236G\273ty\357\321\357\264\307\353e\207(^5N"
+	.string	"\321\344\221\365\272\2733\251:\326\370\325\020\016\206\240BY(A\233T^:\024L)u\222p2\231J\234*\325\251^N*\356\005Ur\341L)\025\247\"\300\335\204S\212\203\351\272\024\267\331\316\373\307\200\243\307\r\032\255\261\376Pu\034w\"\312\267\235\324\024\352\215m\247\034j\212\210\351h\245\017\353\341\356\256\252\216\355\001\207\252iI\314\343a\363\241&\217\\\222W\r* P\002aL\253\r\2706"
+	.ascii	"\220\235\210\t\301\333g\253\332\t \246L\226h\f\354\316\323\232"
+	.ascii	"\0216\177\331Y\224uo\2676(<\215\023\267\204\257~\260\036\270"
+	.ascii	".'\f\354\030?\341\264\225e\235\302\022\261\214\021\234\320\007"
+	.ascii	"\027\302i\303\240u\ne\244\241\214yk\013Ak\210o|\203\251\345\256"
+	.ascii	"\275'(<"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`\346\003\365\022"
+	.string	"\264\032\342\004"
+	.string	""
+	.string	""
+	.string	"\002\"\177=\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\0023\177>\001\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005)?\200\204\001"
+	.string	""
+	.string	"\003\005\310"
+	.string	"@\035 \201"
+	.string	"\005*A\0024\177B\201\200\200\200\002\312"
+	.string	"C \313"
+	.string	"D\005\314"
+	.string	"E\315"
+	.string	"F\316"
+	.string	"G\317"
+	.string	"H\321"
+	.string	"I\002\331"
+	.string	"\177J\271\204\202\202\200<K\002\334"
+	.string	"\177L+M,N\002\336"
+	.string	"\177O\001\303"
+	.string	"P\005\304"
+	.string	"Q(R\005'S\002\337"
+	.string	"\177T\002\340"
+	.string	"\177U\036\177V\272\200\037\177W\004\005#X\002!\177Y-\177Z\252\333\3426.\177[\215\276\360\203\003\302"
+	.string	"\\\002/\177]0\177^6\177_\206\237\370\301\0017\177`\363\276\371\3308\177a9\177b:\177c\005&d\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005$e\001\311"
+	.string	"\177f\377\037"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\320"
+	.string	"\177g=\177h\377\301"
+	.string	"\177i\305"
+	.string	"\177j\306"
+	.string	"\177k\307"
+	.string	"\177l;\177m\377\300"
+	.string	"\177n?\177o>\177p\377\003\001*\310\217\364\031\001\344\023\003\006+\304\022\003\006*\250\270\275\324"
+	.string	"\001\304c\003\016,D\003\020-\003\001\204\013\004\020\002\001u\003\023\006\224\334\236*\001\302\017\003\0230\001\001\204\017\003\023\001\342\016\003\023/\016\003\023.\200\200\200\300\001\001\204\n\003\031\244\001\003\0361\320\360\372\250\001\016\320\241\314#\001\302\n\003\0374$\003\0373D\003\0372\204\001\003\037\036\242\007\003\037\342\007\003#\023\202\001\004#U\003$\030\363\276\371\330"
+	.string	"\001\202\n\003&\031\302\001"
+	.string	"T\250\201\020\343443\222\202\244\225\003\240\002)*\233\007\021\260\234\265\214H4\"4\022D\322\001\342\350L\231\016\232cTa\332h\351\241\252D\357%19>A}[?\325h\252\244\034\022\250Z\240Z\034\266\216\314"
+	.ascii	"\276.\345H\336?\035p\376\347\307\236<\031\23217\004cG\323\363"
+	.ascii	"\265E!.\313xlond)\312\324\223^\236&\240Mm^\360\213\333\242\023"
+	.ascii	"\315K'\306D#\353\372\007\264Y\345:\\\363\324j\"\244\035\251\272"
+	.ascii	"\236f\361\030?_\354\233\":\223ZlI\342\326\325\366.\271-\n\267"
+	.ascii	"\240\005^\252\2066%\276\335\"w\200U"
+	.text
+	.section	.gnu.lto_.refs.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`\002\001M\n"
+	.string	"&\\H2`g\223t0\f\3030\\\t\202 \b\202 \b\202 \b\024f\035EE\215z\217?\201\217j\037:\342~\364[\214\335\326v\263\2555j\226H\262e\n7"
+	.string	";"
+	.string	"<"
+	.string	"\034\241/5\0375\234\261\374\303p\207\341\f\343\013\343\213q\265\236\313\212\310\225\343\224{I\177A}\202z\307zI}\343\336Y\337\2243\212+\372U\257\024\347M\306\263A\234\225\267\257z_\237e\303\231\fB|\006\375\005\315+h>\301\372\003\315O<\\\342\371\002\013\217X~"
+	.string	"\363\025\346)\354\037\330O\3307\254\227,x\304\341"
+	.string	"\226\207\254O(\237\232\225\356\213\206\250\021L|\242o`z\211\007'\360\370\210\362J\037\242\334\241?)\217\364\031\326C\356v\364\243r\206tC\375E\364\254\313q\b\007\220\017\244;\212\276\321\207\242\177\312\235\006\177\020\327\216\242\206\032g\355\227&\240\253\350\0075\027\0358\364\340\315\304\325\364|<\351\327k\270"
+	.string	"\224\360\247\267\323X\344\227rE\373U\256\312\331c`V\215\013\352k\234\215\nw\r"
+	.ascii	"1B\343\217\373\033\341\266\b\204\335`\252\033z\210k\270-\nv\261"
+	.ascii	"\330\330,`\276\031\255\251i\373x)4"
+	.text
+	.section	.gnu.lto_.decls.f919a04ef468d614,"e",@progbits
+	.string	"(\265/\375`\350IU>\001j \nvV JQ9\351\024\270\261\342\2630$8\274\272\307\316\375\366\361Q\247\233\346\325p\327z\236E\341\034B\275\331\272\335\n\001\301\b\306\252\232\325\207ut\263\337\216\227\013P4I\323\244m\222\024mY\036\244)Zi1$0\216\3078\216\022U\331\375\335\266%do\271SL\006g\007x\007>(\031\020O\013\032N\246\372\376\244\303\337"
+	.ascii	"H\013\261hW\370\211\016\037\315\234\227\377\033I\217Uf\213\365"
+	.ascii	"\220\337e\316kgbM\244\217\354@-3\026\323r\f\231X\316K! !\235"
+	.ascii	"'~l\264\320[\244\215\360\254\370\201\302G\337\2371\212\234,\360"
+	.ascii	"\257\232 \035\326Yj=\362\202|\301\277R\332G\275\353[\223\242"
+	.ascii	"\357o\032\356\036\277K\272t\254R\253\356\255\357o\031\376\025"
+	.ascii	"\202\037\246\376\240\215\243s\274\301\372+7\030\007]9+\033\214"
+	.ascii	"\247M\316J\236Z+\250\265\202K\366\025\344\tz\177_\300\2776\360"
+	.ascii	"\355\252\017z\277\372\203\376\316\300\300e\375A\357W}\320\216"
+	.ascii	"\3212*\323C\317X\362\004\277\234\241\261\326\3677\013\277z@y"
+	.ascii	"<\240\267o0\214\277\265\026\275\032~}o\323\3407\253\017z[\207"
+	.ascii	"k\316\302j5\025J\030}W4U_u\016\\\033)\255\276]\325,*\363sm\025"
+	.ascii	"\204Z\3464\036tN<\372\336\316\341\026r\316\271~\016\005\376\375"
+	.ascii	"\375\375\325\317\241\267\253?hN\365A\377V\201\001\206\222\302"
+	.ascii	"\226$EO\331)\252\256\274\226\3632C\315xZ}}\033\005\220\b\222"
+	.ascii	"\032b"
+	.string	"}o\317\360\377\216j\247~jeCUfKU3\257\315\252W\315Z\252\356u\336Q.3\326\316\227\f\030p~-U\361j\031 \023\026Z\354\352\035\372\265\305\026BDKU/U\314\216\3232[\001\277\254\226\257g-U\227\324,;\312ev\332\271\213\001$$$$$d\325\272~4s\356_P\316\225/Or\337[\037\330MmS\231\365M\345{\253l\354\022\016\277}\245h\276\251L*\232\035eO\206\372\232\n\3139\007\t\ta\330\353!\003\275k\200ttt\031\261\321\367\266\005~e\203k\243\246\246\251\314\352W\373\322\374j\\m\333Q.\363\325\007l`\300\001\tY5iuM\364\276\261\340\367\332\231W4\177UR\317\322r\316\034pZ\330\211\211\3217\004\321\353\031TL\356\206\232\276o#\370\315\372\203\356T\037\364m\003\3271\225LebP\363\226<\355\303\r\223I\337\267\026~\305"
+	.string	"\265\177\177\025\003\364\275\002\327/\025LeNP\303<\204\210[\247%<:o\306\336\260\351\373~\302\257\023\240\365\257N\200\276\366\341z\327\225K\355\362zW\267<\204\210\347@\345$9/\353\335\315YYk\005;\265Vp\316\375P2A\357k\023\277\336a\240\372\203\326\005\241@\274\254\231\353\373\352\206\337j\225j\267\343\276\271\322\304R\255Tf\275R\241\\\251L\252\333\316\231\263\322JX\316Y(H\b\307\006\016\254\024\350\245\002d\375\252\300\261\365}%\202_\331\340\334\352\231\224\332\266s\346\334\005%,\347\374\277N\251tU\2562\353\\\215\362^~\203\237\350u\256\306\325\266\016Q9w\321\360QNyB\304/\347,$\004$t\3665\325\350\341\373\032\205_\304/\302\317"
+	.string	"~\005\360G\340\277\252-+Zm\253]9C\345\2349"
+	.ascii	"\263\344\320\242\364\255M\252\223\312\f\252O^\323*\333O\3452"
+	.ascii	"/s\316<uo\307\023V\337\236\372\203\036\001\370u\355\021(\263"
+	.ascii	"\210\357`\017\344\\\203\320\372\367W\203\320\232FTV\223\370\240"
+	.ascii	"W[\313\274\226s\346\261pS\244\332\364\355\352\203\036\003~c\020"
+	.ascii	"\365\007E\253\017JA\375Ao\365A\017W\177\320/\353\017\212\253"
+	.ascii	"\017z\201U@\257\340\360\237\034\376[@J\307F\300\232\360W-\177"
+	.ascii	"\265\353\373;\307B\340o\001\330\007\350\375u\213-\241\311X\022"
+	.ascii	"\236W\261\324\272:\344\177\333\303\210\375\265\311\nv\001?\341"
+	.ascii	"v\204\2775\264\320\200\377\352\375\r\306\216\370;\351o\243e@"
+	.ascii	"\331_?\240\344\257\312\347\331\005\374\307\240f\253\200\337\202"
+	.ascii	"\360[\021(X\360\337\033\177g\371\253\004\026\304\3770\177\235"
+	.ascii	"R\351zD\270X\377\331\234\371o\377\273\201\372\337\264\336\377"
+	.ascii	"\177n\337\371\317\t\254p\362W\t\362\254\005\355s\f\376_p\237"
+	.ascii	"\377\374\251l\277\377i\302\337P\366\303_!\250[n\201\216\322\371"
+	.ascii	"O\234\277Y\260C\177m\252D\376\332\201\352\202\206g\370\357\030"
+	.ascii	"+}\345\267\032\324\270\267\347Y\013\270\\\340\201\006\027\370"
+	.ascii	";\2055@\221*u\265-\203\315\340?\320_\331\276\202\365\360\333"
+	.ascii	"\013\252\333=\374w\204\377y\027\374m\003\375\317\005X\013\376"
+	.ascii	"\257\320\\'\002\376>\301\016\340o\007X\001\374\265\376\365\354"
+	.ascii	"\315o+\370\273-\005c\177\355\337\006\340\257@\263~c\001P\221"
+	.ascii	"T5k\355\004\277\375\371\033\203\355 \301\337;\177-\300\377\016"
+	.ascii	"]Z\002!\376k\343\357\021l\004\177m\252.\210\200\341\277U\177"
+	.ascii	"?\371\033\356\357\267\277\335\376f\373\033\312\337Q\346\306\376"
+	.ascii	"v\362\367\232\r\372\317\363\237:\376j\377\347U\374\363\277\b"
+	.ascii	"\370?\367\177\312\177)T\376\327Y\240\347\374'\006\025\037\347"
+	.ascii	"?\003\360\337\357\177\337\333\374_S\335\216\377S\202\337B\360"
+	.ascii	"\333\373\367\337\337j\376N\363\367\336\337y\177\207\371[\313"
+	.ascii	"\337W\376\246\373{\356o)\177\357\370[\305\337`\177G\375\315\364"
+	.ascii	"\267\215\277\271\376\336\372[\002\177\213\360w\213\277\261\376"
+	.ascii	"\266\372\273\352\357\025\177K\375\235\377\366\300\337\035\370"
+	.ascii	"\333\205\277[\370[\351\357\024\376F\341\357\007\374M\302\337"
+	.ascii	"\n\370\033\204\277?\370\333\203\277E\374\035\342\357\017\177"
+	.ascii	"k\360w\006\177\027\340\357\013\376\036\300\337\035\376\366\371"
+	.ascii	"k\007\376\232\301_?\370\353\361\357\376\353\227\277\336\375_"
+	.ascii	"\341\257X\376\252\374\317\345\177\333\377\277\377u\377O\370\033"
+	.ascii	"\303_y\376\332\363W\340\337\032\376\356\371[\347\357\234\277"
+	.ascii	"2\377\n\301\377\274\277\252\375\215\363W\264\277\201\177\225"
+	.ascii	"\340?\333\337\367o\373\3270\177\005\363W/\177\355\362W.\177\335"
+	.ascii	"\362W\273\277f\371k\335_\253\374\225\312_\351\376\032\345\257"
+	.ascii	"q\177\205\373\353\333_\241\374\325\355\257l\177m\373\353\223"
+	.ascii	"\377&\3745\303\177\025\376\032\374+\376\317\201\377W\376\003"
+	.ascii	"\375\375\375\375\375A\020\277\316\005~\016L\bD\336\2243(\310"
+	.ascii	"\377\377\323.g(/'\006xaAy\301\230J\363\302\3120\225\346\225\235"
+	.ascii	"\240\2008e\270\312^NSi9g\200\202r\n\241\013k*M\2313L\245e\254"
+	.ascii	"\034\305\005\253\346\245\227S\206\352\312\0312TV\346\264.,\n"
+	.ascii	"\246\240\274\260\246\322\224X\031\246\322\274\260r\232W\356\311"
+	.ascii	"P\312\253\024P\371*CN\363\322\313i]X=Si]XSi^du*\005\336\220\026"
+	.ascii	"r]:lT\264)\250\314\242\212Ky\325c7\265\354\312ar\256kR\371*\333"
+	.ascii	"\345,\200\234\271\272\256\302(aT\270';\026Om\312\256\272\314"
+	.ascii	"9\007U=}ue(;\247\232\355\246\212t\345\\\344\351(W\345\2343\007"
+	.ascii	"NK\273\314\243\3329\341\340\312TR9G\220\2279W\345\354T\263]\316"
+	.ascii	"\331)\347\f\274\342Z\346,\243g*\254\252*\347-\240\252\314\345"
+	.ascii	"\024'\225s\257\341\301aM\245}u\021\3055I\013\313(\226Nu\212\252"
+	.ascii	"+\207\3450^W8\315\t-S\345\234\353"
+	.string	"\031\034\206\325b\257\357\022\007\256\006\323E\337\233\225\243\324\202\262\245\357s\316X\335+\fy\005YZ\026\253\313b\311S\236TZ\337\345\206-$,R\2742o\212\273\"8\2253\026\005H\260\356\372\374\362\325V\006\301\2553+r}\257\n|f\317\214U\337\347\030\301\317\021rQ4\214\025C\262\372>\007\307\225\272Ql\032n\f\227%\027\352>\375\360\242\314\353{\225\265.\277\346\230}\237\203\205_\317\314<\t\263M\233\307\304\263~naVoMD\253U1;6\347\032gvJ\0312\266\r\366l_\265\333\002ALI\023\315\252\261cl\036\017\264\263\346\237]c\333\\\247\233\355\033\353\306\262\251L\253\306\246\251K!\036\271\272\037b\032\356q\366\360q\264`{\306\242\251L \313\307\345\211\005W\337\343P\301\037\310\025\b\375_\005B\217\023\005\037\207\r\037'\r\037\307\f\037g\210%s\265\352r"
+	.ascii	"\351{\234\036\3708^\330\203\372\203\376VLKa\024S\254\320\204"
+	.ascii	"\001C\006\216\317\254\357rMm-\016\205\030^\226\2737^l\227\031"
+	.ascii	"\312\267 }\227Pb4\3040\357Z\357\311\312\211\024.0\200J\252bL"
+	.ascii	"m\261C\215l\311\261\243\357\362\204\274\034B\264t\217\223\211"
+	.ascii	"\0252e\226\272\023[[J\260\334\326\325\266\332\2259\354\264P\023"
+	.ascii	"\223\321\327^!\272\305\002\202\017\034d}\255\265\342AG\315\227"
+	.ascii	"'\261*N\300 rS\346\250\320\341\345\200\022%wK\367\3339;\245\212"
+	.ascii	"\251Yt^A\372z\250?\350Y}\320\252\204\350V\356\342\350\263\032"
+	.ascii	"\"e\002\236\245V\025\216(\365\256l\312\327Z\\}\203\347\334P\211"
+	.ascii	"\002\347v\244A\305\357\355AH\342l\200A\351\f\344\353\302\264"
+	.ascii	"\342f\333\202]\260\254\221k{\315b\366\346FL\337\337\262Y&\006"
+	.ascii	"0Y+\230}\337T\177\277\260\314\326j\030\325n\355\036!\343\304"
+	.ascii	">\261k\266IeZ\246er\233f\325^Xfo5\027\bc`\300\371\265`\266\213"
+	.ascii	"\020y\226\3316\354\022'\020\360\204\204\260\025\247\02610\334"
+	.ascii	"`\256?h\275\252>\350q\270\260E\333!\323\2425\244\357qZ\340\276"
+	.ascii	"\321<\372\005\213v\205\331\236\3144\321\274\261OL\304\204\345"
+	.ascii	"\274\274\361\243\313\224_\036\314\266T\275\366j0\017g7,\324\230"
+	.ascii	"\215\372[\265[\313Qh\0060s\242\352\035\365n\001NH\336:B\210\260"
+	.ascii	"c\325\256\336U\273\255\354\244g\301\031\026\0222?{\304\232Y2"
+	.ascii	"[f\227V\211%b\215X1[\304\236\331$\026Ie\332\261\356{\323\350"
+	.ascii	"\032g\267c\275\244\317x u\365\200\2571\315\234\363\230\235\262"
+	.ascii	"a\035\236\246r\316\342\240lKw\375}\303\n\261C\252\335VV:qp&\004"
+	.ascii	"\t\231_'\031k%\265\214]\302a\024L\310\240\031k\276v\343\201\324"
+	.ascii	"U\220\005\023\274\246\331\337I\354X\233U\267j\267#g,\016\314"
+	.ascii	"\342\220\220\371\345\234u\264\360\254\334:\334\277\236\271\035"
+	.ascii	"\"F\003\231C\006+W6\372\036\303\027l\203\360\340\320\241\364"
+	.ascii	"\322\367\030\246\340\024\226\312.\303Dxb\321\364a\201\330\027"
+	.ascii	"*\323\376\200\262?l\225\275\341\201\324\225\004\236\252\232?"
+	.ascii	"l\217c\351\3604\225\2257@\bQCD\3536\331Q\305\006\276\3070\003"
+	.ascii	"\277\242\305\b\252v;\0300\204\255\306X\323\336\260,\354V\207"
+	.ascii	"\247\251\bPik&3>\267\023\314\331k\255&\241A\326T\\\036\252\335"
+	.ascii	"Z\bpI\2329/\355\rk\343s;P=\031\n\210X\263\231\330\033VF\020\312"
+	.ascii	"\203G\2200?\253\303\362\260^\026\314\342\2609\354\016\373U\231"
+	.ascii	"\366\206\355\202\022\002:\233\250\371\261\321p\037\234\202\037"
+	.ascii	"|\303\017:\301\017\236\341\007\217\340\007\203\340\007u\340\007"
+	.ascii	"i\300hs2\303\305\252\357\203T\370\277ua_T\246\325\262WV6\013"
+	.ascii	"G^\230\325\262-l\226\206<1`r~\026\312\0304j\350=f\303\277\315"
+	.ascii	"\262X8o\314h\274\261X\366jGI\020*\034}\217\211\340\343\027\360"
+	.ascii	"q\016|\\\003\377v\305-\325o\245,\212\006\323\300\311Lq\005E_"
+	.ascii	"\253\202\350vE\324\016\252\254\276\030\300\300\307Y\270\227\365"
+	.ascii	"\007\365P}\320c\024\230\202\352\203Z%\376\341\205Kn\317:\331"
+	.ascii	"|\267\226\303\364\265\371eP<\247)k\306t\2335m\264\342\202\364"
+	.ascii	"=p\n~e6\2335nER\264\365\3555\177\b\021\365.'w\310Y\203%\213\213"
+	.ascii	"\276\347k\277\377\301\235/J\336\244\370\245\331\251\342\222\275"
+	.ascii	"\322t_\260/\214\233\262\276\007\272\341\003\233`\020\325\007"
+	.ascii	"\335\3531f0\232\364=\220\314L7+\263\365\232\371^6\332\201\364"
+	.ascii	"Z\255\327\200b\232z\375\244\363\252\335VO\206*\343\246Y\233L"
+	.ascii	"y\263\207\336,\215G&\214L\217\3512\225\331y\357\274fk\271\035"
+	.ascii	"\247\f9\203\265\t\313\353\271\306\262\003\265\314Y\250\231\334"
+	.ascii	"\227\304O\b\207*\007\r'|\303\264\230\312l\274\006\303\245\277"
+	.ascii	"T\273\255e\316\332a\353\352K\342\207\327ZzK\207\247)\022\344"
+	.ascii	"\3064\261\224\036r<\320{ \020\374\367\227\267\027\235\024oD\300"
+	.ascii	"\334u\027\f/\266\354\344\372\036\350\205\357^Y\b\211\272\322"
+	.ascii	"\367\300\030\370\225\371\274\266{\231\353\003\213\226Y\337\003"
+	.ascii	"]\340\003\253\360\201)\260\364\224\256R\355\326B\310R\246\231"
+	.ascii	"s\276\322u\225\331X\332\n\226n\253b\252\335\026\bV\3144w\202"
+	.ascii	"\020)3C\357Q7\370\"\201rR\327T\232.\353\350\224\2411W\244\357"
+	.ascii	"\3213\370(\031|4L\224\226R\231-\327qo&\235v\240e\316mr\355\326"
+	.ascii	"p\035\236\246J\250\261\246\231D\256\333p\202\204\365%\361\313"
+	.ascii	"y\t$$\004\304\021\345\254\007z\217\232\341\277\341\336l\214)"
+	.ascii	"\2676\313\223n\253\313\217\276\377+\263\2414s\231\201p\360T\344"
+	.ascii	"2}\217\036\301G\201\340\2439\360Q.|\364\n7i'N\274\224\210\365"
+	.ascii	"=*\325\344\r\256\271\376\240=kp]\326\037\024\250\372\240_V\037"
+	.ascii	"\364\347\031\374\223\f>\\\rU\315\234\267<\330\031bj\364P(\364"
+	.ascii	"\311,\207\222\267\276?\372\204*s\270\344iy\262G\344\251\n\216"
+	.ascii	"\276\007:\303\206\315\371\007\324\345\204\006D\334\031\260f\215"
+	.ascii	"\212\032\263\372;\337\354\200EQ\023{\343\006\354\013\310\017"
+	.ascii	"\035+zj\240\332\364\220f\326x\001\r\232\0325\275\006\250\313"
+	.ascii	"\202i\341\205\345\2143\022\367\243\357\201\246\320\2409\323\324"
+	.ascii	"%\331j\203\220\254\277#~gk\270\230\235}?\323\234|\034\254\230"
+	.ascii	"1s\3561\263\330X\361\353*(m\230z?\367*\02124\314\364=\233mR\324"
+	.ascii	"\301\211\371\037<\277\372\310\274\365=\207\035x\307;\363\200"
+	.ascii	"p6\273\033k\346\200i\346\201!\3633\357-gJ\311g\326\367\034\363"
+	.ascii	"\305\024\243\365\267j\004\312\330\223\276\347\240\265e\313\031"
+	.ascii	"F\304\020\035b\330\311\023\256\031`~\206YBeEM\337\363\356\374"
+	.ascii	"\362?\310C\227\342\314\315\371\345\364\022\207c\2072/\247\315"
+	.ascii	"\214=0g\227\253\305\026\361\"\263\353{r\371\033\225%nM\016\312"
+	.ascii	"\272\272S\313\002\366\322\270\300\351Sqf*\313O-\367\356\354K"
+	.ascii	"\030\272*U\316+uI\266B\200\362\314\033\261\234\267<\264\2143"
+	.ascii	"YzX\371y\345\030\336H\351\261\365=\337\235\372\037\004\201\347"
+	.ascii	"\003H\337C \206\351\350N\025uI\266\252o{g\256\374r\336\362p\313"
+	.ascii	"\300T\275\365=\004Tss=\005\324\223s\016\032p\371j+\203\234"
+	.ascii	"7\027^P}\377s\346\354\361\023\211\225\262(*\363\354qJ!z\312J"
+	.ascii	"%\036\2702\b\216)\342\005F\337(mg\364\266\364\375\317\027\374"
+	.ascii	"\232D\354$\033\323dRv\216ux\232\"!\t\236\331yV\355v0\340\210"
+	.ascii	"\226&Q\267\235cb\302\330\316\270\023\356\204r\266\235o\225y\272"
+	.ascii	"\235K\266\323\355LR\313T\273\035\fH\022\246\231\363\322\355D"
+	.ascii	";\231P\3144s\316B\030Tx\331\321\330\271b\317\353\3604E\202\222"
+	.ascii	"\274\346\271v>\251\314\223y\240\rN\346\271\344t\202\343\306\245"
+	.ascii	"\214\234_\316K\241 !\235\275.af\240\367?\235\374l\322\266\324"
+	.ascii	"q\246\357\251\266\005\343"
+	.string	"JT\337\3774\301\377\311\2442\3174\314'\026\307&\357\177\020\207\256\307\027\023\374\0373\374\237\260S\t\366\322\244\221\245\357\177z\340\377\200\341\377\334\300\377\341\302\377Iv\216\245YA\223e\254\212\251\243z\352\373\237-|\0229\215\234G\376 \017\031\034\030[\337\377\\\341\237E\376\007O\350\241\205\255\357\255\237CO!?\207\374\301\276\022$\254\252\357\177V\340\237A\316\260?\270\023\006\b\023\255\357\177\236\360O \377\203'\333\037\232\030}\317\037Xj\003\037\006\030h@\2611\343\364\361\363\307\177\276\320:\032\314\205?7i\372\352T\037\264W\020\375\364\201\223eJ\363\254\3577P\301\347\216s\007\bB\312\302\256\230IA\365\375\2062|\343\306\tVsn\201v\327\347Wct\271\370r\346\370\t\2263\346\016J\337\211#X\366Uw\3428\277\242<Q\202W'\247$+9\275*\024`\226\035\035\212\276\337"
+	.string	"\206\317\032g\215\323\006\t?eX<r\260\330\353{\332\330P%C\306\311\0254\206\326}F\206p9g\374\344\262u=\210\244\365=_-\363?x\317\210l\201\365\275\017\037\376\317\027\347\213s\253.\311Y;c\234\316\232;hE\310\240i\375\334:ah`D\330\0215`\330\370!\351KD\364S\253\236\261A\243\243\322\242\305\251\002g\2402\275\273>?\262\260,0\372\336'\t\376O\254W\346\211\325SD9+g\030\340L\017\265jBC\357\206\225\325\251\002\347\234\235z\362\323\035[\230\031*.\250\364\275\017\n|V\235U\367\353"
+	.ascii	"[[\036n\023%g_}\257\2419u\256\230:U\234)\316\024\247\212\232"
+	.ascii	"\257\372\320\027X<o*\360\344\372\236*\270\024\001\362\244\357"
+	.ascii	"5l\301\327\300v*O\251SyF\235O\347\323\031\365\363w\003\350T&"
+	.ascii	"\307wB\375\214\322\031S\305#H\337\363\035\212\220))\216\364\275"
+	.ascii	"\006!\370\032\256\360\177\346\312<s\303@\257FPc\321\314\340\207"
+	.ascii	"\377\373\206y\337|\216\204\254\304\002\021\247\227\001K\2336"
+	.ascii	"\266\356'T\306!\026\226\363V\006:B\310\324\236\372>\303\2245"
+	.ascii	"k\252\230\272$[a@\221\345\303\317\215\231/<\372>\303\020\275"
+	.ascii	"\333\247w\375\322\374\372\355\355]\276 >\264\273>?\034\031O^"
+	.ascii	"bh~\371\200Q`l\\\364\275gn\213\377A|\204o\r\\\206\035\370\031"
+	.ascii	"`\340\377\312U\346\225\273f\202 H\331r\315\374w\356N\271ep\300"
+	.ascii	"\260\254\331\352\233\347\326\343\013I\337g\230\302DX\250T\231"
+	.ascii	"\001GEI\025\242+T\302,\024\227,U\232Y\216Pi\322\325\260)U\254"
+	.ascii	"\374m'\2303\2252\270\033\346~\271xw\314\365r\305\\2\367\356\202"
+	.ascii	"\251\314\333\345j\371\265\273[~\317n\227[\367\267\035\250e~\001"
+	.ascii	"8F\251C\314O\bg\013n*\314\206\373\0361\270\273\352\017j\201\025"
+	.ascii	"\374\036:\374\0369\374\2368\374\036(\370=l\370=k\370=j\370=K"
+	.ascii	"0jW\177\320\223\251>\350{\304\242D\211\353y\241\355\302\265\335"
+	.ascii	"77\267\373\366c\243J!3\303\274P~\337t\370\324\354\224p\375\017"
+	.ascii	"\242Y\254\332\254\351\373\036\034\370=/\360\177\2370\357\023"
+	.ascii	"KW\227d'\024\230*\254\370\345\274\225A\245\333\023\222\245\357"
+	.ascii	"{\242\226\327\311\362\256\2419\327e\227\325\325\371~\327\202"
+	.ascii	"B\210|Q\365EC\273M\260S\316N\313l\265an\313C'\201b3\273j\277"
+	.ascii	"MN.1F\334\372\336%7\355\177\020\030\203\017\n\222\264\313\244"
+	.ascii	"\206i\252\331\221\306\242\221\271\342\245\254\357\371\202\026"
+	.ascii	"\215\215&t}\317\303\006\237\007O\211\022! \340\371Xs\222$I\275"
+	.ascii	"\253K\262\325\004n\334\365\211\331\210*b\246\357yn\340\377\222"
+	.ascii	"1/Y\275\003\352r\322\003\021\207\206\275\214\365\270\352{\036"
+	.ascii	"($@\256Xc\325,u\005\201\252\262&\217\022\177\347M\221\013\344"
+	.ascii	"\032\351\2143\034\216Re\326,\203\277\203\005\277\216\325+\344"
+	.ascii	"\002\271C\252\333\315;\350\320r\006\337\201\202\277\243\004\377"
+	.ascii	"7H\220Z\306C\227RiA\\\246\222\301\315b\305F\243\357wx\340\037"
+	.string	"?\350\260v\224\370\277>\230\327\207m\263SY\371\005\202\024!M\374\337\035\027\307\345\321X\f :\273q\225\301u\312\340\353\340\341_\034\365\2021/X-\343!+\225\026HYfp\235:\374Z\313\2405j\334\257\354\244'\342\314\351\256\317/o]y\370\257\327\357\027\017\212\276+(7\252R\215E\363FW\004\234T9\363\227C5\206\313\032\033\225/\310\032i\201E\252\357u\316\360\357\213\253\365\013\3430.W\3159\347\255\0040!\323\314[[\036P#\314/]w\306/W\325\342\301we\374\017\346\244\271B\243\305\225qc\254@B\006F\243\320\341\243\032Bu\267\252\031\\F\313F\337\353\334\300\177}\377hV^\345\234\263\316e\276z\312A\377\372z\326\352\341\327\251\266\n\340\377\315\371\003\f\344\3744\327\225s\256hp\310\244\342q\005\bz|\222\310c\212DlB\032\032\213\"\030%\200,\022"
+	.string	"\350GCF\306\3421\211\204"
+	.string	"\t\211\311hT2\002\223\302\324\205\"\022eA\351x\224T2\002M\fS\244\233L\221Ii\022\212dj\200\322\261\311H\347GCJ\307&\243\bLP:6\031A\360\243\241t\003C\023B#\322\r\fM\350\374h\350C\207\242\024\251\304\320\350"
+	.string	"d\t\351\221)9LM\364\374h(iL\223\212\216C\245\022\037,\310iBZZ\032\221A\004\024\"\220,\032K\360\021\246I\305\244\221\351\370\201h\""
+	.ascii	"\311T\005$\206\037\r}P*\242?\032\"~ \232\340\320d\242\230T:\241"
+	.ascii	"\3108\342\304\020\351\323\264\244D\002(\371\243!\243\245\017"
+	.ascii	"F"
+	.string	"K>D#\023\216\321D\237H\241\321RNRh4Z:\215FK6u\241\210\274MKJ\304{L.\331\242\024X\224\"\231.\022\370\243\320hiH\247\351\230D\026\215\322\024\206\035\206I\2444\204\021MHKK\303\016\310\ri2EZJRB\226@$\016\201\220)\022\261\211D\252\002\2218\344\3204<\036Gt\020A\202\2444\211lRA\030A\nD\3420(\205d\212L\217\020 \177\202\214\206\307\364\304\b\243RqD2\035\201H\034R\200\344\22042)\221(J\223C$\246$&\"q(\301\371\243!#\246\022i\321\207\"\244\"S\211\264H\311\004#\246\022iQ\220H\034\366$\1774d\342\203Q))I\211(A\210\246F\n\213\206L\034(\226\330\001Q\242\211Jt\210\022M4\354\020\303&j\241C\264\320DM}L\223HE\021\210\304a\320\005\022\222L$L,E\200H\034\342"
+	.ascii	"\207;\310\242\264\210'\bb"
+	.string	"(y\034.\r%\211i\262'I\351\210\202\003\034\240\224LO\fU\020@jT\n!iL\223\322#\023r\230\232@\200\364D1I\034aT\"A$\216\350P\242\202\030*ay\210\206\222\212\307\025R$#\3430\203N\210\241\242\364\304\020)\344\3310\302X\302\005\031\206u\203\241\241\035ad$\346\224(\"\rI\020\211#\222\216J&\216\351\322\004B\243\b\311\024\231\246`\2644\301\211\305cjL\215\3609\350@\203\016<h\001x\017>"
+	.ascii	"\361\001\b\364\036|@D\364A\007D\370\035\020\331\244\020I\201"
+	.ascii	"4\251\230\304\033NL\022\211C\233\n\323\"%\023\216\351R\232\226"
+	.ascii	"\310I\376h\350DZ\244tl2\372`\264\004t*\035\233\2144\240-\244"
+	.ascii	"E\306\342\211dj@q\t\211\032\rW0\"\211(\222\251\001\304\020\305"
+	.ascii	"\021\304\020E\fI\241\321p\005\245\"\320h\270B1\331B\nD\n\211"
+	.ascii	"\304\341\231\374\321\020\001\216)\022R\321\004\232\344\021\002"
+	.ascii	"\1774\224$2\035\223\310\020Ha\013i\222))\303\006\210JHB!\232"
+	.ascii	"42)\021\205B\34015\262\240$\024\002\221\307\024\311d\024\nq\221"
+	.ascii	"\261\270\001\241\020E\032\213KH\241\020\210\224\n\205\301\244"
+	.ascii	"0\211,\"\365\374h\b\231.5%5(J\217\303#\244\006\037\220\311b\211"
+	.ascii	"\017LF#\rZ`2\026\2214\340\240\003a\007\036\264\360!-bB\"\032"
+	.ascii	"\213\037\216H\246\017\bH\266\220\032\221\206\306c\2324\026\205"
+	.ascii	"E\303\364x\224\\\022\n9\234H\217KB!\232D\026\221\204Bt\230\034"
+	.ascii	"\026\t\205h\352B\021)\024\242\033 *!]bz\024\216@\224,\032K0\212"
+	.ascii	"\220,\032\213\3501\211\002\321\310$B\3210M\201H\034\261\001)"
+	.ascii	"<\221\206@$\016\261Q\204\242azD\223HaqI\005\023i\b\351R\323\n"
+	.ascii	"\302\022PP\001'%\032\207I\244\261\210\223B\t\224p\215E\024\214"
+	.ascii	"H\"Z\\BZ\244\220D\210\022p"
+	.string	"H\204(!\210\022C\024\355\217\206\220L%\202\220B\023\212z\216i\0229LB\221\310\364XT4\004\246'\206H*0-%a&\341\211\264\b\311T\002#\205)\261x\"\r\001\311T\002'\025\246KM+ \231J\004\323\245\246$\222\251\004\020\311T\302\216@$$\022\207(\013\303\024H\2040\002M\376h\210i)I\250tl2JO\024\217E\005H\205)\200\020\001\242\003\246\245$\037\243R1\311\204\244\204L\217\030\220\302\r\251P\005\246\245$\0344\211\304\204LS0*\025\223\3044\231\206\300\264\224\244!\025\032\215\212HC\341\216\321\250\2104\202H\034\342\246\242a\232\30209,\n\036\207G\304\233\026)\2210*\025\221\305\023\3511\347DZd\223\302\020\033 \rO\034\323\244\261\004#c\021i)i\250\002\2218\364!\021\302\b\"q\210\246D\243\004\222\310a\032\201\344\210\24249,Z\242"
+	.string	"RJ$\216@\026\203\222\302\020\033$\215E`\322DZ$Lr\370\221"
+	.string	"\220L\302#b\262\210B\221q\004\022\222\322\321G\003RhT4aT\"qL\223i\222\022v\341Hhb\tIH$\0161$\205\036$\215E&`z\034\262Pt\034\"))5@x\036\221&\204GF\305#!\2218\314I\232H\213\202~44\301\225\226\322\343\207\244\222\322\361\003\016\013\303&\213\224"
+	.string	"\tI\351x\217\210\311\342\322\211L\231\220\206'P&!2\251x\\\001I,&\r\215M!$\217\214\212H&~\222\302\016\210\222\306\"\360DD$(\240\300\t#`\342\220Q\251\230\034\036S\244\224H\034~@\036\225\220\306\024\371\301X\034&} \036\221\037\206*`ax\264J\307\324\002D\342\020x\324\315\262\371\n\243\222yv\326\334Y\245i;\323\260}\241O\316\2756rk\3200\317<\035C\262\324\350\2132A\231\240Nj\276:\023\20769\352\304"
+	.string	"T;X\240j<Pb:\262P54\355\242\241%\341\021\3243dpA\351\373\b\324\360\217.9\3034\341\"5\206v\315"
+	.ascii	"\303\226\340\310Z\226\271j\334\320\035A\317P%8R\242\220\201\361"
+	.ascii	"\240P\361\002\254/\022$h\022\037NgMT\354h\2222\234\262'\313\032"
+	.ascii	"ed:z\210\r\271J\224\314\206\024.\350\230M3\203I_\335\334\213"
+	.ascii	"\270\262\272\276\217\240\310\220!\250\221z\265\367\341\211\006"
+	.ascii	"\f8\277\274\345\302\203\021\264\210\2342\016\017-\202\022\271"
+	.ascii	".\246H\0212\326'\006\256\357#\350\022rj\271id\324\270\t;\243"
+	.ascii	"\200j;\316l\004\361CRF\r\t\220+\030\232 \031\263\366\343T\301"
+	.ascii	"\214\261\343\253/\332\003\365q\364\205\243/4\372\202\375\373"
+	.ascii	"C\315\2728A/\272\003\335Q\315\204\334\365\211\255\301``\247\215"
+	.ascii	" Q\331\0269\374\2439j\031\030Ql\330P\034\367-LW\016\252\257\333"
+	.ascii	"\244Yf\314K\337e\022++\037]\350\215sk\017H\032Y\337e\222\234"
+	.ascii	"\227;\350\221\027P\304\3318\377\304\232)\310j\240P\327\316/\212"
+	.ascii	"\006\215\273\"\210\334\324\023\027\252ew\366\307c\306Z\003\366"
+	.ascii	"\250r\2402.\227\232?\032l\372\242[\350\326\tV\363\025\007eNA"
+	.ascii	"eRGUH\241Z\366KNv"
+	.string	"Z\222\255\200oW|l\371\345\251-\0178h+\320\266`\035\325:\372\"\204\210\347\211\035\371\242\354\213\272\370\316V]\224f\337\243Yh\213?\210\201H\2164$}\037\304\205\257\301\022-,\254\276\350U\027\311\243\322\353\213Z}n\013\214\237\016\224E\226\257\273\247\276\350\n\224\2522\177\005\255\372\222g'\n\n\346\225\276\017z\201_\177\005\375@\375\025\024\235:\232\342\017\006\243\324\310\341\325\367AU\370GQ\374A\340\223/3\302\372>h\n?\310\tuB\235P(\0205\243`\213\n\204\342\250\363A\223zH,\216A \2111\305\fC4D\323\214\001C\025@ HX\034\025\213\327\305>\023\200C\313MI\303<\217:\246\310\020\211$IRj\f,\255\320\320\345}mH\030XXrI\243i\203\b\267,\350_\023\003p\006O8\341\232\361e\332\246\370w\035\227$\"[\024\3452@AN\0238"
+	.ascii	"\001\224\337\214&\300&e\035\030=\332\006\365\3133\242\037E\250"
+	.ascii	"aH\343L\370\337\"\005\212\217\027\275\033\024l$\357U\0025x\310"
+	.ascii	"\221<\351\f\tAA\b(\364W\211P\241$\354\202]\003,\374q\336\375"
+	.ascii	"_\234O\004\204\347h\026t|\026\2141-_o\326|\237H\371\021QdA\307"
+	.ascii	"\341\227/\315\271\377/7\217\363\364\377t\211\207\267.\222\212"
+	.ascii	"\213%\265\314\0204!\371\324\207\300\231L:\311\377\342\262\022"
+	.ascii	"\355\002\266*W4\032\343F\003\b4\030N\241K\344(\353\n\204\rS\021"
+	.ascii	".U\210\250\025\004\377\242\022\210bP\b\337!\255\264:\342\tN\361"
+	.ascii	"\347\247|\2213\332\372\024Jp\266Df\360\267\332\266U\214\331\347"
+	.ascii	"\323\246\360S\035\376\344;l\366\377bo\222ug\\\005\216\314a\215"
+	.ascii	"\346\200\243z$`\330\341x\311\257A\034\212\332P2}\016k\205E\360"
+	.ascii	"\\@\310f\317\261\246\330oS\rPe\355\231\3144\020\232\373\nZi\347"
+	.ascii	"\204-\b\270\250\n\205\377\236\277\006\376\332\232\353F\313H%"
+	.ascii	"\332\017\225\330t\232\204c$\013C{\206j\260\241\207h\274\0012"
+	.ascii	"\003PT\206\332\231%$-M\230\242\024\3713\211\372_J9j\021K\262"
+	.string	"Z\257\242\262\245\356\035\363\367C\024\276\035\362\322\\\036Pf\330"
+	.string	"\316\344X\301\367c\212\342@R2\375\240\350\271\213\006@:Q\212,\346\223\316n\360\2776\231U\234_\334\f\r:\326^=ZY\037/y\330\216{\023\352\337V{'-\363JaS0<\300\224\022\035m\225\006|\0349\333\367;\370\003\212/Qi%\177\303@NnM(\224\241\247@\214#\320)\027']%\203\346\304\005\352\321\261d\236\016\225\030\320\335\340\031W+\177"
+	.string	";k\001\033(\207\003\210a\266\335=P\266\\\355\222\342\017\"\341\342\307]O\337$\361\203\225Z\314\204O\236\017\372T)\266\313\201\255\231\036\230)\274a\270\245->\204\f:\336B5\320\341\243j\357\350\3362\331.\024m\2004\002\2614\\\t)\266\"\021\007\177\201\251\r\354\214\255"
+	.string	"tN/~\241w]\241\375}\271?0\257v\020m\301\207T\354\2470\366an\202ob\213N\021Z\264h\001R\225\316\276 \351,\036"
+	.string	"+\251W\234p\210\001_\031\tB]\036BV\320\247f<|\222EcxZ\315\275\343\023\331\376/[DA\237\300m{\036\211\315%\355wsR*\340\303\326\203!\273\222\265\3530\246T\255\261\267\306\340\374c\276\013s36F\264n\004\253[\376\3617\206\025@kvY\244\017H\260\031)i\020\226\302\245u\327#\200\356c\330\221+&\307\233]\027V\0370\335!\344\362\221\252\201\301\371\330$X\016K\330T]\314\3264\3300S^9\265\266\334'C\233\260\273\216\355\336\270\0368\326\344\332\321\333\312\202\006\220\2216~\177\320\214\017\335\305\f\345\271\217\305\210&R\231>[k4+}aG\033\313&\200\345\217\006\230\005{\256\317\322i\177\227\335\261\273Z*t\002\033\200\037\270u\241&\215\275\027\245"
+	.string	"\252F\352}\360&\\\016*P|!\343\333P\245\271?w\336e\367\377$b\316\036\305\316\360\017|za\025\247[b\270\362\324z!\226\256"
+	.string	"\221(\231:\016S\372\232d\325=\310\330\2074\007\332W)\202"
+	.ascii	">B\231\301\004\372`\370#v\n\333q\236\232U\362-\3377\\\301\364"
+	.ascii	"V\205K\224Nw\013B\305\335\263:\006\222\003\351\312\201~<\202"
+	.ascii	"\241H\362Wc\f\320\t\b\203`\004\005e\215\236y\375\276e'\222(\313"
+	.ascii	"gwcv\242\022\351'v\037v\247\365R6<\254\356\365\237\222x\033\206"
+	.ascii	"\253\251*\257\320\217\353\343m\337\377g\307%X\307I\272\301\t"
+	.ascii	"N\013\201\304\bL\366\270\357\233\017K\270\374\321\235\006\247"
+	.ascii	"\222\362\305Y\310\367\352\266+\264\300\025,\026\321\245)\221"
+	.ascii	"\234\375\317\212$\230\203\003H\233Pi\340W\334[\350\247\273=\017"
+	.ascii	"s\027\177\215\217b\316\215f}?\017&\246^IAg\243C$\374\301BP\030"
+	.ascii	"br\270\261\005hd\217\364\021\005\021\373a\204\3363\307\210\340"
+	.ascii	"\341\210\223\227.\362\302\310\252\216\036#u\266"
+	.string	"\377H\301\340\211\223\225\005\321c\003\023)\346\333r\251\361\364\032\365\030\306\005\205\230Ri7a2\206\344hW\n\355TY\207v\251\202J!\r\f\300\241]!\362\t\226\304\245\370\201E3$k\240\037\243@t:I@=\317\300\033\3519\326k\032J\325\001)\343\023 8+`\327/\034'\035L\340\246\241\tk\240\032\266\037D2EM\271\307LUb\017@\240^\001\365\367a\241sLd\276\233\266\356\362\034\305\344\236\fV\217ZDZE\357\304\007\376\262\334\261`\t\020\375\344\335\222v\016\362\356\240\374:\316j0b\003\2008\201B\270\004\301GO\303\245W\244\324\3718\264\243\006d\271\215\024\261\222l\256\204K\303{\250\265v\376\244R\231\253\327pe\356\203\254\177\236m\272\2323\230(\361\251\210o\346rj\255\b\300\271c4\265|\260\374\335\351|2\370\006VA,A\tl\233\213\240\223z7a"
+	.string	"\267\221\207q\247\006\206\354>\264r\316\027\300\206\213LS6\351\267\034\313\202+\013[\377Y\246Q\273\372]\333\244P\370\277\271\212f\306@x\207P\n/\002\324\300-\342\271t;z\3766\r|?D\364ZYY\204\273K&a|\340Z\272\016\220\323\327\240An'\214\253\304\331\200\253]\272~\347&}b\375\244S~YT\370\230\305\022\202\235!\320\r\001\303\035\036\304B\324g\005A\366\373\034\356K\202"
+	.string	" \305\002\267\240\037\377e9IX/\222\320n\347\201$\005o\243\026V\253\223ka\333\237d\271\232\002\366\360\241j\375\b\343"
+	.string	"\267\231\205\311&C\226I\324\rA\243\207\305OFD\316t\271\217\020\305\374\330\220d\360s23u\322\003\217\276y?^\352\300\241\302\344\323\034\300<\222\202\277>M\251f\221T\222\221\005\3159\034\313-W\316A\274]\"\020r\362\206\342\253\303vA\334V\367b\272\212\335\374\303\221)H\026@C\343\024i\261\371\037\304b\255o\223\303\350>-\026\321Z}\267\321\\\336W\371\261\273%\373\210\3268\263\247\033fjX5\375q*\206nr\250Dnn\257\302m\023.\303\0211+?Q\264\216\262\237\274(\030\252\034\264e\304#\027\217~\251?Ot\230o\362\245r\327{d*+\313\325\323\n\242Z\007b\371)l\240\022\262w\210W%\305\303\312\272W\301n\032\030"
+	.string	"O\r\026\213\274 \304x\3334\013\276\223\035L/\230\270K\013\235~\222EK\307LGE\343D\356\351\357f\276zd#\311\361\230\253T\315\020E\247M:\321\321\363*\022\227\2747Y\267\235h7\333]\326\246qEeD\327\250\261\307S\\\2229\354\375G\221\255\370\3040x\314\030\301\335\224n\275K\376Kw\022\201n\215\tA\310\032\361\306\2746C\322f\366\"mZ6\243\236T\302d\022\321\250\240\332\037\3260L\371U\252\354\237\370p\342\316\020\354\2170\2120f\232x\307\302\267\177l\236<\361\022\242\257 D\246N\231\261(\366r\256\257H\007\376\177\215\245\r"
+	.string	"\300\367\311$|\211X\262\242x \363c\343\252\246\370\310XJ\274\033\2562\363\031$\223\"\350\"\225\270h\367\2400\f\277\216-\235\237\245\261qm%\001/t#\276(\035R\200R!-\251\"r\357O\321@\321}cH\316/:\205\251\\GD\230`\304y3\301T\254\365\214\260`\0068\004\365nm\303\317\004[\004DQ\026\333:kM\363 \204\005\3752fU@\311\360 X\225\225\0322b\360\242\021\274\377\234},\013\227\312e\007C\214\374\020-\n\233\022V"
+	.ascii	"\013#\2667\033`\350T\243\2228\315\0376M\026g\377GC\263\244\n"
+	.ascii	"Z\347\200\246\313\017I*T&L\226Y+!\037H\f\206\300_\231gk\350R"
+	.ascii	"2\366\377n,.\313\032r`Z\310B{\003\224\223Z\316\261\270U\005\276"
+	.ascii	"Wg\313d~\231\370k\316-\324yv~\307y\207|W\263\370\202\260\237"
+	.ascii	"\255\334\ru\3302k04\266\352\251\301\335\322v)\217\315\020\344"
+	.ascii	"%\356x\355\262?O\344\330\027\360W\211\341\223r\221w\f\312\370"
+	.ascii	"\363\374\031c\230\336\327\267\"\254\353Q=R\300\017\350>x\376"
+	.ascii	"}\370\226\343\026\223\373k6vd`\372\273j\377&\366\202s\247\372"
+	.ascii	"\275\215\303\004\362WS\270\005\357\377\027\340\021\253\371 \020"
+	.ascii	"\337\030\370\2248\276a\230\274\207\213\335\340A\230\303[o\030"
+	.ascii	"[=\"\177D\344=h\362\t\303%B"
+	.ascii	"\223\204{\320\272[\016\237[\274#\232\017\0050\224\310Q{\030\344"
+	.ascii	"\256\243\367\367\360t\377\347N/\254:\215\342\017\2029_^\354\320"
+	.ascii	"E> \247\023\233\345~\233\352\324\315\323\220V\026\273\355\374"
+	.ascii	"W\347\024cV\r\346\207\355\021\367i\326\255Z\036?\333\027%\227"
+	.ascii	"\307\241\036)g\013Nd?`\346A\r\373\001z\303\276\306\373S\2731"
+	.ascii	"\245\006\021\210o\276\257bN\340\333\211\272\274H\034\242\236"
+	.ascii	"3\376\222q\016\311\027\272]j\236\223\362\211@\256XF\325\036\""
+	.ascii	"\245\371\346\356\321\021Y3\350\342\374\023\334q\360+\r\306\345"
+	.ascii	"q\212xKD\355\023\\/\375\205\374\217\350\347{\374T\377k\336\206"
+	.ascii	"\3679\t\033\204\266\371\355t\331\025"
+	.text
+	.section	.gnu.lto_.symtab.f919a04ef468d614,"e",@progbits
+	.string	"pgResetFn_accelerometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"resetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"accResetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"accResetFlightDynamicsTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"accDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"accGetAccumulationAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"applyAccelerometerTrimsDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"accelerometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\002"
+	.string	""
+	.string	"accelerometerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\002"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f919a04ef468d614,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
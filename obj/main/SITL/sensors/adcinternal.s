@@ -0,0 +1,161 @@
+	.file	"adcinternal.c"
+	.section	.gnu.lto_.profile.404b97d6be62316,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.404b97d6be62316,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\356\346\366\357\t"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.404b97d6be62316,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	"\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.404b97d6be62316,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\001"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\334\034c\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.404b97d6be62316,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.404b97d6be62316,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.404b97d6be62316,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.404b97d6be62316,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getVrefMv.3.404b97d6be62316,"e",@progbits
+	.string	"(\265/\375 \332%\006"
+	.string	"B\313*1pM\322\001\240_\377'\206\203\277\360\312\220\355\202m\001\354\016\003\373\272\331\343\350\355\224\3350\003I\202\377\377\253r\330\207I\004\030\243\220lB\366N)\246$\205\311\301\252\342(T\302\244\021\276\350\252\250\2162-(\005\243J\006~\f\025\324\312{P\243\271g\232\201\221\313V\340\300\036\354yY\254\302\276\263Lc/\250D\204"
+	.string	"d7bs\262!\317\007\206m\213\035\371\032\337\260X\256y!\321:H <Lv\247\002\\\240\375Y\017h\177\230\305\345\227\364\317q'\203b\203\311\\\276 \204\335\365\302d&nv\333\007\266\325vC\b"
+	.ascii	"2\003\356\231\301\300\341\273\206O#Z\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.404b97d6be62316,"e",@progbits
+	.string	"(\265/\375 \036\361"
+	.string	""
+	.string	"\032"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177"
+	.string	"\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.404b97d6be62316,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.404b97d6be62316,"e",@progbits
+	.string	"(\265/\375`\342\001\275\022"
+	.string	"\226\245\204J\340\2608\0350\301\037p\303\345\023\031\344G\323>,\325\217QL\370c|\fX\3271\237Rq\256N^\270\221\t\211\322<\024\342\f\231\305<\231&.\002d\002E\fA\372\245\2421\210\242\336\004\322\302QA\373D\243\031jR\006h"
+	.string	"k"
+	.string	"n"
+	.ascii	"4\351O\303\262\360\227\214\227v\021M\033e^w\265~\004\277\277"
+	.ascii	"\371\217}\332\377\361?\307\371\272\177\b\221\205\231\346\357"
+	.ascii	"b\300\374k\344i\375\233\316\213\035\324\2561)\3103[a_\271c[W"
+	.ascii	"z\330{\324\263[\307\330]\377{F\007C?\310\330@+s\233\314<c\346"
+	.ascii	"f\346\025\314\274\325j\265\0323\17703\312\274\201\004*\372\313"
+	.ascii	"Z\276\312\334\373\252\376e\372\215\374=*z\251\242\335%c\330\233"
+	.ascii	"\236\336/"
+	.string	"y\276L\307\276zZ\035r\364\354\252\216\236\275*\372\362c\333Rv[\246\250Ws\325\323\256$*\262\253\212\302N\264`\001b\313\263\230/\362\024\321\354M\337\363\267N\353g\310\377J\317\036\262\245wX4\026V\n2\355\373\377\200\311\212I_\322l\3343\346\005&m\242\343\267\371\237 \300L\254\005\263\201\372v\254qF-\343\316\351\225C\344\275\036\333\314\r\0249\033H\324\005\270\255\tp,\241\343\036q\237Z\255G\034\227\340\013\262\337\204\301\216G\035ss'\317\377\036B\367'\253\203\353P\267\b\363\200\376t\b3\203\376a\217\373\261\206F7B\005\371\262\201\316*?\211\376\376\364\274\016k\f\302)\225P\374V\251\224\370\tXM \201+\324IC\307 \310\340\003\302\203\006\235i\004\003\nJ\fW\250\223\211\002\312\247\022S*T\250\372P'\224\f\237IT}#\037\033\034T\b\305\b\2530\005"
+	.string	"\233Nb\210\nS:.!) \235p\340\340\223\022I\211\204\343\223\022\b\226H`\307$\360\303\334$\332\206\373\006\247oz\326$g\271\200)\305h\254\200\260q\227\227H(}q\301\250\021\030"
+	.string	"\270\0208j\207\214\351\354\364u\313f\235\2011\024d)\215@IQ3\322"
+	.ascii	"E\005\201g!Z\343hkXj\r\247` \251i\214\320CE-\331\241\273\227"
+	.ascii	"\302\346\2466\256=W\314t\306['\031"
+	.text
+	.section	.gnu.lto_.symtab.404b97d6be62316,"e",@progbits
+	.string	"getVrefMv"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.404b97d6be62316,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
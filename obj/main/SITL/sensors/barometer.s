@@ -0,0 +1,839 @@
+	.file	"barometer.c"
+	.section	.gnu.lto_.profile.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\t"
+	.string	""
+	.string	""
+	.string	"\030"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375`\034\001\225\t"
+	.string	"4\f\020\002"
+	.string	"!"
+	.string	"\220\242\2374\024\002"
+	.string	"\002\001\002\002"
+	.string	"\001\367\255\350\337\016\n\002\003\002\003\002\004\002\004\002\003\002\005\352\263\360\321\b\003\004\240\342\234\212\n\005\205\320\323\240\004\016\003\002\006\006\007\b\t\361\216\360\342\002(\002\007\002\b\t\002\b\003\n\002\n\002"
+	.string	"\002\013\f\002\f\002\002\002\b\n\013\f\r\016\017\020\021\022\274\205\242\255\006"
+	.string	"\023\267\335\335\337\n"
+	.string	"\024\200\333\377\224\002\025\026\265\372\210\203\b\027\350\300\306\254\005\002\030\317\316\276\351\002\n\031\346\263\306\373\b\022\002\002\013\032\033\216\335\232\252\005\022\003\002\003\002\r\002\r\034\214\211\225\265\003\026\002\003\002\003\035\364\201\355\242\016\036\037\337\277\230\225\006 \240\342\234\212\n"
+	.ascii	"4 \220\202*\242\362-\002k.\357\370\260\001?\213\016\b\276\r`"
+	.ascii	"\312\201\204\225\270\367\031\324F\313\203p\013\310\244m\320\f"
+	.ascii	"C\022\270\321\031\211\230!\267\002.\027\035\323\016a|\262\267"
+	.ascii	"\213\260\350\204E\273`\204\301\210=\240\200\216\001\214\001\f"
+	.ascii	"\274\331(^;\031\373\034\263\261LDv\267\026#\202S\033\310\364"
+	.ascii	"G\255\274Z\200\025\326}-\f\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375 \177\345\002"
+	.string	"\204\003s"
+	.string	"\r"
+	.string	"\001\001\001\003"
+	.string	"\002\005\003"
+	.string	""
+	.string	"\001\003\001\001\002"
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	"\001\022"
+	.string	"\001\023\002"
+	.string	"\020"
+	.string	"\007\024"
+	.string	"\003\026\001\027"
+	.string	"\003\030\031"
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	"\034"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"C\b\300\005H\t\225\352\370\250\331!\230\356\252\021\241\344r"
+	.ascii	"qs\206\364\263\264\312\341\027;6\200\005"
+	.text
+	.section	.gnu.lto_.inline.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375`\263\001\375\n"
+	.string	"\206P=; \005)\215\001\200I1\323\240/\305PQ\021\2249\241/\220-r\340[D\001\306"
+	.string	"!\260W)"
+	.string	"\303H\311\220\020\030\201\004\024X\022@u\017\350\325\312\332\377\221-\215\020)w\n+"
+	.string	")"
+	.string	"."
+	.string	"'$\"7\007k\023h)ww9o\312\224\230\213f\324\245\367R}\204\206'\247\240\347\322dw\005\362\241Iww;\3379C\002\232=\3128m\221\201\306\356\242\240^\360\037\322@\331\333\247Z\227\261\335\215\270H\230\335\2058\340\355\323\206\374=\t\207\303N\003\030\353\332ej\304c!\275\360o_'{\373^^*\217\211|\355\324\025\223\202=\254\360\003\311%\314&\266\3429\245\267\273\242\023\020,\262\024w\032\240e\243C\342\22453-\024\322\f1\3063R\350\212\303+\201\307#\2472.*,\207A(\020"
+	.ascii	"\255U\246\375\237\204,\370\311\fX\301\371d/ \300\002!\251\343"
+	.ascii	"\001(\006\0304:\302\345\311\207_|3,\222{\007#1,\006\346\321n"
+	.ascii	"\217U\r\307\304\376\351\016\326ZB\214\236\235\203\311h\006G\362"
+	.ascii	" \363\004\303Z\003\004\362\334\301z9gR\364\021\225\3622\016\263"
+	.ascii	"\331\b8I\220\331\300v\250\021\\\240\031\005\211\272\254Yc\nL"
+	.ascii	"\271\016\354\270j\002\255\241=7"
+	.text
+	.section	.gnu.lto_.jmpfuncs.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"\035\006"
+	.string	"bJ\"+pI\223\016H\341\252\032\001a\342L\254ZU\0251\214\025T$K"
+	.string	"\001# \t\362\202\"\320Z\255\321\336ZLg\355\023\"e\n\023$=\245\247\220\035\250 \205\205D\304\364\b\255]@L\323CA\331}\350\177\336\021h>"
+	.string	"\352O\237,\3003\3219]\016M\027\213\216\0249\301r\206&(,|\260\372)\255\265\206|\343\343=\326\245dz\216\236\001\311\3058J\b)!\345\re\325d\025\177tu!{\213<\231T\026"
+	.ascii	"Vp\204\251\336\017\025\005.\036\004\243\302\036!\320\240bxCp"
+	.ascii	"r#\260\234i@\271Z\025DP\342\337\204gf$\030\005\022\333;s\033"
+	.ascii	"3EE\345\312\002\270\001"
+	.text
+	.section	.gnu.lto_.pureconst.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\232\004\001\230\004\005\230\004\t\230\004\022\200\004\023\200"
+	.ascii	"\004\024\204\004\026\230\004\027\204\004\030\230\004\031\230"
+	.ascii	"\004\033\232\004\034\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375`\035\001M\007"
+	.ascii	"B\313\036$\220\247\031\016\360\235\366?h\326\376\377\377\377"
+	.ascii	"\377\377K5\372Ep\251\221\210\020\261\360\3117W\330\204\204\354"
+	.ascii	"$S\272\341\350Z\272M\225\036\220\305\215\316#a\314B\217\240\036"
+	.ascii	"\030\250+x\002u\3213\032\332p6\273\345\271\254v\314na\267NB\037"
+	.ascii	"\001\317\2034 \213t\250SO\205\223Ny*;\347\351\274\"\020*\022"
+	.ascii	"K\251pN\346$\321\301\231Ht\256\333<\001\030\246\200\017\004/"
+	.ascii	" P\"b\322<\025\201`\271\366\2108\207\024u\373\303\233\033%\004"
+	.ascii	"\036&PSq}\207\271\204\355\034\017_wQ\364\013\261\036\370\246"
+	.ascii	"K\006^+\273\030x\324K\325\350b\201\324%0\rwx\001\n\024\254n\023"
+	.ascii	"\330\004\225o\263\020n\3625\274[\2643\2412\020\243\313\004z\270"
+	.ascii	"z\311\313\037\337\237%.y]p\344!\224\002\f\001"
+	.text
+	.section	.gnu.lto_.lto.baf2ae3b0d45e6f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_barometerConfig_Registry.14.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375 \232m\004"
+	.string	"\364\007a"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\202\200\200\374\342\303\274\377\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\304\007us\350\326\006uq"
+	.string	"\005\001\006'\001\016\246\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/sensors/barometer.c"
+	.string	"\004"
+	.ascii	")\"\301$\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_barometerConfig.15.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375`\203\001}\f"
+	.string	"\026\225PE"
+	.string	"ml:0\334\006"
+	.string	"71D\237/\001@8\310\006\013"
+	.string	"h@e\331U\034J\030\300\253@ i\320\241\360}\031\321\336|\235b\223'\375_C\230\020\024A\004\221\f\225\313\025\216\0326F.\255\321Fd\247\0249"
+	.string	"<"
+	.string	"A"
+	.string	"\252\021\261]\324\303\031\312=\243\277|\367(\317\370\356\331\264Il0\250@Q\202\245\273\013v\017n\276\232\376_\257\230P\243\327I\310\356\272\232P\r\356\356\266;l\203\330\025\023\023\022(\320XA\270\347\213\276{^\005[\252e#\325\234\215\216j\347\300\276dw\327\235\312\276\353\257\026\335\211\322\005\214\210\335S.\305\316\274\016\021,\266_\355\267.\301\274Kt\214\3354\334\271\371\207\332\215\303m\316=\320n\247\013<\3062\221j\270\335\371\206"
+	.string	"\247U\252\365\361\031B\225\232\205s\";p\f"
+	.string	"^\251$\304A\237]\036\006\022\360:/\017}6\202S\bQv\367\303\017\033\016\001\317(r\3410C\212\037\2613\222\232\001`I\216\245G,A\017G\323\001C\262\0043\034\036\r\210$\370\031G\022\264\240{\311v*\217\224\230\221\272\005\366\303\317\326\\\026\262p\251x\020\001\037"
+	.ascii	"\205YE&\236\037\215\006\027X@\035\200\035\370\016\251\315\301"
+	.ascii	"oN\310vR?\240]\020\306\023\376Hj0JQ\005au\\\031\nI\300a\320\016"
+	.ascii	"@GR\202G*\007\250\327\200\214m\006\363.\0014\253)\341\016/\332"
+	.ascii	"I\006"
+	.text
+	.section	.gnu.lto_baroPreInit.24.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375 \304M\005"
+	.string	"\222\t$-pU\323\001"
+	.string	"-\372?u\n\373\304\007\t<\307\357S\2708\210\2107\214\234\372\035\236\027\315\377\177\377r\312\3763\324\203\220[\273\267L\001\237\242\031\255H\311)1\230NI\253H\271rH\024O\223rd\270|\304\311\226\224\223!\256\027n\007\b\214\374\334\365 \345\337@\303\355\177\205L'\241\351\316\002"
+	.string	"\232#\330\\\376/\364\372{\226\263\364v\231\244\373t7\303\312\326}\365\273\230%`\332\265o\260\350\356?L\233\354\341\376G\374W\374o\004\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_baroDetect.25.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"\345\007"
+	.string	"b\21765`m\322\001\300\215\326`/\344e\325\266&\303J\204\272\027c\013Qk\215\020~\320n\217\305Bjm\355\020\017\233,\230a\2657\254\225@\315\376 \203v\333;\245\2216H\2068/\211\315\274\026.\021q\343\254\261f\364D\216\234\227\003\244S\322N\244\260\363pq\240fRha,!\342\204\036)'\264T\213gTs\037\273~\232\033\331\257\354\356\332\211\354\227\376\273\314t:1\030\331\005\245\240\254\351\225p\330\306l\213mW\037\202\2754\341\200]\r\223L\365WPi\315\276\307?\260\203P\374\262+\352 \331\255\007\266\252?\327\023P\177\325\007\250?\333\316 `\316^I\240\217H\027\"\247\335\n\335\306\263\267\314\027\bU\274\001$\354\256\033F(\343v\267\215\261\255`\273\024\f"
+	.ascii	"A3\240\314\200`\330\250\260\\\205\023\327\224\213\211\030\204"
+	.ascii	"\317\324(\270,ij\342\275\212\023"
+	.text
+	.section	.gnu.lto_isBaroCalibrationComplete.26.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375 \375\345\006"
+	.string	"r\21504`m\322\001@_\002\234\200M\312\251Y\025\254\273:\210\344`Oc\017\351\326\320\261\003\315\036\213\205\324\205E\024\021\033\306\247'\230;P\256>\232\020\"eJ\001\266P^\313\264\213{\225\005\006\237\203\230\006\031\206\241ra\226\007\031e\300\256\241=\226q\356\261I\334\353H\225\300\243\037\373\232\352\252z\020\351\363\215sh|\f;l\362\327)\177S\235\272\006Hx\262d\307N*\205\375iw\327:\262\235\326L\177\022\210\020Q\370\330\r\225J6\204\"e\330\346\330\023\037 pl=Z\204~\361"
+	.string	"\352 \331\215L+n=-\377\032\237F<@.Q\347\t\220\260\273\316K\004q\353m\027\3306\260=\021\b"
+	.ascii	"2\001O8c\216#D\250@\346\032\275\204\310\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_baroSetCalibrationCycles.27.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"u\b"
+	.string	"\346\320=7Po\322\001\240\363\351\246~+\321\241\213\023}t!L$\021\227\351m\306bk(\331\035Y\026q\3335\277\225X\324]\352\233\f\332\252\242\036\bg{\304\310&{\247\024,"
+	.string	"."
+	.string	"-"
+	.string	"/\270\036\315\331/\357:\366*\026\025(1\273+!\307\271?\316\177\311\005L'\322\037\300\302\356\372\231N\0307\274\355\004\333\r\266E\002\020e?\365?\213"
+	.string	"\304\305\001f\367b5\263\252\310\362a\373\032\333\357\331\0379\t\367\324\310qW\243ee\267S\360&\340q\340\006\327\343\013\264JM\267\267\026\242\314\tQ\225 \205\037\364M~2\362=<!z7=\372\242\3531\242Rd2Joew\244\0077\354[\273\273\016\017\263j\022\021\223\263MO&b"
+	.string	"Q-\204\325\216\346\301\262\003g\233:C\363C+\326\221[\245\033hn\022\244a\037\231\325Mn\020L!f\225!\032\007"
+	.ascii	"2\241}/pq\241\304ehb5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_applyBarometerMedianFilter.29.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375`#\002\355\022"
+	.string	"f\243\177I\300RN:R\370\306J\"\270\263k\031,OP\310\"\344\b*\376\223\214@\330*3\221\213i\351\nX\255\177<\333}E\004\306T\200\373\21078\n\2618}\n\"\033.7b\311?\020\007\217\370\004`k\033\331[\356\224\002j"
+	.string	"d"
+	.string	"m"
+	.ascii	"\265\206\320\341TkEqJ\353\324\266o\364\243\032\323\346\030ds"
+	.ascii	"e\270\351\250\360Qk\205\221|\244;\235\037\320\235\356\210\323"
+	.ascii	"\336\321\271\222\346\333\274[i\272\022m>\247\323$\007\243\307"
+	.ascii	"\313\2263Gx\210D\fr\366|\247\311-\252\347e\253\315\221\032\""
+	.ascii	"\252\256t\271c\303\221\222\245Rk\265\024m\032n\326mG\260\275"
+	.ascii	"b\313\007\001rG\316\r\347KOa(\177\310\025\374$/\236\372~\352"
+	.ascii	"N\277T\270\242\033R\207\033ye\2176rq\366g]\240\327\223~W"
+	.string	"\313\322\363\343\275\235\264\244\322\0279\020t\373\021\372\2608\306\312s\005\244J\321\030%>~\312\225RN\273\306Wr\210\355\321P$\265\261\332\0220\3118:9\365\002\371$\232\001\004AV9'\2728\377\306\206 {\362\020!\022:/dkww\354\260\223\313\262\224\243&\255\354$w{h\354\272`\331\230q\302\265\266/\274\005\255\300T\255U\201\317\364&\231?tj\013\337\327\235\316pU7\244\237\271\270\207\235\277\342,\302\231\230\230\356\224U\024e\202\307\211\304\233\324.\316(o-\001\234\321\022UMZ\031\301\277\255\r4\236\313\214\2017\001F\026s C\343\315D \314^\\b^\003\017\244\020\206\036\2702\343\315\004\270%\005\364d<\331\007\306X`!\370\2053/\204\315^b2X\013\030\302R\f\370\203\361@\230\314\367\201\260\220\261~\201|\017>\323\265Wz\211H_;\347Z\345fq\272"
+	.string	"\362(\016\365\225L\325zs\361\311/\022\344\305\327\036\004\207\334\217\\mm\002% P\242!\350\366\221\003\316\234"
+	.ascii	"wW\354e+\324\352z\213\352\013i\343\024\r/`\002\370\013\237V "
+	.ascii	"`H\222\017\341.\031b\370\006\211\342@\006\034!\237L:\264\216"
+	.ascii	"qs\340.\024\2767\\C\201c\271\022\334\3407{\020(\t\007\025+\263"
+	.ascii	"\342\315Q^#\342\313\036cJ\321\241"
+	.text
+	.section	.gnu.lto_recalculateBarometerTotal.30.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375`\251\0025\025"
+	.string	"\266\247\214J\300\322Q:B\250\321&L\035\325\273\346\366\246\013\314\310\035\324\030Pi\037\370\036I\027.\330-a\361*\020\346\370\323]_\260\243\202\331\261\216\261\215d\241\230\323\020A\025\241\240\366Q5\t2H`_>[\275\355\023B\344N)v"
+	.string	"l"
+	.string	"y"
+	.ascii	"aQ\016\006R\255U\305,\364\247.\fPy>=\t\226\332\006\016\330\234"
+	.ascii	"\250\202\267\326\037\020\244ZO\025\257\260.\332\366O\034\205"
+	.ascii	"\215u\341\031\302\007 HF\016P\252\326S6\340'\343\305\360\261"
+	.ascii	"\361\342\202\270\356\341R\235\177\340\303\241\243\035=\337\356"
+	.ascii	"\341\3167$\360\323\261C\342\343\205'<|\202\034x\252\343\303\241"
+	.ascii	"t\245\240\326j\332\363i\270\305\333n`\333f\323\246B\276Y\211"
+	.ascii	"\276w\321\267\322x\361+\341\003\324/\005\317\r\255\262\317\035"
+	.ascii	"] \373a\335\037\333\344\347\035\373\371\227\274\350\207\235\350"
+	.ascii	"\177\271"
+	.string	"nt\267V\324\254\245^\255\250\307\245\026\227:\\\352]j\272\324Gy\207S\352\211\245\252V\fUT\225IL\032q\243\217T\244k\333\370@\217\3306r\220\265\313\300Z\021\204\303\251\326\232r\321\023\002\033[\272$\356\270\247\360\0329VP\334V\322\r\215p[=\242L\360\354\332\266\360\0319\024\037\265V\004\376\321\221f\276\320E\323\320h\343E1\330\033\362\242\260\265_`\350{\273\364\251\307\303\224\023ow\341\002=f\364]\374EL\255,\307\213b\t\250!\250\213\350\375\230v\201\354Z\272-*~\360(\021\277\226\256\031#*\247H\201\177]K\205\\\370\341\234\305[8\350\0075\244\213\215\001\256\206\264\301^l0.3\362\201\203\034i+\221\231\341\312\b\244Is\273\221\346\314\013g\243)\027\22023\265\031\004\230i+&\211#k\2459k\221\335\314\362f#o2\033\314\254&\243\2317\331\212"
+	.ascii	"\2273\244)\303\225\245)\0339\353\367\307o\342PdS>\022\264\224"
+	.ascii	"sD]\333Z\035\333&K\262!\212\351fq\334\332\034+\036\325\024\017"
+	.ascii	"kckBb\265,\231\337\310\261l\254\246\222Jv\f1 \240\"\031C;TF\222"
+	.ascii	",]A+(mk\315C\026\b\021\242\263\262\354\345\f\343\333\023\007"
+	.ascii	"\n\365\r_\214\305\t\204\272F\007(Ky\331\262|\270Bj1\315\231c"
+	.ascii	"r\316\326j\223\302\020\034\237\355\205\271\335\001\371G\225e"
+	.ascii	"7\353\221\340*>\306\250-\237\306\002n\246\216\225\007\210\325"
+	.ascii	"\032\302\205\201\307\233\215\351\235\f\024\3055c\323\350\024"
+	.ascii	"\r\356\001"
+	.text
+	.section	.gnu.lto_isBaroReady.31.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375 \352}\006"
+	.string	"BL-3Pm\222\016$!#\202d\231\230\246$\003"
+	.string	"\3042\336\\e\316\220\354\252\375\273\035vm\204R\007\357\31513C\344t\221\312}\201\231:4\246Y\262e\ng.o\342L\032\3670\013\215z\216\332LT\3330`4-\363\250v\031\3305L\257q\234{\315re\331\b\031\001\210=|=\372Q]\215\035:X\253\322\355"
+	.string	"TB&P\001\302\224\277>\310,\276\225d\243\037Gf0Q\022\224\314P\312I\216H!\033\277\347-#$x\256za\204\232!\001\001b\222y5v\321\252X\335v\264\302!Rb\211>\305"
+	.string	"\205\314\034-\021Eg\375\013\376\203?\"\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_baroUpdate.32.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375`\033\002\275\020"
+	.string	"\266\335kG\340\262(\035R\215\005\020\b\tU\350\356\345:\024\216\231\273\232\001p\302|\243V\367`2\037\026\310\205\213\334\376\277\361\020\f\023\317*\241\376\372\212\216\245\f1z\236\213\303f\217\013\375\003\260^T\277\211\343\223\275\245L)U"
+	.string	"O"
+	.string	"`"
+	.string	"z\373\305\036\3719/\361\342U\224\305B\216G\006f&4\247\254;\360\021\3562\236"
+	.string	"w\271#\276\272\214\253+?@\310\272\004\211y\274\316\243\220\214\027`\030\363\215#\267\0206F\341+.\200\321\370\020\022\272TE(sN+\030v\270\271\333\206`\233\201\255\036\002>:n vi\216\201\373>\250\361R\036\366M\\\346\3715\316\320\242\007/\375\026\356\362{\235k\255\007G\246\245C\266\314\245Kc?\3169\247W\204m5\311j\021\247\226R\035\243z\243ZW\375\020\022\330-\2056\347\206\241\036\323&\177Hh\\M\336"
+	.string	"\t\345h\241b\362\203J\340\263\024N\353A\211\004\261\330\2255 \234\001\372\235\363\250\224\004\315\331:\270\002\205 \246B\327\016f^\313\262]z\nS\001\373t\024(\221\2409g\203\023\237\255\3705\227\266\220Jq\227\272\262F\333\261\323\322\241\033 \261\311a\316\251@\200\213\034\033K}h6\235|'\227S\312\373J\025:\325\347\251XN\252\216e\245\224\352L\237\252;1\261w\341\364u.\236\367u#Y\3531J"
+	.ascii	"8nl\226\264\242\325`[\264Fi\255K\222\250\035A\202\036\224\273"
+	.ascii	"\313\232\231q\033\020f\213\216K\332\303\374\230p\031)%\261\030"
+	.ascii	"(\0031\030\242Y\355\367\002- \260\202\231)\242\007\277\002\342"
+	.ascii	"a$\022\316>\341\276o\205m\253\343\025\\gX]\271\305\362\240G\221"
+	.ascii	"\320\355\306\341\275vH\036zpypM\031\356i\334\235u;M\332\226\266"
+	.ascii	"\335^\262\320\213:\220\266KC\257S'\313\225p\343\212\027p\n\\"
+	.ascii	"\305\032\037F`\bLs\004\030\331\330\225S{\360\230\321\264\007"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_baroCalculateAltitude.33.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375`Q\004%\034"
+	.string	"\3064\265I\260\326M:6\327@\210\037(\035\031\rS\342\220\306w\025\211\310^G\232\214\355\026;\347_\376!\007\320x\214Y6\fwl\"\234\237\337\205\372\225\3259(\234<pE]\213\370\2253\360\207tP\031\r\013b\367&R\312\024\230"
+	.string	"\222"
+	.string	"\243"
+	.string	"\223\037N~\207|n\376\022\320\0012\321P\244V\246 \227\3325\203\274\330\337\356\277\337\033\213\365\217\027\261W\357&*\343\316_\304?\356\334\177\304\327\352\343\376H\361\310\204\230\243\005\022`\255\365\300\316\337\304\235_\032[c\304\311\360*\312G[p-ee\251\265\342lK\243;\303\275\241;{\305\222;\303f\362\273V\033\376X\022\354\371\216v6m\b\343k\332\016\r"
+	.string	"\201\\\231\371\222B\032\223\213\336Z-\227\360\361\230e\fj\255\347\236\357\304\236\356\177\013\377\025\374\241\214;\271w\311\327ou\354\216 \241\016\035\350\316m\004MaU\033\265\005\370\243\033j\210\376\364Zm\r\026\026&V\232|%\361\226\177ql\326\320W\352\036\210x{;\277Dt\347O/\326r\325S\224\223\r\024H\034\374\257x\334P\377\206\265\237\376\363\201D\376\217\317\376\366\266\311\357\221\361y(\277F\371;\224\257C\3719\224O\243|\034\312\277\241|\233\311\257\021\3714\224?3\371\263\311\227\221\361c(\177\244|\030\312\177\241|\221\362e\315\247\315\237\001_#\313\365"
+	.ascii	"B\204\bt\347\254G(\261\252\237L\333\332\247\267\234\342\rY\""
+	.ascii	"\244\204\t\023\350N\231\236a\\(b\332\326"
+	.string	"<\245\306c\377\024*\320\355\305\264-i\351)\306ml\036+\251^\372[[ke\230\016\275\312\251\034\376\326b\201I\251\340\"\366o\341\002o\357\245mJ}\364o-\024\017\244Z\277 \030\354J\252\025i\200\254\305\016\305J*\332\262\246Z%p\3666\355\232V9#\354y\333\356\260\003h\225N<\016\236\273{\227\272\034\303je\020kMJ\360\355\261>4|\245v~C.G\003!\210\2146\030}h\240\333\345\034\214\017\272\355\204\214\204\210t\273\034\007\\\321NW\004B\250\b\007b(G\204\013\332\025\341n\002\256\013!\264\303\031\351t;\334x\205\264a\355'\240\266!5\357RH\361\013\250\247\022\026-\277y`\241<\231^W\262\204q\021%&\030\341{\332\t9\213\322d{Ux\272\247Y\254\306\263\3238]\353\316*\235t\232\326;\035 G\247\005\214\225S<0\233\316\351\002Z>Mk"
+	.string	"^<\022)\272\300n\032\307\246g\372\246\267\244\252i\233\246JJ M\327\2206V\ti\225\204\246W\b\213Y\317t\217\225\300\006{\204\024k\255\t\002N\250A(\345\020r\210\031\223I\0234\255\264\030\220\002\031A\3329\021@\265s\220LAn\007\322\245/ir*\206\275\004\234??\263\232\020\276\316#\237S\032Ha\027\254vZ\"\324BU\227u\020\004\326\311\264\227\225\n\330\204"
+	.ascii	"H6\310\216-v\327\330\320\230\241\320\373\375\236\223\017\037"
+	.ascii	"\331%\343\313x0\022{\345oDD\2070\320d\006Y\267*c\300\261O\310"
+	.ascii	"\313i\fP\202\215\247\236\321\030P'\205`\261^V\256\223\013\"\032"
+	.ascii	"N.\2119E*%\3529\202s\372\3362\264\214\231\301\257\242\fE\274"
+	.ascii	"\223A(0\3636\254q\254?"
+	.text
+	.section	.gnu.lto_baroStrokeBoundary.34.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375`\001\004\275\034"
+	.string	"fv\276J\240\330M:\007\247\245\260pYS\016\330\233\210\202l,\317-\245\275\221\266\255\002\021>\301\b\2719\243\320Z\272\366\3732:\234*c\363/\345\201\361\270\356\331\023\362\302;\261Z\301\0260\345\366z|\220Fj\215\020B\210\224I\006\253"
+	.string	"\232"
+	.string	"\257"
+	.ascii	"\272`m\342\220U\005\364\252\265*\370\270\030\314\2179\342m\310"
+	.ascii	"\346\335\367\270\017\242\007\207^S\353\317\n\021\b\301\337\220"
+	.ascii	"\037\315\333\220\037\227\371\300\333\200sQ\001*\2515\270`u\314"
+	.ascii	"\217\273\273\f\034\020\355\355\301\032H\267\021\306\023z\325"
+	.ascii	"\032"
+	.string	"\2345\215\337n\226\344(6\337\366E7\037du\001\275\310HRz)\036\370\305\360\"\323\343\2119L\256xG\275\025L\036\247\364\261\273\b\243L\t\322sqQ\246\267;{:n1\201\257I\213\263\227\023o\240\314\270r\341\231EO\307\\J\250\265.\033\365\222\276\261\357.\213\335\375\260+\322\004\037o\372Ug\036\277\032>(%\034\247\\\204\013\224\245n\246\275\2216}\341k\244d\024qE\251\242\343/\273\301\0347\323\356;M\323t\373\267\373\340O\340S_\034\222\367\346\300\337fyk\230\227F\306;#\343\225a\336\030\031/L\214\3674ye&o\314\3445M\336\322\344%\231w4y\305\222\267I^6\360#[^Zv\322Z\221\322\257z5\032\271\361\251\177\367{\252W\355\236+\364\037\013\341i\311\007\254\265\236B\273\347\307\357\022\355\205{\356\243.E\364)\0259\001\265r\254E.;\247"
+	.string	"\274V\217\302\322\264\364U\366.\210\020|#\263sVt\321\256\325\231\202\340j\255\033!M\257t\265\342\020\340t\331w\312\312\262\303\221\343\264I\222\241\327\213|I\251c\270\243\213l\261q\232\207\273%9Nwl\222{\354R\213\027\326-\366w[J\272-<a\371\240V\013W\204T\036%\271GH9A\302\335\340\311\007C\351OrPC\362\235\004\026\26656\323\360GP\021>\261\027\302\035]\337!\367V'\262\303\323\323C~,\273Lyu-}E\345\020Q\362\006"
+	.string	"\327\205|\b\272o\332\022>|\243\217{\0372hM\310fCk\033\200x\320\037\230\037\n(\t\241 \237 \024\023l4\350\tZ-\250\003\212\202fB\305\271=:54\b\375\241\325xF\314l5\232\r\b\265\315\200|x~f=5\333L\347\300\322R\240\265Y\020\215V\233\235A\334\305\332\277%\265|TV\345\177#/|\005\255#*\253\361@^\323G\273[\323+\001\3279\321\244\351=\326\205\fL\245\326\372&\0063\3322\32342\r\3233\375\235SL\313\364yaX\227\222A\303\320\020\3711\246cJg\303t\0010^\230"
+	.string	"\226\365n\007\017\344\215\316\316\321\361~O:\262\356\341\016\207\331k\365\032H\250Q$\346\fSJ1\211\231\031MZ,\006p\242\241\303z\020pH\343\214\001\252\320ny\033\n\257\351Q\350\352\334g\221\027s\335]\034m(1\213\2766`\r\266\013\326\005a\310S.\r-2P\272)\332\234\262\340\306`\2079"
+	.ascii	"\236\247\346g\376\230\342\261\266IF\303\227\247\245:\331l2m\372"
+	.ascii	"\346\274\t\360\017\360\027\005\314\242\300\3003+EE\210\344\276"
+	.ascii	"\345\240\373HBKg\262'I\034\025\202#\355\340\237\367\311\177\262"
+	.ascii	"\022!\362\242v1\247Q\362\242'\332\313\233*\210\325"
+	.text
+	.section	.gnu.lto_performBaroCalibrationCycle.35.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375`\030\003\345\025"
+	.string	"f\247\210H\300\020)\035c*O\206\373\020\007 \305\273}z=\254+\333:\300\234\030:d\001\r\220\254\223\253\350\265\251~\277\3373So\333\374\233\315\236\"\033\331Q\024\255\177EG\264\004\b\217y\025\332;\370\233Y\333'\233$)Sn"
+	.string	"i"
+	.string	"u"
+	.ascii	"n}\315\332\365j\327b\270\226_\207\273\376\256w\327jRR\365\364"
+	.ascii	"@iN\013#\325t\222G\037t\325\326\227i\354(\035\34205E\007\233"
+	.ascii	"\340\2159g\355\033\224Fe\370\245\261j\220\266|\277\032\2258\032"
+	.ascii	"\256P\346\234\256\037\216>\034\240\263t\001\366\343\205\263'"
+	.ascii	"\r24H\227\302o\267\273B\231sz}\277\033\265\250\266\017\330&`"
+	.ascii	"\277Bn\261\331D\225\362'PB:\022J\344\300\345\345E|\371(\375\354"
+	.ascii	"\365\377\203=\235\335\216\216\240F\022\365{\355\001\355t\204"
+	.ascii	"\n\301Xy|\223Y\365\251\264\312\210*\365\257\027IS9\272\035\355"
+	.ascii	"\241\335\036hk8\277c\177M\"\256G\304\365l\327\262]\307v-\"\327"
+	.ascii	"!r\r\"\327\037r\r\223k\217]w"
+	.string	"\354\372\365\265\353\0339z=\037\267\221\3169\027\344a\260\007B\2666R\242(\036\fT\260\333\t\026\254\372>n2\3415\266\221\002Q\350\346\364\3118:\361\346\324\t\3608\354\332\353\351\270\307C\244\036\215\327;.\336\300\030{@\257\237P\237\224\353/\222\267\356\272\376\255?\310zx\222K\246\036\320\352,\232\212_\275\204I^\274\332T\231\201\0265`\315\311+`5\241\301\025+\217\312n\241\341l36\230\033n\205\245\226\303\335r1\266\\-\306e\005\246\326\202\313\325h\001|\203`\303\325fn7\\\3555\244\323\357X\301\350\244\373N\306\356b&\306\f\237\324\310\231\306QS\304\331GZ\314.}\232~rv\205\215\247\f\341\201\232\"Z\223T)\305\200\212J\021\223\210\032\352\301\247\343\364\003e\217\235\245\004\024oq\260\220 {\353(\366U\321\322T\216\210\n\004!\027i\322\355h\263\023\202\026r"
+	.string	"\001H\250q<\306\024Q\312Q\345\024)\303\001\220\002\021\272\252\016\020hHD\031\016c\334\2222\214\203LC\224\236+f\326dbj&\r\317\262\355>K\271L\271\314%m\275\334#B\344[\00574\"\255T\231yN&\346\245\004\212\303:\340\271v\372S\217\213=\304\244\214#\227\242\336\034\321\036b\211\232\376\245\343?\325n\354W\r\272\275\310\361\361\016\346\3261\204\t\353\231\\\037\003\377\214\272\203\025C%"
+	.ascii	"\244>|bY\363~\3106G\367W\332 \324\302\275\037\201j"
+	.text
+	.section	.gnu.lto_baroUpdate.part.0.48.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375`z\005E\036"
+	.string	"\266\363\263I\260\326M:t\350\257\200\b\216(\235\0305"
+	.string	"\211;Lp@\205\263\0257\246\272\\c(v7\321J\330\250\316\030O:C@\206)\3446\317\363\207\311\006\222/ f\300\340%.\025\007dq\241\373\360j\326\022B6\221R\246\231"
+	.string	"\227"
+	.string	"\245"
+	.string	"<\371{"
+	.ascii	"\200\203/\265\262\b\373R\227\246\222' A/\021\326^\351KzPUF\005"
+	.ascii	"\253\256d\360c\245L\274\204\200\322\227t\301\250*\352%\271\377"
+	.ascii	"\336\304\226\247Q\272\n\326Zg\373\005\006\375\263_\350\237\355"
+	.ascii	"\354\021\324\342\377\227\307F\t\235\206\245\217'\026\351\035"
+	.ascii	"M\005k-m;q\026\200\2703\334\232\270\263\233\226\356\f\233E\372"
+	.ascii	"\035\3329\346\204A+\255\035OiC\336\361^l\317\360t!N\255u\201"
+	.ascii	"\313H\274\"f\332\212cN\255\365$\214\375\270\3779\374\337\371"
+	.ascii	"\247T\006\230\334\022Pq\206]\242\344v\263\225\204\301j\274\345"
+	.ascii	"\"\321P`\253V\242\335\035\271!\360\031\351GX\322\365\320\377"
+	.ascii	"\r[\244C\200\277g\211\334n\266j\255\020\204\354\020\334\367\306"
+	.ascii	"\316\177\360\341\335\355\374\372\364\244j\362\363A\304aA\376"
+	.ascii	"\007\375B?\027\351\253-\352R]\260s\201\273)\230<\2012\304`\270"
+	.ascii	"\231\336\342\206\265k\374$\277F\362i2\276\215\214_#\343\323\220"
+	.ascii	"\374\031\222/3\362cH\376L\306\227\221\374\330\310'c\374\221\344"
+	.ascii	"\213#\177\216\374P\344\367\344\007\037\265\226:\211\262\336\031"
+	.ascii	"RX:\366\362op\301\250\023\305A\237\236\304\235\262\236)a\375"
+	.ascii	"z\261\356\322Yv]\n8l\261\311\376i\016\n\305\273\2135\216Q\017"
+	.ascii	"}l\262\033\314Q\230S\035\313\205\376\310Zu\020\276[\266\213\362"
+	.ascii	"\240=(\220\002\305\235c\257\021\033>\270V\013\225\240\243#\356"
+	.ascii	"\024{\374\272\002\233\375OX,W\254\314\2161]\375za\377\024Vk\347"
+	.ascii	"\246\312\356\272\246\354|o\334\302\370e\005\326\033 %J\205-7"
+	.ascii	"\213\207\334\253\305\332\261\300\303#\356|\237\270\260O08\251"
+	.ascii	"\352\236TV\277&\032\002\007qk\220\303\221\300\205\370\311\365"
+	.ascii	"x\260\001\345~\200D\340\200l\"|zB\330n9 [\003\003\377\031\201"
+	.ascii	"\313\331H\374\374\344l\263\377\274a\355\032_\340\322BZ\327\032"
+	.ascii	"\351\177\255\237C\324E\323\246i\2752\330\005u*\340\343\244\033"
+	.ascii	"\001\037\363lz\234\252BC<\253\340\025\224\006\023mj\022wN(*A"
+	.ascii	"\257\232FZ\232\256a\0244\035\233\242\362\353\315\264\221L\317"
+	.ascii	"z\246\327(F\021\207=\246ez\217\302\260.\246c=.&\232u\fj\nX/l"
+	.ascii	"\246\260\231RV\320\213\212_\250\r\235\330W\326\016\257^\256\265"
+	.ascii	"\016u3\005v\250\201<\310\0243\024\220\214\202$I\n\303\001\240"
+	.ascii	"\"\231\272\342\006\021p\261chj\246\311>\273\0012Duv\201\315\330"
+	.ascii	"\020\3109\332\253\227\303\213\002\237gs\377\007\334\257N?\211"
+	.ascii	",\320\235\322HLM+JG\312\003\017\026;\201^\324\334\326\001\t\224"
+	.ascii	"\333\356q\315\356=3u\342GNR;$\r(\246\326\253#(\207Fo\205\360"
+	.ascii	"{f\201\221\201\277Ms#\f\367\311\256\211F\263\005\301\374\277"
+	.ascii	"T\323ad\245\214a3N\264h\3169\233<\246\223\211^\033\004\256\303"
+	.ascii	"n#Y@\024HGv\3328\352\305YVK\230\270\333Pr\326\321f\205\250'7"
+	.ascii	"}\013\316\247Rd\240\261u\330v\206\017\372\211\003Q\246\363\373"
+	.ascii	"\277's\017P`\026\240\325\2220x\344a\323\247x3.@l\272\237\226"
+	.ascii	"\241\221\244\333\210\3055q\365z\203\270GA P\f\266p\316\241\257"
+	.ascii	"{T"
+	.text
+	.section	.gnu.lto_.symbol_nodes.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375`\364\001\265\013"
+	.string	"d\020\360\002"
+	.string	""
+	.string	""
+	.string	"\002\017\177#\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\035\177$\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005'%\200\204\001"
+	.string	""
+	.string	"\003\005(&)\021\002\036\177'%(\034)&*0\177+\204\202\202\200 \n\024\201"
+	.string	"\005\021\026\022\027\005\025,\013-\201"
+	.string	"\005\027.\026/\200\003\005$0\002\030\1771\272\200\031\1772\032\1773\005\0204\002\033\1775\037\1776 \1777\002!\1778\005\0239\"\177:\377\377\377\377\003#\177;\005\024<\005-=\016>\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\f?\001*\177@\037"
+	.string	""
+	.string	"\200\200\200\001,\177A+\177B\003\001!\320\360\372\250\001\001\304\006\003\005\001\342\001\003\t\005\007\004\t\365\001\265u\003\030\t\340\236\212\256\001\001\202\007\004\030\241\341\365\321\002\365\001\003\031#\344\006\003\031\"\304\007\017\003\033#\217\201\202\355"
+	.string	"\001\204\n\003\033\"\344\n\003\034\244\n"
+	.string	"5 "
+	.string	"\003!Z\347\345f\302\250\333\315\036\017|<\244\035\332\260\b\"\270\037\303\220\265\357Au=|"
+	.ascii	"!\220\226\026H\302$\354\370\003\211#\243\361\362\340\207\221"
+	.ascii	"\036D\234\265ll\232\240\207\276A\341\223\3560Lg\277\340\3168"
+	.ascii	"\357\2005\017i\b\302(Il\307?\017\003O\322FK\227\243\303\035~"
+	.ascii	"\2078p\200\034\202\003\347\214\371F{\2611"
+	.text
+	.section	.gnu.lto_.refs.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"e\006"
+	.string	"\366\022.\031"
+	.string	"\211\252:\374\377\377\377\237"
+	.string	"\3745\002\350\346\343\331y\352m\347\367\307\226)$"
+	.string	"&"
+	.string	"'"
+	.string	"\371F\342'\277H\034\363\303\260C}\251O\365\007z\245\272\221j\244\363\340\252\370\204\035\235~\212^\274\350{\020\371\215\322\021\2553\355\017\256\023\220\177\356\227\326\003\\W\332\273\325\027\373d=\222=\223?\262+\344S\202'\004G\001\037\327\361-\2406\310/\310N\220}a\017\220\357\230?\354\213\365\341\370\310WJOYeC\272\351B\t\275\357\245'\002\217\004\310p\240\270It\304\353\314\373\303\353\205\304\023\232\177L_M7\330\237f\004\362c\236\265\276\\W\356Q{\2435\005"
+	.ascii	"\306\022\"\232\032\3749\b\032\244\260\004X\325\023"
+	.text
+	.section	.gnu.lto_.decls.baf2ae3b0d45e6f,"e",@progbits
+	.string	"(\265/\375`\343(u\270"
+	.string	"\212\"\335?Y LAI\351\271\376\303\326%{_\316\"\203'\177\271\263\317\"\262l\356(\236\210#v\261C\030$\323\313M\332UK\325\370]\231\360\373\351\333o\275\366\307\313\315\362\017?\363\300\374oU\b4\317\025\033\035"
+	.string	""
+	.string	"\240\224?\224sy\030\262\327\251^\25623\372\332\352\336[\246]\003\372\003\376\003\\_g\346\352]\241\364C\n\b\220\244W\245\177\301\311\331\203\007& E\352\375\230\252\374_c#\203S\217\271\252D\352\267+lr\365B+RM\3769\347N\222L\"i!k^\341\004I-\352}\235\241\353h\256\260=\251\027'?\351\204\336gD@\325\364QoPo0S\246\276\320\"I\243\336w\2316\322s\265\031"
+	.string	"\0343:\245\031\365\366\230\226\241\241Gk2o\271v\362\032\3453\207\265\217(H\037\365\336\352\304*\360\372h;\234\336\260\353\247\320;n\303\216\t\365\314;\326,M\211.L\224W$mJ\254\336\216\326\206k0\357h\177\301Qv\364\346\234\354\306@\247\033\003\0324!I$\273\373\372\003\377\355\005\204\362\311\222\256z\377\216\241\337p\024\333\231Y\275n=\226\t\006\353J\275\257P\370\375\005f%\n\005\r\006'O\246\\\351.\275\326XZKs\351\266fk+\235\245\241\275\245\247\274\251t\225\327g\316\312\234\363\333\354\214\312\221\264>\201\024\016`(\033[\322e:6\347\034U\234F\324\272\254\327\240B\340j\353\256\336\322JZ\254\327z4\240K-\232\363\363\036\374B\377\b\017zKK\3512\017H9\347\300\001"
+	.string	"$:\030[r9?\177~~z~n\214\340 \323\004\300}O\301\2176\207\235N+\301\357.\374\016\202\243\334\031Uv\f\251\367M\205\3374\360{\005\356Q\201?\244\300>\315a\327L\232\254\241\027t\223\217\360\340\026\t\226\273rf\330\232\301L\275\377"
+	.string	"~_\260\353\272\276`w\023\260\b\006\340F\322a\r\005\321I\336\317>r\232\3443?s~\356T g\224 \251\367$\360\377\027\036"
+	.string	"\251\354\301u\360\033\304\316\326\3255\210\335+\346i\016\273j\266\326\034\274\376.\322]\027\330\345\213f\026\313\371\251a\3479c\211\252\336?\233\303\016\367\206\016X\325\250\nh\340\337 \370\033\205\236\0068p\201\277C\370+\b\"~K\001)T\336\341\267B\256*\007uDC\261\340\267>\252\210\277\211j\020\320_3\330\240&\240\2068\007\376\233\340!\203\337\336\370{G\375\371\333\003\033\370\233&\003\025\001\325g\367\267\360=\277\235\200\214VQA\200\360\340\257\033\016"
+	.ascii	"w\224\363W8\024N\363\333\246j\200\377\007\330\3756\351\353\376"
+	.ascii	"\326\004V\004\377\263\374\217\362_\355\377\226\377\\\376c\371"
+	.ascii	"\317\366\177\355\177\333\177+\277r\236\337\322\374\365\346\257"
+	.ascii	"6\177\305\177\335\375\265\346\2579\225\247\305\374\265\376\325"
+	.ascii	"V\r\376\357\374\367\202\277\026\340\257\003\370k\005\177\345"
+	.ascii	"\371\253\316\337T\376\226\362w\332\337P\376.\373\233\354\357"
+	.ascii	"\252\277\307\376\026\373;\354o\260\277\277\376\326\372\273\205"
+	.ascii	"\277\257\376\266\372;\310\337?\376\346\361\267\324\337:\376\306"
+	.ascii	"\361\267\215\277\237\376n\372;\205\277\231\376^\3617\006\376"
+	.ascii	"\336\360w\t\376\327\375\237\373\217\302\177\267\377I\376N\372"
+	.ascii	";\3717\362\357\3747\212\277M\360\367\211\277I\360\367\321\177"
+	.ascii	"\271\377p\377\233\374]\201\277\207\177\007\3776\372\273\350\357"
+	.ascii	"\020\374\315\373\373\377\313\374\007\363\337\304\377\030\376"
+	.ascii	"\277\375\357\372_\342\377\224\377;uuuu?M\b?/\204\377\002\016"
+	.ascii	"\0046P/d\311\b\203\277\363\202}\252\231\232-q8\304\330\302T\271"
+	.ascii	":\327e:+1#\300\242G43\231!\276#\303\257qU\314\353\230\217\251"
+	.ascii	"d\032*#\303`\020c-\216K.C1}\376*\303+\231\236\333)\3224\026\327"
+	.ascii	"s\273.Y+\254\250\367;'\374\327\177\227\223\314\234\263\023\315"
+	.ascii	"33\221pvM\323\355\363\347\264\355\f\262\225\3003#\331\250\304"
+	.ascii	"`\254\262\344\215\177\310\377Z\316J)d\003\244\232\224R4\226a"
+	.ascii	"R\031\251\034\202\324\300\314R\310eX\316\032\262R\211\034\241"
+	.ascii	"\2315,\303rSN\302\322\324\371)\205\314\312f\326\220\2259\371"
+	.ascii	"a\251\224jZ\206%\2334,\303\244\232r\230T\346\311\312$\223\205"
+	.ascii	"235\3440)09\254\331\304\263\fk6-\303\244nt\227%\234\230&+TS^"
+	.ascii	"}\266Tf\246\245\250$\223gm\371l\346\266\234[L)33\3109\252\311"
+	.ascii	"lK\322h3\2445&$&\311fwXB\232jf\345\3322\253\231s\026R\212\274"
+	.ascii	"\324\001\362\271\226}\364\032\222**\277P\312\331\202\245\234"
+	.ascii	"\221\235\327r\316\310\2343\217\031\365\314\331\006\317\322\271"
+	.ascii	"\264\2243T\317R\216B\236)\345\\\305\334\314\232\226aSM\2413h"
+	.ascii	"\2303\257x\"\333\231\333\244\2308\fy$\277\210\303\316\246\030"
+	.ascii	"a\240\200\211\322 \201\201+Yo\024\256\267\334\f\201\nc\365\305"
+	.ascii	"'gn\013\222\226\227\247\311m\231J\212\241K\020*\317\254zY\264"
+	.ascii	"\230s\032y\321s:59K\311\275U\267\332V\2714\264v\251l\257Z\352"
+	.ascii	"\026\027]\352R\317q\301Ek\227\312\254Y\220\013\370\002#\272S"
+	.ascii	"\346t\373\262\2714\317\023\320\220a,W\211\016*%\222\252VsT3\017"
+	.ascii	"H\313\353\344\313\305Y=\201\230&_6ZL\207&\347\246\222\265J\245"
+	.ascii	"N\251R*\f\325J\255R\2574\264\252\325\344+S\205\361\236\256\252"
+	.ascii	"Vo\210E\235\310\232d0\201\252OTc\316:C\255\322\250O6]\234nav"
+	.ascii	"\352\202\364\350\242\340\246\325(hl\314\027d\250\3674J\234\206"
+	.ascii	"\226\223d\212\215$\224W4\034\031\224\350\306\352\255O\254\225"
+	.ascii	"3UI'9F\234\\\322\234\314Y1Y\215)SV\337\274h@\277`&\225\254\241"
+	.ascii	"\265I\255z\215\2528\336\363lR\233uG\023\257K\264I\345Q\307z\r"
+	.ascii	"\212'+\277\234\211\376\37444m\2060\273[\244&\211\301\251\244"
+	.ascii	"\212\325%\r\255c\257c\265G\275\322Aj\310\271\212\3169VY\250["
+	.ascii	":\312gv\332\301\345\374\323\341\347\347\346\305\016\034H|_\250"
+	.ascii	"\320\206\326$5\354\253\"\3515\250gv\322Y\322\304\362$\227\244"
+	.ascii	"vU#\036\220\226$@y\213\342'?\240\370\300\202\004,\207E\031\026"
+	.ascii	"\227g=b#\003j\rJ\032\376\237g\272J\232Bv/\325\353_.\020*3\274"
+	.ascii	"\304\360\357\021\374\353\205\353V\305\252.\364\232\330\bj_\242"
+	.ascii	"9g\255\312\325\320\272U\211\374>s\026sR\267\252\017\030\340\242"
+	.ascii	"=?:VXE\274v\367\367\n_\"\312$Uj\0135+\347\344|\301\201\226U\357"
+	.ascii	"/\017\374\333\304\277Q\325\252:\033Z\257\352\220\327\032U\307"
+	.ascii	"{\23693\341\340\027\272\252?\252\020\017H\313\022r\224\251W\325"
+	.ascii	"G\227\351 \237\031\306\215\225\023\313S\317\317\017\217\312\311"
+	.ascii	"\327\217\335\275\005#\344Al\215%\031\335\223&\n\024\233\020 "
+	.ascii	"\265\352\306\255E\376\342\206o\261\340[)\370\326\f\337\206U\252"
+	.ascii	"\235$RF\264\352\275\345\302u\205*\325\320:\365\013\326\314a9"
+	.ascii	"?slrF\2252\237\335\216\317\356\226\005\334\331\002\301\335#\205"
+	.ascii	"ok`\036&\276e\201?\330\214k\f%\026\274\2322\302\340\3277,\202"
+	.ascii	"\013\276O1+\370\265\f\377\t\206o\326\033\226+\002H0\032|]\275"
+	.ascii	"\251\311\345\f\345"
+	.string	"\263{\213>\225\2711~\237\""
+	.ascii	"\025\202\314\241\302\377e^f\277\365\360\344<5g\306\253\253\033"
+	.ascii	"#\007\003\277\267\332\252\335F\033j\325.\223]B\345\030!\312\242"
+	.ascii	"B\354$\261\321\305\325{\227\236\225I\034\230\234$~w\305\3311"
+	.ascii	"o5d\260b\272\334\344l\031\027\254T\037VL\027\247\322}q]\\\026"
+	.ascii	"w\305m\321\320\273\264fn\301\3300wi\311\264E\357\322\322]e\023"
+	.ascii	"\270\250M\013\2515\034:7\356^\214xA\272I\r\275J\261\253\264g"
+	.ascii	"n\362\206\354\n\227.\271\016?9a\330\332n\354\356\177\223\027"
+	.ascii	"\251\303\344\311#\256\336\233yP4\246$a\231\241\241\266\016\217"
+	.ascii	"\321:3\363\233(?\246\254\340\343H\301\307ab\347\260\226(\016"
+	.ascii	"5(>\016\030>\216\027>\216\326\030+&\f\0061jVLY\226*/\220\262"
+	.ascii	"p}6\207\235Oo\330\331\030\354\027\013\367\327\354p\231U-\t\202"
+	.ascii	"o\275\230\360\303\312\222z\257u\273}\233b\345\\\342\201o\333"
+	.ascii	"l\227\277F\247m\210\222#\365\036G\007\276\345\262\244NL\215z"
+	.ascii	"\355\026\254\204\323\004\302\006G\023\0357\352\275\335\362\333"
+	.ascii	"5{\305j\371\300\b\352\316\220\251\327f\261l"
+	.string	"\267Z,\226l\265t\320\3149i\265\354\320\345\234\334\351\306\240\033\203\3135e5\266\273\307y\201\337\326\034v9b\204n\255\334\250\245E\277\342\246\330(\226J\317\t\2419\255\340\337(\301\267Q\332J\221r\226o\\\300B]miiV\253\003\032\223\327\005E\214\312\306\331\231\205\202\277n\304r\026)On\241\330\026WYn\324k\235t\024\307\007\224\0313nV\224\331\262\250\215\030&L,Yu\362\240@\244D/V\017%\022\262]\222\221\036[jcc\026\214\004\016W\317\2418\262.N\240P+\206s\207&\2638.9\234\255\263\032Nl\222[\261*?\260\302Z\354~aAUm\205\205}9m\202\034\371\021\013F\0022\347\246\034\307\245u\034R\344\nX\315\025\326\324\013'..\373U\001Z\266UiG\316\254\221\333\257\216\352d\r9\353\252\327\026\261^4P\246)\250\365\262]6gLZ"
+	.ascii	"\203E\313\333\322R)\312\310\026\\\275\267YA\204\210\325\3529"
+	.ascii	"\213F\371\344`9{`\321\242\301\2225d\314\f\276e\241m\226\345a"
+	.ascii	"[\260\313\030\036`5\307\340\327x\301o\273\334]\331\253J\267\243"
+	.ascii	"\2053\n\276\025\322\326\nj\255Z\314''\223\032\2349\277\360\273"
+	.ascii	"\305\202\274\2416H\277\331e\316M \340\230\0320i\225\365\300\267"
+	.ascii	"=\332\376\260?*\235\006g\314\232J\267\243\262<\250l\325.\347"
+	.ascii	"~6a0w\354\260U\235\231`\020\200\225{\353L\235\2131\267U\326\215"
+	.ascii	"\310\232U\275\257Y\302\307f\360oW\2607\254T\315\r`\261\314\331"
+	.ascii	"I\350F\306n\3708\212\016\250\325\321\321\236\214\004#\024\243"
+	.ascii	"\031\307%\207\311\242\354\r\213\343h\030\311\304c,\244D1\027"
+	.ascii	">\336ag\330\031\326\206\001j\330\032\2676*\335u\201\t\215H\275"
+	.ascii	"\026\252\313l\316\302\256\310\250\327\322\250t5-\254\r\t\273"
+	.ascii	"\3006\206\234}\352\350\007\031\3158.\255\314|\2068o\016\237\247"
+	.ascii	"\005?D[f\225\263MG\273Y,'\2350\220\301\314!\316c\202\317\273"
+	.ascii	"\262,\316\3022\341\234s\2279\241|\360\023"
+	.string	"\261'7\273t\313T\221S\210\254\331\027>^\210!\351\305\255\21388\267\354\266se\b\f\031\266EO\311\251\253!f\203\006\266+\252\225\025UxJ6\351\226\271bz\315a\253\264HY\272`\3302V\357\213\313\223\225Sg\234!\272\266hhm\321s$\344\244\323\207\257g\034\227\334\353\2317\264\236\251u$<3r\267\024eB\205\250y\212C\306P\357\f\001D@\024Aa\t\237\260\b\005\215\nB\342p\350\353\245 \034\332\024\025\371~E#\360D\3201H\264\201\n\307 \260h\203\016H\364H|\240BP:t,\372\005\201A\304\3421((\005!1\205Q\030\344\241\360\245E\327X\f\n\1774(\214A \261h\227\302\3503\n\n\n\215\214\204?\0138\b\301\017x\024\001\005GCa\211\n\214O\001D4\f\"\032n\370\005\2177A\024\225HS\354\341\030{A\242!M\220hh\323\021"
+	.string	"\213\367h(\374]\242qh\207\322 \021\260\310\307\033J\213\307\373K\213\274\023{DC\240\034\242/\305\357\036\021\215E Qj\201\r\"\200\206R\025\276\"\007#\242\020\0051\035\n\340\210\350\023a(x\024\022!\220\016\035\215@c\221\0038\334\024\323\242\337\22115!\002Q\360\207\223\032\205%\202B\240\321G<\001,\362\225(\002;\030\177\2511\035\301\b\f\226\220\022O\240!\001T\344\031\035Mp0\006\217\302\022&\002`\224\032\213G&zFG\023;6\"\200\214D\337\020(5\372\206\206\027\350\200\002\n<\250\240\310g\024\242\220\022;h\030\001t4\344K-`\264\241\207\003 \025\322\241`\t\306`J$\036\177\026\364\202\0170\246\305\324\002D\303\016i/5\372\214&z&p\214\027"
+	.string	"\377\005}\300\241t\002\"\034\025\r\207>\013\376\003\022\323`J\204\337\001\211\rH|\240\002\357\037\200 \002\004\021\273\177"
+	.string	"\202\220\020\b$\204\360I\bY!\240\242\tbj,\002>\240\247\330\333\031\237\002\b\001%*H\215\276\242\343\257\310\367\2531\026{\300\241\t\024\351\b\275\022N0q\223\376\202>c1\b\304\306\036\005J\270A\340\t\301\342o\007\034\026m\261WbD\t7%F\224P\263\373\215"
+	.string	"\332\247"
+	.string	"*\036S\025@\342P\207bo\002<\304\324X\364\031\355x\251\n_\221\211\343\320\b\037{\270\330\033\241x<q\223\366\322\341\021\n\305\343\211\032\236\212t\250x<\2613\036\361\221\257(\035\352\r\217\330h$\372\214EL4\236\360\013\036\0370\244\300\360\3303\246D;\025\351\2205\0269@H\364\211\300K\211G\243\217\230\016\215R\024R\342\361\204bOE:B\215\2617\202\003c\020\310+\022\nE\350\321\030\237\202"
+	.ascii	"\027\016Sb\220Q($\006\335\374\202G\305^\032\002!\321X,\366\210"
+	.ascii	"\200(\202\302\022\032\322\341\221\261"
+	.string	"x<\261c\354\021\371P\020\002y\301\342\257\007\034\026q\322\037PE:\264S,\246\304\241!_\3577\002\310\223\022})\f\021})r\214\275\017x\306\340Q\370\353\245EC#_Q\003\212aQ/-\002\205\301\236\216\261GB\310\030\004\036\361\205\204J|\270\200\t\020\300? bjL\215\202\212Da1\230\026\203\202@\237Q\320\217X\f\002\032@Q\252\242\207\342\327\023\022}'n\214X\033+\254!\211xu\201%\243\030\251\327\255\246\t\016,g\275\367\022\271\\5H\033\347\033\214\250\\\206z\362\271\\wkIR\206\245\273u\265j\234\256,q\361\325\334AF\b\276Y\326\0047\253^\027n\013\277Y\337\341\265i-\223\273\373\262\313\302\021g\316\231\007\307M\f\231\030\217\347\363\306,\207\222\247gV\022\255-V9\240rM\234\206\334)\254\244V]\275\317.\034\0300\2004\203\320a%_\326\\"
+	.ascii	"\261U;,r|1\363\243\326\205\320BN\314\207]b 4\312\200\365\250"
+	.ascii	"d\356\214 <X\340q\237h\330\316\310\310R\325b;\032If\226\324\035"
+	.ascii	"\226i*\214W\220z\233\315;\325`\031\206\207'g$d-\251\223\372\235"
+	.string	"z\331\nm5x\324{Wx\331\233\034i\003r\235\250\031\277Q3n\216\036\323\317\f\325D\2061\200\016)pZry\031\345CT\245\203\n\216\337\034Tvu/\230I\225u\013M\266\306\352\2756~o\3745<.Z\246\200\261\341\013\365[\343F\214\267,+4zPQ\013#\005?\307\t\276\323u\272O=\315\203g\250b\3318\311\322\234BhHFd$I\222\306\362\t\020\204ca\240h\252=\022\300$MN2\307\314\214\210$)I%\355\033\252\023\200P\203\315\347\357d?\271\034\023\003\302a\034\225\177\310\211,\365DKt\226?\f\2353"
+	.string	"\306e\303@\325\262L9\001\02393\235\\> 3\020\365\".\224Pc.$\371\276.\253e\266\006\020\306w;\001*\360a\320\344KJ4Xp\2374\266\021\200\225\3367~T\2745\b{\021\356\304\206Q\314kQC*\\\300\353?Y\251\306\313\332,\371I"
+	.ascii	"\237\273\002\"\222\333\034+5\356q4K\212\3530\255\234C\222\200"
+	.ascii	"\233[\332\t\270<!M\3549\035\266\234\334\346\247\313\225\3202"
+	.ascii	"Ml=\333\032\206\372\2068\020\306\274\004\177_5\213\203\004\f"
+	.ascii	"@\177\243\245\223\360A\220X\331\2214\335f.\217@3\224\303:\021"
+	.ascii	"\236'\255nu\2322\315@\007!\213\246\351\226v\223o\240\034\036"
+	.ascii	"\375c\263\315\354F9]\347$\241\027,\261\345\231\026\\\214\246"
+	.ascii	"v\033T7\325\2214\271:\214D\300K~'h\343\033EcWjD\370v\220\377"
+	.ascii	"\006\370\234X}\200\254\331\257\035 I\b\206n\007\341\001y\310"
+	.ascii	"\377\202ZJ\223\311\037ZL(R\225}y\300\342\255*aK\026@H\344\252"
+	.ascii	"[)y\344\265D\331\270Yc{\266_\230\345\237lA\226\314\310\277k\020"
+	.ascii	"\344\bM\252]\300\335\n\336U\321\321m\265\007@\272\177\334nO\353"
+	.ascii	"\"X@\352'\263\205O{\277\257D\377X\364OT\231\004x\005\240\304"
+	.ascii	"mO\276\272t\027\306\322&\004\213\nx\331\240G\017\357\217b\375"
+	.ascii	"0\335\216\335\225\273\020r\263\017\366\237\313\355I\251\031N"
+	.ascii	"\210\373\250d\333Q\027\266\264\242\030\270\354C\026Aa\230h\004"
+	.ascii	"\"\311\362\r\200\024\347\201P\002\fH=F"
+	.string	"\200\320\334\031\315\337f\325\354\030\031s\254\264\221\f\244\330\204/\255\237x\364nQnj\251\333\307-\275}n\373\320\365s\345\371\366&j\303)1\027\326\331\005\246\245\271\020\305A\216\331I\tt)^\277^\322\200>R\307\206\365\371\001\326OF*\030\260\374\353\372%\361\027b\004%\021\006&\"E\2372\333lj\355`\363\235\332\344s\263\2618\375\"\027\215\325@k\224\330\b\220f\032\022\355\233\362T\355w\233\024\b\207\026\250\237\030\213\242\366M?\006\354\3064*\230\254Z\223\003\223_\252\213\210\361\215\374\r0p\005\r\030\347\270\240{-\267\342TOr\354|jy\313#\233\364\2438\327\252\313\0063\002\301\233}3g\267\243O\004%\266\234\353\340\274,!r\374\276E\266\252\243,O\301\323>\360\247\013\340\350\016\024\211t\265\244o{\002\323'n\004@\352IDQx\224\035\361\232@\030\350\344Hw"
+	.ascii	"\261\250\027&\264\217\013\251\303\250f\356U/\320\205\025\231"
+	.ascii	"~\367\214\303I\341\335f\234Wk\242]\226|\005T\326\\[\263\312\311"
+	.ascii	"\314\205M\316\034JG\206&\202\205D\302m\335\205s}\346\271\226"
+	.ascii	"\354\303}\257l\207\254\206\236\017\364F6D\227T\3618\206\030\f"
+	.ascii	"\233x\255\206_\r~\301\226\260B\221\020\334\240.\350Qew\324\302"
+	.ascii	"\275Z\211\2202^\021\345\244\323\343\207z\202\244-\236\31760\300"
+	.ascii	"I+1\363\224\340\353\345\301\273r\307Y\361\033\007M\205\341\350"
+	.ascii	"\260\232d\022W\3019\025+7$\351\005\032!\004U\004\236[\354\020"
+	.ascii	"\305\241\203\bF>\221\n\026\226\b\310\032\031\214\034M\322\266"
+	.ascii	"\013O\325\200\013\313)P\305\243@9\261\311C\022\242\177\271"
+	.string	"<\370_qef\004\341\253m\337\"\220\251\033C=\013\0015\227\346S(\345\254\364$aH\375\325r[[\b/'+\350r\321w\362\353{b\200L\223'\304(c\312\344eF\370\006TW\242\323\\\004*\306>\232S\214#\244\"\203\026\205\325)\361dA\311\266{\016\251-EA\341&\2655\316\225\302\311\023\nG\207\be\210s\362\330K\323\356\303\215\245,\261\356\363\0015\032\250\377\361u@\216\200B\274{2\233\223#\247\377\337\353\200\236\305\376\277q\034F\354\001\t\262{ \233\257\247\376S<\205\207\361\216\320\340TJ\216\2336\025\313\321\202\034I\306\273\275\257\332^\322}\007\033\335\273\037D\316\016P\201NA\311\250\026\342\022\350M\320\373\204[Ut\027\333\200+\360\267\301\356\033\334vm\264L\022\227\361T@?\310<\266n\214d\032C6\203\213TcW\002\365Q\314\214M\030\2543-\\_"
+	.string	"Uf\013C\202\016,\320\211\232\330\326z\022&O\373\304e\337rX\3376\371\272\211\027\376`\200\276c\033A\240I\364O\275\231\334\224P\261\324`\364\342\306\034\251\035\314\022!_\212\263\355*\214\365\260\242\013#\fs5\221_C8\257n\355 \345\301\344\301%3\262\325b\207;\340S\021\27213\301X<b\266/~V\351\336\324.\250\233\260\201aH\2067\326\373\315\207\360\341Jq\376\006\025\330L\027\f\023\344\245\311S \033\363T\352\255\265\004Z\300\026\350^\221\3357\345\367\264\234z\253\344\253\t)\215C\300%"
+	.string	")`\260:\264U\375\303\372O\210Z]\214\250\372h,\232\276\"\236L<\n\346\206s"
+	.string	"\306EX\265\272J\357\315\375\233o\" \253\021\264\013\234#\005fl\311"
+	.string	"{\366|#\362\331fI\334_\370A\355bw\277=\223\347\235$\2635\274\241\333v\017\220UT\3578\355@\307\004\220\372\031fP\302\347\255\3561\343\350\272\242\261\b\377\002\372\322%mQ\254\2127\002k\235v(\037\001!1\227\225\341K\260\212\033\265N\016\342\326\376\2033"
+	.ascii	"\301\312r\200\022\222\034\357\226\370\022\245\256A+\273\230\242"
+	.ascii	"\177EP\234G\026\r\322\343\2414A2\207\no\002\007\201\254Q\236"
+	.ascii	"\204\336\336\242-\223\314\263F\303O\313\037\374\213t\217N\233"
+	.ascii	"\3349DD&\376\236\312\0251?\"\030(\\\n>$\3315\275\037i\237\275"
+	.ascii	"\335\376\253Y\036\300\355o\234\261\007\236f\257n\314_\t\017\310"
+	.ascii	"zq\216\264&\311\2246(#\257\307S^\306WZ\2473\270\001\3507\310"
+	.ascii	"G\216wF<\346=e\030\350:~au~~\324\267\210\262\330\202\270\212"
+	.ascii	"\366\303<\362\254\b\326\003\264K&\017b\352\017\342\312\361\217"
+	.ascii	"\316\240\342I\323;\336\334\260\276\2059\267\317\301\307\377\257"
+	.ascii	"\350\235\213?\271Yf\266\b\006X\260:\337\354\036\225_\302\223"
+	.ascii	"\341\355\315\352\367\003\342\355\033\243O\225\356\223\237\277"
+	.ascii	"\274\350g3\371\240\263\352\270\307\270#h\230\224\343f\342\230"
+	.ascii	"\020\373\002xP\373\317a\277\2742q\316\327\267\225\313\020\346"
+	.ascii	"\301\367\345|_\272\221?;\335a\334\257s'\200W\346\201\232\264"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.symtab.baf2ae3b0d45e6f,"e",@progbits
+	.string	"pgResetFn_barometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"baroPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"isBaroReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"baroStrokeBoundary"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"barometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"barometerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"pow_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.baf2ae3b0d45e6f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1511 @@
+	.file	"battery.c"
+	.section	.gnu.lto_.profile.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\r\002\255\016"
+	.string	"\364\023\001\003"
+	.string	"-"
+	.string	"\377\370\240\334\r\034\002"
+	.string	"\002"
+	.string	"\002\001\002\002\002\001\002\001\002\003\002\004\001"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\003\004\005\006\254\372\361\363\002\024\005\002\006\007\002\006\002\003\003\002\006\007\b\246\300\251\343\t\002\t\n\361\312\235\227\007\b\b\002\t\f\366\263\241\227\004"
+	.string	"\r\016\306\374\305\326\003\002\001\002\004\017\020\310\311\351\016\004\002\n\002\004\022\235\361\320\201\tD\004"
+	.string	"\002"
+	.string	"\007\002\006\004\b\002\t\023\025\313\322\375\213\007"
+	.string	"\026\354\206\342\366\006\027\030\031\234\236\237\233\f\004\002\013\002\f\032\361\220\342\261\005\033\351\205\216\224\016\026\003\r\002\004\034\353\251\303\225\006\b\007\r\002\004\035\352\263\360\321\b\036\365\237\256\307\n\002\037\373\310\241\374\006\f\016\002\017 \336\253\202\201\b\016\002\005"
+	.string	"\002"
+	.string	"!\314\344\207\235\n\006"
+	.string	"\002"
+	.string	"\"\355\241\206\304\017\002#\250\267\374\351\002$\300\253\277\314\017\002%\205\246\225\244\001&\317\356\361\267\004'\350\300\306\254\005\002(\307\266\257\307\n\004)\367\345\303\353\007\002\002\r\002\004*\207\312\266\244\016\002+\320\374\270\356\001,\325\241\220\227-\337\222\346\250\t.\372\333\252\311\005/\240\342\234\212\n"
+	.ascii	"I\250a\255\200\031\244R\252\244\2325`\202Q\252\314\016\0210Q"
+	.ascii	"\244\262(\031\366\f\250\035\007\313(\264IG9\240qR,s\031e\320"
+	.ascii	"\366\312\205_\013\264\202=\270\260\237v\225\241\t\307\366\311"
+	.ascii	"\374[\004i\203r\3329\r0)\213\371\362\232\372\335\362\302\223"
+	.ascii	"\t\334\266-,A1\3658\\J\305\257\345nD\317\273`\256\373\244s\025"
+	.ascii	"\251\260\362\346J<J\"\370\001^z@d\254\301\360\355@\004\246\204"
+	.ascii	"\001*\364\370\246,\006\365>e\244\203\017\333_aZu\272%"
+	.text
+	.section	.gnu.lto_.ipa_sra.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375 \254U\003"
+	.string	"\"\206\021\030\200\3172\00630\00330\003\323\304\220@\002\271\302\201\202 \310\222M\246\227\263\233\325lf1{Y\313V\226\262\023\211FV\310>"
+	.string	"\367Q\251C\033\313\330\305*6\261\210\203\f[P%\350@\005R@?;\001\016"
+	.string	"F\205\371Y \316[\027;\320,\252\345"
+	.string	"\365"
+	.ascii	"e\245\346\202\234ryF\312\005\221\031\312\006\260"
+	.text
+	.section	.gnu.lto_.inline.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\351\003\355\f"
+	.string	"\262\21799@\217\322\001oB\303\336\324\2473_\337\217[\301\265\305\025\300\214\306J\277\021\036\351|\031\270\214\304\315\263eu-\220yX\240U\322\230\031\312\220\336\222\223\271\235 \"%I\001\226\210\200x\b\327\241\201aAA\265\2176P`T\032\213R\377;N\220\371\245H\344\227\037#\230\374\222BT\323/?\037Xa\376HcFLHJ\252@O\246j\005r\350\345\377w\241+#\035-\317\006\233\276\b<\220\205\352j\376\200\353\001\223Fq=\346I%C\225h\220\254\034\263\200\332\346\226\223q\342\202|\264\234<\366\254\247\366\206\373\372e\200;\214\377\322^\324\177"
+	.string	"s%\335\2244\346d\266;j\332lp\273\345\210M\226\316\233\321\305\232\0230\027k\206\274\251\025\324\377\337\354P[\377+\324\316B\235\371?\262?k.\001R\250\001]f\202\242\252\231\366\f\200\242\221:\363\022\340r\251\006\203\214A\206\t$sb,\234x\036\216o\242\216\262Mx3\314y\303N\003\313\257\371E\274-\203.\334\261\246\337x\244\2410\263\002\232\347\373\233\360\227\242\363\237\021pk#S1\371\3752\277\274\337\242\272y^\035\005\r\343\310\270\222b\313\200j\217\366\355\270\020\005>\246\227`\226\260\036\241\360V\340lK\207\370\224\254\273z\035SD-\273\204\300d\307E\243\246{a\2677\003\233\347y\007I\tZ\251\332\265\273-\254\347\367\357\332\370\357"
+	.ascii	"\266A^>,hAn\205r\235}\206\315\327\202s\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\235\005"
+	.string	"\342\212\037(pK\222\306\374\377\377\177p\017"
+	.string	""
+	.string	""
+	.string	"\360\343\353\377\213|UU\177\240\\\377\377\3779T\256\237ES\0377\304\020\273e\n\3278c\214/\266\270b\212'\2268\342\020\037H)\245\315)\246V\333\303\035nh\026*\2340\302\007\033\\p\251\236|\267\201\352,d\003Y\355\007\0013f\201f\024\264QPmG\235\312IE\352\200\001\226e\247\"\331\251\254d\034\250\352\205\251&\262\2413\234G\024"
+	.string	"\214\356 \263C^f\003\235 d\255\2606\354\374"
+	.string	"a\006\006(Lb`\323J\325"
+	.ascii	"\004\262\240\356\250`\267\212\233\3245h\f\b\021\315\354\n0\004"
+	.text
+	.section	.gnu.lto_.pureconst.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375 _u\002"
+	.string	"\362\205\022\033\200M\032\0033*\231\201\312\240\t.\202\002"
+	.string	""
+	.string	"\240a\252a\221$\004!H\3562^q\212O\\\342\021\207\370\303\035\336p\206[8\205K8\302\223;8\203\027\234\340\003\027x\t8\200\213\034r\217s\\\343\030W\251\252,\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\375\005"
+	.string	"\342\306\025\037\260'\303\001\f\3030\f\3030\f\200\031\021\335\255\021B\2104B\310\336/\356\335\235\315&\231\002:\032\207g\304p\026\212\204\2128@\021\364\314\365\232\347\3710sv\315\273\226\245\222\244\372\220\202\341\311<G\320\201\202\354\226W\031 pK\355\3243\331\245g:\240r\2174 \340\202\021\253\213\001\246\210\020_\206\036\314\221\316"
+	.ascii	"\206sf\345\347$Hf\323S\302\013\330\350\270\206\021!\362j\353"
+	.ascii	"8A\307\",B\361\203\2157\f\035l|\373\201\231\305ye\214\260#\274"
+	.ascii	"@\f\253P^\320\356\213\345\020b\252\203\347f\f\226\024\242\351"
+	.ascii	"\342\201 \305=8G\330\213\320'\214+C\333\n\343\006"
+	.text
+	.section	.gnu.lto_.lto.c25a2281923b7824,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_batteryConfig_Registry.44.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375 \231}\004"
+	.string	"\024\bb"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\335\361\031\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\364\006us\350\307\006uq"
+	.string	"\005\001\006'\001 \213\340"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_batteryConfig.46.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375 \244\375\003"
+	.string	"\324\005\227"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\n\036'\001\232\003\001\005\001\006\177\177'}{\035\001\344'\001\254\002\336\312\256\003?\202\210\200\300\002yw\311\001u\310\001s\307\001q\306\001o\305\001m\304\001k\303\001i\302\001g\301\001e\300\001c\273\001a\277\001_\276\001]\275\001[\274\001Y\273\001"
+	.string	"\016"
+	.ascii	"`\210\312\334\241\216\330\264IiWS\0308yi\327\246h\230G5\r@\273"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.47.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\324\001u\020"
+	.string	"V\235kF\340\026'\035\244\375\312uH\340\243\005\200\340\304\302b\314\364\307\217\344$7\034\221\rm\tK\232\332\\wku\310\207m\250\232\232C\210}\213\263?D\322\201\025\025\032F(\215K,7;\240\235\037\322\366&[\246\024W"
+	.string	"R"
+	.string	"\\"
+	.string	"\244y\251\275\300\2744\313^\362\331\315~g\210&\210\320\356rq\306Y\027M\251Ee\371\fj0\001c\255\213\266\025\2374&T\262<\321\356\343\332\016\032C\300\230\212G\215\024\024C\311(\366\322\032\310\220\244X\211\301TE\023v\327\n\306P\334\333m\257lG\260\365@?\016\344\363q.\275\232\321\203\227\376\314\274\324(\241\006\212,G\307\245U\354\331K\243\f\373\332\356\256\243\215}\235\177FuT\265\216`|\204\234(0\262[Se\312\206\222\310\215\221\355\253\375\036\317a]\207\204\001\354\302\350\361\331\235=\260\203\355r\301\003\0314\360\ba.\226E"
+	.string	"\217\216P\177\242\004\275\320\b\350g\357)m\273\256\203>\317\205l\340P\322\203\245i\232v\347!"
+	.ascii	"\216\260Dly\244\366\207\223\036\364\nO\213\360\025[\336n\366"
+	.ascii	"D\207\237p\250IK\251\334\006(\013\343GL\215\006v\222\300T\212"
+	.ascii	"\355\324wBl\2730\b~\037Lw\222\301\240Bu\236\2672\r\260\251E\204"
+	.ascii	"\327\251T\245\030\356\363R\037\252\3738\224L\351\304\231\274"
+	.ascii	"\217kI\340\024\210\316\343T\251\224\307\215f\256k\033mL\341H"
+	.ascii	"\350\212/\021\002\265+X\210\2615\365.3\306\230\0279\220\213\217"
+	.ascii	"\343\013//\3632F\231\003h\210\205$\375\3708' p\002\2411\254\007"
+	.ascii	"cB\217H\214k(\360{s\350\022n\r\341\2553\021r\236c\256\177pl'"
+	.ascii	"\330\323`\\\273cp\367~O%\256\033\n?/E\373/`\344\200\263\330\374"
+	.ascii	"1\343uE,x\275\013\032X\276\265\304bJ\320%[\022\235G\352d\246"
+	.ascii	" \335\243\033\271\004\032!C\001"
+	.text
+	.section	.gnu.lto_updateBatteryBeeperAlert.48.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`@\001-\r"
+	.string	"\326\227VC\020o\234\016\367g.\b\006\020\267\310\307\007\311\272\003z\306w\214\003\307\372\213\370\343u\256T\263Y\263\374e\300OV\367\215a8\204\256\r\270\002*P\021\020"
+	.string	"@\256\026#\020\222TZ\346\210h\223-S\nC"
+	.string	"@"
+	.string	"E"
+	.string	"\237\307<\262M\036jl%\325!A\244\305\356f2\343\243OK\352\310W\216\321\373\272O\003#\254\203\334\372\330P\341}\025.K\246\213\200\252d\343\362\235\244V\016\354\256\325\373(\334\327m+\260\235\261\257!\020Bz\357\323\017]\237R~u\275\220\341\001\206X \351h\207%\225)\373r\034G\024K\f[\325\362\302\300\024\231\221\335\t\243\213\025'\211\016\333\367C\276\022}\203\025\305\211\335\305>m\221\215\005&\331\371\037~Y!v\232rU\211\252\204\f\341\213P\253\267\247\225\307f\020\361A\330\304\262\333\035\374A\327\247\016\330\b\251\217\223\335\305\334\203\017Z4\026\265\341b@\236\300\004\n\345\304\244/\354\207\347"
+	.string	"\3629\034\346hB[\347\363\331,\310\270M\343<\035.\3630\3304\3108\033\227i\nXs\320\331\262\217\246m\031\026\222n\255\3040\002\f\"I\226\374\016\277\265\273;+\343\310\003\220\244X"
+	.string	"\324r\355\262\037pz\317\002HX\210\001\036"
+	.ascii	"3\241\233)\006\340\005\017r\201\354\300aS\r\017H\261T\342\340"
+	.ascii	"\312g\006\272\306\022 .\350\307S9\024\335\3511s1\263\215d6\026"
+	.ascii	"Rm\327\0055\240L\27441\3169\230\302_\016i\032s\252Q\340D\347"
+	.ascii	"\226'"
+	.text
+	.section	.gnu.lto_batteryUpdatePresence.51.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\376\f\r?"
+	.string	"Zg\274\026@P\344J\007\343.\251;\341\234<\352\304\265#\266B\f\204\261@\2370\331#\357\250\207\367[\263\345\"B\302\002\024\025\001!"
+	.string	" \202\204\315\220i/\240\337\325#\225\343\316\"\204\021\262\345\336)\245\024Z\001:\001c\001\3279U\235?u\366wn\020DG\334D\345\265m\221G?m\033\265\317\255\357\272\301t\357u\367u\312L\247\354{B\372\bC\206\311\033r\330\266vQH\276\265=\3561\237F\311!\030\3560\354\224Z\333\266y\255\267\243\351\370\211\230]\331\301\254\354\322w\334x\254\344\302v]G\271G\323q\203\263'gt]\307\315\245\241\275\245G\333\361\337\322\227]+v\025\331\322\3201h\225\033 []\352\345m5m\244\333*s\017fe\253W\311,\363\235\266Sk\033\017\017\023\217\261m\333\250\237\322l\013\b"
+	.ascii	"`\231\204tdTD4$\024\244\004J\"\327\253\246\357,w\002:4M1\037"
+	.ascii	"-\340\331\001\006\303\236\351r\316\315\001,\333\322%\246\301"
+	.ascii	"06O\262\322HV\216\326\252\270\321\232\036\025/jSs\242t\331\226"
+	.ascii	"B\275\2059\361\241\365\252\004s-O\224\261\266\026\nJ\241\016"
+	.ascii	"\313\350\351\3010\263tY\244\255\331\304\225LQ\306\2304\020\023"
+	.ascii	"\277fz\013[\342\311\365*\312\230Y#\313\336\302\310|\235c\372"
+	.ascii	"U\225b`\236\016\211\375H\227\332\266m\276/\377\324\311\rZ\235"
+	.ascii	"\036\f;K\t\234\001\036\351\271v!b^\356\353U\333\266\354M\261"
+	.ascii	"\261\346\001\315\334~\314<\305\254\244\023\336\374w\233^\351"
+	.ascii	"\007\374\001{\363\362G\206\372\246\277\201LG\251w\372\033m\205"
+	.ascii	"L\3076{\2521\252\013\376ET\220D\277\031\\\360B]\026\033Y\016"
+	.ascii	"\237C\276\364\235,\365P?@\t\\\211nc\002\331\266_T\334lZ\360\004"
+	.ascii	"\212\024)n\253POe\bm>V\321\200+\220m\333Rq\253\3515,\270\255"
+	.ascii	"\264\312.\264\264n\253R\337|\255`lQ\016\332e\026\335<\371~\272"
+	.ascii	"\376\002\224\340\211\006~9\037&z||\374\323O\267\337\277\301\316"
+	.ascii	"\274\372\257\317\300\340\266\3021dx7e\334V\373\225\203\216rd"
+	.ascii	"]\376\310l\347\345\357d\356\264\3754f\325\371C\322\331\303\352"
+	.ascii	"\234\325w\315\035Vg\016\327y\303\352\214u\2355\254\316\031V\347"
+	.ascii	"\253\325\031\303u\276p\235-\254\316\025\032L3\205\325y\302u\226"
+	.ascii	"\260:[]\347\252\325\231\252\367\232#\254\316S\327\031\302u\226"
+	.ascii	"\272\316P\327y\301\352\354\264:7\245\316L\007Vg\245\325\231@"
+	.ascii	"\3675/\221\316IHg$\325\371Hu6\272\316E\327\231\350:\017]g\241"
+	.ascii	"\353\034\244:+Wg \3259\251:#W\347uu\276\327Y\r,\025\037\3032"
+	.ascii	" \307\303\\\214\255\302\262\261nn\267\325\244\237\031F\305\""
+	.ascii	"\"X\3308<\242\017\372\242\277\201p>D\b\321KE\315\310A\207\236"
+	.ascii	"\035\210\007Y\301fa\343\330\270\333\352\377i\"\n}\320\017\375"
+	.ascii	"\375\223s0\023\376C\350\033\317\020\252\374 \367R~\317\265\003"
+	.ascii	"42\215dB\t\034\350\231\331:v\213w\223\227\276\336\0073=P\237"
+	.ascii	"\\!\323\361\261\237\356\362\231\200\f\351\262\004\275\223\233"
+	.ascii	".\217#\020\362\231gL\362\300/_\210\322\375\220\214\0225\354V"
+	.ascii	"\272\311\377\360\354L2?\031\222\277&\3565\222!\371t\023q\371"
+	.ascii	"\310\347!G\206\351\250|g\021\\\331\036\320\247!\327\177j\022"
+	.ascii	"\027e\263\376\201\367E\246c\203\276\277~\0018`g\352\337\364\245"
+	.ascii	"^\375k\007L\013\223\350=z\322o\277N\261\274\361\"\007M\376s'"
+	.ascii	"\266\"\026\207\254\254\333*\217'\232&\342R\034\2702\344;9\304"
+	.ascii	"\375\337\212\316a\376\320\207!\360\374"
+	.string	"\257\321\273F:mG\304\3775\021\273`\3349J#wOE\346\"&\316\333\232D\365M\f\267\370H|\023\030\341\251\236\301\"\030\343\324\023\370\b_\340\017\354\n\204\237\372f:\356\361\210.\214\003\341\335\013\025(\201\3571\235\316u\261\023-\314\363*\023Cx\235^\351_D\001\003\\3fh\271Ps\254pv\361@\307\226\026\016\034,ZDqm\331\340\252\241\305\025U#\006\013\032Q.\266\270\242\036(\261\215\033Z[Q8l\330\330\212R\332u\365\247\361\b$m\272\336K\300;\237\231\037x\027.\376\327D\364\360INQB\257\302\274\254\367\360\035mg\303cj\351\360Y\034\036\353;lx\016#|\013t\203\206\307\212\262\n\247\233\323\360\215\207\364p\\\216eBd\305\036\347O\326\314\t\013\005\312=z\244,G\257\242\t6\222u[\363\254M\200\306\272F\337\"j\370\206\205\226e\364*\234 "
+	.ascii	"o\353+X\222^l\236+.\333\232\030\310\250\210u\327\002\311\024"
+	.ascii	"]\315\311\\J\3175\003#\200O\305\345;\331\221\032t\3535\2220p"
+	.ascii	"\314\221\020\006\235\241\251i\006\227\364N@ |\016\221>\355\352"
+	.ascii	"\255\376E\224\rac\370+\013\217\341\373L[!\323\361N]\243\235\243"
+	.ascii	"w\362\205\257\372\027\321@\022\236\346h\027\276\370\365I4\262"
+	.ascii	"\360U\202z\\\302\241<\261\360\255\327\016\372\214L\331\023\247"
+	.ascii	"HNWX\032\322\241\360\025&\274\325S\220\360\023F\370\231\233I"
+	.ascii	"\250z+0\254\302\231\370\222\252\3570\335\004\230\244\316Y\035"
+	.ascii	"\324\245\220\301\263G\3240n?\0023\267\207\302\225\221\031z';"
+	.ascii	"\305\351I\330)H\242\177O\305.\302\306\272\314\001\201\027\250"
+	.ascii	"\201 &\221S\252fD\222\244 Y\0161\005\204(\350$<\017\022@E=\n"
+	.ascii	"[GLN*\313\376\033s\250\375\007\303)a\305\256\313F\302w\271\004"
+	.ascii	"\205%\005\302|8\021p\217\177\213\026\370^KtQq\227\031\237\301"
+	.ascii	"\344\262\271\3275\220\275\202j\006\365\037 \353\031\346\t@G\324"
+	.ascii	"!\020k\363I/\023\276\257\307$\223\305\210\355\264\027\204\377"
+	.ascii	"x\344\"\327R\372\307ZG\217Wp+\267X\031\321\3412\374\027\250\257"
+	.ascii	"&9\334\214\250\257ML\222\204\2421HD\335\367\3104\002\2559\357"
+	.ascii	"\213y\022\372z6]\324B\266X\3628\265\322\2062@\214\3071\300\210"
+	.ascii	"\003\372\363Bx\313\006 \324\325e\0262\327Ee\021\245,\b\201\226"
+	.ascii	"\t\343\357^\001\212\370\311U\306T\337\272\232}\271*W\b\260\246"
+	.ascii	"1\276\rE(\025;\322}D\336\357\007N\277\330\020\020\370@\327\360"
+	.ascii	"\204\337\236\243\245=\224\326\033\350)%\316\005,\226=\344\343"
+	.ascii	"G%\251\243\200J\274\221d\217\0021\223U\363D\253\235\277\217D"
+	.ascii	"\260\020\235\255\266\231:\301\224\274h\037\276\375\355\007\n"
+	.ascii	"[MN\342t\302!<\034\336\r\023\247\001\264\226\223^\307\016S*\322"
+	.ascii	"6a\006'<\235\241\rO\243\301\361no\265@\262\021nz\242\266\354"
+	.ascii	"|\370Z\002*\234\217\263\034\247A\256E\273\305\230s\317\001\371"
+	.ascii	"\261\0247\231\241^\274X7\017zAM\200S\204\250\b\206\243I\234\243"
+	.ascii	"I\275`\205\2007@%\201\201\217\023\023\003\344\302\240\266\256"
+	.ascii	"\355a\005p\307\376\213\353i\233pG}\377<W=\360Vm\221:U\234\254"
+	.ascii	"\240\305+6\320\221y\324\367\363\224\006\240}\303{\237\217\374"
+	.ascii	"\345^\242E\345\327O\3106\257@\244\327\007Hy\305\277\333O\265"
+	.ascii	"A\240\020~\177\346?\356A0\225Y\251\221]\362\366\026\026\227o"
+	.ascii	"p<\016>\341\b\026\017*\302q\257\360;8 \323\347\307\335gC\201"
+	.ascii	"\373W\032\002z\037\200Ta\220p"
+	.ascii	"\031\257\350\007\027\250:\361\n\0024\006\335c\341\017>\017dX"
+	.ascii	"\007\301\202I\372\224\325"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltageState.52.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\227\004\235\027"
+	.string	"\306\250\215J\320\356*\035[\371C\225:\364\343n\357.1\331&\356\262\232\274\301\223\022\353s\347D\222\234E\270=\310t\322\\iZ\032XfF\312\225\006=G\033'\370\342!\346\215\003`\002\036B\"\354\251\327\177v\362\t!\204l)e\nx"
+	.string	"j"
+	.string	"{"
+	.string	"\247\315o\346\363\362\027\200\352v\242@Q\255\023\222`T\240\330\243\341\377\236?\371\205\353\313PI\027\235\032\316\213Z\353\252]\366d\317\222Y\222\243H\233O\276$\313\264\341P\366,u\304\334,\260Y\306\334rL\222\254\361\204\253\251\260\330\241[aY*tc\241\0343\313\022p4\356\n)%\334lL\325ZWwc\241L\262j\255g\033neo\332\377$\376\023\370i\204\037X\210\363\355\260A\274\212\241\346ksa\271$\343\212g[\255\375\360\376\365\375\0276\005$\231ZQ\366\002\333\352"
+	.string	"\216\024F\372\227f{$_\230\307Lxm+~M\306\025\267\r\020\031\345d\234\364\373f\334\273\177i\355\226\237\371*\346k0?\325|T\363O\224\237\321|\023\363\317\346\227\230o6\277l>I\371c\363E\346?f\223\277\242\2335\361\320\210\275\373\216 \207X\310\f\357\253\265\322\336\275\324\331"
+	.string	"\321\370\350d\213]\366\306\216\no\306I\037\233D\260\"\022\224\265\322>\276=\373S\260\240\325\032W\034{}^z\264\305\345\331\020! .\327\270\"\355\275\t\346\270\273\267\206\364\006\273\023R\326Z?\276 V\307\301\027f\305\213\274^\343\212\334\344o\205QO\306I_\016\213\342\001Q8\306v\3167\007\361\200"
+	.ascii	"s\225\224"
+	.string	"\264\030\254b\260Wl\304\025[\215\204\264DV \260\330\312#\300_\017\\\260U\311\353\005[\235>\331\322\355\226\231-{p@Y\317\276\033\366,z\252\200!3,\251Z\243W\027T\265\200`\216(\205F\223?\027\036\326\304\003d\326\240hQ\366\356\2516{{6A4>\022J\365944\312\2219\300\341\210\352\322\251M\215\352\r\237\214>\005\001e\364\372\004\3176\2318\340:{q^\314.\225\bc\250Qd\343\020D4\222\242\024\027\032\003\320\002\021\261!;\021\340\250t\f\331\230l3\002\272\205\022E\210\202\323n\251Rx\247\312\310\343J/\212\356$\302\352\313\271\306\314\260@.\236\203O\251\360z\214d\306\204\n\265\307\177\301/\362l\t\245\0279^\277m\3640$\361\203%\240~\3401F4\300\216\311[\223\025m\bDZ\235\350\177\334\215\275\376N\332\037\337\336\355\b\207\231\342\006kV\343"
+	.ascii	"F'7\205\177\370\251\342\335D\317Xe\024\301{\017\277\317%\370"
+	.ascii	"(O\036t \374%\356a\177\242\206\3176\330\336\221\240\f\306\376"
+	.ascii	"\002(\003\013\n#\2706B\004v\3356\254Xj"
+	.text
+	.section	.gnu.lto_batteryUpdateLVC.53.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\366\003\345\031"
+	.string	"\206n\244H\300XM:pM\3144*|\357@P\330\313\221\276\260p\031u\333<\031\260]\377\332\265?\210\007\035\352$\255!\373\034\326Tm+\204h\253\303bcnS\024\004\331\222\275\021\264}\363U\273\345\017\023K\b\331\233\310\235R\213"
+	.string	"\202"
+	.string	"\230"
+	.string	"\276\261\305\317\213\266/\355\007](\347C8\016k\205\241$\244\326\035\004?"
+	.string	"?\021\\E?\275\307\320O\347\330U\276\243Q?\037\033\217\221\226Z\353jg<\347\251\020\374\350\364V\346\370\337Lh\273\221x*A\370\315\300H\321\342 \013\033(V\310\217GR\025\237\342\255\026\340VBz^\003\034\223\236"
+	.ascii	"\267\232\247"
+	.string	"j\2121E\274\355\310uB\321\302CPk\375\216K\0237\232\224\337L\255\325\322vKq\213\267\215\303\266\005{\235\002S\356\227;\332\262B\326ZI\354\352\354\344.\372\355P\264\264#\271\330\366\360#\027X\353N\004\277\307\215@\370?\237~\301\344m\237>\214~~%\344\200pBC:2\312\336\321\344\352\354{us\366'\255\242\3221\037\372aVZ\\\351\324'\035~\322\340'\375}\322\224J\317)\355M\351\365\244\345J\177\300\002 \234\013\037\023\013\265\253'\242\272T\2469\244\206\317\343D7\337\231An\n.\350\323\001\337q\001D2\232\2568\211Y\325~Yx\276\314\205\331\230=\321\275\033\267'J3\216\200h2\312M8LsgO\322\226\177\253\023ro\307&3p\311[/\211\305\020]\335\323i\250]\341Jh\222\210=@r`\201Y\373\302\217\340\030\301\220\013\302\t\271\370g\224\310\354"
+	.string	"\224!\341\223\217\034X\034\020\371@2?\243\273\222K\221\224\fW\232\201\265\326\b~\322\203h\330\300\201\003\375\334\275\221\317}\244\304\t ou\3625T\356X\024\345H\377Q\343\377\230\325j\321\007\376 \023\013\341\222\315V6\260\327\013\306\"\020\243i\275\\\026d6\255q\234\261"
+	.string	"\230%3bl\311d5\035V\261\021\026\263i\305V6\256\232\327\2125\306V2\006\f\023\321\032W2\030l\\\211;\235{us\024\2220\351,-u)Q\256\003)\312f%\024\027\212F\001\224'TlVt\226<\265\342\276\206\0137\265t\351\346\005\221\nn\270\f\274\324t\250\366[p\013d\251\331\240\353\247\273\b\375\326"
+	.string	"\225\032\020m\351~]\220\240x\276xWk\005Wg\317\351'\352\023\250j\003K\250\021\300\220S\320\t\n\032\212\023$%\315\001p\002\031)\274:\021p-4\210Ha\266\031\371\214\2377\"PI\353i{\312\260\264)\352\235\bq\2612\212p\0178\367\321}\250\310i\227E\304m\266\374\205\310\246r\320uC#^h\350\365\342\"i2\3146k\373{.\3114\300)\210@\261\230\300\265\0319!\026\206\264\024X\022*~\210\237G,6\264\003\371\242\340%\301C\272\346\004\336D5\222\217"
+	.string	""
+	.ascii	"$u\\\310\034r\214\004\271r0\304\246\324H\376\301\030vu\311\273"
+	.ascii	"\253\260\211eE\246\345qd\231#\030\250"
+	.text
+	.section	.gnu.lto_batteryUpdateConsumptionState.54.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\230\002%\022"
+	.string	"&\340rG\340\320(\035\332\203\350\224\325\201\337\240\230J\276\352I\361\373\214\315\fb\032gV\003A$\203l\240\377\036\355\037GD\t\253\252\376P?a~@`\236\320(\333 >\360D\n\bwe\242\021$,6\262\t!R\246\024_"
+	.string	"Y"
+	.string	"\\"
+	.ascii	"\337\273\223\354\262e\334\006b\343LM\013\317\215\335\005\365"
+	.ascii	"\303]\367\030}\321\3538M\227\037GF\262\331\312=BF"
+	.string	"\337\220K\007\016D\204\013L\3068\342\341%\346^\200Y\013iv!;\226\344b\251\265\207\f\271\304p \273{\234'\206\031,3\216\354\256S6{\271I\267\255c\233\201\235,\001(/\241\372vc\013|\333u(\3704\357\314J\311\313\336\371)\336\273k\214\271\270\251\275\362f\333`\2514\373\334\252\214\375\234;ri\216K\253\2463\323'\t\330\360\242\301m7\303M\307\nu>6\317\271}\022~-\201\002\327sT\276\r\021{fnh\354\332\f\274\363\201%%\336\273H\0044\302\206\2474?\305\243\022\240\315\330)\372H\273d\312\313\242\276\366\333\274\324\020\202\351\212m\333\335N\305S\005P;\212\367\250\3704\016O'\357\235\352c\024\301\274\362\226\347\224\346\237x\251\271\003\365\023'<\2517Q\224\273\273\242J\363-xW\223\035\030\261\314a;\247\024*\205*\241\204\017\302S\251\225\nM\253\320\301"
+	.ascii	"\233D*\254\302V\253d\002\262V*V*d\201)T\t\0054\255X\240H\001"
+	.ascii	"\253&\204+\260\245R\255@\222\355u\2251\316\277\037\016B/\205"
+	.ascii	"y\270\005G\0043:\213\240\217\335\375\224\346\250\234\276f'\b"
+	.ascii	"\302\177\"\370p\212@\003\020\216Z\314\223x\276\212\257 \221\020"
+	.ascii	"8 \320\002\251!\363\263d\221\263\355o\262\237{\333\367n,\256"
+	.ascii	"p\344\346u\3672e\241-\334^\2755\3541\b\305\225/[\371V\215\270"
+	.ascii	"\360\255\273\360`\375\222/\372s\233U\244\313\200\354Y\246\322"
+	.ascii	"\356e#\233\371\250\332M,5\024=\036Q\203\006r\202\244\025\311"
+	.ascii	"n\321r\\4ap/\2702\234\263\002\023\334\202\033\355\205\241\020"
+	.ascii	"z\273\321h\365\325\243]\207\217\3452"
+	.text
+	.section	.gnu.lto_batteryUpdateStates.55.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\b\001\315\f"
+	.string	"\266\027VB\020Q\234\016\030\264\235e\200\032R\310\031\365\357\025\021\364\267\"\307s\236\037:HX\256\260O\2543\263\210\374\377XG\261o)\315dd\342&E`r\021\2149\326pt\342\350\n\300\276\033m\262wJ\001@"
+	.string	"B"
+	.string	"D"
+	.string	"\340C$x\262\313\201E\311\256H\300\003\260\323\313\001X\247\325-\326\251A\273\306\305\017{\224\213\n$;v\267N\017\007/A\377\"\237\204\244\320\345\205`w-CR\351\236\267-\300\366\001\373\032\002 \366\224\306n\272\257\237n\353!\177E\261\224\230\221@\307\356\205T\217\035)\f\0217\375'\373\242\257\342#'\320%Ub"
+	.string	"3\201\276\245\275\005\036(\0316vE\314\251\013`\247\257\330\276\264\217\342)\002\024r\214Zh\327<\016\020>\352+@~\b7\330\344\303S\177\263N\255\371\221\327\0334Nd\020\311\224)\262\232v\207#1Nx`\031aI\373\003A>\264\214\261a\034\315\220-\206\344\354`\277\332\335\365\f\033\215\344h\244\307@\353l\013>\217\326u\237\354\303Y&B\247}\337\206S\275\216\363<\232W=\333\246S\263\316\253\231"
+	.string	"\346\034h]\3758\256\253\025q_\355\004\261\002\023\243h\216\214\315\027\331E~\f\327\264&61$\001\032"
+	.string	"2\241=i`\\ \210\003\22755\036Sc\202\024\320\256O\324E\252\025 \034HA\263\3415\005C\327@/\356\226\320"
+	.ascii	"\374h\302\302E\035^A\004\234\242A\254N\203ky!L2"
+	.text
+	.section	.gnu.lto_getLowVoltageCutoff.56.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375 \365\305\006"
+	.string	"\342\214/4pM\322\001\240\f\340 \376\331\260\b\2172d\316!O\321\361\032B\327o\riI\217LN\331\245,\251\231:W\254B(\033<2\312\352\245\244\221M\366N)\266T\030i]W%\001N\031\347\305\232\360\242PY\200\0269a5\340\310`Ix\305(\341T\367\316s\016L\332\335\234\372\033\257\r~\305\2371X;\375\363\261\350\217`\343\034\354\252iN\302>\264\316c7\352c\004\241d\027\342s\262\"\017\304\302v\306\236|\214gd\234\tT\212\016"
+	.string	"I\310C\207\311n\205\256\017\210\376\244S\321\237\233x\366\226\371\3278t\341\361\241\034\315\033\345`w\335(\247s\273\333.\260m`;\"\b"
+	.ascii	"3\003\336:Cc\270\3055\261\032!\264\020\231\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_getBatteryState.57.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`m\322\001@\003\023Q\333X\0079\f\321!\373\241\004!\314t\251\005\337,\352=\234d7\320UB\357\022\322\223\300\034\205<\327\np|\265do)S\n\316\\6p\262,\f\302\253 Ui\246\352i\0220\n/\003\253w\0310\2650\301gQ\024|R\334+(\325\362Q\006\373\034\217\227o\341\r'\217\335\371\234\350.\025 \342\223!;zR'\354\267U\220\355tj\005d\344 d\367!t\262\"\356\343\302v\307\226\374\214kt|\265X\221\0058\2244t\230\354\306g\271@t\327^\211\356\224\342\327\363\362\277\361\206\341A\202e\236'\305`w\235X\006q\353m\023\330.\260-\021\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getVoltageState.58.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`m\322\001@\035\002rB\267\365\026\206\350\220\375P\202\020f\272\324\202o\026\365\036N\262\033\350*\241wY\211\np\212B\236k\0058\276Z\262\267\224)\005\306X4p\262\254\013\302\253 Ue\246\352e\022.\n\017\003\253g\0310\2650\301gQ\024|R\334\353'\265\342Q\006\373\034\217\227oa\315&\217\335\371\233\350.\025 \302\223!;vR'\354\267\325\217\355t*e$\344\300c\367!T\262 \356\343\3026\307\226\374\214kp|\265X\221\0058\2104t\220\354\306W\271@t\327N\211\356\224\342\327\363\362\277\361\206\001\002aY\34791\330]'\226A\334z\333\004\266\013lK\004\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getConsumptionState.59.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`m\322\001Si\036\270\005\255\230\342gZ\366O\224 \204\231.\265\340\233E\275\207\223\354\006\272J\350]V\242\002\234\242\220\347Z\001\216\257\226\354-eJ\001\306X4p\262\254\013\302\253 Ue\246\352e\022.\n\017\003\253g\0310\2650\301gQ\024|R\334\353'\265\342Q\006\373\034\217\227oa\315&\217\335\371\233\350.\025 \302\223!;vR'\354\267\325\217\355t*\245$\344@d\367!\004Z\020\367qa\233cK~\30658\276Z\254\310\002\034@\r\035$\273\361U.\020\335\265S\242;\245\370\365\274\374o\274ax\214`Y\34791\330]'\226A\334z\333\004\266\013lK\004\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_batteryStateStrings.60.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375 \357u\006"
+	.string	"\204\013\216"
+	.string	""
+	.string	""
+	.string	"U"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\310\330\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\by\276\003\005\001'?\206\bwu\301\002\005\001'I\206\bsq\304'R\206\bom\306\001"
+	.string	"?\202\210\200(k3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005INIT"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\fNOT PRESENT"
+	.string	"\tCRITICAL"
+	.string	"\bWARNING"
+	.string	"\003OK"
+	.string	"\b"
+	.ascii	"H \r\002\006\204\203\214\001\341<\363hP\371\r\240\b"
+	.text
+	.section	.gnu.lto_getBatteryStateString.61.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"=\t"
+	.string	"\306\321@9@\217\322\001{\215\001=\376V\025`\216\207\212\r\277\362\273\344%\351`\206 \250QS\365F\363\232\020\033\354QR\023\376Ut\246k>\244\304\3144\221\307Ekd\223\275S\n/"
+	.string	"/"
+	.string	"0"
+	.string	"*\215J\006\206K\266[\251\353\005\266\317\315\003\266O\351\361\322c\311\177\353\332\314\312\013*U\361\250a\330]GTJu\313\333F\260\255`;\026\266\243\245\214\216\332"
+	.string	"GK\203\313\256\306LfY&\f\304/y\035\235\304"
+	.string	"\027/\331\356r\237\366\310\346>o\223l\316\027\371\b\311%\202\372\021\177}\264\263>\355\205\266\220|\353\t0\257\030\330M~\002\372,K\210\342Q\237\276h\373\214\362\365\007(\261\220\rS\234\331\365\024e\207}m\345*\366p&\276.\f;\016\024\374<\020\324\201\024\364\320\371P\317\007RN\201\275\210\356\243\241\347}\224\253\246k+WR\032\230\344\311\266)\236\002\261\331\265X\360]\001\f"
+	.ascii	"2\241\365/\260Z\302#\235\2333q\216\324}\256\341DL8\250B\027T"
+	.ascii	"8\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_batteryInit.62.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`%\003\315\024"
+	.string	"\226\342~I\320\362\2501T\"!\360X\350iT\361\330Z\301\t\\\213b\346\211\250\350X0\353\213^\222\273\313\027\303\033\327\3226\205\202\277/\365\005\001\315c\006W\332O\321\244\275\261\232\243\340\305\002\016a\353X&\353\200\020\271\267\224)\005f"
+	.string	"e"
+	.string	"n"
+	.ascii	"\237~\200\357l~<Vt\367n\250\372q}a\222\217\355\267lm\250\037"
+	.ascii	"\355\334#\205\250\311\375\356\275\"\325"
+	.string	"\271}\rA:\255?\237tdI{\2354vd\371\341!\215\247\2062\303\004\217;hB\311\211,;\234\202 S5L\255\322\006\036\240\371\211\b)os\256N\356\275\236d\311\341^\335v\214m\0036\245\005\367\232\370-\356B\202\317\363\320-.WS\217\305\221\\^0\253\034\317\245\372*\276\302\345\005\006\246>\\\005\361n\364\234,f\026\346\304\370\371c\365O\034\305X!\026\253\017\303&\235\020xY\365\211^$\363yla6O>\364g\365!\t\217\324\210!\251\332\254\262\217l\007/\315\261\017\336{\257)\216=\247g4\326\316\265\2717w\004\244\347\301G\233TvzQtC\217\241\236\212\244x\272\315)\243\333@\300\272\367f\342\327\270/\201\002\024\224\372\360t\225[\362Q$`~\350K)\254{k'\375\031Wb\320 %\245>\264\035<\230'=y=|7J\263\257Rm\b\357\251\360"
+	.string	"\320(\t1y\345\2731iA\317\320Y\252\035\341:\026\221\0337v\225\314`\257\231\231\226\tb\f6\306d^1Q\346\245%Ft\301bb\311"
+	.ascii	"\217\024^0qf\034ab\353\250v\360\024\007w\226\f _\215\332j\316"
+	.ascii	"\356\302\b/\324\251\363\035\226D\324\244\253\\\024\211\016\373"
+	.ascii	"\203\3439l\217\365\261?\366\307\002\331\240\036\221\254:\331"
+	.ascii	"\022\263\343^\240\t\3527\311;\342\023\332\244\002\tL\333\342"
+	.ascii	",QH\017\204\317F\003J\250Q0\f\2252U\"\023\027\024\247\r\240\002"
+	.ascii	"\0219\252\033\021 9\224\252\212\265\316\376\031R#\351=Z\273\313"
+	.ascii	"\036\225\242\344L\322(\300\323L\377\373\353\013\026O\320e\340"
+	.ascii	"\fT\032@]\301\037X*\327\n\261\"\254\346Ou\232\273\357\003\030"
+	.ascii	"\biF(t\317\321\225\366\033$\265\200;4J'\322\374I1t+\b3F\003\""
+	.ascii	"\003\213+\007i(!\0257\305HK\364\002\212=T\251\202S\242\254 :"
+	.ascii	"\006\\\234u\317\225!\352\227d\376\r00DCu\226\311\240y\320p\264"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_batteryUpdateCurrentMeter.63.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\362\002]\026"
+	.string	"vh\220K\240RR:\257+zu/8\004\352F\356\306\260w\020\253G\252\r\350\\.\223\335\227\331\247c$)(\220\252\2627\017\234\376\346\316\255\216\3735\340\367\203?yy5\220\327!\216)8\303K\032!}\262\3654\327\376\275\311\336I\006x"
+	.string	"q"
+	.string	"\200"
+	.string	"4f>e>\321\213z'v\340Yw\211\251b\367\251\200\023\310n\017\234\344\336\222\037po\271\307\274\365\023\250/CDP\311\330\335e\375y\357\261k\311J{|\337c\027,\t\353\336\350\b\240\250\222\262\230\2067\267\301\232Kb\342\351\004\200\241\207J\312n^I\0065\306\234\221!\220\f\360\025\334q\243S\020\303\037\2451\224\356f*\034\2068\313\316\314\315\314+\314U@\"\2249\303\215^\310\265\3728\253H\034Q\031\346\276\276$\365"
+	.ascii	"\322/\346\277\270\022\f?\210q&\275\360\226o\336\333W\027CF\235"
+	.ascii	"\"\034\032zd>\177\264\3660\277\036\217G!\\y\230-\345Y\214\362"
+	.ascii	"=\361\267\227r\265\224)I\371#\267*\032\177\334\262\272m\216C"
+	.ascii	"\372\312"
+	.string	":\tUz\346\363\217\2164\363\223g>P,\272\233v\313<\303L\273}\377`\243E\302\326\036~\324\245>\305[\267J\212\222T\330m\203\377\364\263\334[\t\255u\022\231\334\211\273}\327\221\001\365\002\037'\221\261w\332\204\266\003\244a\314\\\341E\013\262n`\003\376\2147]\340\007\3352\206\226\226{[kl)\312\213hk\f\024+\206t\212rf\365\326XW0\214V[g\365H'U\fy4\375,\245\370\035\306\231\\dj\265{K\353\314\007\252E\305\021:\312A\006\254\341d\267\341\306\213)s&\016g\326Jv,6\334m\205\227\263\351t15\021\256\235\310\350l<\236\313K\271\323\231\273\234mW\346n.\270\262\246\333\225'\005\330\344`\323\225<\323\324\225\264\223\346dW\036Z\177|\2503\n\331\335\035\303\322\301\016Tpt\321\270\315\252\275\270\256\001\372\363V)\262n\232\013\371T\257z"
+	.ascii	"!%\345FP)\tB\200\336\312<\201\302\310\r W\300\352\343\327x\t"
+	.ascii	"\327\225\217\202\005; \220\002\031:\243\007\371dph\350\232\t"
+	.ascii	"\354\374\036H\261\217\006sh\247\326\316\261\345\330\262k=\332"
+	.ascii	"\373\263uj\315\332\332\255c\256]`\222\"\233\214\351\211t{\331"
+	.ascii	"\235\274\026\342$\005a\352`\207\033n\026\336\354\226\376\266"
+	.ascii	"\371TN\262\265,\031\202\001\252\255\\\343tY8dO\266\201g\227Y"
+	.ascii	"\260\025@\371\274Bh\227\251\267\347\205\354\033v\316\320\020"
+	.ascii	"\304\342t@#)\325Ew\326\026\373,\0362\233y\322\030\352\036"
+	.text
+	.section	.gnu.lto_calculateVbatPidCompensation.64.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"U\013"
+	.string	"\266\325M?0O\233\016\004\003BF|xhH\341\177\210\023\372\24570D{i\354\231\230t-a,d\344m\355\030\354\313\275\317\334\006\373\037\f\265\252F\323;f\342\240\233\304\344\351\037\262do)S\n9"
+	.string	"="
+	.string	":"
+	.string	"&Bv\227\242|\200\364\b/@z\324\016\317\01653?b\201 B@\270\016t8e\270N\272\rRv\367\035O\215.\224\031\261\354\256\223\3530\334\361\266\031\330V`\177A>\\\345`\353\275;\237~\224\250H\201\302\372v-|1\366#\236\370p\357\2673\277\303\222{\036M\240\013\004&\200Ph\261\273\007\036\215`z\364C\\Df\217\240\310\003\307Y|\031\001!h"
+	.string	"i[\021\362\\\252*\350\251\272\321\221\256\030\217\025[\302\260\215\335\2433\355n\t\374\021'!\301\347x\264\347\223\347\036\375\217\364x\215d\224x\341i\371\331\242P\352\206\003W\365\340\222i\020\300\231\212\347\2528\234\013\206\302.\013\333T\030\265qp\321P\231\013\243*\005lA\250.\212cY\027%\021i\207\232\252qQ!=\372\332\271\355j\006T5l\253N6h\370\3204\023"
+	.ascii	"seY\203m0bf\202\007G\006\254\340\006[\260\013\205\035\3352\031"
+	.ascii	"\272\206\207L\220\240\342}L(\213\332\006\270\006\215\302g\250"
+	.ascii	"!\333U\312"
+	.text
+	.section	.gnu.lto_calculateBatteryPercentageRemaining.65.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`q\004\335\035"
+	.string	"\3068\303I\240VN:\325\243\240\261\343\017\225c\276\003\035$=\306\333\2151\346.\016@\340=\342K0B\322\305T\357\316\035\247V\336\362\211\333\364\205p\rw\304\327\351\353\363\346\246Dr^\226?\224\364P*\347\215\"v\023\"wJ\001\252"
+	.string	"\234"
+	.string	"\266"
+	.ascii	"J\234\374\300jEq\346\245\212\215B\254\276\365g}\332\367\242\201"
+	.ascii	"\0319\216w\3315\217\270\016\303\250\b\323r\241\317\345\332\207"
+	.ascii	"\317\321\364\255\037Y\203\220R`-\034\220\037k\256C?\316\343\320"
+	.ascii	"\217\366\b\273\366q\332M\276\226k\317\002\222\365\212\346e\305"
+	.ascii	"\242\254\326\341\201\217F@~\264\202\005M\006~\030\003\005\265"
+	.ascii	"Z\021\325\245\245\326\341m\251\016<\035\305\235@\237\366@\254"
+	.ascii	"\301\205\212T\220\304\351\324\307\230\340\324E[\260D-\b5\227"
+	.ascii	"\353\363D\260\024\001\324Z\257\365i\"\3704'\355A\255\325S*\230"
+	.ascii	"\342\246\3356\b\333I\266\030\f@t~\325G{PR\242\037\213\366\\\027"
+	.ascii	"@\005\304\206p\326ZI\354\3020\220~;pI\201\232\\\354\367\270\017"
+	.ascii	"\240_\345\017\273y\251\035\375\370\245Q}mY\3414\317\354\341\323"
+	.ascii	"\\\030\366\305Zk\365\276\260\217\214\276u\027\321i\242g\335C"
+	.ascii	"tZ\210\234\016\"\247\201\350\364\017\235\366\241\323=t\232\207"
+	.ascii	"N\357\320\246u\310\351\034r\032\207\234\276\241\3236t\272\206"
+	.ascii	"N\323\320i\033mz\206\234\226\241M\327\350t\3148\r3N\223t\232"
+	.ascii	"6N\323qz\034\247E:\275\343\364\024\247\037`([\263Cc3k\333G\231"
+	.ascii	"I\370\222\034\251df\337\204LX[\231\035\247D\231M8\222\237\221"
+	.ascii	"\037\251`\341\302\005\372\261\266\th\204m\021\216={4 \013\030"
+	.ascii	"\027\024/\263\003\347\331\236\365,\261\370\311M\204\306,\317"
+	.ascii	"\336\353\342\215*-3\240\354\260\002\2631+~\225L\310\245\013\263"
+	.string	"/\221\320\226\334\227e\264\r\"\022e\006v\036\266A\325\352t4.]\240\261\022K\334\271\343\276\274z\232g\336\025\267gIYf\f\017\313@\326Z\031\370B>D\303\006\016\034\350\307\335\207\221\t\213v\356kl9+\313.\376G\2136(\253\213q\007\313-\210R+\024\003\377\353\001NBbJ\362\341v\267%\336n\307\313\375\374|J9\\\b\034\004\032\235\007\234oI\227\353\351(\3308\207\364\353\351|>\\\207\033S\217\307\264\244c\272-)\341v\267\\\217\351\206$d^\b]\357\346\343\361z\267\332\320\351\342\367\205\177ej4\202\371R\305L<Z\021Ud\314\377\370\320\232\260=\264\327\372O\270H\"\346\264O\"\245Y\2430\242\245)r\241%\332w\005\255\320\212_@\233\263Ak\240\253\274\361\263@>[\263?\333\340K\211e\333\235\365\331[Wy\245\263;\021\356DLg\347\030\231\320\211"
+	.ascii	"\305\331\234-\360Ub\335\254\314\342\254\317\224\362\312foj\326"
+	.ascii	"\2666\373\022\353\001P\250A(#\215A\n)g\"\231\321\264\260\325"
+	.ascii	"\220\002\031#\253\007\020XfE\311p\303c\225*\363\363\213J\351"
+	.ascii	"\233R\027A\256\3251\3406u\021m-\0342G\330\340\343c\362\030\f"
+	.ascii	"\"\310\344\215\306N1\274\272\035\314E\273\373\377\213\035\207"
+	.ascii	"\202\216\374\023{\344\222\356\033\027%\021^L\262\334~\336\316"
+	.ascii	"y\227\262\036jk\315\017\005\271&x\207\322I''\036L&Y\316[\254"
+	.ascii	"X0\315F\035\337h\300@4[v\222~\036\376\be;\221r\224D\241#\214"
+	.ascii	"\275\332\003^\304\216?R\002\036\r,\221\034\025\354\316.v\232"
+	.ascii	"\024\221\357\215\032"
+	.text
+	.section	.gnu.lto_batteryUpdateAlarms.66.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"\025\t"
+	.string	"F\321?90\305*\035\2007\276\006\235\20471\200\034\203Q\007\237+\032\333J\322\004#\346\034\346\374\320\213\032\325\202\026]\215\364\243\024\304\2045Q\241)\013\341\341,\300&\362\311\3362\245-"
+	.string	"-"
+	.string	"0"
+	.string	"*\362\267\314\356^u\013\030\216.+\036\345\301+$e ,I\202S\006x\325u\"\374T\267\314\356Z\301\220\342\326n[\3016\202\355\221\254O\243\205}\271\273\353\210\262\257\276f 3\t\265vO3\331\2724\021\r\333\277Xd\243\234\225\332\2676L\037"
+	.string	"vw\306\213\213.c_\034=\025{\201DKT\0367\036'%\215\331\366\336\001\021\260[J\3609\276\212\3601\256\031\024\322\203\327\374P\345\332\343f\"\201\255H:\263\003\346`@]\347\363\321l\246\327q\236\247\343M\017\203\246ar:ob\n\3149t\272\371\341\270n^X\244G\224\027\002\270H\361\223\026\265\271\007=h\201\022\230+\f"
+	.ascii	"3\003\3369dk\2508\354MT[ \005E\334vC\200p\031\345e\b\342r\231"
+	.ascii	"R\250="
+	.text
+	.section	.gnu.lto_isBatteryVoltageConfigured.67.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"E\007"
+	.string	"b\21635Pm\323\001\300\210\264\001\240\305Q \250Q\240\b\236\036\236\242\301\332\241\377`\311\240\331\210Y\017Vz\2707\307\314\fQN\367{\005\001i&t8h\023)S\n\306X0\213\272\256\213\002\214V\0253T\204\231\205\013\003\304X\021Z*\256\032(\013^UeAJ\247]Z\365\250\016h\272\331\217\323Uu\nmD6;\274#\006\354N \370\034\007=\370\031\177\206\300\362\334\237\217M\177\327\212\tH\313\221\335m\251\026\366\245\335]\253\307vZ3}I\240\242$\342c\2273\022-\311\013\371\330\326\330\024\033\034h\234\275\303\340\374\343\261\t\235\354vP/\236=3\377\033\177 \242\021\256#\361\004H\330]'\327\241\270\365\266\tl\027\330\326\b\b"
+	.ascii	"2\241c\037\030\302\004;T\241\3145z\t\221\303\2353\265\363\t"
+	.text
+	.section	.gnu.lto_getBatteryVoltage.68.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\035\007"
+	.string	"\262\31514Po\322\001\220\362\030\003"
+	.string	"\216\363\334?\020\301V\226L\246j\347\353P\334\032\272w\017\021YF\366\206\332\231\252\252b\254\366?\367DC\225 \206%\233H\231R\326`8\260\302\260\f\303\273\240um\252\353m\0322\016O\003\257\207)\260\365P\301\207Y\026|T\334K\253\"\353\001H'lC\234$\003\330]\005\177\3441\302\347\2703\247\223\327\356\374\216\006\210\200r\263\343'\025\303\276\264*\262\235N5\360P\221`\331\255\330F\233\342P:l{l\312\3778\210\307Y\306\r\213\351\304\204\242\244e7>\201\023Lw\371\201\351N5\236=3\377!\227VF\233\026\372</\013\273\353\324B\027\267\3366\202\355\004\333\031\001\t"
+	.ascii	"\002\013\255\262\030\207\"\036\031\002r\r\277\215\030Y\210<\334"
+	.ascii	"\025S;\311"
+	.text
+	.section	.gnu.lto_getLegacyBatteryVoltage.69.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\315\b"
+	.string	"6\221=70\345(\035\2465\230\203\242(L4\274\261 \2355!&\332[\003)_\357\357[\303\256\002\335 \006s{\273/\005\205\262 @\317 \203\264\341\370\271\321\366\336R\246\024-"
+	.string	","
+	.string	","
+	.string	"\260\004\345\304\202\331\335\342\300\013\340_\236"
+	.string	"\376\251\306\265\247\346?\344\317\003@\013*5zf\032v\327\211J]\334z\333\n\266\027l\277\004\333(5\303\276[U\331NCM;M\253\2463\323\317 \254XD*\273\025\255\230]y&\035\266E\266\306\3778\210\310Zn\033\026\001\357>\201\251\252.\305\204Q\312\226\257\251?\005\260\304I\264\200\335e\360G\276e>\307\237'By\324\237\037\202\177W\003\027\021R\266\354\356l(0\017\b\304q\210\031ve\037O\026?\017\034\210\330\301\262\2709\360\025\341\301\"\350\272\260\250\331\366nU\0055\201\244%;\205\002\252N\037\313\264\n\f"
+	.ascii	"2\241\347\037\230g\002BE\027\004\207f\214Cu\265k\342\372\b\235"
+	.ascii	"\205\310\303]1\265\223\f"
+	.text
+	.section	.gnu.lto_getBatteryVoltageLatest.70.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\035\007"
+	.string	"\262\31514Po\322\001#\333d1\206\023\177Ae\007\006G\200\225WS\372\343P\334\232\250\265\316\021Y\306E\005\2653UU\305X\355\177\356\211\206\252\341\003\221M\244L)\336d:\260\272.M\203\263\340\2638\225\3458\016\232\007\267\201\226\313\030\370AT\320]\357A\207\211\373iudE\b)\205\355\210\223`\001\273\273\340\217<J\370\035o\356x\362\331\233\357Q\001\221P\226\354\bJ\315\260?\255\216l\247S\017PV&Lv-J.\253\322N<l\177l\214\377q\220\217\261\214\034\027\024)\245\242\244e7\272\201\027Poy\002\352M7\216=1\377!\237X^H\231\b\364\004`\330]g&\302\270\365\266\023l+\330\326\b\t"
+	.ascii	"\002\013\255\262\030\207\"\036\031\002r\r\277\215\030Y\210<\334"
+	.ascii	"\025S;\311"
+	.text
+	.section	.gnu.lto_getBatteryCellCount.71.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375 \350}\006"
+	.string	"\"L-3Pm\222\016\247DX\250\344\253h\326\005\030\200\b\247Q\264\032{Kv\325\3765\373\017\247Eh\007bo\216\231\031\"\247\213\223\373\002\304\340\251\303\332'[\246g.\2337Y\026F\301U\217\2524S\3454\013\030\006\227y\225\273\bL5L\317Y\024\365\234%\3136\0216\202O{\370jt\343\272\027o8X\254\322\345T*a\013\230\370\340\311g\036l\024_J6\321\217c\033\360"
+	.string	"q\020\311\004\235\224\344\207\3241\372;o\371"
+	.string	"\241\363\325\314\002T\031\205@p\220df\256U\364*^\267\031\245`\230\214`!O\021 !3G,$\321[\377\202\337\340\217\b\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getBatteryAverageCellVoltage.72.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"-\t"
+	.string	"\326\021?8@\305(\035\365';\312\374\017|C\022g\"\220I\357\254S\312\211\336\005w\342\266\217xv\263\240\225\r\321\324.\035\303\314\360\314\r\b`\f\353\335\255\306'd\023)S\n/"
+	.string	","
+	.string	"/"
+	.string	"\336F\305u\322R2Y\355zQ\340\004\327a~\340:T\215w\317\316?\310\341\305\247b:\211\236X\303\356:M'\213[o[\301\366\202\375\200\266'J\315\260o\255\242l\2471MCM[VZ5\235\231\376\345`\305\322\245\354R|"
+	.string	"v\005\242p\330\016\331\030\337\343\037!w\031\371Y\325:\311K8\276\312\017\235\216&\2440\256\251/\005\260\366\221\356\262\273\f\276\310\275\b_uh\016\2247\035\372\240\353\360Z\220\n\031\345\027\336d$\266\354\363\3218Dn\3238O\306E\017G\323\211\233\215\213\031\003k\020\331\026?\232\266E\214\267\267VQ\230\"\214\224d\250\230\245\251P?\321A\n\016"
+	.ascii	"2\241\033(\260\365\005d'YN\025\337\232\354f,oe\346P\265\342\302"
+	.ascii	"\370\200\231\316\202\345\341Z1\t\223\f"
+	.text
+	.section	.gnu.lto_isAmperageConfigured.73.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"5\007"
+	.string	"\"\21624`k\323\001\323\212\031u\220\t\0370z&\024\343B\245\025\252v*\355+\333 5\007\243m\252\2750\261=E\020\200\354\356*\n\001\273A\356\210D\210\224)\005\276P.HYV\305\362\"\254\"\206\212\017\243PYx\027\030\037e\342\212\201\202\317\252*\370$\\\366h\325\243*\220\251f?NW\325)\244\351\320\334p\215\030\260\033q\340g\034\344\340[\\\362\303\225\337.\371\327t\351:\001\001e\331\331\234\226:a?Z\365\330Nk\246\037Y:\037X\267\273\351D\326C\342\370\330\316\330\022\027\030d\214\235\253\330\3743\242\t\205\354rO)\216=1\377\030O\320$66\016\304\023"
+	.string	"aw\235\033\247s\353m\017\330&\260}\021\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_getAmperage.74.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"%\007"
+	.string	"\002\21624Pm\323\001$\243*\252is\013\225\342\037k\244\232\215yE\221\013\0327\362\332\374\323\247-\271BA\3313\203$\212d\277\275\002\324J\212\312\252\2777\2212\245\316\\6\261\3020\f\003\274\242ui\252\013j\0320\0160\023/x!\260\365PE\210YV\204T\267\227VAV\213\246\037\333\020\017\311"
+	.string	"v\027\301\007y\027\341k\374y\303\311o\177>g\372K\r\370\320rdw\236\324\f\373\322*\310v:U\022Y\334\204d\367b\224\262%od\303v\307\246|\216wt\234)Hh\\\201\250bB\004ew\241\345\003\323\237t\201\351OC\317\236\231\177\217/|(N6\316\363\254$\354\256s\3430n\275m\003\333\007\266C\001\b"
+	.string	"\003\013\275\262\030\005\205"
+	.ascii	"]\303q#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_getAmperageLatest.75.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"5\007"
+	.string	"\022\01635Pm\323\001$\243\252\214\252\216\254\245\362\037\013\375>\236y\320\345h\2345\362\332\374\323\247-\271BA\3313\203$\212d\277\275\002\324J\212\013*Xo\"eJ\001\316\\6\261\3020\214\003\274\242ui\252\013j\0360\0200\023/x1\260\025QE\210YV\204T\267\227VEV\213\246\037\333\022\037\311\002vW\301\027y7\341o\374y\303\311o\177>g\372K\025\b\321rdw\236\324\013\373\322\252\310v:u"
+	.string	"\303\204;\250d74Z\331\224\207\302a\273cS\276\307?:\316\030(4\356\240#TA\242\262\273\320\362\202\351O:\301\364\247\031\317\236\231\177\2207|@'\033\347y\002,\354\256s\343,n\275m\004\333\t\2665\002\b"
+	.string	"\004\013\315\262\030\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_getMAhDrawn.76.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"5\007"
+	.string	"\022\01635Pm\323\001\244DX(\243\352\312\353f\024&\3612\032\353i\f\3258k\344\265\371\247O[r\205\202\262g\006I\024\311~{\005\250\225\024\027T\260\336D\312\224\002\316\\6\261\3020\214\003\274\242ui\252\013j\0360\0200\023/x1\260\025QE\210YV\204T\267\227VCV\213\246\037\333\022\037\311\002vW\301\027y7\341o\374y\303\311o\177>g\372K\025\b\321rdw\236\324\f\373\322j\310v:u@t\302\035\204\262k1ZY\223W\302a\273cS\276\307?:\316\030(4\356\240\003\243\202Dew\241\345\005\323\237t\202\351OE\317\236\231\177\2207|@)\033\347y\002,\354\256s\343.n\275m\004\333\t\2665\002\b"
+	.string	"\004\013\315\262\030\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.part.0.102.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\246\001\335\016"
+	.string	"\246\032_E"
+	.string	"\223\223\016p\340b\023\3755\n\361\334\231\"\342q\217 B#\311M<\277X\350\357\335\212\030\263\266\316XT\006\337H<\032\330\240D\017\366e\250\277\352\3732D\030\001\257\233\347a\203\f\024K>\331[\312\224\002G"
+	.string	"R"
+	.string	"H"
+	.string	"8v\277\222G\223`\217\007N\340z\204\037p=f\217_a\333\304\301'\273\307?\325~\006\247\205\246\265\273\332\243\232\370\351\232\360\344_\346\236\224\313\205k\210\213\207\247\200C\220\223\3355\366\341\216\267\235\3006\004;\003\004\273a'gI\304\233\0240LV9a\321\220\001\326\214\210\301\242\265\030\276\021\323\374E\311*\005>U\007\220\234\020<~\264v?\355\321\037\366\230\273\364\031\253\215Nv\277\205\311\227q\026c\372\267\222\f\026\005b\344\321\231\366Wwq\372\267b\317n\211\232\037\021\325\356.\360k\334\006hCA\271\036\223\225\362qM}\213\216\035:\r\n\330\356*\360e|\206\310?\361h.%\237z\364S\324\203b\251X\241r'\025\306\n\017W_\354+\rcZ\257t\306\3641\004(DDl\236\340=\330D!\007\244\321\326u\026@"
+	.string	"\f2)u\033\211\364\221\240y\035\347\2156O\033\205>\"\r\324y\232\211\001s\025\266N#q\\\247e\266\363p\365\305\rt\354@)\213U\025\3066,9+\207*\214\360\033\033\305Y\245\332&\371\215( \220\202\241+\233\003\377\006C\013\031\230\017\307\315\230\302`\\(\017\357\341\036mwBX\013n'\353\n7\315\214\256\355H\265'\331\236\211\3160\233p\253Q\2207\004\336\005\020\f\327\204y\031Z\203#\026\036%\030{\322=\323\205v\352\005m\227\205\005"
+	.ascii	"\344\305\357\224\232~\202\031\003"
+	.text
+	.section	.gnu.lto_batteryUpdateCurrentMeter.part.0.116.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\372\001U\021"
+	.string	"F\337oH\360\260(\035l_L\361P\030l:\214\f\345\366|\035\007rj\221\t\341\335\234i,\200\333\315\265B~\373_9]\377\032!\307h\333\277\2306\315F\251\310\\\222\037\324\255\232\255\270\363"
+	.string	"\374\265\273\032\006V\273\311\336)\005U"
+	.string	"["
+	.string	"^"
+	.ascii	"\207\371\b\326\313\022\007\330eq\241b\267\374x\365\202\356\325"
+	.ascii	"\343\005<\257\334;<\257\336\353A\330^\315l\323xY\333\337h0\261"
+	.ascii	"\335v\367{\245\035\316:\235\034\313\2372Z\353\364\266#P\311y"
+	.ascii	"\305\260\241e\370$p\016@hw\335\245\334\365\266\035\330f\331\223"
+	.ascii	"A51\356EF\213\020\267\205\355'\345\221+k4\017\306\315\205\225"
+	.ascii	"\333\353c\316\3317\3524\246:,n~\211\327\330\236S\247q\202\332"
+	.ascii	"\356z\251\351\213X\371$n\2637#\243\262\007\254\\\332lwm\031U"
+	.ascii	"\327\232u63^j\354n\203\3565f\365\262dFX\227\312\347\325s\332"
+	.ascii	"\001\034\3634\317)u\273.\234\257\260\340\277\274\232T\232\227"
+	.ascii	"\275\372%\217)\234\227\371\266O\200y\001\243\255I]L\271sK[l\372"
+	.ascii	"\2613`e\027\303\r\033\273\241\342|\370\314S\254L\022z\235\304"
+	.ascii	"\270\023\345\3077G\2012\t=\211\2718<\220A1I\271\355\226\337\253"
+	.ascii	"\313\356\035\036\023\036\271\r\016\t\001\215\"$\022\365\235B"
+	.ascii	"\223)\034\031 !\200\244\250\302\b\b9\212D\004\214 \240\211$\201"
+	.ascii	"<\201\242\210\032qx\004R\211 I\212(|\243\030\216'p\374N$\221"
+	.ascii	"\351\033\211\343\007:\340p\004\024?2\f\305\317;\267\264\305\223"
+	.ascii	"\276tl\257\246l\025\274:\324\232;\224\272\330\246\036Pj\226\262"
+	.ascii	"8, P\242\241\254\352\001\327W\r^\030y\354\220d\335\342\326\311"
+	.ascii	"^_\024\355<0&\214\007\375\343\310\2757\270*\336\003\024\036\033"
+	.ascii	"2\261\376v\031\355\034\302Q\3666\354oy\314\304<\300;\364\201"
+	.ascii	"\215\320\026\266!.\270\314^\357L\267X\007}\201\240\250\270\354"
+	.ascii	"\035\267VJ\355\362\005M\027\2335\330\306.5E\375\375\327\3161"
+	.text
+	.section	.gnu.lto_calculateVbatPidCompensation.part.0.119.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\362\002\025\026"
+	.string	"&i\215I\320\360(\035BRhUrl\034c\026\260\371\036\302\333jX8\356H\210\307\036?\023_\231\210kk\002\274\226\326\373\321\231\353\263\345\030\224\372\203\177\343`\226z\3501zL\001g\f\031\313\244\007c\320\037\024\t!\233\310\235Rt"
+	.string	"z"
+	.string	"w"
+	.string	"\027\362X\326\\\202++Og\363K\217\247\276\b#\2111:\0029\246\232\246Z\253\352\324\t\304\323\0205\235m\037\304\177l6\322W\372\360~#\212\246\250Wk%OK>"
+	.string	"<\375.\002\236\256\206\333\376\355\2446?\\}\037zL6\273\230\177\341\312\350\323fg\341\033\262\303}%\265\326\013}\336\354ns\n8\rW\265V\213\027n\360\266Sl\307\354E\020\3414H8\375\021N\213\340t\030N\203\3414\025\247\277pz\301\351I\247\037R\300d\251V\nQPu\207\252\350\360\240O]\305\225\252\243:bf\304\251*\333\264\261\007F\256\251wj\242\346\227\325\255f\346;\301\324\373\351U\\\251\"\361\0220~1P\372T\b\241rd8\365j-\311S\227\342E\354/\006\242\236_t#{4\355C>@\203f\230\017y\2341\256\037Ts\265\242\370.\376\242\201\003\025\025\3604\334\367\250\001Dw\027\334\347<\334f\224\277\245\373\\\323\367\333\221$\232\036sw?\036\271&\373\301Y\260\304Zq(\376\212'\265|\336\251]++\340\351\334"
+	.string	"-\212\236\200f\2555f\267\307n\001\277)\016C6ps\207}\024O\321\342\363\034\3415os\352\277\300\323\257\002\035DO923jn\217\227~uy\354T8=\006f9\221\261\314X/\322\005\366z\301Z#f\211\271$\260Z)"
+	.ascii	"\334:\241\305\\\263\031\013\002)\213\301d..\031\351\322\302z"
+	.ascii	"\221\255\230\214<!1l\202+F\316`\260\0309\332\236\377\352\362"
+	.ascii	"x\356\270/\0348\363KO\355\215\355\324^\350\307\321\311\020Cf"
+	.ascii	"o\336\177\037\310\216\013\346\270!}\203\316\322N\365\304\325"
+	.ascii	"*c\362\261 \353\231s\022\027\334\217\335\243\234R\270\342\222"
+	.ascii	"\034-\270\022\003\261\006= `\002!ve\033Ac<`E\034\022Ve\354A\273"
+	.ascii	"\372-\234\001\263@\360L\20704v5n]\241-@j\370h gw4v\306\237\361"
+	.ascii	"$\354h\236\302\323\333\364-\221\307#\034\207\355e\304\205X \345"
+	.ascii	"\230\232x\025\304\202\266\326\216\376\2628\022\262\261\266\270"
+	.ascii	"\211\374\266@\306\323\347\222\230k\351\314\276\245\356\362]\r"
+	.ascii	"\210@\003n.4\241/\302Z\322\202\272\316\035\355};\004C\246\260"
+	.ascii	"\336B\225\361\371\340q\353\265j\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\257\0045\022"
+	.string	"\226\033jH\260XQ:\f\364\374\360\216\235\374`\017\237\225\031W\020M\334\270W1\377\036(?h\034\312"
+	.string	"k\307\351\013\276\320\317\013\030>-\022\223\230\304\314\nA\320o\377[\374m\030\202\340\257_\372\377\267\341?\334hI\206\3342\005S"
+	.string	"V"
+	.string	"Y"
+	.ascii	"\247\321\f\224\275YC\3479\322G\263\226\354\266\"a`97\025\031"
+	.ascii	"sSk\366z\343\201\373\211\304\231\331`0x\305\300e\362\246\200"
+	.ascii	"\315m\262\346Ec\023\372h\3065@&\\[\307)C\023\332\026g\2577i\330"
+	.ascii	"\267\231Xh\313\234s\302^\223\266\303\030\001E#\210L\304\254#"
+	.ascii	"\n\013\261\260\302\035\204\302\rd\302\375C\302\355#\302\335\003"
+	.ascii	"\302\315\343\301\275\303\301\255\243\301\375cp\347Xp/I\005\307"
+	.ascii	"\311\240\337\022\3348\020\334J\022\310G\262\374\034H\372\374"
+	.ascii	"\247\247'\344\271\317\316yt\337\221\271\353$\356\271\233\211"
+	.ascii	"\204\266\232ZNT6Ua\202\244\243Z\365\321T2T\264XRS-l\366\262\372"
+	.ascii	"\323Q5\311)\351I\346\262\"n$!\356$ n#\037\356'\017w\221\016\267"
+	.ascii	"\020\0167\323\206{\210\206\333I\347\234vL0\303\255D1\334\204"
+	.ascii	"\366\211\"\236Q\t\242\0138\241-\304\023\"\301\0332\032\n\336"
+	.ascii	"\251\302\3002\005\350\362\332\235\350\332\240\226k_\332b\327"
+	.ascii	"j\023\265\322\2343\246\265;\225\001\b,\3527c-j\314\261Vt\242"
+	.ascii	"\232b\205\024$\035kw.^X\013`\274\25565\256\026\345SC\001\336"
+	.ascii	"x\201[\255\350[\255\200\237\246\242\330\230a\203Yq)\245Z\rM\250"
+	.ascii	"A\b\306R1\nRX\322\226\326\300\002\241\"\2426\021\200\024\314"
+	.ascii	"\021C\004\004\021\241\004\245\005z\340\272\231\b\277&\2078\357"
+	.ascii	"\022\351eJgh\374\017\322\224@\262H\030\374\355\210v\246\f<\227"
+	.ascii	"\354\263\314x\377\006[bc\321\215\240\317\240\363\350\313\345"
+	.ascii	"`N\333Pf1\241\363\263\343\244\235\001c\354\275vv\362h`\374l\312"
+	.ascii	"\215v\016lF\315\020\331\267\340\023\332\330\330\0264\304\330"
+	.ascii	"\262\206\315\227\325\264*8\004\254\3364\003\2271[\005\306\267"
+	.ascii	"m]\360(\020\030\355\376\216\262\250\002"
+	.text
+	.section	.gnu.lto_.refs.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`H\001e\013"
+	.string	"&\033G2Pi\223t\310\202z\033\3110333333333\316aI\326\030\240\"4\026\234r```\340\333\377\377'\337>i\324\326\266\266\033\331d\313\0243"
+	.string	"8"
+	.string	":"
+	.string	"un:%\373$\373\223\337\310w\2627\3313\273\312O\375\342L\343\207\366\006\365\f\367\226vJ\372I;\004\377\241\036\272\177\332\033|&=\336\267\017\3751\b\177 {Fv\f\325/\360-R\257\300\247`/\021\371\b\326+\370\024\326%\370\221\326[\233\370\n!\0237\321\347\335\352\356\2017\370eC\351\256{:\343hr\364\336\r<;wLv\245:\246\236\332\217\365:eX\337e\313\335v\245w\322\233'\351_\260P\341~\n\216\376\004\366K\210\376\b\252\017\341\001\353;h\375\006\355\013\360\025\340'\270Gp\001\033\270\214\303\303H\027\026\275\353\002\025=\261\t\034\305"
+	.string	"\001\001"
+	.string	"t\242\247\323U{\354\022\351\325\372\323\272b\021\371\005\277\341G\367\314\202`.\376\320\241u?\353\322\241\243C\003s\264n\326\032\036"
+	.ascii	" D\312\231\245\272\324,\236x1 \222\272\323\\\215\245H\3634\210"
+	.ascii	"/\350\225\326\331C\355\002\263\265$\367\n\3046\201\333-\031\273"
+	.ascii	"H.K]\215\335\007\331\345>s\231\306D\031\256\242f1d\255(\231\252"
+	.ascii	",\030\261c\341\216[\034\005"
+	.text
+	.section	.gnu.lto_.decls.c25a2281923b7824,"e",@progbits
+	.string	"(\265/\375`\n7=\336"
+	.ascii	"\272J\351HU \016!\235t\252?g\327&\333\237[\327d\354\356\377\277"
+	.ascii	"\247x\025\366%\006Qfe\325?\031\251\251\035\212\321\276\377\037"
+	.ascii	"\333\250:9\007w\201\3672P\350\224\360\366\3259\032\327\036s\016"
+	.ascii	"\017.\354\341\322O\224}\347\035\275KK\232cl\352\2575\252\261"
+	.ascii	"\275\245L\001\263\003{\004\276\004|X\202eR\277*M\265n\34215q"
+	.ascii	"L)\335\304Y\230o\007\231^\251\232 Z|X\035\370t@\223d\013\253"
+	.ascii	"\213\003\333\2279\b5\250a\316W*\347\253\335\371jv\276j\235\257"
+	.ascii	"T_\030\214\016\263\306\037\234\231/X\270\013G\005\2720vwry\253"
+	.ascii	"\235o!\347\273\353|K\235#t9\317}\347\335\222\234\257\033r\236"
+	.ascii	"\311^\347\257La&\247\037x\257\"\325\356\231\316\231!g\310\264"
+	.ascii	"=s\235\347\017B\036\344\017\3023\215\263\247\311\034\360>\360"
+	.ascii	"\244UQ]Q\240\354\3448\202%\255m\023~\302N8e(\274\344\314\204"
+	.ascii	"\357\336\351\275L\367\336s\334\034\333\355\320\334\253\025e\t"
+	.ascii	"\002Ca%l\267\223L\257\262\004(.\364\316j?\320\377A\b\f\205\221"
+	.ascii	"\360\233\207\245{\261ld\260\027\246\215L\360\336\324\247"
+	.string	"\203\016:\2505\332\356\226\247%\301\034\204B\021\234Wq2\035'\341\024\004\327\235\3458\3564\311\364\246\367\246<\355e\346m\255\355+p\236A\b\353\340 \203\020\376\001g\363\006a\017s\020\362[\263\033\303\235\337\270\355\037\204\360\034\246{vo\312o\366\336$\363\006;\314\033\320\334\275\220\\\023\3323\340\374\317\t\342dZ\022w\326\366g\266\237\211\360\031\257\325\247\030Z\327\355\3364\003\315Z\024\263d[.\302h\234\246\261\332\255\232\326e\2737\325\251\311*)I\332j\300\034\204\326\310y\370n\b\357\363\374#\344\341\037\341S\346 <y\203\260\033\0055\335A\237\300\214O\233 \303\337\200mR??\340\210\t\027M$Z\316_[p\326\302L\t\005c\027\376\325(\354\374+Q\222\333\020\002 0\320C\027\300_U\370\031\331$\b\2544\007\350\237\021\374\357\322-\350\020\\\203\277\305\374\275A\347\200\240"
+	.string	"\035\204\232\027\361\327\t\374\234\325\037\360\240\001?k\375\355\201\277;\360w\n\177\253\370;\305\337\031\370\033\205\277-\3607\212\277'\360\037\347\257'n\204`\005t\373W\017\372\204\3774\177\005Q\324&\324\021@\371h\0238\bx\006\177\375@\207\024\032\002\215w\016\177\257\005\300\247\033\300\323$\364"
+	.string	"\030\320\304#\334I/\240\211\220\317\377\024\376#"
+	.ascii	"D\213\360w\211\203\360\327\r\177\323|\320@\377\325~\363\367\336"
+	.ascii	"\317,4\211\377{T\376\3360\342o\237\026\341\301\317%P\300=\374"
+	.ascii	"\235\345g\341\3177?\363\3179?\327\374\037"
+	.string	"\374\271\376L\3633\316\317\347\317:?\333\374\274\3633\317\317\375\263\223\377\201\377\233\307\340\257`?\207\371\331\314\317e~\036\363\263\340\317d~\036\f\361\263\337\317`~\376\322\035\374\347\371-\377\235\200\277\017\360w\001\376\336\340o\002\374-\200\277;\374\215\301\337:\177\013\377\356\277\377\363\223\237\333~>\362\363\332\317\351\317h?\237\375l\366s\331\317c?\207\375\274\374\031\310\317_?\377\3709\3713\217\237Y\3603\327\317:~\316\361\363\215\237\255~\256\372Y\306\317Q?C\375\374\342g\027?+\375\334\364\363\322\317.\370\271\305\317)\370\271\370s\322\317G?\033\375L\374\231\350g\364g\241\237\207?3\340g\024?\213\340\347\020\374\374\201\237=\360\263\001~>\300\177\267\237;\360\263\n\377\353~\276\300\317\032\370\031\003?W\340g\n\374\034\201\2371\370\331\204\377*~.\3613\b?\213\370\031\304\317\b\370y"
+	.string	"?\177\370\331\303\317\031~\356\371\037\345?\224\377l\377\327\376\213\340?\336\177\016\006\007\007\007\377\233\021~\033\254\337"
+	.string	"\006\b5\231\304\306\312Ki\345\274\315\032\2316C\246\317\234)S\246\303\222e\212%F\260\264\275\215\217\3636Og\213\351\035\255v\251n\\ y\234\t\336k\025B\007\314\354\310\322\225\300\006\023\330a\204\367r\252%\245\f\363\345Kk9\221\367\372\030QZ\375\330<\225\t!\263\344\374I\326\245\013X\363\374q6\233\275W\342\256yN!I\031I?\251O7\311\245"
+	.ascii	"0\255,YZK\bSZ\035\303[\313\316\331]SL\333\177i\032\377m\202\356"
+	.ascii	"~\b\266\375y\377\376\330\356\347&\221?`J@1\301\232\24692`\177"
+	.ascii	"V\316i[\351&<uo\322F\t\262\245U\210\232)d\200pL\374\322\366c"
+	.ascii	"\273\024\247\323\332S\363*\237\204\240\361\3421V\205\326\327"
+	.ascii	"\327"
+	.string	"LP\334$U\ta7\r\361\032\260\363\255\327S\336\314\277\231\275\307b\254\224?\377\277l\311\271\036h\370\304\200\324\3248/\274I\345\275\227\212&\275\312\245\034!\3230\377\374:\\\231\203[\377\017 \003\367\"\003\313\002\317\260$I\034m\357\317\274\227i\013\t\201\255)\246\255\032Ol[\027\311\004\004\231Ay\267\220Ol\367f\270LL\310\023\264n\206'\266;u\233\370\246\370\246[\310\313\244u3\\\246\233\324\340\211ik\352\211-9\225\341\211mk\352\262m\335\236\313\224T\276`\272\312\f\227m\213\313e\323\232\352yb\323\232zb\333\312\301[\236\302\234\231\002,\343\322c\035OL\267\205\250\253\244\262\207\371\224j\335+\367\262\233\323Urp\357\225\226\362J\262\006\327-1[X\222Kjqz\357\355\020\265\304\245u\231\230ObZ\367\212-\261\270Q%\220)\363\372`&\262\353\352\306p\2727"
+	.string	"Q\367\"\3712\357\275\310{o\215\362*\275\367F\317\3232*\352^+\237\250{\205\264s\272\267\335\260\324M=\261qi\001\331!a[^\027)\222\227\367\312\226\362dC\246\335\030^\316\345\224\214.m\323\035\341\330\227\013\273\266x6U\274\344p\373;\311\300x\220i\233\302\335\310\343\341\304\355\006\354\307\026[\223\263\357\270\213y\025\207\344\354%8xJ\304\006\311\352\332\016p\216\311XW\235\3349m\271\246\353\236{\271\242\226=W\235`p\231\265\275\220\306y\341S\334\333M\234\223\324\255\355\234v[\277\325\247{\251J"
+	.string	"K\001\305\004\257R\031\302\315\347\\\336\260\312\302;OC\327G\272\006\224\020\252\266\247Ik\2665#6)S)\325\366 \234\321\235\215\265\331\216\315\275[O\226jF\232H\233\325\370hf\251\022\274\367\246u\332j\234\266\221.\362Fc?\213\325\f\362\342\264943\316\323@\235\267e\316&\3532N\177\327C|8A\372\b<UP\363;\341m\026\030\270\210\205\251-\371\276\332\276\303\376\006k!\r$G\353^&\232\300\027Q\202m\373\2077\b9\r\350\275\264]`\244\204\004\001\302W\2269\362\200\274@d\306\216\257\364\314\306\216\f\f4\332\366\217\366z\177\265\217\333_%\264\356M\366\027O\231{\223<\314\0330o`\315\270\202\300\t\355m\225\036_x\354`\301\312\n\255\355{G\273\300Z\027"
+	.ascii	";2\216\224\335h\333[\315\305i\207\356\342.=\226\246\364N\027"
+	.ascii	"\334\313\035\204<8\310\035\204\255\005\364\326\261A\250\264J"
+	.ascii	"yJ\360\3522k[yCV\207\0322\273\254\035X?:b\252,\225\345\270\312"
+	.ascii	")\302\203\254\253-\216\266\32178\355\253\266\272M\357\275j\031"
+	.ascii	"M\243\246"
+	.ascii	")\317\2665\033 \324\340\267\232.k\220pI5C\370\201\256\272*\354"
+	.ascii	"\362a\t\177\034\351\"s\332\333\270\363v\355\274-;\177z\206\r"
+	.ascii	"Sz\331r\222Ut{mo\203\234\267.\234\177S\275\325\020i\302\345\326"
+	.ascii	"S\335t\323v\346\312W[2R\226@b p6\245\t\024\310a\254\\a;f\366"
+	.ascii	"\270V\252\216\017\253\fp\256\256\217\n\363\001\001\t\226`v\245"
+	.ascii	"\331M\334d/;L\351\235\332\231K\377\2600\337N\275\027\213\314"
+	.ascii	"2O\217\371\220\\J\200)\357\266\360\0333\255n\005\274|Xe\367\246"
+	.ascii	".\032\252\223\035\325O}\233\251\235:F\277\350\026\032FK5\262"
+	.ascii	"\225\275\304i7\261\231\363\031\036\274\215A\013\277\t\203(\003"
+	.ascii	"\\\366\253\311`\2322\320\253>\221\252z\022\244-\017\036\326\307"
+	.ascii	"\230e\r\013\223\244I\217[\037\fw\255\276\314\204\177b:4<\271"
+	.ascii	"\340\202\215Zf\251\342\231\"\005\303*\220\213\253\367\336\\\350"
+	.ascii	"\235\315k%\213\251CG\357=@\331\327\003\355I.G\016\233\005\244"
+	.ascii	"\346\365\244\352pr\005\003\3536\213\206\210\222\264\006\363q"
+	.ascii	"\201\211!C\025\016\034\275\007\267\024\242\361h.\007\253\252"
+	.ascii	"\254\r\356I\227\372\342\226\025\006\033R\\X\335\3328\177\364"
+	.ascii	"\361\271\320\326\326h%\374\304H\017\271,R\227\2623|\264j\237"
+	.ascii	"\021\027z8^PK]2ng\350\300i\031\243\2520\300\354\272\250\246t"
+	.ascii	"\340\260\246\372\224=g\305\230l\311)y\311\233\0272nP\236\236"
+	.ascii	"l\224\003\232Y\252\312\332\006\221U1n\243\332\217\351\367\305"
+	.ascii	"Bq\245KL(\013\303&\210\025>\"n\327f\360\313\330\235}\321E\204"
+	.ascii	"P\212d\361\265\235g\262L\326\311gH\222\013\355\247ox\321\373"
+	.ascii	"a\233n\235n\3168q\211k$$\260x\001\351q\3766i\223\335\004E\226"
+	.ascii	":\233\251\346\245\242\021\345\265/\212\275@K79\204\004\331\222"
+	.ascii	"F\260n\357K\333\301\226\363\302\245\347\351<\237Q\251U\262X\251"
+	.ascii	"~gX\260\324\030\306\2464\257T\277\035d\206{\273\376\226\202\365"
+	.ascii	"L5S\311T1\265\f\247uL\325r\237:\246\376\235\031S\267T0\314\264"
+	.ascii	"\352\271Lt\200\315{\357\r\214-f\216\035K\345Z<,=\241@\323\362"
+	.ascii	"\245\206\341\264\202\271\017\020\230\nX\003\231i\225^*\234\271"
+	.ascii	"\275\301'\035:\320\351B\345\n\016a`\365\"\227\362\360\322\266"
+	.ascii	"v\251\261\252\201\327t\245\311i\345\362-\347\2272\273/\327\202"
+	.ascii	"\343\344\007\227\337y\236)\347y\224\324,\247_3\207\236\334y\036"
+	.ascii	"\267\363<k\347y\210\234\347\031\253R\375\330\242\004\352\371"
+	.ascii	"1_\367I\211\261$\344\254\314\312\307cV\267#n\017\003?\246\304"
+	.ascii	"\265\265S\032/\3102Jo\347\n\220\267*\205&n0\320F\333\232w:\361"
+	.ascii	"t\201\270\311A\227\205\243\355k\336_\341\270o\005\203f\302\264"
+	.ascii	"m4\240W<\034\275&M#Qo\257N\352[}\202\302\352R\225@V\007(&\310"
+	.ascii	"f`l\321\3216\2651\203\302\364k[\227\324\273\332\344\267\261Y"
+	.ascii	"\022\243\357\252\351|er\323\203\357\005\030\3326\377NX\355^\225"
+	.ascii	"\37465gJ\246\267\266\347\271\347k\222Z"
+	.string	"\367\333T3yK^\b\236\257t/\310\242cH\333:w:\355\374\201\260\301\242\246\245\316\375U\216\363\372\253\004\035\003\207\025`\333\035\336 \254p@\257q\035\304\r\017\257\255\316N\\[\333U}\021\303\222=#G\216\3245\233\022\300\244\226>\230\300myAM\255\256\265\326\275\327\351\252\200\n\030\024MJ\206\327\266\326f\302&\264\036Ct\244\351 \023PL\320f\b\231\214\245\266\337\211\201\206&\246i\323%,\214\021\300\263\263\372#H\f\315\263I\r?\"xffS\204b7\236`\255\225\225\3251\300(~~W\230^0\300P\3074\334\213$\311\\3D\231\227\2731\273\033\2574'\035m\257c\343\024\"\244\206\241\270\034\304\334\336\321d\252*\214\337\300\302\270b\234Y.9\314\005\024+\273\031\242c\306\030,'\020 \255\345mN\305\331`_\223\372U\277B\240\301\314)\253>\252\217\372\303\346"
+	.string	"^l\276p\220\335\037\314\207\3637U\2263\343|\355\342\272\303L\345\321y\366\272\335$U\bw\313\234\245\3638\315\363\334yB.\256\336s@\234U\223\007\351\224\254\243r\236\207p\315\342\264fU\035\032\224\026\200z\321\274\312\253\020=\330\002\336\262j\345"
+	.ascii	"\002aNI\255\236\346\320\352\256\256j\016\r\367\266\305A\345t"
+	.ascii	"\305X\202\314\001\244\336\305\240\0234\273q\243\214p\f\314]\331"
+	.ascii	"\016+\253Z\205\242\347.\375\001.\325\240\330\360\252\242"
+	.string	"A\243Vi\270Z\367.k\340^`i\212\261qYR\325Lx\226\220\221R\325\3668NU\252JU\031^<\300Qw\365c\363r\354\r\221Q\251:\224\375\335\246\252S82^\230\031q\222\362\2641\303\334h\253l\253\034.N\262\\t\211\212z\201\034c\302\003f,\207\027\022\250\n\025\246\274\201\341|\361\242\367\316\353#E\007K\217\311F\226\013\027\314\307jW\352\306\305\324\223\020\326\f`\025\0374\232\322\332\304|\334\344@\214*\331\3667L\365\326\245zk\022\001\025Y\2215\211\342\303\224f\315*3S\244m+ntX\034\207FG\304a\361h,\"\036\225F\034!\031\031!\t\005\340\003\020\222\214\204h\216C\023z\320\242\025\214D\236\023'\230\030!\264\302\b\251(\001\264\210\270\002\251\230b\210\230\002%:\032\262\020\372\300\302\210\026Wd04D7p\342\004\023\0332d8\013\021#\220\210"
+	.string	"\020\266HB:\241\341\2304\202(i\203\320\221\222\004\216\250\021\347hE\323\030\203r\216AGDI4GDI\025]\001\321h\215F\264844\254i\221\204$d\213\307\244z\235\026\305\243\221H\204n h\b=\"\"\026\rk\206P\243\222\025B\2155\037\036\207C\307 \242$\021;AIFh\nG\324\210n\200(\351\303\0052\034Q\"\034\023F\"\013&<l"
+	.string	"@\013\241!\021\n\200\fChQ\311H\f\200\321\2508,2a\374@\034\032\241\033\350!!b\b\025\"\262PDU\034\215C\rG\342\021\005p\214\033\210\216\210\305\243\n\016&\034Q\"\036\024\216(\321\206\263\020!\024t\244T\034!\264\202"
+	.string	"F\242a\221\004\210\216\210F\305!N\017*\224\302\306\303\320x\204&\031!\235\030\"\2468\016W(R\022*\032\n\025\240\303\t\r\316B\304\210\241\"\242\322\n\035\210\224V@\207hH\2108\026\207I\"\004\220c\202\222\317\t\016\240\320S4\024\"\036\211\305\f\214T`\300\201\003\350q8\224\244B\207\013\021\213\350\021Jt\276\204\b\036\2100\202\nj>\002\t$H !\374\b$"
+	.string	"\001\221 \002\320y\021\200\352\361\030\204\036\207G\025;h\320\211\023L\2508\346\\\350\230\203\006\241CH\027(\242I(\272B\316Y\210\3309\217F\3648D\001%\032\026\321$\243\341\3161\350\003\020\216R0,\236\300\302\204\321Y\034\262\020\2625\306 \rCh\321\n\303#\264&\351\346\030dT\0015\"\036O\324\210\230\302\2618<\032m\316\302\030DD\\q\204\244\202\341\021\321HC\n28\036\241F\264\230tD:\352 \304B\221\016\032\244\001\r\302"
+	.ascii	"\025**!\2518\036\241\305\242\222\220\206\026G\242\3200ix\202"
+	.ascii	"\34784\201\003\250Q"
+	.string	"I\307x,\242E&N\240F%\f\216P\241\"\232\202\350\210xT\034v\340\b\211xL2R2\036!\ty0\022\215\306\026,v\212\212P\241\242\"\245\025\033\216GJH'\212\212\320\023&\240BE\244\025\034X\3209\006\215P3\204D,\242)V$\241p\034\256@\3249\013\021\037\216\224\204\026G\034\221\220\212#p\214AE\364\210^\200\205\235\363\030$\002\320\361\210\250t\016\241E\364XD\\q\244tS\204\204dB\020\315\212\025HG\245\023(\321\360X\204\304\201\024 \025\365\034\b\350\204\006*``\002\247\220\210\026E\364x\034\2560\302XD2\036\241\306\021G\304\241\321\b\241\242q\204\b\017\327\242\305r)\201\247\244y\313%\3119\266\246\305\256\255\005|\2224\027\354\266<\t\017]\332\025\257$0\320\r\201\233\221\262\345`\201\233\362\245J\025\213\345\032\222\367f\215"
+	.string	"\226\362aY,\366\317\026A\256!\377\256\324ly\261\221\305J\337\245<e\324\330\374\254\260\031\206BWw\244\35578\235L\246\245\242"
+	.string	"(B\310\306\372n\251\3349\305\020\310\327\326\362\375\356$\363f\204J[\273\367\273\032<=\256\254\337Y\032vD\244\354M\251I\03547\253<=\0375\214\023%NR\362\336\2660\241\362\316\340\331\250\212\224\223\302\213\242\003'FY\036\323B\261O\310\322\272\234\332\336jY'\326\005,,Ym}\344\200n\233\324\272&Ne\356\230\004M\201\371\265\275e\362U\0023/@Mik\225"
+	.string	"\335.\031\300\334\235]\333\032;[\227\366\004\306\326\3756\t\377\375\240!cJ[\033\"@\267t<}I\276"
+	.ascii	"\231\263rUMiVN\347JH\027\034\320m\034\215\r<\035^mq\336\254\033"
+	.ascii	"\216\025$yo\326\355\267Hl[\177\225\200N\312\221\035m\177\230"
+	.ascii	"\203\220\306\036a\303\221v\206\231\272\351\320QI\203[k-g\272"
+	.ascii	"\034\261\263j?\200\244J\232\332\026)bSVv)a\210\222\261+\301k"
+	.ascii	"5\343\347\267FnS\2467\253\267\266\026\255\363\336w\003\213\225"
+	.ascii	"<=\2512c\322\263~\302\323B\027\224\027\021\266\023\326h\"\023"
+	.ascii	"g\226%\030\305\357E[))/\255\266)N\035\326\333\214\266v\314\216"
+	.ascii	"\3250\024\310\0200\001\305"
+	.string	"\312\202X1+V\303l\256\222\004\236RCV\230u\272AB\226\305MH39\347\330\376`\200\205Y\332\0319V\304\214I\013\322t:H\240\274\264\200X\0334\344p\360\260/\354\3317\033=\002\204\345\250\263S\244\201 \356\2402\f\215\214\224&I\322\030\003\025@ PT&\233\217\207-\037\023\300\323\207C\262\022\206\241QnF$IIR\332\030\0036\022t\300R\007\352{\201z\177\316\210U\005\260\237\232Z\274\2268\016\236!\341\005\222\203p\274\301yo\272\323uB\210\202%\221}?03\321\317f\375}\324c\026\302\276\345\027p?\177\222Z\017i\261]V(ST)\245\352\tB\335\352\225\031)\020\002\303\300;\253\001\246\247\363\034u4\004\371zB\313z\215\264\322&/\2408\027\210\207\351\271\340\202f\225@\334i\355\f\374A\322\013\274;\277v\327\024\204\326\326\352mx\266\375\352\025C\245"
+	.ascii	"\220\260bf?\276\001Yi:'\tq\370\004\n\307\314:d\221\304\357ew"
+	.ascii	"*\017\307\030V\257\320|%5\027!\225\306\027\256[\230&\b\027\024"
+	.ascii	"\374\032s\202X\235QD\330m=\277Y\365y.\276h%F@\021\367\371\034"
+	.ascii	"@fY\t\310\274<\tN\007w\343\b\rZ\262\374n+7\022\372\362\313\004"
+	.ascii	"\353\265\320\261d\323!\177\250N~\373'\320\225#\023\330\327\360"
+	.ascii	"K\0043\346\n\216\r\230\255\234\373\371\002\255\376P\027\371\265"
+	.ascii	"^-\373V\301\006`\226\b\234\302AT\310TH>!\222\0378\034W\220\372"
+	.ascii	"rg\r9f\257\243x\245\216\343\025s\020\204xe\022\330\371\226g\376"
+	.ascii	"\001\272\320\\\215\360\212\351\264\005\004L&\f\207\232\234\201"
+	.ascii	" Wc\362b\244\335\273JK\370\247\326D>\321ka@\267\207B&0\320\305"
+	.ascii	"~\021*\021\261\221\222.\n\362:\204\270\216\347\206\013x\252\361"
+	.ascii	"d\013"
+	.string	"uk\307\250,\234\227\225\033N|\024\222\002\274\276\364,s*2\\9hR\006\001\332\222\255\234v\344\211%\203\232\373i\340\217\251\275\225\354\220\242@\237CA\227\211\026Q\210\006\"\341s(\364u\033p\002\332J3\375\007\\9bA\025\030,\314\324\347X\031y\034\"E/ \300\272O:\375{A\317A\n\013\234\223\263\214\003.\002\206\322R\210\221@O\037D\246\252\375\356)\324\337\244\267h~\b_\336]\303\233\037#\246TK\031Fe=E\253\024\027\250l\"\316\347\257{\330\f%\201\227\303\216)\"\2501 \210\034\317v9\377\004\352]A=\f2\224\030\024+m\201A,\3407\257y\371\217\345lq\344\327\254Zt\346\002\030\375\036\252\006k=\033\242g\241\005\322\272\220^\027\227\304\210\217\b\031\204\007\255\371\002\300E\360\364\3668\017z\022\212\237\205\361\364\226\237\300\244u\357\316 'w\355r"
+	.ascii	"8\201\215b\303(\262\023\003\315\276\237\250\031`3]k\t$\341\206"
+	.ascii	"\376\003B\005\223\310\003\030B\344\256\221\265 !\244\031+\310"
+	.ascii	"\223\316\301\321\274\221\357|J\222-z$H\330\270K\037@\242q\343"
+	.ascii	"\b\2439vi\034Q=\n\310V\230-\253 \317\035\2605\335:\311\226S\350"
+	.ascii	"\"c\312\263[\272\212\204yM\376\013\327M\206\357a \256#3\370r"
+	.ascii	"\223/\327\330*\013\323jh\021;N\330@"
+	.string	"4\n\034\355\327\273d_\257t\202\023\016\264\232t\311\313\261\351\266\251\232\325@\311\007j\254\002\f\274\277\003\t\316ia\25107\233\253\b\315\034\243k\033\\\254A\304\253\252x0E\340\222\347\335\001\235\234d\3312\316\030\264g\333|\214\250X=\352$\313\3043\321a\377\363u\t\314\247\016W\317\031\034%t\036\347\233\264\033iU;-X\276\300\237Hg\244\353\376\274M:\225\240\005[%\n\331]s\360\272\023\307\343\343\"\364\026\210\300f_\bJ$\230\260\267\331\256,G7 \231\257\205\243\364\325\3111\303\272\365\025\270\235\002\213q\367\034N\356N\365\314\033B\216|?\343\341\311Dgn\033\037\250\242\363\034+P:\235m\213\n\316\"\204\203\230\263\245\324\3136*X\372\021\n\306\342\350\327\253\024Cy\254X\325D\002\360\026R\222\353\240&%[\237<2\242.\333P\023$\264\236w{\372\2218%7"
+	.string	"\354\177\237\251\301\350<\001{\270`p\245\244\214o\034\262\020V\245\331\234!EMz\n\027\246\004\341s\3174+\221\317\301\200\035h\262\361_d-^\211\007\366\b\300:\2255\337\205\003\303\2009\034?\212\243\020\227q\235P\316\221#Hy\207;\233\260\027;\250\346\343kf:Z\204\273N\351p\212\213\314:\200M\342`?[\\\311"
+	.string	"A\nw\225\231m\004\252h\263|,#\217\003MI\235&\265\213\005Pl\t\025LY\256\253\273\251"
+	.string	"y\370\304+B\271:*\244\213U\264Iz\373\031\356\304\376"
+	.ascii	"\330G\250b\021{^\326)\306\236M\fM\351'\341\001\237\022b\037\256"
+	.ascii	"\2747\277\331\036*y\002\306\316\241\261\331\367\263\340\322o"
+	.ascii	"\234F\315\347\277;\253\223\223\004Un\302\031O\t\257Uy\214\205"
+	.ascii	"4\341\270\305\005X\033n;N\377,f@\227"
+	.string	"\f`\2459\276f[\221\221\251\002\377\211\\_\270w\215\305\305\005D5o\220)\252*W\323\345I\233\253\344*\270s+\210g\032\354\034\245\020\0217\036\247\023\315\240\201<\347`I^\266\367\302Cf\202g\325\240~\212\362\\\352\201\023"
+	.string	"\"\376'\326\273\300M\313\255\263\324B\222\241\310\260Q\026\216~\271\252\365y\233\254g\364\305g\365\346:\315:\335K\263\345F\331\324\"\321]\t\367%7\242\301\tx\212\305\250\226\030*PK\266A\205\271\317\207\322\311\324E\340v\234\006\272\006!\266\244\034\353e\246\305\347\364\272K\3005\364<\234s\263\037\347J\327\302O:FZw\"\267wi\322\254\350\200\270R\035\236\310@2\216\317(2\027L\212&_\334\240"
+	.ascii	"\274&\266*\327\370\003\351\371\\hw*\266\233\357\365&{\264\276"
+	.ascii	"\323\307\b\016@D\203\220\027\263\246PG6*d\013\231\020%\272\212"
+	.ascii	"\316\274%>\207.\263\324CuZ^,\337\300fG\223\244\372E\t\021B0\201"
+	.ascii	"\007\223\037\305\230\211\026\\\244\277\377Yg\321?\200\002\365"
+	.ascii	"Od\002\320\377\305\006\350\203\314\373\275\322W\250\211\220\303"
+	.ascii	"\367\241c-\232\262\002\222\200\362j\337\245\325\325\334\t(\214"
+	.ascii	"\325\332\275\026\026\330\311\t6MB\2422\032\273\033\021\246\323"
+	.ascii	"LjHgk\340\343u\213\341\327\347\006@\305tGP\030/<\201\213\261"
+	.ascii	"z\333D\270\021{\263\f\310\276\263@\231\320\f\201\272\035\306"
+	.ascii	"AH\367S\376\311>\312_\030$\n\324\257>\353m\205\020\265\372\361"
+	.ascii	"\201\177\216n\326#'BJ\b4*\252\222\214\003^\342(\216\3070D\346"
+	.ascii	"i\275\233\315\013)\236\221\030\026\267f-:\225\372\322\314\366"
+	.ascii	"\245\352\230\026\t\277\204\302\373\311\251zcf\256UesLU<+\354"
+	.ascii	"\004c\001@\024\271\200\367;\351\024\304\017/\003\234\276N8qA"
+	.ascii	"\0138\377%;\006\260\216n1A#\316\210B|P\310\037?\244\3342r\220"
+	.ascii	"(\375\351\254,\r\036\021\226\241E9B<\3063\002\273J\325\360t\021"
+	.ascii	"S\036g.\273EC\244\253\t\347\366\220\034\323\\\f}\201\350\332"
+	.ascii	"\250\230Z\330/\001\026\210\322\205\224\313\233g\201h\211B[\276"
+	.ascii	"$\017+'\276\300\212>\021\324\223\307\250$\033G\314\272\341W\311"
+	.ascii	"\262\207\301j\323_\305\343\314\225\376\306\364'x.c\242\345\317"
+	.ascii	"\346\321\231\r\210\231\b\226\2368\277\304p|\3252{Z\037n\316\317"
+	.ascii	"*;\214`N\343\365\013\354\275\273\373\035\030K\260\331\262 \336"
+	.ascii	"\013\307\346\245\216+\016\354\2418?O\353\214\270\007\026\337"
+	.ascii	"\337\334<\274\f/U%=\213r%\337\205V6\031&\0164^\026M1\320\013"
+	.ascii	"C\033i\273p rb\341\341;\367\324\225\237\266QK\236\212\217@{\202"
+	.ascii	"\371$V\206\"\f\375\360\243\312\276BN\246\374\206\373\242\376"
+	.ascii	"\260\334UY\027<\253\271.\260\350M7\217\347/L|\320\225A\206\267"
+	.ascii	")c\337\223\333\357\032o\024o\"kHg\307\250\330\217\214\345|\023"
+	.ascii	"0=l\313\334\023.Kh\223\035<&\233\304o\367\355\306\363\1778\270"
+	.ascii	"\320\315D\303\003\233\233\023H\267\306\260\234\212\233\f\374"
+	.ascii	"\336g\225\372u%X\373\340F\375s\026\314;\r_\363\3024S3\260a\220"
+	.ascii	"\323B\323\253\310\020\352\346\327xn\3274\005zde9\264\262h\317"
+	.ascii	"\333d\256\2133\002d\212\362S\373p\357\r\320\377\016\330!<\202"
+	.ascii	"\374\236\017+\313\311\352\024~\032n\225\037\005\346\375\311c"
+	.ascii	"\366\267 \336\314E\201\371\037\343\b\334\007mo\350)\376\267\363"
+	.ascii	"5=\213y\2269\325\333\257\030\2222\304\260\320\331)\037\351\256"
+	.ascii	"x\316\333\315\245\001\036\306C\313\316\341\267\006\254\372\330"
+	.ascii	"\227\317P\231\3469\232<wt`\362D\313\261\336U\002\007\246/\203"
+	.ascii	"\177\257h\353\273\272\273;q~\0363\355\r\251]\007\237\004\237"
+	.ascii	"\006\375\220{l\360i\343\321\262\3610\365I\336\331\204\270\242"
+	.ascii	"\354\375\266&<\366]\022\305\367\361,\331\217\257l\031\370S\207"
+	.ascii	".L\377\276\017\344\366w\276\273;\023/\335\256c\331\270$6~f\260"
+	.ascii	"!\266;\351~b\327\213\331BS?{9\300\223>\017\031fW<\fXu\003"
+	.text
+	.section	.gnu.lto_.symtab.c25a2281923b7824,"e",@progbits
+	.string	"batteryWarningVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"batteryCriticalVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"batteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"getLowVoltageCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"getVoltageState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"getConsumptionState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"batteryStateStrings"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"calculateVbatPidCompensation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"calculateBatteryPercentageRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"isBatteryVoltageConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"getLegacyBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"getBatteryAverageCellVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"isAmperageConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"pgResetTemplate_batteryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"batteryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"batteryConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"changePidProfileFromCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c25a2281923b7824,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
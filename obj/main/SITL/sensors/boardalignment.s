@@ -0,0 +1,450 @@
+	.file	"boardalignment.c"
+	.section	.gnu.lto_.profile.4ca770a1b997f334,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4ca770a1b997f334,"e",@progbits
+	.string	"(\265/\375 \371u\003"
+	.string	"\204\004\355"
+	.string	"\b"
+	.string	"\214\242\351\201\002\036\002"
+	.string	"\001"
+	.string	""
+	.string	"\001\240\342\234\212\n\002\214\230\327\245\016\026\002\002\002\003\004\002\004\002\005\002\005\004\002\004\003\242\302\263\302\013\004\212\373\211\303\f(\005\002\005\005\201\243\307\330\003\006\007\240\342\234\212\n"
+	.string	"\020"
+	.ascii	"\037#\340A\002\001c,`\330i`\245\031;\r`\006l\200\274\025\033"
+	.ascii	"/\004 \300\316\270\271\2036\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.4ca770a1b997f334,"e",@progbits
+	.string	"(\265/\375 F\225\001"
+	.string	"\004\002:"
+	.string	"\003"
+	.string	"\001\001\002\001\003\002\006\002\002"
+	.string	"\004\001\004\b\004\001"
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"\004\002\001"
+	.string	"\001"
+	.string	"\006"
+	.ascii	"Z\021b\32400W%\374K\030\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.4ca770a1b997f334,"e",@progbits
+	.string	"(\265/\375`\361\0015\013"
+	.string	"\006\2236-p\247I:\374\005Wq\260;v1\354\336\236oD\342\216u&\\\313\315\320\237\377\376\275\027]\305\201\354\350\bh\3777\261\3667\221;\005+"
+	.string	"*"
+	.string	","
+	.string	"'K`\212"
+	.string	"\266"
+	.ascii	"\212b\344\345\004I\b\332\001\b\013\3367\0336'\304\003m\025\377"
+	.ascii	"HQ[\205C"
+	.string	"\320\266\023\204m\233\360i6\b\334\242-\202X\240\225$>\246\241\030\347\030$\207y\327y\017mv\007\025\264=L\326\241\274\200\266\222O\334,\205\366M\263\326\001\211}\022b\325\241\264\276\246\207\324\301\277\320\354\025B9\\zZ\203\2620b\313\351\301\005\004\f0X\370\030\023\263_\244\177Z\324H\001\317\230\330\257\340\177\237\303[\251\251\256+f2\314\314z=7\327\\\327Ws\3634\263\231f\335\372$\366\034\322\tB\250\201H'\245\251\tR\220\202f\f`\202Q\3206\017\021`\261Q\314\016\205a\317\356\214\335\201\325(\267\200\201\004\220jp\211i\357\003i\303%egi\230\275\306\257>\363r\033o\310\341\372Q\265\2741B^4\037\203L-%\243\n-;jQ\250$\343\275\334\257\353\355\332\361\375|\304:\352\343\331\337vA\001\312b<\205z=\304\371\232\344\317\035\336;\236D\2678\371}i"
+	.ascii	"x\373\b\372\n\346\326Q\256.\321\277L"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4ca770a1b997f334,"e",@progbits
+	.string	"(\265/\375 \214E\002"
+	.string	"\322\204\r\025\260%\351\347\3600,\224\301:aa\030\006\214\033E\304\3362\245j\315\242\t+W\304\217\254\367\340\005o\213aS\223\361dl\001\243\342TV\2329?W\363\216\201\005"
+	.ascii	"K\025\025\246uP\351\231\235Eo\240\r"
+	.text
+	.section	.gnu.lto_.pureconst.4ca770a1b997f334,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\002\231\004\004\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4ca770a1b997f334,"e",@progbits
+	.string	"(\265/\375 \233\255\002"
+	.string	"D\003\217"
+	.string	"\003"
+	.string	"\001\020"
+	.string	""
+	.string	""
+	.string	"\002\002\007"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	" \340"
+	.string	"\002\f\001"
+	.string	"\340"
+	.string	"\340"
+	.string	""
+	.string	"\002\001\024"
+	.string	"\r"
+	.string	"\001\002\006"
+	.string	"\001\002\016\001"
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	"\001Q\002\276p\340\005+;K@\351\241\342\210\272\200\347\201\224\3002\343\354B\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.4ca770a1b997f334,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boardAlignment_Registry.15.4ca770a1b997f334,"e",@progbits
+	.string	"(\265/\375 \2175\004"
+	.string	"\204\007Q"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\255\373\013yw\350\324\005yu"
+	.string	"\005\001\006'\001\f\0020sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/sensors/boardalignment.c"
+	.string	"\004"
+	.ascii	"Z\205H\271\351\231\304\r\240\b"
+	.text
+	.section	.gnu.lto_initBoardAlignment.17.4ca770a1b997f334,"e",@progbits
+	.string	"(\265/\375`\223\003\305\026"
+	.string	"\206\353\222F\260\030U:\360\307\373\016\243\371\330\020\302("
+	.string	"\037\271\205\363\255\007\371\247\343\024~\241\220\016E\202\004\252o\367`8\230\375T\036{\265\364\217\232\201\037\247\002]\371\236\022\202\n\223\344\r\016?"
+	.string	"\205\364?\331D\312\224\002z"
+	.string	"v"
+	.string	"\201"
+	.string	"\266\t\233\364\370\367L\262w\347!;\017\305\267?\213"
+	.string	"\306\317\216\320\256\213\004\217\226"
+	.string	"Tz\332\337yNv]\212\003\330\315\t*\262\273S`\006\243G\357\036\003>\216\036"
+	.string	"|\264\314\2562\340\246\024t\353\021\332]\224\326\270\354\"0~\2322\177v\221\210\246w\020\306\343M~$\034[\252\tG\305g`w\357\363d\201S\313\024\321\354\256\023\207\363\342\036\335\366\t\333\030l\315\005!x\322\022\225^\220-\265\370>\266\271\217p\264kk\340\377\200(\341\353<\372)\300\307\223\336\347\001\226\b\311\310\351h9d\357j\2514\354\177\2539vL\317\304\264LL\237\256\373M`\232\024\3230_\372%\246G`Z\024\323\340\227\2161\375\201i\215\351\374\322' \273\365\020\220d\267\305\320\226\005\212Gp\234\367\333\367{\356c\223l\342<>\020\035\031;\217\001\237F\375\232\334,\342JF\273\373\251\342rYt\2526\207#1\221\0026\354\016\357y\210\231\262\273\r\036\277\036\334\025"
+	.ascii	"\231j\177H\345q\252\006l:\3635\365\267.'\275V\310\325\244\364"
+	.ascii	"\350r\025\350\033\371\021\225\257\343\025+\217c\201\217\016t"
+	.ascii	"\ba\321\335\356\fD\361\355\316\200p\336c\344\330a\205\347\335"
+	.ascii	"\356\306\031-Qi}\310\214\336\311\215\177J\343\307e4\243\210x"
+	.ascii	"\020\031}\020\224\273;S\007\260\325\b\226+\202+l\305R\261\360"
+	.ascii	"e\212`\262jA\314\265\262q\261Z#R!^\251\020\004\n\366\na\256\025"
+	.ascii	"\f\345j\245lP\252\027\f\265\340\200C\022\253\027*\026\206/\024"
+	.ascii	"iG\373\267\232c\032\232\326.\262\302\313!\027\310\363<J\215\002"
+	.ascii	"\033\273\264\343\374'\2072\201BM\r\370x\236\367,\340\354\013"
+	.ascii	"\031\3628\307p\001\272\321\231Ijk8\220r\201!\275(\314H_\364\023"
+	.ascii	"\322z\223\221\352\n\335\016\221\332\033\316D\b(\212\n\006? \300"
+	.ascii	"\002\231\031c\007@BJ\016\212\246?\265\361B\232\202\222\306\272"
+	.ascii	"\265\216\251h45K\371\254\025\250\206\310\344\036cR\022\303,."
+	.ascii	"\263\236\307|\002<h\021cw\020,3\222\3050\350\302\373F\b<p\007"
+	.ascii	"\243{\340\205r6\206\240('\361\265o\206\357\\1\002\221\272\230"
+	.ascii	"\242\340\016\350\302\005Q~U\263\270*@\001z\303\352Y\343\034\037"
+	.ascii	"3- \003\037\022\367\346\035*\3227w\352%\025\355\274\"\241\030"
+	.ascii	"\320\215\222\323\333\265\312"
+	.text
+	.section	.gnu.lto_alignBoard.18.4ca770a1b997f334,"e",@progbits
+	.string	"(\265/\375`\200\004\r\027"
+	.string	"&\252\220I\240TN:\306\377\033r\206\223\260\261\025,\267e\344u?\247\376\264q\323F>\025F\312\253\030i\223\027k\327\204\211G\270\332\360\214\221\343\345x9\255\007\243)\254<X\375\360\237\373\037\372,SU]\323\226\020B\210\224)\005y"
+	.string	"k"
+	.string	"\200"
+	.ascii	"\177\323\377\364\265\377\026w:\224gOE\t\232\374\213\261P\233"
+	.ascii	"EB\031H  }g\321;\223\177$\020\007\225!-\r_sN\002\017]C>\214\001"
+	.ascii	"\257\366S\\E\357K\236\272mN\244\025Ts\372dl\200|h\337q\342C\362"
+	.ascii	"7\361\241{6\220\373\222\346\b\002\303\005'#sN\335\212x\357\332"
+	.ascii	"\363\017u\031\221\021\320uT0\347\264\022\031u\270\367\266\005"
+	.ascii	"\330\266"
+	.string	"\261C\\W\362=%>lY\232#\254\"\017A:f\373\200tC\330\007\347\"\331g\272_\336t\273\374\351n\371\322\317\242\352\234\252WT\255\242j\234\252ST}S5\212\252m\252\256\251\372D\325&\252.Q5M\3253U\223\250Z\246jR\325\243\252EU\207\252\006U\275\252VU?\200h\"GN\306\234\033\306\216\314\254\260j\304\231\002/P\220K;\017\"!\343\206KnN\352e\305\035\227E\314\206\177\277\372\214\327(oEC\357+\361\241\270\277\002W7\\Pl\350\203\313\356\202;z\305\360\317F\346We\215\325\256\215\217\252\226\375\352\2027\206J\b\351\230\253\374\003\300e\273\300a\2240\007~\247\212\340+=\364\204\037=\321C\377G|\370\035\301\240\302\252\244\310\227\315uE\335\370\347+\201.Ks\264u\0277\376\341\222\346\234\001\024\376\363\n\317\321\221\260\316\231\361\351\321\341\351q\260\363"
+	.string	"\247\001\017g\307@W\362ve\217N\251\353\331\301\341\321\345\360J\335\314"
+	.string	"\357 \350\360t>\273\035O7\363\315\203s\221\274\340DV\320\n9\267\276\324\312\3426\247\262+\313\"V\204\310\020\225\224EY\334mSv\364\002\373\nr\263-\212\327\217.[Xm\375\250\223-\331\232\311\236,\213\030\327Vy\253\036&\264%\331\222\331\322v\364\332\241\245c&[\222,\254\022\006\207lG\260Q\2501h\203\220TbASPv\263\006\360\002\221\231\242\007\020(\244\310\214\230Xks\300\214\203/*\3002\024\032u\265\222mkx\202\354R\001\357>B\225\220\034\200\200\307>WV:\242\347X9\242\234\007\241[\307h+n"
+	.ascii	"h\027\252\362\357%\030?\030\364\252\237HQQ\003\360\030w\250l"
+	.ascii	"\234\224\345\005\020\245\345\260\304r<\25722\354`q3\334\250\323"
+	.ascii	"\243E\033}1^an>#\"|\337\201Y\261\333\253\0271-\214D\223d\023"
+	.ascii	"\037\340t\301\202`%\005\"\277\340\347\017"
+	.text
+	.section	.gnu.lto_alignSensors.19.4ca770a1b997f334,"e",@progbits
+	.string	"(\265/\375`\266\006\215\036"
+	.string	"\026\265\270I\260\324Q:\350"
+	.string	"4\363\2348Z\310\322\313\260*?\252\324\347C\200\275\001\007&\rH\"\025\334/(\026.>U\373\376\244\327\207\037\253/\3607\237\242\362\223\037\215\352\037\314e\374\362\360p\301{\250\246\266\377I#\233l\231R\245"
+	.string	"\230"
+	.string	"\244"
+	.ascii	"\324\026\312S\003\343\\[\002\005\335\203(<k\005\016\251\360\265"
+	.ascii	"\177\3438tg2\217\273\324jd\203\252\326 \004O(O\035\274\fyZ\036"
+	.ascii	"\206<\265\316\346z\020\251>\311\220\n\035Tj\255\265\031\343\272"
+	.ascii	"\323f\262X\t#\3518W\347#@\022\366|\273\323\016\024\375\f}6:\360"
+	.ascii	"\352!\3455|\206F\031\0262zG\342#\2642+1\256\362\t\354\212\034"
+	.ascii	"*\321\271Ci\204\315D=\003\f\034P\212~\202>\201~*x)zd>\036\262"
+	.ascii	"\254\265\276\310'\250\\\330L\255\325\333\363\375\334-\267\035"
+	.ascii	"\305v\006\233\314\t\366\207e\314$\3204\305\301C?i\204\231\033"
+	.ascii	"\200\212\227\342\340a\001'I\276y\220\247/s\003\320\224\025A;"
+	.ascii	"[\264\203\273\235G\366\307:\215\354\007\177\231;\3351\177\272"
+	.ascii	"a\016u\277\234\351w!\327-tM\243\353\031]\313\350:F\327%]\303"
+	.ascii	"\350\232\244kJ\327#]O\272^\272\376\002\231\317\221\001]\265\262"
+	.ascii	"(^\251Z\324\307\214;\375O?\324\247\375\353\270\360Q\236A\001"
+	.ascii	"1<\2210\320\023\240\256\340!\242q\241|\2167\351\356D\242\334"
+	.ascii	"\371\b\350\301@\362\252\265>x_\277\256\245\237\221\257\320\006"
+	.ascii	"\214\234\3760f\222\323\346\"\213\322is1,\362\025*\221/L\276~"
+	.ascii	"\3438mCM\254\276\302\026t\316i\033\022\362v\372R;mBE\036\261"
+	.ascii	"\352\373\204e\234G\323\237\332\251\036qg\213~\231\2376\241,\036"
+	.ascii	"\021f\002\240>\254\245\337\316\026}\037'\211Z\273\305\342\340"
+	.ascii	"<Z\3423)"
+	.string	"\273\220\370I`[Y\276\026\211u\345cQ\253!>\221Q*\210/d2\375\360\201\230\253\334\243 O\275\275\312\263D\243\276\260\337\3036\327\253\254j\335\035\270\275\332\340Tf2\330\272\252@\233%%n\342'\216s\263\321\241\321\271\341J\235\\\315\207\321\036\"\350\340\324\334\340\200\260\021A\363\001Gs\353P\313\341n9\234\232\\\r\307\206\346\246\346\001\227\253EP\340\333\210\032\\M\347v\303\325f\301\372\261N#k\360i\355L\036\332l]\246\035\342f\3373MX\324\352\231\273#U\361\242\232\345\310\226\331\241i\253g\253\330\247\362\257\234\237\344[\316\276\227C\236\266\314G=\201\257\270\364\243\272gv\213EF\243M\033\221\220\331l\332\210\206<\242L6mDB%_aV,\026\2336`WYN\033\260\t\217x\344+\254*a\260i\003\ny\001\200\203\250a\\\204\02444\"J\nS\220\2441"
+	.string	"\003\221\241\332\034\021\3004\351\0341\021\241$\005\347s\350{2\350ud\245h~\252?H\254\274$\351pi\211#\301F\022Dk\375D\333\210\200\310\375\322x\302\335\344+~\211\033)hH\351\0231t2\304/Cb=\372\271\315\341\302@p n\370a\273Zq\336\265"
+	.ascii	"\337F\374-\270\\\323\277/\325K~\250f\034|d\177\003\273\252}\257"
+	.ascii	"g@\273\355\236dj\220\211\350e\271d\004M\351<\023\272\177J\367"
+	.ascii	"O\351\376)\335?\205\356\361\002\213I\265\243\303\214r\t)Y\332"
+	.ascii	"o|\272<l\302\202\201,\022z\303wwn\251G\2316\304\030\">X\tw\214"
+	.ascii	"\322\00253\205\261j2?`\330=b\006\207\367\324'\274p\b\334\231"
+	.ascii	"\253\003\205<&H\272\210\266 \336\260\r\252\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4ca770a1b997f334,"e",@progbits
+	.string	"(\265/\375 \366\025\005"
+	.string	"\004\b\362"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\022\177\017\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\013\013\200\204\001"
+	.string	""
+	.string	"\003\002\021\177\020\272\200\202\002\n\021\023\177\022\017\023\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\f\024\201"
+	.string	"\005\r\025\001\025\177\026\377\037"
+	.string	""
+	.string	"\200\200\200\001\024\177\027\003\002\t\201\200\200\300\003\001\344\006\204\n\244\013\003\002\b\344\013\003\004"
+	.string	"\320\360\372\250\001\001\342\026"
+	.string	"\r"
+	.ascii	"`hP\260K\341}\212\230\310T\361\004\303\345\3072\231\254\202\001"
+	.ascii	"\276\003\331\210\2622\315\241\312"
+	.text
+	.section	.gnu.lto_.refs.4ca770a1b997f334,"e",@progbits
+	.string	"(\265/\375 A\t\002"
+	.string	"="
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	"\001\004"
+	.string	""
+	.string	"\001\006"
+	.string	""
+	.string	"\001\t"
+	.string	""
+	.string	"\001\r"
+	.string	""
+	.string	"\001\017"
+	.string	""
+	.string	"\001\022"
+	.string	""
+	.string	"\001\026"
+	.string	""
+	.string	"\001\030"
+	.string	""
+	.string	"\001\033"
+	.string	"\002\002\001\003\b"
+	.string	"\002\001\027"
+	.string	"\001\004"
+	.string	"\003)"
+	.string	"\002\005\002\006\002\007"
+	.text
+	.section	.gnu.lto_.decls.4ca770a1b997f334,"e",@progbits
+	.string	"(\265/\375`\022\021\rX"
+	.string	"\352\231p!T@PBJ\007\211\233(}\303\2602\370\361\257B\003?\234\276Rh"
+	.ascii	"\001\300j\341\256\232\n\377\301\237\210\333\330g\225,\372\324"
+	.ascii	"x\220\352\\\317\313\321\021u\324\241\32099\314\2610P\352'\252"
+	.ascii	"\351\243\230\316\0014\\\372@\250\351\215a\345"
+	.string	"\242\226v\315H\2232\005\271\001\377\001\n\002V\330\220I\335\371\205S\307Z\307\013\234'\350Y=\n1VUd\200\372\205\246,-e6\314\271|\212i/\321\221Y\311Q\305\\\2615\263\313-\263c\210\210\210\206\266\271&\255\252\236_.\365\233\326/\225\372\205R\277M\352\277_\302tgT\234P>\301\322\342\016K\332\2342>\277Q\325\313\346\260:\354r\277\266\353L\273\213(\270\246Ty\355\226\317N\267T\025Uw\177\265\374F\337\257\315\332-\002ltKE\371\230y\253!\305\255\273\207\210\210\210\252\22462W\365<\257\376\203z\f\352nY.\273\374\327v\371fY-\337)\246\255\\$a(\022>\037A\375j}\200\261n\007\376SY\350\356\326\331\177\351\316U\304\n\351\316\305\262J\234\021G2\005\321s\244\231^Q\376ke\323\305\332\351:\333\001\205\317/\326\277W{\345\\\234\354.v\267"
+	.ascii	",\306F\0067>\317\\!\335n\203t\234\\!]\002\033\244\333*F_\253"
+	.ascii	"\177\251lU\220\356\370\224vVw\377\340\272\300h\274\361\311\351"
+	.ascii	"\n\351\352\006\351\376\313Y\037\332.}\367\263\320\377+,\342\374"
+	.ascii	";\202\322\305\177\261\377e\3763\377\243\371?\366\357\t\275\034"
+	.ascii	"\376{\375\367\262I\377\331\f\370Y\347_\b\376\255\340_\n\376\225"
+	.ascii	"\340\337\b\376\235\340\337\013P\3707\201\177W\374\373\300\377"
+	.ascii	"\236\237m\374{\364/\t\377r\360\257\006\377b\360\357\207\177s"
+	.ascii	"\377\342\376\277\375G\373\017\366\037\353\377\233\377m\377\331"
+	.ascii	"\374\017\341?\213\377j\377\325\374O\363?\354\177\213\377\312"
+	.ascii	"\377\036\374\037\372/\346\177\256\331l6\377-\376L\346\357\031"
+	.ascii	"\022[\251\211\343^\350\341=p\323>5N\315\331S\211]\025))@\210"
+	.ascii	"\347\246\037\037iz@a\364\b\332\303\213Q"
+	.string	"\356\345\216(M\300\322\036+\255/-|6\267\013\307\243\311\027\034\334\352\327m\343|yX.\017\373V\323\326\2413e\343\351X\342_9\337\267\237\001\007\276\303\256\273\252\273\tX1\343\326\026>\357\346[\377w*\r`6nP\253\347_\327\304cw\357\310\245}l\332}s\273%\376\236\305\355\001\377\317\306\375\004U7\223\265\266\372\204\213\030\344\"\372Q\272Q\020\235\366\321\250\224B\215X\306\220 \322\036\"@+\211\2641\225B\236\311\346N{\273(\205T\301\230&\217\3064\211\002u1\211v\247H c\026\021]\243R\niT&\221 \272\330h+\211Cj1\2114\216I\"\201\214J\"\322X\224B\202X\262\246\204\311\2154D0\213\032\213\235\303\t\212x\004b\032\323d\233uo\026\215>\036\320\r\225<\232\021\177lW\0233G\323\222\230\334\324\251i*\331E\246\321\206d\267\rMK\355\324"
+	.string	"\2322\033\3112Q\"P\215\203F\367"
+	.string	"\235v;u\243\333\314\356F\273[\347\b\225v\307"
+	.string	"d\244rr\352~\032rj(\324\213F7g\241u!\215\312\251\244\221W\026%U\327H\321\245j3\251cU\242W\215\203\255R!y\264y\263\3347\253\334 m4\002.\036>\334\372x4q\356\341\246\215\247L\355I\007\237\313\026\242\247\230F\307\225\215\272kvm\227\005,\033\034z\345\247\247\007)=\310\341\363\214\3267\267"
+	.ascii	"]\272C\343\"\346F-M\207\n\330T\026\237\233\306\213\266j\276i"
+	.ascii	"{v\006\034\370\256\330U\335\351\246\235\335\304\335\021>\273"
+	.ascii	"#r_L\210Xr\314\312~\274\346\324\340\205O0K\206\273:v@\326em\313"
+	.ascii	"\366\314b\365\3242\315\242\331\345\226=D\r|\362\326\321\260\301"
+	.ascii	"\222\266\364)\373\321\245k\271XVN@\214|>7c\313\026\036r[\276"
+	.ascii	"r\234a\223e\311YX\313\202\350&&\351\352\343\223\t\\\331\222("
+	.ascii	"h?lF-31\365+e\031\307Y\206]2\016V\016]\245\350\2070a\240Ll\024"
+	.ascii	"%gY|b\361\222\215\215\231\255\372\255\232\342\"iRF\230H\025Z"
+	.ascii	"\023\246\272Al\006&\342\203\202\350&rFU\305W\370\212\255p\025"
+	.ascii	"Nw\311VL\303Y\b'?\304G\330\212\2210\223e\036\241\240\312\214"
+	.ascii	"\207Xq\r<e\231O@]\334Z\263F4DD\364\341\206\0243\312\347\234\272"
+	.ascii	"\032\001M\306\r\254\324\326\272\323\377,\205\251\354\222\247"
+	.ascii	"|(\355\316\232\302O8\3122\237\322\336\301\323\205I\326\346\326"
+	.ascii	"\235\022\205 \352is\306,\210.\n\016>\313t\0066>\371\006\235\247"
+	.ascii	"\037bf4\261a\227\f\245\272\211\342%G\215',\311\224\222\372\263"
+	.ascii	"H\375\371\344\244\226\255E\225\331Q\177\346\250\234\204\225\354"
+	.ascii	"\222\004/\371V\341#"
+	.string	"\317\021\323NY\311\234-X|\376\234Q\277$t\270fsI\350~v\005Z!\335qn\3658\266\372s\021&\222S\206i+Cd\3330\031\031\034Mk*\320\006\351D\224\330 \035\307\300P\034\365\357\374L\3512\242\225\246\236\203\260H\"\246\305\347\311Og \377\016\213qB\3454V\317>\370\307\277\343c\326d\313U\230z\356\241\325l\003\302'\303Pi\340\226$>Dm\t\t\302\347\031\206\237s\260\016\346\201B\013\3159p\370d$\3578\363\340c3\217\006\222\335D\346\361\363\326M\374\331\035\261;\342\2342\345\204\213\356<NK\275\331\n\351z\256\214\316N<e\300\326\2548\341\032\\\203o,\031\024\3530g\f\t\237|c\237\250\211Z\303'\033\277\365f\203L\327\266\311M\275Q\303\305\347qR\365{\266<c\227<c\3236m\035*\002C\036\360\205\213\\\013\241oH\370\343\371\222x "
+	.string	"CH\002\022\n{HH<\235\t(J0:!\307\202/8\344y\360\302\027#\205 \031L\300\013\202`\364\206B\031-\204\206_:\241\304T\244\304\024\204\364\213\221\301\260'\344\371\271\340aO\330\013\346\204GJL\273\341\321O\211)\367Sb\302\r\217R\030\325^\013>\341)\024\366\202II<\035\031L@\24438d\302%\365t\222z\302\030'RO\250\363\340\221\022\323\211\236 o\t\351\224\021\034\n}J=\020\216*\020\240\305.)\310K\372\361\206\302"
+	.string	",\030\372~>"
+	.string	",\370p$_\260\367\353)\3257\220B\201\024*X\320\271\212\025\013\254X@w\025+\214\214V\2440\252Oa\204;\322\017\350\033\362\206@\020z\206<\303#\025\303\237/\206\316\013 \320\202\243\334\n\274 \316E/\351\250\347K'\204KC\036\214\242\037\020\006\f \322"
+	.ascii	"+\360d\340\216\230\\\354\2349a\357\205\322\217\247\033~)\201"
+	.ascii	"\003\231z\301\242!\020\030,\342Y\201'\343\203\360\250\002\240"
+	.ascii	"\027/\200A\236\341\021\003(\206?\237\316\215\214.\020!\002\013"
+	.ascii	"\r*\322\211\341\257\007\343\247\344{\301K\n\362\200)\024\t\203"
+	.ascii	"@\341\257',\372\371x0\212\220\202\302\242\023\b\b{\275\240R\017"
+	.ascii	"\203%\244\241\217i\367\237\321\366\355\307\307\2303^\370<\027"
+	.ascii	"\233\375\274\222\274\002\332\241\265u\311\372\222&,N\025\r\030"
+	.ascii	"\320\260\030\226/;\270\36196\306g6@\273\3211Lv>\263i;8"
+	.string	"7p\b\311Y1\303Z\234T\3511\306'\0300,6T\273\n\331\331Znm\210\232\"e\316b\\=\324\242h\220\241j[\202\362\311aX\314.C\360\2306G\232\2208T\027\2727\204n\233\315\r\241{\316H\275\326\2658l\257\264\216\305\212\363T\342']3d\213\275\316ag\260\335\232\021#/\350\300_\377\316\216\2320b\310\204T\316\201\275\350\320\370\200S$\007\204\304N\023\335\001\016\225\234%M\370\344.\334\365!\2069Qa]\314\025\344\346\264\265l>A\212\024\271\021\201>\250\201(g\024D\310\314\214\210\210$I\222\016\021\005\204 \350\2643\017\022"
+	.ascii	"V1\2151\306hj\222d\3778G@#FJ\273\327O\223,\nq\237\0030gT\rN\345"
+	.ascii	"\271\320i\354N:\354\277?;\330\017\262\023\216T\224\335T\\ KX"
+	.string	"\216\247\276Y,\211\245\007$Y@\271\250\221L\356\220\202b7\317~\205\321\364\323\2661\023\244\235\301\0025\3573<\002.C \3122\223{=\223Q\245\317R|\344\305|\362\200\301\357F\236W\230\251a1\236\377\006uf\247\235\310\324\365\265{\367\255c\036\031\017\360\206\373\033\320yM\343\035L\2002z\031\030\\!QBL \030l\321'*C\236\250\205(\2774\374\362y\304\024~\324\037/\304\257\347\205\337\363?\3003\376\030&-E\366\242\302\362\007X\033\030\360\256\310<`\244=\331\227>\310\026[P\267M\224\352HCM-\355A\330c\0228\021\336\221\250l\207\266>\200\325g\355*Y\330\236\026\t\272\257C\002UQ\207\366\276\302w \022C\315\016\006\035PZ\253,\324\373\331\334%\352\356\013\002_\006x>JG@\007\332\225U\301\364\252`\021\367Qqs\354\343\3368L^\344\007\271\2226"
+	.ascii	"\264\n\247\360s\362\004\300\n\333\256\345\003E\335\345\022\370"
+	.ascii	"\277\204\032\254\354\206\345\224ib\216\256\234S\007!K\216\251"
+	.ascii	"\371\267\327\020c\020;\261\327\304\"\246\236\276\031l(\200\336"
+	.ascii	"I\300P0\367d\317\374\261\277\0324;\234\3408\340\323xt\352\201"
+	.ascii	"fn%+\261\002\037\264K\263\300\264h/\356\007\275-i\244e\t\377"
+	.ascii	"@@\022\206\347\206\002\270\364R\327\344O\330\254L\207\004\020"
+	.ascii	"K!\2033\020J\0226\007\223TN\332Q\300\3120\242\004\246J\352\376"
+	.ascii	"u\255\345\343\214\356\025a\\\232\236\224QC\276m/\240\3123\202"
+	.ascii	"\202\024\3617\241\005r\245}d\266fxjc\361\bK\247Ms\3419\377\323"
+	.ascii	" k\325\003Lx<E\013\303\031\r\r#\203\021\274H\344\300\336+ \032"
+	.ascii	"\"\362>W\327N\377\026\320\362\245u\217\365\016V\320\n1Py2\206"
+	.ascii	"E\2631\004\2032\002,`x\030@\377\032e>\324\373\376\037\212\326"
+	.ascii	"p\260\207\253\225avc:y\207\030l\320D\330q\261\036\225\323\275"
+	.ascii	"Y=\371\375\214?C^\020f\030(\371#\267\022gm9\350w\246\215y\320"
+	.ascii	"\213\271\005x\342\271\3200$|a\017\342\b\271a\331\216\371!\013"
+	.ascii	"9u^\316F\3160\251\002"
+	.text
+	.section	.gnu.lto_.symtab.4ca770a1b997f334,"e",@progbits
+	.string	"initBoardAlignment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"boardAlignment_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"boardAlignment_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4ca770a1b997f334,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,568 @@
+	.file	"compass.c"
+	.section	.gnu.lto_.profile.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\006"
+	.text
+	.section	.gnu.lto_.icf.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"e\005"
+	.string	"t\007\030\001"
+	.string	"\020"
+	.string	"\337\375\307\265\007\022\002"
+	.string	"\002\001\002\002\002\001\002\003\001\274\205\242\255\006"
+	.string	"\002\317\253\250\341\002"
+	.string	"\003\315\344\253\361\017\002\002\004\002\005\004\240\342\234\212\n\005\240\224\254\300\003\006\006\314\361\201\203\017>\002\006\002\007\002\002\002\b"
+	.string	"\002\007\002\003\002\003\002\t\002\t\002\n\002\n\013\003\n\002\n\007\b\n\352\263\360\321\b\013\f\r\016\017\376\215\241\215\002\020\240\342\234\212\n"
+	.string	"\027"
+	.string	";E\300]Jc/\262\251c\037\323\362\345c\347\302n\001\254\360\225a\b\026\274"
+	.string	"\370\371"
+	.string	"\026"
+	.ascii	"w9\307\336\224Z\347-@\3134\003bg\255\006\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"(\265/\375 2E\001"
+	.string	"\360&"
+	.string	"\006"
+	.string	"\001\001\001"
+	.string	"\001\002\001"
+	.string	"\020"
+	.string	"\007\003\003"
+	.string	"\003\005"
+	.string	"\003\006"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"tNx\tn\003m"
+	.text
+	.section	.gnu.lto_.inline.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\025\004"
+	.string	"\302F\025\037\240'\351\340z^8T\025:\341\250\027\022\352\221\237R\317\377\377W\330E\2418\324\254\224;\005?A\331\260\370\360_P\313\"m\252\306B\td\203V\330\023\321\321\246\263r\030\001s\346\025m\323\205X\333\362\372\337C\034<\032\243m`_\211=\332\2367O\002\021"
+	.ascii	"\256\3218s\235\244\220#\215\2010\3018\n1W\240K\340\t\341\030"
+	.ascii	"h\001\326\001\310\035\345\302M\344h\032\203\305\216\r\264\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"(\265/\375 \207\325\002"
+	.string	"\362\004\021\035\260'\215\001\f\303\200\003\230$)?p\024\247\241)\2114Jg\202x\203$R\312\224\002\n\214\"@5\343\027\323\026\b@e\336\330\\\356\313\321\"\310\216\333Y%\030\016\016\312LN\017-D\237L\275g\"\007"
+	.ascii	"\240\b9\213\232I8r\326\323y9\312\360\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\232\004\001\200\004\002\200\004\003\230\004\005\204\004\006"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"(\265/\375 y\225\002"
+	.string	"\204\003m"
+	.string	"\004"
+	.string	"\001\270\006"
+	.string	"\001\002\023"
+	.string	"\003\002\024"
+	.string	"\001"
+	.string	"\001"
+	.string	"   \002\025"
+	.string	"\020\020"
+	.string	"\300"
+	.string	"\b8\002\330"
+	.string	"\330\002\001\002\003\001\002\026"
+	.string	"\001\002\027\001"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	"3{\252\306e\002\r\317"
+	.ascii	"5c\370\f\315rdK/\260\n\f\260"
+	.text
+	.section	.gnu.lto_.lto.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_compassConfig_Registry.26.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"(\265/\375 \227U\004"
+	.string	"\304\007`"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\203\276\331\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\356\006us\350\305\006uq"
+	.string	"\005\001\006'\001\030\250 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/compass.c"
+	.string	"\004"
+	.ascii	")\"\301$\032D\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_compassConfig.27.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"(\265/\375`Y\001\305\013"
+	.string	"\206\324LA \307\272p\227 \370!\230\354\260\265n\037\232\317\223\214:6\211%\200Qv\201H\006\347\230\203\367\253\266\366K\223\035\034\236q\200F\210\002\f(\244\0272\001\340v\023\0053\260 7\375\031=\331)\0056"
+	.string	"8"
+	.string	">"
+	.string	"\273*\204\0372\007\255\276\023\036\314\\!<h\324V\300\360\301i\240\242\255\273+~'G\357\241\376Y\256Y\261\322{\007\024\273ko\305\032\271\277\333v\260-a\177A\007}Txp\002\244\244\025\323\245\274\235\255\246\336gb\037\263\273\353\317e_\366{\234o\200\352ea\267+\262c\2608\320\246\262\261}\317~\354+\350e\250'\354\272n\265\005\310\024\001\ft\333+\267\206^\233\345\004\334\3168\201\327m\025=@)\275\301\376Rh\227\007P\272\b\321\265b\246\320>O3if.\353O\241\275\361\226Sfw#\374\031GG\007%%\240\020\306\250\254@\360\3509\317\017IT\216\342i\226\347\210<\305Q\350#\022G\363\024=\r.I\244)j\224\245)n\324=f?\227-Hp\251\317\3037p\373\363\003$+\001\214\f\355\361\001\033"
+	.string	"s\311\"c\017\213Z\213\263"
+	.string	"P\2071n\004\324\001\330\201\357\220\332\034\374\346\204l'\365\007\fHz\021(\320\001\004\244T\322 \343I%\022\3520 \023\232\301\274K"
+	.ascii	"\315jJ\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_compassPreInit.30.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"(\265/\375 \302%\005"
+	.string	"r\311\"*\200k:\300\\\202_q\030h\3040\200A\355t\233B\374c{\331\277\247\267u\021\255\031\302T\340[M\220\205\210@h\357\224\002\256\246Z\251\354\232\225\254tV\314\252\022CP\227\254h\225\223\344\231YT&\346\2442\372\366\321\033(\342\302\3766\030\037\366\001\033=\033B\027\215\304\331m|<\233\tX$\266\037Y\2637\377\"{\n\206Q\351\354\256\214\220k\207\232\377\311\005\\\267\035B\206\3355\344:\307\035o\233`\273`\373\020\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_compassDetect.31.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"(\265/\375 \370\315\006"
+	.string	"\262M15@o\222\016\230>*\3205u\t\\fL\240\353\217\347\240\321\017m/3\352\337\334\257Xw\353\030L\323\3100<\r\027=\207G\232 <p\271V\3274!2\005\022\326\203\273\322@\270\361p\256\352A\354\202\035\013\276\016\304\206\363*\f>M\301\227\307\302^\304ua/\023\263\031e@\341*>\202\232\333\370\002df\356F\337\252\221-,\016\245\314\320\213K\252L( \177\377\317g\376\326\276\"%}:2Q\201\314\021\351$3*\234\200\351t,\001\325\t\323\001\252\323\377\002\303\347\254\261#T\217\017\213\222\226\314\370\034G\263\266\354\226\244\007!)+%\023\021\250-\240!3o\027\"\214\356\372#\374\357\317\b\006"
+	.ascii	"2\003\202\341\243\302f\0250w\031\363\272&\031"
+	.text
+	.section	.gnu.lto_compassInit.32.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"(\265/\375 \376\345\006"
+	.string	"\202\31505P\213\222\016`\271\332DS1\210\241\273\344Sk\212U\005\213o\305\201\271z\323\373\201h6\232\277N\266\353\314l\223\234L\034\n1gnR\003\034h\214\020\231\002S\224\030-\032LE\301hU1s\2110\303`\301@\312\212\220Bp\245\271X\260\241\252,8\321\260^\222+\330\353<\351w\006\357\320\216I\003Yf*\334Q9\036nF\247!6\256\236Nw#\351TQ\335(T\252\330\33007\362Z\307\275\320\027 3\363g\361\257\024\271\211,\204d~FJ\t2}h\374\234\237\214\220\300\371\252\226}\212!\222\360\33025\370.z\325]W"
+	.string	"\024Q\027P\311\314\235\0074\321_\377\202\377\340\317\002\b"
+	.ascii	"2\003\302\360\030aF\035\302\251k\b\021\"\207;w\333\342\004"
+	.text
+	.section	.gnu.lto_compassIsHealthy.33.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"(\265/\375`e\001\215\f"
+	.string	"\366\226P? o\224\016\303\002\202"
+	.string	"22(\260\230\f\354B\303\"\331K\310x\315\214\017\240\006\265n\205S\264Ov\314\fFZc&\230*$@@@\0200\271fO\215\237p\232t\315\225\354\275\245L)?"
+	.string	";"
+	.string	"A"
+	.string	"\32784^a\004\003D\305\256\026\225\302E\207\317i\212|\n\363R|0Q\312\260C\t\177\020\322I\262\213\324"
+	.string	"\331\003G\331\335cxfd\244L\n\263\273\316R\026\341\246n\333c\273b\277#\276\205?;"
+	.ascii	"\345K\177>\b\376]'(DFy\2625,u\303\276[5\331NCM\273Lk\2463\323"
+	.ascii	"\247\004\204 \261@\304\256\306\211\305\216x\"\027l\207l\211\017"
+	.ascii	" \bY\024OM\372\r\367\340\355!\035>\377\340p\203\200\177\252\017"
+	.ascii	"\321\273\324\234`\340 \336\342\307\307\342\221\032\237\273\213"
+	.ascii	"\351V\340\252%<F.r\205\345\232\267\311\211\335U`W\327\360\031"
+	.ascii	"\300\261\273\t2\274\343\n\326\\\256+\343\341T\232xY\325\325\331"
+	.ascii	"\\\261\303 \303\211\032\353\212\027\002\256<\033+6\250*+J\264"
+	.ascii	"\275[59_\345\351,w\232a\033*e\244$;\205z\214\026\243<\001\200"
+	.ascii	"\272\001U\333\305\002! \320\002\031\n\356\006\013\031z\306\031"
+	.ascii	"\336\313\"\007\034\307\204\361\b\274\244\006+\353\336\314\225"
+	.ascii	"\336\353-I]*\243q\273\344\224k\324\250\001v\334\263\201.\030"
+	.ascii	"m\006\341\371\341\313-J\005E\036\274\217y\234\244b\240\033\005"
+	.ascii	"\247\267k\225\001"
+	.text
+	.section	.gnu.lto_compassUpdate.34.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"(\265/\375`<\016\215<"
+	.ascii	"Jbt\025BP\246N\007\253\202\202\301\373\377\327\221\b\337R\205"
+	.ascii	"/oY{y\t_\247,ch\266\tRkS\033\230\0320 \020\021\204\020\210I0"
+	.ascii	"\320\267\n\326\352\351\256W'\231\240\220O\203L\204\354\275\367"
+	.ascii	"N)\245@\001'\001K\001)\353\214\256\316\257:{\352\334\035\222"
+	.ascii	"\316\334x\300\273\227\307\223\320m\223:\335\032\257\333\256\233"
+	.ascii	"\256\033K\243\376\356\2762w\336\023\215\341\245\3016\367v\247"
+	.ascii	"\247\347V\267Eo\0077\223;\013\026\026\303~\215\261xZ\372\362"
+	.ascii	"\334{\253:e\bl\247h\220\231\333\231\333J\313\265}e\006\377\356"
+	.ascii	"M\223\363r/3\001#`;}\352\242\332)\332Hj\247\314-\363\235f.ok"
+	.ascii	"\301\023f\007\350\336k\365J\220\214,\177\243\314f4m[)\311X$\""
+	.ascii	"\035\031\r\213\204KDCA\340\217]\325\024}o\271\327\n\003\322\374"
+	.ascii	"\021#\373j\245)\235\344\226\267\304\215L\272\230\327\032\330"
+	.ascii	"\346\364\244\2251i\":\\\200\346Hk\205$el}\264\326Fkwj>\\v\321"
+	.ascii	"\362\256\210\013\033\311\326KmN\306\342\234h\n\021\037:\353\340"
+	.ascii	"\031\224\223\261!\016L+\023\322?t\030\244.\314Y\250$ef\275\256"
+	.ascii	"\025\352:\003\333\016=ief\255\242Oo\306\204\240OsIO\321\341\275"
+	.ascii	"WHV\003]\3408\310\300\034m\342\243\277\2634U\363\217\030\231"
+	.string	"\217\366\265\302\275\227]\214\254\254\031@3\273\001f\236\300<\304%\033X5\350\367\\O\331\325\245\257\344\037\337s\370\347\363\252\226z\034\tZ\352\333\017\035\037\r\027\324(\212\240\245\236\303\367Y\363O\022\r\314\237\374\217\206\233\305=\346\320g\260\204\3132m\306\303\007\020 \324N[l\217\377\377\213I\346A\372\363\255\307\034\035\210\361\357,=\025\346\031\310\211\364\347\377\275\367\353\231\350\315l0$\232\226_\332\2315\202\004\tf7Q\020\367\356E\266X\227\347\240\221\032\377\305\314%\232\213\t\366\336{\305\275\245\365\264\270\333:\345-\024\336b\235r\243P;\355\177(}\201\256 \375\311\314\004\363W2w\337G\302\314aC\006\n}\245\373\001\320\331\001\353|\325x\315Tm\327<\325t\315\007\032K\263\224\352l\340\347\034\365s.\360s&\240:\017\3709C\251\316O\252\263\323\352,@unR\235\231V\347"
+	.ascii	"\2523\200\325y)\350\254\024tNZ\235\215\253sQu&\256\316H\253\363"
+	.ascii	"\321\352l\244:\017W\347\242\325Y\270:\023\251\316C\253s\020\350"
+	.ascii	"\f\004:\377Tgvu^\201\316\352\3179\217\364F\342\027\223(\221\020"
+	.ascii	"\275\210\247\0351\342\315b\324N\221>\rc\346\350\211\234\r1\372"
+	.ascii	"\242?\032\276Q\0203 \303\004\376\303G\217\242O\303\004q\n\237"
+	.ascii	"\314\307\234\007\321\007_\370\235|\033z\242\367B\311<:\216RK"
+	.ascii	"\317\3418Z\267\002{C/\245\346\364\033n\003K\270\364\260\340\247"
+	.ascii	"p\315@\316 \360O\320h\343Z\266V\016\370\377\243\031g\006\374"
+	.ascii	"=\367\034G\366\240n\343T\365\177\350\0313l\302\314\300~\257\344"
+	.ascii	"\340\332J\341\3235\265\252\017\034xO\342\354\201\247\360\r\245"
+	.ascii	"\314\263\257\320\213\026\256\317\3144\331\037tt\022\224\325\264"
+	.ascii	"\007\250\003\265n\034\243\205\203[\237}\264Or\215\037n2X\366"
+	.ascii	"\301J\300g}\"%\2278'"
+	.string	"\362\2502i=G\246vI\347\311b\3574\236\326\315\270\274\367\266M\332'\303n\341\352z\252\006\036 >\275>x\356:mg\206\214V\212\024\265\323\227s\027\350\214\231\367^\265\233T\007\354\033F\273IU\337A\317i:m\034w\033\267UZ9o\261VN\355T\375\364.\210\331\223\247\337\314\216c\201\205\203e\334{\303\0270x\213\361\323\325\247\275$\254\257\237\315\245\242\177\365\354af`\032zM^)`\230@\275\216[*R\204h\261b\253\253\313\205\026\021k)\360\3622\301B\005\227\226\225W\027\227\327\212-/\253\025)L\250\260\322\352\362\262R\320\304\\,\266\272\254ZpquY\005\231\310~$,\202H\033\344\203\261\322+\231[%\255\332\0162@\332\200\375WR1\303\247|\304\252\246\242z\217\322F\252\317\360L\242\031x/G\001\336\364.\255\033S\324\033xTNX\237\243u\201\217\372"
+	.string	"r\222T\b<\324\027x%\273$\332\200'\300\345\330c\364\262:\314\226\001\337c\324\234\017\365\035\326\267\346y\307\b{xYW{wO\337ym\365#\316\027_\271\244\353\346:J\311f\n\037\"\337\321\206O\371\226\252zj\352=\n\322\324o\370\266r\346\351GNY\2600_8\2611\022\260\246\351\005\\9JX\272\\V\203\245[i\372\"\245\232!\323S9J\355\305eE\355MYz\246o+h\232\3115\013\356\275E\257\f\360K\337N\350\322"
+	.string	"\370"
+	.string	"y\242\034%,\035.\253\301\322\241"
+	.string	"x\tm\233;\341\246S\023,\246\267\245\357\273\226\352\223&\316\331\346\225\334\275\364H\204J\222\317\236\241*}\027\235\232\244\177\360J\017\343\f\236\344\033\030\321\f5\251\216\267%\375\313\0313d\3745\265e1\201(\250q4%\231BD2\"\222$\251\2441\241\005\204\030\006!4\017\021\020\245C\216!\252MRi\f\223\340\215\025G\347c\323D\207z\020R\005\021\t\016\302\035\002\330\310\346\235R\211\321\232N\033z\214\034\006\357\364\227\370\221\2263P1\250F\211\345\031\215\006\327.D\202\221\261\374\3208\363|\024\237\310P\234\030W\305v\356\2141\371>\035 1\003r\277\r.4\231\261%\265~Pyt\021:\373\202\276YQ\227 \300\016).gv\230\206O\213\266XJ\006_2\226E\2303$\235\277|g\243s!"
+	.ascii	"\217\340\244e\266\001|\345z\356P[\231\361>T\342\257jN\250\220"
+	.ascii	"L\311\303"
+	.string	"\202\024\rF\033\261\020%\020\273=2\013-u Nd\343I\203R\013\365\267\220\334\375\004\3527\301\215\357\257T\301K#\322 \336\376\251\354=\003\360\f\376\250\001\030\321\337\262\350=)\345lo\330\007h,\277\016L\223\032P(\330 \2140\256\310\005=\263\336\300B\3341\345\031\266\024\006KX\353\004r\001\315\334\220V\255\223\214\266\240\035\345\235\367\220`\314\340v'\237\224fpH\026\006\317xN\270u>\033\001\322\027\276\026\355\240p\370\26615\222\r\351\2532|\365_\b&a\364W/\260\"\370\0321\325\031Wc5ZS\027\036\311\216b\3026\304\361,<vI2\006-+l)\2727SB\302\326\266ra\240\005[|h\0134Z\257\323U-\034\374_+\310I\206I(\314\n\242|\322O\255h\257f.%\312l\310a\216AaN\016\316X%\332\347\201\274#2\r\035,\372A\001\230\225"
+	.ascii	"G\274\026%\3608\030R\262\266\272\276Tv\276q\364\024\220JJy\301"
+	.ascii	"\017\34299\347|\365\300\237H\354\252_\333'5\326\357\345\252D"
+	.ascii	"\325&=\363\034\016\237\f\376*/\tF\256d\002Ao)WL\204:\031\345"
+	.ascii	"\370\307\242\277\223.A\204\253\374\357\304\211\036\020\033\330"
+	.ascii	"\250!P\343\266)\340\r\031\2737m\235\302\211\026Q\310\344\323"
+	.ascii	"i\372\211v\347H\250"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"(\265/\375`W"
+	.string	"\355\005"
+	.string	"\302\210!*pE\352\374\377\377\353>\377UU\205;&\343g\210G\006"
+	.string	"\366\005@\250\252\370\037F\266\326\226l\315\300\257\314Tb\327\b\221)V\250\376?\36442:\377G\220\023\030U%\310\001\227\323\377v\026\360\355A\275I\332\0221\002q\204\fq\021>\020\326\261\322Q\334\265\201\3327\013\231'mO\254\223\316%KF\003\251\327n\326j:N\004\004Y\355\2446\273a\261\206\202\271\330k\003X\364\371\377i\253\306\266&\002\026"
+	.ascii	"5+\030>E\326\317t`\004\303\345\227\253!@n,\271\201\334\212\312"
+	.ascii	"m&g\201m\346j\030\320\027X\003~P\301*\200\036\340\017\030.\220"
+	.ascii	"\341\262s\f"
+	.text
+	.section	.gnu.lto_.refs.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"(\265/\375 \255\325\003"
+	.string	"\322\212\035!\220\033\322\032\253\333\375\377\377\377\377\263Ta_Ya\034\240o(\324\312\206\366\336\204\220 \"\367\226)\037\346\244#\200\336H\266\306\032C}\261X\213e+\326\024\312N\250%\356\210e\210\263\017i\207\273\341,C\272\271\027\316*\244\023n\204\200\017\024k\260l\201\262\004\367@\262\314b\227\262\272SA>\316\242\344\223\234\0079\r\t\320<nt\333=P;C\366\214"
+	.text
+	.section	.gnu.lto_.decls.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"(\265/\375`\364\037\355\227"
+	.ascii	"J\372\b7R0\220\312I\007\372n\302G\375\"\007\273j\205E=\277\264"
+	.ascii	",\rkr4O\256N\261\356\037{=\253\007\365U5\264\355Pc2\335\021\273"
+	.ascii	"\252\306\350\246\271\017\006B\240h\224* ej9\224\nr\b\f\256\332"
+	.ascii	"\246\245\231*.\310\231\033m%\226\354-S\337\002q\003n\0039K\260"
+	.ascii	"`\371\260\350o\243,\f\013\226{d\213Z\245o\031\306\314\312\242"
+	.ascii	"\277=\260\205jg\303\265\023\310\006M\312\330\027\035\307&-\262"
+	.ascii	"\367\354\321f\373\324pl\r\275Z\250\216{\217i2G;\007\013\325r"
+	.ascii	"\255w\227Wgv\326W\360\300\274\240A\303\362\334\302en\255K\032"
+	.ascii	"-j\235\366ss\336A\3275V\202\002\013\325d}\245\235\314\f\232\274"
+	.ascii	"\251\313y\265P\315\326m?\3115/S8\223c\3073\347\265h\250\310\007"
+	.ascii	"\007\223+"
+	.string	"8\001\320\274\017)\221\2707jv8M\273i'\0204\016[]?{m\274F\203\327e\372\f\322K\327\207\"\036,\036K\030)z7t\237]\320\254X\364\226\013~\277\315]\3510\273\206\373\361\345\3344\353\3129\263\3516\255\246\327^\323u\267\353%\370\215\336k\232\256\341@\274\310\271y%\224\324K\373z\346\234\213\212\206\212|wuxv\030\275\r\202o\247\360\255\022\337\"\361;\017\277\343\360\373\314\337S\232J\303u3\347d\316y\200\234\031Z\242d\261h\273\031\275\315\b\245T\3145\217]\264-Pz`\360\273\013\356\241&\303\r\246\303\364\372\241\305\274\335\372\355>\344\232\327\2343P\253\001\362\264\214\202g\310\271?\244\275\267\327\037\322w\021\034\324\036R\333Bi\177i1wo`X\364\255\205\337L\374\266\001\237\006\374\261&|\264\025\360\327\262\370\304a\022'\317\242O\001\037\005\276\263=\244\327"
+	.string	"_\256=\244]\245\255\364j@\227\275\004\005\277\307\260\f\226\363\n\204\336h\353A\304\242\247"
+	.string	"\277\rH{\257\rHO\204_\327\036\322\b\332C\232\266P\032$\366\367W\203\265\224\253\224j\346\261\234\327\016>)^\232 -\332N\372I\257-\345\357(\035v4\254\231\305r^}.\362F\333\231EC\264\207\024=\224\003\205\311\024\334\3427Q\n\324D\351\327\366\220\342\026J\377\256\322{^\336\331\337m\376~\203\367\367\013\035\342\277\031\027\177\263\360\367\361\016\374\007\021\366\241\277\023H~\304\177Ix\n\235\377\202\360w"
+	.string	"\317\364\277&\016\370\177\377\253\3015\372\017\347\357\373\277\354\3578\177\377\377\336\337\366\177\226\277S=\235\240\377\212\370\033\356o3\177\227\371\233\314\337q\177\313\375\215\246\321\376\006\363w\230v\363\037\350\277l\177\337\375m\3677\335\337i\376\366\372;\311\337F\376\346\372{\310\337A\376\376\361\367\326\337Y\177\357\370\233\371\267\215\377#\374]\303\1771\377\277\374\215\377\226\372;\352o\241\277\225\177\003\375\235\374\033\3717\r\177\317\360\267\f\177\307\3607\f\177+\360\267\207\377\"\374\315\363\367\316\337:\377\245\374'\372\317\366\037\357\355\355\355\375\366\350\367\351\375C\311Lp\320\"\022\006\365^/\324U\022\255\371\330t\315<\3463S1E"
+	.ascii	"\311\260JFY\364\326\360\203'f\312\272\003?'\007\321M\352$W\240"
+	.ascii	"\036\344\r30\313\247\213\324\001\363\302\314\027\213\336c\312"
+	.ascii	"\306&\243i\321\347(\361\177\363\033o\n\224\035y{\255\347\344"
+	.ascii	"\fN\2318Dxc\236\274\340\364\031\342\325\332\323\352\375\371\202"
+	.ascii	"\334\0216\026\275\004O\373\243\333\326\306\352\312\3303l\234"
+	.ascii	"\324I\340\305\312\271=ic\357l\236uc\361\354\033\313\246W\373"
+	.ascii	"\2648n\325\3305\037j0\373\264@l\027\020OJ4\013\224\272\247\365"
+	.ascii	"\321W\310\250\374\226\307\323\366\3503M\252\324=-\032k\007\342"
+	.ascii	"I\231Q*\253\233\032^EEC\026\007\033\214\266 \024][(\265uF\340"
+	.ascii	"\210\371\270\202\351\346v\262\310\251!\223\346v\356v\275\241"
+	.ascii	"\271\321\321\343\326e\303\030\266f\262~\202\020Y\313\262\350"
+	.ascii	"\323#\370)\021\354F%\311\304\242cz\265d,\333\030\031\373\305"
+	.ascii	"\306\221\241\251\331\362\354\3110\360\260\240qp1b\324)-j\305"
+	.ascii	"\350|\251a\243\313\036\230^m\230\317\021e\035\231a\321\267\261"
+	.ascii	"N\373#\216\356\215\363\366\215*S\301aQ\267\234\271e\230\2604"
+	.ascii	"\270\315\262e!\341\226f\360}k\370\276\2645{\306I\325\024*X\315"
+	.ascii	"n\351\325r\261C\206\270\330 \026\207eN\231:.\226\210Mk'3('\347"
+	.ascii	"\340\324\025\025\365\224-q\324\244\250\230EC\323\225\305b\261"
+	.ascii	"Zz\265i\267i\226\313z\375\034;\344"
+	.string	"\354C\257+\3152\261a3R\272<\346\356Y\304#\325\343\352\210Q3{\326\253E\263W\306lY;\231k\236\361c\2459\346\356\211fs\260T@<)C\320r\246\016\247\t\321\022\344\253\314\212\017\214\263#d\310l\225\035\033L\247\026.\374\223\275c\024y\301\346\003\277\327\247\261S>w\303\227\033N\262\360}9\360}7\360%\b\263M,\224v\216\235p\233\213b\245\364j\303\354:\026\346\205\256\356\207\353\310\227\223\024\275/\n\243K\222T\332,j\277,X\257\366\211u\222}|\346\256\324\220X\364\276\214[\344\\-=\212\207\217\266\301J\354\222^\255\227M2\264\346\\\346e\213X$ \236\224(v\274\251\003\363\262]\235\366s\\\263\f\036\256\2561wCEE9<\262@\021\222\242G\253 9rq(\257\350qa\302\r1b\207\360\230\211\312sR\360\321/|\324\b>\032\004\037\275\2627"
+	.string	"Q\321z\342E\003[!Gm\300G\223\3707\017\377\246\301\277q8\002\273\245\325Ze\204\250YT+\213G\rH\224\032V\267YX=9\203\345\234A\3704\303(\241bQ\213e\355\016\333\274\305\262W=I\213\205\346\214\354N\340\247;\001\237\332\020\244\224\024\375}\303\226iu\314\230\342T\352\310\201\303\300 \273bQ\233\303\342\270\217\225\266\247\233-\370ml\225\216]\334\033\220*8\264G\021\263\257\033\226F\317\2236)eh4\354\324\317~tr^c\2634\254\fK\325\3161T\211\027\033\266F\257\226\206]\276s\2603\216\2569'}\234,\327\320\244h\347\213f\251~\033\243\321~f\233\003\3307\273\035O2\334s\223\340\337J\031"
+	.ascii	"\264\336\230\342a\303\207_.\030\236+`\226(y~(\362Q\003'\247#"
+	.ascii	"\005\363\353,[\177\254\261\350}\313aV\261\275xk\353\365\272\341"
+	.ascii	"6^X\362\236\206\207\213\220\255.\370;e]p\\\335\225\333\024\374"
+	.ascii	"\2350|\265\\\265^\035\270[V {\003\0342)L\360\333\201\364\356"
+	.ascii	"\355\265\003\351w\220\340\357paA\363\211ya\343v\321:ML\233\324"
+	.ascii	"\323\r8\304\332\036R\242\026J/\225Kv\253\374:@M\320|X\331\302"
+	.ascii	"\277c#\by\263bQ\364\346\360;\205\215\253kj\007\376\225r\305~"
+	.ascii	"\235\0379\"d;7\360o\230\317\312\036\033\034\026\275Q0\324\216"
+	.ascii	"\322\201\235+3\254\033\345\277`mv\327\025^\330\203\343\306\242"
+	.ascii	"\367\311\205\362\273^'\371\256\0234sF\336\025H/g$Pw\002\335\t"
+	.ascii	"\240M\266\270\252\244\350w\236\260O\013\2456\206\321\357\027"
+	.ascii	"\217\333\226:(h\360\257\222\276^^\2356\224\217jB|5\341\360\273"
+	.ascii	"\323\220$i\275\020\310\240\234\203\344u\251\341\353\210\025\271"
+	.ascii	"@\256\221\326"
+	.ascii	"C3\220\234k<\200\325\324I\202\257\303\203\253\327\313ea\370\224"
+	.ascii	"9/\033\340Z\363\230O\314D\f\234(\026\275\216\f\374+\244/\016"
+	.ascii	"\277@\356\220\373\002\315c\0319\203\002\254U\304u\242\360u\236"
+	.ascii	"\360\373\276\b\322\353\r\322iC\315\243\232\020P\226?n<s^\023"
+	.ascii	"\341;\223RUd\255G\217\373\243\231\032\220\321\325\371$\3212\344"
+	.ascii	"\311\365\361\373\343\007L\255\016\357\305OM\310\263\312\326\326"
+	.ascii	"\315\n\341\252\231\243\214\252\361\205I\263y\263\252\272\362"
+	.ascii	"\230^@ZM\336\224da\0259\262%5$G\216\273\003\037=\330\350\312"
+	.ascii	"c>\255\221.\033H\356\325\357\216\2362L\322\330]\253\001\300\354"
+	.ascii	"\240\\\253\253#\205\322E\211\227{\324\251\341\207V\r\254\252"
+	.ascii	"\252\313\304`\315cze\246\025\221N\326\f%M\336\346\227\351\013"
+	.ascii	"\203\204H\025\213\036S\341\337\030W\306/\325\251\256\r\234s\356"
+	.ascii	"3'\223I\204\177\334\210\222\252\361k\003\250\n\233,n\227\206"
+	.ascii	"E\"\344\315\334\245qgp\225\215%\255\222Y\366\024f\321\273\354"
+	.ascii	"\270\2369g\325\334\023\377\366O3\222*\347<\303\267f\252\247\236"
+	.ascii	"\264}\335D\277O\337\2439#\300\264\346c\03406\370\310\031R\207"
+	.ascii	"\r\221\357s\346\234\324:n\240\265LjU)\305\264\3621I\344\330\201"
+	.ascii	"*k\035\225b9w\310\311\344\361D3wP\212\345e~\021f\331y\325:\346"
+	.string	"d3w\310\311\214\f\241Lj-\225b\310e\007\245\230\3262\213i\345\240\234DR\301Hf\252\016YL\313.\2135\227AJ\261\346R)\246\205\325\\\312=\252%\034\260\2557]D\231\3141\246\254\220TAN\345\332\314r9\367\030T\246R g\253&\225\034\262\252\321\236\2341\236\312\220\315\017SO[\315\234t*\2214sF\362\224\224\247&8\256\316\034\244\235G\036VY\n*g\002\246r>vv\346\234\2179\347\034*\2535\347\034A\312\256\251\251\234\231CS\331\352\210\005*g;f\006m\251\024\333j\032a\231\"\326\225kX\217\335\225\345\264\250\260\3301J\226Z\203\273\2264\324\\\251\365J\365\031\242\234g\204\370\242\242\022\361\034\262\250\367z\243.RG\211\"\301\253\353O\032a\034\252KGD \223\212\005\212'\364\220\b\256\030\300\305\n\241\221i\204\243!\007*\013`Q\310E\023\223\t"
+	.string	"\214M$\220\232\204\202C'\036\242\257\370\3531\376\206HM\276!R\323\305\352\013\302\"\352\242\211)\210\022\215M\367H\3159R\213NhP-\346\234\370Cj\032\341C\004&\005Q\027DcQ\210\244\232\3603!@\013`\004#Z"
+	.string	"\177\214F\f\205\"4-\251)\202\226Tc\321\305\t\277"
+	.string	"\320\022#\224\200&\214\351\223F\004\177C'\"\211\340\n\004\212H@\245\017T#\320X\334Q\215\300\243&\024\\$\031\225\200j\bE\024A<\306\240jTO\370\250\304\022~~\303\017\214jQ5\001\251i\200\007\205Du\250\"\341OP\001\004\025X\320\"\347\026\\\020\301\005\021\244\267\340\002#\243\013*0\302\257\300\350\272"
+	.string	"4\301\304\t\016X\250'\036D\002.]\343\257\210\202\272$4b\343\223\0300\n\207(\214\302\241\020%\032K\b\016\235>8\002\252& \001E\b\340\b\250\022\321'\215 \200\250*\035\r\201!\b\031\207+l\361\027TMh!\bT\241\244\0044\321Ahl\241\242\306\342O\330t\302\n\365\304\017E\t'\360\250\301!\320X\034\n\261\361G\002\nt(,aX\f\246\302\246\342-\376L\224@\301c\242\004\n\2354XBx\235T\220(\022U\026B\342\321\207\342O\204 \242j,\002\227\322\034\225\005P\351\004\247\246%\354\364\303\305\337\211\242\223\n\036\365\2476\271HQtR\241\223\303B=*:\251H9@\002\246\020\032[x`\034\242@\002.\371\f\205@\020\224\230\230:\370\371\212?\026\352\t$\340\022.\372L\234\340"
+	.string	"\t\270\224\236\b\n\215\352\020\t\270$d|\222\321\370[\241\036}x\322\210\242\001gjR\211$\214LLD\022<."
+	.ascii	"]\334b\001JJLD4)h\0246\371\212\252\223\022\220E\352\364+.\t\211"
+	.ascii	")\212A\341\022p\350\342\2041\tI\250\264\302\203\013@\342e\"\252"
+	.ascii	"* \001\227r\212?$\341\212!\223\t \343\257\002#\343P\2303d\022"
+	.ascii	"\032\201C\241RP=R\177?C$\241\022PG%\002]8\"\002\223z\324&\027"
+	.ascii	"\306\242\223\212\237bQ%\036\035\001\177\301\022B \343\317\002"
+	.ascii	"\343P\350\224\243\006\205,\324\243\237a1\370\0236\025\177H\300"
+	.ascii	"%\036\343\017\t\230\202I\230\203\004Lalr\"\022U\343P\330s##\023"
+	.ascii	"!P\030\001\004\034\034Q,\002\233\226\230\202$\212D\246\342P-"
+	.ascii	"\222\030\n\201K$\202\304\"\211\021 \3400Q2\034@\266\364\356\013"
+	.ascii	"\236/az[\362,U\316\223)\034\3127w>zZ\336\260\301\273J2\033PS"
+	.ascii	"\236\327F"
+	.string	"\224\330\022\034,\272f\315\275\033j\3362\313'u^v\312L\217\314\266\371\275\353#h\256\350,z\331\334\f\353\301hC\353\264\255;4V\360\355\354.\263\303\354\276\230D\350\027\231\2513,::\013\203((\347\2557\264\037'yK\202X\364<R\370\315\244o\223_+\275\336&7\315U23\215\006dX\211\320\t\353\372rgQ4k\331\032;0{\370\rvv\261<9\223\345\242\201\231Y\273^\224\274\331\256\213\306\243LW\334=s\315\\\271;\346\226\351\365\222\271l\277e\367\312\333%s\323.\0270\271kF\346~\271b\314\350\352v\242\264\234W?\350={\232'i\302\\\270^\257\230\261+\306\006\202\204\250\"\271<H\022\235B\n\241\221\231\231I\222t2\n\020\004\303Y\240\210\271\036\022@%EN*\310\204HA\222\024\n\303\030(Rv\211D|\f\205^\315\356\322\031\264He\3065"
+	.ascii	"x\303>\375\007\315BU5\017b\207^\332]\305\361\241\200\344\034"
+	.ascii	"I\021\0060\224\031U\2507)\262U\b\\\333l\f>.\361K\347c\201\024"
+	.ascii	"p\225\035\353t\363\034O\230\340n7E3\314(\251\324?J7j\203\006"
+	.ascii	"\2069\232(\374\005\024D\013G\313U+\210k\201{7\252\364jAzkO\235"
+	.ascii	"L\245\313\3356E{\305\r=dM\310r\313\262\024\275\006\"\017\225"
+	.ascii	"\322\224\"\355\020b\225+\217\300\363\325$h]\022bB\351},Na-:\024"
+	.ascii	"\234\007\224\354 \301\002p\376N\200\370\332\242:\370\360\360"
+	.ascii	"\016{-0>:\273c\214#\375\224\207\233\263\224{\201CL\346\373\306"
+	.ascii	"\034\005\n\2652\032&\241%\033!OQL\361nX\253\266B\026\273T\236"
+	.ascii	"c\027\350\004V\005G\223\301\\\351qs\3100\244\213f\220\021\250"
+	.ascii	"\026\332\030$\025\216w\205\220\2215\310S\363:\241\f\304a\225"
+	.ascii	",I-\205\363\327\002W\262{\001\250M\233#\355\277W\356\366\325"
+	.ascii	"\r?\264u\352\024\253\205&(\253\256\006\222?\212\n\314\253\277"
+	.ascii	"\232\241'&\220\360\036\236\031\231w\004\242\213AA`<Z\016C\260"
+	.ascii	"\345\345[\3073\3603}\320UW\n\017w\354\f\\\331\371\213L\006\037"
+	.ascii	"g\177\337HG\262>\276\226s\370\206\f\030\233\246\235\334\361x"
+	.ascii	"\2558\365j\233\306\303T\305\030\212\216\342\236\020y\307\213"
+	.ascii	"B\201\035\0263\036\240\266\004\b(\003\f7\307V\"\034\r0\255:M"
+	.ascii	"\1778\033n "
+	.string	"\343\026\211\233\234\356\3218\246\3652FZ\202\262zSVH@\224qs\030\324\326\325\264{9\241\320u\"\213\033\275\tL\250W\035\261o\342\242\330\243tQ\270]\032_\357\203\200\270\004\001\232\310\231\262\326ZAM:\006%\\\0228\271fW\274\201\t\270\024\005\375+g\244y\327\002\253\324\013\256\003\354\316\350!\355e\252n\240a\235\321\025\313\275q+v\274\253\245\372BQ\3352\346A2\324i\211\037I\232"
+	.string	")\317\352\017\306\254\022"
+	.string	"\003\203Y\377\301\267\237\351q\f\275\325\005\212ds\270h{0i\013\231(.\230\307iOW\333c\376\201\205\271G\002aU\024\264{\016\327H\350K\315\rZ(s\022\366\374\337;k\306\260a\026\024{\242\276\232\nY\364_JB\3064\210\222z\330\2158Q\362\311\203\233\370t\336N\201\232\013\247\214G\224\204\210X\214\221\342\022l\002\230\\\b\016\222\333\032\366\266\356$Y\007\363\362\215\035\230\220\323DC3q\2671\304\270\030x+>\277o\272W\204\205\321\304]r\321\021\271\315*\234\257\370\231^\236\237\361\324\355\233\264\203\311)PwX_\030n\007<\227X\212rF\206\253P\202\2406}NW\375\240}\257\365\362\321\273g\316N\345\3723\024\224\277\036\374Z\004\374\2364\237\270\304U\371\260\303\035\366m\020\322\266\222`\tGr\317R\n"
+	.string	"B:*nKb\323\017\235#\267\021\321`PR\217\002n\301O\265\264\025\200\332\275\02452\f\025\360\f\303\341t\307\303\266\214<G![\303\342SBL\333\273i\261\333\232Hxq~\005\352`OH\271\240$N\266\322\257ku\210\223P\023Q\201\032Z0fQ\r\251\335\2522\213\366r\301B\002\r+M\006x\n\276\271\254Kytj9\023\202\210\370\343l\377\374\217\305\3715\262\375\\;g~\006A\310;rl]CY\300\306\204m.\237\246\037L \231I\007*\252a\205gd\004}\235\260\t\311\307\001\241^\230\305E}\330\006p\r\212\330\353`\247&\246\r\3505\375,\233Mr\004QCSc\356\017]J\325\322\246\337\260[\273\207\267\240\016\361\267\251\273\2457\315Z\035\303F\fm@j8\240<i\252F\312f\032\216\271\3112\203~R\272a\367\322\240\311N/6\220\2556a\026"
+	.string	"\331F#E]\230k\013e?\341\347\005r\326\200\201&\017\241\237MY\351\357}\302c\362\213e\256\037c>e\261T\216\365\250\020ltT\340\260\262u|H\367\244\324`\250\315\23304=\334\013\243\324\026\\q\240E=\001\017\210s9\204\030\352\\\2135a^\033#\335\272\212\262\022\226\2143\355(\377!\304\375.\364c\271nt\31767\361\001$\016 $\304\327\031f\177\314I\330OY4'.\320ww\200\274\304\0065o\255\307\324\333A\247\007\017Lr\347\231\335\226_\313\347\323^\303\222\321\203\352\223\275\314R\374\253\370u$o\236\205Q48\306L\0021\n\317\303oC\270+E\262\276\374\257"
+	.ascii	"[@d\035F\216\026Z0z\036\232N\274\3379\275\256\215\306\177wO\363"
+	.ascii	"\356^*\251X/\307V'i\0365G\261\027\025\273Qb|\030\364V"
+	.text
+	.section	.gnu.lto_.symtab.4ecfdd8a3e94d6f3,"e",@progbits
+	.string	"pgResetFn_compassConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"compassPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"compassDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"mag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"magDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"compassConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"compassConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4ecfdd8a3e94d6f3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,708 @@
+	.file	"current.c"
+	.section	.gnu.lto_.profile.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375 \3325\004"
+	.string	"t\006\316"
+	.string	"\017"
+	.string	"\234\302\225\226\013\022\002"
+	.string	"\002\001\002"
+	.string	"\002\002\003\002\003\002\004\002\005\001\240\342\234\212\n\004\246\201\307\205\t\006\005\267\235\363\261\017\002\002\003\002\006\007\b\250\335\362\322\004\004\001\t\353\266\342\341\005\n\303\213\370\313\006\013\340\207\245\357\f\f\244\304\344\337\f\r\016\017\242\302\263\302\013\020\314\251\277\367\n\021\367\343\320\264\b"
+	.string	"\013"
+	.string	")\021\304\270~\030Gq\3063PHsTK "
+	.ascii	"\250\362\357,ce.\030`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375 E\215\001"
+	.string	"\3409"
+	.string	"\006"
+	.string	"\001\001\004\005"
+	.string	"\001\001\b\001\001\t"
+	.string	"\001\n\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.string	"\270"
+	.ascii	" \210J\214\231\201i\336\2412\370%\214\r`\001"
+	.text
+	.section	.gnu.lto_.inline.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"M\006"
+	.string	"b\213$+\200)I\007\334p\271\261S\370\212\327\303,\330M?\030\345Z\004"
+	.string	"'\206\2041\260\250H&\244\373\312\020\350\333fI#\255m\271S\357<\3478\335t\323\001fXT\\\340\017\tz\206\314\224\374\3623=\211c\272\3607\027AL#\343\247\0321ixhn(\330j\005\b\301V{\334\200TYN\177?\276\363\004(;\317\003`_\241>*\240Cf\016\274 `f&\366/\241h\345\277\027\202\023\231\331x\325\t[\215\240\177\252\030l5\201G\237A\025"
+	.string	"\031\033\242g\302"
+	.string	"S4G\002\254\276\002\001+\310\340\257fmL\0026\b\322\306"
+	.ascii	"1\004\004\206\270\204n\005Z\002]\226\033@\253\034\205\0373C)"
+	.ascii	"\200\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375 \274\005\004"
+	.string	"\362F\027!\220)\351WK\215\277I\324\020\265\267\377\367(wi\001v\367\233o\253\216K\347\033\332'm\023\231d$\257\177\326\366"
+	.string	"\275\301\227\t\b^\232fFR\311\013w\3077\356<0E\t\362B\362X\2124<\317D\241T\202P\273\235\364N\352D\324\026\2675\227\"#\025k\017=\023\031\001\r"
+	.ascii	"\272\222u0\203s\006\202c4\233\234\363>\200\225\fe\005\316\036"
+	.ascii	"\030\343*\233U\206\334@\033"
+	.text
+	.section	.gnu.lto_.pureconst.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\232\004\004\232\004\005\230\004\b\230\004\t\232\004\n\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375 \304%\003"
+	.string	"\262\004\017\031\240)\035\377\343\273UU_\037W_\305]-\360\265o\377[^\322\210\224)3\215\263\250\237Q\007!)/\203\264\326\210\372\373\370\003?\217r\243\237\302\211\362\242}\276A\334\266\377\t\017"
+	.string	"0\244\216\r\350\030\023\305\006l\300\323\341\200\341%5\327\244ZW(,\247Z"
+	.string	"\2320\252U\230+`"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_.lto.6c18fbd37e5b4677,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_currentMeterSourceNames.22.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375 \344\025\006"
+	.string	"\244\n\217"
+	.string	""
+	.string	""
+	.string	"I"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\257\001}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'1\270\257\005}\276\003\005\001'6\206\b{\by\301\002\005\001'?\b}\304'D\206\bw\bu\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004MSP"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004ESC"
+	.string	"\bVIRTUAL"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\b"
+	.ascii	"gH\315\323\216\253\266\346\231\007\310\334g\326\001j\277\001"
+	.ascii	"\024\001"
+	.text
+	.section	.gnu.lto_currentMeterReset.25.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"\315\b"
+	.string	"FP<8@o\323\001XPvq\300\214\307\230\t\247\032!\031\233\320\004R\\\025gh\275\224}\315\016\365oWH\032\350\3540\214\016d\177\344\216\r\201]\3215W\372\264\355\336)\005)"
+	.string	","
+	.string	"-"
+	.string	"\237\366\354\230\207\340\236\004\2740A\355.\225\033\367\036=\377!\007\020\215@\217\233\206\335u\024\2152ny\333\007\266\027\354_\001~\351\217U\345\002S\200\262\213\221\232\331\323\\\351\270l?\332\3778\210\367\322\347\002\273_K\312n\250\340\004\353\323\341\t\252O\353\003U,$\317K6\036&\024\302m\211\217LX\273\313\340\213PT\004\200\034\237\376\247\372\234*&\222L(\246\354\020\024\245\206}\315\356\256\345\3475\353\262\3164\306\351\264\254V\017F\271\272qZ\306Q\r\342\241C\261\312Q\216\201\267\210\254\322n\333*\275\302\275f\345g\207\227SHZp?\t\017"
+	.ascii	"2\241c\034\030\027\006\\\003\016\242`1(\306Q\224h*l\310\004V"
+	.ascii	"0\357\022@\263\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_currentSensorADCConfig_Registry.30.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375 \230m\004"
+	.string	"\364\007a"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\346\261\023\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\315\030us\334\007uq"
+	.string	"\005\001\006'\001\004\200\002?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_currentSensorADCConfig.32.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\320\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\220\003?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")C\017\240\b"
+	.text
+	.section	.gnu.lto_currentMeterADCInit.35.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\235\013"
+	.string	"\026\226N>\020Q\225\016+8\264,\302\313\232\241f\354\340g!\230\001`\316\357\316\004\364\204B\t\267\223\333\320\200>0\222+\025A`\261[Q\004\262\b\342\220\234 \374D\005\317:\332\032\333&R\246\024;"
+	.string	"6"
+	.string	"?"
+	.string	"\371\364%\022\226\213\0024v1\2046\266\025Y l\177b\217\035\343\240i\257\3220R\325\330]L=\334\363\364\370\027\361\310G\372<9\024\354\256\363#e\270\365\266)\266+\366-\004w\213G\345?\035\354:L\273\336?\037\365\324\346\177x4\205.\377=\372\335\343\321\356T\310\177N\023\251\226H?6\bJ\355`\377Z-\331\232\216\232\2764\255\231\016\341\f\033\002&\377E%pA?V\365\352\033\f\t\355z\224K/b\001\312\320\251\252\006D2\256\251\037\335\260\263\2534\310n\b\201O\342%\"d4\232\307\343\365\300\213\025!P^\206\216$\200\316,\234\215\306q\235\f\353\270\255\333h\035\266\311`$`\031\327a\226\001\336&h\034\306\3316\016\233\200\336\257\325\322\002\025-OA\026\220Q\177z\212\013\344\304Q0hp\2718x\020 \275:\007\030#\300\004a\026"
+	.ascii	"3\241\005)\360+z\027\310\004\f\004\311\240{i\226\005\3420\225"
+	.ascii	"\211\244\222q\003W\246\233\313\232R\255\0050B\\\345\343\232\310"
+	.ascii	"6\004\3752\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_currentMeterADCRefresh.36.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\345\b"
+	.string	"\266\220>90%\2511\200\003\250\311W2\263\204\241\020e\365^?.k+Z\214\006@\024F\332\245\344\017\331wr\255\275\3050\307 \r\252<\276\251\353\261\020S\350\226\261&\367\226)\005*"
+	.string	","
+	.string	"0"
+	.string	"\004\035\313\206m\216[\"\267kd\303\005\373?\263\020\207\216a\355\025{R\252\223c"
+	.string	"\304\377\306\224j\345fn\233\320\366\241-N\326\376\277\031\253\325\266\016\032\005\233\237#\026\340/)S\262\265ul\215\342\224\320*\246z\376\017\230\230\377\re\020\260DpA\307Rs\250L\343\363\213\313cRs\262\340\226d\027\223\301\315\177\207\232\305-\0305\211e3J\321)\313\272\324\261\334V30"
+	.string	"\250\030k[\247\230\201\264\001`\004\007\202(F\023\340\007\262\030h\350\003\2128\317#\205\346\347u\237\210\373\246\250\002t1C\3367?\007\355F\2347\301\256\363\346\326\272\265g\254Jx\274\002\f"
+	.string	"2\241\343/0.\f\270\003\214\333\224$3\225\200"
+	.ascii	"\363.\001\020\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_currentMeterADCRead.37.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375`M\002\025\021"
+	.string	"&\337lE\360\322$\0352\343\363\374\253]QC\330{g&O\266\217\206\367g:\374\263\327\205\306b\276:p\033\217\215\n\302[\024l<\2260\321\3348\255"
+	.string	"\037\213\n\364\214U\321y\207\031\"77k\203\265\266\367\2262\245W"
+	.string	"R"
+	.string	"_"
+	.string	"\033\033\261\b\352\320\261\207\304C\324\r\304C\267\354\034\217\355\354\203X\324\004\355\330\335LA\274\365\b\237f\313?\225\354\356}\016\240s\305<\342\034n\320\220\357\346\372\024\344\020\335\bp\321\274\220\243\017J\367yrp\315d\236Jv\327\331\271l\356\323m\257\330^`\347+$\376\211\377d\360y\016\315z\311w\207\376K<\274\202\330 \301zd\262\311\216\305\244\276\354\277\335]\253\216\375\236?\300K\307\227\206\232~\231\326Lg\246O E\342H\204i\267C\223\2175\2022D\244l?\355\227\270\211\326{`^`Wg\b\306\006!\272\034#\325\227\023\374$>\255"
+	.string	"\204\203&{\330\237q\032'>\217%\240\344;\224x\370\024\376,\301<\250\332\023\036\203\302_l\r\222\234r\027\253\221\244\303\026\252\003l\224`\251\266\366\025\271d\341*R\244\246F \361\270\332*G\021ta\005d\207\007&\036jQ\247\303,\007\332P\273\033\234\346\242\261@\257T.-\032\307\275\2542\026\267\261Z4V\326\242\222\302\222\2558V\246B\340\r\203\306e.\333\306e\251\330\376\255\352\330\001\314HFgbT\275\210(B}\371B\177z"
+	.string	"\207\351A\265\375\032\037z@\302\300\267\361\033\020\"\230\230\304\303\274\205:\035POE5?d\262\351\0170 \260\002\021\241\264\003C\241\213\213\341\021\352\336\315\314\226+\2263\003\033"
+	.ascii	"\303.\215\223\214\347\267\240\024\336*\342K\b&\352\201%M\256"
+	.ascii	"\024\213\355\034$$\203\207\341\254\207?0\017\n\300@\345\305\031"
+	.ascii	"\276!\026[\302\204\375\244\3707\302\267B\226\r\204Q\222\256-"
+	.ascii	"\330S\304\220\337\335`\326\035V\263\030m\\Mqg\0213\246\024\013"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_currentMeterRead.38.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375`J\001-\016"
+	.string	"6\332_F"
+	.string	"\261&\035@\310\262\002\302\364\204j\213\307\003\371\037\032n\213\305\351\3230\234\263\203\373A\020K\t\026\306[\324F\204\201NP\003\3064U<m\001\251\252J\004\265\210\311p\003\245PG\2668\262\202D\262\367\336)\005K"
+	.string	"G"
+	.string	"M"
+	.ascii	"\326\251;\033\307\301\323\236E\215\205\030\235\335\255\022\304"
+	.ascii	"\273\323)c\347\253\356Y\201r\372\325ChT82\236\312\347\245r9\017"
+	.ascii	"|5\033\004x)\323s\363\341"
+	.string	"\306U\217\027\274R\214\037\fv\327\321\344i\270\255\333v`[\201\375\022\001\340f\bw\326\206\306 a\373~\314W%Wa\002-&>\324\356b\247v\211\215\235\036\263\035\301\303tO\231<dwe\247^\247\006\257G\373\250\247\350\376rb\220]\0173`\354\202\t,r\235\032\270\307:\235\037\020~\213\211u\372\325\243\b\f\247\017\245\203\024\3038\263\343\246\303\264\242\2246\t\205x\223\247D\371\b\323g#%\213\001\374\304\272|\352\004L\016\034\033)\261\207\r\226\242d\261/\3030\f-W\354\247~\371\227\377 \"\250\217C\b\032\262F[6\312B\024\002(\37232\022e\333F\362\251\334\246q\242\214\253\"\320\203P\375l\\\035)`MB\266\325\221\246m\025\003IW\275\201K\016\217\034\222,\315\335]\n\372\013:C\203\"\302]|\270\310\320A\360\257\034z\013-\300iw\027\3702\025&\004\034"
+	.ascii	"2\003\002\035f[\330\204\025\b\256\006\306\0020\f0\t\200GQ\223"
+	.ascii	"\204*m\331\304\002W\b\325jQ\022\343\3025\227\331\b\r,\206{\201"
+	.ascii	"\375MM\201{\301\324\224q7\203\311 \006\315\233h\f\n\n"
+	.text
+	.section	.gnu.lto_currentMeterRead.part.0.47.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375`\324\002\355\024"
+	.string	"f\345\202H\260TN:c\245\277#\333G\363q\277\243\205\260x\311\341\221k\033\222\245\\Jt\331C<\234\3561\376z\244V\316B\240\351M\237\212\351o\302\332)\2208\343\315\017q\257\254\370\355\257\277{\315\253\275\250f\367&[\246\024h"
+	.string	"i"
+	.string	"s"
+	.string	"V\265\237t%\336\227t.`\227\blj\027\310ri\006\262K\003\2572/e'0/\355\327\260\275\0032\317^r\240\321^\212\312\307\251\311\356\322.c\213\363\036F\225<\377PG\351\371J<\324\236O\3501\\\360\243\022\n\340\353\tU\256Xl=x5\341\343Q\035p\031\213\260\273\226\235\270\347mc\260\355\300\216\023\002\352\031S\313\251\016\247:\036\370\353T?e\345'\345\267\373\363\004lUH\0360\376\364\333\367s<x\363(+"
+	.string	"\373\245\330\335\033\373R\307a\317\214\363(\0338\232\361\263\261\2733\034\365\231v>\224g\266\377\264\273S\216V\330\235\241\225K\307\246\337\340\335)\307(\273+\2044\220]\"\bgV=p\367%\235\002\300\r\002\n\031b\364\275\230y)\243d\342BB\021j\270\325\206W\315@\b\232\303\251:\260d\355\256\313%\2210\246\004m!E\017\037\242\\\037\036\004H\2143\031X_J\226\271\217\031"
+	.ascii	"F=H\324\374#\235y\031\253z^\017\332\366\0353\262\335u\361u|\212"
+	.ascii	"\306?\272\264\210\233\276w\233\227\217\017^\265\206h\374\222"
+	.ascii	"\224v\364\211\306\"G\371p#\221-S\307d\001 h4g\263\261\335\244"
+	.ascii	"k-65\266\\\356\246F\323\345p\272\032\233\216VC#s\243\325r:Z\313"
+	.ascii	"\001\343F\330r4\033\034.G\233\331\326C]B\214\256\257\256\235"
+	.ascii	"\310\343\030\306Z\256$I,\236\211\013+\237\260\351\037y\026\005"
+	.ascii	"\227\007>\222cY\270\360\3622/\365\376\321\363\2321V\345\023\366"
+	.ascii	"\277\350\375\212\304X\344\004\207\2312\206h\322\352Q'\366\257"
+	.ascii	"n\004\306?r@\250\201<\344\004\f)T\301\210HA\n\2421\200\002\221"
+	.ascii	"\2523\017\021\320\30143I\2612\0068y9\310\223%\276d\004np\336"
+	.ascii	"\037GInL\024\366+\034\321{4\361\016\252\304\b\334\374\005'R\242"
+	.ascii	"t*\3519\340\261\352\005\324p/\336@\201\245\016\352\367~65S\332"
+	.ascii	"\207\035g\031\016\toj\003\320\212\311\215\020\217\361*\304\004"
+	.ascii	"\216\\B`\355\t\013\322*\334\374,nH\202>\220\006I\013-\203\306"
+	.ascii	"\260\024 \244\017O\323\204\324\243\361\024"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"E\007"
+	.string	"D\n\216\001"
+	.string	""
+	.string	""
+	.string	"\002/\177\021\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\"\n\201\204\005+\022,\023\002\031\177\024\272\200\202\002#\177\025\005*\026\005\032\b\200\204\001"
+	.string	""
+	.string	"\003\002$\177\027%\177\030\002&\177\031\377\377\377\377\003 \032\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\036\033gistry"
+	.string	""
+	.string	"\005\033\034\034\035\030\036\027\037\026 \001)\177!\037"
+	.string	""
+	.string	"\200\200\200\001(\177\"'\177#\003\005$\003\005\023\304\001\003\005\022\344\001\003\n"
+	.string	"\340\236\212\256\001\001B"
+	.string	"\033"
+	.ascii	"\256\241\3736\310\314\3120\250\207\017\020\363/\275\2030\036"
+	.ascii	"v\016\201\200\201A\306 cV\306M\223=9{6$\226\364\210\003\3640"
+	.ascii	"\204\377Z\331\331\231\001\270\301\204\200PuD%\360\314\0334\226"
+	.ascii	"z\002"
+	.text
+	.section	.gnu.lto_.refs.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375 YM\002"
+	.string	"\364\003U"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\001\005"
+	.string	""
+	.string	"\002\007"
+	.string	"\001\003\n"
+	.string	"\001\003\f"
+	.string	"\003\005\002\006\002"
+	.string	"\002\007\007"
+	.string	"\002\b\001\001\001"
+	.string	"\001\001\002"
+	.string	"\006\t\r"
+	.string	"\003\f\002\r\002\016\002\013"
+	.string	"\002"
+	.ascii	"\253\322\220\016&\031"
+	.text
+	.section	.gnu.lto_.decls.6c18fbd37e5b4677,"e",@progbits
+	.string	"(\265/\375`\325\037-\223"
+	.ascii	"\n\363@5Q0\222\312I\007(\271\364\203>\225\027H\037\2164\002\261"
+	.ascii	"86\2630Vl\212)g\342\251j \264b\353q|\346\325\330\332\201\004"
+	.ascii	"q\254\205\317\376\305\230\370,\237\351\356\256J\242\212T\005"
+	.ascii	"\020\276\031\211\203d\340s\377\266\244\231x\216\037k\326\222"
+	.ascii	"-e\n\322\002A\003T\0039Z\007;;\352\250\030\263\031T\217?\332"
+	.ascii	"\322T\370\206T\370^\235\366\265\313\276&\261\016 \273\241z\207"
+	.ascii	"7\262\217@\310F\242\367\036\231\021\020bF\240\247\246u\334\342"
+	.ascii	"C_\231\366U\207uAg\337j\354\307\200\340 \330\231\202\355t\023"
+	.ascii	"<d[z\260\347\024\276\232\227\307)|o1{0\355\304\276\213\330\303"
+	.ascii	"1\t\037\327\261\034v\236`\273? \301\253Q\354~\335\333\034\n\312"
+	.ascii	"c%\217\235F\337?\354\371\204\217\363\370\204\357\235\264\257"
+	.ascii	"c\022>83,\227Z\032=\303y\303\314\001\204xp\361\022\322(\277\261"
+	.ascii	"\033v\226`\270s\034\313\275wl\336\246\335\022(\252FC0\t_\367"
+	.ascii	"\2659\334\233\227\307%|\354\203\321\271\315\b\237r\331\274c\027"
+	.ascii	"4\301\272\322h=\263)\361\253\022\306H\022\267\023C\315\037RX"
+	.ascii	"\215>}\314\3124\307\032UCd\271\204,\215\310\261\207\300\313\227"
+	.ascii	"/23\\`kB=\367Z\245q\2651\033\247a'\257\361\2313\032\316\202\\"
+	.ascii	"A\204\026\251\333\302aQ 7\373\263\231\232\214b6E\364\220O\200"
+	.ascii	"X}y\211\252c5\036c05L\331\303\303\225\0162\\\206{`'\253q\230"
+	.ascii	"\263\030\036s\306Y\324\270\311]j\230\322z\271\222\252[A\264\242"
+	.ascii	"\317\222\334.\213\362e\022\276\020lf\323\210\204p\374\260\266"
+	.ascii	"\245\321\363\226=\203\231=\215\237c\314EEM\335\275\367\013\237"
+	.ascii	"\261\223\321\270\354\214\205\277\2166\357\035\273\367\036\202"
+	.ascii	"\337\350\214\306d\334\305\004\216{\255\210\f F\246l\b\336\275"
+	.ascii	"w\005\321\212\037\250\037]O\037\372\033\354\217\354U\260\377"
+	.ascii	"\300>\003\313a,\306\316\2531\227\263\026\006{\017\262y\235\367"
+	.ascii	"\336!\316*c\314j\364\024\330\363\226\017 v\257\004\027ak\270"
+	.ascii	"\367\336\037_\315\367\266(\230\204\017}2\t\337\233L\302gy\204"
+	.ascii	"/\306\211\277\207\260\bt\007\372\333\207]\016\263\377j\377\323"
+	.ascii	"\210^\342\357\260\377=\374\037\343\374\231\20298?\223\275\371"
+	.ascii	"\031\201\237\235\310\375\274\026\367\177\204\377(\3747q\242\277"
+	.ascii	"\241\374\\\303\3174\374|\303\377\3727\020?\023\371\371\352g\253"
+	.ascii	"\237\231?\027\371\371\310\317H\340~\326\361s\325\317C\334\374"
+	.ascii	"\037\372k\214\377lm\375\365\363\333\317m~v\373y\315\317i~n\373"
+	.ascii	"\377\373\353\r?\263\375\\\366s\226\237\247\374\274\365s\223\237"
+	.ascii	"\263~N\3623\016?\207\3603\f?\277\360s\013?\263\360s\n?\233\360"
+	.ascii	"3\t?\307\370\271\202\2373\370/\367\377\315\1775\377\271\374\214"
+	.ascii	"\301\317\026\374\354\342\347\026?\263\370\017\347\277\333\377"
+	.ascii	"5\377\237\377\313\374\227\361_\201\377k\377}\362\362\362\362"
+	.ascii	"\376\206\373}-\376\001\266\002m\246\347\326\365\244\354\315\216"
+	.ascii	"\031\323jDS\356\357\211\223;:\310\274\325~d\302\204a8\357!/\226"
+	.ascii	"\027\327\275K\026AP\256p\201\372\222\306\316N\343;\026\273S>"
+	.ascii	"7\224v\314\340\335k\206\005\212'\316[\026\023\273\245\315\266"
+	.ascii	"4\232\357^n2\247\224w\251T\361\367\331\033\255\333<\333\320\351"
+	.ascii	"\260\026{;\357\3542k\274\267\304\220\346r\251\342\347\212\017"
+	.ascii	"`u\310\336e\247\003\272\367\353\336k\302g\206\267\244\255\321"
+	.ascii	"\036\353-\024\313Iw\243\321\323i/\377{~\256\232PO/]z\266\334"
+	.ascii	"\270aQ\323\223G\207\212Z\243o.|\306w&\213\021\267F\377\013b\377"
+	.ascii	"3\332\277\177\337=*\357\275<\364\232W\t\005t\3561\253\370\203"
+	.ascii	"\270r\002\377\321{q\270\327\030\2079\307JI;\0169\212\333{\336"
+	.ascii	"\213\2642j`E\205\264\002\222tZ]#\362\211Q\204\362Z\031\223\316"
+	.ascii	"{E\\$\322\310\001\363\212H:/\325\335\301\215\212o\323\312x\221"
+	.ascii	"\314+\342\"\357\021E\022iE\225t\036\251D$\235VT\327iuC\\\344"
+	.ascii	"Q\211\003y\225\"\256\323J\316u2\251B$\235L\252\244\323\212\b"
+	.ascii	"\217%\353D\241\242c^\255qX\022ywHU\035\225!\236\311&\363\302"
+	.ascii	"\335\313c6\2562\201{\253\230J\270#\020\006\003\365\334\001uv"
+	.ascii	"dr\t)\250+\346E>\223]\314{\273\240h\\\251\b\214\315\347\315\342"
+	.ascii	"\247\021\253\352F\331\270\227\200\333\274W\352^#\337\347\275"
+	.ascii	"\327x\357\375)\253\232\367\n\t\221\344\222\222\272wI$u\253\214"
+	.ascii	"al\334\333cr`\250\222\316+\246Q\230.N\256{\243id\256\013g\245"
+	.ascii	"\264Nc\330\215\272\263\\T<\354\032\005C2\326\263\312\354\314"
+	.ascii	"\262\263\2634\226^\362\036\245\240\030\263"
+	.string	"d\301u\312l\231\253\362\205\245\346\345!\302\243\321\276B\024\364$Cwl\364>\246\375\233\313\331\\\355U\223\367h\345@\025.\273\036xW\251dQ%\0057Z\200\374 \345if\262pu5\224\2479\361\271i\322\315\301k*=\205\235\335\325Qz\254\034\361\262\341C\3373c\337;\263\357u\261\357yi\365\223\236\334V\226\224F\337S\242\325N\232\351%\017\234\023\271\037|G\250w/\263\215\313\250{h\360\245\246\316h\252yP\312E\301\253\303x|\207\237K.:\005F.\212\027X\022\r\314\034\246\303wFF\315\343\202+pu\315l\034\275C\b\331\274TBhM\271(xx\362\360\235P\275\267\210\035.\246\3438|g\224\023\001\024e\333\350\033\215\274rQ\274\376\266\352$M\244\227\364U\017i#}\244\2254Vg5\222f\322U\335\244\213\260\263\231\275|\007i!\357\333\306F\372\266\224\020"
+	.string	"if\371\201\357\204\214\315;\365\333\252kf\373\340;B\307\346U\376\314\236rQ\360\356m\212\371\037\220\240\231\234\307w\374\\\336\032\207)\027\305\353\336\346\212^\232U\021\254\004\320F\201\002a\217\276\331\243c\354\321/{\324\312\036\355\241l\252\240'\220\270\262<%\234\226b\2519H\2504\372Z\306vpM\334\330\203\035\254r!\262r\227*~\224T\275\355p\276r\371\220W\0363\037\215\326f\335\002\304\343\b^\332\226*\006Ek\007\220*t\260\320A\325\260\216\322s;\342\334I\343)_\254\224\235\251U\376Z\245f\351I\242f\332\352\302\330\261Q\371\002\212\363\344\251\246\371\263L\242ii\364\025\313_\257"
+	.ascii	"1\357E\366\346\340\220\302\353+V\206\260\364H\342\244'\214\235"
+	.ascii	")>\032e-F\257^(\326\017SQ\302\354\253\024\256S\246T)D\267\316"
+	.ascii	")\355zx5\034\270\263((\266J\351\237\255\024}7\205\b\226\252\365"
+	.ascii	"\273\321f\307G\243\257Q\356`\270\367kH\355\332\2555jd\364\n\205"
+	.ascii	"\301\354\204\225\321\342\272U\267\252\026\3215\312\271@\n\223"
+	.ascii	"\215\005k\201\361\310k\364?=,s\325j~\001MM5av\223&H\306\202\350"
+	.ascii	"\226w\t\336\222\277.\251Y\035\342\"\257\314\200\361\231J\303"
+	.ascii	"\263\326\250\035!1d\324\310A\223\347\365\006;;OMb\004u\217d\f"
+	.ascii	"X\001\363C2\305<\033E\322D\366\331\235\2345h\366\374\225\243"
+	.ascii	"F\275\221\252:\276\344\224\225\007*j\352vT\035BF\021\367b\305"
+	.ascii	"q\025\251X\365\252\036\251F\252\025;+\263\362xMV\034'\252\314"
+	.ascii	":\305\254=j\025?\227!.\362K\034\237\034VO\"Bh\216\317\231\200"
+	.ascii	"J~\240enH%\302\316Zu\242ZU}T!\374\\6/\017?hk\244\330\255(\261"
+	.ascii	"\"\310\316\007\270!>!A\204\316\232J\356\032\255\313\337\022\310"
+	.ascii	"\332\016Z?\330Y\201X:^a\354|\256\f\223+&\366>X\366>@l\245\262"
+	.ascii	"m\352\210\370P\331\373H\331\373$\355}\256}\217\035\373\327\250"
+	.ascii	"\252\303\211fN\232\252\203\357\232M[\024T\035\333*x\204\257\""
+	.ascii	"\253\215\241+`\222\230"
+	.string	"\3550\002\0235f\215\242\025\252\327\266\270\244\216BpO\310\302\214=\263\2749A\032\255\327\332\350\211K\341C\344\213\221!\215\276\336\277\331\360\034\033\362\360\324i\224\321\030\275\363~\322\364P\007Ff\317V\270\335\336s\234\355\326wT,\217=PX\251\253b\301o\324\360\2605j\247\351\354\322%\207\313\276\361\330\331A\364\017\335\274\327\311ru\370\215\3201\304EB\t\t\242\351\360\233\253 9\304\020\255X\341\302\032\034 |\350{\262\354{\224\366=9l\327\265]\337\375==c\242\330T5\372\236\243}\313\361Y\342\2465\245\321\346\253\371\232\356\035\347\357\371})\221dx\354\033N\317\375=\025\017\333\030\034t\354\373\215\016o\216Xi\264\345\254\r\373\226\242GNl\256I\243o\271\277\3330]\307\301p/\262\243\206,\3434\332n\032\356\035\327o\267\343\"`\336{\354\270\241;\367\036\207\230\021`F"
+	.string	"\275r\265U\346Co\327X!\036\341k6Fo\037zklm\255\321 {\305>\237\255\026\342B\2659\343bk\0236&\t\033[\247!R\013rC\222\275\351\266w\032.\273K'\334\305\027\327u\304N\2419;\033M7?`^\036(\240\240i\200\330\341%\b[\246L\233\261W\006\030\273\036^@8\272|\254\241\363\247\321B)\2704,\022\213\322\244'&\244\340R\321\220\370T$"
+	.string	"\023\323S0(\f\376\212G>\032\204C\032Ea\3607\003\2302\241\305\224\330\2246\371\202K@\017\202\210i\023p\004b\022\bC>\f#)-\016\205NNOD\002j8\ta\034\025p\242\350T\244\3444\002)\370\324A1%\376\004gt\217x\004T<\n*9\365\202JN5\265a\211\210\022\211\3510)\t\370\253\341$DB\207E\247\372\240\032\303\"qI)=\341\200b1%\316\230!\364\021\217\210R& \022\261\227\224\006\225\226\230\200\277\244\224\370\204\"\245\304\337\201E`R\361H\311\251\205\320\020H\003\t\205\301\301\013\031LNM)\nJN\013\214\240AL\2073\322\023\232d\004P\\\n\202"
+	.string	"\203\203\027#\212)QD\3574Z\024%1-=\305P\"M\022\306Pz\212!M\352q\240Eq\btj\221\004LO\030\340HK\3034\230*\331G0A\003\023\270\250\341w\027\0258P\201\003\276\273\250\300\310\250\202\t\214\354'0\252\305"
+	.string	"\212/\236F\213\031EAaS\223\020\251"
+	.string	"\031\230xdTt\372!\366\206i\221i\251\203\"p\203%\244$`Pz\224\004B\210\323hA<RZ\232\021\024\326"
+	.string	"\f.5\001@\203"
+	.string	"\305`JL\207NEa\260\004\322\fLA\351\021"
+	.string	"\351Q"
+	.string	")\322\360I(\003\200\032\305%$\240\0230\206\241\"p\003\025R\342S\020\223P\270\301Q\217X\034\246L/`\244\304\247"
+	.string	"\202)\3220-A)\270\024\034\002W\b\n\227\212NMO\304\240\020\311\004q\211\230\016\323\"\261\006\r!\233*\001\213L\302\031\230\230R$&\246\247\031#\212\301'!\f&\246\024F\215aZ,\0027H\221\206\302\031$f\b*\036\271(\006\227\236~I\302\245aZ\302\f'\021\212\300\030\226\202\212G\023\030\025\205\210G08x!@\3614N\\\350\224\016\213\212B\341\260\350\247\203\036\342\321\213\030\303\264\230\306(\340E\223M\213\300\242\214 \r\300!\0074\200MA\266x\364"
+	.string	"\004\305\340\322\357FF0P\2440\202\007\026\251E1\230\016\207OHE\304\241\220\030L\211E\301%`S\021\322\220X\324\302D\221\230\026\201\"\244J\300a\352\324\004\024\212\203V\215gSkt\355\365\263Efi7\307\005u\273\263\323\006N-\223r\364\312{\323\315_^\230r\216\034\333\023,/+\256f\ty}\361\022\006\327w\202\316$\353d\271y\273n\272\260\221\275\375\325\207\332\246\343`\370\322\306%I\243*\230\204\257\307\306\355\210\nJ\233F_\335\342`\300\243\245CM\243\365i\364\272\306"
+	.ascii	"4\2650\215\376\252\2324B\216 \311Q\3238{\276,aR\327\350\331+"
+	.ascii	"\230\263\312V\337\200\256Q\354N\375\322\316\270\325\341\335\344"
+	.ascii	"R\305O\230\216\2605e^\331^\327\036\220\340s^T\336\216\215V4\257"
+	.ascii	"g\226mb\352\314\3243R\2208\253(\355\033\260b?\250\250\032\255"
+	.ascii	"=|\256\273\346\242\3444Z\325\256\266t\203\247\244\222y\232+6"
+	.ascii	"P\215\3260U\f;\277V\307\\H\314\r\2625\034\366:\360\327|\365\313"
+	.ascii	"k\232\230\"H\254\032=\220\021\255\354m\b\327\035\373\037:^\274"
+	.ascii	"\3242\"{\263\260\001\253\013\032\223\305\r\b\262\327\2624\364"
+	.ascii	"\b\\\020%\215\326\261\247\375KX\202j\250R\3310\212\322\020S\006"
+	.ascii	"\251\031\021\322$I:\022\n\020\004\244q\246\327\324\007\022 \025"
+	.ascii	"5\316)\307\230\241\221\221$I\245>m\007\021\004,z\360\035\244"
+	.ascii	"\271\002\330\005\330\220\307+\245\001\216$\246'lb\202Q\260\235"
+	.ascii	";\305\235\331\246\240!C\344\220){\032{Q\024\370:``\003\334\207"
+	.ascii	"\355\340\206\303\254\244\026\f\216\034\002\377nJ8\304;\327\267"
+	.ascii	"\215\342\203O\3741\240\310\351\250^\360\330\250)\\\367\236\227"
+	.ascii	"S\337SQM\177\201\331\272\021\356\344\274X\013\361\246\027\274"
+	.ascii	"a\251\035zr\311\277\242\315\032|\034\352\215F2\362\274jz\264"
+	.ascii	">|\356\253\036)\342\260f\326\210i\263\322\244Y\370tk\244j\215"
+	.ascii	"\007\315\374Y\346\220\r\207r\005,\357\224\0053$$.\261\003(\207"
+	.ascii	"\251\200@\203\253\301\343<ih\262\3124\330\204\255T\330\306\364"
+	.string	"~\\`\022M= \001j:&\274\367{\006\221\343\200\335\330\305\377\363\232S\2131\367n^?\366>d\304\364\342\345\263\265\307\314.<\r\270\263\3420q\344\314\217\202\217[\344wz#\203`_\337\221\0205\211\224\n!N#^\243y=z\351\323\001\203+\321\217\245\313\275\030\206\375egm\212\335\245\030U\332\222D\2317\0255#\304\247\260\250Aw\032\232V{\fy\032J+\201\356\001\304\216I\362Yu\320\223\324Y\347\214\334\036\365\364\310\221\215\t00a\254']t\027C\270\020\3216|\252\355\340Jg\220\247\230L+@\363?\246\017\034\330\335\316\366\022L\004\200\306\304\273\351\371I^!\334ETK`\313v|\375q<\370\203\351\274v:\301\325<\200\362\222\235\217($\023\344K\n\232\214\346Lk9\034\304\351\375\245\037\r\350\2622\206\227\016;3\271\2412\257\274\006{\314p\273\264\tV"
+	.ascii	"pAG\245\221\303\303\037\270e\360f\262\310\013\263#\330^!\322"
+	.ascii	"|\263j\030\022\322\327\037\245dT\323w\354_\\w\304\227\355\244"
+	.ascii	"\216\035|A\027\330\027\350K\265\352-\357\373\2411\022\375\254"
+	.ascii	"`\004\nJ\272\030\0205\234\"\026Bc\334P\230\307\n\364\202\234"
+	.ascii	"\370\252"
+	.string	"JFNY\307\016\017\274\362vG\334xB\312\312#n%\\\202Wb\315\215\356\232\033\255Af\"nwO\350\027\002G.\315(\006\277\213\374\275N\267 \237\346\260\363\325\262\360<'$\265\327\t\321'6fY\330\240%#\341\233\313\252\337\247d\245\321\362V\233h\261\213\013)o\374\333\016d5\006h\234\365V.\303\327\370\205\315s\323c\237\316\n\364\253\243\305\233\235\305\035\225\270\031\027r\021dL5\234\325\307Y\032\246\313\252\2608\nm\333/\310r\227\324\243\027\fh\316\264\321"
+	.ascii	"\265\020\017\215\236\013^j\177\243\352\0071\3534M7\257\321\t"
+	.ascii	"\372\334\37544[\234\3518]N\262Q\375<\245\343%<\026\255(kv\345"
+	.ascii	"[\254\203q\212\267a\242F\242c@cF\252\216\352A\206\345\227FA\345"
+	.ascii	"\323w\222\277bE\020\241N\201J\215\224\n\036H\255\273[_\353R\326"
+	.ascii	"*5\003\t\344\323qJn\217=\264\007T\214\212\325)\356\271\346\243"
+	.ascii	"7hK\316U\322\215\265$\302\3569Y[\302^\225;7V\342\300C\325<g\254"
+	.ascii	"\211\245\226P\021&\350p\236\2166\016\034sG\315\022\232\220\247"
+	.ascii	"y\320\215-\252\300\315\3464\243\216\2442\324=^P\254\233\003\216"
+	.ascii	"\006f\017\036L\312\221D!Px\263\220\b+s\310\3430\242X\270 \253"
+	.ascii	"\260\001\0243q\371\345Y:\201\321+\240I\212=\007\316i\356\003"
+	.ascii	"\217\017\204\335\310\253r\n\222H\330\275Xs\026\227*!Uz\t\236"
+	.ascii	"\324\217\2710\351\003\367\020\257\2545d\200\213>\304j\371\233"
+	.ascii	"%\023\317wL\030H\023\022_\214<\367B\345\001[\344m\272\300XAc"
+	.ascii	"po\025\t\223@\316\026\027\335\017\232\372\274\r1\024 4\234\270"
+	.ascii	"(\323\312Ns^\315\223\266\372\030\033=\016\271 \304v\026\030\017"
+	.ascii	"\323\034(\212\250\357\037\324\212\030&\354-Fh\003`\226\234p\202"
+	.ascii	"\355:\351E\211\327\254\321+qF\t\365\\\304\311\326O\375`\362)"
+	.ascii	"\364G\301,\244K\374uOX\272\357\347x\365\354>\241\205\206r\220"
+	.ascii	"\b\021\323(W\342\345\275F1\256\266\233\311\240\345\301\344\341"
+	.ascii	"\224\214\346K\030\337\317}\253\247)\2463\213\247;\244Fz\241\365"
+	.ascii	"[G\004h\250\201\206\f\271\027\303\002\021\316\2247\364\356\361"
+	.ascii	"\243\207\221\274\367\024b1c@\320`k\336\334\220\204\317\306\275"
+	.ascii	"\323L\323>\260w\031]n\n_\372\177t\037z\245}U\206\231L\376\213"
+	.ascii	"\364\301Yh\345g5\330\206\277\206\243\234\347\364\215@\336N\017"
+	.ascii	"`\374\334\364r\312C\341F\231\027\t3\f\373v\036~\350\351\250\366"
+	.ascii	"\277\327m\372\001\271\210\356\022oO\347m8\034\255\263\271\235"
+	.ascii	"\255"
+	.text
+	.section	.gnu.lto_.symtab.6c18fbd37e5b4677,"e",@progbits
+	.string	"currentMeterADCState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"pgResetTemplate_currentSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"currentSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"currentSensorADCConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"currentMeterSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6c18fbd37e5b4677,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
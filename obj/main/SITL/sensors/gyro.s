@@ -0,0 +1,2102 @@
+	.file	"gyro.c"
+	.section	.gnu.lto_.profile.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375 \030\301"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r"
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023"
+	.string	"\027"
+	.string	"2"
+	.text
+	.section	.gnu.lto_.icf.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\333\003%\024"
+	.string	"\324\031\317\004"
+	.string	"4"
+	.string	"\241\357\212\270\0024\002"
+	.string	"\002\001\002\002"
+	.string	"\003\002\001\344\340\225\316\005\016\002\004\002\005\006\002\005\002\007\367\353\214B\b\004\002\005\003\264\376\330\227\004\002\002\t\002\005\004\375\326\242\207\t\n\002\006\002\n\002\013\006\002\n\005\240\342\234\212\n\t\354\207\327\220\013\b\006\002\n\n\327\303\310\264\t\013\260\203\250\253\004\020\002"
+	.string	"\002\f\002\002\002\f"
+	.string	"\f\r\233\347\246\274\f$\r\002\005\002\002\016\002\017\016\002\002\020\002\005\016\216\230\275\366\006\032\002\003\002\005\002\003\002\021\021\317\337\315\304\r0\002\022\002\023\003\022\003\002\f\007\002\007\022\002\005\022\352\263\360\321\b\023\325\203\275\251\004$\002\024\022\002\025\007\002\005\024\025\242\302\263\302\013\026\303\241\367\352\001\002\002\004\002\004\027\307\242\355\216\007\f\002\026\027\002\026\002\003\003\030\031\032\300\265\372\335\b"
+	.string	"\033\321\332\340\267\007"
+	.string	"\034\244\232\260\377\t"
+	.string	"\035\274\205\242\255\006"
+	.string	"\036\314\361\361\227\007,\030\002\030\002\002\026\t\002\026\002\002\002\031\037 !\"%\354\206\342\366\006\002&\202\335\331\235\013"
+	.string	"'\352\265\212\225\007\002(\352\363\376\274\f\026)\250\301\313\216\016\n\022*\326\340\347\270\007\004+\371\212\274\273\005D\002\006\004\007\004\n\004\002\032,-./01\204\270\217\323\002\006\004\006\002\0062\211\250\272\317\b\0043\261\203\353\370\002\0024\347\273\234\355\f\0035\316\212\317\337\007\0046\350\300\306\254\005\0027\253\255\272\247\005\n8\232\245\234\325\n"
+	.string	"9\275\220\337\254\f:\240\342\234\212\n"
+	.string	"}\250\301512B$)I\262\214\001`\202r\306\210\036\020Hh\210$I\322\001%\002<\036\233\331\020P\221\037\277\3724\200$g\207\231\023\310\177''\365\373\3261\300\213\376\234m\363\272\242dG;\301\033F\312\315\320W>\325'\001@q\206\311\032\233\221\t\271Y\221\267\202b\004/@'\031\302\347\007\302\221\231a\002\026\356\002<\207~\313\244\004\275\022\273\355\255b\353lOp\357\322\224\372\264\345\300%\026\360\262 \373eX\355I\004\316v\377\341\346\3016(\003\226_^\232\030\253k\262\276\326\202Bu\037\3565\357\316\377,\204e\200&\035\376\n\273\007.\004\006!p"
+	.ascii	"\036\320c\031bV\347\341\021\264l[\252\250\202\274\203\002C\235"
+	.ascii	"\276\326V\312x\233/\327v\260\327}`\312]\305\245\305\367a\264"
+	.ascii	"o{,d"
+	.text
+	.section	.gnu.lto_.ipa_sra.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`9\001\215\007"
+	.string	"\242\211\033\037P\307f803333\263\224gf\006\270<\316>\210\256\300\016dX\261m\220\277\245L2\343\366<\350\f\272\002\256\023t\003\002/\200\005\230\230\356\362,]\245\215Z+N\013J|\312\244\223\f\362\244.\352P\367p\364\3066\237\361\236\342\023\353\0352\3427$D\"\236\203\232\356\316\3266\264\300\237\320g\273+Ug\253\374_d\314\004< \200\202!,r\003\0022\300p\"\243(\242\002\023\005\241\b#`\340\3150\346\266HB\200(e\034\0071+\333)H\022$\f\334\240\265"
+	.string	"\372"
+	.ascii	"w\002\332\332[0\006\203\020h\200\303\345l\031k\021S4\303\316"
+	.ascii	"\"t\360^\013\215\200\n\033\260\20158N\216\302\245\006J\006\354"
+	.ascii	"\300\002\227\027\f$0\330\300l\262=\352-\b\277\201\215L\021\300"
+	.ascii	"'\374\016\324\217\233I(\006\276,l\303(\324\020"
+	.text
+	.section	.gnu.lto_.inline.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`(\te\""
+	.string	"V\257\233F\260ZM\032\003X\356M\022\246\363B\276N\214\024\317i\333yG\213\240i\007\351h\0258.\363\373\177\252\275\362\013\267m\021ff\246\177\347N\261\033;{0)\341\327\310\303\300\203Z\016\213\203J\321nJ\354\226r\247x"
+	.string	"\205"
+	.string	"\226"
+	.string	"[fxk\313v\313&\240\263\355\326VOS,\273K\223\257%\362g\267\006\341\204\267]\332\255\263\b\235S\004\316/\326/\3269b\300\260\3707\354'\346\374NW\r\356\035\213\243\216\305\234\2508L\365\214\347+wwa,\211\354.\352]\265\374\036\376au\005E\250\215\311\335\255\236 \341\335:S00\317\231\346v\227\3653-\332\335\232|H\323\333\356\"\370\233U6\001C"
+	.ascii	"\035jXB)\"DG\304\301\350\301\002\365\264l\322rD\tKa\256;\311"
+	.ascii	"\024&\f\030\326\251_E\350\351-\233\302U\374\367>\026L\310\333"
+	.ascii	"\373t`Uf\366>\324\356}.o\357\333\373^\2113\302\375\210{q\367"
+	.ascii	"b@\335\336\336,\215pFTT\303=\346\251\350\376\304\247\026$T\326"
+	.ascii	"\023r\022E\221nA\372\350O\370\034\310\312\036\230Zi\312d\204"
+	.ascii	"\003R\341x\313\346\3512\371\237\022\016\207\264"
+	.string	"D\242\024\027\bp\362r\310\213\246'45\204\230|\361\020uu\006\tW\241 \0348:L#\2231D\272h\361\242F|\251\215\034Kx\254\216\337\321\225\371\303J\227\035\361gE\020\021\315\363(\022\321R\230\022\335\177\2230\t\336d\017L\352n\322\007\352J\"\257dY\"z\312\001\212txY\232\371\035U\032b\242\305B\322\023&+ \236\271e\373`D\231\356\356\317\227\353(\350\0078\3506\t\241\016yRDx\005\377\226m\346\364\354\343\311\225Q]\003T\003t\313v:\337\262%\034\3164\307!&\323\335\240a\246JS\037\273\253:\003\006\250\027btp\203C\024G]\203\3649\217\206\232x[(*p\205\334I.M*\244@\0269R\214\233\221\243\234\363\313\322\223\325RK@\301R\240\376j('\2735\025NB\"\020'}\016\322\341d\317Jc\267\366\035!\207\360k\374\223\345>8\355"
+	.string	"\226\251\r\016R\245\0332h\230\330Q\240$@\220>r\002\0046\007bzM\3668\032jB &g\200\226\267<\025\200\327\250\001=\306\020\321\210\214$)H\032\003P\0021h\250\312<\022 \2259\311\24424B#irZF\251\366\f)!!\n|/m\341Vu\302\226\212gO)\227\360\260\267\207)\206's\214@p>\276\315\345@j&!\306\307PE\257W\0078\033\333\345Z\274\210\244]\215zB\250\303\235\262~N\244k\333\373"
+	.string	"m\211\307!\346\2428\252%\233\205\314Yb%\027'?\261= \274\351\235:M\373\331\224\177V\003n\234\026\262w0ZA\b\004\322K\370\241\265&\026\357\026/\253\032\373{\267G\034\334%K\210\0370\277\243\375<}\370#\334\233\207)\233\376\336\002LxSRT\366"
+	.string	"\373 \002\374;\247B1\244;\371\301\361\021\310C\310b\373h\221q!U\373\022\371\n\376\223j\211zp\207\347\330g\034\225\021\343_\275\202-T\346x\034H\310j%\240\316\242\241\237\312\231\270,\r\313_\031|\356\002&\025a"
+	.string	"C\t6\003#\034\n\230\257b\024\026\375\353\2100\325\323\263\261\323\305\231qq\n\366\316\245\3553[\226\027\2033\213\004\227F\311J\375\234v\027\265\353\b\213_\367\374z,\006\347k\224\257d\022\201(\335RI\366\273\274_\201\305\306e^\247L\007K\220\300\205\tM\360cW\333\021\310\365-\265j\004\274-\031"
+	.string	"\204@\220\210i$\340\2453\313~\374\214\"\341\316\221\267\225B\244\240\360+\307QM\333\314\343y \255X1\r"
+	.ascii	"\331;\221!\264\363\347\363\267\264\253\333\314\214a\254Wk|[r"
+	.ascii	"\2313\344o\013\256\344\3203\222\024\356;l\207\026\220\016\303"
+	.ascii	"M\344\360\234\311\375\317D8\357\235\377xA\033\305%\3450(F\n\240"
+	.ascii	"\246\356c\033a\376\002\001&"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`}\005m\020"
+	.string	"&\025B6P\305&\035033+;5bW\306\370JpJ\300\300\0313\265K7b\276\235UU\211fw\020wo\365\240k$[\276F<\3308\355L\333Do\"wJ)/"
+	.string	"3"
+	.string	"5"
+	.ascii	"f%L;Y\332\335:\034?\333FtK\275v\266\264?\363\262\312y\256\003"
+	.ascii	"\307p}\362\350jtnqz\365\234\236\032\373\366\223\331\265\332@"
+	.ascii	"\002\225{\346\356sS\315`\200\013\262\237[\240\201B>U\366\236"
+	.ascii	"Yb\233\216\2671\002|i\373\022\342J\373\245\363\354x\330f\004"
+	.ascii	"-:\200\r\300w5\357\275\027-E;\021"
+	.string	"J\223<)\211}<t\206mD\013\321>Xvh\0338\371\220\005T`W\207\007.\nk|\"V\367\364\304\330\337\274\233\2153\245\375Ui\277\205\020\255\237)\021\023\310\221\216\332$I\224,\351\310\023C\353i\275\005\366I\034\355\210\263\321j\264\315`N\324\213'C\213\216\030\025\250\375HX\264\025\t/\263=\017n\250a\275S3R\024$\3114\007P\002!\245\312\312\003\022\340A)\022\345@\024\223NA\026\231Hj\2772\034\202\tk@\002\317T\225rD\352\254l\022\320\351\352\356 yC$E`\3729\372\364\250\3376\320\275\034\244\240{\276\021\246&b\006m\213\203\212\201\345\227\001\363DsC\323F\321V\032O\025\312)\316\r\002T\337\220\007\013\345>\346A\t\234\bd\270\"\361{\352\361J\315\nflE1\233\032\20342\ru\027\177'\2506`\354\247\353\020\221\366D4!\215\271~"
+	.ascii	"\312\325\344v\227I\272)_\360Cy\037\265\212\032\224J2\274)8\314"
+	.ascii	"p\206\2503\232\007\031\302\016\355\307M!/\277\022\032\030\025"
+	.ascii	"\003\300g^&\341eS\231\025D\352\200\370\227\262\250.\333\n\032"
+	.ascii	"v\226\276\232mk\022\210\274b~Lf\203\272\314y\332h\t\374\342X"
+	.ascii	"\205\234\021d\234\330$\231$\243E\251\200\356\001\031"
+	.text
+	.section	.gnu.lto_.pureconst.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375 k\305\002"
+	.string	"\262\006\025\034pO\241\003\374\037S\255\276UU\325>q\315\236\270bJ\303\210\031\373\224\222\b!;s\363i\276\314\207\371.\3232+\2272'\237dF>\310\235\307t|\215\271\330\024[bCl\207i\270\205K\270\203+\270\201\t\270\323\225\3567\272\320}n1\252\212\023"
+	.text
+	.section	.gnu.lto_.ipa_modref.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`p\003\345\017"
+	.string	"\006VA4`K\232\341\324x\223.L\301q\267\214A\327\020\"vH\022\206 H\361\35195=\376\273\304\340+\030\351q\337X\373\306\244U\214\220\t\371\373\233\331&e\n."
+	.string	"3"
+	.string	"6"
+	.string	"\334q\2164\002\265\306\327\330\2456\326\r\363\306Z\315\035\2435w\330\363\306\273\326\310\374\253As\250\261\303<9A\223\243r\005\203772\004\214\b\\"
+	.ascii	"\0371/?\021?\247\362\211\220\362\n\307X\024M\276)\177z\240j\017"
+	.ascii	"\362~\2177\3259\2453FY\023\024\177\364\313A\\N\251\232\366\247"
+	.ascii	"\304hOi\340o >\260@u\rx\347\232\205bM\346)\034\256\200)\225S"
+	.ascii	"\355\007\230-\031s\017\214\206\271X\025\312\330\222\341\034\365"
+	.ascii	"(\264\361\323\366Mh\f\232\244\204\036\337\nR\374\364O\037\245"
+	.ascii	"\217\376\bC\370\344\213>\270h\363\250\343\035\264\301O\213rb"
+	.ascii	"(\217:'\232L\006\022\216D\371\205:\036!/\260P*(\021H\001{\250"
+	.ascii	"!\271\204\254hA\322~\007P\0021\310\314n\021P\265d\220\246\245"
+	.ascii	"\264gsD!:\022m\253\372\343\362\275\336A^X@/\3770h\306\256\215"
+	.ascii	"t\254G\215\n\326\334'}\253\202\336\034Er\310?tr\026\274p\237"
+	.ascii	"\217\274q\372\006\004\037\272H\204\022\206\025\255\255\355\230"
+	.ascii	"\264V\374\245\303\264@\203\202\320\236\021\223q\226M\242^V\354"
+	.ascii	"g\325\276\037b\343?\300F\200Ui\020\tA\222ny\261\374\203\017\205"
+	.ascii	"\263\272\207\031\222\020\273\242\251\373\025\265g$\013\333DW"
+	.ascii	"\347k\252\247?\373\374\374\254\217U/\244\376\2724n%\316\242f"
+	.ascii	"\021LIx\026~\006\252\216\254\264\340m\265B\304ZK\257\215;\210"
+	.ascii	"\260z\300\3765\b\377\344\373\016T\333j\031X35>l*\2667B\326&\365"
+	.ascii	"\365\361\350rd\230\330\317\262Y6\237W\276\241$P\237\001\230\024"
+	.ascii	"ZK\240\t"
+	.text
+	.section	.gnu.lto_.lto.fd969f62fdf04746,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroConfig_Registry.66.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375 \226E\004"
+	.string	"\244\007b"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\202\200\200\374\342\203\315\203\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\317\006us\354\005uq"
+	.string	"\005\001\006'\001(\212\200\002?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/sensors/gyro.c"
+	.string	"\004"
+	.ascii	")\302\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_gyroConfig.67.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\331\003\365\021"
+	.string	"f\334jI\320TQ:\206v\001\257\257\270d\332\3502\0250.8\213\030\272\252\341\314\264\036\322%\363\264c\250Y\204\235h\035\365\244\2765f\201\242\273\362\364\t\311\340\003B\303\202#\366\200\322\235X\034\320\036$\021\037\266\332Ob\tI)O"
+	.string	"U"
+	.string	"Z"
+	.string	"G\366'\314Iq\262\375\317\276\355+^\247qy\200]Z\016\032\2737\004>Pz\350\333\007\210\017K\027 >\364\313\346\375V\333\273\250\211\270\251\273;\202'\376\372\367\362_sS\214\f\354\037\311\301\356\372\213\221!q\203\267m\300\266\002{\304\022\261\235\372\225\317\3309M>\206\n\\\005?\374\205)\206;\023\334\024m\327oL"
+	.string	"\263\033\265\350T\264YnCK\273\273\300g\021\242\245D\b\305C\337E|\2302S\223\331\206\274|=\373\006\373@\023\366G\273\273\006i\366i\376\257@\013Q\005\302"
+	.ascii	"gwD/'\312\211\250N\217\022\231\205\357P\024d\247\314\206s\373"
+	.ascii	"\302}\004U\224hc\270\020*\350K\271N\227\3419\335\251\341<r@\225"
+	.ascii	"\347\366\206\373\320\323\fH\345;h\316\247\246\256\303l0Se6\325"
+	.ascii	"q\230$!=5\347\366\3528:\3539e\334f\335\206\251\005\317Ktx\r\032"
+	.ascii	"+\026\207\026yB\342\224\tY\322\325\350*IWK\345\032[,\225\225"
+	.ascii	"1U\272F\023\002&=\250\312\021\004I\226\343\351\266\037-HC\251"
+	.ascii	"\371y\001a\036|0\363\307y\362\236y\202\341U\b/\2423\336\351\032"
+	.ascii	"\341F(IgWK\022^\304\214\355N\030\267'\234Hl\310\246\302\203\f"
+	.ascii	"\005G\2501 \313{$DA\371\026\332\260\002\021\261\262:\021PL\213"
+	.ascii	"\204\214\304s\320\016X\207\032\n\333.iR\304\"5\350!\346\220D"
+	.ascii	"\b^\256\201\272\375h\032\266\222!\310\031\177\276\205d\255P("
+	.ascii	"\365P\025*\310\362X\236\266\342\203\302\276?>\007]\034{_c\324"
+	.ascii	"\2005\347\2106\237\357sM\027\366?+\230\004\351|gT\263\230\254"
+	.ascii	"\240\024\241\326\020\241\322\n\003VR7\036\211\224\357\313XMB"
+	.ascii	"\364\275\221y;\371\356\326\346U\005&]\304T\r"
+	.text
+	.section	.gnu.lto_gyroSensorBus.68.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"M\007"
+	.string	"\342\31525Po\322\001 \246n\231cP\301\364\b\367\033\241\210M\bS\315Uk\231mC\255w#\264!\334\256\330sff\032\r\373\272\276\325O\030\211`\016K6\331;\245\316\\Qv\034\340\224qr4\023r\036\03260#'\274\f\034!4\022J\304(aU\367#\233\200l7tj\307\213DX\231\347C&\016TvW\341\317/\275R\370\032\177\356x\332\351\237\357\241\376\020B\256\302\256\240\3460\354O\353.\354&\300\222\262P\262k\361\342\262(\357d\303\366\307\256|\217\177|\214\025\324\214T\211VD$-\273\025\272\236\200\372\003\370"
+	.string	"\365\3472\216\275a\376A>u\224L\350\b\364\206a\330]7:\"\335\356\266-\333\t\2669\002\n"
+	.ascii	"2\003\302\360\030a\317!,\307\314\3055\261\032!\264\020\231\270"
+	.ascii	"+\246v\222\001"
+	.text
+	.section	.gnu.lto_gyroSensorBusByDevice.69.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"}\b"
+	.string	"VP<7@\217\322\001\320\\\242\370\355\202\223\256\242\301\362\377\356\277\205\2233Z\242N\355\233:k\352\270!\354\350\252Z^\201p\001\340\373D\207"
+	.string	" \263\300`"
+	.string	"\333\020\267\335;\245*"
+	.string	"-"
+	.string	"-"
+	.string	"-\231\335\032]O\200\035r>\200\035\276\220\227\356J\376Q\276!iym)\323\035\200\304\356\332m)\325\375n[\301\266\203mW\257]\217\232\231}\201.#\266Ivf\3739\273\341\201\364\023\016\277\335U\214k\2672x\201sh\333/\271\t\311\245\202\312Re(\032T\266\305YB\t\226_\3018`\355.D\312U\250/rh\215\221\373v\350\217\260C\204\323\353\260\253\311=\020\373\233}\037\266\023X\301D\004SR\221g\342\243\201>\243\314ZG\316\215\212H\247\244\"\017\215\"\020E(j\223\306\216\201\345\205g\306\f)g\314\352\276\005\n`\355\236\276\005\n"
+	.ascii	"2\003\302\360\030a\315!\254\230\344\267\031\234k\370\202ECu\b"
+	.ascii	"c\272&\031"
+	.text
+	.section	.gnu.lto_gyroMpuDetectionResult.70.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"]\007"
+	.string	"\342M36`O\322\001\024\3020\f\374\021\033\024)8\310H\3739\363\321\262\233\3249ZC\332\266\003\215\r\241}3\266\225 6\bK\320Z_\3200\203==\016\262\311\336)\005\336\\Q~ \340\224qz8\023z\"\036:p#'\274\020\034%8\022R\304(aU\367*\035\201lwtj\307\247LX\231\347Q*\022dv\227\341\317?y\265\360?\376\374\001\265\323?\037D\375)\214\334\205]E\315q\330\237\326m\330\215`\004\306\301e7\243\206f_^\013\210\355\220]\371$/\t\031;\250Yi\300C\003cef\267B\327\033P\177\001/\240\376\\\307\2617\314\277\311'\021\226\030J\022\275\0014\354\256\033%\225nw\333\226\355\005\333!\001\n"
+	.ascii	"2\003\302\360\030a\317!,\307\314\3055\261\032!\264\020\231\270"
+	.ascii	"+\246v\222\001"
+	.text
+	.section	.gnu.lto_gyroDetectSensor.73.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\317\0015\021"
+	.string	"V\241uH\360\262\2501P\334\306\370W\303\215\363\f\371\ft@l\307\361\016\017\254`-l\274\241\243\344\3041\274\330,\265$e\020\b\274\307k\316<A\226|0\207\316\263\023D\247\026K\227\226S\302\326_\n87\333\226rK\231Ra"
+	.string	"\\"
+	.string	"d"
+	.string	"\307=\346u\031\224\017\270\327\346C\343^\222\201\023\210^M\276\200}\025\235\200}\265m\223\203\227a'o*\036\t\035\232M\220{\311\217\2528\354\035\2350\3773\357|"
+	.string	"\005\215\265\330\273\023\247\235\tG\b'\240&v\001^\214\250y\3563\2456\233\323\223p\357\365\034k&\356z\333\025lO\260\247)\327\324f\277\274=O[O\327\313\374\323N\177d\201\254\254\330\2418\310\25324\344\376\324\032-^\376\366\375\030/\375\234G7\257\326a8\003\314\215\005w\357m\3717\036\275\3724\257i\335\306U\022\311[\303\200S\342\024\274\032\202\350\265\324\275\354\221mJ\236\030\030\271\"\215K\2039\355\237\371\324\201ya\211Y\351F\346\177\262~\211J\315\217&\335\360\371\021i\314<n/)(m\261\r\263\226\2064;\304)d\322<\365K\225\207\371\321\322\347.\372\301SBH\017\221\306\354\347\260\026\214\266\311g\200\242{\357\003\031\"@D\310\361\362\352\243\320\273"
+	.string	"\2621\242\220\315!\233\234M\332b\277\273\367\006\251\360\344\342\020\236(\220JT\035V \312^"
+	.string	"`\024\t\030\236\224|\254\020d\255R\254o\245:\231|\250\220\365\221\0340\370!\025~!@0\374F\266M\312Nm\276\016\036\026T\344.\373\334-\344\270\320v\246\357\262\036M\261]iIFg\3665X\217V\032\002\005\321zfs\310\036\2657\274\307\205\340\306#\022\037"
+	.string	"5\203o\036\363\312ja\217\211\220\211"
+	.ascii	"\301\301a\026#Zc\216Iz\202\216\236\273\231\245y\n\215\211\207"
+	.ascii	"D\001\037_\320\304eLW!\340\272Z\321\324\"\034\036\241\017!\341"
+	.ascii	"d\n\0035c9(\f\206-@E\264\352\246)\205\202\002"
+	.text
+	.section	.gnu.lto_gyroInitSensor.74.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\300\005}\035"
+	.string	"\2061\256H\240ZQ:\327{\233B\364\312\005\226\225|f\246\351\345)\371\027M=\245\257\333\370\322\274\025\027,\246\261\346\217\355/\305\024\306\026\023\304,\300"
+	.string	"\003$\300((\223\212G\3518t\250\227_P\252\376\362[B\b!R&\031\221"
+	.string	"\217"
+	.string	"\243"
+	.ascii	"\274c\363\212\"o\330\274\035\362r\363>\301\325T\037\231\031T"
+	.ascii	"\2557\256\326T)\261J\221\335\275\271\273\254{1\340\246\336\230"
+	.ascii	"\212\034\234w\257\364%\372\034\214\003\250\025\210\226)\265\352"
+	.ascii	"\032,\203\362\342\352\036\033/\226\307\031/.\335\235\272\256"
+	.ascii	"\250\222D|8'_\255U\326AN?\212a3\3353\360\351\004\252}\214\022"
+	.ascii	"I\036S\227\360M\256@\307\216\351\313\023\240\034\357\233m\214"
+	.ascii	"\031\355\216Z@1\232\311\t\265\326\345\023\b\307\227\374\356\366"
+	.ascii	"\354.\204\335\321\025\343E\261\315$\301\244\260w;\034\252E\201"
+	.ascii	"\242\375p) .\20670v\207}\234\025[\210Cy\322\375\272\002\374\345"
+	.ascii	"\270wG\334\t\211\262\326\372`\377$\242\004\2547\004\306x\261"
+	.ascii	"\201g\325\233\373\270\340\232\270\323\211\262\326\333\203=\323"
+	.ascii	"\233t\366C.\356\016\017\377\344\031/\276K(\351\005-\345~\370"
+	.ascii	"jWg\343&\332}_]]\375\266\201\354^\367\007x\356\3071yoZ\274\260"
+	.ascii	"\346\265a\361\276J^\027\311k6o\213\344e5o\331\274\344\030HU\250"
+	.ascii	"20\205bp\360\307\315\320\241\005e\004\3344\013\367\224\224\303"
+	.ascii	"\256^X\257)t\353\032\321\311\320 T\260&\235v\330\b\371\024=\032"
+	.ascii	"cuV\211\tc\323\257\247\246_\356E\344=Z\304\325\363\362/\324\b"
+	.ascii	"=B\221\360O\212$\312Y\265\200Ym\266\253wi\022]\302?_\215@F\327"
+	.ascii	"v\337ef\340\344\022\241\310\325?s\264\332\\\272TT\253\017\005"
+	.ascii	"\246lV7\21729oK\331\022pMd\357R\270\226\nY,\034\313\005\262\315"
+	.ascii	"3\301\337\330\273\030\276\313`\205'\366\250\341U\250x\330P\276"
+	.ascii	"\b<)P\364\314t\306\017\255\325\311\231\321\\\360\310|h3\237"
+	.string	"\236\035\037YO\212\023*d:4\037Y\016\201\235\255\330\241\311X\314f4\231\251\373\271\021\251\237\266\255\003\306\331Ay\360\317\215\375\204~T\267\256\205\265\326:6\021\215\333\250\021e\365\030\032qg\340xj\036\263\232\362\243\n\233\350\364h\334\245>\370F\217\016\260-\366B\263C2\203\346\007\202\244j\f\274\321\316\350J\373\270rm\247\"\370\202z\330\300\326\034\370 \353\225\306\367\337\323\234\016\321\241\361\242\317\247\204T\353\356\317l\255\265\007\225\034\252\232\236Ry\250QH\304\220DT\"\023\026\024\244 i\f\260\002\2211\033\035\021\0205D\nY0\304\240\240\224\306\267\024\260N\t\261\274\245\246\024X'a\032Yp\037Y\277\245\2170S\261\214\373\f\202&)\254\3129q_MY(\241\201\225`_\355x\0029\200#\035\244(\334S\363\246}\244\317\355\b\203\345\331$\241\320l\033y\0342\246\202>}"
+	.string	"\234\220HQ\032\241\267P2\364b\260\002\312\030\312L?:\354X\303c!\237\303\004{A\307\376l\344\006\260\220\376\210f\213&Y\024\320\266\025H"
+	.string	"\347\240/v\b\371\237\017\352\270Qb"
+	.string	"\350\220\363\250\001V\261\270\007=\264\227\032XO\"\25610b7k\327 1o\220,\203\340\031Q\006\354$vdk\257E\373\360<\3414\355{\202]\324\252v\203\213"
+	.ascii	"\270\n,\017cw\310AT\264\275\033\277o\307\364?"
+	.text
+	.section	.gnu.lto_gyroPreInit.75.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375 \277\035\005"
+	.string	"B\211\"*pm:\240{\375`\311\203\177\003\253\356BR\303\325\201\025\355u\374\352S\266\364m#T\025\376\341n\211\360+\303\215\030\367N)\266\252I#\013Y\351\254\330U%\326P8\244E\253\254\b\236\217\213J\310\234TR\237\366\350\031\264\270\331\337\006\343\305>`\243g\303\202g$\t\355VN\246\025\005>\032\333\247\234\331\244\177\231}\007D\341\224vWF\314\263\303\314\377\346\003\256\233\034\n\022\273k\310u\226;\336\366\3016\3026#\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_gyroInit.76.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`H\b\235+"
+	.string	"*G\330\017Gp\032R:\027t\024\021\246\340\200\036\036uP\272\f\244\307\330\321Ar\310Y%\3416\037x\337\327\215\376\317\353\203p\324\306\210\276 \234\001\341L\320\231\264\322\372\r\214\321g\r\036\220t\231\265\257\366\2775B\310\226I\006\347"
+	.string	"\331"
+	.string	"\366"
+	.string	"\254C\233UnNm3j\233\3336?\301\305\3444\235\256\334X6_\027\351\031w\321R/W\314\374\203\2515\235X\307\267\330&\211e5\267\356\275\276f\346\301\354c\b\021x\360\372/*\244_\255\031\201\301\335\373e\264S_\017\2008\024\006\201=?_\217\267\323\251)j{\345'\017\240\255N\324]\200R\252\3720\311\205I:Hu\244\201\350\0029du\236\266\254B}\220\230(\357d\331\354\236\247-\215\034p\262\264\352\337\001(%\247\373\322\226N\250\001'\313\"\335\263Gp[Sx\327\372\206\250\243,[w\240\224\232\276cb\252>UfV\207Z6Y\035\221\253\251\017_R\217F{IDn\321\005\3151K\300\244\"\324\347L\324\233k\275\177$\021u\353.\334{\271\225IJ\347"
+	.ascii	"g\276\007f\306\300\254\303\n'\240\206\341\213a\266b\030\363\336"
+	.ascii	"\344\233\366\004\324\247O\027K\331\344^\346\177af\266\277\311"
+	.ascii	"\266\243\272\313\373u\025\240\227\251\347\330\314D[\021W\244"
+	.ascii	"\232\\\314\257*\237\354^\326\023(P<\341\276\345c)R)\317,7;:\026"
+	.ascii	"\223c\272\r\365\363f\210\270\264\250:-q\334\326\026\325%\355"
+	.ascii	"\002^^M\366v\206\tE\177T\371W\016v\344+\341\025@@\352S\335\224"
+	.ascii	"\235,\2673Q6\307\330\277PoUXiS\324x\230\271\305\251\274\330\335"
+	.ascii	"[$\201\357\365/\030|%OY\006\262\257|\312G\252Oo\227xAiru\r\365"
+	.ascii	"\223\371\213\250\255\223\371\366\371|\276\261\225b\266\315?\272"
+	.ascii	"f\"7\017m\263Pm\016r3\3206\367p\363\217\233}\334\334\343f\036"
+	.ascii	"\332\274K;=\313\263\276\376Q\375\261\275\037\313\2637\362B\324"
+	.ascii	"\317\376\361cuI1(M\256\247\036:\337\035\355lq\r\323\317\032]"
+	.ascii	"\331\366\004\252ju\366FKDs\272H\2657\230d\356\334g\235\374\262"
+	.ascii	"\247\266\b\204\t\025:h\326~\372]=\264N\261`j\357bn\320\311U\253"
+	.ascii	"B\025\2640\024\236}W\256\325\013\003\206\255\313q\330\335;t%"
+	.ascii	"?\317\3432h\340\300A\355\360\241\257L\355\263\244\275\241\365"
+	.ascii	"\260IF-\334\021\004\320\345\224m\034\342u\336P\233\203yv\247"
+	.ascii	"K\204\312\237\3636\021#H\220H\202)){\234\022\2743`R\315\255\263"
+	.ascii	"\277\345\236=\353|\263\2039\226\345\206\346\t\322\242\360\254"
+	.ascii	"\323\256\371\320\034\205)\333\300\\\305\022Z\262\345^eVe\266"
+	.ascii	"Ss\220\346j\276\206\331v>\305\246&\367\351*Hc\006@\0033,\303"
+	.ascii	"lE0fp\f\263\025\261\200Q\003\354\342\201\r \026-h\024y\305\003"
+	.ascii	"d\020\216\026F\241 \244\320\f !\343\214\027G\031\306\025AB\306"
+	.ascii	"\007\002\030I\003(\310X\003\211\f2\372\276\206\216^+\3051\236"
+	.ascii	"\024\t\033#\036\316\257\365]\034\326\226\260\261\337\313>\344"
+	.ascii	"\241\345\013C\226\210\321{\357\005`\235D\353\344\0262\270\005"
+	.ascii	",Xs\301\006'\332\037\314B\313R\307\001T\334P\035\265\036A\262"
+	.ascii	"F\365\225k\224\032\264B\233\252q\366\323:\365+G\326%\025\232"
+	.ascii	"A\253*1\211M\351\002Z'2\3126\242\005\332\033\315\r\365S\035Z"
+	.ascii	"'ZF6\025Dh\245zxM\322M\307\2371\257V\315\264.9\027\265{\257\204"
+	.ascii	"\247\314\036\373\2636\237\200\026\347I\360g\355\034\237\254\207"
+	.ascii	"\254\353\025\212\237\345\221\211m!\350s\365\022\227\020\245^"
+	.ascii	"6\022\257O\326(\235e\215\021\216C\245\f\033\240\317\252\260\262"
+	.ascii	"\026\200\301\250"
+	.string	"\2018\306\020\203\206DDR\220$\225\016\240\002\221)\252z\021PAcjh\323\fkI\347\200\327\367\370B\263\317\224\035\203\323\001\246\2556\326T\215T6\341o\343RL\210\217P\242uMrZ\022W='\334>p\237\305\342q\353\305\0049\304\247\006\376\347\212\231q\307\262\020n\003\221\013R\226fU\f\245H\302\302-J\023PkX\371\2578\003N)\304M\253\244\230(\232\276\017m\005W\254\321\0034\363X*|E^\007\226\200\030\036\254\b\207\"\305O\333U\240\317\316\277\004\320\225\360\\0k[\275/\316P\347\213\207&\205`>\257J\276\303B\021\227\317\206&\023\241\261$\246%\341Q\311\354\255\231G'\355N\2722U\216\031#\364\024\300HrW\004e\244\220\025t\3258\033B\273\256\270D\220<M\257F^\362\347m\263\003\216\325mH\216\221\234\312(&\261f&\251\331\250\024\"\342\321j"
+	.string	"\0313\257\352J@\021\357\005\004\330\217\3103\027p\260\231\213\317\203\207\333\205\306&F2\371\031o1a\212a\001\241\006\220xL\306\311\031\220=\324K\257U\f5"
+	.ascii	"\016+@\235\306\016+\007\204'T\376o\022l\243\202.\244\237\232"
+	.ascii	"\323\037\224[(\215]\212n\322\245_\275\235\227VET\251t m4A\351"
+	.ascii	"n\r\261\355\005P\320\360\226\214\356\213=\265k\324P\r"
+	.text
+	.section	.gnu.lto_getGyroDetectionFlags.77.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375 \365\275\006"
+	.string	"\362L/3`m\322\001@\003\007\207\224\001\256\377\214\220\317\261\215Ev\236\033\206\001M\232\265\026"
+	.string	"t,\246.\214\207 x\202\t\245\240\216\200\320m{N\243\335\244L)\316`\334\34304\370\034\334h`\3334,8\264\314\203\rC`\367\240y\r\302\271\327,\326^E\251\227IA\366AnE\177dN'O\235\371\035\351,\025\200b\312\313\266>\251\031\366)\253\"\333\351\324\200\222Q\365\212kw\342:Y\0226\262a\333c[\374\216{x\034\025\"\246\320\001\007\206D\210\311\256\325.\037\220\316(\027\220\316T\343\361\031\375\177<\001d!BU\237g\005aw\235T\025\272\365\266\013l\033\330\276\b\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_gyroInitLowpassFilterLpf.78.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\336\b\365/"
+	.string	"\372Rd\022G`\232N:\277\232\305\314\002\344\034\375x\352\306F\020Mc?\006\351QS\253>\341\203\t\027\324f\017,\336 @\241\371\231Yj\361\203<?\350?\030d$W,^5+z\260O*z[\2415#\226\020\262w\222\001\013\001\374"
+	.ascii	"\037\001k\177NYZ<\203\345\327H{v\371\345\f\005q\305\205\232\337"
+	.ascii	"\236\366\264\221\266\241\273\212\213\241-hF\033\2265\377\326"
+	.ascii	"\026|m\f\355\235r*\310\277a]c\336\322\"B\241\375j\274\017\300"
+	.ascii	"Fi\251j\314[e7$\\\350\237 \017\245\245-\314\231,\016\\\316\031"
+	.ascii	"\251\037\264_\207\324\337\356\257\235\r\371\266\030\347\311\371"
+	.ascii	"G\035\\\316P\244>j\2776\364=\354\327\366\001\330"
+	.string	"\257\335\310\356\276C\233\371G\315\216K\312_\3169\t\007\0316\276\n}\353`\344\213:9\304\241\260\r\262\253\212/\262\237\365b\217\253\343\3439A\245.W\237kF\310\300|\234\250\032\035\020\035\361\332q\207D@\300\302.\f*\315\275e\363t\252!\003\013{\313CG\023\005\271.\253\016\215\361b\252C9g\342\227\362\256X,O\275\334\227\312\230\323\345\027\216\343\255\341\227\026\333\343\224\236\235\314\213\211oP)\347\334w\371\005\366\336y\367/t\267\215\356\026\007\354W \274\023e\246Y\346H\336i\037\314\237\272\340e\3358wJ\235s\030\233\365\355\032\t0-\217\205i\006\335\327~,\253\2359\372\322\335}\303\035\323%9g\235I\244\224\311<\305\37424\037}\355\301\227\373\233ztx[7\260\033\232u\261Y\367\361t:\005l\374\243\333\250\350Q\376\003\257\362\036\372\333/\364+\357\002\317\362\016\""
+	.string	"4\340\347m\277\317\241\374=\247{\363\\\3726\036.\356]\314\271\255\303\336\316\031\336&\016o\017\333\333B\342\355\226\275\035\034\336f\207\267\327\366\266*\274\215\205\267o{\373G@e\264\362\242\250\335a=h\2761\205\223\361\326\270\"\247\373\245\177\225\377\312\237\345\207\373\343\036\354~\0275\277ax\256\365\271\364\347\232(m\351\0271\352\204;\215\366\353\275\225c\271\226o\271\\\023\343\252\214yL\376\327\232\332\336\021\356\250f\035\320\fV\2142\337\002n\026&4\213"
+	.string	"\362\234Z\376\276\002.h\211\0322\355\233'\021\300g\223y"
+	.string	"\377\215\317\255\245N\351Y\020\233u\020V\261\214h\235\020VqQKH\033\256\300\344\235\236\305f\315\272%Q\007`\237)l}\230"
+	.string	"\336\301]\254\033\020\365\007\033P\262\331a \\\304]\215\305\na\234\305\345M\224o\353\272\351\276\220Ah/\347\344\227}6)\232n\277\212\375Z\314\023r\267\314\021t\013`\214\2737p\270_\016\341\241\0318\253\2050\306E\255\346T\351\227\324r%\2174c9w\205\351\364\313V\316I\004\027\027\300\027\213\362\210\326\305>\321\246\236\322\017\013A\031\373\0076\b\3372\312&Z\335\341i>\364\321\274/D\267\210\021\367\313\021\354\327\343\273\t\223\002\330\226\274\323+uJ\321V3$\3167"
+	.ascii	"\023\363\304\356\366\252\0224K\\\257\t\351\007\357D\305\350\352"
+	.ascii	"n\244\267F\305feL\004\355\2358\031\024E\00401\217\331\246?\246"
+	.ascii	"*As\331\315t1Mm\3169\002\036\b'\244=\264\030\001G\250\027L\252"
+	.ascii	"\324\022V\024\025\225\005\001VNWQPK\307#\023\225\213\251(\235"
+	.ascii	"\253#T\213*,\017XMRN-\252\234\254\226\004\\a`\245\240\230\236"
+	.ascii	"T\030\032TPE\255NTXW\352\325T\324Q\0251\354\246\006SVXOIG\253"
+	.ascii	"\251\243\224\3231I"
+	.string	"\n\212\211ER\223\3251\251\001POQ9Y%]MMY%\021\241\371jVJb\255\276\027\245\254\033G-\346\024\341\225\217\270\340<<:<\270\b\373D\317\364\224L\244+\304\030\353\004A\nQv=\235\335%r\310\004\025H6\b:D\274\203s\036\370!&\362\340!f\353\270\002\223\227\306\345\022\342\2700;\300\266\234\"H#gn~\271\363\274\361\325\021\261Y\023\371\204Fx\345k\027\334\210\273\220n\3047\311\325\344Q\361\0322\270\021\033a\237\250\223N\311Tp\207p\213\273\221O\244\222\373e\367MB\t@2\271YH'\020\3662\025\222\255\301\021_,,\336\301A|%\222\004o0\354\212Y|#^\361\347N\242\314y\207\321\204\330,\200\251\250Q0\244\230cfH\204d$I\223\306\240\002\221\241\252z\021@\261S\016\321H\013\n*\351\007\215\344\017c\377\250.fTX\252\332a\257"
+	.ascii	"X\245'}T\345\246\347}\035\233$T\340K\331\326)\021\216\320\026"
+	.ascii	"\245W\353]\340\205\211HZ(;M\002~g\231f\004\334<(\005\343p\262"
+	.ascii	"\300\223\272\266\354\363\237\237,}\265p-\024\t\301}d\251\213"
+	.ascii	"\213\336\216\033L8\004\362i\037\311CU\001W\232\210.\\\354\fP"
+	.ascii	"\204\007\223\245\016[\261\353T\220\211.B\262\344\"L\205\346\246"
+	.ascii	"\n\251\307\267\317\372\335r\251\301\356c\0225\352qK\311\036\f"
+	.ascii	"\343\022\313\003\325\317\022\342\315\356\223x\233\210\367\013"
+	.ascii	"\364#\343H\317\321\016\273j\030|\230\002\343\223\252\320\366"
+	.ascii	"\016L \032\366\346[2\230$\354\354\336\251:\232v%\2022>\024,\370"
+	.ascii	"HQ{)v\223\343\374\343\020\025q6\314T\302\235\033\345\217\234"
+	.ascii	"\025\367\346\177\302\n\270\302\027\fT\262&\332\235\322\n\374"
+	.ascii	"\243$\334\022\037;\f\315\346ZP\357\257\337\002\364\2264\332H"
+	.ascii	"-2\257\rZeH\020<\261\006\025\027\330\256\360T\013\233\254\207"
+	.ascii	"\314c\340\347\233|\3358\365YW\326\243\260\341\013=f/mw\342a2"
+	.ascii	"\362\0332\003Jj\313\223\345\f\230l\324"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch1.80.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\027\005e!"
+	.string	"\266<\325I\200ZN:\237\364\333\237b\367]]\271\\\315P\020wlxMa\\4\350\007?\313\t\250\350\210\365\307\370\023CE\315\255\272S\202\224\275'\250\332T\310,C4X\345\016X\362\244\001\305\330[\024\333\254%\204\220-w\222\001\275"
+	.string	"\266"
+	.string	"\310"
+	.ascii	"ZoI\340\356U&\270\311\034\322\233?\373\234\0353\330\226\204V"
+	.ascii	"~I\361_I\365\3462\031k8Ho\336\324W\346'\271\222\342\275d\\\300"
+	.ascii	"\275XnQ\356U.\340\003\351MV\276w\336L\237s\336\344\"s\030\236"
+	.ascii	"\246\253\344\200\013\3151\f\356\336\013l\037\334\267\312sZ\213"
+	.ascii	"\317\245\350i\332\256E>J!\354\366\352\210\0302\251\364\234\275"
+	.ascii	"\321\"u\3036P;\326\264@\217\251\252\243(\214@\215\3411U\365\323"
+	.ascii	"\"x;+s\265\027\320\"u\303\366\242\204 \037\346TM]\322\306\355"
+	.ascii	".\311T\233\227l\262\277{\357\315^\237\222\306ZQ\n\367^\256\310"
+	.ascii	"\344\324Ywf\376b\346\025\314\226-9W[b\220TK5\216Yi\254\235\305"
+	.ascii	"\3746\276y\325\340\306b\3669\331\271'W\231'Wy\347eg_\256rO\347"
+	.ascii	"gg\234\177\3756\007\373y\367\372\001<\355\234\352*\243\271\312"
+	.ascii	"gZ\331L+[\264r\243\225+Z\371\003\002t\201J~\253\355\336\250\270"
+	.ascii	"47\213\211\266\365\262\237\354O\373\317n\231\317|)|5\336\245"
+	.ascii	"\261\332\357\324=\215\037F\240\336\206R\264\263\241\326\356\252"
+	.ascii	"k\355\376\244O^\3067\343\335X\221x&|(\023p\304\301\335$\373-"
+	.ascii	")\257\024z\265\265F\374W\222\356\336\350\306E\366F\344\217\361"
+	.ascii	"\356&_\354M\210w\362\342\307\244\274\311\23516\313.6\247"
+	.string	"\267\020\"&h\351\035\355&\021\2530c\333\030\325\275\367\236\235\305g\025*\333\223+\302U\345h\326g;\333j\323>\375\3047:\273O,\277\324~wW2\307*\266\363\272\266UsL3>\351\364\3517\232\025\330\262M,\315h\372\272\247wWA\3148K\232\250\245\345i_\013\227Xx\315\323\274-A\304\216k\276\004N\207Sw\026\357\264\257O,\2550\3253l\323;\255\273\322\212;\256\3515\201\257\035'q\372\272rqBb\254q\3742\036\361+$\252\334J\t6\361S\217\3749o\366\372f\007\236M\351\312\241\304\013(\310\200\333\275KG2\013}-Ez\357}\300\2472Dd\343\246%\343\274\031C\"\030@\026\304y4$\"\032!y@\n*\022\"\032\t\t1\350\304\32004\024<\"Z\b\020C\203\212\240\243`\021\032B\307A\f\202B\244\024\300\24108,\022\032\002\213\210\200Z"
+	.string	"\203\204C \003\037\016\272\020\022\002\217\202A!p\247\\zc\205\3753\302\f\311\262\324\306\\g\361\016\b\252\323&\2203\301\323~Z\360\264k\217\333T\301\323\326i\337\262\253\315)\307\257\376\025N\234>\333l\264\231-\\\250G\262\275U\255\304|0,x\\\364/\031 \270\335{#l\270\227\0167\025\240}$\325\022\217x[\227\263\257v\213\304\212\211\231\276\367*\241=\325\266\331\314\037@\324#q\372\327\324J\354\323f\237\327\266\003e\250Q8\245\bC\004!5B\021I\232\264\030\220\002\241)+\017\021\3009D$\242\264\035\215\006\221xo73\326Th\0068\352ixW\035?T \275\250B*\313\240\013\n*"
+	.ascii	"H=\326\302\314F\004\006\223 ]\335\372y\024-]\332\2247>\001\346"
+	.ascii	"Md\215\320*\377\2674\037\230\370\301+\263P\227FVj<\334!\025\304"
+	.ascii	"U\226nM\223O\320\fk\275\376\360@9\321\023\207g\013\231M\320~"
+	.ascii	"\370\260\211\342\243!o\325\264Q\3027mKH\004\264;x\024\376\303"
+	.ascii	"\347]]\266z\351\230\224\275\215\217\006\363\332\277>mu|\025\226"
+	.ascii	"\374\232\321\361'\336\006\220\316\344\005\033s\001\234f\324`"
+	.ascii	"\005\007\021\006\321\202\374\030\t\246\032d%\357\256\220\244"
+	.ascii	"\350t[\314\037"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch2.81.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\027\005]!"
+	.string	"\266\374\324J\200\030R:\273db\300\276H\214EX\241\322\354\240A\031\372"
+	.string	";\003F\005L\331\361\320\016r9,F\361\252\325\242\220\322\242\252\350\333\020\314\220l\bJ(.O\364#\241\271\277\355>f\026TT\331al\266\021B\b\221;\311\276"
+	.string	"\265"
+	.string	"\307"
+	.string	"UiI\324\356U&8\312\034\326\243\274\36378f&D$\264\362K\204\317:\26257\211X\303\301z\264\306\3362?\311\225\b\217%\343\002\356\235B\373\272W\271\200\017\254GYy]zt\375Mz\224\205\314`t\224.\222\003+\034E-\265{o\257}p\377T\236W+\274mUS\364l+\344\253\024\264~\"\223k\306#\322mg\215\231\323\215\263\201X\321\256\005z<E]Ea\025$\f\217\247\250\247'\2024\2601\027{\0013\247\033\247\256i\210\361ZK\026\275\035m\374\304\035\223l\347\216J'\357\336{\346-\323\221h\255J\341\336\313\326x|:\337\316\314Y\314\274\202\371$\0137\310\2533#\324\320\2561+\211\266\251\230\337\3044\254\032\334S\314<\357:\357\330,\353\330,\347\334\353\274\263Y\326\341\034\354l\363\254\237\346L\376\334\261~"
+	.string	"o\236\327\233e\325f9]-\243\253\345S\265\334\252e\253Z\376\200"
+	.ascii	"^\276\034\177Evo\323Z\231[\206\206\021\271\327\337\3657\177\260"
+	.ascii	"\237\314g\276\024\276\030\343\232,\366\373tO\343\207U\220\264"
+	.ascii	"\2405\f\fX\205C&\277n\317\n\345^|&\343\270\204\3017\341G\231"
+	.ascii	" \305Dr\264\2137T^'\025y\365\025|\326\321\355\236\210v\244+-"
+	.ascii	"\310\347b\334Q\376\326\235\004\377\344\005/Iy\2178b4\313$\225"
+	.ascii	"\245\264\020\"&\230\351\036v\264\210Tsy\306\005u\357\275iSq:"
+	.ascii	"\006u\356\330\214\034\031+2\373d\347\323\3224O3\361\211\322\356"
+	.ascii	"\023\313.\266\337\335VL1\212\354\271\266}\232)6\211?Jy\372\035"
+	.ascii	"&\325$\236m5\211\350\256w\032\207\024\302\344\2622M\313S\247"
+	.ascii	"w\375[b\311\265N\347\262\b\331*\236\371\0225\035K\335T\234\323"
+	.ascii	"\273>\261\264\222d\3110M\347\364\rY\265V<\243k\002Y;N\"\335\265"
+	.ascii	"\325\262\224$\3325\276\027\217\370\025\022c\267R\202M\364\330"
+	.ascii	"\033{\322\243\272>\363=\260)Hr(\301\362\3711\200v\357\360Ff\240"
+	.ascii	"WI\261\336{\037\360\251\004\t\321\240U\311H\217\006@!\030"
+	.string	">'\210\264\b(\024$2\362`\3643\004\024$\002\372a\300\211\241!(\310W\024\264\020 \206\006\025?E\276!5\304\215\177\030\370~F)z\300\237\0178\004\004\354\r\t\371\264\350\375\374\200=\006<\354s\001\364\353\025\371|\277\036N9|Oi\3753\300\220\225\r\233hk*\306\001Qq\032\005\222&\370\332L\013\276\266\355\361sU\360\265qz\267L\222-\345\340\331\277Bj\323i\243\2556\263\205\013\366F>oT#1\337\013\213\034\017\275K\006\bh\367\336\b\033\316\245\303Q\005j\337\b5\344\021?\333\222\366\305~&\245\246\\\365\275\027I\335\261g\243\315\374\001\204\275\321\246yJ\215\304<\215\366s}ve\250Q8\245\bC\004!5B\021I\232\264\030\220\002\241)+\017\021\3009D$\242\264\035\215\006\221xo73\326Th\0068\352ixW\035?T \275\250B*\313\240\013\n*"
+	.ascii	"H=\326\302\314F\004\006\223 ]\335\372y\024-]\332\2247>\001\346"
+	.ascii	"Md\215\320*\377\2674\037\230\370\301+\263P\227FVj<\334!\025\304"
+	.ascii	"U\226nM\223O\320\fk\275\376\360@9\321\023\207g\013\231M\320~"
+	.ascii	"\370\260\211\342\243!o\325\264Q\3027mKH\004\264;x\024\376\303"
+	.ascii	"\347]]\266z\351\230\224\275\215\217\006\363\332\277>mu|\025\226"
+	.ascii	"\374\232\321\361'\336\006\220\316\344\005\033s\001\234f\324`"
+	.ascii	"\005\007\021\006\321\202\374\030\t\246\032d%\357\256\220\244"
+	.ascii	"\350t[\314\037"
+	.text
+	.section	.gnu.lto_gyroInitSensorFilters.82.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\213\002U\021"
+	.string	"\346\337oG\320TQ:R\346\027\244\352\302\335Z%\177i!\250\240\206\215\232X\243\366\240]\221\013+\343\305\231\032\353\222\034N*@\f\027x\035\026\344{\025ThTLv\003\342k\341&\216\214\224\337\333\377\266'\215l\"eJ\001X"
+	.string	"O"
+	.string	"`"
+	.string	"!\276\264\375\002\325"
+	.string	"\035\331\rO\036\235\322=\002\310\247\375\030\227!{M\304U\2734DxvC\024'\350\036\035^"
+	.string	"\367\330="
+	.string	"\367h\231m\204"
+	.ascii	"\211\235\245\324\024\211\311\001\332]OW\\\366\224\371\307\371"
+	.ascii	"\210&3{\212\034\354\256\223&s\342\326\333F`\373\201\255\005\002"
+	.ascii	"Cv\b\223\252\302\376\266\273k\245\261_\373K~s\2534\235\212i\224"
+	.ascii	"\246O1m\322t)\246I\232\036\305t\247i\321\226\3464\035cz\323\264"
+	.ascii	"n\351\324\364\007\240\\\340"
+	.string	"\220y\315g\327\304\220\320\376D\0360~\363\333?\216Kv\370\031\262\337\004=3:l\242\212T\001\247\"\f\337\361\342\341l6\215C\254\347\200\355l\2522\263\023TK\345U\365\344%j\267\\y\232\017\304\350\314\251\312\362\033\257\316F\252\312LN\220J\257OQC'&\2115\\\007\266b\261;\202\201\237s\032\237\377\342\321\034\300<\355\321\007\271G\2256@!dS{\311 2\260@p\305\305\303\267\201\225\232@rk\365\305>\260x`\354\003[\\\240\327\362Z\201y\255\030\350\255\f\370sq\305\274\016\337\027\363J\341\313\267U\232\016\211\220\237\027\205\261I\2364\005\001\245\251\b\367\031\2022\351I\302{\202\230\202Lr\244%\245P\241\204\316L\322\222\205\003\371A\322\005-:\035)\312\205\373\350\321)\0272 \020\003\2211\316\001\276\220\253w\261\2632\325^\307d\255\246\355\tv;\333\335\204\274\336"
+	.ascii	"\007|\220\3547\021\312+\313\260\201f\302\031|+Jb 42\261\335\004"
+	.ascii	"i\304\325\b\310phq\204\301\204.3\\\204\\\334\350bDd\207~^\204"
+	.ascii	"\330!KPA2\307\205\327\237\223:X\313o\"\017\275\002 yqy2"
+	.text
+	.section	.gnu.lto_gyroInitFilters.83.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375 \372\275\006"
+	.string	"2\315/4Pm\222\016$]\316\253\276\253"
+	.string	"\251\3605#\021\330\013\374\231w\215\233\037\207m\373\2506\352\b\245_\374\26333\023U\325\035!\212\210\352\307\037o\214\020\231\002o40N\tO\212P\352p\244\327Q@Xx\233(=M\301\220\201\023_\003\204\361a\260\254\373\\B+\231\307Ili\375(6]2=\265.HC\034\356F\243\037\246V\253\321\235,\215\036\"\242\325:\023B\311&\\\365X\325\034\306\027 3s\367y7"
+	.string	"2\271:B\222Y\261\242\222YT\002\372\213\231\372\223b\032I\320\301A!\222\222\231\317e\224j\243n=*`]U[\300Af\336\254\313\242\273\376\006\177\346\277\b\007"
+	.ascii	"3\001K8\023\360\370\032\273\f\3622\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_isGyroSensorCalibrationComplete.84.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"E\t"
+	.string	"fQA< \005)\035 !\024l\245\271@\226@\005%\024m\244\030\"\341\f"
+	.string	"\320\340\236\\\326\366\372g\354\210\273\266\231\f\365P\204"
+	.string	"\230(\246\034\300\006\226k\001\031\324'\362\007\331d\357\224\0020"
+	.string	"1"
+	.string	"/"
+	.string	"\266\335\360\200r\n\364\241\332\211X\221q\305"
+	.string	"\330\355$4y\352/\345\337\345\024\254Y\315\013\246\372\013\220\330]\277\027l\344\206\267\255`\333\3016N\217\003*!\260\317hvEj\001\326&\322Rl\243\354\217\355\367\354\263\274\005\365\330\tD\260-\031\310\314n\307\340\005\317\243\273\033p\217\236\027p\217\0014\226\347e\246P\216]\017\263\341\331mA\274tp\034\234\240<\372'\356\3610\244\023[\275\232\335\251\036,\261\277\355\356\032\222x{\354\207\3609t\326\022iB\300#\321\244\036\026\262\322YK\244*K\027\025\030rD\253\024!xf\220\250\324\230\223\312O\267\367\006\023V\220e\337\304\035n\220\273q\005\f"
+	.ascii	"X\211\"34\030q\r\307\2622\343b>\306t\325\263\214\313(<\215\207"
+	.ascii	"\352\020\306tM2"
+	.text
+	.section	.gnu.lto_isGyroCalibrationComplete.85.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\025\t"
+	.string	"V\221@90\221\322\001\200\254\311\337\224U\205a\3610\255\310Q7Z\372\343|\245\3013#\271\213\375\257\177%\252\006F\266\037?\031\245\244\300\n\235rw\031\025\234\001\t\220\355&wJ\0011"
+	.string	"-"
+	.string	"2"
+	.string	"\3626\311\336|\200@rI\340\3024\243@\262\222B\251\355\202S?^z,\371\177}\303\322\232\305bRX\246G\200\205\335uT\2612n}\201mZ\250\250\036\3667\253\035\266\243U\243\343\306kYa\260\256\022\356\256\302\232u\221\262\020\333\367a\377F/1CkV\333\335\355\322\036\331\333\003\234\227\224\f\025C\3773\304c \002\231\317\334O$\002@v-\022\300\233x\276\353\322\024\242x\325\245/\342\\F\375w\203\021\030\027\007\354;\305\320\006\003\366t\270\256\302az\035\347\205>\336\f=4\200\246\247\363fg\300\\\304\247\233\023\034\327\315\r<\335\252\177\375\032\251\r\021\032\332IQ\366A\234\250\252\001\013"
+	.ascii	"2\003\3020\r\314i\230Mesi\027F\034\214\351\202\262\034\256el"
+	.ascii	"\212|\346\336"
+	.text
+	.section	.gnu.lto_gyroStartCalibration.90.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`I\002M\023"
+	.string	"\266b|I\320\322(\035J\306e\265#d\305\t\030\206\002k4\321\250t=:'\205\352[K\035\037p\024'\234\035\335\277\321\027\341\3678\374[\260>h\267\031\003\321V\036FB3=\312\361c#\356'\201\017\001\340\254%K\232\334)\005b"
+	.string	"b"
+	.string	"i"
+	.ascii	".\301\021\271\330/v\370\357\241m)\355\222\004\262\347b\251#%"
+	.ascii	"\345`\354\352\020\370\300\351\237e\266\216\353r6\325S\023\023"
+	.ascii	"\224\264\273\242\202\270\354\3633\251\224\371\340\tJ\346\006"
+	.ascii	"\363\351\341\237m\2034\331Fn5\251\341\215f\"\260\273\367\271"
+	.ascii	"\234\271\325\244\004Ov\327R\346\326\341\006o\273e\033\305\226"
+	.ascii	"4\001~\261\310\313\260\314\177\327\002:\037fr\351rwa\324\261"
+	.ascii	"\251\232\232\351\355\220\216n\324$\020[G\223\212c\337\264z#2"
+	.ascii	"\245\303)\0352\245QR\372$\245\301Oz>\367\353\245?\" \006\355"
+	.ascii	"\b\250\007\247=\335\322,)\355\214\257(\204\355\373$\316{y\t\207"
+	.ascii	"<r\320\260\311\355\356u\337\331.\377\t*x=\241\036\241\212\204"
+	.ascii	"(JC\005k\330xh\023\276\202\302iwM\374\241\023UP\255V\363_\210"
+	.ascii	">H\347\347\244(\017q\270\215&\250'\2352l\"hr\311SA}L\220"
+	.string	"\363\254\362\024+\247\335\232\211\217\342B,\177\347\2371\264Z\363\337\324\363n\340\326S\262\361\371\231\311%\253Iq\200~\275\300\273\211\237\210\371;\001\256\027\253E5Z`eP)Xq\261Z#J\013ld-\200\261R^\221\274\306\227\025\0216\276`.\025\230\350b\251Z\342j\204\211$\001\374\322\2402\212-\257\327(\206\272\331\365\306\fF\354\217\0353\245M\305yl\276x\016\347\"\311\307u\273\373\251\336\347\262f\006\007\214\210~\347\0067r0 g\347\007o\001\001\200\215\242\263\210 !%e\367\217\007\0273 p\002)T\310\003\263\200\273C\266\026x\350v\314\330\324\272L\3602R(\264\221\223\244\207\233\2456\214\272\b*\214\234\214\235u\332\261L<G\345h\333\2623\331a\020\r\261\001;\310\273\t\300v\004\217\242\300(\243\307oT1.\024!\330\023Q\030\355\031\336N\330~\321\212l\006\305"
+	.ascii	"\355.rJ\342\234\260\275qI\274L/\337:O1o\337\364&\2302"
+	.text
+	.section	.gnu.lto_isFirstArmingGyroCalibrationRunning.91.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\006\001\305\f"
+	.string	"\026\030VB\020\2176\035\203\rY\351\007\232\202\277"
+	.string	"\005jO\005Xj\260\213*\304\301\r;j\220\213\375E\346\252\237\274\326\250_LQ(\371\360\037\202\n\001"
+	.string	""
+	.string	"T\367\240\355\267JE\327A\n\375\035K\366\2262\245D"
+	.string	"A"
+	.string	"G"
+	.string	"\246\234@\201\210\263\177(%\001\272\017#-0v\277J5<{\204\232\231\237\3510\310\360\022#\342@\217"
+	.string	",\034R\334\204T\r\267\301\315\356\276{\222p\241\314Lgw\235\"\256\302=\335v\003\333\005\354K\b\252\331pA\313\222\375\205RO\354\303\325\221\355t\204i\b\323\237\364e\305\326u\032\363mII\306\236\210.\034l\337W\271\027\362\025G\026\030\026&) O\361]0\230\360\360h\207\330\324\343m\021\007\335\263\004\205\026 \027(\356\331s\022\037\002)<o|\304\003\001(\273\333\202\226\213\340\360I\217\266<<\246{7\320\001\206d\242\262\222\273\013Rg\3235_\204P\261e\f\373,\007\221\371$c\037y\321\243\3771=>\326\340X\027\310\247\302.\013\353\360`U\307\206\003\216J\343\302*\316"
+	.string	"[\020<W\025\301\262\256\212\372\264\303\325\221\023\036x*\202\247\222\330\216\272\3214\344\324\250\037\231\241ei\212z\342_\241\216>\023\324\007\030"
+	.ascii	"K\204\236\337\206\2073e \fn\244:C;0%\331\204\224`\342\364\263"
+	.ascii	"\b\250\204\210\3737\204\342\232Xd\342\237\0137U@3y\212\330\226"
+	.ascii	"p\355a\205OU\003\251yz\273J\031"
+	.text
+	.section	.gnu.lto_performGyroCalibration.92.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\265\rUE"
+	.ascii	"\nv\360\03190\246N\007vC\211)v\230;\017N-\032^\3424D\324\254"
+	.ascii	"pS\316\337\0031\262:\256\254[\3716\003\230\317\030\371P~\243"
+	.ascii	"r.Y7=\033\035\312\221\221\266\273\245\224R\221\001q\001\216\001"
+	.ascii	"\204\310\032\020\307\230z\252#cN\006\002\304,\3404\361\320\217"
+	.ascii	"\373\217\037\"ZO\275vN\351\026x\370\346\320\3061O\3631\322{X"
+	.ascii	"\252)\351\f\365\215\236\376c\263\366c\003\216\006\2311\033aN"
+	.ascii	"\336\361c\016\323\302\226\303\335\307]\247\355\334\346c@\335"
+	.ascii	"\256\265\355\344\360\256\317\260m\333\b\275\262\330\261W\255"
+	.ascii	"b[\261{=\007I\313\341\n\324:um\333&{eF\302\234\354uM:s\005\f"
+	.ascii	"\267\365\226\364\262u2\232r\241\235\271\3374\336\355\274&M\325"
+	.ascii	"\266o\204{\332VO\002?8\366\312z\215\305\366zl+\266W\276\314\224"
+	.ascii	"\002\240\265\315\013wp\322\350\034\266m\353\365a\370\273\250"
+	.ascii	"\327<\345\267\261\256\254\252\250\226SJ\251\250$\022\352hd\327"
+	.ascii	"\342\373\345FJ\233\215u5\327Vsc\274\212.*f\214S-\212\316\305"
+	.ascii	"\221\363eq\031W\234\320\266\255\323\247\300\254\265\265\222\332"
+	.ascii	"RE\n\177]>\265\362\f\"g\323E\247\036e\004{\273\343T\351\313\032"
+	.ascii	"\231N\026=\340\325\311\275\034;\202\232.\272\305\221\213\242"
+	.ascii	"\\\212Zm\333\322E\2658T\202/kY\372X\204@\005\254\202\245\310"
+	.ascii	"MR\323E\331\334Xt\200h\330\247\027E\263\024\263\320\250\224I"
+	.ascii	"J\323\234\355?\235`Q\224\332}\355P\244P_\255t\261h\001\355\220"
+	.ascii	"\213R\212V\214BLk\224\224>\375\273\257g\334\365U\372\262\326"
+	.ascii	"\326n\004k\333\226]M\272\326\f\240\231\273\n3\343`\216Z\023q"
+	.ascii	"m\333j`\276m:\322\265\333\212\273wMx\361 \335\274\013'kp\256"
+	.ascii	"\t\333k\347M\037\325\035r\036\3002\203\212\017\307\033>\301s"
+	.ascii	"\231bI\321%F\220\236\216\310\032~C\206\337z\rot\004u\343\fk\301"
+	.ascii	"\021\307\266m\277\270\035\365\243\022'R\244`{\315\360MG.\217"
+	.ascii	"\353\267XO\264\031\020K\341\271\236\r\204\3229\275\312\026\236"
+	.ascii	"\302wZ\"\037^\321\213X$jE.\030\206\fo5\031l\257\026\276\371t"
+	.ascii	"\003\251\240\247\376c\261>D\343\330\266\317/\356\300\233W\203"
+	.ascii	"{\256\327\256\353\033l\257\t\276\377\272\001\032Ig\250xyg^\375"
+	.ascii	"\266m\233\377p\314zN\3777\346\3563\251\037\225\377-\305;\243"
+	.ascii	"X:\237X:\233X:\227xg\022\357<\202\312Y\304;\207-\235\301\226"
+	.ascii	"\316!\226\316 \336\371\303;{\240r\356\360\316\034\336y\303\322"
+	.ascii	"Y\303\3229\303\027\322\371\002\225\263\205w\246\320z\335\023"
+	.ascii	"\332Os\327;s-\235\267\3369A\347uk5_s\326;\003xg\254\245\363\325"
+	.ascii	"\224\263\225\322\271\n\351L\205t^&\235\247\220\316J\244\263\024"
+	.ascii	"\3229\n\351\234|gd\322\031J\312\371\030\345l\204rf\221\316+\322"
+	.ascii	"\271\230t~\244\263C9\367\212\207\304\350y\307\367\202z-\225\252"
+	.ascii	"\2476\321\332\307L\373\351\3463T\210\223\225$5\032\324\001\205"
+	.ascii	"\230\250x}\356\3705\262\213\n\373&\304b\356\3456\017\020\352"
+	.ascii	"r\361\246\006\231P\257n\246x\366\004\375,\201}X\210\007\361`"
+	.ascii	"aN\365i\210\017\017\202Q{\370\017\035\336\203!^\341[\\K\207o"
+	.ascii	"C.\365kK~\362_\314\036 \362\223\337P\303\t\217|\243\243\336\242"
+	.ascii	"\204e\016\331K\330\tp\366\b\237\216\b\005\325\345Xn\333\207A"
+	.ascii	"v+~\345:\371\242\335\2644\366\370P\037 OZb\007\357\202r\245\260"
+	.ascii	"\255v|6K\227\3477\033*\216 \347\361\252\227\260\306o6\354Q\227"
+	.ascii	".\341\236\343K\345J\275\325\256\224\355\325\370\035\235f\342"
+	.ascii	"\304v\346U\002\237\324\3701>\034G\350\254_\233\205c\366\276\234"
+	.ascii	"\265r\261x\253u}\377\351\253=\233\340$z~\223}\270\246\301r\330"
+	.ascii	"\024\247\357\260\230G\341\360}\247\033\240\021\034\364\342\263"
+	.ascii	"[\356\024\315\237\004\211r'\027M\327\240\247\3355\\\203\016="
+	.ascii	"\020\307>\353\026(\250ve}\177\266q\347\235\237]<,5K\305\367_"
+	.ascii	"\277\241\324\377\342\257\201PCoo[\353\361\322\325\353\326s\006"
+	.ascii	"\023=\304\375\267\036\271>\236\370o\253\323\265[\200x\361\260"
+	.ascii	"\374\233m:\211S\237\365\341\2307\361\037\327 \\k\272v\013\302"
+	.ascii	"t\246+\227\265g*xx\b\301\373\231/\231k\306[\215\265\236\337d"
+	.ascii	"n"
+	.string	"KA\224j\225.\032\f\032\322\264\341]\343U\270\240\337\350\006X\250v\345\217\231]\0013\277hI\374\307\025G\306x\360(b\306\232\375H\222\243\310\003\b\231\017\263\2612\0373\204\220\375(\222\243L\307\017 9F\024\0212\026d\354\b\031\013-\031H\336\321EV\246\244\207\227Y\031\231\231\22013/!?r\004\361\332Qf\346\3255\200\311\206\214\225y\025!#+\363J\352\235\365\2771\330\331;\273`\001x<w.\336\325\355\333d\261\036\300K\200R\235b\316w\233\b\330\316\305\273\302z&\324<vy}\325\302\273\231\216\004\231\220\006\021\333\254\332@\td\345\200\275zO\334\233\252V\013\253\355\200\265\372\253\027\020\230\306\246\302\231\231\223\230\205\336jV\337\202\2728\277Y\265\203\255\372\262=\302<\207\263\203Y\211y\211y\211\355\265\3529P\355\330\261\225p\253fnb\231\231\234\230\235\232\017q\213"
+	.ascii	"LT\370\250\244t\212\3578\355lT\334\232sX\314\335\244\370\236"
+	.ascii	"\323\313\207c(B\345\327?\241C\221\320Y\337\232\212S\\\235\365"
+	.ascii	"_\337}-c\017\360\317?QZ\243HI\365h\274\216\377$\264\271v\f\330"
+	.ascii	"\\\271\002\203\027^\371T\317\002\202\236q\266[$9zm\313!\252U"
+	.ascii	"L\317\266=S\260\374\013O \020J7\365\313g31?y\032f\225n\352Y\272"
+	.ascii	"i\225\323\362\223\2467\251\254N{\220\224\357f\340\274\314\265"
+	.ascii	"[\020\306\311\\9:R\037\365\312oh!\024/eb\3204"
+	.string	"qO\260\216\341\211Ga\342K\374\2110\037#\306\004\211/1\342I\210\370\021\201x\205\307\205\021\361\035\b\216\377Z\317\340\333\265k<n \242\212i\370\004\201\026\250q \005\231c\210FDD$I\222\f\007Q\005\304\030F\245J\017\021`\261C\354H\022u>\350\220\003v\274\240\201\342\316t\204\373\251\313Q\303\316pN\177\020\240\307\213\263$C\223\373\353E\363\013C;\262\333\206\252\f\346\022:\256\t\345XyR7l\300\254\26347Ps\266\321\275\260\211\316\030\352\241\033wK\235E\232Q[\3217\220\034\332`*\244\377\270\032\3167\373\261 \263\342NT\034\021\177\0132\370XQ)\323h\001Ao\261Q\243\035%\205#j\335A(#U\201:\362iI\021\276\036\271Y\311\204\2564!\2500\022\221BV\222v\324O\377\270\265\003\217i\177\031\262-Q\341d\370\214\276\177N\177%i\314a_\346"
+	.ascii	"7(2\035\320Nm\r\035\207\376s#\3001\3222\"2\324\356\013\345\214"
+	.ascii	"\332A\301\221\215\221\250\035Mkqn\027\245\357\362\332c\326\360"
+	.ascii	"\213S.F\330e\307i\002k\367\235\254\2023\2379\312\352\225M\255"
+	.ascii	"\274q\204\201\357\363\235\007\022\350\201\332;\260\355x@)\344"
+	.ascii	"#%\362\250\350\314C%\324Hb\254\215\235\334Zv\334@LbP\3734.\313"
+	.ascii	"\300\034yGfO\350*"
+	.ascii	"\235/\252\242#%\371\360\251\0274gn\236\b\255KP\212\320\316\224"
+	.ascii	"o\330\371\353\211\352J\n\243\0349\235\001*\224\2429Y\241i\030"
+	.ascii	"\320\305Epou\025\336\206C\254*\316\325X-h\251n\312\217NrJ\005"
+	.ascii	"\035 n\020\246\326\037\267o\002\367\244\322\261d\0061\277\344"
+	.ascii	"]\034\367\335\202\260\2143L\217\261\nv7^\261\250\321\367\003"
+	.ascii	"\032\323\207O`\310j\347\245\365\242\271\317v0m\206,\207\343\227"
+	.ascii	"\211\201@\236~$\026\354*\201\211^\276\345 ?\345\2068\226q\030"
+	.ascii	"5\213\024.@\tf0\3646\220Q\022K\321I\033\360\377\313\001\207\033"
+	.ascii	"\\\251\304\013\344\323\rV\035\320\3172O\361\212\344\223\342\231"
+	.ascii	"j\177\367\250\2005\332\234\303v\244\037\214i\250\374\365\002"
+	.ascii	".\211\373\362\213\367\256\225Rt\205\244,\177\250\211F\250"
+	.text
+	.section	.gnu.lto_handleOverflow.93.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\"\004\205\032"
+	.string	"\366\257\247H\300\226M:\024\240\002ec\005\210\t@\033\220M8\234\314!\033\001\376d\347g\335\037\261o)U\026\306\r\355\216r\322u\327\365O\264\rX\377\215\207 \310\006d\356\024\035\021H1\304\035z\305\252n\332\022B6\221;\245\215"
+	.string	"\204"
+	.string	"\226"
+	.string	"~\032\361EZ\371$\211)\310\225\335U\360\351\b\266\374\335)\367\035Cn\355\272\310\352\031?u\300K\373:\316\224{\023\211\003\330MR2\265\373\333q\202\361\323\277\337\204\237\343k\302O\347l+9%\226\250\207\351\207\021\024\326\356\302\364\305s\037\305p\202*s\276\350\3232\321#\372(\372\210\005\\ \255x\bE\305\n\236\234%$\350\352\025I}\365\214@\235\335=\324\345\211\336NJ\321gw-M\364\220\356\326m\243\260\r\302\006s\002R\217Z\262;<\310l\334\335\006@.\324 X\301\370\364I\204\237W\006N[`\370\230\232t2\313\376\355\244*\331\007W\223\354P\032G\224\266\371\216\277\346O7\315\233~"
+	.ascii	"\242\364kJ\317\204\3222\241\264kJ\307L\351V(=\206\322\342\224"
+	.ascii	"\016\247\364\f\245\301PZ\247\264\234\322\317\031\232:J\321\373"
+	.ascii	"\325\221\335\243\254/\353dR\305\370\323o\337\357q\037\266\313"
+	.ascii	"B\217\362\003\337\025\226\220\355\372\374\241\354\262\003\273"
+	.ascii	"\330\227\f\275z^\372\300w\305\245\311\277\335\23532:\343R\231"
+	.ascii	"\030u\375\310\225$ArW\205\2371Tr\034l)m\324\226\206RD\035C\025"
+	.ascii	"\365`v^e)\230\225\021 \004KE\bX\205\372&\337\024.Trw\211T\225"
+	.ascii	"L\243S5\360XR$\273\030\324\251\023\f\357\212*\250\347aIU}\025"
+	.ascii	"\217\211Nf-8\021K\355,\355\256\003[\366)\240\003VR\003\226\244"
+	.ascii	"\236\206oJ\016*\235\324\253\024\355\256\t\024\355\352\f\\iT\016"
+	.ascii	"\341\315\3309\350B\034\346\300#\233\005\341`\264\332lV\213\005"
+	.ascii	"\220\341~&\340d7\331\004\241\232\207\r6\231\b\t77\013\262YP\005"
+	.ascii	"\034Mf\263\205\210\315P\210q\214\247f\033\001\004\273\331j7\232"
+	.string	"\354\006\243\005\375\314`1\333\r\306#\300\265\0172\033\fW\253\331`\256\237\356\340j\322\350\205\210\023\235\356\306\032\2052t\323r\332\202\345cb\241\277]\"Q\2252\2046\2067\3110\356n\003\234\323\360U\301\221EgwCU\262\362\246\376\023\342(\213#\033-\260Dab\2438\232\243\305(\314Kk\324F\357\343`\r)Wn\030E\311\bS\250Q(\006\215R\222M0a\2024\005\205\026\003\260\002\241)2\017\020XFb\223\264\030\232ibI'\006F\352d\357+\253\001\031\026\213\205\341Kq\305\324'\363k\354\344\3458TzT\"\224\363C \021\2470^~\340\346\026\362\214\334\310\323(FoD\234\200tF\304\016\032\207B\234\003Op\346\216\353\276\021\255\261\375\005\233\204\333N!<\306[\263\211\301\022\2746\362as\343\307\235\324?\274\275Z\310\327\231LzI\277j\024:\3076\r]\343"
+	.ascii	"\276l>\307\372j\222\006W\211\233N\376*8\275\271e\t\034\367\237"
+	.ascii	"\274J\245\315,5"
+	.text
+	.section	.gnu.lto_filterGyro.95.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\033\004\275\030"
+	.string	"\206+\231I\300\026U:t\314%"
+	.string	""
+	.string	"3\217\tc\336\0050\305\261\316\203's\202\340\037\327\270;;\007\210Kq\337\200j;Z\347\035\230\027\324\310\211\002\021`\216\356\254\375\256\273\225]y\266\220a\252\213\252\252\315\331@\032\331[\356$\003|"
+	.string	"z"
+	.string	"\214"
+	.string	"=h\367m\222\215\320L\013\271\250\262\245\273q^\367"
+	.string	"\371jC_\356\356\347\356u|G;O\304S\335FGE\272{9[\200|\335\336W\343+y\325\370\272\264]-\254!6B\002\350\245\273[\fc\371\264\367\245\223\366Jy\322\366;\236\272Q{\2453\335\035\203\033\242\004f\021\3566i\r\024\347\377\376\030>\245 8\024\237\246\003\335\275\223\bw\342;~w\203v\267\301.u\020\032.\004\2463\214=\b\020\331\335;@,\314nt2^\367\"\306\327\363}\3748\224\344vGl\263\310\334\3355\346\027\273\275\332|\263\321n\r\315J\225z\360+s\336\037s\337\267\254sQ<\367T\347\222<\327D\347\216<\267\322\271\224\347\362\234;\347\334\007\030\177\350"
+	.string	"R\321]\242\b\246\245\324#4\036\374}\273\007\356}l\031\\a\321\255\313\002\362\275\375o\313\327]\036\017W \034J\203[\031\242\230\225\364\340UN\314\223[R1\311k\342\325\024\017\377\r\245@\370\223\b\217\"\341HG2\213\310\204?11O.G\212G\336\312\252&L(|\311X\341I*\363\260X\342\245\246\fS^\346\024Sh1\304\265\335'}\370\217\b\251\347N\f\370\034\311\005\"C\026\220(\205\315u#?$\311\314\\\206\271\335\344\263\f?\314\b\033\267\327\205+<\322\321\207L>\022\026\236m\0263|\310\nw\206\335m`7\030\022(@\020\223\205\370!g/\020>4\002j3\350l\350"
+	.string	"{\365\310\\A\033^\030zb\262\020?\255\231,6\343\340\232\2658\274|`\255\013\262YK\347fc\035\\\262VP,&k\225\275\376\233\215v\234\3160\261\264\305\306\267\312/\366D\344\032f\342\304y\311E9/\371]|D\241\371\345\264\273\233\356\200\227\\\303\377\035"
+	.string	"\027\237R0w\233\305\245\341,+\274ap\"L\200\016\013\320jX\251\200\311\355V\254\030\305{b\032%\017\007\352\002W\250Q \307\244SfFf$\315\302$\351\320\002\031\252\232\016\021P\261r\252j6)\227\003c\005:H\345\n\204\204\306<\253\017\334\370\243\366\276\230\025W\202\307Ex\225v\356f\315g|\310q\016\347\360K\233\317x\350\0067\347y\253\223G\323\366\254\262\345\341\020\216\265\024\243\232\370\270#W]\222\306U\n\\\310P\231b\216\"\035\2070\212\263\\\217\303\316\303\013\f!\342o\005\t"
+	.ascii	"\241m>\316\020L\356\001YX\026\207\215mN\\6\335\006\252\322\372"
+	.ascii	"7\002{\003Z\225\324\307\264\245n\263\177\374\032Z\021\343\340"
+	.ascii	"\263N\321\337\202\231\230dH\005"
+	.text
+	.section	.gnu.lto_filterGyroDebug.96.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`y\006U\""
+	.string	"\306\373\321I\200\030R:\273\\)5\360\022 \2202\360\332\301\201C\271\313B\335\267\325j\"\371i\231\035{\271\356\357\255us\252\332\245n{\226\3619"
+	.string	"B2i\311\245 \214z}\314~\371\240p\027\275\332p;\372?!\233\020\271\223\f\271"
+	.string	"\254"
+	.string	"\305"
+	.ascii	"\347\342\334O\346#G\002|\222\311\200\2109\227\250cK\332\275\267"
+	.ascii	"\300O.J\177\002\231\3171\363+\363\263\256\005\374\026\213\353"
+	.ascii	"\334[U\305\311\275\310\003\234 \375\311\310\363\330\237\351\001"
+	.ascii	"\330\237\fd\026\243k\352'N]e\356\275\274\346\301}\023y\306U\340"
+	.ascii	"s\270[\212\332\323\354\n\344\243EF\256#$\371eIT\36093\307\f\252"
+	.ascii	"\206\211`Xq;\244h\374\026\224C\212\352\351\315\240\250\202\200"
+	.ascii	"@MUt\306\255S\213z\306\270i\0220Z\201q\023\325d\362h\321\021"
+	.ascii	"\346_\257OQ\304\332\347:\317TV[\016)\032\257h\321\275\227k1J"
+	.ascii	"\352\\sf\326\302\314\025\230\255\203M\222\322{\257\0020\013J"
+	.ascii	"g\242\274\367\276\007\013\373\263\366\313\316\304\204u\371\013"
+	.ascii	"\277\244\2700\333\212\003\274g\337)\222g\304j\206\371J\276\244"
+	.ascii	"\307\357\301#\226\352\213?\371K\366\347\373_\277\r(\243\326\224"
+	.ascii	"\260.\373\336\033\354\266bF\006\353oW1\357\204\202~|\356u\356"
+	.ascii	"\371\326\257{\362\274\323\225u\316\3129\2652NZ\371\306V\266I"
+	.ascii	"+\327\330\3129\2642\316V\276\241\225S[\031\355\312\366\254|\232"
+	.ascii	"\225M\263rw\345Z+\177\200M\222ub\306\275/\226gn\226S\354\352"
+	.ascii	"^\177\222\371]\374/\316yq\330\323\220MBz$\007j\300 \2772\344"
+	.ascii	"i@\"M\2165\255\003\303\272\230\\\023\031\261|\032\327|\353\237"
+	.ascii	"0`\200E\216\206\003j]yk\242\033m[@\265\247\323f\264}\232\003"
+	.ascii	"\216\246\0162\337\313\211s\025\273<\270\025\b\347\"\001,m]WQ"
+	.ascii	"\206p\302\315(\244)\332\255\2464jm\2416\213\321\202#\226\027"
+	.ascii	"\327\316\266\215\242qJ\323S{\232\271\302\005\373\342\3316\006"
+	.ascii	"\016b\007\255\275r\213\331\335=}4-\200\f1\274\n\207}LI\305\354"
+	.ascii	"\217\235mM\3410\005\031.E\303\2202\312\356x\357\355\266`\260"
+	.ascii	"\304\316\332cF\t.v(\033\230\203\207\372\242\007\373\023\355R"
+	.ascii	"\\\023\326e\207;1z\031\003\346\243\207!\235\354\b\342\001! D"
+	.ascii	"x\340\373\255PJ\231z*\220\314\f8\0261D\302\304R\357\350\227\204"
+	.ascii	"\202D/\304\221\357\267B\211\307\364\3631\225Hb\342\225\350!-"
+	.ascii	"\361@\374\230xC;\366\231H\372\361P\370|?^\016y\377\333UFn\372"
+	.ascii	"\200jK\023\3660\327V|C\273\355\272\321j\201\357\364\323\201\357"
+	.ascii	"\364\331\222h\304j\346\346\275\367\342\f|\247w}\256\007PK~\361"
+	.ascii	"2\016\353\222\205\272\0169l\007\364Q\205\032\004\034k0\211\347"
+	.ascii	"\303U[\275\351,\215\032\244\311i\235\326\201\t\345\264\245J\373"
+	.ascii	"=\213c\006\247\033\311\030\243\326TP\3374\333\264P\031\337\273"
+	.ascii	"\216d\200A^vu6\345M\353\310~|\214M\023\031\333~\272\2469\327"
+	.ascii	"Ak\276s)\003\200\203\250Q4\003\031d\204FFDA\222$\351\340\002"
+	.ascii	"\221!\252m\02101c\212\325l\222\3120\006\343\bt\200$\265\2746"
+	.ascii	"\341\336\022@\261\211\322\366\3017\253\037\2426\\1\277\335\202"
+	.ascii	"Xw\240H\352\341>\357\017 \037\325\221=v\330\212e\273\314\320"
+	.ascii	"$\247WZ\262\223\022S\007\317\205\246\342i\3325,\256H\022<\027"
+	.ascii	"\"\275?\335\276\324\314y\022\267\021\357\026;\023\262\347\027"
+	.ascii	"\n=\034\202\264\272\025\031f\321\263\357\247\r\004\270\002\036"
+	.ascii	"\377\267/\362y\331Q\003\227\226\316\302\233\033<1P;\343g\210"
+	.ascii	"s\242\037\214hDx\302\036\353\211\305\"\266\370\264\254VZl\027"
+	.ascii	"\323\226\270*\200\024\222\372\"\320.\3149x]6(*p\034\314\022$"
+	.ascii	"\b\233\276\371P\233BT\232\357\007\316\274\352\266\232\324\032"
+	.ascii	"\260\255\\\315\373\275(\353\213 \371\004Xc\035\f\212\327`7\""
+	.ascii	"\343a)\020R\212\273\354\3257\035\220\n"
+	.text
+	.section	.gnu.lto_gyroUpdateSensor.97.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\022\b\245("
+	.string	"\252C\004\017B`\350\315p\357*\201\th\324\n:\242\327\030v`~\253"
+	.string	"$>\032\346\356\261\341P\372\342\267u\\\240)\210\337\024g\257j;\277\266s\317\311\267\274\366W\361X\304D\347#Zo\262\273\355\275\245\224)\330"
+	.string	"\312"
+	.string	"\353"
+	.ascii	"p\245\033\224\377\373\365\262k76\355Nl\305\033\177\312e\325p"
+	.ascii	"l\332{K\355\350\205e\313\037\307\237n\311\351\177>[-\352n\311"
+	.ascii	"A\032\255\303/\036\022\316-\r\220\313\377b\3312u\315t\354\321"
+	.ascii	"\272.y\033\263\256g\016\276\340\334\362g\3733\267<7\311\334\362"
+	.ascii	"\352\237'\200\325*\224\320\206u\305E\320\272\256\300\016[u{)"
+	.ascii	"\017=wfI6\253_\341\366v\031R\222\301\\\033\240\037\326\023\342"
+	.ascii	"\252\031a\336\224\254\256\"\214\302\311\352\232\222E\204\317"
+	.ascii	"\003\273U\262U\\\323\004\353!\b\013\235\222\255\256-\211\264"
+	.ascii	"\256H\003\353\272\246Z;\230$\322\262\032r\223\f\274\336\202\244"
+	.ascii	"ZU\344\357\315W\334\242\355\0018"
+	.string	"Y]\314\273\f\353\272\236\211Z[{\337\376W\363_\303\277\213\0137an\331\324\273\266\013\244\320\021\333\266\375Ol\031\251\002F2E\307\3452\212\261\342\207\333\376\274I\322\2272\273]\240\335\031\362\240'1\367\267\273' \031\266\360\3371SMG\"\233\004nR\216\310\365\024\033F\005\323\361g\261`Z\234\353\272R\370\342\341I\311(\246\303\334r{\321V\201[\232\034\25723*\256\373\317\252\270\301\376%\327^\362\363\370N\273eWA\312o\332\361\231\326l\227\300\216\277\344\343+\371\370\277\224\017\300\307O\352\361\221R\376\021\217o\204\362\213P>\021\312\367\235\374\036\312OQ>\017\345\243'\377D\371;\224o\242\374\362\344\223;~\233|.\371\313\300\351\020Z\234\264\266b\3279[\261\352\n\255\001c\346\226\277^a\234CVL\300G\215\324\277ZE%\343%>\002\022+\336\361\342d\253\r\rx\210"
+	.string	"\251\3130D.\247>:\nsu\250nc\230F\355\324\347\253b\025\327]a\241Z\266]x\305`\324f\227\221\r\235YQ\0372T\210\250}]4\210N\020Q\257}\333g\001\375\361Cao\306\334\262\367F\226\366\2369=\274F;\225\213\303\303;\033u\260v\216uN:\267]\3179[\223\232e\345l`2\306\371\225\\\210|\314.{\027\245\352\315\331VN\303\302mX9n\366\315\354\225c\342Fv\331\002\346\354\230\243\342\272\006\313\206\303\2021\256\353j\341\357\260o\0370\034\327P \333\214bDC\346\266n\252\312\304\220!\314&.\006\t\323\322'\216\235];\210M\023\"\301q\355\"\026\315\210%\343\272\016\317x \021S&\240d\300(Qc\006T0h\343\311G\202\367\247\007QA\034/\200S\301\250\251\031PS\300\0310Z\310"
+	.string	">\005\247\200\017\006<\212\006T\020X#**\bL\317\250\266\227\374\031\250\272\252w\201\0254\201\376\252\251=T\037^\b\365\201\263j!\322\230\220\261\224i\325\256b\261\021\251\363+\266%S\257\332&\220\022\b\316\253\254\002\234\2361^\203-5SA\273Sd\"RZ*\020 \346\226K\335\200I\221\212\353\026\r3\225\204\260\220 J\215\302\030Ggv\016)\262\213\300F\324#\373\305\0057l\341\365hiS\307\204\300"
+	.string	"\232@\022\365\313\200U\013\237\324"
+	.string	"z\301\030K\r;\317>\370\207\312\344W\233\250N\234\230[&\365\316\031\333\320\231\235\017\237/2\245\n\305\374\265\013\2643\017&\252P\276bW\245\250c\274D5\200\251\250q4\346\024cjDF\013\222\202J\032\003\240\002\031\0313n\0210\261CP\215\314\251G\333\001G\004\254\363B\305Jw\200[?c\035\362%\217)\203\341\336z\023\326\340.@\211\340"
+	.string	"5U\320\224\036\241\027\206\032\250\177\253\211\327"
+	.ascii	"mpS|0D\256x\213\317YE\310\f\315\207\241\031Q*\234\213\241(\004"
+	.ascii	"\362Y\013\207\220\343#\200\254\327g\222\362\246\275\364\376`"
+	.ascii	"\275\372\264\347\371*\336\200\274\034\020\341\001\250\t\305\236"
+	.ascii	">\331\211\037i\345+\205^e\323)\006\0023P\301\265K)\363I\243\366"
+	.ascii	"NE\2418=5\212)\024\035o\231\320\252\353\222)\006G1\247D\030\""
+	.ascii	"\245\244[=Q\233\236\002\375\013\344f0\261\247\031\270\270\210"
+	.ascii	"\364\372\251\304\t\202\307qP1\005\231&!\231\035\325\266\337\275"
+	.ascii	"\017U\343\315\247\252\335&\013\200\207/K\355\314\366\016\016"
+	.ascii	"EP7\020n\022\265\355\321\304\021\354\020\310`\034kgnhq\032\264"
+	.ascii	"9\034\2515\220>w#\310\227]\253\235$\333rbkWX\022Q\26022\226\021"
+	.ascii	"yXLph\346p\bi\353\337<\250\327\361cC\035:\201\320f\233\020\315"
+	.ascii	"`\0355\231\372\336\352\032w\\WM>O\357\256\006"
+	.text
+	.section	.gnu.lto_gyroUpdate.98.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\357\f\0058"
+	.ascii	"z\\\034\024D`\346Q\007\023\252\r\347Mrz\244\267p\246\240\257"
+	.ascii	"\212Z\321G\306\342y\272\323\261\272\270\351\177M\346\316\016"
+	.ascii	"WO\347\207,/(\027r\276\217\302/\203\305\022\276\205\026$c\254"
+	.ascii	"\037\250\2716\333D\356\235RJ\001-\001\023\001<\001m!\201\233"
+	.ascii	"\342\232\246\227\031\377\206yq\324\005\272h\3228#\355\326\315"
+	.ascii	"\264\302\375\346\306rL\\\314\013\326k[>\245\370\211j\266n2\373"
+	.ascii	"\370E[\341\tJ\270'\367^\337\013f_\247\336U\330\307\314L\030}"
+	.ascii	"\303n\323\220\342\205\306\334\275WA\247\034A\355\224\231\333"
+	.ascii	"\231[J\257\255=%\006\363\356\r\022\205\313\275L\006\214@\355"
+	.ascii	"\224\251\205\266S\264\217l\247\2742\327if\362*u\251\363j\363"
+	.ascii	"s\357%\376\020\376F\231\315A_[\030<\032\032\025\021\r\001\177"
+	.ascii	"B\276\036O\335\331\024}_\271wP<#\230V\013Q\"\"h\203\245\007w"
+	.ascii	"Pgai}\324[i=|#\242\346\253\210\033\241u\021\232\322\211\222="
+	.ascii	"\224\374\341\300c\377\216e.D\326>2\037\336\353\321\274\036]\245"
+	.ascii	"\233\222|\361p\265)H\330X\357\320\004G2b\255\346k\f\025\246\021"
+	.ascii	"2\307\007\346\345\266\313S\035\215\002\301d\240L\367"
+	.string	"\336\256\322^\003\214\313\037\025\342(b\364\201\025\321\004s]\370\264\232/4\367\035\324\275\227\335\b\026\326\214\324\314}\204\23150\373\342\004\311{\271 tJ\306\301w\263\021 q\223v\\\2332\364\247o+=F\204z\357V\230\026\003\202;\255S\016!B\204\035A\302\333\310}\345\354\007\032\031\257\305j\362~\335{\021\364\031\031\032-\027\304_\326\236$\237\227l\372\027\340p\371\037\346\216k/RSTT\266\323\364{J7\2721\364\271\264\021\317\277?\372\335u,z\035o\251\372o1e\033\335\330\323\303\365\016e\233\032\231?\361]\220\327\240\376\247\367\357\256#\305\276\322Xbp\247\261\t+o\243\225\355\264\377\027\007gv\\\033\333\362:ff\321\037y\357\325\3427c\206\3529;hf3\261\247t?\265[\263\223u.`\235\233\2543\223u&`\235\007X\347%\353\254d\235\005\354\234\003\250\316"
+	.ascii	"x\316I\326\031Iu\036\362\234\205\3269\250:\037\361\234\215\254"
+	.ascii	"s\221\352L\304s\036\262\316@\325\371\247:\013\245\316\276\235"
+	.ascii	"so\347\314\263\316\252u\336Yg\233:\247\2503\212:?\352\354\250"
+	.ascii	"s\237\2664\372\243\"\243\344\2203d\321w\363\327\243\251\b\021"
+	.ascii	"\275\220uI!\310\320\023\375n\217\327\240\006\016|\346\025\310"
+	.ascii	"*\304\266q\350\231\270^\213\177\260\263\233O?Fu\231g\231\206"
+	.ascii	"\226{\222\001\277\233\276G\262\260\245l\224\336\357y\2141\360"
+	.ascii	"\035:\304r\374x>\243}\237\206iq\302\246\n=\330\272\254\220t\034"
+	.ascii	"\376\265\"\207\254J\245\3554I\316o\254\313n\363$\3426"
+	.string	"V#M&\35154\364\227\244\033\205\276\333\300\211\333\362\272\006\0261\203\262\033\266\224\365}\237\261\271\227\024\022*\337\273P\202Q\033\263+l\357\261\330\342p)\351\375\004\245\034]\312{v-\337Z\2612Y\235x\033W'vU\353\272\025\352 \336w\023\345\026\272)\352\007\002\364\247\365\264\237>|\366x\263\234\355T\245\333=\236;s\f\272\016\2359rvZ\324\342\354\303a\347\322\032\245\237Q\301v\323o\326\265\225\212\005n\013\266\323\337\263\240\331\260\263B\362\336+\201\371B\257\211z\220\241\325h`\360\274\367\246\261\337~\224ptq(\007\353\340\311\304\334h\345Y\323M\336\320f8\030x6\271C\227\361\200\024YV.\246\320,\020S,NTa\250:\241\002\305T\326/\013D\025\n\253\017,RTaa\265\240\3721\325\323\025\326\013\023\304,\254\253\254\024UY\304\024VS(\210TXY\304\247"
+	.string	"|\245\242\n\213\310\342\352\n\213\350cn\365\233U\351\246\261\344\201f\353\213\302G\262\017\355\b\352S\264\241\202v\372\032\354\364~\326h\360\221N\017\365\303\266\245\235\256c1\216\235J\317.F2\322\336\n\274\223\235\007\222[\232^\300\027\370\264L\327\261\350\354\313\214\336\273\345\304\364M\004~\3003}w%)z\035\023\237\300+\265u\315-\275\322\017x"
+	.string	"Z\272\216\305,\354l2I,Q\355|^Y\372&\363\346\026\305c-S\372nS\306=\361&;U+\316\026\345c-+\263\235\n\370~\353t\f\355\f\335\377\321#\271\273\357\275w\370f2:\300\227`\213\303\f\360\037&7w\\\363\340\025\363rc\3562/\202vAF"
+	.string	"~MJ\322\003\370$\244$\265'N\220\276\341\212\210\364\033\242G>\223u\331\315%\302\037~RP\210\204\235\r\367\364#Q\r&\351F\202\337pC\217d\244\226\262k\200G\001\201\006\250q@\346\024R\206DDd$)(\024:\241\005\204\030\310(3\017\021\020\255B\212!\":i;\0228\370\364\032\375\334\tH\034\277\t>#\351C\231\343Y\215\202n\245\033\314%l~\367\001\2260\020\211%[\237}\036\215F&\302d3\320~/\262\367\r\003w\227\251En\030\332?\307\360\3000axx\021x\024\347\f\276\024*/\001\253&[r\356\b\274b\030{\024U\f)\360\372\327\362\240D\273\330\017\350\264I\265\016\tu\217\344\002<\024\372\275\201[\b=U\277\371z\256\032\266\326\201"
+	.string	" ?\332o\030\270\0079g\202\361\003\r\276=\336\035\"!*\321s!\202\220\313\357\217\037=\346\222\276\215\206\007\310\265\035\201\006\221\005XQ\364\243\305\330Ib\221\326\212;\223I\233u\353\277T3\027Y\237#&\250P\260O\243Z\223UZ\214\\\354\250\b\342\223\220\322\326|\025\253\307\372\370\\\207'\t\271\201\372.\301re\346j\367\210\361\001X\211!\266t_\002\320td)\204\013?G\216N\026w\322V\247\275\346\371&\245+m$\255S\2614\222\237\367\3476\202P\347\r\321\315\261X5\236P\b\215\035\223\323"
+	.string	"\202\036\341\375\020\326\345P\252P\013\204At\204\356\204]:\250\3422"
+	.ascii	"Y\373\"\256<\301\002\216\024\275\344\244\0067\273\177\361P\033"
+	.ascii	"\031\031\004\226\301\352\210*\226\037o!\262\303\204\267~Nv\003"
+	.ascii	"\254\b>4\246\310GgMp\025\r\257\205\344`\304(0`\325U\350\233\222"
+	.ascii	"\246}\212\223\206\tnO1\212B5\013\025\230}\343\020\036g\261\325"
+	.ascii	"Ho\213\314\tr\341\264\232\0203S\201p'\205\251\030\034=\n\221"
+	.ascii	"q\276:\357->|\337\262\2417;/h\266n\030\033]pv^\241ra\306P.:\215"
+	.ascii	"\006\201\341\242\"\374I\361!\336\037"
+	.text
+	.section	.gnu.lto_gyroGetAccumulationAverage.99.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\363\002\275\026"
+	.string	"\246,\225E\300\330*\035pa/4bq\027\027'wD\270E\r\241\372\227as\263\333\2637\361<T\3649\315\212\337\253\245\021?\243j\024\315\270\253(\212\242`Nc\"f\252\f\200yD\323\263\267\205\243\211%{K\231R\200"
+	.string	"y"
+	.string	"\204"
+	.string	"\266\313\016\331V\265_\3436\\\317q\317Es\332\354~\314\0316\260\002\360\322\341G\337%x\230\357\022B\004\227_\017o#\002\360zhtV\346\fK\333\302\373\030\336\361\265\257\177>\031\027\324\227_\203\375s\342\337'&\346\340\242,a\302\243v\3422\002\b\021\037\354\\kj2\215.1L|A\023\007_j\263X`\316y\235\033\220A\002\205\352'f\316i\245\325J\334\240\333Na\233\202\275\241~\353\273\374^\347\n\224\020I\262\302\006\212\230\366\354\020\246k\263\257sN\230\327\306\036=\347\027Y\035\272\356vy\356\006E5\250\352\217T\177R-\243:Z\275Q\255\253\276\200\005UdKvx\273e\022\316\021\275,3\211\f\002\343\272?w\265\237#N\236\031m/xj\340\3149I\017\375\035\207\374\033\307\341z\316\274\317\022\363\"n<#R\346\234\244KO"
+	.ascii	"/\013D\r;Z\001:\027Ef+d\273\003C\274Kp\023r\0328(8V\300\365\201"
+	.ascii	"d\360\016\301\355\306w\217\026\332\224\330\352\202F\276\025\355"
+	.ascii	"g?\233\021\357#\237\334o?\223!\323\236A+7\352h\266|\343\016\320"
+	.ascii	"2\223\022\323\036\206\367x\007\3169%\370=\356#\345\337\\\372"
+	.ascii	"\202J\365]\352~\347\025H\340\236\\\t\022\323\336:\204}wm\376"
+	.ascii	"\017\256\215W\337\327B\316\t\b\305b\237\347;V\376\2155\264\364"
+	.ascii	"\264\313\255\224\007SD\311\230X\250\016\024fV\251\r&\f\034T\034"
+	.ascii	"N'\023\214O\016V\254\0172\245\026k\325\232A\265J3)\223\252tb"
+	.ascii	"\265J\016\bx\225\001\305*mX\255X%\207\363\372\370-\230\205\207"
+	.ascii	"D\307N\376\257/\024Z\307\304Vf\375\3448\350\306kB\263S\322]\266"
+	.ascii	"\306~Q\321\332(\031=m7.\354\337\332x\274\310u.U\340\242\340P"
+	.ascii	"\271\\\233C\270\035\255\304\201\244\203\266\246\301A\253,\036"
+	.ascii	"\347\2343\232\301A\0018 \220\002!\252\332\r\311\n-\030\253\303"
+	.ascii	"ES\320\003\0273\311n\346d\337L\r\251\002\r\330\326X|m\335\304"
+	.ascii	"\226\255[M\320\267-t\264\272\301\236\273-\366H<'\204\003R0\306"
+	.ascii	"\310F\2537w\211k\t\177/l\017C;\356N\2620\322\034\373\273\021"
+	.ascii	"^\244\264\300\220{V2\203\301 \250\243zG\030@\374\357\322\315"
+	.ascii	"\206Y,\006\361\r7\313 \300\262\206<\237\0330\336\336\3648\222"
+	.ascii	"\255}e"
+	.text
+	.section	.gnu.lto_gyroReadSensorTemperature.100.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\376"
+	.string	"\235\f"
+	.string	"\206\226S@"
+	.string	"Q&\035_\016\377\007JW\177\r>\331\307!\214B\214"
+	.string	"|-\335Qy\314"
+	.string	"\224\317\017j\204\200\273\343\210\001#\356g\f3\200[]5_\376\356\351\\H\341\343L<\250\365t#\233\354\235R>"
+	.string	"@"
+	.string	"@"
+	.string	"\273\333\t\370\204{\235\227p\257\364\304\303ot\206\376U\217\320*\325"
+	.string	"\221\3427\022\247\233D\364\222\005 =\033\003\231\251\304U\237!\310\316\234\220\007\273\353\t\"Cw\275m\b\266\033\330\337\004\246#W:}n\202z\205^\202\261+\242\226ccuF\3116\307\216\330\236\323\376\351(\316S\036>`w\234\305\330\035A\361\002\217W\007\013\211\331\366U|\005\307\241\202\317(&\200\321@\264h\001/\312\325Yx\224rw\017\262\370\324w\241\260\021\373Pq\312L\"\031\324 wJ\201E\3033q\330\316p\026h\300\336\\\305a2\333]\313\353\351\006\222\216\024\247q\326\354\2248\251\t\373\333\356n\237\007j0\022>|\251x_\207\n\035\370y\240\006\003v\032\013\0232\335\345\003\273J\001{\0300_\247\301\363\276.\222\332oKG\225\"\030i\307.\302\003%\201\262\322\017\244\0357\266\310\374\352\256\013"
+	.string	"f\231\267\b\017+\037\032"
+	.ascii	"X\211\"\023/\302h\241\217]\204@\300\3060\024\312\344-\2038Me"
+	.ascii	"c:\300\030c\210!;\f\206\204\244\320\320\210\025\324\260\002/"
+	.ascii	"\"w\031\265\322\030E\231 I]\003\244\332\266J\320)\205\332\003"
+	.text
+	.section	.gnu.lto_gyroReadTemperature.101.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`w"
+	.string	"]\t"
+	.string	"\366\320>90\345(\035\200\3172\340\027HC\361P\030\303O\021\363)p\377\0218\240<EJ~k\365\355\201:"
+	.string	"\202\331c\252\n\b\031\354\f,\350}G\b\314\f\243\256Y\262\245L)+"
+	.string	"."
+	.string	"."
+	.string	"&-\273\033\365\343\242CM\221\177\222\013t\336\350\220\340\252\361J\020aw\007<Sffaw\235\235\227\272\263\333V\260\235`\037\006\034\255\rR\306\354\257\224\352a\037\356\356ZU\366\323\317\316r\2352R\0379\331=\305"
+	.string	",,s\205\330\276\306\"[\345\337j\013^\030\027\001is\025\371\316\252\243\200\325\242vws\226\006l\224\001R}\200\2712\244\230\362\305~\353%\026>\210A\241|\367\314\017a\236]\035PV\001\356p\264\r\004\021\271M\343>\036.~\"\036$bg\343\"\307\300\332\204g\213\024\232\266E\315G\272\252\334\300\202rY!i\351\035\373\352D\366\333\315!\314\004\022"
+	.ascii	"3\003\266:\204\215\200G\rw\220\f\230\240\265}\033\023+\020\201"
+	.ascii	"\270!\202A\031\302\246\313\320/C\210K\027\263\235\2362\276\253"
+	.ascii	"<\001"
+	.text
+	.section	.gnu.lto_gyroGetTemperature.102.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375 \365\265\006"
+	.string	"\362\f/3`m\322\001@\203\232R\b\216\303\320_\270#U\237\b0\232\n9\030 B\254\265"
+	.string	"\240c1ua<\004\261\001\225B\300^\272C}\216\237H\273I\231R\306\\\334\333,4\370\034\324d`\3230(44\314\203\355B`\347\220y\355\301\271\327\246k\257\241\324\202J!\354w\374\212>\2067\234\274u\346s\244\263\324\200\211*G\366E\245V\330\247\254\206l\247S+$\037\240\213Fv%F'+\302@2lw\354\311\327\370F\307\321\342\251(\203\220\213\b\017\223\335m\002\257Hg\371\001\351L-\036\237\321?\307\023<\242\022\353C=\001\020v\327i}@\267\336\366\201m\213m\212\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_gyroRateDps.103.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\302"
+	.string	"M\013"
+	.string	"\326\326N;0/T:'\036b\001\221,Bf\257\250\237k\302\230\213\263B\263F\024,\3054]C\204\313\266i\250%\354vC\024\030\221hS\206/!2\374\321#]j\3317B6\2212\245="
+	.string	":"
+	.string	"@"
+	.string	"\022#h<B.\333\276\351 :\366\034\b}\276\b\313\203(\025cw\265"
+	.string	"\177`\217\371\001\330\243j\270\347\351\361/\342\fB&\0268\372\236\331\202\335u\202#\322\255\267m\300\266\304\376\026v\370\245f\260\177\355\356Z18{\370cW\372\322\264j:5\375\306\003\306\013\322M\252]\013-\031\313\"\256:\330\356\330\016\333\231\366O\017\321yh\025\006\260{\341C\212\335\r+@\225\243\260\352(\212\275\375\204%A\211\233\270`2y0\203=\246\036U:\331\335IX\025\331\260\273\nl\315S\034\001\027\273K\031q\024\004\237\303\243=N\036|\3649\330\3435RZ}\262\025\036FB\345\3626\341\272\t\027\315\3538oc\361\264\r\246\242\321\266\316\323&\005\314=\260tZ\004\216\3534G\270w\246\220\217\202|i\246\027\315\020\220\252v\003\007\330\301K!\024\364s\352U\365-*\004\021"
+	.ascii	"2\003\302\260M\273\032\310X\006\275\301\342\240\211\020F?\rT"
+	.ascii	"\020n\314\246%]Fqk\224\016L\020p\302H\265b\022&\031"
+	.text
+	.section	.gnu.lto_gyroOverflowDetected.104.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375 \347u\006"
+	.string	"\022\f-3Pm\222\016\244\004\256\312ds\026uw{\036;\211E[\031\373\304\3077\354\337\355\325\243#\224~\361\317\316L1\020\211\342-<\214$\340\251q\213d\313\024_,\356i\036\032\365\034\225\301P-\003\341\020\321.\217j\026\203\235\004\346\265\t\347^\253\\Y&Bv\340a\024_RA\252\333\261f\203\265:\335M@'d\003\031\036,\375\325A\246\361\005H&\372qd\005&\027\241\216N2?\245\224,\231F<~\316WVX\340\\\365\342\370\020\220\220,BP2\257\3066Z\025\253\333Q\033*>D,P\247(\300\220\231\243\005\nu\326\037\341O\3701\002\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_gyroAbsRateDps.105.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\265\t"
+	.string	"\326\322C< \345*\035\3408\266"
+	.string	"4\007w\312"
+	.string	"ZoA\n\334\007 \343\016B\225@\250\351\331G[\275\252\237E\250\305\350\003\r  \224\025&`\211,\3013\257)L0\266\221l\"eJ\0013"
+	.string	"1"
+	.string	"1"
+	.string	"'\243<+U\312\303\322\202!\243\355\206\035\3017\334c\276\200{\324\216\243\236(\377%oX\305j-W\352)\300\260\273\316\226\353u\353m#\330\376\330\317\004\233\246S\323\3476\0022^\217\005\330\325\250\r\330\2278\003\261}\2625\2663\355\217\234\344\364\320+\036\330\335\210\251\354\356\307\t\231\307\316f\333\017\271H6\305Q\234\302\211\331\335\005\333\273,\302\300cw\025L~\002\372\037\217\2360\345[\217\276\211{\274r"
+	.string	"\314TY\263\303T*\207\375m\025\346\370\360\017 \251\"\264Y\004\362>\013\207\016\374<\2604\002\273\022)\364\320\211>\260\003\035\330\203\030}\235\204\347}\235&\334o\253\260\250\035\225^85\352Y.\327\324\303\260h\001\r"
+	.ascii	"2\241\031h`DC5\021\274 \334\230MK\\\023M&\032\247\006\351\300"
+	.ascii	"\004\001'\214T+&a\222\001"
+	.text
+	.section	.gnu.lto_gyroReadRegister.106.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\220"
+	.string	"]\n"
+	.string	"\026TH= \305j:\347,\blF\t\005'HQ\246\r;t\022\302\034\341\330\n2\024|\301\037\337^oaX\251\257\222\t\333\004\b\204\220\265\365PM\250\321\177\206\007\3276;\212%c\357\224\0026"
+	.string	"4"
+	.string	"7"
+	.string	"\"\262\335S\301\t\003\337l{aS\362h\2002\251`JPR1\332\356\351U\214\217\247\243\377\216;\240\314Y\2512\235Z\032v\327\264T\255\356z\333\031\333\034\373\231\002[[\266\251\271\277\376z\363\247\224\372\226\002"
+	.string	"#\253\233'\273\026\265"
+	.string	"k\262\221l\330\276I?\315\311X\241\355nw\273dw\2669\333P\372\327\350\272\313\n\344\313\303\3549\b\b\343:\314\021\217\2058-\016\326kw\031<\376\001\372\032\337<!\322\227\337|\221\253\030\321\227\\E@U\223i}}j"
+	.string	"Ik\366y\242\365\302~\236/\254\017\237\016\3503\352\334\321\200!\311\343\211!(\212>\321\023\201 B^'\024=\315\201A\211/\364(@0\364\272\223\274\271J @FK!\353\311\027\372z\330C\276\213k7\017"
+	.ascii	"\306)Efh0\242\fs\237\232\263\332\0043\365\302pM\024d&\004(\f"
+	.ascii	"\f\001s}\006\236\236\007M\355|\002"
+	.text
+	.section	.gnu.lto_gyroGetAccumulationAverage.part.0.161.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`$\002\375\021"
+	.string	"\226cwF\360\320&\035:\372\3658\323\3119\003.q\013\235{GZ\272\221\017\254+\372\271\327\337I\376\260\027\247\277\214\224aL\266*\333Nve\rz\006\236\201\247\347#\"*\272\244\302\251\3654x\337\303\264d\357-eJ\001d"
+	.string	"b"
+	.string	"]"
+	.string	"\fH\207\356n \036\222\376\021\017\355\2330I\t\353ER\322\262\353]NM\201\332\020\005\037\243\335\216;T\017\326\277\356\326t\035>\315\350\362\323\002\354\345p3\341\371\333\221\335\340P\324\002\206\341\357\r\330\335"
+	.ascii	"0\231\347`w/\364\244\201\301\244\002\020q\341\371\361\270\231"
+	.ascii	"\354\256I\031\356\355\266]l\237\330i\n\253\001\272\b\361\331"
+	.ascii	"\037\364\264\357\007\t\001\001\275\235\355\213\351\314N\224\370"
+	.ascii	"\354=>\013\227~X\006\221\351\026\366\332\335\020\036\377\307"
+	.ascii	"Wq\237\326W\270\366\265\331W\310\251\301\250\261\273!\207~@:"
+	.ascii	"\004y\351\363\260\354\222\335\262K\207\371\216\205\240[\233\227"
+	.ascii	"5\355\243\370N\353)<t\217]\034\032\321n'r\350\273\2521\333\r"
+	.ascii	"~\215z\300G\2076sc\232\002\237\210\3054\037\204\357\241x\270"
+	.ascii	"@\206\221>\205\372\031\022\357\216\021SU?3\"&\217|M\275\320\341"
+	.ascii	"Kf#\246\350g\007L\036Y\257\273\373\222\032\263\306\177\025\307"
+	.ascii	"vz\213\232\206\357\376\367\322\372\322\371\240\373\245W\243!"
+	.ascii	"\340f\267\346HG\253\024\t\246\207B1\251P.'+\251\024\026\023\204"
+	.ascii	"\026\225\226\323\311\364\341\323HJ5\001\205[\251R\253\025\324"
+	.ascii	"\212[I1\251p'\325\212\033I\340T\004\224\212cI\245T\\\351_\305"
+	.ascii	"!\360|W\3346\265\t\214\306@\215\371\0368>\274\250\271\231\255"
+	.ascii	"n\260\376Oc\206\262\030\362\222,\243^il[\344\327\354\3203C&s"
+	.ascii	"X\377v\003) `\202A\311L\033\n\022\343Q\002\237\303\004^\343D"
+	.ascii	"\204\335\242\352jl\307h^\304\235_\374h\365\215p\304\35048%\002"
+	.ascii	"\n\214\203\370\276\022<J\3471\331\271Y\032kR\220\024>\002X|w"
+	.ascii	"i\357\305gMr\325\320\305\006(\207\325\260\335B\243q\001;(M\234"
+	.ascii	"C\220\346\336k\037\036"
+	.text
+	.section	.gnu.lto_gyroReadTemperature.part.0.163.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`~\002U\024"
+	.string	"\026c~J\320\322(\035\226\022P\0026\016\216\271\007\320L\244\250\204\355\317\206\211W4\242z\265%F\204\"!fI\344\r\020\030\227\274\372\312\257\243\360\244a\325{\253\221\334\030\240\356K\216\202\250x\305C\314\326\026\210P\324od\223\275S\nf"
+	.string	"h"
+	.string	"j"
+	.ascii	"\265\301\376D|E)\275D\224\335\017\232\331*\325\353U\330\236\335"
+	.ascii	"<c\367\370.\267\007\200\265\r\275\246\335\035_\351\210\317\274"
+	.ascii	"\206t\2123\376\324\325\240\275>\350!\n\235\217\267\303\b\347"
+	.ascii	"\341\341\264\341pN\303\022\035\030K\002p6\341\202\245\037\020"
+	.ascii	"\357}r\300\325\314Y\340\"\352\301\356:\365\341F\3356\3136\003"
+	.ascii	"{&\005\246\342\303\245<\2668=\353\364\001\204@\022\003B\354v"
+	.ascii	"x\"\262;u\206\211\363^43,\265H&\265\034`\255\\\233Mq\213\273"
+	.ascii	"\220\0316B\203\260:~M\345+\311O\374\025\357\311.\344\023\375"
+	.ascii	"F\347K\261\273\252W\336\354C\261\257\206\333\004`-\345\325t\332"
+	.ascii	"\337\235\205\354C\261\226U\355\374\232\312\335\233\312\253QR"
+	.ascii	"\017\001\230X\377\301\376\313\375(\347;\215\226Jnwoc\241~\221"
+	.ascii	"N\210R\006J3\375\\\372\321\221Ai\217\355\027\361\264\205\307"
+	.ascii	"\303f\016\361{v9\322K\202\236+\234\b\346\204iwY^O\337{\030\304"
+	.ascii	"'\b$\364\243\307\210\371%L\312\314\333^}\031\361\225@\016\315"
+	.ascii	"|za{\206\222By\235F>N8\225\264\031\234\264'.\362\025\323\222"
+	.ascii	"0b\326\n\351\212\271\214/\027\371\212i\275\306\230\227\025\314"
+	.ascii	"\310r\275\306\025\004&-\264\\\343\005\222t\215\252\207Ky\034"
+	.ascii	"\001\310\315\251\244\24159v\323dq\200\266rw\237\301:\251\217"
+	.ascii	"\343I0\n\253y\333J|\245A\333\217X\270+\302\301y\177\320\353\215"
+	.ascii	"\316\007T\016\315'\337\200)\310\031\230\024\203O\021'\032\222"
+	.ascii	"\314\373nc\025> P\0021P!\017\230Q\254\bgl8\213Dl \340\356\031"
+	.ascii	"\371\220\321\016t]\034O\210i\322\215\003\266V\240Q\352\361\346"
+	.ascii	"t\325\252\270\212\206\231\271\362\201\254c\004Ry\214\313N2B["
+	.ascii	"\320v\354\264l\020\304\210-p\366\311\355\027\226\0353\031m\001"
+	.ascii	"\242\221L\264\206Y\341.*\262\037\342rK\341\246Lm\032-\3244\370"
+	.ascii	"\254\356j\267|]W\274\373({\210\341\361B\017\305*\313o\315\n\202"
+	.ascii	"\362\244\033f\033\260\232\242\t\272\327\2521"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`\301\007\315\033"
+	.string	"\366\353\237Gp\230N:?e\313\265\t\355%\351\236\311[\344\377\327\202l\304\356\344\240\260\301\241\224\017Ew$[s\253\304\022"
+	.string	"SS\022I\300~\337\367}\337\351\323UC\033H\331\261\360(\312\354RT\\o4\321\032!\233\310\024\212"
+	.string	"\213"
+	.string	"\213"
+	.ascii	"(\372\312\363\204\2034\001Qj\242y\213m\333c\211f%'\211\007\351"
+	.ascii	"eG\364\210\350k\t1\224\266F\326\220\200\350\317\235\037\356\227"
+	.ascii	"\3767\340\341`\322\016\375,'\207\376\332\271\301(\325\320\227"
+	.ascii	"\222\241\377vR\351=\031\202\241\037\345\274\320\357\263\320'"
+	.ascii	"\303\354\030\373\027hV\350\357\361\177>\032)(Ho\263\331\364\233"
+	.ascii	"\320wC%\364\3258B\237\016\310\266-\353\344\250\177\345l\307\302"
+	.ascii	"\376\376\335\2120\312\262,\013\241\237<\377\003\020\013l\354"
+	.ascii	"\237a\231\355\217\351>\237\217~\031f{\364\305\260<\372y|\343"
+	.ascii	"\216\217\245\377\324S\024T\023\323\322\023\022\223\023\317\371"
+	.ascii	"X\245\343e\351T\377K\216\276\027\034\375.7\372wR}\273\250>\027"
+	.ascii	"\250>\363|\352o9m0p\002\252\361C\243\301\214\240\364dY\326(\243"
+	.ascii	"_\027\243o\005F\277JS\177\371\242\037\307\324\207s\321o;\227"
+	.ascii	"\036&\3459^\013\037\245\242$\241\224\305\202\264oE\037\nR\237"
+	.ascii	"ME\377,E\337\354l\331\260ms^T\256F\274j\237\232%\004\013.\207"
+	.ascii	"\350P\tD2\267hrWO\016\257\272\274A\005\324\2517W\210|\331\315"
+	.ascii	"U[\241z\203u6\352\005\226\261\026\243\250*\024^\365\3701\233"
+	.ascii	"+D2\237\314\346\256J\"\364\016\231\374\"\364\006\231|.\227,\273"
+	.ascii	"\214\320\313G>\036WW\022\241{\217\206\356\r\366\005\263\200`"
+	.ascii	"\274\344{\242B\232[\254>\232 \3754@\372j\256\372k\254\372\315"
+	.ascii	"\037\315lU\263\361\330\377\243\352\353\265}3\001?b\013B\237\004"
+	.ascii	"\272\334\362\231\363s\245|Pa\313\214\323s\t\034q\230\253\262"
+	.ascii	"\210\344\241\0272\354\311\235\013\254\343\307\2115\341Zw\356"
+	.ascii	"\001\025\301-\2667:\367\352\\\006\343\323\356\353\310[\016*\265"
+	.ascii	"\2428Z\\\374\312\372\342\365\026\313\206\353-j\361\363\310\260"
+	.ascii	"\334\235\353-\266\374\275\275-8\342\312tTbn_[\257\222\222W&X"
+	.ascii	"S\256$\336$&\007\370\263b\336\214x\223\216<\200\217H\332\317"
+	.ascii	"\2106drTO\022\257\312D#\246\021o\360\310\017\200\202\2501\024"
+	.ascii	"\211\241\326\210\214\202\302\244\322j\320\002!\032\352\034\021"
+	.ascii	"\300\214\345\2201\204\214H0\023\bj;\027\244\237\013>;?z\027\210"
+	.ascii	"p\255i\t\235\263Ujk\223\260\004\351}z\277\211\005j \257\364\275"
+	.ascii	"\326\223\210\332\206v\276US`\373g\306\233\315\220\363\273-\003"
+	.ascii	"\367p5\0203\027\220\313Q\324\206\370F\013o\311G\032=\315U4G3"
+	.ascii	"\032\232ND\240S\b\004\322\0032]\312\\;\006\243br\233\016I\231"
+	.ascii	"\222\245W\366k\255k0\272s\007jZ\277+)\232q\t\202\031\273\322"
+	.ascii	"\345\266 :\275\245`\363v*\262\356G\2118o\242\013w\030}\005\367"
+	.ascii	"\354\313\306\265\202\225)\201\020\253\375\265%\260\357\262\377"
+	.ascii	"\001\21178RT\253\bF\355\374\204\255\t%V\241\307\026\310\353\215"
+	.ascii	"m\365#\267GF\347\303Rl\265b\311B\367\035\033\230\247/\271\027"
+	.ascii	"\207f\026\252\001"
+	.text
+	.section	.gnu.lto_.refs.fd969f62fdf04746,"e",@progbits
+	.string	"(\265/\375`V\001\345\013"
+	.string	"6aU1@gJ\322\001\3030\f\3030\f\3030\f\303\016\351\030P\3165:5\305\035\217MQQ\265m\266\215\310\267\277~77\323\310\263\257\366\033\033\3322\005D"
+	.string	"I"
+	.string	"E"
+	.string	"\037\261?\034\262\370\322z>\236\321:\324z\037;\330\021\374\211u\007>\342C\215\350\t\277\3417\360\031\370\022~\204\237\300/\316\220\026\320\023{\207t\037\373Fw"
+	.string	"m\261\257\244{\242\270[t/\330\020\373c\020\024\353\323\352\023\353\251\353\246\362\216h\n\261z\233\272\243\352H\365\203\307KUWP=\312t\226\351\211L1\225\213\2457\257\322%J\277\034\300\275\221\374\205\217\301\277PG\240o0\375\003\376\207\275\002~\002{\r>B\353\224G\235\312\217\260>\345CXo\371\217|\314g\344-i^\341\351\314\363\320B\357\302\n\327\211\374Nw\356\306\324\031\331%\366\020\376M\017`7\347$\364Zoz'@\347\344\013\220\364+\337\222|u\335U\336\026\315\007\177\t\016\017A\342\313\213(D/\303\017\375\330\007\356Rv\350\325l\240;<}\361\351\211\317\3273\001\350\005\r]\301\247G\260\207h\370\207\317;0|\201VO\353\035\366\234\3267\371W\353U>\246u\204|K\353\225|R\275\204!\f"
+	.ascii	"3\201<\367\001\217\264\367\022\332\366\002g\227\001\n&\361>\273"
+	.ascii	"\3070\206\300\330\235\322\"\213\302\236\013\231e"
+	.text
+	.section	.gnu.lto_.decls.fd969f62fdf04746,"e",@progbits
+	.ascii	"(\265/\375`(n\245\277\001\272\3302\237T JY+\215\001\3241\304"
+	.ascii	"\002\325Cy\037e\370\235\235kSL\225$a\020\n+\024\224W\216H\225"
+	.ascii	"\236t\266\362}g=\332\244\f\330B\034o\0351]\027\007\364\022\307"
+	.ascii	"9\236c\337\313\372>\357\363\354\354?S\221\273Z<\376[\324\355"
+	.ascii	"dQ\356\275\245\2242\005t\b\n\n>\n:\215\276>\243\261\236\335\200"
+	.ascii	"\212`\177\320/\305\350,\305\376\240\366\253\212\276\233M_\245"
+	.ascii	"\375A\257\3014\030\276\233+\033k@n\376\302\001\205\341v\203\357"
+	.ascii	"\346k\034{\267\213e^/w\213\227[w\3650\232\362\346E\217\250\353"
+	.ascii	"\345r\271fV\257m\357\253\016\344\254\272\260\006\367\336\034"
+	.ascii	"D\210\340\001\322\005\230\205\346\247M\375\364Nk\001b\201\317"
+	.ascii	"I\215\233\237\306\351\333\266,f_w\027KY3\357\342Y\346\275\273"
+	.ascii	"v\317\313-B\004\320M\223\035b-\320\374\364M?M\323O\313\364\323"
+	.ascii	"\"\372i\016\215w\372B\343&\033\235w\030}\364NgtM\237z\366\007"
+	.ascii	"\275Q\334\330\250\276\264\271\371\250\022}\313\274P\334r\224"
+	.ascii	"\004\006\306\265\225\370\340p:{\227\355\275;\354\224\345\311"
+	.ascii	"\210\272\371\246]\266\3777=Mc\330\314`[\2739\243\2265v33\207"
+	.ascii	"I\031\025\254\233\217\022\321\377-\363\252\335'\313\r\244\343"
+	.ascii	"\"\210\225%7\037\365\322\027<\334\377\033\253\344\255\t\224\233"
+	.ascii	"\217N\351\237l\364\331\354\361\353\344\277]\327\353\232]\256"
+	.ascii	"\tr|\334\245\311\272\271LO\021\342\305\344\346\237}zH]s\357\r"
+	.ascii	"\344F\\\331\017'X\202\204\324}\235\201\345\005\025YR\347\343"
+	.ascii	"pV\257\315~Y\301\322\334{\0079\034\317\315\336udq{\357\377\227"
+	.ascii	"\311Ur\233\334\261\233\344\212]\262\213\344.\261\314\033v\215"
+	.ascii	"\374\036\271_\3177\354\0229\034\317\323r\023I\307\354>\272\301"
+	.ascii	"\2757\220\210\234\254\270(0\032\362O8}\271\354\006\024\204\375"
+	.ascii	"A\177.\365O3\375sL\377d\242\177&\321?\301\364O#\372\347\020\375"
+	.ascii	"\023\210\266nA\277=~Pe\326r\267\355\275{p\234\225\026kn\376\231"
+	.ascii	"\245Q=\273\001=\031\373\203\242z\366\007\2758n\016\313\fqu\374"
+	.ascii	"\322\260m\277yZn\265\275\227=:M4\336\266\334\374\263J\337\206"
+	.ascii	"@{\n\013\013\013m\b\364\347\326W\353^\033\367\306\257\326\315"
+	.ascii	"z\211\017\256\363t\265\362\336M\326b\300c-\006g\225\"MO\320\374"
+	.ascii	"\234F?\207\321\331\376\240i\334\305\342\2202\221\323\341C\206"
+	.ascii	"\005=K\032T<n\376\357\325\265\302\211\361\243.\306\315W\t\224"
+	.ascii	"\323$UC\310\315\317w\372\377\335\327\311\n\332B\233\346\302\270"
+	.ascii	"/,\033\253\306\266\271O\267\351\272\270Q\026\315\245\272Lw\312"
+	.ascii	"\236\261\2037\306mq\245\354\032Kx\241,\363V\331\277[@\033\370"
+	.ascii	"\273\334\373i\357\035$\246\355\313\313\333\327\336\313 >)M{F"
+	.ascii	"\245\214\245\253B\246I\346\017*cF\267W\267\345\267t\\\262\004"
+	.ascii	"\215qR\200?\250\331\344\213NK\036\032\341\327\362\267tzws\177"
+	.ascii	"\320\227)\315\275\227\366\314L\232\2638\2772;-V~K"
+	.string	"weL\037Ys\357\245\245\303\022\246i\317\344,\033\017\223\317v\332\353\373\240\304\007\267\312\372Y6\274\374J\331\274\306\312\376\2400\026\356\211[\023\312o\351\272\330<\274\214\323.\274\340\232{\357\333\272?\b\214\205\343i\362\331ONQ\276\366^\336\266\375\366\354\267\312F\261p)\023\327\216r\361d\020g\265\355e\031\334{\t$b\007Ma\017:\020\362s\020}\227v\003\032\302\376\240\317[\372X\215>\036\243\217\261\350\343(\032\310n@\217\317\364\361\021}\234C\037K\351\337\246\376\315\242\177\323\364/\022\375\313C\377^\351\020\205\372\266\214\266Y\354\235er\260x\273\307\002\002q\262\272\371\326\213\026\301\336\226\003j\013\013-\007\364\226\212\276\035\323\217\363\241\257w\245}\354\017\372\246\335\200\3366\351w@\177\003\332J\261S,S\003\373v\353f\241\374lZ\356\345\336\313\236;\204\215\333\223\233\317\202\276\325"
+	.string	"\305\205\205V\003\364&\264\217\335\200^\373\203~\260\033P\233f\237X\246\005v\355%>8fJ\333e{/{v\3324i\243\346\346\213\240o\325N\001\227\375\3019\350[\013P[h-@\177u\007v\003\372\301\376\240!\330\r\350o\315~Kf\3134\300QS\\\273m\357%\006\3754\027\245\354\346/\355\006T\333\037\364\307'\200\216W\002*\365\377\002\f8\177t\004\177\376\340\302S|-5\300\337R\016,\207"
+	.string	"\024\331\250\024\307K1\270:O9\374\230\204\274\342\372G]\3747\303\177u\376K\334\300\1777\334\250\343\245??V@V\372m\224\365\220\327\247`9\240!\270\314\013\343b\331\250\276\257\r\311\353\377\024@\022\320 \371[\017\367\340G\t\377\333\227\221\377\335\027\006\036@`P\366\300e\013\241\202\244\013\330(\016\\\f\374\267\002\246\345\300!\037\177\353\341\"\374(\322\3270"
+	.string	"t\245.\342GQ\374w\310\022]\250\023.\360\333\250\274"
+	.string	"\213\202\324+\370O\276\377\356\026\376\373\201\377\016\025=\005\322\237E\270R\317\360\237Z~\274\346\277p\231\350\317\367\317\370\317jF\377Ke(\013a\016\262\212L\374\361\006y\207\003\177\3160\274-\374\326\311\177\215\262\004\033\370\355\323o\255~\013\365[\345o\243\230\b"
+	.string	"\027b\340@Y\003\177F\221\201|\201+\365\t\374\250\212\221,x~\364\317\306\260XO\203=\270\006\031\305\237)\360?\005^Q\006\231\363\243^~{\365\302\177\231<\005N\272\371\321-\377\005|\372\243U\354q\005Y\002\326b\233S\270l7O"
+	.string	"\377;\234\202\037\035\001\252\351\002\005\374\270\313\177\245\344\b\334\025\277U\300\217\3572\t\367\351\032X\016\031\002Oq\245\216\301\217\036\340\307T\362\211\337\252\370\255\b\331\001?\276\222M\374V\350\267\303\337\022\345\022,\n?\276\3731\336\237I\270-\376\273\364\347\021\376\313\364\333\242\377\272\360[\b\344\006\374\231\001\377/p\r\362\002\376\254\200?\213p\245>\342GO\243\347\037\225\373\357\223\253V\024@F\300\177\323\374\371"
+	.string	"u9\004\272l\200\037\013]\274\274\301\205\361\265!\277M\257\ng\371\203\037_ \350G\225\240G\376\013\230\203\376[\374\357\360\202\377j\200\350^e\311\035\374\270\357\307~\177&q\325\337\336\370\257\017\025CX\270JQ\227\rg\240\302\177=\374\327\340\277n@\220\377;\374\203\037\235\300\237G\374w\370c(\377Uf\016\376\013\364\343)\377\345\220\tp\277\256\232\377\374'\232?\207\370/\212\337\216e\r\206<\005\236\200\316\217\352\370s"
+	.ascii	"\2442\210\3778?Z\343\177\341o\357\1773\377\333\374'\374-\316"
+	.ascii	"oo\376\257\371\317\346\267\370\377\231\364\267:\277\375os\376"
+	.ascii	"\013\376\366\374\255\376\217\346\267\366\267;\277E\377\253\371"
+	.ascii	"?\370\333\234\346\377\233\305\360\017\377\t\367\343\262\037\247"
+	.ascii	"\375\030\355\307g?6\373\361\362\307jl\230\310\217\233\374x,g"
+	.ascii	"\360\277\347Oa\374\031\203?w\370\363\004\177\376\3713\317\237"
+	.ascii	"\323?\343\037\263\3711\341\217\375~\314\367c/?\306\373q\335\217"
+	.ascii	"\347~<\345\307Q~\314\366c\346\217o\374\230\306\217\257~\254\374"
+	.ascii	"\361\324\217K\370\261\324\217\027\360c\250\037;\375\230\351\307"
+	.ascii	"\373\307\"\3701\b~\314\342\307+~\214\374q\322\217;\360c\243\037"
+	.ascii	"\253?\026\3721\361\307\033\370q\006~|\201\037[\340\307,\374x"
+	.ascii	"\002?\206\300\217O"
+	.string	"\374\330\304\217\031\360\343\003\3748\204\037\203\360c\017~\\\342\307\034\374x\203\037\017\340\307\032\3748\203\037\177\370\361\005?\356\360c\t~\314\363c\364\307\371\307\367\277j\376\033\370_\277\377\362\3756\352\277y\377\035\373/\336oc\374W\311o\205\374w\375/\006\377=\362\337,\377]\341\267\020\370\217\367[\237\377\246\370m\232\377\216\340\277H\377\215\372/\226\377V\371/\335\177\251\374\027\356\277R\376\353\366_\345\1777\374\367\347\267\034\376[\301\377\265\377o\377S\374\326\303\177\t\374\267\355\277l\377]\373/\363\277j\377]\376\327\354\277e\377%\373o\223\377\212\375G\361\337%\377E\362_\260\377~\3757\353\2775\376K\343\2773\376K\365\337\251\377\302\370\357\213\377J\375O\341\267?\277\315\360[\f\377\313\376S\375\317\362\037Daaa\341\337#\345\377)\376\020\330\013]J\255\306\204\266\247\366\3366P\177Y\311"
+	.string	"\274y\231\023\227\303\r\013\357&\356\253K\360\346K\020Cg\341\3411\325\007w\363%p\241\377\363\312-\363\274rb\261i\373\212gL\023\037\335\340\336Y\033\360\240%!\203V\367\023\213\025\016\214\360\265\204\360\346\240\240\237u\366L\r\332\225\233\277A\214\266)\237\232A&t\267\314\223\356\224\272\311\"\327\2055\270\225\312\r\276!O\313\235T\\"
+	.string	"\024b7'\367v\302\335\0320\220\\\255\275\235R\360\337\030\033^7\177C\330\031\005J_\330\2236rw\251\266\367\356\321\021\003E\213\340\315:UUC\270n^Z*)%@\326\260T\352\204\312F\024SML\2177\250\264\237j\377\371\304n\261l\366\352J\327\221\233O\373\203^\032A?\3232\2173UH\320\316e\013ZY_7\237\313\363LmM\n\323\315\337\220C\377\247\223\214\305\205\314\330\234Y\212w\343,\257\214\354&\355G\r,'\231,J\202\234cYkM\333\336\223&b\027\t\026Y\226\233\227a>b\bar.Y\221\225\345D\311\317%\226k\002\036\031L1\255\233\317$A?\225\2100\204\307\330\315\370\f\343\332\252\332B\205\004\007\001;\277\212xi*s\363\221e\333\322\253\212\333\315\337"
+	.string	"C\337\266mY6(dp\340-7'=\246\2349\332\360\024\313\306\203\367\316qvc,\212\216\323\313\352e\211 \346\244\351\343\324\302[V/k\343=*|tu'\221\363\307\031\3444r\0269\207\234BN \226y\3728y\330\345\356\241\303+\"\226!_\003\031}\rX\364\311u\356\260L\240\263\213\213S\214\255\233\257\201\212\036\301\266@\350\013-\020z\rR\36450\36558\321\327\300D_\003\021}\r<l\004f\335*tF\226625\244\360\324\331\2401\204\306\211\225e\314\030\260\233o\333N,\254\206\245\254^[^\"\245y\3168eX\346\211u^\345\023\353\254:\255\334\276\276\\\r\342\250-O\300\320|\r8\364\251\274\371\022\210\243\355\346k\300\322\327"
+	.string	"\245\3773F\226;\237\330\2155QA\261/d<\205Mi\245dV\274\332B\020~q\022\273\371?_\374\224:\275\264"
+	.string	"\322\335|Fa \\.\350n\376\317\240\266r\345\202\301hJ\t\364\310\321\204\213+\322\334{\323U\271R\230A\316\234LyM.\314lr\233Lx\2668\2352\232\023\352t\221\323\234My0\2539\267e\236O\331\357\271\231\377\340\344\210\210\031s\301\310"
+	.string	"1\267\243\013kp\306\371tk\\\331\322\2055x>\341\254\334\027B\013\245\t^\250\356\016\036\327\t\324\330\031\232\330\331\362:\301hJ\b@5i\336\255\313\205\321\224\232\215i\326<\237\356\037\236\201\321\224\020\360\022\303J\030\034S\336\256\024\346\221/2\347\323-s\245\300`\332\270T\316\247;w\235T\331\321\2055xg\234O\0310\013z\220e\307R\204\b\021@\"z6\03215\020\201\331LJ\b\243\313\026\275\300\037*z\001\333n@\323\037\246.\323\203\204\017\353\310\315\377!\323D2\036v\202\317x\232\226\233\311"
+	.string	"T\306\354\304p\274}\331\260ldMcv\203klX\212\347\311go\257&x\255\r\215"
+	.ascii	"L\232\346vH\271}X\013oy\320\004\320\212\032Y\223\007\376\261"
+	.ascii	"\347\326\304:0\020<\004\243)u\024\2476L\004\017\227\331<\253"
+	.ascii	"\007d71y\300\004{u\215\331\r\336>\274\034\227\347\256: \273\032"
+	.ascii	"\263\033\3140\2462\215\020Z(o\252\366\212\234\341\310]"
+	.string	"O\206|e\275,&\177\311c2\226\314\227\255\344-\271K\336\313t\231K&\223\353\262\227\234%\207\311`r\225|%k\311w9/\333Yf\306\313U\3074p\215\f#\327\310[!\264P\336\304\330#\202\2370\261\024FS\236\330\033k\356\275\361\262W\206\333W\036(\271\312\201\271\016@e\314N\f/3\036F\303ie\027pM~\321%\202\022.cv\270\353\307\031\317\226\271ZV/k3\375\201h\202d\314np\357e\306\303Q\260\232\020Z(\037\340u\004\023\301\303E0\231W\b&\200cv\203\031K\315[\213\0229S\3213b\345\355\346\377\264\310r\031\bu~\353\341\361\243\311\313\315\317\020F\363\310C\360\362\353\204S\214&\224<%G\261\314,\345OR2\221\274\f\241\205r\002NTM)\331\355w\035\234\242v\323\216\016\300\322\204\335\3455 Xt\350\374\fF\364\355R\214\203\325\003\322"
+	.ascii	"$Q\332\314\2324\367^\346e.\222\231tp\212\212@\235\224\261W\341"
+	.ascii	"\271\331\273\253\355\253l\254I\026\302\352\265\231\210+k\346"
+	.ascii	"ev\362*F\304\232{o\272\274\314M8\3604-\267\022\r\"\344\310\231"
+	.ascii	"\301\274\226\3332Zf\346'Y-\263\3454\313\314\313|\366t\2561\007"
+	.ascii	"\325d\310\307\020F\037\003\027}\fv\372\030\250\350cp\323\307"
+	.ascii	"\220\246\217aL\037\303\327\022&?.U7\037\203\016\375?\207\345"
+	.ascii	"$\226\231\225\344#F2\030\2172_YIF\222\3012\224\021\363Ck\020"
+	.ascii	"\277\2151\303D\363}\362\364\237\301\276r\332\230\341h\363\225"
+	.ascii	"\217\360892\305\343\346\373\254\351\373\234\351\373\210\351\373"
+	.ascii	"\200\351?\373x\036\362,\204\003nRY\\\334\234\201\344 \317B\362"
+	.ascii	"\217\235\205x\300\265wS\026\322\263f\357\246\036k1\260\026\203"
+	.ascii	"<\346u\004\n\232\357CD\347\036A\317>\240\200L]\335\254\201\375"
+	.ascii	"A\357\323C\337\207+\357\320\201T\322\267\343\346\373\274\340"
+	.ascii	"\322\201\2054\303|\345x\326\3014&\n\237\217\223V\276a\343F\311"
+	.ascii	"\f72e\264l\334|){;\223\365l\003\013\346\360Q\304\352,k\006\334"
+	.ascii	"\227<\303&Q\323#E\33723\226\214'\302\264\274\253g\031Z\226\254"
+	.ascii	"o\017\315\3159F\266\322_ULPV\312\236\272,m\264\2622W\241c~N\312"
+	.ascii	"\233\337\223\246/\230\251n\376\274h\001Be\363z\200\275\221\335"
+	.ascii	"\374\236$\272\003\373\203\346\r\204\331\236\232\334\374?GYf\226"
+	.ascii	"\302l\332\262\024n\223]\270\311\245\001\324\331R\204r\331E\013"
+	.ascii	"\033#F3\352\346\fus\2075\003\313\315\357\201\322\177v\262\314"
+	.ascii	"\374\324\027bG\330\325\315\027\314M\377o\356\017/~in\376s\323"
+	.ascii	"3\223r\263\331\2709\357\264\317\212K\332\315\347\t\324\205\230"
+	.ascii	"\315\335\321\324\305\352\346\3634\365y\362\364y\260\244\271"
+	.ascii	"c\314j\254\335|\236)h\360\240ebB,w\354\206\241\034\210\020O\301"
+	.ascii	"q<O\313m\225\206\371#\304T\260\240\325\313\362\331O}l\232{o "
+	.ascii	"\021\"\354\232\2256\200h\376\202\001\311|\231\301\201\370\214"
+	.ascii	"eb\301cA<\207\357x\2300\354\355c\315\227 \306\303]x\236\226\373"
+	.ascii	"\n\365c\362\273\342 BD\316T\017\034L:7\361\237eb@\354'\006\367"
+	.ascii	"Y\275\254\345\276\342\211\262\303\357j\020\020\363\3410\035\234"
+	.ascii	"\242N\240\033\323\324sB\350\202\240\371<h\032\227\331\221\202"
+	.ascii	"\013\343\033\203\311\340\314\310\322\243\273\371<J\364\230\333"
+	.ascii	"\030`PYn>\017\021}\313|\031\f\346}y\310\035\r\263\233\317\363"
+	.ascii	"C\237\207K\237g\253\013\316\303[\254^\233\211\274\276\346\336"
+	.ascii	"{\017{\261L\334\005s\351\202\351,\233\325\313\022\301\316\257"
+	.ascii	"\311s$\214\314\f\315\347Q\352\314\344\211\r\357b=\254e\357\354"
+	.ascii	"\364\341\250\222\344\346\363\264\320\337)\324\337Q\203\355p\026"
+	.ascii	"\313\304w\030\313-\035\226r\240\345\336R\360\035\256\202\353"
+	.ascii	":8E\241\220#\r\276\303t\226\215\207i\271\253r\216\200\371]\245"
+	.ascii	"<\250\234\tA\363w\342\364\217\353\216\257`\033QS\326,\317+Y]"
+	.ascii	"\212`+XN\314\213\335w\363w\334\364w\320\364w\304\364w\216\350"
+	.ascii	"\357x\3517\f\307\326\345D\354\346\357\330x\333\261\322v\333\r"
+	.ascii	"\350w\250\264]\332\r(\220\375A\277\343B_\247\215\276\336\031"
+	.ascii	"}\2352\372\315\264\252\253\023\267\246\005\215\233\257c\247\355"
+	.ascii	"\266?\250]\332<\233^"
+	.string	"\321\241Q\271\371:p\032\265?\350u\236\350\261\036\0318\330\242n\276\216\021\375\002\030\301`\030M\251\241\374\030\362c&\270\211eb1\214\244\255\r\213\3410\274\304\352\265\355&\031 \004\321\270d\r\356\275\024\001$b\007\312\240\032\032hN\202\225\364\300(\342bH3\211\027\375\2348}\004\177\335+\246\020\265#f\3729B\264U\332\0374\b\026b\367\316\244\221\272\021\304\n\373X\276a\341r\363s\2344\356\361\234\306\265\203\233h\340\301\335|\0344\3728e\364\301\350\351\343L\321\226\313\376\240\037\264\033\320\343\230i|#\323\300\353a\344\346\343(\321\307\371\241\217C\245\217\003\245s\226v\003j\305\354\017\212e\3077\205\343\346\337\004\352\013\210\225\030\006\256\342y\362\331O^i\276\224W\020\267\300hJ\023\274\b\233X\211\243\260\024\317\323r31\200\251\013KL\006\276\302V\226\211\225\370\305\257\337m>\211"
+	.string	"\312 \356k\2513\236\302T\226\371*8F\220+LAn\376\315\030\315b\357\275\355\253\240\351\253\240\277\311\242\177\343\246]X+\207\273Z\376r\f\336\374\033\246\326\261?(n\361\337\300k\006C\235Y\316\262\342n\306O8k\234\002\301n\376\215\231~\001\b\007\017\207\321\224\022\274\330\273\301\346U0\232R\257ym5\313\320`\246\333\006o\334\204\235,\363\026\3364\277j\356\032+\205\367\314\341\240\324\b\020\0066$\315\301\245.N'\377&\207\266\\v\003\252\301\376\240\277\241\241\177S\245\177\023\245\177\303\244\037\177\241v:~\3329\214\240H\360\324\f\272$\332\351/\361\201n\352\313\323bw\263f\322{\204=\262\334|"
+	.string	"\350\r"
+	.string	"\034j\324\244l\224ScZ\203W+0OH\272\346)\233\2766-\376\242\304\375\277\351@\314\020#7?\2036\177O\321\374\245\204)\035\320vz\3329\202\374\250\231ZR6\270\243\266B\024\371\320q7\370\224\360\016-d\306u\245\202O\317\3747)\237\227,i7?\2035\235\006>5\363\337\2347d\214Ir\3633@\323\177\n\370\337\350"
+	.string	"\271\313\003\274\371\031\220\351g\220$L\230\324\017\210\213\351o"
+	.string	"WSH\304\006\333\024\272\200\352{\352wZa\035m\312\273\233\3231i  \233\264LJ\006\267-\345\242\312lIr\343\312\315\251\2304||c\315\275\263B\340\004\341!\246\212\030-ZR/@z\233=!\322\304lc\234\240\351\362\324\313\016\216\034jdnN\367\022\360\224\305\313\315)\227\357\350-iP\335\234n9\255\210\364pB\343\346T/\325\001e\215\3409\345\252q!\323\303bg\227\342\001\351m\266w\326\334\2313\343Bx\367\024\017.\357"
+	.string	"c\343\307\315i\226\303\275\241\201\031\202A\224\264JZ%\255k\313\371\261\365%Fz\345i]_\217X\233(3nN\255``\006\007\227\316\331\264]\005\244\344\253\217nP\263A\331\272\221Ry:\327\327\2236eGxs*wE\352\214\315\315i\334\341\352\322\24641\b2eJ\266a\323v\225\2065S?\326X+d\304(o\376\007\277\324-uK\243"
+	.string	"q1\235I\333L\371p\222s\346E`\024\224\247Q\276w\366\005\214\025\232W\265&\315\315\377\240\246\377\224-e\273V'\370\354\355\325\026\267\225Y\033\350\240\361b\246\313\315\377\220D\3376\261)\216\247BR\034)3\310i7\031!@\340\216\255\rt\331W\227-7\253])\201\177[n\376\207\037\372\266lHZd\f\235\221\224H\007\247\250\023\312\304|\245H\254\036\220\006,\321\022\204\351R\"a\276\314\322'iZ\272L\235\244h\226\231\236\245aP\376\240\364,=b\341\254\036\220\006\224\201I\317\322$)\331\233_s\357\215\363\242K\017\007ON\207\274L\007\247\250\023\234\224i\246ci\231e\246dm)\031n\22369\300\335T\227\025\016\"v"
+	.ascii	"\273\200\271\201\346?m\222\212-\177\004\336\2342\311\252\221"
+	.ascii	"\005\352\346\177p\241\377T\211e\246K\004\305\344\324\344\\\021"
+	.ascii	"\342\225w\363?0\351{0\223\202i/M\034y7\337C\237\276\0071\372"
+	.ascii	"\036\274\350{\320\323\177Z$%r\252\331\231\311K\211X\266=\274"
+	.ascii	")\247\233\357\341N\247>R i\220\377\246g,\316G\224\233\357\201"
+	.ascii	"N?\375\361\377F\002B\264D\2719\363x\332\343\277\271Y\216|Q\335"
+	.ascii	"|\017p\372iW\352\365\337\360\2001\342\206v\363=\260\351\247;"
+	.ascii	"\242\024\232\261qs\312\245[xh\242\001\016\2167\0357\322\034O"
+	.ascii	"\271\376T\007\356\312B^(d\203\346\346\035\373\203b\027AOs\344"
+	.ascii	"\344Yi\236\365\310\312Jo|\330{\267\330,\272\\\031\323\314\241"
+	.ascii	"\242z\212\323zz\303\262\351`\202\241\2729\265\2013\306/\013\025"
+	.ascii	"\017X)V\212\225\322\320\302Q#\247\267\020i\253\221\316xJ\303"
+	.ascii	"\30291s\005\312\003Tz\225^\341\240\221\303P\232G\342n\376\005"
+	.ascii	"\3154F\032#U\336\\\021\373\322MY\260\306\322\252\247J\r\300\220"
+	.ascii	"1\343U\362\f92\274\233\177A\227\024F\n#\235:a\343\b\202ua\211"
+	.ascii	"\345\374}\t\314K\247\302\314\320\254\335\374\013\344R\027\251"
+	.ascii	"\213T\352>6p\2640\361X\rF\305\245QO\245l\236m\302\347\303\353"
+	.ascii	"\224\322{!\346\355\346_\300\004\n\nK\001\371\354\355\205\367"
+	.ascii	"%D\377\251\223e\246NX\nU\232\360\344\256y\301\225\376o\215[\343"
+	.ascii	"ju\220\302\355Ai\246;\335\227+\373\354'\257\274/A\375\243m\332"
+	.ascii	"\\\256\023v\323\025\b\262?\013\256\244I\203\256A\203\243\343"
+	.ascii	"\257\347\357L\r\0215G\327\360\224Ui\022Z E\017\016\242v7{\247"
+	.ascii	"L\320\037`\252\246n\276\005@\314\230A\317\204\241\361\214\251"
+	.ascii	"a\326\t\036=\223\203\220\2311F\353\305\325\\\216\233o\201\f@"
+	.ascii	"@\324\356\004\246\324\306\226.,\261"
+	.string	"\233922>\b\311\220A\233\267\312&\035\251\r+\035\206nG\240\337\321\346\251\245\271\246\360\346\013\242}\247[V\025%h\037Z\206G\312\334U\r\2367.kP7\277\003\026-F\314Nk\364P\341\342\244\274\371\035\334\370\370P0\267J#h\330\226\254\305\005\241\022\314\231\227\0038\203\n\310\315\357\020\246\177\324\013\023\365r\252\001q\r@\006\027;\261\275\2636\260W"
+	.ascii	"\301\362n~\007(\375\243{{[\324\350\243Z,\272\3052\321-g\336\t"
+	.ascii	"\273I\206\007x;\300\350\3333\017\375\321<4/P\004\2639\375\243"
+	.ascii	"wwM\344*H\303\202\005\265\333\300fGN\217\031tW\354\300\302\274"
+	.ascii	"\246n~\005M\256\\A\237pP\263\343\346\006 \025\270\"r\227C\253"
+	.ascii	"\334\275\367\376J\341\202h5q\326\242\314\374\250B\327\263\221"
+	.ascii	"p\351A7\347W\325D\033SC\206\006\007\025\214\304-\007\02137\277"
+	.ascii	"\002\032S>\005\205\323L{3\371l'>6_\367o\314\0228\364\355(\034"
+	.ascii	"\037\226\260!\025l\335\326\206F\261{\003v\300\346o+\204\016\020"
+	.ascii	"&j\204QP(f=\234\300AA\335t\270\224\321\002%M\230\023\026\036"
+	.ascii	"7\237\002@\375\243k\226\211\256\331\274\020\273\251\351\203\231"
+	.ascii	"\325\336\340\024\334\241\241jh\350\223\2644\364\311\031\234\277"
+	.ascii	"\n\200\331\365\t\036}\302%\211\021(7\237\2026}\n\212\220\241"
+	.ascii	"gd\250\023to\273\344\252R\356,e\b\264\f-C\235\330\255\024\304"
+	.ascii	"\301\262\345\224\332\312\2433;\352dg\fU\220#7_\360o`V\244\226"
+	.ascii	"\334|\n\256\36494\365o\226\3056\260\215\253\005\264\231\376:"
+	.ascii	"0\003;*&f\331\2006\023\340\007&h\313\r\316\201\313\222%\247\037"
+	.ascii	"\216\025\0079\375\253e\321$I\256\226]\356*\rgru\033\240t\313"
+	.ascii	"5R7\237\303\327\221#(\222\224\311\037\330Q$}\027\210\0310s7\243"
+	.ascii	"_g\031}\005\007\025>\266\3777\247\327\0312\034l\350\037-\202"
+	.ascii	"\0269\227\374|\332<\304\276\366\316\332`\007l\214\351t\3639\310"
+	.ascii	"\320%>\260Lt\210e\263i\273\n\307\205\214\037\200\203{\327m\220"
+	.ascii	"\331\370}\tr\363\201\374\320 h\020-(\017\224\007\372\343\003"
+	.ascii	"-L>\216\376\320)3RE\343f\264\007P\234\376\321.\313D\273\256\225"
+	.ascii	"\265\332\273)\353C\340\216\2363_p>n>\220\023\224\013\345:\003"
+	.ascii	"Q6;\272\260\304\200\2409\320\034\350\226\bL\264\276\200d\240"
+	.ascii	"Yh\026\272\205j\001\273qt\313\022Y\243\254\273\031\325\312zJ"
+	.ascii	"\263\345f\324\206\345@\335^W\033\245\022\245\321D\207\257Y\206"
+	.ascii	"\017\235q\224\206NT\223\240\331\315\250\025\212\345\345\026\206"
+	.ascii	"\006\212\205\312\220\343\001\244\251Lg\315\r@\276\253k\004'\351"
+	.ascii	"\032\323#\023\365(4\206\365Y:\355A\371\332;+\004O\2330Y6\325"
+	.ascii	"\321\030p8\3145=\310\334\214J\241S\377otd\354\030\204\273\371"
+	.ascii	"G\247P\030`Eb\324\320\"H\326\347\204\276\270veb\370\255\271y"
+	.ascii	"\002<\264\005\332\342\272\331\264]\325A\211\262/\3049\203\254"
+	.ascii	"\205\230\233?\301\024\375\243O\267L\364\351\274;\243\366\266"
+	.ascii	"\002\301\004,k\203\234\257\271:\036ml\330\240MgP2\224\351h\323"
+	.ascii	"\3314\362\343\313\315\350>\313\310\251!\274\371,\224B\266ew\363"
+	.ascii	"\331\346U\306f\320\200\262p\371,,\313\307\315\237\340\210\340"
+	.ascii	"\005O5v\357\275\2636\323_\020\226-i~\252\271a2\203&\354\346\223"
+	.ascii	"\360,\243\026\266\005o\360\377M\212Exgf\360D\363C\210\030\222"
+	.ascii	"#K\035s\\\316\234<nn<9\203w\363'\310\361\367w\006^p\205&O\f\360"
+	.ascii	"g`Z%\t\222*7_\220\347\207\222,m\310\204y\230\323\357>{o\247\275"
+	.ascii	"s\340H\261X)C\374g\337O?\355\346'\207\343\346S\314Y\346\377M"
+	.ascii	"\346\013+bW\346$\003c\016\n\313\031%\227\326D\355\346sL\366k"
+	.ascii	"\352\322:s\363\005/\327\377\233a\025!\2037_\002<\375S\357\334"
+	.ascii	"\362\223\313\271\234|z\357\315\264\334U@\202L]X\203;++DJ\370"
+	.ascii	"f\245\356\374\362\223/\220\216\r\323\315\027<\2754\tr\001z\351"
+	.ascii	"\022\330$v\345*\315\334`Cx\356\331\277l\006%Dy\363%h\323\377"
+	.ascii	"\355\357\217\356&\345\336\373\352\\n\245\223\016\372\333\333"
+	.ascii	"\323\332\020\377\216\3056\203\377\371\317\300\b\226\033\212\257"
+	.ascii	"l\357m\315\3500\270\246\033\037\366\251\267\367S\027S\003\272"
+	.ascii	"\254\236\272jD\251uYa\210R\353\332LOF\2300(w\027S\224\332\336"
+	.ascii	"\030\236\236\230LpYE\2515m\fQj\333jCq\261\262{\331\305\264\237"
+	.ascii	"\2706\206\375\264\233\266\032\227\325\207\250\247.\253(\265&"
+	.ascii	"+\fQj]V[\255k\373\354\247&\245\324\323Vb\330j]\177[\215\313\312"
+	.ascii	"'J\215"
+	.string	"\313*J\255\353\316\302\275\b\214\233\361\245l\210\024\013\026\365\264cPm5)}\364\242\226\\\033\314\336\266\255\305Vn\275\2753\330{\213K\t\246\251\206\215s\322\213\341$\245\211\313.\367\336\034\250\234\274\270\366\223\036\223\335zQI\270\366N\342d\264\251\366\336\333\003\246\245\336\016b\365\230xl\355\251\026{S\260\227{S\355\315d\267\336\336\233i\357\235*\267\226{k\371D}QQ\355\235\005D\265\267\230\344Z\354}\333\304\304YE\251yq\005\311\255\251}m\027K&\0335\305\265\2776\230.\034\217\210\220\352\212\t \217'|n4BE*\256\353\220\270\036\251&T\244\342\232\223\204$t\263&\221\306\342\t\343\004\222E\013T\024%\024\031/x\341\204!uM*u`h\2045YT\362\300\222\004\324\225x\244$tD\024\362\260\022\217GD\247\017\216R\022\322\317\215F\254F\025i\bI<\252"
+	.ascii	"\241\203$\252G%\254P\207\264QRI\205\025\352PZ\\\241\232\030B"
+	.ascii	"\022\207\214\304\025\305\nuH\303\215F`\220\024*\256\311\342J"
+	.ascii	"\\Q\264\220$\246@"
+	.string	"\252GJC\252\221P\262\203:$jP\217T\020\223E\023$\216\305\t\320\033\215H\036\035\021\205\214V\"\022\t\027\216H\243\365hL\211\210\352Q^\223\306\243\320I\264\032\213\310#\364F#4PW\342\n\253\212\002\003\005V\325\307X$\232\260\026\215(\354\234P\341\347F#\324\026\210DC\021j\013D\"\236\033\215\020\032\252H\305\325\250\204$!D\344aUQ\340,%\035K\350Yo4\242(\211DQ\322\217\220Q)gU\223*\362L\016\213\222t\326\241\261(\3514\026%a\365\205b2/%\035\2052rM\302Cj:\244&\225r2\375\022\0229,J\032\261\263\204\374A\252k\262X\244\2560DTW\360I\252\030!\231dB]\211+\344\254\252\t\031\210\352\n\034\222\023 \225\222D5\205!\265C\222\205!\365(\t\211\210BE*\246X\223\304\b\020-\300)2\026\215F\245\025N$\213"
+	.ascii	"\340\240\256\352Q\022\322\261\004\023\222E\017\311\036\023V\265"
+	.ascii	"h\303\215FX\220\034\352Q\223,\034Sd(2\026\213L8\"*\231P\223J"
+	.ascii	"\032ZH\022SH\026Y\214P4\242\240\327\242\021\005\025\251B\nK$"
+	.ascii	"$\225HH*\221\260\263\341'\305\020Q]\201\202\016F\254Hb\322\b"
+	.ascii	"\265\210\210TW\214p\244\204\244$$4\302\252\232pD.\025a`bG]\211"
+	.ascii	"CI,\f\251+\222\270\242H\022-Pd,\"!"
+	.string	"GX\223\310\"\321\007\023\220\220G\"\244\232$\301y\243\021EJ*\324!\022CGE%\025\352\3201\205\233\036\036\f\311\r%\202\214\204\326\243\0044\2348:R2\366\034\221KE\231()\002k\321\210\202\317\215F\034%!\025\005pD.\231\200c\30434\236X\325\244\272BQ\222\206\013\025\221\252Q-\322\367"
+	.string	"\004\016@\b\201E\372\020\020\320\001\002:@\037\002\002\202\202\020"
+	.string	"B\220>\bAx]\"\"\221# \251kr\tE\207\240\034u8\204B\013Ib\n\"!\034u\250\016\035S@\252I\252\252B'\203:L\026\021\217N\2547\032\261B\035*J\002:\3213\251DB1)\211\026\021S\030\223BhR\211\004\241\022\305\021\204J\024q\3244\211\256\303\022\005P\221\212k\322\361\030\201U-B\022W\236u\310X\034&\205\212HD\343\322\320p5**\036\021M\220,\262\030\241HI\205j\"9Dq\243\021\001P\207<'\254=\303\364F#V!%\344\232,\221\034\262PW%$\f-\b\035\217\206Ct5*\035\205\206\303\024\251\032]8\016\207i\022\251&\225\214\303\241\0362\026[\030\016\321\34405\036\213\311\342\221:\034\336\254\3035Y<\362\271\321\210\244\232\264\264r0\244\"\211FI\016H$\327\242\n\022J\306\"\016X(\031\213G\034x"
+	.string	"\302\020\204\020X\220P\207\224\216\204\214E\022\310\244\022\211\003\254,T\343\021\321\210TWcq8DT\221Fk\322p8\301\n\025\2314\034\242k\262x4\034\242\304\22584\034\242H\242\221PV_(&\207C\264\005\241\343Q^\213F\024\326\242\261\270\301xb\210\250\"Q\344\252\202\220Q\351\004q%\232\030\"\252+\034\221K&pH\016W\250&\214'vn4\242\270\262P\221\352\321\220\221xBqe\241\376\254F\242\233\034\n\251+\264 DTqtD,\241\270\262P1\024W\026j^\223\303b\022\n\"\325\204\232\264\224b\210\202\n(rT!#qM\032\213z\035N"
+	.string	"\205l,\252`L\n\241\305\244$N\016K(\201BN\t%P\270A\205J\024\361\215F$\225T\fS\030\362A\252k\222\210\204&\223*rh\210\230\252+\210G(\224\222\220\264\322p\205:\224TR\241\223CU\250\270B5\221TR\221\243\016\325\244\245\024I%\0257j\322\322\232TR\221&\225T`\365\210(\224<\217H\365\002\272\004\023#\020\351\244\322\261\270BE\252\220\301\005\342\n%\230\300Q\221J+\021\251&!\251k\316z\243\021JIH\303#r\251HH\210H\"\211TW\024\221C\003P\207+t\360A\007 (%!\375\030\217\305U\351\350\230T\2218\311\241\006u\210B)\t)\007]\217\224\222\352\n\306cQ)\t)\203:4\026\025\217\210C\036cQ\361h\204#r\251\350F\035\356\274p\002\004\324\225\270\302\322\020Q]\201\270\022\207n\210\222\216t\210\222\216\206/\030\265P\242"
+	.ascii	"\031\222IG\244\t\244:T\\Q4\241\224\204\324\263\016\213\210)\216"
+	.ascii	"\305\264\210\230\242\270\262p\300jDA)\ti\307x,\256B\352zD\252"
+	.ascii	"\220$\236pD.\025qX\241\2328\"\227\212\322u\035\226(\300j,\246"
+	.ascii	"E\306\242\261HDRWH\252GBKB=\311!\006$\245$^o4\"i\264\022\221"
+	.ascii	"\214C$\234\034\256P\207\326d\232B\n(\206\216\216C$\024\205\013"
+	.ascii	"\252q\210\204\"\211+\260P\216\206\243\235\r\353\317\2050(\r#"
+	.ascii	"pD.\025\375\254-\330\3440G]\211k\362TW\342\212\"hM\342\341\t"
+	.ascii	"\n\372)\241\263\001\271\252\340\263&\207\272\204\361\304\322"
+	.ascii	"QR\322\b\022\360\2547\032A\302xDB:\nUPb\351&\207CD%\017\024U"
+	.ascii	"\360t\240\342\006\251\270%T\334 \342-A\274A,n\t\0267h\351\226"
+	.ascii	"0.\2318\321\263\016W\235dAE*\246\3409:\036I\030\236C\352*\244"
+	.ascii	"\256\252\211\243\317z#\n~LR\221$\326\343\021I\"\307x,&\225\210"
+	.ascii	"\222\303\242\"\221\361\250\223b5\252H\352\212c\n\037\220\216"
+	.ascii	"Fuh(d\\J\022%\035\rU$\321\205!$\321\b\231$\032\032\025\025\215"
+	.ascii	"v\324\244\322\360\270\346\274`\324\363\202\221OPP\211\341\013"
+	.ascii	"F\032J\f\211\210\216\253\222\320JtL\002\271@\\\032\256j\222\210"
+	.ascii	"\350\330\343\302\361\210\b"
+	.string	"\251\256\230@\013B\252\221\320\016\0065ii\035\226H&\211I.\034\2172,!\325\025G!\025\211!\035::\032%U\244\321:4\026\223\222C\027\210K\031\224L\030\217\305\225\210TQ<\"\226pD.\025M\360\202\321\220\005\021iH\224t44.\r\375\250EF\"\262g5\252BH5ih\264\016\025]\230\300\0039\353\020\204\240\325XT\322/\030\r\215E\244\241\221\320z4\016\215KC>\3530\204\325XTJ\037\024T\302\007\026$`\202\026\032qD.\025\221H\"\217I\243\232$a,\022\221H\b!\223$FpH\026Y\020\207EJ*\324\241!R]\217\212D\303#r\251H\202\377zP\357@_\204\t\003D\203>\311n6\200x\235A\235\244L g:\004\271\356\322\326XI\273\226t]\005\372\2453\276|q\003D\221P\265%Q\373\323[k\350\322\230\271\331\317\357\364\303\333!"
+	.string	",\032\f\030]&\220\203\262\251\3006b\256\313h2b~T\261\273zL\317\025A\035q7_"
+	.string	"aZ\207\301\\\332\024A#\200 |)\033\2345&c\332\276h\247\364n\306\022\211\027\355\"G\232=\274\233w\017O\232\275*4\313$lb_\270\020\246k\203oW[t\214\036+8\035T\364\264\f4\007\035\2263Zt\r\234,W\242\004\311\303Pzys\2027\353;}\247\301vta\211\t"
+	.string	"F\225*\332n+\325\301\204\345\332\356j\031\231\242\203N\327\245\231S\242\244N_9\023,\304\302\322sI\226p\332\n~\321#,\r\231\233\037\2002zN\317\235\201\367i\002\373\013"
+	.string	"\235\216\213\323r@R\035rr\270\n\312\t\220&7?"
+	.string	"J\364\257\341\320-\213\265\347B\371\326\204\1774%a\233\342\305\253K\357\313\315\272M\267\351(AP,hP\256\243\330\250&\272\272\233\265["
+	.string	"f\350_\263\245sy\215K\213&k(\r\375\003I^\016fZ\227\271\004\252QCc\364H\331Q\345\345I\212\227\2065\211\025\352408ZN\250\314i4\263L\310\346\312\022\275\274zG\350\262"
+	.ascii	"\317._\221+f\350n^j\310b\022\343\346\3372\017\247\313\320\276"
+	.ascii	"\366\336>:b\314Li\273\371\001\250\322\277&C\177`\036@\232\n\307"
+	.ascii	"\254\334\253--B\232`\261\200F\324\306\304\324X!\373\373cr\346"
+	.ascii	"\335\374\330;\003\026\026\246\225X%\211!YX!~\235\344Z\3119\230"
+	.ascii	"C\006e\231\003D\033\375k$\2017\314t\230\001;\357Xh3\263\362\225"
+	.ascii	"\372I\271\2203r\227\347\022>\2641\332H\032E\215\f!\233\233\265"
+	.ascii	"\020-D\023\001T\200\f=\344\232H\236\313\261\"\005e\306\315\027"
+	.ascii	"L\313\310Xja\335|\020\201\372\327A\310p\366\252\372\2764\020"
+	.ascii	"\375\203L\234\240\331\315\3136\034f\233\234\013\037X\r\233B\277"
+	.ascii	"f\017\0367\232\340\216\334,\206#\214\233\366:\371\324\240|\031"
+	.ascii	"\2749G\016\275\003\210\213\351\017\004\232?."
+	.string	"Y\033\350K\363Bs]\357H\227\203|_n\326:P(7{QzrZl\330\320[6mW\331\253\251=3b\227\352m\215\333\215\353\255028\374n\326Z\177\323k\244\360\342@\024\3213\364\f]\003\357\353\234\033\324\323B\343\272F\037\217\032\335\333\023\020<\264R+\265\214\274\346\336Y!\200\322\274\360\351\253k\031M/\2037k+2\261\272\031 \266\264\224\226\3221\314\230\206`\r\352\026\203lL4\325u\f?%_F\364\024!s\r\r=\245a\244u\315\220\303Oz_bh\372\305M#\230\304\316\314\315\007\341BCi(\355\"gp\352\254L\227U\020\335\342\332\0056sed\312\334\004\205C\\\334|"
+	.ascii	"\264\025\006\207\346\2503\202\263rL2\305('\231B\n\021\215\246"
+	.ascii	"I\206\003\223\025@0@L\036\224\212\266U\366\023@\004\013\253\264"
+	.ascii	"\211&&\031SfFFDD$IAA*\313\0018b\003j4Z\262\353\220\220\314]\005"
+	.ascii	"^\\<\355#\273p\004^\303,\312]\256\257\326)tw*\234\023\274\367"
+	.ascii	"\275\340\303\345\003\375\305\305\217\346\t\223\342\037*vN\024"
+	.ascii	"\334/.p\276Q\334Q\267\256 \367\030\372\313\217W\273\201\335s"
+	.ascii	"\334\341n\013H\221F<K\357*\311Dm\340\b?\327\266\216H\227\201"
+	.ascii	"\nG\035\367\034!\307LV\213\030\037'XA\260\031\230B\300\356\002"
+	.ascii	"t\034X2\204@2\206dt\360\215\3710\260$\367e\315=\300B\020&s\242"
+	.ascii	"$\240\265\036\264*\362$\341\271\262\246v\312\023\016\036N\326"
+	.ascii	"\034J\225\002\274\003\366\251\327\206\232t\361\202\327\004\363"
+	.ascii	"iF#\332\002\006\360\223!\331{P"
+	.string	"\314@\360\206q\353\364\377\021\335>\372\211\027@\243\221\304\004\220\332\364;\214\260\265\302\336\342\305pyd\251\201#\322-s\024jF\237+q\313\372rv\r\261hZE)\251#\363\276U\256-\0363i\013\357m\336\227\005\263f\366\037Y&\f\323\300\201\356\025Gh\225\007\206\260\260\235\250\205b\017\365\220\215>k\n06e\337\255\f6a_\255\32256\363NF\342\226z\332\207Z\350\001T\242\232{\027\230\r,\032\342\330\360d\254_\032J\225\364\177?\016\317|\006\207\303'\024\233y\335B\322\365\332QNH/\356\256\303\266\034\bG\230pQ\312\235\353\335~\221\017\246\345\034@\332\364D\214e\305\361e\002\356ml\025\360\0312\n\332Eu~\245\332\300\206\233\t\311\b\314W{\t\300\207!\321\347\347g\334\264\364\311\265\n\215%\034\334\255?o\002\nR|\001d\373\021;\377W\246l\271\375\217\037"
+	.string	"Dtt\220;1\020kS\322\030\322\336\203\210L\245\352}\235\f\223g\032\034\225>s+\267T\2040\217NQ\224Df\001Q\231I\227\002\032\3761]w\273\342\323\007*\305\220a\215\355\333b\314\212*B\207\233\350O\346\003fgY\264\001\257\3724|\315t\366\036\022"
+	.string	"\355_\301\246n\341H\322\034\2042\007\f\352\332?\t\232\206.\005\177?y\263^\374\302~\r\242\306\177v*\017\271K\272{|\3176\361\205\004qC\345\236~d\217\300\375\206x\316\3146\306H\306\320S\355\346\310\264\020x\242b\036\211x\210\244\004\026\360\322\021\374\306\201C+\rA\263\372\031W\362\227\252\342)\342\243?\031PN*\234u\003\210h\200\323\265\t\337+\303\f\035H\343\212\200sc\024\2763\266\236\311\016S85Z\036h\350\207\2643p9\361\n\217m\221\312\312\320y\353\230\254"
+	.string	"\244\3764(_\302\276I\276U@\033\020\251'\344\226\215D\2163p\007_\327\001\250\221\234\272\361\266v\243\256\352\021\003\311\313\234\255@\273\277\034bl\352\311\013\322\335\255\202\330\360\304\"\"\223\222\3077\020\252\260i\025\312\257\300\322E=\332iD\007W\316\260X\037\033zX\026\"_\304\252A\\\352\205\031\254\247\341\247\370\231\036\363\323G\274\032\210@@\210wU\025\250\375=\263\347e#N[G:\234\207\022\024oB]{\343\204Bd\214\211\375=\263\363\306|\326\231?\366\225\3602\355C\034(4m\345i\201\226\202\023\270\356\022\357>\0346@\0019\326rN\020\212\r\323\356\252\264\035\254\026\3465\310\241!h\300/\300\306D_\200\220\rv\026\317\252\340\335=j\242%E"
+	.string	"j\bDE\032%\177\341\222\326\213\311jV\005\031\204\311\305\311\200B\306"
+	.string	"n\034\223\346\b\204C\\L4v\\\225\366\273\337\335<C\262y\026:*\3471\362\351\022O\256Gu\2062@\\\247\254\350\223\261d\035*j\310\002\341\277\274\233\311m\311\fd\177\366$\367_\207\007\005t3\027\313\016\311\226z\035\221\006c\2705dR\333\r?\364b\346Sd8\235\026C\026\007A\360\340q\346\232\375u\210_=q\333\203\037\210=xv\t_rVx\002\304S\205\241\304\263 \037\337a\2043\343\034\265\265Gi\274K\305D\377\021\3528^n\263\370\307.\227\330\354\332)\274Se\263\352i\003s\370\016:\3263\367\254\246\337\2024\025\211c\264+Tp\311_\250\334u#\226\251;\357\002l\233HW\001Hh\321\263Gs\273\375\253\357\\W"
+	.string	"\341qg\001\224\202\3754\f&\n\354\326!\240\370E\235\343\024+!\271\211zB\216\017\264\003\263G\214\002\030[\306\003+\345\267;A9{\217\324z'\233\177\260\251*\217\245\274\335\002\350X$G\030\220\260\177\226J\003\200`t\346 \222\253\343\357\021\271)5\0248\033\217\201~,\020PR\261#\005\352\032\335"
+	.string	"\320\021'\251\357it\202\245\312\345\n\243\032\"mw\376\370\256\200\333\n\003k\036"
+	.ascii	"\206\327\352\2219,\350\2659G\217\377F\342\b0\317R\005L\335\217"
+	.ascii	"\344;\300\204\252f\nrL\201\243?\224\304\311\225p\223\212\034"
+	.ascii	"p\332AG\314\211\232N\307o\032\370g\2721\230a\361\243a\362\345"
+	.ascii	"? \363\264\267\276\b\245\022:q\202\247`\342\352E\302\3473\fN"
+	.ascii	"m\2702\013\335z\241\271\255!\264\304\326\267?Z\233\337%\022\023"
+	.ascii	"\361\354\311\340@_\f\241\003\035\003"
+	.string	"LG\tU\005}\344\362\270\251\177\367\231+!\331\305gB\307\313P\220\271\333}K\302\222\345h8\267\023\365#\267\206\022\210h5j#v\377\310\221\222\025\367[F\2200X\217@\032\231\232s\246\024\373/Up;\002U#\023a\316\330\274n\037d\256\030:F'\2230\236cbD\267\375\272%4\370\363\250>\264~\276\352\373Qoa\033\313\345-#\355\n,9\266\200W\300D\031\006\031\270\200\227\253\264}L)D\210e\367Z\262D\016\366f\250M\225\2556\034\004>\314*\217o\322\"\001\262E\273\334G\"\227N\033x\377[\221\246]yk\201\333v\223\375\323\034\337\214\027)a\261\374\252\201\263\276~P\n\237\204\365\222d\341\016H\377f={\367\260^\256\203\030Y\033\366\333\276\206h\253\013r\270\316(G\022\233\257\361\007%\251H\352L\203V_t|\3126\211\226u>\355\030\223\256a\333O"
+	.string	"t\347X\272\245\320N.\202\374\215\335\314\372\023,Q"
+	.string	""
+	.string	"\005\200\333"
+	.ascii	"\315\255\237\256b2\236\350p\316\030\347\365\227\221G\304}\260"
+	.ascii	"IF\245\335\247,\242\364\234\344\356\253\001-\213\343\034\004"
+	.ascii	"\007\274\217\211\270\345\027\025|\313\343InvWN\2617\021\327\363"
+	.ascii	"\005l{\237\3669\214xC\243"
+	.string	"\262\364Wm\246q\326\205\275\240\242v\211\242]\016 =\313a\236\2622r\006\316\372*\032\021\316\030h\256.\331Y\314\306`+$\333"
+	.string	"-\371y\333\207\252\"\312\367;<\0328^\344J87\210\\\323\321+\256-Q\221'\2303\326\022A)\323\024\034\263q\n\340\031\332v\255\255\021m\023\334\2005(\001\222\177kl\351U\032\023\237E\310,\322\330\376u\345\203\302\260\236\225\320\356\f\315\3607\310ef)\242H\016\3350:\240\301\005\311[NK\216Zu_\34528~Q\376\234\375p\3111\246\215\203]\240Q\355\333\204b\325\215KQ\332E\f\t\027\250\270\235l\022\020\341\314\375l\003@o\213\334\341\203w\203\344\247\315\203\256\242\032`!\333H 9\f\270\255'\230\211\335\323h4\210#@\2000\352\376{\315\251`\236\2730U\204\".Lm\374\217J"
+	.ascii	"!\031:\334\n(\310\206\240\027\266\242\210\\D\360EIq+W\333Bt<"
+	.ascii	"\325\033%@@\373\261\275\210\230k(hD\334\2123\210\237\241\362"
+	.ascii	":'\322\031!\027\242\022`\222-*\3247\021"
+	.string	"bs\363\f\360d\201\251y\255\366\351\234\256\026\030/Ip\200>\321\221\300\376\301\2170\313X\\\334F\200\023\234\276\321\322_\307\236\304\003\347\026MM\027\\\306\233\223j\311\fuCDLky\204&\325 \331\3444\021\205\b\020\\\231\253%\002\203\022\252\2744\253\002\374@\035>\033z7Y\033\304\342\356\340\001\361\330\334@\317\321\366\251\017\360$\016\211@\366\304\2355T!vF\260\231\371\244?\216\027\b(\222s\200\201\f\036\332U\237\" \326\234\316@WXU\270*\027\273ya3\300\367O\254\025\330ac\355\340\263:1\224\222\032\032o\342`\223Pli7\225\320m2\3148\347\256\276AY\364\fq\264\022c\334{\323\252\341\030\331\351\364\350Mdd\350oo\347\370\016\005xA\351\302\004M\215\321V\n\274F\005H|\005\0360~\031\033\277\374$\t\246%\343\205\005\253\233\260\263\204\2168\245:"
+	.ascii	"C\351\254\264\032\001N\007\271S\200\205dF\245\310\007\241,*;"
+	.ascii	"j\3069\260\250!\315\016!\030\376"
+	.string	"p\200\240u\320\327\337\263k\274\352\341\301\030`\204t\370\b\302Pf&\303\210\324y,\255\356\303}\214\337\377\361\302\253\273\275J\002AO\316\314\235T\262\306OW+\232-\274\fc\335\034\003\207h\344\007\3731\231\201\236\257\357\n\213@\350Q\201\200\336\330\200\352\204~\334\240\237}\006\302vc\276\227\353\250<#U\335\b\321\327k\035d}\313\331\320HnE\211E\225<R\236\023\205\270\262\215\364\237\ty\022=>\317\210\253\336\343\211\333\026m<T\324\334\275\313\244\305\232\210\034e7\300\351\025\242v\206\007\234\301\212x3\274\203\205E\252g\271\261O\036\222\f!*\301\261+\345\026?;\274.\341\220\177\2709\337\nB\330b\004\210V\247\r\222\206\035cMo\306w\276\260\231E\033z\305\322\r|b\360\317)\021)\204\376\277\345\336\200\355\016\350\337\"\316D\366\374\025\257,\304mj:\235k\021=\\\265"
+	.string	"\221\023\r\364\017\241\317\030Y\355 \354q\375\254\230\267\357D\376\243\317\306\366\360}\223\323\276\322d\211\365\327\334\250+\r\003\251\357\025\3256\232\244:\232N\300J\217,\016\tA\301a\371D\321\3341}\326'\326\007k\224\021\246;\346C"
+	.string	"\317\361\2633\007\227^\254\205\253\225\203\314\305\314\374\301\004\301\266\n\233v^\243\0300\373\327\tp\033\363O\t>\217V\250D3)H)9\f\311\025\300\b8D$\256T\207^\225\252\026\331\217T\214?\205 X\300\266\377\230TD\026\355\007\362\275\317\247}\257\373\271\235\035\305V@\321\256\363\006\372\202\366\n\260\270\360NE\257[\201m\030\234x\257\020,"
+	.string	"U\227gaM\020\247\033_\355\323\0257\352\307\\\255\241/q\221\230\177\260\023:\212\321\256\266\364J\303\305\344\r\333\274Wv'm$f=\344\223\\Im\007\225\325\221~4\360\355\371\212!\260\301\326\023r\005x\321X\204\354wdh,\222Nn"
+	.string	"\006\350\245U\b\bM\323\366\223\266y\f\220u,\345n\275\002bbJ\2247r\035g\257\375O\035\026()\261T\276<,8F\326\031<\314nh\334\201\326\030\336\3605\rS\345\260\214\004\265\347\332\236g)\371\252\030\036\363nZ_\256\2347\271\216\200\251f\354\3062\034\316}k1\020\257C\315R\021\364#\334\352\372+pYN\005\007\302\276\225c\037\030/\217\227\366\245\335\375\372&X\251\246\323%3\346#;\372^\224C9p\310I\334\234\3038I\222\013\026\350jR"
+	.string	"F:\031\236\006\270\220\237\022Z\004\25285\240\t\343\261\271\020*fw'(\261\336d\006\224\312\354\3044\210D\201\t\333\207\004^"
+	.string	"\342\275D]3\337\220\222.\243)\305QKB\331Za\307\013\321\030\315\357\345)\303\036fa\3224\200\r\214\373\001x\242"
+	.string	"Tv\016\201\307\022\215!\306\303VBt\372\234\230\320\237G\r\323\231\005\272\005\271\3522ae~\315\275m\232R1\210\034\343\373/\216i\305H\315)\004%!\f\357\3305\3207GPQ\034\260(x\243\272FD\302\031/\235\002\320\323\371\224\201|w-u\213L\302\243\3212\350\310\375\342\330\227\376\325\350k\"\tc\177\212\316Np\323\274\n\212\324\350\370hy\301\b\363byy\214R3}\222\276Q\350\355)\025\373\323\262{\253\255\275V;\337\233\220\032\bh\031\360\345e\030\351\b)\245\212~\203w\230k.\240\232x\241\366l\027\275\024=\013\033\267\344\374\217\005\240\242\0208$T!A\235\331\245\341O-+\006\316{\324S\013\035\255\252\362\227\342\374\250j\276\271\372\342\300\371\201j$\361\315G\207\223;+C\333\002g.\237V\021\304r\007\333s\244\331"
+	.string	"\323r7\0067{d\3743\001\226\363e\304\260P\375\201\303\216\006ZA\335s\213\224l\312l\034\366\322X{\"ICW\027p\355\251\001\327A\003\320\302\201\215\204\016\371y\255\fX\310\025\214?\377\251GQ\013\344u\214\b\355\213~\351^\203\001_\007\372\006X\377\241$ku>\221\177\017\334\273Q\027\336i\037\234\237\265\300&*\"\377O\376\372\256\336\251\346U\247\270\242\364\036:Q\322a\361\034k\373\247?\2570>>\376"
+	.string	"x2&fT\377B\244\235$\257\\z\\\325\205\242\270\311m\017\243k\236\250p\262]\214\3151\272\017!\206\367\006+\370\020\353\235\326=.\251\314\r\277\302\306\234?\361\0016\027\207\262\373\215g\200~<\300\307\013\2741\350y\274\361O=\237\202\365B\345\271\260wo\227\367\303\035\362\261\215m\316\270\327\246\325\356\030\3632\242\273\231\177\006\345_\022\257\316\374\237\232\243\204^\251z\367\333\204\354\374\340\367*\256\356"
+	.ascii	"\273%\332?\200:\350L\343\262m\202\220\367\343\305\034\360t\247"
+	.ascii	"\373\235d\002\316<>~\233\036\003\355c\341\247\230\220\314\256"
+	.ascii	"s\310\231\247\345\216a\376\243f<f\233z\246\201\345\271r\307a"
+	.ascii	"= \271\272z\322\347\366\020\033a\372\024\221M\236z\351\333Ap"
+	.ascii	"LW\373\033\271<\241p5\352=\267\372\310\320f*\017\362\025s\201"
+	.ascii	"\360-\350\313\243\363\027\034\376\366\374PP[\317\n]\240}\241"
+	.ascii	"$\363\327\031\177\235\225 x\215\355y\367"
+	.string	"\274\374\3623\347*\330$\262#\357\235\\=k\272]w\310\345\216\245\035\006`\327\310\201x\276_\210\315\264r\270yep\201\214\334)\023\231\342\354\266;\2209\006\220\036!\261w\356\363\334\335e\313\213\330\027&\261a\305\377%\270\036\340\347\036\306O\307\324\216\177B\372\324'\276y4\227\366\322\347\233\347F#\255_)?A\350\223\026\033%\345[&\373\271M\032\261\220\352\212\225~\264\274\007\351\017\n\333\200\277\273"
+	.ascii	"\257\324\016\353r\307\371\031\270\214\341\2479\360\034Sqe\217"
+	.ascii	"\204\337\004\351-J\332h\205\027\305{\305G\257\354\204\362VW\315"
+	.ascii	"\226\276TTNi\335 \304s\251\007\004\372ZyG\372\001W\fj\235\205"
+	.ascii	"\375\224\254M\320\334i\317C\314\253\321\267\327\372\034s\370"
+	.ascii	"\247\311l{\260\307S\333\035\327\324\374\310\177\365\245\002V"
+	.ascii	"/\316\362\200\322o\364_\270\367\303\361m\315\336.\333\317\341"
+	.ascii	"-\326\271\315\213c\231\034NM\372G\207S:\031\375\232\374\306^"
+	.ascii	":&\362\200[\260\177\335\007'\333\033\241\257\225]N\241&\262A"
+	.ascii	"\352\277\300\265,\271+\357\302\255)\243}A9\323\177\330'\225\256"
+	.ascii	"\376\037>8\260\373\003hX\377\370\303\023\253\\\313\215\r~W"
+	.text
+	.section	.gnu.lto_.symtab.fd969f62fdf04746,"e",@progbits
+	.string	"pgResetFn_gyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"firstArmingCalibrationWasStarted"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"gyroSensorBusByDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\003"
+	.string	""
+	.string	"gyroPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"getGyroDetectionFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"isGyroSensorCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"isGyroCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"gyroGetAccumulationAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"gyroReadSensorTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"gyroGetTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\003"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\003"
+	.string	""
+	.string	"gyroAbsRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"gyroReadRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"gyroConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\003"
+	.string	""
+	.string	"gyroConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\003"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\003"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\003"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\003"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\003"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\003"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\003"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\003"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\004"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\004"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\004"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\004"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\004"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\004"
+	.string	""
+	.string	"mpuGyroReadRegister"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fd969f62fdf04746,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
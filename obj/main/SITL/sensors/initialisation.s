@@ -0,0 +1,469 @@
+	.file	"initialisation.c"
+	.section	.gnu.lto_.profile.6217c5f4cb758af8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6217c5f4cb758af8,"e",@progbits
+	.string	"(\265/\375 0m\001"
+	.string	"d\002$"
+	.string	"\004"
+	.string	"\304\225\207\302\002"
+	.string	"\001\314\324\377\306\r\004\002"
+	.string	"\002\001\002\002\002\003\005\247\243\326\333\005\006\247\243\326\333\005"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.6217c5f4cb758af8,"e",@progbits
+	.string	"(\265/\375 \"\325"
+	.string	""
+	.string	"\220\026"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	"\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\271A6\200\005"
+	.text
+	.section	.gnu.lto_.inline.6217c5f4cb758af8,"e",@progbits
+	.string	"(\265/\375 \210\255\002"
+	.string	"\264\003|"
+	.string	"\002"
+	.string	""
+	.string	"\006\200\200\200\200\002h\001\201\200\200\200~d\002"
+	.string	""
+	.string	"\001\n"
+	.string	"\017\217\205\327\317\b\224\334\236\252\003d\003\f"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N\002\013\220N"
+	.string	"\002\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"O\004L\204\f\001d\262\032J\312\020\233\f\337|\032\246\360\033"
+	.ascii	"\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6217c5f4cb758af8,"e",@progbits
+	.string	"(\265/\375 _U\002"
+	.string	"\244\003S"
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	"\004\0036"
+	.string	"wus"
+	.string	""
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002x"
+	.string	"\001\002\006q\001\001\006q\001\177\001\377\001\001\002\006(\001"
+	.string	"\006(\001\377\001\377\377\377\017"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"<\005\f8\250\344\254\007.\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.6217c5f4cb758af8,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\230\004\001\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6217c5f4cb758af8,"e",@progbits
+	.string	"(\265/\375 .\r\001"
+	.string	"\270\""
+	.string	"\002"
+	.string	"\001\002\002\b"
+	.string	"\001\002\t\001"
+	.string	"\002\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	",A\200\2027\200\005"
+	.text
+	.section	.gnu.lto_.lto.6217c5f4cb758af8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sensorsPreInit.32.6217c5f4cb758af8,"e",@progbits
+	.string	"(\265/\375 \372e\006"
+	.string	"\022\213*3pi\323\001h\251\201\246\203\f\276\252\203`\361\030\301\330\335LH`\021\"\214\031\307\222\253\376\356LE\324\377\377\376]\270\025\363f7@\030\262o\315\312-S\227 9#\025\325\210\211\"\025e\204\225\316*\247\ne\2142P\242\025B\225O\315D!5'\205\317\326\313\232S\321\r\360\265\231"
+	.string	"X\b~\177\200\300[\354\021\256\273\330\3727\353q\302\277\214f\355w \016\022\256\333\340\302\242;\347a\341\377>\257~\211\t\301#\242\240\201\242\273!+l\265\257\372.\303:\260\314\332\327\270t\367\037\226\035\354y\377S\376[\376#\004\r"
+	.string	"3\001;8\243\306W\240\035\300\f\224"
+	.ascii	"\207\321l\314\205|\025l\277\214\033.\307\242\235d"
+	.text
+	.section	.gnu.lto_sensorsAutodetect.33.6217c5f4cb758af8,"e",@progbits
+	.string	"(\265/\375`K\001\345\016"
+	.string	"6\\fF\360\2226\035x\205\\\337\035\bVo7\267*\272\003b4@U\330/!\2460)\3365k\356\024\361h\366{z3a\243\006O\330j\267w\360\313\022%\202}}x\230\203\262!ZI\247;k\361\266~\322\244L)T"
+	.string	"M"
+	.string	"P"
+	.string	"\240\247D\222q5O&#x\244\016<s\202\3173\233(p\2618\362\2629;00\204\314\271\332\266\304\305c\253\242\177\325\261\026$z\220\345xL\304\0273\320\312\021\004@i\302\004\234P\220W]?\224%U\215\301\234\323J\226!\356\354\266#\330^`\177E4$}\335\204N\013\307.\312\027=\332\216\200pa\223cR\035kj\203-zR\333\263T\310\270Z\245\035\355UI\027e\037\233\033c?uk\230zW\255\252>\310\033\201\370x\355\217\325<\275\206LV\246#\305S\277}\333.\276\312\001\317l\n\025^v\264\356.\002\230\035\333\302g\\\370\314i:\361o.\003C\206\224\024\3173]P\315\216\031\r-\032c\206\205-\312v"
+	.string	"\375\332\"NO\232\304d\225\333t\2379\347\211_\363\027\034\374\023\317\274\342\351\311g\276\347y\366\335\362\306\025\033\270P\304\205\\\003\357\363\240\"bQ\311\310\353\302\020\330u\bua7\3526\360\363\300\021\007n\243.\264\262\211>p+)`\217\205\373\266\320\363\276\r\264\"\035\233\033\243-\013\013\031W\213\264%\023\320\335\323\374\206\003\305\231\223t\322~p\033\020\006\340\320x\r\t\023PP<\001\031"
+	.ascii	"2\241y)\360\372\037/2\001l\006\002\006\376\232\374\r\355K\265"
+	.ascii	"\026\300\030\022\3110@0\215\215\256\304\301\216\365\fQ\260\236"
+	.ascii	"\364\3054\342\302x5c7QD\203\212\030\356\262U\215N\321\324\036"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6217c5f4cb758af8,"e",@progbits
+	.string	"(\265/\375`c"
+	.string	"5\005"
+	.string	"4\007_\001"
+	.string	""
+	.string	""
+	.string	"\002 \177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002!\177\f\005&\r "
+	.string	""
+	.string	""
+	.string	"\005+\016*\005\037\017\201\204\005\036\020\001$\177\021\377\037"
+	.string	""
+	.string	"\200\200\200\001#\177\022\"\177\023)\177\024(\177\025'\177\026%\177\027\003"
+	.string	"\t$\003"
+	.string	"\bD\003"
+	.string	"\007d\003\001\r$\003\001\f\320\360\372\250\001\001\204\001\003\001\244\001\003\001\n\204\006"
+	.string	"\025"
+	.string	"W\207\226\264\262\002\203\200AZ\203X\254a\200z"
+	.string	"p"
+	.string	"p"
+	.string	"p"
+	.string	"p\370"
+	.string	"\351p\251\207\005\303\345\307\032\027\205\310\340\260J\213"
+	.ascii	"\r\227\235c"
+	.text
+	.section	.gnu.lto_.refs.6217c5f4cb758af8,"e",@progbits
+	.string	"(\265/\375 \023\231"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	"\002\003"
+	.string	""
+	.string	"\003\006"
+	.string	"\002\004\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6217c5f4cb758af8,"e",@progbits
+	.string	"(\265/\375`\252\026\255m"
+	.string	"\232\266@(S@\320:\352\"\222\031\350,\240\001D\223\340\320\310+`\034\375\237D\247H\031\352\305[\266\320X\353\371\036\027U\377\374\306\374\007\304Nv$\342\021\302\270\361\312\016\260?\262%\246\376\363o\276\013\332\253e \205l\353\003\250\202\341\016\200diH\333d\357\224R;\002t\002e\002\317\355\377\264\023\241\360H\314eg^\007Z54#\306\263)-[\2724\305\214i\301\n\003v\246\333\364Y\243\3515\235\326lZM\233u\232^6Z\227q\233\351&{\213\201\331\0026\246\311\262<\220C\327\027\034:\013\356\374\367\021\226l\253t\226f\032%\250a\254\255\230\203\270\321\332K3\2339\204\002+.\315\377\226Q\234@\321h]\246\263\340\202\3553\251\300\362T\004\002\372\001\322\301\352\261\346("
+	.string	"\312\315\376\220\342\214\\v \227\275\351\222A\237\302\202\030q\224\335\306\345V\273\334e\356\017\330\345\216rIT]\007\372\205\333a\315\245\227#\272\013wV\203\261M\330~\353E\334<a\022u\271G\244\347\332Z\217H\271u\334\036\257\376\220\266\225\276\322\313\020\215\205O\240\3403\230\365V;o\224\274i\303t\271C\244\275\326!RF\34127\225\020<\355\223\222\224\243\314=\245\277t\300\310\310\250\034\345\306b\016\352\257\266\241\225\315\334Bg\340j\376\277\224\366\352e\177u\024\356\033\272\213\321\226\037`\016\342\376j\255\346\002a\343\037\351\003"
+	.ascii	"/`\264\272\240\375\267@?@"
+	.string	"'\321\013\023\252\024\355\357\017iO{H\331\305m'\275\325K\022\r\205\273Ic1\316\260}\345\177\313\203\023\346L\217-G\031\203\313\375\204\r\310z\024\\\300\345&\221\3624\211\224u.\332J\346^\322-w\371\361\177\370\377\003x\0273\037h\216vV\0207\023\017i\321\330>\317\351e\005I\315Q\367\313\314\376\220vh\017\251\210\376p\305\334UmE\342$&\035\177\353\277\365\331I\013s\224\304Qn\373Cz\333C\312\3349Z\206\220 \314\254\206\271\245\242x \231\271\013\bs\227pd\356%f\006\301\314#f0\263\001\314~f\204\037\2342;\030\346\366\301\334P\314md\356'\346Nb\356\033\314Mdn$\346>b\356\023\230\333\004\346\246\301\334?\346.bf(\314-\002s\363\230[\307\334C\314\r\0023\267a\346)\314,\205\231\255\230\371\207\231\301\230\371\\[[[c\356\036f\224\0063"
+	.ascii	">\001\316d\327\342`n\304\234\213k\325`\246\351b\336\305\261\004"
+	.ascii	"'({*\362t%\311,\311A\331\246v\331\226\346\262\315\354\262m\314"
+	.ascii	"e[\226\313^\355!\265a\261Q\271W~\320'?\244\206K\237\342E\267"
+	.ascii	"\001\304\021\021\225\262\244\335(=\n\232\033\232\255%\251\231"
+	.ascii	"8\333\377\361I\025\377r/\277\301\273\234\212Kq+\275\364)\376"
+	.ascii	"\354Y\316\204\177\254|\212+m5{-J\277!r\251\3405\244\226I\267"
+	.ascii	"1\305ox\215\2341I2\236\265\027\206X\001\200Bq\256\245X\261\211"
+	.ascii	"\032\025\240,w\234\200\355\020>a_vP\203\244\266t\324\267\316"
+	.ascii	".n\204\b\235\354`%\305Xq\302\256\345SKSi\270\2127i\027\256\004"
+	.ascii	"]p\224mG\227\321\264\213\266[\355!m\235\354J\207V\016\367\312"
+	.ascii	"\261z\351K<\007\373\2223\361\317\022or\034M\2671\315%\376\344"
+	.ascii	"U\3154\366\374\260\314M\023\b\250\265\254\2749K\321\027<I\231"
+	.ascii	"d\r\256\304\255z\351U\354U\256\303\217\270\240\317\277\020\265"
+	.ascii	"d\225\003q\"\270a\373N\251\231\177 \002\200\200t\222\202\364"
+	.ascii	"\b^t\006\247\241\227\236\304eH:\222f\032\333w\302A9~qBK\3420"
+	.ascii	"\370\024\210#b\006T\310\232w\n\021*.x"
+	.string	"Ard\307F\327\0211T\036CN\016#\223J\225K\305KT)\200qq\016n\204\313\320\"[\236\256\234\\F\333\313\250\325u\"\216\364\026\232\271\305\202KY\363\377]\360\"\275t\">d\013\313\211\270Q\213\231&n\352H\325U\2122\232\274(\rC'a\216z\224K\365\322\205x\220\337\331)\353Q\005\211\243\214\n\271%\334\270J\312\350\217\313(\217\313\314\356\303\177\364\322\217\336\343\247\375\347::\013\016\005\342\210\330\302\007\033?\272Qg*\371\305\351\007\b\350&%e\t\221\024\345\263y\231\035\212y\234,\020\243\250\265\266+F1\030vx\016\03527\276l\314\345\323\313\345\023\313\345\263\353\362\311\304W\340q\202\304J\242\304\235\030\315:\356\234\302\247\260.G\371\244\272|\022\271\375s\002\271|\032/\237L\227O\342\025\261\346H\303\030\256\2169\314n\n\303K\004Y\244\310\021\373\220\313:\374\203"
+	.ascii	"\261T\244\312QN\343Bf\306\311Q\3434$\315\205\036l2/bh\216.=\350"
+	.ascii	"\001'\323E&%\341\260V\343\351D\323\203\250\304Q\276O7n\370Yg"
+	.ascii	"=SPr\255\231\004\227"
+	.string	"TEV\034s\231x\022\375\354\347x\226yC\202\347\nj\fX\330\345s\330'\022\322\031\344\363_\310%y\233\022\222\241\342:\203}\036-\317\2433\330\355\007\323\"\315\242\221\201\234?\262$\306\352\236A\277\3150\"\3478e\354\f2\237\337b\235%\204v\272\202\234r\324\326\036\322n\022\304\276\206J\251a\212\301\r\367\322\335x\231g}\220%{*\246b\302\302H\371\321\246\227\336\306\313\240Y\037\234\240\253\306\023\332\277\221\201k\304A\312\f\216\362m\007\0324\2366\305\304\241\341H\020%i\276\006\207\352HT\222\243\276\306]\215\243\261\257\3614\035\206\255\257A\377\205\335\007\340\272\017\260U\201A\310$E\371\206\343\362Mx\331\315x\223\335\214\315\374\354\376\177G)\252a\203\366F#\t\364\215\226\nN\234\206\375\314\366\005\211\221\345\r\227\331\231\323\027\026\377\337\311\326~\361\250\003\267\255\233\004\363N\237\215"
+	.ascii	"3\243\377\314!.h?(\006\r\232{\244K\310\203E<\333\230\377Cd\220"
+	.ascii	"\002d\323\020\251"
+	.string	"\203\250D~ph$\350S|d\220\250\374\367\371\3410\310\342\370>D\3457}\n_\232\372[d\360\207\307\367\371\341\013E\020\207\310&\242R\330\344CT\"\233^\211\374\236\037\n\2136\206_\364y%\322\354\225\307\246\036\242\362\330DT\"\241:\214xfKS\0304QQ\272\2118\374%%(a\261\207Il\217?\366\337[H_D\340\037\352X\034\023\352h\257#\346\322\021\227\360\330\004(\035E\035\177\310$\"9\376#9\032\372\207 \3302\337\205f\006\245\240>\t\351\277\200o\377\225\376\203\375\314\377\017\376\377\255\b\325\376\357\350!&\225\224\376\215?J\017\025\374B\372\367-2^MDe\3241\350KK\231\374\032m\260\223?\206,^e\320\206O:s\223M+\2349\3529\234E\263#^t\\'\303I%\225u\025\3110\026\233\225\2260\313,\334K\317\342c'\361\376\020K\255\371od"
+	.string	"\365\252\032R9*&\307\330\004I\016G9\265q}\213\227\264d\033\346Z8\234\177$Z\030\007\3438\370\227^\272X,\257\327b\210H\335\355t\b\354v\272\233\216\232c\221\243\303C%B\254:\243\"\337\016\267\252\300\021\324_\317\013!\225\207\273\233mE*\273\322x!"
+	.ascii	"J\344\363Y\220\263\261;\225U\205|,\260\002\037V\200\345\365Z"
+	.ascii	"\250?\0278\336\361~jO\225q\031\202"
+	.ascii	"\024\r\244\210\240\204\033G\240\302\001\025\016\244\034\201\212"
+	.ascii	"\240 \025)\202.\247\b:YV\375\001]\254\271t\206*t\262D\025\370"
+	.ascii	"~:\013n\352\017\310\352~\252Q\221\352\001\312\362P\211\005V\004"
+	.ascii	"pSY\035\021pG\244\333\341\260k\216g\364\"\206\312\"\327\302\305"
+	.ascii	"\013\035u\327\323\261k\217w\331\\\007-\320\036\317Eo\335\245"
+	.ascii	"<\243\365\\s+N\264\320Yq\242\005N\272;\301;y\250\304\nTg\360"
+	.ascii	"~B\004\254\271\rz~*\273\352\212\322\233:CG\364\002hTt\201\271"
+	.ascii	"\273\346X\254@\030:jN5\242\341\301\n\204\201s\233\241\n\255@"
+	.ascii	"\030)\013\2744tD\252P\316\bxY\366\247c\327\373c]\354z\300\013"
+	.ascii	"\214:Xs3T\0268F\300\034\253\312Hy\250\204\001kN\006/F\317\267"
+	.ascii	"\342\247\262j\221jD\203]\2010x\330\234\f\235\007>\336\255\267"
+	.ascii	"\356r<\243\265\203\272\343\315P\205x\326U\375\t\t\351r\273\023"
+	.ascii	"<\365\247#A\350\247\033\332a{@\337.\247\022\031\025\351V\237"
+	.ascii	"\030FD9u\345\371z86\227\"\210H\235\221\213\261\323as\021\334"
+	.ascii	"v=\032kN\025\301\367cu0zx\250D\001\3543R\177&X\237\357gBg\315"
+	.ascii	"\245l\356\304\003l\217\007\274\034\024\264B\304\007\034`pw%z"
+	.string	">\036\253[yD:\036\313\353\361L\254?\337\332SW\023=\236\256\310\304\356\267\232(\221\200Z\304c\215|>\rXU\306O\307\342b\254`Q\201\357GC\306m\301\307$\270\201\266%\344I,\212\361\207\243-O\007&\246\"G\2512(\261/\257(\250\261c\220$d\231\017\266\256\2548\n$\315\202\263\244 G\366\263',\f\211r\324\207\017O\3739\236`\2105\236\320$K&[\314v\3548\241P\004\205X\335!gp\310\300\203O\250\2354M\230X\315\225raRc\243e4z\332q\255\231\244\241\004\333\020kXZ:\237~\216'\231\265\016\310\324`s\346\340\363\t\207\304\310\227\225\243\247\323\211\303\246\265\024\245u\3428W\310\371\342\222\301\354\312\016\0302%\342\331\224\003\205\245\304\214\243g\021eCU\274\202!\201\305\250\2014\250\0244#2\"\"\232$\311r\021\005\204 \352 \274z\021"
+	.string	"-\244hjD\222$)5\006rL\253\001\007q\203\350L\2731\366*\262\tl\024\315\027\307b\260\347\237\177\034\245pO\304#\363q/\251\004\243\330\024\255\320\022^\013\3236\234\335\fo\264\177"
+	.string	"\244\237\263<xv\235\207\t\343\302:(\032\300\306\0243\313\304\3441\313\237:\300X\346\211H\220\020>\275O \302\0077\267\230\243\207\036\250y\242\314\264\225|\334\tQ>\024pv|"
+	.string	"$C\302\217\312\235\016\247\017\327\233d\327cI\346\223\307\034\363\242<"
+	.ascii	"\330\341v\220D\315\001\214\224c\207$\336\004\255\2372\2430\200"
+	.ascii	"1\361\255\303\004\\\354\216o)\355\312D\347\023\t\345\272\314"
+	.ascii	"\302oB\327\036\357\036\r\t\312X"
+	.string	"O\332\305l\275h\t\332e\020F\035\250\347\254\370\300l\306,\207\317\215<\211&\266\353\354\215\324\001KD~\250n\315\312h\030\274\236|\261\373\363G\377\002\247`z\366\213A\377\002\242\026r\321Mz\366\021\205\032\225\276\320\320\3267~\334\016\343\321\221\027\003\223;\224\346o\362/\025\320\272\rK}O\001v8\212\024\035\215e\343\230\361pc\224\260\3156\374\232I\371\203o\026\254Z\217w\277\362\017{\312\034]r\3342\301\314\"N'x\343\227\211v\327{\264\360\240\361\036\004_$\263\275\312\317\331\233\353\201_\301\2213\271\272\250\336\320b\306\245\321\241\021\345\177\002);\275C\307\004\006\371\247p\016\211\325,d\270\3649\223Z\332\320\274\327\323\260\007jN\365\336\267_i\373W\376\002~K\241\245\345\224\202\323s\301\001\023\242)\243^\321\211\\\022#\002O`\320?V\265v\036\300i\\|\037]\325v"
+	.string	"r96!\277\220\342\335m\371H\324\360\232#\314?3\221\033\177\255\250\"\341\205\253Ck\362:\266\331\025\262\370\t\224=\016[\005\034@\230\030\254&\276\321\230\n\030'\331\242\021g\227#&\001t\020\235w\001wn\236\301\\8\370C\320\312Y$\275}\270\005\225\203\263\306;4\256\276\005I\305\023\356\224\321\372\240\227\301CC\240\222\f\317\221\253\001\350\016\023\266\342U\031]C\300\005\244\2527\241m\227\342!"
+	.ascii	"\331\277\212\001\237,K\021m\372q{\003"
+	.string	"\031\321vfK\177e\036Y\243$Ldm\315\240B\027\001\021>\352se$\254\252_\315R\005\3257 ;r\372\034\036M\263\016f\262\006\326\210\257\024\225\022\333b[\b\265z\222\254\376\013\206\034@t\317\302]\363'Q\346}X\355crF2\303%\006B \352\270\006\002,\256\267\232\002B\360\214\260\024\t\032r\337\203\007bSN(\230\275X:\223\2556S\\n\351\362\310-`\303\3046\205`\203\321T\026.q\243N(\252@m\021\357\033_\006B?\321\251\227;F\231$\3064R\313\202\301\213\255\027?$B\270\365\020\377\341\264[\r\270\b\301\262Gj\026\017\324\376??d\036\312\251\266\226\2057\260\310\007h\263\006\234\320\317F\251\001\025\323\265\331c\032\220\263\037;g h>\277M\033_\236n\354\236$v\317\261\216\301\204\342-\002\320.\312\3638!\242\335-\347\213\324xN\303\237\n\034"
+	.string	"\345\362&\221"
+	.ascii	"\220\372\217M\f\341\343\215\250\375\230\306\331f\353j\027\257"
+	.ascii	"/\317\306\347\016}\025\300\211\215=\326\034Z\364e\335\235\231"
+	.ascii	"s\326+\3704]\005"
+	.text
+	.section	.gnu.lto_.symtab.6217c5f4cb758af8,"e",@progbits
+	.string	"sensorsPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"requestedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"baroPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"compassPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"gyroPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6217c5f4cb758af8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,821 @@
+	.file	"voltage.c"
+	.section	.gnu.lto_.profile.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375 \353=\005"
+	.string	"4\b\337"
+	.string	"\025"
+	.string	"\217\211\332\324\013\004\002"
+	.string	"\001\216\235\241\221\t\002\231\331\257\376\003\b\002\001\002\001\002\002\002\003\003\240\342\234\212\n\004\314\341\206\214\004\004\002\002\003\005\371\265\336\203\t"
+	.string	"\006\241\355\342\223\n\004\001\002\001\007\333\326\241\250\n\b\207\216\227\262\004\002\002\004\002\005\n\274\205\242\255\006"
+	.string	"\013\f\357\313\212\236\006\r\016\244\310\245\335\004\017\314\251\277\367\n\020\374\322\374l\021\022\023\242\302\263\302\013\024\025\225\254\310\321\004"
+	.string	"\r"
+	.ascii	"@\211\245\356ZLKA\265:C^,\350R5\204\"L\331)\001y\336\177\205"
+	.ascii	"\260\334@\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375 k-\002"
+	.string	"\204\002_"
+	.string	"\f"
+	.string	"\001\001\002\004\005\003\006"
+	.string	"\001\007\002\001\b"
+	.string	"\001\001\n"
+	.string	"\001\013"
+	.string	"\001\f\001\r\016\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\f"
+	.string	"\270"
+	.ascii	" \240\3120p\242\247q\250\032q\352\025\020\007\006S\231\366\022"
+	.ascii	"\334\006\332"
+	.text
+	.section	.gnu.lto_.inline.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375`E\001\025\007"
+	.ascii	"\262\313\"(\220'I\007\227\352U\305=,\337\276P\003\235\347f\310"
+	.ascii	"u\313G\326h\273\353\302f\306=\022\266\265\326\b!\244\221-w\n"
+	.ascii	"\3174\367\371\244_u\325@\037\032\214E\0078\376\325k\270\325\204"
+	.ascii	"\037\271\003\264\2120~\212.\032\f\2065bQ\022\344\357\307g\232"
+	.ascii	"\345\3144\247`\001\322G\003t\310\314\200\325\377\231\365\340"
+	.ascii	"\257\024]'\244\220\231\013\237\030~\020\264=>\352\031\366t/k"
+	.ascii	"f&\372DU\177\324\373\276\004\266\326Zz\345\n\004% \260\"\261"
+	.ascii	"\232\036Z\t\002H\321\220\b\320\212J\266\260\356\024yrD2'R\214"
+	.ascii	".\320|s7\304\206\356p\r\240x\265\327,\254\033B\252\245\210\267"
+	.ascii	"F\343\202\320\333\025-\302\331\207}9\261\t\371n\355\234\t\\O"
+	.ascii	";\033]7\314\326P!_\035Z\001\206"
+	.text
+	.section	.gnu.lto_.jmpfuncs.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"}\005"
+	.string	"\342\311 *pi\222\016F}*\305\213\327\257W\032\003\n\n\300\003\320\370.\326)\262\240\252\006\252hm\375\333\331\177z\373[#m\023\231d$\257\177\326\324S8\032\251\307\224\353\273H\006\271Xk>\250\222G\356\013\2570%3P\222r\330"
+	.string	"\242\001z\310I\024I\020<\317"
+	.string	"\244v;\352\035\325)P\203l\203&G8\241\302\017\b\020\320\013^lF\250\227dd\223zM\357\361eH\305,\226\252z\351\2718\021\021"
+	.ascii	"G\220\003\332\270\242f\0028A\263\235\234\357\300]'0y\202\341"
+	.ascii	"\241\242\300\305C\260 \r\021\34020M\345\312\r\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\232\004\002\232\004\004\232\004\005\200\004\006\232\004\007"
+	.ascii	"\232\004\b\270\004\n\200\004\013\200\004\f\232\004\r\232\004"
+	.ascii	"\016\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"\265\003"
+	.string	"\322D\017\030\260'\035\200$y\r\311\270B\252\026\350j8\322\210\261m\223&M\312\024#\211r\004?[U\"\333\002X\030\256r\370\216\250U\350\335\371[\317\271Q\256\232\312>cO6\234\030=O\027"
+	.string	" $f\031L\254\030\210i\007\006\203A\300\001\313J\220\257\202T\016\240\275Y"
+	.string	"-\002\0063<$J\210\236\022\354J\027(\003;;v\016\326e\3662\362"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.447f1b46bfabdebc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_voltageMeterSourceNames.22.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\bU"
+	.string	""
+	.string	""
+	.string	";"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\264\001}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\370\257\005}\276'6\206\b{\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004ESC"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\004"
+	.string	"U\245\366iu\200\332o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_voltageMeterReset.25.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\205\b"
+	.string	"f\320;6@\223\032\003\030oj/0\364\026\323J$\324\036\212\236\311\2532\327\f\265\t\326^@\371\215vp\333\036\3354\\\006\004\206\252^\345\317\337\177\003\357d\254$R\246\024)"
+	.string	","
+	.string	","
+	.string	"\231e\275\366\305\337\352n}d\270`\377g\354\260g\350\325&q"
+	.string	"*e2\004h\370_\210Jm\270\321m\021\332.\264u\t\252\326,\033\312,\246\305\200\346\327\210\325\374%S@:m\r[\213x\3043\253\344\201_\265r\362\177\nM\340X\366sAf\3111A-\267\023vI\030\226\020\223\262\266\302&$\316\177\206\272\304\342B`\345aY\2272K\211\242\002\2339\301X\373\231`\344h\275\371\377\306\2346\322B\262 \217\366\360\031El\024\263\343\266N\244uS\004\361\tM\020\327M\317A7\t\215\233\243m\343f\347\2737\217\252:\310\274N\021\243\016\013"
+	.string	"2\241!\034\030.XIQ\362)\262!cY\301\274K"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_getVoltageMeterADC.27.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"\035\t"
+	.string	"\306Q@80\221\322\001#T\234\207\207\033(f\022GX\235\213\334\305\361\373\240\262Cg\250\326p\363Jk\003F\316\345e\263a`\240\020\205\330\255Y)%\340A\233\263\3266\221;\245/"
+	.string	"0"
+	.string	"."
+	.string	"-P\207l\245R\263\033N\207\017\340\\z\016\300\271\324\217\177\217\237\377\222k\".\032\220\225z\3548\354\256#\310j\335z\333\007\266\025l\313\004Q\243/;.0\0043\273\0333\233}\221,!\266Q\366\307\266F{\201\001\365\030\206u\327%[\331\r\023\214\340\271\264\355\217\234\004\345O \204\005\3168\n\205\001lw\033L~\342\371 \227\2568\305\203\227\376I\037\003rD\275j-\253\033U\234\331a*\252\207}m\365e;Z\037\373\003\027\333C\211$=\nm\020\"S\004g1\275\216\363J\2337K$\221\304\034u\336\f\r\230\233\330\272i\342\270n~\302\275\266\372\262\026\250T\303~\312\007\202\201v\013"
+	.ascii	"D\023Z'\306\345#\251\232Pl\202u^h/\241\272&RbA\240:D4]\363\t"
+	.text
+	.section	.gnu.lto_voltageSensorADCConfig_Registry.31.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375 \230]\004"
+	.string	"\324\007a"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\303\374\321\033\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\345\030us\350\355\007uq"
+	.string	"\005\001\006'\001\003\202\002?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004"
+	.ascii	")\"\301$:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_voltageSensorADCConfig.32.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375`'\001\225\r"
+	.string	"\346\031\\C\020\221\223\016|\272\260/\360P\251\004\221v\360j\2663\310\327"
+	.string	".\306\256\367\003\203\t\005\3758\351/\302Z\214:\030\330 \230\\)\306PUU\272r\335n<\004\223\241\202\1778\274\332q\251\265\275\245L)G"
+	.string	"H"
+	.string	"H"
+	.string	"3\356\241\354\277\034\032R7v\367\322\020\376\241w\303\334\036\241\346\346kBX~"
+	.string	"\005\206\353H\217\220\263\273"
+	.string	":\f\220\223\246n$\241\b\223\353[\236\340\204\006\327\231<5!\273\353\344\272\016w\346\2663\333\f\354k\001\273%+\035\353\022W\250d\376\263\237\272\347\267x\363h\227\270\211\355\237YX$\016\226\352\333Qcw;\217^`=r\3407i\177\304Il_\271@ \300\222|\033T\354z\n\374a=\332\373\200\314\243u\001\231Gov\273PQ\252\243\020\201O\371\211\n\022\362\005\306n\206s\217\276\312\202\210\237\342S\310<\"x1\201(\345\312Q\257O\275A\213\223\030\316F)W\252\212\262=R\352iwI\326\223\375\225?\376\273\363\351k<<\2740"
+	.string	"\023\241\203>\"\317H\023\205,\177@@\016<\243\007\330\204K\3130M\004\322.Q\310\003\341\372d\332\005R\300X\004Pv\2150,\2736\336^Of\271\225\342\203KIG\034\025e\215\013\375\270\312H\223mw\236\252R\022\363\305 I\034\207\273\001\031"
+	.ascii	"2\003\376\031\322\340E?\256\304\212S\267q\272\b\316$s!\314b\\"
+	.ascii	"3\346G\224(.\013\241=U-\007rV\035\313\332\002MX%\020\0277D\224"
+	.ascii	"\rv\332\333s\300\237\224;\327|\002"
+	.text
+	.section	.gnu.lto_voltageMeterADCRefresh.35.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375`&\001\325\f"
+	.string	"VWUB"
+	.string	"Q5\035\200\302\320\262;:\030\250ZUp\204\b\352\246\t\037\375\0212\304\034\002\030A?x\342\267p\003\n\325\230\217\221 \231h\342n\b"
+	.string	""
+	.string	"(\221\336fth\313\362;\325\352\313\301O\233\354\235R@"
+	.string	"@"
+	.string	"G"
+	.string	"\037G\354IW\006\262\334]\216\212\2606\301W\215N\320w}\242p\214^5\313\356\006\b1h\226SX\232\232\211\324\351a\237\0350d\036\2630\365)Y\260\273\236\246\020uo\267\375\300v\001\373\245%\bi\216PJW\3668\232swG\246*\373\342\375\255A\253\264q\361\330\3250\"\2621j\007\353\342\355\307\376\362a\246\274\0328"
+	.string	"^\024M\266%\231\221\342\307\356xy5f\362z\212A\233F,\0207d\314\2700s\\\333\335\325|\362\266\347-@\225\016\037X\254"
+	.string	"\020\002\344\204}\320fwW\001\252p\020A`\033s\331\007n(=\274v7\001\212\247\220\340\227x5\205\n\363\246W\337\302\366\372\330\t\220j\004\235{\223\3418\320\204 t\023\270\317\353\276\017\347\343>\035\215\207\333x\037\227\031\340.\002\307\343B]\347q\224qOU\2563x\321\n\371 \321\222+]Y\201\013\372\213\266Jb~\366\323\223-\332N\017\273\200\220\033"
+	.string	"2\003\006j\214\250\303\213\232j\212\212"
+	.ascii	"\001sLx`0@\004\021B4\201\2513e\315fx0\213\201\271s\271\24732"
+	.ascii	"U;&%\343\345\212 3\334N`\264\253\302\357\231uPD^\327|\002"
+	.text
+	.section	.gnu.lto_voltageMeterADCRead.36.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375`\r\001m\f"
+	.string	"f\226RC"
+	.string	"q\234\016@\300d\274\341\244P\222\222\233\351\360v n\3110\312PL\022\034\330_\fO\362\277Tp.)\212\233 >J\tUUA\301H\377\230\227l\022\216)\035\321A7\335\212J\035\271\355\336)\005<"
+	.string	";"
+	.string	"E"
+	.string	"\330n\206\026+v\313"
+	.string	"\006p\275\232|\304z\245<\304z\365h\313x\311a_\212A\241dcw3\272\341\343\347\350\237t\214\364p>9\n\354\256'\351\261p\323\333>\261}\261\217!\032\354SvwM?\366G\177\275\350\247tz\322\351_\225\032.,\250\335\n\253\324\236\252\251\203\355Wl\317\362\"\306\2176$ ;\201ta\300\365\352\362\372\264\017\342!\306\213\"8&\225\207\024(&\305L\252\017\2476\346'\272\353&\304\214\b\f\320\306z\245/\310\031V\360\022\035\026J\t\260\r\341$\276\217\020\212@\351#\030\370\240W\207\r\346\311\007\326\353)\026J\335\020u\346\312.9\223\006 'r\007<4\234\347i\t.\033\002\255\303\233\205\303h\242\346s\220\205\340\027z\\\230y\031\255\31360\314,%\376\026p`&~\037\230U\312=e\351\307\006P\247\016\225\340I\355\355,(\r\356*:,\032"
+	.ascii	"\2263\241\214\351\3043\f\267\352\030h\003/\002M\240\273i\310"
+	.ascii	"\362\0069M\2572\226]\250\306\215\320\\f\235\373\226\265\331\312"
+	.ascii	"\360\2265\027\336b\230\027\204\337\324\024\270\027LM\001wy\321"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_voltageMeterADCInit.37.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375`\237\001\235\017"
+	.string	"\246\035gE\360\222(\035R\027\256\224\306\342\035+\240{\035 \325*jW#\237\034\321/P\030`\327\252\361X\372\350\377z\032\271\302*i\001\364\353\027\340A\3406\021\332\236\367F4\272\212\2707t\n9b-\331[\312\224\002R"
+	.string	"N"
+	.string	"V"
+	.string	"-d\337\315nL\344\321\006:\217\367\370d\337x\214\304^\346CE\246cw9\035a\230\247G\250y\3629$2\037\220\342\363Z\250G\370\331\335\220V\n\374\344JK\225\020\005\313\365\257\027\210\371\274\026\313\223C\262\273N\257\365\341\336n\333\202\355\003v:&\276\211Gw\032\362\336\243]\332\220\367|\330\337a\326Rc)JUa\354\230*swQ\326\027\373\256{\203\351\b\323\020\246U\323\231\351\203\204\200\230\301\345\330\365\360\365\330Z\214\021s\327\355\303\256\302\177\331\363\230`\301\351.SgOp\002v\004\t"
+	.string	"\322\264\273\324\230\2119\370>\034\366\004\ny/\352'EQV5\355\"\334Y\355\246\b@=\313F\225\237SU\357\202usM\275\312\017\273\302Y\200:\273+\006~\315W\204D\243\217\266\307\253\002\227\232\035\257T~\366$\310-c\023\271Os\001\301g\002%whD4\002\241`\3508p%RW:\021\225\270\223\022\220\t\027\"\225\270\021\001\3562\210H\034J\327\2218O,u}\221yg\026\242\226R\225\243\302\270\201\215\376\246-\226\310\303\370\246+\276i\333\024\326\362\321\320X%\217C\350"
+	.ascii	"\031\325\177\361\340\263\323 \300\333\306\366\030# P\202B\207"
+	.ascii	"\332\001b\300\317\030P\003\341i1\024%\236\270\212\035\227 \030"
+	.ascii	"\002!\t\007\357h7\247\307\372J\346\234\245%S\003\364d\207\335"
+	.ascii	"]r\2550\3162\256\334\360`\305:\327\374\203jd\326\216Ie\334WD"
+	.ascii	"fh\225\205e\355(\017\"\235K<\001"
+	.text
+	.section	.gnu.lto_voltageMeterESCInit.38.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375 \302E\005"
+	.string	"\262I$-pU\323\001\032\345^?\003~\r\035p\277k\260T\025\216\021\023\250\221Q\333\251_\247b\233PU\261Z\034e\332\037\334%\344\026\355-S\266\250\253Qe\2209\221\225\316\212]Ub\217*\"-Z%u\360\224\\TfsR9}\337\350!(\261b\177\033\214\031{\005\377\357\350\331\320 @Z\210\376\313@\300G\203\020\307\366N\326\354\322~\233/\250c\371"
+	.string	"\374\227Q\263\332B\315\273\236-p\335\266\220\300\370o\310u\230u\\\333\t\333\n\333\216\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_voltageMeterESCRefresh.39.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375 \302=\005"
+	.string	"r\211#+pm:\240{\375l\201#.\300\232\350@S\303\325\201\375\330\274\250\355\224\255\314\331\335\375\377\316\253\234y{\361T\336\217ho\231\002\277*\271\2602\307\214p\245\263b\2622\326\260\036|\321\312U\341\023\")gsR\246\276\336\350\031$q\362\177\033\214\227\177\001\035\275\037\0226\243D\250\273r2\265("
+	.string	"\322\374_\352\332O\332/\323\353\371P:\245\356\346\210Ym\241\366]\316\016\270n[(Pt\367!\327Y\366q\377\037\376#\3763\002\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadMotor.40.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\265\n"
+	.string	"f\324JB \347(\035\220\305\021\264o"
+	.string	"\300\024"
+	.string	"\007\t\016\256\317\311N\210\353\001D\303\256\260\001\373aU\274\250i\274?:>\201\030[\356\221\333\020\200,@)\265\"\n\3421\f\0069\213\2418\177\260#\331)\0056"
+	.string	"6"
+	.string	"8"
+	.string	"o\231x\333M\0250\260KRxbs\352\321NpR\265\207\305R\002\320v\327\333`>~\216\376]O8\241N>\0214v\327\363\204j\271\267\333\216\260\335\261/\021,\265\006\213\200\036\230\261}\377\365rt"
+	.string	"\356\230\261v\267;\265Gvw\372\316\3666\355\323\274f<Iz`X\224\227\n\006y\007\356t\363\006\356\324s\332\025\026c\365\004\250,\306z\310\275\364\310a\341\202jw/|\001%\"?\346\324'q\247/?eVZ\251\326\2544k6i\232\333\213\375\203\335\\\354\223\377\244\343\212&\313P\260\033\340'~\033\n\340\347\001\022q\200U\254\240\316\037\316\367\341\021C*\211\027\2025\f}\241\027\002\361\200\274\017\030z\034\bW\221\017\364\304ZA\257#Kw\275S[1XP\332L\376\200\277t\017"
+	.ascii	"\2473\241L\2130\334GX\023\023\260\243&\t\2510t\r\237\320\304"
+	.ascii	"\0034\032*\334\006s\277T<p\347\026\355|\002"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadCombined.41.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\235\t"
+	.string	"\206RC< \005)\035`\305\330q\004\034T\017A\260\320&\272ui"
+	.string	"\034\326X\253$J(\232\353Wl\267\254V\202@\256\321\310$\240P\360\270\255\t\367\032\202 \240\317bHZe3\262S\n0"
+	.string	"0"
+	.string	"1"
+	.string	"W\330>=O\330>-\3325\257\253\275K"
+	.string	"\220\230\316\356R\355\344\342\245\350\377\365\001T\352\343R@bw-Q\251\221[\273m\006\333\020\366\r\0023\0219\273\"3"
+	.string	"+3aT|\226\217\244WW\300X\273\313}\332$\233\373<g\373\322~\353+\342]\245\037\354\252hd\273\325\301\r\236O\327\254\217\266\217\336xlT\260\332\335\007\037\346\321\341\243|\372\245\355\363\343eJH\253\244\205c\2223\273\236\244fb?`w\327\232\312\276\353\227\023\201$_\027v\024\004\016}:\013P\210\341qP\360\363@Q\007R\321\005(\203\206>\220~\026\354it\037\r=\357\243\\5\375\365\211\224l\307\306\244\235\374\226\1774\370\227y\023\023\r"
+	.string	"s\311\"\3236\030\351#"
+	.ascii	"\211\t\330Q\223\204T\030\326e\036S\241\001\025\255Y]\001\327"
+	.ascii	"\362B\230d"
+	.text
+	.section	.gnu.lto_voltageMeterRead.43.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375`+\001\325\r"
+	.string	"6\332^E"
+	.string	"\223\223\016S-;&e\223\315Mi\351\333y'\342\254Y\241\351*\366;\343\004r!\305\317\330\266\336\276\366\243\bVu+\371T!\0304\350\256\252j\360\252\277\247S!\245R\262\205f2N\"\331{\357\224\002K"
+	.string	"E"
+	.string	"L"
+	.string	"\233\235\3435f\337\302\343`\343cwi\204\371\366)#\334|\323\013\004\021\245N\034\313\347\277\213\240L\251\023\347ri\271<J\005\035*\304"
+	.string	"\256E\216\340\230\300q\323a\007N\004a\310\203\3355\034q \356\352\266#\330n`\237\013:{3g\310\330\276o\363/\345,l"
+	.string	"\306F\347\355\356\365i\247\330\327\347/\333\260\276f{I\345\"\273/:\324\372t\265\016\355{\237\331N\263b"
+	.string	"\273%h\304\330\255\f\274\300\372D\360\221\352S\236@\365\351\325\347\277\303\024\036\274\316\343\021\202;PF\017\034\022\262\2021\332\0304\300\217,#\313U\214\272\233\030I\016\360\225\352\361%\231\232\035\251\033-\020\210]E0\222\354\313\335]\307\027\373\245?\236\346\277\225 \247\023qb&\326\250\373a'\032\006\302<S\302\t\264\t\t6\241\004T!\313@?Z\366A\301>\024\345\244\304CM\264\017%9\340\314\002\246QP\226i\364\252\241\233\016aD\375\221\023\212\242\031I/\376\317\024\016c\352@\255xV\375\263\347.2\0011\273\353\300?m\270\340\243P\t\030"
+	.string	"2\003\302p\323\204\365\t\250\364;\236\306\342GM\202T\034\313\306"
+	.ascii	"h\260PR\213\272\030g\257\271\314Fh`1\334\013\354oj\n\334\013"
+	.ascii	"\246\246\214\273\031\314\244y)\215A\355\001"
+	.text
+	.section	.gnu.lto__reset_template_126.0.44.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375 /M\001"
+	.string	"\370\""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\n\356"
+	.string	"?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.string	"\003"
+	.ascii	"@D\312-\003(\002"
+	.text
+	.section	.gnu.lto_voltageMeterRead.part.0.53.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375`\324\001]\020"
+	.string	"f\235hG\360\262&\035\242\203*r\r\313\b\027\316R\302\251\031\325\327\376\244\336\235aX"
+	.string	"\330\022[\313\356\3417D\336zDSQ\363M\352\210\362\216\320\246\204A\315\200\225\377\210\266\"\257\325x<wh\033H\325\026\311&r\247\024Q"
+	.string	"S"
+	.string	"T"
+	.string	"\255\031\317\256\270\340\323\nB\237\026/`\373\f=\300\366i\377\205m\325\213C\333\307\305\025\373\235\032\020\257!\273\333}\252\314\303\253\324B\037v\223\"->1\230\017\327\217/\001\302\361\211\301\214\270,\2716\022aw\035\"q\317\333\206`\273\201-)\004\037U\256\343\0033\326\211\335U\261\277\363\230\315y\345:& \363\303\252\331]nE\3720T>\314\234\355\347\250\376b\221\023vU\"\301\247\025\3471\302\277X,\332U\321\303 \364i@\343,\345E\325oR\003\304\025\361b)\355\333\334\025\376&u"
+	.ascii	"\273\001\237\332\303\005\310G\223n\303\023\321\314"
+	.string	"\034|\264O\3432\024\022\032!\017x^\243\344\317|~\314`\222w\3716\016\333\347\365\343\245\f\023<X6\256\225\f\222\032c\325\256\255\266\354MZ/\376r\223\376\b\202\031\tk7D\320lSL\031\213\347\374\366\375\031\001\030J\022\364P\236i\232t\342\241\214P\032\276\016\335\t\374N)\336\251K)\215L\035\t<u'\005\374m\360\300\016\365}`\307][m\331\260K@!\022\371\261\322\026\253j\214m\255\360\035\032\304\302ux\"\031P\213\034=\252\"\031\220\013\227/\034\207g\362\343\337\3600\362gR[- \220\002\231\033\225\007\344$\206\233\004A\334\220\002\030S0\312'F3\006\243\023\353m\030`\307\214:\343s\343\025\206P\332\007b\314\221\201lm\237\265\222\247#\354\030t\223(\302\307\024t\356f\027\023\264\267\312\213L\211\327\360\037H=\206h\206&\fi\274\364$-\3546S\026\032"
+	.ascii	"\264w\364$-=\301\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375`\007\001\315\007"
+	.string	"\264\n\003\002"
+	.string	""
+	.string	""
+	.string	"\002 \177\021\201\200\200\200\002\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\005,\022\200\204\001"
+	.string	""
+	.string	"\003\0025\177\023\200\200\200\200\004\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\032\013\201"
+	.string	"\002\031\177\024\272\200\002\033\177\025#\177\026$\177\027%\177\030\0050\031\002&\177\032'\177\033(\177\034)\177\035+\177\036\005*\037\005\037 \205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\034!\035\"\030#\027$\026%\001/\177&\377\037"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001.\177'-\177(\003\b$\003\b\027\304\001\003\b\344\001\003\016\002\340\236\212\256\001\001B"
+	.string	"\037"
+	.string	"z\233\311\333\016R\2632\f\352\341\003\206\376\013\331\226`\270\374\300h 7\220\033Kn\004\315x`\r\016\320\016|\016|n\347\347\264~^\030k"
+	.ascii	"zL\365\0072p\0079;_\340\365\310\021.\fN3*|DQh\203\211\007"
+	.text
+	.section	.gnu.lto_.refs.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375 E)\002"
+	.string	"A"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\002\002"
+	.string	"\003\001"
+	.string	""
+	.string	"\003\003"
+	.string	"\001\005\002\003\002"
+	.string	"\002\006\001\003\001"
+	.string	"\001\003\002"
+	.string	"\002\007"
+	.string	"\003\001"
+	.string	""
+	.string	"\003\003"
+	.string	"\003\b\002\003\001"
+	.string	""
+	.string	"\t\002"
+	.string	"\002\003\007"
+	.string	"\003\020\002\021\002\022\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.447f1b46bfabdebc,"e",@progbits
+	.string	"(\265/\375`\373!\325\230"
+	.ascii	"\252\367\2006Q0P\322I\007\275\025a\021\374\374[*Z\023\033L\213"
+	.ascii	"\325\260\304\216\211\270\253\317\315Lk-\361\365\333\237wO<\315"
+	.ascii	"\255M\327\"\257m\214\026\330q\030\033\034ni\007.\017\344hJ\253"
+	.ascii	"\363\340\226Uk\241i\005\245\372\013\352Q\026!\026m#{\313\024"
+	.ascii	"\326\002[\003u\003\227\007\376\231\005\304\267x\370r\035$\354"
+	.ascii	"6\315\327\322\020\355\246\007p\n\240\237\034~\207\020v`\207\020"
+	.ascii	"\336\216\301@x\035$\f\361\003\355\0015D/\257'\313\223\222\247"
+	.ascii	"U\361.\215\033W]V\275%\303i\332\256\353Z\332w\275\303\373\255"
+	.ascii	"\341n\3174\231O0\347\347\230\273v\203\346f\005j;\272\370TD\320"
+	.ascii	"w\035\327t>Ih\216R\261\266\243\213/g\250P\211\022%\356\224\226"
+	.ascii	"4-\2546\235\355\271F\363"
+	.string	"\246k9\236%\264\351\324N\300\247;\201`\332\022e\230\021|\333\003\247\350 \241\320\326\300o@\374\336\303\177\233\371\b\274\374B\346e\325\277\247e.\023\307\023\352\241\251\262l\241Y\265M(\207\311\2334<6\374\007\312\232\314G\t\224\227NkZ9C\307\364Z\223ii\263\365\2267\2276[vX\2635\226&\273\3203\\#\214\r/g([\237\265\232\317\022\232u\350\\\221y\372\343\023*Q\"\347F\\\332\030V\305\b\235\020ge\312\252o'\370\r\206v3\237\234\234\305T\321z\340\037\372\273K\203uZ{\271\031\b\0339\213\001\362\243\fs\003\n_\3169L\203ii\247\365\227\253\320\234\305r\316%J\b\345L\021\302EC\250\276\231\3706\340\307\300j\021\177\332AB\036\025\360=\300\235\245\265\264tD\217\275\243\035\366\240\022\232\2419C\177\254\2227\3220\253\036\003\374_\354\006\200\345\bN"
+	.ascii	"~\217\020\336\300\300\036!<\016\266\375A\b\324AB\021\035$\374"
+	.ascii	"\233J{5\3642q<\263XfB=\3642\253\f\314\252m\245\277\336\320\256"
+	.ascii	"r\025\021\374&\301\262W\316\271\241\020<sV6\364\347/g\345Ow\002"
+	.ascii	"\335\t\250]WYcB\365\026\037\332AB\334\037\204-|\370\355\224\277"
+	.ascii	"S\374\375\300\337*\376\036\341\277\372[!,\360}\347\267O\216\363"
+	.ascii	"\3337\317\371\255\233\273\367o\321\374\315\345\3576l\376\376"
+	.ascii	"\262\346\357\005\376\316j\376~\333\373/\002\210\023\360[7\006"
+	.ascii	"\354\230\377le\256\363\333\264\277\365\376\316\363\3617\222\277"
+	.ascii	"\263\376f\3627\326\337I\376^\362w\023\274\277\247\376.\362\267"
+	.ascii	"\221\273\377?\377]\373\202\233\200\177k\366\277\356\177\232\274"
+	.ascii	"\013\177{\345\357,\177\333\375]\367\367\334\337r\377\203\377"
+	.ascii	"\215\372\033\356o\264\277\315\376\326\362w\225\277\273\376\226"
+	.ascii	"\3627\224\277\235\374\275\374{\205\277o\370\333\206\277g\370"
+	.ascii	"\273\351\357\343\3372\374]\374\033\206\277\221\376v\341\357\026"
+	.ascii	"\376&\341o\020\376&\372?\366\037\357\177\333\1771\177\263\370"
+	.ascii	"\033\203\277+\370{\202\377n\376^\361\267\336\377\274\377\323"
+	.ascii	"\377e\376C\3777\360\177\355?P```\340\177]\370\205\317_\bM^O\177"
+	.ascii	"|6L\031,4bn\325l\032\021%;\254j\303\330*\330\013\017\035d\300"
+	.ascii	"\334\033M\272X06m\254J\312\rO\335B\263*C\353\035\204\322=?1\253"
+	.ascii	"\036\003\301\307N\370=\245-\227\333-\326\314\236\341\254\225"
+	.ascii	"\202\033 ^n\3620\001]\346<\365\360{s\207"
+	.string	"\217\243\206o\261\330,\267Z\256\305\226\265\323\2020?\274\354t\222\320\261*k\213Bv[v;\236\fb\007p\357jj\325\257\261c\352V\033\"<\306\244UE\276\350\240\004\233\204\201\341\262\252\324\212\331%=al\240e\341\302\277\375\205Y\331\3149\353\bBs\323\211G\330\301n\022\177O\337V \337\377\200\"4'\331x\251\301O\314\224@.\"?8\315yi\225\314\300Jji5\305\214Z\345\344\222I\322C3[%\231\321\234=\344\3452\331\342\231=0\243Y*\3178#\325\031j\225\314\313g\366\220\227Y)\202\271\264\222bF\225R\036\230Q+\251\034\265\312@y\251l\332X\346\246\207\034\265\312\313\321\247\024\0203\372\224bF\255\252:\213\351\327\224Z\343uE\327M\230\313\234\003\212J\331\004\2322\241\317,\227s\213\321\310M\005r\246z6\345\224S}\3464\315\341T\246|64\347L"
+	.ascii	"\224\323"
+	.string	"\3253/\247\314\255g\316[N02\024\004I\3504#\351ir\bU\306A#\347\002\240rNv\236\346\234\2239g\234&\0254\347\037@L-(\250\234\235BP\231*\331\205F\316V\214\356L\212\031\275z\016u\311\022\325\3125\240\311\326\312rVM\034M^\3118\366\260\226\324\016=\253\206\365\220)\025\231U\217\343\204\245\366\212\375\022\202\346\244\217\023]\323i\"GK\031\035u\320\257.\035\300\266\254z\373\365.c\237\003\344\210\025QsZuh\350\326\312\007a\323\t\375\351/\277+a\250X\257\213\245\343\256\006\033\025.;\305\336mA\213\"\345\272\225\022\005\t\253L\033\253B\341\341\252\002F\316\252\027j\341G\240\204\211\026V\367\371$\201\262\223\333\022\333\304n\331'-\265N\354\222[&6\353\355\304j]e\355\350R\2122\021\202\325\013\201`\241\016\022^\241\022?\310\207\037\244Kb\253t\264"
+	.ascii	"\312a\205\361 \2435dud\340U\006o\b\3126\233v\\|\200\035\330d"
+	.ascii	"==\222\325\2503;..\032[\316\374\372\257\373\206\206\254T\005"
+	.ascii	"]rx\266\312\326\2608\244|\266@mNv\237\317\315\271\312OKM\263"
+	.ascii	"\351\276d\036\004M\232p3\232\256\247\316|\357\262\035\027W\316"
+	.ascii	"\366i\207X \266\210\025b}\330 V\007K\304ZY#\366\312\036\261?"
+	.ascii	",\022K\325R[e{\334NY\347U\353d\227M'\314j>\220\003\324\254\337"
+	.ascii	"\340\201\331*\273\003\207lj\307\305\327^\266\312*\273\017'\353"
+	.ascii	"i\307UB\250D\320\314\252j\210\002\252\315A/\374 \022\374`\017"
+	.ascii	"|5\020_}\303W\303\344\260Q=\323\251\2711\260\034Y\366\251\241"
+	.ascii	"\324\020\211b\325\253?\260eZ\033-\2657\256\202=s4gh\317U\366"
+	.ascii	" cFB\370\323$\204Wk\340\3376\370w\016\377\242a\t\244\340\337"
+	.ascii	"#\370b\001\277h7S\205\310\3710b\325\353\345f\347rEN\211\032\276"
+	.ascii	"\364\322k\326`9\252\303\304n\260\221\3301B\005\227\343r\3715"
+	.ascii	"\373\341\002$\313\301\252w\354n\331!\204\317lK\331m\262$\307"
+	.ascii	"\224\2305T\354\234.Y\177\251\313q\367g\006\205\313\2241\262\257"
+	.ascii	"\226\336\257\253%\310T\305\264\341\371L\337\200\360e\301\301"
+	.ascii	"\002\214\232\262\3210\350\216\223\271\305\212U\177\261\374\027"
+	.ascii	"z\257\334(O\211<\037bn\364\206Q\341Q\004\353'\247\213\037\224"
+	.ascii	"\350\320/\330=\003C\343\317\252-\304\363\004\377R\351[\245\312"
+	.ascii	"\001tO\177\\=\313*S}W\227\253oW\327M\272U\261\231\300j\266\224"
+	.ascii	"\3600q\367M\n\377+E\n\021!\033=h[\334VK\357\326\205\322@9_\225"
+	.ascii	"\235\365\240\ti#\006%\212\0139\017\240\023\345A\367#zi\374\356"
+	.ascii	"h\351\245q\235\\\2463\3630\341\346\306\276=\271\371Y\265I\331"
+	.ascii	"^\236\031)\370\355\325\343:\321\370\270S^tT\267*J\031\274\037"
+	.ascii	"w\312'\351!\347!sZI\256\326\315\272K\256\222\313\244\245\027"
+	.ascii	"\353\352\360\313\343\346p\241\213u\201\310\341a\335"
+	.ascii	"\347=\322S'P^r\271\303\3139\353\334\260\232\006\361Q{\274\016"
+	.ascii	"\204\023\323\003+uF.\222\226\336#\027\272G\256\220[\244\247N"
+	.ascii	"h\326\261\263\305\f\225\036\004\224\350\321\333A\016\210\260"
+	.ascii	"\b\021\2372\250\221=\253\336!8\316\251\265\031SV-\275Wk\270\272"
+	.ascii	"\370\275n'L\222\253\035\036\370;9\360w\2227\b~\303\013\322\346"
+	.ascii	"\207\257\323\006_G\017_\207\016_\347\r\377\327y\247\202\3211"
+	.ascii	"j\332\356T\367Y728\234\314`K\242?\bo\324\225\272:\376\234\237"
+	.ascii	"\256\263\"dj\370\267)B\2222dVU\373i\302\013\365\233\343\317\261"
+	.ascii	"kYZPh\370\367\351\342\370s|\344\230H\257\224\341\337\033d\201"
+	.ascii	"j|X\365\332\3004t\254\214\320\t\302E\007 V\375\265\361_f\373"
+	.ascii	"5\324\205\234\2275\004\276ic\325\236\376 l.C\2775v\332\300\340"
+	.ascii	"}U\341_e\337\245\364.\257\262\347t\2402\021\374\363q\247S\003"
+	.ascii	"_\245\325\2311\302\356A\tB\345&qj\220\361\313\301\252P\236\250"
+	.ascii	"(%\317\233\373\\\310\331\353'-\353\255Y\025\020\320N;\347\270"
+	.ascii	"7O\177\\_\212\234\2312\347\306\215\375c\323\302j\200d9\363\273"
+	.ascii	"\375\2632\003\315V\265}\335\307\363\306N\013z\326\246M\234T\253"
+	.ascii	"\207\314\006\226\271)k\326X\272\3262E\307\213\226\032\032\"{"
+	.ascii	"o\251\335\263Q\017\236y\207\210&P\247\t\265\315M\016-V}N3/\357"
+	.ascii	"\355\215V\020\307\235\337\214\2774i\354\335[\335\323\037W\216"
+	.ascii	"X\016H\322\330\335\336\341$ng\210X\325\326\331\256\026\363u\244"
+	.ascii	"L\016\317\315Y:\234\261Py\372\343\023\376\365\200\322\373\232"
+	.ascii	"[\272\340\231-&c]\360\23136\016g\237\2534T$p\342|\334mY\325\306"
+	.ascii	"Y\270![|Y\340\336x\264\314\340\261l\263t^\260\300\354\320[t\344"
+	.ascii	"\264\354\230t_\360\212M\0323+mo\263\323\316"
+	.string	"\315\234\235\371\272-y\372\343\372\371!f\252eU;\305X^\354\030/\226M\230sC\237Q\315\354l\222\370\355\332-[\317X]\2245_\276X5\234\314\271\245\001\207q\002\211\230dD\036Q\254GMJF\304$\024\306c\023\n\001\224\224\232\210\304\"\021\007Y$\234\241h\204\201,\022q^\fW%\025\271\036\227\326%!1i\330A\317q]\032\212p<\372\340hE\032\213LLM\307\002d0\025\211D\310\030\032\215,\024@\036\306\t$&\024HL\037\214\210M;\304\0276x,\342A\026\021\221\230\202D$\246\273\326\220tT\217\307\325xt4\304\221\301T4R\215H\246{\264\022\221\222\224\2068G\353\261I5Z\21787\026!1\235\350\221aD\036\223\220\326\022\212\020`\032\206\320\342\203\"\222\250\005\013\235>Z\211I/,\025\211\216\206\006\030\213\310b\bGC!\027\033\270\330`\311E"
+	.string	"\310$\342\007G\303\0170\216\253\361\305Z\002Q\013\026( W$"
+	.string	"R\234@\032\207L'\216\206k\t\003|Hqb\205\212!%\246\245\025Y\204,\n*\"r\200\\\217k\tHL\"n\224d\\\211+\022>\004+\034X!\001\r8\227\200\202\024\024\244\020^\002\n\206\206(X1\204\277b\350\"\217Ak\321\321\007@k\021\322\270&)1%!\225\232\226\002 j\301\302\205\320\25244:\346(\rc\304H::\256\306\3038q,BJzA,\3220$&-\0010\203"
+	.string	"H\342z\\\215L\310\"\221"
+	.string	"\243\030J=k\021"
+	.string	"kQ"
+	.string	"\253\221\261\251\350\002I\\\215\306&#"
+	.string	"d \223\214\206L\303\027~\220C\rPX\217M=G\244qUbA\264\036\233\002 \256F\306\225\004$b\022\3218L\201XLB2-5\035\211E#\020\307\244\343Q\006\f\037%\245\325HI\251\351\305\007$\261\251H\244\244\264\022\3110\256H\344P\203\325\310X|\021\024\243\007Y$\001\316Q1\311\270\222\360\202\t\004\344\360\205\244\036d\221\317a(\025\213\032\024\005_\274(\"\233\210P\230\241\250\004t,\362\301M:\310\207@\036\306\t\024\304\342\322R\321\310\200\027\231V#\nd\261hD\261\023C\037\213\206\220L;\307\240\360X\264\"\207H\027D-X\030W\344\032\202"
+	.ascii	"\034\374 \213V\f!\211IM\370CCD\"N\020\241\003lt\002\305\321X"
+	.ascii	"<\022\327#\nb\322p\t\205\221\361\210\342\004\210\243\325\270"
+	.ascii	"\"\225\222^\020OX\221\206H\245b\f\017\306!\f#\325\215e\343\211"
+	.ascii	"s\323w\205\257\325v\262\320\234zm\314\3243{~ol.\332\023%W\340"
+	.ascii	"\032\033\305\t\274\322Tc\325\300M\277\002\221\354\331\263\034"
+	.ascii	"\234\341\245'\247\027\202\205<g\224\274\013\305\016\211\324"
+	.string	"\016x\266LM\252Q\322\335\331\355\304ea\223Z\365\327\356\277in]Cy\270\220\301R\304\252$:H\030\3542\364\213F\035\302&\312\t\335\334\017!DnX\365w.\312\345H\022<\253Z&C\277r\025(\031\322eU0\277c\300\\\270\013\307\223\223`9\n\307L\215n\213/3\235$v\256<]1c\346\027\356\367ME\004\257\343\212\002\247\264\352\335\341\327\315I\306\013\336\231\353\366\347\350<!\022\225b\325\367(\361\035\300`=\244\244\254z\247\257\373V\035\216<\253\3362Os\306\361\031\271m\267\355\312\315\311\252w\355\262\265\364k\227\314}\274\324\220\256\371\341\343\320_\023^1\277j\177N\216\227*\"V{a\376\034\23418 Zv\370<q]\272\\4!\234\253\270}\341\365|\251r\306\315\227\202\247\250R\3410\211\002\031B\006\321\310\bI\222$\035R\n\020\204\303a\236\211\355\r\022"
+	.ascii	"\025-\317*\250\024\315\310H\222\244\264\354\0061\004,F\243>\b"
+	.ascii	"g\215\017\260jf\204\353G\364\256\007I\320\325t\203\244^\313\030"
+	.ascii	"\001I\201\013\310\245L\313\264-\021_\366\2264Q\006\230\371\222"
+	.ascii	"\362o\b\230\277F\215\315\242\3758\"BM \325\273\003\211X\341R"
+	.ascii	"\310$\352A)\004@}1\251\264\357\304[\222\260e`\006\212\rQx\275"
+	.ascii	"\245\271p\212\314\217\211\364\360\3275\034\271!\242\254\301'"
+	.ascii	"Y9&\214\313A\213\337\341\2702g\307\"Z\024A\337'\231\213N\240"
+	.ascii	"\241\326-\320\3661\257O\"E\211\200|#\227f\216\026\353j\"\303"
+	.ascii	"\242io\200\334C\241\223-\364\302\347\225\300\0356\201d]\2737"
+	.ascii	"\276Q\330\3505l\300\301\330\017=9\314"
+	.string	"~P\"\343\235\205\313\036\323\344]\001V\347\0228\377)\232\001\016t\214\032\2775Rr49h\023 \346\251\256T,\221\352S!\320\350~\2572T|s\360\320(4\007\343\020\246h\223;\322uy\034\3600\231\n5~\365Kp\303\260\302\215\324\365\326\203\237f\232\256\216\200E@\254\311\300.\336\362\203,\244\367\221\203\366\306\272\355v\017\324J\213\236\354\026\376r/~\331\361\363J1\354W\333^\345\265\325sG\330\374\232\n\360\275\362k\2471\247/H\375\203\2048\234J\351\200\032\035>Vu9\325\237\275r=\342\3226\263\222\320\342\273\210\022\314\036\004\231\251\304\020\252\211-)\217\210*\335\361<\252\3274+0\210\267\327\277^v\301\007\007/\370\2035\262\347D\366\317\222\372\241\320\030\356\200\227\321\205YC\267\216\334\213\031-;\n5\347\222\332\\\017\254\255\001\271V\267X\250\350\247\376vU\207\f\251"
+	.ascii	"h\225\004\345J~"
+	.string	"\226\022\013\370\275`\t(g\030\325\021\336\350Ra\270P\355\013'\266\3503_\220\374\017\227D7|t\247;\344\302\023\353\273\313\037\247\313k|r\236\356\020\274I\207`\237\346(\334\370SF\300_\022#\201g\211\177\302\271\314s\031`\204\246)\253\273p\315\016k0\357\036\274\321t\330\247TD\353\326\206\026\216\335\240\227PK\244\364A\270\255*\312\371\310\307$\356*j\254~\337R[\275\353\013\252\361\300\023:O\364\260\013\200\374\213\321\241\347"
+	.ascii	"\224G\316\320B4\n\346\261\263h\"\030q\360\254\f\032\364\375\216"
+	.ascii	"?p3!\347C#r?\271\361\300\251\314v#\257\203\007>\fn\322\351\200"
+	.ascii	"\350\351L\363\016\376}\224p\02658\306Y\224\356\225I\026\357\206"
+	.ascii	"\007\370b\237\034z=,r\222$\330I\205t\022X\254\365\337Dv\211\275"
+	.ascii	"]\362\366\223/\227\300\214T\231\f\371\226~\206\bq\304\022\027"
+	.ascii	"\\z\254\332\223:\321\205\332\027+n:\007\r\257$q\004}e\372\346"
+	.ascii	"\256L-\240\274\376`\235C\214\002X\f\300R\020\276\205\270\316"
+	.ascii	"\244\313I,\bzV\317\242T\3006\221\255{\202!\032\031\364G}\255"
+	.ascii	"\032\221\001\213\231\361\021~\003FYo\366g\352\226-T\310\234\\"
+	.ascii	"\260\032\220F\030\204F(\361}\322\356y\264\301\f\337\367\006p"
+	.ascii	"-\326\226[\372\301wH\020N\032\2600\344\tp\030H<\375\260\215U"
+	.ascii	"2\255\360\335\264q\016\344*\254\355\\Y\344M\205\006\002N2\327"
+	.ascii	"&\2236\007Y\276(\t\222"
+	.string	"u$\372\3569\223v)\\\343\340\3508\337y\013z\016\346#6\226\262\312\342\352\ne@\264\347\304\234k\347\235\341\223J|qS\217\373~5\223\235\031]\"!\301]\032\370\307\274\241\214\003P\314:\336\371\3000\036C*.\273\256\364\340R\336\006\242\2325@\264\215iK\371I\365\325qVAP\3336E\343\333j\244\215\262\2526\313\025\343\224\377a\345\036w\"\266\317\300\223\342\342\262\346l\020\033\343\2764\303\346\207\301\024\317\026M\366\326\361\226\003%&\035\220\255I\347b\fS\237\302\006\260G\344m\037}\037ej\307K\030\330\336a|\264\005(\305\002z\005\013Q\374`\017$\3145F\204T\006'}\026\356\200\310\276\360\322\002\310\232\n~\b\325J# O\371\357\017\245t\203\347(\0204\037\241\271c\0034\035\315V\025J\233o\364\001\246\254;w\377m\037L\222\315\302\375\361\343\321\n\2748\fb"
+	.string	"\363\376\212\304`u\344\007\363\244\003\221\274\225\203d\250\302\220\017\246\037\250\t\204\311\021\030\035\002\207\372S"
+	.string	"'\244\007\031\357\001)\244sU%\323\317\240\034\216T6\240\002\334\244\217N\r\327\310|\027\232!.\313\204\303\221\362\003\234\326(\021R\300\3757jF\204\250\327*pxjG\260\356\232\314\253\377\3478\327\357\211|Z\257\tX\260g\0057+\207\264Z\304\237\006p\344G\036&sB\321l\300%\360[\230\347\320\301\003\376\257\356\365\351\327\370}\301\004\311\247\261\276T\216\033\334\275\270\254\267\357=\\\216)\030\330\277\303kq<\240\036"
+	.ascii	"\377\367Mn\262\351c\257\305\365\022\275\013\336\315\356\352\001"
+	.ascii	"\231\305\013\373\240\033C\\\214C\342\2119\337\303q\305uG\244"
+	.ascii	"\357\036\256i\367U\234\255g\345n\3427\261=ju\007qZ"
+	.text
+	.section	.gnu.lto_.symtab.447f1b46bfabdebc,"e",@progbits
+	.string	"pgResetFn_voltageSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"voltageMeterADCStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"getVoltageMeterADC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"voltageMeterESCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"voltageMeterESCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"voltageMeterESCReadMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"voltageMeterESCReadCombined"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"voltageSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"voltageSensorADCConfig_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"voltageMeterSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.447f1b46bfabdebc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2938 @@
+	.file	"target.c"
+	.section	.gnu.lto_.profile.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\036\004\035\027"
+	.string	"\304 \022\005"
+	.string	"a"
+	.string	"\233\364\264\234\017\030\002"
+	.string	"\002\001\003\002\003\003\267\240\214\361\013\n\002\004\005\002\005\002\001\002\001\004\240\342\234\212\n\005\006\352\263\360\321\b\007\242\302\263\302\013\b\t\226\234\261\244\006\002\n\317\323\311\337\002("
+	.string	"\002\005\002"
+	.string	"\002"
+	.string	"\006\005\002\005\013\f\r\016\017\020\021\022\023\352\312\351\313\r"
+	.string	"\024\025\256\234\262\364\013"
+	.string	"\026\351\315\271\235\004\022\002\007\b\002\b\027\030\032\310\373\201\350\r\002\033\275\370\226\363\013"
+	.string	"\034\223\273\300\245\013\002\002\t\002\t\035\255\235\373\347\003\002\002\n\002\n\036\037\251\306\315\231\b"
+	.string	" \324\240\313\347\002\006!\"#\372\255\302\243\003$\301\325\215\205\016"
+	.string	"%\274\205\242\255\006"
+	.string	"&\225\221\315\200\006"
+	.string	"'\210\377\206\247\006"
+	.string	"(\271\303\275\241\r\n\002\013\002\f\f\002\f)*\345\247\247\276\r\n\002\006+,-\315\343\301\244\013.\350\367\206\362\016/01\230\336\335\312\0012\205\311\226\223\013("
+	.string	"34567\274\351\237\321\r\00489:\263\330\307\313;\200\336\321\207\013\006\002\006<\354\200\267\256\017=\204\207\321\275\003>\236\376\214\355\n?\222\321\201\352\t\b\b\002\b@\230\274\251\331\r\002A\332\232\352\204\016B\233\333\371\263\017"
+	.string	"C\336\334\373\370\004\006D\314\345\244\232\005"
+	.string	"E\363\354\271uF\367\340\265\215\005\bG\202\220\306\317\004\020H\201\226\204\312\r\006\002\r\002\r\002\004\002\016IJKL\333\217\352\217\004\016MN\313\322\375\213\007"
+	.string	"O\236\376\250\313\b\004P\350\300\306\254\005Q\222\252\354\340\007"
+	.string	"R\202\321\322\374\007\004\r\002\017ST\360\251\206\306\017U\331\376\371\257\017\022\002\020\002\021\n\002\nV\310\342\324\f\002WX\317\253\250\341\002"
+	.string	"Y\351\361\317\236\016\004Z\266\361\223\236\013\022\002\022[\\\227\227\247\303\t\b]\373\220\322\206\007"
+	.string	"^\265\300\331\214\001"
+	.string	"_\324\226\242\363\f"
+	.string	"`\202\275\352\302\f"
+	.string	"abc\240\342\234\212\n"
+	.ascii	"m\250\001A\202\0201J&M\223\215\003\200\202\251\252\242\007\021"
+	.ascii	"\340hCv\nZRF2\214\001\361\242\002Y\303\371l\261.BM\006\"\003"
+	.ascii	"qp\202J!!\273\374c\212\234s\350\220\375\362\235\tgG\233\023N"
+	.ascii	"\023o\217\r\005\214\177\2778fC\207\f\260\007,\221.E\232\026B"
+	.ascii	"\372N\023\316b#D\373\362E\007\245\t\236@E\217\346.!W{\324\323"
+	.ascii	"\203\343\260\337\362&\251\220\245\357\017\371#l\342.\234T\343"
+	.ascii	"\020l\204DM\215\203\027m\252\241z\232\302\374\314\022_|\017;"
+	.ascii	"\224=\374?\365:i\2040\307|\261\026\345/\206\312\217\303\237>"
+	.ascii	"(\347oE\327/u\271\205\013e\272D\330\204=\360\017\030\030A5\313"
+	.ascii	"\207\177\300\032\246>\247=\3774j\303:\004\226"
+	.text
+	.section	.gnu.lto_.ipa_sra.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\366\001\265\t"
+	.ascii	"\362\013&+"
+	.string	"PU\322\03003333333Sdf\326\222G\353B\024}\016\2658\002\361\3038y\023\322\244@\2322\237m\217l)S\n\326,\315\266\367\314\311\3541\013\263/\347\322\242\262\374\212\251\234)'\312\236\234&_\302Q\300#9\265 \223\354%d\003f7\262\"! \037\036z\307>\207ohd`\\XH\261\262\331\234\220\200\320\363a\317\316\346`\337\260\f\013\253\360\224\200\260~\037\030\024\020H\346\031\005\334\003\340\352T\253W\037}Et^\223\026\331\231\025\332MU\250\220\222\321$\245a\fp\002!T\345\001\020pCB&i3l\353\246\225\331\256\361\204\274L\326\336\037Z>(t\004\311(pn\361\246b\b\240x\341i\326\225%F\032<\"<IY\n\232r\313\245\237\033\b\370=\300K\370\224\3726\376\352\300U\3074\267\313D\254\254\323\261\007D\246\035\306kO\204f\344=s\031\375"
+	.ascii	"\300\221\210\263\030R\r\307!5\302x\233\007\214\2663pq\356\217"
+	.ascii	":\304\224\360VL^\243\324n#E\334N_\212\2254\211\265\333\347#P"
+	.ascii	"\315\265|\004"
+	.text
+	.section	.gnu.lto_.inline.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`h\rE&"
+	.string	"6\353\232I\200\226N:{1k\226\002\317\371a\235\013\366S\204\t`\355\024\265\356;\270\330\341?\304\317S\216#\344\375\334\245\334Rn\021\344\356.0\020\016 @]\347@\203\001\200\313Pq\206\177N\n\257yl\254\031\221n\207l\271Sx"
+	.string	"\202"
+	.string	"\222"
+	.string	"\255<^&\314\177\377\007O&\256\300\333JME|\374\360\177\213\356\221f\323\232\004\273\224\332\324\246\266{?\362\356\350\032\233\3531Y\327\330\024\341}\300k\377\377\370\1771\251\367\023\261\326\024V^\016\377\266\350\326X\246e\335\374\236\270\236-\252\212\242\347\177\347\363,\304\335\335\366|6\362[w\007\177$/\273{\007\375m\346\271\357a\330\376\376\022\261Zw\367\374\021\356\022\024rV|?\222\331\262\224\204\001\361_D\261\002u1\365\201}NZw\313\250\016x\356\325\3350_`q\2201\252\202\235NP\274G\360\253\356n\371\001\003?\333\3333y\227\272[x\235\001\305\313\037\242\244\203\r\275"
+	.ascii	"$z\034[d\265\260\345\026:d{{{d\253/*!\277\337\f1\222\327\356"
+	.ascii	"\366\335\346\304\225\177a\357\304\225\270\262\262\367\037y\355"
+	.ascii	"\270.@\304oJ2\034G\373\020\300e~\027\335\001.G\177\032\323\024"
+	.ascii	"\3101l-\337\347^\206\255=\207\357`\274T\264\266\252\206\374)"
+	.ascii	"\245~R\377#\304In\335\203\357\225\361\203\316\t\360\034N\\7`"
+	.ascii	"A]I\001\031\313\232%\356w\r\031\2227\257-jL\345\034K.\345\313"
+	.ascii	"1\234\270^\371\004\317'\371\212Y\025\022\227\231\030v]L/\352"
+	.ascii	"\005\013\025nd%\030\323)e)Lf,IOA\f\214\351\204\266\361\240\321"
+	.ascii	"\364\275g\302\317\302\236\3751\2149<\274:\265\005\337\315\331"
+	.ascii	"\031\2319\204\"7\313\002g\361\257\2707\200\224%QJ-\267\360\202"
+	.ascii	"W\341\225\302\336Z\262/*\"\300'r_V4\017\372\231\255"
+	.string	"\265C7\017\216N\214\271\232\310i1\340\273E\0059\272\335Q(\307\352\216l\240\374\2525\243\245\340\201N\234\250\r[{\215\3144\361\247\026\r\212R\036\017\263\212\321\023\201\227 Qs\344\036!\"D\361<\b\"\247!\2355S\376\033\322Y\023\375\207\243\366\310\354\016\216)@\r[\032\266\226o\223\314v\007\307\004\274\207\006::gU\005\006\201\023\250\201=R3R#IQ\n\215\001\321\004\004!\006\251d{\022`#5\005\243$b\210($\022\214\210H \022DI\201A\323\032\274\037Zl\030\235J\001\2621\213\206\241\272'\225\326\r\223\"5>\013\255;\213\231^\b8\327#\024>\241\027'T\bc!\bP\r\246\034\031\032}@i\244O\351\007U\006\321\305d7\026\323\267\351{\333Vv\240O\371\207/4%\007\305\274\242\303TAO\321\353\342\301\370\272\324\252\271\352\214\007UD!\274\210\224"
+	.string	"\277kH\236\322\201V\004\204\360\204-\200M\020\312\036n\332\020\304\300\202\324\0222"
+	.string	")\355\256\334\243\273\020\3220o\313\215\306$\225"
+	.string	"Tf\"\022\301h\232\021x^\2579\337\243Y~\352\024\330\300^\270K \302\322?kt\300*\335\tJ\037\256\032\264\257\275\013\263\274\355\272i|\314\241\nV\035\251\347\277\304C\024u\326\324Z\340\340Vz\204\363\236\275"
+	.string	"\347\314d\263\264\030\177\223\310\026t@BC\326\244\224;B\223\2517\nE\353\002v\207\370\3204\035px\316+\370GO\251}["
+	.string	"A\352\236\374\310+\214,\303O\325\200\032qW\004\303\027d\315\253\326\"\271\220\370\272\3403W\3554o2@\267\021\371\031\355\256\360\322\314hlVf%r\334\325Z\317\r\344\332s%x\360\212\031\355;[\207\\\346\r\260\024$\240K\223\374\003!\r\265`?\251\360Z\214\233\253\0200\300\372\255\205\277\302Z\221\271\026E+:\017\362h\326I~\375)\234}\206\212\2273\314\370Sf=e\022%\260\252\220ZNXC\307\261\217\273\341C\353?WdG\245\003\250\200_\317\227V6\334\324\356_\226 \023\241\216"
+	.ascii	"5\031(pE\311\325r\236\260\355\264$)\320\274g\226\231\003\310"
+	.ascii	"?[g\351\204\b:\365\230\035d\251\"|n+\036\240'\330m\333x\177\267"
+	.ascii	"\265\217*\245N\027\241Z\375\236\365m\211'\032\303\007\352'\360"
+	.ascii	"f\026K\212V\244'I\345\350RX\"ZI\311g\025\340\323\241\326\034"
+	.ascii	"\303\356\207\313\1774<\3367\3053\023\377\032\352\300\246\231"
+	.ascii	"\324OM\240\254qm8$GN\t}\3304\230q\232\305\352]\343\207\331\257"
+	.ascii	"\256<"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\316\023e6"
+	.string	"\212H\234\017DplM\007EV5u\030\250\217\370o\331\340N\361\022m\211,\222\245 \3311K\351*\350\247i[\321v}\\\030\355c\t\001\335\330\031\376B\274\300\003^\214\203\271I\r\021\210\224Jh\"}\267-SJ\001\325"
+	.string	"\336"
+	.string	"\361"
+	.ascii	"^\024\3644\376G\237\255{\322\222'p\362grW\3473\332\333\315\300"
+	.ascii	"\311]\335Lv'\343\377\344\256\336d\264\256$\030\364f\003\345"
+	.string	"\2567F+J\271\253n\264^\306\177l\312]!\214@ \020\350\236\251\210?\276\275\377\336l\032\216\370\335Y\274rW\245\321\346\214\345\256\007F\033v\037\371\027\357V\260\204\240\215\214\274\337\210\337\213\360\326\013\302[\261{,\374nZ\237\271sE\311T0\210\310\207\032\007v\207@ \217\b\377\335\371\233\274K\346\322Q\271\313]}\364\231\375\007\337\355\036 t.\356[\\\351\355g\257\022\335\253\304\367\366\372\006o\337jq\317\342\036\fzM$\003\356\360\232\370\236=\177\350\245=\364\342\335\267o\322\267\177[\367\357\250\266\272n\0036\002\027\374\263;\331!\262\020o\311\202\342O\275\275~z\334\325\226\275(z\376!\276\300\330~i\027-V` \006z\006\">\324VM\213\301\347\232\212n]7V\367Uw\n\016\271\332\347\005\237\245\276;\224\350\001\237\247\334\335\222\260\252\032\361TOO\256\023E4\200<"
+	.string	"\362\270N\374\357\020 \220\246\272\373Cw{\350\356\016\335\315A\252\273\254\314uA\202\374\206\2677\352\355\227\331*Pa{A\275\265\356ON\335\215\353\356\nM\376a\367\2041\"w\265>F\033j\370\3761\207F\356\372}F\033fx\177w\t\335\2679q\226\342\034\271\353\177\211"
+	.ascii	"\007\311]\337\212\273\361\336\347$L\216\037t\267\203.\n\006\203"
+	.ascii	"\301\034\266\347o\244w\357\274\344\256Od\264\"\322\347\243\317"
+	.ascii	"E\356\337\340\002\003\345\017\253\350\211}&\316\335\232\346\273"
+	.ascii	"a\251R5S\034\266\246Ih&\034\266i\352\256L\277(4\rU1Y\212\231"
+	.ascii	";\260\245\246]\300\244\330\r{\300\245\016\323\207\233F\337m\304"
+	.ascii	"dI\356P1\334\025\366\205\212\235[2Jd\205\310Yq\341\232)\265}"
+	.ascii	"\2323p<4\355\225\245\200\266\331\310\263\304\344\256Lkh\365\276"
+	.ascii	"T\243nsW1\314h?\313\353\315]E+\243}\235\fq\310hC\244\367\243"
+	.ascii	"\317\002\334?\306Q\227\0302r\356:\013\3240zWo?\310\214N\235\273"
+	.ascii	"\316\326\214\366\355\334u\206&\223\341\271\353\f\314h\273\363"
+	.ascii	"\354\311h\303P\217\322\357\230\tI\344PA\262=w\r\001\361\021?"
+	.ascii	"D\024\262\361@\356\200\274\304\333?N\302P\270\245\231\242D\021"
+	.ascii	"t\327\260\312h!\f\272kXd\264\341\030)c\244\020\022\277\263\223"
+	.ascii	"\025\272\253M4\332M\236\246\b\336/U\303\312\236\217@\227\351"
+	.ascii	"\217\206\tv\242T\247\211\245\246\273\237\201\246\331J\032\347"
+	.ascii	".\305`(V\177\350\215\235\257f\324XUZY'\250\256r2rZ&\262\n4\217"
+	.ascii	"\004\013[lw\246\245z\232\001J\022\345a\013\245\352K*\325\035"
+	.ascii	"\331\253\365P4w\232;^\322\227\352\204\303\200\303\200\203zr\242"
+	.ascii	"\205\235\246\330\357\352\304\201\205U\3634\223p8\\Z\336HK\037"
+	.ascii	"\306\032\261\205\325t\247\372\220\332\226\242iZ\342\264\f"
+	.string	"KQ\026=\362\207\251\0264-\227\333J\201=\3300iE\376\214\260T\212\202\341\032\276\235\030\030\036Q\225\303VMM#o\330f\263u\225$\212\242L\177\\\n\032\207\303\251\346i\242+-y\246\312U\324\266TEQ\021\250VR\333\324\322W\252\350\342\225\252/\207\217\253\250icQ\030z\267.2EY\360v)\r4\305Rj\032\031\201L\250\361@\250P\311\210\210\024\024$IZ\003\341\004\2048\t\245;;\022\340\001i\214\2039\214q\206\031c\0204B$#)IA\252\2251\374GD\\\226=9\020\260\352\020I\334\343\027j\024L\201b\264\035\311T\324x\305\265\235\b\004\023\267\f\314\025\223s\240(\333\020\177\336\t\325i\212\210*\366U\3339}]\231\255\305\200\036\n\243\351\017\347\237\240\227\006M\323\270\235x]\214\265Nf\306\355B\002pNjR\257\330\303[2/\242.\366\251\250\275n"
+	.string	"\336\027\262{\263\304\257\206\214\240\326\002-\301\251\275\325\007\213B#\026\f\231\236\225(DO\3627\233Z2R\032*\371"
+	.string	"k>Q\230i3\331\370\013\355C\200\206k\n\fz\246V\347\r\305N@\252\363\242\320\245\321\231"
+	.string	"D4\033am\306HzL\243J\031\376\223pg\221QFM\031\362\226\203'd\277\370\235\331\261exz\240qM\033\226\255\253+\232\275i\0162\030\263w\205\366\376\026\346\232\362\016\034{\004\260\017`\214}x\037\300\035\301\030\3165\267\035\343\350\276\223\330\301J\232\022\365 \362\300\020\007V\031\261\030\366\352\225\324\272\200C\373\340\236\\\214f\312b\311\221\361\233q,\223\006\276%\b\272I\343T\215\242# 7\033\360\366L+\r\354a~\3645w\217\016I\372\034\202s[\343\372Ra\3226t<\355\314}\265j1\016\373\342\205\370\345p;w\247&\035\305w\327\235\346\030\270t\226\324\254\316J\t\236\033\003z\301\3003I\203=\312\307\013(S\334\270\302\006\300\246a\270\240{5\230I\215\r\227\314\362\001\213\344y\005a?4\312\244"
+	.string	"jL\200\312z\261\343L9%\237\317?:\261\360\241\007t\223\2138\242C\274\362\027\202\033\205\005B\353\345uu1\367\360J\260`U\271s\024\022D\257\223B\036o+\336\273\250\266\321n\242\354\206B\230"
+	.string	"O8\212s\332\036\210\232\326s@\227\242<\275"
+	.string	"\246o,\257\350ZD\355\2041C(\347\035"
+	.ascii	"\211\021bh\n\247\2209\025\333p\244!\024\037\3455m\f\226\031\t"
+	.ascii	"\352\013^X\203\271L\374{\016n\364o\244i\253\274\302\222\277b"
+	.ascii	"l:\264f\2232\312{\026\325\337\030\364\376\370#\266\254\215\245"
+	.ascii	",\324\211\216\2343\315Ls\226\313\233V4\003\200\270\227\330\036"
+	.ascii	"O\033\n\"k\356\r\223\305\346\323\200\311j\274.p\321Hax\301p\334"
+	.ascii	"\013\331\353\330\332v\007F<v\361 \327c\nyH\334\243\031\224\213"
+	.ascii	"\326k\326\b\020O\177\370k\371\035\022\344P\224\n\342\301\300"
+	.ascii	"\t\030\n\272)\tW\326\006\224w\021(\224IJ.v\2765\327[\273P<\261"
+	.ascii	"\312\203\247\200\260\333^\tt\n\261\007"
+	.text
+	.section	.gnu.lto_.pureconst.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375 \255\215\004"
+	.string	"\322J#)0s\322\030\027\007O\212\"\n\020\241\253\016\f\fl\377\375\316\367\270\377\377\177\377K\001\373\374\267u\317b\253\nyA\022o\007\267\312\235r\243\370\311mr\2278\211l\304E<\304A\374C\346\341J\207s\3106\\\3033\2440\374\302-\274\302)|\302&\341\021V\020\376\340\016\336\340\f\276p-\301\t\301\017\334\300\013\234\340\036\270\026\001Y\300\rp\322\350$\221\207\034t\324\307=\336\271\211\343\033\327\3302\3270V\027\247\245\260\326b\t"
+	.text
+	.section	.gnu.lto_.ipa_modref.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`m\004\225\017"
+	.string	"\246\323;3P\2152\0340333S\237\310\314\314\314\f\215\314,\024{k\377[\371\326\036u\247\231\221\221\021\240\213\217\225\301li\\\2636\350\274\030\343\204\344\023)S'"
+	.string	","
+	.string	"2"
+	.string	"\263T^j\267<\313[4\271r\256\3755^\223TN\352\034\225\217\212u\277\337\234_\312E\275\376j\3353\301c%\0013,(0UnN@\225\b\230r\314\001\204\346\377\314\003\335\364\224{:O\345\247\326\340\355Ki*7uj\3125\025\201>\031\320\003\3776\255Z\177\354[(\224\245\\! \037\036\035\034\005@\341\0065\372\314\300\270\260\370\257\240\350\304\365\334\336\227JD\207\323\207\255SkW\225\016\275\r\ro@\033P\213\223-\361iu\260Y\253U\247\236\250\202\354u\235\251\364s\243L\371IyE\\h\223r\026\364$\037\326\b\253sU\276\272\227\310\001\200\200\250AU\207l\026\244\240\222\266\003P\2021U6\346\001\021\340\244R\232\321\314(h\031)\3263\016\256\227\206\252\243\221\212\"\n\013N\331 \241\371\rj\001\020\247\206"
+	.string	"x\r\3669K\313\225\325\301)\376\223h\345\261.\036\267\321\225\303\343\303\243\355\336S\022\324z#DuK^\024F\213\314Fn\364\375\347\365R\327\236;,,\\8\021\232\032]\2756?qE\364\307z\346q\267G\005\345\313\311\336m\026q"
+	.string	"\344P\bG\252\317\b\321\003\001'\376\370j\037\002j\233$;h\217\373\267o\320\354\001a?YBZ2f\256\035\374\271\366\006\030S\353\030\035\247\230E9\022o\004H\221\361(J\224\333o\202\303A5\030t\330\257@\317\377\254F\334\217\200\344SB\340;\020\373A\376\243Z\304\224\202\232\036\350\004\353\314\360\033P\362\325\"\303FU\343AK\230\"\346\013\275\021\336\341W\243\036"
+	.ascii	"\r"
+	.text
+	.section	.gnu.lto_.lto.3abad1c855f6281b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lockMainPID.76.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"\235\t"
+	.string	"v\222B:0\345(\035\200\277\351\300h\271_\303\244\024\264\225\203W\201\t=\357\022Mf\362\367\375\266\221\306)\266\035\344\n\272\275\f5\003\204\272\036\252\355<\362\216HG\327\232%dK\231R1"
+	.string	"1"
+	.string	"1"
+	.string	"\361\004\334\267\005\271\367\270\352\371\002\340\367\270\311\370F\003\027\307\314"
+	.string	"\230\212\035\226\331\352\261k\013T\251j>sN+\013\304\270\267\333V\260\355\261\035\023/\373q\256\313VuT\265^}\315A\312]\002\314yQ\0030g\233\312\210m\317\346\370$/\361\354\225\030\206\200\377\220\255Nd\346\234\262\363\002\356[\254\270\273\237\035~?\315\243\206\262\373\362M\334\367\301\004F\2454\373\262\207&_\304\026'=\353\233\177\342\276}\037;B\313\013L\003\2455;\374t\003\016y\030\034\026\032dI\004\321\201Jr\"\002$!C\035Iz:\036Q\210:Y\032\215:\311\t\347\343\306\200\016\330\206&\\\267e[\327\037\324\246\342F\355\n\222>\016"
+	.ascii	"{\345\323\202E\030\226\261p\340\b\227\f+\b\332\034\345A@\327"
+	.ascii	"\360\305\021\257\016A\214\273\322T{40\265\007"
+	.text
+	.section	.gnu.lto_sendMotorUpdate.77.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\215\007"
+	.string	"2\21635Po\322\001 [\236(\257J\207\013\355\320\210\275\363\342f(&\323W/\303,A\214\304\017\0021\244\214\326\273\332"
+	.string	"#\212\254\360`\372\032\006\r\036\203v\2232\245\356P\b\n\007\t\020\363,X\034\f:0p\032`\307\272 E\340\352\301cA\254\252,\250\341\366\230\325\220\001H\367\321\ngR\340.M\027\275\344\032X!\371\250\202\270\256\351\357\242sY\300\356\347\321\027\371H\204\337\361g\211,\037\377\374l\372\263'(\362\321i\362\321Y\350fs[\252\206}\314j\310\326M\351*\244]\214\027\227\355\036\212\207\355k\254\331,\3478\366\243\224\013R\313\356B\335\270\366\324\374\207<\023A\333\023\240`w\235\021\224q\353molS\266O\002\f"
+	.ascii	"{\3117c\332\371\206\217Lc\300\021\200\361\036\225\241k8Y\b\343"
+	.ascii	"e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_fdmSetSensors.78.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\357\006\305 "
+	.string	"6\274\313G\240\224\316p\024<\034!\376\200C}\256\334\0231\341\322d\326x\032\367\303y\003\310\017`'\0047\004\306\240\306s\020\023\022x\023\327#\340\217\346\217\361v\376bM\275\201U\255\"\"\"\"\"\342\250\321\233\354-\223L\001\253"
+	.string	"\237"
+	.string	"\307"
+	.ascii	"v!\357\226\337,\277W"
+	.string	"~\367\310[\205\274S~\363~\233\277w\344]\2227\371{\177\377\267\006\370\230\032\213%?\200\264\355\233\361\364\252{r\272\225l(l+Z\334\231\313\021,\204\331\023\0329\312\224\356\003\f\215\241A_x\277\346zZ\332\032\354\236\226\273\236\355\033\275\246\203\211\332y\236?/\351me\241dV\332b\203\302\234gX\233\332y\032\177\016\362\264\264QivZ\362Tf\247\245\255l95\212\235&\2116.\031K\316\363\f\356\t\265\322[Y\325\205\246t}]\351\315\001\347y\372]_\035\324\253\266}\266\033\330&\205Z\347\211\345\373\356\2322\266Td\275\316\272\337\267m!\261\001(\233\260I\354<\265\236\354\n\2726\344\235\247V\223\232\225\t\242\315qLK\353\206\235\226\272\026\274\306\300\310\330\260^g\033\263\276%l%\317\r\263\311\373\211\274\235\310\273\211\274\227\310[\211\274\223\310;H\336@\362\376i\013U"
+	.ascii	"\346\215\364\373\310\274\215~\027"
+	.string	"\2317\321\357!\363\026\372\355\333\335A\344\rD\336?\344\355C\336=\277y~\357\374\326!\357\234\3378\277o~\333\220w\315o\232\3373\345-C\3361\344\rC\336/\344\0037pB\246\343\321\006\316\353\bF\306\246\264K5\253\264jF\2635C\222\300\241\211\2403\032O{ffi\326,\262\245\"K\210\220)\202\006\021\233Y\226\253'L\330^\376\2620\033\2632kCE]\273\374\303\265W\266\272\251\217\f\3261KM]\273\246vZ\312l\312\007\227\215QY\230\325.$\345\276\254)\311z3C\322\264e\3136\255\322`\331\226\225e\351\355\212\356\3206\036\327\262\267\342\206:\255\212\rMY\247\3252\336\246\230\313\333\255\371\323\0348v\253.\364q^)8\234WO\353\262\376\026]]\235\372\306\216\334\247\325\030\352c{K\233Q\226d\227\\\255\261\325cM\325\210\210\030r\266\2055\342\264U\002\236"
+	.string	"\254\232P\204\032\006/\020\207CbT\316P\250"
+	.string	"\252hAJ\002\257X\001\303:\nh`\001\001\005\301\242\324\024\025T1xA\b5\fFQU\005\201?&b\220\242\n\026\211D\252`\317\210\245\033\346\002\036\334\2606\313:\027Z\2425Z\244\265\013\0348Z\244(B&(<G\313T\264FN\204\232\326D@\321j\332\320\022-\021\252\234\022\034C\253rp\276\025\332\037W\024\240\316\t_\343\210@\223$P:\337\226 <\034\301\310j\356\263?\013\264Ak3p`D\217T=\200"
+	.ascii	"a\247e\320\322\002%\355\017p}\242\374\026\330\263\277U4\236\355"
+	.ascii	"\331Y\2365\347tv\247H\234N\\p\223r6\270z\206\26397\213\263\346"
+	.ascii	"\234\315\006y\250Q8\343\2311D\223\024\024\024$i\326\360\002\221"
+	.ascii	"\031\342<\021\360\240r\216!Bm=\263\031c}\337\363?p\327\255l\371"
+	.ascii	"j9I\021@8\332$\360\0011\301kf\201\313\202\317\030\017\260\327"
+	.ascii	"\370\0213\260I.F/\303\330SDe\021\275\313w\207\354M\314\275\n"
+	.ascii	"Zb:TFLw\233Pnbfa\240\022\b<\274\242g\254\n\231\210!\b\220\304"
+	.ascii	"\005\342\031\261\336\3036\204P\2164\322{>\260\\\001 \201t\362"
+	.ascii	"\350\231\030(\375\233B'\035\341\024D\003*\232\253\216\252\247"
+	.ascii	"|\364\037\274\330G\f\2127}\220\273\346\264\245U\257\005i\007"
+	.ascii	"\372\247\bE;M\b\321\f\376\271\251\336\035\201\035D\020\361\316"
+	.ascii	"!\267\001G|\022\252\252\373p\377\204j\363J=$|\206\272\264\367"
+	.ascii	"sq\030.\031>\300_\005\211\264(\316\037"
+	.text
+	.section	.gnu.lto_updateState.79.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`W\tU5"
+	.ascii	"\232_\264\024AP\246N\007\257\350x\261L\\U\205\344&w\240\320\221"
+	.ascii	"\035Z\341\3104(\312b\205\344\364!o\233Z\243\210\350\245w\357"
+	.ascii	"\003\317\020x\356'\242\351W\324%v\335\373\267\306@\264\266\273"
+	.ascii	"7\331{\247\224R8\001\031\001A\001l\233\266\347\272\216\373M\303"
+	.ascii	"aV\256\205k\257\332\r#\b;\324n\314l\317q\267a\303tj\321Ke\232"
+	.ascii	"\315i\336{\243\324+n\270\226c6\016\202\022\227\321\3452\263;"
+	.ascii	"\203\361\326j\256z\r\004%\256\345\375\202B\364f\331BmT\351\354"
+	.ascii	"3\215\206\231\345\037\355\306\b\302\304\242\214i\224\371\007"
+	.ascii	"3\333\250w\231^k&\263f\232\255\355\266,%1\264\270y\235P\033\355"
+	.ascii	"k\324G\251\032\220\276F\257`\221\2568\315{\227\036\226A\316\233"
+	.ascii	"\\^-P[\360\306,5\312Nj;s\217\351\264\266\225B:\300\275U\336\342"
+	.ascii	"\356]N`\242\332(/\233@\332\250\332Gi\243\3342\373\351\345\225"
+	.ascii	"\333loG6B\367^\342[\351\266\3315\250\002S\364|o\271\327\257b"
+	.ascii	"\263+\263\025\214\2019\351 0\304\030\030\223V\025\214\201%\033"
+	.ascii	"\230\204s\364\264\355x19\225\356\275\354\227\321\321\263\301"
+	.ascii	"1\321\226\242\257\256\023\211Pq\256\271x5\3613%\323\363g\f\254"
+	.ascii	"I\377\351\324E\350I\321\027\327),t\274\323\314\366\"_[\356\300"
+	.ascii	"\020\367^v\344\027X\263\260\2319\f3O1\007\231\002yqJ\261\177"
+	.ascii	"2>\277\337\306\332\034./\304,\327\201\300\356\275\354\200\353"
+	.ascii	"^\255\005\377\347\2671\312\226\377\261\377\177\033\233\334x]"
+	.ascii	"g\005w\026\256b\341\215d\2216\352\377\240,\211\364\3753\264\354"
+	.ascii	"\031\233Z\376\307\006\234\331\305\013o$\322{\226\273\245_s\353"
+	.ascii	"\213<\300\333\255\2310T$S3\313\240\341\215\344f6\324\235\230"
+	.ascii	"_\263\353\213\314\313-\1772\346>\357Wa\036:w\030:s\350\272\346"
+	.ascii	"\rCg\rC\347\fC\347\247~\323\214a\350|a\350\3544t\266`\344\\\001"
+	.ascii	"\2003\205\266k&\02697\0259O\030:3\r\235\227\206\316\022\206\316"
+	.ascii	"\021z\331\234\324\312\356\004\255\326\2144t>\032"
+	.string	":\013`\235\003\254\316F\2533\200\325\271hu\036\256\316\302\325\231\025:\257B\347\240\320Y]\235\201\253s\272:\243\253\363\271:?\353\354\253s\1778\202[\313sC\366\366y\313\233\344\357\320\305C\347\314\372Mw]\267]\367\262[\255\273\255\203\256:\320\203\314\315M\327v\334w\034h*\205\257\360\315t)\361)|{!\3723riz\342\267\3361QK\245\023\276\211\351'<P\3161\321\307\341\263\344vk\226.=\323\243\202\214a\"\274\204_\372\276k\324\013\321\240\016I\3244\201\022>\302\333p-\366\353\305,\0360`\244\215Jx\003z\272\216[-\315l\315\324{\357S\204o8\355M\224\201\242\244q\237\024't\322\306\221\256ocmO\360\325_\377\325\034\223[\376\027\374S\3578&HS\341\243\306\254\353Jrv\231A\374\375\365%\275\372PfyG0\017<\351\023<s\333\245\365\342i"
+	.ascii	"\341u}\261\373(\277(\321'c9f\366\005I\177 \354\313Z\034\340\247"
+	.ascii	"\237\364Ng<#\004\374\246\262d_\372nagQ\322>iV\246\316\311\300"
+	.ascii	"\215\232\357\322N\323\200\3324\003y\3764_\213\326\212i\323\332"
+	.ascii	"\264\264\321N\323{#\324{\265\364\332OK\206E\214\360F\216H\321"
+	.ascii	"\220(\201\246\241\304\210\3715\215_d\244\337\203\362\355\371"
+	.ascii	"%\321\347\316\353<,\347\203\343\274\221\034\2276\372lH>>\321"
+	.ascii	"x\202\250\367r=q\3371\221\"\213"
+	.string	"\220\264Q\364\201s{hJ-\377\343RSWT'\020\210\225U\224T\215+*\365\n\253FV\025U\232UEUc\212G\016\254\035QSVB\0369\\Da\355\230\272\241b\351\350\361,\325\244\002\352\204\013\"\326\024\016\253(,\"U\216(\036D)\253+b\223\022W\365\230\262\"bUUY\021\331\245V\237\367\253p\b\255\337r\366\301\002\371\265+)\343\266\266f\235\367\216\201\350\266\356\246\232\377\261\005o7\237\322NQ]\212\213\265P\244\264S\246\244-\225\226l\215\027<\256/\362\321\363\223\326\314\211\336\321\003\331\274\241\txN\266X\212\256\204\tx\340\032\323O\031\300\227\270\034$_\200/\260\306\t\236\221\177\341A\362y\022#\264'g\035|26\324\007\254\020,3\244L\375Ho\370\"}\327A2DH\200M(\340\354\216p)7\204\024\303\027a\006\340FZ+\034\347j\220|E\237\364"
+	.string	"\376\361\030\355\206\317~\321\243zD\300\204\345Q\342e.\256M\370\303o#\227\016/\374T\2161\303\263\337t\275\304\306\314V^[\223\303k\370\016\033\236\303\243\2104|/I\264\367\364\027>\303\267\361\f\303?=\212\307\351-\374\205?\331\312\234H\213e\210\3237(kf\213\305B\203A}\001\200\262\250q$\205\024t\246hDf$)(\2441\200\002\221\2512v\021\240\301S4\013\222\024\206\003\036\206\177\307(\357\371\312\321uW\\\2244\204=P<\310)\226\322\272f;\262\262\033\320\353\r\346\210\261\267\324Sh\207\254\254\001,\214\312|\242vlz\213"
+	.string	"\003\f\177\251\235{\013\003\231\236\215\210m\224w2@\205%\b\273\354)+I\344\321\207\266\026\346\342\303z_\206\220\261\201\t\322\354\247\201\020g "
+	.string	"\260\221\225\001`\233\342\264zbw\301\345\261\0369\304kU9\210W\307$f\241\237C&\361\356]M\254\354\203\240\364\f2\373\313\310\002\267j\247\r\220}\276x1\347\324fv\027>m\222\236\025\036\260N^hY\r\260\205\036\261\200\234E\3004\024\202\205\207\201F"
+	.ascii	"\023[\326\323\302\221\352\241\f3\333\357\251E^V\247\222a.c\306"
+	.ascii	"{\225\213~\022\251\020\363\363\f\252\304\347\027\2103\302V\241"
+	.ascii	"\323D\257\252\244l\273\212\267\306\343\nO:4\245\221\351h=\016"
+	.ascii	"=\002\363\353\262)\215q\264=Z\347L\021\026\252\373\375\232np"
+	.ascii	"PV-\"\242ZU\360c0!]\224\267v0F\275\354\354\325\245\177\276\314"
+	.ascii	"\r-\320\"\330\331\317-\252\005\205o\216\"I=\034\243\301\"5\347"
+	.ascii	",y\242\277D\356\227#e\265\205Q5\b\276A\265,\2144'.\304T\036\246"
+	.ascii	"\253\001"
+	.text
+	.section	.gnu.lto_lockstepQueuePacket.80.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`%\002E\021"
+	.string	"\326\034lI\320\322(\035Rg\313\300\342qcg\304i"
+	.string	"\332\344(Yd\021\301\210\273\217\227\013>\255\276"
+	.string	"\005x\362v\350\267z\364\024\336\277\272\201\361p\344v`\250(D\033\032\301D\374\r?`\247\340(9py\325\032\331d\313\224\002U"
+	.string	"Q"
+	.string	"X"
+	.ascii	"\340\247i\266\216\217\"\3264C\263a\247\307\356\206r\306\237\322"
+	.ascii	"\016\316O*\315\0271\332!\371\210\265\203(\361\246\363\223:<C"
+	.ascii	")Q\303\227\340\246f\304s\256"
+	.string	"0\342\213~'b.\237\363\002(\204nH>b\314\325\244`w\2558\321\303m\272m\231\355\003\266\256\004,1=\356\323\217e\220\351q\026\300\303\204\217\035.\262f\2175\2252\366\021\034\025\321X\346\354\343\374&U\253\252\037\242+\210l\276\264\263\313\241\007dy3\250\004\312\366\325\276\315oh\307iy\200\335\\\022\320\356h\300\341\351\323\343G\300\317\323E\002R\006\350*\027\004YP\t\3407\222t|\346\f\274|\220]\016\027\375a\377\3470f\276\316\027T*\360\363R\356\204R|\260i\357\333\335\375R/\\||\017\213\347-V(,V\212J\310O\021\357E\366\204\310\021I\237\364\343Y\304N\273\266\343|\235\3570\370\272O\007\260\024\227\364\tI\003\t\fJB\330\n\345\245\202\205+,\225Jx\362b\tI\b\270\345Z\275BX\253\365\nQ\343^\346\374`\211g\223\267#\033\016d)%\336"
+	.ascii	"\375\370\032F\020J\226:\3743p\206\351F\243F\351C\256\t#8t~\013"
+	.ascii	"\030\3432(T01\001?#\250\350\301\200\260i\217\004\0306 \320\002"
+	.ascii	"\221\251\252\007\373\346\023\031V\242I\362*\360\331\260\246\305"
+	.ascii	"\"\261\274\r\332\326\030g\202C\303\335p\034\244[WT\326\025vq"
+	.ascii	"\221\253\311\022/l\323\245\220=\222\305\252\330\256\330\235!"
+	.ascii	"\212\213\323\023:@\2615\232v\212\324w,\223!LR\363\b\214'C7d\353"
+	.ascii	"%sHd\213\b \261\356:\365\354jftpo\270\277\210\366\\9#8\345\327"
+	.ascii	"\225\237"
+	.text
+	.section	.gnu.lto_lockstepNextPacket.81.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`l\005\035 "
+	.string	"\206\367\302I\240\330M:\220\306\032\037j\366\211\177\265\324w\032\377\300\232q\326\256\260\220\314Q\323>`\210\332\231\024_\357\341g\377\234\306\371\034\362 \217\233=\330\217{\255\2053y\225q\210\310'\2208i\227\3730\021j\204\220M\244L2\243"
+	.string	"\253"
+	.string	"\266"
+	.ascii	"\"7\323\335\357\213\234j\327\334\025\367\255\316\225\340\351"
+	.ascii	"\356\212]\363\364\357\255\271\237\372\356<\217H\254:_-\3220\025"
+	.ascii	"\234\n\326\232\264\340ti\345i\351\273\200\361\364,\016`"
+	.string	"<\335s\367\353\276\033\225|\342!U\005k\255\264~Z\221\317\227\344H\305\346s\317KC\033\327U\256\350\245\001\032J\272\223\342\214J\222\016\211G3w\023g\265V\232\034\022S\221<z\261\303\314\035\211\017\306\300\224\274wv\221\263\261\350\203\351\375\336o\200x\375\270\256rLgRB\255u\031\227S\372\312\276\273M\273\333`\227&\005\023(\340\340T\260 \223$\b\360\250\255\234\034\345z\t\360}\317\312)\223\034\013C\206\234\234Qg\003\367\276\343\245\n\301\214\272h\003\260\3157\312\370\337\221\360\f\300r\344W\034:\360\360\374n\345S\326Z\253\272\221\017\373\034\247\333\343\303\307\371\234\352'\004\037\267\247\372\016\221\031B\260[\027\355\372l\334N\273\177pc\fl\333\306\256\311k#\343\2551yibxgJ^\231\222\327,ycJ^Y\311[\226\274\244\214w,yi\311+\226\274M\3622\311\373\033"
+	.ascii	"C\033\227\226\025\257\271|\365\305\360K\005R%<\316\373\310\224"
+	.ascii	"\003(\316\250\343\302\202\027\236OPgT\324x:6\325\342\"\324\321"
+	.ascii	"\346\262Y)\026\253\253pa\264!\310\350\321\264\343\375Ac\030]"
+	.ascii	"\332\022\024S\320\264\305D\212\335}\034\277--\007\333\254\023"
+	.ascii	"\213\265X\343\251\330\007\272t\274\267Ye\255\325Aw\001(^\215"
+	.ascii	"\207/\300\264\0332r\203\370y\005\2518w\334\275$&\314\322\305"
+	.ascii	"cC\r\017\210\340\212\225=\201\234A\002x\001^\312\251\220\266"
+	.ascii	"\257\240\330\247\034H$\344\224\222\342\275\227\276\244h;m"
+	.string	"\320\370\246\220\305\210\307v\037\345[A\373\034{\0229w\347\256\373\347%\324\325x(\326Z\2538\203\362\344\2767\301Yr&\001C#L\364\3720\270\260cA\2076\364\023B\250g\210VBD\017\t\232\217\320\t\032\203\331\002\231\370\021\242\r\001\001\t\321L_\355mc3\200\001\326\332\266Db\2554\"\234\367\203Q\361pm\272\305\371\004\343\214\252i\232\266\351\337\232l\214\253i\004P\272\231\246\351#\205i\3002\275{\3068e\214\307\315\364\314(\353bJ\233\300\250\326\332\215\3312M\253n?b\232l\363\026\3235U\302\bud\033E\320\242\261\254\357{\357\224\022\200\005\267{\3268\235\370\270\235\035u\321\226M\266\254\177\353a\343!\327\262\271KG6\371\373\"\344\225\264\301x\340u\031\333\313\371\024w\250Q \211:hfFD\322H\322\2445\220\002\021\251\263:\020XU4\222\244\031\003\373\343\342"
+	.ascii	"\026\261\320 \302\350KT+?\035\300\330=Y\240\306b\036\262\350"
+	.ascii	"\325\005)\201_p\225\361`\256\264\373\320\tV\005\227r\203 \021"
+	.ascii	"\312dZ\244>L\232\251D\273\3741)\245\203}#\355I\027\3308z\316"
+	.ascii	"\216gw\346\2227\301\265\346\353\350\002\330\354\203P\350\036"
+	.ascii	"<*v^\345s\007\220\362 Io\313\202\307\367d\025Q\232\274\371j\202"
+	.ascii	"<\376\361Z`Vh\035\333ry\356\177i\330\366z\r\246S\2105\321\334"
+	.ascii	"TV\330!\030\\\325P\324\013>\r4\233\262\267\312\355\333lq\355"
+	.ascii	"\254\034\342\331\nZ\f9\330\002&\371\001\214\301S\307\223Qx\217"
+	.ascii	"\032\007\364\021\341\371m\365\350$\350U\2631\201\225\032\265"
+	.ascii	"\252\b \217\262-)\371\322Go\373~X[^\306\374\001"
+	.text
+	.section	.gnu.lto_udpThread.82.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\330\002%\026"
+	.string	"\366\346\217M\260\022R:p\345\211\221D\034\275>\0311\345E\233\205Rh\177\200\222\304\203\032\017p\035O\f\242\272*\324s\233\241\376\371;\270z\272\001\207j}\323\004=(0\203\256y\321\237\344\tV8&\t;\3226]^\342!\214l\262w\222\001y"
+	.string	"w"
+	.string	"x"
+	.string	"9\257i\2577)\217\315\227\224\307\027E\237\215^\334EN\324,1\371\272\026\327'\253\216G\250^\356\"7\362\224\300\261\347\317\321\322\007t3\245\034\362\371\034\223\t\204h\364"
+	.string	"\350\355H\223\033'x\\x+\242\027\302\222;\337\317_\344\003\245#\242\033yL\2207\330\204\205\366t\366^x\262\205S1\251k\310\007t\033\002!\347\334\226\327\363\275G\336\3352\272[B\2675\n\274\343\276\255\006\204=\357\2745\275\251.\256\234\233\273\307\035\301\247{\201\335k\316\236\364(\031\365\375u?\370>\257mkm\377\225\241jG(jBS\316;A\200\344\"&\256x\360\357\306\365\205\215v\257\177\201{\260\255\314\034\217\311D\304\343\3129+8\356\006\3461\ni\277\324['\311\371\2674\225\363\312\240S\363\370HO\302uo\rXS\370B\236tr`\370\b#\244\312.\261\037\036K=p\325\0338\330\363Z"
+	.ascii	"\221EQws\347n\007\210/\3600\345\357\207\372T'\302\364\213\032"
+	.ascii	"\026\213\335\020\255(\027>76\b\001\251\240\036\344\005\366\177"
+	.ascii	"\237\202~W\257\373\353\353\274\255\312\363\236\374\220\2049t"
+	.ascii	"\366G\217\330\326zLy\235wV\371\341\243T"
+	.string	"\0038\240\036C\306\203\252\226\307\037\336\311f\346|s^\237\351M\264~\321q\177\260\331\007\235\222\"\233\231\241\310`\263Z\007\027\032YM\200\231\303n0\031\3311\225\n.,-\351m\026S\203\335\322\031\031\230\232\306j\266T\005\245i4\263Zz\243\321j)\272\346\337_z\225\204O\027\327\315\305\351\023\333?\262t/\270\221B;8\266`\356V\020\\\300`\211TE\335\315\035\211\330\224\366F\320Q\3436lZ^^\312c{\357\220\351's\316\371\\1f\251@/\320\314R\013\314\320`D\342\024; \240\002\231\261\354\273\345\213\r\327#\202\273\360[\263\315Jk\337\366\020HBb(\0171\340\344\203\245\301\357\264\007\r\202\264\013\016\360\215\230Y\bQ\372\302p\332\256U\255\206\232q\216Mt$\363\262\263\343B:\230\027\311e0\356I>\225m\025\020\352'\\\353\022\225\2158+SD\371\200\304^"
+	.ascii	"\311\032\267\017l\214o\2306\031#\371uC\2411\bh\350\257\212<\314"
+	.ascii	"\006\361\3001\250\222\030\326.="
+	.text
+	.section	.gnu.lto_tcpThread.83.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\\\001\345\016"
+	.string	"\226\331`G\360\260(\035\260\312z\306Yh\365\274B\345\212Q\350\315\255\361\256oHn\177\327\306\\9\026\264\355g\266\377kb\367\215@X\23761\331\006T\247]]\003e\207\274\242eG\3142_\242u(\256n\226l\262eJ\001J"
+	.string	"K"
+	.string	"N"
+	.string	"\"g\361\037\333\347\347\240\355S\212\260\246\247OM\352\311\327d\344\344\324\204\250O\315\303Z\031\021 di!\331\370\372\314uC\250R\255D\313\345g.r\002'E\215\232\260\345\352Y\260\273\326V\310ro\267M\301v\003\373!\002\030R\364-\177t\030c\243J\242l\021\245\022\204\375\320\213l\264t\331\252~\207\332\334\304\034\307\214\335\225\331\316\302\346\213\204\355\223\355\241\227\261\316\007\354\272dnvE\004\346>\237G\361\230\223\255S@|a\361\264\200\321\260\"\307n\034<}\315`Se\273d`c\2452\3734g\241\342\303\270\204\244o}\372\244\355\363R\252\300\211\271\244t\246\255\205\024"
+	.string	"\257\030L\322\304`\205R+\335\370\250a\334\206\206\211\017\273V0\233\355\254vS\"\366\005\024\002#l%Q\236j\007\016\t\031\231x \243\316\373*\220\234\210@\001\035\330\2154\213F\036\2208\200\300\201^\311\327\201\234\t\251+q\242\017\205\033\001\261\351\304\3738\320d\3728\017q/]\334K\036\\bcJ\252\fR\377E\004\373\300]Hp\350s\302'C\002\003\235\b\024% p\002\021Z\326\001{\362\305\206\331c\326.m\267&\265\355\333O/C\230\250+\241c\026\322voW!,]R\0301\002\354\341\013KbP\301\007p\200"
+	.ascii	"\207\371\030\314\021\353\347\301i*z\346\320t\311\331$-\006\340"
+	.ascii	"\267\220-\202\220>\211\034\222\362\3532O"
+	.text
+	.section	.gnu.lto_systemInit.84.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`^\t}."
+	.string	"\272M\244\021E`^R\007s\223\035Oc\220\025+\256\374d\351\303!nX\310\253I\224\347\230\204m\033 _\311~9\326A\314GVA9{\316\311\370"
+	.string	"\302\262<r4\205.\025l\321\367v*\206\277"
+	.string	"jm\262\367\226)\245\370"
+	.string	"\377"
+	.string	"\020\001>\305\333\367\337\274\377^\377[\375\3574\177\347\377\376\377\366\005%\354`\001Y\3224\027\307X\321>1T\r\263\304\247\270\247\371w\273Sq\265\026rz\025\330\323\272\rh\345\214\233\016\326\350\342\b\254\253\300\264]\212\243\301>\205F\032o9c\035!\272\220\221b\027\307N\005\256\266\220u\265\235~\264\272\312\272\321\352j\303\335r\356\034\213]K\227++vq\034\013\263\230\303\036"
+	.ascii	"@\021\221\2577$\024\004\304\362V5\315\017\267\037\241Iz"
+	.string	"\200\006p\304\310\0275\321\030\330\373\272\007\344\353\207Z\350\207\327\0075P\027\233R\350\203F\213\263\311\332J\363\2203Ws\245&Y\\\317\323\362\365j\371\252\352FN\r\316\226\246\226\247\276\2462\005\306q,\324\264\372\234\032q\255\275\371\232W\351\322[Y\227\253\371\337hV\375\363*\304q\334\317l\352\3606\362n\347u;S7\373\001o0\031\\\006\233\301f+|\006Gyg\246y\210m\f\324\300\347\354Og\003\243\371\306`*\354\022\312\302\005\340\232\234G\334\271\333\242\372(\357\321\314u\231\2657'\353g\1773\223a\003\273\034~N\332\201\006Us\2303\255\355m\356\306\324\236\2449t\350\260\272\252\272\221\263\273C\365\321\3662\2565\270T\201{\366#jq\b\260\201`E\260\313\024\b\\\365\345n\022&2\212 \312\234\364\177+\343\002\223sX\323X}\231@\221:59V\277\247\215\274\2408"
+	.ascii	"\027\307Kg\252`\227\035V\f\337\231\276\234\264\343\f\352\373"
+	.ascii	"\3665\032\335K\316\245\355\b\256\272`\227\023\020\270\332M\204"
+	.ascii	"z\257,;:\253\234l\240\367\247g9\262qL\345\314\366+\216\305\330"
+	.ascii	"\236\304\325\206q|g\272\332~\\]]\362\356)\031\357\314>\362\212"
+	.ascii	"\357\350\2249\331\355L~\016\353\3664\316D\272\225\222~\236\346"
+	.ascii	"\215\024}\345\210w\333\327\333&\t\356}\303.\335\016\002W\375"
+	.ascii	"\371^o\034\327w\275p\342\274qq/\235w\356\235\371\313="
+	.string	"\267\263?~\254\300\212\230\364\340\361\326a\227^f\310\r\f\352\303\006\021R\366\2646U\352\332hx\241\373\363\305\363\352y\357V\177>\326\033}\034\237\343\345\363\372y\243o4\tW\2753\221r\317\315\013z\225\223Z]c>\001<\336\306\327@#\313\3222\353\361^\371VJ^\026\220\005U\346$\031Y\232\241=\037G\257\330\245\017\001+\260\005\025Z\035\316\375\351}\370\330\200\315\336\231k\036b\323#\341\273a\0340\326\263\325A\253r\262]\316lK\354psm\307\343y\340&\274\003\356\321CL\037(w\270lA\013z\3600\027\354ed\306N\035\370\213]\372U\373\345\274\243{`\366\004z\302@\b\035X,\316\347\300C\302`11#0\222w\246\232\211\342;&9\372\306\215\0266\315,\022|;\274d\365\247\303\201\315\336xOSn\033\303m\217\356\020y\034\020\f\006\241\212\304\027\300\017\030H"
+	.string	"\221S\036\2122>"
+	.string	"\221\304\"\361\327\r\202\f\202\f\202\020\0344\br[(\327hB\312\tI@\312hl\372\265\310\341\223\324\024R+\271F\327m\201PN\306&`\213\034\266\356\205_\007=\035"
+	.ascii	"\266O\306(\340\202_\277\030\026\335\026Y$\002u\324S\213\264?"
+	.ascii	"d\030!\202\303\005\017M+|\035\f\006\221\304\"\223\212\250\026"
+	.ascii	"y\234qDQ\204l\335,\325\"\217PN\306\027l;\005\233F0\211\020\""
+	.ascii	"[\027\356\020),\022\207QB'\367(\f\002\333(\325\272B\244\321\350"
+	.ascii	"\n\205\234\261g\"%\352\240T\271\252O"
+	.string	"\274\257\376\202Y\273_\266\267\355\335\352@\225l\346\252\004 \323\204\354\311\306\360P\003@){\232\2341\237\245$I\2317\372\316T\312=7\266$#\357\2317\r\273|.\272%\357+H\276\204\021Y\363\306\2753\223r\317\r\rz\365\313\376|!\356\347\250\314yG\347\341\025x\200\302\250Q@\306\230cdDDF\222\202\024\322\001\340\002\221\031\"\017\021 !\223\020NQa:\370\333\270X\030f\322\254\002RR\001\354=\2543ct\235\301\237\341\211c\204\335Q\n\224~*\350I\355\022\r\334\263c\256!\357\357\245H\002\nj\321Q\377\200\352\200\322~a\267\343\202BY\026so5\016!\311\03613\336\302#A\013_\300GN\363B-\257\357\342\262YmC\333;\367 \230\230\274\312\216zl\206\321\322\272\024VT/\243\367`\003s\226W\367\243\373\367\3513\334z\024\312O\377y\317{<\241\260"
+	.ascii	"\337\0138\355E\277\203n\265foS\032\337\315\364\361jS\245\244"
+	.ascii	"\252\251_\216\200\275\037\024l\026k\252\023`\351\277<\300r\213"
+	.ascii	"\004f\221\272\205\304y\005cm\031\263\232\017\021\254\264\020"
+	.ascii	"IP \026\036a\276\361\271l\013\261\233\232\353\376\3713\371\t"
+	.ascii	"\260\230\\-\013\372\372\225\016q\017\345|c\225teLp=\370$\350"
+	.ascii	"l\360\212Y\027\331\207n>\263I\021\211\220\202\231L~\023\036\027"
+	.ascii	"\036*b\262\222\363\266\347F\325\354\023\n\265Z\252\373?#1@-\331"
+	.ascii	"\035\017\334r\370\332\034\300\347\237\214\357\322\373\322\033"
+	.ascii	"Ze\b\254m\005\264Xf\0310s\216\235j%W\210>\336{\207P\003"
+	.text
+	.section	.gnu.lto_systemReset.85.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"=\n"
+	.string	"\346\222E<\020%)\035\340]j\243"
+	.string	"@\022\200 j\362\340\352\n\220"
+	.string	"\345\032\367\202\370\006\276\026f\037L\354\t\304l\3537d\002\232\304\035\222\200\025\2228\326\204 \007\210\024f\0355\366\3312\2453"
+	.string	"3"
+	.string	"4"
+	.string	"6\231\003\005\250u$\207\253>s\307\305\366Ev\331?\247\255\324\353\314Djc\255\225J\225\273\276.\337\033z\250\265zc$%\267\274m\003\333\016\366\031\002=c\320\307\346\034Z\277&\264\025N\303\341\206\317\016\201\020\212\360i\267<\3661\177\366\n\030\032\200\033L\276l\332ke\212\375\200*Q\354\257\367\353\017,O\243\275\355\233cZ\271\200\223\235\214\326\317\350.\355\023\212\004\362\332q\274\224J\325}^\316\226Q6c\342\257:\337\3467+\237\305\254o\037\373\364\277\356s\276\004>\020\275\320\223\300`yb\330\nM\004F\225\"( &\250\350\245\300\223H5T'\026E\201!-\221\374mx \025\277\017\244\242\220\357\202M\270mq\021S\307\033L\276\034\022"
+	.ascii	"{\345\373X\033m\263cgZ\005~\2401\252\020nm\232\305\266<\354\003"
+	.ascii	"\253)\345TG\255\006\317\245]\030u\005K^\206\300\f@\001"
+	.text
+	.section	.gnu.lto_systemResetToBootloader.86.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"\325\n"
+	.string	"\246SJC\020\351(\035"
+	.string	"wk^\021\263\341EXA\330\333\267\277\340\017m\347\030sC\007\3207 %\n\236P_p\340J \262\327\257/[\210\261A\n\003%4B\025\224\026\252D\007\024\005\235\324\332\330q\313\224\0026"
+	.string	"6"
+	.string	"8"
+	.string	"\f\333 6\340\265\007\265\266\334&T\007\222\001\216\355{\254\262#<VS\277`\306\"\263\325Zg\244\271\352\253\362\275\035\213Z\253\267\345\362r\307\333v\260\235a\237\"\224\273\224\001 \274j){sg}\003\240=\361\002&\256\270<YX\231\021\227v\ne\337\362\005\274\003\226#\201\306\212+;\266\3328c_\241F\031\373\353\375\372\001\0370\232\215\306\212+\177\366\n\276\263\321\306\320\313\025\363Y?\204{\264;\022H\345\262'\360J&\023w\371(o"
+	.string	"\270\b\300\370'\316?p\004'\337\306(\272o]\372\001\206\370<\221\216\216\204\224^PQ\350\201\336\006\b\312\013\301\0248z0)\244!\302\340\230\241W\372\272p\222\230:\324$}\340\f\201LK\274o\206\224~\323\323\361\335\260\022\267=\002\022"
+	.ascii	"{\345\373X\033m\263cgZ\005~\2401\252\020nm\232\305\266<\354\003"
+	.ascii	"\253)\345TG\255\006\317\245]\030u\005K^\206\300\f@\001"
+	.text
+	.section	.gnu.lto_timerInit.87.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\005\007"
+	.string	"\342\21404PU\322\030"
+	.string	"A\304\374\261j\317\335\007Yc\024\200o\316\254\276|t$\200\277g\237\031d\221\214l\032M\013\302*Y\244\302\315\n.s#\345[B\366\226)C\bg\025\352HH\nT\315\b\202?\260\341\241\343\020'5!=3\206*\017(~dE\204\005[\024\224\214\323\262d\344h\253\322\276\021\004\312\266\3618\006p\353\212\305'\250\312\305\n:a\bx\304\003\235>C\303i\266{9\331:\036\366\032\346\336\310\253\264o\364\017!FehvAnlv\233\\L~\345|\375\214j%\253-0\037,5\273\033\037\211^\352\256USt \023a\352\002\030vw\227\211B\364\247\277\301\277\360\213\004\n"
+	.ascii	"{\3117c:\363\206\271\241?y\256\347BN\026\354x\031\002\\\272E"
+	.ascii	";\237"
+	.text
+	.section	.gnu.lto_timerStart.88.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375 \305-\005"
+	.string	"2I\"*pm:(Y8\214\022\376\357\212\343\003k\252$rK-6\237\222\0233\201H\b5\235\022\350\3039\357S\305\006\212\342\336)\005\306,\204\342\220\320-[\314k\323G\343r(6#jU\326 \331\324M\323\246R\341^\202\225DN\354\260\213\362b\037\260\022\264c\001t\221i\267r*m(\340\321\330>e\316\036=\314\354;\037\n\207\264\273*1\347\0369\377\233\017\274\257{\024\030v\327\321\373,\267\274m\202m\3136#\t"
+	.ascii	"{\3117\323\342\234\031\001\276\3345\234,\204\3612\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_failureMode.89.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"M\t"
+	.string	"\346QB< \005)\035 \241\201\243\025X\201`\214\351h\231\f,`\243B"
+	.string	"\320\365[\250Sc\221\261A\213\fcFu6)\312F\202+Saf\231[\004H\305\n\0348g-\331{\357\224\002-"
+	.string	"2"
+	.string	"/"
+	.string	"\247\376l\232\207\261=\213\314F\312\315\356V)b\031\277O\031?\037\001\366\371q\271\275`\217\234\321\356:\272^\0367\275\355\221m\222\355\225\224\243\006\305\022\264/\373\3434\230y\214\315nG"
+	.string	""
+	.string	";\243.#\036\333\217\366I^\362]\226\341\200]\020\225\226\335\360\300\265s\n\372G;\235\037\320\002\276\004\375)\301\317\335])A\333Z\214\362\341OV\002\261\335\326]\026\235VB\301\251}\201\021\357\362M\276\301\274\3144$\313\016YQ\206\330\017\336N\004\240P(\364\300\235\272\005\316[I\240J\020\016\037\356\324\245\246M\"\205\006\022CUq\021^IU'P\245T5y\025U\004rG\301yU\325u^\365\3306'\013"
+	.ascii	"~\311\005\346d\344* [\356], VS\202{q;m\266\f\334\270Bq\002"
+	.text
+	.section	.gnu.lto_indicateFailure.90.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"u\n"
+	.string	"\266\023KC \307*\035\220H\342\t4"
+	.string	"\232\030p\256S\230\304<=&\f$\253\273\241"
+	.string	"\306\006\306\024\233F\350\321"
+	.string	"H*\260V\330"
+	.string	"#L\253\307\0303A\016Jx\202\3731\255\200'\t\211\016\266\255\021\262wJ\0013"
+	.string	"5"
+	.string	"9"
+	.string	"Us\256;\003\346\334\366\005\3149\2176\355%l_\200\206B"
+	.string	"\302\356V\332\362\361s\364\037\340\033\322\305\372\314\200v\327\223t\251\334\364\266\035l\233l+\b\333\356\256\351\313~\354\237[\203\003\006\037\265\335\224Z\204\235q\007\\l\237c{\226F\260@\266\273\036Kh\316\371\323\376\313\001\214\217\221x\263\273b@\266[z\034\252\372\351\f\246\276\260\212 \030VN\271\337\226\276\314\361`VBM\234\231\223^\300\007\250\024`\273\255\223+M\013\004q\316\026\031\231'=\0234\230\235P\226]\262&e\261\037N\030=t\235N\307\343\033\201\031\244\216n\"\004I]\210\3123\221\272\n\213P\367\205+S\311\273\210\020Q+\220B\364\276\324\027r\276\021x\332,\372\204604\252\370\201\204\236XQ%\357TEa\013"
+	.ascii	"\3369\312^\222\310\330\013?k\202\263;\256\241\2550^P\345\b\250"
+	.ascii	"\333\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_nanos64_real.91.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\227\001\035\017"
+	.string	"\006\335dD"
+	.string	"\221(\035\233\303\357\234\016\204%\333\205\n\226V9J\273\323~\230\276\215K"
+	.string	" W\004\354\003H\342\277\372a\224\265\257\336Z\374\250K\250\264\006\355\r>\352D\005^_y\215V\225\355\333>!do)S\nQ"
+	.string	"J"
+	.string	"Q"
+	.ascii	"\217\231\003;\212\324?\324\327K\321\300x\230\311vS\006<\272\343"
+	.ascii	"\036\277\037\277\304M\244\254\002\371:\254h0;0\244\300\261\373"
+	.ascii	"u\376\376\241=r\007\240=*\207\253\236*\377\261\307\026\0312-"
+	.ascii	"\225\325s[\260\273\316\226\312\312\255"
+	.string	"\267-\300v\001;\r\004\004n\233*\344[\376\230\331\034\262\013\272\262\277U\352\006\373p\365e;\375\201i\017Lw`\232\243\351\rLk`\232\323\364\006\323\032LGMC\230V\230NM\337\003B\006\024\027\211\b7vQf:6Fl\001\342\337o\247\034_\201\362?<\032D\312\267\036}\222\366\270)\002\026XTUM\357\271\240F\325\027&\217\205\240\206\314\200\315\274\306\210\227]'\260\260\313\n\220\252z\257\345$g\276\246\246\rOfKxL\304\355\356\201k\210\210\227\353\004\214\2253sy\227\307H\\+\246S\272d\244\301\003\006\016\272\023\310\244Dr\352&\204HD]I\311\324\215\210xD\001T\352N\243Q\251\343|{\270\372\372\250\bKO\214\202\273\032\024\310\\rf\217~\364\036\214\216j\352\321\030\343\205\340\250F;\033\345(\210\013\026\241\230\215^\206\205S\315\246\234n4^D\276\212\037"
+	.ascii	"{\311'c\232\211\f\213&\373\260dI\365\206\320\306j \205c6B\301"
+	.ascii	"\254 ?\260\034\020\210\260m&\321y\013+\301\202\360\262\020D;"
+	.ascii	"=c\033z\254\263\371\373-\341\302H]\315\242\302\330\222T\343\340"
+	.ascii	"n\251\026\210\223b\272&\031"
+	.text
+	.section	.gnu.lto_micros64_real.92.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\304\001%\020"
+	.string	"\226\236kF\340\262(\035\240C\001\307\247\341#\321\275p\024\211\211\f\331:\321\013tB\315r\034\023\244y\244\203\331a\001!)6\255\274&\247\nl\320\274#\206\341s9\034a\032\026B\2012\r\360\327\254\375O\032\331[\312\224\002U"
+	.string	"Q"
+	.string	"["
+	.ascii	"\336o\253\3702\213l\336B\345^\312\267{\001\311(\261a\266\373"
+	.ascii	"r\340\321\334\366\370\005\340\257x\215\212W\002x\"b\264\034\r"
+	.ascii	"\030p|\354z\234\275\213h\217\333C\264G\r\361\225\347\212\177"
+	.ascii	"\331\341N\216/\006\303\362\374,\330]g\f&\346\326\333.`;\201\235"
+	.ascii	"\250\336\3627\227\265\266\030\202\333(\025\3621\213\350\364\374"
+	.ascii	"\230]P\026\333cI\005a\037\256~\260\2356\301t\t\246I0=\202i\021"
+	.ascii	"L\2074\r\202\351M\323\037\230\326`:\3024\324\264\302tj\372!\020"
+	.ascii	"f\\dTD\300\261\353\362\001\331\236\270c\342\001\037\335t\204"
+	.ascii	"'\306\312\177q\030)>\211G\247Z\371\330\243\337\322\036?z\234"
+	.ascii	"\021QS5\231\026\235gH\321!\007\007\024;4\326.\371>\027\026va"
+	.ascii	"\003\240F}G\323\222\237U\241F\033'\227\251T\t\350\260\271\246"
+	.ascii	"j\217nfK\270l\265\355\256\202\353\351D\215\f\013\033X~\001(\257"
+	.ascii	"\264\311\251\301\003\006\016\270W\352\304\205zq\023T\250\025"
+	.ascii	"g\342B\341N$fQH\271\270\027\213\345\342D\336\336&%\201i\213S"
+	.ascii	"\340\256\207\222\331M~.\251I\337\335\200\361\210\331]\033 iI"
+	.ascii	"3\247\243\031\251\246$\325vt3\"\335t\244#<!\025\2014\244\002"
+	.ascii	"\202\344\250f\200\3645\002\" \200\002\2312\342\003\373\363\311"
+	.ascii	"\026=\254\347\236\322\235\375\335\030\255\326ap\232\007\213\242"
+	.ascii	"_9w\364J(\210\323\330]fqi\304b\33357Qt\324\300\217\207'\"CN\377"
+	.ascii	"\306\327\315\235\207m\3060\266%\216\242\001&\235\334\311\362"
+	.ascii	"\r\220H1]\206\f"
+	.text
+	.section	.gnu.lto_millis64_real.93.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\304\001=\020"
+	.string	"\206\236kF\340\222*\035P\303\242\256\347\341\331x\370*\245\231Q\324S\250\315\350 \264\377\222\360L\2614\206\030\210\336\310\273\031\346@\245\232J\237\345\230XA(\341vd\\\3070\006B\002D\354\006\013\303\265%\215\354-eJ\001U"
+	.string	"P"
+	.string	"Z"
+	.ascii	"\277\355\362m\366\324\316\302u\260\365\371\251pb\214\340p\233"
+	.ascii	"S\345\300\245\275\356\362\023\200\257\342/.\277\004\200 X8\231"
+	.ascii	"\r\027b~\314\tz\006?\302]v\027\341.\367\303_\327\227\177\333"
+	.ascii	"\343\214\016\036\263\025\330u\263`\316i\235\255\260\334{\333"
+	.ascii	"\006l'\260\225\024z\230\333R\335\f\301\355\025\005\375\314#5"
+	.ascii	"@ 7\013\013\263A\230\256\007\373qn\213m\265(\252CQ\r\212\352"
+	.ascii	"OT{\242\272\263jNTw\253\336D5\027\3252\252\343\2527\252u\325"
+	.ascii	"\027\201\360\222BKa\252\2313%\0242q\310\031\022\007\003KB\003"
+	.ascii	"\343\344\273\370\213\226/\342\322\245\224~v\351\247\270\313\315"
+	.ascii	">&\204\\]\216&\243q\f(4\344\310pbf\306\264M\302\260E\2059c\004"
+	.ascii	"\342\312\375\347\"\323\320\273q\245\r\224\333L\273\005t\324\276"
+	.ascii	"\272\353\343\273\331\021n;usN\005\337\221\211\036\264\025\265"
+	.ascii	"\230\206\356\002+\226\372d\324\340\001\003\007\036\253\204\242"
+	.ascii	"\"\261<\t&\322\311;Q\255\274Q\211Q\023J*\217\205B\251<\0178\037"
+	.ascii	"\347\266\210\266$\2662\267\342\234\035Ln0\032:\264\242\375w#"
+	.ascii	"\026\304\001@\033Z\225\371\\>\313-h\271\035_\t\317v\373Y\022"
+	.ascii	"\232\316z8\333\331\001CdL28\373\232\315v\001# `\2021e\264\007"
+	.ascii	"{\362\211M\327\3210\177\332\327\215\375n\017\243\260j\035\006"
+	.ascii	"\247y\260(\372\225\373\016^\t\001\"\032\273\2209\\\032]l\353"
+	.ascii	"\315M\024\0359\360\343\302\203\310\200\323\207\361\265\346\316"
+	.ascii	"\30767\214m\211\243H\200\311'\363dm\003DRL\327#\003"
+	.text
+	.section	.gnu.lto_micros64.94.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"\005\013"
+	.string	"FTJA \213*\0358Q`@!\354`P'\f\240\364D\371#\005\240\021[\207\021\361Tx-\032\234hk\331\023\026:\1770\324\204\301U0<\207\307"
+	.string	"4"
+	.string	"\2173.\360\001i<lS\177${K\231R7"
+	.string	"7"
+	.string	"8"
+	.string	"\022\332\345\032\270w\031W=\377\001\f]NP\217\0340\n\037\210\372\306\212\024\201\030\004H\212\225\n\257\322[W\0238Ru\270\3149\255\037x\272\265\333\336\260m\261\177\021\253\262\037\347\246l\253\245\325\273jU\365'\030\013~!\303\234\002f\033\346KF@`\033dS\374\004W"
+	.string	"\262G\021\256N\032\204U\311\201\2069\303\315\341'\264\313\311\003qU\2567\3608\016G\273\224+\003L`)"
+	.string	"\013\223\265\253\362;\332\367\303\005#\251\314>\203\207\035\377\200K>\372\357\322\377h\227\337\267n\201ABl\200Hgv\030\322\316X4<2:6\217\006\244\303x\266\221\020\314f\313t\235\315R1G\242\3516\017\307u\033%\234\217Q#V\356\256\311\366\256/\242\035I\212\332\"\033\375\247\273\033\272\254\300\354A\024"
+	.ascii	"{\345C\030\2130\354h\341z,\200\212Y!\250\246\250\022n\325\021"
+	.ascii	"\260x\210\214\214\250C}\270\3205\374v\304\033\230 \307]\271\331"
+	.ascii	"\036T\230\321\264\n\n"
+	.text
+	.section	.gnu.lto_millis64.95.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"e\013"
+	.string	"\206UM? O\225\016\2205\360\364\335NUD\f\202\314\023ifLX\301\007\355P\342\314"
+	.string	"Y\346\212\326\362\016\240\177~\031Y\031\256\202P\360\002\200\0078p\230=\353Rq\315m\207\022k\367\336R\246\024:"
+	.string	":"
+	.string	"<"
+	.string	"\362\021\362\r\371\270\027\316=\302U\316\307\360<\217\220\322!\004\025#:\257\364\205"
+	.string	"L\025^\031^\bJH\264DO]G\036H\365A\231sZ;\217t\313\3336`{b\177@1\373\363\350\236\354\303\271&\333ji5\\\365\256ZU\375\013\001\254\227X1\347\204X\213\331\212\"4\330\356\330\021\237\303;t\314u|\030H2\304J\004\202\305\234_\346\357\034\001\017\024\347\244\256\334K\330"
+	.string	"\272\352\0378-\223\221\217\272\017\327\t\224F`M\324\356\311\327\310o\002U\212\220\302\354{\370\247\3613\370\001G\337=\372\034\371\370}\352\001\\&^\024>\032\266L\n  p \333\\\024l\225M\326`A\005\223Y6M6\221Xsp\331\262\215\246mY\344\233_\223\r\341j\254\\\270#\333pM\371,(F\324f\200\321w\273\273\236\303,\304V0\024"
+	.ascii	"{\345\303\030\213\225\016\357\262\260%\263WPM\201\024D\270_\224"
+	.ascii	"i\260x\210\214\214\250C\001s\241k\370\364\21020\221\217\273r"
+	.ascii	"\263=\2500\243i\025\024"
+	.text
+	.section	.gnu.lto_micros.96.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\362"
+	.string	"=\f"
+	.string	"\206VQA0O\224\016G\214P\264\013Q\200 w\244\f\376*\264\242\013;d`a\322\337z\312Tl\320Qx\373\177\377\005\255\225_l\263\365Vu\024\315=n\f,\240L5\025#8\222uh\357-eJ\001?"
+	.string	">"
+	.string	"?"
+	.string	"\361\360]@<\\\f\017\035\276\325\220\377\017\177\036.Lp\235\350\360%"
+	.string	"I\301u\025\276\217@\352\202H\200\256\3640\025\037\246\317\353\251#\251f\030\220RZ\271\216\302\035o\233\201\355\211\375\006\001\206O\375V\275V\253\344\342\260b\245\341\220rB\013\206\374\200'V~\210\317\317Ax7^\204H)\257C\373c_\207\267A\366\345w\270\007\220Cof\350b\211\026\246\021!R\316\f\373\200\250\026\211\267\252\215s<\310hZ\204\022:X\032\301C\262\366\233\270\353@\003\244\244#\366E\\c\343k0\307\243\347\016}\317~\276"
+	.string	"\013\024\"\026F\332\262'IWe\377\311M\331O\035\237\006\256L\020,8\240 \353X.\033\245\223i0\224LV\3318\331\004\263\006\301\262e\035M\333\2629\372\203\373y\t\252c\303\276\215{\262\255\213\215\226\344\270\272\246\030\020\200\372\363\202\321spwE\037\t\031"
+	.string	"z\345\333Y\r\001\231[kyh\335f1'\b\275z\207\026\255\222\f\001\017\221\330l,\201*#\004"
+	.ascii	"\304\0032a\271\206\347i\242@\025\257\240\"\033w\232f#\251|\301"
+	.ascii	"\\\002\215\240\240"
+	.text
+	.section	.gnu.lto_millis.97.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\006\001\265\f"
+	.string	"F\327S@ \221\222\016\237[DL\237\337$\034\037@Dj,\313\376\033\022\351\355\225/\024\021A\274\\\257\226\315\356\317\002\215\200O\266\3605\3556ab(\004X\003\310\025\020\303\240Xx\331:\262\267\2242\245@"
+	.string	"@"
+	.string	"B"
+	.string	"\324\t\274\273\375\200w\247\031\376\271[\315\217\377\017_\227\0302\264\255\344n\037\304\240\3206\n\327-\200bA$`3YJ\305K\350\361y\262e\231\322\001\b\241S\333&\334\357\266\031\330\326\330\307\002\233~\233v\233^M\253\323\t`ZY\221\362\341\002B\t#\032\360\305\235H\361C<\216\034\204\265e\206\f\204p\272\263G\354\351\3566\211=\371+\367@\342\317F\r\3333\021\023\032!\003a\254\002\035o\325\351#t\310\336r\022\035\036\226\365$\230\026*\t\301\005\252\350A\236j\003\026\030&9c_\304Y@\374\r\016\021\311kw\276\210>\336"
+	.string	"\f\013Q\005P\216\354\230\245b\260\277PQ\354MK\001\346h\022,@\240\240\302:\236k\203U\037\034\033\217\212s\205T\032\312\226\203\316Ua\226uU\021\364}\033\242\024\034\324\251\244'\266S)\220f\22645T\303\005H?z8\362\332S\325\222\317\\\030\225X\351\305\003\033"
+	.string	"z\345{Z\r\001\331\332\272!\264\205\257\326m&s\202PW\241\301D\310GCh\bx\210\304jc\tT\031!"
+	.ascii	" \036\222\t\3135\274S\023\005\252x\005\025\331\270\3234\033I"
+	.ascii	"\345\013\346\022h\004\005\005"
+	.text
+	.section	.gnu.lto_microsleep.98.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\266\001\265\020"
+	.string	"F`qF\340\360&\035\303\336\013V0\257\340\333\254\323\230\037\2710\216\036\217\252\232\254\375`\252Y\217* \232\017\346\237\351\337\252+\300M\232\375\302\314\203X\020\017\355\020_h@xqD\234\314\210\247=\t\363g{o)S\n]"
+	.string	"W"
+	.string	"^"
+	.ascii	"[+`\256\343P\344\001\342\341{H<\264\313\256\361\332\315\036h"
+	.ascii	")\246giw9\355`M\327a|\232.?38uG?\262\327!H\t\232G\230|Om>0R\262"
+	.ascii	"\227w@'\205\007\224\314%\365\335\007\234p\202\035\375\310h\236"
+	.ascii	"\034\tv\327\031\223a\2709n\273\202m\022\373M\001v\355\225J\263"
+	.ascii	"O\"c\350\203uf\177\347\377\200\351"
+	.string	"\030\323\020\246\337K\253\246S\323O9`\222\251Y\261\362\331\225yj\332\"\350b\304m\277\375wF\331\265\363\270nc\371\302\314x\264\020qK\332\235!ph\003\035\207_\220\247\375\234\353\270\276c\301\036\27368A\0337\0220}]\215h\330~\236\322<\362\247\211\323\315pI&\247\362*\336\251:b\366\tJ>\3664\265\341V\364\242\257|\273\273\2524\265#\274K\311\236\230R\252\352c\2348\220\356\241xM=\214\tX>\371C\257\017l\020\3058]%\332\253w*\212\264\273$\002P \325\344\334h\311\247+\2554Q\255Px6\031Y\320@\001\003\256\245:a\225\2648\t(%)\234\tk\205\033\021\361j\202\212\305\265V+\026\207\252\355ufH\024tKjQ\230Y\336\256\r\202$\033\b\2504\377\312\202\303,F\324\231\337-\024\243\206\360(\031\371@-\013\205\360\375\"\036F\205@\0274"
+	.string	"H\033BI|\f*\352&\037"
+	.ascii	"{\311\027\323\360R=\340\273\266va\f\013k\n\346\241\220\202\213"
+	.ascii	"S\003f!\t\026\343lu\031D\272a\327\210\b\263a\023a\210K\030\267"
+	.ascii	"\212A\317\313E\253E4H\351\251pp/\234\242\022\334\033\267?\020"
+	.ascii	"D\204A\007\315^\355|\002"
+	.text
+	.section	.gnu.lto_delayMicroseconds.99.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"M\f"
+	.string	"\206VQA q\223\016\037q\204\344\343\341\027\2052\201~\377\331\021\354L\210\300%^\241\200%\320\"\363\034\255Y\024\203\200\032\201\240\b\265\230\226\027`\205\004\200\032\340\221\r\b\351\002\007\343Y[\373{o)S\n?"
+	.string	";"
+	.string	">"
+	.string	"Z\210=\213\315\244r\332\335\250 ~\3759\315\313\317d\243\277K\311\035\202\023\f,+\271:\002&\034r\004\310H\334&\006\213\351)O\013Y)\323\243\263\273N,\313p\303\333^`\373\200\375\217&\366Q~\250i\247i\325tf\372\231x\3413l\354b\330t,\313{1Bc\373i\237\304K\\G\231`\314\256\207\025.v5\003\216\227\277\315\007\300?w\001\360\317\227}\343\001 TH\b\374S\305@Mupja\332\221\024d\354\211\332\202\327\007(j\220d\213}\023?a\371\",2\222\307\376\374\021\370w}\312\013\320Hq\242\201\224\233\255\215R?\330w\273\273\326\226H\372\303Q\320 \001\203(\002A\250<\242\030!\344\001\211\237\312\212\234\215)\t\240*\212(\252\212\032m\337!i\351\001H\250v\350#\217\331\351\350-\035\266\025\347t\345\030\016Rn\352\364\0256\224\256r\025\001\033"
+	.string	"{\311'\323\"\f\247-l\306\004A"
+	.ascii	"\251\231K\250\253\320`\031\244\201@ \345B23r0\r\0267\221f\n\355"
+	.ascii	"\300\227\021{\247\016\013\026@p\261\201XM\031w\371f{PaF\323*"
+	.ascii	"("
+	.text
+	.section	.gnu.lto_delayMicroseconds_real.100.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"\035\007"
+	.string	"\362\r24Po\322\001 [\256\025\032\nU,%\017\b\256 \211Jc\325*\317\377\021I\214\225IDH\031\255\327L\036\0045\303hIT4\025U\027\377F\366\226)\005\"\t,\310\223\260\200\240\220V\250\241\372X\t\341\360yHP%JO\247TD\250J\213\242\252\344h\367\273+\225ad\263p\027}\210\256\235\240@gE\027\221\r\303a\255\206\241\353h\375\376\277\256\324\332\304\306\227\033~i\371G32\337&\226\020N[ck\022\227\\6\251\350\346\347HY\371\265\202f\200\247\216\0074\236\236\0054\236z\2650\326>n\225Q\006J\314\377t\036\276\214W\355\023o2\022f\0048\370_\314H\032\256s[\202\266\006mA\002\t"
+	.string	"{\311'c\032\366\f\217\263\256`\336%"
+	.ascii	"b5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_delay.101.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\013\001\005\r"
+	.string	"\206WVC\020s\223\016\033 \276\220/?=\330\300\3743\277\307\020p\"\016\374\310d\363Un++T\022BD\004\215e \332\006M\013\2541\254U\371\224\f\200\022H\324\277\001*\rH\024\272\326\277\021\262\267\224)\005C"
+	.string	">"
+	.string	"F"
+	.string	"\366\361Oe\276\006\007\323\213!sN\271\"2\315\036\341j\346g:\223G\314\3510\001J\b\327\235\276\260\200\367\001\025\240;\201\033\034-\246\263\\3t\233\252\325\231sZ\271n\303]\335\266\003\333\b\354_\b\030\274\236\375\225\337Zu\204j\270\352]\265\252\372\032i\3429f\314\251!Ed\266\304\033'4\266\257\366U|E\366\025\013\036\231\023D\t\033s~\007,1\217\233\017\250\036\341\005T\217\316\034\327U\021\340\221\242\355x\246\322\335=\n\212MS\266V\267\002\352\207\251\310\002\227\021\2475I\365\215\340\242\307\211\276\330g\361\026$>\t\223J\364\334\243_R=~\317r\003:h\244H\3214e\177\233n\b\227\016^\244\221\372\303i"
+	.string	"\201\301\003Y\002\2050OIN\020yF\362\203\221$g\343\213\002\b\223\245\353\302\244\346\323\276\236;\332n\021\200Zk\207Dz\316pM\024\250\274"
+	.string	"\201qe\234\013\002w7\356Q<l\207\361\030\022F\001\033"
+	.string	"{\3117\323b\2353\360\253V[vbZ\005yu\270\006,\201\224\307\303\f\t\214i\260\270\213\304\002\313\b3v\024H\317\300\020\223\343"
+	.ascii	"]f\210V\001.!\020\253)\300\035\271\331\036T\230\321\264\n\n"
+	.text
+	.section	.gnu.lto_simulatorLoopYield.102.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`M\001\325\r"
+	.string	"\366\027YD"
+	.string	"\261&\035\274\230h\247:\347\243\001\261\343+\034]\353\032\016d\232\314\246\344\217'g\3520\241aj\350 \333\307k\354\355\f\275\305(\247\243j\322\0324\351n\272\261\255\032\004*\350\370\275]#{o)S\nI"
+	.string	"@"
+	.string	"D"
+	.string	"\360\255\232\374\316v\372\225\362\370:d\244\240\201\322A\363l'\n_\307\312\212\n\034[\352\001h\301Rc\242\217\223\362}\005Ll.pl%\357s\223zq\231\253\204-S\275<\346\234Vm\233psn;\202m\220}\013\001\337\313|"
+	.string	"\r\213\030\025\224v\366*\323u\261\277]\327u\336\026[\325Q\325\253j\275\372\035i\342.n\314\211\322\331\2303P\005\214\355{l\262[_\275\314\237\210I\211\260\231s\312\325p\323\257\030,\273#\256\315\200\027E\335\335\237\254d\017q\226\210\301h\024\017u\241\007\256\306\252\300\200\340\036G\355\007\"z\315\273'\323\240PaX\217\304\357\002V\214\022\275\261\377\341\252\021\237\203!\220\350\265C\237$\036\006\006\001!Pp \201,\205B\260\217\222l \372\030I\020LD\202\004\230\344 \204\311\022\211\204I\317\n\365m\261\007j\2637\347\234W\350\303Q\230\311\366d\0020Z%\342\2728\356\256\266X\034\211\220\270\0066\374Z\315K\006\370"
+	.ascii	"\252& \260\002\031\302;;\345\023Y\254\017\311\034\331\n\365\026"
+	.ascii	"k\316\362\374rg\343\272\005\373\232t\t&\300I\261H\033\211\021"
+	.ascii	"\265\230\212\035u\243\205\354a\033X\366\270\205[\001\222\357"
+	.ascii	"\225a\273\003\223\205d\032\360>X0I\230\366.j\\\267\013v4\206"
+	.ascii	"\263\007"
+	.text
+	.section	.gnu.lto_timeval_sub.103.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\263\003u\030"
+	.string	"\266\355\233G\260\326M:\017T\026c)\214\251\021\212O:\205\005*\273\007\317\267Z\340\211\231a\337K\304\023.\0137~\373\177\216\006\332\205\237\017\346?\351\201\361\3349_A\233=~\367QF\201%\017\375\360\215\2324BH\222)\005\212"
+	.string	"t"
+	.string	"\212"
+	.string	"P}=\331\310p\261\210K\372\241\324\300M6!\020Q\030E\005\244I\214;\003\376\272 \244\361\023 \026qL%\024\314\260J\340l\275d\0316\357~\374\022\343Q\324\215\030w\007:\013\375u\027\266\255a8\206\255\325\341\355N\0249\311\207\256\206\224\030\343L\346\031\320\237\347\030\320\337M\330f\357i\253[\f\274\252,'\241\" {F>\254\b\347\311b\214\206r\016\025\3352[\fb\214M\241\242\021\356\347\266\017\332Nh=XGj\355\305\030c\177\324z\331\032\357l\001\226riL\303\016\340\0316"
+	.string	"7\2713~re\300lLfa2\373\222\331Xf]2\013\313lKfY2\373\312\354Jf]_6\364\262\255g\301g\277\314z\231}f3\263&`\031F\230R\374P\305(\"\253J\034\362\345H\262\224\335d?\371\255[G\325S}IU\207S\222\220&1F\b\241m\265\223\0039%\231\263\374+\242\303Z\271\353\257{5rJ\267\036:+/\240\301;t(\270n(\027\210\002\305\205\327zxW\007H\363\326Mt\225\225c\001\236\346V\242\303\n\262\017\370\035\274s$\274\177o\005\321a\275*\211Q4\r\374\275\177Or/n\231U?\377{\312\037\321U\224\234\322-c\214@?R\363>\006\246*\\R\301!!\017"
+	.ascii	"I9\230\212\226\240\266A\301C\030c\264\212\037\320\237\177\023"
+	.ascii	"K\246,\005eV\273\003\31289<;^\313\247V\273\301\271\300\263\023"
+	.ascii	"\372\030\204{6|\340\311\251\201\305A\020\301\202\203"
+	.string	"\n\263\236\234\f\265\233\236\331\216\206\033\0163\234\032\317\f\201\254\264\0169\265Y\017\215V\233\275v\321?\252\025\224\207.\024VKi\"\236\371\220\247\354B\272\n\201\302jE\3266\240\314\207\332\326\\\026\364[c^s\303\374\3451\317'\272\026C`>@\310\313\317\243\212\213\245\330\253hJ\204\234\270\034\366\330\314]\376]\301n#,&-\377\241\363\300C\313\221\"BNX\376z\313\035D\250Q,\347\0302F\261\022Q\234\2024\215\001\220\242\221+\363\021\240\235T\314D\nKm\354{\356/!D\020H7_\311\227Jb\206\221M\263\237\234\321\32543M^\361\234\310\016\374[>\302\261\245\2111k\027S\235\224ai5\313+\337\310/$\007N(s\246H\274\021\035\177\002(K\300\236\373%\207!A\2100S\377n\005I\215I\242l\201}\334\032\2557\371\333\207H\207\347\032K\274\2661\212|."
+	.ascii	"\2211\255l\310\212n\177\n\002h\235M*\025m/i\335\226\340?"
+	.text
+	.section	.gnu.lto_motorDevInit.110.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`B\002=\024"
+	.string	"\366\244\205J\240\024R:\002U\203\216a4\326\337\304\373\226\325\304\266\031\207x\030\322H\n\322\337\367\"p6\310/\3636K\355\367\n\210[\375f\036\365\003\2730\272\220\250\341\322\276\300$\211\341Qx`\037R\202\034\275\220\315\344\023B\344N)o"
+	.string	"m"
+	.string	"o"
+	.string	"\365\267\300f\371\321\277\023 ?\226\037@~t\316\036\362_\212Z\240\310G\007\210Uk5\027\205\313\213\277[\244\271\223\243\2704\347\003\177\240\227\243\346\244\270H\301\250\007G.T\300x::\212.\237\021A\002\360r\304\225\"DJ\\x\332\303\303\241b\021\320\367\302'\3501\351\246\204<\240SW\204Z\253\351\216\367s\273n\033\307v\006\233b\b~=\351/\217\364\217W\272w\251\351H}"
+	.ascii	"&\300\023BF/x\337AR\253\210\341V\3651>\265\270\322\355\323\360"
+	.ascii	"\205\206\371\301\327\310]\311P\257?\365;XEAU\265V\224\217\256"
+	.ascii	"P~<\021\017\263\031\250\344\236\364\341%U'\265\202e\177\227\221"
+	.ascii	";\022\bZRot<\016\312\217%\364\324\276\321\217r\217\021\342&\265"
+	.ascii	"\016\355h\252\001=\266]\336P\344.\275\232AuC\265.\326Z\253\250"
+	.ascii	"\340\273\257\335 \3053\225#\244\243C\377'i\277\374\3514\320\300"
+	.ascii	"6\315\235b\004\b\251\265\256\334x\223\314'\372h\016\263\231\360"
+	.ascii	"c\257\307\204eeC\207\342\262\330]\001\331\365\255o\343K5\237"
+	.ascii	"\310\036n\364\273\333\316\310\270_\b\275%\335T0\211\r\035\332"
+	.ascii	"\277\032\272>\247#<A\336!\0074'\f\255\005G\233y\2357\231\031"
+	.ascii	"\n\247\f\214\314\345\025#\323@\253I\260\325p\265\031\314/)\023"
+	.ascii	".\264X0qg\214-\2063i\262\330\314|\261\335\314\224\023\327:\234"
+	.ascii	"6\023W\253\331L\330\257~\207\314B\242fU\331\254\316\307q_\307"
+	.ascii	"\243N\227X\214\374x\340\021\374H\332\0222\2622A\256\257\307\r"
+	.ascii	"\325r\271t]<t6\350\223\3454\256\317*0\366\265KEQ\276\0330 `\002"
+	.ascii	"2F\351\001\376\030\253\344\261?\311h[\361d\304\021\346\016\255"
+	.ascii	"\257\231\332\223\te`\021\003<\226R\331\005\245]X\360s\301\201"
+	.ascii	"P\213B:/\316R`\343\"\262\255\327\256\b\303\244m0\343\n\207\004"
+	.ascii	"Yl'$(\310'\272\355\366\226\341\273\311\\r\260\027>{\224/K{t\276"
+	.ascii	"\227H\001o\001|\311\026/\2629L\371u\365'"
+	.text
+	.section	.gnu.lto_servoDevInit.111.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`I\001\345\016"
+	.string	"\326\333eG\360\222(\035\262\326\342\207\344\210]\365\355\212\214;\245)\264=\\\213\240C\210V\354\252\202\226\354\306\240C\214\374\026\254"
+	.string	"\021oRG\273H/\245\300s\037\016\221\223H{\357\260\270\213\342\255_|\034\rid\223-S\nQ"
+	.string	"N"
+	.string	"P"
+	.string	";>\262\226@+F\004\215\217\335\365\244\nw\337\306{\323\360s\223\032\3723G\240\272\201\315d\251\322\347\346q)\201\003@*\304\006\312\301A\361\327\265%%\352\326z\271\374\353\nT6\342L\226z\271z\"\354\256\025\2252qs\267\255b{\202}S\276\347#V\334\340\201S:\352f\227D\r\310\332\2304X\334u\373\243\377\362\307\r\034\204w\261|O\333\201\325\222\241\355\216\013>\r\241\373\374\307\366\325\276\213\277\b\017\343\303\003\354\302\324\220\261;2\260\327}z\374"
+	.string	"\356\263\273"
+	.string	"\356\323\241\035\250\331)\205\2505\377\037g\247<\366\025x`\333\303k4\210\344\330]P\214\323\214|\231OoX\321\243>\375\025\3563\001\253\207IkVy\371\3277\035\225\rl\026\013b\322\232\2241\227\235\031R\256\354\261\244\240\234S\013K\030\233\273\353V\251\001\034B\027D$!'(\030D\237\204O\005\f\215>6\031\241`\201\244\202G\n\235\200%$O\204R\222\342\231\200#o\344\200\277\f!\320#}\037\350}\306\375\314\273\232\023\264\035\232I\212S\256,\"\223\234\2341\352\026\325\201\351"
+	.string	"\241?\276\355\356nru\026N%'\r\210\001\033"
+	.ascii	"\200X{\311\027\323\020\232\257\266\226\211\345\301\214\276\253"
+	.ascii	"\261\323\022\013\364\270\035\3069\033s`\232\n\233\006aZ\202v"
+	.ascii	"[\344\b%\236.\016\270p\315\352J\320.\016\213({\351\252\361\202"
+	.ascii	"\"\362\272\346\023"
+	.text
+	.section	.gnu.lto_pwmGetMotors.112.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375 \372\325\006"
+	.string	"\322\214/5Pm\222\016$\243\242\3524\"\2135\341#\332H\315\257\213\201'_\205\235\265\277\333Zc\323w#\215}g\0305\001\020S\353\016x\216\312K\314\216&\226\020\231\002s&\004\205\203\204hu\026\252\215\025\035\0306\r\221SA\304I3\365\320\251\242EQU\314l\331'z\222\013\223\231U\273#\335\"nG\341\022\227\253Vx/\251P\223=\320o\037\3676\276\227|\242w\227\021HST2/ZX\022\005\232x\374\236\317\\\220\206x\306^\305D\246A0\372\240(Y\311\334\342[\005\244BL\003\244\302\307Q\254\016\273\025\251\001\310\342D\013}\352"
+	.string	"\n2s\247\2050\372\353?\360O\177F\t"
+	.ascii	"{\311'\323\342\255\243s\205P\\\023a#\360\026\"\027w\305\324N"
+	.ascii	"2"
+	.text
+	.section	.gnu.lto_pwmEnableMotors.113.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375 \361\205\006"
+	.string	"\362\013-2PM\324\001\244\225\231\343\nQ\321$\363n\256\032J\371\235\003E\360\203\254 TC=rf\001\247lB\231\300AQU\035\254\316\334\202\212\221\375\367N)\216\236\203\004\003\004JI\n\025\242h\303\002\304@\243\372@\237\001O\016R\245\3244U\332|{\311\025\\XP,\231\214\360_1\276w\220\312\3470\204\025\257}\372\026\3639G\300\020\243;\311\342\305\376\260(3\354WVr\266t&\302\356&$\273\024\227\224\025\231!\035\266\337\370\262K\376m\254\200\207'\001\206\273K\245\306\257\307\313\377\307\003\264\r{\004 \330]Gm\253\270\345m;\266\037\333\026\001\t"
+	.string	"{\3117c\361\2003\244\305\027\272\206\273\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_pwmAreMotorsEnabled.114.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375 \354}\006"
+	.string	"\362\313,3Pm\222\016$\241*\026\262h\251u\001\200\037d\267\326\\\360\357oe\315\376\335\016\363\006\240B\036\373\3162V\0032\252\250\330\301s\332\340\t\343\333'[\246g\250\204\005\004\005gi\030\036\306r\017\r\030\007\227y\021\216\272\\Ah\236\263\252\3529K\226m#l\027O\373|9\332q\335\214%6X\254\323\335T:a\013\250\360`\351\263\0166\213/%\333\350\307\261QH %9\311\f\225Lrd\n\321\3709o\231\240\200\363\325\f#$@\372\230\360(\311\314\\\273\350U\274n7z\360\001\211`\242N\021\300 3GLD\321[\377\201\237\372A\001\t"
+	.ascii	"{\311'\323\342\2543r\206P\\\023\001#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_isMotorProtocolDshot.115.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375 \317\345\005"
+	.string	"\024\nm"
+	.string	""
+	.string	""
+	.string	"."
+	.string	""
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\347\230\266\004\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\315\261\024\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\367\214\001\221\216\217\260c\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\244\003\001\200\300\013/root/repo"
+	.string	" ./src/main/target/SITL.c"
+	.string	"\t"
+	.ascii	"{\3117\323b\236\031\007\276\3365\\0b4!r\270s\260v\226\001"
+	.text
+	.section	.gnu.lto_pwmWriteMotor.116.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"E\013"
+	.string	"\346\226O>\020Q\225\016K\225\ry \211\221y\023\360\316\237\024\221\263\210\360\315\315\211\254\244\257\003\302\006j\2301\241\25542\202<\204\005\240\265p@\244`\374f\032)B\3129NO\331\320&R\246\024;"
+	.string	";"
+	.string	">"
+	.string	"\207\316\264\rX\272\263,Xw3\260\\\273\037\3051;tg\307\370\227Z\002\253\025\245\026\215\335\215\272\341\335\263\363\037\342\021\317\024zB\022\354\256\3233a\270\365\266\013\330F`\237A\177\366\357\207`i\230iL\323\252\351\304\322\007\200\255X\374Ek\367\302\313\306r@\024\034l_b[\323\376\207\203\350\376\371\204#\273)T\270v\227bKv8\371\200\307!v\001\217\326l\2337C\025jv\220Zd\212\351;J7R!\252zR\207Q\276|M=I\306E|\004\307W\271\363\311{\207\376\347qx\255p\202Q\343$\312\227\375\205R5\330\307VQ\366Y\001\332G\302\005\004)h\0176\031hLe\201\003\005\r\242G\203\300]<q\223\271h\"\206\353\304\312\304\333\004\215\213\236m\343\242\344\333+\312\231\013\017\034\"\035\031\252m\320Mp\002\244v\367\200O\342%\"\370\252\303\017"
+	.ascii	"{\311'cq\347\3150.<\344\215\202a`\374\305\270\256\214\261\250"
+	.ascii	"\366\\\310\257g\026\020*\314\001wy\321N2"
+	.text
+	.section	.gnu.lto_pwmShutdownPulsesForAllMotors.117.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\245\007"
+	.string	"\222\31657Po\322\001\240\243\346,C\225\330\226R\225wZh\324\242\371N\355\370t(n\315\200}\317>\203\333\025{\273+\023\220z\023\214\302\252Xgdi\r\266\336m\357\224\002\223tE\005\031g\034\t8\364ix`p\200S\004!A\023\222\"@#\030\222\023\360C\340(!\222p\306(a\247\3565\353T\013\034\0322.'ga\377\332\370$\257\227\037b\212R;\366\347\2276\177\217\245\244#\225\275\234Z\313\256\246\346<\354k\326\251l\347\3010\311\016\303\332\315h\315\354\312CY\331~\307vk\266\301\001}Va\267\233J9\331\255\005\206"
+	.string	"\177\246v\313+\310\016\210\250\\\260bv\027\272\217\3237\352\177\344\001\030\312\364\306I\330]7\f\265q\273\333\366\330F\260\275\n\t"
+	.ascii	"{\3117cz\366\206Ea\032t!\327\016v\250\324dp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.118.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`:\004\025\031"
+	.string	"F\355\233F\300XM:\3206\342"
+	.string	"?\241;\002\351Ry\220,\231F\333\244@\021W\362\t\352j`\320CU\300\206\356r\3542\210\315Y\317\021.\247\303s\020\370\021\305\003\245\232\246\036\330,@\204Mmj\253\t\331{K)S\203"
+	.string	"z"
+	.string	"\217"
+	.ascii	"\372\253.]\245AT\210L\303;i5\227\336'3>\322\230\351\356\002*"
+	.ascii	"\317 T\236\251\322S\235\271\373#H S )\316\3356\232\232t\207\007"
+	.ascii	"\376y*/\373\313h\230\243\003\370\020S3\222\246\273?\306\2412"
+	.ascii	"\355\246\214\274\262k\352V\244\235\007C'Mu\253\255\214\003\222"
+	.ascii	"\220\240X7\025\361e\305\251V\333\370B\231u;\212\257\356\326%"
+	.ascii	"\335\0257\243\335\256Aw\177m7\027zO\377\237\370\377\340\217\261"
+	.ascii	"1\326@\341f\233\213\254\264\335]\304\234t\024S\371\003\2210G"
+	.ascii	"\033u\325\276ZC\314\237\b\\\265)\353\222\272\230\272\240q:\342"
+	.ascii	"\242?,ZV\37256'\375\nD\225GC\375\316\356u\272}\316\334\273\344"
+	.ascii	"\276%\3678q\317\232\373\225\334\337\310\275*\356Sso#\367\236"
+	.ascii	"\334wq?\347^\312}\224{\216\373\345\275\016p-\001\323tS\026Z\272"
+	.ascii	"[\344\324\264\223\304\365\320P\003\314A\206\021\250\030.\356"
+	.ascii	"\302eK\213]8\334b1\216\226,,V\0322\212\374\300\255\370\212\225"
+	.ascii	"*7\274R\361M\212UR\224\312\224\325G\231*SP6\f\345\t\316c\233"
+	.ascii	"\216\275\311\335\001m\302d\346~\340$\377\357\321\2463\001\360"
+	.ascii	"\364\f\272D"
+	.string	"\303\352\251\273\025$Q%\033:x\3600U2\026\333\231\310\222\265\266f\207\231#+\255\212\321\346\276\314,\243\320\314\3146g@\231\200\274\356^p=\242H\202\256;T^hH^\207\246\312e\245\021B\"\200\202~b&@/6\302\004\b\001\006\306@\242\324\203z&\\\220\360\363\305\204\206`@\261o\004\b \242/\bV\342\353y\035$!\004\373b \b\373Tak\354\00636\352^\373;\200\260j;?J\307\2140\223\225^@u\004\254\016\3212>^\367Lm\3271J&\202\004\037\037\n\025Vm:\254L_jh\324\215\034\223d\245\363\320\220xp\016\213\206\304b\357D\243\276s\324=#\260\303+,\314\234\253\027\375b\341\272\343?\030Vm\030\246\312\234R\250a8\245\225\t\244fH\202\024\026\264\320b\260\002\221\031\263y\021\320H\207\230\311`s\317{C\205\326f\322,tm\217\304"
+	.string	"\317\256B\202\355\330\264\030i~6\310w\233\364\220\021\310\024\305\330h\206\202\\H\224i\267!;\347\372\236\376\272\303\332/\036\220d*\307\230\001\013n\334\244\313N\330\244\343j\2054\272\225\265G\"\232\\\334l\271\350\274\027>]\353v\007w$x\001;\341\\\364\205\241\3203u>\272\3050\372\305\t:P\374\324\343'a\274\272M\322\003V\034\tC\007\337D\021\b\374 4\364\367\205Re\365"
+	.ascii	"\266\"\372[\334\325"
+	.text
+	.section	.gnu.lto_pwmWriteServo.119.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\365\t"
+	.string	"\006\024G=0\305*\035\236\213\352\365vx\346o\370\370/I\276\317@\366\253\312\266\307#y\360\032`\326j\037\263S\242\225!\3568\203aC\361\305\215Q\205\3656\377\224\215\362\206\272\217\3376\3312\2453"
+	.string	"4"
+	.string	"4"
+	.string	"\034\216\273$/\331n\350\361\324\\\372\263\t<lm\202KD\025;\260\2733\232\374\273~\376Y\276\001W\250k\306aw\255\340\n\344\216\267\255`\273\301~A\252~fs\215\234\026\333\375\250!\330\231|A\261}\216\355\250\366U\276\362=\264\2137\273"
+	.string	"\002\310v\327c\220\346\262s\004\314\345\366\003\314\245U\355\005\320\367W\f>\354-\030\376\311\245K'=x\351\2370\227\007\013lQ\243\032\360\020\020\343c\006\0262@\225 \2455;Di,\261\277md\331\017\377\355\257?nj\r\334\251\"\224!5\270\t\322HZ\364\201\220x\210\230&\216\302\013\231&i\024\262\230\"\2574?\035w\027\2347M]\347MN\270\3376\262\254\241\245\314R\261\303\032mo<\326\031\264v7\013"
+	.ascii	"{\311'c\032\202\032&\234\301\027\343c\332\345\032\276\230\205"
+	.ascii	"\202Pa\"\270s\213v>\001"
+	.text
+	.section	.gnu.lto_adcGetChannel.120.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375 \374\005\007"
+	.string	"\002\r16@o\222\016\230\016\243\237\340\304]\b\020\005\211\t\222\032zpN`\202`\366ong\333\322\0050\3236\313\207\334i}\002<\263\353\230\351\017\220\244\361\273YBd\n\022\027\206U\020\326f\353\303\340\260\320\020\267\353A\253\266\210ET\023\321\322*\342\247sFqiq\3132-r\272,GuDp\364]\350\301\217\257&\241\307?\r\211HaV23fd\362ej\031\371A\317\371\341{\203\003PO,\206\231\035*,\231]\301\021\240\323\177Kj\002\232\363\\\210B\036\222\020\214\224\230\314.\006t\200\352\364*@u\202 \345\372\270[\224*\2148\\H\245P\337&!3\177\244\222F\207\375\t~\204\177#\t"
+	.ascii	"{\311'\323\"\030>*,V\001\271\206/\230`\211\2510\246k\222\001"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.125.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"}\f"
+	.string	"\206VVE\360\2606\035\362c\344\031\213\332\271x\036l\226#gW\177m\257w\036\227\301`\032@(\024\202\306\243f\242\341\337\356\201\314\336E[\203\356#\344K\306S\315\r\314\261i#\2536B\347\222'\323\377nD\312\224\002B"
+	.string	"="
+	.string	"C"
+	.ascii	";\240\305\3114#\265\273QS\234t\253\322"
+	.string	"$\371\240\257\273\365\221y\245\240D\215\222\r\032\237\314\265\"`\352\261\"\300\007S\025Hu8\267yz\370J\231\036\221\335uz\237\210\373\272\355\b\266!\330\017\005\257q\207\226\274w\313o\271n]o\363\003'P\251\231\023\211\227\fm\260KEa_\3030\f\2554\366\323\371\364=\006L\350\334|\007j\027D\270\2639\026\016\013\333\0071\311\306qPEi\237\240\250v\327y\241#G\365\221\251\330\005\\\t\376\233\313\330\2363S\263\033sO\303'&\"\270e\263l\310{\306L\332\301\340\220\252\037j'G\200\037B\250]\256\253\205\0307`\222\207\375\323]\2708\006eY\311\003lA\bva$e\343V4\r\243\200\"\3322\250\224Th@\302 \033\231\020bQ(\223\340\200$\2164\f\234\311(\252\234\230\244D\021\307\022C\230\267\025\215\213\243m\343\"\b\270W\032\213\274h\351\325\356\256\005 \025"
+	.ascii	"{\3117\323b\2353pW\200\025\240\272t\265\006H\031\027\256\200"
+	.ascii	"&@\334\257F\001+$\342\026\033\002\264\313(/C\214Kw\263i\251\220"
+	.ascii	"(j\025\024"
+	.text
+	.section	.gnu.lto_FLASH_Lock.126.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\227\001\025\020"
+	.string	"\326\234jH\340\222*\035Pz\310\307\371sm\031\361\240V\362@\322\241\305\007\026\022\230\246r\346\344\212\245W\246\333fG\343\250.F\347\327\030\350\033\310\016Q\263\320:\227_\002\004\304\270\271\344S\203-\244\013D\r\027\252d\023\271S\nU"
+	.string	"Q"
+	.string	"U"
+	.string	"\267\357\370Q\253\210\237\217\212CoT\330\276\307-[\307q2\025\201\355\347\362\"\247\326*.\212\267N\301\235-\3773\017P\306\310\323\316\313A\220\330\313\027, \323\361\006\304^\240\003\236m\366\231\317\020\261\2269\001@\250\265z\226\261\021wx\333\025l\223\354\337\b5\230\022\341lp\3376\302\257\315\301\303|\351\220\234M\214\257\007[r\362l2\2335K\3705\251\311\361\232=\354\323\274\005\213_\363\207\225\371\362\324_\tO\277\324\304\216\006CC\3025\1776\216\234{\302>X\227f\177\032\374\364~\372!\013R\314\b\026:\260\021\320\351o\277\271"
+	.string	"{\211\241\003\023A\2476I\t\216\257\007bI\337\305e\220f\271\034\036\004&\270v\311\364ZR\367`\226c!`\356\316Z\357\032\341\177\022\376\366\030)\0032\265\272^\372\271\303@\371\265S\243\244R\341\251=n\370\270,Y\263\373]NA\231\204R\243J\345t\362\030\004\264b"
+	.ascii	"\372h8u(\255>%(\246Q\224A\302(\202H\204$\201M!\021id$\262N'\252"
+	.ascii	"\022KLA\225R\242I\265\022C\037\217*'\225\310\032G\225\350\301"
+	.ascii	"\325/\315\"4b|=\327\266P\005\323\236@a/\323\361V\200\007\346"
+	.ascii	"o\337\215B8\002# `\2021e\311\003{\362\211-n\233\201\302\301m"
+	.ascii	"/\270+\347\272p%Br\214.\t\320*d\023\261\256\003k\270q\020m \016"
+	.ascii	"\327\r-\033Ih+\377=\342\255D`\333\274\021on\251\302\270\322z"
+	.ascii	"\200f\270U\017\177\034w\226n\331N\033I\2156C\001"
+	.text
+	.section	.gnu.lto_FLASH_ErasePage.127.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\252"
+	.string	"\035\013"
+	.string	"V\025MA o\224\016\303R\024\f8\245\b\270\006"
+	.string	"6`\3260\232+\217n\315\332<\202\007\367\232\221\206=0\206\205Z\206\261\304L\ty8-=\013\026HKqG\301 \235\205\b\2164\307odo\271S\n9"
+	.string	";"
+	.string	"8"
+	.string	"*v\277Y9\207u\031\277a]*\205o\217\n7_r\031\t\231<t\036\350q\"\341\232\341\211bew\317\341\360\201\027\202Pr\331]\303\316\213p\313\333\306\330\016\261\337\021\337\257\n}+\236L/\221b\027\302\212\305\252$\210\013\266?6\3056\204\3665|\303\347_\203k\354\222D|\330\375><'\227\376&\266}\f\317\360\361\206q\300y \247\t\243T\235\243\202\016UKV\275\032@\215\020\301\025\366S\036\017\023\273\334;\037\365\016\232o\341\322\f<\360\335\245\357\261.\257\024\022\025P\214Zppe\177 \250%\373q\225d?\232ve\233\215H\201\213\223\021\200a\215%"
+	.string	"\001"
+	.string	"\003f\347\342d\231\316Lp \203`j2mZ*\306\024\\\331\354`X6)\337>^I\361\233u\325\211\020*NC\216\361\002\252\332\330\002\370\022"
+	.ascii	"{\311'\323\b\260\341+{`\f\230 T/\354}\302\216\307-\350B\236\217"
+	.ascii	"\331k\311\330\203v\005)\001\215\032g\250!\333U\312"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.128.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\270\001-\021"
+	.string	"\366\340uG\320\224M:i\0032\220\0021\0268\254h \213\b&R\337-\024v\351y\345!=\025\274\030\177\256\216m+\251D\233\300\323\n\332o\003\\\203\bo\255n\254\314\021\364;i\2647\002\374\325a!e\333\366&[\246\024_"
+	.string	"["
+	.string	"a"
+	.string	"\227\236\245l\373*\276B\307\257\026Y,\\IQ\344\203ddw\306\251\2162/\267\023\230\227\221\304_\237r\213\372\362O;\204\035\"\036`\b\373,\t\201.S@\337NB\231I\310\243qC\3711\001\236\204\262M\201\220\032DN\273v\bwTQ\016v\327\n\206\037n\324m\323\330\216\261\377#\322\031Zz\360\322o\315\313GTS\211 >O1\255\3313\230F!\373\261V\253\325\034\203\354\033\375\251\317\376)\325rS\353\246~\t\313R\222\001\244\335\237Z\222e\2226N\330\326\261MlG\275\321\006\003\330\025q\204\201\252}\026o\241\363\031\207\013\330\r\302\241\264;[`.\025\r\022\\\332\235\214J\026a\236QF\324\b\"\032\216\036z<5\311"
+	.ascii	"\232\2123\332\254\032=h\031a\366\020\020\260\020\233F\365A\333"
+	.ascii	"1\343\302\217\206`\\\206\315\223\234vw\3452\206\356\3369\346"
+	.ascii	"\245\306y\343\272$\373A\021\243\220g|\264@\323\301\243H\354\277"
+	.ascii	"h\035p\332\215\035\364\221\356\302\363\213\036.A\260b\335t\237"
+	.ascii	"\212\306S\271r<\025N\n\314\314\347Q\260\351>\226\367I\210iyy"
+	.ascii	"\340\302R!e\225\203\241\323 \277\231\231n\263\214\212\313\204"
+	.ascii	"\b/\234k\305\372:\027wS\323\331p2_\213SQ\331\303Y}\234\313\363"
+	.ascii	">\316d\266\3376\006m\177\3153\001)\302\024\213;\333\356\356\034"
+	.ascii	"\2402\376\350J0\005\206v{\016\306\244z\002  \240\002\0312\365"
+	.ascii	"\273\363\3112\375\036\303\203,\325\312\004e\234\307;\006\203"
+	.ascii	"\b\267}\301Q\032\212\317\2078\253\230}\026\013!?a\017\213\370"
+	.ascii	"|\330i\317\006\023dB\226\215\020\030\376\273\202\240AR\322\317"
+	.ascii	"\325\265\206\264\334\250\266\006\n"
+	.text
+	.section	.gnu.lto_uartPinConfigure.129.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\255\b"
+	.string	"f\320=9Po\322\001 [\372U\273%a+kc\324j"
+	.string	"b\337\331\345\2648\231\2315\304yo\262\330\302\206\332P\243\250\205\302f\241\214\211u\002%J\260\221\345N\020\221\266wJ\001*"
+	.string	"-"
+	.string	"."
+	.string	"\330/\203v\314+j\017PT\036,2\273;%\311\301G\320\277\312\003B\023\351\021\300\263\273\216\241\t\344\226\267\235`;\302v*ky\262\245\300I\213\351%\255\335\217\326\314\256\256\027\223\215\355G\373\251\247\200Wi\234\263{\202q\331\255\f\236\331/\327\033`\277\262\027\004u\257Yyr\306\022YmH\016c\361\365+\243\001\324n\351\341EV\362(\374\26212\342C/\260BV\035\222dWR\224#\3665\273\033\336\350\350\243\332\210\023\342&:\257\241\343 (4\216n\037\021\201A\235\007\t\207\317\374\266\020\325\276\331qZ\305\004Q\213\331A\260'\332\350\374<\217\316M\n"
+	.ascii	"\305,c/Id\354\001\237\265\300\331-0\344\022l\263\232\002\356"
+	.ascii	"\362\242\235d"
+	.text
+	.section	.gnu.lto_spektrumBind.130.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"\235\b"
+	.string	"6\320=90\221\322\001 \002\267\215\274\214\250\301\031\255\345\203\f\2078K\211\022\217\0065\307G\206M\030\271\246\221\036\261\242\215E\264\340B\245S\3115\030\372\203\016\261\255\210'\261{\247\024*"
+	.string	"-"
+	.string	"."
+	.string	"\307\f\3323\257\2535P\201\001y\251\331\335)M\016>\202\376[\017\bS\247G\200\206\335u\fS#\267\274m\004\333\020\266Y\001ReK\317JH\352'4\273\"76\353\302dP:\266\037\355\263\316\002\276\205\343\003\273\252V\314n]\360\324\216\271\276 ;\246\235 \013\234\225*k\257\024W\207\364p\026_\357b\022X\355\242\036bh(\206\204c\266\306F|h\205\027\211\353C\236\354z\212\262\304>gw\327\001\256\3508\207\221\211~\027\033\251\344\021q\026\235\367\220A5\207>\022\024\021\023\363\333D\024\364\315\216\003\215f\210\226\346\347\300\036i\243\363\363<:;u\037\t"
+	.string	"{\311'c\032\370\f\007\316B\201y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_lockMainPID.part.0.192.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"\315\b"
+	.string	"\326\320:6`m\322\001@\214 \br\304}\301\240\257\301\273Z\246\213\322\347\335\323\325|\263\350*\240\021\203\316w5\206\3006\036\242\211\260S\215 \264\271\313'\210\354-eJ\001*"
+	.string	"-"
+	.string	")"
+	.string	"\230\017P\207\357\002\324\241n|\273\346\333\374\344D\240\353\273\277\217Q\n'\302x^\376"
+	.string	"2\273\353*\343\206\267]`\373\262\255\022\351\314\364a"
+	.string	"\301h\327\242\205eI\360\304\303~\367\261-{\263\255C\221\317\205m\037\344!\233\215\362N\034\242kt\024&+\273\033\017\003\266\253\374\351%\236j7t\316\0379\311\203\337q\350\216\007\372\036\352\320\206\210\310s\327wO\322\204\202RM\326\367\267Z\2623\336\\\007\t\006\bQ\343(d\032-6,h\030\342&\353\304\013c\314\201\223E\r\303\262h]K~\367K^S+l\247:\023R\tUS\021"
+	.ascii	"{\311\337i\001C\307\b\022\210 3`@\036\030\341\212\241\300\304"
+	.ascii	"\2003\300\316\023\320\016\247\263\351\2716R\bi6\372\204\202\007"
+	.text
+	.section	.gnu.lto_micros64.part.0.194.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\324\001\035\020"
+	.string	"\226^gC"
+	.string	"\321$\035\230aU\372\235UO\370;"
+	.string	"u\006\t4\023\371"
+	.string	"k\375:\203\237\231B0t\232;t\202~:\361\326\007\312\237N\3303\020i\r\332\272\202\026L\364?\341+?\315:\266\326H#{'\231RT"
+	.string	"N"
+	.string	"R"
+	.ascii	"\"\230\024\216*\306\256\200a\261\313\260miI\206&Xb\332\326$\\"
+	.ascii	"\242\245ZHw3c\245n`vj\304\330a\206\355\034\3002\274\fb\031\376"
+	.ascii	"\2035?\237V\247I\306\3057\312\357D\020\220I\006\203\363\303/"
+	.ascii	"4\022c\354\225\301\205n{\240\255\2016\035\0046\215\206\0270\266"
+	.ascii	"\273\344m\372\347\027_\323>\353\361l\307\313r\274,\351\331\321"
+	.ascii	"\313\212^\366z\331\320\313Z\317\302g"
+	.string	"\337\313\376\331\264\216k\020\001\330O\214\027V7b\007\350\203c\035\267\316a\251Q%\351\270\3232\244\21331\3564G.&)\233h\210>\2729\027\327\177\321\235\3428l\267~\335\234\210M\205W\264\347\244<\345\261\fC\027\235\340\255?\305\251\336}xs!\266\024\020\336\001\3048\345\177s\252z\307(\264\032DQ2Xg\226a\3764?6N/\271j([\025\ti\223oT\023\262\224\267DdA\003\005\f\260\025\223\007%\222\025,\345\204\004\005+)\251`\"\003\232E0)a+YV\302\322/\276\246F\371#;\356q\013m=\336\221\227o\277M[\216w\264\307[\205\r>5d\344t\261M\260Z\315\240\020\343\013\001\3229HG\020\004\304\251|\026\367\320b\304i\364+ `\002)W\307\rz\344\343\226F\302I\333~D\216\3634,\3172\264y\027oe\030\3705\255\325\022\241\362\260f"
+	.ascii	"5/\301\316\230\326\342k\204\364s-WX\230;\n\206<\317\210]\034"
+	.ascii	"\to($\317#\254\030Gn\303\270\350\002;2\344\315k\201\312\332\023"
+	.ascii	"\333]\221\r\333n\364@\342\321\327><"
+	.text
+	.section	.gnu.lto_millis64.part.0.195.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\324\001-\020"
+	.string	"\266^hD"
+	.string	"\261&\035p\341k\205\265\240\241\b\371\020\\P\022\265\b?\310G}\376\240s\200\252\3623\307t\003l\214\031\374d(U\"\320\305\264\254&\255A3]\222\024&\372\237\360\352\037\332hk\333\244\221\275\223L)T"
+	.string	"O"
+	.string	"S"
+	.ascii	"\241\227\325\016+\306\256\200a3\314\260eiG\206'V`\332\326%l\202"
+	.ascii	"\245\033H\347A\346Z\351\274\344\330\210\261\313\f\3339\300e\210"
+	.ascii	"\371\3432|\007o~\276\255NTL\213o\225\037\212\237\030\250\030"
+	.ascii	"\fN\017?\220H\214\261X\006\027\272-\202\266\006\332|\020\366"
+	.ascii	"\f\315\006\030\247\267\344o\372\347\027o\323>\333\361l\351eI"
+	.ascii	"/;zV\364\262\241\227\305^\026\364\262\327\263\360\331\367\262"
+	.ascii	"\1776\215\343\372C\300\001\0271^h\345\2105\260\005\b\343\270"
+	.ascii	"u\212\225Z\325\021\216\273-A\272(\003\343ns\344`\002+\243j\204"
+	.ascii	".\272\271\027\330\377\320\275\3424\234~\035\273\271\021\247\025"
+	.ascii	"f\321\036\223\362\224\3472\004=\224\202\277\376\025\307z\367"
+	.ascii	"\341\315\2058\351Dx\007 #\225\377\315\261\352\034\253\330\352"
+	.ascii	"\017=\321`\255]\206\371\317\314\270\221r\311VA\331\246LH\243"
+	.ascii	"|\253\002\0244\224\227$\204\201\203\005\r2\225\022\b\246\021"
+	.ascii	"\225\f\305d\344$#1\245d!\003\252I(1e*\232f\312\322/\336\246V"
+	.ascii	"\331#K\357\270\205\266\035\257\210\313O\377M[\322K\3551GC\243"
+	.ascii	"\306\007\207\b\236\330*h\265|*\304\350B`t\222\350\243'\370\211"
+	.ascii	"\301\261\374\235s\370!\221\022=* p\002)G\307\rz\344\343\226F"
+	.ascii	"\302I\333~D\216\363d\260\220\374Fk 0\261\356\032\326b\241\262"
+	.ascii	"\263\266\2010/\301\316\230\326\342k\204\364s/W]\210;\013\206"
+	.ascii	"<\317\030\273\034\t\317P \317#\354\030G\336\302h\364\003;\036"
+	.ascii	"\362\310k\341\312\212\023\332\035\220\r\313n\324\201\244\243"
+	.ascii	"\257\rx"
+	.text
+	.section	.gnu.lto_delayMicroseconds.part.0.198.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"\225\n"
+	.string	"\006\225G=0\247*\035\220er\0346\235\333s(\327\363\300\377\t\333\031\260\0266\216\030\013\231\355A(\337>\306\004\260%Wm\026\035\003m\242\302AP\017\314?4\216Y\307.+\031\332[\312\224\0025"
+	.string	"5"
+	.string	"3"
+	.string	"\207\227/P\016\337\025(\207\366Ml\217R\336\354\005\347F\366\004\272\215Wlw\343\241\212|\273\346\333|\322\025A\325\361L\370;\320\354\2563\217\033\336\016\366#\002\252\351<\367?ch8\331\345\350\032,\b4Pb\373\366]#\333b9\264\235yn\364\226\350q\253J9\323>\200\007\330\336\022\271\262\0332"
+	.string	"\266\313a\016\035\263\372\364'\004\246\354\354\013\370\313\005|\022\207\f\313\243\016}\303(\207\252\225\217k\352]\177\007b\nN\fJ\331\245\262\254\357ow\327\272\262_\032j\372i:\237P\232\223\201\230x\220\210\240\016\205\266\001\305\213\212\215E\344h\237\230\271\330\203\321\321\"\310\343\321\242\345\272\262\246\244&\253*\313v\226P\355\214O\036\345\213\206\222\374\024*\346\224\240\224]\024"
+	.string	"{\345w\215\0058g\340\327D`\363"
+	.string	"\207(h\006"
+	.ascii	"\310\003#\324\025\360\f\207r\366\231\235\013l:\357\\\0268\361"
+	.ascii	"@\216\226\246\255\210\372\340\340"
+	.text
+	.section	.gnu.lto_delay.part.0.201.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\324\002\335\025"
+	.string	"\206(\214I\320\360(\035\272n\2665m\223EMA\343\035\251\257'J&\316\023\255\242\203\333\016KA\274hh\255\344\204\215\366\003\377jqjO\253\005\242t\250\212\257]d\350 5\027z\237 Zu\366h!\351\355\"\204\220\275\267L)v"
+	.string	"w"
+	.string	"p"
+	.string	"\006\276\323\371\002\337\251}\025\266e8\317\354\034\037s\352\213:\330\202\242j\255\253S)\302sg\017\301\217N\271\342\314gy8\301Z\214\316m\340j\346H\017\312\350:\332\2029\232\177`\023\023\315i\227\2439\235\bn>H\t\310\275L\020\0315l\337}ar\265\235{C1sy\335\347N\217\306-7\363%p\021$\251\265\372-\034n"
+	.ascii	"\267mc\273\201\275:\002\027\372\342^8FB\333P\233<)\245\236\250"
+	.ascii	"\3522\206\2508\3661\346\3100\3001\366D\325:\332\347Q\247\243"
+	.ascii	"\273\370\316VY\345C\226IH*\225\365Y\310|\235UB\262\007\305\366"
+	.ascii	"c\25428\037\350-f\017\212\275\276\340D[\321\b\250Z\307\220S/"
+	.ascii	"\bO=\206*\357~\224\375ge\2165\207\363\256}\237\257\230\375g\305"
+	.ascii	"b\255!J\300\250uTp\352Ux\n\362\376\321\221X>\t\233\264\366\267"
+	.ascii	"\326w\272Rg\347\306\203OM\313NY~\326Z\353\f\260\340\323W>\373"
+	.ascii	"\344\302\376\346\353\0362\355\030\245\240\\$\213\345\245.\251"
+	.ascii	"\226\223\022\307\266\270>\317\245a\177\273<\357$4\311\262\022"
+	.ascii	"\307R\374HN\017\312\362\306\246k\361\343\037\3225H\327\037]S"
+	.ascii	"\272\236t-\277\365\0168\020\262Tk\314\024\217jC\215L\004\260"
+	.ascii	"\027\013\226BSP\326&\"\020&<\220\260\202\265,\274X\260\025\206"
+	.ascii	"\023\026\312\312\344\225\262\022\001\261+C\353\265\202\271\\"
+	.ascii	"\257\225\352\222\026\316\217\312\357\036\201hg+\242S~\022F\224"
+	.ascii	"\240t\260\024JQN\"[\217\313O\202\362\272'\260!\0019\t\235\240"
+	.ascii	"\201;*\345{ \246\206>\360\351\261O\312)\377\222\202\266S\366"
+	.ascii	"\225\036#F\241\244\344;\225\022lb\342\331\332\214\312CY\337\312"
+	.ascii	"\n@7\\\266\347= \240\002\221\243\252\007\273\371\201\201\373"
+	.ascii	"\246\366\2069Yx\263\316\\p\355\005\0137\335\330\326\005DA\251"
+	.ascii	"\336%\332pU\n\201k\2658\230\021\263\fm \032w|\310\205\322dYf"
+	.ascii	"\212}>\327b\365\226\035V\240y\"\217s\"\fW\307\302\217j\202\341"
+	.ascii	"\f\"2(\250^\rq\334\216\303\257]\276\341g\004\263y\333=\2238w"
+	.ascii	"\367\330t\242\317\254\013\f\316k\331\\4|\257\306\n\027\034\235"
+	.ascii	"2p\037\352\024\022\227Xk\234"
+	.text
+	.section	.gnu.lto_simulatorLoopYield.part.0.203.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"M\b"
+	.string	"\"\01646@s\322\001@\021l/\3025:\334\177\031\002\233L\\\205$c\206\3138\247f4\244\333\233\211\205!,f\301(\340\376\313Qw\245\253O\0020\257\337\332\275\345N)\016Y\b\n\007\t\021\023-H\020\026\035\030@\r1$!\242U\340\353A$#v]2V\266\335\337\352\311\037\n\255PEm\027X\241\351PY\3750\307y\036\301\361\247\304\204\273\346\317\007\274\214\304Xh\311)\312\372\376VO\266\022xR\273\0307\251\365\200-\">\312\347\350'V\016\227\321\375\215dW\325\341Ml\2232\234\3313\237!{\226\222\213\224\232\335\215\207\n\362\354\352^\346;\315T\272~\373#\261\221\321L\032w\003\177\235\317\356\032`\343\206\267m`\333\262\r\023\026"
+	.string	"ze\231\033k\270\366\254\276#\027\026\001\357\001\024.\033\022\306\302U\366\204\332.\301bg\2733\205\027uC\247-\233y;-"
+	.ascii	"\327\036RXh\266\364\2042\006"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.part.0.206.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\016\001}\f"
+	.string	"\026\327R@\020Q\225\016\250\b\301E@\036\242H~h\333\321\326\302\274\020\002\027\325tF\025\317%\316\355\267H\216\211\033\001\306\035)eFU\316\362\023\371\220\"\211yv\235\212`\224\232`/\211d\223\275S\n<"
+	.string	"A"
+	.string	"C"
+	.string	"\323T\373t\370\001\331\247v\001\331\347K\330\3764\030\264q<4\355\344\344\312\260\372\330]\372)C\034\274\214\030\350\203.!\0338<\0068\346q\331]k\035\356y\333\tl/\260?\n\321\276}\025\237\257\372\312\221\360K\271b\371\216\372\304\311\202r\304\330\re\264+\026\360\250O\266\026H\234\\\257\335\020\301\247\025h\237\017\035\371\364\211\243"
+	.string	"\237\3022$kcc\353u\372x\355\356\201\007\004Z.\376\202\023a\333\262\317\263\336\242\323vC+\316\242\372\">M\241\213\027}\372]\346\251\020/\362W\277\351\306\207\032\030$(\312\222%vl%\311\226\321\203\001\023\273\243\035:\026\304\2341\342\252?\365^\307S\031p\325\253\033d#!\243\301x\236\252YCq\360\240\001\206z\033\b\\\306\243\035Nf\243\032\256\243\224\002\256\0236\034\365j\345h\304v\274$\371\022\222\027,\245,\331\006\020%7\215\354\254\303\330\002\033"
+	.string	"\177\311\017\347\f\374\032\n3\030\310\004\f\354\250\374\207\032\333\007\273"
+	.string	"Q0\314\025.\027+\264P!p\035\030\024\022\301\013$\326]a\031I%Eg\2006Sv\032"
+	.ascii	"\256=\340F\213\350w\2251"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.part.0.207.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\332\006\025'"
+	.string	"\352D\f\017H\200\234Q:\2375}\025W\016\007\274\305\305Pr\200\303`\200!\226\242\242W\001\207\371\3664{\203\r4f\341M\235\306A\2622\355\221Lu\250\310\352\016\206D\232\007\016\021D\275=\251\242\033\312\204\376'\215\020\"w\222\001\333"
+	.string	"\311"
+	.string	"\345"
+	.string	"zX\"\247\227%\357\372\221\277\314\347O\271\221o\345^l\353\342\342b\032r\272\021BK\f\223\t\351O\244\215Wa\272\b\216l\217\341\361T\326Wa2Y\251#\333\243\346$D\214\224;,{\f\372\311\271\364'\037_"
+	.string	"\375\231~"
+	.ascii	"\372\342\371E\033\3146\333\317Gaf\033C^\231\341\374\210\305\""
+	.ascii	"\320*\006\271\356\260,\233\373\331H\276\276FKg\350i\366\265\255"
+	.ascii	"\374Z\024\3605\0064S\005S\006\217fHe.82\204\354N\206S7m\342\035"
+	.ascii	")[34C\251\027\203\027\235\r\201\260\"\036\245\220\235\263\241"
+	.ascii	"\342\031\030\351Au\363\026\005e\252,\313\336\353\351\266\331"
+	.ascii	"VOnQ\255\311A\017\231+/\376\346\210r\272W\300m\263!\226e\371"
+	.ascii	"MUg\2373\363\221\371\001\230\317\262%\304\234Ma\312\r\231T\267"
+	.ascii	"\331\227+\270\347\300\275\315\\t\342^\330\255>5\220\301\334\236"
+	.ascii	"\001\277\224\304\242\024\201{\317`P>\223A\337\314)T\334\013\371"
+	.ascii	"^\277\216\256-12\261\266\201\334\357\245\2324^\335W\314L\003"
+	.ascii	"}7\360\353\t\262\315\323\305\303o\376\327\267\320\340g\361\n"
+	.ascii	"\026'\237\005\372\363t\204cMw\311?\367\306k9\322\245\255\007"
+	.ascii	"\334\317\033\217e\227\262l{!/m-\340^\300\270\027\276_\374\177"
+	.ascii	"\264[G21\250"
+	.string	"\006\336\276\342\266\275\227\313\345\222\373\bs_\376I/\337f\227\001\240\227}\316\313\266\276\\\353\313\264\276\234\036y\236\365e\264/\237\357:\233\346\345\356\313\267/\277\201\251U\366CdY\036\313A*\035i\036=\306\333\356\356e\274Ok\225\220\264\375\025\334\317\332\005\326\272\273l\201B,f\315\372\212\313i\355\243\365\262\254\354\\yh\335\31100%T\003Y\302\362\306\333!\"P\247\310j\225\f\033\243l\033x\343\347\3546\254\221\263^\021\300B\222\266\257*>@2,\214\262MP\005\005U\240\003O\220$\333F8\350>y8\273w\271Y\223\\\214\230\245$me\340\230\327%k\0236\253V\332\030\246\342\234@\367hn\366\223\017\333\335\013\353\311\253Y\237\030\300Z\267\322\026\004n\215\262\026\357\232\260(\312\340\227ccVf_\361\254\315n*_s\220l\324\213\366e\3313\030\3723\241O^I\244"
+	.ascii	"\213e\233\312\334L\007~\326O\366@D\204\202\020q/\234\265\032"
+	.ascii	"\004C\033\305\324\233\004\367lf\022\001\\[\002R1\350~<\337\f"
+	.ascii	"\006\\{\300A3\232k?#\235\357\b\002\327z?\025I\227\3043r\341\200"
+	.ascii	"k9\025)\tH\325\240\352j\360\226\324\b\270% \234\212\244C2\352"
+	.ascii	"%\251+^\034\365\222\224N\260\bQ\324a\304\007\025B\034\344kV\342"
+	.ascii	"\265\020\202\321\363\305\320\351l\272\032\274\242\244S\351|$"
+	.ascii	"4\302\204\210\242\334O\267\363"
+	.string	"\031\375rJ<#\030\271#\337RNH\345^\f\235/\367\353\365|9\0333\337\233l\037\341\241\246v\342\276\311\006\335[\337x}\254P\301\264\275\030\356\347\317\360\247iR\031.\200\034\353\216{\341\255\325\247\273\303\005\2039\177A\177\002\350\033RM\026\252\013\227y\215Z}\240\027\372\364\277\332)XdbN>aF\332\231\333\332\207lS\341\322\372g~\205D\351\305\001d\235\272\027\332z7\246\f\200\201\250\201\034\305\020DJ\251\221\221\240\240I\222\016`\002\0312\243z\021 \271THHh4)\2445\320\026\225C\323\330\003\261\206\021;\021\003u\264\2555x\344%\021\023\321\254\364\340o\231\027\246\347}q9\331\227\365\304'\005\334R\230\035\n\365\351\220y\360v\253\021+\037#O9\273\244\356@\202\262\343\312\001;\211\035RS\b\253\370\325\360Zt\327<\264\027\314\270e'\274\235\330\360f\306\260)"
+	.string	"\330F"
+	.ascii	"c\t\331;k\304\305\303\260\311\205\227\022M\033\027/j]8\035\272"
+	.ascii	"\234\300t\334\247\2469\376\024\036\004\307LXp\234a\024l2^\346"
+	.ascii	"\035\205g'pAg\241\341x\257\001y\242\226\311\327\203@\222\346"
+	.ascii	"\255p\325\376\022\037;\031\027\243i:\264I\3638\217\212\fJ\001"
+	.ascii	"\307\264\356\224U\300,\210x\335=u\315\360\326\013\262\357\035"
+	.ascii	"\377+t\rS?{0\027\213^}\231a\\cp\026\333x\216p\ro\232\207\351"
+	.ascii	"\274\212\035T-\224\245\020\346\362mK\020\370\363\231\021\322"
+	.text
+	.section	.gnu.lto_FLASH_Lock.part.0.208.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"\025\n"
+	.string	"\346RE9@\257\032\003\230\222|mI\022\216r\032\221\363\305\336\262a\023\301\202\037P\243U\245\017\323\335\364u\263\215\267y\032\241\2237e\030\232\b\016l\3310\001+\226\306\266\245\224)\0053"
+	.string	"4"
+	.string	"3"
+	.string	"Vixe\263\374\026r\tFr/\024\227{o}7A\276\372\224t\345\337v\315\bc}n`\033\227\002\247"
+	.string	"\n\367^g8\356\356\266\023l\203l\267\004\247\331\"%?\276\363S\230w\237\023\246\202\213\331:Z2'\347\314\223\236\336)\263\245\364)\255y\004\304\356\315\310\275\334\217.E\304\276Mes8\357Nb\007\225c[\236\336)sf\245\206kM\2149g\2665\362\263\340\003\030\204\277\344'\366\270\030\355^\327\307\212\214\253\036\274\263O(\371\321\336k\262\354\233\374v\341\336H\200\243\317R\224P\236hK\336I\344\221lh\002A\017b\364YOD\303g\301\303\360`\340\257\343\0019|\252\bN\204!\261\226D!R\375\302S\355x\266&0\254\242\265a\021"
+	.ascii	"ze\321\033k\270\215\025\030H\004D\3010W8 &0\316\210E\235\323"
+	.ascii	"i\241\315\224\235\006\200k/\246\234\226\323\257-c"
+	.text
+	.section	.gnu.lto_FLASH_ErasePage.part.0.209.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\375\001\225\021"
+	.string	"\026!sG\340\360&\035Z\276\305Y\304\310\374*\342\202\377a\250l\347\352G\"\003?\310\3708\3403\364\357\344\245\243\326\377(\207\003\256\312~\323\020\237%\270\016j@\001\320R\034o>3\001v\270TI;Yo\207\354-eJ\001["
+	.string	"c"
+	.string	"W"
+	.string	"~\332\377\271\t\230\003\305\334cW\007\006n\267f\340\321\036\352\321\265\177t\217\250\027\350\036\375\3315@veJ|njnN\273\353i\210\177\207\232\361\363\177\2303\332\206+\024a:\2621\200&\203\0376#f\267=/\320b\231\252G"
+	.ascii	"&\273k\024\207\273\273\355\004\266O\354\214\0208\026'\"\2210"
+	.ascii	"\362\013\017\315/*\231\023\013N>7\336\343\211\376\333\325\276"
+	.ascii	"/\364\023~\212\0279E\364}(\304+Ymi*\276\002\346C!+\031\201\225"
+	.ascii	"\345\374\340\020\240\036W\360\267o\004\205\223r1\340\254\312"
+	.ascii	"C\223\317\007\246\335\332\310\243\017\370\266\373\266\317N\331"
+	.ascii	"0v\352\371\240\357@1 \265\325\220!\272\343"
+	.string	"\324\253\202\020R\222\345\223\375\026\022\356\202gw\3463\026Gj\271\022\215\335-\301\375\310\345\213xt\005X~\366\350\303\272\307\334\275\223\272\307\353mG\311\020\352Y\252\3111\223\271\324\035k<\334\335\265\352\3301\035a\032\376v\353\203\376\204\351wd\007\221\030\2736\271,\224\204\200\2220X\353\245\242r\202\322Za1\b\340\024\222\005\016\0244\360\\Z+/\226\2137\201\205\325\342\245\274`\036\311\312.\n\255\227\347\342r\275\274\324Mf4f\205\002\022\352s\367\213.\252\275\302\222\237yE\2432N\215\036F(U\250\017f\3204\3052\247/z\307RN\317\r\232\022\261\314Y\177\236'&\234\006+ `\2021F\371{\371\202X`\016]\204\230P^\347\342u\0162\213\023\206\355\2773\003\203\343\300\324\305\274=h\310\273\021`\004\030\230\302\264\205h\211\327:\325I\3631\200!\232\013Q\352\324g\276\233"
+	.ascii	"\375\241\205\333k\333\304\300\327\312\246F\035\303t\nq#y9\\\213"
+	.ascii	"2\272\214\346h\200\371\265\030\017"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.part.0.210.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`5\001\005\016"
+	.string	"V\032_E\360\262&\035\222\307#t\347\231j>\220M_\343O\370\021\226d\375\202.A\322z\024\022\320\264\254\033\202\2645\242\366\374d\217\252\256\303L\337\255\261\225]\206\225UOK@\245\020%\007\301xG\321o{\313\235RH"
+	.string	"K"
+	.string	"J"
+	.string	"\337\2119\200]W\215\240\335\356\300\243%\366\350\356\004B\217\330\005\204\036\315\331:FvU\243\025:30x\354\256T\024\347\256\017r\276\352\372\237\243\234\310y\261Z!\376\002\034\202\234\354\2561\021w\274\355\221m\t\366G\004/\037k\"\322Pa\373@\206q\346\241\303i\321\354v\006l\303\204l\220M\t\371h\377\207\263Ev\312\026\351\273\017\367\036\024\354\266\245.\376\"\365\036\224Cvmz$\300\0363\370w\036\356;1#\335\202\240\361\237}\026o\221\nOc|\206i"
+	.string	"\316\356\352\254\r[)(\360hgpyg\371@9l\334X\251\312\252\276\f\016(_\307\177\t=\222\244\250\271>\305\221\263c\346\207\314{=\275\261B\270\273ku\331\367\3715>\277\363\374\007y$d\315\356\207\026\3310BP\222-\310ZJ(\220\346\026\301\244M\226m>\250\320@\205A\n\312\004\222\322\313\005MC\234$\222\006\275b\222\002\301\201\212<\225X\246v\222\030,h&\2712]\244I\346\255\2454\345i\333\246\024\331~\207\253.\237\310h\007\253\352\215m\221\033"
+	.ascii	"zeY]\326\360\266\361\300cB0Hcd\211Z\016\210\202at\271:\214\212"
+	.ascii	"Dn\206\261A7\2450\215\344\024\f\206\205\360\213@\n\227\031ar"
+	.ascii	"\316;\334iE\\\313F9GS\350\273\n\036"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\350\020\2053"
+	.string	"\252Qh\021B`\336\312p\353\237\323\264\262\205\327q\b\246\351$\203\036\345\201\350\016\276Ky\262\347\372\310hK\354f\"&\342\354\360\027i\303_P\237b\2753\241\326@e&\005\370\341\027\034!w,\370\263\225\3342\005\004\001\374"
+	.ascii	"\f\001\273v\016\351E[\251~\236\220\276\231 }< \3752Q\375\273"
+	.ascii	"\363G\337\356\244`\001\255\3602\324GJ\013\330\206\376\227\223"
+	.ascii	"\350gP\273\364\264=\234V\tm\352{\361\321\257;\231\226\311\322"
+	.ascii	".\351\321{v*eH\332\025]u\225\360\3505\373\200\001M\366\351\026"
+	.ascii	"\251\277\\t\tP\271i\177\256\373d\316\035\3751\247\216\276\230"
+	.ascii	"\263\250\b\355\240a\223\251X\216\276\334\211\243\337\345\306"
+	.ascii	"\271\234\311T\314F\337\255F\357\027\032\275q3z\341N"
+	.string	"\031;\005=R\203\307Ac\034\0167\233\315&\214^/\347\213\336\267\023y\345O\232L\252.z\311\316\026Oc\261PV\034M\305>I\261[(\326I\320\005\240\233\235\350\307\235da\024\264\016\003=\364\301\234&\316V\342d$\336\246\340k(\377\253\246>W\233\220G\2675\242\017w\212X\247\237\243\365\201\376'\246\311dz\345\357\377-j\001\244i\232\206\350\277\235\377\t0\003+f\2467\n\257\027H\231^\251\273^!v\275Su\275D\350z\213,{\245\314\3656!\323K5\2467ILo\226\\\357\2200\275\\`z\257|\351\325\212\353\r\203\353\005\363\322k\345\2557H\227\336/\267\336*m\275^l\275T\326z\273\324zy\244\365\252h\275Q\270\364b){\215\234\365\0361\353ER\326\233\204\254\367\307\226\336\252\261^+-\275WYz\231\260\3646\211\365>m\232\246\377\202+\275P\033\346"
+	.ascii	"\354\206\250\225\037\242_\275\311\263J/\222WoJ\245\337\354\352"
+	.ascii	"\3179\227\253\002:\245\037FJ_N\224\376\033(O\203>\351\273\331"
+	.ascii	"\352\267q\322/\324\372\037\332\244\317\206I\237pI\177p\355\013"
+	.ascii	"*\351\007f\335OP\211k\223\364\001\221\274\357\310\321\030\271"
+	.ascii	"\032\364q\205LW\213\325_s\325\347[\253\376\336\t\257\326\244"
+	.ascii	"\255\352\353Q\365\231E\372g\246z\333\226H\007\274Y\253\243\364"
+	.ascii	"c\t\023\235\3713[[\036D\334\303\344\033\342cV\204!.&w\323\214"
+	.ascii	"\201\215}\350|pcH>8\304\034\"\fE\020b \007\017\030\351\200\221"
+	.ascii	"\r\030yC\006H^f\032\304\253\f\n\342e\246?\274\312U\377~\0260"
+	.ascii	"\210\335\303$M5\003\t\370\310\320g\265\016\003\341\016\247\207"
+	.ascii	"\215\232GF.\257Zh\344U\26612qucd\"s\271\251\307L\373\033#\007"
+	.ascii	"X\0030w\233\203\203J\212\253\241\221\213J8F.2\367h\025v6\306"
+	.ascii	"\205\262\263\356\261\312\351q\214\274\303\224cd\236u\216\221"
+	.ascii	"y\230;\200o\354\207\306\301\003\214$4\300<\253`\221w\222E&\256"
+	.ascii	"|}E>BS\364+2r\260\310D\365O\207\227\231F\207W]N\033\223\004\344"
+	.ascii	"jt\370h\215\016\033\001\3520\362\201:LT\3621\023\327\235\220"
+	.ascii	"G\367\344}\314F\313kX+\231\243aF\336\217\271G\311<#X\365\316"
+	.ascii	"\002\230\013 \335;\347u\307cd\031\206\322\233s\346\206\277\273"
+	.ascii	"`\025\022\226\317\357\030\304\236=\267[*\267=\256\343\353\230"
+	.ascii	"h\370:^\346\323\353\036\347u|\364\302"
+	.string	"\327\2611\017\260l\225\276d\243\272)s\217Rw\377[\r\250L\345\r\327\3459r\324#\273\364%\027P\217D\230\2709U\245\265=\276d\036\3658\365\265\323\325e\267\243\036\213\340\375o\025\220\\n\266\261i\371\234r\323/%|)\377\267\266>V\246/9\200\372\345zQ\271\365m\323\272\347\236\027U\3346}\271N_\262\321\227_n\337\226\301@\343\347\316)\262\247\2507?\307<\311\375\341\226\225\337\201\313\361\216\222\360rI\227c\242\331B\350[\303V<\032\2030;\032\023\223e\347\242<\331\317\030\310\214\201\204^\306\034\212\362^\306\233Ut2&\252l\227S\304\253T\213x\263\2044\360&\037d\340\315\022\302\300\233|p\301\002\023\327\260\377\021\361\232-\0015\250\267!\242\201&\250q\024%ME\"M\222\3024\006\241\005\004*\350\310\352\021\220\220$\241ADdD\002\tdJz\017\253\276\216"
+	.ascii	"\300%W\221\261\004\261Z\320\233JS\243\003\272\030\232)j\032"
+	.string	"+\327\n\206\350\020hcT\250\036\233i\022\020\320`\thN\324\f,\334\016w\004a\313\301\205nel\332\363\274\r\354#\033`\313\200\334X\326A\242\315\016\343|\005f\261\245\221w\270\362\234\247\243\211\342\332\343\333'\030\271(\376I\375I\312\037\216\321\362\017\306\221\225y\373J\230a\347\036\021@[2/;\313,UF\360\315\212\002\307\007\177\020G9\254\037DnE\005#\2532\270\375IF\353~k\243Q V\257rW\257\n\026>1\277\"\362\243\2346\240I\252x=9\347[\023\374\202\3402S\r.v:\314\036\322aS\341\247\217\371\1771H\303\251`!Y\260_l\357\272,\2037X{\006ew\314\322\316-_\271\362P\200\316\342h\340\302\233PP@\021\351/\025\005:\313\363Z\237E\366\345{8\216\343t\034\307\3518\216\323q\034\247\3438N\307q\234\216\3438\035\307q:\216\343\364"
+	.ascii	"\371\215\2236/\357O\f8\006\276/\003\b\211\327*\274P\215\205\313"
+	.ascii	"\tz\327R\027\300\022#\207\203b\311\034\003!\001h\360\321q\360"
+	.ascii	"?\216\220a\373\311\342Gs6\322\034\265YX\210\225\037h*7\222}\367"
+	.ascii	"5L0\254O'-\304]dr\266\303=\r\303du\022\204\224\364\201X6w\334"
+	.ascii	"&G\335\235\004\247\337\215$\013\276$j=Uk\375Zv@\256\366\251\035"
+	.ascii	"\221-\370n\325\243\021\024V)/08 \305\274\271\3714\327\n\233\241"
+	.ascii	",\310y\342\260`\024^\371\243\205\032\033\323#\307dL\255\3251"
+	.ascii	"\223rJ\251J\376.\027\f\344\001d\217L@%\2650`\350\233\203\253"
+	.ascii	"UT\251\225\212\026\277-;\t\306\r\257!\236\243\275\227/ZG\332"
+	.ascii	"J\352\321\255`\025"
+	.text
+	.section	.gnu.lto_.refs.3abad1c855f6281b,"e",@progbits
+	.string	"(\265/\375`\363\001\r\017"
+	.string	"\006\345e<0\2136\303\001\300@\231&\031\034\340a````````\200\256\263\311$\223^\334\324\267\255\002\252\375\003T\005\244F\343(s\32496\321\342\377\361\255\237\232\210\bm\262\245L\001N"
+	.string	"T"
+	.string	"Z"
+	.string	"\226Dg\246\030\316\271\360\212\210\237\250\374\206q\r\366\031\214c\"\370\305\362\021\025^\241p\n\366\025\345)\250O\257K\021\217\246\207\242wPw\257\274:\255V\032\212WP\247^\237\".M\374I\357\242/\324\373:\241:\352\215\276\206\337o\210V\257B8\325\341P\310 \330\025\201~}p\313\343\343\353q\307\373\332\340\226\006\2278\036\332\370j<\340me\374\224\261\200^\270\237\305;\316Wb"
+	.string	"W\321\271\231\202S+"
+	.string	"\316\355\t\276\331~\323\272f\373L\306/Z\307\266\267\264^e?e\377\262oFM}B\007J\340\334\244\021<\020\002\247\356\300\335&\274\227\360\201{\272\354"
+	.string	"Z\262\360\327\300\035Y8\304\300\375,/\350\345X\001\023 8\320\235e\003-\320%\351#\222\376H\272\333<I:G*\022-\362\351\037\017\357x8H\b\377\350\360\016\016n\341y\215\347)\235\267\256n\005\3574\016\335\300\247\214G\331?\255C\231\2067\206H\307\260\350\027#\235cu\n\252Sp\372\226\351\022\237\216\031\004\257\274N\201\272\265\371j\303\245\rgF3Tv\3333\033Cw\177\340\005>\361\351\332\346\263\213c.\027\307(\327\311O\027\207>\331BU\201G\237\224L!\034"
+	.ascii	")\2027\220X\220\tg\200=\226\265B\260\337\263K\314%`\261\312\242"
+	.ascii	"h\256\371\211-\030<\346\340Q\2474!0 \f\024\321\252\322\264\200"
+	.ascii	"X\030\310\311jH\344\314\264\030\016\204\006IP#\246\363\324IK"
+	.ascii	"k\356\001"
+	.text
+	.section	.gnu.lto_.decls.3abad1c855f6281b,"e",@progbits
+	.ascii	"(\265/\375`\035\223\245`\002\352\344\343\332W LI:\215\001~iV"
+	.ascii	"\t\025DT\004\024\005\021UG\004\263/\356\344L'\002\024DU\021D"
+	.ascii	"\314lJB\240je\027\241\272m+\206F \343\266w\001~v)R\377\337\342"
+	.ascii	"\365\352\364r:\275NA\356n\217\363\257\f\262<\276CHiUk[\356\275"
+	.ascii	"\345\2262\005\013\f}\r!\0168\237Cp~f\245\210\"B\302Y\204[\223"
+	.ascii	"^\317\320\327C\372\244:\253n\223\203\323\212I#\023\206H\030?"
+	.ascii	"\234\257\267\376\345 \275\201\227\203\364\374q\002\271M\021\316"
+	.ascii	")"
+	.string	"&\r\366\001(\366\205\363U>\375+Bz\006\006^\021\322\263Gv\301\207\345\206\363\325;}\2643\352\034\"b\352\022\262\367\336p\225\236\324\210\232\343\341A\346\313\\\220\326\271\343\324\301GcI\207\263\216\323\351|\272oa;_\361sqC\013\3526O\035\231\271w\031\nQ-\262\344|>\375\fk\026{\200`p\276\032E\377g\023\323\255\022\210D\306\264t\2310\240\331\373\t\233\303\371L:s\334f\207S\351(\020s3\271D\005\035\341|\265\211F\301\336\267Cz\003\003o\207\364?q\334\b\356\371\020B\267\367\363\306\217\275`\276\323\3065\242\241'\004\347s\231\277\340\261\340\202\363U/}\023\376~vv\031]\240\342\212\r\274s\006\006<]X\225\240\267\301\b\351;e\2341\316\243\023\351\254q\322\270\315\263H\3119\343|q\032-\311\321\367\205\tFH\037\266:g`\277\237\335\267\260\235\242\253"
+	.ascii	"zL`\204\364\205@\341\234\201\301\\\272\373\266\334?y\002\320"
+	.ascii	"\243\372p\251p\231\301e&\3776\177w\302\270\026\037n4\270p\276"
+	.ascii	"\312\245\257\026\321\230ymR\017\267&=[\334`\265-?\346p\276\352"
+	.ascii	"C\377?W\234C\267y\262\270\t8\314\371\263\302\005\336\336\314"
+	.ascii	"\223\305\tt\252\330 hh\0039y\310c\202\021\322\2677\363\346\303"
+	.string	"\207 \230(mhi\376O\025g\2123$2\324p>\205\210\252\322\216p~\032F\237A\277/\252R\264\341\374\024\214\376\317\237sg\262\345_\340\033\r\n\225\244\251\017\347\247y\372\351\235~jE?\215\242\2372\321O\231\372\251\226~\330\265I-\330\327&\305\314[\223\342.8\307{\257\351\300L\r\rgU\257C\026\332\322\016.8\255hH\021\234oB\026l\267A\320\320\004\264\242\266\340\274\333\304x\370\356\330\nk)\303x\370\n\306r\337\226\314\215$\204Z\333\322w\215\266\330`K\363\335\327&=\252\247\353^H\271\030\302\371h\026}4\216\3561\\-\366\332p>\212\246\217\212\351\037\317\271A\301\352\372\261\"\207~E)\002\204\345\236\275\230dN \032R\316\342\340\304\264\274\271\300\031S\301o\267\351\001W\371*\304\334`{3i\3269\275\034a8\037e\352_\017)\215\207\364\307S\244\004\375"
+	.ascii	"\335\300\371\307R\334dj\274\375]\341\214\333v\360\b\016\357\t"
+	.ascii	"\316G\2674\230\033\210\201^<\031\321r\271\\mFh\303\026z\n\033"
+	.ascii	"r\265\231uo\247:\252\246%^T\013.\234\003/\305\335\300\013\342"
+	.ascii	"\207\203\260\020^\021\267\205\247\244\352K\336\275\303M\314t"
+	.ascii	"\265\373\026\006\2018\033x\230\013\263a0\\\206\305p\024\234\206"
+	.ascii	"\225\3400\314\304K0\023\254\206\3210\024L\206\277\360\023\334"
+	.ascii	"\205\315\360\021<\206\235\3403\334\004{a$8\t^\273M\334\274\177"
+	.ascii	"\307YXK\t\025\030</|\0037q\222\b'\263\251[|\345\360\361\003K"
+	.ascii	"\r\351\335/\277;\202\235\360\323\213$S\177`\256\337\r\023\304"
+	.ascii	"\205\213^\340#\241/)\252\0338nN&\225\272$N\to\357\0354\204\211"
+	.ascii	"TPa\264\256x\"\202\207\245\345\352\335.\267\357\013\t\036v\322"
+	.ascii	"\201y\250\240\302hu\361Ed\344\252\217jo\346e\366\300R*\2500Z"
+	.ascii	"U<\261\300H?.j\342\030\330\306\311\244R\225\004-\341\355\275"
+	.ascii	"\255\204`\251\231\037\016{\353\330B\2657\363&\374\330G\023\003"
+	.ascii	"\301R\033\004\rM\300\n\020oo\346\357\335\177\26541\021l\344\276"
+	.ascii	"-\367>\362\200HT\026\032}{\357\0177\037P\271\037`\322\026\220"
+	.ascii	"\177\274ul\344\277[.\036^\206`&\n\024\224\0278\343\"8\307[\257"
+	.ascii	"\021\222\265\001\006\301\271\006\214\226Y\323\323\317s\372\231"
+	.ascii	"M?\223\351\r\267&}6\242\237\247\3643\223~\216\241\237W\350\237"
+	.ascii	"_\364\231X\364o\023K\341%\004\206\340\250\303\371\247\033\217"
+	.ascii	"\035\032\310\314\t\225\035\030J\210$hy\204\363O4\3753L\377\354"
+	.ascii	"\322\177\2735\351O\"\372g\225V:\215\224\035u)p\376)\245\177\346"
+	.ascii	"\320?\217\364O \275A\306\261\215?\004\nx\031\202\215\001\n\241"
+	.ascii	"\240@\2341\r\\\343x\211g<\004\n?\177\274\266\221\2757^\236\300"
+	.ascii	"\2647\020^\322\374\355\rDs\357\007\367~\220\213<\005\031K\363"
+	.ascii	"1\240\306\3019\226\361\232\213\304\257\013\n\316\307z\372\006"
+	.ascii	"\037a\243\333\344jM\252y-\030\306\377\307h \003F\203\306\027"
+	.ascii	"\316\307t\372\030N\337}kR\314\002\267\270\315\273a\027O\313\310"
+	.ascii	"\212\b\341|\274\246S\260\003\357\335\322\343\246\376\361\n\025"
+	.ascii	"4^\250Xa\252\300)T9<\263\0268\037\203\351\343-}\2150\020\376"
+	.ascii	"9[\024\321\270\202\177\360\2369SR{\202\3631\020}\354\244\377"
+	.ascii	"\033\006PX\2464\327\002\360\376\321\374x\213\242\205\363\261"
+	.ascii	"\r}\354B_\2460\372\356]/\267\371\266\313w&\315L\223\025bm8\377"
+	.ascii	"\362\351\337\267\245)\270oK\177\361\364\245\2725\351o\026\235"
+	.ascii	"oMz\231\256MjAM\352\301\265I\377k\367\266l\245&\324T\307\246"
+	.ascii	"\225\320\005y"
+	.string	"\311B\267\365\344)\f\347K\207\357\225\213\345\227\356\316=\004\n\217\021\332F\366f^\272\2747\320\275\037\314\334\373\001\252\006\004\350+\315\277rV\344N\257\261\032orq4kman\304]\270\264\310\226 \243(U\336\360\234\220\246\340\374\3377*3Ep\333\t\347\377\267y\251\334)\314}\263z\241\003\334\302\371\027M\377W\212\3339D\304\264\303\366frP\317\230X5p\276mL\241\275\367M\214\013!QI8\377*\321\\i}\377\215r\235\334\265\373\344\252](\267y\331\376\213v\233\374\206\271\267P\222\313v\303.\231\026\234\313v\231\034\315\005\217:\023\376\253\244\354\016\307\354\202\335\267\345\206\275y\330Q\355\275\177\215\374\227y\331n\327\005SA\205\321\336O_\n\200\233\033\323\353\333{\177\270\371\220\026\tIB4\223\177\211\264f^\233\364\016\335\232\364\367\354\327\tn\243\360\034}\016\350\257\240/"
+	.string	"\375\337\261_\262\377*\271Kd\260\224\001\371\341|\305p~\307\026\340CG\021\234\317[\223\236F\343}mR\017nMZ\302\255I\377\373\365\013\366\337#\027\311\321b\230\366\026\332{cpJ\345(c\202\363\365\302\371\375\372\357\3265R\223\032-\231;l\357Ms6\237\250\370\303\031\337\232\364X\277yk\322\313\2746\351\315\255I\217wk\3223\257M\252oM\032w\306PrR!p\316X\342\234D\032< \355 \205\224\003\324"
+	.ascii	"\351\006\177\252\001\n\302\237f\360c\r\244\035\376\223Ez\363"
+	.ascii	"\343\f\310\244\030\374hN/\370\321\2476\331\313\237Z\360\343\b"
+	.ascii	"\2445\377\365\360_\206\016|\340\024z\003~uE\301\275D0|yg7GD\027"
+	.ascii	",\027\341\022\267\250"
+	.ascii	"U\230,\241Q\270\016\0033h\205\263\006\275\n\376S\002'\004\376"
+	.ascii	"L\201\031\034~\374\227Y\320+6\374x\304\331\224\322\374\351\314"
+	.ascii	"\177\255\214D\245\232_e\300\177\326Hen\217\030#\374g\016:\227"
+	.ascii	"\306\244\302\037\333\345-i\360GSp!]S\375\347\277T\275\006\277"
+	.ascii	"\332A\b\245\300\237\246?"
+	.string	"\326I\321\013\202 \365N\215`\3512\205\320\354\177\246 \315\250\333\325\361_\247\253\204\236\370qTz\3767\3470\\\371\007\177\n\370\377J\t\327\304\377.]\246_\340\302_s\340\317\"\340_\277\360+\025\370\177\345\371\327\020H\261v\300\275a\225o4\316\2379\\\244e\246QJ\357\377\233\313\200\223\316\341\327\030\374J\306\032\375O\035\0219\350\034\337\226._\365\256\330]\342\321_\335\373\317\272\364\377)\342\022/\363\253T~40\314\217\002^\206\016\\\342+\370U\2663:4\021fgLr\374\247\021\224\255\003\314\230_\375\211[\242\346\343\307u\250\216\007N\256\317\374j\t\376~|\202\313PD\365\361\3731\212\023\253\304\357\257\346\\\375\325\341\b\200x@\003\350\006~\024\314\257\030\337\201_\360\253\032\370Q\023\374\330\307\227\037{\241}?^\"\343G\371~l\346\005-\372\252BW\354\271\2359\350\\^"
+	.string	"\332E\017\005\362\3438.?\312\364\343\265\274\037\305\373Q-?\026\273\373Q\273\037[)\362\243u?n\222\345G\275~\024\313\217\261\320\375\231\t\325\251\2739a\347\300\257}\362S\206\212B\257\374g\016:g\274\005?\372\364g\246\037\207\345\246\037\265r,\035@\345\320\022\377%b \214"
+	.string	"tI\334\377+7\236\203\037M\221\207\240p'\362O\326\377\372W\222#\360\317O\370S\261L\204V\301?\350[\256\361c\031\224\n:\005\225\202\272\271=\203?\315\3723\320\177\245\240RP\267\333s<3\200\266\375\311\3776\324\b\312\366\243:\377\035\301\332\177\021\324\376{\240\003g\225)R\250\023\267\233\360\253A\376L\002M\373\017\345G\233\374\031\211\242\375\247\006\234\374\331\004\332\374\317\031\256\366\243g\027@\231\270}\203?\345\361g$?f"
+	.string	"\032\366c\004\240KP%\017\376j\f\377y\002M\362\237\025@\301n\316\327?\315\3733\336\217~\375\350\326\217N\375h\323\217\316\370\321\027?z\202\037E\361\243\312\0375\376(\373\243\033\370\321\030~\264\002?\312\302\2172\340G\017\360\243 ~4"
+	.ascii	"?\332\341Gg~\024\375\321\373g\300?\363\375\371\353\317\314?g"
+	.ascii	"\375\031\310\237}\374Y\352\317P\177~\372s\323\237q\374y\371\347"
+	.ascii	"\242?\007\375\371\304\237{\376\\\3743\r\177\276\300\237]\370"
+	.ascii	"3\005\376\314\302\177*\375\347\214\377$\372\363\002\376\234\200"
+	.ascii	"\377\f\372\263\n\177>\341\317!\376\023\005\177.\341\317 \376"
+	.ascii	"\\\200?\213\360\347\001\374\031\204?{\360\347\f\376|\363g\016"
+	.ascii	"\177\246\371\263\314\237\205\177\306\377\311\367\237z\377\t\346"
+	.ascii	"?\267\374g\337\177v\371O\274\377\264\373O\272\377\234\373O&\377"
+	.ascii	"\311\374\317\270\377\254\362\237S\3763\312\177B\371O\265\377"
+	.ascii	"L\373O\264\377<\373O\262\377\f\373\317$\377\331\365\237\\\377"
+	.ascii	"Y\344?\261\376\263\352?\203\374'\220\377\364\361\237R\377\t\365"
+	.ascii	"\237(\376\323\351?\227\377Y\364\237,\376s\305\177\n\375\347\376"
+	.ascii	"\317\032\376\263\375\317\344\177\"\377\223\347?E\360\237#\376"
+	.ascii	"S\347?\211\3779\374O\020\374\247\007\376S\003\3779\303\177\306"
+	.ascii	"\360c\006\374w\351\2776\376\253\364_\344\217\253\376\263\002"
+	.ascii	"\377\375\300\177\212\370\361\317\377+TN\t\374'\004~\374\367\343"
+	.ascii	"\276\037\333\375\270\356\307X~\334\344\307V~\034\367c\267\037"
+	.ascii	"\257\375\030\355\307g?6\373\261\330\217\303~\274\344\307_?\366"
+	.ascii	"\372\261\221\037[\375x\352\307>~\034\365c\036?N\372\261\320\217"
+	.ascii	"\201~\234\202\037\237\340\277\f?F\361\343\366\307#\370\261\361"
+	.ascii	"\307$\376\033\367\343\021?\326\371q\b~\354\201\037k\340\307\031"
+	.ascii	"\370\317\367c\013\3748\002?\206\300\217W\370q\003~\234\200\037"
+	.ascii	"s\370q\005\377\215?\236\371\257\334\177\247\374\207\341\377\005"
+	.ascii	"\376k\365\337\251\377\022\377\333\343\277$\376[\342\277Q\377"
+	.ascii	"\335\361_\250\377\026\370/\323\177o\3747\371\337\021\374\227"
+	.ascii	"\375\257\316\177i\370\037\303\177A\360\277\356\177\226\377X\376"
+	.ascii	"\313\375\177\373\357\366\377\205\377q\377\333\376# 000\360\257"
+	.ascii	"\211\372m`\374\"x\0220\214\366\322\310\003\037_\332\247\177,"
+	.ascii	"\310\312[zP\275\204\362\264\366\236\366\251e\254,\\U8?\203 \372"
+	.ascii	"\031$u\351\222\227\001\213<.\351\330\nA'|9\002\324\357\260e\313"
+	.ascii	"\226t\354\034\332@N\002\300\252R\305\356\356hy\207Q5\321\357"
+	.ascii	"\320\245\377\024\213\2254\313\321V\b\032\332)\232\024\340K\207"
+	.ascii	"+\375\016OsV\322+\227.\357\345\376\341\342\001_^\007\034\372"
+	.ascii	"\035\216\342\342R9\276*\337\273\315T\016\205\02325\206\363o\302"
+	.ascii	"\350?\255\222VA\201\n\220\325\264G\370\r\027\375;wS*T.\335en"
+	.ascii	"\0308MYK-9\375KwS)\177\b"
+	.string	"\024n3\225r\351n\366O^\tYU\314\021~\203\246S\266\224-m;a\257)k\331\027\345i\333)e\213V\037\316\337\003\204\342crA\201r\345\226\244\t\243\206\332\300p\376M\225\376S\265T\355\276\335xm\244\031\036ANI}{\257\2150#\304\027\266\204\3631\360\323\251\331\315\3224\275\367\376an\030\n@\313Zj\245M\236\246i\271QprD8\247LR\264\377k\220n\305\034\r\264\346\r\035o;n\333\215\252\305\353K\022\234\3233\264,\24263\234\217\301\235N\311\204|,\242@\301\371\030D\321\251XPG\024'z8\037\0034\375\247K\236\206\375\350\225\324\006\t\002\001\371pF\233p\236.\231\362\004\017\t\316\177\252$Mrg\344\252\017g0\364g\371\242\b\347c\240D_%-\262\024M\241\302V0\334\256\222\240;\252\253\004\r\374r\002i\261\373qj\224\t\245C\367m\271"
+	.ascii	"-\273\364*\315J\221\244:R\"\351\221\224\231\032Iy\244_)T\032"
+	.ascii	"\225z\245C\322\256T*-\222\366H\265R \251\220\264*\345J\247\322"
+	.ascii	"\037\251\217\324*\305J\203\244;R\252\333L\267R\247\243\363*\312"
+	.ascii	"U\362\263%\306\032\336U\202\206\001\203\255^\234WR"
+	.string	"P\263\037'\007\022\024~l5\203\311\323y\345\227\223\3748I\350Q\030\225\025\r3\023\322\255\224)m\2329\367\326a\204\252O\351\b\212ey^\221\341\3118Km\37487\306\304~\034\034\350\221\030\036\022\233Q\033\336\336L+\":\026\347\325\314\271\267R\035\025\316\322\002\212p\245[\251\213\025\214`\301\013\201B\272\225\356\363\352\276-\367\271\005\310\317\211V\334\034\240\334\n\371\030\330\320\307\340\205N\233\316+\365*\360\005\027\234\217\301\220\376\005^\364/\220\323\277\200M\377\002-\375\013\226\364/(\322\247\2736\351m\362\364m\344\364m\330\364m\314\364m\226\350\333\034\321\267\301\322\267\201\322\267)\322\267`O\337\0028}\013\304\364-\340\322\267\240J\337\202&}\013\\\3504E\252\3426o\322\0254\027.\350E\022\316\267@H\247`\337\233\364\201\367&}M\237~\315\234~M\231~\r\020\375\232\031\372\025"
+	.ascii	"\352W\360\246Q\300\037\365C\377\360\362m\310\2209\234\357\320"
+	.ascii	"\265I9\334\232\024[\341\034\005\303\004o"
+	.ascii	"\013\306\027\264\017\251l\213\005\316|gC\364T\340\374\n\230h"
+	.ascii	"=t\017\355r\233\250\0274\357'\334\031\367\213\232i!\243\302C"
+	.ascii	"\267\314\374l\330\373i\214\312\013\312\005\335r\002\021\257\253"
+	.ascii	"&}{\357\233\017\037>\304\024Y-\235\351\374\n\236\364+8\322\257"
+	.ascii	"\200\305\026\364\210\306\252\006\323\030\316\257\340G\337\305"
+	.ascii	"\300\001\365\350Q\207\326a<\017\314\035c\006F\036\007/\372G\351"
+	.ascii	"r\026\024\013&\302\261\334\202\363\361\256\340\034\245\303A\302"
+	.ascii	"\332\332p\226\261B\206\373\360\262\307\214\030Tp\276[8G\255\274"
+	.ascii	"&\356lo*\016\356\354\321D\304+\016N\004\300&f8\243U\326005\200"
+	.ascii	"\304Qq{C\247\334&J\205\312\211\205\246\335\267e\013Tmx\250\224"
+	.ascii	"\037mC\335b\2766\223\0358\337\260k\223v\2705\351=\202s4J\032"
+	.ascii	"\222\027\0246t-5{\242\003\ng\024\n\023l\357\335\341j\311\341"
+	.ascii	"\247\206\3639\234\3515\262'\250\223\333D\325\216\252\235Xh\332"
+	.ascii	"\314\017s\037\245,\244b\306\224V\254H\321\264\2031\211\352\201"
+	.ascii	"\207\2066\243\213C\022\375\243gg\250\325y\016[\372G\313\2162"
+	.ascii	"\371\263\027j\026\030\244\013\021\316o^\233\024%\3039Z&$cl\n"
+	.ascii	"\347\365\326\244\350XS\223i&\226\221\266d\354\370\241\004\005"
+	.ascii	"\202.\301K\264\207\f&|8_\255k\223\242Ip\216*\221\211\3721\344"
+	.ascii	"\f\347\013P0\324k\257\307\233\026\234\217\036A\221\034e\036e"
+	.ascii	"\242^w\357\275\227\373'\017\001GK#\017?\332u\324\353w1\033\244"
+	.ascii	"b?~L\341\374\275\337\375_\205Pz<M\301\371\034\252\364\177\217"
+	.ascii	"\377t\003\031\355\275\221P\3466\n\212I\377\373\213\336\353\341"
+	.ascii	"\227\271\347\375)`\334[\350\t\323\336\373v\321Wg@8<\330\377\177"
+	.ascii	"\364mo!\247\237\025\234\216\204\234j\f\2019\035q\030\002s\332"
+	.ascii	"?BS?\034\214\266\323\317\020\330\336\034\204\204~Z`:\032\002"
+	.ascii	"\003\332\034\206\300\366\321N\001wt7\323\351g\0131m\016[h\003"
+	.ascii	"m0\246#\017\206\204\234\216\206\300\200\2168\f\2019\035m0\247"
+	.ascii	"\275a\013\001\031\261\020\332F\0346\230S\336\006c:\3320\004\306"
+	.ascii	"t4\004\3464v\243Z\364\340\"C\215IJ\352v\r\t\355\027EI@F\033\336"
+	.ascii	"\206\230L\233n\357\033\246b\033\355\267\275A\330;\211\311\210"
+	.ascii	"\016\250\306m\006\275\275\b*\003b\272\314\275w\207\242\240'\246"
+	.ascii	"-\364\366s\367\333\220\020\246\275\205\004\221\330E{\357}\302"
+	.ascii	"\017\363mK\335\267\037\035I\233H\305\336\031l\346\336E{\377\334"
+	.ascii	"\375\266\367\376\331{\253FI\314\275ol\030\242**\332{yS\264\223"
+	.ascii	"~\320T\354\215\303\2624\217\206\300\236\230p\320\224\200Q\355"
+	.ascii	"\025\314\237;D\304\264\2516\235\223\221\006\373\351\332D{\357"
+	.ascii	"\253\247\251\216bp1R\212[\341fdk\365Sr\022\303\271\203\332e("
+	.ascii	"m\005\316(\221\023\013\035r\337\226\231\n\214\026Z\3446Q\"h\026"
+	.ascii	"J\344\\\273\233\n\203\310\215j!#K\232\277\001P\377(\326\321!"
+	.ascii	"x\031\202]e\250\fgT\b\316Q\254\024lj\210\b\316\007@\251\232("
+	.ascii	"\025ju\016m\240\247\023\252\216\232#\240U3<\031\261\341\374\r"
+	.ascii	"z\372\033\260h4HF\002\004$S\303\031\005\202st\212iH\326\023\316"
+	.ascii	"\030\334\232\024\365q\202K\217(8\177\303\024\264\007\323\202"
+	.ascii	"e\326\013\234\1774\352(\017\262\242\035*p\336\241\243\374X*\341"
+	.ascii	"\374\rf\372&,\235ANfS\257Xb\206\367t2\251\326\025<\316\360t\240"
+	.ascii	"N(\324m\242O(\323\321\246S\354\230\271\267\320\023\252\364\345"
+	.ascii	"\r5\312ae\212\3161\267&\375\006#\372\033|\350oP\322?\232\003"
+	.ascii	"M:\352\300\361\003g\034L\031-X2\374p\376\206\"\375{\327\002\210"
+	.ascii	"\nt\211\302@\221f~6l\241%ZT\250\rT\006:\003\275\201\326@i\240"
+	.ascii	"1n\023]\242/0Fr\361\203\310\007:\304\342\274\232\371\331\260"
+	.ascii	"\203\256L\235IB\240\200.\321\025\347\325\311\244R\227\360\b\202"
+	.ascii	".\321\2423\310}\213\332@?*\3541}Xk,\227\315\r\031EB\217\364R"
+	.ascii	"\210\210\006\316\250Q\246!\005j\n\347oH\241O\023F\237\346N\237"
+	.ascii	"\346M\237\346L\237\206K\237fJ\237\206I{\2706\351i^h\025P!T(\027"
+	.ascii	"A\362PUE#\244\177\364\347\267\211\376\240@\023"
+	.string	"`\356\237\340\2263\020)\b\026\316\237\001\324\177\016\f\354\342\242\377\354\367\034\346\317\177\031\360n)?\320p\306o\327&-\300\255I3\030\234g\277l\344\n\237\036\316#\334\2324\177\3713_\356\303\313\020(I\002$\207\363\215\2726\251\315\255I\357\026\234g/a\236\274\220\3029w\t\216]\221q\004\347\317\310\351\254\227\271\374\031/\347i,`OAp\276k\327&\325\340\326\244Y\013\316\363\226\030=:0\"8gP\367|\367g\243l\227\221\242Z\260E\301\371}\327&\315Yp\236\353t``\232\024\3163X~\367\323\225\3056\367L\367g)\371\212O\327\221@\234q\324\265I\363\023\234\347\271\340P\213\241\037p\317V\376\034\227\345\324\024}x\2018\343\241k\223~pk\322\253\004\347\031Nw\271\245\tMy\256\362g*\371-\306\214\217*\b\316\230\352\332\244!H\301y\236\202\245L\001-\341<"
+	.string	"\266g\267?G\311m\301/XN\262p\306a\327&%\300\255IO\"\234g\266!grYj\317k\177~\222\241\2443\340\274\364\341\214\231\256M*"
+	.ascii	"'8\317j\353\212!0F8\007\240\371\234\366g\264\334\004/\205IQ\200"
+	.ascii	"K8c\274k\223\2028\303yn\312\\eq\001\206\263\001\302n3\207e\263"
+	.ascii	"{\2647\220\2154\253j9\302\n\265\003\310\252\354\331\354\317b"
+	.ascii	"y\354\274\262\372b\204\n\347L\206\363\\\266F\235\261\200\303"
+	.ascii	"\371\006\006\336\232t\303\336\373\326\244\237a\323y\311\177\305"
+	.ascii	"0R\206R\312\262\204\363\237\277\236\225\374\031,'\tA$\305\003"
+	.ascii	"\347\257]\233Txk\322\354\205\363\3745\344W\004\347`fff\325L\231"
+	.ascii	"\376\263\221\337f6\222\217x`\356\030\302 h\231+\317\264Xq\324"
+	.ascii	"\005\347\317 \321\237\321\322\177\226\361\333\3142r\221\030'"
+	.ascii	"TUe\"\353\231\235\226 \234?3\225\344\017\201B\306\312U\227n\346"
+	.ascii	"\207\271a\244<\272\270h\365)\311X\271\306\020\252 Z9+_e!\331"
+	.ascii	"*\017\271\315\214\365\347\031\231\206\215\f\344\276\205\271\200"
+	.ascii	"G\344*\311Xy\331\202U\221\214\225\203d 3B\314\035cf\305\017\027"
+	.ascii	"\255\231\263)2\220\314\344\317\004\351\317l}\031@}\023v\344("
+	.ascii	"\036[~d\037\271G\236\272\315\f$Ke \371F\306q2\251\326\026W\376"
+	.ascii	"\360\200\344\244\354tv\031i\262\025_\360\215\037'\003\311O\031"
+	.ascii	"*\005,\352\264\264\366f\236S_X\254\202\3712y<\324\026mV~\340"
+	.ascii	"|\031+\3722Qt\326q\276\261\ti\341|\231\246\276\314\022\375?7"
+	.ascii	"\335fv\312L`\331)\347\310K*\026\033uZA\034n<V\344|\031\035:+"
+	.ascii	"\311\254IAK\303\37127\364eb\350\313\264\320\031\007\007!X\253"
+	.ascii	"\343\352\202\363e~\364c\376\364c\370\364c\270\350\223ymR\025"
+	.ascii	"nM\372\230,\372\317G\31712R\b\366.\333\263b\373c\032\331{\323"
+	.ascii	"\254h~X3p\316F8\317Gi\230/.\302p\246\231\373m\236s"
+	.ascii	"\371\005\322\002\262\216r\221\360\255\207\f*8?\246Mc\235Y\224"
+	.ascii	"\360r\213L\224Y\334fvq\027\347\332\252\202\n\243\025F\334Rvq"
+	.ascii	"\022\311A;F\001\256\330\204YsV\330t\376\275\323b\306E\f/o\214"
+	.ascii	"\n\357\274\373\"\243\312A\347\026\017g\227\221\036\013*\303\313"
+	.ascii	"?y(\013\345\024YE^\221\201n3\007\345\035x\206\t\303\313Ag\335"
+	.ascii	"yw\337\3026\220\223\007D\260\354h\366\355\2757\300\303\350jC"
+	.ascii	"~\314\230~\314\327\t\330!7\245\216p\301\3711@\364\351w\233\347"
+	.ascii	"\337o\230z\301\r\202\206DPm\341\355\315\374;\273\234}cax{\357"
+	.ascii	"\016\037>\240\177Pv`i\276\t^<\034\371O\276\363\313m\236}a}\347"
+	.ascii	"\236\207\031!\346>\n.\371\202\344\311\315\007\021\210YA\245\371"
+	.ascii	"\302;}\341\234\276\320M_\330D_\270D_xD_\210\245/\334\241/T\322"
+	.ascii	"\347\035f\332;\fj\353\016\t\347\0208?\355^\243\345\244\351\013"
+	.ascii	"\316\027\"\351\377\304\3623\313\177\223\234W\326&,^\260\300\371"
+	.ascii	"\244\303\371\211e\004:\230\244p&\341\326\244\2470\205\376O+r"
+	.ascii	"=]\270\262\340|\312\375'\334\031\207\357n\034\351\201\363\305"
+	.ascii	"\2736i\007\267&=\337p~V\231!\362\223c\ng\016N!\267y\n9\247\254"
+	.ascii	"C{\307\360 \353'k\331\267\215\214F8\245t\240\321\301\003\310"
+	.ascii	"\n\316\017:\321X\247\326\311\244\212@\320\013<\266\323\355\214"
+	.ascii	"r\233g\333\331v\0229\317TPa\364BP\021^\333\271v\267\246\022\252"
+	.ascii	"\276\\!u\370\360!+\211b[\322\371A\033\372g\022%\035\356[\324"
+	.ascii	"\nVd\367\256\214\b\336\336\314\263\263\310\t\266A\320\220\013"
+	.ascii	"ke"
+	.string	"aaTdEN\2611\017\367-\254\205&\316yv\232Mi\341\355\275\317\263sI\207\031 \3466J\245\244\202$\251\235P\316\346\351\344lr\246\235ON\264\333<\317N&\250\222$}~\025\344\257N\364W3\3755\211\376\312\245\277\n\321\177\2736\351W \372+\224\376\212C\227pm\322\257\237-p0p\376\332\202yv\335\346\351u\032\331:\217\334Q\355\315<\275N$\347\221\n\356\260\354h\236L\352\272$I\363\265\230\376\317#'\2270\fW\2160'\327i\344H\020\"\0358_W\351\353\036\372\372I_'\351\377\314\372\251u\274\f\001*\306\242mEzjj\220 \032Up\016n\t\346\251O;T\334\b\346\005\361\232x\200\301\241\267\364|\204!\300U\360J\360J\320\356\207\213\026R\216\266\241\272\007\355\324\212^ \211\201s0\313zd#\255(\3029\210\345w\327\007\031\335\355[\223\002F"
+	.string	"\037Q\036t\213\022\264r\2756\214\232\243\242\036nZ\232\005\263\355\b\356A+\017\312\205@\341j1vZ\274\274\341\374`\234NC\273\262\022\224\022\254\322\026\005\314\025\316\301)A*\267y\265\340\033Z\322\0276\234O"
+	.ascii	"\"\215B-U\325\322`[\230\240ZP-\2706\303G\024\367\207\257\330"
+	.ascii	"\301H\013BypM\304\216!!\234\203OP+0+mZ\260\374X1\204(\317\354"
+	.ascii	"A4\263`\032.\302<\367\246b\006\305\241\211\340W\264\243K\337"
+	.ascii	"\036\322\362\240\276\265X\243\322\344\3014\354\347e\f\353\354"
+	.ascii	"\301\346\277\306h)\373\021\004\347{@\323A&e\301$A\262\234b\355"
+	.ascii	"\302\273b5\366 \331\333\262\034\371\341\204sP\354[\270\370\220"
+	.ascii	"s\3039\030\3666\255G\305\311\020\316\301%o\023F\t\342\343O\007"
+	.ascii	"(\r\212\355'\bk\013\311\203]H\202_J\032\324P\301\300\f\361\005"
+	.ascii	"\275\036"
+	.string	"\374\302RhfhG\202L+\"\017\032!\022\344\272a\372\311C\001G\221S_\337\036J\362\0203WD\254*\310\345d\307\320\231\024\234\203[\030\255\357\206\022\234\203EV\244\025A\232.\250~\252`\326\006\0317;\250\r\307\026\222\236\025\273'\254\007\263\036\034\022\002\205\333\027\203C\b.-x\025\024\302\305+\252\271\005\257OH_\026\234\203VU\036\204\240\036\344\001\025\234:\347.\323\217(\260\210\260\313EW\225`\217\007\247\036\004\022\002\205\337i\r\231\003\3029\370\3433K)M\360p~\320GP\352wB\356\210\362p\016F]-fy\245\217Gp\307\332D\t\312\311jl\016\007\325\034\016\034\301\247\363/f\377l`\006\325\035\241\232Y\223\241\",\307\203O\017:\251OL\256?\234\203M\301\030\350\217\244\277\024L2a0\230\270\3009\270\0244\242\001&\027\006\347\240\322*\003\210H\n\f\347\203"
+	.ascii	"\214*\213\201s0)8\204\337\232\372R\340\374\265\213\332\364#\b"
+	.ascii	"\322\024#\243\240\215\274\3422q\210\220a\027cv3\216\036\264\361"
+	.ascii	"\3402\004\nW\223\022ed\207s\220F\260\306\372s\245\b\023\234\203"
+	.ascii	"2\2023\376\365r\335 K\201\363E\200\242\2031\202F:\374\326\232"
+	.ascii	"p\016\"\035\025\2231\022\344J3\270\"\270\"\370b)e\333\332B:\375"
+	.ascii	"\344\374\230\004\213\036|q\373\332npI\3019\350\"HD\003hh\016"
+	.ascii	"\237\346\312\256\311"
+	.string	"\021\234\203-n\337\226\346\226\020\316A\026\267\357.l*)8D\245\n\222\237\020-\310Y\335X0\350\301\240`\212t\bE\227,\037x\253Q\f\031;(\364`\212\007j\371+\362\025\030\030\374I\207j\320\221\245\204\347\2244\345Ep?\370\203\302\255\205\225\b\\_\376/+\340O\241\255\224\224\352\341\330B\352[\201\346\204\206\326\277\257\200jY\311X\233\026\234W\277U\313\322\325r\017\347\025\314\335\360\230[\013\035\"d\351$_\365\222\254|wh\357%\323O\036\002\216|l!\365I\221\263CZ\275|\345[\347\254\004A\341\274\356\255]\306\250D\341\322\005jH\224\251 \335\215\025|8\257b+\027\375\"\252\n\025\234\327\2615\017\311\327_\024\234\311\276\332\221\255x+\354\037\257\r\003\004>\266\220h\216\210\250\270\255[\276\342\251\275\375\201\341\241E\310T\3647E\313z\207\242\351p!\207\333\2400s"
+	.string	"\342\274\322\255u\301\257&\027$8\257X\326,3`\210\314"
+	.ascii	"\213\222[\257HI\231\005\342\274ZY\347f\224\230\200\214-\275\255"
+	.ascii	"q:\177s_8\257UV8\334\225f\345%\206\333J%\206\017I\236\030\316"
+	.ascii	"\253\224u\312\212\004\b\257\b\321\332\332F#7\244i\207\363\312"
+	.ascii	"\266Fq\241\343\214\b\316\027AH\253\255PT6!A*p^\237\254I\352\226"
+	.ascii	"\314\206pF[\235\\@(m?p^\233\254i7\214j\205\030\230&M\217\241"
+	.ascii	"8&\234\2772Y\317\3765\225\"\227b\343\374\020\362\364Z\266\232"
+	.ascii	"\361 \363\202\206\363C\300\242C\200\323\353\222\257a\377*\374"
+	.ascii	"\"\003\252\201\363C`\323\377\252\344_e\206\020\331\2008?\204"
+	.ascii	"&\372!\224\255^_\277V\257\020R\210\342\376\372\202j^S1\206\020"
+	.ascii	"9\221\225y\2756\214+u\304E\253\357j\265\311\320\202\344+S-\327"
+	.ascii	"X\303C\202\363\272\265\036A\343\352\361\263\036Y\271\326R\300"
+	.ascii	"p\312DT*M\035b\253\221\265\310\267\310\224uE%\341\374\275\333"
+	.ascii	"7\345).\b\347\2070\025\344\253\020\2545\353v\031J\362\260\246"
+	.ascii	"q\001i\033\3625\313m\375BC\362\nAI\257W\352\025+m^8\257U_\255"
+	.ascii	"\376\025\305\021\243N\b\316\017\301\206\376W\252\177\215\211"
+	.ascii	"r\233\302\005\347\207\020C?\204\" @R9\"t\371\345\305\006\316"
+	.ascii	"\017!\310\207"
+	.ascii	"\217\033\270\017+\305\225\026\036<V)\034h`\227/0\326\250\257"
+	.ascii	"RZ\366\322\340\312\006\260\006\005\225\312\335\r\314\240\270"
+	.ascii	"\242\230\251\271!(\234?\200\262\365i}J\345\222\210\352\326d\224"
+	.ascii	"\272\310}\301\371\003\330\221Cim\312.\366\016*\201\031D\267\367"
+	.ascii	"\322"
+	.string	"\303\005M\372\274\326\245\257M_\231V\b\343U\004\347\037\213I\331\343\302\371{\250X\226\237\2139\234?\200\032\372\003@\272\361\025\307\2155\350\206\351'/\304\036\r\2206,9\002a\3740\326\345\215\336F\322\244P\355\275\364\220\371\300\264\232k\214\257\313\2575t\240\233\0130\032k\225]Y\030\234\327\031\006\310\001\246\351\017\347\2572\242\340\200`\341\214\357\325\322\365hE\022\302\2755\3712\203\023\340\320j\244\252Uq\241\002\225\301\244E\f\234/\200\2735\305W\025)\326\242\033\246\037.\"\340 \212\373\323R\253\204~\204\326\026_\213\276\022\255r_\242\240\270XY\374_e\354XTa\255,\326\241=\243kH.\n\362\361\260jZW<\371r\355\367e\rz\t\314\240\270\256\024j\020\305\375\365\355\241\245\007\274\267\325BI\340\327\240\257@!P\270\032[\227\013\0348\177\335\353\317\277\006\257\240\300\262p\276"
+	.string	"\206\350\033@{\3218:\322a\214\276\034\331\3510\032P\t\352\305)\005\375\362\222\027\367\367\0162syI\352\300\374\353\t\343)E\023\347\013`J_"
+	.string	"6\270p\321|OB\026\201>\342\274\\\363\245OpH\264p\326{\367\r\325\241\007e\ng\335E\357E]\235\306\273a:\257\3509%i\355\275\364\020\204\241\202i\007\316\277\336r\2157\347\027\306\013\316Z\313\225\343\313\3433\202\263\276;\301fH\311\201\263\266[\273\250\330\330Z\242\352\362\343\007\347\013"
+	.string	"H\377\277\226\223\323Xn\230~\274\244nDH\254\372\366^zH\267\0205\357\350\256\261\2641\331\333\303Y_\371\231\326\302\342\004\210\263\236\373Y\027\024\032\034\316\332\312\317h\230t\321\371\b\300\023\375\353fS75\234\007\346\376\021\326%\2150\223\206\303\307Z\225L'\203\310\022z\347\307\304\207\263~\273\246\022\303\244\204\225\"\n\316S\226-\264\364\341\374"
+	.string	"(\321\307}\0300n\r\312S\024<1\275\246\321\264\223/6<\275v\002\235*TPa\264\266\370b\202\267\246\325\320\243\r\202\366V\312\241*\021m\t\351\323n\272MK\321l:\312m\3525\375\344\206\271\267\320\332\366Te/&?"
+	.string	"O\372\001\210\241\037"
+	.ascii	"\030:\r\02312\325\206\363A\b\243u\023\020\364\364A\260\302\204"
+	.ascii	"\t^\336,\340j\212j\033-GP\227\bu\331\201\363A\220\242\177]V\206"
+	.ascii	"\227\227\271a\244XyYK\255m\264\034A\370bn\007\341|\020\314\264"
+	.ascii	"N\242\223\350\261\273w\031\025\032\343\211\223\037b\327c\353"
+	.ascii	"\220#\252\241\260\377\253\312\265\244\210\223\016\323K\226rM"
+	.ascii	"+\260\235\251\324\262\244(I\235\230\350\272\320\341|\020\230"
+	.ascii	"G\216\350/(U\262\033T\221&\257\353\257(_JZ\272\272\366\260\232"
+	.ascii	"tif\021\027P\023\276\230\245\2734'$h^\214\023\242-]p>\bA\364"
+	.ascii	"\257\215h#\030.3\367Qz\2666\302\351\027e\207\023\234\017\302"
+	.ascii	"R\221\"\251\\\007\033hY\313>\241T\013\257\037\234\017\202\214"
+	.ascii	"!C\264\326\215\024\353G}\022\206)\205\316\272\326:\203\250-\340"
+	.ascii	"\2305@P!DH\325\237\225\225\376qU\225\265\324rr\345\007\006\316"
+	.ascii	"\377@\013\025U\032\246J\332\020#$8\377\203\246\376\365\224\236"
+	.ascii	":\2310\260\367\216\250\364\250\351\003%RR\372\007\216\246 *\224"
+	.ascii	"\350\371\270M\375\343\356\2510r\206\263\356q^a\033L\026xg\377"
+	.ascii	"\327\213\305\204\310\030\316\377@Kk\036\232\207\206\322;\265"
+	.ascii	"\201\226\344a\346j\211\r\0368\377\203'\035:4\324\272\227\332"
+	.ascii	"8br\305\303\t\352\322\255UWOD8\377\003\030\332I;\245rkU\\xpw"
+	.ascii	"J\270p\276\007\201Z'\351$\315\364\r\273GZ\343(\311\003:\226t"
+	.ascii	"\224\244\231\364RM\213\0272\364\222V\332\273\002\244-\307\271"
+	.ascii	"\224yB#F\027\316:\207\007\\n\3348o|\020\350A]\214"
+	.string	"\030z9\243)\365\342\325\325\242\306\3652\255\341\367\224\003\347\357i\032B\275\240\254(\0323\204p\301\362c\207\314\027\214/+\264\f\224).\212\2250\234\357\301\024}\244\217p\002=0\323\277\206q\233\032\306y\243\002\243\013\300\b\343\201\022\375\353\242\333\324E\347Rp\337\037\246*\"\017\214h-\244\205\264\213\273\367Q\225\254e_\026\270\"t-\256]\004\313\336\300\002q\326*4\213\263\033\314*\026z\310I\023\255 \03439\362\256\220\350\025\350\013\030T8\372p\326)\316 9\304\264fx\020D\377\375i \006\004a\303\2231\226B\377\\\003\251e\341\361x\302Y\357\323\312\023\264\0258\253\2011F^`\221\303\371{j\030\324\213\020\237\0175\214\n\330aF\035\226\n\210\357\320\261\245\262\0328\337\203'\r\006\f\f*\033J\204|\340|\017\210\274\250}^R9>\276T\216\210\320\313\224S\335\027}"
+	.string	"P\341\242v\341\242\247\247\332\351\237-8\276x\271\001\205\363\001\300\246\017\2002\255E\305\323\242\332m\331\242\332\351\037*y1\201\033\215\007\316\007@\021}"
+	.string	"4e\311\242\332-\031`\326\207\207>\t\252\221\244\356\252]\034\2229:"
+	.string	"\320\240\243S\347\356\354\250\264\304\240\341\005\347\003"
+	.string	"\206\025+\352\234\224\237\254\245\326\372\245n\213h\016\303e\311z\013\202\363\0010\024\027\227\3264S\246\002K\033\316\357"
+	.string	"\214\376\3257uM\255\202\361\356na\264\236\2458\303\353\200\213~\007t\372j\333U\245L9\332\335*\214.\030\263b\206\327\001\233~\007a\032\007`\006\310\226\322\017\234\331\326\324(PE\364;\220\202\002%m\273aK\233\270HA\301\371\035\344P\325T5\225\213"
+	.string	"h\330\254JT\f\234\337\001\21443\252!\2643&\035"
+	.string	"\231\251gf*\027\023&*W\036\001\330~\262\226}\177G\250\276p>\007_\3649\300\242\257\212]\225\214\354h\347\320N\201\266\200\252\037\016\252\350\243],\2647P"
+	.string	"\320\237$:\274p^\022\226\216\t\231\001\241r\323\347@M_\365\272*\230\332\245&I\307\356Va\264\272"
+	.string	"2\205\307\001\232>\007d\3727\035K\221\250]HT.&S\345\322?j?hbPFp>\007^\372\034X\0311\242r\341\275\367\246R\225\220\205\301\323d2\202\276T\256tL\216\314J\035TV\226ZDK\316\021\204GF\344j\221\234\366\304L\006\316\252\326\214\227=<\251\253\345\031h[Rf\\]\251XX\250\366R\313\203\214\221\f\253%!W\261\204P\222\300\360\302\371{y\357\377z^9\372\261\205\3639`\241V\251U\251\334\206\035T7\205j/\223<`*IvGa\202\004\271[M\353Z\230*M\272"
+	.string	"\001B\244)\rk\252\355\341\374\r\334\264\017\037\251\234\3367\253J\313C\220\214\n\306\013\234\277AS\363\340\241J\335l\035\t\311\300\320x\302\204\206w5\n\016\t\313\306\371\0330\365\325\247\253B\335\246\n\225\226M`\003\305("
+	.string	"\026\332\006W\3727-Ko\250K7T\247\246\253N\247V\022\225\025\234U&\025\207\212CUZ"
+	.ascii	"\326\017\252\275\\z\b\332%\261\363\303YU\222\2311\326\265\304"
+	.ascii	"Y"
+	.ascii	"M\302SW80\334\3775\235\002\343\017\f\316\337\240I\177\203!\025"
+	.ascii	"\206JC\205\241.\325\032W\22742\224\354\270T\243\033\2513\276"
+	.ascii	"\001h\357\240\275\225\224\322\264\256\035y"
+	.string	"^\210p\376\325\243\2533T\031zI\327\007\205\263\032#]\336\210\342\303\371\032\370\251H>\354\302\220\330p\276\006u\372\0328Q]\250E\252\213TN%R\211R9$4jP_4p\276\006b\372\032d\351_e\301\002K\271\361\332H3\340\330B\322\332{m\204 \233\215\030ap\276\0067\364\325\024W]\241\256\300Rp\366\326\241\224f5ip\244\177\261\224T\005R\205T\240TN\rR\203R\2714k\351A\246\250\214L\016\347k \244\237\001\236_\032\350\247nu\247\177\351_\032\346n#/i\216*tI\326\221\023\300\333L\303l5a\326\300\371{\347\325\377\025}\362bw\206\3633`\323\317`\313K\372\305K\332\227\356}\231L\001'\001BI\242%\362\220pD\362\360 s28\026\211\311\325\304\221m\331\021)\233\364\351\311=<9\311\266X<\026\217\"zt|T\266%\262\311\234\223"
+	.ascii	"\221,\241$\312\300\032}tX\0229J69s\022 H\310\021\301&}Z\"\273"
+	.string	"\263\241\207e\215\253\211\0346\003=:>\352IX\320\016u\212+\313Sl[v\304\260D\016\322\230#s,\"E\020s\022 h(\032u\216I\237\226M\"\217\272-\242`\363\206d\233\2034\016\221\307d\222\035\0167\354\244'\001b\304\261\230l\225\027\264\254\222\207\345\331Q[\"O\022\271\223\356\264\307b\262'\325!\262\311\035T\347X<\301&S\243\221mw\320\022,\253\334Ay\210l\262U\362\260<\303#\333\203\234\341ayv4[,\201D\346\b\217l\017Rg'=!\005\365\204\024VV\347\203f\215\305\235\036\236Ve\225Hc\316N\312\036\213\306c\021y\3249H\243\221\310\223\036\331\036\344\016Z\"\007i\254!\331\332\350\034\331\030zt|T\232\035\"k\314\255\362\210\314A\333c1iD\333\342\261\270\226\310)\312`A\353\203dy\2122\264\254\322Fx\022 t\2105\350\320P4\222"
+	.string	"\002\003\345P\207X\203\216\214\262\365\351\031\036\213\255\261\350C\303p8\243l}zr\211\034\244\261H<\301\241U\022st\210\310$\r\027\234\004\b\f\214F\237\343\021yTO \223$Z\344Q\365\031Z\320\2621\264l\f><E\022Z\022#\212\306\235\233\226\350\203\001V\307\247-\266\255\003Z6\006\037\236b\005\355I\200\320 U\016iF\020\333\223\035\316\260A9\202h\214"
+	.string	";\202\250\364\t\262I\342\t\235$q\0022%r\210\255\222\035\252,\t\2121\fK\344\020\333\030\206\307\242\005\2064:\307\342\003b\330\244O\233$\372l(\221\2034\262\300&\221,\304@\323\026\217\"\202-+\201\034\035\242\f\317\t\030V\244\211$\033\203\322ht@\022\031\001\345\361\004R\247\365!\021\003\317\211\036\016xN\300\260\026\223\032\3409\321#\243,Z\300&\035\300s\242\247\206\347D\017M\313J\200\347DO\2142m\213G\0211\020P\362\234\350\331\240LY\243Nqm\213G\02114\370(\207F\242\t\226\247\330\n/\250\300\310\0269\320\203D\272\220D\266D\243\017OQ\331\001\215Q\352\034\2219\254\005j \032Y\235\233\036\2265\006\323TFU\001\204r\235A"
+	.string	"\b\231\022p@\260<\305\266U\022\215\033\330\226\330\306 \2249\001\205\242\321X\344\241)*\325VI4\346\024@\264J\2421m}\220\347\001@\264>HT\237\220\202\022\231\314)\362\320\030\211lrxB\nJ\344\221x\214\211"
+	.string	"\333\022s\212:\307\"\215\260M\022\333\030\202m\361(\"\231du\210Hc\213D>"
+	.string	")\003\006-\253d3\300\303\266\312\032\224B\235#\253\244au\220\026\340\240\223Dj\200\207\230\034\201L\302p\243\364i\211m\f4#\2100\260Jb\022\002\027\224\310A\272\020t\201\303I\200@\026uZ\245M2\311\352\264\312T'\002:\246D\016\322x\234a8\201\030\034\340B\004j.\230!\211l\221\026`[\326\330\303\203d\201\347D\017\007\302\022@\264Ib\017\210\026D\300p,\022-\240\234\241-\362\024]\250@X\002\b\345\f2\312\031\214D\2376Y4!3\203\003\"Y\334\331 \023\002\204\f\255\222h\244QM"
+	.ascii	"\241\303\256-\n\366\002\302\021\307\342\361\350\223\201\0232"
+	.ascii	"#\216E\235#\013C[\002\206\n``}X\037\f\324H@x\022 \330\022\304"
+	.ascii	"\235!2Y\303\210\234\034\342\007\007\260%\210;Ae\022\251<\262"
+	.ascii	"1\264l\f<:;2.\030\333\242\262\202vxB\n'\001\002E\222\204\021"
+	.ascii	"=5Id\233C\334\031\"[\037\342\r\212d\260\207\310\223\223D\223"
+	.ascii	"\254N\321\0042\331\243\303\242H\262\306\036\237\026v\214D\022"
+	.ascii	"AV\247\230L\262&\220\303c\321\203\341\b\037c\317\r\207\226U\262"
+	.ascii	"Id\353C\034\352\034\2134"
+	.string	"\f[\242r\310\343\223lK\260=J\rbX#1'\330&Y\023\307bNR\247\310\203\036\213<\272D\016K\"\007\005\221G\323(\215D\023FdO\222m\217\"r\222\030(Y69\202m\2015\2168:\200\207\310\202\211\236\235\nt\214H\022J6IB\006\266%\232(\2669\016`u\220\026H\026\2117\307b\016\253\364\031\242 \362\fQ$\205C\024>\304!\n\"\017\2152\211L&\331!\313CL\356\fs\222J\233\264\250T&\205lO\r-\207\016;;\310\326'\247\003e\021\005q8\302\207\006V\247\365\3519\0261`{jh\207\254\211bK4QL\262:\303\021\307\"\211\026\211\344Q\016s\222\033\264'\001b\203$\333\312\034\2130\030\211\305$\253\344\200B\006\024\031\b\352\034\2219\025\324\344\2649\355*CN1\311\036\331\021\372'\244`\200\024T@\241^\205\004\224\220\200\022\322\253\220"
+	.string	"\034\234\004\244\200\243\237\002\316\331\016\223mKl\327$[\"\211\324@\217\216\317\312\016uD\224P\022e\330\311\t\266J\243\017\fI\266=\262,\264CU9\202(\003\262\230*\207#\212;G$\013&\330\026\330\226\230\201\030#2\007\331\"\2230l8\"\213\312$k\342(\202\347\004\f\034xN\300\240\303\346\034kP\036g`\225>3\2552\351\363"
+	.ascii	"V\351#SC\262eyX#+C\213$\241l\201U\372p(q,\272\300\266\304V\271"
+	.ascii	"\266%`\340\321\331a[\242N\217O\220\035\262:H\013\260I\037c\221"
+	.ascii	"\270#Cl\211-\360 \223=,\033D\"]8\026\211<1H\023IV\031\323\226"
+	.ascii	"\200\201\347DO\332\016K\034\213.\364\350\370\254'\001\242\304"
+	.ascii	"\261h\354\321\361\371 \311\232H\2621(\213Zg\007\027\225\370X"
+	.ascii	"\034&ut\210%r\220Ja;$*\2055\030\213<\304\235\341\261\250\f\266"
+	.ascii	"\303\265M\"{N\002\304\261HB\313\036\213-{\314`U\246I\035\035"
+	.ascii	"\"2\311\222`x,*\265\211\0346\231\333$\262''ut\210\271\304\261"
+	.ascii	"\350\002\317\211\036\265\235Q\016u\216\310\234\021\260\312\023"
+	.ascii	"\303a:\034\332\234\004\210$\233S\344A\266\304\023H\343p\210\222"
+	.ascii	"\030Q$1\034\246!L8!\005\326\307H41\034\256m\222\330*\203\312"
+	.ascii	"\0356\251G\024\223\310!\316\210\341pF\271\303"
+	.ascii	"&O\f\207\252\322H<\216(*\207#\206C\241\316\021\311\302[\232\343"
+	.ascii	"\210\242\2218\034\252'\001\"\204r\210\202m}x8\f\323\366\350\203"
+	.ascii	"\314\031\016\325${<\201\034\016Ue\222U\372\034\207C\255s,\226"
+	.ascii	"\030\016S\345\261\330\243\034\016\325#\262\250,\032\331\341p"
+	.ascii	"m\207\255\262h\334p\022 \f\240\303&\211$\224\006@@\213\202=\032"
+	.ascii	"\211\307$\333\036\213$\332\236\341\020\003\023l\262g8L\207\351"
+	.ascii	"0eIPT\016\207i\211\034\244\013=l\253,\221\2034\306\264C\025\332"
+	.ascii	"c\321Gm\207)\340\264\303d\333\323\036\213>+k\244\301\007\251"
+	.ascii	"\223\352\260l\217r\230D\266H\036a;L\001\247=\026\325v\330&\221"
+	.ascii	"0\274\300s\242\207\246\035\276 \"#\213\270\035\262\220dy\212"
+	.ascii	"\355\214OO\353\203\034\362\234\350!A\231dM\024\223:;l\013lO\r"
+	.ascii	"2\f- B\006!O\261=\333a\006X`\201\247\330\352dN\316id\217G\"\211"
+	.ascii	"\034\2255\022sb\b\276\300*\215>=\302\023H\343N\2225\361\002\233"
+	.ascii	"\223D\356\310\350\260F\032\210GV=\t\020\n\310a{t;dy\212\355p"
+	.ascii	"\250sX\345\320D\233\266\303\021G\244Q94\032\2119\312\032\224"
+	.ascii	"\303!\207\034Vy\034\232h\325v\030\302\204\366X\364\321\020pA"
+	.ascii	"D\004\362I\200hs|\222\255\222\004%\333SCK\202\262-\322@\202\317"
+	.ascii	"q\204\001P\370\034\213F\003\234\220\3020\005\025P\220\300\352"
+	.ascii	"\370\030s\216E\022\222J\037\022\016\020B\207U\372\034}\206:M"
+	.ascii	"\266=1:D69\223l{d\332b\362D\214\316\221\035\356\370\320\300*"
+	.ascii	"\2114\310\260J\"\r\303\036\237\0229D\032\206/\210\030\322\350"
+	.ascii	"\034\331!"
+	.string	"k\202\250\034\276 b\030\243L\262%\222D\236\241>\026\211$r\206)\362\310\032\213;C5\204r\004\321\2703T\333\241\252cD\016\205G\036\037#2g\230\364\311\031\nY#\r\304\326\304p&I$\221\223w|hh\223H\022\312\341\332\016_\0201\f\226\310A\032\207h;<!\205\235\035\344p\270\266\254rg\0079T_\0201\024\266&rX\035d\316P\277 b(Cl\211:CV\247xb\030\204\200\013\"\"0|A\304P\267\312\242Qf\307\207\206\241\222M\262lrg\030\323\016Y\022\024\225)\n:\304\236\3410eu\220<C\324\210D>`\210\"\2235\214X\225C\023l\01399D\335\262%r\210=C\036\235\235\340Ixpd\017\233$\241E\"\223$\b\213JdO\314qpX\360`\206\013H@\347\200pA\006\0211\220\320\262#\222\304\226\204c\221\310CBNRI\002\b"
+	.string	"\364\360\020[%\313Sl\327\032z\222\303$\321\3503\342H\034\372\360\024oHP\003\212$kdsr\210\303$\221=\026\215C\037\236\242\006-\321g\004\303#\262\330\022\333#[L\"\207><E\013HP\003\212a\rm1\007idM\304\374\217Y\n~=\025m\245\\\345\322\230\212[\312\021\234\232yC\022(\225\344\226\313\246\302\266\340\310k4ZP]Cn\004\237f\204\224\371i\331\310iLA@\256,\203/\204X\376\274\206j\004S\320\030\001#wG#\370s\213\266,\375\314\310KpV\227\016\0252\370\316\035J\310\2301\322\260\035I\306f \241\200p:\232X9\312t1@bS"
+	.string	"\215\234l\240\210\\\301\300qR\210\202^\250K\"8\342R\304\024e%1]0b\b\211!B\3572\023\323\322\225\030\027+^\f\033\035\020\221\230\026\331L(\224&T#\206E0ku\022\226\365\0273\264\002f)(Fw1+\262\225\224\310\256,E\214\212 YP+\t\nJL\nu\307\b\365\321\3201A\021\305\004\2356h\346b\004\216\305"
+	.ascii	"\235K\031\252\212\311V\314\217j\007f\367\005\2209\263\274\022"
+	.ascii	"&/0\310\245\263\350\221\005\205\321\303=\230vT\001\314ab\304"
+	.ascii	"\256\252\334\376\362\227\031\255\032ja~\3015\264m\006\340\021"
+	.ascii	"\230 \340\262LG\333\0274\354\274Q\007EH\037\312D\230\302\310"
+	.ascii	"-\005\237pF\256sr\346\347E\370\"\306\017\261&L\033\244>\232E"
+	.ascii	"\250p\376m\n\273\004\323d\202,Y\242\242'\234\222a\323\321\005"
+	.ascii	"\215\213p\206\235\223)B\274\013\3632\226\237"
+	.string	"!.[\3201\234bK`\021-A\0334eF\222~\334\315\241]C^\306\354\320\264\033MP-\352\204[4`SR6\262\240Yb\366\333\0168,\302\257'H\300\376\350V\251.e>\320\256\244rb6\242\236\346\326&\031f\322\223&V\3226}\344%\312\207\\\320\216\206/I\023\036qk\326\314\023\027\246:\270\265Hm\006\205\001\254\202\002\371\241\215\321\275\345\0271_\232\201?T\326\345\007\033\356o\3129\005\357\360\343\n\222\262\006m\225\250\005X\226[\232\266W\005\214Z[:\226\002\307\226<a\024\225k\211h\005\034[\320J\322\217\250&\234\205O\316\024\004\006\006\006\376\355\r$|\202\205kB(\027>9\215J\2475\004\224ff:\367D\207E\350Dc)b\246\003\ng\rG\344\311Y\023\215'\323\244j\311\nM\3635Yn\t\202\363)\025\303DfGc\ng\341\230pL\310\344\025"
+	.ascii	"\371\020\322(\312\212\322\267\2272<\374B\263\013\231\240*\354"
+	.ascii	"\272\300\341,,\273\232\366\023C\"\207\263\220\354jj\333\224\247"
+	.ascii	"\245\017u\372\027\212\345#Y_\250,\303r\221\024"
+	.string	"\224y\305\t\227\254L>8\265$\241\222\264\357i\212\353L\230$-\333\261t\003g\256\013\221p\t\277\252|\340*\332\321e}\262\007\005\204y\341\327\205^!P\300R\022h\312\201\243\353\210\034\325\205B\250\204[\347\335\n\233(\370\205(\260\210\226:\205\211\222\326\220\013\267.,\242\212aia\207\263\220\310\257\224\236\222!\234/\324\022f\t\261P1\251$iK\341\225\360\210\232\2128\234\205Vw\307\2137\270\252\177\215\311\373A\243\007\316\377@E\377\303\232\360\351B(\341\223p\352\206\351\207K\by'\030\2305\037\027N]\b\244\003\\^\224\037=N\350sZJ\035\315h\301\303oI\013*Q<n`\224\036m;\320*1Vw\314\273\035:\224\bk\\hCXC\330\264\025eGY\240\322\205M\0272\205@\341jP~^\214\341|\341\2220\207\016\223\304\366\207C\230\264\245Du'L\022\342"
+	.ascii	"\252\302E\004\205\302T\221\344p\261\2057\204\313\017WB#\241\221"
+	.ascii	"p\006\217<.Z\332(EZ\231P\306\2053Nh\231j\303Y\030c=\322\344H"
+	.ascii	"\021!\234\205H\250X\332\"\211\016\tg\341\321\325\320z\330]\272"
+	.ascii	"\230\026HiJ8\377\203\217\300\013w\240\360\005\026Q\334_\037\r"
+	.ascii	"\022$PT\204-.|qa\221\f\215\245\251.\234/$\242q\002\222\021\005"
+	.ascii	"g\241\013\003\234Q@R?\204+\204,\374\360\220\310\204\f\001\"E"
+	.ascii	"8\204Z-\371\362#\t\316B \241\n@=\026r1K\262\370\315\341\374\013"
+	.ascii	"S\b\205\226,\001\352uHm\374hb\"\fB\263\222\224\301\341,\374A"
+	.ascii	"\301\376\257\030\374\b\263\204Hn\356I\350C\022\0300A\300\033"
+	.ascii	"\246\037/\302)EA\272\250cx]O\177\017\002\246I\252n8\3019\350"
+	.ascii	"\207\376\270D\356\260\370\250\333\333\013\366\3350\375\354\245"
+	.ascii	"HESF\372\220\200\201\343\n\362=\330\227\344\355H"
+	.string	"\320\013\001\270\264h\t\352%U\240W\324\303\355\004MCQ\270<\030\212\232\250\204\343\316\024\207J\254\242X\222\311A\024sP)U\265\215"
+	.string	"\343\025"
+	.string	"@H@ \022\251\312\262\325\003\024\200\022i\310\212^\036\221\305,L*\306\f"
+	.string	""
+	.string	"\200\004\020$`\240"
+	.string	"\376\b\3302\007\217\300\345&2\354V\361\023%\345\264_\327\001\"\276&\033\3719e7\350\232`\016\360\214\260\037]@\375\341e\343\207\373\030\013\t+%B\007\251\343\241Cne\370\221\331\317\223\322\f\345YG\306\203\254\fC\324u@,\334\336\223\205\f\304\001]\247\260\333\311)&\300\363\363\340\254\347(1\003\350\312nS'YR\234F%\307\325\333\030\246\215\361\231\321)\275\363\237\337\003\375\326\031gP"
+	.ascii	"\322\322\254)\002r\202\361,T'\352\3725\013\257\007K\260\361O"
+	.ascii	"\247%\\`\024y\334\317\f\341x\362\245\316U\013Ru\037P\221\264"
+	.ascii	"\374]\3525'\030(\354\345\324Wi\325\263<X\221\276\371\033\262"
+	.ascii	"\2405\n\032\250\314\021\326L\206\027\201\026\304\020N*\001sH"
+	.ascii	"a{`O\303\277o\2004J\200\230'}Tobsk\266\327\243\211\220\nL\312"
+	.ascii	"\340\344\374\303\335\362\220\205\222\363;0F\004\373\332\233\004"
+	.ascii	"\350G\230\336\373{\321\222G\254M\236\256g\344\252\004\005\332"
+	.ascii	"\330\002F\"\243\005I\301>?F'\322h<s]\224!\263\026\366x\230%\330"
+	.ascii	"\033\206\001\335\307\342\275\360-B@{\f\222\320\343\224\376\206"
+	.ascii	"\025&`\237\205\324y\313\220\342\233\274c\275\035\007w\244\215"
+	.ascii	"\300\3656\027\341\016Gm\177-\304\376\312\340\002\364\201\337"
+	.ascii	"\347\024b\211\302\304\034\256\215\342J\267\203g\314\006\225"
+	.string	"\300\204\204\244\177\352\\N6\b\201\334\265\323kV\336\225\271\337\3300\343\032k1\323\341\207N\271\004\254\373\236\270\231lB\204\016\275\354\316s\306\002\327\303\004V\002\223\250.\016\001sN\333\356\032q\247\237l\b\203\372\360\242\253b\367\321\354[\326\376\273\243S+?\b\323\307\244\311j\374\257\264c}Z\235\201+\340\005\024\n\353l\031%\216\205Hy\361\331\232\223\016\374'\200\273\266\347\252\2459\n\301f\314\200\206R\256\365\372\213\236\216\264e\361\254NWV{\252\334\234*}g\253\nv\360\256\313p\204\022\006\356\206\022r5\022\022\220\211\3012\001tq\330<,\302\326\331\220s\020H\2520\314|\370}*\240\307\332\325\035\275x\343'-\212\271\252!Z\357{m\013\270=O\020\372\261\032VD\376\353\206.\354\0171\t\005b\363p\247!\031\204\327\347\357<1\326\224\322hU\223\371\313K\223\322\022gy"
+	.string	"\017e\004\375\1777I\006\304i\n\031\347\350\330{\253\017\203A\f^\206\264F\226U\263\331\315\215\316\373fa\333\363\352\366\020\312z\276Oq\277V\276\267\333t\252\373\240\213\223\340R\215\013\235\333W\324@+i\276 <\236V\303\235\266\336\314\344\2738i\177\33523BH\256\203Ot\250\227\201\254X\205|\275\235Q'%\360\323\025\362b\351\241\226\206\233\354\306\303?\260\267\362\032\310\304\330R\300\260\333\275c\277\b<\341R\233\360*\256\206\312\252\300\312\030\032\215\005\001\352@>Yw\303`\0268%\362\327/\003\324\263\321\031\334"
+	.string	"\247\006>\232 \317\336\325\216\371:"
+	.string	"\220\035T\374l\303\326h\021%\347p\375\254\273\374\351\362f\260\363\036\006\332\275\332Q#"
+	.string	"I-?\227\034\033\246\030F!\315\256\200\325\375\017\303\030e\025\266A\215r\\\002\271\267>\3370\220"
+	.ascii	"\005\253\240\342\243hG\352\240\r&nYv\2277\201\004qz*\020\177"
+	.ascii	"Ql\235u\204v\250\206\374\315\005f\316\272\350I\321Y\241\273\232"
+	.ascii	"\227J&z\205\262\3403d\344\225\033\275y\023\304ZK\335E\255H=1"
+	.ascii	"\332\214\371\005- \234\3321\272\367\r\013\330\372^\236\200\213"
+	.ascii	"\306\356\215#\224C5\340\333C\232\260K\203,u!\344\001\200\"c\370"
+	.ascii	"\220H\361\335P\005\340\027\0336\230o\365\024\337Q1\277\034\272"
+	.ascii	"\371\350\310a\023\0372\306\375Dg8\354\004\325\373\313\306!\005"
+	.ascii	"\314\251\3003\305o\250\320\234Ff*\2141\242\004<\270m\250k\357"
+	.ascii	"\024\262\363(0\022\356\333\330%\033\352\314\374]v\2603CC\355"
+	.ascii	"W\264\032\275[\016\304\"\264\3113sw\233%\310\354<\317\016\363"
+	.ascii	"\244E\305dY4\302\375\016\361-\306J\315\337\306\304\372?\322\017"
+	.ascii	"k\036\016Aa\335V\311\234D00\355\004\b3Q\017\031kU\241\231\350"
+	.ascii	"\007O_\r\231\035uz\177\021\212w\361dE\345\362c\304\302\266\244"
+	.ascii	"\037\t\330;\270\002\003\244\306\356\340\277Q\373\227?\376\322"
+	.ascii	"\313{\335\3475\211\026aU.\367T9\220PD\204\270HIp,g \233\236\200"
+	.ascii	"\340G\372\311lF\364Y9\310q\365A\200'\326\376\334\221Xi\200\342"
+	.ascii	"z\313\204H\023\252\212y\330\017\207\333\306\006/\322A\273\316"
+	.ascii	"\202\205?\360y\220&d(\027\350~U\016_\315\f3W)\024\326\001YB\362"
+	.ascii	"\372\0160W\002\016\n\260X\323\255n\246\371vJ,\244\233>\210e\315"
+	.ascii	"@\273o^\333\252.\314\211\3721\255\203\310Z/\367\234\177(z\b\365"
+	.ascii	"<J\367\361.\240,\267R\030\307\005\r\305O;\256\310\"\240\363\353"
+	.ascii	"\344\0315\247\352\037/\217\250>\337m\036\361\202\271\332\355"
+	.ascii	"\252\314Wt>\220\252<\263x\261\257\300\254\373\352$/\033\312>"
+	.ascii	"\201\362@XM\274\026)6G\275\001\222\253\327:\212\366\223\314\036"
+	.ascii	"\246o\341+\035\243Hu\303#\325\323\365\250\325y~\035\016\351\177"
+	.ascii	"1V\365\311q\201\020k\343\276\325Y0\224\323\342"
+	.string	"\2519\244\232n\246\376E\026\024\037\250\363\260d|\316%\236\374i||\221.\\\357\310\2223\305\207G\255)u\237\f\252h\3335\230{K\211\354\215\205\236\001\303\304\252k\030\235Ll\207\272\240\242\373\213\244,\310\023\365r\212R\030!R\300\036\261h\rGl\342\250f<=\351\257\262\365j\b\351\013Q\223\026\231\317/%5\342\030-\023\316;\334\033\177\312\317\375\211}\225\237y\200\224\306\325\235\031\323\201W\206\221P:\220\350\235\372\211\r\016//\326P \253\nT\253\266N!\037\271\363\355\021\342\036^,K\321\320\370\355 \212\224\177Ks\271\331\004\207M\360\3017\355\324ZPn!\205wMs%\206\002c/\323\364\236\234\005\263$\207B\321\025\027\212\346\337\344\211\210\214I5-\224[\301M\235\266KS[\202X\220\035de\020H\023]y2\366\034y\313\177\321\375'=\265]\243vl\343.\375"
+	.string	"\331\246\264\017\025/\tbh\246\263#\365\004\262\372\3639\302\3013zod\313F9M\342\250S1\0214\272\240\243!U\352V\250\f\273\210\317\2379\\\036\205#\022O\370\347\315t\337\034\205r\212\364\003\fe>\337)\202N\234/\034\253\025\362\206c\361\206\371\034\0337\207U\017>H\314z1t3\360\3713]5k!\213\004\266\037>\272\013c\215\370$\022rY[\310\337\b\331\226\245\310\2605\035\002l\320\236\224\034\271a\342h\367\004`{\037\203\242e\256\273\333\256\324\244\302\354I\357qi\345?\330S\306W\340C\031 KkZ\227<\336\361\2427\252\256\362 r#"
+	.ascii	"\277}\006{\307\035}\003\306[\204<#\367i\242\022A\344,@\304\352"
+	.ascii	"\302W`\244\025\320\307h%\325&\026\331\251\345j\354I"
+	.string	"L\225_e\320\027X\253Sj\257\311\\\241\254\023\273\201[\365\302%\\C\214\334\310\217\302r\003\266\305\304\177\025L\2609\366\254\016h\0347T\340}\311\004\\b\203J\377\363L\364\303\030O4\203\266p7Y\377\204\207"
+	.string	"\356\367\240q\2701r\020\350v\363\254\021z\211\335\356X\344qG\177X\002\225H;\362\031\225E\030\342\016e\332G\321dS\241\306\234c\200s\2645NL\261\221\262\265Q;\251>\212F\327\275\273\220}\360\354\013\247#\304\"\201:P@\333D\272\3171\365\265I;\334\\\001\254\n2J\257\3122\204#\361\205j\324\313\002/G\2123\036\032\202\371aT\216\267\311\224\350\324;\256\017-\n\030Z\005\340\037:\034=\250\371v\214\334\253\352[\316\177\371?\264u\005\030\254\307\364>O!\277f\370\005s\006\332\003\260\216\257V"
+	.string	"jx\322\330_\302@\n\225\337\353\036\3301\237^%*\272\201.-?\337\343Fo\247\275(\024|\005\021M\224b\235\026\360\355\236\253\005\033b\033t\266w\030c\330\243L\nC[J\207c6\b\327\362R\026zW8)\217\215*\323\376\232n\210\035N\214\306$&}\245\326n$\366\256\rK~\216\204,4g)`\314\361\316CKH\350?gB 2\231n\262\200\375)p\236\230\301\221\232\353H\314#\213L\363\231N\323a^Pz\035\321s}\275\224:\300\001\205\276~\344"
+	.string	"\027\t\316_1\330$4*0\365U$\314\276\300\277\007#p\223]>\364\371i\370\f\355\252\344|O\031\336n\366\203\b\305\231O3\016nh\354\325bd:C\350\215 \360\353>,\357i\326\351\fV\247\n\305\2524a\215y\017c\253\212\\\\\020\312\201\257\270u\242\266\r\375\252MA']"
+	.string	"Z-\225K\007k@-\320c$bBR%\362\025\244\220ri\361\333\025'\024\310\030\316\364*9\032)\22003\337\302\2728j\303\356\203\235\256/\t\021_\335"
+	.ascii	"\265\030\312\363\365\362^\003\216\002\007\3615[\013\360\353q"
+	.ascii	"\3154\373;62_n\244\331\2141)\253\300\354\232>\265s`\265?A\001"
+	.ascii	"\324\tN\203\0072H\330A\241)\232\261\271\373&\377\256n\202\205"
+	.ascii	"\252\311\344I\304i\223\353\201\226'4\311\257\335p\234O\367(\302"
+	.ascii	"RU\311 \276We\302\3363\235R\236\243d\001\212$\356\224\336\317"
+	.ascii	"\224\211\017\301\023\267\331\034\363o\204{$;\324\224\325\227"
+	.ascii	"\025{\345 \325\251e\241\321\244M\032y\371\231vU\004\275X\355"
+	.ascii	"e\373?^\306o\374\310\002-5\022\025\344\022\217)\r3i2!I\320A0"
+	.ascii	"\347\340\250\240\335(\256W\276\272\31011s\353\276}\305\276?b"
+	.ascii	"7\025\317X'\232\204\212C\004\243\343\230\3772<nAF\356/\331\302"
+	.ascii	"\343\207\224\367\374\277U\245\344l\351\325\2636\271_U'\200\301"
+	.ascii	"\226\215\347\262]~\362\002\245.\324\244?\243\025\276`\373\241"
+	.ascii	"-s\016\203\027\256\344\312\3532iz\354\360\242\256\246-i\\\276"
+	.ascii	"*\256\367\320-\206\373\316'[\253\304\236\313\340'\036\207 \240"
+	.ascii	"Q\001\351uZq\027\200c\373W^Z>\204\023\337\256"
+	.string	"c\343.w\205\021\300\345m\262\364\3438\315\200\nD\300\210\t\244?\331\035\251\253#\335\271\020v\276*\304P\327\330|td\315\374\211\213!\324k\233G\252|\303\002\033P\031\030\214SE:f\205\370~i/\317\026+\\\246q\315\023/r\313\005\206\261\200\246.\235bA\274\202@\275\355^;;\020\340\237\032?8C \312\316+\3169\217\013\304_A\b\215\254U\021\275\305v\312/\215\244b\332\232\3645\245\024\353\nSpS\00580\004\3560\034\226\240\343\320@\225JM\331h\361\2611\365\375\362P}\r\306\340}\316\210\202\277\251\227)M\256J\207\324\262)\016D'\235\212\260\021\177\254\2278\246f\357\237T\242Vw\250R\035\240t}\305U\276\2438\235\343\262%\222\265\306\013M\340fcY\034\016v-K\211QOi\337)h)\236LB\034/Y\210\340\020\f\t\f\274\243\342Q\364\266q\324"
+	.string	"\212\376\227Qi\f\305\306A\004v\212\024\327\374\275e\221\3504\345W\021%d\002@\024\033\340\026'\241\364\312\037\237\3544\034\t\r4L\361E\006\3108*\342\t\224\026>\236\247}}\013O\3757\026\247\216\201\177\3613%\275b\371 K\336\031Qu\025FL\216t\034\270:3H\311'a_\260t1\t./30\244\217\203\375\260"
+	.string	"i9\f:\362`A\315\343\001*o\314\037Z\344\026\021bjT >\024\007\260\204%\004\331\006E<\353\305\325Lz,y/\020\260\177\303p4\373\353\346Je\214\337\342\245\356\221\300\344\274\373\021\333\212\365.\374V\367\217kc\037\263\371\203s@g\314\216W\027\221\374g\263j\224\374br\305\325\3231\327\213\375%\300>\"\326\346_\227\201\237\256\313\334\030\312\340\217\275\201&c\361\027\273b\342\313,\034\374X\276\340\017:\242\016\350\221}W\341\345\2417\036,\024{\341\001{\204\334\006\277\323\223\212E$J8\303-\004\264\225\005\301[\\0\267'\002X\301\334;\363\2704\311\256\017\0209\324\312\201\344r\230\363\370kq\006C\301\302?\371\327(\2140\003]i\221$\037\206\3170\027}\030\215\310\030\230r\303\253\305\223\224\243\216\205.\271\367\017\r\017\220]\247\210\366\225\263"
+	.ascii	"\336M\275\204\305\240\272\023\314\300 \214Z\f\201)\tq\002\375"
+	.ascii	"S\277\202o\211:8\311\271JK\206\0310p\3204\215\320\347\220QgD"
+	.ascii	"8\261K\034\211\004U\315\333\317C\246eh\251\210^\366\333\004\177"
+	.ascii	"1\276\275S\216\334\317Oo`\036\357\256%\220S\255\222\007}\027"
+	.ascii	"fwt\247=O_\352I\300\004\255\321zS~B\027\016 (\020\300'N\027\310"
+	.ascii	"^\220>\247\021 d18\277\242HS\324\311M\302\247\323\313;R]@\217"
+	.ascii	"\224%"
+	.string	"M\350\016qn\314\023!\003\204\362^\327t\200\306\376\330s\005\017\305\275\305s81\275\240\340a\326 \304\217\360\260\371q{\303\371\352\263\340\035\247;\254\374Q\333\3378\253\336\311Yp\032\347c\236\022Y\313E\210l\373\356\313k|\022\246/b3\234g6\271\232U\305^\276\315\334@\266\235;V\3165\036f?\264\265W\257\335M\311\013\273\303{\303~\257\226&\274\344Z\200\025\3019\210,\221\365\354&H\250$\"\222\217\n6Q5\304\353\303'\204/M8-\240\270(G\t\351\327\354\306\036\374\270\366z\243\257*|\356\275\036\357\f\340\311\232\0057\257xI\325g\354s\330\366\325\265\347\214xB$l\312t\025\333Q\344\007.\np\177M\231:\255\242eoh\301\372\f\360i\262\022\036\"p\b\313\201H\327\255\n\277Q\354\236\250\033HcSl\254\217\355\320P\360\305\350\253k\355\243r\371\201u\220"
+	.string	"\370_\240\361\034\277q\313\f\035\373m&\217\3645X\375\355\376\255\242~\347F\rL]\376\243\r\003-\3205\177\003\263v\037-\361%\230n\364\036BP\366"
+	.ascii	"&'\036'\330\361\203\\}\200\372]\200g.\246n\335\206a7\036\320"
+	.ascii	"\357\360B\3306i\360$\002\364*M\035\321\222\017G\340\327\304\254"
+	.ascii	"\250\361\256\276\027\207\332\263\334\204U\216\206\031x\263\364"
+	.ascii	"\270.6A\270n#]>\326|\030\223\331\272\245\372\005\211T\260'\361"
+	.ascii	"\323Y"
+	.ascii	"/\0057.4\266\215\373\204\332\215\035u!\003c\2419\331\376\005"
+	.ascii	"z\264\257\032\036\361\243\233M\231N\020M\345;\b\267<N\233\242"
+	.ascii	"Q\243~\340F\037\214\354{\336\037xT"
+	.string	"<\206I\303\306\217\300\025T\034\b%\344\350*\362j\030\342\017\216\265`O#*\305\324\304L\221m\023B\213Q\211\322\271?{}B\202\361~H%\325\033\330\204e\300\204\020\004Tgj\347b1g\366\231@\356\200~\320\254l}q\024\233\352\334\031!\202;\366V\\uZ\225o\345\264\026\347\031(\350\207\352d\230\342gF\211c\322\257\006\316Z5xqs\377\325\276\265/\003)\"\370n?\257W\236;H\344\2527-\005\372\244\203r\367\266\274\207\013\032_\364.\334\340\213 \001\324j\350I\177\227A\022\314\337\206\366V\351\227?Ey\323\211T\373\252\242\005\001%apB\346\371P\233S\345\364\237*\257\212\341j|\321h*G\232\224\340\237\205\r\020\024\233\366\363\006\303\271\365\207\230\t\215/8Ba\227\332\304\026yH\027\264a\263\321\240\256<P\203 \377\017\302\270\251\2111\354\220\334\003/\315\275"
+	.ascii	"\244\310\335\326\306\241\013\254?\b\307\256\300T;\2575\242/\321"
+	.ascii	"<j^^*4\206$\2031\032\365\341\330\223\251s\352\032\225\2548\241"
+	.ascii	" \212\036\204k\247\230\265u\204\200Z\016\003\205\"\b\367I\205"
+	.ascii	"M\236\360 +\306W:\205\275\351\353 +\223\f\222!r\372a\326\334"
+	.ascii	"\004\236\024p#\037\365x|\253\372D\211\025W\037'\211s\222\211"
+	.ascii	"\302\363'\177\033\237\360I\255\326\237X3\036\b\026\203\236\223"
+	.ascii	"\263\2505c1\017&\230}t\245\310&\211\341\304\376dN{\250|\367\323"
+	.ascii	"$\321\2246U\244\236\0218\253\317\303h\272\241\247[\037:q\362"
+	.ascii	"\215L\256\317p1c\372\304\362y`\003f\037\264\250A\221\354x\016"
+	.ascii	"\340\317\f\251\226\n\337c\304@a\340B\274\227\236\r6Ma\270\233"
+	.ascii	"\233\304\266v(\032G\356?g\020\342\017wb\"<\276\341\215\203\031"
+	.ascii	"\201\234g\311\343\305\311j\241p\305\361{\310"
+	.string	"\377\305@\027*+\212\n\026\364\217i\207\244\203\0054\231}RROa\374\203\221\251\037B:TY\211\b\200\320\323\035\321\270f\244\332\245\342\2729\364\267@\rgZ\234\355\341\3723\001\032`\344e\254\221\366Z*A\341\301'\377\307O\201`v\246\260'\225\235\301%\0068\255\222\036^-\337+\310\253\bLI,p\301\211\343\363\f\226\227[\350\323yfFF\347\241\336\267v\350D\263\001\342b\222q\352i\034\235|j\237\241/\233\3161<\217\333\334\277\343w\372\326\355G/\276<\367\363\243\177\267\005k\335\270\220N\376\016`\007\302\277\263'\216y+/9\307\336\2373\345\346\263/\257yy^\365&Yx\360\343S*\315\324\345Z\220p\034\364\353\177\262:M\204\001P\270\313\351K\244\335\205K\237z\277\304k\224\362\236\220\366K\272\247\316\022\326\013\377\223\373|4\303\270\217\340\b\361\217\222\351\332x\277"
+	.ascii	"Q`\336\213]\366\266\353\261\225y\331{\274\267\0040\317:\334o"
+	.ascii	"\242}d\337\007\310=[\311\377\nP8\203\017|\375k\327'\020m2\366"
+	.ascii	"\343\032\330\202/tA&\311\001\013\327\021\335\330\263}~\360\277"
+	.ascii	"*\327\305:\233\312\205\243i5\335\375\017a\333l\256\215\307\t"
+	.ascii	"9\336\020S\276"
+	.string	"\325\017\231\340\363!\370\365`\264\324\341\323\302|h\372O\323\021_\337\204\276\225\367\f\301\036\343\350%\346wP\237'\2764\030\376\3400\367\341\006}\252\243z\032\326\276\204\337\213\364\262y0\376\345\306\032q\364\272\"\337\360m?\371\n\202E\376\237\326rZ\230\276\323\231\231g\255H\2751\207\036;\036l\370)\363gc\326u\341s\370w\204\263\317\314_\337\356\326\341\357\220\374\223\240[\341\374K\372.\361\371)b\337\330{6\312\217F}\204z\373f6\314Z\030c\307\177\267$\025\275.>\274\314\373\355J?/e\333X\353\032\372\350\020oG^t\301\310\243\371o\025\ro\207\341\017\264\333\252suRNV\231I\256\261\360s?\203_\365\207\020\337\223un\310\377\034\316c\320\301\235\266\370\033\217]d\336\301\314b\202\216d!\022#?\024\364$@/\252\345W\215G\220\237\354\204N\207\254\274~\235\347"
+	.string	"G|~\267\374\216\207\263\331\327\023\324\3768|\374G\021\370\370F(;\217\261\372\362\b\373\265\241\375 *\337\2019\237\332\361\265\0279J\306\352\320~\277\343\267\260]\b\307\337e\237\3268\273\301\320\003\347@\377\256\340\343\226\303\266\266\007\\@\277i@\276\272\347\214\362\214Eh\346S\335\232CW?\201\b\034\250\300\0278\273"
+	.ascii	"\222[p\003R\273_5\037\325\372\023\320\352v\344\353\301\006\031"
+	.ascii	"<\320\352\377\237\343B\036\357@\254)\361ek\225\277I\232\373\307"
+	.ascii	"\360\247\200\315\027\177\033\263S\325=7\017F\272\313\345\255"
+	.ascii	"Qqfu\362\3641M\364\002\346\226\300\321\235\310\277\203\245\374"
+	.ascii	"\220_\300p\001\310\357m>\340r\020\365)\307f4\317\367r\374\345"
+	.ascii	"k\335~\217\372\215\226\217\243sBN\201\363\352\250\323\223\236"
+	.ascii	"\020\235!y`\201a\024n\2016Q\327\312\213\226\263a\316\336\004"
+	.ascii	"\320\225E'#;wO\030\335\242\363\004\267\201\307.%\375H\216w9\177"
+	.ascii	"E\365\005U\035\032\225`:\254\rz~\365|\306\37286\316\350h\252"
+	.ascii	"\363\245\247_$\271\276\360\375\300o\246e\316\2122f\351\216u_"
+	.ascii	"\270}\335)\361\037"
+	.text
+	.section	.gnu.lto_.symtab.3abad1c855f6281b,"e",@progbits
+	.string	"eepromData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"lockMainPID"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"sendMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\003"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\003"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"nanos64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\003"
+	.string	""
+	.string	"micros64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\003"
+	.string	""
+	.string	"updateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\003"
+	.string	""
+	.string	"millis64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\003"
+	.string	""
+	.string	"micros64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\003"
+	.string	""
+	.string	"millis64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\003"
+	.string	""
+	.string	"microsleep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\003"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\003"
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\003"
+	.string	""
+	.string	"delay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\003"
+	.string	""
+	.string	"simulatorLoopYield"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\003"
+	.string	""
+	.string	"timeval_sub"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\004"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\004"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \004"
+	.string	""
+	.string	"pwmEnableMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\004"
+	.string	""
+	.string	"pwmAreMotorsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\004"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\004"
+	.string	""
+	.string	"pwmWriteMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\004"
+	.string	""
+	.string	"pwmShutdownPulsesForAllMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"pwmCompleteMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"adcGetChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\004"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\004"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\004"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\003"
+	.string	""
+	.string	"uartPinConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\004"
+	.string	""
+	.string	"spektrumBind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\004"
+	.string	""
+	.string	"_Min_Stack_Size"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\004"
+	.string	""
+	.string	"_estack"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\004"
+	.string	""
+	.string	"timerHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\004"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\003"
+	.string	""
+	.string	"fakeGyroDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\004"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\004"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\004"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\004"
+	.string	""
+	.string	"pthread_cond_broadcast"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\004"
+	.string	""
+	.string	"pthread_cond_wait"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\004"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\004"
+	.string	""
+	.string	"dyad_shutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\004"
+	.string	""
+	.string	"dyad_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\004"
+	.string	""
+	.string	"dyad_setUpdateTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\004"
+	.string	""
+	.string	"dyad_setTickInterval"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\004"
+	.string	""
+	.string	"dyad_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\004"
+	.string	""
+	.string	"lrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\004"
+	.string	""
+	.string	"udpSend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\004"
+	.string	""
+	.string	"pthread_mutex_trylock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\004"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\004"
+	.string	""
+	.string	"fseek"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\004"
+	.string	""
+	.string	"ftell"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\005"
+	.string	""
+	.string	"rewind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\005"
+	.string	""
+	.string	"fread"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\005"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\005"
+	.string	""
+	.string	"strerror"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\005"
+	.string	""
+	.string	"pthread_join"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\005"
+	.string	""
+	.string	"clock_gettime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\005"
+	.string	""
+	.string	"udpRecv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\005"
+	.string	""
+	.string	"nanosleep"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\005"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\005"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\005"
+	.string	""
+	.string	"pthread_create"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\005"
+	.string	""
+	.string	"udpInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\005"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\005"
+	.string	""
+	.string	"pthread_cond_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\005"
+	.string	""
+	.string	"getenv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\005"
+	.string	""
+	.string	"fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3abad1c855f6281b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
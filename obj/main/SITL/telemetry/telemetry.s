@@ -0,0 +1,642 @@
+	.file	"telemetry.c"
+	.section	.gnu.lto_.profile.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375 te\003"
+	.string	"\004\006h"
+	.string	"\r"
+	.string	"\236\352\207\307\t"
+	.string	"\001\342\270\360\367\001\002\002"
+	.string	"\002\001\003\274\205\242\255\006"
+	.string	"\004\376\262\204\322\007"
+	.string	"\006\275\267\374\234\005\002\002\002\002\003\007\b\354\301\314\336\005"
+	.string	"\t\346\273\301\227\n\002\002\004\002\005\n\240\342\234\212\n\013\352\263\360\321\b\f\371\262\376\364\003\r\333\361\237\332\006\016\240\342\234\212\n"
+	.string	"\003"
+	.ascii	"@\315G\315\3606\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375 E\375\001"
+	.string	"4\0039"
+	.string	"\b"
+	.string	""
+	.string	"\003"
+	.string	"\002\001"
+	.string	"\003\003"
+	.string	"\001\004\001\003"
+	.string	"\002"
+	.string	""
+	.string	"\006\001\001\002\006\002\002"
+	.string	"\002\001\020\002\006\003"
+	.string	"\002\007"
+	.string	"\001\b\001\001\t\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.ascii	"\005\025\243\316\2406\200\005"
+	.text
+	.section	.gnu.lto_.inline.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"\245\006"
+	.string	"\"\313\"(\220'I\007\177\251\027\276\226\350S\b\276?\360\337u\324n\206\234\307\265&\251\252\252\256\263\255\235+r\264\t\261d\313\235\0023\305\2761\227"
+	.string	"\250\036a2*\270\344\245nr\227Z\342\357T\033)\030\203\3150%\215]\366mJ\302\032|\016\231\017rB\001}\264\364\221\260\240\300\361u\350W\2559I\325\271\212\210\307B`\264\232\231y?\351\233>\216\306\003A\033\034\r\210\001\373\221\373\256\346Af\"|\337\232cdfz\334\026\001\034"
+	.ascii	"\226\013\261+\330\r\027s\224\024\374F4\302\264\256\333\214\225"
+	.ascii	"u\f\026\333\003\2356\301\275\311\027vK\266L2\313R%\304\322\370"
+	.ascii	"\211]\001aT\312\340\263\304j\246\020rp\376\251+:\3436-ys\260"
+	.ascii	"\002\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375 Y\345\001"
+	.string	"BD\f\024\300%\035\246\377\277\275\370\033\377?\270Lk\215\220E\266L)\nC\365@0}\243\305\232\365\344\342\3152T?\264t}\244\363H{&\310\246\032\207\002"
+	.ascii	"\b\312\224\r\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\230\004\001\204\004\003\200\004\004\230\004\006\205\004\007"
+	.ascii	"\200\004\b\200\004\t\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375 kM\002"
+	.string	"\344\002_"
+	.string	"\006"
+	.string	"\001\001\002\f"
+	.string	"\004\001\374\007"
+	.string	"\006\001\300\005\r"
+	.string	"\001\002\006"
+	.string	"\001\020\020\b\001\002\t\001\300\007\016"
+	.string	"\001\002\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"H\005\021\002\r\237\201u\206\371y\365\315\324+=,\353\002\215"
+	.ascii	"7\200\005"
+	.text
+	.section	.gnu.lto_.lto.aa974b4e3de09a17,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_telemetryConfig_Registry.33.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375 \234]\004"
+	.string	"\244\007a"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001\212\001\206\200\200\374\342\303\276\375\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\306\007us\350\334\006uq"
+	.string	"\005\001\006'\001,\237\340"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"!./src/main/telemetry.c"
+	.string	"\005"
+	.ascii	"\335\2620\245%\230\217\203(\361\006P\004"
+	.text
+	.section	.gnu.lto_pgResetTemplate_telemetryConfig.35.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375 x]\003"
+	.string	"\"F\027$\200K\322\0013\260\026\217\2379H\214\304[\034\306m\267\331m\232\315 \023\021\205V"
+	.string	"\003\324}\357\326H\222\001\205\322Q\307\020\316\024\326\030\316\303\231x\2438\027s\030w\032{\034\347\343\006\271E$\177\330\3052\350"
+	.string	"\374\236P\360\273\025*\374*)\255\257/\374\002\214-\300\257\330\026\021\004"
+	.ascii	"5S\200\346\274\254\201\0018"
+	.text
+	.section	.gnu.lto_telemetryInit.36.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375 \3075\005"
+	.string	"\"\211\",pU\323\001"
+	.string	"\355W\340\257_7\227/\346\n,U\205c\304A\202\354s\262|?\tl\257\252\216T\003\366\360\201\n\035\337\332\275S\n\236$\310\274d%\031\362\322\006\265\250t\232\017\225\016\266\034r\352eYS#/{\354\fY\324lO\203\261b?\260\261\263ab\277P\341\263;\t"
+	.string	"X\217\240\223\261\375\310\230\r\272w\331o0\022\316\267\273\032-\307\0161\377\232\0236.r8P\354\256\341\306Q\356x\333\b\333j\233\n\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.37.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375`\201\001E\020"
+	.string	"\266\036nG"
+	.string	"\261&\035\363\220\002G\343\314\251\3643l|\033\030L\032\273\251\255\220\345\362\337\330\316\033&\311\246\311\324\230\266\226\351\017\266\034\264\212;z\004\315\245\277\364;\t\232\337-\350\201<\351~\231r\247\310\232%{o\271S\nZ"
+	.string	"U"
+	.string	"]"
+	.ascii	"\266Mz\2602\353\241\f\3540?/\034\237ZCnG\234u:\345F\226\377\330"
+	.ascii	"%\215L\215\017l\235\212@\226O\020\313\245T`C\007\307\bT\221\036"
+	.ascii	"\260\231o\003S\342J\007*>.#P\203\004\360\363\222\361\330\343"
+	.ascii	"\n\350\212Q\213Pku\374\300\r\267v\333\025lK\260\017#\276\254"
+	.ascii	"\265Vo\214"
+	.string	"\275\321\233\350\241\315O\347\303{7\372\001\n\320|p\201\311\261<a\205\315tT\331\3341\361\360\267W~\314\233\037\262>Za\205\221^d5\013>\r\001\024\243\375\232\253X\335\346\304\241ZC\364\344\324\0322p\003\320\347\307=\350\247<\001\372\031\257\226\273\370\213\316'\341\021\323\364M\3643n\210\005N\212\026\2248\303A\321\241\304\024E\373\224\212\377vw[\t8\300\334\220g\321\257w\323\243E\0017\241\366\005\f\361\337w\324b&K\331\226yrl@\254\001X\216\233\031)\361\307\377\t\245\253-\351\205\347\265\343\2123;l\305\025\341\"\035\t\205\022\252\323FP&\257da\202\312K\225l\016\001\311\340\251\272SG\322\2518\224\251t\342B<\023\016\004\201S%\235\307\251R)\217\333\302zY7\306\217=tBgf\212\326R\356\212\254\210\021\265\235\273b{\356\350\363 CY\027\335V\264\217}"
+	.string	"\215\327\216\377"
+	.string	"\215\273\255c\036"
+	.ascii	"i\355\213\231\351S\257}\253\355\235B\373\252+\241L|/\302\252"
+	.ascii	"\302h@O\241\241\025\253\rV-\247\325j@\212j\300\311\004H\346u"
+	.ascii	"\\\206\241b\030\254 (a\310\303Y-\230&21\301\212q\252\031\232"
+	.ascii	"B\277\272\317\250\203\212\002"
+	.text
+	.section	.gnu.lto_telemetryCheckRxPortShared.38.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375`\021\001\235\f"
+	.string	"\206\230T@ o\233\0160D\326"
+	.string	"\216\257"
+	.string	"Lc\203b\257~&\3014\245\332\306\244\016E\255\247\022j\375M\2671"
+	.string	"\245\320 Ae\272-\300\rB\020C\023,\3009\f^C\246\205.X\265\266\367\2262\245A"
+	.string	">"
+	.string	"C"
+	.string	"\322\007\304C\333V\260`\343\354\235\207\221\203J@N\244\354v\224vxv\37043\337\262q\016\245\r\177\323\346I\r\260ex\005v\367\241\247\310\246eF\231\335u\206l\032\356x\333\020l7\260\357\021\177\273\273\326\217\255\351\350\334\037\235~N\253\246S\323\227\"\274H\201q"
+	.string	"ewd%\306\252\200)B\330\336\330\223\355L\373\"n\2629\367q\001\273\037\025\024\273\035\002'\220\016\335\235@<\f\252\034\377)\310\304s\342\036I>w\227\243\276\304H\037\272\264\242\204\013O\252\330\335/\361\032\251\023\244Ds\307I\\\220v=\f\374\021\227\207\004\342\320\377\210\207\327\017$-8\230p\235\\\261;-\025d\007\0242&lX\016\260\313\342\260X\203\301pa\225FU\241\302\250\215\f\t\032\224\346\352\2400\006lqT\027\205Y\326EM]\347o\365\343\324\237\374\241?`\301\235\240\244\237E?\021\333\252\316tT\203"
+	.string	"\322\266,\344C\236\006\031"
+	.string	"i\355\023\303t\241\261\266\324:\315\226\235BW\260\242\2525"
+	.ascii	"\016`1\030\004\227YE\002\242\310\210\033\306\204\0235V\333\302"
+	.ascii	"\013\233\360\33350\215L\234\257\356\253j\3105OoW)\003"
+	.text
+	.section	.gnu.lto_telemetryCheckState.40.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375 \307\025\005"
+	.string	"\"\211!)\200k:\300\234lj\324\\\363F\203:`d\257\026"
+	.string	"\377\267\245\335\260x\377\360\253##\212(c{\004\t\025\337\332\275S\n\236\244\307\274d%\025\362\322\005\225\250t\232\016\225\n\266\030r\352eYS\243n\0379\002$F\354.\203\261b\037\260\221\263ac\277\317\241\263;\t\201\226\023\330`l?2f{\336]\366\236F\342}\273\253\321r\354\020\363\237\371@\333\262C\001bw\r\265\215r\307\3336\330V\333T\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryProcess.41.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375 \374\235\006"
+	.string	"\242\f.2pm\032\003\240}C\255\210\332\207\356\335\226\267\251\324+Z\022zf\250I\201 \262D\354\326\224\034\212\376\335[\020\246\211|\262\334l;H\223[\312\224\002\220\322(\310\r\214\361a\222:e8QB\n2@\3716\232\005\352M\321\341e\006Z5\300\370dU\305']w\003\025\023\321$\332\253\303\232E\353\350\377\333@-\343h\204N\016H~\212\024\224\227\270\221\f\251\255Y\353\rsLw@\364\362W\204\210\374WA\r"
+	.string	"\3540\026\250\330E\016\250\330u\266&\2760n\020k\342#\364\377\265\013O\263Y\333\303\027\313\3231\263$\374/\263<\037\267\271-A[\204\266\237\t"
+	.ascii	"i\331'\323b\242f\340\302\t\230w\t\200XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_telemetryIsSensorEnabled.42.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375`d"
+	.string	"E\t"
+	.string	"\366RB:@\305(\035\320\271\027\357\33433i\306!p\fa\305\376\f\360\004\376\007\332'\325\3246\246\217\365\260\304*\313rt\031E\321i\001}\020\304\304\250\354?\260\336\267\273\233\224)\0051"
+	.string	"1"
+	.string	"/"
+	.string	"\227\023\304C\333^` \271t\257#\365\225\253;\031\260\353a\272z\351Y\362?r\030\200\365\241T\026O\214\303\356:Q\252\213[o\373\300v\307\366+\255\037jZ5\235\232>f \244\245A\300n\352{-\013T\001\261M\2625\2663\355\263.Bz\253\302\002\273\032()\273^\202\0252\207\233\027\304\303\247\374|M=\200.\303\332MB\231\335\355\370$/\341\374\217CO\214\362\250C\177\024\017\257\b\036-S~\266wJ\345\260\177\331\335\265n8>\233\306\2012.\332\303\241\330D\331'\213\310D\030\b\342\341\203y6\016\343\030X\223\3106L\244i\033\246\361Lw\324\215IO\366CQ5\352\273\025\250\251\252\030W\207\021\n"
+	.ascii	"i\331'\323\"\f\273\207\263b\2328TMwA\345\252\366\017\035\314"
+	.ascii	"\230\332I\006"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.part.0.47.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\245\013"
+	.string	"\246TLB0\211*\035(\304\243\030\301\361+\240d\364\242\315Ix\fU\\o\331\321\036\n3\203z\202\263!\224\261\253x\004\005Xe\324\242b,\326B\330k\001\245\017\243\020\256\021..IN\n\240\266\211\334)\0057"
+	.string	";"
+	.string	"8"
+	.string	"\232R\211mg4&\213/[\251\027\230 2\223Pk\331\235\256\201\213\337\271\211\376\246\025a$O\337\317>G\022\300\247\345\033\245\242\326\352J\200\233\336\366\306\266\205\375\214\257X\3510\322\274\250(\001\264\235\366\313/0\035F\332\312J\376\201\2126q\352M\345\364r\207\311\351\366\206\211\311\177\231;\365\023\210\227SYS\031U\315%qj\212\312\351\0218\023\250\005\361\356\262lS&\303G\023\333\343c~\374>0 k!{\232\313\362n[\335\225=/\273O-\021\020jMU\240P\tP\007\007.\373c\267\257\240\344\313>3\027\034!\017\310\351\300\b\301O\304mx\037\rN\310\243\270\203!\201\241\007\362>^\330\205<\034P\327\001G\035\006\302\237\310\003\273\360\373\300\216\373Vw\345\273\032\220\314\357\334\021\333s\027\306\001\265\032"
+	.ascii	"i\331\267c\3435j\007]\215\f\310\003#\\\207K\226\021Q6\226`\024"
+	.ascii	"L$f\001\034\tv\210\313s\021\013'\223U\207\226%\257rj\325F\234"
+	.ascii	"\013\326DA\235\366`6\036S\316\273\312\030"
+	.text
+	.section	.gnu.lto_telemetryCheckRxPortShared.part.0.55.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375`\251\003%\025"
+	.string	"6\344\206I\3000\2511|\"\332\357$\275n\300\270\205\f\361\364\361\203\306F\n\236S\\\345*\233k\324\030\031\215\016\247\352 mZ\345\377&WU\272CDEQ\024]\227\270va\bL\221\261PPa\276{b\031\331\332\226[\312\224\002r"
+	.string	"p"
+	.string	"n"
+	.string	"FI\261\t\3326J\312\215y?\215zn$\002Mx\335{\332nk\321y\257\321f\262\230i\313J?x>\325\021Rxm\301\321\f\245/!\237\240\323\202f\031d\227\021$\306\200f\005\213S\226(P\302\250\020\341\257\004\tq#\351\2654P\2041\f\021\372J\222\254!\256#_\222\024\324@i\200\177\304T\356\275~o\303\rr\3331l;\260k.=.\007;\365\201\006QXF\305\227\203SBy8\225\274\356\3574\261g,3\3404\362QP\225\203\307\233>\263/\224\302\213\030eE\224\262\"\322\026V\236\271\223\253\017\325\210{oM\346/\331\370H\327\232l~\326\020\2509\267g4\271u\245\366\217g\272\371Ys"
+	.ascii	"\367\022\201\251\270\367<pk\004\262[\237'1oe\0371o\354\332\355"
+	.ascii	"K\004"
+	.string	"\261R\300W\007\032<\027\314J3\354:\013 \320\225\2459C\035;@\022\030\312W\013C\034\365t\305\216\254b\255F\333.\346\253\275\032\332p\252\361\243`\266[^\345\"\273\367\227\300\247\272\213\027\037\351\326\270\030z\235[?\306\274}=\362\024i\310U\\:\366h\222V\243\353\307k2\231\fs%\262MMM\352\227\005\230D\212\367\366$\003\216pB\243\263\261\344FXZ \300\340\030\354t\270\034\315+'5\272\335\355\345&\341\266\263\301\264<x\261\255\350&\330NJ\214\313\335t\266\035\016\247\263\325^\211\034\323Bz\222\242\375<\363\3107\320:>I\315|\236I\353N\265J\257\372\\_\336{oM\004\352EO\361\304\255B\256\257\307\256%,Z\214\347\247h\352HD\323\314\344\375\fy\013\bKJf\303|[a \002E\2501d\304\fc\022\215\004\022L\230\260\260-\006\020\2431\312\003\022"
+	.string	"\024U\225R\330\375\377\377\f\020\037\323CW\b\234`\032\373\250]\306\276\235\025\345a@\266\"&/\200uPsxZr\b\352\334\b\305\337\f\226s\261\212\313G(\352)1\361J\255\025\225X\344>'S\214\236\031M\035\271\373"
+	.ascii	"\004V\023\242\037\266\031\335\037}U\017\225Sb\361`Y\240\271\022"
+	.ascii	"\n!w\325\340\226\023\032\347s\322\331\345\370\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375`}"
+	.string	"\255\006"
+	.string	"\004\ny\001"
+	.string	""
+	.string	""
+	.string	"\002/\177\017\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 7\177\020\375\377\377\377\003\005.\021$\177\022\272\200\202\002%\177\023\005-\024&\177\025(\177\026\002)\177\027\002*\177\030\005\036\031\201\204\005'\032#\033\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005!\034gistry"
+	.string	""
+	.string	"\005\037\035\001,\177\036\377\037"
+	.string	""
+	.string	"\200\200\200\001+\177\037\003"
+	.string	"\017$\003\004\020\240\276\320\347"
+	.string	"\001d\003\004"
+	.string	"\363\243\231\"\001\242\001\003\006\001\201\200\200\200\001\001\302\001"
+	.string	"\024"
+	.ascii	"F3\f\237\"\343g\372\261\004\303\345w\325\230\344\334\230\225"
+	.ascii	"\316k\254\267Cg\t\323\004\320\003\374\320\252\035;ip\305\022"
+	.ascii	"\257n\020u\r0\234f\247\023"
+	.text
+	.section	.gnu.lto_.refs.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\033"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\002\001"
+	.string	"\001\004"
+	.string	"\005\006"
+	.string	"\001\t"
+	.string	"\n\001"
+	.string	"\003\r\002\n\002\016\002\f"
+	.text
+	.section	.gnu.lto_.decls.aa974b4e3de09a17,"e",@progbits
+	.string	"(\265/\375`\324&\245\253"
+	.ascii	"\232\021\251<Z0JQI\035j\212\271\213\320X\342D\261E\310\310\001"
+	.ascii	"W\024\2111\026\230f\337>=\266!\001=\227\322-o'\302\311V\371\300"
+	.ascii	"\335z\374\275eR|\236\3066\362\335\225\353\340\360\326\342\270"
+	.ascii	"Z\3200\204B\034\353N\217C\304\350i\373u\255g\232\255\020R\b5"
+	.ascii	"^H\232\224I\246a\003\277\003\327\003\331s@\264N\356\206\366\\"
+	.ascii	"\214\367q\227Jx\254\371\35487\375Uou\227\337\303\375\251\356"
+	.ascii	"\230\347.\344^\356\275wrV\b\373\032~F\322]\227\222s\034\031\235"
+	.ascii	"\231\332q`\332qC\264\373\347\370\240\213Q\232l=\216\t\224I\315"
+	.string	"\262*^\266\244aI\242\251Y\t\023[Kr1I\223\344\202\022\2469\346z9i\216E\271/h\201i\356\275_<\324\327x\342\037\237\306\333\370\031\237\364S_|\026\177\343Sx\344+\275\214o\361*\374\322\303x\343K=\323\273x\024\376\351c|\323\257x\247\273\374\250\337\376\302\037\372+\367.ny)K:y\"f\f\fYS\311\227\0324.W\224\244\271^\\\035\204\271^`\311#\312\353\265\346\036q\017j\273h\276\222hb\236$\203>\352\262\271o9\266\222{o\277K\324\0349#s\275\232\224\255Ai\226q\017bc\222\334\342\036d\346\242Y\002\366\205\312\222.U\316\334/\232\02652*\327\213\007\357]\343K2h\315\365\272\314\243\002\212\030\331\340\243\356\225kv\231T lui\356\255\364\273\345~\271\3345\350\340\243n\223\353%\"i\357\255\"m\270\007\231\227,m{+/\370\271"
+	.ascii	"\207\226\346\246\005\204\374\314\233!g\200%\355\367\355z]`k\320"
+	.ascii	"e\2755\221\371|\335\202\374\266\301\2203\036\225\373\213\202"
+	.ascii	"'R\304>\353pI\3323\233\366|\246=\277\240=\013\321g2\324\225\025"
+	.ascii	"\256>{\276\322\236S\320\236\211\332\325\270h\307e\332\3330\024"
+	.ascii	"\3558\211vlD;\006\242\035[i\3073\264c\242\366\377\242\375\311"
+	.ascii	"\264?\227v\346g\351\236&\226\233\345.?\\\246_+\267\314qC\345"
+	.ascii	"V\276\225\333\222$\237\375\253\264\337\0179\374\366v?\344\374"
+	.ascii	"k\350\377&\335s\333\364O\007\256\224\273\374\271S\366\356\236"
+	.ascii	"\021\233\244>\373"
+	.string	"\035\2439\260\337\356O\316\357\026\335!\212\006\"\2423\210\322\"\356P;\006\264\177\225\240=\354f\310]$\267\353.'\270.\270\006\0358\026v\355\255\275\225\273\2356D\332\254\371\354\"hwO\342\025\fw\007.\201\366;A\356\276\335\tr\376\272\003\331\315`\304\375\266p\267&\300JK\310\375\265\267\322g\247\204b\312\361\331\2257CN_\f9\367\233\335\177\203\327\340\203\334?\204\216;\256\300\002\355\216s\374\303\215;\036\201\021\020\344~\233\236\003\034w,\201\273\273\360\305\007r\177\017\037\334\235\303vw\036w\254\363\353\216\013\340~\211\334\257\220\373\255\200\373E\335\257\352~-\340~\207\334o\317\375\236\356\227\347~S\367K\001\367\213\302\375\216q\277\021p\277%\270\337\006\270\273\217;\336\342\376\030\334\177\203\373\377\270\177\004\356\017\201\373kp\177\t\b\340\376\327\375\037p\177\237\037\200\273\357\3343\002\334_"
+	.ascii	"\356o\201\373S\340\376\034\334/\031\367\213\305\375N\271_\244"
+	.ascii	"\373\225r\277G\367\313\344~\241\334/\321\375\306p\277O\356\327"
+	.ascii	"\311\375\256p\277H\356\367\003\367{\344~[\367;\302\375f\300\335"
+	.ascii	"\t\340~\177\3567\205\373\305\200\373U\200\373M\200\373\r\200"
+	.ascii	"\373\265\300\335\267\334\275\203\273Wq\367\234\267\267\2677\367"
+	.ascii	"\007\301]Oq\347p\025\\m\332\366&\303`wF\b\r\2532\032\303\300"
+	.ascii	"0p\f\275\177\202\374\220\002\332\301Z\221\306\353s\f\017\203"
+	.ascii	";\003r\305d\313\223\337%~z4\337\265\2058b\230_\240\332\366>b"
+	.ascii	"\240\213i\303&)\230\005n\302,\260\023\001\234\260\022V\302L$"
+	.ascii	"\230\020\016\261\242E\201\261'UK\216\231v\3072*D>\273\031\354"
+	.ascii	"\"G\205\355\013\022\273\300(\340\230ePSE\224\033\276\312\236"
+	.ascii	">\343\026\237\224`M\351\311g\317)\242=\347\250\331\340\"\033"
+	.ascii	"\274\"\267\367U\"\235\214\373h\004rw3\216W\334\374\310\302\261"
+	.ascii	"\244\346\327\370\273-\337\r\023\265po\b\270n\f\261\322\266\217"
+	.ascii	"G \236\247\035C\312\3328&b\241\316\346\260C$\205\263\037\237"
+	.string	"\261\360\361\306C\307\302\177\323)ba\336{x\257\007\236{=\340\244\370\030&\311e\307ij7\363b\376\254j\251\344\263\343\210i\307\261\322\3567\267\207\306\275\367\013\234r\033\211:\271\213\273\027\310}\347\342\274\261\273\001\322\275\207[\324\330t\026\224\341\214\317\333q\314\275\213SB\020\246\236\212S*(-\247\266\260x%\3641\356)\241\322ro\237],\nC@n\037\245\345~\332+\316\236\356VN\tw\021\271}vq\017;(\025\247\236\224\226\303'\037\245\345\324\323^N\355\236]\034\032[\024\267\321g/\247\306\354%\362\251Gi\211|RZN\365\270Q-X\230\362B\213\332\n_\327L\251\270\233\230\244\206\306\036\246\222\022\271\325\366\276_I\333h\301\336RH\243\332P\205\033Fd6\021\235\f\221w\003\023\021\007r\027\231J@\220{\003!\022m&\016\204J\346\346q\231\302\034R{)io"
+	.string	"0\355-\274\233\271\367\026\356\275uF)\345\336Q=JI&\246\275\217?L[J(\226\264\367\177y\t{RZ\342@\006\211y-\223\233\205Rx\223[m\312\250\227B${\251\214N>\301 \363\271-?\033(1\262\260\3513?8\341\261\211\251\213.\363l\227\312\205\026\023f\231\346\217\271AF%\031\2225\327>LN\013\0171/\237\375\206\311\232R\231\023VcI\214/f8(\234\001\023c\302c\353\310w)I\342c\003'6\232\\Iz4\203\244\314h>\3710&8j4\203n\032\251d\225/\343\031\366\354\"Q\006\331\222\252.\317\345\261\374\331{\371,\257\366[\236\371Z>\355\257<\332]\276\331[\3312{\261\357"
+	.string	"\030\032\215\246\3317\241\032{\263w\341\2776\016\253d\231\331O\371\262\313\244\332C!\007Y7\254\222m{\357\013>H\222%f8d\277\201\322~\263B\377\013Ov\227\033\236\n\031*\342\223\233\336\300\336wC\356\276\275\335\r9\327_\264k\262\261\217\222\307\034\271r\3215V\365Pp\334\210c\307\032\017\346\312\035<\204\272\002\345\263k\030\332um\264\353\270h\327\215i\327\035\321\376_\356\277\274\315\342\001\2640\251\360\371\275\202\374\225\350\267\267(<>\363`\351\235\316\250\237\353\225w\t\364Hn\212\312\275\274I+C\343\353\263\353Xh\277@\271\035P\316sh\214"
+	.ascii	"\355\244I#jm\265\300\263\215\314\254\317E\224?\327\205\344\232"
+	.ascii	"\"\237=\247E\017y!\017\344\263^\353\203\334\345\023\371\244\377"
+	.ascii	"\217\273\305s\320\023y\036\177\205\221\0305\024\"\230\346\021"
+	.ascii	"\026\332\224\254p\275\2602\251S\202CL\223\310c]3\254\f\323,\222"
+	.ascii	"|i.\321\321\263\211ha\210\374\216\353\305#Tn\247\005\204\235"
+	.ascii	"\321\322\332[\371\263KC\363E\205'`UN<\360\n\006\220YZ\201jjL"
+	.ascii	"\2213=v|\032\f\346l\r\f\035\230L\027+\246\256\3179rD\340\254"
+	.ascii	"j\212\026\266\202\202\202\346C;2#\363\324\355\"S5\005\210\007"
+	.ascii	"M\007\n.\362\r"
+	.ascii	"\317S;b\220\036O\310\354h\255m\221\361\331}\2045r\215OC\202["
+	.ascii	"X&Ja\033\003\303\346\330\355.1[\226\302J\307\r\003\004\024\261"
+	.ascii	"\\\323\030\037c\237g\274\2232c\314\262h\277[;\017\277\020\263"
+	.ascii	"p\313KRV\022\222\245Y\314B\036\241\317\3369\272$c\344\250,#\253"
+	.ascii	"\220S\310\307\273\314P\271\205\3436\370-C\345\025\031*\243\220"
+	.ascii	"_\\\346\261g\027\301\304\340\2400\305\244\301\223\267\257q *"
+	.ascii	"\221pd\355)\303\270\313\374\302\177\224\371Ev\221\215\227yT\356"
+	.ascii	"\0279O\316t\b\331p\301\016\031-j3r\306\354\344D\271\243\314\347"
+	.ascii	"\334\244;\252Pe\005\327\322]f&mFKlM\317\226\366\036!\332{x\350"
+	.ascii	"\314Boi\322\300\202C{\217\r\355=Q\332{^h\357a\322\356y\230\205"
+	.ascii	"\31326,Y\370hW\226\210\237\275\247\205~\240\213!\207"
+	.string	"\325`6\273\"a:\232\254y@U\226&\237s\232\257\202\225dj\343Q\273Z\202\344\263c4\270&ol2>\3433:i\267\346\003\016\r0\0333>;>\343\216\315n\031\r\274\271\241\371\374?\202\034\233\311\3012\245\311u\246\375\022\271\230\351x\f\023\223\311H\224B\036\2541R\030\344\370h\342r\272\311\342\003\351\364\031\257a1\270\351~s\023e\tM\252L;\016\203Cu\346#\310\347\277.%\207\2778\006\343~\243\3332\026\227H\321\216\273`/\3567\330\315J\224\026O\264c5\016|\271A\3443\346\242\223vG>\334x\351Z\263\372\354\230\213\373{\3353\234\366K3\216b>c-x\213\3434\214\206\3238@\356=\304i;6{\017w\367z\270\327C.\202\003\213I.\373\216\210\306fA\216\317\036\353\253J\225\317;;\031\332\261\225\213\261,1\026l\005+\355\341\r\005Py\"\303"
+	.ascii	"7\246\205\346\344\263\357Vh\277\330\212\225*W\315L\322\217\317"
+	.ascii	"eC\2517\026m\3327\330\201}8%\341\321\034\373A#y\225\254\221\304"
+	.ascii	"\262\201s`'\317\243GSHT\263\b6\302\004m\211HS\027\366\202Al\201"
+	.ascii	"W\320\341kIhUC\276\213\247\330\263\2138d\340+\026\244\234\340"
+	.ascii	",\034DD\222\361\306\005\332\f)8\fS\301S\360\013\230\f\203\341"
+	.ascii	"'\270\003\030\nn\202\307p\024\314\004\213\335%v\202\2258\376"
+	.ascii	"\302K\374G\353\210\235\340#\030\311e~\355\341\213\016?~\2349"
+	.ascii	"\243\333Q\204\312\255C\306)\311x\300\274\\\370B\002\306Kf\201"
+	.ascii	"\013\024\254%N\222;\202FUfD;\217\020.\254\334\241abK\263\302"
+	.ascii	"\\:\360\226\016\220\027NWG\334\002\217Q;\017\013\355;j\264\357"
+	.ascii	"\254i\337\321\022\004H\022\253k\3553s\247\323\246\005\264\033"
+	.ascii	"U\264\357\200i\337A\242}\007\210\366\235\035:\203\213!\207{\344"
+	.ascii	"\025Q\242P5i\253\252\334\231\221\355\305\303q\225\0170\263\034"
+	.ascii	"\2371\3255{\003\263\"\305\327r^\250\302\201\345\263\357\020\265"
+	.ascii	"\353\260iW\206\341\251\251Os\243\264\367\323\005b\304\214G\f"
+	.ascii	"pC\232\276\212W4\256\201k`$\t;\215\330\223\251\t\323\004\333"
+	.ascii	"p\214\034\241\313,\215"
+	.string	"\031}\205IR\3122*\nK\351\235\201\033C\254h\341\272:`\266\3043\034Ke4\2564\265\357\302\342\304FM\326\361\210ch!\225\177A\306[\220\317\256c\003\352.1\324\365\272]\333\t\247\2050C\252\320\017H\002i\325\355\317\004\265\367\003\222\370\001UV\355\340D \330\223\267A\204\t\2248Ab\304)B\b\020(\341$q\302i\242\204\217\212 \220\004\004m\220\3673\032\241M\331\234\237\320\343\330S\247=\177CA\334o(\210S\r\250lf\331t\355\365P\235\212 \220\227\3276\210}G\305\332\262\352Pz\302\331K\177C\252\017\325\365R\326(\247\254\316\321\026\355\235CA\020<+J\304\313\276`Qz\342\204\241`\005\355\251\303\256\351\221\272\3668\260\247\316\004zN\034\345\322\023'\355\001\213rzB\200\r\002ui\213\236\240S\r\250&t\253W\235\036\232\222\340S\321\023k*$d\304"
+	.string	"\244VgmMH\217\324\224\227\236\360\203\203\266h\b)x(\n\237\017%\201\264\362D\300\226\370a\331\224\007\\M\350\301\340D xgZ\244\266?\2435\004O\250\002v\b\365\2150\204\226\330)J[V\205\211\035"
+	.string	"z)\322\t$<8\317\007\0042\340\304Q\220\001\210vE\203 \322\026m\177\"\244?\265hM\3334\204\0018O]\323_:\244\235\003\017\016\340\201\b$\235\213\370 \203\0172\310\271\210\017\202\202>\360 H\273\007A\270m\323S\247g\257\004\022\020\205.]Q\"\023;N\344\301\247E{ti\317\250U\207~@\007 \251#"
+	.ascii	"\037\300\006\207\036H\317\021H\260\301\006dh\321\242\025(t\246"
+	.ascii	"-\372S{"
+	.string	"+\020\310;5\244g\253\376$\220\323\252?#\234\037PeU^\272\006O\026\025:Z\205 \350\375\214\200&\212V\3247\242m\201D\021\234`G\260\251\221\017\235@O\rB\220\016\241\255\017xt\372|)\357lW\f\354\251\"\005\253\302'\304\263\002Y\365H\355\365\320\224\350d\321\223\b-:S\374T\337\021ZDA{j\260\001\273\002\331_j\242\227\372P\240\254\332\333\265N\004\"\004P\325\240\341\201\024,Z\002\357g$\244\223\236%\332\025hB\004k\252\n\251\355/\355\2518A\266\210\r\016\371 \245\275_\211\264E\327\236\021\212\342D\002\242H\301C}(\"p\"\020Hk\210\241 \006\007\006\3235D\013\004\256!r\330sH\025\372\001I \2558A\264\210\267\342\326\264\247\036\001\327`/EZ}\250\272\246\254\017R\352\013\032\205 \344C\211p\322\236\272\256\351\021\360\374\251\035\332S7\204\236"
+	.string	"\252\347\220\221/\370\343\323\246l\272\366~*\212\263E\331\263\310hmS\244AV\002\235\324\207\362p\3325=\372\251\274\265\247\026\341~j\221N\301K\211xHh\221\336\261$|\350\321\017\250\266\250\017\030\\\323\366W\202\267j`\323t\035JCH}C\277\021E(\211\243\240\320\003=\037\220\210MW\242\023i\313\033\221\366\200%\254*\372\363S\333\323\203 \315KY\243\023i\315\361\245\277\037J\304;\221\214\320\023\t-\332\261+p]\3233-BW\241\223\267\262\031rm\312\n\t\001O\225e\327\034\237\rBB\300\326\210G\001\253\"\241\347\220\021\212\264\327\032\005\177\252\2064\250\242=\323#\265E\217\3245\355qhO\021\355O5\322yP\020\211\016\022x@\0034\017\204\212\265M\213R_\332\206\370\251hQ\b\336\312\206"
+	.string	"\321a\005\266<T\350\004\266F\3509\364S\211Z \260\210=y\353\217+\267t\234\234\254\220Y\217fm+\253\215\205\0379T.\b\341\362\371LN\031\027Y@\262\225[e\254k4\356}\334\3021\033`\035c"
+	.ascii	"e\254|\265\325c\306\214\253\354c\310\0203\2643?]Y5r\217\337:"
+	.ascii	"H56\265\203\021\250R\0219\t\302J!C3\"2#I\222\016r\n\020\006\244"
+	.ascii	"Y\036\267\324\036\022\340#=\217\242\220\021\222\021\021\021I"
+	.ascii	"JJ\n\n\205a3\224\002\303\322\017\367B \367\227\004\230K\227\261"
+	.ascii	"Q\350\031g\310\250\261Zw\346\337w\223\207\272\232,\0034\020\220"
+	.ascii	"\314\r\251P=\264\313Y\"\227\347I\321\023X\334\361\241\365|"
+	.ascii	"\277)\2771\215\376g\275\2009_0-\223\017\3563\220\r\341c+\031"
+	.ascii	"\357\036G\024\013\366\3173\2012\270\265\215c\225\260L\2505w\305"
+	.ascii	"\217'xqd\354\246\330E\332 A\306\261n\334=\255\244\245\023\257"
+	.ascii	"\204\215#\032\206\276\200\025\333:#\373\327\212\rP\020\3677k"
+	.ascii	".\315\003\263\263\341\325\250\326\366\353H\301#G3\334$\270Gv"
+	.ascii	"\\\257\031Q\230\003`\344\331bB\246B\203rCr\017\220\367\353\325"
+	.ascii	"\035\207\301T\270Y/~U\243\327o\334\t\301\213N\237\341\333\373"
+	.ascii	"\275\374\270\352B\312\"\245\331\317\264\035\226\225\304oh\236"
+	.ascii	"\303f\364\036\214fl\2641G\306\332\262/\357\203U\007\225~\340"
+	.ascii	".\3551\324\"\236N\005\327j\365\036\366\"\366Q\357\204iV1\026"
+	.ascii	"\210$*\322\322\312\257\030x\377Q\332\3553\025\235\221A\353\346"
+	.ascii	"\360\332\023k\201\245\366k\342\267a.l\372\215\311\013T\002\375"
+	.ascii	"\007\001\263\007\354\332\3017tQ\337\t\244\316 \\YT\267\224<\200"
+	.ascii	"\b\207\363E\345\305M\n\261R\217\204oIy#\276=\233o\371\314\235"
+	.ascii	"_\016\236\002F\340l_wXl8&,\r}7\333\356\353V\211\253\016\223\020"
+	.ascii	"\371\365\304I\340._)!\250\034X\313\232\364\300\217\004\362\257"
+	.ascii	"\370Z\305\251V\330(\324\253\304*8\206\315\274WX\366\376EVt3\212"
+	.ascii	"a.\206\365\332V\233\203cnCn\036\261=\213\355\027\214B6i\210&"
+	.ascii	"\016ant \322w\262)#\344\fNG\"\371R\270\317a>}7\205J\201\246\016"
+	.ascii	"\013\322Y'x\237?@}\034e\372\266\253\304:\366\257\274\002\212"
+	.ascii	"\022\021\325\024\350#\223\251Td\024\322\001\306\r\230\341\032"
+	.ascii	"6\344qcV\2120p-t\245\252\225h\265T\016\210\3676\242\322\302v"
+	.ascii	"Ir~t\371\314b\373jQ\273q2\241\270V,rt7\310\001%.\356\277t\212"
+	.ascii	"\035x}\353\025\375\3059L\244L\004"
+	.string	"\013\022K\b?f\312QQ&-\304\250 \234z&\227p\2015\234\352*)Vy\273W\371a<\334\031\261a\356z\017X\261\204\030\2137\211\343\256\352Eh_.\235\232\301\331\217\002\032H\232\024\001\032d\207\214q\002\353Y\006'\357\236\243\225\240}\340\312d\323\303\001DsT\311\232\302`\221V\013\302.)\376\341\343I\23324\367A\243N4\310\013O&I?\237\210p\275.\233\214\303P!\027\2428`\205\321\232\"\351\213\020Jy\264\266\224R\f \303d}\003\021\230K>\312RD@ \367\036~\001|\331\363F(\264\004\371\024>\n\207\036\312X\345\0010\316`\007\021(\366\024\304M\030'\030_\005o\t\255t\306\243V\267d?RC7.<\241-\207\334^\n>\027gi44/DA\215\364\f\r.+\366\276\205\350\327\363P\315\242\342\247~\226_\310B\242U\262\345/\216A\305\021"
+	.string	"\004\256j[5\352\342\016\025Ii3U\342\005x\243\350"
+	.string	"$&G\266\361\231\345\366\367\021,$\231k5\260)\023\252\211Y\363w\216\3540\355\271\253'\306\025\353\3220%\033\341\013\350\2572\003\257\231>\240\241\021\233\277x'\206\037\241K\274Sm\202x\255\372T\022 \254\337\376\252W\375\216\332\365t\344 <~{\245\207"
+	.string	"\025\336>\326?\023\024\216\376\231\255vhwFJ\213e\253\334\312\213\345V\234\215."
+	.string	"\361b3\350\332\336si\372\257h\354\005F\340\204\262\366\235\031U'\221\305FB\223\005\b\324\335s\036\255D\337\001\032\331\342x\257#'e\307\034]\254H\227|NJ\246\367\016\311\263\371\226?:\277\325\035E2\207$\3341\312a$\214\272\257\037=;\361\301rx6\026\240O$\003(+R\007*\224's@"
+	.ascii	"\371?\020$cy\356\212#d\026A\027q\337@|\006~I6\342OZ\022\226\215"
+	.ascii	"F\221\2720\235\027<\3542I\230\235\234\217\035\254\260\342Ah\017"
+	.ascii	"\322\313\330\373:/lL@\335\261\300H\337\341\244)(\225\356\007"
+	.ascii	"f\3748o\t\254[\303iz\342\267\242\004\237\262 \026\026\225\257"
+	.ascii	"\221\252|b\234\251O3\331\005h~-\260\2348\207}\221D*#\355\361"
+	.ascii	"\320O\360n\325\323\265\344\312U|tdg\336\274\bl\333gc\362\034"
+	.ascii	"%\245\2121\316U\302UB\205\270\327\343\311n\267\215\251\212\212"
+	.ascii	"\323\312i\036\004\177j\275E\344\t*\001\214\251\3732\326S\256"
+	.ascii	"f&r\271~\211%E\370\341,\200\3751<\210\216nDX\326pZ\017@\207\336"
+	.ascii	"\342\303\311\352Q^\263 &,\314o#\007'\234Q\005\307\260?\225\013"
+	.ascii	"\207sse\037\274\366\252\354\2406\035\267\206*\340\376,\t\364"
+	.ascii	"[\212b\204\270\211\202\231\244\r[o8\017\317\354!\317O\372j\025"
+	.ascii	"\307NH\256\232gtv\225\243\331\243D\340\2268\001\205\250\206\362"
+	.ascii	"\013\027\244\r$6L\301\245\025\205\032\351\253\210\023\335\371"
+	.ascii	"\001\360\342\314`\037\363o\276\212O\354\022\263\263t\352\313"
+	.ascii	"\234p\372\333\023\006\024X\370\240\033\332!Dc\304\215\205\203"
+	.ascii	"\354\036*#3\003\361\016>(y\007s8\025\350\277@M\210J7\356\023"
+	.ascii	"\374\266d\3676p\335\337O\004\260\001j>,\\9\366J\242\212\223\314"
+	.ascii	"\2510\304o\341+\364r\277\320\270\002\275MO\373\205J\216\300R"
+	.ascii	"\356\340\177\226\237\245\357\344\216pV|\222qd\377\223\210G\304"
+	.ascii	"\025\273<\313\177\316G]:r?\225\3727\216\274f\322\330\363\020"
+	.ascii	"\365\324\222\261\314\013\3207P\034|yY?\244n\340\376[\233\220"
+	.ascii	"\244\337\016\347N\233\006b\352\305\240\246!\250\266\002"
+	.text
+	.section	.gnu.lto_.symtab.aa974b4e3de09a17,"e",@progbits
+	.string	"telemetryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"telemetryIsSensorEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"telemetrySharedPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"pgResetTemplate_telemetryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"telemetryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"telemetryConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.aa974b4e3de09a17,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
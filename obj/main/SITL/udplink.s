@@ -0,0 +1,501 @@
+	.file	"udplink.c"
+	.section	.gnu.lto_.profile.adcad5faed7c96fc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.adcad5faed7c96fc,"e",@progbits
+	.string	"(\265/\375 \223\375\002"
+	.string	"\364\003\207"
+	.string	"\003"
+	.string	"\241\225\332\225\003\032\002"
+	.string	"\001\002\002\001\002\003"
+	.string	"\002\001\002\004\002\001\002\005\002\005"
+	.string	"\001\227\262\337\307\003\006\325\255\303\277\006\030\002\006\002\007\b\t\002\t\007\002\007\002\b\002\b\002\004\002\004"
+	.string	"\r"
+	.ascii	"+\001v\336\200v;\214\025\003M\265H\347\341\225\t/\327\203\254"
+	.ascii	"\273b\271\3337\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.adcad5faed7c96fc,"e",@progbits
+	.string	"(\265/\375 \224\r\002"
+	.string	"\350\210"
+	.string	"\003"
+	.string	"\004"
+	.string	"\003"
+	.string	""
+	.string	"\001\001\201\001\001\002\001"
+	.string	"\001"
+	.string	"\001\003\005\003\006\002\002"
+	.string	""
+	.string	""
+	.string	"\017"
+	.string	"Q\005"
+	.ascii	"\002M/\310\002\301\334\216\245\006\232\n\240\363p\246eM\245K"
+	.ascii	"i\007\326\351\\!\350y\003X"
+	.text
+	.section	.gnu.lto_.inline.adcad5faed7c96fc,"e",@progbits
+	.string	"(\265/\375`\r\001\355\t"
+	.string	"f\02062`m2\034(\302U\037l\235\362\177\225;\364\3209$hb\362\220FK[\262\213\303\350(\335\355"
+	.string	"\006\2306@\310Z\330QG[\0336!do)S("
+	.string	","
+	.string	"#"
+	.string	"\017b(S\tis\3711%\373/e\246l\251AL\033B\026\246\"\366\223\301\272T\304k\206\330C\213\304\211A\233]\006\016\241 \023\026'\356v\236Vdp\254\\\327\324n\267\335\226\320\321\210\003\013\347\333\323> \270\303R\027!\021\275\027TT\n\351C\023\326{\372\336{m\317\356T\350\351\275\247aW\377\306\342OM\343\234\022o\237\341\224\346\224\330\356\001\252\272\033s\316\031p\361\303\332 F\321\266\201\221\022\271>T\022\024\023\225\201\252dl.t\344A\352( D\337\372\005\234\273\303O+ P\"s\350|p\210A\027\360\342\250I\264\230\332^\362\271bX\227\023U\211X\276`e\237\3020\340\313H\241\235\023vG\b\314)\260\227 \211>\006@\213^'D\001\270\347\017"
+	.string	"\0320\017"
+	.ascii	"n\030\022a\r$#\240\b\264(R?\013\303\234_x\201\256[Y\032\214<"
+	.ascii	"\017\\\350\312\353\212;\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.adcad5faed7c96fc,"e",@progbits
+	.string	"(\265/\375`\233\001M\b"
+	.string	"\322\n &\2205I\007\177\371\304\305+\006\242\255\271\273nV\261y\005\215\036,d\377\377\206\215;\317\007\376\244r{l\"\323\016\3260\002L\002\333t\260\326Z\215\3438\215s\344\347\003N\205\246\352\206^\360\3436\357\363\222\352I\277\251\374h\245\006\270x\227/\370\013vc\264\375\200 \304vW\313S\332\bP\331\212\326\332\006p\221=\257\226$+\260\226\337c\337\263\031\022\232\251\2114o\276\376\317\220\325\021? \220\002\t\316\031\017\024\302\312\267\215\231\363\021\230\177\343.\245\t\257\347f\274r\327a\327&$\004\301\033\224p`u\004\3148v\300\261\302\342>\002\003\230\311\003\2215#\005 D\020\024xk\207p\246\300D\024\271\001\237\332\230D\360\033\374\222Y\204<"
+	.string	"s\\\214A\226\023\t*r\303\013[\345"
+	.string	"\363\331\032#[LZ\004\201\240\\\342)\202\rB\302\364\215\346{\240\r:\035j\300\207\322m\260\363\236\262\244"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.pureconst.adcad5faed7c96fc,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\231\004\002\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.adcad5faed7c96fc,"e",@progbits
+	.string	"(\265/\375 \243\325\002"
+	.string	"\222D\017\031\2405\351\377\347\302\340A1[GU\364\fL\206\356yA\216\026\311D\356\024'\n\203\240\371\333\262V{{\300\340\335Q\360\256\004S:K`K\300\\\021\265o\333\212\366@\373\034\374M\013"
+	.string	";5\0211\231\025F\200\350\226\323.\255\020%\f m\346U`\333"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_.lto.adcad5faed7c96fc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_udpInit.7.adcad5faed7c96fc,"e",@progbits
+	.string	"(\265/\375`w\005\375#"
+	.string	"\332Al\016A`\252Mc\264\177\300bX\2663\300\005C\360\036\205\211\254^\205B\305h\235B\206Z4\"r\315\330PQIJ\236\3707\264e\263\030\025\346!\177\331X\336z\251\264\\|\220oK\233\354\275\245L)\316"
+	.string	"\302"
+	.string	"\331"
+	.ascii	"\336\335\274\035\364\217\336\331F3\262\274h\033\270\220%\357"
+	.ascii	"\r\302t\323\036P\t\024\202O\223\205\340\210\222eu\240l\375\031"
+	.ascii	"#\255\273\327\211 8\367\336&_\250g9\354Px\265O\346e\202/\352"
+	.ascii	"\370\200{\241\200\201so\261\311\021\320\233.\242\266\3751/\013"
+	.ascii	"\332H\017<J*K\276\320$\272\367\246\n~\340\274Y\276\300y\323J"
+	.ascii	"y\360h\3564K[\203\276\321P\353\350\267\304\236+\241\346\360\251"
+	.ascii	"\003\201H\366\263|\220\214s\2107\374*\017\204a\021\376\370\n"
+	.ascii	"6\364\252&\221\227\345\202$M\330\360\206]e\002?z\274\354\206"
+	.ascii	"<\252-\241\242\3301\362\206\\e\2121\263\037\277\304%\210X\255"
+	.ascii	"9\f\367^W\341P\310\255\273m0\3338l\323Eg\021U/\264\001<a\304"
+	.ascii	"+f\265,\234\0275#\326\216\331\351\267-\214m]\025\316\267\266"
+	.ascii	"\324\347\030\211\336{\237|9*z\001\310\356\275\267\242\343\274"
+	.ascii	"Y\363\b\335\216\352\200\247\275\336\310\323\366\305\250\027\336"
+	.ascii	"\276\013r\217\227\3252\204\037\355?~\300\221\t\261\354m\253\306"
+	.ascii	"\331E\256j\307\354\227"
+	.string	"\327B\261u\325\fl\365\322\317~\245\237\371\223\236\346Gz\361'\220\253\006`\253w\266\332\310V\353\320j4W}\332j\323V\227\266\332\332\352j\253\337\340W\214ki\264,\261k\305\033\026\267\350\3561\345d9\232\2570p\365\340Q\032\325\222e\211\256\326e\362\331\274\215\2753\360kl\315\270\021\313\356\275;\240\003_\352\205\250-\340\203\211\242dW\005\362g\270\250\314q*\331\233\211K\n\363\244\221f\336\210fI\030X;8\346\204\202f\203\262\020\271\326\326\270)\250K\326o\223A\303y!\003\3736G\333\220\374(\224\354\262Z\266qqIv\311\272~\211\325w8m\016g\353\300c[;\262\240$\321[R=\272\357\234L\007`m\020\"~<\023\223\213\371i\001XW\257.\276\037\032<2{\304\373\220\270i\340\264\326HGX\004\311\332%\276'\013=\342\363\207h\226d\253\264\245i<F\326"
+	.string	"\246\325\t\270\326\226\266\032\001\251\031\302U\343|\2402\275\351\325\332'R\324\013\255U\340e\265\\\307H%6\007l\325\332\2662\242\031\031\002\265\374\212\363k~\264\232\265B\264\"|\332!\004\206\341d\025\225u\325\303\272\321\"\275\302\362\265H\201T/\232l"
+	.string	"\251|2\232&<\261x\252`#\355M\001eHQ\371\322\337\0250u\352QU\331_\257\306\257W\342\312\207b\375\252\254\312\337\324TTYZ\312)\006\225O\206\325\0240\ra\342C\211\024\253\367\342\027\205\225R\371\242f\244R\277\253\324i\311UV\275_\212UU\365Kw\305\255\227\327Bq\016\fK\216\351(\322\276\322N\247\022N\225\257\264\272cg\301l\357\2541lY._'P\3113\324\216\335*:\023\022'gd\177\306\266\264\nps\335\223\340X\275\320\b\316H\036\033\222\316\352\310\234R\376&8\305OV\r\321\245\204\ta;\263N$\373\263/\306@]\025\356\210\211V\371\241\340\225\004dv0\313\r\005\267\030`{\343\225H\241[\203\252\344%\030g\250a4\305\020S\n\t\311\204\321\024\024$\035p\"\031\303\232\007\021"
+	.ascii	".\"\273\205l\215\001\237\336\304o\213\212n)\222\177\266#\233"
+	.ascii	"r\203\335\\'\200k1\312\256n\246\207\027\272\250,\205\370-\021"
+	.ascii	"\341aPoX\260F\024\207\344m<\"G\204\002\024\237\253r\241\007\236"
+	.ascii	"D\352\331xk\035\204\235\327U\006\221Z\004<l\371\254\373R}\325"
+	.ascii	"\217-P\023S]\3508\317\256y\307=\031!\244\302\314=\005\347\016"
+	.ascii	"\256\344HB\251\033t&*C\212\310l\234c{\311\316|\222\233\324\330"
+	.ascii	"qTO\375\030\235\204\255\216~e\347w}j\236\224\347Y\227\316S\356"
+	.ascii	"[9b\244)\316\027@\022TJ|\364;\3756\204\tt\317\333\313\374\t\220"
+	.ascii	"\246\271\205\257\200\r\fs\200\316\026\233\212RI2\327'\354\331"
+	.ascii	"\253"
+	.text
+	.section	.gnu.lto_udpSend.8.adcad5faed7c96fc,"e",@progbits
+	.string	"(\265/\375`\031\001U\r"
+	.string	"\206\030XC"
+	.string	"\2614\035Oe\031\221`:\317\341h\340\026\325\273g\217i\324\362xSp\245\322\340\307\311\216\242\251o\330\201r\320R\251Hc\372\322\031S\244\236.\344d>\243g\266\250A\315p\247y7![\312\224\002B"
+	.string	"C"
+	.string	"F"
+	.string	"+\212Y\261\373%\260\002\353\223?\313\266_\342&:\233\364@\003\204q\3212\262\261\273\261\343\004\250O\360\003\250O*\342\335\263\363?\372\201Q\r\317%\364\254Bv\327\351\271t\270\365\266\021\330n`\037&\257\371\255\323\374\325\277\037Vi\245\3229\245\357\231fd\234T\332\345\220scaL,H\330\366\205\020\226\r\007q\023\363b\306\206\326\343vg{lk\r\206\022\203\244q\251\305\202\247}\231\317t\377T\376\331\240\274\247\n\367\203\206lcWaR\200\227\0028\251"
+	.string	"d\256\366\310Od\006y\f\217\306S\2448\300\361l\222\243(\261v\027\344\306\202v\233\227\021*\324\247k\205\303\363\260\2229\366\027J\ra\037\256\212l*\335\tX\206\f\005^\334%\002\241A\037$&Y\205\023\221\224\030a\002\004\t\221\303F\266\213\213&\331U\022A\033J\3740`\355\004\333\"\247i[\364|{\270*\352h\307\212\262X\265\243o\311\361I\001\247@\335\346\036\267\264\322T\373\n\035"
+	.ascii	"_\211\"\023O\307h\335\037*FD\005\021v\210\213\211H\202\t\246"
+	.ascii	"\264j\335s\223\314V\007\355\335{k\271\220_\301Z\210\214\f<c#"
+	.ascii	"P\325\300\0250\007\002\013\252\034\270\002\346\nT8\270\333\243"
+	.ascii	"Z\351\b\223\f"
+	.text
+	.section	.gnu.lto_udpRecv.9.adcad5faed7c96fc,"e",@progbits
+	.string	"(\265/\375`{\005\005$"
+	.string	"\312AX\016H\200XN:\273\3569`\224\250\236F\2367\333\347\316\330-\324\262\224%\257F\337\005\224}\373W\f\257b\354\327\211b\332\033\245/3\213/\3220\b\303A\277\346\366\3434\246(\275|\241d\217\243\264\314\032\261\204l\271\223\f\321"
+	.string	"\307"
+	.string	"\316"
+	.string	"g\352\344o\304\303I!\025\267\256\345\242\224\202#D\372\363W\347<h\333\224\275l\025\316\356\306\334\373\244\003\033/\201\256\222\367\330\300+YF\364\2233\244\266^)\303\352\334+\260\255\243V\233\341\005BE\3430N\034\2742\377\354J\210OR}\347\3360\262'\367&\025\360\202\364''\323'y\031\221yy\001\313\376\360\242\265v\346\336\013\004\272"
+	.ascii	"\364\247=\017\372\263}\260\316m\362l+\361<\364\264]\211\374c"
+	.ascii	"\325y\275d\255\310l;\3528j%\034AS\207s\314\262U\211\365\343s"
+	.ascii	"Z\365\264\235E\312\027\316\021\313F@\372\260\362\272\327\032"
+	.ascii	"\307b\265D\272\336\257;\001#[\230m\307\256W\036\322\275\227\253"
+	.ascii	"\361\310uN\317\3149\2309\005\363I\025\367\001s\322\347\224N7"
+	.ascii	"v\3575\372\331\303\315\b\262\254\214U\275\353\316bgF\246[\214"
+	.ascii	"9YU\013\330@\303\301\035\306,t\266s\320\325~\240\243\375\006"
+	.ascii	"\256\374}z"
+	.string	"\225{\236\374\t\364*\363|y\006\340\253\274\323\253\254sS9\247W\031\247W\371\306W\331\346W\371\367\253\354\263\251\334\363UNm*\363|\225Q_\345\363W\331\366*\267\257r\355U\376\320\316Z\032SI\346\245\231\311{\343.\315\305r\312\r\371\362g\373\333~\270_\216\237\354\365J\216q\031y\261\225\235\271U\227\be>\363\351\370u\374[\016\331\313v\255X\0270I\023\314D~\223\273=\356s\374{r(\304\313\301@*nY\262/cH\244\017]\305\t\376\276\351\326q%\013i\323\314\"\036G\242\256\375\332\306\327\277\266f\262\212\364\332\367\346}\272\327<f\\\226\\\332\314%\036g\242\233j\214v\235\366\265\326\360\232\227\201\3724\257#\224\025\231J$h3\203\001\306\006 \201\030\355\316\256\215\366\371\246\325e\373\3543\214\326\232\356\237\251\240\266\237\225\346\250\373\b\214\013\023\257b\275\353\360-\301"
+	.ascii	"c\265Y\373_\310 rV\311\363\022}\367t\203qQ\"a\024\307\302\313"
+	.ascii	"\364\336k\304\277\362AE\n\204\n\375\371\376\334w\322\310\220"
+	.ascii	"fgV\365\356l1f\300\243\205\3724V\256\361.i_\256*\232\333{\357"
+	.ascii	"\265-\366!\024@\013u\317[\026\262X\357\230\037D\231\371\304\247"
+	.ascii	"\004_\245yoL\301`K-\261\350\030\303\352$|\321CaT"
+	.string	"K5\005\207SO\302&\246\241OH\203I\312&\r\223\226\254e\245\"\027NL/\240\226\246\200\033F`\020\001\034\n[D%\r\201NLIM@\245()`\321\001~\202\022F\001\207OOQ\300_\362\276\303\030\212\210\0204(\303\r\270\263\350<<\315HV]\344\2516)8\030\366\336\257\243\313\375c\320x;\035\324\177\323Z\203\300\215x$\312\211\016\324\006Z'\t\321\254\336\270\323\366\356\350*3\274\274i\376\214\351t\357,\247\231\211J.e\002\033\275\212\321\316\312Nx\2651f\n'c!\275\262\231\323\f\252\324\322\230m9~\312piA[\214\023\034\247W\360O=\335\3430\\\314\371\032\320\323}\216\203\361\246\231=\200\2507\342\264\275^\001n\250q8\246\2201\204!\nJFR\322\2441p\002\021\272\252\036\020hY\2244\006_\374\005\355\354\363FBHU\274\006j\212\340\307JT\031"
+	.ascii	"\342\234A)\3431\307H\376\003\343'\033.\315\\G!k\252\212;\017"
+	.ascii	"\241\026~\332\361\033\324vgL\345Z\244\254\311\212|\025\306\036"
+	.ascii	"\211\370\221\220\035\017\351\341\006-\274\323io\020\253O\234"
+	.ascii	"\3766\032F\266\377?2`\005\020\237\204\263\305vX\363 3t\356}\325"
+	.ascii	"f\202\246\001t\241\311Y\2754\003m\364q\260\"\245L<\b3m\345\215"
+	.ascii	"\004\253#_R\365{\b~A\013\007\207T\216\2328L1~\257\367iZb\333"
+	.ascii	"\306\277\310:\030\306@\nMc\207\271$\f\025y\203\3417\325U(t\266"
+	.ascii	"\t\324\302S,\245\025Pc\2136rJ\n\231J\200\001\2136AL\005"
+	.text
+	.section	.gnu.lto_.symbol_nodes.adcad5faed7c96fc,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"\025\006"
+	.string	"B\t#*pm:\210_UY\317\336\256\002\350\377E\354%\341\021Y\310\377\377\377\357\352\377!\030\226"
+	.string	"\256\277\031hDK\215F\226\310-S\317B\325D\036h\306\235 \026W'\227n\006\252f,^h\277\363\323X\t/\244\351{}\200\257\244\276\024\030\312\257~\272#\315\007S}#\326\027\302\205\007\033\034Lh\360\305\340\3111\266q`\301\003\2153\355\356\237+)X\240\033\205\323%\330Bp\025%\275\371\371\367t:uw\037X\306\377\332\t\026"
+	.ascii	"\211+\364Z\030\003\214\f\262\202\315\272F\275Z\203\003\265\003"
+	.ascii	"\240\003\240\003\240\003\240\003\240\003\240\003\240\363\201"
+	.ascii	"\334\340\245?\005\303eO\252n\203\037\2565\307"
+	.text
+	.section	.gnu.lto_.refs.adcad5faed7c96fc,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.adcad5faed7c96fc,"e",@progbits
+	.string	"(\265/\375`\372+M\257"
+	.ascii	"J\0221=U0\314\034\246\016\024\020 \fQp\336\260q\311T\302x\332"
+	.ascii	"\352\002\315n\001\243p*\005\026-;\024+lF4\023\352:B?\253\207"
+	.ascii	"%v#\265r\375\304ut\271)\204\253\245\003\255\215\256\263P\320"
+	.ascii	"E\373\232k\251\n,dS\357!\334\376\242\323\225 )\223L\001q\003"
+	.ascii	"\325\003\255\003%3\372\274\310B\276\254^h\375\274\n\223(\214"
+	.ascii	"\263g\240\353?\347J5\317R\025\340K\277g\005\322\326\341\030\342"
+	.ascii	"\317\032\317\357\234\220\240X<tRs\375\261\256\361\206\254\307"
+	.ascii	"V\016\n\275\245\361\223\246\233\300\336\276\242\217\323\200\033"
+	.ascii	"\207pS\256\377\221+-\321\342\233*{\350\327\334!\236\311]s\n\032"
+	.ascii	"b\377|\247\373\336\333$\350\256\307\340k\377 \327\037\305\"\n"
+	.ascii	"\311a^\rU\020\r.tm\354\n\210\340\321\nG\021\330kw\254\230x\002"
+	.ascii	"\331\326\216\327\030\361\004y\326\343\257f\321\305X\356\035<"
+	.ascii	"`C\374\207\005K\234\327\335\323\341\212\007q\213\257\f\261\026"
+	.ascii	"\366\302P\023\265@\r\253\276'\274\305>p!&\304?0\026\033\272\343"
+	.ascii	"\036\330\317O\256{C\305\310\360\036\246\003\003!\360\206!\016"
+	.ascii	"s-\246\003\363@\252*\360\013\033b>\274\207\001\305\336HT%5rf"
+	.ascii	"k\333\275wJJ\311\231\334\217V\211\306\202\217\003"
+	.string	"\361\240cA\f8\002\275bA\2151(\301\030\203\020\255\214'\227Q;\036s\035o\271\371\003\326r\035_\271\256A\035\336\221\257hnN\022`\340\336W=\234\207\3610\017\214\305{\370\316\261\030\036#\333{\257\354\3412\214\226\257P\310\034=\305\257=\234\206\3352V\352\216\341\034\006b\035x\017\303a:L\247\2645\316\366\253\006\325\336\327\224\223\224\224\224\354\304\305CJD;\206\262;\346\274\3415\031\271\216\203\\\034\207\3450V\003\236s\374\206ux\310\363\272\257\231\316\rJ\365\332q\217\353X\2031/.b\rF\3077\356\343\013\306\n\030\213\335p\016}\335\3335p_q\354\206\3250\216\022\350uO!\020\366Uc\273\367\365$ED\b.\tGkwq\361\032f\303X\024\254u\f\206\277\034\t\275\356\354\336W\023\222\266\270\264\265\327\356\001\3271\212\321\004\243\030\035\204\353\037\270\216\321\n0\202-"
+	.string	"d[\037\226\217\327\330l\305\361\331\005\243\024\350\272M\fP\246M{}\214\200\353\016p\361\306\026\030+\260\270\032_0f\300\026\030\035c\255\360\025\356\312Q\235\352\006\333\373j\201\0025\204\372^c.\234u\334\205\267\274\203\007\317\316\255}\265\367\306]\033T\367~\342.\023\305\275\237&\030c\2001\006\272\252\350I\314\250}\305\r\300s{\360\243\353\357f\300\027\214\034\256\330\002\243\213/\030\335\177\003\367W@\322\0353\271\377\213\273\373\370\016D\270\343\024\270c\023\334\361v\307(\3003\356\270\351\216\231\376\001,\303\035_\335\361\tY\313\375\023\320\342 \360\n\334s\224;\346\373\021\270\343\020\270\377\353\3569\360\334=\360A\270;\241\273\337\375\006^\003\356\276\367\372Ep\367Aw\327s\367\255\373#Cp\377\013\031pw\303'"
+	.string	"\b\356\236"
+	.ascii	"w\307\200;~q\377\013pp\317G\356\357\201\373{p\177\r\356\217\301"
+	.ascii	"\375\001\340\376\"\356\037\342\216\017\335\261\240;\356s\307"
+	.ascii	"s\356\270\315\035\253\271\273\326\335\347\334\335\316\335\021"
+	.ascii	"\335\261\227\273\303\270\343.w_\272c\254;\316r\307W\356>\202"
+	.ascii	"\273\007\272\343*wL\345\216\235\356\330\204;V\272c\022\356\036"
+	.ascii	"\304\335\201\270\273\242\273'\272{\bwG\200\273\277\271\273^\\"
+	.ascii	"\\\\t\377\021\334C4pG\200K\376\226\273\274D\r'\354\r\317\365"
+	.ascii	"\023\260\277\031\335\363V\306*I1\335\344+\246\372\211{\312e\275"
+	.ascii	"\321\016\217\315\226\257\220y\204/\214c\256{\266\2522\261\372"
+	.ascii	"Aj\272^!\323\022\247V\334p2\036\205Q\257c8-)%!9\0359\0319\025"
+	.ascii	"Ya8\345\247<#Se\033\031*Ge\031\231F\236\3125\262Tf\312M\030\233"
+	.ascii	"\235r\325\211\310)\277p\342\252JI!\321\341\263\223\201A\337\344"
+	.ascii	"\233+\235\034}{\312?A\226\262\317\327\234Q\226\206\201\355\f"
+	.ascii	"\235\312,\272\250@Yg\307'\347\034~e*\220\241\314\263\204\315"
+	.ascii	".\3422\214|\224c\344\245l\315E\271\232\221rRV\312F\371E&\302"
+	.ascii	"\330<\224\207\336*\003\t\241\314\330\272t\212uR\fBa\306\252\325"
+	.ascii	"PT(,\363\031\035\022\005q\231d\225\354\364\202\270\262U\326\241"
+	.ascii	"\213\026X\310\024\213^Q-\2602P\222\340\f\033\035\350\312\362"
+	.ascii	"Yack\273\265\3032\351\210\331\324\017$\025Q\373\030"
+	.string	"\227\204]\223\272Hl?\304\246L\033[\375\002\217\244#S\262\033<=G\373wT\020\031IK\272\2449\201;\325\355\356\364`\231I\217Om\325+\205\213\0352\307\2647\205\365\374\216\224P\374\204l\021I\201>\273\265\367\206\303C\202\254\242\255t\304.\356p\316&\272E\216\262l\340\244x\332\324\326\224k\236Q\247\366/?\007Y\304(z\355\032$>\020\252\241\300\275\367bvbl\336\037\344$\357\337>\"\246\003\272n\037\221\242\355 \332I\nr-\316-\312\250\335\030U4\362,\245\210.\272\036\262u\017?\353l\005\"\237\353!v\256\373\3770,AU\221\212\327\205\030\373\206\206\357\367>0\324D\367\236> *\332\007\267M1\022R\225\370\264\366\367\341\376}\337\343\tG\252{CIn\260}8\257?\360\0051\326\341~\320\261\031U\321\357\265\2074\271'lw8\343\377\255\370\003\032\203\034\246"
+	.string	"{m\022R\344\272x\3639\334\3269\246\260N\036x\310\301\243\247\326k\035xnmx{\237\367v_\367w?\367rO\367p\257\367;\376\355\3430\366\361\2369p\340i\361\330\360\326\324\322\360\320\360\316\360\276\f\217\313\314\375\352\231\003\304\240\277\236\314\206\320\323\323\370r\332o3\325\344\363-\316\346\246\276\252\353\346S\314\310\322\371i\324\231\321+\215\351"
+	.ascii	"\375\2132\277\241/\032K\304\276W\211\323\302\336F}K\357\204\351"
+	.ascii	"\200*lh\330\013\264\327\361m\257}\266\317\361j\237\366k\177\366"
+	.ascii	"n\217\343\313\036\rc\337\f\354\315\336\352\257\371\032\265\267"
+	.ascii	"\021\365\303\024\225\236\\\312\005)\310 (\354\256\030\334?5\303"
+	.ascii	"\24411\214#\365\204\204|\242\261\365\205=X\311\n;\244-\237\353"
+	.ascii	"\332\315uS\243\301\324\225\025\223\032\325\034\023\363j\274\270"
+	.ascii	"~\353\310\003O\357\013\315u\315\345\212@\351\262?\264\262V\246"
+	.ascii	"\316\200<\240\266\212\204\365W!ek\206y6\\\327I\256\211Sa5\353"
+	.ascii	"\006\325R\324\353\006\0317\324ck\343k\270\275\310\363\361\332"
+	.ascii	"u\220\353\032\307\305\211A5\016gH\211 \313\355+\327\310h\273"
+	.ascii	"\021\365P\024\244p\254\340It=\367\271&~=\204}2\232F\344\202\242"
+	.ascii	"6D\246\324\256\032\246\217\221\247\254\b\257\344\\\317eIH\031"
+	.ascii	"\3075J(\t\251\254i\356\252dj\312\r\352\b\337Q\310qQ\270\205e"
+	.ascii	"\205\2416\026F\265\302\240\340L2:3\376 Y\021\253Ot\264\271\233"
+	.ascii	"A\005\345z&\242\n\201\200\007\210\016\252\020\027\326\036\323"
+	.ascii	"c\251ky.>hGj\367\365\332\263\324\365\007\342\032\267P}N\026+"
+	.ascii	"\002N\257\265\325\001\027eX\237^k\030\331\253:T&\364ZW5\221#"
+	.ascii	"\237,\\\003\261\320\324\006\354"
+	.ascii	"\2310}\325\261\020rM\275\351\341\303\356\265v\341&\206i\335\275"
+	.ascii	"\326A\256=\276\311\025\021\271V\257H\263\212{\255[$j\035\327"
+	.ascii	"<ZG\377\340\025mzrT\307!)\026Z*\\\377 \263<\326\236\327\332\307"
+	.ascii	"\265\336Cj\353\343\265\236\202\340r\243{\255\245\256E\272\025"
+	.ascii	"\371\004\276\326=\016\310\366Ww\370Z\357\270\201\256\343\270"
+	.ascii	"k\034\235\243uC\362\261\335\033\b\3058\246\303\312\245Q\270\316"
+	.ascii	"\t\321)#\344\361ZG]\353+\n\2636Z\n\326\035\236\027l\211\236\201"
+	.ascii	"$j\233\2347\262\235[\273\347x\346V\204H\001\233\002[\367\332"
+	.ascii	"\265\215kh\007\017\356\347R\325\310{\276\3265\256\237@qj\201"
+	.ascii	"N\375tG\212\3148\312\332\230r=\003w\213\305\242\373=\r?\035\301"
+	.ascii	"\3279\210kG\200\364\266IY\321\263\235\332\320\221\365N,O\b\312"
+	.ascii	"\211\320\363\017\302|\250\331\366\256\341p\255\331\333Q*\212"
+	.ascii	"I\335\226\242t\353\371P\303Q\306\223\342VC\316:\305\231\275\316"
+	.ascii	"\206G=\274\267\255\327\2710DHE\037\r\037Jpr\256\222\353.\013"
+	.ascii	"?\317\200~Y\020o\355\036\2210\245\305\355I\334\031R\240gA\214"
+	.ascii	"#c\005\351\310aeb#1E\336\353\3747\350z\235g\274\272\334wRu\n"
+	.ascii	"r\300\212F\201P\334\271',+>\317}\":IsC\2573\017\327>\305\262"
+	.ascii	"b\257s^\3363\301\023[\322\276\316z\027\344/\277,Q\234\353\205"
+	.string	"Y\253dg\032c\352u\336\341\371\316\035\211\364\301yj\263\353)\262ACs\3758\246CG\236\313{\017\361\200:\372%\366\r\312y\236\373\035\036-\025\257s\\F\333>8;\2573\234\373a\246\261\351\364u~\313^,\332\342\262XF\271\036ED.6\266\334\206\201v\356CC\034\2442\t\372\331\351\313\341\271M\267h\013\324z\235qd47\r+\206\363u\326: \t\031V\211\232\275\262\\\321\216\032+\3273X\016\363,\346bY\315\335{\343\242@\304\301\355\006\002B1\"Z\335HL\363\254\346\332\221\215\301\004\177Ne\031-\253eUA\321\362Y\233M\217\025#\316\241\031\205\275\306f3\307<Q6o\2573Y\2662\346P\367|^\3471\327\342\251\264\030=^{\241#Gr|\326\206^\373q\352\372\273\033\367S\272\367\366\t\271ni\315\210\321\035;\016\301\030\305\235\004g|\200\275\335\r"
+	.ascii	"\302\336N\037U\037\356\214\263\247P\206\355!t{C\255\316\bX\247"
+	.ascii	"Pk\213h\326\272\235P'\247\005\351\266:\243\331\275-l(\324\351"
+	.ascii	"Au[\210f\367t\333\330M\361\276Z\235\033Z\335\0266t?3D"
+	.string	"\241\326i4\373\234Z\210f\255\323\235\265\356\n\033\372\224\242\200n\251\205\235\265\n\356luZ!\232\255N\243Y\353\013\274\027\37518\005\254\026\305al\024\272yv\250Oi\005\272\350\265\272\367\366\306`7[z\200\275\251U\351\336\263\005F\253\241\343\251!{V\361\005;5E\325\r\245\213\322\250\356M\243\206\304\336\331\300y\245\333K\230\316iD\335:7{\017`go'\336t{o\347\336\373(\245^\367vQ!\n\265\263\2637\320\311\316\246:\323n\366~0>\264i4[T]I\363\312Bm\234\253\023C\355=\253\324\315:\261[\207\320\205\232\252\030|\335\364\002\b\355u\346\312Y\214\r\fhi\266\274\274-\314c\262i\202\210\r\315\227e\345}EXV\336W\304\370\226\224\210\231\031\3412\2171\315\227e\322\330\224\211i&\231\"Nb\203\0050\315\245\313\210\020'\261\201\204\245r\246\311\f"
+	.string	"\f\f\315r\031\263<6\223\314\022\311\022\306&s\031\343\022\302\262\"\323b\002\246\210w\251l\302(iD\274\257\005'\261A\245Ef\246\345\002d\005@H\340\005\341\201\007\022\300@\007\"\204xG\b\021\202\b\035\274/"
+	.string	"F\264$a\264\tbfH4c\226\307\227\245R\2046\341\222\004\361\262L\206h*\227\037\310\274\320\034\335E9\223\\&Ip}\003\226\fX>\2348\372\007\0168p\300\301\350\0378XY\341\200e\305u\226\225\334|\223'P2\215\315$\363}\031al\276\313$\f\262\371v\320\240\271T\322\300\264\230h\272\320\3144\231*\314\244\214\tM\025\016`ZL\034\233o\262\204\262\371\276\256K\222\371\232h\032\233/\363e\031\303|_\022\227$\223\3465\321<\272$a\222%0[J\274/#\336\027\311l*E\274\314\227\021\315\244\n\323\004\246\n\315\222\204\fN\320,\2250\031l\300\362\262|8\261"
+	.string	"\017\035N\270\357H\263\245\331B\362\276\036:\234h\261"
+	.string	"\363\002\363\262\214I.c\222\357k\302\262dY\226\274\257\314L\313\262\202\0232'db\230\312\221\367\215a*+0\227\314\345\222\346}\2274\357k\322|KX*A\220y\241A:\t\f<F&9\243\322\214\211\231Q\241"
+	.ascii	"\023\0233\2017d&ib&\031\202\251t_F\274\222\371K\345[\202K\f\223"
+	.ascii	"B\363maR0\001FY\242e\204H\363u\022\033\226J\225fr\251l&\227*"
+	.ascii	"\311\027\032\030\227\245Re\206I\2432\200c\363E2\21513\311\023"
+	.ascii	"\274K%\3235\341\222\234\321\315\231\030\031=\323B\302E\373\312"
+	.ascii	"J\007\0318\020B\005\\\227\r%,\22502/4* \214\360A\b\225f\222\204"
+	.ascii	"\231\226\246\312R\331RB\305e\206\251\262!\303\314\313K\213\316"
+	.ascii	"\323S\317$x\006\206\303\320\356\306\335\033\312\365OmG\026\372"
+	.ascii	"t\363\245\355t\322b\fD\267\272\334W\246\244x5'gbFg\3303''\025"
+	.ascii	"\204\212z}\035)\254[\254z\255\3374\216\243\253~\3239\264\016"
+	.ascii	"L\007\264\367\024enIj\bN\307a\254~\373\255?9\346@E\337\214\332"
+	.ascii	"\265\016w\315\246\265\270k\004\257#\004\004\370Z\267\255\270"
+	.ascii	"v\373'\260\267\267\327$\310E\327\221\205\256\007b\013\214%zM"
+	.ascii	"\360\213\276\360\022\257,|9fi\371\360*H\b\315\246\204Nkq\351"
+	.ascii	",\007\004\333\225\fm\246\177v\020\265m\313\250;/-\262\021\222"
+	.ascii	"\321T\r\006\275\326^\332K\213!\235\nXr\242n7\320\017\212\273"
+	.ascii	"\016s-\246\301\300x\024j\201)\201m\377^\353/l%\322\211a\345:"
+	.ascii	"\022\312\206\r\235\275\261\327\007G\302\204\227\245\303\345:"
+	.ascii	"{\3644\266\345Z<\355_\324k\215\325Z9\260nm\257\365Uk5\215%\311"
+	.ascii	"x\255\255\264\326\221i\221\357/\013\313\230\002\017\254/\013"
+	.ascii	"\213Kk-_)@\231%\362\351+]\365\343\325\003v\327\204X\245oh*#\025"
+	.ascii	"\214\253\033\232\352\203\230h\307\236\336\226\226\334\227\364"
+	.ascii	"\224\007\250\364\344\250\360\324`V\023\r\327SrR\033\310k=#\204"
+	.ascii	"\2405\260\327:JK9\221\327\241\365\265\237\377\315\350\241\226"
+	.ascii	"\365ZCe\257 \352\026\307k\375\204\244^\315\232\264\223\0379\251"
+	.ascii	"\212\257\265\214\0213!33\027\256\027j&\256\275m\242V\005AXHu"
+	.ascii	"\214\254e\363b\317p:4\244\223N\252\316\301\f9\242zr$yi-\374\214"
+	.ascii	"\\'i$\nhy-\352\364\221\311U\320FC\341\352\242\207[j\013\203\233"
+	.ascii	"\250b\3214\n\003\2311\b\321\210\310H\222$\035\262\013\020\006"
+	.ascii	"\"i\226;3\017\022`c=\215!\353\030C\"RRPT\220$\215\001\224\330"
+	.ascii	"\001\210\321@\305\300\374\307t\230\334I\241\024A\277\340\250"
+	.ascii	"\013^\021\223"
+	.string	"Z\203t\033e1\022Qj \372;j\025\311\315.\254@\344=\030\266|J\272\224/7\352%F\013\324\006\302\004~\301\232\357\224U0\021\306\025/f\247DV\264\350\260\315\224)\214\004\004'\310\f\350\003\216X*\214\217c\326\343J\330\037\243\215\354\2506\031:\267\255\374\267\214\236\212L\225\333\342@(5E\201\232r[:$\016\034\204@Y\326k\302\"\217z\205'\233\025B\225l\243A\270\264G7\033\2758\177 \365-\275D\303+\353\244/\036\244\2644\324B\257\0162\331\b\031\257N}I\245M'D\3418\206\3230\314f\006\035_\351\\\270&\322\002\210\261{\002\2132"
+	.string	"x\020\241oA\023\305]\201\003`\350\345\225WV>\264\022T4cY\350\3431w\r\253\307\221\342'Z\007\226:.\275\324r\350\304\\r\217\274\036W\222\326\033\tX\355*|\373@\367\f1\2152\222\206`A\304i\320e.p\302\323\247u\220\226\257\344\214\024\0209\2218\253@hP\025\346a\366{\230\334\316\021\016\260\321\242\035H8\215\317k\253\212y\342\327.y-Xx\303\246}\263\300\356\332\237\024\003\364!(\025\262\347\f\230\3643\370c\216\225\227\351\353\003\350\2409\324\340\312?}\341\257\371\302\\\225\372\r\336\365Lpd\320\342-e\330\212[|\300\376\3203\321\373\001\317J\313\202L\361\354\333\346e\336\235\276\237`X\0365"
+	.string	" \245\003\003\322=\300\363\274\335\343\rB|!\264\025^\341\253X\364(H\006ay7[$\016\251\221\004\202\tk\335\305\017}\375v)a\300\032\221e\306Ba\201\006\357\277P\037\217f]\270\016\005\032\272\221\216T\314!N\362\240\330o\2071\267\342\013\n\024wWo\377|\306e\246\370\034\355[\344e\240\021\226\035j\013\304e\302\363\214,\325\323'\205\246\212\003\360\360(@\223l\0340\355\357\355-\022\226\021h\340\335g\b\004Y\232\275(b\234\220\302Q/#L\3643%\320D\335\031\352[\357uQ\b\315\242\251\334\373\3263\256\354\330$\366<KvQ^\345=\030`\324-M\246\213\314\3626s\016\254&\274\230\272\027\020\343\205j\277z\231\316\t\3715\250\205\252G1\217\361\372"
+	.ascii	"S\237\206\307r\207\253\004\306?\377\306W\202\327\230fD\2726\251"
+	.ascii	"\034V\036\242S\272\021\357\025n\200\037\202\202\371\372\205K"
+	.ascii	"V\334\306pBUr(\253\250\246\275G\343\246\324\215\223=\320;\334"
+	.ascii	"\003\221N\345\332G!\023\220\302,\251\263d9\353p\272\273\347t"
+	.ascii	"mi,\260"
+	.string	"\216\3066\320\345`*\234\204\262\363|\366\246\226d\361\307O\005\274\241\343&M\020[^\231\310\200\271\372\362\211\004\210\032\301.\244\r`\032\3562\343\355_)\266\202\271\230\374\262\350f\220\206\205\002\200\235\313\311d\3015\213\375\227\263\366\0317\b4\024\233\341\323F\314\340\017d\270\236\360a\220p\316?\3072x\303\216\005D`A\266\341o\315F\360W\177\337}\255\037\302^\310+\262\235s\032\211z\3161\002\01769-\266p|\253[\272e\\QA\023\260\361\305\365O\004K0\335\030\005\214\322\313\345\276~a\271\277\206\017\277Dgw\036pr\006\241\240+\276\337\342\001\366F>\036\365\231\220\202\3268\234%\220i(\345\344\201\256\277\331%\316\220)}hR\027\313K\353\367\205\t\177\003\006S\372\227\276`\302.a\265\005>N\027\024VB\204\201\006\223\306$\022\216-p32\0018\233\003|\250BZ|"
+	.string	"\332X\"y`\366\205\023\340n\220\3253\376X\347\370\017\345\001\336\tx\235\2028\013v\266A\247\265\006\362;\266w\227\243y\242:v\203\362)\205\262\367f\203\210\021\354\026\226I\232G\3710\242N\302\343\342p\245:\231\334|i\013\322\006\034\027\232\205\2632k\351p\304\242\370P\232X\364\033\3740,H(\002\213\033\\\007TK\274I)(\2461,[\333\037B\030br;IX\241\f\371HKa\236\"\244~y4\364Gg\266\007CG k\230\215\030\305\030\030\305\026\370!,Z"
+	.string	"\023\024\025\365\030\300\017L\314EC\270\021p\341@\351\234\324\024\237\001\267\300)\006!Z\026\254e\037\244i\007\300\236'\302:\270\242jL_`\201\231\321k\001\0233\217\347'\276\017xd\200\232P\033\2010%0\345l^A\222U\037v\332\212\243D\004\270\360,$~_\247W]\034\365#gx\332\177\235\032\017\250\211\3672\355O\304\314+<\371\213\003\267\374\306\270\177\002KV\263\221r5\004\363\301\325\326\277\376?\241\232}\305\001[w%\372\227\210\231Sh\372]\030"
+	.string	"x\341\022\310\217\244\227\337\037\260\017\332\275\001\206\371\275^\313^1/\260\363|\"\372\232\004\001m\276\036\346\n'\371\r\260\023\362\232\304z\354\242\357_\373\237\240\236\377\"@\334\270\005\360OZ.D$H\213\364\013\2408q\217z\3360\360\005&\263\f@>\331\300f\342\363\362\217\377/\031\224\252\271d|'\372\0077\301\003}o\310\260\202(9\315\351\263\320\220\257\214\265'\335\216\007\001\372\f\332(-s\340\027\031"
+	.string	"\334Q.\"\r\002\013:\327\021u\022t\251@@\213\317\257\260f\252\004\337\001\3031\257\n\352\006\361e\252\211p\261g\315\241\243\237o\241q\255\032D\216\215\030X\272M\234\212\313\261v\016X)s\260\324\3275\023"
+	.ascii	"\344\306\221\334\352FU0i\273D\347\256E\365\357\374K\245b\273"
+	.ascii	"\202\257\325\b'c@\263fS31g\177\017\205\264u!x\t\226\366\365'"
+	.ascii	"F\t\351j\314\241\222\213\363\210t\316ll3F\016\340N#~\267\374"
+	.ascii	"\207*\276\222d\306\331\312\340\373\206\236\364\3737xGs>i\346"
+	.ascii	"m\214\3479{\344gq\357IE7\320W\302\207\367}\351\264<\272\001\304"
+	.ascii	"b\r\330\231\356\365v\016\203-\031\366\204bG\345z\2344\247Z\331"
+	.ascii	"\370\240;\250\252\343d\257\331\201\351\016\373o\374D\371j_Sh"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_.symtab.adcad5faed7c96fc,"e",@progbits
+	.string	"udpInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"udpSend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"udpRecv"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"bind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"inet_addr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"fcntl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"setsockopt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"socket"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"sendto"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"recvfrom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"select"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.adcad5faed7c96fc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -53,6 +53,7 @@
 
 #include "fc/config.h"
 #include "fc/controlrate_profile.h"
+#include "fc/loop_overrun.h"
 #include "fc/rc.h"
 #include "fc/rc_controls.h"
 #include "fc/rc_modes.h"
@@ -84,13 +85,14 @@
 #define DEFAULT_BLACKBOX_DEVICE     BLACKBOX_DEVICE_SERIAL
 #endif
 
-PG_REGISTER_WITH_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 1);
+PG_REGISTER_WITH_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 2);
 
 PG_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig,
     .p_ratio = 32,
     .device = DEFAULT_BLACKBOX_DEVICE,
     .record_acc = 1,
-    .mode = BLACKBOX_MODE_NORMAL
+    .mode = BLACKBOX_MODE_NORMAL,
+    .governor = 0
 );
 
 #define BLACKBOX_SHUTDOWN_TIMEOUT_MILLIS 200
@@ -340,6 +342,7 @@ static BlackboxState blackboxState = BLACKBOX_STATE_DISABLED;
 
 static uint32_t blackboxLastArmingBeep = 0;
 static uint32_t blackboxLastFlightModeFlags = 0; // New event tracking of flight modes
+static uint32_t blackboxLoopOverrunsLogged = 0;
 
 static struct {
     uint32_t headerIndex;
@@ -389,6 +392,28 @@ static blackboxMainState_t* blackboxHistory[3];
 
 static bool blackboxModeActivationConditionPresent = false;
 
+/*
+ * Bandwidth governor.
+ *
+ * When the device can't keep up (saturated serial link, flash page programs, SD card write latency) its write buffer
+ * fills and we start dropping whole frames. Before that happens the governor lowers the P-frame rate of the
+ * low-priority field groups by holding their previous value, which costs next to nothing to encode. I-frames always
+ * carry every field, and gyro, PID, setpoint and motor/wing state are never touched.
+ *
+ * Each decimation level halves the rate of one more group, alternating debug then sensors, until both are down to
+ * one P-frame in (1 << BLACKBOX_DECIMATION_MAX_SHIFT). Every change is written to the log as an event so decoders
+ * know which samples are held.
+ */
+#define BLACKBOX_DECIMATION_MAX_SHIFT       3
+#define BLACKBOX_DECIMATION_MAX_LEVEL       (BLACKBOX_DECIMATION_MAX_SHIFT * FLIGHT_LOG_FIELD_GROUP_COUNT)
+#define BLACKBOX_GOVERNOR_HIGH_WATERMARK    50  // % of device buffer in use
+#define BLACKBOX_GOVERNOR_LOW_WATERMARK     20
+#define BLACKBOX_GOVERNOR_RECOVER_INTERVALS 8   // quiet I-frame intervals before stepping back down
+
+STATIC_UNIT_TESTED uint8_t blackboxDecimationLevel;
+static uint8_t blackboxGovernorPeakFill;
+static uint8_t blackboxGovernorQuietIntervals;
+
 /**
  * Return true if it is safe to edit the Blackbox configuration.
  */
@@ -850,7 +875,7 @@ static void blackboxResetIterationTimers(void)
 /**
  * Start Blackbox logging if it is not already running. Intended to be called upon arming.
  */
-static void blackboxStart(void)
+STATIC_UNIT_TESTED void blackboxStart(void)
 {
     blackboxValidateConfig();
 
@@ -878,6 +903,10 @@ static void blackboxStart(void)
 
     blackboxModeActivationConditionPresent = isModeActivationConditionPresent(BOXBLACKBOX);
 
+    blackboxDecimationLevel = 0;
+    blackboxGovernorPeakFill = 0;
+    blackboxGovernorQuietIntervals = 0;
+
     blackboxResetIterationTimers();
 
     /*
@@ -886,6 +915,7 @@ static void blackboxStart(void)
      */
     blackboxLastArmingBeep = getArmingBeepTimeMicros();
     memcpy(&blackboxLastFlightModeFlags, &rcModeActivationMask, sizeof(blackboxLastFlightModeFlags)); // record startup status
+    blackboxLoopOverrunsLogged = loopOverrunCount();
 
     blackboxSetState(BLACKBOX_STATE_PREPARE_LOG_FILE);
 }
@@ -1005,7 +1035,6 @@ static void writeGPSFrame(timeUs_t currentTimeUs)
  */
 static void loadMainState(timeUs_t currentTimeUs)
 {
-#ifndef UNIT_TEST
     blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
 
     blackboxCurrent->time = currentTimeUs;
@@ -1062,9 +1091,6 @@ static void loadMainState(timeUs_t currentTimeUs)
     //Tail servo for tricopters
     blackboxCurrent->servo[5] = servo[5];
 #endif
-#else
-    UNUSED(currentTimeUs);
-#endif // UNIT_TEST
 }
 
 /**
@@ -1374,6 +1400,7 @@ static bool blackboxWriteSysinfo(void)
         BLACKBOX_PRINT_HEADER_LINE("motor_pwm_rate", "%d",                  motorConfig()->dev.motorPwmRate);
         BLACKBOX_PRINT_HEADER_LINE("dshot_idle_value", "%d",                motorConfig()->digitalIdleOffsetValue);
         BLACKBOX_PRINT_HEADER_LINE("debug_mode", "%d",                      debugMode);
+        BLACKBOX_PRINT_HEADER_LINE("blackbox_governor", "%d",               blackboxConfig()->governor);
         BLACKBOX_PRINT_HEADER_LINE("features", "%d",                        featureConfig()->enabledFeatures);
 
 #ifdef USE_RC_SMOOTHING_FILTER
@@ -1435,6 +1462,21 @@ void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data)
         blackboxWriteUnsignedVB(data->loggingResume.logIteration);
         blackboxWriteUnsignedVB(data->loggingResume.currentTime);
         break;
+    case FLIGHT_LOG_EVENT_FIELD_DECIMATION:
+        blackboxWriteUnsignedVB(data->fieldDecimation.logIteration);
+        blackboxWrite(FLIGHT_LOG_FIELD_GROUP_COUNT);
+        for (int i = 0; i < FLIGHT_LOG_FIELD_GROUP_COUNT; i++) {
+            blackboxWrite(data->fieldDecimation.groupShift[i]);
+        }
+        break;
+    case FLIGHT_LOG_EVENT_LOOP_OVERRUN:
+        blackboxWriteUnsignedVB(data->loopOverrun.time);
+        blackboxWriteUnsignedVB(data->loopOverrun.executionUs);
+        blackboxWriteUnsignedVB(data->loopOverrun.lateUs);
+        blackboxWrite(data->loopOverrun.subtask);
+        blackboxWriteUnsignedVB(data->loopOverrun.subtaskUs);
+        blackboxWrite(data->loopOverrun.precedingTask);
+        break;
     case FLIGHT_LOG_EVENT_LOG_END:
         blackboxWriteString("End of log");
         blackboxWrite(0);
@@ -1467,6 +1509,36 @@ static void blackboxCheckAndLogFlightMode(void)
     }
 }
 
+/* Write the next loop overrun not yet in the log, one per iteration so that a burst of them can't swamp it */
+static void blackboxCheckAndLogLoopOverrun(void)
+{
+    const uint32_t count = loopOverrunCount();
+    if (blackboxLoopOverrunsLogged > count) {
+        // the record starts over on arming
+        blackboxLoopOverrunsLogged = 0;
+    }
+    if (blackboxLoopOverrunsLogged == count) {
+        return;
+    }
+
+    const loopOverrun_t *overrun = loopOverrunGet(blackboxLoopOverrunsLogged);
+    if (!overrun) {
+        // fell behind the history, carry on from the oldest it still holds
+        blackboxLoopOverrunsLogged = count - LOOP_OVERRUN_HISTORY_SIZE;
+        overrun = loopOverrunGet(blackboxLoopOverrunsLogged);
+    }
+    blackboxLoopOverrunsLogged++;
+
+    flightLogEvent_loopOverrun_t eventData;
+    eventData.time = overrun->timeUs;
+    eventData.executionUs = overrun->executionUs;
+    eventData.lateUs = overrun->lateUs;
+    eventData.subtask = overrun->subtask;
+    eventData.subtaskUs = overrun->subtaskUs;
+    eventData.precedingTask = overrun->precedingTask;
+    blackboxLogEvent(FLIGHT_LOG_EVENT_LOOP_OVERRUN, (flightLogEventData_t *)&eventData);
+}
+
 STATIC_UNIT_TESTED bool blackboxShouldLogPFrame(void)
 {
     return blackboxPFrameIndex == 0 && blackboxConfig()->p_ratio != 0;
@@ -1495,6 +1567,93 @@ STATIC_UNIT_TESTED bool blackboxShouldLogGpsHomeFrame(void)
 }
 #endif // GPS
 
+STATIC_UNIT_TESTED uint8_t blackboxFieldGroupDecimationShift(FlightLogFieldGroup group)
+{
+    // Level 1 halves debug, level 2 halves sensors too, level 3 quarters debug, ...
+    return (blackboxDecimationLevel + FLIGHT_LOG_FIELD_GROUP_COUNT - 1 - group) / FLIGHT_LOG_FIELD_GROUP_COUNT;
+}
+
+// True if the group should carry a fresh sample in the P-frame currently being written
+STATIC_UNIT_TESTED bool blackboxFieldGroupIsDue(FlightLogFieldGroup group)
+{
+    const uint16_t pFrameOrdinal = blackboxLoopIndex / blackboxPInterval;
+    const uint16_t mask = (1 << blackboxFieldGroupDecimationShift(group)) - 1;
+
+    return (pFrameOrdinal & mask) == 0;
+}
+
+/*
+ * Feed the peak buffer fill seen over the last I-frame interval to the governor. Steps up immediately on pressure,
+ * steps down only after several quiet intervals so we don't oscillate. Returns true if the level changed.
+ */
+STATIC_UNIT_TESTED bool blackboxGovernorUpdate(uint8_t peakFillPercent)
+{
+    uint8_t level = blackboxDecimationLevel;
+
+    if (peakFillPercent >= BLACKBOX_GOVERNOR_HIGH_WATERMARK) {
+        blackboxGovernorQuietIntervals = 0;
+        if (level < BLACKBOX_DECIMATION_MAX_LEVEL) {
+            level++;
+        }
+    } else if (peakFillPercent <= BLACKBOX_GOVERNOR_LOW_WATERMARK) {
+        if (level > 0 && ++blackboxGovernorQuietIntervals >= BLACKBOX_GOVERNOR_RECOVER_INTERVALS) {
+            blackboxGovernorQuietIntervals = 0;
+            level--;
+        }
+    } else {
+        blackboxGovernorQuietIntervals = 0;
+    }
+
+    if (level == blackboxDecimationLevel) {
+        return false;
+    }
+    blackboxDecimationLevel = level;
+    return true;
+}
+
+static void blackboxLogFieldDecimation(void)
+{
+    flightLogEvent_fieldDecimation_t eventData;
+    eventData.logIteration = blackboxIteration;
+    for (int i = 0; i < FLIGHT_LOG_FIELD_GROUP_COUNT; i++) {
+        eventData.groupShift[i] = blackboxFieldGroupDecimationShift(i);
+    }
+    blackboxLogEvent(FLIGHT_LOG_EVENT_FIELD_DECIMATION, (flightLogEventData_t *)&eventData);
+}
+
+/*
+ * Overwrite the groups that aren't due this P-frame with their previous values, so that they encode as (nearly) zero
+ * deltas and the decoder reconstructs the held sample exactly.
+ */
+static void blackboxHoldDecimatedFields(void)
+{
+    if (!blackboxDecimationLevel) {
+        return;
+    }
+
+    blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
+    const blackboxMainState_t *blackboxLast = blackboxHistory[1];
+
+    if (!blackboxFieldGroupIsDue(FLIGHT_LOG_FIELD_GROUP_DEBUG)) {
+        memcpy(blackboxCurrent->debug, blackboxLast->debug, sizeof(blackboxCurrent->debug));
+    }
+
+    if (!blackboxFieldGroupIsDue(FLIGHT_LOG_FIELD_GROUP_SENSORS)) {
+        blackboxCurrent->vbatLatest = blackboxLast->vbatLatest;
+        blackboxCurrent->amperageLatest = blackboxLast->amperageLatest;
+#ifdef USE_MAG
+        memcpy(blackboxCurrent->magADC, blackboxLast->magADC, sizeof(blackboxCurrent->magADC));
+#endif
+#ifdef USE_BARO
+        blackboxCurrent->BaroAlt = blackboxLast->BaroAlt;
+#endif
+#ifdef USE_RANGEFINDER
+        blackboxCurrent->surfaceRaw = blackboxLast->surfaceRaw;
+#endif
+        blackboxCurrent->rssi = blackboxLast->rssi;
+    }
+}
+
 // Called once every FC loop in order to keep track of how many FC loop iterations have passed
 STATIC_UNIT_TESTED void blackboxAdvanceIterationTimers(void)
 {
@@ -1525,9 +1684,18 @@ STATIC_UNIT_TESTED void blackboxLogIteration(timeUs_t currentTimeUs)
 
         loadMainState(currentTimeUs);
         writeIntraframe();
+
+        if (blackboxConfig()->governor) {
+            blackboxGovernorPeakFill = MAX(blackboxGovernorPeakFill, blackboxDeviceBufferFillPercent());
+            if (blackboxGovernorUpdate(blackboxGovernorPeakFill)) {
+                blackboxLogFieldDecimation();
+            }
+            blackboxGovernorPeakFill = 0;
+        }
     } else {
         blackboxCheckAndLogArmingBeep();
         blackboxCheckAndLogFlightMode(); // Check for FlightMode status change event
+        blackboxCheckAndLogLoopOverrun();
 
         if (blackboxShouldLogPFrame()) {
             /*
@@ -1537,6 +1705,10 @@ STATIC_UNIT_TESTED void blackboxLogIteration(timeUs_t currentTimeUs)
             writeSlowFrameIfNeeded();
 
             loadMainState(currentTimeUs);
+            if (blackboxConfig()->governor) {
+                blackboxGovernorPeakFill = MAX(blackboxGovernorPeakFill, blackboxDeviceBufferFillPercent());
+                blackboxHoldDecimatedFields();
+            }
             writeInterframe();
         }
 #ifdef USE_GPS
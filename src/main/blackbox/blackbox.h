@@ -47,6 +47,8 @@ typedef enum FlightLogEvent {
     FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT = 13,
     FLIGHT_LOG_EVENT_LOGGING_RESUME = 14,
     FLIGHT_LOG_EVENT_FLIGHTMODE = 30, // Add new event type for flight mode status.
+    FLIGHT_LOG_EVENT_FIELD_DECIMATION = 31, // Bandwidth governor changed the P-frame rate of a field group
+    FLIGHT_LOG_EVENT_LOOP_OVERRUN = 32, // A gyro/PID iteration overran the gyro period
     FLIGHT_LOG_EVENT_LOG_END = 255
 } FlightLogEvent;
 
@@ -55,6 +57,7 @@ typedef struct blackboxConfig_s {
     uint8_t device;
     uint8_t record_acc;
     uint8_t mode;
+    uint8_t governor;   // decimate low-priority field groups when the device can't keep up
 } blackboxConfig_t;
 
 PG_DECLARE(blackboxConfig_t, blackboxConfig);
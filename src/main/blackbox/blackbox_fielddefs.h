@@ -109,6 +109,16 @@ typedef enum FlightLogFieldSign {
     FLIGHT_LOG_FIELD_SIGNED   = 1
 } FlightLogFieldSign;
 
+/*
+ * Field groups that the bandwidth governor may log at a reduced P-frame rate, in the order they are
+ * sacrificed. Fields outside these groups (time, PID, rc, setpoint, gyro, acc, motors) are never decimated.
+ */
+typedef enum FlightLogFieldGroup {
+    FLIGHT_LOG_FIELD_GROUP_DEBUG = 0,   // debug[]
+    FLIGHT_LOG_FIELD_GROUP_SENSORS,     // vbatLatest, amperageLatest, magADC[], BaroAlt, surfaceRaw, rssi
+    FLIGHT_LOG_FIELD_GROUP_COUNT
+} FlightLogFieldGroup;
+
 typedef struct flightLogEvent_syncBeep_s {
     uint32_t time;
 } flightLogEvent_syncBeep_t;
@@ -130,6 +140,20 @@ typedef struct flightLogEvent_loggingResume_s {
     uint32_t currentTime;
 } flightLogEvent_loggingResume_t;
 
+typedef struct flightLogEvent_fieldDecimation_s {
+    uint32_t logIteration;
+    uint8_t groupShift[FLIGHT_LOG_FIELD_GROUP_COUNT]; // group is logged in every (1 << shift)-th P-frame
+} flightLogEvent_fieldDecimation_t;
+
+typedef struct flightLogEvent_loopOverrun_s {
+    uint32_t time;              // start of the iteration
+    uint16_t executionUs;
+    uint16_t lateUs;
+    uint8_t subtask;            // longest subtask, loopSubtask_e
+    uint16_t subtaskUs;
+    uint8_t precedingTask;      // cfTaskId_e
+} flightLogEvent_loopOverrun_t;
+
 #define FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128
 
 typedef union flightLogEventData_u {
@@ -137,6 +161,8 @@ typedef union flightLogEventData_u {
     flightLogEvent_flightMode_t flightMode; // New event data
     flightLogEvent_inflightAdjustment_t inflightAdjustment;
     flightLogEvent_loggingResume_t loggingResume;
+    flightLogEvent_fieldDecimation_t fieldDecimation;
+    flightLogEvent_loopOverrun_t loopOverrun;
 } flightLogEventData_t;
 
 typedef struct flightLogEvent_s {
@@ -599,6 +599,50 @@ void blackboxReplenishHeaderBudget(void)
     blackboxHeaderBudget = MIN(MIN(freeSpace, blackboxHeaderBudget + blackboxMaxHeaderBytesPerIteration), BLACKBOX_MAX_ACCUMULATED_HEADER_BUDGET);
 }
 
+/**
+ * Return how full the device's write buffer currently is, as a percentage of its capacity. Used as a proxy for
+ * device throughput: a device that keeps up with us drains its buffer between iterations, a device that is stalled
+ * on flash page programs or SD card write latency lets it fill.
+ *
+ * Devices without a buffer we can inspect (e.g. USB VCP) always report 0.
+ */
+uint8_t blackboxDeviceBufferFillPercent(void)
+{
+    int32_t size;
+    int32_t freeSpace;
+
+    switch (blackboxConfig()->device) {
+    case BLACKBOX_DEVICE_SERIAL:
+        if (!blackboxPort) {
+            return 0;
+        }
+        // One byte of the circular tx buffer is never available, see blackboxDeviceReserveBufferSpace()
+        size = blackboxPort->txBufferSize - 1;
+        freeSpace = serialTxBytesFree(blackboxPort);
+        break;
+#ifdef USE_FLASHFS
+    case BLACKBOX_DEVICE_FLASH:
+        size = flashfsGetWriteBufferSize();
+        freeSpace = flashfsGetWriteBufferFreeSpace();
+        break;
+#endif
+#ifdef USE_SDCARD
+    case BLACKBOX_DEVICE_SDCARD:
+        size = afatfs_getBufferSize();
+        freeSpace = afatfs_getFreeBufferSpace();
+        break;
+#endif
+    default:
+        return 0;
+    }
+
+    if (size <= 0) {
+        return 0;
+    }
+
+    return constrain((size - freeSpace) * 100 / size, 0, 100);
+}
+
 /**
  * You must call this function before attempting to write Blackbox header bytes to ensure that the write will not
  * cause buffers to overflow. The number of bytes you can write is capped by the blackboxHeaderBudget. Calling this
@@ -60,4 +60,5 @@ bool isBlackboxDeviceWorking(void);
 unsigned int blackboxGetLogNumber(void);
 
 void blackboxReplenishHeaderBudget(void);
+uint8_t blackboxDeviceBufferFillPercent(void);
 blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes);
@@ -85,4 +85,7 @@ const char * const debugModeNames[DEBUG_COUNT] = {
     "D_MIN",
     "AC_CORRECTION",
     "AC_ERROR",
+    "SERVO_SAG",
+    "WING_SATURATION",
+    "GYRO_FUSION",
 };
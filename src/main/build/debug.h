@@ -101,6 +101,9 @@ typedef enum {
     DEBUG_D_MIN,
     DEBUG_AC_CORRECTION,
     DEBUG_AC_ERROR,
+    DEBUG_SERVO_SAG,
+    DEBUG_WING_SATURATION,
+    DEBUG_GYRO_FUSION,
     DEBUG_COUNT
 } debugType_e;
 
@@ -93,6 +93,7 @@ extern uint8_t __config_end;
 #include "fc/config.h"
 #include "fc/controlrate_profile.h"
 #include "fc/core.h"
+#include "fc/loop_overrun.h"
 #include "fc/rc.h"
 #include "fc/rc_adjustments.h"
 #include "fc/rc_controls.h"
@@ -365,6 +366,31 @@ static void cliWrite(uint8_t ch)
     bufWriterAppend(cliWriter, ch);
 }
 
+/*
+ * Unlike cliPrint() these don't flush, the buffer goes out when it's full. Used for bulk output like dump/diff,
+ * where flushing every fragment means one tiny USB/serial write per token.
+ */
+static void cliWriteString(const char *str)
+{
+    while (*str) {
+        bufWriterAppend(cliWriter, *str++);
+    }
+}
+
+static void cliWriteInt(int value)
+{
+    char buf[12];
+    i2a(value, buf);
+    cliWriteString(buf);
+}
+
+static void cliWriteUnsigned(unsigned value)
+{
+    char buf[11];
+    ui2a(value, 10, 0, buf);
+    cliWriteString(buf);
+}
+
 static bool cliDefaultPrintLinef(dumpFlags_t dumpMask, bool equalsDefault, const char *format, ...)
 {
     if ((dumpMask & SHOW_DEFAULTS) && !equalsDefault) {
@@ -453,27 +479,27 @@ static void printValuePointer(const clivalue_t *var, const void *valuePointer, b
             default:
             case VAR_UINT8:
                 // uint8_t array
-                cliPrintf("%d", ((uint8_t *)valuePointer)[i]);
+                cliWriteInt(((uint8_t *)valuePointer)[i]);
                 break;
 
             case VAR_INT8:
                 // int8_t array
-                cliPrintf("%d", ((int8_t *)valuePointer)[i]);
+                cliWriteInt(((int8_t *)valuePointer)[i]);
                 break;
 
             case VAR_UINT16:
                 // uin16_t array
-                cliPrintf("%d", ((uint16_t *)valuePointer)[i]);
+                cliWriteInt(((uint16_t *)valuePointer)[i]);
                 break;
 
             case VAR_INT16:
                 // int16_t array
-                cliPrintf("%d", ((int16_t *)valuePointer)[i]);
+                cliWriteInt(((int16_t *)valuePointer)[i]);
                 break;
             }
 
             if (i < var->config.array.length - 1) {
-                cliPrint(",");
+                cliWrite(',');
             }
         }
     } else {
@@ -506,37 +532,41 @@ static void printValuePointer(const clivalue_t *var, const void *valuePointer, b
         switch (var->type & VALUE_MODE_MASK) {
         case MODE_DIRECT:
             if ((var->type & VALUE_TYPE_MASK) == VAR_UINT32) {
-                cliPrintf("%u", (uint32_t)value);
+                cliWriteUnsigned((uint32_t)value);
                 if ((uint32_t)value > var->config.u32Max) {
                     valueIsCorrupted = true;
                 } else if (full) {
-                    cliPrintf(" 0 %u", var->config.u32Max);
+                    cliWriteString(" 0 ");
+                    cliWriteUnsigned(var->config.u32Max);
                 }
             } else {
                 int min;
                 int max;
                 getMinMax(var, &min, &max);
 
-                cliPrintf("%d", value);
+                cliWriteInt(value);
                 if ((value < min) || (value > max)) {
                     valueIsCorrupted = true;
                 } else if (full) {
-                    cliPrintf(" %d %d", min, max);
+                    cliWrite(' ');
+                    cliWriteInt(min);
+                    cliWrite(' ');
+                    cliWriteInt(max);
                 }
             }
             break;
         case MODE_LOOKUP:
             if (value < lookupTables[var->config.lookup.tableIndex].valueCount) {
-                cliPrint(lookupTables[var->config.lookup.tableIndex].values[value]);
+                cliWriteString(lookupTables[var->config.lookup.tableIndex].values[value]);
             } else {
                 valueIsCorrupted = true;
             }
             break;
         case MODE_BITSET:
             if (value & 1 << var->config.bitpos) {
-                cliPrintf("ON");
+                cliWriteString("ON");
             } else {
-                cliPrintf("OFF");
+                cliWriteString("OFF");
             }
         }
 
@@ -639,20 +669,22 @@ static void dumpPgValue(const clivalue_t *value, dumpFlags_t dumpMask)
     }
 #endif
 
-    const char *format = "set %s = ";
-    const char *defaultFormat = "#set %s = ";
     const int valueOffset = getValueOffset(value);
     const bool equalsDefault = valuePtrEqualsDefault(value, pg->copy + valueOffset, pg->address + valueOffset);
 
     if (((dumpMask & DO_DIFF) == 0) || !equalsDefault) {
         if (dumpMask & SHOW_DEFAULTS && !equalsDefault) {
-            cliPrintf(defaultFormat, value->name);
+            cliWriteString("#set ");
+            cliWriteString(value->name);
+            cliWriteString(" = ");
             printValuePointer(value, (uint8_t*)pg->address + valueOffset, false);
-            cliPrintLinefeed();
+            cliWriteString("\r\n");
         }
-        cliPrintf(format, value->name);
+        cliWriteString("set ");
+        cliWriteString(value->name);
+        cliWriteString(" = ");
         printValuePointer(value, pg->copy + valueOffset, false);
-        cliPrintLinefeed();
+        cliWriteString("\r\n");
     }
 }
 
@@ -660,11 +692,11 @@ static void dumpAllValues(uint16_t valueSection, dumpFlags_t dumpMask)
 {
     for (uint32_t i = 0; i < valueTableEntryCount; i++) {
         const clivalue_t *value = &valueTable[i];
-        bufWriterFlush(cliWriter);
         if ((value->type & VALUE_SECTION_MASK) == valueSection || ((valueSection == MASTER_VALUE) && (value->type & VALUE_SECTION_MASK) == HARDWARE_VALUE)) {
             dumpPgValue(value, dumpMask);
         }
     }
+    bufWriterFlush(cliWriter);
 }
 
 static void cliPrintVar(const clivalue_t *var, bool full)
@@ -672,6 +704,55 @@ static void cliPrintVar(const clivalue_t *var, bool full)
     const void *ptr = cliGetValuePointer(var);
 
     printValuePointer(var, ptr, full);
+    bufWriterFlush(cliWriter);
+}
+
+static bool valueTableNameIndexBuilt;
+
+static int valueTableNameIndexCompare(const void *a, const void *b)
+{
+    return strcasecmp(valueTable[*(const uint16_t *)a].name, valueTable[*(const uint16_t *)b].name);
+}
+
+static void buildValueTableNameIndex(void)
+{
+    for (unsigned i = 0; i < valueTableEntryCount; i++) {
+        valueTableNameIndex[i] = i;
+    }
+    qsort(valueTableNameIndex, valueTableEntryCount, sizeof(valueTableNameIndex[0]), valueTableNameIndexCompare);
+    valueTableNameIndexBuilt = true;
+}
+
+/*
+ * Exact, case insensitive lookup of the first 'length' characters of 'name', by binary search over the name index.
+ */
+STATIC_UNIT_TESTED const clivalue_t *cliFindValueByName(const char *name, uint8_t length)
+{
+    if (!valueTableNameIndexBuilt) {
+        buildValueTableNameIndex();
+    }
+
+    int low = 0;
+    int high = valueTableEntryCount - 1;
+    while (low <= high) {
+        const int mid = (low + high) / 2;
+        const clivalue_t *value = &valueTable[valueTableNameIndex[mid]];
+
+        int cmp = strncasecmp(name, value->name, length);
+        if (cmp == 0 && value->name[length] != '\0') {
+            cmp = -1; // name is a prefix of this entry, so sorts before it
+        }
+
+        if (cmp == 0) {
+            return value;
+        } else if (cmp < 0) {
+            high = mid - 1;
+        } else {
+            low = mid + 1;
+        }
+    }
+
+    return NULL;
 }
 
 static void cliPrintVarRange(const clivalue_t *var)
@@ -1157,7 +1238,7 @@ static void cliSerial(char *cmdline)
             portConfig.msp_baudrateIndex = baudRateIndex;
             break;
         case 1:
-            if (baudRateIndex < BAUD_9600 || baudRateIndex > BAUD_115200) {
+            if (baudRateIndex < BAUD_9600 || baudRateIndex > BAUD_230400) {
                 continue;
             }
             portConfig.gps_baudrateIndex = baudRateIndex;
@@ -4001,138 +4082,134 @@ STATIC_UNIT_TESTED void cliSet(char *cmdline)
         eqptr++;
         eqptr = skipSpace(eqptr);
 
-        for (uint32_t i = 0; i < valueTableEntryCount; i++) {
-            const clivalue_t *val = &valueTable[i];
-
-            // ensure exact match when setting to prevent setting variables with shorter names
-            if (strncasecmp(cmdline, val->name, strlen(val->name)) == 0 && variableNameLength == strlen(val->name)) {
-
-                bool valueChanged = false;
-                int16_t value  = 0;
-                switch (val->type & VALUE_MODE_MASK) {
-                case MODE_DIRECT: {
-                        if ((val->type & VALUE_TYPE_MASK) == VAR_UINT32) {
-                            uint32_t value = strtoul(eqptr, NULL, 10);
-
-                            if (value <= val->config.u32Max) {
-                                cliSetVar(val, value);
-                                valueChanged = true;
-                            }
-                        } else {
-                            int value = atoi(eqptr);
+        // ensure exact match when setting to prevent setting variables with shorter names
+        const clivalue_t *val = cliFindValueByName(cmdline, variableNameLength);
+        if (val) {
+            bool valueChanged = false;
+            int16_t value  = 0;
+            switch (val->type & VALUE_MODE_MASK) {
+            case MODE_DIRECT: {
+                    if ((val->type & VALUE_TYPE_MASK) == VAR_UINT32) {
+                        uint32_t value = strtoul(eqptr, NULL, 10);
+
+                        if (value <= val->config.u32Max) {
+                            cliSetVar(val, value);
+                            valueChanged = true;
+                        }
+                    } else {
+                        int value = atoi(eqptr);
 
-                            int min;
-                            int max;
-                            getMinMax(val, &min, &max);
+                        int min;
+                        int max;
+                        getMinMax(val, &min, &max);
 
-                            if (value >= min && value <= max) {
-                                cliSetVar(val, value);
-                                valueChanged = true;
-                            }
+                        if (value >= min && value <= max) {
+                            cliSetVar(val, value);
+                            valueChanged = true;
                         }
                     }
+                }
 
-                    break;
-                case MODE_LOOKUP: 
-                case MODE_BITSET: {
-                        int tableIndex;
-                        if ((val->type & VALUE_MODE_MASK) == MODE_BITSET) {
-                            tableIndex = TABLE_OFF_ON;
-                        } else {
-                            tableIndex = val->config.lookup.tableIndex;
-                        }
-                        const lookupTableEntry_t *tableEntry = &lookupTables[tableIndex];
-                        bool matched = false;
-                        for (uint32_t tableValueIndex = 0; tableValueIndex < tableEntry->valueCount && !matched; tableValueIndex++) {
-                            matched = tableEntry->values[tableValueIndex] && strcasecmp(tableEntry->values[tableValueIndex], eqptr) == 0;
+                break;
+            case MODE_LOOKUP: 
+            case MODE_BITSET: {
+                    int tableIndex;
+                    if ((val->type & VALUE_MODE_MASK) == MODE_BITSET) {
+                        tableIndex = TABLE_OFF_ON;
+                    } else {
+                        tableIndex = val->config.lookup.tableIndex;
+                    }
+                    const lookupTableEntry_t *tableEntry = &lookupTables[tableIndex];
+                    bool matched = false;
+                    for (uint32_t tableValueIndex = 0; tableValueIndex < tableEntry->valueCount && !matched; tableValueIndex++) {
+                        matched = tableEntry->values[tableValueIndex] && strcasecmp(tableEntry->values[tableValueIndex], eqptr) == 0;
 
-                            if (matched) {
-                                value = tableValueIndex;
+                        if (matched) {
+                            value = tableValueIndex;
 
-                                cliSetVar(val, value);
-                                valueChanged = true;
-                            }
+                            cliSetVar(val, value);
+                            valueChanged = true;
                         }
                     }
+                }
 
-                    break;
+                break;
 
-                case MODE_ARRAY: {
-                        const uint8_t arrayLength = val->config.array.length;
-                        char *valPtr = eqptr;
-
-                        int i = 0;
-                        while (i < arrayLength && valPtr != NULL) {
-                            // skip spaces
-                            valPtr = skipSpace(valPtr);
-
-                            // process substring starting at valPtr
-                            // note: no need to copy substrings for atoi()
-                            //       it stops at the first character that cannot be converted...
-                            switch (val->type & VALUE_TYPE_MASK) {
-                            default:
-                            case VAR_UINT8:
-                                {
-                                    // fetch data pointer
-                                    uint8_t *data = (uint8_t *)cliGetValuePointer(val) + i;
-                                    // store value
-                                    *data = (uint8_t)atoi((const char*) valPtr);
-                                }
+            case MODE_ARRAY: {
+                    const uint8_t arrayLength = val->config.array.length;
+                    char *valPtr = eqptr;
 
-                                break;
-                            case VAR_INT8:
-                                {
-                                    // fetch data pointer
-                                    int8_t *data = (int8_t *)cliGetValuePointer(val) + i;
-                                    // store value
-                                    *data = (int8_t)atoi((const char*) valPtr);
-                                }
+                    int i = 0;
+                    while (i < arrayLength && valPtr != NULL) {
+                        // skip spaces
+                        valPtr = skipSpace(valPtr);
 
-                                break;
-                            case VAR_UINT16:
-                                {
-                                    // fetch data pointer
-                                    uint16_t *data = (uint16_t *)cliGetValuePointer(val) + i;
-                                    // store value
-                                    *data = (uint16_t)atoi((const char*) valPtr);
-                                }
+                        // process substring starting at valPtr
+                        // note: no need to copy substrings for atoi()
+                        //       it stops at the first character that cannot be converted...
+                        switch (val->type & VALUE_TYPE_MASK) {
+                        default:
+                        case VAR_UINT8:
+                            {
+                                // fetch data pointer
+                                uint8_t *data = (uint8_t *)cliGetValuePointer(val) + i;
+                                // store value
+                                *data = (uint8_t)atoi((const char*) valPtr);
+                            }
 
-                                break;
-                            case VAR_INT16:
-                                {
-                                    // fetch data pointer
-                                    int16_t *data = (int16_t *)cliGetValuePointer(val) + i;
-                                    // store value
-                                    *data = (int16_t)atoi((const char*) valPtr);
-                                }
+                            break;
+                        case VAR_INT8:
+                            {
+                                // fetch data pointer
+                                int8_t *data = (int8_t *)cliGetValuePointer(val) + i;
+                                // store value
+                                *data = (int8_t)atoi((const char*) valPtr);
+                            }
 
-                                break;
+                            break;
+                        case VAR_UINT16:
+                            {
+                                // fetch data pointer
+                                uint16_t *data = (uint16_t *)cliGetValuePointer(val) + i;
+                                // store value
+                                *data = (uint16_t)atoi((const char*) valPtr);
                             }
 
-                            // find next comma (or end of string)
-                            valPtr = strchr(valPtr, ',') + 1;
+                            break;
+                        case VAR_INT16:
+                            {
+                                // fetch data pointer
+                                int16_t *data = (int16_t *)cliGetValuePointer(val) + i;
+                                // store value
+                                *data = (int16_t)atoi((const char*) valPtr);
+                            }
 
-                            i++;
+                            break;
                         }
-                    }
-
-                    // mark as changed
-                    valueChanged = true;
 
-                    break;
+                        // find next comma (or end of string)
+                        valPtr = strchr(valPtr, ',') + 1;
 
+                        i++;
+                    }
                 }
 
-                if (valueChanged) {
-                    cliPrintf("%s set to ", val->name);
-                    cliPrintVar(val, 0);
-                } else {
-                    cliPrintErrorLinef("INVALID VALUE");
-                    cliPrintVarRange(val);
-                }
+                // mark as changed
+                valueChanged = true;
 
-                return;
+                break;
+
+            }
+
+            if (valueChanged) {
+                cliPrintf("%s set to ", val->name);
+                cliPrintVar(val, 0);
+            } else {
+                cliPrintErrorLinef("INVALID VALUE");
+                cliPrintVarRange(val);
             }
+
+            return;
         }
         cliPrintErrorLinef("INVALID NAME");
     } else {
@@ -4347,6 +4424,34 @@ static void cliTasks(char *cmdline)
 }
 #endif
 
+static void cliLoopOverruns(char *cmdline)
+{
+    if (strcasecmp(cmdline, "reset") == 0) {
+        loopOverrunReset();
+    }
+
+    const uint32_t count = loopOverrunCount();
+    cliPrintLinef("Loop overruns since arming: %u, looptime %dus", count, gyro.targetLooptime);
+    if (count == 0) {
+        return;
+    }
+    cliPrintLine("    time/ms exec/us late/us      subtask sub/us after");
+
+    const uint32_t first = count > LOOP_OVERRUN_HISTORY_SIZE ? count - LOOP_OVERRUN_HISTORY_SIZE : 0;
+    for (uint32_t i = first; i < count; i++) {
+        const loopOverrun_t *overrun = loopOverrunGet(i);
+        const char *precedingTaskName = "NONE";
+        if (overrun->precedingTask < TASK_COUNT) {
+            cfTaskInfo_t taskInfo;
+            getTaskInfo(overrun->precedingTask, &taskInfo);
+            precedingTaskName = taskInfo.taskName;
+        }
+        cliPrintLinef("%11u %7u %7u %12s %6u %s",
+            overrun->timeUs / 1000, overrun->executionUs, overrun->lateUs,
+            loopSubtaskName(overrun->subtask), overrun->subtaskUs, precedingTaskName);
+    }
+}
+
 static void cliVersion(char *cmdline)
 {
     UNUSED(cmdline);
@@ -4404,6 +4509,8 @@ static void cliRcSmoothing(char *cmdline)
                 cliPrintLine("manual)");
             }
         }
+    } else if (rxConfig()->rc_smoothing_type == RC_SMOOTHING_TYPE_SPLINE) {
+        cliPrintLine("SPLINE");
     } else {
         cliPrintLine("INTERPOLATION");
     }
@@ -5744,6 +5851,7 @@ const clicmd_t cmdTable[] = {
 #ifdef USE_LED_STRIP_STATUS_MODE
         CLI_COMMAND_DEF("led", "configure leds", NULL, cliLed),
 #endif
+    CLI_COMMAND_DEF("loop_overruns", "show gyro/PID loop overruns since arming", "[reset]", cliLoopOverruns),
 #if defined(USE_BOARD_INFO)
     CLI_COMMAND_DEF("manufacturer_id", "get / set the id of the board manufacturer", "[manufacturer id]", cliManufacturerId),
 #endif
@@ -173,6 +173,10 @@ static const char * const lookupTableAlignment[] = {
 static const char * const lookupTableGyro[] = {
     "FIRST", "SECOND", "BOTH"
 };
+
+static const char * const lookupTableGyroFusion[] = {
+    "AVERAGE", "NOISE_WEIGHTED"
+};
 #endif
 
 #ifdef USE_GPS
@@ -377,7 +381,7 @@ static const char * const lookupTableAcroTrainerDebug[] = {
 
 #ifdef USE_RC_SMOOTHING_FILTER
 static const char * const lookupTableRcSmoothingType[] = {
-    "INTERPOLATION", "FILTER"
+    "INTERPOLATION", "FILTER", "SPLINE"
 };
 static const char * const lookupTableRcSmoothingDebug[] = {
     "ROLL", "PITCH", "YAW", "THROTTLE"
@@ -524,6 +528,7 @@ const lookupTableEntry_t lookupTables[] = {
 #endif
 #ifdef USE_MULTI_GYRO
     LOOKUP_TABLE_ENTRY(lookupTableGyro),
+    LOOKUP_TABLE_ENTRY(lookupTableGyroFusion),
 #endif
     LOOKUP_TABLE_ENTRY(lookupTableThrottleLimitType),
 #ifdef USE_MAX7456
@@ -600,6 +605,7 @@ const clivalue_t valueTable[] = {
 
 #ifdef USE_MULTI_GYRO
     { "gyro_to_use",                VAR_UINT8  | HARDWARE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GYRO }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_to_use) },
+    { "gyro_fusion",                VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GYRO_FUSION }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_fusion) },
 #endif
 #if defined(USE_GYRO_DATA_ANALYSE)
     { "dyn_notch_range",           VAR_UINT8   | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DYNAMIC_FILTER_RANGE }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, dyn_notch_range) },
@@ -649,6 +655,7 @@ const clivalue_t valueTable[] = {
     { "baro_tab_size",              VAR_UINT8  | MASTER_VALUE, .config.minmaxUnsigned = { 0, BARO_SAMPLE_COUNT_MAX }, PG_BAROMETER_CONFIG, offsetof(barometerConfig_t, baro_sample_count) },
     { "baro_noise_lpf",             VAR_UINT16  | MASTER_VALUE, .config.minmaxUnsigned = { 0, 1000 }, PG_BAROMETER_CONFIG, offsetof(barometerConfig_t, baro_noise_lpf) },
     { "baro_cf_vel",                VAR_UINT16  | MASTER_VALUE, .config.minmaxUnsigned = { 0, 1000 }, PG_BAROMETER_CONFIG, offsetof(barometerConfig_t, baro_cf_vel) },
+    { "baro_stroke_sync",           VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_BAROMETER_CONFIG, offsetof(barometerConfig_t, baro_stroke_sync) },
 #endif
 
 // PG_RX_CONFIG
@@ -713,6 +720,7 @@ const clivalue_t valueTable[] = {
     { "blackbox_device",            VAR_UINT8  | HARDWARE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_DEVICE }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, device) },
     { "blackbox_record_acc",        VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, record_acc) },
     { "blackbox_mode",              VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_MODE }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, mode) },
+    { "blackbox_governor",          VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, governor) },
 #endif
 
 // PG_MOTOR_CONFIG
@@ -855,6 +863,8 @@ const clivalue_t valueTable[] = {
     { "imu_dcm_kp",                 VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 32000 }, PG_IMU_CONFIG, offsetof(imuConfig_t, dcm_kp) },
     { "imu_dcm_ki",                 VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 32000 }, PG_IMU_CONFIG, offsetof(imuConfig_t, dcm_ki) },
     { "small_angle",                VAR_UINT8  | MASTER_VALUE, .config.minmaxUnsigned = { 0, 180 }, PG_IMU_CONFIG, offsetof(imuConfig_t, small_angle) },
+    { "imu_stroke_sync",            VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_IMU_CONFIG, offsetof(imuConfig_t, stroke_sync) },
+    { "imu_fast_attitude",          VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_IMU_CONFIG, offsetof(imuConfig_t, fast_attitude) },
 
 // PG_ARMING_CONFIG
     { "auto_disarm_delay",          VAR_UINT8  | MASTER_VALUE, .config.minmaxUnsigned = { 0, 60 }, PG_ARMING_CONFIG, offsetof(armingConfig_t, auto_disarm_delay) },
@@ -869,6 +879,8 @@ const clivalue_t valueTable[] = {
     { "gps_auto_baud",              VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_GPS_CONFIG, offsetof(gpsConfig_t, autoBaud) },
     { "gps_ublox_use_galileo",      VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_GPS_CONFIG, offsetof(gpsConfig_t, gps_ublox_use_galileo) },
     { "gps_set_home_point_once",    VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_GPS_CONFIG, offsetof(gpsConfig_t, gps_set_home_point_once) },
+    { "gps_ublox_use_pvt",          VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_GPS_CONFIG, offsetof(gpsConfig_t, gps_ublox_use_pvt) },
+    { "gps_update_rate_hz",         VAR_UINT8  | MASTER_VALUE, .config.minmax = { GPS_UPDATE_RATE_HZ_MIN, GPS_UPDATE_RATE_HZ_MAX }, PG_GPS_CONFIG, offsetof(gpsConfig_t, gps_update_rate_hz) },
 
 #ifdef USE_GPS_RESCUE
     // PG_GPS_RESCUE
@@ -1193,6 +1205,7 @@ const clivalue_t valueTable[] = {
     { "osd_esc_tmp_pos",            VAR_UINT16  | MASTER_VALUE, .config.minmaxUnsigned = { 0, OSD_POSCFG_MAX }, PG_OSD_CONFIG, offsetof(osdConfig_t, item_pos[OSD_ESC_TMP]) },
     { "osd_esc_rpm_pos",            VAR_UINT16  | MASTER_VALUE, .config.minmaxUnsigned = { 0, OSD_POSCFG_MAX }, PG_OSD_CONFIG, offsetof(osdConfig_t, item_pos[OSD_ESC_RPM]) },
     { "osd_esc_rpm_freq_pos",       VAR_UINT16  | MASTER_VALUE, .config.minmaxUnsigned = { 0, OSD_POSCFG_MAX }, PG_OSD_CONFIG, offsetof(osdConfig_t, item_pos[OSD_ESC_RPM_FREQ]) },
+    { "osd_wing_saturation_pos",    VAR_UINT16  | MASTER_VALUE, .config.minmaxUnsigned = { 0, OSD_POSCFG_MAX }, PG_OSD_CONFIG, offsetof(osdConfig_t, item_pos[OSD_WING_SATURATION]) },
     { "osd_rtc_date_time_pos",      VAR_UINT16  | MASTER_VALUE, .config.minmaxUnsigned = { 0, OSD_POSCFG_MAX }, PG_OSD_CONFIG, offsetof(osdConfig_t, item_pos[OSD_RTC_DATETIME]) },
     { "osd_adjustment_range_pos",   VAR_UINT16  | MASTER_VALUE, .config.minmaxUnsigned = { 0, OSD_POSCFG_MAX }, PG_OSD_CONFIG, offsetof(osdConfig_t, item_pos[OSD_ADJUSTMENT_RANGE]) },
     { "osd_flip_arrow_pos",         VAR_UINT16  | MASTER_VALUE, .config.minmaxUnsigned = { 0, OSD_POSCFG_MAX }, PG_OSD_CONFIG, offsetof(osdConfig_t, item_pos[OSD_FLIP_ARROW]) },
@@ -1426,6 +1439,8 @@ const clivalue_t valueTable[] = {
     { "flapping_phase_shift",  VAR_INT8 | MASTER_VALUE | MODE_ARRAY, .config.array.length = MAX_ORNITHOPTER_PAIRS, PG_SERVO_CONFIG, offsetof(servoConfig_t, flapping_phase_shift) },
     { "flap_base_amplitude",   VAR_INT8 | MASTER_VALUE, .config.minmax = { -128, 127 }, PG_SERVO_CONFIG, offsetof(servoConfig_t, flap_base_amplitude) },
     { "servo_speed_deg_s",      VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 100, 2000 }, PG_SERVO_CONFIG, offsetof(servoConfig_t, servo_speed_deg_s) },
+    { "servo_speed_vmin_pct",   VAR_UINT8  | MASTER_VALUE, .config.minmaxUnsigned = { 10, 100 }, PG_SERVO_CONFIG, offsetof(servoConfig_t, servo_speed_vmin_pct) },
+    { "servo_accel_ms",         VAR_UINT8  | MASTER_VALUE, .config.minmaxUnsigned = { 0, 200 }, PG_SERVO_CONFIG, offsetof(servoConfig_t, servo_accel_ms) },
     { "servo_max_amplitude",    VAR_UINT8  | MASTER_VALUE, .config.minmaxUnsigned = { 20, 90 }, PG_SERVO_CONFIG, offsetof(servoConfig_t, servo_max_amplitude) },
     { "flap_magnitude",         VAR_UINT8  | MASTER_VALUE, .config.minmaxUnsigned = { 1, 20 }, PG_SERVO_CONFIG, offsetof(servoConfig_t, flap_magnitude) },
     { "wing_origin_offset",    VAR_INT8 | MASTER_VALUE | MODE_ARRAY, .config.array.length = MAX_ORNITHOPTER_PAIRS, PG_SERVO_CONFIG, offsetof(servoConfig_t, wing_origin_offset) },
@@ -1460,6 +1475,9 @@ const clivalue_t valueTable[] = {
 
 const uint16_t valueTableEntryCount = ARRAYLEN(valueTable);
 
+// valueTable[] stays grouped by parameter group for dump/diff, the CLI sorts this index by name for lookups
+uint16_t valueTableNameIndex[ARRAYLEN(valueTable)];
+
 void settingsBuildCheck() {
     STATIC_ASSERT(LOOKUP_TABLE_COUNT == ARRAYLEN(lookupTables), LOOKUP_TABLE_COUNT_incorrect);
 }
\ No newline at end of file
@@ -94,6 +94,7 @@ typedef enum {
 #endif
 #ifdef USE_MULTI_GYRO
     TABLE_GYRO,
+    TABLE_GYRO_FUSION,
 #endif
     TABLE_THROTTLE_LIMIT_TYPE,
 #ifdef USE_MAX7456
@@ -215,6 +216,7 @@ extern const lookupTableEntry_t lookupTables[];
 extern const uint16_t valueTableEntryCount;
 
 extern const clivalue_t valueTable[];
+extern uint16_t valueTableNameIndex[];
 //extern const uint8_t lookupTablesEntryCount;
 
 extern const char * const lookupTableGyroHardware[];
@@ -136,6 +136,7 @@ const OSD_Entry menuOsdActiveElemsEntries[] =
     {"STICK OVERLAY RIGHT",OME_VISIBLE, NULL, &osdConfig_item_pos[OSD_STICK_OVERLAY_RIGHT], DYNAMIC},
 #endif
     {"DISPLAY NAME",       OME_VISIBLE, NULL, &osdConfig_item_pos[OSD_DISPLAY_NAME], 0},
+    {"WING SATURATION",    OME_VISIBLE, NULL, &osdConfig_item_pos[OSD_WING_SATURATION], DYNAMIC},
     {"BACK",               OME_Back,    NULL, NULL, 0},
     {NULL,                 OME_END,     NULL, NULL, 0}
 };
@@ -22,6 +22,8 @@
 
 #include "platform.h"
 
+#include "common/utils.h"
+
 #include "color.h"
 #include "colorconversion.h"
 
@@ -29,59 +31,49 @@
  * Source below found here: http://www.kasperkamperman.com/blog/arduino/arduino-programming-hsb-to-rgb/
  */
 
+// Each 60° hue sector sets one channel to the value, one to the base and ramps the third between them
+typedef enum {
+    HSV_CHANNEL_VALUE,
+    HSV_CHANNEL_BASE,
+    HSV_CHANNEL_RISING,
+    HSV_CHANNEL_FALLING,
+} hsvChannelRole_e;
+
+static const uint8_t hueSectorRoles[6][RGB_COLOR_COMPONENT_COUNT] = {
+    //   R                       G                       B
+    { HSV_CHANNEL_VALUE,   HSV_CHANNEL_RISING,  HSV_CHANNEL_BASE    },
+    { HSV_CHANNEL_FALLING, HSV_CHANNEL_VALUE,   HSV_CHANNEL_BASE    },
+    { HSV_CHANNEL_BASE,    HSV_CHANNEL_VALUE,   HSV_CHANNEL_RISING  },
+    { HSV_CHANNEL_BASE,    HSV_CHANNEL_FALLING, HSV_CHANNEL_VALUE   },
+    { HSV_CHANNEL_RISING,  HSV_CHANNEL_BASE,    HSV_CHANNEL_VALUE   },
+    { HSV_CHANNEL_VALUE,   HSV_CHANNEL_BASE,    HSV_CHANNEL_FALLING },
+};
+
 rgbColor24bpp_t* hsvToRgb24(const hsvColor_t* c)
 {
     static rgbColor24bpp_t r;
 
-    uint16_t val = c->v;
-    uint16_t sat = 255 - c->s;
-    uint32_t base;
-    uint16_t hue = c->h;
+    const uint16_t val = c->v;
+    const uint16_t sat = 255 - c->s;
+    const uint16_t hue = c->h;
+    const unsigned sector = hue / 60;
 
     if (sat == 0) { // Acromatic color (gray). Hue doesn't mind.
         r.rgb.r = val;
         r.rgb.g = val;
         r.rgb.b = val;
-    } else {
-
-        base = ((255 - sat) * val) >> 8;
-
-        switch (hue / 60) {
-            case 0:
-            r.rgb.r = val;
-            r.rgb.g = (((val - base) * hue) / 60) + base;
-            r.rgb.b = base;
-            break;
-            case 1:
-            r.rgb.r = (((val - base) * (60 - (hue % 60))) / 60) + base;
-            r.rgb.g = val;
-            r.rgb.b = base;
-            break;
-
-            case 2:
-            r.rgb.r = base;
-            r.rgb.g = val;
-            r.rgb.b = (((val - base) * (hue % 60)) / 60) + base;
-            break;
-
-            case 3:
-            r.rgb.r = base;
-            r.rgb.g = (((val - base) * (60 - (hue % 60))) / 60) + base;
-            r.rgb.b = val;
-            break;
-
-            case 4:
-            r.rgb.r = (((val - base) * (hue % 60)) / 60) + base;
-            r.rgb.g = base;
-            r.rgb.b = val;
-            break;
-
-            case 5:
-            r.rgb.r = val;
-            r.rgb.g = base;
-            r.rgb.b = (((val - base) * (60 - (hue % 60))) / 60) + base;
-            break;
+    } else if (sector < ARRAYLEN(hueSectorRoles)) {
+        const uint32_t base = ((255 - sat) * val) >> 8;
+        const uint16_t offset = hue % 60;
+        const uint8_t channel[] = {
+            [HSV_CHANNEL_VALUE] = val,
+            [HSV_CHANNEL_BASE] = base,
+            [HSV_CHANNEL_RISING] = (((val - base) * offset) / 60) + base,
+            [HSV_CHANNEL_FALLING] = (((val - base) * (60 - offset)) / 60) + base,
+        };
 
+        for (int i = 0; i < RGB_COLOR_COMPONENT_COUNT; i++) {
+            r.raw[i] = channel[hueSectorRoles[sector][i]];
         }
     }
     return &r;
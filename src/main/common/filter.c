@@ -92,6 +92,85 @@ FAST_CODE float slewFilterApply(slewFilter_t *filter, float input)
     return filter->state;
 }
 
+// Hermite spline for upsampling a slow, jittery sample stream (rx frames) to a fast, fixed rate loop
+// while providing an analytic derivative alongside the value
+
+void hermiteSplineInit(hermiteSpline_t *spline, float sample)
+{
+    spline->a = sample;
+    spline->b = 0.0f;
+    spline->c = 0.0f;
+    spline->d = 0.0f;
+    spline->duration = 0.0f;
+    spline->lastSample = sample;
+    spline->endSlope = 0.0f;
+    spline->value = sample;
+    spline->derivative = 0.0f;
+}
+
+// Start a new segment at the current output so value and slope stay continuous, and reach the new sample one
+// sample interval later with the slope of the last two samples.
+FAST_CODE void hermiteSplineUpdate(hermiteSpline_t *spline, float sample, float sampleIntervalS)
+{
+    const float invT = 1.0f / sampleIntervalS;
+    const float m0 = spline->derivative;
+    const float m1 = (sample - spline->lastSample) * invT;
+    const float slope = (sample - spline->value) * invT;
+
+    spline->a = spline->value;
+    spline->b = m0;
+    spline->c = (3.0f * slope - 2.0f * m0 - m1) * invT;
+    spline->d = (m0 + m1 - 2.0f * slope) * invT * invT;
+    spline->duration = sampleIntervalS;
+    spline->lastSample = sample;
+    spline->endSlope = m1;
+}
+
+FAST_CODE void hermiteSplineEvaluate(hermiteSpline_t *spline, float t)
+{
+    if (t < spline->duration) {
+        spline->value = ((spline->d * t + spline->c) * t + spline->b) * t + spline->a;
+        spline->derivative = (3.0f * spline->d * t + 2.0f * spline->c) * t + spline->b;
+    } else if (t < 2.0f * spline->duration) {
+        // the next sample is late, carry on along the end slope for at most one more interval
+        spline->value = spline->lastSample + spline->endSlope * (t - spline->duration);
+        spline->derivative = spline->endSlope;
+    } else {
+        spline->value = spline->lastSample + spline->endSlope * spline->duration;
+        spline->derivative = 0.0f;
+    }
+}
+
+// Trajectory limiter: the fastest path to a moving target that a drive with bounded velocity and acceleration
+// can follow. Accelerates towards the target and brakes along the curve it can still stop on.
+
+void trajectoryLimiterInit(trajectoryLimiter_t *limiter, float position)
+{
+    limiter->position = position;
+    limiter->velocity = 0.0f;
+}
+
+FAST_CODE float trajectoryLimiterApply(trajectoryLimiter_t *limiter, float target, float maxVelocity, float maxAcceleration, float dT)
+{
+    const float error = target - limiter->position;
+    const float distance = fabsf(error);
+
+    // The fastest speed that still stops at the target. Braking in steps of h = a·dT from v = k·h + r
+    // covers dT·((k + 1)·r + h·k·(k + 1) / 2) including this step, the discrete form of v² / 2a, so
+    // inverting it for the distance left lands on the target without overshoot.
+    const float velocityStep = maxAcceleration * dT;
+    const float stepDistance = distance / dT;
+    const float k = floorf(0.5f * (sqrtf(1.0f + 8.0f * stepDistance / velocityStep) - 1.0f));
+    float speed = k * velocityStep + (stepDistance - 0.5f * velocityStep * k * (k + 1.0f)) / (k + 1.0f);
+    speed = MIN(speed, maxVelocity);
+    const float desiredVelocity = (error < 0.0f) ? -speed : speed;
+
+    limiter->velocity = constrainf(desiredVelocity, limiter->velocity - velocityStep, limiter->velocity + velocityStep);
+    limiter->position += limiter->velocity * dT;
+
+    return limiter->position;
+}
+
 // get notch filter Q given center frequency (f0) and lower cutoff frequency (f1)
 // Q = f0 / (f2 - f1) ; f2 = f0^2 / f1
 float filterGetNotchQ(float centerFreq, float cutoffFreq) {
@@ -68,4 +68,14 @@ uint32_t GPS_coord_to_degrees(const char* coordinateString)
     }
     return degress * 10000000UL + (minutes * 1000000UL + fractionalMinutes * 100UL) / 6;
 }
+
+// Same conversion for a coordinate already split into its integer part (dddmm)
+// and fractional minutes in ten-thousandths of a minute
+uint32_t GPS_coord_ddmm_to_degrees(uint32_t degreesMinutes, uint16_t fractionalMinutes)
+{
+    const uint32_t degrees = degreesMinutes / 100;
+    const uint32_t minutes = degreesMinutes % 100;
+
+    return degrees * 10000000UL + (minutes * 1000000UL + fractionalMinutes * 100UL) / 6;
+}
 #endif
@@ -21,3 +21,4 @@
 #pragma once
 
 uint32_t GPS_coord_to_degrees(const char* coordinateString);
+uint32_t GPS_coord_ddmm_to_degrees(uint32_t degreesMinutes, uint16_t fractionalMinutes);
@@ -104,6 +104,110 @@ float acos_approx(float x)
 }
 #endif
 
+// Range-reduced kernels. The argument is reduced to r in [-pi/4, pi/4] around the nearest multiple of pi/2,
+// with pi/2 split in three parts (Cody-Waite) so the reduction is exact for |x| < 2^16, and short minimax
+// polynomials for that interval give sin and cos together. Coefficients from a Lawson (minimax) fit.
+// Maximum absolute error against libm for |x| < 1000, reported by maths_unittest:
+//   MATH_KERNEL_PRECISION_HIGH  sin 1.2e-07, cos 1.2e-07
+//   MATH_KERNEL_PRECISION_FAST  sin 1.3e-05, cos 1.3e-05
+#define PIO2_1      1.5703125f                      // pi/2 = PIO2_1 + PIO2_2 + PIO2_3, PIO2_1 and PIO2_2 have short mantissas
+#define PIO2_2      4.837512969970703125e-4f
+#define PIO2_3      7.54978995489188216e-8f
+#define TWO_PI_1    6.28125f                        // 2pi = TWO_PI_1 + TWO_PI_2
+#define TWO_PI_2    1.935307179586476925e-3f
+#define KERNEL_MAX_ARG 65536.0f
+
+#if MATH_KERNEL_PRECISION == MATH_KERNEL_PRECISION_HIGH
+#define kernelSinCoef3 -1.6666650669e-1f
+#define kernelSinCoef5  8.3319786630e-3f
+#define kernelSinCoef7 -1.9495636220e-4f
+#define kernelCosCoef2 -4.9999894781e-1f
+#define kernelCosCoef4  4.1656294575e-2f
+#define kernelCosCoef6 -1.3597823075e-3f
+#else
+#define kernelSinCoef3 -1.6662833805e-1f
+#define kernelSinCoef5  8.1529922991e-3f
+#define kernelSinCoef7  0
+#define kernelCosCoef2 -4.9977630696e-1f
+#define kernelCosCoef4  4.0488935621e-2f
+#define kernelCosCoef6  0
+#endif
+
+// Wraps an angle in radians to [0, 2pi)
+float wrap_2pi(float x)
+{
+    int32_t turns = x * (1.0f / (2.0f * M_PIf));
+    if (x < 0.0f) {
+        turns--;
+    }
+    float r = (x - turns * TWO_PI_1) - turns * TWO_PI_2;
+    if (r >= 2.0f * M_PIf) {
+        r -= 2.0f * M_PIf;
+    } else if (r < 0.0f) {
+        r += 2.0f * M_PIf;
+    }
+    return r;
+}
+
+#if MATH_KERNEL_PRECISION != MATH_KERNEL_PRECISION_LIBM
+// sin and cos of x = r + quadrant * pi/2, r in [-pi/4, pi/4]
+static void sincosKernel(float r, int32_t quadrant, float *sinOut, float *cosOut)
+{
+    const float r2 = r * r;
+    const float s = r + r * r2 * (kernelSinCoef3 + r2 * (kernelSinCoef5 + r2 * kernelSinCoef7));
+    const float c = 1.0f + r2 * (kernelCosCoef2 + r2 * (kernelCosCoef4 + r2 * kernelCosCoef6));
+
+    switch (quadrant & 3) {
+    case 0:
+        *sinOut = s;
+        *cosOut = c;
+        break;
+    case 1:
+        *sinOut = c;
+        *cosOut = -s;
+        break;
+    case 2:
+        *sinOut = -s;
+        *cosOut = -c;
+        break;
+    default:
+        *sinOut = -c;
+        *cosOut = s;
+        break;
+    }
+}
+#endif
+
+void sincos_approx(float x, float *sinOut, float *cosOut)
+{
+#if MATH_KERNEL_PRECISION == MATH_KERNEL_PRECISION_LIBM
+    *sinOut = sinf(x);
+    *cosOut = cosf(x);
+#else
+    if (fabsf(x) > KERNEL_MAX_ARG) {                                         // Stop here on error input
+        *sinOut = 0.0f;
+        *cosOut = 1.0f;
+        return;
+    }
+    const int32_t quadrant = lrintf(x * (2.0f / M_PIf));
+    const float r = ((x - quadrant * PIO2_1) - quadrant * PIO2_2) - quadrant * PIO2_3;
+    sincosKernel(r, quadrant, sinOut, cosOut);
+#endif
+}
+
+// sin and cos for x in [0, pi], e.g. the ramp of a trapezoidal wave: the quadrant comes from two compares
+void sincos_ramp_approx(float x, float *sinOut, float *cosOut)
+{
+#if MATH_KERNEL_PRECISION == MATH_KERNEL_PRECISION_LIBM
+    *sinOut = sinf(x);
+    *cosOut = cosf(x);
+#else
+    const int32_t quadrant = (x > 0.25f * M_PIf) + (x > 0.75f * M_PIf);
+    const float r = ((x - quadrant * PIO2_1) - quadrant * PIO2_2) - quadrant * PIO2_3;
+    sincosKernel(r, quadrant, sinOut, cosOut);
+#endif
+}
+
 int gcd(int num, int denom)
 {
     if (denom == 0) {
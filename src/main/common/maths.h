@@ -31,6 +31,14 @@
 #define FAST_MATH             // order 9 approximation
 #define VERY_FAST_MATH      // order 7 approximation
 
+// Precision tier of the range-reduced kernels (wrap_2pi, sincos_approx, sincos_ramp_approx), errors in maths.c
+#define MATH_KERNEL_PRECISION_LIBM  0   // sinf/cosf, for comparison
+#define MATH_KERNEL_PRECISION_FAST  1   // order 5 sin / order 4 cos
+#define MATH_KERNEL_PRECISION_HIGH  2   // order 7 sin / order 6 cos, float rounding limited
+#ifndef MATH_KERNEL_PRECISION
+#define MATH_KERNEL_PRECISION MATH_KERNEL_PRECISION_HIGH
+#endif
+
 // Use floating point M_PI instead explicitly.
 #define M_PIf       3.14159265358979323846f
 
@@ -142,6 +150,10 @@ float pow_approx(float a, float b);
 #define pow_approx(a, b)    powf(b, a)
 #endif
 
+float wrap_2pi(float x);
+void sincos_approx(float x, float *sinOut, float *cosOut);
+void sincos_ramp_approx(float x, float *sinOut, float *cosOut);
+
 void arraySubInt32(int32_t *dest, int32_t *array1, int32_t *array2, int count);
 
 int16_t qPercent(fix12_t q);
@@ -43,6 +43,13 @@ extern uint8_t __config_end;
 
 static uint16_t eepromConfigSize;
 
+// Saves only append the records of changed PGs after the full copy, see
+// appendSettingsToEEPROM(). These describe the log found by the last scan.
+static const uint8_t *configLogStart;
+static const uint8_t *configLogEnd;
+static uint16_t configLogSequence;
+static uint16_t configBaseCrc;
+
 typedef enum {
     CR_CLASSICATION_SYSTEM   = 0,
     CR_CLASSICATION_PROFILE_LAST = CR_CLASSICATION_SYSTEM,
@@ -77,6 +84,15 @@ typedef struct {
 } PG_PACKED configFooter_t;
 // checksum is appended just after footer. It is not included in footer to make checksum calculation consistent
 
+// Header for each PG record appended after the full copy.
+// Entries are word aligned and carry a CRC over entry header and record, stored like the main CRC.
+typedef struct {
+    uint16_t sequence;          // 0 for the first entry after a full write, incremented for each entry
+    uint16_t baseCrc;           // stored CRC of the full copy the entry applies to
+} PG_PACKED configLogEntry_t;
+
+#define CONFIG_LOG_ENTRY_BLANK  0xFFFF
+
 // Used to check the compiler packing at build time.
 typedef struct {
     uint8_t byte;
@@ -92,6 +108,56 @@ void initEEPROM(void)
 
     STATIC_ASSERT(sizeof(configFooter_t) == 2, footer_size_failed);
     STATIC_ASSERT(sizeof(configRecord_t) == 6, record_size_failed);
+    STATIC_ASSERT(sizeof(configLogEntry_t) == 4, log_entry_size_failed);
+}
+
+static uint16_t configLogEntrySize(uint16_t recordSize)
+{
+    const uint16_t size = sizeof(configLogEntry_t) + recordSize + sizeof(uint16_t);
+
+    return (size + 3) & ~3;
+}
+
+static bool isConfigLogEntryBlank(const uint8_t *p, const uint8_t *end)
+{
+    for (; p < end; p++) {
+        if (*p != 0xFF) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Walk the entries appended after the full copy, stopping at the first one that is blank, torn
+// or left over from an older copy.
+static void scanConfigLog(const uint8_t *p)
+{
+    configLogStart = p;
+    configLogSequence = 0;
+
+    while (p + sizeof(configLogEntry_t) + sizeof(configRecord_t) < &__config_end) {
+        const configLogEntry_t *entry = (const configLogEntry_t *)p;
+        const configRecord_t *record = (const configRecord_t *)(p + sizeof(*entry));
+
+        if (entry->sequence != configLogSequence
+            || entry->baseCrc != configBaseCrc
+            || record->size < sizeof(*record)
+            || p + configLogEntrySize(record->size) > &__config_end) {
+            break;
+        }
+
+        uint16_t crc = CRC_START_VALUE;
+        crc = crc16_ccitt_update(crc, p, sizeof(*entry) + record->size + sizeof(uint16_t));
+        if (crc != CRC_CHECK_VALUE) {
+            break;
+        }
+
+        configLogSequence++;
+        p += configLogEntrySize(record->size);
+    }
+
+    configLogEnd = p;
 }
 
 bool isEEPROMVersionValid(void)
@@ -145,12 +211,20 @@ bool isEEPROMStructureValid(void)
     // include stored CRC in the CRC calculation
     const uint16_t *storedCrc = (const uint16_t *)p;
     crc = crc16_ccitt_update(crc, storedCrc, sizeof(*storedCrc));
-    p += sizeof(storedCrc);
-
-    eepromConfigSize = p - &__config_start;
+    p += sizeof(*storedCrc);
 
     // CRC has the property that if the CRC itself is included in the calculation the resulting CRC will have constant value
-    return crc == CRC_CHECK_VALUE;
+    if (crc != CRC_CHECK_VALUE) {
+        return false;
+    }
+
+    // the full copy is padded to a whole word by the streamer, the log starts after it
+    configBaseCrc = *storedCrc;
+    scanConfigLog(&__config_start + ((p - &__config_start + 3) & ~3));
+
+    eepromConfigSize = configLogEnd - &__config_start;
+
+    return true;
 }
 
 uint16_t getEEPROMConfigSize(void)
@@ -163,6 +237,19 @@ uint16_t getEEPROMConfigSize(void)
 // this function assumes that EEPROM content is valid
 static const configRecord_t *findEEPROM(const pgRegistry_t *reg, configRecordFlags_e classification)
 {
+    // the newest copy is the last one appended to the log
+    const configRecord_t *logRecord = NULL;
+    for (const uint8_t *p = configLogStart; p < configLogEnd; ) {
+        const configRecord_t *record = (const configRecord_t *)(p + sizeof(configLogEntry_t));
+        if (pgN(reg) == record->pgn
+            && (record->flags & CR_CLASSIFICATION_MASK) == classification)
+            logRecord = record;
+        p += configLogEntrySize(record->size);
+    }
+    if (logRecord) {
+        return logRecord;
+    }
+
     const uint8_t *p = &__config_start;
     p += sizeof(configHeader_t);             // skip header
     while (true) {
@@ -248,14 +335,112 @@ static bool writeSettingsToEEPROM(void)
 
     config_streamer_flush(&streamer);
 
+    // leave the space after the copy blank for appended records
+    config_streamer_erase_tail(&streamer);
+
     const bool success = config_streamer_finish(&streamer) == 0;
 
     return success;
 }
 
+static bool isEEPROMRecordCurrent(const pgRegistry_t *reg)
+{
+    const configRecord_t *rec = findEEPROM(reg, CR_CLASSICATION_SYSTEM);
+
+    return rec
+        && rec->version == pgVersion(reg)
+        && rec->size == sizeof(configRecord_t) + pgSize(reg)
+        && memcmp(rec->pg, reg->address, pgSize(reg)) == 0;
+}
+
+// Append records for the PGs that differ from the stored copy, without erasing.
+// Returns false when the log is not usable or has no room left, a full write is needed then.
+static bool appendSettingsToEEPROM(void)
+{
+    if (!isEEPROMVersionValid() || !isEEPROMStructureValid()) {
+        return false;
+    }
+
+    int changedCount = 0;
+    int requiredSize = 0;
+    PG_FOREACH(reg) {
+        if (!isEEPROMRecordCurrent(reg)) {
+            changedCount++;
+            requiredSize += configLogEntrySize(sizeof(configRecord_t) + pgSize(reg));
+        }
+    }
+
+    if (changedCount == 0) {
+        return true;
+    }
+
+    // compact when the log would not fit, or when everything changed anyway
+    if (changedCount == PG_REGISTRY_SIZE
+        || configLogSequence + changedCount >= CONFIG_LOG_ENTRY_BLANK
+        || configLogEnd + requiredSize > &__config_end
+        || !isConfigLogEntryBlank(configLogEnd, configLogEnd + requiredSize)) {
+        return false;
+    }
+
+    config_streamer_t streamer;
+    config_streamer_init(&streamer);
+
+    config_streamer_start_append(&streamer, (uintptr_t)configLogEnd, &__config_end - configLogEnd);
+
+    uint16_t sequence = configLogSequence;
+    PG_FOREACH(reg) {
+        if (isEEPROMRecordCurrent(reg)) {
+            continue;
+        }
+
+        const uint16_t regSize = pgSize(reg);
+        const configLogEntry_t entry = {
+            .sequence = sequence++,
+            .baseCrc = configBaseCrc,
+        };
+        const configRecord_t record = {
+            .size = sizeof(configRecord_t) + regSize,
+            .pgn = pgN(reg),
+            .version = pgVersion(reg),
+            .flags = CR_CLASSICATION_SYSTEM,
+        };
+
+        uint16_t crc = CRC_START_VALUE;
+        config_streamer_write(&streamer, (uint8_t *)&entry, sizeof(entry));
+        crc = crc16_ccitt_update(crc, (uint8_t *)&entry, sizeof(entry));
+        config_streamer_write(&streamer, (uint8_t *)&record, sizeof(record));
+        crc = crc16_ccitt_update(crc, (uint8_t *)&record, sizeof(record));
+        config_streamer_write(&streamer, reg->address, regSize);
+        crc = crc16_ccitt_update(crc, reg->address, regSize);
+
+        const uint16_t invertedBigEndianCrc = ~(((crc & 0xFF) << 8) | (crc >> 8));
+        config_streamer_write(&streamer, (uint8_t *)&invertedBigEndianCrc, sizeof(crc));
+
+        // pad to the next entry, which has to start on a word
+        const uint8_t padding[3] = { 0 };
+        const int entrySize = sizeof(entry) + record.size + sizeof(crc);
+        config_streamer_write(&streamer, padding, configLogEntrySize(record.size) - entrySize);
+    }
+
+    config_streamer_flush(&streamer);
+
+    if (config_streamer_finish(&streamer) != 0 || !isEEPROMStructureValid()) {
+        return false;
+    }
+
+    // every PG must read back as saved, otherwise fall back to a full write
+    PG_FOREACH(reg) {
+        if (!isEEPROMRecordCurrent(reg)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void writeConfigToEEPROM(void)
 {
-    bool success = false;
+    bool success = appendSettingsToEEPROM();
     // write it
     for (int attempt = 0; attempt < 3 && !success; attempt++) {
         if (writeSettingsToEEPROM()) {
@@ -79,6 +79,7 @@ void config_streamer_start(config_streamer_t *c, uintptr_t base, int size)
     // base must start at FLASH_PAGE_SIZE boundary
     c->address = base;
     c->size = size;
+    c->end = base + size;
     if (!c->unlocked) {
 #if defined(STM32F7)
         HAL_FLASH_Unlock();
@@ -102,6 +103,15 @@ void config_streamer_start(config_streamer_t *c, uintptr_t base, int size)
 # error "Unsupported CPU"
 #endif
     c->err = 0;
+    c->append = false;
+}
+
+// Start writing at base without erasing any page on the way, used to append
+// to an already erased area. The caller must make sure the area is blank.
+void config_streamer_start_append(config_streamer_t *c, uintptr_t base, int size)
+{
+    config_streamer_start(c, base, size);
+    c->append = true;
 }
 
 #if defined(STM32F745xx) || defined(STM32F746xx) || defined(STM32F765xx)
@@ -250,7 +260,7 @@ static int write_word(config_streamer_t *c, uint32_t value)
         return c->err;
     }
 #if defined(STM32F7)
-    if (c->address % FLASH_PAGE_SIZE == 0) {
+    if (c->address % FLASH_PAGE_SIZE == 0 && !c->append) {
         FLASH_EraseInitTypeDef EraseInitStruct = {
             .TypeErase     = FLASH_TYPEERASE_SECTORS,
             .VoltageRange  = FLASH_VOLTAGE_RANGE_3, // 2.7-3.6V
@@ -268,7 +278,7 @@ static int write_word(config_streamer_t *c, uint32_t value)
         return -2;
     }
 #else
-    if (c->address % FLASH_PAGE_SIZE == 0) {
+    if (c->address % FLASH_PAGE_SIZE == 0 && !c->append) {
 #if defined(STM32F4)
         const FLASH_Status status = FLASH_EraseSector(getFLASHSectorForEEPROM(), VoltageRange_3); //0x08080000 to 0x080A0000
 #else
@@ -315,6 +325,29 @@ int config_streamer_flush(config_streamer_t *c)
     return c-> err;
 }
 
+// Erase the pages between the current write position and the end of the area,
+// so that everything after the written data reads back as blank.
+int config_streamer_erase_tail(config_streamer_t *c)
+{
+    if (c->err != 0) {
+        return c->err;
+    }
+#if defined(STM32F4) || defined(STM32F7)
+    // the whole sector was erased on the first write
+#else
+    // round up to the first page that holds no written data
+    uintptr_t page = c->address + FLASH_PAGE_SIZE - 1;
+    page -= page % FLASH_PAGE_SIZE;
+    for (; page < c->end; page += FLASH_PAGE_SIZE) {
+        if (FLASH_ErasePage(page) != FLASH_COMPLETE) {
+            c->err = -1;
+            break;
+        }
+    }
+#endif
+    return c->err;
+}
+
 int config_streamer_finish(config_streamer_t *c)
 {
     if (c->unlocked) {
@@ -29,6 +29,7 @@
 typedef struct config_streamer_s {
     uintptr_t address;
     int size;
+    uintptr_t end;
     union {
         uint8_t b[4];
         uint32_t w;
@@ -36,13 +37,16 @@ typedef struct config_streamer_s {
     int at;
     int err;
     bool unlocked;
+    bool append;
 } config_streamer_t;
 
 void config_streamer_init(config_streamer_t *c);
 
 void config_streamer_start(config_streamer_t *c, uintptr_t base, int size);
+void config_streamer_start_append(config_streamer_t *c, uintptr_t base, int size);
 int config_streamer_write(config_streamer_t *c, const uint8_t *p, uint32_t size);
 int config_streamer_flush(config_streamer_t *c);
 
+int config_streamer_erase_tail(config_streamer_t *c);
 int config_streamer_finish(config_streamer_t *c);
 int config_streamer_status(config_streamer_t *c);
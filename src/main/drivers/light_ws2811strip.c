@@ -62,6 +62,12 @@ uint16_t BIT_COMPARE_0 = 0;
 static hsvColor_t ledColorBuffer[WS2811_DATA_BUFFER_SIZE];
 
 #if !defined(USE_WS2811_SINGLE_COLOUR)
+// Colours currently encoded in ledStripDMABuffer, only LEDs whose colour differs are converted again.
+// Not used for a single colour, the DMA IRQ zeroes the buffer after every frame to generate the reset delay.
+static hsvColor_t ledDMABufferColors[WS2811_DATA_BUFFER_SIZE];
+static ledStripFormatRGB_e ledDMABufferFormat;
+static bool ledDMABufferValid = false;
+
 void setLedHsv(uint16_t index, const hsvColor_t *color)
 {
     ledColorBuffer[index] = *color;
@@ -100,6 +106,9 @@ void setStripColors(const hsvColor_t *colors)
 void ws2811LedStripInit(ioTag_t ioTag)
 {
     memset(ledStripDMABuffer, 0, sizeof(ledStripDMABuffer));
+#if !defined(USE_WS2811_SINGLE_COLOUR)
+    ledDMABufferValid = false;
+#endif
 
     ledStripIoTag = ioTag;
 }
@@ -157,15 +166,33 @@ void ws2811UpdateStrip(ledStripFormatRGB_e ledFormat)
         return;
     }
 
-    unsigned ledIndex = 0;              // reset led index
+#if !defined(USE_WS2811_SINGLE_COLOUR)
+    if (ledFormat != ledDMABufferFormat) {
+        ledDMABufferFormat = ledFormat;
+        ledDMABufferValid = false;
+    }
+#endif
 
     // fill transmit buffer with correct compare values to achieve
-    // correct pulse widths according to color values
-    while (ledIndex < WS2811_DATA_BUFFER_SIZE) {
-        rgbColor24bpp_t *rgb24 = hsvToRgb24(&ledColorBuffer[ledIndex]);
+    // correct pulse widths according to color values.
+    // The buffer keeps the bits of the previous update, so only the LEDs that changed are encoded again.
+    for (unsigned ledIndex = 0; ledIndex < WS2811_DATA_BUFFER_SIZE; ledIndex++) {
+        const hsvColor_t *color = &ledColorBuffer[ledIndex];
+#if !defined(USE_WS2811_SINGLE_COLOUR)
+        hsvColor_t *encodedColor = &ledDMABufferColors[ledIndex];
+
+        if (ledDMABufferValid && color->h == encodedColor->h && color->s == encodedColor->s && color->v == encodedColor->v) {
+            continue;
+        }
+        *encodedColor = *color;
+#endif
 
-        updateLEDDMABuffer(ledFormat, rgb24, ledIndex++);
+        rgbColor24bpp_t *rgb24 = hsvToRgb24(color);
+        updateLEDDMABuffer(ledFormat, rgb24, ledIndex);
     }
+#if !defined(USE_WS2811_SINGLE_COLOUR)
+    ledDMABufferValid = true;
+#endif
 
     ws2811LedDataTransferInProgress = true;
     ws2811LedStripDMAEnable();
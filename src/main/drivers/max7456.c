@@ -214,6 +214,14 @@ volatile bool dmaTransactionInProgress = false;
 
 static uint8_t spiBuff[MAX_CHARS2UPDATE*6];
 
+// A single character costs 6 bytes with direct addressing (DMAH, DMAL, DMDI).
+// A run costs the address setup, entering and leaving auto-increment mode (10 bytes) plus 2 bytes per character,
+// so it pays off from 3 characters on. Gaps of unchanged characters shorter than a new run setup are sent along.
+#define MAX7456_SINGLE_CHAR_BYTES   6
+#define MAX7456_RUN_OVERHEAD_BYTES  10
+#define MAX7456_RUN_MIN_LENGTH      3
+#define MAX7456_RUN_MAX_GAP         4
+
 static uint8_t  videoSignalCfg;
 static uint8_t  videoSignalReg  = OSD_ENABLE; // OSD_ENABLE required to trigger first ReInit
 static uint8_t  displayMemoryModeReg = 0;
@@ -654,6 +662,25 @@ void max7456ReInitIfRequired(void)
     //------------   end of (re)init-------------------------------------
 }
 
+// Length of the run of changed characters starting at pos, including short gaps of unchanged ones.
+// END_STRING terminates auto-increment mode, so it is never part of a run.
+static uint16_t max7456ChangedRunLength(uint16_t pos)
+{
+    uint16_t length = 0;
+    uint16_t gap = 0;
+
+    for (uint16_t i = pos; i < maxScreenSize && screenBuffer[i] != END_STRING; i++) {
+        if (screenBuffer[i] != shadowBuffer[i]) {
+            length = i - pos + 1;
+            gap = 0;
+        } else if (++gap > MAX7456_RUN_MAX_GAP) {
+            break;
+        }
+    }
+
+    return length;
+}
+
 void max7456DrawScreen(void)
 {
     static uint16_t pos = 0;
@@ -667,8 +694,45 @@ void max7456DrawScreen(void)
         max7456ReInitIfRequired();
 
         int buff_len = 0;
-        for (int k = 0; k < MAX_CHARS2UPDATE; k++) {
-            if (screenBuffer[pos] != shadowBuffer[pos]) {
+        while (pos < maxScreenSize) {
+            // skip unchanged characters a word at a time
+            if (pos + 4 <= maxScreenSize && memcmp(&screenBuffer[pos], &shadowBuffer[pos], 4) == 0) {
+                pos += 4;
+                continue;
+            }
+            if (screenBuffer[pos] == shadowBuffer[pos]) {
+                pos++;
+                continue;
+            }
+
+            uint16_t runLength = max7456ChangedRunLength(pos);
+            if (runLength >= MAX7456_RUN_MIN_LENGTH) {
+                const int room = ((int)sizeof(spiBuff) - buff_len - MAX7456_RUN_OVERHEAD_BYTES) / 2;
+                if (room < MAX7456_RUN_MIN_LENGTH) {
+                    break;
+                }
+                runLength = MIN(runLength, room);
+
+                spiBuff[buff_len++] = MAX7456ADD_DMAH;
+                spiBuff[buff_len++] = pos >> 8;
+                spiBuff[buff_len++] = MAX7456ADD_DMAL;
+                spiBuff[buff_len++] = pos & 0xff;
+                spiBuff[buff_len++] = MAX7456ADD_DMM;
+                spiBuff[buff_len++] = displayMemoryModeReg | 1;
+                for (uint16_t i = 0; i < runLength; i++, pos++) {
+                    spiBuff[buff_len++] = MAX7456ADD_DMDI;
+                    spiBuff[buff_len++] = screenBuffer[pos];
+                    shadowBuffer[pos] = screenBuffer[pos];
+                }
+                spiBuff[buff_len++] = MAX7456ADD_DMDI;
+                spiBuff[buff_len++] = END_STRING;
+                spiBuff[buff_len++] = MAX7456ADD_DMM;
+                spiBuff[buff_len++] = displayMemoryModeReg;
+            } else {
+                if (buff_len + MAX7456_SINGLE_CHAR_BYTES > (int)sizeof(spiBuff)) {
+                    break;
+                }
+
                 spiBuff[buff_len++] = MAX7456ADD_DMAH;
                 spiBuff[buff_len++] = pos >> 8;
                 spiBuff[buff_len++] = MAX7456ADD_DMAL;
@@ -676,12 +740,12 @@ void max7456DrawScreen(void)
                 spiBuff[buff_len++] = MAX7456ADD_DMDI;
                 spiBuff[buff_len++] = screenBuffer[pos];
                 shadowBuffer[pos] = screenBuffer[pos];
+                pos++;
             }
+        }
 
-            if (++pos >= maxScreenSize) {
-                pos = 0;
-                break;
-            }
+        if (pos >= maxScreenSize) {
+            pos = 0;
         }
 
         if (buff_len) {
@@ -74,6 +74,20 @@ uint8_t serialRead(serialPort_t *instance)
     return instance->vTable->serialRead(instance);
 }
 
+// Reads up to count bytes that are already waiting, returns the number of bytes read
+uint32_t serialReadBuf(serialPort_t *instance, uint8_t *data, uint32_t count)
+{
+    if (instance->vTable->readBuf) {
+        return instance->vTable->readBuf(instance, data, count);
+    }
+
+    uint32_t read = 0;
+    while (read < count && serialRxBytesWaiting(instance)) {
+        data[read++] = serialRead(instance);
+    }
+    return read;
+}
+
 void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate)
 {
     instance->vTable->serialSetBaudRate(instance, baudRate);
@@ -867,7 +867,8 @@ const struct serialPortVTable escSerialVTable[] = {
         .setBaudRateCb = NULL,
         .writeBuf = NULL,
         .beginWrite = NULL,
-        .endWrite = NULL
+        .endWrite = NULL,
+        .readBuf = NULL
     }
 };
 
@@ -27,6 +27,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "platform.h"
 
@@ -248,6 +249,42 @@ static uint8_t uartRead(serialPort_t *instance)
     return ch;
 }
 
+// Copies the waiting bytes out of the receive ring in at most two contiguous blocks
+static uint32_t uartReadBuf(serialPort_t *instance, uint8_t *data, uint32_t count)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+
+    count = MIN(count, uartTotalRxBytesWaiting(instance));
+
+    uint32_t read = 0;
+    while (read < count) {
+        uint32_t block;
+#ifdef STM32F4
+        if (s->rxDMAStream) {
+#else
+        if (s->rxDMAChannel) {
+#endif
+            // rxDMAPos counts down to the end of the ring
+            block = MIN(count - read, s->rxDMAPos);
+            memcpy(data + read, (const uint8_t *)&s->port.rxBuffer[s->port.rxBufferSize - s->rxDMAPos], block);
+            s->rxDMAPos -= block;
+            if (s->rxDMAPos == 0) {
+                s->rxDMAPos = s->port.rxBufferSize;
+            }
+        } else {
+            block = MIN(count - read, s->port.rxBufferSize - s->port.rxBufferTail);
+            memcpy(data + read, (const uint8_t *)&s->port.rxBuffer[s->port.rxBufferTail], block);
+            s->port.rxBufferTail += block;
+            if (s->port.rxBufferTail >= s->port.rxBufferSize) {
+                s->port.rxBufferTail = 0;
+            }
+        }
+        read += block;
+    }
+
+    return read;
+}
+
 static void uartWrite(serialPort_t *instance, uint8_t ch)
 {
     uartPort_t *s = (uartPort_t *)instance;
@@ -284,6 +321,7 @@ const struct serialPortVTable uartVTable[] = {
         .writeBuf = NULL,
         .beginWrite = NULL,
         .endWrite = NULL,
+        .readBuf = uartReadBuf,
     }
 };
 
@@ -55,6 +55,7 @@ void enableGPIOPowerUsageAndNoiseReductions(void)
 
     // AHB1
     __HAL_RCC_BKPSRAM_CLK_ENABLE();
+    __HAL_RCC_CRC_CLK_ENABLE();
     __HAL_RCC_DTCMRAMEN_CLK_ENABLE();
     __HAL_RCC_DMA2_CLK_ENABLE();
     __HAL_RCC_USB_OTG_HS_CLK_ENABLE();
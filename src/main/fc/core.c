@@ -61,6 +61,7 @@
 #include "fc/config.h"
 #include "fc/controlrate_profile.h"
 #include "fc/core.h"
+#include "fc/loop_overrun.h"
 #include "fc/rc.h"
 #include "fc/rc_adjustments.h"
 #include "fc/rc_controls.h"
@@ -94,6 +95,7 @@
 #include "flight/pid.h"
 #include "flight/servos.h"
 #include "flight/gps_rescue.h"
+#include "flight/wing_monitor.h"
 
 
 // June 2013     V2.2-dev
@@ -463,6 +465,9 @@ void tryArm(void)
         resetMaxFFT();
 #endif
 
+        wingMonitorReset();
+        loopOverrunReset();
+
         disarmAt = currentTimeUs + armingConfig()->auto_disarm_delay * 1e6;   // start disarm timeout, will be extended when throttle is nonzero
 
         lastArmingDisabledReason = 0;
@@ -1130,13 +1135,23 @@ FAST_CODE void taskMainPidLoop(timeUs_t currentTimeUs)
     // 2 - subTaskMotorUpdate()
     // 3 - subTaskPidSubprocesses()
     gyroUpdate(currentTimeUs);
-    DEBUG_SET(DEBUG_PIDLOOP, 0, micros() - currentTimeUs);
+    timeUs_t subtaskStartUs = loopSubtaskDone(LOOP_SUBTASK_GYRO_UPDATE, currentTimeUs);
+    DEBUG_SET(DEBUG_PIDLOOP, 0, loopSubtaskUs[LOOP_SUBTASK_GYRO_UPDATE]);
 
     if (pidUpdateCounter++ % pidConfig()->pid_process_denom == 0) {
         subTaskRcCommand(currentTimeUs);
+        subtaskStartUs = loopSubtaskDone(LOOP_SUBTASK_RC_COMMAND, subtaskStartUs);
         subTaskPidController(currentTimeUs);
+        subtaskStartUs = loopSubtaskDone(LOOP_SUBTASK_PID_CONTROLLER, subtaskStartUs);
         subTaskMotorUpdate(currentTimeUs);
+        subtaskStartUs = loopSubtaskDone(LOOP_SUBTASK_MOTOR_UPDATE, subtaskStartUs);
         subTaskPidSubprocesses(currentTimeUs);
+        subtaskStartUs = loopSubtaskDone(LOOP_SUBTASK_PID_SUBPROCESSES, subtaskStartUs);
+    }
+
+    // overruns only count in flight, disarmed the configurator and EEPROM writes are allowed to stall the loop
+    if (ARMING_FLAG(ARMED)) {
+        loopOverrunCheck(currentTimeUs, subtaskStartUs, getTaskDeltaTime(TASK_SELF), gyro.targetLooptime);
     }
 
     if (debugMode == DEBUG_CYCLETIME) {
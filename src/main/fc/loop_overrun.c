@@ -0,0 +1,104 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "fc/loop_overrun.h"
+
+#include "scheduler/scheduler.h"
+
+// A gyro/PID iteration overruns when it takes longer than the gyro period, so the next gyro sample waits for it,
+// or when it starts a whole period late, so one was skipped. The first is blamed on its longest subtask, the
+// second on the task the scheduler ran before it. The last LOOP_OVERRUN_HISTORY_SIZE are kept, oldest first.
+
+FAST_RAM_ZERO_INIT uint16_t loopSubtaskUs[LOOP_SUBTASK_COUNT];
+
+static loopOverrun_t overrunHistory[LOOP_OVERRUN_HISTORY_SIZE];
+static uint32_t overrunCount;
+
+static const char * const loopSubtaskNames[LOOP_SUBTASK_COUNT] = {
+    "GYRO", "RC_COMMAND", "PID", "MOTOR", "SUBPROCESSES"
+};
+
+static void recordOverrun(timeUs_t startUs, timeDelta_t executionUs, timeDelta_t lateUs)
+{
+    loopOverrun_t *overrun = &overrunHistory[overrunCount % LOOP_OVERRUN_HISTORY_SIZE];
+
+    overrun->timeUs = startUs;
+    overrun->executionUs = MIN(executionUs, UINT16_MAX);
+    overrun->lateUs = constrain(lateUs, 0, UINT16_MAX);
+    overrun->subtask = LOOP_SUBTASK_GYRO_UPDATE;
+    for (int i = 1; i < LOOP_SUBTASK_COUNT; i++) {
+        if (loopSubtaskUs[i] > loopSubtaskUs[overrun->subtask]) {
+            overrun->subtask = i;
+        }
+    }
+    overrun->subtaskUs = loopSubtaskUs[overrun->subtask];
+    overrun->precedingTask = getPreviousTaskId();
+
+    overrunCount++;
+}
+
+// Called at the end of every iteration, periodUs is the time since the previous one started
+FAST_CODE void loopOverrunCheck(timeUs_t startUs, timeUs_t endUs, timeDelta_t periodUs, timeDelta_t looptimeUs)
+{
+    const timeDelta_t executionUs = cmpTimeUs(endUs, startUs);
+    const timeDelta_t lateUs = periodUs - looptimeUs;
+
+    if (executionUs > looptimeUs || lateUs >= looptimeUs) {
+        recordOverrun(startUs, executionUs, lateUs);
+    }
+
+    // iterations that skip the PID leave those subtasks untimed
+    memset(loopSubtaskUs, 0, sizeof(loopSubtaskUs));
+}
+
+void loopOverrunReset(void)
+{
+    overrunCount = 0;
+    memset(loopSubtaskUs, 0, sizeof(loopSubtaskUs));
+}
+
+// Overruns since the last reset, including the ones the history no longer holds
+uint32_t loopOverrunCount(void)
+{
+    return overrunCount;
+}
+
+// The overrun with the given sequence number, NULL once it has left the history
+const loopOverrun_t *loopOverrunGet(uint32_t index)
+{
+    if (index >= overrunCount || overrunCount - index > LOOP_OVERRUN_HISTORY_SIZE) {
+        return NULL;
+    }
+    return &overrunHistory[index % LOOP_OVERRUN_HISTORY_SIZE];
+}
+
+const char *loopSubtaskName(loopSubtask_e subtask)
+{
+    return subtask < LOOP_SUBTASK_COUNT ? loopSubtaskNames[subtask] : "";
+}
@@ -80,6 +80,9 @@ enum {
 #define RC_SMOOTHING_RX_RATE_MAX_US             50000 // 50ms or 20hz
 
 static FAST_RAM_ZERO_INIT rcSmoothingFilter_t rcSmoothingData;
+static FAST_RAM_ZERO_INIT hermiteSpline_t rcCommandSpline[PRIMARY_CHANNEL_COUNT];
+static FAST_RAM_ZERO_INIT hermiteSpline_t setpointSpline[XYZ_AXIS_COUNT];
+static FAST_RAM_ZERO_INIT float setpointRateDerivative[XYZ_AXIS_COUNT];
 #endif // USE_RC_SMOOTHING_FILTER
 
 float getSetpointRate(int axis)
@@ -87,6 +90,14 @@ float getSetpointRate(int axis)
     return setpointRate[axis];
 }
 
+#ifdef USE_RC_SMOOTHING_FILTER
+// Setpoint slope in deg/s^2, only valid for the axes in rcSmoothingSplineAxes()
+float getSetpointRateDerivative(int axis)
+{
+    return setpointRateDerivative[axis];
+}
+#endif
+
 float getRcDeflection(int axis)
 {
     return rcDeflection[axis];
@@ -197,6 +208,25 @@ static void scaleRcCommandToFpvCamAngle(void)
     setpointRate[YAW]  = constrainf(yaw  * cosFactor + roll * sinFactor, -SETPOINT_RATE_LIMIT * 1.0f, SETPOINT_RATE_LIMIT * 1.0f);
 }
 
+static void calculateSetpointRates(int maxUpdatedAxis)
+{
+#if defined(SIMULATOR_BUILD)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunsafe-loop-optimizations"
+#endif
+    for (int axis = FD_ROLL; axis <= maxUpdatedAxis; axis++) {
+#if defined(SIMULATOR_BUILD)
+#pragma GCC diagnostic pop
+#endif
+        calculateSetpointRate(axis);
+    }
+
+    // Scaling of AngleRate to camera angle (Mixing Roll and Yaw)
+    if (rxConfig()->fpvCamAngleDegrees && IS_RC_MODE_ACTIVE(BOXFPVANGLEMIX) && !FLIGHT_MODE(HEADFREE_MODE)) {
+        scaleRcCommandToFpvCamAngle();
+    }
+}
+
 #define THROTTLE_BUFFER_MAX 20
 #define THROTTLE_DELTA_MS 100
 
@@ -531,6 +561,62 @@ FAST_CODE uint8_t processRcSmoothingFilter(void)
 
     return interpolationChannels;
 }
+
+// Upsample the rx frames with cubic Hermite segments. The rates curve and camera angle mixing run once per rx
+// frame on the raw sticks, and each PID loop only evaluates the segments, which also yields the setpoint
+// derivative for feedforward without a separate derivative filter.
+static FAST_CODE void processRcSpline(void)
+{
+    static FAST_RAM_ZERO_INIT float splineTimeS;
+    static FAST_RAM_ZERO_INIT bool initialized;
+
+    if (isRXDataNew) {
+        calculateSetpointRates(FD_YAW);
+
+        // the first frame, or one after a gap, has no usable interval so the segments restart from it
+        const bool restart = !initialized || !rxIsReceivingSignal() || !rcSmoothingRxRateValid(currentRxRefreshRate);
+        const float frameTimeS = currentRxRefreshRate * 1e-6f;
+        for (int i = 0; i < PRIMARY_CHANNEL_COUNT; i++) {
+            if ((1 << i) & interpolationChannels) {
+                if (restart) {
+                    hermiteSplineInit(&rcCommandSpline[i], rcCommand[i]);
+                } else {
+                    hermiteSplineUpdate(&rcCommandSpline[i], rcCommand[i], frameTimeS);
+                }
+                if (i <= FD_YAW) {
+                    if (restart) {
+                        hermiteSplineInit(&setpointSpline[i], setpointRate[i]);
+                    } else {
+                        hermiteSplineUpdate(&setpointSpline[i], setpointRate[i], frameTimeS);
+                    }
+                }
+            }
+        }
+        initialized = true;
+        splineTimeS = 0.0f;
+
+        DEBUG_SET(DEBUG_RC_INTERPOLATION, 0, lrintf(rcCommand[0]));
+        DEBUG_SET(DEBUG_RC_INTERPOLATION, 1, lrintf(currentRxRefreshRate / 1000));
+    } else {
+        splineTimeS += targetPidLooptime * 1e-6f;
+    }
+
+    for (int i = 0; i < PRIMARY_CHANNEL_COUNT; i++) {
+        if ((1 << i) & interpolationChannels) {
+            hermiteSplineEvaluate(&rcCommandSpline[i], splineTimeS);
+            rcCommand[i] = rcCommandSpline[i].value;
+            if (i <= FD_YAW) {
+                hermiteSplineEvaluate(&setpointSpline[i], splineTimeS);
+                setpointRate[i] = setpointSpline[i].value;
+                setpointRateDerivative[i] = setpointSpline[i].derivative;
+                rcDeflection[i] = rcCommand[i] / 500.0f;
+                rcDeflectionAbs[i] = fabsf(rcDeflection[i]);
+            }
+        }
+    }
+
+    DEBUG_SET(DEBUG_RC_INTERPOLATION, 2, lrintf(setpointRateDerivative[0] * 0.1f));
+}
 #endif // USE_RC_SMOOTHING_FILTER
 
 FAST_CODE void processRcCommand(void)
@@ -541,6 +627,16 @@ FAST_CODE void processRcCommand(void)
         checkForThrottleErrorResetState(currentRxRefreshRate);
     }
 
+#ifdef USE_RC_SMOOTHING_FILTER
+    if (rxConfig()->rc_smoothing_type == RC_SMOOTHING_TYPE_SPLINE) {
+        // the spline produces setpoints and their derivatives itself
+        processRcSpline();
+        DEBUG_SET(DEBUG_RC_INTERPOLATION, 3, setpointRate[0]);
+        isRXDataNew = false;
+        return;
+    }
+#endif // USE_RC_SMOOTHING_FILTER
+
     switch (rxConfig()->rc_smoothing_type) {
 #ifdef USE_RC_SMOOTHING_FILTER
     case RC_SMOOTHING_TYPE_FILTER:
@@ -555,23 +651,9 @@ FAST_CODE void processRcCommand(void)
 
     if (isRXDataNew || updatedChannel) {
         const uint8_t maxUpdatedAxis = isRXDataNew ? FD_YAW : MIN(updatedChannel, FD_YAW); // throttle channel doesn't require rate calculation
-#if defined(SIMULATOR_BUILD)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunsafe-loop-optimizations"
-#endif
-        for (int axis = FD_ROLL; axis <= maxUpdatedAxis; axis++) {
-#if defined(SIMULATOR_BUILD)
-#pragma GCC diagnostic pop
-#endif
-            calculateSetpointRate(axis);
-        }
+        calculateSetpointRates(maxUpdatedAxis);
 
         DEBUG_SET(DEBUG_RC_INTERPOLATION, 3, setpointRate[0]);
-
-        // Scaling of AngleRate to camera angle (Mixing Roll and Yaw)
-        if (rxConfig()->fpvCamAngleDegrees && IS_RC_MODE_ACTIVE(BOXFPVANGLEMIX) && !FLIGHT_MODE(HEADFREE_MODE)) {
-            scaleRcCommandToFpvCamAngle();
-        }
     }
 
     if (isRXDataNew) {
@@ -732,6 +814,17 @@ void initRcProcessing(void)
     }
 }
 
+// Axes whose setpoint derivative comes from the rc spline instead of differencing the setpoint
+uint8_t rcSmoothingSplineAxes(void)
+{
+#ifdef USE_RC_SMOOTHING_FILTER
+    if (rxConfig()->rc_smoothing_type == RC_SMOOTHING_TYPE_SPLINE) {
+        return interpolationChannels & (ROLL_FLAG | PITCH_FLAG | YAW_FLAG);
+    }
+#endif
+    return 0;
+}
+
 bool rcSmoothingIsEnabled(void)
 {
     return !(
@@ -63,7 +63,8 @@ typedef enum {
 
 typedef enum {
     RC_SMOOTHING_TYPE_INTERPOLATION,
-    RC_SMOOTHING_TYPE_FILTER
+    RC_SMOOTHING_TYPE_FILTER,
+    RC_SMOOTHING_TYPE_SPLINE
 } rcSmoothingType_e;
 
 typedef enum {
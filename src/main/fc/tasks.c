@@ -163,8 +163,10 @@ static void taskUpdateRxMain(timeUs_t currentTimeUs)
         return;
     }
 
+    // use the interval between frame arrivals rather than between rx task runs, so scheduling delays don't show up as rc jitter
     static timeUs_t lastRxTimeUs;
-    currentRxRefreshRate = constrain(currentTimeUs - lastRxTimeUs, 1000, 30000);
+    const timeDelta_t frameDeltaUs = rxGetFrameDelta();
+    currentRxRefreshRate = constrain(frameDeltaUs > 0 ? frameDeltaUs : cmpTimeUs(currentTimeUs, lastRxTimeUs), 1000, 30000);
     lastRxTimeUs = currentTimeUs;
     isRXDataNew = true;
 
@@ -399,6 +401,7 @@ cfTask_t cfTasks[TASK_COUNT] = {
 #endif
     [TASK_RX] = DEFINE_TASK("RX", NULL, rxUpdateCheck, taskUpdateRxMain, TASK_PERIOD_HZ(33), TASK_PRIORITY_HIGH), // If event-based scheduling doesn't work, fallback to periodic scheduling
     [TASK_DISPATCH] = DEFINE_TASK("DISPATCH", NULL, NULL, dispatchProcess, TASK_PERIOD_HZ(1000), TASK_PRIORITY_HIGH),
+    [TASK_MSP_STREAM] = DEFINE_TASK("MSP_STREAM", NULL, NULL, mspFcStreamProcess, TASK_PERIOD_HZ(50), TASK_PRIORITY_LOW), // enabled and rescheduled by MSP2_ORNIFLIGHT_STREAM
 
 #ifdef USE_BEEPER
     [TASK_BEEPER] = DEFINE_TASK("BEEPER", NULL, NULL, beeperUpdate, TASK_PERIOD_HZ(100), TASK_PRIORITY_LOW),
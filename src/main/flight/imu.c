@@ -84,6 +84,7 @@ static bool imuUpdated = false;
 #define ATTITUDE_RESET_KP_GAIN    25.0     // dcmKpGain value to use during attitude reset
 #define ATTITUDE_RESET_ACTIVE_TIME 500000  // 500ms - Time to wait for attitude to converge at high gain
 #define GPS_COG_MIN_GROUNDSPEED 500        // 500cm/s minimum groundspeed for a gps heading to be considered valid
+#define IMU_STROKE_SYNC_TIMEOUT_US 500000  // 500ms - longest stroke (2Hz) before falling back to the attitude task period
 
 int32_t accSum[XYZ_AXIS_COUNT];
 float accAverage[XYZ_AXIS_COUNT];
@@ -99,11 +100,22 @@ static float smallAngleCosZ = 0;
 
 static imuRuntimeConfig_t imuRuntimeConfig;
 
+// Stroke-synchronous accumulation: gyro and acc averages over whole flap periods, summed until the attitude task runs
+static timeUs_t strokeStartTimeUs;
+static bool strokeAccumulating;
+static float strokeGyroSum[XYZ_AXIS_COUNT];
+static float strokeAccSum[XYZ_AXIS_COUNT];
+static timeDelta_t strokeTimeUs;
+static timeDelta_t strokeAccTimeUs;
+
 STATIC_UNIT_TESTED float rMat[3][3];
 
 // quaternion of sensor frame relative to earth frame
 STATIC_UNIT_TESTED quaternion q = QUATERNION_INITIALIZE;
 STATIC_UNIT_TESTED quaternionProducts qP = QUATERNION_PRODUCTS_INITIALIZE;
+// q propagated by gyro alone at PID rate, restarted from q by every full update
+static quaternion qFast = QUATERNION_INITIALIZE;
+static bool qFastValid = false;
 // headfree quaternions
 quaternion headfree = QUATERNION_INITIALIZE;
 quaternion offset = QUATERNION_INITIALIZE;
@@ -111,12 +123,14 @@ quaternion offset = QUATERNION_INITIALIZE;
 // absolute angle inclination in multiple of 0.1 degree    180 deg = 1800
 attitudeEulerAngles_t attitude = EULER_INITIALIZE;
 
-PG_REGISTER_WITH_RESET_TEMPLATE(imuConfig_t, imuConfig, PG_IMU_CONFIG, 1);
+PG_REGISTER_WITH_RESET_TEMPLATE(imuConfig_t, imuConfig, PG_IMU_CONFIG, 3);
 
 PG_RESET_TEMPLATE(imuConfig_t, imuConfig,
     .dcm_kp = 2500,                // 1.0 * 10000
     .dcm_ki = 0,                   // 0.003 * 10000
     .small_angle = 25,
+    .stroke_sync = 0,
+    .fast_attitude = 1,
 );
 
 STATIC_UNIT_TESTED void imuComputeRotationMatrix(void){
@@ -428,6 +442,61 @@ static float imuCalcKpGain(timeUs_t currentTimeUs, bool useAcc, float *gyroAvera
     return ret;
 }
 
+// Called by the PID loop each time the wing ODE completes a stroke (theta passes a multiple of 2π).
+// The gyro and acc accumulators restart here, so the averages taken cover exactly one flap period and
+// the periodic body acceleration and wing-induced rotation cancel out of them.
+void imuStrokeBoundary(timeUs_t currentTimeUs)
+{
+    if (!imuConfig()->stroke_sync) {
+        return;
+    }
+
+    const timeDelta_t strokeDurationUs = cmpTimeUs(currentTimeUs, strokeStartTimeUs);
+    strokeStartTimeUs = currentTimeUs;
+
+    float gyroAverage[XYZ_AXIS_COUNT];
+    float accStrokeAverage[XYZ_AXIS_COUNT];
+    gyroGetAccumulationAverage(gyroAverage);
+    const bool haveAcc = accGetAccumulationAverage(accStrokeAverage);
+
+    // The first boundary after a gap only starts the accumulation, the window before it is not a whole stroke
+    if (strokeAccumulating && strokeDurationUs > 0 && strokeDurationUs <= IMU_STROKE_SYNC_TIMEOUT_US) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            strokeGyroSum[axis] += gyroAverage[axis] * strokeDurationUs;
+            if (haveAcc) {
+                strokeAccSum[axis] += accStrokeAverage[axis] * strokeDurationUs;
+            }
+        }
+        strokeTimeUs += strokeDurationUs;
+        if (haveAcc) {
+            strokeAccTimeUs += strokeDurationUs;
+        }
+    }
+    strokeAccumulating = true;
+}
+
+static void imuResetStrokeSums(void)
+{
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        strokeGyroSum[axis] = 0.0f;
+        strokeAccSum[axis] = 0.0f;
+    }
+    strokeTimeUs = 0;
+    strokeAccTimeUs = 0;
+}
+
+static bool imuStrokeSyncActive(timeUs_t currentTimeUs)
+{
+    if (strokeAccumulating && imuConfig()->stroke_sync && cmpTimeUs(currentTimeUs, strokeStartTimeUs) <= IMU_STROKE_SYNC_TIMEOUT_US) {
+        return true;
+    }
+
+    // Not flapping (glide, disarmed) or strokes too slow: use the accumulators directly, the next boundary starts over
+    strokeAccumulating = false;
+    imuResetStrokeSums();
+    return false;
+}
+
 static void imuCalculateEstimatedAttitude(timeUs_t currentTimeUs)
 {
     static timeUs_t previousIMUUpdateTime;
@@ -436,7 +505,7 @@ static void imuCalculateEstimatedAttitude(timeUs_t currentTimeUs)
     bool useCOG = false; // Whether or not correct yaw via imuMahonyAHRSupdate from our ground course
     float courseOverGround = 0; // To be used when useCOG is true.  Stored in Radians
 
-    const timeDelta_t deltaT = currentTimeUs - previousIMUUpdateTime;
+    timeDelta_t deltaT = currentTimeUs - previousIMUUpdateTime;
     previousIMUUpdateTime = currentTimeUs;
 
 #ifdef USE_MAG
@@ -480,6 +549,7 @@ static void imuCalculateEstimatedAttitude(timeUs_t currentTimeUs)
     UNUSED(courseOverGround);
     UNUSED(deltaT);
     UNUSED(imuCalcKpGain);
+    UNUSED(imuStrokeSyncActive);
 #else
 
 #if defined(SIMULATOR_BUILD) && defined(SIMULATOR_IMU_SYNC)
@@ -487,10 +557,29 @@ static void imuCalculateEstimatedAttitude(timeUs_t currentTimeUs)
     deltaT = imuDeltaT;
 #endif
     float gyroAverage[XYZ_AXIS_COUNT];
-    gyroGetAccumulationAverage(gyroAverage);
+    if (imuStrokeSyncActive(currentTimeUs)) {
+        // Hold until a stroke completes, then update once over the whole strokes since the last update
+        previousIMUUpdateTime = strokeStartTimeUs;
+        if (strokeTimeUs == 0) {
+            return;
+        }
+        deltaT = strokeTimeUs;
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            gyroAverage[axis] = strokeGyroSum[axis] / strokeTimeUs;
+            if (strokeAccTimeUs > 0) {
+                accAverage[axis] = strokeAccSum[axis] / strokeAccTimeUs;
+            }
+        }
+        if (strokeAccTimeUs > 0) {
+            useAcc = imuIsAccelerometerHealthy(accAverage);
+        }
+        imuResetStrokeSums();
+    } else {
+        gyroGetAccumulationAverage(gyroAverage);
 
-    if (accGetAccumulationAverage(accAverage)) {
-        useAcc = imuIsAccelerometerHealthy(accAverage);
+        if (accGetAccumulationAverage(accAverage)) {
+            useAcc = imuIsAccelerometerHealthy(accAverage);
+        }
     }
 
     imuMahonyAHRSupdate(deltaT * 1e-6f,
@@ -500,9 +589,45 @@ static void imuCalculateEstimatedAttitude(timeUs_t currentTimeUs)
                         useCOG, courseOverGround,  imuCalcKpGain(currentTimeUs, useAcc, gyroAverage));
 
     imuUpdateEulerAngles();
+
+    qFast = q;
+    qFastValid = true;
 #endif
 }
 
+// Gyro-only step run from the PID loop so that roll and pitch are current when the level modes read them.
+// The next full update replaces the result, so its acc/mag correction still applies at the attitude task rate.
+void imuPropagateAttitude(const float *gyroRate, float dt)
+{
+    if (!qFastValid || !imuConfig()->fast_attitude || FLIGHT_MODE(HEADFREE_MODE)) {
+        return;
+    }
+
+    const float gx = DEGREES_TO_RADIANS(gyroRate[X]) * (0.5f * dt);
+    const float gy = DEGREES_TO_RADIANS(gyroRate[Y]) * (0.5f * dt);
+    const float gz = DEGREES_TO_RADIANS(gyroRate[Z]) * (0.5f * dt);
+
+    const quaternion buffer = qFast;
+    qFast.w += (-buffer.x * gx - buffer.y * gy - buffer.z * gz);
+    qFast.x += (+buffer.w * gx + buffer.y * gz - buffer.z * gy);
+    qFast.y += (+buffer.w * gy - buffer.x * gz + buffer.z * gx);
+    qFast.z += (+buffer.w * gz + buffer.x * gy - buffer.y * gx);
+
+    const float recipNorm = invSqrt(sq(qFast.w) + sq(qFast.x) + sq(qFast.y) + sq(qFast.z));
+    qFast.w *= recipNorm;
+    qFast.x *= recipNorm;
+    qFast.y *= recipNorm;
+    qFast.z *= recipNorm;
+
+    // Only the third row of the rotation matrix is needed for roll and pitch
+    const float r20 = 2.0f * (qFast.x * qFast.z - qFast.w * qFast.y);
+    const float r21 = 2.0f * (qFast.y * qFast.z + qFast.w * qFast.x);
+    const float r22 = 1.0f - 2.0f * (sq(qFast.x) + sq(qFast.y));
+
+    attitude.values.roll = lrintf(atan2_approx(r21, r22) * (1800.0f / M_PIf));
+    attitude.values.pitch = lrintf(((0.5f * M_PIf) - acos_approx(-r20)) * (1800.0f / M_PIf));
+}
+
 static int calculateThrottleAngleCorrection(void)
 {
     /*
@@ -59,6 +59,8 @@ typedef struct imuConfig_s {
     uint16_t dcm_kp;                        // DCM filter proportional gain ( x 10000)
     uint16_t dcm_ki;                        // DCM filter integral gain ( x 10000)
     uint8_t small_angle;
+    uint8_t stroke_sync;                    // Run the attitude update once per flap stroke on whole-stroke averages
+    uint8_t fast_attitude;                  // Propagate roll/pitch with the gyro at PID rate between attitude updates
 } imuConfig_t;
 
 PG_DECLARE(imuConfig_t, imuConfig);
@@ -73,6 +75,8 @@ void imuConfigure(uint16_t throttle_correction_angle, uint8_t throttle_correctio
 float getCosTiltAngle(void);
 void getQuaternion(quaternion * q);
 void imuUpdateAttitude(timeUs_t currentTimeUs);
+void imuStrokeBoundary(timeUs_t currentTimeUs);
+void imuPropagateAttitude(const float *gyroRate, float dt);
 
 void imuResetAccelerationSum(void);
 void imuInit(void);
@@ -47,7 +47,9 @@
 #include "flight/gps_rescue.h"
 #include "flight/imu.h"
 #include "flight/mixer.h"
+#include "flight/position.h"
 #include "flight/servos.h"
+#include "flight/wing_monitor.h"
 
 #include "rx/rx.h"
 #include "pg/rx.h"
@@ -92,6 +94,14 @@ FAST_RAM_ZERO_INIT float shapedFlappingSinusoidRight[MAX_ORNITHOPTER_PAIRS];
 static FAST_RAM_ZERO_INIT float flappingDerivativeLeft[MAX_ORNITHOPTER_PAIRS];
 static FAST_RAM_ZERO_INIT float flappingDerivativeRight[MAX_ORNITHOPTER_PAIRS];
 
+// Servo speed vs. supply voltage. A servo on the flight pack slows down roughly in proportion to its
+// supply, so the rated servo_speed_deg_s only holds on a full pack. The scale runs linearly from 1 at
+// vbatmaxcellvoltage to servo_speed_vmin_pct at vbatmincellvoltage and derates everything that assumes
+// the rated speed: the amplitude feasibility limit, the amplitude clamp and the ODE torque gain k₀.
+#define SERVO_SUPPLY_LPF_HZ      5.0f      // sag follows throttle punches, the ADC noise doesn't matter
+static FAST_RAM_ZERO_INIT pt1Filter_t servoSpeedScaleLpf;
+static FAST_RAM float servoSpeedScale = 1.0f;
+
 // Three-channel breathing-pause modulation — computed from PID terms each cycle,
 // consumed by calculateFlappingFromThrottle on the next iteration (one-frame lag).
 //   CADENCE:  P-term → phase advance (k0 scaling): "push harder now"
@@ -389,6 +399,10 @@ void pidInitFilters(const pidProfile_t *pidProfile)
 {
     STATIC_ASSERT(FD_YAW == 2, FD_YAW_incorrect); // ensure yaw axis is 2
 
+    // with no looptime the gain is zero and the scale holds where it is
+    pt1FilterInit(&servoSpeedScaleLpf, pt1FilterGain(SERVO_SUPPLY_LPF_HZ, dT));
+    servoSpeedScaleLpf.state = servoSpeedScale;
+
     if (targetPidLooptime == 0) {
         // no looptime set, so set all the filters to null
         dtermNotchApplyFn = nullFilterApply;
@@ -605,6 +619,7 @@ static FAST_RAM_ZERO_INIT uint8_t integratedYawRelax;
 // ── Flapping ODE state + hysteresis (must precede pidResetIterm which resets them) ──
 static float omega = 0.0;
 static float theta = 0.0;
+static bool strokeCompleted = false;
 static bool hasCrossedFlightThreshold = false;
 static bool hysteresisElevated = false;
 #define GLIDE_HYSTERESIS 50
@@ -619,6 +634,7 @@ void pidResetIterm(void)
     }
     // ── Reset flapping state on arm (GralhaAzul: aoDespertarParaOCantoDoEter) ──
     theta = M_PIf * 0.5f;  // π/2: neutral mid-stroke — avoids extreme on first frame
+    strokeCompleted = false;
     omega = 0.0f;
     hasCrossedFlightThreshold = false;
     hysteresisElevated = false;
@@ -661,6 +677,29 @@ float k0 = CADENCE_K0;
 float k2 = ANCHOR_BASE_K2;
 
 
+// SSFF and Prescience follow the front wing pair
+#define SSFF_PAIR                0
+
+static float flappingSin(float theta)
+{
+    float s, c;
+    sincos_approx(theta, &s, &c);
+    return s;
+}
+
+// The stroke of the SSFF pair as its slew limited servos follow it: the pair's sinusoid plus their tracking
+// error, in units of that sinusoid. Equal to the commanded sinusoid while the servos keep up.
+static float achievedFlappingSinusoid(void)
+{
+    const float pairSinusoid = flappingSin(theta + (float)servoConfig()->flapping_phase_shift[SSFF_PAIR] * RAD);
+    // applyFlappingToServos() scales the pair's flapping inputs by the amplitude and by motor output / 100
+    const float inputScale = flappingAmplitude * (motor[SSFF_PAIR * 2] + motor[SSFF_PAIR * 2 + 1] - 2000.0f) * 0.005f;
+    if (inputScale <= 0.0f) {
+        return pairSinusoid;
+    }
+    return constrainf(pairSinusoid + getServoTrackingError(SSFF_PAIR) / inputScale, -1.0f, 1.0f);
+}
+
 // Stroke-Synchronous Feed-Forward: measures pitch error over each half-stroke
 // and biases the next stroke's ferocity to cancel repetitive flap-frequency error.
 // Called from PID loop on PITCH axis with the raw pitch errorRate (deg/s).
@@ -668,21 +707,25 @@ float k2 = ANCHOR_BASE_K2;
 static void applyStrokeSynchronousFF(float pitchErrorRate) {
     if (currentOrnithopterProfile()->ssff_gain == 0) return;
 
+    // Half-strokes and reversals are those of the wing the servos actually drive
+    const float wingSinusoid = achievedFlappingSinusoid();
+
     // Prescience: predict error at next reversal from wing ODE state.
-    // Time to next half-stroke boundary = π/|ω|.
+    // Time to next half-stroke boundary = π/|ω|, plus the time the servos
+    // need to catch up with the commanded stroke.
     // predictedError = error + errorRate · dt → the error when the wing reverses.
     // This eliminates SSFF's half-stroke measurement delay.
     float prescienceBias = 0.0f;
     int8_t prescienceGain = currentOrnithopterProfile()->prescience_gain;
     if (prescienceGain != 0 && fabsf(omega) > 0.5f) {
-        float dtToReversal = M_PIf / fabsf(omega);
+        const float dtToReversal = M_PIf / fabsf(omega) + getServoTrackingDelay(SSFF_PAIR);
         float predictedError = pitchErrorRate * dtToReversal;  // errorRate is deg/s, reversal is ~0.05s away
         prescienceBias = (float)prescienceGain * PRESCIENCE_SCALE * predictedError;
     }
 
     // Detect zero crossing of flapping sinusoid
-    if (prevFlappingSinusoid * flappingSinusoid <= 0.0f
-        && prevFlappingSinusoid != flappingSinusoid) {
+    if (prevFlappingSinusoid * wingSinusoid <= 0.0f
+        && prevFlappingSinusoid != wingSinusoid) {
 
         // Blend SSFF (accumulated, learned) + Prescience (predicted, fast)
         float meanError = (ssffAccumCount > 0) ? ssffAccumError / (float)ssffAccumCount : 0.0f;
@@ -720,7 +763,7 @@ static void applyStrokeSynchronousFF(float pitchErrorRate) {
 
     ssffAccumError += pitchErrorRate;
     ssffAccumCount++;
-    prevFlappingSinusoid = flappingSinusoid;
+    prevFlappingSinusoid = wingSinusoid;
 }
 
 // Espelho: wing-self-noise cancellation via reverse lock-in amplifier.
@@ -769,8 +812,23 @@ static float applyResonanceFilter(float errorRate, float sinTheta) {
     return errorRate + resonanceBoost;
 }
 
-static void applyFerocityWaveShaping(float theta, float dMod, float iBias,
-                                      float *outShaped, float *outDerivative) {
+// Keeps theta in [0, 2π): a growing float loses step resolution and stops advancing
+// after about 48 minutes of flapping. Returns true when a whole stroke has completed.
+STATIC_UNIT_TESTED bool advanceFlappingPhase(float dTheta)
+{
+    theta += dTheta;
+    if (theta >= 2.0f * M_PIf) {
+        theta -= 2.0f * M_PIf;
+        return true;
+    }
+    if (theta < 0.0f) {
+        theta += 2.0f * M_PIf;
+    }
+    return false;
+}
+
+STATIC_UNIT_TESTED bool applyFerocityWaveShaping(float theta, float dMod, float iBias,
+                                           float *outShaped, float *outDerivative) {
     // Trapezoidal wave shaping with cos-ramp between dwell zones.
     // Replaces old tanh(F·sinθ)/tanh(F) with explicit breathing pause.
     //
@@ -781,13 +839,14 @@ static void applyFerocityWaveShaping(float theta, float dMod, float iBias,
     //
     // Shared limiar (reversal θ) computed from RAW config ferocities
     // so PID activity doesn't shift stroke reversal timing.
+    //
+    // Returns true when the modulated ferocity hit the trapezoid range.
 
     const float pi    = 3.14159265358979f;
     const float twoPi = 2.0f * pi;
 
     // Normalize theta to [0, 2π)
-    float tNorm = fmodf(theta, twoPi);
-    if (tNorm < 0.0f) tNorm += twoPi;
+    float tNorm = wrap_2pi(theta);
 
     // Base ferocities from config (raw, before modulation)
     float fDRaw = ferocityParamToFloat(currentOrnithopterProfile()->ferocity_downstroke);
@@ -802,6 +861,7 @@ static void applyFerocityWaveShaping(float theta, float dMod, float iBias,
     fD *= dFactor;
     fU *= dFactor;
 
+    const bool saturated = fD < 0.0f || fD > FEROCITY_RANGE || fU < 0.0f || fU > FEROCITY_RANGE;
     fD = constrainf(fD, 0.0f, FEROCITY_RANGE);
     fU = constrainf(fU, 0.0f, FEROCITY_RANGE);
 
@@ -814,7 +874,7 @@ static void applyFerocityWaveShaping(float theta, float dMod, float iBias,
     if (fD >= FEROCITY_RANGE - 0.001f && fU >= FEROCITY_RANGE - 0.001f) {
         *outShaped = (tNorm < limiar) ? 1.0f : -1.0f;
         *outDerivative = 0.0f;
-        return;
+        return saturated;
     }
 
     bool descida = (tNorm < limiar);
@@ -845,17 +905,19 @@ static void applyFerocityWaveShaping(float theta, float dMod, float iBias,
     } else {
         // Cos ramp: cos(π·(t-dh)/(1-d))
         float k = pi / (1.0f - d);
-        float rampArg = k * (t - dh);
-        float rampVal = cosf(rampArg);
+        float rampArg = k * (t - dh);  // ∈ [0, π]
+        float rampSin, rampVal;
+        sincos_ramp_approx(rampArg, &rampSin, &rampVal);
         *outShaped = descida ? rampVal : -rampVal;
 
         // Derivative: d/dθ[±cos(k·(t(θ)-dh))] = ∓k·sin(k·(t-dh)) · dt/dθ
-        float dRamp_dt = -k * sinf(rampArg);
+        float dRamp_dt = -k * rampSin;
         dShaped_dTheta = dRamp_dt * dt_dtheta;
         if (!descida) dShaped_dTheta = -dShaped_dTheta;
     }
 
     *outDerivative = dShaped_dTheta * thetadot;
+    return saturated;
 }
 
 void calculateFlappingFromThrottle(float rc_throttle) {
@@ -910,12 +972,12 @@ void calculateFlappingFromThrottle(float rc_throttle) {
         // Throttle stick → amplitude, AUX channel → frequency (direct)
         float omegaCmd = 2.0f * M_PIf * freqFromAux;
         omegaCmd *= flappingPhaseModulation;
-        theta = theta + omegaCmd * dT;
+        strokeCompleted |= advanceFlappingPhase(omegaCmd * dT);
         omega = omegaCmd;
         omegadot = 0.0f;
         thetadot = omega;
 
-        flappingSinusoid = sinf(theta);
+        flappingSinusoid = flappingSin(theta);
 
         // ── Wave shaping ──
         float leftMod  = flappingFerocityModulation
@@ -928,10 +990,13 @@ void calculateFlappingFromThrottle(float rc_throttle) {
         float legacySum = 0.0f;
         for (int p = 0; p < MAX_ORNITHOPTER_PAIRS; p++) {
             float thetaP = theta + (float)sc->flapping_phase_shift[p] * RAD;
-            applyFerocityWaveShaping(thetaP, leftMod,  flappingAsymmetryBias,
-                                     &shapedFlappingSinusoidLeft[p], &flappingDerivativeLeft[p]);
-            applyFerocityWaveShaping(thetaP, rightMod, flappingAsymmetryBias,
-                                     &shapedFlappingSinusoidRight[p], &flappingDerivativeRight[p]);
+            bool saturated = applyFerocityWaveShaping(thetaP, leftMod,  flappingAsymmetryBias,
+                                                      &shapedFlappingSinusoidLeft[p], &flappingDerivativeLeft[p]);
+            saturated |= applyFerocityWaveShaping(thetaP, rightMod, flappingAsymmetryBias,
+                                                  &shapedFlappingSinusoidRight[p], &flappingDerivativeRight[p]);
+            if (saturated) {
+                wingSaturationHit(p, WING_SATURATION_FEROCITY);
+            }
             legacySum += shapedFlappingSinusoidLeft[p] + shapedFlappingSinusoidRight[p];
         }
 
@@ -941,14 +1006,15 @@ void calculateFlappingFromThrottle(float rc_throttle) {
         // Higher AUX frequency → smaller torque → ODE converges to that frequency
         tcommand = (rc_throttle - 480.0) * (1.0f / (0.1f * freqFromAux));
 
-        float modulatedK0 = k0 * flappingPhaseModulation;
+        // k₀ follows the servo speed: the wing settles at a stroke rate the servos can still follow
+        float modulatedK0 = k0 * servoSpeedScale * flappingPhaseModulation;
         omegadot = modulatedK0 * tcommand - k2 * omega;
         thetadot = omega;
 
-        theta = theta + omega * dT;
+        strokeCompleted |= advanceFlappingPhase(omega * dT);
         omega = omega + omegadot * dT;
 
-        flappingSinusoid = sinf(theta);
+        flappingSinusoid = flappingSin(theta);
 
         float leftMod  = flappingFerocityModulation
                        + flappingFerocityDifferentialRoll
@@ -960,10 +1026,13 @@ void calculateFlappingFromThrottle(float rc_throttle) {
         float legacySum = 0.0f;
         for (int p = 0; p < MAX_ORNITHOPTER_PAIRS; p++) {
             float thetaP = theta + (float)sc->flapping_phase_shift[p] * RAD;
-            applyFerocityWaveShaping(thetaP, leftMod,  flappingAsymmetryBias,
-                                     &shapedFlappingSinusoidLeft[p], &flappingDerivativeLeft[p]);
-            applyFerocityWaveShaping(thetaP, rightMod, flappingAsymmetryBias,
-                                     &shapedFlappingSinusoidRight[p], &flappingDerivativeRight[p]);
+            bool saturated = applyFerocityWaveShaping(thetaP, leftMod,  flappingAsymmetryBias,
+                                                      &shapedFlappingSinusoidLeft[p], &flappingDerivativeLeft[p]);
+            saturated |= applyFerocityWaveShaping(thetaP, rightMod, flappingAsymmetryBias,
+                                                  &shapedFlappingSinusoidRight[p], &flappingDerivativeRight[p]);
+            if (saturated) {
+                wingSaturationHit(p, WING_SATURATION_FEROCITY);
+            }
             legacySum += shapedFlappingSinusoidLeft[p] + shapedFlappingSinusoidRight[p];
         }
 
@@ -972,6 +1041,20 @@ void calculateFlappingFromThrottle(float rc_throttle) {
 }
 
 
+void getOrnithopterWingState(ornithopterWingState_t *state)
+{
+    state->theta = theta;
+    state->omega = omega;
+    state->amplitude = flappingAmplitude;
+    state->flapping = ornithopterFlapping;
+    state->phaseModulation = flappingPhaseModulation;
+    state->ferocityModulation = flappingFerocityModulation;
+    state->ferocityDifferentialRoll = flappingFerocityDifferentialRoll;
+    state->ferocityDifferentialYaw = flappingFerocityDifferentialYaw;
+    state->asymmetryBias = flappingAsymmetryBias;
+}
+
+
 float aerolastic_Kp_scaling = 0.01;
 float aerolastic_Ki_scaling = 0.005;
 float aerolastic_Kd_scaling = -0.005;
@@ -993,6 +1076,35 @@ void adjustAerolasticPIDGains(float errorRate, float* Kp, float* Ki, float* Kd)
 }
 
 
+static void updateServoSpeedScale(void)
+{
+    const servoConfig_t *sc = servoConfig();
+    const uint8_t cellCount = getBatteryCellCount();
+    const uint16_t vbatMaxCell = batteryConfig()->vbatmaxcellvoltage;
+    const uint16_t vbatMinCell = batteryConfig()->vbatmincellvoltage;
+    float scale = 1.0f;
+
+    if (sc->servo_speed_vmin_pct < 100 && cellCount > 0 && vbatMaxCell > vbatMinCell) {
+        const float sag = (float)(vbatMaxCell * cellCount - getBatteryVoltageLatest()) / ((vbatMaxCell - vbatMinCell) * cellCount);
+        scale = 1.0f - constrainf(sag, 0.0f, 1.0f) * (100 - sc->servo_speed_vmin_pct) * 0.01f;
+    }
+    servoSpeedScale = pt1FilterApply(&servoSpeedScaleLpf, scale);
+
+    DEBUG_SET(DEBUG_SERVO_SAG, 0, getBatteryVoltageLatest());
+    DEBUG_SET(DEBUG_SERVO_SAG, 1, lrintf(servoSpeedScale * 1000));
+    DEBUG_SET(DEBUG_SERVO_SAG, 2, lrintf(sc->servo_speed_deg_s * servoSpeedScale));
+}
+
+float getServoSpeedScale(void)
+{
+    return servoSpeedScale;
+}
+
+float getFlappingSinusoid(void)
+{
+    return flappingSinusoid;
+}
+
 float getFlappingAmplitude(float rc_throttle) {
     const servoConfig_t *sc = servoConfig();
     // BOX GLIDE overrides throttle — force zero amplitude
@@ -1005,18 +1117,24 @@ float getFlappingAmplitude(float rc_throttle) {
             float amp = ((rc_throttle - 1000.0f) * (1.0f / 1000.0f))
                       * (float)sc->servo_max_amplitude;
             // Physical feasibility: A ≤ servo_speed / (2π·f_max)
-            float speedLimit = (float)sc->servo_speed_deg_s
+            float speedLimit = (float)sc->servo_speed_deg_s * servoSpeedScale
                              / (2.0f * M_PIf * (float)sc->ornithopter_freq_max + 0.01f);
-            if (amp > speedLimit) amp = speedLimit;
+            if (amp > speedLimit) {
+                amp = speedLimit;
+                wingSaturationHitAllPairs(WING_SATURATION_SLEW);
+            }
             return amp;
         }
         // Coupled mode: flap_magnitude = 4 → 0.04 °/µs
         float amp = ((rc_throttle - GLIDE_MODE_THRESHOLD) * (float)sc->flap_magnitude * 0.01f)
                   * (float)sc->flap_base_amplitude * 0.1f;
-        // Hard clamp to servo mechanical limit
-        float maxAmp = (float)sc->servo_max_amplitude;
-        if (amp > maxAmp) amp = maxAmp;
-        else if (amp < -maxAmp) amp = -maxAmp;
+        // Hard clamp to servo mechanical limit, narrowed with the servo speed so the
+        // stroke stays as feasible as it was on a full pack
+        float maxAmp = (float)sc->servo_max_amplitude * servoSpeedScale;
+        if (amp > maxAmp || amp < -maxAmp) {
+            amp = constrainf(amp, -maxAmp, maxAmp);
+            wingSaturationHitAllPairs(WING_SATURATION_AMPLITUDE);
+        }
         return amp;
     } else return 0.0;
 }
@@ -1732,6 +1850,9 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
         levelModeStartTimeUs = 0;
     }
     gpsRescuePreviousState = gpsRescueIsActive;
+
+    // Bring roll and pitch up to date with this loop's gyro before the level modes read them
+    imuPropagateAttitude(gyro.gyroADCf, dT);
 #endif
 
 
@@ -1763,6 +1884,7 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
 #endif
     
     // init flapping
+    updateServoSpeedScale();
     flappingAmplitude = getFlappingAmplitude(throttle_ * 1000 + 1000);
 
     // Anchor: variable k₂ damping — controls frequency lock strength.
@@ -1771,6 +1893,17 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
     k2 = ANCHOR_BASE_K2 + (float)currentOrnithopterProfile()->anchor_gain * ANCHOR_SCALE;
 
     calculateFlappingFromThrottle(throttle_ * 1000 + 1000);
+
+    // Stroke boundary at each 2π of wing phase: lets the attitude and altitude estimates average over whole flap periods
+    if (strokeCompleted) {
+        strokeCompleted = false;
+#ifdef USE_ACC
+        imuStrokeBoundary(currentTimeUs);
+#endif
+#ifdef USE_BARO
+        positionStrokeBoundary(currentTimeUs);
+#endif
+    }
     
     // ----------PID controller----------
     // Reset per-frame accumulators for the NEXT calculateFlappingFromThrottle call
@@ -1780,6 +1913,10 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
     flappingPhaseModulation = 1.0f;
     flappingAsymmetryBias = 0.0f;
 
+#ifdef USE_RC_SMOOTHING_FILTER
+    const uint8_t rcSplineAxes = rcSmoothingSplineAxes();
+#endif
+
     for (int axis = FD_ROLL; axis <= FD_YAW; ++axis) {
         float currentPidSetpoint = getSetpointRate(axis);
         if (maxVelocity[axis]) {
@@ -1962,7 +2099,12 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
         previousPidSetpoint[axis] = currentPidSetpoint;
 
 #ifdef USE_RC_SMOOTHING_FILTER
-        pidSetpointDelta = applyRcSmoothingDerivativeFilter(axis, pidSetpointDelta);
+        if ((rcSplineAxes & (1 << axis)) && currentPidSetpoint == getSetpointRate(axis)) {
+            // the rc spline supplies the setpoint slope directly, no derivative filter needed
+            pidSetpointDelta = getSetpointRateDerivative(axis) * dT;
+        } else {
+            pidSetpointDelta = applyRcSmoothingDerivativeFilter(axis, pidSetpointDelta);
+        }
 #endif // USE_RC_SMOOTHING_FILTER
 
         // -----calculate D component
@@ -208,6 +208,23 @@ extern float shapedFlappingSinusoidLeft[];
 extern float shapedFlappingSinusoidRight[];
 extern float throttle_;
 
+// Snapshot of the wing ODE and the breathing-pause modulation channels, for telemetry
+typedef struct ornithopterWingState_s {
+    float theta;                    // stroke phase, rad, wrapped to [0, 2π)
+    float omega;                    // stroke rate, rad/s
+    float amplitude;                // flapping amplitude, °
+    float flapping;                 // mean shaped stroke × amplitude, °
+    float phaseModulation;          // CADENCE
+    float ferocityModulation;       // FEROCITY
+    float ferocityDifferentialRoll; // WARP roll
+    float ferocityDifferentialYaw;  // WARP yaw
+    float asymmetryBias;            // BALANCE
+} ornithopterWingState_t;
+
+void getOrnithopterWingState(ornithopterWingState_t *state);
+float getServoSpeedScale(void);
+float getFlappingSinusoid(void);
+
 void pidResetIterm(void);
 void pidStabilisationState(pidStabilisationState_e pidControllerState);
 void pidSetItermAccelerator(float newItermAccelerator);
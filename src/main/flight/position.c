@@ -68,6 +68,87 @@ int16_t calculateEstimatedVario(int32_t baroAlt, const uint32_t dTime) {
 }
 #endif
 
+#ifdef USE_BARO
+// While flapping the baro reading swings at the stroke frequency. Each stroke boundary from the wing ODE
+// closes a window of whole strokes (see baroStrokeBoundary()), stamped at its middle, and altitude and
+// climb rate come from a least squares line through the last few windows.
+#define STROKE_ALTITUDE_WINDOW_COUNT    4
+#define STROKE_ALTITUDE_TIMEOUT_US      500000  // longer than the slowest stroke (2Hz), after that flapping has stopped
+
+static int32_t strokeAltitudeCm[STROKE_ALTITUDE_WINDOW_COUNT];
+static timeUs_t strokeAltitudeTimeUs[STROKE_ALTITUDE_WINDOW_COUNT];
+static uint8_t strokeAltitudeCount = 0;
+static uint8_t strokeAltitudeIndex = 0;
+static timeUs_t strokeWindowStartUs = 0;
+static timeUs_t lastStrokeBoundaryUs = 0;
+static bool strokeBoundarySeen = false;
+static int32_t strokeFitAltitudeCm = 0;
+static float strokeFitVario = 0;                     // in cm/s
+
+static void fitStrokeAltitude(timeUs_t currentTimeUs)
+{
+    float timeMean = 0;
+    float altitudeMean = 0;
+    for (int i = 0; i < strokeAltitudeCount; i++) {
+        timeMean += cmpTimeUs(strokeAltitudeTimeUs[i], currentTimeUs) * 1e-6f;
+        altitudeMean += strokeAltitudeCm[i];
+    }
+    timeMean /= strokeAltitudeCount;
+    altitudeMean /= strokeAltitudeCount;
+
+    float covariance = 0;
+    float variance = 0;
+    for (int i = 0; i < strokeAltitudeCount; i++) {
+        const float dt = cmpTimeUs(strokeAltitudeTimeUs[i], currentTimeUs) * 1e-6f - timeMean;
+        covariance += dt * (strokeAltitudeCm[i] - altitudeMean);
+        variance += dt * dt;
+    }
+    strokeFitVario = variance > 0 ? covariance / variance : 0;
+
+    // evaluated at the boundary rather than at the last window's middle, half a window less lag
+    strokeFitAltitudeCm = lrintf(altitudeMean - strokeFitVario * timeMean);
+}
+
+void positionStrokeBoundary(timeUs_t currentTimeUs)
+{
+    const bool wholeStroke = strokeBoundarySeen && cmpTimeUs(currentTimeUs, lastStrokeBoundaryUs) <= STROKE_ALTITUDE_TIMEOUT_US;
+    lastStrokeBoundaryUs = currentTimeUs;
+    strokeBoundarySeen = true;
+
+    if (!barometerConfig()->baro_stroke_sync || !sensors(SENSOR_BARO)) {
+        return;
+    }
+
+    int32_t altitudeCm;
+    if (!wholeStroke) {
+        baroStrokeBoundary(false, &altitudeCm);
+        strokeAltitudeCount = 0;
+        strokeWindowStartUs = currentTimeUs;
+        return;
+    }
+    if (!baroStrokeBoundary(true, &altitudeCm)) {
+        return;
+    }
+
+    strokeAltitudeCm[strokeAltitudeIndex] = altitudeCm;
+    strokeAltitudeTimeUs[strokeAltitudeIndex] = strokeWindowStartUs + cmpTimeUs(currentTimeUs, strokeWindowStartUs) / 2;
+    strokeAltitudeIndex = (strokeAltitudeIndex + 1) % STROKE_ALTITUDE_WINDOW_COUNT;
+    strokeAltitudeCount = MIN(strokeAltitudeCount + 1, STROKE_ALTITUDE_WINDOW_COUNT);
+    strokeWindowStartUs = currentTimeUs;
+
+    if (strokeAltitudeCount >= 2) {
+        fitStrokeAltitude(currentTimeUs);
+    }
+}
+
+static bool strokeAltitudeAvailable(timeUs_t currentTimeUs)
+{
+    return barometerConfig()->baro_stroke_sync
+        && strokeAltitudeCount >= 2
+        && cmpTimeUs(currentTimeUs, lastStrokeBoundaryUs) <= STROKE_ALTITUDE_TIMEOUT_US;
+}
+#endif
+
 #if defined(USE_BARO) || defined(USE_GPS)
 static bool altitudeOffsetSet = false;
 
@@ -92,6 +173,7 @@ void calculateEstimatedAltitude(timeUs_t currentTimeUs)
     float gpsTrust = 0.3; //conservative default
     bool haveBaroAlt = false;
     bool haveGpsAlt = false;
+    bool haveStrokeAlt = false;
 #ifdef USE_BARO
     if (sensors(SENSOR_BARO)) {
         if (!isBaroCalibrationComplete()) {
@@ -99,6 +181,10 @@ void calculateEstimatedAltitude(timeUs_t currentTimeUs)
         } else {
             baroAlt = baroCalculateAltitude();
             haveBaroAlt = true;
+            if (strokeAltitudeAvailable(currentTimeUs)) {
+                baroAlt = strokeFitAltitudeCm;
+                haveStrokeAlt = true;
+            }
         }
     }
 #endif
@@ -146,6 +232,13 @@ void calculateEstimatedAltitude(timeUs_t currentTimeUs)
         estimatedVario = calculateEstimatedVario(baroAlt, dTime);
 #endif
     }
+#if defined(USE_BARO) && defined(USE_VARIO)
+    // the stroke fit is already averaged over whole strokes, calculateEstimatedVario() above only keeps its state current
+    if (haveStrokeAlt) {
+        int32_t strokeVario = lrintf(constrainf(strokeFitVario, -1500.0f, 1500.0f));
+        estimatedVario = applyDeadband(strokeVario, 5);
+    }
+#endif
     
     DEBUG_SET(DEBUG_ALTITUDE, 0, (int32_t)(100 * gpsTrust));
     DEBUG_SET(DEBUG_ALTITUDE, 1, baroAlt);
@@ -153,6 +246,7 @@ void calculateEstimatedAltitude(timeUs_t currentTimeUs)
 #ifdef USE_VARIO
     DEBUG_SET(DEBUG_ALTITUDE, 3, estimatedVario);
 #endif
+    UNUSED(haveStrokeAlt);
 }
 
 bool isAltitudeOffset(void)
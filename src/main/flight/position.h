@@ -24,5 +24,6 @@
 
 bool isAltitudeOffset(void);
 void calculateEstimatedAltitude(timeUs_t currentTimeUs);
+void positionStrokeBoundary(timeUs_t currentTimeUs);
 int32_t getEstimatedAltitudeCm(void);
 int16_t getEstimatedVario(void);
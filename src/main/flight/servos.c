@@ -50,6 +50,7 @@
 #include "flight/mixer.h"
 #include "flight/pid.h"
 #include "flight/servos.h"
+#include "flight/wing_monitor.h"
 
 #include "io/gimbal.h"
 
@@ -57,7 +58,7 @@
 
 extern mixerMode_e currentMixerMode;
 
-PG_REGISTER_WITH_RESET_FN(servoConfig_t, servoConfig, PG_SERVO_CONFIG, 1);
+PG_REGISTER_WITH_RESET_FN(servoConfig_t, servoConfig, PG_SERVO_CONFIG, 3);
 
 void pgResetFn_servoConfig(servoConfig_t *servoConfig) {
     servoConfig->dev.servoCenterPulse = 1500;
@@ -71,6 +72,8 @@ void pgResetFn_servoConfig(servoConfig_t *servoConfig) {
     // flapping_phase_shift defaults to 0° for all pairs (all wings flap in phase)
     servoConfig->flap_base_amplitude = 60;
     servoConfig->servo_speed_deg_s = 857;       // 60° / 70ms — typical micro servo
+    servoConfig->servo_speed_vmin_pct = 100;    // servos on a regulated BEC
+    servoConfig->servo_accel_ms = 10;           // micro servo spin-up
     servoConfig->servo_max_amplitude = 55;       // °, ±55° max mechanical throw
     servoConfig->flap_magnitude = 4;             // 4° per 960µs throttle above 1040
     servoConfig->ornithopter_freq_channel = 1;   // AUX2 / CH6
@@ -377,9 +380,9 @@ static float glideCurrentRight[MAX_ORNITHOPTER_PAIRS];
 static bool  glideTransitionActive = false;
 static uint32_t glideLastMicros = 0;
 
-// Servo speed in °/µs: 857°/s → 0.000857 °/µs
+// Servo speed in °/µs: 857°/s → 0.000857 °/µs, derated for supply sag
 static inline float servoDegPerUs(void) {
-    return (float)servoConfig()->servo_speed_deg_s / 1e6f;
+    return (float)servoConfig()->servo_speed_deg_s * getServoSpeedScale() / 1e6f;
 }
 
 // Function to apply flapping logic to servos based on motor output.
@@ -464,6 +467,10 @@ void applyFlappingToServos(int16_t *input) {
       if (fabsf(errR) <= stepMax) glideCurrentRight[p] = (float)glideTarget;
       else glideCurrentRight[p] += (errR > 0.0f) ? stepMax : -stepMax;
 
+      if (fabsf(errL) > stepMax || fabsf(errR) > stepMax) {
+        wingSaturationHit(p, WING_SATURATION_SLEW);
+      }
+
       // Apply EMA in glide too (gentle, α=0.30)
       if (!emaInitialised) {
         emaFlappingLeft[p]  = glideCurrentLeft[p];
@@ -516,10 +523,129 @@ static void updateGimbalServos(uint8_t firstServoIndex)
 static void servoTable(void);
 static void filterServos(void);
 
+// Servo channels come in left/right pairs on the ornithopter mix
+static void wingServoSaturated(int servoIndex, wingSaturation_e limit)
+{
+    if (currentMixerMode == MIXER_SERVO_ORNITHOPTER && servoIndex <= SERVO_ORNITHOPTER_INDEX_MAX) {
+        wingSaturationHit((servoIndex - SERVO_ORNITHOPTER_INDEX_MIN) / 2, limit);
+    }
+}
+
+// Servo travel per degree of servo rotation
+#define SERVO_US_PER_DEGREE 10.0f
+#define SERVO_TRAJECTORY_MAX_DT_US 100000
+
+static trajectoryLimiter_t servoTrajectory[SERVO_ORNITHOPTER_INDEX_MAX + 1];
+static bool servoTrajectoryActive = false;
+static timeUs_t servoTrajectoryLastUs;
+static float servoTrackingError[MAX_ORNITHOPTER_PAIRS];
+static float servoTrackingDelay[MAX_ORNITHOPTER_PAIRS];
+
+static void resetServoTrackingError(void)
+{
+    for (int p = 0; p < MAX_ORNITHOPTER_PAIRS; p++) {
+        servoTrackingError[p] = 0.0f;
+        servoTrackingDelay[p] = 0.0f;
+    }
+}
+
+// Servo output per unit of each ornithopter servo's own flapping input, through its mixer rules and servo rate
+static void flappingInputGains(float *gain)
+{
+    int ruleRate[SERVO_ORNITHOPTER_INDEX_MAX + 1] = { 0 };
+    for (int i = 0; i < servoRuleCount; i++) {
+        const uint8_t target = currentServoMixer[i].targetChannel;
+        if (target <= SERVO_ORNITHOPTER_INDEX_MAX
+            && currentServoMixer[i].inputSource == INPUT_STABILIZED_FLAPPING_0 + target - SERVO_ORNITHOPTER_INDEX_MIN) {
+            ruleRate[target] += currentServoMixer[i].rate;
+        }
+    }
+    for (int i = SERVO_ORNITHOPTER_INDEX_MIN; i <= SERVO_ORNITHOPTER_INDEX_MAX; i++) {
+        const int direction = servoDirection(i, INPUT_STABILIZED_FLAPPING_0 + i - SERVO_ORNITHOPTER_INDEX_MIN);
+        gain[i] = direction * ruleRate[i] * servoParams(i)->rate / 10000.0f;
+    }
+}
+
+// Square-ish strokes ask for reversals no servo can make. Bound the final ornithopter servo outputs by the
+// servo's speed and acceleration so the commanded trajectory is the one the wing can follow, and keep the
+// tracking error of each pair for the wing ODE.
+STATIC_UNIT_TESTED void limitServoTrajectory(timeUs_t currentTimeUs)
+{
+    const servoConfig_t *sc = servoConfig();
+
+    if (!sc->servo_accel_ms) {
+        servoTrajectoryActive = false;
+        resetServoTrackingError();
+        return;
+    }
+    if (!servoTrajectoryActive) {
+        for (int i = SERVO_ORNITHOPTER_INDEX_MIN; i <= SERVO_ORNITHOPTER_INDEX_MAX; i++) {
+            trajectoryLimiterInit(&servoTrajectory[i], servo[i]);
+        }
+        servoTrajectoryActive = true;
+        servoTrajectoryLastUs = currentTimeUs;
+        resetServoTrackingError();
+        return;
+    }
+
+    const timeDelta_t dTUs = MIN(cmpTimeUs(currentTimeUs, servoTrajectoryLastUs), SERVO_TRAJECTORY_MAX_DT_US);
+    servoTrajectoryLastUs = currentTimeUs;
+    const float dT = dTUs * 1e-6f;
+    const float maxVelocity = sc->servo_speed_deg_s * getServoSpeedScale() * SERVO_US_PER_DEGREE;
+    const float maxAcceleration = maxVelocity * 1000.0f / sc->servo_accel_ms;
+
+    float gain[SERVO_ORNITHOPTER_INDEX_MAX + 1];
+    flappingInputGains(gain);
+    resetServoTrackingError();
+
+    for (int i = SERVO_ORNITHOPTER_INDEX_MIN; i <= SERVO_ORNITHOPTER_INDEX_MAX; i++) {
+        const float target = servo[i];
+        float position = servoTrajectory[i].position;
+        if (dTUs > 0) {
+            position = trajectoryLimiterApply(&servoTrajectory[i], target, maxVelocity, maxAcceleration, dT);
+        }
+        servo[i] = constrain(lrintf(position), servoParams(i)->min, servoParams(i)->max);
+
+        const float errorUs = position - target;
+        if (fabsf(errorUs) >= 1.0f) {
+            wingServoSaturated(i, WING_SATURATION_SLEW);
+        }
+        if (gain[i] == 0.0f) {
+            continue;
+        }
+        // the worse wing of each pair, in units of its flapping input
+        const int pair = (i - SERVO_ORNITHOPTER_INDEX_MIN) / 2;
+        const float error = errorUs / gain[i];
+        if (fabsf(error) > fabsf(servoTrackingError[pair])) {
+            servoTrackingError[pair] = error;
+        }
+        if (maxVelocity > 0.0f) {
+            servoTrackingDelay[pair] = MAX(servoTrackingDelay[pair], fabsf(errorUs) / maxVelocity);
+        }
+    }
+}
+
+// Slew limited minus commanded position of the worse wing of a pair, in units of the pair's flapping input
+float getServoTrackingError(int pair)
+{
+    return servoTrackingError[pair];
+}
+
+// Time in seconds the servos of a pair need at full speed to close their tracking error
+float getServoTrackingDelay(int pair)
+{
+    return servoTrackingDelay[pair];
+}
+
 void writeServos(void)
 {
     servoTable();
     filterServos();
+    if (currentMixerMode == MIXER_SERVO_ORNITHOPTER) {
+        const timeUs_t currentTimeUs = micros();
+        limitServoTrajectory(currentTimeUs);
+        wingMonitorUpdate(currentTimeUs);
+    }
 
     uint8_t servoIndex = 0;
     switch (currentMixerMode) {
@@ -661,6 +787,9 @@ void servoMixer(void)
                     currentOutput[i] = constrain(currentOutput[i] + currentServoMixer[i].speed, currentOutput[i], input[from]);
                 else if (currentOutput[i] > input[from])
                     currentOutput[i] = constrain(currentOutput[i] - currentServoMixer[i].speed, input[from], currentOutput[i]);
+                if (currentOutput[i] != input[from]) {
+                    wingServoSaturated(target, WING_SATURATION_SLEW);
+                }
             }
 
             servo[target] += servoDirection(target, from) * constrain(((int32_t)currentOutput[i] * currentServoMixer[i].rate) / 100, min, max);
@@ -730,6 +859,9 @@ static void servoTable(void)
 
     // constrain servos
     for (int i = 0; i < MAX_SUPPORTED_SERVOS; i++) {
+        if (servo[i] < servoParams(i)->min || servo[i] > servoParams(i)->max) {
+            wingServoSaturated(i, WING_SATURATION_ENDPOINT);
+        }
         servo[i] = constrain(servo[i], servoParams(i)->min, servoParams(i)->max); // limit the values
     }
 }
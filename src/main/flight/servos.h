@@ -159,6 +159,8 @@ typedef struct servoConfig_s {
     int8_t wing_origin_offset[MAX_ORNITHOPTER_PAIRS];  // per-pair mechanical asymmetry trim ° (-30..+30)
     int8_t flap_base_amplitude;
     uint16_t servo_speed_deg_s;      // max servo angular velocity °/s (default 857 = 60°/70ms). Drives glide transition rate, max frequency.
+    uint8_t servo_speed_vmin_pct;    // servo speed at vbat_min_cell_voltage as % of servo_speed_deg_s at vbat_max_cell_voltage (default 100 = regulated supply, no sag)
+    uint8_t servo_accel_ms;          // time for a servo to reach servo_speed_deg_s from rest, ms (default 10). Bounds the ornithopter servo trajectory, 0 = outputs not slew limited.
     uint8_t servo_max_amplitude;     // hard amplitude clamp ° (default 55). Everything above is mechanically impossible.
     uint8_t flap_magnitude;          // throttle→amplitude scaling: centi-deg per µs above threshold (default 4 → 0.04 °/µs)
 
@@ -181,6 +183,8 @@ typedef struct servoProfile_s {
 extern int16_t servo[MAX_SUPPORTED_SERVOS];
 
 bool isMixerUsingServos(void);
+float getServoTrackingError(int pair);
+float getServoTrackingDelay(int pair);
 void writeServos(void);
 void servoMixerLoadMix(int index);
 void loadCustomServoMixer(void);
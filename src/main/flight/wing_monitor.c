@@ -0,0 +1,122 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#include "build/debug.h"
+
+#include "common/maths.h"
+
+#include "flight/wing_monitor.h"
+
+// The clamps in the wing ODE and the servo mixer set a flag bit per pair when they hit. Once per servo mixer
+// pass the flags are counted and cleared, and every WING_MONITOR_WINDOW_US the counts become the share of
+// passes each limit was hit in that window. Hit counts since arming are kept alongside.
+
+FAST_RAM_ZERO_INIT uint8_t wingSaturationFlags[MAX_ORNITHOPTER_PAIRS];
+
+static uint16_t windowHits[MAX_ORNITHOPTER_PAIRS][WING_SATURATION_COUNT];
+static uint16_t windowPasses;
+static timeUs_t windowStartUs;
+static uint8_t saturationPercent[MAX_ORNITHOPTER_PAIRS][WING_SATURATION_COUNT];
+static uint32_t saturationCount[MAX_ORNITHOPTER_PAIRS][WING_SATURATION_COUNT];
+
+void wingSaturationHitAllPairs(wingSaturation_e limit)
+{
+    for (int pair = 0; pair < MAX_ORNITHOPTER_PAIRS; pair++) {
+        wingSaturationHit(pair, limit);
+    }
+}
+
+static void closeWindow(void)
+{
+    for (int limit = 0; limit < WING_SATURATION_COUNT; limit++) {
+        uint8_t worstPercent = 0;
+        for (int pair = 0; pair < MAX_ORNITHOPTER_PAIRS; pair++) {
+            const uint16_t hits = windowHits[pair][limit];
+            saturationPercent[pair][limit] = windowPasses ? hits * 100 / windowPasses : 0;
+            saturationCount[pair][limit] += hits;
+            worstPercent = MAX(worstPercent, saturationPercent[pair][limit]);
+        }
+        DEBUG_SET(DEBUG_WING_SATURATION, limit, worstPercent);
+    }
+    memset(windowHits, 0, sizeof(windowHits));
+    windowPasses = 0;
+}
+
+void wingMonitorUpdate(timeUs_t currentTimeUs)
+{
+    if (cmpTimeUs(currentTimeUs, windowStartUs) >= WING_MONITOR_WINDOW_US || windowPasses == UINT16_MAX) {
+        closeWindow();
+        windowStartUs = currentTimeUs;
+    }
+
+    windowPasses++;
+    for (int pair = 0; pair < MAX_ORNITHOPTER_PAIRS; pair++) {
+        const uint8_t flags = wingSaturationFlags[pair];
+        if (flags) {
+            for (int limit = 0; limit < WING_SATURATION_COUNT; limit++) {
+                windowHits[pair][limit] += (flags >> limit) & 1;
+            }
+            wingSaturationFlags[pair] = 0;
+        }
+    }
+}
+
+void wingMonitorReset(void)
+{
+    memset(wingSaturationFlags, 0, sizeof(wingSaturationFlags));
+    memset(windowHits, 0, sizeof(windowHits));
+    memset(saturationPercent, 0, sizeof(saturationPercent));
+    memset(saturationCount, 0, sizeof(saturationCount));
+    windowPasses = 0;
+}
+
+uint8_t wingSaturationPercent(int pair, wingSaturation_e limit)
+{
+    return saturationPercent[pair][limit];
+}
+
+uint32_t wingSaturationCount(int pair, wingSaturation_e limit)
+{
+    return saturationCount[pair][limit];
+}
+
+// The most saturated pair and limit over the last window, ties go to the first
+uint8_t wingSaturationWorst(int *pair, wingSaturation_e *limit)
+{
+    uint8_t worstPercent = 0;
+    *pair = 0;
+    *limit = WING_SATURATION_AMPLITUDE;
+    for (int p = 0; p < MAX_ORNITHOPTER_PAIRS; p++) {
+        for (int l = 0; l < WING_SATURATION_COUNT; l++) {
+            if (saturationPercent[p][l] > worstPercent) {
+                worstPercent = saturationPercent[p][l];
+                *pair = p;
+                *limit = l;
+            }
+        }
+    }
+    return worstPercent;
+}
@@ -0,0 +1,52 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common/time.h"
+
+#include "flight/servos.h"
+
+// Limits the wing output can run into, one flag bit each
+typedef enum {
+    WING_SATURATION_AMPLITUDE = 0,  // flapping amplitude clamped to servo_max_amplitude
+    WING_SATURATION_FEROCITY,       // modulated ferocity clamped to the trapezoid range
+    WING_SATURATION_ENDPOINT,       // servo output clamped to the servo min/max
+    WING_SATURATION_SLEW,           // output held back by the servo speed
+    WING_SATURATION_COUNT
+} wingSaturation_e;
+
+#define WING_MONITOR_WINDOW_US 500000
+
+extern uint8_t wingSaturationFlags[MAX_ORNITHOPTER_PAIRS];
+
+// Cheap enough for every PID loop: the flags are only counted once per servo mixer pass
+static inline void wingSaturationHit(int pair, wingSaturation_e limit)
+{
+    wingSaturationFlags[pair] |= 1 << limit;
+}
+
+void wingSaturationHitAllPairs(wingSaturation_e limit);
+void wingMonitorUpdate(timeUs_t currentTimeUs);
+void wingMonitorReset(void);
+
+uint8_t wingSaturationPercent(int pair, wingSaturation_e limit);
+uint32_t wingSaturationCount(int pair, wingSaturation_e limit);
+uint8_t wingSaturationWorst(int *pair, wingSaturation_e *limit);
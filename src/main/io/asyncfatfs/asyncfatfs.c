@@ -58,7 +58,25 @@
     #define ONLY_EXPOSE_FOR_TESTING static
 #endif
 
+/*
+ * The sector cache absorbs bursts of writes while the card is busy, so a bigger cache means fewer dropped blackbox
+ * frames. Targets may override the size. On the F7 the cache lives in DTCM, which is DMA-accessible and not behind the
+ * data cache, so it can be made larger without eating into main RAM. The F4's CCM can't be reached by DMA, so there
+ * the cache stays in normal RAM.
+ */
+#ifndef AFATFS_NUM_CACHE_SECTORS
+#if defined(STM32F7)
+#define AFATFS_NUM_CACHE_SECTORS 32
+#else
 #define AFATFS_NUM_CACHE_SECTORS 10
+#endif
+#endif
+
+#if defined(STM32F7)
+#define AFATFS_CACHE_RAM FAST_RAM_ZERO_INIT
+#else
+#define AFATFS_CACHE_RAM
+#endif
 
 // FAT filesystems are allowed to differ from these parameters, but we choose not to support those weird filesystems:
 #define AFATFS_SECTOR_SIZE  512
@@ -457,9 +475,9 @@ typedef struct afatfs_t {
     } initState;
 #endif
 
-    uint8_t cache[AFATFS_SECTOR_SIZE * AFATFS_NUM_CACHE_SECTORS];
     afatfsCacheBlockDescriptor_t cacheDescriptor[AFATFS_NUM_CACHE_SECTORS];
     uint32_t cacheTimer;
+    uint32_t lastFlushedSector; // Physical index of the sector most recently handed to the card for writing
 
     int cacheDirtyEntries; // The number of cache entries in the AFATFS_CACHE_STATE_DIRTY state
     bool cacheFlushInProgress;
@@ -509,6 +527,8 @@ typedef struct afatfs_t {
 
 static afatfs_t afatfs;
 
+static AFATFS_CACHE_RAM uint8_t afatfsCache[AFATFS_SECTOR_SIZE * AFATFS_NUM_CACHE_SECTORS];
+
 static void afatfs_fileOperationContinue(afatfsFile_t *file);
 static uint8_t* afatfs_fileLockCursorSectorForWrite(afatfsFilePtr_t file);
 static uint8_t* afatfs_fileRetainCursorSectorForRead(afatfsFilePtr_t file);
@@ -594,12 +614,12 @@ static uint32_t afatfs_sectorIndexInCluster(uint32_t byteOffset)
 // Get the buffer memory for the cache entry of the given index.
 static uint8_t *afatfs_cacheSectorGetMemory(int cacheEntryIndex)
 {
-    return afatfs.cache + cacheEntryIndex * AFATFS_SECTOR_SIZE;
+    return afatfsCache + cacheEntryIndex * AFATFS_SECTOR_SIZE;
 }
 
 static int afatfs_getCacheDescriptorIndexForBuffer(uint8_t *memory)
 {
-    int index = (memory - afatfs.cache) / AFATFS_SECTOR_SIZE;
+    int index = (memory - afatfsCache) / AFATFS_SECTOR_SIZE;
 
     if (afatfs_assert(index >= 0 && index < AFATFS_NUM_CACHE_SECTORS)) {
         return index;
@@ -713,12 +733,14 @@ static void afatfs_cacheFlushSector(int cacheIndex)
             afatfs.cacheDirtyEntries--;
             cacheDescriptor->state = AFATFS_CACHE_STATE_WRITING;
             afatfs.cacheFlushInProgress = true;
+            afatfs.lastFlushedSector = cacheDescriptor->sectorIndex;
             break;
 
         case SDCARD_OPERATION_SUCCESS:
             // Buffer is already transmitted
             afatfs.cacheDirtyEntries--;
             cacheDescriptor->state = AFATFS_CACHE_STATE_IN_SYNC;
+            afatfs.lastFlushedSector = cacheDescriptor->sectorIndex;
             break;
 
         case SDCARD_OPERATION_BUSY:
@@ -831,16 +853,24 @@ static int afatfs_allocateCacheSector(uint32_t sectorIndex)
 bool afatfs_flush(void)
 {
     if (afatfs.cacheDirtyEntries > 0) {
-        // Flush the oldest flushable sector
+        /*
+         * Flush the sector that directly follows the one we wrote last if it's dirty, so that a sequential append
+         * reaches the card as one unbroken multiple-block write instead of being interleaved with FAT and directory
+         * updates. Otherwise flush the oldest flushable sector.
+         */
         uint32_t earliestSectorTime = 0xFFFFFFFF;
         int earliestSectorIndex = -1;
 
         for (int i = 0; i < AFATFS_NUM_CACHE_SECTORS; i++) {
-            if (afatfs.cacheDescriptor[i].state == AFATFS_CACHE_STATE_DIRTY && !afatfs.cacheDescriptor[i].locked
-                && (earliestSectorIndex == -1 || afatfs.cacheDescriptor[i].writeTimestamp < earliestSectorTime)
-            ) {
-                earliestSectorIndex = i;
-                earliestSectorTime = afatfs.cacheDescriptor[i].writeTimestamp;
+            if (afatfs.cacheDescriptor[i].state == AFATFS_CACHE_STATE_DIRTY && !afatfs.cacheDescriptor[i].locked) {
+                if (afatfs.cacheDescriptor[i].sectorIndex == afatfs.lastFlushedSector + 1) {
+                    earliestSectorIndex = i;
+                    break;
+                }
+                if (earliestSectorIndex == -1 || afatfs.cacheDescriptor[i].writeTimestamp < earliestSectorTime) {
+                    earliestSectorIndex = i;
+                    earliestSectorTime = afatfs.cacheDescriptor[i].writeTimestamp;
+                }
             }
         }
 
@@ -915,7 +945,8 @@ static void afatfs_fileGetCursorClusterAndSector(afatfsFilePtr_t file, uint32_t
  *     AFATFS_OPERATION_IN_PROGRESS - Card is busy, call again later
  *     AFATFS_OPERATION_FAILURE     - When the filesystem encounters a fatal error
  */
-static afatfsOperationStatus_e afatfs_cacheSector(uint32_t physicalSectorIndex, uint8_t **buffer, uint8_t sectorFlags, uint32_t eraseCount)
+ONLY_EXPOSE_FOR_TESTING
+afatfsOperationStatus_e afatfs_cacheSector(uint32_t physicalSectorIndex, uint8_t **buffer, uint8_t sectorFlags, uint32_t eraseCount)
 {
     // We never write to the MBR, so any attempt to write there is an asyncfatfs bug
     if (!afatfs_assert((sectorFlags & AFATFS_CACHE_WRITE) == 0 || physicalSectorIndex != 0)) {
@@ -3679,6 +3710,14 @@ bool afatfs_destroy(bool dirty)
     return true;
 }
 
+/**
+ * Get the total size of the sector cache, i.e. the most that afatfs_getFreeBufferSpace() could ever report.
+ */
+uint32_t afatfs_getBufferSize(void)
+{
+    return AFATFS_SECTOR_SIZE * AFATFS_NUM_CACHE_SECTORS;
+}
+
 /**
  * Get a pessimistic estimate of the amount of buffer space that we have available to write to immediately.
  */
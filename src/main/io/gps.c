@@ -54,6 +54,8 @@
 #include "flight/pid.h"
 #include "flight/gps_rescue.h"
 
+#include "scheduler/scheduler.h"
+
 #include "sensors/sensors.h"
 
 #define LOG_ERROR        '?'
@@ -66,6 +68,7 @@
 #define LOG_UBLOX_SVINFO 'I'
 #define LOG_UBLOX_POSLLH 'P'
 #define LOG_UBLOX_VELNED 'V'
+#define LOG_UBLOX_PVT    'T'
 
 #define GPS_SV_MAXSATS   16
 
@@ -114,6 +117,8 @@ uint8_t GPS_svinfo_cno[GPS_SV_MAXSATS];     // Carrier to Noise Ratio (Signal St
 // How many entries in gpsInitData array below
 #define GPS_INIT_ENTRIES (GPS_BAUDRATE_MAX + 1)
 #define GPS_BAUDRATE_CHANGE_DELAY (200)
+// Bytes taken out of the serial receive buffer per parser call
+#define GPS_RX_BLOCK_SIZE 64
 
 static serialPort_t *gpsPort;
 
@@ -131,7 +136,8 @@ static const gpsInitData_t gpsInitData[] = {
     { GPS_BAUDRATE_38400,    BAUD_38400, "$PUBX,41,1,0003,0001,38400,0*26\r\n", "$PMTK251,38400*27\r\n" },
     { GPS_BAUDRATE_19200,    BAUD_19200, "$PUBX,41,1,0003,0001,19200,0*23\r\n", "$PMTK251,19200*22\r\n" },
     // 9600 is not enough for 5Hz updates - leave for compatibility to dumb NMEA that only runs at this speed
-    { GPS_BAUDRATE_9600,      BAUD_9600, "$PUBX,41,1,0003,0001,9600,0*16\r\n", "" }
+    { GPS_BAUDRATE_9600,      BAUD_9600, "$PUBX,41,1,0003,0001,9600,0*16\r\n", "" },
+    { GPS_BAUDRATE_230400,  BAUD_230400, "$PUBX,41,1,0003,0001,230400,0*1C\r\n", "$PMTK251,230400*1D\r\n" }
 };
 
 #define GPS_INIT_DATA_ENTRY_COUNT (sizeof(gpsInitData) / sizeof(gpsInitData[0]))
@@ -177,8 +183,21 @@ static const uint8_t ubloxInit[] = {
     //0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x30, 0x01, 0x3C, 0xA3,           // set SVINFO MSG rate (every cycle - high bandwidth)
     0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x30, 0x05, 0x40, 0xA7,           // set SVINFO MSG rate (evey 5 cycles - low bandwidth)
     0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x12, 0x01, 0x1E, 0x67,           // set VELNED MSG rate
+};
 
-    0xB5, 0x62, 0x06, 0x08, 0x06, 0x00, 0xC8, 0x00, 0x01, 0x00, 0x01, 0x00, 0xDE, 0x6A,             // set rate to 5Hz (measurement period: 200ms, navigation rate: 1 cycle)
+// NAV-PVT carries position, velocity, fix and time in a single message, replacing the four above
+static const uint8_t ubloxPvtInit[] = {
+    0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x07, 0x01, 0x13, 0x51,           // set PVT MSG rate
+    0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x02, 0x00, 0x0D, 0x46,           // disable POSLLH
+    0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x03, 0x00, 0x0E, 0x48,           // disable STATUS
+    0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x06, 0x00, 0x11, 0x4E,           // disable SOL
+    0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x12, 0x00, 0x1D, 0x66,           // disable VELNED
+};
+
+// CFG-RATE, the measurement period is filled in from gps_update_rate_hz
+#define UBLOX_RATE_MESSAGE_LENGTH 14
+static uint8_t ubloxRateMessage[UBLOX_RATE_MESSAGE_LENGTH] = {
+    0xB5, 0x62, 0x06, 0x08, 0x06, 0x00, 0xC8, 0x00, 0x01, 0x00, 0x01, 0x00, 0xDE, 0x6A,             // measurement period: 200ms, navigation rate: 1 cycle
 };
 
 // UBlox 6 Protocol documentation - GPS.G6-SW-10018-F
@@ -237,7 +256,7 @@ typedef enum {
 gpsData_t gpsData;
 
 
-PG_REGISTER_WITH_RESET_TEMPLATE(gpsConfig_t, gpsConfig, PG_GPS_CONFIG, 0);
+PG_REGISTER_WITH_RESET_TEMPLATE(gpsConfig_t, gpsConfig, PG_GPS_CONFIG, 1);
 
 PG_RESET_TEMPLATE(gpsConfig_t, gpsConfig,
     .provider = GPS_NMEA,
@@ -245,7 +264,9 @@ PG_RESET_TEMPLATE(gpsConfig_t, gpsConfig,
     .autoConfig = GPS_AUTOCONFIG_ON,
     .autoBaud = GPS_AUTOBAUD_OFF,
     .gps_ublox_use_galileo = false,
-    .gps_set_home_point_once = false
+    .gps_set_home_point_once = false,
+    .gps_ublox_use_pvt = false,
+    .gps_update_rate_hz = 5,
 );
 
 static void shiftPacketLog(void)
@@ -257,14 +278,23 @@ static void shiftPacketLog(void)
     }
 }
 
-static void gpsNewData(uint16_t c);
+static void gpsNewData(const uint8_t *data, uint32_t count);
 #ifdef USE_GPS_NMEA
 static bool gpsNewFrameNMEA(char c);
 #endif
 #ifdef USE_GPS_UBLOX
-static bool gpsNewFrameUBLOX(uint8_t data);
+static uint32_t gpsNewFramesUBLOX(const uint8_t *data, uint32_t count, bool *parsed);
+static void ubloxUpdateRateMessage(uint8_t rateHz);
 #endif
 
+// TASK_GPS runs at 100Hz up to 115200 baud, faster ports are drained proportionally more often
+// so that a burst can't overrun the receive buffer between two runs
+static void gpsRescheduleTask(void)
+{
+    const uint32_t baudRate = baudRates[gpsInitData[gpsData.baudrateIndex].baudrateIndex];
+    rescheduleTask(TASK_GPS, TASK_PERIOD_HZ(100 * MAX(baudRate, 115200U) / 115200));
+}
+
 static void gpsSetState(gpsState_e state)
 {
     gpsData.state = state;
@@ -317,6 +347,8 @@ void gpsInit(void)
         return;
     }
 
+    gpsRescheduleTask();
+
     // signal GPS "thread" to initialize when it gets to it
     gpsSetState(GPS_INITIALIZING);
 }
@@ -461,6 +493,27 @@ void gpsInitUblox(void)
                 }
             }
 
+            if (gpsData.messageState == GPS_MESSAGE_STATE_PVT) {
+                if ((gpsConfig()->gps_ublox_use_pvt) && (gpsData.state_position < sizeof(ubloxPvtInit))) {
+                    serialWrite(gpsPort, ubloxPvtInit[gpsData.state_position]);
+                    gpsData.state_position++;
+                } else {
+                    gpsData.state_position = 0;
+                    gpsData.messageState++;
+                    ubloxUpdateRateMessage(gpsConfig()->gps_update_rate_hz);
+                }
+            }
+
+            if (gpsData.messageState == GPS_MESSAGE_STATE_RATE) {
+                if (gpsData.state_position < sizeof(ubloxRateMessage)) {
+                    serialWrite(gpsPort, ubloxRateMessage[gpsData.state_position]);
+                    gpsData.state_position++;
+                } else {
+                    gpsData.state_position = 0;
+                    gpsData.messageState++;
+                }
+            }
+
             if (gpsData.messageState >= GPS_MESSAGE_STATE_ENTRY_COUNT) {
                 // ublox should be initialised, try receiving
                 gpsSetState(GPS_RECEIVING_DATA);
@@ -500,10 +553,13 @@ static void updateGpsIndicator(timeUs_t currentTimeUs)
 
 void gpsUpdate(timeUs_t currentTimeUs)
 {
-    // read out available GPS bytes
+    // read out available GPS bytes, a block at a time
     if (gpsPort) {
-        while (serialRxBytesWaiting(gpsPort))
-            gpsNewData(serialRead(gpsPort));
+        uint8_t rxData[GPS_RX_BLOCK_SIZE];
+        uint32_t count;
+        while ((count = serialReadBuf(gpsPort, rxData, sizeof(rxData))) > 0) {
+            gpsNewData(rxData, count);
+        }
     } else if (GPS_update & GPS_MSP_UPDATE) { // GPS data received via MSP
         gpsSetState(GPS_RECEIVING_DATA);
         gpsData.lastMessage = millis();
@@ -529,6 +585,7 @@ void gpsUpdate(timeUs_t currentTimeUs)
                 // try another rate
                 gpsData.baudrateIndex++;
                 gpsData.baudrateIndex %= GPS_INIT_ENTRIES;
+                gpsRescheduleTask();
             }
             gpsData.lastMessage = millis();
             gpsSol.numSat = 0;
@@ -558,43 +615,61 @@ void gpsUpdate(timeUs_t currentTimeUs)
 #endif
 }
 
-static void gpsNewData(uint16_t c)
+// Parses data up to and including the end of the first complete solution, returns the number of bytes used
+static uint32_t gpsNewFrames(const uint8_t *data, uint32_t count, bool *parsed)
 {
-    if (!gpsNewFrame(c)) {
-        return;
-    }
+    *parsed = false;
 
-    // new data received and parsed, we're in business
-    gpsData.lastLastMessage = gpsData.lastMessage;
-    gpsData.lastMessage = millis();
-    sensorsSet(SENSOR_GPS);
-
-    GPS_update ^= GPS_DIRECT_TICK;
-
-#if 0
-    debug[3] = GPS_update;
-#endif
-
-    onGpsNewData();
-}
-
-bool gpsNewFrame(uint8_t c)
-{
     switch (gpsConfig()->provider) {
     case GPS_NMEA:          // NMEA
 #ifdef USE_GPS_NMEA
-        return gpsNewFrameNMEA(c);
+        for (uint32_t i = 0; i < count; i++) {
+            if (gpsNewFrameNMEA(data[i])) {
+                *parsed = true;
+                return i + 1;
+            }
+        }
 #endif
         break;
     case GPS_UBLOX:         // UBX binary
 #ifdef USE_GPS_UBLOX
-        return gpsNewFrameUBLOX(c);
+        return gpsNewFramesUBLOX(data, count, parsed);
 #endif
         break;
     default:
         break;
     }
-    return false;
+    return count;
+}
+
+static void gpsNewData(const uint8_t *data, uint32_t count)
+{
+    while (count > 0) {
+        bool parsed;
+        const uint32_t used = gpsNewFrames(data, count, &parsed);
+        data += used;
+        count -= used;
+
+        if (!parsed) {
+            continue;
+        }
+
+        // new data received and parsed, we're in business
+        gpsData.lastLastMessage = gpsData.lastMessage;
+        gpsData.lastMessage = millis();
+        sensorsSet(SENSOR_GPS);
+
+        GPS_update ^= GPS_DIRECT_TICK;
+
+        onGpsNewData();
+    }
+}
+
+bool gpsNewFrame(uint8_t c)
+{
+    bool parsed;
+    gpsNewFrames(&c, 1, &parsed);
+    return parsed;
 }
 
 // Check for healthy communications
@@ -666,33 +741,79 @@ static uint32_t GPS_coord_to_degrees(char *coordinateString)
 
 // helper functions
 #ifdef USE_GPS_NMEA
-static uint32_t grab_fields(char *src, uint8_t mult)
-{                               // convert string to uint32
-    uint32_t i;
-    uint32_t tmp = 0;
-    int isneg = 0;
-    for (i = 0; src[i] != 0; i++) {
-        if ((i == 0) && (src[0] == '-')) { // detect negative sign
-            isneg = 1;
-            continue; // jump to next character if the first one was a negative sign
-        }
-        if (src[i] == '.') {
-            i++;
-            if (mult == 0) {
-                break;
-            } else {
-                src[i + mult] = 0;
-            }
-        }
-        tmp *= 10;
-        if (src[i] >= '0' && src[i] <= '9') {
-            tmp += src[i] - '0';
-        }
-        if (i >= 15) {
-            return 0; // out of bounds
+#define NMEA_FIELD_TEXT_LENGTH      6
+#define NMEA_FIELD_MAX_LENGTH       15
+#define NMEA_MAX_FRACTION_DIGITS    5
+
+// A field of the current sentence, converted to integers as its characters arrive
+typedef struct nmeaField_s {
+    uint32_t integer;                   // digits before the decimal point
+    uint32_t fraction;                  // up to NMEA_MAX_FRACTION_DIGITS digits after it
+    uint8_t fractionDigits;
+    uint8_t length;
+    bool decimalPoint;
+    bool negative;
+    char text[NMEA_FIELD_TEXT_LENGTH];  // first characters, for sentence ids, flags and the checksum
+} nmeaField_t;
+
+static const uint32_t nmeaPowersOf10[] = { 1, 10, 100, 1000, 10000, 100000 };
+
+static void nmeaFieldAddChar(nmeaField_t *field, char c)
+{
+    if (field->length >= NMEA_FIELD_MAX_LENGTH) {
+        field->length = NMEA_FIELD_MAX_LENGTH + 1; // out of bounds, reads as 0
+        return;
+    }
+    if (field->length < NMEA_FIELD_TEXT_LENGTH - 1) {
+        field->text[field->length] = c;
+    }
+    field->length++;
+
+    if (c >= '0' && c <= '9') {
+        if (!field->decimalPoint) {
+            field->integer = field->integer * 10 + (c - '0');
+        } else if (field->fractionDigits < NMEA_MAX_FRACTION_DIGITS) {
+            field->fraction = field->fraction * 10 + (c - '0');
+            field->fractionDigits++;
         }
+    } else if (c == '.') {
+        field->decimalPoint = true;
+    } else if (c == '-' && field->length == 1) {
+        field->negative = true;
     }
-    return isneg ? -tmp : tmp;    // handle negative altitudes
+}
+
+// fractional part as a number of the given count of decimal digits, further digits are truncated
+static uint32_t nmeaFieldFraction(const nmeaField_t *field, uint8_t decimals)
+{
+    if (field->fractionDigits >= decimals) {
+        return field->fraction / nmeaPowersOf10[field->fractionDigits - decimals];
+    }
+    return field->fraction * nmeaPowersOf10[decimals - field->fractionDigits];
+}
+
+// field value * 10^decimals
+static int32_t nmeaFieldValue(const nmeaField_t *field, uint8_t decimals)
+{
+    if (field->length > NMEA_FIELD_MAX_LENGTH) {
+        return 0;
+    }
+    const uint32_t value = field->integer * nmeaPowersOf10[decimals] + nmeaFieldFraction(field, decimals);
+    return field->negative ? -(int32_t)value : (int32_t)value;
+}
+
+// dddmm.mmmm to degrees * 10^7
+static uint32_t nmeaFieldCoordinate(const nmeaField_t *field)
+{
+    if (field->length > NMEA_FIELD_MAX_LENGTH) {
+        return 0;
+    }
+    return GPS_coord_ddmm_to_degrees(field->integer, nmeaFieldFraction(field, 4));
+}
+
+static uint8_t nmeaHexDigit(char c)
+{
+    return (c >= 'A') ? c - 'A' + 10 : c - '0';
 }
 
 typedef struct gpsDataNmea_s {
@@ -707,13 +828,34 @@ typedef struct gpsDataNmea_s {
     uint32_t date;
 } gpsDataNmea_t;
 
+static const struct {
+    char id[NMEA_FIELD_TEXT_LENGTH];
+    uint8_t frame;
+} nmeaFrames[] = {
+    { "GPGGA", FRAME_GGA },
+    { "GNGGA", FRAME_GGA },
+    { "GPRMC", FRAME_RMC },
+    { "GNRMC", FRAME_RMC },
+    { "GPGSV", FRAME_GSV },
+};
+
+static uint8_t nmeaFrameType(const nmeaField_t *field)
+{
+    for (unsigned i = 0; i < ARRAYLEN(nmeaFrames); i++) {
+        if (field->length == NMEA_FIELD_TEXT_LENGTH - 1 && memcmp(field->text, nmeaFrames[i].id, NMEA_FIELD_TEXT_LENGTH - 1) == 0) {
+            return nmeaFrames[i].frame;
+        }
+    }
+    return NO_FRAME;
+}
+
 static bool gpsNewFrameNMEA(char c)
 {
     static gpsDataNmea_t gps_Msg;
 
     uint8_t frameOK = 0;
-    static uint8_t param = 0, offset = 0, parity = 0;
-    static char string[15];
+    static uint8_t param = 0, parity = 0;
+    static nmeaField_t field;
     static uint8_t checksum_param, gps_frame = NO_FRAME;
     static uint8_t svMessageNum = 0;
     uint8_t svSatNum = 0, svPacketIdx = 0, svSatParam = 0;
@@ -721,21 +863,13 @@ static bool gpsNewFrameNMEA(char c)
     switch (c) {
         case '$':
             param = 0;
-            offset = 0;
             parity = 0;
+            memset(&field, 0, sizeof(field));
             break;
         case ',':
         case '*':
-            string[offset] = 0;
             if (param == 0) {       //frame identification
-                gps_frame = NO_FRAME;
-                if (0 == strcmp(string, "GPGGA") || 0 == strcmp(string, "GNGGA")) {
-                    gps_frame = FRAME_GGA;
-                } else if (0 == strcmp(string, "GPRMC") || 0 == strcmp(string, "GNRMC")) {
-                    gps_frame = FRAME_RMC;
-                } else if (0 == strcmp(string, "GPGSV")) {
-                    gps_frame = FRAME_GSV;
-                }
+                gps_frame = nmeaFrameType(&field);
             }
 
             switch (gps_frame) {
@@ -744,50 +878,50 @@ static bool gpsNewFrameNMEA(char c)
             //          case 1:             // Time information
             //              break;
                         case 2:
-                            gps_Msg.latitude = GPS_coord_to_degrees(string);
+                            gps_Msg.latitude = nmeaFieldCoordinate(&field);
                             break;
                         case 3:
-                            if (string[0] == 'S')
+                            if (field.text[0] == 'S')
                                 gps_Msg.latitude *= -1;
                             break;
                         case 4:
-                            gps_Msg.longitude = GPS_coord_to_degrees(string);
+                            gps_Msg.longitude = nmeaFieldCoordinate(&field);
                             break;
                         case 5:
-                            if (string[0] == 'W')
+                            if (field.text[0] == 'W')
                                 gps_Msg.longitude *= -1;
                             break;
                         case 6:
-                            if (string[0] > '0') {
+                            if (field.text[0] > '0') {
                                 ENABLE_STATE(GPS_FIX);
                             } else {
                                 DISABLE_STATE(GPS_FIX);
                             }
                             break;
                         case 7:
-                            gps_Msg.numSat = grab_fields(string, 0);
+                            gps_Msg.numSat = nmeaFieldValue(&field, 0);
                             break;
                         case 8:
-                            gps_Msg.hdop = grab_fields(string, 1) * 100;          // hdop
+                            gps_Msg.hdop = nmeaFieldValue(&field, 1) * 100;          // hdop
                             break;
                         case 9:
-                            gps_Msg.altitudeCm = grab_fields(string, 1) * 10;     // altitude in centimeters. Note: NMEA delivers altitude with 1 or 3 decimals. It's safer to cut at 0.1m and multiply by 10
+                            gps_Msg.altitudeCm = nmeaFieldValue(&field, 2);       // altitude in centimeters
                             break;
                     }
                     break;
                 case FRAME_RMC:        //************* GPRMC FRAME parsing
                     switch (param) {
                         case 1:
-                            gps_Msg.time = grab_fields(string, 2); // UTC time hhmmss.ss
+                            gps_Msg.time = nmeaFieldValue(&field, 2); // UTC time hhmmss.ss
                             break;
                         case 7:
-                            gps_Msg.speed = ((grab_fields(string, 1) * 5144L) / 1000L);    // speed in cm/s added by Mis
+                            gps_Msg.speed = ((nmeaFieldValue(&field, 1) * 5144L) / 1000L);    // speed in cm/s added by Mis
                             break;
                         case 8:
-                            gps_Msg.ground_course = (grab_fields(string, 1));      // ground course deg * 10
+                            gps_Msg.ground_course = nmeaFieldValue(&field, 1);      // ground course deg * 10
                             break;
                         case 9:
-                            gps_Msg.date = grab_fields(string, 0); // date dd/mm/yy
+                            gps_Msg.date = nmeaFieldValue(&field, 0); // date dd/mm/yy
                             break;
                     }
                     break;
@@ -798,11 +932,11 @@ static bool gpsNewFrameNMEA(char c)
                             break; */
                         case 2:
                             // Message number
-                            svMessageNum = grab_fields(string, 0);
+                            svMessageNum = nmeaFieldValue(&field, 0);
                             break;
                         case 3:
                             // Total number of SVs visible
-                            GPS_numCh = grab_fields(string, 0);
+                            GPS_numCh = nmeaFieldValue(&field, 0);
                             break;
                     }
                     if (param < 4)
@@ -819,7 +953,7 @@ static bool gpsNewFrameNMEA(char c)
                         case 1:
                             // SV PRN number
                             GPS_svinfo_chn[svSatNum - 1]  = svSatNum;
-                            GPS_svinfo_svid[svSatNum - 1] = grab_fields(string, 0);
+                            GPS_svinfo_svid[svSatNum - 1] = nmeaFieldValue(&field, 0);
                             break;
                       /*case 2:
                             // Elevation, in degrees, 90 maximum
@@ -829,7 +963,7 @@ static bool gpsNewFrameNMEA(char c)
                             break; */
                         case 4:
                             // SNR, 00 through 99 dB (null when not tracking)
-                            GPS_svinfo_cno[svSatNum - 1] = grab_fields(string, 0);
+                            GPS_svinfo_cno[svSatNum - 1] = nmeaFieldValue(&field, 0);
                             GPS_svinfo_quality[svSatNum - 1] = 0; // only used by ublox
                             break;
                     }
@@ -840,7 +974,7 @@ static bool gpsNewFrameNMEA(char c)
             }
 
             param++;
-            offset = 0;
+            memset(&field, 0, sizeof(field));
             if (c == '*')
                 checksum_param = 1;
             else
@@ -850,7 +984,7 @@ static bool gpsNewFrameNMEA(char c)
         case '\n':
             if (checksum_param) {   //parity checksum
                 shiftPacketLog();
-                uint8_t checksum = 16 * ((string[0] >= 'A') ? string[0] - 'A' + 10 : string[0] - '0') + ((string[1] >= 'A') ? string[1] - 'A' + 10 : string[1] - '0');
+                uint8_t checksum = 16 * nmeaHexDigit(field.text[0]) + nmeaHexDigit(field.text[1]);
                 if (checksum == parity) {
                     *gpsPacketLogChar = LOG_IGNORED;
                     GPS_packetCount++;
@@ -893,8 +1027,7 @@ static bool gpsNewFrameNMEA(char c)
             checksum_param = 0;
             break;
         default:
-            if (offset < 15)
-                string[offset++] = c;
+            nmeaFieldAddChar(&field, c);
             if (!checksum_param)
                 parity ^= c;
     }
@@ -964,6 +1097,42 @@ typedef struct {
     uint32_t heading_accuracy;
 } ubx_nav_velned;
 
+typedef struct {
+    uint32_t time;              // GPS msToW
+    uint16_t year;
+    uint8_t month;
+    uint8_t day;
+    uint8_t hour;
+    uint8_t min;
+    uint8_t sec;
+    uint8_t valid;
+    uint32_t time_accuracy;
+    int32_t time_nsec;
+    uint8_t fix_type;
+    uint8_t fix_status;
+    uint8_t fix_status2;
+    uint8_t satellites;
+    int32_t longitude;
+    int32_t latitude;
+    int32_t altitude_ellipsoid;
+    int32_t altitudeMslMm;
+    uint32_t horizontal_accuracy;
+    uint32_t vertical_accuracy;
+    int32_t ned_north_velocity;
+    int32_t ned_east_velocity;
+    int32_t ned_down_velocity;
+    int32_t speed_2d;           // mm/s
+    int32_t heading_2d;         // deg * 100000
+    uint32_t speed_accuracy;
+    uint32_t heading_accuracy;
+    uint16_t position_DOP;
+    uint8_t flags3;
+    uint8_t res[5];
+    int32_t heading_vehicle;
+    int16_t magnetic_declination;
+    uint16_t magnetic_declination_accuracy;
+} ubx_nav_pvt;
+
 typedef struct {
     uint8_t chn;                // Channel number, 255 for SVx not assigned to channel
     uint8_t svid;               // Satellite ID
@@ -994,6 +1163,7 @@ enum {
     MSG_POSLLH = 0x2,
     MSG_STATUS = 0x3,
     MSG_SOL = 0x6,
+    MSG_PVT = 0x7,
     MSG_VELNED = 0x12,
     MSG_SVINFO = 0x30,
     MSG_CFG_PRT = 0x00,
@@ -1017,6 +1187,11 @@ enum {
     NAV_STATUS_TIME_SECOND_VALID = 8
 } ubx_nav_status_bits;
 
+enum {
+    NAV_PVT_VALID_DATE = 1,
+    NAV_PVT_VALID_TIME = 2
+} ubx_nav_pvt_valid_bits;
+
 // Packet checksum accumulators
 static uint8_t _ck_a;
 static uint8_t _ck_b;
@@ -1060,6 +1235,7 @@ static union {
     ubx_nav_status status;
     ubx_nav_solution solution;
     ubx_nav_velned velned;
+    ubx_nav_pvt pvt;
     ubx_nav_svinfo svinfo;
     uint8_t bytes[UBLOX_PAYLOAD_SIZE];
 } _buffer;
@@ -1073,6 +1249,18 @@ void _update_checksum(uint8_t *data, uint8_t len, uint8_t *ck_a, uint8_t *ck_b)
     }
 }
 
+static void ubloxUpdateRateMessage(uint8_t rateHz)
+{
+    const uint16_t measurementPeriodMs = 1000 / constrain(rateHz, GPS_UPDATE_RATE_HZ_MIN, GPS_UPDATE_RATE_HZ_MAX);
+    uint8_t ck_a = 0, ck_b = 0;
+
+    ubloxRateMessage[6] = measurementPeriodMs & 0xFF;
+    ubloxRateMessage[7] = measurementPeriodMs >> 8;
+    _update_checksum(&ubloxRateMessage[2], UBLOX_RATE_MESSAGE_LENGTH - 4, &ck_a, &ck_b);
+    ubloxRateMessage[UBLOX_RATE_MESSAGE_LENGTH - 2] = ck_a;
+    ubloxRateMessage[UBLOX_RATE_MESSAGE_LENGTH - 1] = ck_b;
+}
+
 
 static bool UBLOX_parse_gps(void)
 {
@@ -1116,6 +1304,38 @@ static bool UBLOX_parse_gps(void)
         }
 #endif
         break;
+    case MSG_PVT:
+        *gpsPacketLogChar = LOG_UBLOX_PVT;
+        next_fix = (_buffer.pvt.fix_status & NAV_STATUS_FIX_VALID) && (_buffer.pvt.fix_type == FIX_3D);
+        if (next_fix) {
+            ENABLE_STATE(GPS_FIX);
+        } else {
+            DISABLE_STATE(GPS_FIX);
+        }
+        gpsSol.llh.lon = _buffer.pvt.longitude;
+        gpsSol.llh.lat = _buffer.pvt.latitude;
+        gpsSol.llh.altCm = _buffer.pvt.altitudeMslMm / 10;  //alt in cm
+        gpsSol.numSat = _buffer.pvt.satellites;
+        gpsSol.hdop = _buffer.pvt.position_DOP;
+        gpsSol.groundSpeed = _buffer.pvt.speed_2d / 10;    // cm/s
+        gpsSol.groundCourse = (uint16_t) (_buffer.pvt.heading_2d / 10000);     // Heading 2D deg * 100000 rescaled to deg * 10
+#ifdef USE_RTC_TIME
+        //set clock, when gps time is available
+        if (!rtcHasTime() && (_buffer.pvt.valid & NAV_PVT_VALID_DATE) && (_buffer.pvt.valid & NAV_PVT_VALID_TIME)) {
+            dateTime_t dt;
+            dt.year = _buffer.pvt.year;
+            dt.month = _buffer.pvt.month;
+            dt.day = _buffer.pvt.day;
+            dt.hours = _buffer.pvt.hour;
+            dt.minutes = _buffer.pvt.min;
+            dt.seconds = _buffer.pvt.sec;
+            dt.millis = (_buffer.pvt.time_nsec > 0) ? _buffer.pvt.time_nsec / 1000000 : 0;
+            rtcSetDateTime(&dt);
+        }
+#endif
+        _new_position = true;
+        _new_speed = true;
+        break;
     case MSG_VELNED:
         *gpsPacketLogChar = LOG_UBLOX_VELNED;
         // speed_3d                        = _buffer.velned.speed_3d;  // cm/s
@@ -1234,11 +1454,40 @@ static bool gpsNewFrameUBLOX(uint8_t data)
     }
     return parsed;
 }
+
+// Byte by byte for the framing, the payload is checksummed and copied into _buffer as one block.
+// Stops after the first message that completes a solution.
+static uint32_t gpsNewFramesUBLOX(const uint8_t *data, uint32_t count, bool *parsed)
+{
+    uint32_t i = 0;
+
+    *parsed = false;
+    while (i < count && !*parsed) {
+        if (_step != 6) {
+            *parsed = gpsNewFrameUBLOX(data[i++]);
+            continue;
+        }
+
+        const uint32_t block = MIN(count - i, (uint32_t)(_payload_length - _payload_counter));
+        if (_payload_counter < UBLOX_PAYLOAD_SIZE) {
+            memcpy(&_buffer.bytes[_payload_counter], &data[i], MIN(block, (uint32_t)(UBLOX_PAYLOAD_SIZE - _payload_counter)));
+        }
+        for (uint32_t j = 0; j < block; j++) {
+            _ck_b += (_ck_a += data[i + j]);
+        }
+        _payload_counter += block;
+        i += block;
+        if (_payload_counter >= _payload_length) {
+            _step++;
+        }
+    }
+    return i;
+}
 #endif // USE_GPS_UBLOX
 
 static void gpsHandlePassthrough(uint8_t data)
 {
-     gpsNewData(data);
+     gpsNewData(&data, 1);
  #ifdef USE_DASHBOARD
      if (featureIsEnabled(FEATURE_DASHBOARD)) {
          dashboardUpdate(micros());
@@ -53,7 +53,8 @@ typedef enum {
     GPS_BAUDRATE_57600,
     GPS_BAUDRATE_38400,
     GPS_BAUDRATE_19200,
-    GPS_BAUDRATE_9600
+    GPS_BAUDRATE_9600,
+    GPS_BAUDRATE_230400
 } gpsBaudRate_e;
 
 typedef enum {
@@ -66,7 +67,10 @@ typedef enum {
     GPS_AUTOBAUD_ON
 } gpsAutoBaud_e;
 
-#define GPS_BAUDRATE_MAX GPS_BAUDRATE_9600
+#define GPS_BAUDRATE_MAX GPS_BAUDRATE_230400
+
+#define GPS_UPDATE_RATE_HZ_MIN 1
+#define GPS_UPDATE_RATE_HZ_MAX 25
 
 typedef struct gpsConfig_s {
     gpsProvider_e provider;
@@ -75,6 +79,8 @@ typedef struct gpsConfig_s {
     gpsAutoBaud_e autoBaud;
     uint8_t gps_ublox_use_galileo;
     uint8_t gps_set_home_point_once;
+    uint8_t gps_ublox_use_pvt;
+    uint8_t gps_update_rate_hz;
 } gpsConfig_t;
 
 PG_DECLARE(gpsConfig_t, gpsConfig);
@@ -104,6 +110,8 @@ typedef enum {
     GPS_MESSAGE_STATE_INIT,
     GPS_MESSAGE_STATE_SBAS,
     GPS_MESSAGE_STATE_GALILEO,
+    GPS_MESSAGE_STATE_PVT,
+    GPS_MESSAGE_STATE_RATE,
     GPS_MESSAGE_STATE_ENTRY_COUNT
 } gpsMessageState_e;
 
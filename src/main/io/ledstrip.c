@@ -272,8 +272,11 @@ STATIC_UNIT_TESTED void updateLedCount(void)
     ledCounts.larson = countScanner;
 }
 
+static void invalidateLedFixedLayers(void);
+
 void reevaluateLedConfig(void)
 {
+    invalidateLedFixedLayers();
     updateLedCount();
     updateDimensions();
     updateLedRingCounts();
@@ -287,7 +290,7 @@ static const hsvColor_t* getSC(ledSpecialColorIds_e index)
 }
 
 static const char directionCodes[LED_DIRECTION_COUNT] = { 'N', 'E', 'S', 'W', 'U', 'D' };
-static const char baseFunctionCodes[LED_BASEFUNCTION_COUNT]   = { 'C', 'F', 'A', 'L', 'S', 'G', 'R' };
+static const char baseFunctionCodes[LED_BASEFUNCTION_COUNT]   = { 'C', 'F', 'A', 'L', 'S', 'G', 'R', 'P' };
 static const char overlayCodes[LED_OVERLAY_COUNT]   = { 'T', 'O', 'B', 'V', 'I', 'W' };
 
 #define CHUNK_BUFFER_SIZE 11
@@ -464,7 +467,26 @@ static const struct {
     {0,             LED_MODE_ORIENTATION},
 };
 
-static void applyLedFixedLayers(void)
+// Everything the fixed layers depend on besides the configuration.
+// The layers are only composed again when one of these changes.
+typedef struct ledFixedLayerInputs_s {
+    uint16_t flightModeFlags;
+    bool armed;
+    uint8_t batteryPercentage;
+    uint8_t rssiPercentage;
+    int16_t auxInput;
+} ledFixedLayerInputs_t;
+
+static hsvColor_t ledFixedLayerColors[LED_MAX_STRIP_LENGTH];
+static ledFixedLayerInputs_t ledFixedLayerInputs;
+static bool ledFixedLayersValid = false;
+
+static void invalidateLedFixedLayers(void)
+{
+    ledFixedLayersValid = false;
+}
+
+static void composeLedFixedLayers(const ledFixedLayerInputs_t *inputs)
 {
     for (int ledIndex = 0; ledIndex < ledCounts.count; ledIndex++) {
         const ledConfig_t *ledConfig = &ledStripStatusModeConfig()->ledConfigs[ledIndex];
@@ -481,7 +503,7 @@ static void applyLedFixedLayers(void)
             hsvColor_t previousColor = ledStripStatusModeConfig()->colors[(ledGetColor(ledConfig) - 1 + LED_CONFIGURABLE_COLOR_COUNT) % LED_CONFIGURABLE_COLOR_COUNT];
 
             if (ledGetOverlayBit(ledConfig, LED_OVERLAY_THROTTLE)) {   //smooth fade with selected Aux channel of all HSV values from previousColor through color to nextColor
-                const int auxInput = rcData[ledStripStatusModeConfig()->ledstrip_aux_channel];
+                const int auxInput = inputs->auxInput;
                 int centerPWM = (PWM_RANGE_MIN + PWM_RANGE_MAX) / 2;
                 if (auxInput < centerPWM) {
                     color.h = scaleRange(auxInput, PWM_RANGE_MIN, centerPWM, previousColor.h, color.h);
@@ -498,7 +520,7 @@ static void applyLedFixedLayers(void)
 
         case LED_FUNCTION_FLIGHT_MODE:
             for (unsigned i = 0; i < ARRAYLEN(flightModeToLed); i++)
-                if (!flightModeToLed[i].flightMode || FLIGHT_MODE(flightModeToLed[i].flightMode)) {
+                if (!flightModeToLed[i].flightMode || (inputs->flightModeFlags & flightModeToLed[i].flightMode)) {
                     const hsvColor_t *directionalColor = getDirectionalModeColor(ledIndex, &ledStripStatusModeConfig()->modeColors[flightModeToLed[i].ledMode]);
                     if (directionalColor) {
                         color = *directionalColor;
@@ -509,17 +531,17 @@ static void applyLedFixedLayers(void)
             break;
 
         case LED_FUNCTION_ARM_STATE:
-            color = ARMING_FLAG(ARMED) ? *getSC(LED_SCOLOR_ARMED) : *getSC(LED_SCOLOR_DISARMED);
+            color = inputs->armed ? *getSC(LED_SCOLOR_ARMED) : *getSC(LED_SCOLOR_DISARMED);
             break;
 
         case LED_FUNCTION_BATTERY:
             color = HSV(RED);
-            hOffset += MAX(scaleRange(calculateBatteryPercentageRemaining(), 0, 100, -30, 120), 0);
+            hOffset += MAX(scaleRange(inputs->batteryPercentage, 0, 100, -30, 120), 0);
             break;
 
         case LED_FUNCTION_RSSI:
             color = HSV(RED);
-            hOffset += MAX(scaleRange(getRssiPercent(), 0, 100, -30, 120), 0);
+            hOffset += MAX(scaleRange(inputs->rssiPercentage, 0, 100, -30, 120), 0);
             break;
 
         default:
@@ -527,12 +549,32 @@ static void applyLedFixedLayers(void)
         }
 
         if ((fn != LED_FUNCTION_COLOR) && ledGetOverlayBit(ledConfig, LED_OVERLAY_THROTTLE)) {
-            const int auxInput = rcData[ledStripStatusModeConfig()->ledstrip_aux_channel];
-            hOffset += scaleRange(auxInput, PWM_RANGE_MIN, PWM_RANGE_MAX, 0, HSV_HUE_MAX + 1);
+            hOffset += scaleRange(inputs->auxInput, PWM_RANGE_MIN, PWM_RANGE_MAX, 0, HSV_HUE_MAX + 1);
         }
 
         color.h = (color.h + hOffset) % (HSV_HUE_MAX + 1);
-        setLedHsv(ledIndex, &color);
+        ledFixedLayerColors[ledIndex] = color;
+    }
+}
+
+static void applyLedFixedLayers(void)
+{
+    ledFixedLayerInputs_t inputs;
+    memset(&inputs, 0, sizeof(inputs));
+    inputs.flightModeFlags = flightModeFlags;
+    inputs.armed = ARMING_FLAG(ARMED);
+    inputs.batteryPercentage = calculateBatteryPercentageRemaining();
+    inputs.rssiPercentage = getRssiPercent();
+    inputs.auxInput = rcData[ledStripStatusModeConfig()->ledstrip_aux_channel];
+
+    if (!ledFixedLayersValid || memcmp(&inputs, &ledFixedLayerInputs, sizeof(inputs)) != 0) {
+        composeLedFixedLayers(&inputs);
+        ledFixedLayerInputs = inputs;
+        ledFixedLayersValid = true;
+    }
+
+    for (int ledIndex = 0; ledIndex < ledCounts.count; ledIndex++) {
+        setLedHsv(ledIndex, &ledFixedLayerColors[ledIndex]);
     }
 }
 
@@ -887,6 +929,50 @@ static void applyLedThrustRingLayer(bool updateNow, timeUs_t *timer)
     }
 }
 
+#define WING_PHASE_SECTOR_COUNT 16
+#define WING_PHASE_MIN_INTERVAL_US (10 * 1000)
+#define WING_PHASE_MAX_INTERVAL_US (100 * 1000)
+
+// raised cosine over one stroke, brightest at the start of the downstroke
+static const uint8_t wingPhaseBrightness[WING_PHASE_SECTOR_COUNT] = {
+    255, 245, 218, 176, 128, 79, 37, 10, 0, 10, 37, 79, 128, 176, 218, 245
+};
+
+static void applyLedWingPhaseLayer(bool updateNow, timeUs_t *timer)
+{
+    static uint8_t wingPhaseSector;
+
+    if (updateNow) {
+        ornithopterWingState_t wingState;
+        getOrnithopterWingState(&wingState);
+
+        const float sectorWidth = 2.0f * M_PIf / WING_PHASE_SECTOR_COUNT;
+        wingPhaseSector = (unsigned)(wingState.theta / sectorWidth) % WING_PHASE_SECTOR_COUNT;
+
+        // wake up again when the stroke crosses into the next sector, poll while the wings are stopped
+        timeDelta_t nextUpdateUs = WING_PHASE_MAX_INTERVAL_US;
+        if (wingState.omega > 0.0f) {
+            const float remaining = (wingPhaseSector + 1) * sectorWidth - wingState.theta;
+            nextUpdateUs = constrainf(1e6f * remaining / wingState.omega, WING_PHASE_MIN_INTERVAL_US, WING_PHASE_MAX_INTERVAL_US);
+        }
+        *timer = micros() + nextUpdateUs;
+    }
+
+    int wingLedIndex = 0;
+    for (int ledIndex = 0; ledIndex < ledCounts.count; ledIndex++) {
+        const ledConfig_t *ledConfig = &ledStripStatusModeConfig()->ledConfigs[ledIndex];
+        if (ledGetFunction(ledConfig) == LED_FUNCTION_WING_PHASE) {
+            // each further LED trails by one sector, so a strip along the wing shows the travelling stroke
+            const uint8_t brightness = wingPhaseBrightness[(wingPhaseSector - wingLedIndex) & (WING_PHASE_SECTOR_COUNT - 1)];
+            hsvColor_t color = ledStripStatusModeConfig()->colors[ledGetColor(ledConfig)];
+            color.v = (color.v * brightness) / 255;
+            setLedHsv(ledIndex, &color);
+
+            wingLedIndex++;
+        }
+    }
+}
+
 typedef struct larsonParameters_s {
     uint8_t currentBrightness;
     int8_t currentIndex;
@@ -980,6 +1066,7 @@ typedef enum {
     timBlink,
     timLarson,
     timRing,
+    timWingPhase,
     timIndicator,
 #ifdef USE_VTX_COMMON
     timVtx,
@@ -1018,9 +1105,21 @@ static applyLayerFn_timed* layerTable[] = {
     [timVtx] = &applyLedVtxLayer,
 #endif
     [timIndicator] = &applyLedIndicatorLayer,
-    [timRing] = &applyLedThrustRingLayer
+    [timRing] = &applyLedThrustRingLayer,
+    [timWingPhase] = &applyLedWingPhaseLayer
 };
 
+static bool isFunctionUsed(ledBaseFunctionId_e function)
+{
+    for (int ledIndex = 0; ledIndex < ledCounts.count; ledIndex++) {
+        const ledConfig_t *ledConfig = &ledStripStatusModeConfig()->ledConfigs[ledIndex];
+        if (ledGetFunction(ledConfig) == function) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool isOverlayTypeUsed(ledOverlayId_e overlayType)
 {
     for (int ledIndex = 0; ledIndex < ledCounts.count; ledIndex++) {
@@ -1042,6 +1141,7 @@ void updateRequiredOverlay(void)
     disabledTimerMask |= !isOverlayTypeUsed(LED_OVERLAY_VTX) << timVtx;
 #endif
     disabledTimerMask |= !isOverlayTypeUsed(LED_OVERLAY_INDICATOR) << timIndicator;
+    disabledTimerMask |= !isFunctionUsed(LED_FUNCTION_WING_PHASE) << timWingPhase;
 }
 
 static void applyStatusProfile(timeUs_t now) {
@@ -1118,6 +1218,8 @@ bool parseColor(int index, const char *colorConfig)
         memset(color, 0, sizeof(*color));
     }
 
+    invalidateLedFixedLayers();
+
     return result;
 }
 
@@ -1144,6 +1246,9 @@ bool setModeColor(ledModeIndex_e modeIndex, int modeColorIndex, int colorIndex)
     } else {
         return false;
     }
+
+    invalidateLedFixedLayers();
+
     return true;
 }
 #endif
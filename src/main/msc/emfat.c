@@ -599,12 +599,14 @@ void fill_dir_sector(emfat_t *emfat, uint8_t *data, emfat_entry_t *entry, uint32
     }
 }
 
-void read_data_sector(emfat_t *emfat, uint8_t *data, uint32_t rel_sect)
+// Reads up to num_sectors data sectors and returns how many were filled. A run of sectors inside one
+// file is fetched with a single read callback, so the backing flash is streamed rather than being
+// re-addressed for every 512 byte sector of a multi-sector MSC request.
+int read_data_sectors(emfat_t *emfat, uint8_t *data, uint32_t rel_sect, int num_sectors)
 {
     emfat_entry_t *le;
     uint32_t cluster;
     cluster = rel_sect / 8 + 2;
-    rel_sect = rel_sect % 8;
 
     le = emfat->priv.last_entry;
     if (!IS_CLUST_OF(cluster, le)) {
@@ -613,32 +615,43 @@ void read_data_sector(emfat_t *emfat, uint8_t *data, uint32_t rel_sect)
             int i;
             for (i = 0; i < SECT / 4; i++)
                 ((uint32_t *)data)[i] = 0xEFBEADDE;
-            return;
+            return 1;
         }
         emfat->priv.last_entry = le;
     }
 
     if (le->dir) {
-        fill_dir_sector(emfat, data, le, rel_sect);
-        return;
+        fill_dir_sector(emfat, data, le, rel_sect % 8);
+        return 1;
     }
 
     if (le->readcb == NULL) {
         memset(data, 0, SECT);
-    } else {
-        uint32_t offset = cluster - le->priv.first_clust;
-        offset = offset * CLUST + rel_sect * SECT;
-        le->readcb(data, SECT, offset + le->offset, le);
+        return 1;
     }
 
-    return;
+    // Sectors up to the end of the entry's reserved clusters belong to the same file
+    const uint32_t entry_end_sect = (le->priv.last_reserved - 2 + 1) * 8;
+    if ((uint32_t)num_sectors > entry_end_sect - rel_sect) {
+        num_sectors = entry_end_sect - rel_sect;
+    }
+
+    uint32_t offset = cluster - le->priv.first_clust;
+    offset = offset * CLUST + (rel_sect % 8) * SECT;
+    le->readcb(data, num_sectors * SECT, offset + le->offset, le);
+
+    return num_sectors;
 }
 
 void emfat_read(emfat_t *emfat, uint8_t *data, uint32_t sector, int num_sectors)
 {
     while (num_sectors > 0) {
         if (sector >= emfat->priv.root_lba) {
-            read_data_sector(emfat, data, sector - emfat->priv.root_lba);
+            const int count = read_data_sectors(emfat, data, sector - emfat->priv.root_lba, num_sectors);
+            data += count * SECT;
+            num_sectors -= count;
+            sector += count;
+            continue;
         } else if (sector == 0) {
             read_mbr_sector(emfat, data);
         } else if (sector == emfat->priv.fsinfo_lba) {
@@ -64,6 +64,7 @@
 #include "fc/config.h"
 #include "fc/controlrate_profile.h"
 #include "fc/core.h"
+#include "fc/loop_overrun.h"
 #include "fc/rc.h"
 #include "fc/rc_adjustments.h"
 #include "fc/rc_controls.h"
@@ -77,6 +78,7 @@
 #include "flight/mixer.h"
 #include "flight/pid.h"
 #include "flight/servos.h"
+#include "flight/wing_monitor.h"
 
 #include "io/asyncfatfs/asyncfatfs.h"
 #include "io/beeper.h"
@@ -94,8 +96,10 @@
 #include "io/vtx.h"
 #include "io/vtx_string.h"
 
+#include "msp/msp_batch.h"
 #include "msp/msp_box.h"
 #include "msp/msp_protocol.h"
+#include "msp/msp_protocol_v2_orniflight.h"
 #include "msp/msp_serial.h"
 
 #include "osd/osd.h"
@@ -1548,6 +1552,9 @@ static bool mspProcessOutCommand(uint8_t cmdMSP, sbuf_t *dst)
         sbufWriteU8(dst, (uint8_t)(ornithopterProfiles(getOrnithopterProfileIndexMSP())->aeroelastic_glide_coefficient + 128));  // offset 85: signed s8+128
         sbufWriteU8(dst, (uint8_t)(ornithopterProfiles(getOrnithopterProfileIndexMSP())->aeroelastic_flap_coefficient + 128));   // offset 86: signed s8+128
 
+        // Servo speed vs. supply voltage (API 1.49)
+        sbufWriteU8(dst, servoConfig()->servo_speed_vmin_pct);              // offset 87: % of rated speed at min cell voltage
+
         break;
     case MSP_SENSOR_CONFIG:
 #if defined(USE_ACC)
@@ -1719,6 +1726,113 @@ static mspResult_e mspFcProcessOutCommandWithArg(uint8_t cmdMSP, sbuf_t *src, sb
     return MSP_RESULT_ACK;
 }
 
+static void mspWriteScaledS16(sbuf_t *dst, float value, float scale)
+{
+    sbufWriteU16(dst, (int16_t)constrainf(value * scale, INT16_MIN, INT16_MAX));
+}
+
+static void mspFcWingStateCommand(sbuf_t *dst)
+{
+    ornithopterWingState_t state;
+    getOrnithopterWingState(&state);
+
+    sbufWriteU16(dst, lrintf(state.theta * 1000.0f));
+    mspWriteScaledS16(dst, state.omega, 100.0f);
+    mspWriteScaledS16(dst, state.amplitude, 100.0f);
+    mspWriteScaledS16(dst, state.flapping, 100.0f);
+    mspWriteScaledS16(dst, state.phaseModulation, 1000.0f);
+    mspWriteScaledS16(dst, state.ferocityModulation, 1000.0f);
+    mspWriteScaledS16(dst, state.ferocityDifferentialRoll, 1000.0f);
+    mspWriteScaledS16(dst, state.ferocityDifferentialYaw, 1000.0f);
+    mspWriteScaledS16(dst, state.asymmetryBias, 1000.0f);
+}
+
+static void mspFcRxTimingCommand(sbuf_t *dst)
+{
+    const rxTimingStats_t *stats = rxGetTimingStats();
+
+    sbufWriteU32(dst, stats->frameCount);
+    sbufWriteU16(dst, stats->averageFrameIntervalUs);
+    sbufWriteU16(dst, stats->maxLatencyUs);
+    sbufWriteU16(dst, stats->maxJitterUs);
+    sbufWriteU8(dst, RX_TIMING_HISTOGRAM_BUCKETS);
+    for (int i = 0; i < RX_TIMING_HISTOGRAM_BUCKETS; i++) {
+        sbufWriteU16(dst, stats->latency[i]);
+    }
+    for (int i = 0; i < RX_TIMING_HISTOGRAM_BUCKETS; i++) {
+        sbufWriteU16(dst, stats->jitter[i]);
+    }
+}
+
+static void mspFcWingSaturationCommand(sbuf_t *dst)
+{
+    sbufWriteU16(dst, WING_MONITOR_WINDOW_US / 1000);
+    sbufWriteU8(dst, MAX_ORNITHOPTER_PAIRS);
+    sbufWriteU8(dst, WING_SATURATION_COUNT);
+    for (int pair = 0; pair < MAX_ORNITHOPTER_PAIRS; pair++) {
+        for (int limit = 0; limit < WING_SATURATION_COUNT; limit++) {
+            sbufWriteU8(dst, wingSaturationPercent(pair, limit));
+        }
+        for (int limit = 0; limit < WING_SATURATION_COUNT; limit++) {
+            sbufWriteU32(dst, wingSaturationCount(pair, limit));
+        }
+    }
+}
+
+static void mspFcLoopOverrunsCommand(sbuf_t *dst)
+{
+    const uint32_t count = loopOverrunCount();
+    const uint32_t first = count > LOOP_OVERRUN_HISTORY_SIZE ? count - LOOP_OVERRUN_HISTORY_SIZE : 0;
+
+    sbufWriteU32(dst, count);
+    sbufWriteU16(dst, gyro.targetLooptime);
+    sbufWriteU8(dst, count - first);
+    for (uint32_t i = first; i < count; i++) {
+        const loopOverrun_t *overrun = loopOverrunGet(i);
+        sbufWriteU32(dst, overrun->timeUs);
+        sbufWriteU16(dst, overrun->executionUs);
+        sbufWriteU16(dst, overrun->lateUs);
+        sbufWriteU8(dst, overrun->subtask);
+        sbufWriteU16(dst, overrun->subtaskUs);
+        sbufWriteU8(dst, overrun->precedingTask);
+    }
+}
+
+/*
+ * Out commands that take no arguments and have no side effects, i.e. the ones that are safe to run on behalf of a
+ * batch or a push stream rather than a direct request.
+ */
+static bool mspFcProcessReadOnlyOutCommand(uint16_t cmdMSP, sbuf_t *dst)
+{
+    if (cmdMSP == MSP2_ORNIFLIGHT_WING_STATE) {
+        mspFcWingStateCommand(dst);
+        return true;
+    }
+    if (cmdMSP == MSP2_ORNIFLIGHT_RX_TIMING) {
+        mspFcRxTimingCommand(dst);
+        return true;
+    }
+    if (cmdMSP == MSP2_ORNIFLIGHT_WING_SATURATION) {
+        mspFcWingSaturationCommand(dst);
+        return true;
+    }
+    if (cmdMSP == MSP2_ORNIFLIGHT_LOOP_OVERRUNS) {
+        mspFcLoopOverrunsCommand(dst);
+        return true;
+    }
+    if (cmdMSP > 0xFF) {
+        return false;
+    }
+    return mspCommonProcessOutCommand(cmdMSP, dst, NULL) || mspProcessOutCommand(cmdMSP, dst);
+}
+
+void mspFcStreamProcess(timeUs_t currentTimeUs)
+{
+    UNUSED(currentTimeUs);
+
+    mspStreamProcess(mspFcProcessReadOnlyOutCommand);
+}
+
 #ifdef USE_FLASHFS
 static void mspFcDataFlashReadCommand(sbuf_t *dst, sbuf_t *src)
 {
@@ -2313,6 +2427,10 @@ static mspResult_e mspProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
             ornithopterProfilesMutable(profileIndex)->aeroelastic_glide_coefficient = (int8_t)(sbufReadU8(src) - 128);
             ornithopterProfilesMutable(profileIndex)->aeroelastic_flap_coefficient  = (int8_t)(sbufReadU8(src) - 128);
         }
+        if (sbufBytesRemaining(src) >= 1) {
+            // Added in MSP API 1.49 — servo speed vs. supply voltage
+            servoConfigMutable()->servo_speed_vmin_pct = constrain(sbufReadU8(src), 10, 100);
+        }
 
         pidInitConfig(currentPidProfile);
 
@@ -2646,6 +2764,7 @@ static mspResult_e mspProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
             color->s = sbufReadU8(src);
             color->v = sbufReadU8(src);
         }
+        reevaluateLedConfig();
         break;
 #endif
 
@@ -2992,7 +3111,23 @@ mspResult_e mspFcProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostPro
     // initialize reply by default
     reply->cmd = cmd->cmd;
 
-    if (mspCommonProcessOutCommand(cmdMSP, dst, mspPostProcessFn)) {
+    if (cmd->cmd == MSP2_ORNIFLIGHT_BATCH) {
+        ret = mspBatchProcessCommand(src, dst, mspFcProcessReadOnlyOutCommand);
+    } else if (cmd->cmd == MSP2_ORNIFLIGHT_STREAM) {
+        ret = mspStreamCommand(src, dst, mspPostProcessFn);
+    } else if (cmd->cmd == MSP2_ORNIFLIGHT_WING_STATE) {
+        mspFcWingStateCommand(dst);
+        ret = MSP_RESULT_ACK;
+    } else if (cmd->cmd == MSP2_ORNIFLIGHT_RX_TIMING) {
+        mspFcRxTimingCommand(dst);
+        ret = MSP_RESULT_ACK;
+    } else if (cmd->cmd == MSP2_ORNIFLIGHT_WING_SATURATION) {
+        mspFcWingSaturationCommand(dst);
+        ret = MSP_RESULT_ACK;
+    } else if (cmd->cmd == MSP2_ORNIFLIGHT_LOOP_OVERRUNS) {
+        mspFcLoopOverrunsCommand(dst);
+        ret = MSP_RESULT_ACK;
+    } else if (mspCommonProcessOutCommand(cmdMSP, dst, mspPostProcessFn)) {
         ret = MSP_RESULT_ACK;
     } else if (mspProcessOutCommand(cmdMSP, dst)) {
         ret = MSP_RESULT_ACK;
@@ -21,6 +21,7 @@
 #pragma once
 
 #include "common/streambuf.h"
+#include "common/time.h"
 
 #define MSP_V2_FRAME_ID         255
 
@@ -63,3 +64,4 @@ typedef void (*mspProcessReplyFnPtr)(mspPacket_t *cmd);
 void mspInit(void);
 mspResult_e mspFcProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn);
 void mspFcProcessReply(mspPacket_t *reply);
+void mspFcStreamProcess(timeUs_t currentTimeUs);
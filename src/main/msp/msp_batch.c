@@ -0,0 +1,162 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#include "common/maths.h"
+#include "common/streambuf.h"
+#include "common/utils.h"
+
+#include "io/serial.h"
+
+#include "msp/msp.h"
+#include "msp/msp_protocol_v2_orniflight.h"
+#include "msp/msp_serial.h"
+
+#include "scheduler/scheduler.h"
+
+#include "msp_batch.h"
+
+// Replies are built in a scratch buffer and only copied to where they're going once they are known to fit, as
+// sbufWrite* doesn't check bounds. Not MSP_PORT_OUTBUF_SIZE, which is 4K on boards with dataflash.
+static uint8_t scratchBuf[MSP_READ_ONLY_REPLY_MAX_SIZE];
+
+static bool runReadOnlyCommand(mspReadOnlyCommandFnPtr processFn, uint16_t cmdMSP, sbuf_t *reply)
+{
+    sbufInit(reply, scratchBuf, ARRAYEND(scratchBuf));
+    if (!processFn(cmdMSP, reply)) {
+        return false;
+    }
+    sbufSwitchToReader(reply, scratchBuf);
+    return true;
+}
+
+static void writeBatchEntryHeader(sbuf_t *dst, uint16_t cmdMSP, uint8_t status, uint16_t size)
+{
+    sbufWriteU16(dst, cmdMSP);
+    sbufWriteU8(dst, status);
+    sbufWriteU16(dst, size);
+}
+
+/*
+ * Run each requested out command and append its entry to the reply. The first entry that doesn't fit is sent with
+ * MSP2_BATCH_STATUS_TRUNCATED and no payload, and ends the batch.
+ */
+mspResult_e mspBatchProcessCommand(sbuf_t *src, sbuf_t *dst, mspReadOnlyCommandFnPtr processFn)
+{
+    if (sbufBytesRemaining(src) < 2) {
+        return MSP_RESULT_ERROR;
+    }
+
+    while (sbufBytesRemaining(src) >= 2 && sbufBytesRemaining(dst) >= MSP2_BATCH_ENTRY_HEADER_SIZE) {
+        const uint16_t cmdMSP = sbufReadU16(src);
+
+        sbuf_t reply;
+        if (!runReadOnlyCommand(processFn, cmdMSP, &reply)) {
+            writeBatchEntryHeader(dst, cmdMSP, MSP2_BATCH_STATUS_UNSUPPORTED, 0);
+            continue;
+        }
+
+        const int payloadSize = sbufBytesRemaining(&reply);
+        if (payloadSize > sbufBytesRemaining(dst) - MSP2_BATCH_ENTRY_HEADER_SIZE) {
+            writeBatchEntryHeader(dst, cmdMSP, MSP2_BATCH_STATUS_TRUNCATED, 0);
+            break;
+        }
+
+        writeBatchEntryHeader(dst, cmdMSP, MSP2_BATCH_STATUS_OK, payloadSize);
+        sbufWriteData(dst, sbufPtr(&reply), payloadSize);
+    }
+
+    return MSP_RESULT_ACK;
+}
+
+typedef struct mspStream_s {
+    serialPort_t *port;     // port the subscription arrived on, bound once the reply has been sent
+    uint16_t rateHz;
+    uint8_t messageCount;
+    uint8_t nextMessage;    // round robin start, so a full TX buffer doesn't starve the tail of the list
+    uint16_t messages[MSP_STREAM_MAX_MESSAGES];
+} mspStream_t;
+
+static mspStream_t mspStream;
+
+static void mspStreamBindPortFn(serialPort_t *port)
+{
+    mspStream.port = port;
+    rescheduleTask(TASK_MSP_STREAM, TASK_PERIOD_HZ(mspStream.rateHz));
+    setTaskEnabled(TASK_MSP_STREAM, true);
+}
+
+mspResult_e mspStreamCommand(sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    setTaskEnabled(TASK_MSP_STREAM, false);
+    mspStream.port = NULL;
+    mspStream.messageCount = 0;
+    mspStream.nextMessage = 0;
+    mspStream.rateHz = 0;
+
+    if (sbufBytesRemaining(src) >= 2) {
+        mspStream.rateHz = MIN(sbufReadU16(src), MSP_STREAM_MAX_RATE_HZ);
+    }
+
+    while (sbufBytesRemaining(src) >= 2 && mspStream.messageCount < MSP_STREAM_MAX_MESSAGES) {
+        mspStream.messages[mspStream.messageCount++] = sbufReadU16(src);
+    }
+
+    if (mspStream.rateHz == 0) {
+        mspStream.messageCount = 0;
+    }
+
+    sbufWriteU8(dst, mspStream.messageCount);
+
+    // Only the serial layer knows which port this came in on, so let it hand it to us once the reply is out
+    if (mspStream.messageCount && mspPostProcessFn) {
+        *mspPostProcessFn = mspStreamBindPortFn;
+    }
+
+    return MSP_RESULT_ACK;
+}
+
+void mspStreamProcess(mspReadOnlyCommandFnPtr processFn)
+{
+    if (!mspStream.port) {
+        return;
+    }
+
+    for (int i = 0; i < mspStream.messageCount; i++) {
+        const uint8_t index = (mspStream.nextMessage + i) % mspStream.messageCount;
+        const uint16_t cmdMSP = mspStream.messages[index];
+
+        sbuf_t reply;
+        if (!runReadOnlyCommand(processFn, cmdMSP, &reply)) {
+            continue;
+        }
+
+        if (!mspSerialPushPort(mspStream.port, cmdMSP, sbufPtr(&reply), sbufBytesRemaining(&reply), MSP_DIRECTION_REPLY)) {
+            // TX buffer is full, resume from this message next time
+            mspStream.nextMessage = index;
+            return;
+        }
+    }
+    mspStream.nextMessage = 0;
+}
@@ -0,0 +1,41 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common/streambuf.h"
+
+#include "msp/msp.h"
+
+#define MSP2_BATCH_ENTRY_HEADER_SIZE 5 // U16 cmd, U8 status, U16 size
+
+#define MSP_STREAM_MAX_MESSAGES     8
+#define MSP_STREAM_MAX_RATE_HZ      250
+// Largest reply of an out command without arguments: they all fit MSP_PORT_OUTBUF_SIZE of a board without
+// dataflash (MSP_BOXNAMES is paged for that). Only MSP_DATAFLASH_READ needs more, and it takes arguments.
+#define MSP_READ_ONLY_REPLY_MAX_SIZE 256
+
+// Runs an out command that takes no arguments, returns false if it isn't one
+typedef bool (*mspReadOnlyCommandFnPtr)(uint16_t cmdMSP, sbuf_t *dst);
+
+mspResult_e mspBatchProcessCommand(sbuf_t *src, sbuf_t *dst, mspReadOnlyCommandFnPtr processFn);
+
+mspResult_e mspStreamCommand(sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn);
+void mspStreamProcess(mspReadOnlyCommandFnPtr processFn);
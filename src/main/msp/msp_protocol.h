@@ -62,7 +62,7 @@
 #define MSP_PROTOCOL_VERSION                0
 
 #define API_VERSION_MAJOR                   1  // increment when major changes are made
-#define API_VERSION_MINOR                   46 // Unified frequency + flight profiles: 4× profile slots, BOXORNITHOPTERPROFILE
+#define API_VERSION_MINOR                   49 // servo_speed_vmin_pct in MSP_PID_ADVANCED
 
 #define MULTIWII_IDENTIFIER "MWII";
 #define BASEFLIGHT_IDENTIFIER "BAFL";
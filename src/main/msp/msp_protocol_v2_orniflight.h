@@ -0,0 +1,92 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// MSPv2 only commands, these need a 16 bit command id and can't be sent as plain MSPv1 frames
+
+/*
+ * Batched poll: request payload is a list of U16 MSP command ids, reply carries one entry per command, in order:
+ *
+ *   U16 cmd, U8 status (MSP2_BATCH_STATUS_*), U16 size, size bytes of reply payload
+ *
+ * Only out (read) commands that take no arguments are executed. The first entry that doesn't fit the reply buffer
+ * comes back as MSP2_BATCH_STATUS_TRUNCATED with no payload and the commands after it are dropped, unless not
+ * even its header fits; the host should compare the number of entries with the number requested.
+ */
+#define MSP2_ORNIFLIGHT_BATCH           0x3000
+
+#define MSP2_BATCH_STATUS_OK            0
+#define MSP2_BATCH_STATUS_UNSUPPORTED   1
+#define MSP2_BATCH_STATUS_TRUNCATED     2
+
+/*
+ * Wing ODE state and modulation channels (out):
+ *
+ *   U16 theta (mrad, 0..6283), S16 omega (centi-rad/s), S16 amplitude (centi-deg), S16 flapping (centi-deg),
+ *   S16 cadence, S16 ferocity, S16 warp roll, S16 warp yaw, S16 balance (all ×1000)
+ */
+#define MSP2_ORNIFLIGHT_WING_STATE      0x3001
+
+/*
+ * Push-stream subscription (in): U16 rate (Hz), followed by up to MSP_STREAM_MAX_MESSAGES U16 command ids.
+ * The FC then pushes the replies to those commands on the port the subscription arrived on, from a low priority
+ * task, whenever the TX buffer has room for them. Commands that aren't read-only are skipped. An empty list or a
+ * rate of zero cancels the stream.
+ *
+ * Reply: U8 number of messages accepted.
+ */
+#define MSP2_ORNIFLIGHT_STREAM          0x3002
+
+/*
+ * Receiver frame timing (out):
+ *
+ *   U32 frames, U16 average frame interval (us), U16 max latency (us), U16 max jitter (us), U8 bucket count,
+ *   bucket count × U16 latency histogram, bucket count × U16 jitter histogram
+ *
+ * Latency runs from the receiver driver timestamping a complete frame to the rx task processing it, jitter is
+ * the deviation of each frame interval from the running average. Bucket 0 counts samples below 64us, each
+ * following bucket is twice as wide and the last one is open ended. Counts halve when a bucket saturates.
+ */
+#define MSP2_ORNIFLIGHT_RX_TIMING       0x3003
+
+/*
+ * Wing saturation monitor (out):
+ *
+ *   U16 window (ms), U8 pair count, U8 limit count, then for each pair:
+ *   limit count × U8 share of servo mixer passes the limit was hit in the last window (%),
+ *   limit count × U32 hits since arming
+ *
+ * Limits in order: amplitude (servo_max_amplitude), ferocity (trapezoid range), servo endpoint (servo min/max),
+ * servo slew (servo speed). Amplitude clamps are shared by all pairs.
+ */
+#define MSP2_ORNIFLIGHT_WING_SATURATION 0x3004
+
+/*
+ * Gyro/PID loop overruns since arming (out):
+ *
+ *   U32 overrun count, U16 looptime (us), U8 entry count, then for each entry, oldest first:
+ *   U32 iteration start (us), U16 execution time (us), U16 late start (us), U8 longest subtask,
+ *   U16 longest subtask time (us), U8 id of the scheduler task that ran before the iteration
+ *
+ * Only the most recent 16 overruns are kept. Subtasks in order: gyro update, rc command, PID controller,
+ * motor update, PID subprocesses. An id equal to the task count means no task ran before it.
+ */
+#define MSP2_ORNIFLIGHT_LOOP_OVERRUNS   0x3005
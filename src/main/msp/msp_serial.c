@@ -576,6 +576,36 @@ int mspSerialPush(uint8_t cmd, uint8_t *data, int datalen, mspDirection_e direct
     return ret; // return the number of bytes written
 }
 
+/*
+ * Push a single frame to one particular MSP port, using the MSP version that port last spoke (MSPv2 over v1 if the
+ * port talks v1 but the command needs a 16 bit id). Returns the number of bytes written, zero if the port isn't an
+ * MSP port or its TX buffer has no room for the frame.
+ */
+int mspSerialPushPort(serialPort_t *port, uint16_t cmd, uint8_t *data, int datalen, mspDirection_e direction)
+{
+    for (int portIndex = 0; portIndex < MAX_MSP_PORT_COUNT; portIndex++) {
+        mspPort_t * const mspPort = &mspPorts[portIndex];
+        if (!mspPort->port || mspPort->port != port) {
+            continue;
+        }
+
+        mspPacket_t push = {
+            .buf = { .ptr = data, .end = data + datalen, },
+            .cmd = cmd,
+            .flags = 0,
+            .result = 0,
+            .direction = direction,
+        };
+
+        mspVersion_e mspVersion = mspPort->mspVersion;
+        if (mspVersion == MSP_V1 && cmd > 0xFF) {
+            mspVersion = MSP_V2_OVER_V1;
+        }
+
+        return mspSerialEncode(mspPort, &push, mspVersion);
+    }
+    return 0;
+}
 
 uint32_t mspSerialTxBytesFree(void)
 {
@@ -125,7 +125,7 @@ static bool suppressStatsDisplay = false;
 escSensorData_t *osdEscDataCombined;
 #endif
 
-PG_REGISTER_WITH_RESET_FN(osdConfig_t, osdConfig, PG_OSD_CONFIG, 5);
+PG_REGISTER_WITH_RESET_FN(osdConfig_t, osdConfig, PG_OSD_CONFIG, 6);
 
 void osdStatSetState(uint8_t statIndex, bool enabled)
 {
@@ -187,10 +187,10 @@ void changeOsdProfileIndex(uint8_t profileIndex)
 
 static void osdDrawElements(timeUs_t currentTimeUs)
 {
-    displayClearScreen(osdDisplayPort);
-
     // Hide OSD when OSDSW mode is active
     if (IS_RC_MODE_ACTIVE(BOXOSD)) {
+        displayClearScreen(osdDisplayPort);
+        osdResetElementCache();
         return;
     }
 
@@ -473,6 +473,7 @@ static void osdShowStats(uint16_t endBatteryVoltage)
     char buff[OSD_ELEMENT_BUFFER_LENGTH];
 
     displayClearScreen(osdDisplayPort);
+    osdResetElementCache();
     displayWrite(osdDisplayPort, 2, top++, "  --- STATS ---");
 
     if (osdStatGetState(OSD_STAT_RTC_DATE_TIME)) {
@@ -613,6 +614,7 @@ static void osdShowStats(uint16_t endBatteryVoltage)
 static void osdShowArmed(void)
 {
     displayClearScreen(osdDisplayPort);
+    osdResetElementCache();
     displayWrite(osdDisplayPort, 12, 7, "ARMED");
 }
 
@@ -659,6 +661,7 @@ STATIC_UNIT_TESTED void osdRefresh(timeUs_t currentTimeUs)
             if (IS_RC_MODE_ACTIVE(BOXOSD) && osdStatsVisible) {
                 osdStatsVisible = false;
                 displayClearScreen(osdDisplayPort);
+                osdResetElementCache();
             } else if (!IS_RC_MODE_ACTIVE(BOXOSD)) {
                 if (!osdStatsVisible) {
                     osdStatsVisible = true;
@@ -683,6 +686,7 @@ STATIC_UNIT_TESTED void osdRefresh(timeUs_t currentTimeUs)
             return;
         } else {
             displayClearScreen(osdDisplayPort);
+            osdResetElementCache();
             resumeRefreshAt = 0;
             osdStatsEnabled = false;
             stats.armed_time = 0;
@@ -708,7 +712,10 @@ STATIC_UNIT_TESTED void osdRefresh(timeUs_t currentTimeUs)
 #endif
 
 #ifdef USE_CMS
-    if (!displayIsGrabbed(osdDisplayPort))
+    if (displayIsGrabbed(osdDisplayPort)) {
+        // the menu owns the screen, draw everything again once it is released
+        osdResetElementCache();
+    } else
 #endif
     {
         osdUpdateAlarms();
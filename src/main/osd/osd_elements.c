@@ -84,6 +84,7 @@
 #include "flight/imu.h"
 #include "flight/mixer.h"
 #include "flight/pid.h"
+#include "flight/wing_monitor.h"
 
 #include "io/beeper.h"
 #include "io/gps.h"
@@ -160,6 +161,128 @@ static uint32_t blinkBits[(OSD_ITEM_COUNT + 31) / 32];
 #define IS_BLINK(item) (blinkBits[(item) / 32] & (1 << ((item) % 32)))
 #define BLINK(item) (IS_BLINK(item) && blinkState)
 
+// What each element left on the screen at the last refresh. The screen is not cleared between
+// refreshes: an element is only written again when its text changed or when another element
+// touched its cells, and only the cells it vacated are erased.
+typedef struct osdElementCache_s {
+    char text[OSD_ELEMENT_BUFFER_LENGTH];
+    uint8_t x;
+    uint8_t y;
+    uint8_t width;
+    uint8_t height;
+    bool direct;        // the element function writes to the display itself, redrawn on every refresh
+    bool changed;
+    bool valueValid;
+    uint32_t value;     // input the text was formatted from, for elements with a value function
+} osdElementCache_t;
+
+#define OSD_CACHE_ROWS (1 << OSD_POSITION_BITS)
+#define OSD_CACHE_COLS 32
+
+static osdElementCache_t osdElementCache[OSD_ITEM_COUNT];
+static bool osdElementCacheValid = false;
+static bool osdElementDirectWrites = false;
+// Cells erased or written during the current refresh, one bit per column
+static uint32_t osdTouchedCells[OSD_CACHE_ROWS];
+
+static uint32_t osdCellMask(int x, int width)
+{
+    if (x >= OSD_CACHE_COLS || width <= 0) {
+        return 0;
+    }
+    const uint32_t mask = (width >= OSD_CACHE_COLS) ? ~0U : ((1U << width) - 1);
+
+    return mask << x;
+}
+
+static void osdTouchCells(int x, int y, int width, int height)
+{
+    const uint32_t mask = osdCellMask(x, width);
+    for (int row = y; row < y + height && row < OSD_CACHE_ROWS; row++) {
+        osdTouchedCells[row] |= mask;
+    }
+}
+
+static bool osdCellsTouched(int x, int y, int width, int height)
+{
+    const uint32_t mask = osdCellMask(x, width);
+    for (int row = y; row < y + height && row < OSD_CACHE_ROWS; row++) {
+        if (osdTouchedCells[row] & mask) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void osdEraseCells(displayPort_t *osdDisplayPort, int x, int y, int width, int height)
+{
+    if (width <= 0) {
+        return;
+    }
+
+    char spaces[OSD_CACHE_COLS + 1];
+    width = MIN(width, OSD_CACHE_COLS);
+    memset(spaces, ' ', width);
+    spaces[width] = '\0';
+
+    for (int row = y; row < y + height; row++) {
+        displayWrite(osdDisplayPort, x, row, spaces);
+    }
+    osdTouchCells(x, y, width, height);
+}
+
+static void osdEraseElement(displayPort_t *osdDisplayPort, osdElementCache_t *cache)
+{
+    osdEraseCells(osdDisplayPort, cache->x, cache->y, cache->width, cache->height);
+    cache->text[0] = '\0';
+    cache->width = 0;
+    cache->height = 0;
+}
+
+// Grow the area covered by an element that writes to the display itself
+static void osdElementTrackCells(const osdElementParms_t *element, uint8_t x, uint8_t y, uint8_t width)
+{
+    osdElementCache_t *cache = &osdElementCache[element->item];
+
+    if (x >= OSD_CACHE_COLS || y >= OSD_CACHE_ROWS) {
+        // off screen
+        return;
+    }
+    width = MIN(width, OSD_CACHE_COLS - x);
+
+    if (cache->height == 0) {
+        cache->x = x;
+        cache->y = y;
+        cache->width = width;
+        cache->height = 1;
+    } else {
+        const uint8_t right = MAX(cache->x + cache->width, x + width);
+        const uint8_t bottom = MAX(cache->y + cache->height, y + 1);
+        cache->x = MIN(cache->x, x);
+        cache->y = MIN(cache->y, y);
+        cache->width = right - cache->x;
+        cache->height = bottom - cache->y;
+    }
+    osdTouchCells(x, y, width, 1);
+}
+
+static void osdElementWrite(osdElementParms_t *element, uint8_t x, uint8_t y, const char *s)
+{
+    if (osdElementDirectWrites) {
+        osdElementTrackCells(element, x, y, strlen(s));
+        displayWrite(element->osdDisplayPort, x, y, s);
+    }
+}
+
+static void osdElementWriteChar(osdElementParms_t *element, uint8_t x, uint8_t y, uint8_t c)
+{
+    if (osdElementDirectWrites) {
+        osdElementTrackCells(element, x, y, 1);
+        displayWriteChar(element->osdDisplayPort, x, y, c);
+    }
+}
+
 #if defined(USE_ESC_SENSOR) || defined(USE_DSHOT_TELEMETRY)
 typedef int (*getEscRpmOrFreqFnPtr)(int i);
 
@@ -192,7 +315,7 @@ static void renderOsdEscRpmOrFreq(getEscRpmOrFreqFnPtr escFnPtr, osdElementParms
         const int rpm = MIN((*escFnPtr)(i),99999);
         const int len = tfp_sprintf(rpmStr, "%d", rpm);
         rpmStr[len] = '\0'; 
-        displayWrite(element->osdDisplayPort, x, y + i, rpmStr);
+        osdElementWrite(element, x, y + i, rpmStr);
     }
     element->drawElement = false;
 }
@@ -483,6 +606,21 @@ static void osdElementAntiGravity(osdElementParms_t *element)
     }
 }
 
+// Worst wing limit over the last monitor window: share of passes, limit letter and pair
+static void osdElementWingSaturation(osdElementParms_t *element)
+{
+    static const char limitLetter[WING_SATURATION_COUNT] = { 'A', 'F', 'E', 'S' };
+    int pair;
+    wingSaturation_e limit;
+    const uint8_t percent = wingSaturationWorst(&pair, &limit);
+
+    if (percent) {
+        tfp_sprintf(element->buff, "SAT%3d%c%d", percent, limitLetter[limit], pair + 1);
+    } else {
+        strcpy(element->buff, "SAT  0");
+    }
+}
+
 #ifdef USE_ACC
 static void osdElementArtificialHorizon(osdElementParms_t *element)
 {
@@ -502,7 +640,7 @@ static void osdElementArtificialHorizon(osdElementParms_t *element)
     for (int x = -4; x <= 4; x++) {
         const int y = ((-rollAngle * x) / 64) - pitchAngle;
         if (y >= 0 && y <= 81) {
-            displayWriteChar(element->osdDisplayPort, element->elemPosX + x, element->elemPosY + (y / AH_SYMBOL_COUNT), (SYM_AH_BAR9_0 + (y % AH_SYMBOL_COUNT)));
+            osdElementWriteChar(element, element->elemPosX + x, element->elemPosY + (y / AH_SYMBOL_COUNT), (SYM_AH_BAR9_0 + (y % AH_SYMBOL_COUNT)));
         }
     }
 
@@ -532,9 +670,6 @@ static void osdElementCoreTemperature(osdElementParms_t *element)
 
 static void osdElementCraftName(osdElementParms_t *element)
 {
-    // This does not strictly support iterative updating if the craft name changes at run time. But since the craft name is not supposed to be changing this should not matter, and blanking the entire length of the craft name string on update will make it impossible to configure elements to be displayed on the right hand side of the craft name.
-    //TODO: When iterative updating is implemented, change this so the craft name is only printed once whenever the OSD 'flight' screen is entered.
-
     if (strlen(pilotConfig()->name) == 0) {
         strcpy(element->buff, "CRAFT_NAME");
     } else {
@@ -777,13 +912,13 @@ static void osdElementHorizonSidebars(osdElementParms_t *element)
     const int8_t hudwidth = AH_SIDEBAR_WIDTH_POS;
     const int8_t hudheight = AH_SIDEBAR_HEIGHT_POS;
     for (int y = -hudheight; y <= hudheight; y++) {
-        displayWriteChar(element->osdDisplayPort, element->elemPosX - hudwidth, element->elemPosY + y, SYM_AH_DECORATION);
-        displayWriteChar(element->osdDisplayPort, element->elemPosX + hudwidth, element->elemPosY + y, SYM_AH_DECORATION);
+        osdElementWriteChar(element, element->elemPosX - hudwidth, element->elemPosY + y, SYM_AH_DECORATION);
+        osdElementWriteChar(element, element->elemPosX + hudwidth, element->elemPosY + y, SYM_AH_DECORATION);
     }
 
     // AH level indicators
-    displayWriteChar(element->osdDisplayPort, element->elemPosX - hudwidth + 1, element->elemPosY, SYM_AH_LEFT);
-    displayWriteChar(element->osdDisplayPort, element->elemPosX + hudwidth - 1, element->elemPosY, SYM_AH_RIGHT);
+    osdElementWriteChar(element, element->elemPosX - hudwidth + 1, element->elemPosY, SYM_AH_LEFT);
+    osdElementWriteChar(element, element->elemPosX + hudwidth - 1, element->elemPosY, SYM_AH_RIGHT);
 
     element->drawElement = false;  // element already drawn
 }
@@ -962,11 +1097,11 @@ static void osdElementStickOverlay(osdElementParms_t *element)
         for (unsigned  y = 0; y < OSD_STICK_OVERLAY_HEIGHT; y++) {
             // draw the axes, vertical and horizonal
             if ((x == ((OSD_STICK_OVERLAY_WIDTH - 1) / 2)) && (y == (OSD_STICK_OVERLAY_HEIGHT - 1) / 2)) {
-                displayWriteChar(element->osdDisplayPort, xpos + x, ypos + y, SYM_STICK_OVERLAY_CENTER);
+                osdElementWriteChar(element, xpos + x, ypos + y, SYM_STICK_OVERLAY_CENTER);
             } else if (x == ((OSD_STICK_OVERLAY_WIDTH - 1) / 2)) {
-                displayWriteChar(element->osdDisplayPort, xpos + x, ypos + y, SYM_STICK_OVERLAY_VERTICAL);
+                osdElementWriteChar(element, xpos + x, ypos + y, SYM_STICK_OVERLAY_VERTICAL);
             } else if (y == ((OSD_STICK_OVERLAY_HEIGHT - 1) / 2)) {
-                displayWriteChar(element->osdDisplayPort, xpos + x, ypos + y, SYM_STICK_OVERLAY_HORIZONTAL);
+                osdElementWriteChar(element, xpos + x, ypos + y, SYM_STICK_OVERLAY_HORIZONTAL);
             }
         }
     }
@@ -986,7 +1121,7 @@ static void osdElementStickOverlay(osdElementParms_t *element)
     const uint8_t cursorY = OSD_STICK_OVERLAY_VERTICAL_POSITIONS - 1 - scaleRange(constrain(rcData[vertical_channel], PWM_RANGE_MIN, PWM_RANGE_MAX - 1), PWM_RANGE_MIN, PWM_RANGE_MAX, 0, OSD_STICK_OVERLAY_VERTICAL_POSITIONS);
     const char cursor = SYM_STICK_OVERLAY_SPRITE_HIGH + (cursorY % OSD_STICK_OVERLAY_SPRITE_HEIGHT);
 
-    displayWriteChar(element->osdDisplayPort, xpos + cursorX, ypos + cursorY / OSD_STICK_OVERLAY_SPRITE_HEIGHT, cursor);
+    osdElementWriteChar(element, xpos + cursorX, ypos + cursorY / OSD_STICK_OVERLAY_SPRITE_HEIGHT, cursor);
 
     element->drawElement = false;  // element already drawn
 }
@@ -1309,6 +1444,7 @@ static const uint8_t osdElementDisplayOrder[] = {
     OSD_STICK_OVERLAY_LEFT,
     OSD_STICK_OVERLAY_RIGHT,
 #endif
+    OSD_WING_SATURATION,
 };
 
 // Define the mapping between the OSD element id and the function to draw it
@@ -1404,6 +1540,98 @@ const osdElementDrawFn osdElementDrawFunction[OSD_ITEM_COUNT] = {
 #if defined(USE_DSHOT_TELEMETRY) || defined(USE_ESC_SENSOR)
     [OSD_ESC_RPM_FREQ]            = osdElementEscRpmFreq,
 #endif
+    [OSD_WING_SATURATION]         = osdElementWingSaturation,
+};
+
+// Input values of elements whose text only depends on one changing number and on settings. The element is
+// only formatted again when its value changes or the element cache is reset, as the OSD menus and element
+// changes do; other settings changes show up with the next change of the value.
+typedef uint32_t (*osdElementValueFn)(uint8_t item);
+
+static uint32_t osdValueBatteryCritical(void)
+{
+    return getBatteryState() == BATTERY_CRITICAL;
+}
+
+static uint32_t osdValueRssi(uint8_t item)
+{
+    UNUSED(item);
+    return getRssi();
+}
+
+static uint32_t osdValueMainBatteryVoltage(uint8_t item)
+{
+    UNUSED(item);
+    return getBatteryVoltage() | (uint32_t)getBatteryAverageCellVoltage() << 16 | osdValueBatteryCritical() << 31;
+}
+
+static uint32_t osdValueAverageCellVoltage(uint8_t item)
+{
+    UNUSED(item);
+    return getBatteryAverageCellVoltage() | osdValueBatteryCritical() << 31;
+}
+
+static uint32_t osdValueAmperage(uint8_t item)
+{
+    UNUSED(item);
+    return getAmperage();
+}
+
+static uint32_t osdValueMahDrawn(uint8_t item)
+{
+    UNUSED(item);
+    return getMAhDrawn();
+}
+
+static uint32_t osdValuePower(uint8_t item)
+{
+    UNUSED(item);
+    return getAmperage() * getBatteryVoltage() / 10000;
+}
+
+static uint32_t osdValueThrottlePosition(uint8_t item)
+{
+    UNUSED(item);
+    return calculateThrottlePercent();
+}
+
+// the timer in the units it is shown in, so the text is formatted once a second rather than on every refresh
+static uint32_t osdValueTimer(uint8_t item)
+{
+    const uint16_t timer = osdConfig()->timers[item - OSD_ITEM_TIMER_1];
+    const timeUs_t unitUs = (OSD_TIMER_PRECISION(timer) == OSD_TIMER_PREC_HUNDREDTHS) ? 10000 : 1000000;
+
+    return osdGetTimerValue(OSD_TIMER_SRC(timer)) / unitUs;
+}
+
+static uint32_t osdValueNumericalHeading(uint8_t item)
+{
+    UNUSED(item);
+    return DECIDEGREES_TO_DEGREES(attitude.values.yaw);
+}
+
+#ifdef USE_ACC
+static uint32_t osdValueAngleRollPitch(uint8_t item)
+{
+    return (item == OSD_PITCH_ANGLE) ? attitude.values.pitch : attitude.values.roll;
+}
+#endif
+
+static const osdElementValueFn osdElementValueFunction[OSD_ITEM_COUNT] = {
+    [OSD_RSSI_VALUE]              = osdValueRssi,
+    [OSD_MAIN_BATT_VOLTAGE]       = osdValueMainBatteryVoltage,
+    [OSD_ITEM_TIMER_1]            = osdValueTimer,
+    [OSD_ITEM_TIMER_2]            = osdValueTimer,
+    [OSD_THROTTLE_POS]            = osdValueThrottlePosition,
+    [OSD_CURRENT_DRAW]            = osdValueAmperage,
+    [OSD_MAH_DRAWN]               = osdValueMahDrawn,
+    [OSD_POWER]                   = osdValuePower,
+    [OSD_AVG_CELL_VOLTAGE]        = osdValueAverageCellVoltage,
+#ifdef USE_ACC
+    [OSD_PITCH_ANGLE]             = osdValueAngleRollPitch,
+    [OSD_ROLL_ANGLE]              = osdValueAngleRollPitch,
+#endif
+    [OSD_NUMERICAL_HEADING]       = osdValueNumericalHeading,
 };
 
 static void osdAddActiveElement(osd_items_e element)
@@ -1419,6 +1647,7 @@ static void osdAddActiveElement(osd_items_e element)
 void osdAnalyzeActiveElements(void)
 {
     activeOsdElementCount = 0;
+    osdResetElementCache();
 
 #ifdef USE_ACC
     if (sensors(SENSOR_ACC)) {
@@ -1456,14 +1685,30 @@ void osdAnalyzeActiveElements(void)
 #endif
 }
 
-static bool osdDrawSingleElement(displayPort_t *osdDisplayPort, uint8_t item)
+// Format the element and erase whatever it vacated since the last refresh
+static void osdUpdateSingleElement(displayPort_t *osdDisplayPort, uint8_t item)
 {
-    if (BLINK(item)) {
-        return false;
+    osdElementCache_t *cache = &osdElementCache[item];
+    cache->changed = false;
+
+    if (cache->direct || BLINK(item)) {
+        osdEraseElement(osdDisplayPort, cache);
+        return;
     }
 
     uint8_t elemPosX = OSD_X(osdConfig()->item_pos[item]);
     uint8_t elemPosY = OSD_Y(osdConfig()->item_pos[item]);
+
+    const osdElementValueFn valueFn = osdElementValueFunction[item];
+    uint32_t value = 0;
+    if (valueFn) {
+        value = valueFn(item);
+        if (cache->valueValid && cache->value == value && cache->height && cache->x == elemPosX && cache->y == elemPosY) {
+            // same input as last time, so the same text
+            return;
+        }
+    }
+
     char buff[OSD_ELEMENT_BUFFER_LENGTH] = "";
 
     osdElementParms_t element;
@@ -1474,15 +1719,73 @@ static bool osdDrawSingleElement(displayPort_t *osdDisplayPort, uint8_t item)
     element.osdDisplayPort = osdDisplayPort;
     element.drawElement = true;
 
-    // Call the element drawing function
+    // Call the element drawing function, with direct writes to the display held back
+    osdElementDirectWrites = false;
     osdElementDrawFunction[item](&element);
-    if (element.drawElement) {
-        displayWrite(osdDisplayPort, elemPosX, elemPosY, buff);
+    if (!element.drawElement) {
+        // element draws itself, it is drawn in display order with the others
+        osdEraseElement(osdDisplayPort, cache);
+        cache->direct = true;
+        return;
+    }
+
+    cache->value = value;
+    cache->valueValid = valueFn != NULL;
+
+    const uint8_t width = strlen(buff);
+    if (cache->height && cache->x == elemPosX && cache->y == elemPosY) {
+        if (strcmp(cache->text, buff) == 0) {
+            return;
+        }
+        // only the tail of a shorter text has to be erased
+        osdEraseCells(osdDisplayPort, elemPosX + width, elemPosY, cache->width - width, 1);
+    } else {
+        osdEraseElement(osdDisplayPort, cache);
+    }
+
+    memcpy(cache->text, buff, sizeof(cache->text));
+    cache->x = elemPosX;
+    cache->y = elemPosY;
+    cache->width = width;
+    cache->height = 1;
+    cache->changed = true;
+}
+
+static bool osdDrawSingleElement(displayPort_t *osdDisplayPort, uint8_t item)
+{
+    if (BLINK(item)) {
+        return false;
+    }
+
+    osdElementCache_t *cache = &osdElementCache[item];
+
+    if (cache->direct) {
+        char buff[OSD_ELEMENT_BUFFER_LENGTH] = "";
+        osdElementParms_t element;
+        element.item = item;
+        element.elemPosX = OSD_X(osdConfig()->item_pos[item]);
+        element.elemPosY = OSD_Y(osdConfig()->item_pos[item]);
+        element.buff = (char *)&buff;
+        element.osdDisplayPort = osdDisplayPort;
+        element.drawElement = false;
+
+        osdElementDirectWrites = true;
+        osdElementDrawFunction[item](&element);
+        osdElementDirectWrites = false;
+    } else if (cache->changed || osdCellsTouched(cache->x, cache->y, cache->width, cache->height)) {
+        displayWrite(osdDisplayPort, cache->x, cache->y, cache->text);
+        osdTouchCells(cache->x, cache->y, cache->width, cache->height);
     }
 
     return true;
 }
 
+// Forget what is on the screen, the next refresh clears it and draws every element
+void osdResetElementCache(void)
+{
+    osdElementCacheValid = false;
+}
+
 void osdDrawActiveElements(displayPort_t *osdDisplayPort, timeUs_t currentTimeUs)
 {
 #ifdef USE_GPS
@@ -1498,6 +1801,19 @@ void osdDrawActiveElements(displayPort_t *osdDisplayPort, timeUs_t currentTimeUs
 
     blinkState = (currentTimeUs / 200000) % 2;
 
+    if (!osdElementCacheValid) {
+        displayClearScreen(osdDisplayPort);
+        memset(osdElementCache, 0, sizeof(osdElementCache));
+        osdElementCacheValid = true;
+    }
+    memset(osdTouchedCells, 0, sizeof(osdTouchedCells));
+
+    // Erase everything that moved or shrank before writing anything, then write in display
+    // order so that overlapping elements stack up as if the screen had been cleared.
+    for (unsigned i = 0; i < activeOsdElementCount; i++) {
+        osdUpdateSingleElement(osdDisplayPort, activeOsdElementArray[i]);
+    }
+
     for (unsigned i = 0; i < activeOsdElementCount; i++) {
         osdDrawSingleElement(osdDisplayPort, activeOsdElementArray[i]);
     }
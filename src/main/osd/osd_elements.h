@@ -46,5 +46,6 @@ char osdGetSpeedToSelectedUnitSymbol(void);
 char osdGetTemperatureSymbolForSelectedUnit(void);
 void osdAnalyzeActiveElements(void);
 void osdDrawActiveElements(displayPort_t *osdDisplayPort, timeUs_t currentTimeUs);
+void osdResetElementCache(void);
 void osdResetAlarms(void);
 void osdUpdateAlarms(void);
@@ -62,6 +62,7 @@ STATIC_UNIT_TESTED uint32_t crsfChannelData[CRSF_MAX_CHANNEL];
 
 static serialPort_t *serialPort;
 static uint32_t crsfFrameStartAtUs = 0;
+static volatile timeUs_t crsfRcFrameTimeUs = 0;
 static uint8_t telemetryBuf[CRSF_FRAME_SIZE_MAX];
 static uint8_t telemetryBufLen = 0;
 
@@ -154,7 +155,9 @@ STATIC_UNIT_TESTED void crsfDataReceive(uint16_t c, void *data)
         crsfFrameDone = crsfFramePosition < fullFrameLength ? false : true;
         if (crsfFrameDone) {
             crsfFramePosition = 0;
-            if (crsfFrame.frame.type != CRSF_FRAMETYPE_RC_CHANNELS_PACKED) {
+            if (crsfFrame.frame.type == CRSF_FRAMETYPE_RC_CHANNELS_PACKED) {
+                crsfRcFrameTimeUs = currentTimeUs;
+            } else {
                 const uint8_t crc = crsfFrameCRC();
                 if (crc == crsfFrame.bytes[fullFrameLength - 1]) {
                     switch (crsfFrame.frame.type)
@@ -188,6 +191,13 @@ STATIC_UNIT_TESTED void crsfDataReceive(uint16_t c, void *data)
     }
 }
 
+static timeUs_t crsfFrameTimeUs(const rxRuntimeConfig_t *rxRuntimeConfig)
+{
+    UNUSED(rxRuntimeConfig);
+
+    return crsfRcFrameTimeUs;
+}
+
 STATIC_UNIT_TESTED uint8_t crsfFrameStatus(rxRuntimeConfig_t *rxRuntimeConfig)
 {
     UNUSED(rxRuntimeConfig);
@@ -238,11 +248,16 @@ STATIC_UNIT_TESTED uint16_t crsfReadRawRC(const rxRuntimeConfig_t *rxRuntimeConf
     return (0.62477120195241f * crsfChannelData[chan]) + 881;
 }
 
-void crsfRxWriteTelemetryData(const void *data, int len)
+// Telemetry frames are assembled in place in the pending buffer and then committed,
+// so nothing is copied between building a frame and handing it to the serial port.
+uint8_t *crsfRxTelemetryFrameBuffer(void)
+{
+    return telemetryBuf;
+}
+
+void crsfRxCommitTelemetryData(int len)
 {
-    len = MIN(len, (int)sizeof(telemetryBuf));
-    memcpy(telemetryBuf, data, len);
-    telemetryBufLen = len;
+    telemetryBufLen = MIN(len, (int)sizeof(telemetryBuf));
 }
 
 void crsfRxSendTelemetryData(void)
@@ -265,6 +280,7 @@ bool crsfRxInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
 
     rxRuntimeConfig->rcReadRawFn = crsfReadRawRC;
     rxRuntimeConfig->rcFrameStatusFn = crsfFrameStatus;
+    rxRuntimeConfig->rcFrameTimeUsFn = crsfFrameTimeUs;
 
     const serialPortConfig_t *portConfig = findSerialPortConfig(FUNCTION_RX_SERIAL);
     if (!portConfig) {
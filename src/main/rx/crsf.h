@@ -40,7 +40,8 @@ typedef union crsfFrame_u {
     crsfFrameDef_t frame;
 } crsfFrame_t;
 
-void crsfRxWriteTelemetryData(const void *data, int len);
+uint8_t *crsfRxTelemetryFrameBuffer(void);
+void crsfRxCommitTelemetryData(int len);
 void crsfRxSendTelemetryData(void);
 
 struct rxConfig_s;
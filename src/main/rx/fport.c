@@ -130,6 +130,7 @@ static const smartPortPayload_t emptySmartPortFrame = { .frameId = 0, .valueId =
 typedef struct fportBuffer_s {
     uint8_t data[BUFFER_SIZE];
     uint8_t length;
+    timeUs_t frameTimeUs;
 } fportBuffer_t;
 
 static fportBuffer_t rxBuffer[NUM_RX_BUFFERS];
@@ -144,6 +145,7 @@ static volatile uint8_t framePosition = 0;
 
 static smartPortPayload_t *mspPayload = NULL;
 static timeUs_t lastRcFrameReceivedMs = 0;
+static timeUs_t lastRcFrameTimeUs = 0;
 
 static serialPort_t *fportPort;
 #ifdef USE_TELEMETRY_SMARTPORT
@@ -186,6 +188,7 @@ static void fportDataReceive(uint16_t c, void *data)
             const uint8_t nextWriteIndex = (rxBufferWriteIndex + 1) % NUM_RX_BUFFERS;
             if (nextWriteIndex != rxBufferReadIndex) {
                 rxBuffer[rxBufferWriteIndex].length = framePosition - 1;
+                rxBuffer[rxBufferWriteIndex].frameTimeUs = currentTimeUs;
                 rxBufferWriteIndex = nextWriteIndex;
             }
 
@@ -286,6 +289,7 @@ static uint8_t fportFrameStatus(rxRuntimeConfig_t *rxRuntimeConfig)
                         setRssi(scaleRange(frame->data.controlData.rssi, 0, 100, 0, RSSI_MAX_VALUE), RSSI_SOURCE_RX_PROTOCOL);
 
                         lastRcFrameReceivedMs = millis();
+                        lastRcFrameTimeUs = rxBuffer[rxBufferReadIndex].frameTimeUs;
                     }
 
                     break;
@@ -390,6 +394,13 @@ static bool fportProcessFrame(const rxRuntimeConfig_t *rxRuntimeConfig)
     return true;
 }
 
+static timeUs_t fportFrameTimeUs(const rxRuntimeConfig_t *rxRuntimeConfig)
+{
+    UNUSED(rxRuntimeConfig);
+
+    return lastRcFrameTimeUs;
+}
+
 bool fportRxInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
 {
     static uint16_t sbusChannelData[SBUS_MAX_CHANNEL];
@@ -400,6 +411,7 @@ bool fportRxInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
     rxRuntimeConfig->rxRefreshRate = 11000;
 
     rxRuntimeConfig->rcFrameStatusFn = fportFrameStatus;
+    rxRuntimeConfig->rcFrameTimeUsFn = fportFrameTimeUs;
     rxRuntimeConfig->rcProcessFrameFn = fportProcessFrame;
 
     const serialPortConfig_t *portConfig = findSerialPortConfig(FUNCTION_RX_SERIAL);
@@ -70,6 +70,7 @@ static uint8_t rxBytesToIgnore;
 static uint16_t ibusChecksum;
 
 static bool ibusFrameDone = false;
+static timeUs_t ibusFrameTimeUs = 0;
 static uint32_t ibusChannelData[IBUS_MAX_CHANNEL];
 
 static uint8_t ibus[IBUS_BUFFSIZE] = { 0, };
@@ -124,6 +125,7 @@ static void ibusDataReceive(uint16_t c, void *data)
 
     if (ibusFramePosition == ibusFrameSize - 1) {
         ibusFrameDone = true;
+        ibusFrameTimeUs = ibusTime;
     } else {
         ibusFramePosition++;
     }
@@ -162,6 +164,13 @@ static void updateChannelData(void) {
     }
 }
 
+static timeUs_t ibusGetFrameTimeUs(const rxRuntimeConfig_t *rxRuntimeConfig)
+{
+    UNUSED(rxRuntimeConfig);
+
+    return ibusFrameTimeUs;
+}
+
 static uint8_t ibusFrameStatus(rxRuntimeConfig_t *rxRuntimeConfig)
 {
     UNUSED(rxRuntimeConfig);
@@ -208,6 +217,7 @@ bool ibusInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
 
     rxRuntimeConfig->rcReadRawFn = ibusReadRawRC;
     rxRuntimeConfig->rcFrameStatusFn = ibusFrameStatus;
+    rxRuntimeConfig->rcFrameTimeUsFn = ibusGetFrameTimeUs;
 
     const serialPortConfig_t *portConfig = findSerialPortConfig(FUNCTION_RX_SERIAL);
     if (!portConfig) {
@@ -97,6 +97,11 @@ static uint32_t needRxSignalMaxDelayUs;
 static uint32_t suspendRxSignalUntil = 0;
 static uint8_t  skipRxSamples = 0;
 
+static timeUs_t rxFrameTimeUs;
+static timeDelta_t rxFrameDeltaUs;
+static bool rxFrameLatencyPending = false;
+static rxTimingStats_t rxTimingStats;
+
 static int16_t rcRaw[MAX_SUPPORTED_RC_CHANNEL_COUNT];     // interval [1000;2000]
 int16_t rcData[MAX_SUPPORTED_RC_CHANNEL_COUNT];     // interval [1000;2000]
 uint32_t rcInvalidPulsPeriod[MAX_SUPPORTED_RC_CHANNEL_COUNT];
@@ -243,6 +248,7 @@ void rxInit(void)
     rxRuntimeConfig.rcReadRawFn = nullReadRawRC;
     rxRuntimeConfig.rcFrameStatusFn = nullFrameStatus;
     rxRuntimeConfig.rcProcessFrameFn = nullProcessFrame;
+    rxRuntimeConfig.rcFrameTimeUsFn = NULL;
     rcSampleIndex = 0;
     needRxSignalMaxDelayUs = DELAY_10_HZ;
 
@@ -375,6 +381,43 @@ static void setLinkQuality(bool validFrame)
     }
 }
 
+// Bucket 0 is below 64us, each following bucket is twice as wide and the last one is open ended
+STATIC_UNIT_TESTED int rxTimingBucket(uint32_t timeUs)
+{
+    const uint32_t scaled = timeUs >> 6;
+    return scaled ? MIN(32 - __builtin_clz(scaled), RX_TIMING_HISTOGRAM_BUCKETS - 1) : 0;
+}
+
+static void rxTimingHistogramAdd(uint16_t *histogram, uint32_t timeUs)
+{
+    uint16_t *bucket = &histogram[rxTimingBucket(timeUs)];
+    if (*bucket == UINT16_MAX) {
+        // keep the shape of the distribution and let older samples fade out
+        for (int i = 0; i < RX_TIMING_HISTOGRAM_BUCKETS; i++) {
+            histogram[i] /= 2;
+        }
+    }
+    (*bucket)++;
+}
+
+static void rxRecordFrameTime(timeUs_t frameTimeUs)
+{
+    if (rxTimingStats.frameCount > 0) {
+        rxFrameDeltaUs = cmpTimeUs(frameTimeUs, rxFrameTimeUs);
+        const uint32_t intervalUs = constrain(rxFrameDeltaUs, 0, UINT16_MAX);
+        if (rxTimingStats.averageFrameIntervalUs == 0) {
+            rxTimingStats.averageFrameIntervalUs = intervalUs;
+        }
+        const uint32_t jitterUs = ABS((int32_t)intervalUs - rxTimingStats.averageFrameIntervalUs);
+        rxTimingHistogramAdd(rxTimingStats.jitter, jitterUs);
+        rxTimingStats.maxJitterUs = MAX(rxTimingStats.maxJitterUs, MIN(jitterUs, (uint32_t)UINT16_MAX));
+        rxTimingStats.averageFrameIntervalUs += ((int32_t)intervalUs - rxTimingStats.averageFrameIntervalUs) / 16;
+    }
+    rxTimingStats.frameCount++;
+    rxFrameTimeUs = frameTimeUs;
+    rxFrameLatencyPending = true;
+}
+
 bool rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTime)
 {
     UNUSED(currentDeltaTime);
@@ -388,6 +431,7 @@ bool rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTime)
             signalReceived = true;
             rxIsInFailsafeMode = false;
             needRxSignalBefore = currentTimeUs + needRxSignalMaxDelayUs;
+            rxRecordFrameTime(currentTimeUs);
             resetPPMDataReceivedState();
         }
     } else if (featureIsEnabled(FEATURE_RX_PARALLEL_PWM)) {
@@ -407,6 +451,7 @@ bool rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTime)
             signalReceived = !(rxIsInFailsafeMode || rxFrameDropped);
             if (signalReceived) {
                 needRxSignalBefore = currentTimeUs + needRxSignalMaxDelayUs;
+                rxRecordFrameTime(rxRuntimeConfig.rcFrameTimeUsFn ? rxRuntimeConfig.rcFrameTimeUsFn(&rxRuntimeConfig) : currentTimeUs);
             }
 
             setLinkQuality(signalReceived);
@@ -582,6 +627,13 @@ bool calculateRxChannelsAndUpdateFailsafe(timeUs_t currentTimeUs)
     rxDataProcessingRequired = false;
     rxNextUpdateAtUs = currentTimeUs + DELAY_33_HZ;
 
+    if (rxFrameLatencyPending) {
+        rxFrameLatencyPending = false;
+        const uint32_t latencyUs = MAX(cmpTimeUs(currentTimeUs, rxFrameTimeUs), 0);
+        rxTimingHistogramAdd(rxTimingStats.latency, latencyUs);
+        rxTimingStats.maxLatencyUs = MAX(rxTimingStats.maxLatencyUs, MIN(latencyUs, (uint32_t)UINT16_MAX));
+    }
+
     // only proceed when no more samples to skip and suspend period is over
     if (skipRxSamples || currentTimeUs <= suspendRxSignalUntil) {
         if (currentTimeUs > suspendRxSignalUntil) {
@@ -733,6 +785,17 @@ uint8_t rxGetLinkQualityPercent(void)
 }
 #endif
 
+// Interval between the last two frames, from the receiver driver's timestamps where it provides them
+timeDelta_t rxGetFrameDelta(void)
+{
+    return rxFrameDeltaUs;
+}
+
+const rxTimingStats_t *rxGetTimingStats(void)
+{
+    return &rxTimingStats;
+}
+
 uint16_t rxGetRefreshRate(void)
 {
     return rxRuntimeConfig.rxRefreshRate;
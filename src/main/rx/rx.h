@@ -124,6 +124,7 @@ struct rxRuntimeConfig_s;
 typedef uint16_t (*rcReadRawDataFnPtr)(const struct rxRuntimeConfig_s *rxRuntimeConfig, uint8_t chan); // used by receiver driver to return channel data
 typedef uint8_t (*rcFrameStatusFnPtr)(struct rxRuntimeConfig_s *rxRuntimeConfig);
 typedef bool (*rcProcessFrameFnPtr)(const struct rxRuntimeConfig_s *rxRuntimeConfig);
+typedef timeUs_t (*rcGetFrameTimeUsFnPtr)(const struct rxRuntimeConfig_s *rxRuntimeConfig); // used by receiver driver to return the time the last frame finished arriving
 
 typedef struct rxRuntimeConfig_s {
     uint8_t             channelCount; // number of RC channels as reported by current input driver
@@ -131,6 +132,7 @@ typedef struct rxRuntimeConfig_s {
     rcReadRawDataFnPtr  rcReadRawFn;
     rcFrameStatusFnPtr  rcFrameStatusFn;
     rcProcessFrameFnPtr rcProcessFrameFn;
+    rcGetFrameTimeUsFnPtr rcFrameTimeUsFn;   // optional, frames are timestamped when the rx task sees them without it
     uint16_t            *channelData;
     void                *frameData;
 } rxRuntimeConfig_t;
@@ -146,6 +148,17 @@ typedef enum {
 
 extern rssiSource_e rssiSource;
 
+#define RX_TIMING_HISTOGRAM_BUCKETS 8   // below 64us, then doubling up to 4096us and above
+
+typedef struct rxTimingStats_s {
+    uint32_t frameCount;
+    uint16_t averageFrameIntervalUs;
+    uint16_t maxLatencyUs;
+    uint16_t maxJitterUs;
+    uint16_t latency[RX_TIMING_HISTOGRAM_BUCKETS];   // frame received to rx task processing it
+    uint16_t jitter[RX_TIMING_HISTOGRAM_BUCKETS];    // frame interval deviation from the average interval
+} rxTimingStats_t;
+
 extern rxRuntimeConfig_t rxRuntimeConfig; //!!TODO remove this extern, only needed once for channelCount
 
 void rxInit(void);
@@ -153,6 +166,8 @@ bool rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTimeUs);
 bool rxIsReceivingSignal(void);
 bool rxAreFlightChannelsValid(void);
 bool calculateRxChannelsAndUpdateFailsafe(timeUs_t currentTimeUs);
+timeDelta_t rxGetFrameDelta(void);
+const rxTimingStats_t *rxGetTimingStats(void);
 
 struct rxConfig_s;
 
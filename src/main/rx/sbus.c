@@ -102,6 +102,7 @@ typedef union sbusFrame_u {
 typedef struct sbusFrameData_s {
     sbusFrame_t frame;
     uint32_t startAtUs;
+    timeUs_t doneAtUs;
     uint8_t position;
     bool done;
 } sbusFrameData_t;
@@ -133,6 +134,7 @@ static void sbusDataReceive(uint16_t c, void *data)
             sbusFrameData->done = false;
         } else {
             sbusFrameData->done = true;
+            sbusFrameData->doneAtUs = nowUs;
             DEBUG_SET(DEBUG_SBUS, DEBUG_SBUS_FRAME_TIME, sbusFrameTime);
         }
     }
@@ -151,6 +153,13 @@ static uint8_t sbusFrameStatus(rxRuntimeConfig_t *rxRuntimeConfig)
     return sbusChannelsDecode(rxRuntimeConfig, &sbusFrameData->frame.frame.channels);
 }
 
+static timeUs_t sbusFrameTimeUs(const rxRuntimeConfig_t *rxRuntimeConfig)
+{
+    const sbusFrameData_t *sbusFrameData = rxRuntimeConfig->frameData;
+
+    return sbusFrameData->doneAtUs;
+}
+
 bool sbusInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
 {
     static uint16_t sbusChannelData[SBUS_MAX_CHANNEL];
@@ -164,6 +173,7 @@ bool sbusInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
     rxRuntimeConfig->rxRefreshRate = 11000;
 
     rxRuntimeConfig->rcFrameStatusFn = sbusFrameStatus;
+    rxRuntimeConfig->rcFrameTimeUsFn = sbusFrameTimeUs;
 
     const serialPortConfig_t *portConfig = findSerialPortConfig(FUNCTION_RX_SERIAL);
     if (!portConfig) {
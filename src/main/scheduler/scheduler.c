@@ -46,6 +46,8 @@
 // 3 - time spent executing check function
 
 static FAST_RAM_ZERO_INIT cfTask_t *currentTask = NULL;
+static FAST_RAM_ZERO_INIT cfTask_t *lastExecutedTask = NULL;
+static FAST_RAM_ZERO_INIT cfTask_t *previousTask = NULL;
 
 static FAST_RAM_ZERO_INIT uint32_t totalWaitingTasks;
 static FAST_RAM_ZERO_INIT uint32_t totalWaitingTasksSamples;
@@ -211,6 +213,12 @@ void schedulerSetCalulateTaskStatistics(bool calculateTaskStatisticsToUse)
     calculateTaskStatistics = calculateTaskStatisticsToUse;
 }
 
+// The task executed before the current one, TASK_NONE until two have run
+cfTaskId_e getPreviousTaskId(void)
+{
+    return previousTask ? (cfTaskId_e)(previousTask - cfTasks) : TASK_NONE;
+}
+
 void schedulerResetTaskStatistics(cfTaskId_e taskId)
 {
 #if defined(USE_TASK_STATISTICS)
@@ -343,6 +351,8 @@ FAST_CODE void scheduler(void)
 
     if (selectedTask) {
         // Found a task that should be run
+        previousTask = lastExecutedTask;
+        lastExecutedTask = selectedTask;
         selectedTask->taskLatestDeltaTime = currentTimeUs - selectedTask->lastExecutedAt;
 #if defined(USE_TASK_STATISTICS)
         float period = currentTimeUs - selectedTask->lastExecutedAt;
@@ -136,6 +136,8 @@ typedef enum {
     TASK_PINIOBOX,
 #endif
 
+    TASK_MSP_STREAM,
+
     /* Count of real tasks */
     TASK_COUNT,
 
@@ -181,6 +183,7 @@ void getTaskInfo(cfTaskId_e taskId, cfTaskInfo_t *taskInfo);
 void rescheduleTask(cfTaskId_e taskId, uint32_t newPeriodMicros);
 void setTaskEnabled(cfTaskId_e taskId, bool newEnabledState);
 timeDelta_t getTaskDeltaTime(cfTaskId_e taskId);
+cfTaskId_e getPreviousTaskId(void);
 void schedulerSetCalulateTaskStatistics(bool calculateTaskStatistics);
 void schedulerResetTaskStatistics(cfTaskId_e taskId);
 void schedulerResetTaskMaxExecutionTime(cfTaskId_e taskId);
@@ -54,13 +54,14 @@
 
 baro_t baro;                        // barometer access functions
 
-PG_REGISTER_WITH_RESET_FN(barometerConfig_t, barometerConfig, PG_BAROMETER_CONFIG, 1);
+PG_REGISTER_WITH_RESET_FN(barometerConfig_t, barometerConfig, PG_BAROMETER_CONFIG, 2);
 
 void pgResetFn_barometerConfig(barometerConfig_t *barometerConfig)
 {
     barometerConfig->baro_sample_count = 21;
     barometerConfig->baro_noise_lpf = 600;
     barometerConfig->baro_cf_vel = 985;
+    barometerConfig->baro_stroke_sync = 1;
     barometerConfig->baro_hardware = BARO_DEFAULT;
 
     // For backward compatibility; ceate a valid default value for bus parameters
@@ -126,6 +127,10 @@ static int32_t baroTemperature = 0;
 static int32_t baroGroundAltitude = 0;
 static int32_t baroGroundPressure = 8*101325;
 static uint32_t baroPressureSum = 0;
+static uint32_t baroStrokePressureSum = 0;    // raw pressure summed since the last wing stroke boundary
+static uint16_t baroStrokePressureCount = 0;
+#define BARO_STROKE_SAMPLE_COUNT_MIN 4             // merge strokes until the mean has this many samples
+#define BARO_STROKE_SAMPLE_COUNT_MAX 1000          // well past the longest stroke at any baro rate, keeps the sum in range
 
 void baroPreInit(void)
 {
@@ -340,6 +345,13 @@ uint32_t baroUpdate(void)
             baro.baroPressure = baroPressure;
             baro.baroTemperature = baroTemperature;
             baroPressureSum = recalculateBarometerTotal(barometerConfig()->baro_sample_count, baroPressureSum, baroPressure);
+            if (baroStrokePressureCount >= BARO_STROKE_SAMPLE_COUNT_MAX) {
+                // no stroke boundary for a long time (gliding), only the latest stroke matters
+                baroStrokePressureSum = 0;
+                baroStrokePressureCount = 0;
+            }
+            baroStrokePressureSum += baroPressure;
+            baroStrokePressureCount++;
             state = BAROMETER_NEEDS_SAMPLES;
             return baro.dev.ut_delay;
         break;
@@ -363,6 +375,29 @@ int32_t baroCalculateAltitude(void)
     return baro.BaroAlt;
 }
 
+// Called each time the wing completes a stroke. Returns the altitude of the mean pressure over the strokes
+// since the last result, so the flap-frequency oscillation and its harmonics average out. Strokes shorter
+// than a few baro samples are merged with the next ones. wholeStroke is false after a gap in flapping, the
+// samples before it don't span whole strokes and are dropped.
+bool baroStrokeBoundary(bool wholeStroke, int32_t *strokeAltitudeCm)
+{
+    if (!wholeStroke || !isBaroCalibrationComplete()) {
+        baroStrokePressureSum = 0;
+        baroStrokePressureCount = 0;
+        return false;
+    }
+    if (baroStrokePressureCount < BARO_STROKE_SAMPLE_COUNT_MIN) {
+        return false;
+    }
+
+    const float meanPressure = (float)baroStrokePressureSum / baroStrokePressureCount;
+    baroStrokePressureSum = 0;
+    baroStrokePressureCount = 0;
+
+    *strokeAltitudeCm = lrintf((1.0f - pow_approx(meanPressure / 101325.0f, 0.190295f)) * 4433000.0f) - baroGroundAltitude;
+    return true;
+}
+
 void performBaroCalibrationCycle(void)
 {
     static int32_t savedGroundPressure = 0;
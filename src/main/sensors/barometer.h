@@ -45,6 +45,7 @@ typedef struct barometerConfig_s {
     uint8_t baro_sample_count;              // size of baro filter array
     uint16_t baro_noise_lpf;                // additional LPF to reduce baro noise
     uint16_t baro_cf_vel;                   // apply Complimentary Filter to keep the calculated velocity based on baro velocity (i.e. near real velocity)
+    uint8_t baro_stroke_sync;               // average pressure over whole wing strokes for altitude and vario while flapping
 } barometerConfig_t;
 
 PG_DECLARE(barometerConfig_t, barometerConfig);
@@ -65,4 +66,5 @@ void baroSetCalibrationCycles(uint16_t calibrationCyclesRequired);
 uint32_t baroUpdate(void);
 bool isBaroReady(void);
 int32_t baroCalculateAltitude(void);
+bool baroStrokeBoundary(bool wholeStroke, int32_t *strokeAltitudeCm);
 void performBaroCalibrationCycle(void);
@@ -66,6 +66,8 @@
 #include "fc/config.h"
 #include "fc/runtime_config.h"
 
+#include "flight/pid.h"
+
 #include "io/beeper.h"
 #include "io/statusindicator.h"
 
@@ -76,6 +78,9 @@
 #ifdef USE_GYRO_DATA_ANALYSE
 #include "sensors/gyroanalyse.h"
 #endif
+#ifdef USE_MULTI_GYRO
+#include "sensors/gyro_fusion.h"
+#endif
 #include "sensors/rpm_filter.h"
 #include "sensors/sensors.h"
 
@@ -87,6 +92,9 @@ FAST_RAM_ZERO_INIT gyro_t gyro;
 static FAST_RAM_ZERO_INIT uint8_t gyroDebugMode;
 
 static FAST_RAM_ZERO_INIT uint8_t gyroToUse;
+#ifdef USE_MULTI_GYRO
+static FAST_RAM_ZERO_INIT uint8_t gyroFusion;
+#endif
 static FAST_RAM_ZERO_INIT bool overflowDetected;
 
 #ifdef USE_GYRO_OVERFLOW_CHECK
@@ -191,7 +199,7 @@ static void gyroInitLowpassFilterLpf(gyroSensor_t *gyroSensor, int slot, int typ
 #define GYRO_OVERFLOW_TRIGGER_THRESHOLD 31980  // 97.5% full scale (1950dps for 2000dps gyro)
 #define GYRO_OVERFLOW_RESET_THRESHOLD 30340    // 92.5% full scale (1850dps for 2000dps gyro)
 
-PG_REGISTER_WITH_RESET_FN(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 7);
+PG_REGISTER_WITH_RESET_FN(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 8);
 
 #ifndef GYRO_CONFIG_USE_GYRO_DEFAULT
 #define GYRO_CONFIG_USE_GYRO_DEFAULT GYRO_CONFIG_USE_GYRO_1
@@ -227,6 +235,7 @@ void pgResetFn_gyroConfig(gyroConfig_t *gyroConfig)
     gyroConfig->dyn_notch_q = 120;
     gyroConfig->dyn_notch_min_hz = 150;
     gyroConfig->gyro_filter_debug_axis = FD_ROLL;
+    gyroConfig->gyro_fusion = GYRO_FUSION_AVERAGE;
 }
 
 #ifdef USE_MULTI_GYRO
@@ -522,6 +531,9 @@ bool gyroInit(void)
     gyroDetectionFlags = NO_GYROS_DETECTED;
 
     gyroToUse = gyroConfig()->gyro_to_use;
+#ifdef USE_MULTI_GYRO
+    gyroFusion = gyroConfig()->gyro_fusion;
+#endif
 
     if (gyroDetectSensor(&gyroSensor1, gyroDeviceConfig(0))) {
         gyroDetectionFlags |= DETECTED_GYRO_1;
@@ -782,6 +794,7 @@ void gyroInitFilters(void)
     gyroInitSensorFilters(&gyroSensor1);
 #ifdef USE_MULTI_GYRO
     gyroInitSensorFilters(&gyroSensor2);
+    gyroFusionInit(gyro.targetLooptime);
 #endif
 }
 
@@ -1127,9 +1140,16 @@ FAST_CODE void gyroUpdate(timeUs_t currentTimeUs)
         gyroUpdateSensor(&gyroSensor1, currentTimeUs);
         gyroUpdateSensor(&gyroSensor2, currentTimeUs);
         if (isGyroSensorCalibrationComplete(&gyroSensor1) && isGyroSensorCalibrationComplete(&gyroSensor2)) {
-            gyro.gyroADCf[X] = (gyroSensor1.gyroDev.gyroADCf[X] + gyroSensor2.gyroDev.gyroADCf[X]) / 2.0f;
-            gyro.gyroADCf[Y] = (gyroSensor1.gyroDev.gyroADCf[Y] + gyroSensor2.gyroDev.gyroADCf[Y]) / 2.0f;
-            gyro.gyroADCf[Z] = (gyroSensor1.gyroDev.gyroADCf[Z] + gyroSensor2.gyroDev.gyroADCf[Z]) / 2.0f;
+            if (gyroFusion == GYRO_FUSION_NOISE_WEIGHTED) {
+                const float sinTheta = getFlappingSinusoid();
+                for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                    gyro.gyroADCf[axis] = gyroFusionApply(axis, gyroSensor1.gyroDev.gyroADCf[axis], gyroSensor2.gyroDev.gyroADCf[axis], sinTheta);
+                }
+            } else {
+                gyro.gyroADCf[X] = (gyroSensor1.gyroDev.gyroADCf[X] + gyroSensor2.gyroDev.gyroADCf[X]) / 2.0f;
+                gyro.gyroADCf[Y] = (gyroSensor1.gyroDev.gyroADCf[Y] + gyroSensor2.gyroDev.gyroADCf[Y]) / 2.0f;
+                gyro.gyroADCf[Z] = (gyroSensor1.gyroDev.gyroADCf[Z] + gyroSensor2.gyroDev.gyroADCf[Z]) / 2.0f;
+            }
 #ifdef USE_GYRO_OVERFLOW_CHECK
             overflowDetected = gyroSensor1.overflowDetected || gyroSensor2.overflowDetected;
 #endif
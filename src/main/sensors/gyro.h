@@ -65,6 +65,11 @@ enum {
 #define GYRO_CONFIG_USE_GYRO_2      1
 #define GYRO_CONFIG_USE_GYRO_BOTH   2
 
+enum {
+    GYRO_FUSION_AVERAGE = 0,
+    GYRO_FUSION_NOISE_WEIGHTED
+};
+
 enum {
     FILTER_LOWPASS = 0,
     FILTER_LOWPASS2
@@ -114,6 +119,7 @@ typedef struct gyroConfig_s {
     uint16_t dyn_notch_q;
     uint16_t dyn_notch_min_hz;
     uint8_t  gyro_filter_debug_axis;
+    uint8_t  gyro_fusion;                // how GYRO_CONFIG_USE_GYRO_BOTH combines the two gyros
 } gyroConfig_t;
 
 PG_DECLARE(gyroConfig_t, gyroConfig);
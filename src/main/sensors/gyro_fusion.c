@@ -0,0 +1,112 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "platform.h"
+
+#if defined(USE_MULTI_GYRO)
+
+#include "build/debug.h"
+
+#include "common/axis.h"
+#include "common/filter.h"
+#include "common/maths.h"
+
+#include "sensors/gyro_fusion.h"
+
+// Inverse-variance fusion of two gyros on the same airframe. Each sensor's noise is taken around the
+// flap frequency, between GYRO_FUSION_BODY_HZ and GYRO_FUSION_BAND_HZ, less the part coherent with the
+// stroke, which Espelho cancels anyway. What is left is the body motion, common to both, and the
+// coupling particular to each sensor's mount. With b = T + n for both sensors and the n independent,
+// E[b1·(b1 - b2)] = σ1² and E[b2·(b2 - b1)] = σ2², so the body motion drops out without a model of it.
+
+#define GYRO_FUSION_SENSOR_COUNT 2
+#define GYRO_FUSION_BODY_HZ 2.0f        // under the slowest flap
+#define GYRO_FUSION_BAND_HZ 50.0f       // a couple of harmonics over the fastest flap
+#define GYRO_FUSION_LOCKIN_HZ 0.5f      // a few strokes for the stroke-coherent part
+#define GYRO_FUSION_NOISE_HZ 0.05f      // seconds of noise power, the estimate is noisy itself
+#define GYRO_FUSION_NOISE_FLOOR 0.01f   // (°/s)², keeps the weights even on a quiet bench
+
+typedef struct gyroFusionSensor_s {
+    pt1Filter_t bodyLpf;
+    pt1Filter_t bandLpf;
+    float inPhase;
+    pt1Filter_t noiseLpf;
+} gyroFusionSensor_t;
+
+static FAST_RAM_ZERO_INIT gyroFusionSensor_t fusionSensor[XYZ_AXIS_COUNT][GYRO_FUSION_SENSOR_COUNT];
+static FAST_RAM_ZERO_INIT float lockinGain;
+static FAST_RAM_ZERO_INIT float fusionWeight[XYZ_AXIS_COUNT];
+
+void gyroFusionInit(uint32_t looptimeUs)
+{
+    const float dT = looptimeUs * 1e-6f;
+
+    lockinGain = pt1FilterGain(GYRO_FUSION_LOCKIN_HZ, dT);
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        for (int i = 0; i < GYRO_FUSION_SENSOR_COUNT; i++) {
+            gyroFusionSensor_t *sensor = &fusionSensor[axis][i];
+            pt1FilterInit(&sensor->bodyLpf, pt1FilterGain(GYRO_FUSION_BODY_HZ, dT));
+            pt1FilterInit(&sensor->bandLpf, pt1FilterGain(GYRO_FUSION_BAND_HZ, dT));
+            pt1FilterInit(&sensor->noiseLpf, pt1FilterGain(GYRO_FUSION_NOISE_HZ, dT));
+            sensor->inPhase = 0.0f;
+        }
+        fusionWeight[axis] = 0.5f;
+    }
+}
+
+static FAST_CODE float gyroFusionResidual(gyroFusionSensor_t *sensor, float rate, float sinTheta)
+{
+    const float band = pt1FilterApply(&sensor->bandLpf, rate) - pt1FilterApply(&sensor->bodyLpf, rate);
+
+    // band × sin(θ) averages to half the in-phase amplitude, as in Espelho
+    sensor->inPhase += lockinGain * (band * sinTheta - sensor->inPhase);
+    return band - 2.0f * sensor->inPhase * sinTheta;
+}
+
+FAST_CODE float gyroFusionApply(int axis, float rate1, float rate2, float sinTheta)
+{
+    gyroFusionSensor_t *sensor1 = &fusionSensor[axis][0];
+    gyroFusionSensor_t *sensor2 = &fusionSensor[axis][1];
+    const float residual1 = gyroFusionResidual(sensor1, rate1, sinTheta);
+    const float residual2 = gyroFusionResidual(sensor2, rate2, sinTheta);
+    const float difference = residual1 - residual2;
+
+    // short runs of the estimate can dip under zero, the floor also covers that
+    const float noise1 = MAX(pt1FilterApply(&sensor1->noiseLpf, residual1 * difference), 0.0f) + GYRO_FUSION_NOISE_FLOOR;
+    const float noise2 = MAX(pt1FilterApply(&sensor2->noiseLpf, -residual2 * difference), 0.0f) + GYRO_FUSION_NOISE_FLOOR;
+
+    // weights 1/σ² normalised, so gyro 2 gets σ1² / (σ1² + σ2²)
+    fusionWeight[axis] = noise1 / (noise1 + noise2);
+    DEBUG_SET(DEBUG_GYRO_FUSION, axis, lrintf(fusionWeight[axis] * 1000));
+
+    return rate1 + fusionWeight[axis] * (rate2 - rate1);
+}
+
+// Share of gyro 2 in the fused rate, 0.5 for an even split
+float gyroFusionWeight(int axis)
+{
+    return fusionWeight[axis];
+}
+
+#endif // USE_MULTI_GYRO
@@ -68,9 +68,34 @@ static udpLink_t stateLink, pwmLink;
 static pthread_mutex_t updateLock;
 static pthread_mutex_t mainLoopLock;
 
+// Lock-step mode, selected with the SITL_LOCKSTEP environment variable ("fdm" or "internal").
+// Time is virtual and only the main thread moves it: by SITL_LOCKSTEP_PASS_US per scheduler pass, and by the
+// requested amount in delay calls. In fdm mode it may not pass the timestamp of the last FDM packet. At that point
+// the motor outputs go back to the simulator and the main thread waits for the next packet. The packet's sensor
+// values are applied from the main thread, so runs with the same packet stream are identical.
+// In internal mode there is no simulator and time free runs, which suits loop timing benchmarks.
+typedef enum {
+    SITL_LOCKSTEP_OFF = 0,
+    SITL_LOCKSTEP_FDM,
+    SITL_LOCKSTEP_INTERNAL,
+} sitlLockstepMode_e;
+
+#define SITL_LOCKSTEP_PASS_US 5
+
+static sitlLockstepMode_e lockstepMode = SITL_LOCKSTEP_OFF;
+static uint64_t virtualTimeUs;
+static uint64_t virtualTimeLimitUs;
+static pthread_mutex_t lockstepLock;
+static pthread_cond_t lockstepCond;
+static fdm_packet lockstepPkt;
+static bool lockstepPktPending = false;
+
 int timeval_sub(struct timespec *result, struct timespec *x, struct timespec *y);
 
 int lockMainPID(void) {
+    if (lockstepMode != SITL_LOCKSTEP_OFF) {
+        return 0;
+    }
     return pthread_mutex_trylock(&mainLoopLock);
 }
 
@@ -80,26 +105,11 @@ int lockMainPID(void) {
 void sendMotorUpdate() {
     udpSend(&pwmLink, &pwmPkt, sizeof(servo_packet));
 }
-void updateState(const fdm_packet* pkt) {
-    static double last_timestamp = 0; // in seconds
-    static uint64_t last_realtime = 0; // in uS
-    static struct timespec last_ts; // last packet
 
-    struct timespec now_ts;
-    clock_gettime(CLOCK_MONOTONIC, &now_ts);
-
-    const uint64_t realtime_now = micros64_real();
-    if (realtime_now > last_realtime + 500*1e3) { // 500ms timeout
-        last_timestamp = pkt->timestamp;
-        last_realtime = realtime_now;
-        sendMotorUpdate();
-        return;
-    }
-
-    const double deltaSim = pkt->timestamp - last_timestamp;  // in seconds
-    if (deltaSim < 0) { // don't use old packet
-        return;
-    }
+static void fdmSetSensors(const fdm_packet *pkt, double deltaSim) {
+#if !defined(SIMULATOR_IMU_SYNC)
+    UNUSED(deltaSim);
+#endif
 
     int16_t x,y,z;
     x = constrain(-pkt->imu_linear_acceleration_xyz[0] * ACC_SCALE, -32767, 32767);
@@ -149,6 +159,30 @@ void updateState(const fdm_packet* pkt) {
     imuSetHasNewData(deltaSim*1e6);
     imuUpdateAttitude(micros());
 #endif
+}
+
+void updateState(const fdm_packet* pkt) {
+    static double last_timestamp = 0; // in seconds
+    static uint64_t last_realtime = 0; // in uS
+    static struct timespec last_ts; // last packet
+
+    struct timespec now_ts;
+    clock_gettime(CLOCK_MONOTONIC, &now_ts);
+
+    const uint64_t realtime_now = micros64_real();
+    if (realtime_now > last_realtime + 500*1e3) { // 500ms timeout
+        last_timestamp = pkt->timestamp;
+        last_realtime = realtime_now;
+        sendMotorUpdate();
+        return;
+    }
+
+    const double deltaSim = pkt->timestamp - last_timestamp;  // in seconds
+    if (deltaSim < 0) { // don't use old packet
+        return;
+    }
+
+    fdmSetSensors(pkt, deltaSim);
 
 
     if (deltaSim < 0.02 && deltaSim > 0) { // simulator should run faster than 50Hz
@@ -172,6 +206,53 @@ void updateState(const fdm_packet* pkt) {
 #endif
 }
 
+// hand the packet to the main thread, waiting for it to consume the previous one so no step is skipped
+static void lockstepQueuePacket(const fdm_packet *pkt) {
+    pthread_mutex_lock(&lockstepLock);
+    while (lockstepPktPending && workerRunning) {
+        pthread_cond_wait(&lockstepCond, &lockstepLock);
+    }
+    lockstepPkt = *pkt;
+    lockstepPktPending = true;
+    pthread_cond_broadcast(&lockstepCond);
+    pthread_mutex_unlock(&lockstepLock);
+}
+
+// wait for the simulator's next step and let virtual time run up to its timestamp
+static void lockstepNextPacket(void) {
+    static bool started = false;
+    static double firstTimestamp;
+    static uint64_t firstTimeUs;
+    static double lastTimestamp;
+
+    // outputs for the step just finished, which the simulator needs before it steps again
+    sendMotorUpdate();
+
+    fdm_packet pkt;
+    pthread_mutex_lock(&lockstepLock);
+    while (!lockstepPktPending) {
+        pthread_cond_wait(&lockstepCond, &lockstepLock);
+    }
+    pkt = lockstepPkt;
+    lockstepPktPending = false;
+    pthread_cond_broadcast(&lockstepCond);
+    pthread_mutex_unlock(&lockstepLock);
+
+    if (!started || pkt.timestamp < lastTimestamp) {
+        // first packet or a restarted simulation
+        started = true;
+        firstTimestamp = pkt.timestamp;
+        firstTimeUs = virtualTimeUs;
+        lastTimestamp = pkt.timestamp;
+    }
+
+    fdmSetSensors(&pkt, pkt.timestamp - lastTimestamp);
+    lastTimestamp = pkt.timestamp;
+
+    // from the first timestamp rather than accumulated deltas, so rounding can't drift
+    virtualTimeLimitUs = firstTimeUs + llrint((pkt.timestamp - firstTimestamp) * 1e6);
+}
+
 static void* udpThread(void* data) {
     UNUSED(data);
     int n = 0;
@@ -180,7 +261,11 @@ static void* udpThread(void* data) {
         n = udpRecv(&stateLink, &fdmPkt, sizeof(fdm_packet), 100);
         if (n == sizeof(fdm_packet)) {
 //            printf("[data]new fdm %d\n", n);
-            updateState(&fdmPkt);
+            if (lockstepMode == SITL_LOCKSTEP_FDM) {
+                lockstepQueuePacket(&fdmPkt);
+            } else {
+                updateState(&fdmPkt);
+            }
         }
     }
 
@@ -211,6 +296,19 @@ void systemInit(void) {
     clock_gettime(CLOCK_MONOTONIC, &start_time);
     printf("[system]Init...\n");
 
+    const char *lockstep = getenv("SITL_LOCKSTEP");
+    if (lockstep && strcmp(lockstep, "fdm") == 0) {
+        lockstepMode = SITL_LOCKSTEP_FDM;
+    } else if (lockstep && strcmp(lockstep, "internal") == 0) {
+        lockstepMode = SITL_LOCKSTEP_INTERNAL;
+    }
+    printf("[system]lock-step mode %d\n", lockstepMode);
+
+    if (pthread_mutex_init(&lockstepLock, NULL) != 0 || pthread_cond_init(&lockstepCond, NULL) != 0) {
+        printf("Create lockstepLock error!\n");
+        exit(1);
+    }
+
     SystemCoreClock = 500 * 1e6; // fake 500MHz
     FLASH_Unlock();
 
@@ -300,6 +398,10 @@ uint64_t millis64_real() {
 }
 
 uint64_t micros64() {
+    if (lockstepMode != SITL_LOCKSTEP_OFF) {
+        return virtualTimeUs;
+    }
+
     static uint64_t last = 0;
     static uint64_t out = 0;
     uint64_t now = nanos64_real();
@@ -312,6 +414,10 @@ uint64_t micros64() {
 }
 
 uint64_t millis64() {
+    if (lockstepMode != SITL_LOCKSTEP_OFF) {
+        return virtualTimeUs / 1000;
+    }
+
     static uint64_t last = 0;
     static uint64_t out = 0;
     uint64_t now = nanos64_real();
@@ -339,6 +445,10 @@ void microsleep(uint32_t usec) {
 }
 
 void delayMicroseconds(uint32_t us) {
+    if (lockstepMode != SITL_LOCKSTEP_OFF) {
+        virtualTimeUs += us;
+        return;
+    }
     microsleep(us / simRate);
 }
 
@@ -347,6 +457,11 @@ void delayMicroseconds_real(uint32_t us) {
 }
 
 void delay(uint32_t ms) {
+    if (lockstepMode != SITL_LOCKSTEP_OFF) {
+        virtualTimeUs += ms * 1000ULL;
+        return;
+    }
+
     uint64_t start = millis64();
 
     while ((millis64() - start) < ms) {
@@ -354,6 +469,19 @@ void delay(uint32_t ms) {
     }
 }
 
+// Called by the main loop after every scheduler pass
+void simulatorLoopYield(void) {
+    if (lockstepMode == SITL_LOCKSTEP_OFF) {
+        delayMicroseconds_real(50); // max rate 20kHz
+        return;
+    }
+
+    virtualTimeUs += SITL_LOCKSTEP_PASS_US;
+    if (lockstepMode == SITL_LOCKSTEP_FDM && virtualTimeUs >= virtualTimeLimitUs) {
+        lockstepNextPacket();
+    }
+}
+
 // Subtract the ‘struct timespec’ values X and Y,  storing the result in RESULT.
 // Return 1 if the difference is negative, otherwise 0.
 // result = x - y
@@ -447,6 +575,9 @@ void pwmCompleteMotorUpdate(uint8_t motorCount) {
     pwmPkt.motor_speed[1] = motorsPwm[2] / outScale;
     pwmPkt.motor_speed[2] = motorsPwm[3] / outScale;
 
+    // in lock-step mode the outputs go back once per simulator step instead
+    if (lockstepMode != SITL_LOCKSTEP_OFF) return;
+
     // get one "fdm_packet" can only send one "servo_packet"!!
     if (pthread_mutex_trylock(&updateLock) != 0) return;
     udpSend(&pwmLink, &pwmPkt, sizeof(servo_packet));
@@ -494,6 +625,7 @@ void FLASH_Unlock(void) {
         }
     } else {
         printf("[FLASH_Unlock] created '%s', size = %ld\n", EEPROM_FILENAME, sizeof(eepromData));
+        memset(eepromData, 0xFF, sizeof(eepromData)); // erased flash
         if ((eepromFd = fopen(EEPROM_FILENAME, "w+")) == NULL) {
             fprintf(stderr, "[FLASH_Unlock] failed to create '%s'\n", EEPROM_FILENAME);
             return;
@@ -518,7 +650,9 @@ void FLASH_Lock(void) {
 }
 
 FLASH_Status FLASH_ErasePage(uintptr_t Page_Address) {
-    UNUSED(Page_Address);
+    if ((Page_Address >= (uintptr_t)eepromData) && (Page_Address < (uintptr_t)ARRAYEND(eepromData))) {
+        memset((void *)Page_Address, 0xFF, MIN(FLASH_PAGE_SIZE, (uintptr_t)ARRAYEND(eepromData) - Page_Address));
+    }
 //    printf("[FLASH_ErasePage]%x\n", Page_Address);
     return FLASH_COMPLETE;
 }
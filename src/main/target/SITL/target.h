@@ -44,6 +44,7 @@
 #define EEPROM_FILENAME "eeprom.bin"
 #define EEPROM_IN_RAM
 #define EEPROM_SIZE     32768
+#define FLASH_PAGE_SIZE ((uint32_t)0x400)
 
 #define U_ID_0 0
 #define U_ID_1 1
@@ -263,3 +264,4 @@ uint64_t micros64(void);
 uint64_t millis64(void);
 
 int lockMainPID(void);
+void simulatorLoopYield(void);
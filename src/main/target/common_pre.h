@@ -93,6 +93,7 @@
 #define USE_DMA_SPEC
 #define USE_TIMER_MGMT
 #define USE_PERSISTENT_OBJECTS
+#define USE_CRC_HARDWARE
 // Re-enable this after 4.0 has been released, and remove the define from STM32F4DISCOVERY
 //#define USE_SPI_TRANSACTION
 #endif // STM32F7
@@ -174,6 +175,7 @@
 #endif
 
 #if (FLASH_SIZE > 128)
+#define USE_CRC_SLICING
 #define USE_GYRO_OVERFLOW_CHECK
 // #define USE_YAW_SPIN_RECOVERY
 #define USE_DSHOT_DMAR
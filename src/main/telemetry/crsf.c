@@ -49,6 +49,7 @@
 #include "fc/runtime_config.h"
 
 #include "flight/imu.h"
+#include "flight/pid.h"
 #include "flight/position.h"
 
 #include "io/displayport_crsf.h"
@@ -68,6 +69,7 @@
 
 
 #define CRSF_CYCLETIME_US                   100000 // 100ms, 10 Hz
+#define CRSF_STALENESS_MAX_US               2000000U // frame age is clamped so weighted priorities cannot overflow
 #define CRSF_DEVICEINFO_VERSION             0x01
 #define CRSF_DEVICEINFO_PARAMETER_COUNT     0
 
@@ -76,7 +78,6 @@
 
 static bool crsfTelemetryEnabled;
 static bool deviceInfoReplyPending;
-static uint8_t crsfFrame[CRSF_FRAME_SIZE_MAX];
 
 #if defined(USE_MSP_OVER_TELEMETRY)
 typedef struct mspBuffer_s {
@@ -128,31 +129,30 @@ bool handleCrsfMspFrameBuffer(uint8_t payloadSize, mspResponseFnPtr responseFn)
 }
 #endif
 
-static void crsfInitializeFrame(sbuf_t *dst)
+static void crsfInitializeFrameBuf(sbuf_t *dst, uint8_t *frame)
 {
-    dst->ptr = crsfFrame;
-    dst->end = ARRAYEND(crsfFrame);
+    dst->ptr = frame;
+    dst->end = frame + CRSF_FRAME_SIZE_MAX;
 
     sbufWriteU8(dst, CRSF_SYNC_BYTE);
 }
 
-static void crsfFinalize(sbuf_t *dst)
+// Frames are built directly in the receiver's pending telemetry buffer
+static void crsfInitializeFrame(sbuf_t *dst)
 {
-    crc8_dvb_s2_sbuf_append(dst, &crsfFrame[2]); // start at byte 2, since CRC does not include device address and frame length
-    sbufSwitchToReader(dst, crsfFrame);
-    // write the telemetry frame to the receiver.
-    crsfRxWriteTelemetryData(sbufPtr(dst), sbufBytesRemaining(dst));
+    crsfInitializeFrameBuf(dst, crsfRxTelemetryFrameBuffer());
 }
 
 static int crsfFinalizeBuf(sbuf_t *dst, uint8_t *frame)
 {
-    crc8_dvb_s2_sbuf_append(dst, &crsfFrame[2]); // start at byte 2, since CRC does not include device address and frame length
-    sbufSwitchToReader(dst, crsfFrame);
-    const int frameSize = sbufBytesRemaining(dst);
-    for (int ii = 0; sbufBytesRemaining(dst); ++ii) {
-        frame[ii] = sbufReadU8(dst);
-    }
-    return frameSize;
+    crc8_dvb_s2_sbuf_append(dst, &frame[2]); // start at byte 2, since CRC does not include device address and frame length
+    return sbufPtr(dst) - frame;
+}
+
+static void crsfFinalize(sbuf_t *dst)
+{
+    // the frame is already in place, so handing it to the receiver is just a matter of setting its length
+    crsfRxCommitTelemetryData(crsfFinalizeBuf(dst, crsfRxTelemetryFrameBuffer()));
 }
 
 /*
@@ -336,6 +336,40 @@ void crsfFrameDeviceInfo(sbuf_t *dst) {
     *lengthPtr = sbufPtr(dst) - lengthPtr;
 }
 
+static void crsfWriteScaledS16BigEndian(sbuf_t *dst, float value, float scale)
+{
+    sbufWriteU16BigEndian(dst, (int16_t)constrainf(value * scale, INT16_MIN, INT16_MAX));
+}
+
+/*
+0x7E Ornithopter wing state (OrniFlight specific)
+The type is in the extended header range, so the frame carries destination and origin addresses.
+Payload:
+uint8_t     Destination
+uint8_t     Origin
+uint16_t    Stroke frequency ( Hz * 100 )
+int16_t     Stroke amplitude ( degree * 100 )
+int16_t     Ferocity modulation ( * 1000 )
+int16_t     Ferocity differential roll ( * 1000 )
+int16_t     Ferocity differential yaw ( * 1000 )
+*/
+void crsfFrameOrnithopterWing(sbuf_t *dst)
+{
+    ornithopterWingState_t state;
+    getOrnithopterWingState(&state);
+
+    sbufWriteU8(dst, CRSF_FRAME_ORNITHOPTER_WING_PAYLOAD_SIZE + CRSF_FRAME_LENGTH_EXT_TYPE_CRC);
+    sbufWriteU8(dst, CRSF_FRAMETYPE_ORNITHOPTER_WING);
+    sbufWriteU8(dst, CRSF_ADDRESS_RADIO_TRANSMITTER);
+    sbufWriteU8(dst, CRSF_ADDRESS_FLIGHT_CONTROLLER);
+    sbufWriteU16BigEndian(dst, (uint16_t)constrainf(state.omega * (100.0f / (2.0f * M_PIf)), 0, UINT16_MAX));
+    // same scaling as MSP2_ORNIFLIGHT_WING_STATE
+    crsfWriteScaledS16BigEndian(dst, state.amplitude, 100.0f);
+    crsfWriteScaledS16BigEndian(dst, state.ferocityModulation, 1000.0f);
+    crsfWriteScaledS16BigEndian(dst, state.ferocityDifferentialRoll, 1000.0f);
+    crsfWriteScaledS16BigEndian(dst, state.ferocityDifferentialYaw, 1000.0f);
+}
+
 #if defined(USE_CRSF_CMS_TELEMETRY)
 
 static void crsfFrameDisplayPortRow(sbuf_t *dst, uint8_t row)
@@ -369,18 +403,43 @@ static void crsfFrameDisplayPortClear(sbuf_t *dst)
 
 #define BV(x)  (1 << (x)) // bit value
 
-// schedule array to decide how often each type of frame is sent
 typedef enum {
     CRSF_FRAME_START_INDEX = 0,
     CRSF_FRAME_ATTITUDE_INDEX = CRSF_FRAME_START_INDEX,
     CRSF_FRAME_BATTERY_SENSOR_INDEX,
     CRSF_FRAME_FLIGHT_MODE_INDEX,
     CRSF_FRAME_GPS_INDEX,
+    CRSF_FRAME_ORNITHOPTER_WING_INDEX,
     CRSF_SCHEDULE_COUNT_MAX
 } crsfFrameTypeIndex_e;
 
+typedef struct crsfScheduledFrame_s {
+    void (*build)(sbuf_t *dst);
+    uint8_t weight;         // share of the telemetry slots relative to the other frames
+    uint32_t keepaliveUs;   // an unchanged frame is still resent after this long
+} crsfScheduledFrame_t;
+
+// Weights favour the small, fast changing frames; the large GPS frame and the
+// slowly changing battery and flight mode frames use less of the link budget.
+static const crsfScheduledFrame_t crsfScheduledFrames[CRSF_SCHEDULE_COUNT_MAX] = {
+    [CRSF_FRAME_ATTITUDE_INDEX]         = { crsfFrameAttitude,         4, 500000 },
+    [CRSF_FRAME_BATTERY_SENSOR_INDEX]   = { crsfFrameBatterySensor,    1, 1000000 },
+    [CRSF_FRAME_FLIGHT_MODE_INDEX]      = { crsfFrameFlightMode,       1, 1000000 },
+#ifdef USE_GPS
+    [CRSF_FRAME_GPS_INDEX]              = { crsfFrameGps,              2, 1000000 },
+#endif
+    [CRSF_FRAME_ORNITHOPTER_WING_INDEX] = { crsfFrameOrnithopterWing,  4, 500000 },
+};
+
+typedef struct crsfFrameState_s {
+    timeUs_t lastSentUs;
+    uint8_t lastCrc;
+    uint8_t lastLength;
+} crsfFrameState_t;
+
 static uint8_t crsfScheduleCount;
-static uint8_t crsfSchedule[CRSF_SCHEDULE_COUNT_MAX];
+static uint8_t crsfScheduleMask;
+static crsfFrameState_t crsfFrameState[CRSF_SCHEDULE_COUNT_MAX];
 
 #if defined(USE_MSP_OVER_TELEMETRY)
 
@@ -406,39 +465,51 @@ void crsfSendMspResponse(uint8_t *payload)
 }
 #endif
 
-static void processCrsf(void)
+/*
+ * Sends the enabled frame with the largest weighted age. A frame whose content (length and CRC)
+ * has not changed since it was last sent is skipped until its keepalive expires, and the slot
+ * goes to the next candidate instead, so the slot budget is spent on data that has changed.
+ */
+STATIC_UNIT_TESTED void processCrsf(timeUs_t currentTimeUs)
 {
-    static uint8_t crsfScheduleIndex = 0;
-
-    const uint8_t currentSchedule = crsfSchedule[crsfScheduleIndex];
+    uint8_t candidates = crsfScheduleMask;
+
+    while (candidates) {
+        int index = -1;
+        uint32_t age = 0;
+        uint32_t bestPriority = 0;
+        for (int ii = CRSF_FRAME_START_INDEX; ii < CRSF_SCHEDULE_COUNT_MAX; ii++) {
+            if (candidates & BV(ii)) {
+                const uint32_t frameAge = MIN((uint32_t)cmpTimeUs(currentTimeUs, crsfFrameState[ii].lastSentUs), CRSF_STALENESS_MAX_US);
+                const uint32_t priority = frameAge * crsfScheduledFrames[ii].weight;
+                if (index < 0 || priority > bestPriority) {
+                    index = ii;
+                    age = frameAge;
+                    bestPriority = priority;
+                }
+            }
+        }
+        candidates &= ~BV(index);
 
-    sbuf_t crsfPayloadBuf;
-    sbuf_t *dst = &crsfPayloadBuf;
+        sbuf_t crsfPayloadBuf;
+        sbuf_t *dst = &crsfPayloadBuf;
+        uint8_t *frame = crsfRxTelemetryFrameBuffer();
 
-    if (currentSchedule & BV(CRSF_FRAME_ATTITUDE_INDEX)) {
-        crsfInitializeFrame(dst);
-        crsfFrameAttitude(dst);
-        crsfFinalize(dst);
-    }
-    if (currentSchedule & BV(CRSF_FRAME_BATTERY_SENSOR_INDEX)) {
-        crsfInitializeFrame(dst);
-        crsfFrameBatterySensor(dst);
-        crsfFinalize(dst);
-    }
+        crsfInitializeFrameBuf(dst, frame);
+        crsfScheduledFrames[index].build(dst);
+        const int frameLength = crsfFinalizeBuf(dst, frame);
 
-    if (currentSchedule & BV(CRSF_FRAME_FLIGHT_MODE_INDEX)) {
-        crsfInitializeFrame(dst);
-        crsfFrameFlightMode(dst);
-        crsfFinalize(dst);
-    }
-#ifdef USE_GPS
-    if (currentSchedule & BV(CRSF_FRAME_GPS_INDEX)) {
-        crsfInitializeFrame(dst);
-        crsfFrameGps(dst);
-        crsfFinalize(dst);
+        crsfFrameState_t *state = &crsfFrameState[index];
+        const uint8_t crc = frame[frameLength - 1];
+        if (crc == state->lastCrc && frameLength == state->lastLength && age < crsfScheduledFrames[index].keepaliveUs) {
+            continue;
+        }
+        state->lastSentUs = currentTimeUs;
+        state->lastCrc = crc;
+        state->lastLength = frameLength;
+        crsfRxCommitTelemetryData(frameLength);
+        return;
     }
-#endif
-    crsfScheduleIndex = (crsfScheduleIndex + 1) % crsfScheduleCount;
 }
 
 void crsfScheduleDeviceInfoResponse(void)
@@ -466,22 +537,30 @@ void initCrsfTelemetry(void)
     cmsDisplayPortRegister(displayPortCrsfInit());
 #endif
 
-    int index = 0;
+    crsfScheduleMask = 0;
     if (sensors(SENSOR_ACC) && telemetryIsSensorEnabled(SENSOR_PITCH | SENSOR_ROLL | SENSOR_HEADING)) {
-        crsfSchedule[index++] = BV(CRSF_FRAME_ATTITUDE_INDEX);
+        crsfScheduleMask |= BV(CRSF_FRAME_ATTITUDE_INDEX);
     }
     if ((isBatteryVoltageConfigured() && telemetryIsSensorEnabled(SENSOR_VOLTAGE))
         || (isAmperageConfigured() && telemetryIsSensorEnabled(SENSOR_CURRENT | SENSOR_FUEL))) {
-        crsfSchedule[index++] = BV(CRSF_FRAME_BATTERY_SENSOR_INDEX);
+        crsfScheduleMask |= BV(CRSF_FRAME_BATTERY_SENSOR_INDEX);
     }
-    crsfSchedule[index++] = BV(CRSF_FRAME_FLIGHT_MODE_INDEX);
+    crsfScheduleMask |= BV(CRSF_FRAME_FLIGHT_MODE_INDEX);
 #ifdef USE_GPS
     if (featureIsEnabled(FEATURE_GPS)
        && telemetryIsSensorEnabled(SENSOR_ALTITUDE | SENSOR_LAT_LONG | SENSOR_GROUND_SPEED | SENSOR_HEADING)) {
-        crsfSchedule[index++] = BV(CRSF_FRAME_GPS_INDEX);
+        crsfScheduleMask |= BV(CRSF_FRAME_GPS_INDEX);
     }
 #endif
-    crsfScheduleCount = (uint8_t)index;
+    crsfScheduleMask |= BV(CRSF_FRAME_ORNITHOPTER_WING_INDEX);
+
+    crsfScheduleCount = 0;
+    for (int ii = CRSF_FRAME_START_INDEX; ii < CRSF_SCHEDULE_COUNT_MAX; ii++) {
+        if (crsfScheduleMask & BV(ii)) {
+            crsfScheduleCount++;
+        }
+        crsfFrameState[ii].lastLength = 0;
+    }
  }
 
 bool checkCrsfTelemetryState(void)
@@ -573,11 +652,11 @@ void handleCrsfTelemetry(timeUs_t currentTimeUs)
     }
 #endif
 
-    // Actual telemetry data only needs to be sent at a low frequency, ie 10Hz
-    // Spread out scheduled frames evenly so each frame is sent at the same frequency.
+    // Actual telemetry data only needs to be sent at a low frequency, ie 10Hz per frame on average.
+    // The slots are spread out evenly and processCrsf() decides which frame gets each one.
     if (currentTimeUs >= crsfLastCycleTime + (CRSF_CYCLETIME_US / crsfScheduleCount)) {
         crsfLastCycleTime = currentTimeUs;
-        processCrsf();
+        processCrsf(currentTimeUs);
     }
 }
 
@@ -586,7 +665,7 @@ int getCrsfFrame(uint8_t *frame, crsfFrameType_e frameType)
     sbuf_t crsfFrameBuf;
     sbuf_t *sbuf = &crsfFrameBuf;
 
-    crsfInitializeFrame(sbuf);
+    crsfInitializeFrameBuf(sbuf, frame);
     switch (frameType) {
     default:
     case CRSF_FRAMETYPE_ATTITUDE:
@@ -603,6 +682,9 @@ int getCrsfFrame(uint8_t *frame, crsfFrameType_e frameType)
         crsfFrameGps(sbuf);
         break;
 #endif
+    case CRSF_FRAMETYPE_ORNITHOPTER_WING:
+        crsfFrameOrnithopterWing(sbuf);
+        break;
     }
     const int frameSize = crsfFinalizeBuf(sbuf, frame);
     return frameSize;
@@ -0,0 +1,30 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// Host stand-in for the CMSIS DSP header, which only builds for Cortex-M. gyroanalyse.h needs the FFT
+// instance type to lay out gyroAnalyseState_t; the analysis itself is stubbed in gyro_filter_bench.c.
+
+typedef struct arm_rfft_fast_instance_f32_s {
+    uint16_t fftLenRFFT;
+} arm_rfft_fast_instance_f32;
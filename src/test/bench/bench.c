@@ -0,0 +1,109 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "bench.h"
+
+#define BENCH_BATCH_COUNT       30
+#define BENCH_BATCH_MIN_NS      2000000     // grow the batch until one takes at least 2ms
+#define BENCH_WARMUP_BATCHES    3
+
+static uint64_t nanos(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint64_t timeBatch(const benchCase_t *benchCase, uint32_t iterations)
+{
+    const uint64_t start = nanos();
+    benchCase->run(iterations);
+    return nanos() - start;
+}
+
+float benchNoise(uint32_t index)
+{
+    // xorshift of the index, so any sample can be regenerated without state
+    uint32_t x = index * 2654435761u + 1;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return (float)(x & 0xffff) / 32767.5f - 1.0f;
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *csv = NULL;
+    if (argc > 1) {
+        csv = fopen(argv[1], "w");
+        if (!csv) {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+
+    printf("%-12s %-36s %12s %10s %10s %10s\n", "bench", "case", "calls", "mean ns", "stddev ns", "min ns");
+    for (int i = 0; i < benchCaseCount; i++) {
+        const benchCase_t *benchCase = &benchCases[i];
+        if (benchCase->setup) {
+            benchCase->setup();
+        }
+
+        uint32_t iterations = 1;
+        while (timeBatch(benchCase, iterations) < BENCH_BATCH_MIN_NS && iterations < (1u << 30)) {
+            iterations *= 2;
+        }
+        for (int batch = 0; batch < BENCH_WARMUP_BATCHES; batch++) {
+            timeBatch(benchCase, iterations);
+        }
+
+        double sum = 0;
+        double sumSq = 0;
+        double min = INFINITY;
+        for (int batch = 0; batch < BENCH_BATCH_COUNT; batch++) {
+            const double perCall = (double)timeBatch(benchCase, iterations) / iterations;
+            sum += perCall;
+            sumSq += perCall * perCall;
+            if (perCall < min) {
+                min = perCall;
+            }
+        }
+        const double mean = sum / BENCH_BATCH_COUNT;
+        const double variance = sumSq / BENCH_BATCH_COUNT - mean * mean;
+        const double stddev = variance > 0 ? sqrt(variance) : 0;
+        const unsigned long long calls = (unsigned long long)iterations * BENCH_BATCH_COUNT;
+
+        printf("%-12s %-36s %12llu %10.2f %10.2f %10.2f\n", benchName, benchCase->name, calls, mean, stddev, min);
+        if (csv) {
+            fprintf(csv, "%s,%s,%llu,%.3f,%.3f,%.3f\n", benchName, benchCase->name, calls, mean, stddev, min);
+        }
+    }
+
+    if (csv) {
+        fclose(csv);
+    }
+    return 0;
+}
@@ -0,0 +1,47 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// Host microbenchmarks of flight hot paths, see `make bench` in src/test/Makefile.
+//
+// Each <name>_bench.c defines benchName and the benchCases table. bench.c provides main(), which runs
+// every case in batches, reports mean, standard deviation and minimum ns per call, and appends one CSV
+// line per case to the file given as the first argument:
+//   bench,case,calls,mean_ns,stddev_ns,min_ns
+
+typedef struct benchCase_s {
+    const char *name;
+    void (*setup)(void);                // optional, called once before timing
+    void (*run)(uint32_t iterations);   // performs the measured operation this many times
+} benchCase_t;
+
+extern const char benchName[];
+extern const benchCase_t benchCases[];
+extern const int benchCaseCount;
+
+// Keeps the compiler from discarding a result or hoisting a load out of the timed loop
+#define benchUse(value) __asm__ volatile("" : : "r,m"(value) : "memory")
+#define benchClobber() __asm__ volatile("" : : : "memory")
+
+// Fixed synthetic input: deterministic pseudo random value in [-1, 1], the same on every run
+float benchNoise(uint32_t index);
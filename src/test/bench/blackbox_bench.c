@@ -0,0 +1,247 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#include "blackbox/blackbox.h"
+#include "blackbox/blackbox_encoding.h"
+
+#include "build/debug.h"
+
+#include "common/axis.h"
+#include "common/time.h"
+#include "common/utils.h"
+
+#include "drivers/serial.h"
+
+#include "fc/loop_overrun.h"
+#include "fc/rc_controls.h"
+#include "fc/rc_modes.h"
+
+#include "flight/failsafe.h"
+#include "flight/mixer.h"
+#include "flight/pid.h"
+#include "flight/servos.h"
+
+#include "io/gps.h"
+#include "io/serial.h"
+
+#include "pg/pg.h"
+#include "pg/pg_ids.h"
+#include "pg/rx.h"
+
+#include "rx/rx.h"
+
+#include "sensors/acceleration.h"
+#include "sensors/barometer.h"
+#include "sensors/battery.h"
+#include "sensors/compass.h"
+#include "sensors/gyro.h"
+
+#include "bench.h"
+
+// blackboxLogIteration() and blackboxAdvanceIterationTimers() from the real blackbox.c at a 1kHz PID loop with the
+// default p_ratio, so every iteration writes a P frame and every 32nd an I frame instead. The main state is loaded
+// from the flight variables as in flight: a quad with PID D on all axes, vbat, rssi and acc. The serial port is
+// a ring buffer in RAM, so this measures the logging alone.
+
+#define PID_LOOPTIME_US 1000
+#define FRAME_SAMPLE_COUNT 256
+#define MOTOR_COUNT 4
+
+void blackboxStart(void);
+void blackboxLogIteration(timeUs_t currentTimeUs);
+void blackboxAdvanceIterationTimers(void);
+
+PG_REGISTER(flight3DConfig_t, flight3DConfig, PG_MOTOR_3D_CONFIG, 0);
+PG_REGISTER(mixerConfig_t, mixerConfig, PG_MIXER_CONFIG, 0);
+PG_REGISTER(motorConfig_t, motorConfig, PG_MOTOR_CONFIG, 0);
+PG_REGISTER(batteryConfig_t, batteryConfig, PG_BATTERY_CONFIG, 0);
+PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
+PG_REGISTER_ARRAY(modeActivationCondition_t, MAX_MODE_ACTIVATION_CONDITION_COUNT, modeActivationConditions, PG_MODE_ACTIVATION_PROFILE, 0);
+
+uint8_t armingFlags;
+uint8_t stateFlags;
+const uint32_t baudRates[] = {0, 9600, 19200, 38400, 57600, 115200, 230400, 250000,
+        400000, 460800, 500000, 921600, 1000000, 1500000, 2000000, 2470000}; // see baudRate_e
+int16_t debug[DEBUG16_VALUE_COUNT];
+uint8_t debugMode;
+int32_t blackboxHeaderBudget;
+gpsSolutionData_t gpsSol;
+int32_t GPS_home[2];
+
+gyro_t gyro;
+acc_t acc;
+mag_t mag;
+baro_t baro;
+pidAxisData_t pidData[3];
+float rcCommand[4];
+int16_t servo[MAX_SUPPORTED_SERVOS];
+
+float motorOutputHigh, motorOutputLow;
+float motor[MAX_SUPPORTED_MOTORS];
+float motor_disarmed[MAX_SUPPORTED_MOTORS];
+static pidProfile_t pidProfile;
+pidProfile_t *currentPidProfile = &pidProfile;
+uint32_t targetPidLooptime;
+
+boxBitmask_t rcModeActivationMask;
+
+static uint8_t deviceBuffer[4096];
+static uint32_t deviceHead;
+static serialPortConfig_t blackboxPortConfig = { .identifier = SERIAL_PORT_USART1, .blackbox_baudrateIndex = BAUD_2000000 };
+static serialPort_t blackboxSerialPort = { .txBufferSize = sizeof(deviceBuffer) };
+
+void mspSerialAllocatePorts(void) {}
+uint32_t getArmingBeepTimeMicros(void) { return 0; }
+uint16_t getBatteryVoltageLatest(void) { return 1580; }
+int32_t getAmperageLatest(void) { return 0; }
+uint16_t getRssi(void) { return 1000; }
+float pidGetPreviousSetpoint(int axis) { return 200.0f * axis; }
+float mixerGetLoggingThrottle(void) { return 0.5f; }
+uint8_t getMotorCount(void) { return MOTOR_COUNT; }
+bool areMotorsRunning(void) { return true; }
+bool IS_RC_MODE_ACTIVE(boxId_e boxId) { UNUSED(boxId); return false; }
+bool isModeActivationConditionPresent(boxId_e boxId) { UNUSED(boxId); return false; }
+uint32_t millis(void) { return 0; }
+bool sensors(uint32_t mask) { return mask == SENSOR_ACC; }
+uint32_t serialTxBytesFree(const serialPort_t *instance) { UNUSED(instance); return sizeof(deviceBuffer) - 1; }
+bool isSerialTransmitBufferEmpty(const serialPort_t *instance) { UNUSED(instance); return true; }
+bool featureIsEnabled(uint32_t mask) { UNUSED(mask); return false; }
+void mspSerialReleasePortIfAllocated(serialPort_t *serialPort) { UNUSED(serialPort); }
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e function) { UNUSED(function); return &blackboxPortConfig; }
+serialPort_t *findSharedSerialPort(uint16_t functionMask, serialPortFunction_e sharedWithFunction) { UNUSED(functionMask); UNUSED(sharedWithFunction); return NULL; }
+void closeSerialPort(serialPort_t *serialPort) { UNUSED(serialPort); }
+portSharing_e determinePortSharing(const serialPortConfig_t *portConfig, serialPortFunction_e function) { UNUSED(portConfig); UNUSED(function); return PORTSHARING_NOT_SHARED; }
+failsafePhase_e failsafePhase(void) { return FAILSAFE_IDLE; }
+bool rxAreFlightChannelsValid(void) { return true; }
+bool rxIsReceivingSignal(void) { return true; }
+bool isRssiConfigured(void) { return true; }
+uint32_t loopOverrunCount(void) { return 0; }
+const loopOverrun_t *loopOverrunGet(uint32_t index) { UNUSED(index); return NULL; }
+
+serialPort_t *openSerialPort(serialPortIdentifier_e identifier, serialPortFunction_e function, serialReceiveCallbackPtr rxCallback,
+    void *rxCallbackData, uint32_t baudrate, portMode_e mode, portOptions_e options)
+{
+    UNUSED(identifier);
+    UNUSED(function);
+    UNUSED(rxCallback);
+    UNUSED(rxCallbackData);
+    UNUSED(baudrate);
+    UNUSED(mode);
+    UNUSED(options);
+    return &blackboxSerialPort;
+}
+
+void serialWrite(serialPort_t *instance, uint8_t ch)
+{
+    UNUSED(instance);
+    deviceBuffer[deviceHead++ & (sizeof(deviceBuffer) - 1)] = ch;
+}
+
+typedef struct benchFlightState_s {
+    float pid[XYZ_AXIS_COUNT][4];
+    float gyroADCf[XYZ_AXIS_COUNT];
+    float accADC[XYZ_AXIS_COUNT];
+    float rcCommand[4];
+    float motor[MOTOR_COUNT];
+} benchFlightState_t;
+
+static benchFlightState_t frames[FRAME_SAMPLE_COUNT];
+static timeUs_t currentTimeUs;
+
+static void setupBlackbox(void)
+{
+    pgResetAll();
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    batteryConfigMutable()->voltageMeterSource = VOLTAGE_METER_ADC;
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        pidProfile.pid[axis].D = 30;
+    }
+
+    targetPidLooptime = PID_LOOPTIME_US;
+    blackboxInit();
+    blackboxStart();
+
+    for (int i = 0; i < FRAME_SAMPLE_COUNT; i++) {
+        benchFlightState_t *frame = &frames[i];
+        for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
+            frame->pid[x][0] = 40 * benchNoise(i + x);
+            frame->pid[x][1] = 10 + (i / 16 + x) % 3;
+            frame->pid[x][2] = 25 * benchNoise(i * 3 + x);
+            frame->pid[x][3] = 60 * benchNoise(i / 8 + x);
+            frame->gyroADCf[x] = 300 * benchNoise(i / 4 + x) + 20 * benchNoise(i * 7 + x);
+            frame->accADC[x] = 2048 * (x == Z) + 200 * benchNoise(i * 5 + x);
+        }
+        for (int x = 0; x < 4; x++) {
+            frame->rcCommand[x] = 150 * benchNoise(i / 32 + x);
+        }
+        for (int m = 0; m < MOTOR_COUNT; m++) {
+            frame->motor[m] = 1400 + 200 * benchNoise(i / 2 + m);
+        }
+    }
+    deviceHead = 0;
+    currentTimeUs = 0;
+}
+
+static void runLogIteration(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; i++) {
+        const benchFlightState_t *frame = &frames[i % FRAME_SAMPLE_COUNT];
+        for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
+            pidData[x].P = frame->pid[x][0];
+            pidData[x].I = frame->pid[x][1];
+            pidData[x].D = frame->pid[x][2];
+            pidData[x].F = frame->pid[x][3];
+            gyro.gyroADCf[x] = frame->gyroADCf[x];
+            acc.accADC[x] = frame->accADC[x];
+        }
+        for (int x = 0; x < 4; x++) {
+            rcCommand[x] = frame->rcCommand[x];
+        }
+        for (int m = 0; m < MOTOR_COUNT; m++) {
+            motor[m] = frame->motor[m];
+        }
+        currentTimeUs += PID_LOOPTIME_US + (i & 1);
+        blackboxLogIteration(currentTimeUs);
+        blackboxAdvanceIterationTimers();
+        benchClobber();
+    }
+}
+
+static void runSignedVB(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; i++) {
+        blackboxWriteSignedVB((int32_t)frames[i % FRAME_SAMPLE_COUNT].gyroADCf[i % XYZ_AXIS_COUNT]);
+        benchClobber();
+    }
+}
+
+const char benchName[] = "blackbox";
+
+const benchCase_t benchCases[] = {
+    { "blackboxLogIteration 1kHz", setupBlackbox, runLogIteration },
+    { "signed VB encode", setupBlackbox, runSignedVB },
+};
+
+const int benchCaseCount = ARRAYLEN(benchCases);
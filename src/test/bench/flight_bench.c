@@ -0,0 +1,175 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "platform.h"
+
+#include "build/debug.h"
+
+#include "common/axis.h"
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "fc/rc_controls.h"
+#include "fc/rc_modes.h"
+#include "fc/runtime_config.h"
+
+#include "flight/imu.h"
+#include "flight/ornithopter_profile.h"
+#include "flight/pid.h"
+#include "flight/servos.h"
+
+#include "pg/pg.h"
+#include "pg/pg_ids.h"
+
+#include "rx/rx.h"
+
+#include "sensors/acceleration.h"
+#include "sensors/battery.h"
+#include "sensors/gyro.h"
+
+#include "bench.h"
+
+// pidController and the wing ODE at the default 8k/4k loop, flapping at mid throttle with the default profile
+
+#define PID_LOOPTIME_US 250
+#define STICK_SAMPLE_COUNT 1024
+
+int16_t debug[DEBUG16_VALUE_COUNT];
+uint8_t debugMode;
+
+gyro_t gyro;
+attitudeEulerAngles_t attitude;
+int16_t rcData[MAX_SUPPORTED_RC_CHANNEL_COUNT];
+float motor[MAX_SUPPORTED_MOTORS];
+
+PG_REGISTER(accelerometerConfig_t, accelerometerConfig, PG_ACCELEROMETER_CONFIG, 0);
+PG_REGISTER(batteryConfig_t, batteryConfig, PG_BATTERY_CONFIG, 0);
+
+PG_REGISTER_WITH_RESET_TEMPLATE(servoConfig_t, servoConfig, PG_SERVO_CONFIG, 1);
+
+PG_RESET_TEMPLATE(servoConfig_t, servoConfig,
+    .flap_base_amplitude = 60,
+    .servo_speed_deg_s = 857,
+    .servo_speed_vmin_pct = 100,
+    .servo_max_amplitude = 55,
+    .flap_magnitude = 4,
+    .ornithopter_freq_channel = 1,
+    .ornithopter_freq_min = 1,
+    .ornithopter_freq_max = 25,
+);
+
+static float setpointRate[XYZ_AXIS_COUNT];
+static float rcDeflection[XYZ_AXIS_COUNT];
+
+float getThrottlePIDAttenuation(void) { return 1.0f; }
+float getMotorMixRange(void) { return 0.0f; }
+float getSetpointRate(int axis) { return setpointRate[axis]; }
+bool isAirmodeActivated(void) { return true; }
+float getRcDeflectionAbs(int axis) { return fabsf(rcDeflection[axis]); }
+float getRcDeflection(int axis) { return rcDeflection[axis]; }
+void systemBeep(bool onoff) { UNUSED(onoff); }
+bool gyroOverflowDetected(void) { return false; }
+float getSetpointRateDerivative(int axis) { UNUSED(axis); return 0.0f; }
+uint8_t rcSmoothingSplineAxes(void) { return 0; }
+void imuStrokeBoundary(timeUs_t currentTimeUs) { UNUSED(currentTimeUs); }
+void positionStrokeBoundary(timeUs_t currentTimeUs) { UNUSED(currentTimeUs); }
+void imuPropagateAttitude(const float *gyroRate, float dt) { UNUSED(gyroRate); UNUSED(dt); }
+void beeperConfirmationBeeps(uint8_t beepCount) { UNUSED(beepCount); }
+bool isLaunchControlActive(void) { return false; }
+bool IS_RC_MODE_ACTIVE(boxId_e boxId) { UNUSED(boxId); return false; }
+uint8_t getBatteryCellCount(void) { return 0; }
+uint16_t getBatteryVoltageLatest(void) { return 0; }
+float getServoTrackingError(int pair) { UNUSED(pair); return 0.0f; }
+float getServoTrackingDelay(int pair) { UNUSED(pair); return 0.0f; }
+
+void calculateFlappingFromThrottle(float rc_throttle);
+bool applyFerocityWaveShaping(float theta, float dMod, float iBias, float *outShaped, float *outDerivative);
+
+static const pidProfile_t *pidProfile;
+static float stickSamples[STICK_SAMPLE_COUNT][XYZ_AXIS_COUNT];
+static timeUs_t currentTimeUs;
+
+static void setupFlight(void)
+{
+    pgResetAll();
+    gyro.targetLooptime = PID_LOOPTIME_US;
+    rcData[AUX2] = 1500;    // ~13Hz flap
+    pidProfile = pidProfiles(0);
+    pidInit(pidProfile);
+    pidStabilisationState(PID_STABILISATION_ON);
+    ENABLE_ARMING_FLAG(ARMED);
+    pidUpdateThrottle(0.5f);
+
+    for (int i = 0; i < STICK_SAMPLE_COUNT; i++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            stickSamples[i][axis] = 0.3f * benchNoise(i / 32 + axis * 7);
+        }
+    }
+    currentTimeUs = 0;
+}
+
+static void runPidController(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; i++) {
+        const float *stick = stickSamples[i % STICK_SAMPLE_COUNT];
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            rcDeflection[axis] = stick[axis];
+            setpointRate[axis] = 670.0f * stick[axis];
+            gyro.gyroADCf[axis] = 600.0f * stick[axis] + 40.0f * benchNoise(i + axis);
+        }
+        currentTimeUs += PID_LOOPTIME_US;
+        pidController(pidProfile, currentTimeUs);
+        benchUse(pidData[FD_ROLL].Sum);
+    }
+}
+
+static void runCalculateFlapping(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; i++) {
+        calculateFlappingFromThrottle(1500.0f + 200.0f * stickSamples[i % STICK_SAMPLE_COUNT][FD_ROLL]);
+        benchClobber();
+    }
+}
+
+static void runFerocityWaveShaping(uint32_t iterations)
+{
+    float shaped = 0.0f;
+    float derivative = 0.0f;
+    for (uint32_t i = 0; i < iterations; i++) {
+        const float theta = (i & 0xffff) * 0.0123f;
+        applyFerocityWaveShaping(theta, 0.25f * benchNoise(i), 0.5f * benchNoise(i + 1), &shaped, &derivative);
+        benchUse(shaped);
+        benchUse(derivative);
+    }
+}
+
+const char benchName[] = "flight";
+
+const benchCase_t benchCases[] = {
+    { "pidController flapping", setupFlight, runPidController },
+    { "calculateFlappingFromThrottle", setupFlight, runCalculateFlapping },
+    { "applyFerocityWaveShaping", setupFlight, runFerocityWaveShaping },
+};
+
+const int benchCaseCount = ARRAYLEN(benchCases);
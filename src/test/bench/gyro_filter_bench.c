@@ -0,0 +1,146 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#include "build/debug.h"
+
+#include "common/axis.h"
+#include "common/filter.h"
+#include "common/time.h"
+#include "common/utils.h"
+
+#include "config/feature.h"
+
+#include "drivers/accgyro/accgyro.h"
+#include "drivers/accgyro/accgyro_fake.h"
+#include "drivers/sensor.h"
+
+#include "io/beeper.h"
+
+#include "pg/pg.h"
+
+#include "scheduler/scheduler.h"
+
+#include "sensors/acceleration.h"
+#include "sensors/gyro.h"
+#include "sensors/gyroanalyse.h"
+#include "sensors/sensors.h"
+
+#include "bench.h"
+
+// gyroUpdate() from the real gyro.c with the default configuration at 8kHz on the fake gyro: static notches off,
+// dynamic biquad lowpass, pt1 lowpass2 and the two dynamic notches. The FFT analysis needs CMSIS and is stubbed,
+// so the notch centres stay where gyroInit() put them.
+
+#define GYRO_LOOPTIME_US 125
+#define GYRO_SAMPLE_COUNT 4096
+
+extern gyroDev_t * const gyroDevPtr;
+bool fakeGyroRead(gyroDev_t *gyro);
+
+int16_t debug[DEBUG16_VALUE_COUNT];
+uint8_t debugMode;
+uint8_t detectedSensors[] = { GYRO_NONE, ACC_NONE };
+
+uint32_t micros(void) { return 0; }
+void beeper(beeperMode_e mode) { UNUSED(mode); }
+timeDelta_t getGyroUpdateRate(void) { return gyro.targetLooptime; }
+void sensorsSet(uint32_t mask) { UNUSED(mask); }
+void schedulerResetTaskStatistics(cfTaskId_e taskId) { UNUSED(taskId); }
+int getArmingDisableFlags(void) { return 0; }
+bool featureIsEnabled(const uint32_t mask) { return mask == FEATURE_DYNAMIC_FILTER; }
+void gyroDataAnalyseStateInit(gyroAnalyseState_t *gyroAnalyse, uint32_t targetLooptime) { UNUSED(gyroAnalyse); UNUSED(targetLooptime); }
+void gyroDataAnalysePush(gyroAnalyseState_t *gyroAnalyse, int axis, float sample) { UNUSED(gyroAnalyse); UNUSED(axis); UNUSED(sample); }
+void gyroDataAnalyse(gyroAnalyseState_t *gyroAnalyse, biquadFilter_t *notchFilterDyn, biquadFilter_t *notchFilterDyn2) { UNUSED(gyroAnalyse); UNUSED(notchFilterDyn); UNUSED(notchFilterDyn2); }
+
+static int16_t gyroSamples[GYRO_SAMPLE_COUNT][XYZ_AXIS_COUNT];
+static biquadFilter_t notchFilterDyn[XYZ_AXIS_COUNT];
+static timeUs_t currentTimeUs;
+
+static void setupGyro(void)
+{
+    pgResetAll();
+    gyroInit();
+    gyroDevPtr->readFn = fakeGyroRead;
+
+    currentTimeUs = 0;
+    gyroStartCalibration(false);
+    while (!isGyroCalibrationComplete()) {
+        fakeGyroSet(gyroDevPtr, 0, 0, 0);
+        currentTimeUs += GYRO_LOOPTIME_US;
+        gyroUpdate(currentTimeUs);
+    }
+
+    // flap-rate rotation plus motor noise, in raw gyro counts
+    for (int i = 0; i < GYRO_SAMPLE_COUNT; i++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            gyroSamples[i][axis] = 3000.0f * benchNoise(i / 64 + axis) + 300.0f * benchNoise(i * 3 + axis);
+        }
+    }
+
+    const float notchQ = filterGetNotchQ(350, 322);
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        biquadFilterInit(&notchFilterDyn[axis], 350, GYRO_LOOPTIME_US, notchQ, FILTER_NOTCH);
+    }
+}
+
+static void runGyroUpdate(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; i++) {
+        const int16_t *sample = gyroSamples[i % GYRO_SAMPLE_COUNT];
+        fakeGyroSet(gyroDevPtr, sample[X], sample[Y], sample[Z]);
+        currentTimeUs += GYRO_LOOPTIME_US;
+        gyroUpdate(currentTimeUs);
+        benchUse(gyro.gyroADCf[X]);
+    }
+}
+
+// dynamic lowpass cutoff follows throttle once per PID loop
+static void runDynLpfUpdate(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; i++) {
+        dynLpfGyroUpdate(0.5f + 0.5f * benchNoise(i));
+        benchClobber();
+    }
+}
+
+// dynamic notch centre moved by the gyro analysis, one axis per step
+static void runDynNotchUpdate(uint32_t iterations)
+{
+    const float notchQ = filterGetNotchQ(350, 322);
+    for (uint32_t i = 0; i < iterations; i++) {
+        biquadFilterUpdate(&notchFilterDyn[i % XYZ_AXIS_COUNT], 350.0f + 100.0f * benchNoise(i), GYRO_LOOPTIME_US, notchQ, FILTER_NOTCH);
+        benchClobber();
+    }
+}
+
+const char benchName[] = "gyro_filter";
+
+const benchCase_t benchCases[] = {
+    { "gyroUpdate default filters", setupGyro, runGyroUpdate },
+    { "dynLpfGyroUpdate", setupGyro, runDynLpfUpdate },
+    { "dyn notch update", setupGyro, runDynNotchUpdate },
+};
+
+const int benchCaseCount = ARRAYLEN(benchCases);
@@ -0,0 +1,153 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#include "common/time.h"
+#include "common/utils.h"
+
+#include "scheduler/scheduler.h"
+
+#include "bench.h"
+
+// scheduler() over the main flight tasks with the 8k gyro/PID period. Tasks are empty apart from the
+// simulated time they take, and simulated time moves on between passes, so the measurement is the
+// scheduler's own task selection and bookkeeping.
+
+#define SCHEDULER_PASS_US 5
+#define TEST_PID_LOOP_TIME 40
+#define TEST_UPDATE_ACCEL_TIME 10
+#define TEST_UPDATE_ATTITUDE_TIME 15
+#define TEST_UPDATE_RX_CHECK_TIME 1
+#define TEST_UPDATE_RX_MAIN_TIME 20
+#define TEST_HANDLE_SERIAL_TIME 30
+#define TEST_DISPATCH_TIME 1
+#define TEST_UPDATE_BATTERY_TIME 2
+
+static timeUs_t simulatedTime;
+
+uint32_t micros(void) { return simulatedTime; }
+
+static void taskMainPidLoop(timeUs_t currentTimeUs) { UNUSED(currentTimeUs); simulatedTime += TEST_PID_LOOP_TIME; }
+static void taskUpdateAccelerometer(timeUs_t currentTimeUs) { UNUSED(currentTimeUs); simulatedTime += TEST_UPDATE_ACCEL_TIME; }
+static void taskUpdateAttitude(timeUs_t currentTimeUs) { UNUSED(currentTimeUs); simulatedTime += TEST_UPDATE_ATTITUDE_TIME; }
+static bool rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTimeUs)
+{
+    UNUSED(currentDeltaTimeUs);
+    simulatedTime += TEST_UPDATE_RX_CHECK_TIME;
+    // a 250Hz link
+    return currentTimeUs % 4000 < SCHEDULER_PASS_US + TEST_PID_LOOP_TIME;
+}
+static void taskUpdateRxMain(timeUs_t currentTimeUs) { UNUSED(currentTimeUs); simulatedTime += TEST_UPDATE_RX_MAIN_TIME; }
+static void taskHandleSerial(timeUs_t currentTimeUs) { UNUSED(currentTimeUs); simulatedTime += TEST_HANDLE_SERIAL_TIME; }
+static void taskDispatch(timeUs_t currentTimeUs) { UNUSED(currentTimeUs); simulatedTime += TEST_DISPATCH_TIME; }
+static void taskUpdateBatteryVoltage(timeUs_t currentTimeUs) { UNUSED(currentTimeUs); simulatedTime += TEST_UPDATE_BATTERY_TIME; }
+
+cfTask_t cfTasks[TASK_COUNT] = {
+    [TASK_SYSTEM] = {
+        .taskName = "SYSTEM",
+        .taskFunc = taskSystemLoad,
+        .desiredPeriod = TASK_PERIOD_HZ(10),
+        .staticPriority = TASK_PRIORITY_MEDIUM_HIGH,
+    },
+    [TASK_GYROPID] = {
+        .taskName = "PID",
+        .subTaskName = "GYRO",
+        .taskFunc = taskMainPidLoop,
+        .desiredPeriod = TASK_PERIOD_HZ(8000),
+        .staticPriority = TASK_PRIORITY_REALTIME,
+    },
+    [TASK_ACCEL] = {
+        .taskName = "ACCEL",
+        .taskFunc = taskUpdateAccelerometer,
+        .desiredPeriod = TASK_PERIOD_HZ(1000),
+        .staticPriority = TASK_PRIORITY_MEDIUM,
+    },
+    [TASK_ATTITUDE] = {
+        .taskName = "ATTITUDE",
+        .taskFunc = taskUpdateAttitude,
+        .desiredPeriod = TASK_PERIOD_HZ(100),
+        .staticPriority = TASK_PRIORITY_MEDIUM,
+    },
+    [TASK_RX] = {
+        .taskName = "RX",
+        .checkFunc = rxUpdateCheck,
+        .taskFunc = taskUpdateRxMain,
+        .desiredPeriod = TASK_PERIOD_HZ(33),
+        .staticPriority = TASK_PRIORITY_HIGH,
+    },
+    [TASK_SERIAL] = {
+        .taskName = "SERIAL",
+        .taskFunc = taskHandleSerial,
+        .desiredPeriod = TASK_PERIOD_HZ(100),
+        .staticPriority = TASK_PRIORITY_LOW,
+    },
+    [TASK_DISPATCH] = {
+        .taskName = "DISPATCH",
+        .taskFunc = taskDispatch,
+        .desiredPeriod = TASK_PERIOD_HZ(1000),
+        .staticPriority = TASK_PRIORITY_HIGH,
+    },
+    [TASK_BATTERY_VOLTAGE] = {
+        .taskName = "BATTERY_VOLTAGE",
+        .taskFunc = taskUpdateBatteryVoltage,
+        .desiredPeriod = TASK_PERIOD_HZ(50),
+        .staticPriority = TASK_PRIORITY_MEDIUM,
+    },
+};
+
+static void setupScheduler(void)
+{
+    simulatedTime = 0;
+    schedulerInit();
+    setTaskEnabled(TASK_GYROPID, true);
+    setTaskEnabled(TASK_ACCEL, true);
+    setTaskEnabled(TASK_ATTITUDE, true);
+    setTaskEnabled(TASK_RX, true);
+    setTaskEnabled(TASK_SERIAL, true);
+    setTaskEnabled(TASK_DISPATCH, true);
+    setTaskEnabled(TASK_BATTERY_VOLTAGE, true);
+}
+
+static void runScheduler(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; i++) {
+        scheduler();
+        simulatedTime += SCHEDULER_PASS_US;
+    }
+}
+
+static void setupSchedulerNoStatistics(void)
+{
+    setupScheduler();
+    schedulerSetCalulateTaskStatistics(false);
+}
+
+const char benchName[] = "scheduler";
+
+const benchCase_t benchCases[] = {
+    { "scheduler pass 8 tasks", setupScheduler, runScheduler },
+    { "scheduler pass 8 tasks no statistics", setupSchedulerNoStatistics, runScheduler },
+};
+
+const int benchCaseCount = ARRAYLEN(benchCases);
@@ -0,0 +1,138 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#include "build/debug.h"
+
+#include "common/axis.h"
+#include "common/utils.h"
+
+#include "config/feature.h"
+
+#include "drivers/io.h"
+#include "drivers/timer.h"
+
+#include "fc/rc_controls.h"
+#include "fc/rc_modes.h"
+#include "fc/runtime_config.h"
+
+#include "flight/imu.h"
+#include "flight/mixer.h"
+#include "flight/pid.h"
+#include "flight/servos.h"
+
+#include "pg/pg.h"
+#include "pg/pg_ids.h"
+#include "pg/rx.h"
+
+#include "rx/rx.h"
+
+#include "bench.h"
+
+// servoMixer() with the ornithopter servo mix, flapping, fed from a synthetic wing state and PID sums
+
+#define SERVO_LOOPTIME_US 250
+#define WING_SAMPLE_COUNT 1024
+
+int16_t debug[DEBUG16_VALUE_COUNT];
+uint8_t debugMode;
+
+attitudeEulerAngles_t attitude;
+int16_t rcData[MAX_SUPPORTED_RC_CHANNEL_COUNT];
+float rcCommand[4];
+rxRuntimeConfig_t rxRuntimeConfig;
+float motor[MAX_SUPPORTED_MOTORS];
+mixerMode_e currentMixerMode;
+pidAxisData_t pidData[XYZ_AXIS_COUNT];
+uint32_t targetPidLooptime;
+
+float flappingAmplitude;
+float shapedFlappingSinusoidLeft[MAX_ORNITHOPTER_PAIRS];
+float shapedFlappingSinusoidRight[MAX_ORNITHOPTER_PAIRS];
+
+PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
+
+static uint32_t currentTimeUs;
+
+uint32_t micros(void) { return currentTimeUs; }
+bool featureIsEnabled(uint32_t mask) { UNUSED(mask); return false; }
+bool IS_RC_MODE_ACTIVE(boxId_e boxId) { UNUSED(boxId); return false; }
+bool mixerIsTricopter(void) { return false; }
+void servosTricopterInit(void) { }
+void servosTricopterMixer(void) { }
+bool servosTricopterIsEnabledServoUnarmed(void) { return false; }
+void beeperConfirmationBeeps(uint8_t beepCount) { UNUSED(beepCount); }
+void pwmWriteServo(uint8_t index, float value) { UNUSED(index); UNUSED(value); }
+float getServoSpeedScale(void) { return 1.0f; }
+ioTag_t timerioTagGetByUsage(timerUsageFlag_e usageFlag, uint8_t index) { UNUSED(usageFlag); UNUSED(index); return IO_TAG_NONE; }
+
+static float wingSamples[WING_SAMPLE_COUNT];
+
+static void setupServoMixer(void)
+{
+    pgResetAll();
+    rxConfigMutable()->midrc = 1500;
+    rxRuntimeConfig.channelCount = 8;
+    for (int i = 0; i < MAX_SUPPORTED_RC_CHANNEL_COUNT; i++) {
+        rcData[i] = 1500;
+    }
+    currentMixerMode = MIXER_SERVO_ORNITHOPTER;
+    servoMixerLoadMix(MIXER_SERVO_ORNITHOPTER - 1);
+    servosInit();
+    servoConfigureOutput();
+
+    flappingAmplitude = 40.0f;
+    for (int i = 0; i < MAX_SUPPORTED_MOTORS; i++) {
+        motor[i] = 1500.0f;
+    }
+    for (int i = 0; i < WING_SAMPLE_COUNT; i++) {
+        wingSamples[i] = benchNoise(i);
+    }
+    currentTimeUs = 0;
+}
+
+static void runServoMixer(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; i++) {
+        const float wing = wingSamples[i % WING_SAMPLE_COUNT];
+        for (int p = 0; p < MAX_ORNITHOPTER_PAIRS; p++) {
+            shapedFlappingSinusoidLeft[p] = wing;
+            shapedFlappingSinusoidRight[p] = -wing;
+        }
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            pidData[axis].Sum = 300.0f * wingSamples[(i + axis * 100) % WING_SAMPLE_COUNT];
+        }
+        currentTimeUs += SERVO_LOOPTIME_US;
+        servoMixer();
+        benchUse(servo[0]);
+    }
+}
+
+const char benchName[] = "servos";
+
+const benchCase_t benchCases[] = {
+    { "servoMixer ornithopter flapping", setupServoMixer, runServoMixer },
+};
+
+const int benchCaseCount = ARRAYLEN(benchCases);
@@ -0,0 +1,112 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "drivers/sdcard.h"
+
+    #include "io/asyncfatfs/asyncfatfs.h"
+
+    afatfsOperationStatus_e afatfs_cacheSector(uint32_t physicalSectorIndex, uint8_t **buffer, uint8_t sectorFlags, uint32_t eraseCount);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// Cache flags of afatfs_cacheSector()
+#define AFATFS_CACHE_WRITE        2
+#define AFATFS_CACHE_LOCK         4
+
+#define WRITE_LOG_SIZE 16
+
+static uint32_t writeLog[WRITE_LOG_SIZE];
+static int writeCount;
+
+static void cacheSectorForWrite(uint32_t sectorIndex, uint8_t flags)
+{
+    uint8_t *buffer;
+    EXPECT_EQ(AFATFS_OPERATION_SUCCESS, afatfs_cacheSector(sectorIndex, &buffer, AFATFS_CACHE_WRITE | flags, 0));
+}
+
+static void flushAll(void)
+{
+    writeCount = 0;
+    for (int i = 0; i < WRITE_LOG_SIZE && !afatfs_flush(); i++) {
+    }
+}
+
+TEST(AsyncFatFsTest, FlushContinuesSequentialWrite)
+{
+    // a FAT update is dirtied between the sectors of a sequential append
+    cacheSectorForWrite(1000, 0);
+    cacheSectorForWrite(1001, 0);
+    cacheSectorForWrite(40, 0);
+    cacheSectorForWrite(1002, 0);
+    cacheSectorForWrite(1003, 0);
+
+    // the append reaches the card as one run, the older FAT sector follows it
+    flushAll();
+    ASSERT_EQ(5, writeCount);
+    EXPECT_EQ(1000U, writeLog[0]);
+    EXPECT_EQ(1001U, writeLog[1]);
+    EXPECT_EQ(1002U, writeLog[2]);
+    EXPECT_EQ(1003U, writeLog[3]);
+    EXPECT_EQ(40U, writeLog[4]);
+}
+
+TEST(AsyncFatFsTest, FlushFallsBackToOldestSector)
+{
+    cacheSectorForWrite(1010, 0);
+    flushAll();
+    ASSERT_EQ(1, writeCount);
+
+    // the sector after the last one written is locked, so the oldest dirty sector goes first
+    cacheSectorForWrite(60, 0);
+    cacheSectorForWrite(1011, AFATFS_CACHE_LOCK);
+    cacheSectorForWrite(50, 0);
+
+    flushAll();
+    ASSERT_EQ(2, writeCount);
+    EXPECT_EQ(60U, writeLog[0]);
+    EXPECT_EQ(50U, writeLog[1]);
+}
+
+// STUBS
+
+extern "C" {
+sdcardOperationStatus_e sdcard_writeBlock(uint32_t blockIndex, uint8_t *, sdcard_operationCompleteCallback_c, uint32_t)
+{
+    if (writeCount < WRITE_LOG_SIZE) {
+        writeLog[writeCount] = blockIndex;
+    }
+    writeCount++;
+    return SDCARD_OPERATION_SUCCESS;
+}
+
+sdcardOperationStatus_e sdcard_beginWriteBlocks(uint32_t, uint32_t) { return SDCARD_OPERATION_SUCCESS; }
+bool sdcard_readBlock(uint32_t, uint8_t *, sdcard_operationCompleteCallback_c, uint32_t) { return false; }
+bool sdcard_poll(void) { return false; }
+bool sdcard_isInserted(void) { return true; }
+bool sdcard_isInitialized(void) { return true; }
+bool sdcard_isFunctional(void) { return true; }
+const sdcardMetadata_t* sdcard_getMetadata(void) { return NULL; }
+void sdcard_setProfilerCallback(sdcard_profilerCallback_c) { }
+uint32_t millis(void) { return 0; }
+}
@@ -21,6 +21,8 @@ extern "C" {
     #include "platform.h"
 
     #include "blackbox/blackbox.h"
+    #include "blackbox/blackbox_fielddefs.h"
+    #include "build/debug.h"
     #include "common/utils.h"
 
     #include "pg/pg.h"
@@ -34,7 +36,9 @@ extern "C" {
     #include "flight/failsafe.h"
     #include "flight/mixer.h"
     #include "flight/pid.h"
+    #include "flight/servos.h"
 
+    #include "fc/loop_overrun.h"
     #include "fc/rc_controls.h"
     #include "fc/rc_modes.h"
 
@@ -43,11 +47,18 @@ extern "C" {
 
     #include "rx/rx.h"
 
+    #include "sensors/acceleration.h"
+    #include "sensors/barometer.h"
     #include "sensors/battery.h"
+    #include "sensors/compass.h"
     #include "sensors/gyro.h"
 
     extern int16_t blackboxIInterval;
     extern int16_t blackboxPInterval;
+    extern uint8_t blackboxDecimationLevel;
+    uint8_t blackboxFieldGroupDecimationShift(FlightLogFieldGroup group);
+    bool blackboxFieldGroupIsDue(FlightLogFieldGroup group);
+    bool blackboxGovernorUpdate(uint8_t peakFillPercent);
 }
 
 #include "unittest_macros.h"
@@ -347,6 +358,94 @@ TEST(BlackboxTest, Test_CalculateRates)
 }
 
 
+TEST(BlackboxTest, Test_GovernorDecimationLevels)
+{
+    // 1kHz PIDloop, P-frame every iteration
+    targetPidLooptime = 1000;
+    blackboxConfigMutable()->p_ratio = 32;
+    blackboxInit();
+    blackboxDecimationLevel = 0;
+
+    // quiet device, nothing happens
+    EXPECT_EQ(false, blackboxGovernorUpdate(10));
+    EXPECT_EQ(0, blackboxDecimationLevel);
+
+    // debug is sacrificed first, then sensors, alternating
+    EXPECT_EQ(true, blackboxGovernorUpdate(60));
+    EXPECT_EQ(1, blackboxFieldGroupDecimationShift(FLIGHT_LOG_FIELD_GROUP_DEBUG));
+    EXPECT_EQ(0, blackboxFieldGroupDecimationShift(FLIGHT_LOG_FIELD_GROUP_SENSORS));
+    EXPECT_EQ(true, blackboxGovernorUpdate(60));
+    EXPECT_EQ(1, blackboxFieldGroupDecimationShift(FLIGHT_LOG_FIELD_GROUP_DEBUG));
+    EXPECT_EQ(1, blackboxFieldGroupDecimationShift(FLIGHT_LOG_FIELD_GROUP_SENSORS));
+    EXPECT_EQ(true, blackboxGovernorUpdate(60));
+    EXPECT_EQ(2, blackboxFieldGroupDecimationShift(FLIGHT_LOG_FIELD_GROUP_DEBUG));
+    EXPECT_EQ(1, blackboxFieldGroupDecimationShift(FLIGHT_LOG_FIELD_GROUP_SENSORS));
+
+    // saturates at 1/8 rate for both groups
+    for (int ii = 0; ii < 10; ++ii) {
+        blackboxGovernorUpdate(100);
+    }
+    EXPECT_EQ(3, blackboxFieldGroupDecimationShift(FLIGHT_LOG_FIELD_GROUP_DEBUG));
+    EXPECT_EQ(3, blackboxFieldGroupDecimationShift(FLIGHT_LOG_FIELD_GROUP_SENSORS));
+    EXPECT_EQ(false, blackboxGovernorUpdate(100));
+
+    // between the watermarks, hold the current level
+    EXPECT_EQ(false, blackboxGovernorUpdate(35));
+    EXPECT_EQ(6, blackboxDecimationLevel);
+
+    // recovery needs several quiet intervals in a row
+    for (int ii = 0; ii < 7; ++ii) {
+        EXPECT_EQ(false, blackboxGovernorUpdate(5));
+    }
+    EXPECT_EQ(true, blackboxGovernorUpdate(5));
+    EXPECT_EQ(5, blackboxDecimationLevel);
+
+    // a burst of pressure resets the quiet count
+    for (int ii = 0; ii < 7; ++ii) {
+        blackboxGovernorUpdate(5);
+    }
+    blackboxGovernorUpdate(35);
+    EXPECT_EQ(false, blackboxGovernorUpdate(5));
+    EXPECT_EQ(5, blackboxDecimationLevel);
+}
+
+TEST(BlackboxTest, Test_GovernorFieldGroupIsDue)
+{
+    // 1kHz PIDloop, P-frame every iteration
+    targetPidLooptime = 1000;
+    blackboxConfigMutable()->p_ratio = 32;
+    blackboxInit();
+
+    // no decimation, every group is due in every P-frame
+    blackboxDecimationLevel = 0;
+    for (int ii = 0; ii < 32; ++ii) {
+        EXPECT_EQ(true, blackboxFieldGroupIsDue(FLIGHT_LOG_FIELD_GROUP_DEBUG));
+        EXPECT_EQ(true, blackboxFieldGroupIsDue(FLIGHT_LOG_FIELD_GROUP_SENSORS));
+        blackboxAdvanceIterationTimers();
+    }
+
+    // debug every 4th P-frame, sensors every 2nd
+    blackboxDecimationLevel = 3;
+    for (int ii = 0; ii < 32; ++ii) {
+        EXPECT_EQ(ii % 4 == 0, blackboxFieldGroupIsDue(FLIGHT_LOG_FIELD_GROUP_DEBUG));
+        EXPECT_EQ(ii % 2 == 0, blackboxFieldGroupIsDue(FLIGHT_LOG_FIELD_GROUP_SENSORS));
+        blackboxAdvanceIterationTimers();
+    }
+
+    // 1kHz PIDloop, P-frame every 2nd iteration: decimation counts P-frames, not loop iterations
+    blackboxConfigMutable()->p_ratio = 16;
+    blackboxInit();
+    blackboxDecimationLevel = 1;
+    for (int ii = 0; ii < 32; ++ii) {
+        if (blackboxShouldLogPFrame()) {
+            EXPECT_EQ(ii % 4 == 0, blackboxFieldGroupIsDue(FLIGHT_LOG_FIELD_GROUP_DEBUG));
+            EXPECT_EQ(true, blackboxFieldGroupIsDue(FLIGHT_LOG_FIELD_GROUP_SENSORS));
+        }
+        blackboxAdvanceIterationTimers();
+    }
+    blackboxDecimationLevel = 0;
+}
+
 // STUBS
 extern "C" {
 
@@ -367,8 +466,16 @@ gpsSolutionData_t gpsSol;
 int32_t GPS_home[2];
 
 gyro_t gyro;
+acc_t acc;
+mag_t mag;
+baro_t baro;
+pidAxisData_t pidData[3];
+float rcCommand[4];
+int16_t debug[DEBUG16_VALUE_COUNT];
+int16_t servo[MAX_SUPPORTED_SERVOS];
 
 float motorOutputHigh, motorOutputLow;
+float motor[MAX_SUPPORTED_MOTORS];
 float motor_disarmed[MAX_SUPPORTED_MOTORS];
 struct pidProfile_s;
 struct pidProfile_s *currentPidProfile;
@@ -379,6 +486,10 @@ boxBitmask_t rcModeActivationMask;
 void mspSerialAllocatePorts(void) {}
 uint32_t getArmingBeepTimeMicros(void) {return 0;}
 uint16_t getBatteryVoltageLatest(void) {return 0;}
+int32_t getAmperageLatest(void) {return 0;}
+uint16_t getRssi(void) {return 0;}
+float pidGetPreviousSetpoint(int) {return 0;}
+float mixerGetLoggingThrottle(void) {return 0;}
 uint8_t getMotorCount(void) {return 4;}
 bool areMotorsRunning(void) { return false; }
 bool IS_RC_MODE_ACTIVE(boxId_e) {return false;}
@@ -399,5 +510,7 @@ failsafePhase_e failsafePhase(void) {return FAILSAFE_IDLE;}
 bool rxAreFlightChannelsValid(void) {return false;}
 bool rxIsReceivingSignal(void) {return false;}
 bool isRssiConfigured(void) {return false;}
+uint32_t loopOverrunCount(void) {return 0;}
+const loopOverrun_t *loopOverrunGet(uint32_t) {return NULL;}
 
 }
@@ -55,11 +55,15 @@ extern "C" {
 
     void cliSet(char *cmdline);
     void cliGet(char *cmdline);
+    const clivalue_t *cliFindValueByName(const char *name, uint8_t length);
 
     const clivalue_t valueTable[] = {
-        { "array_unit_test",             VAR_INT8  | MODE_ARRAY | MASTER_VALUE, .config.array.length = 3, PG_RESERVED_FOR_TESTING_1, 0 }
+        { "array_unit_test",             VAR_INT8  | MODE_ARRAY | MASTER_VALUE, .config.array.length = 3, PG_RESERVED_FOR_TESTING_1, 0 },
+        { "zzz_unit_test",               VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 10 }, PG_RESERVED_FOR_TESTING_1, 0 },
+        { "abc_unit_test",               VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 10 }, PG_RESERVED_FOR_TESTING_1, 0 },
     };
     const uint16_t valueTableEntryCount = ARRAYLEN(valueTable);
+    uint16_t valueTableNameIndex[ARRAYLEN(valueTable)];
     const lookupTableEntry_t lookupTables[] = {};
 
 
@@ -116,6 +120,22 @@ TEST(CLIUnittest, TestCliSet)
     //EXPECT_EQ(false, false);
 }
 
+TEST(CLIUnittest, TestCliFindValueByName)
+{
+    // valueTable[] isn't sorted, lookups go through the name index
+    EXPECT_EQ(&valueTable[0], cliFindValueByName("array_unit_test", 15));
+    EXPECT_EQ(&valueTable[1], cliFindValueByName("zzz_unit_test", 13));
+    EXPECT_EQ(&valueTable[2], cliFindValueByName("abc_unit_test", 13));
+
+    // case insensitive, only the given length is compared
+    EXPECT_EQ(&valueTable[0], cliFindValueByName("ARRAY_UNIT_TEST = 1,2,3", 15));
+
+    // prefixes and longer names must not match
+    EXPECT_TRUE(cliFindValueByName("array_unit", 10) == NULL);
+    EXPECT_TRUE(cliFindValueByName("array_unit_test_2", 17) == NULL);
+    EXPECT_TRUE(cliFindValueByName("mmm_unit_test", 13) == NULL);
+}
+
 // STUBS
 extern "C" {
 
@@ -114,3 +114,116 @@ TEST(FilterUnittest, TestSlewFilter)
     slewFilterApply(&filter, 200.0f);
     EXPECT_EQ(200, filter.state);
 }
+
+TEST(FilterUnittest, TestHermiteSplineInit)
+{
+    hermiteSpline_t spline;
+
+    hermiteSplineInit(&spline, 100.0f);
+    EXPECT_EQ(100, spline.value);
+    EXPECT_EQ(0, spline.derivative);
+
+    // holds the sample until the first update
+    hermiteSplineEvaluate(&spline, 0.005f);
+    EXPECT_EQ(100, spline.value);
+    EXPECT_EQ(0, spline.derivative);
+}
+
+TEST(FilterUnittest, TestHermiteSplineRamp)
+{
+    const float interval = 0.01f;   // 100Hz samples
+    const float rate = 1000.0f;     // units per second
+    const float loopTime = 0.00025f; // 4kHz evaluation
+    hermiteSpline_t spline;
+    hermiteSplineInit(&spline, 0.0f);
+
+    float lastValue = 0.0f;
+    float lastDerivative = 0.0f;
+    for (int frame = 1; frame <= 10; frame++) {
+        hermiteSplineUpdate(&spline, rate * interval * frame, interval);
+
+        // no jump in value or slope at the start of the segment
+        hermiteSplineEvaluate(&spline, 0.0f);
+        EXPECT_NEAR(lastValue, spline.value, 1e-3f);
+        EXPECT_NEAR(lastDerivative, spline.derivative, 1e-1f);
+
+        for (float t = 0.0f; t < interval - loopTime / 2; t += loopTime) {
+            hermiteSplineEvaluate(&spline, t);
+        }
+        hermiteSplineEvaluate(&spline, interval);
+        lastValue = spline.value;
+        lastDerivative = spline.derivative;
+
+        // each segment lands on its sample moving at the sampled rate
+        EXPECT_NEAR(rate * interval * frame, spline.value, 1e-2f);
+        EXPECT_NEAR(rate, spline.derivative, 1.0f);
+    }
+
+    // once settled on the ramp the segment is a straight line
+    hermiteSplineUpdate(&spline, rate * interval * 11, interval);
+    hermiteSplineEvaluate(&spline, interval / 2);
+    EXPECT_NEAR(rate * interval * 10.5f, spline.value, 1e-2f);
+    EXPECT_NEAR(rate, spline.derivative, 1.0f);
+}
+
+TEST(FilterUnittest, TestHermiteSplineLateSample)
+{
+    hermiteSpline_t spline;
+    hermiteSplineInit(&spline, 0.0f);
+    hermiteSplineUpdate(&spline, 10.0f, 0.01f);
+    hermiteSplineUpdate(&spline, 20.0f, 0.01f);
+    hermiteSplineEvaluate(&spline, 0.01f);
+    EXPECT_FLOAT_EQ(20.0f, spline.value);
+
+    // a late sample continues along the end slope for one more interval, then holds
+    hermiteSplineEvaluate(&spline, 0.015f);
+    EXPECT_FLOAT_EQ(25.0f, spline.value);
+    EXPECT_FLOAT_EQ(1000.0f, spline.derivative);
+    hermiteSplineEvaluate(&spline, 0.05f);
+    EXPECT_FLOAT_EQ(30.0f, spline.value);
+    EXPECT_EQ(0, spline.derivative);
+}
+
+TEST(FilterUnittest, TestTrajectoryLimiterStep)
+{
+    const float maxVelocity = 8570.0f;        // 857°/s at 10us/°
+    const float maxAcceleration = 857000.0f;  // full speed in 10ms
+    const float dT = 0.00025f;
+    trajectoryLimiter_t limiter;
+    trajectoryLimiterInit(&limiter, 0.0f);
+
+    float lastVelocity = 0.0f;
+    int settledLoop = -1;
+    for (int loop = 0; loop < 400; loop++) {
+        const float position = trajectoryLimiterApply(&limiter, 500.0f, maxVelocity, maxAcceleration, dT);
+
+        // within both bounds on the way, and no overshoot at the end
+        EXPECT_LE(fabsf(limiter.velocity), maxVelocity + 1e-3f);
+        EXPECT_LE(fabsf(limiter.velocity - lastVelocity), maxAcceleration * dT + 1e-2f);
+        EXPECT_LE(position, 500.0f + 1e-3f);
+        lastVelocity = limiter.velocity;
+        if (settledLoop < 0 && fabsf(position - 500.0f) < 0.5f) {
+            settledLoop = loop;
+        }
+    }
+
+    // time optimal: 10ms to full speed, braking mirrors it, 500us of travel at 8570us/s takes 68ms in all
+    EXPECT_NEAR(0.068f, settledLoop * dT, 0.003f);
+    EXPECT_NEAR(500.0f, limiter.position, 1e-3f);
+    EXPECT_NEAR(0.0f, limiter.velocity, 1e-3f);
+}
+
+TEST(FilterUnittest, TestTrajectoryLimiterFollowsFeasibleTarget)
+{
+    const float dT = 0.00025f;
+    trajectoryLimiter_t limiter;
+    trajectoryLimiterInit(&limiter, 0.0f);
+
+    // a 2Hz, 200us sine needs 2500us/s and 31000us/s² at most, well inside the bounds. Braking
+    // towards where the target is rather than where it is going costs a few us of lag.
+    for (int loop = 0; loop < 4000; loop++) {
+        const float target = 200.0f * sinf(2.0f * M_PI * 2.0f * loop * dT);
+        const float position = trajectoryLimiterApply(&limiter, target, 8570.0f, 857000.0f, dT);
+        EXPECT_NEAR(target, position, 5.0f);
+    }
+}
@@ -0,0 +1,357 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/crc.h"
+    #include "common/utils.h"
+
+    #include "config/config_eeprom.h"
+
+    #include "drivers/system.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    typedef struct testConfigA_s {
+        uint32_t value;
+        uint32_t other;
+    } testConfigA_t;
+
+    typedef struct testConfigB_s {
+        uint8_t data[16];
+    } testConfigB_t;
+
+    typedef struct testConfigC_s {
+        uint8_t data[64];
+    } testConfigC_t;
+
+    PG_DECLARE(testConfigA_t, testConfigA);
+    PG_DECLARE(testConfigB_t, testConfigB);
+    PG_DECLARE(testConfigC_t, testConfigC);
+
+    PG_REGISTER_WITH_RESET_TEMPLATE(testConfigA_t, testConfigA, PG_RESERVED_FOR_TESTING_1, 0);
+    PG_RESET_TEMPLATE(testConfigA_t, testConfigA,
+        .value = 100,
+        .other = 200,
+    );
+    PG_REGISTER(testConfigB_t, testConfigB, PG_RESERVED_FOR_TESTING_2, 0);
+    PG_REGISTER(testConfigC_t, testConfigC, PG_RESERVED_FOR_TESTING_3, 0);
+
+    // page aligned like __config_start, the streamer erases on page boundaries
+    uint8_t eepromData[EEPROM_SIZE] __attribute__((aligned(0x400)));
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define RECORD_HEADER_SIZE  6   // U16 size, U16 pgn, U8 version, U8 flags
+#define LOG_ENTRY_HEADER_SIZE 4 // U16 sequence, U16 base CRC
+#define CRC_START_VALUE     0xFFFF
+#define FLASH_PAGE_SIZE     0x400 // as config_streamer.c uses for the unit test build
+
+// header, one record per PG, footer and CRC, the log starts on the next word
+#define BASE_COPY_SIZE (2 + 3 * RECORD_HEADER_SIZE + sizeof(testConfigA_t) + sizeof(testConfigB_t) + sizeof(testConfigC_t) + 2 + 2)
+#define LOG_START ((BASE_COPY_SIZE + 3) & ~3)
+
+static int wordsBeforePowerCut;
+static bool failureModeCalled;
+
+static int logEntrySize(int dataSize)
+{
+    return (LOG_ENTRY_HEADER_SIZE + RECORD_HEADER_SIZE + dataSize + 2 + 3) & ~3;
+}
+
+static uint16_t storedBaseCrc(void)
+{
+    return eepromData[BASE_COPY_SIZE - 2] | eepromData[BASE_COPY_SIZE - 1] << 8;
+}
+
+// Write a log entry straight into the flash image, the way appendSettingsToEEPROM() lays it out
+static int writeRawLogEntry(int offset, uint16_t sequence, uint16_t baseCrc, pgn_t pgn, const void *data, uint16_t size)
+{
+    uint8_t *p = &eepromData[offset];
+    const uint16_t recordSize = RECORD_HEADER_SIZE + size;
+    const uint8_t header[LOG_ENTRY_HEADER_SIZE + RECORD_HEADER_SIZE] = {
+        (uint8_t)sequence, (uint8_t)(sequence >> 8), (uint8_t)baseCrc, (uint8_t)(baseCrc >> 8),
+        (uint8_t)recordSize, (uint8_t)(recordSize >> 8), (uint8_t)pgn, (uint8_t)(pgn >> 8), 0, 0,
+    };
+    memcpy(p, header, sizeof(header));
+    memcpy(p + sizeof(header), data, size);
+
+    const uint16_t crc = crc16_ccitt_update(CRC_START_VALUE, p, sizeof(header) + size);
+    p[sizeof(header) + size] = ~(crc >> 8);
+    p[sizeof(header) + size + 1] = ~(crc & 0xFF);
+
+    return offset + logEntrySize(size);
+}
+
+static void eraseFlash(void)
+{
+    memset(eepromData, 0xFF, sizeof(eepromData));
+    wordsBeforePowerCut = -1;
+    failureModeCalled = false;
+}
+
+// Load the settings back as after a reboot, with RAM scribbled over first
+static bool reloadSettings(void)
+{
+    memset(testConfigAMutable(), 0x55, sizeof(testConfigA_t));
+    memset(testConfigBMutable(), 0x55, sizeof(testConfigB_t));
+    memset(testConfigCMutable(), 0x55, sizeof(testConfigC_t));
+
+    return isEEPROMVersionValid() && isEEPROMStructureValid() && loadEEPROM();
+}
+
+static void saveDefaults(void)
+{
+    pgResetAll();
+    writeConfigToEEPROM();
+    ASSERT_FALSE(failureModeCalled);
+    ASSERT_EQ(LOG_START, getEEPROMConfigSize());
+}
+
+TEST(ConfigEepromTest, FullWriteRoundTrip)
+{
+    eraseFlash();
+    EXPECT_FALSE(isEEPROMStructureValid());
+
+    pgResetAll();
+    testConfigBMutable()->data[3] = 33;
+    writeConfigToEEPROM();
+    EXPECT_FALSE(failureModeCalled);
+    EXPECT_EQ(LOG_START, getEEPROMConfigSize());
+
+    EXPECT_TRUE(reloadSettings());
+    EXPECT_EQ(100, testConfigA()->value);
+    EXPECT_EQ(200, testConfigA()->other);
+    EXPECT_EQ(33, testConfigB()->data[3]);
+    EXPECT_EQ(0, testConfigC()->data[0]);
+}
+
+TEST(ConfigEepromTest, ChangedGroupIsAppended)
+{
+    eraseFlash();
+    saveDefaults();
+    uint8_t baseCopy[LOG_START];
+    memcpy(baseCopy, eepromData, sizeof(baseCopy));
+
+    testConfigAMutable()->value = 101;
+    writeConfigToEEPROM();
+    EXPECT_FALSE(failureModeCalled);
+
+    // the full copy is left alone, only the changed group is added
+    EXPECT_EQ(0, memcmp(baseCopy, eepromData, sizeof(baseCopy)));
+    EXPECT_EQ(LOG_START + logEntrySize(sizeof(testConfigA_t)), getEEPROMConfigSize());
+
+    // the newest entry wins
+    testConfigAMutable()->value = 102;
+    writeConfigToEEPROM();
+    EXPECT_EQ(LOG_START + 2 * logEntrySize(sizeof(testConfigA_t)), getEEPROMConfigSize());
+
+    EXPECT_TRUE(reloadSettings());
+    EXPECT_EQ(102, testConfigA()->value);
+    EXPECT_EQ(200, testConfigA()->other);
+    EXPECT_EQ(0, testConfigB()->data[0]);
+
+    // saving without changes writes nothing
+    writeConfigToEEPROM();
+    EXPECT_EQ(LOG_START + 2 * logEntrySize(sizeof(testConfigA_t)), getEEPROMConfigSize());
+}
+
+TEST(ConfigEepromTest, TornLastEntryKeepsPreviousValue)
+{
+    eraseFlash();
+    saveDefaults();
+    testConfigAMutable()->value = 101;
+    writeConfigToEEPROM();
+
+    // power goes two words into the next entry
+    testConfigAMutable()->value = 102;
+    wordsBeforePowerCut = 2;
+    writeConfigToEEPROM();
+    wordsBeforePowerCut = -1;
+
+    EXPECT_TRUE(reloadSettings());
+    EXPECT_EQ(101, testConfigA()->value);
+    EXPECT_EQ(LOG_START + logEntrySize(sizeof(testConfigA_t)), getEEPROMConfigSize());
+
+    // the torn entry isn't blank, so the next save can't append over it and writes a fresh copy
+    testConfigAMutable()->value = 103;
+    writeConfigToEEPROM();
+    EXPECT_FALSE(failureModeCalled);
+    EXPECT_EQ(LOG_START, getEEPROMConfigSize());
+
+    EXPECT_TRUE(reloadSettings());
+    EXPECT_EQ(103, testConfigA()->value);
+}
+
+TEST(ConfigEepromTest, WrappedSequenceEndsLog)
+{
+    eraseFlash();
+    saveDefaults();
+    testConfigAMutable()->value = 101;
+    writeConfigToEEPROM();
+    int offset = getEEPROMConfigSize();
+
+    // an entry whose sequence number starts over is not part of this log
+    testConfigA_t newer = { 102, 200 };
+    offset = writeRawLogEntry(offset, 0, storedBaseCrc(), PG_RESERVED_FOR_TESTING_1, &newer, sizeof(newer));
+    EXPECT_TRUE(reloadSettings());
+    EXPECT_EQ(101, testConfigA()->value);
+    EXPECT_EQ(LOG_START + logEntrySize(sizeof(testConfigA_t)), getEEPROMConfigSize());
+
+    // whereas the next number in line is
+    eraseFlash();
+    saveDefaults();
+    testConfigAMutable()->value = 101;
+    writeConfigToEEPROM();
+    writeRawLogEntry(getEEPROMConfigSize(), 1, storedBaseCrc(), PG_RESERVED_FOR_TESTING_1, &newer, sizeof(newer));
+    EXPECT_TRUE(reloadSettings());
+    EXPECT_EQ(102, testConfigA()->value);
+}
+
+TEST(ConfigEepromTest, EntryForOtherBaseCopyIsIgnored)
+{
+    eraseFlash();
+    saveDefaults();
+
+    // left over from a copy with a different CRC, the record in the full copy is used
+    testConfigA_t stale = { 999, 999 };
+    writeRawLogEntry(LOG_START, 0, storedBaseCrc() ^ 1, PG_RESERVED_FOR_TESTING_1, &stale, sizeof(stale));
+
+    EXPECT_TRUE(reloadSettings());
+    EXPECT_EQ(100, testConfigA()->value);
+    EXPECT_EQ(LOG_START, getEEPROMConfigSize());
+
+    // and the stale entry is in the way of appending, so the next save compacts
+    testConfigAMutable()->value = 101;
+    writeConfigToEEPROM();
+    EXPECT_FALSE(failureModeCalled);
+    EXPECT_EQ(LOG_START, getEEPROMConfigSize());
+    EXPECT_TRUE(reloadSettings());
+    EXPECT_EQ(101, testConfigA()->value);
+}
+
+TEST(ConfigEepromTest, BaseCrcMismatchFallsBackToDefaults)
+{
+    eraseFlash();
+    pgResetAll();
+    testConfigAMutable()->value = 101;
+    writeConfigToEEPROM();
+    testConfigBMutable()->data[0] = 7;
+    writeConfigToEEPROM();
+
+    // a flipped bit in the full copy invalidates the whole store, appended entries included
+    eepromData[LOG_START / 2] ^= 0x04;
+    EXPECT_FALSE(isEEPROMStructureValid());
+
+    // the settings are reset to defaults and written out as a fresh copy
+    pgResetAll();
+    writeConfigToEEPROM();
+    EXPECT_FALSE(failureModeCalled);
+    EXPECT_EQ(LOG_START, getEEPROMConfigSize());
+
+    EXPECT_TRUE(reloadSettings());
+    EXPECT_EQ(100, testConfigA()->value);
+    EXPECT_EQ(0, testConfigB()->data[0]);
+}
+
+TEST(ConfigEepromTest, FullLogIsCompacted)
+{
+    eraseFlash();
+    saveDefaults();
+
+    const int entrySize = logEntrySize(sizeof(testConfigC_t));
+    const int entriesThatFit = (EEPROM_SIZE - LOG_START) / entrySize;
+
+    for (int save = 1; save <= entriesThatFit; save++) {
+        testConfigCMutable()->data[0] = save;
+        writeConfigToEEPROM();
+        ASSERT_EQ(LOG_START + save * entrySize, getEEPROMConfigSize());
+    }
+
+    // no room for another entry, the next save writes a fresh copy and the log starts over
+    testConfigCMutable()->data[0] = 0xC0;
+    writeConfigToEEPROM();
+    EXPECT_FALSE(failureModeCalled);
+    EXPECT_EQ(LOG_START, getEEPROMConfigSize());
+    EXPECT_TRUE(reloadSettings());
+    EXPECT_EQ(0xC0, testConfigC()->data[0]);
+
+    testConfigCMutable()->data[0] = 0xC1;
+    writeConfigToEEPROM();
+    EXPECT_EQ(LOG_START + entrySize, getEEPROMConfigSize());
+    EXPECT_TRUE(reloadSettings());
+    EXPECT_EQ(0xC1, testConfigC()->data[0]);
+    EXPECT_EQ(100, testConfigA()->value);
+}
+
+TEST(ConfigEepromTest, AllGroupsChangedIsFullWrite)
+{
+    eraseFlash();
+    saveDefaults();
+
+    testConfigAMutable()->value = 101;
+    testConfigBMutable()->data[0] = 1;
+    testConfigCMutable()->data[0] = 2;
+    writeConfigToEEPROM();
+    EXPECT_EQ(LOG_START, getEEPROMConfigSize());
+
+    EXPECT_TRUE(reloadSettings());
+    EXPECT_EQ(101, testConfigA()->value);
+    EXPECT_EQ(1, testConfigB()->data[0]);
+    EXPECT_EQ(2, testConfigC()->data[0]);
+}
+
+// STUBS
+
+extern "C" {
+    void FLASH_Unlock(void) {}
+    void FLASH_Lock(void) {}
+
+    // once the power is gone nothing more reaches the flash
+    FLASH_Status FLASH_ErasePage(uintptr_t Page_Address)
+    {
+        if (wordsBeforePowerCut != 0) {
+            memset((void *)Page_Address, 0xFF, FLASH_PAGE_SIZE);
+        }
+        return FLASH_COMPLETE;
+    }
+
+    // programming can only clear bits
+    FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t Data)
+    {
+        if (wordsBeforePowerCut != 0) {
+            *(uint32_t *)addr &= Data;
+            if (wordsBeforePowerCut > 0) {
+                wordsBeforePowerCut--;
+            }
+        }
+        return FLASH_COMPLETE;
+    }
+
+    void failureMode(failureMode_e mode)
+    {
+        UNUSED(mode);
+        failureModeCalled = true;
+    }
+}
@@ -0,0 +1,145 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/crc.h"
+    #include "common/streambuf.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// bit-serial versions, as the firmware computed them before the table driven implementation
+static uint16_t referenceCrc16Ccitt(uint16_t crc, const uint8_t *data, uint32_t length)
+{
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (int ii = 0; ii < 8; ++ii) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+static uint8_t referenceCrc8DvbS2(uint8_t crc, const uint8_t *data, uint32_t length)
+{
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int ii = 0; ii < 8; ++ii) {
+            crc = (crc & 0x80) ? (crc << 1) ^ 0xD5 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+static void fillRandom(uint8_t *data, int length)
+{
+    srand(1234);
+    for (int i = 0; i < length; i++) {
+        data[i] = rand() & 0xff;
+    }
+}
+
+TEST(CrcTest, CheckValues)
+{
+    const uint8_t check[] = "123456789";
+
+    EXPECT_EQ(0x31C3, crc16_ccitt_update(0, check, 9));  // CRC-16/XMODEM
+    EXPECT_EQ(0xBC, crc8_dvb_s2_update(0, check, 9));    // CRC-8/DVB-S2
+
+    uint16_t crc16 = 0;
+    uint8_t crc8 = 0;
+    for (int i = 0; i < 9; i++) {
+        crc16 = crc16_ccitt(crc16, check[i]);
+        crc8 = crc8_dvb_s2(crc8, check[i]);
+    }
+    EXPECT_EQ(0x31C3, crc16);
+    EXPECT_EQ(0xBC, crc8);
+}
+
+TEST(CrcTest, BlockMatchesBitSerial)
+{
+    uint8_t data[80];
+    fillRandom(data, sizeof(data));
+
+    // every length and alignment around the four byte slices, with and without a running CRC
+    for (int offset = 0; offset < 4; offset++) {
+        for (int length = 0; length <= 72; length++) {
+            for (int seed = 0; seed < 0x100; seed += 0x55) {
+                EXPECT_EQ(referenceCrc16Ccitt(seed * 0x0101, data + offset, length), crc16_ccitt_update(seed * 0x0101, data + offset, length));
+                EXPECT_EQ(referenceCrc8DvbS2(seed, data + offset, length), crc8_dvb_s2_update(seed, data + offset, length));
+            }
+        }
+    }
+}
+
+TEST(CrcTest, SbufAppend)
+{
+    uint8_t buffer[32];
+    sbuf_t sbuf;
+    sbuf_t *dst = &sbuf;
+
+    fillRandom(buffer, 20);
+    dst->ptr = buffer + 20;
+    dst->end = buffer + sizeof(buffer);
+    crc8_dvb_s2_sbuf_append(dst, buffer + 2);
+    EXPECT_EQ(buffer + 21, sbufPtr(dst));
+    EXPECT_EQ(referenceCrc8DvbS2(0, buffer + 2, 18), buffer[20]);
+
+    dst->ptr = buffer + 20;
+    crc16_ccitt_sbuf_append(dst, buffer + 3);
+    EXPECT_EQ(buffer + 22, sbufPtr(dst));
+    const uint16_t crc = buffer[20] | buffer[21] << 8;
+    EXPECT_EQ(referenceCrc16Ccitt(0, buffer + 3, 17), crc);
+}
+
+// Throughput on a block the size of an MSP dataflash read, reported rather than asserted
+TEST(CrcTest, Throughput)
+{
+    static uint8_t block[4096];
+    const int iterations = 500;
+    fillRandom(block, sizeof(block));
+
+    uint32_t expected = 0;
+    uint32_t actual = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        expected += referenceCrc16Ccitt(i, block, sizeof(block));
+        expected += referenceCrc8DvbS2(i, block, sizeof(block));
+    }
+    auto middle = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        actual += crc16_ccitt_update(i, block, sizeof(block));
+        actual += crc8_dvb_s2_update(i, block, sizeof(block));
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(expected, actual);
+
+    const double megabytes = 2.0 * iterations * sizeof(block) / 1e6;
+    const double bitSerialSeconds = std::chrono::duration<double>(middle - start).count();
+    const double tableSeconds = std::chrono::duration<double>(end - middle).count();
+    printf("crc throughput: bit-serial %.1f MB/s, table %.1f MB/s\n", megabytes / bitSerialSeconds, megabytes / tableSeconds);
+}
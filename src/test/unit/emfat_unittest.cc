@@ -0,0 +1,130 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "msc/emfat.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define SECTOR_SIZE 512
+#define CLUSTER_SIZE 4096
+#define READ_LOG_SIZE 8
+
+typedef struct readCall_s {
+    emfat_entry_t *entry;
+    int size;
+    uint32_t offset;
+} readCall_t;
+
+static readCall_t readLog[READ_LOG_SIZE];
+static int readCount;
+
+// Fills the buffer with the low byte of each file offset, plus the entry's user data
+static void testReadProc(uint8_t *dest, int size, uint32_t offset, emfat_entry_t *entry)
+{
+    if (readCount < READ_LOG_SIZE) {
+        readLog[readCount].entry = entry;
+        readLog[readCount].size = size;
+        readLog[readCount].offset = offset;
+    }
+    readCount++;
+    for (int i = 0; i < size; i++) {
+        dest[i] = (offset + i + entry->user_data) & 0xFF;
+    }
+}
+
+#define CMA { 0, 0, 0 }
+
+// The root directory takes cluster 2, file A clusters 3 to 5 and file B clusters 6 and 7
+static emfat_entry_t entries[] = {
+    { "",      true,  0, 0, 0, 0,                0,                0,   CMA, NULL,         NULL, { 0 } },
+    { "A.BIN", false, 0, 1, 0, 3 * CLUSTER_SIZE, 3 * CLUSTER_SIZE, 0,   CMA, testReadProc, NULL, { 0 } },
+    { "B.BIN", false, 0, 1, 0, 2 * CLUSTER_SIZE, 2 * CLUSTER_SIZE, 100, CMA, testReadProc, NULL, { 0 } },
+    { NULL,    false, 0, 0, 0, 0,                0,                0,   CMA, NULL,         NULL, { 0 } }
+};
+
+static emfat_t emfat;
+static uint8_t data[16 * SECTOR_SIZE];
+
+// Disk sector of a data sector counted from the start of the root directory
+static uint32_t dataSector(uint32_t relativeSector)
+{
+    return emfat.priv.root_lba + relativeSector;
+}
+
+static void readSectors(uint32_t sector, int count)
+{
+    readCount = 0;
+    memset(data, 0, sizeof(data));
+    emfat_read(&emfat, data, sector, count);
+}
+
+TEST(EmfatTest, MultiSectorReadInOneFileIsOneCallback)
+{
+    ASSERT_TRUE(emfat_init(&emfat, "TEST", entries));
+
+    // sectors 2 to 21 of file A
+    readSectors(dataSector(8 + 2), 20);
+    ASSERT_EQ(1, readCount);
+    EXPECT_EQ(&entries[1], readLog[0].entry);
+    EXPECT_EQ(20 * SECTOR_SIZE, readLog[0].size);
+    EXPECT_EQ(2U * SECTOR_SIZE, readLog[0].offset);
+    EXPECT_EQ(0, data[0]);
+    EXPECT_EQ(1, data[1]);
+    EXPECT_EQ((20 * SECTOR_SIZE - 1) & 0xFF, data[20 * SECTOR_SIZE - 1]);
+}
+
+TEST(EmfatTest, MultiSectorReadIsSplitAtFileBoundary)
+{
+    ASSERT_TRUE(emfat_init(&emfat, "TEST", entries));
+
+    // the last four sectors of file A and the first four of file B
+    readSectors(dataSector(8 + 20), 8);
+    ASSERT_EQ(2, readCount);
+    EXPECT_EQ(&entries[1], readLog[0].entry);
+    EXPECT_EQ(4 * SECTOR_SIZE, readLog[0].size);
+    EXPECT_EQ(20U * SECTOR_SIZE, readLog[0].offset);
+    EXPECT_EQ(&entries[2], readLog[1].entry);
+    EXPECT_EQ(4 * SECTOR_SIZE, readLog[1].size);
+    EXPECT_EQ(0U, readLog[1].offset);
+
+    // each file's data lands in its own part of the buffer
+    EXPECT_EQ((20 * SECTOR_SIZE) & 0xFF, data[0]);
+    EXPECT_EQ(100, data[4 * SECTOR_SIZE]);
+    EXPECT_EQ(101, data[4 * SECTOR_SIZE + 1]);
+}
+
+TEST(EmfatTest, DirectorySectorsAreReadOneByOne)
+{
+    ASSERT_TRUE(emfat_init(&emfat, "TEST", entries));
+
+    // the last directory sector, then the first two sectors of file A in one callback
+    readSectors(dataSector(7), 3);
+    ASSERT_EQ(1, readCount);
+    EXPECT_EQ(&entries[1], readLog[0].entry);
+    EXPECT_EQ(2 * SECTOR_SIZE, readLog[0].size);
+    EXPECT_EQ(0U, readLog[0].offset);
+    EXPECT_EQ(0, data[SECTOR_SIZE]);
+    EXPECT_EQ(1, data[SECTOR_SIZE + 1]);
+}
@@ -43,6 +43,7 @@ extern "C" {
     #include "flight/mixer.h"
     #include "flight/pid.h"
     #include "flight/imu.h"
+    #include "flight/position.h"
 
     #include "io/gps.h"
 
@@ -73,6 +74,13 @@ extern "C" {
 
 const float sqrt2over2 = sqrt(2) / 2.0f;
 
+uint32_t simulatedSensors = 0;
+float simulatedGyroAverage[XYZ_AXIS_COUNT];
+float simulatedAccAverage[XYZ_AXIS_COUNT];
+int gyroAccumulationReads = 0;
+int32_t simulatedStrokeAltitudeCm = 0;
+bool simulatedStrokeAltitudeReady = true;
+
 TEST(FlightImuTest, TestCalculateRotationMatrix)
 {
     #define TOL 1e-6
@@ -196,6 +204,131 @@ TEST(FlightImuTest, TestSmallAngle)
     EXPECT_EQ(0, STATE(SMALL_ANGLE));
 }
 
+TEST(FlightImuTest, TestStrokeSyncUpdate)
+{
+    // given
+    imuConfigMutable()->dcm_kp = 0;
+    imuConfigMutable()->dcm_ki = 0;
+    imuConfigMutable()->stroke_sync = 1;
+    imuConfigure(0, 0);
+    simulatedSensors = SENSOR_ACC;
+    acc.isAccelUpdatedAtLeastOnce = true;
+    q.w = 1; q.x = 0; q.y = 0; q.z = 0;
+    imuComputeRotationMatrix();
+    simulatedGyroAverage[X] = 90.0f;
+    gyroAccumulationReads = 0;
+
+    // when the first boundary only starts the stroke
+    imuStrokeBoundary(100000);
+    imuUpdateAttitude(110000);
+
+    // expect the attitude to be held, accumulators untouched by the attitude task
+    EXPECT_EQ(1, gyroAccumulationReads);
+    EXPECT_EQ(0, attitude.values.roll);
+
+    // when a whole 100ms stroke completes
+    imuStrokeBoundary(200000);
+    imuUpdateAttitude(210000);
+
+    // expect one update over the stroke duration rather than the task period: 90 deg/s for 100ms
+    EXPECT_EQ(2, gyroAccumulationReads);
+    EXPECT_NEAR(90, attitude.values.roll, 1);
+
+    // when the strokes stop, expect a fall back to updating every attitude task
+    imuUpdateAttitude(220000);
+    EXPECT_EQ(2, gyroAccumulationReads);
+    imuUpdateAttitude(800000);
+    EXPECT_EQ(3, gyroAccumulationReads);
+
+    simulatedSensors = 0;
+    simulatedGyroAverage[X] = 0.0f;
+    imuConfigMutable()->stroke_sync = 0;
+}
+
+TEST(FlightImuTest, TestFastAttitudePropagation)
+{
+    // given a full update from level
+    imuConfigMutable()->dcm_kp = 0;
+    imuConfigMutable()->dcm_ki = 0;
+    imuConfigMutable()->stroke_sync = 0;
+    imuConfigMutable()->fast_attitude = 1;
+    imuConfigure(0, 0);
+    simulatedSensors = SENSOR_ACC;
+    acc.isAccelUpdatedAtLeastOnce = true;
+    q.w = 1; q.x = 0; q.y = 0; q.z = 0;
+    imuComputeRotationMatrix();
+    imuUpdateAttitude(1000000);
+    EXPECT_EQ(0, attitude.values.roll);
+
+    // when the PID loop runs 40 loops of 250us at 100 deg/s roll, -50 deg/s pitch
+    const float gyroRate[XYZ_AXIS_COUNT] = { 100.0f, -50.0f, 0.0f };
+    for (int i = 0; i < 40; i++) {
+        imuPropagateAttitude(gyroRate, 0.00025f);
+    }
+
+    // expect roll and pitch to follow the gyro between full updates
+    EXPECT_NEAR(10, attitude.values.roll, 1);
+    EXPECT_NEAR(-5, attitude.values.pitch, 1);
+
+    // when the next full update integrates the same rotation
+    simulatedGyroAverage[X] = 100.0f;
+    simulatedGyroAverage[Y] = -50.0f;
+    imuUpdateAttitude(1010000);
+    const int16_t roll = attitude.values.roll;
+
+    // expect the gyro-only angles to be replaced by it and propagation to continue from there
+    EXPECT_NEAR(10, roll, 1);
+    imuPropagateAttitude(gyroRate, 0.00025f);
+    EXPECT_NEAR(roll, attitude.values.roll, 1);
+
+    simulatedSensors = 0;
+    simulatedGyroAverage[X] = 0.0f;
+    simulatedGyroAverage[Y] = 0.0f;
+}
+
+TEST(FlightImuTest, TestStrokeSyncAltitude)
+{
+    // given a 100cm/s climb, each 80ms stroke averaging to the altitude at its middle with a little residue
+    barometerConfigMutable()->baro_stroke_sync = 1;
+    simulatedSensors = SENSOR_BARO;
+    const timeUs_t strokeUs = 80000;
+    const timeUs_t startUs = 2000000;
+
+    // when the first boundary only starts the stroke
+    positionStrokeBoundary(startUs);
+    calculateEstimatedAltitude(startUs + 30000);
+
+    // expect the moving baro estimate until two strokes are in
+    EXPECT_EQ(0, getEstimatedAltitudeCm());
+
+    for (int stroke = 1; stroke <= 6; stroke++) {
+        const timeUs_t boundaryUs = startUs + stroke * strokeUs;
+        const float midStrokeS = (stroke - 0.5f) * strokeUs * 1e-6f;
+        simulatedStrokeAltitudeCm = lrintf(100.0f * midStrokeS) + ((stroke & 1) ? 1 : -1);
+        positionStrokeBoundary(boundaryUs);
+        calculateEstimatedAltitude(boundaryUs + 30000);
+    }
+
+    // expect the line through the stroke means, evaluated at the last boundary (480ms)
+    EXPECT_NEAR(100, getEstimatedVario(), 10);
+    EXPECT_NEAR(48, getEstimatedAltitudeCm(), 2);
+
+    // when a stroke is too short to hold enough baro samples, expect it merged rather than used
+    simulatedStrokeAltitudeReady = false;
+    simulatedStrokeAltitudeCm = 1000;
+    positionStrokeBoundary(startUs + 7 * strokeUs);
+    calculateEstimatedAltitude(startUs + 7 * strokeUs + 30000);
+    EXPECT_NEAR(48, getEstimatedAltitudeCm(), 2);
+
+    // when flapping stops, expect a fall back to the moving baro estimate
+    calculateEstimatedAltitude(startUs + 7 * strokeUs + 600000);
+    EXPECT_EQ(0, getEstimatedAltitudeCm());
+
+    simulatedStrokeAltitudeReady = true;
+    simulatedSensors = 0;
+    barometerConfigMutable()->baro_stroke_sync = 0;
+}
+
 // STUBS
 
 extern "C" {
@@ -231,8 +364,7 @@ uint16_t disableFlightMode(flightModeFlags_e mask)
 
 bool sensors(uint32_t mask)
 {
-    UNUSED(mask);
-    return false;
+    return mask & simulatedSensors;
 };
 
 uint32_t millis(void) { return 0; }
@@ -242,8 +374,22 @@ bool compassIsHealthy(void) { return true; }
 bool isBaroCalibrationComplete(void) { return true; }
 void performBaroCalibrationCycle(void) {}
 int32_t baroCalculateAltitude(void) { return 0; }
-bool gyroGetAccumulationAverage(float *) { return false; }
-bool accGetAccumulationAverage(float *) { return false; }
+bool baroStrokeBoundary(bool wholeStroke, int32_t *strokeAltitudeCm)
+{
+    *strokeAltitudeCm = simulatedStrokeAltitudeCm;
+    return wholeStroke && simulatedStrokeAltitudeReady;
+}
+bool gyroGetAccumulationAverage(float *accumulation)
+{
+    gyroAccumulationReads++;
+    memcpy(accumulation, simulatedGyroAverage, sizeof(simulatedGyroAverage));
+    return true;
+}
+bool accGetAccumulationAverage(float *accumulation)
+{
+    memcpy(accumulation, simulatedAccAverage, sizeof(simulatedAccAverage));
+    return true;
+}
 void mixerSetThrottleAngleCorrection(int) {};
 bool gpsRescueIsRunning(void) { return false; }
 }
@@ -72,3 +72,15 @@ TEST(GpsConversionTest, GPSCoordToDegrees_NMEA_Values)
         EXPECT_EQ(result, expectation->degrees);
     }
 }
+
+TEST(GpsConversionTest, GPSCoordDDMMToDegrees_NMEA_Values)
+{
+    // expect same results as the string conversion above, for in-range values
+    EXPECT_EQ(0, GPS_coord_ddmm_to_degrees(0, 0));
+    EXPECT_EQ(16, GPS_coord_ddmm_to_degrees(0, 1));
+    EXPECT_EQ(514728783UL, GPS_coord_ddmm_to_degrees(5128, 3727));
+    EXPECT_EQ(533613366UL, GPS_coord_ddmm_to_degrees(5321, 6802));
+    EXPECT_EQ(65056200UL, GPS_coord_ddmm_to_degrees(630, 3372));
+    EXPECT_EQ(1799999983UL, GPS_coord_ddmm_to_degrees(17959, 9999));
+    EXPECT_EQ(GPS_coord_to_degrees("17959.9999"), GPS_coord_ddmm_to_degrees(17959, 9999));
+}
@@ -0,0 +1,120 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <math.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "common/axis.h"
+
+    #include "sensors/gyro_fusion.h"
+
+    uint8_t debugMode;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define LOOPTIME_US 250
+#define FLAP_HZ 10.0f
+#define DT (LOOPTIME_US * 1e-6f)
+
+// Deterministic noise with the spectrum the gyro lowpass leaves, about ±amplitude
+typedef struct noise_s {
+    uint32_t seed;
+    float state;
+} noise_t;
+
+static float noise(noise_t *n, float amplitude)
+{
+    n->seed = n->seed * 1664525u + 1013904223u;
+    n->state += 0.14f * (8.0f * amplitude * (int32_t)n->seed / 2147483648.0f - n->state);   // 100Hz pt1
+    return n->state;
+}
+
+// The body rolling slowly and rocking with the stroke, both common to the two gyros
+static float bodyRate(int loop, float *sinTheta)
+{
+    const float t = loop * DT;
+    *sinTheta = sinf(2.0f * M_PIf * FLAP_HZ * t);
+    return 50.0f * sinf(2.0f * M_PIf * 0.5f * t) + 20.0f * *sinTheta;
+}
+
+TEST(GyroFusionTest, QuieterGyroGetsTheWeight)
+{
+    gyroFusionInit(LOOPTIME_US);
+    EXPECT_FLOAT_EQ(0.5f, gyroFusionWeight(FD_ROLL));
+
+    noise_t noise1 = { 1, 0.0f };
+    noise_t noise2 = { 2, 0.0f };
+    float fusedError = 0.0f;
+    float averageError = 0.0f;
+    for (int loop = 0; loop < 80000; loop++) {
+        float sinTheta;
+        const float rate = bodyRate(loop, &sinTheta);
+        const float rate1 = rate + noise(&noise1, 1.0f);
+        const float rate2 = rate + noise(&noise2, 10.0f);
+        const float fused = gyroFusionApply(FD_ROLL, rate1, rate2, sinTheta);
+        if (loop >= 40000) {
+            fusedError += (fused - rate) * (fused - rate);
+            averageError += (0.5f * (rate1 + rate2) - rate) * (0.5f * (rate1 + rate2) - rate);
+        }
+    }
+
+    // 1/σ² weighting for σ 1 and 10 gives gyro 2 about 1%
+    EXPECT_LT(gyroFusionWeight(FD_ROLL), 0.1f);
+    EXPECT_LT(fusedError, 0.1f * averageError);
+    // the other axes have not seen a sample
+    EXPECT_FLOAT_EQ(0.5f, gyroFusionWeight(FD_PITCH));
+}
+
+TEST(GyroFusionTest, EvenNoiseStaysEven)
+{
+    gyroFusionInit(LOOPTIME_US);
+
+    noise_t noise1 = { 3, 0.0f };
+    noise_t noise2 = { 4, 0.0f };
+    for (int loop = 0; loop < 80000; loop++) {
+        float sinTheta;
+        const float rate = bodyRate(loop, &sinTheta);
+        gyroFusionApply(FD_PITCH, rate + noise(&noise1, 2.0f), rate + noise(&noise2, 2.0f), sinTheta);
+    }
+
+    EXPECT_NEAR(0.5f, gyroFusionWeight(FD_PITCH), 0.15f);
+}
+
+TEST(GyroFusionTest, StrokeCoherentCouplingIsNotNoise)
+{
+    gyroFusionInit(LOOPTIME_US);
+
+    noise_t noise1 = { 5, 0.0f };
+    noise_t noise2 = { 6, 0.0f };
+    for (int loop = 0; loop < 80000; loop++) {
+        float sinTheta;
+        const float rate = bodyRate(loop, &sinTheta);
+        // gyro 2 picks up the wing servos in phase with the stroke, which Espelho cancels downstream
+        const float rate1 = rate + noise(&noise1, 2.0f);
+        const float rate2 = rate + 30.0f * sinTheta + noise(&noise2, 2.0f);
+        gyroFusionApply(FD_YAW, rate1, rate2, sinTheta);
+    }
+
+    EXPECT_NEAR(0.5f, gyroFusionWeight(FD_YAW), 0.25f);
+}
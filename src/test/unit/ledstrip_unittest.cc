@@ -42,6 +42,8 @@ extern "C" {
     #include "fc/rc_modes.h"
     #include "fc/runtime_config.h"
 
+    #include "flight/pid.h"
+
     #include "io/gps.h"
     #include "io/ledstrip.h"
 
@@ -191,6 +193,22 @@ TEST(LedStripTest, parseLedStripConfig)
     EXPECT_EQ(6, lowestYValueForSouth);
 }
 
+TEST(LedStripTest, wingPhaseFunction)
+{
+    // given
+    memset(&ledStripStatusModeConfigMutable()->ledConfigs, 0, sizeof(ledStripStatusModeConfig()->ledConfigs));
+
+    // when
+    EXPECT_EQ(true, parseLedStripConfig(0, "0,7::P:3"));
+    EXPECT_EQ(true, parseLedStripConfig(1, "1,7::P:3"));
+
+    // then
+    EXPECT_EQ(DEFINE_LED(0, 7, 3, 0, LF(WING_PHASE), 0, 0), ledStripStatusModeConfig()->ledConfigs[0]);
+    EXPECT_EQ(DEFINE_LED(1, 7, 3, 0, LF(WING_PHASE), 0, 0), ledStripStatusModeConfig()->ledConfigs[1]);
+    EXPECT_EQ(2, ledCounts.count);
+    EXPECT_EQ(0, ledCounts.ring);
+}
+
 TEST(LedStripTest, smallestGridWithCenter)
 {
     // given
@@ -394,4 +412,9 @@ uint8_t getRssiPercent(void) { return 0; }
 bool isFlipOverAfterCrashActive(void) { return false; }
 
 void ws2811LedStripEnable(void) { }
+
+void getOrnithopterWingState(ornithopterWingState_t *state)
+{
+    memset(state, 0, sizeof(*state));
+}
 }
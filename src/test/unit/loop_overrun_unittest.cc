@@ -0,0 +1,140 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "fc/loop_overrun.h"
+
+    #include "scheduler/scheduler.h"
+
+    static timeUs_t simulationTime;
+    static cfTaskId_e previousTask = TASK_NONE;
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define LOOPTIME_US 125
+
+// One iteration starting periodUs after the previous one, with the given time spent in each subtask
+static void runIteration(timeDelta_t periodUs, const uint16_t subtaskUs[LOOP_SUBTASK_COUNT])
+{
+    simulationTime += periodUs;
+    const timeUs_t startUs = simulationTime;
+    timeUs_t subtaskStartUs = startUs;
+    for (int i = 0; i < LOOP_SUBTASK_COUNT; i++) {
+        simulationTime += subtaskUs[i];
+        subtaskStartUs = loopSubtaskDone((loopSubtask_e)i, subtaskStartUs);
+    }
+    loopOverrunCheck(startUs, subtaskStartUs, periodUs, LOOPTIME_US);
+}
+
+static const uint16_t onTime[LOOP_SUBTASK_COUNT] = { 20, 5, 40, 10, 15 };
+static const uint16_t slowPid[LOOP_SUBTASK_COUNT] = { 20, 5, 110, 10, 15 };
+
+TEST(LoopOverrunTest, OnTimeIterationsAreNotRecorded)
+{
+    loopOverrunReset();
+    simulationTime = 1000000;
+
+    for (int i = 0; i < 100; i++) {
+        runIteration(LOOPTIME_US, onTime);
+    }
+    // a little late is just jitter
+    runIteration(LOOPTIME_US + LOOPTIME_US / 2, onTime);
+
+    EXPECT_EQ(0, loopOverrunCount());
+    EXPECT_EQ(NULL, loopOverrunGet(0));
+}
+
+TEST(LoopOverrunTest, OverrunIsBlamedOnLongestSubtask)
+{
+    loopOverrunReset();
+    simulationTime = 1000000;
+    previousTask = TASK_SERIAL;
+
+    runIteration(LOOPTIME_US, onTime);
+    runIteration(LOOPTIME_US, slowPid);
+    const timeUs_t overrunStartUs = simulationTime - 160;
+    runIteration(LOOPTIME_US, onTime);
+
+    ASSERT_EQ(1, loopOverrunCount());
+    const loopOverrun_t *overrun = loopOverrunGet(0);
+    ASSERT_NE((const loopOverrun_t *)NULL, overrun);
+    EXPECT_EQ(overrunStartUs, overrun->timeUs);
+    EXPECT_EQ(160, overrun->executionUs);
+    EXPECT_EQ(0, overrun->lateUs);
+    EXPECT_EQ(LOOP_SUBTASK_PID_CONTROLLER, overrun->subtask);
+    EXPECT_EQ(110, overrun->subtaskUs);
+    EXPECT_EQ(TASK_SERIAL, overrun->precedingTask);
+    EXPECT_STREQ("PID", loopSubtaskName((loopSubtask_e)overrun->subtask));
+}
+
+TEST(LoopOverrunTest, LateStartIsRecorded)
+{
+    loopOverrunReset();
+    simulationTime = 1000000;
+    previousTask = TASK_BATTERY_VOLTAGE;
+
+    // a whole gyro sample skipped while the battery task ran
+    runIteration(LOOPTIME_US, onTime);
+    runIteration(3 * LOOPTIME_US, onTime);
+
+    ASSERT_EQ(1, loopOverrunCount());
+    const loopOverrun_t *overrun = loopOverrunGet(0);
+    EXPECT_EQ(90, overrun->executionUs);
+    EXPECT_EQ(2 * LOOPTIME_US, overrun->lateUs);
+    EXPECT_EQ(TASK_BATTERY_VOLTAGE, overrun->precedingTask);
+}
+
+TEST(LoopOverrunTest, HistoryKeepsMostRecent)
+{
+    loopOverrunReset();
+    simulationTime = 1000000;
+
+    const int overruns = LOOP_OVERRUN_HISTORY_SIZE + 5;
+    for (int i = 0; i < overruns; i++) {
+        previousTask = (cfTaskId_e)(i % TASK_COUNT);
+        runIteration(LOOPTIME_US, slowPid);
+        runIteration(LOOPTIME_US, onTime);
+    }
+
+    EXPECT_EQ(overruns, loopOverrunCount());
+    // the oldest ones have been overwritten
+    EXPECT_EQ(NULL, loopOverrunGet(0));
+    EXPECT_EQ(NULL, loopOverrunGet(overruns - LOOP_OVERRUN_HISTORY_SIZE - 1));
+    EXPECT_EQ(NULL, loopOverrunGet(overruns));
+    for (int i = overruns - LOOP_OVERRUN_HISTORY_SIZE; i < overruns; i++) {
+        const loopOverrun_t *overrun = loopOverrunGet(i);
+        ASSERT_NE((const loopOverrun_t *)NULL, overrun);
+        EXPECT_EQ(i % TASK_COUNT, overrun->precedingTask);
+    }
+
+    // arming starts a new record
+    loopOverrunReset();
+    EXPECT_EQ(0, loopOverrunCount());
+    EXPECT_EQ(NULL, loopOverrunGet(0));
+}
+
+// STUBS
+
+extern "C" {
+    uint32_t micros(void) { return simulationTime; }
+    cfTaskId_e getPreviousTaskId(void) { return previousTask; }
+}
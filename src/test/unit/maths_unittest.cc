@@ -22,6 +22,12 @@
 
 #include <math.h>
 
+#include <chrono>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
 #define USE_BARO
 
 extern "C" {
@@ -273,3 +279,98 @@ TEST(MathsUnittest, TestFastTrigonometryACos)
     EXPECT_LE(error, 1e-4);
 }
 #endif
+
+#if MATH_KERNEL_PRECISION == MATH_KERNEL_PRECISION_HIGH
+#define KERNEL_SIN_MAX_ERROR 2e-7
+#define KERNEL_COS_MAX_ERROR 2e-7
+#else
+#define KERNEL_SIN_MAX_ERROR 2e-5
+#define KERNEL_COS_MAX_ERROR 2e-5
+#endif
+
+TEST(MathsUnittest, TestWrap2Pi)
+{
+    EXPECT_FLOAT_EQ(0.0f, wrap_2pi(0.0f));
+    EXPECT_NEAR(1.0f, wrap_2pi(1.0f + 4 * M_PI), 1e-5);
+    EXPECT_NEAR(2 * M_PI - 1.0f, wrap_2pi(-1.0f), 1e-6);
+    EXPECT_NEAR(M_PI, wrap_2pi(-3 * M_PI), 1e-5);
+
+    for (float x = -1000.0f; x < 1000.0f; x += 0.37f) {
+        const float r = wrap_2pi(x);
+        EXPECT_GE(r, 0.0f);
+        EXPECT_LT(r, 2.0f * M_PIf);
+        // same angle, to the float resolution of x
+        EXPECT_NEAR(0.0, sin((double)r - (double)x), 1e-4);
+    }
+}
+
+TEST(MathsUnittest, TestRangeReducedSinCos)
+{
+    double sinError = 0;
+    double cosError = 0;
+    for (float x = -1000.0f; x < 1000.0f; x += 0.0013f) {
+        float s, c;
+        sincos_approx(x, &s, &c);
+        sinError = MAX(sinError, fabs(s - sin((double)x)));
+        cosError = MAX(cosError, fabs(c - cos((double)x)));
+    }
+    printf("sincos_approx maximum absolute error = sin %e, cos %e\n", sinError, cosError);
+    EXPECT_LE(sinError, KERNEL_SIN_MAX_ERROR);
+    EXPECT_LE(cosError, KERNEL_COS_MAX_ERROR);
+
+    sinError = 0;
+    cosError = 0;
+    for (float x = 0.0f; x <= M_PIf; x += 0.00001f) {
+        float s, c;
+        sincos_ramp_approx(x, &s, &c);
+        sinError = MAX(sinError, fabs(s - sin((double)x)));
+        cosError = MAX(cosError, fabs(c - cos((double)x)));
+    }
+    printf("sincos_ramp_approx maximum absolute error = sin %e, cos %e\n", sinError, cosError);
+    EXPECT_LE(sinError, KERNEL_SIN_MAX_ERROR);
+    EXPECT_LE(cosError, KERNEL_COS_MAX_ERROR);
+}
+
+static uint64_t cycleCount(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// Host cost per call of the kernels against libm, reported rather than asserted
+TEST(MathsUnittest, BenchmarkRangeReducedKernels)
+{
+    const int count = 1000000;
+    static float input[1000];
+    for (int i = 0; i < 1000; i++) {
+        input[i] = -100.0f + i * 0.2f;
+    }
+
+    volatile float sink = 0;
+    float sum;
+
+#define BENCHMARK(name, body) do { \
+        sum = 0; \
+        const uint64_t startCycles = cycleCount(); \
+        const auto start = std::chrono::steady_clock::now(); \
+        for (int i = 0; i < count; i++) { \
+            const float x = input[i % 1000]; \
+            body; \
+        } \
+        const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / count; \
+        const double cycles = (double)(cycleCount() - startCycles) / count; \
+        sink = sink + sum; \
+        printf("%-20s %6.2f ns/call %6.1f cycles/call\n", name, ns, cycles); \
+    } while (0)
+
+    BENCHMARK("sinf+cosf", sum += sinf(x) + cosf(x));
+    BENCHMARK("sin_approx+cos", sum += sin_approx(fmodf(x, 2 * M_PIf)) + cos_approx(fmodf(x, 2 * M_PIf)));
+    BENCHMARK("sincos_approx", float s; float c; sincos_approx(x, &s, &c); sum += s + c);
+    BENCHMARK("sincos_ramp_approx", float s; float c; sincos_ramp_approx(fabsf(x) * 0.0314f, &s, &c); sum += s + c);
+    BENCHMARK("fmodf", sum += fmodf(x, 2 * M_PIf));
+    BENCHMARK("wrap_2pi", sum += wrap_2pi(x));
+#undef BENCHMARK
+}
@@ -0,0 +1,338 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/streambuf.h"
+    #include "common/utils.h"
+
+    #include "drivers/serial.h"
+
+    #include "msp/msp.h"
+    #include "msp/msp_batch.h"
+    #include "msp/msp_protocol_v2_orniflight.h"
+    #include "msp/msp_serial.h"
+
+    #include "scheduler/scheduler.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define REPLY_BUFFER_SIZE 64
+#define GUARD_SIZE 16
+#define GUARD_BYTE 0xA5
+
+#define TEST_CMD_SMALL      0x0101  // 20 byte reply
+#define TEST_CMD_MEDIUM     0x0102  // 40 byte reply
+#define TEST_CMD_LARGE      0x0103  // 250 byte reply
+#define TEST_CMD_EMPTY      0x0104  // no payload
+#define TEST_CMD_UNKNOWN    0x0105
+#define TEST_CMD_MAX        0x0106  // the largest reply a read-only command can have
+
+// Fills the reply with the low byte of the command id, so entries can be told apart
+static bool testReadOnlyCommand(uint16_t cmdMSP, sbuf_t *dst)
+{
+    switch (cmdMSP) {
+    case TEST_CMD_SMALL:
+        sbufFill(dst, cmdMSP & 0xFF, 20);
+        return true;
+    case TEST_CMD_MEDIUM:
+        sbufFill(dst, cmdMSP & 0xFF, 40);
+        return true;
+    case TEST_CMD_LARGE:
+        sbufFill(dst, cmdMSP & 0xFF, 250);
+        return true;
+    case TEST_CMD_MAX:
+        sbufFill(dst, cmdMSP & 0xFF, MSP_READ_ONLY_REPLY_MAX_SIZE);
+        return true;
+    case TEST_CMD_EMPTY:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static uint8_t requestBuf[32];
+static uint8_t replyBuf[REPLY_BUFFER_SIZE + GUARD_SIZE];
+
+static int runBatch(const uint16_t *commands, int count, int replySize)
+{
+    sbuf_t src;
+    sbufInit(&src, requestBuf, ARRAYEND(requestBuf));
+    for (int i = 0; i < count; i++) {
+        sbufWriteU16(&src, commands[i]);
+    }
+    sbufSwitchToReader(&src, requestBuf);
+
+    memset(replyBuf, GUARD_BYTE, sizeof(replyBuf));
+    sbuf_t dst;
+    sbufInit(&dst, replyBuf, replyBuf + replySize);
+    EXPECT_EQ(MSP_RESULT_ACK, mspBatchProcessCommand(&src, &dst, testReadOnlyCommand));
+
+    return sbufPtr(&dst) - replyBuf;
+}
+
+static void expectGuardIntact(int replySize)
+{
+    for (unsigned i = replySize; i < sizeof(replyBuf); i++) {
+        EXPECT_EQ(GUARD_BYTE, replyBuf[i]);
+    }
+}
+
+static void expectEntry(const uint8_t *entry, uint16_t cmdMSP, uint8_t status, uint16_t size)
+{
+    EXPECT_EQ(cmdMSP, entry[0] | entry[1] << 8);
+    EXPECT_EQ(status, entry[2]);
+    EXPECT_EQ(size, entry[3] | entry[4] << 8);
+    for (int i = 0; i < size; i++) {
+        EXPECT_EQ(cmdMSP & 0xFF, entry[MSP2_BATCH_ENTRY_HEADER_SIZE + i]);
+    }
+}
+
+TEST(MspBatchTest, EmptyRequestIsAnError)
+{
+    sbuf_t src;
+    sbufInit(&src, requestBuf, requestBuf);
+    sbuf_t dst;
+    sbufInit(&dst, replyBuf, replyBuf + REPLY_BUFFER_SIZE);
+
+    EXPECT_EQ(MSP_RESULT_ERROR, mspBatchProcessCommand(&src, &dst, testReadOnlyCommand));
+}
+
+TEST(MspBatchTest, EntriesInRequestOrder)
+{
+    const uint16_t commands[] = { TEST_CMD_SMALL, TEST_CMD_UNKNOWN, TEST_CMD_EMPTY, TEST_CMD_SMALL };
+    const int length = runBatch(commands, ARRAYLEN(commands), REPLY_BUFFER_SIZE);
+
+    EXPECT_EQ(4 * MSP2_BATCH_ENTRY_HEADER_SIZE + 2 * 20, length);
+    const uint8_t *entry = replyBuf;
+    expectEntry(entry, TEST_CMD_SMALL, MSP2_BATCH_STATUS_OK, 20);
+    entry += MSP2_BATCH_ENTRY_HEADER_SIZE + 20;
+    expectEntry(entry, TEST_CMD_UNKNOWN, MSP2_BATCH_STATUS_UNSUPPORTED, 0);
+    entry += MSP2_BATCH_ENTRY_HEADER_SIZE;
+    expectEntry(entry, TEST_CMD_EMPTY, MSP2_BATCH_STATUS_OK, 0);
+    entry += MSP2_BATCH_ENTRY_HEADER_SIZE;
+    expectEntry(entry, TEST_CMD_SMALL, MSP2_BATCH_STATUS_OK, 20);
+    expectGuardIntact(REPLY_BUFFER_SIZE);
+}
+
+TEST(MspBatchTest, EntryThatDoesNotFitIsTruncated)
+{
+    // 25 bytes for the first entry leave 39, not enough for the second
+    const uint16_t commands[] = { TEST_CMD_SMALL, TEST_CMD_MEDIUM, TEST_CMD_SMALL };
+    const int length = runBatch(commands, ARRAYLEN(commands), REPLY_BUFFER_SIZE);
+
+    EXPECT_EQ(2 * MSP2_BATCH_ENTRY_HEADER_SIZE + 20, length);
+    expectEntry(replyBuf, TEST_CMD_SMALL, MSP2_BATCH_STATUS_OK, 20);
+    expectEntry(replyBuf + MSP2_BATCH_ENTRY_HEADER_SIZE + 20, TEST_CMD_MEDIUM, MSP2_BATCH_STATUS_TRUNCATED, 0);
+    // nothing past the truncated entry, nothing past the end of the buffer
+    EXPECT_EQ(GUARD_BYTE, replyBuf[length]);
+    expectGuardIntact(REPLY_BUFFER_SIZE);
+}
+
+TEST(MspBatchTest, ReplyLargerThanBufferDoesNotOverflow)
+{
+    const uint16_t commands[] = { TEST_CMD_LARGE };
+    const int length = runBatch(commands, ARRAYLEN(commands), REPLY_BUFFER_SIZE);
+
+    EXPECT_EQ(MSP2_BATCH_ENTRY_HEADER_SIZE, length);
+    expectEntry(replyBuf, TEST_CMD_LARGE, MSP2_BATCH_STATUS_TRUNCATED, 0);
+    expectGuardIntact(REPLY_BUFFER_SIZE);
+}
+
+TEST(MspBatchTest, NoRoomForHeaderEndsBatch)
+{
+    // exactly one small entry fits, with 3 bytes to spare
+    const int replySize = MSP2_BATCH_ENTRY_HEADER_SIZE + 20 + 3;
+    const uint16_t commands[] = { TEST_CMD_SMALL, TEST_CMD_EMPTY };
+    const int length = runBatch(commands, ARRAYLEN(commands), replySize);
+
+    EXPECT_EQ(MSP2_BATCH_ENTRY_HEADER_SIZE + 20, length);
+    expectEntry(replyBuf, TEST_CMD_SMALL, MSP2_BATCH_STATUS_OK, 20);
+    expectGuardIntact(replySize);
+}
+
+#define MAX_PUSHES 32
+
+static serialPort_t testPort;
+static bool streamTaskEnabled;
+static uint32_t streamTaskPeriodUs;
+static int pushCount;
+static uint16_t pushedCmd[MAX_PUSHES];
+static int pushedSize[MAX_PUSHES];
+static int pushesAccepted;      // pushes the TX buffer takes before it is full, -1 for no limit
+
+static uint8_t subscribe(uint16_t rateHz, const uint16_t *commands, int count, mspPostProcessFnPtr *postProcessFn)
+{
+    sbuf_t src;
+    sbufInit(&src, requestBuf, ARRAYEND(requestBuf));
+    sbufWriteU16(&src, rateHz);
+    for (int i = 0; i < count; i++) {
+        sbufWriteU16(&src, commands[i]);
+    }
+    sbufSwitchToReader(&src, requestBuf);
+
+    sbuf_t dst;
+    sbufInit(&dst, replyBuf, replyBuf + REPLY_BUFFER_SIZE);
+    *postProcessFn = NULL;
+    EXPECT_EQ(MSP_RESULT_ACK, mspStreamCommand(&src, &dst, postProcessFn));
+    EXPECT_EQ(1, sbufPtr(&dst) - replyBuf);
+
+    return replyBuf[0];
+}
+
+static void resetPushes(int accepted)
+{
+    pushCount = 0;
+    pushesAccepted = accepted;
+}
+
+TEST(MspStreamTest, SubscribeBindsPortAndPushes)
+{
+    const uint16_t commands[] = { TEST_CMD_SMALL, TEST_CMD_MEDIUM };
+    mspPostProcessFnPtr postProcessFn;
+    EXPECT_EQ(2, subscribe(100, commands, ARRAYLEN(commands), &postProcessFn));
+
+    // nothing goes out before the subscription reply has
+    resetPushes(-1);
+    mspStreamProcess(testReadOnlyCommand);
+    EXPECT_EQ(0, pushCount);
+
+    ASSERT_NE((mspPostProcessFnPtr)NULL, postProcessFn);
+    postProcessFn(&testPort);
+    EXPECT_TRUE(streamTaskEnabled);
+    EXPECT_EQ(TASK_PERIOD_HZ(100), streamTaskPeriodUs);
+
+    mspStreamProcess(testReadOnlyCommand);
+    ASSERT_EQ(2, pushCount);
+    EXPECT_EQ(TEST_CMD_SMALL, pushedCmd[0]);
+    EXPECT_EQ(20, pushedSize[0]);
+    EXPECT_EQ(TEST_CMD_MEDIUM, pushedCmd[1]);
+    EXPECT_EQ(40, pushedSize[1]);
+}
+
+TEST(MspStreamTest, RateIsLimited)
+{
+    const uint16_t commands[] = { TEST_CMD_SMALL };
+    mspPostProcessFnPtr postProcessFn;
+    subscribe(1000, commands, ARRAYLEN(commands), &postProcessFn);
+    postProcessFn(&testPort);
+
+    EXPECT_EQ(TASK_PERIOD_HZ(MSP_STREAM_MAX_RATE_HZ), streamTaskPeriodUs);
+}
+
+TEST(MspStreamTest, UnsubscribeStopsStream)
+{
+    const uint16_t commands[] = { TEST_CMD_SMALL };
+    mspPostProcessFnPtr postProcessFn;
+    subscribe(50, commands, ARRAYLEN(commands), &postProcessFn);
+    postProcessFn(&testPort);
+
+    // a rate of zero cancels the stream, whatever the list
+    EXPECT_EQ(0, subscribe(0, commands, ARRAYLEN(commands), &postProcessFn));
+    EXPECT_EQ((mspPostProcessFnPtr)NULL, postProcessFn);
+    EXPECT_FALSE(streamTaskEnabled);
+
+    resetPushes(-1);
+    mspStreamProcess(testReadOnlyCommand);
+    EXPECT_EQ(0, pushCount);
+
+    // and so does an empty list
+    subscribe(50, commands, ARRAYLEN(commands), &postProcessFn);
+    postProcessFn(&testPort);
+    EXPECT_EQ(0, subscribe(50, NULL, 0, &postProcessFn));
+    EXPECT_FALSE(streamTaskEnabled);
+    mspStreamProcess(testReadOnlyCommand);
+    EXPECT_EQ(0, pushCount);
+}
+
+TEST(MspStreamTest, UnsupportedRepliesAreSkipped)
+{
+    const uint16_t commands[] = { TEST_CMD_MAX, TEST_CMD_UNKNOWN, TEST_CMD_LARGE, TEST_CMD_SMALL };
+    mspPostProcessFnPtr postProcessFn;
+    EXPECT_EQ(4, subscribe(50, commands, ARRAYLEN(commands), &postProcessFn));
+    postProcessFn(&testPort);
+
+    resetPushes(-1);
+    mspStreamProcess(testReadOnlyCommand);
+    ASSERT_EQ(3, pushCount);
+    EXPECT_EQ(TEST_CMD_MAX, pushedCmd[0]);
+    EXPECT_EQ(MSP_READ_ONLY_REPLY_MAX_SIZE, pushedSize[0]);
+    EXPECT_EQ(TEST_CMD_LARGE, pushedCmd[1]);
+    EXPECT_EQ(250, pushedSize[1]);
+    EXPECT_EQ(TEST_CMD_SMALL, pushedCmd[2]);
+}
+
+TEST(MspStreamTest, FullTxBufferResumesWhereItStopped)
+{
+    const uint16_t commands[] = { TEST_CMD_SMALL, TEST_CMD_MEDIUM, TEST_CMD_EMPTY };
+    mspPostProcessFnPtr postProcessFn;
+    subscribe(50, commands, ARRAYLEN(commands), &postProcessFn);
+    postProcessFn(&testPort);
+
+    resetPushes(1);
+    mspStreamProcess(testReadOnlyCommand);
+    ASSERT_EQ(1, pushCount);
+    EXPECT_EQ(TEST_CMD_SMALL, pushedCmd[0]);
+
+    // the medium reply didn't go out, so it leads the next pass
+    resetPushes(-1);
+    mspStreamProcess(testReadOnlyCommand);
+    ASSERT_EQ(3, pushCount);
+    EXPECT_EQ(TEST_CMD_MEDIUM, pushedCmd[0]);
+    EXPECT_EQ(TEST_CMD_EMPTY, pushedCmd[1]);
+    EXPECT_EQ(TEST_CMD_SMALL, pushedCmd[2]);
+}
+
+// STUBS
+
+extern "C" {
+    void setTaskEnabled(cfTaskId_e taskId, bool enabled)
+    {
+        EXPECT_EQ(TASK_MSP_STREAM, taskId);
+        streamTaskEnabled = enabled;
+    }
+
+    void rescheduleTask(cfTaskId_e taskId, uint32_t newPeriodMicros)
+    {
+        EXPECT_EQ(TASK_MSP_STREAM, taskId);
+        streamTaskPeriodUs = newPeriodMicros;
+    }
+
+    int mspSerialPushPort(serialPort_t *port, uint16_t cmd, uint8_t *data, int datalen, mspDirection_e direction)
+    {
+        EXPECT_EQ(&testPort, port);
+        EXPECT_EQ(MSP_DIRECTION_REPLY, direction);
+        if (pushesAccepted == 0 || pushCount == MAX_PUSHES) {
+            return 0;
+        }
+        for (int i = 0; i < datalen; i++) {
+            EXPECT_EQ(cmd & 0xFF, data[i]);
+        }
+        if (pushesAccepted > 0) {
+            pushesAccepted--;
+        }
+        pushedCmd[pushCount] = cmd;
+        pushedSize[pushCount] = datalen;
+        pushCount++;
+        return datalen + 1;
+    }
+}
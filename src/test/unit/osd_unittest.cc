@@ -61,6 +61,7 @@ extern "C" {
 
     #include "rx/rx.h"
     #include "flight/mixer.h"
+    #include "flight/wing_monitor.h"
 
     void osdRefresh(timeUs_t currentTimeUs);
     void osdFormatTime(char * buff, osd_timer_precision_e precision, timeUs_t time);
@@ -933,6 +934,157 @@ TEST(OsdTest, TestElementWarningsBattery)
     // TODO
 }
 
+/*
+ * Tests that elements are only rewritten when their text changes, and that cells they vacate are erased.
+ */
+TEST(OsdTest, TestElementCache)
+{
+    // given
+    osdConfigMutable()->item_pos[OSD_CRAFT_NAME] = OSD_POS(2, 3) | OSD_PROFILE_1_FLAG;
+    strcpy(pilotConfigMutable()->name, "longname");
+
+    osdAnalyzeActiveElements();
+
+    // when
+    osdRefresh(simulationTime);
+
+    // then
+    displayPortTestBufferSubstring(2, 3, "LONGNAME");
+
+    // given
+    // a cell overwritten behind the back of the OSD
+    testDisplayPortBuffer[3 * UNITTEST_DISPLAYPORT_COLS + 2] = '#';
+
+    // when
+    osdRefresh(simulationTime);
+
+    // then
+    // the unchanged element was not written again
+    displayPortTestBufferSubstring(2, 3, "#ONGNAME");
+
+    // given
+    strcpy(pilotConfigMutable()->name, "ab");
+
+    // when
+    osdRefresh(simulationTime);
+
+    // then
+    displayPortTestBufferSubstring(2, 3, "AB      ");
+
+    // given
+    // element moved
+    osdConfigMutable()->item_pos[OSD_CRAFT_NAME] = OSD_POS(2, 4) | OSD_PROFILE_1_FLAG;
+
+    // when
+    osdRefresh(simulationTime);
+
+    // then
+    displayPortTestBufferSubstring(2, 3, "  ");
+    displayPortTestBufferSubstring(2, 4, "AB");
+
+    // given
+    // the element cache is reset
+    osdResetElementCache();
+    testDisplayPortBuffer[4 * UNITTEST_DISPLAYPORT_COLS + 2] = '#';
+
+    // when
+    osdRefresh(simulationTime);
+
+    // then
+    displayPortTestBufferSubstring(2, 4, "AB");
+
+    // cleanup
+    osdConfigMutable()->item_pos[OSD_CRAFT_NAME] = 0;
+    pilotConfigMutable()->name[0] = '\0';
+}
+
+/*
+ * Tests that elements writing to the display themselves are drawn, and erased when they move.
+ */
+TEST(OsdTest, TestElementHorizonSidebars)
+{
+    // given
+    osdConfigMutable()->item_pos[OSD_HORIZON_SIDEBARS] = OSD_POS(14, 6) | OSD_PROFILE_1_FLAG;
+
+    osdAnalyzeActiveElements();
+
+    // when
+    osdRefresh(simulationTime);
+
+    // then
+    for (int y = 3; y <= 9; y++) {
+        EXPECT_EQ(SYM_AH_DECORATION, testDisplayPortBuffer[y * UNITTEST_DISPLAYPORT_COLS + 7]);
+        EXPECT_EQ(SYM_AH_DECORATION, testDisplayPortBuffer[y * UNITTEST_DISPLAYPORT_COLS + 21]);
+    }
+    EXPECT_EQ(SYM_AH_LEFT, testDisplayPortBuffer[6 * UNITTEST_DISPLAYPORT_COLS + 8]);
+    EXPECT_EQ(SYM_AH_RIGHT, testDisplayPortBuffer[6 * UNITTEST_DISPLAYPORT_COLS + 20]);
+
+    // given
+    // element moved
+    osdConfigMutable()->item_pos[OSD_HORIZON_SIDEBARS] = OSD_POS(15, 6) | OSD_PROFILE_1_FLAG;
+
+    // when
+    osdRefresh(simulationTime);
+
+    // then
+    for (int y = 3; y <= 9; y++) {
+        EXPECT_EQ(' ', testDisplayPortBuffer[y * UNITTEST_DISPLAYPORT_COLS + 7]);
+        EXPECT_EQ(SYM_AH_DECORATION, testDisplayPortBuffer[y * UNITTEST_DISPLAYPORT_COLS + 8]);
+        EXPECT_EQ(SYM_AH_DECORATION, testDisplayPortBuffer[y * UNITTEST_DISPLAYPORT_COLS + 22]);
+    }
+    EXPECT_EQ(SYM_AH_LEFT, testDisplayPortBuffer[6 * UNITTEST_DISPLAYPORT_COLS + 9]);
+    EXPECT_EQ(SYM_AH_RIGHT, testDisplayPortBuffer[6 * UNITTEST_DISPLAYPORT_COLS + 21]);
+
+    // cleanup
+    osdConfigMutable()->item_pos[OSD_HORIZON_SIDEBARS] = 0;
+}
+
+/*
+ * Tests that an element with a value function is only formatted again when its value changes.
+ */
+TEST(OsdTest, TestElementValueCache)
+{
+    // given
+    osdConfigMutable()->item_pos[OSD_MAIN_BATT_VOLTAGE] = OSD_POS(1, 14) | OSD_PROFILE_1_FLAG;
+    simulationBatteryVoltage = 1580;
+
+    osdAnalyzeActiveElements();
+
+    // when
+    osdRefresh(simulationTime);
+
+    // then
+    const char symbol = testDisplayPortBuffer[14 * UNITTEST_DISPLAYPORT_COLS + 1];
+    displayPortTestBufferSubstring(1, 14, "%c15.80%c", symbol, SYM_VOLT);
+
+    // given
+    // a setting that changes the battery symbol, but not the voltage
+    batteryConfigMutable()->vbatmaxcellvoltage = 530;
+
+    // when
+    osdRefresh(simulationTime);
+
+    // then
+    // the element was not formatted again
+    displayPortTestBufferSubstring(1, 14, "%c15.80%c", symbol, SYM_VOLT);
+
+    // given
+    simulationBatteryVoltage = 1581;
+
+    // when
+    osdRefresh(simulationTime);
+
+    // then
+    const char newSymbol = testDisplayPortBuffer[14 * UNITTEST_DISPLAYPORT_COLS + 1];
+    EXPECT_NE(symbol, newSymbol);
+    displayPortTestBufferSubstring(1, 14, "%c15.81%c", newSymbol, SYM_VOLT);
+
+    // cleanup
+    batteryConfigMutable()->vbatmaxcellvoltage = 430;
+    osdConfigMutable()->item_pos[OSD_MAIN_BATT_VOLTAGE] = OSD_POS(12, 1) | OSD_PROFILE_1_FLAG;
+    setDefaultSimulationState();
+}
+
 /*
  * Tests the time string formatting function with a series of precision settings and time values.
  */
@@ -1106,6 +1258,7 @@ extern "C" {
     uint8_t getMotorCount(void){ return 4; }
     bool areMotorsRunning(void){ return true; }
     bool pidOsdAntiGravityActive(void) { return false; }
+    uint8_t wingSaturationWorst(int *pair, wingSaturation_e *limit) { *pair = 0; *limit = WING_SATURATION_AMPLITUDE; return 0; }
     bool failsafeIsActive(void) { return false; }
     bool gpsRescueIsConfigured(void) { return false; }
     int8_t calculateThrottlePercent(void) { return 0; }
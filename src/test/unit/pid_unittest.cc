@@ -50,21 +50,34 @@ extern "C" {
     #include "fc/rc.h"
 
     #include "fc/rc_controls.h"
+    #include "fc/rc_modes.h"
     #include "fc/runtime_config.h"
 
     #include "flight/pid.h"
     #include "flight/imu.h"
     #include "flight/mixer.h"
+    #include "flight/servos.h"
+    #include "flight/wing_monitor.h"
 
     #include "io/gps.h"
 
+    #include "rx/rx.h"
+
     #include "sensors/gyro.h"
     #include "sensors/acceleration.h"
+    #include "sensors/battery.h"
 
     gyro_t gyro;
     attitudeEulerAngles_t attitude;
+    int16_t rcData[MAX_SUPPORTED_RC_CHANNEL_COUNT];
+    float motor[MAX_SUPPORTED_MOTORS];
 
     PG_REGISTER(accelerometerConfig_t, accelerometerConfig, PG_ACCELEROMETER_CONFIG, 0);
+    PG_REGISTER(servoConfig_t, servoConfig, PG_SERVO_CONFIG, 0);
+    PG_REGISTER(batteryConfig_t, batteryConfig, PG_BATTERY_CONFIG, 0);
+
+    uint8_t simulatedBatteryCellCount = 0;
+    uint16_t simulatedBatteryVoltage = 0;
 
     bool unitLaunchControlActive = false;
     launchControlMode_e unitLaunchControlMode = LAUNCH_CONTROL_MODE_NORMAL;
@@ -77,8 +90,21 @@ extern "C" {
     void systemBeep(bool) { }
     bool gyroOverflowDetected(void) { return false; }
     float getRcDeflection(int axis) { return simulatedRcDeflection[axis]; }
+    float getSetpointRateDerivative(int) { return 0; }
+    uint8_t rcSmoothingSplineAxes(void) { return 0; }
+    void imuStrokeBoundary(timeUs_t) { }
+    void positionStrokeBoundary(timeUs_t) { }
+    void imuPropagateAttitude(const float *, float) { }
     void beeperConfirmationBeeps(uint8_t) { }
     bool isLaunchControlActive(void) {return unitLaunchControlActive; }
+    bool IS_RC_MODE_ACTIVE(boxId_e) { return false; }
+    uint8_t getBatteryCellCount(void) { return simulatedBatteryCellCount; }
+    uint16_t getBatteryVoltageLatest(void) { return simulatedBatteryVoltage; }
+    float getServoTrackingError(int) { return 0.0f; }
+    float getServoTrackingDelay(int) { return 0.0f; }
+
+    bool applyFerocityWaveShaping(float theta, float dMod, float iBias, float *outShaped, float *outDerivative);
+    bool advanceFlappingPhase(float dTheta);
 }
 
 pidProfile_t *pidProfile;
@@ -773,3 +799,127 @@ TEST(pidControllerTest, testLaunchControl) {
     ASSERT_NEAR(44.84,  pidData[FD_YAW].P,   calculateTolerance(44.84));
     ASSERT_NEAR(1.56,   pidData[FD_YAW].I,  calculateTolerance(1.56));
 }
+
+TEST(pidControllerTest, testServoSpeedVoltageScale) {
+    resetTest();
+    servoConfigMutable()->servo_speed_deg_s = 857;
+    servoConfigMutable()->servo_speed_vmin_pct = 70;
+    servoConfigMutable()->servo_max_amplitude = 55;
+    servoConfigMutable()->flap_magnitude = 4;
+    servoConfigMutable()->flap_base_amplitude = 60;
+    batteryConfigMutable()->vbatmaxcellvoltage = 430;
+    batteryConfigMutable()->vbatmincellvoltage = 330;
+    pidUpdateThrottle(1.0f);
+
+    // no battery detected: rated speed, amplitude clamped to the mechanical limit
+    simulatedBatteryCellCount = 0;
+    simulatedBatteryVoltage = 0;
+    for (int loop = 0; loop < 500; loop++) {
+        pidController(pidProfile, currentTestTime());
+    }
+    EXPECT_FLOAT_EQ(1.0f, getServoSpeedScale());
+    EXPECT_FLOAT_EQ(55.0f, flappingAmplitude);
+
+    // full 2S pack
+    simulatedBatteryCellCount = 2;
+    simulatedBatteryVoltage = 860;
+    for (int loop = 0; loop < 500; loop++) {
+        pidController(pidProfile, currentTestTime());
+    }
+    EXPECT_NEAR(1.0f, getServoSpeedScale(), 0.001f);
+
+    // halfway down the cell curve, and the filter doesn't jump there
+    simulatedBatteryVoltage = 760;
+    pidController(pidProfile, currentTestTime());
+    EXPECT_GT(getServoSpeedScale(), 0.95f);
+    for (int loop = 0; loop < 500; loop++) {
+        pidController(pidProfile, currentTestTime());
+    }
+    EXPECT_NEAR(0.85f, getServoSpeedScale(), 0.001f);
+    EXPECT_NEAR(55.0f * 0.85f, flappingAmplitude, 0.1f);
+
+    // sagged below the minimum cell voltage: clamped to servo_speed_vmin_pct
+    simulatedBatteryVoltage = 600;
+    for (int loop = 0; loop < 500; loop++) {
+        pidController(pidProfile, currentTestTime());
+    }
+    EXPECT_NEAR(0.70f, getServoSpeedScale(), 0.001f);
+    EXPECT_NEAR(55.0f * 0.70f, flappingAmplitude, 0.1f);
+
+    // regulated supply: no derating whatever the pack does
+    servoConfigMutable()->servo_speed_vmin_pct = 100;
+    for (int loop = 0; loop < 500; loop++) {
+        pidController(pidProfile, currentTestTime());
+    }
+    EXPECT_NEAR(1.0f, getServoSpeedScale(), 0.001f);
+}
+
+TEST(pidControllerTest, testWingSaturationFlags) {
+    resetTest();
+    wingMonitorReset();
+    servoConfigMutable()->servo_speed_deg_s = 857;
+    servoConfigMutable()->servo_speed_vmin_pct = 100;
+    servoConfigMutable()->servo_max_amplitude = 55;
+    servoConfigMutable()->flap_magnitude = 4;
+    servoConfigMutable()->flap_base_amplitude = 60;
+    float shaped, derivative;
+
+    // ferocity inside the trapezoid range, and pushed out of it by the I-term bias
+    EXPECT_FALSE(applyFerocityWaveShaping(1.0f, 0.0f, 0.0f, &shaped, &derivative));
+    EXPECT_TRUE(applyFerocityWaveShaping(1.0f, 0.0f, 10.0f, &shaped, &derivative));
+
+    // full throttle asks for more than servo_max_amplitude on every pair
+    pidUpdateThrottle(1.0f);
+    pidController(pidProfile, currentTestTime());
+    EXPECT_FLOAT_EQ(55.0f, flappingAmplitude);
+    for (int pair = 0; pair < MAX_ORNITHOPTER_PAIRS; pair++) {
+        EXPECT_TRUE(wingSaturationFlags[pair] & (1 << WING_SATURATION_AMPLITUDE));
+    }
+
+    // low throttle stays within it
+    wingMonitorReset();
+    pidUpdateThrottle(0.15f);
+    pidController(pidProfile, currentTestTime());
+    EXPECT_GT(flappingAmplitude, 0.0f);
+    EXPECT_LT(flappingAmplitude, 55.0f);
+    EXPECT_FALSE(wingSaturationFlags[0] & (1 << WING_SATURATION_AMPLITUDE));
+}
+
+TEST(pidControllerTest, testFlappingPhaseLongFlight) {
+    // 65 minutes of 25 Hz strokes at an 8 kHz loop, past the point where an unwrapped float theta stops advancing
+    pidResetIterm();
+    const float dTheta = 2.0f * M_PIf * 25.0f / 8000.0f;
+    const int stepsPerMinute = 8000 * 60;
+    const int minutes = 65;
+
+    int strokes = 0;
+    int firstMinuteStrokes = 0;
+    int lastMinuteStrokes = 0;
+    float minTheta = 2.0f * M_PIf;
+    float maxTheta = 0.0f;
+    ornithopterWingState_t state;
+    for (int minute = 0; minute < minutes; minute++) {
+        int minuteStrokes = 0;
+        for (int step = 0; step < stepsPerMinute; step++) {
+            if (advanceFlappingPhase(dTheta)) {
+                minuteStrokes++;
+            }
+            getOrnithopterWingState(&state);
+            minTheta = MIN(minTheta, state.theta);
+            maxTheta = MAX(maxTheta, state.theta);
+        }
+        if (minute == 0) {
+            firstMinuteStrokes = minuteStrokes;
+        }
+        lastMinuteStrokes = minuteStrokes;
+        strokes += minuteStrokes;
+    }
+
+    EXPECT_LE(0.0f, minTheta);
+    EXPECT_GT(2.0f * M_PIf, maxTheta);
+    EXPECT_NEAR(25 * 60, firstMinuteStrokes, 1);
+    EXPECT_NEAR(25 * 60, lastMinuteStrokes, 1);
+    EXPECT_NEAR(25 * 60 * minutes, strokes, 2);
+
+    pidResetIterm();
+}
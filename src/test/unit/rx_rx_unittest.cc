@@ -17,6 +17,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdio.h>
 
 #include <limits.h>
 
@@ -41,6 +42,7 @@ extern "C" {
     uint8_t debugMode = 0;
 
     bool isPulseValid(uint16_t pulseDuration);
+    int rxTimingBucket(uint32_t timeUs);
 
     PG_RESET_TEMPLATE(featureConfig_t, featureConfig,
         .enabledFeatures = 0
@@ -202,6 +204,89 @@ TEST(RxTest, TestInvalidFlightChannels)
 }
 #endif
 
+TEST(RxTest, TestTimingBuckets)
+{
+    EXPECT_EQ(0, rxTimingBucket(0));
+    EXPECT_EQ(0, rxTimingBucket(63));
+    EXPECT_EQ(1, rxTimingBucket(64));
+    EXPECT_EQ(1, rxTimingBucket(127));
+    EXPECT_EQ(2, rxTimingBucket(128));
+    EXPECT_EQ(6, rxTimingBucket(4095));
+    EXPECT_EQ(7, rxTimingBucket(4096));
+    EXPECT_EQ(7, rxTimingBucket(UINT32_MAX));
+}
+
+static bool testFramePending;
+static timeUs_t testFrameTimeUs;
+
+static uint8_t testFrameStatus(rxRuntimeConfig_t *)
+{
+    if (!testFramePending) {
+        return RX_FRAME_PENDING;
+    }
+    testFramePending = false;
+    return RX_FRAME_COMPLETE;
+}
+
+static timeUs_t testGetFrameTimeUs(const rxRuntimeConfig_t *)
+{
+    return testFrameTimeUs;
+}
+
+// Synthetic 150Hz frame stream picked up by an rx task delayed by up to 3ms of other work. The driver timestamps
+// give exact frame intervals however late the task runs, the histograms show what the scheduling delay looked like.
+TEST(RxTest, TestFrameTimestampJitter)
+{
+    const timeDelta_t frameIntervalUs = 6667;
+    const int frameCount = 1000;
+
+    memset(&testData, 0, sizeof(testData));
+    rxInit();
+    rxRuntimeConfig.rcFrameStatusFn = testFrameStatus;
+    rxRuntimeConfig.rcFrameTimeUsFn = testGetFrameTimeUs;
+
+    uint32_t seed = 12345;
+    timeUs_t lastTaskTimeUs = 0;
+    int taskJitterMaxUs = 0;
+    int timestampJitterMaxUs = 0;
+    for (int i = 0; i < frameCount; i++) {
+        seed = seed * 1103515245 + 12345;
+        const timeUs_t frameTimeUs = 100000 + i * frameIntervalUs;
+        const timeUs_t taskTimeUs = frameTimeUs + (seed >> 16) % 3000;
+
+        testFrameTimeUs = frameTimeUs;
+        testFramePending = true;
+        EXPECT_TRUE(rxUpdateCheck(taskTimeUs, 0));
+        EXPECT_TRUE(calculateRxChannelsAndUpdateFailsafe(taskTimeUs));
+
+        if (i > 0) {
+            taskJitterMaxUs = MAX(taskJitterMaxUs, ABS(cmpTimeUs(taskTimeUs, lastTaskTimeUs) - frameIntervalUs));
+            timestampJitterMaxUs = MAX(timestampJitterMaxUs, ABS(rxGetFrameDelta() - frameIntervalUs));
+        }
+        lastTaskTimeUs = taskTimeUs;
+    }
+
+    EXPECT_EQ(0, timestampJitterMaxUs);
+    EXPECT_GT(taskJitterMaxUs, 2000);
+
+    const rxTimingStats_t *stats = rxGetTimingStats();
+    EXPECT_EQ((uint32_t)frameCount, stats->frameCount);
+    EXPECT_EQ(frameIntervalUs, stats->averageFrameIntervalUs);
+    EXPECT_EQ(0, stats->maxJitterUs);
+    EXPECT_EQ(frameCount - 1, stats->jitter[0]);
+
+    int latencySamples = 0;
+    for (int i = 0; i < RX_TIMING_HISTOGRAM_BUCKETS; i++) {
+        latencySamples += stats->latency[i];
+    }
+    EXPECT_EQ(frameCount, latencySamples);
+    EXPECT_LT(stats->maxLatencyUs, 3000);
+    EXPECT_GT(stats->latency[6], stats->latency[1]);    // 2..4ms holds a third of a uniform 0..3ms delay
+
+    printf("rx timing: task interval jitter max %dus, timestamped interval jitter max %dus, latency max %dus\n",
+        taskJitterMaxUs, timestampJitterMaxUs, stats->maxLatencyUs);
+}
+
 // STUBS
 
 extern "C" {
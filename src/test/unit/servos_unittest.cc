@@ -0,0 +1,186 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "common/axis.h"
+
+    #include "drivers/io.h"
+    #include "drivers/timer.h"
+
+    #include "fc/rc_controls.h"
+    #include "fc/rc_modes.h"
+    #include "fc/runtime_config.h"
+
+    #include "flight/imu.h"
+    #include "flight/mixer.h"
+    #include "flight/pid.h"
+    #include "flight/servos.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+    #include "pg/rx.h"
+
+    #include "rx/rx.h"
+
+    void limitServoTrajectory(timeUs_t currentTimeUs);
+
+    int16_t debug[DEBUG16_VALUE_COUNT];
+    uint8_t debugMode;
+
+    attitudeEulerAngles_t attitude;
+    int16_t rcData[MAX_SUPPORTED_RC_CHANNEL_COUNT];
+    float rcCommand[4];
+    rxRuntimeConfig_t rxRuntimeConfig;
+    float motor[MAX_SUPPORTED_MOTORS];
+    mixerMode_e currentMixerMode;
+    pidAxisData_t pidData[XYZ_AXIS_COUNT];
+    uint32_t targetPidLooptime;
+
+    float flappingAmplitude;
+    float shapedFlappingSinusoidLeft[MAX_ORNITHOPTER_PAIRS];
+    float shapedFlappingSinusoidRight[MAX_ORNITHOPTER_PAIRS];
+
+    PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define SERVO_CENTRE 1500
+#define SERVO_SPEED_US_S (857 * 10.0f)
+
+static timeUs_t currentTimeUs;
+
+// Starts the limiter with all ornithopter servos resting at the centre
+static void startTrajectory(void)
+{
+    pgResetAll();
+    currentMixerMode = MIXER_SERVO_ORNITHOPTER;
+    servoMixerLoadMix(MIXER_SERVO_ORNITHOPTER - 1);
+    servosInit();
+    servoConfigureOutput();
+    servoConfigMutable()->servo_speed_deg_s = 857;
+
+    servoConfigMutable()->servo_accel_ms = 0;
+    limitServoTrajectory(currentTimeUs);
+    servoConfigMutable()->servo_accel_ms = 50;
+    for (int i = SERVO_ORNITHOPTER_INDEX_MIN; i <= SERVO_ORNITHOPTER_INDEX_MAX; i++) {
+        servo[i] = SERVO_CENTRE;
+    }
+    limitServoTrajectory(currentTimeUs);
+}
+
+// Commands a step on one servo; the limited servo barely moves in the 1 ms that follows
+static void stepServo(int index, int step)
+{
+    servo[index] = SERVO_CENTRE + step;
+    currentTimeUs += 1000;
+    limitServoTrajectory(currentTimeUs);
+}
+
+TEST(ServosTest, TrackingErrorSignFollowsFlappingInput)
+{
+    // the wing lags a step up behind the command
+    startTrajectory();
+    stepServo(0, 200);
+    EXPECT_NEAR(-200.0f, getServoTrackingError(0), 1.0f);
+    EXPECT_EQ(0.0f, getServoTrackingError(1));
+
+    // a reversed flapping input moves the servo the other way, so a lagging wing is ahead in input terms
+    startTrajectory();
+    servoParamsMutable(0)->reversedSources = 1 << INPUT_STABILIZED_FLAPPING_0;
+    stepServo(0, 200);
+    EXPECT_NEAR(200.0f, getServoTrackingError(0), 1.0f);
+
+    // so does a negative servo rate
+    startTrajectory();
+    servoParamsMutable(0)->rate = -100;
+    stepServo(0, 200);
+    EXPECT_NEAR(200.0f, getServoTrackingError(0), 1.0f);
+
+    // reversing another input source does not change the flapping direction
+    startTrajectory();
+    servoParamsMutable(0)->reversedSources = 1 << INPUT_STABILIZED_ROLL;
+    stepServo(0, 200);
+    EXPECT_NEAR(-200.0f, getServoTrackingError(0), 1.0f);
+}
+
+TEST(ServosTest, TrackingErrorScaleIsFlappingInputUnits)
+{
+    // at half servo rate a flapping input unit moves the servo half a microsecond
+    startTrajectory();
+    servoParamsMutable(2)->rate = 50;
+    stepServo(2, 100);
+    EXPECT_NEAR(-200.0f, getServoTrackingError(1), 2.0f);
+
+    // and at a quarter with the flapping mixer rule at half rate as well
+    startTrajectory();
+    servoParamsMutable(2)->rate = 50;
+    for (int i = 0; i < MAX_SERVO_RULES; i++) {
+        if (customServoMixers(i)->targetChannel == 2 && customServoMixers(i)->inputSource == INPUT_STABILIZED_FLAPPING_2) {
+            customServoMixersMutable(i)->rate = 50;
+        }
+    }
+    loadCustomServoMixer();
+    stepServo(2, 100);
+    EXPECT_NEAR(-400.0f, getServoTrackingError(1), 4.0f);
+
+    // the delay is the time to travel the error in microseconds at full servo speed
+    startTrajectory();
+    servoParamsMutable(2)->rate = 50;
+    stepServo(2, 100);
+    EXPECT_NEAR(100.0f / SERVO_SPEED_US_S, getServoTrackingDelay(1), 1e-4f);
+}
+
+TEST(ServosTest, TrackingErrorIsTheWorseWingOfEachPair)
+{
+    // the left wing of pair 1 lags 100 us, the right wing 300 us the other way
+    startTrajectory();
+    servo[2] = SERVO_CENTRE + 100;
+    stepServo(3, -300);
+    EXPECT_EQ(0.0f, getServoTrackingError(0));
+    EXPECT_NEAR(300.0f, getServoTrackingError(1), 1.0f);
+    EXPECT_NEAR(300.0f / SERVO_SPEED_US_S, getServoTrackingDelay(1), 1e-4f);
+
+    // no tracking error while the limiter is off
+    servoConfigMutable()->servo_accel_ms = 0;
+    stepServo(3, -300);
+    EXPECT_EQ(0.0f, getServoTrackingError(1));
+    EXPECT_EQ(0.0f, getServoTrackingDelay(1));
+}
+
+// STUBS
+
+extern "C" {
+uint32_t micros(void) { return currentTimeUs; }
+bool featureIsEnabled(uint32_t) { return false; }
+bool IS_RC_MODE_ACTIVE(boxId_e) { return false; }
+bool mixerIsTricopter(void) { return false; }
+void servosTricopterInit(void) { }
+void servosTricopterMixer(void) { }
+bool servosTricopterIsEnabledServoUnarmed(void) { return false; }
+void beeperConfirmationBeeps(uint8_t) { }
+void pwmWriteServo(uint8_t, float) { }
+float getServoSpeedScale(void) { return 1.0f; }
+ioTag_t timerioTagGetByUsage(timerUsageFlag_e, uint8_t) { return IO_TAG_NONE; }
+}
@@ -25,6 +25,7 @@
 #define CMS_MAX_DEVICE 4
 #define USE_FAKE_GYRO
 #define USE_BEEPER
+#define USE_CRC_SLICING
 #define USE_BLACKBOX
 #define USE_MAG
 #define USE_BARO
@@ -78,6 +79,13 @@
 
 #define USABLE_TIMER_CHANNEL_COUNT 0
 
+#ifdef EEPROM_IN_RAM
+#define EEPROM_SIZE     4096
+extern uint8_t eepromData[EEPROM_SIZE];
+#define __config_start (*eepromData)
+#define __config_end (*ARRAYEND(eepromData))
+#endif
+
 #define TARGET_IO_PORTA         0xffff
 #define TARGET_IO_PORTB         0xffff
 #define TARGET_IO_PORTC         0xffff
@@ -46,6 +46,7 @@ extern "C" {
     #include "fc/runtime_config.h"
     #include "fc/config.h"
     #include "flight/imu.h"
+    #include "flight/pid.h"
 
     #include "io/serial.h"
     #include "io/gps.h"
@@ -312,4 +313,7 @@ extern "C" {
         return true;
     }
 
+    void getOrnithopterWingState(ornithopterWingState_t *state) {
+        memset(state, 0, sizeof(*state));
+    }
 }
@@ -66,6 +66,10 @@ extern "C" {
     uint16_t testBatteryVoltage = 0;
     int32_t testAmperage = 0;
     int32_t testmAhDrawn = 0;
+    ornithopterWingState_t testWingState;
+    uint8_t testSentFrameType;
+
+    void processCrsf(timeUs_t currentTimeUs);
 
     serialPort_t *telemetrySharedPort;
     PG_REGISTER(batteryConfig_t, batteryConfig, PG_BATTERY_CONFIG, 0);
@@ -293,10 +297,115 @@ TEST(TelemetryCrsfTest, TestFlightMode)
     EXPECT_EQ(crfsCrc(frame, frameLen), frame[7]);
 }
 
+/*
+uint8_t     Destination
+uint8_t     Origin
+uint16_t    Stroke frequency ( Hz * 100 )
+int16_t     Stroke amplitude ( degree * 100 )
+int16_t     Ferocity modulation ( * 1000 )
+int16_t     Ferocity differential roll ( * 1000 )
+int16_t     Ferocity differential yaw ( * 1000 )
+*/
+TEST(TelemetryCrsfTest, TestOrnithopterWing)
+{
+    uint8_t frame[CRSF_FRAME_SIZE_MAX];
+
+    memset(&testWingState, 0, sizeof(testWingState));
+    int frameLen = getCrsfFrame(frame, CRSF_FRAMETYPE_ORNITHOPTER_WING);
+    EXPECT_EQ(CRSF_FRAME_ORNITHOPTER_WING_PAYLOAD_SIZE + CRSF_FRAME_ORIGIN_DEST_SIZE + FRAME_HEADER_FOOTER_LEN, frameLen);
+    EXPECT_EQ(CRSF_SYNC_BYTE, frame[0]); // address
+    EXPECT_EQ(14, frame[1]); // length
+    EXPECT_EQ(0x7E, frame[2]); // type
+    EXPECT_EQ(CRSF_ADDRESS_RADIO_TRANSMITTER, frame[3]); // destination
+    EXPECT_EQ(CRSF_ADDRESS_FLIGHT_CONTROLLER, frame[4]); // origin
+    for (int ii = 5; ii < 15; ++ii) {
+        EXPECT_EQ(0, frame[ii]);
+    }
+    EXPECT_EQ(crfsCrc(frame, frameLen), frame[15]);
+
+    testWingState.omega = 2.0f * M_PIf * 12.5f;    // 12.5 Hz stroke frequency
+    testWingState.amplitude = 35.0f;
+    testWingState.ferocityModulation = 0.25f;
+    testWingState.ferocityDifferentialRoll = -0.5f;
+    testWingState.ferocityDifferentialYaw = 40.0f;  // saturates
+    frameLen = getCrsfFrame(frame, CRSF_FRAMETYPE_ORNITHOPTER_WING);
+    EXPECT_EQ(CRSF_FRAME_ORNITHOPTER_WING_PAYLOAD_SIZE + CRSF_FRAME_ORIGIN_DEST_SIZE + FRAME_HEADER_FOOTER_LEN, frameLen);
+    const uint16_t frequency = frame[5] << 8 | frame[6];
+    EXPECT_EQ(1250, frequency);
+    const int16_t amplitude = frame[7] << 8 | frame[8];
+    EXPECT_EQ(3500, amplitude);
+    const int16_t ferocity = frame[9] << 8 | frame[10];
+    EXPECT_EQ(250, ferocity);
+    const int16_t ferocityRoll = frame[11] << 8 | frame[12];
+    EXPECT_EQ(-500, ferocityRoll);
+    const int16_t ferocityYaw = frame[13] << 8 | frame[14];
+    EXPECT_EQ(INT16_MAX, ferocityYaw);
+    EXPECT_EQ(crfsCrc(frame, frameLen), frame[15]);
+}
+
+static uint8_t sendScheduledFrame(timeUs_t currentTimeUs)
+{
+    testSentFrameType = 0;
+    processCrsf(currentTimeUs);
+    crsfRxSendTelemetryData();
+    return testSentFrameType;
+}
+
+TEST(TelemetryCrsfTest, TestScheduler)
+{
+    rxRuntimeConfig_t rxRuntimeConfig;
+    EXPECT_TRUE(crsfRxInit(rxConfig(), &rxRuntimeConfig));
+    sensorsSet(SENSOR_ACC);
+    initCrsfTelemetry();
+    EXPECT_TRUE(checkCrsfTelemetryState());
+
+    memset(&testWingState, 0, sizeof(testWingState));
+    attitude.values.roll = 0;
+    timeUs_t currentTimeUs = 1000000;
+
+    // all frames are equally stale, so the weights set the order: the weight 4 frames first,
+    // then GPS (weight 2) ahead of the battery and flight mode frames (weight 1)
+    EXPECT_EQ(CRSF_FRAMETYPE_ATTITUDE, sendScheduledFrame(currentTimeUs));
+    currentTimeUs += 20000;
+    EXPECT_EQ(CRSF_FRAMETYPE_ORNITHOPTER_WING, sendScheduledFrame(currentTimeUs));
+    currentTimeUs += 20000;
+    EXPECT_EQ(CRSF_FRAMETYPE_GPS, sendScheduledFrame(currentTimeUs));
+    currentTimeUs += 20000;
+    EXPECT_EQ(CRSF_FRAMETYPE_BATTERY_SENSOR, sendScheduledFrame(currentTimeUs));
+    currentTimeUs += 20000;
+    EXPECT_EQ(CRSF_FRAMETYPE_FLIGHT_MODE, sendScheduledFrame(currentTimeUs));
+
+    // nothing has changed and no keepalive has expired, so the slot is not used
+    currentTimeUs += 20000;
+    EXPECT_EQ(0, sendScheduledFrame(currentTimeUs));
+
+    // the attitude frame is stalest by weight, but unchanged, so the changed wing frame goes instead
+    currentTimeUs += 20000;
+    testWingState.amplitude = 30.0f;
+    EXPECT_EQ(CRSF_FRAMETYPE_ORNITHOPTER_WING, sendScheduledFrame(currentTimeUs));
+
+    // a changed frame is sent as soon as it is the stalest by weight
+    currentTimeUs += 20000;
+    attitude.values.roll = 100;
+    EXPECT_EQ(CRSF_FRAMETYPE_ATTITUDE, sendScheduledFrame(currentTimeUs));
+    currentTimeUs += 20000;
+    EXPECT_EQ(0, sendScheduledFrame(currentTimeUs));
+
+    // an unchanged frame is resent once its keepalive expires
+    const timeUs_t wingKeepaliveUs = 1000000 + 120000 + 500000;
+    EXPECT_EQ(0, sendScheduledFrame(wingKeepaliveUs - 1));
+    EXPECT_EQ(CRSF_FRAMETYPE_ORNITHOPTER_WING, sendScheduledFrame(wingKeepaliveUs));
+}
+
 // STUBS
 
 extern "C" {
 
+void getOrnithopterWingState(ornithopterWingState_t *state)
+{
+    *state = testWingState;
+}
+
 int16_t debug[DEBUG16_VALUE_COUNT];
 
 const uint32_t baudRates[] = {0, 9600, 19200, 38400, 57600, 115200, 230400, 250000, 400000}; // see baudRate_e
@@ -319,13 +428,15 @@ uint32_t serialRxBytesWaiting(const serialPort_t *) {return 0;}
 uint32_t serialTxBytesFree(const serialPort_t *) {return 0;}
 uint8_t serialRead(serialPort_t *) {return 0;}
 void serialWrite(serialPort_t *, uint8_t) {}
-void serialWriteBuf(serialPort_t *, const uint8_t *, int) {}
+void serialWriteBuf(serialPort_t *, const uint8_t *data, int) { testSentFrameType = data[2]; }
 void serialSetMode(serialPort_t *, portMode_e) {}
-serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) {return NULL;}
+static serialPort_t testSerialPort;
+serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) {return &testSerialPort;}
 void closeSerialPort(serialPort_t *) {}
 bool isSerialTransmitBufferEmpty(const serialPort_t *) { return true; }
 
-serialPortConfig_t *findSerialPortConfig(serialPortFunction_e) {return NULL;}
+static serialPortConfig_t testSerialPortConfig;
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e) {return &testSerialPortConfig;}
 
 bool telemetryDetermineEnabledState(portSharing_e) {return true;}
 bool telemetryCheckRxPortShared(const serialPortConfig_t *) {return true;}
@@ -28,6 +28,7 @@ extern "C" {
     #include "fc/config.h"
     #include "fc/controlrate_profile.h"
     #include "fc/core.h"
+    #include "fc/loop_overrun.h"
     #include "fc/rc_controls.h"
     #include "fc/rc_modes.h"
     #include "fc/runtime_config.h"
@@ -69,6 +70,7 @@ extern "C" {
     attitudeEulerAngles_t attitude;
     gpsSolutionData_t gpsSol;
     uint32_t targetPidLooptime;
+    gyro_t gyro;
     bool cmsInMenu = false;
     float axisPID_P[3], axisPID_I[3], axisPID_D[3], axisPIDSum[3];
     rxRuntimeConfig_t rxRuntimeConfig = {};
@@ -171,6 +173,10 @@ extern "C" {
     void dashboardEnablePageCycling(void) {}
     void dashboardDisablePageCycling(void) {}
     bool imuQuaternionHeadfreeOffsetSet(void) { return true; }
+    void wingMonitorReset(void) {}
+    uint16_t loopSubtaskUs[LOOP_SUBTASK_COUNT];
+    void loopOverrunCheck(timeUs_t, timeUs_t, timeDelta_t, timeDelta_t) {}
+    void loopOverrunReset(void) {}
     void rescheduleTask(cfTaskId_e, uint32_t) {}
     bool usbCableIsInserted(void) { return false; }
     bool usbVcpIsConnected(void) { return false; }
@@ -0,0 +1,105 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "flight/wing_monitor.h"
+
+    uint8_t debugMode;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define PASS_US 250
+
+// One servo mixer pass per PID loop, with the given limit hit on every n-th pass
+static timeUs_t runPasses(timeUs_t timeUs, int passes, int pair, wingSaturation_e limit, int every)
+{
+    for (int i = 0; i < passes; i++) {
+        if (every && i % every == 0) {
+            wingSaturationHit(pair, limit);
+        }
+        timeUs += PASS_US;
+        wingMonitorUpdate(timeUs);
+    }
+    return timeUs;
+}
+
+TEST(WingMonitorTest, WindowPercentAndCount)
+{
+    wingMonitorReset();
+    debugMode = DEBUG_WING_SATURATION;
+    timeUs_t timeUs = runPasses(1000000, 1, 0, WING_SATURATION_AMPLITUDE, 0);
+
+    // the rest of a window with pair 1 at the servo endpoint on every fourth pass
+    const int windowPasses = WING_MONITOR_WINDOW_US / PASS_US;
+    timeUs = runPasses(timeUs, windowPasses - 1, 1, WING_SATURATION_ENDPOINT, 4);
+
+    // nothing is reported until the window closes
+    EXPECT_EQ(0, wingSaturationPercent(1, WING_SATURATION_ENDPOINT));
+    timeUs = runPasses(timeUs, 1, 1, WING_SATURATION_ENDPOINT, 0);
+
+    EXPECT_EQ(25, wingSaturationPercent(1, WING_SATURATION_ENDPOINT));
+    EXPECT_EQ((uint32_t)windowPasses / 4, wingSaturationCount(1, WING_SATURATION_ENDPOINT));
+    EXPECT_EQ(0, wingSaturationPercent(0, WING_SATURATION_ENDPOINT));
+    EXPECT_EQ(0, wingSaturationPercent(1, WING_SATURATION_SLEW));
+    EXPECT_EQ(25, debug[WING_SATURATION_ENDPOINT]);
+
+    int pair;
+    wingSaturation_e limit;
+    EXPECT_EQ(25, wingSaturationWorst(&pair, &limit));
+    EXPECT_EQ(1, pair);
+    EXPECT_EQ(WING_SATURATION_ENDPOINT, limit);
+
+    // a clean window clears the share but keeps the count
+    timeUs = runPasses(timeUs, windowPasses, 1, WING_SATURATION_ENDPOINT, 0);
+    EXPECT_EQ(0, wingSaturationPercent(1, WING_SATURATION_ENDPOINT));
+    EXPECT_EQ((uint32_t)windowPasses / 4, wingSaturationCount(1, WING_SATURATION_ENDPOINT));
+    EXPECT_EQ(0, wingSaturationWorst(&pair, &limit));
+
+    wingMonitorReset();
+    EXPECT_EQ(0u, wingSaturationCount(1, WING_SATURATION_ENDPOINT));
+    debugMode = DEBUG_NONE;
+}
+
+TEST(WingMonitorTest, SeveralHitsInOnePassCountOnce)
+{
+    wingMonitorReset();
+    timeUs_t timeUs = runPasses(2000000, 1, 0, WING_SATURATION_AMPLITUDE, 0);
+
+    for (int i = 0; i < 100; i++) {
+        // both wing sides of pair 2 hit ferocity, and the amplitude clamp marks every pair
+        wingSaturationHit(2, WING_SATURATION_FEROCITY);
+        wingSaturationHit(2, WING_SATURATION_FEROCITY);
+        wingSaturationHitAllPairs(WING_SATURATION_AMPLITUDE);
+        timeUs += PASS_US;
+        wingMonitorUpdate(timeUs);
+    }
+    timeUs = runPasses(timeUs, WING_MONITOR_WINDOW_US / PASS_US, 0, WING_SATURATION_AMPLITUDE, 0);
+
+    EXPECT_EQ(100u, wingSaturationCount(2, WING_SATURATION_FEROCITY));
+    for (int pair = 0; pair < MAX_ORNITHOPTER_PAIRS; pair++) {
+        EXPECT_EQ(100u, wingSaturationCount(pair, WING_SATURATION_AMPLITUDE));
+    }
+    EXPECT_EQ(0u, wingSaturationCount(1, WING_SATURATION_FEROCITY));
+}